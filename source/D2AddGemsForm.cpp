@@ -74,7 +74,7 @@ namespace
     void InitTreeControl(CTreeCtrl& tree, std::deque<AvailableItemFolder>& parent,
         std::map<std::string, d2ce::AvailableItemType>::const_iterator& iter,
         const std::map<std::string, d2ce::AvailableItemType>::const_iterator& iter_end,
-        std::list<d2ce::Item>& bufferItems,
+        d2ce::ItemList& bufferItems,
         std::map<HTREEITEM, d2ce::AvailableItemType>& availableItemTypes,
         const d2ce::ItemType* sourceItemTypePtr)
     {
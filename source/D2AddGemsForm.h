@@ -69,7 +69,7 @@ private:
     d2ce::Item * ItemPtr = nullptr;
 
     std::map<HTREEITEM, d2ce::AvailableItemType> AvailableItemTypes;
-    mutable std::list<d2ce::Item> AvailableItems;
+    mutable d2ce::ItemList AvailableItems;
 
 public:
 };
@@ -220,6 +220,24 @@ namespace
         return p.replace_extension().c_str();
     }
 
+    bool HasBackupStore(LPCTSTR fullPath)
+    {
+        if (fullPath == nullptr)
+        {
+            return false;
+        }
+
+        CString temp = (LPCTSTR)fullPath;
+        if (temp.IsEmpty())
+        {
+            return false;
+        }
+
+        d2ce::BackupStore backupStore(std::filesystem::path(fullPath));
+        size_t index = 0;
+        return backupStore.getRestoreIndex(index);
+    }
+
     bool HasBackupFile(LPCTSTR fullPath)
     {
         if (fullPath == nullptr)
@@ -233,6 +251,11 @@ namespace
             return false;
         }
 
+        if (HasBackupStore(fullPath))
+        {
+            return true;
+        }
+
         std::filesystem::path p = fullPath;
         auto fileExt = p.extension().wstring();
         if (fileExt == L".d2s")
@@ -257,6 +280,24 @@ namespace
         return false;
     }
 
+    bool RestoreFromBackupStore(LPCTSTR fullPath)
+    {
+        if (fullPath == nullptr)
+        {
+            return false;
+        }
+
+        // restore the backup taken before the current contents of the file
+        d2ce::BackupStore backupStore(std::filesystem::path(fullPath));
+        size_t index = 0;
+        if (!backupStore.getRestoreIndex(index))
+        {
+            return false;
+        }
+
+        return backupStore.restoreFile(index);
+    }
+
     CString GetLastBackupFile(LPCTSTR fullPath)
     {
         if (fullPath == nullptr)
@@ -3068,7 +3109,7 @@ void CD2MainForm::OpenFile(LPCTSTR filename)
         }
 
         CString backupname = GetLastBackupFile(filename);
-        if (backupname.IsEmpty())
+        if (backupname.IsEmpty() && !HasBackupStore(filename))
         {
             AfxMessageBox(errorMsg, MB_OK | MB_ICONERROR);
 
@@ -3085,30 +3126,42 @@ void CD2MainForm::OpenFile(LPCTSTR filename)
             return;
         }
 
-        try
+        if (!RestoreFromBackupStore(filename))
         {
-            std::filesystem::remove(filename);
+            if (backupname.IsEmpty())
+            {
+                AfxMessageBox(_T("Failed to restore character file from backup."), MB_OK | MB_ICONERROR);
+                Editted = false;
+                OnFileClose();
+                return;
+            }
 
+            // backup files from older versions of the editor
             try
             {
-                // rename temp file to character file
-                std::filesystem::rename(backupname.GetString(), filename);
+                std::filesystem::remove(filename);
+
+                try
+                {
+                    // rename temp file to character file
+                    std::filesystem::rename(backupname.GetString(), filename);
+                }
+                catch (std::filesystem::filesystem_error const&)
+                {
+                    CString msg;
+                    msg.Format(_T("Failed to rename backup character file: %s"), backupname.GetString());
+                    AfxMessageBox(CString(msg), MB_YESNO | MB_ICONERROR);
+                    return;
+                }
             }
             catch (std::filesystem::filesystem_error const&)
             {
                 CString msg;
-                msg.Format(_T("Failed to rename backup character file: %s"), backupname.GetString());
-                AfxMessageBox(CString(msg), MB_YESNO | MB_ICONERROR);
-                return;
-            }
-        }
-        catch (std::filesystem::filesystem_error const&)
-        {
-            CString msg;
-            msg.Format(_T("Failed to delete existing character file: %s"), filename);
-            AfxMessageBox(msg, MB_OK | MB_ICONERROR);
+                msg.Format(_T("Failed to delete existing character file: %s"), filename);
+                AfxMessageBox(msg, MB_OK | MB_ICONERROR);
 
-            // just reopen it again
+                // just reopen it again
+            }
         }
 
         // return if open not successful
@@ -3657,7 +3710,7 @@ void CD2MainForm::OnViewRefresh()
         }
 
         CString backupname = GetLastBackupFile(curPathName.GetString());
-        if (backupname.IsEmpty())
+        if (backupname.IsEmpty() && !HasBackupStore(curPathName.GetString()))
         {
             AfxMessageBox(errorMsg, MB_OK | MB_ICONERROR);
 
@@ -3674,30 +3727,42 @@ void CD2MainForm::OnViewRefresh()
             return;
         }
 
-        try
+        if (!RestoreFromBackupStore(curPathName.GetString()))
         {
-            std::filesystem::remove(curPathName.GetString());
+            if (backupname.IsEmpty())
+            {
+                AfxMessageBox(_T("Failed to restore character file from backup."), MB_OK | MB_ICONERROR);
+                Editted = false;
+                OnFileClose();
+                return;
+            }
 
+            // backup files from older versions of the editor
             try
             {
-                // rename temp file to character file
-                std::filesystem::rename(backupname.GetString(), curPathName.GetString());
+                std::filesystem::remove(curPathName.GetString());
+
+                try
+                {
+                    // rename temp file to character file
+                    std::filesystem::rename(backupname.GetString(), curPathName.GetString());
+                }
+                catch (std::filesystem::filesystem_error const&)
+                {
+                    CString msg;
+                    msg.Format(_T("Failed to rename backup character file: %s"), backupname.GetString());
+                    AfxMessageBox(CString(msg), MB_YESNO | MB_ICONERROR);
+                    return;
+                }
             }
             catch (std::filesystem::filesystem_error const&)
             {
                 CString msg;
-                msg.Format(_T("Failed to rename backup character file: %s"), backupname.GetString());
-                AfxMessageBox(CString(msg), MB_YESNO | MB_ICONERROR);
-                return;
-            }
-        }
-        catch (std::filesystem::filesystem_error const&)
-        {
-            CString msg;
-            msg.Format(_T("Failed to delete existing character file: %s"), curPathName.GetString());
-            AfxMessageBox(msg, MB_OK | MB_ICONERROR);
+                msg.Format(_T("Failed to delete existing character file: %s"), curPathName.GetString());
+                AfxMessageBox(msg, MB_OK | MB_ICONERROR);
 
-            // just reopen it again
+                // just reopen it again
+            }
         }
 
         // return if open not successful
@@ -4875,39 +4940,50 @@ void CD2MainForm::OnOptionsRestoreChar()
 
     CString curPathName = CurPathName;
     CString backupname = GetLastBackupFile(CurPathName);
-    if (backupname.IsEmpty())
+    if (backupname.IsEmpty() && !HasBackupStore(CurPathName))
     {
         hasBackupFile = false;
+        AfxMessageBox(_T("There is no earlier backup of the character file to restore."), MB_OK | MB_ICONINFORMATION);
         return;
     }
 
     Editted = false;
     DoFileCloseAction();
 
-    try
+    if (!RestoreFromBackupStore(curPathName.GetString()))
     {
-        std::filesystem::remove(curPathName.GetString());
+        if (backupname.IsEmpty())
+        {
+            AfxMessageBox(_T("Failed to restore character file from backup."), MB_OK | MB_ICONERROR);
+            return;
+        }
 
+        // backup files from older versions of the editor
         try
         {
-            // rename temp file to character file
-            std::filesystem::rename(backupname.GetString(), curPathName.GetString());
+            std::filesystem::remove(curPathName.GetString());
+
+            try
+            {
+                // rename temp file to character file
+                std::filesystem::rename(backupname.GetString(), curPathName.GetString());
+            }
+            catch (std::filesystem::filesystem_error const&)
+            {
+                CString msg;
+                msg.Format(_T("Failed to rename backup character file: %s"), backupname.GetString());
+                AfxMessageBox(CString(msg), MB_OK | MB_ICONERROR);
+                return;
+            }
         }
         catch (std::filesystem::filesystem_error const&)
         {
             CString msg;
-            msg.Format(_T("Failed to rename backup character file: %s"), backupname.GetString());
-            AfxMessageBox(CString(msg), MB_OK | MB_ICONERROR);
-            return;
-        }
-    }
-    catch (std::filesystem::filesystem_error const&)
-    {
-        CString msg;
-        msg.Format(_T("Failed to delete existing character file: %s"), curPathName.GetString());
-        AfxMessageBox(msg, MB_OK | MB_ICONERROR);
+            msg.Format(_T("Failed to delete existing character file: %s"), curPathName.GetString());
+            AfxMessageBox(msg, MB_OK | MB_ICONERROR);
 
-        // just reopen it again
+            // just reopen it again
+        }
     }
 
     // return if open not successful
@@ -5330,12 +5406,12 @@ d2ce::Mercenary& CD2MainForm::getMercenaryInfo()
     return CharInfo.getMercenaryInfo();
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& CD2MainForm::getMercItems() const
+const d2ce::ItemList& CD2MainForm::getMercItems() const
 {
     return CharInfo.getMercItems();
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& CD2MainForm::getCorpseItems() const
+const d2ce::ItemList& CD2MainForm::getCorpseItems() const
 {
     return CharInfo.getCorpseItems();
 }
@@ -5345,7 +5421,7 @@ bool CD2MainForm::hasGolem() const
     return CharInfo.hasGolem();
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& CD2MainForm::getGolemItem() const
+const d2ce::ItemList& CD2MainForm::getGolemItem() const
 {
     return CharInfo.getGolemItem();
 }
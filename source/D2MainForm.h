@@ -378,14 +378,14 @@ public:
 
     // Mercenary
     d2ce::Mercenary& getMercenaryInfo();
-    const std::list<d2ce::Item>& getMercItems() const;
+    const d2ce::ItemList& getMercItems() const;
 
     // Corpse Items
-    const std::list<d2ce::Item>& getCorpseItems() const;
+    const d2ce::ItemList& getCorpseItems() const;
 
     // Golem Info
     bool hasGolem() const;
-    const std::list<d2ce::Item>& getGolemItem() const;
+    const d2ce::ItemList& getGolemItem() const;
 
     // Quests
     const d2ce::ActsInfo& getQuests();
@@ -85,7 +85,7 @@ protected:
     CSpinButtonCtrl SocketsSpinner;
 
     std::map<HTREEITEM, d2ce::AvailableItemType> AvailableItemTypes;
-    mutable std::list<d2ce::Item> AvailableItems;
+    mutable d2ce::ItemList AvailableItems;
     std::map<std::uint16_t, int> MonsterIDToIndexMap;
 };
 //---------------------------------------------------------------------------
@@ -82,7 +82,7 @@ std::uint16_t& d2ce::ActsInfo::getQuestDataRef(EnumDifficulty diff, EnumAct act,
     return dummy;
 }
 //---------------------------------------------------------------------------
-bool d2ce::ActsInfo::readQuests(std::FILE* charfile)
+bool d2ce::ActsInfo::readQuests(BitSource& charfile)
 {
     for (auto& extraBit : Quests_extraBits)
     {
@@ -92,84 +92,84 @@ bool d2ce::ActsInfo::readQuests(std::FILE* charfile)
     Quests_version = { 0x06, 0x00, 0x00, 0x00 };
 
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != QUESTS_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != QUESTS_MARKER[1])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != QUESTS_MARKER[2])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != QUESTS_MARKER[3])
     {
         return false;
     }
 
     // found quests marker (0x216F6F57). 
-    std::fread(Quests_version.data(), Quests_version.size(), 1, charfile);
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(Quests_version.data(), Quests_version.size());
+    charfile.read(&value, sizeof(value));
     if (value != QUESTS_SIZE_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != QUESTS_SIZE_MARKER[1])
     {
         return false;
     }
 
-    if (feof(charfile))
+    if (charfile.eof())
     {
         return false;
     }
 
     if (CharInfo.getVersion() >= EnumCharVersion::v107)
     {
-        return std::fread(Acts.data(), Acts.size() * sizeof(ActsInfoData), 1, charfile) == 1 ? true : false;
+        return charfile.read(Acts.data(), Acts.size() * sizeof(ActsInfoData)) == 1 ? true : false;
     }
 
     // Only copy 4 acts of Quest data for each difficulty
     for (std::uint32_t i = 0; i < NUM_OF_DIFFICULTY; ++i)
     {
-        if (feof(charfile))
+        if (charfile.eof())
         {
             return false;
         }
 
-        if (std::fread(Acts[i].Act.data(), Acts[i].Act.size() * sizeof(ActInfo), 1, charfile) != 1)
+        if (charfile.read(Acts[i].Act.data(), Acts[i].Act.size() * sizeof(ActInfo)) != 1)
         {
             return false;
         }
 
-        if (feof(charfile))
+        if (charfile.eof())
         {
             return false;
         }
 
-        if (std::fread(Quests_extraBits[i].data(), Quests_extraBits[i].size(), 1, charfile) != 1)
+        if (charfile.read(Quests_extraBits[i].data(), Quests_extraBits[i].size()) != 1)
         {
             return false;
         }
     }
 
-    if (feof(charfile))
+    if (charfile.eof())
     {
         return false;
     }
 
-    if (std::fread(Quests_unknown.data(), Quests_unknown.size(), 1, charfile) != 1)
+    if (charfile.read(Quests_unknown.data(), Quests_unknown.size()) != 1)
     {
         return false;
     }
@@ -494,7 +494,7 @@ bool d2ce::ActsInfo::readQuests(const Json::Value& questsRoot, bool bSerializedF
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::ActsInfo::readWaypoints(std::FILE* charfile)
+bool d2ce::ActsInfo::readWaypoints(BitSource& charfile)
 {
     Waypoints_unknown = { 0x0102, 0x0102, 0x0102 };
     for (auto& extraBit : Waypoints_extraBits)
@@ -504,27 +504,27 @@ bool d2ce::ActsInfo::readWaypoints(std::FILE* charfile)
     Waypoints_version = { 0x01, 0x00, 0x00, 0x00 };
 
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != WAYPOINTS_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != WAYPOINTS_MARKER[1])
     {
         return false;
     }
 
     // found waypoints marker (0x5357).
-    std::fread(Waypoints_version.data(), Waypoints_version.size(), 1, charfile);
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(Waypoints_version.data(), Waypoints_version.size());
+    charfile.read(&value, sizeof(value));
     if (value != WAYPOINTS_SIZE_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != WAYPOINTS_SIZE_MARKER[1])
     {
         return false;
@@ -532,9 +532,9 @@ bool d2ce::ActsInfo::readWaypoints(std::FILE* charfile)
 
     for (int i = 0; i < NUM_OF_DIFFICULTY; ++i)
     {
-        std::fread(&Waypoints_unknown[i], sizeof(Waypoints_unknown[i]), 1, charfile); // skip 0x0102 marker
-        std::fread(&Waypoints[i], sizeof(Waypoints[i]), 1, charfile);
-        std::fread(Waypoints_extraBits[i].data(), Waypoints_extraBits[i].size(), 1, charfile); // skip extra bits
+        charfile.read(&Waypoints_unknown[i], sizeof(Waypoints_unknown[i])); // skip 0x0102 marker
+        charfile.read(&Waypoints[i], sizeof(Waypoints[i]));
+        charfile.read(Waypoints_extraBits[i].data(), Waypoints_extraBits[i].size()); // skip extra bits
 
         // verify act data. 
         // Some Character files had incorrect Intro bit set for Act V causing the program to incorrectly force a completion of Act IV
@@ -783,29 +783,29 @@ bool d2ce::ActsInfo::readWaypoints(const Json::Value& waypointsRoot, bool bSeria
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::ActsInfo::readNPC(std::FILE* charfile)
+bool d2ce::ActsInfo::readNPC(BitSource& charfile)
 {
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != NPC_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != NPC_MARKER[1])
     {
         return false;
     }
 
     // found NPC marker (0x7701).
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != NPC_SIZE_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != NPC_SIZE_MARKER[1])
     {
         return false;
@@ -813,12 +813,12 @@ bool d2ce::ActsInfo::readNPC(std::FILE* charfile)
 
     for (int i = 0; i < NUM_OF_DIFFICULTY; ++i)
     {
-        std::fread(&NPCIntroductions[i], sizeof(NPCIntroductions[i]), 1, charfile);
+        charfile.read(&NPCIntroductions[i], sizeof(NPCIntroductions[i]));
     }
     
     for (int i = 0; i < NUM_OF_DIFFICULTY; ++i)
     {
-        std::fread(&NPCCongrats[i], sizeof(NPCCongrats[i]), 1, charfile);
+        charfile.read(&NPCCongrats[i], sizeof(NPCCongrats[i]));
     }
 
     return true;
@@ -948,77 +948,73 @@ bool d2ce::ActsInfo::readNPC(const Json::Value& npcsRoot, bool bSerializedFormat
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::ActsInfo::writeQuests(std::FILE* charfile) const
+bool d2ce::ActsInfo::writeQuests(BitSink& charfile) const
 {
-    std::fwrite(QUESTS_MARKER.data(), QUESTS_MARKER.size(), 1, charfile);
-    std::fwrite(Quests_version.data(), Quests_version.size(), 1, charfile);
-    std::fwrite(QUESTS_SIZE_MARKER.data(), QUESTS_SIZE_MARKER.size(), 1, charfile);
+    charfile.write(QUESTS_MARKER.data(), QUESTS_MARKER.size(), 1);
+    charfile.write(Quests_version.data(), Quests_version.size(), 1);
+    charfile.write(QUESTS_SIZE_MARKER.data(), QUESTS_SIZE_MARKER.size(), 1);
     if (CharInfo.getVersion() >= EnumCharVersion::v107)
     {
-        if (std::fwrite(Acts.data(), Acts.size() * sizeof(ActsInfoData), 1, charfile) != 1)
+        if (charfile.write(Acts.data(), Acts.size() * sizeof(ActsInfoData), 1) != 1)
         {
             return false;
         }
 
-        std::fflush(charfile);
         return true;
     }
 
     // Only copy 4 acts of Quest data for each difficulty
     for (std::uint32_t i = 0; i < NUM_OF_DIFFICULTY; ++i)
     {
-        if (std::fwrite(Acts[i].Act.data(), Acts[i].Act.size() * sizeof(ActInfo), 1, charfile) != 1)
+        if (charfile.write(Acts[i].Act.data(), Acts[i].Act.size() * sizeof(ActInfo), 1) != 1)
         {
             return false;
         }
 
-        if (std::fwrite(Quests_extraBits[i].data(), Quests_extraBits[i].size(), 1, charfile) != 1)
+        if (charfile.write(Quests_extraBits[i].data(), Quests_extraBits[i].size(), 1) != 1)
         {
             return false;
         }
     }
 
 
-    if (std::fwrite(Quests_unknown.data(), Quests_unknown.size(), 1, charfile) != 1)
+    if (charfile.write(Quests_unknown.data(), Quests_unknown.size(), 1) != 1)
     {
         return false;
     }
 
-    std::fflush(charfile);
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::ActsInfo::writeWaypoints(std::FILE* charfile) const
+bool d2ce::ActsInfo::writeWaypoints(BitSink& charfile) const
 {
-    std::fwrite(WAYPOINTS_MARKER.data(), WAYPOINTS_MARKER.size(), 1, charfile);
-    std::fwrite(Waypoints_version.data(), Waypoints_version.size(), 1, charfile);
-    std::fwrite(WAYPOINTS_SIZE_MARKER.data(), WAYPOINTS_SIZE_MARKER.size(), 1, charfile);
+    charfile.write(WAYPOINTS_MARKER.data(), WAYPOINTS_MARKER.size(), 1);
+    charfile.write(Waypoints_version.data(), Waypoints_version.size(), 1);
+    charfile.write(WAYPOINTS_SIZE_MARKER.data(), WAYPOINTS_SIZE_MARKER.size(), 1);
     for (int i = 0; i < NUM_OF_DIFFICULTY; ++i)
     {
-        std::fwrite(&Waypoints_unknown[i], sizeof(Waypoints_unknown[i]), 1, charfile); // skip 0x0102 marker
-        std::fwrite(&Waypoints[i], sizeof(Waypoints[i]), 1, charfile);
-        std::fwrite(Waypoints_extraBits[i].data(), Waypoints_extraBits[i].size(), 1, charfile); // skip extra bits
+        charfile.write(&Waypoints_unknown[i], sizeof(Waypoints_unknown[i]), 1); // skip 0x0102 marker
+        charfile.write(&Waypoints[i], sizeof(Waypoints[i]), 1);
+        charfile.write(Waypoints_extraBits[i].data(), Waypoints_extraBits[i].size(), 1); // skip extra bits
     }
 
-    std::fflush(charfile);
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::ActsInfo::writeNPC(std::FILE* charfile) const
+bool d2ce::ActsInfo::writeNPC(BitSink& charfile) const
 {
-    std::fwrite(NPC_MARKER.data(), NPC_MARKER.size(), 1, charfile);
-    std::fwrite(NPC_SIZE_MARKER.data(), NPC_SIZE_MARKER.size(), 1, charfile);
+    charfile.write(NPC_MARKER.data(), NPC_MARKER.size(), 1);
+    charfile.write(NPC_SIZE_MARKER.data(), NPC_SIZE_MARKER.size(), 1);
     for (int i = 0; i < NUM_OF_DIFFICULTY; ++i)
     {
-        std::fwrite(&NPCIntroductions[i], sizeof(NPCIntroductions[i]), 1, charfile);
+        charfile.write(&NPCIntroductions[i], sizeof(NPCIntroductions[i]), 1);
     }
 
     for (int i = 0; i < NUM_OF_DIFFICULTY; ++i)
     {
-        std::fwrite(&NPCCongrats[i], sizeof(NPCCongrats[i]), 1, charfile);
+        charfile.write(&NPCCongrats[i], sizeof(NPCCongrats[i]), 1);
     }
 
-    std::fflush(charfile);
     return true;
 }
 //---------------------------------------------------------------------------
@@ -1143,7 +1139,7 @@ void d2ce::ActsInfo::validateAct(EnumDifficulty diff, EnumAct act)
     }
 }
 //---------------------------------------------------------------------------
-bool d2ce::ActsInfo::readActs(std::FILE* charfile)
+bool d2ce::ActsInfo::readActs(BitSource& charfile)
 {
     QuestsDataCorrected = false;
     if (!readQuests(charfile))
@@ -1189,7 +1185,7 @@ bool d2ce::ActsInfo::readActs(const Json::Value& root, bool bSerializedFormat)
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::ActsInfo::writeActs(std::FILE* charfile) const
+bool d2ce::ActsInfo::writeActs(BitSink& charfile) const
 {
     QuestsDataCorrected = false;
     if (!writeQuests(charfile))
@@ -21,6 +21,8 @@
 
 #include "Constants.h"
 #include "DataTypes.h"
+#include "BitSource.h"
+#include "BitSink.h"
 #include <json/json.h>
 
 namespace d2ce
@@ -86,7 +88,7 @@ namespace d2ce
     private:
         std::uint16_t& getQuestDataRef(EnumDifficulty diff, EnumAct act, std::uint8_t quest) const;
 
-        bool readQuests(std::FILE* charfile);
+        bool readQuests(BitSource& charfile);
         void applyJsonQuest(const Json::Value& questRoot, bool bSerializedFormat, EnumDifficulty diff, EnumAct act, std::uint8_t quest);
         void applyJsonActIntro(const Json::Value& actIntroRoot, bool bSerializedFormat, EnumDifficulty diff, EnumAct act);
         void applyJsonActComplete(const Json::Value& actCompleteRoot, bool bSerializedFormat, EnumDifficulty diff, EnumAct act);
@@ -94,25 +96,25 @@ namespace d2ce
         void applyJsonQuestDifficulty(const Json::Value& questDiffRoot, bool bSerializedFormat, EnumDifficulty diff);
         void applyJsonQuests(const Json::Value& questsRoot, bool bSerializedFormat);
         bool readQuests(const Json::Value& questsRoot, bool bSerializedFormat);
-        bool readWaypoints(std::FILE* charfile);
+        bool readWaypoints(BitSource& charfile);
         void applyJsonWaypointAct(const Json::Value& waypointActRoot, bool bSerializedFormat, EnumDifficulty diff, EnumAct act);
         void applyJsonWaypointDifficulty(const Json::Value& waypointDiffRoot, bool bSerializedFormat, EnumDifficulty diff);
         void applyJsonWaypoints(const Json::Value& waypointsRoot, bool bSerializedFormat);
         bool readWaypoints(const Json::Value& waypointsRoot, bool bSerializedFormat);
-        bool readNPC(std::FILE* charfile);
+        bool readNPC(BitSource& charfile);
         void applyJsonNPCsDifficulty(const Json::Value& npcsDiffRoot, bool bSerializedFormat, EnumDifficulty diff);
         void applyJsonNPCs(const Json::Value& npcsRoot, bool bSerializedFormat);
         bool readNPC(const Json::Value& npcsRoot, bool bSerializedFormat);
-        bool writeQuests(std::FILE* charfile) const;
-        bool writeWaypoints(std::FILE* charfile) const;
-        bool writeNPC(std::FILE* charfile) const;
+        bool writeQuests(BitSink& charfile) const;
+        bool writeWaypoints(BitSink& charfile) const;
+        bool writeNPC(BitSink& charfile) const;
 
         void validateAct(EnumDifficulty diff, EnumAct act);
 
     protected:
-        bool readActs(std::FILE* charfile);
+        bool readActs(BitSource& charfile);
         bool readActs(const Json::Value& root, bool bSerializedFormat);
-        bool writeActs(std::FILE* charfile) const;
+        bool writeActs(BitSink& charfile) const;
 
         void questsAsJson(Json::Value& parent, bool bSerializedFormat = false) const;
         std::string getQuestsJsonName(EnumDifficulty diff, bool bSerializedFormat = false) const;
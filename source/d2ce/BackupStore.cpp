@@ -0,0 +1,750 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#include "pch.h"
+#include "BackupStore.h"
+#include "BitSource.h"
+#include "BitSink.h"
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <io.h>
+
+//---------------------------------------------------------------------------
+namespace d2ce
+{
+    /*
+       Pack file layout (little endian):
+         header:   "D2BK", version (4 bytes)
+         block:    BACKUP_BLOCK_RECORD (1 byte), size (4 bytes), data
+         snapshot: BACKUP_SNAPSHOT_RECORD (1 byte), timestamp (8 bytes), file size (4 bytes),
+                   file hash (8 bytes), number of blocks (4 bytes), block ids (4 bytes each)
+       Block ids are the order in which the blocks appear in the pack.
+       A torn record at the end (crash during a backup) is ignored and overwritten.
+
+       Index file layout (little endian):
+         header:   "D2BI", version (4 bytes)
+         block:    BACKUP_BLOCK_RECORD (1 byte), size (4 bytes), block hash (8 bytes)
+         snapshot: same as the snapshot record of the pack
+       The index lists the records of the pack in the same order, so the pack offset
+       of every record follows from the sizes of the records before it.
+    */
+    constexpr std::array<std::uint8_t, 4> BACKUP_PACK_MARKER = { 0x44, 0x32, 0x42, 0x4B }; // alternatively "D2BK"
+    constexpr std::uint32_t BACKUP_PACK_VERSION = 1ui32;
+    constexpr std::array<std::uint8_t, 4> BACKUP_INDEX_MARKER = { 0x44, 0x32, 0x42, 0x49 }; // alternatively "D2BI"
+    constexpr std::uint32_t BACKUP_INDEX_VERSION = 1ui32;
+    constexpr size_t BACKUP_HEADER_SIZE = BACKUP_PACK_MARKER.size() + sizeof(BACKUP_PACK_VERSION);
+    constexpr std::uint8_t BACKUP_BLOCK_RECORD = 1ui8;
+    constexpr std::uint8_t BACKUP_SNAPSHOT_RECORD = 2ui8;
+    constexpr size_t BACKUP_BLOCK_RECORD_HEADER_SIZE = sizeof(BACKUP_BLOCK_RECORD) + sizeof(std::uint32_t);
+    constexpr size_t BACKUP_SNAPSHOT_RECORD_HEADER_SIZE = sizeof(BACKUP_SNAPSHOT_RECORD) + sizeof(std::int64_t) + sizeof(std::uint32_t) + sizeof(std::uint64_t) + sizeof(std::uint32_t);
+
+    // content-defined block boundaries so an edit only changes the blocks around it
+    constexpr size_t BACKUP_MIN_BLOCK_SIZE = 64;
+    constexpr size_t BACKUP_MAX_BLOCK_SIZE = 4096;
+    constexpr std::uint32_t BACKUP_BOUNDARY_MASK = 0xFF000000ui32; // average block size of 256 bytes past the minimum
+
+    const std::array<std::uint32_t, 256>& GetBackupGearTable()
+    {
+        static const std::array<std::uint32_t, 256> gearTable = []() {
+            std::array<std::uint32_t, 256> table = { 0 };
+            std::uint64_t seed = 0x9E3779B97F4A7C15ui64;
+            for (auto& value : table)
+            {
+                // splitmix64, any fixed pseudo random table works
+                seed += 0x9E3779B97F4A7C15ui64;
+                std::uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ui64;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBui64;
+                value = std::uint32_t((z ^ (z >> 31)) >> 32);
+            }
+            return table;
+        }();
+        return gearTable;
+    }
+
+    size_t FindBackupBlockSize(const std::uint8_t* data, size_t size)
+    {
+        if (size <= BACKUP_MIN_BLOCK_SIZE)
+        {
+            return size;
+        }
+
+        const auto& gearTable = GetBackupGearTable();
+        size_t maxSize = std::min(size, BACKUP_MAX_BLOCK_SIZE);
+        std::uint32_t hash = 0;
+        for (size_t i = 0; i < maxSize; ++i)
+        {
+            hash = (hash << 1) + gearTable[data[i]];
+            if (i >= BACKUP_MIN_BLOCK_SIZE && (hash & BACKUP_BOUNDARY_MASK) == 0)
+            {
+                return i + 1;
+            }
+        }
+
+        return maxSize;
+    }
+
+    std::uint64_t HashBackupBytes(const std::uint8_t* data, size_t size)
+    {
+        // FNV-1a
+        std::uint64_t hash = 0xCBF29CE484222325ui64;
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= data[i];
+            hash *= 0x100000001B3ui64;
+        }
+
+        return hash;
+    }
+
+    bool AppendBackupPackFile(const std::filesystem::path& path, const std::vector<std::uint8_t>& records)
+    {
+        std::FILE* packfile = nullptr;
+        errno_t err = _wfopen_s(&packfile, path.wstring().c_str(), L"ab");
+        if (err != 0 || packfile == nullptr)
+        {
+            return false;
+        }
+
+        bool bFailed = std::fwrite(records.data(), records.size(), 1, packfile) != 1;
+        if (!bFailed)
+        {
+            bFailed = (std::fflush(packfile) != 0) || (_commit(_fileno(packfile)) != 0);
+        }
+        std::fclose(packfile);
+        return !bFailed;
+    }
+
+    bool ReadBackupPackFile(std::FILE* packfile, size_t offset, size_t size, std::vector<std::uint8_t>& buffer)
+    {
+        buffer.resize(size);
+        if (packfile == nullptr || _fseeki64(packfile, std::int64_t(offset), SEEK_SET) != 0)
+        {
+            return false;
+        }
+
+        return (size == 0) || (std::fread(buffer.data(), size, 1, packfile) == 1);
+    }
+
+    void WriteBackupSnapshotRecord(BitSink& sink, std::int64_t timestamp, std::uint32_t fileSize, std::uint64_t hash, const std::vector<std::uint32_t>& blocks)
+    {
+        std::uint32_t numBlocks = std::uint32_t(blocks.size());
+        sink.write(&BACKUP_SNAPSHOT_RECORD, sizeof(BACKUP_SNAPSHOT_RECORD), 1);
+        sink.write(&timestamp, sizeof(timestamp), 1);
+        sink.write(&fileSize, sizeof(fileSize), 1);
+        sink.write(&hash, sizeof(hash), 1);
+        sink.write(&numBlocks, sizeof(numBlocks), 1);
+        sink.write(blocks.data(), sizeof(std::uint32_t), numBlocks);
+    }
+
+    void WriteBackupIndexBlockRecord(BitSink& sink, std::uint32_t size, std::uint64_t hash)
+    {
+        sink.write(&BACKUP_BLOCK_RECORD, sizeof(BACKUP_BLOCK_RECORD), 1);
+        sink.write(&size, sizeof(size), 1);
+        sink.write(&hash, sizeof(hash), 1);
+    }
+}
+
+//---------------------------------------------------------------------------
+d2ce::BackupStore::BackupStore(const std::filesystem::path& path) : m_filename(path), m_packfilename(getPackPath(path)), m_indexfilename(getIndexPath(path))
+{
+}
+//---------------------------------------------------------------------------
+d2ce::BackupStore::~BackupStore()
+{
+}
+//---------------------------------------------------------------------------
+const std::filesystem::path& d2ce::BackupStore::getPath() const
+{
+    return m_packfilename;
+}
+//---------------------------------------------------------------------------
+std::filesystem::path d2ce::BackupStore::getPackPath(const std::filesystem::path& path)
+{
+    std::filesystem::path packPath = path;
+    packPath += L".d2bak";
+    return packPath;
+}
+//---------------------------------------------------------------------------
+std::filesystem::path d2ce::BackupStore::getIndexPath(const std::filesystem::path& path)
+{
+    std::filesystem::path indexPath = getPackPath(path);
+    indexPath += L".idx";
+    return indexPath;
+}
+//---------------------------------------------------------------------------
+void d2ce::BackupStore::load()
+{
+    if (m_loaded)
+    {
+        return;
+    }
+
+    m_loaded = true;
+    m_packSize = 0;
+    m_packFileSize = 0;
+    m_indexValid = false;
+    m_blocks.clear();
+    m_blockIndex.clear();
+    m_snapshots.clear();
+
+    std::FILE* packfile = nullptr;
+    errno_t err = _wfopen_s(&packfile, m_packfilename.wstring().c_str(), L"rb");
+    if (err != 0 || packfile == nullptr)
+    {
+        // no backups yet
+        return;
+    }
+
+    if (_fseeki64(packfile, 0, SEEK_END) == 0)
+    {
+        auto fileSize = _ftelli64(packfile);
+        m_packFileSize = fileSize > 0 ? size_t(fileSize) : 0;
+    }
+
+    std::vector<std::uint8_t> header;
+    if (!ReadBackupPackFile(packfile, 0, BACKUP_HEADER_SIZE, header) ||
+        !std::equal(BACKUP_PACK_MARKER.begin(), BACKUP_PACK_MARKER.end(), header.begin()) ||
+        std::memcmp(header.data() + BACKUP_PACK_MARKER.size(), &BACKUP_PACK_VERSION, sizeof(BACKUP_PACK_VERSION)) != 0)
+    {
+        // not a pack we understand, it will be replaced by the next backup
+        std::fclose(packfile);
+        return;
+    }
+
+    m_packSize = BACKUP_HEADER_SIZE;
+    m_indexValid = loadIndex();
+    if (!m_snapshots.empty() || !m_blocks.empty())
+    {
+        // make sure the index belongs to this pack by checking the last record it describes
+        std::vector<std::uint8_t> record;
+        bool bMatch = false;
+        if (!m_snapshots.empty() && m_snapshots.back().NumPackBlocks == m_blocks.size())
+        {
+            const auto& snapshot = m_snapshots.back();
+            size_t recordSize = BACKUP_SNAPSHOT_RECORD_HEADER_SIZE + snapshot.Blocks.size() * sizeof(std::uint32_t);
+            if (ReadBackupPackFile(packfile, m_packSize - recordSize, BACKUP_SNAPSHOT_RECORD_HEADER_SIZE, record))
+            {
+                std::int64_t timestamp = 0;
+                std::memcpy(&timestamp, record.data() + sizeof(BACKUP_SNAPSHOT_RECORD), sizeof(timestamp));
+                bMatch = (record[0] == BACKUP_SNAPSHOT_RECORD) && (timestamp == snapshot.Timestamp);
+            }
+        }
+        else
+        {
+            const auto& block = m_blocks.back();
+            if (ReadBackupPackFile(packfile, block.Offset - BACKUP_BLOCK_RECORD_HEADER_SIZE, BACKUP_BLOCK_RECORD_HEADER_SIZE, record))
+            {
+                std::uint32_t blockSize = 0;
+                std::memcpy(&blockSize, record.data() + sizeof(BACKUP_BLOCK_RECORD), sizeof(blockSize));
+                bMatch = (record[0] == BACKUP_BLOCK_RECORD) && (blockSize == block.Size);
+            }
+        }
+
+        if (!bMatch)
+        {
+            m_packSize = BACKUP_HEADER_SIZE;
+            m_indexValid = false;
+            m_blocks.clear();
+            m_blockIndex.clear();
+            m_snapshots.clear();
+        }
+    }
+
+    if (m_packSize < m_packFileSize)
+    {
+        // records appended after the index was last written (or no index at all)
+        auto numRecords = m_blocks.size() + m_snapshots.size();
+        scanPack(packfile, m_packSize);
+        if (m_blocks.size() + m_snapshots.size() != numRecords)
+        {
+            m_indexValid = false;
+        }
+    }
+
+    std::fclose(packfile);
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::loadIndex()
+{
+    BitSource indexfile;
+    if (!indexfile.open(m_indexfilename))
+    {
+        return false;
+    }
+
+    std::array<std::uint8_t, 4> marker = { 0 };
+    std::uint32_t version = 0;
+    if ((indexfile.read(marker.data(), marker.size(), 1) != 1) || (marker != BACKUP_INDEX_MARKER) ||
+        (indexfile.read(&version, sizeof(version), 1) != 1) || (version != BACKUP_INDEX_VERSION))
+    {
+        return false;
+    }
+
+    std::uint8_t recordType = 0;
+    while (indexfile.read(&recordType, sizeof(recordType), 1) == 1)
+    {
+        if (recordType == BACKUP_BLOCK_RECORD)
+        {
+            BlockRef block;
+            if ((indexfile.read(&block.Size, sizeof(block.Size), 1) != 1) ||
+                (indexfile.read(&block.Hash, sizeof(block.Hash), 1) != 1))
+            {
+                return false;
+            }
+
+            block.Offset = m_packSize + BACKUP_BLOCK_RECORD_HEADER_SIZE;
+            if (block.Offset + block.Size > m_packFileSize)
+            {
+                // the index describes more than the pack holds
+                return false;
+            }
+
+            m_blockIndex.emplace(block.Hash, std::uint32_t(m_blocks.size()));
+            m_blocks.push_back(block);
+            m_packSize = block.Offset + block.Size;
+        }
+        else if (recordType == BACKUP_SNAPSHOT_RECORD)
+        {
+            Snapshot snapshot;
+            if (!readSnapshot(indexfile, snapshot))
+            {
+                return false;
+            }
+
+            size_t recordSize = BACKUP_SNAPSHOT_RECORD_HEADER_SIZE + snapshot.Blocks.size() * sizeof(std::uint32_t);
+            if (m_packSize + recordSize > m_packFileSize)
+            {
+                return false;
+            }
+
+            m_packSize += recordSize;
+            m_snapshots.push_back(std::move(snapshot));
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+//---------------------------------------------------------------------------
+void d2ce::BackupStore::scanPack(std::FILE* packfile, size_t offset)
+{
+    std::vector<std::uint8_t> tail;
+    if (!ReadBackupPackFile(packfile, offset, m_packFileSize - offset, tail))
+    {
+        return;
+    }
+
+    BitSource packTail(tail.data(), tail.size());
+    std::uint8_t recordType = 0;
+    while (packTail.read(&recordType, sizeof(recordType), 1) == 1)
+    {
+        if (recordType == BACKUP_BLOCK_RECORD)
+        {
+            BlockRef block;
+            if (packTail.read(&block.Size, sizeof(block.Size), 1) != 1)
+            {
+                break;
+            }
+
+            auto dataPos = packTail.tell();
+            if (!packTail.seek(dataPos + block.Size))
+            {
+                break;
+            }
+
+            block.Offset = offset + dataPos;
+            block.Hash = HashBackupBytes(tail.data() + dataPos, block.Size);
+            m_blockIndex.emplace(block.Hash, std::uint32_t(m_blocks.size()));
+            m_blocks.push_back(block);
+        }
+        else if (recordType == BACKUP_SNAPSHOT_RECORD)
+        {
+            Snapshot snapshot;
+            if (!readSnapshot(packTail, snapshot))
+            {
+                break;
+            }
+
+            m_snapshots.push_back(std::move(snapshot));
+        }
+        else
+        {
+            break;
+        }
+
+        m_packSize = offset + packTail.tell();
+    }
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::readSnapshot(BitSource& source, Snapshot& snapshot) const
+{
+    std::uint32_t numBlocks = 0;
+    if ((source.read(&snapshot.Timestamp, sizeof(snapshot.Timestamp), 1) != 1) ||
+        (source.read(&snapshot.FileSize, sizeof(snapshot.FileSize), 1) != 1) ||
+        (source.read(&snapshot.Hash, sizeof(snapshot.Hash), 1) != 1) ||
+        (source.read(&numBlocks, sizeof(numBlocks), 1) != 1) ||
+        (size_t(numBlocks) * sizeof(std::uint32_t) > source.size() - source.tell()))
+    {
+        return false;
+    }
+
+    snapshot.Blocks.resize(numBlocks);
+    if (numBlocks > 0 && source.read(snapshot.Blocks.data(), sizeof(std::uint32_t), numBlocks) != numBlocks)
+    {
+        return false;
+    }
+
+    for (auto blockId : snapshot.Blocks)
+    {
+        if (blockId >= m_blocks.size())
+        {
+            return false;
+        }
+    }
+
+    snapshot.NumPackBlocks = std::uint32_t(m_blocks.size());
+    return true;
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::writeIndex() const
+{
+    std::vector<std::uint8_t> index;
+    index.reserve(BACKUP_HEADER_SIZE + m_blocks.size() * 13);
+    BitSink sink(index);
+    sink.write(BACKUP_INDEX_MARKER.data(), BACKUP_INDEX_MARKER.size(), 1);
+    sink.write(&BACKUP_INDEX_VERSION, sizeof(BACKUP_INDEX_VERSION), 1);
+
+    // same record order as the pack
+    size_t blockId = 0;
+    for (const auto& snapshot : m_snapshots)
+    {
+        for (; blockId < snapshot.NumPackBlocks; ++blockId)
+        {
+            WriteBackupIndexBlockRecord(sink, m_blocks[blockId].Size, m_blocks[blockId].Hash);
+        }
+
+        WriteBackupSnapshotRecord(sink, snapshot.Timestamp, snapshot.FileSize, snapshot.Hash, snapshot.Blocks);
+    }
+
+    for (; blockId < m_blocks.size(); ++blockId)
+    {
+        WriteBackupIndexBlockRecord(sink, m_blocks[blockId].Size, m_blocks[blockId].Hash);
+    }
+
+    return sink.commit(m_indexfilename);
+}
+//---------------------------------------------------------------------------
+const std::uint8_t* d2ce::BackupStore::getBlockData(const BlockRef& block, std::FILE* packfile, const std::vector<std::uint8_t>& records, std::vector<std::uint8_t>& buffer) const
+{
+    if (block.Offset >= m_packSize)
+    {
+        // block added by the backup in progress
+        return records.data() + (block.Offset - m_packSize);
+    }
+
+    if (!ReadBackupPackFile(packfile, block.Offset, block.Size, buffer))
+    {
+        return nullptr;
+    }
+
+    return buffer.data();
+}
+//---------------------------------------------------------------------------
+std::uint32_t d2ce::BackupStore::addBlock(const std::uint8_t* data, std::uint32_t size, std::FILE* packfile, std::vector<std::uint8_t>& records, std::vector<std::uint8_t>& indexRecords)
+{
+    auto hash = HashBackupBytes(data, size);
+    auto range = m_blockIndex.equal_range(hash);
+    std::vector<std::uint8_t> buffer;
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        const auto& block = m_blocks[iter->second];
+        if (block.Size != size)
+        {
+            continue;
+        }
+
+        // only the candidate block is read back from the pack
+        auto blockData = getBlockData(block, packfile, records, buffer);
+        if (blockData != nullptr && std::memcmp(blockData, data, size) == 0)
+        {
+            return iter->second;
+        }
+    }
+
+    BitSink sink(records);
+    sink.write(&BACKUP_BLOCK_RECORD, sizeof(BACKUP_BLOCK_RECORD), 1);
+    sink.write(&size, sizeof(size), 1);
+
+    BlockRef block;
+    block.Offset = m_packSize + records.size();
+    block.Size = size;
+    block.Hash = hash;
+    sink.write(data, size, 1);
+
+    BitSink indexSink(indexRecords);
+    WriteBackupIndexBlockRecord(indexSink, size, hash);
+
+    std::uint32_t blockId = std::uint32_t(m_blocks.size());
+    m_blocks.push_back(block);
+    m_blockIndex.emplace(hash, blockId);
+    return blockId;
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::hasBackups()
+{
+    load();
+    return !m_snapshots.empty();
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::getBackups(std::vector<BackupInfo>& backups)
+{
+    load();
+    backups.clear();
+    backups.reserve(m_snapshots.size());
+    for (const auto& snapshot : m_snapshots)
+    {
+        BackupInfo info;
+        info.Index = backups.size();
+        info.Timestamp = snapshot.Timestamp;
+        info.FileSize = snapshot.FileSize;
+        backups.push_back(info);
+    }
+
+    return !backups.empty();
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::backup(std::int64_t timestamp)
+{
+    BitSource file;
+    if (!file.open(m_filename))
+    {
+        return false;
+    }
+
+    return backup(file.data(), file.size(), timestamp);
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::backup(const std::uint8_t* data, size_t size, std::int64_t timestamp)
+{
+    if (data == nullptr && size != 0)
+    {
+        return false;
+    }
+
+    load();
+
+    bool bNewPack = (m_packSize == 0);
+    std::vector<std::uint8_t> records;
+    std::vector<std::uint8_t> indexRecords;
+    BitSink sink(records);
+    BitSink indexSink(indexRecords);
+    if (bNewPack)
+    {
+        sink.write(BACKUP_PACK_MARKER.data(), BACKUP_PACK_MARKER.size(), 1);
+        sink.write(&BACKUP_PACK_VERSION, sizeof(BACKUP_PACK_VERSION), 1);
+    }
+
+    // blocks whose hash matches are compared against the pack on disk
+    std::FILE* packfile = nullptr;
+    if (!bNewPack)
+    {
+        errno_t err = _wfopen_s(&packfile, m_packfilename.wstring().c_str(), L"rb");
+        if (err != 0)
+        {
+            packfile = nullptr;
+        }
+    }
+
+    Snapshot snapshot;
+    snapshot.Timestamp = timestamp;
+    snapshot.FileSize = std::uint32_t(size);
+    snapshot.Hash = HashBackupBytes(data, size);
+    for (size_t pos = 0; pos < size;)
+    {
+        auto blockSize = FindBackupBlockSize(data + pos, size - pos);
+        snapshot.Blocks.push_back(addBlock(data + pos, std::uint32_t(blockSize), packfile, records, indexRecords));
+        pos += blockSize;
+    }
+    snapshot.NumPackBlocks = std::uint32_t(m_blocks.size());
+
+    if (packfile != nullptr)
+    {
+        std::fclose(packfile);
+    }
+
+    if (!m_snapshots.empty())
+    {
+        const auto& last = m_snapshots.back();
+        if (last.FileSize == snapshot.FileSize && last.Hash == snapshot.Hash && last.Blocks == snapshot.Blocks)
+        {
+            // nothing changed since the last backup
+            return true;
+        }
+    }
+
+    WriteBackupSnapshotRecord(sink, snapshot.Timestamp, snapshot.FileSize, snapshot.Hash, snapshot.Blocks);
+    WriteBackupSnapshotRecord(indexSink, snapshot.Timestamp, snapshot.FileSize, snapshot.Hash, snapshot.Blocks);
+
+    bool bWritten = false;
+    if (bNewPack)
+    {
+        // the old index describes a pack that no longer exists
+        std::error_code ec;
+        std::filesystem::remove(m_indexfilename, ec);
+        m_indexValid = false;
+        bWritten = sink.commit(m_packfilename);
+    }
+    else
+    {
+        bWritten = true;
+        if (m_packFileSize != m_packSize)
+        {
+            // drop the torn record at the end of the pack
+            std::error_code ec;
+            std::filesystem::resize_file(m_packfilename, m_packSize, ec);
+            bWritten = !ec;
+        }
+
+        // common case, only the new blocks and the snapshot record hit the disk
+        bWritten = bWritten && AppendBackupPackFile(m_packfilename, records);
+    }
+
+    if (!bWritten)
+    {
+        // the in memory state no longer matches the file, reload it on next use
+        m_loaded = false;
+        return false;
+    }
+
+    m_packSize += records.size();
+    m_packFileSize = m_packSize;
+    m_snapshots.push_back(std::move(snapshot));
+
+    // the pack is the source of truth, a failed index update is caught up by the next load
+    if (m_indexValid)
+    {
+        m_indexValid = AppendBackupPackFile(m_indexfilename, indexRecords);
+    }
+    else
+    {
+        m_indexValid = writeIndex();
+    }
+
+    return true;
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::restore(size_t index, std::vector<std::uint8_t>& buffer)
+{
+    load();
+    buffer.clear();
+    if (index >= m_snapshots.size())
+    {
+        return false;
+    }
+
+    std::FILE* packfile = nullptr;
+    errno_t err = _wfopen_s(&packfile, m_packfilename.wstring().c_str(), L"rb");
+    if (err != 0 || packfile == nullptr)
+    {
+        return false;
+    }
+
+    const auto& snapshot = m_snapshots[index];
+    buffer.reserve(snapshot.FileSize);
+    std::vector<std::uint8_t> blockData;
+    bool bRead = true;
+    for (auto blockId : snapshot.Blocks)
+    {
+        const auto& block = m_blocks[blockId];
+        if (!ReadBackupPackFile(packfile, block.Offset, block.Size, blockData))
+        {
+            bRead = false;
+            break;
+        }
+
+        buffer.insert(buffer.end(), blockData.begin(), blockData.end());
+    }
+    std::fclose(packfile);
+
+    if (!bRead || buffer.size() != snapshot.FileSize || HashBackupBytes(buffer.data(), buffer.size()) != snapshot.Hash)
+    {
+        // corrupt pack
+        buffer.clear();
+        return false;
+    }
+
+    return true;
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::getRestoreIndex(size_t& index)
+{
+    load();
+    index = 0;
+    if (m_snapshots.empty())
+    {
+        return false;
+    }
+
+    BitSource file;
+    if (!file.open(m_filename))
+    {
+        // nothing to compare against, use the most recent backup
+        index = m_snapshots.size() - 1;
+        return true;
+    }
+
+    auto fileSize = file.size();
+    auto hash = HashBackupBytes(file.data(), fileSize);
+    for (size_t i = m_snapshots.size(); i > 0; --i)
+    {
+        const auto& snapshot = m_snapshots[i - 1];
+        if (snapshot.FileSize == fileSize && snapshot.Hash == hash)
+        {
+            if (i == 1)
+            {
+                // the file already matches the oldest backup
+                return false;
+            }
+
+            index = i - 2;
+            return true;
+        }
+    }
+
+    index = m_snapshots.size() - 1;
+    return true;
+}
+//---------------------------------------------------------------------------
+bool d2ce::BackupStore::restoreFile(size_t index)
+{
+    std::vector<std::uint8_t> buffer;
+    if (!restore(index, buffer))
+    {
+        return false;
+    }
+
+    BitSink sink(buffer);
+    return sink.commit(m_filename);
+}
+//---------------------------------------------------------------------------
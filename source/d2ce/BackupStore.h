@@ -0,0 +1,114 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include <unordered_map>
+#include <filesystem>
+
+namespace d2ce
+{
+    class BitSource;
+
+    //---------------------------------------------------------------------------
+    struct BackupInfo
+    {
+        size_t Index = 0;           // position in the backup store, oldest first
+        std::int64_t Timestamp = 0; // UTC time (seconds) the backup was taken
+        std::uint32_t FileSize = 0; // size of the backed up file
+    };
+
+    //---------------------------------------------------------------------------
+    // Append-only backup pack kept next to a .d2s, .d2i or .json file ("<file>.d2bak").
+    // Each backup is split into content-defined blocks and only blocks not already
+    // in the pack are appended, so a backup of a lightly edited file costs a few
+    // hundred bytes instead of a full copy of the file.
+    // A sidecar index ("<file>.d2bak.idx") repeats the block sizes and hashes and the
+    // snapshot records without the block data, so opening the store only reads the
+    // index plus any records at the end of the pack the index does not cover yet.
+    class BackupStore
+    {
+    private:
+        struct BlockRef
+        {
+            size_t Offset = 0; // offset of the block data within the pack file
+            std::uint32_t Size = 0;
+            std::uint64_t Hash = 0;
+        };
+
+        struct Snapshot
+        {
+            std::int64_t Timestamp = 0;
+            std::uint32_t FileSize = 0;
+            std::uint64_t Hash = 0;
+            std::vector<std::uint32_t> Blocks;
+            std::uint32_t NumPackBlocks = 0; // blocks in the pack before the snapshot record
+        };
+
+        std::filesystem::path m_filename;
+        std::filesystem::path m_packfilename;
+        std::filesystem::path m_indexfilename;
+        size_t m_packSize = 0;              // size of the pack file up to the last complete record, 0 if there is no usable pack
+        size_t m_packFileSize = 0;          // size of the pack file on disk
+        bool m_indexValid = false;          // the index file describes exactly the first m_packSize bytes of the pack
+        std::vector<BlockRef> m_blocks;
+        std::unordered_multimap<std::uint64_t, std::uint32_t> m_blockIndex;
+        std::vector<Snapshot> m_snapshots;
+        bool m_loaded = false;
+
+    private:
+        void load();
+        bool loadIndex();
+        void scanPack(std::FILE* packfile, size_t offset);
+        bool readSnapshot(BitSource& source, Snapshot& snapshot) const;
+        bool writeIndex() const;
+        std::uint32_t addBlock(const std::uint8_t* data, std::uint32_t size, std::FILE* packfile, std::vector<std::uint8_t>& records, std::vector<std::uint8_t>& indexRecords);
+        const std::uint8_t* getBlockData(const BlockRef& block, std::FILE* packfile, const std::vector<std::uint8_t>& records, std::vector<std::uint8_t>& buffer) const;
+
+    public:
+        BackupStore(const std::filesystem::path& path);
+        ~BackupStore();
+
+        const std::filesystem::path& getPath() const;
+        static std::filesystem::path getPackPath(const std::filesystem::path& path);
+        static std::filesystem::path getIndexPath(const std::filesystem::path& path);
+
+        bool hasBackups();
+        bool getBackups(std::vector<BackupInfo>& backups);
+
+        // backs up the current contents of the file
+        bool backup(std::int64_t timestamp);
+        bool backup(const std::uint8_t* data, size_t size, std::int64_t timestamp);
+
+        bool restore(size_t index, std::vector<std::uint8_t>& buffer);
+
+        // finds the backup to restore given the current contents of the file: the one
+        // taken before the backup matching the file, or the most recent backup if the
+        // file matches none of them. Returns false if there is nothing earlier to restore.
+        bool getRestoreIndex(size_t& index);
+
+        // replaces the file with the contents of the backup in a single step
+        bool restoreFile(size_t index);
+    };
+    //---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
@@ -0,0 +1,106 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#include "pch.h"
+#include "BitSink.h"
+#include <cstdio>
+#include <io.h>
+
+//---------------------------------------------------------------------------
+d2ce::BitSink::BitSink(std::vector<std::uint8_t>& buffer) : m_buffer(buffer)
+{
+}
+//---------------------------------------------------------------------------
+d2ce::BitSink::~BitSink()
+{
+}
+//---------------------------------------------------------------------------
+std::vector<std::uint8_t>& d2ce::BitSink::buffer() const
+{
+    return m_buffer;
+}
+//---------------------------------------------------------------------------
+size_t d2ce::BitSink::tell() const
+{
+    return m_buffer.size();
+}
+//---------------------------------------------------------------------------
+size_t d2ce::BitSink::write(const void* buffer, size_t size, size_t count)
+{
+    if (buffer == nullptr || size == 0 || count == 0)
+    {
+        return 0;
+    }
+
+    const auto* bytes = static_cast<const std::uint8_t*>(buffer);
+    m_buffer.insert(m_buffer.end(), bytes, bytes + size * count);
+    return count;
+}
+//---------------------------------------------------------------------------
+bool d2ce::BitSink::commit(const std::filesystem::path& path) const
+{
+    EnumCommitError error = EnumCommitError::None;
+    return commit(path, error);
+}
+//---------------------------------------------------------------------------
+bool d2ce::BitSink::commit(const std::filesystem::path& path, EnumCommitError& error) const
+{
+    error = EnumCommitError::None;
+
+    // same directory as the target, so the rename never turns into a copy across volumes
+    std::filesystem::path tempPath = path;
+    tempPath += L".tmp";
+
+    std::FILE* tempfile = nullptr;
+    errno_t err = _wfopen_s(&tempfile, tempPath.wstring().c_str(), L"wb");
+    if (err != 0 || tempfile == nullptr)
+    {
+        error = EnumCommitError::CannotOpenFile;
+        return false;
+    }
+
+    bool bFailed = !m_buffer.empty() && (std::fwrite(m_buffer.data(), m_buffer.size(), 1, tempfile) != 1);
+    if (!bFailed)
+    {
+        // make sure the data is on disk before the rename makes it visible
+        bFailed = (std::fflush(tempfile) != 0) || (_commit(_fileno(tempfile)) != 0);
+    }
+    std::fclose(tempfile);
+
+    std::error_code ec;
+    if (bFailed)
+    {
+        error = EnumCommitError::WriteError;
+    }
+    else
+    {
+        // replaces the existing file in a single step
+        std::filesystem::rename(tempPath, path, ec);
+        if (!ec)
+        {
+            return true;
+        }
+
+        error = EnumCommitError::RenameError;
+    }
+
+    std::filesystem::remove(tempPath, ec);
+    return false;
+}
+//---------------------------------------------------------------------------
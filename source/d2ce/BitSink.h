@@ -0,0 +1,66 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <filesystem>
+
+namespace d2ce
+{
+    //---------------------------------------------------------------------------
+    // Write cursor the writers append a .d2s, .d2i or item file image to.
+    // It is the counterpart of BitSource: the whole file is built in memory
+    // so saving it is a single write instead of one std::fwrite per field.
+    class BitSink
+    {
+    public:
+        enum class EnumCommitError
+        {
+            None = 0,
+            CannotOpenFile, // the temp file could not be created
+            WriteError,     // the temp file could not be written or flushed
+            RenameError     // the temp file could not replace "path"
+        };
+
+    private:
+        std::vector<std::uint8_t>& m_buffer;
+
+    public:
+        BitSink(std::vector<std::uint8_t>& buffer);
+        BitSink(const BitSink&) = delete;
+        ~BitSink();
+
+        BitSink& operator=(const BitSink&) = delete;
+
+        std::vector<std::uint8_t>& buffer() const;
+        size_t tell() const;
+
+        // same contract as std::fwrite: returns the number of complete elements written
+        size_t write(const void* buffer, size_t size, size_t count = 1);
+
+        // Writes the buffer to a temp file next to "path", flushes it to disk and
+        // renames it over "path", so the original is either untouched or fully replaced.
+        bool commit(const std::filesystem::path& path) const;
+        bool commit(const std::filesystem::path& path, EnumCommitError& error) const;
+    };
+    //---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
@@ -0,0 +1,169 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#include "pch.h"
+#include "BitSource.h"
+#include <cstdio>
+#include <cstring>
+
+//---------------------------------------------------------------------------
+d2ce::BitSource::BitSource()
+{
+}
+//---------------------------------------------------------------------------
+d2ce::BitSource::BitSource(const std::uint8_t* data, size_t size) : m_data(data), m_size(data == nullptr ? 0 : size)
+{
+}
+//---------------------------------------------------------------------------
+d2ce::BitSource::BitSource(std::vector<std::uint8_t>&& buffer) : m_buffer(std::move(buffer))
+{
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+}
+//---------------------------------------------------------------------------
+d2ce::BitSource::~BitSource()
+{
+}
+//---------------------------------------------------------------------------
+bool d2ce::BitSource::open(const std::filesystem::path& path)
+{
+    close();
+
+    std::FILE* charfile = nullptr;
+    errno_t err = _wfopen_s(&charfile, path.wstring().c_str(), L"rb");
+    if (err != 0 || charfile == nullptr)
+    {
+        return false;
+    }
+
+    std::fseek(charfile, 0, SEEK_END);
+    auto fileSize = std::ftell(charfile);
+    std::rewind(charfile);
+    if (fileSize < 0)
+    {
+        std::fclose(charfile);
+        return false;
+    }
+
+    m_buffer.resize(size_t(fileSize));
+    if (!m_buffer.empty() && std::fread(m_buffer.data(), m_buffer.size(), 1, charfile) != 1)
+    {
+        std::fclose(charfile);
+        close();
+        return false;
+    }
+
+    std::fclose(charfile);
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return true;
+}
+//---------------------------------------------------------------------------
+bool d2ce::BitSource::is_open() const
+{
+    return m_data != nullptr;
+}
+//---------------------------------------------------------------------------
+void d2ce::BitSource::close()
+{
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+    m_pos = 0;
+    m_eof = false;
+}
+//---------------------------------------------------------------------------
+const std::uint8_t* d2ce::BitSource::data() const
+{
+    return m_data;
+}
+//---------------------------------------------------------------------------
+size_t d2ce::BitSource::size() const
+{
+    return m_size;
+}
+//---------------------------------------------------------------------------
+size_t d2ce::BitSource::tell() const
+{
+    return m_pos;
+}
+//---------------------------------------------------------------------------
+bool d2ce::BitSource::seek(size_t pos)
+{
+    if (pos > m_size)
+    {
+        return false;
+    }
+
+    m_pos = pos;
+    m_eof = false;
+    return true;
+}
+//---------------------------------------------------------------------------
+void d2ce::BitSource::rewind()
+{
+    m_pos = 0;
+    m_eof = false;
+}
+//---------------------------------------------------------------------------
+bool d2ce::BitSource::eof() const
+{
+    return m_eof;
+}
+//---------------------------------------------------------------------------
+std::uint8_t d2ce::BitSource::peek(size_t offset) const
+{
+    if (m_data == nullptr || offset >= (m_size - m_pos))
+    {
+        return 0;
+    }
+
+    return m_data[m_pos + offset];
+}
+//---------------------------------------------------------------------------
+size_t d2ce::BitSource::read(void* buffer, size_t size, size_t count)
+{
+    if (buffer == nullptr || size == 0 || count == 0)
+    {
+        return 0;
+    }
+
+    if (m_data == nullptr)
+    {
+        m_eof = true;
+        return 0;
+    }
+
+    size_t bytesRequested = size * count;
+    size_t bytesAvailable = m_size - m_pos;
+    if (bytesRequested > bytesAvailable)
+    {
+        // partial read, copy what we have just like std::fread
+        std::memcpy(buffer, m_data + m_pos, bytesAvailable);
+        m_pos = m_size;
+        m_eof = true;
+        return bytesAvailable / size;
+    }
+
+    std::memcpy(buffer, m_data + m_pos, bytesRequested);
+    m_pos += bytesRequested;
+    return count;
+}
+//---------------------------------------------------------------------------
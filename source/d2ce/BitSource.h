@@ -0,0 +1,96 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <filesystem>
+
+namespace d2ce
+{
+    //---------------------------------------------------------------------------
+    // Read cursor over the complete contents of a .d2s, .d2i or item file.
+    // The whole file is loaded with a single read, so the parsers slice their
+    // bytes out of one contiguous buffer instead of calling std::fread per byte.
+    // The read/seek/tell/eof methods follow the std::FILE semantics the parsers
+    // were written against (eof is only set after a read runs past the end).
+    class BitSource
+    {
+    private:
+        std::vector<std::uint8_t> m_buffer; // owned storage, empty for a view over external memory
+        const std::uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+        size_t m_pos = 0;
+        bool m_eof = false;
+
+    public:
+        BitSource();
+        BitSource(const std::uint8_t* data, size_t size); // view over memory owned by the caller
+        BitSource(std::vector<std::uint8_t>&& buffer);
+        BitSource(const BitSource&) = delete;
+        ~BitSource();
+
+        BitSource& operator=(const BitSource&) = delete;
+
+        bool open(const std::filesystem::path& path);
+        bool is_open() const;
+        void close();
+
+        const std::uint8_t* data() const;
+        size_t size() const;
+
+        size_t tell() const;
+        bool seek(size_t pos);
+        void rewind();
+        bool eof() const;
+
+        // returns the byte "offset" bytes past the read position without consuming it, 0 past the end
+        std::uint8_t peek(size_t offset = 0) const;
+
+        // same contract as std::fread: returns the number of complete elements read
+        size_t read(void* buffer, size_t size, size_t count = 1);
+
+        // appends the next "bytes" bytes to dest (a vector of bytes), returns false if the source ran out
+        template <class ByteVector>
+        bool append(ByteVector& dest, size_t bytes)
+        {
+            if (m_data == nullptr)
+            {
+                m_eof = true;
+                return bytes == 0;
+            }
+
+            size_t bytesAvailable = m_size - m_pos;
+            if (bytes > bytesAvailable)
+            {
+                dest.insert(dest.end(), m_data + m_pos, m_data + m_size);
+                m_pos = m_size;
+                m_eof = true;
+                return false;
+            }
+
+            dest.insert(dest.end(), m_data + m_pos, m_data + m_pos + bytes);
+            m_pos += bytes;
+            return true;
+        }
+    };
+    //---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
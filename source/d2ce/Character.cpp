@@ -572,6 +572,9 @@ std::string d2ce::CharacterErrCategory::message(int ev) const
     case CharacterErrc::AuxFileRenameError:
         return "One or more auxiliary Character Files (.key, .ma*) could not be renamed.";
 
+    case CharacterErrc::FileWriteError:
+        return "Unable to write Diablo II character file.";
+
     default:
         return "(unrecognized error)";
     }
@@ -659,15 +662,8 @@ bool d2ce::Character::openD2S(const std::filesystem::path& path, bool validateCh
     m_ftime = std::filesystem::last_write_time(path);
 
     m_error_code.clear();
-    std::FILE* charfile = nullptr;
-    errno_t err = _wfopen_s(&charfile, path.wstring().c_str(), L"rb+");
-    if (err != 0)
-    {
-        m_error_code = std::make_error_code(CharacterErrc::CannotOpenFile);
-        return false;
-    }
-
-    if (charfile == nullptr)
+    BitSource charfile;
+    if (!charfile.open(path))
     {
         m_error_code = std::make_error_code(CharacterErrc::CannotOpenFile);
         return false;
@@ -679,19 +675,17 @@ bool d2ce::Character::openD2S(const std::filesystem::path& path, bool validateCh
     if (!isValidHeader())
     {
         m_error_code = std::make_error_code(CharacterErrc::InvalidHeader);
-        std::fclose(charfile);
         close();
         return false;
     }
 
     if (!refresh(charfile))
     {
-        std::fclose(charfile);
         close();
         return false;
     }
 
-    std::fclose(charfile);
+    charfile.close();
 
     // Validate checksum
     long curChecksum = getChecksumBytes();
@@ -797,6 +791,8 @@ bool d2ce::Character::openJson(const std::filesystem::path& path)
 */
 bool d2ce::Character::open(const std::filesystem::path& path, bool validateChecksum)
 {
+    // the file installs its own game data, keep the tables locked until it has been read
+    GameDataScope gameData;
     if (is_open())
     {
         if (&path == &getPath())
@@ -899,14 +895,14 @@ void d2ce::Character::calculateChecksum()
     setChecksumBytes(checksum);
 }
 //---------------------------------------------------------------------------
-void d2ce::Character::readHeader(std::FILE* charFile)
+void d2ce::Character::readHeader(BitSource& charFile)
 {
     // reserve enough space to reduce chance of reallocation
     data.clear();
     data.reserve(CHAR_V109_BASICINFO_NUM_BYTES);
 
-    std::rewind(charFile);
-    size_t current_byte_offset = std::ftell(charFile);
+    charFile.rewind();
+    size_t current_byte_offset = charFile.tell();
     skipBytes(charFile, current_byte_offset, HEADER_LENGTH);
 }
 //---------------------------------------------------------------------------
@@ -931,21 +927,20 @@ void d2ce::Character::readHeader(const Json::Value& root)
     size_t current_byte_offset = 0;
     setBytes(current_byte_offset, HEADER_LENGTH, uint);
 
-    if (getVersion() < EnumCharVersion::v100R)
-    {
-        setTxtReader(getDefaultTxtReader());
-        return;
-    }
-
-    value = header[m_bJsonSerializedFormat ? "ModName" : "mod_name"];
+    setTxtReader(getJsonTxtReader(header, m_bJsonSerializedFormat));
+}
+//---------------------------------------------------------------------------
+const d2ce::ITxtReader& d2ce::Character::getJsonTxtReader(const Json::Value& header, bool bSerializedFormat)
+{
+    // the version is not known until the basic info is read, only D2R files have a mod name
+    Json::Value value = header[bSerializedFormat ? "ModName" : "mod_name"];
     if (value.isNull())
     {
-        setTxtReader(getDefaultTxtReader());
-        return;
+        return getDefaultTxtReader();
     }
 
     std::string modName(value.asString());
-    setTxtReader(getDefaultTxtReader(modName));
+    return getDefaultTxtReader(modName);
 }
 //---------------------------------------------------------------------------
 std::uint32_t d2ce::Character::getHeaderBytes() const
@@ -1133,7 +1128,7 @@ bool d2ce::Character::isValidHeader() const
     return header == HEADER ? true : false;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Character::refresh(std::FILE* charFile)
+bool d2ce::Character::refresh(BitSource& charFile)
 {
     readBasicInfo(charFile);
     if (!readActs(charFile))
@@ -1215,6 +1210,7 @@ bool d2ce::Character::refresh(const Json::Value& root)
 //---------------------------------------------------------------------------
 bool d2ce::Character::refresh()
 {
+    GameDataScope gameData;
     if (!m_jsonfilename.empty())
     {
         const std::filesystem::path path = m_jsonfilename;
@@ -1230,9 +1226,9 @@ bool d2ce::Character::refresh()
     return false;
 }
 //---------------------------------------------------------------------------
-void d2ce::Character::readBasicInfo(std::FILE* charFile)
+void d2ce::Character::readBasicInfo(BitSource& charFile)
 {
-    std::fseek(charFile, (long)CHAR_V100_VERSION_BYTE_OFFSET, SEEK_SET);
+    charFile.seek(CHAR_V100_VERSION_BYTE_OFFSET);
     size_t current_byte_offset = CHAR_V100_VERSION_BYTE_OFFSET;
     size_t numBytes = CHAR_V100_VERSION_NUM_BYTES;
     skipBytes(charFile, current_byte_offset, numBytes);
@@ -1755,7 +1751,7 @@ bool d2ce::Character::readBasicInfo(const Json::Value& root)
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Character::readActs(std::FILE* charFile)
+bool d2ce::Character::readActs(BitSource& charFile)
 {
     return Acts.readActs(charFile);
 }
@@ -1765,7 +1761,7 @@ bool d2ce::Character::readActs(const Json::Value& root)
     return Acts.readActs(root, m_bJsonSerializedFormat);
 }
 //---------------------------------------------------------------------------
-bool d2ce::Character::readStats(std::FILE* charFile)
+bool d2ce::Character::readStats(BitSource& charFile)
 {
     if (Cs.readStats(charFile))
     {
@@ -1789,7 +1785,7 @@ bool d2ce::Character::readStats(const Json::Value& root)
     return false;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Character::readItems(std::FILE* charFile)
+bool d2ce::Character::readItems(BitSource& charFile)
 {
     return m_items.readItems(*this, charFile);
 }
@@ -1801,43 +1797,22 @@ bool d2ce::Character::readItems(const Json::Value& root)
 //---------------------------------------------------------------------------
 bool d2ce::Character::save(bool backup)
 {
+    auto gameData = activateGameDataContext();
     if (backup)
     {
-        // backup existing file
+        // backup existing file, only the parts that changed since the last backup are stored
         auto now = std::chrono::system_clock::now();
         auto UTC = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
-        std::filesystem::path orig;
-        std::filesystem::path p;
-        if (is_json())
-        {
-            orig = m_jsonfilename;
-            p = orig;
-            auto ext = p.extension();
-            ext += "." + std::to_string(UTC) + ".bak";
-            p.replace_extension(ext);
-        }
-        else
-        {
-            orig = m_d2sfilename;
-            p = orig;
-            auto ext = "." + std::to_string(UTC) + ".bak";
-            p.replace_extension(ext);
-        }
-
-        try
-        {
-            std::filesystem::copy_file(orig, p, std::filesystem::copy_options::overwrite_existing);
-        }
-        catch (std::filesystem::filesystem_error const&)
-        {
-        }
+        BackupStore backupStore(is_json() ? m_jsonfilename : m_d2sfilename);
+        backupStore.backup(UTC);
     }
 
-    calculateChecksum();
     m_error_code.clear();
 
     if (!m_jsonfilename.empty())
     {
+        calculateChecksum();
+
         // export the json again
         auto json = asJson(m_bJsonSerializedFormat, d2ce::Character::EnumCharSaveOp::NoSave);
         if (!json.empty())
@@ -1853,49 +1828,37 @@ bool d2ce::Character::save(bool backup)
         return true;
     }
 
-    std::filesystem::path tempfilename;
-    wchar_t name1[L_tmpnam_s];
-    std::wstring utempfilename;
-    errno_t err = _wtmpnam_s(name1, L_tmpnam_s);
-    if (err == 0)
+    std::vector<std::uint8_t> buffer;
+    if (!serialize(buffer))
     {
-        utempfilename = name1;
-        tempfilename = utempfilename;
+        // serialize reports the part of the character that could not be written
+        if (!m_error_code)
+        {
+            m_error_code = std::make_error_code(CharacterErrc::FileWriteError);
+        }
+        return false;
     }
 
-    std::FILE* tempfile = NULL;
-    _wfopen_s(&tempfile, utempfilename.c_str(), L"wb");
-
-    std::rewind(tempfile);
-
-    writeBasicInfo(tempfile);
-    writeActs(tempfile);
-
-    // From this point on, the location is variable
-    writeStats(tempfile);
-
-    // Write Character, Corpse, Mercenary and Golem items
-    writeItems(tempfile);
-
-    std::fclose(tempfile);
-
-    // prepare to update the character file
-    try
+    // the character file is replaced in a single step, it is never missing or partially written
+    BitSink sink(buffer);
+    BitSink::EnumCommitError commitError = BitSink::EnumCommitError::None;
+    if (!sink.commit(m_d2sfilename, commitError))
     {
-        std::filesystem::remove(m_d2sfilename);
-    }
-    catch (std::filesystem::filesystem_error const&)
-    {
-    }
+        switch (commitError)
+        {
+        case BitSink::EnumCommitError::CannotOpenFile:
+            m_error_code = std::make_error_code(CharacterErrc::CannotOpenFile);
+            break;
 
-    try
-    {
-        // rename temp file to character file
-        std::filesystem::rename(tempfilename, m_d2sfilename);
-    }
-    catch (std::filesystem::filesystem_error const&)
-    {
-        m_error_code = std::make_error_code(CharacterErrc::FileRenameError);
+        case BitSink::EnumCommitError::RenameError:
+            // the temp file could not replace the character file
+            m_error_code = std::make_error_code(CharacterErrc::FileRenameError);
+            break;
+
+        default:
+            m_error_code = std::make_error_code(CharacterErrc::FileWriteError);
+            break;
+        }
         return false;
     }
 
@@ -1903,7 +1866,7 @@ bool d2ce::Character::save(bool backup)
 
     // check to see if the m_d2sfilename needs to be changed
     // to match the character's name
-    tempfilename = m_d2sfilename;
+    std::filesystem::path tempfilename = m_d2sfilename;
     std::filesystem::path p = m_d2sfilename;
     p.replace_extension();
     std::filesystem::path origFileNameBase = p;
@@ -2052,11 +2015,67 @@ bool d2ce::Character::save(bool backup)
                 return false;
             }
         }
+
+        // the backups follow the character file
+        tempfilename = origFileNameBase;
+        tempfilename.replace_extension(".d2s");
+        std::filesystem::path origIndexPath = BackupStore::getIndexPath(tempfilename);
+        tempfilename = BackupStore::getPackPath(tempfilename);
+        if (std::filesystem::exists(tempfilename))
+        {
+            try
+            {
+                std::filesystem::rename(tempfilename, BackupStore::getPackPath(m_d2sfilename));
+            }
+            catch (std::filesystem::filesystem_error const&)
+            {
+                m_error_code = std::make_error_code(CharacterErrc::AuxFileRenameError);
+                return false;
+            }
+
+            // the index can always be rebuilt from the pack, so only make sure no stale one is left behind
+            std::error_code ec;
+            std::filesystem::rename(origIndexPath, BackupStore::getIndexPath(m_d2sfilename), ec);
+            if (ec)
+            {
+                std::filesystem::remove(origIndexPath, ec);
+                std::filesystem::remove(BackupStore::getIndexPath(m_d2sfilename), ec);
+            }
+        }
     }
 
     return true;
 }
 //---------------------------------------------------------------------------
+bool d2ce::Character::getBackups(std::vector<BackupInfo>& backups) const
+{
+    backups.clear();
+    if (!is_open())
+    {
+        return false;
+    }
+
+    BackupStore backupStore(getPath());
+    return backupStore.getBackups(backups);
+}
+//---------------------------------------------------------------------------
+bool d2ce::Character::restoreBackup(size_t index)
+{
+    if (!is_open())
+    {
+        return false;
+    }
+
+    BackupStore backupStore(getPath());
+    if (!backupStore.restoreFile(index))
+    {
+        m_error_code = std::make_error_code(CharacterErrc::CannotOpenFile);
+        return false;
+    }
+
+    return refresh();
+}
+//---------------------------------------------------------------------------
 bool d2ce::Character::saveAsVersion(EnumCharVersion version, EnumCharSaveOp backup)
 {
     if (!is_open())
@@ -2070,6 +2089,7 @@ bool d2ce::Character::saveAsVersion(EnumCharVersion version, EnumCharSaveOp back
 //---------------------------------------------------------------------------
 bool d2ce::Character::saveAsVersion(const std::filesystem::path& path, EnumCharVersion version, EnumCharSaveOp saveOp)
 {
+    auto gameData = activateGameDataContext();
     bool bIsJson = is_json();
     bool bBackup = false;
     bool bSave = true;
@@ -2286,6 +2306,7 @@ bool d2ce::Character::saveAsD2s(EnumCharSaveOp saveOp)
 
 bool d2ce::Character::saveAsD2s(const std::filesystem::path& path, EnumCharSaveOp saveOp)
 {
+    auto gameData = activateGameDataContext();
     bool bBackup = false;
     bool bSave = true;
     switch (saveOp)
@@ -2345,24 +2366,61 @@ bool d2ce::Character::saveAsD2s(const std::filesystem::path& path, EnumCharSaveO
     return true;
 }
 //---------------------------------------------------------------------------
-void d2ce::Character::writeBasicInfo(std::FILE* charFile) const
+bool d2ce::Character::serialize(std::vector<std::uint8_t>& buffer)
 {
-    std::rewind(charFile);
-    std::fwrite(&data[0], data.size(), 1, charFile);
-    std::fflush(charFile);
+    auto gameData = activateGameDataContext();
+    calculateChecksum();
+
+    buffer.clear();
+    buffer.reserve(getByteSize());
+
+    // build the complete file image in memory so it can be written out at once
+    BitSink sink(buffer);
+    if (!writeBasicInfo(sink))
+    {
+        m_error_code = std::make_error_code(CharacterErrc::InvalidHeader);
+        return false;
+    }
+
+    if (!writeActs(sink))
+    {
+        m_error_code = std::make_error_code(CharacterErrc::InvalidActsInfo);
+        return false;
+    }
+
+    // From this point on, the location is variable
+    if (!writeStats(sink))
+    {
+        m_error_code = std::make_error_code(CharacterErrc::InvalidCharStats);
+        return false;
+    }
+
+    // Write Character, Corpse, Mercenary and Golem items
+    if (!writeItems(sink))
+    {
+        m_error_code = std::make_error_code(CharacterErrc::InvalidItemInventory);
+        return false;
+    }
+
+    return true;
+}
+//---------------------------------------------------------------------------
+bool d2ce::Character::writeBasicInfo(BitSink& charFile) const
+{
+    return charFile.write(&data[0], data.size(), 1) == 1;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Character::writeActs(std::FILE* charFile) const
+bool d2ce::Character::writeActs(BitSink& charFile) const
 {
     return Acts.writeActs(charFile);
 }
 //---------------------------------------------------------------------------
-bool d2ce::Character::writeStats(std::FILE* charFile) const
+bool d2ce::Character::writeStats(BitSink& charFile) const
 {
     return Cs.writeStats(charFile);
 }
 //---------------------------------------------------------------------------
-bool d2ce::Character::writeItems(std::FILE* charFile) const
+bool d2ce::Character::writeItems(BitSink& charFile) const
 {
     return m_items.writeItems(charFile, isExpansionCharacter(), hasMercenary());
 }
@@ -3469,41 +3527,101 @@ void d2ce::Character::initVersion()
 //---------------------------------------------------------------------------
 void d2ce::Character::checkForD2RMod()
 {
-    // D2R games folder
-    static auto d2rGamesFolder = GetD2RGamesFolder();
-    if (d2rGamesFolder.empty())
+    if (getVersion() < EnumCharVersion::v100R)
     {
         setTxtReader(getDefaultTxtReader());
         return;
     }
 
-    if (getVersion() < EnumCharVersion::v100R)
+    setTxtReader(getD2RModTxtReader(m_d2sfilename));
+}
+//---------------------------------------------------------------------------
+const d2ce::ITxtReader& d2ce::Character::getD2RModTxtReader(const std::filesystem::path& path)
+{
+    // D2R games folder
+    static auto d2rGamesFolder = GetD2RGamesFolder();
+    if (d2rGamesFolder.empty())
     {
-        setTxtReader(getDefaultTxtReader());
-        return;
+        return getDefaultTxtReader();
     }
 
     // check if we are a sub path
-    if (m_d2sfilename.empty())
+    if (path.empty())
     {
-        setTxtReader(getDefaultTxtReader());
-        return;
+        return getDefaultTxtReader();
     }
 
-    auto rel = std::filesystem::relative(m_d2sfilename.parent_path(), d2rGamesFolder);
+    auto rel = std::filesystem::relative(path.parent_path(), d2rGamesFolder);
     if (rel.empty() || rel.native()[0] == '.')
     {
-        setTxtReader(getDefaultTxtReader());
-        return;
+        return getDefaultTxtReader();
     }
 
     // we are a subpath, get Mod name
-    auto modName = m_d2sfilename.parent_path().filename().u8string();
-    setTxtReader(getDefaultTxtReader(modName));
+    auto modName = path.parent_path().filename().u8string();
+    return getDefaultTxtReader(modName);
+}
+//---------------------------------------------------------------------------
+const d2ce::ITxtReader& d2ce::Character::getFileTxtReader(const std::filesystem::path& path)
+{
+    std::wstring ext = path.extension().wstring();
+    if (_wcsicmp(ext.c_str(), L".json") == 0)
+    {
+        std::ifstream ifs;
+        ifs.open(path.wstring().c_str());
+        if (!ifs.is_open())
+        {
+            return getDefaultTxtReader();
+        }
+
+        Json::Value root;
+        Json::CharReaderBuilder builder;
+        JSONCPP_STRING errs;
+        if (!parseFromStream(builder, ifs, &root, &errs))
+        {
+            return getDefaultTxtReader();
+        }
+
+        bool bSerializedFormat = false;
+        Json::Value header = root["header"];
+        if (header.isNull())
+        {
+            header = root["Header"];
+            if (header.isNull())
+            {
+                return getDefaultTxtReader();
+            }
+
+            bSerializedFormat = true;
+        }
+
+        return getJsonTxtReader(header, bSerializedFormat);
+    }
+
+    if (_wcsicmp(ext.c_str(), L".d2i") == 0)
+    {
+        // shared stash files only exist for D2R
+        return getD2RModTxtReader(path);
+    }
+
+    BitSource charFile;
+    std::uint32_t version = 0;
+    if (!charFile.open(path) || !charFile.seek(CHAR_V100_VERSION_BYTE_OFFSET) || (charFile.read(&version, sizeof(version), 1) != 1))
+    {
+        return getDefaultTxtReader();
+    }
+
+    if (version < static_cast<std::underlying_type_t<EnumCharVersion>>(EnumCharVersion::v100R))
+    {
+        return getDefaultTxtReader();
+    }
+
+    return getD2RModTxtReader(path);
 }
 //---------------------------------------------------------------------------
 std::string d2ce::Character::asJson(bool bSerializedFormat, EnumCharSaveOp saveOp)
 {
+    auto gameData = activateGameDataContext();
     bool bBackup = false;
     bool bSave = true;
     switch (saveOp)
@@ -3554,12 +3672,9 @@ void d2ce::Character::setDefaultTxtReader()
 //---------------------------------------------------------------------------
 void d2ce::Character::setTxtReader(const d2ce::ITxtReader& txtReader)
 {
-    if (!ItemHelpers::isTxtReaderInitialized() || (&txtReader != &ItemHelpers::getTxtReader()))
-    {
-        ItemHelpers::setTxtReader(txtReader);
-        Cs.setTxtReader();
-        Merc.setTxtReader();
-    }
+    // also rebuilds the skill and mercenary tables
+    ItemHelpers::setTxtReader(txtReader);
+    m_gameData = ItemHelpers::getGameDataContext();
 }
 //---------------------------------------------------------------------------
 const d2ce::ITxtReader& d2ce::Character::getTxtReader() const
@@ -3574,7 +3689,19 @@ const std::string& d2ce::Character::getLanguage() const
 //---------------------------------------------------------------------------
 const std::string& d2ce::Character::setLanguage(const std::string& lang) const
 {
-    return ItemHelpers::setLanguage(lang);
+    const auto& language = ItemHelpers::setLanguage(lang);
+    m_gameData = ItemHelpers::getGameDataContext();
+    return language;
+}
+//---------------------------------------------------------------------------
+d2ce::GameDataContextPtr d2ce::Character::getGameDataContext() const
+{
+    return m_gameData;
+}
+//---------------------------------------------------------------------------
+d2ce::GameDataScope d2ce::Character::activateGameDataContext() const
+{
+    return GameDataScope(m_gameData);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Character::is_open() const
@@ -3629,7 +3756,7 @@ d2ce::Mercenary& d2ce::Character::getMercenaryInfo() const
     return Merc;
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& d2ce::Character::getMercItems() const
+const d2ce::ItemList& d2ce::Character::getMercItems() const
 {
     return m_items.getMercItems();
 }
@@ -3654,7 +3781,7 @@ bool d2ce::Character::getCombinedMercDamage(BaseDamage& damage) const
     return m_items.getCombinedMercDamage(damage, Merc.getLevel());
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& d2ce::Character::getCorpseItems() const
+const d2ce::ItemList& d2ce::Character::getCorpseItems() const
 {
     return m_items.getCorpseItems();
 }
@@ -3664,7 +3791,7 @@ bool d2ce::Character::hasGolem() const
     return m_items.hasGolem();
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& d2ce::Character::getGolemItem() const
+const d2ce::ItemList& d2ce::Character::getGolemItem() const
 {
     return m_items.getGolemItem();
 }
@@ -5007,7 +5134,7 @@ bool d2ce::Character::hasSharedStash() const
     return m_shared_stash.hasSharedStash();
 }
 //---------------------------------------------------------------------------
-std::uint64_t d2ce::Character::readBytes(std::FILE* charfile, size_t& current_byte_offset, size_t bytes)
+std::uint64_t d2ce::Character::readBytes(BitSource& charfile, size_t& current_byte_offset, size_t bytes)
 {
     size_t readOffset = current_byte_offset;
 
@@ -5025,24 +5152,20 @@ std::uint64_t d2ce::Character::readBytes(std::FILE* charfile, size_t& current_by
     return readBytes64(readOffset, bytes);
 }
 //---------------------------------------------------------------------------
-bool d2ce::Character::skipBytes(std::FILE* charfile, size_t& current_byte_offset, size_t bytes)
+bool d2ce::Character::skipBytes(BitSource& charfile, size_t& current_byte_offset, size_t bytes)
 {
-    if (feof(charfile))
+    if (charfile.eof())
     {
         return false;
     }
 
     size_t bytesRequired = current_byte_offset + bytes;
-    std::uint8_t value = 0;
-    while (data.size() < bytesRequired)
+    if (data.size() < bytesRequired)
     {
-        if (feof(charfile))
+        if (!charfile.append(data, bytesRequired - data.size()))
         {
             return false;
         }
-
-        std::fread(&value, sizeof(value), 1, charfile);
-        data.push_back(value);
     }
 
     current_byte_offset += bytes;
@@ -29,6 +29,7 @@
 #include "Mercenary.h"
 #include "Item.h"
 #include "SharedStash.h"
+#include "BackupStore.h"
 #include <json/json.h>
 #include <filesystem>
 
@@ -47,8 +48,8 @@ namespace d2ce
         std::filesystem::file_time_type m_ftime; // Modified time of file at the time it was read
 
     protected:
-        std::uint64_t readBytes(std::FILE* charfile, size_t& current_byte_offset, size_t byte);
-        bool skipBytes(std::FILE* charfile, size_t& current_byte_offset, size_t byte);
+        std::uint64_t readBytes(BitSource& charfile, size_t& current_byte_offset, size_t byte);
+        bool skipBytes(BitSource& charfile, size_t& current_byte_offset, size_t byte);
         bool setBytes(size_t& current_byte_offset, size_t bytes, std::uint8_t* value);
         bool setBytes(size_t& current_byte_offset, size_t bytes, std::uint32_t value);
         bool setBytes64(size_t& current_byte_offset, size_t bytes, std::uint64_t value);
@@ -109,6 +110,7 @@ namespace d2ce
         // the following variables are not part of the character file format
         mutable std::filesystem::path m_d2sfilename, m_jsonfilename, m_tempfilename;
         std::error_code m_error_code;
+        mutable GameDataContextPtr m_gameData;
         bool m_bJsonSerializedFormat = false;
 
         SharedStash m_shared_stash;
@@ -118,24 +120,24 @@ namespace d2ce
         void initialize();
         bool openD2S(const std::filesystem::path& path, bool validateChecksum = true);
         bool openJson(const std::filesystem::path& path);
-        void readHeader(std::FILE* charFile);
+        void readHeader(BitSource& charFile);
         void readHeader(const Json::Value& root);
         bool isValidHeader() const;
-        bool refresh(std::FILE* charFile);
+        bool refresh(BitSource& charFile);
         bool refresh(const Json::Value& root);
-        void readBasicInfo(std::FILE* charFile);
+        void readBasicInfo(BitSource& charFile);
         bool readBasicInfo(const Json::Value& root);
-        bool readActs(std::FILE* charFile);
+        bool readActs(BitSource& charFile);
         bool readActs(const Json::Value& root);
-        bool readStats(std::FILE* charFile);
+        bool readStats(BitSource& charFile);
         bool readStats(const Json::Value& root);
-        bool readItems(std::FILE* charFile);
+        bool readItems(BitSource& charFile);
         bool readItems(const Json::Value& root);
 
-        void writeBasicInfo(std::FILE* charFile) const;
-        bool writeActs(std::FILE* charFile) const;
-        bool writeStats(std::FILE* charFile) const;
-        bool writeItems(std::FILE* charFile) const;
+        bool writeBasicInfo(BitSink& charFile) const;
+        bool writeActs(BitSink& charFile) const;
+        bool writeStats(BitSink& charFile) const;
+        bool writeItems(BitSink& charFile) const;
 
         void headerAsJson(Json::Value& parent, EnumCharVersion version, bool bSerializedFormat = false) const;
         void headerAsJson(Json::Value& parent, bool bSerializedFormat = false) const;
@@ -146,6 +148,9 @@ namespace d2ce
         void initVersion();
         void checkForD2RMod();
 
+        static const ITxtReader& getD2RModTxtReader(const std::filesystem::path& path);
+        static const ITxtReader& getJsonTxtReader(const Json::Value& header, bool bSerializedFormat);
+
     public:
         Character();
         ~Character();
@@ -154,6 +159,9 @@ namespace d2ce
         bool open(const std::filesystem::path& path, bool validateChecksum = true);
         bool refresh();
         bool save(bool backup = true);
+        bool serialize(std::vector<std::uint8_t>& buffer); // complete .d2s file image, updates the checksum
+        bool getBackups(std::vector<BackupInfo>& backups) const; // oldest first
+        bool restoreBackup(size_t index);
         bool saveAsVersion(EnumCharVersion version, EnumCharSaveOp saveOp = EnumCharSaveOp::SaveWithBackup);
         bool saveAsVersion(const std::filesystem::path& path, EnumCharVersion version, EnumCharSaveOp saveOp = EnumCharSaveOp::SaveWithBackup);
         bool saveAsD2s(EnumCharSaveOp saveOp = EnumCharSaveOp::SaveWithBackup);
@@ -167,6 +175,16 @@ namespace d2ce
         void setTxtReader(const ITxtReader& txtReader);
         const ITxtReader& getTxtReader() const;
 
+        // the txt reader open installs for the file (.d2s, .json or a .d2i in a D2R mod save folder),
+        // so a caller opening many files can install it once per group of files
+        static const ITxtReader& getFileTxtReader(const std::filesystem::path& path);
+
+        // the game data the character was loaded with, activateGameDataContext reinstalls it
+        // if another character has since switched the item tables to a different mod or language
+        // and keeps the tables locked until the returned scope is destroyed
+        GameDataContextPtr getGameDataContext() const;
+        GameDataScope activateGameDataContext() const;
+
         const std::string& getLanguage() const;
         const std::string& setLanguage(const std::string& lang) const;
 
@@ -179,7 +197,7 @@ namespace d2ce
         // Mercenary Info
         bool hasMercenary() const;
         Mercenary& getMercenaryInfo() const;
-        const std::list<d2ce::Item>& getMercItems() const;
+        const d2ce::ItemList& getMercItems() const;
 
         bool getMercItemBonuses(std::vector<MagicalAttribute>& attribs) const;
         bool getDisplayedMercItemBonuses(std::vector<MagicalAttribute>& attribs) const;
@@ -187,11 +205,11 @@ namespace d2ce
         bool getCombinedMercDamage(BaseDamage& damage) const;
 
         // Corpse Items
-        const std::list<d2ce::Item>& getCorpseItems() const;
+        const d2ce::ItemList& getCorpseItems() const;
 
         // Golem Info
         bool hasGolem() const;
-        const std::list<d2ce::Item>& getGolemItem() const;
+        const d2ce::ItemList& getGolemItem() const;
 
         // Character Stats
         void fillBasicStats(BasicStats& bs) const;
@@ -26,6 +26,7 @@
 #include <system_error>
 #include <array>
 #include <optional>
+#include <set>
 
 namespace d2ce
 {
@@ -78,6 +79,7 @@ namespace d2ce
         InvalidItemInventory,
         FileRenameError,
         AuxFileRenameError,
+        FileWriteError,
     };
 
     struct CharacterErrCategory : std::error_category
@@ -112,6 +114,13 @@ namespace d2ce
     public:
         virtual ~ITxtReader() {};
         virtual std::unique_ptr<ITxtDocument> GetStringTxt() const = 0;
+
+        // only the given language columns are needed, so readers may skip storing the others
+        virtual std::unique_ptr<ITxtDocument> GetStringTxt(const std::set<std::string>& /*languages*/) const
+        {
+            return GetStringTxt();
+        }
+
         virtual std::unique_ptr<ITxtDocument> GetExpansionStringTxt() const = 0;
         virtual std::unique_ptr<ITxtDocument> GetPatchStringTxt() const = 0;
         virtual std::unique_ptr<ITxtDocument> GetCharStatsTxt() const = 0;
@@ -146,6 +155,54 @@ namespace d2ce
         virtual std::string GetModName() const = 0;
     };
 
+    class GameDataBackup;
+
+    //---------------------------------------------------------------------------
+    // Immutable description of the game data the item tables are built from: the txt reader,
+    // the language and the item data generation. A new context is published every time
+    // setTxtReader or setLanguage changes the tables, so a holder can tell whether the tables
+    // still match the data it was loaded with and reinstall its context when they do not.
+    // When another txt reader is installed, the tables built for this one are set aside with
+    // the context, so reinstalling it swaps them back in instead of rebuilding them.
+    class GameDataContext
+    {
+    private:
+        const ITxtReader* m_pTxtReader = nullptr;
+        std::string m_language;
+        std::uint32_t m_generation = 0;
+        std::shared_ptr<GameDataBackup> m_pTables; // shared by the contexts of the same tables, empty while they are installed
+
+    public:
+        GameDataContext(const ITxtReader& txtReader, const std::string& language, std::uint32_t generation, const std::shared_ptr<GameDataBackup>& pTables);
+
+        const ITxtReader& getTxtReader() const;
+        const std::string& getLanguage() const;
+        std::uint32_t getGeneration() const;
+        const std::shared_ptr<GameDataBackup>& getTables() const;
+
+        bool isCurrent() const; // true if the item tables are still built from this context
+    };
+    using GameDataContextPtr = std::shared_ptr<const GameDataContext>;
+
+    //---------------------------------------------------------------------------
+    // Holds the game data tables locked for reading while it is alive. Given a context that is not
+    // current, it takes the exclusive lock instead, installs the context and keeps it installed
+    // until it is destroyed. References obtained from the tables are only valid while a scope is
+    // held. Scopes nest on the same thread and must be destroyed on the thread that created them.
+    class GameDataScope
+    {
+    private:
+        bool m_bShared = false;
+        bool m_bExclusive = false;
+
+    public:
+        explicit GameDataScope(const GameDataContextPtr& pContext = GameDataContextPtr());
+        ~GameDataScope();
+
+        GameDataScope(const GameDataScope&) = delete;
+        GameDataScope& operator=(const GameDataScope&) = delete;
+    };
+
     const ITxtReader& getDefaultTxtReader();
 
     struct ClassSkillType
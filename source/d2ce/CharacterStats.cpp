@@ -1032,6 +1032,18 @@ namespace d2ce
         ItemHelpers::initRunewordData();
     }
 
+    void StashSkillInfoData(GameDataBackup& backup)
+    {
+        backup.stash(s_MinExpRequired);
+        backup.stash(s_CharClassNameMap);
+        backup.stash(s_CharClassEnumMap);
+        backup.stash(s_CharClassInfo);
+        backup.stash(s_CharClassCodeMap);
+        backup.stash(s_SkillDescMap);
+        backup.stash(s_SkillIndexMap);
+        backup.stash(s_SkillInfoMap);
+    }
+
     const std::vector<std::uint32_t>& GetExperienceLevels(EnumCharClass charClass)
     {
         auto iter = s_MinExpRequired.find(charClass);
@@ -1336,7 +1348,7 @@ std::uint32_t* d2ce::CharacterStats::GetStatBuffer(std::uint16_t stat) const
     }
 }
 //---------------------------------------------------------------------------
-std::uint64_t d2ce::CharacterStats::readBits(std::FILE* charfile, size_t& current_bit_offset, size_t bits)
+std::uint64_t d2ce::CharacterStats::readBits(BitSource& charfile, size_t& current_bit_offset, size_t bits)
 {
     size_t readOffset = current_bit_offset;
 
@@ -1354,31 +1366,27 @@ std::uint64_t d2ce::CharacterStats::readBits(std::FILE* charfile, size_t& curren
     return (*((std::uint64_t*)&data[readOffset / 8]) >> (readOffset & 7)) & ((std::uint64_t(1) << bits) - 1);
 }
 //---------------------------------------------------------------------------
-bool d2ce::CharacterStats::skipBits(std::FILE* charfile, size_t& current_bit_offset, size_t bits)
+bool d2ce::CharacterStats::skipBits(BitSource& charfile, size_t& current_bit_offset, size_t bits)
 {
-    if (feof(charfile))
+    if (charfile.eof())
     {
         return false;
     }
 
     size_t bytesRequired = (current_bit_offset + bits + 7) / 8;
-    std::uint8_t value = 0;
-    while (data.size() < bytesRequired)
+    if (data.size() < bytesRequired)
     {
-        if (feof(charfile))
+        if (!charfile.append(data, bytesRequired - data.size()))
         {
             return false;
         }
-
-        std::fread(&value, sizeof(value), 1, charfile);
-        data.push_back(value);
     }
 
     current_bit_offset += bits;
     return true;
 }
 //---------------------------------------------------------------------------
-size_t d2ce::CharacterStats::readNextStat(std::FILE* charfile, size_t& current_bit_offset, std::uint16_t& stat)
+size_t d2ce::CharacterStats::readNextStat(BitSource& charfile, size_t& current_bit_offset, std::uint16_t& stat)
 {
     size_t totalBitsRead = STAT_BITS;
     stat = (std::uint16_t)readBits(charfile, current_bit_offset, STAT_BITS);
@@ -1391,7 +1399,7 @@ size_t d2ce::CharacterStats::readNextStat(std::FILE* charfile, size_t& current_b
     return totalBitsRead;
 }
 //---------------------------------------------------------------------------
-size_t d2ce::CharacterStats::readStatBits(std::FILE* charfile, size_t& current_bit_offset, std::uint16_t stat)
+size_t d2ce::CharacterStats::readStatBits(BitSource& charfile, size_t& current_bit_offset, std::uint16_t stat)
 {
     std::uint32_t* pStatValue = GetStatBuffer(stat);
     if (pStatValue == nullptr)
@@ -1404,16 +1412,16 @@ size_t d2ce::CharacterStats::readStatBits(std::FILE* charfile, size_t& current_b
     return bits;
 }
 //---------------------------------------------------------------------------
-bool d2ce::CharacterStats::readAllStats(std::FILE* charfile)
+bool d2ce::CharacterStats::readAllStats(BitSource& charfile)
 {
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != STATS_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != STATS_MARKER[1])
     {
         return false;
@@ -1472,7 +1480,7 @@ bool d2ce::CharacterStats::readAllStats(std::FILE* charfile)
     return totalBitsRead > 0 ? true : false;
 }
 //---------------------------------------------------------------------------
-bool d2ce::CharacterStats::readAllStats_109(std::FILE* charfile)
+bool d2ce::CharacterStats::readAllStats_109(BitSource& charfile)
 {
     size_t current_bit_offset = 0;
     std::uint16_t value = (std::uint16_t)readBits(charfile, current_bit_offset, sizeof(value) * 8);
@@ -1653,82 +1661,82 @@ bool d2ce::CharacterStats::readAllStats(const Json::Value& statsRoot, bool bSeri
     updateDataBuffer();
     return true;
 }
-bool d2ce::CharacterStats::readSkills(std::FILE* charfile)
+bool d2ce::CharacterStats::readSkills(BitSource& charfile)
 {
     has_pd2_skills = false;
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != SKILLS_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != SKILLS_MARKER[1])
     {
         return false;
     }
 
-    std::fread(Skills.data(), Skills.size(), 1, charfile);
+    charfile.read(Skills.data(), Skills.size());
 
     if (CharInfo.getVersion() == EnumCharVersion::v110)
     {
         // Check for PD2 version
-        auto cur_pos = std::ftell(charfile);
+        auto cur_pos = charfile.tell();
         auto temp_pos = cur_pos;
-        for (size_t num = 0; (num < 3) && !feof(charfile); ++num)
+        for (size_t num = 0; (num < 3) && !charfile.eof(); ++num)
         {
-            std::fread(&value, sizeof(value), 1, charfile);
+            charfile.read(&value, sizeof(value));
             if (value != ITEM_MARKER[0])
             {
                 continue;
             }
 
-            temp_pos = std::ftell(charfile);
-            std::fread(&value, sizeof(value), 1, charfile);
+            temp_pos = charfile.tell();
+            charfile.read(&value, sizeof(value));
             if (value != ITEM_MARKER[1])
             {
-                std::fseek(charfile, temp_pos, SEEK_SET);
+                charfile.seek(temp_pos);
                 continue;
             }
 
             // not a PD2 file
-            std::fseek(charfile, cur_pos, SEEK_SET);
+            charfile.seek(cur_pos);
             return true;
         }
 
-        if (feof(charfile))
+        if (charfile.eof())
         {
             // not a PD2 file
-            std::fseek(charfile, cur_pos, SEEK_SET);
+            charfile.seek(cur_pos);
             return true;
         }
 
-        std::fread(&value, sizeof(value), 1, charfile);
+        charfile.read(&value, sizeof(value));
         if (value != ITEM_MARKER[0])
         {
-            std::fseek(charfile, temp_pos, SEEK_SET);
+            charfile.seek(temp_pos);
             return true;
         }
 
-        if (feof(charfile))
+        if (charfile.eof())
         {
             // not a PD2 file
-            std::fseek(charfile, cur_pos, SEEK_SET);
+            charfile.seek(cur_pos);
             return true;
         }
 
-        std::fread(&value, sizeof(value), 1, charfile);
+        charfile.read(&value, sizeof(value));
         if (value != ITEM_MARKER[1])
         {
-            std::fseek(charfile, temp_pos, SEEK_SET);
+            charfile.seek(temp_pos);
             return true;
         }
 
         // we detected a PD2 file with 3 extra bytes for skills
         has_pd2_skills = true;
-        std::fseek(charfile, cur_pos, SEEK_SET);
-        std::fread(PD2Skills.data(), PD2Skills.size(), 1, charfile);
+        charfile.seek(cur_pos);
+        charfile.read(PD2Skills.data(), PD2Skills.size());
     }
 
     return true;
@@ -1893,16 +1901,14 @@ size_t d2ce::CharacterStats::updateStatBits(size_t& current_bit_offset, std::uin
     return updateBits(current_bit_offset, numBits, *pStatValue);
 }
 //---------------------------------------------------------------------------
-bool d2ce::CharacterStats::writeSkills(std::FILE* charfile) const
+bool d2ce::CharacterStats::writeSkills(BitSink& charfile) const
 {
-    std::fwrite(SKILLS_MARKER.data(), SKILLS_MARKER.size(), 1, charfile);
-    std::fwrite(Skills.data(), Skills.size(), 1, charfile);
-    std::fflush(charfile);
+    charfile.write(SKILLS_MARKER.data(), SKILLS_MARKER.size(), 1);
+    charfile.write(Skills.data(), Skills.size(), 1);
 
     if (isPD2Format())
     {
-        std::fwrite(PD2Skills.data(), PD2Skills.size(), 1, charfile);
-        std::fflush(charfile);
+        charfile.write(PD2Skills.data(), PD2Skills.size(), 1);
     }
 
     return true;
@@ -1914,13 +1920,7 @@ std::uint32_t d2ce::CharacterStats::getStatPointsPerLevel() const
     return charClassInfo.StatPerLevel == 0 ? 5 : charClassInfo.StatPerLevel;
 }
 //---------------------------------------------------------------------------
-void d2ce::CharacterStats::setTxtReader()
-{
-    auto& txtReader = ItemHelpers::getTxtReader();
-    InitSkillInfoData(txtReader);
-}
-//---------------------------------------------------------------------------
-bool d2ce::CharacterStats::readStats(std::FILE* charfile)
+bool d2ce::CharacterStats::readStats(BitSource& charfile)
 {
     if (!readAllStats(charfile))
     {
@@ -1970,10 +1970,10 @@ bool d2ce::CharacterStats::readStats(const Json::Value& root, bool bSerializedFo
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::CharacterStats::writeStats(std::FILE* charfile) const
+bool d2ce::CharacterStats::writeStats(BitSink& charfile) const
 {
-    std::fwrite(STATS_MARKER.data(), STATS_MARKER.size(), 1, charfile);
-    std::fwrite(&data[0], data.size(), 1, charfile);
+    charfile.write(STATS_MARKER.data(), STATS_MARKER.size(), 1);
+    charfile.write(&data[0], data.size(), 1);
     return writeSkills(charfile);
 }
 //---------------------------------------------------------------------------
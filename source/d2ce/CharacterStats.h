@@ -22,6 +22,8 @@
 #include "CharacterStatsConstants.h"
 #include "SkillConstants.h"
 #include "DataTypes.h"
+#include "BitSource.h"
+#include "BitSink.h"
 #include <json/json.h>
 
 namespace d2ce
@@ -84,22 +86,22 @@ namespace d2ce
         EnumCharStatInfo GetStatInfoMask(std::uint16_t stat) const;
         std::uint32_t* GetStatBuffer(std::uint16_t stat) const;
 
-        std::uint64_t readBits(std::FILE* charfile, size_t& current_bit_offset, size_t bits);
-        bool skipBits(std::FILE* charfile, size_t& current_bit_offset, size_t bits);
-        size_t readNextStat(std::FILE* charfile, size_t& current_bit_offset, std::uint16_t& stat);
-        size_t readStatBits(std::FILE* charfile, size_t& current_bit_offset, std::uint16_t stat);
-        bool readAllStats(std::FILE* charfile);
+        std::uint64_t readBits(BitSource& charfile, size_t& current_bit_offset, size_t bits);
+        bool skipBits(BitSource& charfile, size_t& current_bit_offset, size_t bits);
+        size_t readNextStat(BitSource& charfile, size_t& current_bit_offset, std::uint16_t& stat);
+        size_t readStatBits(BitSource& charfile, size_t& current_bit_offset, std::uint16_t stat);
+        bool readAllStats(BitSource& charfile);
         void applyJsonStats(const Json::Value& statsRoot, bool bSerializedFormat);
         bool readAllStats(const Json::Value& statsRoot, bool bSerializedFormat);
-        bool readAllStats_109(std::FILE* charfile);
-        bool readSkills(std::FILE* charfile);
+        bool readAllStats_109(BitSource& charfile);
+        bool readSkills(BitSource& charfile);
         void applyJsonSkills(const Json::Value& root, const Json::Value& skillsRoot, bool bSerializedFormat);
         bool readSkills(const Json::Value& root, const Json::Value& skillsRoot, bool bSerializedFormat);
 
         size_t updateBits(size_t& current_bit_offset, size_t size, std::uint32_t value) const;
         size_t updateStat(size_t& current_bit_offset, std::uint16_t stat) const;
         size_t updateStatBits(size_t& current_bit_offset, std::uint16_t stat) const;
-        bool writeSkills(std::FILE* charfile) const;
+        bool writeSkills(BitSink& charfile) const;
 
         std::uint32_t getStatPointsPerLevel() const;
 
@@ -115,11 +117,9 @@ namespace d2ce
         std::array<std::uint8_t, NUM_OF_PD2_SKILLS> PD2Skills = { 0 };
 
     protected:
-        void setTxtReader();
-
-        bool readStats(std::FILE* charfile);
+        bool readStats(BitSource& charfile);
         bool readStats(const Json::Value& statsRoot, bool bSerializedFormat);
-        bool writeStats(std::FILE* charfile) const;
+        bool writeStats(BitSink& charfile) const;
 
         void updateDataBuffer();
         void resetStats(std::uint16_t lifePointsEarned, std::uint16_t statPointEarned, std::uint16_t skillPointsEarned);
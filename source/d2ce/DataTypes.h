@@ -1015,6 +1015,206 @@ namespace d2ce
         }
     };
 
+    // Empty cells of an inventory grid (inventory, stash, Horadric Cube or belt) kept as one
+    // 64 bit mask per row, a set bit is an empty cell. Cells are addressed as x, y or as the
+    // position y * width + x (the belt stores items by position in x), so a rectangle's
+    // origin is normalized through its position.
+    struct ItemLocationGrid
+    {
+        static constexpr std::uint16_t MaxWidth = 64;
+
+        std::uint16_t Width = 0;
+        std::vector<std::uint64_t> Rows;
+
+        void clear()
+        {
+            Width = 0;
+            Rows.clear();
+        }
+
+        // all cells are empty
+        void reset(std::uint16_t width, std::uint16_t height)
+        {
+            Width = std::min(width, MaxWidth);
+            Rows.assign((Width == 0) ? 0 : height, getRowMask(0, Width));
+        }
+
+        // reset to the dimensions of the grid
+        void reset(const ItemDimensions& dimensions)
+        {
+            reset(dimensions.InvWidth, dimensions.InvHeight);
+        }
+
+        std::uint16_t getHeight() const
+        {
+            return std::uint16_t(Rows.size());
+        }
+
+        // true if there are no empty cells
+        bool empty() const
+        {
+            for (auto row : Rows)
+            {
+                if (row != 0)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // number of empty cells
+        size_t size() const
+        {
+            size_t count = 0;
+            for (auto row : Rows)
+            {
+                for (; row != 0; row &= row - 1)
+                {
+                    ++count;
+                }
+            }
+
+            return count;
+        }
+
+        // the first empty position or MAXUINT16 if there are none
+        std::uint16_t front() const
+        {
+            for (size_t y = 0; y < Rows.size(); ++y)
+            {
+                if (Rows[y] != 0)
+                {
+                    return std::uint16_t(y * Width + getLowestBit(Rows[y]));
+                }
+            }
+
+            return MAXUINT16;
+        }
+
+        bool isEmpty(std::uint16_t x, std::uint16_t y, std::uint16_t width = 1, std::uint16_t height = 1) const
+        {
+            if (!normalize(x, y) || (x + width > Width) || (y + height > getHeight()))
+            {
+                return false;
+            }
+
+            auto mask = getRowMask(x, width);
+            for (std::uint16_t row = y; row < y + height; ++row)
+            {
+                if ((Rows[row] & mask) != mask)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // cells outside of the grid are ignored
+        void occupy(std::uint16_t x, std::uint16_t y, std::uint16_t width = 1, std::uint16_t height = 1)
+        {
+            if (!normalize(x, y))
+            {
+                return;
+            }
+
+            auto mask = ~getRowMask(x, width);
+            for (size_t row = y; (row < size_t(y + height)) && (row < Rows.size()); ++row)
+            {
+                Rows[row] &= mask;
+            }
+        }
+
+        // cells outside of the grid are ignored
+        void release(std::uint16_t x, std::uint16_t y, std::uint16_t width = 1, std::uint16_t height = 1)
+        {
+            if (!normalize(x, y))
+            {
+                return;
+            }
+
+            auto mask = getRowMask(x, width);
+            for (size_t row = y; (row < size_t(y + height)) && (row < Rows.size()); ++row)
+            {
+                Rows[row] |= mask;
+            }
+        }
+
+        // finds the first empty rectangle of the given size, rows first
+        bool findSpace(std::uint16_t width, std::uint16_t height, std::uint16_t& x, std::uint16_t& y) const
+        {
+            if ((width == 0) || (height == 0) || (width > Width) || (height > getHeight()))
+            {
+                return false;
+            }
+
+            for (size_t row = 0; row + height <= Rows.size(); ++row)
+            {
+                // cells empty in all rows of the rectangle
+                auto columns = Rows[row];
+                for (size_t i = 1; (i < height) && (columns != 0); ++i)
+                {
+                    columns &= Rows[row + i];
+                }
+
+                // bit x is left set if the columns x to x + width - 1 are all empty
+                auto fits = columns;
+                for (std::uint16_t i = 1; (i < width) && (fits != 0); ++i)
+                {
+                    fits &= columns >> i;
+                }
+
+                if (fits != 0)
+                {
+                    x = getLowestBit(fits);
+                    y = std::uint16_t(row);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+    private:
+        std::uint64_t getRowMask(std::uint16_t x, std::uint16_t width) const
+        {
+            if (x >= Width)
+            {
+                return 0;
+            }
+
+            width = std::min(width, std::uint16_t(Width - x));
+            auto mask = (width >= MaxWidth) ? ~0ui64 : ((1ui64 << width) - 1);
+            return mask << x;
+        }
+
+        bool normalize(std::uint16_t& x, std::uint16_t& y) const
+        {
+            if (Width == 0)
+            {
+                return false;
+            }
+
+            size_t pos = size_t(y) * Width + x;
+            x = std::uint16_t(pos % Width);
+            y = std::uint16_t(pos / Width);
+            return y < Rows.size();
+        }
+
+        static std::uint16_t getLowestBit(std::uint64_t value)
+        {
+            std::uint16_t bit = 0;
+            for (; (value & 1) == 0; value >>= 1)
+            {
+                ++bit;
+            }
+
+            return bit;
+        }
+    };
+
     struct ItemDurability
     {
         std::uint16_t Current = 0;
@@ -1321,6 +1521,99 @@ namespace d2ce
         std::vector<std::uint16_t> nextInChain; // stats that follows this one (i.e. firemaxdam follows firemindam)
     };
 
+    //---------------------------------------------------------------------------
+    // The ItemStat fields used to decode a property list, kept in their own dense
+    // table so the decoder does not pull the names and descriptions into the cache.
+    struct ItemStatEncoding
+    {
+        static constexpr size_t MAX_NEXT_IN_CHAIN = 3; // a property holds at most 4 values
+
+        std::uint16_t id = MAXUINT16;  // MAXUINT16 if the stat does not exist
+        std::uint16_t saveBits = 0;
+        std::int16_t saveAdd = 0;
+        std::uint16_t saveParamBits = 0;
+        std::uint8_t encode = 0;
+        bool addSkillTab = false;      // item_addskill_tab, the parameter is saved as a 3 bit tab and a 13 bit class
+        std::uint8_t numNextInChain = 0;
+        std::array<std::uint16_t, MAX_NEXT_IN_CHAIN> nextInChain = { 0, 0, 0 };
+    };
+
+    //---------------------------------------------------------------------------
+    // Compact record of a property read from an item's property list or
+    // generated from the txt tables. Names and descriptions are not copied, they
+    // are looked up in the ItemStat table only when the record is converted to a
+    // MagicalAttribute for the JSON export or the UI, so reading and combining
+    // property lists does not allocate per property.
+    struct ItemProperty
+    {
+        static constexpr size_t MAX_VALUES = 4;
+
+        std::uint16_t Id = 0;
+        std::uint8_t NumValues = 0;
+        std::array<std::int64_t, MAX_VALUES> Values = { 0, 0, 0, 0 };
+        EnumItemVersion Version = EnumItemVersion::v100;
+        std::uint16_t GameVersion = 0;
+        std::uint8_t DescPriority = 0; // The higher this value is the further up in the item description this stat will be listed
+        std::uint8_t encode = 0;
+        bool RangeDesc = false;        // described with the range description of the stat
+
+        void clear()
+        {
+            Id = 0;
+            NumValues = 0;
+            Values.fill(0);
+            Version = EnumItemVersion::v100;
+            GameVersion = 0;
+            DescPriority = 0;
+            encode = 0;
+            RangeDesc = false;
+        }
+
+        bool addValue(std::int64_t value)
+        {
+            if (NumValues >= MAX_VALUES)
+            {
+                return false;
+            }
+
+            Values[NumValues++] = value;
+            return true;
+        }
+
+        // stat is the ItemStat of Id for Version
+        void assign(const MagicalAttribute& attrib, const ItemStat& stat)
+        {
+            clear();
+            Id = attrib.Id;
+            Version = attrib.Version;
+            GameVersion = attrib.GameVersion;
+            DescPriority = attrib.DescPriority;
+            encode = attrib.encode;
+            RangeDesc = (!stat.nextInChain.empty() && (attrib.Desc != stat.desc) && (attrib.Desc == stat.descRange)) ? true : false;
+            for (auto value : attrib.Values)
+            {
+                if (!addValue(value))
+                {
+                    break;
+                }
+            }
+        }
+
+        // conversion used by the JSON export and UI code, stat is the ItemStat of Id for Version
+        void asMagicalAttribute(const ItemStat& stat, MagicalAttribute& attrib) const
+        {
+            attrib.clear();
+            attrib.Id = Id;
+            attrib.Name = stat.name;
+            attrib.Desc = RangeDesc ? stat.descRange : stat.desc;
+            attrib.Version = Version;
+            attrib.GameVersion = GameVersion;
+            attrib.DescPriority = DescPriority;
+            attrib.encode = encode;
+            attrib.Values.assign(Values.begin(), Values.begin() + NumValues);
+        }
+    };
+
     //---------------------------------------------------------------------------
     struct SpellDescStruct
     {
@@ -1385,6 +1678,7 @@ namespace d2ce
         std::map<std::uint16_t, std::uint8_t> max_sockets;
 
         std::vector<std::string> categories;
+        std::bitset<MAX_ITEM_CATEGORIES> categoryMask; // expanded categories by category id, bit test used by hasCategory/hasCategoryCode
 
         // gem effect
         // 0 = weapon
@@ -22,6 +22,10 @@
 #include <map>
 #include <bitset>
 #include <sstream>
+#include <cassert>
+#include <atomic>
+#include <future>
+#include <thread>
 #include "Item.h"
 #include "helpers/ItemHelpers.h"
 #include "SkillConstants.h"
@@ -39,6 +43,10 @@ namespace d2ce
 
     constexpr std::uint32_t MIN_START_STATS_POS = 64ui32;
 
+    constexpr std::uint16_t MIN_PARALLEL_READ_ITEMS = 32ui16; // smaller item lists are not worth starting threads for
+    constexpr size_t PARALLEL_READ_CHUNK_SIZE = 8;             // item markers decoded per task
+    thread_local size_t s_maxReadThreads = 0;                  // 0 means one thread per core
+
     constexpr std::uint32_t IS_IDENTIFIED_FLAG_OFFSET = 4ui32;
     constexpr std::uint32_t IS_DISABLED_FLAG_OFFSET = 8ui32;
     constexpr std::uint32_t IS_SOCKETED_FLAG_OFFSET = 11ui32;
@@ -195,20 +203,17 @@ namespace d2ce
 #define GET_BIT_OFFSET_MARKER(x) \
     bitOffsetMarkers[static_cast<std::underlying_type_t<ItemOffsetMarkers>>((x))]
 
-#define readtemp_bits(data,start,size) \
-    ((*((std::uint64_t*) &(data)[(start) / 8]) >> ((start) & 7))& (((std::uint64_t)1 << (size)) - 1))
-
 #define read_uint32_bits(start,size) \
-    ((*((std::uint32_t *) &data[(start) / 8]) >> ((start) & 7))& (((std::uint32_t)1 << (size)) - 1))
+    ((*((const std::uint32_t *) &data.bytes()[(start) / 8]) >> ((start) & 7))& (((std::uint32_t)1 << (size)) - 1))
 
 #define read_uint64_bits(start,size) \
-    ((*((std::uint64_t*) &data[(start) / 8]) >> ((start) & 7))& (((std::uint64_t)1 << (size)) - 1))
+    ((*((const std::uint64_t*) &data.bytes()[(start) / 8]) >> ((start) & 7))& (((std::uint64_t)1 << (size)) - 1))
 
 #define set_bit(start) \
-    ((data[(start) / 8]) |= (std::uint8_t)(1ul << ((start) & 7)))
+    ((data.modify()[(start) / 8]) |= (std::uint8_t)(1ul << ((start) & 7)))
 
 #define clear_bit(start) \
-    ((data[(start) / 8]) &= ~(std::uint8_t)(1ul << ((start) & 7)))
+    ((data.modify()[(start) / 8]) &= ~(std::uint8_t)(1ul << ((start) & 7)))
 
     void SetFlagBit(const Json::Value& node, size_t bitNum, std::bitset<32>& flags)
     {
@@ -341,13 +346,44 @@ namespace d2ce
         attribs.push_back(attrib);
     }
 
+    void AddUndeadBonusProperty(EnumItemVersion version, std::uint16_t gameVersion, std::vector<ItemProperty>& props)
+    {
+        const auto& stat = ItemHelpers::getItemStat(version, "item_undeaddamage_percent");
+        for (auto& prop : props)
+        {
+            if (prop.Id == stat.id)
+            {
+                prop.Values[0] += 50;
+                return;
+            }
+        }
+
+        ItemProperty prop;
+        prop.Id = stat.id;
+        prop.Version = version;
+        prop.GameVersion = gameVersion;
+        prop.addValue(50);
+        props.push_back(prop);
+    }
+
+    // attributes generated from the txt tables (v1.00 - v1.06 items, gems and runes)
+    void AppendItemProperties(const std::vector<MagicalAttribute>& attribs, std::vector<ItemProperty>& props)
+    {
+        props.reserve(props.size() + attribs.size());
+        for (const auto& attrib : attribs)
+        {
+            props.resize(props.size() + 1);
+            props.back().assign(attrib, ItemHelpers::getItemStat(attrib.Version, attrib.Id));
+        }
+    }
+
     //---------------------------------------------------------------------------
     namespace ItemHelpers
     {
         bool getItemCodev100(std::uint16_t code, std::array<std::uint8_t, 4>& strcode);
-        std::uint8_t getResurrectedItemCode(const std::vector<std::uint8_t>& data, size_t startOffset, std::array<std::uint8_t, 4>& strcode);
+        std::uint8_t getResurrectedItemCode(const ItemBytes& data, size_t startOffset, std::array<std::uint8_t, 4>& strcode);
         void encodeResurrectedItem(const std::array<std::uint8_t, 4>& strcode, std::uint64_t& encodedVal, std::uint8_t& numBitsSet);
-        std::uint8_t HuffmanDecodeBitString(const std::string& bitstr);
+        std::uint8_t HuffmanDecode(std::uint16_t bits, std::uint8_t& numBits);
 
         const ItemType& getInvalidItemTypeHelper();
 
@@ -398,6 +434,7 @@ namespace d2ce
         std::string formatMagicalAttributeValue(MagicalAttribute& attrib, std::uint32_t charLevel, size_t idx, const ItemStat& stat);
         bool formatDisplayedMagicalAttribute(MagicalAttribute& attrib, std::uint32_t charLevel);
         void combineMagicalAttribute(std::multimap<size_t, size_t>& itemIndexMap, const std::vector<MagicalAttribute>& newAttribs, std::vector<MagicalAttribute>& attribs);
+        void combineMagicalAttribute(std::multimap<size_t, size_t>& itemIndexMap, const std::vector<ItemProperty>& newProps, std::vector<ItemProperty>& props);
         void mergeMagicalAttributes(std::vector<MagicalAttribute>& attribs, const std::vector<MagicalAttribute>& newAttribs);
         bool ProcessNameNode(const Json::Value& node, std::array<char, NAME_LENGTH>& name, d2ce::EnumItemVersion version);
 
@@ -670,6 +707,101 @@ namespace d2ce
 
         return itemVersion;
     }
+
+    // number of bits moved per step, so a shifted word always fits in 64 bits
+    constexpr size_t BIT_WORD_NUM_BITS = 56;
+
+    template <class ByteVector>
+    std::uint64_t LoadBitWord(const ByteVector& data, size_t start)
+    {
+        // returns at least BIT_WORD_NUM_BITS bits starting at "start", bytes past the end read as 0
+        std::uint64_t word = 0;
+        size_t startIdx = start / 8;
+        if (startIdx < data.size())
+        {
+            std::memcpy(&word, &data[startIdx], std::min(sizeof(word), data.size() - startIdx));
+        }
+
+        return word >> (start & 7);
+    }
+
+    template <class ByteVector>
+    void StoreBitWord(ByteVector& data, size_t start, size_t size, std::uint64_t value)
+    {
+        // size is at most BIT_WORD_NUM_BITS and the bits are known to be within data
+        size_t startIdx = start / 8;
+        size_t numBytes = std::min(sizeof(std::uint64_t), data.size() - startIdx);
+        std::uint64_t word = 0;
+        std::memcpy(&word, &data[startIdx], numBytes);
+        std::uint64_t mask = (((std::uint64_t)1 << size) - 1) << (start & 7);
+        word = (word & ~mask) | ((value << (start & 7)) & mask);
+        std::memcpy(&data[startIdx], &word, numBytes);
+    }
+
+    template <class ByteVector>
+    void MoveBits(ByteVector& data, size_t src, size_t dest, size_t numBits)
+    {
+        if (src == dest || numBits == 0)
+        {
+            return;
+        }
+
+        if ((src % 8) == 0 && (dest % 8) == 0)
+        {
+            // byte aligned, let memmove do the bulk of the work
+            size_t numBytes = numBits / 8;
+            size_t bits = numBits % 8;
+            std::uint64_t lastBits = (bits > 0) ? LoadBitWord(data, src + numBytes * 8) : 0;
+            std::memmove(&data[dest / 8], &data[src / 8], numBytes);
+            if (bits > 0)
+            {
+                StoreBitWord(data, dest + numBytes * 8, bits, lastBits);
+            }
+            return;
+        }
+
+        if (dest > src)
+        {
+            // moving towards the end, start from the last word so the source is not overwritten before it is read
+            size_t remaining = numBits;
+            while (remaining > 0)
+            {
+                size_t bits = std::min(BIT_WORD_NUM_BITS, remaining);
+                remaining -= bits;
+                StoreBitWord(data, dest + remaining, bits, LoadBitWord(data, src + remaining));
+            }
+            return;
+        }
+
+        for (size_t pos = 0; pos < numBits;)
+        {
+            size_t bits = std::min(BIT_WORD_NUM_BITS, numBits - pos);
+            StoreBitWord(data, dest + pos, bits, LoadBitWord(data, src + pos));
+            pos += bits;
+        }
+    }
+
+    template <class ByteVector>
+    void ClearBits(ByteVector& data, size_t start, size_t numBits)
+    {
+        for (size_t pos = 0; pos < numBits;)
+        {
+            size_t bits = std::min(BIT_WORD_NUM_BITS, numBits - pos);
+            StoreBitWord(data, start + pos, bits, 0);
+            pos += bits;
+        }
+    }
+
+    template <class SrcByteVector, class DestByteVector>
+    void CopyBits(const SrcByteVector& src, size_t srcStart, DestByteVector& dest, size_t destStart, size_t numBits)
+    {
+        for (size_t pos = 0; pos < numBits;)
+        {
+            size_t bits = std::min(BIT_WORD_NUM_BITS, numBits - pos);
+            StoreBitWord(dest, destStart + pos, bits, LoadBitWord(src, srcStart + pos));
+            pos += bits;
+        }
+    }
 }
 //---------------------------------------------------------------------------
 
@@ -1137,8 +1269,9 @@ d2ce::Item::Item()
 {
 }
 //---------------------------------------------------------------------------
-d2ce::Item::Item(size_t itemsize) : data(itemsize)
+d2ce::Item::Item(size_t itemsize)
 {
+    data.resize(itemsize);
 }
 //---------------------------------------------------------------------------
 d2ce::Item::Item(const Item& other)
@@ -1148,6 +1281,7 @@ d2ce::Item::Item(const Item& other)
 //---------------------------------------------------------------------------
 d2ce::Item::Item(const ItemCreateParams& createParams)
 {
+    ViewUpdate viewUpdate(*this);
     static Item invalidItem;
     GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) = 0;
     if (!createParams.itemType.has_value())
@@ -2696,34 +2830,31 @@ d2ce::Item::Item(const ItemCreateParams& createParams)
 //---------------------------------------------------------------------------
 d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::filesystem::path& path)
 {
-    std::FILE* charfile = nullptr;
-    errno_t err = err = _wfopen_s(&charfile, path.wstring().c_str(), L"rb");
-    if (err != 0)
+    BitSource charfile;
+    if (!charfile.open(path))
     {
         // something went wrong
         return;
     }
 
-    std::fseek(charfile, 0, SEEK_END);
-    auto fileBitSize = std::ftell(charfile) * 8;
-    std::rewind(charfile);
+    auto fileBitSize = charfile.size() * 8;
 
     bool bIsResurrected = false;
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != ITEM_MARKER[0])
     {
         bIsResurrected = true; // we can only hope it is true
     }
     else
     {
-        std::fread(&value, sizeof(value), 1, charfile);
+        charfile.read(&value, sizeof(value));
         if (value != ITEM_MARKER[1])
         {
             bIsResurrected = true;  // we can only hope it is true
         }
     }
-    std::rewind(charfile);
+    charfile.rewind();
 
     // d2i items files are usually based on v1.07 - v1.14d item format, however
     // there is the rare chance you have v1.00 - v1.06 item format and more likely
@@ -2740,7 +2871,6 @@ d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::files
                 if (readItem(itemVersion, false, charfile) && verifyItemConsistency())
                 {
                     // imported successfully
-                    std::fclose(charfile);
                     return;
                 }
                 clear();
@@ -2764,7 +2894,6 @@ d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::files
                 if (readItem(itemVersion, false, charfile) && verifyItemConsistency())
                 {
                     // imported successfully
-                    std::fclose(charfile);
                     return;
                 }
                 clear();
@@ -2832,7 +2961,6 @@ d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::files
                 if (verifyItemConsistency())
                 {
                     // imported successfully
-                    std::fclose(charfile);
                     return;
                 }
             }
@@ -2848,7 +2976,6 @@ d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::files
             if (readItem(itemVersion, isExpansion, charfile) && verifyItemConsistency())
             {
                 // imported successfully
-                std::fclose(charfile);
                 return;
             }
             clear();
@@ -2857,7 +2984,7 @@ d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::files
     }
 
     // this is a more complex import as it requires us to convert
-    std::rewind(charfile);
+    charfile.rewind();
     Item convertFrom;
     auto importFromVersion = EnumItemVersion::v110;
     if (bIsResurrected)
@@ -2870,23 +2997,21 @@ d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::files
             if (!convertFrom.readItem(importFromVersion, isExpansion, charfile) && !convertFrom.verifyItemConsistency())
             {
                 // try D2R v1.0.x - v1.1.x
-                std::rewind(charfile);
+                charfile.rewind();
                 convertFrom.clear();
                 importFromVersion = EnumItemVersion::v100R;
                 if (!convertFrom.readItem(importFromVersion, isExpansion, charfile) && !convertFrom.verifyItemConsistency())
                 {
                     // failed to import
-                    std::fclose(charfile);
                     return;
                 }
             }
         }
-        std::fclose(charfile);
     }
     else if (!convertFrom.readItem(importFromVersion, isExpansion, charfile) && !convertFrom.verifyItemConsistency())
     {
         // Check for v1.00 - v1.06 item format
-        std::rewind(charfile);
+        charfile.rewind();
         convertFrom.clear();
         switch (fileBitSize)
         {
@@ -2895,7 +3020,6 @@ d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::files
             if (!convertFrom.readItem(importFromVersion, false, charfile) && !convertFrom.verifyItemConsistency())
             {
                 // failed to import
-                std::fclose(charfile);
                 return;
             }
             break;
@@ -2907,18 +3031,15 @@ d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::files
             if (!convertFrom.readItem(importFromVersion, false, charfile) && !convertFrom.verifyItemConsistency())
             {
                 // failed to import
-                std::fclose(charfile);
                 return;
             }
             break;
 
         default:
             // failed to import
-            std::fclose(charfile);
             return;
         }
     }
-    std::fclose(charfile);
 
     // convert to json first
     Json::Value itemRoot;
@@ -3029,16 +3150,15 @@ d2ce::Item::Item(EnumItemVersion itemVersion, bool isExpansion, const std::files
     }
 }
 //---------------------------------------------------------------------------
-bool d2ce::Item::writeItem(std::FILE* charfile) const
+bool d2ce::Item::writeItem(BitSink& charfile) const
 {
     if (data.empty())
     {
         return true;
     }
 
-    if (std::fwrite(&data[0], data.size(), 1, charfile) != 1)
+    if (charfile.write(&data[0], data.size(), 1) != 1)
     {
-        std::fflush(charfile);
         return false;
     }
 
@@ -3047,12 +3167,10 @@ bool d2ce::Item::writeItem(std::FILE* charfile) const
     {
         if (!item.writeItem(charfile))
         {
-            std::fflush(charfile);
             return false;
         }
     }
 
-    std::fflush(charfile);
     return true;
 }
 //---------------------------------------------------------------------------
@@ -3071,7 +3189,7 @@ d2ce::Item& d2ce::Item::operator=(const Item& other)
     data = other.data;
     SocketedItems = other.SocketedItems;
     socketedMagicalAttributes = other.socketedMagicalAttributes;
-    cachedCombinedMagicalAttributes = other.cachedCombinedMagicalAttributes;
+    cachedCombinedProperties = other.cachedCombinedProperties;
 
     ItemVersion = other.ItemVersion;
     GameVersion = other.GameVersion;
@@ -3081,6 +3199,7 @@ d2ce::Item& d2ce::Item::operator=(const Item& other)
     item_current_socket_idx = other.item_current_socket_idx;
     magic_affixes_v100 = other.magic_affixes_v100;
     rare_affixes_v100 = other.rare_affixes_v100;
+    view = other.view;
     return *this;
 }
 d2ce::Item& d2ce::Item::operator=(Item&& other) noexcept
@@ -3095,8 +3214,8 @@ d2ce::Item& d2ce::Item::operator=(Item&& other) noexcept
     other.data.clear();
     SocketedItems.swap(other.SocketedItems);
     other.SocketedItems.clear();
-    cachedCombinedMagicalAttributes.swap(other.cachedCombinedMagicalAttributes);
-    other.cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.swap(other.cachedCombinedProperties);
+    other.cachedCombinedProperties.clear();
     ItemVersion = std::exchange(other.ItemVersion, APP_ITEM_VERSION);
     GameVersion = std::exchange(other.GameVersion, APP_ITEM_GAME_VERSION);
     bitOffsets.swap(other.bitOffsets);
@@ -3105,6 +3224,7 @@ d2ce::Item& d2ce::Item::operator=(Item&& other) noexcept
     item_current_socket_idx = std::exchange(other.item_current_socket_idx, 0);
     magic_affixes_v100 = std::exchange(other.magic_affixes_v100, MagicalCachev100());
     rare_affixes_v100 = std::exchange(other.rare_affixes_v100, RareOrCraftedCachev100());
+    view = std::exchange(other.view, ItemView());
     return *this;
 }
 //---------------------------------------------------------------------------
@@ -3113,7 +3233,13 @@ void d2ce::Item::swap(Item& other)
     std::swap(*this, other);
 }
 //---------------------------------------------------------------------------
-std::uint8_t& d2ce::Item::operator [](size_t position) const
+std::uint8_t& d2ce::Item::operator [](size_t position)
+{
+    view.clear(); // caller may write through the reference
+    return data.modify()[position];
+}
+//---------------------------------------------------------------------------
+const std::uint8_t& d2ce::Item::operator [](size_t position) const
 {
     return data[position];
 }
@@ -3139,6 +3265,7 @@ size_t d2ce::Item::getFullSize() const
 // itemsize is the number of bytes not including socketed items
 void d2ce::Item::resize(size_t itemsize)
 {
+    view.clear();
     data.resize(itemsize);
 }
 //---------------------------------------------------------------------------
@@ -3155,6 +3282,7 @@ void d2ce::Item::clear()
 //---------------------------------------------------------------------------
 void d2ce::Item::push_back(const std::uint8_t& value)
 {
+    view.clear();
     data.push_back(value);
 }
 //---------------------------------------------------------------------------
@@ -3190,6 +3318,7 @@ bool d2ce::Item::isExpansionGame() const
 //---------------------------------------------------------------------------
 bool d2ce::Item::setLocation(EnumItemLocation locationId, EnumAltItemLocation altPositionId, std::uint16_t positionX, std::uint16_t positionY)
 {
+    ViewUpdate viewUpdate(*this);
     switch (locationId)
     {
     case EnumItemLocation::STORED:
@@ -3219,6 +3348,7 @@ bool d2ce::Item::setLocation(EnumItemLocation locationId, EnumAltItemLocation al
 //---------------------------------------------------------------------------
 bool d2ce::Item::setLocation(EnumItemLocation locationId, std::uint16_t positionX, std::uint16_t positionY)
 {
+    ViewUpdate viewUpdate(*this);
     switch (locationId)
     {
     case EnumItemLocation::BELT:
@@ -3238,6 +3368,7 @@ bool d2ce::Item::setLocation(EnumItemLocation locationId, std::uint16_t position
 //---------------------------------------------------------------------------
 bool d2ce::Item::setLocation(EnumAltItemLocation altPositionId, std::uint16_t positionX, std::uint16_t positionY)
 {
+    ViewUpdate viewUpdate(*this);
     switch (altPositionId)
     {
     case EnumAltItemLocation::UNKNOWN:
@@ -3258,6 +3389,7 @@ bool d2ce::Item::setLocation(EnumAltItemLocation altPositionId, std::uint16_t po
 //---------------------------------------------------------------------------
 bool d2ce::Item::setLocation(EnumEquippedId equippedId)
 {
+    ViewUpdate viewUpdate(*this);
     if (equippedId == EnumEquippedId::NONE)
     {
         // invalid state
@@ -3275,6 +3407,7 @@ bool d2ce::Item::setLocation(EnumEquippedId equippedId)
 //---------------------------------------------------------------------------
 bool d2ce::Item::setLocation(EnumItemLocation locationId, EnumAltItemLocation altPositionId, EnumEquippedId equippedId, std::uint16_t positionX, std::uint16_t positionY)
 {
+    ViewUpdate viewUpdate(*this);
     switch (locationId)
     {
     case EnumItemLocation::STORED:
@@ -4421,6 +4554,7 @@ bool d2ce::Item::setLocation(EnumItemLocation locationId, EnumAltItemLocation al
 //---------------------------------------------------------------------------
 void d2ce::Item::verifyRuneword()
 {
+    ViewUpdate viewUpdate(*this);
     if (!isSocketed() || !isExpansionGame())
     {
         return;
@@ -4464,7 +4598,6 @@ void d2ce::Item::verifyRuneword()
             // make copy of original incase of failure
             size_t diff = 0;
             d2ce::Item origItem(*this);
-            const auto& origData = origItem.data;
 
             randomizeId(); // change the item Id as we are making a new runeword
             if (isRuneword() && (GET_BIT_OFFSET(ItemOffsets::RUNEWORD_ID_BIT_OFFSET) != 0))
@@ -4491,42 +4624,20 @@ void d2ce::Item::verifyRuneword()
             else
             {
                 // Complex change, add runeword id
-                // resize to fit socket count
-                auto old_item_end_bit_offset = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET);
+                // make room for the runeword id
                 diff = RUNEWORD_ID_NUM_BITS + RUNEWORD_PADDING_NUM_BITS;
-                GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += diff;
-                size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-                data.resize(newSize, 0);
-
-                // Locate position for runeword id
                 size_t current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_ID_BIT_OFFSET_MARKER);
-                size_t old_current_bit_offset = current_bit_offset;
-                size_t bitsToCopy = old_item_end_bit_offset - old_current_bit_offset;
+                if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), std::int64_t(diff)))
+                {
+                    swap(origItem);
+                    return;
+                }
+                GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += diff;
 
                 // Set item as having a runeword id
                 updateBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_RUNEWORD_FLAG_OFFSET, 1, 1);
                 GET_BIT_OFFSET(ItemOffsets::RUNEWORD_ID_BIT_OFFSET) = current_bit_offset;
-                updateBitsEx(current_bit_offset, diff, runeword.id);
-
-                // now copy the remaining bits
-                std::uint32_t value = 0;
-                size_t valueBitSize = sizeof(value) * 8;
-                std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-                while (bitsToCopy > 0)
-                {
-                    bitsToCopy -= bits;
-                    value = readtemp_bits(origData, old_current_bit_offset, bits);
-                    old_current_bit_offset += bits;
-                    updateBitsEx(current_bit_offset, bits, value);
-                    bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-                }
-
-                // clear any bits not written to
-                if ((current_bit_offset % 8) > 0)
-                {
-                    bits = (std::uint8_t)(8 - (current_bit_offset % 8));
-                    updateBitsEx(current_bit_offset, bits, 0);
-                }
+                updateBits(current_bit_offset, diff, runeword.id);
 
                 updateOffset(GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_ID_BIT_OFFSET_MARKER), diff);
                 GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_PROPS_BIT_OFFSET_MARKER) = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET);
@@ -4545,12 +4656,12 @@ void d2ce::Item::verifyRuneword()
             size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
             data.resize(newSize, 0);
 
-            cachedCombinedMagicalAttributes.clear();
+            cachedCombinedProperties.clear();
             return;
         }
     }
 
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     if (!isRuneword())
     {
         return;
@@ -4560,35 +4671,15 @@ void d2ce::Item::verifyRuneword()
     randomizeId(); // change the item Id as we are removing a runeword
     GET_BIT_OFFSET(ItemOffsets::RUNEWORD_PROPS_BIT_OFFSET) = 0;
 
-    // truncate data
+    // remove the runeword id and truncate the runeword bonus properties
     size_t current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_ID_BIT_OFFSET_MARKER);
-    size_t old_current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::PERSONALIZED_BIT_OFFSET_MARKER);
-    size_t diff = old_current_bit_offset - current_bit_offset;
-    size_t bitsToCopy = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_PROPS_BIT_OFFSET_MARKER) - old_current_bit_offset;
-
-    std::uint32_t value = 0;
-    size_t valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
-    {
-        bitsToCopy -= bits;
-        value = readBits(old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    }
-
-    // clear any bits not written to
-    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) = current_bit_offset;
-    if ((current_bit_offset % 8) > 0)
+    size_t diff = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::PERSONALIZED_BIT_OFFSET_MARKER) - current_bit_offset;
+    size_t old_item_end_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_PROPS_BIT_OFFSET_MARKER);
+    if (!spliceBits(current_bit_offset, old_item_end_bit_offset, -std::int64_t(diff)))
     {
-        bits = (std::uint8_t)(8 - (current_bit_offset % 8));
-        updateBitsEx(current_bit_offset, bits, 0);
+        return;
     }
-
-    // truncate data
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
+    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) = old_item_end_bit_offset - diff;
 
     // Set item as not having a runeword id
     GET_BIT_OFFSET(ItemOffsets::SOCKET_COUNT_BIT_OFFSET) = 0;
@@ -4600,12 +4691,13 @@ void d2ce::Item::verifyRuneword()
 //---------------------------------------------------------------------------
 void d2ce::Item::updateSocketedItemCount()
 {
+    ViewUpdate viewUpdate(*this);
     if (!isSocketed())
     {
         return;
     }
 
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     if (GET_BIT_OFFSET(ItemOffsets::NR_OF_ITEMS_IN_SOCKETS_OFFSET) == 0)
     {
         switch (getVersion())
@@ -4649,6 +4741,7 @@ void d2ce::Item::updateSocketedItemCount()
 //---------------------------------------------------------------------------
 void d2ce::Item::updateOffset(size_t& startOffset, ptrdiff_t diff)
 {
+    view.clear();
     bool bFoundMatch = false;
     auto offsetIdx = ItemOffsets::START_BIT_OFFSET;
     auto iter = g_markerOffsets.end();
@@ -4707,14 +4800,94 @@ void d2ce::Item::calculateChecksum(long& checksum, std::uint8_t& overflow)
     }
 }
 //---------------------------------------------------------------------------
+bool d2ce::Item::hasViewField(ItemView::Field field) const
+{
+    // the item tables were reloaded since, ItemType references are no longer valid
+    return view.has(field) && (view.Generation == ItemHelpers::getItemDataGeneration());
+}
+//---------------------------------------------------------------------------
+void d2ce::Item::refreshView()
+{
+    auto generation = ItemHelpers::getItemDataGeneration();
+    if ((view.Fields == ItemView::ALL) && (view.Generation == generation))
+    {
+        // the bits have not changed
+        return;
+    }
+
+    view.clear();
+
+    // while reading, the bit offsets are still being filled in
+    if (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) == 0)
+    {
+        return;
+    }
+
+    // each field is marked as soon as it is decoded, the later fields decode using it
+    view.Generation = generation;
+    view.Flags = decodeFlags();
+    view.Fields |= ItemView::FLAGS;
+    view.IsSimple = decodeSimpleItem();
+    view.Fields |= ItemView::SIMPLE;
+    view.Location = decodeLocation();
+    view.Fields |= ItemView::LOCATION;
+    view.EquippedId = decodeEquippedId();
+    view.Fields |= ItemView::EQUIPPED_ID;
+    view.PositionX = decodePositionX();
+    view.Fields |= ItemView::POSITION_X;
+    view.PositionY = decodePositionY();
+    view.Fields |= ItemView::POSITION_Y;
+    view.AltPositionId = decodeAltPositionId();
+    view.Fields |= ItemView::ALT_POSITION_ID;
+    view.HasCode = decodeItemCode(view.Code);
+    view.Fields |= ItemView::CODE;
+    view.Type = &decodeItemTypeHelper();
+    view.Fields |= ItemView::ITEM_TYPE;
+    view.Quality = decodeQuality();
+    view.Fields |= ItemView::QUALITY;
+    view.Level = decodeLevel();
+    view.Fields |= ItemView::LEVEL;
+    view.Id = decodeId();
+    view.Fields |= ItemView::ID;
+    view.SocketCount = decodeSocketCount();
+    view.Fields |= ItemView::SOCKET_COUNT;
+    view.SocketedItemCount = decodeSocketedItemCount();
+    view.Fields |= ItemView::SOCKETED_ITEM_COUNT;
+}
+//---------------------------------------------------------------------------
+bool d2ce::Item::getFlag(std::uint32_t flagOffset) const
+{
+    auto flags = hasViewField(ItemView::FLAGS) ? view.Flags : decodeFlags();
+    return (flags & (1ui32 << flagOffset)) != 0 ? true : false;
+}
+//---------------------------------------------------------------------------
+std::uint32_t d2ce::Item::decodeFlags() const
+{
+    size_t start = GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET);
+    size_t numBits = data.size() * 8;
+    if (start >= numBits)
+    {
+        return 0;
+    }
+
+    auto flags = readBits(start, 32);
+    if ((numBits - start) < 32)
+    {
+        // bits past the end of a partially read item are unset
+        flags &= (1ui32 << (numBits - start)) - 1;
+    }
+
+    return flags;
+}
+//---------------------------------------------------------------------------
 bool d2ce::Item::isIdentified() const
 {
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_IDENTIFIED_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_IDENTIFIED_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::isDisabled() const
 {
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_DISABLED_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_DISABLED_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::isSocketed() const
@@ -4724,33 +4897,43 @@ bool d2ce::Item::isSocketed() const
         return false;
     }
 
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_SOCKETED_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_SOCKETED_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::isNew() const
 {
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_NEW_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_NEW_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::isBadEquipped() const
 {
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_BAD_EQUIPPED_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_BAD_EQUIPPED_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::isEar() const
 {
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_EAR_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_EAR_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::isStarterItem() const
 {
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_STARTER_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_STARTER_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 /*
    Returns true if this item is a simple item (i.e. 14 byte item)
 */
 bool d2ce::Item::isSimpleItem() const
+{
+    if (hasViewField(ItemView::SIMPLE))
+    {
+        return view.IsSimple;
+    }
+
+    return decodeSimpleItem();
+}
+//---------------------------------------------------------------------------
+bool d2ce::Item::decodeSimpleItem() const
 {
     if (getVersion() == EnumItemVersion::v100)
     {
@@ -4769,12 +4952,12 @@ bool d2ce::Item::isSimpleItem() const
         return false;
     }
 
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_SIMPLE_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_SIMPLE_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::isEthereal() const
 {
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_ETHEREAL_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_ETHEREAL_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::isPersonalized() const
@@ -4785,7 +4968,7 @@ bool d2ce::Item::isPersonalized() const
         return false;
     }
 
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_PERSONALIZED_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_PERSONALIZED_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::isRuneword() const
@@ -4796,10 +4979,20 @@ bool d2ce::Item::isRuneword() const
         return false;
     }
 
-    return readBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_RUNEWORD_FLAG_OFFSET, 1) != 0 ? true : false;
+    return getFlag(IS_RUNEWORD_FLAG_OFFSET);
 }
 //---------------------------------------------------------------------------
 d2ce::EnumItemLocation d2ce::Item::getLocation() const
+{
+    if (hasViewField(ItemView::LOCATION))
+    {
+        return view.Location;
+    }
+
+    return decodeLocation();
+}
+//---------------------------------------------------------------------------
+d2ce::EnumItemLocation d2ce::Item::decodeLocation() const
 {
     std::uint8_t loc = 0;
     std::uint16_t loc16 = 0;
@@ -4908,6 +5101,16 @@ d2ce::EnumItemLocation d2ce::Item::getLocation() const
 }
 //---------------------------------------------------------------------------
 d2ce::EnumEquippedId d2ce::Item::getEquippedId() const
+{
+    if (hasViewField(ItemView::EQUIPPED_ID))
+    {
+        return view.EquippedId;
+    }
+
+    return decodeEquippedId();
+}
+//---------------------------------------------------------------------------
+d2ce::EnumEquippedId d2ce::Item::decodeEquippedId() const
 {
     if (GET_BIT_OFFSET(ItemOffsets::EQUIPPED_ID_OFFSET) == 0)
     {
@@ -4924,6 +5127,16 @@ d2ce::EnumEquippedId d2ce::Item::getEquippedId() const
 }
 //---------------------------------------------------------------------------
 std::uint8_t d2ce::Item::getPositionX() const
+{
+    if (hasViewField(ItemView::POSITION_X))
+    {
+        return view.PositionX;
+    }
+
+    return decodePositionX();
+}
+//---------------------------------------------------------------------------
+std::uint8_t d2ce::Item::decodePositionX() const
 {
     switch (getVersion())
     {
@@ -4958,6 +5171,16 @@ std::uint8_t d2ce::Item::getPositionX() const
 }
 //---------------------------------------------------------------------------
 std::uint8_t d2ce::Item::getPositionY() const
+{
+    if (hasViewField(ItemView::POSITION_Y))
+    {
+        return view.PositionY;
+    }
+
+    return decodePositionY();
+}
+//---------------------------------------------------------------------------
+std::uint8_t d2ce::Item::decodePositionY() const
 {
     switch (getVersion())
     {
@@ -4990,6 +5213,16 @@ std::uint8_t d2ce::Item::getPositionY() const
 }
 //---------------------------------------------------------------------------
 d2ce::EnumAltItemLocation d2ce::Item::getAltPositionId() const
+{
+    if (hasViewField(ItemView::ALT_POSITION_ID))
+    {
+        return view.AltPositionId;
+    }
+
+    return decodeAltPositionId();
+}
+//---------------------------------------------------------------------------
+d2ce::EnumAltItemLocation d2ce::Item::decodeAltPositionId() const
 {
     std::uint8_t loc = 0;
     std::uint16_t loc16 = 0;
@@ -5120,6 +5353,16 @@ d2ce::EnumAltItemLocation d2ce::Item::getAltPositionId() const
 }
 //---------------------------------------------------------------------------
 const d2ce::ItemType& d2ce::Item::getItemTypeHelper() const
+{
+    if (hasViewField(ItemView::ITEM_TYPE))
+    {
+        return *view.Type;
+    }
+
+    return decodeItemTypeHelper();
+}
+//---------------------------------------------------------------------------
+const d2ce::ItemType& d2ce::Item::decodeItemTypeHelper() const
 {
     std::array<std::uint8_t, 4> strcode = { 0, 0, 0, 0 };
     if (!getItemCode(strcode))
@@ -5172,6 +5415,17 @@ const d2ce::ItemType& d2ce::Item::getItemTypeHelper() const
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::getItemCode(std::array<std::uint8_t, 4>& strcode) const
+{
+    if (hasViewField(ItemView::CODE))
+    {
+        strcode = view.Code;
+        return view.HasCode;
+    }
+
+    return decodeItemCode(strcode);
+}
+//---------------------------------------------------------------------------
+bool d2ce::Item::decodeItemCode(std::array<std::uint8_t, 4>& strcode) const
 {
     strcode.fill(0);
     if (GET_BIT_OFFSET(ItemOffsets::TYPE_CODE_OFFSET) == 0)
@@ -5205,7 +5459,7 @@ bool d2ce::Item::getItemCode(std::array<std::uint8_t, 4>& strcode) const
     case EnumItemVersion::v120:  // v1.2.x - v1.3.x Diablo II: Resurrected Patch 2.4 item
     case EnumItemVersion::v140:  // v1.4.x+ Diablo II: Resurrected Patch 2.5 item
     default:
-        ItemHelpers::getResurrectedItemCode(data, GET_BIT_OFFSET(ItemOffsets::TYPE_CODE_OFFSET), strcode);
+        ItemHelpers::getResurrectedItemCode(data.bytes(), GET_BIT_OFFSET(ItemOffsets::TYPE_CODE_OFFSET), strcode);
         return true;
     }
 }
@@ -5248,6 +5502,7 @@ std::uint8_t d2ce::Item::getGemApplyType() const
 //---------------------------------------------------------------------------
 bool d2ce::Item::updateGem(const std::array<std::uint8_t, 4>& newgem)
 {
+    ViewUpdate viewUpdate(*this);
     if (isEar())
     {
         return false;
@@ -5350,6 +5605,7 @@ bool d2ce::Item::updateGem(const std::array<std::uint8_t, 4>& newgem)
 */
 bool d2ce::Item::upgradeGem()
 {
+    ViewUpdate viewUpdate(*this);
     std::array<std::uint8_t, 4> strcode = { 0, 0, 0, 0 };
     std::uint8_t& gem = strcode[0];
     std::uint8_t& gemcondition = strcode[1];
@@ -5420,6 +5676,7 @@ bool d2ce::Item::upgradeGem()
 */
 bool d2ce::Item::upgradePotion()
 {
+    ViewUpdate viewUpdate(*this);
     std::array<std::uint8_t, 4> strcode = { 0, 0, 0, 0 };
     std::uint8_t& gem = strcode[0];
     std::uint8_t& gemcondition = strcode[1];
@@ -5499,6 +5756,7 @@ bool d2ce::Item::upgradePotion()
 */
 bool d2ce::Item::upgradeToFullRejuvenationPotion()
 {
+    ViewUpdate viewUpdate(*this);
     std::array<std::uint8_t, 4> strcode = { 0, 0, 0, 0 };
     std::uint8_t& gem = strcode[0];
     std::uint8_t& gemcondition = strcode[1];
@@ -5633,6 +5891,7 @@ bool d2ce::Item::getEarAttributes(d2ce::EarAttributes& attrib) const
 //---------------------------------------------------------------------------
 bool d2ce::Item::setEarAttributes(const d2ce::EarAttributes& attrib)
 {
+    ViewUpdate viewUpdate(*this);
     if (!isEar())
     {
         return false;
@@ -5997,6 +6256,16 @@ std::string d2ce::Item::getTransformColor() const
 }
 //---------------------------------------------------------------------------
 std::uint32_t d2ce::Item::getId() const
+{
+    if (hasViewField(ItemView::ID))
+    {
+        return view.Id;
+    }
+
+    return decodeId();
+}
+//---------------------------------------------------------------------------
+std::uint32_t d2ce::Item::decodeId() const
 {
     if (isSimpleItem())
     {
@@ -6067,6 +6336,7 @@ std::uint32_t d2ce::Item::getDWBCode() const
 //---------------------------------------------------------------------------
 bool d2ce::Item::setDWBCode(std::uint32_t dwb)
 {
+    ViewUpdate viewUpdate(*this);
     switch (getVersion())
     {
     case EnumItemVersion::v100: // v1.00 - v1.03 item
@@ -6092,7 +6362,7 @@ bool d2ce::Item::setDWBCode(std::uint32_t dwb)
         dwb = ItemHelpers::generarateRandomDW();
     }
 
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     magic_affixes_v100.clear();
     rare_affixes_v100.clear();
 
@@ -6107,6 +6377,7 @@ bool d2ce::Item::setDWBCode(std::uint32_t dwb)
 //---------------------------------------------------------------------------
 bool d2ce::Item::randomizeId()
 {
+    ViewUpdate viewUpdate(*this);
     if (isSimpleItem() || (getVersion() < EnumItemVersion::v107))
     {
         return false;
@@ -6137,6 +6408,16 @@ bool d2ce::Item::randomizeId()
 }
 //---------------------------------------------------------------------------
 std::uint8_t d2ce::Item::getLevel() const
+{
+    if (hasViewField(ItemView::LEVEL))
+    {
+        return view.Level;
+    }
+
+    return decodeLevel();
+}
+//---------------------------------------------------------------------------
+std::uint8_t d2ce::Item::decodeLevel() const
 {
     if (isSimpleItem())
     {
@@ -6188,6 +6469,16 @@ std::uint8_t d2ce::Item::getLevel() const
 }
 //---------------------------------------------------------------------------
 d2ce::EnumItemQuality d2ce::Item::getQuality() const
+{
+    if (hasViewField(ItemView::QUALITY))
+    {
+        return view.Quality;
+    }
+
+    return decodeQuality();
+}
+//---------------------------------------------------------------------------
+d2ce::EnumItemQuality d2ce::Item::decodeQuality() const
 {
     size_t numBits = 4;
     std::uint32_t value;
@@ -6305,6 +6596,18 @@ bool d2ce::Item::getRunewordAttributes(d2ce::RunewordAttributes& attrib) const
     return true;
 }
 //---------------------------------------------------------------------------
+bool d2ce::Item::getRunewordProperties(std::vector<ItemProperty>& props) const
+{
+    props.clear();
+    if (!isRuneword() || (GET_BIT_OFFSET(ItemOffsets::RUNEWORD_ID_BIT_OFFSET) == 0))
+    {
+        return false;
+    }
+
+    size_t current_bit_offset = GET_BIT_OFFSET(ItemOffsets::RUNEWORD_PROPS_BIT_OFFSET); // must copy value as readPropertyList will modify value
+    return readPropertyList(current_bit_offset, props);
+}
+//---------------------------------------------------------------------------
 std::string d2ce::Item::getPersonalizedName() const
 {
     if (!isPersonalized() || (GET_BIT_OFFSET(ItemOffsets::PERSONALIZED_BIT_OFFSET) == 0))
@@ -6655,50 +6958,98 @@ bool d2ce::Item::getMagicalAttributes(std::vector<MagicalAttribute>& attribs) co
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Item::getCombinedMagicalAttributes(std::vector<MagicalAttribute>& attribs) const
+bool d2ce::Item::getMagicalProperties(std::vector<ItemProperty>& props) const
 {
-    attribs.clear();
-    if (!cachedCombinedMagicalAttributes.empty())
+    props.clear();
+    switch (getVersion())
+    {
+    case EnumItemVersion::v100: // v1.00 - v1.03 item
+    case EnumItemVersion::v104: // v1.04 - v1.06 item
     {
-        attribs = cachedCombinedMagicalAttributes;
+        // not stored in a property list
+        std::vector<MagicalAttribute> attribs;
+        bool bResult = getMagicalAttributesv100(attribs);
+        AppendItemProperties(attribs, props);
+        return bResult;
+    }
+    }
+
+    if (isSimpleItem() || (GET_BIT_OFFSET(ItemOffsets::MAGICAL_PROPS_BIT_OFFSET) == 0))
+    {
+        if (!socketedMagicalAttributes.empty())
+        {
+            AppendItemProperties(socketedMagicalAttributes, props);
+            return true;
+        }
+
+        return false;
+    }
+
+    size_t current_bit_offset = GET_BIT_OFFSET(ItemOffsets::MAGICAL_PROPS_BIT_OFFSET);
+    return readPropertyList(current_bit_offset, props);
+}
+//---------------------------------------------------------------------------
+bool d2ce::Item::getCombinedMagicalProperties(std::vector<ItemProperty>& props) const
+{
+    props.clear();
+    if (!cachedCombinedProperties.empty())
+    {
+        props = cachedCombinedProperties;
         return true;
     }
 
-    std::vector<MagicalAttribute> tempAttribs;
-    if (!getMagicalAttributes(tempAttribs))
+    std::vector<ItemProperty> tempProps;
+    if (!getMagicalProperties(tempProps))
     {
         if (hasUndeadBonus())
         {
-            AddUndeadBonusMagicalAttribute(getVersion(), getGameVersion(), attribs);
+            AddUndeadBonusProperty(getVersion(), getGameVersion(), props);
         }
 
-        cachedCombinedMagicalAttributes = attribs;
-        return !attribs.empty();
+        cachedCombinedProperties = props;
+        return !props.empty();
     }
 
     std::multimap<size_t, size_t> itemIndexMap;
-    ItemHelpers::combineMagicalAttribute(itemIndexMap, tempAttribs, attribs);
+    ItemHelpers::combineMagicalAttribute(itemIndexMap, tempProps, props);
 
-    RunewordAttributes runeAttrib;
-    if (getRunewordAttributes(runeAttrib))
+    if (getRunewordProperties(tempProps))
     {
-        ItemHelpers::combineMagicalAttribute(itemIndexMap, runeAttrib.MagicalAttributes, attribs);
+        ItemHelpers::combineMagicalAttribute(itemIndexMap, tempProps, props);
     }
 
     for (const auto& item : SocketedItems)
     {
-        if (item.getMagicalAttributes(tempAttribs))
+        if (item.getMagicalProperties(tempProps))
         {
-            ItemHelpers::combineMagicalAttribute(itemIndexMap, tempAttribs, attribs);
+            ItemHelpers::combineMagicalAttribute(itemIndexMap, tempProps, props);
         }
     }
 
     if (hasUndeadBonus())
     {
-        AddUndeadBonusMagicalAttribute(getVersion(), getGameVersion(), attribs);
+        AddUndeadBonusProperty(getVersion(), getGameVersion(), props);
+    }
+
+    cachedCombinedProperties = props;
+    return true;
+}
+//---------------------------------------------------------------------------
+bool d2ce::Item::getCombinedMagicalAttributes(std::vector<MagicalAttribute>& attribs) const
+{
+    attribs.clear();
+    std::vector<ItemProperty> props;
+    if (!getCombinedMagicalProperties(props))
+    {
+        return false;
+    }
+
+    attribs.resize(props.size());
+    for (size_t i = 0; i < props.size(); ++i)
+    {
+        props[i].asMagicalAttribute(ItemHelpers::getItemStat(props[i].Version, props[i].Id), attribs[i]);
     }
 
-    cachedCombinedMagicalAttributes = attribs;
     return true;
 }
 //---------------------------------------------------------------------------
@@ -7358,13 +7709,12 @@ bool d2ce::Item::isIndestructible() const
     }
 
     // Check for magical attribute of indestructibility
-    std::vector<MagicalAttribute> magicalAttributes;
-    if (getCombinedMagicalAttributes(magicalAttributes))
+    std::vector<ItemProperty> props;
+    if (getCombinedMagicalProperties(props))
     {
-        ItemHelpers::checkForRelatedMagicalAttributes(magicalAttributes);
-        for (auto& attrib : magicalAttributes)
+        for (const auto& prop : props)
         {
-            switch (attrib.Id)
+            switch (prop.Id)
             {
             case ATTRIBUTE_ID_INDESTRUCTIBLE:
                 // Indestructible
@@ -7886,6 +8236,7 @@ std::uint32_t d2ce::Item::getMaxQuantity() const
 //---------------------------------------------------------------------------
 bool d2ce::Item::setQuantity(std::uint32_t quantity)
 {
+    ViewUpdate viewUpdate(*this);
     if (GET_BIT_OFFSET(ItemOffsets::STACKABLE_BIT_OFFSET) == 0 && GET_BIT_OFFSET(ItemOffsets::GLD_STACKABLE_BIT_OFFSET) == 0)
     {
         return false;
@@ -7948,6 +8299,7 @@ bool d2ce::Item::setQuantity(std::uint32_t quantity)
 //---------------------------------------------------------------------------
 bool d2ce::Item::setMaxQuantity()
 {
+    ViewUpdate viewUpdate(*this);
     if (!isStackable() || (GET_BIT_OFFSET(ItemOffsets::STACKABLE_BIT_OFFSET) == 0 && GET_BIT_OFFSET(ItemOffsets::GLD_STACKABLE_BIT_OFFSET) == 0))
     {
         return false;
@@ -7977,6 +8329,7 @@ std::uint16_t d2ce::Item::getDefenseRating() const
 //---------------------------------------------------------------------------
 bool d2ce::Item::setDefenseRating(std::uint16_t ac)
 {
+    ViewUpdate viewUpdate(*this);
     if (GET_BIT_OFFSET(ItemOffsets::DEFENSE_RATING_BIT_OFFSET) == 0 || ac == 0)
     {
         return false;
@@ -7995,6 +8348,7 @@ bool d2ce::Item::setDefenseRating(std::uint16_t ac)
 //---------------------------------------------------------------------------
 bool d2ce::Item::setMaxDefenseRating()
 {
+    ViewUpdate viewUpdate(*this);
     if (GET_BIT_OFFSET(ItemOffsets::DEFENSE_RATING_BIT_OFFSET) == 0)
     {
         return false;
@@ -8101,6 +8455,7 @@ bool d2ce::Item::getDurability(ItemDurability& durability) const
 //---------------------------------------------------------------------------
 bool d2ce::Item::setDurability(const ItemDurability& attrib)
 {
+    ViewUpdate viewUpdate(*this);
     if (attrib.Max == 0)
     {
         return setIndestructible();
@@ -8164,6 +8519,7 @@ bool d2ce::Item::setDurability(const ItemDurability& attrib)
 //---------------------------------------------------------------------------
 bool d2ce::Item::fixDurability()
 {
+    ViewUpdate viewUpdate(*this);
     // Stackable weapon have secret durablity that we don't fix
     ItemDurability attrib;
     if (isStackable() || isIndestructible() || !getDurability(attrib) || attrib.Max == 0)
@@ -8198,6 +8554,7 @@ bool d2ce::Item::fixDurability()
 //---------------------------------------------------------------------------
 bool d2ce::Item::setMaxDurability()
 {
+    ViewUpdate viewUpdate(*this);
     static ItemDurability maxDurability = { MAX_DURABILITY, MAX_DURABILITY };
     return setDurability(maxDurability);
 }
@@ -8303,6 +8660,7 @@ std::uint8_t d2ce::Item::getMaxSocketedCount() const
 //---------------------------------------------------------------------------
 bool d2ce::Item::addMaxSocketCount()
 {
+    ViewUpdate viewUpdate(*this);
     auto maxSockets = getMaxSocketCount();
     if (maxSockets <= getSocketCount())
     {
@@ -8315,6 +8673,7 @@ bool d2ce::Item::addMaxSocketCount()
 //---------------------------------------------------------------------------
 bool d2ce::Item::addSocket()
 {
+    ViewUpdate viewUpdate(*this);
     auto maxSockets = getMaxSocketCount();
     auto curSockets = getSocketCount();
     if (maxSockets <= curSockets)
@@ -8328,6 +8687,7 @@ bool d2ce::Item::addSocket()
 //---------------------------------------------------------------------------
 bool d2ce::Item::removeEmptySockets()
 {
+    ViewUpdate viewUpdate(*this);
     if (!isSocketed())
     {
         return false;
@@ -8346,6 +8706,7 @@ bool d2ce::Item::removeEmptySockets()
 //---------------------------------------------------------------------------
 bool d2ce::Item::removeSockets()
 {
+    ViewUpdate viewUpdate(*this);
     if (!isSocketed())
     {
         return false;
@@ -8364,6 +8725,7 @@ bool d2ce::Item::removeSockets()
 //---------------------------------------------------------------------------
 bool d2ce::Item::setSocketCount(std::uint8_t numSockets)
 {
+    ViewUpdate viewUpdate(*this);
     if (isSimpleItem())
     {
         return false;
@@ -8464,39 +8826,16 @@ bool d2ce::Item::setSocketCount(std::uint8_t numSockets)
         }
 
         // Complex change, we are removing all sockets
-        size_t old_current_bit_offset = current_bit_offset + SOCKET_COUNT_NUM_BITS;
-        auto old_item_end_bit_offset = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET);
-        size_t bitsToCopy = old_item_end_bit_offset - old_current_bit_offset;
-
-        // move bits up
-        std::uint32_t value = 0;
-        size_t valueBitSize = sizeof(value) * 8;
-        std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-        while (bitsToCopy > 0)
-        {
-            bitsToCopy -= bits;
-            value = readBits(old_current_bit_offset, bits);
-            old_current_bit_offset += bits;
-            updateBitsEx(current_bit_offset, bits, value);
-            bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-        }
-
-        // clear any bits not written to
-        if ((current_bit_offset % 8) > 0)
+        auto bitDiff = -std::int64_t(SOCKET_COUNT_NUM_BITS);
+        if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), bitDiff))
         {
-            bits = (std::uint8_t)(8 - (current_bit_offset % 8));
-            updateBitsEx(current_bit_offset, bits, 0);
+            return false;
         }
 
         // Set item as not socketed
         GET_BIT_OFFSET(ItemOffsets::SOCKET_COUNT_BIT_OFFSET) = 0;
         updateBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_SOCKETED_FLAG_OFFSET, 1, 0);
-
-        // truncate data
-        auto bitDiff = -std::int64_t(SOCKET_COUNT_NUM_BITS);
         GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += bitDiff;
-        size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-        data.resize(newSize, 0);
 
         updateOffset(GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::SOCKET_COUNT_BIT_OFFSET_MARKER), bitDiff);
         return true;
@@ -8509,44 +8848,18 @@ bool d2ce::Item::setSocketCount(std::uint8_t numSockets)
     }
 
     // not socketed already, complex change
-    // make a copy first
-    std::vector<std::uint8_t> oldData(data);
-
-    // resize to fit socket count
-    auto old_item_end_bit_offset = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET);
-    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += SOCKET_COUNT_NUM_BITS;
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
-
-    // Locate position for socket count
+    // make room for the socket count
     size_t current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::SOCKET_COUNT_BIT_OFFSET_MARKER);
-    size_t old_current_bit_offset = current_bit_offset;
-    size_t bitsToCopy = old_item_end_bit_offset - old_current_bit_offset;
+    if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), SOCKET_COUNT_NUM_BITS))
+    {
+        return false;
+    }
+    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += SOCKET_COUNT_NUM_BITS;
 
     // Set item as socketed
     updateBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_SOCKETED_FLAG_OFFSET, 1, 1);
     GET_BIT_OFFSET(ItemOffsets::SOCKET_COUNT_BIT_OFFSET) = current_bit_offset;
-    updateBitsEx(current_bit_offset, SOCKET_COUNT_NUM_BITS, numSockets);
-
-    // now copy the remaining bits
-    std::uint32_t value = 0;
-    size_t valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
-    {
-        bitsToCopy -= bits;
-        value = readtemp_bits(oldData, old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    }
-
-    // clear any bits not written to
-    if ((current_bit_offset % 8) > 0)
-    {
-        bits = (std::uint8_t)(8 - (current_bit_offset % 8));
-        updateBitsEx(current_bit_offset, bits, 0);
-    }
+    updateBits(current_bit_offset, SOCKET_COUNT_NUM_BITS, numSockets);
 
     updateOffset(GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::SOCKET_COUNT_BIT_OFFSET_MARKER), std::int64_t(SOCKET_COUNT_NUM_BITS));
     return true;
@@ -8554,6 +8867,7 @@ bool d2ce::Item::setSocketCount(std::uint8_t numSockets)
 //---------------------------------------------------------------------------
 bool d2ce::Item::addPersonalization(const std::string& name)
 {
+    ViewUpdate viewUpdate(*this);
     if (!canPersonalize() || name.empty())
     {
         return false;
@@ -8573,19 +8887,13 @@ bool d2ce::Item::addPersonalization(const std::string& name)
     strncpy_s(playerName.data(), NAME_LENGTH, curName.c_str(), numChars);
     playerName[NAME_LENGTH - 1] = 0;
 
-    // make a copy first
-    std::vector<std::uint8_t> oldData(data);
-
-    // resize to fit personalization
-    auto old_item_end_bit_offset = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET);
-    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += numberOfBitsToAdd;
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
-
-    // Locate position for personalized name
+    // make room for the personalized name
     size_t current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::PERSONALIZED_BIT_OFFSET_MARKER);
-    size_t old_current_bit_offset = current_bit_offset;
-    size_t bitsToCopy = old_item_end_bit_offset - old_current_bit_offset;
+    if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), std::int64_t(numberOfBitsToAdd)))
+    {
+        return false;
+    }
+    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += numberOfBitsToAdd;
 
     // Set item as personalized
     updateBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_PERSONALIZED_FLAG_OFFSET, 1, 1);
@@ -8601,40 +8909,17 @@ bool d2ce::Item::addPersonalization(const std::string& name)
 
         if (playerName[idx] == 0)
         {
-            for (; idx <= 15; ++idx)
-            {
-                updateBitsEx(current_bit_offset, bitSize, 0ui32);
-            }
             break;
         }
     }
 
-    // now copy the remaining bits
-    std::uint32_t value = 0;
-    size_t valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
-    {
-        bitsToCopy -= bits;
-        value = readtemp_bits(oldData, old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    }
-
-    // clear any bits not written to
-    if ((current_bit_offset % 8) > 0)
-    {
-        bits = (std::uint8_t)(8 - (current_bit_offset % 8));
-        updateBitsEx(current_bit_offset, bits, 0);
-    }
-
     updateOffset(GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::PERSONALIZED_BIT_OFFSET_MARKER), std::int64_t(numberOfBitsToAdd));
     return true;
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::removePersonalization()
 {
+    ViewUpdate viewUpdate(*this);
     if (!isPersonalized() || (GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::PERSONALIZED_BIT_OFFSET_MARKER) == 0))
     {
         return false;
@@ -8657,38 +8942,15 @@ bool d2ce::Item::removePersonalization()
         }
     }
     size_t numberOfBitsToRemove = old_current_bit_offset - current_bit_offset;
-
-    auto old_item_end_bit_offset = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET);
-    size_t bitsToCopy = old_item_end_bit_offset - old_current_bit_offset;
-
-    // move bits up
-    std::uint32_t value = 0;
-    size_t valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
-    {
-        bitsToCopy -= bits;
-        value = readBits(old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    }
-
-    // clear any bits not written to
-    if ((current_bit_offset % 8) > 0)
+    if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), -std::int64_t(numberOfBitsToRemove)))
     {
-        bits = (std::uint8_t)(8 - (current_bit_offset % 8));
-        updateBitsEx(current_bit_offset, bits, 0);
+        return false;
     }
 
     // Set item as not personlized
     GET_BIT_OFFSET(ItemOffsets::PERSONALIZED_BIT_OFFSET) = 0;
     updateBits(GET_BIT_OFFSET(ItemOffsets::START_BIT_OFFSET) + IS_PERSONALIZED_FLAG_OFFSET, 1, 0);
-
-    // truncate data
     GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) -= numberOfBitsToRemove;
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
 
     updateOffset(GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::PERSONALIZED_BIT_OFFSET_MARKER), -std::int64_t(numberOfBitsToRemove));
     return true;
@@ -8696,6 +8958,7 @@ bool d2ce::Item::removePersonalization()
 //---------------------------------------------------------------------------
 bool d2ce::Item::setIndestructible()
 {
+    ViewUpdate viewUpdate(*this);
     // Stackable weapon have secret durablity that we don't fix
     if (isSimpleItem() || isStackable() || isIndestructible() || isEthereal() || (GET_BIT_OFFSET(ItemOffsets::DURABILITY_BIT_OFFSET) == 0))
     {
@@ -8703,18 +8966,18 @@ bool d2ce::Item::setIndestructible()
     }
 
     size_t current_bit_offset = GET_BIT_OFFSET(ItemOffsets::MAGICAL_PROPS_BIT_OFFSET);
-    std::vector<MagicalAttribute> attribs;
+    std::vector<ItemProperty> props;
     if (isExpansionGame())
     {
         // Indestructible magical property only exists for Expansion
-        if (!readPropertyList(current_bit_offset, attribs))
+        if (!readPropertyList(current_bit_offset, props))
         {
             // coruption
             return false;
         }
     }
 
-    if (attribs.empty())
+    if (props.empty())
     {
         // Indestructible without the need for the magical attribute of indestructibility
         if (readBits(GET_BIT_OFFSET(ItemOffsets::DURABILITY_BIT_OFFSET), DURABILITY_MAX_NUM_BITS) == 0)
@@ -8726,42 +8989,20 @@ bool d2ce::Item::setIndestructible()
         current_bit_offset = GET_BIT_OFFSET(ItemOffsets::DURABILITY_BIT_OFFSET);
         updateBitsEx(current_bit_offset, DURABILITY_MAX_NUM_BITS, 0);
 
-        size_t old_current_bit_offset = current_bit_offset + ((ItemVersion >= EnumItemVersion::v110) ? DURABILITY_CURRENT_NUM_BITS : DURABILITY_CURRENT_NUM_BITS_108);
-        auto old_item_end_bit_offset = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET);
-        size_t bitsToCopy = old_item_end_bit_offset - old_current_bit_offset;
-        size_t numberOfBitsToRemove = old_current_bit_offset - current_bit_offset;
-
-        // move bits up
-        std::uint32_t value = 0;
-        size_t valueBitSize = sizeof(value) * 8;
-        std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-        while (bitsToCopy > 0)
-        {
-            bitsToCopy -= bits;
-            value = readBits(old_current_bit_offset, bits);
-            old_current_bit_offset += bits;
-            updateBitsEx(current_bit_offset, bits, value);
-            bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-        }
-
-        // clear any bits not written to
-        if ((current_bit_offset % 8) > 0)
+        // current durability is not stored when the max durability is 0
+        size_t numberOfBitsToRemove = (ItemVersion >= EnumItemVersion::v110) ? DURABILITY_CURRENT_NUM_BITS : DURABILITY_CURRENT_NUM_BITS_108;
+        if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), -std::int64_t(numberOfBitsToRemove)))
         {
-            bits = (std::uint8_t)(8 - (current_bit_offset % 8));
-            updateBitsEx(current_bit_offset, bits, 0);
+            return false;
         }
-
-        // truncate data
         GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) -= numberOfBitsToRemove;
-        size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-        data.resize(newSize, 0);
 
         updateOffset(GET_BIT_OFFSET(ItemOffsets::DURABILITY_BIT_OFFSET), -std::int64_t(numberOfBitsToRemove));
         return true;
     }
 
     // go back before end of list
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     current_bit_offset -= PROPERTY_ID_NUM_BITS;
     size_t old_current_bit_offset = current_bit_offset;
     size_t numberOfBitsToAdd = PROPERTY_ID_NUM_BITS + 1;
@@ -8780,46 +9021,25 @@ bool d2ce::Item::setIndestructible()
         return false;
     }
 
-    // make a copy first
-    std::vector<std::uint8_t> oldData(data);
-
-    // resize to fit new magical attribute
+    // make room for the new magical attribute
     auto old_item_end_bit_offset = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET);
+    if (!spliceBits(current_bit_offset, old_item_end_bit_offset, std::int64_t(numberOfBitsToAdd)))
+    {
+        return false;
+    }
     GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += numberOfBitsToAdd;
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
 
     // add indestructible attribute
     updateBitsEx(current_bit_offset, PROPERTY_ID_NUM_BITS, id);
     updateBitsEx(current_bit_offset, 1, 1);
 
-    // now copy the remaining bits
-    size_t bitsToCopy = old_item_end_bit_offset - old_current_bit_offset;
-    std::uint32_t value = 0;
-    size_t valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
-    {
-        bitsToCopy -= bits;
-        value = readtemp_bits(oldData, old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    }
-
-    // clear any bits not written to
-    if ((current_bit_offset % 8) > 0)
-    {
-        bits = (std::uint8_t)(8 - (current_bit_offset % 8));
-        updateBitsEx(current_bit_offset, bits, 0);
-    }
-
-    updateOffset(old_current_bit_offset, std::int64_t(numberOfBitsToAdd));
+    updateOffset(old_item_end_bit_offset, std::int64_t(numberOfBitsToAdd));
     return true;
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::upgradeTier(const CharStats& cs)
 {
+    ViewUpdate viewUpdate(*this);
     const auto& itemType = getItemTypeHelper();
     if (&itemType == &ItemHelpers::getInvalidItemTypeHelper())
     {
@@ -8998,7 +9218,7 @@ bool d2ce::Item::upgradeTier(const CharStats& cs)
         }
     }
 
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     return true;
 }
 //---------------------------------------------------------------------------
@@ -9202,6 +9422,7 @@ bool d2ce::Item::canSocketItem(const d2ce::Item& socketFiller, std::uint32_t lev
 //---------------------------------------------------------------------------
 bool d2ce::Item::removeSocketedItems()
 {
+    ViewUpdate viewUpdate(*this);
     if (SocketedItems.empty())
     {
         return true;
@@ -9225,6 +9446,7 @@ std::vector<d2ce::RunewordType> d2ce::Item::getPossibleRunewords(std::uint32_t l
 //---------------------------------------------------------------------------
 bool d2ce::Item::setRuneword(std::uint16_t id)
 {
+    ViewUpdate viewUpdate(*this);
     std::vector<d2ce::RunewordType> result;
     switch (getQuality())
     {
@@ -9366,7 +9588,7 @@ bool d2ce::Item::setRuneword(std::uint16_t id)
     for (const auto& runeCode : runeword.runeCodes)
     {
         strcode = ItemCodeStringConverter(runeCode);
-        std::list<Item> runeItems;
+        ItemList runeItems;
         ItemCreateParams createParams(version, strcode, isExpansion);
         runeItems.push_back(Item(createParams));
         auto iter = runeItems.begin();
@@ -9390,7 +9612,7 @@ bool d2ce::Item::setRuneword(std::uint16_t id)
         updateSocketedItemCount();
     }
 
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     verifyRuneword();
 
     if (!isRuneword())
@@ -9416,6 +9638,7 @@ bool d2ce::Item::setRuneword(std::uint16_t id)
 //---------------------------------------------------------------------------
 bool d2ce::Item::setRunewordPropertyList(const std::vector<MagicalAttribute>& attribs)
 {
+    ViewUpdate viewUpdate(*this);
     if (attribs.empty() || !isRuneword() || (GET_BIT_OFFSET(ItemOffsets::RUNEWORD_ID_BIT_OFFSET) == 0))
     {
         return false;
@@ -9447,7 +9670,7 @@ bool d2ce::Item::setRunewordPropertyList(const std::vector<MagicalAttribute>& at
     newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
     data.resize(newSize, 0);
 
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     return true;
 }
 //---------------------------------------------------------------------------
@@ -9475,6 +9698,7 @@ bool d2ce::Item::getPossibleCraftingRecipies(std::vector<CraftRecipieType>& attr
 //---------------------------------------------------------------------------
 bool d2ce::Item::setMagicalAffixes(const d2ce::MagicalAffixes& affixes)
 {
+    ViewUpdate viewUpdate(*this);
     if (!affixes.isValid() || isSimpleItem() || (isSocketFiller() && !isJewel()) || (affixes.PrefixId == 0 && affixes.SuffixId == 0))
     {
         return false;
@@ -9707,7 +9931,6 @@ bool d2ce::Item::setMagicalAffixesSimple(const d2ce::MagicalAffixes& affixes)
     // make a copy first
     size_t diff = 0;
     d2ce::Item origItem(*this);
-    const auto& origData = origItem.data;
 
     auto numSockets = getSocketCount();
     auto origNumSockets = numSockets;
@@ -9785,13 +10008,13 @@ bool d2ce::Item::setMagicalAffixesSimple(const d2ce::MagicalAffixes& affixes)
         // make room for affixes
         diff = MAGICAL_AFFIX_NUM_BITS * 2;
         current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER);
-        size_t old_current_bit_offset = current_bit_offset;
-        size_t bitsToCopy = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) - old_current_bit_offset;
+        if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), std::int64_t(diff)))
+        {
+            swap(origItem);
+            return false;
+        }
         GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += diff; // add new attribs
 
-        size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-        data.resize(newSize, 0);
-
         // update affixes
         value = affixes.PrefixId;
         if (!updateBitsEx(current_bit_offset, MAGICAL_AFFIX_NUM_BITS, value))
@@ -9808,19 +10031,6 @@ bool d2ce::Item::setMagicalAffixesSimple(const d2ce::MagicalAffixes& affixes)
         }
 
         GET_BIT_OFFSET(ItemOffsets::QUALITY_ATTRIB_BIT_OFFSET) = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER);
-
-        // now copy the remaining bits
-        size_t valueBitSize = sizeof(value) * 8;
-        std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-        while (bitsToCopy > 0)
-        {
-            bitsToCopy -= bits;
-            value = readtemp_bits(origData, old_current_bit_offset, bits);
-            old_current_bit_offset += bits;
-            updateBitsEx(current_bit_offset, bits, value);
-            bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-        }
-
         updateOffset(GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER), diff);
     }
 
@@ -9849,7 +10059,7 @@ bool d2ce::Item::setMagicalAffixesSimple(const d2ce::MagicalAffixes& affixes)
     }
 
     fixDurability();
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     magic_affixes_v100.clear();
     rare_affixes_v100.clear();
     return true;
@@ -9857,6 +10067,7 @@ bool d2ce::Item::setMagicalAffixesSimple(const d2ce::MagicalAffixes& affixes)
 //---------------------------------------------------------------------------
 bool d2ce::Item::setMagicalPropertyList(const std::vector<MagicalAttribute>& attribs)
 {
+    ViewUpdate viewUpdate(*this);
     if (attribs.empty() || isSimpleItem() || (isSocketFiller() && !isJewel()) || (ItemVersion < EnumItemVersion::v107))
     {
         return false;
@@ -9873,48 +10084,34 @@ bool d2ce::Item::setMagicalPropertyList(const std::vector<MagicalAttribute>& att
         break;
     }
 
-    // make a copy first
-    d2ce::Item origItem(*this);
-    const auto& origData = origItem.data;
-
-    size_t old_current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::SET_BONUS_PROPS_BIT_OFFSET_MARKER);
-    size_t bitsToCopy = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) - GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::SET_BONUS_PROPS_BIT_OFFSET_MARKER);
+    // encode the new list first, the item is untouched if it fails
+    ItemBytes listData;
+    size_t listNumBits = 0;
+    if (!encodePropertyList(attribs, listData, listNumBits))
+    {
+        return false;
+    }
 
     // write out new data
+    size_t bitsToCopy = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) - GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::SET_BONUS_PROPS_BIT_OFFSET_MARKER);
     size_t old_magic_bit_offset = GET_BIT_OFFSET(ItemOffsets::MAGICAL_PROPS_BIT_OFFSET);
     size_t current_bit_offset = old_magic_bit_offset;
-    if (!updatePropertyList(current_bit_offset, attribs))
+    if (!replaceBits(current_bit_offset, GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::SET_BONUS_PROPS_BIT_OFFSET_MARKER), listData, listNumBits))
     {
-        swap(origItem);
         return false;
     }
 
     ptrdiff_t diff = ptrdiff_t(current_bit_offset) - ptrdiff_t(old_magic_bit_offset);
     GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) = current_bit_offset + bitsToCopy;
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
-
-    // now copy the remaining bits
-    std::uint32_t value = 0;
-    size_t valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
-    {
-        bitsToCopy -= bits;
-        value = readtemp_bits(origData, old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    }
-
     updateOffset(GET_BIT_OFFSET(ItemOffsets::MAGICAL_PROPS_BIT_OFFSET), diff);
 
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     return true;
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::setSetBonusPropertyLists(const std::vector<std::vector<MagicalAttribute>>& attribs)
 {
+    ViewUpdate viewUpdate(*this);
     if (attribs.empty() || (GET_BIT_OFFSET(ItemOffsets::BONUS_BITS_BIT_OFFSET) == 0) || 
         (GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::SET_BONUS_PROPS_BIT_OFFSET_MARKER) == 0) ||
         (ItemVersion < EnumItemVersion::v107))
@@ -9951,48 +10148,32 @@ bool d2ce::Item::setSetBonusPropertyLists(const std::vector<std::vector<MagicalA
     }
 
 
-    // make a copy first
-    d2ce::Item origItem(*this);
-    const auto& origData = origItem.data;
-
-    size_t old_current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_PROPS_BIT_OFFSET_MARKER);
-    size_t bitsToCopy = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) - GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_PROPS_BIT_OFFSET_MARKER);
-
-    // write out new data
-    size_t old_set_bit_offset = GET_BIT_OFFSET(ItemOffsets::SET_BONUS_PROPS_BIT_OFFSET);
-    size_t current_bit_offset = old_set_bit_offset;
-
+    // encode the new lists first, the item is untouched if it fails
+    ItemBytes listData;
+    size_t listNumBits = 0;
     auto attribIter = attribs.begin();
     for (size_t i = 0; i < numBonusLists; ++i, ++attribIter)
     {
-        if (!updatePropertyList(current_bit_offset, *attribIter))
+        if (!encodePropertyList(*attribIter, listData, listNumBits))
         {
-            swap(origItem);
             return false;
         }
     }
 
-    ptrdiff_t diff = ptrdiff_t(current_bit_offset) - ptrdiff_t(old_set_bit_offset);
-    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) = current_bit_offset + bitsToCopy;
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
-
-    // now copy the remaining bits
-    std::uint32_t value = 0;
-    size_t valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
+    // write out new data
+    size_t bitsToCopy = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) - GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_PROPS_BIT_OFFSET_MARKER);
+    size_t old_set_bit_offset = GET_BIT_OFFSET(ItemOffsets::SET_BONUS_PROPS_BIT_OFFSET);
+    size_t current_bit_offset = old_set_bit_offset;
+    if (!replaceBits(current_bit_offset, GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_PROPS_BIT_OFFSET_MARKER), listData, listNumBits))
     {
-        bitsToCopy -= bits;
-        value = readtemp_bits(origData, old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
+        return false;
     }
 
+    ptrdiff_t diff = ptrdiff_t(current_bit_offset) - ptrdiff_t(old_set_bit_offset);
+    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) = current_bit_offset + bitsToCopy;
     updateOffset(GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::SET_BONUS_PROPS_BIT_OFFSET_MARKER), diff);
 
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     return true;
 }
 //---------------------------------------------------------------------------
@@ -10029,6 +10210,7 @@ bool d2ce::Item::getPossibleSuperiorAttributes(std::vector<MagicalAttribute>& at
 //---------------------------------------------------------------------------
 bool d2ce::Item::makeSuperior(const std::vector<MagicalAttribute>& attribs)
 {
+    ViewUpdate viewUpdate(*this);
     // Check for valid attributes
     if (attribs.empty() || attribs.size() > 2)
     {
@@ -10096,7 +10278,6 @@ bool d2ce::Item::makeSuperior(const std::vector<MagicalAttribute>& attribs)
 
     // make a copy first
     d2ce::Item origItem(*this);
-    const auto& origData = origItem.data;
 
     // complex change: make item have magical quality
     if (GET_BIT_OFFSET(ItemOffsets::QUALITY_BIT_OFFSET) == 0)
@@ -10115,15 +10296,14 @@ bool d2ce::Item::makeSuperior(const std::vector<MagicalAttribute>& attribs)
     // make room for superior bits
     size_t diff = INFERIOR_SUPERIOR_ID_NUM_BITS;
     current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER);
-    size_t old_current_bit_offset = current_bit_offset;
-    size_t bitsToCopy = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) - old_current_bit_offset;
+    if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), std::int64_t(diff)))
+    {
+        swap(origItem);
+        return false;
+    }
     GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += diff; // add new superior bits
 
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
-
     // update Superior quality value
-    current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER);
     value = 1;
     if (!updateBitsEx(current_bit_offset, INFERIOR_SUPERIOR_ID_NUM_BITS, value))
     {
@@ -10132,19 +10312,6 @@ bool d2ce::Item::makeSuperior(const std::vector<MagicalAttribute>& attribs)
     }
 
     GET_BIT_OFFSET(ItemOffsets::QUALITY_ATTRIB_BIT_OFFSET) = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER);
-
-    // now copy the remaining bits
-    size_t valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
-    {
-        bitsToCopy -= bits;
-        value = readtemp_bits(origData, old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    }
-
     updateOffset(GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER), diff);
 
     // write out new data
@@ -10162,12 +10329,12 @@ bool d2ce::Item::makeSuperior(const std::vector<MagicalAttribute>& attribs)
     // clear any bits not written to
     if ((current_bit_offset % 8) > 0)
     {
-        bits = (std::uint8_t)(8 - (current_bit_offset % 8));
+        std::uint8_t bits = (std::uint8_t)(8 - (current_bit_offset % 8));
         updateBitsEx(current_bit_offset, bits, 0);
     }
 
     fixDurability();
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     magic_affixes_v100.clear();
     rare_affixes_v100.clear();
     return true;
@@ -10175,6 +10342,7 @@ bool d2ce::Item::makeSuperior(const std::vector<MagicalAttribute>& attribs)
 //---------------------------------------------------------------------------
 bool d2ce::Item::makeSuperior()
 {
+    ViewUpdate viewUpdate(*this);
     if (getQuality() == EnumItemQuality::SUPERIOR)
     {
         // nothing to do
@@ -10228,7 +10396,7 @@ bool d2ce::Item::makeSuperior()
             return false;
         }
 
-        cachedCombinedMagicalAttributes.clear();
+        cachedCombinedProperties.clear();
         fixDurability();
         return true;
     }
@@ -10302,6 +10470,7 @@ bool d2ce::Item::makeSuperior()
 //---------------------------------------------------------------------------
 bool d2ce::Item::makeNormal()
 {
+    ViewUpdate viewUpdate(*this);
     if (isRuneword())
     {
         return false;
@@ -10343,7 +10512,6 @@ bool d2ce::Item::makeNormal()
 
     // make a copy first
     d2ce::Item origItem(*this);
-    const auto& origData = origItem.data;
 
     // complex change: make item have normal quality
     if (GET_BIT_OFFSET(ItemOffsets::QUALITY_BIT_OFFSET) == 0)
@@ -10392,7 +10560,7 @@ bool d2ce::Item::makeNormal()
             }
         }
 
-        cachedCombinedMagicalAttributes.clear();
+        cachedCombinedProperties.clear();
         magic_affixes_v100.clear();
         rare_affixes_v100.clear();
         return true;
@@ -10406,9 +10574,7 @@ bool d2ce::Item::makeNormal()
     // remove quality and magical attributes
     GET_BIT_OFFSET(ItemOffsets::QUALITY_ATTRIB_BIT_OFFSET) = 0;
     current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER);
-    size_t old_current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_ID_BIT_OFFSET_MARKER);
-    size_t bitsToCopy = GET_BIT_OFFSET(ItemOffsets::MAGICAL_PROPS_BIT_OFFSET) - old_current_bit_offset;
-    size_t diff = old_current_bit_offset - current_bit_offset;
+    size_t diff = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::RUNEWORD_ID_BIT_OFFSET_MARKER) - current_bit_offset;
     size_t diff2 = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) - (GET_BIT_OFFSET(ItemOffsets::MAGICAL_PROPS_BIT_OFFSET) + PROPERTY_ID_NUM_BITS);
     if (diff == 0 && diff2 == 0)
     {
@@ -10416,25 +10582,16 @@ bool d2ce::Item::makeNormal()
         return true;
     }
 
-    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) -= (diff + diff2);
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
-
-    if (diff > 0) // should always be the case
+    // remove the quality attributes, everything past the start of the property list is dropped
+    if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::MAGICAL_PROPS_BIT_OFFSET), -std::int64_t(diff)))
     {
-        // now copy the remaining bits
-        size_t valueBitSize = sizeof(value) * 8;
-        std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-        while (bitsToCopy > 0)
-        {
-            bitsToCopy -= bits;
-            value = readtemp_bits(origData, old_current_bit_offset, bits);
-            old_current_bit_offset += bits;
-            updateBitsEx(current_bit_offset, bits, value);
-            bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-        }
+        swap(origItem);
+        return false;
     }
 
+    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) -= (diff + diff2);
+    current_bit_offset = GET_BIT_OFFSET(ItemOffsets::MAGICAL_PROPS_BIT_OFFSET) - diff;
+
     // clear property list
     setBits(current_bit_offset, PROPERTY_ID_NUM_BITS, 0x1FF);
 
@@ -10456,7 +10613,7 @@ bool d2ce::Item::makeNormal()
     }
 
     fixDurability();
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     magic_affixes_v100.clear();
     rare_affixes_v100.clear();
     return true;
@@ -10464,6 +10621,7 @@ bool d2ce::Item::makeNormal()
 //---------------------------------------------------------------------------
 bool d2ce::Item::makeMagical()
 {
+    ViewUpdate viewUpdate(*this);
     if (isRuneword())
     {
         return false;
@@ -10540,6 +10698,7 @@ bool d2ce::Item::makeMagical()
 //---------------------------------------------------------------------------
 bool d2ce::Item::makeRare()
 {
+    ViewUpdate viewUpdate(*this);
     if (isRuneword())
     {
         return false;
@@ -10626,6 +10785,7 @@ bool d2ce::Item::makeRare()
 //---------------------------------------------------------------------------
 bool d2ce::Item::makeCrafted(std::uint16_t& id)
 {
+    ViewUpdate viewUpdate(*this);
     if (isRuneword())
     {
         return false;
@@ -10743,12 +10903,14 @@ bool d2ce::Item::makeCrafted(std::uint16_t& id)
 //---------------------------------------------------------------------------
 bool d2ce::Item::makeCrafted()
 {
+    ViewUpdate viewUpdate(*this);
     std::uint16_t id = MAXUINT16;
     return makeCrafted(id);
 }
 //---------------------------------------------------------------------------
 bool d2ce::Item::makeEthereal()
 {
+    ViewUpdate viewUpdate(*this);
     if (isEthereal())
     {
         return true;
@@ -10776,6 +10938,7 @@ bool d2ce::Item::makeEthereal()
 //---------------------------------------------------------------------------
 bool d2ce::Item::removeEthereal()
 {
+    ViewUpdate viewUpdate(*this);
     if (!isEthereal())
     {
         return true;
@@ -10804,6 +10967,7 @@ bool d2ce::Item::removeEthereal()
 //---------------------------------------------------------------------------
 bool d2ce::Item::setRareOrCraftedAttributes(const d2ce::RareAttributes& affixes)
 {
+    ViewUpdate viewUpdate(*this);
     if (isSimpleItem() || (isSocketFiller() && !isJewel()))
     {
         return false;
@@ -11095,7 +11259,6 @@ bool d2ce::Item::setRareOrCraftedAttributesSimple(const d2ce::RareAttributes& af
 
     // make a copy first
     d2ce::Item origItem(*this);
-    const auto& origData = origItem.data;
 
     if (bIsCraft)
     {
@@ -11122,13 +11285,13 @@ bool d2ce::Item::setRareOrCraftedAttributesSimple(const d2ce::RareAttributes& af
 
     // make room for affixes
     current_bit_offset = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER);
-    size_t old_current_bit_offset = current_bit_offset;
-    size_t bitsToCopy = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) - old_current_bit_offset;
+    if (!spliceBits(current_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), std::int64_t(diff)))
+    {
+        swap(origItem);
+        return false;
+    }
     GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += diff; // add new attribs
 
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
-
     // update affixes
     value = affixes.Id;
     if (!updateBitsEx(current_bit_offset, RARE_CRAFTED_ID_NUM_BITS, value))
@@ -11192,19 +11355,6 @@ bool d2ce::Item::setRareOrCraftedAttributesSimple(const d2ce::RareAttributes& af
     }
 
     GET_BIT_OFFSET(ItemOffsets::QUALITY_ATTRIB_BIT_OFFSET) = GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER);
-
-    // now copy the remaining bits
-    valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
-    {
-        bitsToCopy -= bits;
-        value = readtemp_bits(origData, old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    }
-
     updateOffset(GET_BIT_OFFSET_MARKER(ItemOffsetMarkers::QUALITY_ATTRIB_BIT_OFFSET_MARKER), diff);
 
     // write out new data
@@ -11222,12 +11372,12 @@ bool d2ce::Item::setRareOrCraftedAttributesSimple(const d2ce::RareAttributes& af
     // clear any bits not written to
     if ((current_bit_offset % 8) > 0)
     {
-        bits = (std::uint8_t)(8 - (current_bit_offset % 8));
+        std::uint8_t bits = (std::uint8_t)(8 - (current_bit_offset % 8));
         updateBitsEx(current_bit_offset, bits, 0);
     }
 
     fixDurability();
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     magic_affixes_v100.clear();
     rare_affixes_v100.clear();
     return true;
@@ -11301,10 +11451,22 @@ bool d2ce::Item::exportItem(const std::filesystem::path& path) const
     if (directExport)
     {
         // we can directly write out the data
+        std::vector<std::uint8_t> buffer;
+        buffer.reserve(getFullSize());
+        BitSink sink(buffer);
+        if (!writeItem(sink))
+        {
+            return false;
+        }
+
         std::FILE* charfile = NULL;
         _wfopen_s(&charfile, path.wstring().c_str(), L"wb");
-        std::rewind(charfile);
-        bool ret = writeItem(charfile);
+        if (charfile == NULL)
+        {
+            return false;
+        }
+
+        bool ret = buffer.empty() || (std::fwrite(buffer.data(), buffer.size(), 1, charfile) == 1);
         std::fclose(charfile);
         return ret;
     }
@@ -11427,6 +11589,7 @@ std::uint16_t d2ce::Item::getMonsterId() const
 //---------------------------------------------------------------------------
 bool d2ce::Item::setMonsterId(std::uint16_t id)
 {
+    ViewUpdate viewUpdate(*this);
     if (!isBodyPart() || GET_BIT_OFFSET(ItemOffsets::BODY_PART_BIT_OFFSET) == 0)
     {
         return false;
@@ -11850,6 +12013,16 @@ std::uint8_t d2ce::Item::getSocketCountBonus() const
 }
 //---------------------------------------------------------------------------
 std::uint8_t d2ce::Item::getSocketCount() const
+{
+    if (hasViewField(ItemView::SOCKET_COUNT))
+    {
+        return view.SocketCount;
+    }
+
+    return decodeSocketCount();
+}
+//---------------------------------------------------------------------------
+std::uint8_t d2ce::Item::decodeSocketCount() const
 {
     if (isSimpleItem() || !isSocketed())
     {
@@ -11880,6 +12053,16 @@ std::uint8_t d2ce::Item::getSocketCount() const
 }
 //---------------------------------------------------------------------------
 std::uint8_t d2ce::Item::getSocketedItemCount() const
+{
+    if (hasViewField(ItemView::SOCKETED_ITEM_COUNT))
+    {
+        return view.SocketedItemCount;
+    }
+
+    return decodeSocketedItemCount();
+}
+//---------------------------------------------------------------------------
+std::uint8_t d2ce::Item::decodeSocketedItemCount() const
 {
     if (GET_BIT_OFFSET(ItemOffsets::NR_OF_ITEMS_IN_SOCKETS_OFFSET) == 0)
     {
@@ -13009,8 +13192,9 @@ bool d2ce::Item::getDisplayedCombinedMagicalAttributes(std::vector<MagicalAttrib
     return d2ce::ItemHelpers::formatMagicalAttributes(attribs, charLevel);
 }
 //---------------------------------------------------------------------------
-std::uint64_t d2ce::Item::readBits(std::FILE* charfile, size_t& current_bit_offset, size_t bits)
+std::uint64_t d2ce::Item::readBits(BitSource& charfile, size_t& current_bit_offset, size_t bits)
 {
+    view.clear();
     size_t readOffset = current_bit_offset;
 
     // Ensure we read enough
@@ -13027,24 +13211,22 @@ std::uint64_t d2ce::Item::readBits(std::FILE* charfile, size_t& current_bit_offs
     return readBits64(readOffset, bits);
 }
 //---------------------------------------------------------------------------
-bool d2ce::Item::skipBits(std::FILE* charfile, size_t& current_bit_offset, size_t bits)
+bool d2ce::Item::skipBits(BitSource& charfile, size_t& current_bit_offset, size_t bits)
 {
-    if (feof(charfile))
+    view.clear();
+    if (charfile.eof())
     {
         return false;
     }
 
     size_t bytesRequired = (current_bit_offset + bits + 7) / 8;
-    std::uint8_t value = 0;
-    while (data.size() < bytesRequired)
+    if (data.size() < bytesRequired)
     {
-        if (feof(charfile))
+        // slice the missing bytes straight out of the source buffer
+        if (!charfile.append(data.modify(), bytesRequired - data.size()))
         {
             return false;
         }
-
-        std::fread(&value, sizeof(value), 1, charfile);
-        data.push_back(value);
     }
 
     current_bit_offset += bits;
@@ -13053,6 +13235,7 @@ bool d2ce::Item::skipBits(std::FILE* charfile, size_t& current_bit_offset, size_
 //---------------------------------------------------------------------------
 bool d2ce::Item::setBits(size_t& current_bit_offset, size_t bits, std::uint32_t value)
 {
+    view.clear();
     if (bits > 32)
     {
         return false;
@@ -13070,6 +13253,7 @@ bool d2ce::Item::setBits(size_t& current_bit_offset, size_t bits, std::uint32_t
 //---------------------------------------------------------------------------
 bool d2ce::Item::setBits64(size_t& current_bit_offset, size_t bits, std::uint64_t value)
 {
+    view.clear();
     if (bits > 64)
     {
         return false;
@@ -13085,17 +13269,20 @@ bool d2ce::Item::setBits64(size_t& current_bit_offset, size_t bits, std::uint64_
     return updateBits64Ex(current_bit_offset, bits, value);
 }
 //---------------------------------------------------------------------------
-bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, std::FILE* charfile)
+bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, BitSource& charfile)
 {
+    ViewUpdate viewUpdate(*this);
     data.clear();
     SocketedItems.clear();
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     magic_affixes_v100.clear();
     rare_affixes_v100.clear();
 
     GET_BIT_OFFSET(ItemOffsets::DWB_BIT_OFFSET) = 0;
+    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) = 0;
     magic_affixes_v100.clear();
     rare_affixes_v100.clear();
+    view.clear();
 
     // reserve enough space to reduce chance of reallocation (haven't seen an item size bigger then 80
     data.reserve(80);
@@ -13326,7 +13513,7 @@ bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, std::FILE*
 
             // up to 15 7/8 bit characters
             size_t bitSize = (ItemVersion >= EnumItemVersion::v120) ? 8 : 7;
-            for (std::uint8_t idx = 0; !feof(charfile) && idx <= 15 && readBits(charfile, current_bit_offset, bitSize) != 0; ++idx);
+            for (std::uint8_t idx = 0; !charfile.eof() && idx <= 15 && readBits(charfile, current_bit_offset, bitSize) != 0; ++idx);
             GET_BIT_OFFSET(ItemOffsets::EXTENDED_DATA_OFFSET) = current_bit_offset;
             GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) = current_bit_offset;
             return true;
@@ -13509,7 +13696,7 @@ bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, std::FILE*
                     }
                 }
 
-                if (feof(charfile))
+                if (charfile.eof())
                 {
                     return false;
                 }
@@ -13522,7 +13709,7 @@ bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, std::FILE*
                     }
                 }
 
-                if (feof(charfile))
+                if (charfile.eof())
                 {
                     return false;
                 }
@@ -13556,7 +13743,7 @@ bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, std::FILE*
 
             // up to 15 7/8 bit characters
             size_t bitSize = (ItemVersion >= EnumItemVersion::v120) ? 8 : 7;
-            for (std::uint8_t idx = 0; !feof(charfile) && idx <= 15 && readBits(charfile, current_bit_offset, bitSize) != 0; ++idx);
+            for (std::uint8_t idx = 0; !charfile.eof() && idx <= 15 && readBits(charfile, current_bit_offset, bitSize) != 0; ++idx);
         }
 
         bool isArmor = itemType.isArmor();
@@ -13607,7 +13794,7 @@ bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, std::FILE*
             }
         }
 
-        if (feof(charfile))
+        if (charfile.eof())
         {
             return false;
         }
@@ -13635,7 +13822,7 @@ bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, std::FILE*
                 }
             }
 
-            if (feof(charfile))
+            if (charfile.eof())
             {
                 return false;
             }
@@ -13673,7 +13860,7 @@ bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, std::FILE*
         {
             GET_BIT_OFFSET(ItemOffsets::BONUS_BITS_BIT_OFFSET) = current_bit_offset;
             setBonusBits = (std::uint8_t)readBits(charfile, current_bit_offset, 5);
-            if (feof(charfile))
+            if (charfile.eof())
             {
                 return false;
             }
@@ -13720,7 +13907,7 @@ bool d2ce::Item::readItem(EnumItemVersion version, bool isExpansion, std::FILE*
     if (numSocketed > 0)
     {
         auto gemApplyType = getGemApplyType();
-        for (std::uint8_t i = 0; !feof(charfile) && i < numSocketed; ++i)
+        for (std::uint8_t i = 0; !charfile.eof() && i < numSocketed; ++i)
         {
             SocketedItems.resize(SocketedItems.size() + 1);
             auto& childItem = SocketedItems.back();
@@ -15659,6 +15846,7 @@ bool d2ce::Item::verifyItemConsistency() const
 //---------------------------------------------------------------------------
 bool d2ce::Item::readItem(const Json::Value& itemRoot, bool bSerializedFormat, EnumItemVersion version, bool isExpansion)
 {
+    ViewUpdate viewUpdate(*this);
     if (itemRoot.isNull())
     {
         return false;
@@ -15666,13 +15854,15 @@ bool d2ce::Item::readItem(const Json::Value& itemRoot, bool bSerializedFormat, E
 
     data.clear();
     SocketedItems.clear();
-    cachedCombinedMagicalAttributes.clear();
+    cachedCombinedProperties.clear();
     magic_affixes_v100.clear();
     rare_affixes_v100.clear();
 
     GET_BIT_OFFSET(ItemOffsets::DWB_BIT_OFFSET) = 0;
+    GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) = 0;
     magic_affixes_v100.clear();
     rare_affixes_v100.clear();
+    view.clear();
 
     // reserve enough space to reduce chance of reallocation (haven't seen an item size bigger then 80
     data.reserve(80);
@@ -18858,10 +19048,10 @@ void d2ce::Item::bitRangeAsJson(Json::Value& parent, size_t startBit, size_t end
     parent[propName] = unknownData;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Item::parsePropertyList(std::FILE* charfile, size_t& current_bit_offset)
+bool d2ce::Item::parsePropertyList(BitSource& charfile, size_t& current_bit_offset)
 {
     std::uint16_t id = (std::uint16_t)readBits(charfile, current_bit_offset, PROPERTY_ID_NUM_BITS);
-    if (feof(charfile))
+    if (charfile.eof())
     {
         return false;
     }
@@ -19423,9 +19613,9 @@ bool d2ce::Item::parsePropertyList(const Json::Value& propListRoot, bool bSerial
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Item::readPropertyList(size_t& current_bit_offset, std::vector<MagicalAttribute>& attrib) const
+template <class PropertyHandler>
+bool d2ce::Item::decodePropertyList(size_t& current_bit_offset, PropertyHandler&& onProperty) const
 {
-    attrib.clear();
     if (current_bit_offset == 0)
     {
         return false;
@@ -19448,21 +19638,21 @@ bool d2ce::Item::readPropertyList(size_t& current_bit_offset, std::vector<Magica
             return false;
         }
 
-        MagicalAttribute magicalAttrib;
-        const auto& stat = ItemHelpers::getItemStat(itemVersion, id);
+        const auto& stat = ItemHelpers::getItemStatEncoding(itemVersion, id);
         if (id != stat.id)
         {
             // corrupt file
             return false;
         }
 
-        magicalAttrib.Id = stat.id;
-        magicalAttrib.Name = stat.name;
-        magicalAttrib.Desc = stat.nextInChain.empty() ? stat.desc : stat.descRange;
-        magicalAttrib.Version = itemVersion;
-        magicalAttrib.GameVersion = gameVersion;
-        magicalAttrib.DescPriority = stat.descPriority;
-        magicalAttrib.encode = stat.encode;
+        const auto& statInfo = ItemHelpers::getItemStat(itemVersion, id);
+        ItemProperty prop;
+        prop.Id = stat.id;
+        prop.Version = itemVersion;
+        prop.GameVersion = gameVersion;
+        prop.DescPriority = statInfo.descPriority;
+        prop.encode = statInfo.encode;
+        prop.RangeDesc = statInfo.nextInChain.empty() ? false : true;
 
         // saveBits being zero or >= 64 is unrecoverably bad, and
         // encode type 4 is only used by stats that were never implemented (time-based stats)
@@ -19480,9 +19670,9 @@ bool d2ce::Item::readPropertyList(size_t& current_bit_offset, std::vector<Magica
                 return false;
             }
 
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 6) - stat.saveAdd);
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 10) - stat.saveAdd);
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, stat.saveBits) - stat.saveAdd);
+            prop.addValue(readBits64Ex(current_bit_offset, 6) - stat.saveAdd);
+            prop.addValue(readBits64Ex(current_bit_offset, 10) - stat.saveAdd);
+            prop.addValue(readBits64Ex(current_bit_offset, stat.saveBits) - stat.saveAdd);
         }
         else if (stat.encode == 3)
         {
@@ -19492,10 +19682,10 @@ bool d2ce::Item::readPropertyList(size_t& current_bit_offset, std::vector<Magica
                 return false;
             }
 
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 6) - stat.saveAdd);
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 10) - stat.saveAdd);
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 8) - stat.saveAdd);
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 8) - stat.saveAdd);
+            prop.addValue(readBits64Ex(current_bit_offset, 6) - stat.saveAdd);
+            prop.addValue(readBits64Ex(current_bit_offset, 10) - stat.saveAdd);
+            prop.addValue(readBits64Ex(current_bit_offset, 8) - stat.saveAdd);
+            prop.addValue(readBits64Ex(current_bit_offset, 8) - stat.saveAdd);
         }
         else if (stat.encode == 4)
         {
@@ -19506,35 +19696,33 @@ bool d2ce::Item::readPropertyList(size_t& current_bit_offset, std::vector<Magica
                 return false;
             }
 
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 2));
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 10));
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 10));
+            prop.addValue(readBits64Ex(current_bit_offset, 2));
+            prop.addValue(readBits64Ex(current_bit_offset, 10));
+            prop.addValue(readBits64Ex(current_bit_offset, 10));
         }
         else if (stat.saveParamBits > 0)
         {
-            if (stat.name.compare("item_addskill_tab") == 0)
+            if (stat.addSkillTab)
             {
-                magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 3) - stat.saveAdd);
-                magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, 13) - stat.saveAdd);
-                magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, stat.saveBits) - stat.saveAdd);
+                prop.addValue(readBits64Ex(current_bit_offset, 3) - stat.saveAdd);
+                prop.addValue(readBits64Ex(current_bit_offset, 13) - stat.saveAdd);
+                prop.addValue(readBits64Ex(current_bit_offset, stat.saveBits) - stat.saveAdd);
             }
             else
             {
-                magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, stat.saveParamBits) - stat.saveAdd);
-                magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, stat.saveBits) - stat.saveAdd);
+                prop.addValue(readBits64Ex(current_bit_offset, stat.saveParamBits) - stat.saveAdd);
+                prop.addValue(readBits64Ex(current_bit_offset, stat.saveBits) - stat.saveAdd);
             }
         }
         else
         {
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, stat.saveBits) - stat.saveAdd);
+            prop.addValue(readBits64Ex(current_bit_offset, stat.saveBits) - stat.saveAdd);
         }
 
-        auto nextInChainIter = stat.nextInChain.begin();
-        auto nextInChainIterEnd = stat.nextInChain.end();
-        for (; nextInChainIter != nextInChainIterEnd && magicalAttrib.Values.size() < 4; ++nextInChainIter)
+        for (size_t idx = 0; idx < stat.numNextInChain && prop.NumValues < ItemProperty::MAX_VALUES; ++idx)
         {
-            nextInChain = *nextInChainIter;
-            const auto& statNext = ItemHelpers::getItemStat(itemVersion, nextInChain);
+            nextInChain = stat.nextInChain[idx];
+            const auto& statNext = ItemHelpers::getItemStatEncoding(itemVersion, nextInChain);
             if (statNext.id != nextInChain)
             {
                 // corrupt file
@@ -19547,16 +19735,36 @@ bool d2ce::Item::readPropertyList(size_t& current_bit_offset, std::vector<Magica
                 return false;
             }
 
-            magicalAttrib.Values.push_back(readBits64Ex(current_bit_offset, statNext.saveBits) - statNext.saveAdd);
+            prop.addValue(readBits64Ex(current_bit_offset, statNext.saveBits) - statNext.saveAdd);
         }
 
-        attrib.push_back(magicalAttrib);
+        onProperty(prop, statInfo);
         id = (std::uint16_t)readBitsEx(current_bit_offset, PROPERTY_ID_NUM_BITS);
     }
 
     return true;
 }
 //---------------------------------------------------------------------------
+bool d2ce::Item::readPropertyList(size_t& current_bit_offset, std::vector<MagicalAttribute>& attrib) const
+{
+    // on failure keep the properties read before the corruption, just like before
+    attrib.clear();
+    return decodePropertyList(current_bit_offset, [&attrib](const ItemProperty& prop, const ItemStat& stat)
+        {
+            attrib.resize(attrib.size() + 1);
+            prop.asMagicalAttribute(stat, attrib.back());
+        });
+}
+//---------------------------------------------------------------------------
+bool d2ce::Item::readPropertyList(size_t& current_bit_offset, std::vector<ItemProperty>& props) const
+{
+    props.clear();
+    return decodePropertyList(current_bit_offset, [&props](const ItemProperty& prop, const ItemStat& /*stat*/)
+        {
+            props.push_back(prop);
+        });
+}
+//---------------------------------------------------------------------------
 bool d2ce::Item::updatePropertyList(size_t& current_bit_offset, const std::vector<MagicalAttribute>& attribs)
 {
     auto itemVersion = getVersion();
@@ -19881,28 +20089,28 @@ bool d2ce::Item::updatePropertyList(size_t& current_bit_offset, const std::vecto
     return setBits(current_bit_offset, PROPERTY_ID_NUM_BITS, id);
 }
 //---------------------------------------------------------------------------
-std::uint8_t d2ce::Item::getEncodedChar(std::FILE* charfile, size_t& current_bit_offset)
+std::uint8_t d2ce::Item::getEncodedChar(BitSource& charfile, size_t& current_bit_offset)
 {
-    std::string bitStr;
-    size_t startRead = current_bit_offset;
-    size_t readOffset = startRead;
-    std::uint8_t result = UINT8_MAX;
-    while (bitStr.size() < 9)
+    // peek at the next 9 bits without pulling any bytes past the code into the item
+    std::uint32_t bits = 0;
+    size_t byteIdx = current_bit_offset / 8;
+    for (size_t i = 0; i < 3; ++i)
     {
-        readOffset = startRead;
-        std::stringstream ss2;
-        ss2 << std::bitset<9>(readBits(charfile, readOffset, bitStr.size() + 1));
-        current_bit_offset = readOffset;
-        bitStr = ss2.str().substr(8 - bitStr.size());
-        result = ItemHelpers::HuffmanDecodeBitString(bitStr);
-        if (result != UINT8_MAX)
-        {
-            return result;
-        }
+        size_t idx = byteIdx + i;
+        std::uint32_t value = (idx < data.size()) ? data.bytes()[idx] : charfile.peek(idx - data.size());
+        bits |= value << (8 * i);
     }
+    bits >>= (current_bit_offset & 7);
 
-    // something went wrong
-    return UINT8_MAX;
+    std::uint8_t numBits = 0;
+    std::uint8_t result = ItemHelpers::HuffmanDecode(std::uint16_t(bits), numBits);
+    if (numBits == 0 || !skipBits(charfile, current_bit_offset, numBits))
+    {
+        // something went wrong
+        return UINT8_MAX;
+    }
+
+    return result;
 }
 //---------------------------------------------------------------------------
 std::uint32_t d2ce::Item::readBits(size_t start, size_t size) const
@@ -19950,6 +20158,7 @@ std::uint64_t d2ce::Item::readBits64Ex(size_t& start, size_t size) const
 //---------------------------------------------------------------------------
 bool d2ce::Item::updateBits(size_t start, size_t size, std::uint32_t value)
 {
+    view.clear();
     size_t startIdx = start / 8;
     size_t endIdx = (start + size - 1) / 8;
     if (endIdx >= data.size())
@@ -19968,9 +20177,10 @@ bool d2ce::Item::updateBits(size_t start, size_t size, std::uint32_t value)
 
     std::uint64_t mask = (((std::uint64_t)1 << size) - 1) << (startBit);
     std::uint64_t dest = 0;
-    std::memcpy((std::uint8_t*)&dest, &data[startIdx], numBytes);
+    auto& bytes = data.modify();
+    std::memcpy((std::uint8_t*)&dest, &bytes[startIdx], numBytes);
     dest = (dest & ~mask) | (((std::uint64_t)value << (startBit)) & mask);
-    std::memcpy(&data[startIdx], (std::uint8_t*)&dest, numBytes);
+    std::memcpy(&bytes[startIdx], (std::uint8_t*)&dest, numBytes);
     return true;
 }
 //---------------------------------------------------------------------------
@@ -19985,8 +20195,74 @@ bool d2ce::Item::updateBitsEx(size_t& start, size_t size, std::uint32_t value)
     return true;
 }
 //---------------------------------------------------------------------------
+bool d2ce::Item::spliceBits(size_t start, size_t end, std::int64_t bitDiff)
+{
+    if ((start > end) || (end > (data.size() * 8)) || ((bitDiff < 0) && (size_t(-bitDiff) > (end - start))))
+    {
+        return false;
+    }
+
+    view.clear();
+    size_t newEnd = size_t(std::int64_t(end) + bitDiff);
+    size_t newSize = (newEnd + 7) / 8;
+    if (bitDiff > 0)
+    {
+        // make room and shift the tail towards the end, the inserted bits are zero
+        if (newSize > data.size())
+        {
+            data.resize(newSize, 0);
+        }
+
+        MoveBits(data.modify(), start, start + size_t(bitDiff), end - start);
+        ClearBits(data.modify(), start, size_t(bitDiff));
+    }
+    else if (bitDiff < 0)
+    {
+        // shift the tail over the removed bits
+        MoveBits(data.modify(), start + size_t(-bitDiff), start, end - start - size_t(-bitDiff));
+    }
+
+    // clear any bits past the new end
+    data.resize(newSize, 0);
+    if ((newEnd % 8) > 0)
+    {
+        data.modify()[newSize - 1] &= std::uint8_t((1ui32 << (newEnd % 8)) - 1);
+    }
+
+    return true;
+}
+//---------------------------------------------------------------------------
+bool d2ce::Item::encodePropertyList(const std::vector<MagicalAttribute>& attribs, ItemBytes& listData, size_t& numBits)
+{
+    // write the list into a buffer of its own so the rest of the item only has to be moved once
+    data.modify().swap(listData);
+    bool bResult = updatePropertyList(numBits, attribs);
+    data.modify().swap(listData);
+    view.clear();
+    return bResult;
+}
+//---------------------------------------------------------------------------
+bool d2ce::Item::replaceBits(size_t& current_bit_offset, size_t end_bit_offset, const ItemBytes& bits, size_t numBits)
+{
+    size_t itemEnd = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET);
+    if ((end_bit_offset < current_bit_offset) || (end_bit_offset > itemEnd) || (((numBits + 7) / 8) > bits.size()))
+    {
+        return false;
+    }
+
+    if (!spliceBits(current_bit_offset, itemEnd, std::int64_t(numBits) - std::int64_t(end_bit_offset - current_bit_offset)))
+    {
+        return false;
+    }
+
+    CopyBits(bits, 0, data.modify(), current_bit_offset, numBits);
+    current_bit_offset += numBits;
+    return true;
+}
+//---------------------------------------------------------------------------
 bool d2ce::Item::updateBits64(size_t start, size_t size, std::uint64_t value)
 {
+    view.clear();
     size_t startIdx = start / 8;
     size_t endIdx = (start + size - 1) / 8;
     if (endIdx >= data.size())
@@ -20005,9 +20281,10 @@ bool d2ce::Item::updateBits64(size_t start, size_t size, std::uint64_t value)
 
     std::uint64_t mask = (((std::uint64_t)1 << size) - 1) << (startBit);
     std::uint64_t dest = 0;
-    std::memcpy((std::uint8_t*)&dest, &data[startIdx], numBytes);
+    auto& bytes = data.modify();
+    std::memcpy((std::uint8_t*)&dest, &bytes[startIdx], numBytes);
     dest = (dest & ~mask) | (((std::uint64_t)value << (startBit)) & mask);
-    std::memcpy(&data[startIdx], (std::uint8_t*)&dest, numBytes);
+    std::memcpy(&bytes[startIdx], (std::uint8_t*)&dest, numBytes);
     return true;
 }
 //---------------------------------------------------------------------------
@@ -20031,42 +20308,17 @@ bool d2ce::Item::updateResurrectedItemCode(std::uint64_t code, size_t numBitsSet
         return updateBits64(GET_BIT_OFFSET(ItemOffsets::TYPE_CODE_OFFSET), numBitsSet, code);
     }
 
-    // complex change
-    size_t old_current_bit_offset = GET_BIT_OFFSET(ItemOffsets::EXTENDED_DATA_OFFSET);
-    size_t bitsToCopy = GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) - GET_BIT_OFFSET(ItemOffsets::EXTENDED_DATA_OFFSET);
-
+    // complex change, resize the code in place
     std::int64_t diff = std::int64_t(numBitsSet) - std::int64_t(oldNumBitsSet);
+    size_t splice_bit_offset = GET_BIT_OFFSET(ItemOffsets::TYPE_CODE_OFFSET) + std::min(numBitsSet, size_t(oldNumBitsSet));
+    if (!spliceBits(splice_bit_offset, GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET), diff))
+    {
+        return false;
+    }
+
     GET_BIT_OFFSET(ItemOffsets::EXTENDED_DATA_OFFSET) += diff;
     GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) += diff;
-    size_t current_bit_offset = GET_BIT_OFFSET(ItemOffsets::EXTENDED_DATA_OFFSET);
-
-    // make a copy first
-    std::vector<std::uint8_t> oldData(data);
-
-    // truncate the original
-    size_t newSize = (GET_BIT_OFFSET(ItemOffsets::ITEM_END_BIT_OFFSET) + 7) / 8;
-    data.resize(newSize, 0);
-    updateBits64(GET_BIT_OFFSET(ItemOffsets::TYPE_CODE_OFFSET), numBitsSet, code); // update the bits
-
-    // now copy the remaining bits
-    std::uint32_t value = 0;
-    size_t valueBitSize = sizeof(value) * 8;
-    std::uint8_t bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    while (bitsToCopy > 0)
-    {
-        bitsToCopy -= bits;
-        value = readtemp_bits(oldData, old_current_bit_offset, bits);
-        old_current_bit_offset += bits;
-        updateBitsEx(current_bit_offset, bits, value);
-        bits = (std::uint8_t)std::min(valueBitSize, bitsToCopy);
-    }
-
-    // clear any bits not written to
-    if ((current_bit_offset % 8) > 0)
-    {
-        bits = (std::uint8_t)(8 - (current_bit_offset % 8));
-        updateBitsEx(current_bit_offset, bits, 0);
-    }
+    updateBits64(GET_BIT_OFFSET(ItemOffsets::TYPE_CODE_OFFSET), numBitsSet, code); // update the bits
 
     updateOffset(GET_BIT_OFFSET(ItemOffsets::EXTENDED_DATA_OFFSET), diff);
     return true;
@@ -20394,11 +20646,7 @@ void d2ce::Items::findItems()
         auto& dimensions = altItemDimensions[d2ce::EnumAltItemLocation::INVENTORY];
         if (getItemLocationDimensions(d2ce::EnumAltItemLocation::INVENTORY, dimensions))
         {
-            std::uint16_t totalPos = dimensions.InvHeight * dimensions.InvWidth;
-            for (std::uint16_t pos = 0; pos < totalPos; ++pos)
-            {
-                emptySlots.insert(pos);
-            }
+            emptySlots.reset(dimensions);
         }
     }
 
@@ -20408,11 +20656,7 @@ void d2ce::Items::findItems()
         auto& dimensions = altItemDimensions[d2ce::EnumAltItemLocation::STASH];
         if (getItemLocationDimensions(d2ce::EnumAltItemLocation::STASH, dimensions))
         {
-            std::uint16_t totalPos = dimensions.InvHeight * dimensions.InvWidth;
-            for (std::uint16_t pos = 0; pos < totalPos; ++pos)
-            {
-                emptySlots.insert(pos);
-            }
+            emptySlots.reset(dimensions);
         }
     }
 
@@ -20446,12 +20690,18 @@ void d2ce::Items::findItems()
             GPSs.push_back(item);
         }
 
+        // same as verifyRestrictedItems, wherever the item is in the inventory
+        if (item.isRestrictedItem())
+        {
+            HasRestrictedItem.push_back(const_cast<d2ce::ItemType&>(item.getItemTypeHelper()));
+        }
+
         itemLocation = item.getLocation();
         itemAltLocation = item.getAltPositionId();
         switch (itemLocation)
         {
         case d2ce::EnumItemLocation::BELT:
-            HasBeltEquipped = true;
+            // only an equipped belt sets HasBeltEquipped, same as verifyBeltSlots
             itemAltLocation = EnumAltItemLocation::UNKNOWN;
             ItemLocationReference[itemLocation][itemAltLocation].push_back(const_cast<d2ce::Item&>(item));
             break;
@@ -20459,7 +20709,7 @@ void d2ce::Items::findItems()
         case d2ce::EnumItemLocation::EQUIPPED:
             itemAltLocation = EnumAltItemLocation::UNKNOWN;
             ItemLocationReference[itemLocation][itemAltLocation].push_back(const_cast<d2ce::Item&>(item));
-            if ((!HasBeltEquipped || (EquippedBeltSlots == 0)) && item.isBelt())
+            if (!HasBeltEquipped && item.isBelt())
             {
                 HasBeltEquipped = true;
                 EquippedBeltSlots = item.getTotalItemSlots();
@@ -20472,34 +20722,22 @@ void d2ce::Items::findItems()
             {
             case d2ce::EnumAltItemLocation::HORADRIC_CUBE:
                 hasHoradricCube = true;
-                HasRestrictedItem.push_back(const_cast<d2ce::ItemType&>(item.getItemTypeHelper()));
                 break;
 
             case d2ce::EnumAltItemLocation::INVENTORY:
             case d2ce::EnumAltItemLocation::STASH:
-                if (item.isRestrictedItem())
+                if (!hasHoradricCube && item.isRestrictedItem())
                 {
-                    HasRestrictedItem.push_back(const_cast<d2ce::ItemType&>(item.getItemTypeHelper()));
-                    if (!hasHoradricCube)
-                    {
-                        hasHoradricCube = item.isHoradricCube();
-                    }
+                    hasHoradricCube = item.isHoradricCube();
                 }
 
                 if (item.getDimensions(dimensions))
                 {
                     // remove slots from empty list
                     auto& emptySlots = ItemLocationEmptySpots[itemLocation][itemAltLocation];
-                    auto& invDimenstion = altItemDimensions[itemAltLocation];
                     auto posX = std::uint16_t(item.getPositionX());
                     auto posY = std::uint16_t(item.getPositionY());
-                    for (std::uint16_t y = posY; y < std::uint16_t(posY + dimensions.Height); ++y)
-                    {
-                        for (std::uint16_t x = posX; x < std::uint16_t(posX + dimensions.Width); ++x)
-                        {
-                            emptySlots.erase(y * invDimenstion.Width + x);
-                        }
-                    }
+                    emptySlots.occupy(posX, posY, dimensions.Width, dimensions.Height);
                 }
                 break;
             }
@@ -20510,16 +20748,12 @@ void d2ce::Items::findItems()
         auto& emptySlots = ItemLocationEmptySpots[d2ce::EnumItemLocation::BELT][d2ce::EnumAltItemLocation::UNKNOWN];
         if (getItemLocationDimensions(d2ce::EnumItemLocation::BELT, dimensions))
         {
-            std::uint16_t totalPos = dimensions.InvHeight * dimensions.InvWidth;
-            for (std::uint16_t pos = 0; pos < totalPos; ++pos)
-            {
-                emptySlots.insert(pos);
-            }
+            emptySlots.reset(dimensions);
 
             // remove slots from empty list
             for (const auto& itemRef : ItemLocationReference[d2ce::EnumItemLocation::BELT][d2ce::EnumAltItemLocation::UNKNOWN])
             {
-                emptySlots.erase(itemRef.get().getPositionX());
+                emptySlots.occupy(itemRef.get().getPositionX(), 0);
             }
         }
     } // end for
@@ -20531,11 +20765,7 @@ void d2ce::Items::findItems()
         auto& cubeDimensions = altItemDimensions[itemAltLocation];
         if (getItemLocationDimensions(itemAltLocation, cubeDimensions))
         {
-            std::uint16_t totalPos = cubeDimensions.InvHeight * cubeDimensions.InvWidth;
-            for (std::uint16_t pos = 0; pos < totalPos; ++pos)
-            {
-                emptySlots.insert(pos);
-            }
+            emptySlots.reset(cubeDimensions);
 
             // remove slots from empty list
             for (const auto& itemRef : ItemLocationReference[d2ce::EnumItemLocation::STORED][itemAltLocation])
@@ -20545,13 +20775,7 @@ void d2ce::Items::findItems()
                 auto posY = std::uint16_t(itemRef.get().getPositionY());
                 if (itemRef.get().getDimensions(dimensions))
                 {
-                    for (std::uint16_t y = posY; y < std::uint16_t(posY + dimensions.Height); ++y)
-                    {
-                        for (std::uint16_t x = posX; x < std::uint16_t(posX + dimensions.Width); ++x)
-                        {
-                            emptySlots.erase(y * cubeDimensions.Width + x);
-                        }
-                    }
+                    emptySlots.occupy(posX, posY, dimensions.Width, dimensions.Height);
                 }
             }
         }
@@ -20575,11 +20799,7 @@ void d2ce::Items::findSharedStashItems()
         auto& emptySlots = ItemLocationEmptySpots[d2ce::EnumItemLocation::STORED][d2ce::EnumAltItemLocation::STASH];
         if (getItemLocationDimensions(d2ce::EnumAltItemLocation::STASH, stashDimensions))
         {
-            std::uint16_t totalPos = stashDimensions.InvHeight * stashDimensions.InvWidth;
-            for (std::uint16_t pos = 0; pos < totalPos; ++pos)
-            {
-                emptySlots.insert(pos);
-            }
+            emptySlots.reset(stashDimensions);
         }
     }
 
@@ -20616,28 +20836,22 @@ void d2ce::Items::findSharedStashItems()
             auto& emptySlots = ItemLocationEmptySpots[d2ce::EnumItemLocation::STORED][d2ce::EnumAltItemLocation::STASH];
             auto posX = std::uint16_t(item.getPositionX());
             auto posY = std::uint16_t(item.getPositionY());
-            for (std::uint16_t y = posY; y < std::uint16_t(posY + dimensions.Height); ++y)
-            {
-                for (std::uint16_t x = posX; x < std::uint16_t(posX + dimensions.Width); ++x)
-                {
-                    emptySlots.erase(y * stashDimensions.Width + x);
-                }
-            }
+            emptySlots.occupy(posX, posY, dimensions.Width, dimensions.Height);
         }
     }
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::readItems(std::FILE* charfile, std::list<d2ce::Item>& items)
+bool d2ce::Items::readItems(BitSource& charfile, d2ce::ItemList& items)
 {
     items.clear();
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != ITEM_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != ITEM_MARKER[1])
     {
         return false;
@@ -20645,7 +20859,7 @@ bool d2ce::Items::readItems(std::FILE* charfile, std::list<d2ce::Item>& items)
 
     // found item marker
     std::uint16_t numItems = 0;
-    std::fread(&numItems, sizeof(numItems), 1, charfile);
+    charfile.read(&numItems, sizeof(numItems));
     if (numItems > 0)
     {
         if (!fillItemsArray(charfile, numItems, items))
@@ -20658,17 +20872,17 @@ bool d2ce::Items::readItems(std::FILE* charfile, std::list<d2ce::Item>& items)
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::readSharedStashPage(std::FILE* charfile, std::list<d2ce::Item>& items)
+bool d2ce::Items::readSharedStashPage(BitSource& charfile, d2ce::ItemList& items)
 {
     items.clear();
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != ITEM_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != ITEM_MARKER[1])
     {
         return false;
@@ -20676,7 +20890,7 @@ bool d2ce::Items::readSharedStashPage(std::FILE* charfile, std::list<d2ce::Item>
 
     // found item marker
     std::uint16_t numItems = 0;
-    std::fread(&numItems, sizeof(numItems), 1, charfile);
+    charfile.read(&numItems, sizeof(numItems));
     if (numItems > 0)
     {
         if (!fillItemsArray(charfile, numItems, items))
@@ -20689,11 +20903,156 @@ bool d2ce::Items::readSharedStashPage(std::FILE* charfile, std::list<d2ce::Item>
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::fillItemsArray(std::FILE* charfile, std::uint16_t numItems, std::list<d2ce::Item>& items)
+void d2ce::Items::readItemsParallel(BitSource& charfile, std::uint16_t numItems, d2ce::ItemList& items)
 {
+    size_t maxThreads = size_t(std::thread::hardware_concurrency());
+    if (s_maxReadThreads != 0)
+    {
+        maxThreads = std::min(maxThreads, s_maxReadThreads);
+    }
+
+    if (maxThreads <= 1)
+    {
+        return;
+    }
+
+    struct ParsedItem
+    {
+        ItemList Item;     // a list so the decoded item can be spliced into place
+        size_t EndPos = 0; // 0 if no item could be decoded at this marker
+    };
+
+    // the workers take no locks of their own, the tables stay locked by this thread until they are done
+    auto gameData = activateGameDataContext();
+    auto version = Version;
+    auto isExpansion = isExpansionItems();
+    const std::uint8_t* buffer = charfile.data();
+    size_t bufferSize = charfile.size();
+    size_t pos = charfile.tell();
+    std::vector<size_t> itemStarts;
+    bool bFailed = false;
+    while (!bFailed && (items.size() < numItems))
+    {
+        // Every item left to read starts with an item marker at or after the read position,
+        // so taking no more markers than there are items left never runs past the end of this
+        // list into the corpse, mercenary or golem items that follow it. Markers of socketed
+        // items or that happen to be inside an item's bits use up a slot and are dropped
+        // when the items are stitched together, the next round picks up from there.
+        size_t numLeft = size_t(numItems) - items.size();
+        if (numLeft < MIN_PARALLEL_READ_ITEMS)
+        {
+            break;
+        }
+
+        itemStarts.clear();
+        for (size_t scanPos = pos; (scanPos + 1 < bufferSize) && (itemStarts.size() < numLeft); ++scanPos)
+        {
+            if (buffer[scanPos] == ITEM_MARKER[0] && buffer[scanPos + 1] == ITEM_MARKER[1])
+            {
+                itemStarts.push_back(scanPos);
+            }
+        }
+
+        if (itemStarts.empty() || itemStarts.front() != pos)
+        {
+            break;
+        }
+
+        size_t numChunks = (itemStarts.size() + PARALLEL_READ_CHUNK_SIZE - 1) / PARALLEL_READ_CHUNK_SIZE;
+        std::vector<ParsedItem> parsedItems(itemStarts.size());
+        std::vector<std::promise<void>> chunkDone(numChunks);
+        std::vector<std::future<void>> chunkReady;
+        chunkReady.reserve(numChunks);
+        for (auto& promise : chunkDone)
+        {
+            chunkReady.push_back(promise.get_future());
+        }
+
+        std::atomic<size_t> nextChunk{ 0 };
+        std::atomic<bool> bDone{ false };
+        auto worker = [&]()
+        {
+            for (size_t chunk = nextChunk++; chunk < numChunks && !bDone; chunk = nextChunk++)
+            {
+                size_t lastIdx = std::min((chunk + 1) * PARALLEL_READ_CHUNK_SIZE, itemStarts.size());
+                for (size_t idx = chunk * PARALLEL_READ_CHUNK_SIZE; idx < lastIdx && !bDone; ++idx)
+                {
+                    auto& parsedItem = parsedItems[idx];
+                    try
+                    {
+                        // each item reads from its own view, so the results match a sequential read
+                        BitSource source(buffer + itemStarts[idx], bufferSize - itemStarts[idx]);
+                        parsedItem.Item.resize(1);
+                        if (parsedItem.Item.back().readItem(version, isExpansion, source) && !source.eof())
+                        {
+                            parsedItem.EndPos = itemStarts[idx] + source.tell();
+                        }
+                    }
+                    catch (const std::exception&)
+                    {
+                        parsedItem.EndPos = 0;
+                    }
+                }
+
+                chunkDone[chunk].set_value();
+            }
+        };
+
+        size_t numThreads = std::min(maxThreads, numChunks);
+        std::vector<std::future<void>> workers;
+        workers.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i)
+        {
+            workers.push_back(std::async(std::launch::async, worker));
+        }
+
+        // Stitch the items back together in file order, the first item starts at the read
+        // position and each item ends where the next one starts
+        auto iter = itemStarts.begin();
+        while (items.size() < numItems)
+        {
+            iter = std::lower_bound(iter, itemStarts.end(), pos);
+            if (iter == itemStarts.end())
+            {
+                // the rest of the items start past the markers of this round
+                break;
+            }
+
+            size_t idx = size_t(iter - itemStarts.begin());
+            chunkReady[idx / PARALLEL_READ_CHUNK_SIZE].wait();
+            auto& parsedItem = parsedItems[idx];
+            if ((*iter != pos) || (parsedItem.EndPos == 0))
+            {
+                bFailed = true;
+                break;
+            }
+
+            items.splice(items.end(), parsedItem.Item);
+            pos = parsedItem.EndPos;
+        }
+
+        bDone = true;
+        for (auto& thread : workers)
+        {
+            thread.wait();
+        }
+    }
+
+    // the sequential read picks up from here if an item could not be stitched
+    charfile.seek(pos);
+}
+//---------------------------------------------------------------------------
+bool d2ce::Items::fillItemsArray(BitSource& charfile, std::uint16_t numItems, d2ce::ItemList& items)
+{
+    if ((Version >= EnumItemVersion::v107) && (Version < EnumItemVersion::v100R) && (numItems >= MIN_PARALLEL_READ_ITEMS))
+    {
+        // pre-D2R items are byte aligned and start with the item marker, so they can be decoded in parallel
+        readItemsParallel(charfile, numItems, items);
+    }
+
     while (items.size() < numItems)
     {
-        if (feof(charfile))
+        if (charfile.eof())
         {
             return false;
         }
@@ -20717,7 +21076,7 @@ bool d2ce::Items::fillItemsArray(std::FILE* charfile, std::uint16_t numItems, st
     return numItems == items.size() ? true : false;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::readItemsList(const Json::Value& itemListroot, bool bSerializedFormat, std::list<Item>& items)
+bool d2ce::Items::readItemsList(const Json::Value& itemListroot, bool bSerializedFormat, ItemList& items)
 {
     if (!itemListroot.isNull())
     {
@@ -20731,7 +21090,7 @@ bool d2ce::Items::readItemsList(const Json::Value& itemListroot, bool bSerialize
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::readItems(const Json::Value& root, bool bSerializedFormat, std::list<Item>& items)
+bool d2ce::Items::readItems(const Json::Value& root, bool bSerializedFormat, ItemList& items)
 {
     bool checkItemCount = false;
     std::uint16_t expectedNumOfItems = 0;
@@ -20779,7 +21138,7 @@ bool d2ce::Items::readItems(const Json::Value& root, bool bSerializedFormat, std
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::fillItemsArray(const Json::Value& itemsRoot, bool bSerializedFormat, std::list<Item>& items)
+bool d2ce::Items::fillItemsArray(const Json::Value& itemsRoot, bool bSerializedFormat, ItemList& items)
 {
     if (itemsRoot.isNull())
     {
@@ -20807,24 +21166,24 @@ bool d2ce::Items::fillItemsArray(const Json::Value& itemsRoot, bool bSerializedF
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::readCorpseItems(std::FILE* charfile)
+bool d2ce::Items::readCorpseItems(BitSource& charfile)
 {
     CorpseInfo.clear();
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != ITEM_MARKER[0])
     {
         return false;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != ITEM_MARKER[1])
     {
         return false;
     }
 
     // found item marker
-    std::fread(&CorpseInfo.IsDead, sizeof(CorpseInfo.IsDead), 1, charfile);
+    charfile.read(&CorpseInfo.IsDead, sizeof(CorpseInfo.IsDead));
     if (CorpseInfo.IsDead > 1)
     {
         return false;
@@ -20832,9 +21191,9 @@ bool d2ce::Items::readCorpseItems(std::FILE* charfile)
 
     if (CorpseInfo.IsDead > 0)
     {
-        std::fread(&CorpseInfo.Unknown, sizeof(CorpseInfo.Unknown), 1, charfile);
-        std::fread(&CorpseInfo.X, sizeof(CorpseInfo.X), 1, charfile);
-        std::fread(&CorpseInfo.Y, sizeof(CorpseInfo.Y), 1, charfile);
+        charfile.read(&CorpseInfo.Unknown, sizeof(CorpseInfo.Unknown));
+        charfile.read(&CorpseInfo.X, sizeof(CorpseInfo.X));
+        charfile.read(&CorpseInfo.Y, sizeof(CorpseInfo.Y));
         if (!readItems(charfile, CorpseItems))
         {
             return false;
@@ -20975,32 +21334,32 @@ bool d2ce::Items::readCorpseItems(const Json::Value& root, bool bSerializedForma
     return true;
 }
 //---------------------------------------------------------------------------
-void d2ce::Items::readMercItems(std::FILE* charfile)
+void d2ce::Items::readMercItems(BitSource& charfile)
 {
     if (!isExpansionItems())
     {
         if (Version < EnumItemVersion::v109)
         {
             MercId_v100 = 0;
-            if (feof(charfile))
+            if (charfile.eof())
             {
                 return;
             }
 
             std::uint8_t value = 0;
-            std::fread(&value, sizeof(value), 1, charfile);
+            charfile.read(&value, sizeof(value));
             if (value != ITEM_MARKER[0])
             {
                 return;
             }
 
-            std::fread(&value, sizeof(value), 1, charfile);
+            charfile.read(&value, sizeof(value));
             if (value != ITEM_MARKER[1])
             {
                 return;
             }
 
-            std::fread(&MercId_v100, 6, 1, charfile);
+            charfile.read(&MercId_v100, 6);
         }
         return;
     }
@@ -21008,29 +21367,29 @@ void d2ce::Items::readMercItems(std::FILE* charfile)
     bool bHasMercId = true;
     MercItems.clear();
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != MERC_ITEM_MARKER[0])
     {
         return;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != MERC_ITEM_MARKER[1])
     {
         return;
     }
 
     // look ahead for no merc case
-    if (!feof(charfile))
+    if (!charfile.eof())
     {
-        auto startLoc = std::ftell(charfile);
-        std::fread(&value, sizeof(value), 1, charfile);
+        auto startLoc = charfile.tell();
+        charfile.read(&value, sizeof(value));
         if (value != ITEM_MARKER[0])
         {
             bHasMercId = false;
         }
 
-        std::fseek(charfile, startLoc, SEEK_SET);
+        charfile.seek(startLoc);
     }
 
     if (bHasMercId)
@@ -21138,17 +21497,17 @@ void d2ce::Items::readMercItems(const Json::Value& root, bool bSerializedFormat)
     readGolemItem(root, bSerializedFormat);
 }
 //---------------------------------------------------------------------------
-void d2ce::Items::readGolemItem(std::FILE* charfile)
+void d2ce::Items::readGolemItem(BitSource& charfile)
 {
     GolemItem.clear();
     std::uint8_t value = 0;
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != GOLEM_ITEM_MARKER[0])
     {
         return;
     }
 
-    std::fread(&value, sizeof(value), 1, charfile);
+    charfile.read(&value, sizeof(value));
     if (value != GOLEM_ITEM_MARKER[1])
     {
         return;
@@ -21156,7 +21515,7 @@ void d2ce::Items::readGolemItem(std::FILE* charfile)
 
     // found golem item marker (0x464B). 
     std::uint8_t hasGolem = 0;
-    std::fread(&hasGolem, sizeof(hasGolem), 1, charfile);
+    charfile.read(&hasGolem, sizeof(hasGolem));
     if (hasGolem != 0)
     {
         GolemItem.resize(GolemItem.size() + 1);
@@ -21222,27 +21581,26 @@ void d2ce::Items::readGolemItem(const Json::Value& root, bool bSerializedFormat)
     }
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::writeCorpseItems(std::FILE* charfile) const
+bool d2ce::Items::writeCorpseItems(BitSink& charfile) const
 {
-    std::fwrite(ITEM_MARKER.data(), ITEM_MARKER.size(), 1, charfile);
+    charfile.write(ITEM_MARKER.data(), ITEM_MARKER.size(), 1);
     if (CorpseInfo.IsDead != 1 || CorpseItems.empty())
     {
         CorpseInfo.clear();
         CorpseItems.clear();
     }
 
-    std::fwrite(&CorpseInfo.IsDead, sizeof(CorpseInfo.IsDead), 1, charfile);
-    std::fflush(charfile);
+    charfile.write(&CorpseInfo.IsDead, sizeof(CorpseInfo.IsDead), 1);
 
     if (CorpseInfo.IsDead > 0)
     {
-        std::fwrite(&CorpseInfo.Unknown, sizeof(CorpseInfo.Unknown), 1, charfile);
-        std::fwrite(&CorpseInfo.X, sizeof(CorpseInfo.X), 1, charfile);
-        std::fwrite(&CorpseInfo.Y, sizeof(CorpseInfo.Y), 1, charfile);
+        charfile.write(&CorpseInfo.Unknown, sizeof(CorpseInfo.Unknown), 1);
+        charfile.write(&CorpseInfo.X, sizeof(CorpseInfo.X), 1);
+        charfile.write(&CorpseInfo.Y, sizeof(CorpseInfo.Y), 1);
 
-        std::fwrite(ITEM_MARKER.data(), ITEM_MARKER.size(), 1, charfile);
+        charfile.write(ITEM_MARKER.data(), ITEM_MARKER.size(), 1);
         std::uint16_t numItems = (std::uint16_t)CorpseItems.size();
-        std::fwrite(&numItems, sizeof(numItems), 1, charfile);
+        charfile.write(&numItems, sizeof(numItems), 1);
         for (auto& item : CorpseItems)
         {
             if (!item.writeItem(charfile))
@@ -21255,25 +21613,25 @@ bool d2ce::Items::writeCorpseItems(std::FILE* charfile) const
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::writeMercItems(std::FILE* charfile) const
+bool d2ce::Items::writeMercItems(BitSink& charfile) const
 {
     if (!isExpansionItems())
     {
         if (Version < EnumItemVersion::v109)
         {
-            std::fwrite(ITEM_MARKER.data(), ITEM_MARKER.size(), 1, charfile);
-            std::fwrite(&MercId_v100, 6, 1, charfile);
+            charfile.write(ITEM_MARKER.data(), ITEM_MARKER.size(), 1);
+            charfile.write(&MercId_v100, 6, 1);
         }
         return true;
     }
 
-    std::fwrite(MERC_ITEM_MARKER.data(), MERC_ITEM_MARKER.size(), 1, charfile);
+    charfile.write(MERC_ITEM_MARKER.data(), MERC_ITEM_MARKER.size(), 1);
     std::uint16_t numItems = (std::uint16_t)MercItems.size();
     if (numItems > 0 || isMercHired)
     {
         isMercHired = true;
-        std::fwrite(ITEM_MARKER.data(), ITEM_MARKER.size(), 1, charfile);
-        std::fwrite(&numItems, sizeof(numItems), 1, charfile);
+        charfile.write(ITEM_MARKER.data(), ITEM_MARKER.size(), 1);
+        charfile.write(&numItems, sizeof(numItems), 1);
         for (auto& item : MercItems)
         {
             if (!item.writeItem(charfile))
@@ -21286,11 +21644,11 @@ bool d2ce::Items::writeMercItems(std::FILE* charfile) const
     return writeGolemItem(charfile);
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::writeGolemItem(std::FILE* charfile) const
+bool d2ce::Items::writeGolemItem(BitSink& charfile) const
 {
-    std::fwrite(GOLEM_ITEM_MARKER.data(), GOLEM_ITEM_MARKER.size(), 1, charfile);
+    charfile.write(GOLEM_ITEM_MARKER.data(), GOLEM_ITEM_MARKER.size(), 1);
     std::uint8_t hasGolem = GolemItem.empty() ? 0 : 1;
-    std::fwrite(&hasGolem, sizeof(hasGolem), 1, charfile);
+    charfile.write(&hasGolem, sizeof(hasGolem), 1);
     if (!GolemItem.empty())
     {
         if (!GolemItem.back().writeItem(charfile))
@@ -21302,7 +21660,7 @@ bool d2ce::Items::writeGolemItem(std::FILE* charfile) const
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::readItems(const Character& charInfo, std::FILE* charfile)
+bool d2ce::Items::readItems(const Character& charInfo, BitSource& charfile)
 {
     bool isExpansion = charInfo.isExpansionCharacter();
     Version = ConvertCharVersion(charInfo.getVersion());
@@ -21328,6 +21686,7 @@ bool d2ce::Items::readItems(const Character& charInfo, std::FILE* charfile)
     }
 
     isMercHired = false;
+    m_gameData = ItemHelpers::getGameDataContext();
     GPSs.clear();
     Stackables.clear();
     Armor.clear();
@@ -21348,7 +21707,7 @@ bool d2ce::Items::readItems(const Character& charInfo, std::FILE* charfile)
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::readSharedStashPage(EnumCharVersion version, std::FILE* charfile)
+bool d2ce::Items::readSharedStashPage(EnumCharVersion version, BitSource& charfile)
 {
     clear();
     IsSharedStash = true;
@@ -21372,6 +21731,7 @@ bool d2ce::Items::readSharedStashPage(EnumCharVersion version, std::FILE* charfi
     }
 
     isMercHired = false;
+    m_gameData = ItemHelpers::getGameDataContext();
     GPSs.clear();
     Stackables.clear();
     Armor.clear();
@@ -21412,6 +21772,7 @@ bool d2ce::Items::readItems(const Json::Value& root, bool bSerializedFormat, con
     }
 
     isMercHired = false;
+    m_gameData = ItemHelpers::getGameDataContext();
     if (!readItems(root, bSerializedFormat, Inventory))
     {
         return false;
@@ -21429,7 +21790,7 @@ bool d2ce::Items::readItems(const Json::Value& root, bool bSerializedFormat, con
 }
 //---------------------------------------------------------------------------
 // write items in place at offset saved from reasding
-bool d2ce::Items::writeItems(std::FILE* charfile, bool isExpansion, bool hasMercID) const
+bool d2ce::Items::writeItems(BitSink& charfile, bool isExpansion, bool hasMercID) const
 {
     switch (getDefaultItemVersion())
     {
@@ -21456,9 +21817,9 @@ bool d2ce::Items::writeItems(std::FILE* charfile, bool isExpansion, bool hasMerc
     isMercHired = !MercItems.empty() || hasMercID;
 
     // Write Items
-    std::fwrite(ITEM_MARKER.data(), ITEM_MARKER.size(), 1, charfile);
+    charfile.write(ITEM_MARKER.data(), ITEM_MARKER.size(), 1);
     std::uint16_t numItems = (std::uint16_t)Inventory.size();
-    std::fwrite(&numItems, sizeof(numItems), 1, charfile);
+    charfile.write(&numItems, sizeof(numItems), 1);
     for (auto& item : Inventory)
     {
         if (!item.writeItem(charfile))
@@ -21481,12 +21842,12 @@ bool d2ce::Items::writeItems(std::FILE* charfile, bool isExpansion, bool hasMerc
     return true;
 }
 //---------------------------------------------------------------------------
-bool d2ce::Items::writeSharedStashPage(std::FILE* charfile) const
+bool d2ce::Items::writeSharedStashPage(BitSink& charfile) const
 {
     // Write Items
-    std::fwrite(ITEM_MARKER.data(), ITEM_MARKER.size(), 1, charfile);
+    charfile.write(ITEM_MARKER.data(), ITEM_MARKER.size(), 1);
     std::uint16_t numItems = (std::uint16_t)Inventory.size();
-    std::fwrite(&numItems, sizeof(numItems), 1, charfile);
+    charfile.write(&numItems, sizeof(numItems), 1);
     for (auto& item : Inventory)
     {
         if (!item.writeItem(charfile))
@@ -21778,20 +22139,18 @@ bool d2ce::Items::isExpansionItems() const
 //---------------------------------------------------------------------------
 void d2ce::Items::verifyBeltSlots()
 {
+    // also when the belt was the last equipped item
     auto& equippedLocationReference = ItemLocationReference[d2ce::EnumItemLocation::EQUIPPED][d2ce::EnumAltItemLocation::UNKNOWN];
-    if (!equippedLocationReference.empty())
+    auto beltIter = std::find_if(equippedLocationReference.begin(), equippedLocationReference.end(), ItemEnumEquippedIdPredicate(EnumEquippedId::BELT));
+    if (beltIter == equippedLocationReference.end())
     {
-        auto iter = std::find_if(equippedLocationReference.begin(), equippedLocationReference.end(), ItemEnumEquippedIdPredicate(EnumEquippedId::BELT));
-        if (iter == equippedLocationReference.end())
-        {
-            HasBeltEquipped = false;
-            EquippedBeltSlots = 0;
-        }
-        else
-        {
-            HasBeltEquipped = true;
-            EquippedBeltSlots = iter->get().getTotalItemSlots();
-        }
+        HasBeltEquipped = false;
+        EquippedBeltSlots = 0;
+    }
+    else
+    {
+        HasBeltEquipped = true;
+        EquippedBeltSlots = beltIter->get().getTotalItemSlots();
     }
 
     auto locationId = d2ce::EnumItemLocation::BELT;
@@ -21801,22 +22160,18 @@ void d2ce::Items::verifyBeltSlots()
 
     ItemDimensions invDimensions;
     getItemLocationDimensions(d2ce::EnumItemLocation::BELT, invDimensions);
-    invEmptySlots.clear();
+    invEmptySlots.reset(invDimensions);
     std::uint16_t totalPos = invDimensions.InvHeight * invDimensions.InvWidth;
-    for (std::uint16_t pos = 0; pos < totalPos; ++pos)
-    {
-        invEmptySlots.insert(pos);
-    }
 
     // remove slots from empty list that fit into the belt
-    std::list<Item> itemToMove; // non-empty if given belt items need moving
+    ItemList itemToMove; // non-empty if given belt items need moving
     std::uint16_t posX = 0;
     for (const auto& itemRef : invLocationReference)
     {
         posX = itemRef.get().getPositionX();
         if (posX < totalPos)
         {
-            invEmptySlots.erase(posX);
+            invEmptySlots.occupy(posX, 0);
         }
     }
 
@@ -21836,11 +22191,11 @@ void d2ce::Items::verifyBeltSlots()
             bRemoveItem = true;
             if (!invEmptySlots.empty())
             {
-                posX = *invEmptySlots.begin();
+                posX = invEmptySlots.front();
                 if (iter->setLocation(d2ce::EnumItemLocation::BELT, posX, 0))
                 {
                     bRemoveItem = false;
-                    invEmptySlots.erase(posX);
+                    invEmptySlots.occupy(posX, 0);
                 }
             }
 
@@ -21865,7 +22220,7 @@ void d2ce::Items::verifyBeltSlots()
         auto iter = std::find_if(BufferItems.begin(), BufferItems.end(), ItemIsBeltablePredicate());
         while (iter != BufferItems.end() && !invEmptySlots.empty())
         {
-            posX = *(invEmptySlots.begin());
+            posX = invEmptySlots.front();
             auto& item = *iter;
             if (!item.setLocation(d2ce::EnumItemLocation::BELT, posX, 0))
             {
@@ -21873,7 +22228,7 @@ void d2ce::Items::verifyBeltSlots()
                 continue;
             }
 
-            invEmptySlots.erase(posX);
+            invEmptySlots.occupy(posX, 0);
 
             Inventory.splice(Inventory.end(), BufferItems, iter);
             if (std::find_if(invLocationReference.begin(), invLocationReference.end(), ItemPredicate(item)) == invLocationReference.end())
@@ -21948,10 +22303,10 @@ void d2ce::Items::verifyBeltSlots()
                 GPSs.push_back(item);
             }
 
-            posX = *(pInvEmptySlots->begin());
+            posX = pInvEmptySlots->front();
             if (item.setLocation(locationId, altPositionId, posX % invDimensions.Width, posX / invDimensions.Width))
             {
-                pInvEmptySlots->erase(posX);
+                pInvEmptySlots->occupy(posX, 0);
             }
         }
     }
@@ -21997,11 +22352,7 @@ void d2ce::Items::verifyRestrictedItems()
         ItemDimensions invItemDimensions;
         if (getItemLocationDimensions(itemAltLocation, cubeDimensions))
         {
-            std::uint16_t totalPos = cubeDimensions.InvHeight * cubeDimensions.InvWidth;
-            for (std::uint16_t pos = 0; pos < totalPos; ++pos)
-            {
-                emptySlots.insert(pos);
-            }
+            emptySlots.reset(cubeDimensions);
 
             // move any Horadric Cube items in the buffer back into the inventory
             auto iter = std::find_if(BufferItems.begin(), BufferItems.end(), ItemIsInHoradricCube());
@@ -22093,13 +22444,7 @@ void d2ce::Items::verifyRestrictedItems()
                 // remove slots from empty list
                 if (item.getDimensions(dimensions))
                 {
-                    for (std::uint16_t y = positionY; y <= positionY2; ++y)
-                    {
-                        for (std::uint16_t x = positionX; x <= positionX2; ++x)
-                        {
-                            emptySlots.erase(y * cubeDimensions.Width + x);
-                        }
-                    }
+                    emptySlots.occupy(positionX, positionY, dimensions.Width, dimensions.Height);
                 }
 
                 iter = std::find_if(BufferItems.begin(), BufferItems.end(), ItemIsInHoradricCube());
@@ -22110,7 +22455,7 @@ void d2ce::Items::verifyRestrictedItems()
     }
 
     // Horadric Cube was removed, make sure any items located in there are removed as well
-    std::list<Item> itemToMove; // non-empty if given Horadric Cube items need moving
+    ItemList itemToMove; // non-empty if given Horadric Cube items need moving
 
     auto iter = Inventory.begin();
     for (const auto& itemRef : invLocationReference)
@@ -22158,6 +22503,173 @@ void d2ce::Items::verifyRestrictedItems()
     BufferItems.splice(BufferItems.end(), itemToMove, itemToMove.begin(), itemToMove.end());
 }
 //---------------------------------------------------------------------------
+void d2ce::Items::removeItemIndex(const d2ce::Item& item)
+{
+    const auto& itemType = item.getItemTypeHelper();
+    if (itemType.isStackable())
+    {
+        d2ce::removeItem_if(Stackables, ItemPredicate(item));
+
+        if (itemType.isWeapon())
+        {
+            d2ce::removeItem_if(Weapons, ItemPredicate(item));
+        }
+    }
+    else if (itemType.isWeapon())
+    {
+        d2ce::removeItem_if(Weapons, ItemPredicate(item));
+    }
+    else if (itemType.isArmor())
+    {
+        d2ce::removeItem_if(Armor, ItemPredicate(item));
+    }
+    else if (itemType.isGPSItem())
+    {
+        d2ce::removeItem_if(GPSs, ItemPredicate(item));
+    }
+
+    if (!IsSharedStash && item.isRestrictedItem())
+    {
+        // drop one entry, the inventory may hold other items of the same type
+        auto iter = std::find_if(HasRestrictedItem.begin(), HasRestrictedItem.end(), [&itemType](const ItemType& restrictedType)
+            {
+                return &restrictedType == &itemType;
+            });
+        if (iter != HasRestrictedItem.end())
+        {
+            HasRestrictedItem.erase(iter);
+        }
+    }
+
+    auto locationId = item.getLocation();
+    auto altPositionId = item.getAltPositionId();
+    if (IsSharedStash)
+    {
+        // all shared stash items are in the stash grid
+        locationId = d2ce::EnumItemLocation::STORED;
+        altPositionId = d2ce::EnumAltItemLocation::STASH;
+    }
+
+    switch (locationId)
+    {
+    case d2ce::EnumItemLocation::STORED:
+        break;
+
+    case d2ce::EnumItemLocation::BELT:
+    case d2ce::EnumItemLocation::EQUIPPED:
+        altPositionId = d2ce::EnumAltItemLocation::UNKNOWN;
+        break;
+
+    default:
+        return;
+    }
+
+    d2ce::removeItem_if(ItemLocationReference[locationId][altPositionId], ItemPredicate(item));
+
+    // mark item slots as empty again
+    ItemDimensions dimensions;
+    switch (locationId)
+    {
+    case d2ce::EnumItemLocation::BELT:
+        ItemLocationEmptySpots[locationId][altPositionId].release(std::uint16_t(item.getPositionX()), 0);
+        break;
+
+    case d2ce::EnumItemLocation::STORED:
+        if (item.getDimensions(dimensions))
+        {
+            ItemLocationEmptySpots[locationId][altPositionId].release(std::uint16_t(item.getPositionX()), std::uint16_t(item.getPositionY()), dimensions.Width, dimensions.Height);
+        }
+        break;
+    }
+}
+#ifdef _DEBUG
+//---------------------------------------------------------------------------
+// Compares the incrementally maintained item indexes with a full rebuild by findItems
+void d2ce::Items::checkItemIndexes()
+{
+    auto getItems = [](const std::vector<std::reference_wrapper<Item>>& items)
+    {
+        std::vector<const Item*> result;
+        for (const auto& itemRef : items)
+        {
+            result.push_back(&itemRef.get());
+        }
+
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    auto getItemTypes = [](const std::vector<std::reference_wrapper<ItemType>>& itemTypes)
+    {
+        std::vector<const ItemType*> result;
+        for (const auto& itemTypeRef : itemTypes)
+        {
+            result.push_back(&itemTypeRef.get());
+        }
+
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    auto gpss = GPSs;
+    auto stackables = Stackables;
+    auto armor = Armor;
+    auto weapons = Weapons;
+    auto itemLocationReference = ItemLocationReference;
+    auto itemLocationEmptySpots = ItemLocationEmptySpots;
+    auto hasRestrictedItem = HasRestrictedItem;
+    auto hasBeltEquipped = HasBeltEquipped;
+    auto equippedBeltSlots = EquippedBeltSlots;
+
+    findItems();
+    assert(getItems(GPSs) == getItems(gpss));
+    assert(getItems(Stackables) == getItems(stackables));
+    assert(getItems(Armor) == getItems(armor));
+    assert(getItems(Weapons) == getItems(weapons));
+    assert(getItemTypes(HasRestrictedItem) == getItemTypes(hasRestrictedItem));
+    assert(HasBeltEquipped == hasBeltEquipped);
+    assert(EquippedBeltSlots == equippedBeltSlots);
+    for (const auto& location : ItemLocationReference)
+    {
+        for (const auto& altLocation : location.second)
+        {
+            assert(getItems(altLocation.second) == getItems(itemLocationReference[location.first][altLocation.first]));
+        }
+    }
+
+    for (const auto& location : ItemLocationEmptySpots)
+    {
+        for (const auto& altLocation : location.second)
+        {
+            const auto& grid = itemLocationEmptySpots[location.first][altLocation.first];
+            assert(altLocation.second.Width == grid.Width);
+            assert(altLocation.second.Rows == grid.Rows);
+        }
+    }
+
+    for (const auto& location : itemLocationEmptySpots)
+    {
+        for (const auto& altLocation : location.second)
+        {
+            const auto& grid = ItemLocationEmptySpots[location.first][altLocation.first];
+            assert(altLocation.second.Width == grid.Width);
+            assert(altLocation.second.Rows == grid.Rows);
+        }
+    }
+
+    // keep the maintained order of the indexes
+    GPSs.swap(gpss);
+    Stackables.swap(stackables);
+    Armor.swap(armor);
+    Weapons.swap(weapons);
+    ItemLocationReference.swap(itemLocationReference);
+    ItemLocationEmptySpots.swap(itemLocationEmptySpots);
+    HasRestrictedItem.swap(hasRestrictedItem);
+    HasBeltEquipped = hasBeltEquipped;
+    EquippedBeltSlots = equippedBeltSlots;
+}
+#endif
+//---------------------------------------------------------------------------
 /*
    Thanks goes to Stoned2000 for making his checksum calculation source
    available to the public.  The Visual Basic source for his editor can be
@@ -22440,7 +22952,7 @@ d2ce::Items::Items() : BufferItems(Buffer)
 {
 }
 //---------------------------------------------------------------------------
-d2ce::Items::Items(std::list<Item>& bufferItems) : BufferItems(bufferItems)
+d2ce::Items::Items(ItemList& bufferItems) : BufferItems(bufferItems)
 {
 }
 //---------------------------------------------------------------------------
@@ -22464,6 +22976,7 @@ d2ce::Items& d2ce::Items::operator=(const Items& other)
     Version = other.Version;
     GameVersion = other.GameVersion;
 
+    // each item and socketed item still gets its own list node, only their bits are shared
     Inventory = other.Inventory;
 
     CorpseInfo = other.CorpseInfo;
@@ -22474,6 +22987,7 @@ d2ce::Items& d2ce::Items::operator=(const Items& other)
     GolemItem = other.GolemItem;
 
     isMercHired = other.isMercHired;
+    m_gameData = other.m_gameData;
 
     Buffer = other.Buffer;
     LastItemMoved = other.LastItemMoved;
@@ -22522,6 +23036,7 @@ d2ce::Items& d2ce::Items::operator=(Items&& other) noexcept
     other.GolemItem.clear();
 
     isMercHired = std::exchange(other.isMercHired, false);
+    m_gameData = std::exchange(other.m_gameData, nullptr);
 
     Buffer.swap(other.Buffer);
     LastItemMoved = std::exchange(other.LastItemMoved, nullptr);
@@ -22539,6 +23054,26 @@ void d2ce::Items::clear()
     *this = Items();
 }
 //---------------------------------------------------------------------------
+d2ce::GameDataContextPtr d2ce::Items::getGameDataContext() const
+{
+    return m_gameData;
+}
+//---------------------------------------------------------------------------
+d2ce::GameDataScope d2ce::Items::activateGameDataContext() const
+{
+    return GameDataScope(m_gameData);
+}
+//---------------------------------------------------------------------------
+void d2ce::Items::setMaxReadThreads(size_t numThreads)
+{
+    s_maxReadThreads = numThreads;
+}
+//---------------------------------------------------------------------------
+size_t d2ce::Items::getMaxReadThreads()
+{
+    return s_maxReadThreads;
+}
+//---------------------------------------------------------------------------
 /*
    Returns true if there are non-perfect gems.
    Returns false if no gems or all gems are perfect.
@@ -22884,7 +23419,7 @@ const std::vector<std::reference_wrapper<d2ce::Item>>& d2ce::Items::getWeapons()
     return Weapons;
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& d2ce::Items::getMercItems() const
+const d2ce::ItemList& d2ce::Items::getMercItems() const
 {
     return MercItems;
 }
@@ -23065,7 +23600,7 @@ bool d2ce::Items::hasCorpse() const
     return CorpseInfo.IsDead == 1 ? true : false;
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& d2ce::Items::getCorpseItems() const
+const d2ce::ItemList& d2ce::Items::getCorpseItems() const
 {
     return CorpseItems;
 }
@@ -23075,7 +23610,7 @@ bool d2ce::Items::hasGolem() const
     return GolemItem.empty() ? false : true;
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& d2ce::Items::getGolemItem() const
+const d2ce::ItemList& d2ce::Items::getGolemItem() const
 {
     return GolemItem;
 }
@@ -23090,11 +23625,27 @@ d2ce::Item d2ce::Items::removeItem(const d2ce::Item& item)
         if (&invItem == &item)
         {
             // found the item
+            bool bCheckEquippedBelt = (invItem.getLocation() == EnumItemLocation::EQUIPPED) && invItem.isBelt();
+            bool bCheckRestrictedItems = !IsSharedStash && invItem.isRestrictedItem();
+            removeItemIndex(invItem);
+
             d2ce::Item copy;
             copy.swap(invItem);
             copy.setLocation(EnumItemLocation::BUFFER, EnumAltItemLocation::UNKNOWN, 0, 0);
             Inventory.erase(iter);
-            findItems();
+            if (bCheckEquippedBelt)
+            {
+                verifyBeltSlots();
+            }
+
+            if (bCheckRestrictedItems)
+            {
+                verifyRestrictedItems();
+            }
+
+#ifdef _DEBUG
+            checkItemIndexes();
+#endif
             return copy;
         }
     }
@@ -23111,7 +23662,6 @@ d2ce::Item d2ce::Items::removeItem(const d2ce::Item& item)
             copy.swap(invItem);
             copy.setLocation(EnumItemLocation::BUFFER, EnumAltItemLocation::UNKNOWN, 0, 0);
             CorpseItems.erase(iter);
-            findItems();
             return copy;
         }
     }
@@ -23128,7 +23678,6 @@ d2ce::Item d2ce::Items::removeItem(const d2ce::Item& item)
             copy.swap(invItem);
             copy.setLocation(EnumItemLocation::BUFFER, EnumAltItemLocation::UNKNOWN, 0, 0);
             MercItems.erase(iter);
-            findItems();
             return copy;
         }
     }
@@ -23145,7 +23694,6 @@ d2ce::Item d2ce::Items::removeItem(const d2ce::Item& item)
             copy.swap(invItem);
             copy.setLocation(EnumItemLocation::BUFFER, EnumAltItemLocation::UNKNOWN, 0, 0);
             GolemItem.erase(iter);
-            findItems();
             return copy;
         }
     }
@@ -23170,6 +23718,7 @@ bool d2ce::Items::canEquipItem(const d2ce::Item& item, EnumEquippedId equipId, E
 */
 size_t d2ce::Items::upgradeGems(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     if (GPSs.empty())
     {
         return 0;
@@ -23228,6 +23777,7 @@ size_t d2ce::Items::upgradeGems(ItemFilter filter)
 */
 size_t d2ce::Items::upgradePotions(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     if (GPSs.empty())
     {
         return 0;
@@ -23286,6 +23836,7 @@ size_t d2ce::Items::upgradePotions(ItemFilter filter)
 */
 size_t d2ce::Items::upgradeRejuvenationPotions(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     if (GPSs.empty())
     {
         return 0;
@@ -23340,6 +23891,7 @@ size_t d2ce::Items::upgradeRejuvenationPotions(ItemFilter filter)
 //---------------------------------------------------------------------------
 size_t d2ce::Items::upgradeTierAllItems(const d2ce::Character& charInfo, ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     d2ce::CharStats cs;
     charInfo.fillDisplayedCharacterStats(cs);
     bool bFiltered = false;
@@ -23457,6 +24009,7 @@ size_t d2ce::Items::upgradeTierAllItems(const d2ce::Character& charInfo, ItemFil
 */
 size_t d2ce::Items::convertGPSs(const std::array<std::uint8_t, 4>& existingGem, const std::array<std::uint8_t, 4>& desiredGem, ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     if (GPSs.empty())
     {
         return 0;
@@ -23525,6 +24078,7 @@ size_t d2ce::Items::convertGPSs(const std::array<std::uint8_t, 4>& existingGem,
 //---------------------------------------------------------------------------
 size_t d2ce::Items::fillAllStackables(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     if (Stackables.empty())
     {
         return 0;
@@ -23584,6 +24138,7 @@ size_t d2ce::Items::fillAllStackables(ItemFilter filter)
 //---------------------------------------------------------------------------
 size_t d2ce::Items::repairAllItems(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     bool bFiltered = false;
     switch (filter.LocationId)
     {
@@ -23684,6 +24239,7 @@ size_t d2ce::Items::repairAllItems(ItemFilter filter)
 //---------------------------------------------------------------------------
 size_t d2ce::Items::maxDurabilityAllItems(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     bool bFiltered = false;
     switch (filter.LocationId)
     {
@@ -23784,6 +24340,7 @@ size_t d2ce::Items::maxDurabilityAllItems(ItemFilter filter)
 //---------------------------------------------------------------------------
 size_t d2ce::Items::maxSocketCountAllItems(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     bool bFiltered = false;
     switch (filter.LocationId)
     {
@@ -23873,6 +24430,7 @@ size_t d2ce::Items::maxSocketCountAllItems(ItemFilter filter)
 //---------------------------------------------------------------------------
 size_t d2ce::Items::setMaxDefenseRatingAllItems(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     bool bFiltered = false;
     switch (filter.LocationId)
     {
@@ -23939,6 +24497,7 @@ size_t d2ce::Items::setMaxDefenseRatingAllItems(ItemFilter filter)
 //---------------------------------------------------------------------------
 size_t d2ce::Items::setIndestructibleAllItems(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     bool bFiltered = false;
     switch (filter.LocationId)
     {
@@ -24028,6 +24587,7 @@ size_t d2ce::Items::setIndestructibleAllItems(ItemFilter filter)
 //---------------------------------------------------------------------------
 size_t d2ce::Items::setSuperiorAllItems(ItemFilter filter)
 {
+    auto gameData = activateGameDataContext();
     bool bFiltered = false;
     switch (filter.LocationId)
     {
@@ -24117,6 +24677,7 @@ size_t d2ce::Items::setSuperiorAllItems(ItemFilter filter)
 //---------------------------------------------------------------------------
 bool d2ce::Items::addItem(EnumItemLocation locationId, EnumAltItemLocation altPositionId, std::array<std::uint8_t, 4>& strcode)
 {
+    auto gameData = activateGameDataContext();
     d2ce::ItemCreateParams createParams(getDefaultItemVersion(), strcode, isExpansionItems());
     Item newItem(createParams);
     if (newItem.data.empty())
@@ -24168,31 +24729,7 @@ bool d2ce::Items::addItem(EnumItemLocation locationId, EnumAltItemLocation altPo
     // make sure we have free slots
     std::uint16_t positionY = 0;
     std::uint16_t positionX = 0;
-    std::uint16_t freeSlot = MAXUINT16;
-    for (const auto& slot : itemLocationEmptySpots)
-    {
-        positionY = slot / invDimensions.InvWidth;
-        positionX = slot % invDimensions.InvWidth;
-        bool isGoodLocation = true;
-        for (std::uint16_t y = positionY; y < std::uint16_t(positionY + dimensions.Height) && isGoodLocation; ++y)
-        {
-            for (std::uint16_t x = positionX; x < std::uint16_t(positionX + dimensions.Width) && isGoodLocation; ++x)
-            {
-                if (itemLocationEmptySpots.find(y * invDimensions.InvWidth + x) == itemLocationEmptySpots.end())
-                {
-                    isGoodLocation = false;
-                }
-            }
-        }
-
-        if (isGoodLocation)
-        {
-            freeSlot = slot;
-            break;
-        }
-    }
-
-    if (freeSlot == MAXUINT16)
+    if (!itemLocationEmptySpots.findSpace(dimensions.Width, dimensions.Height, positionX, positionY))
     {
         // no room
         return false;
@@ -24201,7 +24738,7 @@ bool d2ce::Items::addItem(EnumItemLocation locationId, EnumAltItemLocation altPo
     switch (locationId)
     {
     case EnumItemLocation::BELT:
-        positionX = freeSlot;
+        positionX = positionY * invDimensions.InvWidth + positionX;
         positionY = 0;
         break;
     }
@@ -24216,6 +24753,9 @@ bool d2ce::Items::addItem(EnumItemLocation locationId, EnumAltItemLocation altPo
         return false;
     }
 
+#ifdef _DEBUG
+    checkItemIndexes();
+#endif
     return true;
 }
 //---------------------------------------------------------------------------
@@ -24236,6 +24776,7 @@ bool d2ce::Items::addItem(EnumAltItemLocation altPositionId, std::array<std::uin
 //---------------------------------------------------------------------------
 size_t d2ce::Items::fillEmptySlots(EnumItemLocation locationId, EnumAltItemLocation altPositionId, std::array<std::uint8_t, 4>& strcode)
 {
+    auto gameData = activateGameDataContext();
     size_t numAdded = 0;
     while (addItem(locationId, altPositionId, strcode))
     {
@@ -24262,6 +24803,7 @@ size_t d2ce::Items::fillEmptySlots(EnumAltItemLocation altPositionId, std::array
 //---------------------------------------------------------------------------
 bool d2ce::Items::importItem(const d2ce::Item*& pImportedItem, bool bRandomizeId)
 {
+    auto gameData = activateGameDataContext();
     if (pImportedItem == nullptr)
     {
         return false;
@@ -24314,6 +24856,7 @@ bool d2ce::Items::importItem(const d2ce::Item*& pImportedItem, bool bRandomizeId
 //---------------------------------------------------------------------------
 bool d2ce::Items::importItem(const std::filesystem::path& path, const d2ce::Item*& pImportedItem, bool bRandomizeId)
 {
+    auto gameData = activateGameDataContext();
     // import item
     Item importedItem(Version, isExpansionItems(), path);
     pImportedItem = &importedItem;
@@ -24326,6 +24869,15 @@ bool d2ce::Items::exportItem(d2ce::Item& item, const std::filesystem::path& path
 }
 //---------------------------------------------------------------------------
 bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId, EnumAltItemLocation altPositionId, std::uint16_t positionX, std::uint16_t positionY, d2ce::EnumItemInventory invType, const  d2ce::Item*& pRemovedItem)
+{
+    bool bResult = setItemLocationHelper(item, locationId, altPositionId, positionX, positionY, invType, pRemovedItem);
+#ifdef _DEBUG
+    checkItemIndexes();
+#endif
+    return bResult;
+}
+//---------------------------------------------------------------------------
+bool d2ce::Items::setItemLocationHelper(d2ce::Item& item, EnumItemLocation locationId, EnumAltItemLocation altPositionId, std::uint16_t positionX, std::uint16_t positionY, d2ce::EnumItemInventory invType, const  d2ce::Item*& pRemovedItem)
 {
     pRemovedItem = nullptr;
     switch (locationId)
@@ -24382,7 +24934,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
         return false;
     }
 
-    std::list<Item> removedItems; // items to be removed into the buffer
+    ItemList removedItems; // items to be removed into the buffer
     std::array<std::uint8_t, 4> strcode;
     if (!item.getItemCode(strcode))
     {
@@ -24409,19 +24961,16 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
     d2ce::EnumItemInventory itemInvType = d2ce::EnumItemInventory::UNKNOWN;
     auto itemLocationId = item.getLocation();
     auto itemAltPositionId = (itemLocationId == d2ce::EnumItemLocation::STORED) ? item.getAltPositionId() : d2ce::EnumAltItemLocation::UNKNOWN;
-    std::list<Item> itemToMove; // non-empty if given item is moving inventories
-    std::list<d2ce::Item>* pMoveInv = nullptr;
+    ItemList itemToMove; // non-empty if given item is moving inventories
+    d2ce::ItemList* pMoveInv = nullptr;
     size_t iterMoveIdx = MAXSIZE_T;
-    auto& itemInvDimenstion = invDimensions[itemLocationId][itemAltPositionId];
     auto& itemEmptySlots = ItemLocationEmptySpots[itemLocationId][itemAltPositionId];
     std::uint16_t itemPositionX = item.getPositionX();
     std::uint16_t itemPositionY = item.getPositionY();
-    std::uint16_t itemPositionX2 = itemPositionX + dimensions.Width - 1;
-    std::uint16_t itemPositionY2 = itemPositionY + dimensions.Height - 1;
     if ((itemLocationId != locationId) || (itemAltPositionId != altPositionId) || (invType == EnumItemInventory::BUFFER))
     {
         // item is moving between containers
-        std::list<Item>::iterator iter;
+        ItemList::iterator iter;
         switch (itemLocationId)
         {
         case d2ce::EnumItemLocation::STORED:
@@ -24451,13 +25000,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
                 }
 
                 // mark item slots as empty again
-                for (std::uint16_t y = itemPositionY; y <= itemPositionY2; ++y)
-                {
-                    for (std::uint16_t x = itemPositionX; x <= itemPositionX2; ++x)
-                    {
-                        itemEmptySlots.insert(y * itemInvDimenstion.Width + x);
-                    }
-                }
+                itemEmptySlots.release(itemPositionX, itemPositionY, dimensions.Width, dimensions.Height);
 
                 // Check if we are moving inventories
                 bool bMoving = false;
@@ -24796,7 +25339,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
     }
     else
     {
-        std::list<Item>::iterator iter;
+        ItemList::iterator iter;
         switch (itemLocationId)
         {
         case d2ce::EnumItemLocation::STORED:
@@ -25120,13 +25663,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
             }
 
             // mark item slots as occupied again
-            for (std::uint16_t y = itemPositionY; y <= itemPositionY2; ++y)
-            {
-                for (std::uint16_t x = itemPositionX; x <= itemPositionX2; ++x)
-                {
-                    itemEmptySlots.erase(y * itemInvDimenstion.Width + x);
-                }
-            }
+            itemEmptySlots.occupy(itemPositionX, itemPositionY, dimensions.Width, dimensions.Height);
 
             return false;
         }
@@ -25150,13 +25687,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
         }
 
         // mark item slots as occupied again
-        for (std::uint16_t y = itemPositionY; y <= itemPositionY2; ++y)
-        {
-            for (std::uint16_t x = itemPositionX; x <= itemPositionX2; ++x)
-            {
-                itemEmptySlots.erase(y * itemInvDimenstion.Width + x);
-            }
-        }
+        itemEmptySlots.occupy(itemPositionX, itemPositionY, dimensions.Width, dimensions.Height);
 
         return false;
     }
@@ -25262,7 +25793,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
                 {
                     socketedItems.splice(socketedItems.end(), itemToMove, itemToMove.begin());
                     itemToSocket.updateSocketedItemCount();
-                    itemToSocket.cachedCombinedMagicalAttributes.clear();
+                    itemToSocket.cachedCombinedProperties.clear();
 
                     // resolve magical properties of socketed gem
                     const auto& childItemType = item.getItemTypeHelper();
@@ -25309,13 +25840,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
         if (itemToMove.empty())
         {
             // mark item slots as empty again
-            for (std::uint16_t y = itemPositionY; y <= itemPositionY2; ++y)
-            {
-                for (std::uint16_t x = itemPositionX; x <= itemPositionX2; ++x)
-                {
-                    itemEmptySlots.insert(y * itemInvDimenstion.Width + x);
-                }
-            }
+            itemEmptySlots.release(itemPositionX, itemPositionY, dimensions.Width, dimensions.Height);
         }
 
         if (!item.setLocation(locationId, altPositionId, positionX, positionY))
@@ -25324,13 +25849,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
             if (itemToMove.empty())
             {
                 // mark item slots as occupied again
-                for (std::uint16_t y = itemPositionY; y <= itemPositionY2; ++y)
-                {
-                    for (std::uint16_t x = itemPositionX; x <= itemPositionX2; ++x)
-                    {
-                        itemEmptySlots.erase(y * itemInvDimenstion.Width + x);
-                    }
-                }
+                itemEmptySlots.occupy(itemPositionX, itemPositionY, dimensions.Width, dimensions.Height);
             }
             else if (pMoveInv != nullptr)
             {
@@ -25358,16 +25877,8 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
         // mark item slots as empty again
         pItem2->getDimensions(invItemDimensions);
         invItemPosX = pItem2->getPositionX();
-        invItemPosX2 = invItemPosX + invItemDimensions.Width - 1;
         invItemPosY = pItem2->getPositionY();
-        invItemPosY2 = invItemPosY + invItemDimensions.Height - 1;
-        for (std::uint16_t y = invItemPosY; y <= invItemPosY2; ++y)
-        {
-            for (std::uint16_t x = invItemPosX; x <= invItemPosX2; ++x)
-            {
-                itemEmptySlots.insert(y * invDimenstion.Width + x);
-            }
-        }
+        emptySlots.release(invItemPosX, invItemPosY, invItemDimensions.Width, invItemDimensions.Height);
 
         BufferItems.splice(BufferItems.end(), Inventory, iter);
         pRemovedItem = pItem2;
@@ -25390,13 +25901,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
             }
 
             // mark item slots as empty again
-            for (std::uint16_t y = itemPositionY; y <= itemPositionY2; ++y)
-            {
-                for (std::uint16_t x = itemPositionX; x <= itemPositionX2; ++x)
-                {
-                    itemEmptySlots.insert(y * itemInvDimenstion.Width + x);
-                }
-            }
+            itemEmptySlots.release(itemPositionX, itemPositionY, dimensions.Width, dimensions.Height);
         }
 
         if (!item.setLocation(locationId, altPositionId, positionX, positionY))
@@ -25405,13 +25910,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
             if (itemToMove.empty())
             {
                 // mark item slots as occupied again
-                for (std::uint16_t y = itemPositionY; y <= itemPositionY2; ++y)
-                {
-                    for (std::uint16_t x = itemPositionX; x <= itemPositionX2; ++x)
-                    {
-                        itemEmptySlots.erase(y * itemInvDimenstion.Width + x);
-                    }
-                }
+                itemEmptySlots.occupy(itemPositionX, itemPositionY, dimensions.Width, dimensions.Height);
             }
             else if (pMoveInv != nullptr)
             {
@@ -25479,13 +25978,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumItemLocation locationId,
     }
 
     // remove slots from empty list
-    for (std::uint16_t y = positionY; y <= positionY2; ++y)
-    {
-        for (std::uint16_t x = positionX; x <= positionX2; ++x)
-        {
-            emptySlots.erase(y * invDimenstion.Width + x);
-        }
-    }
+    emptySlots.occupy(positionX, positionY, dimensions.Width, dimensions.Height);
 
     LastItemMoved = pRemovedItem;
     LastItemIdx = item2Idx;
@@ -25571,6 +26064,15 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, EnumAltItemLocation altPosit
 }
 //---------------------------------------------------------------------------
 bool d2ce::Items::setItemLocation(d2ce::Item& item, const d2ce::Character& charInfo, EnumEquippedId equippedId, d2ce::EnumItemInventory invType, const d2ce::Item*& pRemovedItem)
+{
+    bool bResult = setItemLocationHelper(item, charInfo, equippedId, invType, pRemovedItem);
+#ifdef _DEBUG
+    checkItemIndexes();
+#endif
+    return bResult;
+}
+//---------------------------------------------------------------------------
+bool d2ce::Items::setItemLocationHelper(d2ce::Item& item, const d2ce::Character& charInfo, EnumEquippedId equippedId, d2ce::EnumItemInventory invType, const d2ce::Item*& pRemovedItem)
 {
     pRemovedItem = nullptr;
     if (equippedId == EnumEquippedId::NONE)
@@ -25724,7 +26226,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, const d2ce::Character& charI
         return false;
     }
 
-    std::list<Item> removedItems; // items to be removed into the buffer
+    ItemList removedItems; // items to be removed into the buffer
     std::array<std::uint8_t, 4> strcode;
     if (!item.getItemCode(strcode))
     {
@@ -25733,11 +26235,6 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, const d2ce::Character& charI
     }
 
     const auto& itemType = ItemHelpers::getItemTypeHelper(strcode);
-    std::map<d2ce::EnumItemLocation, std::map<d2ce::EnumAltItemLocation, ItemDimensions>> invDimensions;
-    getItemLocationDimensions(d2ce::EnumAltItemLocation::INVENTORY, invDimensions[d2ce::EnumItemLocation::STORED][d2ce::EnumAltItemLocation::INVENTORY]);
-    getItemLocationDimensions(d2ce::EnumAltItemLocation::HORADRIC_CUBE, invDimensions[d2ce::EnumItemLocation::STORED][d2ce::EnumAltItemLocation::HORADRIC_CUBE]);
-    getItemLocationDimensions(d2ce::EnumAltItemLocation::STASH, invDimensions[d2ce::EnumItemLocation::STORED][d2ce::EnumAltItemLocation::STASH]);
-    getItemLocationDimensions(d2ce::EnumItemLocation::BELT, invDimensions[d2ce::EnumItemLocation::BELT][d2ce::EnumAltItemLocation::UNKNOWN]);
 
     // Detect if is item being moved between inventory types
     ItemDimensions dimensions;
@@ -25750,17 +26247,14 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, const d2ce::Character& charI
     d2ce::EnumItemInventory itemInvType = d2ce::EnumItemInventory::UNKNOWN;
     auto itemLocationId = item.getLocation();
     auto itemAltPositionId = (itemLocationId == d2ce::EnumItemLocation::STORED) ? item.getAltPositionId() : d2ce::EnumAltItemLocation::UNKNOWN;
-    std::list<Item> itemToMove; // non-empty if given item is moving inventories
-    std::list<d2ce::Item>* pMoveInv = nullptr;
+    ItemList itemToMove; // non-empty if given item is moving inventories
+    d2ce::ItemList* pMoveInv = nullptr;
     size_t iterMoveIdx = MAXSIZE_T;
-    auto& itemInvDimenstion = invDimensions[itemLocationId][itemAltPositionId];
     auto& itemEmptySlots = ItemLocationEmptySpots[itemLocationId][itemAltPositionId];
     std::uint16_t itemPositionX = item.getPositionX();
     std::uint16_t itemPositionY = item.getPositionY();
-    std::uint16_t itemPositionX2 = itemPositionX + dimensions.Width - 1;
-    std::uint16_t itemPositionY2 = itemPositionY + dimensions.Height - 1;
     // item is moving between containers
-    std::list<Item>::iterator iter;
+    ItemList::iterator iter;
     switch (itemLocationId)
     {
     case d2ce::EnumItemLocation::STORED:
@@ -25790,13 +26284,7 @@ bool d2ce::Items::setItemLocation(d2ce::Item& item, const d2ce::Character& charI
             }
 
             // mark item slots as empty again
-            for (std::uint16_t y = itemPositionY; y <= itemPositionY2; ++y)
-            {
-                for (std::uint16_t x = itemPositionX; x <= itemPositionX2; ++x)
-                {
-                    itemEmptySlots.insert(y * itemInvDimenstion.Width + x);
-                }
-            }
+            itemEmptySlots.release(itemPositionX, itemPositionY, dimensions.Width, dimensions.Height);
 
             // Check if we are moving inventories
             bool bMoving = false;
@@ -26673,10 +27161,10 @@ bool d2ce::Items::removeSocketedItems(d2ce::Item& item)
                 GPSs.push_back(itemToMove);
             }
 
-            posX = *(pInvEmptySlots->begin());
+            posX = pInvEmptySlots->front();
             if (itemToMove.setLocation(locationId, altPositionId, posX % invDimensions.Width, posX / invDimensions.Width))
             {
-                pInvEmptySlots->erase(posX);
+                pInvEmptySlots->occupy(posX, 0);
             }
         }
     }
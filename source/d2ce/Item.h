@@ -23,13 +23,115 @@
 #include "CharacterConstants.h"
 #include "ItemConstants.h"
 #include "DataTypes.h"
+#include "BitSource.h"
+#include "BitSink.h"
 #include <json/json.h>
+#include <exception>
+#include <memory>
 #include <set>
 
 namespace d2ce
 {
     class Character;
+    class Item;
     struct ItemType;
+
+    using ItemList = std::list<Item>;           // item containers
+    using ItemBytes = std::vector<std::uint8_t>; // the bits of an item
+
+    //---------------------------------------------------------------------------
+    // The bits of an item, shared between copies of the item until one of them
+    // changes. Copying an item only copies a reference to its bits and modify()
+    // first gives the item its own copy if the bits are shared. Only this payload
+    // is shared, the item lists holding the items are still copied item by item.
+    class ItemData
+    {
+    private:
+        std::shared_ptr<ItemBytes> m_bytes; // empty until the item has bits
+
+        static const ItemBytes& emptyBytes()
+        {
+            static const ItemBytes empty;
+            return empty;
+        }
+
+    public:
+        const ItemBytes& bytes() const
+        {
+            return m_bytes ? *m_bytes : emptyBytes();
+        }
+
+        ItemBytes& modify()
+        {
+            if (!m_bytes)
+            {
+                m_bytes = std::make_shared<ItemBytes>();
+            }
+            else if (m_bytes.use_count() > 1)
+            {
+                m_bytes = std::make_shared<ItemBytes>(*m_bytes);
+            }
+
+            return *m_bytes;
+        }
+
+        bool isShared() const
+        {
+            return m_bytes.use_count() > 1;
+        }
+
+        bool empty() const
+        {
+            return bytes().empty();
+        }
+
+        size_t size() const
+        {
+            return bytes().size();
+        }
+
+        // read only, writes go through modify() so reading never copies shared bits
+        const std::uint8_t& operator[](size_t position) const
+        {
+            return bytes()[position];
+        }
+
+        ItemBytes::const_iterator begin() const
+        {
+            return bytes().begin();
+        }
+
+        ItemBytes::const_iterator end() const
+        {
+            return bytes().end();
+        }
+
+        void clear()
+        {
+            m_bytes.reset();
+        }
+
+        void reserve(size_t itemsize)
+        {
+            modify().reserve(itemsize);
+        }
+
+        void resize(size_t itemsize, std::uint8_t value = 0)
+        {
+            modify().resize(itemsize, value);
+        }
+
+        void push_back(std::uint8_t value)
+        {
+            modify().push_back(value);
+        }
+
+        void swap(ItemData& other) noexcept
+        {
+            m_bytes.swap(other.m_bytes);
+        }
+    };
+
     struct ItemFilter
     {
         EnumItemLocation LocationId = EnumItemLocation::BUFFER;
@@ -54,13 +156,69 @@ namespace d2ce
             clearEquipped();
         }
     };
+    //---------------------------------------------------------------------------
+    // Header fields decoded from an item's bits. Any change to the bits clears the
+    // view and it is decoded again, all at once, when the item is read or when the
+    // change is done. The const getters only ever read it, so one item can be read
+    // from several threads at once. While the view is cleared, or once the item
+    // tables are reloaded, the getters decode the bits instead.
+    struct ItemView
+    {
+        enum Field : std::uint16_t
+        {
+            FLAGS = 0x0001,
+            SIMPLE = 0x0002,
+            LOCATION = 0x0004,
+            EQUIPPED_ID = 0x0008,
+            POSITION_X = 0x0010,
+            POSITION_Y = 0x0020,
+            ALT_POSITION_ID = 0x0040,
+            CODE = 0x0080,
+            ITEM_TYPE = 0x0100,
+            QUALITY = 0x0200,
+            LEVEL = 0x0400,
+            ID = 0x0800,
+            SOCKET_COUNT = 0x1000,
+            SOCKETED_ITEM_COUNT = 0x2000,
+            ALL = 0x3FFF,
+        };
+
+        std::uint16_t Fields = 0;     // mask of the decoded fields
+        std::uint32_t Generation = 0; // item data generation the fields were decoded against
+        std::uint32_t Flags = 0;
+        bool IsSimple = false;
+        EnumItemLocation Location = EnumItemLocation::BUFFER;
+        EnumEquippedId EquippedId = EnumEquippedId::NONE;
+        std::uint8_t PositionX = 0;
+        std::uint8_t PositionY = 0;
+        EnumAltItemLocation AltPositionId = EnumAltItemLocation::UNKNOWN;
+        bool HasCode = false;
+        std::array<std::uint8_t, 4> Code = { 0, 0, 0, 0 };
+        const ItemType* Type = nullptr;
+        EnumItemQuality Quality = EnumItemQuality::UNKNOWN;
+        std::uint8_t Level = 0;
+        std::uint32_t Id = 0;
+        std::uint8_t SocketCount = 0;
+        std::uint8_t SocketedItemCount = 0;
+
+        bool has(Field field) const
+        {
+            return (Fields & field) != 0;
+        }
+
+        void clear()
+        {
+            Fields = 0;
+        }
+    };
+
     //---------------------------------------------------------------------------
     class Item
     {
         friend class Items;
 
     private:
-        mutable std::vector<std::uint8_t> data;
+        ItemData data;
         EnumItemVersion ItemVersion = APP_ITEM_VERSION;
         std::uint16_t GameVersion = APP_ITEM_GAME_VERSION;
         mutable std::array<size_t, 31> bitOffsets = { 16, 58, 61, 65, 73, 76, 108 };
@@ -69,17 +227,22 @@ namespace d2ce
         size_t item_current_socket_idx = 0; // temp variable for socketed gem ordering
         mutable MagicalCachev100 magic_affixes_v100;
         mutable RareOrCraftedCachev100 rare_affixes_v100;
+        ItemView view;
 
     private:
-        std::uint64_t readBits(std::FILE* charfile, size_t& current_bit_offset, size_t bits);
-        bool skipBits(std::FILE* charfile, size_t& current_bit_offset, size_t bits);
+        std::uint64_t readBits(BitSource& charfile, size_t& current_bit_offset, size_t bits);
+        bool skipBits(BitSource& charfile, size_t& current_bit_offset, size_t bits);
         bool setBits(size_t& current_bit_offset, size_t bits, std::uint32_t value);
         bool setBits64(size_t& current_bit_offset, size_t bits, std::uint64_t value);
-        bool parsePropertyList(std::FILE* charfile, size_t& current_bit_offset);
+        bool parsePropertyList(BitSource& charfile, size_t& current_bit_offset);
         bool parsePropertyList(const Json::Value& propListRoot, bool bSerializedFormat, size_t& current_bit_offset);
         bool readPropertyList(size_t& current_bit_offset, std::vector<MagicalAttribute>& attrib) const;
+        bool readPropertyList(size_t& current_bit_offset, std::vector<ItemProperty>& props) const;
+        bool getRunewordProperties(std::vector<ItemProperty>& props) const;
+        template <class PropertyHandler>
+        bool decodePropertyList(size_t& current_bit_offset, PropertyHandler&& onProperty) const; // calls onProperty(prop, stat) for each property read
         bool updatePropertyList(size_t& current_bit_offset, const std::vector<MagicalAttribute>& attribs);
-        std::uint8_t getEncodedChar(std::FILE* charfile, size_t& current_bit_offset);
+        std::uint8_t getEncodedChar(BitSource& charfile, size_t& current_bit_offset);
 
         std::uint32_t readBits(size_t start, size_t size) const;
         std::uint32_t readBitsEx(size_t& start, size_t size) const;
@@ -89,6 +252,9 @@ namespace d2ce
         bool updateBitsEx(size_t& start, size_t size, std::uint32_t value);
         bool updateBits64(size_t start, size_t size, std::uint64_t value);
         bool updateBits64Ex(size_t& start, size_t size, std::uint64_t value);
+        bool spliceBits(size_t start, size_t end, std::int64_t bitDiff); // inserts (bitDiff > 0) or removes bits at start, moving the bits up to end
+        bool encodePropertyList(const std::vector<MagicalAttribute>& attribs, ItemBytes& listData, size_t& numBits); // appends the list to listData
+        bool replaceBits(size_t& current_bit_offset, size_t end_bit_offset, const ItemBytes& bits, size_t numBits); // the item end offset is left to the caller
         bool updateResurrectedItemCode(std::uint64_t code, size_t numBitsSet);
 
         std::uint8_t getInferiorQualityIdv100() const;
@@ -105,10 +271,50 @@ namespace d2ce
 
         bool verifyItemConsistency() const;
 
+        // decodes the view again when a change to the item is done
+        class ViewUpdate
+        {
+        private:
+            Item& m_item;
+            int m_uncaught = 0;
+
+        public:
+            ViewUpdate(Item& item) : m_item(item), m_uncaught(std::uncaught_exceptions())
+            {
+            }
+
+            ~ViewUpdate()
+            {
+                // a failed change leaves the view cleared
+                if (std::uncaught_exceptions() == m_uncaught)
+                {
+                    m_item.refreshView();
+                }
+            }
+        };
+
+        bool hasViewField(ItemView::Field field) const;
+        void refreshView();
+        bool getFlag(std::uint32_t flagOffset) const;
+        std::uint32_t decodeFlags() const;
+        bool decodeSimpleItem() const;
+        EnumItemLocation decodeLocation() const;
+        EnumEquippedId decodeEquippedId() const;
+        std::uint8_t decodePositionX() const;
+        std::uint8_t decodePositionY() const;
+        EnumAltItemLocation decodeAltPositionId() const;
+        bool decodeItemCode(std::array<std::uint8_t, 4>& strcode) const;
+        const ItemType& decodeItemTypeHelper() const;
+        std::uint32_t decodeId() const;
+        std::uint8_t decodeLevel() const;
+        EnumItemQuality decodeQuality() const;
+        std::uint8_t decodeSocketCount() const;
+        std::uint8_t decodeSocketedItemCount() const;
+
     protected:
-        bool readItem(EnumItemVersion version, bool isExpansion, std::FILE* charfile);
+        bool readItem(EnumItemVersion version, bool isExpansion, BitSource& charfile);
         bool readItem(const Json::Value& itemRoot, bool bSerializedFormat, EnumItemVersion version, bool isExpansion);
-        bool writeItem(std::FILE* charfile) const;
+        bool writeItem(BitSink& charfile) const;
 
         void asJson(Json::Value& parent, std::uint32_t charLevel, EnumItemVersion version, bool bSerializedFormat = false) const;
         void asJson(Json::Value& parent, std::uint32_t charLevel, bool bSerializedFormat = false) const;
@@ -147,7 +353,8 @@ namespace d2ce
 
         void swap(Item& other);
 
-        std::uint8_t& operator [](size_t position) const;
+        std::uint8_t& operator [](size_t position);
+        const std::uint8_t& operator [](size_t position) const;
 
         size_t size() const; // number of bytes not including socketed items
         size_t getFullSize() const; // number of bytes to store the item, including socketed items
@@ -220,6 +427,8 @@ namespace d2ce
         bool getRareOrCraftedAttributes(RareAttributes& attrib) const;
         bool getUniqueAttributes(UniqueAttributes& attrib) const;
         bool getMagicalAttributes(std::vector<MagicalAttribute>& attribs) const;
+        bool getMagicalProperties(std::vector<ItemProperty>& props) const; // same as getMagicalAttributes without the names and descriptions
+        bool getCombinedMagicalProperties(std::vector<ItemProperty>& props) const; // same as getCombinedMagicalAttributes without the names and descriptions
         bool getCombinedMagicalAttributes(std::vector<MagicalAttribute>& attribs) const;
         bool hasMultipleGraphics() const;
         std::uint8_t getPictureId() const;
@@ -357,11 +566,11 @@ namespace d2ce
         bool getDisplayedCombinedMagicalAttributes(std::vector<MagicalAttribute>& attribs, std::uint32_t charLevel) const;
 
     public:
-        std::list<Item> SocketedItems; // socketed items
+        ItemList SocketedItems; // socketed items, deep copied with the item (only their bits are shared)
 
     protected:
         std::vector<MagicalAttribute> socketedMagicalAttributes;
-        mutable std::vector<MagicalAttribute> cachedCombinedMagicalAttributes;
+        mutable std::vector<ItemProperty> cachedCombinedProperties;
     };
 
     //---------------------------------------------------------------------------
@@ -375,7 +584,7 @@ namespace d2ce
         EnumItemVersion Version = APP_ITEM_VERSION;
         mutable std::uint16_t GameVersion = APP_ITEM_GAME_VERSION;
 
-        std::list<Item> Inventory;            // items in inventory
+        ItemList Inventory;            // items in inventory
 
         std::vector<std::reference_wrapper<Item>> GPSs;       // inventory of all Gems, Potions or Skulls
         std::vector<std::reference_wrapper<Item>> Stackables; // inventory of all Stackable (includes some weapons)
@@ -383,7 +592,7 @@ namespace d2ce
         std::vector<std::reference_wrapper<Item>> Weapons;    // inventory of all Weapons (includes stackable weapons)
 
         mutable std::map<d2ce::EnumItemLocation, std::map<d2ce::EnumAltItemLocation, std::vector<std::reference_wrapper<Item>>>> ItemLocationReference; // Iventory of items equipped or stored in the belt
-        mutable std::map<d2ce::EnumItemLocation, std::map<d2ce::EnumAltItemLocation, std::set<std::uint16_t>>> ItemLocationEmptySpots; // a set of empty spots on body or belt
+        mutable std::map<d2ce::EnumItemLocation, std::map<d2ce::EnumAltItemLocation, ItemLocationGrid>> ItemLocationEmptySpots; // empty cells of the inventory grids and belt
 
         std::vector<std::reference_wrapper<ItemType>> HasRestrictedItem;
         bool HasBeltEquipped = false;
@@ -391,51 +600,53 @@ namespace d2ce
         bool IsSharedStash = false;
 
         mutable CorpseHeader CorpseInfo;
-        mutable std::list<Item> CorpseItems;      // items on our Corpse
+        mutable ItemList CorpseItems;      // items on our Corpse
 
         // Expansion Character data
         mutable std::uint16_t NumOfMercItems = 0;  // # of Mercenary items (according to file)
-        mutable std::list<Item> MercItems;         // items mercenary is currently wearing.
+        mutable ItemList MercItems;         // items mercenary is currently wearing.
         mutable std::uint64_t MercId_v100 = 0;     // 1.00 - 1.08
 
-        mutable std::list<Item> GolemItem;         // Item for the Golem (only one item, but a list to keep memory stable)
+        mutable ItemList GolemItem;         // Item for the Golem (only one item, but a list to keep memory stable)
 
-        std::list<Item>& BufferItems;       // Buffer for items not in any inventory yet
+        ItemList& BufferItems;       // Buffer for items not in any inventory yet
 
         mutable bool isMercHired = false;
 
     private:
-        std::list<Item> Buffer;
+        ItemList Buffer;
         const Item* LastItemMoved = nullptr;
         size_t LastItemIdx = MAXSIZE_T;
+        GameDataContextPtr m_gameData; // the game data the items were read with
 
     private:
         void findItems();
         void findSharedStashItems();
 
-        bool readItems(std::FILE* charfile, std::list<Item>& items);
-        bool readSharedStashPage(std::FILE* charfile, std::list<Item>& items);
-        bool fillItemsArray(std::FILE* charfile, std::uint16_t numItems, std::list<Item>& items);
-        bool readItemsList(const Json::Value& itemListroot, bool bSerializedFormat, std::list<Item>& items);
-        bool readItems(const Json::Value& root, bool bSerializedFormat, std::list<Item>& items);
-        bool fillItemsArray(const Json::Value& itemsRoot, bool bSerializedFormat, std::list<Item>& items);
+        bool readItems(BitSource& charfile, ItemList& items);
+        bool readSharedStashPage(BitSource& charfile, ItemList& items);
+        void readItemsParallel(BitSource& charfile, std::uint16_t numItems, ItemList& items);
+        bool fillItemsArray(BitSource& charfile, std::uint16_t numItems, ItemList& items);
+        bool readItemsList(const Json::Value& itemListroot, bool bSerializedFormat, ItemList& items);
+        bool readItems(const Json::Value& root, bool bSerializedFormat, ItemList& items);
+        bool fillItemsArray(const Json::Value& itemsRoot, bool bSerializedFormat, ItemList& items);
 
-        bool readCorpseItems(std::FILE* charfile);
+        bool readCorpseItems(BitSource& charfile);
         bool readCorpseItems(const Json::Value& root, bool bSerializedFormat);
-        void readMercItems(std::FILE* charfile);
+        void readMercItems(BitSource& charfile);
         void readMercItems(const Json::Value& root, bool bSerializedFormat);
-        void readGolemItem(std::FILE* charfile);
+        void readGolemItem(BitSource& charfile);
         void readGolemItem(const Json::Value& root, bool bSerializedFormat);
 
-        bool writeCorpseItems(std::FILE* charfile) const;
-        bool writeMercItems(std::FILE* charfile) const;
-        bool writeGolemItem(std::FILE* charfile) const;
+        bool writeCorpseItems(BitSink& charfile) const;
+        bool writeMercItems(BitSink& charfile) const;
+        bool writeGolemItem(BitSink& charfile) const;
 
-        bool readItems(const Character& charInfo, std::FILE* charfile);
-        bool readSharedStashPage(EnumCharVersion version, std::FILE* charfile);
+        bool readItems(const Character& charInfo, BitSource& charfile);
+        bool readSharedStashPage(EnumCharVersion version, BitSource& charfile);
         bool readItems(const Json::Value& root, bool bSerializedFormat, const Character& charInfo);
-        bool writeItems(std::FILE* charfile, bool isExpansion = false, bool hasMercID = false) const;
-        bool writeSharedStashPage(std::FILE* charfile) const;
+        bool writeItems(BitSink& charfile, bool isExpansion = false, bool hasMercID = false) const;
+        bool writeSharedStashPage(BitSink& charfile) const;
 
         void itemsAsJson(Json::Value& parent, std::uint32_t charLevel, EnumItemVersion version, bool bSerializedFormat = false) const;
         void itemsAsJson(Json::Value& parent, std::uint32_t charLevel, bool bSerializedFormat = false) const;
@@ -450,22 +661,38 @@ namespace d2ce
 
         void verifyBeltSlots();
         void verifyRestrictedItems();
+        void removeItemIndex(const Item& item);
+        bool setItemLocationHelper(d2ce::Item& item, EnumItemLocation locationId, EnumAltItemLocation altPositionId, std::uint16_t positionX, std::uint16_t positionY, d2ce::EnumItemInventory invType, const d2ce::Item* &pRemovedItem);
+        bool setItemLocationHelper(d2ce::Item& item, const d2ce::Character& charInfo, EnumEquippedId equippedId, d2ce::EnumItemInventory invType, const d2ce::Item* &pRemovedItem);
+#ifdef _DEBUG
+        void checkItemIndexes();
+#endif
 
         void calculateChecksum(long& checksum, std::uint8_t& overflow, bool isExpansion, bool hasMercID);
 
     public:
         Items();
-        Items(std::list<Item>& bufferItems);
-        Items(const Items& other);
+        Items(ItemList& bufferItems);
+        Items(const Items& other); // O(items), see operator=
         ~Items();
 
-        Items& operator=(const Items& other);
+        Items& operator=(const Items& other); // copies every item list, the items share their bits
         Items& operator=(Items&& other) noexcept;
 
         void swap(Items& other);
 
         void clear();
 
+        // the game data the items were read with, activateGameDataContext reinstalls it
+        // and keeps the tables locked until the returned scope is destroyed
+        GameDataContextPtr getGameDataContext() const;
+        GameDataScope activateGameDataContext() const;
+
+        // the number of threads used to decode large item lists read on the calling thread,
+        // 0 uses one thread per core and 1 always reads the items sequentially
+        static void setMaxReadThreads(size_t numThreads);
+        static size_t getMaxReadThreads();
+
         EnumItemVersion getDefaultItemVersion() const;
         std::uint16_t getDefaultGameVersion() const;
         bool getItemLocationDimensions(EnumItemLocation locationId, EnumAltItemLocation altPositionId, ItemDimensions& dimensions) const;
@@ -561,7 +788,7 @@ namespace d2ce
         bool getCombinedDamage(BaseDamage& damage, std::uint32_t charLevel) const;
 
         // Mercenary
-        const std::list<Item>& getMercItems() const;
+        const ItemList& getMercItems() const;
         bool getMercItemBonuses(std::vector<MagicalAttribute>& attribs) const;
         bool getDisplayedMercItemBonuses(std::vector<MagicalAttribute>& attribs, std::uint32_t charLevel) const;
         std::uint16_t getCombinedMercDefenseRating(std::uint32_t charLevel) const;
@@ -569,11 +796,11 @@ namespace d2ce
 
         // Corpse
         bool hasCorpse() const;
-        const std::list<Item>& getCorpseItems() const;
+        const ItemList& getCorpseItems() const;
 
         // Golem Info
         bool hasGolem() const;
-        const std::list<Item>& getGolemItem() const;
+        const ItemList& getGolemItem() const;
 
         d2ce::Item removeItem(const d2ce::Item& item);
 
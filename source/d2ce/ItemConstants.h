@@ -55,6 +55,7 @@ namespace d2ce
     constexpr std::uint32_t MAX_KEY_QUANTITY_100 = 6ui32;   // max # of keys stacked (verion 1.06 and lower)
     constexpr std::uint32_t MAX_GLD_QUANTITY = 4095ui32;    // max gld amount
     constexpr std::uint32_t MAX_STACKED_QUANTITY = 511ui32; // max # of items in a stack
+    constexpr size_t MAX_ITEM_CATEGORIES = 512;              // max # of item categories (itemtypes.txt) tracked in an item type's category bitset
 
     enum class EnumItemQuality : std::uint8_t
     {
@@ -827,6 +827,17 @@ namespace d2ce
         s_MercAttributesMap.swap(mercAttributesMap);
     }
 
+    void StashMercData(GameDataBackup& backup)
+    {
+        backup.stash(s_MercSupportedEquippedIds);
+        backup.stash(s_MercTypeInfo);
+        backup.stash(s_LegacyBarbarianTypes);
+        backup.stash(s_MercTypes);
+        backup.stash(s_MercNamesMap);
+        backup.stash(s_MercAttributesMap);
+        backup.stash(s_MercClassNames);
+    }
+
     // Find Merc Difficulty mapped to Type that matches difficulty and class requirements
     const std::map<EnumDifficulty, std::map<std::uint8_t, std::vector<std::uint16_t>>>& getMercDifficultyMap(EnumCharVersion version, d2ce::EnumMercenaryClass mercClass)
     {
@@ -1145,12 +1156,6 @@ bool d2ce::Mercenary::readInfo(const Json::Value& root, bool bSerializedFormat)
     return true;
 }
 //---------------------------------------------------------------------------
-void d2ce::Mercenary::setTxtReader()
-{
-    auto& txtReader = ItemHelpers::getTxtReader();
-    InitMercData(txtReader);
-}
-//---------------------------------------------------------------------------
 void d2ce::Mercenary::clear()
 {
     Merc.Dead = 0;
@@ -1813,6 +1818,21 @@ std::uint16_t d2ce::Mercenary::getAttackRating() const
     return attackRating;
 }
 //---------------------------------------------------------------------------
+void d2ce::Mercenary::getSkills(std::vector<std::uint16_t>& skillIds) const
+{
+    skillIds.clear();
+    if (!isHired())
+    {
+        return;
+    }
+
+    const auto& statInfo = getMercStatInfoForLevel(getLevel(), Merc.Type, getVersion());
+    for (const auto& skill : statInfo.skills)
+    {
+        skillIds.push_back(skill.id);
+    }
+}
+//---------------------------------------------------------------------------
 void d2ce::Mercenary::getResistance(BaseResistance& resist) const
 {
     resist.clear();
@@ -2011,7 +2031,7 @@ size_t d2ce::Mercenary::getNumberOfItems() const
     return CharInfo.getMercItems().size();
 }
 //---------------------------------------------------------------------------
-const std::list<d2ce::Item>& d2ce::Mercenary::getItems() const
+const d2ce::ItemList& d2ce::Mercenary::getItems() const
 {
     return CharInfo.getMercItems();
 }
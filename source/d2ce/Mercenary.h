@@ -53,8 +53,6 @@ namespace d2ce
         bool readInfo();
         bool readInfo(const Json::Value& root, bool bSerializedFormat);
 
-        void setTxtReader();
-
     public:
         void clear();
 
@@ -91,6 +89,7 @@ namespace d2ce
         std::uint16_t getDefenseRating() const;
         std::uint16_t getAttackRating() const;
         void getResistance(BaseResistance& resist) const;
+        void getSkills(std::vector<std::uint16_t>& skillIds) const;
 
         bool isHired() const;
         void setIsHired(bool bIsHired);
@@ -100,7 +99,7 @@ namespace d2ce
 
         // Items
         size_t getNumberOfItems() const;
-        const std::list<Item>& getItems() const;
+        const ItemList& getItems() const;
         bool canEquipItem(const d2ce::Item& item, EnumEquippedId equipId) const;
         d2ce::EnumEquippedId verifyEquippedId(const d2ce::Item& item, EnumEquippedId equipId) const;
 
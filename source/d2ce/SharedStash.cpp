@@ -21,6 +21,9 @@
 #include "SharedStash.h"
 #include "Character.h"
 #include "helpers/ItemHelpers.h"
+#include <atomic>
+#include <future>
+#include <thread>
 
 //---------------------------------------------------------------------------
 namespace d2ce
@@ -44,6 +47,25 @@ namespace d2ce
     private:
         const d2ce::Item& m_item;
     };
+
+    bool GetSharedStashCharVersion(std::uint32_t pageVersion, EnumCharVersion& charVersion)
+    {
+        charVersion = EnumCharVersion::v140;
+        if (pageVersion < static_cast<std::underlying_type_t<EnumCharVersion>>(EnumCharVersion::v100R))
+        {
+            return false;
+        }
+        else if (pageVersion < static_cast<std::underlying_type_t<EnumCharVersion>>(EnumCharVersion::v120))
+        {
+            charVersion = EnumCharVersion::v100R;
+        }
+        else if (pageVersion < static_cast<std::underlying_type_t<EnumCharVersion>>(EnumCharVersion::v140))
+        {
+            charVersion = EnumCharVersion::v120;
+        }
+
+        return true;
+    }
 }
 
 //---------------------------------------------------------------------------
@@ -53,6 +75,7 @@ d2ce::SharedStash::SharedStash()
 //---------------------------------------------------------------------------
 d2ce::SharedStash::SharedStash(const Character& charInfo)
 {
+    m_gameData = charInfo.getGameDataContext();
     CharVersion = charInfo.getVersion();
     IsExpansionCharacter = charInfo.isExpansionCharacter();
     if (CharVersion >= EnumCharVersion::v100R && IsExpansionCharacter)
@@ -87,6 +110,7 @@ d2ce::SharedStash& d2ce::SharedStash::operator=(const SharedStash& other)
     Pages = other.Pages;
     m_d2ifilename = other.m_d2ifilename;
     m_ftime = other.m_ftime;
+    m_gameData = other.m_gameData;
     return *this;
 }
 //---------------------------------------------------------------------------
@@ -105,6 +129,7 @@ d2ce::SharedStash& d2ce::SharedStash::operator=(SharedStash&& other) noexcept
     m_d2ifilename.swap(other.m_d2ifilename);
     other.m_d2ifilename.clear();
     std::swap(m_ftime, other.m_ftime);
+    m_gameData = std::exchange(other.m_gameData, nullptr);
     return *this;
 }
 //---------------------------------------------------------------------------
@@ -113,6 +138,7 @@ void d2ce::SharedStash::clear(bool bItemsOnly)
     if (!bItemsOnly)
     {
         m_d2ifilename.clear();
+        m_gameData.reset();
     }
     Pages.clear();
 }
@@ -120,6 +146,7 @@ void d2ce::SharedStash::clear(bool bItemsOnly)
 void d2ce::SharedStash::reset(const Character& charInfo)
 {
     clear();
+    m_gameData = charInfo.getGameDataContext();
     CharVersion = charInfo.getVersion();
     IsExpansionCharacter = charInfo.isExpansionCharacter();
     if (CharVersion >= EnumCharVersion::v100R && IsExpansionCharacter)
@@ -133,6 +160,49 @@ void d2ce::SharedStash::reset(const Character& charInfo)
     }
 }
 //---------------------------------------------------------------------------
+bool d2ce::SharedStash::open(const std::filesystem::path& path)
+{
+    // read with the game data currently installed
+    GameDataScope gameData;
+    clear();
+    m_gameData = ItemHelpers::getGameDataContext();
+    if (!std::filesystem::exists(path))
+    {
+        return false;
+    }
+
+    BitSource charfile;
+    if (!charfile.open(path))
+    {
+        return false;
+    }
+
+    // no character to take the version from, use the one of the first page
+    SharedStashHeader pageHeader;
+    if ((charfile.read(&pageHeader, sizeof(pageHeader)) != 1) || (pageHeader.Header != HEADER))
+    {
+        // corrupt file
+        return false;
+    }
+
+    if (!GetSharedStashCharVersion(pageHeader.Version, CharVersion))
+    {
+        // corrupt file
+        return false;
+    }
+
+    IsExpansionCharacter = true;
+    m_d2ifilename = path;
+    m_ftime = std::filesystem::last_write_time(m_d2ifilename);
+    if (!refresh(charfile))
+    {
+        clear();
+        return false;
+    }
+
+    return true;
+}
+//---------------------------------------------------------------------------
 void d2ce::SharedStash::swap(SharedStash& other)
 {
     std::swap(*this, other);
@@ -150,6 +220,12 @@ bool d2ce::SharedStash::load()
 //---------------------------------------------------------------------------
 bool d2ce::SharedStash::refresh()
 {
+    auto gameData = activateGameDataContext();
+    if (m_gameData == nullptr)
+    {
+        m_gameData = ItemHelpers::getGameDataContext();
+    }
+
     Pages.clear();
     if (m_d2ifilename.empty() || !std::filesystem::exists(m_d2ifilename))
     {
@@ -159,27 +235,18 @@ bool d2ce::SharedStash::refresh()
 
     m_ftime = std::filesystem::last_write_time(m_d2ifilename);
 
-    std::FILE* charfile = nullptr; 
-    errno_t err = _wfopen_s(&charfile, m_d2ifilename.wstring().c_str(), L"rb+");
-    if (err != 0)
-    {
-        return false;
-    }
-
-    if (!refresh(charfile))
+    BitSource charfile;
+    if (!charfile.open(m_d2ifilename))
     {
-        std::fclose(charfile);
-        charfile = nullptr;
         return false;
     }
 
-    std::fclose(charfile);
-    charfile = nullptr;
-    return true;
+    return refresh(charfile);
 }
 //---------------------------------------------------------------------------
 bool d2ce::SharedStash::save(bool saveBackup)
 {
+    auto gameData = activateGameDataContext();
     if(m_d2ifilename.empty())
     {
         return false;
@@ -189,40 +256,83 @@ bool d2ce::SharedStash::save(bool saveBackup)
     {
         auto now = std::chrono::system_clock::now();
         auto UTC = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
-        auto ext = "." + std::to_string(UTC) + ".bak";
-        auto backupd2ifilename = m_d2ifilename;
-        backupd2ifilename.replace_extension(ext);
-        std::filesystem::copy_file(m_d2ifilename, backupd2ifilename, std::filesystem::copy_options::overwrite_existing);
+        BackupStore backupStore(m_d2ifilename);
+        backupStore.backup(UTC);
+    }
+
+    std::vector<std::uint8_t> buffer;
+    if (!serialize(buffer))
+    {
+        // corrupt file
+        return false;
     }
 
-    std::FILE* charfile = nullptr;
-    errno_t err = _wfopen_s(&charfile, m_d2ifilename.wstring().c_str(), L"wb");
-    if (err != 0)
+    BitSink sink(buffer);
+    if (!sink.commit(m_d2ifilename))
     {
         return false;
     }
 
+    m_ftime = std::filesystem::last_write_time(m_d2ifilename);
+    return true;
+}
+//---------------------------------------------------------------------------
+bool d2ce::SharedStash::serialize(std::vector<std::uint8_t>& buffer)
+{
+    auto gameData = activateGameDataContext();
+    buffer.clear();
+
+    size_t totalSize = 0;
+    for (const auto& page : Pages)
+    {
+        totalSize += page.StashItems.getByteSize() + PAGE_HEADER_SIZE;
+    }
+    buffer.reserve(totalSize);
+
+    BitSink sink(buffer);
     for (auto& page : Pages)
     {
         auto& items = page.StashItems;
         auto& pageHeader = page.Header;
         pageHeader.PageLength = std::uint32_t(items.getByteSize() + PAGE_HEADER_SIZE);
-        std::fwrite(&pageHeader, sizeof(pageHeader), 1, charfile); 
-        if (!items.writeSharedStashPage(charfile))
+        sink.write(&pageHeader, sizeof(pageHeader), 1);
+        if (!items.writeSharedStashPage(sink))
         {
-            // corrupt file
-            std::fclose(charfile);
-            charfile = nullptr;
             return false;
         }
     }
 
-    std::fclose(charfile);
-    charfile = nullptr;
-    m_ftime = std::filesystem::last_write_time(m_d2ifilename);
     return true;
 }
 //---------------------------------------------------------------------------
+bool d2ce::SharedStash::getBackups(std::vector<BackupInfo>& backups) const
+{
+    backups.clear();
+    if (m_d2ifilename.empty())
+    {
+        return false;
+    }
+
+    BackupStore backupStore(m_d2ifilename);
+    return backupStore.getBackups(backups);
+}
+//---------------------------------------------------------------------------
+bool d2ce::SharedStash::restoreBackup(size_t index)
+{
+    if (m_d2ifilename.empty())
+    {
+        return false;
+    }
+
+    BackupStore backupStore(m_d2ifilename);
+    if (!backupStore.restoreFile(index))
+    {
+        return false;
+    }
+
+    return refresh();
+}
+//---------------------------------------------------------------------------
 const std::filesystem::path& d2ce::SharedStash::getPath() const
 {
     return m_d2ifilename;
@@ -244,6 +354,16 @@ bool d2ce::SharedStash::hasSharedStash() const
     return m_d2ifilename.empty() ? false : true;
 }
 //---------------------------------------------------------------------------
+d2ce::GameDataContextPtr d2ce::SharedStash::getGameDataContext() const
+{
+    return m_gameData;
+}
+//---------------------------------------------------------------------------
+d2ce::GameDataScope d2ce::SharedStash::activateGameDataContext() const
+{
+    return GameDataScope(m_gameData);
+}
+//---------------------------------------------------------------------------
 bool d2ce::SharedStash::isLoaded() const
 {
     if (Pages.empty())
@@ -944,68 +1064,139 @@ bool d2ce::SharedStash::setItemRuneword(d2ce::Item& item, std::uint16_t id)
     return false;
 }
 //---------------------------------------------------------------------------
-bool d2ce::SharedStash::refresh(std::FILE* charfile)
+bool d2ce::SharedStash::refresh(BitSource& charfile)
 {
-    std::uint32_t fileSize = 0;
-    std::uint32_t pos = 0;
-    std::uint32_t expectedPos = 0;
-    std::fseek(charfile, 0, SEEK_END);
-    fileSize = std::ftell(charfile);
-    std::fseek(charfile, 0, SEEK_SET);
-    while (!feof(charfile) && (pos < fileSize))
+    // Pre-scan the page headers, each page says where the next one starts
+    struct PageBounds
     {
-        Pages.emplace_back(SharedStashPage(BufferItems));
-        auto& page = Pages.back();
-        auto& pageHeader = page.Header;
-        std::fread(&pageHeader, sizeof(pageHeader), 1, charfile);
+        size_t Start = 0;
+        size_t Length = 0;
+    };
+
+    std::vector<PageBounds> pageBounds;
+    const std::uint8_t* buffer = charfile.data();
+    size_t fileSize = charfile.size();
+    size_t pos = 0;
+    bool bScanned = true;
+    while (pos < fileSize)
+    {
+        SharedStashHeader pageHeader;
+        if (fileSize - pos < sizeof(pageHeader))
+        {
+            // corrupt file
+            bScanned = false;
+            break;
+        }
+
+        std::memcpy(&pageHeader, buffer + pos, sizeof(pageHeader));
         if (pageHeader.Header != HEADER)
-        { 
+        {
             // corrupt file
-            Pages.pop_back();
-            return false;
+            bScanned = false;
+            break;
         }
 
         EnumCharVersion sharedShashCharVersion = EnumCharVersion::v140;
-        if (pageHeader.Version < static_cast<std::underlying_type_t<EnumCharVersion>>(EnumCharVersion::v100R))
+        if (!GetSharedStashCharVersion(pageHeader.Version, sharedShashCharVersion))
         {
             // corrupt file
-            Pages.pop_back();
-            return false;
+            bScanned = false;
+            break;
         }
-        else if (pageHeader.Version < static_cast<std::underlying_type_t<EnumCharVersion>>(EnumCharVersion::v120))
+
+        if (CharVersion != sharedShashCharVersion)
         {
-            sharedShashCharVersion = EnumCharVersion::v100R;
+            // unsupported case
+            bScanned = false;
+            break;
         }
-        else if (pageHeader.Version < static_cast<std::underlying_type_t<EnumCharVersion>>(EnumCharVersion::v140))
+
+        if ((pageHeader.PageLength < sizeof(pageHeader)) || (pageHeader.PageLength > fileSize - pos))
         {
-            sharedShashCharVersion = EnumCharVersion::v120;
+            // corrupt file
+            bScanned = false;
+            break;
         }
 
-        if (CharVersion != sharedShashCharVersion)
+        pageBounds.push_back({ pos, pageHeader.PageLength });
+        pos += pageHeader.PageLength;
+    }
+
+    // the pages do not depend on each other, so they are decoded in parallel, each one from its own view of the file
+    size_t firstPage = Pages.size();
+    Pages.reserve(firstPage + pageBounds.size());
+    for (const auto& bounds : pageBounds)
+    {
+        Pages.emplace_back(SharedStashPage(BufferItems));
+        std::memcpy(&Pages.back().Header, buffer + bounds.Start, sizeof(SharedStashHeader));
+    }
+
+    std::vector<char> pageRead(pageBounds.size(), 0);
+    auto readPage = [&](size_t idx)
+    {
+        try
         {
-            // unsupported case
-            Pages.pop_back();
-            return false;
+            const auto& bounds = pageBounds[idx];
+            BitSource source(buffer + bounds.Start, bounds.Length);
+            source.seek(sizeof(SharedStashHeader));
+            if (Pages[firstPage + idx].StashItems.readSharedStashPage(CharVersion, source) && (source.tell() == bounds.Length))
+            {
+                pageRead[idx] = 1;
+            }
         }
+        catch (const std::exception&)
+        {
+            pageRead[idx] = 0;
+        }
+    };
 
-        auto& items = page.StashItems;
-        if (!items.readSharedStashPage(CharVersion, charfile))
+    size_t numThreads = size_t(std::thread::hardware_concurrency());
+    if (Items::getMaxReadThreads() != 0)
+    {
+        numThreads = std::min(numThreads, Items::getMaxReadThreads());
+    }
+    numThreads = std::min(numThreads, pageBounds.size());
+
+    if (numThreads <= 1)
+    {
+        for (size_t idx = 0; idx < pageBounds.size(); ++idx)
         {
-            // corrupt file
-            Pages.pop_back();
-            return false;
+            readPage(idx);
         }
+    }
+    else
+    {
+        // the workers take no locks of their own, the tables stay locked by this thread until they are done
+        std::atomic<size_t> nextPage{ 0 };
+        auto worker = [&]()
+        {
+            for (size_t idx = nextPage++; idx < pageBounds.size(); idx = nextPage++)
+            {
+                readPage(idx);
+            }
+        };
 
-        expectedPos = pos + pageHeader.PageLength;
-        pos = std::ftell(charfile);
-        if (pos != expectedPos)
+        std::vector<std::future<void>> workers;
+        workers.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i)
         {
-            // corrupt file
-            Pages.pop_back();
-            return false;
+            workers.push_back(std::async(std::launch::async, worker));
+        }
+
+        for (auto& thread : workers)
+        {
+            thread.wait();
         }
     }
 
-    return true;
+    // same as reading the pages one after the other, keep the pages before the first bad one
+    auto iter = std::find(pageRead.begin(), pageRead.end(), char(0));
+    if (iter != pageRead.end())
+    {
+        Pages.erase(Pages.begin() + (firstPage + size_t(iter - pageRead.begin())), Pages.end());
+        return false;
+    }
+
+    return bScanned;
 }
 //---------------------------------------------------------------------------
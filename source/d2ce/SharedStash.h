@@ -20,6 +20,7 @@
 #pragma once
 
 #include "Item.h"
+#include "BackupStore.h"
 #include <vector>
 #include <filesystem>
 
@@ -43,7 +44,7 @@ namespace d2ce
 
         struct SharedStashPage
         {
-            SharedStashPage(std::list<d2ce::Item>& bufferItems) : StashItems(bufferItems)
+            SharedStashPage(d2ce::ItemList& bufferItems) : StashItems(bufferItems)
             {
             }
 
@@ -52,11 +53,12 @@ namespace d2ce
         };
 
         std::vector<SharedStashPage> Pages;
-        std::list<d2ce::Item> BufferItems;       // Buffer for items not in any page's inventory yet
+        d2ce::ItemList BufferItems;       // Buffer for items not in any page's inventory yet
         std::filesystem::path m_d2ifilename;
         std::filesystem::file_time_type m_ftime; // Modified time of file at the time it was read
         EnumCharVersion CharVersion = APP_CHAR_VERSION;
         bool IsExpansionCharacter = true;
+        GameDataContextPtr m_gameData; // the game data of the character or of the tables the file was opened with
 
     public:
         SharedStash();
@@ -69,16 +71,25 @@ namespace d2ce
 
         void clear(bool bItemsOnly = false);
         void reset(const Character& charInfo);
+        bool open(const std::filesystem::path& path); // stand-alone .d2i file, not tied to a character
         void swap(SharedStash& other);
         bool load();
         bool refresh();
         bool save(bool saveBackup = true);
+        bool serialize(std::vector<std::uint8_t>& buffer); // complete .d2i file image
+        bool getBackups(std::vector<BackupInfo>& backups) const; // oldest first
+        bool restoreBackup(size_t index);
         const std::filesystem::path& getPath() const;
         bool hasBeenModifiedSinceLoad() const;
 
         bool hasSharedStash() const;
         bool isLoaded() const;
 
+        // the game data the stash is read with, activateGameDataContext reinstalls it
+        // and keeps the tables locked until the returned scope is destroyed
+        GameDataContextPtr getGameDataContext() const;
+        GameDataScope activateGameDataContext() const;
+
         size_t size() const; // number of pages
         std::uint32_t getGoldInStash(size_t page) const;
         bool setGoldInStash(std::uint32_t goldValue, size_t page);
@@ -156,7 +167,7 @@ namespace d2ce
         bool setItemRuneword(d2ce::Item& item, std::uint16_t id);
 
     protected:
-        bool refresh(std::FILE* charfile);
+        bool refresh(BitSource& charfile);
     };
     //---------------------------------------------------------------------------
 }
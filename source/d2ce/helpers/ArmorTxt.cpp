@@ -18,225 +18,221 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetArmor()
+        EmbeddedText GetArmor()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"name\tversion\tcompactsave\trarity\tspawnable\tminac\tmaxac\tspeed\treqstr\treqdex\tblock\tdurability\tnodurability\tlevel\tShowLevel\tlevelreq\tcost\tgamble cost\tcode\tnamestr\tmagic lvl\tauto prefix\talternategfx\tnormcode\tubercode\tultracode\tcomponent\tinvwidth\tinvheight\thasinv\tgemsockets\tgemapplytype\tflippyfile\tinvfile\tuniqueinvfile\tsetinvfile\trArm\tlArm\tTorso\tLegs\trSPad\tlSPad\tuseable\tstackable\tminstack\tmaxstack\tspawnstack\tTransmogrify\tTMogType\tTMogMin\tTMogMax\ttype\ttype2\tdropsound\tdropsfxframe\tusesound\tunique\ttransparent\ttranstbl\t*quivered\tlightradius\tbelt\tquest\tquestdiffcheck\tmissiletype\tdurwarning\tqntwarning\tmindam\tmaxdam\tStrBonus\tDexBonus\tgemoffset\tbitfield1\tCharsiMin\tCharsiMax\tCharsiMagicMin\tCharsiMagicMax\tCharsiMagicLvl\tGheedMin\tGheedMax\tGheedMagicMin\tGheedMagicMax\tGheedMagicLvl\tAkaraMin\tAkaraMax\tAkaraMagicMin\tAkaraMagicMax\tAkaraMagicLvl\tFaraMin\tFaraMax\tFaraMagicMin\tFaraMagicMax\tFaraMagicLvl\tLysanderMin\tLysanderMax\tLysanderMagicMin\tLysanderMagicMax\tLysanderMagicLvl\tDrognanMin\tDrognanMax\tDrognanMagicMin\tDrognanMagicMax\tDrognanMagicLvl\tHratliMin\tHratliMax\tHratliMagicMin\tHratliMagicMax\tHratliMagicLvl\tAlkorMin\tAlkorMax\tAlkorMagicMin\tAlkorMagicMax\tAlkorMagicLvl\tOrmusMin\tOrmusMax\tOrmusMagicMin\tOrmusMagicMax\tOrmusMagicLvl\tElzixMin\tElzixMax\tElzixMagicMin\tElzixMagicMax\tElzixMagicLvl\tAshearaMin\tAshearaMax\tAshearaMagicMin\tAshearaMagicMax\tAshearaMagicLvl\tCainMin\tCainMax\tCainMagicMin\tCainMagicMax\tCainMagicLvl\tHalbuMin\tHalbuMax\tHalbuMagicMin\tHalbuMagicMax\tHalbuMagicLvl\tJamellaMin\tJamellaMax\tJamellaMagicMin\tJamellaMagicMax\tJamellaMagicLvl\tLarzukMin\tLarzukMax\tLarzukMagicMin\tLarzukMagicMax\tLarzukMagicLvl\tMalahMin\tMalahMax\tMalahMagicMin\tMalahMagicMax\tMalahMagicLvl\tAnyaMin\tAnyaMax\tAnyaMagicMin\tAnyaMagicMax\tAnyaMagicLvl\tTransform\tInvTrans\tSkipName\tNightmareUpgrade\tHellUpgrade\tNameable\tPermStoreItem\tdiablocloneweight\n";
-                ss << u8"Cap\t0\t0\t1\t1\t3\t5\t0\t0\t0\t0\t12\t0\t1\t0\t0\t64\t3016\tcap\tcap\t\t\tcap\tcap\txap\tuap\t0\t2\t2\t1\t2\t1\tflpcap\tinvcap\tinvcapu\tinvcapu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_cap\t12\titem_cap\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t5\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\tskp\tghm\t1\t0\t\n";
-                ss << u8"Skull Cap\t0\t0\t4\t1\t8\t11\t0\t15\t0\t0\t18\t0\t5\t0\t0\t441\t5551\tskp\tskp\t\t\tskp\tskp\txkp\tukp\t0\t2\t2\t1\t2\t1\tflpskp\tinvskp\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t1\t1\t1\t1\t10\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\thlm\tcrn\t1\t0\t\n";
-                ss << u8"Helm\t0\t0\t4\t1\t15\t18\t0\t26\t0\t0\t24\t0\t11\t0\t0\t1558\t12284\thlm\thlm\t\t\thlm\thlm\txlm\tulm\t0\t2\t2\t1\t2\t1\tflphlm\tinvhlm\tinvhlmu\tinvhlmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\tfhl\tghm\t1\t0\t\n";
-                ss << u8"Full Helm\t0\t0\t4\t1\t23\t26\t0\t41\t0\t0\t30\t0\t15\t0\t0\t3095\t21606\tfhl\tfhl\t\t\tfhl\tfhl\txhl\tuhl\t0\t2\t2\t1\t2\t1\tflpfhl\tinvfhl\tinvfhlu\tinvfhlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tghm\txxx\t1\t0\t\n";
-                ss << u8"Great Helm\t0\t0\t4\t1\t30\t35\t0\t63\t0\t0\t40\t0\t23\t0\t0\t6177\t49517\tghm\tghm\t\t\tghm\tghm\txhm\tuhm\t0\t2\t2\t1\t3\t1\tflpghm\tinvghm\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t1\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tcrn\txxx\t1\t0\t\n";
-                ss << u8"Crown\t0\t0\t4\t1\t25\t45\t0\t55\t0\t0\t50\t0\t29\t0\t0\t8345\t77501\tcrn\tcrn\t\t\tcrn\tcrn\txrn\turn\t0\t2\t2\t1\t3\t1\tflpcrn\tinvcrn\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t1\t1\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mask\t0\t0\t4\t1\t9\t27\t0\t23\t0\t0\t20\t0\t19\t0\t0\t2857\t25570\tmsk\tmsk\t\t\tmsk\tmsk\txsk\tusk\t0\t2\t2\t1\t3\t1\tflpmsk\tinvmsk\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Quilted Armor\t0\t0\t1\t1\t8\t11\t0\t12\t0\t0\t20\t0\t1\t0\t0\t140\t3035\tqui\tqui\t\t\tqlt\tqui\txui\tuui\t1\t2\t3\t1\t2\t1\tflpqlt\tinvqlt\t\t\t0\t0\t0\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t5\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tlea\tgth\t1\t0\t\n";
-                ss << u8"Leather Armor\t0\t0\t2\t1\t14\t17\t0\t15\t0\t0\t24\t0\t3\t0\t0\t481\t4360\tlea\tlea\t\t\tlea\tlea\txea\tuea\t1\t2\t3\t1\t2\t1\tflplea\tinvlea\t\t\t0\t0\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t10\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\thla\tful\t1\t0\t\n";
-                ss << u8"Hard Leather Armor\t0\t0\t3\t1\t21\t24\t0\t20\t0\t0\t28\t0\t5\t0\t0\t1060\t6325\thla\thla\t\t\thla\thla\txla\tula\t1\t2\t3\t1\t2\t1\tflphla\tinvhla\t\t\t1\t1\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t15\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tstu\taar\t1\t0\t\n";
-                ss << u8"Studded Leather \t0\t0\t4\t1\t32\t35\t0\t27\t0\t0\t32\t0\t8\t0\t0\t2385\t11270\tstu\tstu\t\t\tstu\tstu\txtu\tutu\t1\t2\t3\t1\t2\t1\tflpstu\tinvstu\t\t\t1\t0\t0\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t20\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\trng\tltp\t1\t0\t\n";
-                ss << u8"Ring Mail\t0\t0\t4\t1\t45\t48\t5\t36\t0\t0\t26\t0\t11\t0\t0\t4428\t20177\trng\trng\t\t\trng\trng\txng\tung\t1\t2\t3\t1\t3\t1\tflprng\tinvrng\t\t\t0\t0\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t1\t\t1\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tscl\tchn\t1\t0\t\n";
-                ss << u8"Scale Mail\t0\t0\t4\t1\t57\t60\t10\t44\t0\t0\t36\t0\t13\t0\t0\t6508\t30151\tscl\tscl\t\t\tscl\tscl\txcl\tucl\t1\t2\t3\t1\t2\t1\tflpscl\tinvscl\t\t\t1\t1\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tchn\tbrs\t1\t0\t\n";
-                ss << u8"Chain Mail\t0\t0\t4\t1\t72\t75\t5\t48\t0\t0\t45\t0\t15\t0\t0\t9360\t45100\tchn\tchn\t\t\tchn\tchn\txhn\tuhn\t1\t2\t3\t1\t2\t1\tflpchn\tinvchn\t\t\t1\t1\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tbrs\tspl\t1\t0\t\n";
-                ss << u8"Breast Plate\t0\t0\t4\t1\t65\t68\t0\t30\t0\t0\t50\t0\t18\t0\t0\t10078\t56851\tbrs\tbrs\t\t\tbrs\tbrs\txrs\turs\t1\t2\t3\t1\t3\t1\tflpbrs\tinvbrs\t\t\t0\t0\t2\t0\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tspl\tplt\t1\t0\t\n";
-                ss << u8"Splint Mail\t0\t0\t4\t1\t90\t95\t5\t51\t0\t0\t30\t0\t20\t0\t0\t15489\t89945\tspl\tspl\t\t\tspl\tspl\txpl\tupl\t1\t2\t3\t1\t2\t1\tflpspl\tinvspl\t\t\t1\t1\t2\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tplt\tfld\t1\t0\t\n";
-                ss << u8"Plate Mail\t0\t0\t4\t1\t108\t116\t10\t65\t0\t0\t60\t0\t24\t0\t0\t22335\t148510\tplt\tplt\t\t\tplt\tplt\txlt\tult\t1\t2\t3\t1\t2\t1\tflpplt\tinvplt\t\t\t2\t2\t2\t2\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t1\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\tfld\txxx\t1\t0\t\n";
-                ss << u8"Field Plate\t0\t0\t4\t1\t101\t105\t5\t55\t0\t0\t48\t0\t28\t0\t0\t23841\t183387\tfld\tfld\t\t\tfld\tfld\txld\tuld\t1\t2\t3\t1\t2\t1\tflpfld\tinvfld\t\t\t1\t1\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t1\t\t\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\tgth\tful\t1\t0\t\n";
-                ss << u8"Gothic Plate\t0\t0\t4\t1\t128\t135\t5\t70\t0\t0\t55\t0\t32\t0\t0\t34646\t295668\tgth\tgth\t\t\tgth\tgth\txth\tuth\t1\t2\t3\t1\t4\t1\tflpgth\tinvgth\t\t\t2\t2\t1\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t1\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\tful\txxx\t1\t0\t\n";
-                ss << u8"Full Plate Mail\t0\t0\t4\t1\t150\t161\t10\t80\t0\t0\t70\t0\t37\t0\t0\t47192\t457526\tful\tful\t\t\tful\tful\txul\tuul\t1\t2\t3\t1\t4\t1\tflpful\tinvful\tinvfulu\tinvfulu\t2\t2\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t1\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\taar\txxx\t1\t0\t\n";
-                ss << u8"Ancient Armor\t0\t0\t4\t1\t218\t233\t5\t100\t0\t0\t60\t0\t40\t0\t0\t73864\t761140\taar\taar\t\t\taar\taar\txar\tuar\t1\t2\t3\t1\t4\t1\tflpaar\tinvaar\tinvaaru\tinvaaru\t1\t2\t2\t2\t2\t0\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t1\t1\t2\t20\t8\t8\t0\tltp\txxx\t1\t0\t\n";
-                ss << u8"Light Plate\t0\t0\t4\t1\t90\t107\t0\t41\t0\t0\t60\t0\t35\t0\t0\t28327\t267861\tltp\tltp\t\t\tltp\tltp\txtp\tutp\t1\t2\t3\t1\t3\t1\tflpltp\tinvltp\t\t\t2\t0\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t1\t\t\t255\t\t\t1\t2\t20\t\t\t\t\t255\t\t1\t1\t1\t20\t7\t8\t0\tbuc\txxx\t1\t0\t\n";
-                ss << u8"Buckler\t0\t0\t2\t1\t4\t6\t0\t12\t0\t0\t12\t0\t1\t0\t0\t68\t3017\tbuc\tbuc\t\t\tbuc\tbuc\txuc\tuuc\t7\t2\t2\t1\t1\t2\tflpbuc\tinvbuc\tinvbucu\tinvbucu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t1\t3\t100\t\t0\t3\t1\t1\t1\t1\t3\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\tsml\ttow\t1\t0\t\n";
-                ss << u8"Small Shield\t0\t0\t3\t1\t8\t10\t0\t22\t0\t5\t16\t0\t5\t0\t0\t410\t5512\tsml\tsml\t\t\tbuc\tsml\txml\tuml\t7\t2\t2\t1\t2\t2\tflpsml\tinvsml\tinvsmlu\tinvsmlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t2\t3\t100\t\t0\t3\t1\t1\t1\t1\t5\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t1\t1\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t5\t0\tlrg\tkit\t1\t0\t\n";
-                ss << u8"Large Shield\t0\t0\t4\t1\t12\t14\t5\t34\t0\t12\t24\t0\t11\t0\t0\t1214\t11338\tlrg\tlrg\t\t\tlrg\tlrg\txrg\turg\t7\t2\t3\t1\t3\t2\tflplrg\tinvlrg\tinvlrgu\tinvlrgu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t2\t4\t100\t\t0\t3\t\t1\t\t1\t10\t\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\tkit\ttow\t1\t0\t\n";
-                ss << u8"Kite Shield\t0\t0\t4\t1\t16\t18\t0\t47\t0\t8\t30\t0\t15\t0\t0\t2129\t17983\tkit\tkit\t\t\tkit\tkit\txit\tuit\t7\t2\t3\t1\t3\t2\tflpkit\tinvkit\tinvkitu\tinvkitu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t2\t5\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\ttow\tgts\t1\t0\t\n";
-                ss << u8"Tower Shield\t0\t0\t4\t1\t22\t25\t10\t75\t0\t24\t60\t0\t22\t0\t0\t4249\t36869\ttow\ttow\t\t\ttow\ttow\txow\tuow\t7\t2\t3\t1\t3\t2\tflptow\tinvtow\tinvtowu\tinvtowu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t1\t5\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t1\t1\t\t\t1\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t20\t8\t2\t0\tgts\txxx\t1\t0\t\n";
-                ss << u8"Gothic Shield\t0\t0\t4\t1\t30\t35\t5\t60\t0\t16\t40\t0\t30\t0\t0\t8000\t77500\tgts\tgts\t\t\tkit\tgts\txts\tuts\t7\t2\t4\t1\t3\t2\tflpgts\tinvgts\tinvgtsu\tinvgtsu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t2\t6\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t1\t\t\t1\t2\t20\t\t\t\t\t255\t\t\t1\t1\t20\t8\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Leather Gloves\t0\t0\t1\t1\t2\t3\t0\t0\t0\t0\t12\t0\t3\t0\t0\t80\t4060\tlgl\tlgl\t\t\tlgl\tlgl\txlg\tulg\t16\t2\t2\t0\t0\t0\tflplgl\tinvlgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t3\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tvgl\thgl\t1\t0\t\n";
-                ss << u8"Heavy Gloves\t0\t0\t1\t1\t5\t6\t0\t0\t0\t0\t14\t0\t7\t0\t0\t352\t6616\tvgl\tvgl\t\t\tvgl\tvgl\txvg\tuvg\t16\t2\t2\t0\t0\t0\tflpvgl\tinvvgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t1\t\t1\t5\t\t1\t\t1\t1\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tmgl\ttgl\t1\t0\t\n";
-                ss << u8"Chain Gloves\t0\t0\t2\t1\t8\t9\t0\t25\t0\t0\t16\t0\t12\t0\t0\t859\t11077\tmgl\tmgl\t\t\tmgl\tmgl\txmg\tumg\t16\t2\t2\t0\t0\t0\tflpmgl\tinvmgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloveschain\t12\titem_gloveschain\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t1\t\t\t10\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\ttgl\thgl\t1\t0\t\n";
-                ss << u8"Light Gauntlets\t0\t0\t3\t1\t9\t11\t0\t45\t0\t0\t18\t0\t20\t0\t0\t1635\t20675\ttgl\ttgl\t\t\tmgl\ttgl\txtg\tutg\t16\t2\t2\t0\t0\t0\tflptgl\tinvtgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t1\t2\t1\t1\t1\t\t\t1\t1\t255\t1\t1\t\t1\t255\t\t\t1\t1\t20\t\t\t\t\t255\t1\t1\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Gauntlets\t0\t0\t4\t1\t12\t15\t0\t60\t0\t0\t24\t0\t27\t0\t0\t2964\t36007\thgl\thgl\t\t\thgl\thgl\txhg\tuhg\t16\t2\t2\t0\t0\t0\tflphgl\tinvhgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t1\t1\t\t1\t255\t1\t1\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Boots\t0\t0\t1\t1\t2\t3\t0\t0\t0\t0\t12\t0\t3\t0\t0\t80\t4060\tlbt\tlbt\t\t\tlbt\tlbt\txlb\tulb\t16\t2\t2\t0\t0\t0\tflplbt\tinvlbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t3\t8\t120\t\t0\t1\t1\t1\t1\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tvbt\ttbt\t1\t0\t\n";
-                ss << u8"Heavy Boots\t0\t0\t1\t1\t5\t6\t0\t18\t0\t0\t14\t0\t7\t0\t0\t334\t6584\tvbt\tvbt\t\t\tvbt\tvbt\txvb\tuvb\t16\t2\t2\t0\t0\t0\tflpvbt\tinvvbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t4\t10\t120\t\t0\t1\t\t1\t\t1\t1\t\t1\t\t1\t1\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tmbt\ttbt\t1\t0\t\n";
-                ss << u8"Chain Boots\t0\t0\t2\t1\t8\t9\t0\t30\t0\t0\t16\t0\t12\t0\t0\t854\t11062\tmbt\tmbt\t\t\tmbt\tmbt\txmb\tumb\t16\t2\t2\t0\t0\t0\tflpmbt\tinvmbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootschain\t12\titem_bootschain\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t6\t12\t120\t\t0\t3\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\ttbt\thbt\t1\t0\t\n";
-                ss << u8"Light Plated Boots\t0\t0\t3\t1\t9\t11\t0\t50\t0\t0\t18\t0\t20\t0\t0\t1630\t20650\ttbt\ttbt\t\t\tmbt\ttbt\txtb\tutb\t16\t2\t2\t0\t0\t0\tflptbt\tinvtbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t8\t16\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t1\t2\t1\t1\t1\t\t\t1\t1\t20\t1\t1\t\t1\t255\t\t\t1\t1\t20\t\t\t\t\t255\t1\t1\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Greaves\t0\t0\t4\t1\t12\t15\t0\t70\t0\t0\t24\t0\t27\t0\t0\t2954\t35939\thbt\thbt\t\t\thbt\thbt\txhb\tuhb\t16\t2\t2\t0\t0\t0\tflphbt\tinvhbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t10\t20\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t1\t1\t1\t1\t20\t1\t1\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sash\t0\t0\t1\t1\t2\t2\t0\t0\t0\t0\t12\t0\t3\t0\t0\t64\t4048\tlbl\tlbl\t\t\tlbl\tlbl\tzlb\tulc\t16\t2\t1\t0\t0\t0\tflplbl\tinvlbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t1\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tvbl\ttbl\t1\t0\t\n";
-                ss << u8"Light Belt\t0\t0\t1\t1\t3\t3\t0\t0\t0\t0\t14\t0\t7\t0\t0\t192\t6336\tvbl\tvbl\t\t\tvbl\tvbl\tzvb\tuvc\t16\t2\t1\t0\t0\t0\tflpvbl\tinvvbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t4\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t1\t\t1\t1\t\t1\t\t1\t1\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tmbl\thbl\t1\t0\t\n";
-                ss << u8"Belt\t0\t0\t2\t1\t5\t5\t0\t25\t0\t0\t16\t0\t12\t0\t0\t495\t9985\tmbl\tmbl\t\t\tmbl\tmbl\tzmb\tumc\t16\t2\t1\t0\t0\t0\tflpmbl\tinvmbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t0\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\ttbl\thbl\t1\t0\t\n";
-                ss << u8"Heavy Belt\t0\t0\t2\t1\t6\t6\t0\t45\t0\t0\t18\t0\t20\t0\t0\t963\t17315\ttbl\ttbl\t\t\tmbl\ttbl\tztb\tutc\t16\t2\t1\t0\t0\t0\tflptbl\tinvtbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t5\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t1\t2\t1\t1\t1\t\t\t1\t1\t20\t1\t1\t\t1\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Plated Belt\t0\t0\t3\t1\t8\t11\t0\t60\t0\t0\t24\t0\t27\t0\t0\t2068\t29959\thbl\thbl\t\t\thbl\thbl\tzhb\tuhc\t16\t2\t1\t0\t0\t0\tflphbl\tinvhbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t3\t\t\t0\t4\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t1\t1\t1\t1\t20\t1\t1\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t1\t1\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bone Helm\t0\t0\t2\t1\t33\t36\t0\t25\t0\t0\t40\t0\t22\t0\t0\t6323\t48276\tbhm\tbhm\t\t\tbhm\tbhm\txh9\tuh9\t0\t2\t2\t1\t2\t1\tflpbhm\tinvbhm\tinvbhmu\tinvbhmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t2\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t7\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bone Shield\t0\t0\t2\t1\t10\t30\t0\t25\t0\t20\t40\t0\t19\t0\t0\t3175\t27081\tbsh\tbsh\t\t\tbsh\tbsh\txsh\tush\t7\t2\t3\t1\t2\t2\tflpbsh\tinvbsh\tinvbshu\tinvbshu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t3\t6\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Spiked Shield\t0\t0\t3\t1\t15\t25\t0\t30\t0\t10\t40\t0\t11\t0\t0\t1890\t13197\tspk\tspk\t\t\tspk\tspk\txpk\tupk\t7\t2\t3\t1\t2\t2\tflpspk\tinvspk\tinvspku\tinvspku\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t5\t9\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Hat\t0\t0\t1\t1\t45\t53\t0\t20\t0\t0\t12\t0\t34\t0\t22\t13560\t82061\txap\txap\t\t\tcap\tcap\txap\tuap\t0\t2\t2\t1\t2\t1\tflpcap\tinvcap\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_cap\t12\titem_cap\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sallet\t0\t0\t4\t1\t52\t62\t0\t43\t0\t0\t18\t0\t37\t0\t25\t17210\t113647\txkp\txkp\t\t\tskp\tskp\txkp\tukp\t0\t2\t2\t1\t2\t1\tflpskp\tinvskp\tinvxkpu\tinvxkpu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Casque\t0\t0\t4\t1\t63\t72\t0\t59\t0\t0\t24\t0\t42\t0\t25\t23075\t171804\txlm\txlm\t\t\thlm\thlm\txlm\tulm\t0\t2\t2\t1\t2\t1\tflphlm\tinvhlm\tinvhlmu\tinvhlmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Basinet\t0\t0\t4\t1\t75\t84\t0\t82\t0\t0\t30\t0\t45\t0\t25\t29083\t233910\txhl\txhl\t\t\tfhl\tfhl\txhl\tuhl\t0\t2\t2\t1\t2\t1\tflpfhl\tinvfhl\tinvfhlu\tinvfhlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Winged Helm\t0\t0\t4\t1\t85\t98\t0\t115\t0\t0\t40\t0\t51\t0\t25\t37846\t355900\txhm\txhm\t\t\tghm\tghm\txhm\tuhm\t0\t2\t2\t1\t3\t1\tflpghm\tinvghm\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Grand Crown\t0\t0\t4\t1\t78\t113\t0\t103\t0\t0\t50\t0\t55\t0\t25\t42458\t448816\txrn\txrn\t\t\tcrn\tcrn\txrn\turn\t0\t2\t2\t1\t3\t1\tflpcrn\tinvcrn\tinvxrnu\tinvxrnu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Death Mask\t0\t0\t4\t1\t54\t86\t0\t55\t0\t0\t20\t0\t48\t0\t25\t27190\t241184\txsk\txsk\t\t\tmsk\tmsk\txsk\tusk\t0\t2\t2\t1\t3\t1\tflpmsk\tinvmsk\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ghost Armor\t0\t0\t1\t1\t102\t117\t0\t38\t0\t0\t20\t0\t34\t0\t22\t30552\t165635\txui\txui\t\t\tqlt\tqui\txui\tuui\t1\t2\t3\t1\t2\t1\tflpqlt\tinvqlt\t\t\t0\t0\t0\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Serpentskin Armor\t0\t0\t2\t1\t111\t126\t0\t43\t0\t0\t24\t0\t36\t0\t24\t34960\t197896\txea\txea\t\t\tlea\tlea\txea\tuea\t1\t2\t3\t1\t2\t1\tflplea\tinvlea\t\t\t0\t0\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Demonhide Armor\t0\t0\t3\t1\t122\t136\t0\t50\t0\t0\t28\t0\t37\t0\t25\t39090\t236758\txla\txla\t\t\thla\thla\txla\tula\t1\t2\t3\t1\t2\t1\tflphla\tinvhla\t\t\t1\t1\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Trellised Armor\t0\t0\t4\t1\t138\t153\t0\t61\t0\t0\t32\t0\t40\t0\t25\t47582\t305707\txtu\txtu\t\t\tstu\tstu\txtu\tutu\t1\t2\t3\t1\t2\t1\tflpstu\tinvstu\tinvxtuu\tinvxtuu\t1\t0\t0\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Linked Mail\t0\t0\t4\t1\t158\t172\t5\t74\t0\t0\t26\t0\t42\t0\t25\t56600\t393748\txng\txng\t\t\trng\trng\txng\tung\t1\t2\t3\t1\t3\t1\tflprng\tinvrng\t\t\t0\t0\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Tigulated Mail\t0\t0\t4\t1\t176\t190\t10\t86\t0\t0\t36\t0\t43\t0\t25\t64242\t473193\txcl\txcl\t\t\tscl\tscl\txcl\tucl\t1\t2\t3\t1\t3\t1\tflpscl\tinvscl\t\t\t1\t1\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mesh Armor\t0\t0\t4\t1\t198\t213\t5\t92\t0\t0\t45\t0\t45\t0\t25\t75440\t574094\txhn\txhn\t\t\tchn\tchn\txhn\tuhn\t1\t2\t3\t1\t3\t1\tflpchn\tinvchn\t\t\t1\t1\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cuirass\t0\t0\t4\t1\t188\t202\t0\t65\t0\t0\t50\t0\t47\t0\t25\t74719\t613456\txrs\txrs\t\t\tbrs\tbrs\txrs\turs\t1\t2\t3\t1\t3\t1\tflpbrs\tinvbrs\t\tinvxrss\t0\t0\t2\t0\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Russet Armor\t0\t0\t4\t1\t225\t243\t5\t97\t0\t0\t30\t0\t49\t0\t25\t93404\t788235\txpl\txpl\t\t\tspl\tspl\txpl\tupl\t1\t2\t3\t1\t3\t1\tflpspl\tinvspl\t\t\t1\t1\t2\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Templar Coat\t0\t0\t4\t1\t252\t274\t10\t118\t0\t0\t60\t0\t52\t0\t25\t111395\t1017928\txlt\txlt\t\t\tplt\tplt\txlt\tult\t1\t2\t3\t1\t3\t1\tflpplt\tinvplt\t\t\t2\t2\t2\t2\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sharktooth Armor\t0\t0\t4\t1\t242\t258\t5\t103\t0\t0\t48\t0\t55\t0\t25\t111674\t1103159\txld\txld\t\t\tfld\tfld\txld\tuld\t1\t2\t3\t1\t3\t1\tflpfld\tinvfld\t\t\t1\t1\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Embossed Plate\t0\t0\t4\t1\t282\t303\t5\t125\t0\t0\t55\t0\t58\t0\t25\t137817\t1457493\txth\txth\t\t\tgth\tgth\txth\tuth\t1\t2\t3\t1\t4\t1\tflpgth\tinvgth\t\t\t2\t2\t1\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Chaos Armor\t0\t0\t4\t1\t315\t342\t10\t140\t0\t0\t70\t0\t61\t0\t25\t162672\t1888411\txul\txul\t\t\tful\tful\txul\tuul\t1\t2\t3\t1\t4\t1\tflpful\tinvful\t\t\t2\t2\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ornate Armor\t0\t0\t4\t1\t417\t450\t5\t170\t0\t0\t60\t0\t64\t0\t25\t225120\t2696482\txar\txar\t\t\taar\taar\txar\tuar\t1\t2\t3\t1\t4\t1\tflpaar\tinvaar\tinvxaru\tinvxaru\t1\t2\t2\t2\t2\t0\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mage Plate\t0\t0\t4\t1\t225\t261\t0\t55\t0\t0\t60\t0\t60\t0\t25\t118407\t1327498\txtp\txtp\t\t\tltp\tltp\txtp\tutp\t1\t2\t3\t1\t3\t1\tflpltp\tinvltp\t\t\t2\t0\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Defender\t0\t0\t2\t1\t41\t49\t0\t38\t0\t10\t68\t0\t34\t0\t22\t12562\t77123\txuc\txuc\t\t\tbuc\tbuc\txuc\tuuc\t7\t2\t2\t1\t1\t2\tflpbuc\tinvbuc\tinvbucu\tinvbucu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t8\t12\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Round Shield\t0\t0\t3\t1\t47\t55\t0\t53\t0\t12\t64\t0\t37\t0\t25\t15451\t103735\txml\txml\t\t\tbuc\tsml\txml\tuml\t7\t2\t2\t1\t2\t2\tflpsml\tinvsml\tinvxmlu\tinvxmlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t7\t14\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t5\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Scutum\t0\t0\t4\t1\t53\t61\t5\t71\t0\t14\t62\t0\t42\t0\t25\t19537\t148359\txrg\txrg\t\t\tlrg\tlrg\txrg\turg\t7\t2\t3\t1\t3\t2\tflplrg\tinvlrg\tinvxrgu\tinvxrgu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t11\t15\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Dragon Shield\t0\t0\t4\t1\t59\t67\t0\t91\t0\t18\t76\t0\t45\t0\t25\t23094\t189944\txit\txit\t\t\tkit\tkit\txit\tuit\t7\t2\t3\t1\t3\t2\tflpkit\tinvkit\tinvkitu\tinvkitu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t15\t24\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Pavise\t0\t0\t4\t1\t68\t78\t10\t133\t0\t24\t72\t0\t50\t0\t25\t29550\t278500\txow\txow\t\t\ttow\ttow\txow\tuow\t7\t2\t3\t1\t3\t2\tflptow\tinvtow\tinvtowu\tinvtowu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t10\t17\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ancient Shield\t0\t0\t4\t1\t80\t93\t5\t110\t0\t16\t80\t0\t56\t0\t25\t39220\t422340\txts\txts\t\t\tkit\tgts\txts\tuts\t7\t2\t4\t1\t3\t2\tflpgts\tinvgts\tinvgtsu\tinvgtsu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t12\t16\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Demonhide Gloves\t0\t0\t1\t1\t28\t35\t0\t20\t0\t0\t12\t0\t33\t0\t21\t8480\t64102\txlg\txlg\t\t\tlgl\tlgl\txlg\tulg\t16\t2\t2\t0\t0\t0\tflplgl\tinvlgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sharkskin Gloves\t0\t0\t1\t1\t33\t39\t0\t20\t0\t0\t14\t0\t39\t0\t25\t11420\t85063\txvg\txvg\t\t\tvgl\tvgl\txvg\tuvg\t16\t2\t2\t0\t0\t0\tflpvgl\tinvvgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Heavy Bracers\t0\t0\t2\t1\t37\t44\t0\t58\t0\t0\t16\t0\t43\t0\t25\t14111\t114806\txmg\txmg\t\t\tmgl\tmgl\txmg\tumg\t16\t2\t2\t0\t0\t0\tflpmgl\tinvmgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloveschain\t12\titem_gloveschain\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Battle Gauntlets\t0\t0\t3\t1\t39\t47\t0\t88\t0\t0\t18\t0\t49\t0\t25\t16913\t161025\txtg\txtg\t\t\tmgl\ttgl\txtg\tutg\t16\t2\t2\t0\t0\t0\tflptgl\tinvtgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Gauntlets\t0\t0\t4\t1\t43\t53\t0\t110\t0\t0\t24\t0\t54\t0\t25\t20900\t223744\txhg\txhg\t\t\thgl\thgl\txhg\tuhg\t16\t2\t2\t0\t0\t0\tflphgl\tinvhgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Demonhide Boots\t0\t0\t1\t1\t28\t35\t0\t20\t0\t0\t12\t0\t36\t0\t24\t9230\t64102\txlb\txlb\t\t\tlbt\tlbt\txlb\tulb\t16\t2\t2\t0\t0\t0\tflplbt\tinvlbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t26\t46\t120\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sharkskin Boots\t0\t0\t1\t1\t33\t39\t0\t47\t0\t0\t14\t0\t39\t0\t25\t11393\t84859\txvb\txvb\t\t\tvbt\tvbt\txvb\tuvb\t16\t2\t2\t0\t0\t0\tflpvbt\tinvvbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t28\t50\t120\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n";
-                ss << u8"Mesh Boots\t0\t0\t2\t1\t37\t44\t0\t65\t0\t0\t16\t0\t43\t0\t25\t14103\t114742\txmb\txmb\t\t\tmbt\tmbt\txmb\tumb\t16\t2\t2\t0\t0\t0\tflpmbt\tinvmbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootschain\t12\titem_bootschain\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t23\t52\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n";
-                ss << u8"Battle Boots\t0\t0\t3\t1\t39\t47\t0\t95\t0\t0\t18\t0\t49\t0\t25\t16905\t160950\txtb\txtb\t\t\tmbt\ttbt\txtb\tutb\t16\t2\t2\t0\t0\t0\tflptbt\tinvtbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t37\t64\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n";
-                ss << u8"War Boots\t0\t0\t4\t1\t43\t53\t0\t125\t0\t0\t24\t0\t54\t0\t25\t20885\t223574\txhb\txhb\t\t\thbt\thbt\txhb\tuhb\t16\t2\t2\t0\t0\t0\tflphbt\tinvhbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t39\t80\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n";
-                ss << u8"Demonhide Sash\t0\t0\t1\t1\t29\t34\t0\t20\t0\t0\t12\t0\t36\t0\t24\t9304\t64486\tzlb\tzlb\t\t\tlbl\tlbl\tzlb\tulc\t16\t2\t1\t0\t0\t0\tflplbl\tinvlbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n";
-                ss << u8"Sharkskin Belt\t0\t0\t1\t1\t31\t36\t0\t20\t0\t0\t14\t0\t39\t0\t25\t10700\t80809\tzvb\tzvb\t\t\tvbl\tvbl\tzvb\tuvc\t16\t2\t1\t0\t0\t0\tflpvbl\tinvvbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n";
-                ss << u8"Mesh Belt\t0\t0\t2\t1\t35\t40\t0\t58\t0\t0\t16\t0\t43\t0\t25\t13143\t108261\tzmb\tzmb\t\t\tmbl\tmbl\tzmb\tumc\t16\t2\t1\t0\t0\t0\tflpmbl\tinvmbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Battle Belt\t0\t0\t2\t1\t37\t42\t0\t88\t0\t0\t18\t0\t49\t0\t25\t15713\t151185\tztb\tztb\t\t\tmbl\ttbl\tztb\tutc\t16\t2\t1\t0\t0\t0\tflptbl\tinvtbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Belt\t0\t0\t3\t1\t41\t52\t0\t110\t0\t0\t24\t0\t54\t0\t25\t20350\t218512\tzhb\tzhb\t\t\thbl\thbl\tzhb\tuhc\t16\t2\t1\t0\t0\t0\tflphbl\tinvhbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Grim Helm\t0\t0\t2\t1\t60\t125\t0\t58\t0\t0\t40\t0\t50\t0\t25\t37683\t348947\txh9\txh9\t\t\tbhm\tbhm\txh9\tuh9\t0\t2\t2\t1\t2\t1\tflpbhm\tinvbhm\tinvbhmu\tinvbhmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t2\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Grim Shield\t0\t0\t2\t1\t50\t150\t0\t58\t0\t20\t70\t0\t48\t0\t25\t39143\t337523\txsh\txsh\t\t\tbsh\tbsh\txsh\tush\t7\t2\t3\t1\t2\t2\tflpbsh\tinvbsh\tinvxshu\tinvxshu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t14\t20\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Barbed Shield\t0\t0\t3\t1\t58\t78\t0\t65\t0\t17\t55\t0\t42\t0\t25\t23155\t172324\txpk\txpk\t\t\tspk\tspk\txpk\tupk\t7\t2\t3\t1\t2\t2\tflpspk\tinvspk\tinvxpku\tinvxpku\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t18\t35\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                ss << u8"Wolf Head\t100\t0\t1\t1\t8\t11\t0\t16\t0\t0\t20\t0\t4\t0\t3\t364\t4868\tdr1\tdr1\t\t\tdr1\tdr1\tdr6\tdrb\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hawk Helm\t100\t0\t1\t1\t4\t15\t0\t20\t0\t0\t20\t0\t8\t0\t6\t664\t7840\tdr2\tdr2\t\t\tdr4\tdr2\tdr7\tdrc\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Antlers\t100\t0\t1\t1\t18\t24\t0\t24\t0\t0\t20\t0\t16\t0\t12\t2832\t21852\tdr3\tdr3\t\t\tdr3\tdr3\tdr8\tdrd\t0\t2\t2\t1\t3\t1\tflpdr3\tinvdr3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Falcon Mask\t100\t0\t1\t1\t12\t28\t0\t28\t0\t0\t20\t0\t20\t0\t15\t3332\t29200\tdr4\tdr4\t\t\tdr4\tdr4\tdr9\tdre\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Spirit Mask\t100\t0\t1\t1\t22\t35\t0\t30\t0\t0\t20\t0\t24\t0\t18\t5670\t48550\tdr5\tdr5\t\t\tdr1\tdr5\tdra\tdrf\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Jawbone Cap\t100\t0\t2\t1\t10\t15\t0\t25\t0\t0\t25\t0\t4\t0\t3\t320\t4750\tba1\tba1\t\t\tba1\tba1\tba6\tbab\t0\t2\t2\t1\t3\t1\tflpba1\tinvba1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Fanged Helm\t100\t0\t2\t1\t15\t20\t0\t35\t0\t0\t35\t0\t8\t0\t6\t750\t8250\tba2\tba2\t\t\tba1\tba2\tba7\tbac\t0\t2\t2\t1\t3\t1\tflpba1\tinvba2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Horned Helm\t100\t0\t2\t1\t25\t30\t0\t45\t0\t0\t45\t0\t16\t0\t12\t2750\t20750\tba3\tba3\t\t\tba3\tba3\tba8\tbad\t0\t2\t2\t1\t3\t1\tflpba3\tinvba3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Assault Helmet\t100\t0\t2\t1\t30\t35\t0\t55\t0\t0\t50\t0\t20\t0\t15\t3420\t29360\tba4\tba4\t\t\tba5\tba4\tba9\tbae\t0\t2\t2\t1\t3\t1\tflpba5\tinvba4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Avenger Guard\t100\t0\t2\t1\t35\t50\t0\t65\t0\t0\t55\t0\t24\t0\t18\t5785\t49280\tba5\tba5\t\t\tba5\tba5\tbaa\tbaf\t0\t2\t2\t1\t3\t1\tflpba5\tinvba5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Targe\t100\t0\t2\t1\t8\t12\t0\t16\t0\t10\t20\t0\t4\t0\t3\t384\t6317\tpa1\tpa1\t\t304\tpa1\tpa1\tpa6\tpab\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t1\t0\t\t\t0\t1\t0\t2\t6\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Rondache\t100\t0\t2\t1\t10\t18\t0\t26\t0\t15\t30\t0\t8\t0\t6\t982\t10517\tpa2\tpa2\t\t304\tpa1\tpa2\tpa7\tpac\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t2\t0\t\t\t0\t1\t0\t2\t8\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Heraldic Shield\t100\t0\t2\t1\t16\t26\t0\t40\t0\t20\t40\t0\t16\t0\t12\t2816\t21240\tpa3\tpa3\t\t304\tpa3\tpa3\tpa8\tpad\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t3\t0\t\t\t0\t1\t0\t3\t9\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Aerin Shield\t100\t0\t2\t1\t26\t36\t0\t50\t0\t22\t50\t0\t20\t0\t15\t5158\t43557\tpa4\tpa4\t\t304\tpa3\tpa4\tpa9\tpae\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t4\t0\t\t\t0\t1\t0\t4\t10\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Crown Shield\t100\t0\t2\t1\t30\t40\t0\t65\t0\t25\t60\t0\t24\t0\t18\t6935\t82075\tpa5\tpa5\t\t304\tpa5\tpa5\tpaa\tpaf\t7\t2\t2\t1\t4\t2\tflppa5\tinvpa5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t5\t0\t\t\t0\t1\t0\t4\t12\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Preserved Head\t100\t0\t1\t1\t2\t5\t0\t12\t0\t3\t20\t0\t4\t0\t3\t128\t4628\tne1\tne1\t\t305\tne1\tne1\tne6\tneb\t10\t2\t2\t1\t2\t2\tflpne1\tinvne1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Zombie Head\t100\t0\t1\t1\t4\t8\t0\t14\t0\t5\t20\t0\t8\t0\t6\t418\t7336\tne2\tne2\t\t305\tne2\tne2\tne7\tneg\t10\t2\t2\t1\t2\t2\tflpne2\tinvne2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Unraveller Head\t100\t0\t1\t1\t6\t10\t0\t18\t0\t8\t20\t0\t16\t0\t12\t1070\t14780\tne3\tne3\t\t305\tne3\tne3\tne8\tned\t10\t2\t2\t1\t2\t2\tflpne3\tinvne3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Gargoyle Head\t100\t0\t1\t1\t10\t16\t0\t20\t0\t10\t20\t0\t20\t0\t15\t2164\t23320\tne4\tne4\t\t305\tne3\tne4\tne9\tnee\t10\t2\t2\t1\t2\t2\tflpne3\tinvne4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Demon Head\t100\t0\t1\t1\t15\t20\t0\t25\t0\t12\t20\t0\t24\t0\t18\t3475\t35350\tne5\tne5\t\t305\tne2\tne5\tnea\tnef\t10\t2\t2\t1\t2\t2\tflpne2\tinvne5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Circlet\t100\t0\t1\t1\t20\t30\t0\t0\t0\t0\t35\t0\t24\t0\t16\t12000\t85625\tci0\tci0\t3\t\tlit\tci0\tci2\tci3\t0\t2\t2\t1\t2\t1\tflpci0\tinvci0\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tcirc\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Coronet\t100\t0\t1\t1\t30\t40\t0\t0\t0\t0\t30\t0\t52\t0\t39\t23000\t171250\tci1\tci1\t8\t\tlit\tci1\tci2\tci3\t0\t2\t2\t1\t2\t1\tflpci1\tinvci1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tcirc\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t1\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Tiara\t100\t0\t1\t1\t40\t50\t0\t0\t0\t0\t25\t0\t70\t0\t52\t35000\t700000\tci2\tci2\t13\t\tlit\tci1\tci2\tci3\t0\t2\t2\t1\t3\t1\tflpci1\tinvci2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tcirc\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t2\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Diadem\t100\t0\t1\t1\t50\t60\t0\t0\t0\t0\t20\t0\t85\t0\t64\t58000\t1382500\tci3\tci3\t18\t\tlit\tci1\tci2\tci3\t0\t2\t2\t1\t3\t1\tflpci2\tinvci3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tcirc\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t3\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Shako\t100\t0\t1\t1\t98\t141\t0\t50\t0\t0\t12\t0\t58\t0\t43\t56307\t503591\tuap\tuap\t\t\tcap\tcap\txap\tuap\t0\t2\t2\t1\t2\t1\tflpcap\tinvcap\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_cap\t12\titem_cap\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hydraskull\t100\t0\t4\t1\t101\t145\t0\t84\t0\t0\t18\t0\t63\t0\t47\t62739\t568276\tukp\tukp\t\t\tskp\tskp\txkp\tukp\t0\t2\t2\t1\t2\t1\tflpskp\tinvskp\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Armet\t100\t0\t4\t1\t105\t149\t0\t109\t0\t0\t24\t0\t68\t0\t51\t69940\t671703\tulm\tulm\t\t\thlm\thlm\txlm\tulm\t0\t2\t2\t1\t2\t1\tflphlm\tinvhlm\tinvhlmu\tinvhlmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Giant Conch\t100\t0\t4\t1\t110\t154\t0\t142\t0\t0\t30\t0\t54\t0\t40\t57806\t757863\tuhl\tuhl\t\t\tfhl\tfhl\txhl\tuhl\t0\t2\t2\t1\t2\t1\tflpfhl\tinvfhl\tinvfhlu\tinvfhlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Spired Helm\t100\t0\t4\t1\t114\t159\t0\t192\t0\t0\t40\t0\t79\t0\t59\t87168\t920880\tuhm\tuhm\t\t\tghm\tghm\txhm\tuhm\t0\t2\t2\t1\t3\t1\tflpghm\tinvghm\t\tinvuhms\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Corona\t100\t0\t4\t1\t111\t165\t0\t174\t0\t0\t50\t0\t85\t0\t66\t94770\t1042170\turn\turn\t\t\tcrn\tcrn\txrn\turn\t0\t2\t2\t1\t3\t1\tflpcrn\tinvcrn\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Demonhead\t100\t0\t4\t1\t101\t154\t0\t102\t0\t0\t20\t0\t74\t0\t55\t76578\t799703\tusk\tusk\t\t\tmsk\tmsk\txsk\tusk\t0\t2\t2\t1\t3\t1\tflpmsk\tinvmsk\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Dusk Shroud\t100\t0\t1\t1\t361\t467\t0\t77\t0\t0\t20\t0\t65\t0\t49\t218357\t1685148\tuui\tuui\t\t\tqlt\tqui\txui\tuui\t1\t2\t3\t1\t4\t1\tflpqlt\tinvqlt\t\t\t0\t0\t0\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Wyrmhide\t100\t0\t2\t1\t364\t470\t0\t84\t0\t0\t24\t0\t67\t0\t50\t226927\t1785276\tuea\tuea\t\t\tlea\tlea\txea\tuea\t1\t2\t3\t1\t4\t1\tflplea\tinvlea\t\t\t0\t0\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Scarab Husk\t100\t0\t3\t1\t369\t474\t0\t95\t0\t0\t28\t0\t68\t0\t51\t232573\t1891607\tula\tula\t\t\thla\thla\txla\tula\t1\t2\t3\t1\t4\t1\tflphla\tinvhla\t\t\t1\t1\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Wire Fleece\t100\t0\t4\t1\t375\t481\t0\t111\t0\t0\t32\t0\t70\t0\t53\t243050\t2059887\tutu\tutu\t\t\tstu\tstu\txtu\tutu\t1\t2\t3\t1\t4\t1\tflpstu\tinvstu\t\t\t1\t0\t0\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Diamond Mail\t100\t0\t4\t1\t383\t489\t5\t131\t0\t0\t26\t0\t72\t0\t54\t254435\t2243423\tung\tung\t\t\trng\trng\txng\tung\t1\t2\t3\t1\t4\t1\tflprng\tinvrng\t\t\t0\t0\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Loricated Mail\t100\t0\t4\t1\t390\t496\t10\t149\t0\t0\t36\t0\t73\t0\t55\t262166\t2382039\tucl\tucl\t\t\tscl\tscl\txcl\tucl\t1\t2\t3\t1\t4\t1\tflpscl\tinvscl\t\t\t1\t1\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Boneweave\t100\t0\t4\t1\t399\t505\t5\t158\t0\t0\t45\t0\t62\t0\t47\t227700\t2536340\tuhn\tuhn\t\t\tchn\tchn\txhn\tuhn\t1\t2\t3\t1\t4\t1\tflpchn\tinvchn\t\t\t1\t1\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Great Hauberk\t100\t0\t4\t1\t395\t501\t0\t118\t0\t0\t50\t0\t75\t0\t56\t272206\t2676189\turs\turs\t\t\tbrs\tbrs\txrs\turs\t1\t2\t3\t1\t4\t1\tflpbrs\tinvbrs\t\t\t0\t0\t2\t0\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Balrog Skin\t100\t0\t4\t1\t410\t517\t5\t165\t0\t0\t30\t0\t76\t0\t57\t285351\t2882894\tupl\tupl\t\t\tspl\tspl\txpl\tupl\t1\t2\t3\t1\t4\t1\tflpspl\tinvspl\t\t\t1\t1\t2\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hellforge Plate\t100\t0\t4\t1\t421\t530\t10\t196\t0\t0\t60\t0\t78\t0\t59\t300130\t3197721\tult\tult\t\t\tplt\tplt\txlt\tult\t1\t2\t3\t1\t4\t1\tflpplt\tinvplt\t\t\t2\t2\t2\t2\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Kraken Shell\t100\t0\t4\t1\t417\t523\t5\t174\t0\t0\t48\t0\t81\t0\t61\t308015\t3411990\tuld\tuld\t\t\tfld\tfld\txld\tuld\t1\t2\t3\t1\t4\t1\tflpfld\tinvfld\t\t\t1\t1\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Lacquered Plate\t100\t0\t4\t1\t433\t541\t5\t208\t0\t0\t55\t0\t82\t0\t62\t323094\t3803464\tuth\tuth\t\t\tgth\tgth\txth\tuth\t1\t2\t3\t1\t4\t1\tflpgth\tinvgth\t\t\t2\t2\t1\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Shadow Plate\t100\t0\t4\t1\t446\t557\t10\t230\t0\t0\t70\t0\t83\t0\t64\t336644\t4274953\tuul\tuul\t\t\tful\tful\txul\tuul\t1\t2\t3\t1\t4\t1\tflpful\tinvful\t\t\t2\t2\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sacred Armor\t100\t0\t4\t1\t487\t600\t5\t232\t0\t0\t60\t0\t85\t0\t66\t373558\t4872212\tuar\tuar\t\t\taar\taar\txar\tuar\t1\t2\t3\t1\t4\t1\tflpaar\tinvaar\tinvaaru\tinvaaru\t1\t2\t2\t2\t2\t0\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Archon Plate\t100\t0\t4\t1\t410\t524\t0\t103\t0\t0\t60\t0\t84\t0\t63\t317526\t3851372\tutp\tutp\t\t\tltp\tltp\txtp\tutp\t1\t2\t3\t1\t4\t1\tflpltp\tinvltp\t\t\t2\t0\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Heater\t100\t0\t2\t1\t95\t110\t0\t77\t0\t22\t88\t0\t58\t0\t43\t48303\t385227\tuuc\tuuc\t\t\tbuc\tbuc\txuc\tuuc\t7\t2\t2\t1\t2\t2\tflpbuc\tinvbuc\tinvbucu\tinvbucu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t16\t30\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Luna\t100\t0\t3\t1\t108\t123\t0\t100\t0\t20\t84\t0\t61\t0\t45\t57189\t436543\tuml\tuml\t\t\tbuc\tsml\txml\tuml\t7\t2\t2\t1\t2\t2\tflpsml\tinvsml\tinvsmlu\tinvsmlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t17\t29\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t5\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hyperion\t100\t0\t4\t1\t119\t135\t5\t127\t0\t24\t82\t0\t64\t0\t48\t65914\t514278\turg\turg\t\t\tlrg\tlrg\txrg\turg\t7\t2\t3\t1\t3\t2\tflplrg\tinvlrg\tinvlrgu\tinvlrgu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t14\t32\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Monarch\t100\t0\t4\t1\t133\t148\t0\t156\t0\t22\t86\t0\t72\t0\t54\t81896\t576154\tuit\tuit\t\t\tkit\tkit\txit\tuit\t7\t2\t3\t1\t4\t2\tflpkit\tinvkit\tinvkitu\tinvkitu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t12\t34\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Aegis\t100\t0\t4\t1\t145\t161\t10\t219\t0\t24\t92\t0\t79\t0\t59\t97701\t693568\tuow\tuow\t\t\ttow\ttow\txow\tuow\t7\t2\t3\t1\t4\t2\tflptow\tinvtow\tinvtowu\tinvtowu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t18\t28\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ward\t100\t0\t4\t1\t153\t170\t5\t185\t0\t24\t100\t0\t84\t0\t63\t109635\t856602\tuts\tuts\t\t\tkit\tgts\txts\tuts\t7\t2\t4\t1\t4\t2\tflpgts\tinvgts\tinvgtsu\tinvutss\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t11\t35\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bramble Mitts\t100\t0\t1\t1\t54\t62\t0\t50\t0\t0\t12\t0\t57\t0\t42\t26920\t269938\tulg\tulg\t\t\tlgl\tlgl\txlg\tulg\t16\t2\t2\t0\t0\t0\tflplgl\tinvlgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Vampirebone Gloves\t100\t0\t1\t1\t56\t65\t0\t50\t0\t0\t14\t0\t63\t0\t47\t30862\t306103\tuvg\tuvg\t\t\tvgl\tvgl\txvg\tuvg\t16\t2\t2\t0\t0\t0\tflpvgl\tinvvgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Vambraces\t100\t0\t2\t1\t59\t67\t0\t106\t0\t0\t16\t0\t69\t0\t51\t34964\t352152\tumg\tumg\t\t\tmgl\tmgl\txmg\tumg\t16\t2\t2\t0\t0\t0\tflpmgl\tinvmgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloveschain\t12\titem_gloveschain\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Crusader Gauntlets\t100\t0\t3\t1\t59\t68\t0\t151\t0\t0\t18\t0\t76\t0\t57\t39119\t420620\tutg\tutg\t\t\tmgl\ttgl\txtg\tutg\t16\t2\t2\t0\t0\t0\tflptgl\tinvtgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ogre Gauntlets\t100\t0\t4\t1\t62\t71\t0\t185\t0\t0\t24\t0\t85\t0\t64\t45481\t498191\tuhg\tuhg\t\t\thgl\thgl\txhg\tuhg\t16\t2\t2\t0\t0\t0\tflphgl\tinvhgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Wyrmhide Boots\t100\t0\t1\t1\t54\t62\t0\t50\t0\t0\t12\t0\t60\t0\t45\t28315\t269938\tulb\tulb\t\t\tlbt\tlbt\txlb\tulb\t16\t2\t2\t0\t0\t0\tflplbt\tinvlbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t65\t100\t120\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Scarabshell Boots\t100\t0\t1\t1\t56\t65\t0\t91\t0\t0\t14\t0\t66\t0\t49\t32271\t305620\tuvb\tuvb\t\t\tvbt\tvbt\txvb\tuvb\t16\t2\t2\t0\t0\t0\tflpvbt\tinvvbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t60\t110\t120\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Boneweave Boots\t100\t0\t2\t1\t59\t67\t0\t118\t0\t0\t16\t0\t72\t0\t54\t36456\t352010\tumb\tumb\t\t\tmbt\tmbt\txmb\tumb\t16\t2\t2\t0\t0\t0\tflpmbt\tinvmbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootschain\t12\titem_bootschain\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t69\t118\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mirrored Boots\t100\t0\t3\t1\t59\t68\t0\t163\t0\t0\t18\t0\t81\t0\t60\t41658\t420465\tutb\tutb\t\t\tmbt\ttbt\txtb\tutb\t16\t2\t2\t0\t0\t0\tflptbt\tinvtbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t50\t145\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Myrmidon Greaves\t100\t0\t4\t1\t62\t71\t0\t208\t0\t0\t24\t0\t85\t0\t65\t45459\t497859\tuhb\tuhb\t\t\thbt\thbt\txhb\tuhb\t16\t2\t2\t0\t0\t0\tflphbt\tinvhbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t83\t149\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Spiderweb Sash\t100\t0\t1\t1\t55\t62\t0\t50\t0\t0\t12\t0\t61\t0\t46\t28842\t270466\tulc\tulc\t\t\tlbl\tlbl\tzlb\tulc\t16\t2\t1\t0\t0\t0\tflplbl\tinvlbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Vampirefang Belt\t100\t0\t1\t1\t56\t63\t0\t50\t0\t0\t14\t0\t68\t0\t51\t32656\t300879\tuvc\tuvc\t\t\tvbl\tvbl\tzvb\tuvc\t16\t2\t1\t0\t0\t0\tflpvbl\tinvvbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mithril Coil\t100\t0\t2\t1\t58\t65\t0\t106\t0\t0\t16\t0\t75\t0\t56\t37134\t345000\tumc\tumc\t\t\tmbl\tmbl\tzmb\tumc\t16\t2\t1\t0\t0\t0\tflpmbl\tinvmbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Troll Belt\t100\t0\t2\t1\t59\t66\t0\t151\t0\t0\t18\t0\t82\t0\t62\t41183\t411380\tutc\tutc\t\t\tmbl\ttbl\tztb\tutc\t16\t2\t1\t0\t0\t0\tflptbl\tinvtbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Colossus Girdle\t100\t0\t3\t1\t61\t71\t0\t185\t0\t0\t24\t0\t85\t0\t67\t45051\t493775\tuhc\tuhc\t\t\thbl\thbl\tzhb\tuhc\t16\t2\t1\t0\t0\t0\tflphbl\tinvhbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bone Visage\t100\t0\t2\t1\t100\t157\t0\t106\t0\t0\t40\t0\t84\t0\t63\t87274\t598161\tuh9\tuh9\t\t\tbhm\tbhm\txh9\tuh9\t0\t2\t2\t1\t3\t1\tflpbhm\tinvbhm\tinvbhmu\tinvbhmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t2\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Troll Nest\t100\t0\t2\t1\t158\t173\t0\t106\t0\t20\t74\t0\t76\t0\t57\t101842\t586580\tush\tush\t\t\tbsh\tbsh\txsh\tush\t7\t2\t3\t1\t3\t2\tflpbsh\tinvbsh\tinvbshu\tinvbshu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t24\t38\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Blade Barrier\t100\t0\t3\t1\t147\t163\t0\t118\t0\t20\t83\t0\t68\t0\t51\t85443\t413914\tupk\tupk\t\t\tspk\tspk\txpk\tupk\t7\t2\t3\t1\t3\t2\tflpspk\tinvspk\tinvspku\tinvspku\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t26\t40\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Alpha Helm\t100\t0\t1\t1\t52\t62\t0\t44\t0\t0\t20\t0\t35\t0\t26\t16300\t82061\tdr6\tdr6\t\t\tdr1\tdr1\tdr6\tdrb\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Griffon Headress\t100\t0\t1\t1\t46\t68\t0\t50\t0\t0\t20\t0\t40\t0\t30\t18564\t82062\tdr7\tdr7\t\t\tdr4\tdr2\tdr7\tdrc\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hunter's Guise\t100\t0\t1\t1\t67\t81\t0\t56\t0\t0\t20\t0\t46\t0\t29\t27768\t82063\tdr8\tdr8\t\t\tdr3\tdr3\tdr8\tdrd\t0\t2\t2\t1\t3\t1\tflpdr3\tinvdr3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sacred Feathers\t100\t0\t1\t1\t58\t87\t0\t62\t0\t0\t20\t0\t50\t0\t32\t29518\t82064\tdr9\tdr9\t\t\tdr4\tdr4\tdr9\tdre\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Totemic Mask\t100\t0\t1\t1\t73\t98\t0\t65\t0\t0\t20\t0\t55\t0\t41\t38127\t82065\tdra\tdra\t\t\tdr1\tdr5\tdra\tdrf\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Jawbone Visor\t100\t0\t2\t1\t55\t68\t0\t58\t0\t0\t25\t0\t33\t0\t25\t16603\t82061\tba6\tba6\t\t\tba1\tba1\tba6\tbab\t0\t2\t2\t1\t3\t1\tflpba1\tinvba1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Lion Helm\t100\t0\t2\t1\t63\t75\t0\t73\t0\t0\t35\t0\t38\t0\t29\t21378\t82062\tba7\tba7\t\t\tba1\tba2\tba7\tbac\t0\t2\t2\t1\t3\t1\tflpba1\tinvba2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Rage Mask\t100\t0\t2\t1\t78\t90\t0\t88\t0\t0\t45\t0\t44\t0\t29\t30063\t82063\tba8\tba8\t\t\tba3\tba3\tba8\tbad\t0\t2\t2\t1\t3\t1\tflpba3\tinvba3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Savage Helmet\t100\t0\t2\t1\t85\t98\t0\t103\t0\t0\t50\t0\t49\t0\t32\t36398\t82064\tba9\tba9\t\t\tba5\tba4\tba9\tbae\t0\t2\t2\t1\t3\t1\tflpba5\tinvba4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Slayer Guard\t100\t0\t2\t1\t93\t120\t0\t118\t0\t0\t55\t0\t54\t0\t40\t46633\t82065\tbaa\tbaa\t\t\tba5\tba5\tbaa\tbaf\t0\t2\t2\t1\t3\t1\tflpba5\tinvba5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Akaran Targe\t100\t0\t2\t1\t101\t125\t0\t44\t0\t10\t20\t0\t35\t0\t26\t32500\t82065\tpa6\tpa6\t\t304\tpa1\tpa1\tpa6\tpab\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t1\t0\t\t\t0\t1\t0\t12\t16\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Akaran Rondache\t100\t0\t2\t1\t113\t137\t0\t59\t0\t15\t30\t0\t40\t0\t30\t40941\t82066\tpa7\tpa7\t\t304\tpa1\tpa2\tpa7\tpac\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t2\t0\t\t\t0\t1\t0\t15\t20\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Protector Shield\t100\t0\t2\t1\t129\t153\t0\t69\t0\t20\t40\t0\t46\t0\t34\t52947\t82067\tpa8\tpa8\t\t304\tpa3\tpa3\tpa8\tpad\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t3\t0\t\t\t0\t1\t0\t18\t24\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Gilded Shield\t100\t0\t2\t1\t144\t168\t0\t89\t0\t22\t50\t0\t51\t0\t38\t64807\t82068\tpa9\tpa9\t\t304\tpa3\tpa4\tpa9\tpae\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t4\t0\t\t\t0\t1\t0\t20\t28\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Royal Shield\t100\t0\t2\t1\t156\t181\t0\t114\t0\t25\t60\t0\t55\t0\t41\t75374\t82069\tpaa\tpaa\t\t304\tpa5\tpa5\tpaa\tpaf\t7\t2\t2\t1\t4\t2\tflppa5\tinvpa5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t5\t0\t\t\t0\t1\t0\t24\t32\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mummified Trophy\t100\t0\t1\t1\t38\t48\t0\t38\t0\t3\t20\t0\t33\t0\t24\t11590\t82069\tne6\tne6\t\t305\tne1\tne1\tne6\tneb\t10\t2\t2\t1\t2\t2\tflpne1\tinvne1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Fetish Trophy\t100\t0\t1\t1\t41\t52\t0\t41\t0\t5\t20\t0\t39\t0\t29\t14839\t82070\tne7\tne7\t\t305\tne2\tne2\tne7\tneg\t10\t2\t2\t1\t2\t2\tflpne2\tinvne2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sexton Trophy\t100\t0\t1\t1\t44\t55\t0\t47\t0\t8\t20\t0\t45\t0\t33\t18169\t82071\tne8\tne8\t\t305\tne3\tne3\tne8\tned\t10\t2\t2\t1\t2\t2\tflpne3\tinvne3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cantor Trophy\t100\t0\t1\t1\t50\t64\t0\t50\t0\t10\t20\t0\t49\t0\t36\t22750\t82072\tne9\tne9\t\t305\tne3\tne4\tne9\tnee\t10\t2\t2\t1\t2\t2\tflpne3\tinvne4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Heirophant Trophy\t100\t0\t1\t1\t58\t70\t0\t58\t0\t12\t20\t0\t54\t0\t40\t27993\t82073\tnea\tnea\t\t305\tne2\tne5\tnea\tnef\t10\t2\t2\t1\t2\t2\tflpne2\tinvne5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Blood Spirit\t100\t0\t1\t1\t101\t145\t0\t86\t0\t0\t20\t0\t62\t0\t46\t61755\t413914\tdrb\tdrb\t\t\tdr1\tdr1\tdr6\tdrb\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sun Spirit\t100\t0\t1\t1\t98\t147\t0\t95\t0\t0\t20\t0\t69\t0\t51\t68617\t413915\tdrc\tdrc\t\t\tdr4\tdr2\tdr7\tdrc\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Earth Spirit\t100\t0\t1\t1\t107\t152\t0\t104\t0\t0\t20\t0\t76\t0\t57\t79730\t413916\tdrd\tdrd\t\t\tdr3\tdr3\tdr8\tdrd\t0\t2\t2\t1\t3\t1\tflpdr3\tinvdr3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sky Spirit\t100\t0\t1\t1\t103\t155\t0\t113\t0\t0\t20\t0\t83\t0\t62\t86575\t413917\tdre\tdre\t\t\tdr4\tdr4\tdr9\tdre\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Dream Spirit\t100\t0\t1\t1\t109\t159\t0\t118\t0\t0\t20\t0\t85\t0\t66\t92143\t413918\tdrf\tdrf\t\t\tdr1\tdr5\tdra\tdrf\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Carnage Helm\t100\t0\t2\t1\t102\t147\t0\t106\t0\t0\t25\t0\t60\t0\t45\t60650\t413918\tbab\tbab\t\t\tba1\tba1\tba6\tbab\t0\t2\t2\t1\t3\t1\tflpba1\tinvba1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Fury Visor\t100\t0\t2\t1\t105\t150\t0\t129\t0\t0\t35\t0\t66\t0\t49\t68211\t413919\tbac\tbac\t\t\tba1\tba2\tba7\tbac\t0\t2\t2\t1\t3\t1\tflpba1\tinvba2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Destroyer Helm\t100\t0\t2\t1\t111\t156\t0\t151\t0\t0\t45\t0\t73\t0\t54\t78881\t413920\tbad\tbad\t\t\tba3\tba3\tba8\tbad\t0\t2\t2\t1\t3\t1\tflpba3\tinvba3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Conqueror Crown\t100\t0\t2\t1\t114\t159\t0\t174\t0\t0\t50\t0\t80\t0\t60\t88278\t413921\tbae\tbae\t\t\tba5\tba4\tba9\tbae\t0\t2\t2\t1\t3\t1\tflpba5\tinvba4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Guardian Crown\t100\t0\t2\t1\t117\t168\t0\t196\t0\t0\t55\t0\t85\t0\t65\t97844\t413922\tbaf\tbaf\t\t\tba5\tba5\tbaa\tbaf\t0\t2\t2\t1\t3\t1\tflpba5\tinvba5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sacred Targe\t100\t0\t2\t1\t126\t158\t0\t86\t0\t30\t45\t0\t63\t0\t47\t72618\t82065\tpab\tpab\t\t304\tpa1\tpa1\tpa6\tpab\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t1\t0\t\t\t0\t1\t0\t22\t70\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sacred Rondache\t100\t0\t2\t1\t138\t164\t0\t109\t0\t28\t68\t0\t70\t0\t52\t85659\t82066\tpac\tpac\t\t304\tpa1\tpa2\tpa7\tpac\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t2\t0\t\t\t0\t1\t0\t35\t58\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ancient Shield\t100\t0\t2\t1\t154\t172\t0\t124\t0\t25\t55\t0\t74\t0\t55\t97676\t82067\tpad\tpad\t\t304\tpa3\tpa3\tpa8\tpad\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t3\t0\t\t\t0\t1\t0\t10\t82\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Zakarum Shield\t100\t0\t2\t1\t169\t193\t0\t142\t0\t22\t65\t0\t82\t0\t61\t120042\t82068\tpae\tpae\t\t304\tpa3\tpa4\tpa9\tpae\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t4\t0\t\t\t0\t1\t0\t46\t46\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Vortex Shield\t100\t0\t2\t1\t182\t225\t0\t148\t0\t19\t90\t0\t85\t0\t66\t139860\t82069\tpaf\tpaf\t\t304\tpa5\tpa5\tpaa\tpaf\t7\t2\t2\t1\t4\t2\tflppa5\tinvpa5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t5\t0\t\t\t0\t1\t0\t5\t87\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Minion Skull\t100\t0\t1\t1\t95\t139\t0\t77\t0\t3\t20\t0\t59\t0\t44\t56131\t82069\tneb\tneb\t\t305\tne1\tne1\tne6\tneb\t10\t2\t2\t1\t2\t2\tflpne1\tinvne1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hellspawn Skull\t100\t0\t1\t1\t96\t141\t0\t82\t0\t5\t20\t0\t67\t0\t50\t64437\t82070\tneg\tneg\t\t305\tne2\tne2\tne7\tneg\t10\t2\t2\t1\t2\t2\tflpne2\tinvne2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Overseer Skull\t100\t0\t1\t1\t98\t142\t0\t91\t0\t8\t20\t0\t66\t0\t49\t64122\t82071\tned\tned\t\t305\tne3\tne3\tne8\tned\t10\t2\t2\t1\t2\t2\tflpne3\tinvne3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Succubus Skull\t100\t0\t1\t1\t100\t146\t0\t95\t0\t10\t20\t0\t81\t0\t60\t80462\t82072\tnee\tnee\t\t305\tne3\tne4\tne9\tnee\t10\t2\t2\t1\t2\t2\tflpne3\tinvne4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bloodlord Skull\t100\t0\t1\t1\t103\t148\t0\t106\t0\t12\t20\t0\t85\t0\t65\t86238\t82073\tnef\tnef\t\t305\tne2\tne5\tnea\tnef\t10\t2\t2\t1\t2\t2\tflpne2\tinvne5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"name\tversion\tcompactsave\trarity\tspawnable\tminac\tmaxac\tspeed\treqstr\treqdex\tblock\tdurability\tnodurability\tlevel\tShowLevel\tlevelreq\tcost\tgamble cost\tcode\tnamestr\tmagic lvl\tauto prefix\talternategfx\tnormcode\tubercode\tultracode\tcomponent\tinvwidth\tinvheight\thasinv\tgemsockets\tgemapplytype\tflippyfile\tinvfile\tuniqueinvfile\tsetinvfile\trArm\tlArm\tTorso\tLegs\trSPad\tlSPad\tuseable\tstackable\tminstack\tmaxstack\tspawnstack\tTransmogrify\tTMogType\tTMogMin\tTMogMax\ttype\ttype2\tdropsound\tdropsfxframe\tusesound\tunique\ttransparent\ttranstbl\t*quivered\tlightradius\tbelt\tquest\tquestdiffcheck\tmissiletype\tdurwarning\tqntwarning\tmindam\tmaxdam\tStrBonus\tDexBonus\tgemoffset\tbitfield1\tCharsiMin\tCharsiMax\tCharsiMagicMin\tCharsiMagicMax\tCharsiMagicLvl\tGheedMin\tGheedMax\tGheedMagicMin\tGheedMagicMax\tGheedMagicLvl\tAkaraMin\tAkaraMax\tAkaraMagicMin\tAkaraMagicMax\tAkaraMagicLvl\tFaraMin\tFaraMax\tFaraMagicMin\tFaraMagicMax\tFaraMagicLvl\tLysanderMin\tLysanderMax\tLysanderMagicMin\tLysanderMagicMax\tLysanderMagicLvl\tDrognanMin\tDrognanMax\tDrognanMagicMin\tDrognanMagicMax\tDrognanMagicLvl\tHratliMin\tHratliMax\tHratliMagicMin\tHratliMagicMax\tHratliMagicLvl\tAlkorMin\tAlkorMax\tAlkorMagicMin\tAlkorMagicMax\tAlkorMagicLvl\tOrmusMin\tOrmusMax\tOrmusMagicMin\tOrmusMagicMax\tOrmusMagicLvl\tElzixMin\tElzixMax\tElzixMagicMin\tElzixMagicMax\tElzixMagicLvl\tAshearaMin\tAshearaMax\tAshearaMagicMin\tAshearaMagicMax\tAshearaMagicLvl\tCainMin\tCainMax\tCainMagicMin\tCainMagicMax\tCainMagicLvl\tHalbuMin\tHalbuMax\tHalbuMagicMin\tHalbuMagicMax\tHalbuMagicLvl\tJamellaMin\tJamellaMax\tJamellaMagicMin\tJamellaMagicMax\tJamellaMagicLvl\tLarzukMin\tLarzukMax\tLarzukMagicMin\tLarzukMagicMax\tLarzukMagicLvl\tMalahMin\tMalahMax\tMalahMagicMin\tMalahMagicMax\tMalahMagicLvl\tAnyaMin\tAnyaMax\tAnyaMagicMin\tAnyaMagicMax\tAnyaMagicLvl\tTransform\tInvTrans\tSkipName\tNightmareUpgrade\tHellUpgrade\tNameable\tPermStoreItem\tdiablocloneweight\n",
+                u8"Cap\t0\t0\t1\t1\t3\t5\t0\t0\t0\t0\t12\t0\t1\t0\t0\t64\t3016\tcap\tcap\t\t\tcap\tcap\txap\tuap\t0\t2\t2\t1\t2\t1\tflpcap\tinvcap\tinvcapu\tinvcapu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_cap\t12\titem_cap\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t5\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\tskp\tghm\t1\t0\t\n",
+                u8"Skull Cap\t0\t0\t4\t1\t8\t11\t0\t15\t0\t0\t18\t0\t5\t0\t0\t441\t5551\tskp\tskp\t\t\tskp\tskp\txkp\tukp\t0\t2\t2\t1\t2\t1\tflpskp\tinvskp\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t1\t1\t1\t1\t10\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\thlm\tcrn\t1\t0\t\n",
+                u8"Helm\t0\t0\t4\t1\t15\t18\t0\t26\t0\t0\t24\t0\t11\t0\t0\t1558\t12284\thlm\thlm\t\t\thlm\thlm\txlm\tulm\t0\t2\t2\t1\t2\t1\tflphlm\tinvhlm\tinvhlmu\tinvhlmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\tfhl\tghm\t1\t0\t\n",
+                u8"Full Helm\t0\t0\t4\t1\t23\t26\t0\t41\t0\t0\t30\t0\t15\t0\t0\t3095\t21606\tfhl\tfhl\t\t\tfhl\tfhl\txhl\tuhl\t0\t2\t2\t1\t2\t1\tflpfhl\tinvfhl\tinvfhlu\tinvfhlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tghm\txxx\t1\t0\t\n",
+                u8"Great Helm\t0\t0\t4\t1\t30\t35\t0\t63\t0\t0\t40\t0\t23\t0\t0\t6177\t49517\tghm\tghm\t\t\tghm\tghm\txhm\tuhm\t0\t2\t2\t1\t3\t1\tflpghm\tinvghm\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t1\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tcrn\txxx\t1\t0\t\n",
+                u8"Crown\t0\t0\t4\t1\t25\t45\t0\t55\t0\t0\t50\t0\t29\t0\t0\t8345\t77501\tcrn\tcrn\t\t\tcrn\tcrn\txrn\turn\t0\t2\t2\t1\t3\t1\tflpcrn\tinvcrn\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t1\t1\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mask\t0\t0\t4\t1\t9\t27\t0\t23\t0\t0\t20\t0\t19\t0\t0\t2857\t25570\tmsk\tmsk\t\t\tmsk\tmsk\txsk\tusk\t0\t2\t2\t1\t3\t1\tflpmsk\tinvmsk\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Quilted Armor\t0\t0\t1\t1\t8\t11\t0\t12\t0\t0\t20\t0\t1\t0\t0\t140\t3035\tqui\tqui\t\t\tqlt\tqui\txui\tuui\t1\t2\t3\t1\t2\t1\tflpqlt\tinvqlt\t\t\t0\t0\t0\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t5\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tlea\tgth\t1\t0\t\n",
+                u8"Leather Armor\t0\t0\t2\t1\t14\t17\t0\t15\t0\t0\t24\t0\t3\t0\t0\t481\t4360\tlea\tlea\t\t\tlea\tlea\txea\tuea\t1\t2\t3\t1\t2\t1\tflplea\tinvlea\t\t\t0\t0\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t10\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\thla\tful\t1\t0\t\n",
+                u8"Hard Leather Armor\t0\t0\t3\t1\t21\t24\t0\t20\t0\t0\t28\t0\t5\t0\t0\t1060\t6325\thla\thla\t\t\thla\thla\txla\tula\t1\t2\t3\t1\t2\t1\tflphla\tinvhla\t\t\t1\t1\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t15\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tstu\taar\t1\t0\t\n",
+                u8"Studded Leather \t0\t0\t4\t1\t32\t35\t0\t27\t0\t0\t32\t0\t8\t0\t0\t2385\t11270\tstu\tstu\t\t\tstu\tstu\txtu\tutu\t1\t2\t3\t1\t2\t1\tflpstu\tinvstu\t\t\t1\t0\t0\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t20\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\trng\tltp\t1\t0\t\n",
+                u8"Ring Mail\t0\t0\t4\t1\t45\t48\t5\t36\t0\t0\t26\t0\t11\t0\t0\t4428\t20177\trng\trng\t\t\trng\trng\txng\tung\t1\t2\t3\t1\t3\t1\tflprng\tinvrng\t\t\t0\t0\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t1\t\t1\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tscl\tchn\t1\t0\t\n",
+                u8"Scale Mail\t0\t0\t4\t1\t57\t60\t10\t44\t0\t0\t36\t0\t13\t0\t0\t6508\t30151\tscl\tscl\t\t\tscl\tscl\txcl\tucl\t1\t2\t3\t1\t2\t1\tflpscl\tinvscl\t\t\t1\t1\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tchn\tbrs\t1\t0\t\n",
+                u8"Chain Mail\t0\t0\t4\t1\t72\t75\t5\t48\t0\t0\t45\t0\t15\t0\t0\t9360\t45100\tchn\tchn\t\t\tchn\tchn\txhn\tuhn\t1\t2\t3\t1\t2\t1\tflpchn\tinvchn\t\t\t1\t1\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tbrs\tspl\t1\t0\t\n",
+                u8"Breast Plate\t0\t0\t4\t1\t65\t68\t0\t30\t0\t0\t50\t0\t18\t0\t0\t10078\t56851\tbrs\tbrs\t\t\tbrs\tbrs\txrs\turs\t1\t2\t3\t1\t3\t1\tflpbrs\tinvbrs\t\t\t0\t0\t2\t0\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tspl\tplt\t1\t0\t\n",
+                u8"Splint Mail\t0\t0\t4\t1\t90\t95\t5\t51\t0\t0\t30\t0\t20\t0\t0\t15489\t89945\tspl\tspl\t\t\tspl\tspl\txpl\tupl\t1\t2\t3\t1\t2\t1\tflpspl\tinvspl\t\t\t1\t1\t2\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\tplt\tfld\t1\t0\t\n",
+                u8"Plate Mail\t0\t0\t4\t1\t108\t116\t10\t65\t0\t0\t60\t0\t24\t0\t0\t22335\t148510\tplt\tplt\t\t\tplt\tplt\txlt\tult\t1\t2\t3\t1\t2\t1\tflpplt\tinvplt\t\t\t2\t2\t2\t2\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t1\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\tfld\txxx\t1\t0\t\n",
+                u8"Field Plate\t0\t0\t4\t1\t101\t105\t5\t55\t0\t0\t48\t0\t28\t0\t0\t23841\t183387\tfld\tfld\t\t\tfld\tfld\txld\tuld\t1\t2\t3\t1\t2\t1\tflpfld\tinvfld\t\t\t1\t1\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t1\t\t\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\tgth\tful\t1\t0\t\n",
+                u8"Gothic Plate\t0\t0\t4\t1\t128\t135\t5\t70\t0\t0\t55\t0\t32\t0\t0\t34646\t295668\tgth\tgth\t\t\tgth\tgth\txth\tuth\t1\t2\t3\t1\t4\t1\tflpgth\tinvgth\t\t\t2\t2\t1\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t1\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\tful\txxx\t1\t0\t\n",
+                u8"Full Plate Mail\t0\t0\t4\t1\t150\t161\t10\t80\t0\t0\t70\t0\t37\t0\t0\t47192\t457526\tful\tful\t\t\tful\tful\txul\tuul\t1\t2\t3\t1\t4\t1\tflpful\tinvful\tinvfulu\tinvfulu\t2\t2\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t1\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\taar\txxx\t1\t0\t\n",
+                u8"Ancient Armor\t0\t0\t4\t1\t218\t233\t5\t100\t0\t0\t60\t0\t40\t0\t0\t73864\t761140\taar\taar\t\t\taar\taar\txar\tuar\t1\t2\t3\t1\t4\t1\tflpaar\tinvaar\tinvaaru\tinvaaru\t1\t2\t2\t2\t2\t0\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t1\t1\t2\t20\t8\t8\t0\tltp\txxx\t1\t0\t\n",
+                u8"Light Plate\t0\t0\t4\t1\t90\t107\t0\t41\t0\t0\t60\t0\t35\t0\t0\t28327\t267861\tltp\tltp\t\t\tltp\tltp\txtp\tutp\t1\t2\t3\t1\t3\t1\tflpltp\tinvltp\t\t\t2\t0\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t1\t\t\t255\t\t\t1\t2\t20\t\t\t\t\t255\t\t1\t1\t1\t20\t7\t8\t0\tbuc\txxx\t1\t0\t\n",
+                u8"Buckler\t0\t0\t2\t1\t4\t6\t0\t12\t0\t0\t12\t0\t1\t0\t0\t68\t3017\tbuc\tbuc\t\t\tbuc\tbuc\txuc\tuuc\t7\t2\t2\t1\t1\t2\tflpbuc\tinvbuc\tinvbucu\tinvbucu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t1\t3\t100\t\t0\t3\t1\t1\t1\t1\t3\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\tsml\ttow\t1\t0\t\n",
+                u8"Small Shield\t0\t0\t3\t1\t8\t10\t0\t22\t0\t5\t16\t0\t5\t0\t0\t410\t5512\tsml\tsml\t\t\tbuc\tsml\txml\tuml\t7\t2\t2\t1\t2\t2\tflpsml\tinvsml\tinvsmlu\tinvsmlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t2\t3\t100\t\t0\t3\t1\t1\t1\t1\t5\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t1\t1\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t5\t0\tlrg\tkit\t1\t0\t\n",
+                u8"Large Shield\t0\t0\t4\t1\t12\t14\t5\t34\t0\t12\t24\t0\t11\t0\t0\t1214\t11338\tlrg\tlrg\t\t\tlrg\tlrg\txrg\turg\t7\t2\t3\t1\t3\t2\tflplrg\tinvlrg\tinvlrgu\tinvlrgu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t2\t4\t100\t\t0\t3\t\t1\t\t1\t10\t\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\tkit\ttow\t1\t0\t\n",
+                u8"Kite Shield\t0\t0\t4\t1\t16\t18\t0\t47\t0\t8\t30\t0\t15\t0\t0\t2129\t17983\tkit\tkit\t\t\tkit\tkit\txit\tuit\t7\t2\t3\t1\t3\t2\tflpkit\tinvkit\tinvkitu\tinvkitu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t2\t5\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\ttow\tgts\t1\t0\t\n",
+                u8"Tower Shield\t0\t0\t4\t1\t22\t25\t10\t75\t0\t24\t60\t0\t22\t0\t0\t4249\t36869\ttow\ttow\t\t\ttow\ttow\txow\tuow\t7\t2\t3\t1\t3\t2\tflptow\tinvtow\tinvtowu\tinvtowu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t1\t5\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t1\t1\t\t\t1\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t20\t8\t2\t0\tgts\txxx\t1\t0\t\n",
+                u8"Gothic Shield\t0\t0\t4\t1\t30\t35\t5\t60\t0\t16\t40\t0\t30\t0\t0\t8000\t77500\tgts\tgts\t\t\tkit\tgts\txts\tuts\t7\t2\t4\t1\t3\t2\tflpgts\tinvgts\tinvgtsu\tinvgtsu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t2\t6\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t1\t\t\t1\t2\t20\t\t\t\t\t255\t\t\t1\t1\t20\t8\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Leather Gloves\t0\t0\t1\t1\t2\t3\t0\t0\t0\t0\t12\t0\t3\t0\t0\t80\t4060\tlgl\tlgl\t\t\tlgl\tlgl\txlg\tulg\t16\t2\t2\t0\t0\t0\tflplgl\tinvlgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t3\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tvgl\thgl\t1\t0\t\n",
+                u8"Heavy Gloves\t0\t0\t1\t1\t5\t6\t0\t0\t0\t0\t14\t0\t7\t0\t0\t352\t6616\tvgl\tvgl\t\t\tvgl\tvgl\txvg\tuvg\t16\t2\t2\t0\t0\t0\tflpvgl\tinvvgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t1\t\t1\t5\t\t1\t\t1\t1\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tmgl\ttgl\t1\t0\t\n",
+                u8"Chain Gloves\t0\t0\t2\t1\t8\t9\t0\t25\t0\t0\t16\t0\t12\t0\t0\t859\t11077\tmgl\tmgl\t\t\tmgl\tmgl\txmg\tumg\t16\t2\t2\t0\t0\t0\tflpmgl\tinvmgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloveschain\t12\titem_gloveschain\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t1\t\t\t10\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\ttgl\thgl\t1\t0\t\n",
+                u8"Light Gauntlets\t0\t0\t3\t1\t9\t11\t0\t45\t0\t0\t18\t0\t20\t0\t0\t1635\t20675\ttgl\ttgl\t\t\tmgl\ttgl\txtg\tutg\t16\t2\t2\t0\t0\t0\tflptgl\tinvtgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t1\t2\t1\t1\t1\t\t\t1\t1\t255\t1\t1\t\t1\t255\t\t\t1\t1\t20\t\t\t\t\t255\t1\t1\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Gauntlets\t0\t0\t4\t1\t12\t15\t0\t60\t0\t0\t24\t0\t27\t0\t0\t2964\t36007\thgl\thgl\t\t\thgl\thgl\txhg\tuhg\t16\t2\t2\t0\t0\t0\tflphgl\tinvhgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t1\t1\t\t1\t255\t1\t1\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Boots\t0\t0\t1\t1\t2\t3\t0\t0\t0\t0\t12\t0\t3\t0\t0\t80\t4060\tlbt\tlbt\t\t\tlbt\tlbt\txlb\tulb\t16\t2\t2\t0\t0\t0\tflplbt\tinvlbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t3\t8\t120\t\t0\t1\t1\t1\t1\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tvbt\ttbt\t1\t0\t\n",
+                u8"Heavy Boots\t0\t0\t1\t1\t5\t6\t0\t18\t0\t0\t14\t0\t7\t0\t0\t334\t6584\tvbt\tvbt\t\t\tvbt\tvbt\txvb\tuvb\t16\t2\t2\t0\t0\t0\tflpvbt\tinvvbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t4\t10\t120\t\t0\t1\t\t1\t\t1\t1\t\t1\t\t1\t1\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tmbt\ttbt\t1\t0\t\n",
+                u8"Chain Boots\t0\t0\t2\t1\t8\t9\t0\t30\t0\t0\t16\t0\t12\t0\t0\t854\t11062\tmbt\tmbt\t\t\tmbt\tmbt\txmb\tumb\t16\t2\t2\t0\t0\t0\tflpmbt\tinvmbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootschain\t12\titem_bootschain\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t6\t12\t120\t\t0\t3\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\ttbt\thbt\t1\t0\t\n",
+                u8"Light Plated Boots\t0\t0\t3\t1\t9\t11\t0\t50\t0\t0\t18\t0\t20\t0\t0\t1630\t20650\ttbt\ttbt\t\t\tmbt\ttbt\txtb\tutb\t16\t2\t2\t0\t0\t0\tflptbt\tinvtbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t8\t16\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t1\t2\t1\t1\t1\t\t\t1\t1\t20\t1\t1\t\t1\t255\t\t\t1\t1\t20\t\t\t\t\t255\t1\t1\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Greaves\t0\t0\t4\t1\t12\t15\t0\t70\t0\t0\t24\t0\t27\t0\t0\t2954\t35939\thbt\thbt\t\t\thbt\thbt\txhb\tuhb\t16\t2\t2\t0\t0\t0\tflphbt\tinvhbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t10\t20\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t1\t1\t1\t1\t20\t1\t1\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sash\t0\t0\t1\t1\t2\t2\t0\t0\t0\t0\t12\t0\t3\t0\t0\t64\t4048\tlbl\tlbl\t\t\tlbl\tlbl\tzlb\tulc\t16\t2\t1\t0\t0\t0\tflplbl\tinvlbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t1\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t1\t1\t1\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tvbl\ttbl\t1\t0\t\n",
+                u8"Light Belt\t0\t0\t1\t1\t3\t3\t0\t0\t0\t0\t14\t0\t7\t0\t0\t192\t6336\tvbl\tvbl\t\t\tvbl\tvbl\tzvb\tuvc\t16\t2\t1\t0\t0\t0\tflpvbl\tinvvbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t4\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t1\t\t1\t1\t\t1\t\t1\t1\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\tmbl\thbl\t1\t0\t\n",
+                u8"Belt\t0\t0\t2\t1\t5\t5\t0\t25\t0\t0\t16\t0\t12\t0\t0\t495\t9985\tmbl\tmbl\t\t\tmbl\tmbl\tzmb\tumc\t16\t2\t1\t0\t0\t0\tflpmbl\tinvmbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t0\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t1\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\ttbl\thbl\t1\t0\t\n",
+                u8"Heavy Belt\t0\t0\t2\t1\t6\t6\t0\t45\t0\t0\t18\t0\t20\t0\t0\t963\t17315\ttbl\ttbl\t\t\tmbl\ttbl\tztb\tutc\t16\t2\t1\t0\t0\t0\tflptbl\tinvtbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t5\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t1\t2\t1\t1\t1\t\t\t1\t1\t20\t1\t1\t\t1\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Plated Belt\t0\t0\t3\t1\t8\t11\t0\t60\t0\t0\t24\t0\t27\t0\t0\t2068\t29959\thbl\thbl\t\t\thbl\thbl\tzhb\tuhc\t16\t2\t1\t0\t0\t0\tflphbl\tinvhbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t3\t\t\t0\t4\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t1\t1\t1\t1\t20\t1\t1\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t1\t1\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bone Helm\t0\t0\t2\t1\t33\t36\t0\t25\t0\t0\t40\t0\t22\t0\t0\t6323\t48276\tbhm\tbhm\t\t\tbhm\tbhm\txh9\tuh9\t0\t2\t2\t1\t2\t1\tflpbhm\tinvbhm\tinvbhmu\tinvbhmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t2\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t7\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bone Shield\t0\t0\t2\t1\t10\t30\t0\t25\t0\t20\t40\t0\t19\t0\t0\t3175\t27081\tbsh\tbsh\t\t\tbsh\tbsh\txsh\tush\t7\t2\t3\t1\t2\t2\tflpbsh\tinvbsh\tinvbshu\tinvbshu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t3\t6\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Spiked Shield\t0\t0\t3\t1\t15\t25\t0\t30\t0\t10\t40\t0\t11\t0\t0\t1890\t13197\tspk\tspk\t\t\tspk\tspk\txpk\tupk\t7\t2\t3\t1\t2\t2\tflpspk\tinvspk\tinvspku\tinvspku\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t5\t9\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Hat\t0\t0\t1\t1\t45\t53\t0\t20\t0\t0\t12\t0\t34\t0\t22\t13560\t82061\txap\txap\t\t\tcap\tcap\txap\tuap\t0\t2\t2\t1\t2\t1\tflpcap\tinvcap\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_cap\t12\titem_cap\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sallet\t0\t0\t4\t1\t52\t62\t0\t43\t0\t0\t18\t0\t37\t0\t25\t17210\t113647\txkp\txkp\t\t\tskp\tskp\txkp\tukp\t0\t2\t2\t1\t2\t1\tflpskp\tinvskp\tinvxkpu\tinvxkpu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Casque\t0\t0\t4\t1\t63\t72\t0\t59\t0\t0\t24\t0\t42\t0\t25\t23075\t171804\txlm\txlm\t\t\thlm\thlm\txlm\tulm\t0\t2\t2\t1\t2\t1\tflphlm\tinvhlm\tinvhlmu\tinvhlmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Basinet\t0\t0\t4\t1\t75\t84\t0\t82\t0\t0\t30\t0\t45\t0\t25\t29083\t233910\txhl\txhl\t\t\tfhl\tfhl\txhl\tuhl\t0\t2\t2\t1\t2\t1\tflpfhl\tinvfhl\tinvfhlu\tinvfhlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Winged Helm\t0\t0\t4\t1\t85\t98\t0\t115\t0\t0\t40\t0\t51\t0\t25\t37846\t355900\txhm\txhm\t\t\tghm\tghm\txhm\tuhm\t0\t2\t2\t1\t3\t1\tflpghm\tinvghm\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Grand Crown\t0\t0\t4\t1\t78\t113\t0\t103\t0\t0\t50\t0\t55\t0\t25\t42458\t448816\txrn\txrn\t\t\tcrn\tcrn\txrn\turn\t0\t2\t2\t1\t3\t1\tflpcrn\tinvcrn\tinvxrnu\tinvxrnu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Death Mask\t0\t0\t4\t1\t54\t86\t0\t55\t0\t0\t20\t0\t48\t0\t25\t27190\t241184\txsk\txsk\t\t\tmsk\tmsk\txsk\tusk\t0\t2\t2\t1\t3\t1\tflpmsk\tinvmsk\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ghost Armor\t0\t0\t1\t1\t102\t117\t0\t38\t0\t0\t20\t0\t34\t0\t22\t30552\t165635\txui\txui\t\t\tqlt\tqui\txui\tuui\t1\t2\t3\t1\t2\t1\tflpqlt\tinvqlt\t\t\t0\t0\t0\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Serpentskin Armor\t0\t0\t2\t1\t111\t126\t0\t43\t0\t0\t24\t0\t36\t0\t24\t34960\t197896\txea\txea\t\t\tlea\tlea\txea\tuea\t1\t2\t3\t1\t2\t1\tflplea\tinvlea\t\t\t0\t0\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Demonhide Armor\t0\t0\t3\t1\t122\t136\t0\t50\t0\t0\t28\t0\t37\t0\t25\t39090\t236758\txla\txla\t\t\thla\thla\txla\tula\t1\t2\t3\t1\t2\t1\tflphla\tinvhla\t\t\t1\t1\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Trellised Armor\t0\t0\t4\t1\t138\t153\t0\t61\t0\t0\t32\t0\t40\t0\t25\t47582\t305707\txtu\txtu\t\t\tstu\tstu\txtu\tutu\t1\t2\t3\t1\t2\t1\tflpstu\tinvstu\tinvxtuu\tinvxtuu\t1\t0\t0\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Linked Mail\t0\t0\t4\t1\t158\t172\t5\t74\t0\t0\t26\t0\t42\t0\t25\t56600\t393748\txng\txng\t\t\trng\trng\txng\tung\t1\t2\t3\t1\t3\t1\tflprng\tinvrng\t\t\t0\t0\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Tigulated Mail\t0\t0\t4\t1\t176\t190\t10\t86\t0\t0\t36\t0\t43\t0\t25\t64242\t473193\txcl\txcl\t\t\tscl\tscl\txcl\tucl\t1\t2\t3\t1\t3\t1\tflpscl\tinvscl\t\t\t1\t1\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mesh Armor\t0\t0\t4\t1\t198\t213\t5\t92\t0\t0\t45\t0\t45\t0\t25\t75440\t574094\txhn\txhn\t\t\tchn\tchn\txhn\tuhn\t1\t2\t3\t1\t3\t1\tflpchn\tinvchn\t\t\t1\t1\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cuirass\t0\t0\t4\t1\t188\t202\t0\t65\t0\t0\t50\t0\t47\t0\t25\t74719\t613456\txrs\txrs\t\t\tbrs\tbrs\txrs\turs\t1\t2\t3\t1\t3\t1\tflpbrs\tinvbrs\t\tinvxrss\t0\t0\t2\t0\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Russet Armor\t0\t0\t4\t1\t225\t243\t5\t97\t0\t0\t30\t0\t49\t0\t25\t93404\t788235\txpl\txpl\t\t\tspl\tspl\txpl\tupl\t1\t2\t3\t1\t3\t1\tflpspl\tinvspl\t\t\t1\t1\t2\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Templar Coat\t0\t0\t4\t1\t252\t274\t10\t118\t0\t0\t60\t0\t52\t0\t25\t111395\t1017928\txlt\txlt\t\t\tplt\tplt\txlt\tult\t1\t2\t3\t1\t3\t1\tflpplt\tinvplt\t\t\t2\t2\t2\t2\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sharktooth Armor\t0\t0\t4\t1\t242\t258\t5\t103\t0\t0\t48\t0\t55\t0\t25\t111674\t1103159\txld\txld\t\t\tfld\tfld\txld\tuld\t1\t2\t3\t1\t3\t1\tflpfld\tinvfld\t\t\t1\t1\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Embossed Plate\t0\t0\t4\t1\t282\t303\t5\t125\t0\t0\t55\t0\t58\t0\t25\t137817\t1457493\txth\txth\t\t\tgth\tgth\txth\tuth\t1\t2\t3\t1\t4\t1\tflpgth\tinvgth\t\t\t2\t2\t1\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Chaos Armor\t0\t0\t4\t1\t315\t342\t10\t140\t0\t0\t70\t0\t61\t0\t25\t162672\t1888411\txul\txul\t\t\tful\tful\txul\tuul\t1\t2\t3\t1\t4\t1\tflpful\tinvful\t\t\t2\t2\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ornate Armor\t0\t0\t4\t1\t417\t450\t5\t170\t0\t0\t60\t0\t64\t0\t25\t225120\t2696482\txar\txar\t\t\taar\taar\txar\tuar\t1\t2\t3\t1\t4\t1\tflpaar\tinvaar\tinvxaru\tinvxaru\t1\t2\t2\t2\t2\t0\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mage Plate\t0\t0\t4\t1\t225\t261\t0\t55\t0\t0\t60\t0\t60\t0\t25\t118407\t1327498\txtp\txtp\t\t\tltp\tltp\txtp\tutp\t1\t2\t3\t1\t3\t1\tflpltp\tinvltp\t\t\t2\t0\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Defender\t0\t0\t2\t1\t41\t49\t0\t38\t0\t10\t68\t0\t34\t0\t22\t12562\t77123\txuc\txuc\t\t\tbuc\tbuc\txuc\tuuc\t7\t2\t2\t1\t1\t2\tflpbuc\tinvbuc\tinvbucu\tinvbucu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t8\t12\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Round Shield\t0\t0\t3\t1\t47\t55\t0\t53\t0\t12\t64\t0\t37\t0\t25\t15451\t103735\txml\txml\t\t\tbuc\tsml\txml\tuml\t7\t2\t2\t1\t2\t2\tflpsml\tinvsml\tinvxmlu\tinvxmlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t7\t14\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t5\t0\txxx\txxx\t1\t0\t\n",
+                u8"Scutum\t0\t0\t4\t1\t53\t61\t5\t71\t0\t14\t62\t0\t42\t0\t25\t19537\t148359\txrg\txrg\t\t\tlrg\tlrg\txrg\turg\t7\t2\t3\t1\t3\t2\tflplrg\tinvlrg\tinvxrgu\tinvxrgu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t11\t15\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Dragon Shield\t0\t0\t4\t1\t59\t67\t0\t91\t0\t18\t76\t0\t45\t0\t25\t23094\t189944\txit\txit\t\t\tkit\tkit\txit\tuit\t7\t2\t3\t1\t3\t2\tflpkit\tinvkit\tinvkitu\tinvkitu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t15\t24\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Pavise\t0\t0\t4\t1\t68\t78\t10\t133\t0\t24\t72\t0\t50\t0\t25\t29550\t278500\txow\txow\t\t\ttow\ttow\txow\tuow\t7\t2\t3\t1\t3\t2\tflptow\tinvtow\tinvtowu\tinvtowu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t10\t17\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ancient Shield\t0\t0\t4\t1\t80\t93\t5\t110\t0\t16\t80\t0\t56\t0\t25\t39220\t422340\txts\txts\t\t\tkit\tgts\txts\tuts\t7\t2\t4\t1\t3\t2\tflpgts\tinvgts\tinvgtsu\tinvgtsu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t12\t16\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Demonhide Gloves\t0\t0\t1\t1\t28\t35\t0\t20\t0\t0\t12\t0\t33\t0\t21\t8480\t64102\txlg\txlg\t\t\tlgl\tlgl\txlg\tulg\t16\t2\t2\t0\t0\t0\tflplgl\tinvlgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sharkskin Gloves\t0\t0\t1\t1\t33\t39\t0\t20\t0\t0\t14\t0\t39\t0\t25\t11420\t85063\txvg\txvg\t\t\tvgl\tvgl\txvg\tuvg\t16\t2\t2\t0\t0\t0\tflpvgl\tinvvgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Heavy Bracers\t0\t0\t2\t1\t37\t44\t0\t58\t0\t0\t16\t0\t43\t0\t25\t14111\t114806\txmg\txmg\t\t\tmgl\tmgl\txmg\tumg\t16\t2\t2\t0\t0\t0\tflpmgl\tinvmgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloveschain\t12\titem_gloveschain\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Battle Gauntlets\t0\t0\t3\t1\t39\t47\t0\t88\t0\t0\t18\t0\t49\t0\t25\t16913\t161025\txtg\txtg\t\t\tmgl\ttgl\txtg\tutg\t16\t2\t2\t0\t0\t0\tflptgl\tinvtgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Gauntlets\t0\t0\t4\t1\t43\t53\t0\t110\t0\t0\t24\t0\t54\t0\t25\t20900\t223744\txhg\txhg\t\t\thgl\thgl\txhg\tuhg\t16\t2\t2\t0\t0\t0\tflphgl\tinvhgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Demonhide Boots\t0\t0\t1\t1\t28\t35\t0\t20\t0\t0\t12\t0\t36\t0\t24\t9230\t64102\txlb\txlb\t\t\tlbt\tlbt\txlb\tulb\t16\t2\t2\t0\t0\t0\tflplbt\tinvlbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t26\t46\t120\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sharkskin Boots\t0\t0\t1\t1\t33\t39\t0\t47\t0\t0\t14\t0\t39\t0\t25\t11393\t84859\txvb\txvb\t\t\tvbt\tvbt\txvb\tuvb\t16\t2\t2\t0\t0\t0\tflpvbt\tinvvbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t28\t50\t120\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n",
+                u8"Mesh Boots\t0\t0\t2\t1\t37\t44\t0\t65\t0\t0\t16\t0\t43\t0\t25\t14103\t114742\txmb\txmb\t\t\tmbt\tmbt\txmb\tumb\t16\t2\t2\t0\t0\t0\tflpmbt\tinvmbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootschain\t12\titem_bootschain\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t23\t52\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n",
+                u8"Battle Boots\t0\t0\t3\t1\t39\t47\t0\t95\t0\t0\t18\t0\t49\t0\t25\t16905\t160950\txtb\txtb\t\t\tmbt\ttbt\txtb\tutb\t16\t2\t2\t0\t0\t0\tflptbt\tinvtbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t37\t64\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n",
+                u8"War Boots\t0\t0\t4\t1\t43\t53\t0\t125\t0\t0\t24\t0\t54\t0\t25\t20885\t223574\txhb\txhb\t\t\thbt\thbt\txhb\tuhb\t16\t2\t2\t0\t0\t0\tflphbt\tinvhbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t39\t80\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n",
+                u8"Demonhide Sash\t0\t0\t1\t1\t29\t34\t0\t20\t0\t0\t12\t0\t36\t0\t24\t9304\t64486\tzlb\tzlb\t\t\tlbl\tlbl\tzlb\tulc\t16\t2\t1\t0\t0\t0\tflplbl\tinvlbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n",
+                u8"Sharkskin Belt\t0\t0\t1\t1\t31\t36\t0\t20\t0\t0\t14\t0\t39\t0\t25\t10700\t80809\tzvb\tzvb\t\t\tvbl\tvbl\tzvb\tuvc\t16\t2\t1\t0\t0\t0\tflpvbl\tinvvbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t1\t\n",
+                u8"Mesh Belt\t0\t0\t2\t1\t35\t40\t0\t58\t0\t0\t16\t0\t43\t0\t25\t13143\t108261\tzmb\tzmb\t\t\tmbl\tmbl\tzmb\tumc\t16\t2\t1\t0\t0\t0\tflpmbl\tinvmbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Battle Belt\t0\t0\t2\t1\t37\t42\t0\t88\t0\t0\t18\t0\t49\t0\t25\t15713\t151185\tztb\tztb\t\t\tmbl\ttbl\tztb\tutc\t16\t2\t1\t0\t0\t0\tflptbl\tinvtbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Belt\t0\t0\t3\t1\t41\t52\t0\t110\t0\t0\t24\t0\t54\t0\t25\t20350\t218512\tzhb\tzhb\t\t\thbl\thbl\tzhb\tuhc\t16\t2\t1\t0\t0\t0\tflphbl\tinvhbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Grim Helm\t0\t0\t2\t1\t60\t125\t0\t58\t0\t0\t40\t0\t50\t0\t25\t37683\t348947\txh9\txh9\t\t\tbhm\tbhm\txh9\tuh9\t0\t2\t2\t1\t2\t1\tflpbhm\tinvbhm\tinvbhmu\tinvbhmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t2\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Grim Shield\t0\t0\t2\t1\t50\t150\t0\t58\t0\t20\t70\t0\t48\t0\t25\t39143\t337523\txsh\txsh\t\t\tbsh\tbsh\txsh\tush\t7\t2\t3\t1\t2\t2\tflpbsh\tinvbsh\tinvxshu\tinvxshu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t14\t20\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Barbed Shield\t0\t0\t3\t1\t58\t78\t0\t65\t0\t17\t55\t0\t42\t0\t25\t23155\t172324\txpk\txpk\t\t\tspk\tspk\txpk\tupk\t7\t2\t3\t1\t2\t2\tflpspk\tinvspk\tinvxpku\tinvxpku\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t18\t35\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n",
+                u8"Wolf Head\t100\t0\t1\t1\t8\t11\t0\t16\t0\t0\t20\t0\t4\t0\t3\t364\t4868\tdr1\tdr1\t\t\tdr1\tdr1\tdr6\tdrb\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hawk Helm\t100\t0\t1\t1\t4\t15\t0\t20\t0\t0\t20\t0\t8\t0\t6\t664\t7840\tdr2\tdr2\t\t\tdr4\tdr2\tdr7\tdrc\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Antlers\t100\t0\t1\t1\t18\t24\t0\t24\t0\t0\t20\t0\t16\t0\t12\t2832\t21852\tdr3\tdr3\t\t\tdr3\tdr3\tdr8\tdrd\t0\t2\t2\t1\t3\t1\tflpdr3\tinvdr3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Falcon Mask\t100\t0\t1\t1\t12\t28\t0\t28\t0\t0\t20\t0\t20\t0\t15\t3332\t29200\tdr4\tdr4\t\t\tdr4\tdr4\tdr9\tdre\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Spirit Mask\t100\t0\t1\t1\t22\t35\t0\t30\t0\t0\t20\t0\t24\t0\t18\t5670\t48550\tdr5\tdr5\t\t\tdr1\tdr5\tdra\tdrf\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Jawbone Cap\t100\t0\t2\t1\t10\t15\t0\t25\t0\t0\t25\t0\t4\t0\t3\t320\t4750\tba1\tba1\t\t\tba1\tba1\tba6\tbab\t0\t2\t2\t1\t3\t1\tflpba1\tinvba1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Fanged Helm\t100\t0\t2\t1\t15\t20\t0\t35\t0\t0\t35\t0\t8\t0\t6\t750\t8250\tba2\tba2\t\t\tba1\tba2\tba7\tbac\t0\t2\t2\t1\t3\t1\tflpba1\tinvba2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Horned Helm\t100\t0\t2\t1\t25\t30\t0\t45\t0\t0\t45\t0\t16\t0\t12\t2750\t20750\tba3\tba3\t\t\tba3\tba3\tba8\tbad\t0\t2\t2\t1\t3\t1\tflpba3\tinvba3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Assault Helmet\t100\t0\t2\t1\t30\t35\t0\t55\t0\t0\t50\t0\t20\t0\t15\t3420\t29360\tba4\tba4\t\t\tba5\tba4\tba9\tbae\t0\t2\t2\t1\t3\t1\tflpba5\tinvba4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Avenger Guard\t100\t0\t2\t1\t35\t50\t0\t65\t0\t0\t55\t0\t24\t0\t18\t5785\t49280\tba5\tba5\t\t\tba5\tba5\tbaa\tbaf\t0\t2\t2\t1\t3\t1\tflpba5\tinvba5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Targe\t100\t0\t2\t1\t8\t12\t0\t16\t0\t10\t20\t0\t4\t0\t3\t384\t6317\tpa1\tpa1\t\t304\tpa1\tpa1\tpa6\tpab\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t1\t0\t\t\t0\t1\t0\t2\t6\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Rondache\t100\t0\t2\t1\t10\t18\t0\t26\t0\t15\t30\t0\t8\t0\t6\t982\t10517\tpa2\tpa2\t\t304\tpa1\tpa2\tpa7\tpac\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t2\t0\t\t\t0\t1\t0\t2\t8\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Heraldic Shield\t100\t0\t2\t1\t16\t26\t0\t40\t0\t20\t40\t0\t16\t0\t12\t2816\t21240\tpa3\tpa3\t\t304\tpa3\tpa3\tpa8\tpad\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t3\t0\t\t\t0\t1\t0\t3\t9\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Aerin Shield\t100\t0\t2\t1\t26\t36\t0\t50\t0\t22\t50\t0\t20\t0\t15\t5158\t43557\tpa4\tpa4\t\t304\tpa3\tpa4\tpa9\tpae\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t4\t0\t\t\t0\t1\t0\t4\t10\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Crown Shield\t100\t0\t2\t1\t30\t40\t0\t65\t0\t25\t60\t0\t24\t0\t18\t6935\t82075\tpa5\tpa5\t\t304\tpa5\tpa5\tpaa\tpaf\t7\t2\t2\t1\t4\t2\tflppa5\tinvpa5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t5\t0\t\t\t0\t1\t0\t4\t12\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Preserved Head\t100\t0\t1\t1\t2\t5\t0\t12\t0\t3\t20\t0\t4\t0\t3\t128\t4628\tne1\tne1\t\t305\tne1\tne1\tne6\tneb\t10\t2\t2\t1\t2\t2\tflpne1\tinvne1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Zombie Head\t100\t0\t1\t1\t4\t8\t0\t14\t0\t5\t20\t0\t8\t0\t6\t418\t7336\tne2\tne2\t\t305\tne2\tne2\tne7\tneg\t10\t2\t2\t1\t2\t2\tflpne2\tinvne2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Unraveller Head\t100\t0\t1\t1\t6\t10\t0\t18\t0\t8\t20\t0\t16\t0\t12\t1070\t14780\tne3\tne3\t\t305\tne3\tne3\tne8\tned\t10\t2\t2\t1\t2\t2\tflpne3\tinvne3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Gargoyle Head\t100\t0\t1\t1\t10\t16\t0\t20\t0\t10\t20\t0\t20\t0\t15\t2164\t23320\tne4\tne4\t\t305\tne3\tne4\tne9\tnee\t10\t2\t2\t1\t2\t2\tflpne3\tinvne4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Demon Head\t100\t0\t1\t1\t15\t20\t0\t25\t0\t12\t20\t0\t24\t0\t18\t3475\t35350\tne5\tne5\t\t305\tne2\tne5\tnea\tnef\t10\t2\t2\t1\t2\t2\tflpne2\tinvne5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Circlet\t100\t0\t1\t1\t20\t30\t0\t0\t0\t0\t35\t0\t24\t0\t16\t12000\t85625\tci0\tci0\t3\t\tlit\tci0\tci2\tci3\t0\t2\t2\t1\t2\t1\tflpci0\tinvci0\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tcirc\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Coronet\t100\t0\t1\t1\t30\t40\t0\t0\t0\t0\t30\t0\t52\t0\t39\t23000\t171250\tci1\tci1\t8\t\tlit\tci1\tci2\tci3\t0\t2\t2\t1\t2\t1\tflpci1\tinvci1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tcirc\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t1\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Tiara\t100\t0\t1\t1\t40\t50\t0\t0\t0\t0\t25\t0\t70\t0\t52\t35000\t700000\tci2\tci2\t13\t\tlit\tci1\tci2\tci3\t0\t2\t2\t1\t3\t1\tflpci1\tinvci2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tcirc\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t2\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Diadem\t100\t0\t1\t1\t50\t60\t0\t0\t0\t0\t20\t0\t85\t0\t64\t58000\t1382500\tci3\tci3\t18\t\tlit\tci1\tci2\tci3\t0\t2\t2\t1\t3\t1\tflpci2\tinvci3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tcirc\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t3\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Shako\t100\t0\t1\t1\t98\t141\t0\t50\t0\t0\t12\t0\t58\t0\t43\t56307\t503591\tuap\tuap\t\t\tcap\tcap\txap\tuap\t0\t2\t2\t1\t2\t1\tflpcap\tinvcap\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_cap\t12\titem_cap\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hydraskull\t100\t0\t4\t1\t101\t145\t0\t84\t0\t0\t18\t0\t63\t0\t47\t62739\t568276\tukp\tukp\t\t\tskp\tskp\txkp\tukp\t0\t2\t2\t1\t2\t1\tflpskp\tinvskp\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Armet\t100\t0\t4\t1\t105\t149\t0\t109\t0\t0\t24\t0\t68\t0\t51\t69940\t671703\tulm\tulm\t\t\thlm\thlm\txlm\tulm\t0\t2\t2\t1\t2\t1\tflphlm\tinvhlm\tinvhlmu\tinvhlmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Giant Conch\t100\t0\t4\t1\t110\t154\t0\t142\t0\t0\t30\t0\t54\t0\t40\t57806\t757863\tuhl\tuhl\t\t\tfhl\tfhl\txhl\tuhl\t0\t2\t2\t1\t2\t1\tflpfhl\tinvfhl\tinvfhlu\tinvfhlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Spired Helm\t100\t0\t4\t1\t114\t159\t0\t192\t0\t0\t40\t0\t79\t0\t59\t87168\t920880\tuhm\tuhm\t\t\tghm\tghm\txhm\tuhm\t0\t2\t2\t1\t3\t1\tflpghm\tinvghm\t\tinvuhms\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Corona\t100\t0\t4\t1\t111\t165\t0\t174\t0\t0\t50\t0\t85\t0\t66\t94770\t1042170\turn\turn\t\t\tcrn\tcrn\txrn\turn\t0\t2\t2\t1\t3\t1\tflpcrn\tinvcrn\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Demonhead\t100\t0\t4\t1\t101\t154\t0\t102\t0\t0\t20\t0\t74\t0\t55\t76578\t799703\tusk\tusk\t\t\tmsk\tmsk\txsk\tusk\t0\t2\t2\t1\t3\t1\tflpmsk\tinvmsk\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Dusk Shroud\t100\t0\t1\t1\t361\t467\t0\t77\t0\t0\t20\t0\t65\t0\t49\t218357\t1685148\tuui\tuui\t\t\tqlt\tqui\txui\tuui\t1\t2\t3\t1\t4\t1\tflpqlt\tinvqlt\t\t\t0\t0\t0\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Wyrmhide\t100\t0\t2\t1\t364\t470\t0\t84\t0\t0\t24\t0\t67\t0\t50\t226927\t1785276\tuea\tuea\t\t\tlea\tlea\txea\tuea\t1\t2\t3\t1\t4\t1\tflplea\tinvlea\t\t\t0\t0\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Scarab Husk\t100\t0\t3\t1\t369\t474\t0\t95\t0\t0\t28\t0\t68\t0\t51\t232573\t1891607\tula\tula\t\t\thla\thla\txla\tula\t1\t2\t3\t1\t4\t1\tflphla\tinvhla\t\t\t1\t1\t1\t0\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Wire Fleece\t100\t0\t4\t1\t375\t481\t0\t111\t0\t0\t32\t0\t70\t0\t53\t243050\t2059887\tutu\tutu\t\t\tstu\tstu\txtu\tutu\t1\t2\t3\t1\t4\t1\tflpstu\tinvstu\t\t\t1\t0\t0\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Diamond Mail\t100\t0\t4\t1\t383\t489\t5\t131\t0\t0\t26\t0\t72\t0\t54\t254435\t2243423\tung\tung\t\t\trng\trng\txng\tung\t1\t2\t3\t1\t4\t1\tflprng\tinvrng\t\t\t0\t0\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Loricated Mail\t100\t0\t4\t1\t390\t496\t10\t149\t0\t0\t36\t0\t73\t0\t55\t262166\t2382039\tucl\tucl\t\t\tscl\tscl\txcl\tucl\t1\t2\t3\t1\t4\t1\tflpscl\tinvscl\t\t\t1\t1\t1\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Boneweave\t100\t0\t4\t1\t399\t505\t5\t158\t0\t0\t45\t0\t62\t0\t47\t227700\t2536340\tuhn\tuhn\t\t\tchn\tchn\txhn\tuhn\t1\t2\t3\t1\t4\t1\tflpchn\tinvchn\t\t\t1\t1\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_chainarmor\t12\titem_chainarmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Great Hauberk\t100\t0\t4\t1\t395\t501\t0\t118\t0\t0\t50\t0\t75\t0\t56\t272206\t2676189\turs\turs\t\t\tbrs\tbrs\txrs\turs\t1\t2\t3\t1\t4\t1\tflpbrs\tinvbrs\t\t\t0\t0\t2\t0\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Balrog Skin\t100\t0\t4\t1\t410\t517\t5\t165\t0\t0\t30\t0\t76\t0\t57\t285351\t2882894\tupl\tupl\t\t\tspl\tspl\txpl\tupl\t1\t2\t3\t1\t4\t1\tflpspl\tinvspl\t\t\t1\t1\t2\t1\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hellforge Plate\t100\t0\t4\t1\t421\t530\t10\t196\t0\t0\t60\t0\t78\t0\t59\t300130\t3197721\tult\tult\t\t\tplt\tplt\txlt\tult\t1\t2\t3\t1\t4\t1\tflpplt\tinvplt\t\t\t2\t2\t2\t2\t1\t1\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Kraken Shell\t100\t0\t4\t1\t417\t523\t5\t174\t0\t0\t48\t0\t81\t0\t61\t308015\t3411990\tuld\tuld\t\t\tfld\tfld\txld\tuld\t1\t2\t3\t1\t4\t1\tflpfld\tinvfld\t\t\t1\t1\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Lacquered Plate\t100\t0\t4\t1\t433\t541\t5\t208\t0\t0\t55\t0\t82\t0\t62\t323094\t3803464\tuth\tuth\t\t\tgth\tgth\txth\tuth\t1\t2\t3\t1\t4\t1\tflpgth\tinvgth\t\t\t2\t2\t1\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Shadow Plate\t100\t0\t4\t1\t446\t557\t10\t230\t0\t0\t70\t0\t83\t0\t64\t336644\t4274953\tuul\tuul\t\t\tful\tful\txul\tuul\t1\t2\t3\t1\t4\t1\tflpful\tinvful\t\t\t2\t2\t2\t2\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sacred Armor\t100\t0\t4\t1\t487\t600\t5\t232\t0\t0\t60\t0\t85\t0\t66\t373558\t4872212\tuar\tuar\t\t\taar\taar\txar\tuar\t1\t2\t3\t1\t4\t1\tflpaar\tinvaar\tinvaaru\tinvaaru\t1\t2\t2\t2\t2\t0\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Archon Plate\t100\t0\t4\t1\t410\t524\t0\t103\t0\t0\t60\t0\t84\t0\t63\t317526\t3851372\tutp\tutp\t\t\tltp\tltp\txtp\tutp\t1\t2\t3\t1\t4\t1\tflpltp\tinvltp\t\t\t2\t0\t1\t1\t2\t2\t0\t\t\t\t\t0\txxx\t\t\ttors\t\titem_platearmor\t12\titem_platearmor\t0\t0\t5\t0\t0\t0\t\t\t0\t2\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Heater\t100\t0\t2\t1\t95\t110\t0\t77\t0\t22\t88\t0\t58\t0\t43\t48303\t385227\tuuc\tuuc\t\t\tbuc\tbuc\txuc\tuuc\t7\t2\t2\t1\t2\t2\tflpbuc\tinvbuc\tinvbucu\tinvbucu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t16\t30\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Luna\t100\t0\t3\t1\t108\t123\t0\t100\t0\t20\t84\t0\t61\t0\t45\t57189\t436543\tuml\tuml\t\t\tbuc\tsml\txml\tuml\t7\t2\t2\t1\t2\t2\tflpsml\tinvsml\tinvsmlu\tinvsmlu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_woodshield\t12\titem_woodshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t17\t29\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t5\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hyperion\t100\t0\t4\t1\t119\t135\t5\t127\t0\t24\t82\t0\t64\t0\t48\t65914\t514278\turg\turg\t\t\tlrg\tlrg\txrg\turg\t7\t2\t3\t1\t3\t2\tflplrg\tinvlrg\tinvlrgu\tinvlrgu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t14\t32\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Monarch\t100\t0\t4\t1\t133\t148\t0\t156\t0\t22\t86\t0\t72\t0\t54\t81896\t576154\tuit\tuit\t\t\tkit\tkit\txit\tuit\t7\t2\t3\t1\t4\t2\tflpkit\tinvkit\tinvkitu\tinvkitu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t12\t34\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Aegis\t100\t0\t4\t1\t145\t161\t10\t219\t0\t24\t92\t0\t79\t0\t59\t97701\t693568\tuow\tuow\t\t\ttow\ttow\txow\tuow\t7\t2\t3\t1\t4\t2\tflptow\tinvtow\tinvtowu\tinvtowu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t18\t28\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ward\t100\t0\t4\t1\t153\t170\t5\t185\t0\t24\t100\t0\t84\t0\t63\t109635\t856602\tuts\tuts\t\t\tkit\tgts\txts\tuts\t7\t2\t4\t1\t4\t2\tflpgts\tinvgts\tinvgtsu\tinvutss\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t11\t35\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bramble Mitts\t100\t0\t1\t1\t54\t62\t0\t50\t0\t0\t12\t0\t57\t0\t42\t26920\t269938\tulg\tulg\t\t\tlgl\tlgl\txlg\tulg\t16\t2\t2\t0\t0\t0\tflplgl\tinvlgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Vampirebone Gloves\t100\t0\t1\t1\t56\t65\t0\t50\t0\t0\t14\t0\t63\t0\t47\t30862\t306103\tuvg\tuvg\t\t\tvgl\tvgl\txvg\tuvg\t16\t2\t2\t0\t0\t0\tflpvgl\tinvvgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloves\t12\titem_gloves\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Vambraces\t100\t0\t2\t1\t59\t67\t0\t106\t0\t0\t16\t0\t69\t0\t51\t34964\t352152\tumg\tumg\t\t\tmgl\tmgl\txmg\tumg\t16\t2\t2\t0\t0\t0\tflpmgl\tinvmgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_gloveschain\t12\titem_gloveschain\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Crusader Gauntlets\t100\t0\t3\t1\t59\t68\t0\t151\t0\t0\t18\t0\t76\t0\t57\t39119\t420620\tutg\tutg\t\t\tmgl\ttgl\txtg\tutg\t16\t2\t2\t0\t0\t0\tflptgl\tinvtgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ogre Gauntlets\t100\t0\t4\t1\t62\t71\t0\t185\t0\t0\t24\t0\t85\t0\t64\t45481\t498191\tuhg\tuhg\t\t\thgl\thgl\txhg\tuhg\t16\t2\t2\t0\t0\t0\tflphgl\tinvhgl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tglov\t\titem_glovesmetal\t12\titem_glovesmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t5\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Wyrmhide Boots\t100\t0\t1\t1\t54\t62\t0\t50\t0\t0\t12\t0\t60\t0\t45\t28315\t269938\tulb\tulb\t\t\tlbt\tlbt\txlb\tulb\t16\t2\t2\t0\t0\t0\tflplbt\tinvlbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t65\t100\t120\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Scarabshell Boots\t100\t0\t1\t1\t56\t65\t0\t91\t0\t0\t14\t0\t66\t0\t49\t32271\t305620\tuvb\tuvb\t\t\tvbt\tvbt\txvb\tuvb\t16\t2\t2\t0\t0\t0\tflpvbt\tinvvbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_boots\t12\titem_boots\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t60\t110\t120\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Boneweave Boots\t100\t0\t2\t1\t59\t67\t0\t118\t0\t0\t16\t0\t72\t0\t54\t36456\t352010\tumb\tumb\t\t\tmbt\tmbt\txmb\tumb\t16\t2\t2\t0\t0\t0\tflpmbt\tinvmbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootschain\t12\titem_bootschain\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t69\t118\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mirrored Boots\t100\t0\t3\t1\t59\t68\t0\t163\t0\t0\t18\t0\t81\t0\t60\t41658\t420465\tutb\tutb\t\t\tmbt\ttbt\txtb\tutb\t16\t2\t2\t0\t0\t0\tflptbt\tinvtbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t50\t145\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Myrmidon Greaves\t100\t0\t4\t1\t62\t71\t0\t208\t0\t0\t24\t0\t85\t0\t65\t45459\t497859\tuhb\tuhb\t\t\thbt\thbt\txhb\tuhb\t16\t2\t2\t0\t0\t0\tflphbt\tinvhbt\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tboot\t\titem_bootsmetal\t12\titem_bootsmetal\t0\t0\t5\t0\t0\t0\t\t\t0\t6\t0\t83\t149\t120\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Spiderweb Sash\t100\t0\t1\t1\t55\t62\t0\t50\t0\t0\t12\t0\t61\t0\t46\t28842\t270466\tulc\tulc\t\t\tlbl\tlbl\tzlb\tulc\t16\t2\t1\t0\t0\t0\tflplbl\tinvlbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Vampirefang Belt\t100\t0\t1\t1\t56\t63\t0\t50\t0\t0\t14\t0\t68\t0\t51\t32656\t300879\tuvc\tuvc\t\t\tvbl\tvbl\tzvb\tuvc\t16\t2\t1\t0\t0\t0\tflpvbl\tinvvbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mithril Coil\t100\t0\t2\t1\t58\t65\t0\t106\t0\t0\t16\t0\t75\t0\t56\t37134\t345000\tumc\tumc\t\t\tmbl\tmbl\tzmb\tumc\t16\t2\t1\t0\t0\t0\tflpmbl\tinvmbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Troll Belt\t100\t0\t2\t1\t59\t66\t0\t151\t0\t0\t18\t0\t82\t0\t62\t41183\t411380\tutc\tutc\t\t\tmbl\ttbl\tztb\tutc\t16\t2\t1\t0\t0\t0\tflptbl\tinvtbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Colossus Girdle\t100\t0\t3\t1\t61\t71\t0\t185\t0\t0\t24\t0\t85\t0\t67\t45051\t493775\tuhc\tuhc\t\t\thbl\thbl\tzhb\tuhc\t16\t2\t1\t0\t0\t0\tflphbl\tinvhbl\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tbelt\t\titem_belt\t12\titem_belt\t0\t0\t5\t0\t0\t6\t\t\t0\t4\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bone Visage\t100\t0\t2\t1\t100\t157\t0\t106\t0\t0\t40\t0\t84\t0\t63\t87274\t598161\tuh9\tuh9\t\t\tbhm\tbhm\txh9\tuh9\t0\t2\t2\t1\t3\t1\tflpbhm\tinvbhm\tinvbhmu\tinvbhmu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thelm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t2\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t7\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Troll Nest\t100\t0\t2\t1\t158\t173\t0\t106\t0\t20\t74\t0\t76\t0\t57\t101842\t586580\tush\tush\t\t\tbsh\tbsh\txsh\tush\t7\t2\t3\t1\t3\t2\tflpbsh\tinvbsh\tinvbshu\tinvbshu\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t24\t38\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Blade Barrier\t100\t0\t3\t1\t147\t163\t0\t118\t0\t20\t83\t0\t68\t0\t51\t85443\t413914\tupk\tupk\t\t\tspk\tspk\txpk\tupk\t7\t2\t3\t1\t3\t2\tflpspk\tinvspk\tinvspku\tinvspku\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tshie\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t0\t0\t\t\t0\t1\t0\t26\t40\t100\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Alpha Helm\t100\t0\t1\t1\t52\t62\t0\t44\t0\t0\t20\t0\t35\t0\t26\t16300\t82061\tdr6\tdr6\t\t\tdr1\tdr1\tdr6\tdrb\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Griffon Headress\t100\t0\t1\t1\t46\t68\t0\t50\t0\t0\t20\t0\t40\t0\t30\t18564\t82062\tdr7\tdr7\t\t\tdr4\tdr2\tdr7\tdrc\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hunter's Guise\t100\t0\t1\t1\t67\t81\t0\t56\t0\t0\t20\t0\t46\t0\t29\t27768\t82063\tdr8\tdr8\t\t\tdr3\tdr3\tdr8\tdrd\t0\t2\t2\t1\t3\t1\tflpdr3\tinvdr3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sacred Feathers\t100\t0\t1\t1\t58\t87\t0\t62\t0\t0\t20\t0\t50\t0\t32\t29518\t82064\tdr9\tdr9\t\t\tdr4\tdr4\tdr9\tdre\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Totemic Mask\t100\t0\t1\t1\t73\t98\t0\t65\t0\t0\t20\t0\t55\t0\t41\t38127\t82065\tdra\tdra\t\t\tdr1\tdr5\tdra\tdrf\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Jawbone Visor\t100\t0\t2\t1\t55\t68\t0\t58\t0\t0\t25\t0\t33\t0\t25\t16603\t82061\tba6\tba6\t\t\tba1\tba1\tba6\tbab\t0\t2\t2\t1\t3\t1\tflpba1\tinvba1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Lion Helm\t100\t0\t2\t1\t63\t75\t0\t73\t0\t0\t35\t0\t38\t0\t29\t21378\t82062\tba7\tba7\t\t\tba1\tba2\tba7\tbac\t0\t2\t2\t1\t3\t1\tflpba1\tinvba2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Rage Mask\t100\t0\t2\t1\t78\t90\t0\t88\t0\t0\t45\t0\t44\t0\t29\t30063\t82063\tba8\tba8\t\t\tba3\tba3\tba8\tbad\t0\t2\t2\t1\t3\t1\tflpba3\tinvba3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Savage Helmet\t100\t0\t2\t1\t85\t98\t0\t103\t0\t0\t50\t0\t49\t0\t32\t36398\t82064\tba9\tba9\t\t\tba5\tba4\tba9\tbae\t0\t2\t2\t1\t3\t1\tflpba5\tinvba4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Slayer Guard\t100\t0\t2\t1\t93\t120\t0\t118\t0\t0\t55\t0\t54\t0\t40\t46633\t82065\tbaa\tbaa\t\t\tba5\tba5\tbaa\tbaf\t0\t2\t2\t1\t3\t1\tflpba5\tinvba5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Akaran Targe\t100\t0\t2\t1\t101\t125\t0\t44\t0\t10\t20\t0\t35\t0\t26\t32500\t82065\tpa6\tpa6\t\t304\tpa1\tpa1\tpa6\tpab\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t1\t0\t\t\t0\t1\t0\t12\t16\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Akaran Rondache\t100\t0\t2\t1\t113\t137\t0\t59\t0\t15\t30\t0\t40\t0\t30\t40941\t82066\tpa7\tpa7\t\t304\tpa1\tpa2\tpa7\tpac\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t2\t0\t\t\t0\t1\t0\t15\t20\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Protector Shield\t100\t0\t2\t1\t129\t153\t0\t69\t0\t20\t40\t0\t46\t0\t34\t52947\t82067\tpa8\tpa8\t\t304\tpa3\tpa3\tpa8\tpad\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t3\t0\t\t\t0\t1\t0\t18\t24\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Gilded Shield\t100\t0\t2\t1\t144\t168\t0\t89\t0\t22\t50\t0\t51\t0\t38\t64807\t82068\tpa9\tpa9\t\t304\tpa3\tpa4\tpa9\tpae\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t4\t0\t\t\t0\t1\t0\t20\t28\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Royal Shield\t100\t0\t2\t1\t156\t181\t0\t114\t0\t25\t60\t0\t55\t0\t41\t75374\t82069\tpaa\tpaa\t\t304\tpa5\tpa5\tpaa\tpaf\t7\t2\t2\t1\t4\t2\tflppa5\tinvpa5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t5\t0\t\t\t0\t1\t0\t24\t32\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mummified Trophy\t100\t0\t1\t1\t38\t48\t0\t38\t0\t3\t20\t0\t33\t0\t24\t11590\t82069\tne6\tne6\t\t305\tne1\tne1\tne6\tneb\t10\t2\t2\t1\t2\t2\tflpne1\tinvne1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Fetish Trophy\t100\t0\t1\t1\t41\t52\t0\t41\t0\t5\t20\t0\t39\t0\t29\t14839\t82070\tne7\tne7\t\t305\tne2\tne2\tne7\tneg\t10\t2\t2\t1\t2\t2\tflpne2\tinvne2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sexton Trophy\t100\t0\t1\t1\t44\t55\t0\t47\t0\t8\t20\t0\t45\t0\t33\t18169\t82071\tne8\tne8\t\t305\tne3\tne3\tne8\tned\t10\t2\t2\t1\t2\t2\tflpne3\tinvne3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cantor Trophy\t100\t0\t1\t1\t50\t64\t0\t50\t0\t10\t20\t0\t49\t0\t36\t22750\t82072\tne9\tne9\t\t305\tne3\tne4\tne9\tnee\t10\t2\t2\t1\t2\t2\tflpne3\tinvne4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Heirophant Trophy\t100\t0\t1\t1\t58\t70\t0\t58\t0\t12\t20\t0\t54\t0\t40\t27993\t82073\tnea\tnea\t\t305\tne2\tne5\tnea\tnef\t10\t2\t2\t1\t2\t2\tflpne2\tinvne5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Blood Spirit\t100\t0\t1\t1\t101\t145\t0\t86\t0\t0\t20\t0\t62\t0\t46\t61755\t413914\tdrb\tdrb\t\t\tdr1\tdr1\tdr6\tdrb\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sun Spirit\t100\t0\t1\t1\t98\t147\t0\t95\t0\t0\t20\t0\t69\t0\t51\t68617\t413915\tdrc\tdrc\t\t\tdr4\tdr2\tdr7\tdrc\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Earth Spirit\t100\t0\t1\t1\t107\t152\t0\t104\t0\t0\t20\t0\t76\t0\t57\t79730\t413916\tdrd\tdrd\t\t\tdr3\tdr3\tdr8\tdrd\t0\t2\t2\t1\t3\t1\tflpdr3\tinvdr3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sky Spirit\t100\t0\t1\t1\t103\t155\t0\t113\t0\t0\t20\t0\t83\t0\t62\t86575\t413917\tdre\tdre\t\t\tdr4\tdr4\tdr9\tdre\t0\t2\t2\t1\t3\t1\tflpdr4\tinvdr4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Dream Spirit\t100\t0\t1\t1\t109\t159\t0\t118\t0\t0\t20\t0\t85\t0\t66\t92143\t413918\tdrf\tdrf\t\t\tdr1\tdr5\tdra\tdrf\t0\t2\t2\t1\t3\t1\tflpdr1\tinvdr5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tpelt\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Carnage Helm\t100\t0\t2\t1\t102\t147\t0\t106\t0\t0\t25\t0\t60\t0\t45\t60650\t413918\tbab\tbab\t\t\tba1\tba1\tba6\tbab\t0\t2\t2\t1\t3\t1\tflpba1\tinvba1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Fury Visor\t100\t0\t2\t1\t105\t150\t0\t129\t0\t0\t35\t0\t66\t0\t49\t68211\t413919\tbac\tbac\t\t\tba1\tba2\tba7\tbac\t0\t2\t2\t1\t3\t1\tflpba1\tinvba2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Destroyer Helm\t100\t0\t2\t1\t111\t156\t0\t151\t0\t0\t45\t0\t73\t0\t54\t78881\t413920\tbad\tbad\t\t\tba3\tba3\tba8\tbad\t0\t2\t2\t1\t3\t1\tflpba3\tinvba3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Conqueror Crown\t100\t0\t2\t1\t114\t159\t0\t174\t0\t0\t50\t0\t80\t0\t60\t88278\t413921\tbae\tbae\t\t\tba5\tba4\tba9\tbae\t0\t2\t2\t1\t3\t1\tflpba5\tinvba4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Guardian Crown\t100\t0\t2\t1\t117\t168\t0\t196\t0\t0\t55\t0\t85\t0\t65\t97844\t413922\tbaf\tbaf\t\t\tba5\tba5\tbaa\tbaf\t0\t2\t2\t1\t3\t1\tflpba5\tinvba5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tphlm\t\titem_helm\t12\titem_helm\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sacred Targe\t100\t0\t2\t1\t126\t158\t0\t86\t0\t30\t45\t0\t63\t0\t47\t72618\t82065\tpab\tpab\t\t304\tpa1\tpa1\tpa6\tpab\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t1\t0\t\t\t0\t1\t0\t22\t70\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sacred Rondache\t100\t0\t2\t1\t138\t164\t0\t109\t0\t28\t68\t0\t70\t0\t52\t85659\t82066\tpac\tpac\t\t304\tpa1\tpa2\tpa7\tpac\t7\t2\t2\t1\t4\t2\tflppa1\tinvpa2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t2\t0\t\t\t0\t1\t0\t35\t58\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ancient Shield\t100\t0\t2\t1\t154\t172\t0\t124\t0\t25\t55\t0\t74\t0\t55\t97676\t82067\tpad\tpad\t\t304\tpa3\tpa3\tpa8\tpad\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t3\t0\t\t\t0\t1\t0\t10\t82\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Zakarum Shield\t100\t0\t2\t1\t169\t193\t0\t142\t0\t22\t65\t0\t82\t0\t61\t120042\t82068\tpae\tpae\t\t304\tpa3\tpa4\tpa9\tpae\t7\t2\t4\t1\t4\t2\tflppa3\tinvpa4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t4\t0\t\t\t0\t1\t0\t46\t46\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Vortex Shield\t100\t0\t2\t1\t182\t225\t0\t148\t0\t19\t90\t0\t85\t0\t66\t139860\t82069\tpaf\tpaf\t\t304\tpa5\tpa5\tpaa\tpaf\t7\t2\t2\t1\t4\t2\tflppa5\tinvpa5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\tashd\t\titem_metalshield\t12\titem_metalshield\t0\t0\t5\t0\t5\t0\t\t\t0\t1\t0\t5\t87\t100\t\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Minion Skull\t100\t0\t1\t1\t95\t139\t0\t77\t0\t3\t20\t0\t59\t0\t44\t56131\t82069\tneb\tneb\t\t305\tne1\tne1\tne6\tneb\t10\t2\t2\t1\t2\t2\tflpne1\tinvne1\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hellspawn Skull\t100\t0\t1\t1\t96\t141\t0\t82\t0\t5\t20\t0\t67\t0\t50\t64437\t82070\tneg\tneg\t\t305\tne2\tne2\tne7\tneg\t10\t2\t2\t1\t2\t2\tflpne2\tinvne2\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Overseer Skull\t100\t0\t1\t1\t98\t142\t0\t91\t0\t8\t20\t0\t66\t0\t49\t64122\t82071\tned\tned\t\t305\tne3\tne3\tne8\tned\t10\t2\t2\t1\t2\t2\tflpne3\tinvne3\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Succubus Skull\t100\t0\t1\t1\t100\t146\t0\t95\t0\t10\t20\t0\t81\t0\t60\t80462\t82072\tnee\tnee\t\t305\tne3\tne4\tne9\tnee\t10\t2\t2\t1\t2\t2\tflpne3\tinvne4\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bloodlord Skull\t100\t0\t1\t1\t103\t148\t0\t106\t0\t12\t20\t0\t85\t0\t65\t86238\t82073\tnef\tnef\t\t305\tne2\tne5\tnea\tnef\t10\t2\t2\t1\t2\t2\tflpne2\tinvne5\t\t\t\t\t\t\t\t\t0\t\t\t\t\t0\txxx\t\t\thead\t\titem_head\t12\titem_head\t0\t0\t5\t0\t0\t0\t\t\t0\t3\t0\t0\t0\t\t\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t0\t0\txxx\txxx\t1\t0\t\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,33 +18,29 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetBodyLocs()
+        EmbeddedText GetBodyLocs()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"Body Location\tCode\n";
-                ss << u8"None\t\n";
-                ss << u8"Head\thead\n";
-                ss << u8"Neck\tneck\n";
-                ss << u8"Torso\ttors\n";
-                ss << u8"Right Arm\trarm\n";
-                ss << u8"Left Arm\tlarm\n";
-                ss << u8"Right Ring\trrin\n";
-                ss << u8"Left Ring\tlrin\n";
-                ss << u8"Belt\tbelt\n";
-                ss << u8"Feet\tfeet\n";
-                ss << u8"Gloves\tglov\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"Body Location\tCode\n",
+                u8"None\t\n",
+                u8"Head\thead\n",
+                u8"Neck\tneck\n",
+                u8"Torso\ttors\n",
+                u8"Right Arm\trarm\n",
+                u8"Left Arm\tlarm\n",
+                u8"Right Ring\trrin\n",
+                u8"Left Ring\tlrin\n",
+                u8"Belt\tbelt\n",
+                u8"Feet\tfeet\n",
+                u8"Gloves\tglov\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include "pch.h"
 #include "ItemHelpers.h"
 #include "DefaultTxtReader.h"
+#include "EmbeddedText.h"
 #include <rapidcsv/rapidcsv.h>
 #include <json/json.h>
 #include <sstream>
@@ -27,6 +28,7 @@
 #include <regex>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <variant>
 #include <utf8/utf8.h>
 #include <StormLib.h>
@@ -57,11 +59,11 @@ namespace d2ce
         return std::filesystem::path();
     }
     
-    Json::Value GetChildrenNode(const std::string& layout)
+    Json::Value GetChildrenNode(const EmbeddedText& layout)
     {
         static Json::Value badValue;
 
-        std::istringstream stream(layout);
+        EmbeddedTextStream stream(layout);
         Json::Value root;
         Json::CharReaderBuilder builder;
         JSONCPP_STRING errs;
@@ -73,7 +75,7 @@ namespace d2ce
         return badValue;
     }
 
-    Json::Value GetGridSize(const std::string& layout)
+    Json::Value GetGridSize(const EmbeddedText& layout)
     {
         static Json::Value badValue;
         Json::Value jsonValue;
@@ -118,59 +120,211 @@ namespace d2ce
 
     namespace JsonReaderHelper
     {
-        const std::string& GetItemGems();
-        const std::string& GetItemModifiers();
-        const std::string& GetItemNameAffixes();
-        const std::string& GetItemNames();
-        const std::string& GetItemRunes();
-        const std::string& GetLevels();
-        const std::string& GetMercenaries();
-        const std::string& GetMonsters();
-        const std::string& GetNPCs();
-        const std::string& GetQuests();
-        const std::string& GetSkills();
-        const std::string& GetUI();
-
-        const std::string& GetBankExpansionLayout();
-        const std::string& GetHirelingInventoryPanel();
-        const std::string& GetHoradricCubeLayout();
-        const std::string& GetPlayerInventoryExpansionLayout();
+        EmbeddedText GetItemGems();
+        EmbeddedText GetItemModifiers();
+        EmbeddedText GetItemNameAffixes();
+        EmbeddedText GetItemNames();
+        EmbeddedText GetItemRunes();
+        EmbeddedText GetLevels();
+        EmbeddedText GetMercenaries();
+        EmbeddedText GetMonsters();
+        EmbeddedText GetNPCs();
+        EmbeddedText GetQuests();
+        EmbeddedText GetSkills();
+        EmbeddedText GetUI();
+
+        EmbeddedText GetBankExpansionLayout();
+        EmbeddedText GetHirelingInventoryPanel();
+        EmbeddedText GetHoradricCubeLayout();
+        EmbeddedText GetPlayerInventoryExpansionLayout();
     }
 
     namespace TxtReaderHelper
     {
-        const std::string& GetArmor();
-        const std::string& GetBelts();
-        const std::string& GetBodyLocs();
-        const std::string& GetCharStats();
-        const std::string& GetExperience();
-        const std::string& GetGems();
-        const std::string& GetHireling();
-        const std::string& GetItemsCode();
-        const std::string& GetItemStatCost();
-        const std::string& GetItemTypes();
-        const std::string& GetMagicPrefix();
-        const std::string& GetMagicSuffix();
-        const std::string& GetMisc();
-        const std::string& GetPlayerClass();
-        const std::string& GetProperties();
-        const std::string& GetRarePrefix();
-        const std::string& GetRareSuffix();
-        const std::string& GetRunes();
-        const std::string& GetSetItems();
-        const std::string& GetSets();
-        const std::string& GetSkillDesc();
-        const std::string& GetSkills();
-        const std::string& GetUniqueItems();
-        const std::string& GetWeapons();
-        const std::string& GetMonStats();
-        const std::string& GetMonType();
-        const std::string& GetSuperiorModsTxt();
-        const std::string& GetCraftModsTxt();
-        const std::string& GetGridDimensionsTxt();
-        const std::string& GetMercInventoryTxt();
+        EmbeddedText GetArmor();
+        EmbeddedText GetBelts();
+        EmbeddedText GetBodyLocs();
+        EmbeddedText GetCharStats();
+        EmbeddedText GetExperience();
+        EmbeddedText GetGems();
+        EmbeddedText GetHireling();
+        EmbeddedText GetItemsCode();
+        EmbeddedText GetItemStatCost();
+        EmbeddedText GetItemTypes();
+        EmbeddedText GetMagicPrefix();
+        EmbeddedText GetMagicSuffix();
+        EmbeddedText GetMisc();
+        EmbeddedText GetPlayerClass();
+        EmbeddedText GetProperties();
+        EmbeddedText GetRarePrefix();
+        EmbeddedText GetRareSuffix();
+        EmbeddedText GetRunes();
+        EmbeddedText GetSetItems();
+        EmbeddedText GetSets();
+        EmbeddedText GetSkillDesc();
+        EmbeddedText GetSkills();
+        EmbeddedText GetUniqueItems();
+        EmbeddedText GetWeapons();
+        EmbeddedText GetMonStats();
+        EmbeddedText GetMonType();
+        EmbeddedText GetSuperiorModsTxt();
+        EmbeddedText GetCraftModsTxt();
+        EmbeddedText GetGridDimensionsTxt();
+        EmbeddedText GetMercInventoryTxt();
     }
 
+    //---------------------------------------------------------------------------
+    // Excel table decoded from a D2R .bin file. The cells are kept by column as offsets
+    // into a single pool of NUL terminated values, so the decoded records are served as
+    // is instead of being written out as tab separated text and parsed back by rapidcsv.
+    class BinTxtTable
+    {
+    public:
+        BinTxtTable(const std::vector<std::string>& columnNames) : m_columnNames(columnNames), m_columns(columnNames.size())
+        {
+            // offset 0 is the empty value
+            m_cellData.push_back('\0');
+            for (size_t idx = 0; idx < m_columnNames.size(); ++idx)
+            {
+                // same as rapidcsv, the last column with a given name wins
+                m_columnIdx[m_columnNames[idx]] = idx;
+            }
+        }
+
+        void addRow(const std::vector<std::string>& values)
+        {
+            for (size_t idx = 0; idx < m_columns.size(); ++idx)
+            {
+                if ((idx >= values.size()) || values[idx].empty())
+                {
+                    m_columns[idx].push_back(0);
+                    continue;
+                }
+
+                m_columns[idx].push_back(std::uint32_t(m_cellData.size()));
+                m_cellData.append(values[idx]);
+                m_cellData.push_back('\0');
+            }
+
+            ++m_numRows;
+        }
+
+        const std::vector<std::string>& getColumnNames() const
+        {
+            return m_columnNames;
+        }
+
+        size_t getRowCount() const
+        {
+            return m_numRows;
+        }
+
+        SSIZE_T getColumnIdx(const std::string& columnName) const
+        {
+            auto iter = m_columnIdx.find(columnName);
+            if (iter == m_columnIdx.end())
+            {
+                return -1;
+            }
+
+            return SSIZE_T(iter->second);
+        }
+
+        const char* getCell(size_t columnIdx, size_t rowIdx) const
+        {
+            return m_cellData.c_str() + m_columns.at(columnIdx).at(rowIdx);
+        }
+
+    private:
+        std::vector<std::string> m_columnNames;
+        std::map<std::string, size_t> m_columnIdx;
+        std::vector<std::vector<std::uint32_t>> m_columns;
+        std::string m_cellData;
+        size_t m_numRows = 0;
+    };
+    using BinTxtTablePtr = std::shared_ptr<const BinTxtTable>;
+
+    class BinTxtDocument : public ITxtDocument
+    {
+    public:
+        BinTxtDocument(const BinTxtTablePtr& table) : m_table(table)
+        {
+        }
+
+        std::string GetRowName(SSIZE_T /*pRowIdx*/) const override
+        {
+            // same as a tab separated document, the excel tables have no row names
+            throw std::out_of_range("row name column index < 0: -1");
+        }
+
+        std::vector<std::string> GetColumnNames() const override
+        {
+            return m_table->getColumnNames();
+        }
+
+        std::string GetColumnName(SSIZE_T pColumnIdx) const override
+        {
+            return m_table->getColumnNames().at(size_t(pColumnIdx));
+        }
+
+        size_t GetRowCount() const override
+        {
+            return m_table->getRowCount();
+        }
+
+        size_t GetColumnCount() const override
+        {
+            return m_table->getColumnNames().size();
+        }
+
+        SSIZE_T GetColumnIdx(const std::string& pColumnName) const override
+        {
+            return m_table->getColumnIdx(pColumnName);
+        }
+
+        std::string GetCellString(size_t pColumnIdx, size_t pRowIdx) const override
+        {
+            return m_table->getCell(pColumnIdx, pRowIdx);
+        }
+
+        std::uint64_t GetCellUInt64(size_t pColumnIdx, size_t pRowIdx) const override
+        {
+            return GetCell<std::uint64_t>(pColumnIdx, pRowIdx);
+        }
+
+        std::uint32_t GetCellUInt32(size_t pColumnIdx, size_t pRowIdx) const override
+        {
+            return GetCell<std::uint32_t>(pColumnIdx, pRowIdx);
+        }
+
+        std::uint16_t GetCellUInt16(size_t pColumnIdx, size_t pRowIdx) const override
+        {
+            return GetCell<std::uint16_t>(pColumnIdx, pRowIdx);
+        }
+
+        size_t GetRowValues(size_t /*rowIdx*/, std::string& index, std::map<std::string, std::string>& stringCols) const override
+        {
+            // not a string table
+            index.clear();
+            stringCols.clear();
+            return MAXSIZE_T;
+        }
+
+    protected:
+        // numeric cells go through the same converter as the rapidcsv documents, so a cell
+        // holds the same value (or throws the same way) whichever document it is read from
+        template<typename T>
+        T GetCell(size_t pColumnIdx, size_t pRowIdx) const
+        {
+            T value;
+            rapidcsv::Converter<T> converter{ rapidcsv::ConverterParams() };
+            converter.ToVal(GetCellString(pColumnIdx, pRowIdx), value);
+            return value;
+        }
+
+        BinTxtTablePtr m_table;
+    };
+
     class D2RModReaderHelper;
     class D2RFormatDescriptor
     {
@@ -410,31 +564,31 @@ namespace d2ce
     class D2RBinReader
     {
     public:
-        static std::string readArmorBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readBeltsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readBodyLocsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readCharStatsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readExperienceBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readGemsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readHirelingBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readItemsCodeBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readItemStatCostBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readItemTypesBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readMagicAffixBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readMiscBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readMonStatsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readMonTypeBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readPlayerClassBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readPropertiesBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readQualityItemsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readRareAffixBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readRunesBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readSetItemsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readSetsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readSkillDescBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readSkillsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readUniqueItemsBin(const std::string& bin, const D2RModReaderHelper& parent);
-        static std::string readWeaponsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readArmorBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readBeltsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readBodyLocsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readCharStatsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readExperienceBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readGemsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readHirelingBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readItemsCodeBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readItemStatCostBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readItemTypesBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readMagicAffixBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readMiscBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readMonStatsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readMonTypeBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readPlayerClassBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readPropertiesBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readQualityItemsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readRareAffixBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readRunesBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readSetItemsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readSetsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readSkillDescBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readSkillsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readUniqueItemsBin(const std::string& bin, const D2RModReaderHelper& parent);
+        static BinTxtTablePtr readWeaponsBin(const std::string& bin, const D2RModReaderHelper& parent);
 
     private:
         static bool initializeItemTypesBin(const std::string& bin, const D2RModReaderHelper& parent);
@@ -520,11 +674,11 @@ namespace d2ce
             return lineNum >= 121 ? true : false;
         }
 
-        static std::string processBin(const char* data, size_t& length, const D2RFormatDescriptor& desc, const D2RModReaderHelper& parent, std::function<bool(const std::string&, size_t)>* pIsExpansion = nullptr)
+        static BinTxtTablePtr processBin(const char* data, size_t& length, const D2RFormatDescriptor& desc, const D2RModReaderHelper& parent, std::function<bool(const std::string&, size_t)>* pIsExpansion = nullptr)
         {
             if (data == nullptr || length < 4)
             {
-                return std::string();
+                return nullptr;
             }
 
             std::uint32_t numLines = 0;
@@ -535,25 +689,21 @@ namespace d2ce
             if (numLines == 0 || (numLines * desc.getLineByteSize() > length))
             {
                 // size mismatch
-                return std::string();
+                return nullptr;
             }
 
             // output header
-            std::stringstream ss;
-            bool bFirst = true;
             const auto& format = desc.getExcelFormat();
+            std::vector<std::string> columnNames;
+            columnNames.reserve(format.size());
             for (const auto& column : format)
             {
-                if (!bFirst)
-                {
-                    ss << "\t";
-                }
-                ss << column.header;
-                bFirst = false;
+                columnNames.push_back(column.header);
             }
-            ss << "\n";
+            auto table = std::make_shared<BinTxtTable>(columnNames);
 
-            std::stringstream ssExpansion;
+            std::vector<std::vector<std::string>> expansionRows;
+            std::vector<std::string> row;
             size_t verstionTestIdx = desc.getVersionTestIdx();
             bool bIsExpansion = false;
             bool bHasExpansionRows = false;
@@ -577,16 +727,10 @@ namespace d2ce
                     }
                 }
 
-                auto& ssRef = bIsExpansion ? ssExpansion : ss;
-
-                bFirst = true;
+                row.clear();
                 for (const auto& column : format)
                 {
                     strVal.clear();
-                    if (!bFirst)
-                    {
-                        ssRef << "\t";
-                    }
 
                     if (column.fake || column.pRowIDFunc != nullptr)
                     {
@@ -632,29 +776,32 @@ namespace d2ce
 
                     // trim trailing spaces
                     strVal.erase(std::find_if(strVal.rbegin(), strVal.rend(), [](int ch) { return !isspace(ch); }).base(), strVal.end());
-                    if (!strVal.empty())
-                    {
-                        ssRef << strVal;
-                    }
-                    bFirst = false;
+                    row.push_back(strVal);
+                }
+
+                if (bIsExpansion)
+                {
+                    expansionRows.push_back(row);
+                }
+                else
+                {
+                    table->addRow(row);
                 }
-                ssRef << "\n";
                 ++lineNum;
             }
 
             if (bHasExpansionRows)
             {
-                ss << "Expansion";
-                auto numCols = desc.numColumns();
-                if (numCols > 1)
+                // the expansion rows follow an "Expansion" separator row, like in the txt files
+                row.assign(1, "Expansion");
+                table->addRow(row);
+                for (const auto& expansionRow : expansionRows)
                 {
-                    ss << std::string(numCols - 1, '\t');
+                    table->addRow(expansionRow);
                 }
-                ss << "\n";
-                ss << ssExpansion.str();
             }
 
-            return ss.str();
+            return table;
         }
 
         static bool readLine(const char*& data, size_t& length, const D2RFormatDescriptor& desc, std::vector<std::string>& output, const D2RModReaderHelper& parent, size_t lineNum)
@@ -876,9 +1023,10 @@ namespace d2ce
         }
 
         std::unique_ptr<ITxtDocument> GetStringTxt() const;
+        std::unique_ptr<ITxtDocument> GetStringTxt(const std::set<std::string>& languages) const;
 
         // JsonReaderHelper
-        const std::string& GetItemGems()
+        EmbeddedText GetItemGems()
         {
             if (!LoadJsonText(strItemGems, "item-gems.json").empty())
             {
@@ -888,7 +1036,7 @@ namespace d2ce
             return JsonReaderHelper::GetItemGems();
         }
 
-        const std::string& GetItemModifiers()
+        EmbeddedText GetItemModifiers()
         {
             if (!LoadJsonText(strItemModifiers, "item-modifiers.json").empty())
             {
@@ -898,7 +1046,7 @@ namespace d2ce
             return JsonReaderHelper::GetItemModifiers();
         }
 
-        const std::string& GetItemNameAffixes()
+        EmbeddedText GetItemNameAffixes()
         {
             if (!LoadJsonText(strItemNameAffixes, "item-nameaffixes.json").empty())
             {
@@ -908,7 +1056,7 @@ namespace d2ce
             return JsonReaderHelper::GetItemNameAffixes();
         }
 
-        const std::string& GetItemNames()
+        EmbeddedText GetItemNames()
         {
             if (!LoadJsonText(strItemNames, "item-names.json").empty())
             {
@@ -918,7 +1066,7 @@ namespace d2ce
             return JsonReaderHelper::GetItemNames();
         }
 
-        const std::string& GetItemRunes()
+        EmbeddedText GetItemRunes()
         {
             if (!LoadJsonText(strItemRunes, "item-runes.json").empty())
             {
@@ -928,7 +1076,7 @@ namespace d2ce
             return JsonReaderHelper::GetItemRunes();
         }
 
-        const std::string& GetLevels()
+        EmbeddedText GetLevels()
         {
             if (!LoadJsonText(strLevels, "levels.json").empty())
             {
@@ -938,7 +1086,7 @@ namespace d2ce
             return JsonReaderHelper::GetLevels();
         }
 
-        const std::string& GetMercenaries()
+        EmbeddedText GetMercenaries()
         {
             if (!LoadJsonText(strMercenaries, "monsters.json").empty())
             {
@@ -948,7 +1096,7 @@ namespace d2ce
             return JsonReaderHelper::GetMercenaries();
         }
 
-        const std::string& GetMonsters()
+        EmbeddedText GetMonsters()
         {
             if (!LoadJsonText(strMonsters, "monsters.json").empty())
             {
@@ -958,7 +1106,7 @@ namespace d2ce
             return JsonReaderHelper::GetMonsters();
         }
 
-        const std::string& GetNPCs()
+        EmbeddedText GetNPCs()
         {
             if (!LoadJsonText(strNPCs, "npcs.json").empty())
             {
@@ -968,7 +1116,7 @@ namespace d2ce
             return JsonReaderHelper::GetNPCs();
         }
 
-        const std::string& GetQuests()
+        EmbeddedText GetQuests()
         {
             if (!LoadJsonText(strQuests, "quests.json").empty())
             {
@@ -978,7 +1126,7 @@ namespace d2ce
             return JsonReaderHelper::GetQuests();
         }
 
-        const std::string& GetSkills()
+        EmbeddedText GetSkills()
         {
             if (!LoadJsonText(strSkills, "skills.json").empty())
             {
@@ -988,7 +1136,7 @@ namespace d2ce
             return JsonReaderHelper::GetSkills();
         }
 
-        const std::string& GetUI()
+        EmbeddedText GetUI()
         {
             if (!LoadJsonText(strUI, "ui.json").empty())
             {
@@ -998,7 +1146,7 @@ namespace d2ce
             return JsonReaderHelper::GetUI();
         }
 
-        const std::string& GetBankExpansionLayout()
+        EmbeddedText GetBankExpansionLayout()
         {
             if (!LoadLayoutJsonText(strBankExpansionLayout, "bankexpansionlayouthd.json").empty())
             {
@@ -1008,7 +1156,7 @@ namespace d2ce
             return JsonReaderHelper::GetBankExpansionLayout();
         }
 
-        const std::string& GetHirelingInventoryPanel()
+        EmbeddedText GetHirelingInventoryPanel()
         {
             if (!LoadLayoutJsonText(strHirelingInventoryPanel, "hirelinginventorypanelhd.json").empty())
             {
@@ -1018,7 +1166,7 @@ namespace d2ce
             return JsonReaderHelper::GetBankExpansionLayout();
         }
 
-        const std::string& GetHoradricCubeLayout()
+        EmbeddedText GetHoradricCubeLayout()
         {
             if (!LoadLayoutJsonText(strHoradricCubeLayout, "horadriccubelayouthd.json").empty())
             {
@@ -1028,7 +1176,7 @@ namespace d2ce
             return JsonReaderHelper::GetHoradricCubeLayout();
         }
 
-        const std::string& GetPlayerInventoryExpansionLayout()
+        EmbeddedText GetPlayerInventoryExpansionLayout()
         {
             if (!LoadLayoutJsonText(strPlayerInventoryExpansionLayout, "playerinventoryoriginallayouthd.json").empty())
             {
@@ -1039,10 +1187,10 @@ namespace d2ce
         }
 
         // TxtReaderHelper
-        const std::string& GetArmor()
+        EmbeddedText GetArmor()
         {
             auto& strValue = strArmor;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binArmor != nullptr))
             {
                 return strValue;
             }
@@ -1052,18 +1200,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "armor.bin", D2RBinReader::readArmorBin).empty())
+            if (LoadExcelBin(binArmor, "armor.bin", D2RBinReader::readArmorBin))
             {
+                // served from the decoded cells by GetArmorDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetArmor();
         }
 
-        const std::string& GetBelts()
+        std::unique_ptr<ITxtDocument> GetArmorDoc()
+        {
+            return LoadTxtDocument(GetArmor(), binArmor);
+        }
+
+        EmbeddedText GetBelts()
         {
             auto& strValue = strBelts;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binBelts != nullptr))
             {
                 return strValue;
             }
@@ -1073,18 +1227,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "belts.bin", D2RBinReader::readBeltsBin).empty())
+            if (LoadExcelBin(binBelts, "belts.bin", D2RBinReader::readBeltsBin))
             {
+                // served from the decoded cells by GetBeltsDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetBelts();
         }
 
-        const std::string& GetBodyLocs()
+        std::unique_ptr<ITxtDocument> GetBeltsDoc()
+        {
+            return LoadTxtDocument(GetBelts(), binBelts);
+        }
+
+        EmbeddedText GetBodyLocs()
         {
             auto& strValue = strBodyLocs;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binBodyLocs != nullptr))
             {
                 return strValue;
             }
@@ -1094,18 +1254,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "bodylocs.bin", D2RBinReader::readBodyLocsBin).empty())
+            if (LoadExcelBin(binBodyLocs, "bodylocs.bin", D2RBinReader::readBodyLocsBin))
             {
+                // served from the decoded cells by GetBodyLocsDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetBodyLocs();
         }
 
-        const std::string& GetCharStats()
+        std::unique_ptr<ITxtDocument> GetBodyLocsDoc()
+        {
+            return LoadTxtDocument(GetBodyLocs(), binBodyLocs);
+        }
+
+        EmbeddedText GetCharStats()
         {
             auto& strValue = strCharStats;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binCharStats != nullptr))
             {
                 return strValue;
             }
@@ -1115,18 +1281,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "charstats.bin", D2RBinReader::readCharStatsBin).empty())
+            if (LoadExcelBin(binCharStats, "charstats.bin", D2RBinReader::readCharStatsBin))
             {
+                // served from the decoded cells by GetCharStatsDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetCharStats();
         }
 
-        const std::string& GetExperience()
+        std::unique_ptr<ITxtDocument> GetCharStatsDoc()
+        {
+            return LoadTxtDocument(GetCharStats(), binCharStats);
+        }
+
+        EmbeddedText GetExperience()
         {
             auto& strValue = strExperience;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binExperience != nullptr))
             {
                 return strValue;
             }
@@ -1136,18 +1308,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "experience.bin", D2RBinReader::readExperienceBin).empty())
+            if (LoadExcelBin(binExperience, "experience.bin", D2RBinReader::readExperienceBin))
             {
+                // served from the decoded cells by GetExperienceDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetExperience();
         }
 
-        const std::string& GetGems()
+        std::unique_ptr<ITxtDocument> GetExperienceDoc()
+        {
+            return LoadTxtDocument(GetExperience(), binExperience);
+        }
+
+        EmbeddedText GetGems()
         {
             auto& strValue = strGems;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binGems != nullptr))
             {
                 return strValue;
             }
@@ -1157,18 +1335,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "gems.bin", D2RBinReader::readGemsBin).empty())
+            if (LoadExcelBin(binGems, "gems.bin", D2RBinReader::readGemsBin))
             {
+                // served from the decoded cells by GetGemsDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetGems();
         }
 
-        const std::string& GetHireling()
+        std::unique_ptr<ITxtDocument> GetGemsDoc()
+        {
+            return LoadTxtDocument(GetGems(), binGems);
+        }
+
+        EmbeddedText GetHireling()
         {
             auto& strValue = strHireling;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binHireling != nullptr))
             {
                 return strValue;
             }
@@ -1178,18 +1362,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "hireling.bin", D2RBinReader::readHirelingBin).empty())
+            if (LoadExcelBin(binHireling, "hireling.bin", D2RBinReader::readHirelingBin))
             {
+                // served from the decoded cells by GetHirelingDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetHireling();
         }
 
-        const std::string& GetItemStatCost()
+        std::unique_ptr<ITxtDocument> GetHirelingDoc()
+        {
+            return LoadTxtDocument(GetHireling(), binHireling);
+        }
+
+        EmbeddedText GetItemStatCost()
         {
             auto& strValue = strItemStatCost;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binItemStatCost != nullptr))
             {
                 return strValue;
             }
@@ -1199,34 +1389,46 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "itemstatcost.bin", D2RBinReader::readItemStatCostBin).empty())
+            if (LoadExcelBin(binItemStatCost, "itemstatcost.bin", D2RBinReader::readItemStatCostBin))
             {
+                // served from the decoded cells by GetItemStatCostDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetItemStatCost();
         }
 
-        const std::string& GetItemsCode()
+        std::unique_ptr<ITxtDocument> GetItemStatCostDoc()
+        {
+            return LoadTxtDocument(GetItemStatCost(), binItemStatCost);
+        }
+
+        EmbeddedText GetItemsCode()
         {
             auto& strValue = strItemsCode;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binItemsCode != nullptr))
             {
                 return strValue;
             }
 
-            if (!LoadExcelItemsCodeBinText(strValue).empty())
+            if (LoadExcelItemsCodeBin(binItemsCode))
             {
+                // served from the decoded cells by GetItemsCodeDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetItemsCode();
         }
 
-        const std::string& GetItemTypes()
+        std::unique_ptr<ITxtDocument> GetItemsCodeDoc()
+        {
+            return LoadTxtDocument(GetItemsCode(), binItemsCode);
+        }
+
+        EmbeddedText GetItemTypes()
         {
             auto& strValue = strItemTypes;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binItemTypes != nullptr))
             {
                 return strValue;
             }
@@ -1236,18 +1438,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "itemtypes.bin", D2RBinReader::readItemTypesBin).empty())
+            if (LoadExcelBin(binItemTypes, "itemtypes.bin", D2RBinReader::readItemTypesBin))
             {
+                // served from the decoded cells by GetItemTypesDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetItemTypes();
         }
 
-        const std::string& GetMagicPrefix()
+        std::unique_ptr<ITxtDocument> GetItemTypesDoc()
+        {
+            return LoadTxtDocument(GetItemTypes(), binItemTypes);
+        }
+
+        EmbeddedText GetMagicPrefix()
         {
             auto& strValue = strMagicPrefix;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binMagicPrefix != nullptr))
             {
                 return strValue;
             }
@@ -1257,18 +1465,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "magicprefix.bin", D2RBinReader::readMagicAffixBin).empty())
+            if (LoadExcelBin(binMagicPrefix, "magicprefix.bin", D2RBinReader::readMagicAffixBin))
             {
+                // served from the decoded cells by GetMagicPrefixDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetMagicPrefix();
         }
 
-        const std::string& GetMagicSuffix()
+        std::unique_ptr<ITxtDocument> GetMagicPrefixDoc()
+        {
+            return LoadTxtDocument(GetMagicPrefix(), binMagicPrefix);
+        }
+
+        EmbeddedText GetMagicSuffix()
         {
             auto& strValue = strMagicSuffix;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binMagicSuffix != nullptr))
             {
                 return strValue;
             }
@@ -1278,18 +1492,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "magicsuffix.bin", D2RBinReader::readMagicAffixBin).empty())
+            if (LoadExcelBin(binMagicSuffix, "magicsuffix.bin", D2RBinReader::readMagicAffixBin))
             {
+                // served from the decoded cells by GetMagicSuffixDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetMagicSuffix();
         }
 
-        const std::string& GetMisc()
+        std::unique_ptr<ITxtDocument> GetMagicSuffixDoc()
+        {
+            return LoadTxtDocument(GetMagicSuffix(), binMagicSuffix);
+        }
+
+        EmbeddedText GetMisc()
         {
             auto& strValue = strMisc;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binMisc != nullptr))
             {
                 return strValue;
             }
@@ -1299,18 +1519,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "misc.bin", D2RBinReader::readMiscBin).empty())
+            if (LoadExcelBin(binMisc, "misc.bin", D2RBinReader::readMiscBin))
             {
+                // served from the decoded cells by GetMiscDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetMisc();
         }
 
-        const std::string& GetPlayerClass()
+        std::unique_ptr<ITxtDocument> GetMiscDoc()
+        {
+            return LoadTxtDocument(GetMisc(), binMisc);
+        }
+
+        EmbeddedText GetPlayerClass()
         {
             auto& strValue = strPlayerClass;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binPlayerClass != nullptr))
             {
                 return strValue;
             }
@@ -1320,18 +1546,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "playerclass.bin", D2RBinReader::readPlayerClassBin).empty())
+            if (LoadExcelBin(binPlayerClass, "playerclass.bin", D2RBinReader::readPlayerClassBin))
             {
+                // served from the decoded cells by GetPlayerClassDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetPlayerClass();
         }
 
-        const std::string& GetProperties()
+        std::unique_ptr<ITxtDocument> GetPlayerClassDoc()
+        {
+            return LoadTxtDocument(GetPlayerClass(), binPlayerClass);
+        }
+
+        EmbeddedText GetProperties()
         {
             auto& strValue = strProperties;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binProperties != nullptr))
             {
                 return strValue;
             }
@@ -1341,18 +1573,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "properties.bin", D2RBinReader::readPropertiesBin).empty())
+            if (LoadExcelBin(binProperties, "properties.bin", D2RBinReader::readPropertiesBin))
             {
+                // served from the decoded cells by GetPropertiesDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetProperties();
         }
 
-        const std::string& GetRarePrefix()
+        std::unique_ptr<ITxtDocument> GetPropertiesDoc()
+        {
+            return LoadTxtDocument(GetProperties(), binProperties);
+        }
+
+        EmbeddedText GetRarePrefix()
         {
             auto& strValue = strRarePrefix;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binRarePrefix != nullptr))
             {
                 return strValue;
             }
@@ -1362,18 +1600,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "rareprefix.bin", D2RBinReader::readRareAffixBin).empty())
+            if (LoadExcelBin(binRarePrefix, "rareprefix.bin", D2RBinReader::readRareAffixBin))
             {
+                // served from the decoded cells by GetRarePrefixDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetRarePrefix();
         }
 
-        const std::string& GetRareSuffix()
+        std::unique_ptr<ITxtDocument> GetRarePrefixDoc()
+        {
+            return LoadTxtDocument(GetRarePrefix(), binRarePrefix);
+        }
+
+        EmbeddedText GetRareSuffix()
         {
             auto& strValue = strRareSuffix;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binRareSuffix != nullptr))
             {
                 return strValue;
             }
@@ -1383,18 +1627,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "raresuffix.bin", D2RBinReader::readRareAffixBin).empty())
+            if (LoadExcelBin(binRareSuffix, "raresuffix.bin", D2RBinReader::readRareAffixBin))
             {
+                // served from the decoded cells by GetRareSuffixDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetRareSuffix();
         }
 
-        const std::string& GetRunes()
+        std::unique_ptr<ITxtDocument> GetRareSuffixDoc()
+        {
+            return LoadTxtDocument(GetRareSuffix(), binRareSuffix);
+        }
+
+        EmbeddedText GetRunes()
         {
             auto& strValue = strRunes;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binRunes != nullptr))
             {
                 return strValue;
             }
@@ -1404,18 +1654,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "runes.bin", D2RBinReader::readRunesBin).empty())
+            if (LoadExcelBin(binRunes, "runes.bin", D2RBinReader::readRunesBin))
             {
+                // served from the decoded cells by GetRunesDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetRunes();
         }
 
-        const std::string& GetSetItems()
+        std::unique_ptr<ITxtDocument> GetRunesDoc()
+        {
+            return LoadTxtDocument(GetRunes(), binRunes);
+        }
+
+        EmbeddedText GetSetItems()
         {
             auto& strValue = strSetItems;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binSetItems != nullptr))
             {
                 return strValue;
             }
@@ -1425,18 +1681,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "setitems.bin", D2RBinReader::readSetItemsBin).empty())
+            if (LoadExcelBin(binSetItems, "setitems.bin", D2RBinReader::readSetItemsBin))
             {
+                // served from the decoded cells by GetSetItemsDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetSetItems();
         }
 
-        const std::string& GetSets()
+        std::unique_ptr<ITxtDocument> GetSetItemsDoc()
+        {
+            return LoadTxtDocument(GetSetItems(), binSetItems);
+        }
+
+        EmbeddedText GetSets()
         {
             auto& strValue = strSets;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binSets != nullptr))
             {
                 return strValue;
             }
@@ -1446,18 +1708,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "sets.bin", D2RBinReader::readSetsBin).empty())
+            if (LoadExcelBin(binSets, "sets.bin", D2RBinReader::readSetsBin))
             {
+                // served from the decoded cells by GetSetsDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetSets();
         }
 
-        const std::string& GetSkillDesc()
+        std::unique_ptr<ITxtDocument> GetSetsDoc()
+        {
+            return LoadTxtDocument(GetSets(), binSets);
+        }
+
+        EmbeddedText GetSkillDesc()
         {
             auto& strValue = strSkillDesc;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binSkillDesc != nullptr))
             {
                 return strValue;
             }
@@ -1467,18 +1735,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "skilldesc.bin", D2RBinReader::readSkillDescBin).empty())
+            if (LoadExcelBin(binSkillDesc, "skilldesc.bin", D2RBinReader::readSkillDescBin))
             {
+                // served from the decoded cells by GetSkillDescDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetSkillDesc();
         }
 
-        const std::string& GetSkillsTxt()
+        std::unique_ptr<ITxtDocument> GetSkillDescDoc()
+        {
+            return LoadTxtDocument(GetSkillDesc(), binSkillDesc);
+        }
+
+        EmbeddedText GetSkillsTxt()
         {
             auto& strValue = strSkillsTxt;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binSkillsTxt != nullptr))
             {
                 return strValue;
             }
@@ -1488,18 +1762,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "skills.bin", D2RBinReader::readSkillsBin).empty())
+            if (LoadExcelBin(binSkillsTxt, "skills.bin", D2RBinReader::readSkillsBin))
             {
+                // served from the decoded cells by GetSkillsTxtDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetSkills();
         }
 
-        const std::string& GetUniqueItems()
+        std::unique_ptr<ITxtDocument> GetSkillsTxtDoc()
+        {
+            return LoadTxtDocument(GetSkillsTxt(), binSkillsTxt);
+        }
+
+        EmbeddedText GetUniqueItems()
         {
             auto& strValue = strUniqueItems;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binUniqueItems != nullptr))
             {
                 return strValue;
             }
@@ -1509,18 +1789,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "uniqueitems.bin", D2RBinReader::readUniqueItemsBin).empty())
+            if (LoadExcelBin(binUniqueItems, "uniqueitems.bin", D2RBinReader::readUniqueItemsBin))
             {
+                // served from the decoded cells by GetUniqueItemsDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetUniqueItems();
         }
 
-        const std::string& GetWeapons()
+        std::unique_ptr<ITxtDocument> GetUniqueItemsDoc()
+        {
+            return LoadTxtDocument(GetUniqueItems(), binUniqueItems);
+        }
+
+        EmbeddedText GetWeapons()
         {
             auto& strValue = strWeapons;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binWeapons != nullptr))
             {
                 return strValue;
             }
@@ -1530,18 +1816,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "weapons.bin", D2RBinReader::readWeaponsBin).empty())
+            if (LoadExcelBin(binWeapons, "weapons.bin", D2RBinReader::readWeaponsBin))
             {
+                // served from the decoded cells by GetWeaponsDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetWeapons();
         }
 
-        const std::string& GetMonStats()
+        std::unique_ptr<ITxtDocument> GetWeaponsDoc()
+        {
+            return LoadTxtDocument(GetWeapons(), binWeapons);
+        }
+
+        EmbeddedText GetMonStats()
         {
             auto& strValue = strMonStats;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binMonStats != nullptr))
             {
                 return strValue;
             }
@@ -1551,18 +1843,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "monstats.bin", D2RBinReader::readMonStatsBin).empty())
+            if (LoadExcelBin(binMonStats, "monstats.bin", D2RBinReader::readMonStatsBin))
             {
+                // served from the decoded cells by GetMonStatsDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetMonStats();
         }
 
-        const std::string& GetMonType()
+        std::unique_ptr<ITxtDocument> GetMonStatsDoc()
+        {
+            return LoadTxtDocument(GetMonStats(), binMonStats);
+        }
+
+        EmbeddedText GetMonType()
         {
             auto& strValue = strMonType;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binMonType != nullptr))
             {
                 return strValue;
             }
@@ -1572,18 +1870,24 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "montype.bin", D2RBinReader::readMonTypeBin).empty())
+            if (LoadExcelBin(binMonType, "montype.bin", D2RBinReader::readMonTypeBin))
             {
+                // served from the decoded cells by GetMonTypeDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetMonType();
         }
 
-        const std::string& GetSuperiorModsTxt()
+        std::unique_ptr<ITxtDocument> GetMonTypeDoc()
+        {
+            return LoadTxtDocument(GetMonType(), binMonType);
+        }
+
+        EmbeddedText GetSuperiorModsTxt()
         {
             auto& strValue = strSuperiorModsTxt;
-            if (!strValue.empty())
+            if (!strValue.empty() || (binSuperiorModsTxt != nullptr))
             {
                 return strValue;
             }
@@ -1593,20 +1897,26 @@ namespace d2ce
                 return strValue;
             }
 
-            if (!LoadExcelBinText(strValue, "qualityitems.bin", D2RBinReader::readQualityItemsBin).empty())
+            if (LoadExcelBin(binSuperiorModsTxt, "qualityitems.bin", D2RBinReader::readQualityItemsBin))
             {
+                // served from the decoded cells by GetSuperiorModsTxtDoc
                 return strValue;
             }
 
             return TxtReaderHelper::GetSuperiorModsTxt();
         }
 
-        const std::string& GetCraftModsTxt()
+        std::unique_ptr<ITxtDocument> GetSuperiorModsTxtDoc()
+        {
+            return LoadTxtDocument(GetSuperiorModsTxt(), binSuperiorModsTxt);
+        }
+
+        EmbeddedText GetCraftModsTxt()
         {
             return TxtReaderHelper::GetCraftModsTxt();
         }
 
-        const std::string& GetGridDimensionsTxt()
+        EmbeddedText GetGridDimensionsTxt()
         {
             auto& strValue = strGridDimensionsTxt;
             if (!strValue.empty())
@@ -1680,7 +1990,7 @@ namespace d2ce
             return TxtReaderHelper::GetMercInventoryTxt();
         }
         
-        const std::string& GetMercInventoryTxt()
+        EmbeddedText GetMercInventoryTxt()
         {
             auto& strValue = strMercInventoryTxt;
             if (!strValue.empty())
@@ -1834,16 +2144,26 @@ namespace d2ce
             const rapidcsv::LineReaderParams& pLineReaderParams = rapidcsv::LineReaderParams(),
             size_t idx = 0) const
         {
-            std::istringstream stream(f);
+            EmbeddedTextStream stream(f);
             return std::make_unique<CsvTxtDocument>(stream, pLabelParams, pSeparatorParams, pConverterParams, pLineReaderParams, idx);
         }
 
+        std::unique_ptr<ITxtDocument> LoadTxtDocument(const EmbeddedText& excelStr, const BinTxtTablePtr& excelBin) const
+        {
+            if (excelBin != nullptr)
+            {
+                return std::make_unique<BinTxtDocument>(excelBin);
+            }
+
+            return LoadTxtStream(excelStr);
+        }
+
         void processBodyLocs()
         {
             // we need to map id to excel code column string
             if (bodyLocsMap.empty())
             {
-                auto pDoc = LoadTxtStream(GetBodyLocs());
+                auto pDoc = GetBodyLocsDoc();
                 std::uint32_t numRows = std::uint32_t(pDoc->GetRowCount());
                 const SSIZE_T codeColumnIdx = pDoc->GetColumnIdx("Code");
                 if (codeColumnIdx < 0)
@@ -1862,7 +2182,7 @@ namespace d2ce
         {
             if (calcExpressionMap.empty())
             {
-                auto pDoc = LoadTxtStream(GetItemsCode());
+                auto pDoc = GetItemsCodeDoc();
                 std::uint32_t numRows = std::uint32_t(pDoc->GetRowCount());
                 const SSIZE_T offsetColumnIdx = pDoc->GetColumnIdx("offset");
                 if (offsetColumnIdx < 0)
@@ -1904,7 +2224,7 @@ namespace d2ce
             // we need to map id to excel code column string
             if (stringTxtInfo.empty())
             {
-                auto pDoc = GetStringTxt();
+                auto pDoc = GetStringTxt({ "enUS" });
                 if (pDoc == nullptr)
                 {
                     return;
@@ -1995,7 +2315,7 @@ namespace d2ce
             // we need to map id to excel code column string
             if (itemStatMap.empty())
             {
-                auto pDoc = LoadTxtStream(GetItemStatCost());
+                auto pDoc = GetItemStatCostDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2080,7 +2400,7 @@ namespace d2ce
             if (itemTypeMap.empty())
             {
                 // we need to map id to excel type column string
-                auto pDoc = LoadTxtStream(GetItemTypes());
+                auto pDoc = GetItemTypesDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2114,7 +2434,7 @@ namespace d2ce
                 std::uint32_t id = 0;
 
                 // we need to map id to excel type column string
-                auto pDoc = LoadTxtStream(GetWeapons());
+                auto pDoc = GetWeaponsDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2155,7 +2475,7 @@ namespace d2ce
                     ++id;
                 }
 
-                pDoc = LoadTxtStream(GetArmor());
+                pDoc = GetArmorDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2194,7 +2514,7 @@ namespace d2ce
                     ++id;
                 }
 
-                pDoc = LoadTxtStream(GetMisc());
+                pDoc = GetMiscDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2283,7 +2603,7 @@ namespace d2ce
             if (propertyCodeMap.empty())
             {
                 // we need to map id to excel code column string
-                auto pDoc = LoadTxtStream(GetProperties());
+                auto pDoc = GetPropertiesDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2325,7 +2645,7 @@ namespace d2ce
             if (setsMap.empty())
             {
                 // we need to map id to excel code column string
-                auto pDoc = LoadTxtStream(GetSets());
+                auto pDoc = GetSetsDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2379,7 +2699,7 @@ namespace d2ce
             if (skillsMap.empty())
             {
                 // we need to map id to excel code column string
-                auto pDoc = LoadTxtStream(GetSkillsTxt());
+                auto pDoc = GetSkillsTxtDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2470,7 +2790,7 @@ namespace d2ce
             if (skillDescMap.empty())
             {
                 // we need to map id to excel code column string
-                auto pDoc = LoadTxtStream(GetSkillDesc());
+                auto pDoc = GetSkillDescDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2510,7 +2830,7 @@ namespace d2ce
             if (playerClassCodeMap.empty())
             {
                 // we need to map id to excel code column string
-                auto pDoc = LoadTxtStream(GetPlayerClass());
+                auto pDoc = GetPlayerClassDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2579,7 +2899,7 @@ namespace d2ce
             // we need to map id to excel type column string
             if (itemMonTypeMap.empty())
             {
-                auto pDoc = LoadTxtStream(GetMonType());
+                auto pDoc = GetMonTypeDoc();
                 if (pDoc == nullptr)
                 {
                     return;
@@ -2753,43 +3073,16 @@ namespace d2ce
             return excelStr;
         }
 
-        std::string& LoadExcelItemsCodeBinText(std::string& excelStr)
+        bool LoadExcelItemsCodeBin(BinTxtTablePtr& excelBin)
         {
-            if (!excelStr.empty() || modPath.empty())
-            {
-                return excelStr;
-            }
-
-            std::string binText;
-            if (hMpq != NULL)
-            {
-                std::stringstream ss;
-                binText = LoadTextFromMpq("data\\global\\excel\\itemscode.bin");
-                if (binText.empty())
-                {
-                    return excelStr;
-                }
-
-                excelStr = D2RBinReader::readItemsCodeBin(binText, *this);
-                return excelStr;
-            }
-
-            if (modExcelPath.empty())
-            {
-                return excelStr;
-            }
-
-            std::filesystem::path path = modExcelPath / "itemscode.bin";
-            binText = LoadTextFromFile(path);
-            excelStr = D2RBinReader::readItemsCodeBin(binText, *this);
-            return excelStr;
+            return LoadExcelBin(excelBin, "itemscode.bin", D2RBinReader::readItemsCodeBin);
         }
 
-        std::string& LoadExcelBinText(std::string& excelStr, const std::string& excelFileName, std::function<std::string(const std::string&, const D2RModReaderHelper&)> binReader)
+        bool LoadExcelBin(BinTxtTablePtr& excelBin, const std::string& excelFileName, std::function<BinTxtTablePtr(const std::string&, const D2RModReaderHelper&)> binReader)
         {
-            if (!excelStr.empty() || modPath.empty())
+            if ((excelBin != nullptr) || modPath.empty())
             {
-                return excelStr;
+                return (excelBin != nullptr) ? true : false;
             }
 
             std::string binText;
@@ -2801,22 +3094,22 @@ namespace d2ce
                 binText = LoadTextFromMpq(ss.str());
                 if (binText.empty())
                 {
-                    return excelStr;
+                    return false;
                 }
 
-                excelStr = binReader(binText, *this);
-                return excelStr;
+                excelBin = binReader(binText, *this);
+                return (excelBin != nullptr) ? true : false;
             }
 
             if (modExcelPath.empty())
             {
-                return excelStr;
+                return false;
             }
 
             std::filesystem::path path = modExcelPath / excelFileName;
             binText = LoadTextFromFile(path);
-            excelStr = binReader(binText, *this);
-            return excelStr;
+            excelBin = binReader(binText, *this);
+            return (excelBin != nullptr) ? true : false;
         }
 
         static std::string LoadTextFromFile(const std::filesystem::path& path)
@@ -2924,7 +3217,36 @@ namespace d2ce
         std::string strItemsCode;
         std::string strGridDimensionsTxt;
         std::string strMercInventoryTxt;
-        
+
+        // decoded .bin tables, a table is loaded from the .bin file only if the mod has no .txt file for it
+        BinTxtTablePtr binArmor;
+        BinTxtTablePtr binBelts;
+        BinTxtTablePtr binBodyLocs;
+        BinTxtTablePtr binCharStats;
+        BinTxtTablePtr binExperience;
+        BinTxtTablePtr binGems;
+        BinTxtTablePtr binHireling;
+        BinTxtTablePtr binItemStatCost;
+        BinTxtTablePtr binItemsCode;
+        BinTxtTablePtr binItemTypes;
+        BinTxtTablePtr binMagicPrefix;
+        BinTxtTablePtr binMagicSuffix;
+        BinTxtTablePtr binMisc;
+        BinTxtTablePtr binPlayerClass;
+        BinTxtTablePtr binProperties;
+        BinTxtTablePtr binRarePrefix;
+        BinTxtTablePtr binRareSuffix;
+        BinTxtTablePtr binRunes;
+        BinTxtTablePtr binSetItems;
+        BinTxtTablePtr binSets;
+        BinTxtTablePtr binSkillDesc;
+        BinTxtTablePtr binSkillsTxt;
+        BinTxtTablePtr binUniqueItems;
+        BinTxtTablePtr binWeapons;
+        BinTxtTablePtr binMonStats;
+        BinTxtTablePtr binMonType;
+        BinTxtTablePtr binSuperiorModsTxt;
+
         std::map<std::uint32_t, std::string> stringTxtInfo;
         std::map<std::string, std::string> stringEnTxtByKey;
         std::map<std::uint32_t, std::string> itemTypeMap;
@@ -2945,11 +3267,11 @@ namespace d2ce
         std::map<std::uint32_t, std::string> calcExpressionMap;
     };
 
-    std::string D2RBinReader::readArmorBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readArmorBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -2976,11 +3298,11 @@ namespace d2ce
         return processBin(data, length, desc, parent, &isExpansionRow);
     }
 
-    std::string D2RBinReader::readBeltsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readBeltsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         auto data = bin.c_str();
@@ -2990,11 +3312,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readBodyLocsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readBodyLocsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3011,11 +3333,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readCharStatsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readCharStatsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3039,11 +3361,11 @@ namespace d2ce
         return processBin(data, length, desc, parent, &isExpansionRow);
     }
 
-    std::string D2RBinReader::readExperienceBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readExperienceBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         static std::function<std::string(std::uint32_t, const D2RModReaderHelper&, size_t)> experienceLevelFunc = std::function<std::string(std::uint32_t, const D2RModReaderHelper&, size_t)>(D2RBinReader::processExperienceLevel);
@@ -3056,11 +3378,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readGemsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readGemsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3091,11 +3413,11 @@ namespace d2ce
         return processBin(data, length, desc, parent, &isExpansionRow);
     }
     
-    std::string D2RBinReader::readHirelingBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readHirelingBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3127,15 +3449,15 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readItemsCodeBin(const std::string& bin, const D2RModReaderHelper& /*parent*/)
+    BinTxtTablePtr D2RBinReader::readItemsCodeBin(const std::string& bin, const D2RModReaderHelper& /*parent*/)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
-        std::stringstream ss;
-        ss << "offset\tcode\n";
+        auto table = std::make_shared<BinTxtTable>(std::vector<std::string>{ "offset", "code" });
+        std::vector<std::string> output(2);
 
         auto data = bin.c_str();
         auto length = bin.length();
@@ -3159,7 +3481,7 @@ namespace d2ce
             case 0x04: // byte
                 if (length < 1)
                 {
-                    return std::string();
+                    return nullptr;
                 }
                 {
                     std::stringstream ss2;
@@ -3173,7 +3495,7 @@ namespace d2ce
             case 0x07:  // byte
                 if (length < 1)
                 {
-                    return std::string();
+                    return nullptr;
                 }
                 stack.push(*(std::uint8_t*)(&data[0]));
                 ++data;
@@ -3183,7 +3505,7 @@ namespace d2ce
             case 0x08: // short
                 if (length < 2)
                 {
-                    return std::string();
+                    return nullptr;
                 }
                 stack.push(*(std::uint16_t*)(&data[0]));
                 data += 2;
@@ -3193,7 +3515,7 @@ namespace d2ce
             case 0x09: // int
                 if (length < 4)
                 {
-                    return std::string();
+                    return nullptr;
                 }
                 stack.push(*(std::uint32_t*)(&data[0]));
                 data += 4;
@@ -3203,10 +3525,11 @@ namespace d2ce
             case 0x00:
                 if (stack.size() != 1)
                 {
-                    return std::string();
+                    return nullptr;
                 }
-                ss << offset << "\t";
-                ss << processExpressionStack(stack) << "\n";
+                output[0] = std::to_string(offset);
+                output[1] = processExpressionStack(stack);
+                table->addRow(output);
                 if (length == 1 && data[0] == 0)
                 {
                     // we are at the end
@@ -3218,7 +3541,7 @@ namespace d2ce
             case 0x01:
                 if (length < 1)
                 {
-                    return std::string();
+                    return nullptr;
                 }
 
                 operatorCode = data[0];
@@ -3227,7 +3550,7 @@ namespace d2ce
 
                 if (stack.size() < 2)
                 {
-                    return std::string();
+                    return nullptr;
                 }
 
                 {
@@ -3255,21 +3578,21 @@ namespace d2ce
                         break;
 
                     default:
-                        return std::string();
+                        return nullptr;
                     }
                 }
                 break;
             }
         }
 
-        return ss.str();
+        return table;
     }
 
-    std::string D2RBinReader::readItemStatCostBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readItemStatCostBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3294,11 +3617,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readItemTypesBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readItemTypesBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty() || !initializeItemTypesBin(bin, parent))
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3323,11 +3646,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readMagicAffixBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readMagicAffixBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3357,11 +3680,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readMiscBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readMiscBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3394,11 +3717,11 @@ namespace d2ce
         return processBin(data, length, desc, parent, &isExpansionRow);
     }
 
-    std::string D2RBinReader::readMonStatsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readMonStatsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3424,11 +3747,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readMonTypeBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readMonTypeBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3447,11 +3770,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readPlayerClassBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readPlayerClassBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         static std::function<bool(const std::string&, size_t)> isExpansionRow = std::function<bool(const std::string&, size_t)>(D2RBinReader::isExpansionPlayerClass);
@@ -3465,11 +3788,11 @@ namespace d2ce
         return processBin(data, length, desc, parent, &isExpansionRow);
     }
 
-    std::string D2RBinReader::readPropertiesBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readPropertiesBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3499,11 +3822,11 @@ namespace d2ce
         return processBin(data, length, desc, parent, &isExpansionRow);
     }
 
-    std::string D2RBinReader::readQualityItemsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readQualityItemsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3524,11 +3847,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readRareAffixBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readRareAffixBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3550,11 +3873,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readRunesBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readRunesBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3590,11 +3913,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readSetItemsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readSetItemsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3631,11 +3954,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readSetsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readSetsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3669,11 +3992,11 @@ namespace d2ce
         return processBin(data, length, desc, parent, &isExpansionRow);
     }
 
-    std::string D2RBinReader::readSkillDescBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readSkillDescBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3705,14 +4028,14 @@ namespace d2ce
         auto length = bin.length(); static std::vector<D2RFormatDescriptor::D2RExcelFormat> format = { {"skill", 1}, {"*Id", 0}
         };
         static D2RFormatDescriptor desc("wa34x632", format);
-        std::string result = processBin(data, length, desc, parent);
-        if (result.empty())
+        auto result = processBin(data, length, desc, parent);
+        if (result == nullptr)
         {
             return false;
         }
 
         // we need to map id to excel type column string
-        auto pDoc = parent.LoadTxtStream(result);
+        auto pDoc = std::make_unique<BinTxtDocument>(result);
         std::uint32_t numRows = std::uint32_t(pDoc->GetRowCount());
         const SSIZE_T skillColumnIdx = pDoc->GetColumnIdx("skill");
         if (skillColumnIdx < 0)
@@ -3751,11 +4074,11 @@ namespace d2ce
         return true;
     }
 
-    std::string D2RBinReader::readSkillsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readSkillsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty() || !initializeSkillsBin(bin, parent))
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3777,11 +4100,11 @@ namespace d2ce
         return processBin(data, length, desc, parent);
     }
 
-    std::string D2RBinReader::readUniqueItemsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readUniqueItemsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3815,11 +4138,11 @@ namespace d2ce
         return processBin(data, length, desc, parent, &isExpansionRow);
     }
 
-    std::string D2RBinReader::readWeaponsBin(const std::string& bin, const D2RModReaderHelper& parent)
+    BinTxtTablePtr D2RBinReader::readWeaponsBin(const std::string& bin, const D2RModReaderHelper& parent)
     {
         if (bin.empty())
         {
-            return std::string();
+            return nullptr;
         }
 
         {
@@ -3857,14 +4180,14 @@ namespace d2ce
         auto length = bin.length();
         static std::vector<D2RFormatDescriptor::D2RExcelFormat> format = { {"Code", 0 } };
         static D2RFormatDescriptor desc("a4x224", format);
-        std::string result = processBin(data, length, desc, parent);
-        if (result.empty())
+        auto result = processBin(data, length, desc, parent);
+        if (result == nullptr)
         {
             return false;
         }
 
         // we need to map id to excel type column string
-        auto pDoc = parent.LoadTxtStream(result);
+        auto pDoc = std::make_unique<BinTxtDocument>(result);
         std::uint32_t numRows = std::uint32_t(pDoc->GetRowCount());
         const SSIZE_T codeColumnIdx = pDoc->GetColumnIdx("Code");
         if (codeColumnIdx < 0)
@@ -4526,16 +4849,18 @@ namespace d2ce
     {
         std::string colId = "id";
         std::vector<std::string> columnNames;
+        std::set<std::string> languages; // language columns to keep, empty to keep all of them
         std::vector<std::string> rowNames;
-        mutable std::map<std::string, std::map<std::string, std::string>> colValues;
+        std::map<std::string, size_t> rowIdxMap;
+        mutable std::vector<std::map<std::string, std::string>> rowValues;
 
     public:
-        JsonStringsDocument()
+        JsonStringsDocument(const std::set<std::string>& langs = std::set<std::string>()) : languages(langs)
         {
             LoadAllJson();
         }
 
-        JsonStringsDocument(D2RModReaderHelper& jsonReader)
+        JsonStringsDocument(D2RModReaderHelper& jsonReader, const std::set<std::string>& langs = std::set<std::string>()) : languages(langs)
         {
             LoadAllJson(jsonReader);
         }
@@ -4578,7 +4903,7 @@ namespace d2ce
 
         std::string GetCellString(size_t pColumnIdx, size_t pRowIdx) const override
         {
-            const auto& row = colValues.at(rowNames.at(pRowIdx));
+            const auto& row = rowValues.at(pRowIdx);
             auto iter = row.find(columnNames.at(pColumnIdx));
             if (iter == row.end())
             {
@@ -4593,7 +4918,7 @@ namespace d2ce
             const auto& colName = columnNames.at(pColumnIdx);
             if (colName == colId)
             {
-                const auto& row = colValues.at(rowNames.at(pRowIdx));
+                const auto& row = rowValues.at(pRowIdx);
                 auto iter = row.find(columnNames.at(pColumnIdx));
                 if (iter == row.end())
                 {
@@ -4634,7 +4959,7 @@ namespace d2ce
             }
 
             auto id = GetCellUInt32(colIdx, rowIdx);
-            auto& row = colValues.at(index);
+            auto& row = rowValues.at(rowIdx);
             if (row.empty())
             {
                 return MAXSIZE_T;
@@ -4665,9 +4990,17 @@ namespace d2ce
                 return false;
             }
 
-            std::string strValue;
-            rowNames.push_back(rowKey.asString());
-            auto& rowValues = colValues[rowNames.back()];
+            // the same key may show up in more than one file, the values are merged into one row
+            std::string strValue = rowKey.asString();
+            auto iterRow = rowIdxMap.find(strValue);
+            if (iterRow == rowIdxMap.end())
+            {
+                iterRow = rowIdxMap.emplace(strValue, rowNames.size()).first;
+                rowNames.push_back(strValue);
+                rowValues.resize(rowNames.size());
+            }
+
+            auto& row = rowValues[iterRow->second];
             for (auto& member : members)
             {
                 if (member != "Key")
@@ -4678,6 +5011,12 @@ namespace d2ce
                         columnNames.push_back(member);
                     }
 
+                    if ((member != colId) && !languages.empty() && (languages.find(member) == languages.end()))
+                    {
+                        // the column is still listed, so the language shows up as supported
+                        continue;
+                    }
+
                     auto value = item[member];
                     if (value.isNull())
                     {
@@ -4690,7 +5029,7 @@ namespace d2ce
                         // NOTE: Some langauges seem to begin with the string "a0n1:" or "a1n0" (not sure what this means, but needs to be stripped)
                         strValue.erase(0, 5);
                     }
-                    rowValues[member] = strValue;
+                    row[member] = strValue;
                 }
             }
             return true;
@@ -4729,7 +5068,7 @@ namespace d2ce
         template <typename F>
         void LoadJsonStream(F f)
         {
-            std::istringstream stream(f);
+            EmbeddedTextStream stream(f);
             LoadJson(stream);
         }
 
@@ -4816,6 +5155,16 @@ namespace d2ce
             return std::make_unique<JsonStringsDocument>();
         }
 
+        virtual std::unique_ptr<ITxtDocument> GetStringTxt(const std::set<std::string>& languages) const override
+        {
+            if (modReader != nullptr)
+            {
+                return modReader->GetStringTxt(languages);
+            }
+
+            return std::make_unique<JsonStringsDocument>(languages);
+        }
+
         virtual std::unique_ptr<ITxtDocument> GetExpansionStringTxt() const override
         {
             return nullptr;
@@ -4834,7 +5183,7 @@ namespace d2ce
             const rapidcsv::LineReaderParams& pLineReaderParams = rapidcsv::LineReaderParams(),
             size_t idx = 0) const
         {
-            std::istringstream stream(f);
+            EmbeddedTextStream stream(f);
             return std::make_unique<CsvTxtDocument>(stream, pLabelParams, pSeparatorParams, pConverterParams, pLineReaderParams, idx);
         }
 
@@ -4842,7 +5191,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetCharStats());
+                return modReader->GetCharStatsDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetCharStats());
@@ -4852,7 +5201,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetPlayerClass());
+                return modReader->GetPlayerClassDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetPlayerClass());
@@ -4862,7 +5211,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetExperience());
+                return modReader->GetExperienceDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetExperience());
@@ -4872,7 +5221,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetHireling());
+                return modReader->GetHirelingDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetHireling());
@@ -4882,7 +5231,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetItemsCode());
+                return modReader->GetItemsCodeDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetItemsCode());
@@ -4892,7 +5241,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetItemStatCost());
+                return modReader->GetItemStatCostDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetItemStatCost());
@@ -4902,7 +5251,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetItemTypes());
+                return modReader->GetItemTypesDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetItemTypes());
@@ -4912,7 +5261,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetProperties());
+                return modReader->GetPropertiesDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetProperties());
@@ -4922,7 +5271,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetGems());
+                return modReader->GetGemsDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetGems());
@@ -4932,7 +5281,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetBelts());
+                return modReader->GetBeltsDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetBelts());
@@ -4942,7 +5291,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetArmor());
+                return modReader->GetArmorDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetArmor());
@@ -4952,7 +5301,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetWeapons());
+                return modReader->GetWeaponsDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetWeapons());
@@ -4962,7 +5311,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetMisc());
+                return modReader->GetMiscDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetMisc());
@@ -4972,7 +5321,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetMagicPrefix());
+                return modReader->GetMagicPrefixDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetMagicPrefix());
@@ -4982,7 +5331,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetMagicSuffix());
+                return modReader->GetMagicSuffixDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetMagicSuffix());
@@ -4992,7 +5341,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetRarePrefix());
+                return modReader->GetRarePrefixDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetRarePrefix());
@@ -5002,7 +5351,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetRareSuffix());
+                return modReader->GetRareSuffixDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetRareSuffix());
@@ -5012,7 +5361,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetUniqueItems());
+                return modReader->GetUniqueItemsDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetUniqueItems());
@@ -5022,7 +5371,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetSets());
+                return modReader->GetSetsDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetSets());
@@ -5032,7 +5381,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetSetItems());
+                return modReader->GetSetItemsDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetSetItems());
@@ -5042,7 +5391,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetRunes());
+                return modReader->GetRunesDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetRunes());
@@ -5052,7 +5401,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetSkillsTxt());
+                return modReader->GetSkillsTxtDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetSkills());
@@ -5062,7 +5411,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetSkillDesc());
+                return modReader->GetSkillDescDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetSkillDesc());
@@ -5072,7 +5421,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetMonStats());
+                return modReader->GetMonStatsDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetMonStats());
@@ -5082,7 +5431,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetMonType());
+                return modReader->GetMonTypeDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetMonType());
@@ -5092,7 +5441,7 @@ namespace d2ce
         {
             if (modReader != nullptr)
             {
-                return LoadTxtStream(modReader->GetSuperiorModsTxt());
+                return modReader->GetSuperiorModsTxtDoc();
             }
 
             return LoadTxtStream(TxtReaderHelper::GetSuperiorModsTxt());
@@ -5147,6 +5496,11 @@ namespace d2ce
         return std::make_unique<JsonStringsDocument>(*const_cast<D2RModReaderHelper*>(this));
     }
 
+    std::unique_ptr<ITxtDocument> D2RModReaderHelper::GetStringTxt(const std::set<std::string>& languages) const
+    {
+        return std::make_unique<JsonStringsDocument>(*const_cast<D2RModReaderHelper*>(this), languages);
+    }
+
     const ITxtReader& getDefaultTxtReader()
     {
         static TxtReaderImpl defaultTxtReader;
@@ -5160,7 +5514,10 @@ namespace d2ce
             return getDefaultTxtReader();
         }
 
+        // batch workers look up the reader of every file they open
+        static std::mutex modTxtReadersMutex;
         static std::map<std::wstring, std::shared_ptr<TxtReaderImpl>> modTxtReaders;
+        std::lock_guard<std::mutex> lock(modTxtReadersMutex);
         auto path = modPath.wstring();
         auto iter = modTxtReaders.find(path);
         if (iter != modTxtReaders.end())
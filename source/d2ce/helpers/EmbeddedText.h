@@ -0,0 +1,200 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstring>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+namespace d2ce
+{
+    //---------------------------------------------------------------------------
+    // The default txt and json data is compiled in as a constexpr table of string
+    // literal pieces (one per line, the compiler limits the size of a single literal).
+    // The pieces live in read-only memory and are handed out as a view over the pieces,
+    // text loaded at run time (D2R mod files) is handed out as a view over a single piece.
+    class EmbeddedText
+    {
+    private:
+        const char* const* m_pieces = nullptr;
+        size_t m_numPieces = 0;
+        std::string_view m_text; // used when there are no pieces
+
+    public:
+        EmbeddedText() = default;
+
+        template <size_t N>
+        EmbeddedText(const char* const (&pieces)[N]) : m_pieces(pieces), m_numPieces(N)
+        {
+        }
+
+        // only a view is kept, the string must outlive the EmbeddedText
+        EmbeddedText(const std::string& text) : m_text(text)
+        {
+        }
+
+        EmbeddedText(std::string&&) = delete;
+
+        size_t numPieces() const
+        {
+            if (m_pieces != nullptr)
+            {
+                return m_numPieces;
+            }
+
+            return m_text.empty() ? 0 : 1;
+        }
+
+        std::string_view piece(size_t idx) const
+        {
+            if (m_pieces != nullptr)
+            {
+                return std::string_view(m_pieces[idx]);
+            }
+
+            return m_text;
+        }
+
+        size_t size() const
+        {
+            size_t length = 0;
+            for (size_t idx = 0; idx < numPieces(); ++idx)
+            {
+                length += piece(idx).size();
+            }
+
+            return length;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+    };
+
+    //---------------------------------------------------------------------------
+    // Read-only stream buffer that walks the pieces of an EmbeddedText in place,
+    // so the txt and json loaders parse the text without joining the pieces first.
+    class EmbeddedTextStreamBuf : public std::streambuf
+    {
+    private:
+        EmbeddedText m_text;
+        size_t m_piece = 0;       // piece in the get area
+        size_t m_pieceOffset = 0; // offset of that piece from the start of the text
+
+        void setPiece(size_t piece, size_t pieceOffset, size_t pos)
+        {
+            m_piece = piece;
+            m_pieceOffset = pieceOffset;
+            if (piece >= m_text.numPieces())
+            {
+                setg(nullptr, nullptr, nullptr);
+                return;
+            }
+
+            auto text = m_text.piece(piece);
+            char* begin = const_cast<char*>(text.data()); // the get area is never written to
+            setg(begin, begin + pos, begin + text.size());
+        }
+
+    protected:
+        int_type underflow() override
+        {
+            while (gptr() == egptr())
+            {
+                if (m_piece >= m_text.numPieces())
+                {
+                    return traits_type::eof();
+                }
+
+                setPiece(m_piece + 1, m_pieceOffset + size_t(egptr() - eback()), 0);
+            }
+
+            return traits_type::to_int_type(*gptr());
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override
+        {
+            if (((which & std::ios_base::in) == 0) || (off_type(pos) < 0))
+            {
+                return pos_type(off_type(-1));
+            }
+
+            size_t target = size_t(off_type(pos));
+            size_t pieceOffset = 0;
+            for (size_t piece = 0; piece < m_text.numPieces(); ++piece)
+            {
+                auto pieceSize = m_text.piece(piece).size();
+                if (target < pieceOffset + pieceSize)
+                {
+                    setPiece(piece, pieceOffset, target - pieceOffset);
+                    return pos;
+                }
+
+                pieceOffset += pieceSize;
+            }
+
+            if (target != pieceOffset)
+            {
+                return pos_type(off_type(-1));
+            }
+
+            setPiece(m_text.numPieces(), pieceOffset, 0);
+            return pos;
+        }
+
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in) override
+        {
+            off_type base = 0;
+            if (dir == std::ios_base::cur)
+            {
+                base = off_type(m_pieceOffset + size_t(gptr() - eback()));
+            }
+            else if (dir == std::ios_base::end)
+            {
+                base = off_type(m_text.size());
+            }
+
+            return seekpos(pos_type(base + off), which);
+        }
+
+    public:
+        explicit EmbeddedTextStreamBuf(const EmbeddedText& text) : m_text(text)
+        {
+            setPiece(0, 0, 0);
+        }
+    };
+
+    //---------------------------------------------------------------------------
+    class EmbeddedTextStream : public std::istream
+    {
+    private:
+        EmbeddedTextStreamBuf m_buf;
+
+    public:
+        explicit EmbeddedTextStream(const EmbeddedText& text) : std::istream(nullptr), m_buf(text)
+        {
+            rdbuf(&m_buf);
+        }
+    };
+}
+//---------------------------------------------------------------------------
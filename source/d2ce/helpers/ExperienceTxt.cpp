@@ -18,123 +18,119 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetExperience()
+        EmbeddedText GetExperience()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"Level\tAmazon\tSorceress\tNecromancer\tPaladin\tBarbarian\tDruid\tAssassin\tExpRatio\n";
-                ss << u8"MaxLvl\t99\t99\t99\t99\t99\t99\t99\t10\n";
-                ss << u8"0\t0\t0\t0\t0\t0\t0\t0\t1024\n";
-                ss << u8"1\t500\t500\t500\t500\t500\t500\t500\t1024\n";
-                ss << u8"2\t1500\t1500\t1500\t1500\t1500\t1500\t1500\t1024\n";
-                ss << u8"3\t3750\t3750\t3750\t3750\t3750\t3750\t3750\t1024\n";
-                ss << u8"4\t7875\t7875\t7875\t7875\t7875\t7875\t7875\t1024\n";
-                ss << u8"5\t14175\t14175\t14175\t14175\t14175\t14175\t14175\t1024\n";
-                ss << u8"6\t22680\t22680\t22680\t22680\t22680\t22680\t22680\t1024\n";
-                ss << u8"7\t32886\t32886\t32886\t32886\t32886\t32886\t32886\t1024\n";
-                ss << u8"8\t44396\t44396\t44396\t44396\t44396\t44396\t44396\t1024\n";
-                ss << u8"9\t57715\t57715\t57715\t57715\t57715\t57715\t57715\t1024\n";
-                ss << u8"10\t72144\t72144\t72144\t72144\t72144\t72144\t72144\t1024\n";
-                ss << u8"11\t90180\t90180\t90180\t90180\t90180\t90180\t90180\t1024\n";
-                ss << u8"12\t112725\t112725\t112725\t112725\t112725\t112725\t112725\t1024\n";
-                ss << u8"13\t140906\t140906\t140906\t140906\t140906\t140906\t140906\t1024\n";
-                ss << u8"14\t176132\t176132\t176132\t176132\t176132\t176132\t176132\t1024\n";
-                ss << u8"15\t220165\t220165\t220165\t220165\t220165\t220165\t220165\t1024\n";
-                ss << u8"16\t275207\t275207\t275207\t275207\t275207\t275207\t275207\t1024\n";
-                ss << u8"17\t344008\t344008\t344008\t344008\t344008\t344008\t344008\t1024\n";
-                ss << u8"18\t430010\t430010\t430010\t430010\t430010\t430010\t430010\t1024\n";
-                ss << u8"19\t537513\t537513\t537513\t537513\t537513\t537513\t537513\t1024\n";
-                ss << u8"20\t671891\t671891\t671891\t671891\t671891\t671891\t671891\t1024\n";
-                ss << u8"21\t839864\t839864\t839864\t839864\t839864\t839864\t839864\t1024\n";
-                ss << u8"22\t1049830\t1049830\t1049830\t1049830\t1049830\t1049830\t1049830\t1024\n";
-                ss << u8"23\t1312287\t1312287\t1312287\t1312287\t1312287\t1312287\t1312287\t1024\n";
-                ss << u8"24\t1640359\t1640359\t1640359\t1640359\t1640359\t1640359\t1640359\t1024\n";
-                ss << u8"25\t2050449\t2050449\t2050449\t2050449\t2050449\t2050449\t2050449\t1024\n";
-                ss << u8"26\t2563061\t2563061\t2563061\t2563061\t2563061\t2563061\t2563061\t1024\n";
-                ss << u8"27\t3203826\t3203826\t3203826\t3203826\t3203826\t3203826\t3203826\t1024\n";
-                ss << u8"28\t3902260\t3902260\t3902260\t3902260\t3902260\t3902260\t3902260\t1024\n";
-                ss << u8"29\t4663553\t4663553\t4663553\t4663553\t4663553\t4663553\t4663553\t1024\n";
-                ss << u8"30\t5493363\t5493363\t5493363\t5493363\t5493363\t5493363\t5493363\t1024\n";
-                ss << u8"31\t6397855\t6397855\t6397855\t6397855\t6397855\t6397855\t6397855\t1024\n";
-                ss << u8"32\t7383752\t7383752\t7383752\t7383752\t7383752\t7383752\t7383752\t1024\n";
-                ss << u8"33\t8458379\t8458379\t8458379\t8458379\t8458379\t8458379\t8458379\t1024\n";
-                ss << u8"34\t9629723\t9629723\t9629723\t9629723\t9629723\t9629723\t9629723\t1024\n";
-                ss << u8"35\t10906488\t10906488\t10906488\t10906488\t10906488\t10906488\t10906488\t1024\n";
-                ss << u8"36\t12298162\t12298162\t12298162\t12298162\t12298162\t12298162\t12298162\t1024\n";
-                ss << u8"37\t13815086\t13815086\t13815086\t13815086\t13815086\t13815086\t13815086\t1024\n";
-                ss << u8"38\t15468534\t15468534\t15468534\t15468534\t15468534\t15468534\t15468534\t1024\n";
-                ss << u8"39\t17270791\t17270791\t17270791\t17270791\t17270791\t17270791\t17270791\t1024\n";
-                ss << u8"40\t19235252\t19235252\t19235252\t19235252\t19235252\t19235252\t19235252\t1024\n";
-                ss << u8"41\t21376515\t21376515\t21376515\t21376515\t21376515\t21376515\t21376515\t1024\n";
-                ss << u8"42\t23710491\t23710491\t23710491\t23710491\t23710491\t23710491\t23710491\t1024\n";
-                ss << u8"43\t26254525\t26254525\t26254525\t26254525\t26254525\t26254525\t26254525\t1024\n";
-                ss << u8"44\t29027522\t29027522\t29027522\t29027522\t29027522\t29027522\t29027522\t1024\n";
-                ss << u8"45\t32050088\t32050088\t32050088\t32050088\t32050088\t32050088\t32050088\t1024\n";
-                ss << u8"46\t35344686\t35344686\t35344686\t35344686\t35344686\t35344686\t35344686\t1024\n";
-                ss << u8"47\t38935798\t38935798\t38935798\t38935798\t38935798\t38935798\t38935798\t1024\n";
-                ss << u8"48\t42850109\t42850109\t42850109\t42850109\t42850109\t42850109\t42850109\t1024\n";
-                ss << u8"49\t47116709\t47116709\t47116709\t47116709\t47116709\t47116709\t47116709\t1024\n";
-                ss << u8"50\t51767302\t51767302\t51767302\t51767302\t51767302\t51767302\t51767302\t1024\n";
-                ss << u8"51\t56836449\t56836449\t56836449\t56836449\t56836449\t56836449\t56836449\t1024\n";
-                ss << u8"52\t62361819\t62361819\t62361819\t62361819\t62361819\t62361819\t62361819\t1024\n";
-                ss << u8"53\t68384473\t68384473\t68384473\t68384473\t68384473\t68384473\t68384473\t1024\n";
-                ss << u8"54\t74949165\t74949165\t74949165\t74949165\t74949165\t74949165\t74949165\t1024\n";
-                ss << u8"55\t82104680\t82104680\t82104680\t82104680\t82104680\t82104680\t82104680\t1024\n";
-                ss << u8"56\t89904191\t89904191\t89904191\t89904191\t89904191\t89904191\t89904191\t1024\n";
-                ss << u8"57\t98405658\t98405658\t98405658\t98405658\t98405658\t98405658\t98405658\t1024\n";
-                ss << u8"58\t107672256\t107672256\t107672256\t107672256\t107672256\t107672256\t107672256\t1024\n";
-                ss << u8"59\t117772849\t117772849\t117772849\t117772849\t117772849\t117772849\t117772849\t1024\n";
-                ss << u8"60\t128782495\t128782495\t128782495\t128782495\t128782495\t128782495\t128782495\t1024\n";
-                ss << u8"61\t140783010\t140783010\t140783010\t140783010\t140783010\t140783010\t140783010\t1024\n";
-                ss << u8"62\t153863570\t153863570\t153863570\t153863570\t153863570\t153863570\t153863570\t1024\n";
-                ss << u8"63\t168121381\t168121381\t168121381\t168121381\t168121381\t168121381\t168121381\t1024\n";
-                ss << u8"64\t183662396\t183662396\t183662396\t183662396\t183662396\t183662396\t183662396\t1024\n";
-                ss << u8"65\t200602101\t200602101\t200602101\t200602101\t200602101\t200602101\t200602101\t1024\n";
-                ss << u8"66\t219066380\t219066380\t219066380\t219066380\t219066380\t219066380\t219066380\t1024\n";
-                ss << u8"67\t239192444\t239192444\t239192444\t239192444\t239192444\t239192444\t239192444\t1024\n";
-                ss << u8"68\t261129853\t261129853\t261129853\t261129853\t261129853\t261129853\t261129853\t1024\n";
-                ss << u8"69\t285041630\t285041630\t285041630\t285041630\t285041630\t285041630\t285041630\t1024\n";
-                ss << u8"70\t311105466\t311105466\t311105466\t311105466\t311105466\t311105466\t311105466\t976\n";
-                ss << u8"71\t339515048\t339515048\t339515048\t339515048\t339515048\t339515048\t339515048\t928\n";
-                ss << u8"72\t370481492\t370481492\t370481492\t370481492\t370481492\t370481492\t370481492\t880\n";
-                ss << u8"73\t404234916\t404234916\t404234916\t404234916\t404234916\t404234916\t404234916\t832\n";
-                ss << u8"74\t441026148\t441026148\t441026148\t441026148\t441026148\t441026148\t441026148\t784\n";
-                ss << u8"75\t481128591\t481128591\t481128591\t481128591\t481128591\t481128591\t481128591\t736\n";
-                ss << u8"76\t524840254\t524840254\t524840254\t524840254\t524840254\t524840254\t524840254\t688\n";
-                ss << u8"77\t572485967\t572485967\t572485967\t572485967\t572485967\t572485967\t572485967\t640\n";
-                ss << u8"78\t624419793\t624419793\t624419793\t624419793\t624419793\t624419793\t624419793\t592\n";
-                ss << u8"79\t681027665\t681027665\t681027665\t681027665\t681027665\t681027665\t681027665\t544\n";
-                ss << u8"80\t742730244\t742730244\t742730244\t742730244\t742730244\t742730244\t742730244\t496\n";
-                ss << u8"81\t809986056\t809986056\t809986056\t809986056\t809986056\t809986056\t809986056\t448\n";
-                ss << u8"82\t883294891\t883294891\t883294891\t883294891\t883294891\t883294891\t883294891\t400\n";
-                ss << u8"83\t963201521\t963201521\t963201521\t963201521\t963201521\t963201521\t963201521\t352\n";
-                ss << u8"84\t1050299747\t1050299747\t1050299747\t1050299747\t1050299747\t1050299747\t1050299747\t304\n";
-                ss << u8"85\t1145236814\t1145236814\t1145236814\t1145236814\t1145236814\t1145236814\t1145236814\t256\n";
-                ss << u8"86\t1248718217\t1248718217\t1248718217\t1248718217\t1248718217\t1248718217\t1248718217\t192\n";
-                ss << u8"87\t1361512946\t1361512946\t1361512946\t1361512946\t1361512946\t1361512946\t1361512946\t144\n";
-                ss << u8"88\t1484459201\t1484459201\t1484459201\t1484459201\t1484459201\t1484459201\t1484459201\t108\n";
-                ss << u8"89\t1618470619\t1618470619\t1618470619\t1618470619\t1618470619\t1618470619\t1618470619\t81\n";
-                ss << u8"90\t1764543065\t1764543065\t1764543065\t1764543065\t1764543065\t1764543065\t1764543065\t61\n";
-                ss << u8"91\t1923762030\t1923762030\t1923762030\t1923762030\t1923762030\t1923762030\t1923762030\t46\n";
-                ss << u8"92\t2097310703\t2097310703\t2097310703\t2097310703\t2097310703\t2097310703\t2097310703\t35\n";
-                ss << u8"93\t2286478756\t2286478756\t2286478756\t2286478756\t2286478756\t2286478756\t2286478756\t26\n";
-                ss << u8"94\t2492671933\t2492671933\t2492671933\t2492671933\t2492671933\t2492671933\t2492671933\t20\n";
-                ss << u8"95\t2717422497\t2717422497\t2717422497\t2717422497\t2717422497\t2717422497\t2717422497\t15\n";
-                ss << u8"96\t2962400612\t2962400612\t2962400612\t2962400612\t2962400612\t2962400612\t2962400612\t11\n";
-                ss << u8"97\t3229426756\t3229426756\t3229426756\t3229426756\t3229426756\t3229426756\t3229426756\t8\n";
-                ss << u8"98\t3520485254\t3520485254\t3520485254\t3520485254\t3520485254\t3520485254\t3520485254\t6\n";
-                ss << u8"99\t3837739017\t3837739017\t3837739017\t3837739017\t3837739017\t3837739017\t3837739017\t5\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"Level\tAmazon\tSorceress\tNecromancer\tPaladin\tBarbarian\tDruid\tAssassin\tExpRatio\n",
+                u8"MaxLvl\t99\t99\t99\t99\t99\t99\t99\t10\n",
+                u8"0\t0\t0\t0\t0\t0\t0\t0\t1024\n",
+                u8"1\t500\t500\t500\t500\t500\t500\t500\t1024\n",
+                u8"2\t1500\t1500\t1500\t1500\t1500\t1500\t1500\t1024\n",
+                u8"3\t3750\t3750\t3750\t3750\t3750\t3750\t3750\t1024\n",
+                u8"4\t7875\t7875\t7875\t7875\t7875\t7875\t7875\t1024\n",
+                u8"5\t14175\t14175\t14175\t14175\t14175\t14175\t14175\t1024\n",
+                u8"6\t22680\t22680\t22680\t22680\t22680\t22680\t22680\t1024\n",
+                u8"7\t32886\t32886\t32886\t32886\t32886\t32886\t32886\t1024\n",
+                u8"8\t44396\t44396\t44396\t44396\t44396\t44396\t44396\t1024\n",
+                u8"9\t57715\t57715\t57715\t57715\t57715\t57715\t57715\t1024\n",
+                u8"10\t72144\t72144\t72144\t72144\t72144\t72144\t72144\t1024\n",
+                u8"11\t90180\t90180\t90180\t90180\t90180\t90180\t90180\t1024\n",
+                u8"12\t112725\t112725\t112725\t112725\t112725\t112725\t112725\t1024\n",
+                u8"13\t140906\t140906\t140906\t140906\t140906\t140906\t140906\t1024\n",
+                u8"14\t176132\t176132\t176132\t176132\t176132\t176132\t176132\t1024\n",
+                u8"15\t220165\t220165\t220165\t220165\t220165\t220165\t220165\t1024\n",
+                u8"16\t275207\t275207\t275207\t275207\t275207\t275207\t275207\t1024\n",
+                u8"17\t344008\t344008\t344008\t344008\t344008\t344008\t344008\t1024\n",
+                u8"18\t430010\t430010\t430010\t430010\t430010\t430010\t430010\t1024\n",
+                u8"19\t537513\t537513\t537513\t537513\t537513\t537513\t537513\t1024\n",
+                u8"20\t671891\t671891\t671891\t671891\t671891\t671891\t671891\t1024\n",
+                u8"21\t839864\t839864\t839864\t839864\t839864\t839864\t839864\t1024\n",
+                u8"22\t1049830\t1049830\t1049830\t1049830\t1049830\t1049830\t1049830\t1024\n",
+                u8"23\t1312287\t1312287\t1312287\t1312287\t1312287\t1312287\t1312287\t1024\n",
+                u8"24\t1640359\t1640359\t1640359\t1640359\t1640359\t1640359\t1640359\t1024\n",
+                u8"25\t2050449\t2050449\t2050449\t2050449\t2050449\t2050449\t2050449\t1024\n",
+                u8"26\t2563061\t2563061\t2563061\t2563061\t2563061\t2563061\t2563061\t1024\n",
+                u8"27\t3203826\t3203826\t3203826\t3203826\t3203826\t3203826\t3203826\t1024\n",
+                u8"28\t3902260\t3902260\t3902260\t3902260\t3902260\t3902260\t3902260\t1024\n",
+                u8"29\t4663553\t4663553\t4663553\t4663553\t4663553\t4663553\t4663553\t1024\n",
+                u8"30\t5493363\t5493363\t5493363\t5493363\t5493363\t5493363\t5493363\t1024\n",
+                u8"31\t6397855\t6397855\t6397855\t6397855\t6397855\t6397855\t6397855\t1024\n",
+                u8"32\t7383752\t7383752\t7383752\t7383752\t7383752\t7383752\t7383752\t1024\n",
+                u8"33\t8458379\t8458379\t8458379\t8458379\t8458379\t8458379\t8458379\t1024\n",
+                u8"34\t9629723\t9629723\t9629723\t9629723\t9629723\t9629723\t9629723\t1024\n",
+                u8"35\t10906488\t10906488\t10906488\t10906488\t10906488\t10906488\t10906488\t1024\n",
+                u8"36\t12298162\t12298162\t12298162\t12298162\t12298162\t12298162\t12298162\t1024\n",
+                u8"37\t13815086\t13815086\t13815086\t13815086\t13815086\t13815086\t13815086\t1024\n",
+                u8"38\t15468534\t15468534\t15468534\t15468534\t15468534\t15468534\t15468534\t1024\n",
+                u8"39\t17270791\t17270791\t17270791\t17270791\t17270791\t17270791\t17270791\t1024\n",
+                u8"40\t19235252\t19235252\t19235252\t19235252\t19235252\t19235252\t19235252\t1024\n",
+                u8"41\t21376515\t21376515\t21376515\t21376515\t21376515\t21376515\t21376515\t1024\n",
+                u8"42\t23710491\t23710491\t23710491\t23710491\t23710491\t23710491\t23710491\t1024\n",
+                u8"43\t26254525\t26254525\t26254525\t26254525\t26254525\t26254525\t26254525\t1024\n",
+                u8"44\t29027522\t29027522\t29027522\t29027522\t29027522\t29027522\t29027522\t1024\n",
+                u8"45\t32050088\t32050088\t32050088\t32050088\t32050088\t32050088\t32050088\t1024\n",
+                u8"46\t35344686\t35344686\t35344686\t35344686\t35344686\t35344686\t35344686\t1024\n",
+                u8"47\t38935798\t38935798\t38935798\t38935798\t38935798\t38935798\t38935798\t1024\n",
+                u8"48\t42850109\t42850109\t42850109\t42850109\t42850109\t42850109\t42850109\t1024\n",
+                u8"49\t47116709\t47116709\t47116709\t47116709\t47116709\t47116709\t47116709\t1024\n",
+                u8"50\t51767302\t51767302\t51767302\t51767302\t51767302\t51767302\t51767302\t1024\n",
+                u8"51\t56836449\t56836449\t56836449\t56836449\t56836449\t56836449\t56836449\t1024\n",
+                u8"52\t62361819\t62361819\t62361819\t62361819\t62361819\t62361819\t62361819\t1024\n",
+                u8"53\t68384473\t68384473\t68384473\t68384473\t68384473\t68384473\t68384473\t1024\n",
+                u8"54\t74949165\t74949165\t74949165\t74949165\t74949165\t74949165\t74949165\t1024\n",
+                u8"55\t82104680\t82104680\t82104680\t82104680\t82104680\t82104680\t82104680\t1024\n",
+                u8"56\t89904191\t89904191\t89904191\t89904191\t89904191\t89904191\t89904191\t1024\n",
+                u8"57\t98405658\t98405658\t98405658\t98405658\t98405658\t98405658\t98405658\t1024\n",
+                u8"58\t107672256\t107672256\t107672256\t107672256\t107672256\t107672256\t107672256\t1024\n",
+                u8"59\t117772849\t117772849\t117772849\t117772849\t117772849\t117772849\t117772849\t1024\n",
+                u8"60\t128782495\t128782495\t128782495\t128782495\t128782495\t128782495\t128782495\t1024\n",
+                u8"61\t140783010\t140783010\t140783010\t140783010\t140783010\t140783010\t140783010\t1024\n",
+                u8"62\t153863570\t153863570\t153863570\t153863570\t153863570\t153863570\t153863570\t1024\n",
+                u8"63\t168121381\t168121381\t168121381\t168121381\t168121381\t168121381\t168121381\t1024\n",
+                u8"64\t183662396\t183662396\t183662396\t183662396\t183662396\t183662396\t183662396\t1024\n",
+                u8"65\t200602101\t200602101\t200602101\t200602101\t200602101\t200602101\t200602101\t1024\n",
+                u8"66\t219066380\t219066380\t219066380\t219066380\t219066380\t219066380\t219066380\t1024\n",
+                u8"67\t239192444\t239192444\t239192444\t239192444\t239192444\t239192444\t239192444\t1024\n",
+                u8"68\t261129853\t261129853\t261129853\t261129853\t261129853\t261129853\t261129853\t1024\n",
+                u8"69\t285041630\t285041630\t285041630\t285041630\t285041630\t285041630\t285041630\t1024\n",
+                u8"70\t311105466\t311105466\t311105466\t311105466\t311105466\t311105466\t311105466\t976\n",
+                u8"71\t339515048\t339515048\t339515048\t339515048\t339515048\t339515048\t339515048\t928\n",
+                u8"72\t370481492\t370481492\t370481492\t370481492\t370481492\t370481492\t370481492\t880\n",
+                u8"73\t404234916\t404234916\t404234916\t404234916\t404234916\t404234916\t404234916\t832\n",
+                u8"74\t441026148\t441026148\t441026148\t441026148\t441026148\t441026148\t441026148\t784\n",
+                u8"75\t481128591\t481128591\t481128591\t481128591\t481128591\t481128591\t481128591\t736\n",
+                u8"76\t524840254\t524840254\t524840254\t524840254\t524840254\t524840254\t524840254\t688\n",
+                u8"77\t572485967\t572485967\t572485967\t572485967\t572485967\t572485967\t572485967\t640\n",
+                u8"78\t624419793\t624419793\t624419793\t624419793\t624419793\t624419793\t624419793\t592\n",
+                u8"79\t681027665\t681027665\t681027665\t681027665\t681027665\t681027665\t681027665\t544\n",
+                u8"80\t742730244\t742730244\t742730244\t742730244\t742730244\t742730244\t742730244\t496\n",
+                u8"81\t809986056\t809986056\t809986056\t809986056\t809986056\t809986056\t809986056\t448\n",
+                u8"82\t883294891\t883294891\t883294891\t883294891\t883294891\t883294891\t883294891\t400\n",
+                u8"83\t963201521\t963201521\t963201521\t963201521\t963201521\t963201521\t963201521\t352\n",
+                u8"84\t1050299747\t1050299747\t1050299747\t1050299747\t1050299747\t1050299747\t1050299747\t304\n",
+                u8"85\t1145236814\t1145236814\t1145236814\t1145236814\t1145236814\t1145236814\t1145236814\t256\n",
+                u8"86\t1248718217\t1248718217\t1248718217\t1248718217\t1248718217\t1248718217\t1248718217\t192\n",
+                u8"87\t1361512946\t1361512946\t1361512946\t1361512946\t1361512946\t1361512946\t1361512946\t144\n",
+                u8"88\t1484459201\t1484459201\t1484459201\t1484459201\t1484459201\t1484459201\t1484459201\t108\n",
+                u8"89\t1618470619\t1618470619\t1618470619\t1618470619\t1618470619\t1618470619\t1618470619\t81\n",
+                u8"90\t1764543065\t1764543065\t1764543065\t1764543065\t1764543065\t1764543065\t1764543065\t61\n",
+                u8"91\t1923762030\t1923762030\t1923762030\t1923762030\t1923762030\t1923762030\t1923762030\t46\n",
+                u8"92\t2097310703\t2097310703\t2097310703\t2097310703\t2097310703\t2097310703\t2097310703\t35\n",
+                u8"93\t2286478756\t2286478756\t2286478756\t2286478756\t2286478756\t2286478756\t2286478756\t26\n",
+                u8"94\t2492671933\t2492671933\t2492671933\t2492671933\t2492671933\t2492671933\t2492671933\t20\n",
+                u8"95\t2717422497\t2717422497\t2717422497\t2717422497\t2717422497\t2717422497\t2717422497\t15\n",
+                u8"96\t2962400612\t2962400612\t2962400612\t2962400612\t2962400612\t2962400612\t2962400612\t11\n",
+                u8"97\t3229426756\t3229426756\t3229426756\t3229426756\t3229426756\t3229426756\t3229426756\t8\n",
+                u8"98\t3520485254\t3520485254\t3520485254\t3520485254\t3520485254\t3520485254\t3520485254\t6\n",
+                u8"99\t3837739017\t3837739017\t3837739017\t3837739017\t3837739017\t3837739017\t3837739017\t5\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
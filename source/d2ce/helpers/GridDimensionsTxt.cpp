@@ -18,31 +18,27 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetGridDimensionsTxt()
+        EmbeddedText GetGridDimensionsTxt()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"name\tversion\tX\tY\n";
-                ss << u8"Stash\t0\t6\t4\n";
-                ss << u8"Stash\t100\t6\t8\n";
-                ss << u8"Stash\t5\t10\t10\n";
-                ss << u8"Inventory\t0\t10\t4\n";
-                ss << u8"Inventory\t100\t10\t4\n";
-                ss << u8"Inventory\t5\t10\t4\n";
-                ss << u8"Horadric Cube\t0\t3\t4\n";
-                ss << u8"Horadric Cube\t100\t3\t4\n";
-                ss << u8"Horadric Cube\t5\t3\t4\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"name\tversion\tX\tY\n",
+                u8"Stash\t0\t6\t4\n",
+                u8"Stash\t100\t6\t8\n",
+                u8"Stash\t5\t10\t10\n",
+                u8"Inventory\t0\t10\t4\n",
+                u8"Inventory\t100\t10\t4\n",
+                u8"Inventory\t5\t10\t4\n",
+                u8"Horadric Cube\t0\t3\t4\n",
+                u8"Horadric Cube\t100\t3\t4\n",
+                u8"Horadric Cube\t5\t3\t4\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
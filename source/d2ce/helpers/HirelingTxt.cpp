@@ -18,157 +18,153 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetHireling()
+        EmbeddedText GetHireling()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"Hireling\t*SubType\tVersion\tId\tClass\tAct\tDifficulty\tLevel\tSeller\tNameFirst\tNameLast\tGold\tExp/Lvl\tHP\tHP/Lvl\tDefense\tDef/Lvl\tStr\tStr/Lvl\tDex\tDex/Lvl\tAR\tAR/Lvl\tDmg-Min\tDmg-Max\tDmg/Lvl\tResistFire\tResistFire/Lvl\tResistCold\tResistCold/Lvl\tResistLightning\tResistLightning/Lvl\tResistPoison\tResistPoison/Lvl\tHireDesc\tDefaultChance\tSkill1\tMode1\tChance1\tChancePerLvl1\tLevel1\tLvlPerLvl1\tSkill2\tMode2\tChance2\tChancePerLvl2\tLevel2\tLvlPerLvl2\tSkill3\tMode3\tChance3\tChancePerLvl3\tLevel3\tLvlPerLvl3\tSkill4\tMode4\tChance4\tChancePerLvl4\tLevel4\tLvlPerLvl4\tSkill5\tMode5\tChance5\tChancePerLvl5\tLevel5\tLvlPerLvl5\tSkill6\tMode6\tChance6\tChancePerLvl6\tLevel6\tLvlPerLvl6\tHiringMaxLevelDifference\tresurrectcostmultiplier\tresurrectcostdivisor\tresurrectcostmax\tequivalentcharclass\n";
-                ss << u8"Rogue Scout\tFire - Normal\t0\t0\t271\t1\t1\t3\t150\tmerc01\tmerc41\t100\t100\t45\t8\t15\t6\t35\t10\t45\t16\t10\t10\t1\t3\t2\t0\t8\t0\t8\t0\t8\t0\t8\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t1\t10\tFire Arrow\t4\t25\t8\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Normal\t0\t0\t271\t1\t1\t25\t150\tmerc01\tmerc41\t100\t100\t221\t13\t147\t12\t63\t10\t89\t16\t230\t20\t7\t9\t4\t44\t7\t44\t7\t44\t7\t44\t7\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t8\t10\tFire Arrow\t4\t69\t0\t8\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Normal\t0\t0\t271\t1\t1\t49\t150\tmerc01\tmerc41\t100\t100\t533\t25\t435\t18\t93\t10\t137\t16\t710\t30\t19\t21\t6\t86\t5\t86\t5\t86\t5\t86\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t16\t10\tFire Arrow\t4\t69\t0\t16\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Normal\t0\t1\t271\t1\t1\t3\t150\tmerc01\tmerc41\t150\t105\t45\t8\t15\t6\t35\t10\t45\t16\t10\t10\t1\t3\t2\t0\t8\t0\t8\t0\t8\t0\t8\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t1\t10\tCold Arrow\t4\t25\t2\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Normal\t0\t1\t271\t1\t1\t25\t150\tmerc01\tmerc41\t150\t105\t221\t12\t147\t12\t63\t10\t89\t16\t230\t20\t7\t9\t4\t44\t7\t44\t7\t44\t7\t44\t7\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t8\t10\tCold Arrow\t4\t36\t0\t8\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Normal\t0\t1\t271\t1\t1\t49\t150\tmerc01\tmerc41\t150\t105\t509\t16\t435\t18\t93\t10\t137\t16\t710\t30\t19\t21\t6\t86\t5\t86\t5\t86\t5\t86\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t16\t10\tCold Arrow\t4\t36\t0\t16\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Nightmare\t0\t2\t271\t1\t2\t25\t150\tmerc01\tmerc41\t6000\t110\t199\t12\t132\t12\t60\t10\t84\t16\t207\t20\t6\t8\t4\t41\t7\t41\t7\t41\t7\t41\t7\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t7\t10\tFire Arrow\t4\t69\t0\t7\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Nightmare\t0\t2\t271\t1\t2\t49\t150\tmerc01\tmerc41\t6000\t110\t487\t16\t420\t18\t90\t10\t132\t16\t687\t30\t18\t20\t6\t83\t5\t83\t5\t83\t5\t83\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t15\t10\tFire Arrow\t4\t69\t0\t15\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Nightmare\t0\t3\t271\t1\t2\t25\t150\tmerc01\tmerc41\t7500\t115\t199\t12\t132\t12\t60\t10\t84\t16\t207\t20\t6\t8\t4\t41\t7\t41\t7\t41\t7\t41\t7\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t7\t10\tCold Arrow\t4\t69\t0\t7\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Nightmare\t0\t3\t271\t1\t2\t49\t150\tmerc01\tmerc41\t7500\t115\t487\t16\t420\t18\t90\t10\t132\t16\t687\t30\t18\t20\t6\t83\t5\t83\t5\t83\t5\t83\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t15\t10\tCold Arrow\t4\t69\t0\t15\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Hell\t0\t4\t271\t1\t3\t49\t150\tmerc01\tmerc41\t12500\t120\t438\t16\t378\t18\t87\t10\t127\t16\t618\t30\t17\t19\t6\t80\t5\t80\t5\t80\t5\t80\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t14\t10\tFire Arrow\t4\t69\t0\t14\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Hell\t0\t5\t271\t1\t3\t49\t150\tmerc01\tmerc41\t14000\t125\t438\t16\t378\t18\t87\t10\t127\t16\t618\t30\t17\t19\t6\t80\t5\t80\t5\t80\t5\t80\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t14\t10\tCold Arrow\t4\t69\t0\t14\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Normal\t100\t0\t271\t1\t1\t3\t150\tmerc01\tmerc41\t100\t100\t45\t9\t15\t8\t35\t10\t45\t16\t10\t12\t1\t3\t2\t0\t8\t0\t8\t0\t8\t0\t8\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t1\t10\tFire Arrow\t4\t25\t5\t1\t10\tExploding Arrow\t4\t0\t4\t1\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Normal\t100\t0\t271\t1\t1\t36\t150\tmerc01\tmerc41\t6000\t110\t342\t18\t279\t15\t77\t10\t111\t16\t406\t24\t9\t11\t4\t66\t7\t66\t7\t66\t7\t66\t7\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t12\t10\tFire Arrow\t4\t67\t0\t12\t10\tExploding Arrow\t4\t33\t10\t7\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Normal\t100\t0\t271\t1\t1\t67\t150\tmerc01\tmerc41\t12500\t120\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t22\t10\tFire Arrow\t4\t67\t0\t22\t10\tExploding Arrow\t4\t111\t0\t12\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Normal\t100\t1\t271\t1\t1\t3\t150\tmerc01\tmerc41\t150\t105\t45\t9\t15\t8\t35\t10\t45\t16\t10\t12\t1\t3\t2\t0\t8\t0\t8\t0\t8\t0\t8\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t1\t10\tCold Arrow\t4\t25\t5\t1\t10\tFreezing Arrow\t4\t0\t4\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Normal\t100\t1\t271\t1\t1\t36\t150\tmerc01\tmerc41\t7500\t115\t342\t18\t279\t15\t77\t10\t111\t16\t406\t24\t9\t11\t4\t66\t7\t66\t7\t66\t7\t66\t7\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t12\t10\tCold Arrow\t4\t67\t0\t12\t10\tFreezing Arrow\t4\t33\t10\t4\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Normal\t100\t1\t271\t1\t1\t67\t150\tmerc01\tmerc41\t14000\t125\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t22\t10\tCold Arrow\t4\t67\t0\t22\t10\tFreezing Arrow\t4\t111\t0\t7\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Nightmare\t100\t2\t271\t1\t2\t36\t150\tmerc01\tmerc41\t6000\t110\t342\t18\t279\t15\t77\t10\t111\t16\t406\t24\t9\t11\t4\t66\t7\t66\t7\t66\t7\t66\t7\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t12\t10\tFire Arrow\t4\t67\t0\t12\t10\tExploding Arrow\t4\t33\t10\t7\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Nightmare\t100\t2\t271\t1\t2\t67\t150\tmerc01\tmerc41\t12500\t120\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t22\t10\tFire Arrow\t4\t67\t0\t22\t10\tExploding Arrow\t4\t111\t0\t12\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Nightmare\t100\t3\t271\t1\t2\t36\t150\tmerc01\tmerc41\t7500\t115\t342\t18\t279\t15\t77\t10\t111\t16\t406\t24\t9\t11\t4\t66\t7\t66\t7\t66\t7\t66\t7\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t12\t10\tCold Arrow\t4\t67\t0\t12\t10\tFreezing Arrow\t4\t33\t10\t4\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Nightmare\t100\t3\t271\t1\t2\t67\t150\tmerc01\tmerc41\t14000\t125\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t22\t10\tCold Arrow\t4\t67\t0\t22\t10\tFreezing Arrow\t4\t111\t0\t7\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tFire - Hell\t100\t4\t271\t1\t3\t67\t150\tmerc01\tmerc41\t12500\t120\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t22\t10\tFire Arrow\t4\t67\t0\t22\t10\tExploding Arrow\t4\t111\t0\t12\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Rogue Scout\tIce - Hell\t100\t5\t271\t1\t3\t67\t150\tmerc01\tmerc41\t14000\t125\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t22\t10\tCold Arrow\t4\t67\t0\t22\t10\tFreezing Arrow\t4\t111\t0\t7\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n";
-                ss << u8"Desert Mercenary\tComb-Normal\t0\t6\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t15\t45\t11\t57\t14\t40\t12\t20\t12\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname99\t30\tJab\t14\t70\t4\t3\t10\tPrayer\t1\t10\t0\t3\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tComb-Normal\t0\t6\t338\t2\t1\t31\t198\tmerca201\tmerca221\t350\t110\t340\t20\t243\t16\t96\t14\t73\t12\t240\t20\t18\t25\t6\t62\t7\t62\t7\t62\t7\t62\t7\tskillname99\t30\tJab\t14\t92\t4\t10\t10\tPrayer\t1\t10\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tComb-Normal\t0\t6\t338\t2\t1\t55\t198\tmerca201\tmerca221\t350\t110\t820\t35\t627\t24\t138\t14\t109\t12\t720\t30\t36\t43\t8\t104\t4\t104\t4\t104\t4\t104\t4\tskillname99\t30\tJab\t14\t116\t4\t18\t10\tPrayer\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDef-Normal\t0\t7\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t10\t45\t9\t57\t14\t40\t12\t20\t10\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname104\t30\tJab\t14\t70\t4\t3\t10\tDefiance\t1\t10\t0\t3\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDef-Normal\t0\t7\t338\t2\t1\t31\t198\tmerca201\tmerca221\t350\t110\t340\t20\t243\t16\t96\t14\t73\t12\t240\t20\t18\t25\t6\t62\t7\t62\t7\t62\t7\t62\t7\tskillname104\t30\tJab\t14\t92\t4\t10\t10\tDefiance\t1\t10\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDef-Normal\t0\t7\t338\t2\t1\t55\t198\tmerca201\tmerca221\t350\t110\t820\t35\t627\t24\t138\t14\t109\t12\t720\t30\t36\t43\t8\t104\t4\t104\t4\t104\t4\t104\t4\tskillname104\t30\tJab\t14\t116\t4\t18\t0\tDefiance\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tOff-Normal\t0\t8\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t10\t45\t9\t57\t14\t40\t12\t20\t10\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname108\t30\tJab\t14\t70\t4\t3\t10\tBlessed Aim\t1\t10\t0\t3\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tOff-Normal\t0\t8\t338\t2\t1\t31\t198\tmerca201\tmerca221\t350\t110\t340\t20\t243\t16\t96\t14\t73\t12\t240\t20\t18\t25\t6\t62\t7\t62\t7\t62\t7\t62\t7\tskillname108\t30\tJab\t14\t92\t4\t10\t10\tBlessed Aim\t1\t10\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tOff-Normal\t0\t8\t338\t2\t1\t55\t198\tmerca201\tmerca221\t350\t110\t820\t35\t627\t24\t138\t14\t109\t12\t720\t30\t36\t43\t8\t104\t4\t104\t4\t104\t4\t104\t4\tskillname108\t30\tJab\t14\t116\t4\t18\t0\tBlessed Aim\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tComb-Nightmare\t0\t9\t338\t2\t2\t31\t198\tmerca201\tmerca221\t7900\t120\t306\t20\t219\t16\t92\t14\t69\t12\t216\t20\t16\t23\t6\t59\t7\t59\t7\t59\t7\t59\t7\tskillname103\t30\tJab\t14\t120\t4\t9\t10\tThorns\t1\t10\t0\t5\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tComb-Nightmare\t0\t9\t338\t2\t2\t55\t198\tmerca201\tmerca221\t7900\t120\t786\t35\t603\t24\t134\t14\t105\t12\t696\t30\t34\t41\t8\t101\t4\t101\t4\t101\t4\t101\t4\tskillname103\t30\tJab\t14\t144\t4\t17\t10\tThorns\t1\t10\t0\t13\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDef-Nightmare\t0\t10\t338\t2\t2\t31\t198\tmerca201\tmerca221\t7900\t120\t306\t20\t219\t16\t92\t14\t69\t12\t216\t20\t16\t23\t6\t59\t7\t59\t7\t59\t7\t59\t7\tskillname114\t30\tJab\t14\t120\t4\t9\t10\tHoly Freeze\t1\t10\t0\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDef-Nightmare\t0\t10\t338\t2\t2\t55\t198\tmerca201\tmerca221\t7900\t120\t786\t35\t603\t24\t134\t14\t105\t12\t696\t30\t34\t41\t8\t101\t4\t101\t4\t101\t4\t101\t4\tskillname114\t30\tJab\t14\t144\t4\t17\t0\tHoly Freeze\t1\t10\t0\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tOff-Nightmare\t0\t11\t338\t2\t2\t31\t198\tmerca201\tmerca221\t7900\t120\t306\t20\t219\t16\t92\t14\t69\t12\t216\t20\t16\t23\t6\t59\t7\t59\t7\t59\t7\t59\t7\tskillname98\t30\tJab\t14\t120\t4\t9\t10\tMight\t1\t10\t0\t7\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tOff-Nightmare\t0\t11\t338\t2\t2\t55\t198\tmerca201\tmerca221\t7900\t120\t786\t35\t603\t24\t134\t14\t105\t12\t696\t30\t34\t41\t8\t101\t4\t101\t4\t101\t4\t101\t4\tskillname98\t30\tJab\t14\t144\t4\t17\t0\tMight\t1\t10\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tComb-Hell\t0\t12\t338\t2\t3\t55\t198\tmerca201\tmerca221\t15000\t130\t707\t35\t543\t24\t130\t14\t101\t12\t626\t30\t32\t39\t8\t98\t4\t98\t4\t98\t4\t98\t4\tskillname99\t30\tJab\t14\t104\t4\t16\t10\tPrayer\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDef-Hell\t0\t13\t338\t2\t3\t55\t198\tmerca201\tmerca221\t15000\t130\t707\t35\t543\t24\t130\t14\t101\t12\t626\t30\t32\t39\t8\t98\t4\t98\t4\t98\t4\t98\t4\tskillname104\t30\tJab\t14\t104\t4\t16\t0\tDefiance\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tOff-Hell\t0\t14\t338\t2\t3\t55\t198\tmerca201\tmerca221\t15000\t130\t707\t35\t543\t24\t130\t14\t101\t12\t626\t30\t32\t39\t8\t98\t4\t98\t4\t98\t4\t98\t4\tskillname108\t30\tJab\t14\t104\t4\t16\t0\tBlessed Aim\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tPrayer-Normal\t100\t6\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t15\t45\t11\t57\t14\t40\t12\t20\t12\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname99\t30\tJab\t14\t70\t4\t3\t10\tPrayer\t1\t10\t0\t3\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tPrayer-Normal\t100\t6\t338\t2\t1\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname99\t30\tJab\t14\t104\t4\t14\t10\tPrayer\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tPrayer-Normal\t100\t6\t338\t2\t1\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname99\t30\tJab\t14\t136\t4\t24\t10\tPrayer\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDefiance-Normal\t100\t7\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t15\t45\t11\t57\t14\t40\t12\t20\t12\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname104\t30\tJab\t14\t70\t4\t3\t10\tDefiance\t1\t10\t0\t3\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDefiance-Normal\t100\t7\t338\t2\t1\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname104\t30\tJab\t14\t104\t4\t14\t10\tDefiance\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDefiance-Normal\t100\t7\t338\t2\t1\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname104\t30\tJab\t14\t136\t4\t24\t0\tDefiance\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tBlessedAim-Normal\t100\t8\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t15\t45\t11\t57\t14\t40\t12\t20\t12\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname108\t30\tJab\t14\t70\t4\t3\t10\tBlessed Aim\t1\t10\t0\t3\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tBlessedAim-Normal\t100\t8\t338\t2\t1\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname108\t30\tJab\t14\t104\t4\t14\t10\tBlessed Aim\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tBlessedAim-Normal\t100\t8\t338\t2\t1\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname108\t30\tJab\t14\t136\t4\t24\t0\tBlessed Aim\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tPrayer-Nightmare\t100\t30\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname99\t30\tJab\t14\t104\t4\t14\t10\tPrayer\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tPrayer-Nightmare\t100\t30\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname99\t30\tJab\t14\t136\t4\t24\t10\tPrayer\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDefiance-Nightmare\t100\t31\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname104\t30\tJab\t14\t104\t4\t14\t10\tDefiance\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDefiance-Nightmare\t100\t31\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname104\t30\tJab\t14\t136\t4\t24\t0\tDefiance\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tBlessedAim-Nightmare\t100\t32\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname108\t30\tJab\t14\t104\t4\t14\t10\tBlessed Aim\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tBlessedAim-Nightmare\t100\t32\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname108\t30\tJab\t14\t136\t4\t24\t0\tBlessed Aim\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tThorns-Nightmare\t100\t9\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t120\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname103\t30\tJab\t14\t104\t4\t13\t10\tThorns\t1\t10\t0\t11\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tThorns-Nightmare\t100\t9\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t120\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname103\t30\tJab\t14\t136\t4\t23\t10\tThorns\t1\t10\t0\t21\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tHolyFreeze-Nightmare\t100\t10\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t120\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname114\t30\tJab\t14\t104\t4\t13\t10\tHoly Freeze\t1\t10\t0\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tHolyFreeze-Nightmare\t100\t10\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t120\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname114\t30\tJab\t14\t136\t4\t23\t0\tHoly Freeze\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tMight-Nightmare\t100\t11\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t120\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname98\t30\tJab\t14\t104\t4\t13\t10\tMight\t1\t10\t0\t7\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tMight-Nightmare\t100\t11\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t120\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname98\t30\tJab\t14\t136\t4\t23\t0\tMight\t1\t10\t0\t15\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tComb-Hell\t100\t12\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname99\t30\tJab\t14\t136\t4\t24\t10\tPrayer\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tDef-Hell\t100\t13\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname104\t30\tJab\t14\t136\t4\t24\t0\tDefiance\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tOff-Hell\t100\t14\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname108\t30\tJab\t14\t136\t4\t24\t0\tBlessed Aim\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tThorns-Hell\t100\t33\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname103\t30\tJab\t14\t136\t4\t23\t10\tThorns\t1\t10\t0\t21\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tHolyFreeze-Hell\t100\t34\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname114\t30\tJab\t14\t136\t4\t23\t0\tHoly Freeze\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Desert Mercenary\tMight-Hell\t100\t35\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname98\t30\tJab\t14\t136\t4\t23\t0\tMight\t1\t10\t0\t15\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Normal\t0\t15\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1000\t110\t160\t8\t80\t4\t49\t10\t40\t8\t15\t10\t1\t7\t4\t25\t7\t25\t7\t25\t7\t25\t7\tstrhirespecial7\t10\tInferno\t7\t60\t0\t6\t10\tFire Ball\t7\t30\t0\t4\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Normal\t0\t15\t359\t3\t1\t37\t252\tmerca222\tmerca241\t1000\t110\t336\t14\t168\t10\t77\t10\t62\t8\t235\t20\t12\t18\t4\t64\t7\t64\t7\t64\t7\t64\t7\tstrhirespecial7\t10\tInferno\t7\t60\t0\t13\t10\tFire Ball\t7\t30\t0\t11\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Normal\t0\t15\t359\t3\t1\t61\t252\tmerca222\tmerca241\t1000\t110\t672\t20\t408\t18\t107\t10\t86\t8\t715\t30\t24\t30\t4\t106\t6\t106\t6\t106\t6\t106\t6\tstrhirespecial7\t10\tInferno\t7\t60\t0\t21\t10\tFire Ball\t7\t30\t0\t19\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Normal\t0\t16\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1500\t120\t160\t8\t80\t4\t49\t10\t40\t8\t15\t10\t1\t7\t4\t25\t7\t25\t7\t25\t7\t25\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t1\t5\tChilling Armor\t7\t1000\t0\t2\t10\tIce Blast\t7\t240\t0\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Normal\t0\t16\t359\t3\t1\t37\t252\tmerca222\tmerca241\t1500\t120\t336\t14\t168\t10\t77\t10\t62\t8\t235\t20\t12\t18\t4\t64\t7\t64\t7\t64\t7\t64\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t5\t5\tChilling Armor\t7\t1000\t0\t9\t10\tIce Blast\t7\t240\t0\t13\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Normal\t0\t16\t359\t3\t1\t61\t252\tmerca222\tmerca241\t1500\t120\t672\t20\t408\t16\t107\t10\t86\t8\t715\t30\t24\t30\t4\t106\t4\t106\t4\t106\t4\t106\t4\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t9\t5\tChilling Armor\t7\t1000\t0\t17\t10\tIce Blast\t7\t240\t0\t21\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Normal\t0\t17\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1000\t110\t160\t8\t80\t4\t49\t10\t40\t8\t15\t10\t1\t7\t4\t25\t7\t25\t7\t25\t7\t25\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t4\t5\tLightning\t7\t30\t0\t3\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Normal\t0\t17\t359\t3\t1\t37\t252\tmerca222\tmerca241\t1000\t110\t336\t14\t168\t10\t77\t10\t62\t8\t235\t20\t12\t18\t4\t64\t7\t64\t7\t64\t7\t64\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t8\t5\tLightning\t7\t30\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Normal\t0\t17\t359\t3\t1\t61\t252\tmerca222\tmerca241\t1000\t110\t672\t20\t408\t16\t107\t10\t86\t8\t715\t30\t24\t30\t4\t106\t4\t106\t4\t106\t4\t106\t4\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t12\t5\tLightning\t7\t30\t0\t18\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Nightmare\t0\t18\t359\t3\t2\t37\t252\tmerca222\tmerca241\t9500\t120\t302\t14\t151\t10\t73\t10\t58\t8\t212\t20\t10\t16\t4\t61\t7\t61\t7\t61\t7\t61\t7\tstrhirespecial7\t10\tInferno\t7\t60\t0\t12\t10\tFire Ball\t7\t30\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Nightmare\t0\t18\t359\t3\t2\t61\t252\tmerca222\tmerca241\t9500\t120\t638\t20\t391\t16\t103\t10\t82\t8\t692\t30\t22\t28\t4\t103\t4\t103\t4\t103\t4\t103\t4\tstrhirespecial7\t10\tInferno\t7\t60\t0\t20\t10\tFire Ball\t7\t30\t0\t18\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Nightmare\t0\t19\t359\t3\t2\t37\t252\tmerca222\tmerca241\t12000\t130\t302\t14\t151\t10\t73\t10\t58\t8\t212\t20\t10\t16\t4\t61\t7\t61\t7\t61\t7\t61\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t4\t5\tChilling Armor\t7\t1000\t0\t8\t10\tIce Blast\t7\t240\t0\t12\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Nightmare\t0\t19\t359\t3\t2\t61\t252\tmerca222\tmerca241\t12000\t130\t638\t20\t391\t16\t103\t10\t82\t8\t692\t30\t22\t28\t4\t103\t4\t103\t4\t103\t4\t103\t4\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t8\t5\tChilling Armor\t7\t1000\t0\t16\t10\tIce Blast\t7\t240\t0\t20\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Nightmare\t0\t20\t359\t3\t2\t37\t252\tmerca222\tmerca241\t10000\t120\t302\t14\t151\t10\t73\t10\t58\t8\t212\t20\t10\t16\t4\t61\t7\t61\t7\t61\t7\t61\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t7\t5\tLightning\t7\t30\t0\t9\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Nightmare\t0\t20\t359\t3\t2\t61\t252\tmerca222\tmerca241\t10000\t120\t638\t20\t391\t16\t103\t10\t82\t8\t692\t30\t22\t28\t4\t103\t4\t103\t4\t103\t4\t103\t4\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t11\t5\tLightning\t7\t30\t0\t17\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Hell\t0\t21\t359\t3\t3\t61\t252\tmerca222\tmerca241\t21000\t130\t574\t20\t352\t16\t99\t10\t78\t8\t623\t30\t20\t26\t4\t100\t4\t100\t4\t100\t4\t100\t4\tstrhirespecial7\t10\tInferno\t7\t60\t0\t19\t10\tFire Ball\t7\t30\t0\t17\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Hell\t0\t22\t359\t3\t3\t61\t252\tmerca222\tmerca241\t27000\t140\t574\t20\t352\t16\t99\t10\t78\t8\t623\t30\t20\t26\t4\t100\t4\t100\t4\t100\t4\t100\t4\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t7\t5\tChilling Armor\t7\t1000\t0\t15\t10\tIce Blast\t7\t240\t0\t19\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Hell\t0\t23\t359\t3\t3\t61\t252\tmerca222\tmerca241\t21000\t130\t574\t20\t352\t16\t99\t10\t78\t8\t623\t30\t20\t27\t4\t100\t4\t100\t4\t100\t4\t100\t4\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t10\t5\tLightning\t7\t30\t0\t16\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Normal\t100\t15\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1000\t110\t160\t11\t95\t9\t49\t10\t40\t8\t15\t12\t1\t7\t4\t35\t8\t35\t8\t35\t8\t35\t8\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t6\t10\tFire Ball\t7\t60\t0\t4\t10\tEnchant\t7\t30\t0\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Normal\t100\t15\t359\t3\t1\t49\t252\tmerca222\tmerca241\t10000\t120\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t17\t10\tFire Ball\t7\t60\t0\t15\t10\tEnchant\t7\t30\t0\t12\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Normal\t100\t15\t359\t3\t1\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t27\t10\tFire Ball\t7\t60\t0\t25\t10\tEnchant\t7\t30\t0\t26\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Normal\t100\t16\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1500\t120\t160\t11\t95\t9\t49\t10\t40\t8\t15\t12\t1\t7\t4\t35\t8\t35\t8\t35\t8\t35\t8\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t1\t5\tChilling Armor\t7\t1000\t0\t2\t10\tIce Blast\t7\t120\t0\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Normal\t100\t16\t359\t3\t1\t49\t252\tmerca222\tmerca241\t12000\t130\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t7\t10\tChilling Armor\t7\t1000\t0\t13\t15\tIce Blast\t7\t120\t0\t17\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Normal\t100\t16\t359\t3\t1\t79\t252\tmerca222\tmerca241\t27000\t140\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t22\t10\tChilling Armor\t7\t1000\t0\t27\t15\tIce Blast\t7\t120\t0\t27\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Normal\t100\t17\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1000\t110\t160\t11\t95\t9\t49\t10\t40\t8\t15\t12\t1\t7\t4\t35\t8\t35\t8\t35\t8\t35\t8\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t4\t10\tLightning\t7\t60\t0\t3\t10\tStatic Field\t7\t20\t0\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Normal\t100\t17\t359\t3\t1\t49\t252\tmerca222\tmerca241\t10000\t120\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t15\t10\tLightning\t7\t60\t4\t14\t10\tStatic Field\t7\t20\t2\t10\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Normal\t100\t17\t359\t3\t1\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t25\t10\tLightning\t7\t90\t0\t24\t10\tStatic Field\t7\t35\t0\t18\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Nightmare\t100\t18\t359\t3\t2\t49\t252\tmerca222\tmerca241\t10000\t120\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t17\t10\tFire Ball\t7\t60\t0\t15\t10\tEnchant\t7\t30\t0\t12\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Nightmare\t100\t18\t359\t3\t2\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t27\t10\tFire Ball\t7\t60\t0\t25\t10\tEnchant\t7\t30\t0\t26\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Nightmare\t100\t19\t359\t3\t2\t49\t252\tmerca222\tmerca241\t12000\t130\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t7\t10\tChilling Armor\t7\t1000\t0\t13\t15\tIce Blast\t7\t120\t0\t17\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Nightmare\t100\t19\t359\t3\t2\t79\t252\tmerca222\tmerca241\t27000\t140\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t22\t10\tChilling Armor\t7\t1000\t0\t27\t15\tIce Blast\t7\t120\t0\t27\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Nightmare\t100\t20\t359\t3\t2\t49\t252\tmerca222\tmerca241\t10000\t120\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t15\t10\tLightning\t7\t60\t4\t14\t10\tStatic Field\t7\t20\t2\t10\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Nightmare\t100\t20\t359\t3\t2\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t25\t10\tLightning\t7\t90\t0\t24\t10\tStatic Field\t7\t35\t0\t18\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tFire-Hell\t100\t21\t359\t3\t3\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t27\t10\tFire Ball\t7\t60\t0\t25\t10\tEnchant\t7\t30\t0\t26\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tCold-Hell\t100\t22\t359\t3\t3\t79\t252\tmerca222\tmerca241\t27000\t140\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t22\t10\tChilling Armor\t7\t1000\t0\t27\t15\tIce Blast\t7\t120\t0\t27\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Eastern Sorceror\tLtng-Hell\t100\t23\t359\t3\t3\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t25\t10\tLightning\t7\t90\t0\t24\t10\tStatic Field\t7\t35\t0\t18\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n";
-                ss << u8"Barbarian\t2hs-Normal\t0\t24\t561\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t288\t14\t180\t7\t101\t15\t63\t10\t150\t17\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tBash\t4\t15\t0\t4\t10\tStun\t4\t15\t0\t3\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t0\t24\t561\t5\t1\t42\t515\tMercX101\tMercX167\t9000\t120\t484\t21\t278\t20\t128\t15\t81\t10\t388\t27\t27\t31\t8\t81\t7\t81\t7\t81\t7\t81\t7\t\t50\tBash\t4\t50\t0\t9\t10\tStun\t4\t50\t0\t7\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t0\t24\t561\t5\t1\t75\t515\tMercX101\tMercX167\t9000\t120\t1177\t35\t938\t40\t190\t15\t123\t10\t1279\t37\t60\t64\t8\t139\t4\t139\t4\t139\t4\t139\t4\t\t50\tBash\t4\t75\t0\t20\t0\tStun\t4\t75\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t0\t25\t561\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t288\t14\t180\t7\t101\t15\t63\t10\t150\t17\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tBash\t4\t15\t0\t4\t10\tStun\t4\t15\t0\t3\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t0\t25\t561\t5\t1\t42\t515\tMercX101\tMercX167\t9000\t120\t484\t21\t278\t20\t128\t15\t81\t10\t388\t27\t27\t31\t8\t81\t7\t81\t7\t81\t7\t81\t7\t\t50\tBash\t4\t50\t0\t9\t10\tStun\t4\t50\t0\t7\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t0\t25\t561\t5\t1\t75\t515\tMercX101\tMercX167\t9000\t120\t1177\t35\t938\t40\t190\t15\t123\t10\t1279\t37\t60\t64\t8\t139\t4\t139\t4\t139\t4\t139\t4\t\t50\tBash\t4\t75\t0\t20\t0\tStun\t4\t75\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Nightmare\t0\t26\t561\t5\t2\t42\t515\tMercX101\tMercX167\t18000\t130\t436\t21\t250\t20\t125\t15\t76\t10\t349\t27\t25\t29\t8\t78\t7\t78\t7\t78\t7\t78\t7\t\t50\tBash\t4\t50\t0\t8\t10\tStun\t4\t50\t0\t6\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Nightmare\t0\t26\t561\t5\t2\t75\t515\tMercX101\tMercX167\t18000\t130\t1129\t35\t910\t40\t187\t15\t118\t10\t1240\t37\t58\t62\t8\t136\t4\t136\t4\t136\t4\t136\t4\t\t50\tBash\t4\t75\t0\t19\t0\tStun\t4\t75\t0\t15\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Nightmare\t0\t27\t561\t5\t2\t42\t515\tMercX101\tMercX167\t18000\t130\t436\t21\t250\t20\t125\t15\t76\t10\t349\t27\t25\t29\t8\t78\t7\t78\t7\t78\t7\t78\t7\t\t50\tBash\t4\t50\t0\t8\t10\tStun\t4\t50\t0\t6\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Nightmare\t0\t27\t561\t5\t2\t75\t515\tMercX101\tMercX167\t18000\t130\t1129\t35\t910\t40\t187\t15\t118\t10\t1240\t37\t58\t62\t8\t136\t4\t136\t4\t136\t4\t136\t4\t\t50\tBash\t4\t75\t0\t19\t0\tStun\t4\t75\t0\t15\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Hell\t0\t28\t561\t5\t3\t75\t515\tMercX101\tMercX167\t32000\t140\t1016\t35\t819\t40\t184\t15\t113\t10\t1116\t37\t56\t60\t8\t133\t4\t133\t4\t133\t4\t133\t4\t\t50\tBash\t4\t70\t0\t18\t0\tStun\t4\t70\t0\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Hell\t0\t29\t561\t5\t3\t75\t515\tMercX101\tMercX167\t32000\t140\t1016\t35\t819\t40\t184\t15\t113\t10\t1116\t37\t56\t60\t8\t133\t4\t133\t4\t133\t4\t133\t4\t\t50\tBash\t4\t70\t0\t18\t0\tStun\t4\t70\t0\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t100\t24\t561\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t450\t19\t300\t15\t101\t15\t63\t10\t150\t20\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tBash\t4\t15\t0\t8\t10\tStun\t4\t15\t0\t6\t8\tBattle Cry\t4\t15\t0\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t100\t24\t561\t5\t1\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tBash\t4\t50\t0\t18\t10\tStun\t4\t50\t0\t14\t8\tBattle Cry\t4\t15\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t100\t24\t561\t5\t1\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t100\t25\t561\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t450\t19\t300\t15\t101\t15\t63\t10\t150\t20\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tBash\t4\t15\t0\t8\t10\tStun\t4\t15\t0\t6\t8\tBattle Cry\t4\t15\t0\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t100\t25\t561\t5\t1\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tBash\t4\t50\t0\t18\t10\tStun\t4\t50\t0\t14\t8\tBattle Cry\t4\t15\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Normal\t100\t25\t561\t5\t1\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t1hs-Normal\t100\t36\t560\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t450\t19\t300\t15\t101\t15\t63\t10\t150\t20\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tFrenzy\t4\t22\t1\t2\t7\tIron Skin\t5\t0\t0\t2\t6\tTaunt\t5\t20\t1\t7\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t1hs-Normal\t100\t36\t560\t5\t1\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tFrenzy\t4\t29\t1\t9\t7\tIron Skin\t5\t0\t0\t8\t6\tTaunt\t5\t27\t1\t13\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t1hs-Normal\t100\t36\t560\t5\t1\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tFrenzy\t4\t35\t1\t13\t7\tIron Skin\t5\t0\t0\t12\t6\tTaunt\t5\t33\t1\t17\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Nightmare\t100\t26\t561\t5\t2\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tBash\t4\t50\t0\t18\t10\tStun\t4\t50\t0\t14\t8\tBattle Cry\t4\t15\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Nightmare\t100\t26\t561\t5\t2\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Nightmare\t100\t27\t561\t5\t2\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tBash\t4\t50\t0\t18\t10\tStun\t4\t50\t0\t14\t8\tBattle Cry\t4\t15\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Nightmare\t100\t27\t561\t5\t2\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t1hs-Nightmare\t100\t37\t560\t5\t2\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tFrenzy\t4\t29\t1\t9\t7\tIron Skin\t5\t0\t0\t8\t6\tTaunt\t5\t27\t1\t13\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t1hs-Nightmare\t100\t37\t560\t5\t2\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tFrenzy\t4\t35\t1\t13\t7\tIron Skin\t5\t0\t0\t12\t6\tTaunt\t5\t33\t1\t17\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Hell\t100\t28\t561\t5\t3\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t2hs-Hell\t100\t29\t561\t5\t3\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                ss << u8"Barbarian\t1hs-Hell\t100\t38\t560\t5\t3\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tFrenzy\t4\t35\t1\t13\t7\tIron Skin\t5\t0\t0\t12\t6\tTaunt\t5\t33\t1\t17\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"Hireling\t*SubType\tVersion\tId\tClass\tAct\tDifficulty\tLevel\tSeller\tNameFirst\tNameLast\tGold\tExp/Lvl\tHP\tHP/Lvl\tDefense\tDef/Lvl\tStr\tStr/Lvl\tDex\tDex/Lvl\tAR\tAR/Lvl\tDmg-Min\tDmg-Max\tDmg/Lvl\tResistFire\tResistFire/Lvl\tResistCold\tResistCold/Lvl\tResistLightning\tResistLightning/Lvl\tResistPoison\tResistPoison/Lvl\tHireDesc\tDefaultChance\tSkill1\tMode1\tChance1\tChancePerLvl1\tLevel1\tLvlPerLvl1\tSkill2\tMode2\tChance2\tChancePerLvl2\tLevel2\tLvlPerLvl2\tSkill3\tMode3\tChance3\tChancePerLvl3\tLevel3\tLvlPerLvl3\tSkill4\tMode4\tChance4\tChancePerLvl4\tLevel4\tLvlPerLvl4\tSkill5\tMode5\tChance5\tChancePerLvl5\tLevel5\tLvlPerLvl5\tSkill6\tMode6\tChance6\tChancePerLvl6\tLevel6\tLvlPerLvl6\tHiringMaxLevelDifference\tresurrectcostmultiplier\tresurrectcostdivisor\tresurrectcostmax\tequivalentcharclass\n",
+                u8"Rogue Scout\tFire - Normal\t0\t0\t271\t1\t1\t3\t150\tmerc01\tmerc41\t100\t100\t45\t8\t15\t6\t35\t10\t45\t16\t10\t10\t1\t3\t2\t0\t8\t0\t8\t0\t8\t0\t8\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t1\t10\tFire Arrow\t4\t25\t8\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Normal\t0\t0\t271\t1\t1\t25\t150\tmerc01\tmerc41\t100\t100\t221\t13\t147\t12\t63\t10\t89\t16\t230\t20\t7\t9\t4\t44\t7\t44\t7\t44\t7\t44\t7\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t8\t10\tFire Arrow\t4\t69\t0\t8\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Normal\t0\t0\t271\t1\t1\t49\t150\tmerc01\tmerc41\t100\t100\t533\t25\t435\t18\t93\t10\t137\t16\t710\t30\t19\t21\t6\t86\t5\t86\t5\t86\t5\t86\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t16\t10\tFire Arrow\t4\t69\t0\t16\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Normal\t0\t1\t271\t1\t1\t3\t150\tmerc01\tmerc41\t150\t105\t45\t8\t15\t6\t35\t10\t45\t16\t10\t10\t1\t3\t2\t0\t8\t0\t8\t0\t8\t0\t8\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t1\t10\tCold Arrow\t4\t25\t2\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Normal\t0\t1\t271\t1\t1\t25\t150\tmerc01\tmerc41\t150\t105\t221\t12\t147\t12\t63\t10\t89\t16\t230\t20\t7\t9\t4\t44\t7\t44\t7\t44\t7\t44\t7\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t8\t10\tCold Arrow\t4\t36\t0\t8\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Normal\t0\t1\t271\t1\t1\t49\t150\tmerc01\tmerc41\t150\t105\t509\t16\t435\t18\t93\t10\t137\t16\t710\t30\t19\t21\t6\t86\t5\t86\t5\t86\t5\t86\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t16\t10\tCold Arrow\t4\t36\t0\t16\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Nightmare\t0\t2\t271\t1\t2\t25\t150\tmerc01\tmerc41\t6000\t110\t199\t12\t132\t12\t60\t10\t84\t16\t207\t20\t6\t8\t4\t41\t7\t41\t7\t41\t7\t41\t7\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t7\t10\tFire Arrow\t4\t69\t0\t7\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Nightmare\t0\t2\t271\t1\t2\t49\t150\tmerc01\tmerc41\t6000\t110\t487\t16\t420\t18\t90\t10\t132\t16\t687\t30\t18\t20\t6\t83\t5\t83\t5\t83\t5\t83\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t15\t10\tFire Arrow\t4\t69\t0\t15\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Nightmare\t0\t3\t271\t1\t2\t25\t150\tmerc01\tmerc41\t7500\t115\t199\t12\t132\t12\t60\t10\t84\t16\t207\t20\t6\t8\t4\t41\t7\t41\t7\t41\t7\t41\t7\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t7\t10\tCold Arrow\t4\t69\t0\t7\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Nightmare\t0\t3\t271\t1\t2\t49\t150\tmerc01\tmerc41\t7500\t115\t487\t16\t420\t18\t90\t10\t132\t16\t687\t30\t18\t20\t6\t83\t5\t83\t5\t83\t5\t83\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t15\t10\tCold Arrow\t4\t69\t0\t15\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Hell\t0\t4\t271\t1\t3\t49\t150\tmerc01\tmerc41\t12500\t120\t438\t16\t378\t18\t87\t10\t127\t16\t618\t30\t17\t19\t6\t80\t5\t80\t5\t80\t5\t80\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t14\t10\tFire Arrow\t4\t69\t0\t14\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Hell\t0\t5\t271\t1\t3\t49\t150\tmerc01\tmerc41\t14000\t125\t438\t16\t378\t18\t87\t10\t127\t16\t618\t30\t17\t19\t6\t80\t5\t80\t5\t80\t5\t80\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t14\t10\tCold Arrow\t4\t69\t0\t14\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Normal\t100\t0\t271\t1\t1\t3\t150\tmerc01\tmerc41\t100\t100\t45\t9\t15\t8\t35\t10\t45\t16\t10\t12\t1\t3\t2\t0\t8\t0\t8\t0\t8\t0\t8\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t1\t10\tFire Arrow\t4\t25\t5\t1\t10\tExploding Arrow\t4\t0\t4\t1\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Normal\t100\t0\t271\t1\t1\t36\t150\tmerc01\tmerc41\t6000\t110\t342\t18\t279\t15\t77\t10\t111\t16\t406\t24\t9\t11\t4\t66\t7\t66\t7\t66\t7\t66\t7\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t12\t10\tFire Arrow\t4\t67\t0\t12\t10\tExploding Arrow\t4\t33\t10\t7\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Normal\t100\t0\t271\t1\t1\t67\t150\tmerc01\tmerc41\t12500\t120\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t22\t10\tFire Arrow\t4\t67\t0\t22\t10\tExploding Arrow\t4\t111\t0\t12\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Normal\t100\t1\t271\t1\t1\t3\t150\tmerc01\tmerc41\t150\t105\t45\t9\t15\t8\t35\t10\t45\t16\t10\t12\t1\t3\t2\t0\t8\t0\t8\t0\t8\t0\t8\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t1\t10\tCold Arrow\t4\t25\t5\t1\t10\tFreezing Arrow\t4\t0\t4\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Normal\t100\t1\t271\t1\t1\t36\t150\tmerc01\tmerc41\t7500\t115\t342\t18\t279\t15\t77\t10\t111\t16\t406\t24\t9\t11\t4\t66\t7\t66\t7\t66\t7\t66\t7\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t12\t10\tCold Arrow\t4\t67\t0\t12\t10\tFreezing Arrow\t4\t33\t10\t4\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Normal\t100\t1\t271\t1\t1\t67\t150\tmerc01\tmerc41\t14000\t125\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t22\t10\tCold Arrow\t4\t67\t0\t22\t10\tFreezing Arrow\t4\t111\t0\t7\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Nightmare\t100\t2\t271\t1\t2\t36\t150\tmerc01\tmerc41\t6000\t110\t342\t18\t279\t15\t77\t10\t111\t16\t406\t24\t9\t11\t4\t66\t7\t66\t7\t66\t7\t66\t7\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t12\t10\tFire Arrow\t4\t67\t0\t12\t10\tExploding Arrow\t4\t33\t10\t7\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Nightmare\t100\t2\t271\t1\t2\t67\t150\tmerc01\tmerc41\t12500\t120\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t22\t10\tFire Arrow\t4\t67\t0\t22\t10\tExploding Arrow\t4\t111\t0\t12\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Nightmare\t100\t3\t271\t1\t2\t36\t150\tmerc01\tmerc41\t7500\t115\t342\t18\t279\t15\t77\t10\t111\t16\t406\t24\t9\t11\t4\t66\t7\t66\t7\t66\t7\t66\t7\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t12\t10\tCold Arrow\t4\t67\t0\t12\t10\tFreezing Arrow\t4\t33\t10\t4\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Nightmare\t100\t3\t271\t1\t2\t67\t150\tmerc01\tmerc41\t14000\t125\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t22\t10\tCold Arrow\t4\t67\t0\t22\t10\tFreezing Arrow\t4\t111\t0\t7\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tFire - Hell\t100\t4\t271\t1\t3\t67\t150\tmerc01\tmerc41\t12500\t120\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial1\t75\tInner Sight\t4\t10\t0\t22\t10\tFire Arrow\t4\t67\t0\t22\t10\tExploding Arrow\t4\t111\t0\t12\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Rogue Scout\tIce - Hell\t100\t5\t271\t1\t3\t67\t150\tmerc01\tmerc41\t14000\t125\t900\t30\t744\t23\t116\t10\t173\t16\t1150\t36\t25\t27\t6\t121\t5\t121\t5\t121\t5\t121\t5\tstrhirespecial2\t75\tInner Sight\t4\t10\t0\t22\t10\tCold Arrow\t4\t67\t0\t22\t10\tFreezing Arrow\t4\t111\t0\t7\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tama\n",
+                u8"Desert Mercenary\tComb-Normal\t0\t6\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t15\t45\t11\t57\t14\t40\t12\t20\t12\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname99\t30\tJab\t14\t70\t4\t3\t10\tPrayer\t1\t10\t0\t3\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tComb-Normal\t0\t6\t338\t2\t1\t31\t198\tmerca201\tmerca221\t350\t110\t340\t20\t243\t16\t96\t14\t73\t12\t240\t20\t18\t25\t6\t62\t7\t62\t7\t62\t7\t62\t7\tskillname99\t30\tJab\t14\t92\t4\t10\t10\tPrayer\t1\t10\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tComb-Normal\t0\t6\t338\t2\t1\t55\t198\tmerca201\tmerca221\t350\t110\t820\t35\t627\t24\t138\t14\t109\t12\t720\t30\t36\t43\t8\t104\t4\t104\t4\t104\t4\t104\t4\tskillname99\t30\tJab\t14\t116\t4\t18\t10\tPrayer\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDef-Normal\t0\t7\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t10\t45\t9\t57\t14\t40\t12\t20\t10\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname104\t30\tJab\t14\t70\t4\t3\t10\tDefiance\t1\t10\t0\t3\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDef-Normal\t0\t7\t338\t2\t1\t31\t198\tmerca201\tmerca221\t350\t110\t340\t20\t243\t16\t96\t14\t73\t12\t240\t20\t18\t25\t6\t62\t7\t62\t7\t62\t7\t62\t7\tskillname104\t30\tJab\t14\t92\t4\t10\t10\tDefiance\t1\t10\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDef-Normal\t0\t7\t338\t2\t1\t55\t198\tmerca201\tmerca221\t350\t110\t820\t35\t627\t24\t138\t14\t109\t12\t720\t30\t36\t43\t8\t104\t4\t104\t4\t104\t4\t104\t4\tskillname104\t30\tJab\t14\t116\t4\t18\t0\tDefiance\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tOff-Normal\t0\t8\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t10\t45\t9\t57\t14\t40\t12\t20\t10\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname108\t30\tJab\t14\t70\t4\t3\t10\tBlessed Aim\t1\t10\t0\t3\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tOff-Normal\t0\t8\t338\t2\t1\t31\t198\tmerca201\tmerca221\t350\t110\t340\t20\t243\t16\t96\t14\t73\t12\t240\t20\t18\t25\t6\t62\t7\t62\t7\t62\t7\t62\t7\tskillname108\t30\tJab\t14\t92\t4\t10\t10\tBlessed Aim\t1\t10\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tOff-Normal\t0\t8\t338\t2\t1\t55\t198\tmerca201\tmerca221\t350\t110\t820\t35\t627\t24\t138\t14\t109\t12\t720\t30\t36\t43\t8\t104\t4\t104\t4\t104\t4\t104\t4\tskillname108\t30\tJab\t14\t116\t4\t18\t0\tBlessed Aim\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tComb-Nightmare\t0\t9\t338\t2\t2\t31\t198\tmerca201\tmerca221\t7900\t120\t306\t20\t219\t16\t92\t14\t69\t12\t216\t20\t16\t23\t6\t59\t7\t59\t7\t59\t7\t59\t7\tskillname103\t30\tJab\t14\t120\t4\t9\t10\tThorns\t1\t10\t0\t5\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tComb-Nightmare\t0\t9\t338\t2\t2\t55\t198\tmerca201\tmerca221\t7900\t120\t786\t35\t603\t24\t134\t14\t105\t12\t696\t30\t34\t41\t8\t101\t4\t101\t4\t101\t4\t101\t4\tskillname103\t30\tJab\t14\t144\t4\t17\t10\tThorns\t1\t10\t0\t13\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDef-Nightmare\t0\t10\t338\t2\t2\t31\t198\tmerca201\tmerca221\t7900\t120\t306\t20\t219\t16\t92\t14\t69\t12\t216\t20\t16\t23\t6\t59\t7\t59\t7\t59\t7\t59\t7\tskillname114\t30\tJab\t14\t120\t4\t9\t10\tHoly Freeze\t1\t10\t0\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDef-Nightmare\t0\t10\t338\t2\t2\t55\t198\tmerca201\tmerca221\t7900\t120\t786\t35\t603\t24\t134\t14\t105\t12\t696\t30\t34\t41\t8\t101\t4\t101\t4\t101\t4\t101\t4\tskillname114\t30\tJab\t14\t144\t4\t17\t0\tHoly Freeze\t1\t10\t0\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tOff-Nightmare\t0\t11\t338\t2\t2\t31\t198\tmerca201\tmerca221\t7900\t120\t306\t20\t219\t16\t92\t14\t69\t12\t216\t20\t16\t23\t6\t59\t7\t59\t7\t59\t7\t59\t7\tskillname98\t30\tJab\t14\t120\t4\t9\t10\tMight\t1\t10\t0\t7\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tOff-Nightmare\t0\t11\t338\t2\t2\t55\t198\tmerca201\tmerca221\t7900\t120\t786\t35\t603\t24\t134\t14\t105\t12\t696\t30\t34\t41\t8\t101\t4\t101\t4\t101\t4\t101\t4\tskillname98\t30\tJab\t14\t144\t4\t17\t0\tMight\t1\t10\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tComb-Hell\t0\t12\t338\t2\t3\t55\t198\tmerca201\tmerca221\t15000\t130\t707\t35\t543\t24\t130\t14\t101\t12\t626\t30\t32\t39\t8\t98\t4\t98\t4\t98\t4\t98\t4\tskillname99\t30\tJab\t14\t104\t4\t16\t10\tPrayer\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDef-Hell\t0\t13\t338\t2\t3\t55\t198\tmerca201\tmerca221\t15000\t130\t707\t35\t543\t24\t130\t14\t101\t12\t626\t30\t32\t39\t8\t98\t4\t98\t4\t98\t4\t98\t4\tskillname104\t30\tJab\t14\t104\t4\t16\t0\tDefiance\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tOff-Hell\t0\t14\t338\t2\t3\t55\t198\tmerca201\tmerca221\t15000\t130\t707\t35\t543\t24\t130\t14\t101\t12\t626\t30\t32\t39\t8\t98\t4\t98\t4\t98\t4\t98\t4\tskillname108\t30\tJab\t14\t104\t4\t16\t0\tBlessed Aim\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tPrayer-Normal\t100\t6\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t15\t45\t11\t57\t14\t40\t12\t20\t12\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname99\t30\tJab\t14\t70\t4\t3\t10\tPrayer\t1\t10\t0\t3\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tPrayer-Normal\t100\t6\t338\t2\t1\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname99\t30\tJab\t14\t104\t4\t14\t10\tPrayer\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tPrayer-Normal\t100\t6\t338\t2\t1\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname99\t30\tJab\t14\t136\t4\t24\t10\tPrayer\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDefiance-Normal\t100\t7\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t15\t45\t11\t57\t14\t40\t12\t20\t12\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname104\t30\tJab\t14\t70\t4\t3\t10\tDefiance\t1\t10\t0\t3\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDefiance-Normal\t100\t7\t338\t2\t1\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname104\t30\tJab\t14\t104\t4\t14\t10\tDefiance\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDefiance-Normal\t100\t7\t338\t2\t1\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname104\t30\tJab\t14\t136\t4\t24\t0\tDefiance\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tBlessedAim-Normal\t100\t8\t338\t2\t1\t9\t198\tmerca201\tmerca221\t350\t110\t120\t15\t45\t11\t57\t14\t40\t12\t20\t12\t7\t14\t4\t18\t8\t18\t8\t18\t8\t18\t8\tskillname108\t30\tJab\t14\t70\t4\t3\t10\tBlessed Aim\t1\t10\t0\t3\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tBlessedAim-Normal\t100\t8\t338\t2\t1\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname108\t30\tJab\t14\t104\t4\t14\t10\tBlessed Aim\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tBlessedAim-Normal\t100\t8\t338\t2\t1\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname108\t30\tJab\t14\t136\t4\t24\t0\tBlessed Aim\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tPrayer-Nightmare\t100\t30\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname99\t30\tJab\t14\t104\t4\t14\t10\tPrayer\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tPrayer-Nightmare\t100\t30\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname99\t30\tJab\t14\t136\t4\t24\t10\tPrayer\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDefiance-Nightmare\t100\t31\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname104\t30\tJab\t14\t104\t4\t14\t10\tDefiance\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDefiance-Nightmare\t100\t31\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname104\t30\tJab\t14\t136\t4\t24\t0\tDefiance\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tBlessedAim-Nightmare\t100\t32\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t110\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname108\t30\tJab\t14\t104\t4\t14\t10\tBlessed Aim\t1\t10\t0\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tBlessedAim-Nightmare\t100\t32\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t110\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname108\t30\tJab\t14\t136\t4\t24\t0\tBlessed Aim\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tThorns-Nightmare\t100\t9\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t120\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname103\t30\tJab\t14\t104\t4\t13\t10\tThorns\t1\t10\t0\t11\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tThorns-Nightmare\t100\t9\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t120\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname103\t30\tJab\t14\t136\t4\t23\t10\tThorns\t1\t10\t0\t21\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tHolyFreeze-Nightmare\t100\t10\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t120\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname114\t30\tJab\t14\t104\t4\t13\t10\tHoly Freeze\t1\t10\t0\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tHolyFreeze-Nightmare\t100\t10\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t120\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname114\t30\tJab\t14\t136\t4\t23\t0\tHoly Freeze\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tMight-Nightmare\t100\t11\t338\t2\t2\t43\t198\tmerca201\tmerca221\t7900\t120\t630\t25\t419\t19\t117\t14\t91\t12\t428\t24\t24\t31\t6\t86\t7\t86\t7\t86\t7\t86\t7\tskillname98\t30\tJab\t14\t104\t4\t13\t10\tMight\t1\t10\t0\t7\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tMight-Nightmare\t100\t11\t338\t2\t2\t75\t198\tmerca201\tmerca221\t15000\t120\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname98\t30\tJab\t14\t136\t4\t23\t0\tMight\t1\t10\t0\t15\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tComb-Hell\t100\t12\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname99\t30\tJab\t14\t136\t4\t24\t10\tPrayer\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tDef-Hell\t100\t13\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname104\t30\tJab\t14\t136\t4\t24\t0\tDefiance\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tOff-Hell\t100\t14\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname108\t30\tJab\t14\t136\t4\t24\t0\tBlessed Aim\t1\t10\t0\t18\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tThorns-Hell\t100\t33\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname103\t30\tJab\t14\t136\t4\t23\t10\tThorns\t1\t10\t0\t21\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tHolyFreeze-Hell\t100\t34\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname114\t30\tJab\t14\t136\t4\t23\t0\tHoly Freeze\t1\t10\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Desert Mercenary\tMight-Hell\t100\t35\t338\t2\t3\t75\t198\tmerca201\tmerca221\t15000\t130\t1430\t40\t1027\t28\t173\t14\t139\t12\t1196\t36\t48\t55\t8\t142\t4\t142\t4\t142\t4\t142\t4\tskillname98\t30\tJab\t14\t136\t4\t23\t0\tMight\t1\t10\t0\t15\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Normal\t0\t15\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1000\t110\t160\t8\t80\t4\t49\t10\t40\t8\t15\t10\t1\t7\t4\t25\t7\t25\t7\t25\t7\t25\t7\tstrhirespecial7\t10\tInferno\t7\t60\t0\t6\t10\tFire Ball\t7\t30\t0\t4\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Normal\t0\t15\t359\t3\t1\t37\t252\tmerca222\tmerca241\t1000\t110\t336\t14\t168\t10\t77\t10\t62\t8\t235\t20\t12\t18\t4\t64\t7\t64\t7\t64\t7\t64\t7\tstrhirespecial7\t10\tInferno\t7\t60\t0\t13\t10\tFire Ball\t7\t30\t0\t11\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Normal\t0\t15\t359\t3\t1\t61\t252\tmerca222\tmerca241\t1000\t110\t672\t20\t408\t18\t107\t10\t86\t8\t715\t30\t24\t30\t4\t106\t6\t106\t6\t106\t6\t106\t6\tstrhirespecial7\t10\tInferno\t7\t60\t0\t21\t10\tFire Ball\t7\t30\t0\t19\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Normal\t0\t16\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1500\t120\t160\t8\t80\t4\t49\t10\t40\t8\t15\t10\t1\t7\t4\t25\t7\t25\t7\t25\t7\t25\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t1\t5\tChilling Armor\t7\t1000\t0\t2\t10\tIce Blast\t7\t240\t0\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Normal\t0\t16\t359\t3\t1\t37\t252\tmerca222\tmerca241\t1500\t120\t336\t14\t168\t10\t77\t10\t62\t8\t235\t20\t12\t18\t4\t64\t7\t64\t7\t64\t7\t64\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t5\t5\tChilling Armor\t7\t1000\t0\t9\t10\tIce Blast\t7\t240\t0\t13\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Normal\t0\t16\t359\t3\t1\t61\t252\tmerca222\tmerca241\t1500\t120\t672\t20\t408\t16\t107\t10\t86\t8\t715\t30\t24\t30\t4\t106\t4\t106\t4\t106\t4\t106\t4\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t9\t5\tChilling Armor\t7\t1000\t0\t17\t10\tIce Blast\t7\t240\t0\t21\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Normal\t0\t17\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1000\t110\t160\t8\t80\t4\t49\t10\t40\t8\t15\t10\t1\t7\t4\t25\t7\t25\t7\t25\t7\t25\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t4\t5\tLightning\t7\t30\t0\t3\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Normal\t0\t17\t359\t3\t1\t37\t252\tmerca222\tmerca241\t1000\t110\t336\t14\t168\t10\t77\t10\t62\t8\t235\t20\t12\t18\t4\t64\t7\t64\t7\t64\t7\t64\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t8\t5\tLightning\t7\t30\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Normal\t0\t17\t359\t3\t1\t61\t252\tmerca222\tmerca241\t1000\t110\t672\t20\t408\t16\t107\t10\t86\t8\t715\t30\t24\t30\t4\t106\t4\t106\t4\t106\t4\t106\t4\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t12\t5\tLightning\t7\t30\t0\t18\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Nightmare\t0\t18\t359\t3\t2\t37\t252\tmerca222\tmerca241\t9500\t120\t302\t14\t151\t10\t73\t10\t58\t8\t212\t20\t10\t16\t4\t61\t7\t61\t7\t61\t7\t61\t7\tstrhirespecial7\t10\tInferno\t7\t60\t0\t12\t10\tFire Ball\t7\t30\t0\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Nightmare\t0\t18\t359\t3\t2\t61\t252\tmerca222\tmerca241\t9500\t120\t638\t20\t391\t16\t103\t10\t82\t8\t692\t30\t22\t28\t4\t103\t4\t103\t4\t103\t4\t103\t4\tstrhirespecial7\t10\tInferno\t7\t60\t0\t20\t10\tFire Ball\t7\t30\t0\t18\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Nightmare\t0\t19\t359\t3\t2\t37\t252\tmerca222\tmerca241\t12000\t130\t302\t14\t151\t10\t73\t10\t58\t8\t212\t20\t10\t16\t4\t61\t7\t61\t7\t61\t7\t61\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t4\t5\tChilling Armor\t7\t1000\t0\t8\t10\tIce Blast\t7\t240\t0\t12\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Nightmare\t0\t19\t359\t3\t2\t61\t252\tmerca222\tmerca241\t12000\t130\t638\t20\t391\t16\t103\t10\t82\t8\t692\t30\t22\t28\t4\t103\t4\t103\t4\t103\t4\t103\t4\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t8\t5\tChilling Armor\t7\t1000\t0\t16\t10\tIce Blast\t7\t240\t0\t20\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Nightmare\t0\t20\t359\t3\t2\t37\t252\tmerca222\tmerca241\t10000\t120\t302\t14\t151\t10\t73\t10\t58\t8\t212\t20\t10\t16\t4\t61\t7\t61\t7\t61\t7\t61\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t7\t5\tLightning\t7\t30\t0\t9\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Nightmare\t0\t20\t359\t3\t2\t61\t252\tmerca222\tmerca241\t10000\t120\t638\t20\t391\t16\t103\t10\t82\t8\t692\t30\t22\t28\t4\t103\t4\t103\t4\t103\t4\t103\t4\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t11\t5\tLightning\t7\t30\t0\t17\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Hell\t0\t21\t359\t3\t3\t61\t252\tmerca222\tmerca241\t21000\t130\t574\t20\t352\t16\t99\t10\t78\t8\t623\t30\t20\t26\t4\t100\t4\t100\t4\t100\t4\t100\t4\tstrhirespecial7\t10\tInferno\t7\t60\t0\t19\t10\tFire Ball\t7\t30\t0\t17\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Hell\t0\t22\t359\t3\t3\t61\t252\tmerca222\tmerca241\t27000\t140\t574\t20\t352\t16\t99\t10\t78\t8\t623\t30\t20\t26\t4\t100\t4\t100\t4\t100\t4\t100\t4\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t7\t5\tChilling Armor\t7\t1000\t0\t15\t10\tIce Blast\t7\t240\t0\t19\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Hell\t0\t23\t359\t3\t3\t61\t252\tmerca222\tmerca241\t21000\t130\t574\t20\t352\t16\t99\t10\t78\t8\t623\t30\t20\t27\t4\t100\t4\t100\t4\t100\t4\t100\t4\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t10\t5\tLightning\t7\t30\t0\t16\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Normal\t100\t15\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1000\t110\t160\t11\t95\t9\t49\t10\t40\t8\t15\t12\t1\t7\t4\t35\t8\t35\t8\t35\t8\t35\t8\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t6\t10\tFire Ball\t7\t60\t0\t4\t10\tEnchant\t7\t30\t0\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Normal\t100\t15\t359\t3\t1\t49\t252\tmerca222\tmerca241\t10000\t120\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t17\t10\tFire Ball\t7\t60\t0\t15\t10\tEnchant\t7\t30\t0\t12\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Normal\t100\t15\t359\t3\t1\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t27\t10\tFire Ball\t7\t60\t0\t25\t10\tEnchant\t7\t30\t0\t26\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Normal\t100\t16\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1500\t120\t160\t11\t95\t9\t49\t10\t40\t8\t15\t12\t1\t7\t4\t35\t8\t35\t8\t35\t8\t35\t8\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t1\t5\tChilling Armor\t7\t1000\t0\t2\t10\tIce Blast\t7\t120\t0\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Normal\t100\t16\t359\t3\t1\t49\t252\tmerca222\tmerca241\t12000\t130\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t7\t10\tChilling Armor\t7\t1000\t0\t13\t15\tIce Blast\t7\t120\t0\t17\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Normal\t100\t16\t359\t3\t1\t79\t252\tmerca222\tmerca241\t27000\t140\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t22\t10\tChilling Armor\t7\t1000\t0\t27\t15\tIce Blast\t7\t120\t0\t27\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Normal\t100\t17\t359\t3\t1\t15\t252\tmerca222\tmerca241\t1000\t110\t160\t11\t95\t9\t49\t10\t40\t8\t15\t12\t1\t7\t4\t35\t8\t35\t8\t35\t8\t35\t8\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t4\t10\tLightning\t7\t60\t0\t3\t10\tStatic Field\t7\t20\t0\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Normal\t100\t17\t359\t3\t1\t49\t252\tmerca222\tmerca241\t10000\t120\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t15\t10\tLightning\t7\t60\t4\t14\t10\tStatic Field\t7\t20\t2\t10\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Normal\t100\t17\t359\t3\t1\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t25\t10\tLightning\t7\t90\t0\t24\t10\tStatic Field\t7\t35\t0\t18\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Nightmare\t100\t18\t359\t3\t2\t49\t252\tmerca222\tmerca241\t10000\t120\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t17\t10\tFire Ball\t7\t60\t0\t15\t10\tEnchant\t7\t30\t0\t12\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Nightmare\t100\t18\t359\t3\t2\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t27\t10\tFire Ball\t7\t60\t0\t25\t10\tEnchant\t7\t30\t0\t26\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Nightmare\t100\t19\t359\t3\t2\t49\t252\tmerca222\tmerca241\t12000\t130\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t7\t10\tChilling Armor\t7\t1000\t0\t13\t15\tIce Blast\t7\t120\t0\t17\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Nightmare\t100\t19\t359\t3\t2\t79\t252\tmerca222\tmerca241\t27000\t140\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t22\t10\tChilling Armor\t7\t1000\t0\t27\t15\tIce Blast\t7\t120\t0\t27\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Nightmare\t100\t20\t359\t3\t2\t49\t252\tmerca222\tmerca241\t10000\t120\t534\t23\t419\t16\t92\t10\t74\t8\t423\t24\t18\t24\t4\t103\t7\t103\t7\t103\t7\t103\t7\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t15\t10\tLightning\t7\t60\t4\t14\t10\tStatic Field\t7\t20\t2\t10\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Nightmare\t100\t20\t359\t3\t2\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t25\t10\tLightning\t7\t90\t0\t24\t10\tStatic Field\t7\t35\t0\t18\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tFire-Hell\t100\t21\t359\t3\t3\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial7\t10\tFire Bolt\t7\t30\t0\t27\t10\tFire Ball\t7\t60\t0\t25\t10\tEnchant\t7\t30\t0\t26\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tCold-Hell\t100\t22\t359\t3\t3\t79\t252\tmerca222\tmerca241\t27000\t140\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial6\t10\tGlacial Spike\t7\t60\t0\t22\t10\tChilling Armor\t7\t1000\t0\t27\t15\tIce Blast\t7\t120\t0\t27\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Eastern Sorceror\tLtng-Hell\t100\t23\t359\t3\t3\t79\t252\tmerca222\tmerca241\t21000\t130\t1224\t34\t907\t25\t130\t10\t104\t8\t1143\t36\t33\t39\t4\t155\t5\t155\t5\t155\t5\t155\t5\tstrhirespecial5\t10\tCharged Bolt\t7\t60\t0\t25\t10\tLightning\t7\t90\t0\t24\t10\tStatic Field\t7\t35\t0\t18\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\t\n",
+                u8"Barbarian\t2hs-Normal\t0\t24\t561\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t288\t14\t180\t7\t101\t15\t63\t10\t150\t17\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tBash\t4\t15\t0\t4\t10\tStun\t4\t15\t0\t3\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t0\t24\t561\t5\t1\t42\t515\tMercX101\tMercX167\t9000\t120\t484\t21\t278\t20\t128\t15\t81\t10\t388\t27\t27\t31\t8\t81\t7\t81\t7\t81\t7\t81\t7\t\t50\tBash\t4\t50\t0\t9\t10\tStun\t4\t50\t0\t7\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t0\t24\t561\t5\t1\t75\t515\tMercX101\tMercX167\t9000\t120\t1177\t35\t938\t40\t190\t15\t123\t10\t1279\t37\t60\t64\t8\t139\t4\t139\t4\t139\t4\t139\t4\t\t50\tBash\t4\t75\t0\t20\t0\tStun\t4\t75\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t0\t25\t561\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t288\t14\t180\t7\t101\t15\t63\t10\t150\t17\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tBash\t4\t15\t0\t4\t10\tStun\t4\t15\t0\t3\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t0\t25\t561\t5\t1\t42\t515\tMercX101\tMercX167\t9000\t120\t484\t21\t278\t20\t128\t15\t81\t10\t388\t27\t27\t31\t8\t81\t7\t81\t7\t81\t7\t81\t7\t\t50\tBash\t4\t50\t0\t9\t10\tStun\t4\t50\t0\t7\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t0\t25\t561\t5\t1\t75\t515\tMercX101\tMercX167\t9000\t120\t1177\t35\t938\t40\t190\t15\t123\t10\t1279\t37\t60\t64\t8\t139\t4\t139\t4\t139\t4\t139\t4\t\t50\tBash\t4\t75\t0\t20\t0\tStun\t4\t75\t0\t16\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Nightmare\t0\t26\t561\t5\t2\t42\t515\tMercX101\tMercX167\t18000\t130\t436\t21\t250\t20\t125\t15\t76\t10\t349\t27\t25\t29\t8\t78\t7\t78\t7\t78\t7\t78\t7\t\t50\tBash\t4\t50\t0\t8\t10\tStun\t4\t50\t0\t6\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Nightmare\t0\t26\t561\t5\t2\t75\t515\tMercX101\tMercX167\t18000\t130\t1129\t35\t910\t40\t187\t15\t118\t10\t1240\t37\t58\t62\t8\t136\t4\t136\t4\t136\t4\t136\t4\t\t50\tBash\t4\t75\t0\t19\t0\tStun\t4\t75\t0\t15\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Nightmare\t0\t27\t561\t5\t2\t42\t515\tMercX101\tMercX167\t18000\t130\t436\t21\t250\t20\t125\t15\t76\t10\t349\t27\t25\t29\t8\t78\t7\t78\t7\t78\t7\t78\t7\t\t50\tBash\t4\t50\t0\t8\t10\tStun\t4\t50\t0\t6\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Nightmare\t0\t27\t561\t5\t2\t75\t515\tMercX101\tMercX167\t18000\t130\t1129\t35\t910\t40\t187\t15\t118\t10\t1240\t37\t58\t62\t8\t136\t4\t136\t4\t136\t4\t136\t4\t\t50\tBash\t4\t75\t0\t19\t0\tStun\t4\t75\t0\t15\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Hell\t0\t28\t561\t5\t3\t75\t515\tMercX101\tMercX167\t32000\t140\t1016\t35\t819\t40\t184\t15\t113\t10\t1116\t37\t56\t60\t8\t133\t4\t133\t4\t133\t4\t133\t4\t\t50\tBash\t4\t70\t0\t18\t0\tStun\t4\t70\t0\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Hell\t0\t29\t561\t5\t3\t75\t515\tMercX101\tMercX167\t32000\t140\t1016\t35\t819\t40\t184\t15\t113\t10\t1116\t37\t56\t60\t8\t133\t4\t133\t4\t133\t4\t133\t4\t\t50\tBash\t4\t70\t0\t18\t0\tStun\t4\t70\t0\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t100\t24\t561\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t450\t19\t300\t15\t101\t15\t63\t10\t150\t20\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tBash\t4\t15\t0\t8\t10\tStun\t4\t15\t0\t6\t8\tBattle Cry\t4\t15\t0\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t100\t24\t561\t5\t1\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tBash\t4\t50\t0\t18\t10\tStun\t4\t50\t0\t14\t8\tBattle Cry\t4\t15\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t100\t24\t561\t5\t1\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t100\t25\t561\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t450\t19\t300\t15\t101\t15\t63\t10\t150\t20\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tBash\t4\t15\t0\t8\t10\tStun\t4\t15\t0\t6\t8\tBattle Cry\t4\t15\t0\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t100\t25\t561\t5\t1\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tBash\t4\t50\t0\t18\t10\tStun\t4\t50\t0\t14\t8\tBattle Cry\t4\t15\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Normal\t100\t25\t561\t5\t1\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t1hs-Normal\t100\t36\t560\t5\t1\t28\t515\tMercX101\tMercX167\t9000\t120\t450\t19\t300\t15\t101\t15\t63\t10\t150\t20\t16\t20\t6\t56\t7\t56\t7\t56\t7\t56\t7\t\t50\tFrenzy\t4\t22\t1\t2\t7\tIron Skin\t5\t0\t0\t2\t6\tTaunt\t5\t20\t1\t7\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t1hs-Normal\t100\t36\t560\t5\t1\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tFrenzy\t4\t29\t1\t9\t7\tIron Skin\t5\t0\t0\t8\t6\tTaunt\t5\t27\t1\t13\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t1hs-Normal\t100\t36\t560\t5\t1\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tFrenzy\t4\t35\t1\t13\t7\tIron Skin\t5\t0\t0\t12\t6\tTaunt\t5\t33\t1\t17\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Nightmare\t100\t26\t561\t5\t2\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tBash\t4\t50\t0\t18\t10\tStun\t4\t50\t0\t14\t8\tBattle Cry\t4\t15\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Nightmare\t100\t26\t561\t5\t2\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Nightmare\t100\t27\t561\t5\t2\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tBash\t4\t50\t0\t18\t10\tStun\t4\t50\t0\t14\t8\tBattle Cry\t4\t15\t0\t13\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Nightmare\t100\t27\t561\t5\t2\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t1hs-Nightmare\t100\t37\t560\t5\t2\t58\t515\tMercX101\tMercX167\t18000\t130\t1020\t30\t775\t25\t158\t15\t101\t10\t750\t35\t39\t43\t8\t109\t7\t109\t7\t109\t7\t109\t7\t\t50\tFrenzy\t4\t29\t1\t9\t7\tIron Skin\t5\t0\t0\t8\t6\tTaunt\t5\t27\t1\t13\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t1hs-Nightmare\t100\t37\t560\t5\t2\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tFrenzy\t4\t35\t1\t13\t7\tIron Skin\t5\t0\t0\t12\t6\tTaunt\t5\t33\t1\t17\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Hell\t100\t28\t561\t5\t3\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t2hs-Hell\t100\t29\t561\t5\t3\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tBash\t4\t75\t0\t25\t10\tStun\t4\t75\t0\t20\t8\tBattle Cry\t4\t15\t0\t19\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n",
+                u8"Barbarian\t1hs-Hell\t100\t38\t560\t5\t3\t80\t515\tMercX101\tMercX167\t32000\t140\t1680\t45\t1332\t35\t200\t15\t129\t10\t1520\t45\t61\t65\t8\t148\t4\t148\t4\t148\t4\t148\t4\t\t50\tFrenzy\t4\t35\t1\t13\t7\tIron Skin\t5\t0\t0\t12\t6\tTaunt\t5\t33\t1\t17\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t2\t50000\tbar\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
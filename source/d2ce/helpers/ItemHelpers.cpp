@@ -24,7 +24,10 @@
 #include <sstream>
 #include <random>
 #include <deque>
+#include <future>
 #include <iterator>
+#include <mutex>
+#include <shared_mutex>
 #include <regex>
 #include "Item.h"
 #include "SkillConstants.h"
@@ -37,14 +40,72 @@ namespace d2ce
     const std::string s_DefaultLanguage = "enUS";
     std::string s_CurrentLanguage;
     std::set<std::string> s_SupportedLanguages;
+    std::uint32_t s_ItemDataGeneration = 0;
+
+    // guards the item, skill and mercenary tables: readers hold the shared lock through a GameDataScope,
+    // setTxtReader and setLanguage rebuild the tables and publish the new context under the exclusive lock
+    std::shared_mutex s_GameDataMutex;
+    GameDataContextPtr s_GameDataContext;
+    thread_local size_t s_GameDataLockDepth = 0; // number of scopes and write locks held by this thread
+    thread_local bool s_bGameDataExclusive = false; // this thread holds the exclusive lock
+
+    // Exclusive lock taken by the functions changing the tables. Nested inside another exclusive
+    // lock of the same thread it does nothing. Nested inside a shared scope of the same thread it
+    // trades the shared lock for the exclusive one and leaves it to the outermost scope to release,
+    // so no other thread can switch the tables back before that scope ends. References the scope
+    // obtained from the tables before the change are no longer valid.
+    class GameDataWriteLock
+    {
+    private:
+        bool m_bOwner = false;
+
+    public:
+        GameDataWriteLock()
+        {
+            if (!s_bGameDataExclusive)
+            {
+                if (s_GameDataLockDepth > 0)
+                {
+                    s_GameDataMutex.unlock_shared();
+                }
+                else
+                {
+                    m_bOwner = true;
+                }
+
+                s_GameDataMutex.lock();
+                s_bGameDataExclusive = true;
+            }
+
+            ++s_GameDataLockDepth;
+        }
+
+        ~GameDataWriteLock()
+        {
+            --s_GameDataLockDepth;
+            if (m_bOwner)
+            {
+                s_bGameDataExclusive = false;
+                s_GameDataMutex.unlock();
+            }
+        }
+
+        GameDataWriteLock(const GameDataWriteLock&) = delete;
+        GameDataWriteLock& operator=(const GameDataWriteLock&) = delete;
+    };
+
+    void InitSkillInfoData(const ITxtReader& txtReader);
+    void StashSkillInfoData(GameDataBackup& backup);
+    void InitMercData(const ITxtReader& txtReader);
+    void StashMercData(GameDataBackup& backup);
 
     //---------------------------------------------------------------------------
     namespace ItemHelpers
     {
         bool getItemCodev100(std::uint16_t code, std::array<std::uint8_t, 4>& strcode);
-        std::uint8_t getResurrectedItemCode(const std::vector<std::uint8_t>& data, size_t startOffset, std::array<std::uint8_t, 4>& strcode);
+        std::uint8_t getResurrectedItemCode(const ItemBytes& data, size_t startOffset, std::array<std::uint8_t, 4>& strcode);
         void encodeResurrectedItem(const std::array<std::uint8_t, 4>& strcode, std::uint64_t& encodedVal, std::uint8_t& numBitsSet);
-        std::uint8_t HuffmanDecodeBitString(const std::string& bitstr);
+        std::uint8_t HuffmanDecode(std::uint16_t bits, std::uint8_t& numBits);
 
         const ItemType& getInvalidItemTypeHelper();
 
@@ -105,6 +166,7 @@ namespace d2ce
         std::string formatMagicalAttributeValue(MagicalAttribute& attrib, std::uint32_t charLevel, size_t idx, const ItemStat& stat);
         bool formatDisplayedMagicalAttribute(MagicalAttribute& attrib, std::uint32_t charLevel);
         void combineMagicalAttribute(std::multimap<size_t, size_t>& itemIndexMap, const std::vector<MagicalAttribute>& newAttribs, std::vector<MagicalAttribute>& attribs);
+        void combineMagicalAttribute(std::multimap<size_t, size_t>& itemIndexMap, const std::vector<ItemProperty>& newProps, std::vector<ItemProperty>& props);
         void mergeMagicalAttributes(std::vector<MagicalAttribute>& attribs, const std::vector<MagicalAttribute>& newAttribs);
         bool ProcessNameNode(const Json::Value& node, std::array<char, NAME_LENGTH>& name, d2ce::EnumItemVersion version);
     }
@@ -343,6 +405,21 @@ namespace d2ce
     std::map<size_t, std::map<std::string, std::string>> s_ExpansionStringTxtInfo;
     std::map<std::string, size_t> s_PatchStringTxtIdxInfo;
     std::map<size_t, std::map<std::string, std::string>> s_PatchStringTxtInfo;
+    std::set<std::string> s_LoadedLanguages; // language columns loaded from the string tables
+    void MergeStringCols(std::map<std::string, std::string>& langCols, std::map<std::string, std::string>& stringCols)
+    {
+        if (langCols.empty())
+        {
+            langCols.swap(stringCols);
+            return;
+        }
+
+        for (auto& stringCol : stringCols)
+        {
+            langCols[stringCol.first].swap(stringCol.second);
+        }
+    }
+
     void StringsTxtDataReader(ITxtDocument& doc)
     {
         if (doc.GetColumnCount() == 0)
@@ -371,7 +448,7 @@ namespace d2ce
 
             if (idx >= MIN_EXPANSION_STRING_IDX)
             {
-                s_ExpansionStringTxtInfo[idx].swap(stringCols);
+                MergeStringCols(s_ExpansionStringTxtInfo[idx], stringCols);
                 if (strName.compare("x") != 0 && strName.compare("X") != 0)
                 {
                     s_ExpansionStringTxtIdxInfo[strName] = idx;
@@ -389,7 +466,7 @@ namespace d2ce
             }
             else if (idx >= MIN_PATCH_STRING_IDX)
             {
-                s_PatchStringTxtInfo[idx].swap(stringCols);
+                MergeStringCols(s_PatchStringTxtInfo[idx], stringCols);
                 if (strName.compare("x") != 0 && strName.compare("X") != 0)
                 {
                     s_PatchStringTxtIdxInfo[strName] = idx;
@@ -413,7 +490,7 @@ namespace d2ce
             }
             else
             {
-                s_StringTxtInfo[idx].swap(stringCols);
+                MergeStringCols(s_StringTxtInfo[idx], stringCols);
                 if (strName.compare("x") != 0 && strName.compare("X") != 0)
                 {
                     s_StringTxtIdxInfo[strName] = idx;
@@ -445,18 +522,20 @@ namespace d2ce
     }
 
     const d2ce::ITxtReader* s_pTextReader = nullptr;
+    const d2ce::ITxtReader* s_pStringTxtReader = nullptr;
+    void LoadStringsTxtLanguage(const std::string& lang);
     void InitStringsTxtData(const ITxtReader& txtReader)
     {
-        static const ITxtReader* pCurTextReader = nullptr;
         if (!s_StringTxtInfo.empty())
         {
-            if (pCurTextReader == &txtReader)
+            if (s_pStringTxtReader == &txtReader)
             {
                 // already initialized
                 return;
             }
 
             s_SupportedLanguages.clear();
+            s_LoadedLanguages.clear();
             s_StringTxtIdxInfo.clear();
             s_StringTxtInfo.clear();
             s_ExpansionStringTxtIdxInfo.clear();
@@ -466,7 +545,7 @@ namespace d2ce
         }
 
         bool isClassicTxt = false;
-        pCurTextReader = &txtReader;
+        s_pStringTxtReader = &txtReader;
         auto pDoc(txtReader.GetPatchStringTxt());
         if (pDoc != nullptr)
         {
@@ -499,7 +578,14 @@ namespace d2ce
             StringsTxtDataReader(doc);
         }
 
-        pDoc = txtReader.GetStringTxt();
+        // only the current language and the default language are loaded, setLanguage loads any other one on demand
+        s_LoadedLanguages.insert(s_DefaultLanguage);
+        if (!s_CurrentLanguage.empty())
+        {
+            s_LoadedLanguages.insert(s_CurrentLanguage);
+        }
+
+        pDoc = txtReader.GetStringTxt(s_LoadedLanguages);
         if (pDoc != nullptr)
         {
             auto& doc = *pDoc;
@@ -515,8 +601,17 @@ namespace d2ce
             StringsTxtDataReader(doc);
         }
 
+        if (!isClassicTxt && !s_CurrentLanguage.empty())
+        {
+            // the supported languages are known now, so load the languages the current one falls back to
+            LoadStringsTxtLanguage(s_CurrentLanguage);
+        }
+
         if (isClassicTxt)
         {
+            // classic txt files are not split by language
+            s_LoadedLanguages.clear();
+
             // special cases
             std::uint32_t idx = 11193;
             std::string index("SkillCategoryAm1");
@@ -1328,6 +1423,41 @@ namespace d2ce
         }
     }
 
+    void LoadStringsTxtLanguage(const std::string& lang)
+    {
+        if ((s_pStringTxtReader == nullptr) || s_LoadedLanguages.empty())
+        {
+            // not loaded yet or every language is already loaded
+            return;
+        }
+
+        // GetLocalizedString falls back to a compatible language (same two letter prefix, i.e. esMX -> esES),
+        // so those are loaded along with the language itself
+        std::set<std::string> languages;
+        std::string matchStr = lang.substr(0, 2);
+        for (const auto& supportedLang : s_SupportedLanguages)
+        {
+            if ((supportedLang.find(matchStr) == 0) && (s_LoadedLanguages.find(supportedLang) == s_LoadedLanguages.end()))
+            {
+                languages.insert(supportedLang);
+            }
+        }
+
+        if (languages.empty())
+        {
+            return;
+        }
+
+        auto pDoc(s_pStringTxtReader->GetStringTxt(languages));
+        if (pDoc != nullptr)
+        {
+            StringsTxtDataReader(*pDoc);
+        }
+
+        // only marked as loaded once their strings are in, so a failed load is tried again
+        s_LoadedLanguages.insert(languages.begin(), languages.end());
+    }
+
     void ProcessStatDescription(std::string& descstrpos, std::string& descstrneg, std::uint8_t descfunc, std::uint16_t descval, const std::string& descstr2)
     {
         std::string strValue;
@@ -2028,11 +2158,49 @@ namespace d2ce
     }
 
     std::map<std::string, std::uint16_t> s_ItemStatsNameMap;
-    std::map<d2ce::EnumCharVersion, std::map<std::uint16_t, ItemStat>> s_ItemStatsInfo;
+
+    // itemstatcost data for the v100, v109 and v140 item versions, each indexed directly by stat id
+    constexpr size_t NUM_ITEM_STATS_VERSIONS = 3;
+    std::array<std::vector<ItemStat>, NUM_ITEM_STATS_VERSIONS> s_ItemStatsTable;
+    std::array<std::vector<ItemStatEncoding>, NUM_ITEM_STATS_VERSIONS> s_ItemStatEncodingTable;
+
+    size_t GetItemStatsTableIdx(d2ce::EnumCharVersion version)
+    {
+        if (version >= d2ce::EnumCharVersion::v140)
+        {
+            return 2;
+        }
+
+        return (version >= d2ce::EnumCharVersion::v109) ? 1 : 0;
+    }
+
+    size_t GetItemStatsTableIdx(EnumItemVersion itemVersion)
+    {
+        // use the newest table the item version supports, otherwise the oldest table loaded (i.e. mods only have v140)
+        size_t tableIdx = (itemVersion >= EnumItemVersion::v140) ? 2 : ((itemVersion >= EnumItemVersion::v109) ? 1 : 0);
+        for (size_t idx = tableIdx + 1; idx-- > 0; )
+        {
+            if (!s_ItemStatsTable[idx].empty())
+            {
+                return idx;
+            }
+        }
+
+        for (size_t idx = tableIdx + 1; idx < NUM_ITEM_STATS_VERSIONS; ++idx)
+        {
+            if (!s_ItemStatsTable[idx].empty())
+            {
+                return idx;
+            }
+        }
+
+        return tableIdx;
+    }
+
     void InitItemStatsData(const ITxtReader& txtReader)
     {
         static const ITxtReader* pCurTextReader = nullptr;
-        if (!s_ItemStatsInfo.empty())
+        if (!s_ItemStatsNameMap.empty())
         {
             if (pCurTextReader == &txtReader)
             {
@@ -2040,7 +2208,16 @@ namespace d2ce
                 return;
             }
 
-            s_ItemStatsInfo.clear();
+            for (auto& itemStats : s_ItemStatsTable)
+            {
+                itemStats.clear();
+            }
+
+            for (auto& itemStatEncodings : s_ItemStatEncodingTable)
+            {
+                itemStatEncodings.clear();
+            }
+
             s_ItemStatsNameMap.clear();
         }
 
@@ -2499,12 +2676,52 @@ namespace d2ce
             }
         }
 
-        s_ItemStatsInfo.swap(itemStatsInfo);
+        // flatten the stats into dense tables, missing ids look like the invalid stat
+        std::array<std::vector<ItemStat>, NUM_ITEM_STATS_VERSIONS> itemStatsTable;
+        std::array<std::vector<ItemStatEncoding>, NUM_ITEM_STATS_VERSIONS> itemStatEncodingTable;
+        for (auto& versionStats : itemStatsInfo)
+        {
+            if (versionStats.second.empty())
+            {
+                continue;
+            }
+
+            auto tableIdx = GetItemStatsTableIdx(versionStats.first);
+            auto& itemStats = itemStatsTable[tableIdx];
+            auto& itemStatEncodings = itemStatEncodingTable[tableIdx];
+            size_t numStats = size_t(versionStats.second.rbegin()->first) + 1;
+            itemStats.resize(numStats);
+            itemStatEncodings.resize(numStats);
+            for (auto& itemStat : itemStats)
+            {
+                itemStat.id = MAXUINT16;
+            }
+
+            for (auto& itemStat : versionStats.second)
+            {
+                auto& stat = itemStats[itemStat.first];
+                stat = std::move(itemStat.second);
+
+                auto& encoding = itemStatEncodings[itemStat.first];
+                encoding.id = stat.id;
+                encoding.saveBits = stat.saveBits;
+                encoding.saveAdd = stat.saveAdd;
+                encoding.saveParamBits = stat.saveParamBits;
+                encoding.encode = stat.encode;
+                encoding.addSkillTab = (stat.name.compare("item_addskill_tab") == 0) ? true : false;
+                encoding.numNextInChain = std::uint8_t(std::min(stat.nextInChain.size(), ItemStatEncoding::MAX_NEXT_IN_CHAIN));
+                std::copy(stat.nextInChain.begin(), stat.nextInChain.begin() + encoding.numNextInChain, encoding.nextInChain.begin());
+            }
+        }
+
+        s_ItemStatsTable.swap(itemStatsTable);
+        s_ItemStatEncodingTable.swap(itemStatEncodingTable);
         s_ItemStatsNameMap.swap(itemStatsNameMap);
     }
 
     struct ItemCategoryType
     {
+        std::uint16_t id = MAXUINT16; // dense id of the category, it is the bit used in ItemType::categoryMask
         std::string code; // the ID pointer of this ItemType (iType), this pointer is used in many txt files (armor.txt, cubemain.txt, misc.txt, skills.txt, treasureclassex.txt, weapons.txt)
         std::string name; // internal name
         std::vector<std::string> subCodes; // parent iTypes
@@ -2520,6 +2737,23 @@ namespace d2ce
     };
 
     std::map<std::string, ItemCategoryType> s_ItemCategoryType;
+    std::map<std::string, std::uint16_t> s_ItemCategoryNameIdMap;
+
+    // categories tested by the ItemType predicates, their ids are resolved once when the item types are loaded
+    enum class EnumItemCategory : std::uint8_t
+    {
+        Weapon = 0, Thrown, MissileWeapon, Missile, Shield, Armor, Helm, Misc, Book, Potion, Jewel, Gem, Quest, Gold,
+        RejuvenationPotion, HealingPotion, ManaPotion, SocketFiller, PerfectGem, Rune, Charm, Belt, Boots, Scroll, Key,
+        Bow, Crossbow, Ring, Amulet, BodyPart, PlayerBodyPart, ClassSpecific, SecondHand, Unused, Count
+    };
+
+    const std::array<std::string, size_t(EnumItemCategory::Count)> s_ItemCategoryCodes = {
+        "weap", "thro", "miss", "misl", "shld", "armo", "helm", "misc", "book", "poti", "jewl", "gem", "ques", "gold",
+        "rpot", "hpot", "mpot", "sock", "gem4", "rune", "char", "belt", "boot", "scro", "key",
+        "bow", "xbow", "ring", "amul", "body", "play", "clas", "seco", "" }; // Unused is not part of itemtypes.txt
+    const std::string s_UnusedItemCategoryName = "Unused";
+    std::array<std::uint16_t, size_t(EnumItemCategory::Count)> s_ItemCategoryIds;
+
     void InitItemTypesData(const ITxtReader& txtReader)
     {
         static const ITxtReader* pCurTextReader = nullptr;
@@ -2532,6 +2766,7 @@ namespace d2ce
             }
 
             s_ItemCategoryType.clear();
+            s_ItemCategoryNameIdMap.clear();
         }
 
         pCurTextReader = &txtReader;
@@ -2732,7 +2967,42 @@ namespace d2ce
             }
         }
 
+        // give each category a dense id, categories are matched by name so categories sharing a name share an id
+        std::map<std::string, std::uint16_t> itemCategoryNameIdMap;
+        std::uint16_t nextId = 0;
+        for (auto& category : itemCategoryType)
+        {
+            auto iter = itemCategoryNameIdMap.find(category.second.name);
+            if (iter != itemCategoryNameIdMap.end())
+            {
+                category.second.id = iter->second;
+                continue;
+            }
+
+            category.second.id = nextId;
+            itemCategoryNameIdMap[category.second.name] = nextId;
+            ++nextId;
+        }
+
+        if (itemCategoryNameIdMap.find(s_UnusedItemCategoryName) == itemCategoryNameIdMap.end())
+        {
+            itemCategoryNameIdMap[s_UnusedItemCategoryName] = nextId;
+            ++nextId;
+        }
+
+        s_ItemCategoryIds.fill(MAXUINT16);
+        for (size_t idx = 0; idx < s_ItemCategoryCodes.size(); ++idx)
+        {
+            auto iter = itemCategoryType.find(s_ItemCategoryCodes[idx]);
+            if (iter != itemCategoryType.end())
+            {
+                s_ItemCategoryIds[idx] = iter->second.id;
+            }
+        }
+        s_ItemCategoryIds[size_t(EnumItemCategory::Unused)] = itemCategoryNameIdMap[s_UnusedItemCategoryName];
+
         s_ItemCategoryType.swap(itemCategoryType);
+        s_ItemCategoryNameIdMap.swap(itemCategoryNameIdMap);
     }
 
     const ItemCategoryType& GetItemCategory(const std::string code)
@@ -2747,6 +3017,54 @@ namespace d2ce
         return iter->second;
     }
 
+    std::uint16_t GetItemCategoryNameId(const std::string& name)
+    {
+        auto iter = s_ItemCategoryNameIdMap.find(name);
+        if (iter == s_ItemCategoryNameIdMap.end())
+        {
+            return MAXUINT16;
+        }
+
+        return iter->second;
+    }
+
+    // returns false if the item type already has the category
+    bool AddItemTypeCategory(ItemType& itemType, const std::string& name, std::uint16_t id)
+    {
+        if (id < MAX_ITEM_CATEGORIES)
+        {
+            if (itemType.categoryMask.test(id))
+            {
+                return false;
+            }
+
+            itemType.categoryMask.set(id);
+        }
+        else if (std::find(itemType.categories.begin(), itemType.categories.end(), name) != itemType.categories.end())
+        {
+            return false;
+        }
+
+        itemType.categories.push_back(name);
+        return true;
+    }
+
+    bool HasItemTypeCategory(const ItemType& itemType, EnumItemCategory category)
+    {
+        auto id = s_ItemCategoryIds[size_t(category)];
+        if (id < MAX_ITEM_CATEGORIES)
+        {
+            return itemType.categoryMask.test(id);
+        }
+
+        if (category == EnumItemCategory::Unused)
+        {
+            return itemType.hasCategory(s_UnusedItemCategoryName);
+        }
+
+        return (id == MAXUINT16) ? false : itemType.hasCategoryCode(s_ItemCategoryCodes[size_t(category)]);
+    }
+
     struct ItemPropertiesParamType
     {
         std::string set;  // Parameter to the property function, if the function can use it
@@ -3002,6 +3320,13 @@ namespace d2ce
     ItemType s_invalidItemType;
     std::uint16_t s_ItemCurTypeCodeIdx_v100 = 0;
     std::map<std::uint16_t, std::string> s_ItemTypeCodes_v100;
+
+    // open addressing index of the armor, weapon and misc item types keyed by their packed item code,
+    // the entries point into the item type maps below so it is rebuilt whenever they are
+    std::vector<std::pair<std::uint32_t, const ItemType*>> s_ItemTypeCodeIndex;
+    std::uint32_t s_ItemTypeCodeIndexShift = 32;
+    void InitItemTypeCodeIndex();
+
     std::map<std::string, ItemType> s_ItemWeaponType;
     const ItemType& GetWeaponItemType(const std::string& code)
     {
@@ -3026,6 +3351,7 @@ namespace d2ce
                 return;
             }
 
+            s_ItemTypeCodeIndex.clear();
             s_ItemWeaponType.clear();
         }
 
@@ -3528,19 +3854,8 @@ namespace d2ce
                 if (cat.code == strValue)
                 {
                     // make sure the category does not already exist
-                    bool bFound = false;
-                    for (const auto& val : itemType.categories)
-                    {
-                        if (val == cat.name)
-                        {
-                            bFound = true;
-                            break;
-                        }
-                    }
-
-                    if (!bFound)
+                    if (AddItemTypeCategory(itemType, cat.name, cat.id))
                     {
-                        itemType.categories.push_back(cat.name);
                         codes.insert(codes.end(), cat.subCodes.begin(), cat.subCodes.end());
                         if (cat.beltable)
                         {
@@ -3635,6 +3950,7 @@ namespace d2ce
                 return;
             }
 
+            s_ItemTypeCodeIndex.clear();
             s_ItemArmorType.clear();
         }
 
@@ -4057,19 +4373,8 @@ namespace d2ce
                 if (cat.code == strValue)
                 {
                     // make sure the category does not already exist
-                    bool bFound = false;
-                    for (const auto& val : itemType.categories)
-                    {
-                        if (val == cat.name)
-                        {
-                            bFound = true;
-                            break;
-                        }
-                    }
-
-                    if (!bFound)
+                    if (AddItemTypeCategory(itemType, cat.name, cat.id))
                     {
-                        itemType.categories.push_back(cat.name);
                         codes.insert(codes.end(), cat.subCodes.begin(), cat.subCodes.end());
                         if (cat.beltable)
                         {
@@ -4189,6 +4494,7 @@ namespace d2ce
 
             s_ItemCurTypeCodeIdx_v100 = 0;
             s_ItemTypeCodes_v100.clear();
+            s_ItemTypeCodeIndex.clear();
             s_ItemArmorType.clear();
             s_ItemWeaponType.clear();
             s_ItemMiscType.clear();
@@ -4571,19 +4877,8 @@ namespace d2ce
                 if (cat.code == strValue)
                 {
                     // make sure the category does not already exist
-                    bool bFound = false;
-                    for (const auto& val : itemType.categories)
-                    {
-                        if (val == cat.name)
-                        {
-                            bFound = true;
-                            break;
-                        }
-                    }
-
-                    if (!bFound)
+                    if (AddItemTypeCategory(itemType, cat.name, cat.id))
                     {
-                        itemType.categories.push_back(cat.name);
                         codes.insert(codes.end(), cat.subCodes.begin(), cat.subCodes.end());
                         if (cat.beltable)
                         {
@@ -4679,17 +4974,126 @@ namespace d2ce
 
             if (bAddUnused)
             {
-                itemType.categories.push_back("Unused");
+                AddItemTypeCategory(itemType, s_UnusedItemCategoryName, s_ItemCategoryIds[size_t(EnumItemCategory::Unused)]);
             }
 
             addItemToSimpleCache(itemType);
         }
 
         s_ItemMiscType.swap(itemMiscType);
+        InitItemTypeCodeIndex();
+    }
+
+    std::uint32_t PackItemTypeCode(const std::string& code)
+    {
+        if (code.empty() || code.size() > sizeof(std::uint32_t))
+        {
+            // not indexed
+            return 0;
+        }
+
+        std::uint32_t packedCode = 0;
+        for (size_t idx = 0; idx < code.size(); ++idx)
+        {
+            if (code[idx] == 0)
+            {
+                // not indexed
+                return 0;
+            }
+
+            packedCode |= std::uint32_t(std::uint8_t(code[idx])) << (idx * 8);
+        }
+
+        return packedCode;
+    }
+
+    size_t GetItemTypeCodeSlot(std::uint32_t packedCode)
+    {
+        // Fibonacci hashing, the index size is a power of 2
+        return size_t((packedCode * 0x9E3779B1ui32) >> s_ItemTypeCodeIndexShift);
+    }
+
+    void InitItemTypeCodeIndex()
+    {
+        // keep the index at most half full so probe sequences stay short
+        size_t numItemTypes = s_ItemArmorType.size() + s_ItemWeaponType.size() + s_ItemMiscType.size();
+        std::uint32_t numBits = 4;
+        while ((size_t(1) << numBits) < numItemTypes * 2)
+        {
+            ++numBits;
+        }
+
+        std::vector<std::pair<std::uint32_t, const ItemType*>> itemTypeCodeIndex(size_t(1) << numBits, std::make_pair(0ui32, nullptr));
+        s_ItemTypeCodeIndexShift = 32 - numBits;
+        const size_t slotMask = itemTypeCodeIndex.size() - 1;
+        auto addItemTypes = [&](const std::map<std::string, ItemType>& itemTypes)
+        {
+            for (const auto& itemType : itemTypes)
+            {
+                auto packedCode = PackItemTypeCode(itemType.first);
+                if (packedCode == 0)
+                {
+                    // found by the map search in GetItemTypeHelper
+                    continue;
+                }
+
+                for (auto slot = GetItemTypeCodeSlot(packedCode); ; slot = (slot + 1) & slotMask)
+                {
+                    auto& entry = itemTypeCodeIndex[slot];
+                    if (entry.first == packedCode)
+                    {
+                        // first one wins, same search order as GetItemTypeHelper
+                        break;
+                    }
+
+                    if (entry.first == 0)
+                    {
+                        entry.first = packedCode;
+                        entry.second = &itemType.second;
+                        break;
+                    }
+                }
+            }
+        };
+
+        addItemTypes(s_ItemArmorType);
+        addItemTypes(s_ItemWeaponType);
+        addItemTypes(s_ItemMiscType);
+        s_ItemTypeCodeIndex.swap(itemTypeCodeIndex);
+    }
+
+    // returns nullptr if the code can't be resolved by the index
+    const d2ce::ItemType* FindItemTypeByPackedCode(std::uint32_t packedCode)
+    {
+        if (s_ItemTypeCodeIndex.empty() || (packedCode == 0))
+        {
+            return nullptr;
+        }
+
+        const size_t slotMask = s_ItemTypeCodeIndex.size() - 1;
+        for (auto slot = GetItemTypeCodeSlot(packedCode); ; slot = (slot + 1) & slotMask)
+        {
+            const auto& entry = s_ItemTypeCodeIndex[slot];
+            if (entry.first == packedCode)
+            {
+                return entry.second;
+            }
+
+            if (entry.first == 0)
+            {
+                return &s_invalidItemType;
+            }
+        }
     }
 
     const d2ce::ItemType& GetItemTypeHelper(const std::string& code)
     {
+        const auto* pItemType = FindItemTypeByPackedCode(PackItemTypeCode(code));
+        if (pItemType != nullptr)
+        {
+            return *pItemType;
+        }
+
         // Could be armor
         {
             const auto& result = GetArmorItemType(code);
@@ -4714,6 +5118,15 @@ namespace d2ce
 
     const d2ce::ItemType& GetItemTypeHelper(const std::array<std::uint8_t, 4>& strcode)
     {
+        if ((strcode[0] != 0) && (strcode[1] != 0) && (strcode[2] != 0))
+        {
+            const auto* pItemType = FindItemTypeByPackedCode(std::uint32_t(strcode[0]) | (std::uint32_t(strcode[1]) << 8) | (std::uint32_t(strcode[2]) << 16));
+            if (pItemType != nullptr)
+            {
+                return *pItemType;
+            }
+        }
+
         std::string testStr("   ");
         testStr[0] = (char)strcode[0];
         testStr[1] = (char)strcode[1];
@@ -5051,25 +5464,114 @@ namespace d2ce
         std::vector<std::string> excluded_categories; // what item types this affix will never appear on
     };
 
-    std::map<std::uint16_t, ItemAffixType> s_SuperiorType;
-    void InitSuperiorModsData(const ITxtReader& txtReader)
+    struct ItemAffixIndexEntry
     {
-        static const ITxtReader* pCurTextReader = nullptr;
-        if (!s_SuperiorType.empty())
-        {
-            if (pCurTextReader == &txtReader)
-            {
-                // already initialized
-                return;
-            }
+        std::uint16_t version = 0;
+        std::uint16_t code = 0;
 
-            s_SuperiorType.clear();
+        bool operator<(const ItemAffixIndexEntry& other) const
+        {
+            return (version < other.version) || ((version == other.version) && (code < other.code));
         }
+    };
 
-        InitItemPropertiesData(txtReader);
-        pCurTextReader = &txtReader;
-        auto pDoc(txtReader.GetSuperiorModsTxt());
-        auto& doc = *pDoc;
+    // Affix codes by included category id, each slot sorted by version so the affixes
+    // available to a game version are a contiguous slice. The last slot holds the affixes
+    // with an included category outside of the category bitset, those are always checked.
+    using ItemAffixIndex = std::vector<std::vector<ItemAffixIndexEntry>>;
+
+    void InitItemAffixIndex(const std::map<std::uint16_t, ItemAffixType>& affixes, ItemAffixIndex& index)
+    {
+        ItemAffixIndex affixIndex(MAX_ITEM_CATEGORIES + 1);
+        for (const auto& affix : affixes)
+        {
+            ItemAffixIndexEntry entry;
+            entry.version = affix.second.version;
+            entry.code = affix.second.code;
+            bool bUnindexed = false;
+            for (const auto& itype : affix.second.included_categories)
+            {
+                auto id = GetItemCategoryNameId(itype);
+                if (id < MAX_ITEM_CATEGORIES)
+                {
+                    affixIndex[id].push_back(entry);
+                }
+                else
+                {
+                    bUnindexed = true;
+                }
+            }
+
+            if (bUnindexed)
+            {
+                affixIndex[MAX_ITEM_CATEGORIES].push_back(entry);
+            }
+        }
+
+        for (auto& slot : affixIndex)
+        {
+            std::sort(slot.begin(), slot.end());
+        }
+
+        index.swap(affixIndex);
+    }
+
+    // returns the sorted codes of the affixes for this item type whose version is in [minVersion, maxVersion]
+    void GetItemAffixCandidates(const ItemAffixIndex& index, const ItemType& itemType, std::uint16_t minVersion, std::uint16_t maxVersion, std::vector<std::uint16_t>& codes)
+    {
+        codes.clear();
+        if (index.empty() || (minVersion > maxVersion))
+        {
+            return;
+        }
+
+        ItemAffixIndexEntry first;
+        first.version = minVersion;
+        ItemAffixIndexEntry last;
+        last.version = maxVersion;
+        last.code = MAXUINT16;
+        auto addSlot = [&](const std::vector<ItemAffixIndexEntry>& slot)
+        {
+            auto iterEnd = std::upper_bound(slot.begin(), slot.end(), last);
+            for (auto iter = std::lower_bound(slot.begin(), iterEnd, first); iter != iterEnd; ++iter)
+            {
+                codes.push_back(iter->code);
+            }
+        };
+
+        for (size_t id = 0; id < MAX_ITEM_CATEGORIES; ++id)
+        {
+            if (itemType.categoryMask.test(id))
+            {
+                addSlot(index[id]);
+            }
+        }
+        addSlot(index[MAX_ITEM_CATEGORIES]);
+
+        // an affix can be listed under more than one of the item's categories
+        std::sort(codes.begin(), codes.end());
+        codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+    }
+
+    std::map<std::uint16_t, ItemAffixType> s_SuperiorType;
+    void InitSuperiorModsData(const ITxtReader& txtReader)
+    {
+        static const ITxtReader* pCurTextReader = nullptr;
+        if (!s_SuperiorType.empty())
+        {
+            if (pCurTextReader == &txtReader)
+            {
+                // already initialized
+                return;
+            }
+
+            s_SuperiorType.clear();
+        }
+
+        InitItemPropertiesData(txtReader);
+        pCurTextReader = &txtReader;
+        auto pDoc(txtReader.GetSuperiorModsTxt());
+        auto& doc = *pDoc;
         std::map<std::uint16_t, ItemAffixType> superiorType;
 
         std::map<std::uint16_t, ItemAffixType> itemMagicAffixType;
@@ -5340,6 +5842,7 @@ namespace d2ce
     }
 
     std::map<std::uint16_t, ItemAffixType> s_ItemMagicPrefixType;
+    ItemAffixIndex s_ItemMagicPrefixIndex;
     void InitItemMagicAffixData(ITxtDocument& doc, std::map<std::uint16_t, ItemAffixType>& sItemMagicAffixType)
     {
         bool isPrefix = (&sItemMagicAffixType == &s_ItemMagicPrefixType) ? true : false;
@@ -5692,9 +6195,11 @@ namespace d2ce
         auto pDoc(txtReader.GetMagicPrefixTxt());
         auto& doc = *pDoc;
         InitItemMagicAffixData(doc, s_ItemMagicPrefixType);
+        InitItemAffixIndex(s_ItemMagicPrefixType, s_ItemMagicPrefixIndex);
     }
 
     std::map<std::uint16_t, ItemAffixType> s_ItemMagicSuffixType;
+    ItemAffixIndex s_ItemMagicSuffixIndex;
     void InitItemMagicSuffixData(const ITxtReader& txtReader)
     {
         static const ITxtReader* pCurTextReader = nullptr;
@@ -5714,6 +6219,7 @@ namespace d2ce
         auto pDoc(txtReader.GetMagicSuffixTxt());
         auto& doc = *pDoc;
         InitItemMagicAffixData(doc, s_ItemMagicSuffixType);
+        InitItemAffixIndex(s_ItemMagicSuffixType, s_ItemMagicSuffixIndex);
     }
 
     std::map<std::string, std::uint16_t> s_ItemRareIndex;
@@ -5825,6 +6331,7 @@ namespace d2ce
     }
 
     std::map<std::uint16_t, ItemAffixType> s_ItemRareSuffixType;
+    ItemAffixIndex s_ItemRareSuffixIndex;
     std::uint16_t InitItemRareSuffixData(const ITxtReader& txtReader)
     {
         static const ITxtReader* pCurTextReader = nullptr;
@@ -5843,10 +6350,13 @@ namespace d2ce
         pCurTextReader = &txtReader;
         auto pDoc(txtReader.GetRareSuffixTxt());
         auto& doc = *pDoc;
-        return InitItemRareAffixData(doc, s_ItemRareSuffixType);
+        auto offset = InitItemRareAffixData(doc, s_ItemRareSuffixType);
+        InitItemAffixIndex(s_ItemRareSuffixType, s_ItemRareSuffixIndex);
+        return offset;
     }
 
     std::map<std::uint16_t, ItemAffixType> s_ItemRarePrefixType;
+    ItemAffixIndex s_ItemRarePrefixIndex;
     void InitItemRarePrefixData(const ITxtReader& txtReader)
     {
         static const ITxtReader* pCurTextReader = nullptr;
@@ -5870,6 +6380,7 @@ namespace d2ce
         auto pDoc(txtReader.GetRarePrefixTxt());
         auto& doc = *pDoc;
         InitItemRareAffixData(doc, s_ItemRarePrefixType, offset);
+        InitItemAffixIndex(s_ItemRarePrefixType, s_ItemRarePrefixIndex);
     }
 
     const ItemAffixType& getRareAffixType(std::uint16_t id)
@@ -5964,6 +6475,7 @@ namespace d2ce
             stackable = parent.stackable;
             max_sockets = parent.max_sockets;
             categories = parent.categories;
+            categoryMask = parent.categoryMask;
             gemApplyType = parent.gemApplyType;
             inv_file = parent.inv_file;
             nameable = parent.nameable;
@@ -6152,7 +6664,7 @@ namespace d2ce
             itemType.code = doc.GetCellString(codeColumnIdx, i);
             if (itemType.code.empty())
             {
-                itemType.categories.push_back("Unused");
+                AddItemTypeCategory(itemType, s_UnusedItemCategoryName, s_ItemCategoryIds[size_t(EnumItemCategory::Unused)]);
             }
             else
             {
@@ -6715,6 +7227,7 @@ namespace d2ce
             stackable = parent.stackable;
             max_sockets = parent.max_sockets;
             categories = parent.categories;
+            categoryMask = parent.categoryMask;
             gemApplyType = parent.gemApplyType;
             inv_file = parent.inv_file;
             nameable = parent.nameable;
@@ -9196,10 +9709,10 @@ namespace d2ce
     };
 
     ItemGridDimensions s_ItemGridDimensions;
+    const d2ce::ITxtReader* s_pGridDimensionsTxtReader = nullptr; // there is no empty state to test, so the reader is kept with the table
     void InitItemGridDimensions(const ITxtReader& txtReader)
     {
-        static const ITxtReader* pCurTextReader = nullptr;
-        if (pCurTextReader == &txtReader)
+        if (s_pGridDimensionsTxtReader == &txtReader)
         {
             // already initialized
             return;
@@ -9207,7 +9720,7 @@ namespace d2ce
 
         s_ItemGridDimensions.clear();
 
-        pCurTextReader = &txtReader;
+        s_pGridDimensionsTxtReader = &txtReader;
         auto pDoc(txtReader.GetGridDimensionsTxt());
         auto& doc = *pDoc;
         size_t numRows = doc.GetRowCount();
@@ -9327,49 +9840,248 @@ namespace d2ce
     }
     
 
-    void InitItemData(const ITxtReader& txtReader)
+    using InitDataTask = std::shared_future<void>;
+    InitDataTask RunInitDataTask(void (*pInitData)(const ITxtReader&), const ITxtReader& txtReader, const std::vector<InitDataTask>& dependencies = std::vector<InitDataTask>())
+    {
+        return std::async(std::launch::async, [pInitData, &txtReader, dependencies]()
+            {
+                for (const auto& dependency : dependencies)
+                {
+                    // rethrows any failure of the dependency
+                    dependency.get();
+                }
+
+                pInitData(txtReader);
+            }).share();
+    }
+
+    void StashItemData(GameDataBackup& backup)
+    {
+        backup.stash(s_SupportedLanguages);
+        backup.stash(s_StringTxtIdxInfo);
+        backup.stash(s_StringTxtInfo);
+        backup.stash(s_ExpansionStringTxtIdxInfo);
+        backup.stash(s_ExpansionStringTxtInfo);
+        backup.stash(s_PatchStringTxtIdxInfo);
+        backup.stash(s_PatchStringTxtInfo);
+        backup.stash(s_LoadedLanguages);
+        backup.stash(s_pStringTxtReader);
+        backup.stash(s_ItemStatsNameMap);
+        backup.stash(s_ItemStatsTable);
+        backup.stash(s_ItemStatEncodingTable);
+        backup.stash(s_ItemCategoryType);
+        backup.stash(s_ItemCategoryNameIdMap);
+        backup.stash(s_ItemCategoryIds);
+        backup.stash(s_ItemPropertiesType);
+        backup.stash(s_ItemBeltSlots);
+        backup.stash(s_ItemCurTypeCodeIdx_v100);
+        backup.stash(s_ItemTypeCodes_v100);
+        backup.stash(s_ItemTypeCodeIndex);
+        backup.stash(s_ItemTypeCodeIndexShift);
+        backup.stash(s_ItemWeaponType);
+        backup.stash(s_ItemArmorType);
+        backup.stash(s_ItemMiscType);
+        backup.stash(s_CraftItemType);
+        backup.stash(s_ItemCodeToCraftItemType);
+        backup.stash(s_ItemCategoryToCraftItemType);
+        backup.stash(s_SuperiorType);
+        backup.stash(s_ItemMagicPrefixType);
+        backup.stash(s_ItemMagicPrefixIndex);
+        backup.stash(s_ItemMagicSuffixType);
+        backup.stash(s_ItemMagicSuffixIndex);
+        backup.stash(s_ItemRareIndex);
+        backup.stash(s_ItemRareNames);
+        backup.stash(s_ItemRareSuffixType);
+        backup.stash(s_ItemRareSuffixIndex);
+        backup.stash(s_ItemRarePrefixType);
+        backup.stash(s_ItemRarePrefixIndex);
+        backup.stash(s_ItemUniqueQuestItemsIndex);
+        backup.stash(s_ItemUniqueItemsIndex);
+        backup.stash(s_ItemUniqueItemsType);
+        backup.stash(s_ItemSetsIndex);
+        backup.stash(s_ItemSetsType);
+        backup.stash(s_ItemSetItemsIndex);
+        backup.stash(s_ItemSetItemsType);
+        backup.stash(s_AvailableItemsType);
+        backup.stash(s_ItemGemsType);
+        backup.stash(s_MonStatsType);
+        backup.stash(s_MonNamesType);
+        backup.stash(s_ItemRunewordsType);
+        backup.stash(s_ItemNumRunesRunewordsMap);
+        backup.stash(s_ItemGridDimensions);
+        backup.stash(s_pGridDimensionsTxtReader);
+    }
+
+    void StashGameData(GameDataBackup& backup)
     {
-        InitItemStatsData(txtReader);
-        InitItemRarePrefixData(txtReader);
-        InitItemGemsTypeData(txtReader);
-        InitItemGridDimensions(txtReader);
-    }
-
-    const std::map<std::string, std::uint8_t> huffmanDecodeMap = {
-        {"111101000", '\0'}, {       "01", ' '}, {"11011111", '0'}, { "0011111", '1'},
-        {   "001100",  '2'}, {  "1011011", '3'}, {"01011111", '4'}, {"01101000", '5'},
-        {  "1111011",  '6'}, {    "11110", '7'}, {  "001000", '8'}, {   "01110", '9'},
-        {    "01111",  'a'}, {     "1010", 'b'}, {   "00010", 'c'}, {  "100011", 'd'},
-        {   "000011",  'e'}, {   "110010", 'f'}, {   "01011", 'g'}, {   "11000", 'h'},
-        {  "0111111",  'i'}, {"011101000", 'j'}, {  "010010", 'k'}, {   "10111", 'l'},
-        {    "10110",  'm'}, {   "101100", 'n'}, { "1111111", 'o'}, {   "10011", 'p'},
-        { "10011011",  'q'}, {    "00111", 'r'}, {    "0100", 's'}, {   "00110", 't'},
-        {    "10000",  'u'}, {  "0111011", 'v'}, {   "00000", 'w'}, {   "11100", 'x'},
-        {  "0101000",  'y'}, { "00011011", 'z'},
-    };
+        StashItemData(backup);
+        StashSkillInfoData(backup);
+        StashMercData(backup);
+    }
 
-    // Retrieves the huffman encoded chracter
-    std::uint8_t GetEncodedChar(const std::vector<std::uint8_t>& data, std::uint64_t& startOffset)
+    // Called by setTxtReader under the exclusive game data lock. The current tables are set aside
+    // in backup and every table is rebuilt from scratch, readers waiting on the lock then see all of
+    // the new tables at once. If any initializer fails, the tables set aside are put back before rethrowing.
+    void InitItemData(const ITxtReader& txtReader, GameDataBackup& backup)
+    {
+        ++s_ItemDataGeneration;
+
+        StashGameData(backup);
+
+        // Each initializer still calls the ones it depends on, by the time it runs those calls
+        // find the tables already loaded. Initializers that share tables stay in the same chain.
+        auto strings = RunInitDataTask(InitStringsTxtData, txtReader);
+        auto itemTypes = RunInitDataTask(InitItemTypesData, txtReader);
+        auto beltSlots = RunInitDataTask(InitItemBeltSlots, txtReader);
+        auto properties = RunInitDataTask(InitItemPropertiesData, txtReader);
+        auto gridDimensions = RunInitDataTask(InitItemGridDimensions, txtReader);
+        auto stats = RunInitDataTask(InitItemStatsData, txtReader, { strings });
+
+        // weapons, armor, misc, craft, unique, sets and set items share the item type caches
+        auto items = RunInitDataTask(InitItemSetItemsData, txtReader, { strings, itemTypes, beltSlots });
+
+        // superior, magic and rare affixes
+        auto affixes = RunInitDataTask(InitItemRarePrefixData, txtReader, { strings, itemTypes, properties });
+
+        // the gem properties are rolled using the stats, properties and magic affixes
+        auto gems = RunInitDataTask(InitItemGemsTypeData, txtReader, { stats, items, affixes });
+
+        // the skill and mercenary tables look up strings and runewords, so they come last,
+        // the mercenary skills are resolved through the skill tables
+        auto skills = RunInitDataTask(InitSkillInfoData, txtReader, { gems });
+        auto mercs = RunInitDataTask(InitMercData, txtReader, { gems, skills });
+
+        const std::vector<InitDataTask> tasks = { strings, itemTypes, beltSlots, properties, gridDimensions, stats, items, affixes, gems, skills, mercs };
+        try
+        {
+            // no task may still be writing its tables when the old ones are put back
+            for (const auto& task : tasks)
+            {
+                task.wait();
+            }
+
+            for (const auto& task : tasks)
+            {
+                task.get();
+            }
+        }
+        catch (...)
+        {
+            backup.restore();
+            throw;
+        }
+    }
+
+    // Publishes the context of the tables just installed. The tables they replaced are kept with the
+    // contexts of the previous txt reader, so setGameDataContext can swap them back in without a rebuild.
+    void PublishGameDataContext(const ITxtReader& txtReader, const std::shared_ptr<GameDataBackup>& pTables, const ITxtReader* pPrevTxtReader, GameDataBackup& prevTables)
     {
-        std::string bitStr;
-        size_t startRead = startOffset;
-        size_t readOffset = startRead;
-        while (bitStr.size() < 9)
+        auto pPrevContext = std::atomic_load(&s_GameDataContext);
+        if ((pPrevContext != nullptr) && (&pPrevContext->getTxtReader() == pPrevTxtReader))
         {
-            readOffset = startRead;
-            std::stringstream ss2;
-            ss2 << std::bitset<9>(read_uint32_bits(readOffset, bitStr.size() + 1));
-            ++startOffset;
-            bitStr = ss2.str().substr(8 - bitStr.size());
-            auto iter = huffmanDecodeMap.find(bitStr);
-            if (iter != huffmanDecodeMap.end())
+            *pPrevContext->getTables() = std::move(prevTables);
+        }
+
+        std::atomic_store(&s_GameDataContext, std::make_shared<const GameDataContext>(txtReader, ItemHelpers::getLanguage(), s_ItemDataGeneration, pTables));
+    }
+
+    // Huffman code of an item code character, bit 0 of code is the first bit in the stream
+    struct HuffmanCode
+    {
+        std::uint16_t code = 488; // unknown characters are encoded as '\0'
+        std::uint8_t numBits = 9;
+    };
+
+    struct HuffmanSymbol
+    {
+        std::uint8_t symbol = UINT8_MAX;
+        std::uint8_t numBits = 0; // 0 means the bits do not start a valid code
+    };
+
+    constexpr size_t HUFFMAN_MAX_CODE_BITS = 9;
+    constexpr size_t HUFFMAN_PEEK_MASK = (size_t(1) << HUFFMAN_MAX_CODE_BITS) - 1;
+
+    const std::array<std::pair<std::uint8_t, HuffmanCode>, 38> huffmanCodes = { {
+        {'0', {223, 8}}, { '1', { 31, 7}}, {'2', { 12, 6}}, {'3', { 91, 7}},
+        {'4', { 95, 8}}, { '5', {104, 8}}, {'6', {123, 7}}, {'7', { 30, 5}},
+        {'8', {  8, 6}}, { '9', { 14, 5}}, {' ', {  1, 2}}, {'a', { 15, 5}},
+        {'b', { 10, 4}}, { 'c', {  2, 5}}, {'d', { 35, 6}}, {'e', {  3, 6}},
+        {'f', { 50, 6}}, { 'g', { 11, 5}}, {'h', { 24, 5}}, {'i', { 63, 7}},
+        {'j', {232, 9}}, { 'k', { 18, 6}}, {'l', { 23, 5}}, {'m', { 22, 5}},
+        {'n', { 44, 6}}, { 'o', {127, 7}}, {'p', { 19, 5}}, {'q', {155, 8}},
+        {'r', {  7, 5}}, { 's', {  4, 4}}, {'t', {  6, 5}}, {'u', { 16, 5}},
+        {'v', { 59, 7}}, { 'w', {  0, 5}}, {'x', { 28, 5}}, {'y', { 40, 7}},
+        {'z', { 27, 8}}, {'\0', {488, 9}},
+    } };
+
+    // Indexed by character
+    const std::array<HuffmanCode, 256>& GetHuffmanEncodeTable()
+    {
+        static const std::array<HuffmanCode, 256> encodeTable = [] {
+            std::array<HuffmanCode, 256> table;
+            for (const auto& huffmanCode : huffmanCodes)
             {
-                return iter->second;
+                table[huffmanCode.first] = huffmanCode.second;
             }
+            return table;
+        }();
+
+        return encodeTable;
+    }
+
+    // Indexed by the next 9 bits of the stream, every entry whose low bits
+    // start with a code holds that code's symbol and length
+    const std::array<HuffmanSymbol, HUFFMAN_PEEK_MASK + 1>& GetHuffmanDecodeTable()
+    {
+        static const std::array<HuffmanSymbol, HUFFMAN_PEEK_MASK + 1> decodeTable = [] {
+            std::array<HuffmanSymbol, HUFFMAN_PEEK_MASK + 1> table;
+            for (const auto& huffmanCode : huffmanCodes)
+            {
+                const auto& code = huffmanCode.second;
+                size_t numPadding = size_t(1) << (HUFFMAN_MAX_CODE_BITS - code.numBits);
+                for (size_t padding = 0; padding < numPadding; ++padding)
+                {
+                    auto& entry = table[code.code | (padding << code.numBits)];
+                    entry.symbol = huffmanCode.first;
+                    entry.numBits = code.numBits;
+                }
+            }
+            return table;
+        }();
+
+        return decodeTable;
+    }
+
+    // Retrieves the huffman encoded chracter
+    std::uint8_t GetEncodedChar(const ItemBytes& data, std::uint64_t& startOffset)
+    {
+        size_t totalBits = data.size() * 8;
+        if (startOffset >= totalBits)
+        {
+            // something went wrong
+            return std::uint8_t(0xFF);
+        }
+
+        // peek at the next 9 bits, zero filled past the end of the data
+        std::uint32_t bits = 0;
+        size_t byteIdx = size_t(startOffset / 8);
+        for (size_t i = 0; i < 3 && (byteIdx + i) < data.size(); ++i)
+        {
+            bits |= std::uint32_t(data[byteIdx + i]) << (8 * i);
+        }
+        bits >>= (startOffset & 7);
+
+        std::uint8_t numBits = 0;
+        auto symbol = ItemHelpers::HuffmanDecode(std::uint16_t(bits), numBits);
+        if (numBits == 0 || (startOffset + numBits) > totalBits)
+        {
+            // something went wrong
+            startOffset += HUFFMAN_MAX_CODE_BITS;
+            return std::uint8_t(0xFF);
         }
 
-        // something went wrong
-        return std::uint8_t(0xFF);
+        startOffset += numBits;
+        return symbol;
     }
 
     const ItemSetItemType& GetSetItemType(std::uint16_t id, const std::array<std::uint8_t, 4>& strcode)
@@ -9505,13 +10217,19 @@ namespace d2ce
             return false;
         }
 
-        for (auto& prefix : s_ItemMagicPrefixType)
+        // pre v1.08 affixes (version 0) only spawn in the original game version
+        std::uint16_t minVersion = (createParams.gameVersion == 0) ? 0ui16 : 1ui16;
+        std::vector<std::uint16_t> candidates;
+        GetItemAffixCandidates(s_ItemMagicPrefixIndex, itemType, minVersion, createParams.gameVersion, candidates);
+        for (auto code : candidates)
         {
-            if ((prefix.second.version > createParams.gameVersion) || (prefix.second.version == 0 && createParams.gameVersion != 0))
+            auto iter = s_ItemMagicPrefixType.find(code);
+            if (iter == s_ItemMagicPrefixType.end())
             {
                 continue;
             }
 
+            const auto& prefix = *iter;
             if (bRare && prefix.second.onlyMagic)
             {
                 continue;
@@ -9560,13 +10278,16 @@ namespace d2ce
             prefixes.push_back(prefix.second);
         }
 
-        for (auto& suffix : s_ItemMagicSuffixType)
+        GetItemAffixCandidates(s_ItemMagicSuffixIndex, itemType, minVersion, createParams.gameVersion, candidates);
+        for (auto code : candidates)
         {
-            if ((suffix.second.version > createParams.gameVersion) || (suffix.second.version == 0 && createParams.gameVersion != 0))
+            auto iter = s_ItemMagicSuffixType.find(code);
+            if (iter == s_ItemMagicSuffixType.end())
             {
                 continue;
             }
 
+            const auto& suffix = *iter;
             if (bRare && suffix.second.onlyMagic)
             {
                 continue;
@@ -9627,13 +10348,17 @@ namespace d2ce
             return false;
         }
 
-        for (auto& prefix : s_ItemRarePrefixType)
+        std::vector<std::uint16_t> candidates;
+        GetItemAffixCandidates(s_ItemRarePrefixIndex, itemType, 0ui16, createParams.gameVersion, candidates);
+        for (auto code : candidates)
         {
-            if (prefix.second.version > createParams.gameVersion)
+            auto iter = s_ItemRarePrefixType.find(code);
+            if (iter == s_ItemRarePrefixType.end())
             {
                 continue;
             }
 
+            const auto& prefix = *iter;
             bool bIncluded = false;
             for (auto& itype : prefix.second.included_categories)
             {
@@ -9667,13 +10392,16 @@ namespace d2ce
             prefixes.push_back(prefix.second);
         }
 
-        for (auto& suffix : s_ItemRareSuffixType)
+        GetItemAffixCandidates(s_ItemRareSuffixIndex, itemType, 0ui16, createParams.gameVersion, candidates);
+        for (auto code : candidates)
         {
-            if (suffix.second.version > createParams.gameVersion)
+            auto iter = s_ItemRareSuffixType.find(code);
+            if (iter == s_ItemRareSuffixType.end())
             {
                 continue;
             }
 
+            const auto& suffix = *iter;
             bool bIncluded = false;
             for (auto& itype : suffix.second.included_categories)
             {
@@ -9712,6 +10440,12 @@ namespace d2ce
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::hasCategory(const std::string category) const
 {
+    auto id = GetItemCategoryNameId(category);
+    if (id < MAX_ITEM_CATEGORIES)
+    {
+        return categoryMask.test(id);
+    }
+
     return std::find(categories.begin(), categories.end(), category) != categories.end() ? true : false;
 }
 //---------------------------------------------------------------------------
@@ -9769,7 +10503,12 @@ bool d2ce::ItemType::hasCategoryCode(const std::string categoryCode) const
         return false;
     }
 
-    return hasCategory(category.name);
+    if (category.id < MAX_ITEM_CATEGORIES)
+    {
+        return categoryMask.test(category.id);
+    }
+
+    return std::find(categories.begin(), categories.end(), category.name) != categories.end() ? true : false;
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isStackable() const
@@ -9779,22 +10518,22 @@ bool d2ce::ItemType::isStackable() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isWeapon() const
 {
-    return hasCategoryCode("weap");
+    return HasItemTypeCategory(*this, EnumItemCategory::Weapon);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isThrownWeapon() const
 {
-    return hasCategoryCode("thro");
+    return HasItemTypeCategory(*this, EnumItemCategory::Thrown);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isMissileWeapon() const
 {
-    return hasCategoryCode("miss");
+    return HasItemTypeCategory(*this, EnumItemCategory::MissileWeapon);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isMissile() const
 {
-    return hasCategoryCode("misl");
+    return HasItemTypeCategory(*this, EnumItemCategory::Missile);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isTwoHandedWeapon() const
@@ -9819,42 +10558,42 @@ bool d2ce::ItemType::isOneOrTwoHandedWeapon() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isShield() const
 {
-    return hasCategoryCode("shld");
+    return HasItemTypeCategory(*this, EnumItemCategory::Shield);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isArmor() const
 {
-    return hasCategoryCode("armo");
+    return HasItemTypeCategory(*this, EnumItemCategory::Armor);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isHelm() const
 {
-    return hasCategoryCode("helm");
+    return HasItemTypeCategory(*this, EnumItemCategory::Helm);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isMiscellaneous() const
 {
-    return hasCategoryCode("misc");
+    return HasItemTypeCategory(*this, EnumItemCategory::Misc);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isBook() const
 {
-    return hasCategoryCode("book");
+    return HasItemTypeCategory(*this, EnumItemCategory::Book);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isPotion() const
 {
-    return hasCategoryCode("poti");
+    return HasItemTypeCategory(*this, EnumItemCategory::Potion);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isJewel() const
 {
-    return hasCategoryCode("jewl");
+    return HasItemTypeCategory(*this, EnumItemCategory::Jewel);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isGem() const
 {
-    return hasCategoryCode("gem");
+    return HasItemTypeCategory(*this, EnumItemCategory::Gem);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isGPSItem() const
@@ -9864,12 +10603,12 @@ bool d2ce::ItemType::isGPSItem() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isQuestItem() const
 {
-    return hasCategoryCode("ques");
+    return HasItemTypeCategory(*this, EnumItemCategory::Quest);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isGoldItem() const
 {
-    return hasCategoryCode("gold");
+    return HasItemTypeCategory(*this, EnumItemCategory::Gold);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isEar() const
@@ -9879,29 +10618,29 @@ bool d2ce::ItemType::isEar() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isRejuvenationPotion() const
 {
-    return hasCategoryCode("rpot");
+    return HasItemTypeCategory(*this, EnumItemCategory::RejuvenationPotion);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isHealingPotion() const
 {
-    return hasCategoryCode("hpot") ? !isRejuvenationPotion() : false;
+    return HasItemTypeCategory(*this, EnumItemCategory::HealingPotion) ? !isRejuvenationPotion() : false;
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isManaPotion() const
 {
-    return hasCategoryCode("mpot") ? !isRejuvenationPotion() : false;
+    return HasItemTypeCategory(*this, EnumItemCategory::ManaPotion) ? !isRejuvenationPotion() : false;
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isSocketFiller() const
 {
-    return hasCategoryCode("sock");
+    return HasItemTypeCategory(*this, EnumItemCategory::SocketFiller);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isUpgradableGem() const
 {
     if (isSocketFiller())
     {
-        return (!isGem() || hasCategoryCode("gem4")) ? false : true;
+        return (!isGem() || HasItemTypeCategory(*this, EnumItemCategory::PerfectGem)) ? false : true;
     }
 
     return false;
@@ -9978,12 +10717,12 @@ bool d2ce::ItemType::isEliteItem() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isRune() const
 {
-    return hasCategoryCode("rune");
+    return HasItemTypeCategory(*this, EnumItemCategory::Rune);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isCharm() const
 {
-    return hasCategoryCode("char");
+    return HasItemTypeCategory(*this, EnumItemCategory::Charm);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isSunderedCharms() const
@@ -9993,12 +10732,12 @@ bool d2ce::ItemType::isSunderedCharms() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isBelt() const
 {
-    return hasCategoryCode("belt");
+    return HasItemTypeCategory(*this, EnumItemCategory::Belt);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isBoots() const
 {
-    return hasCategoryCode("boot");
+    return HasItemTypeCategory(*this, EnumItemCategory::Boots);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isBeltable() const
@@ -10008,12 +10747,12 @@ bool d2ce::ItemType::isBeltable() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isScroll() const
 {
-    return hasCategoryCode("scro");
+    return HasItemTypeCategory(*this, EnumItemCategory::Scroll);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isKey() const
 {
-    return hasCategoryCode("key");
+    return HasItemTypeCategory(*this, EnumItemCategory::Key);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isHoradricCube() const
@@ -10038,32 +10777,32 @@ bool d2ce::ItemType::isPhaseBlade() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isBow() const
 {
-    return hasCategoryCode("bow");
+    return HasItemTypeCategory(*this, EnumItemCategory::Bow);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isCrossbow() const
 {
-    return hasCategoryCode("xbow");
+    return HasItemTypeCategory(*this, EnumItemCategory::Crossbow);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isRing() const
 {
-    return hasCategoryCode("ring");
+    return HasItemTypeCategory(*this, EnumItemCategory::Ring);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isAmulet() const
 {
-    return hasCategoryCode("amul");
+    return HasItemTypeCategory(*this, EnumItemCategory::Amulet);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isBodyPart() const
 {
-    return hasCategoryCode("body");
+    return HasItemTypeCategory(*this, EnumItemCategory::BodyPart);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isPlayerBodyPart() const
 {
-    return hasCategoryCode("play");
+    return HasItemTypeCategory(*this, EnumItemCategory::PlayerBodyPart);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isSimpleItem() const
@@ -10073,7 +10812,7 @@ bool d2ce::ItemType::isSimpleItem() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isUnusedItem() const
 {
-    return hasCategory("Unused");
+    return HasItemTypeCategory(*this, EnumItemCategory::Unused);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isExpansionItem() const
@@ -10083,12 +10822,12 @@ bool d2ce::ItemType::isExpansionItem() const
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isClassSpecific() const
 {
-    return hasCategoryCode("clas");
+    return HasItemTypeCategory(*this, EnumItemCategory::ClassSpecific);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isSecondHand() const
 {
-    return hasCategoryCode("seco");
+    return HasItemTypeCategory(*this, EnumItemCategory::SecondHand);
 }
 //---------------------------------------------------------------------------
 bool d2ce::ItemType::isUniqueItem() const
@@ -10559,10 +11298,32 @@ const std::string& d2ce::ItemType::getTypeName() const
 //---------------------------------------------------------------------------
 void d2ce::ItemHelpers::setTxtReader(const d2ce::ITxtReader& txtReader)
 {
+    {
+        GameDataScope gameData;
+        if (s_pTextReader == &txtReader)
+        {
+            return;
+        }
+    }
+
+    GameDataWriteLock lock;
     if (s_pTextReader != &txtReader)
     {
+        auto pPrevTxtReader = s_pTextReader;
         s_pTextReader = &txtReader;
-        InitItemData(txtReader);
+        GameDataBackup prevTables;
+        try
+        {
+            InitItemData(txtReader, prevTables);
+        }
+        catch (...)
+        {
+            // the previous tables were put back
+            s_pTextReader = pPrevTxtReader;
+            throw;
+        }
+
+        PublishGameDataContext(txtReader, std::make_shared<GameDataBackup>(), pPrevTxtReader, prevTables);
     }
 }
 //---------------------------------------------------------------------------
@@ -10581,6 +11342,11 @@ bool d2ce::ItemHelpers::isTxtReaderInitialized()
     return s_pTextReader == nullptr ? false : true;
 }
 //---------------------------------------------------------------------------
+std::uint32_t d2ce::ItemHelpers::getItemDataGeneration()
+{
+    return s_ItemDataGeneration;
+}
+//---------------------------------------------------------------------------
 const std::string& d2ce::ItemHelpers::getLanguage()
 {
     return s_CurrentLanguage.empty() ? s_DefaultLanguage : s_CurrentLanguage;
@@ -10591,6 +11357,8 @@ const std::string& d2ce::ItemHelpers::getLanguage()
 #pragma warning(disable : 4702)
 const std::string& d2ce::ItemHelpers::setLanguage(const std::string& lang)
 {
+    GameDataWriteLock lock;
+    auto prevLanguage = s_CurrentLanguage;
     if (lang.empty())
     {
         s_CurrentLanguage.clear(); // use default
@@ -10613,47 +11381,189 @@ const std::string& d2ce::ItemHelpers::setLanguage(const std::string& lang)
         }
     }
 
+    try
+    {
+        LoadStringsTxtLanguage(getLanguage());
+    }
+    catch (...)
+    {
+        // keep using the language whose strings are loaded
+        s_CurrentLanguage = prevLanguage;
+        throw;
+    }
+
+    if (s_pTextReader != nullptr)
+    {
+        auto pContext = std::atomic_load(&s_GameDataContext);
+        if ((pContext == nullptr) || (pContext->getLanguage() != getLanguage()))
+        {
+            // same tables, so the new context shares where they are set aside
+            auto pTables = (pContext != nullptr) ? pContext->getTables() : std::make_shared<GameDataBackup>();
+            std::atomic_store(&s_GameDataContext, std::make_shared<const GameDataContext>(*s_pTextReader, getLanguage(), s_ItemDataGeneration, pTables));
+        }
+    }
+
     return getLanguage();
 }
 #pragma warning( pop )
 //---------------------------------------------------------------------------
-const d2ce::ItemStat& d2ce::ItemHelpers::getItemStat(EnumItemVersion itemVersion, size_t idx)
+d2ce::GameDataContextPtr d2ce::ItemHelpers::getGameDataContext()
 {
-    static d2ce::ItemStat badItemStat = { MAXUINT16 };
-    static std::initializer_list<EnumItemVersion> all_versions = { EnumItemVersion::v140, EnumItemVersion::v109, EnumItemVersion::v100 };
-    for (auto version : all_versions)
+    return std::atomic_load(&s_GameDataContext);
+}
+//---------------------------------------------------------------------------
+void d2ce::ItemHelpers::setGameDataContext(const GameDataContext& context)
+{
+    if (context.isCurrent())
     {
-        if (itemVersion < version)
-        {
-            continue;
-        }
+        return;
+    }
 
-        EnumCharVersion fileVersion = EnumCharVersion::v100;
-        switch (version)
-        {
-        case EnumItemVersion::v109:
-            fileVersion = EnumCharVersion::v109;
-            break;
+    GameDataWriteLock lock;
+    if (context.isCurrent())
+    {
+        return;
+    }
 
-        case EnumItemVersion::v140:
-            fileVersion = EnumCharVersion::v140;
-            break;
+    auto& txtReader = context.getTxtReader();
+    const auto& pTables = context.getTables();
+    if ((s_pTextReader != &txtReader) && (pTables != nullptr) && !pTables->empty())
+    {
+        // the tables of the context were set aside when another txt reader was installed
+        auto pPrevTxtReader = s_pTextReader;
+        GameDataBackup prevTables;
+        StashGameData(prevTables);
+        pTables->restore();
+        s_pTextReader = &txtReader;
+        ++s_ItemDataGeneration;
+        PublishGameDataContext(txtReader, pTables, pPrevTxtReader, prevTables);
+    }
+    else
+    {
+        setTxtReader(txtReader);
+    }
+
+    setLanguage(context.getLanguage());
+}
+//---------------------------------------------------------------------------
+d2ce::GameDataScope::GameDataScope(const GameDataContextPtr& pContext)
+{
+    bool bInstall = (pContext != nullptr) && !pContext->isCurrent();
+    if (s_GameDataLockDepth > 0)
+    {
+        // nested scope, the outer scope already holds the lock
+        ++s_GameDataLockDepth;
+        if (bInstall)
+        {
+            try
+            {
+                ItemHelpers::setGameDataContext(*pContext);
+            }
+            catch (...)
+            {
+                // the destructor does not run for a scope that failed to construct
+                --s_GameDataLockDepth;
+                throw;
+            }
         }
+        return;
+    }
 
-        auto itemStatsMapIter = s_ItemStatsInfo.find(fileVersion);
-        if (itemStatsMapIter == s_ItemStatsInfo.end())
+    if (!bInstall)
+    {
+        s_GameDataMutex.lock_shared();
+        if ((pContext == nullptr) || pContext->isCurrent())
         {
-            // should not happend
-            continue;
+            m_bShared = true;
+            ++s_GameDataLockDepth;
+            return;
         }
 
-        auto itemStatsIdIter = itemStatsMapIter->second.find((std::uint16_t)idx);
-        return (itemStatsIdIter == itemStatsMapIter->second.end()) ? badItemStat : itemStatsIdIter->second;
+        // another thread switched the tables before the lock was taken
+        s_GameDataMutex.unlock_shared();
+    }
+
+    // keep the exclusive lock for the whole scope, the tables must not be switched back under it
+    s_GameDataMutex.lock();
+    s_bGameDataExclusive = true;
+    m_bExclusive = true;
+    ++s_GameDataLockDepth;
+    try
+    {
+        ItemHelpers::setGameDataContext(*pContext);
+    }
+    catch (...)
+    {
+        // the destructor does not run for a scope that failed to construct
+        --s_GameDataLockDepth;
+        s_bGameDataExclusive = false;
+        s_GameDataMutex.unlock();
+        throw;
+    }
+}
+//---------------------------------------------------------------------------
+d2ce::GameDataScope::~GameDataScope()
+{
+    --s_GameDataLockDepth;
+    if (m_bExclusive || (m_bShared && s_bGameDataExclusive))
+    {
+        // a shared scope is upgraded when the tables are changed under it
+        s_bGameDataExclusive = false;
+        s_GameDataMutex.unlock();
+    }
+    else if (m_bShared)
+    {
+        s_GameDataMutex.unlock_shared();
+    }
+}
+//---------------------------------------------------------------------------
+d2ce::GameDataContext::GameDataContext(const ITxtReader& txtReader, const std::string& language, std::uint32_t generation, const std::shared_ptr<GameDataBackup>& pTables) :
+    m_pTxtReader(&txtReader), m_language(language), m_generation(generation), m_pTables(pTables)
+{
+}
+//---------------------------------------------------------------------------
+const d2ce::ITxtReader& d2ce::GameDataContext::getTxtReader() const
+{
+    return *m_pTxtReader;
+}
+//---------------------------------------------------------------------------
+const std::string& d2ce::GameDataContext::getLanguage() const
+{
+    return m_language;
+}
+//---------------------------------------------------------------------------
+std::uint32_t d2ce::GameDataContext::getGeneration() const
+{
+    return m_generation;
+}
+//---------------------------------------------------------------------------
+const std::shared_ptr<d2ce::GameDataBackup>& d2ce::GameDataContext::getTables() const
+{
+    return m_pTables;
+}
+//---------------------------------------------------------------------------
+bool d2ce::GameDataContext::isCurrent() const
+{
+    auto pCurrent = ItemHelpers::getGameDataContext();
+    if (pCurrent == nullptr)
+    {
+        return false;
+    }
+
+    // the generation changes on every rebuild, reinstalling the same txt reader and language restores the same tables
+    return (m_pTxtReader == pCurrent->m_pTxtReader) && (m_language == pCurrent->m_language);
+}
+//---------------------------------------------------------------------------
+const d2ce::ItemStat& d2ce::ItemHelpers::getItemStat(EnumItemVersion itemVersion, size_t idx)
+{
+    static d2ce::ItemStat badItemStat = { MAXUINT16 };
+    const auto& itemStats = s_ItemStatsTable[GetItemStatsTableIdx(itemVersion)];
+    if ((idx >= itemStats.size()) || (itemStats[idx].id == MAXUINT16))
+    {
+        return badItemStat;
     }
 
-    auto itemStatsMapIter = s_ItemStatsInfo.begin();
-    auto itemStatsIdIter = itemStatsMapIter->second.find((std::uint16_t)idx);
-    return (itemStatsIdIter == itemStatsMapIter->second.end()) ? badItemStat : itemStatsIdIter->second;
+    return itemStats[idx];
 }
 //---------------------------------------------------------------------------
 const d2ce::ItemStat& d2ce::ItemHelpers::getItemStat(EnumItemVersion itemVersion, const std::string& name)
@@ -10675,42 +11585,8 @@ const d2ce::ItemStat& d2ce::ItemHelpers::getItemStat(const MagicalAttribute& att
 //---------------------------------------------------------------------------
 const bool d2ce::ItemHelpers::hasItemStat(EnumItemVersion itemVersion, size_t idx)
 {
-    static d2ce::ItemStat badItemStat = { MAXUINT16 };
-    static std::initializer_list<EnumItemVersion> all_versions = { EnumItemVersion::v140, EnumItemVersion::v109, EnumItemVersion::v100 };
-    for (auto version : all_versions)
-    {
-        if (itemVersion < version)
-        {
-            continue;
-        }
-
-        EnumCharVersion fileVersion = EnumCharVersion::v100;
-        switch (version)
-        {
-        case EnumItemVersion::v109:
-            fileVersion = EnumCharVersion::v109;
-            break;
-
-        case EnumItemVersion::v140:
-            fileVersion = EnumCharVersion::v140;
-            break;
-        }
-
-        auto itemStatsMapIter = s_ItemStatsInfo.find(fileVersion);
-        if (itemStatsMapIter == s_ItemStatsInfo.end())
-        {
-            // should not happend
-            continue;
-        }
-
-        auto itemStatsIdIter = itemStatsMapIter->second.find((std::uint16_t)idx);
-        return (itemStatsIdIter == itemStatsMapIter->second.end()) ? false : true;
-    }
-
-    // should not happend
-    auto itemStatsMapIter = s_ItemStatsInfo.begin();
-    auto itemStatsIdIter = itemStatsMapIter->second.find((std::uint16_t)idx);
-    return (itemStatsIdIter == itemStatsMapIter->second.end()) ? false : true;
+    const auto& itemStats = s_ItemStatsTable[GetItemStatsTableIdx(itemVersion)];
+    return ((idx >= itemStats.size()) || (itemStats[idx].id == MAXUINT16)) ? false : true;
 }
 //---------------------------------------------------------------------------
 const bool d2ce::ItemHelpers::hasItemStat(EnumItemVersion itemVersion, const std::string& name)
@@ -10729,6 +11605,18 @@ const bool d2ce::ItemHelpers::hasItemStat(const MagicalAttribute& attrib)
     return ItemHelpers::hasItemStat(attrib.Version, attrib.Id);
 }
 //---------------------------------------------------------------------------
+const d2ce::ItemStatEncoding& d2ce::ItemHelpers::getItemStatEncoding(EnumItemVersion itemVersion, size_t idx)
+{
+    static d2ce::ItemStatEncoding badItemStatEncoding;
+    const auto& itemStatEncodings = s_ItemStatEncodingTable[GetItemStatsTableIdx(itemVersion)];
+    if (idx >= itemStatEncodings.size())
+    {
+        return badItemStatEncoding;
+    }
+
+    return itemStatEncodings[idx];
+}
+//---------------------------------------------------------------------------
 bool d2ce::ItemHelpers::getItemCodev100(std::uint16_t code, std::array<std::uint8_t, 4>& strcode)
 {
     auto iter = s_ItemTypeCodes_v100.find(code);
@@ -10745,7 +11633,7 @@ bool d2ce::ItemHelpers::getItemCodev100(std::uint16_t code, std::array<std::uint
     return false;
 }
 //---------------------------------------------------------------------------
-std::uint8_t d2ce::ItemHelpers::getResurrectedItemCode(const std::vector<std::uint8_t>& data, size_t startOffset, std::array<std::uint8_t, 4>& strcode)
+std::uint8_t d2ce::ItemHelpers::getResurrectedItemCode(const ItemBytes& data, size_t startOffset, std::array<std::uint8_t, 4>& strcode)
 {
     size_t offset = startOffset;
     for (size_t i = 0; i < 4; ++i)
@@ -10761,48 +11649,22 @@ void d2ce::ItemHelpers::encodeResurrectedItem(const std::array<std::uint8_t, 4>&
 {
     encodedVal = 0;
     numBitsSet = 0;
-    static const std::map<std::uint8_t, std::vector<std::uint16_t> > huffmanEncodeMap = {
-        {'0', {223, 8}}, { '1', { 31, 7}}, {'2', { 12, 6}}, {'3', { 91, 7}},
-        {'4', { 95, 8}}, { '5', {104, 8}}, {'6', {123, 7}}, {'7', { 30, 5}},
-        {'8', {  8, 6}}, { '9', { 14, 5}}, {' ', {  1, 2}}, {'a', { 15, 5}},
-        {'b', { 10, 4}}, { 'c', {  2, 5}}, {'d', { 35, 6}}, {'e', {  3, 6}},
-        {'f', { 50, 6}}, { 'g', { 11, 5}}, {'h', { 24, 5}}, {'i', { 63, 7}},
-        {'j', {232, 9}}, { 'k', { 18, 6}}, {'l', { 23, 5}}, {'m', { 22, 5}},
-        {'n', { 44, 6}}, { 'o', {127, 7}}, {'p', { 19, 5}}, {'q', {155, 8}},
-        {'r', {  7, 5}}, { 's', {  4, 4}}, {'t', {  6, 5}}, {'u', { 16, 5}},
-        {'v', { 59, 7}}, { 'w', {  0, 5}}, {'x', { 28, 5}}, {'y', { 40, 7}},
-        {'z', { 27, 8}}, {'\0', {488, 9}},
-    };
-
+    const auto& encodeTable = GetHuffmanEncodeTable();
     for (std::uint8_t i = 4; i > 0; --i)
     {
-        auto iter = huffmanEncodeMap.find(strcode[i - 1]);
-        if (iter == huffmanEncodeMap.end())
-        {
-            // 0
-            encodedVal <<= 9;
-            encodedVal |= 488;
-            numBitsSet += 9;
-        }
-        else
-        {
-            encodedVal <<= iter->second[1];
-            encodedVal |= iter->second[0];
-            numBitsSet += std::uint8_t(iter->second[1]);
-        }
+        const auto& code = encodeTable[strcode[i - 1]];
+        encodedVal <<= code.numBits;
+        encodedVal |= code.code;
+        numBitsSet += code.numBits;
     }
 }
 //---------------------------------------------------------------------------
-std::uint8_t d2ce::ItemHelpers::HuffmanDecodeBitString(const std::string& bitstr)
+// Decodes the character whose code starts at bit 0 of bits (the next 9 bits of the stream)
+std::uint8_t d2ce::ItemHelpers::HuffmanDecode(std::uint16_t bits, std::uint8_t& numBits)
 {
-    auto iter = huffmanDecodeMap.find(bitstr);
-    if (iter != huffmanDecodeMap.end())
-    {
-        return iter->second;
-    }
-
-    // something went wrong
-    return UINT8_MAX;
+    const auto& entry = GetHuffmanDecodeTable()[bits & HUFFMAN_PEEK_MASK];
+    numBits = entry.numBits;
+    return entry.symbol;
 }
 //---------------------------------------------------------------------------
 std::uint16_t d2ce::ItemHelpers::getGPSSortIndex(const std::array<std::uint8_t, 4>& strcode)
@@ -11305,8 +12167,6 @@ std::vector<d2ce::RunewordType> d2ce::ItemHelpers::getPossibleRunewords(const d2
 
     auto minSockets = bUseCurrentSocketCount ? numSockets : item.getSocketCountBonus() + 1;
 
-    const std::vector<std::string>& categories = itemType.categories;
-
     bool isEquipped = item.getLocation() == d2ce::EnumItemLocation::EQUIPPED;
 
     // get possible runewords
@@ -11349,7 +12209,7 @@ std::vector<d2ce::RunewordType> d2ce::ItemHelpers::getPossibleRunewords(const d2
 
                 for (const auto& exclude : runeword.excluded_categories)
                 {
-                    if (std::find(categories.begin(), categories.end(), exclude) != categories.end())
+                    if (itemType.hasCategory(exclude))
                     {
                         continue;
                     }
@@ -11358,7 +12218,7 @@ std::vector<d2ce::RunewordType> d2ce::ItemHelpers::getPossibleRunewords(const d2
                 bool bIncluded = false;
                 for (const auto& include : runeword.included_categories)
                 {
-                    if (std::find(categories.begin(), categories.end(), include) != categories.end())
+                    if (itemType.hasCategory(include))
                     {
                         bIncluded = true;
                         break;
@@ -13990,110 +14850,135 @@ bool d2ce::ItemHelpers::formatDisplayedMagicalAttribute(MagicalAttribute& attrib
     return true;
 }
 //---------------------------------------------------------------------------
-void d2ce::ItemHelpers::combineMagicalAttribute(std::multimap<size_t, size_t>& itemIndexMap, const std::vector<MagicalAttribute>& newAttribs, std::vector<MagicalAttribute>& attribs)
+namespace d2ce
 {
-    size_t numPoisonAttribs = 0;
-    size_t numPoisonTimeSum = 0;
-    size_t numColdAttribs = 0;
-    size_t numColdTimeSum = 0;
-    for (const auto& attrib : newAttribs)
+    size_t GetNumValues(const MagicalAttribute& attrib)
     {
-        auto iter = itemIndexMap.lower_bound(attrib.Id);
-        auto iterEnd = itemIndexMap.upper_bound(attrib.Id);
-        if (iter == iterEnd)
-        {
-            itemIndexMap.insert(std::make_pair(attrib.Id, attribs.size()));
-            attribs.push_back(attrib);
-            switch (attrib.Id)
-            {
-            case 54:
-                numColdAttribs = 1;
-                numColdTimeSum = attrib.Values[2];
-                break;
+        return attrib.Values.size();
+    }
 
-            case 57:
-                numPoisonAttribs = 1;
-                numPoisonTimeSum = attrib.Values[2];
-                break;
-            }
-        }
-        else
+    size_t GetNumValues(const ItemProperty& prop)
+    {
+        return prop.NumValues;
+    }
+
+    // the attributes are MagicalAttribute or ItemProperty records
+    template <class Attribute>
+    void CombineAttributes(std::multimap<size_t, size_t>& itemIndexMap, const std::vector<Attribute>& newAttribs, std::vector<Attribute>& attribs)
+    {
+        size_t numPoisonAttribs = 0;
+        size_t numPoisonTimeSum = 0;
+        size_t numColdAttribs = 0;
+        size_t numColdTimeSum = 0;
+        for (const auto& attrib : newAttribs)
         {
-            bool notMatched = true;
-            for (; notMatched && iter != iterEnd; ++iter)
+            auto iter = itemIndexMap.lower_bound(attrib.Id);
+            auto iterEnd = itemIndexMap.upper_bound(attrib.Id);
+            if (iter == iterEnd)
             {
-                auto& existing = attribs.at(iter->second);
-                if (existing.Values.empty())
-                {
-                    continue;
-                }
-
-                // Check to see if we are a match to merge
+                itemIndexMap.insert(std::make_pair(attrib.Id, attribs.size()));
+                attribs.push_back(attrib);
                 switch (attrib.Id)
                 {
-                case 17:
-                case 48:
-                case 50:
-                case 52:
-                    existing.Values[0] += attrib.Values[0];
-                    existing.Values[1] += attrib.Values[1];
-                    notMatched = false;
-                    break;
-
                 case 54:
-                    ++numColdAttribs;
-                    numColdTimeSum += existing.Values[2];
-                    existing.Values[0] += attrib.Values[0];
-                    existing.Values[1] += attrib.Values[1];
-                    existing.Values[2] = numColdTimeSum / numColdAttribs; // average
-                    notMatched = false;
+                    numColdAttribs = 1;
+                    numColdTimeSum = attrib.Values[2];
                     break;
 
                 case 57:
-                    ++numPoisonAttribs;
-                    numPoisonTimeSum += existing.Values[2];
-                    existing.Values[0] += attrib.Values[0];
-                    existing.Values[1] += attrib.Values[1];
-                    existing.Values[2] = numPoisonTimeSum / numPoisonAttribs; // average
-                    notMatched = false;
+                    numPoisonAttribs = 1;
+                    numPoisonTimeSum = attrib.Values[2];
                     break;
-
-                default:
+                }
+            }
+            else
+            {
+                bool notMatched = true;
+                for (; notMatched && iter != iterEnd; ++iter)
                 {
-                    const auto& stat = getItemStat(attrib.Version, attrib.Id);
-                    bool goodMatch = true;
-                    size_t numMatchValue = (stat.encode == 3) ? 2 : 1;
-                    for (size_t idx = 0; idx < existing.Values.size() - numMatchValue; ++idx)
+                    auto& existing = attribs.at(iter->second);
+                    if (GetNumValues(existing) == 0)
                     {
-                        if (existing.Values[idx] != attrib.Values[idx])
-                        {
-                            goodMatch = false;
-                            break;
-                        }
+                        continue;
                     }
 
-                    if (goodMatch)
+                    // Check to see if we are a match to merge
+                    switch (attrib.Id)
                     {
+                    case 17:
+                    case 48:
+                    case 50:
+                    case 52:
+                        existing.Values[0] += attrib.Values[0];
+                        existing.Values[1] += attrib.Values[1];
+                        notMatched = false;
+                        break;
+
+                    case 54:
+                        ++numColdAttribs;
+                        numColdTimeSum += existing.Values[2];
+                        existing.Values[0] += attrib.Values[0];
+                        existing.Values[1] += attrib.Values[1];
+                        existing.Values[2] = numColdTimeSum / numColdAttribs; // average
+                        notMatched = false;
+                        break;
+
+                    case 57:
+                        ++numPoisonAttribs;
+                        numPoisonTimeSum += existing.Values[2];
+                        existing.Values[0] += attrib.Values[0];
+                        existing.Values[1] += attrib.Values[1];
+                        existing.Values[2] = numPoisonTimeSum / numPoisonAttribs; // average
                         notMatched = false;
-                        for (std::int64_t idx = (std::int64_t)existing.Values.size() - 1; idx >= (std::int64_t)existing.Values.size() - (std::int64_t)numMatchValue; --idx)
+                        break;
+
+                    default:
+                    {
+                        const auto& stat = ItemHelpers::getItemStat(attrib.Version, attrib.Id);
+                        bool goodMatch = true;
+                        size_t numMatchValue = (stat.encode == 3) ? 2 : 1;
+                        for (size_t idx = 0; idx < GetNumValues(existing) - numMatchValue; ++idx)
+                        {
+                            if (existing.Values[idx] != attrib.Values[idx])
+                            {
+                                goodMatch = false;
+                                break;
+                            }
+                        }
+
+                        if (goodMatch)
                         {
-                            existing.Values[idx] += attrib.Values[idx];
+                            notMatched = false;
+                            for (std::int64_t idx = (std::int64_t)GetNumValues(existing) - 1; idx >= (std::int64_t)GetNumValues(existing) - (std::int64_t)numMatchValue; --idx)
+                            {
+                                existing.Values[idx] += attrib.Values[idx];
+                            }
                         }
+                        break;
+                    }
                     }
-                    break;
-                }
                 }
-            }
 
-            if (notMatched)
-            {
-                itemIndexMap.insert(std::make_pair(attrib.Id, attribs.size()));
-                attribs.push_back(attrib);
+                if (notMatched)
+                {
+                    itemIndexMap.insert(std::make_pair(attrib.Id, attribs.size()));
+                    attribs.push_back(attrib);
+                }
             }
         }
     }
 }
 //---------------------------------------------------------------------------
+void d2ce::ItemHelpers::combineMagicalAttribute(std::multimap<size_t, size_t>& itemIndexMap, const std::vector<MagicalAttribute>& newAttribs, std::vector<MagicalAttribute>& attribs)
+{
+    CombineAttributes(itemIndexMap, newAttribs, attribs);
+}
+//---------------------------------------------------------------------------
+void d2ce::ItemHelpers::combineMagicalAttribute(std::multimap<size_t, size_t>& itemIndexMap, const std::vector<ItemProperty>& newProps, std::vector<ItemProperty>& props)
+{
+    CombineAttributes(itemIndexMap, newProps, props);
+}
+//---------------------------------------------------------------------------
 void d2ce::ItemHelpers::mergeMagicalAttributes(std::vector<MagicalAttribute>& attribs, const std::vector<MagicalAttribute>& newAttribs)
 {
     for (const auto& newAttrib : newAttribs)
@@ -14832,9 +15717,9 @@ std::string d2ce::ColorHelpers::GetColorEscapeString(D2Colors code)
 //---------------------------------------------------------------------------
 std::wstring& d2ce::ColorHelpers::RemoveColorFromText(std::wstring& coloredText)
 {
-    if (coloredText.find(L"c") != std::wstring::npos)
+    if (coloredText.find(L"�c") != std::wstring::npos)
     {
-        static std::wregex re{ L"c." };
+        static std::wregex re{ L"�c." };
         coloredText = std::regex_replace(coloredText, re, L"");
     }
     
@@ -25,6 +25,10 @@
 #include "DataTypes.h"
 #include <json/json.h>
 #include <string>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace d2ce
 {
@@ -38,14 +42,48 @@ namespace d2ce
         }
     }
 
+    // Keeps the current game data tables aside while InitItemData rebuilds them,
+    // restore puts them back if the rebuild fails or their context is installed again.
+    class GameDataBackup
+    {
+    private:
+        std::vector<std::function<void()>> m_restore;
+
+    public:
+        template <class T>
+        void stash(T& table) // leaves table default constructed
+        {
+            auto pTable = std::make_shared<T>(std::exchange(table, T()));
+            m_restore.push_back([&table, pTable]() { table = std::move(*pTable); });
+        }
+
+        void restore()
+        {
+            for (auto& restoreTable : m_restore)
+            {
+                restoreTable();
+            }
+            m_restore.clear();
+        }
+
+        bool empty() const
+        {
+            return m_restore.empty();
+        }
+    };
+
     namespace ItemHelpers
     {
         void setTxtReader(const ITxtReader& txtReader);
         const ITxtReader& getTxtReader();
         bool isTxtReaderInitialized();
+        std::uint32_t getItemDataGeneration(); // changes every time the item tables are reloaded
         const std::string& getLanguage();
         const std::string& setLanguage(const std::string& lang);
 
+        GameDataContextPtr getGameDataContext(); // nullptr until a txt reader is set
+        void setGameDataContext(const GameDataContext& context); // installs the txt reader and language of the context
+
         std::string getCategoryNameFromCode(const std::string& code);
 
         const d2ce::ItemStat& getItemStat(EnumItemVersion itemVersion, size_t idx);
@@ -54,6 +92,7 @@ namespace d2ce
         const bool hasItemStat(EnumItemVersion itemVersion, size_t idx);
         const bool hasItemStat(EnumItemVersion itemVersion, const std::string& name); // by stat name
         const bool hasItemStat(const MagicalAttribute& attrib);
+        const d2ce::ItemStatEncoding& getItemStatEncoding(EnumItemVersion itemVersion, size_t idx);
 
         const ItemType& getItemTypeHelper(const std::array<std::uint8_t, 4>& strcode);
         const ItemType& getItemTypeHelper(const std::string& code);
@@ -18,5888 +18,5884 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace JsonReaderHelper
     {
-        const std::string& GetItemModifiers()
+        EmbeddedText GetItemModifiers()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"[\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3333,\n";
-                ss << u8"    \"Key\": \"priceless\",\n";
-                ss << u8"    \"enUS\": \"Item cannot be traded here.\",\n";
-                ss << u8"    \"zhTW\": \"無法在此交易這項物品。\",\n";
-                ss << u8"    \"deDE\": \"Hier ist ein Handel mit diesem Gegenstand nicht möglich.\",\n";
-                ss << u8"    \"esES\": \"Aquí no se puede comerciar con este objeto\",\n";
-                ss << u8"    \"frFR\": \"Les objets ne peuvent pas être vendus ici.\",\n";
-                ss << u8"    \"itIT\": \"Questo oggetto non si può scambiare qui.\",\n";
-                ss << u8"    \"koKR\": \"여기서는 아이템을 거래할 수 없습니다.\",\n";
-                ss << u8"    \"plPL\": \"Tego przedmiotu nie można tutaj sprzedać.\",\n";
-                ss << u8"    \"esMX\": \"Este objeto no puede negociarse aquí.\",\n";
-                ss << u8"    \"jaJP\": \"ここでは売れません。\",\n";
-                ss << u8"    \"ptBR\": \"O item não pode ser negociado aqui.\",\n";
-                ss << u8"    \"ruRU\": \"Этот предмет нельзя продать здесь.\",\n";
-                ss << u8"    \"zhCN\": \"此处无法交易物品。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3453,\n";
-                ss << u8"    \"Key\": \"Socketable\",\n";
-                ss << u8"    \"enUS\": \"Socketed (%i)\",\n";
-                ss << u8"    \"zhTW\": \"鑲孔（%i）\",\n";
-                ss << u8"    \"deDE\": \"Gesockelt (%i)\",\n";
-                ss << u8"    \"esES\": \"Con huecos (%i)\",\n";
-                ss << u8"    \"frFR\": \"Serti (%i)\",\n";
-                ss << u8"    \"itIT\": \"Con castoni (%i)\",\n";
-                ss << u8"    \"koKR\": \"홈 있음 (%i)\",\n";
-                ss << u8"    \"plPL\": \"Gniazda (%i)\",\n";
-                ss << u8"    \"esMX\": \"Engarzado (%i)\",\n";
-                ss << u8"    \"jaJP\": \"ソケット（%i）\",\n";
-                ss << u8"    \"ptBR\": \"Engastes (%i)\",\n";
-                ss << u8"    \"ruRU\": \"С гнездами (%i)\",\n";
-                ss << u8"    \"zhCN\": \"镶孔 (%i)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3454,\n";
-                ss << u8"    \"Key\": \"ItemStats1a\",\n";
-                ss << u8"    \"enUS\": \"Requirements not met\",\n";
-                ss << u8"    \"zhTW\": \"不符合需求\",\n";
-                ss << u8"    \"deDE\": \"Anforderungen nicht erfüllt\",\n";
-                ss << u8"    \"esES\": \"No se cumplen los requisitos\",\n";
-                ss << u8"    \"frFR\": \"Config. incompatible\",\n";
-                ss << u8"    \"itIT\": \"Requisiti non rispettati\",\n";
-                ss << u8"    \"koKR\": \"착용 조건 미충족\",\n";
-                ss << u8"    \"plPL\": \"Wymagania nie są spełnione\",\n";
-                ss << u8"    \"esMX\": \"No se cumplen los requisitos\",\n";
-                ss << u8"    \"jaJP\": \"装備条件を満たしていません\",\n";
-                ss << u8"    \"ptBR\": \"Requisitos não atendidos\",\n";
-                ss << u8"    \"ruRU\": \"Требования не соблюдены\",\n";
-                ss << u8"    \"zhCN\": \"未满足条件\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3455,\n";
-                ss << u8"    \"Key\": \"ItemStats1b\",\n";
-                ss << u8"    \"enUS\": \"Unidentified\",\n";
-                ss << u8"    \"zhTW\": \"尚未鑑定\",\n";
-                ss << u8"    \"deDE\": \"Nicht identifiziert\",\n";
-                ss << u8"    \"esES\": \"Sin identificar\",\n";
-                ss << u8"    \"frFR\": \"Non identifié\",\n";
-                ss << u8"    \"itIT\": \"Non identificato\",\n";
-                ss << u8"    \"koKR\": \"미감별\",\n";
-                ss << u8"    \"plPL\": \"Niezidentyfikowane\",\n";
-                ss << u8"    \"esMX\": \"No identificado\",\n";
-                ss << u8"    \"jaJP\": \"未鑑定\",\n";
-                ss << u8"    \"ptBR\": \"Não identificado\",\n";
-                ss << u8"    \"ruRU\": \"Неопознанный предмет\",\n";
-                ss << u8"    \"zhCN\": \"未辨识\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3456,\n";
-                ss << u8"    \"Key\": \"ItemStats1c\",\n";
-                ss << u8"    \"enUS\": \"Charges:\",\n";
-                ss << u8"    \"zhTW\": \"使用次數：\",\n";
-                ss << u8"    \"deDE\": \"Ladungen:\",\n";
-                ss << u8"    \"esES\": \"Cargas:\",\n";
-                ss << u8"    \"frFR\": \"Charges :\",\n";
-                ss << u8"    \"itIT\": \"Cariche:\",\n";
-                ss << u8"    \"koKR\": \"충전 횟수:\",\n";
-                ss << u8"    \"plPL\": \"Ładunki:\",\n";
-                ss << u8"    \"esMX\": \"Cargas:\",\n";
-                ss << u8"    \"jaJP\": \"使用可能数:\",\n";
-                ss << u8"    \"ptBR\": \"Cargas:\",\n";
-                ss << u8"    \"ruRU\": \"Зарядов:\",\n";
-                ss << u8"    \"zhCN\": \"充能:\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3457,\n";
-                ss << u8"    \"Key\": \"ItemStats1d\",\n";
-                ss << u8"    \"enUS\": \"Durability: %i of %i\",\n";
-                ss << u8"    \"zhTW\": \"耐久度：%i / %i\",\n";
-                ss << u8"    \"deDE\": \"Haltbarkeit: %i von %i\",\n";
-                ss << u8"    \"esES\": \"Durabilidad: %i de %i\",\n";
-                ss << u8"    \"frFR\": \"Résistance : %i sur %i\",\n";
-                ss << u8"    \"itIT\": \"Integrità: %i su %i\",\n";
-                ss << u8"    \"koKR\": \"내구도: %i / %i\",\n";
-                ss << u8"    \"plPL\": \"Trwałość: %i/%i\",\n";
-                ss << u8"    \"esMX\": \"Durabilidad: %i de %i\",\n";
-                ss << u8"    \"jaJP\": \"耐久力: %i/%i\",\n";
-                ss << u8"    \"ptBR\": \"Durabilidade: %i de %i\",\n";
-                ss << u8"    \"ruRU\": \"Прочность: %i из %i\",\n";
-                ss << u8"    \"zhCN\": \"耐久度: %i / %i\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3458,\n";
-                ss << u8"    \"Key\": \"ItemStats1e\",\n";
-                ss << u8"    \"enUS\": \"Required Strength: %d\",\n";
-                ss << u8"    \"zhTW\": \"需要力量：%d\",\n";
-                ss << u8"    \"deDE\": \"Benötigte Stärke: %d\",\n";
-                ss << u8"    \"esES\": \"Fuerza necesaria: %d\",\n";
-                ss << u8"    \"frFR\": \"Force nécessaire : %d\",\n";
-                ss << u8"    \"itIT\": \"Forza richiesta: %d\",\n";
-                ss << u8"    \"koKR\": \"필요 힘: %d\",\n";
-                ss << u8"    \"plPL\": \"Wymagana siła: %d\",\n";
-                ss << u8"    \"esMX\": \"Fuerza requerida: %d\",\n";
-                ss << u8"    \"jaJP\": \"必要な筋力: %d\",\n";
-                ss << u8"    \"ptBR\": \"Força necessária: %d\",\n";
-                ss << u8"    \"ruRU\": \"Требуемая сила: %d\",\n";
-                ss << u8"    \"zhCN\": \"需要力量: %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3459,\n";
-                ss << u8"    \"Key\": \"ItemStats1f\",\n";
-                ss << u8"    \"enUS\": \"Required Dexterity: %d\",\n";
-                ss << u8"    \"zhTW\": \"需要敏捷：%d\",\n";
-                ss << u8"    \"deDE\": \"Benötigte Geschicklichkeit: %d\",\n";
-                ss << u8"    \"esES\": \"Destreza necesaria: %d\",\n";
-                ss << u8"    \"frFR\": \"Dextérité nécessaire : %d\",\n";
-                ss << u8"    \"itIT\": \"Destrezza richiesta: %d\",\n";
-                ss << u8"    \"koKR\": \"필요 민첩: %d\",\n";
-                ss << u8"    \"plPL\": \"Wymagana zręczność: %d\",\n";
-                ss << u8"    \"esMX\": \"Destreza requerida: %d\",\n";
-                ss << u8"    \"jaJP\": \"必要な敏捷性: %d\",\n";
-                ss << u8"    \"ptBR\": \"Destreza necessária: %d\",\n";
-                ss << u8"    \"ruRU\": \"Требуемая ловкость: %d\",\n";
-                ss << u8"    \"zhCN\": \"需要敏捷: %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3460,\n";
-                ss << u8"    \"Key\": \"ItemStats1g\",\n";
-                ss << u8"    \"enUS\": \"Damage:\",\n";
-                ss << u8"    \"zhTW\": \"傷害：\",\n";
-                ss << u8"    \"deDE\": \"Schaden:\",\n";
-                ss << u8"    \"esES\": \"Daño:\",\n";
-                ss << u8"    \"frFR\": \"Dégâts :\",\n";
-                ss << u8"    \"itIT\": \"Danni:\",\n";
-                ss << u8"    \"koKR\": \"피해:\",\n";
-                ss << u8"    \"plPL\": \"Obrażenia:\",\n";
-                ss << u8"    \"esMX\": \"Daño:\",\n";
-                ss << u8"    \"jaJP\": \"ダメージ:\",\n";
-                ss << u8"    \"ptBR\": \"Dano:\",\n";
-                ss << u8"    \"ruRU\": \"Урон:\",\n";
-                ss << u8"    \"zhCN\": \"伤害:\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3461,\n";
-                ss << u8"    \"Key\": \"ItemStats1h\",\n";
-                ss << u8"    \"enUS\": \"Defense: %d\",\n";
-                ss << u8"    \"zhTW\": \"防禦：%d\",\n";
-                ss << u8"    \"deDE\": \"Verteidigung: %d\",\n";
-                ss << u8"    \"esES\": \"Defensa: %d\",\n";
-                ss << u8"    \"frFR\": \"Défense : %d\",\n";
-                ss << u8"    \"itIT\": \"Difesa: %d\",\n";
-                ss << u8"    \"koKR\": \"방어력: %d\",\n";
-                ss << u8"    \"plPL\": \"Obrona: %d\",\n";
-                ss << u8"    \"esMX\": \"Defensa: %d\",\n";
-                ss << u8"    \"jaJP\": \"防御力: %d\",\n";
-                ss << u8"    \"ptBR\": \"Defesa: %d\",\n";
-                ss << u8"    \"ruRU\": \"Защита: %d\",\n";
-                ss << u8"    \"zhCN\": \"防御: %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3462,\n";
-                ss << u8"    \"Key\": \"ItemStats1i\",\n";
-                ss << u8"    \"enUS\": \"Quantity: %d of %d\",\n";
-                ss << u8"    \"zhTW\": \"數量：%d / %d\",\n";
-                ss << u8"    \"deDE\": \"Anzahl: %d von %d\",\n";
-                ss << u8"    \"esES\": \"Cantidad: %d de %d\",\n";
-                ss << u8"    \"frFR\": \"Quantité : %d sur %d\",\n";
-                ss << u8"    \"itIT\": \"Quantità: %d di %d\",\n";
-                ss << u8"    \"koKR\": \"수량: %d/%d\",\n";
-                ss << u8"    \"plPL\": \"Liczba: %d z %d\",\n";
-                ss << u8"    \"esMX\": \"Cantidad: %d de %d\",\n";
-                ss << u8"    \"jaJP\": \"数量: %d/%d\",\n";
-                ss << u8"    \"ptBR\": \"Quantidade: %d de %d\",\n";
-                ss << u8"    \"ruRU\": \"Количество: %d из %d\",\n";
-                ss << u8"    \"zhCN\": \"数量: %d/%d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3463,\n";
-                ss << u8"    \"Key\": \"ItemStats1j\",\n";
-                ss << u8"    \"enUS\": \"of\",\n";
-                ss << u8"    \"zhTW\": \"/\",\n";
-                ss << u8"    \"deDE\": \"von\",\n";
-                ss << u8"    \"esES\": \"de\",\n";
-                ss << u8"    \"frFR\": \"sur\",\n";
-                ss << u8"    \"itIT\": \"di\",\n";
-                ss << u8"    \"koKR\": \"/\",\n";
-                ss << u8"    \"plPL\": \"z\",\n";
-                ss << u8"    \"esMX\": \"de\",\n";
-                ss << u8"    \"jaJP\": \"/\",\n";
-                ss << u8"    \"ptBR\": \"de\",\n";
-                ss << u8"    \"ruRU\": \"из\",\n";
-                ss << u8"    \"zhCN\": \"/\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3464,\n";
-                ss << u8"    \"Key\": \"ItemStast1k\",\n";
-                ss << u8"    \"enUS\": \"to\",\n";
-                ss << u8"    \"zhTW\": \"至\",\n";
-                ss << u8"    \"deDE\": \"bis\",\n";
-                ss << u8"    \"esES\": \"a\",\n";
-                ss << u8"    \"frFR\": \"à\",\n";
-                ss << u8"    \"itIT\": \"a\",\n";
-                ss << u8"    \"koKR\": \"-\",\n";
-                ss << u8"    \"plPL\": \"do\",\n";
-                ss << u8"    \"esMX\": \"a\",\n";
-                ss << u8"    \"jaJP\": \"に\",\n";
-                ss << u8"    \"ptBR\": \"para\",\n";
-                ss << u8"    \"ruRU\": \"до\",\n";
-                ss << u8"    \"zhCN\": \"至\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3465,\n";
-                ss << u8"    \"Key\": \"ItemStats1l\",\n";
-                ss << u8"    \"enUS\": \"One-Hand Damage: %d to %d\",\n";
-                ss << u8"    \"zhTW\": \"單手傷害：%d - %d 點\",\n";
-                ss << u8"    \"deDE\": \"Einhandschaden: %d bis %d\",\n";
-                ss << u8"    \"esES\": \"Daño con una mano: %d-%d p.\",\n";
-                ss << u8"    \"frFR\": \"Dégâts à une main : %d à %d\",\n";
-                ss << u8"    \"itIT\": \"Danni a una mano: %d-%d\",\n";
-                ss << u8"    \"koKR\": \"한손 피해: %d - %d\",\n";
-                ss << u8"    \"plPL\": \"Obrażenia jednorącz: %d-%d\",\n";
-                ss << u8"    \"esMX\": \"Daño de una mano: %d a %d\",\n";
-                ss << u8"    \"jaJP\": \"片手持ちダメージ: %d - %d\",\n";
-                ss << u8"    \"ptBR\": \"Dano de uma mão: %d a %d\",\n";
-                ss << u8"    \"ruRU\": \"Урон от одноручного оружия: %d–%d\",\n";
-                ss << u8"    \"zhCN\": \"单手伤害: %d - %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3466,\n";
-                ss << u8"    \"Key\": \"ItemStats1m\",\n";
-                ss << u8"    \"enUS\": \"Two-Hand Damage: %d to %d\",\n";
-                ss << u8"    \"zhTW\": \"雙手傷害：%d - %d 點\",\n";
-                ss << u8"    \"deDE\": \"Zweihandschaden: %d bis %d\",\n";
-                ss << u8"    \"esES\": \"Daño con dos manos: %d-%d p.\",\n";
-                ss << u8"    \"frFR\": \"Dégâts à deux mains : %d à %d\",\n";
-                ss << u8"    \"itIT\": \"Danni a due mani: %d-%d\",\n";
-                ss << u8"    \"koKR\": \"양손 피해: %d - %d\",\n";
-                ss << u8"    \"plPL\": \"Obrażenia dwurącz: %d-%d\",\n";
-                ss << u8"    \"esMX\": \"Daño de dos manos: %d a %d\",\n";
-                ss << u8"    \"jaJP\": \"両手持ちダメージ: %d - %d\",\n";
-                ss << u8"    \"ptBR\": \"Dano de duas mãos: %d a %d\",\n";
-                ss << u8"    \"ruRU\": \"Урон от двуручного оружия: %d–%d\",\n";
-                ss << u8"    \"zhCN\": \"双手伤害: %d - %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3467,\n";
-                ss << u8"    \"Key\": \"ItemStats1n\",\n";
-                ss << u8"    \"enUS\": \"Throw Damage: %d\",\n";
-                ss << u8"    \"zhTW\": \"投擲傷害：%d 點\",\n";
-                ss << u8"    \"deDE\": \"Wurfschaden: %d\",\n";
-                ss << u8"    \"esES\": \"Daño de lanzamiento: %d p.\",\n";
-                ss << u8"    \"frFR\": \"Dégâts au lancer : %d\",\n";
-                ss << u8"    \"itIT\": \"Danni da lancio: %d\",\n";
-                ss << u8"    \"koKR\": \"투척 피해: %d\",\n";
-                ss << u8"    \"plPL\": \"Obrażenia przy rzucie: %d\",\n";
-                ss << u8"    \"esMX\": \"Daño de arrojamiento: %d\",\n";
-                ss << u8"    \"jaJP\": \"投てきダメージ: %d\",\n";
-                ss << u8"    \"ptBR\": \"Dano de arremesso: %d\",\n";
-                ss << u8"    \"ruRU\": \"Урон от метательного оружия: %d\",\n";
-                ss << u8"    \"zhCN\": \"投掷伤害: %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3468,\n";
-                ss << u8"    \"Key\": \"ItemStats1o\",\n";
-                ss << u8"    \"enUS\": \"Smite Damage: %d to %d\",\n";
-                ss << u8"    \"zhTW\": \"重擊傷害：%d - %d 點\",\n";
-                ss << u8"    \"deDE\": \"Niederstrecken-Schaden: %d bis %d\",\n";
-                ss << u8"    \"esES\": \"Daño de Fulminar: %d-%d p.\",\n";
-                ss << u8"    \"frFR\": \"Dégâts de frappe : %d à %d\",\n";
-                ss << u8"    \"itIT\": \"Danni di Espiazione: %d-%d\",\n";
-                ss << u8"    \"koKR\": \"강타 피해: %d - %d\",\n";
-                ss << u8"    \"plPL\": \"Obrażenia od Pchnięcia: %d-%d\",\n";
-                ss << u8"    \"esMX\": \"Daño de Escarmiento: %d a %d\",\n";
-                ss << u8"    \"jaJP\": \"盾攻撃ダメージ: %d - %d\",\n";
-                ss << u8"    \"ptBR\": \"Dano de Castigo: %d a %d\",\n";
-                ss << u8"    \"ruRU\": \"%d–%d урона от щита\",\n";
-                ss << u8"    \"zhCN\": \"盾击伤害: %d - %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3469,\n";
-                ss << u8"    \"Key\": \"ItemStats1p\",\n";
-                ss << u8"    \"enUS\": \"Required Level: %d\",\n";
-                ss << u8"    \"zhTW\": \"需要等級：%d\",\n";
-                ss << u8"    \"deDE\": \"Benötigte Stufe: %d\",\n";
-                ss << u8"    \"esES\": \"Nivel necesario: %d\",\n";
-                ss << u8"    \"frFR\": \"Niveau nécessaire : %d\",\n";
-                ss << u8"    \"itIT\": \"Livello richiesto: %d\",\n";
-                ss << u8"    \"koKR\": \"요구 레벨: %d\",\n";
-                ss << u8"    \"plPL\": \"Wymagany poziom: %d\",\n";
-                ss << u8"    \"esMX\": \"Nivel requerido: %d\",\n";
-                ss << u8"    \"jaJP\": \"必要レベル: %d\",\n";
-                ss << u8"    \"ptBR\": \"Nível necessário: %d\",\n";
-                ss << u8"    \"ruRU\": \"Требуемый уровень: %d-й\",\n";
-                ss << u8"    \"zhCN\": \"需要等级: %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3470,\n";
-                ss << u8"    \"Key\": \"ItemStats1q\",\n";
-                ss << u8"    \"enUS\": \"Points: %d\",\n";
-                ss << u8"    \"zhTW\": \"點數：%d\",\n";
-                ss << u8"    \"deDE\": \"Punkte: %d\",\n";
-                ss << u8"    \"esES\": \"Puntos: %d\",\n";
-                ss << u8"    \"frFR\": \"Points : %d\",\n";
-                ss << u8"    \"itIT\": \"Punti: %d\",\n";
-                ss << u8"    \"koKR\": \"포인트: %d\",\n";
-                ss << u8"    \"plPL\": \"Punkty: %d\",\n";
-                ss << u8"    \"esMX\": \"Puntos: %d\",\n";
-                ss << u8"    \"jaJP\": \"ポイント: %d\",\n";
-                ss << u8"    \"ptBR\": \"Pontos: %d\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет %d ед.\",\n";
-                ss << u8"    \"zhCN\": \"点数: %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3471,\n";
-                ss << u8"    \"Key\": \"ItemStatsrejuv1\",\n";
-                ss << u8"    \"enUS\": \"Heals %d%% Life and Mana\",\n";
-                ss << u8"    \"zhTW\": \"恢復 %d%% 的生命和法力\",\n";
-                ss << u8"    \"deDE\": \"Heilt %d %% Leben und Mana.\",\n";
-                ss << u8"    \"esES\": \"Restaura un %d%% de vida y maná\",\n";
-                ss << u8"    \"frFR\": \"Récupère %d %% de Vie et de Mana\",\n";
-                ss << u8"    \"itIT\": \"Rigenera il %d%% di vita e mana\",\n";
-                ss << u8"    \"koKR\": \"생명력 및 마나 %d%% 회복\",\n";
-                ss << u8"    \"plPL\": \"Przywraca %d%% zdrowia i many\",\n";
-                ss << u8"    \"esMX\": \"Sana %d%% de vida y de maná\",\n";
-                ss << u8"    \"jaJP\": \"ライフとマナを回復（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Cura %d%% de pontos de vida e mana\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет %d%% здоровья и маны.\",\n";
-                ss << u8"    \"zhCN\": \"治愈 %d%% 生命和法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3472,\n";
-                ss << u8"    \"Key\": \"ItemStatsrejuv2\",\n";
-                ss << u8"    \"enUS\": \"Heals 100% Life and Mana\",\n";
-                ss << u8"    \"zhTW\": \"恢復 100% 的生命和法力\",\n";
-                ss << u8"    \"deDE\": \"Heilt 100% Leben und Mana.\",\n";
-                ss << u8"    \"esES\": \"Restaura un 100% de vida y maná\",\n";
-                ss << u8"    \"frFR\": \"Récupère 100% de Vie et de Mana\",\n";
-                ss << u8"    \"itIT\": \"Rigenera il 100% di vita e mana\",\n";
-                ss << u8"    \"koKR\": \"생명력과 마나 100% 회복\",\n";
-                ss << u8"    \"plPL\": \"Przywraca 100% zdrowia i many\",\n";
-                ss << u8"    \"esMX\": \"Sana 100% de vida y de maná\",\n";
-                ss << u8"    \"jaJP\": \"ライフとマナを完全回復\",\n";
-                ss << u8"    \"ptBR\": \"Cura 100% de pontos de vida e mana\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет 100% здоровья и маны\",\n";
-                ss << u8"    \"zhCN\": \"治愈 100% 生命和法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3473,\n";
-                ss << u8"    \"Key\": \"ModStr1a\",\n";
-                ss << u8"    \"enUS\": \"%+d to Strength\",\n";
-                ss << u8"    \"zhTW\": \"%+d 力量\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Stärke\",\n";
-                ss << u8"    \"esES\": \"%+d de fuerza\",\n";
-                ss << u8"    \"frFR\": \"%+d à la Force\",\n";
-                ss << u8"    \"itIT\": \"%+d Forza\",\n";
-                ss << u8"    \"koKR\": \"힘 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do siły\",\n";
-                ss << u8"    \"esMX\": \"%+d de fuerza\",\n";
-                ss << u8"    \"jaJP\": \"筋力（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de força\",\n";
-                ss << u8"    \"ruRU\": \"%+d к силе\",\n";
-                ss << u8"    \"zhCN\": \"%+d 力量\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3474,\n";
-                ss << u8"    \"Key\": \"ModStr1b\",\n";
-                ss << u8"    \"enUS\": \"%+d to Dexterity\",\n";
-                ss << u8"    \"zhTW\": \"%+d 敏捷\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Geschicklichkeit\",\n";
-                ss << u8"    \"esES\": \"%+d de destreza\",\n";
-                ss << u8"    \"frFR\": \"%+d à la Dextérité\",\n";
-                ss << u8"    \"itIT\": \"%+d Destrezza\",\n";
-                ss << u8"    \"koKR\": \"민첩 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do zręczności\",\n";
-                ss << u8"    \"esMX\": \"%+d de destreza\",\n";
-                ss << u8"    \"jaJP\": \"敏捷性（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de destreza\",\n";
-                ss << u8"    \"ruRU\": \"%+d к ловкости\",\n";
-                ss << u8"    \"zhCN\": \"%+d 敏捷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3475,\n";
-                ss << u8"    \"Key\": \"ModStr1c\",\n";
-                ss << u8"    \"enUS\": \"%+d to Vitality\",\n";
-                ss << u8"    \"zhTW\": \"%+d 體能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Vitalität\",\n";
-                ss << u8"    \"esES\": \"%+d de vitalidad\",\n";
-                ss << u8"    \"frFR\": \"%+d à la Vitalité\",\n";
-                ss << u8"    \"itIT\": \"%+d Vitalità\",\n";
-                ss << u8"    \"koKR\": \"활력 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do żywotności\",\n";
-                ss << u8"    \"esMX\": \"%+d de vitalidad\",\n";
-                ss << u8"    \"jaJP\": \"生命力（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de vitalidade\",\n";
-                ss << u8"    \"ruRU\": \"%+d к живучести\",\n";
-                ss << u8"    \"zhCN\": \"%+d 活力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3476,\n";
-                ss << u8"    \"Key\": \"ModStr1d\",\n";
-                ss << u8"    \"enUS\": \"%+d to Energy\",\n";
-                ss << u8"    \"zhTW\": \"%+d 能量\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Energie\",\n";
-                ss << u8"    \"esES\": \"%+d de energía\",\n";
-                ss << u8"    \"frFR\": \"%+d à l’Énergie\",\n";
-                ss << u8"    \"itIT\": \"%+d Energia\",\n";
-                ss << u8"    \"koKR\": \"마력 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do energii\",\n";
-                ss << u8"    \"esMX\": \"%+d de energía\",\n";
-                ss << u8"    \"jaJP\": \"エナジー（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de energia\",\n";
-                ss << u8"    \"ruRU\": \"%+d к энергии\",\n";
-                ss << u8"    \"zhCN\": \"%+d 能量\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3477,\n";
-                ss << u8"    \"Key\": \"ModStr1e\",\n";
-                ss << u8"    \"enUS\": \"%+d to Mana\",\n";
-                ss << u8"    \"zhTW\": \"%+d 法力\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Mana\",\n";
-                ss << u8"    \"esES\": \"%+d p. de maná\",\n";
-                ss << u8"    \"frFR\": \"%+d au Mana\",\n";
-                ss << u8"    \"itIT\": \"%+d mana\",\n";
-                ss << u8"    \"koKR\": \"마나 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do many\",\n";
-                ss << u8"    \"esMX\": \"%+d de maná\",\n";
-                ss << u8"    \"jaJP\": \"マナ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de mana\",\n";
-                ss << u8"    \"ruRU\": \"%+d к мане\",\n";
-                ss << u8"    \"zhCN\": \"%+d 法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3478,\n";
-                ss << u8"    \"Key\": \"ModStr1f\",\n";
-                ss << u8"    \"enUS\": \"%+d to Maximum Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 最大傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d zu max. Schaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño máximo\",\n";
-                ss << u8"    \"frFR\": \"%+d aux dégâts max.\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni massimi\",\n";
-                ss << u8"    \"koKR\": \"최대 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do maksymalnych obrażeń\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño máximo\",\n";
-                ss << u8"    \"jaJP\": \"最大ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano máximo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к максимальному урону\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最大伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3479,\n";
-                ss << u8"    \"Key\": \"ModStr1g\",\n";
-                ss << u8"    \"enUS\": \"%+d to Minimum Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 最小傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d zu min. Schaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño mínimo\",\n";
-                ss << u8"    \"frFR\": \"%+d aux dégâts min.\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni minimi\",\n";
-                ss << u8"    \"koKR\": \"최소 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do minimalnych obrażeń\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño mínimo\",\n";
-                ss << u8"    \"jaJP\": \"最小ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano mínimo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к минимальному урону\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最小伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3480,\n";
-                ss << u8"    \"Key\": \"ModStr1h\",\n";
-                ss << u8"    \"enUS\": \"%+d to Attack Rating\",\n";
-                ss << u8"    \"zhTW\": \"%+d 準確率\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Angriffswert\",\n";
-                ss << u8"    \"esES\": \"%+d de índice de ataque\",\n";
-                ss << u8"    \"frFR\": \"%+d au score d’attaque\",\n";
-                ss << u8"    \"itIT\": \"%+d indice d'attacco\",\n";
-                ss << u8"    \"koKR\": \"명중률 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do skuteczności ataku\",\n";
-                ss << u8"    \"esMX\": \"%+d de índice de ataque\",\n";
-                ss << u8"    \"jaJP\": \"命中率（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de taxa de ataque\",\n";
-                ss << u8"    \"ruRU\": \"%+d к рейтингу атаки\",\n";
-                ss << u8"    \"zhCN\": \"%+d 命中值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3481,\n";
-                ss << u8"    \"Key\": \"ModStr1i\",\n";
-                ss << u8"    \"enUS\": \"%+d Defense\",\n";
-                ss << u8"    \"zhTW\": \"%+d 防禦\",\n";
-                ss << u8"    \"deDE\": \"%+d Verteidigung\",\n";
-                ss << u8"    \"esES\": \"%+d de defensa\",\n";
-                ss << u8"    \"frFR\": \"%+d à la défense\",\n";
-                ss << u8"    \"itIT\": \"%+d difesa\",\n";
-                ss << u8"    \"koKR\": \"방어력 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do obrony\",\n";
-                ss << u8"    \"esMX\": \"%+d de defensa\",\n";
-                ss << u8"    \"jaJP\": \"防御力（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de defesa\",\n";
-                ss << u8"    \"ruRU\": \"%+d к защите\",\n";
-                ss << u8"    \"zhCN\": \"%+d 防御\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3482,\n";
-                ss << u8"    \"Key\": \"ModStr1j\",\n";
-                ss << u8"    \"enUS\": \"Fire Resist %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"火焰抗性 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Feuerwiderstand %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia al fuego\",\n";
-                ss << u8"    \"frFR\": \"Résistance au Feu : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza al fuoco\",\n";
-                ss << u8"    \"koKR\": \"화염 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do odporności na ogień\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia al fuego\",\n";
-                ss << u8"    \"jaJP\": \"火炎耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Resistência a fogo %+d%%\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к сопротивлению огню\",\n";
-                ss << u8"    \"zhCN\": \"火焰抗性 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3483,\n";
-                ss << u8"    \"Key\": \"ModStr1k\",\n";
-                ss << u8"    \"enUS\": \"Cold Resist %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"冰寒抗性 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Kältewiderstand %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia al frío\",\n";
-                ss << u8"    \"frFR\": \"Résistance au Froid : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza al freddo\",\n";
-                ss << u8"    \"koKR\": \"냉기 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do odporności na zimno\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia al frío\",\n";
-                ss << u8"    \"jaJP\": \"冷気耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Resistência a gelo %+d%%\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к сопротивлению льду\",\n";
-                ss << u8"    \"zhCN\": \"冰霜抗性 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3484,\n";
-                ss << u8"    \"Key\": \"ModStr1l\",\n";
-                ss << u8"    \"enUS\": \"Lightning Resist %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"電擊抗性 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Blitzwiderstand %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia a los rayos\",\n";
-                ss << u8"    \"frFR\": \"Résistance à la Foudre : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza al fulmine\",\n";
-                ss << u8"    \"koKR\": \"번개 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do odporności na błyskawice\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia al rayo\",\n";
-                ss << u8"    \"jaJP\": \"電撃耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Resistência elétrica %+d%%\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к сопротивлению молнии\",\n";
-                ss << u8"    \"zhCN\": \"闪电抗性 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3485,\n";
-                ss << u8"    \"Key\": \"ModStr1m\",\n";
-                ss << u8"    \"enUS\": \"Magic Resist %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"魔法抗性 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Magiewiderstand %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia a la magia\",\n";
-                ss << u8"    \"frFR\": \"Résistance à la Magie : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza alla magia\",\n";
-                ss << u8"    \"koKR\": \"마법 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do odporności na magię\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia mágica\",\n";
-                ss << u8"    \"jaJP\": \"魔法耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Resistência a magia %+d%%\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к сопротивлению магии\",\n";
-                ss << u8"    \"zhCN\": \"魔法抗性 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3486,\n";
-                ss << u8"    \"Key\": \"ModStr1n\",\n";
-                ss << u8"    \"enUS\": \"Poison Resist %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"毒素抗性 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Giftwiderstand %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia al veneno\",\n";
-                ss << u8"    \"frFR\": \"Résistance au Poison : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza al veleno\",\n";
-                ss << u8"    \"koKR\": \"독 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do odporności na trucizny\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia al veneno\",\n";
-                ss << u8"    \"jaJP\": \"毒物耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Resistência a veneno %+d%%\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к сопротивлению яду\",\n";
-                ss << u8"    \"zhCN\": \"毒素抗性 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3487,\n";
-                ss << u8"    \"Key\": \"ModStr1o\",\n";
-                ss << u8"    \"enUS\": \"%+d to Maximum Fire Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 火焰傷害最大值\",\n";
-                ss << u8"    \"deDE\": \"%+d zu max. Feuerschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño máximo de fuego\",\n";
-                ss << u8"    \"frFR\": \"%+d aux dégâts de Feu max.\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni massimi da fuoco\",\n";
-                ss << u8"    \"koKR\": \"최대 화염 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do maksymalnych obrażeń od ognia\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de fuego máximo\",\n";
-                ss << u8"    \"jaJP\": \"最大火炎ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano ígneo máximo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к максимальному урону от огня\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最大火焰伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3488,\n";
-                ss << u8"    \"Key\": \"ModStr1p\",\n";
-                ss << u8"    \"enUS\": \"%+d to Minimum Fire Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 火焰傷害最小值\",\n";
-                ss << u8"    \"deDE\": \"%+d zu min. Feuerschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño mínimo de fuego\",\n";
-                ss << u8"    \"frFR\": \"%+d aux dégâts de Feu min.\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni minimi da fuoco\",\n";
-                ss << u8"    \"koKR\": \"최소 화염 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do minimalnych obrażeń od ognia\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de fuego mínimo\",\n";
-                ss << u8"    \"jaJP\": \"最小火炎ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano ígneo mínimo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к минимальному урону от огня\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最小火焰伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3489,\n";
-                ss << u8"    \"Key\": \"ModStr1q\",\n";
-                ss << u8"    \"enUS\": \"%+d to Maximum Lightning Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 電擊傷害最大值\",\n";
-                ss << u8"    \"deDE\": \"%+d zu max. Blitzschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño máximo de rayos\",\n";
-                ss << u8"    \"frFR\": \"%+d aux dégâts de Foudre max.\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni massimi da fulmine\",\n";
-                ss << u8"    \"koKR\": \"최대 번개 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do maksymalnych obrażeń od błyskawic\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de rayo máximo\",\n";
-                ss << u8"    \"jaJP\": \"最大電撃ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano elétrico máximo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к максимальному урону от молнии\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最大闪电伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3490,\n";
-                ss << u8"    \"Key\": \"ModStr1r\",\n";
-                ss << u8"    \"enUS\": \"%+d to Minimum Lightning Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 電擊傷害最小值\",\n";
-                ss << u8"    \"deDE\": \"%+d zu min. Blitzschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño mínimo de rayos\",\n";
-                ss << u8"    \"frFR\": \"%+d aux dégâts de Foudre min.\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni minimi da fulmine\",\n";
-                ss << u8"    \"koKR\": \"최소 번개 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do minimalnych obrażeń od błyskawic\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de rayo mínimo\",\n";
-                ss << u8"    \"jaJP\": \"最小電撃ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano elétrico mínimo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к минимальному урону от молнии\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最小闪电伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3491,\n";
-                ss << u8"    \"Key\": \"ModStr1s\",\n";
-                ss << u8"    \"enUS\": \"%+d to Maximum Cold Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 冰寒傷害最大值\",\n";
-                ss << u8"    \"deDE\": \"%+d zu max. Kälteschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño máximo de frío\",\n";
-                ss << u8"    \"frFR\": \"%+d aux dégâts de Froid max.\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni massimi da freddo\",\n";
-                ss << u8"    \"koKR\": \"최대 냉기 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do maksymalnych obrażeń od zimna\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de frío máximo\",\n";
-                ss << u8"    \"jaJP\": \"最大冷気ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano gélido máximo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к максимальному урону от льда\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最大冰霜伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3492,\n";
-                ss << u8"    \"Key\": \"ModStr1t\",\n";
-                ss << u8"    \"enUS\": \"%+d to Minimum Cold Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 冰寒傷害最小值\",\n";
-                ss << u8"    \"deDE\": \"%+d zu min. Kälteschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño mínimo de frío\",\n";
-                ss << u8"    \"frFR\": \"%+d aux dégâts de Froid min.\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni minimi da freddo\",\n";
-                ss << u8"    \"koKR\": \"최소 냉기 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do minimalnych obrażeń od zimna\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de frío mínimo\",\n";
-                ss << u8"    \"jaJP\": \"最小冷気ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano gélido mínimo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к минимальному урону от льда\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最小冰霜伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3493,\n";
-                ss << u8"    \"Key\": \"ModStr1u\",\n";
-                ss << u8"    \"enUS\": \"%+d to Life\",\n";
-                ss << u8"    \"zhTW\": \"%+d 生命\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Leben\",\n";
-                ss << u8"    \"esES\": \"%+d p. de vida\",\n";
-                ss << u8"    \"frFR\": \"%+d aux points de vie\",\n";
-                ss << u8"    \"itIT\": \"%+d vita\",\n";
-                ss << u8"    \"koKR\": \"생명력 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do zdrowia\",\n";
-                ss << u8"    \"esMX\": \"%+d de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de pontos de vida\",\n";
-                ss << u8"    \"ruRU\": \"%+d к здоровью\",\n";
-                ss << u8"    \"zhCN\": \"%+d 生命\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3494,\n";
-                ss << u8"    \"Key\": \"ModStr1v\",\n";
-                ss << u8"    \"enUS\": \"Attacker Takes Damage of %d\",\n";
-                ss << u8"    \"zhTW\": \"攻擊者反傷：%d\",\n";
-                ss << u8"    \"deDE\": \"Angreifer erleidet Schaden von %d\",\n";
-                ss << u8"    \"esES\": \"Los atacantes reciben %d p. de daño\",\n";
-                ss << u8"    \"frFR\": \"L’adversaire subit des dégâts de %d\",\n";
-                ss << u8"    \"itIT\": \"Gli attaccanti subiscono danni pari a %d\",\n";
-                ss << u8"    \"koKR\": \"공격자가 피해를 %d 받음\",\n";
-                ss << u8"    \"plPL\": \"Atakujący otrzymują %d pkt. obrażeń\",\n";
-                ss << u8"    \"esMX\": \"El atacante recibe %d de daño\",\n";
-                ss << u8"    \"jaJP\": \"反撃ダメージ（%d）を与える\",\n";
-                ss << u8"    \"ptBR\": \"Agressor recebe %d de dano\",\n";
-                ss << u8"    \"ruRU\": \"Атакующий получает %d урона\",\n";
-                ss << u8"    \"zhCN\": \"攻击者受到 %d 点伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3497,\n";
-                ss << u8"    \"Key\": \"ModStr1y\",\n";
-                ss << u8"    \"enUS\": \"Knockback\",\n";
-                ss << u8"    \"zhTW\": \"擊退\",\n";
-                ss << u8"    \"deDE\": \"Rückstoß\",\n";
-                ss << u8"    \"esES\": \"Repele al objetivo\",\n";
-                ss << u8"    \"frFR\": \"Renversement\",\n";
-                ss << u8"    \"itIT\": \"Respinge il bersaglio\",\n";
-                ss << u8"    \"koKR\": \"밀쳐내기\",\n";
-                ss << u8"    \"plPL\": \"Odrzucanie\",\n";
-                ss << u8"    \"esMX\": \"Retroceso\",\n";
-                ss << u8"    \"jaJP\": \"ノックバック\",\n";
-                ss << u8"    \"ptBR\": \"Repulsão\",\n";
-                ss << u8"    \"ruRU\": \"Отбрасывает врагов\",\n";
-                ss << u8"    \"zhCN\": \"击退\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3498,\n";
-                ss << u8"    \"Key\": \"ModStr1z\",\n";
-                ss << u8"    \"enUS\": \"Elixir of Strength\",\n";
-                ss << u8"    \"zhTW\": \"力量靈藥\",\n";
-                ss << u8"    \"deDE\": \"Elixier der Stärke\",\n";
-                ss << u8"    \"esES\": \"Elixir de fuerza\",\n";
-                ss << u8"    \"frFR\": \"Élixir de Force\",\n";
-                ss << u8"    \"itIT\": \"Elisir della Forza\",\n";
-                ss << u8"    \"koKR\": \"힘의 비약\",\n";
-                ss << u8"    \"plPL\": \"Eliksir siły\",\n";
-                ss << u8"    \"esMX\": \"Elíxir de fuerza\",\n";
-                ss << u8"    \"jaJP\": \"力のエリクサー\",\n";
-                ss << u8"    \"ptBR\": \"Elixir de Força\",\n";
-                ss << u8"    \"ruRU\": \"Эликсир силы\",\n";
-                ss << u8"    \"zhCN\": \"力量药剂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3499,\n";
-                ss << u8"    \"Key\": \"ModStr2a\",\n";
-                ss << u8"    \"enUS\": \"Elixir of Dexterity\",\n";
-                ss << u8"    \"zhTW\": \"敏捷靈藥\",\n";
-                ss << u8"    \"deDE\": \"Elixier der Geschicklichkeit\",\n";
-                ss << u8"    \"esES\": \"Elixir de destreza\",\n";
-                ss << u8"    \"frFR\": \"Élixir de Dextérité\",\n";
-                ss << u8"    \"itIT\": \"Elisir della Destrezza\",\n";
-                ss << u8"    \"koKR\": \"민첩의 비약\",\n";
-                ss << u8"    \"plPL\": \"Eliksir zręczności\",\n";
-                ss << u8"    \"esMX\": \"Elíxir de destreza\",\n";
-                ss << u8"    \"jaJP\": \"敏捷性のエリクサー\",\n";
-                ss << u8"    \"ptBR\": \"Elixir de Destreza\",\n";
-                ss << u8"    \"ruRU\": \"Эликсир ловкости\",\n";
-                ss << u8"    \"zhCN\": \"敏捷药剂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3500,\n";
-                ss << u8"    \"Key\": \"ModStr2b\",\n";
-                ss << u8"    \"enUS\": \"Elixir of Energy\",\n";
-                ss << u8"    \"zhTW\": \"能量靈藥\",\n";
-                ss << u8"    \"deDE\": \"Elixier der Energie\",\n";
-                ss << u8"    \"esES\": \"Elixir de energía\",\n";
-                ss << u8"    \"frFR\": \"Élixir d’Énergie\",\n";
-                ss << u8"    \"itIT\": \"Elisir dell'Energia\",\n";
-                ss << u8"    \"koKR\": \"마력의 비약\",\n";
-                ss << u8"    \"plPL\": \"Eliksir energii\",\n";
-                ss << u8"    \"esMX\": \"Elíxir de energía\",\n";
-                ss << u8"    \"jaJP\": \"エナジーのエリクサー\",\n";
-                ss << u8"    \"ptBR\": \"Elixir de Energia\",\n";
-                ss << u8"    \"ruRU\": \"Эликсир энергии\",\n";
-                ss << u8"    \"zhCN\": \"能量药剂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3501,\n";
-                ss << u8"    \"Key\": \"ModStr2c\",\n";
-                ss << u8"    \"enUS\": \"Elixir of Vitality\",\n";
-                ss << u8"    \"zhTW\": \"體能靈藥\",\n";
-                ss << u8"    \"deDE\": \"Elixier der Vitalität\",\n";
-                ss << u8"    \"esES\": \"Elixir de vitalidad\",\n";
-                ss << u8"    \"frFR\": \"Élixir de Vitalité\",\n";
-                ss << u8"    \"itIT\": \"Elisir della Vitalità\",\n";
-                ss << u8"    \"koKR\": \"활력의 비약\",\n";
-                ss << u8"    \"plPL\": \"Eliksir żywotności\",\n";
-                ss << u8"    \"esMX\": \"Elíxir de vitalidad\",\n";
-                ss << u8"    \"jaJP\": \"生命力のエリクサー\",\n";
-                ss << u8"    \"ptBR\": \"Elixir de Vitalidade\",\n";
-                ss << u8"    \"ruRU\": \"Эликсир живучести\",\n";
-                ss << u8"    \"zhCN\": \"活力药剂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3502,\n";
-                ss << u8"    \"Key\": \"ModStr2d\",\n";
-                ss << u8"    \"enUS\": \"Elixir of Mana\",\n";
-                ss << u8"    \"zhTW\": \"法力靈藥\",\n";
-                ss << u8"    \"deDE\": \"Elixier mit Mana\",\n";
-                ss << u8"    \"esES\": \"Elixir de maná\",\n";
-                ss << u8"    \"frFR\": \"Élixir de Mana\",\n";
-                ss << u8"    \"itIT\": \"Elisir del Mana\",\n";
-                ss << u8"    \"koKR\": \"마나의 비약\",\n";
-                ss << u8"    \"plPL\": \"Eliksir many\",\n";
-                ss << u8"    \"esMX\": \"Elíxir de maná\",\n";
-                ss << u8"    \"jaJP\": \"マナのエリクサー\",\n";
-                ss << u8"    \"ptBR\": \"Elixir de Mana\",\n";
-                ss << u8"    \"ruRU\": \"Эликсир маны\",\n";
-                ss << u8"    \"zhCN\": \"法力药剂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3503,\n";
-                ss << u8"    \"Key\": \"ModStr2e\",\n";
-                ss << u8"    \"enUS\": \"Elixir of Life\",\n";
-                ss << u8"    \"zhTW\": \"生命靈藥\",\n";
-                ss << u8"    \"deDE\": \"Elixier des Lebens\",\n";
-                ss << u8"    \"esES\": \"Elixir de vida\",\n";
-                ss << u8"    \"frFR\": \"Élixir de Vie\",\n";
-                ss << u8"    \"itIT\": \"Elisir della Vita\",\n";
-                ss << u8"    \"koKR\": \"생명력의 비약\",\n";
-                ss << u8"    \"plPL\": \"Eliksir zdrowia\",\n";
-                ss << u8"    \"esMX\": \"Elíxir de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフのエリクサー\",\n";
-                ss << u8"    \"ptBR\": \"Elixir de Vida\",\n";
-                ss << u8"    \"ruRU\": \"Эликсир здоровья\",\n";
-                ss << u8"    \"zhCN\": \"生命药剂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3504,\n";
-                ss << u8"    \"Key\": \"ModStr2f\",\n";
-                ss << u8"    \"enUS\": \"Sec. Duration\",\n";
-                ss << u8"    \"zhTW\": \"持續秒數\",\n";
-                ss << u8"    \"deDE\": \"Sek. Dauer\",\n";
-                ss << u8"    \"esES\": \"s de duración\",\n";
-                ss << u8"    \"frFR\": \"Durée en s\",\n";
-                ss << u8"    \"itIT\": \"s di durata\",\n";
-                ss << u8"    \"koKR\": \"초 지속\",\n";
-                ss << u8"    \"plPL\": \"Sek. trwania\",\n";
-                ss << u8"    \"esMX\": \"Seg. de duración\",\n";
-                ss << u8"    \"jaJP\": \"秒間持続\",\n";
-                ss << u8"    \"ptBR\": \"Duração em segundos\",\n";
-                ss << u8"    \"ruRU\": \"сек. времени действия\",\n";
-                ss << u8"    \"zhCN\": \"秒持续时间\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3505,\n";
-                ss << u8"    \"Key\": \"ModStr2g\",\n";
-                ss << u8"    \"enUS\": \"Increase Maximum Life %d%%\",\n";
-                ss << u8"    \"zhTW\": \"生命上限提高 %d%%\",\n";
-                ss << u8"    \"deDE\": \"Erhöht max. Leben %d%%\",\n";
-                ss << u8"    \"esES\": \"Aumenta la vida máxima un %d%%\",\n";
-                ss << u8"    \"frFR\": \"Augmente les points de vie max. de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Vita massima aumentata del %d%%\",\n";
-                ss << u8"    \"koKR\": \"최대 생명력 %d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"+%d%% do maksymalnej wartości punktów zdrowia\",\n";
-                ss << u8"    \"esMX\": \"%d%% más de vida máxima\",\n";
-                ss << u8"    \"jaJP\": \"ライフの最大値上昇（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Aumenta o máximo de pontos de vida em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"+%d%% к максимальному запасу здоровья\",\n";
-                ss << u8"    \"zhCN\": \"+%d%% 生命最大值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3506,\n";
-                ss << u8"    \"Key\": \"ModStr2h\",\n";
-                ss << u8"    \"enUS\": \"Increase Maximum Mana %d%%\",\n";
-                ss << u8"    \"zhTW\": \"法力上限提高 %d%%\",\n";
-                ss << u8"    \"deDE\": \"Erhöht max. Mana %d%%\",\n";
-                ss << u8"    \"esES\": \"Aumenta el maná máximo un %d%%\",\n";
-                ss << u8"    \"frFR\": \"Augmente les points de mana max. de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Mana massimo aumentato del %d%%\",\n";
-                ss << u8"    \"koKR\": \"최대 마나 %d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"+%d%% do maksymalnej wartości punktów many\",\n";
-                ss << u8"    \"esMX\": \"%d%% más de maná máximo\",\n";
-                ss << u8"    \"jaJP\": \"マナの最大値上昇（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Aumenta o máximo de mana em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"+%d%% к максимальному запасу маны\",\n";
-                ss << u8"    \"zhCN\": \"+%d%% 法力最大值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3507,\n";
-                ss << u8"    \"Key\": \"ModStr2i\",\n";
-                ss << u8"    \"enUS\": \"Increase Maximum Durability %d%%\",\n";
-                ss << u8"    \"zhTW\": \"耐久度上限提高 %d%%\",\n";
-                ss << u8"    \"deDE\": \"Erhöht max. Haltbarkeit %d%%\",\n";
-                ss << u8"    \"esES\": \"Aumenta la durabilidad máxima un %d%%\",\n";
-                ss << u8"    \"frFR\": \"Augmente les points de durabilité max. de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Integrità massima aumentata del %d%%\",\n";
-                ss << u8"    \"koKR\": \"최대 내구도 %d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"+%d%% do maksymalnej wartości punktów trwałości\",\n";
-                ss << u8"    \"esMX\": \"%d%% más de durabilidad máxima\",\n";
-                ss << u8"    \"jaJP\": \"耐久力の最大値上昇（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Aumenta a durabilidade máxima em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"+%d%% к максимальной прочности\",\n";
-                ss << u8"    \"zhCN\": \"+%d%% 最大耐久度\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3508,\n";
-                ss << u8"    \"Key\": \"ModStr2j\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Enhanced Maximum Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 最大傷害強化\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Verbesserter max. Schaden\",\n";
-                ss << u8"    \"esES\": \"%+d%% de daño máximo mejorado\",\n";
-                ss << u8"    \"frFR\": \"Dégâts max. améliorés de %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% danni massimi\",\n";
-                ss << u8"    \"koKR\": \"최대 피해 %+d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do maksymalnych obrażeń\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de daño máximo mejorado\",\n";
-                ss << u8"    \"jaJP\": \"最大ダメージ強化（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de dano máximo aprimorado\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к максимальному урону\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 强化最大伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3509,\n";
-                ss << u8"    \"Key\": \"ModStr2k\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Enhanced Minimum Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 最小傷害強化\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Verbesserter min. Schaden\",\n";
-                ss << u8"    \"esES\": \"%+d%% de daño mínimo mejorado\",\n";
-                ss << u8"    \"frFR\": \"Dégâts min. améliorés de %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% danni minimi\",\n";
-                ss << u8"    \"koKR\": \"최소 피해 %+d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do minimalnych obrażeń\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de daño mínimo mejorado\",\n";
-                ss << u8"    \"jaJP\": \"最小ダメージ強化（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de dano mínimo aprimorado\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к минимальному урону\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 强化最小伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3510,\n";
-                ss << u8"    \"Key\": \"ModStr2l\",\n";
-                ss << u8"    \"enUS\": \"Replenish Life %+d\",\n";
-                ss << u8"    \"zhTW\": \"生命回復 %+d\",\n";
-                ss << u8"    \"deDE\": \"Lebensregeneration %+d\",\n";
-                ss << u8"    \"esES\": \"%+d de regeneración de vida\",\n";
-                ss << u8"    \"frFR\": \"Rend %+d PV\",\n";
-                ss << u8"    \"itIT\": \"%+d rigenerazione della vita\",\n";
-                ss << u8"    \"koKR\": \"생명력 회복 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do przywracania zdrowia\",\n";
-                ss << u8"    \"esMX\": \"%+d de regeneración de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフをゆっくりと回復（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"Restaura pontos de vida em %+d\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет %+d здоровья\",\n";
-                ss << u8"    \"zhCN\": \"补充生命 %+d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3511,\n";
-                ss << u8"    \"Key\": \"ModStr2m\",\n";
-                ss << u8"    \"enUS\": \"Replenish Mana\",\n";
-                ss << u8"    \"zhTW\": \"回復法力\",\n";
-                ss << u8"    \"deDE\": \"Manaregeneration\",\n";
-                ss << u8"    \"esES\": \"Restaura maná\",\n";
-                ss << u8"    \"frFR\": \"Rend du mana\",\n";
-                ss << u8"    \"itIT\": \"Rigenera mana\",\n";
-                ss << u8"    \"koKR\": \"마나 회복\",\n";
-                ss << u8"    \"plPL\": \"Odnowienie many\",\n";
-                ss << u8"    \"esMX\": \"Regenera maná\",\n";
-                ss << u8"    \"jaJP\": \"マナをゆっくりと回復\",\n";
-                ss << u8"    \"ptBR\": \"Restauração de mana\",\n";
-                ss << u8"    \"ruRU\": \"Восполнение маны\",\n";
-                ss << u8"    \"zhCN\": \"补充法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3512,\n";
-                ss << u8"    \"Key\": \"ModStr2n\",\n";
-                ss << u8"    \"enUS\": \"Heal 1/4 Life\",\n";
-                ss << u8"    \"zhTW\": \"醫治 1/4 生命\",\n";
-                ss << u8"    \"deDE\": \"¼ Leben heilen\",\n";
-                ss << u8"    \"esES\": \"Cura un 25% de vida\",\n";
-                ss << u8"    \"frFR\": \"Rend 1/4 des PV\",\n";
-                ss << u8"    \"itIT\": \"Rigenera 1/4 della vita\",\n";
-                ss << u8"    \"koKR\": \"생명력 1/4 회복\",\n";
-                ss << u8"    \"plPL\": \"Przywraca 1/4 zdrowia\",\n";
-                ss << u8"    \"esMX\": \"Sana 1/4 de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフを回復（25%%）\",\n";
-                ss << u8"    \"ptBR\": \"Cura 1/4 de vida\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет 1/4 здоровья\",\n";
-                ss << u8"    \"zhCN\": \"治愈1/4生命\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3513,\n";
-                ss << u8"    \"Key\": \"ModStr2o\",\n";
-                ss << u8"    \"enUS\": \"Heal 1/2 Life\",\n";
-                ss << u8"    \"zhTW\": \"醫治 1/2 生命\",\n";
-                ss << u8"    \"deDE\": \"½ Leben heilen\",\n";
-                ss << u8"    \"esES\": \"Cura un 50% de vida\",\n";
-                ss << u8"    \"frFR\": \"Rend 1/2 des PV\",\n";
-                ss << u8"    \"itIT\": \"Rigenera 1/2 della vita\",\n";
-                ss << u8"    \"koKR\": \"생명력 1/2 회복\",\n";
-                ss << u8"    \"plPL\": \"Przywraca 1/2 zdrowia\",\n";
-                ss << u8"    \"esMX\": \"Sana 1/2 de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフを回復（50%%）\",\n";
-                ss << u8"    \"ptBR\": \"Cura 1/2 vida\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет 1/2 здоровья\",\n";
-                ss << u8"    \"zhCN\": \"治愈1/2生命\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3514,\n";
-                ss << u8"    \"Key\": \"ModStr2p\",\n";
-                ss << u8"    \"enUS\": \"Restore Full Life\",\n";
-                ss << u8"    \"zhTW\": \"醫治所有生命\",\n";
-                ss << u8"    \"deDE\": \"Volles Leben wiederherstellen\",\n";
-                ss << u8"    \"esES\": \"Restaura toda la vida\",\n";
-                ss << u8"    \"frFR\": \"Rend tous les PV\",\n";
-                ss << u8"    \"itIT\": \"Rigenera tutta la vita\",\n";
-                ss << u8"    \"koKR\": \"생명력 전체 회복\",\n";
-                ss << u8"    \"plPL\": \"Przywraca pełne zdrowie\",\n";
-                ss << u8"    \"esMX\": \"Restaura toda la vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフを完全回復\",\n";
-                ss << u8"    \"ptBR\": \"Recuperação de vida integral\",\n";
-                ss << u8"    \"ruRU\": \"Полное восполнение здоровья\",\n";
-                ss << u8"    \"zhCN\": \"恢复所有生命\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3515,\n";
-                ss << u8"    \"Key\": \"ModStr2q\",\n";
-                ss << u8"    \"enUS\": \"Replenish 1/4 Mana\",\n";
-                ss << u8"    \"zhTW\": \"回復 1/4 法力\",\n";
-                ss << u8"    \"deDE\": \"¼ Mana wiederherstellen\",\n";
-                ss << u8"    \"esES\": \"Restaura un 25% de maná\",\n";
-                ss << u8"    \"frFR\": \"Rend 1/4 de mana\",\n";
-                ss << u8"    \"itIT\": \"Rigenera 1/4 del mana\",\n";
-                ss << u8"    \"koKR\": \"마나 1/4 회복\",\n";
-                ss << u8"    \"plPL\": \"Odnawia 1/4 many\",\n";
-                ss << u8"    \"esMX\": \"Regenera 1/4 de maná\",\n";
-                ss << u8"    \"jaJP\": \"マナをゆっくりと回復（25%%）\",\n";
-                ss << u8"    \"ptBR\": \"Restaura 1/4 de mana\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет 1/4 маны\",\n";
-                ss << u8"    \"zhCN\": \"补充1/4法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3516,\n";
-                ss << u8"    \"Key\": \"ModStr2r\",\n";
-                ss << u8"    \"enUS\": \"Replenish 1/2 Life\",\n";
-                ss << u8"    \"zhTW\": \"回復 1/2 生命\",\n";
-                ss << u8"    \"deDE\": \"½ Mana wiederherstellen\",\n";
-                ss << u8"    \"esES\": \"Restaura un 50% de vida\",\n";
-                ss << u8"    \"frFR\": \"Rend 1/2 de mana\",\n";
-                ss << u8"    \"itIT\": \"Rigenera 1/2 del mana\",\n";
-                ss << u8"    \"koKR\": \"마나 1/2 회복\",\n";
-                ss << u8"    \"plPL\": \"Odnawia 1/2 many\",\n";
-                ss << u8"    \"esMX\": \"Regenera 1/2 de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフをゆっくりと回復（50%%）\",\n";
-                ss << u8"    \"ptBR\": \"Restaura 1/2 vida\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет 1/2 здоровья\",\n";
-                ss << u8"    \"zhCN\": \"补充1/2生命\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3517,\n";
-                ss << u8"    \"Key\": \"ModStr2s\",\n";
-                ss << u8"    \"enUS\": \"Restore Full Mana\",\n";
-                ss << u8"    \"zhTW\": \"回復所有法力\",\n";
-                ss << u8"    \"deDE\": \"Volles Mana wiederherstellen\",\n";
-                ss << u8"    \"esES\": \"Restaura todo el maná\",\n";
-                ss << u8"    \"frFR\": \"Rend tous les pts de mana\",\n";
-                ss << u8"    \"itIT\": \"Rigenera tutto il mana\",\n";
-                ss << u8"    \"koKR\": \"마나 전체 회복\",\n";
-                ss << u8"    \"plPL\": \"Odnawia całą manę\",\n";
-                ss << u8"    \"esMX\": \"Restaura todo el maná\",\n";
-                ss << u8"    \"jaJP\": \"マナを完全回復\",\n";
-                ss << u8"    \"ptBR\": \"Recuperação de mana integral\",\n";
-                ss << u8"    \"ruRU\": \"Полностью восполняет ману\",\n";
-                ss << u8"    \"zhCN\": \"恢复所有法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3518,\n";
-                ss << u8"    \"Key\": \"ModStr2t\",\n";
-                ss << u8"    \"enUS\": \"Magic Damage Reduced by %d\",\n";
-                ss << u8"    \"zhTW\": \"魔法傷害降低 %d\",\n";
-                ss << u8"    \"deDE\": \"Magieschaden reduziert um %d\",\n";
-                ss << u8"    \"esES\": \"Daño mágico reducido en %d p.\",\n";
-                ss << u8"    \"frFR\": \"Dégâts magiques réduits de %d\",\n";
-                ss << u8"    \"itIT\": \"Danni magici ridotti di %d\",\n";
-                ss << u8"    \"koKR\": \"마법 피해 %d 감소\",\n";
-                ss << u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od magii o %d pkt.\",\n";
-                ss << u8"    \"esMX\": \"Reduce en %d el daño mágico\",\n";
-                ss << u8"    \"jaJP\": \"魔法ダメージを軽減（%d）\",\n";
-                ss << u8"    \"ptBR\": \"Dano mágico reduzido em %d\",\n";
-                ss << u8"    \"ruRU\": \"–%d к магическому урону\",\n";
-                ss << u8"    \"zhCN\": \"魔法伤害降低 %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3519,\n";
-                ss << u8"    \"Key\": \"ModStr2u\",\n";
-                ss << u8"    \"enUS\": \"Damage Reduced by %d\",\n";
-                ss << u8"    \"zhTW\": \"傷害降低 %d\",\n";
-                ss << u8"    \"deDE\": \"Schaden reduziert um %d\",\n";
-                ss << u8"    \"esES\": \"Daño reducido en %d p.\",\n";
-                ss << u8"    \"frFR\": \"Dégâts réduits de %d\",\n";
-                ss << u8"    \"itIT\": \"Danni ridotti di %d\",\n";
-                ss << u8"    \"koKR\": \"피해 %d 감소\",\n";
-                ss << u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia o %d pkt.\",\n";
-                ss << u8"    \"esMX\": \"Reduce en %d el daño\",\n";
-                ss << u8"    \"jaJP\": \"ダメージを軽減（%d）\",\n";
-                ss << u8"    \"ptBR\": \"Dano reduzido em %d\",\n";
-                ss << u8"    \"ruRU\": \"–%d к урону\",\n";
-                ss << u8"    \"zhCN\": \"伤害降低 %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3520,\n";
-                ss << u8"    \"Key\": \"Modstr2v\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Enhanced Defense\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 防禦強化\",\n";
-                ss << u8"    \"deDE\": \"%+d%% verbesserte Verteidigung\",\n";
-                ss << u8"    \"esES\": \"%+d%% de defensa mejorada\",\n";
-                ss << u8"    \"frFR\": \"Défense augmentée de %+d%% \",\n";
-                ss << u8"    \"itIT\": \"%+d%% difesa\",\n";
-                ss << u8"    \"koKR\": \"방어력 %+d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do obrony\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de defensa mejorada\",\n";
-                ss << u8"    \"jaJP\": \"防御力を強化（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de defesa aprimorada\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к защите\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 强化防御\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3521,\n";
-                ss << u8"    \"Key\": \"ModStr2w\",\n";
-                ss << u8"    \"enUS\": \"Drain Life %d\",\n";
-                ss << u8"    \"zhTW\": \"吸取生命 %d\",\n";
-                ss << u8"    \"deDE\": \"Lebensverlust %d\",\n";
-                ss << u8"    \"esES\": \"Drenaje de vida %d\",\n";
-                ss << u8"    \"frFR\": \"Drain de vie %d\",\n";
-                ss << u8"    \"itIT\": \"%d di risucchio vita\",\n";
-                ss << u8"    \"koKR\": \"생명력 흡수 %d\",\n";
-                ss << u8"    \"plPL\": \"%d Do wyssania zdrowia\",\n";
-                ss << u8"    \"esMX\": \"Drenaje de vida %d\",\n";
-                ss << u8"    \"jaJP\": \"ライフに継続ダメージ（%d）\",\n";
-                ss << u8"    \"ptBR\": \"Drenagem de vida %d\",\n";
-                ss << u8"    \"ruRU\": \"Похищает %d здоровья\",\n";
-                ss << u8"    \"zhCN\": \"抽取生命 %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3522,\n";
-                ss << u8"    \"Key\": \"ModStr2x\",\n";
-                ss << u8"    \"enUS\": \"Drain Mana\",\n";
-                ss << u8"    \"zhTW\": \"吸取法力\",\n";
-                ss << u8"    \"deDE\": \"Manaverlust\",\n";
-                ss << u8"    \"esES\": \"Drena maná\",\n";
-                ss << u8"    \"frFR\": \"Drain de mana\",\n";
-                ss << u8"    \"itIT\": \"Risucchia mana\",\n";
-                ss << u8"    \"koKR\": \"마나 흡수\",\n";
-                ss << u8"    \"plPL\": \"Wyssanie many\",\n";
-                ss << u8"    \"esMX\": \"Drena maná\",\n";
-                ss << u8"    \"jaJP\": \"マナに継続ダメージ\",\n";
-                ss << u8"    \"ptBR\": \"Drenagem de mana\",\n";
-                ss << u8"    \"ruRU\": \"Похищение маны\",\n";
-                ss << u8"    \"zhCN\": \"抽取法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3523,\n";
-                ss << u8"    \"Key\": \"ModStr2y\",\n";
-                ss << u8"    \"enUS\": \"%d%% Mana stolen per hit\",\n";
-                ss << u8"    \"zhTW\": \"擊中竊取 %d%% 法力\",\n";
-                ss << u8"    \"deDE\": \"%d%% abgesaugtes Mana pro Treffer\",\n";
-                ss << u8"    \"esES\": \"%d%% de maná robado por golpe\",\n";
-                ss << u8"    \"frFR\": \"%d%% de mana volé à chaque coup\",\n";
-                ss << u8"    \"itIT\": \"%d%% mana rubato per colpo\",\n";
-                ss << u8"    \"koKR\": \"적중당 마나 %d%% 훔침\",\n";
-                ss << u8"    \"plPL\": \"%d%% many wykradzione za każde trafienie\",\n";
-                ss << u8"    \"esMX\": \"%d%% de maná robado por golpe\",\n";
-                ss << u8"    \"jaJP\": \"攻撃命中でマナを吸収（与ダメージの%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%d%% de mana roubado por acerto\",\n";
-                ss << u8"    \"ruRU\": \"Похищает %d%% маны за удар\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 击中时偷取法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3524,\n";
-                ss << u8"    \"Key\": \"ModStr2z\",\n";
-                ss << u8"    \"enUS\": \"%d%% Life stolen per hit\",\n";
-                ss << u8"    \"zhTW\": \"擊中竊取 %d%% 生命\",\n";
-                ss << u8"    \"deDE\": \"%d%% abgesaugtes Leben pro Treffer\",\n";
-                ss << u8"    \"esES\": \"%d%% de vida robada por golpe\",\n";
-                ss << u8"    \"frFR\": \"%d%% de vie volée à chaque coup\",\n";
-                ss << u8"    \"itIT\": \"%d%% vita rubata per colpo\",\n";
-                ss << u8"    \"koKR\": \"적중당 생명력 %d%% 훔침\",\n";
-                ss << u8"    \"plPL\": \"%d%% zdrowia wykradzione za każde trafienie\",\n";
-                ss << u8"    \"esMX\": \"%d%% de vida robada por golpe\",\n";
-                ss << u8"    \"jaJP\": \"攻撃命中でライフを吸収（与ダメージの%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%d%% de pontos de vida roubados por acerto\",\n";
-                ss << u8"    \"ruRU\": \"Похищает %d%% здоровья за удар\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 击中时偷取生命\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3525,\n";
-                ss << u8"    \"Key\": \"ModStr3a\",\n";
-                ss << u8"    \"enUS\": \"%+d to Amazon Skill Levels\",\n";
-                ss << u8"    \"zhTW\": \"%+d 亞馬遜技能等級\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Amazonenfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los niveles de habilidad de la amazona\",\n";
-                ss << u8"    \"frFR\": \"%+d aux niv. de compétence de l’Amazone\",\n";
-                ss << u8"    \"itIT\": \"%+d alle abilità dell'Amazzone\",\n";
-                ss << u8"    \"koKR\": \"아마존 기술 레벨 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności amazonki\",\n";
-                ss << u8"    \"esMX\": \"%+d a los niveles de habilidad de la Amazona\",\n";
-                ss << u8"    \"jaJP\": \"〈アマゾネス〉スキルレベル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de níveis de habilidade de Amazona\",\n";
-                ss << u8"    \"ruRU\": \"%+d к уровню умений амазонки\",\n";
-                ss << u8"    \"zhCN\": \"%+d 亚马逊技能等级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3526,\n";
-                ss << u8"    \"Key\": \"ModStr3b\",\n";
-                ss << u8"    \"enUS\": \"%+d to Paladin Skill Levels\",\n";
-                ss << u8"    \"zhTW\": \"%+d 聖騎士技能等級\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Paladinfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los niveles de habilidad del paladín\",\n";
-                ss << u8"    \"frFR\": \"%+d aux niv. de compétence du Paladin\",\n";
-                ss << u8"    \"itIT\": \"%+d alle abilità del Paladino\",\n";
-                ss << u8"    \"koKR\": \"성기사 기술 레벨 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności paladyna\",\n";
-                ss << u8"    \"esMX\": \"%+d a los niveles de habilidad del Paladín\",\n";
-                ss << u8"    \"jaJP\": \"〈パラディン〉スキルレベル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de níveis de habilidade de Paladino\",\n";
-                ss << u8"    \"ruRU\": \"%+d к уровню умений паладина\",\n";
-                ss << u8"    \"zhCN\": \"%+d 圣骑士技能等级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3527,\n";
-                ss << u8"    \"Key\": \"ModStr3c\",\n";
-                ss << u8"    \"enUS\": \"%+d to Necromancer Skill Levels\",\n";
-                ss << u8"    \"zhTW\": \"%+d 死靈法師技能等級\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Totenbeschwörerfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los niveles de habilidad del nigromante\",\n";
-                ss << u8"    \"frFR\": \"%+d aux niv. de compétence du Nécromancien\",\n";
-                ss << u8"    \"itIT\": \"%+d alle abilità del Negromante\",\n";
-                ss << u8"    \"koKR\": \"강령술사 기술 레벨 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności nekromanty\",\n";
-                ss << u8"    \"esMX\": \"%+d a los niveles de habilidad del Nigromante\",\n";
-                ss << u8"    \"jaJP\": \"〈ネクロマンサー〉スキルレベル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de níveis de habilidade de Necromante\",\n";
-                ss << u8"    \"ruRU\": \"%+d к уровню умений некроманта\",\n";
-                ss << u8"    \"zhCN\": \"%+d 死灵法师技能等级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3528,\n";
-                ss << u8"    \"Key\": \"ModStr3d\",\n";
-                ss << u8"    \"enUS\": \"%+d to Sorceress Skill Levels\",\n";
-                ss << u8"    \"zhTW\": \"%+d 魔法使技能等級\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Zauberinfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los niveles de habilidad de la hechicera\",\n";
-                ss << u8"    \"frFR\": \"%+d aux niv. de compétence de la Sorcière\",\n";
-                ss << u8"    \"itIT\": \"%+d alle abilità dell'Incantatrice\",\n";
-                ss << u8"    \"koKR\": \"원소술사 기술 레벨 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności czarodziejki\",\n";
-                ss << u8"    \"esMX\": \"%+d a los niveles de habilidad de la Hechicera\",\n";
-                ss << u8"    \"jaJP\": \"〈ソーサレス〉スキルレベル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de níveis de habilidade de Maga\",\n";
-                ss << u8"    \"ruRU\": \"%+d к уровню умений волшебницы\",\n";
-                ss << u8"    \"zhCN\": \"%+d 巫师技能等级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3529,\n";
-                ss << u8"    \"Key\": \"ModStr3e\",\n";
-                ss << u8"    \"enUS\": \"%+d to Barbarian Skill Levels\",\n";
-                ss << u8"    \"zhTW\": \"%+d 野蠻人技能等級\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Barbarenfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los niveles de habilidad del bárbaro\",\n";
-                ss << u8"    \"frFR\": \"%+d aux niv. de compétence du Barbare\",\n";
-                ss << u8"    \"itIT\": \"%+d alle abilità del Barbaro\",\n";
-                ss << u8"    \"koKR\": \"야만용사 기술 레벨 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności barbarzyńcy\",\n";
-                ss << u8"    \"esMX\": \"%+d a los niveles de habilidad del Bárbaro\",\n";
-                ss << u8"    \"jaJP\": \"〈バーバリアン〉スキルレベル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de níveis de habilidade de Bárbaro\",\n";
-                ss << u8"    \"ruRU\": \"%+d к уровню умений варвара\",\n";
-                ss << u8"    \"zhCN\": \"%+d 野蛮人技能等级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3530,\n";
-                ss << u8"    \"Key\": \"ModStr3f\",\n";
-                ss << u8"    \"enUS\": \"%+d to Light Radius\",\n";
-                ss << u8"    \"zhTW\": \"照亮範圍 %+d\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Lichtradius\",\n";
-                ss << u8"    \"esES\": \"%+d de radio de visión\",\n";
-                ss << u8"    \"frFR\": \"%+d à la portée lumineuse\",\n";
-                ss << u8"    \"itIT\": \"%+d al raggio d'illuminazione\",\n";
-                ss << u8"    \"koKR\": \"시야 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do promienia światła\",\n";
-                ss << u8"    \"esMX\": \"%+d de radio de visibilidad\",\n";
-                ss << u8"    \"jaJP\": \"明かりの範囲（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de raio de visibilidade\",\n";
-                ss << u8"    \"ruRU\": \"%+d к радиусу обзора\",\n";
-                ss << u8"    \"zhCN\": \"%+d 照亮范围\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3531,\n";
-                ss << u8"    \"Key\": \"ModStr3g\",\n";
-                ss << u8"    \"enUS\": \"%d%% Increased Chance of Blocking\",\n";
-                ss << u8"    \"zhTW\": \"格擋機率提高 %d%%\",\n";
-                ss << u8"    \"deDE\": \"%d%% erhöhte Blockchance\",\n";
-                ss << u8"    \"esES\": \"+%d%% de probabilidad de bloqueo\",\n";
-                ss << u8"    \"frFR\": \"%d%% de chances suppl. de bloquer\",\n";
-                ss << u8"    \"itIT\": \"Probabilità di parata aumentata del %d%%\",\n";
-                ss << u8"    \"koKR\": \"막기 확률 %d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"+%d%% do szansy na blok\",\n";
-                ss << u8"    \"esMX\": \"%d%% más de probabilidad de bloqueo\",\n";
-                ss << u8"    \"jaJP\": \"ブロック確率上昇（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%d%% de chance adicional de bloqueio\",\n";
-                ss << u8"    \"ruRU\": \"Вероятность %d%% заблокировать удар\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 格挡几率提高\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3532,\n";
-                ss << u8"    \"Key\": \"ModStr3h\",\n";
-                ss << u8"    \"enUS\": \"Requirements %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"需求 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Anforderungen %+d%%\",\n";
-                ss << u8"    \"esES\": \"Requisitos %+d%%\",\n";
-                ss << u8"    \"frFR\": \"Conditions requises : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"Requisiti %+d%%\",\n";
-                ss << u8"    \"koKR\": \"착용 조건 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"Wymagania %+d%%\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de requisitos\",\n";
-                ss << u8"    \"jaJP\": \"必要ステータス（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Requisitos %+d%%\",\n";
-                ss << u8"    \"ruRU\": \"Требования: %+d%%\",\n";
-                ss << u8"    \"zhCN\": \"需求 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3533,\n";
-                ss << u8"    \"Key\": \"ModStr3i\",\n";
-                ss << u8"    \"enUS\": \"%+d to Fire Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 火焰技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Feuerfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los hechizos de fuego\",\n";
-                ss << u8"    \"frFR\": \"%+d aux compétences de Feu\",\n";
-                ss << u8"    \"itIT\": \"%+d alle abilità di fuoco\",\n";
-                ss << u8"    \"koKR\": \"화염 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności ognia\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Fuego\",\n";
-                ss << u8"    \"jaJP\": \"〈火炎〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades ígneas\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям огня\",\n";
-                ss << u8"    \"zhCN\": \"%+d 火焰技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3534,\n";
-                ss << u8"    \"Key\": \"ModStr3j\",\n";
-                ss << u8"    \"enUS\": \"Attacker Takes Lightning Damage of %d\",\n";
-                ss << u8"    \"zhTW\": \"攻擊者受到 %d 點電擊傷害\",\n";
-                ss << u8"    \"deDE\": \"Angreifer erleidet Blitzschaden von %d\",\n";
-                ss << u8"    \"esES\": \"Los atacantes reciben %d p. de daño de rayos\",\n";
-                ss << u8"    \"frFR\": \"L’adversaire subit des dégâts de Foudre de %d\",\n";
-                ss << u8"    \"itIT\": \"Gli attaccanti subiscono danni da fulmine pari a %d\",\n";
-                ss << u8"    \"koKR\": \"공격자가 번개 피해를 %d 받음\",\n";
-                ss << u8"    \"plPL\": \"Atakujący otrzymują %d pkt. obrażeń od błyskawic\",\n";
-                ss << u8"    \"esMX\": \"El atacante recibe %d de daño de rayo\",\n";
-                ss << u8"    \"jaJP\": \"攻撃を受けると電撃ダメージ（%d）を反射\",\n";
-                ss << u8"    \"ptBR\": \"Agressor recebe %d de dano elétrico\",\n";
-                ss << u8"    \"ruRU\": \"Атакующий получает %d урона от молнии\",\n";
-                ss << u8"    \"zhCN\": \"攻击者受到 %d 点闪电伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3535,\n";
-                ss << u8"    \"Key\": \"ModStr3k\",\n";
-                ss << u8"    \"enUS\": \"%+d to All Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 所有技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu allen Fertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a todas las habilidades\",\n";
-                ss << u8"    \"frFR\": \"%+d à toutes les compétences\",\n";
-                ss << u8"    \"itIT\": \"%+d a tutte le abilità\",\n";
-                ss << u8"    \"koKR\": \"모든 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do wszystkich umiejętności\",\n";
-                ss << u8"    \"esMX\": \"%+d a todas las habilidades\",\n";
-                ss << u8"    \"jaJP\": \"全スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para todas as habilidades\",\n";
-                ss << u8"    \"ruRU\": \"%+d ко всем умениям\",\n";
-                ss << u8"    \"zhCN\": \"%+d 所有技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3536,\n";
-                ss << u8"    \"Key\": \"ModStr3l\",\n";
-                ss << u8"    \"enUS\": \"Freezes target\",\n";
-                ss << u8"    \"zhTW\": \"凍結目標\",\n";
-                ss << u8"    \"deDE\": \"Friert das Ziel ein\",\n";
-                ss << u8"    \"esES\": \"Congela al objetivo\",\n";
-                ss << u8"    \"frFR\": \"Immobilise l’adversaire\",\n";
-                ss << u8"    \"itIT\": \"Congela il bersaglio\",\n";
-                ss << u8"    \"koKR\": \"대상 빙결\",\n";
-                ss << u8"    \"plPL\": \"Zamraża cel\",\n";
-                ss << u8"    \"esMX\": \"Congela al objetivo\",\n";
-                ss << u8"    \"jaJP\": \"ターゲットを凍結させる\",\n";
-                ss << u8"    \"ptBR\": \"Congela o alvo\",\n";
-                ss << u8"    \"ruRU\": \"Замораживает цель\",\n";
-                ss << u8"    \"zhCN\": \"冻结目标\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3537,\n";
-                ss << u8"    \"Key\": \"ModStr3m\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Chance of Open Wounds\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 機率造成開放傷口\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Chance auf offene Wunden\",\n";
-                ss << u8"    \"esES\": \"%+d%% de probabilidad de sangrado\",\n";
-                ss << u8"    \"frFR\": \"%+d%% de chances de blessures ouvertes\",\n";
-                ss << u8"    \"itIT\": \"Probabilità di aprire una ferita %+d%%\",\n";
-                ss << u8"    \"koKR\": \"상처 악화 확률 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szansy na otwarcie rany\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de probabilidad de abrir heridas\",\n";
-                ss << u8"    \"jaJP\": \"出血状態を付与（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de chance de Feridas Abertas\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к вероятности нанести открытую рану\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 几率造成开创性伤口\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3538,\n";
-                ss << u8"    \"Key\": \"ModStr3n\",\n";
-                ss << u8"    \"enUS\": \"Invisibility\",\n";
-                ss << u8"    \"zhTW\": \"隱形\",\n";
-                ss << u8"    \"deDE\": \"Unsichtbarkeit\",\n";
-                ss << u8"    \"esES\": \"Invisibilidad\",\n";
-                ss << u8"    \"frFR\": \"Invisibilité\",\n";
-                ss << u8"    \"itIT\": \"Invisibilità\",\n";
-                ss << u8"    \"koKR\": \"투명\",\n";
-                ss << u8"    \"plPL\": \"Niewidzialność\",\n";
-                ss << u8"    \"esMX\": \"Invisibilidad\",\n";
-                ss << u8"    \"jaJP\": \"インビジビリティ（透明化）\",\n";
-                ss << u8"    \"ptBR\": \"Invisibilidade\",\n";
-                ss << u8"    \"ruRU\": \"Невидимость\",\n";
-                ss << u8"    \"zhCN\": \"隐形\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3539,\n";
-                ss << u8"    \"Key\": \"ModStr3o\",\n";
-                ss << u8"    \"enUS\": \"Neutral Invisibility\",\n";
-                ss << u8"    \"zhTW\": \"天生隱形\",\n";
-                ss << u8"    \"deDE\": \"Neutrale Unsichtbarkeit\",\n";
-                ss << u8"    \"esES\": \"Invisibilidad neutra\",\n";
-                ss << u8"    \"frFR\": \"Invisibilité neutre\",\n";
-                ss << u8"    \"itIT\": \"Invisibilità neutrale\",\n";
-                ss << u8"    \"koKR\": \"반투명\",\n";
-                ss << u8"    \"plPL\": \"Neutralna niewidzialność\",\n";
-                ss << u8"    \"esMX\": \"Invisibilidad neutral\",\n";
-                ss << u8"    \"jaJP\": \"ニュートラル・インビジビリティ（透明化）\",\n";
-                ss << u8"    \"ptBR\": \"Invisibilidade neutra\",\n";
-                ss << u8"    \"ruRU\": \"Нейтральная невидимость\",\n";
-                ss << u8"    \"zhCN\": \"中立隐形\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3540,\n";
-                ss << u8"    \"Key\": \"ModStr3p\",\n";
-                ss << u8"    \"enUS\": \"No Mana Healing\",\n";
-                ss << u8"    \"zhTW\": \"無法力治療\",\n";
-                ss << u8"    \"deDE\": \"Keine Manaheilung\",\n";
-                ss << u8"    \"esES\": \"Sin regeneración de maná\",\n";
-                ss << u8"    \"frFR\": \"Pas de Potion de mana\",\n";
-                ss << u8"    \"itIT\": \"Non rigenera mana\",\n";
-                ss << u8"    \"koKR\": \"마나 회복 불가\",\n";
-                ss << u8"    \"plPL\": \"Brak przywracania many\",\n";
-                ss << u8"    \"esMX\": \"Sin regeneración de maná\",\n";
-                ss << u8"    \"jaJP\": \"マナが回復しなくなる\",\n";
-                ss << u8"    \"ptBR\": \"Sem cura de mana\",\n";
-                ss << u8"    \"ruRU\": \"Не позволяет восполнять ману\",\n";
-                ss << u8"    \"zhCN\": \"无魔法治愈\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3541,\n";
-                ss << u8"    \"Key\": \"ModStr3q\",\n";
-                ss << u8"    \"enUS\": \"No Life Healing\",\n";
-                ss << u8"    \"zhTW\": \"無生命治療\",\n";
-                ss << u8"    \"deDE\": \"Keine Lebensheilung\",\n";
-                ss << u8"    \"esES\": \"Sin regeneración de vida\",\n";
-                ss << u8"    \"frFR\": \"Pas de Potion de vie\",\n";
-                ss << u8"    \"itIT\": \"Non rigenera vita\",\n";
-                ss << u8"    \"koKR\": \"생명력 회복 불가\",\n";
-                ss << u8"    \"plPL\": \"Brak przywracania zdrowia\",\n";
-                ss << u8"    \"esMX\": \"Sin sanación de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフが回復しなくなる\",\n";
-                ss << u8"    \"ptBR\": \"Sem cura de vida\",\n";
-                ss << u8"    \"ruRU\": \"Не позволяет лечиться\",\n";
-                ss << u8"    \"zhCN\": \"无生命治愈\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3542,\n";
-                ss << u8"    \"Key\": \"ModStr3r\",\n";
-                ss << u8"    \"enUS\": \"Poison Length Reduced by %d%%\",\n";
-                ss << u8"    \"zhTW\": \"中毒的時效縮短 %d%%\",\n";
-                ss << u8"    \"deDE\": \"Giftdauer reduziert um %d%%\",\n";
-                ss << u8"    \"esES\": \"Duración del veneno reducida un %d%%\",\n";
-                ss << u8"    \"frFR\": \"Effet du poison réduit de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Durata veleno ridotta del %d%%\",\n";
-                ss << u8"    \"koKR\": \"독 지속시간 %d%% 감소\",\n";
-                ss << u8"    \"plPL\": \"Skraca czas działania trucizny o %d%%\",\n";
-                ss << u8"    \"esMX\": \"Reduce un %d%% la duración del veneno\",\n";
-                ss << u8"    \"jaJP\": \"毒の効果時間短縮（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Duração de veneno reduzida em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"Сокращает время действия яда на %d%%\",\n";
-                ss << u8"    \"zhCN\": \"中毒时间缩短 %d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3544,\n";
-                ss << u8"    \"Key\": \"ModStr3v\",\n";
-                ss << u8"    \"enUS\": \"Heal Stamina Plus %d%%\",\n";
-                ss << u8"    \"zhTW\": \"精力恢復 +%d%%\",\n";
-                ss << u8"    \"deDE\": \"Ausdauerheilung plus %d%%\",\n";
-                ss << u8"    \"esES\": \"%d%% de regeneración de aguante\",\n";
-                ss << u8"    \"frFR\": \"Regain d’endurance augmenté de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Rigenerazione del vigore aumentata del %d%%\",\n";
-                ss << u8"    \"koKR\": \"지구력 회복 속도 %d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"+%d%% do przywracania wytrzymałości\",\n";
-                ss << u8"    \"esMX\": \"%d%% más de regeneración de vigor\",\n";
-                ss << u8"    \"jaJP\": \"スタミナ回復速度上昇（+%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Recupera vigor em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"Ускоряет восполнение выносливости на %d%%\",\n";
-                ss << u8"    \"zhCN\": \"治愈耐力外加 %d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3545,\n";
-                ss << u8"    \"Key\": \"ModStr3w\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Damage Taken Goes To Mana\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 受到的傷害轉為法力\",\n";
-                ss << u8"    \"deDE\": \"%+d%% erlittenen Schadens geht auf Mana\",\n";
-                ss << u8"    \"esES\": \"Un %+d%% del daño sufrido se recupera como maná\",\n";
-                ss << u8"    \"frFR\": \"%+d%% des dégâts subis sont soustraits au mana\",\n";
-                ss << u8"    \"itIT\": \"Il %+d%% dei danni subiti è sul mana\",\n";
-                ss << u8"    \"koKR\": \"받는 피해의 %+d%%만큼 마나 회복\",\n";
-                ss << u8"    \"plPL\": \"%+d%% otrzymanych obrażeń przechodzi na manę\",\n";
-                ss << u8"    \"esMX\": \"%+d%% del daño recibido se transforma en maná\",\n";
-                ss << u8"    \"jaJP\": \"受けたダメージの%+d%%をマナに変換\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% do dano recebido transforma-se em mana\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к урону, приходящемуся на ману\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 受到的伤害转换为法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3546,\n";
-                ss << u8"    \"Key\": \"ModStr3x\",\n";
-                ss << u8"    \"enUS\": \"Heal Life Plus\",\n";
-                ss << u8"    \"zhTW\": \"回復生命加\",\n";
-                ss << u8"    \"deDE\": \"Lebensheilung plus\",\n";
-                ss << u8"    \"esES\": \"Curación adicional\",\n";
-                ss << u8"    \"frFR\": \"Regain de vie suppl.\",\n";
-                ss << u8"    \"itIT\": \"Rigenera più vita\",\n";
-                ss << u8"    \"koKR\": \"생명력 회복 속도 증가\",\n";
-                ss << u8"    \"plPL\": \"Przywraca punkty zdrowia plus\",\n";
-                ss << u8"    \"esMX\": \"Más sanación de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフ回復速度上昇\",\n";
-                ss << u8"    \"ptBR\": \"Cura de vida adicional\",\n";
-                ss << u8"    \"ruRU\": \"Усиливает исцеление\",\n";
-                ss << u8"    \"zhCN\": \"治愈生命外加\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3547,\n";
-                ss << u8"    \"Key\": \"ModStr3y\",\n";
-                ss << u8"    \"enUS\": \"Ignore Target's Defense\",\n";
-                ss << u8"    \"zhTW\": \"無視目標防禦\",\n";
-                ss << u8"    \"deDE\": \"Ignoriert Zielverteidigung\",\n";
-                ss << u8"    \"esES\": \"Ignora la defensa del objetivo\",\n";
-                ss << u8"    \"frFR\": \"Ignore les défenses de l’adversaire\",\n";
-                ss << u8"    \"itIT\": \"Ignora la difesa del bersaglio\",\n";
-                ss << u8"    \"koKR\": \"대상의 방어력 무시\",\n";
-                ss << u8"    \"plPL\": \"Ignoruje obronę celu\",\n";
-                ss << u8"    \"esMX\": \"Ignora la defensa del objetivo\",\n";
-                ss << u8"    \"jaJP\": \"ターゲットの防御力を無視\",\n";
-                ss << u8"    \"ptBR\": \"Ignora defesa do alvo\",\n";
-                ss << u8"    \"ruRU\": \"Игнорирует защиту цели\",\n";
-                ss << u8"    \"zhCN\": \"忽略目标的防御\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3548,\n";
-                ss << u8"    \"Key\": \"ModStr3z\",\n";
-                ss << u8"    \"enUS\": \"Half Poison Duration\",\n";
-                ss << u8"    \"zhTW\": \"中毒的時效減半\",\n";
-                ss << u8"    \"deDE\": \"Halbierte Giftdauer\",\n";
-                ss << u8"    \"esES\": \"Mitad de duración del veneno\",\n";
-                ss << u8"    \"frFR\": \"Réduit de moitié la durée du Poison\",\n";
-                ss << u8"    \"itIT\": \"Durata veleno dimezzata\",\n";
-                ss << u8"    \"koKR\": \"독 지속시간 절반으로 감소\",\n";
-                ss << u8"    \"plPL\": \"Skraca czas działania trucizny o połowę\",\n";
-                ss << u8"    \"esMX\": \"Reduce a la mitad la duración del veneno\",\n";
-                ss << u8"    \"jaJP\": \"毒の効果時間短縮（50%%）\",\n";
-                ss << u8"    \"ptBR\": \"Metade da duração de veneno\",\n";
-                ss << u8"    \"ruRU\": \"Вдвое уменьшает время действия яда\",\n";
-                ss << u8"    \"zhCN\": \"中毒时间减半\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3549,\n";
-                ss << u8"    \"Key\": \"ModStr4a\",\n";
-                ss << u8"    \"enUS\": \"Prevent Monster Heal\",\n";
-                ss << u8"    \"zhTW\": \"防止怪物自療\",\n";
-                ss << u8"    \"deDE\": \"Verhindert Monsterheilung\",\n";
-                ss << u8"    \"esES\": \"Impide que los monstruos se curen\",\n";
-                ss << u8"    \"frFR\": \"Empêche les monstres de guérir\",\n";
-                ss << u8"    \"itIT\": \"Evita la cura del bersaglio\",\n";
-                ss << u8"    \"koKR\": \"괴물 회복 저지\",\n";
-                ss << u8"    \"plPL\": \"Uniemożliwia leczenie się potworów\",\n";
-                ss << u8"    \"esMX\": \"Previene la regeneración de monstruos\",\n";
-                ss << u8"    \"jaJP\": \"モンスターの回復を阻止\",\n";
-                ss << u8"    \"ptBR\": \"Impede cura de monstros\",\n";
-                ss << u8"    \"ruRU\": \"Запрещает монстрам лечиться\",\n";
-                ss << u8"    \"zhCN\": \"防止怪物治愈\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3550,\n";
-                ss << u8"    \"Key\": \"ModStr4b\",\n";
-                ss << u8"    \"enUS\": \"Half Freeze Duration\",\n";
-                ss << u8"    \"zhTW\": \"被凍結的時效減半\",\n";
-                ss << u8"    \"deDE\": \"Halbierte Einfrierungsdauer\",\n";
-                ss << u8"    \"esES\": \"La congelación dura la mitad\",\n";
-                ss << u8"    \"frFR\": \"Diminue de moitié la durée d’Immobilisation\",\n";
-                ss << u8"    \"itIT\": \"Durata congelamento dimezzata\",\n";
-                ss << u8"    \"koKR\": \"빙결 지속시간 절반으로 감소\",\n";
-                ss << u8"    \"plPL\": \"Skraca czas działania zamrożenia o połowę\",\n";
-                ss << u8"    \"esMX\": \"Reduce a la mitad la duración del congelamiento\",\n";
-                ss << u8"    \"jaJP\": \"凍結の効果時間短縮（50%%）\",\n";
-                ss << u8"    \"ptBR\": \"Metade da duração de congelamento\",\n";
-                ss << u8"    \"ruRU\": \"Вдвое уменьшает время заморозки\",\n";
-                ss << u8"    \"zhCN\": \"冻结时间减半\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3552,\n";
-                ss << u8"    \"Key\": \"ModStr4d\",\n";
-                ss << u8"    \"enUS\": \"%d to Monster Defense Per Hit\",\n";
-                ss << u8"    \"zhTW\": \"擊中使怪物防禦 %d\",\n";
-                ss << u8"    \"deDE\": \"%d zu Monsterverteidigung pro Treffer\",\n";
-                ss << u8"    \"esES\": \"%d a la defensa del monstruo por golpe\",\n";
-                ss << u8"    \"frFR\": \"%d à la défense contre les monstres par coup\",\n";
-                ss << u8"    \"itIT\": \"%d difesa del bersaglio per colpo\",\n";
-                ss << u8"    \"koKR\": \"적중당 괴물 방어력 %d 감소\",\n";
-                ss << u8"    \"plPL\": \"%d do obrony potworów na trafienie\",\n";
-                ss << u8"    \"esMX\": \"%d a la defensa de monstruo por golpe\",\n";
-                ss << u8"    \"jaJP\": \"攻撃命中でモンスターの防御力低下（%d）\",\n";
-                ss << u8"    \"ptBR\": \"%d de defesa de monstro por acerto\",\n";
-                ss << u8"    \"ruRU\": \"%d к защите от монстров за удар\",\n";
-                ss << u8"    \"zhCN\": \"%d 每一击降低的怪物防御\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3553,\n";
-                ss << u8"    \"Key\": \"ModStr4e\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Damage to Demons\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 對惡魔的傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Schaden gegen Dämonen\",\n";
-                ss << u8"    \"esES\": \"%+d%% de daño contra demonios\",\n";
-                ss << u8"    \"frFR\": \"Dégâts contre les démons : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% danni ai demoni\",\n";
-                ss << u8"    \"koKR\": \"악마에게 주는 피해 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do obrażeń zadanych demonom\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de daño a demonios\",\n";
-                ss << u8"    \"jaJP\": \"デーモンへのダメージ（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de dano contra demônios\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к урону по демонам\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 对恶魔的伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3554,\n";
-                ss << u8"    \"Key\": \"ModStr4f\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Damage to Undead\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 對不死怪物的傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Schaden gegen Untote\",\n";
-                ss << u8"    \"esES\": \"%+d%% de daño contra muertos vivientes\",\n";
-                ss << u8"    \"frFR\": \"Dégâts contre les Morts-vivants : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% danni ai non morti\",\n";
-                ss << u8"    \"koKR\": \"언데드에게 주는 피해 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do obrażeń zadanych nieumarłym\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de daño a no muertos\",\n";
-                ss << u8"    \"jaJP\": \"アンデッドへのダメージ（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de dano contra mortos-vivos\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% урона по нежити\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 对亡灵的伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3555,\n";
-                ss << u8"    \"Key\": \"ModStr4g\",\n";
-                ss << u8"    \"enUS\": \"Regenerate Mana %d%%\",\n";
-                ss << u8"    \"zhTW\": \"法力恢復 %d%%\",\n";
-                ss << u8"    \"deDE\": \"Mana regenerieren %d%%\",\n";
-                ss << u8"    \"esES\": \"%d%% de regeneración de maná\",\n";
-                ss << u8"    \"frFR\": \"Rend %d%% de mana\",\n";
-                ss << u8"    \"itIT\": \"Rigenerazione del mana aumentata del %d%%\",\n";
-                ss << u8"    \"koKR\": \"마나 재생 %d%%\",\n";
-                ss << u8"    \"plPL\": \"+%d%% do regeneracji many\",\n";
-                ss << u8"    \"esMX\": \"%d%% de regeneración de maná\",\n";
-                ss << u8"    \"jaJP\": \"マナ回復速度上昇（+%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Regenera mana em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет %d%% маны\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 法力回复\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3556,\n";
-                ss << u8"    \"Key\": \"ModStr4h\",\n";
-                ss << u8"    \"enUS\": \"%+d to Maximum Poison Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 毒素傷害最大值\",\n";
-                ss << u8"    \"deDE\": \"%+d zu max. Giftschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño máximo de veneno\",\n";
-                ss << u8"    \"frFR\": \"%+d au max. de dégâts de Poison\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni massimi da veleno\",\n";
-                ss << u8"    \"koKR\": \"최대 독 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do maksymalnych obrażeń od trucizny\",\n";
-                ss << u8"    \"esMX\": \"%+d a daño de veneno máximo\",\n";
-                ss << u8"    \"jaJP\": \"最大毒ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano venenoso máximo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к максимальному урону от яда\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最大毒素伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3557,\n";
-                ss << u8"    \"Key\": \"ModStr4i\",\n";
-                ss << u8"    \"enUS\": \"%+d to Minimum Poison Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 毒素傷害最小值\",\n";
-                ss << u8"    \"deDE\": \"%+d zu min. Giftschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño mínimo de veneno\",\n";
-                ss << u8"    \"frFR\": \"%+d au min. de dégâts de Poison\",\n";
-                ss << u8"    \"itIT\": \"%+d ai danni minimi da veleno\",\n";
-                ss << u8"    \"koKR\": \"최소 독 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do minimalnych obrażeń od trucizny\",\n";
-                ss << u8"    \"esMX\": \"%+d a daño de veneno mínimo\",\n";
-                ss << u8"    \"jaJP\": \"最小毒ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano venenoso mínimo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к минимальному урону от яда\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最小毒素伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3558,\n";
-                ss << u8"    \"Key\": \"ModStr4j\",\n";
-                ss << u8"    \"enUS\": \"%+d to Attack Rating against Demons\",\n";
-                ss << u8"    \"zhTW\": \"%+d 對惡魔的準確率\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Angriffswert gegen Dämonen\",\n";
-                ss << u8"    \"esES\": \"%+d de índice de ataque contra demonios\",\n";
-                ss << u8"    \"frFR\": \"%+d au score d’attaque contre les démons\",\n";
-                ss << u8"    \"itIT\": \"%+d indice d'attacco contro i demoni\",\n";
-                ss << u8"    \"koKR\": \"악마에 대한 명중률 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do skuteczności ataku względem demonów\",\n";
-                ss << u8"    \"esMX\": \"%+d a índice de ataque contra demonios\",\n";
-                ss << u8"    \"jaJP\": \"デーモンへの命中率（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de taxa de ataque contra demônios\",\n";
-                ss << u8"    \"ruRU\": \"%+d к рейтингу атаки против демонов\",\n";
-                ss << u8"    \"zhCN\": \"%+d 对恶魔的命中值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3559,\n";
-                ss << u8"    \"Key\": \"ModStr4k\",\n";
-                ss << u8"    \"enUS\": \"%+d to Attack Rating against Undead\",\n";
-                ss << u8"    \"zhTW\": \"%+d 對不死怪物的準確率\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Angriffswert gegen Untote\",\n";
-                ss << u8"    \"esES\": \"%+d de índice de ataque contra muertos vivientes\",\n";
-                ss << u8"    \"frFR\": \"%+d au score d’attaque contre les Morts-vivants\",\n";
-                ss << u8"    \"itIT\": \"%+d indice d'attacco contro i non morti\",\n";
-                ss << u8"    \"koKR\": \"언데드에 대한 명중률 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do skuteczności ataku względem nieumarłych\",\n";
-                ss << u8"    \"esMX\": \"%+d a índice de ataque contra no muertos\",\n";
-                ss << u8"    \"jaJP\": \"アンデッドへの命中率（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de taxa de ataque contra mortos-vivos\",\n";
-                ss << u8"    \"ruRU\": \"%+d к рейтингу атаки против нежити\",\n";
-                ss << u8"    \"zhCN\": \"%+d 对亡灵的命中值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3560,\n";
-                ss << u8"    \"Key\": \"ModStr4l\",\n";
-                ss << u8"    \"enUS\": \"Slightly Increased Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"小幅攻擊速度提高\",\n";
-                ss << u8"    \"deDE\": \"Leicht erhöhte Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Ligero aumento de velocidad de ataque\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque légèrement augmentée\",\n";
-                ss << u8"    \"itIT\": \"Velocità d'attacco leggermente aumentata\",\n";
-                ss << u8"    \"koKR\": \"공격 속도 약간 증가\",\n";
-                ss << u8"    \"plPL\": \"Lekko zwiększona szybkość ataku\",\n";
-                ss << u8"    \"esMX\": \"Aumenta levemente la velocidad de ataque\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度上昇（小）\",\n";
-                ss << u8"    \"ptBR\": \"Velocidade de ataque ligeiramente aumentada\",\n";
-                ss << u8"    \"ruRU\": \"Скорость атаки слегка повышена\",\n";
-                ss << u8"    \"zhCN\": \"轻微提升攻击速度\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3561,\n";
-                ss << u8"    \"Key\": \"ModStr4m\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Increased Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"攻擊速度 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"%+d%% erhöhte Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"%+d%% de velocidad de ataque\",\n";
-                ss << u8"    \"frFR\": \"%+d%% à la vitesse d’attaque\",\n";
-                ss << u8"    \"itIT\": \"%+d%% velocità d'attacco\",\n";
-                ss << u8"    \"koKR\": \"공격 속도 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szybkości ataku\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de velocidad de ataque\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de velocidade de ataque adicional\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к скорости атаки\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 提高攻击速度\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3562,\n";
-                ss << u8"    \"Key\": \"ModStr4n\",\n";
-                ss << u8"    \"enUS\": \"Greatly Increased Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"大幅攻擊速度提高\",\n";
-                ss << u8"    \"deDE\": \"Stark erhöhte Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Gran aumento de velocidad de ataque\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque fortement augmentée\",\n";
-                ss << u8"    \"itIT\": \"Velocità d'attacco enormemente aumentata\",\n";
-                ss << u8"    \"koKR\": \"공격 속도 대폭 증가\",\n";
-                ss << u8"    \"plPL\": \"Znacznie zwiększona szybkość ataku\",\n";
-                ss << u8"    \"esMX\": \"Aumenta en gran medida la velocidad de ataque\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度上昇（大）\",\n";
-                ss << u8"    \"ptBR\": \"Velocidade de ataque consideravelmente aumentada\",\n";
-                ss << u8"    \"ruRU\": \"Скорость атаки значительно повышена\",\n";
-                ss << u8"    \"zhCN\": \"大幅提高攻击速度\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3563,\n";
-                ss << u8"    \"Key\": \"ModStr4o\",\n";
-                ss << u8"    \"enUS\": \"Fast Hit Recovery\",\n";
-                ss << u8"    \"zhTW\": \"快速的打擊恢復\",\n";
-                ss << u8"    \"deDE\": \"Schnelle Erholung nach Treffer\",\n";
-                ss << u8"    \"esES\": \"Recuperación de golpe rápida\",\n";
-                ss << u8"    \"frFR\": \"Récupération rapide après un coup\",\n";
-                ss << u8"    \"itIT\": \"Recupero dai colpi veloce\",\n";
-                ss << u8"    \"koKR\": \"빠른 타격 회복 속도\",\n";
-                ss << u8"    \"plPL\": \"Szybkie odzyskanie równowagi\",\n";
-                ss << u8"    \"esMX\": \"Rápida recuperación por golpe\",\n";
-                ss << u8"    \"jaJP\": \"ヒットリカバリー速度上昇\",\n";
-                ss << u8"    \"ptBR\": \"Recuperação de golpe rápida\",\n";
-                ss << u8"    \"ruRU\": \"Быстрое восстановление от ударов\",\n";
-                ss << u8"    \"zhCN\": \"快速打击回复\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3564,\n";
-                ss << u8"    \"Key\": \"ModStr4p\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Faster Hit Recovery\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 打擊恢復\",\n";
-                ss << u8"    \"deDE\": \"%+d%% schnellere Erholung nach Treffer\",\n";
-                ss << u8"    \"esES\": \"Recuperación de golpe un %+d%% más rápida\",\n";
-                ss << u8"    \"frFR\": \"Récupération très rapide après un coup : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% velocità di recupero dai colpi\",\n";
-                ss << u8"    \"koKR\": \"타격 회복 속도 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szybkości odzyskiwania równowagi\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de velocidad a recuperación por golpe\",\n";
-                ss << u8"    \"jaJP\": \"ヒットリカバリー速度（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Recuperação de golpe %+d%% mais rápida\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к ускоренному восстановлению от удара\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 更快速打击回复\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3565,\n";
-                ss << u8"    \"Key\": \"ModStr4q\",\n";
-                ss << u8"    \"enUS\": \"Fastest Hit Recovery\",\n";
-                ss << u8"    \"zhTW\": \"最快的打擊恢復\",\n";
-                ss << u8"    \"deDE\": \"Schnellste Erholung nach Treffer\",\n";
-                ss << u8"    \"esES\": \"Recuperación de golpe máxima\",\n";
-                ss << u8"    \"frFR\": \"Récupération max. après un coup\",\n";
-                ss << u8"    \"itIT\": \"Recupero dai colpi più veloce\",\n";
-                ss << u8"    \"koKR\": \"가장 빠른 타격 회복 속도\",\n";
-                ss << u8"    \"plPL\": \"Najszybsze odzyskanie równowagi\",\n";
-                ss << u8"    \"esMX\": \"Recuperación por golpe más rápida\",\n";
-                ss << u8"    \"jaJP\": \"ヒットリカバリー速度上昇（大）\",\n";
-                ss << u8"    \"ptBR\": \"Recuperação de golpe mais rápida\",\n";
-                ss << u8"    \"ruRU\": \"Очень быстрое восстановление от ударов\",\n";
-                ss << u8"    \"zhCN\": \"最快速打击回复\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3566,\n";
-                ss << u8"    \"Key\": \"ModStr4r\",\n";
-                ss << u8"    \"enUS\": \"Fast Run/Walk\",\n";
-                ss << u8"    \"zhTW\": \"快速的跑步 / 行走速度\",\n";
-                ss << u8"    \"deDE\": \"Schnelle Bewegungsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Velocidad de correr/andar rápida\",\n";
-                ss << u8"    \"frFR\": \"Marche/Course rapide\",\n";
-                ss << u8"    \"itIT\": \"Corsa/camminata veloce\",\n";
-                ss << u8"    \"koKR\": \"빠른 달리기/걷기 속도\",\n";
-                ss << u8"    \"plPL\": \"Szybki bieg/chodzenie\",\n";
-                ss << u8"    \"esMX\": \"Rápida velocidad al correr/caminar\",\n";
-                ss << u8"    \"jaJP\": \"歩き/走り速度上昇\",\n";
-                ss << u8"    \"ptBR\": \"Correr/andar rápidas\",\n";
-                ss << u8"    \"ruRU\": \"Скорость ходьбы и бега повышена\",\n";
-                ss << u8"    \"zhCN\": \"跑步/步行\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3567,\n";
-                ss << u8"    \"Key\": \"ModStr4s\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Faster Run/Walk\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 跑步 / 行走速度\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Bewegungsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Correr/andar un %+d%% más rápido\",\n";
-                ss << u8"    \"frFR\": \"%+d%% à la Marche/Course\",\n";
-                ss << u8"    \"itIT\": \"%+d%% velocità di corsa/camminata\",\n";
-                ss << u8"    \"koKR\": \"달리기/걷기 속도 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szybkości poruszania się\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de velocidad a correr/caminar\",\n";
-                ss << u8"    \"jaJP\": \"歩き/走り速度（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Correr/andar %+d%% mais rápidas\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к скорости ходьбы и бега\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 更快速跑步/步行\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3568,\n";
-                ss << u8"    \"Key\": \"ModStr4t\",\n";
-                ss << u8"    \"enUS\": \"Fastest Run/Walk\",\n";
-                ss << u8"    \"zhTW\": \"最快的跑步 / 行走速度\",\n";
-                ss << u8"    \"deDE\": \"Schnellste Bewegungsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Velocidad de correr/andar máxima\",\n";
-                ss << u8"    \"frFR\": \"Marche/Course max.\",\n";
-                ss << u8"    \"itIT\": \"Corsa/camminata più veloce\",\n";
-                ss << u8"    \"koKR\": \"가장 빠른 달리기/걷기 속도\",\n";
-                ss << u8"    \"plPL\": \"Najszybszy bieg/chodzenie\",\n";
-                ss << u8"    \"esMX\": \"Velocidad al correr/caminar más rápida\",\n";
-                ss << u8"    \"jaJP\": \"歩き/走り速度上昇（大）\",\n";
-                ss << u8"    \"ptBR\": \"Correr/andar mais rápidas\",\n";
-                ss << u8"    \"ruRU\": \"Скорость ходьбы и бега значительно повышена\",\n";
-                ss << u8"    \"zhCN\": \"最快速跑步/步行\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3569,\n";
-                ss << u8"    \"Key\": \"ModStr4u\",\n";
-                ss << u8"    \"enUS\": \"Fast Cast Rate\",\n";
-                ss << u8"    \"zhTW\": \"快速的施法速度\",\n";
-                ss << u8"    \"deDE\": \"Schnelle Zauberrate\",\n";
-                ss << u8"    \"esES\": \"Velocidad de lanzamiento rápida\",\n";
-                ss << u8"    \"frFR\": \"Vitesse de sort rapide\",\n";
-                ss << u8"    \"itIT\": \"Lancio incantesimi veloce\",\n";
-                ss << u8"    \"koKR\": \"빠른 시전 속도\",\n";
-                ss << u8"    \"plPL\": \"Szybkie rzucanie czarów\",\n";
-                ss << u8"    \"esMX\": \"Rápida velocidad de lanzamiento\",\n";
-                ss << u8"    \"jaJP\": \"スキル発動速度上昇\",\n";
-                ss << u8"    \"ptBR\": \"Taxa de lançamento rápida\",\n";
-                ss << u8"    \"ruRU\": \"Скорость применения умений повышена\",\n";
-                ss << u8"    \"zhCN\": \"快速施法\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3570,\n";
-                ss << u8"    \"Key\": \"ModStr4v\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Faster Cast Rate\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 施法速度\",\n";
-                ss << u8"    \"deDE\": \"%+d%% schnellere Zauberrate\",\n";
-                ss << u8"    \"esES\": \"Velocidad de lanzamiento un %+d%% más rápida\",\n";
-                ss << u8"    \"frFR\": \"Vitesse de sort très rapide : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% velocità di lancio incantesimi\",\n";
-                ss << u8"    \"koKR\": \"시전 속도 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szybkości rzucania czarów\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de velocidad de lanzamiento\",\n";
-                ss << u8"    \"jaJP\": \"スキル発動速度（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Taxa de lançamento %+d%% mais rápida\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к скорости применения умений\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 更快速施法\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3571,\n";
-                ss << u8"    \"Key\": \"ModStr4w\",\n";
-                ss << u8"    \"enUS\": \"Fastest Cast Rate\",\n";
-                ss << u8"    \"zhTW\": \"最快的施法速度\",\n";
-                ss << u8"    \"deDE\": \"Schnellste Zauberrate\",\n";
-                ss << u8"    \"esES\": \"Velocidad de lanzamiento máxima\",\n";
-                ss << u8"    \"frFR\": \"Vitesse de sort max.\",\n";
-                ss << u8"    \"itIT\": \"Lancio incantesimi più veloce\",\n";
-                ss << u8"    \"koKR\": \"가장 빠른 시전 속도\",\n";
-                ss << u8"    \"plPL\": \"Najszybsze rzucanie czarów\",\n";
-                ss << u8"    \"esMX\": \"Velocidad de lanzamiento más rápida\",\n";
-                ss << u8"    \"jaJP\": \"スキル発動速度上昇（大）\",\n";
-                ss << u8"    \"ptBR\": \"Taxa de lançamento mais rápida\",\n";
-                ss << u8"    \"ruRU\": \"Скорость применения умений значительно повышена\",\n";
-                ss << u8"    \"zhCN\": \"最快速施法\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3572,\n";
-                ss << u8"    \"Key\": \"ModStr4x\",\n";
-                ss << u8"    \"enUS\": \"Fast Block Rate\",\n";
-                ss << u8"    \"zhTW\": \"快速的格擋速度\",\n";
-                ss << u8"    \"deDE\": \"Schnelle Blockrate\",\n";
-                ss << u8"    \"esES\": \"Velocidad de bloqueo rápida\",\n";
-                ss << u8"    \"frFR\": \"Vitesse de blocage rapide\",\n";
-                ss << u8"    \"itIT\": \"Parata veloce\",\n";
-                ss << u8"    \"koKR\": \"빠른 막기 속도\",\n";
-                ss << u8"    \"plPL\": \"Szybkie blokowanie\",\n";
-                ss << u8"    \"esMX\": \"Rápida velocidad de bloqueo\",\n";
-                ss << u8"    \"jaJP\": \"ブロック速度上昇\",\n";
-                ss << u8"    \"ptBR\": \"Taxa de bloqueio rápida\",\n";
-                ss << u8"    \"ruRU\": \"Скорость блока повышена\",\n";
-                ss << u8"    \"zhCN\": \"快速格挡\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3573,\n";
-                ss << u8"    \"Key\": \"ModStr4y\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Faster Block Rate\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 格擋速度\",\n";
-                ss << u8"    \"deDE\": \"%+d%% schnellere Blockrate\",\n";
-                ss << u8"    \"esES\": \"Velocidad de bloqueo un %+d%% más rápida\",\n";
-                ss << u8"    \"frFR\": \"Vitesse de blocage très rapide : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% velocità di parata\",\n";
-                ss << u8"    \"koKR\": \"막기 속도 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szybkości blokowania\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de velocidad de bloqueo\",\n";
-                ss << u8"    \"jaJP\": \"ブロック速度（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Taxa de bloqueio %+d%% mais rápida\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к скорости блока\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 更快速格挡\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3574,\n";
-                ss << u8"    \"Key\": \"ModStr4z\",\n";
-                ss << u8"    \"enUS\": \"Fastest Block Rate\",\n";
-                ss << u8"    \"zhTW\": \"最快的格擋速度\",\n";
-                ss << u8"    \"deDE\": \"Schnellste Blockrate\",\n";
-                ss << u8"    \"esES\": \"Velocidad de bloqueo máxima\",\n";
-                ss << u8"    \"frFR\": \"Vitesse de blocage max.\",\n";
-                ss << u8"    \"itIT\": \"Parata più veloce\",\n";
-                ss << u8"    \"koKR\": \"가장 빠른 막기 속도\",\n";
-                ss << u8"    \"plPL\": \"Najszybsze blokowanie\",\n";
-                ss << u8"    \"esMX\": \"Velocidad de bloqueo más rápida\",\n";
-                ss << u8"    \"jaJP\": \"ブロック速度上昇（大）\",\n";
-                ss << u8"    \"ptBR\": \"Taxa de bloqueio mais rápida\",\n";
-                ss << u8"    \"ruRU\": \"Скорость блока значительно повышена\",\n";
-                ss << u8"    \"zhCN\": \"最快速格挡\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3575,\n";
-                ss << u8"    \"Key\": \"ModStr5a\",\n";
-                ss << u8"    \"enUS\": \"Throwable\",\n";
-                ss << u8"    \"zhTW\": \"可投擲\",\n";
-                ss << u8"    \"deDE\": \"Werfbar\",\n";
-                ss << u8"    \"esES\": \"Arrojadizo\",\n";
-                ss << u8"    \"frFR\": \"Jetable\",\n";
-                ss << u8"    \"itIT\": \"Lanciabile\",\n";
-                ss << u8"    \"koKR\": \"투척 가능\",\n";
-                ss << u8"    \"plPL\": \"Nadaje się do rzucania\",\n";
-                ss << u8"    \"esMX\": \"Arrojable\",\n";
-                ss << u8"    \"jaJP\": \"投てき可能\",\n";
-                ss << u8"    \"ptBR\": \"Arremessável\",\n";
-                ss << u8"    \"ruRU\": \"Метательное оружие\",\n";
-                ss << u8"    \"zhCN\": \"可投掷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3576,\n";
-                ss << u8"    \"Key\": \"ModStr5b\",\n";
-                ss << u8"    \"enUS\": \"Damage %+d\",\n";
-                ss << u8"    \"zhTW\": \"傷害 %+d\",\n";
-                ss << u8"    \"deDE\": \"Schaden %+d\",\n";
-                ss << u8"    \"esES\": \"Daño: %+d p.\",\n";
-                ss << u8"    \"frFR\": \"Dégâts : %+d\",\n";
-                ss << u8"    \"itIT\": \"%+d danni\",\n";
-                ss << u8"    \"koKR\": \"피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do obrażeń\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño\",\n";
-                ss << u8"    \"jaJP\": \"ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano\",\n";
-                ss << u8"    \"ruRU\": \"%+d к урону\",\n";
-                ss << u8"    \"zhCN\": \"伤害 %+d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3577,\n";
-                ss << u8"    \"Key\": \"ModStr5c\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Chance of Crushing Blow\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 機率造成粉碎打擊\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Chance auf vernichtenden Schlag\",\n";
-                ss << u8"    \"esES\": \"%+d%% de probabilidad de ataque aplastante\",\n";
-                ss << u8"    \"frFR\": \"%+d%% de chances de coup écrasant\",\n";
-                ss << u8"    \"itIT\": \"Probabilità di colpo frantumante %+d%%\",\n";
-                ss << u8"    \"koKR\": \"강타 확률 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szansy na druzgocące uderzenie\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de probabilidad de golpe aplastante\",\n";
-                ss << u8"    \"jaJP\": \"クラッシング・ブロー（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de chance de Golpe Esmagador\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к вероятности нанести сокрушительный удар\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 几率粉碎打击\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3579,\n";
-                ss << u8"    \"Key\": \"ModStr5e\",\n";
-                ss << u8"    \"enUS\": \"%+d Kick Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 踢擊傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d Trittschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño de patada\",\n";
-                ss << u8"    \"frFR\": \"Dégâts des coups de pied : %+d\",\n";
-                ss << u8"    \"itIT\": \"%+d danni da calcio\",\n";
-                ss << u8"    \"koKR\": \"발차기 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do obrażeń od kopnięcia\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño por patada\",\n";
-                ss << u8"    \"jaJP\": \"キックダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano de chute\",\n";
-                ss << u8"    \"ruRU\": \"%+d к урону от пинков\",\n";
-                ss << u8"    \"zhCN\": \"%+d 脚踢伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3580,\n";
-                ss << u8"    \"Key\": \"ModStr5f\",\n";
-                ss << u8"    \"enUS\": \"%+d to Mana after each Kill\",\n";
-                ss << u8"    \"zhTW\": \"%+d 擊殺法力恢復\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Mana nach jedem Kill\",\n";
-                ss << u8"    \"esES\": \"%+d p. de maná tras cada asesinato\",\n";
-                ss << u8"    \"frFR\": \"%+d de mana après chaque victime\",\n";
-                ss << u8"    \"itIT\": \"%+d mana dopo ogni uccisione\",\n";
-                ss << u8"    \"koKR\": \"적 처치 시 마나 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do many za każdego zabitego przeciwnika\",\n";
-                ss << u8"    \"esMX\": \"%+d de maná por cada asesinato\",\n";
-                ss << u8"    \"jaJP\": \"敵を倒すとマナが回復（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de mana após cada abate\",\n";
-                ss << u8"    \"ruRU\": \"%+d к мане при убийстве\",\n";
-                ss << u8"    \"zhCN\": \"%+d 每次消灭恢复的法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3581,\n";
-                ss << u8"    \"Key\": \"ModStr5g\",\n";
-                ss << u8"    \"enUS\": \"Fire Absorb %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"火焰吸收 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Feuerabsorption %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de absorción de fuego\",\n";
-                ss << u8"    \"frFR\": \"Absorption du Feu : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"Assorbimento del fuoco %+d%%\",\n";
-                ss << u8"    \"koKR\": \"화염 흡수 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do absorpcji ognia\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de absorción de fuego\",\n";
-                ss << u8"    \"jaJP\": \"火炎吸収（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de Absorve Fogo\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к поглощению урона от огня\",\n";
-                ss << u8"    \"zhCN\": \"火焰伤害吸收 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3582,\n";
-                ss << u8"    \"Key\": \"ModStr5h\",\n";
-                ss << u8"    \"enUS\": \"%+d Fire Absorb\",\n";
-                ss << u8"    \"zhTW\": \"%+d 火焰吸收\",\n";
-                ss << u8"    \"deDE\": \"%+d Feuerabsorption\",\n";
-                ss << u8"    \"esES\": \"%+d de absorción de fuego\",\n";
-                ss << u8"    \"frFR\": \"%+d à l’absorption du Feu\",\n";
-                ss << u8"    \"itIT\": \"%+d assorbimento del fuoco\",\n";
-                ss << u8"    \"koKR\": \"화염 흡수 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do absorpcji ognia\",\n";
-                ss << u8"    \"esMX\": \"%+d de absorción de fuego\",\n";
-                ss << u8"    \"jaJP\": \"火炎吸収（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de Absorve Fogo\",\n";
-                ss << u8"    \"ruRU\": \"%+d поглощаемого урона от огня\",\n";
-                ss << u8"    \"zhCN\": \"%+d 火焰伤害吸收\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3583,\n";
-                ss << u8"    \"Key\": \"ModStr5i\",\n";
-                ss << u8"    \"enUS\": \"Lightning Absorb %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"電擊吸收 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Blitzabsorption %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de absorción de rayos\",\n";
-                ss << u8"    \"frFR\": \"Absorption de la Foudre : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"Assorbimento del fulmine %+d%%\",\n";
-                ss << u8"    \"koKR\": \"번개 흡수 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do absorpcji błyskawic\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de absorción de rayo\",\n";
-                ss << u8"    \"jaJP\": \"電撃吸収（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de Absorve Eletricidade\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к поглощению урона от молнии\",\n";
-                ss << u8"    \"zhCN\": \"闪电伤害吸收 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3584,\n";
-                ss << u8"    \"Key\": \"ModStr5j\",\n";
-                ss << u8"    \"enUS\": \"%+d Lightning Absorb\",\n";
-                ss << u8"    \"zhTW\": \"%+d 電擊吸收\",\n";
-                ss << u8"    \"deDE\": \"%+d Blitzabsorption\",\n";
-                ss << u8"    \"esES\": \"%+d de absorción de rayos\",\n";
-                ss << u8"    \"frFR\": \"%+d à l’absorption de la Foudre\",\n";
-                ss << u8"    \"itIT\": \"%+d assorbimento del fulmine\",\n";
-                ss << u8"    \"koKR\": \"번개 흡수 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do absorpcji błyskawic\",\n";
-                ss << u8"    \"esMX\": \"%+d de absorción de rayo\",\n";
-                ss << u8"    \"jaJP\": \"電撃吸収（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de Absorve Eletricidade\",\n";
-                ss << u8"    \"ruRU\": \"%+d поглощаемого урона от молнии\",\n";
-                ss << u8"    \"zhCN\": \"%+d 闪电伤害吸收\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3585,\n";
-                ss << u8"    \"Key\": \"ModStr5k\",\n";
-                ss << u8"    \"enUS\": \"Magic Absorb %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"魔法吸收 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Magieabsorption %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de absorción de magia\",\n";
-                ss << u8"    \"frFR\": \"Absorption de la Magie : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"Assorbimento della magia %+d%%\",\n";
-                ss << u8"    \"koKR\": \"마법 흡수 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do absorpcji magii\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de absorción de magia\",\n";
-                ss << u8"    \"jaJP\": \"魔法吸収（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de Absorve Magia\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к поглощению магического урона\",\n";
-                ss << u8"    \"zhCN\": \"魔法伤害吸收 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3586,\n";
-                ss << u8"    \"Key\": \"ModStr5l\",\n";
-                ss << u8"    \"enUS\": \"%+d Magic Absorb\",\n";
-                ss << u8"    \"zhTW\": \"%+d 魔法吸收\",\n";
-                ss << u8"    \"deDE\": \"%+d Magieabsorption\",\n";
-                ss << u8"    \"esES\": \"%+d de absorción de magia\",\n";
-                ss << u8"    \"frFR\": \"%+d à l’absorption de la Magie\",\n";
-                ss << u8"    \"itIT\": \"%+d assorbimento della magia\",\n";
-                ss << u8"    \"koKR\": \"마법 흡수 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do absorpcji magii\",\n";
-                ss << u8"    \"esMX\": \"%+d de absorción de magia\",\n";
-                ss << u8"    \"jaJP\": \"魔法吸収（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de Absorve Magia\",\n";
-                ss << u8"    \"ruRU\": \"%+d поглощаемого магического урона\",\n";
-                ss << u8"    \"zhCN\": \"%+d 魔法伤害吸收\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3587,\n";
-                ss << u8"    \"Key\": \"ModStr5m\",\n";
-                ss << u8"    \"enUS\": \"Cold Absorb %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"冰寒吸收 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"Kälteabsorption %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de absorción de frío\",\n";
-                ss << u8"    \"frFR\": \"Absorption du Froid : %+d%%\",\n";
-                ss << u8"    \"itIT\": \"Assorbimento del freddo %+d%%\",\n";
-                ss << u8"    \"koKR\": \"냉기 흡수 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do absorpcji zimna\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de absorción de frío\",\n";
-                ss << u8"    \"jaJP\": \"冷気吸収（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de Absorve Gelo\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к поглощению урона от льда\",\n";
-                ss << u8"    \"zhCN\": \"冰霜伤害吸收 %+d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3588,\n";
-                ss << u8"    \"Key\": \"ModStr5n\",\n";
-                ss << u8"    \"enUS\": \"%+d Cold Absorb\",\n";
-                ss << u8"    \"zhTW\": \"%+d 冰寒吸收\",\n";
-                ss << u8"    \"deDE\": \"%+d Kälteabsorption\",\n";
-                ss << u8"    \"esES\": \"%+d de absorción de frío\",\n";
-                ss << u8"    \"frFR\": \"%+d à l’absorption du Froid\",\n";
-                ss << u8"    \"itIT\": \"%+d assorbimento del freddo\",\n";
-                ss << u8"    \"koKR\": \"냉기 흡수 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do absorpcji zimna\",\n";
-                ss << u8"    \"esMX\": \"%+d de absorción de frío\",\n";
-                ss << u8"    \"jaJP\": \"冷気吸収（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de Absorve Gelo\",\n";
-                ss << u8"    \"ruRU\": \"%+d поглощаемого урона от льда\",\n";
-                ss << u8"    \"zhCN\": \"%+d 冰霜伤害吸收\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3589,\n";
-                ss << u8"    \"Key\": \"ModStr5o\",\n";
-                ss << u8"    \"enUS\": \"-%d%% Target Defense\",\n";
-                ss << u8"    \"zhTW\": \"-%d%% 目標防禦\",\n";
-                ss << u8"    \"deDE\": \"-%d%% Zielverteidigung\",\n";
-                ss << u8"    \"esES\": \"-%d%% a la defensa del objetivo\",\n";
-                ss << u8"    \"frFR\": \"Défense de la cible : -%d%% \",\n";
-                ss << u8"    \"itIT\": \"-%d%% difesa del bersaglio\",\n";
-                ss << u8"    \"koKR\": \"대상의 방어력 -%d%%\",\n";
-                ss << u8"    \"plPL\": \"-%d%% do obrony przeciwnika\",\n";
-                ss << u8"    \"esMX\": \"-%d%% de defensa del objetivo\",\n";
-                ss << u8"    \"jaJP\": \"ターゲットの防御力（-%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"-%d%% de defesa do alvo\",\n";
-                ss << u8"    \"ruRU\": \"–%d%% к защите цели\",\n";
-                ss << u8"    \"zhCN\": \"-%d%% 目标防御\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3590,\n";
-                ss << u8"    \"Key\": \"ModStr5p\",\n";
-                ss << u8"    \"enUS\": \"Extra Bloody\",\n";
-                ss << u8"    \"zhTW\": \"額外血腥\",\n";
-                ss << u8"    \"deDE\": \"Besonders blutig\",\n";
-                ss << u8"    \"esES\": \"Extrasangriento\",\n";
-                ss << u8"    \"frFR\": \"Super sanglant\",\n";
-                ss << u8"    \"itIT\": \"Violenza aumentata\",\n";
-                ss << u8"    \"koKR\": \"잔인한 공격\",\n";
-                ss << u8"    \"plPL\": \"Wyjątkowo krwawy\",\n";
-                ss << u8"    \"esMX\": \"Muy sangriento\",\n";
-                ss << u8"    \"jaJP\": \"血の饗宴\",\n";
-                ss << u8"    \"ptBR\": \"Mais sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Дополнительное кровотечение\",\n";
-                ss << u8"    \"zhCN\": \"额外血腥\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3591,\n";
-                ss << u8"    \"Key\": \"ModStr5q\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Deadly Strike\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 致命打擊\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Todesschlag\",\n";
-                ss << u8"    \"esES\": \"%+d%% de azote mortal\",\n";
-                ss << u8"    \"frFR\": \"%+d%% de chances de coup mortel\",\n";
-                ss << u8"    \"itIT\": \"Probabilità di colpo mortale %+d%%\",\n";
-                ss << u8"    \"koKR\": \"치명적 공격 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szansy na zabójcze uderzenie\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de golpe letal\",\n";
-                ss << u8"    \"jaJP\": \"デッドリー・ストライク（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de Golpe Mortal\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к вероятности нанести смертельный удар\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 致死打击\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3593,\n";
-                ss << u8"    \"Key\": \"ModStr5s\",\n";
-                ss << u8"    \"enUS\": \"Blessed Aim\",\n";
-                ss << u8"    \"zhTW\": \"精準祝福\",\n";
-                ss << u8"    \"deDE\": \"Gesegnete Führung\",\n";
-                ss << u8"    \"esES\": \"Puntería bendecida\",\n";
-                ss << u8"    \"frFR\": \"Tir béni\",\n";
-                ss << u8"    \"itIT\": \"Mira Benedetta\",\n";
-                ss << u8"    \"koKR\": \"축복받은 조준\",\n";
-                ss << u8"    \"plPL\": \"Błogosławiona Celność\",\n";
-                ss << u8"    \"esMX\": \"Puntería bendecida\",\n";
-                ss << u8"    \"jaJP\": \"天恵の狙い\",\n";
-                ss << u8"    \"ptBR\": \"Mira Abençoada\",\n";
-                ss << u8"    \"ruRU\": \"Правое дело\",\n";
-                ss << u8"    \"zhCN\": \"祝福瞄准\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3594,\n";
-                ss << u8"    \"Key\": \"ModStr5t\",\n";
-                ss << u8"    \"enUS\": \"Defiance\",\n";
-                ss << u8"    \"zhTW\": \"反抗\",\n";
-                ss << u8"    \"deDE\": \"Trotz\",\n";
-                ss << u8"    \"esES\": \"Desafío\",\n";
-                ss << u8"    \"frFR\": \"Défiance\",\n";
-                ss << u8"    \"itIT\": \"Disprezzo\",\n";
-                ss << u8"    \"koKR\": \"대항\",\n";
-                ss << u8"    \"plPL\": \"Śmiałość\",\n";
-                ss << u8"    \"esMX\": \"Dureza\",\n";
-                ss << u8"    \"jaJP\": \"反骨\",\n";
-                ss << u8"    \"ptBR\": \"Desafio\",\n";
-                ss << u8"    \"ruRU\": \"Неповиновение\",\n";
-                ss << u8"    \"zhCN\": \"反抗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3595,\n";
-                ss << u8"    \"Key\": \"ModStr5u\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Maximum Fire Resist\",\n";
-                ss << u8"    \"zhTW\": \"火焰抗性上限 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu max. Feuerwiderstand\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia máxima al fuego\",\n";
-                ss << u8"    \"frFR\": \"%+d%% au max. de résistance au Feu\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza al fuoco massima\",\n";
-                ss << u8"    \"koKR\": \"최대 화염 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do maksymalnej odporności na ogień\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia máxima al fuego\",\n";
-                ss << u8"    \"jaJP\": \"最大火炎耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de resistência a fogo máxima\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению огню\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 火焰抗性上限\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3596,\n";
-                ss << u8"    \"Key\": \"ModStr5v\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Maximum Cold Resist\",\n";
-                ss << u8"    \"zhTW\": \"冰寒抗性上限 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu max. Kältewiderstand\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia máxima al frío\",\n";
-                ss << u8"    \"frFR\": \"%+d%% au max. de résistance au Froid\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza al freddo massima\",\n";
-                ss << u8"    \"koKR\": \"최대 냉기 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do maksymalnej odporności na zimno\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia máxima al frío\",\n";
-                ss << u8"    \"jaJP\": \"最大冷気耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de resistência a gelo máxima\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению льду\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 冰霜抗性上限\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3597,\n";
-                ss << u8"    \"Key\": \"ModStr5w\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Maximum Lightning Resist\",\n";
-                ss << u8"    \"zhTW\": \"電擊抗性上限 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu max. Blitzwiderstand\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia máxima a los rayos\",\n";
-                ss << u8"    \"frFR\": \"%+d%% au max. de résistance à la Foudre\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza al fulmine massima\",\n";
-                ss << u8"    \"koKR\": \"최대 번개 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do maksymalnej odporności na błyskawice\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia máxima al rayo\",\n";
-                ss << u8"    \"jaJP\": \"最大電撃耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de resistência elétrica máxima\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению молнии\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 闪电抗性上限\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3598,\n";
-                ss << u8"    \"Key\": \"ModStr5x\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Maximum Magic Resist\",\n";
-                ss << u8"    \"zhTW\": \"魔法抗性上限 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu max. Magiewiderstand\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia máxima a la magia\",\n";
-                ss << u8"    \"frFR\": \"%+d%% au max. de résistance à la Magie\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza alla magia massima\",\n";
-                ss << u8"    \"koKR\": \"최대 마법 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do maksymalnej odporności na magię\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia mágica máxima\",\n";
-                ss << u8"    \"jaJP\": \"最大魔法耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de resistência a magia máxima\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению магии\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 魔法抗性上限\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3599,\n";
-                ss << u8"    \"Key\": \"ModStr5y\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Maximum Poison Resist\",\n";
-                ss << u8"    \"zhTW\": \"毒素抗性上限 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu max. Giftwiderstand\",\n";
-                ss << u8"    \"esES\": \"%+d%% de resistencia máxima al veneno\",\n";
-                ss << u8"    \"frFR\": \"%+d%% au max. de résistance au Poison\",\n";
-                ss << u8"    \"itIT\": \"%+d%% resistenza al veleno massima\",\n";
-                ss << u8"    \"koKR\": \"최대 독 저항 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do maksymalnej odporności na trucizny\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de resistencia máxima al veneno\",\n";
-                ss << u8"    \"jaJP\": \"最大毒物耐性（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de resistência a veneno máxima\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению яду\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 毒素抗性上限\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3600,\n";
-                ss << u8"    \"Key\": \"ModStr5z\",\n";
-                ss << u8"    \"enUS\": \"Cannot Be Frozen\",\n";
-                ss << u8"    \"zhTW\": \"無法凍結\",\n";
-                ss << u8"    \"deDE\": \"Einfrieren nicht möglich\",\n";
-                ss << u8"    \"esES\": \"No te pueden congelar\",\n";
-                ss << u8"    \"frFR\": \"Ne peut pas être gelé\",\n";
-                ss << u8"    \"itIT\": \"Impedisce di essere congelati\",\n";
-                ss << u8"    \"koKR\": \"빙결되지 않음\",\n";
-                ss << u8"    \"plPL\": \"Odporność na zamrożenie\",\n";
-                ss << u8"    \"esMX\": \"No puede congelarse\",\n";
-                ss << u8"    \"jaJP\": \"凍結しなくなる\",\n";
-                ss << u8"    \"ptBR\": \"Não pode ser congelado\",\n";
-                ss << u8"    \"ruRU\": \"Нельзя заморозить\",\n";
-                ss << u8"    \"zhCN\": \"无法被冻结\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3601,\n";
-                ss << u8"    \"Key\": \"ModStr6a\",\n";
-                ss << u8"    \"enUS\": \"%+d Defense vs. Missile\",\n";
-                ss << u8"    \"zhTW\": \"%+d 對遠程防禦\",\n";
-                ss << u8"    \"deDE\": \"%+d Verteidigung gegen Geschoss\",\n";
-                ss << u8"    \"esES\": \"%+d de defensa contra misiles\",\n";
-                ss << u8"    \"frFR\": \"%+d de défense contre les projectiles\",\n";
-                ss << u8"    \"itIT\": \"%+d difesa a distanza\",\n";
-                ss << u8"    \"koKR\": \"원거리 공격 방어력 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do obrony przeciw pociskom\",\n";
-                ss << u8"    \"esMX\": \"%+d de defensa contra proyectiles\",\n";
-                ss << u8"    \"jaJP\": \"遠隔攻撃に対する防御力（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de defesa contra projéteis\",\n";
-                ss << u8"    \"ruRU\": \"%+d к защите от снарядов\",\n";
-                ss << u8"    \"zhCN\": \"%+d 远程防御\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3602,\n";
-                ss << u8"    \"Key\": \"ModStr6b\",\n";
-                ss << u8"    \"enUS\": \"%+d Defense vs. Melee\",\n";
-                ss << u8"    \"zhTW\": \"%+d 對近戰防禦\",\n";
-                ss << u8"    \"deDE\": \"%+d Verteidigung gegen Nahkampf\",\n";
-                ss << u8"    \"esES\": \"%+d de defensa contra cuerpo a cuerpo\",\n";
-                ss << u8"    \"frFR\": \"%+d de défense en mêlée\",\n";
-                ss << u8"    \"itIT\": \"%+d difesa in mischia\",\n";
-                ss << u8"    \"koKR\": \"근접 공격 방어력 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do obrony w walce wręcz\",\n";
-                ss << u8"    \"esMX\": \"%+d de defensa contra melé\",\n";
-                ss << u8"    \"jaJP\": \"近接攻撃に対する防御力（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de defesa contra corpo a corpo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к защите от ударов в ближнем бою\",\n";
-                ss << u8"    \"zhCN\": \"%+d 近战防御\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3603,\n";
-                ss << u8"    \"Key\": \"ModStr6c\",\n";
-                ss << u8"    \"enUS\": \"%+d Life after each Demon Kill\",\n";
-                ss << u8"    \"zhTW\": \"%+d 擊殺惡魔生命恢復\",\n";
-                ss << u8"    \"deDE\": \"%+d Leben nach jedem besiegten Dämonen\",\n";
-                ss << u8"    \"esES\": \"%+d p. de vida tras cada asesinato de demonio\",\n";
-                ss << u8"    \"frFR\": \"%+d points de vie après chaque démon tué\",\n";
-                ss << u8"    \"itIT\": \"%+d vita dopo ogni demone ucciso\",\n";
-                ss << u8"    \"koKR\": \"악마 처치 시 생명력 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do zdrowia za każdego zabitego demona\",\n";
-                ss << u8"    \"esMX\": \"%+d de vida tras cada asesinato de demonio\",\n";
-                ss << u8"    \"jaJP\": \"デーモンを倒すとライフが回復（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d pontos de vida após cada abate de demônio\",\n";
-                ss << u8"    \"ruRU\": \"%+d здоровья при убийстве демона\",\n";
-                ss << u8"    \"zhCN\": \"%+d 每次消灭恶魔恢复的生命\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3607,\n";
-                ss << u8"    \"Key\": \"ModStr6g\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Piercing Attack\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 穿透攻擊\",\n";
-                ss << u8"    \"deDE\": \"%+d%% durchbohrender Angriff\",\n";
-                ss << u8"    \"esES\": \"%+d%% de ataque perforador\",\n";
-                ss << u8"    \"frFR\": \"%+d%% de chances d’attaque perforante\",\n";
-                ss << u8"    \"itIT\": \"Probabilità di trapassare il bersaglio %+d%%\",\n";
-                ss << u8"    \"koKR\": \"관통 공격 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szansy na przeszywający atak\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de ataque perforante\",\n";
-                ss << u8"    \"jaJP\": \"貫通攻撃（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de Ataque Perfurante\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к пробивающей атаке\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 穿刺攻击\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3608,\n";
-                ss << u8"    \"Key\": \"ModStr6h\",\n";
-                ss << u8"    \"enUS\": \"Fires Magic Arrows\",\n";
-                ss << u8"    \"zhTW\": \"射出魔法箭矢\",\n";
-                ss << u8"    \"deDE\": \"Feuert magische Pfeile ab\",\n";
-                ss << u8"    \"esES\": \"Dispara flechas mágicas\",\n";
-                ss << u8"    \"frFR\": \"Envoie des flèches magiques\",\n";
-                ss << u8"    \"itIT\": \"Spara frecce magiche\",\n";
-                ss << u8"    \"koKR\": \"마법 화살 발사\",\n";
-                ss << u8"    \"plPL\": \"Wystrzeliwuje magiczne strzały\",\n";
-                ss << u8"    \"esMX\": \"Dispara flechas mágicas\",\n";
-                ss << u8"    \"jaJP\": \"魔法の矢を放つ\",\n";
-                ss << u8"    \"ptBR\": \"Dispara flechas mágicas\",\n";
-                ss << u8"    \"ruRU\": \"Магические стрелы\",\n";
-                ss << u8"    \"zhCN\": \"射出魔法箭\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3609,\n";
-                ss << u8"    \"Key\": \"ModStr6i\",\n";
-                ss << u8"    \"enUS\": \"Fires Explosive Arrows or Bolts\",\n";
-                ss << u8"    \"zhTW\": \"射出爆炸的弓矢或弩箭\",\n";
-                ss << u8"    \"deDE\": \"Feuert explodierende Pfeile oder Bolzen ab\",\n";
-                ss << u8"    \"esES\": \"Dispara flechas o descargas explosivas\",\n";
-                ss << u8"    \"frFR\": \"Tire des flèches ou des traits explosifs\",\n";
-                ss << u8"    \"itIT\": \"Spara frecce o dardi esplosivi\",\n";
-                ss << u8"    \"koKR\": \"폭발하는 화살 발사\",\n";
-                ss << u8"    \"plPL\": \"Wystrzeliwuje eksplodujące strzały lub bełty\",\n";
-                ss << u8"    \"esMX\": \"Dispara flechas o saetas explosivas\",\n";
-                ss << u8"    \"jaJP\": \"爆発する矢/ボルトを放つ\",\n";
-                ss << u8"    \"ptBR\": \"Dispara flechas ou setas explosivas\",\n";
-                ss << u8"    \"ruRU\": \"Взрывные стрелы или болты\",\n";
-                ss << u8"    \"zhCN\": \"射出爆炸箭或弩矢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3625,\n";
-                ss << u8"    \"Key\": \"improved damage\",\n";
-                ss << u8"    \"enUS\": \"Improved Damage\",\n";
-                ss << u8"    \"zhTW\": \"加強傷害\",\n";
-                ss << u8"    \"deDE\": \"Verbesserter Schaden\",\n";
-                ss << u8"    \"esES\": \"Daño mejorado\",\n";
-                ss << u8"    \"frFR\": \"Dégâts améliorés\",\n";
-                ss << u8"    \"itIT\": \"Danni migliorati\",\n";
-                ss << u8"    \"koKR\": \"피해 향상\",\n";
-                ss << u8"    \"plPL\": \"Zwiększone obrażenia\",\n";
-                ss << u8"    \"esMX\": \"Daño mejorado\",\n";
-                ss << u8"    \"jaJP\": \"ダメージ上昇\",\n";
-                ss << u8"    \"ptBR\": \"Dano aprimorado\",\n";
-                ss << u8"    \"ruRU\": \"Увеличенный урон\",\n";
-                ss << u8"    \"zhCN\": \"提高伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3626,\n";
-                ss << u8"    \"Key\": \"improved to hit\",\n";
-                ss << u8"    \"enUS\": \"Improved Attack Rating\",\n";
-                ss << u8"    \"zhTW\": \"加強準確率\",\n";
-                ss << u8"    \"deDE\": \"Verbesserter Angriffswert\",\n";
-                ss << u8"    \"esES\": \"Índice de ataque mejorado\",\n";
-                ss << u8"    \"frFR\": \"Score d’attaque amélioré\",\n";
-                ss << u8"    \"itIT\": \"Indice d'attacco migliorato\",\n";
-                ss << u8"    \"koKR\": \"명중률 향상\",\n";
-                ss << u8"    \"plPL\": \"Zwiększona skuteczność ataku\",\n";
-                ss << u8"    \"esMX\": \"Índice de ataque mejorado\",\n";
-                ss << u8"    \"jaJP\": \"命中率上昇\",\n";
-                ss << u8"    \"ptBR\": \"Taxa de ataque aprimorada\",\n";
-                ss << u8"    \"ruRU\": \"Увеличенный рейтинг атаки\",\n";
-                ss << u8"    \"zhCN\": \"提高命中值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3627,\n";
-                ss << u8"    \"Key\": \"improved armor class\",\n";
-                ss << u8"    \"enUS\": \"Improved Defense\",\n";
-                ss << u8"    \"zhTW\": \"加強防禦\",\n";
-                ss << u8"    \"deDE\": \"Verbesserte Verteidigung\",\n";
-                ss << u8"    \"esES\": \"Defensa mejorada\",\n";
-                ss << u8"    \"frFR\": \"Défense améliorée\",\n";
-                ss << u8"    \"itIT\": \"Difesa migliorata\",\n";
-                ss << u8"    \"koKR\": \"방어력 향상\",\n";
-                ss << u8"    \"plPL\": \"Zwiększona obrona\",\n";
-                ss << u8"    \"esMX\": \"Defensa mejorada\",\n";
-                ss << u8"    \"jaJP\": \"防御力上昇\",\n";
-                ss << u8"    \"ptBR\": \"Defesa aprimorada\",\n";
-                ss << u8"    \"ruRU\": \"Увеличенная защита\",\n";
-                ss << u8"    \"zhCN\": \"提高防御\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3628,\n";
-                ss << u8"    \"Key\": \"improved durability\",\n";
-                ss << u8"    \"enUS\": \"Improved Durability\",\n";
-                ss << u8"    \"zhTW\": \"加強耐久度\",\n";
-                ss << u8"    \"deDE\": \"Erhöhte Haltbarkeit\",\n";
-                ss << u8"    \"esES\": \"Durabilidad mejorada\",\n";
-                ss << u8"    \"frFR\": \"Durabilité améliorée\",\n";
-                ss << u8"    \"itIT\": \"Integrità migliorata\",\n";
-                ss << u8"    \"koKR\": \"내구도 향상\",\n";
-                ss << u8"    \"plPL\": \"Zwiększona trwałość\",\n";
-                ss << u8"    \"esMX\": \"Durabilidad mejorada\",\n";
-                ss << u8"    \"jaJP\": \"耐久力上昇\",\n";
-                ss << u8"    \"ptBR\": \"Durabilidade aprimorada\",\n";
-                ss << u8"    \"ruRU\": \"Увеличенная прочность\",\n";
-                ss << u8"    \"zhCN\": \"提高耐久度\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3629,\n";
-                ss << u8"    \"Key\": \"Quick Strike\",\n";
-                ss << u8"    \"enUS\": \"Quick Strike\",\n";
-                ss << u8"    \"zhTW\": \"快速攻擊\",\n";
-                ss << u8"    \"deDE\": \"Schneller Schlag\",\n";
-                ss << u8"    \"esES\": \"Golpe rápido\",\n";
-                ss << u8"    \"frFR\": \"Coup rapide\",\n";
-                ss << u8"    \"itIT\": \"Colpo rapido\",\n";
-                ss << u8"    \"koKR\": \"빠른 타격\",\n";
-                ss << u8"    \"plPL\": \"Szybkie Uderzenie\",\n";
-                ss << u8"    \"esMX\": \"Golpe rápido\",\n";
-                ss << u8"    \"jaJP\": \"クイック・ストライク\",\n";
-                ss << u8"    \"ptBR\": \"Golpe Rápido\",\n";
-                ss << u8"    \"ruRU\": \"Быстрый удар\",\n";
-                ss << u8"    \"zhCN\": \"快速打击\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3630,\n";
-                ss << u8"    \"Key\": \"strGemPlace1\",\n";
-                ss << u8"    \"enUS\": \"Can Be Inserted in Socketed\",\n";
-                ss << u8"    \"zhTW\": \"可以放入有鑲孔的\",\n";
-                ss << u8"    \"deDE\": \"Anbringung möglich an gesockelten\",\n";
-                ss << u8"    \"esES\": \"Se puede insertar en\",\n";
-                ss << u8"    \"frFR\": \"Peut être insérée dans une châsse\",\n";
-                ss << u8"    \"itIT\": \"Si può inserire in un castone\",\n";
-                ss << u8"    \"koKR\": \"홈이 있는 아이템에 삽입 가능\",\n";
-                ss << u8"    \"plPL\": \"Można umieścić w \",\n";
-                ss << u8"    \"esMX\": \"Puede insertarse en objetos engarzados\",\n";
-                ss << u8"    \"jaJP\": \"以下のソケット付きのアイテムに装着可能:\",\n";
-                ss << u8"    \"ptBR\": \"Pode ser inserido em\",\n";
-                ss << u8"    \"ruRU\": \"Можно вставить в предметы с гнездами\",\n";
-                ss << u8"    \"zhCN\": \"可以插入镶孔中\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3631,\n";
-                ss << u8"    \"Key\": \"strGemPlace2\",\n";
-                ss << u8"    \"enUS\": \"Weapons, Shields or Helms\",\n";
-                ss << u8"    \"zhTW\": \"武器、盾牌或頭盔\",\n";
-                ss << u8"    \"deDE\": \"Waffen, Schilden oder Helmen\",\n";
-                ss << u8"    \"esES\": \"armas, escudos o yelmos con huecos\",\n";
-                ss << u8"    \"frFR\": \"d’arme, de bouclier ou de heaume\",\n";
-                ss << u8"    \"itIT\": \"Armi, scudi o elmi\",\n";
-                ss << u8"    \"koKR\": \"무기, 방패, 투구\",\n";
-                ss << u8"    \"plPL\": \"broniach, tarczach lub hełmach z gniazdami\",\n";
-                ss << u8"    \"esMX\": \"Armas, escudos o yelmos\",\n";
-                ss << u8"    \"jaJP\": \"武器、盾、兜\",\n";
-                ss << u8"    \"ptBR\": \"armas, escudos ou elmos engastados\",\n";
-                ss << u8"    \"ruRU\": \"Оружие, щиты или шлемы\",\n";
-                ss << u8"    \"zhCN\": \"武器，盾牌或头盔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4077,\n";
-                ss << u8"    \"Key\": \"WeaponDescMace\",\n";
-                ss << u8"    \"enUS\": \"Mace Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"釘鎚類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Streitkolbenklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de maza: %s\",\n";
-                ss << u8"    \"frFR\": \"Type de masse - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe mazza - %s\",\n";
-                ss << u8"    \"koKR\": \"철퇴 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa buław – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: maza - %s\",\n";
-                ss << u8"    \"jaJP\": \"メイスタイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe maça - %s\",\n";
-                ss << u8"    \"ruRU\": \"Булава – %s\",\n";
-                ss << u8"    \"zhCN\": \"锤类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4078,\n";
-                ss << u8"    \"Key\": \"WeaponDescAxe\",\n";
-                ss << u8"    \"enUS\": \"Axe Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"斧頭類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Axtklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de hacha: %s\",\n";
-                ss << u8"    \"frFR\": \"Type de hache - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe ascia - %s\",\n";
-                ss << u8"    \"koKR\": \"도끼 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa toporów – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: hacha - %s\",\n";
-                ss << u8"    \"jaJP\": \"斧タイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe machado - %s\",\n";
-                ss << u8"    \"ruRU\": \"Топор – %s\",\n";
-                ss << u8"    \"zhCN\": \"斧类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4079,\n";
-                ss << u8"    \"Key\": \"WeaponDescSword - %s\",\n";
-                ss << u8"    \"enUS\": \"Sword Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"刀劍類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Schwertklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de espada: %s\",\n";
-                ss << u8"    \"frFR\": \"Type d’épée - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe spada - %s\",\n";
-                ss << u8"    \"koKR\": \"도검 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa mieczy – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: espada - %s\",\n";
-                ss << u8"    \"jaJP\": \"剣タイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe espada - %s\",\n";
-                ss << u8"    \"ruRU\": \"Меч – %s\",\n";
-                ss << u8"    \"zhCN\": \"剑类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4080,\n";
-                ss << u8"    \"Key\": \"WeaponDescDagger\",\n";
-                ss << u8"    \"enUS\": \"Dagger Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"匕首類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Dolchklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de daga: %s\",\n";
-                ss << u8"    \"frFR\": \"Type de dague - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe pugnale - %s\",\n";
-                ss << u8"    \"koKR\": \"단도 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa sztyletów – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: daga - %s\",\n";
-                ss << u8"    \"jaJP\": \"ダガータイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe adaga - %s\",\n";
-                ss << u8"    \"ruRU\": \"Кинжал – %s\",\n";
-                ss << u8"    \"zhCN\": \"匕首类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4082,\n";
-                ss << u8"    \"Key\": \"WeaponDescJavelin\",\n";
-                ss << u8"    \"enUS\": \"Javelin Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"標槍類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Wurfspießklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de jabalina: %s\",\n";
-                ss << u8"    \"frFR\": \"Type de javelot - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe giavellotto - %s\",\n";
-                ss << u8"    \"koKR\": \"투창 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa oszczepów – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: jabalina - %s\",\n";
-                ss << u8"    \"jaJP\": \"ジャベリンタイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe dardo - %s\",\n";
-                ss << u8"    \"ruRU\": \"Дротик – %s\",\n";
-                ss << u8"    \"zhCN\": \"标枪类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4083,\n";
-                ss << u8"    \"Key\": \"WeaponDescSpear\",\n";
-                ss << u8"    \"enUS\": \"Spear Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"長矛類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Speerklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de lanza: %s\",\n";
-                ss << u8"    \"frFR\": \"Type de lance - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe lancia - %s\",\n";
-                ss << u8"    \"koKR\": \"창 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa włóczni – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: lanza - %s\",\n";
-                ss << u8"    \"jaJP\": \"スピアタイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe lança - %s\",\n";
-                ss << u8"    \"ruRU\": \"Копье – %s\",\n";
-                ss << u8"    \"zhCN\": \"矛类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4084,\n";
-                ss << u8"    \"Key\": \"WeaponDescBow\",\n";
-                ss << u8"    \"enUS\": \"Bow Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"弓類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Bogenklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de arco: %s\",\n";
-                ss << u8"    \"frFR\": \"Type d’arc - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe arco - %s\",\n";
-                ss << u8"    \"koKR\": \"활 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa łuków – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: arco - %s\",\n";
-                ss << u8"    \"jaJP\": \"弓タイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe arco - %s\",\n";
-                ss << u8"    \"ruRU\": \"Лук – %s\",\n";
-                ss << u8"    \"zhCN\": \"弓类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4085,\n";
-                ss << u8"    \"Key\": \"WeaponDescStaff\",\n";
-                ss << u8"    \"enUS\": \"Staff Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"法杖類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Stabklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de bastón: %s\",\n";
-                ss << u8"    \"frFR\": \"Type de bâton - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe bastone - %s\",\n";
-                ss << u8"    \"koKR\": \"지팡이 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa kosturów – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: bastón - %s\",\n";
-                ss << u8"    \"jaJP\": \"杖タイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe cajado - %s\",\n";
-                ss << u8"    \"ruRU\": \"Посох – %s\",\n";
-                ss << u8"    \"zhCN\": \"法杖类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4086,\n";
-                ss << u8"    \"Key\": \"WeaponDescPoleArm\",\n";
-                ss << u8"    \"enUS\": \"Polearm Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"長柄類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Stangenwaffenklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de arma de asta: %s\",\n";
-                ss << u8"    \"frFR\": \"Type d’arme d’hast - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe arma in asta - %s\",\n";
-                ss << u8"    \"koKR\": \"미늘창 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa broni drzewcowych – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: arma de asta - %s\",\n";
-                ss << u8"    \"jaJP\": \"長柄武器タイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe haste - %s\",\n";
-                ss << u8"    \"ruRU\": \"Древковое оружие – %s\",\n";
-                ss << u8"    \"zhCN\": \"长柄类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4087,\n";
-                ss << u8"    \"Key\": \"WeaponDescCrossBow\",\n";
-                ss << u8"    \"enUS\": \"Crossbow Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"弩類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Armbrustklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de ballesta: %s\",\n";
-                ss << u8"    \"frFR\": \"Type d’arbalète - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe balestra - %s\",\n";
-                ss << u8"    \"koKR\": \"쇠뇌 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa kusz – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: ballesta - %s\",\n";
-                ss << u8"    \"jaJP\": \"クロスボウタイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe besta - %s\",\n";
-                ss << u8"    \"ruRU\": \"Арбалет – %s\",\n";
-                ss << u8"    \"zhCN\": \"弩类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4088,\n";
-                ss << u8"    \"Key\": \"WeaponAttackFastest\",\n";
-                ss << u8"    \"enUS\": \"Fastest Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"最快的攻擊速度\",\n";
-                ss << u8"    \"deDE\": \"Schnellste Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Velocidad de ataque máxima\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque : la plus rapide\",\n";
-                ss << u8"    \"itIT\": \"Velocità d'attacco massima\",\n";
-                ss << u8"    \"koKR\": \"가장 빠른 공격 속도\",\n";
-                ss << u8"    \"plPL\": \"Największa szybkość ataku\",\n";
-                ss << u8"    \"esMX\": \"Velocidad de ataque superrápida\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度（非常に速い）\",\n";
-                ss << u8"    \"ptBR\": \"Velocidade de ataque máxima\",\n";
-                ss << u8"    \"ruRU\": \"максимальная скорость атаки\",\n";
-                ss << u8"    \"zhCN\": \"攻击速度 - 最快\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4089,\n";
-                ss << u8"    \"Key\": \"WeaponAttackVeryFast\",\n";
-                ss << u8"    \"enUS\": \"Very Fast Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"極快的攻擊速度\",\n";
-                ss << u8"    \"deDE\": \"Sehr schnelle Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Velocidad de ataque muy alta\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque : très rapide\",\n";
-                ss << u8"    \"itIT\": \"Velocità d'attacco molto elevata\",\n";
-                ss << u8"    \"koKR\": \"매우 빠른 공격 속도\",\n";
-                ss << u8"    \"plPL\": \"Bardzo duża szybkość ataku\",\n";
-                ss << u8"    \"esMX\": \"Velocidad de ataque muy rápida\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度（速い）\",\n";
-                ss << u8"    \"ptBR\": \"Velocidade de ataque muito rápida\",\n";
-                ss << u8"    \"ruRU\": \"очень высокая скорость атаки\",\n";
-                ss << u8"    \"zhCN\": \"攻击速度 - 非常快\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4090,\n";
-                ss << u8"    \"Key\": \"WeaponAttackFast\",\n";
-                ss << u8"    \"enUS\": \"Fast Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"快速的攻擊速度\",\n";
-                ss << u8"    \"deDE\": \"Schnelle Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Velocidad de ataque alta\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque : rapide\",\n";
-                ss << u8"    \"itIT\": \"Velocità d'attacco elevata\",\n";
-                ss << u8"    \"koKR\": \"빠른 공격 속도\",\n";
-                ss << u8"    \"plPL\": \"Duża szybkość ataku\",\n";
-                ss << u8"    \"esMX\": \"Velocidad de ataque rápida\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度（やや速い）\",\n";
-                ss << u8"    \"ptBR\": \"Velocidade de ataque rápida\",\n";
-                ss << u8"    \"ruRU\": \"высокая скорость атаки\",\n";
-                ss << u8"    \"zhCN\": \"攻击速度 - 快速\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4091,\n";
-                ss << u8"    \"Key\": \"WeaponAttackNormal\",\n";
-                ss << u8"    \"enUS\": \"Normal Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"一般的攻擊速度\",\n";
-                ss << u8"    \"deDE\": \"Normale Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Velocidad de ataque normal\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque : normale\",\n";
-                ss << u8"    \"itIT\": \"Velocità d'attacco normale\",\n";
-                ss << u8"    \"koKR\": \"보통 공격 속도\",\n";
-                ss << u8"    \"plPL\": \"Normalna szybkość ataku\",\n";
-                ss << u8"    \"esMX\": \"Velocidad de ataque normal\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度（通常）\",\n";
-                ss << u8"    \"ptBR\": \"Velocidade de ataque normal\",\n";
-                ss << u8"    \"ruRU\": \"обычная скорость атаки\",\n";
-                ss << u8"    \"zhCN\": \"攻击速度 - 正常\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4092,\n";
-                ss << u8"    \"Key\": \"WeaponAttackSlow\",\n";
-                ss << u8"    \"enUS\": \"Slow Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"緩慢的攻擊速度\",\n";
-                ss << u8"    \"deDE\": \"Langsame Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Velocidad de ataque baja\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque : lente\",\n";
-                ss << u8"    \"itIT\": \"Velocità d'attacco ridotta\",\n";
-                ss << u8"    \"koKR\": \"느린 공격 속도\",\n";
-                ss << u8"    \"plPL\": \"Niska szybkość ataku\",\n";
-                ss << u8"    \"esMX\": \"Velocidad de ataque lenta\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度（やや遅い）\",\n";
-                ss << u8"    \"ptBR\": \"Velocidade de ataque lenta\",\n";
-                ss << u8"    \"ruRU\": \"низкая скорость атаки\",\n";
-                ss << u8"    \"zhCN\": \"攻击速度 - 慢速\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4093,\n";
-                ss << u8"    \"Key\": \"WeaponAttackVerySlow\",\n";
-                ss << u8"    \"enUS\": \"Very Slow Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"極慢的攻擊速度\",\n";
-                ss << u8"    \"deDE\": \"Sehr langsame Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Velocidad de ataque muy baja\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque : très lente\",\n";
-                ss << u8"    \"itIT\": \"Velocità d'attacco molto ridotta\",\n";
-                ss << u8"    \"koKR\": \"매우 느린 공격 속도\",\n";
-                ss << u8"    \"plPL\": \"Bardzo niska szybkość ataku\",\n";
-                ss << u8"    \"esMX\": \"Velocidad de ataque muy lenta\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度（遅い）\",\n";
-                ss << u8"    \"ptBR\": \"Velocidade de ataque muito lenta\",\n";
-                ss << u8"    \"ruRU\": \"очень низкая скорость атаки\",\n";
-                ss << u8"    \"zhCN\": \"攻击速度 - 非常慢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4094,\n";
-                ss << u8"    \"Key\": \"WeaponAttackSlowest\",\n";
-                ss << u8"    \"enUS\": \"Slowest Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"最慢的攻擊速度\",\n";
-                ss << u8"    \"deDE\": \"Langsamste Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"Velocidad de ataque mínima\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque : la moins rapide\",\n";
-                ss << u8"    \"itIT\": \"Velocità d'attacco minima\",\n";
-                ss << u8"    \"koKR\": \"가장 느린 공격 속도\",\n";
-                ss << u8"    \"plPL\": \"Najniższa szybkość ataku\",\n";
-                ss << u8"    \"esMX\": \"Velocidad de ataque superlenta\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度（非常に遅い）\",\n";
-                ss << u8"    \"ptBR\": \"Velocidade de ataque mínima\",\n";
-                ss << u8"    \"ruRU\": \"минимальная скорость атаки\",\n";
-                ss << u8"    \"zhCN\": \"攻击速度 - 最慢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10001,\n";
-                ss << u8"    \"Key\": \"ModStr5d\",\n";
-                ss << u8"    \"enUS\": \"%+d Maximum Stamina\",\n";
-                ss << u8"    \"zhTW\": \"%+d 精力上限\",\n";
-                ss << u8"    \"deDE\": \"%+d max. Ausdauer\",\n";
-                ss << u8"    \"esES\": \"%+d de aguante máximo\",\n";
-                ss << u8"    \"frFR\": \"%+d d’Endurance maximale\",\n";
-                ss << u8"    \"itIT\": \"%+d vigore massimo\",\n";
-                ss << u8"    \"koKR\": \"최대 지구력 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do maksymalnej wartości wytrzymałości\",\n";
-                ss << u8"    \"esMX\": \"%+d de vigor máximo\",\n";
-                ss << u8"    \"jaJP\": \"スタミナ最大値（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de vigor máximo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к максимальной выносливости\",\n";
-                ss << u8"    \"zhCN\": \"%+d 最大耐力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10020,\n";
-                ss << u8"    \"Key\": \"ModStr6e\",\n";
-                ss << u8"    \"enUS\": \"%d%% Slower Stamina Drain\",\n";
-                ss << u8"    \"zhTW\": \"精力消耗減緩 %d%%\",\n";
-                ss << u8"    \"deDE\": \"%d%% langsamerer Ausdauerverbrauch\",\n";
-                ss << u8"    \"esES\": \"Consumo de aguante un %d%% más lento\",\n";
-                ss << u8"    \"frFR\": \"Drain d’Endurance ralenti de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Consumo di vigore più lento del %d%%\",\n";
-                ss << u8"    \"koKR\": \"지구력 고갈 속도 %d%% 감소\",\n";
-                ss << u8"    \"plPL\": \"Wytrzymałość maleje o %d%% wolniej\",\n";
-                ss << u8"    \"esMX\": \"%d%% menos de pérdida de vigor\",\n";
-                ss << u8"    \"jaJP\": \"スタミナ消費軽減（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Drenagem de vigor reduzida em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"Выносливость снижается на %d%% медленнее\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 降低耐力消耗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10023,\n";
-                ss << u8"    \"Key\": \"strModEnhancedDamage\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Enhanced Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 傷害強化\",\n";
-                ss << u8"    \"deDE\": \"%+d%% erhöhter Schaden\",\n";
-                ss << u8"    \"esES\": \"%+d%% de daño mejorado\",\n";
-                ss << u8"    \"frFR\": \"%+d%% de dégâts supplémentaires\",\n";
-                ss << u8"    \"itIT\": \"%+d%% danni\",\n";
-                ss << u8"    \"koKR\": \"피해 %+d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do obrażeń\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de daño mejorado\",\n";
-                ss << u8"    \"jaJP\": \"ダメージを強化（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de dano aprimorado\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к урону\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 强化伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10024,\n";
-                ss << u8"    \"Key\": \"strModAllResistances\",\n";
-                ss << u8"    \"enUS\": \"All Resistances %+d\",\n";
-                ss << u8"    \"zhTW\": \"所有抗性 %+d\",\n";
-                ss << u8"    \"deDE\": \"Alle Widerstände %+d\",\n";
-                ss << u8"    \"esES\": \"%+d a todas las resistencias\",\n";
-                ss << u8"    \"frFR\": \"%+d à toutes les résistances\",\n";
-                ss << u8"    \"itIT\": \"%+d a tutte le resistenze\",\n";
-                ss << u8"    \"koKR\": \"모든 저항 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do wszystkich odporności\",\n";
-                ss << u8"    \"esMX\": \"%+d a todas las resistencias\",\n";
-                ss << u8"    \"jaJP\": \"全属性耐性（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para todas as resistências\",\n";
-                ss << u8"    \"ruRU\": \"%+d к сопротивлению всем видам урона\",\n";
-                ss << u8"    \"zhCN\": \"%+d 所有抗性\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10025,\n";
-                ss << u8"    \"Key\": \"strModAllSkillLevels\",\n";
-                ss << u8"    \"enUS\": \"%+d to All Skill Levels\",\n";
-                ss << u8"    \"zhTW\": \"%+d 所有技能等級\",\n";
-                ss << u8"    \"deDE\": \"%+d zu allen Fertigkeitenstufen\",\n";
-                ss << u8"    \"esES\": \"%+d a todos los niveles de habilidad\",\n";
-                ss << u8"    \"frFR\": \"%+d à toutes les compétences\",\n";
-                ss << u8"    \"itIT\": \"%+d a tutte le abilità\",\n";
-                ss << u8"    \"koKR\": \"모든 기술 레벨 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do wszystkich umiejętności\",\n";
-                ss << u8"    \"esMX\": \"%+d a todos los niveles de habilidad\",\n";
-                ss << u8"    \"jaJP\": \"全スキルレベル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para todos os níveis de habilidade\",\n";
-                ss << u8"    \"ruRU\": \"%+d к уровню всех умений\",\n";
-                ss << u8"    \"zhCN\": \"%+d 所有技能等级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10026,\n";
-                ss << u8"    \"Key\": \"strModFireDamage\",\n";
-                ss << u8"    \"enUS\": \"%+d fire damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 火焰傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d Feuerschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño de fuego\",\n";
-                ss << u8"    \"frFR\": \"%+d pts de dégâts de Feu\",\n";
-                ss << u8"    \"itIT\": \"%+d danni da fuoco\",\n";
-                ss << u8"    \"koKR\": \"화염 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d obrażeń od ognia\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de fuego\",\n";
-                ss << u8"    \"jaJP\": \"火炎ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano ígneo\",\n";
-                ss << u8"    \"ruRU\": \"%+d урона от огня\",\n";
-                ss << u8"    \"zhCN\": \"%+d 火焰伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10027,\n";
-                ss << u8"    \"Key\": \"strModFireDamageRange\",\n";
-                ss << u8"    \"enUS\": \"Adds %d-%d fire damage\",\n";
-                ss << u8"    \"zhTW\": \"附加 %d - %d 火焰傷害\",\n";
-                ss << u8"    \"deDE\": \"Fügt %d-%d Feuerschaden hinzu\",\n";
-                ss << u8"    \"esES\": \"Añade %d-%d p. daño de fuego\",\n";
-                ss << u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts de Feu\",\n";
-                ss << u8"    \"itIT\": \"Aggiunge %d-%d danni da fuoco\",\n";
-                ss << u8"    \"koKR\": \"화염 피해 %d - %d 추가\",\n";
-                ss << u8"    \"plPL\": \"Dodaje %d-%d obrażeń od ognia\",\n";
-                ss << u8"    \"esMX\": \"Agrega %d-%d de daño de fuego\",\n";
-                ss << u8"    \"jaJP\": \"火炎ダメージ上昇（%d - %d）\",\n";
-                ss << u8"    \"ptBR\": \"Adiciona %d-%d de dano ígneo\",\n";
-                ss << u8"    \"ruRU\": \"+%d–%d урона от огня\",\n";
-                ss << u8"    \"zhCN\": \"+ %d-%d 火焰伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10028,\n";
-                ss << u8"    \"Key\": \"strModColdDamage\",\n";
-                ss << u8"    \"enUS\": \"%+d cold damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 冰寒傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d Kälteschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño de frío\",\n";
-                ss << u8"    \"frFR\": \"%+d pts de dégâts de Froid\",\n";
-                ss << u8"    \"itIT\": \"%+d danni da freddo\",\n";
-                ss << u8"    \"koKR\": \"냉기 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d obrażeń od zimna\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de frío\",\n";
-                ss << u8"    \"jaJP\": \"冷気ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano gélido\",\n";
-                ss << u8"    \"ruRU\": \"%+d урона от льда\",\n";
-                ss << u8"    \"zhCN\": \"%+d 冰霜伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10029,\n";
-                ss << u8"    \"Key\": \"strModColdDamageRange\",\n";
-                ss << u8"    \"enUS\": \"Adds %d-%d cold damage\",\n";
-                ss << u8"    \"zhTW\": \"附加 %d - %d 冰寒傷害\",\n";
-                ss << u8"    \"deDE\": \"Fügt %d-%d Kälteschaden hinzu\",\n";
-                ss << u8"    \"esES\": \"Añade %d-%d p. de daño de frío\",\n";
-                ss << u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts de Froid\",\n";
-                ss << u8"    \"itIT\": \"Aggiunge %d-%d danni da freddo\",\n";
-                ss << u8"    \"koKR\": \"냉기 피해 %d - %d 추가\",\n";
-                ss << u8"    \"plPL\": \"Dodaje %d-%d obrażeń od zimna\",\n";
-                ss << u8"    \"esMX\": \"Agrega %d-%d de daño de frío\",\n";
-                ss << u8"    \"jaJP\": \"冷気ダメージ上昇（%d - %d）\",\n";
-                ss << u8"    \"ptBR\": \"Adiciona %d-%d de dano gélido\",\n";
-                ss << u8"    \"ruRU\": \"+%d–%d урона от льда\",\n";
-                ss << u8"    \"zhCN\": \"+ %d-%d 冰霜伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10030,\n";
-                ss << u8"    \"Key\": \"strModLightningDamage\",\n";
-                ss << u8"    \"enUS\": \"%+d lightning damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 電擊傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d Blitzschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño de rayos\",\n";
-                ss << u8"    \"frFR\": \"%+d pts de dégâts de Foudre\",\n";
-                ss << u8"    \"itIT\": \"%+d danni da fulmine\",\n";
-                ss << u8"    \"koKR\": \"번개 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d obrażeń od błyskawic\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de rayo\",\n";
-                ss << u8"    \"jaJP\": \"電撃ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano elétrico\",\n";
-                ss << u8"    \"ruRU\": \"%+d урона от молнии\",\n";
-                ss << u8"    \"zhCN\": \"%+d 闪电伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10031,\n";
-                ss << u8"    \"Key\": \"strModLightningDamageRange\",\n";
-                ss << u8"    \"enUS\": \"Adds %d-%d lightning damage\",\n";
-                ss << u8"    \"zhTW\": \"附加 %d - %d 電擊傷害\",\n";
-                ss << u8"    \"deDE\": \"Fügt %d-%d Blitzschaden hinzu\",\n";
-                ss << u8"    \"esES\": \"Añade %d-%d p. de daño de rayos\",\n";
-                ss << u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts de Foudre\",\n";
-                ss << u8"    \"itIT\": \"Aggiunge %d-%d danni da fulmine\",\n";
-                ss << u8"    \"koKR\": \"번개 피해 %d - %d 추가\",\n";
-                ss << u8"    \"plPL\": \"Dodaje %d-%d obrażeń od błyskawic\",\n";
-                ss << u8"    \"esMX\": \"Agrega %d-%d de daño de rayo\",\n";
-                ss << u8"    \"jaJP\": \"電撃ダメージ上昇（%d - %d）\",\n";
-                ss << u8"    \"ptBR\": \"Adiciona %d-%d de dano elétrico\",\n";
-                ss << u8"    \"ruRU\": \"+%d–%d урона от молнии\",\n";
-                ss << u8"    \"zhCN\": \"+ %d-%d 闪电伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10032,\n";
-                ss << u8"    \"Key\": \"strModMagicDamage\",\n";
-                ss << u8"    \"enUS\": \"%+d magic damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 魔法傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d Magieschaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño mágico\",\n";
-                ss << u8"    \"frFR\": \"%+d pts de dégâts magiques\",\n";
-                ss << u8"    \"itIT\": \"%+d danni magici\",\n";
-                ss << u8"    \"koKR\": \"마법 피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d obrażeń od magii\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño mágico\",\n";
-                ss << u8"    \"jaJP\": \"魔法ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano mágico\",\n";
-                ss << u8"    \"ruRU\": \"%+d магического урона\",\n";
-                ss << u8"    \"zhCN\": \"%+d 魔法伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10033,\n";
-                ss << u8"    \"Key\": \"strModMagicDamageRange\",\n";
-                ss << u8"    \"enUS\": \"Adds %d-%d magic damage\",\n";
-                ss << u8"    \"zhTW\": \"附加 %d - %d 魔法傷害\",\n";
-                ss << u8"    \"deDE\": \"Fügt %d-%d Magieschaden hinzu\",\n";
-                ss << u8"    \"esES\": \"Añade %d-%d p. de daño mágico\",\n";
-                ss << u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts magiques\",\n";
-                ss << u8"    \"itIT\": \"Aggiunge %d-%d danni magici\",\n";
-                ss << u8"    \"koKR\": \"마법 피해 %d - %d 추가\",\n";
-                ss << u8"    \"plPL\": \"Dodaje %d-%d obrażeń od magii\",\n";
-                ss << u8"    \"esMX\": \"Agrega %d-%d de daño mágico\",\n";
-                ss << u8"    \"jaJP\": \"魔法ダメージ上昇（%d - %d）\",\n";
-                ss << u8"    \"ptBR\": \"Adiciona %d-%d de dano mágico\",\n";
-                ss << u8"    \"ruRU\": \"+%d–%d магического урона\",\n";
-                ss << u8"    \"zhCN\": \"+ %d-%d 魔法伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10034,\n";
-                ss << u8"    \"Key\": \"strModPoisonDamage\",\n";
-                ss << u8"    \"enUS\": \"%+d poison damage over %d seconds\",\n";
-                ss << u8"    \"zhTW\": \"%+d 毒素傷害，時效 %d 秒\",\n";
-                ss << u8"    \"deDE\": \"%+d Giftschaden über %d Sek.\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño de veneno durante %d s\",\n";
-                ss << u8"    \"frFR\": \"%+d pts de dégâts de Poison en %d s\",\n";
-                ss << u8"    \"itIT\": \"%+d danni da veleno in %d s\",\n";
-                ss << u8"    \"koKR\": \"독 피해 %+d (%d초에 걸쳐)\",\n";
-                ss << u8"    \"plPL\": \"%+d obrażeń od trucizny w ciągu %d sek.\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño de veneno durante %d segundos\",\n";
-                ss << u8"    \"jaJP\": \"毒ダメージ付与（合計%+dダメージを%d秒間で与える）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano venenoso ao longo de %d segundos\",\n";
-                ss << u8"    \"ruRU\": \"%+d урона от яда за %d сек.\",\n";
-                ss << u8"    \"zhCN\": \"%+d 毒素伤害，持续%d秒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10035,\n";
-                ss << u8"    \"Key\": \"strModPoisonDamageRange\",\n";
-                ss << u8"    \"enUS\": \"Adds %d-%d poison damage over %d seconds\",\n";
-                ss << u8"    \"zhTW\": \"附加 %d - %d 毒素傷害，時效 %d 秒\",\n";
-                ss << u8"    \"deDE\": \"Fügt %d-%d Giftschaden über %d Sek. hinzu\",\n";
-                ss << u8"    \"esES\": \"Añade %d-%d p. de daño de veneno durante %d s\",\n";
-                ss << u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts de Poison en %d s\",\n";
-                ss << u8"    \"itIT\": \"Aggiunge %d-%d danni da veleno in %d s\",\n";
-                ss << u8"    \"koKR\": \"독 피해 %d - %d 추가 (%d초에 걸쳐)\",\n";
-                ss << u8"    \"plPL\": \"Dodaje %d-%d obrażeń od trucizny w ciągu %d sek.\",\n";
-                ss << u8"    \"esMX\": \"Agrega %d-%d de daño de veneno durante %d segundos\",\n";
-                ss << u8"    \"jaJP\": \"毒ダメージ付与（合計%d - %dダメージを%d秒間で与える）\",\n";
-                ss << u8"    \"ptBR\": \"Adiciona %d-%d de dano venenoso ao longo de %d segundos\",\n";
-                ss << u8"    \"ruRU\": \"+%d–%d урона от яда за %d сек.\",\n";
-                ss << u8"    \"zhCN\": \"+ %d-%d 毒素伤害，持续%d秒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10036,\n";
-                ss << u8"    \"Key\": \"strModMinDamage\",\n";
-                ss << u8"    \"enUS\": \"%+d damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d Schaden\",\n";
-                ss << u8"    \"esES\": \"%+d p. de daño\",\n";
-                ss << u8"    \"frFR\": \"%+d pts de dégâts\",\n";
-                ss << u8"    \"itIT\": \"%+d danni\",\n";
-                ss << u8"    \"koKR\": \"피해 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do obrażeń\",\n";
-                ss << u8"    \"esMX\": \"%+d de daño\",\n";
-                ss << u8"    \"jaJP\": \"ダメージ（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de dano\",\n";
-                ss << u8"    \"ruRU\": \"%+d к урону\",\n";
-                ss << u8"    \"zhCN\": \"%+d 伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10037,\n";
-                ss << u8"    \"Key\": \"strModMinDamageRange\",\n";
-                ss << u8"    \"enUS\": \"Adds %d-%d damage\",\n";
-                ss << u8"    \"zhTW\": \"附加 %d - %d 傷害\",\n";
-                ss << u8"    \"deDE\": \"Fügt %d-%d Schaden hinzu\",\n";
-                ss << u8"    \"esES\": \"Añade %d-%d p. de daño\",\n";
-                ss << u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts\",\n";
-                ss << u8"    \"itIT\": \"Aggiunge %d-%d danni\",\n";
-                ss << u8"    \"koKR\": \"피해 %d - %d 추가\",\n";
-                ss << u8"    \"plPL\": \"Dodaje %d-%d obrażeń\",\n";
-                ss << u8"    \"esMX\": \"Agrega %d-%d de daño\",\n";
-                ss << u8"    \"jaJP\": \"ダメージ上昇（%d - %d）\",\n";
-                ss << u8"    \"ptBR\": \"Adiciona %d-%d de dano\",\n";
-                ss << u8"    \"ruRU\": \"+%d–%d урона\",\n";
-                ss << u8"    \"zhCN\": \"+ %d-%d 伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10039,\n";
-                ss << u8"    \"Key\": \"ModStre9j\",\n";
-                ss << u8"    \"enUS\": \"Fire Damage Reduced by\",\n";
-                ss << u8"    \"zhTW\": \"火焰傷害降低\",\n";
-                ss << u8"    \"deDE\": \"Feuerschaden reduziert um\",\n";
-                ss << u8"    \"esES\": \"Daño de fuego reducido un\",\n";
-                ss << u8"    \"frFR\": \"Dégâts de Feu réduits de\",\n";
-                ss << u8"    \"itIT\": \"Danni da fuoco ridotti di\",\n";
-                ss << u8"    \"koKR\": \"화염 피해 감소\",\n";
-                ss << u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od ognia o\",\n";
-                ss << u8"    \"esMX\": \"Reduce el daño de fuego en\",\n";
-                ss << u8"    \"jaJP\": \"火炎ダメージを軽減\",\n";
-                ss << u8"    \"ptBR\": \"Dano ígneo reduzido em\",\n";
-                ss << u8"    \"ruRU\": \"Урон от огня уменьшен на\",\n";
-                ss << u8"    \"zhCN\": \"火焰伤害降低\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10040,\n";
-                ss << u8"    \"Key\": \"ModStre9k\",\n";
-                ss << u8"    \"enUS\": \"Cold Damage Reduced by\",\n";
-                ss << u8"    \"zhTW\": \"冰寒傷害降低\",\n";
-                ss << u8"    \"deDE\": \"Kälteschaden reduziert um\",\n";
-                ss << u8"    \"esES\": \"Daño de frío reducido un\",\n";
-                ss << u8"    \"frFR\": \"Dégâts de Froid réduits de\",\n";
-                ss << u8"    \"itIT\": \"Danni da freddo ridotti di\",\n";
-                ss << u8"    \"koKR\": \"냉기 피해 감소\",\n";
-                ss << u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od zimna o\",\n";
-                ss << u8"    \"esMX\": \"Reduce el daño de frío en\",\n";
-                ss << u8"    \"jaJP\": \"冷気ダメージを軽減\",\n";
-                ss << u8"    \"ptBR\": \"Dano gélido reduzido em\",\n";
-                ss << u8"    \"ruRU\": \"Урон от льда уменьшен на\",\n";
-                ss << u8"    \"zhCN\": \"冰霜伤害降低\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10041,\n";
-                ss << u8"    \"Key\": \"ModStre9l\",\n";
-                ss << u8"    \"enUS\": \"Lightning Damage Reduced by\",\n";
-                ss << u8"    \"zhTW\": \"電擊傷害降低\",\n";
-                ss << u8"    \"deDE\": \"Blitzschaden reduziert um\",\n";
-                ss << u8"    \"esES\": \"Daño de rayos reducido un\",\n";
-                ss << u8"    \"frFR\": \"Dégâts de Foudre réduits de\",\n";
-                ss << u8"    \"itIT\": \"Danni da fulmine ridotti di\",\n";
-                ss << u8"    \"koKR\": \"번개 피해 감소\",\n";
-                ss << u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od błyskawic o\",\n";
-                ss << u8"    \"esMX\": \"Reduce el daño de rayo en\",\n";
-                ss << u8"    \"jaJP\": \"電撃ダメージを軽減\",\n";
-                ss << u8"    \"ptBR\": \"Dano elétrico reduzido em\",\n";
-                ss << u8"    \"ruRU\": \"Урон от молнии уменьшен на\",\n";
-                ss << u8"    \"zhCN\": \"闪电伤害降低\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10042,\n";
-                ss << u8"    \"Key\": \"ModStre9m\",\n";
-                ss << u8"    \"enUS\": \"Poison Damage Reduced by\",\n";
-                ss << u8"    \"zhTW\": \"毒素傷害降低\",\n";
-                ss << u8"    \"deDE\": \"Giftschaden reduziert um\",\n";
-                ss << u8"    \"esES\": \"Daño de veneno reducido un\",\n";
-                ss << u8"    \"frFR\": \"Dégâts de Poison réduits de\",\n";
-                ss << u8"    \"itIT\": \"Danni da veleno ridotti di\",\n";
-                ss << u8"    \"koKR\": \"독 피해 감소\",\n";
-                ss << u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od trucizn o\",\n";
-                ss << u8"    \"esMX\": \"Reduce el daño de veneno en\",\n";
-                ss << u8"    \"jaJP\": \"毒ダメージを軽減\",\n";
-                ss << u8"    \"ptBR\": \"Dano venenoso reduzido em\",\n";
-                ss << u8"    \"ruRU\": \"Урон от яда уменьшен на\",\n";
-                ss << u8"    \"zhCN\": \"毒素伤害降低\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10043,\n";
-                ss << u8"    \"Key\": \"ModStre9n\",\n";
-                ss << u8"    \"enUS\": \"%+d Absorbs Magic Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 魔法傷害吸收\",\n";
-                ss << u8"    \"deDE\": \"%+d absorbiert Magieschaden\",\n";
-                ss << u8"    \"esES\": \"%+d de absorción de daño mágico\",\n";
-                ss << u8"    \"frFR\": \"%+d absorbe les dégâts magiques\",\n";
-                ss << u8"    \"itIT\": \"%+d danni magici assorbiti\",\n";
-                ss << u8"    \"koKR\": \"마법 피해 흡수 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do absorpcji obrażeń od magii\",\n";
-                ss << u8"    \"esMX\": \"Absorbe %+d de daño mágico\",\n";
-                ss << u8"    \"jaJP\": \"魔法ダメージを吸収（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"Absorve %+d de dano mágico\",\n";
-                ss << u8"    \"ruRU\": \"%+d к поглощению урона от магии\",\n";
-                ss << u8"    \"zhCN\": \"%+d 吸收魔法伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10044,\n";
-                ss << u8"    \"Key\": \"ModStre9o\",\n";
-                ss << u8"    \"enUS\": \"%+d Absorbs Fire Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 火焰傷害吸收\",\n";
-                ss << u8"    \"deDE\": \"%+d absorbiert Feuerschaden\",\n";
-                ss << u8"    \"esES\": \"%+d de absorción de daño de fuego\",\n";
-                ss << u8"    \"frFR\": \"%+d absorbe les dégâts de Feu\",\n";
-                ss << u8"    \"itIT\": \"%+d danni da fuoco assorbiti\",\n";
-                ss << u8"    \"koKR\": \"화염 피해 흡수 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do absorpcji obrażeń od ognia\",\n";
-                ss << u8"    \"esMX\": \"Absorbe %+d de daño de fuego\",\n";
-                ss << u8"    \"jaJP\": \"火炎ダメージを吸収（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"Absorve %+d de dano ígneo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к поглощению урона от огня\",\n";
-                ss << u8"    \"zhCN\": \"%+d 吸收火焰伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10045,\n";
-                ss << u8"    \"Key\": \"ModStre9p\",\n";
-                ss << u8"    \"enUS\": \"%+d Absorbs Cold Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 冰寒傷害吸收\",\n";
-                ss << u8"    \"deDE\": \"%+d absorbiert Kälteschaden\",\n";
-                ss << u8"    \"esES\": \"%+d de absorción de daño de frío\",\n";
-                ss << u8"    \"frFR\": \"%+d absorbe les dégâts de Froid\",\n";
-                ss << u8"    \"itIT\": \"%+d danni da freddo assorbiti\",\n";
-                ss << u8"    \"koKR\": \"냉기 피해 흡수 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do absorpcji obrażeń od zimna\",\n";
-                ss << u8"    \"esMX\": \"Absorbe %+d de daño de frío\",\n";
-                ss << u8"    \"jaJP\": \"冷気ダメージを吸収（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"Absorve %+d de dano gélido\",\n";
-                ss << u8"    \"ruRU\": \"%+d к поглощению урона от льда\",\n";
-                ss << u8"    \"zhCN\": \"%+d 吸收冰霜伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10046,\n";
-                ss << u8"    \"Key\": \"ModStre9q\",\n";
-                ss << u8"    \"enUS\": \"%+d Absorbs Lightning Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 電擊傷害吸收\",\n";
-                ss << u8"    \"deDE\": \"%+d absorbiert Blitzschaden\",\n";
-                ss << u8"    \"esES\": \"%+d de absorción de daño de rayos\",\n";
-                ss << u8"    \"frFR\": \"%+d absorbe les dégâts de Foudre\",\n";
-                ss << u8"    \"itIT\": \"%+d danni da fulmine assorbiti\",\n";
-                ss << u8"    \"koKR\": \"번개 피해 흡수 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do absorpcji obrażeń od błyskawic\",\n";
-                ss << u8"    \"esMX\": \"Absorbe %+d de daño de rayo\",\n";
-                ss << u8"    \"jaJP\": \"電撃ダメージを吸収（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"Absorve %+d de dano elétrico\",\n";
-                ss << u8"    \"ruRU\": \"%+d к поглощению урона от молнии\",\n";
-                ss << u8"    \"zhCN\": \"%+d 吸收闪电伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10047,\n";
-                ss << u8"    \"Key\": \"ModStre9r\",\n";
-                ss << u8"    \"enUS\": \"%+d Absorbs Poison Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d 毒素傷害吸收\",\n";
-                ss << u8"    \"deDE\": \"%+d absorbiert Giftschaden\",\n";
-                ss << u8"    \"esES\": \"%+d de absorción de daño de veneno\",\n";
-                ss << u8"    \"frFR\": \"%+d absorbe les dégâts de Poison\",\n";
-                ss << u8"    \"itIT\": \"%+d danni da veleno assorbiti\",\n";
-                ss << u8"    \"koKR\": \"독 피해 흡수 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do absorpcji obrażeń od trucizn\",\n";
-                ss << u8"    \"esMX\": \"Absorbe %+d de daño de veneno\",\n";
-                ss << u8"    \"jaJP\": \"毒ダメージを吸収（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"Absorve %+d de dano venenoso\",\n";
-                ss << u8"    \"ruRU\": \"%+d к поглощению урона от яда\",\n";
-                ss << u8"    \"zhCN\": \"%+d 吸收毒素伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10054,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem1\",\n";
-                ss << u8"    \"enUS\": \"%+d to Javelin and Spear Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 標槍與長矛技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Wurfspieß- und Speerfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a las habilidades de jabalina y lanza\",\n";
-                ss << u8"    \"frFR\": \"%+d au javelot et à la lance\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Abilità con lance e giavellotti\",\n";
-                ss << u8"    \"koKR\": \"투창과 창 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Oszczepu i Włóczni\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Jabalina y lanza\",\n";
-                ss << u8"    \"jaJP\": \"〈ジャベリン/スピア〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Dardos e Lanças\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям обращения с дротиками и копьями\",\n";
-                ss << u8"    \"zhCN\": \"%+d 标枪和长矛技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10055,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem2\",\n";
-                ss << u8"    \"enUS\": \"%+d to Passive and Magic Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 被動與魔法技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu passiven und magischen Fertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a las habilidades pasivas y mágicas\",\n";
-                ss << u8"    \"frFR\": \"%+d aux compétences passives et magiques\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Passive e magie\",\n";
-                ss << u8"    \"koKR\": \"지속 효과와 마법 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Pasywnych i Magii\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Pasivas y magia\",\n";
-                ss << u8"    \"jaJP\": \"〈常時発動/魔法〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Passivas e Magia\",\n";
-                ss << u8"    \"ruRU\": \"%+d к пассивным и магическим умениям\",\n";
-                ss << u8"    \"zhCN\": \"%+d 被动和魔法技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10056,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem3\",\n";
-                ss << u8"    \"enUS\": \"%+d to Bow and Crossbow Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 弓與弩技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Bogen- und Armbrustfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a las habilidades de arco y ballesta\",\n";
-                ss << u8"    \"frFR\": \"%+d à l’arc et à l’arbalète\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Abilità con archi e balestre\",\n";
-                ss << u8"    \"koKR\": \"활과 쇠뇌 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Łuku i Kuszy\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Arco y ballesta\",\n";
-                ss << u8"    \"jaJP\": \"〈弓/クロスボウ〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Arcos e Bestas\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям обращения с луками и арбалетами\",\n";
-                ss << u8"    \"zhCN\": \"%+d 弓和弩技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10057,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem4\",\n";
-                ss << u8"    \"enUS\": \"%+d to Defensive Auras\",\n";
-                ss << u8"    \"zhTW\": \"%+d 防禦靈氣\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Defensivauren\",\n";
-                ss << u8"    \"esES\": \"%+d a las auras defensivas\",\n";
-                ss << u8"    \"frFR\": \"%+d aux auras défensives\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Aure difensive\",\n";
-                ss << u8"    \"koKR\": \"방어 오라 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Aur Defensywnych\",\n";
-                ss << u8"    \"esMX\": \"%+d a las Auras defensivas\",\n";
-                ss << u8"    \"jaJP\": \"〈防御オーラ〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Auras Defensivas\",\n";
-                ss << u8"    \"ruRU\": \"%+d к защитным аурам\",\n";
-                ss << u8"    \"zhCN\": \"%+d 防御光环\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10058,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem5\",\n";
-                ss << u8"    \"enUS\": \"%+d to Offensive Auras\",\n";
-                ss << u8"    \"zhTW\": \"%+d 攻擊靈氣\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Offensivauren\",\n";
-                ss << u8"    \"esES\": \"%+d a las auras ofensivas\",\n";
-                ss << u8"    \"frFR\": \"%+d aux auras offensives\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Aure offensive\",\n";
-                ss << u8"    \"koKR\": \"공격 오라 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Aur Ofensywnych\",\n";
-                ss << u8"    \"esMX\": \"%+d a las Auras ofensivas\",\n";
-                ss << u8"    \"jaJP\": \"〈攻撃オーラ〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Auras Ofensivas\",\n";
-                ss << u8"    \"ruRU\": \"%+d к боевым аурам\",\n";
-                ss << u8"    \"zhCN\": \"%+d 攻击光环\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10059,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem6\",\n";
-                ss << u8"    \"enUS\": \"%+d to Combat Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 戰鬥技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Kampffertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a las habilidades de combate\",\n";
-                ss << u8"    \"frFR\": \"%+d aux compétences de combat\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Abilità belliche\",\n";
-                ss << u8"    \"koKR\": \"전투 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Walki\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Combate\",\n";
-                ss << u8"    \"jaJP\": \"〈戦闘〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Habilidades de Combate\",\n";
-                ss << u8"    \"ruRU\": \"%+d к боевым умениям\",\n";
-                ss << u8"    \"zhCN\": \"%+d 战斗技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10061,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem7\",\n";
-                ss << u8"    \"enUS\": \"%+d to Poison and Bone Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 毒素與骸骨技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Gift- und Knochenfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a las habilidades de veneno y hueso\",\n";
-                ss << u8"    \"frFR\": \"%+d en comp. de Poison et d’os\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Magie di ossa e veleno\",\n";
-                ss << u8"    \"koKR\": \"독과 뼈 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Trucizn i Kości\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Veneno y huesos\",\n";
-                ss << u8"    \"jaJP\": \"〈ポイズン/ボーン〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Veneno e Ossos\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям ядов и костей\",\n";
-                ss << u8"    \"zhCN\": \"%+d 毒素和白骨术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10062,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem8\",\n";
-                ss << u8"    \"enUS\": \"%+d to Curses\",\n";
-                ss << u8"    \"zhTW\": \"%+d 詛咒\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Flüchen\",\n";
-                ss << u8"    \"esES\": \"%+d a las maldiciones\",\n";
-                ss << u8"    \"frFR\": \"%+d en malédictions\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Maledizioni\",\n";
-                ss << u8"    \"koKR\": \"저주 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Klątw\",\n";
-                ss << u8"    \"esMX\": \"%+d a las Maldiciones\",\n";
-                ss << u8"    \"jaJP\": \"〈呪い〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Maldições\",\n";
-                ss << u8"    \"ruRU\": \"%+d к проклятиям\",\n";
-                ss << u8"    \"zhCN\": \"%+d 诅咒术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10063,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem10\",\n";
-                ss << u8"    \"enUS\": \"%+d to Warcries\",\n";
-                ss << u8"    \"zhTW\": \"%+d 戰吼\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Kriegsschreien\",\n";
-                ss << u8"    \"esES\": \"%+d a los gritos de guerra\",\n";
-                ss << u8"    \"frFR\": \"%+d aux cris de guerre\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Grida di guerra\",\n";
-                ss << u8"    \"koKR\": \"함성 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Okrzyków\",\n";
-                ss << u8"    \"esMX\": \"%+d a los Gritos de guerra\",\n";
-                ss << u8"    \"jaJP\": \"〈雄叫び〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Gritos de Guerra\",\n";
-                ss << u8"    \"ruRU\": \"%+d к боевым кличам\",\n";
-                ss << u8"    \"zhCN\": \"%+d 呐喊技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10064,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem11\",\n";
-                ss << u8"    \"enUS\": \"%+d to Combat Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 戰鬥技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Kampffertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a las habilidades de combate\",\n";
-                ss << u8"    \"frFR\": \"%+d aux compétences de combat\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Abilità belliche\",\n";
-                ss << u8"    \"koKR\": \"전투 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Zdolności Bojowych\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Combate\",\n";
-                ss << u8"    \"jaJP\": \"〈戦闘〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Habilidades de Combate\",\n";
-                ss << u8"    \"ruRU\": \"%+d к боевым умениям\",\n";
-                ss << u8"    \"zhCN\": \"%+d 战斗技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10065,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem12\",\n";
-                ss << u8"    \"enUS\": \"%+d to Masteries\",\n";
-                ss << u8"    \"zhTW\": \"%+d 戰鬥專精\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Beherrschungsfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a dominio del combate\",\n";
-                ss << u8"    \"frFR\": \"%+d aux maîtrises\",\n";
-                ss << u8"    \"itIT\": \"%+d ai Domini bellici\",\n";
-                ss << u8"    \"koKR\": \"숙련 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Mistrzostw Bojowych\",\n";
-                ss << u8"    \"esMX\": \"%+d a los Dominios\",\n";
-                ss << u8"    \"jaJP\": \"〈武器術〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Maestrias\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям владения оружием\",\n";
-                ss << u8"    \"zhCN\": \"%+d 精通类技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10066,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem13\",\n";
-                ss << u8"    \"enUS\": \"%+d to Cold Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 冰寒技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Kältefertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los hechizos de frío\",\n";
-                ss << u8"    \"frFR\": \"%+d aux compétences de Froid\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Magie del freddo\",\n";
-                ss << u8"    \"koKR\": \"냉기 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Zimna\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Frío\",\n";
-                ss << u8"    \"jaJP\": \"〈冷気〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Gelo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям льда\",\n";
-                ss << u8"    \"zhCN\": \"%+d 冰系法术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10067,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem14\",\n";
-                ss << u8"    \"enUS\": \"%+d to Lightning Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 閃電技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Blitzfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los hechizos de rayos\",\n";
-                ss << u8"    \"frFR\": \"%+d aux compétences de Foudre\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Magie del fulmine\",\n";
-                ss << u8"    \"koKR\": \"번개 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Błyskawic\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Rayo\",\n";
-                ss << u8"    \"jaJP\": \"〈電撃〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Eletricidade\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям молнии\",\n";
-                ss << u8"    \"zhCN\": \"%+d 雷系法术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10068,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem15\",\n";
-                ss << u8"    \"enUS\": \"%+d to Fire Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 火焰技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Feuerfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los hechizos de fuego\",\n";
-                ss << u8"    \"frFR\": \"%+d aux compétences de Feu\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Magie del fuoco\",\n";
-                ss << u8"    \"koKR\": \"화염 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Ognia\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Fuego\",\n";
-                ss << u8"    \"jaJP\": \"〈火炎〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Fogo\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям огня\",\n";
-                ss << u8"    \"zhCN\": \"%+d 火系法术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10069,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem16\",\n";
-                ss << u8"    \"enUS\": \"%+d to Summoning Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 召喚技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Herbeirufungfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a las habilidades de invocación\",\n";
-                ss << u8"    \"frFR\": \"%+d en invocation\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Magie di evocazione\",\n";
-                ss << u8"    \"koKR\": \"소환 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Przyzwania\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Invocación\",\n";
-                ss << u8"    \"jaJP\": \"〈召喚〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Invocação\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям спутников\",\n";
-                ss << u8"    \"zhCN\": \"%+d 召唤技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10070,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem17\",\n";
-                ss << u8"    \"enUS\": \"%+d to Shape Shifting Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 變形技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Gestaltwandlerfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a las habilidades de cambio de forma\",\n";
-                ss << u8"    \"frFR\": \"%+d en métamorphose\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Abilità mutaforma\",\n";
-                ss << u8"    \"koKR\": \"변신 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Zmiany Kształtu\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades de Metamorfosis\",\n";
-                ss << u8"    \"jaJP\": \"〈変身〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Metamorfose\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умениям смены облика\",\n";
-                ss << u8"    \"zhCN\": \"%+d 变形技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10071,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem18\",\n";
-                ss << u8"    \"enUS\": \"%+d to Elemental Skills\",\n";
-                ss << u8"    \"zhTW\": \"%+d 元素技能\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Elementarfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a las habilidades elementales\",\n";
-                ss << u8"    \"frFR\": \"%+d en élémentaires\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Magie elementali\",\n";
-                ss << u8"    \"koKR\": \"원소 기술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Żywiołów\",\n";
-                ss << u8"    \"esMX\": \"%+d a las habilidades Elementales\",\n";
-                ss << u8"    \"jaJP\": \"〈自然の力〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para habilidades Elementos\",\n";
-                ss << u8"    \"ruRU\": \"%+d к силам стихий\",\n";
-                ss << u8"    \"zhCN\": \"%+d 元素技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10072,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem19\",\n";
-                ss << u8"    \"enUS\": \"%+d to Traps\",\n";
-                ss << u8"    \"zhTW\": \"%+d 陷阱\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Fallen\",\n";
-                ss << u8"    \"esES\": \"%+d a las trampas\",\n";
-                ss << u8"    \"frFR\": \"%+d en pièges\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Trappole\",\n";
-                ss << u8"    \"koKR\": \"덫 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Pułapek\",\n";
-                ss << u8"    \"esMX\": \"%+d a las Trampas\",\n";
-                ss << u8"    \"jaJP\": \"〈トラップ〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Armadilhas\",\n";
-                ss << u8"    \"ruRU\": \"%+d к ловушкам\",\n";
-                ss << u8"    \"zhCN\": \"%+d 陷阱\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10073,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem20\",\n";
-                ss << u8"    \"enUS\": \"%+d to Shadow Disciplines\",\n";
-                ss << u8"    \"zhTW\": \"%+d 暗影修行\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Schattendisziplinen\",\n";
-                ss << u8"    \"esES\": \"%+d a la disciplina de las sombras\",\n";
-                ss << u8"    \"frFR\": \"%+d en disciplines de l’ombre\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Discipline dell'ombra\",\n";
-                ss << u8"    \"koKR\": \"그림자 단련 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Dyscyplin Cienia\",\n";
-                ss << u8"    \"esMX\": \"%+d a las Disciplinas de las sombras\",\n";
-                ss << u8"    \"jaJP\": \"〈シャドウアーツ〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Disciplinas Sombrias\",\n";
-                ss << u8"    \"ruRU\": \"%+d к теневым навыкам\",\n";
-                ss << u8"    \"zhCN\": \"%+d 影身训练\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10074,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem21\",\n";
-                ss << u8"    \"enUS\": \"%+d to Martial Arts\",\n";
-                ss << u8"    \"zhTW\": \"%+d 武學技藝\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Kampfkünsten\",\n";
-                ss << u8"    \"esES\": \"%+d a las artes marciales\",\n";
-                ss << u8"    \"frFR\": \"%+d en arts martiaux\",\n";
-                ss << u8"    \"itIT\": \"%+d alle Arti marziali\",\n";
-                ss << u8"    \"koKR\": \"무술 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności Sztuk Walki\",\n";
-                ss << u8"    \"esMX\": \"%+d a las Artes marciales\",\n";
-                ss << u8"    \"jaJP\": \"〈マーシャルアーツ〉スキル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para Artes Marciais\",\n";
-                ss << u8"    \"ruRU\": \"%+d к боевым искусствам\",\n";
-                ss << u8"    \"zhCN\": \"%+d 武学技艺\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10917,\n";
-                ss << u8"    \"Key\": \"AmaOnly\",\n";
-                ss << u8"    \"enUS\": \"(Amazon Only)\",\n";
-                ss << u8"    \"zhTW\": \"（只限亞馬遜）\",\n";
-                ss << u8"    \"deDE\": \"(Nur Amazone)\",\n";
-                ss << u8"    \"esES\": \"(Solo amazona)\",\n";
-                ss << u8"    \"frFR\": \"(Amazone uniquement)\",\n";
-                ss << u8"    \"itIT\": \"(Solo Amazzone)\",\n";
-                ss << u8"    \"koKR\": \"(아마존 전용)\",\n";
-                ss << u8"    \"plPL\": \"(Amazonka)\",\n";
-                ss << u8"    \"esMX\": \"(Solo para Amazona)\",\n";
-                ss << u8"    \"jaJP\": \"（アマゾネス専用）\",\n";
-                ss << u8"    \"ptBR\": \"(Somente Amazona)\",\n";
-                ss << u8"    \"ruRU\": \"(только для амазонок)\",\n";
-                ss << u8"    \"zhCN\": \"(仅限亚马逊)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10918,\n";
-                ss << u8"    \"Key\": \"SorOnly\",\n";
-                ss << u8"    \"enUS\": \"(Sorceress Only)\",\n";
-                ss << u8"    \"zhTW\": \"（只限魔法使）\",\n";
-                ss << u8"    \"deDE\": \"(Nur Zauberin)\",\n";
-                ss << u8"    \"esES\": \"(Solo hechicera)\",\n";
-                ss << u8"    \"frFR\": \"(Sorcière uniquement)\",\n";
-                ss << u8"    \"itIT\": \"(Solo Incantatrice)\",\n";
-                ss << u8"    \"koKR\": \"(원소술사 전용)\",\n";
-                ss << u8"    \"plPL\": \"(Czarodziejka)\",\n";
-                ss << u8"    \"esMX\": \"(Solo para Hechicera)\",\n";
-                ss << u8"    \"jaJP\": \"（ソーサレス専用）\",\n";
-                ss << u8"    \"ptBR\": \"(Somente Maga)\",\n";
-                ss << u8"    \"ruRU\": \"(только для волшебниц)\",\n";
-                ss << u8"    \"zhCN\": \"(仅限巫师)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10919,\n";
-                ss << u8"    \"Key\": \"NecOnly\",\n";
-                ss << u8"    \"enUS\": \"(Necromancer Only)\",\n";
-                ss << u8"    \"zhTW\": \"（只限死靈法師）\",\n";
-                ss << u8"    \"deDE\": \"(Nur Totenbeschwörer)\",\n";
-                ss << u8"    \"esES\": \"(Solo nigromante)\",\n";
-                ss << u8"    \"frFR\": \"(Nécromancien uniquement)\",\n";
-                ss << u8"    \"itIT\": \"(Solo Negromante)\",\n";
-                ss << u8"    \"koKR\": \"(강령술사 전용)\",\n";
-                ss << u8"    \"plPL\": \"(Nekromanta)\",\n";
-                ss << u8"    \"esMX\": \"(Solo para Nigromante)\",\n";
-                ss << u8"    \"jaJP\": \"（ネクロマンサー専用）\",\n";
-                ss << u8"    \"ptBR\": \"(Somente Necromante)\",\n";
-                ss << u8"    \"ruRU\": \"(только для некромантов)\",\n";
-                ss << u8"    \"zhCN\": \"(仅限死灵法师)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10920,\n";
-                ss << u8"    \"Key\": \"PalOnly\",\n";
-                ss << u8"    \"enUS\": \"(Paladin Only)\",\n";
-                ss << u8"    \"zhTW\": \"（只限聖騎士）\",\n";
-                ss << u8"    \"deDE\": \"(Nur Paladin)\",\n";
-                ss << u8"    \"esES\": \"(Solo paladín)\",\n";
-                ss << u8"    \"frFR\": \"(Paladin uniquement)\",\n";
-                ss << u8"    \"itIT\": \"(Solo Paladino)\",\n";
-                ss << u8"    \"koKR\": \"(성기사 전용)\",\n";
-                ss << u8"    \"plPL\": \"(Paladyn)\",\n";
-                ss << u8"    \"esMX\": \"(Solo para Paladín)\",\n";
-                ss << u8"    \"jaJP\": \"（パラディン専用）\",\n";
-                ss << u8"    \"ptBR\": \"(Somente Paladino)\",\n";
-                ss << u8"    \"ruRU\": \"(только для паладинов)\",\n";
-                ss << u8"    \"zhCN\": \"(仅限圣骑士)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10921,\n";
-                ss << u8"    \"Key\": \"BarOnly\",\n";
-                ss << u8"    \"enUS\": \"(Barbarian Only)\",\n";
-                ss << u8"    \"zhTW\": \"（只限野蠻人）\",\n";
-                ss << u8"    \"deDE\": \"(Nur Barbar)\",\n";
-                ss << u8"    \"esES\": \"(Solo bárbaro)\",\n";
-                ss << u8"    \"frFR\": \"(Barbare uniquement)\",\n";
-                ss << u8"    \"itIT\": \"(Solo Barbaro)\",\n";
-                ss << u8"    \"koKR\": \"(야만용사 전용)\",\n";
-                ss << u8"    \"plPL\": \"(Barbarzyńca)\",\n";
-                ss << u8"    \"esMX\": \"(Solo para Bárbaro)\",\n";
-                ss << u8"    \"jaJP\": \"（バーバリアン専用）\",\n";
-                ss << u8"    \"ptBR\": \"(Somente Bárbaro)\",\n";
-                ss << u8"    \"ruRU\": \"(только для варваров)\",\n";
-                ss << u8"    \"zhCN\": \"(仅限野蛮人)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10922,\n";
-                ss << u8"    \"Key\": \"DruOnly\",\n";
-                ss << u8"    \"enUS\": \"(Druid Only)\",\n";
-                ss << u8"    \"zhTW\": \"（只限德魯伊）\",\n";
-                ss << u8"    \"deDE\": \"(Nur Druide)\",\n";
-                ss << u8"    \"esES\": \"(Solo druida)\",\n";
-                ss << u8"    \"frFR\": \"(Druide uniquement)\",\n";
-                ss << u8"    \"itIT\": \"(Solo Druido)\",\n";
-                ss << u8"    \"koKR\": \"(드루이드 전용)\",\n";
-                ss << u8"    \"plPL\": \"(Druid)\",\n";
-                ss << u8"    \"esMX\": \"(Solo para Druida)\",\n";
-                ss << u8"    \"jaJP\": \"（ドルイド専用）\",\n";
-                ss << u8"    \"ptBR\": \"(Somente Druida)\",\n";
-                ss << u8"    \"ruRU\": \"(только для друидов)\",\n";
-                ss << u8"    \"zhCN\": \"(仅限德鲁伊)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10923,\n";
-                ss << u8"    \"Key\": \"AssOnly\",\n";
-                ss << u8"    \"enUS\": \"(Assassin Only)\",\n";
-                ss << u8"    \"zhTW\": \"（只限刺客）\",\n";
-                ss << u8"    \"deDE\": \"(Nur Assassine)\",\n";
-                ss << u8"    \"esES\": \"(Solo asesina)\",\n";
-                ss << u8"    \"frFR\": \"(Assassin uniquement)\",\n";
-                ss << u8"    \"itIT\": \"(Solo Assassina)\",\n";
-                ss << u8"    \"koKR\": \"(암살자 전용)\",\n";
-                ss << u8"    \"plPL\": \"(Zabójczyni)\",\n";
-                ss << u8"    \"esMX\": \"(Solo para Asesina)\",\n";
-                ss << u8"    \"jaJP\": \"（アサシン専用）\",\n";
-                ss << u8"    \"ptBR\": \"(Somente Assassina)\",\n";
-                ss << u8"    \"ruRU\": \"(только для ассасинов)\",\n";
-                ss << u8"    \"zhCN\": \"(仅限刺客)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10976,\n";
-                ss << u8"    \"Key\": \"ModitemAura\",\n";
-                ss << u8"    \"enUS\": \"Level %d %s Aura When Equipped\",\n";
-                ss << u8"    \"zhTW\": \"裝備時賦予等級 %d %s靈氣\",\n";
-                ss << u8"    \"deDE\": \"Stufe %d der %s-Aura, wenn getragen.\",\n";
-                ss << u8"    \"esES\": \"Aura %1 de nivel %0 si está equipado\",\n";
-                ss << u8"    \"frFR\": \"Aura de niveau %d pour %s quand équipé\",\n";
-                ss << u8"    \"itIT\": \"Fornisce a livello %d aura di %s\",\n";
-                ss << u8"    \"koKR\": \"장착 시 %d 레벨 %s 오라 효과 적용\",\n";
-                ss << u8"    \"plPL\": \"Po wyposażeniu zapewnia aurę %1 na poziomie %0\",\n";
-                ss << u8"    \"esMX\": \"Aura de %1 de nivel %0 al equiparse\",\n";
-                ss << u8"    \"jaJP\": \"装備時にオーラ〈%1〉（レベル%0）を発動\",\n";
-                ss << u8"    \"ptBR\": \"Aura %1 de nível %0 quando equipado\",\n";
-                ss << u8"    \"ruRU\": \"При надевании дает ауру «%1» %0-го уровня\",\n";
-                ss << u8"    \"zhCN\": \"装备时获得%d级%s光环\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10977,\n";
-                ss << u8"    \"Key\": \"Moditem2allattrib\",\n";
-                ss << u8"    \"enUS\": \"%+d to all Attributes\",\n";
-                ss << u8"    \"zhTW\": \"%+d 所有屬性\",\n";
-                ss << u8"    \"deDE\": \"%+d zu allen Attributen\",\n";
-                ss << u8"    \"esES\": \"%+d a todos los atributos\",\n";
-                ss << u8"    \"frFR\": \"%+d à toutes les caractéristiques\",\n";
-                ss << u8"    \"itIT\": \"%+d a tutte le caratteristiche\",\n";
-                ss << u8"    \"koKR\": \"모든 능력치 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do wszystkich atrybutów\",\n";
-                ss << u8"    \"esMX\": \"%+d a todos los atributos\",\n";
-                ss << u8"    \"jaJP\": \"全能力値（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para todos os atributos\",\n";
-                ss << u8"    \"ruRU\": \"%+d ко всем характеристикам\",\n";
-                ss << u8"    \"zhCN\": \"%+d 所有属性\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10978,\n";
-                ss << u8"    \"Key\": \"Moditem2ExpG\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Experience Gained\",\n";
-                ss << u8"    \"zhTW\": \"獲得的經驗值 %+d%%\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu gesammelter Erfahrung\",\n";
-                ss << u8"    \"esES\": \"%+d%% de experiencia obtenida\",\n";
-                ss << u8"    \"frFR\": \"%+d%% au gain d’exp.\",\n";
-                ss << u8"    \"itIT\": \"%+d%% esperienza guadagnata\",\n";
-                ss << u8"    \"koKR\": \"경험치 획득량 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do zdobywanego doświadczenia\",\n";
-                ss << u8"    \"esMX\": \"%+d%% a la experiencia obtenida\",\n";
-                ss << u8"    \"jaJP\": \"獲得経験値（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de experiência obtida\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к опыту\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 获得的经验\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10979,\n";
-                ss << u8"    \"Key\": \"ModitemHPaK\",\n";
-                ss << u8"    \"enUS\": \"%+d Life after each Kill\",\n";
-                ss << u8"    \"zhTW\": \"%+d 擊殺生命恢復\",\n";
-                ss << u8"    \"deDE\": \"%+d Leben nach jedem Kill\",\n";
-                ss << u8"    \"esES\": \"%+d p. de vida tras cada asesinato\",\n";
-                ss << u8"    \"frFR\": \"%+d pts de vie après chaque victime\",\n";
-                ss << u8"    \"itIT\": \"%+d vita dopo ogni uccisione\",\n";
-                ss << u8"    \"koKR\": \"적 처치 시 생명력 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d zdrowia za każdego zabitego przeciwnika\",\n";
-                ss << u8"    \"esMX\": \"%+d de vida tras cada asesinato\",\n";
-                ss << u8"    \"jaJP\": \"敵を倒すとライフが回復（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d pontos de vida após cada abate\",\n";
-                ss << u8"    \"ruRU\": \"%+d здоровья при убийстве\",\n";
-                ss << u8"    \"zhCN\": \"%+d 每次消灭恢复的生命\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10980,\n";
-                ss << u8"    \"Key\": \"ModitemRedVendP\",\n";
-                ss << u8"    \"enUS\": \"Reduces all Vendor Prices %d%%\",\n";
-                ss << u8"    \"zhTW\": \"所有商人的價格降低 %d%%\",\n";
-                ss << u8"    \"deDE\": \"Verringert alle Händlerpreise um %d%%\",\n";
-                ss << u8"    \"esES\": \"Reduce un %d%% todos los precios de los vendedores\",\n";
-                ss << u8"    \"frFR\": \"Réduit les prix des marchands de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Riduce i prezzi dei mercanti del %d%%\",\n";
-                ss << u8"    \"koKR\": \"상점 물품 가격 %d%% 하락\",\n";
-                ss << u8"    \"plPL\": \"Obniża ceny u wszystkich kupców o %d%%\",\n";
-                ss << u8"    \"esMX\": \"Reduce un %d%% los precios de los mercaderes\",\n";
-                ss << u8"    \"jaJP\": \"アイテム購入価格低下（-%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Reduz todos os preços de comerciantes em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"Снижает цены у торговцев на %d%%\",\n";
-                ss << u8"    \"zhCN\": \"所有商人的收费减少 %d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10981,\n";
-                ss << u8"    \"Key\": \"ModitemSMRIP\",\n";
-                ss << u8"    \"enUS\": \"Slain Monsters Rest in Peace\",\n";
-                ss << u8"    \"zhTW\": \"殺死的怪物就此安息\",\n";
-                ss << u8"    \"deDE\": \"Besiegte Monster ruhen in Frieden\",\n";
-                ss << u8"    \"esES\": \"Los monstruos asesinados descansan en paz\",\n";
-                ss << u8"    \"frFR\": \"Les monstres tués reposent en paix\",\n";
-                ss << u8"    \"itIT\": \"I mostri uccisi riposano in pace\",\n";
-                ss << u8"    \"koKR\": \"처치한 괴물이 안식에 듦\",\n";
-                ss << u8"    \"plPL\": \"Zabite potwory spoczywają w pokoju\",\n";
-                ss << u8"    \"esMX\": \"Los monstruos asesinados descansan en paz\",\n";
-                ss << u8"    \"jaJP\": \"倒したモンスターが復活しなくなる\",\n";
-                ss << u8"    \"ptBR\": \"Monstros mortos descansam em paz\",\n";
-                ss << u8"    \"ruRU\": \"Убитые монстры не возрождаются\",\n";
-                ss << u8"    \"zhCN\": \"消灭的怪物就此安息\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10982,\n";
-                ss << u8"    \"Key\": \"ModitemAttratvsM\",\n";
-                ss << u8"    \"enUS\": \"%d%% to Attack Rating versus\",\n";
-                ss << u8"    \"zhTW\": \"%d%% 準確率，針對\",\n";
-                ss << u8"    \"deDE\": \"%d%% zu Angriffswert gegen\",\n";
-                ss << u8"    \"esES\": \"%d%% de índice de ataque contra\",\n";
-                ss << u8"    \"frFR\": \"%d%% au score d’attaque contre\",\n";
-                ss << u8"    \"itIT\": \"Indice d'attacco aumentato del %d%% contro\",\n";
-                ss << u8"    \"koKR\": \"명중률 %d%% 증가 / 대상 한정:\",\n";
-                ss << u8"    \"plPL\": \"+%d%% do skuteczności ataku przeciwko:\",\n";
-                ss << u8"    \"esMX\": \"%d%% de índice de ataque contra\",\n";
-                ss << u8"    \"jaJP\": \"への命中率（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%d%% de taxa de ataque contra\",\n";
-                ss << u8"    \"ruRU\": \"%d%% к рейтингу атаки против следующих монстров:\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 提高命中值, 对\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10983,\n";
-                ss << u8"    \"Key\": \"Moditemdamvsm\",\n";
-                ss << u8"    \"enUS\": \"%d%% to Damage versus\",\n";
-                ss << u8"    \"zhTW\": \"%d%% 傷害，針對\",\n";
-                ss << u8"    \"deDE\": \"%d%% zu Schaden gegen\",\n";
-                ss << u8"    \"esES\": \"%d%% de daño contra\",\n";
-                ss << u8"    \"frFR\": \"%d%% aux dégâts contre\",\n";
-                ss << u8"    \"itIT\": \"Danni aumentati del %d%% contro\",\n";
-                ss << u8"    \"koKR\": \"피해 %d%% 증가 / 대상 한정:\",\n";
-                ss << u8"    \"plPL\": \"+%d%% do obrażeń przeciwko:\",\n";
-                ss << u8"    \"esMX\": \"%d%% de daño contra\",\n";
-                ss << u8"    \"jaJP\": \"へのダメージ（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%d%% de dano contra\",\n";
-                ss << u8"    \"ruRU\": \"%d%% к урону против следующих монстров:\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 提高伤害, 对\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10984,\n";
-                ss << u8"    \"Key\": \"Moditemslayat\",\n";
-                ss << u8"    \"enUS\": \"Slaying:\",\n";
-                ss << u8"    \"zhTW\": \"殺死：\",\n";
-                ss << u8"    \"deDE\": \"Besiegen:\",\n";
-                ss << u8"    \"esES\": \"Aniquilación:\",\n";
-                ss << u8"    \"frFR\": \"Pourfend :\",\n";
-                ss << u8"    \"itIT\": \"Sterminio:\",\n";
-                ss << u8"    \"koKR\": \"처단:\",\n";
-                ss << u8"    \"plPL\": \"Zabito:\",\n";
-                ss << u8"    \"esMX\": \"Ejecución:\",\n";
-                ss << u8"    \"jaJP\": \"スレイング:\",\n";
-                ss << u8"    \"ptBR\": \"Matança:\",\n";
-                ss << u8"    \"ruRU\": \"Убийственность:\",\n";
-                ss << u8"    \"zhCN\": \"杀戮:\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10985,\n";
-                ss << u8"    \"Key\": \"Moditemreanimas\",\n";
-                ss << u8"    \"enUS\": \"%0%% Reanimate as: %1\",\n";
-                ss << u8"    \"zhTW\": \"%0%% 機率將目標復生為：%1\",\n";
-                ss << u8"    \"deDE\": \"%0%% Wiederbeleben als: %1\",\n";
-                ss << u8"    \"esES\": \"%0%% de reanimar víctimas como: %1\",\n";
-                ss << u8"    \"frFR\": \"%0%% ranimé(s) sous forme de : %1\",\n";
-                ss << u8"    \"itIT\": \"%0%% di rianimare come: %1\",\n";
-                ss << u8"    \"koKR\": \"처치 시 %0%% 확률로 %1 소생\",\n";
-                ss << u8"    \"plPL\": \"%0%% szansy na ożywienie wroga jako: %1\",\n";
-                ss << u8"    \"esMX\": \"%0%% de reanimar como: %1\",\n";
-                ss << u8"    \"jaJP\": \"〈%1〉として復活（確率%0%%）\",\n";
-                ss << u8"    \"ptBR\": \"%0%% de chance de reanimar como: %1\",\n";
-                ss << u8"    \"ruRU\": \"С вероятностью %0%% возрождает как: %1\",\n";
-                ss << u8"    \"zhCN\": \"%0%% 复活：%1\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10986,\n";
-                ss << u8"    \"Key\": \"Moditemenrescoldsk\",\n";
-                ss << u8"    \"enUS\": \"-%d%% to Enemy Cold Resistance\",\n";
-                ss << u8"    \"zhTW\": \"敵人冰寒抗性 -%d%%\",\n";
-                ss << u8"    \"deDE\": \"-%d%% zu Kältewiderstand des Gegners\",\n";
-                ss << u8"    \"esES\": \"-%d%% de resistencia enemiga al frío\",\n";
-                ss << u8"    \"frFR\": \"-%d%% à la résistance au Froid de l’ennemi\",\n";
-                ss << u8"    \"itIT\": \"-%d%% resistenza al freddo nemica\",\n";
-                ss << u8"    \"koKR\": \"적의 냉기 저항 -%d%%\",\n";
-                ss << u8"    \"plPL\": \"-%d%% do odporności wroga na zimno\",\n";
-                ss << u8"    \"esMX\": \"-%d%% a la resistencia al frío del enemigo\",\n";
-                ss << u8"    \"jaJP\": \"敵の冷気耐性（-%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"-%d%% de resistência a gelo inimiga\",\n";
-                ss << u8"    \"ruRU\": \"–%d%% к сопротивлению льду у врага\",\n";
-                ss << u8"    \"zhCN\": \"-%d%% 敌人的冰霜抗性\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10987,\n";
-                ss << u8"    \"Key\": \"Moditemenresfiresk\",\n";
-                ss << u8"    \"enUS\": \"-%d%% to Enemy Fire Resistance\",\n";
-                ss << u8"    \"zhTW\": \"敵人火焰抗性 -%d%%\",\n";
-                ss << u8"    \"deDE\": \"-%d%% zu Feuerwiderstand des Gegners\",\n";
-                ss << u8"    \"esES\": \"-%d%% de resistencia enemiga al fuego\",\n";
-                ss << u8"    \"frFR\": \"-%d%% à la résistance au Feu de l’ennemi\",\n";
-                ss << u8"    \"itIT\": \"-%d%% resistenza al fuoco nemica\",\n";
-                ss << u8"    \"koKR\": \"적의 화염 저항 -%d%%\",\n";
-                ss << u8"    \"plPL\": \"-%d%% do odporności wroga na ogień\",\n";
-                ss << u8"    \"esMX\": \"-%d%% a la resistencia al fuego del enemigo\",\n";
-                ss << u8"    \"jaJP\": \"敵の火炎耐性（-%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"-%d%% de resistência a fogo inimiga\",\n";
-                ss << u8"    \"ruRU\": \"–%d%% к сопротивлению огню у врага\",\n";
-                ss << u8"    \"zhCN\": \"-%d%% 敌人的火焰抗性\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10988,\n";
-                ss << u8"    \"Key\": \"Moditemenresltngsk\",\n";
-                ss << u8"    \"enUS\": \"-%d%% to Enemy Lightning Resistance\",\n";
-                ss << u8"    \"zhTW\": \"敵人電擊抗性 -%d%%\",\n";
-                ss << u8"    \"deDE\": \"-%d%% zu Blitzwiderstand des Gegners\",\n";
-                ss << u8"    \"esES\": \"-%d%% de resistencia enemiga a los rayos\",\n";
-                ss << u8"    \"frFR\": \"-%d%% à la résistance à la Foudre de l’ennemi\",\n";
-                ss << u8"    \"itIT\": \"-%d%% resistenza al fulmine nemica\",\n";
-                ss << u8"    \"koKR\": \"적의 번개 저항 -%d%%\",\n";
-                ss << u8"    \"plPL\": \"-%d%% do odporności wroga na błyskawice\",\n";
-                ss << u8"    \"esMX\": \"-%d%% a la resistencia al rayo del enemigo\",\n";
-                ss << u8"    \"jaJP\": \"敵の電撃耐性（-%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"-%d%% de resistência elétrica inimiga\",\n";
-                ss << u8"    \"ruRU\": \"–%d%% к сопротивлению молнии у врага\",\n";
-                ss << u8"    \"zhCN\": \"-%d%% 敌人的闪电抗性\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10989,\n";
-                ss << u8"    \"Key\": \"Moditemenrespoissk\",\n";
-                ss << u8"    \"enUS\": \"-%d%% to Enemy Poison Resistance\",\n";
-                ss << u8"    \"zhTW\": \"敵人毒素抗性 -%d%%\",\n";
-                ss << u8"    \"deDE\": \"-%d%% zu Giftwiderstand des Gegners\",\n";
-                ss << u8"    \"esES\": \"-%d%% de resistencia enemiga al veneno\",\n";
-                ss << u8"    \"frFR\": \"-%d%% à la résistance au Poison de l’ennemi\",\n";
-                ss << u8"    \"itIT\": \"-%d%% resistenza al veleno nemica\",\n";
-                ss << u8"    \"koKR\": \"적의 독 저항 -%d%%\",\n";
-                ss << u8"    \"plPL\": \"-%d%% do odporności wroga na truciznę\",\n";
-                ss << u8"    \"esMX\": \"-%d%% a la resistencia al veneno del enemigo\",\n";
-                ss << u8"    \"jaJP\": \"敵の毒物耐性（-%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"-%d%% de resistência a veneno inimiga\",\n";
-                ss << u8"    \"ruRU\": \"–%d%% к сопротивлению яду у врага\",\n";
-                ss << u8"    \"zhCN\": \"-%d%% 敌人的毒素抗性\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10990,\n";
-                ss << u8"    \"Key\": \"ModitemdamFiresk\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Fire Skill Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 火焰技能傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu Feuerfertigkeitsschaden\",\n";
-                ss << u8"    \"esES\": \"%+d%% de daño con habilidades de fuego\",\n";
-                ss << u8"    \"frFR\": \"%+d%% aux dégâts de Feu\",\n";
-                ss << u8"    \"itIT\": \"%+d%% danni con abilità da fuoco\",\n";
-                ss << u8"    \"koKR\": \"화염 기술 피해 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do obrażeń od umiejętności ognia\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de daño de habilidad de fuego\",\n";
-                ss << u8"    \"jaJP\": \"火炎スキルダメージ（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de dano de habilidade ígnea\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к урону от умений огня\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 火焰技能伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10991,\n";
-                ss << u8"    \"Key\": \"ModitemdamColdsk\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Cold Skill Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 冰寒技能傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu Kältefertigkeitsschaden\",\n";
-                ss << u8"    \"esES\": \"%+d%% de daño con habilidades de frío\",\n";
-                ss << u8"    \"frFR\": \"%+d%% aux dégâts de Froid\",\n";
-                ss << u8"    \"itIT\": \"%+d%% danni con abilità da freddo\",\n";
-                ss << u8"    \"koKR\": \"냉기 기술 피해 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do obrażeń od umiejętności zimna\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de daño de habilidad de frío\",\n";
-                ss << u8"    \"jaJP\": \"冷気スキルダメージ（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de dano de habilidade gélida\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к урону от умений льда\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 冰霜技能伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10992,\n";
-                ss << u8"    \"Key\": \"ModitemdamLtngsk\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Lightning Skill Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 閃電技能傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu Blitzfertigkeitsschaden\",\n";
-                ss << u8"    \"esES\": \"%+d%% de daño con habilidades de rayos\",\n";
-                ss << u8"    \"frFR\": \"%+d%% aux dégâts de Foudre\",\n";
-                ss << u8"    \"itIT\": \"%+d%% danni con abilità da fulmine\",\n";
-                ss << u8"    \"koKR\": \"번개 기술 피해 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do obrażeń od umiejętności błyskawic\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de daño de habilidad de rayo\",\n";
-                ss << u8"    \"jaJP\": \"電撃スキルダメージ（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de dano de habilidade elétrica\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к урону от умений молнии\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 闪电技能伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10993,\n";
-                ss << u8"    \"Key\": \"ModitemdamPoissk\",\n";
-                ss << u8"    \"enUS\": \"%+d%% to Poison Skill Damage\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 毒素技能傷害\",\n";
-                ss << u8"    \"deDE\": \"%+d%% zu Giftfertigkeitschaden\",\n";
-                ss << u8"    \"esES\": \"%+d%% de daño con habilidades de veneno\",\n";
-                ss << u8"    \"frFR\": \"%+d%% aux dégâts de Poison\",\n";
-                ss << u8"    \"itIT\": \"%+d%% danni con abilità da veleno\",\n";
-                ss << u8"    \"koKR\": \"독 기술 피해 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do obrażeń od umiejętności trucizn\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de daño de habilidad de veneno\",\n";
-                ss << u8"    \"jaJP\": \"毒スキルダメージ（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de dano de habilidade venenosa\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к урону от умений яда\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 毒素技能伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10994,\n";
-                ss << u8"    \"Key\": \"Moditemskondeath\",\n";
-                ss << u8"    \"enUS\": \"%d%% Chance to cast level %d %s when you Die\",\n";
-                ss << u8"    \"zhTW\": \"當你死亡時有 %d%% 機率施展等級 %d %s\",\n";
-                ss << u8"    \"deDE\": \"%d%% Chance, beim Tod Stufe %d %s auszulösen\",\n";
-                ss << u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al morir\",\n";
-                ss << u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 quand vous mourez\",\n";
-                ss << u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando muori\",\n";
-                ss << u8"    \"koKR\": \"사망 시 %d%% 확률로 %d 레벨 %s 시전\",\n";
-                ss << u8"    \"plPL\": \"%d%% szansy na rzucenie %d-poziomowego zaklęcia %s kiedy giniesz\",\n";
-                ss << u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 cuando mueres\",\n";
-                ss << u8"    \"jaJP\": \"死亡時に%0%%の確率で〈%2〉（レベル%1）を発動\",\n";
-                ss << u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 quando você morre\",\n";
-                ss << u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня после смерти\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 几率在死亡时施放%d级%s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10995,\n";
-                ss << u8"    \"Key\": \"ModitemskonLevel\",\n";
-                ss << u8"    \"enUS\": \"%d%% Chance to cast level %d %s when you Level-Up\",\n";
-                ss << u8"    \"zhTW\": \"當你升級時有 %d%% 機率施展等級 %d %s\",\n";
-                ss << u8"    \"deDE\": \"%d%% Chance, beim Aufsteigen Stufe %d %s auszulösen\",\n";
-                ss << u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al subir de nivel\",\n";
-                ss << u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 quand vous montez de niveau\",\n";
-                ss << u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando sali di livello\",\n";
-                ss << u8"    \"koKR\": \"레벨 상승 시 %d%% 확률로 %d 레벨 %s 시전\",\n";
-                ss << u8"    \"plPL\": \"%d%% szansy na rzucenie %d-poziomowego zaklęcia %s kiedy awansujesz\",\n";
-                ss << u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al subir de nivel\",\n";
-                ss << u8"    \"jaJP\": \"レベルアップ時に%0%%の確率で〈%2〉（レベル%1）を発動\",\n";
-                ss << u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 quando você sobe de nível\",\n";
-                ss << u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при достижении нового уровня\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 几率在升级时施放%d级%s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10996,\n";
-                ss << u8"    \"Key\": \"ModitemskonKill\",\n";
-                ss << u8"    \"enUS\": \"%d%% Chance to cast level %d %s when you Kill an Enemy\",\n";
-                ss << u8"    \"zhTW\": \"當你殺敵時有 %d%% 機率施展等級 %d %s\",\n";
-                ss << u8"    \"deDE\": \"%d%% Chance, beim Töten eines Gegners Stufe  %d %s auszulösen\",\n";
-                ss << u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al matar a un enemigo\",\n";
-                ss << u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 quand vous tuez un ennemi\",\n";
-                ss << u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando uccidi un nemico\",\n";
-                ss << u8"    \"koKR\": \"적 처치 시 %d%% 확률로 %d 레벨 %s 시전\",\n";
-                ss << u8"    \"plPL\": \"%d%% szansy na rzucenie %d-poziomowego zaklęcia %s kiedy zabijasz wroga\",\n";
-                ss << u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al matar un enemigo\",\n";
-                ss << u8"    \"jaJP\": \"敵を倒すと%0%%の確率で〈%2〉（レベル%1）を発動\",\n";
-                ss << u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 quando você abate um inimigo\",\n";
-                ss << u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при убийстве\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 几率在消灭一名敌人时施放%d级%s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11003,\n";
-                ss << u8"    \"Key\": \"StrSklTabItem9\",\n";
-                ss << u8"    \"enUS\": \"+%d to Summoning Skills\",\n";
-                ss << u8"    \"zhTW\": \"+%d 召喚技能\",\n";
-                ss << u8"    \"deDE\": \"+%d zu Herbeirufungfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"+%d a las habilidades de invocación\",\n";
-                ss << u8"    \"frFR\": \"+%d en invocation\",\n";
-                ss << u8"    \"itIT\": \"+%d alle Magie di evocazione\",\n";
-                ss << u8"    \"koKR\": \"소환 기술 +%d\",\n";
-                ss << u8"    \"plPL\": \"+%d do umiejętności Przywoływania\",\n";
-                ss << u8"    \"esMX\": \"+%d a las habilidades de Invocación\",\n";
-                ss << u8"    \"jaJP\": \"〈召喚〉スキル向上（+%d）\",\n";
-                ss << u8"    \"ptBR\": \"+%d para habilidades Evocação\",\n";
-                ss << u8"    \"ruRU\": \"+%d к умениям призыва\",\n";
-                ss << u8"    \"zhCN\": \"+%d 召唤术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11018,\n";
-                ss << u8"    \"Key\": \"ItemStats1r\",\n";
-                ss << u8"    \"enUS\": \"Chance to Block: %d%%\",\n";
-                ss << u8"    \"zhTW\": \"格擋機率：%d%%\",\n";
-                ss << u8"    \"deDE\": \"Blockchance: %d%%\",\n";
-                ss << u8"    \"esES\": \"Probabilidad de bloqueo: %d%%\",\n";
-                ss << u8"    \"frFR\": \"Chances de bloquer : %d%%\",\n";
-                ss << u8"    \"itIT\": \"Probabilità di parata: %d%%\",\n";
-                ss << u8"    \"koKR\": \"막기 확률: %d%%\",\n";
-                ss << u8"    \"plPL\": \"Szansa na blok: %d%%\",\n";
-                ss << u8"    \"esMX\": \"Probabilidad de bloqueo: %d%%\",\n";
-                ss << u8"    \"jaJP\": \"ブロック確率: %d%%\",\n";
-                ss << u8"    \"ptBR\": \"Chance de bloqueio: %d%%\",\n";
-                ss << u8"    \"ruRU\": \"Вероятность блока: %d%%\",\n";
-                ss << u8"    \"zhCN\": \"格挡几率: %d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11032,\n";
-                ss << u8"    \"Key\": \"ModStr1w\",\n";
-                ss << u8"    \"enUS\": \"%d%% Extra Gold from Monsters\",\n";
-                ss << u8"    \"zhTW\": \"怪物金幣掉落量提高 %d%%\",\n";
-                ss << u8"    \"deDE\": \"%d%% Extragold von Monstern\",\n";
-                ss << u8"    \"esES\": \"%d%% de oro extra de los monstruos\",\n";
-                ss << u8"    \"frFR\": \"%d%% d’or suppl. sur les monstres\",\n";
-                ss << u8"    \"itIT\": \"%d%% oro extra dai mostri\",\n";
-                ss << u8"    \"koKR\": \"괴물에게서 얻는 금화 %d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"+%d%% dodatkowego złota od potworów\",\n";
-                ss << u8"    \"esMX\": \"%d%% de oro adicional de monstruos\",\n";
-                ss << u8"    \"jaJP\": \"モンスターからの獲得ゴールド（+%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%d%% de ouro adicional de monstros\",\n";
-                ss << u8"    \"ruRU\": \"+%d%% к золоту за убийство монстров\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 怪物额外掉落金币\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11033,\n";
-                ss << u8"    \"Key\": \"ModStr1x\",\n";
-                ss << u8"    \"enUS\": \"%d%% Better Chance of Getting Magic Items\",\n";
-                ss << u8"    \"zhTW\": \"尋獲魔法物品機率提高 %d%%\",\n";
-                ss << u8"    \"deDE\": \"%d%% bessere Chance, magischen Gegenstand zu erhalten\",\n";
-                ss << u8"    \"esES\": \"+%d%% de probabilidad de encontrar objetos mágicos\",\n";
-                ss << u8"    \"frFR\": \"%d%% de chances suppl. d’obtenir des objets magiques\",\n";
-                ss << u8"    \"itIT\": \"Probabilità di ottenere un oggetto magico aumentata del %d%%\",\n";
-                ss << u8"    \"koKR\": \"마법 아이템 발견 확률 %d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"+%d%% do szansy na zdobycie magicznych przedmiotów\",\n";
-                ss << u8"    \"esMX\": \"%d%% más de probabilidad de obtener objetos mágicos\",\n";
-                ss << u8"    \"jaJP\": \"マジックアイテムドロップ率（+%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%d%% de chance adicional de obter itens mágicos\",\n";
-                ss << u8"    \"ruRU\": \"+%d%% к вероятности найти магический предмет\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 额外几率获得魔法物品\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11034,\n";
-                ss << u8"    \"Key\": \"ModStr3u\",\n";
-                ss << u8"    \"enUS\": \"Hit Causes Monster to Flee %+d%%\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 機率擊中使怪物逃跑\",\n";
-                ss << u8"    \"deDE\": \"Treffer schlägt Monster in die Flucht %+d%%\",\n";
-                ss << u8"    \"esES\": \"%+d%% de probabilidad de que los monstruos huyan al golpearlos\",\n";
-                ss << u8"    \"frFR\": \"Le monstre touché s’enfuit à %+d%%\",\n";
-                ss << u8"    \"itIT\": \"Probabilità di far fuggire il bersaglio %+d%%\",\n";
-                ss << u8"    \"koKR\": \"적중 시 괴물 도주 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% szansy na zmuszenie potwora do ucieczki\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de que monstruo huya al ser golpeado\",\n";
-                ss << u8"    \"jaJP\": \"攻撃命中でモンスターが逃げ出す（%+d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Acerto causa fuga do monstro %+d%%\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к вероятности обратить монстра в бегство при ударе\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 几率命中使怪物逃跑\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11035,\n";
-                ss << u8"    \"Key\": \"ModStr4c\",\n";
-                ss << u8"    \"enUS\": \"%d%% Bonus to Attack Rating\",\n";
-                ss << u8"    \"zhTW\": \"%d%% 準確率加成\",\n";
-                ss << u8"    \"deDE\": \"%d%% Bonus zu Angriffswert\",\n";
-                ss << u8"    \"esES\": \"%d%% de bonus al índice de ataque\",\n";
-                ss << u8"    \"frFR\": \"%d%% de bonus au score d’attaque\",\n";
-                ss << u8"    \"itIT\": \"Indice d'attacco aumentato del %d%%\",\n";
-                ss << u8"    \"koKR\": \"명중률 보너스 %d%%\",\n";
-                ss << u8"    \"plPL\": \"%d%% premii do skuteczności ataku\",\n";
-                ss << u8"    \"esMX\": \"%d%% de bonificación al índice de ataque\",\n";
-                ss << u8"    \"jaJP\": \"命中率へのボーナス（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"%d%% de bônus de taxa de ataque\",\n";
-                ss << u8"    \"ruRU\": \"+%d%% к рейтингу атаки\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 加成命中值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11036,\n";
-                ss << u8"    \"Key\": \"ModStr5r\",\n";
-                ss << u8"    \"enUS\": \"Slows Target by %d%%\",\n";
-                ss << u8"    \"zhTW\": \"使目標減慢 %d%%\",\n";
-                ss << u8"    \"deDE\": \"Verlangsamt Ziel um %d%%\",\n";
-                ss << u8"    \"esES\": \"Ralentiza al objetivo un %d%%\",\n";
-                ss << u8"    \"frFR\": \"Ralentit l’adversaire de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Rallenta il bersaglio del %d%%\",\n";
-                ss << u8"    \"koKR\": \"대상 감속 %d%%\",\n";
-                ss << u8"    \"plPL\": \"Spowalnia cel o %d%%\",\n";
-                ss << u8"    \"esMX\": \"Ralentiza al objetivo un %d%%\",\n";
-                ss << u8"    \"jaJP\": \"敵の速度低下（-%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Desacelera o alvo em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"Замедляет цель на %d%%\",\n";
-                ss << u8"    \"zhCN\": \"使目标减速 %d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11037,\n";
-                ss << u8"    \"Key\": \"ModStr6f\",\n";
-                ss << u8"    \"enUS\": \"Chance to Reanimate Target\",\n";
-                ss << u8"    \"zhTW\": \"機率使目標復活\",\n";
-                ss << u8"    \"deDE\": \"Chance, das Ziel wiederzubeleben\",\n";
-                ss << u8"    \"esES\": \"Probabilidad de reanimar al objetivo\",\n";
-                ss << u8"    \"frFR\": \"Chances de réanimer la cible\",\n";
-                ss << u8"    \"itIT\": \"Può rianimare il bersaglio\",\n";
-                ss << u8"    \"koKR\": \"일정 확률로 대상 소생\",\n";
-                ss << u8"    \"plPL\": \"Szansa na ożywienie celu\",\n";
-                ss << u8"    \"esMX\": \"Probabilidad de reanimar al objetivo\",\n";
-                ss << u8"    \"jaJP\": \"の確率で対象を復活\",\n";
-                ss << u8"    \"ptBR\": \"Chance de reanimar o alvo\",\n";
-                ss << u8"    \"ruRU\": \"Может оживить цель\",\n";
-                ss << u8"    \"zhCN\": \"有机会使目标复活\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11038,\n";
-                ss << u8"    \"Key\": \"ModStr6d\",\n";
-                ss << u8"    \"enUS\": \"Hit Blinds Target\",\n";
-                ss << u8"    \"zhTW\": \"擊中使目標目盲\",\n";
-                ss << u8"    \"deDE\": \"Treffer blendet Ziel\",\n";
-                ss << u8"    \"esES\": \"Los golpes ciegan al objetivo\",\n";
-                ss << u8"    \"frFR\": \"Toucher la cible l’aveugle\",\n";
-                ss << u8"    \"itIT\": \"Acceca il bersaglio\",\n";
-                ss << u8"    \"koKR\": \"적중 시 대상 실명\",\n";
-                ss << u8"    \"plPL\": \"Trafienie oślepia cel\",\n";
-                ss << u8"    \"esMX\": \"Golpear al objetivo lo ciega\",\n";
-                ss << u8"    \"jaJP\": \"攻撃命中でターゲットを目つぶし\",\n";
-                ss << u8"    \"ptBR\": \"Acerto cega o alvo\",\n";
-                ss << u8"    \"ruRU\": \"При ударе ослепляет цель\",\n";
-                ss << u8"    \"zhCN\": \"命中可致盲目标\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11080,\n";
-                ss << u8"    \"Key\": \"ExInsertSocketsX\",\n";
-                ss << u8"    \"enUS\": \"Can be Inserted into Socketed Items\",\n";
-                ss << u8"    \"zhTW\": \"可以放入有鑲孔的物品\",\n";
-                ss << u8"    \"deDE\": \"Anbringung möglich an gesockelten Gegenständen.\",\n";
-                ss << u8"    \"esES\": \"Se puede insertar en objetos con huecos\",\n";
-                ss << u8"    \"frFR\": \"Peut être enchâssé(e) dans les objets avec châsse\",\n";
-                ss << u8"    \"itIT\": \"Si può inserire negli oggetti con castone\",\n";
-                ss << u8"    \"koKR\": \"홈이 있는 아이템에 삽입 가능\",\n";
-                ss << u8"    \"plPL\": \"Można umieścić w przedmiotach z gniazdami\",\n";
-                ss << u8"    \"esMX\": \"Puede insertarse en objetos engarzados\",\n";
-                ss << u8"    \"jaJP\": \"ソケット付きのアイテムに装着可能\",\n";
-                ss << u8"    \"ptBR\": \"Pode ser inserido em itens com engastes\",\n";
-                ss << u8"    \"ruRU\": \"Можно вставить в гнездо\",\n";
-                ss << u8"    \"zhCN\": \"可以被插入有镶孔的物品中\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11091,\n";
-                ss << u8"    \"Key\": \"increaseswithplaylevelX\",\n";
-                ss << u8"    \"enUS\": \"(Based on Character Level)\",\n";
-                ss << u8"    \"zhTW\": \"（依角色等級而定）\",\n";
-                ss << u8"    \"deDE\": \"(Basierend auf Charakterstufe)\",\n";
-                ss << u8"    \"esES\": \"(según el nivel del personaje)\",\n";
-                ss << u8"    \"frFR\": \"(Selon niv. du perso.)\",\n";
-                ss << u8"    \"itIT\": \"(Si basa sul livello del personaggio)\",\n";
-                ss << u8"    \"koKR\": \"(캐릭터 레벨에 비례)\",\n";
-                ss << u8"    \"plPL\": \"(zależy od poziomu postaci)\",\n";
-                ss << u8"    \"esMX\": \"(Según el nivel del personaje)\",\n";
-                ss << u8"    \"jaJP\": \"（キャラクターレベルに依存）\",\n";
-                ss << u8"    \"ptBR\": \"(Com base no nível de personagem)\",\n";
-                ss << u8"    \"ruRU\": \"(зависит от уровня персонажа)\",\n";
-                ss << u8"    \"zhCN\": \"(基于角色等级)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11158,\n";
-                ss << u8"    \"Key\": \"ModStre8b\",\n";
-                ss << u8"    \"enUS\": \"%+d to Assassin Skill Levels\",\n";
-                ss << u8"    \"zhTW\": \"%+d 刺客技能等級\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Assassinenfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los niveles de habilidad de la asesina\",\n";
-                ss << u8"    \"frFR\": \"%+d aux niv. de compétence d’Assassin\",\n";
-                ss << u8"    \"itIT\": \"%+d alle abilità dell'Assassina\",\n";
-                ss << u8"    \"koKR\": \"암살자 기술 레벨 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności zabójczyni\",\n";
-                ss << u8"    \"esMX\": \"%+d a los niveles de habilidad de la Asesina\",\n";
-                ss << u8"    \"jaJP\": \"〈アサシン〉スキルレベル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de níveis de habilidade de Assassina\",\n";
-                ss << u8"    \"ruRU\": \"%+d к уровню умений ассасина\",\n";
-                ss << u8"    \"zhCN\": \"%+d 刺客技能等级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11163,\n";
-                ss << u8"    \"Key\": \"toa\",\n";
-                ss << u8"    \"enUS\": \"Token of Absolution\",\n";
-                ss << u8"    \"zhTW\": \"赦免徽章\",\n";
-                ss << u8"    \"deDE\": \"Zeichen der Absolution\",\n";
-                ss << u8"    \"esES\": \"Muestra de absolución\",\n";
-                ss << u8"    \"frFR\": \"Gage d’absolution\",\n";
-                ss << u8"    \"itIT\": \"Gettone dell'Assoluzione\",\n";
-                ss << u8"    \"koKR\": \"면죄의 징표\",\n";
-                ss << u8"    \"plPL\": \"Znak Rozgrzeszenia\",\n";
-                ss << u8"    \"esMX\": \"Insignia de la absolución\",\n";
-                ss << u8"    \"jaJP\": \"赦しのトークン\",\n";
-                ss << u8"    \"ptBR\": \"Insígnia da Absolvição\",\n";
-                ss << u8"    \"ruRU\": \"Талисман очищения\",\n";
-                ss << u8"    \"zhCN\": \"赦免之证\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20438,\n";
-                ss << u8"    \"Key\": \"Charmdes\",\n";
-                ss << u8"    \"enUS\": \"Keep in Inventory to Gain Bonus\",\n";
-                ss << u8"    \"zhTW\": \"放在物品欄以獲得其加成效果\",\n";
-                ss << u8"    \"deDE\": \"Im Inventar behalten, um Bonus zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Guárdalo en el inventario para obtener un bonus\",\n";
-                ss << u8"    \"frFR\": \"À garder dans l’inventaire pour bénéficier du bonus\",\n";
-                ss << u8"    \"itIT\": \"Tieni nell'inventario per ottenere un bonus\",\n";
-                ss << u8"    \"koKR\": \"소지품에 보관 시 보너스 획득\",\n";
-                ss << u8"    \"plPL\": \"Aby aktywować właściwości, trzymaj przedmiot w ekwipunku\",\n";
-                ss << u8"    \"esMX\": \"Conservar en el Inventario para obtener la bonificación\",\n";
-                ss << u8"    \"jaJP\": \"所持品に入れることでボーナスが得られる\",\n";
-                ss << u8"    \"ptBR\": \"Manter no Inventário para ganhar bônus\",\n";
-                ss << u8"    \"ruRU\": \"Дает бонус при хранении в инвентаре\",\n";
-                ss << u8"    \"zhCN\": \"放在物品栏里以享受加成\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20439,\n";
-                ss << u8"    \"Key\": \"ice\",\n";
-                ss << u8"    \"enUS\": \"Malah's Potion\",\n";
-                ss << u8"    \"zhTW\": \"瑪拉的藥水\",\n";
-                ss << u8"    \"deDE\": \"Malahs Elixier\",\n";
-                ss << u8"    \"esES\": \"Poción de Malah\",\n";
-                ss << u8"    \"frFR\": \"Potion de Malah\",\n";
-                ss << u8"    \"itIT\": \"Pozione di Malah\",\n";
-                ss << u8"    \"koKR\": \"말라의 물약\",\n";
-                ss << u8"    \"plPL\": \"Mikstura Malah\",\n";
-                ss << u8"    \"esMX\": \"Poción de Malah\",\n";
-                ss << u8"    \"jaJP\": \"マラーのポーション\",\n";
-                ss << u8"    \"ptBR\": \"Poção de Malah\",\n";
-                ss << u8"    \"ruRU\": \"Зелье Маллы\",\n";
-                ss << u8"    \"zhCN\": \"马拉的药水\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21205,\n";
-                ss << u8"    \"Key\": \"ModStre8a\",\n";
-                ss << u8"    \"enUS\": \"%+d to Druid Skill Levels\",\n";
-                ss << u8"    \"zhTW\": \"%+d 德魯伊技能等級\",\n";
-                ss << u8"    \"deDE\": \"%+d zu Druidenfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"%+d a los niveles de habilidad del druida\",\n";
-                ss << u8"    \"frFR\": \"%+d aux niv. de comp. du druide\",\n";
-                ss << u8"    \"itIT\": \"%+d alle abilità del Druido\",\n";
-                ss << u8"    \"koKR\": \"드루이드 기술 레벨 %+d\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności druida\",\n";
-                ss << u8"    \"esMX\": \"%+d a los niveles de habilidad del Druida\",\n";
-                ss << u8"    \"jaJP\": \"〈ドルイド〉スキルレベル向上（%+d）\",\n";
-                ss << u8"    \"ptBR\": \"%+d de níveis de habilidade de Druida\",\n";
-                ss << u8"    \"ruRU\": \"%+d к уровню умений друида\",\n";
-                ss << u8"    \"zhCN\": \"%+d 德鲁伊技能等级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21207,\n";
-                ss << u8"    \"Key\": \"ModStre8c\",\n";
-                ss << u8"    \"enUS\": \" Sockets\",\n";
-                ss << u8"    \"zhTW\": \"鑲孔\",\n";
-                ss << u8"    \"deDE\": \" Sockelfassungen\",\n";
-                ss << u8"    \"esES\": \"Huecos\",\n";
-                ss << u8"    \"frFR\": \"Châsses\",\n";
-                ss << u8"    \"itIT\": \" Castoni\",\n";
-                ss << u8"    \"koKR\": \" 홈\",\n";
-                ss << u8"    \"plPL\": \" Gniazda\",\n";
-                ss << u8"    \"esMX\": \" Engarces\",\n";
-                ss << u8"    \"jaJP\": \" ソケット\",\n";
-                ss << u8"    \"ptBR\": \" engastes\",\n";
-                ss << u8"    \"ruRU\": \" Гнезда\",\n";
-                ss << u8"    \"zhCN\": \"镶孔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21208,\n";
-                ss << u8"    \"Key\": \"ModStre8d\",\n";
-                ss << u8"    \"enUS\": \" to Attack Rating vs. Demons\",\n";
-                ss << u8"    \"zhTW\": \"對惡魔的準確率\",\n";
-                ss << u8"    \"deDE\": \" zu Angriffswert gegen Dämonen\",\n";
-                ss << u8"    \"esES\": \"de índice de ataque contra demonios\",\n";
-                ss << u8"    \"frFR\": \" en attaque contre les démons\",\n";
-                ss << u8"    \"itIT\": \" indice d'attacco contro i demoni\",\n";
-                ss << u8"    \"koKR\": \" 악마에 대한 명중률\",\n";
-                ss << u8"    \"plPL\": \" do skuteczności ataku względem demonów\",\n";
-                ss << u8"    \"esMX\": \" de índice de ataque contra demonios\",\n";
-                ss << u8"    \"jaJP\": \" デーモンへの命中率 +\",\n";
-                ss << u8"    \"ptBR\": \" de taxa de ataque contra demônios\",\n";
-                ss << u8"    \"ruRU\": \" к рейтингу атаки против демонов\",\n";
-                ss << u8"    \"zhCN\": \"对恶魔的命中值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21209,\n";
-                ss << u8"    \"Key\": \"ModStre8e\",\n";
-                ss << u8"    \"enUS\": \" to Attack Rating vs. Undead\",\n";
-                ss << u8"    \"zhTW\": \"對不死怪物的準確率\",\n";
-                ss << u8"    \"deDE\": \" zu Angriffswert gegen Untote\",\n";
-                ss << u8"    \"esES\": \"de índice de ataque contra muertos vivientes\",\n";
-                ss << u8"    \"frFR\": \" en attaque contre les Morts-vivants\",\n";
-                ss << u8"    \"itIT\": \" indice d'attacco contro i non morti\",\n";
-                ss << u8"    \"koKR\": \" 언데드에 대한 명중률\",\n";
-                ss << u8"    \"plPL\": \" do skuteczności ataku względem nieumarłych\",\n";
-                ss << u8"    \"esMX\": \" de índice de ataque contra no muertos\",\n";
-                ss << u8"    \"jaJP\": \" アンデッドへの命中率 +\",\n";
-                ss << u8"    \"ptBR\": \" de taxa de ataque contra mortos-vivos\",\n";
-                ss << u8"    \"ruRU\": \" к рейтингу атаки против нежити\",\n";
-                ss << u8"    \"zhCN\": \"对亡灵的命中值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21210,\n";
-                ss << u8"    \"Key\": \"ModStre8f\",\n";
-                ss << u8"    \"enUS\": \" to Damage vs. Demons\",\n";
-                ss << u8"    \"zhTW\": \"對惡魔的傷害\",\n";
-                ss << u8"    \"deDE\": \" zu Schaden gegen Dämonen\",\n";
-                ss << u8"    \"esES\": \"de daño contra demonios\",\n";
-                ss << u8"    \"frFR\": \" de dégâts sur les démons\",\n";
-                ss << u8"    \"itIT\": \" danni contro i demoni\",\n";
-                ss << u8"    \"koKR\": \" 악마에게 주는 피해\",\n";
-                ss << u8"    \"plPL\": \" do obrażeń zadanych demonom\",\n";
-                ss << u8"    \"esMX\": \" de daño contra demonios\",\n";
-                ss << u8"    \"jaJP\": \" デーモンへのダメージ +\",\n";
-                ss << u8"    \"ptBR\": \" de dano contra demônios\",\n";
-                ss << u8"    \"ruRU\": \" к урону против демонов\",\n";
-                ss << u8"    \"zhCN\": \"对恶魔的伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21211,\n";
-                ss << u8"    \"Key\": \"ModStre8g\",\n";
-                ss << u8"    \"enUS\": \" percent to Attack Rating\",\n";
-                ss << u8"    \"zhTW\": \"% 準確率\",\n";
-                ss << u8"    \"deDE\": \"% zu Angriffswert\",\n";
-                ss << u8"    \"esES\": \"% de índice de ataque\",\n";
-                ss << u8"    \"frFR\": \" au pourcentage d’attaque\",\n";
-                ss << u8"    \"itIT\": \" % indice d'attacco\",\n";
-                ss << u8"    \"koKR\": \"% 명중률 상승\",\n";
-                ss << u8"    \"plPL\": \" procent do skuteczności ataku\",\n";
-                ss << u8"    \"esMX\": \" % de índice de ataque\",\n";
-                ss << u8"    \"jaJP\": \" %%の命中率上昇\",\n";
-                ss << u8"    \"ptBR\": \"% de taxa de ataque\",\n";
-                ss << u8"    \"ruRU\": \" % к рейтингу атаки\",\n";
-                ss << u8"    \"zhCN\": \"%到命中值\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21212,\n";
-                ss << u8"    \"Key\": \"ModStre8h\",\n";
-                ss << u8"    \"enUS\": \" to Javelin and Spear Skills\",\n";
-                ss << u8"    \"zhTW\": \"標槍與長矛技能\",\n";
-                ss << u8"    \"deDE\": \" zu Wurfspieß- und Speerfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades de jabalina y lanza\",\n";
-                ss << u8"    \"frFR\": \" aux comp. de javelot et lance\",\n";
-                ss << u8"    \"itIT\": \" alle abilità con Lance e giavellotti\",\n";
-                ss << u8"    \"koKR\": \" 투창과 창 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Oszczepu i Włóczni\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Jabalina y lanza\",\n";
-                ss << u8"    \"jaJP\": \" 〈ジャベリン/スピア〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Dardos e Lanças\",\n";
-                ss << u8"    \"ruRU\": \" к уровню умений «Дротики и копья»\",\n";
-                ss << u8"    \"zhCN\": \"至标枪和长矛技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21213,\n";
-                ss << u8"    \"Key\": \"ModStre8i\",\n";
-                ss << u8"    \"enUS\": \" to Passive and Magic Skills\",\n";
-                ss << u8"    \"zhTW\": \"被動與魔法技能\",\n";
-                ss << u8"    \"deDE\": \" zu passiven und magischen Fertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades pasivas y mágicas\",\n";
-                ss << u8"    \"frFR\": \" aux comp. passives et magiques\",\n";
-                ss << u8"    \"itIT\": \" alle Passive e magie\",\n";
-                ss << u8"    \"koKR\": \" 지속 효과와 마법 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Pasywnych i Magii\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Pasivas y magia\",\n";
-                ss << u8"    \"jaJP\": \" 〈常時発動/魔法〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Passivas e Magia\",\n";
-                ss << u8"    \"ruRU\": \" к пассивным и магическим умениям\",\n";
-                ss << u8"    \"zhCN\": \"至被动和魔法技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21214,\n";
-                ss << u8"    \"Key\": \"ModStre8j\",\n";
-                ss << u8"    \"enUS\": \" to Bow and Crossbow Skills\",\n";
-                ss << u8"    \"zhTW\": \"弓與弩技能\",\n";
-                ss << u8"    \"deDE\": \" zu Bogen- und Armbrustfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades de arco y ballesta\",\n";
-                ss << u8"    \"frFR\": \" aux comp. d’arc et d’arbalète\",\n";
-                ss << u8"    \"itIT\": \" alle abilità con Archi e balestre\",\n";
-                ss << u8"    \"koKR\": \" 활과 쇠뇌 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Łuku i Kuszy\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Arco y ballesta\",\n";
-                ss << u8"    \"jaJP\": \" 〈弓/クロスボウ〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Arcos e Bestas\",\n";
-                ss << u8"    \"ruRU\": \" к умениям «Луки и арбалеты»\",\n";
-                ss << u8"    \"zhCN\": \"至弓和弩技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21215,\n";
-                ss << u8"    \"Key\": \"ModStre8k\",\n";
-                ss << u8"    \"enUS\": \" to Defensive Aura Skills\",\n";
-                ss << u8"    \"zhTW\": \"防禦靈氣技能\",\n";
-                ss << u8"    \"deDE\": \" zu Defensivauren\",\n";
-                ss << u8"    \"esES\": \"a las auras defensivas\",\n";
-                ss << u8"    \"frFR\": \" aux comp. d’auras défensives\",\n";
-                ss << u8"    \"itIT\": \" alle Aure difensive\",\n";
-                ss << u8"    \"koKR\": \" 방어 오라 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Aur Defensywnych\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Auras defensivas\",\n";
-                ss << u8"    \"jaJP\": \" 〈防御オーラ〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Auras Defensivas\",\n";
-                ss << u8"    \"ruRU\": \" к уровню защитных аур\",\n";
-                ss << u8"    \"zhCN\": \"至防御光环技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21216,\n";
-                ss << u8"    \"Key\": \"ModStre8l\",\n";
-                ss << u8"    \"enUS\": \" to Offensive Aura Skills\",\n";
-                ss << u8"    \"zhTW\": \"攻擊靈氣技能\",\n";
-                ss << u8"    \"deDE\": \" zu Offensivauren\",\n";
-                ss << u8"    \"esES\": \"a las auras ofensivas\",\n";
-                ss << u8"    \"frFR\": \" aux comp. d’auras offensives\",\n";
-                ss << u8"    \"itIT\": \" alle Aure offensive\",\n";
-                ss << u8"    \"koKR\": \" 공격 오라 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Aur Ofensywnych\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Auras ofensivas\",\n";
-                ss << u8"    \"jaJP\": \" 〈攻撃オーラ〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Auras Ofensivas\",\n";
-                ss << u8"    \"ruRU\": \" к боевым аурам\",\n";
-                ss << u8"    \"zhCN\": \"至攻击光环技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21217,\n";
-                ss << u8"    \"Key\": \"ModStre8m\",\n";
-                ss << u8"    \"enUS\": \" to Combat Skills\",\n";
-                ss << u8"    \"zhTW\": \"戰鬥技能\",\n";
-                ss << u8"    \"deDE\": \" zu Kampffertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades de combate\",\n";
-                ss << u8"    \"frFR\": \" aux compétences de combat\",\n";
-                ss << u8"    \"itIT\": \" alle Abilità nel combattere\",\n";
-                ss << u8"    \"koKR\": \" 전투 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Walki\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Combate\",\n";
-                ss << u8"    \"jaJP\": \" 〈戦闘〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para Habilidades de Combate\",\n";
-                ss << u8"    \"ruRU\": \" к боевым умениям\",\n";
-                ss << u8"    \"zhCN\": \"至战斗技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21218,\n";
-                ss << u8"    \"Key\": \"ModStre8n\",\n";
-                ss << u8"    \"enUS\": \" to Summoning Skills\",\n";
-                ss << u8"    \"zhTW\": \"召喚技能\",\n";
-                ss << u8"    \"deDE\": \" zu Herbeirufungsfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades de invocación\",\n";
-                ss << u8"    \"frFR\": \" aux compétences d’invocation\",\n";
-                ss << u8"    \"itIT\": \" alle Magie di evocazione\",\n";
-                ss << u8"    \"koKR\": \" 소환 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Przywoływania\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Invocación\",\n";
-                ss << u8"    \"jaJP\": \" 〈召喚〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Evocação\",\n";
-                ss << u8"    \"ruRU\": \" к уровню умений «Прислужники»\",\n";
-                ss << u8"    \"zhCN\": \"至召唤术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21219,\n";
-                ss << u8"    \"Key\": \"ModStre8o\",\n";
-                ss << u8"    \"enUS\": \" to Poison and Bone Skills\",\n";
-                ss << u8"    \"zhTW\": \"毒素與骸骨技能\",\n";
-                ss << u8"    \"deDE\": \" zu Gift- und Knochenfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades de veneno y hueso\",\n";
-                ss << u8"    \"frFR\": \" aux compétences de Poison et d’os\",\n";
-                ss << u8"    \"itIT\": \" alle Magie di ossa e veleno\",\n";
-                ss << u8"    \"koKR\": \" 독과 뼈 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Trucizn i Kości\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Veneno y huesos\",\n";
-                ss << u8"    \"jaJP\": \" 〈ポイズン/ボーン〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Veneno e Ossos\",\n";
-                ss << u8"    \"ruRU\": \" к уровню умений «Яды и кости»\",\n";
-                ss << u8"    \"zhCN\": \"至毒素和白骨术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21220,\n";
-                ss << u8"    \"Key\": \"ModStre8p\",\n";
-                ss << u8"    \"enUS\": \" to Curses\",\n";
-                ss << u8"    \"zhTW\": \"詛咒\",\n";
-                ss << u8"    \"deDE\": \" zu Flüchen\",\n";
-                ss << u8"    \"esES\": \"a las maldiciones\",\n";
-                ss << u8"    \"frFR\": \" aux malédictions\",\n";
-                ss << u8"    \"itIT\": \" alle Maledizioni\",\n";
-                ss << u8"    \"koKR\": \" 저주 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Klątw\",\n";
-                ss << u8"    \"esMX\": \" a las Maldiciones\",\n";
-                ss << u8"    \"jaJP\": \" 〈呪い〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para Maldições\",\n";
-                ss << u8"    \"ruRU\": \" к уровню проклятий\",\n";
-                ss << u8"    \"zhCN\": \"至诅咒术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21221,\n";
-                ss << u8"    \"Key\": \"ModStre8q\",\n";
-                ss << u8"    \"enUS\": \" to Warcry Skills\",\n";
-                ss << u8"    \"zhTW\": \"戰吼技能\",\n";
-                ss << u8"    \"deDE\": \" zu Kriegsschreien\",\n";
-                ss << u8"    \"esES\": \"a los gritos de guerra\",\n";
-                ss << u8"    \"frFR\": \" aux comp. de cris de guerre\",\n";
-                ss << u8"    \"itIT\": \" alle Grida di guerra\",\n";
-                ss << u8"    \"koKR\": \" 함성 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Okrzyków\",\n";
-                ss << u8"    \"esMX\": \" a los Gritos de guerra\",\n";
-                ss << u8"    \"jaJP\": \" 〈雄叫び〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Grito de Guerra\",\n";
-                ss << u8"    \"ruRU\": \" к уровню боевых кличей\",\n";
-                ss << u8"    \"zhCN\": \"至呐喊技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21222,\n";
-                ss << u8"    \"Key\": \"ModStre8r\",\n";
-                ss << u8"    \"enUS\": \" to Combat Skills\",\n";
-                ss << u8"    \"zhTW\": \"戰鬥技能\",\n";
-                ss << u8"    \"deDE\": \" zu Kampffertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades de combate\",\n";
-                ss << u8"    \"frFR\": \" aux compétences de combat\",\n";
-                ss << u8"    \"itIT\": \" alle Abilità belliche\",\n";
-                ss << u8"    \"koKR\": \" 전투 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Zdolności Bojowych\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Combate\",\n";
-                ss << u8"    \"jaJP\": \" 〈戦闘〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para Habilidades de Combate\",\n";
-                ss << u8"    \"ruRU\": \" к боевым умениям\",\n";
-                ss << u8"    \"zhCN\": \"至战斗技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21223,\n";
-                ss << u8"    \"Key\": \"ModStre8s\",\n";
-                ss << u8"    \"enUS\": \" to Masteries Skills\",\n";
-                ss << u8"    \"zhTW\": \"戰鬥專精技能\",\n";
-                ss << u8"    \"deDE\": \" zu Beherrschungsfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a dominio del combate\",\n";
-                ss << u8"    \"frFR\": \" aux compétences de maîtrise\",\n";
-                ss << u8"    \"itIT\": \" ai Domini bellici\",\n";
-                ss << u8"    \"koKR\": \" 숙련 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Mistrzostw Bojowych\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Dominios\",\n";
-                ss << u8"    \"jaJP\": \" 〈武器術〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Maestrias\",\n";
-                ss << u8"    \"ruRU\": \" к умениям владения оружием\",\n";
-                ss << u8"    \"zhCN\": \"至精通类技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21224,\n";
-                ss << u8"    \"Key\": \"ModStre8t\",\n";
-                ss << u8"    \"enUS\": \" to Cold Skills\",\n";
-                ss << u8"    \"zhTW\": \"冰寒技能\",\n";
-                ss << u8"    \"deDE\": \" zu Kältefertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a los hechizos de frío\",\n";
-                ss << u8"    \"frFR\": \" aux compétences de Froid\",\n";
-                ss << u8"    \"itIT\": \" alle Magie del freddo\",\n";
-                ss << u8"    \"koKR\": \" 냉기 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Zimna\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Frío\",\n";
-                ss << u8"    \"jaJP\": \" 〈冷気〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Gelo\",\n";
-                ss << u8"    \"ruRU\": \" к умениям льда\",\n";
-                ss << u8"    \"zhCN\": \"至冰系法术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21225,\n";
-                ss << u8"    \"Key\": \"ModStre8u\",\n";
-                ss << u8"    \"enUS\": \" to Lightning Skills\",\n";
-                ss << u8"    \"zhTW\": \"閃電技能\",\n";
-                ss << u8"    \"deDE\": \" zu Blitzfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a los hechizos de rayos\",\n";
-                ss << u8"    \"frFR\": \" aux compétences de Foudre\",\n";
-                ss << u8"    \"itIT\": \" alle Magie del fulmine\",\n";
-                ss << u8"    \"koKR\": \" 번개 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Błyskawic\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Rayo\",\n";
-                ss << u8"    \"jaJP\": \" 〈電撃〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Eletricidade\",\n";
-                ss << u8"    \"ruRU\": \" к умениям молнии\",\n";
-                ss << u8"    \"zhCN\": \"至雷系法术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21226,\n";
-                ss << u8"    \"Key\": \"ModStre8v\",\n";
-                ss << u8"    \"enUS\": \" to Fire Skills\",\n";
-                ss << u8"    \"zhTW\": \"火焰技能\",\n";
-                ss << u8"    \"deDE\": \" zu Feuerfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a los hechizos de fuego\",\n";
-                ss << u8"    \"frFR\": \" aux compétences de Feu\",\n";
-                ss << u8"    \"itIT\": \" alle Magie del fuoco\",\n";
-                ss << u8"    \"koKR\": \" 화염 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Ognia\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Fuego\",\n";
-                ss << u8"    \"jaJP\": \" 〈火炎〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Fogo\",\n";
-                ss << u8"    \"ruRU\": \" к умениям огня\",\n";
-                ss << u8"    \"zhCN\": \"至火系法术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21227,\n";
-                ss << u8"    \"Key\": \"ModStre8w\",\n";
-                ss << u8"    \"enUS\": \" to Summoning Skills\",\n";
-                ss << u8"    \"zhTW\": \"召喚技能\",\n";
-                ss << u8"    \"deDE\": \" zu Herbeirufungsfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades de invocación\",\n";
-                ss << u8"    \"frFR\": \" aux comp. d’invocation\",\n";
-                ss << u8"    \"itIT\": \" alle Magie di evocazione\",\n";
-                ss << u8"    \"koKR\": \" 소환 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Przyzwania\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Invocación\",\n";
-                ss << u8"    \"jaJP\": \" 〈召喚〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Invocação\",\n";
-                ss << u8"    \"ruRU\": \" к уровню умений «Спутники»\",\n";
-                ss << u8"    \"zhCN\": \"至召唤技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21228,\n";
-                ss << u8"    \"Key\": \"ModStre8x\",\n";
-                ss << u8"    \"enUS\": \" to Shape-Shifting Skills\",\n";
-                ss << u8"    \"zhTW\": \"變形技能\",\n";
-                ss << u8"    \"deDE\": \" zu Gestaltwandlerfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades de cambio de forma\",\n";
-                ss << u8"    \"frFR\": \" aux comp. de métamorphose\",\n";
-                ss << u8"    \"itIT\": \" alle Abilità mutaforma\",\n";
-                ss << u8"    \"koKR\": \" 변신 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Zmiany Kształtu\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Metamorfosis\",\n";
-                ss << u8"    \"jaJP\": \" 〈変身〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Metamorfose\",\n";
-                ss << u8"    \"ruRU\": \" к умениям смены облика\",\n";
-                ss << u8"    \"zhCN\": \"至变形技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21229,\n";
-                ss << u8"    \"Key\": \"ModStre8y\",\n";
-                ss << u8"    \"enUS\": \" to Elemental Skills\",\n";
-                ss << u8"    \"zhTW\": \"元素技能\",\n";
-                ss << u8"    \"deDE\": \" zu Elementarfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las habilidades elementales\",\n";
-                ss << u8"    \"frFR\": \" aux comp. élémentaires\",\n";
-                ss << u8"    \"itIT\": \" alle Magie elementali\",\n";
-                ss << u8"    \"koKR\": \" 원소 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Żywiołów\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades Elementales\",\n";
-                ss << u8"    \"jaJP\": \" 〈自然の力〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Elementos\",\n";
-                ss << u8"    \"ruRU\": \" к уровню умений «Сила стихий»\",\n";
-                ss << u8"    \"zhCN\": \"至元素技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21230,\n";
-                ss << u8"    \"Key\": \"ModStre8z\",\n";
-                ss << u8"    \"enUS\": \" to Trap Skills\",\n";
-                ss << u8"    \"zhTW\": \"陷阱技能\",\n";
-                ss << u8"    \"deDE\": \" zu Fallenfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las trampas\",\n";
-                ss << u8"    \"frFR\": \" aux compétences de pièges\",\n";
-                ss << u8"    \"itIT\": \" alle Trappole\",\n";
-                ss << u8"    \"koKR\": \" 덫 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Pułapek\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Trampas\",\n";
-                ss << u8"    \"jaJP\": \" 〈トラップ〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Armadilhas\",\n";
-                ss << u8"    \"ruRU\": \" к ловушкам\",\n";
-                ss << u8"    \"zhCN\": \"至陷阱技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21231,\n";
-                ss << u8"    \"Key\": \"ModStre9a\",\n";
-                ss << u8"    \"enUS\": \" to Shadow Discipline Skills\",\n";
-                ss << u8"    \"zhTW\": \"暗影修行技能\",\n";
-                ss << u8"    \"deDE\": \" zu Schattendisziplinen\",\n";
-                ss << u8"    \"esES\": \"a la disciplina de las sombras\",\n";
-                ss << u8"    \"frFR\": \" aux comp. en discipline de l’Ombre\",\n";
-                ss << u8"    \"itIT\": \" alle Discipline dell'ombra\",\n";
-                ss << u8"    \"koKR\": \" 그림자 단련 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Dyscyplin Cienia\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Disciplinas de las sombras\",\n";
-                ss << u8"    \"jaJP\": \" 〈シャドウアーツ〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Disciplinas Sombrias\",\n";
-                ss << u8"    \"ruRU\": \" к теневым навыкам\",\n";
-                ss << u8"    \"zhCN\": \"至影身训练技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21232,\n";
-                ss << u8"    \"Key\": \"ModStre9b\",\n";
-                ss << u8"    \"enUS\": \" to Martial Art Skills\",\n";
-                ss << u8"    \"zhTW\": \"武學技藝技能\",\n";
-                ss << u8"    \"deDE\": \" zu Kampfkunstfertigkeiten\",\n";
-                ss << u8"    \"esES\": \"a las artes marciales\",\n";
-                ss << u8"    \"frFR\": \" aux comp. en arts martiaux\",\n";
-                ss << u8"    \"itIT\": \" alle Arti marziali\",\n";
-                ss << u8"    \"koKR\": \" 무술 기술 상승\",\n";
-                ss << u8"    \"plPL\": \" do umiejętności Sztuk Walki\",\n";
-                ss << u8"    \"esMX\": \" a las habilidades de Artes marciales\",\n";
-                ss << u8"    \"jaJP\": \" 〈マーシャルアーツ〉スキル +\",\n";
-                ss << u8"    \"ptBR\": \" para habilidades Artes Marciais\",\n";
-                ss << u8"    \"ruRU\": \" к умениям боевых искусств\",\n";
-                ss << u8"    \"zhCN\": \"至武学技艺技能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21233,\n";
-                ss << u8"    \"Key\": \"ModStre9c\",\n";
-                ss << u8"    \"enUS\": \"(Based on Character Level)\",\n";
-                ss << u8"    \"zhTW\": \"（依角色等級而定）\",\n";
-                ss << u8"    \"deDE\": \"(Basierend auf Charakterstufe)\",\n";
-                ss << u8"    \"esES\": \"(según el nivel del personaje)\",\n";
-                ss << u8"    \"frFR\": \"(Selon niv. du perso.)\",\n";
-                ss << u8"    \"itIT\": \"(Si basa sul livello del personaggio)\",\n";
-                ss << u8"    \"koKR\": \"(캐릭터 레벨에 비례)\",\n";
-                ss << u8"    \"plPL\": \"(Zależy od poziomu postaci)\",\n";
-                ss << u8"    \"esMX\": \"(Según el nivel del personaje)\",\n";
-                ss << u8"    \"jaJP\": \"（キャラクターレベルに依存）\",\n";
-                ss << u8"    \"ptBR\": \"(Com base no nível de personagem)\",\n";
-                ss << u8"    \"ruRU\": \"(В зависимости от уровня персонажа)\",\n";
-                ss << u8"    \"zhCN\": \"(基于角色等级)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21234,\n";
-                ss << u8"    \"Key\": \"ModStre9d\",\n";
-                ss << u8"    \"enUS\": \"%s (Increases During Nighttime)\",\n";
-                ss << u8"    \"zhTW\": \"%s（在夜間增加）\",\n";
-                ss << u8"    \"deDE\": \"%s (Nimmt während der Nacht zu.)\",\n";
-                ss << u8"    \"esES\": \"%s (aumenta durante la noche)\",\n";
-                ss << u8"    \"frFR\": \"%s (augmente de nuit)\",\n";
-                ss << u8"    \"itIT\": \"%s (Aumenta di notte)\",\n";
-                ss << u8"    \"koKR\": \"%s (밤에 증가)\",\n";
-                ss << u8"    \"plPL\": \"%s (zwiększa się w nocy)\",\n";
-                ss << u8"    \"esMX\": \"%s (Aumenta durante la noche)\",\n";
-                ss << u8"    \"jaJP\": \"%s（夜間に上昇）\",\n";
-                ss << u8"    \"ptBR\": \"%s (aumenta durante a noite)\",\n";
-                ss << u8"    \"ruRU\": \"%s (повышается ночью)\",\n";
-                ss << u8"    \"zhCN\": \"%s (在夜间提高)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21235,\n";
-                ss << u8"    \"Key\": \"ModStre9e\",\n";
-                ss << u8"    \"enUS\": \"%s (Increases During Daytime)\",\n";
-                ss << u8"    \"zhTW\": \"%s（在白天增加）\",\n";
-                ss << u8"    \"deDE\": \"%s (Nimmt während des Tages zu.)\",\n";
-                ss << u8"    \"esES\": \"%s (aumenta durante el día)\",\n";
-                ss << u8"    \"frFR\": \"%s (augmente de jour)\",\n";
-                ss << u8"    \"itIT\": \"%s (Aumenta di giorno)\",\n";
-                ss << u8"    \"koKR\": \"%s (낮에 증가)\",\n";
-                ss << u8"    \"plPL\": \"%s (zwiększa się w ciągu dnia)\",\n";
-                ss << u8"    \"esMX\": \"%s (Aumenta durante el día)\",\n";
-                ss << u8"    \"jaJP\": \"%s（日中に上昇）\",\n";
-                ss << u8"    \"ptBR\": \"%s (aumenta durante o dia)\",\n";
-                ss << u8"    \"ruRU\": \"%s (повышается днем)\",\n";
-                ss << u8"    \"zhCN\": \"%s (在白天提高)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21236,\n";
-                ss << u8"    \"Key\": \"ModStre9f\",\n";
-                ss << u8"    \"enUS\": \"%s (Increases Near Dawn)\",\n";
-                ss << u8"    \"zhTW\": \"%s（在黎明增加）\",\n";
-                ss << u8"    \"deDE\": \"%s (Nimmt bei Morgendämmerung zu.)\",\n";
-                ss << u8"    \"esES\": \"%s (aumenta en torno al amanecer)\",\n";
-                ss << u8"    \"frFR\": \"%s (augmente à l’aube)\",\n";
-                ss << u8"    \"itIT\": \"%s (Aumenta all'alba)\",\n";
-                ss << u8"    \"koKR\": \"%s (새벽에 증가)\",\n";
-                ss << u8"    \"plPL\": \"%s (zwiększa się o świcie)\",\n";
-                ss << u8"    \"esMX\": \"%s (Aumenta cerca del alba)\",\n";
-                ss << u8"    \"jaJP\": \"%s（夜明け近くに上昇）\",\n";
-                ss << u8"    \"ptBR\": \"%s (aumenta perto do amanhecer)\",\n";
-                ss << u8"    \"ruRU\": \"%s (повышается на рассвете)\",\n";
-                ss << u8"    \"zhCN\": \"%s (黎明时提高)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21237,\n";
-                ss << u8"    \"Key\": \"ModStre9g\",\n";
-                ss << u8"    \"enUS\": \"%s (Increases Near Dusk)\",\n";
-                ss << u8"    \"zhTW\": \"%s（在黃昏增加）\",\n";
-                ss << u8"    \"deDE\": \"%s (Nimmt bei Abenddämmerung zu.)\",\n";
-                ss << u8"    \"esES\": \"%s (aumenta en torno al anochecer)\",\n";
-                ss << u8"    \"frFR\": \"%s (augmente au crépuscule)\",\n";
-                ss << u8"    \"itIT\": \"%s (Aumenta al crepuscolo)\",\n";
-                ss << u8"    \"koKR\": \"%s (해 질 녘에 증가)\",\n";
-                ss << u8"    \"plPL\": \"%s (zwiększa się o zmierzchu)\",\n";
-                ss << u8"    \"esMX\": \"%s (Aumenta cerca del crepúsculo)\",\n";
-                ss << u8"    \"jaJP\": \"%s（日没近くに上昇）\",\n";
-                ss << u8"    \"ptBR\": \"%s (aumenta perto do entardecer)\",\n";
-                ss << u8"    \"ruRU\": \"%s (повышается в сумерки)\",\n";
-                ss << u8"    \"zhCN\": \"%s (黄昏时提高)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21238,\n";
-                ss << u8"    \"Key\": \"ModStre9h\",\n";
-                ss << u8"    \"enUS\": \" Charges of\",\n";
-                ss << u8"    \"zhTW\": \"次的\",\n";
-                ss << u8"    \"deDE\": \" Ladungen von\",\n";
-                ss << u8"    \"esES\": \"Cargas de\",\n";
-                ss << u8"    \"frFR\": \" Charges de\",\n";
-                ss << u8"    \"itIT\": \" Cariche di\",\n";
-                ss << u8"    \"koKR\": \"회 충전:\",\n";
-                ss << u8"    \"plPL\": \" Ładunki:\",\n";
-                ss << u8"    \"esMX\": \" Cargas de\",\n";
-                ss << u8"    \"jaJP\": \" 回使用可能:\",\n";
-                ss << u8"    \"ptBR\": \" cargas de\",\n";
-                ss << u8"    \"ruRU\": \" зарядов\",\n";
-                ss << u8"    \"zhCN\": \"的充能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21239,\n";
-                ss << u8"    \"Key\": \"ModStre9i\",\n";
-                ss << u8"    \"enUS\": \"Increased Stack Size\",\n";
-                ss << u8"    \"zhTW\": \"堆疊數量提高\",\n";
-                ss << u8"    \"deDE\": \"Erhöhte Stapelgröße\",\n";
-                ss << u8"    \"esES\": \"Cantidad aumentada\",\n";
-                ss << u8"    \"frFR\": \"Quantité maximale augmentée\",\n";
-                ss << u8"    \"itIT\": \"Accumuli aumentati\",\n";
-                ss << u8"    \"koKR\": \"중첩 수량 증가\",\n";
-                ss << u8"    \"plPL\": \"Zwiększona liczba\",\n";
-                ss << u8"    \"esMX\": \"Mayor cantidad de proyectiles\",\n";
-                ss << u8"    \"jaJP\": \"所持数増加\",\n";
-                ss << u8"    \"ptBR\": \"Quantidade de pilha adicional\",\n";
-                ss << u8"    \"ruRU\": \"Больше снарядов\",\n";
-                ss << u8"    \"zhCN\": \"增加堆叠数量\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21240,\n";
-                ss << u8"    \"Key\": \"ModStre9s\",\n";
-                ss << u8"    \"enUS\": \"Indestructible\",\n";
-                ss << u8"    \"zhTW\": \"永不毀損\",\n";
-                ss << u8"    \"deDE\": \"Unzerstörbar\",\n";
-                ss << u8"    \"esES\": \"Indestructible\",\n";
-                ss << u8"    \"frFR\": \"Indestructible\",\n";
-                ss << u8"    \"itIT\": \"Indistruttibile\",\n";
-                ss << u8"    \"koKR\": \"파괴 불가\",\n";
-                ss << u8"    \"plPL\": \"Przedmiot niezniszczalny\",\n";
-                ss << u8"    \"esMX\": \"Indestructible\",\n";
-                ss << u8"    \"jaJP\": \"壊れない\",\n";
-                ss << u8"    \"ptBR\": \"Indestrutível\",\n";
-                ss << u8"    \"ruRU\": \"Не теряет прочности\",\n";
-                ss << u8"    \"zhCN\": \"不可摧毁\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21241,\n";
-                ss << u8"    \"Key\": \"ModStre9t\",\n";
-                ss << u8"    \"enUS\": \"Repairs %d durability per second\",\n";
-                ss << u8"    \"zhTW\": \"每秒修復 %d 耐久度\",\n";
-                ss << u8"    \"deDE\": \"Repariert %d Haltbarkeit pro Sekunde\",\n";
-                ss << u8"    \"esES\": \"Repara %d p. de durabilidad por segundo\",\n";
-                ss << u8"    \"frFR\": \"Répare %d pts de durabilité par seconde\",\n";
-                ss << u8"    \"itIT\": \"Ripara %d integrità ogni secondo\",\n";
-                ss << u8"    \"koKR\": \"내구도 %d 회복 (매초)\",\n";
-                ss << u8"    \"plPL\": \"Przywraca %d pkt. trwałości na sekundę\",\n";
-                ss << u8"    \"esMX\": \"Repara %d de durabilidad por segundo\",\n";
-                ss << u8"    \"jaJP\": \"耐久力が回復（毎秒%d）\",\n";
-                ss << u8"    \"ptBR\": \"Repara %d de durabilidade por segundo\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет %d ед. прочности в секунду\",\n";
-                ss << u8"    \"zhCN\": \"每秒修复 %d 点耐久度\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21242,\n";
-                ss << u8"    \"Key\": \"ModStre9u\",\n";
-                ss << u8"    \"enUS\": \"Repairs %d durability in %d seconds\",\n";
-                ss << u8"    \"zhTW\": \"每 %1 秒修復 %0 點耐久度\",\n";
-                ss << u8"    \"deDE\": \"Repariert %d Haltbarkeit alle %d Sek.\",\n";
-                ss << u8"    \"esES\": \"Repara %d p. de durabilidad cada %d s\",\n";
-                ss << u8"    \"frFR\": \"Répare %d pts de durabilité en %d s\",\n";
-                ss << u8"    \"itIT\": \"Ripara %d integrità in %d s\",\n";
-                ss << u8"    \"koKR\": \"내구도 %d 회복 (%d초마다)\",\n";
-                ss << u8"    \"plPL\": \"Przywraca %d pkt. trwałości na %d sek.\",\n";
-                ss << u8"    \"esMX\": \"Repara %d de durabilidad en %d segundos\",\n";
-                ss << u8"    \"jaJP\": \"耐久力が回復（%d秒ごとに%d）\",\n";
-                ss << u8"    \"ptBR\": \"Repara %d de durabilidade em %d segundos\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет %d ед. прочности раз в %d сек.\",\n";
-                ss << u8"    \"zhCN\": \"每 %1 秒修复 %0 点耐久度\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21243,\n";
-                ss << u8"    \"Key\": \"ModStre9v\",\n";
-                ss << u8"    \"enUS\": \"Replenishes quantity\",\n";
-                ss << u8"    \"zhTW\": \"回復數量\",\n";
-                ss << u8"    \"deDE\": \"Füllt die Menge auf\",\n";
-                ss << u8"    \"esES\": \"Repone la cantidad\",\n";
-                ss << u8"    \"frFR\": \"Auto-approvisionnement\",\n";
-                ss << u8"    \"itIT\": \"Riporta al massimo la quantità\",\n";
-                ss << u8"    \"koKR\": \"수량 자동 회복\",\n";
-                ss << u8"    \"plPL\": \"Odnawia zasoby\",\n";
-                ss << u8"    \"esMX\": \"Recupera cantidad\",\n";
-                ss << u8"    \"jaJP\": \"数量が自動回復\",\n";
-                ss << u8"    \"ptBR\": \"Reabastece a quantidade\",\n";
-                ss << u8"    \"ruRU\": \"Восполняет снаряды\",\n";
-                ss << u8"    \"zhCN\": \"补充数量\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21244,\n";
-                ss << u8"    \"Key\": \"ModStre9w\",\n";
-                ss << u8"    \"enUS\": \"Cast a Level %d\",\n";
-                ss << u8"    \"zhTW\": \"施展等級 %d\",\n";
-                ss << u8"    \"deDE\": \"wirkt einen Stufe %d\",\n";
-                ss << u8"    \"esES\": \"Lanza (nivel %d):\",\n";
-                ss << u8"    \"frFR\": \"Lance au niveau %d\",\n";
-                ss << u8"    \"itIT\": \"di lanciare a livello %d\",\n";
-                ss << u8"    \"koKR\": \"시전: %d 레벨\",\n";
-                ss << u8"    \"plPL\": \"Rzuca poziom %d\",\n";
-                ss << u8"    \"esMX\": \"Lanzamiento nivel %d de\",\n";
-                ss << u8"    \"jaJP\": \"発動: レベル%d\",\n";
-                ss << u8"    \"ptBR\": \"Lança habilidade de nível %d\",\n";
-                ss << u8"    \"ruRU\": \"Применяет %d-го уровня\",\n";
-                ss << u8"    \"zhCN\": \"施放%d级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21245,\n";
-                ss << u8"    \"Key\": \"ModStre9x\",\n";
-                ss << u8"    \"enUS\": \"When You Swing\",\n";
-                ss << u8"    \"zhTW\": \"當你揮舞時\",\n";
-                ss << u8"    \"deDE\": \"Beim Angriff\",\n";
-                ss << u8"    \"esES\": \"Cuando atacas\",\n";
-                ss << u8"    \"frFR\": \"Quand vous frappez\",\n";
-                ss << u8"    \"itIT\": \"Quando attacchi\",\n";
-                ss << u8"    \"koKR\": \"휘두를 때\",\n";
-                ss << u8"    \"plPL\": \"Podczas atakowania\",\n";
-                ss << u8"    \"esMX\": \"Cuando golpeas\",\n";
-                ss << u8"    \"jaJP\": \"武器を振ると\",\n";
-                ss << u8"    \"ptBR\": \"Ao golpear\",\n";
-                ss << u8"    \"ruRU\": \"Когда вы атакуете\",\n";
-                ss << u8"    \"zhCN\": \"当你挥舞\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21246,\n";
-                ss << u8"    \"Key\": \"ModStre9y\",\n";
-                ss << u8"    \"enUS\": \"When You Get Hit\",\n";
-                ss << u8"    \"zhTW\": \"當你被擊中時\",\n";
-                ss << u8"    \"deDE\": \"Wenn Ihr getroffen werdet\",\n";
-                ss << u8"    \"esES\": \"Cuando te golpean\",\n";
-                ss << u8"    \"frFR\": \"Quand vous êtes touché\",\n";
-                ss << u8"    \"itIT\": \"Quando vieni colpito\",\n";
-                ss << u8"    \"koKR\": \"적중당할 때\",\n";
-                ss << u8"    \"plPL\": \"Przy otrzymaniu trafienia\",\n";
-                ss << u8"    \"esMX\": \"Cuando te golpean\",\n";
-                ss << u8"    \"jaJP\": \"攻撃を受けると\",\n";
-                ss << u8"    \"ptBR\": \"Ao receber um golpe\",\n";
-                ss << u8"    \"ruRU\": \"Когда вас поражает противник\",\n";
-                ss << u8"    \"zhCN\": \"当你被击中时\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21247,\n";
-                ss << u8"    \"Key\": \"ModStre9z\",\n";
-                ss << u8"    \"enUS\": \"When You Hit an Enemy\",\n";
-                ss << u8"    \"zhTW\": \"當你擊中敵人時\",\n";
-                ss << u8"    \"deDE\": \"Wenn Ihr einen Gegner trefft\",\n";
-                ss << u8"    \"esES\": \"Cuando golpeas a un enemigo\",\n";
-                ss << u8"    \"frFR\": \"Quand vous touchez l’ennemi\",\n";
-                ss << u8"    \"itIT\": \"Quando colpisci un nemico\",\n";
-                ss << u8"    \"koKR\": \"적을 적중시킬 때\",\n";
-                ss << u8"    \"plPL\": \"Przy trafieniu przeciwnika\",\n";
-                ss << u8"    \"esMX\": \"Cuando golpeas a un enemigo\",\n";
-                ss << u8"    \"jaJP\": \"攻撃を当てると\",\n";
-                ss << u8"    \"ptBR\": \"Ao acertar um inimigo\",\n";
-                ss << u8"    \"ruRU\": \"Когда вы поразили противника\",\n";
-                ss << u8"    \"zhCN\": \"当你击中敌人时\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21248,\n";
-                ss << u8"    \"Key\": \"ModStre10a\",\n";
-                ss << u8"    \"enUS\": \"Charges\",\n";
-                ss << u8"    \"zhTW\": \"次\",\n";
-                ss << u8"    \"deDE\": \"Ladungen\",\n";
-                ss << u8"    \"esES\": \"Cargas\",\n";
-                ss << u8"    \"frFR\": \"Charges\",\n";
-                ss << u8"    \"itIT\": \"Cariche\",\n";
-                ss << u8"    \"koKR\": \"충전 횟수\",\n";
-                ss << u8"    \"plPL\": \"– liczba ładunków\",\n";
-                ss << u8"    \"esMX\": \"Cargas\",\n";
-                ss << u8"    \"jaJP\": \"回使用可能\",\n";
-                ss << u8"    \"ptBR\": \"Cargas\",\n";
-                ss << u8"    \"ruRU\": \"Заряды\",\n";
-                ss << u8"    \"zhCN\": \"充能\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21249,\n";
-                ss << u8"    \"Key\": \"ModStre10b\",\n";
-                ss << u8"    \"enUS\": \"Level\",\n";
-                ss << u8"    \"zhTW\": \"等級\",\n";
-                ss << u8"    \"deDE\": \"Stufe\",\n";
-                ss << u8"    \"esES\": \"Nivel\",\n";
-                ss << u8"    \"frFR\": \"Niveau\",\n";
-                ss << u8"    \"itIT\": \"Livello\",\n";
-                ss << u8"    \"koKR\": \"레벨\",\n";
-                ss << u8"    \"plPL\": \"Poziom\",\n";
-                ss << u8"    \"esMX\": \"Nivel\",\n";
-                ss << u8"    \"jaJP\": \"レベル\",\n";
-                ss << u8"    \"ptBR\": \"Nível\",\n";
-                ss << u8"    \"ruRU\": \"Уровень\",\n";
-                ss << u8"    \"zhCN\": \"等级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21250,\n";
-                ss << u8"    \"Key\": \"ModStre10c\",\n";
-                ss << u8"    \"enUS\": \"Per Level\",\n";
-                ss << u8"    \"zhTW\": \"每級\",\n";
-                ss << u8"    \"deDE\": \"Pro Stufe\",\n";
-                ss << u8"    \"esES\": \"Por nivel\",\n";
-                ss << u8"    \"frFR\": \"par niveau\",\n";
-                ss << u8"    \"itIT\": \"per livello\",\n";
-                ss << u8"    \"koKR\": \"레벨당\",\n";
-                ss << u8"    \"plPL\": \"Na poziom\",\n";
-                ss << u8"    \"esMX\": \"Por nivel\",\n";
-                ss << u8"    \"jaJP\": \"（レベルごと）\",\n";
-                ss << u8"    \"ptBR\": \"Por nível\",\n";
-                ss << u8"    \"ruRU\": \"За каждый уровень\",\n";
-                ss << u8"    \"zhCN\": \"每级\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21251,\n";
-                ss << u8"    \"Key\": \"ModStre10d\",\n";
-                ss << u8"    \"enUS\": \"Level %d %s (%d/%d Charges)\",\n";
-                ss << u8"    \"zhTW\": \"等級 %d %s（%d/%d 次）\",\n";
-                ss << u8"    \"deDE\": \"Stufe %d %s (%d/%d Ladungen)\",\n";
-                ss << u8"    \"esES\": \"%1 de nivel %0 (%2/%3 cargas)\",\n";
-                ss << u8"    \"frFR\": \"Niveau %d %s (%d/%d charges)\",\n";
-                ss << u8"    \"itIT\": \"Livello %d %s (%d/%d cariche)\",\n";
-                ss << u8"    \"koKR\": \"%d 레벨 %s (충전 %d/%d회)\",\n";
-                ss << u8"    \"plPL\": \"%1: Poziom %0 (%2/%3)\",\n";
-                ss << u8"    \"esMX\": \"%1 nivel %0 (cargas: %2/%3)\",\n";
-                ss << u8"    \"jaJP\": \"レベル%0〈%1〉（使用可能数 %2/%3）\",\n";
-                ss << u8"    \"ptBR\": \"%1 Nível %0 (%2/%3 cargas)\",\n";
-                ss << u8"    \"ruRU\": \"«%1» %0-го уровня (%2/%3 зарядов)\",\n";
-                ss << u8"    \"zhCN\": \"%d级%s (%d/%d 次充能)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21252,\n";
-                ss << u8"    \"Key\": \"ModStre10e\",\n";
-                ss << u8"    \"enUS\": \"(\",\n";
-                ss << u8"    \"zhTW\": \"（\",\n";
-                ss << u8"    \"deDE\": \"(\",\n";
-                ss << u8"    \"esES\": \"(\",\n";
-                ss << u8"    \"frFR\": \"(\",\n";
-                ss << u8"    \"itIT\": \"(\",\n";
-                ss << u8"    \"koKR\": \"(\",\n";
-                ss << u8"    \"plPL\": \"(\",\n";
-                ss << u8"    \"esMX\": \"(\",\n";
-                ss << u8"    \"jaJP\": \"（\",\n";
-                ss << u8"    \"ptBR\": \"(\",\n";
-                ss << u8"    \"ruRU\": \"(\",\n";
-                ss << u8"    \"zhCN\": \"(\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21253,\n";
-                ss << u8"    \"Key\": \"ModStre10f\",\n";
-                ss << u8"    \"enUS\": \")\",\n";
-                ss << u8"    \"zhTW\": \"）\",\n";
-                ss << u8"    \"deDE\": \")\",\n";
-                ss << u8"    \"esES\": \")\",\n";
-                ss << u8"    \"frFR\": \")\",\n";
-                ss << u8"    \"itIT\": \")\",\n";
-                ss << u8"    \"koKR\": \")\",\n";
-                ss << u8"    \"plPL\": \")\",\n";
-                ss << u8"    \"esMX\": \")\",\n";
-                ss << u8"    \"jaJP\": \"）\",\n";
-                ss << u8"    \"ptBR\": \")\",\n";
-                ss << u8"    \"ruRU\": \")\",\n";
-                ss << u8"    \"zhCN\": \")\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21254,\n";
-                ss << u8"    \"Key\": \"ModStre10g\",\n";
-                ss << u8"    \"enUS\": \"Stealth\",\n";
-                ss << u8"    \"zhTW\": \"隱密\",\n";
-                ss << u8"    \"deDE\": \"Verstohlenheit\",\n";
-                ss << u8"    \"esES\": \"Sigilo\",\n";
-                ss << u8"    \"frFR\": \"Discrétion\",\n";
-                ss << u8"    \"itIT\": \"Furtività\",\n";
-                ss << u8"    \"koKR\": \"은폐\",\n";
-                ss << u8"    \"plPL\": \"Skradanie\",\n";
-                ss << u8"    \"esMX\": \"Sigilo\",\n";
-                ss << u8"    \"jaJP\": \"隠密\",\n";
-                ss << u8"    \"ptBR\": \"Furtividade\",\n";
-                ss << u8"    \"ruRU\": \"Скрытность\",\n";
-                ss << u8"    \"zhCN\": \"潜行\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21255,\n";
-                ss << u8"    \"Key\": \"ModStre10h\",\n";
-                ss << u8"    \"enUS\": \"Immunity to Poison\",\n";
-                ss << u8"    \"zhTW\": \"毒素免疫\",\n";
-                ss << u8"    \"deDE\": \"Giftimmunität\",\n";
-                ss << u8"    \"esES\": \"Inmunidad al veneno\",\n";
-                ss << u8"    \"frFR\": \"Immunité au Poison\",\n";
-                ss << u8"    \"itIT\": \"Immunità al veleno\",\n";
-                ss << u8"    \"koKR\": \"독 면역\",\n";
-                ss << u8"    \"plPL\": \"Niewrażliwość na trucizny\",\n";
-                ss << u8"    \"esMX\": \"Inmunidad al veneno\",\n";
-                ss << u8"    \"jaJP\": \"毒無効化\",\n";
-                ss << u8"    \"ptBR\": \"Imunidade a veneno\",\n";
-                ss << u8"    \"ruRU\": \"Невосприимчивость к яду\",\n";
-                ss << u8"    \"zhCN\": \"免疫毒素\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21256,\n";
-                ss << u8"    \"Key\": \"ModStre10i\",\n";
-                ss << u8"    \"enUS\": \"Cursed\",\n";
-                ss << u8"    \"zhTW\": \"受詛咒\",\n";
-                ss << u8"    \"deDE\": \"Verflucht\",\n";
-                ss << u8"    \"esES\": \"Maldición\",\n";
-                ss << u8"    \"frFR\": \"[ms]maudit[fs]maudite[mp]maudits[fp]maudites\",\n";
-                ss << u8"    \"itIT\": \"Maledizioni\",\n";
-                ss << u8"    \"koKR\": \"저주받음\",\n";
-                ss << u8"    \"plPL\": \"Przekleństwo\",\n";
-                ss << u8"    \"esMX\": \"[ms]Maldecido[fs]Maldecida[mp]Maldecidos[fp]Maldecidas\",\n";
-                ss << u8"    \"jaJP\": \"呪い\",\n";
-                ss << u8"    \"ptBR\": \"Amaldiçoado\",\n";
-                ss << u8"    \"ruRU\": \"[ms]отверженный[fs]отверженная[ns]отверженное[pl]отверженные\",\n";
-                ss << u8"    \"zhCN\": \"被诅咒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21257,\n";
-                ss << u8"    \"Key\": \"ModStre10j\",\n";
-                ss << u8"    \"enUS\": \"Per Player in Party\",\n";
-                ss << u8"    \"zhTW\": \"隊伍中的每個人\",\n";
-                ss << u8"    \"deDE\": \"Pro Spieler in Gruppe\",\n";
-                ss << u8"    \"esES\": \"Por jugador en el grupo\",\n";
-                ss << u8"    \"frFR\": \"par joueur dans le groupe\",\n";
-                ss << u8"    \"itIT\": \"per giocatore nel gruppo\",\n";
-                ss << u8"    \"koKR\": \"파티 내의 플레이어 인당\",\n";
-                ss << u8"    \"plPL\": \"Na gracza w drużynie\",\n";
-                ss << u8"    \"esMX\": \"Por jugador en equipo\",\n";
-                ss << u8"    \"jaJP\": \"（パーティーのプレイヤー人数分）\",\n";
-                ss << u8"    \"ptBR\": \"Por jogador no grupo\",\n";
-                ss << u8"    \"ruRU\": \"За каждого игрока в группе\",\n";
-                ss << u8"    \"zhCN\": \"队伍中的每名队员\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21258,\n";
-                ss << u8"    \"Key\": \"WeaponDescH2H\",\n";
-                ss << u8"    \"enUS\": \"Claw Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"爪類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Klauenklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de garra: %s\",\n";
-                ss << u8"    \"frFR\": \"Type de griffes - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe artiglio - %s\",\n";
-                ss << u8"    \"koKR\": \"손톱 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa szponów – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: Garra - %s\",\n";
-                ss << u8"    \"jaJP\": \"鉤爪タイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe garra - %s\",\n";
-                ss << u8"    \"ruRU\": \"Когти – %s\",\n";
-                ss << u8"    \"zhCN\": \"利爪类 - %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21259,\n";
-                ss << u8"    \"Key\": \"WeaponDescOrb\",\n";
-                ss << u8"    \"enUS\": \"Orb Class - %s\",\n";
-                ss << u8"    \"zhTW\": \"法珠類武器 - %s\",\n";
-                ss << u8"    \"deDE\": \"Kugelklasse - %s\",\n";
-                ss << u8"    \"esES\": \"Tipo de orbe: %s\",\n";
-                ss << u8"    \"frFR\": \"Type d’orbe - %s\",\n";
-                ss << u8"    \"itIT\": \"Classe sfera - %s\",\n";
-                ss << u8"    \"koKR\": \"보주 계열 - %s\",\n";
-                ss << u8"    \"plPL\": \"Klasa kul – %s\",\n";
-                ss << u8"    \"esMX\": \"Tipo: orbe - %s\",\n";
-                ss << u8"    \"jaJP\": \"オーブタイプ - %s\",\n";
-                ss << u8"    \"ptBR\": \"Classe orbe - %s\",\n";
-                ss << u8"    \"ruRU\": \"Сфера – %s\",\n";
-                ss << u8"    \"zhCN\": \"法球类- %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21260,\n";
-                ss << u8"    \"Key\": \"ItemexpED\",\n";
-                ss << u8"    \"enUS\": \" Elemental Damage\",\n";
-                ss << u8"    \"zhTW\": \"元素傷害\",\n";
-                ss << u8"    \"deDE\": \" Elementarschaden\",\n";
-                ss << u8"    \"esES\": \"Daño elemental\",\n";
-                ss << u8"    \"frFR\": \"Dégâts élémentaires\",\n";
-                ss << u8"    \"itIT\": \" Danni elementali\",\n";
-                ss << u8"    \"koKR\": \" 원소 피해\",\n";
-                ss << u8"    \"plPL\": \" Obrażenia od żywiołów\",\n";
-                ss << u8"    \"esMX\": \" Daño elemental\",\n";
-                ss << u8"    \"jaJP\": \" 属性ダメージ\",\n";
-                ss << u8"    \"ptBR\": \" de dano elemental\",\n";
-                ss << u8"    \"ruRU\": \" урона от стихий\",\n";
-                ss << u8"    \"zhCN\": \"元素伤害\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21782,\n";
-                ss << u8"    \"Key\": \"ModStre10k\",\n";
-                ss << u8"    \"enUS\": \"Kick Damage: %d to %d\",\n";
-                ss << u8"    \"zhTW\": \"踢擊傷害：%d - %d 點\",\n";
-                ss << u8"    \"deDE\": \"Trittschaden: %d bis %d\",\n";
-                ss << u8"    \"esES\": \"Daño de patada: %d-%d p.\",\n";
-                ss << u8"    \"frFR\": \"Dégâts du coup de pied : %d à %d\",\n";
-                ss << u8"    \"itIT\": \"Danni da calcio: %d-%d\",\n";
-                ss << u8"    \"koKR\": \"발차기 피해: %d - %d\",\n";
-                ss << u8"    \"plPL\": \"Obrażenia od kopnięcia: %d-%d\",\n";
-                ss << u8"    \"esMX\": \"Daño por patada: %d a %d\",\n";
-                ss << u8"    \"jaJP\": \"キックダメージ: %d - %d\",\n";
-                ss << u8"    \"ptBR\": \"Dano de chute: %d a %d\",\n";
-                ss << u8"    \"ruRU\": \"Урон от пинков: %d–%d\",\n";
-                ss << u8"    \"zhCN\": \"脚踢伤害: %d - %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21783,\n";
-                ss << u8"    \"Key\": \"ModStre10L\",\n";
-                ss << u8"    \"enUS\": \"Percent Chance to Cast\",\n";
-                ss << u8"    \"zhTW\": \"% 施展機率\",\n";
-                ss << u8"    \"deDE\": \"% Chance auszulösen:\",\n";
-                ss << u8"    \"esES\": \"% de probabilidad de lanzar\",\n";
-                ss << u8"    \"frFR\": \"Pourcentage de chance de lancer le sort\",\n";
-                ss << u8"    \"itIT\": \"% di probabilità di lanciare\",\n";
-                ss << u8"    \"koKR\": \"% 확률로 시전:\",\n";
-                ss << u8"    \"plPL\": \"Procent szans na rzucenie\",\n";
-                ss << u8"    \"esMX\": \"% de probabilidad de lanzar\",\n";
-                ss << u8"    \"jaJP\": \"%%の確率で発動:\",\n";
-                ss << u8"    \"ptBR\": \"Percentual de chance de lançar\",\n";
-                ss << u8"    \"ruRU\": \"Вероятность применить\",\n";
-                ss << u8"    \"zhCN\": \"%施法几率\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21806,\n";
-                ss << u8"    \"Key\": \"tr2\",\n";
-                ss << u8"    \"enUS\": \"Scroll of Resistance\",\n";
-                ss << u8"    \"zhTW\": \"抗性卷軸\",\n";
-                ss << u8"    \"deDE\": \"Schriftrolle des Widerstandes\",\n";
-                ss << u8"    \"esES\": \"Pergamino de resistencia\",\n";
-                ss << u8"    \"frFR\": \"Parchemin de résistance\",\n";
-                ss << u8"    \"itIT\": \"Pergamena della resistenza\",\n";
-                ss << u8"    \"koKR\": \"저항의 두루마리\",\n";
-                ss << u8"    \"plPL\": \"Zwój Odporności\",\n";
-                ss << u8"    \"esMX\": \"Pergamino de resistencia\",\n";
-                ss << u8"    \"jaJP\": \"耐性の巻物\",\n";
-                ss << u8"    \"ptBR\": \"Pergaminho de Resistência\",\n";
-                ss << u8"    \"ruRU\": \"Свиток сопротивления\",\n";
-                ss << u8"    \"zhCN\": \"抗性卷轴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21874,\n";
-                ss << u8"    \"Key\": \"ExInsertSockets\",\n";
-                ss << u8"    \"enUS\": \"Can be Inserted into Socketed Items\",\n";
-                ss << u8"    \"zhTW\": \"可以放入有鑲孔的物品\",\n";
-                ss << u8"    \"deDE\": \"Anbringung möglich an gesockelten Gegenständen\",\n";
-                ss << u8"    \"esES\": \"Se puede insertar en objetos con huecos\",\n";
-                ss << u8"    \"frFR\": \"Peut être enchâssé(e) dans les objets avec châsse\",\n";
-                ss << u8"    \"itIT\": \"Si può inserire negli oggetti con castone\",\n";
-                ss << u8"    \"koKR\": \"홈이 있는 아이템에 삽입 가능\",\n";
-                ss << u8"    \"plPL\": \"Można umieścić w przedmiotach z gniazdami\",\n";
-                ss << u8"    \"esMX\": \"Puede insertarse en objetos engarzados\",\n";
-                ss << u8"    \"jaJP\": \"ソケット付きのアイテムに装着可能\",\n";
-                ss << u8"    \"ptBR\": \"Pode ser inserido em itens com engastes\",\n";
-                ss << u8"    \"ruRU\": \"Можно вставить в предметы с гнездами\",\n";
-                ss << u8"    \"zhCN\": \"可以被插入有镶孔的物品中\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21885,\n";
-                ss << u8"    \"Key\": \"ItemExpansiveChancX\",\n";
-                ss << u8"    \"enUS\": \"%d%% Chance to cast level %d %s on attack\",\n";
-                ss << u8"    \"zhTW\": \"攻擊時有 %d%% 機率施展等級 %d %s\",\n";
-                ss << u8"    \"deDE\": \"%d%% Chance, bei einem Angriff Stufe %d %s auszulösen\",\n";
-                ss << u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al atacar\",\n";
-                ss << u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 en attaquant\",\n";
-                ss << u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando attacchi\",\n";
-                ss << u8"    \"koKR\": \"공격 시 %d%% 확률로 %d 레벨 %s 시전\",\n";
-                ss << u8"    \"plPL\": \"%d%% szansy rzucenia %d-poziomowego zaklęcia %s podczas atakowania\",\n";
-                ss << u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al atacar\",\n";
-                ss << u8"    \"jaJP\": \"攻撃時に%0%%の確率で〈%2〉（レベル%1）を発動\",\n";
-                ss << u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 ao atacar\",\n";
-                ss << u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при атаке\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 几率在攻击时施放%d级%s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21886,\n";
-                ss << u8"    \"Key\": \"ItemExpansiveChanc1\",\n";
-                ss << u8"    \"enUS\": \"%d%% Chance to cast level %d %s on striking\",\n";
-                ss << u8"    \"zhTW\": \"擊中時有 %d%% 機率施展等級 %d %s\",\n";
-                ss << u8"    \"deDE\": \"%d%% Chance, bei einem Angriff Stufe %d %s auszulösen\",\n";
-                ss << u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al golpear\",\n";
-                ss << u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 en touchant\",\n";
-                ss << u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando colpisci\",\n";
-                ss << u8"    \"koKR\": \"타격 시 %d%% 확률로 %d 레벨 %s 시전\",\n";
-                ss << u8"    \"plPL\": \"%d%% szansy rzucenia %d-poziomowego zaklęcia %s, gdy atak dosięga celu\",\n";
-                ss << u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al golpear\",\n";
-                ss << u8"    \"jaJP\": \"命中時に%0%%の確率で〈%2〉（レベル%1）を発動\",\n";
-                ss << u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 ao atingir um inimigo\",\n";
-                ss << u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при ударе\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 几率在击中时施放%d级%s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21887,\n";
-                ss << u8"    \"Key\": \"ItemExpansiveChanc2\",\n";
-                ss << u8"    \"enUS\": \"%d%% Chance to cast level %d %s when struck\",\n";
-                ss << u8"    \"zhTW\": \"被擊中時有 %d%% 機率施展等級 %d %s\",\n";
-                ss << u8"    \"deDE\": \"%d%% Chance, wenn getroffen Stufe %d %s auszulösen\",\n";
-                ss << u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al recibir un golpe\",\n";
-                ss << u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 quand touché\",\n";
-                ss << u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando ti colpiscono\",\n";
-                ss << u8"    \"koKR\": \"피격 시 %d%% 확률로 %d 레벨 %s 시전\",\n";
-                ss << u8"    \"plPL\": \"%d%% szansy rzucenia %d-poziomowego zaklęcia %s przy otrzymaniu trafienia\",\n";
-                ss << u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al recibir un golpe\",\n";
-                ss << u8"    \"jaJP\": \"攻撃を受けると%0%%の確率で〈%2〉（レベル%1）を発動\",\n";
-                ss << u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 ao ser atingido\",\n";
-                ss << u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при получении урона\",\n";
-                ss << u8"    \"zhCN\": \"%d%% 几率在被击中时施放%d级%s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21888,\n";
-                ss << u8"    \"Key\": \"ItemExpcharmdesc\",\n";
-                ss << u8"    \"enUS\": \"Keep in inventory to gain bonus\",\n";
-                ss << u8"    \"zhTW\": \"放在物品欄以獲得其加成效果\",\n";
-                ss << u8"    \"deDE\": \"Im Inventar behalten, um Bonus zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Guárdalo en el inventario para obtener un bonus\",\n";
-                ss << u8"    \"frFR\": \"À garder dans l’inventaire pour bénéficier du bonus\",\n";
-                ss << u8"    \"itIT\": \"Tieni nell'inventario per ottenere un bonus\",\n";
-                ss << u8"    \"koKR\": \"소지품에 보관 시 보너스 획득\",\n";
-                ss << u8"    \"plPL\": \"Aby aktywować właściwości, trzymaj przedmiot w ekwipunku\",\n";
-                ss << u8"    \"esMX\": \"Conservar en el Inventario para obtener la bonificación\",\n";
-                ss << u8"    \"jaJP\": \"所持品に入れることでボーナスが得られる\",\n";
-                ss << u8"    \"ptBR\": \"Manter no inventário para ganhar bônus\",\n";
-                ss << u8"    \"ruRU\": \"Дает бонус при хранении в инвентаре\",\n";
-                ss << u8"    \"zhCN\": \"放在物品栏里以享受加成\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22745,\n";
-                ss << u8"    \"Key\": \"strethereal\",\n";
-                ss << u8"    \"enUS\": \"Ethereal (Cannot be Repaired)\",\n";
-                ss << u8"    \"zhTW\": \"無形（無法修復）\",\n";
-                ss << u8"    \"deDE\": \"Ätherisch (Reparatur nicht möglich.)\",\n";
-                ss << u8"    \"esES\": \"Etéreo (no se puede reparar)\",\n";
-                ss << u8"    \"frFR\": \"Éthéré (ne peut pas être réparé)\",\n";
-                ss << u8"    \"itIT\": \"Etereo (non si può riparare)\",\n";
-                ss << u8"    \"koKR\": \"무형 (수리 불가)\",\n";
-                ss << u8"    \"plPL\": \"Przedmiot eteryczny (nie może być naprawiony)\",\n";
-                ss << u8"    \"esMX\": \"Etéreo (no puede repararse)\",\n";
-                ss << u8"    \"jaJP\": \"イシリアル（修理不可能）\",\n";
-                ss << u8"    \"ptBR\": \"Etéreo (não pode ser reparado)\",\n";
-                ss << u8"    \"ruRU\": \"Бесплотный предмет (нельзя ремонтировать)\",\n";
-                ss << u8"    \"zhCN\": \"无形的 (无法修复)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22746,\n";
-                ss << u8"    \"Key\": \"stretherealnonrepair\",\n";
-                ss << u8"    \"enUS\": \"This item cannot be repaired.\",\n";
-                ss << u8"    \"zhTW\": \"這項物品無法修復。\",\n";
-                ss << u8"    \"deDE\": \"Dieser Gegenstand kann nicht repariert werden.\",\n";
-                ss << u8"    \"esES\": \"Este objeto no se puede reparar\",\n";
-                ss << u8"    \"frFR\": \"Cet objet ne peut pas être réparé.\",\n";
-                ss << u8"    \"itIT\": \"Quest'oggetto non può essere riparato.\",\n";
-                ss << u8"    \"koKR\": \"이 아이템은 수리할 수 없습니다.\",\n";
-                ss << u8"    \"plPL\": \"Ten przedmiot nie może być naprawiony.\",\n";
-                ss << u8"    \"esMX\": \"Este objeto no puede repararse.\",\n";
-                ss << u8"    \"jaJP\": \"修理できないアイテムです。\",\n";
-                ss << u8"    \"ptBR\": \"Este item não pode ser reparado.\",\n";
-                ss << u8"    \"ruRU\": \"Этот предмет нельзя отремонтировать.\",\n";
-                ss << u8"    \"zhCN\": \"此物品无法被修复。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 23001,\n";
-                ss << u8"    \"Key\": \"ModStr2uPercent\",\n";
-                ss << u8"    \"enUS\": \"Physical Damage Received Reduced by %d%%\",\n";
-                ss << u8"    \"zhTW\": \"受到的物理傷害降低 %d%%\",\n";
-                ss << u8"    \"deDE\": \"Schaden reduziert um %d%%\",\n";
-                ss << u8"    \"esES\": \"Daño reducido un %d%%\",\n";
-                ss << u8"    \"frFR\": \"Dégâts réduits de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Danni ridotti del %d%%\",\n";
-                ss << u8"    \"koKR\": \"받는 물리 피해 %d%% 감소\",\n";
-                ss << u8"    \"plPL\": \"Zmniejsza obrażenia o %d%%\",\n";
-                ss << u8"    \"esMX\": \"Reduce un %d%% el daño\",\n";
-                ss << u8"    \"jaJP\": \"ダメージを軽減（%d%%）\",\n";
-                ss << u8"    \"ptBR\": \"Dano reduzido em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"Урон уменьшен на %d%%\",\n";
-                ss << u8"    \"zhCN\": \"受到的物理伤害降低 %d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 23004,\n";
-                ss << u8"    \"Key\": \"ItemModifierClassSkill\",\n";
-                ss << u8"    \"enUS\": \"%+d to %s %s\",\n";
-                ss << u8"    \"zhTW\": \"%+d 至%s %s\",\n";
-                ss << u8"    \"deDE\": \"%+d zu %s %s\",\n";
-                ss << u8"    \"esES\": \"%+d a %s (%s)\",\n";
-                ss << u8"    \"frFR\": \"%+d à %s %s\",\n";
-                ss << u8"    \"itIT\": \"%+d a %s %s\",\n";
-                ss << u8"    \"koKR\": \"%+d %s %s\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności %s %s\",\n";
-                ss << u8"    \"esMX\": \"%+d a %s %s\",\n";
-                ss << u8"    \"jaJP\": \"〈%1〉スキル向上（%+0）%2\",\n";
-                ss << u8"    \"ptBR\": \"%+d para %s %s\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умению «%s» %s\",\n";
-                ss << u8"    \"zhCN\": \"%+d 至%s %s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 23005,\n";
-                ss << u8"    \"Key\": \"ItemModifierNonClassSkill\",\n";
-                ss << u8"    \"enUS\": \"%+d to %s\",\n";
-                ss << u8"    \"zhTW\": \"%+d 至%s\",\n";
-                ss << u8"    \"deDE\": \"%+d zu %s\",\n";
-                ss << u8"    \"esES\": \"%+d a %s\",\n";
-                ss << u8"    \"frFR\": \"%+d à %s\",\n";
-                ss << u8"    \"itIT\": \"%+d a %s\",\n";
-                ss << u8"    \"koKR\": \"%+d %s\",\n";
-                ss << u8"    \"plPL\": \"%+d do umiejętności %s\",\n";
-                ss << u8"    \"esMX\": \"%+d a %s\",\n";
-                ss << u8"    \"jaJP\": \"〈%1〉向上（%+0）\",\n";
-                ss << u8"    \"ptBR\": \"%+d para %s\",\n";
-                ss << u8"    \"ruRU\": \"%+d к умению «%s»\",\n";
-                ss << u8"    \"zhCN\": \"%+d 至%s\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 23049,\n";
-                ss << u8"    \"Key\": \"strItemModEtherealSocketed\",\n";
-                ss << u8"    \"enUS\": \"Ethereal (Cannot be Repaired), Socketed (%i)\",\n";
-                ss << u8"    \"zhTW\": \"無形（無法修復），鑲孔（%i）\",\n";
-                ss << u8"    \"deDE\": \"Ätherisch (Reparatur nicht möglich.), Gesockelt (%i)\",\n";
-                ss << u8"    \"esES\": \"Etéreo (no se puede reparar) y con huecos (%i)\",\n";
-                ss << u8"    \"frFR\": \"Éthéré (ne peut être pas réparé), serti (%i)\",\n";
-                ss << u8"    \"itIT\": \"Etereo (non si può riparare), Con castoni (%i)\",\n";
-                ss << u8"    \"koKR\": \"무형 (수리 불가), 홈 있음 (%i)\",\n";
-                ss << u8"    \"plPL\": \"Przedmiot eteryczny (nie może być naprawiony), gniazda (%i)\",\n";
-                ss << u8"    \"esMX\": \"Etéreo (no puede repararse), Engarzado (%i)\",\n";
-                ss << u8"    \"jaJP\": \"イシリアル（修理不可能）、ソケット（%i）\",\n";
-                ss << u8"    \"ptBR\": \"Etéreo (não pode ser reparado), com engastes (%i)\",\n";
-                ss << u8"    \"ruRU\": \"Бесплотный предмет (нельзя ремонтировать), с гнездами (%i)\",\n";
-                ss << u8"    \"zhCN\": \"无形的 (无法修复), 镶孔 (%i)\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 23050,\n";
-                ss << u8"    \"Key\": \"strItemStatThrowDamageRange\",\n";
-                ss << u8"    \"enUS\": \"Throw Damage: %d to %d\",\n";
-                ss << u8"    \"zhTW\": \"投擲傷害：%d - %d 點\",\n";
-                ss << u8"    \"deDE\": \"Wurfschaden: %d bis %d\",\n";
-                ss << u8"    \"esES\": \"Daño de lanzamiento: %d-%d p.\",\n";
-                ss << u8"    \"frFR\": \"Dégâts au lancer : %d à %d\",\n";
-                ss << u8"    \"itIT\": \"Danni da lancio: %d-%d\",\n";
-                ss << u8"    \"koKR\": \"투척 피해: %d - %d\",\n";
-                ss << u8"    \"plPL\": \"Obrażenia przy rzucie: %d-%d\",\n";
-                ss << u8"    \"esMX\": \"Daño de arrojamiento: %d a %d\",\n";
-                ss << u8"    \"jaJP\": \"投てきダメージ: %d - %d\",\n";
-                ss << u8"    \"ptBR\": \"Dano de arremesso: %d a %d\",\n";
-                ss << u8"    \"ruRU\": \"Урон от метательного оружия: %d–%d\",\n";
-                ss << u8"    \"zhCN\": \"投掷伤害: %d - %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 26333,\n";
-                ss << u8"    \"Key\": \"UseTokenOfAbsolution\",\n";
-                ss << u8"    \"enUS\": \"Right Click to reset Stat/Skill Points\",\n";
-                ss << u8"    \"zhTW\": \"右鍵點擊以重置屬性與技能點數\",\n";
-                ss << u8"    \"deDE\": \"Mit Rechtsklick Werte und Fertigkeitspunkte zurücksetzen\",\n";
-                ss << u8"    \"esES\": \"Haz clic derecho para reiniciar los puntos de habilidad/estadísticas\",\n";
-                ss << u8"    \"frFR\": \"Cliquez-droit pour réinitialiser les points de stat/compétence\",\n";
-                ss << u8"    \"itIT\": \"Clicca col destro per azzerare abilità e caratteristiche\",\n";
-                ss << u8"    \"koKR\": \"오른쪽 클릭으로 능력치/기술 포인트 초기화\",\n";
-                ss << u8"    \"plPL\": \"Naciśnij PPM, aby zresetować atrybuty i umiejętności\",\n";
-                ss << u8"    \"esMX\": \"Haz clic derecho para restablecer los puntos de atributo/habilidad\",\n";
-                ss << u8"    \"jaJP\": \"右クリックでステータスとスキル・ポイントをリセット\",\n";
-                ss << u8"    \"ptBR\": \"Clique com o botão direito para redefinir pontos de habilidades/atributos\",\n";
-                ss << u8"    \"ruRU\": \"Щелкните ПКМ, чтобы сбросить очки характеристик/умений\",\n";
-                ss << u8"    \"zhCN\": \"右键点击重设属性/技能点\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 26360,\n";
-                ss << u8"    \"Key\": \"MalahsPotionDescription\",\n";
-                ss << u8"    \"enUS\": \"Keep it to thaw Anya\",\n";
-                ss << u8"    \"zhTW\": \"融化安亞身上的冰雪\",\n";
-                ss << u8"    \"deDE\": \"Wird benötigt, um Anya aufzutauen\",\n";
-                ss << u8"    \"esES\": \"Guárdala para descongelar a Anya\",\n";
-                ss << u8"    \"frFR\": \"Gardez-la pour libérer Anya\",\n";
-                ss << u8"    \"itIT\": \"Usala per scongelare Anya\",\n";
-                ss << u8"    \"koKR\": \"안야를 녹이는 데 사용\",\n";
-                ss << u8"    \"plPL\": \"Zatrzymaj ją, by rozmrozić Anyę\",\n";
-                ss << u8"    \"esMX\": \"Consérvala para descongelar a Anya\",\n";
-                ss << u8"    \"jaJP\": \"アニャの氷を解かせる\",\n";
-                ss << u8"    \"ptBR\": \"Guardar para descongelar Anya\",\n";
-                ss << u8"    \"ruRU\": \"Может отогреть Аню.\",\n";
-                ss << u8"    \"zhCN\": \"留着它来解救安雅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 26705,\n";
-                ss << u8"    \"Key\": \"ItemModifierPersonalized\",\n";
-                ss << u8"    \"enUS\": \"Personalized\",\n";
-                ss << u8"    \"zhTW\": \"冠上名字\",\n";
-                ss << u8"    \"deDE\": \"Personalisiert\",\n";
-                ss << u8"    \"esES\": \"[fs]personalizada[ms]personalizado[fp]personalizadas[mp]personalizados\",\n";
-                ss << u8"    \"frFR\": \"Personnalisé\",\n";
-                ss << u8"    \"itIT\": \"Personalizzato\",\n";
-                ss << u8"    \"koKR\": \"이름 새겨짐\",\n";
-                ss << u8"    \"plPL\": \"[fs]Personalizowana[ms]Personalizowany[nl]Personalizowane\",\n";
-                ss << u8"    \"esMX\": \"Personalizado\",\n";
-                ss << u8"    \"jaJP\": \"一点物の\",\n";
-                ss << u8"    \"ptBR\": \"Personalizado\",\n";
-                ss << u8"    \"ruRU\": \"Переименовано\",\n";
-                ss << u8"    \"zhCN\": \"个性化\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27212,\n";
-                ss << u8"    \"Key\": \"ModStr6j\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Chance to not consume Quantity\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 機率不消耗數量\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Chance, keinen Stapel zu verbrauchen\",\n";
-                ss << u8"    \"esES\": \"%+d%% de probabilidad de no consumir cantidad\",\n";
-                ss << u8"    \"frFR\": \"%+d%% de chances de ne pas consommer de quantité\",\n";
-                ss << u8"    \"itIT\": \"Probabilità di non consumare quantità %+d%%\",\n";
-                ss << u8"    \"koKR\": \"%+d%% 확률로 수량을 소모하지 않음\",\n";
-                ss << u8"    \"plPL\": \"%+d%% szansy na niepochłonięcie zasobów\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de probabilidad de no consumir cantidad\",\n";
-                ss << u8"    \"jaJP\": \"%+d%%の確立でアイテム消費をしない\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de chance de não consumir quantidade\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к шансу не израсходовать снаряды\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 几率不消耗数量\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27339,\n";
-                ss << u8"    \"Key\": \"ModItemMonColdSunder\",\n";
-                ss << u8"    \"enUS\": \"Monster Cold Immunity is Sundered\",\n";
-                ss << u8"    \"zhTW\": \"破除怪物的冰寒免疫\",\n";
-                ss << u8"    \"deDE\": \"Die Kälteimmunität von Monstern ist durchbrochen\",\n";
-                ss << u8"    \"esES\": \"Se hiende la inmunidad al frío de los monstruos\",\n";
-                ss << u8"    \"frFR\": \"L’immunité au froid des monstres est brisée.\",\n";
-                ss << u8"    \"itIT\": \"L'immunità al freddo dei mostri è Infranta\",\n";
-                ss << u8"    \"koKR\": \"괴물의 냉기 면역이 파괴됨\",\n";
-                ss << u8"    \"plPL\": \"Niewrażliwość potworów na zimno jest osłabiona\",\n";
-                ss << u8"    \"esMX\": \"La inmunidad al frío de los monstruos se reduce\",\n";
-                ss << u8"    \"jaJP\": \"敵の冷気無効を弱体化\",\n";
-                ss << u8"    \"ptBR\": \"Imunidade a gelo de monstros destroçada\",\n";
-                ss << u8"    \"ruRU\": \"Невосприимчивость монстров к холоду нейтрализована\",\n";
-                ss << u8"    \"zhCN\": \"已破除怪物冰霜免疫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27340,\n";
-                ss << u8"    \"Key\": \"ModItemMonFireSunder\",\n";
-                ss << u8"    \"enUS\": \"Monster Fire Immunity is Sundered\",\n";
-                ss << u8"    \"zhTW\": \"破除怪物的火焰免疫\",\n";
-                ss << u8"    \"deDE\": \"Die Feuerimmunität von Monstern ist durchbrochen\",\n";
-                ss << u8"    \"esES\": \"Se hiende la inmunidad al fuego de los monstruos\",\n";
-                ss << u8"    \"frFR\": \"L’immunité au feu des monstres est brisée.\",\n";
-                ss << u8"    \"itIT\": \"L'immunità al fuoco dei mostri è Infranta\",\n";
-                ss << u8"    \"koKR\": \"괴물의 화염 면역이 파괴됨\",\n";
-                ss << u8"    \"plPL\": \"Niewrażliwość potworów na ogień jest osłabiona\",\n";
-                ss << u8"    \"esMX\": \"La inmunidad al fuego de los monstruos se reduce\",\n";
-                ss << u8"    \"jaJP\": \"敵の火炎無効を弱体化\",\n";
-                ss << u8"    \"ptBR\": \"Imunidade a fogo de monstros destroçada\",\n";
-                ss << u8"    \"ruRU\": \"Невосприимчивость монстров к огню нейтрализована\",\n";
-                ss << u8"    \"zhCN\": \"已破除怪物火焰免疫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27341,\n";
-                ss << u8"    \"Key\": \"ModItemMonLightSunder\",\n";
-                ss << u8"    \"enUS\": \"Monster Lightning Immunity is Sundered\",\n";
-                ss << u8"    \"zhTW\": \"破除怪物的閃電免疫\",\n";
-                ss << u8"    \"deDE\": \"Die Blitzimmunität von Monstern ist durchbrochen\",\n";
-                ss << u8"    \"esES\": \"Se hiende la inmunidad a los rayos de los monstruos\",\n";
-                ss << u8"    \"frFR\": \"L’immunité à la foudre des monstres est brisée.\",\n";
-                ss << u8"    \"itIT\": \"L'immunità al fulmine dei mostri è Infranta\",\n";
-                ss << u8"    \"koKR\": \"괴물의 번개 면역이 파괴됨\",\n";
-                ss << u8"    \"plPL\": \"Niewrażliwość potworów na błyskawice jest osłabiona\",\n";
-                ss << u8"    \"esMX\": \"La inmunidad al rayo de los monstruos se reduce\",\n";
-                ss << u8"    \"jaJP\": \"敵の電撃無効を弱体化\",\n";
-                ss << u8"    \"ptBR\": \"Imunidade elétrica de monstros destroçada\",\n";
-                ss << u8"    \"ruRU\": \"Невосприимчивость монстров к молнии нейтрализована\",\n";
-                ss << u8"    \"zhCN\": \"已破除怪物闪电免疫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27342,\n";
-                ss << u8"    \"Key\": \"ModItemMonPoisonSunder\",\n";
-                ss << u8"    \"enUS\": \"Monster Poison Immunity is Sundered\",\n";
-                ss << u8"    \"zhTW\": \"破除怪物的毒素免疫\",\n";
-                ss << u8"    \"deDE\": \"Die Giftimmunität von Monstern ist durchbrochen\",\n";
-                ss << u8"    \"esES\": \"Se hiende la inmunidad al veneno de los monstruos\",\n";
-                ss << u8"    \"frFR\": \"L’immunité au poison des monstres est brisée.\",\n";
-                ss << u8"    \"itIT\": \"L'immunità al veleno dei mostri è Infranta\",\n";
-                ss << u8"    \"koKR\": \"괴물의 독 면역이 파괴됨\",\n";
-                ss << u8"    \"plPL\": \"Niewrażliwość potworów na trucizny jest osłabiona\",\n";
-                ss << u8"    \"esMX\": \"La inmunidad al veneno de los monstruos se reduce\",\n";
-                ss << u8"    \"jaJP\": \"敵の毒無効を弱体化\",\n";
-                ss << u8"    \"ptBR\": \"Imunidade a veneno de monstros destroçada\",\n";
-                ss << u8"    \"ruRU\": \"Невосприимчивость монстров к яду нейтрализована\",\n";
-                ss << u8"    \"zhCN\": \"已破除怪物毒素免疫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27343,\n";
-                ss << u8"    \"Key\": \"ModItemMonPhysicalSunder\",\n";
-                ss << u8"    \"enUS\": \"Monster Physical Immunity is Sundered\",\n";
-                ss << u8"    \"zhTW\": \"破除怪物的物理免疫\",\n";
-                ss << u8"    \"deDE\": \"Die physische Immunität von Monstern ist durchbrochen\",\n";
-                ss << u8"    \"esES\": \"Se hiende la inmunidad física de los monstruos\",\n";
-                ss << u8"    \"frFR\": \"L’immunité physique des monstres est brisée.\",\n";
-                ss << u8"    \"itIT\": \"L'immunità ai danni fisici dei mostri è Infranta\",\n";
-                ss << u8"    \"koKR\": \"괴물의 물리 면역이 파괴됨\",\n";
-                ss << u8"    \"plPL\": \"Niewrażliwość potworów na ataki fizyczne jest osłabiona\",\n";
-                ss << u8"    \"esMX\": \"La inmunidad al daño físico de los monstruos se reduce\",\n";
-                ss << u8"    \"jaJP\": \"敵の物理無効を弱体化\",\n";
-                ss << u8"    \"ptBR\": \"Imunidade física de monstros destroçada\",\n";
-                ss << u8"    \"ruRU\": \"Невосприимчивость монстров к физическому урону нейтрализована\",\n";
-                ss << u8"    \"zhCN\": \"已破除怪物物理免疫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27344,\n";
-                ss << u8"    \"Key\": \"ModItemMonMagicSunder\",\n";
-                ss << u8"    \"enUS\": \"Monster Magic Immunity is Sundered\",\n";
-                ss << u8"    \"zhTW\": \"破除怪物的魔法免疫\",\n";
-                ss << u8"    \"deDE\": \"Die magische Immunität von Monstern ist durchbrochen\",\n";
-                ss << u8"    \"esES\": \"Se hiende la inmunidad mágica de los monstruos\",\n";
-                ss << u8"    \"frFR\": \"L’immunité magique des monstres est brisée.\",\n";
-                ss << u8"    \"itIT\": \"L'immunità alla magia dei mostri è Infranta\",\n";
-                ss << u8"    \"koKR\": \"괴물의 마법 면역이 파괴됨\",\n";
-                ss << u8"    \"plPL\": \"Niewrażliwość potworów na magię jest osłabiona\",\n";
-                ss << u8"    \"esMX\": \"La inmunidad a la magia de los monstruos se reduce\",\n";
-                ss << u8"    \"jaJP\": \"敵の魔法無効を弱体化\",\n";
-                ss << u8"    \"ptBR\": \"Imunidade a magia de monstros destroçada\",\n";
-                ss << u8"    \"ruRU\": \"Невосприимчивость монстров к магическому урону нейтрализована\",\n";
-                ss << u8"    \"zhCN\": \"已破除怪物魔法免疫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27351,\n";
-                ss << u8"    \"Key\": \"ModStr2uPercentNegative\",\n";
-                ss << u8"    \"enUS\": \"Physical Damage Received Increased by %d%%\",\n";
-                ss << u8"    \"zhTW\": \"受到的物理傷害提高 %d%%\",\n";
-                ss << u8"    \"deDE\": \"Erlittener Schaden um %d%% erhöht\",\n";
-                ss << u8"    \"esES\": \"Daño sufrido aumentado un %d%%\",\n";
-                ss << u8"    \"frFR\": \"Dégâts subis augmentés de %d%%\",\n";
-                ss << u8"    \"itIT\": \"Danni ricevuti aumentati del %d%%\",\n";
-                ss << u8"    \"koKR\": \"받는 물리 피해 %d%% 증가\",\n";
-                ss << u8"    \"plPL\": \"Otrzymane obrażenia są zwiększone o %d%%\",\n";
-                ss << u8"    \"esMX\": \"El daño recibido aumenta un %d%%\",\n";
-                ss << u8"    \"jaJP\": \"受ける物理ダメージ%d%%増加\",\n";
-                ss << u8"    \"ptBR\": \"Dano recebido aumentado em %d%%\",\n";
-                ss << u8"    \"ruRU\": \"Получаемый урон увеличен на %d%%\",\n";
-                ss << u8"    \"zhCN\": \"受到的物理伤害提高 %d%%\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27371,\n";
-                ss << u8"    \"Key\": \"ModStr6k\",\n";
-                ss << u8"    \"enUS\": \"%+d%% chance for finishing moves to not consume charges\",\n";
-                ss << u8"    \"zhTW\": \"%+d%% 機率使終結技不消耗集氣的力量\",\n";
-                ss << u8"    \"deDE\": \"%+d%% Chance, dass Finishing-Moves keine Aufladungen verbrauchen\",\n";
-                ss << u8"    \"esES\": \"%+d%% de probabilidad de que los remates no consuman cargas\",\n";
-                ss << u8"    \"frFR\": \"%+d%% de chances que les coups finaux ne consomment aucune charge\",\n";
-                ss << u8"    \"itIT\": \"Probabilità che le mosse finali non consumino cariche %+d%%\",\n";
-                ss << u8"    \"koKR\": \"필살기가 충전을 소모하지 않을 확률 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szansy na niewykorzystanie ładunków przez kończące uderzenia\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de probabilidad de que los ataques finales no consuman cargas\",\n";
-                ss << u8"    \"jaJP\": \"%+d%%の確率で必殺技が使用回数を消費しなくなる\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de chance de finalizações não consumirem cargas\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к шансу не израсходовать заряды завершающими приемами\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 几率终结技不消耗充能层数\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27374,\n";
-                ss << u8"    \"Key\": \"ModStr6l\",\n";
-                ss << u8"    \"enUS\": \"%+d%% Attack Speed\",\n";
-                ss << u8"    \"zhTW\": \"攻擊速度 %+d%% \",\n";
-                ss << u8"    \"deDE\": \"%+d%% Angriffsgeschwindigkeit\",\n";
-                ss << u8"    \"esES\": \"%+d%% de velocidad de ataque\",\n";
-                ss << u8"    \"frFR\": \"Vitesse d’attaque augmentée de %+d%%\",\n";
-                ss << u8"    \"itIT\": \"%+d%% velocità d'attacco\",\n";
-                ss << u8"    \"koKR\": \"공격 속도 %+d%%\",\n";
-                ss << u8"    \"plPL\": \"%+d%% do szybkości ataku\",\n";
-                ss << u8"    \"esMX\": \"%+d%% de velocidad de ataque\",\n";
-                ss << u8"    \"jaJP\": \"攻撃速度+%+d%%\",\n";
-                ss << u8"    \"ptBR\": \"%+d%% de velocidade de ataque\",\n";
-                ss << u8"    \"ruRU\": \"%+d%% к скорости атаки\",\n";
-                ss << u8"    \"zhCN\": \"%+d%% 攻击速度\"\n";
-                ss << u8"  }\n";
-                ss << u8"]\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"[\n",
+                u8"  {\n",
+                u8"    \"id\": 3333,\n",
+                u8"    \"Key\": \"priceless\",\n",
+                u8"    \"enUS\": \"Item cannot be traded here.\",\n",
+                u8"    \"zhTW\": \"無法在此交易這項物品。\",\n",
+                u8"    \"deDE\": \"Hier ist ein Handel mit diesem Gegenstand nicht möglich.\",\n",
+                u8"    \"esES\": \"Aquí no se puede comerciar con este objeto\",\n",
+                u8"    \"frFR\": \"Les objets ne peuvent pas être vendus ici.\",\n",
+                u8"    \"itIT\": \"Questo oggetto non si può scambiare qui.\",\n",
+                u8"    \"koKR\": \"여기서는 아이템을 거래할 수 없습니다.\",\n",
+                u8"    \"plPL\": \"Tego przedmiotu nie można tutaj sprzedać.\",\n",
+                u8"    \"esMX\": \"Este objeto no puede negociarse aquí.\",\n",
+                u8"    \"jaJP\": \"ここでは売れません。\",\n",
+                u8"    \"ptBR\": \"O item não pode ser negociado aqui.\",\n",
+                u8"    \"ruRU\": \"Этот предмет нельзя продать здесь.\",\n",
+                u8"    \"zhCN\": \"此处无法交易物品。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3453,\n",
+                u8"    \"Key\": \"Socketable\",\n",
+                u8"    \"enUS\": \"Socketed (%i)\",\n",
+                u8"    \"zhTW\": \"鑲孔（%i）\",\n",
+                u8"    \"deDE\": \"Gesockelt (%i)\",\n",
+                u8"    \"esES\": \"Con huecos (%i)\",\n",
+                u8"    \"frFR\": \"Serti (%i)\",\n",
+                u8"    \"itIT\": \"Con castoni (%i)\",\n",
+                u8"    \"koKR\": \"홈 있음 (%i)\",\n",
+                u8"    \"plPL\": \"Gniazda (%i)\",\n",
+                u8"    \"esMX\": \"Engarzado (%i)\",\n",
+                u8"    \"jaJP\": \"ソケット（%i）\",\n",
+                u8"    \"ptBR\": \"Engastes (%i)\",\n",
+                u8"    \"ruRU\": \"С гнездами (%i)\",\n",
+                u8"    \"zhCN\": \"镶孔 (%i)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3454,\n",
+                u8"    \"Key\": \"ItemStats1a\",\n",
+                u8"    \"enUS\": \"Requirements not met\",\n",
+                u8"    \"zhTW\": \"不符合需求\",\n",
+                u8"    \"deDE\": \"Anforderungen nicht erfüllt\",\n",
+                u8"    \"esES\": \"No se cumplen los requisitos\",\n",
+                u8"    \"frFR\": \"Config. incompatible\",\n",
+                u8"    \"itIT\": \"Requisiti non rispettati\",\n",
+                u8"    \"koKR\": \"착용 조건 미충족\",\n",
+                u8"    \"plPL\": \"Wymagania nie są spełnione\",\n",
+                u8"    \"esMX\": \"No se cumplen los requisitos\",\n",
+                u8"    \"jaJP\": \"装備条件を満たしていません\",\n",
+                u8"    \"ptBR\": \"Requisitos não atendidos\",\n",
+                u8"    \"ruRU\": \"Требования не соблюдены\",\n",
+                u8"    \"zhCN\": \"未满足条件\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3455,\n",
+                u8"    \"Key\": \"ItemStats1b\",\n",
+                u8"    \"enUS\": \"Unidentified\",\n",
+                u8"    \"zhTW\": \"尚未鑑定\",\n",
+                u8"    \"deDE\": \"Nicht identifiziert\",\n",
+                u8"    \"esES\": \"Sin identificar\",\n",
+                u8"    \"frFR\": \"Non identifié\",\n",
+                u8"    \"itIT\": \"Non identificato\",\n",
+                u8"    \"koKR\": \"미감별\",\n",
+                u8"    \"plPL\": \"Niezidentyfikowane\",\n",
+                u8"    \"esMX\": \"No identificado\",\n",
+                u8"    \"jaJP\": \"未鑑定\",\n",
+                u8"    \"ptBR\": \"Não identificado\",\n",
+                u8"    \"ruRU\": \"Неопознанный предмет\",\n",
+                u8"    \"zhCN\": \"未辨识\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3456,\n",
+                u8"    \"Key\": \"ItemStats1c\",\n",
+                u8"    \"enUS\": \"Charges:\",\n",
+                u8"    \"zhTW\": \"使用次數：\",\n",
+                u8"    \"deDE\": \"Ladungen:\",\n",
+                u8"    \"esES\": \"Cargas:\",\n",
+                u8"    \"frFR\": \"Charges :\",\n",
+                u8"    \"itIT\": \"Cariche:\",\n",
+                u8"    \"koKR\": \"충전 횟수:\",\n",
+                u8"    \"plPL\": \"Ładunki:\",\n",
+                u8"    \"esMX\": \"Cargas:\",\n",
+                u8"    \"jaJP\": \"使用可能数:\",\n",
+                u8"    \"ptBR\": \"Cargas:\",\n",
+                u8"    \"ruRU\": \"Зарядов:\",\n",
+                u8"    \"zhCN\": \"充能:\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3457,\n",
+                u8"    \"Key\": \"ItemStats1d\",\n",
+                u8"    \"enUS\": \"Durability: %i of %i\",\n",
+                u8"    \"zhTW\": \"耐久度：%i / %i\",\n",
+                u8"    \"deDE\": \"Haltbarkeit: %i von %i\",\n",
+                u8"    \"esES\": \"Durabilidad: %i de %i\",\n",
+                u8"    \"frFR\": \"Résistance : %i sur %i\",\n",
+                u8"    \"itIT\": \"Integrità: %i su %i\",\n",
+                u8"    \"koKR\": \"내구도: %i / %i\",\n",
+                u8"    \"plPL\": \"Trwałość: %i/%i\",\n",
+                u8"    \"esMX\": \"Durabilidad: %i de %i\",\n",
+                u8"    \"jaJP\": \"耐久力: %i/%i\",\n",
+                u8"    \"ptBR\": \"Durabilidade: %i de %i\",\n",
+                u8"    \"ruRU\": \"Прочность: %i из %i\",\n",
+                u8"    \"zhCN\": \"耐久度: %i / %i\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3458,\n",
+                u8"    \"Key\": \"ItemStats1e\",\n",
+                u8"    \"enUS\": \"Required Strength: %d\",\n",
+                u8"    \"zhTW\": \"需要力量：%d\",\n",
+                u8"    \"deDE\": \"Benötigte Stärke: %d\",\n",
+                u8"    \"esES\": \"Fuerza necesaria: %d\",\n",
+                u8"    \"frFR\": \"Force nécessaire : %d\",\n",
+                u8"    \"itIT\": \"Forza richiesta: %d\",\n",
+                u8"    \"koKR\": \"필요 힘: %d\",\n",
+                u8"    \"plPL\": \"Wymagana siła: %d\",\n",
+                u8"    \"esMX\": \"Fuerza requerida: %d\",\n",
+                u8"    \"jaJP\": \"必要な筋力: %d\",\n",
+                u8"    \"ptBR\": \"Força necessária: %d\",\n",
+                u8"    \"ruRU\": \"Требуемая сила: %d\",\n",
+                u8"    \"zhCN\": \"需要力量: %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3459,\n",
+                u8"    \"Key\": \"ItemStats1f\",\n",
+                u8"    \"enUS\": \"Required Dexterity: %d\",\n",
+                u8"    \"zhTW\": \"需要敏捷：%d\",\n",
+                u8"    \"deDE\": \"Benötigte Geschicklichkeit: %d\",\n",
+                u8"    \"esES\": \"Destreza necesaria: %d\",\n",
+                u8"    \"frFR\": \"Dextérité nécessaire : %d\",\n",
+                u8"    \"itIT\": \"Destrezza richiesta: %d\",\n",
+                u8"    \"koKR\": \"필요 민첩: %d\",\n",
+                u8"    \"plPL\": \"Wymagana zręczność: %d\",\n",
+                u8"    \"esMX\": \"Destreza requerida: %d\",\n",
+                u8"    \"jaJP\": \"必要な敏捷性: %d\",\n",
+                u8"    \"ptBR\": \"Destreza necessária: %d\",\n",
+                u8"    \"ruRU\": \"Требуемая ловкость: %d\",\n",
+                u8"    \"zhCN\": \"需要敏捷: %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3460,\n",
+                u8"    \"Key\": \"ItemStats1g\",\n",
+                u8"    \"enUS\": \"Damage:\",\n",
+                u8"    \"zhTW\": \"傷害：\",\n",
+                u8"    \"deDE\": \"Schaden:\",\n",
+                u8"    \"esES\": \"Daño:\",\n",
+                u8"    \"frFR\": \"Dégâts :\",\n",
+                u8"    \"itIT\": \"Danni:\",\n",
+                u8"    \"koKR\": \"피해:\",\n",
+                u8"    \"plPL\": \"Obrażenia:\",\n",
+                u8"    \"esMX\": \"Daño:\",\n",
+                u8"    \"jaJP\": \"ダメージ:\",\n",
+                u8"    \"ptBR\": \"Dano:\",\n",
+                u8"    \"ruRU\": \"Урон:\",\n",
+                u8"    \"zhCN\": \"伤害:\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3461,\n",
+                u8"    \"Key\": \"ItemStats1h\",\n",
+                u8"    \"enUS\": \"Defense: %d\",\n",
+                u8"    \"zhTW\": \"防禦：%d\",\n",
+                u8"    \"deDE\": \"Verteidigung: %d\",\n",
+                u8"    \"esES\": \"Defensa: %d\",\n",
+                u8"    \"frFR\": \"Défense : %d\",\n",
+                u8"    \"itIT\": \"Difesa: %d\",\n",
+                u8"    \"koKR\": \"방어력: %d\",\n",
+                u8"    \"plPL\": \"Obrona: %d\",\n",
+                u8"    \"esMX\": \"Defensa: %d\",\n",
+                u8"    \"jaJP\": \"防御力: %d\",\n",
+                u8"    \"ptBR\": \"Defesa: %d\",\n",
+                u8"    \"ruRU\": \"Защита: %d\",\n",
+                u8"    \"zhCN\": \"防御: %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3462,\n",
+                u8"    \"Key\": \"ItemStats1i\",\n",
+                u8"    \"enUS\": \"Quantity: %d of %d\",\n",
+                u8"    \"zhTW\": \"數量：%d / %d\",\n",
+                u8"    \"deDE\": \"Anzahl: %d von %d\",\n",
+                u8"    \"esES\": \"Cantidad: %d de %d\",\n",
+                u8"    \"frFR\": \"Quantité : %d sur %d\",\n",
+                u8"    \"itIT\": \"Quantità: %d di %d\",\n",
+                u8"    \"koKR\": \"수량: %d/%d\",\n",
+                u8"    \"plPL\": \"Liczba: %d z %d\",\n",
+                u8"    \"esMX\": \"Cantidad: %d de %d\",\n",
+                u8"    \"jaJP\": \"数量: %d/%d\",\n",
+                u8"    \"ptBR\": \"Quantidade: %d de %d\",\n",
+                u8"    \"ruRU\": \"Количество: %d из %d\",\n",
+                u8"    \"zhCN\": \"数量: %d/%d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3463,\n",
+                u8"    \"Key\": \"ItemStats1j\",\n",
+                u8"    \"enUS\": \"of\",\n",
+                u8"    \"zhTW\": \"/\",\n",
+                u8"    \"deDE\": \"von\",\n",
+                u8"    \"esES\": \"de\",\n",
+                u8"    \"frFR\": \"sur\",\n",
+                u8"    \"itIT\": \"di\",\n",
+                u8"    \"koKR\": \"/\",\n",
+                u8"    \"plPL\": \"z\",\n",
+                u8"    \"esMX\": \"de\",\n",
+                u8"    \"jaJP\": \"/\",\n",
+                u8"    \"ptBR\": \"de\",\n",
+                u8"    \"ruRU\": \"из\",\n",
+                u8"    \"zhCN\": \"/\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3464,\n",
+                u8"    \"Key\": \"ItemStast1k\",\n",
+                u8"    \"enUS\": \"to\",\n",
+                u8"    \"zhTW\": \"至\",\n",
+                u8"    \"deDE\": \"bis\",\n",
+                u8"    \"esES\": \"a\",\n",
+                u8"    \"frFR\": \"à\",\n",
+                u8"    \"itIT\": \"a\",\n",
+                u8"    \"koKR\": \"-\",\n",
+                u8"    \"plPL\": \"do\",\n",
+                u8"    \"esMX\": \"a\",\n",
+                u8"    \"jaJP\": \"に\",\n",
+                u8"    \"ptBR\": \"para\",\n",
+                u8"    \"ruRU\": \"до\",\n",
+                u8"    \"zhCN\": \"至\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3465,\n",
+                u8"    \"Key\": \"ItemStats1l\",\n",
+                u8"    \"enUS\": \"One-Hand Damage: %d to %d\",\n",
+                u8"    \"zhTW\": \"單手傷害：%d - %d 點\",\n",
+                u8"    \"deDE\": \"Einhandschaden: %d bis %d\",\n",
+                u8"    \"esES\": \"Daño con una mano: %d-%d p.\",\n",
+                u8"    \"frFR\": \"Dégâts à une main : %d à %d\",\n",
+                u8"    \"itIT\": \"Danni a una mano: %d-%d\",\n",
+                u8"    \"koKR\": \"한손 피해: %d - %d\",\n",
+                u8"    \"plPL\": \"Obrażenia jednorącz: %d-%d\",\n",
+                u8"    \"esMX\": \"Daño de una mano: %d a %d\",\n",
+                u8"    \"jaJP\": \"片手持ちダメージ: %d - %d\",\n",
+                u8"    \"ptBR\": \"Dano de uma mão: %d a %d\",\n",
+                u8"    \"ruRU\": \"Урон от одноручного оружия: %d–%d\",\n",
+                u8"    \"zhCN\": \"单手伤害: %d - %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3466,\n",
+                u8"    \"Key\": \"ItemStats1m\",\n",
+                u8"    \"enUS\": \"Two-Hand Damage: %d to %d\",\n",
+                u8"    \"zhTW\": \"雙手傷害：%d - %d 點\",\n",
+                u8"    \"deDE\": \"Zweihandschaden: %d bis %d\",\n",
+                u8"    \"esES\": \"Daño con dos manos: %d-%d p.\",\n",
+                u8"    \"frFR\": \"Dégâts à deux mains : %d à %d\",\n",
+                u8"    \"itIT\": \"Danni a due mani: %d-%d\",\n",
+                u8"    \"koKR\": \"양손 피해: %d - %d\",\n",
+                u8"    \"plPL\": \"Obrażenia dwurącz: %d-%d\",\n",
+                u8"    \"esMX\": \"Daño de dos manos: %d a %d\",\n",
+                u8"    \"jaJP\": \"両手持ちダメージ: %d - %d\",\n",
+                u8"    \"ptBR\": \"Dano de duas mãos: %d a %d\",\n",
+                u8"    \"ruRU\": \"Урон от двуручного оружия: %d–%d\",\n",
+                u8"    \"zhCN\": \"双手伤害: %d - %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3467,\n",
+                u8"    \"Key\": \"ItemStats1n\",\n",
+                u8"    \"enUS\": \"Throw Damage: %d\",\n",
+                u8"    \"zhTW\": \"投擲傷害：%d 點\",\n",
+                u8"    \"deDE\": \"Wurfschaden: %d\",\n",
+                u8"    \"esES\": \"Daño de lanzamiento: %d p.\",\n",
+                u8"    \"frFR\": \"Dégâts au lancer : %d\",\n",
+                u8"    \"itIT\": \"Danni da lancio: %d\",\n",
+                u8"    \"koKR\": \"투척 피해: %d\",\n",
+                u8"    \"plPL\": \"Obrażenia przy rzucie: %d\",\n",
+                u8"    \"esMX\": \"Daño de arrojamiento: %d\",\n",
+                u8"    \"jaJP\": \"投てきダメージ: %d\",\n",
+                u8"    \"ptBR\": \"Dano de arremesso: %d\",\n",
+                u8"    \"ruRU\": \"Урон от метательного оружия: %d\",\n",
+                u8"    \"zhCN\": \"投掷伤害: %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3468,\n",
+                u8"    \"Key\": \"ItemStats1o\",\n",
+                u8"    \"enUS\": \"Smite Damage: %d to %d\",\n",
+                u8"    \"zhTW\": \"重擊傷害：%d - %d 點\",\n",
+                u8"    \"deDE\": \"Niederstrecken-Schaden: %d bis %d\",\n",
+                u8"    \"esES\": \"Daño de Fulminar: %d-%d p.\",\n",
+                u8"    \"frFR\": \"Dégâts de frappe : %d à %d\",\n",
+                u8"    \"itIT\": \"Danni di Espiazione: %d-%d\",\n",
+                u8"    \"koKR\": \"강타 피해: %d - %d\",\n",
+                u8"    \"plPL\": \"Obrażenia od Pchnięcia: %d-%d\",\n",
+                u8"    \"esMX\": \"Daño de Escarmiento: %d a %d\",\n",
+                u8"    \"jaJP\": \"盾攻撃ダメージ: %d - %d\",\n",
+                u8"    \"ptBR\": \"Dano de Castigo: %d a %d\",\n",
+                u8"    \"ruRU\": \"%d–%d урона от щита\",\n",
+                u8"    \"zhCN\": \"盾击伤害: %d - %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3469,\n",
+                u8"    \"Key\": \"ItemStats1p\",\n",
+                u8"    \"enUS\": \"Required Level: %d\",\n",
+                u8"    \"zhTW\": \"需要等級：%d\",\n",
+                u8"    \"deDE\": \"Benötigte Stufe: %d\",\n",
+                u8"    \"esES\": \"Nivel necesario: %d\",\n",
+                u8"    \"frFR\": \"Niveau nécessaire : %d\",\n",
+                u8"    \"itIT\": \"Livello richiesto: %d\",\n",
+                u8"    \"koKR\": \"요구 레벨: %d\",\n",
+                u8"    \"plPL\": \"Wymagany poziom: %d\",\n",
+                u8"    \"esMX\": \"Nivel requerido: %d\",\n",
+                u8"    \"jaJP\": \"必要レベル: %d\",\n",
+                u8"    \"ptBR\": \"Nível necessário: %d\",\n",
+                u8"    \"ruRU\": \"Требуемый уровень: %d-й\",\n",
+                u8"    \"zhCN\": \"需要等级: %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3470,\n",
+                u8"    \"Key\": \"ItemStats1q\",\n",
+                u8"    \"enUS\": \"Points: %d\",\n",
+                u8"    \"zhTW\": \"點數：%d\",\n",
+                u8"    \"deDE\": \"Punkte: %d\",\n",
+                u8"    \"esES\": \"Puntos: %d\",\n",
+                u8"    \"frFR\": \"Points : %d\",\n",
+                u8"    \"itIT\": \"Punti: %d\",\n",
+                u8"    \"koKR\": \"포인트: %d\",\n",
+                u8"    \"plPL\": \"Punkty: %d\",\n",
+                u8"    \"esMX\": \"Puntos: %d\",\n",
+                u8"    \"jaJP\": \"ポイント: %d\",\n",
+                u8"    \"ptBR\": \"Pontos: %d\",\n",
+                u8"    \"ruRU\": \"Восполняет %d ед.\",\n",
+                u8"    \"zhCN\": \"点数: %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3471,\n",
+                u8"    \"Key\": \"ItemStatsrejuv1\",\n",
+                u8"    \"enUS\": \"Heals %d%% Life and Mana\",\n",
+                u8"    \"zhTW\": \"恢復 %d%% 的生命和法力\",\n",
+                u8"    \"deDE\": \"Heilt %d %% Leben und Mana.\",\n",
+                u8"    \"esES\": \"Restaura un %d%% de vida y maná\",\n",
+                u8"    \"frFR\": \"Récupère %d %% de Vie et de Mana\",\n",
+                u8"    \"itIT\": \"Rigenera il %d%% di vita e mana\",\n",
+                u8"    \"koKR\": \"생명력 및 마나 %d%% 회복\",\n",
+                u8"    \"plPL\": \"Przywraca %d%% zdrowia i many\",\n",
+                u8"    \"esMX\": \"Sana %d%% de vida y de maná\",\n",
+                u8"    \"jaJP\": \"ライフとマナを回復（%d%%）\",\n",
+                u8"    \"ptBR\": \"Cura %d%% de pontos de vida e mana\",\n",
+                u8"    \"ruRU\": \"Восполняет %d%% здоровья и маны.\",\n",
+                u8"    \"zhCN\": \"治愈 %d%% 生命和法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3472,\n",
+                u8"    \"Key\": \"ItemStatsrejuv2\",\n",
+                u8"    \"enUS\": \"Heals 100% Life and Mana\",\n",
+                u8"    \"zhTW\": \"恢復 100% 的生命和法力\",\n",
+                u8"    \"deDE\": \"Heilt 100% Leben und Mana.\",\n",
+                u8"    \"esES\": \"Restaura un 100% de vida y maná\",\n",
+                u8"    \"frFR\": \"Récupère 100% de Vie et de Mana\",\n",
+                u8"    \"itIT\": \"Rigenera il 100% di vita e mana\",\n",
+                u8"    \"koKR\": \"생명력과 마나 100% 회복\",\n",
+                u8"    \"plPL\": \"Przywraca 100% zdrowia i many\",\n",
+                u8"    \"esMX\": \"Sana 100% de vida y de maná\",\n",
+                u8"    \"jaJP\": \"ライフとマナを完全回復\",\n",
+                u8"    \"ptBR\": \"Cura 100% de pontos de vida e mana\",\n",
+                u8"    \"ruRU\": \"Восполняет 100% здоровья и маны\",\n",
+                u8"    \"zhCN\": \"治愈 100% 生命和法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3473,\n",
+                u8"    \"Key\": \"ModStr1a\",\n",
+                u8"    \"enUS\": \"%+d to Strength\",\n",
+                u8"    \"zhTW\": \"%+d 力量\",\n",
+                u8"    \"deDE\": \"%+d zu Stärke\",\n",
+                u8"    \"esES\": \"%+d de fuerza\",\n",
+                u8"    \"frFR\": \"%+d à la Force\",\n",
+                u8"    \"itIT\": \"%+d Forza\",\n",
+                u8"    \"koKR\": \"힘 %+d\",\n",
+                u8"    \"plPL\": \"%+d do siły\",\n",
+                u8"    \"esMX\": \"%+d de fuerza\",\n",
+                u8"    \"jaJP\": \"筋力（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de força\",\n",
+                u8"    \"ruRU\": \"%+d к силе\",\n",
+                u8"    \"zhCN\": \"%+d 力量\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3474,\n",
+                u8"    \"Key\": \"ModStr1b\",\n",
+                u8"    \"enUS\": \"%+d to Dexterity\",\n",
+                u8"    \"zhTW\": \"%+d 敏捷\",\n",
+                u8"    \"deDE\": \"%+d zu Geschicklichkeit\",\n",
+                u8"    \"esES\": \"%+d de destreza\",\n",
+                u8"    \"frFR\": \"%+d à la Dextérité\",\n",
+                u8"    \"itIT\": \"%+d Destrezza\",\n",
+                u8"    \"koKR\": \"민첩 %+d\",\n",
+                u8"    \"plPL\": \"%+d do zręczności\",\n",
+                u8"    \"esMX\": \"%+d de destreza\",\n",
+                u8"    \"jaJP\": \"敏捷性（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de destreza\",\n",
+                u8"    \"ruRU\": \"%+d к ловкости\",\n",
+                u8"    \"zhCN\": \"%+d 敏捷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3475,\n",
+                u8"    \"Key\": \"ModStr1c\",\n",
+                u8"    \"enUS\": \"%+d to Vitality\",\n",
+                u8"    \"zhTW\": \"%+d 體能\",\n",
+                u8"    \"deDE\": \"%+d zu Vitalität\",\n",
+                u8"    \"esES\": \"%+d de vitalidad\",\n",
+                u8"    \"frFR\": \"%+d à la Vitalité\",\n",
+                u8"    \"itIT\": \"%+d Vitalità\",\n",
+                u8"    \"koKR\": \"활력 %+d\",\n",
+                u8"    \"plPL\": \"%+d do żywotności\",\n",
+                u8"    \"esMX\": \"%+d de vitalidad\",\n",
+                u8"    \"jaJP\": \"生命力（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de vitalidade\",\n",
+                u8"    \"ruRU\": \"%+d к живучести\",\n",
+                u8"    \"zhCN\": \"%+d 活力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3476,\n",
+                u8"    \"Key\": \"ModStr1d\",\n",
+                u8"    \"enUS\": \"%+d to Energy\",\n",
+                u8"    \"zhTW\": \"%+d 能量\",\n",
+                u8"    \"deDE\": \"%+d zu Energie\",\n",
+                u8"    \"esES\": \"%+d de energía\",\n",
+                u8"    \"frFR\": \"%+d à l’Énergie\",\n",
+                u8"    \"itIT\": \"%+d Energia\",\n",
+                u8"    \"koKR\": \"마력 %+d\",\n",
+                u8"    \"plPL\": \"%+d do energii\",\n",
+                u8"    \"esMX\": \"%+d de energía\",\n",
+                u8"    \"jaJP\": \"エナジー（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de energia\",\n",
+                u8"    \"ruRU\": \"%+d к энергии\",\n",
+                u8"    \"zhCN\": \"%+d 能量\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3477,\n",
+                u8"    \"Key\": \"ModStr1e\",\n",
+                u8"    \"enUS\": \"%+d to Mana\",\n",
+                u8"    \"zhTW\": \"%+d 法力\",\n",
+                u8"    \"deDE\": \"%+d zu Mana\",\n",
+                u8"    \"esES\": \"%+d p. de maná\",\n",
+                u8"    \"frFR\": \"%+d au Mana\",\n",
+                u8"    \"itIT\": \"%+d mana\",\n",
+                u8"    \"koKR\": \"마나 %+d\",\n",
+                u8"    \"plPL\": \"%+d do many\",\n",
+                u8"    \"esMX\": \"%+d de maná\",\n",
+                u8"    \"jaJP\": \"マナ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de mana\",\n",
+                u8"    \"ruRU\": \"%+d к мане\",\n",
+                u8"    \"zhCN\": \"%+d 法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3478,\n",
+                u8"    \"Key\": \"ModStr1f\",\n",
+                u8"    \"enUS\": \"%+d to Maximum Damage\",\n",
+                u8"    \"zhTW\": \"%+d 最大傷害\",\n",
+                u8"    \"deDE\": \"%+d zu max. Schaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño máximo\",\n",
+                u8"    \"frFR\": \"%+d aux dégâts max.\",\n",
+                u8"    \"itIT\": \"%+d ai danni massimi\",\n",
+                u8"    \"koKR\": \"최대 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do maksymalnych obrażeń\",\n",
+                u8"    \"esMX\": \"%+d de daño máximo\",\n",
+                u8"    \"jaJP\": \"最大ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano máximo\",\n",
+                u8"    \"ruRU\": \"%+d к максимальному урону\",\n",
+                u8"    \"zhCN\": \"%+d 最大伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3479,\n",
+                u8"    \"Key\": \"ModStr1g\",\n",
+                u8"    \"enUS\": \"%+d to Minimum Damage\",\n",
+                u8"    \"zhTW\": \"%+d 最小傷害\",\n",
+                u8"    \"deDE\": \"%+d zu min. Schaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño mínimo\",\n",
+                u8"    \"frFR\": \"%+d aux dégâts min.\",\n",
+                u8"    \"itIT\": \"%+d ai danni minimi\",\n",
+                u8"    \"koKR\": \"최소 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do minimalnych obrażeń\",\n",
+                u8"    \"esMX\": \"%+d de daño mínimo\",\n",
+                u8"    \"jaJP\": \"最小ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano mínimo\",\n",
+                u8"    \"ruRU\": \"%+d к минимальному урону\",\n",
+                u8"    \"zhCN\": \"%+d 最小伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3480,\n",
+                u8"    \"Key\": \"ModStr1h\",\n",
+                u8"    \"enUS\": \"%+d to Attack Rating\",\n",
+                u8"    \"zhTW\": \"%+d 準確率\",\n",
+                u8"    \"deDE\": \"%+d zu Angriffswert\",\n",
+                u8"    \"esES\": \"%+d de índice de ataque\",\n",
+                u8"    \"frFR\": \"%+d au score d’attaque\",\n",
+                u8"    \"itIT\": \"%+d indice d'attacco\",\n",
+                u8"    \"koKR\": \"명중률 %+d\",\n",
+                u8"    \"plPL\": \"%+d do skuteczności ataku\",\n",
+                u8"    \"esMX\": \"%+d de índice de ataque\",\n",
+                u8"    \"jaJP\": \"命中率（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de taxa de ataque\",\n",
+                u8"    \"ruRU\": \"%+d к рейтингу атаки\",\n",
+                u8"    \"zhCN\": \"%+d 命中值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3481,\n",
+                u8"    \"Key\": \"ModStr1i\",\n",
+                u8"    \"enUS\": \"%+d Defense\",\n",
+                u8"    \"zhTW\": \"%+d 防禦\",\n",
+                u8"    \"deDE\": \"%+d Verteidigung\",\n",
+                u8"    \"esES\": \"%+d de defensa\",\n",
+                u8"    \"frFR\": \"%+d à la défense\",\n",
+                u8"    \"itIT\": \"%+d difesa\",\n",
+                u8"    \"koKR\": \"방어력 %+d\",\n",
+                u8"    \"plPL\": \"%+d do obrony\",\n",
+                u8"    \"esMX\": \"%+d de defensa\",\n",
+                u8"    \"jaJP\": \"防御力（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de defesa\",\n",
+                u8"    \"ruRU\": \"%+d к защите\",\n",
+                u8"    \"zhCN\": \"%+d 防御\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3482,\n",
+                u8"    \"Key\": \"ModStr1j\",\n",
+                u8"    \"enUS\": \"Fire Resist %+d%%\",\n",
+                u8"    \"zhTW\": \"火焰抗性 %+d%%\",\n",
+                u8"    \"deDE\": \"Feuerwiderstand %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia al fuego\",\n",
+                u8"    \"frFR\": \"Résistance au Feu : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza al fuoco\",\n",
+                u8"    \"koKR\": \"화염 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do odporności na ogień\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia al fuego\",\n",
+                u8"    \"jaJP\": \"火炎耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Resistência a fogo %+d%%\",\n",
+                u8"    \"ruRU\": \"%+d%% к сопротивлению огню\",\n",
+                u8"    \"zhCN\": \"火焰抗性 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3483,\n",
+                u8"    \"Key\": \"ModStr1k\",\n",
+                u8"    \"enUS\": \"Cold Resist %+d%%\",\n",
+                u8"    \"zhTW\": \"冰寒抗性 %+d%%\",\n",
+                u8"    \"deDE\": \"Kältewiderstand %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia al frío\",\n",
+                u8"    \"frFR\": \"Résistance au Froid : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza al freddo\",\n",
+                u8"    \"koKR\": \"냉기 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do odporności na zimno\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia al frío\",\n",
+                u8"    \"jaJP\": \"冷気耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Resistência a gelo %+d%%\",\n",
+                u8"    \"ruRU\": \"%+d%% к сопротивлению льду\",\n",
+                u8"    \"zhCN\": \"冰霜抗性 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3484,\n",
+                u8"    \"Key\": \"ModStr1l\",\n",
+                u8"    \"enUS\": \"Lightning Resist %+d%%\",\n",
+                u8"    \"zhTW\": \"電擊抗性 %+d%%\",\n",
+                u8"    \"deDE\": \"Blitzwiderstand %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia a los rayos\",\n",
+                u8"    \"frFR\": \"Résistance à la Foudre : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza al fulmine\",\n",
+                u8"    \"koKR\": \"번개 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do odporności na błyskawice\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia al rayo\",\n",
+                u8"    \"jaJP\": \"電撃耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Resistência elétrica %+d%%\",\n",
+                u8"    \"ruRU\": \"%+d%% к сопротивлению молнии\",\n",
+                u8"    \"zhCN\": \"闪电抗性 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3485,\n",
+                u8"    \"Key\": \"ModStr1m\",\n",
+                u8"    \"enUS\": \"Magic Resist %+d%%\",\n",
+                u8"    \"zhTW\": \"魔法抗性 %+d%%\",\n",
+                u8"    \"deDE\": \"Magiewiderstand %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia a la magia\",\n",
+                u8"    \"frFR\": \"Résistance à la Magie : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza alla magia\",\n",
+                u8"    \"koKR\": \"마법 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do odporności na magię\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia mágica\",\n",
+                u8"    \"jaJP\": \"魔法耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Resistência a magia %+d%%\",\n",
+                u8"    \"ruRU\": \"%+d%% к сопротивлению магии\",\n",
+                u8"    \"zhCN\": \"魔法抗性 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3486,\n",
+                u8"    \"Key\": \"ModStr1n\",\n",
+                u8"    \"enUS\": \"Poison Resist %+d%%\",\n",
+                u8"    \"zhTW\": \"毒素抗性 %+d%%\",\n",
+                u8"    \"deDE\": \"Giftwiderstand %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia al veneno\",\n",
+                u8"    \"frFR\": \"Résistance au Poison : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza al veleno\",\n",
+                u8"    \"koKR\": \"독 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do odporności na trucizny\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia al veneno\",\n",
+                u8"    \"jaJP\": \"毒物耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Resistência a veneno %+d%%\",\n",
+                u8"    \"ruRU\": \"%+d%% к сопротивлению яду\",\n",
+                u8"    \"zhCN\": \"毒素抗性 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3487,\n",
+                u8"    \"Key\": \"ModStr1o\",\n",
+                u8"    \"enUS\": \"%+d to Maximum Fire Damage\",\n",
+                u8"    \"zhTW\": \"%+d 火焰傷害最大值\",\n",
+                u8"    \"deDE\": \"%+d zu max. Feuerschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño máximo de fuego\",\n",
+                u8"    \"frFR\": \"%+d aux dégâts de Feu max.\",\n",
+                u8"    \"itIT\": \"%+d ai danni massimi da fuoco\",\n",
+                u8"    \"koKR\": \"최대 화염 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do maksymalnych obrażeń od ognia\",\n",
+                u8"    \"esMX\": \"%+d de daño de fuego máximo\",\n",
+                u8"    \"jaJP\": \"最大火炎ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano ígneo máximo\",\n",
+                u8"    \"ruRU\": \"%+d к максимальному урону от огня\",\n",
+                u8"    \"zhCN\": \"%+d 最大火焰伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3488,\n",
+                u8"    \"Key\": \"ModStr1p\",\n",
+                u8"    \"enUS\": \"%+d to Minimum Fire Damage\",\n",
+                u8"    \"zhTW\": \"%+d 火焰傷害最小值\",\n",
+                u8"    \"deDE\": \"%+d zu min. Feuerschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño mínimo de fuego\",\n",
+                u8"    \"frFR\": \"%+d aux dégâts de Feu min.\",\n",
+                u8"    \"itIT\": \"%+d ai danni minimi da fuoco\",\n",
+                u8"    \"koKR\": \"최소 화염 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do minimalnych obrażeń od ognia\",\n",
+                u8"    \"esMX\": \"%+d de daño de fuego mínimo\",\n",
+                u8"    \"jaJP\": \"最小火炎ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano ígneo mínimo\",\n",
+                u8"    \"ruRU\": \"%+d к минимальному урону от огня\",\n",
+                u8"    \"zhCN\": \"%+d 最小火焰伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3489,\n",
+                u8"    \"Key\": \"ModStr1q\",\n",
+                u8"    \"enUS\": \"%+d to Maximum Lightning Damage\",\n",
+                u8"    \"zhTW\": \"%+d 電擊傷害最大值\",\n",
+                u8"    \"deDE\": \"%+d zu max. Blitzschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño máximo de rayos\",\n",
+                u8"    \"frFR\": \"%+d aux dégâts de Foudre max.\",\n",
+                u8"    \"itIT\": \"%+d ai danni massimi da fulmine\",\n",
+                u8"    \"koKR\": \"최대 번개 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do maksymalnych obrażeń od błyskawic\",\n",
+                u8"    \"esMX\": \"%+d de daño de rayo máximo\",\n",
+                u8"    \"jaJP\": \"最大電撃ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano elétrico máximo\",\n",
+                u8"    \"ruRU\": \"%+d к максимальному урону от молнии\",\n",
+                u8"    \"zhCN\": \"%+d 最大闪电伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3490,\n",
+                u8"    \"Key\": \"ModStr1r\",\n",
+                u8"    \"enUS\": \"%+d to Minimum Lightning Damage\",\n",
+                u8"    \"zhTW\": \"%+d 電擊傷害最小值\",\n",
+                u8"    \"deDE\": \"%+d zu min. Blitzschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño mínimo de rayos\",\n",
+                u8"    \"frFR\": \"%+d aux dégâts de Foudre min.\",\n",
+                u8"    \"itIT\": \"%+d ai danni minimi da fulmine\",\n",
+                u8"    \"koKR\": \"최소 번개 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do minimalnych obrażeń od błyskawic\",\n",
+                u8"    \"esMX\": \"%+d de daño de rayo mínimo\",\n",
+                u8"    \"jaJP\": \"最小電撃ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano elétrico mínimo\",\n",
+                u8"    \"ruRU\": \"%+d к минимальному урону от молнии\",\n",
+                u8"    \"zhCN\": \"%+d 最小闪电伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3491,\n",
+                u8"    \"Key\": \"ModStr1s\",\n",
+                u8"    \"enUS\": \"%+d to Maximum Cold Damage\",\n",
+                u8"    \"zhTW\": \"%+d 冰寒傷害最大值\",\n",
+                u8"    \"deDE\": \"%+d zu max. Kälteschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño máximo de frío\",\n",
+                u8"    \"frFR\": \"%+d aux dégâts de Froid max.\",\n",
+                u8"    \"itIT\": \"%+d ai danni massimi da freddo\",\n",
+                u8"    \"koKR\": \"최대 냉기 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do maksymalnych obrażeń od zimna\",\n",
+                u8"    \"esMX\": \"%+d de daño de frío máximo\",\n",
+                u8"    \"jaJP\": \"最大冷気ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano gélido máximo\",\n",
+                u8"    \"ruRU\": \"%+d к максимальному урону от льда\",\n",
+                u8"    \"zhCN\": \"%+d 最大冰霜伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3492,\n",
+                u8"    \"Key\": \"ModStr1t\",\n",
+                u8"    \"enUS\": \"%+d to Minimum Cold Damage\",\n",
+                u8"    \"zhTW\": \"%+d 冰寒傷害最小值\",\n",
+                u8"    \"deDE\": \"%+d zu min. Kälteschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño mínimo de frío\",\n",
+                u8"    \"frFR\": \"%+d aux dégâts de Froid min.\",\n",
+                u8"    \"itIT\": \"%+d ai danni minimi da freddo\",\n",
+                u8"    \"koKR\": \"최소 냉기 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do minimalnych obrażeń od zimna\",\n",
+                u8"    \"esMX\": \"%+d de daño de frío mínimo\",\n",
+                u8"    \"jaJP\": \"最小冷気ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano gélido mínimo\",\n",
+                u8"    \"ruRU\": \"%+d к минимальному урону от льда\",\n",
+                u8"    \"zhCN\": \"%+d 最小冰霜伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3493,\n",
+                u8"    \"Key\": \"ModStr1u\",\n",
+                u8"    \"enUS\": \"%+d to Life\",\n",
+                u8"    \"zhTW\": \"%+d 生命\",\n",
+                u8"    \"deDE\": \"%+d zu Leben\",\n",
+                u8"    \"esES\": \"%+d p. de vida\",\n",
+                u8"    \"frFR\": \"%+d aux points de vie\",\n",
+                u8"    \"itIT\": \"%+d vita\",\n",
+                u8"    \"koKR\": \"생명력 %+d\",\n",
+                u8"    \"plPL\": \"%+d do zdrowia\",\n",
+                u8"    \"esMX\": \"%+d de vida\",\n",
+                u8"    \"jaJP\": \"ライフ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de pontos de vida\",\n",
+                u8"    \"ruRU\": \"%+d к здоровью\",\n",
+                u8"    \"zhCN\": \"%+d 生命\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3494,\n",
+                u8"    \"Key\": \"ModStr1v\",\n",
+                u8"    \"enUS\": \"Attacker Takes Damage of %d\",\n",
+                u8"    \"zhTW\": \"攻擊者反傷：%d\",\n",
+                u8"    \"deDE\": \"Angreifer erleidet Schaden von %d\",\n",
+                u8"    \"esES\": \"Los atacantes reciben %d p. de daño\",\n",
+                u8"    \"frFR\": \"L’adversaire subit des dégâts de %d\",\n",
+                u8"    \"itIT\": \"Gli attaccanti subiscono danni pari a %d\",\n",
+                u8"    \"koKR\": \"공격자가 피해를 %d 받음\",\n",
+                u8"    \"plPL\": \"Atakujący otrzymują %d pkt. obrażeń\",\n",
+                u8"    \"esMX\": \"El atacante recibe %d de daño\",\n",
+                u8"    \"jaJP\": \"反撃ダメージ（%d）を与える\",\n",
+                u8"    \"ptBR\": \"Agressor recebe %d de dano\",\n",
+                u8"    \"ruRU\": \"Атакующий получает %d урона\",\n",
+                u8"    \"zhCN\": \"攻击者受到 %d 点伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3497,\n",
+                u8"    \"Key\": \"ModStr1y\",\n",
+                u8"    \"enUS\": \"Knockback\",\n",
+                u8"    \"zhTW\": \"擊退\",\n",
+                u8"    \"deDE\": \"Rückstoß\",\n",
+                u8"    \"esES\": \"Repele al objetivo\",\n",
+                u8"    \"frFR\": \"Renversement\",\n",
+                u8"    \"itIT\": \"Respinge il bersaglio\",\n",
+                u8"    \"koKR\": \"밀쳐내기\",\n",
+                u8"    \"plPL\": \"Odrzucanie\",\n",
+                u8"    \"esMX\": \"Retroceso\",\n",
+                u8"    \"jaJP\": \"ノックバック\",\n",
+                u8"    \"ptBR\": \"Repulsão\",\n",
+                u8"    \"ruRU\": \"Отбрасывает врагов\",\n",
+                u8"    \"zhCN\": \"击退\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3498,\n",
+                u8"    \"Key\": \"ModStr1z\",\n",
+                u8"    \"enUS\": \"Elixir of Strength\",\n",
+                u8"    \"zhTW\": \"力量靈藥\",\n",
+                u8"    \"deDE\": \"Elixier der Stärke\",\n",
+                u8"    \"esES\": \"Elixir de fuerza\",\n",
+                u8"    \"frFR\": \"Élixir de Force\",\n",
+                u8"    \"itIT\": \"Elisir della Forza\",\n",
+                u8"    \"koKR\": \"힘의 비약\",\n",
+                u8"    \"plPL\": \"Eliksir siły\",\n",
+                u8"    \"esMX\": \"Elíxir de fuerza\",\n",
+                u8"    \"jaJP\": \"力のエリクサー\",\n",
+                u8"    \"ptBR\": \"Elixir de Força\",\n",
+                u8"    \"ruRU\": \"Эликсир силы\",\n",
+                u8"    \"zhCN\": \"力量药剂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3499,\n",
+                u8"    \"Key\": \"ModStr2a\",\n",
+                u8"    \"enUS\": \"Elixir of Dexterity\",\n",
+                u8"    \"zhTW\": \"敏捷靈藥\",\n",
+                u8"    \"deDE\": \"Elixier der Geschicklichkeit\",\n",
+                u8"    \"esES\": \"Elixir de destreza\",\n",
+                u8"    \"frFR\": \"Élixir de Dextérité\",\n",
+                u8"    \"itIT\": \"Elisir della Destrezza\",\n",
+                u8"    \"koKR\": \"민첩의 비약\",\n",
+                u8"    \"plPL\": \"Eliksir zręczności\",\n",
+                u8"    \"esMX\": \"Elíxir de destreza\",\n",
+                u8"    \"jaJP\": \"敏捷性のエリクサー\",\n",
+                u8"    \"ptBR\": \"Elixir de Destreza\",\n",
+                u8"    \"ruRU\": \"Эликсир ловкости\",\n",
+                u8"    \"zhCN\": \"敏捷药剂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3500,\n",
+                u8"    \"Key\": \"ModStr2b\",\n",
+                u8"    \"enUS\": \"Elixir of Energy\",\n",
+                u8"    \"zhTW\": \"能量靈藥\",\n",
+                u8"    \"deDE\": \"Elixier der Energie\",\n",
+                u8"    \"esES\": \"Elixir de energía\",\n",
+                u8"    \"frFR\": \"Élixir d’Énergie\",\n",
+                u8"    \"itIT\": \"Elisir dell'Energia\",\n",
+                u8"    \"koKR\": \"마력의 비약\",\n",
+                u8"    \"plPL\": \"Eliksir energii\",\n",
+                u8"    \"esMX\": \"Elíxir de energía\",\n",
+                u8"    \"jaJP\": \"エナジーのエリクサー\",\n",
+                u8"    \"ptBR\": \"Elixir de Energia\",\n",
+                u8"    \"ruRU\": \"Эликсир энергии\",\n",
+                u8"    \"zhCN\": \"能量药剂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3501,\n",
+                u8"    \"Key\": \"ModStr2c\",\n",
+                u8"    \"enUS\": \"Elixir of Vitality\",\n",
+                u8"    \"zhTW\": \"體能靈藥\",\n",
+                u8"    \"deDE\": \"Elixier der Vitalität\",\n",
+                u8"    \"esES\": \"Elixir de vitalidad\",\n",
+                u8"    \"frFR\": \"Élixir de Vitalité\",\n",
+                u8"    \"itIT\": \"Elisir della Vitalità\",\n",
+                u8"    \"koKR\": \"활력의 비약\",\n",
+                u8"    \"plPL\": \"Eliksir żywotności\",\n",
+                u8"    \"esMX\": \"Elíxir de vitalidad\",\n",
+                u8"    \"jaJP\": \"生命力のエリクサー\",\n",
+                u8"    \"ptBR\": \"Elixir de Vitalidade\",\n",
+                u8"    \"ruRU\": \"Эликсир живучести\",\n",
+                u8"    \"zhCN\": \"活力药剂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3502,\n",
+                u8"    \"Key\": \"ModStr2d\",\n",
+                u8"    \"enUS\": \"Elixir of Mana\",\n",
+                u8"    \"zhTW\": \"法力靈藥\",\n",
+                u8"    \"deDE\": \"Elixier mit Mana\",\n",
+                u8"    \"esES\": \"Elixir de maná\",\n",
+                u8"    \"frFR\": \"Élixir de Mana\",\n",
+                u8"    \"itIT\": \"Elisir del Mana\",\n",
+                u8"    \"koKR\": \"마나의 비약\",\n",
+                u8"    \"plPL\": \"Eliksir many\",\n",
+                u8"    \"esMX\": \"Elíxir de maná\",\n",
+                u8"    \"jaJP\": \"マナのエリクサー\",\n",
+                u8"    \"ptBR\": \"Elixir de Mana\",\n",
+                u8"    \"ruRU\": \"Эликсир маны\",\n",
+                u8"    \"zhCN\": \"法力药剂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3503,\n",
+                u8"    \"Key\": \"ModStr2e\",\n",
+                u8"    \"enUS\": \"Elixir of Life\",\n",
+                u8"    \"zhTW\": \"生命靈藥\",\n",
+                u8"    \"deDE\": \"Elixier des Lebens\",\n",
+                u8"    \"esES\": \"Elixir de vida\",\n",
+                u8"    \"frFR\": \"Élixir de Vie\",\n",
+                u8"    \"itIT\": \"Elisir della Vita\",\n",
+                u8"    \"koKR\": \"생명력의 비약\",\n",
+                u8"    \"plPL\": \"Eliksir zdrowia\",\n",
+                u8"    \"esMX\": \"Elíxir de vida\",\n",
+                u8"    \"jaJP\": \"ライフのエリクサー\",\n",
+                u8"    \"ptBR\": \"Elixir de Vida\",\n",
+                u8"    \"ruRU\": \"Эликсир здоровья\",\n",
+                u8"    \"zhCN\": \"生命药剂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3504,\n",
+                u8"    \"Key\": \"ModStr2f\",\n",
+                u8"    \"enUS\": \"Sec. Duration\",\n",
+                u8"    \"zhTW\": \"持續秒數\",\n",
+                u8"    \"deDE\": \"Sek. Dauer\",\n",
+                u8"    \"esES\": \"s de duración\",\n",
+                u8"    \"frFR\": \"Durée en s\",\n",
+                u8"    \"itIT\": \"s di durata\",\n",
+                u8"    \"koKR\": \"초 지속\",\n",
+                u8"    \"plPL\": \"Sek. trwania\",\n",
+                u8"    \"esMX\": \"Seg. de duración\",\n",
+                u8"    \"jaJP\": \"秒間持続\",\n",
+                u8"    \"ptBR\": \"Duração em segundos\",\n",
+                u8"    \"ruRU\": \"сек. времени действия\",\n",
+                u8"    \"zhCN\": \"秒持续时间\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3505,\n",
+                u8"    \"Key\": \"ModStr2g\",\n",
+                u8"    \"enUS\": \"Increase Maximum Life %d%%\",\n",
+                u8"    \"zhTW\": \"生命上限提高 %d%%\",\n",
+                u8"    \"deDE\": \"Erhöht max. Leben %d%%\",\n",
+                u8"    \"esES\": \"Aumenta la vida máxima un %d%%\",\n",
+                u8"    \"frFR\": \"Augmente les points de vie max. de %d%%\",\n",
+                u8"    \"itIT\": \"Vita massima aumentata del %d%%\",\n",
+                u8"    \"koKR\": \"최대 생명력 %d%% 증가\",\n",
+                u8"    \"plPL\": \"+%d%% do maksymalnej wartości punktów zdrowia\",\n",
+                u8"    \"esMX\": \"%d%% más de vida máxima\",\n",
+                u8"    \"jaJP\": \"ライフの最大値上昇（%d%%）\",\n",
+                u8"    \"ptBR\": \"Aumenta o máximo de pontos de vida em %d%%\",\n",
+                u8"    \"ruRU\": \"+%d%% к максимальному запасу здоровья\",\n",
+                u8"    \"zhCN\": \"+%d%% 生命最大值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3506,\n",
+                u8"    \"Key\": \"ModStr2h\",\n",
+                u8"    \"enUS\": \"Increase Maximum Mana %d%%\",\n",
+                u8"    \"zhTW\": \"法力上限提高 %d%%\",\n",
+                u8"    \"deDE\": \"Erhöht max. Mana %d%%\",\n",
+                u8"    \"esES\": \"Aumenta el maná máximo un %d%%\",\n",
+                u8"    \"frFR\": \"Augmente les points de mana max. de %d%%\",\n",
+                u8"    \"itIT\": \"Mana massimo aumentato del %d%%\",\n",
+                u8"    \"koKR\": \"최대 마나 %d%% 증가\",\n",
+                u8"    \"plPL\": \"+%d%% do maksymalnej wartości punktów many\",\n",
+                u8"    \"esMX\": \"%d%% más de maná máximo\",\n",
+                u8"    \"jaJP\": \"マナの最大値上昇（%d%%）\",\n",
+                u8"    \"ptBR\": \"Aumenta o máximo de mana em %d%%\",\n",
+                u8"    \"ruRU\": \"+%d%% к максимальному запасу маны\",\n",
+                u8"    \"zhCN\": \"+%d%% 法力最大值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3507,\n",
+                u8"    \"Key\": \"ModStr2i\",\n",
+                u8"    \"enUS\": \"Increase Maximum Durability %d%%\",\n",
+                u8"    \"zhTW\": \"耐久度上限提高 %d%%\",\n",
+                u8"    \"deDE\": \"Erhöht max. Haltbarkeit %d%%\",\n",
+                u8"    \"esES\": \"Aumenta la durabilidad máxima un %d%%\",\n",
+                u8"    \"frFR\": \"Augmente les points de durabilité max. de %d%%\",\n",
+                u8"    \"itIT\": \"Integrità massima aumentata del %d%%\",\n",
+                u8"    \"koKR\": \"최대 내구도 %d%% 증가\",\n",
+                u8"    \"plPL\": \"+%d%% do maksymalnej wartości punktów trwałości\",\n",
+                u8"    \"esMX\": \"%d%% más de durabilidad máxima\",\n",
+                u8"    \"jaJP\": \"耐久力の最大値上昇（%d%%）\",\n",
+                u8"    \"ptBR\": \"Aumenta a durabilidade máxima em %d%%\",\n",
+                u8"    \"ruRU\": \"+%d%% к максимальной прочности\",\n",
+                u8"    \"zhCN\": \"+%d%% 最大耐久度\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3508,\n",
+                u8"    \"Key\": \"ModStr2j\",\n",
+                u8"    \"enUS\": \"%+d%% Enhanced Maximum Damage\",\n",
+                u8"    \"zhTW\": \"%+d%% 最大傷害強化\",\n",
+                u8"    \"deDE\": \"%+d%% Verbesserter max. Schaden\",\n",
+                u8"    \"esES\": \"%+d%% de daño máximo mejorado\",\n",
+                u8"    \"frFR\": \"Dégâts max. améliorés de %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% danni massimi\",\n",
+                u8"    \"koKR\": \"최대 피해 %+d%% 증가\",\n",
+                u8"    \"plPL\": \"%+d%% do maksymalnych obrażeń\",\n",
+                u8"    \"esMX\": \"%+d%% de daño máximo mejorado\",\n",
+                u8"    \"jaJP\": \"最大ダメージ強化（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de dano máximo aprimorado\",\n",
+                u8"    \"ruRU\": \"%+d%% к максимальному урону\",\n",
+                u8"    \"zhCN\": \"%+d%% 强化最大伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3509,\n",
+                u8"    \"Key\": \"ModStr2k\",\n",
+                u8"    \"enUS\": \"%+d%% Enhanced Minimum Damage\",\n",
+                u8"    \"zhTW\": \"%+d%% 最小傷害強化\",\n",
+                u8"    \"deDE\": \"%+d%% Verbesserter min. Schaden\",\n",
+                u8"    \"esES\": \"%+d%% de daño mínimo mejorado\",\n",
+                u8"    \"frFR\": \"Dégâts min. améliorés de %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% danni minimi\",\n",
+                u8"    \"koKR\": \"최소 피해 %+d%% 증가\",\n",
+                u8"    \"plPL\": \"%+d%% do minimalnych obrażeń\",\n",
+                u8"    \"esMX\": \"%+d%% de daño mínimo mejorado\",\n",
+                u8"    \"jaJP\": \"最小ダメージ強化（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de dano mínimo aprimorado\",\n",
+                u8"    \"ruRU\": \"%+d%% к минимальному урону\",\n",
+                u8"    \"zhCN\": \"%+d%% 强化最小伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3510,\n",
+                u8"    \"Key\": \"ModStr2l\",\n",
+                u8"    \"enUS\": \"Replenish Life %+d\",\n",
+                u8"    \"zhTW\": \"生命回復 %+d\",\n",
+                u8"    \"deDE\": \"Lebensregeneration %+d\",\n",
+                u8"    \"esES\": \"%+d de regeneración de vida\",\n",
+                u8"    \"frFR\": \"Rend %+d PV\",\n",
+                u8"    \"itIT\": \"%+d rigenerazione della vita\",\n",
+                u8"    \"koKR\": \"생명력 회복 %+d\",\n",
+                u8"    \"plPL\": \"%+d do przywracania zdrowia\",\n",
+                u8"    \"esMX\": \"%+d de regeneración de vida\",\n",
+                u8"    \"jaJP\": \"ライフをゆっくりと回復（%+d）\",\n",
+                u8"    \"ptBR\": \"Restaura pontos de vida em %+d\",\n",
+                u8"    \"ruRU\": \"Восполняет %+d здоровья\",\n",
+                u8"    \"zhCN\": \"补充生命 %+d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3511,\n",
+                u8"    \"Key\": \"ModStr2m\",\n",
+                u8"    \"enUS\": \"Replenish Mana\",\n",
+                u8"    \"zhTW\": \"回復法力\",\n",
+                u8"    \"deDE\": \"Manaregeneration\",\n",
+                u8"    \"esES\": \"Restaura maná\",\n",
+                u8"    \"frFR\": \"Rend du mana\",\n",
+                u8"    \"itIT\": \"Rigenera mana\",\n",
+                u8"    \"koKR\": \"마나 회복\",\n",
+                u8"    \"plPL\": \"Odnowienie many\",\n",
+                u8"    \"esMX\": \"Regenera maná\",\n",
+                u8"    \"jaJP\": \"マナをゆっくりと回復\",\n",
+                u8"    \"ptBR\": \"Restauração de mana\",\n",
+                u8"    \"ruRU\": \"Восполнение маны\",\n",
+                u8"    \"zhCN\": \"补充法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3512,\n",
+                u8"    \"Key\": \"ModStr2n\",\n",
+                u8"    \"enUS\": \"Heal 1/4 Life\",\n",
+                u8"    \"zhTW\": \"醫治 1/4 生命\",\n",
+                u8"    \"deDE\": \"¼ Leben heilen\",\n",
+                u8"    \"esES\": \"Cura un 25% de vida\",\n",
+                u8"    \"frFR\": \"Rend 1/4 des PV\",\n",
+                u8"    \"itIT\": \"Rigenera 1/4 della vita\",\n",
+                u8"    \"koKR\": \"생명력 1/4 회복\",\n",
+                u8"    \"plPL\": \"Przywraca 1/4 zdrowia\",\n",
+                u8"    \"esMX\": \"Sana 1/4 de vida\",\n",
+                u8"    \"jaJP\": \"ライフを回復（25%%）\",\n",
+                u8"    \"ptBR\": \"Cura 1/4 de vida\",\n",
+                u8"    \"ruRU\": \"Восполняет 1/4 здоровья\",\n",
+                u8"    \"zhCN\": \"治愈1/4生命\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3513,\n",
+                u8"    \"Key\": \"ModStr2o\",\n",
+                u8"    \"enUS\": \"Heal 1/2 Life\",\n",
+                u8"    \"zhTW\": \"醫治 1/2 生命\",\n",
+                u8"    \"deDE\": \"½ Leben heilen\",\n",
+                u8"    \"esES\": \"Cura un 50% de vida\",\n",
+                u8"    \"frFR\": \"Rend 1/2 des PV\",\n",
+                u8"    \"itIT\": \"Rigenera 1/2 della vita\",\n",
+                u8"    \"koKR\": \"생명력 1/2 회복\",\n",
+                u8"    \"plPL\": \"Przywraca 1/2 zdrowia\",\n",
+                u8"    \"esMX\": \"Sana 1/2 de vida\",\n",
+                u8"    \"jaJP\": \"ライフを回復（50%%）\",\n",
+                u8"    \"ptBR\": \"Cura 1/2 vida\",\n",
+                u8"    \"ruRU\": \"Восполняет 1/2 здоровья\",\n",
+                u8"    \"zhCN\": \"治愈1/2生命\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3514,\n",
+                u8"    \"Key\": \"ModStr2p\",\n",
+                u8"    \"enUS\": \"Restore Full Life\",\n",
+                u8"    \"zhTW\": \"醫治所有生命\",\n",
+                u8"    \"deDE\": \"Volles Leben wiederherstellen\",\n",
+                u8"    \"esES\": \"Restaura toda la vida\",\n",
+                u8"    \"frFR\": \"Rend tous les PV\",\n",
+                u8"    \"itIT\": \"Rigenera tutta la vita\",\n",
+                u8"    \"koKR\": \"생명력 전체 회복\",\n",
+                u8"    \"plPL\": \"Przywraca pełne zdrowie\",\n",
+                u8"    \"esMX\": \"Restaura toda la vida\",\n",
+                u8"    \"jaJP\": \"ライフを完全回復\",\n",
+                u8"    \"ptBR\": \"Recuperação de vida integral\",\n",
+                u8"    \"ruRU\": \"Полное восполнение здоровья\",\n",
+                u8"    \"zhCN\": \"恢复所有生命\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3515,\n",
+                u8"    \"Key\": \"ModStr2q\",\n",
+                u8"    \"enUS\": \"Replenish 1/4 Mana\",\n",
+                u8"    \"zhTW\": \"回復 1/4 法力\",\n",
+                u8"    \"deDE\": \"¼ Mana wiederherstellen\",\n",
+                u8"    \"esES\": \"Restaura un 25% de maná\",\n",
+                u8"    \"frFR\": \"Rend 1/4 de mana\",\n",
+                u8"    \"itIT\": \"Rigenera 1/4 del mana\",\n",
+                u8"    \"koKR\": \"마나 1/4 회복\",\n",
+                u8"    \"plPL\": \"Odnawia 1/4 many\",\n",
+                u8"    \"esMX\": \"Regenera 1/4 de maná\",\n",
+                u8"    \"jaJP\": \"マナをゆっくりと回復（25%%）\",\n",
+                u8"    \"ptBR\": \"Restaura 1/4 de mana\",\n",
+                u8"    \"ruRU\": \"Восполняет 1/4 маны\",\n",
+                u8"    \"zhCN\": \"补充1/4法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3516,\n",
+                u8"    \"Key\": \"ModStr2r\",\n",
+                u8"    \"enUS\": \"Replenish 1/2 Life\",\n",
+                u8"    \"zhTW\": \"回復 1/2 生命\",\n",
+                u8"    \"deDE\": \"½ Mana wiederherstellen\",\n",
+                u8"    \"esES\": \"Restaura un 50% de vida\",\n",
+                u8"    \"frFR\": \"Rend 1/2 de mana\",\n",
+                u8"    \"itIT\": \"Rigenera 1/2 del mana\",\n",
+                u8"    \"koKR\": \"마나 1/2 회복\",\n",
+                u8"    \"plPL\": \"Odnawia 1/2 many\",\n",
+                u8"    \"esMX\": \"Regenera 1/2 de vida\",\n",
+                u8"    \"jaJP\": \"ライフをゆっくりと回復（50%%）\",\n",
+                u8"    \"ptBR\": \"Restaura 1/2 vida\",\n",
+                u8"    \"ruRU\": \"Восполняет 1/2 здоровья\",\n",
+                u8"    \"zhCN\": \"补充1/2生命\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3517,\n",
+                u8"    \"Key\": \"ModStr2s\",\n",
+                u8"    \"enUS\": \"Restore Full Mana\",\n",
+                u8"    \"zhTW\": \"回復所有法力\",\n",
+                u8"    \"deDE\": \"Volles Mana wiederherstellen\",\n",
+                u8"    \"esES\": \"Restaura todo el maná\",\n",
+                u8"    \"frFR\": \"Rend tous les pts de mana\",\n",
+                u8"    \"itIT\": \"Rigenera tutto il mana\",\n",
+                u8"    \"koKR\": \"마나 전체 회복\",\n",
+                u8"    \"plPL\": \"Odnawia całą manę\",\n",
+                u8"    \"esMX\": \"Restaura todo el maná\",\n",
+                u8"    \"jaJP\": \"マナを完全回復\",\n",
+                u8"    \"ptBR\": \"Recuperação de mana integral\",\n",
+                u8"    \"ruRU\": \"Полностью восполняет ману\",\n",
+                u8"    \"zhCN\": \"恢复所有法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3518,\n",
+                u8"    \"Key\": \"ModStr2t\",\n",
+                u8"    \"enUS\": \"Magic Damage Reduced by %d\",\n",
+                u8"    \"zhTW\": \"魔法傷害降低 %d\",\n",
+                u8"    \"deDE\": \"Magieschaden reduziert um %d\",\n",
+                u8"    \"esES\": \"Daño mágico reducido en %d p.\",\n",
+                u8"    \"frFR\": \"Dégâts magiques réduits de %d\",\n",
+                u8"    \"itIT\": \"Danni magici ridotti di %d\",\n",
+                u8"    \"koKR\": \"마법 피해 %d 감소\",\n",
+                u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od magii o %d pkt.\",\n",
+                u8"    \"esMX\": \"Reduce en %d el daño mágico\",\n",
+                u8"    \"jaJP\": \"魔法ダメージを軽減（%d）\",\n",
+                u8"    \"ptBR\": \"Dano mágico reduzido em %d\",\n",
+                u8"    \"ruRU\": \"–%d к магическому урону\",\n",
+                u8"    \"zhCN\": \"魔法伤害降低 %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3519,\n",
+                u8"    \"Key\": \"ModStr2u\",\n",
+                u8"    \"enUS\": \"Damage Reduced by %d\",\n",
+                u8"    \"zhTW\": \"傷害降低 %d\",\n",
+                u8"    \"deDE\": \"Schaden reduziert um %d\",\n",
+                u8"    \"esES\": \"Daño reducido en %d p.\",\n",
+                u8"    \"frFR\": \"Dégâts réduits de %d\",\n",
+                u8"    \"itIT\": \"Danni ridotti di %d\",\n",
+                u8"    \"koKR\": \"피해 %d 감소\",\n",
+                u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia o %d pkt.\",\n",
+                u8"    \"esMX\": \"Reduce en %d el daño\",\n",
+                u8"    \"jaJP\": \"ダメージを軽減（%d）\",\n",
+                u8"    \"ptBR\": \"Dano reduzido em %d\",\n",
+                u8"    \"ruRU\": \"–%d к урону\",\n",
+                u8"    \"zhCN\": \"伤害降低 %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3520,\n",
+                u8"    \"Key\": \"Modstr2v\",\n",
+                u8"    \"enUS\": \"%+d%% Enhanced Defense\",\n",
+                u8"    \"zhTW\": \"%+d%% 防禦強化\",\n",
+                u8"    \"deDE\": \"%+d%% verbesserte Verteidigung\",\n",
+                u8"    \"esES\": \"%+d%% de defensa mejorada\",\n",
+                u8"    \"frFR\": \"Défense augmentée de %+d%% \",\n",
+                u8"    \"itIT\": \"%+d%% difesa\",\n",
+                u8"    \"koKR\": \"방어력 %+d%% 증가\",\n",
+                u8"    \"plPL\": \"%+d%% do obrony\",\n",
+                u8"    \"esMX\": \"%+d%% de defensa mejorada\",\n",
+                u8"    \"jaJP\": \"防御力を強化（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de defesa aprimorada\",\n",
+                u8"    \"ruRU\": \"%+d%% к защите\",\n",
+                u8"    \"zhCN\": \"%+d%% 强化防御\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3521,\n",
+                u8"    \"Key\": \"ModStr2w\",\n",
+                u8"    \"enUS\": \"Drain Life %d\",\n",
+                u8"    \"zhTW\": \"吸取生命 %d\",\n",
+                u8"    \"deDE\": \"Lebensverlust %d\",\n",
+                u8"    \"esES\": \"Drenaje de vida %d\",\n",
+                u8"    \"frFR\": \"Drain de vie %d\",\n",
+                u8"    \"itIT\": \"%d di risucchio vita\",\n",
+                u8"    \"koKR\": \"생명력 흡수 %d\",\n",
+                u8"    \"plPL\": \"%d Do wyssania zdrowia\",\n",
+                u8"    \"esMX\": \"Drenaje de vida %d\",\n",
+                u8"    \"jaJP\": \"ライフに継続ダメージ（%d）\",\n",
+                u8"    \"ptBR\": \"Drenagem de vida %d\",\n",
+                u8"    \"ruRU\": \"Похищает %d здоровья\",\n",
+                u8"    \"zhCN\": \"抽取生命 %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3522,\n",
+                u8"    \"Key\": \"ModStr2x\",\n",
+                u8"    \"enUS\": \"Drain Mana\",\n",
+                u8"    \"zhTW\": \"吸取法力\",\n",
+                u8"    \"deDE\": \"Manaverlust\",\n",
+                u8"    \"esES\": \"Drena maná\",\n",
+                u8"    \"frFR\": \"Drain de mana\",\n",
+                u8"    \"itIT\": \"Risucchia mana\",\n",
+                u8"    \"koKR\": \"마나 흡수\",\n",
+                u8"    \"plPL\": \"Wyssanie many\",\n",
+                u8"    \"esMX\": \"Drena maná\",\n",
+                u8"    \"jaJP\": \"マナに継続ダメージ\",\n",
+                u8"    \"ptBR\": \"Drenagem de mana\",\n",
+                u8"    \"ruRU\": \"Похищение маны\",\n",
+                u8"    \"zhCN\": \"抽取法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3523,\n",
+                u8"    \"Key\": \"ModStr2y\",\n",
+                u8"    \"enUS\": \"%d%% Mana stolen per hit\",\n",
+                u8"    \"zhTW\": \"擊中竊取 %d%% 法力\",\n",
+                u8"    \"deDE\": \"%d%% abgesaugtes Mana pro Treffer\",\n",
+                u8"    \"esES\": \"%d%% de maná robado por golpe\",\n",
+                u8"    \"frFR\": \"%d%% de mana volé à chaque coup\",\n",
+                u8"    \"itIT\": \"%d%% mana rubato per colpo\",\n",
+                u8"    \"koKR\": \"적중당 마나 %d%% 훔침\",\n",
+                u8"    \"plPL\": \"%d%% many wykradzione za każde trafienie\",\n",
+                u8"    \"esMX\": \"%d%% de maná robado por golpe\",\n",
+                u8"    \"jaJP\": \"攻撃命中でマナを吸収（与ダメージの%d%%）\",\n",
+                u8"    \"ptBR\": \"%d%% de mana roubado por acerto\",\n",
+                u8"    \"ruRU\": \"Похищает %d%% маны за удар\",\n",
+                u8"    \"zhCN\": \"%d%% 击中时偷取法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3524,\n",
+                u8"    \"Key\": \"ModStr2z\",\n",
+                u8"    \"enUS\": \"%d%% Life stolen per hit\",\n",
+                u8"    \"zhTW\": \"擊中竊取 %d%% 生命\",\n",
+                u8"    \"deDE\": \"%d%% abgesaugtes Leben pro Treffer\",\n",
+                u8"    \"esES\": \"%d%% de vida robada por golpe\",\n",
+                u8"    \"frFR\": \"%d%% de vie volée à chaque coup\",\n",
+                u8"    \"itIT\": \"%d%% vita rubata per colpo\",\n",
+                u8"    \"koKR\": \"적중당 생명력 %d%% 훔침\",\n",
+                u8"    \"plPL\": \"%d%% zdrowia wykradzione za każde trafienie\",\n",
+                u8"    \"esMX\": \"%d%% de vida robada por golpe\",\n",
+                u8"    \"jaJP\": \"攻撃命中でライフを吸収（与ダメージの%d%%）\",\n",
+                u8"    \"ptBR\": \"%d%% de pontos de vida roubados por acerto\",\n",
+                u8"    \"ruRU\": \"Похищает %d%% здоровья за удар\",\n",
+                u8"    \"zhCN\": \"%d%% 击中时偷取生命\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3525,\n",
+                u8"    \"Key\": \"ModStr3a\",\n",
+                u8"    \"enUS\": \"%+d to Amazon Skill Levels\",\n",
+                u8"    \"zhTW\": \"%+d 亞馬遜技能等級\",\n",
+                u8"    \"deDE\": \"%+d zu Amazonenfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los niveles de habilidad de la amazona\",\n",
+                u8"    \"frFR\": \"%+d aux niv. de compétence de l’Amazone\",\n",
+                u8"    \"itIT\": \"%+d alle abilità dell'Amazzone\",\n",
+                u8"    \"koKR\": \"아마존 기술 레벨 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności amazonki\",\n",
+                u8"    \"esMX\": \"%+d a los niveles de habilidad de la Amazona\",\n",
+                u8"    \"jaJP\": \"〈アマゾネス〉スキルレベル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de níveis de habilidade de Amazona\",\n",
+                u8"    \"ruRU\": \"%+d к уровню умений амазонки\",\n",
+                u8"    \"zhCN\": \"%+d 亚马逊技能等级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3526,\n",
+                u8"    \"Key\": \"ModStr3b\",\n",
+                u8"    \"enUS\": \"%+d to Paladin Skill Levels\",\n",
+                u8"    \"zhTW\": \"%+d 聖騎士技能等級\",\n",
+                u8"    \"deDE\": \"%+d zu Paladinfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los niveles de habilidad del paladín\",\n",
+                u8"    \"frFR\": \"%+d aux niv. de compétence du Paladin\",\n",
+                u8"    \"itIT\": \"%+d alle abilità del Paladino\",\n",
+                u8"    \"koKR\": \"성기사 기술 레벨 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności paladyna\",\n",
+                u8"    \"esMX\": \"%+d a los niveles de habilidad del Paladín\",\n",
+                u8"    \"jaJP\": \"〈パラディン〉スキルレベル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de níveis de habilidade de Paladino\",\n",
+                u8"    \"ruRU\": \"%+d к уровню умений паладина\",\n",
+                u8"    \"zhCN\": \"%+d 圣骑士技能等级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3527,\n",
+                u8"    \"Key\": \"ModStr3c\",\n",
+                u8"    \"enUS\": \"%+d to Necromancer Skill Levels\",\n",
+                u8"    \"zhTW\": \"%+d 死靈法師技能等級\",\n",
+                u8"    \"deDE\": \"%+d zu Totenbeschwörerfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los niveles de habilidad del nigromante\",\n",
+                u8"    \"frFR\": \"%+d aux niv. de compétence du Nécromancien\",\n",
+                u8"    \"itIT\": \"%+d alle abilità del Negromante\",\n",
+                u8"    \"koKR\": \"강령술사 기술 레벨 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności nekromanty\",\n",
+                u8"    \"esMX\": \"%+d a los niveles de habilidad del Nigromante\",\n",
+                u8"    \"jaJP\": \"〈ネクロマンサー〉スキルレベル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de níveis de habilidade de Necromante\",\n",
+                u8"    \"ruRU\": \"%+d к уровню умений некроманта\",\n",
+                u8"    \"zhCN\": \"%+d 死灵法师技能等级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3528,\n",
+                u8"    \"Key\": \"ModStr3d\",\n",
+                u8"    \"enUS\": \"%+d to Sorceress Skill Levels\",\n",
+                u8"    \"zhTW\": \"%+d 魔法使技能等級\",\n",
+                u8"    \"deDE\": \"%+d zu Zauberinfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los niveles de habilidad de la hechicera\",\n",
+                u8"    \"frFR\": \"%+d aux niv. de compétence de la Sorcière\",\n",
+                u8"    \"itIT\": \"%+d alle abilità dell'Incantatrice\",\n",
+                u8"    \"koKR\": \"원소술사 기술 레벨 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności czarodziejki\",\n",
+                u8"    \"esMX\": \"%+d a los niveles de habilidad de la Hechicera\",\n",
+                u8"    \"jaJP\": \"〈ソーサレス〉スキルレベル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de níveis de habilidade de Maga\",\n",
+                u8"    \"ruRU\": \"%+d к уровню умений волшебницы\",\n",
+                u8"    \"zhCN\": \"%+d 巫师技能等级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3529,\n",
+                u8"    \"Key\": \"ModStr3e\",\n",
+                u8"    \"enUS\": \"%+d to Barbarian Skill Levels\",\n",
+                u8"    \"zhTW\": \"%+d 野蠻人技能等級\",\n",
+                u8"    \"deDE\": \"%+d zu Barbarenfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los niveles de habilidad del bárbaro\",\n",
+                u8"    \"frFR\": \"%+d aux niv. de compétence du Barbare\",\n",
+                u8"    \"itIT\": \"%+d alle abilità del Barbaro\",\n",
+                u8"    \"koKR\": \"야만용사 기술 레벨 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności barbarzyńcy\",\n",
+                u8"    \"esMX\": \"%+d a los niveles de habilidad del Bárbaro\",\n",
+                u8"    \"jaJP\": \"〈バーバリアン〉スキルレベル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de níveis de habilidade de Bárbaro\",\n",
+                u8"    \"ruRU\": \"%+d к уровню умений варвара\",\n",
+                u8"    \"zhCN\": \"%+d 野蛮人技能等级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3530,\n",
+                u8"    \"Key\": \"ModStr3f\",\n",
+                u8"    \"enUS\": \"%+d to Light Radius\",\n",
+                u8"    \"zhTW\": \"照亮範圍 %+d\",\n",
+                u8"    \"deDE\": \"%+d zu Lichtradius\",\n",
+                u8"    \"esES\": \"%+d de radio de visión\",\n",
+                u8"    \"frFR\": \"%+d à la portée lumineuse\",\n",
+                u8"    \"itIT\": \"%+d al raggio d'illuminazione\",\n",
+                u8"    \"koKR\": \"시야 %+d\",\n",
+                u8"    \"plPL\": \"%+d do promienia światła\",\n",
+                u8"    \"esMX\": \"%+d de radio de visibilidad\",\n",
+                u8"    \"jaJP\": \"明かりの範囲（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de raio de visibilidade\",\n",
+                u8"    \"ruRU\": \"%+d к радиусу обзора\",\n",
+                u8"    \"zhCN\": \"%+d 照亮范围\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3531,\n",
+                u8"    \"Key\": \"ModStr3g\",\n",
+                u8"    \"enUS\": \"%d%% Increased Chance of Blocking\",\n",
+                u8"    \"zhTW\": \"格擋機率提高 %d%%\",\n",
+                u8"    \"deDE\": \"%d%% erhöhte Blockchance\",\n",
+                u8"    \"esES\": \"+%d%% de probabilidad de bloqueo\",\n",
+                u8"    \"frFR\": \"%d%% de chances suppl. de bloquer\",\n",
+                u8"    \"itIT\": \"Probabilità di parata aumentata del %d%%\",\n",
+                u8"    \"koKR\": \"막기 확률 %d%% 증가\",\n",
+                u8"    \"plPL\": \"+%d%% do szansy na blok\",\n",
+                u8"    \"esMX\": \"%d%% más de probabilidad de bloqueo\",\n",
+                u8"    \"jaJP\": \"ブロック確率上昇（%d%%）\",\n",
+                u8"    \"ptBR\": \"%d%% de chance adicional de bloqueio\",\n",
+                u8"    \"ruRU\": \"Вероятность %d%% заблокировать удар\",\n",
+                u8"    \"zhCN\": \"%d%% 格挡几率提高\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3532,\n",
+                u8"    \"Key\": \"ModStr3h\",\n",
+                u8"    \"enUS\": \"Requirements %+d%%\",\n",
+                u8"    \"zhTW\": \"需求 %+d%%\",\n",
+                u8"    \"deDE\": \"Anforderungen %+d%%\",\n",
+                u8"    \"esES\": \"Requisitos %+d%%\",\n",
+                u8"    \"frFR\": \"Conditions requises : %+d%%\",\n",
+                u8"    \"itIT\": \"Requisiti %+d%%\",\n",
+                u8"    \"koKR\": \"착용 조건 %+d%%\",\n",
+                u8"    \"plPL\": \"Wymagania %+d%%\",\n",
+                u8"    \"esMX\": \"%+d%% de requisitos\",\n",
+                u8"    \"jaJP\": \"必要ステータス（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Requisitos %+d%%\",\n",
+                u8"    \"ruRU\": \"Требования: %+d%%\",\n",
+                u8"    \"zhCN\": \"需求 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3533,\n",
+                u8"    \"Key\": \"ModStr3i\",\n",
+                u8"    \"enUS\": \"%+d to Fire Skills\",\n",
+                u8"    \"zhTW\": \"%+d 火焰技能\",\n",
+                u8"    \"deDE\": \"%+d zu Feuerfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los hechizos de fuego\",\n",
+                u8"    \"frFR\": \"%+d aux compétences de Feu\",\n",
+                u8"    \"itIT\": \"%+d alle abilità di fuoco\",\n",
+                u8"    \"koKR\": \"화염 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności ognia\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Fuego\",\n",
+                u8"    \"jaJP\": \"〈火炎〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades ígneas\",\n",
+                u8"    \"ruRU\": \"%+d к умениям огня\",\n",
+                u8"    \"zhCN\": \"%+d 火焰技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3534,\n",
+                u8"    \"Key\": \"ModStr3j\",\n",
+                u8"    \"enUS\": \"Attacker Takes Lightning Damage of %d\",\n",
+                u8"    \"zhTW\": \"攻擊者受到 %d 點電擊傷害\",\n",
+                u8"    \"deDE\": \"Angreifer erleidet Blitzschaden von %d\",\n",
+                u8"    \"esES\": \"Los atacantes reciben %d p. de daño de rayos\",\n",
+                u8"    \"frFR\": \"L’adversaire subit des dégâts de Foudre de %d\",\n",
+                u8"    \"itIT\": \"Gli attaccanti subiscono danni da fulmine pari a %d\",\n",
+                u8"    \"koKR\": \"공격자가 번개 피해를 %d 받음\",\n",
+                u8"    \"plPL\": \"Atakujący otrzymują %d pkt. obrażeń od błyskawic\",\n",
+                u8"    \"esMX\": \"El atacante recibe %d de daño de rayo\",\n",
+                u8"    \"jaJP\": \"攻撃を受けると電撃ダメージ（%d）を反射\",\n",
+                u8"    \"ptBR\": \"Agressor recebe %d de dano elétrico\",\n",
+                u8"    \"ruRU\": \"Атакующий получает %d урона от молнии\",\n",
+                u8"    \"zhCN\": \"攻击者受到 %d 点闪电伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3535,\n",
+                u8"    \"Key\": \"ModStr3k\",\n",
+                u8"    \"enUS\": \"%+d to All Skills\",\n",
+                u8"    \"zhTW\": \"%+d 所有技能\",\n",
+                u8"    \"deDE\": \"%+d zu allen Fertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a todas las habilidades\",\n",
+                u8"    \"frFR\": \"%+d à toutes les compétences\",\n",
+                u8"    \"itIT\": \"%+d a tutte le abilità\",\n",
+                u8"    \"koKR\": \"모든 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do wszystkich umiejętności\",\n",
+                u8"    \"esMX\": \"%+d a todas las habilidades\",\n",
+                u8"    \"jaJP\": \"全スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para todas as habilidades\",\n",
+                u8"    \"ruRU\": \"%+d ко всем умениям\",\n",
+                u8"    \"zhCN\": \"%+d 所有技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3536,\n",
+                u8"    \"Key\": \"ModStr3l\",\n",
+                u8"    \"enUS\": \"Freezes target\",\n",
+                u8"    \"zhTW\": \"凍結目標\",\n",
+                u8"    \"deDE\": \"Friert das Ziel ein\",\n",
+                u8"    \"esES\": \"Congela al objetivo\",\n",
+                u8"    \"frFR\": \"Immobilise l’adversaire\",\n",
+                u8"    \"itIT\": \"Congela il bersaglio\",\n",
+                u8"    \"koKR\": \"대상 빙결\",\n",
+                u8"    \"plPL\": \"Zamraża cel\",\n",
+                u8"    \"esMX\": \"Congela al objetivo\",\n",
+                u8"    \"jaJP\": \"ターゲットを凍結させる\",\n",
+                u8"    \"ptBR\": \"Congela o alvo\",\n",
+                u8"    \"ruRU\": \"Замораживает цель\",\n",
+                u8"    \"zhCN\": \"冻结目标\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3537,\n",
+                u8"    \"Key\": \"ModStr3m\",\n",
+                u8"    \"enUS\": \"%+d%% Chance of Open Wounds\",\n",
+                u8"    \"zhTW\": \"%+d%% 機率造成開放傷口\",\n",
+                u8"    \"deDE\": \"%+d%% Chance auf offene Wunden\",\n",
+                u8"    \"esES\": \"%+d%% de probabilidad de sangrado\",\n",
+                u8"    \"frFR\": \"%+d%% de chances de blessures ouvertes\",\n",
+                u8"    \"itIT\": \"Probabilità di aprire una ferita %+d%%\",\n",
+                u8"    \"koKR\": \"상처 악화 확률 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szansy na otwarcie rany\",\n",
+                u8"    \"esMX\": \"%+d%% de probabilidad de abrir heridas\",\n",
+                u8"    \"jaJP\": \"出血状態を付与（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de chance de Feridas Abertas\",\n",
+                u8"    \"ruRU\": \"%+d%% к вероятности нанести открытую рану\",\n",
+                u8"    \"zhCN\": \"%+d%% 几率造成开创性伤口\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3538,\n",
+                u8"    \"Key\": \"ModStr3n\",\n",
+                u8"    \"enUS\": \"Invisibility\",\n",
+                u8"    \"zhTW\": \"隱形\",\n",
+                u8"    \"deDE\": \"Unsichtbarkeit\",\n",
+                u8"    \"esES\": \"Invisibilidad\",\n",
+                u8"    \"frFR\": \"Invisibilité\",\n",
+                u8"    \"itIT\": \"Invisibilità\",\n",
+                u8"    \"koKR\": \"투명\",\n",
+                u8"    \"plPL\": \"Niewidzialność\",\n",
+                u8"    \"esMX\": \"Invisibilidad\",\n",
+                u8"    \"jaJP\": \"インビジビリティ（透明化）\",\n",
+                u8"    \"ptBR\": \"Invisibilidade\",\n",
+                u8"    \"ruRU\": \"Невидимость\",\n",
+                u8"    \"zhCN\": \"隐形\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3539,\n",
+                u8"    \"Key\": \"ModStr3o\",\n",
+                u8"    \"enUS\": \"Neutral Invisibility\",\n",
+                u8"    \"zhTW\": \"天生隱形\",\n",
+                u8"    \"deDE\": \"Neutrale Unsichtbarkeit\",\n",
+                u8"    \"esES\": \"Invisibilidad neutra\",\n",
+                u8"    \"frFR\": \"Invisibilité neutre\",\n",
+                u8"    \"itIT\": \"Invisibilità neutrale\",\n",
+                u8"    \"koKR\": \"반투명\",\n",
+                u8"    \"plPL\": \"Neutralna niewidzialność\",\n",
+                u8"    \"esMX\": \"Invisibilidad neutral\",\n",
+                u8"    \"jaJP\": \"ニュートラル・インビジビリティ（透明化）\",\n",
+                u8"    \"ptBR\": \"Invisibilidade neutra\",\n",
+                u8"    \"ruRU\": \"Нейтральная невидимость\",\n",
+                u8"    \"zhCN\": \"中立隐形\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3540,\n",
+                u8"    \"Key\": \"ModStr3p\",\n",
+                u8"    \"enUS\": \"No Mana Healing\",\n",
+                u8"    \"zhTW\": \"無法力治療\",\n",
+                u8"    \"deDE\": \"Keine Manaheilung\",\n",
+                u8"    \"esES\": \"Sin regeneración de maná\",\n",
+                u8"    \"frFR\": \"Pas de Potion de mana\",\n",
+                u8"    \"itIT\": \"Non rigenera mana\",\n",
+                u8"    \"koKR\": \"마나 회복 불가\",\n",
+                u8"    \"plPL\": \"Brak przywracania many\",\n",
+                u8"    \"esMX\": \"Sin regeneración de maná\",\n",
+                u8"    \"jaJP\": \"マナが回復しなくなる\",\n",
+                u8"    \"ptBR\": \"Sem cura de mana\",\n",
+                u8"    \"ruRU\": \"Не позволяет восполнять ману\",\n",
+                u8"    \"zhCN\": \"无魔法治愈\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3541,\n",
+                u8"    \"Key\": \"ModStr3q\",\n",
+                u8"    \"enUS\": \"No Life Healing\",\n",
+                u8"    \"zhTW\": \"無生命治療\",\n",
+                u8"    \"deDE\": \"Keine Lebensheilung\",\n",
+                u8"    \"esES\": \"Sin regeneración de vida\",\n",
+                u8"    \"frFR\": \"Pas de Potion de vie\",\n",
+                u8"    \"itIT\": \"Non rigenera vita\",\n",
+                u8"    \"koKR\": \"생명력 회복 불가\",\n",
+                u8"    \"plPL\": \"Brak przywracania zdrowia\",\n",
+                u8"    \"esMX\": \"Sin sanación de vida\",\n",
+                u8"    \"jaJP\": \"ライフが回復しなくなる\",\n",
+                u8"    \"ptBR\": \"Sem cura de vida\",\n",
+                u8"    \"ruRU\": \"Не позволяет лечиться\",\n",
+                u8"    \"zhCN\": \"无生命治愈\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3542,\n",
+                u8"    \"Key\": \"ModStr3r\",\n",
+                u8"    \"enUS\": \"Poison Length Reduced by %d%%\",\n",
+                u8"    \"zhTW\": \"中毒的時效縮短 %d%%\",\n",
+                u8"    \"deDE\": \"Giftdauer reduziert um %d%%\",\n",
+                u8"    \"esES\": \"Duración del veneno reducida un %d%%\",\n",
+                u8"    \"frFR\": \"Effet du poison réduit de %d%%\",\n",
+                u8"    \"itIT\": \"Durata veleno ridotta del %d%%\",\n",
+                u8"    \"koKR\": \"독 지속시간 %d%% 감소\",\n",
+                u8"    \"plPL\": \"Skraca czas działania trucizny o %d%%\",\n",
+                u8"    \"esMX\": \"Reduce un %d%% la duración del veneno\",\n",
+                u8"    \"jaJP\": \"毒の効果時間短縮（%d%%）\",\n",
+                u8"    \"ptBR\": \"Duração de veneno reduzida em %d%%\",\n",
+                u8"    \"ruRU\": \"Сокращает время действия яда на %d%%\",\n",
+                u8"    \"zhCN\": \"中毒时间缩短 %d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3544,\n",
+                u8"    \"Key\": \"ModStr3v\",\n",
+                u8"    \"enUS\": \"Heal Stamina Plus %d%%\",\n",
+                u8"    \"zhTW\": \"精力恢復 +%d%%\",\n",
+                u8"    \"deDE\": \"Ausdauerheilung plus %d%%\",\n",
+                u8"    \"esES\": \"%d%% de regeneración de aguante\",\n",
+                u8"    \"frFR\": \"Regain d’endurance augmenté de %d%%\",\n",
+                u8"    \"itIT\": \"Rigenerazione del vigore aumentata del %d%%\",\n",
+                u8"    \"koKR\": \"지구력 회복 속도 %d%% 증가\",\n",
+                u8"    \"plPL\": \"+%d%% do przywracania wytrzymałości\",\n",
+                u8"    \"esMX\": \"%d%% más de regeneración de vigor\",\n",
+                u8"    \"jaJP\": \"スタミナ回復速度上昇（+%d%%）\",\n",
+                u8"    \"ptBR\": \"Recupera vigor em %d%%\",\n",
+                u8"    \"ruRU\": \"Ускоряет восполнение выносливости на %d%%\",\n",
+                u8"    \"zhCN\": \"治愈耐力外加 %d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3545,\n",
+                u8"    \"Key\": \"ModStr3w\",\n",
+                u8"    \"enUS\": \"%+d%% Damage Taken Goes To Mana\",\n",
+                u8"    \"zhTW\": \"%+d%% 受到的傷害轉為法力\",\n",
+                u8"    \"deDE\": \"%+d%% erlittenen Schadens geht auf Mana\",\n",
+                u8"    \"esES\": \"Un %+d%% del daño sufrido se recupera como maná\",\n",
+                u8"    \"frFR\": \"%+d%% des dégâts subis sont soustraits au mana\",\n",
+                u8"    \"itIT\": \"Il %+d%% dei danni subiti è sul mana\",\n",
+                u8"    \"koKR\": \"받는 피해의 %+d%%만큼 마나 회복\",\n",
+                u8"    \"plPL\": \"%+d%% otrzymanych obrażeń przechodzi na manę\",\n",
+                u8"    \"esMX\": \"%+d%% del daño recibido se transforma en maná\",\n",
+                u8"    \"jaJP\": \"受けたダメージの%+d%%をマナに変換\",\n",
+                u8"    \"ptBR\": \"%+d%% do dano recebido transforma-se em mana\",\n",
+                u8"    \"ruRU\": \"%+d%% к урону, приходящемуся на ману\",\n",
+                u8"    \"zhCN\": \"%+d%% 受到的伤害转换为法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3546,\n",
+                u8"    \"Key\": \"ModStr3x\",\n",
+                u8"    \"enUS\": \"Heal Life Plus\",\n",
+                u8"    \"zhTW\": \"回復生命加\",\n",
+                u8"    \"deDE\": \"Lebensheilung plus\",\n",
+                u8"    \"esES\": \"Curación adicional\",\n",
+                u8"    \"frFR\": \"Regain de vie suppl.\",\n",
+                u8"    \"itIT\": \"Rigenera più vita\",\n",
+                u8"    \"koKR\": \"생명력 회복 속도 증가\",\n",
+                u8"    \"plPL\": \"Przywraca punkty zdrowia plus\",\n",
+                u8"    \"esMX\": \"Más sanación de vida\",\n",
+                u8"    \"jaJP\": \"ライフ回復速度上昇\",\n",
+                u8"    \"ptBR\": \"Cura de vida adicional\",\n",
+                u8"    \"ruRU\": \"Усиливает исцеление\",\n",
+                u8"    \"zhCN\": \"治愈生命外加\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3547,\n",
+                u8"    \"Key\": \"ModStr3y\",\n",
+                u8"    \"enUS\": \"Ignore Target's Defense\",\n",
+                u8"    \"zhTW\": \"無視目標防禦\",\n",
+                u8"    \"deDE\": \"Ignoriert Zielverteidigung\",\n",
+                u8"    \"esES\": \"Ignora la defensa del objetivo\",\n",
+                u8"    \"frFR\": \"Ignore les défenses de l’adversaire\",\n",
+                u8"    \"itIT\": \"Ignora la difesa del bersaglio\",\n",
+                u8"    \"koKR\": \"대상의 방어력 무시\",\n",
+                u8"    \"plPL\": \"Ignoruje obronę celu\",\n",
+                u8"    \"esMX\": \"Ignora la defensa del objetivo\",\n",
+                u8"    \"jaJP\": \"ターゲットの防御力を無視\",\n",
+                u8"    \"ptBR\": \"Ignora defesa do alvo\",\n",
+                u8"    \"ruRU\": \"Игнорирует защиту цели\",\n",
+                u8"    \"zhCN\": \"忽略目标的防御\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3548,\n",
+                u8"    \"Key\": \"ModStr3z\",\n",
+                u8"    \"enUS\": \"Half Poison Duration\",\n",
+                u8"    \"zhTW\": \"中毒的時效減半\",\n",
+                u8"    \"deDE\": \"Halbierte Giftdauer\",\n",
+                u8"    \"esES\": \"Mitad de duración del veneno\",\n",
+                u8"    \"frFR\": \"Réduit de moitié la durée du Poison\",\n",
+                u8"    \"itIT\": \"Durata veleno dimezzata\",\n",
+                u8"    \"koKR\": \"독 지속시간 절반으로 감소\",\n",
+                u8"    \"plPL\": \"Skraca czas działania trucizny o połowę\",\n",
+                u8"    \"esMX\": \"Reduce a la mitad la duración del veneno\",\n",
+                u8"    \"jaJP\": \"毒の効果時間短縮（50%%）\",\n",
+                u8"    \"ptBR\": \"Metade da duração de veneno\",\n",
+                u8"    \"ruRU\": \"Вдвое уменьшает время действия яда\",\n",
+                u8"    \"zhCN\": \"中毒时间减半\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3549,\n",
+                u8"    \"Key\": \"ModStr4a\",\n",
+                u8"    \"enUS\": \"Prevent Monster Heal\",\n",
+                u8"    \"zhTW\": \"防止怪物自療\",\n",
+                u8"    \"deDE\": \"Verhindert Monsterheilung\",\n",
+                u8"    \"esES\": \"Impide que los monstruos se curen\",\n",
+                u8"    \"frFR\": \"Empêche les monstres de guérir\",\n",
+                u8"    \"itIT\": \"Evita la cura del bersaglio\",\n",
+                u8"    \"koKR\": \"괴물 회복 저지\",\n",
+                u8"    \"plPL\": \"Uniemożliwia leczenie się potworów\",\n",
+                u8"    \"esMX\": \"Previene la regeneración de monstruos\",\n",
+                u8"    \"jaJP\": \"モンスターの回復を阻止\",\n",
+                u8"    \"ptBR\": \"Impede cura de monstros\",\n",
+                u8"    \"ruRU\": \"Запрещает монстрам лечиться\",\n",
+                u8"    \"zhCN\": \"防止怪物治愈\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3550,\n",
+                u8"    \"Key\": \"ModStr4b\",\n",
+                u8"    \"enUS\": \"Half Freeze Duration\",\n",
+                u8"    \"zhTW\": \"被凍結的時效減半\",\n",
+                u8"    \"deDE\": \"Halbierte Einfrierungsdauer\",\n",
+                u8"    \"esES\": \"La congelación dura la mitad\",\n",
+                u8"    \"frFR\": \"Diminue de moitié la durée d’Immobilisation\",\n",
+                u8"    \"itIT\": \"Durata congelamento dimezzata\",\n",
+                u8"    \"koKR\": \"빙결 지속시간 절반으로 감소\",\n",
+                u8"    \"plPL\": \"Skraca czas działania zamrożenia o połowę\",\n",
+                u8"    \"esMX\": \"Reduce a la mitad la duración del congelamiento\",\n",
+                u8"    \"jaJP\": \"凍結の効果時間短縮（50%%）\",\n",
+                u8"    \"ptBR\": \"Metade da duração de congelamento\",\n",
+                u8"    \"ruRU\": \"Вдвое уменьшает время заморозки\",\n",
+                u8"    \"zhCN\": \"冻结时间减半\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3552,\n",
+                u8"    \"Key\": \"ModStr4d\",\n",
+                u8"    \"enUS\": \"%d to Monster Defense Per Hit\",\n",
+                u8"    \"zhTW\": \"擊中使怪物防禦 %d\",\n",
+                u8"    \"deDE\": \"%d zu Monsterverteidigung pro Treffer\",\n",
+                u8"    \"esES\": \"%d a la defensa del monstruo por golpe\",\n",
+                u8"    \"frFR\": \"%d à la défense contre les monstres par coup\",\n",
+                u8"    \"itIT\": \"%d difesa del bersaglio per colpo\",\n",
+                u8"    \"koKR\": \"적중당 괴물 방어력 %d 감소\",\n",
+                u8"    \"plPL\": \"%d do obrony potworów na trafienie\",\n",
+                u8"    \"esMX\": \"%d a la defensa de monstruo por golpe\",\n",
+                u8"    \"jaJP\": \"攻撃命中でモンスターの防御力低下（%d）\",\n",
+                u8"    \"ptBR\": \"%d de defesa de monstro por acerto\",\n",
+                u8"    \"ruRU\": \"%d к защите от монстров за удар\",\n",
+                u8"    \"zhCN\": \"%d 每一击降低的怪物防御\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3553,\n",
+                u8"    \"Key\": \"ModStr4e\",\n",
+                u8"    \"enUS\": \"%+d%% Damage to Demons\",\n",
+                u8"    \"zhTW\": \"%+d%% 對惡魔的傷害\",\n",
+                u8"    \"deDE\": \"%+d%% Schaden gegen Dämonen\",\n",
+                u8"    \"esES\": \"%+d%% de daño contra demonios\",\n",
+                u8"    \"frFR\": \"Dégâts contre les démons : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% danni ai demoni\",\n",
+                u8"    \"koKR\": \"악마에게 주는 피해 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do obrażeń zadanych demonom\",\n",
+                u8"    \"esMX\": \"%+d%% de daño a demonios\",\n",
+                u8"    \"jaJP\": \"デーモンへのダメージ（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de dano contra demônios\",\n",
+                u8"    \"ruRU\": \"%+d%% к урону по демонам\",\n",
+                u8"    \"zhCN\": \"%+d%% 对恶魔的伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3554,\n",
+                u8"    \"Key\": \"ModStr4f\",\n",
+                u8"    \"enUS\": \"%+d%% Damage to Undead\",\n",
+                u8"    \"zhTW\": \"%+d%% 對不死怪物的傷害\",\n",
+                u8"    \"deDE\": \"%+d%% Schaden gegen Untote\",\n",
+                u8"    \"esES\": \"%+d%% de daño contra muertos vivientes\",\n",
+                u8"    \"frFR\": \"Dégâts contre les Morts-vivants : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% danni ai non morti\",\n",
+                u8"    \"koKR\": \"언데드에게 주는 피해 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do obrażeń zadanych nieumarłym\",\n",
+                u8"    \"esMX\": \"%+d%% de daño a no muertos\",\n",
+                u8"    \"jaJP\": \"アンデッドへのダメージ（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de dano contra mortos-vivos\",\n",
+                u8"    \"ruRU\": \"%+d%% урона по нежити\",\n",
+                u8"    \"zhCN\": \"%+d%% 对亡灵的伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3555,\n",
+                u8"    \"Key\": \"ModStr4g\",\n",
+                u8"    \"enUS\": \"Regenerate Mana %d%%\",\n",
+                u8"    \"zhTW\": \"法力恢復 %d%%\",\n",
+                u8"    \"deDE\": \"Mana regenerieren %d%%\",\n",
+                u8"    \"esES\": \"%d%% de regeneración de maná\",\n",
+                u8"    \"frFR\": \"Rend %d%% de mana\",\n",
+                u8"    \"itIT\": \"Rigenerazione del mana aumentata del %d%%\",\n",
+                u8"    \"koKR\": \"마나 재생 %d%%\",\n",
+                u8"    \"plPL\": \"+%d%% do regeneracji many\",\n",
+                u8"    \"esMX\": \"%d%% de regeneración de maná\",\n",
+                u8"    \"jaJP\": \"マナ回復速度上昇（+%d%%）\",\n",
+                u8"    \"ptBR\": \"Regenera mana em %d%%\",\n",
+                u8"    \"ruRU\": \"Восполняет %d%% маны\",\n",
+                u8"    \"zhCN\": \"%d%% 法力回复\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3556,\n",
+                u8"    \"Key\": \"ModStr4h\",\n",
+                u8"    \"enUS\": \"%+d to Maximum Poison Damage\",\n",
+                u8"    \"zhTW\": \"%+d 毒素傷害最大值\",\n",
+                u8"    \"deDE\": \"%+d zu max. Giftschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño máximo de veneno\",\n",
+                u8"    \"frFR\": \"%+d au max. de dégâts de Poison\",\n",
+                u8"    \"itIT\": \"%+d ai danni massimi da veleno\",\n",
+                u8"    \"koKR\": \"최대 독 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do maksymalnych obrażeń od trucizny\",\n",
+                u8"    \"esMX\": \"%+d a daño de veneno máximo\",\n",
+                u8"    \"jaJP\": \"最大毒ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano venenoso máximo\",\n",
+                u8"    \"ruRU\": \"%+d к максимальному урону от яда\",\n",
+                u8"    \"zhCN\": \"%+d 最大毒素伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3557,\n",
+                u8"    \"Key\": \"ModStr4i\",\n",
+                u8"    \"enUS\": \"%+d to Minimum Poison Damage\",\n",
+                u8"    \"zhTW\": \"%+d 毒素傷害最小值\",\n",
+                u8"    \"deDE\": \"%+d zu min. Giftschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño mínimo de veneno\",\n",
+                u8"    \"frFR\": \"%+d au min. de dégâts de Poison\",\n",
+                u8"    \"itIT\": \"%+d ai danni minimi da veleno\",\n",
+                u8"    \"koKR\": \"최소 독 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do minimalnych obrażeń od trucizny\",\n",
+                u8"    \"esMX\": \"%+d a daño de veneno mínimo\",\n",
+                u8"    \"jaJP\": \"最小毒ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano venenoso mínimo\",\n",
+                u8"    \"ruRU\": \"%+d к минимальному урону от яда\",\n",
+                u8"    \"zhCN\": \"%+d 最小毒素伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3558,\n",
+                u8"    \"Key\": \"ModStr4j\",\n",
+                u8"    \"enUS\": \"%+d to Attack Rating against Demons\",\n",
+                u8"    \"zhTW\": \"%+d 對惡魔的準確率\",\n",
+                u8"    \"deDE\": \"%+d zu Angriffswert gegen Dämonen\",\n",
+                u8"    \"esES\": \"%+d de índice de ataque contra demonios\",\n",
+                u8"    \"frFR\": \"%+d au score d’attaque contre les démons\",\n",
+                u8"    \"itIT\": \"%+d indice d'attacco contro i demoni\",\n",
+                u8"    \"koKR\": \"악마에 대한 명중률 %+d\",\n",
+                u8"    \"plPL\": \"%+d do skuteczności ataku względem demonów\",\n",
+                u8"    \"esMX\": \"%+d a índice de ataque contra demonios\",\n",
+                u8"    \"jaJP\": \"デーモンへの命中率（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de taxa de ataque contra demônios\",\n",
+                u8"    \"ruRU\": \"%+d к рейтингу атаки против демонов\",\n",
+                u8"    \"zhCN\": \"%+d 对恶魔的命中值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3559,\n",
+                u8"    \"Key\": \"ModStr4k\",\n",
+                u8"    \"enUS\": \"%+d to Attack Rating against Undead\",\n",
+                u8"    \"zhTW\": \"%+d 對不死怪物的準確率\",\n",
+                u8"    \"deDE\": \"%+d zu Angriffswert gegen Untote\",\n",
+                u8"    \"esES\": \"%+d de índice de ataque contra muertos vivientes\",\n",
+                u8"    \"frFR\": \"%+d au score d’attaque contre les Morts-vivants\",\n",
+                u8"    \"itIT\": \"%+d indice d'attacco contro i non morti\",\n",
+                u8"    \"koKR\": \"언데드에 대한 명중률 %+d\",\n",
+                u8"    \"plPL\": \"%+d do skuteczności ataku względem nieumarłych\",\n",
+                u8"    \"esMX\": \"%+d a índice de ataque contra no muertos\",\n",
+                u8"    \"jaJP\": \"アンデッドへの命中率（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de taxa de ataque contra mortos-vivos\",\n",
+                u8"    \"ruRU\": \"%+d к рейтингу атаки против нежити\",\n",
+                u8"    \"zhCN\": \"%+d 对亡灵的命中值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3560,\n",
+                u8"    \"Key\": \"ModStr4l\",\n",
+                u8"    \"enUS\": \"Slightly Increased Attack Speed\",\n",
+                u8"    \"zhTW\": \"小幅攻擊速度提高\",\n",
+                u8"    \"deDE\": \"Leicht erhöhte Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Ligero aumento de velocidad de ataque\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque légèrement augmentée\",\n",
+                u8"    \"itIT\": \"Velocità d'attacco leggermente aumentata\",\n",
+                u8"    \"koKR\": \"공격 속도 약간 증가\",\n",
+                u8"    \"plPL\": \"Lekko zwiększona szybkość ataku\",\n",
+                u8"    \"esMX\": \"Aumenta levemente la velocidad de ataque\",\n",
+                u8"    \"jaJP\": \"攻撃速度上昇（小）\",\n",
+                u8"    \"ptBR\": \"Velocidade de ataque ligeiramente aumentada\",\n",
+                u8"    \"ruRU\": \"Скорость атаки слегка повышена\",\n",
+                u8"    \"zhCN\": \"轻微提升攻击速度\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3561,\n",
+                u8"    \"Key\": \"ModStr4m\",\n",
+                u8"    \"enUS\": \"%+d%% Increased Attack Speed\",\n",
+                u8"    \"zhTW\": \"攻擊速度 %+d%%\",\n",
+                u8"    \"deDE\": \"%+d%% erhöhte Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"%+d%% de velocidad de ataque\",\n",
+                u8"    \"frFR\": \"%+d%% à la vitesse d’attaque\",\n",
+                u8"    \"itIT\": \"%+d%% velocità d'attacco\",\n",
+                u8"    \"koKR\": \"공격 속도 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szybkości ataku\",\n",
+                u8"    \"esMX\": \"%+d%% de velocidad de ataque\",\n",
+                u8"    \"jaJP\": \"攻撃速度（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de velocidade de ataque adicional\",\n",
+                u8"    \"ruRU\": \"%+d%% к скорости атаки\",\n",
+                u8"    \"zhCN\": \"%+d%% 提高攻击速度\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3562,\n",
+                u8"    \"Key\": \"ModStr4n\",\n",
+                u8"    \"enUS\": \"Greatly Increased Attack Speed\",\n",
+                u8"    \"zhTW\": \"大幅攻擊速度提高\",\n",
+                u8"    \"deDE\": \"Stark erhöhte Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Gran aumento de velocidad de ataque\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque fortement augmentée\",\n",
+                u8"    \"itIT\": \"Velocità d'attacco enormemente aumentata\",\n",
+                u8"    \"koKR\": \"공격 속도 대폭 증가\",\n",
+                u8"    \"plPL\": \"Znacznie zwiększona szybkość ataku\",\n",
+                u8"    \"esMX\": \"Aumenta en gran medida la velocidad de ataque\",\n",
+                u8"    \"jaJP\": \"攻撃速度上昇（大）\",\n",
+                u8"    \"ptBR\": \"Velocidade de ataque consideravelmente aumentada\",\n",
+                u8"    \"ruRU\": \"Скорость атаки значительно повышена\",\n",
+                u8"    \"zhCN\": \"大幅提高攻击速度\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3563,\n",
+                u8"    \"Key\": \"ModStr4o\",\n",
+                u8"    \"enUS\": \"Fast Hit Recovery\",\n",
+                u8"    \"zhTW\": \"快速的打擊恢復\",\n",
+                u8"    \"deDE\": \"Schnelle Erholung nach Treffer\",\n",
+                u8"    \"esES\": \"Recuperación de golpe rápida\",\n",
+                u8"    \"frFR\": \"Récupération rapide après un coup\",\n",
+                u8"    \"itIT\": \"Recupero dai colpi veloce\",\n",
+                u8"    \"koKR\": \"빠른 타격 회복 속도\",\n",
+                u8"    \"plPL\": \"Szybkie odzyskanie równowagi\",\n",
+                u8"    \"esMX\": \"Rápida recuperación por golpe\",\n",
+                u8"    \"jaJP\": \"ヒットリカバリー速度上昇\",\n",
+                u8"    \"ptBR\": \"Recuperação de golpe rápida\",\n",
+                u8"    \"ruRU\": \"Быстрое восстановление от ударов\",\n",
+                u8"    \"zhCN\": \"快速打击回复\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3564,\n",
+                u8"    \"Key\": \"ModStr4p\",\n",
+                u8"    \"enUS\": \"%+d%% Faster Hit Recovery\",\n",
+                u8"    \"zhTW\": \"%+d%% 打擊恢復\",\n",
+                u8"    \"deDE\": \"%+d%% schnellere Erholung nach Treffer\",\n",
+                u8"    \"esES\": \"Recuperación de golpe un %+d%% más rápida\",\n",
+                u8"    \"frFR\": \"Récupération très rapide après un coup : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% velocità di recupero dai colpi\",\n",
+                u8"    \"koKR\": \"타격 회복 속도 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szybkości odzyskiwania równowagi\",\n",
+                u8"    \"esMX\": \"%+d%% de velocidad a recuperación por golpe\",\n",
+                u8"    \"jaJP\": \"ヒットリカバリー速度（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Recuperação de golpe %+d%% mais rápida\",\n",
+                u8"    \"ruRU\": \"%+d%% к ускоренному восстановлению от удара\",\n",
+                u8"    \"zhCN\": \"%+d%% 更快速打击回复\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3565,\n",
+                u8"    \"Key\": \"ModStr4q\",\n",
+                u8"    \"enUS\": \"Fastest Hit Recovery\",\n",
+                u8"    \"zhTW\": \"最快的打擊恢復\",\n",
+                u8"    \"deDE\": \"Schnellste Erholung nach Treffer\",\n",
+                u8"    \"esES\": \"Recuperación de golpe máxima\",\n",
+                u8"    \"frFR\": \"Récupération max. après un coup\",\n",
+                u8"    \"itIT\": \"Recupero dai colpi più veloce\",\n",
+                u8"    \"koKR\": \"가장 빠른 타격 회복 속도\",\n",
+                u8"    \"plPL\": \"Najszybsze odzyskanie równowagi\",\n",
+                u8"    \"esMX\": \"Recuperación por golpe más rápida\",\n",
+                u8"    \"jaJP\": \"ヒットリカバリー速度上昇（大）\",\n",
+                u8"    \"ptBR\": \"Recuperação de golpe mais rápida\",\n",
+                u8"    \"ruRU\": \"Очень быстрое восстановление от ударов\",\n",
+                u8"    \"zhCN\": \"最快速打击回复\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3566,\n",
+                u8"    \"Key\": \"ModStr4r\",\n",
+                u8"    \"enUS\": \"Fast Run/Walk\",\n",
+                u8"    \"zhTW\": \"快速的跑步 / 行走速度\",\n",
+                u8"    \"deDE\": \"Schnelle Bewegungsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Velocidad de correr/andar rápida\",\n",
+                u8"    \"frFR\": \"Marche/Course rapide\",\n",
+                u8"    \"itIT\": \"Corsa/camminata veloce\",\n",
+                u8"    \"koKR\": \"빠른 달리기/걷기 속도\",\n",
+                u8"    \"plPL\": \"Szybki bieg/chodzenie\",\n",
+                u8"    \"esMX\": \"Rápida velocidad al correr/caminar\",\n",
+                u8"    \"jaJP\": \"歩き/走り速度上昇\",\n",
+                u8"    \"ptBR\": \"Correr/andar rápidas\",\n",
+                u8"    \"ruRU\": \"Скорость ходьбы и бега повышена\",\n",
+                u8"    \"zhCN\": \"跑步/步行\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3567,\n",
+                u8"    \"Key\": \"ModStr4s\",\n",
+                u8"    \"enUS\": \"%+d%% Faster Run/Walk\",\n",
+                u8"    \"zhTW\": \"%+d%% 跑步 / 行走速度\",\n",
+                u8"    \"deDE\": \"%+d%% Bewegungsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Correr/andar un %+d%% más rápido\",\n",
+                u8"    \"frFR\": \"%+d%% à la Marche/Course\",\n",
+                u8"    \"itIT\": \"%+d%% velocità di corsa/camminata\",\n",
+                u8"    \"koKR\": \"달리기/걷기 속도 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szybkości poruszania się\",\n",
+                u8"    \"esMX\": \"%+d%% de velocidad a correr/caminar\",\n",
+                u8"    \"jaJP\": \"歩き/走り速度（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Correr/andar %+d%% mais rápidas\",\n",
+                u8"    \"ruRU\": \"%+d%% к скорости ходьбы и бега\",\n",
+                u8"    \"zhCN\": \"%+d%% 更快速跑步/步行\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3568,\n",
+                u8"    \"Key\": \"ModStr4t\",\n",
+                u8"    \"enUS\": \"Fastest Run/Walk\",\n",
+                u8"    \"zhTW\": \"最快的跑步 / 行走速度\",\n",
+                u8"    \"deDE\": \"Schnellste Bewegungsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Velocidad de correr/andar máxima\",\n",
+                u8"    \"frFR\": \"Marche/Course max.\",\n",
+                u8"    \"itIT\": \"Corsa/camminata più veloce\",\n",
+                u8"    \"koKR\": \"가장 빠른 달리기/걷기 속도\",\n",
+                u8"    \"plPL\": \"Najszybszy bieg/chodzenie\",\n",
+                u8"    \"esMX\": \"Velocidad al correr/caminar más rápida\",\n",
+                u8"    \"jaJP\": \"歩き/走り速度上昇（大）\",\n",
+                u8"    \"ptBR\": \"Correr/andar mais rápidas\",\n",
+                u8"    \"ruRU\": \"Скорость ходьбы и бега значительно повышена\",\n",
+                u8"    \"zhCN\": \"最快速跑步/步行\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3569,\n",
+                u8"    \"Key\": \"ModStr4u\",\n",
+                u8"    \"enUS\": \"Fast Cast Rate\",\n",
+                u8"    \"zhTW\": \"快速的施法速度\",\n",
+                u8"    \"deDE\": \"Schnelle Zauberrate\",\n",
+                u8"    \"esES\": \"Velocidad de lanzamiento rápida\",\n",
+                u8"    \"frFR\": \"Vitesse de sort rapide\",\n",
+                u8"    \"itIT\": \"Lancio incantesimi veloce\",\n",
+                u8"    \"koKR\": \"빠른 시전 속도\",\n",
+                u8"    \"plPL\": \"Szybkie rzucanie czarów\",\n",
+                u8"    \"esMX\": \"Rápida velocidad de lanzamiento\",\n",
+                u8"    \"jaJP\": \"スキル発動速度上昇\",\n",
+                u8"    \"ptBR\": \"Taxa de lançamento rápida\",\n",
+                u8"    \"ruRU\": \"Скорость применения умений повышена\",\n",
+                u8"    \"zhCN\": \"快速施法\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3570,\n",
+                u8"    \"Key\": \"ModStr4v\",\n",
+                u8"    \"enUS\": \"%+d%% Faster Cast Rate\",\n",
+                u8"    \"zhTW\": \"%+d%% 施法速度\",\n",
+                u8"    \"deDE\": \"%+d%% schnellere Zauberrate\",\n",
+                u8"    \"esES\": \"Velocidad de lanzamiento un %+d%% más rápida\",\n",
+                u8"    \"frFR\": \"Vitesse de sort très rapide : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% velocità di lancio incantesimi\",\n",
+                u8"    \"koKR\": \"시전 속도 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szybkości rzucania czarów\",\n",
+                u8"    \"esMX\": \"%+d%% de velocidad de lanzamiento\",\n",
+                u8"    \"jaJP\": \"スキル発動速度（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Taxa de lançamento %+d%% mais rápida\",\n",
+                u8"    \"ruRU\": \"%+d%% к скорости применения умений\",\n",
+                u8"    \"zhCN\": \"%+d%% 更快速施法\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3571,\n",
+                u8"    \"Key\": \"ModStr4w\",\n",
+                u8"    \"enUS\": \"Fastest Cast Rate\",\n",
+                u8"    \"zhTW\": \"最快的施法速度\",\n",
+                u8"    \"deDE\": \"Schnellste Zauberrate\",\n",
+                u8"    \"esES\": \"Velocidad de lanzamiento máxima\",\n",
+                u8"    \"frFR\": \"Vitesse de sort max.\",\n",
+                u8"    \"itIT\": \"Lancio incantesimi più veloce\",\n",
+                u8"    \"koKR\": \"가장 빠른 시전 속도\",\n",
+                u8"    \"plPL\": \"Najszybsze rzucanie czarów\",\n",
+                u8"    \"esMX\": \"Velocidad de lanzamiento más rápida\",\n",
+                u8"    \"jaJP\": \"スキル発動速度上昇（大）\",\n",
+                u8"    \"ptBR\": \"Taxa de lançamento mais rápida\",\n",
+                u8"    \"ruRU\": \"Скорость применения умений значительно повышена\",\n",
+                u8"    \"zhCN\": \"最快速施法\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3572,\n",
+                u8"    \"Key\": \"ModStr4x\",\n",
+                u8"    \"enUS\": \"Fast Block Rate\",\n",
+                u8"    \"zhTW\": \"快速的格擋速度\",\n",
+                u8"    \"deDE\": \"Schnelle Blockrate\",\n",
+                u8"    \"esES\": \"Velocidad de bloqueo rápida\",\n",
+                u8"    \"frFR\": \"Vitesse de blocage rapide\",\n",
+                u8"    \"itIT\": \"Parata veloce\",\n",
+                u8"    \"koKR\": \"빠른 막기 속도\",\n",
+                u8"    \"plPL\": \"Szybkie blokowanie\",\n",
+                u8"    \"esMX\": \"Rápida velocidad de bloqueo\",\n",
+                u8"    \"jaJP\": \"ブロック速度上昇\",\n",
+                u8"    \"ptBR\": \"Taxa de bloqueio rápida\",\n",
+                u8"    \"ruRU\": \"Скорость блока повышена\",\n",
+                u8"    \"zhCN\": \"快速格挡\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3573,\n",
+                u8"    \"Key\": \"ModStr4y\",\n",
+                u8"    \"enUS\": \"%+d%% Faster Block Rate\",\n",
+                u8"    \"zhTW\": \"%+d%% 格擋速度\",\n",
+                u8"    \"deDE\": \"%+d%% schnellere Blockrate\",\n",
+                u8"    \"esES\": \"Velocidad de bloqueo un %+d%% más rápida\",\n",
+                u8"    \"frFR\": \"Vitesse de blocage très rapide : %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% velocità di parata\",\n",
+                u8"    \"koKR\": \"막기 속도 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szybkości blokowania\",\n",
+                u8"    \"esMX\": \"%+d%% de velocidad de bloqueo\",\n",
+                u8"    \"jaJP\": \"ブロック速度（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Taxa de bloqueio %+d%% mais rápida\",\n",
+                u8"    \"ruRU\": \"%+d%% к скорости блока\",\n",
+                u8"    \"zhCN\": \"%+d%% 更快速格挡\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3574,\n",
+                u8"    \"Key\": \"ModStr4z\",\n",
+                u8"    \"enUS\": \"Fastest Block Rate\",\n",
+                u8"    \"zhTW\": \"最快的格擋速度\",\n",
+                u8"    \"deDE\": \"Schnellste Blockrate\",\n",
+                u8"    \"esES\": \"Velocidad de bloqueo máxima\",\n",
+                u8"    \"frFR\": \"Vitesse de blocage max.\",\n",
+                u8"    \"itIT\": \"Parata più veloce\",\n",
+                u8"    \"koKR\": \"가장 빠른 막기 속도\",\n",
+                u8"    \"plPL\": \"Najszybsze blokowanie\",\n",
+                u8"    \"esMX\": \"Velocidad de bloqueo más rápida\",\n",
+                u8"    \"jaJP\": \"ブロック速度上昇（大）\",\n",
+                u8"    \"ptBR\": \"Taxa de bloqueio mais rápida\",\n",
+                u8"    \"ruRU\": \"Скорость блока значительно повышена\",\n",
+                u8"    \"zhCN\": \"最快速格挡\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3575,\n",
+                u8"    \"Key\": \"ModStr5a\",\n",
+                u8"    \"enUS\": \"Throwable\",\n",
+                u8"    \"zhTW\": \"可投擲\",\n",
+                u8"    \"deDE\": \"Werfbar\",\n",
+                u8"    \"esES\": \"Arrojadizo\",\n",
+                u8"    \"frFR\": \"Jetable\",\n",
+                u8"    \"itIT\": \"Lanciabile\",\n",
+                u8"    \"koKR\": \"투척 가능\",\n",
+                u8"    \"plPL\": \"Nadaje się do rzucania\",\n",
+                u8"    \"esMX\": \"Arrojable\",\n",
+                u8"    \"jaJP\": \"投てき可能\",\n",
+                u8"    \"ptBR\": \"Arremessável\",\n",
+                u8"    \"ruRU\": \"Метательное оружие\",\n",
+                u8"    \"zhCN\": \"可投掷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3576,\n",
+                u8"    \"Key\": \"ModStr5b\",\n",
+                u8"    \"enUS\": \"Damage %+d\",\n",
+                u8"    \"zhTW\": \"傷害 %+d\",\n",
+                u8"    \"deDE\": \"Schaden %+d\",\n",
+                u8"    \"esES\": \"Daño: %+d p.\",\n",
+                u8"    \"frFR\": \"Dégâts : %+d\",\n",
+                u8"    \"itIT\": \"%+d danni\",\n",
+                u8"    \"koKR\": \"피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do obrażeń\",\n",
+                u8"    \"esMX\": \"%+d de daño\",\n",
+                u8"    \"jaJP\": \"ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano\",\n",
+                u8"    \"ruRU\": \"%+d к урону\",\n",
+                u8"    \"zhCN\": \"伤害 %+d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3577,\n",
+                u8"    \"Key\": \"ModStr5c\",\n",
+                u8"    \"enUS\": \"%+d%% Chance of Crushing Blow\",\n",
+                u8"    \"zhTW\": \"%+d%% 機率造成粉碎打擊\",\n",
+                u8"    \"deDE\": \"%+d%% Chance auf vernichtenden Schlag\",\n",
+                u8"    \"esES\": \"%+d%% de probabilidad de ataque aplastante\",\n",
+                u8"    \"frFR\": \"%+d%% de chances de coup écrasant\",\n",
+                u8"    \"itIT\": \"Probabilità di colpo frantumante %+d%%\",\n",
+                u8"    \"koKR\": \"강타 확률 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szansy na druzgocące uderzenie\",\n",
+                u8"    \"esMX\": \"%+d%% de probabilidad de golpe aplastante\",\n",
+                u8"    \"jaJP\": \"クラッシング・ブロー（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de chance de Golpe Esmagador\",\n",
+                u8"    \"ruRU\": \"%+d%% к вероятности нанести сокрушительный удар\",\n",
+                u8"    \"zhCN\": \"%+d%% 几率粉碎打击\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3579,\n",
+                u8"    \"Key\": \"ModStr5e\",\n",
+                u8"    \"enUS\": \"%+d Kick Damage\",\n",
+                u8"    \"zhTW\": \"%+d 踢擊傷害\",\n",
+                u8"    \"deDE\": \"%+d Trittschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño de patada\",\n",
+                u8"    \"frFR\": \"Dégâts des coups de pied : %+d\",\n",
+                u8"    \"itIT\": \"%+d danni da calcio\",\n",
+                u8"    \"koKR\": \"발차기 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do obrażeń od kopnięcia\",\n",
+                u8"    \"esMX\": \"%+d de daño por patada\",\n",
+                u8"    \"jaJP\": \"キックダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano de chute\",\n",
+                u8"    \"ruRU\": \"%+d к урону от пинков\",\n",
+                u8"    \"zhCN\": \"%+d 脚踢伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3580,\n",
+                u8"    \"Key\": \"ModStr5f\",\n",
+                u8"    \"enUS\": \"%+d to Mana after each Kill\",\n",
+                u8"    \"zhTW\": \"%+d 擊殺法力恢復\",\n",
+                u8"    \"deDE\": \"%+d zu Mana nach jedem Kill\",\n",
+                u8"    \"esES\": \"%+d p. de maná tras cada asesinato\",\n",
+                u8"    \"frFR\": \"%+d de mana après chaque victime\",\n",
+                u8"    \"itIT\": \"%+d mana dopo ogni uccisione\",\n",
+                u8"    \"koKR\": \"적 처치 시 마나 %+d\",\n",
+                u8"    \"plPL\": \"%+d do many za każdego zabitego przeciwnika\",\n",
+                u8"    \"esMX\": \"%+d de maná por cada asesinato\",\n",
+                u8"    \"jaJP\": \"敵を倒すとマナが回復（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de mana após cada abate\",\n",
+                u8"    \"ruRU\": \"%+d к мане при убийстве\",\n",
+                u8"    \"zhCN\": \"%+d 每次消灭恢复的法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3581,\n",
+                u8"    \"Key\": \"ModStr5g\",\n",
+                u8"    \"enUS\": \"Fire Absorb %+d%%\",\n",
+                u8"    \"zhTW\": \"火焰吸收 %+d%%\",\n",
+                u8"    \"deDE\": \"Feuerabsorption %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de absorción de fuego\",\n",
+                u8"    \"frFR\": \"Absorption du Feu : %+d%%\",\n",
+                u8"    \"itIT\": \"Assorbimento del fuoco %+d%%\",\n",
+                u8"    \"koKR\": \"화염 흡수 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do absorpcji ognia\",\n",
+                u8"    \"esMX\": \"%+d%% de absorción de fuego\",\n",
+                u8"    \"jaJP\": \"火炎吸収（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de Absorve Fogo\",\n",
+                u8"    \"ruRU\": \"%+d%% к поглощению урона от огня\",\n",
+                u8"    \"zhCN\": \"火焰伤害吸收 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3582,\n",
+                u8"    \"Key\": \"ModStr5h\",\n",
+                u8"    \"enUS\": \"%+d Fire Absorb\",\n",
+                u8"    \"zhTW\": \"%+d 火焰吸收\",\n",
+                u8"    \"deDE\": \"%+d Feuerabsorption\",\n",
+                u8"    \"esES\": \"%+d de absorción de fuego\",\n",
+                u8"    \"frFR\": \"%+d à l’absorption du Feu\",\n",
+                u8"    \"itIT\": \"%+d assorbimento del fuoco\",\n",
+                u8"    \"koKR\": \"화염 흡수 %+d\",\n",
+                u8"    \"plPL\": \"%+d do absorpcji ognia\",\n",
+                u8"    \"esMX\": \"%+d de absorción de fuego\",\n",
+                u8"    \"jaJP\": \"火炎吸収（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de Absorve Fogo\",\n",
+                u8"    \"ruRU\": \"%+d поглощаемого урона от огня\",\n",
+                u8"    \"zhCN\": \"%+d 火焰伤害吸收\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3583,\n",
+                u8"    \"Key\": \"ModStr5i\",\n",
+                u8"    \"enUS\": \"Lightning Absorb %+d%%\",\n",
+                u8"    \"zhTW\": \"電擊吸收 %+d%%\",\n",
+                u8"    \"deDE\": \"Blitzabsorption %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de absorción de rayos\",\n",
+                u8"    \"frFR\": \"Absorption de la Foudre : %+d%%\",\n",
+                u8"    \"itIT\": \"Assorbimento del fulmine %+d%%\",\n",
+                u8"    \"koKR\": \"번개 흡수 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do absorpcji błyskawic\",\n",
+                u8"    \"esMX\": \"%+d%% de absorción de rayo\",\n",
+                u8"    \"jaJP\": \"電撃吸収（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de Absorve Eletricidade\",\n",
+                u8"    \"ruRU\": \"%+d%% к поглощению урона от молнии\",\n",
+                u8"    \"zhCN\": \"闪电伤害吸收 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3584,\n",
+                u8"    \"Key\": \"ModStr5j\",\n",
+                u8"    \"enUS\": \"%+d Lightning Absorb\",\n",
+                u8"    \"zhTW\": \"%+d 電擊吸收\",\n",
+                u8"    \"deDE\": \"%+d Blitzabsorption\",\n",
+                u8"    \"esES\": \"%+d de absorción de rayos\",\n",
+                u8"    \"frFR\": \"%+d à l’absorption de la Foudre\",\n",
+                u8"    \"itIT\": \"%+d assorbimento del fulmine\",\n",
+                u8"    \"koKR\": \"번개 흡수 %+d\",\n",
+                u8"    \"plPL\": \"%+d do absorpcji błyskawic\",\n",
+                u8"    \"esMX\": \"%+d de absorción de rayo\",\n",
+                u8"    \"jaJP\": \"電撃吸収（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de Absorve Eletricidade\",\n",
+                u8"    \"ruRU\": \"%+d поглощаемого урона от молнии\",\n",
+                u8"    \"zhCN\": \"%+d 闪电伤害吸收\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3585,\n",
+                u8"    \"Key\": \"ModStr5k\",\n",
+                u8"    \"enUS\": \"Magic Absorb %+d%%\",\n",
+                u8"    \"zhTW\": \"魔法吸收 %+d%%\",\n",
+                u8"    \"deDE\": \"Magieabsorption %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de absorción de magia\",\n",
+                u8"    \"frFR\": \"Absorption de la Magie : %+d%%\",\n",
+                u8"    \"itIT\": \"Assorbimento della magia %+d%%\",\n",
+                u8"    \"koKR\": \"마법 흡수 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do absorpcji magii\",\n",
+                u8"    \"esMX\": \"%+d%% de absorción de magia\",\n",
+                u8"    \"jaJP\": \"魔法吸収（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de Absorve Magia\",\n",
+                u8"    \"ruRU\": \"%+d%% к поглощению магического урона\",\n",
+                u8"    \"zhCN\": \"魔法伤害吸收 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3586,\n",
+                u8"    \"Key\": \"ModStr5l\",\n",
+                u8"    \"enUS\": \"%+d Magic Absorb\",\n",
+                u8"    \"zhTW\": \"%+d 魔法吸收\",\n",
+                u8"    \"deDE\": \"%+d Magieabsorption\",\n",
+                u8"    \"esES\": \"%+d de absorción de magia\",\n",
+                u8"    \"frFR\": \"%+d à l’absorption de la Magie\",\n",
+                u8"    \"itIT\": \"%+d assorbimento della magia\",\n",
+                u8"    \"koKR\": \"마법 흡수 %+d\",\n",
+                u8"    \"plPL\": \"%+d do absorpcji magii\",\n",
+                u8"    \"esMX\": \"%+d de absorción de magia\",\n",
+                u8"    \"jaJP\": \"魔法吸収（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de Absorve Magia\",\n",
+                u8"    \"ruRU\": \"%+d поглощаемого магического урона\",\n",
+                u8"    \"zhCN\": \"%+d 魔法伤害吸收\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3587,\n",
+                u8"    \"Key\": \"ModStr5m\",\n",
+                u8"    \"enUS\": \"Cold Absorb %+d%%\",\n",
+                u8"    \"zhTW\": \"冰寒吸收 %+d%%\",\n",
+                u8"    \"deDE\": \"Kälteabsorption %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de absorción de frío\",\n",
+                u8"    \"frFR\": \"Absorption du Froid : %+d%%\",\n",
+                u8"    \"itIT\": \"Assorbimento del freddo %+d%%\",\n",
+                u8"    \"koKR\": \"냉기 흡수 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do absorpcji zimna\",\n",
+                u8"    \"esMX\": \"%+d%% de absorción de frío\",\n",
+                u8"    \"jaJP\": \"冷気吸収（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de Absorve Gelo\",\n",
+                u8"    \"ruRU\": \"%+d%% к поглощению урона от льда\",\n",
+                u8"    \"zhCN\": \"冰霜伤害吸收 %+d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3588,\n",
+                u8"    \"Key\": \"ModStr5n\",\n",
+                u8"    \"enUS\": \"%+d Cold Absorb\",\n",
+                u8"    \"zhTW\": \"%+d 冰寒吸收\",\n",
+                u8"    \"deDE\": \"%+d Kälteabsorption\",\n",
+                u8"    \"esES\": \"%+d de absorción de frío\",\n",
+                u8"    \"frFR\": \"%+d à l’absorption du Froid\",\n",
+                u8"    \"itIT\": \"%+d assorbimento del freddo\",\n",
+                u8"    \"koKR\": \"냉기 흡수 %+d\",\n",
+                u8"    \"plPL\": \"%+d do absorpcji zimna\",\n",
+                u8"    \"esMX\": \"%+d de absorción de frío\",\n",
+                u8"    \"jaJP\": \"冷気吸収（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de Absorve Gelo\",\n",
+                u8"    \"ruRU\": \"%+d поглощаемого урона от льда\",\n",
+                u8"    \"zhCN\": \"%+d 冰霜伤害吸收\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3589,\n",
+                u8"    \"Key\": \"ModStr5o\",\n",
+                u8"    \"enUS\": \"-%d%% Target Defense\",\n",
+                u8"    \"zhTW\": \"-%d%% 目標防禦\",\n",
+                u8"    \"deDE\": \"-%d%% Zielverteidigung\",\n",
+                u8"    \"esES\": \"-%d%% a la defensa del objetivo\",\n",
+                u8"    \"frFR\": \"Défense de la cible : -%d%% \",\n",
+                u8"    \"itIT\": \"-%d%% difesa del bersaglio\",\n",
+                u8"    \"koKR\": \"대상의 방어력 -%d%%\",\n",
+                u8"    \"plPL\": \"-%d%% do obrony przeciwnika\",\n",
+                u8"    \"esMX\": \"-%d%% de defensa del objetivo\",\n",
+                u8"    \"jaJP\": \"ターゲットの防御力（-%d%%）\",\n",
+                u8"    \"ptBR\": \"-%d%% de defesa do alvo\",\n",
+                u8"    \"ruRU\": \"–%d%% к защите цели\",\n",
+                u8"    \"zhCN\": \"-%d%% 目标防御\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3590,\n",
+                u8"    \"Key\": \"ModStr5p\",\n",
+                u8"    \"enUS\": \"Extra Bloody\",\n",
+                u8"    \"zhTW\": \"額外血腥\",\n",
+                u8"    \"deDE\": \"Besonders blutig\",\n",
+                u8"    \"esES\": \"Extrasangriento\",\n",
+                u8"    \"frFR\": \"Super sanglant\",\n",
+                u8"    \"itIT\": \"Violenza aumentata\",\n",
+                u8"    \"koKR\": \"잔인한 공격\",\n",
+                u8"    \"plPL\": \"Wyjątkowo krwawy\",\n",
+                u8"    \"esMX\": \"Muy sangriento\",\n",
+                u8"    \"jaJP\": \"血の饗宴\",\n",
+                u8"    \"ptBR\": \"Mais sangrento\",\n",
+                u8"    \"ruRU\": \"Дополнительное кровотечение\",\n",
+                u8"    \"zhCN\": \"额外血腥\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3591,\n",
+                u8"    \"Key\": \"ModStr5q\",\n",
+                u8"    \"enUS\": \"%+d%% Deadly Strike\",\n",
+                u8"    \"zhTW\": \"%+d%% 致命打擊\",\n",
+                u8"    \"deDE\": \"%+d%% Todesschlag\",\n",
+                u8"    \"esES\": \"%+d%% de azote mortal\",\n",
+                u8"    \"frFR\": \"%+d%% de chances de coup mortel\",\n",
+                u8"    \"itIT\": \"Probabilità di colpo mortale %+d%%\",\n",
+                u8"    \"koKR\": \"치명적 공격 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szansy na zabójcze uderzenie\",\n",
+                u8"    \"esMX\": \"%+d%% de golpe letal\",\n",
+                u8"    \"jaJP\": \"デッドリー・ストライク（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de Golpe Mortal\",\n",
+                u8"    \"ruRU\": \"%+d%% к вероятности нанести смертельный удар\",\n",
+                u8"    \"zhCN\": \"%+d%% 致死打击\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3593,\n",
+                u8"    \"Key\": \"ModStr5s\",\n",
+                u8"    \"enUS\": \"Blessed Aim\",\n",
+                u8"    \"zhTW\": \"精準祝福\",\n",
+                u8"    \"deDE\": \"Gesegnete Führung\",\n",
+                u8"    \"esES\": \"Puntería bendecida\",\n",
+                u8"    \"frFR\": \"Tir béni\",\n",
+                u8"    \"itIT\": \"Mira Benedetta\",\n",
+                u8"    \"koKR\": \"축복받은 조준\",\n",
+                u8"    \"plPL\": \"Błogosławiona Celność\",\n",
+                u8"    \"esMX\": \"Puntería bendecida\",\n",
+                u8"    \"jaJP\": \"天恵の狙い\",\n",
+                u8"    \"ptBR\": \"Mira Abençoada\",\n",
+                u8"    \"ruRU\": \"Правое дело\",\n",
+                u8"    \"zhCN\": \"祝福瞄准\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3594,\n",
+                u8"    \"Key\": \"ModStr5t\",\n",
+                u8"    \"enUS\": \"Defiance\",\n",
+                u8"    \"zhTW\": \"反抗\",\n",
+                u8"    \"deDE\": \"Trotz\",\n",
+                u8"    \"esES\": \"Desafío\",\n",
+                u8"    \"frFR\": \"Défiance\",\n",
+                u8"    \"itIT\": \"Disprezzo\",\n",
+                u8"    \"koKR\": \"대항\",\n",
+                u8"    \"plPL\": \"Śmiałość\",\n",
+                u8"    \"esMX\": \"Dureza\",\n",
+                u8"    \"jaJP\": \"反骨\",\n",
+                u8"    \"ptBR\": \"Desafio\",\n",
+                u8"    \"ruRU\": \"Неповиновение\",\n",
+                u8"    \"zhCN\": \"反抗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3595,\n",
+                u8"    \"Key\": \"ModStr5u\",\n",
+                u8"    \"enUS\": \"%+d%% to Maximum Fire Resist\",\n",
+                u8"    \"zhTW\": \"火焰抗性上限 %+d%%\",\n",
+                u8"    \"deDE\": \"%+d%% zu max. Feuerwiderstand\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia máxima al fuego\",\n",
+                u8"    \"frFR\": \"%+d%% au max. de résistance au Feu\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza al fuoco massima\",\n",
+                u8"    \"koKR\": \"최대 화염 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do maksymalnej odporności na ogień\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia máxima al fuego\",\n",
+                u8"    \"jaJP\": \"最大火炎耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de resistência a fogo máxima\",\n",
+                u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению огню\",\n",
+                u8"    \"zhCN\": \"%+d%% 火焰抗性上限\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3596,\n",
+                u8"    \"Key\": \"ModStr5v\",\n",
+                u8"    \"enUS\": \"%+d%% to Maximum Cold Resist\",\n",
+                u8"    \"zhTW\": \"冰寒抗性上限 %+d%%\",\n",
+                u8"    \"deDE\": \"%+d%% zu max. Kältewiderstand\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia máxima al frío\",\n",
+                u8"    \"frFR\": \"%+d%% au max. de résistance au Froid\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza al freddo massima\",\n",
+                u8"    \"koKR\": \"최대 냉기 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do maksymalnej odporności na zimno\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia máxima al frío\",\n",
+                u8"    \"jaJP\": \"最大冷気耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de resistência a gelo máxima\",\n",
+                u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению льду\",\n",
+                u8"    \"zhCN\": \"%+d%% 冰霜抗性上限\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3597,\n",
+                u8"    \"Key\": \"ModStr5w\",\n",
+                u8"    \"enUS\": \"%+d%% to Maximum Lightning Resist\",\n",
+                u8"    \"zhTW\": \"電擊抗性上限 %+d%%\",\n",
+                u8"    \"deDE\": \"%+d%% zu max. Blitzwiderstand\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia máxima a los rayos\",\n",
+                u8"    \"frFR\": \"%+d%% au max. de résistance à la Foudre\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza al fulmine massima\",\n",
+                u8"    \"koKR\": \"최대 번개 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do maksymalnej odporności na błyskawice\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia máxima al rayo\",\n",
+                u8"    \"jaJP\": \"最大電撃耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de resistência elétrica máxima\",\n",
+                u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению молнии\",\n",
+                u8"    \"zhCN\": \"%+d%% 闪电抗性上限\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3598,\n",
+                u8"    \"Key\": \"ModStr5x\",\n",
+                u8"    \"enUS\": \"%+d%% to Maximum Magic Resist\",\n",
+                u8"    \"zhTW\": \"魔法抗性上限 %+d%%\",\n",
+                u8"    \"deDE\": \"%+d%% zu max. Magiewiderstand\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia máxima a la magia\",\n",
+                u8"    \"frFR\": \"%+d%% au max. de résistance à la Magie\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza alla magia massima\",\n",
+                u8"    \"koKR\": \"최대 마법 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do maksymalnej odporności na magię\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia mágica máxima\",\n",
+                u8"    \"jaJP\": \"最大魔法耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de resistência a magia máxima\",\n",
+                u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению магии\",\n",
+                u8"    \"zhCN\": \"%+d%% 魔法抗性上限\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3599,\n",
+                u8"    \"Key\": \"ModStr5y\",\n",
+                u8"    \"enUS\": \"%+d%% to Maximum Poison Resist\",\n",
+                u8"    \"zhTW\": \"毒素抗性上限 %+d%%\",\n",
+                u8"    \"deDE\": \"%+d%% zu max. Giftwiderstand\",\n",
+                u8"    \"esES\": \"%+d%% de resistencia máxima al veneno\",\n",
+                u8"    \"frFR\": \"%+d%% au max. de résistance au Poison\",\n",
+                u8"    \"itIT\": \"%+d%% resistenza al veleno massima\",\n",
+                u8"    \"koKR\": \"최대 독 저항 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do maksymalnej odporności na trucizny\",\n",
+                u8"    \"esMX\": \"%+d%% de resistencia máxima al veneno\",\n",
+                u8"    \"jaJP\": \"最大毒物耐性（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de resistência a veneno máxima\",\n",
+                u8"    \"ruRU\": \"%+d%% к максимальному сопротивлению яду\",\n",
+                u8"    \"zhCN\": \"%+d%% 毒素抗性上限\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3600,\n",
+                u8"    \"Key\": \"ModStr5z\",\n",
+                u8"    \"enUS\": \"Cannot Be Frozen\",\n",
+                u8"    \"zhTW\": \"無法凍結\",\n",
+                u8"    \"deDE\": \"Einfrieren nicht möglich\",\n",
+                u8"    \"esES\": \"No te pueden congelar\",\n",
+                u8"    \"frFR\": \"Ne peut pas être gelé\",\n",
+                u8"    \"itIT\": \"Impedisce di essere congelati\",\n",
+                u8"    \"koKR\": \"빙결되지 않음\",\n",
+                u8"    \"plPL\": \"Odporność na zamrożenie\",\n",
+                u8"    \"esMX\": \"No puede congelarse\",\n",
+                u8"    \"jaJP\": \"凍結しなくなる\",\n",
+                u8"    \"ptBR\": \"Não pode ser congelado\",\n",
+                u8"    \"ruRU\": \"Нельзя заморозить\",\n",
+                u8"    \"zhCN\": \"无法被冻结\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3601,\n",
+                u8"    \"Key\": \"ModStr6a\",\n",
+                u8"    \"enUS\": \"%+d Defense vs. Missile\",\n",
+                u8"    \"zhTW\": \"%+d 對遠程防禦\",\n",
+                u8"    \"deDE\": \"%+d Verteidigung gegen Geschoss\",\n",
+                u8"    \"esES\": \"%+d de defensa contra misiles\",\n",
+                u8"    \"frFR\": \"%+d de défense contre les projectiles\",\n",
+                u8"    \"itIT\": \"%+d difesa a distanza\",\n",
+                u8"    \"koKR\": \"원거리 공격 방어력 %+d\",\n",
+                u8"    \"plPL\": \"%+d do obrony przeciw pociskom\",\n",
+                u8"    \"esMX\": \"%+d de defensa contra proyectiles\",\n",
+                u8"    \"jaJP\": \"遠隔攻撃に対する防御力（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de defesa contra projéteis\",\n",
+                u8"    \"ruRU\": \"%+d к защите от снарядов\",\n",
+                u8"    \"zhCN\": \"%+d 远程防御\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3602,\n",
+                u8"    \"Key\": \"ModStr6b\",\n",
+                u8"    \"enUS\": \"%+d Defense vs. Melee\",\n",
+                u8"    \"zhTW\": \"%+d 對近戰防禦\",\n",
+                u8"    \"deDE\": \"%+d Verteidigung gegen Nahkampf\",\n",
+                u8"    \"esES\": \"%+d de defensa contra cuerpo a cuerpo\",\n",
+                u8"    \"frFR\": \"%+d de défense en mêlée\",\n",
+                u8"    \"itIT\": \"%+d difesa in mischia\",\n",
+                u8"    \"koKR\": \"근접 공격 방어력 %+d\",\n",
+                u8"    \"plPL\": \"%+d do obrony w walce wręcz\",\n",
+                u8"    \"esMX\": \"%+d de defensa contra melé\",\n",
+                u8"    \"jaJP\": \"近接攻撃に対する防御力（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de defesa contra corpo a corpo\",\n",
+                u8"    \"ruRU\": \"%+d к защите от ударов в ближнем бою\",\n",
+                u8"    \"zhCN\": \"%+d 近战防御\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3603,\n",
+                u8"    \"Key\": \"ModStr6c\",\n",
+                u8"    \"enUS\": \"%+d Life after each Demon Kill\",\n",
+                u8"    \"zhTW\": \"%+d 擊殺惡魔生命恢復\",\n",
+                u8"    \"deDE\": \"%+d Leben nach jedem besiegten Dämonen\",\n",
+                u8"    \"esES\": \"%+d p. de vida tras cada asesinato de demonio\",\n",
+                u8"    \"frFR\": \"%+d points de vie après chaque démon tué\",\n",
+                u8"    \"itIT\": \"%+d vita dopo ogni demone ucciso\",\n",
+                u8"    \"koKR\": \"악마 처치 시 생명력 %+d\",\n",
+                u8"    \"plPL\": \"%+d do zdrowia za każdego zabitego demona\",\n",
+                u8"    \"esMX\": \"%+d de vida tras cada asesinato de demonio\",\n",
+                u8"    \"jaJP\": \"デーモンを倒すとライフが回復（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d pontos de vida após cada abate de demônio\",\n",
+                u8"    \"ruRU\": \"%+d здоровья при убийстве демона\",\n",
+                u8"    \"zhCN\": \"%+d 每次消灭恶魔恢复的生命\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3607,\n",
+                u8"    \"Key\": \"ModStr6g\",\n",
+                u8"    \"enUS\": \"%+d%% Piercing Attack\",\n",
+                u8"    \"zhTW\": \"%+d%% 穿透攻擊\",\n",
+                u8"    \"deDE\": \"%+d%% durchbohrender Angriff\",\n",
+                u8"    \"esES\": \"%+d%% de ataque perforador\",\n",
+                u8"    \"frFR\": \"%+d%% de chances d’attaque perforante\",\n",
+                u8"    \"itIT\": \"Probabilità di trapassare il bersaglio %+d%%\",\n",
+                u8"    \"koKR\": \"관통 공격 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szansy na przeszywający atak\",\n",
+                u8"    \"esMX\": \"%+d%% de ataque perforante\",\n",
+                u8"    \"jaJP\": \"貫通攻撃（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de Ataque Perfurante\",\n",
+                u8"    \"ruRU\": \"%+d%% к пробивающей атаке\",\n",
+                u8"    \"zhCN\": \"%+d%% 穿刺攻击\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3608,\n",
+                u8"    \"Key\": \"ModStr6h\",\n",
+                u8"    \"enUS\": \"Fires Magic Arrows\",\n",
+                u8"    \"zhTW\": \"射出魔法箭矢\",\n",
+                u8"    \"deDE\": \"Feuert magische Pfeile ab\",\n",
+                u8"    \"esES\": \"Dispara flechas mágicas\",\n",
+                u8"    \"frFR\": \"Envoie des flèches magiques\",\n",
+                u8"    \"itIT\": \"Spara frecce magiche\",\n",
+                u8"    \"koKR\": \"마법 화살 발사\",\n",
+                u8"    \"plPL\": \"Wystrzeliwuje magiczne strzały\",\n",
+                u8"    \"esMX\": \"Dispara flechas mágicas\",\n",
+                u8"    \"jaJP\": \"魔法の矢を放つ\",\n",
+                u8"    \"ptBR\": \"Dispara flechas mágicas\",\n",
+                u8"    \"ruRU\": \"Магические стрелы\",\n",
+                u8"    \"zhCN\": \"射出魔法箭\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3609,\n",
+                u8"    \"Key\": \"ModStr6i\",\n",
+                u8"    \"enUS\": \"Fires Explosive Arrows or Bolts\",\n",
+                u8"    \"zhTW\": \"射出爆炸的弓矢或弩箭\",\n",
+                u8"    \"deDE\": \"Feuert explodierende Pfeile oder Bolzen ab\",\n",
+                u8"    \"esES\": \"Dispara flechas o descargas explosivas\",\n",
+                u8"    \"frFR\": \"Tire des flèches ou des traits explosifs\",\n",
+                u8"    \"itIT\": \"Spara frecce o dardi esplosivi\",\n",
+                u8"    \"koKR\": \"폭발하는 화살 발사\",\n",
+                u8"    \"plPL\": \"Wystrzeliwuje eksplodujące strzały lub bełty\",\n",
+                u8"    \"esMX\": \"Dispara flechas o saetas explosivas\",\n",
+                u8"    \"jaJP\": \"爆発する矢/ボルトを放つ\",\n",
+                u8"    \"ptBR\": \"Dispara flechas ou setas explosivas\",\n",
+                u8"    \"ruRU\": \"Взрывные стрелы или болты\",\n",
+                u8"    \"zhCN\": \"射出爆炸箭或弩矢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3625,\n",
+                u8"    \"Key\": \"improved damage\",\n",
+                u8"    \"enUS\": \"Improved Damage\",\n",
+                u8"    \"zhTW\": \"加強傷害\",\n",
+                u8"    \"deDE\": \"Verbesserter Schaden\",\n",
+                u8"    \"esES\": \"Daño mejorado\",\n",
+                u8"    \"frFR\": \"Dégâts améliorés\",\n",
+                u8"    \"itIT\": \"Danni migliorati\",\n",
+                u8"    \"koKR\": \"피해 향상\",\n",
+                u8"    \"plPL\": \"Zwiększone obrażenia\",\n",
+                u8"    \"esMX\": \"Daño mejorado\",\n",
+                u8"    \"jaJP\": \"ダメージ上昇\",\n",
+                u8"    \"ptBR\": \"Dano aprimorado\",\n",
+                u8"    \"ruRU\": \"Увеличенный урон\",\n",
+                u8"    \"zhCN\": \"提高伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3626,\n",
+                u8"    \"Key\": \"improved to hit\",\n",
+                u8"    \"enUS\": \"Improved Attack Rating\",\n",
+                u8"    \"zhTW\": \"加強準確率\",\n",
+                u8"    \"deDE\": \"Verbesserter Angriffswert\",\n",
+                u8"    \"esES\": \"Índice de ataque mejorado\",\n",
+                u8"    \"frFR\": \"Score d’attaque amélioré\",\n",
+                u8"    \"itIT\": \"Indice d'attacco migliorato\",\n",
+                u8"    \"koKR\": \"명중률 향상\",\n",
+                u8"    \"plPL\": \"Zwiększona skuteczność ataku\",\n",
+                u8"    \"esMX\": \"Índice de ataque mejorado\",\n",
+                u8"    \"jaJP\": \"命中率上昇\",\n",
+                u8"    \"ptBR\": \"Taxa de ataque aprimorada\",\n",
+                u8"    \"ruRU\": \"Увеличенный рейтинг атаки\",\n",
+                u8"    \"zhCN\": \"提高命中值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3627,\n",
+                u8"    \"Key\": \"improved armor class\",\n",
+                u8"    \"enUS\": \"Improved Defense\",\n",
+                u8"    \"zhTW\": \"加強防禦\",\n",
+                u8"    \"deDE\": \"Verbesserte Verteidigung\",\n",
+                u8"    \"esES\": \"Defensa mejorada\",\n",
+                u8"    \"frFR\": \"Défense améliorée\",\n",
+                u8"    \"itIT\": \"Difesa migliorata\",\n",
+                u8"    \"koKR\": \"방어력 향상\",\n",
+                u8"    \"plPL\": \"Zwiększona obrona\",\n",
+                u8"    \"esMX\": \"Defensa mejorada\",\n",
+                u8"    \"jaJP\": \"防御力上昇\",\n",
+                u8"    \"ptBR\": \"Defesa aprimorada\",\n",
+                u8"    \"ruRU\": \"Увеличенная защита\",\n",
+                u8"    \"zhCN\": \"提高防御\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3628,\n",
+                u8"    \"Key\": \"improved durability\",\n",
+                u8"    \"enUS\": \"Improved Durability\",\n",
+                u8"    \"zhTW\": \"加強耐久度\",\n",
+                u8"    \"deDE\": \"Erhöhte Haltbarkeit\",\n",
+                u8"    \"esES\": \"Durabilidad mejorada\",\n",
+                u8"    \"frFR\": \"Durabilité améliorée\",\n",
+                u8"    \"itIT\": \"Integrità migliorata\",\n",
+                u8"    \"koKR\": \"내구도 향상\",\n",
+                u8"    \"plPL\": \"Zwiększona trwałość\",\n",
+                u8"    \"esMX\": \"Durabilidad mejorada\",\n",
+                u8"    \"jaJP\": \"耐久力上昇\",\n",
+                u8"    \"ptBR\": \"Durabilidade aprimorada\",\n",
+                u8"    \"ruRU\": \"Увеличенная прочность\",\n",
+                u8"    \"zhCN\": \"提高耐久度\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3629,\n",
+                u8"    \"Key\": \"Quick Strike\",\n",
+                u8"    \"enUS\": \"Quick Strike\",\n",
+                u8"    \"zhTW\": \"快速攻擊\",\n",
+                u8"    \"deDE\": \"Schneller Schlag\",\n",
+                u8"    \"esES\": \"Golpe rápido\",\n",
+                u8"    \"frFR\": \"Coup rapide\",\n",
+                u8"    \"itIT\": \"Colpo rapido\",\n",
+                u8"    \"koKR\": \"빠른 타격\",\n",
+                u8"    \"plPL\": \"Szybkie Uderzenie\",\n",
+                u8"    \"esMX\": \"Golpe rápido\",\n",
+                u8"    \"jaJP\": \"クイック・ストライク\",\n",
+                u8"    \"ptBR\": \"Golpe Rápido\",\n",
+                u8"    \"ruRU\": \"Быстрый удар\",\n",
+                u8"    \"zhCN\": \"快速打击\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3630,\n",
+                u8"    \"Key\": \"strGemPlace1\",\n",
+                u8"    \"enUS\": \"Can Be Inserted in Socketed\",\n",
+                u8"    \"zhTW\": \"可以放入有鑲孔的\",\n",
+                u8"    \"deDE\": \"Anbringung möglich an gesockelten\",\n",
+                u8"    \"esES\": \"Se puede insertar en\",\n",
+                u8"    \"frFR\": \"Peut être insérée dans une châsse\",\n",
+                u8"    \"itIT\": \"Si può inserire in un castone\",\n",
+                u8"    \"koKR\": \"홈이 있는 아이템에 삽입 가능\",\n",
+                u8"    \"plPL\": \"Można umieścić w \",\n",
+                u8"    \"esMX\": \"Puede insertarse en objetos engarzados\",\n",
+                u8"    \"jaJP\": \"以下のソケット付きのアイテムに装着可能:\",\n",
+                u8"    \"ptBR\": \"Pode ser inserido em\",\n",
+                u8"    \"ruRU\": \"Можно вставить в предметы с гнездами\",\n",
+                u8"    \"zhCN\": \"可以插入镶孔中\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3631,\n",
+                u8"    \"Key\": \"strGemPlace2\",\n",
+                u8"    \"enUS\": \"Weapons, Shields or Helms\",\n",
+                u8"    \"zhTW\": \"武器、盾牌或頭盔\",\n",
+                u8"    \"deDE\": \"Waffen, Schilden oder Helmen\",\n",
+                u8"    \"esES\": \"armas, escudos o yelmos con huecos\",\n",
+                u8"    \"frFR\": \"d’arme, de bouclier ou de heaume\",\n",
+                u8"    \"itIT\": \"Armi, scudi o elmi\",\n",
+                u8"    \"koKR\": \"무기, 방패, 투구\",\n",
+                u8"    \"plPL\": \"broniach, tarczach lub hełmach z gniazdami\",\n",
+                u8"    \"esMX\": \"Armas, escudos o yelmos\",\n",
+                u8"    \"jaJP\": \"武器、盾、兜\",\n",
+                u8"    \"ptBR\": \"armas, escudos ou elmos engastados\",\n",
+                u8"    \"ruRU\": \"Оружие, щиты или шлемы\",\n",
+                u8"    \"zhCN\": \"武器，盾牌或头盔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4077,\n",
+                u8"    \"Key\": \"WeaponDescMace\",\n",
+                u8"    \"enUS\": \"Mace Class - %s\",\n",
+                u8"    \"zhTW\": \"釘鎚類武器 - %s\",\n",
+                u8"    \"deDE\": \"Streitkolbenklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de maza: %s\",\n",
+                u8"    \"frFR\": \"Type de masse - %s\",\n",
+                u8"    \"itIT\": \"Classe mazza - %s\",\n",
+                u8"    \"koKR\": \"철퇴 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa buław – %s\",\n",
+                u8"    \"esMX\": \"Tipo: maza - %s\",\n",
+                u8"    \"jaJP\": \"メイスタイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe maça - %s\",\n",
+                u8"    \"ruRU\": \"Булава – %s\",\n",
+                u8"    \"zhCN\": \"锤类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4078,\n",
+                u8"    \"Key\": \"WeaponDescAxe\",\n",
+                u8"    \"enUS\": \"Axe Class - %s\",\n",
+                u8"    \"zhTW\": \"斧頭類武器 - %s\",\n",
+                u8"    \"deDE\": \"Axtklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de hacha: %s\",\n",
+                u8"    \"frFR\": \"Type de hache - %s\",\n",
+                u8"    \"itIT\": \"Classe ascia - %s\",\n",
+                u8"    \"koKR\": \"도끼 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa toporów – %s\",\n",
+                u8"    \"esMX\": \"Tipo: hacha - %s\",\n",
+                u8"    \"jaJP\": \"斧タイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe machado - %s\",\n",
+                u8"    \"ruRU\": \"Топор – %s\",\n",
+                u8"    \"zhCN\": \"斧类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4079,\n",
+                u8"    \"Key\": \"WeaponDescSword - %s\",\n",
+                u8"    \"enUS\": \"Sword Class - %s\",\n",
+                u8"    \"zhTW\": \"刀劍類武器 - %s\",\n",
+                u8"    \"deDE\": \"Schwertklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de espada: %s\",\n",
+                u8"    \"frFR\": \"Type d’épée - %s\",\n",
+                u8"    \"itIT\": \"Classe spada - %s\",\n",
+                u8"    \"koKR\": \"도검 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa mieczy – %s\",\n",
+                u8"    \"esMX\": \"Tipo: espada - %s\",\n",
+                u8"    \"jaJP\": \"剣タイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe espada - %s\",\n",
+                u8"    \"ruRU\": \"Меч – %s\",\n",
+                u8"    \"zhCN\": \"剑类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4080,\n",
+                u8"    \"Key\": \"WeaponDescDagger\",\n",
+                u8"    \"enUS\": \"Dagger Class - %s\",\n",
+                u8"    \"zhTW\": \"匕首類武器 - %s\",\n",
+                u8"    \"deDE\": \"Dolchklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de daga: %s\",\n",
+                u8"    \"frFR\": \"Type de dague - %s\",\n",
+                u8"    \"itIT\": \"Classe pugnale - %s\",\n",
+                u8"    \"koKR\": \"단도 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa sztyletów – %s\",\n",
+                u8"    \"esMX\": \"Tipo: daga - %s\",\n",
+                u8"    \"jaJP\": \"ダガータイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe adaga - %s\",\n",
+                u8"    \"ruRU\": \"Кинжал – %s\",\n",
+                u8"    \"zhCN\": \"匕首类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4082,\n",
+                u8"    \"Key\": \"WeaponDescJavelin\",\n",
+                u8"    \"enUS\": \"Javelin Class - %s\",\n",
+                u8"    \"zhTW\": \"標槍類武器 - %s\",\n",
+                u8"    \"deDE\": \"Wurfspießklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de jabalina: %s\",\n",
+                u8"    \"frFR\": \"Type de javelot - %s\",\n",
+                u8"    \"itIT\": \"Classe giavellotto - %s\",\n",
+                u8"    \"koKR\": \"투창 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa oszczepów – %s\",\n",
+                u8"    \"esMX\": \"Tipo: jabalina - %s\",\n",
+                u8"    \"jaJP\": \"ジャベリンタイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe dardo - %s\",\n",
+                u8"    \"ruRU\": \"Дротик – %s\",\n",
+                u8"    \"zhCN\": \"标枪类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4083,\n",
+                u8"    \"Key\": \"WeaponDescSpear\",\n",
+                u8"    \"enUS\": \"Spear Class - %s\",\n",
+                u8"    \"zhTW\": \"長矛類武器 - %s\",\n",
+                u8"    \"deDE\": \"Speerklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de lanza: %s\",\n",
+                u8"    \"frFR\": \"Type de lance - %s\",\n",
+                u8"    \"itIT\": \"Classe lancia - %s\",\n",
+                u8"    \"koKR\": \"창 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa włóczni – %s\",\n",
+                u8"    \"esMX\": \"Tipo: lanza - %s\",\n",
+                u8"    \"jaJP\": \"スピアタイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe lança - %s\",\n",
+                u8"    \"ruRU\": \"Копье – %s\",\n",
+                u8"    \"zhCN\": \"矛类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4084,\n",
+                u8"    \"Key\": \"WeaponDescBow\",\n",
+                u8"    \"enUS\": \"Bow Class - %s\",\n",
+                u8"    \"zhTW\": \"弓類武器 - %s\",\n",
+                u8"    \"deDE\": \"Bogenklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de arco: %s\",\n",
+                u8"    \"frFR\": \"Type d’arc - %s\",\n",
+                u8"    \"itIT\": \"Classe arco - %s\",\n",
+                u8"    \"koKR\": \"활 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa łuków – %s\",\n",
+                u8"    \"esMX\": \"Tipo: arco - %s\",\n",
+                u8"    \"jaJP\": \"弓タイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe arco - %s\",\n",
+                u8"    \"ruRU\": \"Лук – %s\",\n",
+                u8"    \"zhCN\": \"弓类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4085,\n",
+                u8"    \"Key\": \"WeaponDescStaff\",\n",
+                u8"    \"enUS\": \"Staff Class - %s\",\n",
+                u8"    \"zhTW\": \"法杖類武器 - %s\",\n",
+                u8"    \"deDE\": \"Stabklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de bastón: %s\",\n",
+                u8"    \"frFR\": \"Type de bâton - %s\",\n",
+                u8"    \"itIT\": \"Classe bastone - %s\",\n",
+                u8"    \"koKR\": \"지팡이 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa kosturów – %s\",\n",
+                u8"    \"esMX\": \"Tipo: bastón - %s\",\n",
+                u8"    \"jaJP\": \"杖タイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe cajado - %s\",\n",
+                u8"    \"ruRU\": \"Посох – %s\",\n",
+                u8"    \"zhCN\": \"法杖类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4086,\n",
+                u8"    \"Key\": \"WeaponDescPoleArm\",\n",
+                u8"    \"enUS\": \"Polearm Class - %s\",\n",
+                u8"    \"zhTW\": \"長柄類武器 - %s\",\n",
+                u8"    \"deDE\": \"Stangenwaffenklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de arma de asta: %s\",\n",
+                u8"    \"frFR\": \"Type d’arme d’hast - %s\",\n",
+                u8"    \"itIT\": \"Classe arma in asta - %s\",\n",
+                u8"    \"koKR\": \"미늘창 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa broni drzewcowych – %s\",\n",
+                u8"    \"esMX\": \"Tipo: arma de asta - %s\",\n",
+                u8"    \"jaJP\": \"長柄武器タイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe haste - %s\",\n",
+                u8"    \"ruRU\": \"Древковое оружие – %s\",\n",
+                u8"    \"zhCN\": \"长柄类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4087,\n",
+                u8"    \"Key\": \"WeaponDescCrossBow\",\n",
+                u8"    \"enUS\": \"Crossbow Class - %s\",\n",
+                u8"    \"zhTW\": \"弩類武器 - %s\",\n",
+                u8"    \"deDE\": \"Armbrustklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de ballesta: %s\",\n",
+                u8"    \"frFR\": \"Type d’arbalète - %s\",\n",
+                u8"    \"itIT\": \"Classe balestra - %s\",\n",
+                u8"    \"koKR\": \"쇠뇌 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa kusz – %s\",\n",
+                u8"    \"esMX\": \"Tipo: ballesta - %s\",\n",
+                u8"    \"jaJP\": \"クロスボウタイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe besta - %s\",\n",
+                u8"    \"ruRU\": \"Арбалет – %s\",\n",
+                u8"    \"zhCN\": \"弩类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4088,\n",
+                u8"    \"Key\": \"WeaponAttackFastest\",\n",
+                u8"    \"enUS\": \"Fastest Attack Speed\",\n",
+                u8"    \"zhTW\": \"最快的攻擊速度\",\n",
+                u8"    \"deDE\": \"Schnellste Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Velocidad de ataque máxima\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque : la plus rapide\",\n",
+                u8"    \"itIT\": \"Velocità d'attacco massima\",\n",
+                u8"    \"koKR\": \"가장 빠른 공격 속도\",\n",
+                u8"    \"plPL\": \"Największa szybkość ataku\",\n",
+                u8"    \"esMX\": \"Velocidad de ataque superrápida\",\n",
+                u8"    \"jaJP\": \"攻撃速度（非常に速い）\",\n",
+                u8"    \"ptBR\": \"Velocidade de ataque máxima\",\n",
+                u8"    \"ruRU\": \"максимальная скорость атаки\",\n",
+                u8"    \"zhCN\": \"攻击速度 - 最快\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4089,\n",
+                u8"    \"Key\": \"WeaponAttackVeryFast\",\n",
+                u8"    \"enUS\": \"Very Fast Attack Speed\",\n",
+                u8"    \"zhTW\": \"極快的攻擊速度\",\n",
+                u8"    \"deDE\": \"Sehr schnelle Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Velocidad de ataque muy alta\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque : très rapide\",\n",
+                u8"    \"itIT\": \"Velocità d'attacco molto elevata\",\n",
+                u8"    \"koKR\": \"매우 빠른 공격 속도\",\n",
+                u8"    \"plPL\": \"Bardzo duża szybkość ataku\",\n",
+                u8"    \"esMX\": \"Velocidad de ataque muy rápida\",\n",
+                u8"    \"jaJP\": \"攻撃速度（速い）\",\n",
+                u8"    \"ptBR\": \"Velocidade de ataque muito rápida\",\n",
+                u8"    \"ruRU\": \"очень высокая скорость атаки\",\n",
+                u8"    \"zhCN\": \"攻击速度 - 非常快\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4090,\n",
+                u8"    \"Key\": \"WeaponAttackFast\",\n",
+                u8"    \"enUS\": \"Fast Attack Speed\",\n",
+                u8"    \"zhTW\": \"快速的攻擊速度\",\n",
+                u8"    \"deDE\": \"Schnelle Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Velocidad de ataque alta\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque : rapide\",\n",
+                u8"    \"itIT\": \"Velocità d'attacco elevata\",\n",
+                u8"    \"koKR\": \"빠른 공격 속도\",\n",
+                u8"    \"plPL\": \"Duża szybkość ataku\",\n",
+                u8"    \"esMX\": \"Velocidad de ataque rápida\",\n",
+                u8"    \"jaJP\": \"攻撃速度（やや速い）\",\n",
+                u8"    \"ptBR\": \"Velocidade de ataque rápida\",\n",
+                u8"    \"ruRU\": \"высокая скорость атаки\",\n",
+                u8"    \"zhCN\": \"攻击速度 - 快速\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4091,\n",
+                u8"    \"Key\": \"WeaponAttackNormal\",\n",
+                u8"    \"enUS\": \"Normal Attack Speed\",\n",
+                u8"    \"zhTW\": \"一般的攻擊速度\",\n",
+                u8"    \"deDE\": \"Normale Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Velocidad de ataque normal\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque : normale\",\n",
+                u8"    \"itIT\": \"Velocità d'attacco normale\",\n",
+                u8"    \"koKR\": \"보통 공격 속도\",\n",
+                u8"    \"plPL\": \"Normalna szybkość ataku\",\n",
+                u8"    \"esMX\": \"Velocidad de ataque normal\",\n",
+                u8"    \"jaJP\": \"攻撃速度（通常）\",\n",
+                u8"    \"ptBR\": \"Velocidade de ataque normal\",\n",
+                u8"    \"ruRU\": \"обычная скорость атаки\",\n",
+                u8"    \"zhCN\": \"攻击速度 - 正常\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4092,\n",
+                u8"    \"Key\": \"WeaponAttackSlow\",\n",
+                u8"    \"enUS\": \"Slow Attack Speed\",\n",
+                u8"    \"zhTW\": \"緩慢的攻擊速度\",\n",
+                u8"    \"deDE\": \"Langsame Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Velocidad de ataque baja\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque : lente\",\n",
+                u8"    \"itIT\": \"Velocità d'attacco ridotta\",\n",
+                u8"    \"koKR\": \"느린 공격 속도\",\n",
+                u8"    \"plPL\": \"Niska szybkość ataku\",\n",
+                u8"    \"esMX\": \"Velocidad de ataque lenta\",\n",
+                u8"    \"jaJP\": \"攻撃速度（やや遅い）\",\n",
+                u8"    \"ptBR\": \"Velocidade de ataque lenta\",\n",
+                u8"    \"ruRU\": \"низкая скорость атаки\",\n",
+                u8"    \"zhCN\": \"攻击速度 - 慢速\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4093,\n",
+                u8"    \"Key\": \"WeaponAttackVerySlow\",\n",
+                u8"    \"enUS\": \"Very Slow Attack Speed\",\n",
+                u8"    \"zhTW\": \"極慢的攻擊速度\",\n",
+                u8"    \"deDE\": \"Sehr langsame Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Velocidad de ataque muy baja\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque : très lente\",\n",
+                u8"    \"itIT\": \"Velocità d'attacco molto ridotta\",\n",
+                u8"    \"koKR\": \"매우 느린 공격 속도\",\n",
+                u8"    \"plPL\": \"Bardzo niska szybkość ataku\",\n",
+                u8"    \"esMX\": \"Velocidad de ataque muy lenta\",\n",
+                u8"    \"jaJP\": \"攻撃速度（遅い）\",\n",
+                u8"    \"ptBR\": \"Velocidade de ataque muito lenta\",\n",
+                u8"    \"ruRU\": \"очень низкая скорость атаки\",\n",
+                u8"    \"zhCN\": \"攻击速度 - 非常慢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4094,\n",
+                u8"    \"Key\": \"WeaponAttackSlowest\",\n",
+                u8"    \"enUS\": \"Slowest Attack Speed\",\n",
+                u8"    \"zhTW\": \"最慢的攻擊速度\",\n",
+                u8"    \"deDE\": \"Langsamste Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"Velocidad de ataque mínima\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque : la moins rapide\",\n",
+                u8"    \"itIT\": \"Velocità d'attacco minima\",\n",
+                u8"    \"koKR\": \"가장 느린 공격 속도\",\n",
+                u8"    \"plPL\": \"Najniższa szybkość ataku\",\n",
+                u8"    \"esMX\": \"Velocidad de ataque superlenta\",\n",
+                u8"    \"jaJP\": \"攻撃速度（非常に遅い）\",\n",
+                u8"    \"ptBR\": \"Velocidade de ataque mínima\",\n",
+                u8"    \"ruRU\": \"минимальная скорость атаки\",\n",
+                u8"    \"zhCN\": \"攻击速度 - 最慢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10001,\n",
+                u8"    \"Key\": \"ModStr5d\",\n",
+                u8"    \"enUS\": \"%+d Maximum Stamina\",\n",
+                u8"    \"zhTW\": \"%+d 精力上限\",\n",
+                u8"    \"deDE\": \"%+d max. Ausdauer\",\n",
+                u8"    \"esES\": \"%+d de aguante máximo\",\n",
+                u8"    \"frFR\": \"%+d d’Endurance maximale\",\n",
+                u8"    \"itIT\": \"%+d vigore massimo\",\n",
+                u8"    \"koKR\": \"최대 지구력 %+d\",\n",
+                u8"    \"plPL\": \"%+d do maksymalnej wartości wytrzymałości\",\n",
+                u8"    \"esMX\": \"%+d de vigor máximo\",\n",
+                u8"    \"jaJP\": \"スタミナ最大値（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de vigor máximo\",\n",
+                u8"    \"ruRU\": \"%+d к максимальной выносливости\",\n",
+                u8"    \"zhCN\": \"%+d 最大耐力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10020,\n",
+                u8"    \"Key\": \"ModStr6e\",\n",
+                u8"    \"enUS\": \"%d%% Slower Stamina Drain\",\n",
+                u8"    \"zhTW\": \"精力消耗減緩 %d%%\",\n",
+                u8"    \"deDE\": \"%d%% langsamerer Ausdauerverbrauch\",\n",
+                u8"    \"esES\": \"Consumo de aguante un %d%% más lento\",\n",
+                u8"    \"frFR\": \"Drain d’Endurance ralenti de %d%%\",\n",
+                u8"    \"itIT\": \"Consumo di vigore più lento del %d%%\",\n",
+                u8"    \"koKR\": \"지구력 고갈 속도 %d%% 감소\",\n",
+                u8"    \"plPL\": \"Wytrzymałość maleje o %d%% wolniej\",\n",
+                u8"    \"esMX\": \"%d%% menos de pérdida de vigor\",\n",
+                u8"    \"jaJP\": \"スタミナ消費軽減（%d%%）\",\n",
+                u8"    \"ptBR\": \"Drenagem de vigor reduzida em %d%%\",\n",
+                u8"    \"ruRU\": \"Выносливость снижается на %d%% медленнее\",\n",
+                u8"    \"zhCN\": \"%d%% 降低耐力消耗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10023,\n",
+                u8"    \"Key\": \"strModEnhancedDamage\",\n",
+                u8"    \"enUS\": \"%+d%% Enhanced Damage\",\n",
+                u8"    \"zhTW\": \"%+d%% 傷害強化\",\n",
+                u8"    \"deDE\": \"%+d%% erhöhter Schaden\",\n",
+                u8"    \"esES\": \"%+d%% de daño mejorado\",\n",
+                u8"    \"frFR\": \"%+d%% de dégâts supplémentaires\",\n",
+                u8"    \"itIT\": \"%+d%% danni\",\n",
+                u8"    \"koKR\": \"피해 %+d%% 증가\",\n",
+                u8"    \"plPL\": \"%+d%% do obrażeń\",\n",
+                u8"    \"esMX\": \"%+d%% de daño mejorado\",\n",
+                u8"    \"jaJP\": \"ダメージを強化（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de dano aprimorado\",\n",
+                u8"    \"ruRU\": \"%+d%% к урону\",\n",
+                u8"    \"zhCN\": \"%+d%% 强化伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10024,\n",
+                u8"    \"Key\": \"strModAllResistances\",\n",
+                u8"    \"enUS\": \"All Resistances %+d\",\n",
+                u8"    \"zhTW\": \"所有抗性 %+d\",\n",
+                u8"    \"deDE\": \"Alle Widerstände %+d\",\n",
+                u8"    \"esES\": \"%+d a todas las resistencias\",\n",
+                u8"    \"frFR\": \"%+d à toutes les résistances\",\n",
+                u8"    \"itIT\": \"%+d a tutte le resistenze\",\n",
+                u8"    \"koKR\": \"모든 저항 %+d\",\n",
+                u8"    \"plPL\": \"%+d do wszystkich odporności\",\n",
+                u8"    \"esMX\": \"%+d a todas las resistencias\",\n",
+                u8"    \"jaJP\": \"全属性耐性（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para todas as resistências\",\n",
+                u8"    \"ruRU\": \"%+d к сопротивлению всем видам урона\",\n",
+                u8"    \"zhCN\": \"%+d 所有抗性\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10025,\n",
+                u8"    \"Key\": \"strModAllSkillLevels\",\n",
+                u8"    \"enUS\": \"%+d to All Skill Levels\",\n",
+                u8"    \"zhTW\": \"%+d 所有技能等級\",\n",
+                u8"    \"deDE\": \"%+d zu allen Fertigkeitenstufen\",\n",
+                u8"    \"esES\": \"%+d a todos los niveles de habilidad\",\n",
+                u8"    \"frFR\": \"%+d à toutes les compétences\",\n",
+                u8"    \"itIT\": \"%+d a tutte le abilità\",\n",
+                u8"    \"koKR\": \"모든 기술 레벨 %+d\",\n",
+                u8"    \"plPL\": \"%+d do wszystkich umiejętności\",\n",
+                u8"    \"esMX\": \"%+d a todos los niveles de habilidad\",\n",
+                u8"    \"jaJP\": \"全スキルレベル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para todos os níveis de habilidade\",\n",
+                u8"    \"ruRU\": \"%+d к уровню всех умений\",\n",
+                u8"    \"zhCN\": \"%+d 所有技能等级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10026,\n",
+                u8"    \"Key\": \"strModFireDamage\",\n",
+                u8"    \"enUS\": \"%+d fire damage\",\n",
+                u8"    \"zhTW\": \"%+d 火焰傷害\",\n",
+                u8"    \"deDE\": \"%+d Feuerschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño de fuego\",\n",
+                u8"    \"frFR\": \"%+d pts de dégâts de Feu\",\n",
+                u8"    \"itIT\": \"%+d danni da fuoco\",\n",
+                u8"    \"koKR\": \"화염 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d obrażeń od ognia\",\n",
+                u8"    \"esMX\": \"%+d de daño de fuego\",\n",
+                u8"    \"jaJP\": \"火炎ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano ígneo\",\n",
+                u8"    \"ruRU\": \"%+d урона от огня\",\n",
+                u8"    \"zhCN\": \"%+d 火焰伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10027,\n",
+                u8"    \"Key\": \"strModFireDamageRange\",\n",
+                u8"    \"enUS\": \"Adds %d-%d fire damage\",\n",
+                u8"    \"zhTW\": \"附加 %d - %d 火焰傷害\",\n",
+                u8"    \"deDE\": \"Fügt %d-%d Feuerschaden hinzu\",\n",
+                u8"    \"esES\": \"Añade %d-%d p. daño de fuego\",\n",
+                u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts de Feu\",\n",
+                u8"    \"itIT\": \"Aggiunge %d-%d danni da fuoco\",\n",
+                u8"    \"koKR\": \"화염 피해 %d - %d 추가\",\n",
+                u8"    \"plPL\": \"Dodaje %d-%d obrażeń od ognia\",\n",
+                u8"    \"esMX\": \"Agrega %d-%d de daño de fuego\",\n",
+                u8"    \"jaJP\": \"火炎ダメージ上昇（%d - %d）\",\n",
+                u8"    \"ptBR\": \"Adiciona %d-%d de dano ígneo\",\n",
+                u8"    \"ruRU\": \"+%d–%d урона от огня\",\n",
+                u8"    \"zhCN\": \"+ %d-%d 火焰伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10028,\n",
+                u8"    \"Key\": \"strModColdDamage\",\n",
+                u8"    \"enUS\": \"%+d cold damage\",\n",
+                u8"    \"zhTW\": \"%+d 冰寒傷害\",\n",
+                u8"    \"deDE\": \"%+d Kälteschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño de frío\",\n",
+                u8"    \"frFR\": \"%+d pts de dégâts de Froid\",\n",
+                u8"    \"itIT\": \"%+d danni da freddo\",\n",
+                u8"    \"koKR\": \"냉기 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d obrażeń od zimna\",\n",
+                u8"    \"esMX\": \"%+d de daño de frío\",\n",
+                u8"    \"jaJP\": \"冷気ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano gélido\",\n",
+                u8"    \"ruRU\": \"%+d урона от льда\",\n",
+                u8"    \"zhCN\": \"%+d 冰霜伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10029,\n",
+                u8"    \"Key\": \"strModColdDamageRange\",\n",
+                u8"    \"enUS\": \"Adds %d-%d cold damage\",\n",
+                u8"    \"zhTW\": \"附加 %d - %d 冰寒傷害\",\n",
+                u8"    \"deDE\": \"Fügt %d-%d Kälteschaden hinzu\",\n",
+                u8"    \"esES\": \"Añade %d-%d p. de daño de frío\",\n",
+                u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts de Froid\",\n",
+                u8"    \"itIT\": \"Aggiunge %d-%d danni da freddo\",\n",
+                u8"    \"koKR\": \"냉기 피해 %d - %d 추가\",\n",
+                u8"    \"plPL\": \"Dodaje %d-%d obrażeń od zimna\",\n",
+                u8"    \"esMX\": \"Agrega %d-%d de daño de frío\",\n",
+                u8"    \"jaJP\": \"冷気ダメージ上昇（%d - %d）\",\n",
+                u8"    \"ptBR\": \"Adiciona %d-%d de dano gélido\",\n",
+                u8"    \"ruRU\": \"+%d–%d урона от льда\",\n",
+                u8"    \"zhCN\": \"+ %d-%d 冰霜伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10030,\n",
+                u8"    \"Key\": \"strModLightningDamage\",\n",
+                u8"    \"enUS\": \"%+d lightning damage\",\n",
+                u8"    \"zhTW\": \"%+d 電擊傷害\",\n",
+                u8"    \"deDE\": \"%+d Blitzschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño de rayos\",\n",
+                u8"    \"frFR\": \"%+d pts de dégâts de Foudre\",\n",
+                u8"    \"itIT\": \"%+d danni da fulmine\",\n",
+                u8"    \"koKR\": \"번개 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d obrażeń od błyskawic\",\n",
+                u8"    \"esMX\": \"%+d de daño de rayo\",\n",
+                u8"    \"jaJP\": \"電撃ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano elétrico\",\n",
+                u8"    \"ruRU\": \"%+d урона от молнии\",\n",
+                u8"    \"zhCN\": \"%+d 闪电伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10031,\n",
+                u8"    \"Key\": \"strModLightningDamageRange\",\n",
+                u8"    \"enUS\": \"Adds %d-%d lightning damage\",\n",
+                u8"    \"zhTW\": \"附加 %d - %d 電擊傷害\",\n",
+                u8"    \"deDE\": \"Fügt %d-%d Blitzschaden hinzu\",\n",
+                u8"    \"esES\": \"Añade %d-%d p. de daño de rayos\",\n",
+                u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts de Foudre\",\n",
+                u8"    \"itIT\": \"Aggiunge %d-%d danni da fulmine\",\n",
+                u8"    \"koKR\": \"번개 피해 %d - %d 추가\",\n",
+                u8"    \"plPL\": \"Dodaje %d-%d obrażeń od błyskawic\",\n",
+                u8"    \"esMX\": \"Agrega %d-%d de daño de rayo\",\n",
+                u8"    \"jaJP\": \"電撃ダメージ上昇（%d - %d）\",\n",
+                u8"    \"ptBR\": \"Adiciona %d-%d de dano elétrico\",\n",
+                u8"    \"ruRU\": \"+%d–%d урона от молнии\",\n",
+                u8"    \"zhCN\": \"+ %d-%d 闪电伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10032,\n",
+                u8"    \"Key\": \"strModMagicDamage\",\n",
+                u8"    \"enUS\": \"%+d magic damage\",\n",
+                u8"    \"zhTW\": \"%+d 魔法傷害\",\n",
+                u8"    \"deDE\": \"%+d Magieschaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño mágico\",\n",
+                u8"    \"frFR\": \"%+d pts de dégâts magiques\",\n",
+                u8"    \"itIT\": \"%+d danni magici\",\n",
+                u8"    \"koKR\": \"마법 피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d obrażeń od magii\",\n",
+                u8"    \"esMX\": \"%+d de daño mágico\",\n",
+                u8"    \"jaJP\": \"魔法ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano mágico\",\n",
+                u8"    \"ruRU\": \"%+d магического урона\",\n",
+                u8"    \"zhCN\": \"%+d 魔法伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10033,\n",
+                u8"    \"Key\": \"strModMagicDamageRange\",\n",
+                u8"    \"enUS\": \"Adds %d-%d magic damage\",\n",
+                u8"    \"zhTW\": \"附加 %d - %d 魔法傷害\",\n",
+                u8"    \"deDE\": \"Fügt %d-%d Magieschaden hinzu\",\n",
+                u8"    \"esES\": \"Añade %d-%d p. de daño mágico\",\n",
+                u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts magiques\",\n",
+                u8"    \"itIT\": \"Aggiunge %d-%d danni magici\",\n",
+                u8"    \"koKR\": \"마법 피해 %d - %d 추가\",\n",
+                u8"    \"plPL\": \"Dodaje %d-%d obrażeń od magii\",\n",
+                u8"    \"esMX\": \"Agrega %d-%d de daño mágico\",\n",
+                u8"    \"jaJP\": \"魔法ダメージ上昇（%d - %d）\",\n",
+                u8"    \"ptBR\": \"Adiciona %d-%d de dano mágico\",\n",
+                u8"    \"ruRU\": \"+%d–%d магического урона\",\n",
+                u8"    \"zhCN\": \"+ %d-%d 魔法伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10034,\n",
+                u8"    \"Key\": \"strModPoisonDamage\",\n",
+                u8"    \"enUS\": \"%+d poison damage over %d seconds\",\n",
+                u8"    \"zhTW\": \"%+d 毒素傷害，時效 %d 秒\",\n",
+                u8"    \"deDE\": \"%+d Giftschaden über %d Sek.\",\n",
+                u8"    \"esES\": \"%+d p. de daño de veneno durante %d s\",\n",
+                u8"    \"frFR\": \"%+d pts de dégâts de Poison en %d s\",\n",
+                u8"    \"itIT\": \"%+d danni da veleno in %d s\",\n",
+                u8"    \"koKR\": \"독 피해 %+d (%d초에 걸쳐)\",\n",
+                u8"    \"plPL\": \"%+d obrażeń od trucizny w ciągu %d sek.\",\n",
+                u8"    \"esMX\": \"%+d de daño de veneno durante %d segundos\",\n",
+                u8"    \"jaJP\": \"毒ダメージ付与（合計%+dダメージを%d秒間で与える）\",\n",
+                u8"    \"ptBR\": \"%+d de dano venenoso ao longo de %d segundos\",\n",
+                u8"    \"ruRU\": \"%+d урона от яда за %d сек.\",\n",
+                u8"    \"zhCN\": \"%+d 毒素伤害，持续%d秒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10035,\n",
+                u8"    \"Key\": \"strModPoisonDamageRange\",\n",
+                u8"    \"enUS\": \"Adds %d-%d poison damage over %d seconds\",\n",
+                u8"    \"zhTW\": \"附加 %d - %d 毒素傷害，時效 %d 秒\",\n",
+                u8"    \"deDE\": \"Fügt %d-%d Giftschaden über %d Sek. hinzu\",\n",
+                u8"    \"esES\": \"Añade %d-%d p. de daño de veneno durante %d s\",\n",
+                u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts de Poison en %d s\",\n",
+                u8"    \"itIT\": \"Aggiunge %d-%d danni da veleno in %d s\",\n",
+                u8"    \"koKR\": \"독 피해 %d - %d 추가 (%d초에 걸쳐)\",\n",
+                u8"    \"plPL\": \"Dodaje %d-%d obrażeń od trucizny w ciągu %d sek.\",\n",
+                u8"    \"esMX\": \"Agrega %d-%d de daño de veneno durante %d segundos\",\n",
+                u8"    \"jaJP\": \"毒ダメージ付与（合計%d - %dダメージを%d秒間で与える）\",\n",
+                u8"    \"ptBR\": \"Adiciona %d-%d de dano venenoso ao longo de %d segundos\",\n",
+                u8"    \"ruRU\": \"+%d–%d урона от яда за %d сек.\",\n",
+                u8"    \"zhCN\": \"+ %d-%d 毒素伤害，持续%d秒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10036,\n",
+                u8"    \"Key\": \"strModMinDamage\",\n",
+                u8"    \"enUS\": \"%+d damage\",\n",
+                u8"    \"zhTW\": \"%+d 傷害\",\n",
+                u8"    \"deDE\": \"%+d Schaden\",\n",
+                u8"    \"esES\": \"%+d p. de daño\",\n",
+                u8"    \"frFR\": \"%+d pts de dégâts\",\n",
+                u8"    \"itIT\": \"%+d danni\",\n",
+                u8"    \"koKR\": \"피해 %+d\",\n",
+                u8"    \"plPL\": \"%+d do obrażeń\",\n",
+                u8"    \"esMX\": \"%+d de daño\",\n",
+                u8"    \"jaJP\": \"ダメージ（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de dano\",\n",
+                u8"    \"ruRU\": \"%+d к урону\",\n",
+                u8"    \"zhCN\": \"%+d 伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10037,\n",
+                u8"    \"Key\": \"strModMinDamageRange\",\n",
+                u8"    \"enUS\": \"Adds %d-%d damage\",\n",
+                u8"    \"zhTW\": \"附加 %d - %d 傷害\",\n",
+                u8"    \"deDE\": \"Fügt %d-%d Schaden hinzu\",\n",
+                u8"    \"esES\": \"Añade %d-%d p. de daño\",\n",
+                u8"    \"frFR\": \"Ajoute %d à %d pts de dégâts\",\n",
+                u8"    \"itIT\": \"Aggiunge %d-%d danni\",\n",
+                u8"    \"koKR\": \"피해 %d - %d 추가\",\n",
+                u8"    \"plPL\": \"Dodaje %d-%d obrażeń\",\n",
+                u8"    \"esMX\": \"Agrega %d-%d de daño\",\n",
+                u8"    \"jaJP\": \"ダメージ上昇（%d - %d）\",\n",
+                u8"    \"ptBR\": \"Adiciona %d-%d de dano\",\n",
+                u8"    \"ruRU\": \"+%d–%d урона\",\n",
+                u8"    \"zhCN\": \"+ %d-%d 伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10039,\n",
+                u8"    \"Key\": \"ModStre9j\",\n",
+                u8"    \"enUS\": \"Fire Damage Reduced by\",\n",
+                u8"    \"zhTW\": \"火焰傷害降低\",\n",
+                u8"    \"deDE\": \"Feuerschaden reduziert um\",\n",
+                u8"    \"esES\": \"Daño de fuego reducido un\",\n",
+                u8"    \"frFR\": \"Dégâts de Feu réduits de\",\n",
+                u8"    \"itIT\": \"Danni da fuoco ridotti di\",\n",
+                u8"    \"koKR\": \"화염 피해 감소\",\n",
+                u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od ognia o\",\n",
+                u8"    \"esMX\": \"Reduce el daño de fuego en\",\n",
+                u8"    \"jaJP\": \"火炎ダメージを軽減\",\n",
+                u8"    \"ptBR\": \"Dano ígneo reduzido em\",\n",
+                u8"    \"ruRU\": \"Урон от огня уменьшен на\",\n",
+                u8"    \"zhCN\": \"火焰伤害降低\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10040,\n",
+                u8"    \"Key\": \"ModStre9k\",\n",
+                u8"    \"enUS\": \"Cold Damage Reduced by\",\n",
+                u8"    \"zhTW\": \"冰寒傷害降低\",\n",
+                u8"    \"deDE\": \"Kälteschaden reduziert um\",\n",
+                u8"    \"esES\": \"Daño de frío reducido un\",\n",
+                u8"    \"frFR\": \"Dégâts de Froid réduits de\",\n",
+                u8"    \"itIT\": \"Danni da freddo ridotti di\",\n",
+                u8"    \"koKR\": \"냉기 피해 감소\",\n",
+                u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od zimna o\",\n",
+                u8"    \"esMX\": \"Reduce el daño de frío en\",\n",
+                u8"    \"jaJP\": \"冷気ダメージを軽減\",\n",
+                u8"    \"ptBR\": \"Dano gélido reduzido em\",\n",
+                u8"    \"ruRU\": \"Урон от льда уменьшен на\",\n",
+                u8"    \"zhCN\": \"冰霜伤害降低\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10041,\n",
+                u8"    \"Key\": \"ModStre9l\",\n",
+                u8"    \"enUS\": \"Lightning Damage Reduced by\",\n",
+                u8"    \"zhTW\": \"電擊傷害降低\",\n",
+                u8"    \"deDE\": \"Blitzschaden reduziert um\",\n",
+                u8"    \"esES\": \"Daño de rayos reducido un\",\n",
+                u8"    \"frFR\": \"Dégâts de Foudre réduits de\",\n",
+                u8"    \"itIT\": \"Danni da fulmine ridotti di\",\n",
+                u8"    \"koKR\": \"번개 피해 감소\",\n",
+                u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od błyskawic o\",\n",
+                u8"    \"esMX\": \"Reduce el daño de rayo en\",\n",
+                u8"    \"jaJP\": \"電撃ダメージを軽減\",\n",
+                u8"    \"ptBR\": \"Dano elétrico reduzido em\",\n",
+                u8"    \"ruRU\": \"Урон от молнии уменьшен на\",\n",
+                u8"    \"zhCN\": \"闪电伤害降低\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10042,\n",
+                u8"    \"Key\": \"ModStre9m\",\n",
+                u8"    \"enUS\": \"Poison Damage Reduced by\",\n",
+                u8"    \"zhTW\": \"毒素傷害降低\",\n",
+                u8"    \"deDE\": \"Giftschaden reduziert um\",\n",
+                u8"    \"esES\": \"Daño de veneno reducido un\",\n",
+                u8"    \"frFR\": \"Dégâts de Poison réduits de\",\n",
+                u8"    \"itIT\": \"Danni da veleno ridotti di\",\n",
+                u8"    \"koKR\": \"독 피해 감소\",\n",
+                u8"    \"plPL\": \"Zmniejsza otrzymywane obrażenia od trucizn o\",\n",
+                u8"    \"esMX\": \"Reduce el daño de veneno en\",\n",
+                u8"    \"jaJP\": \"毒ダメージを軽減\",\n",
+                u8"    \"ptBR\": \"Dano venenoso reduzido em\",\n",
+                u8"    \"ruRU\": \"Урон от яда уменьшен на\",\n",
+                u8"    \"zhCN\": \"毒素伤害降低\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10043,\n",
+                u8"    \"Key\": \"ModStre9n\",\n",
+                u8"    \"enUS\": \"%+d Absorbs Magic Damage\",\n",
+                u8"    \"zhTW\": \"%+d 魔法傷害吸收\",\n",
+                u8"    \"deDE\": \"%+d absorbiert Magieschaden\",\n",
+                u8"    \"esES\": \"%+d de absorción de daño mágico\",\n",
+                u8"    \"frFR\": \"%+d absorbe les dégâts magiques\",\n",
+                u8"    \"itIT\": \"%+d danni magici assorbiti\",\n",
+                u8"    \"koKR\": \"마법 피해 흡수 %+d\",\n",
+                u8"    \"plPL\": \"%+d do absorpcji obrażeń od magii\",\n",
+                u8"    \"esMX\": \"Absorbe %+d de daño mágico\",\n",
+                u8"    \"jaJP\": \"魔法ダメージを吸収（%+d）\",\n",
+                u8"    \"ptBR\": \"Absorve %+d de dano mágico\",\n",
+                u8"    \"ruRU\": \"%+d к поглощению урона от магии\",\n",
+                u8"    \"zhCN\": \"%+d 吸收魔法伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10044,\n",
+                u8"    \"Key\": \"ModStre9o\",\n",
+                u8"    \"enUS\": \"%+d Absorbs Fire Damage\",\n",
+                u8"    \"zhTW\": \"%+d 火焰傷害吸收\",\n",
+                u8"    \"deDE\": \"%+d absorbiert Feuerschaden\",\n",
+                u8"    \"esES\": \"%+d de absorción de daño de fuego\",\n",
+                u8"    \"frFR\": \"%+d absorbe les dégâts de Feu\",\n",
+                u8"    \"itIT\": \"%+d danni da fuoco assorbiti\",\n",
+                u8"    \"koKR\": \"화염 피해 흡수 %+d\",\n",
+                u8"    \"plPL\": \"%+d do absorpcji obrażeń od ognia\",\n",
+                u8"    \"esMX\": \"Absorbe %+d de daño de fuego\",\n",
+                u8"    \"jaJP\": \"火炎ダメージを吸収（%+d）\",\n",
+                u8"    \"ptBR\": \"Absorve %+d de dano ígneo\",\n",
+                u8"    \"ruRU\": \"%+d к поглощению урона от огня\",\n",
+                u8"    \"zhCN\": \"%+d 吸收火焰伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10045,\n",
+                u8"    \"Key\": \"ModStre9p\",\n",
+                u8"    \"enUS\": \"%+d Absorbs Cold Damage\",\n",
+                u8"    \"zhTW\": \"%+d 冰寒傷害吸收\",\n",
+                u8"    \"deDE\": \"%+d absorbiert Kälteschaden\",\n",
+                u8"    \"esES\": \"%+d de absorción de daño de frío\",\n",
+                u8"    \"frFR\": \"%+d absorbe les dégâts de Froid\",\n",
+                u8"    \"itIT\": \"%+d danni da freddo assorbiti\",\n",
+                u8"    \"koKR\": \"냉기 피해 흡수 %+d\",\n",
+                u8"    \"plPL\": \"%+d do absorpcji obrażeń od zimna\",\n",
+                u8"    \"esMX\": \"Absorbe %+d de daño de frío\",\n",
+                u8"    \"jaJP\": \"冷気ダメージを吸収（%+d）\",\n",
+                u8"    \"ptBR\": \"Absorve %+d de dano gélido\",\n",
+                u8"    \"ruRU\": \"%+d к поглощению урона от льда\",\n",
+                u8"    \"zhCN\": \"%+d 吸收冰霜伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10046,\n",
+                u8"    \"Key\": \"ModStre9q\",\n",
+                u8"    \"enUS\": \"%+d Absorbs Lightning Damage\",\n",
+                u8"    \"zhTW\": \"%+d 電擊傷害吸收\",\n",
+                u8"    \"deDE\": \"%+d absorbiert Blitzschaden\",\n",
+                u8"    \"esES\": \"%+d de absorción de daño de rayos\",\n",
+                u8"    \"frFR\": \"%+d absorbe les dégâts de Foudre\",\n",
+                u8"    \"itIT\": \"%+d danni da fulmine assorbiti\",\n",
+                u8"    \"koKR\": \"번개 피해 흡수 %+d\",\n",
+                u8"    \"plPL\": \"%+d do absorpcji obrażeń od błyskawic\",\n",
+                u8"    \"esMX\": \"Absorbe %+d de daño de rayo\",\n",
+                u8"    \"jaJP\": \"電撃ダメージを吸収（%+d）\",\n",
+                u8"    \"ptBR\": \"Absorve %+d de dano elétrico\",\n",
+                u8"    \"ruRU\": \"%+d к поглощению урона от молнии\",\n",
+                u8"    \"zhCN\": \"%+d 吸收闪电伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10047,\n",
+                u8"    \"Key\": \"ModStre9r\",\n",
+                u8"    \"enUS\": \"%+d Absorbs Poison Damage\",\n",
+                u8"    \"zhTW\": \"%+d 毒素傷害吸收\",\n",
+                u8"    \"deDE\": \"%+d absorbiert Giftschaden\",\n",
+                u8"    \"esES\": \"%+d de absorción de daño de veneno\",\n",
+                u8"    \"frFR\": \"%+d absorbe les dégâts de Poison\",\n",
+                u8"    \"itIT\": \"%+d danni da veleno assorbiti\",\n",
+                u8"    \"koKR\": \"독 피해 흡수 %+d\",\n",
+                u8"    \"plPL\": \"%+d do absorpcji obrażeń od trucizn\",\n",
+                u8"    \"esMX\": \"Absorbe %+d de daño de veneno\",\n",
+                u8"    \"jaJP\": \"毒ダメージを吸収（%+d）\",\n",
+                u8"    \"ptBR\": \"Absorve %+d de dano venenoso\",\n",
+                u8"    \"ruRU\": \"%+d к поглощению урона от яда\",\n",
+                u8"    \"zhCN\": \"%+d 吸收毒素伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10054,\n",
+                u8"    \"Key\": \"StrSklTabItem1\",\n",
+                u8"    \"enUS\": \"%+d to Javelin and Spear Skills\",\n",
+                u8"    \"zhTW\": \"%+d 標槍與長矛技能\",\n",
+                u8"    \"deDE\": \"%+d zu Wurfspieß- und Speerfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a las habilidades de jabalina y lanza\",\n",
+                u8"    \"frFR\": \"%+d au javelot et à la lance\",\n",
+                u8"    \"itIT\": \"%+d alle Abilità con lance e giavellotti\",\n",
+                u8"    \"koKR\": \"투창과 창 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Oszczepu i Włóczni\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Jabalina y lanza\",\n",
+                u8"    \"jaJP\": \"〈ジャベリン/スピア〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Dardos e Lanças\",\n",
+                u8"    \"ruRU\": \"%+d к умениям обращения с дротиками и копьями\",\n",
+                u8"    \"zhCN\": \"%+d 标枪和长矛技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10055,\n",
+                u8"    \"Key\": \"StrSklTabItem2\",\n",
+                u8"    \"enUS\": \"%+d to Passive and Magic Skills\",\n",
+                u8"    \"zhTW\": \"%+d 被動與魔法技能\",\n",
+                u8"    \"deDE\": \"%+d zu passiven und magischen Fertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a las habilidades pasivas y mágicas\",\n",
+                u8"    \"frFR\": \"%+d aux compétences passives et magiques\",\n",
+                u8"    \"itIT\": \"%+d alle Passive e magie\",\n",
+                u8"    \"koKR\": \"지속 효과와 마법 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Pasywnych i Magii\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Pasivas y magia\",\n",
+                u8"    \"jaJP\": \"〈常時発動/魔法〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Passivas e Magia\",\n",
+                u8"    \"ruRU\": \"%+d к пассивным и магическим умениям\",\n",
+                u8"    \"zhCN\": \"%+d 被动和魔法技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10056,\n",
+                u8"    \"Key\": \"StrSklTabItem3\",\n",
+                u8"    \"enUS\": \"%+d to Bow and Crossbow Skills\",\n",
+                u8"    \"zhTW\": \"%+d 弓與弩技能\",\n",
+                u8"    \"deDE\": \"%+d zu Bogen- und Armbrustfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a las habilidades de arco y ballesta\",\n",
+                u8"    \"frFR\": \"%+d à l’arc et à l’arbalète\",\n",
+                u8"    \"itIT\": \"%+d alle Abilità con archi e balestre\",\n",
+                u8"    \"koKR\": \"활과 쇠뇌 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Łuku i Kuszy\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Arco y ballesta\",\n",
+                u8"    \"jaJP\": \"〈弓/クロスボウ〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Arcos e Bestas\",\n",
+                u8"    \"ruRU\": \"%+d к умениям обращения с луками и арбалетами\",\n",
+                u8"    \"zhCN\": \"%+d 弓和弩技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10057,\n",
+                u8"    \"Key\": \"StrSklTabItem4\",\n",
+                u8"    \"enUS\": \"%+d to Defensive Auras\",\n",
+                u8"    \"zhTW\": \"%+d 防禦靈氣\",\n",
+                u8"    \"deDE\": \"%+d zu Defensivauren\",\n",
+                u8"    \"esES\": \"%+d a las auras defensivas\",\n",
+                u8"    \"frFR\": \"%+d aux auras défensives\",\n",
+                u8"    \"itIT\": \"%+d alle Aure difensive\",\n",
+                u8"    \"koKR\": \"방어 오라 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Aur Defensywnych\",\n",
+                u8"    \"esMX\": \"%+d a las Auras defensivas\",\n",
+                u8"    \"jaJP\": \"〈防御オーラ〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Auras Defensivas\",\n",
+                u8"    \"ruRU\": \"%+d к защитным аурам\",\n",
+                u8"    \"zhCN\": \"%+d 防御光环\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10058,\n",
+                u8"    \"Key\": \"StrSklTabItem5\",\n",
+                u8"    \"enUS\": \"%+d to Offensive Auras\",\n",
+                u8"    \"zhTW\": \"%+d 攻擊靈氣\",\n",
+                u8"    \"deDE\": \"%+d zu Offensivauren\",\n",
+                u8"    \"esES\": \"%+d a las auras ofensivas\",\n",
+                u8"    \"frFR\": \"%+d aux auras offensives\",\n",
+                u8"    \"itIT\": \"%+d alle Aure offensive\",\n",
+                u8"    \"koKR\": \"공격 오라 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Aur Ofensywnych\",\n",
+                u8"    \"esMX\": \"%+d a las Auras ofensivas\",\n",
+                u8"    \"jaJP\": \"〈攻撃オーラ〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Auras Ofensivas\",\n",
+                u8"    \"ruRU\": \"%+d к боевым аурам\",\n",
+                u8"    \"zhCN\": \"%+d 攻击光环\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10059,\n",
+                u8"    \"Key\": \"StrSklTabItem6\",\n",
+                u8"    \"enUS\": \"%+d to Combat Skills\",\n",
+                u8"    \"zhTW\": \"%+d 戰鬥技能\",\n",
+                u8"    \"deDE\": \"%+d zu Kampffertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a las habilidades de combate\",\n",
+                u8"    \"frFR\": \"%+d aux compétences de combat\",\n",
+                u8"    \"itIT\": \"%+d alle Abilità belliche\",\n",
+                u8"    \"koKR\": \"전투 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Walki\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Combate\",\n",
+                u8"    \"jaJP\": \"〈戦闘〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Habilidades de Combate\",\n",
+                u8"    \"ruRU\": \"%+d к боевым умениям\",\n",
+                u8"    \"zhCN\": \"%+d 战斗技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10061,\n",
+                u8"    \"Key\": \"StrSklTabItem7\",\n",
+                u8"    \"enUS\": \"%+d to Poison and Bone Skills\",\n",
+                u8"    \"zhTW\": \"%+d 毒素與骸骨技能\",\n",
+                u8"    \"deDE\": \"%+d zu Gift- und Knochenfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a las habilidades de veneno y hueso\",\n",
+                u8"    \"frFR\": \"%+d en comp. de Poison et d’os\",\n",
+                u8"    \"itIT\": \"%+d alle Magie di ossa e veleno\",\n",
+                u8"    \"koKR\": \"독과 뼈 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Trucizn i Kości\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Veneno y huesos\",\n",
+                u8"    \"jaJP\": \"〈ポイズン/ボーン〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Veneno e Ossos\",\n",
+                u8"    \"ruRU\": \"%+d к умениям ядов и костей\",\n",
+                u8"    \"zhCN\": \"%+d 毒素和白骨术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10062,\n",
+                u8"    \"Key\": \"StrSklTabItem8\",\n",
+                u8"    \"enUS\": \"%+d to Curses\",\n",
+                u8"    \"zhTW\": \"%+d 詛咒\",\n",
+                u8"    \"deDE\": \"%+d zu Flüchen\",\n",
+                u8"    \"esES\": \"%+d a las maldiciones\",\n",
+                u8"    \"frFR\": \"%+d en malédictions\",\n",
+                u8"    \"itIT\": \"%+d alle Maledizioni\",\n",
+                u8"    \"koKR\": \"저주 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Klątw\",\n",
+                u8"    \"esMX\": \"%+d a las Maldiciones\",\n",
+                u8"    \"jaJP\": \"〈呪い〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Maldições\",\n",
+                u8"    \"ruRU\": \"%+d к проклятиям\",\n",
+                u8"    \"zhCN\": \"%+d 诅咒术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10063,\n",
+                u8"    \"Key\": \"StrSklTabItem10\",\n",
+                u8"    \"enUS\": \"%+d to Warcries\",\n",
+                u8"    \"zhTW\": \"%+d 戰吼\",\n",
+                u8"    \"deDE\": \"%+d zu Kriegsschreien\",\n",
+                u8"    \"esES\": \"%+d a los gritos de guerra\",\n",
+                u8"    \"frFR\": \"%+d aux cris de guerre\",\n",
+                u8"    \"itIT\": \"%+d alle Grida di guerra\",\n",
+                u8"    \"koKR\": \"함성 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Okrzyków\",\n",
+                u8"    \"esMX\": \"%+d a los Gritos de guerra\",\n",
+                u8"    \"jaJP\": \"〈雄叫び〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Gritos de Guerra\",\n",
+                u8"    \"ruRU\": \"%+d к боевым кличам\",\n",
+                u8"    \"zhCN\": \"%+d 呐喊技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10064,\n",
+                u8"    \"Key\": \"StrSklTabItem11\",\n",
+                u8"    \"enUS\": \"%+d to Combat Skills\",\n",
+                u8"    \"zhTW\": \"%+d 戰鬥技能\",\n",
+                u8"    \"deDE\": \"%+d zu Kampffertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a las habilidades de combate\",\n",
+                u8"    \"frFR\": \"%+d aux compétences de combat\",\n",
+                u8"    \"itIT\": \"%+d alle Abilità belliche\",\n",
+                u8"    \"koKR\": \"전투 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Zdolności Bojowych\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Combate\",\n",
+                u8"    \"jaJP\": \"〈戦闘〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Habilidades de Combate\",\n",
+                u8"    \"ruRU\": \"%+d к боевым умениям\",\n",
+                u8"    \"zhCN\": \"%+d 战斗技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10065,\n",
+                u8"    \"Key\": \"StrSklTabItem12\",\n",
+                u8"    \"enUS\": \"%+d to Masteries\",\n",
+                u8"    \"zhTW\": \"%+d 戰鬥專精\",\n",
+                u8"    \"deDE\": \"%+d zu Beherrschungsfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a dominio del combate\",\n",
+                u8"    \"frFR\": \"%+d aux maîtrises\",\n",
+                u8"    \"itIT\": \"%+d ai Domini bellici\",\n",
+                u8"    \"koKR\": \"숙련 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Mistrzostw Bojowych\",\n",
+                u8"    \"esMX\": \"%+d a los Dominios\",\n",
+                u8"    \"jaJP\": \"〈武器術〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Maestrias\",\n",
+                u8"    \"ruRU\": \"%+d к умениям владения оружием\",\n",
+                u8"    \"zhCN\": \"%+d 精通类技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10066,\n",
+                u8"    \"Key\": \"StrSklTabItem13\",\n",
+                u8"    \"enUS\": \"%+d to Cold Skills\",\n",
+                u8"    \"zhTW\": \"%+d 冰寒技能\",\n",
+                u8"    \"deDE\": \"%+d zu Kältefertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los hechizos de frío\",\n",
+                u8"    \"frFR\": \"%+d aux compétences de Froid\",\n",
+                u8"    \"itIT\": \"%+d alle Magie del freddo\",\n",
+                u8"    \"koKR\": \"냉기 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Zimna\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Frío\",\n",
+                u8"    \"jaJP\": \"〈冷気〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Gelo\",\n",
+                u8"    \"ruRU\": \"%+d к умениям льда\",\n",
+                u8"    \"zhCN\": \"%+d 冰系法术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10067,\n",
+                u8"    \"Key\": \"StrSklTabItem14\",\n",
+                u8"    \"enUS\": \"%+d to Lightning Skills\",\n",
+                u8"    \"zhTW\": \"%+d 閃電技能\",\n",
+                u8"    \"deDE\": \"%+d zu Blitzfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los hechizos de rayos\",\n",
+                u8"    \"frFR\": \"%+d aux compétences de Foudre\",\n",
+                u8"    \"itIT\": \"%+d alle Magie del fulmine\",\n",
+                u8"    \"koKR\": \"번개 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Błyskawic\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Rayo\",\n",
+                u8"    \"jaJP\": \"〈電撃〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Eletricidade\",\n",
+                u8"    \"ruRU\": \"%+d к умениям молнии\",\n",
+                u8"    \"zhCN\": \"%+d 雷系法术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10068,\n",
+                u8"    \"Key\": \"StrSklTabItem15\",\n",
+                u8"    \"enUS\": \"%+d to Fire Skills\",\n",
+                u8"    \"zhTW\": \"%+d 火焰技能\",\n",
+                u8"    \"deDE\": \"%+d zu Feuerfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los hechizos de fuego\",\n",
+                u8"    \"frFR\": \"%+d aux compétences de Feu\",\n",
+                u8"    \"itIT\": \"%+d alle Magie del fuoco\",\n",
+                u8"    \"koKR\": \"화염 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Ognia\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Fuego\",\n",
+                u8"    \"jaJP\": \"〈火炎〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Fogo\",\n",
+                u8"    \"ruRU\": \"%+d к умениям огня\",\n",
+                u8"    \"zhCN\": \"%+d 火系法术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10069,\n",
+                u8"    \"Key\": \"StrSklTabItem16\",\n",
+                u8"    \"enUS\": \"%+d to Summoning Skills\",\n",
+                u8"    \"zhTW\": \"%+d 召喚技能\",\n",
+                u8"    \"deDE\": \"%+d zu Herbeirufungfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a las habilidades de invocación\",\n",
+                u8"    \"frFR\": \"%+d en invocation\",\n",
+                u8"    \"itIT\": \"%+d alle Magie di evocazione\",\n",
+                u8"    \"koKR\": \"소환 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Przyzwania\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Invocación\",\n",
+                u8"    \"jaJP\": \"〈召喚〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Invocação\",\n",
+                u8"    \"ruRU\": \"%+d к умениям спутников\",\n",
+                u8"    \"zhCN\": \"%+d 召唤技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10070,\n",
+                u8"    \"Key\": \"StrSklTabItem17\",\n",
+                u8"    \"enUS\": \"%+d to Shape Shifting Skills\",\n",
+                u8"    \"zhTW\": \"%+d 變形技能\",\n",
+                u8"    \"deDE\": \"%+d zu Gestaltwandlerfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a las habilidades de cambio de forma\",\n",
+                u8"    \"frFR\": \"%+d en métamorphose\",\n",
+                u8"    \"itIT\": \"%+d alle Abilità mutaforma\",\n",
+                u8"    \"koKR\": \"변신 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Zmiany Kształtu\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades de Metamorfosis\",\n",
+                u8"    \"jaJP\": \"〈変身〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Metamorfose\",\n",
+                u8"    \"ruRU\": \"%+d к умениям смены облика\",\n",
+                u8"    \"zhCN\": \"%+d 变形技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10071,\n",
+                u8"    \"Key\": \"StrSklTabItem18\",\n",
+                u8"    \"enUS\": \"%+d to Elemental Skills\",\n",
+                u8"    \"zhTW\": \"%+d 元素技能\",\n",
+                u8"    \"deDE\": \"%+d zu Elementarfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a las habilidades elementales\",\n",
+                u8"    \"frFR\": \"%+d en élémentaires\",\n",
+                u8"    \"itIT\": \"%+d alle Magie elementali\",\n",
+                u8"    \"koKR\": \"원소 기술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Żywiołów\",\n",
+                u8"    \"esMX\": \"%+d a las habilidades Elementales\",\n",
+                u8"    \"jaJP\": \"〈自然の力〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para habilidades Elementos\",\n",
+                u8"    \"ruRU\": \"%+d к силам стихий\",\n",
+                u8"    \"zhCN\": \"%+d 元素技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10072,\n",
+                u8"    \"Key\": \"StrSklTabItem19\",\n",
+                u8"    \"enUS\": \"%+d to Traps\",\n",
+                u8"    \"zhTW\": \"%+d 陷阱\",\n",
+                u8"    \"deDE\": \"%+d zu Fallen\",\n",
+                u8"    \"esES\": \"%+d a las trampas\",\n",
+                u8"    \"frFR\": \"%+d en pièges\",\n",
+                u8"    \"itIT\": \"%+d alle Trappole\",\n",
+                u8"    \"koKR\": \"덫 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Pułapek\",\n",
+                u8"    \"esMX\": \"%+d a las Trampas\",\n",
+                u8"    \"jaJP\": \"〈トラップ〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Armadilhas\",\n",
+                u8"    \"ruRU\": \"%+d к ловушкам\",\n",
+                u8"    \"zhCN\": \"%+d 陷阱\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10073,\n",
+                u8"    \"Key\": \"StrSklTabItem20\",\n",
+                u8"    \"enUS\": \"%+d to Shadow Disciplines\",\n",
+                u8"    \"zhTW\": \"%+d 暗影修行\",\n",
+                u8"    \"deDE\": \"%+d zu Schattendisziplinen\",\n",
+                u8"    \"esES\": \"%+d a la disciplina de las sombras\",\n",
+                u8"    \"frFR\": \"%+d en disciplines de l’ombre\",\n",
+                u8"    \"itIT\": \"%+d alle Discipline dell'ombra\",\n",
+                u8"    \"koKR\": \"그림자 단련 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Dyscyplin Cienia\",\n",
+                u8"    \"esMX\": \"%+d a las Disciplinas de las sombras\",\n",
+                u8"    \"jaJP\": \"〈シャドウアーツ〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Disciplinas Sombrias\",\n",
+                u8"    \"ruRU\": \"%+d к теневым навыкам\",\n",
+                u8"    \"zhCN\": \"%+d 影身训练\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10074,\n",
+                u8"    \"Key\": \"StrSklTabItem21\",\n",
+                u8"    \"enUS\": \"%+d to Martial Arts\",\n",
+                u8"    \"zhTW\": \"%+d 武學技藝\",\n",
+                u8"    \"deDE\": \"%+d zu Kampfkünsten\",\n",
+                u8"    \"esES\": \"%+d a las artes marciales\",\n",
+                u8"    \"frFR\": \"%+d en arts martiaux\",\n",
+                u8"    \"itIT\": \"%+d alle Arti marziali\",\n",
+                u8"    \"koKR\": \"무술 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności Sztuk Walki\",\n",
+                u8"    \"esMX\": \"%+d a las Artes marciales\",\n",
+                u8"    \"jaJP\": \"〈マーシャルアーツ〉スキル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para Artes Marciais\",\n",
+                u8"    \"ruRU\": \"%+d к боевым искусствам\",\n",
+                u8"    \"zhCN\": \"%+d 武学技艺\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10917,\n",
+                u8"    \"Key\": \"AmaOnly\",\n",
+                u8"    \"enUS\": \"(Amazon Only)\",\n",
+                u8"    \"zhTW\": \"（只限亞馬遜）\",\n",
+                u8"    \"deDE\": \"(Nur Amazone)\",\n",
+                u8"    \"esES\": \"(Solo amazona)\",\n",
+                u8"    \"frFR\": \"(Amazone uniquement)\",\n",
+                u8"    \"itIT\": \"(Solo Amazzone)\",\n",
+                u8"    \"koKR\": \"(아마존 전용)\",\n",
+                u8"    \"plPL\": \"(Amazonka)\",\n",
+                u8"    \"esMX\": \"(Solo para Amazona)\",\n",
+                u8"    \"jaJP\": \"（アマゾネス専用）\",\n",
+                u8"    \"ptBR\": \"(Somente Amazona)\",\n",
+                u8"    \"ruRU\": \"(только для амазонок)\",\n",
+                u8"    \"zhCN\": \"(仅限亚马逊)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10918,\n",
+                u8"    \"Key\": \"SorOnly\",\n",
+                u8"    \"enUS\": \"(Sorceress Only)\",\n",
+                u8"    \"zhTW\": \"（只限魔法使）\",\n",
+                u8"    \"deDE\": \"(Nur Zauberin)\",\n",
+                u8"    \"esES\": \"(Solo hechicera)\",\n",
+                u8"    \"frFR\": \"(Sorcière uniquement)\",\n",
+                u8"    \"itIT\": \"(Solo Incantatrice)\",\n",
+                u8"    \"koKR\": \"(원소술사 전용)\",\n",
+                u8"    \"plPL\": \"(Czarodziejka)\",\n",
+                u8"    \"esMX\": \"(Solo para Hechicera)\",\n",
+                u8"    \"jaJP\": \"（ソーサレス専用）\",\n",
+                u8"    \"ptBR\": \"(Somente Maga)\",\n",
+                u8"    \"ruRU\": \"(только для волшебниц)\",\n",
+                u8"    \"zhCN\": \"(仅限巫师)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10919,\n",
+                u8"    \"Key\": \"NecOnly\",\n",
+                u8"    \"enUS\": \"(Necromancer Only)\",\n",
+                u8"    \"zhTW\": \"（只限死靈法師）\",\n",
+                u8"    \"deDE\": \"(Nur Totenbeschwörer)\",\n",
+                u8"    \"esES\": \"(Solo nigromante)\",\n",
+                u8"    \"frFR\": \"(Nécromancien uniquement)\",\n",
+                u8"    \"itIT\": \"(Solo Negromante)\",\n",
+                u8"    \"koKR\": \"(강령술사 전용)\",\n",
+                u8"    \"plPL\": \"(Nekromanta)\",\n",
+                u8"    \"esMX\": \"(Solo para Nigromante)\",\n",
+                u8"    \"jaJP\": \"（ネクロマンサー専用）\",\n",
+                u8"    \"ptBR\": \"(Somente Necromante)\",\n",
+                u8"    \"ruRU\": \"(только для некромантов)\",\n",
+                u8"    \"zhCN\": \"(仅限死灵法师)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10920,\n",
+                u8"    \"Key\": \"PalOnly\",\n",
+                u8"    \"enUS\": \"(Paladin Only)\",\n",
+                u8"    \"zhTW\": \"（只限聖騎士）\",\n",
+                u8"    \"deDE\": \"(Nur Paladin)\",\n",
+                u8"    \"esES\": \"(Solo paladín)\",\n",
+                u8"    \"frFR\": \"(Paladin uniquement)\",\n",
+                u8"    \"itIT\": \"(Solo Paladino)\",\n",
+                u8"    \"koKR\": \"(성기사 전용)\",\n",
+                u8"    \"plPL\": \"(Paladyn)\",\n",
+                u8"    \"esMX\": \"(Solo para Paladín)\",\n",
+                u8"    \"jaJP\": \"（パラディン専用）\",\n",
+                u8"    \"ptBR\": \"(Somente Paladino)\",\n",
+                u8"    \"ruRU\": \"(только для паладинов)\",\n",
+                u8"    \"zhCN\": \"(仅限圣骑士)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10921,\n",
+                u8"    \"Key\": \"BarOnly\",\n",
+                u8"    \"enUS\": \"(Barbarian Only)\",\n",
+                u8"    \"zhTW\": \"（只限野蠻人）\",\n",
+                u8"    \"deDE\": \"(Nur Barbar)\",\n",
+                u8"    \"esES\": \"(Solo bárbaro)\",\n",
+                u8"    \"frFR\": \"(Barbare uniquement)\",\n",
+                u8"    \"itIT\": \"(Solo Barbaro)\",\n",
+                u8"    \"koKR\": \"(야만용사 전용)\",\n",
+                u8"    \"plPL\": \"(Barbarzyńca)\",\n",
+                u8"    \"esMX\": \"(Solo para Bárbaro)\",\n",
+                u8"    \"jaJP\": \"（バーバリアン専用）\",\n",
+                u8"    \"ptBR\": \"(Somente Bárbaro)\",\n",
+                u8"    \"ruRU\": \"(только для варваров)\",\n",
+                u8"    \"zhCN\": \"(仅限野蛮人)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10922,\n",
+                u8"    \"Key\": \"DruOnly\",\n",
+                u8"    \"enUS\": \"(Druid Only)\",\n",
+                u8"    \"zhTW\": \"（只限德魯伊）\",\n",
+                u8"    \"deDE\": \"(Nur Druide)\",\n",
+                u8"    \"esES\": \"(Solo druida)\",\n",
+                u8"    \"frFR\": \"(Druide uniquement)\",\n",
+                u8"    \"itIT\": \"(Solo Druido)\",\n",
+                u8"    \"koKR\": \"(드루이드 전용)\",\n",
+                u8"    \"plPL\": \"(Druid)\",\n",
+                u8"    \"esMX\": \"(Solo para Druida)\",\n",
+                u8"    \"jaJP\": \"（ドルイド専用）\",\n",
+                u8"    \"ptBR\": \"(Somente Druida)\",\n",
+                u8"    \"ruRU\": \"(только для друидов)\",\n",
+                u8"    \"zhCN\": \"(仅限德鲁伊)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10923,\n",
+                u8"    \"Key\": \"AssOnly\",\n",
+                u8"    \"enUS\": \"(Assassin Only)\",\n",
+                u8"    \"zhTW\": \"（只限刺客）\",\n",
+                u8"    \"deDE\": \"(Nur Assassine)\",\n",
+                u8"    \"esES\": \"(Solo asesina)\",\n",
+                u8"    \"frFR\": \"(Assassin uniquement)\",\n",
+                u8"    \"itIT\": \"(Solo Assassina)\",\n",
+                u8"    \"koKR\": \"(암살자 전용)\",\n",
+                u8"    \"plPL\": \"(Zabójczyni)\",\n",
+                u8"    \"esMX\": \"(Solo para Asesina)\",\n",
+                u8"    \"jaJP\": \"（アサシン専用）\",\n",
+                u8"    \"ptBR\": \"(Somente Assassina)\",\n",
+                u8"    \"ruRU\": \"(только для ассасинов)\",\n",
+                u8"    \"zhCN\": \"(仅限刺客)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10976,\n",
+                u8"    \"Key\": \"ModitemAura\",\n",
+                u8"    \"enUS\": \"Level %d %s Aura When Equipped\",\n",
+                u8"    \"zhTW\": \"裝備時賦予等級 %d %s靈氣\",\n",
+                u8"    \"deDE\": \"Stufe %d der %s-Aura, wenn getragen.\",\n",
+                u8"    \"esES\": \"Aura %1 de nivel %0 si está equipado\",\n",
+                u8"    \"frFR\": \"Aura de niveau %d pour %s quand équipé\",\n",
+                u8"    \"itIT\": \"Fornisce a livello %d aura di %s\",\n",
+                u8"    \"koKR\": \"장착 시 %d 레벨 %s 오라 효과 적용\",\n",
+                u8"    \"plPL\": \"Po wyposażeniu zapewnia aurę %1 na poziomie %0\",\n",
+                u8"    \"esMX\": \"Aura de %1 de nivel %0 al equiparse\",\n",
+                u8"    \"jaJP\": \"装備時にオーラ〈%1〉（レベル%0）を発動\",\n",
+                u8"    \"ptBR\": \"Aura %1 de nível %0 quando equipado\",\n",
+                u8"    \"ruRU\": \"При надевании дает ауру «%1» %0-го уровня\",\n",
+                u8"    \"zhCN\": \"装备时获得%d级%s光环\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10977,\n",
+                u8"    \"Key\": \"Moditem2allattrib\",\n",
+                u8"    \"enUS\": \"%+d to all Attributes\",\n",
+                u8"    \"zhTW\": \"%+d 所有屬性\",\n",
+                u8"    \"deDE\": \"%+d zu allen Attributen\",\n",
+                u8"    \"esES\": \"%+d a todos los atributos\",\n",
+                u8"    \"frFR\": \"%+d à toutes les caractéristiques\",\n",
+                u8"    \"itIT\": \"%+d a tutte le caratteristiche\",\n",
+                u8"    \"koKR\": \"모든 능력치 %+d\",\n",
+                u8"    \"plPL\": \"%+d do wszystkich atrybutów\",\n",
+                u8"    \"esMX\": \"%+d a todos los atributos\",\n",
+                u8"    \"jaJP\": \"全能力値（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d para todos os atributos\",\n",
+                u8"    \"ruRU\": \"%+d ко всем характеристикам\",\n",
+                u8"    \"zhCN\": \"%+d 所有属性\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10978,\n",
+                u8"    \"Key\": \"Moditem2ExpG\",\n",
+                u8"    \"enUS\": \"%+d%% to Experience Gained\",\n",
+                u8"    \"zhTW\": \"獲得的經驗值 %+d%%\",\n",
+                u8"    \"deDE\": \"%+d%% zu gesammelter Erfahrung\",\n",
+                u8"    \"esES\": \"%+d%% de experiencia obtenida\",\n",
+                u8"    \"frFR\": \"%+d%% au gain d’exp.\",\n",
+                u8"    \"itIT\": \"%+d%% esperienza guadagnata\",\n",
+                u8"    \"koKR\": \"경험치 획득량 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do zdobywanego doświadczenia\",\n",
+                u8"    \"esMX\": \"%+d%% a la experiencia obtenida\",\n",
+                u8"    \"jaJP\": \"獲得経験値（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de experiência obtida\",\n",
+                u8"    \"ruRU\": \"%+d%% к опыту\",\n",
+                u8"    \"zhCN\": \"%+d%% 获得的经验\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10979,\n",
+                u8"    \"Key\": \"ModitemHPaK\",\n",
+                u8"    \"enUS\": \"%+d Life after each Kill\",\n",
+                u8"    \"zhTW\": \"%+d 擊殺生命恢復\",\n",
+                u8"    \"deDE\": \"%+d Leben nach jedem Kill\",\n",
+                u8"    \"esES\": \"%+d p. de vida tras cada asesinato\",\n",
+                u8"    \"frFR\": \"%+d pts de vie après chaque victime\",\n",
+                u8"    \"itIT\": \"%+d vita dopo ogni uccisione\",\n",
+                u8"    \"koKR\": \"적 처치 시 생명력 %+d\",\n",
+                u8"    \"plPL\": \"%+d zdrowia za każdego zabitego przeciwnika\",\n",
+                u8"    \"esMX\": \"%+d de vida tras cada asesinato\",\n",
+                u8"    \"jaJP\": \"敵を倒すとライフが回復（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d pontos de vida após cada abate\",\n",
+                u8"    \"ruRU\": \"%+d здоровья при убийстве\",\n",
+                u8"    \"zhCN\": \"%+d 每次消灭恢复的生命\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10980,\n",
+                u8"    \"Key\": \"ModitemRedVendP\",\n",
+                u8"    \"enUS\": \"Reduces all Vendor Prices %d%%\",\n",
+                u8"    \"zhTW\": \"所有商人的價格降低 %d%%\",\n",
+                u8"    \"deDE\": \"Verringert alle Händlerpreise um %d%%\",\n",
+                u8"    \"esES\": \"Reduce un %d%% todos los precios de los vendedores\",\n",
+                u8"    \"frFR\": \"Réduit les prix des marchands de %d%%\",\n",
+                u8"    \"itIT\": \"Riduce i prezzi dei mercanti del %d%%\",\n",
+                u8"    \"koKR\": \"상점 물품 가격 %d%% 하락\",\n",
+                u8"    \"plPL\": \"Obniża ceny u wszystkich kupców o %d%%\",\n",
+                u8"    \"esMX\": \"Reduce un %d%% los precios de los mercaderes\",\n",
+                u8"    \"jaJP\": \"アイテム購入価格低下（-%d%%）\",\n",
+                u8"    \"ptBR\": \"Reduz todos os preços de comerciantes em %d%%\",\n",
+                u8"    \"ruRU\": \"Снижает цены у торговцев на %d%%\",\n",
+                u8"    \"zhCN\": \"所有商人的收费减少 %d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10981,\n",
+                u8"    \"Key\": \"ModitemSMRIP\",\n",
+                u8"    \"enUS\": \"Slain Monsters Rest in Peace\",\n",
+                u8"    \"zhTW\": \"殺死的怪物就此安息\",\n",
+                u8"    \"deDE\": \"Besiegte Monster ruhen in Frieden\",\n",
+                u8"    \"esES\": \"Los monstruos asesinados descansan en paz\",\n",
+                u8"    \"frFR\": \"Les monstres tués reposent en paix\",\n",
+                u8"    \"itIT\": \"I mostri uccisi riposano in pace\",\n",
+                u8"    \"koKR\": \"처치한 괴물이 안식에 듦\",\n",
+                u8"    \"plPL\": \"Zabite potwory spoczywają w pokoju\",\n",
+                u8"    \"esMX\": \"Los monstruos asesinados descansan en paz\",\n",
+                u8"    \"jaJP\": \"倒したモンスターが復活しなくなる\",\n",
+                u8"    \"ptBR\": \"Monstros mortos descansam em paz\",\n",
+                u8"    \"ruRU\": \"Убитые монстры не возрождаются\",\n",
+                u8"    \"zhCN\": \"消灭的怪物就此安息\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10982,\n",
+                u8"    \"Key\": \"ModitemAttratvsM\",\n",
+                u8"    \"enUS\": \"%d%% to Attack Rating versus\",\n",
+                u8"    \"zhTW\": \"%d%% 準確率，針對\",\n",
+                u8"    \"deDE\": \"%d%% zu Angriffswert gegen\",\n",
+                u8"    \"esES\": \"%d%% de índice de ataque contra\",\n",
+                u8"    \"frFR\": \"%d%% au score d’attaque contre\",\n",
+                u8"    \"itIT\": \"Indice d'attacco aumentato del %d%% contro\",\n",
+                u8"    \"koKR\": \"명중률 %d%% 증가 / 대상 한정:\",\n",
+                u8"    \"plPL\": \"+%d%% do skuteczności ataku przeciwko:\",\n",
+                u8"    \"esMX\": \"%d%% de índice de ataque contra\",\n",
+                u8"    \"jaJP\": \"への命中率（%d%%）\",\n",
+                u8"    \"ptBR\": \"%d%% de taxa de ataque contra\",\n",
+                u8"    \"ruRU\": \"%d%% к рейтингу атаки против следующих монстров:\",\n",
+                u8"    \"zhCN\": \"%d%% 提高命中值, 对\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10983,\n",
+                u8"    \"Key\": \"Moditemdamvsm\",\n",
+                u8"    \"enUS\": \"%d%% to Damage versus\",\n",
+                u8"    \"zhTW\": \"%d%% 傷害，針對\",\n",
+                u8"    \"deDE\": \"%d%% zu Schaden gegen\",\n",
+                u8"    \"esES\": \"%d%% de daño contra\",\n",
+                u8"    \"frFR\": \"%d%% aux dégâts contre\",\n",
+                u8"    \"itIT\": \"Danni aumentati del %d%% contro\",\n",
+                u8"    \"koKR\": \"피해 %d%% 증가 / 대상 한정:\",\n",
+                u8"    \"plPL\": \"+%d%% do obrażeń przeciwko:\",\n",
+                u8"    \"esMX\": \"%d%% de daño contra\",\n",
+                u8"    \"jaJP\": \"へのダメージ（%d%%）\",\n",
+                u8"    \"ptBR\": \"%d%% de dano contra\",\n",
+                u8"    \"ruRU\": \"%d%% к урону против следующих монстров:\",\n",
+                u8"    \"zhCN\": \"%d%% 提高伤害, 对\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10984,\n",
+                u8"    \"Key\": \"Moditemslayat\",\n",
+                u8"    \"enUS\": \"Slaying:\",\n",
+                u8"    \"zhTW\": \"殺死：\",\n",
+                u8"    \"deDE\": \"Besiegen:\",\n",
+                u8"    \"esES\": \"Aniquilación:\",\n",
+                u8"    \"frFR\": \"Pourfend :\",\n",
+                u8"    \"itIT\": \"Sterminio:\",\n",
+                u8"    \"koKR\": \"처단:\",\n",
+                u8"    \"plPL\": \"Zabito:\",\n",
+                u8"    \"esMX\": \"Ejecución:\",\n",
+                u8"    \"jaJP\": \"スレイング:\",\n",
+                u8"    \"ptBR\": \"Matança:\",\n",
+                u8"    \"ruRU\": \"Убийственность:\",\n",
+                u8"    \"zhCN\": \"杀戮:\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10985,\n",
+                u8"    \"Key\": \"Moditemreanimas\",\n",
+                u8"    \"enUS\": \"%0%% Reanimate as: %1\",\n",
+                u8"    \"zhTW\": \"%0%% 機率將目標復生為：%1\",\n",
+                u8"    \"deDE\": \"%0%% Wiederbeleben als: %1\",\n",
+                u8"    \"esES\": \"%0%% de reanimar víctimas como: %1\",\n",
+                u8"    \"frFR\": \"%0%% ranimé(s) sous forme de : %1\",\n",
+                u8"    \"itIT\": \"%0%% di rianimare come: %1\",\n",
+                u8"    \"koKR\": \"처치 시 %0%% 확률로 %1 소생\",\n",
+                u8"    \"plPL\": \"%0%% szansy na ożywienie wroga jako: %1\",\n",
+                u8"    \"esMX\": \"%0%% de reanimar como: %1\",\n",
+                u8"    \"jaJP\": \"〈%1〉として復活（確率%0%%）\",\n",
+                u8"    \"ptBR\": \"%0%% de chance de reanimar como: %1\",\n",
+                u8"    \"ruRU\": \"С вероятностью %0%% возрождает как: %1\",\n",
+                u8"    \"zhCN\": \"%0%% 复活：%1\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10986,\n",
+                u8"    \"Key\": \"Moditemenrescoldsk\",\n",
+                u8"    \"enUS\": \"-%d%% to Enemy Cold Resistance\",\n",
+                u8"    \"zhTW\": \"敵人冰寒抗性 -%d%%\",\n",
+                u8"    \"deDE\": \"-%d%% zu Kältewiderstand des Gegners\",\n",
+                u8"    \"esES\": \"-%d%% de resistencia enemiga al frío\",\n",
+                u8"    \"frFR\": \"-%d%% à la résistance au Froid de l’ennemi\",\n",
+                u8"    \"itIT\": \"-%d%% resistenza al freddo nemica\",\n",
+                u8"    \"koKR\": \"적의 냉기 저항 -%d%%\",\n",
+                u8"    \"plPL\": \"-%d%% do odporności wroga na zimno\",\n",
+                u8"    \"esMX\": \"-%d%% a la resistencia al frío del enemigo\",\n",
+                u8"    \"jaJP\": \"敵の冷気耐性（-%d%%）\",\n",
+                u8"    \"ptBR\": \"-%d%% de resistência a gelo inimiga\",\n",
+                u8"    \"ruRU\": \"–%d%% к сопротивлению льду у врага\",\n",
+                u8"    \"zhCN\": \"-%d%% 敌人的冰霜抗性\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10987,\n",
+                u8"    \"Key\": \"Moditemenresfiresk\",\n",
+                u8"    \"enUS\": \"-%d%% to Enemy Fire Resistance\",\n",
+                u8"    \"zhTW\": \"敵人火焰抗性 -%d%%\",\n",
+                u8"    \"deDE\": \"-%d%% zu Feuerwiderstand des Gegners\",\n",
+                u8"    \"esES\": \"-%d%% de resistencia enemiga al fuego\",\n",
+                u8"    \"frFR\": \"-%d%% à la résistance au Feu de l’ennemi\",\n",
+                u8"    \"itIT\": \"-%d%% resistenza al fuoco nemica\",\n",
+                u8"    \"koKR\": \"적의 화염 저항 -%d%%\",\n",
+                u8"    \"plPL\": \"-%d%% do odporności wroga na ogień\",\n",
+                u8"    \"esMX\": \"-%d%% a la resistencia al fuego del enemigo\",\n",
+                u8"    \"jaJP\": \"敵の火炎耐性（-%d%%）\",\n",
+                u8"    \"ptBR\": \"-%d%% de resistência a fogo inimiga\",\n",
+                u8"    \"ruRU\": \"–%d%% к сопротивлению огню у врага\",\n",
+                u8"    \"zhCN\": \"-%d%% 敌人的火焰抗性\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10988,\n",
+                u8"    \"Key\": \"Moditemenresltngsk\",\n",
+                u8"    \"enUS\": \"-%d%% to Enemy Lightning Resistance\",\n",
+                u8"    \"zhTW\": \"敵人電擊抗性 -%d%%\",\n",
+                u8"    \"deDE\": \"-%d%% zu Blitzwiderstand des Gegners\",\n",
+                u8"    \"esES\": \"-%d%% de resistencia enemiga a los rayos\",\n",
+                u8"    \"frFR\": \"-%d%% à la résistance à la Foudre de l’ennemi\",\n",
+                u8"    \"itIT\": \"-%d%% resistenza al fulmine nemica\",\n",
+                u8"    \"koKR\": \"적의 번개 저항 -%d%%\",\n",
+                u8"    \"plPL\": \"-%d%% do odporności wroga na błyskawice\",\n",
+                u8"    \"esMX\": \"-%d%% a la resistencia al rayo del enemigo\",\n",
+                u8"    \"jaJP\": \"敵の電撃耐性（-%d%%）\",\n",
+                u8"    \"ptBR\": \"-%d%% de resistência elétrica inimiga\",\n",
+                u8"    \"ruRU\": \"–%d%% к сопротивлению молнии у врага\",\n",
+                u8"    \"zhCN\": \"-%d%% 敌人的闪电抗性\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10989,\n",
+                u8"    \"Key\": \"Moditemenrespoissk\",\n",
+                u8"    \"enUS\": \"-%d%% to Enemy Poison Resistance\",\n",
+                u8"    \"zhTW\": \"敵人毒素抗性 -%d%%\",\n",
+                u8"    \"deDE\": \"-%d%% zu Giftwiderstand des Gegners\",\n",
+                u8"    \"esES\": \"-%d%% de resistencia enemiga al veneno\",\n",
+                u8"    \"frFR\": \"-%d%% à la résistance au Poison de l’ennemi\",\n",
+                u8"    \"itIT\": \"-%d%% resistenza al veleno nemica\",\n",
+                u8"    \"koKR\": \"적의 독 저항 -%d%%\",\n",
+                u8"    \"plPL\": \"-%d%% do odporności wroga na truciznę\",\n",
+                u8"    \"esMX\": \"-%d%% a la resistencia al veneno del enemigo\",\n",
+                u8"    \"jaJP\": \"敵の毒物耐性（-%d%%）\",\n",
+                u8"    \"ptBR\": \"-%d%% de resistência a veneno inimiga\",\n",
+                u8"    \"ruRU\": \"–%d%% к сопротивлению яду у врага\",\n",
+                u8"    \"zhCN\": \"-%d%% 敌人的毒素抗性\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10990,\n",
+                u8"    \"Key\": \"ModitemdamFiresk\",\n",
+                u8"    \"enUS\": \"%+d%% to Fire Skill Damage\",\n",
+                u8"    \"zhTW\": \"%+d%% 火焰技能傷害\",\n",
+                u8"    \"deDE\": \"%+d%% zu Feuerfertigkeitsschaden\",\n",
+                u8"    \"esES\": \"%+d%% de daño con habilidades de fuego\",\n",
+                u8"    \"frFR\": \"%+d%% aux dégâts de Feu\",\n",
+                u8"    \"itIT\": \"%+d%% danni con abilità da fuoco\",\n",
+                u8"    \"koKR\": \"화염 기술 피해 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do obrażeń od umiejętności ognia\",\n",
+                u8"    \"esMX\": \"%+d%% de daño de habilidad de fuego\",\n",
+                u8"    \"jaJP\": \"火炎スキルダメージ（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de dano de habilidade ígnea\",\n",
+                u8"    \"ruRU\": \"%+d%% к урону от умений огня\",\n",
+                u8"    \"zhCN\": \"%+d%% 火焰技能伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10991,\n",
+                u8"    \"Key\": \"ModitemdamColdsk\",\n",
+                u8"    \"enUS\": \"%+d%% to Cold Skill Damage\",\n",
+                u8"    \"zhTW\": \"%+d%% 冰寒技能傷害\",\n",
+                u8"    \"deDE\": \"%+d%% zu Kältefertigkeitsschaden\",\n",
+                u8"    \"esES\": \"%+d%% de daño con habilidades de frío\",\n",
+                u8"    \"frFR\": \"%+d%% aux dégâts de Froid\",\n",
+                u8"    \"itIT\": \"%+d%% danni con abilità da freddo\",\n",
+                u8"    \"koKR\": \"냉기 기술 피해 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do obrażeń od umiejętności zimna\",\n",
+                u8"    \"esMX\": \"%+d%% de daño de habilidad de frío\",\n",
+                u8"    \"jaJP\": \"冷気スキルダメージ（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de dano de habilidade gélida\",\n",
+                u8"    \"ruRU\": \"%+d%% к урону от умений льда\",\n",
+                u8"    \"zhCN\": \"%+d%% 冰霜技能伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10992,\n",
+                u8"    \"Key\": \"ModitemdamLtngsk\",\n",
+                u8"    \"enUS\": \"%+d%% to Lightning Skill Damage\",\n",
+                u8"    \"zhTW\": \"%+d%% 閃電技能傷害\",\n",
+                u8"    \"deDE\": \"%+d%% zu Blitzfertigkeitsschaden\",\n",
+                u8"    \"esES\": \"%+d%% de daño con habilidades de rayos\",\n",
+                u8"    \"frFR\": \"%+d%% aux dégâts de Foudre\",\n",
+                u8"    \"itIT\": \"%+d%% danni con abilità da fulmine\",\n",
+                u8"    \"koKR\": \"번개 기술 피해 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do obrażeń od umiejętności błyskawic\",\n",
+                u8"    \"esMX\": \"%+d%% de daño de habilidad de rayo\",\n",
+                u8"    \"jaJP\": \"電撃スキルダメージ（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de dano de habilidade elétrica\",\n",
+                u8"    \"ruRU\": \"%+d%% к урону от умений молнии\",\n",
+                u8"    \"zhCN\": \"%+d%% 闪电技能伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10993,\n",
+                u8"    \"Key\": \"ModitemdamPoissk\",\n",
+                u8"    \"enUS\": \"%+d%% to Poison Skill Damage\",\n",
+                u8"    \"zhTW\": \"%+d%% 毒素技能傷害\",\n",
+                u8"    \"deDE\": \"%+d%% zu Giftfertigkeitschaden\",\n",
+                u8"    \"esES\": \"%+d%% de daño con habilidades de veneno\",\n",
+                u8"    \"frFR\": \"%+d%% aux dégâts de Poison\",\n",
+                u8"    \"itIT\": \"%+d%% danni con abilità da veleno\",\n",
+                u8"    \"koKR\": \"독 기술 피해 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do obrażeń od umiejętności trucizn\",\n",
+                u8"    \"esMX\": \"%+d%% de daño de habilidad de veneno\",\n",
+                u8"    \"jaJP\": \"毒スキルダメージ（%+d%%）\",\n",
+                u8"    \"ptBR\": \"%+d%% de dano de habilidade venenosa\",\n",
+                u8"    \"ruRU\": \"%+d%% к урону от умений яда\",\n",
+                u8"    \"zhCN\": \"%+d%% 毒素技能伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10994,\n",
+                u8"    \"Key\": \"Moditemskondeath\",\n",
+                u8"    \"enUS\": \"%d%% Chance to cast level %d %s when you Die\",\n",
+                u8"    \"zhTW\": \"當你死亡時有 %d%% 機率施展等級 %d %s\",\n",
+                u8"    \"deDE\": \"%d%% Chance, beim Tod Stufe %d %s auszulösen\",\n",
+                u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al morir\",\n",
+                u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 quand vous mourez\",\n",
+                u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando muori\",\n",
+                u8"    \"koKR\": \"사망 시 %d%% 확률로 %d 레벨 %s 시전\",\n",
+                u8"    \"plPL\": \"%d%% szansy na rzucenie %d-poziomowego zaklęcia %s kiedy giniesz\",\n",
+                u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 cuando mueres\",\n",
+                u8"    \"jaJP\": \"死亡時に%0%%の確率で〈%2〉（レベル%1）を発動\",\n",
+                u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 quando você morre\",\n",
+                u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня после смерти\",\n",
+                u8"    \"zhCN\": \"%d%% 几率在死亡时施放%d级%s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10995,\n",
+                u8"    \"Key\": \"ModitemskonLevel\",\n",
+                u8"    \"enUS\": \"%d%% Chance to cast level %d %s when you Level-Up\",\n",
+                u8"    \"zhTW\": \"當你升級時有 %d%% 機率施展等級 %d %s\",\n",
+                u8"    \"deDE\": \"%d%% Chance, beim Aufsteigen Stufe %d %s auszulösen\",\n",
+                u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al subir de nivel\",\n",
+                u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 quand vous montez de niveau\",\n",
+                u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando sali di livello\",\n",
+                u8"    \"koKR\": \"레벨 상승 시 %d%% 확률로 %d 레벨 %s 시전\",\n",
+                u8"    \"plPL\": \"%d%% szansy na rzucenie %d-poziomowego zaklęcia %s kiedy awansujesz\",\n",
+                u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al subir de nivel\",\n",
+                u8"    \"jaJP\": \"レベルアップ時に%0%%の確率で〈%2〉（レベル%1）を発動\",\n",
+                u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 quando você sobe de nível\",\n",
+                u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при достижении нового уровня\",\n",
+                u8"    \"zhCN\": \"%d%% 几率在升级时施放%d级%s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10996,\n",
+                u8"    \"Key\": \"ModitemskonKill\",\n",
+                u8"    \"enUS\": \"%d%% Chance to cast level %d %s when you Kill an Enemy\",\n",
+                u8"    \"zhTW\": \"當你殺敵時有 %d%% 機率施展等級 %d %s\",\n",
+                u8"    \"deDE\": \"%d%% Chance, beim Töten eines Gegners Stufe  %d %s auszulösen\",\n",
+                u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al matar a un enemigo\",\n",
+                u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 quand vous tuez un ennemi\",\n",
+                u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando uccidi un nemico\",\n",
+                u8"    \"koKR\": \"적 처치 시 %d%% 확률로 %d 레벨 %s 시전\",\n",
+                u8"    \"plPL\": \"%d%% szansy na rzucenie %d-poziomowego zaklęcia %s kiedy zabijasz wroga\",\n",
+                u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al matar un enemigo\",\n",
+                u8"    \"jaJP\": \"敵を倒すと%0%%の確率で〈%2〉（レベル%1）を発動\",\n",
+                u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 quando você abate um inimigo\",\n",
+                u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при убийстве\",\n",
+                u8"    \"zhCN\": \"%d%% 几率在消灭一名敌人时施放%d级%s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11003,\n",
+                u8"    \"Key\": \"StrSklTabItem9\",\n",
+                u8"    \"enUS\": \"+%d to Summoning Skills\",\n",
+                u8"    \"zhTW\": \"+%d 召喚技能\",\n",
+                u8"    \"deDE\": \"+%d zu Herbeirufungfertigkeiten\",\n",
+                u8"    \"esES\": \"+%d a las habilidades de invocación\",\n",
+                u8"    \"frFR\": \"+%d en invocation\",\n",
+                u8"    \"itIT\": \"+%d alle Magie di evocazione\",\n",
+                u8"    \"koKR\": \"소환 기술 +%d\",\n",
+                u8"    \"plPL\": \"+%d do umiejętności Przywoływania\",\n",
+                u8"    \"esMX\": \"+%d a las habilidades de Invocación\",\n",
+                u8"    \"jaJP\": \"〈召喚〉スキル向上（+%d）\",\n",
+                u8"    \"ptBR\": \"+%d para habilidades Evocação\",\n",
+                u8"    \"ruRU\": \"+%d к умениям призыва\",\n",
+                u8"    \"zhCN\": \"+%d 召唤术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11018,\n",
+                u8"    \"Key\": \"ItemStats1r\",\n",
+                u8"    \"enUS\": \"Chance to Block: %d%%\",\n",
+                u8"    \"zhTW\": \"格擋機率：%d%%\",\n",
+                u8"    \"deDE\": \"Blockchance: %d%%\",\n",
+                u8"    \"esES\": \"Probabilidad de bloqueo: %d%%\",\n",
+                u8"    \"frFR\": \"Chances de bloquer : %d%%\",\n",
+                u8"    \"itIT\": \"Probabilità di parata: %d%%\",\n",
+                u8"    \"koKR\": \"막기 확률: %d%%\",\n",
+                u8"    \"plPL\": \"Szansa na blok: %d%%\",\n",
+                u8"    \"esMX\": \"Probabilidad de bloqueo: %d%%\",\n",
+                u8"    \"jaJP\": \"ブロック確率: %d%%\",\n",
+                u8"    \"ptBR\": \"Chance de bloqueio: %d%%\",\n",
+                u8"    \"ruRU\": \"Вероятность блока: %d%%\",\n",
+                u8"    \"zhCN\": \"格挡几率: %d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11032,\n",
+                u8"    \"Key\": \"ModStr1w\",\n",
+                u8"    \"enUS\": \"%d%% Extra Gold from Monsters\",\n",
+                u8"    \"zhTW\": \"怪物金幣掉落量提高 %d%%\",\n",
+                u8"    \"deDE\": \"%d%% Extragold von Monstern\",\n",
+                u8"    \"esES\": \"%d%% de oro extra de los monstruos\",\n",
+                u8"    \"frFR\": \"%d%% d’or suppl. sur les monstres\",\n",
+                u8"    \"itIT\": \"%d%% oro extra dai mostri\",\n",
+                u8"    \"koKR\": \"괴물에게서 얻는 금화 %d%% 증가\",\n",
+                u8"    \"plPL\": \"+%d%% dodatkowego złota od potworów\",\n",
+                u8"    \"esMX\": \"%d%% de oro adicional de monstruos\",\n",
+                u8"    \"jaJP\": \"モンスターからの獲得ゴールド（+%d%%）\",\n",
+                u8"    \"ptBR\": \"%d%% de ouro adicional de monstros\",\n",
+                u8"    \"ruRU\": \"+%d%% к золоту за убийство монстров\",\n",
+                u8"    \"zhCN\": \"%d%% 怪物额外掉落金币\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11033,\n",
+                u8"    \"Key\": \"ModStr1x\",\n",
+                u8"    \"enUS\": \"%d%% Better Chance of Getting Magic Items\",\n",
+                u8"    \"zhTW\": \"尋獲魔法物品機率提高 %d%%\",\n",
+                u8"    \"deDE\": \"%d%% bessere Chance, magischen Gegenstand zu erhalten\",\n",
+                u8"    \"esES\": \"+%d%% de probabilidad de encontrar objetos mágicos\",\n",
+                u8"    \"frFR\": \"%d%% de chances suppl. d’obtenir des objets magiques\",\n",
+                u8"    \"itIT\": \"Probabilità di ottenere un oggetto magico aumentata del %d%%\",\n",
+                u8"    \"koKR\": \"마법 아이템 발견 확률 %d%% 증가\",\n",
+                u8"    \"plPL\": \"+%d%% do szansy na zdobycie magicznych przedmiotów\",\n",
+                u8"    \"esMX\": \"%d%% más de probabilidad de obtener objetos mágicos\",\n",
+                u8"    \"jaJP\": \"マジックアイテムドロップ率（+%d%%）\",\n",
+                u8"    \"ptBR\": \"%d%% de chance adicional de obter itens mágicos\",\n",
+                u8"    \"ruRU\": \"+%d%% к вероятности найти магический предмет\",\n",
+                u8"    \"zhCN\": \"%d%% 额外几率获得魔法物品\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11034,\n",
+                u8"    \"Key\": \"ModStr3u\",\n",
+                u8"    \"enUS\": \"Hit Causes Monster to Flee %+d%%\",\n",
+                u8"    \"zhTW\": \"%+d%% 機率擊中使怪物逃跑\",\n",
+                u8"    \"deDE\": \"Treffer schlägt Monster in die Flucht %+d%%\",\n",
+                u8"    \"esES\": \"%+d%% de probabilidad de que los monstruos huyan al golpearlos\",\n",
+                u8"    \"frFR\": \"Le monstre touché s’enfuit à %+d%%\",\n",
+                u8"    \"itIT\": \"Probabilità di far fuggire il bersaglio %+d%%\",\n",
+                u8"    \"koKR\": \"적중 시 괴물 도주 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% szansy na zmuszenie potwora do ucieczki\",\n",
+                u8"    \"esMX\": \"%+d%% de que monstruo huya al ser golpeado\",\n",
+                u8"    \"jaJP\": \"攻撃命中でモンスターが逃げ出す（%+d%%）\",\n",
+                u8"    \"ptBR\": \"Acerto causa fuga do monstro %+d%%\",\n",
+                u8"    \"ruRU\": \"%+d%% к вероятности обратить монстра в бегство при ударе\",\n",
+                u8"    \"zhCN\": \"%+d%% 几率命中使怪物逃跑\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11035,\n",
+                u8"    \"Key\": \"ModStr4c\",\n",
+                u8"    \"enUS\": \"%d%% Bonus to Attack Rating\",\n",
+                u8"    \"zhTW\": \"%d%% 準確率加成\",\n",
+                u8"    \"deDE\": \"%d%% Bonus zu Angriffswert\",\n",
+                u8"    \"esES\": \"%d%% de bonus al índice de ataque\",\n",
+                u8"    \"frFR\": \"%d%% de bonus au score d’attaque\",\n",
+                u8"    \"itIT\": \"Indice d'attacco aumentato del %d%%\",\n",
+                u8"    \"koKR\": \"명중률 보너스 %d%%\",\n",
+                u8"    \"plPL\": \"%d%% premii do skuteczności ataku\",\n",
+                u8"    \"esMX\": \"%d%% de bonificación al índice de ataque\",\n",
+                u8"    \"jaJP\": \"命中率へのボーナス（%d%%）\",\n",
+                u8"    \"ptBR\": \"%d%% de bônus de taxa de ataque\",\n",
+                u8"    \"ruRU\": \"+%d%% к рейтингу атаки\",\n",
+                u8"    \"zhCN\": \"%d%% 加成命中值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11036,\n",
+                u8"    \"Key\": \"ModStr5r\",\n",
+                u8"    \"enUS\": \"Slows Target by %d%%\",\n",
+                u8"    \"zhTW\": \"使目標減慢 %d%%\",\n",
+                u8"    \"deDE\": \"Verlangsamt Ziel um %d%%\",\n",
+                u8"    \"esES\": \"Ralentiza al objetivo un %d%%\",\n",
+                u8"    \"frFR\": \"Ralentit l’adversaire de %d%%\",\n",
+                u8"    \"itIT\": \"Rallenta il bersaglio del %d%%\",\n",
+                u8"    \"koKR\": \"대상 감속 %d%%\",\n",
+                u8"    \"plPL\": \"Spowalnia cel o %d%%\",\n",
+                u8"    \"esMX\": \"Ralentiza al objetivo un %d%%\",\n",
+                u8"    \"jaJP\": \"敵の速度低下（-%d%%）\",\n",
+                u8"    \"ptBR\": \"Desacelera o alvo em %d%%\",\n",
+                u8"    \"ruRU\": \"Замедляет цель на %d%%\",\n",
+                u8"    \"zhCN\": \"使目标减速 %d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11037,\n",
+                u8"    \"Key\": \"ModStr6f\",\n",
+                u8"    \"enUS\": \"Chance to Reanimate Target\",\n",
+                u8"    \"zhTW\": \"機率使目標復活\",\n",
+                u8"    \"deDE\": \"Chance, das Ziel wiederzubeleben\",\n",
+                u8"    \"esES\": \"Probabilidad de reanimar al objetivo\",\n",
+                u8"    \"frFR\": \"Chances de réanimer la cible\",\n",
+                u8"    \"itIT\": \"Può rianimare il bersaglio\",\n",
+                u8"    \"koKR\": \"일정 확률로 대상 소생\",\n",
+                u8"    \"plPL\": \"Szansa na ożywienie celu\",\n",
+                u8"    \"esMX\": \"Probabilidad de reanimar al objetivo\",\n",
+                u8"    \"jaJP\": \"の確率で対象を復活\",\n",
+                u8"    \"ptBR\": \"Chance de reanimar o alvo\",\n",
+                u8"    \"ruRU\": \"Может оживить цель\",\n",
+                u8"    \"zhCN\": \"有机会使目标复活\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11038,\n",
+                u8"    \"Key\": \"ModStr6d\",\n",
+                u8"    \"enUS\": \"Hit Blinds Target\",\n",
+                u8"    \"zhTW\": \"擊中使目標目盲\",\n",
+                u8"    \"deDE\": \"Treffer blendet Ziel\",\n",
+                u8"    \"esES\": \"Los golpes ciegan al objetivo\",\n",
+                u8"    \"frFR\": \"Toucher la cible l’aveugle\",\n",
+                u8"    \"itIT\": \"Acceca il bersaglio\",\n",
+                u8"    \"koKR\": \"적중 시 대상 실명\",\n",
+                u8"    \"plPL\": \"Trafienie oślepia cel\",\n",
+                u8"    \"esMX\": \"Golpear al objetivo lo ciega\",\n",
+                u8"    \"jaJP\": \"攻撃命中でターゲットを目つぶし\",\n",
+                u8"    \"ptBR\": \"Acerto cega o alvo\",\n",
+                u8"    \"ruRU\": \"При ударе ослепляет цель\",\n",
+                u8"    \"zhCN\": \"命中可致盲目标\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11080,\n",
+                u8"    \"Key\": \"ExInsertSocketsX\",\n",
+                u8"    \"enUS\": \"Can be Inserted into Socketed Items\",\n",
+                u8"    \"zhTW\": \"可以放入有鑲孔的物品\",\n",
+                u8"    \"deDE\": \"Anbringung möglich an gesockelten Gegenständen.\",\n",
+                u8"    \"esES\": \"Se puede insertar en objetos con huecos\",\n",
+                u8"    \"frFR\": \"Peut être enchâssé(e) dans les objets avec châsse\",\n",
+                u8"    \"itIT\": \"Si può inserire negli oggetti con castone\",\n",
+                u8"    \"koKR\": \"홈이 있는 아이템에 삽입 가능\",\n",
+                u8"    \"plPL\": \"Można umieścić w przedmiotach z gniazdami\",\n",
+                u8"    \"esMX\": \"Puede insertarse en objetos engarzados\",\n",
+                u8"    \"jaJP\": \"ソケット付きのアイテムに装着可能\",\n",
+                u8"    \"ptBR\": \"Pode ser inserido em itens com engastes\",\n",
+                u8"    \"ruRU\": \"Можно вставить в гнездо\",\n",
+                u8"    \"zhCN\": \"可以被插入有镶孔的物品中\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11091,\n",
+                u8"    \"Key\": \"increaseswithplaylevelX\",\n",
+                u8"    \"enUS\": \"(Based on Character Level)\",\n",
+                u8"    \"zhTW\": \"（依角色等級而定）\",\n",
+                u8"    \"deDE\": \"(Basierend auf Charakterstufe)\",\n",
+                u8"    \"esES\": \"(según el nivel del personaje)\",\n",
+                u8"    \"frFR\": \"(Selon niv. du perso.)\",\n",
+                u8"    \"itIT\": \"(Si basa sul livello del personaggio)\",\n",
+                u8"    \"koKR\": \"(캐릭터 레벨에 비례)\",\n",
+                u8"    \"plPL\": \"(zależy od poziomu postaci)\",\n",
+                u8"    \"esMX\": \"(Según el nivel del personaje)\",\n",
+                u8"    \"jaJP\": \"（キャラクターレベルに依存）\",\n",
+                u8"    \"ptBR\": \"(Com base no nível de personagem)\",\n",
+                u8"    \"ruRU\": \"(зависит от уровня персонажа)\",\n",
+                u8"    \"zhCN\": \"(基于角色等级)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11158,\n",
+                u8"    \"Key\": \"ModStre8b\",\n",
+                u8"    \"enUS\": \"%+d to Assassin Skill Levels\",\n",
+                u8"    \"zhTW\": \"%+d 刺客技能等級\",\n",
+                u8"    \"deDE\": \"%+d zu Assassinenfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los niveles de habilidad de la asesina\",\n",
+                u8"    \"frFR\": \"%+d aux niv. de compétence d’Assassin\",\n",
+                u8"    \"itIT\": \"%+d alle abilità dell'Assassina\",\n",
+                u8"    \"koKR\": \"암살자 기술 레벨 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności zabójczyni\",\n",
+                u8"    \"esMX\": \"%+d a los niveles de habilidad de la Asesina\",\n",
+                u8"    \"jaJP\": \"〈アサシン〉スキルレベル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de níveis de habilidade de Assassina\",\n",
+                u8"    \"ruRU\": \"%+d к уровню умений ассасина\",\n",
+                u8"    \"zhCN\": \"%+d 刺客技能等级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11163,\n",
+                u8"    \"Key\": \"toa\",\n",
+                u8"    \"enUS\": \"Token of Absolution\",\n",
+                u8"    \"zhTW\": \"赦免徽章\",\n",
+                u8"    \"deDE\": \"Zeichen der Absolution\",\n",
+                u8"    \"esES\": \"Muestra de absolución\",\n",
+                u8"    \"frFR\": \"Gage d’absolution\",\n",
+                u8"    \"itIT\": \"Gettone dell'Assoluzione\",\n",
+                u8"    \"koKR\": \"면죄의 징표\",\n",
+                u8"    \"plPL\": \"Znak Rozgrzeszenia\",\n",
+                u8"    \"esMX\": \"Insignia de la absolución\",\n",
+                u8"    \"jaJP\": \"赦しのトークン\",\n",
+                u8"    \"ptBR\": \"Insígnia da Absolvição\",\n",
+                u8"    \"ruRU\": \"Талисман очищения\",\n",
+                u8"    \"zhCN\": \"赦免之证\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20438,\n",
+                u8"    \"Key\": \"Charmdes\",\n",
+                u8"    \"enUS\": \"Keep in Inventory to Gain Bonus\",\n",
+                u8"    \"zhTW\": \"放在物品欄以獲得其加成效果\",\n",
+                u8"    \"deDE\": \"Im Inventar behalten, um Bonus zu erhalten.\",\n",
+                u8"    \"esES\": \"Guárdalo en el inventario para obtener un bonus\",\n",
+                u8"    \"frFR\": \"À garder dans l’inventaire pour bénéficier du bonus\",\n",
+                u8"    \"itIT\": \"Tieni nell'inventario per ottenere un bonus\",\n",
+                u8"    \"koKR\": \"소지품에 보관 시 보너스 획득\",\n",
+                u8"    \"plPL\": \"Aby aktywować właściwości, trzymaj przedmiot w ekwipunku\",\n",
+                u8"    \"esMX\": \"Conservar en el Inventario para obtener la bonificación\",\n",
+                u8"    \"jaJP\": \"所持品に入れることでボーナスが得られる\",\n",
+                u8"    \"ptBR\": \"Manter no Inventário para ganhar bônus\",\n",
+                u8"    \"ruRU\": \"Дает бонус при хранении в инвентаре\",\n",
+                u8"    \"zhCN\": \"放在物品栏里以享受加成\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20439,\n",
+                u8"    \"Key\": \"ice\",\n",
+                u8"    \"enUS\": \"Malah's Potion\",\n",
+                u8"    \"zhTW\": \"瑪拉的藥水\",\n",
+                u8"    \"deDE\": \"Malahs Elixier\",\n",
+                u8"    \"esES\": \"Poción de Malah\",\n",
+                u8"    \"frFR\": \"Potion de Malah\",\n",
+                u8"    \"itIT\": \"Pozione di Malah\",\n",
+                u8"    \"koKR\": \"말라의 물약\",\n",
+                u8"    \"plPL\": \"Mikstura Malah\",\n",
+                u8"    \"esMX\": \"Poción de Malah\",\n",
+                u8"    \"jaJP\": \"マラーのポーション\",\n",
+                u8"    \"ptBR\": \"Poção de Malah\",\n",
+                u8"    \"ruRU\": \"Зелье Маллы\",\n",
+                u8"    \"zhCN\": \"马拉的药水\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21205,\n",
+                u8"    \"Key\": \"ModStre8a\",\n",
+                u8"    \"enUS\": \"%+d to Druid Skill Levels\",\n",
+                u8"    \"zhTW\": \"%+d 德魯伊技能等級\",\n",
+                u8"    \"deDE\": \"%+d zu Druidenfertigkeiten\",\n",
+                u8"    \"esES\": \"%+d a los niveles de habilidad del druida\",\n",
+                u8"    \"frFR\": \"%+d aux niv. de comp. du druide\",\n",
+                u8"    \"itIT\": \"%+d alle abilità del Druido\",\n",
+                u8"    \"koKR\": \"드루이드 기술 레벨 %+d\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności druida\",\n",
+                u8"    \"esMX\": \"%+d a los niveles de habilidad del Druida\",\n",
+                u8"    \"jaJP\": \"〈ドルイド〉スキルレベル向上（%+d）\",\n",
+                u8"    \"ptBR\": \"%+d de níveis de habilidade de Druida\",\n",
+                u8"    \"ruRU\": \"%+d к уровню умений друида\",\n",
+                u8"    \"zhCN\": \"%+d 德鲁伊技能等级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21207,\n",
+                u8"    \"Key\": \"ModStre8c\",\n",
+                u8"    \"enUS\": \" Sockets\",\n",
+                u8"    \"zhTW\": \"鑲孔\",\n",
+                u8"    \"deDE\": \" Sockelfassungen\",\n",
+                u8"    \"esES\": \"Huecos\",\n",
+                u8"    \"frFR\": \"Châsses\",\n",
+                u8"    \"itIT\": \" Castoni\",\n",
+                u8"    \"koKR\": \" 홈\",\n",
+                u8"    \"plPL\": \" Gniazda\",\n",
+                u8"    \"esMX\": \" Engarces\",\n",
+                u8"    \"jaJP\": \" ソケット\",\n",
+                u8"    \"ptBR\": \" engastes\",\n",
+                u8"    \"ruRU\": \" Гнезда\",\n",
+                u8"    \"zhCN\": \"镶孔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21208,\n",
+                u8"    \"Key\": \"ModStre8d\",\n",
+                u8"    \"enUS\": \" to Attack Rating vs. Demons\",\n",
+                u8"    \"zhTW\": \"對惡魔的準確率\",\n",
+                u8"    \"deDE\": \" zu Angriffswert gegen Dämonen\",\n",
+                u8"    \"esES\": \"de índice de ataque contra demonios\",\n",
+                u8"    \"frFR\": \" en attaque contre les démons\",\n",
+                u8"    \"itIT\": \" indice d'attacco contro i demoni\",\n",
+                u8"    \"koKR\": \" 악마에 대한 명중률\",\n",
+                u8"    \"plPL\": \" do skuteczności ataku względem demonów\",\n",
+                u8"    \"esMX\": \" de índice de ataque contra demonios\",\n",
+                u8"    \"jaJP\": \" デーモンへの命中率 +\",\n",
+                u8"    \"ptBR\": \" de taxa de ataque contra demônios\",\n",
+                u8"    \"ruRU\": \" к рейтингу атаки против демонов\",\n",
+                u8"    \"zhCN\": \"对恶魔的命中值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21209,\n",
+                u8"    \"Key\": \"ModStre8e\",\n",
+                u8"    \"enUS\": \" to Attack Rating vs. Undead\",\n",
+                u8"    \"zhTW\": \"對不死怪物的準確率\",\n",
+                u8"    \"deDE\": \" zu Angriffswert gegen Untote\",\n",
+                u8"    \"esES\": \"de índice de ataque contra muertos vivientes\",\n",
+                u8"    \"frFR\": \" en attaque contre les Morts-vivants\",\n",
+                u8"    \"itIT\": \" indice d'attacco contro i non morti\",\n",
+                u8"    \"koKR\": \" 언데드에 대한 명중률\",\n",
+                u8"    \"plPL\": \" do skuteczności ataku względem nieumarłych\",\n",
+                u8"    \"esMX\": \" de índice de ataque contra no muertos\",\n",
+                u8"    \"jaJP\": \" アンデッドへの命中率 +\",\n",
+                u8"    \"ptBR\": \" de taxa de ataque contra mortos-vivos\",\n",
+                u8"    \"ruRU\": \" к рейтингу атаки против нежити\",\n",
+                u8"    \"zhCN\": \"对亡灵的命中值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21210,\n",
+                u8"    \"Key\": \"ModStre8f\",\n",
+                u8"    \"enUS\": \" to Damage vs. Demons\",\n",
+                u8"    \"zhTW\": \"對惡魔的傷害\",\n",
+                u8"    \"deDE\": \" zu Schaden gegen Dämonen\",\n",
+                u8"    \"esES\": \"de daño contra demonios\",\n",
+                u8"    \"frFR\": \" de dégâts sur les démons\",\n",
+                u8"    \"itIT\": \" danni contro i demoni\",\n",
+                u8"    \"koKR\": \" 악마에게 주는 피해\",\n",
+                u8"    \"plPL\": \" do obrażeń zadanych demonom\",\n",
+                u8"    \"esMX\": \" de daño contra demonios\",\n",
+                u8"    \"jaJP\": \" デーモンへのダメージ +\",\n",
+                u8"    \"ptBR\": \" de dano contra demônios\",\n",
+                u8"    \"ruRU\": \" к урону против демонов\",\n",
+                u8"    \"zhCN\": \"对恶魔的伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21211,\n",
+                u8"    \"Key\": \"ModStre8g\",\n",
+                u8"    \"enUS\": \" percent to Attack Rating\",\n",
+                u8"    \"zhTW\": \"% 準確率\",\n",
+                u8"    \"deDE\": \"% zu Angriffswert\",\n",
+                u8"    \"esES\": \"% de índice de ataque\",\n",
+                u8"    \"frFR\": \" au pourcentage d’attaque\",\n",
+                u8"    \"itIT\": \" % indice d'attacco\",\n",
+                u8"    \"koKR\": \"% 명중률 상승\",\n",
+                u8"    \"plPL\": \" procent do skuteczności ataku\",\n",
+                u8"    \"esMX\": \" % de índice de ataque\",\n",
+                u8"    \"jaJP\": \" %%の命中率上昇\",\n",
+                u8"    \"ptBR\": \"% de taxa de ataque\",\n",
+                u8"    \"ruRU\": \" % к рейтингу атаки\",\n",
+                u8"    \"zhCN\": \"%到命中值\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21212,\n",
+                u8"    \"Key\": \"ModStre8h\",\n",
+                u8"    \"enUS\": \" to Javelin and Spear Skills\",\n",
+                u8"    \"zhTW\": \"標槍與長矛技能\",\n",
+                u8"    \"deDE\": \" zu Wurfspieß- und Speerfertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades de jabalina y lanza\",\n",
+                u8"    \"frFR\": \" aux comp. de javelot et lance\",\n",
+                u8"    \"itIT\": \" alle abilità con Lance e giavellotti\",\n",
+                u8"    \"koKR\": \" 투창과 창 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Oszczepu i Włóczni\",\n",
+                u8"    \"esMX\": \" a las habilidades de Jabalina y lanza\",\n",
+                u8"    \"jaJP\": \" 〈ジャベリン/スピア〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Dardos e Lanças\",\n",
+                u8"    \"ruRU\": \" к уровню умений «Дротики и копья»\",\n",
+                u8"    \"zhCN\": \"至标枪和长矛技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21213,\n",
+                u8"    \"Key\": \"ModStre8i\",\n",
+                u8"    \"enUS\": \" to Passive and Magic Skills\",\n",
+                u8"    \"zhTW\": \"被動與魔法技能\",\n",
+                u8"    \"deDE\": \" zu passiven und magischen Fertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades pasivas y mágicas\",\n",
+                u8"    \"frFR\": \" aux comp. passives et magiques\",\n",
+                u8"    \"itIT\": \" alle Passive e magie\",\n",
+                u8"    \"koKR\": \" 지속 효과와 마법 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Pasywnych i Magii\",\n",
+                u8"    \"esMX\": \" a las habilidades de Pasivas y magia\",\n",
+                u8"    \"jaJP\": \" 〈常時発動/魔法〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Passivas e Magia\",\n",
+                u8"    \"ruRU\": \" к пассивным и магическим умениям\",\n",
+                u8"    \"zhCN\": \"至被动和魔法技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21214,\n",
+                u8"    \"Key\": \"ModStre8j\",\n",
+                u8"    \"enUS\": \" to Bow and Crossbow Skills\",\n",
+                u8"    \"zhTW\": \"弓與弩技能\",\n",
+                u8"    \"deDE\": \" zu Bogen- und Armbrustfertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades de arco y ballesta\",\n",
+                u8"    \"frFR\": \" aux comp. d’arc et d’arbalète\",\n",
+                u8"    \"itIT\": \" alle abilità con Archi e balestre\",\n",
+                u8"    \"koKR\": \" 활과 쇠뇌 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Łuku i Kuszy\",\n",
+                u8"    \"esMX\": \" a las habilidades de Arco y ballesta\",\n",
+                u8"    \"jaJP\": \" 〈弓/クロスボウ〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Arcos e Bestas\",\n",
+                u8"    \"ruRU\": \" к умениям «Луки и арбалеты»\",\n",
+                u8"    \"zhCN\": \"至弓和弩技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21215,\n",
+                u8"    \"Key\": \"ModStre8k\",\n",
+                u8"    \"enUS\": \" to Defensive Aura Skills\",\n",
+                u8"    \"zhTW\": \"防禦靈氣技能\",\n",
+                u8"    \"deDE\": \" zu Defensivauren\",\n",
+                u8"    \"esES\": \"a las auras defensivas\",\n",
+                u8"    \"frFR\": \" aux comp. d’auras défensives\",\n",
+                u8"    \"itIT\": \" alle Aure difensive\",\n",
+                u8"    \"koKR\": \" 방어 오라 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Aur Defensywnych\",\n",
+                u8"    \"esMX\": \" a las habilidades de Auras defensivas\",\n",
+                u8"    \"jaJP\": \" 〈防御オーラ〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Auras Defensivas\",\n",
+                u8"    \"ruRU\": \" к уровню защитных аур\",\n",
+                u8"    \"zhCN\": \"至防御光环技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21216,\n",
+                u8"    \"Key\": \"ModStre8l\",\n",
+                u8"    \"enUS\": \" to Offensive Aura Skills\",\n",
+                u8"    \"zhTW\": \"攻擊靈氣技能\",\n",
+                u8"    \"deDE\": \" zu Offensivauren\",\n",
+                u8"    \"esES\": \"a las auras ofensivas\",\n",
+                u8"    \"frFR\": \" aux comp. d’auras offensives\",\n",
+                u8"    \"itIT\": \" alle Aure offensive\",\n",
+                u8"    \"koKR\": \" 공격 오라 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Aur Ofensywnych\",\n",
+                u8"    \"esMX\": \" a las habilidades de Auras ofensivas\",\n",
+                u8"    \"jaJP\": \" 〈攻撃オーラ〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Auras Ofensivas\",\n",
+                u8"    \"ruRU\": \" к боевым аурам\",\n",
+                u8"    \"zhCN\": \"至攻击光环技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21217,\n",
+                u8"    \"Key\": \"ModStre8m\",\n",
+                u8"    \"enUS\": \" to Combat Skills\",\n",
+                u8"    \"zhTW\": \"戰鬥技能\",\n",
+                u8"    \"deDE\": \" zu Kampffertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades de combate\",\n",
+                u8"    \"frFR\": \" aux compétences de combat\",\n",
+                u8"    \"itIT\": \" alle Abilità nel combattere\",\n",
+                u8"    \"koKR\": \" 전투 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Walki\",\n",
+                u8"    \"esMX\": \" a las habilidades de Combate\",\n",
+                u8"    \"jaJP\": \" 〈戦闘〉スキル +\",\n",
+                u8"    \"ptBR\": \" para Habilidades de Combate\",\n",
+                u8"    \"ruRU\": \" к боевым умениям\",\n",
+                u8"    \"zhCN\": \"至战斗技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21218,\n",
+                u8"    \"Key\": \"ModStre8n\",\n",
+                u8"    \"enUS\": \" to Summoning Skills\",\n",
+                u8"    \"zhTW\": \"召喚技能\",\n",
+                u8"    \"deDE\": \" zu Herbeirufungsfertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades de invocación\",\n",
+                u8"    \"frFR\": \" aux compétences d’invocation\",\n",
+                u8"    \"itIT\": \" alle Magie di evocazione\",\n",
+                u8"    \"koKR\": \" 소환 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Przywoływania\",\n",
+                u8"    \"esMX\": \" a las habilidades de Invocación\",\n",
+                u8"    \"jaJP\": \" 〈召喚〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Evocação\",\n",
+                u8"    \"ruRU\": \" к уровню умений «Прислужники»\",\n",
+                u8"    \"zhCN\": \"至召唤术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21219,\n",
+                u8"    \"Key\": \"ModStre8o\",\n",
+                u8"    \"enUS\": \" to Poison and Bone Skills\",\n",
+                u8"    \"zhTW\": \"毒素與骸骨技能\",\n",
+                u8"    \"deDE\": \" zu Gift- und Knochenfertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades de veneno y hueso\",\n",
+                u8"    \"frFR\": \" aux compétences de Poison et d’os\",\n",
+                u8"    \"itIT\": \" alle Magie di ossa e veleno\",\n",
+                u8"    \"koKR\": \" 독과 뼈 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Trucizn i Kości\",\n",
+                u8"    \"esMX\": \" a las habilidades de Veneno y huesos\",\n",
+                u8"    \"jaJP\": \" 〈ポイズン/ボーン〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Veneno e Ossos\",\n",
+                u8"    \"ruRU\": \" к уровню умений «Яды и кости»\",\n",
+                u8"    \"zhCN\": \"至毒素和白骨术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21220,\n",
+                u8"    \"Key\": \"ModStre8p\",\n",
+                u8"    \"enUS\": \" to Curses\",\n",
+                u8"    \"zhTW\": \"詛咒\",\n",
+                u8"    \"deDE\": \" zu Flüchen\",\n",
+                u8"    \"esES\": \"a las maldiciones\",\n",
+                u8"    \"frFR\": \" aux malédictions\",\n",
+                u8"    \"itIT\": \" alle Maledizioni\",\n",
+                u8"    \"koKR\": \" 저주 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Klątw\",\n",
+                u8"    \"esMX\": \" a las Maldiciones\",\n",
+                u8"    \"jaJP\": \" 〈呪い〉スキル +\",\n",
+                u8"    \"ptBR\": \" para Maldições\",\n",
+                u8"    \"ruRU\": \" к уровню проклятий\",\n",
+                u8"    \"zhCN\": \"至诅咒术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21221,\n",
+                u8"    \"Key\": \"ModStre8q\",\n",
+                u8"    \"enUS\": \" to Warcry Skills\",\n",
+                u8"    \"zhTW\": \"戰吼技能\",\n",
+                u8"    \"deDE\": \" zu Kriegsschreien\",\n",
+                u8"    \"esES\": \"a los gritos de guerra\",\n",
+                u8"    \"frFR\": \" aux comp. de cris de guerre\",\n",
+                u8"    \"itIT\": \" alle Grida di guerra\",\n",
+                u8"    \"koKR\": \" 함성 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Okrzyków\",\n",
+                u8"    \"esMX\": \" a los Gritos de guerra\",\n",
+                u8"    \"jaJP\": \" 〈雄叫び〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Grito de Guerra\",\n",
+                u8"    \"ruRU\": \" к уровню боевых кличей\",\n",
+                u8"    \"zhCN\": \"至呐喊技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21222,\n",
+                u8"    \"Key\": \"ModStre8r\",\n",
+                u8"    \"enUS\": \" to Combat Skills\",\n",
+                u8"    \"zhTW\": \"戰鬥技能\",\n",
+                u8"    \"deDE\": \" zu Kampffertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades de combate\",\n",
+                u8"    \"frFR\": \" aux compétences de combat\",\n",
+                u8"    \"itIT\": \" alle Abilità belliche\",\n",
+                u8"    \"koKR\": \" 전투 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Zdolności Bojowych\",\n",
+                u8"    \"esMX\": \" a las habilidades de Combate\",\n",
+                u8"    \"jaJP\": \" 〈戦闘〉スキル +\",\n",
+                u8"    \"ptBR\": \" para Habilidades de Combate\",\n",
+                u8"    \"ruRU\": \" к боевым умениям\",\n",
+                u8"    \"zhCN\": \"至战斗技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21223,\n",
+                u8"    \"Key\": \"ModStre8s\",\n",
+                u8"    \"enUS\": \" to Masteries Skills\",\n",
+                u8"    \"zhTW\": \"戰鬥專精技能\",\n",
+                u8"    \"deDE\": \" zu Beherrschungsfertigkeiten\",\n",
+                u8"    \"esES\": \"a dominio del combate\",\n",
+                u8"    \"frFR\": \" aux compétences de maîtrise\",\n",
+                u8"    \"itIT\": \" ai Domini bellici\",\n",
+                u8"    \"koKR\": \" 숙련 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Mistrzostw Bojowych\",\n",
+                u8"    \"esMX\": \" a las habilidades de Dominios\",\n",
+                u8"    \"jaJP\": \" 〈武器術〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Maestrias\",\n",
+                u8"    \"ruRU\": \" к умениям владения оружием\",\n",
+                u8"    \"zhCN\": \"至精通类技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21224,\n",
+                u8"    \"Key\": \"ModStre8t\",\n",
+                u8"    \"enUS\": \" to Cold Skills\",\n",
+                u8"    \"zhTW\": \"冰寒技能\",\n",
+                u8"    \"deDE\": \" zu Kältefertigkeiten\",\n",
+                u8"    \"esES\": \"a los hechizos de frío\",\n",
+                u8"    \"frFR\": \" aux compétences de Froid\",\n",
+                u8"    \"itIT\": \" alle Magie del freddo\",\n",
+                u8"    \"koKR\": \" 냉기 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Zimna\",\n",
+                u8"    \"esMX\": \" a las habilidades de Frío\",\n",
+                u8"    \"jaJP\": \" 〈冷気〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Gelo\",\n",
+                u8"    \"ruRU\": \" к умениям льда\",\n",
+                u8"    \"zhCN\": \"至冰系法术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21225,\n",
+                u8"    \"Key\": \"ModStre8u\",\n",
+                u8"    \"enUS\": \" to Lightning Skills\",\n",
+                u8"    \"zhTW\": \"閃電技能\",\n",
+                u8"    \"deDE\": \" zu Blitzfertigkeiten\",\n",
+                u8"    \"esES\": \"a los hechizos de rayos\",\n",
+                u8"    \"frFR\": \" aux compétences de Foudre\",\n",
+                u8"    \"itIT\": \" alle Magie del fulmine\",\n",
+                u8"    \"koKR\": \" 번개 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Błyskawic\",\n",
+                u8"    \"esMX\": \" a las habilidades de Rayo\",\n",
+                u8"    \"jaJP\": \" 〈電撃〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Eletricidade\",\n",
+                u8"    \"ruRU\": \" к умениям молнии\",\n",
+                u8"    \"zhCN\": \"至雷系法术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21226,\n",
+                u8"    \"Key\": \"ModStre8v\",\n",
+                u8"    \"enUS\": \" to Fire Skills\",\n",
+                u8"    \"zhTW\": \"火焰技能\",\n",
+                u8"    \"deDE\": \" zu Feuerfertigkeiten\",\n",
+                u8"    \"esES\": \"a los hechizos de fuego\",\n",
+                u8"    \"frFR\": \" aux compétences de Feu\",\n",
+                u8"    \"itIT\": \" alle Magie del fuoco\",\n",
+                u8"    \"koKR\": \" 화염 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Ognia\",\n",
+                u8"    \"esMX\": \" a las habilidades de Fuego\",\n",
+                u8"    \"jaJP\": \" 〈火炎〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Fogo\",\n",
+                u8"    \"ruRU\": \" к умениям огня\",\n",
+                u8"    \"zhCN\": \"至火系法术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21227,\n",
+                u8"    \"Key\": \"ModStre8w\",\n",
+                u8"    \"enUS\": \" to Summoning Skills\",\n",
+                u8"    \"zhTW\": \"召喚技能\",\n",
+                u8"    \"deDE\": \" zu Herbeirufungsfertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades de invocación\",\n",
+                u8"    \"frFR\": \" aux comp. d’invocation\",\n",
+                u8"    \"itIT\": \" alle Magie di evocazione\",\n",
+                u8"    \"koKR\": \" 소환 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Przyzwania\",\n",
+                u8"    \"esMX\": \" a las habilidades de Invocación\",\n",
+                u8"    \"jaJP\": \" 〈召喚〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Invocação\",\n",
+                u8"    \"ruRU\": \" к уровню умений «Спутники»\",\n",
+                u8"    \"zhCN\": \"至召唤技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21228,\n",
+                u8"    \"Key\": \"ModStre8x\",\n",
+                u8"    \"enUS\": \" to Shape-Shifting Skills\",\n",
+                u8"    \"zhTW\": \"變形技能\",\n",
+                u8"    \"deDE\": \" zu Gestaltwandlerfertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades de cambio de forma\",\n",
+                u8"    \"frFR\": \" aux comp. de métamorphose\",\n",
+                u8"    \"itIT\": \" alle Abilità mutaforma\",\n",
+                u8"    \"koKR\": \" 변신 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Zmiany Kształtu\",\n",
+                u8"    \"esMX\": \" a las habilidades de Metamorfosis\",\n",
+                u8"    \"jaJP\": \" 〈変身〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Metamorfose\",\n",
+                u8"    \"ruRU\": \" к умениям смены облика\",\n",
+                u8"    \"zhCN\": \"至变形技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21229,\n",
+                u8"    \"Key\": \"ModStre8y\",\n",
+                u8"    \"enUS\": \" to Elemental Skills\",\n",
+                u8"    \"zhTW\": \"元素技能\",\n",
+                u8"    \"deDE\": \" zu Elementarfertigkeiten\",\n",
+                u8"    \"esES\": \"a las habilidades elementales\",\n",
+                u8"    \"frFR\": \" aux comp. élémentaires\",\n",
+                u8"    \"itIT\": \" alle Magie elementali\",\n",
+                u8"    \"koKR\": \" 원소 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Żywiołów\",\n",
+                u8"    \"esMX\": \" a las habilidades Elementales\",\n",
+                u8"    \"jaJP\": \" 〈自然の力〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Elementos\",\n",
+                u8"    \"ruRU\": \" к уровню умений «Сила стихий»\",\n",
+                u8"    \"zhCN\": \"至元素技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21230,\n",
+                u8"    \"Key\": \"ModStre8z\",\n",
+                u8"    \"enUS\": \" to Trap Skills\",\n",
+                u8"    \"zhTW\": \"陷阱技能\",\n",
+                u8"    \"deDE\": \" zu Fallenfertigkeiten\",\n",
+                u8"    \"esES\": \"a las trampas\",\n",
+                u8"    \"frFR\": \" aux compétences de pièges\",\n",
+                u8"    \"itIT\": \" alle Trappole\",\n",
+                u8"    \"koKR\": \" 덫 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Pułapek\",\n",
+                u8"    \"esMX\": \" a las habilidades de Trampas\",\n",
+                u8"    \"jaJP\": \" 〈トラップ〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Armadilhas\",\n",
+                u8"    \"ruRU\": \" к ловушкам\",\n",
+                u8"    \"zhCN\": \"至陷阱技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21231,\n",
+                u8"    \"Key\": \"ModStre9a\",\n",
+                u8"    \"enUS\": \" to Shadow Discipline Skills\",\n",
+                u8"    \"zhTW\": \"暗影修行技能\",\n",
+                u8"    \"deDE\": \" zu Schattendisziplinen\",\n",
+                u8"    \"esES\": \"a la disciplina de las sombras\",\n",
+                u8"    \"frFR\": \" aux comp. en discipline de l’Ombre\",\n",
+                u8"    \"itIT\": \" alle Discipline dell'ombra\",\n",
+                u8"    \"koKR\": \" 그림자 단련 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Dyscyplin Cienia\",\n",
+                u8"    \"esMX\": \" a las habilidades de Disciplinas de las sombras\",\n",
+                u8"    \"jaJP\": \" 〈シャドウアーツ〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Disciplinas Sombrias\",\n",
+                u8"    \"ruRU\": \" к теневым навыкам\",\n",
+                u8"    \"zhCN\": \"至影身训练技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21232,\n",
+                u8"    \"Key\": \"ModStre9b\",\n",
+                u8"    \"enUS\": \" to Martial Art Skills\",\n",
+                u8"    \"zhTW\": \"武學技藝技能\",\n",
+                u8"    \"deDE\": \" zu Kampfkunstfertigkeiten\",\n",
+                u8"    \"esES\": \"a las artes marciales\",\n",
+                u8"    \"frFR\": \" aux comp. en arts martiaux\",\n",
+                u8"    \"itIT\": \" alle Arti marziali\",\n",
+                u8"    \"koKR\": \" 무술 기술 상승\",\n",
+                u8"    \"plPL\": \" do umiejętności Sztuk Walki\",\n",
+                u8"    \"esMX\": \" a las habilidades de Artes marciales\",\n",
+                u8"    \"jaJP\": \" 〈マーシャルアーツ〉スキル +\",\n",
+                u8"    \"ptBR\": \" para habilidades Artes Marciais\",\n",
+                u8"    \"ruRU\": \" к умениям боевых искусств\",\n",
+                u8"    \"zhCN\": \"至武学技艺技能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21233,\n",
+                u8"    \"Key\": \"ModStre9c\",\n",
+                u8"    \"enUS\": \"(Based on Character Level)\",\n",
+                u8"    \"zhTW\": \"（依角色等級而定）\",\n",
+                u8"    \"deDE\": \"(Basierend auf Charakterstufe)\",\n",
+                u8"    \"esES\": \"(según el nivel del personaje)\",\n",
+                u8"    \"frFR\": \"(Selon niv. du perso.)\",\n",
+                u8"    \"itIT\": \"(Si basa sul livello del personaggio)\",\n",
+                u8"    \"koKR\": \"(캐릭터 레벨에 비례)\",\n",
+                u8"    \"plPL\": \"(Zależy od poziomu postaci)\",\n",
+                u8"    \"esMX\": \"(Según el nivel del personaje)\",\n",
+                u8"    \"jaJP\": \"（キャラクターレベルに依存）\",\n",
+                u8"    \"ptBR\": \"(Com base no nível de personagem)\",\n",
+                u8"    \"ruRU\": \"(В зависимости от уровня персонажа)\",\n",
+                u8"    \"zhCN\": \"(基于角色等级)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21234,\n",
+                u8"    \"Key\": \"ModStre9d\",\n",
+                u8"    \"enUS\": \"%s (Increases During Nighttime)\",\n",
+                u8"    \"zhTW\": \"%s（在夜間增加）\",\n",
+                u8"    \"deDE\": \"%s (Nimmt während der Nacht zu.)\",\n",
+                u8"    \"esES\": \"%s (aumenta durante la noche)\",\n",
+                u8"    \"frFR\": \"%s (augmente de nuit)\",\n",
+                u8"    \"itIT\": \"%s (Aumenta di notte)\",\n",
+                u8"    \"koKR\": \"%s (밤에 증가)\",\n",
+                u8"    \"plPL\": \"%s (zwiększa się w nocy)\",\n",
+                u8"    \"esMX\": \"%s (Aumenta durante la noche)\",\n",
+                u8"    \"jaJP\": \"%s（夜間に上昇）\",\n",
+                u8"    \"ptBR\": \"%s (aumenta durante a noite)\",\n",
+                u8"    \"ruRU\": \"%s (повышается ночью)\",\n",
+                u8"    \"zhCN\": \"%s (在夜间提高)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21235,\n",
+                u8"    \"Key\": \"ModStre9e\",\n",
+                u8"    \"enUS\": \"%s (Increases During Daytime)\",\n",
+                u8"    \"zhTW\": \"%s（在白天增加）\",\n",
+                u8"    \"deDE\": \"%s (Nimmt während des Tages zu.)\",\n",
+                u8"    \"esES\": \"%s (aumenta durante el día)\",\n",
+                u8"    \"frFR\": \"%s (augmente de jour)\",\n",
+                u8"    \"itIT\": \"%s (Aumenta di giorno)\",\n",
+                u8"    \"koKR\": \"%s (낮에 증가)\",\n",
+                u8"    \"plPL\": \"%s (zwiększa się w ciągu dnia)\",\n",
+                u8"    \"esMX\": \"%s (Aumenta durante el día)\",\n",
+                u8"    \"jaJP\": \"%s（日中に上昇）\",\n",
+                u8"    \"ptBR\": \"%s (aumenta durante o dia)\",\n",
+                u8"    \"ruRU\": \"%s (повышается днем)\",\n",
+                u8"    \"zhCN\": \"%s (在白天提高)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21236,\n",
+                u8"    \"Key\": \"ModStre9f\",\n",
+                u8"    \"enUS\": \"%s (Increases Near Dawn)\",\n",
+                u8"    \"zhTW\": \"%s（在黎明增加）\",\n",
+                u8"    \"deDE\": \"%s (Nimmt bei Morgendämmerung zu.)\",\n",
+                u8"    \"esES\": \"%s (aumenta en torno al amanecer)\",\n",
+                u8"    \"frFR\": \"%s (augmente à l’aube)\",\n",
+                u8"    \"itIT\": \"%s (Aumenta all'alba)\",\n",
+                u8"    \"koKR\": \"%s (새벽에 증가)\",\n",
+                u8"    \"plPL\": \"%s (zwiększa się o świcie)\",\n",
+                u8"    \"esMX\": \"%s (Aumenta cerca del alba)\",\n",
+                u8"    \"jaJP\": \"%s（夜明け近くに上昇）\",\n",
+                u8"    \"ptBR\": \"%s (aumenta perto do amanhecer)\",\n",
+                u8"    \"ruRU\": \"%s (повышается на рассвете)\",\n",
+                u8"    \"zhCN\": \"%s (黎明时提高)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21237,\n",
+                u8"    \"Key\": \"ModStre9g\",\n",
+                u8"    \"enUS\": \"%s (Increases Near Dusk)\",\n",
+                u8"    \"zhTW\": \"%s（在黃昏增加）\",\n",
+                u8"    \"deDE\": \"%s (Nimmt bei Abenddämmerung zu.)\",\n",
+                u8"    \"esES\": \"%s (aumenta en torno al anochecer)\",\n",
+                u8"    \"frFR\": \"%s (augmente au crépuscule)\",\n",
+                u8"    \"itIT\": \"%s (Aumenta al crepuscolo)\",\n",
+                u8"    \"koKR\": \"%s (해 질 녘에 증가)\",\n",
+                u8"    \"plPL\": \"%s (zwiększa się o zmierzchu)\",\n",
+                u8"    \"esMX\": \"%s (Aumenta cerca del crepúsculo)\",\n",
+                u8"    \"jaJP\": \"%s（日没近くに上昇）\",\n",
+                u8"    \"ptBR\": \"%s (aumenta perto do entardecer)\",\n",
+                u8"    \"ruRU\": \"%s (повышается в сумерки)\",\n",
+                u8"    \"zhCN\": \"%s (黄昏时提高)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21238,\n",
+                u8"    \"Key\": \"ModStre9h\",\n",
+                u8"    \"enUS\": \" Charges of\",\n",
+                u8"    \"zhTW\": \"次的\",\n",
+                u8"    \"deDE\": \" Ladungen von\",\n",
+                u8"    \"esES\": \"Cargas de\",\n",
+                u8"    \"frFR\": \" Charges de\",\n",
+                u8"    \"itIT\": \" Cariche di\",\n",
+                u8"    \"koKR\": \"회 충전:\",\n",
+                u8"    \"plPL\": \" Ładunki:\",\n",
+                u8"    \"esMX\": \" Cargas de\",\n",
+                u8"    \"jaJP\": \" 回使用可能:\",\n",
+                u8"    \"ptBR\": \" cargas de\",\n",
+                u8"    \"ruRU\": \" зарядов\",\n",
+                u8"    \"zhCN\": \"的充能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21239,\n",
+                u8"    \"Key\": \"ModStre9i\",\n",
+                u8"    \"enUS\": \"Increased Stack Size\",\n",
+                u8"    \"zhTW\": \"堆疊數量提高\",\n",
+                u8"    \"deDE\": \"Erhöhte Stapelgröße\",\n",
+                u8"    \"esES\": \"Cantidad aumentada\",\n",
+                u8"    \"frFR\": \"Quantité maximale augmentée\",\n",
+                u8"    \"itIT\": \"Accumuli aumentati\",\n",
+                u8"    \"koKR\": \"중첩 수량 증가\",\n",
+                u8"    \"plPL\": \"Zwiększona liczba\",\n",
+                u8"    \"esMX\": \"Mayor cantidad de proyectiles\",\n",
+                u8"    \"jaJP\": \"所持数増加\",\n",
+                u8"    \"ptBR\": \"Quantidade de pilha adicional\",\n",
+                u8"    \"ruRU\": \"Больше снарядов\",\n",
+                u8"    \"zhCN\": \"增加堆叠数量\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21240,\n",
+                u8"    \"Key\": \"ModStre9s\",\n",
+                u8"    \"enUS\": \"Indestructible\",\n",
+                u8"    \"zhTW\": \"永不毀損\",\n",
+                u8"    \"deDE\": \"Unzerstörbar\",\n",
+                u8"    \"esES\": \"Indestructible\",\n",
+                u8"    \"frFR\": \"Indestructible\",\n",
+                u8"    \"itIT\": \"Indistruttibile\",\n",
+                u8"    \"koKR\": \"파괴 불가\",\n",
+                u8"    \"plPL\": \"Przedmiot niezniszczalny\",\n",
+                u8"    \"esMX\": \"Indestructible\",\n",
+                u8"    \"jaJP\": \"壊れない\",\n",
+                u8"    \"ptBR\": \"Indestrutível\",\n",
+                u8"    \"ruRU\": \"Не теряет прочности\",\n",
+                u8"    \"zhCN\": \"不可摧毁\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21241,\n",
+                u8"    \"Key\": \"ModStre9t\",\n",
+                u8"    \"enUS\": \"Repairs %d durability per second\",\n",
+                u8"    \"zhTW\": \"每秒修復 %d 耐久度\",\n",
+                u8"    \"deDE\": \"Repariert %d Haltbarkeit pro Sekunde\",\n",
+                u8"    \"esES\": \"Repara %d p. de durabilidad por segundo\",\n",
+                u8"    \"frFR\": \"Répare %d pts de durabilité par seconde\",\n",
+                u8"    \"itIT\": \"Ripara %d integrità ogni secondo\",\n",
+                u8"    \"koKR\": \"내구도 %d 회복 (매초)\",\n",
+                u8"    \"plPL\": \"Przywraca %d pkt. trwałości na sekundę\",\n",
+                u8"    \"esMX\": \"Repara %d de durabilidad por segundo\",\n",
+                u8"    \"jaJP\": \"耐久力が回復（毎秒%d）\",\n",
+                u8"    \"ptBR\": \"Repara %d de durabilidade por segundo\",\n",
+                u8"    \"ruRU\": \"Восполняет %d ед. прочности в секунду\",\n",
+                u8"    \"zhCN\": \"每秒修复 %d 点耐久度\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21242,\n",
+                u8"    \"Key\": \"ModStre9u\",\n",
+                u8"    \"enUS\": \"Repairs %d durability in %d seconds\",\n",
+                u8"    \"zhTW\": \"每 %1 秒修復 %0 點耐久度\",\n",
+                u8"    \"deDE\": \"Repariert %d Haltbarkeit alle %d Sek.\",\n",
+                u8"    \"esES\": \"Repara %d p. de durabilidad cada %d s\",\n",
+                u8"    \"frFR\": \"Répare %d pts de durabilité en %d s\",\n",
+                u8"    \"itIT\": \"Ripara %d integrità in %d s\",\n",
+                u8"    \"koKR\": \"내구도 %d 회복 (%d초마다)\",\n",
+                u8"    \"plPL\": \"Przywraca %d pkt. trwałości na %d sek.\",\n",
+                u8"    \"esMX\": \"Repara %d de durabilidad en %d segundos\",\n",
+                u8"    \"jaJP\": \"耐久力が回復（%d秒ごとに%d）\",\n",
+                u8"    \"ptBR\": \"Repara %d de durabilidade em %d segundos\",\n",
+                u8"    \"ruRU\": \"Восполняет %d ед. прочности раз в %d сек.\",\n",
+                u8"    \"zhCN\": \"每 %1 秒修复 %0 点耐久度\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21243,\n",
+                u8"    \"Key\": \"ModStre9v\",\n",
+                u8"    \"enUS\": \"Replenishes quantity\",\n",
+                u8"    \"zhTW\": \"回復數量\",\n",
+                u8"    \"deDE\": \"Füllt die Menge auf\",\n",
+                u8"    \"esES\": \"Repone la cantidad\",\n",
+                u8"    \"frFR\": \"Auto-approvisionnement\",\n",
+                u8"    \"itIT\": \"Riporta al massimo la quantità\",\n",
+                u8"    \"koKR\": \"수량 자동 회복\",\n",
+                u8"    \"plPL\": \"Odnawia zasoby\",\n",
+                u8"    \"esMX\": \"Recupera cantidad\",\n",
+                u8"    \"jaJP\": \"数量が自動回復\",\n",
+                u8"    \"ptBR\": \"Reabastece a quantidade\",\n",
+                u8"    \"ruRU\": \"Восполняет снаряды\",\n",
+                u8"    \"zhCN\": \"补充数量\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21244,\n",
+                u8"    \"Key\": \"ModStre9w\",\n",
+                u8"    \"enUS\": \"Cast a Level %d\",\n",
+                u8"    \"zhTW\": \"施展等級 %d\",\n",
+                u8"    \"deDE\": \"wirkt einen Stufe %d\",\n",
+                u8"    \"esES\": \"Lanza (nivel %d):\",\n",
+                u8"    \"frFR\": \"Lance au niveau %d\",\n",
+                u8"    \"itIT\": \"di lanciare a livello %d\",\n",
+                u8"    \"koKR\": \"시전: %d 레벨\",\n",
+                u8"    \"plPL\": \"Rzuca poziom %d\",\n",
+                u8"    \"esMX\": \"Lanzamiento nivel %d de\",\n",
+                u8"    \"jaJP\": \"発動: レベル%d\",\n",
+                u8"    \"ptBR\": \"Lança habilidade de nível %d\",\n",
+                u8"    \"ruRU\": \"Применяет %d-го уровня\",\n",
+                u8"    \"zhCN\": \"施放%d级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21245,\n",
+                u8"    \"Key\": \"ModStre9x\",\n",
+                u8"    \"enUS\": \"When You Swing\",\n",
+                u8"    \"zhTW\": \"當你揮舞時\",\n",
+                u8"    \"deDE\": \"Beim Angriff\",\n",
+                u8"    \"esES\": \"Cuando atacas\",\n",
+                u8"    \"frFR\": \"Quand vous frappez\",\n",
+                u8"    \"itIT\": \"Quando attacchi\",\n",
+                u8"    \"koKR\": \"휘두를 때\",\n",
+                u8"    \"plPL\": \"Podczas atakowania\",\n",
+                u8"    \"esMX\": \"Cuando golpeas\",\n",
+                u8"    \"jaJP\": \"武器を振ると\",\n",
+                u8"    \"ptBR\": \"Ao golpear\",\n",
+                u8"    \"ruRU\": \"Когда вы атакуете\",\n",
+                u8"    \"zhCN\": \"当你挥舞\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21246,\n",
+                u8"    \"Key\": \"ModStre9y\",\n",
+                u8"    \"enUS\": \"When You Get Hit\",\n",
+                u8"    \"zhTW\": \"當你被擊中時\",\n",
+                u8"    \"deDE\": \"Wenn Ihr getroffen werdet\",\n",
+                u8"    \"esES\": \"Cuando te golpean\",\n",
+                u8"    \"frFR\": \"Quand vous êtes touché\",\n",
+                u8"    \"itIT\": \"Quando vieni colpito\",\n",
+                u8"    \"koKR\": \"적중당할 때\",\n",
+                u8"    \"plPL\": \"Przy otrzymaniu trafienia\",\n",
+                u8"    \"esMX\": \"Cuando te golpean\",\n",
+                u8"    \"jaJP\": \"攻撃を受けると\",\n",
+                u8"    \"ptBR\": \"Ao receber um golpe\",\n",
+                u8"    \"ruRU\": \"Когда вас поражает противник\",\n",
+                u8"    \"zhCN\": \"当你被击中时\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21247,\n",
+                u8"    \"Key\": \"ModStre9z\",\n",
+                u8"    \"enUS\": \"When You Hit an Enemy\",\n",
+                u8"    \"zhTW\": \"當你擊中敵人時\",\n",
+                u8"    \"deDE\": \"Wenn Ihr einen Gegner trefft\",\n",
+                u8"    \"esES\": \"Cuando golpeas a un enemigo\",\n",
+                u8"    \"frFR\": \"Quand vous touchez l’ennemi\",\n",
+                u8"    \"itIT\": \"Quando colpisci un nemico\",\n",
+                u8"    \"koKR\": \"적을 적중시킬 때\",\n",
+                u8"    \"plPL\": \"Przy trafieniu przeciwnika\",\n",
+                u8"    \"esMX\": \"Cuando golpeas a un enemigo\",\n",
+                u8"    \"jaJP\": \"攻撃を当てると\",\n",
+                u8"    \"ptBR\": \"Ao acertar um inimigo\",\n",
+                u8"    \"ruRU\": \"Когда вы поразили противника\",\n",
+                u8"    \"zhCN\": \"当你击中敌人时\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21248,\n",
+                u8"    \"Key\": \"ModStre10a\",\n",
+                u8"    \"enUS\": \"Charges\",\n",
+                u8"    \"zhTW\": \"次\",\n",
+                u8"    \"deDE\": \"Ladungen\",\n",
+                u8"    \"esES\": \"Cargas\",\n",
+                u8"    \"frFR\": \"Charges\",\n",
+                u8"    \"itIT\": \"Cariche\",\n",
+                u8"    \"koKR\": \"충전 횟수\",\n",
+                u8"    \"plPL\": \"– liczba ładunków\",\n",
+                u8"    \"esMX\": \"Cargas\",\n",
+                u8"    \"jaJP\": \"回使用可能\",\n",
+                u8"    \"ptBR\": \"Cargas\",\n",
+                u8"    \"ruRU\": \"Заряды\",\n",
+                u8"    \"zhCN\": \"充能\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21249,\n",
+                u8"    \"Key\": \"ModStre10b\",\n",
+                u8"    \"enUS\": \"Level\",\n",
+                u8"    \"zhTW\": \"等級\",\n",
+                u8"    \"deDE\": \"Stufe\",\n",
+                u8"    \"esES\": \"Nivel\",\n",
+                u8"    \"frFR\": \"Niveau\",\n",
+                u8"    \"itIT\": \"Livello\",\n",
+                u8"    \"koKR\": \"레벨\",\n",
+                u8"    \"plPL\": \"Poziom\",\n",
+                u8"    \"esMX\": \"Nivel\",\n",
+                u8"    \"jaJP\": \"レベル\",\n",
+                u8"    \"ptBR\": \"Nível\",\n",
+                u8"    \"ruRU\": \"Уровень\",\n",
+                u8"    \"zhCN\": \"等级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21250,\n",
+                u8"    \"Key\": \"ModStre10c\",\n",
+                u8"    \"enUS\": \"Per Level\",\n",
+                u8"    \"zhTW\": \"每級\",\n",
+                u8"    \"deDE\": \"Pro Stufe\",\n",
+                u8"    \"esES\": \"Por nivel\",\n",
+                u8"    \"frFR\": \"par niveau\",\n",
+                u8"    \"itIT\": \"per livello\",\n",
+                u8"    \"koKR\": \"레벨당\",\n",
+                u8"    \"plPL\": \"Na poziom\",\n",
+                u8"    \"esMX\": \"Por nivel\",\n",
+                u8"    \"jaJP\": \"（レベルごと）\",\n",
+                u8"    \"ptBR\": \"Por nível\",\n",
+                u8"    \"ruRU\": \"За каждый уровень\",\n",
+                u8"    \"zhCN\": \"每级\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21251,\n",
+                u8"    \"Key\": \"ModStre10d\",\n",
+                u8"    \"enUS\": \"Level %d %s (%d/%d Charges)\",\n",
+                u8"    \"zhTW\": \"等級 %d %s（%d/%d 次）\",\n",
+                u8"    \"deDE\": \"Stufe %d %s (%d/%d Ladungen)\",\n",
+                u8"    \"esES\": \"%1 de nivel %0 (%2/%3 cargas)\",\n",
+                u8"    \"frFR\": \"Niveau %d %s (%d/%d charges)\",\n",
+                u8"    \"itIT\": \"Livello %d %s (%d/%d cariche)\",\n",
+                u8"    \"koKR\": \"%d 레벨 %s (충전 %d/%d회)\",\n",
+                u8"    \"plPL\": \"%1: Poziom %0 (%2/%3)\",\n",
+                u8"    \"esMX\": \"%1 nivel %0 (cargas: %2/%3)\",\n",
+                u8"    \"jaJP\": \"レベル%0〈%1〉（使用可能数 %2/%3）\",\n",
+                u8"    \"ptBR\": \"%1 Nível %0 (%2/%3 cargas)\",\n",
+                u8"    \"ruRU\": \"«%1» %0-го уровня (%2/%3 зарядов)\",\n",
+                u8"    \"zhCN\": \"%d级%s (%d/%d 次充能)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21252,\n",
+                u8"    \"Key\": \"ModStre10e\",\n",
+                u8"    \"enUS\": \"(\",\n",
+                u8"    \"zhTW\": \"（\",\n",
+                u8"    \"deDE\": \"(\",\n",
+                u8"    \"esES\": \"(\",\n",
+                u8"    \"frFR\": \"(\",\n",
+                u8"    \"itIT\": \"(\",\n",
+                u8"    \"koKR\": \"(\",\n",
+                u8"    \"plPL\": \"(\",\n",
+                u8"    \"esMX\": \"(\",\n",
+                u8"    \"jaJP\": \"（\",\n",
+                u8"    \"ptBR\": \"(\",\n",
+                u8"    \"ruRU\": \"(\",\n",
+                u8"    \"zhCN\": \"(\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21253,\n",
+                u8"    \"Key\": \"ModStre10f\",\n",
+                u8"    \"enUS\": \")\",\n",
+                u8"    \"zhTW\": \"）\",\n",
+                u8"    \"deDE\": \")\",\n",
+                u8"    \"esES\": \")\",\n",
+                u8"    \"frFR\": \")\",\n",
+                u8"    \"itIT\": \")\",\n",
+                u8"    \"koKR\": \")\",\n",
+                u8"    \"plPL\": \")\",\n",
+                u8"    \"esMX\": \")\",\n",
+                u8"    \"jaJP\": \"）\",\n",
+                u8"    \"ptBR\": \")\",\n",
+                u8"    \"ruRU\": \")\",\n",
+                u8"    \"zhCN\": \")\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21254,\n",
+                u8"    \"Key\": \"ModStre10g\",\n",
+                u8"    \"enUS\": \"Stealth\",\n",
+                u8"    \"zhTW\": \"隱密\",\n",
+                u8"    \"deDE\": \"Verstohlenheit\",\n",
+                u8"    \"esES\": \"Sigilo\",\n",
+                u8"    \"frFR\": \"Discrétion\",\n",
+                u8"    \"itIT\": \"Furtività\",\n",
+                u8"    \"koKR\": \"은폐\",\n",
+                u8"    \"plPL\": \"Skradanie\",\n",
+                u8"    \"esMX\": \"Sigilo\",\n",
+                u8"    \"jaJP\": \"隠密\",\n",
+                u8"    \"ptBR\": \"Furtividade\",\n",
+                u8"    \"ruRU\": \"Скрытность\",\n",
+                u8"    \"zhCN\": \"潜行\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21255,\n",
+                u8"    \"Key\": \"ModStre10h\",\n",
+                u8"    \"enUS\": \"Immunity to Poison\",\n",
+                u8"    \"zhTW\": \"毒素免疫\",\n",
+                u8"    \"deDE\": \"Giftimmunität\",\n",
+                u8"    \"esES\": \"Inmunidad al veneno\",\n",
+                u8"    \"frFR\": \"Immunité au Poison\",\n",
+                u8"    \"itIT\": \"Immunità al veleno\",\n",
+                u8"    \"koKR\": \"독 면역\",\n",
+                u8"    \"plPL\": \"Niewrażliwość na trucizny\",\n",
+                u8"    \"esMX\": \"Inmunidad al veneno\",\n",
+                u8"    \"jaJP\": \"毒無効化\",\n",
+                u8"    \"ptBR\": \"Imunidade a veneno\",\n",
+                u8"    \"ruRU\": \"Невосприимчивость к яду\",\n",
+                u8"    \"zhCN\": \"免疫毒素\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21256,\n",
+                u8"    \"Key\": \"ModStre10i\",\n",
+                u8"    \"enUS\": \"Cursed\",\n",
+                u8"    \"zhTW\": \"受詛咒\",\n",
+                u8"    \"deDE\": \"Verflucht\",\n",
+                u8"    \"esES\": \"Maldición\",\n",
+                u8"    \"frFR\": \"[ms]maudit[fs]maudite[mp]maudits[fp]maudites\",\n",
+                u8"    \"itIT\": \"Maledizioni\",\n",
+                u8"    \"koKR\": \"저주받음\",\n",
+                u8"    \"plPL\": \"Przekleństwo\",\n",
+                u8"    \"esMX\": \"[ms]Maldecido[fs]Maldecida[mp]Maldecidos[fp]Maldecidas\",\n",
+                u8"    \"jaJP\": \"呪い\",\n",
+                u8"    \"ptBR\": \"Amaldiçoado\",\n",
+                u8"    \"ruRU\": \"[ms]отверженный[fs]отверженная[ns]отверженное[pl]отверженные\",\n",
+                u8"    \"zhCN\": \"被诅咒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21257,\n",
+                u8"    \"Key\": \"ModStre10j\",\n",
+                u8"    \"enUS\": \"Per Player in Party\",\n",
+                u8"    \"zhTW\": \"隊伍中的每個人\",\n",
+                u8"    \"deDE\": \"Pro Spieler in Gruppe\",\n",
+                u8"    \"esES\": \"Por jugador en el grupo\",\n",
+                u8"    \"frFR\": \"par joueur dans le groupe\",\n",
+                u8"    \"itIT\": \"per giocatore nel gruppo\",\n",
+                u8"    \"koKR\": \"파티 내의 플레이어 인당\",\n",
+                u8"    \"plPL\": \"Na gracza w drużynie\",\n",
+                u8"    \"esMX\": \"Por jugador en equipo\",\n",
+                u8"    \"jaJP\": \"（パーティーのプレイヤー人数分）\",\n",
+                u8"    \"ptBR\": \"Por jogador no grupo\",\n",
+                u8"    \"ruRU\": \"За каждого игрока в группе\",\n",
+                u8"    \"zhCN\": \"队伍中的每名队员\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21258,\n",
+                u8"    \"Key\": \"WeaponDescH2H\",\n",
+                u8"    \"enUS\": \"Claw Class - %s\",\n",
+                u8"    \"zhTW\": \"爪類武器 - %s\",\n",
+                u8"    \"deDE\": \"Klauenklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de garra: %s\",\n",
+                u8"    \"frFR\": \"Type de griffes - %s\",\n",
+                u8"    \"itIT\": \"Classe artiglio - %s\",\n",
+                u8"    \"koKR\": \"손톱 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa szponów – %s\",\n",
+                u8"    \"esMX\": \"Tipo: Garra - %s\",\n",
+                u8"    \"jaJP\": \"鉤爪タイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe garra - %s\",\n",
+                u8"    \"ruRU\": \"Когти – %s\",\n",
+                u8"    \"zhCN\": \"利爪类 - %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21259,\n",
+                u8"    \"Key\": \"WeaponDescOrb\",\n",
+                u8"    \"enUS\": \"Orb Class - %s\",\n",
+                u8"    \"zhTW\": \"法珠類武器 - %s\",\n",
+                u8"    \"deDE\": \"Kugelklasse - %s\",\n",
+                u8"    \"esES\": \"Tipo de orbe: %s\",\n",
+                u8"    \"frFR\": \"Type d’orbe - %s\",\n",
+                u8"    \"itIT\": \"Classe sfera - %s\",\n",
+                u8"    \"koKR\": \"보주 계열 - %s\",\n",
+                u8"    \"plPL\": \"Klasa kul – %s\",\n",
+                u8"    \"esMX\": \"Tipo: orbe - %s\",\n",
+                u8"    \"jaJP\": \"オーブタイプ - %s\",\n",
+                u8"    \"ptBR\": \"Classe orbe - %s\",\n",
+                u8"    \"ruRU\": \"Сфера – %s\",\n",
+                u8"    \"zhCN\": \"法球类- %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21260,\n",
+                u8"    \"Key\": \"ItemexpED\",\n",
+                u8"    \"enUS\": \" Elemental Damage\",\n",
+                u8"    \"zhTW\": \"元素傷害\",\n",
+                u8"    \"deDE\": \" Elementarschaden\",\n",
+                u8"    \"esES\": \"Daño elemental\",\n",
+                u8"    \"frFR\": \"Dégâts élémentaires\",\n",
+                u8"    \"itIT\": \" Danni elementali\",\n",
+                u8"    \"koKR\": \" 원소 피해\",\n",
+                u8"    \"plPL\": \" Obrażenia od żywiołów\",\n",
+                u8"    \"esMX\": \" Daño elemental\",\n",
+                u8"    \"jaJP\": \" 属性ダメージ\",\n",
+                u8"    \"ptBR\": \" de dano elemental\",\n",
+                u8"    \"ruRU\": \" урона от стихий\",\n",
+                u8"    \"zhCN\": \"元素伤害\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21782,\n",
+                u8"    \"Key\": \"ModStre10k\",\n",
+                u8"    \"enUS\": \"Kick Damage: %d to %d\",\n",
+                u8"    \"zhTW\": \"踢擊傷害：%d - %d 點\",\n",
+                u8"    \"deDE\": \"Trittschaden: %d bis %d\",\n",
+                u8"    \"esES\": \"Daño de patada: %d-%d p.\",\n",
+                u8"    \"frFR\": \"Dégâts du coup de pied : %d à %d\",\n",
+                u8"    \"itIT\": \"Danni da calcio: %d-%d\",\n",
+                u8"    \"koKR\": \"발차기 피해: %d - %d\",\n",
+                u8"    \"plPL\": \"Obrażenia od kopnięcia: %d-%d\",\n",
+                u8"    \"esMX\": \"Daño por patada: %d a %d\",\n",
+                u8"    \"jaJP\": \"キックダメージ: %d - %d\",\n",
+                u8"    \"ptBR\": \"Dano de chute: %d a %d\",\n",
+                u8"    \"ruRU\": \"Урон от пинков: %d–%d\",\n",
+                u8"    \"zhCN\": \"脚踢伤害: %d - %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21783,\n",
+                u8"    \"Key\": \"ModStre10L\",\n",
+                u8"    \"enUS\": \"Percent Chance to Cast\",\n",
+                u8"    \"zhTW\": \"% 施展機率\",\n",
+                u8"    \"deDE\": \"% Chance auszulösen:\",\n",
+                u8"    \"esES\": \"% de probabilidad de lanzar\",\n",
+                u8"    \"frFR\": \"Pourcentage de chance de lancer le sort\",\n",
+                u8"    \"itIT\": \"% di probabilità di lanciare\",\n",
+                u8"    \"koKR\": \"% 확률로 시전:\",\n",
+                u8"    \"plPL\": \"Procent szans na rzucenie\",\n",
+                u8"    \"esMX\": \"% de probabilidad de lanzar\",\n",
+                u8"    \"jaJP\": \"%%の確率で発動:\",\n",
+                u8"    \"ptBR\": \"Percentual de chance de lançar\",\n",
+                u8"    \"ruRU\": \"Вероятность применить\",\n",
+                u8"    \"zhCN\": \"%施法几率\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21806,\n",
+                u8"    \"Key\": \"tr2\",\n",
+                u8"    \"enUS\": \"Scroll of Resistance\",\n",
+                u8"    \"zhTW\": \"抗性卷軸\",\n",
+                u8"    \"deDE\": \"Schriftrolle des Widerstandes\",\n",
+                u8"    \"esES\": \"Pergamino de resistencia\",\n",
+                u8"    \"frFR\": \"Parchemin de résistance\",\n",
+                u8"    \"itIT\": \"Pergamena della resistenza\",\n",
+                u8"    \"koKR\": \"저항의 두루마리\",\n",
+                u8"    \"plPL\": \"Zwój Odporności\",\n",
+                u8"    \"esMX\": \"Pergamino de resistencia\",\n",
+                u8"    \"jaJP\": \"耐性の巻物\",\n",
+                u8"    \"ptBR\": \"Pergaminho de Resistência\",\n",
+                u8"    \"ruRU\": \"Свиток сопротивления\",\n",
+                u8"    \"zhCN\": \"抗性卷轴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21874,\n",
+                u8"    \"Key\": \"ExInsertSockets\",\n",
+                u8"    \"enUS\": \"Can be Inserted into Socketed Items\",\n",
+                u8"    \"zhTW\": \"可以放入有鑲孔的物品\",\n",
+                u8"    \"deDE\": \"Anbringung möglich an gesockelten Gegenständen\",\n",
+                u8"    \"esES\": \"Se puede insertar en objetos con huecos\",\n",
+                u8"    \"frFR\": \"Peut être enchâssé(e) dans les objets avec châsse\",\n",
+                u8"    \"itIT\": \"Si può inserire negli oggetti con castone\",\n",
+                u8"    \"koKR\": \"홈이 있는 아이템에 삽입 가능\",\n",
+                u8"    \"plPL\": \"Można umieścić w przedmiotach z gniazdami\",\n",
+                u8"    \"esMX\": \"Puede insertarse en objetos engarzados\",\n",
+                u8"    \"jaJP\": \"ソケット付きのアイテムに装着可能\",\n",
+                u8"    \"ptBR\": \"Pode ser inserido em itens com engastes\",\n",
+                u8"    \"ruRU\": \"Можно вставить в предметы с гнездами\",\n",
+                u8"    \"zhCN\": \"可以被插入有镶孔的物品中\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21885,\n",
+                u8"    \"Key\": \"ItemExpansiveChancX\",\n",
+                u8"    \"enUS\": \"%d%% Chance to cast level %d %s on attack\",\n",
+                u8"    \"zhTW\": \"攻擊時有 %d%% 機率施展等級 %d %s\",\n",
+                u8"    \"deDE\": \"%d%% Chance, bei einem Angriff Stufe %d %s auszulösen\",\n",
+                u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al atacar\",\n",
+                u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 en attaquant\",\n",
+                u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando attacchi\",\n",
+                u8"    \"koKR\": \"공격 시 %d%% 확률로 %d 레벨 %s 시전\",\n",
+                u8"    \"plPL\": \"%d%% szansy rzucenia %d-poziomowego zaklęcia %s podczas atakowania\",\n",
+                u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al atacar\",\n",
+                u8"    \"jaJP\": \"攻撃時に%0%%の確率で〈%2〉（レベル%1）を発動\",\n",
+                u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 ao atacar\",\n",
+                u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при атаке\",\n",
+                u8"    \"zhCN\": \"%d%% 几率在攻击时施放%d级%s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21886,\n",
+                u8"    \"Key\": \"ItemExpansiveChanc1\",\n",
+                u8"    \"enUS\": \"%d%% Chance to cast level %d %s on striking\",\n",
+                u8"    \"zhTW\": \"擊中時有 %d%% 機率施展等級 %d %s\",\n",
+                u8"    \"deDE\": \"%d%% Chance, bei einem Angriff Stufe %d %s auszulösen\",\n",
+                u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al golpear\",\n",
+                u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 en touchant\",\n",
+                u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando colpisci\",\n",
+                u8"    \"koKR\": \"타격 시 %d%% 확률로 %d 레벨 %s 시전\",\n",
+                u8"    \"plPL\": \"%d%% szansy rzucenia %d-poziomowego zaklęcia %s, gdy atak dosięga celu\",\n",
+                u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al golpear\",\n",
+                u8"    \"jaJP\": \"命中時に%0%%の確率で〈%2〉（レベル%1）を発動\",\n",
+                u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 ao atingir um inimigo\",\n",
+                u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при ударе\",\n",
+                u8"    \"zhCN\": \"%d%% 几率在击中时施放%d级%s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21887,\n",
+                u8"    \"Key\": \"ItemExpansiveChanc2\",\n",
+                u8"    \"enUS\": \"%d%% Chance to cast level %d %s when struck\",\n",
+                u8"    \"zhTW\": \"被擊中時有 %d%% 機率施展等級 %d %s\",\n",
+                u8"    \"deDE\": \"%d%% Chance, wenn getroffen Stufe %d %s auszulösen\",\n",
+                u8"    \"esES\": \"%0%% de probabilidad de lanzar %2 de nivel %1 al recibir un golpe\",\n",
+                u8"    \"frFR\": \"%0%% de chances de lancer %2 - niv. %1 quand touché\",\n",
+                u8"    \"itIT\": \"Probabilità del %d%% di lanciare a livello %d %s quando ti colpiscono\",\n",
+                u8"    \"koKR\": \"피격 시 %d%% 확률로 %d 레벨 %s 시전\",\n",
+                u8"    \"plPL\": \"%d%% szansy rzucenia %d-poziomowego zaklęcia %s przy otrzymaniu trafienia\",\n",
+                u8"    \"esMX\": \"%0%% de probabilidad de lanzar %2 nivel %1 al recibir un golpe\",\n",
+                u8"    \"jaJP\": \"攻撃を受けると%0%%の確率で〈%2〉（レベル%1）を発動\",\n",
+                u8"    \"ptBR\": \"%0%% de chance de lançar %2 de nível %1 ao ser atingido\",\n",
+                u8"    \"ruRU\": \"Вероятность %0%% применить умение «%2» %1-го уровня при получении урона\",\n",
+                u8"    \"zhCN\": \"%d%% 几率在被击中时施放%d级%s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21888,\n",
+                u8"    \"Key\": \"ItemExpcharmdesc\",\n",
+                u8"    \"enUS\": \"Keep in inventory to gain bonus\",\n",
+                u8"    \"zhTW\": \"放在物品欄以獲得其加成效果\",\n",
+                u8"    \"deDE\": \"Im Inventar behalten, um Bonus zu erhalten.\",\n",
+                u8"    \"esES\": \"Guárdalo en el inventario para obtener un bonus\",\n",
+                u8"    \"frFR\": \"À garder dans l’inventaire pour bénéficier du bonus\",\n",
+                u8"    \"itIT\": \"Tieni nell'inventario per ottenere un bonus\",\n",
+                u8"    \"koKR\": \"소지품에 보관 시 보너스 획득\",\n",
+                u8"    \"plPL\": \"Aby aktywować właściwości, trzymaj przedmiot w ekwipunku\",\n",
+                u8"    \"esMX\": \"Conservar en el Inventario para obtener la bonificación\",\n",
+                u8"    \"jaJP\": \"所持品に入れることでボーナスが得られる\",\n",
+                u8"    \"ptBR\": \"Manter no inventário para ganhar bônus\",\n",
+                u8"    \"ruRU\": \"Дает бонус при хранении в инвентаре\",\n",
+                u8"    \"zhCN\": \"放在物品栏里以享受加成\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22745,\n",
+                u8"    \"Key\": \"strethereal\",\n",
+                u8"    \"enUS\": \"Ethereal (Cannot be Repaired)\",\n",
+                u8"    \"zhTW\": \"無形（無法修復）\",\n",
+                u8"    \"deDE\": \"Ätherisch (Reparatur nicht möglich.)\",\n",
+                u8"    \"esES\": \"Etéreo (no se puede reparar)\",\n",
+                u8"    \"frFR\": \"Éthéré (ne peut pas être réparé)\",\n",
+                u8"    \"itIT\": \"Etereo (non si può riparare)\",\n",
+                u8"    \"koKR\": \"무형 (수리 불가)\",\n",
+                u8"    \"plPL\": \"Przedmiot eteryczny (nie może być naprawiony)\",\n",
+                u8"    \"esMX\": \"Etéreo (no puede repararse)\",\n",
+                u8"    \"jaJP\": \"イシリアル（修理不可能）\",\n",
+                u8"    \"ptBR\": \"Etéreo (não pode ser reparado)\",\n",
+                u8"    \"ruRU\": \"Бесплотный предмет (нельзя ремонтировать)\",\n",
+                u8"    \"zhCN\": \"无形的 (无法修复)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22746,\n",
+                u8"    \"Key\": \"stretherealnonrepair\",\n",
+                u8"    \"enUS\": \"This item cannot be repaired.\",\n",
+                u8"    \"zhTW\": \"這項物品無法修復。\",\n",
+                u8"    \"deDE\": \"Dieser Gegenstand kann nicht repariert werden.\",\n",
+                u8"    \"esES\": \"Este objeto no se puede reparar\",\n",
+                u8"    \"frFR\": \"Cet objet ne peut pas être réparé.\",\n",
+                u8"    \"itIT\": \"Quest'oggetto non può essere riparato.\",\n",
+                u8"    \"koKR\": \"이 아이템은 수리할 수 없습니다.\",\n",
+                u8"    \"plPL\": \"Ten przedmiot nie może być naprawiony.\",\n",
+                u8"    \"esMX\": \"Este objeto no puede repararse.\",\n",
+                u8"    \"jaJP\": \"修理できないアイテムです。\",\n",
+                u8"    \"ptBR\": \"Este item não pode ser reparado.\",\n",
+                u8"    \"ruRU\": \"Этот предмет нельзя отремонтировать.\",\n",
+                u8"    \"zhCN\": \"此物品无法被修复。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 23001,\n",
+                u8"    \"Key\": \"ModStr2uPercent\",\n",
+                u8"    \"enUS\": \"Physical Damage Received Reduced by %d%%\",\n",
+                u8"    \"zhTW\": \"受到的物理傷害降低 %d%%\",\n",
+                u8"    \"deDE\": \"Schaden reduziert um %d%%\",\n",
+                u8"    \"esES\": \"Daño reducido un %d%%\",\n",
+                u8"    \"frFR\": \"Dégâts réduits de %d%%\",\n",
+                u8"    \"itIT\": \"Danni ridotti del %d%%\",\n",
+                u8"    \"koKR\": \"받는 물리 피해 %d%% 감소\",\n",
+                u8"    \"plPL\": \"Zmniejsza obrażenia o %d%%\",\n",
+                u8"    \"esMX\": \"Reduce un %d%% el daño\",\n",
+                u8"    \"jaJP\": \"ダメージを軽減（%d%%）\",\n",
+                u8"    \"ptBR\": \"Dano reduzido em %d%%\",\n",
+                u8"    \"ruRU\": \"Урон уменьшен на %d%%\",\n",
+                u8"    \"zhCN\": \"受到的物理伤害降低 %d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 23004,\n",
+                u8"    \"Key\": \"ItemModifierClassSkill\",\n",
+                u8"    \"enUS\": \"%+d to %s %s\",\n",
+                u8"    \"zhTW\": \"%+d 至%s %s\",\n",
+                u8"    \"deDE\": \"%+d zu %s %s\",\n",
+                u8"    \"esES\": \"%+d a %s (%s)\",\n",
+                u8"    \"frFR\": \"%+d à %s %s\",\n",
+                u8"    \"itIT\": \"%+d a %s %s\",\n",
+                u8"    \"koKR\": \"%+d %s %s\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności %s %s\",\n",
+                u8"    \"esMX\": \"%+d a %s %s\",\n",
+                u8"    \"jaJP\": \"〈%1〉スキル向上（%+0）%2\",\n",
+                u8"    \"ptBR\": \"%+d para %s %s\",\n",
+                u8"    \"ruRU\": \"%+d к умению «%s» %s\",\n",
+                u8"    \"zhCN\": \"%+d 至%s %s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 23005,\n",
+                u8"    \"Key\": \"ItemModifierNonClassSkill\",\n",
+                u8"    \"enUS\": \"%+d to %s\",\n",
+                u8"    \"zhTW\": \"%+d 至%s\",\n",
+                u8"    \"deDE\": \"%+d zu %s\",\n",
+                u8"    \"esES\": \"%+d a %s\",\n",
+                u8"    \"frFR\": \"%+d à %s\",\n",
+                u8"    \"itIT\": \"%+d a %s\",\n",
+                u8"    \"koKR\": \"%+d %s\",\n",
+                u8"    \"plPL\": \"%+d do umiejętności %s\",\n",
+                u8"    \"esMX\": \"%+d a %s\",\n",
+                u8"    \"jaJP\": \"〈%1〉向上（%+0）\",\n",
+                u8"    \"ptBR\": \"%+d para %s\",\n",
+                u8"    \"ruRU\": \"%+d к умению «%s»\",\n",
+                u8"    \"zhCN\": \"%+d 至%s\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 23049,\n",
+                u8"    \"Key\": \"strItemModEtherealSocketed\",\n",
+                u8"    \"enUS\": \"Ethereal (Cannot be Repaired), Socketed (%i)\",\n",
+                u8"    \"zhTW\": \"無形（無法修復），鑲孔（%i）\",\n",
+                u8"    \"deDE\": \"Ätherisch (Reparatur nicht möglich.), Gesockelt (%i)\",\n",
+                u8"    \"esES\": \"Etéreo (no se puede reparar) y con huecos (%i)\",\n",
+                u8"    \"frFR\": \"Éthéré (ne peut être pas réparé), serti (%i)\",\n",
+                u8"    \"itIT\": \"Etereo (non si può riparare), Con castoni (%i)\",\n",
+                u8"    \"koKR\": \"무형 (수리 불가), 홈 있음 (%i)\",\n",
+                u8"    \"plPL\": \"Przedmiot eteryczny (nie może być naprawiony), gniazda (%i)\",\n",
+                u8"    \"esMX\": \"Etéreo (no puede repararse), Engarzado (%i)\",\n",
+                u8"    \"jaJP\": \"イシリアル（修理不可能）、ソケット（%i）\",\n",
+                u8"    \"ptBR\": \"Etéreo (não pode ser reparado), com engastes (%i)\",\n",
+                u8"    \"ruRU\": \"Бесплотный предмет (нельзя ремонтировать), с гнездами (%i)\",\n",
+                u8"    \"zhCN\": \"无形的 (无法修复), 镶孔 (%i)\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 23050,\n",
+                u8"    \"Key\": \"strItemStatThrowDamageRange\",\n",
+                u8"    \"enUS\": \"Throw Damage: %d to %d\",\n",
+                u8"    \"zhTW\": \"投擲傷害：%d - %d 點\",\n",
+                u8"    \"deDE\": \"Wurfschaden: %d bis %d\",\n",
+                u8"    \"esES\": \"Daño de lanzamiento: %d-%d p.\",\n",
+                u8"    \"frFR\": \"Dégâts au lancer : %d à %d\",\n",
+                u8"    \"itIT\": \"Danni da lancio: %d-%d\",\n",
+                u8"    \"koKR\": \"투척 피해: %d - %d\",\n",
+                u8"    \"plPL\": \"Obrażenia przy rzucie: %d-%d\",\n",
+                u8"    \"esMX\": \"Daño de arrojamiento: %d a %d\",\n",
+                u8"    \"jaJP\": \"投てきダメージ: %d - %d\",\n",
+                u8"    \"ptBR\": \"Dano de arremesso: %d a %d\",\n",
+                u8"    \"ruRU\": \"Урон от метательного оружия: %d–%d\",\n",
+                u8"    \"zhCN\": \"投掷伤害: %d - %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 26333,\n",
+                u8"    \"Key\": \"UseTokenOfAbsolution\",\n",
+                u8"    \"enUS\": \"Right Click to reset Stat/Skill Points\",\n",
+                u8"    \"zhTW\": \"右鍵點擊以重置屬性與技能點數\",\n",
+                u8"    \"deDE\": \"Mit Rechtsklick Werte und Fertigkeitspunkte zurücksetzen\",\n",
+                u8"    \"esES\": \"Haz clic derecho para reiniciar los puntos de habilidad/estadísticas\",\n",
+                u8"    \"frFR\": \"Cliquez-droit pour réinitialiser les points de stat/compétence\",\n",
+                u8"    \"itIT\": \"Clicca col destro per azzerare abilità e caratteristiche\",\n",
+                u8"    \"koKR\": \"오른쪽 클릭으로 능력치/기술 포인트 초기화\",\n",
+                u8"    \"plPL\": \"Naciśnij PPM, aby zresetować atrybuty i umiejętności\",\n",
+                u8"    \"esMX\": \"Haz clic derecho para restablecer los puntos de atributo/habilidad\",\n",
+                u8"    \"jaJP\": \"右クリックでステータスとスキル・ポイントをリセット\",\n",
+                u8"    \"ptBR\": \"Clique com o botão direito para redefinir pontos de habilidades/atributos\",\n",
+                u8"    \"ruRU\": \"Щелкните ПКМ, чтобы сбросить очки характеристик/умений\",\n",
+                u8"    \"zhCN\": \"右键点击重设属性/技能点\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 26360,\n",
+                u8"    \"Key\": \"MalahsPotionDescription\",\n",
+                u8"    \"enUS\": \"Keep it to thaw Anya\",\n",
+                u8"    \"zhTW\": \"融化安亞身上的冰雪\",\n",
+                u8"    \"deDE\": \"Wird benötigt, um Anya aufzutauen\",\n",
+                u8"    \"esES\": \"Guárdala para descongelar a Anya\",\n",
+                u8"    \"frFR\": \"Gardez-la pour libérer Anya\",\n",
+                u8"    \"itIT\": \"Usala per scongelare Anya\",\n",
+                u8"    \"koKR\": \"안야를 녹이는 데 사용\",\n",
+                u8"    \"plPL\": \"Zatrzymaj ją, by rozmrozić Anyę\",\n",
+                u8"    \"esMX\": \"Consérvala para descongelar a Anya\",\n",
+                u8"    \"jaJP\": \"アニャの氷を解かせる\",\n",
+                u8"    \"ptBR\": \"Guardar para descongelar Anya\",\n",
+                u8"    \"ruRU\": \"Может отогреть Аню.\",\n",
+                u8"    \"zhCN\": \"留着它来解救安雅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 26705,\n",
+                u8"    \"Key\": \"ItemModifierPersonalized\",\n",
+                u8"    \"enUS\": \"Personalized\",\n",
+                u8"    \"zhTW\": \"冠上名字\",\n",
+                u8"    \"deDE\": \"Personalisiert\",\n",
+                u8"    \"esES\": \"[fs]personalizada[ms]personalizado[fp]personalizadas[mp]personalizados\",\n",
+                u8"    \"frFR\": \"Personnalisé\",\n",
+                u8"    \"itIT\": \"Personalizzato\",\n",
+                u8"    \"koKR\": \"이름 새겨짐\",\n",
+                u8"    \"plPL\": \"[fs]Personalizowana[ms]Personalizowany[nl]Personalizowane\",\n",
+                u8"    \"esMX\": \"Personalizado\",\n",
+                u8"    \"jaJP\": \"一点物の\",\n",
+                u8"    \"ptBR\": \"Personalizado\",\n",
+                u8"    \"ruRU\": \"Переименовано\",\n",
+                u8"    \"zhCN\": \"个性化\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27212,\n",
+                u8"    \"Key\": \"ModStr6j\",\n",
+                u8"    \"enUS\": \"%+d%% Chance to not consume Quantity\",\n",
+                u8"    \"zhTW\": \"%+d%% 機率不消耗數量\",\n",
+                u8"    \"deDE\": \"%+d%% Chance, keinen Stapel zu verbrauchen\",\n",
+                u8"    \"esES\": \"%+d%% de probabilidad de no consumir cantidad\",\n",
+                u8"    \"frFR\": \"%+d%% de chances de ne pas consommer de quantité\",\n",
+                u8"    \"itIT\": \"Probabilità di non consumare quantità %+d%%\",\n",
+                u8"    \"koKR\": \"%+d%% 확률로 수량을 소모하지 않음\",\n",
+                u8"    \"plPL\": \"%+d%% szansy na niepochłonięcie zasobów\",\n",
+                u8"    \"esMX\": \"%+d%% de probabilidad de no consumir cantidad\",\n",
+                u8"    \"jaJP\": \"%+d%%の確立でアイテム消費をしない\",\n",
+                u8"    \"ptBR\": \"%+d%% de chance de não consumir quantidade\",\n",
+                u8"    \"ruRU\": \"%+d%% к шансу не израсходовать снаряды\",\n",
+                u8"    \"zhCN\": \"%+d%% 几率不消耗数量\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27339,\n",
+                u8"    \"Key\": \"ModItemMonColdSunder\",\n",
+                u8"    \"enUS\": \"Monster Cold Immunity is Sundered\",\n",
+                u8"    \"zhTW\": \"破除怪物的冰寒免疫\",\n",
+                u8"    \"deDE\": \"Die Kälteimmunität von Monstern ist durchbrochen\",\n",
+                u8"    \"esES\": \"Se hiende la inmunidad al frío de los monstruos\",\n",
+                u8"    \"frFR\": \"L’immunité au froid des monstres est brisée.\",\n",
+                u8"    \"itIT\": \"L'immunità al freddo dei mostri è Infranta\",\n",
+                u8"    \"koKR\": \"괴물의 냉기 면역이 파괴됨\",\n",
+                u8"    \"plPL\": \"Niewrażliwość potworów na zimno jest osłabiona\",\n",
+                u8"    \"esMX\": \"La inmunidad al frío de los monstruos se reduce\",\n",
+                u8"    \"jaJP\": \"敵の冷気無効を弱体化\",\n",
+                u8"    \"ptBR\": \"Imunidade a gelo de monstros destroçada\",\n",
+                u8"    \"ruRU\": \"Невосприимчивость монстров к холоду нейтрализована\",\n",
+                u8"    \"zhCN\": \"已破除怪物冰霜免疫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27340,\n",
+                u8"    \"Key\": \"ModItemMonFireSunder\",\n",
+                u8"    \"enUS\": \"Monster Fire Immunity is Sundered\",\n",
+                u8"    \"zhTW\": \"破除怪物的火焰免疫\",\n",
+                u8"    \"deDE\": \"Die Feuerimmunität von Monstern ist durchbrochen\",\n",
+                u8"    \"esES\": \"Se hiende la inmunidad al fuego de los monstruos\",\n",
+                u8"    \"frFR\": \"L’immunité au feu des monstres est brisée.\",\n",
+                u8"    \"itIT\": \"L'immunità al fuoco dei mostri è Infranta\",\n",
+                u8"    \"koKR\": \"괴물의 화염 면역이 파괴됨\",\n",
+                u8"    \"plPL\": \"Niewrażliwość potworów na ogień jest osłabiona\",\n",
+                u8"    \"esMX\": \"La inmunidad al fuego de los monstruos se reduce\",\n",
+                u8"    \"jaJP\": \"敵の火炎無効を弱体化\",\n",
+                u8"    \"ptBR\": \"Imunidade a fogo de monstros destroçada\",\n",
+                u8"    \"ruRU\": \"Невосприимчивость монстров к огню нейтрализована\",\n",
+                u8"    \"zhCN\": \"已破除怪物火焰免疫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27341,\n",
+                u8"    \"Key\": \"ModItemMonLightSunder\",\n",
+                u8"    \"enUS\": \"Monster Lightning Immunity is Sundered\",\n",
+                u8"    \"zhTW\": \"破除怪物的閃電免疫\",\n",
+                u8"    \"deDE\": \"Die Blitzimmunität von Monstern ist durchbrochen\",\n",
+                u8"    \"esES\": \"Se hiende la inmunidad a los rayos de los monstruos\",\n",
+                u8"    \"frFR\": \"L’immunité à la foudre des monstres est brisée.\",\n",
+                u8"    \"itIT\": \"L'immunità al fulmine dei mostri è Infranta\",\n",
+                u8"    \"koKR\": \"괴물의 번개 면역이 파괴됨\",\n",
+                u8"    \"plPL\": \"Niewrażliwość potworów na błyskawice jest osłabiona\",\n",
+                u8"    \"esMX\": \"La inmunidad al rayo de los monstruos se reduce\",\n",
+                u8"    \"jaJP\": \"敵の電撃無効を弱体化\",\n",
+                u8"    \"ptBR\": \"Imunidade elétrica de monstros destroçada\",\n",
+                u8"    \"ruRU\": \"Невосприимчивость монстров к молнии нейтрализована\",\n",
+                u8"    \"zhCN\": \"已破除怪物闪电免疫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27342,\n",
+                u8"    \"Key\": \"ModItemMonPoisonSunder\",\n",
+                u8"    \"enUS\": \"Monster Poison Immunity is Sundered\",\n",
+                u8"    \"zhTW\": \"破除怪物的毒素免疫\",\n",
+                u8"    \"deDE\": \"Die Giftimmunität von Monstern ist durchbrochen\",\n",
+                u8"    \"esES\": \"Se hiende la inmunidad al veneno de los monstruos\",\n",
+                u8"    \"frFR\": \"L’immunité au poison des monstres est brisée.\",\n",
+                u8"    \"itIT\": \"L'immunità al veleno dei mostri è Infranta\",\n",
+                u8"    \"koKR\": \"괴물의 독 면역이 파괴됨\",\n",
+                u8"    \"plPL\": \"Niewrażliwość potworów na trucizny jest osłabiona\",\n",
+                u8"    \"esMX\": \"La inmunidad al veneno de los monstruos se reduce\",\n",
+                u8"    \"jaJP\": \"敵の毒無効を弱体化\",\n",
+                u8"    \"ptBR\": \"Imunidade a veneno de monstros destroçada\",\n",
+                u8"    \"ruRU\": \"Невосприимчивость монстров к яду нейтрализована\",\n",
+                u8"    \"zhCN\": \"已破除怪物毒素免疫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27343,\n",
+                u8"    \"Key\": \"ModItemMonPhysicalSunder\",\n",
+                u8"    \"enUS\": \"Monster Physical Immunity is Sundered\",\n",
+                u8"    \"zhTW\": \"破除怪物的物理免疫\",\n",
+                u8"    \"deDE\": \"Die physische Immunität von Monstern ist durchbrochen\",\n",
+                u8"    \"esES\": \"Se hiende la inmunidad física de los monstruos\",\n",
+                u8"    \"frFR\": \"L’immunité physique des monstres est brisée.\",\n",
+                u8"    \"itIT\": \"L'immunità ai danni fisici dei mostri è Infranta\",\n",
+                u8"    \"koKR\": \"괴물의 물리 면역이 파괴됨\",\n",
+                u8"    \"plPL\": \"Niewrażliwość potworów na ataki fizyczne jest osłabiona\",\n",
+                u8"    \"esMX\": \"La inmunidad al daño físico de los monstruos se reduce\",\n",
+                u8"    \"jaJP\": \"敵の物理無効を弱体化\",\n",
+                u8"    \"ptBR\": \"Imunidade física de monstros destroçada\",\n",
+                u8"    \"ruRU\": \"Невосприимчивость монстров к физическому урону нейтрализована\",\n",
+                u8"    \"zhCN\": \"已破除怪物物理免疫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27344,\n",
+                u8"    \"Key\": \"ModItemMonMagicSunder\",\n",
+                u8"    \"enUS\": \"Monster Magic Immunity is Sundered\",\n",
+                u8"    \"zhTW\": \"破除怪物的魔法免疫\",\n",
+                u8"    \"deDE\": \"Die magische Immunität von Monstern ist durchbrochen\",\n",
+                u8"    \"esES\": \"Se hiende la inmunidad mágica de los monstruos\",\n",
+                u8"    \"frFR\": \"L’immunité magique des monstres est brisée.\",\n",
+                u8"    \"itIT\": \"L'immunità alla magia dei mostri è Infranta\",\n",
+                u8"    \"koKR\": \"괴물의 마법 면역이 파괴됨\",\n",
+                u8"    \"plPL\": \"Niewrażliwość potworów na magię jest osłabiona\",\n",
+                u8"    \"esMX\": \"La inmunidad a la magia de los monstruos se reduce\",\n",
+                u8"    \"jaJP\": \"敵の魔法無効を弱体化\",\n",
+                u8"    \"ptBR\": \"Imunidade a magia de monstros destroçada\",\n",
+                u8"    \"ruRU\": \"Невосприимчивость монстров к магическому урону нейтрализована\",\n",
+                u8"    \"zhCN\": \"已破除怪物魔法免疫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27351,\n",
+                u8"    \"Key\": \"ModStr2uPercentNegative\",\n",
+                u8"    \"enUS\": \"Physical Damage Received Increased by %d%%\",\n",
+                u8"    \"zhTW\": \"受到的物理傷害提高 %d%%\",\n",
+                u8"    \"deDE\": \"Erlittener Schaden um %d%% erhöht\",\n",
+                u8"    \"esES\": \"Daño sufrido aumentado un %d%%\",\n",
+                u8"    \"frFR\": \"Dégâts subis augmentés de %d%%\",\n",
+                u8"    \"itIT\": \"Danni ricevuti aumentati del %d%%\",\n",
+                u8"    \"koKR\": \"받는 물리 피해 %d%% 증가\",\n",
+                u8"    \"plPL\": \"Otrzymane obrażenia są zwiększone o %d%%\",\n",
+                u8"    \"esMX\": \"El daño recibido aumenta un %d%%\",\n",
+                u8"    \"jaJP\": \"受ける物理ダメージ%d%%増加\",\n",
+                u8"    \"ptBR\": \"Dano recebido aumentado em %d%%\",\n",
+                u8"    \"ruRU\": \"Получаемый урон увеличен на %d%%\",\n",
+                u8"    \"zhCN\": \"受到的物理伤害提高 %d%%\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27371,\n",
+                u8"    \"Key\": \"ModStr6k\",\n",
+                u8"    \"enUS\": \"%+d%% chance for finishing moves to not consume charges\",\n",
+                u8"    \"zhTW\": \"%+d%% 機率使終結技不消耗集氣的力量\",\n",
+                u8"    \"deDE\": \"%+d%% Chance, dass Finishing-Moves keine Aufladungen verbrauchen\",\n",
+                u8"    \"esES\": \"%+d%% de probabilidad de que los remates no consuman cargas\",\n",
+                u8"    \"frFR\": \"%+d%% de chances que les coups finaux ne consomment aucune charge\",\n",
+                u8"    \"itIT\": \"Probabilità che le mosse finali non consumino cariche %+d%%\",\n",
+                u8"    \"koKR\": \"필살기가 충전을 소모하지 않을 확률 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szansy na niewykorzystanie ładunków przez kończące uderzenia\",\n",
+                u8"    \"esMX\": \"%+d%% de probabilidad de que los ataques finales no consuman cargas\",\n",
+                u8"    \"jaJP\": \"%+d%%の確率で必殺技が使用回数を消費しなくなる\",\n",
+                u8"    \"ptBR\": \"%+d%% de chance de finalizações não consumirem cargas\",\n",
+                u8"    \"ruRU\": \"%+d%% к шансу не израсходовать заряды завершающими приемами\",\n",
+                u8"    \"zhCN\": \"%+d%% 几率终结技不消耗充能层数\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27374,\n",
+                u8"    \"Key\": \"ModStr6l\",\n",
+                u8"    \"enUS\": \"%+d%% Attack Speed\",\n",
+                u8"    \"zhTW\": \"攻擊速度 %+d%% \",\n",
+                u8"    \"deDE\": \"%+d%% Angriffsgeschwindigkeit\",\n",
+                u8"    \"esES\": \"%+d%% de velocidad de ataque\",\n",
+                u8"    \"frFR\": \"Vitesse d’attaque augmentée de %+d%%\",\n",
+                u8"    \"itIT\": \"%+d%% velocità d'attacco\",\n",
+                u8"    \"koKR\": \"공격 속도 %+d%%\",\n",
+                u8"    \"plPL\": \"%+d%% do szybkości ataku\",\n",
+                u8"    \"esMX\": \"%+d%% de velocidad de ataque\",\n",
+                u8"    \"jaJP\": \"攻撃速度+%+d%%\",\n",
+                u8"    \"ptBR\": \"%+d%% de velocidade de ataque\",\n",
+                u8"    \"ruRU\": \"%+d%% к скорости атаки\",\n",
+                u8"    \"zhCN\": \"%+d%% 攻击速度\"\n",
+                u8"  }\n",
+                u8"]\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
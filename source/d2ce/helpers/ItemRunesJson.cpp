@@ -18,4188 +18,4184 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace JsonReaderHelper
     {
-        const std::string& GetItemRunes()
+        EmbeddedText GetItemRunes()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"[\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10902,\n";
-                ss << u8"    \"Key\": \"r16\",\n";
-                ss << u8"    \"enUS\": \"Io Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：埃歐\",\n";
-                ss << u8"    \"deDE\": \"[fs]Io-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Io\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Io\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Io\",\n";
-                ss << u8"    \"koKR\": \"이오 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Io\",\n";
-                ss << u8"    \"esMX\": \"Runa Io\",\n";
-                ss << u8"    \"jaJP\": \"イオ・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Io\",\n";
-                ss << u8"    \"ruRU\": \"Руна Ио\",\n";
-                ss << u8"    \"zhCN\": \"艾欧符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10903,\n";
-                ss << u8"    \"Key\": \"r16L\",\n";
-                ss << u8"    \"enUS\": \"Io\",\n";
-                ss << u8"    \"zhTW\": \"埃歐\",\n";
-                ss << u8"    \"deDE\": \"Io\",\n";
-                ss << u8"    \"esES\": \"Io\",\n";
-                ss << u8"    \"frFR\": \"Io\",\n";
-                ss << u8"    \"itIT\": \"Io\",\n";
-                ss << u8"    \"koKR\": \"이오\",\n";
-                ss << u8"    \"plPL\": \"Io\",\n";
-                ss << u8"    \"esMX\": \"Io\",\n";
-                ss << u8"    \"jaJP\": \"イオ\",\n";
-                ss << u8"    \"ptBR\": \"Io\",\n";
-                ss << u8"    \"ruRU\": \"Ио\",\n";
-                ss << u8"    \"zhCN\": \"艾欧\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10904,\n";
-                ss << u8"    \"Key\": \"r13\",\n";
-                ss << u8"    \"enUS\": \"Shael Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：夏\",\n";
-                ss << u8"    \"deDE\": \"[fs]Shael-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Shael\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Shael\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Shael\",\n";
-                ss << u8"    \"koKR\": \"샤엘 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Shael\",\n";
-                ss << u8"    \"esMX\": \"Runa Shael\",\n";
-                ss << u8"    \"jaJP\": \"シャエル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Shael\",\n";
-                ss << u8"    \"ruRU\": \"Руна Шаэль\",\n";
-                ss << u8"    \"zhCN\": \"沙伊符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10905,\n";
-                ss << u8"    \"Key\": \"r13L\",\n";
-                ss << u8"    \"enUS\": \"Shael\",\n";
-                ss << u8"    \"zhTW\": \"夏\",\n";
-                ss << u8"    \"deDE\": \"Shael\",\n";
-                ss << u8"    \"esES\": \"Shael\",\n";
-                ss << u8"    \"frFR\": \"Shael\",\n";
-                ss << u8"    \"itIT\": \"Shael\",\n";
-                ss << u8"    \"koKR\": \"샤엘\",\n";
-                ss << u8"    \"plPL\": \"Shael\",\n";
-                ss << u8"    \"esMX\": \"Shael\",\n";
-                ss << u8"    \"jaJP\": \"シャエル\",\n";
-                ss << u8"    \"ptBR\": \"Shael\",\n";
-                ss << u8"    \"ruRU\": \"Шаэль\",\n";
-                ss << u8"    \"zhCN\": \"沙伊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10906,\n";
-                ss << u8"    \"Key\": \"r31\",\n";
-                ss << u8"    \"enUS\": \"Jah Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：喬\",\n";
-                ss << u8"    \"deDE\": \"[fs]Jah-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Jah\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Jah\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Jah\",\n";
-                ss << u8"    \"koKR\": \"자 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Jah\",\n";
-                ss << u8"    \"esMX\": \"Runa Jah\",\n";
-                ss << u8"    \"jaJP\": \"ジャー・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Jah\",\n";
-                ss << u8"    \"ruRU\": \"Руна Джа\",\n";
-                ss << u8"    \"zhCN\": \"扎哈符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10907,\n";
-                ss << u8"    \"Key\": \"r31L\",\n";
-                ss << u8"    \"enUS\": \"Jah\",\n";
-                ss << u8"    \"zhTW\": \"喬\",\n";
-                ss << u8"    \"deDE\": \"Jah\",\n";
-                ss << u8"    \"esES\": \"Jah\",\n";
-                ss << u8"    \"frFR\": \"Jah\",\n";
-                ss << u8"    \"itIT\": \"Jah\",\n";
-                ss << u8"    \"koKR\": \"자\",\n";
-                ss << u8"    \"plPL\": \"Jah\",\n";
-                ss << u8"    \"esMX\": \"Jah\",\n";
-                ss << u8"    \"jaJP\": \"ジャー\",\n";
-                ss << u8"    \"ptBR\": \"Jah\",\n";
-                ss << u8"    \"ruRU\": \"Джа\",\n";
-                ss << u8"    \"zhCN\": \"扎哈\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10910,\n";
-                ss << u8"    \"Key\": \"Runeword22\",\n";
-                ss << u8"    \"enUS\": \"Delirium\",\n";
-                ss << u8"    \"zhTW\": \"精神錯亂\",\n";
-                ss << u8"    \"deDE\": \"Delirium\",\n";
-                ss << u8"    \"esES\": \"Delirio\",\n";
-                ss << u8"    \"frFR\": \"Délire\",\n";
-                ss << u8"    \"itIT\": \"Delirio\",\n";
-                ss << u8"    \"koKR\": \"착란\",\n";
-                ss << u8"    \"plPL\": \"Delirium\",\n";
-                ss << u8"    \"esMX\": \"Delirio\",\n";
-                ss << u8"    \"jaJP\": \"デリリアム\",\n";
-                ss << u8"    \"ptBR\": \"Delírios\",\n";
-                ss << u8"    \"ruRU\": \"Бред\",\n";
-                ss << u8"    \"zhCN\": \"迷狂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20440,\n";
-                ss << u8"    \"Key\": \"r33\",\n";
-                ss << u8"    \"enUS\": \"Zod Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：薩德\",\n";
-                ss << u8"    \"deDE\": \"[fs]Zod-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Zod\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Zod\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Zod\",\n";
-                ss << u8"    \"koKR\": \"조드 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Zod\",\n";
-                ss << u8"    \"esMX\": \"Runa Zod\",\n";
-                ss << u8"    \"jaJP\": \"ゾッド・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Zod\",\n";
-                ss << u8"    \"ruRU\": \"Руна Зод\",\n";
-                ss << u8"    \"zhCN\": \"佐德符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20441,\n";
-                ss << u8"    \"Key\": \"r32\",\n";
-                ss << u8"    \"enUS\": \"Cham Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：查姆\",\n";
-                ss << u8"    \"deDE\": \"[fs]Cham-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Cham\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Cham\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Cham\",\n";
-                ss << u8"    \"koKR\": \"참 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Cham\",\n";
-                ss << u8"    \"esMX\": \"Runa Cham\",\n";
-                ss << u8"    \"jaJP\": \"チャム・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Cham\",\n";
-                ss << u8"    \"ruRU\": \"Руна Чам\",\n";
-                ss << u8"    \"zhCN\": \"查姆符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20443,\n";
-                ss << u8"    \"Key\": \"r30\",\n";
-                ss << u8"    \"enUS\": \"Ber Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：貝\",\n";
-                ss << u8"    \"deDE\": \"[fs]Ber-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Ber\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Ber\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Ber\",\n";
-                ss << u8"    \"koKR\": \"베르 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Ber\",\n";
-                ss << u8"    \"esMX\": \"Runa Ber\",\n";
-                ss << u8"    \"jaJP\": \"バー・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Ber\",\n";
-                ss << u8"    \"ruRU\": \"Руна Бер\",\n";
-                ss << u8"    \"zhCN\": \"贝符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20444,\n";
-                ss << u8"    \"Key\": \"r29\",\n";
-                ss << u8"    \"enUS\": \"Sur Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：瑟\",\n";
-                ss << u8"    \"deDE\": \"[fs]Sur-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Sur\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Sur\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Sur\",\n";
-                ss << u8"    \"koKR\": \"수르 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Sur\",\n";
-                ss << u8"    \"esMX\": \"Runa Sur\",\n";
-                ss << u8"    \"jaJP\": \"サー・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Sur\",\n";
-                ss << u8"    \"ruRU\": \"Руна Сур\",\n";
-                ss << u8"    \"zhCN\": \"瑟符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20445,\n";
-                ss << u8"    \"Key\": \"r28\",\n";
-                ss << u8"    \"enUS\": \"Lo Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：羅\",\n";
-                ss << u8"    \"deDE\": \"[fs]Lo-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Lo\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Lo\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Lo\",\n";
-                ss << u8"    \"koKR\": \"로 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Lo\",\n";
-                ss << u8"    \"esMX\": \"Runa Lo\",\n";
-                ss << u8"    \"jaJP\": \"ロー・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Lo\",\n";
-                ss << u8"    \"ruRU\": \"Руна Ло\",\n";
-                ss << u8"    \"zhCN\": \"罗符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20446,\n";
-                ss << u8"    \"Key\": \"r27\",\n";
-                ss << u8"    \"enUS\": \"Ohm Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：歐姆\",\n";
-                ss << u8"    \"deDE\": \"[fs]Ohm-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Ohm\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Ohm\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Ohm\",\n";
-                ss << u8"    \"koKR\": \"오움 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Ohm\",\n";
-                ss << u8"    \"esMX\": \"Runa Ohm\",\n";
-                ss << u8"    \"jaJP\": \"オーム・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Ohm\",\n";
-                ss << u8"    \"ruRU\": \"Руна Ом\",\n";
-                ss << u8"    \"zhCN\": \"欧姆符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20447,\n";
-                ss << u8"    \"Key\": \"r26\",\n";
-                ss << u8"    \"enUS\": \"Vex Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：伐克斯\",\n";
-                ss << u8"    \"deDE\": \"[fs]Vex-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Vex\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Vex\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Vex\",\n";
-                ss << u8"    \"koKR\": \"벡스 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Vex\",\n";
-                ss << u8"    \"esMX\": \"Runa Vex\",\n";
-                ss << u8"    \"jaJP\": \"ヴェックス・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Vex\",\n";
-                ss << u8"    \"ruRU\": \"Руна Векс\",\n";
-                ss << u8"    \"zhCN\": \"伐克斯符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20448,\n";
-                ss << u8"    \"Key\": \"r25\",\n";
-                ss << u8"    \"enUS\": \"Gul Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：古爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Gul-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Gul\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Gul\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Gul\",\n";
-                ss << u8"    \"koKR\": \"굴 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Gul\",\n";
-                ss << u8"    \"esMX\": \"Runa Gul\",\n";
-                ss << u8"    \"jaJP\": \"ガル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Gul\",\n";
-                ss << u8"    \"ruRU\": \"Руна Гул\",\n";
-                ss << u8"    \"zhCN\": \"古尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20449,\n";
-                ss << u8"    \"Key\": \"r24\",\n";
-                ss << u8"    \"enUS\": \"Ist Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：伊司特\",\n";
-                ss << u8"    \"deDE\": \"[fs]Ist-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Ist\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Ist\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Ist\",\n";
-                ss << u8"    \"koKR\": \"이스트 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Ist\",\n";
-                ss << u8"    \"esMX\": \"Runa Ist\",\n";
-                ss << u8"    \"jaJP\": \"イスト・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Ist\",\n";
-                ss << u8"    \"ruRU\": \"Руна Ист\",\n";
-                ss << u8"    \"zhCN\": \"伊司特符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20450,\n";
-                ss << u8"    \"Key\": \"r23\",\n";
-                ss << u8"    \"enUS\": \"Mal Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：馬爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Mal-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Mal\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Mal\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Mal\",\n";
-                ss << u8"    \"koKR\": \"말 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Mal\",\n";
-                ss << u8"    \"esMX\": \"Runa Mal\",\n";
-                ss << u8"    \"jaJP\": \"マル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Mal\",\n";
-                ss << u8"    \"ruRU\": \"Руна Мал\",\n";
-                ss << u8"    \"zhCN\": \"玛尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20451,\n";
-                ss << u8"    \"Key\": \"r22\",\n";
-                ss << u8"    \"enUS\": \"Um Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：烏姆\",\n";
-                ss << u8"    \"deDE\": \"[fs]Um-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Um\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Um\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Um\",\n";
-                ss << u8"    \"koKR\": \"우움 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Um\",\n";
-                ss << u8"    \"esMX\": \"Runa Um\",\n";
-                ss << u8"    \"jaJP\": \"アム・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Um\",\n";
-                ss << u8"    \"ruRU\": \"Руна Ум\",\n";
-                ss << u8"    \"zhCN\": \"乌姆符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20452,\n";
-                ss << u8"    \"Key\": \"r21\",\n";
-                ss << u8"    \"enUS\": \"Pul Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：普爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Pul-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Pul\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Pul\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Pul\",\n";
-                ss << u8"    \"koKR\": \"풀 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Pul\",\n";
-                ss << u8"    \"esMX\": \"Runa Pul\",\n";
-                ss << u8"    \"jaJP\": \"プル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Pul\",\n";
-                ss << u8"    \"ruRU\": \"Руна Пул\",\n";
-                ss << u8"    \"zhCN\": \"普尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20453,\n";
-                ss << u8"    \"Key\": \"r20\",\n";
-                ss << u8"    \"enUS\": \"Lem Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：藍姆\",\n";
-                ss << u8"    \"deDE\": \"[fs]Lem-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Lem\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Lem\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Lem\",\n";
-                ss << u8"    \"koKR\": \"렘 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Lem\",\n";
-                ss << u8"    \"esMX\": \"Runa Lem\",\n";
-                ss << u8"    \"jaJP\": \"レム・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Lem\",\n";
-                ss << u8"    \"ruRU\": \"Руна Лем\",\n";
-                ss << u8"    \"zhCN\": \"兰姆符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20454,\n";
-                ss << u8"    \"Key\": \"r19\",\n";
-                ss << u8"    \"enUS\": \"Fal Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：法爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Fal-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Fal\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Fal\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Fal\",\n";
-                ss << u8"    \"koKR\": \"팔 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Fal\",\n";
-                ss << u8"    \"esMX\": \"Runa Fal\",\n";
-                ss << u8"    \"jaJP\": \"ファル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Fal\",\n";
-                ss << u8"    \"ruRU\": \"Руна Фал\",\n";
-                ss << u8"    \"zhCN\": \"法尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20455,\n";
-                ss << u8"    \"Key\": \"r18\",\n";
-                ss << u8"    \"enUS\": \"Ko Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：科\",\n";
-                ss << u8"    \"deDE\": \"[fs]Ko-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Ko\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Ko\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Ko\",\n";
-                ss << u8"    \"koKR\": \"코 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Ko\",\n";
-                ss << u8"    \"esMX\": \"Runa Ko\",\n";
-                ss << u8"    \"jaJP\": \"コー・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Ko\",\n";
-                ss << u8"    \"ruRU\": \"Руна Ко\",\n";
-                ss << u8"    \"zhCN\": \"科符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20456,\n";
-                ss << u8"    \"Key\": \"r17\",\n";
-                ss << u8"    \"enUS\": \"Lum Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：盧姆\",\n";
-                ss << u8"    \"deDE\": \"[fs]Lum-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Lum\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Lum\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Lum\",\n";
-                ss << u8"    \"koKR\": \"룸 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Lum\",\n";
-                ss << u8"    \"esMX\": \"Runa Lum\",\n";
-                ss << u8"    \"jaJP\": \"ラム・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Lum\",\n";
-                ss << u8"    \"ruRU\": \"Руна Лум\",\n";
-                ss << u8"    \"zhCN\": \"卢姆符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20458,\n";
-                ss << u8"    \"Key\": \"r15\",\n";
-                ss << u8"    \"enUS\": \"Hel Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：海爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Hel-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Hel\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Hel\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Hel\",\n";
-                ss << u8"    \"koKR\": \"헬 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Hel\",\n";
-                ss << u8"    \"esMX\": \"Runa Hel\",\n";
-                ss << u8"    \"jaJP\": \"ヘル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Hel\",\n";
-                ss << u8"    \"ruRU\": \"Руна Хел\",\n";
-                ss << u8"    \"zhCN\": \"海尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20459,\n";
-                ss << u8"    \"Key\": \"r14\",\n";
-                ss << u8"    \"enUS\": \"Dol Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：多爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Dol-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Dol\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Dol\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Dol\",\n";
-                ss << u8"    \"koKR\": \"돌 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Dol\",\n";
-                ss << u8"    \"esMX\": \"Runa Dol\",\n";
-                ss << u8"    \"jaJP\": \"ドル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Dol\",\n";
-                ss << u8"    \"ruRU\": \"Руна Дол\",\n";
-                ss << u8"    \"zhCN\": \"多尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20461,\n";
-                ss << u8"    \"Key\": \"r12\",\n";
-                ss << u8"    \"enUS\": \"Sol Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：索爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Sol-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Sol\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Sol\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Sol\",\n";
-                ss << u8"    \"koKR\": \"솔 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Sol\",\n";
-                ss << u8"    \"esMX\": \"Runa Sol\",\n";
-                ss << u8"    \"jaJP\": \"ソル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Sol\",\n";
-                ss << u8"    \"ruRU\": \"Руна Сол\",\n";
-                ss << u8"    \"zhCN\": \"索尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20462,\n";
-                ss << u8"    \"Key\": \"r11\",\n";
-                ss << u8"    \"enUS\": \"Amn Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：安姆\",\n";
-                ss << u8"    \"deDE\": \"[fs]Amn-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Amn\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Amn\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Amn\",\n";
-                ss << u8"    \"koKR\": \"앰 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Amn\",\n";
-                ss << u8"    \"esMX\": \"Runa Amn\",\n";
-                ss << u8"    \"jaJP\": \"アムン・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Amn\",\n";
-                ss << u8"    \"ruRU\": \"Руна Амн\",\n";
-                ss << u8"    \"zhCN\": \"安姆符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20463,\n";
-                ss << u8"    \"Key\": \"r10\",\n";
-                ss << u8"    \"enUS\": \"Thul Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：書爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Thul-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Thul\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Thul\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Thul\",\n";
-                ss << u8"    \"koKR\": \"주울 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Thul\",\n";
-                ss << u8"    \"esMX\": \"Runa Thul\",\n";
-                ss << u8"    \"jaJP\": \"スル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Thul\",\n";
-                ss << u8"    \"ruRU\": \"Руна Тул\",\n";
-                ss << u8"    \"zhCN\": \"图尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20464,\n";
-                ss << u8"    \"Key\": \"r09\",\n";
-                ss << u8"    \"enUS\": \"Ort Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：歐特\",\n";
-                ss << u8"    \"deDE\": \"[fs]Ort-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Ort\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Ort\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Ort\",\n";
-                ss << u8"    \"koKR\": \"오르트 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Ort\",\n";
-                ss << u8"    \"esMX\": \"Runa Ort\",\n";
-                ss << u8"    \"jaJP\": \"オルト・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Ort\",\n";
-                ss << u8"    \"ruRU\": \"Руна Орт\",\n";
-                ss << u8"    \"zhCN\": \"欧特符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20465,\n";
-                ss << u8"    \"Key\": \"r08\",\n";
-                ss << u8"    \"enUS\": \"Ral Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：拉爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Ral-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Ral\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Ral\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Ral\",\n";
-                ss << u8"    \"koKR\": \"랄 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Ral\",\n";
-                ss << u8"    \"esMX\": \"Runa Ral\",\n";
-                ss << u8"    \"jaJP\": \"ラル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Ral\",\n";
-                ss << u8"    \"ruRU\": \"Руна Рал\",\n";
-                ss << u8"    \"zhCN\": \"拉尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20466,\n";
-                ss << u8"    \"Key\": \"r07\",\n";
-                ss << u8"    \"enUS\": \"Tal Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：塔爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Tal-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Tal\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Tal\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Tal\",\n";
-                ss << u8"    \"koKR\": \"탈 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Tal\",\n";
-                ss << u8"    \"esMX\": \"Runa Tal\",\n";
-                ss << u8"    \"jaJP\": \"タル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Tal\",\n";
-                ss << u8"    \"ruRU\": \"Руна Тал\",\n";
-                ss << u8"    \"zhCN\": \"塔尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20467,\n";
-                ss << u8"    \"Key\": \"r06\",\n";
-                ss << u8"    \"enUS\": \"Ith Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：伊司\",\n";
-                ss << u8"    \"deDE\": \"[fs]Ith-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Ith\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Ith\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Ith\",\n";
-                ss << u8"    \"koKR\": \"아이드 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Ith\",\n";
-                ss << u8"    \"esMX\": \"Runa Ith\",\n";
-                ss << u8"    \"jaJP\": \"イス・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Ith\",\n";
-                ss << u8"    \"ruRU\": \"Руна Ит\",\n";
-                ss << u8"    \"zhCN\": \"伊司符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20468,\n";
-                ss << u8"    \"Key\": \"r05\",\n";
-                ss << u8"    \"enUS\": \"Eth Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：愛斯\",\n";
-                ss << u8"    \"deDE\": \"[fs]Eth-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Eth\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Eth\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Eth\",\n";
-                ss << u8"    \"koKR\": \"에드 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Eth\",\n";
-                ss << u8"    \"esMX\": \"Runa Eth\",\n";
-                ss << u8"    \"jaJP\": \"エス・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Eth\",\n";
-                ss << u8"    \"ruRU\": \"Руна Эт\",\n";
-                ss << u8"    \"zhCN\": \"艾斯符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20469,\n";
-                ss << u8"    \"Key\": \"r04\",\n";
-                ss << u8"    \"enUS\": \"Nef Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：那夫\",\n";
-                ss << u8"    \"deDE\": \"[fs]Nef-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Nef\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Nef\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Nef\",\n";
-                ss << u8"    \"koKR\": \"네프 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Nef\",\n";
-                ss << u8"    \"esMX\": \"Runa Nef\",\n";
-                ss << u8"    \"jaJP\": \"ネフ・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Nef\",\n";
-                ss << u8"    \"ruRU\": \"Руна Неф\",\n";
-                ss << u8"    \"zhCN\": \"奈夫符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20470,\n";
-                ss << u8"    \"Key\": \"r03\",\n";
-                ss << u8"    \"enUS\": \"Tir Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：特爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]Tir-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Tir\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Tir\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Tir\",\n";
-                ss << u8"    \"koKR\": \"티르 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Tir\",\n";
-                ss << u8"    \"esMX\": \"Runa Tir\",\n";
-                ss << u8"    \"jaJP\": \"ティア・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Tir\",\n";
-                ss << u8"    \"ruRU\": \"Руна Тир\",\n";
-                ss << u8"    \"zhCN\": \"提尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20471,\n";
-                ss << u8"    \"Key\": \"r02\",\n";
-                ss << u8"    \"enUS\": \"Eld Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：艾德\",\n";
-                ss << u8"    \"deDE\": \"[fs]Eld-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa Eld\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune Eld\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa Eld\",\n";
-                ss << u8"    \"koKR\": \"엘드 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa Eld\",\n";
-                ss << u8"    \"esMX\": \"Runa Eld\",\n";
-                ss << u8"    \"jaJP\": \"エルド・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa Eld\",\n";
-                ss << u8"    \"ruRU\": \"Руна Элд\",\n";
-                ss << u8"    \"zhCN\": \"艾德符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20472,\n";
-                ss << u8"    \"Key\": \"r01\",\n";
-                ss << u8"    \"enUS\": \"El Rune\",\n";
-                ss << u8"    \"zhTW\": \"符文：艾爾\",\n";
-                ss << u8"    \"deDE\": \"[fs]El-Rune\",\n";
-                ss << u8"    \"esES\": \"Runa El\",\n";
-                ss << u8"    \"frFR\": \"[fs]Rune El\",\n";
-                ss << u8"    \"itIT\": \"[fs]Runa El\",\n";
-                ss << u8"    \"koKR\": \"엘 룬\",\n";
-                ss << u8"    \"plPL\": \"Runa El\",\n";
-                ss << u8"    \"esMX\": \"Runa El\",\n";
-                ss << u8"    \"jaJP\": \"エル・ルーン\",\n";
-                ss << u8"    \"ptBR\": \"Runa El\",\n";
-                ss << u8"    \"ruRU\": \"Руна Эль\",\n";
-                ss << u8"    \"zhCN\": \"艾尔符文\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20473,\n";
-                ss << u8"    \"Key\": \"r33L\",\n";
-                ss << u8"    \"enUS\": \"Zod\",\n";
-                ss << u8"    \"zhTW\": \"薩德\",\n";
-                ss << u8"    \"deDE\": \"Zod\",\n";
-                ss << u8"    \"esES\": \"Zod\",\n";
-                ss << u8"    \"frFR\": \"Zod\",\n";
-                ss << u8"    \"itIT\": \"Zod\",\n";
-                ss << u8"    \"koKR\": \"조드\",\n";
-                ss << u8"    \"plPL\": \"Zod\",\n";
-                ss << u8"    \"esMX\": \"Zod\",\n";
-                ss << u8"    \"jaJP\": \"ゾッド\",\n";
-                ss << u8"    \"ptBR\": \"Zod\",\n";
-                ss << u8"    \"ruRU\": \"Зод\",\n";
-                ss << u8"    \"zhCN\": \"佐德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20474,\n";
-                ss << u8"    \"Key\": \"r32L\",\n";
-                ss << u8"    \"enUS\": \"Cham\",\n";
-                ss << u8"    \"zhTW\": \"查姆\",\n";
-                ss << u8"    \"deDE\": \"Cham\",\n";
-                ss << u8"    \"esES\": \"Cham\",\n";
-                ss << u8"    \"frFR\": \"Cham\",\n";
-                ss << u8"    \"itIT\": \"Cham\",\n";
-                ss << u8"    \"koKR\": \"참\",\n";
-                ss << u8"    \"plPL\": \"Cham\",\n";
-                ss << u8"    \"esMX\": \"Cham\",\n";
-                ss << u8"    \"jaJP\": \"チャム\",\n";
-                ss << u8"    \"ptBR\": \"Cham\",\n";
-                ss << u8"    \"ruRU\": \"Чам\",\n";
-                ss << u8"    \"zhCN\": \"查姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20476,\n";
-                ss << u8"    \"Key\": \"r30L\",\n";
-                ss << u8"    \"enUS\": \"Ber\",\n";
-                ss << u8"    \"zhTW\": \"貝\",\n";
-                ss << u8"    \"deDE\": \"Ber\",\n";
-                ss << u8"    \"esES\": \"Ber\",\n";
-                ss << u8"    \"frFR\": \"Ber\",\n";
-                ss << u8"    \"itIT\": \"Ber\",\n";
-                ss << u8"    \"koKR\": \"베르\",\n";
-                ss << u8"    \"plPL\": \"Ber\",\n";
-                ss << u8"    \"esMX\": \"Ber\",\n";
-                ss << u8"    \"jaJP\": \"バー\",\n";
-                ss << u8"    \"ptBR\": \"Ber\",\n";
-                ss << u8"    \"ruRU\": \"Бер\",\n";
-                ss << u8"    \"zhCN\": \"贝\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20477,\n";
-                ss << u8"    \"Key\": \"r29L\",\n";
-                ss << u8"    \"enUS\": \"Sur\",\n";
-                ss << u8"    \"zhTW\": \"瑟\",\n";
-                ss << u8"    \"deDE\": \"Sur\",\n";
-                ss << u8"    \"esES\": \"Sur\",\n";
-                ss << u8"    \"frFR\": \"Sur\",\n";
-                ss << u8"    \"itIT\": \"Sur\",\n";
-                ss << u8"    \"koKR\": \"수르\",\n";
-                ss << u8"    \"plPL\": \"Sur\",\n";
-                ss << u8"    \"esMX\": \"Sur\",\n";
-                ss << u8"    \"jaJP\": \"サー\",\n";
-                ss << u8"    \"ptBR\": \"Sur\",\n";
-                ss << u8"    \"ruRU\": \"Сур\",\n";
-                ss << u8"    \"zhCN\": \"瑟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20478,\n";
-                ss << u8"    \"Key\": \"r28L\",\n";
-                ss << u8"    \"enUS\": \"Lo\",\n";
-                ss << u8"    \"zhTW\": \"羅\",\n";
-                ss << u8"    \"deDE\": \"Lo\",\n";
-                ss << u8"    \"esES\": \"Lo\",\n";
-                ss << u8"    \"frFR\": \"Lo\",\n";
-                ss << u8"    \"itIT\": \"Lo\",\n";
-                ss << u8"    \"koKR\": \"로\",\n";
-                ss << u8"    \"plPL\": \"Lo\",\n";
-                ss << u8"    \"esMX\": \"Lo\",\n";
-                ss << u8"    \"jaJP\": \"ロー\",\n";
-                ss << u8"    \"ptBR\": \"Lo\",\n";
-                ss << u8"    \"ruRU\": \"Ло\",\n";
-                ss << u8"    \"zhCN\": \"罗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20479,\n";
-                ss << u8"    \"Key\": \"r27L\",\n";
-                ss << u8"    \"enUS\": \"Ohm\",\n";
-                ss << u8"    \"zhTW\": \"歐姆\",\n";
-                ss << u8"    \"deDE\": \"Ohm\",\n";
-                ss << u8"    \"esES\": \"Ohm\",\n";
-                ss << u8"    \"frFR\": \"Ohm\",\n";
-                ss << u8"    \"itIT\": \"Ohm\",\n";
-                ss << u8"    \"koKR\": \"오움\",\n";
-                ss << u8"    \"plPL\": \"Ohm\",\n";
-                ss << u8"    \"esMX\": \"Ohm\",\n";
-                ss << u8"    \"jaJP\": \"オーム\",\n";
-                ss << u8"    \"ptBR\": \"Ohm\",\n";
-                ss << u8"    \"ruRU\": \"Ом\",\n";
-                ss << u8"    \"zhCN\": \"欧姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20480,\n";
-                ss << u8"    \"Key\": \"r26L\",\n";
-                ss << u8"    \"enUS\": \"Vex\",\n";
-                ss << u8"    \"zhTW\": \"伐克斯\",\n";
-                ss << u8"    \"deDE\": \"Vex\",\n";
-                ss << u8"    \"esES\": \"Vex\",\n";
-                ss << u8"    \"frFR\": \"Vex\",\n";
-                ss << u8"    \"itIT\": \"Vex\",\n";
-                ss << u8"    \"koKR\": \"벡스\",\n";
-                ss << u8"    \"plPL\": \"Vex\",\n";
-                ss << u8"    \"esMX\": \"Vex\",\n";
-                ss << u8"    \"jaJP\": \"ヴェックス\",\n";
-                ss << u8"    \"ptBR\": \"Vex\",\n";
-                ss << u8"    \"ruRU\": \"Векс\",\n";
-                ss << u8"    \"zhCN\": \"伐克斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20481,\n";
-                ss << u8"    \"Key\": \"r25L\",\n";
-                ss << u8"    \"enUS\": \"Gul\",\n";
-                ss << u8"    \"zhTW\": \"古爾\",\n";
-                ss << u8"    \"deDE\": \"Gul\",\n";
-                ss << u8"    \"esES\": \"Gul\",\n";
-                ss << u8"    \"frFR\": \"Gul\",\n";
-                ss << u8"    \"itIT\": \"Gul\",\n";
-                ss << u8"    \"koKR\": \"굴\",\n";
-                ss << u8"    \"plPL\": \"Gul\",\n";
-                ss << u8"    \"esMX\": \"Gul\",\n";
-                ss << u8"    \"jaJP\": \"ガル\",\n";
-                ss << u8"    \"ptBR\": \"Gul\",\n";
-                ss << u8"    \"ruRU\": \"Гул\",\n";
-                ss << u8"    \"zhCN\": \"古尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20482,\n";
-                ss << u8"    \"Key\": \"r24L\",\n";
-                ss << u8"    \"enUS\": \"Ist\",\n";
-                ss << u8"    \"zhTW\": \"伊司特\",\n";
-                ss << u8"    \"deDE\": \"Ist\",\n";
-                ss << u8"    \"esES\": \"Ist\",\n";
-                ss << u8"    \"frFR\": \"Ist\",\n";
-                ss << u8"    \"itIT\": \"Ist\",\n";
-                ss << u8"    \"koKR\": \"이스트\",\n";
-                ss << u8"    \"plPL\": \"Ist\",\n";
-                ss << u8"    \"esMX\": \"Ist\",\n";
-                ss << u8"    \"jaJP\": \"イスト\",\n";
-                ss << u8"    \"ptBR\": \"Ist\",\n";
-                ss << u8"    \"ruRU\": \"Ист\",\n";
-                ss << u8"    \"zhCN\": \"伊司特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20483,\n";
-                ss << u8"    \"Key\": \"r23L\",\n";
-                ss << u8"    \"enUS\": \"Mal\",\n";
-                ss << u8"    \"zhTW\": \"馬爾\",\n";
-                ss << u8"    \"deDE\": \"Mal\",\n";
-                ss << u8"    \"esES\": \"Mal\",\n";
-                ss << u8"    \"frFR\": \"Mal\",\n";
-                ss << u8"    \"itIT\": \"Mal\",\n";
-                ss << u8"    \"koKR\": \"말\",\n";
-                ss << u8"    \"plPL\": \"Mal\",\n";
-                ss << u8"    \"esMX\": \"Mal\",\n";
-                ss << u8"    \"jaJP\": \"マル\",\n";
-                ss << u8"    \"ptBR\": \"Mal\",\n";
-                ss << u8"    \"ruRU\": \"Мал\",\n";
-                ss << u8"    \"zhCN\": \"玛尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20484,\n";
-                ss << u8"    \"Key\": \"r22L\",\n";
-                ss << u8"    \"enUS\": \"Um\",\n";
-                ss << u8"    \"zhTW\": \"烏姆\",\n";
-                ss << u8"    \"deDE\": \"Um\",\n";
-                ss << u8"    \"esES\": \"Um\",\n";
-                ss << u8"    \"frFR\": \"Um\",\n";
-                ss << u8"    \"itIT\": \"Um\",\n";
-                ss << u8"    \"koKR\": \"우움\",\n";
-                ss << u8"    \"plPL\": \"Um\",\n";
-                ss << u8"    \"esMX\": \"Um\",\n";
-                ss << u8"    \"jaJP\": \"アム\",\n";
-                ss << u8"    \"ptBR\": \"Um\",\n";
-                ss << u8"    \"ruRU\": \"Ум\",\n";
-                ss << u8"    \"zhCN\": \"乌姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20485,\n";
-                ss << u8"    \"Key\": \"r21L\",\n";
-                ss << u8"    \"enUS\": \"Pul\",\n";
-                ss << u8"    \"zhTW\": \"普爾\",\n";
-                ss << u8"    \"deDE\": \"Pul\",\n";
-                ss << u8"    \"esES\": \"Pul\",\n";
-                ss << u8"    \"frFR\": \"Pul\",\n";
-                ss << u8"    \"itIT\": \"Pul\",\n";
-                ss << u8"    \"koKR\": \"풀\",\n";
-                ss << u8"    \"plPL\": \"Pul\",\n";
-                ss << u8"    \"esMX\": \"Pul\",\n";
-                ss << u8"    \"jaJP\": \"プル\",\n";
-                ss << u8"    \"ptBR\": \"Pul\",\n";
-                ss << u8"    \"ruRU\": \"Пул\",\n";
-                ss << u8"    \"zhCN\": \"普尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20486,\n";
-                ss << u8"    \"Key\": \"r20L\",\n";
-                ss << u8"    \"enUS\": \"Lem\",\n";
-                ss << u8"    \"zhTW\": \"藍姆\",\n";
-                ss << u8"    \"deDE\": \"Lem\",\n";
-                ss << u8"    \"esES\": \"Lem\",\n";
-                ss << u8"    \"frFR\": \"Lem\",\n";
-                ss << u8"    \"itIT\": \"Lem\",\n";
-                ss << u8"    \"koKR\": \"렘\",\n";
-                ss << u8"    \"plPL\": \"Lem\",\n";
-                ss << u8"    \"esMX\": \"Lem\",\n";
-                ss << u8"    \"jaJP\": \"レム\",\n";
-                ss << u8"    \"ptBR\": \"Lem\",\n";
-                ss << u8"    \"ruRU\": \"Лем\",\n";
-                ss << u8"    \"zhCN\": \"兰姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20487,\n";
-                ss << u8"    \"Key\": \"r19L\",\n";
-                ss << u8"    \"enUS\": \"Fal\",\n";
-                ss << u8"    \"zhTW\": \"法爾\",\n";
-                ss << u8"    \"deDE\": \"Fal\",\n";
-                ss << u8"    \"esES\": \"Fal\",\n";
-                ss << u8"    \"frFR\": \"Fal\",\n";
-                ss << u8"    \"itIT\": \"Fal\",\n";
-                ss << u8"    \"koKR\": \"팔\",\n";
-                ss << u8"    \"plPL\": \"Fal\",\n";
-                ss << u8"    \"esMX\": \"Fal\",\n";
-                ss << u8"    \"jaJP\": \"ファル\",\n";
-                ss << u8"    \"ptBR\": \"Fal\",\n";
-                ss << u8"    \"ruRU\": \"Фал\",\n";
-                ss << u8"    \"zhCN\": \"法尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20488,\n";
-                ss << u8"    \"Key\": \"r18L\",\n";
-                ss << u8"    \"enUS\": \"Ko\",\n";
-                ss << u8"    \"zhTW\": \"科\",\n";
-                ss << u8"    \"deDE\": \"Ko\",\n";
-                ss << u8"    \"esES\": \"Ko\",\n";
-                ss << u8"    \"frFR\": \"Ko\",\n";
-                ss << u8"    \"itIT\": \"Ko\",\n";
-                ss << u8"    \"koKR\": \"코\",\n";
-                ss << u8"    \"plPL\": \"Ko\",\n";
-                ss << u8"    \"esMX\": \"Ko\",\n";
-                ss << u8"    \"jaJP\": \"コー\",\n";
-                ss << u8"    \"ptBR\": \"Ko\",\n";
-                ss << u8"    \"ruRU\": \"Ко\",\n";
-                ss << u8"    \"zhCN\": \"科\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20489,\n";
-                ss << u8"    \"Key\": \"r17L\",\n";
-                ss << u8"    \"enUS\": \"Lum\",\n";
-                ss << u8"    \"zhTW\": \"盧姆\",\n";
-                ss << u8"    \"deDE\": \"Lum\",\n";
-                ss << u8"    \"esES\": \"Lum\",\n";
-                ss << u8"    \"frFR\": \"Lum\",\n";
-                ss << u8"    \"itIT\": \"Lum\",\n";
-                ss << u8"    \"koKR\": \"룸\",\n";
-                ss << u8"    \"plPL\": \"Lum\",\n";
-                ss << u8"    \"esMX\": \"Lum\",\n";
-                ss << u8"    \"jaJP\": \"ラム\",\n";
-                ss << u8"    \"ptBR\": \"Lum\",\n";
-                ss << u8"    \"ruRU\": \"Лум\",\n";
-                ss << u8"    \"zhCN\": \"卢姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20491,\n";
-                ss << u8"    \"Key\": \"r15L\",\n";
-                ss << u8"    \"enUS\": \"Hel\",\n";
-                ss << u8"    \"zhTW\": \"海爾\",\n";
-                ss << u8"    \"deDE\": \"Hel\",\n";
-                ss << u8"    \"esES\": \"Hel\",\n";
-                ss << u8"    \"frFR\": \"Hel\",\n";
-                ss << u8"    \"itIT\": \"Hel\",\n";
-                ss << u8"    \"koKR\": \"헬\",\n";
-                ss << u8"    \"plPL\": \"Hel\",\n";
-                ss << u8"    \"esMX\": \"Hel\",\n";
-                ss << u8"    \"jaJP\": \"ヘル\",\n";
-                ss << u8"    \"ptBR\": \"Hel\",\n";
-                ss << u8"    \"ruRU\": \"Хел\",\n";
-                ss << u8"    \"zhCN\": \"海尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20492,\n";
-                ss << u8"    \"Key\": \"r14L\",\n";
-                ss << u8"    \"enUS\": \"Dol\",\n";
-                ss << u8"    \"zhTW\": \"多爾\",\n";
-                ss << u8"    \"deDE\": \"Dol\",\n";
-                ss << u8"    \"esES\": \"Dol\",\n";
-                ss << u8"    \"frFR\": \"Dol\",\n";
-                ss << u8"    \"itIT\": \"Dol\",\n";
-                ss << u8"    \"koKR\": \"돌\",\n";
-                ss << u8"    \"plPL\": \"Dol\",\n";
-                ss << u8"    \"esMX\": \"Dol\",\n";
-                ss << u8"    \"jaJP\": \"ドル\",\n";
-                ss << u8"    \"ptBR\": \"Dol\",\n";
-                ss << u8"    \"ruRU\": \"Дол\",\n";
-                ss << u8"    \"zhCN\": \"多尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20494,\n";
-                ss << u8"    \"Key\": \"r12L\",\n";
-                ss << u8"    \"enUS\": \"Sol\",\n";
-                ss << u8"    \"zhTW\": \"索爾\",\n";
-                ss << u8"    \"deDE\": \"Sol\",\n";
-                ss << u8"    \"esES\": \"Sol\",\n";
-                ss << u8"    \"frFR\": \"Sol\",\n";
-                ss << u8"    \"itIT\": \"Sol\",\n";
-                ss << u8"    \"koKR\": \"솔\",\n";
-                ss << u8"    \"plPL\": \"Sol\",\n";
-                ss << u8"    \"esMX\": \"Sol\",\n";
-                ss << u8"    \"jaJP\": \"ソル\",\n";
-                ss << u8"    \"ptBR\": \"Sol\",\n";
-                ss << u8"    \"ruRU\": \"Сол\",\n";
-                ss << u8"    \"zhCN\": \"索尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20495,\n";
-                ss << u8"    \"Key\": \"r11L\",\n";
-                ss << u8"    \"enUS\": \"Amn\",\n";
-                ss << u8"    \"zhTW\": \"安姆\",\n";
-                ss << u8"    \"deDE\": \"Amn\",\n";
-                ss << u8"    \"esES\": \"Amn\",\n";
-                ss << u8"    \"frFR\": \"Amn\",\n";
-                ss << u8"    \"itIT\": \"Amn\",\n";
-                ss << u8"    \"koKR\": \"앰\",\n";
-                ss << u8"    \"plPL\": \"Amn\",\n";
-                ss << u8"    \"esMX\": \"Amn\",\n";
-                ss << u8"    \"jaJP\": \"アムン\",\n";
-                ss << u8"    \"ptBR\": \"Amn\",\n";
-                ss << u8"    \"ruRU\": \"Амн\",\n";
-                ss << u8"    \"zhCN\": \"安姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20496,\n";
-                ss << u8"    \"Key\": \"r10L\",\n";
-                ss << u8"    \"enUS\": \"Thul\",\n";
-                ss << u8"    \"zhTW\": \"書爾\",\n";
-                ss << u8"    \"deDE\": \"Thul\",\n";
-                ss << u8"    \"esES\": \"Thul\",\n";
-                ss << u8"    \"frFR\": \"Thul\",\n";
-                ss << u8"    \"itIT\": \"Thul\",\n";
-                ss << u8"    \"koKR\": \"주울\",\n";
-                ss << u8"    \"plPL\": \"Thul\",\n";
-                ss << u8"    \"esMX\": \"Thul\",\n";
-                ss << u8"    \"jaJP\": \"スル\",\n";
-                ss << u8"    \"ptBR\": \"Thul\",\n";
-                ss << u8"    \"ruRU\": \"Тул\",\n";
-                ss << u8"    \"zhCN\": \"图尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20497,\n";
-                ss << u8"    \"Key\": \"r09L\",\n";
-                ss << u8"    \"enUS\": \"Ort\",\n";
-                ss << u8"    \"zhTW\": \"歐特\",\n";
-                ss << u8"    \"deDE\": \"Ort\",\n";
-                ss << u8"    \"esES\": \"Ort\",\n";
-                ss << u8"    \"frFR\": \"Ort\",\n";
-                ss << u8"    \"itIT\": \"Ort\",\n";
-                ss << u8"    \"koKR\": \"오르트\",\n";
-                ss << u8"    \"plPL\": \"Ort\",\n";
-                ss << u8"    \"esMX\": \"Ort\",\n";
-                ss << u8"    \"jaJP\": \"オルト\",\n";
-                ss << u8"    \"ptBR\": \"Ort\",\n";
-                ss << u8"    \"ruRU\": \"Орт\",\n";
-                ss << u8"    \"zhCN\": \"欧特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20498,\n";
-                ss << u8"    \"Key\": \"r08L\",\n";
-                ss << u8"    \"enUS\": \"Ral\",\n";
-                ss << u8"    \"zhTW\": \"拉爾\",\n";
-                ss << u8"    \"deDE\": \"Ral\",\n";
-                ss << u8"    \"esES\": \"Ral\",\n";
-                ss << u8"    \"frFR\": \"Ral\",\n";
-                ss << u8"    \"itIT\": \"Ral\",\n";
-                ss << u8"    \"koKR\": \"랄\",\n";
-                ss << u8"    \"plPL\": \"Ral\",\n";
-                ss << u8"    \"esMX\": \"Ral\",\n";
-                ss << u8"    \"jaJP\": \"ラル\",\n";
-                ss << u8"    \"ptBR\": \"Ral\",\n";
-                ss << u8"    \"ruRU\": \"Рал\",\n";
-                ss << u8"    \"zhCN\": \"拉尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20499,\n";
-                ss << u8"    \"Key\": \"r07L\",\n";
-                ss << u8"    \"enUS\": \"Tal\",\n";
-                ss << u8"    \"zhTW\": \"塔爾\",\n";
-                ss << u8"    \"deDE\": \"Tal\",\n";
-                ss << u8"    \"esES\": \"Tal\",\n";
-                ss << u8"    \"frFR\": \"Tal\",\n";
-                ss << u8"    \"itIT\": \"Tal\",\n";
-                ss << u8"    \"koKR\": \"탈\",\n";
-                ss << u8"    \"plPL\": \"Tal\",\n";
-                ss << u8"    \"esMX\": \"Tal\",\n";
-                ss << u8"    \"jaJP\": \"タル\",\n";
-                ss << u8"    \"ptBR\": \"Tal\",\n";
-                ss << u8"    \"ruRU\": \"Тал\",\n";
-                ss << u8"    \"zhCN\": \"塔尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20500,\n";
-                ss << u8"    \"Key\": \"r06L\",\n";
-                ss << u8"    \"enUS\": \"Ith\",\n";
-                ss << u8"    \"zhTW\": \"伊司\",\n";
-                ss << u8"    \"deDE\": \"Ith\",\n";
-                ss << u8"    \"esES\": \"Ith\",\n";
-                ss << u8"    \"frFR\": \"Ith\",\n";
-                ss << u8"    \"itIT\": \"Ith\",\n";
-                ss << u8"    \"koKR\": \"아이드\",\n";
-                ss << u8"    \"plPL\": \"Ith\",\n";
-                ss << u8"    \"esMX\": \"Ith\",\n";
-                ss << u8"    \"jaJP\": \"イス\",\n";
-                ss << u8"    \"ptBR\": \"Ith\",\n";
-                ss << u8"    \"ruRU\": \"Ит\",\n";
-                ss << u8"    \"zhCN\": \"伊司\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20501,\n";
-                ss << u8"    \"Key\": \"r05L\",\n";
-                ss << u8"    \"enUS\": \"Eth\",\n";
-                ss << u8"    \"zhTW\": \"愛斯\",\n";
-                ss << u8"    \"deDE\": \"Eth\",\n";
-                ss << u8"    \"esES\": \"Eth\",\n";
-                ss << u8"    \"frFR\": \"Eth\",\n";
-                ss << u8"    \"itIT\": \"Eth\",\n";
-                ss << u8"    \"koKR\": \"에드\",\n";
-                ss << u8"    \"plPL\": \"Eth\",\n";
-                ss << u8"    \"esMX\": \"Eth\",\n";
-                ss << u8"    \"jaJP\": \"エス\",\n";
-                ss << u8"    \"ptBR\": \"Eth\",\n";
-                ss << u8"    \"ruRU\": \"Эт\",\n";
-                ss << u8"    \"zhCN\": \"艾斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20502,\n";
-                ss << u8"    \"Key\": \"r04L\",\n";
-                ss << u8"    \"enUS\": \"Nef\",\n";
-                ss << u8"    \"zhTW\": \"那夫\",\n";
-                ss << u8"    \"deDE\": \"Nef\",\n";
-                ss << u8"    \"esES\": \"Nef\",\n";
-                ss << u8"    \"frFR\": \"Nef\",\n";
-                ss << u8"    \"itIT\": \"Nef\",\n";
-                ss << u8"    \"koKR\": \"네프\",\n";
-                ss << u8"    \"plPL\": \"Nef\",\n";
-                ss << u8"    \"esMX\": \"Nef\",\n";
-                ss << u8"    \"jaJP\": \"ネフ\",\n";
-                ss << u8"    \"ptBR\": \"Nef\",\n";
-                ss << u8"    \"ruRU\": \"Неф\",\n";
-                ss << u8"    \"zhCN\": \"奈夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20503,\n";
-                ss << u8"    \"Key\": \"r03L\",\n";
-                ss << u8"    \"enUS\": \"Tir\",\n";
-                ss << u8"    \"zhTW\": \"特爾\",\n";
-                ss << u8"    \"deDE\": \"Tir\",\n";
-                ss << u8"    \"esES\": \"Tir\",\n";
-                ss << u8"    \"frFR\": \"Tir\",\n";
-                ss << u8"    \"itIT\": \"Tir\",\n";
-                ss << u8"    \"koKR\": \"티르\",\n";
-                ss << u8"    \"plPL\": \"Tir\",\n";
-                ss << u8"    \"esMX\": \"Tir\",\n";
-                ss << u8"    \"jaJP\": \"ティア\",\n";
-                ss << u8"    \"ptBR\": \"Tir\",\n";
-                ss << u8"    \"ruRU\": \"Тир\",\n";
-                ss << u8"    \"zhCN\": \"提尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20504,\n";
-                ss << u8"    \"Key\": \"r02L\",\n";
-                ss << u8"    \"enUS\": \"Eld\",\n";
-                ss << u8"    \"zhTW\": \"艾德\",\n";
-                ss << u8"    \"deDE\": \"Eld\",\n";
-                ss << u8"    \"esES\": \"Eld\",\n";
-                ss << u8"    \"frFR\": \"Eld\",\n";
-                ss << u8"    \"itIT\": \"Eld\",\n";
-                ss << u8"    \"koKR\": \"엘드\",\n";
-                ss << u8"    \"plPL\": \"Eld\",\n";
-                ss << u8"    \"esMX\": \"Eld\",\n";
-                ss << u8"    \"jaJP\": \"エルド\",\n";
-                ss << u8"    \"ptBR\": \"Eld\",\n";
-                ss << u8"    \"ruRU\": \"Элд\",\n";
-                ss << u8"    \"zhCN\": \"艾德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20505,\n";
-                ss << u8"    \"Key\": \"r01L\",\n";
-                ss << u8"    \"enUS\": \"El\",\n";
-                ss << u8"    \"zhTW\": \"艾爾\",\n";
-                ss << u8"    \"deDE\": \"El\",\n";
-                ss << u8"    \"esES\": \"El\",\n";
-                ss << u8"    \"frFR\": \"El\",\n";
-                ss << u8"    \"itIT\": \"El\",\n";
-                ss << u8"    \"koKR\": \"엘\",\n";
-                ss << u8"    \"plPL\": \"El\",\n";
-                ss << u8"    \"esMX\": \"El\",\n";
-                ss << u8"    \"jaJP\": \"エル\",\n";
-                ss << u8"    \"ptBR\": \"El\",\n";
-                ss << u8"    \"ruRU\": \"Эль\",\n";
-                ss << u8"    \"zhCN\": \"艾尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20506,\n";
-                ss << u8"    \"Key\": \"RuneQuote\",\n";
-                ss << u8"    \"enUS\": \"'\",\n";
-                ss << u8"    \"zhTW\": \"'\",\n";
-                ss << u8"    \"deDE\": \"'\",\n";
-                ss << u8"    \"esES\": \"'\",\n";
-                ss << u8"    \"frFR\": \"\",\n";
-                ss << u8"    \"itIT\": \"'\",\n";
-                ss << u8"    \"koKR\": \"'\",\n";
-                ss << u8"    \"plPL\": \"'\",\n";
-                ss << u8"    \"esMX\": \"'\",\n";
-                ss << u8"    \"jaJP\": \"'\",\n";
-                ss << u8"    \"ptBR\": \"\\\"\",\n";
-                ss << u8"    \"ruRU\": \"'\",\n";
-                ss << u8"    \"zhCN\": \"'\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20507,\n";
-                ss << u8"    \"Key\": \"Runeword1\",\n";
-                ss << u8"    \"enUS\": \"Ancients' Pledge\",\n";
-                ss << u8"    \"zhTW\": \"先祖之契\",\n";
-                ss << u8"    \"deDE\": \"Schwur der Urahnen\",\n";
-                ss << u8"    \"esES\": \"Promesa de los Antiguos\",\n";
-                ss << u8"    \"frFR\": \"Anathème des Anciens\",\n";
-                ss << u8"    \"itIT\": \"Pegno degli Antichi\",\n";
-                ss << u8"    \"koKR\": \"고대인의 서약\",\n";
-                ss << u8"    \"plPL\": \"Przysięga Starożytnych\",\n";
-                ss << u8"    \"esMX\": \"Juramento de los ancestros\",\n";
-                ss << u8"    \"jaJP\": \"古の民の誓約\",\n";
-                ss << u8"    \"ptBR\": \"Promessa dos Ancestrais\",\n";
-                ss << u8"    \"ruRU\": \"Клятва Древних\",\n";
-                ss << u8"    \"zhCN\": \"先祖之誓\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20508,\n";
-                ss << u8"    \"Key\": \"Runeword2\",\n";
-                ss << u8"    \"enUS\": \"Armageddon\",\n";
-                ss << u8"    \"zhTW\": \"毀天滅地\",\n";
-                ss << u8"    \"deDE\": \"Armageddon\",\n";
-                ss << u8"    \"esES\": \"Armagedón\",\n";
-                ss << u8"    \"frFR\": \"Armageddon\",\n";
-                ss << u8"    \"itIT\": \"Armageddon\",\n";
-                ss << u8"    \"koKR\": \"대전쟁\",\n";
-                ss << u8"    \"plPL\": \"Armagedon\",\n";
-                ss << u8"    \"esMX\": \"Armagedón\",\n";
-                ss << u8"    \"jaJP\": \"天変地異\",\n";
-                ss << u8"    \"ptBR\": \"Armagedom\",\n";
-                ss << u8"    \"ruRU\": \"Армагеддон\",\n";
-                ss << u8"    \"zhCN\": \"末日\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20509,\n";
-                ss << u8"    \"Key\": \"Runeword3\",\n";
-                ss << u8"    \"enUS\": \"Authority\",\n";
-                ss << u8"    \"zhTW\": \"權威\",\n";
-                ss << u8"    \"deDE\": \"Macht\",\n";
-                ss << u8"    \"esES\": \"Autoridad\",\n";
-                ss << u8"    \"frFR\": \"Autorité\",\n";
-                ss << u8"    \"itIT\": \"Autorità\",\n";
-                ss << u8"    \"koKR\": \"권위\",\n";
-                ss << u8"    \"plPL\": \"Władza\",\n";
-                ss << u8"    \"esMX\": \"Autoridad\",\n";
-                ss << u8"    \"jaJP\": \"権威\",\n";
-                ss << u8"    \"ptBR\": \"Autoridade\",\n";
-                ss << u8"    \"ruRU\": \"Власть\",\n";
-                ss << u8"    \"zhCN\": \"权威\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20510,\n";
-                ss << u8"    \"Key\": \"Runeword4\",\n";
-                ss << u8"    \"enUS\": \"Beast\",\n";
-                ss << u8"    \"zhTW\": \"野獸\",\n";
-                ss << u8"    \"deDE\": \"Bestie\",\n";
-                ss << u8"    \"esES\": \"Bestia\",\n";
-                ss << u8"    \"frFR\": \"Bête\",\n";
-                ss << u8"    \"itIT\": \"Bestia\",\n";
-                ss << u8"    \"koKR\": \"야수\",\n";
-                ss << u8"    \"plPL\": \"Bestia\",\n";
-                ss << u8"    \"esMX\": \"Bestia\",\n";
-                ss << u8"    \"jaJP\": \"獣\",\n";
-                ss << u8"    \"ptBR\": \"Fera\",\n";
-                ss << u8"    \"ruRU\": \"Зверь\",\n";
-                ss << u8"    \"zhCN\": \"野兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20511,\n";
-                ss << u8"    \"Key\": \"Runeword5\",\n";
-                ss << u8"    \"enUS\": \"Beauty\",\n";
-                ss << u8"    \"zhTW\": \"美貌\",\n";
-                ss << u8"    \"deDE\": \"Schönheit\",\n";
-                ss << u8"    \"esES\": \"Belleza\",\n";
-                ss << u8"    \"frFR\": \"Beauté\",\n";
-                ss << u8"    \"itIT\": \"Bellezza\",\n";
-                ss << u8"    \"koKR\": \"아름다움\",\n";
-                ss << u8"    \"plPL\": \"Piękno\",\n";
-                ss << u8"    \"esMX\": \"Belleza\",\n";
-                ss << u8"    \"jaJP\": \"美\",\n";
-                ss << u8"    \"ptBR\": \"Beleza\",\n";
-                ss << u8"    \"ruRU\": \"Красота\",\n";
-                ss << u8"    \"zhCN\": \"美丽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20512,\n";
-                ss << u8"    \"Key\": \"Runeword6\",\n";
-                ss << u8"    \"enUS\": \"Black\",\n";
-                ss << u8"    \"zhTW\": \"黑錘\",\n";
-                ss << u8"    \"deDE\": \"Schwärze\",\n";
-                ss << u8"    \"esES\": \"Negrura\",\n";
-                ss << u8"    \"frFR\": \"Noir\",\n";
-                ss << u8"    \"itIT\": \"Nero\",\n";
-                ss << u8"    \"koKR\": \"어둠\",\n";
-                ss << u8"    \"plPL\": \"Czerń\",\n";
-                ss << u8"    \"esMX\": \"Opaco\",\n";
-                ss << u8"    \"jaJP\": \"黒\",\n";
-                ss << u8"    \"ptBR\": \"Ébano\",\n";
-                ss << u8"    \"ruRU\": \"Мрак\",\n";
-                ss << u8"    \"zhCN\": \"黑色\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20513,\n";
-                ss << u8"    \"Key\": \"Runeword7\",\n";
-                ss << u8"    \"enUS\": \"Blood\",\n";
-                ss << u8"    \"zhTW\": \"鮮血\",\n";
-                ss << u8"    \"deDE\": \"Blut\",\n";
-                ss << u8"    \"esES\": \"Sangre\",\n";
-                ss << u8"    \"frFR\": \"Sang\",\n";
-                ss << u8"    \"itIT\": \"Sangue\",\n";
-                ss << u8"    \"koKR\": \"피\",\n";
-                ss << u8"    \"plPL\": \"Krew\",\n";
-                ss << u8"    \"esMX\": \"Sangre\",\n";
-                ss << u8"    \"jaJP\": \"血\",\n";
-                ss << u8"    \"ptBR\": \"Sangue\",\n";
-                ss << u8"    \"ruRU\": \"Кровь\",\n";
-                ss << u8"    \"zhCN\": \"鲜血\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20514,\n";
-                ss << u8"    \"Key\": \"Runeword8\",\n";
-                ss << u8"    \"enUS\": \"Bone\",\n";
-                ss << u8"    \"zhTW\": \"骸骨\",\n";
-                ss << u8"    \"deDE\": \"Knochen\",\n";
-                ss << u8"    \"esES\": \"Hueso\",\n";
-                ss << u8"    \"frFR\": \"Os\",\n";
-                ss << u8"    \"itIT\": \"Ossa\",\n";
-                ss << u8"    \"koKR\": \"뼈\",\n";
-                ss << u8"    \"plPL\": \"Kość\",\n";
-                ss << u8"    \"esMX\": \"Hueso\",\n";
-                ss << u8"    \"jaJP\": \"骨\",\n";
-                ss << u8"    \"ptBR\": \"Osso\",\n";
-                ss << u8"    \"ruRU\": \"Кость\",\n";
-                ss << u8"    \"zhCN\": \"白骨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20515,\n";
-                ss << u8"    \"Key\": \"Runeword9\",\n";
-                ss << u8"    \"enUS\": \"Bramble\",\n";
-                ss << u8"    \"zhTW\": \"刺藤\",\n";
-                ss << u8"    \"deDE\": \"Dornen\",\n";
-                ss << u8"    \"esES\": \"Zarza\",\n";
-                ss << u8"    \"frFR\": \"Barbelé\",\n";
-                ss << u8"    \"itIT\": \"Roveto\",\n";
-                ss << u8"    \"koKR\": \"찔레\",\n";
-                ss << u8"    \"plPL\": \"Kolec\",\n";
-                ss << u8"    \"esMX\": \"Zarza\",\n";
-                ss << u8"    \"jaJP\": \"茨\",\n";
-                ss << u8"    \"ptBR\": \"Espinho\",\n";
-                ss << u8"    \"ruRU\": \"Терновник\",\n";
-                ss << u8"    \"zhCN\": \"荆棘\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20516,\n";
-                ss << u8"    \"Key\": \"Runeword10\",\n";
-                ss << u8"    \"enUS\": \"Brand\",\n";
-                ss << u8"    \"zhTW\": \"烙印\",\n";
-                ss << u8"    \"deDE\": \"Brand\",\n";
-                ss << u8"    \"esES\": \"Tizón\",\n";
-                ss << u8"    \"frFR\": \"Balafre\",\n";
-                ss << u8"    \"itIT\": \"Marchio\",\n";
-                ss << u8"    \"koKR\": \"낙인\",\n";
-                ss << u8"    \"plPL\": \"Piętno\",\n";
-                ss << u8"    \"esMX\": \"Marca\",\n";
-                ss << u8"    \"jaJP\": \"烙印\",\n";
-                ss << u8"    \"ptBR\": \"Marca\",\n";
-                ss << u8"    \"ruRU\": \"Тавро\",\n";
-                ss << u8"    \"zhCN\": \"烙印\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20517,\n";
-                ss << u8"    \"Key\": \"Runeword11\",\n";
-                ss << u8"    \"enUS\": \"Breath of the Dying\",\n";
-                ss << u8"    \"zhTW\": \"死亡呼吸\",\n";
-                ss << u8"    \"deDE\": \"Odem der Sterbenden\",\n";
-                ss << u8"    \"esES\": \"Aliento de los muertos\",\n";
-                ss << u8"    \"frFR\": \"Souffle des mourants\",\n";
-                ss << u8"    \"itIT\": \"Ultimo Respiro\",\n";
-                ss << u8"    \"koKR\": \"죽어가는 자의 숨결\",\n";
-                ss << u8"    \"plPL\": \"Ostatni Oddech\",\n";
-                ss << u8"    \"esMX\": \"Aliento de los moribundos\",\n";
-                ss << u8"    \"jaJP\": \"死の吐息\",\n";
-                ss << u8"    \"ptBR\": \"Sopro da Morbidez\",\n";
-                ss << u8"    \"ruRU\": \"Вздох умирающего\",\n";
-                ss << u8"    \"zhCN\": \"濒死之息\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20518,\n";
-                ss << u8"    \"Key\": \"Runeword12\",\n";
-                ss << u8"    \"enUS\": \"Broken Promise\",\n";
-                ss << u8"    \"zhTW\": \"破碎誓言\",\n";
-                ss << u8"    \"deDE\": \"Gebrochenes Versprechen\",\n";
-                ss << u8"    \"esES\": \"Promesa rota\",\n";
-                ss << u8"    \"frFR\": \"Promesse rompue\",\n";
-                ss << u8"    \"itIT\": \"Promessa Spezzata\",\n";
-                ss << u8"    \"koKR\": \"깨어진 약속\",\n";
-                ss << u8"    \"plPL\": \"Złamana Obietnica\",\n";
-                ss << u8"    \"esMX\": \"Promesa rota\",\n";
-                ss << u8"    \"jaJP\": \"背約\",\n";
-                ss << u8"    \"ptBR\": \"Promessa Quebrada\",\n";
-                ss << u8"    \"ruRU\": \"Нарушенный обет\",\n";
-                ss << u8"    \"zhCN\": \"破碎誓言\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20519,\n";
-                ss << u8"    \"Key\": \"Runeword13\",\n";
-                ss << u8"    \"enUS\": \"Call to Arms\",\n";
-                ss << u8"    \"zhTW\": \"戰爭召喚\",\n";
-                ss << u8"    \"deDE\": \"Ruf zu den Waffen\",\n";
-                ss << u8"    \"esES\": \"Llamada a las armas\",\n";
-                ss << u8"    \"frFR\": \"Cri de ralliement\",\n";
-                ss << u8"    \"itIT\": \"Chiamata alle Armi\",\n";
-                ss << u8"    \"koKR\": \"소집\",\n";
-                ss << u8"    \"plPL\": \"Wezwanie do Broni\",\n";
-                ss << u8"    \"esMX\": \"Llamado a las armas\",\n";
-                ss << u8"    \"jaJP\": \"召集\",\n";
-                ss << u8"    \"ptBR\": \"Chamado às Armas\",\n";
-                ss << u8"    \"ruRU\": \"Призыв к оружию\",\n";
-                ss << u8"    \"zhCN\": \"战争召唤\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20520,\n";
-                ss << u8"    \"Key\": \"Runeword14\",\n";
-                ss << u8"    \"enUS\": \"Chains of Honor\",\n";
-                ss << u8"    \"zhTW\": \"榮耀之鍊\",\n";
-                ss << u8"    \"deDE\": \"Ketten der Ehre\",\n";
-                ss << u8"    \"esES\": \"Cadenas de honor\",\n";
-                ss << u8"    \"frFR\": \"Chaînes de l’honneur\",\n";
-                ss << u8"    \"itIT\": \"Catene dell'Onore\",\n";
-                ss << u8"    \"koKR\": \"명예의 굴레\",\n";
-                ss << u8"    \"plPL\": \"Okowy Honoru\",\n";
-                ss << u8"    \"esMX\": \"Cadenas de honor\",\n";
-                ss << u8"    \"jaJP\": \"名誉の連鎖\",\n";
-                ss << u8"    \"ptBR\": \"Correntes da Honra\",\n";
-                ss << u8"    \"ruRU\": \"Цепи чести\",\n";
-                ss << u8"    \"zhCN\": \"荣耀之链\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20521,\n";
-                ss << u8"    \"Key\": \"Runeword15\",\n";
-                ss << u8"    \"enUS\": \"Chance\",\n";
-                ss << u8"    \"zhTW\": \"機會\",\n";
-                ss << u8"    \"deDE\": \"Zufall\",\n";
-                ss << u8"    \"esES\": \"Casualidad\",\n";
-                ss << u8"    \"frFR\": \"Chance\",\n";
-                ss << u8"    \"itIT\": \"Probabilità\",\n";
-                ss << u8"    \"koKR\": \"기회\",\n";
-                ss << u8"    \"plPL\": \"Szansa\",\n";
-                ss << u8"    \"esMX\": \"Azar\",\n";
-                ss << u8"    \"jaJP\": \"好機\",\n";
-                ss << u8"    \"ptBR\": \"Chance\",\n";
-                ss << u8"    \"ruRU\": \"Шанс\",\n";
-                ss << u8"    \"zhCN\": \"机遇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20522,\n";
-                ss << u8"    \"Key\": \"Runeword16\",\n";
-                ss << u8"    \"enUS\": \"Chaos\",\n";
-                ss << u8"    \"zhTW\": \"混沌\",\n";
-                ss << u8"    \"deDE\": \"Chaos\",\n";
-                ss << u8"    \"esES\": \"Caos\",\n";
-                ss << u8"    \"frFR\": \"Chaos\",\n";
-                ss << u8"    \"itIT\": \"Caos\",\n";
-                ss << u8"    \"koKR\": \"혼돈\",\n";
-                ss << u8"    \"plPL\": \"Chaos\",\n";
-                ss << u8"    \"esMX\": \"Caos\",\n";
-                ss << u8"    \"jaJP\": \"混沌\",\n";
-                ss << u8"    \"ptBR\": \"Caos\",\n";
-                ss << u8"    \"ruRU\": \"Хаос\",\n";
-                ss << u8"    \"zhCN\": \"混沌\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20523,\n";
-                ss << u8"    \"Key\": \"Runeword17\",\n";
-                ss << u8"    \"enUS\": \"Crescent Moon\",\n";
-                ss << u8"    \"zhTW\": \"新月\",\n";
-                ss << u8"    \"deDE\": \"Mondsichel\",\n";
-                ss << u8"    \"esES\": \"Luna creciente\",\n";
-                ss << u8"    \"frFR\": \"Croissant de lune\",\n";
-                ss << u8"    \"itIT\": \"Falce di Luna\",\n";
-                ss << u8"    \"koKR\": \"초승달\",\n";
-                ss << u8"    \"plPL\": \"Sierp Księżyca\",\n";
-                ss << u8"    \"esMX\": \"Luna creciente\",\n";
-                ss << u8"    \"jaJP\": \"三日月\",\n";
-                ss << u8"    \"ptBR\": \"Lua Crescente\",\n";
-                ss << u8"    \"ruRU\": \"Полумесяц\",\n";
-                ss << u8"    \"zhCN\": \"新月\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20524,\n";
-                ss << u8"    \"Key\": \"Runeword18\",\n";
-                ss << u8"    \"enUS\": \"Darkness\",\n";
-                ss << u8"    \"zhTW\": \"黑暗\",\n";
-                ss << u8"    \"deDE\": \"Dunkelheit\",\n";
-                ss << u8"    \"esES\": \"Oscuridad\",\n";
-                ss << u8"    \"frFR\": \"Ténèbres\",\n";
-                ss << u8"    \"itIT\": \"Oscurità\",\n";
-                ss << u8"    \"koKR\": \"암흑\",\n";
-                ss << u8"    \"plPL\": \"Ciemność\",\n";
-                ss << u8"    \"esMX\": \"Oscuridad\",\n";
-                ss << u8"    \"jaJP\": \"暗闇\",\n";
-                ss << u8"    \"ptBR\": \"Escuridão\",\n";
-                ss << u8"    \"ruRU\": \"Тьма\",\n";
-                ss << u8"    \"zhCN\": \"黑暗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20525,\n";
-                ss << u8"    \"Key\": \"Runeword19\",\n";
-                ss << u8"    \"enUS\": \"Daylight\",\n";
-                ss << u8"    \"zhTW\": \"白晝\",\n";
-                ss << u8"    \"deDE\": \"Tageslicht\",\n";
-                ss << u8"    \"esES\": \"Luz\",\n";
-                ss << u8"    \"frFR\": \"Divine lumière\",\n";
-                ss << u8"    \"itIT\": \"Luce del Giorno\",\n";
-                ss << u8"    \"koKR\": \"햇빛\",\n";
-                ss << u8"    \"plPL\": \"Światło Dnia\",\n";
-                ss << u8"    \"esMX\": \"Luz del día\",\n";
-                ss << u8"    \"jaJP\": \"夜明け\",\n";
-                ss << u8"    \"ptBR\": \"Luz do Dia\",\n";
-                ss << u8"    \"ruRU\": \"Ясный день\",\n";
-                ss << u8"    \"zhCN\": \"白昼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20526,\n";
-                ss << u8"    \"Key\": \"Runeword20\",\n";
-                ss << u8"    \"enUS\": \"Death\",\n";
-                ss << u8"    \"zhTW\": \"死神\",\n";
-                ss << u8"    \"deDE\": \"Tod\",\n";
-                ss << u8"    \"esES\": \"Muerte\",\n";
-                ss << u8"    \"frFR\": \"Décès\",\n";
-                ss << u8"    \"itIT\": \"Morte\",\n";
-                ss << u8"    \"koKR\": \"죽음\",\n";
-                ss << u8"    \"plPL\": \"Śmierć\",\n";
-                ss << u8"    \"esMX\": \"Muerte\",\n";
-                ss << u8"    \"jaJP\": \"死\",\n";
-                ss << u8"    \"ptBR\": \"Morte\",\n";
-                ss << u8"    \"ruRU\": \"Смерть\",\n";
-                ss << u8"    \"zhCN\": \"死亡\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20527,\n";
-                ss << u8"    \"Key\": \"Runeword21\",\n";
-                ss << u8"    \"enUS\": \"Deception\",\n";
-                ss << u8"    \"zhTW\": \"欺暪\",\n";
-                ss << u8"    \"deDE\": \"Täuschung\",\n";
-                ss << u8"    \"esES\": \"Engaño\",\n";
-                ss << u8"    \"frFR\": \"Duperie\",\n";
-                ss << u8"    \"itIT\": \"Inganno\",\n";
-                ss << u8"    \"koKR\": \"기만\",\n";
-                ss << u8"    \"plPL\": \"Podstęp\",\n";
-                ss << u8"    \"esMX\": \"Decepción\",\n";
-                ss << u8"    \"jaJP\": \"欺瞞\",\n";
-                ss << u8"    \"ptBR\": \"Engano\",\n";
-                ss << u8"    \"ruRU\": \"Обман\",\n";
-                ss << u8"    \"zhCN\": \"欺骗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20529,\n";
-                ss << u8"    \"Key\": \"Runeword23\",\n";
-                ss << u8"    \"enUS\": \"Desire\",\n";
-                ss << u8"    \"zhTW\": \"渴望\",\n";
-                ss << u8"    \"deDE\": \"Begierde\",\n";
-                ss << u8"    \"esES\": \"Deseo\",\n";
-                ss << u8"    \"frFR\": \"Désir\",\n";
-                ss << u8"    \"itIT\": \"Desiderio\",\n";
-                ss << u8"    \"koKR\": \"욕망\",\n";
-                ss << u8"    \"plPL\": \"Pożądanie\",\n";
-                ss << u8"    \"esMX\": \"Deseo\",\n";
-                ss << u8"    \"jaJP\": \"欲望\",\n";
-                ss << u8"    \"ptBR\": \"Desejo\",\n";
-                ss << u8"    \"ruRU\": \"Желание\",\n";
-                ss << u8"    \"zhCN\": \"欲望\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20530,\n";
-                ss << u8"    \"Key\": \"Runeword24\",\n";
-                ss << u8"    \"enUS\": \"Despair\",\n";
-                ss << u8"    \"zhTW\": \"絕望\",\n";
-                ss << u8"    \"deDE\": \"Verzweiflung\",\n";
-                ss << u8"    \"esES\": \"Desesperación\",\n";
-                ss << u8"    \"frFR\": \"Désespoir\",\n";
-                ss << u8"    \"itIT\": \"Disperazione\",\n";
-                ss << u8"    \"koKR\": \"절망\",\n";
-                ss << u8"    \"plPL\": \"Rozpacz\",\n";
-                ss << u8"    \"esMX\": \"Desesperación\",\n";
-                ss << u8"    \"jaJP\": \"絶望\",\n";
-                ss << u8"    \"ptBR\": \"Desespero\",\n";
-                ss << u8"    \"ruRU\": \"Отчаяние\",\n";
-                ss << u8"    \"zhCN\": \"绝望\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20531,\n";
-                ss << u8"    \"Key\": \"Runeword25\",\n";
-                ss << u8"    \"enUS\": \"Destruction\",\n";
-                ss << u8"    \"zhTW\": \"毀滅\",\n";
-                ss << u8"    \"deDE\": \"Zerstörung\",\n";
-                ss << u8"    \"esES\": \"Destrucción\",\n";
-                ss << u8"    \"frFR\": \"Destruction\",\n";
-                ss << u8"    \"itIT\": \"Distruzione\",\n";
-                ss << u8"    \"koKR\": \"파괴\",\n";
-                ss << u8"    \"plPL\": \"Zniszczenie\",\n";
-                ss << u8"    \"esMX\": \"Destrucción\",\n";
-                ss << u8"    \"jaJP\": \"破壊\",\n";
-                ss << u8"    \"ptBR\": \"Destruição\",\n";
-                ss << u8"    \"ruRU\": \"Разрушение\",\n";
-                ss << u8"    \"zhCN\": \"毁灭\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20532,\n";
-                ss << u8"    \"Key\": \"Runeword26\",\n";
-                ss << u8"    \"enUS\": \"Doom\",\n";
-                ss << u8"    \"zhTW\": \"末日\",\n";
-                ss << u8"    \"deDE\": \"Verdammnis\",\n";
-                ss << u8"    \"esES\": \"Fatalidad\",\n";
-                ss << u8"    \"frFR\": \"Dévastation\",\n";
-                ss << u8"    \"itIT\": \"Rovina\",\n";
-                ss << u8"    \"koKR\": \"파멸\",\n";
-                ss << u8"    \"plPL\": \"Zagłada\",\n";
-                ss << u8"    \"esMX\": \"Calamidad\",\n";
-                ss << u8"    \"jaJP\": \"破滅\",\n";
-                ss << u8"    \"ptBR\": \"Perdição\",\n";
-                ss << u8"    \"ruRU\": \"Гибель\",\n";
-                ss << u8"    \"zhCN\": \"厄运\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20533,\n";
-                ss << u8"    \"Key\": \"Runeword27\",\n";
-                ss << u8"    \"enUS\": \"Dragon\",\n";
-                ss << u8"    \"zhTW\": \"飛龍\",\n";
-                ss << u8"    \"deDE\": \"Drachen\",\n";
-                ss << u8"    \"esES\": \"Dragón\",\n";
-                ss << u8"    \"frFR\": \"Dragon\",\n";
-                ss << u8"    \"itIT\": \"Drago\",\n";
-                ss << u8"    \"koKR\": \"용\",\n";
-                ss << u8"    \"plPL\": \"Smok\",\n";
-                ss << u8"    \"esMX\": \"Dragón\",\n";
-                ss << u8"    \"jaJP\": \"ドラゴン\",\n";
-                ss << u8"    \"ptBR\": \"Dragão\",\n";
-                ss << u8"    \"ruRU\": \"Дракон\",\n";
-                ss << u8"    \"zhCN\": \"巨龙\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20534,\n";
-                ss << u8"    \"Key\": \"Runeword28\",\n";
-                ss << u8"    \"enUS\": \"Dread\",\n";
-                ss << u8"    \"zhTW\": \"恐懼\",\n";
-                ss << u8"    \"deDE\": \"Schrecken\",\n";
-                ss << u8"    \"esES\": \"Pavor\",\n";
-                ss << u8"    \"frFR\": \"Défiance\",\n";
-                ss << u8"    \"itIT\": \"Terrore\",\n";
-                ss << u8"    \"koKR\": \"두려움\",\n";
-                ss << u8"    \"plPL\": \"Strach\",\n";
-                ss << u8"    \"esMX\": \"Temor\",\n";
-                ss << u8"    \"jaJP\": \"戦慄\",\n";
-                ss << u8"    \"ptBR\": \"Pavor\",\n";
-                ss << u8"    \"ruRU\": \"Ужас\",\n";
-                ss << u8"    \"zhCN\": \"惊惧\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20535,\n";
-                ss << u8"    \"Key\": \"Runeword29\",\n";
-                ss << u8"    \"enUS\": \"Dream\",\n";
-                ss << u8"    \"zhTW\": \"夢境\",\n";
-                ss << u8"    \"deDE\": \"Traum\",\n";
-                ss << u8"    \"esES\": \"Sueño\",\n";
-                ss << u8"    \"frFR\": \"Rêve\",\n";
-                ss << u8"    \"itIT\": \"Sogno\",\n";
-                ss << u8"    \"koKR\": \"꿈\",\n";
-                ss << u8"    \"plPL\": \"Sen\",\n";
-                ss << u8"    \"esMX\": \"Sueño\",\n";
-                ss << u8"    \"jaJP\": \"夢\",\n";
-                ss << u8"    \"ptBR\": \"Sonho\",\n";
-                ss << u8"    \"ruRU\": \"Видение\",\n";
-                ss << u8"    \"zhCN\": \"梦境\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20536,\n";
-                ss << u8"    \"Key\": \"Runeword30\",\n";
-                ss << u8"    \"enUS\": \"Duress\",\n";
-                ss << u8"    \"zhTW\": \"強制\",\n";
-                ss << u8"    \"deDE\": \"Nötigung\",\n";
-                ss << u8"    \"esES\": \"Coacción\",\n";
-                ss << u8"    \"frFR\": \"Domination\",\n";
-                ss << u8"    \"itIT\": \"Coercizione\",\n";
-                ss << u8"    \"koKR\": \"협박\",\n";
-                ss << u8"    \"plPL\": \"Przymus\",\n";
-                ss << u8"    \"esMX\": \"Coerción\",\n";
-                ss << u8"    \"jaJP\": \"威圧\",\n";
-                ss << u8"    \"ptBR\": \"Coerção\",\n";
-                ss << u8"    \"ruRU\": \"Принуждение\",\n";
-                ss << u8"    \"zhCN\": \"强压\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20537,\n";
-                ss << u8"    \"Key\": \"Runeword31\",\n";
-                ss << u8"    \"enUS\": \"Edge\",\n";
-                ss << u8"    \"zhTW\": \"邊緣\",\n";
-                ss << u8"    \"deDE\": \"Schneide\",\n";
-                ss << u8"    \"esES\": \"Filo\",\n";
-                ss << u8"    \"frFR\": \"Arête\",\n";
-                ss << u8"    \"itIT\": \"Lama\",\n";
-                ss << u8"    \"koKR\": \"모서리\",\n";
-                ss << u8"    \"plPL\": \"Ostrze\",\n";
-                ss << u8"    \"esMX\": \"Filo\",\n";
-                ss << u8"    \"jaJP\": \"刃\",\n";
-                ss << u8"    \"ptBR\": \"Gume\",\n";
-                ss << u8"    \"ruRU\": \"Острие\",\n";
-                ss << u8"    \"zhCN\": \"锐锋\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20538,\n";
-                ss << u8"    \"Key\": \"Runeword32\",\n";
-                ss << u8"    \"enUS\": \"Elation\",\n";
-                ss << u8"    \"zhTW\": \"興高彩烈\",\n";
-                ss << u8"    \"deDE\": \"Erregung\",\n";
-                ss << u8"    \"esES\": \"Júbilo\",\n";
-                ss << u8"    \"frFR\": \"Effusion\",\n";
-                ss << u8"    \"itIT\": \"Esultanza\",\n";
-                ss << u8"    \"koKR\": \"득의\",\n";
-                ss << u8"    \"plPL\": \"Radość\",\n";
-                ss << u8"    \"esMX\": \"Euforia\",\n";
-                ss << u8"    \"jaJP\": \"高揚\",\n";
-                ss << u8"    \"ptBR\": \"Euforia\",\n";
-                ss << u8"    \"ruRU\": \"Воодушевление\",\n";
-                ss << u8"    \"zhCN\": \"欢欣\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20539,\n";
-                ss << u8"    \"Key\": \"Runeword33\",\n";
-                ss << u8"    \"enUS\": \"Enigma\",\n";
-                ss << u8"    \"zhTW\": \"謎團\",\n";
-                ss << u8"    \"deDE\": \"Rätsel\",\n";
-                ss << u8"    \"esES\": \"Enigma\",\n";
-                ss << u8"    \"frFR\": \"Énigme\",\n";
-                ss << u8"    \"itIT\": \"Enigma\",\n";
-                ss << u8"    \"koKR\": \"수수께끼\",\n";
-                ss << u8"    \"plPL\": \"Enigma\",\n";
-                ss << u8"    \"esMX\": \"Enigma\",\n";
-                ss << u8"    \"jaJP\": \"不知\",\n";
-                ss << u8"    \"ptBR\": \"Enigma\",\n";
-                ss << u8"    \"ruRU\": \"Тайна\",\n";
-                ss << u8"    \"zhCN\": \"谜团\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20540,\n";
-                ss << u8"    \"Key\": \"Runeword34\",\n";
-                ss << u8"    \"enUS\": \"Enlightenment\",\n";
-                ss << u8"    \"zhTW\": \"教化\",\n";
-                ss << u8"    \"deDE\": \"Erleuchtung\",\n";
-                ss << u8"    \"esES\": \"Ilustración\",\n";
-                ss << u8"    \"frFR\": \"Éclaircissement\",\n";
-                ss << u8"    \"itIT\": \"Illuminazione\",\n";
-                ss << u8"    \"koKR\": \"깨우침\",\n";
-                ss << u8"    \"plPL\": \"Oświecenie\",\n";
-                ss << u8"    \"esMX\": \"Iluminación\",\n";
-                ss << u8"    \"jaJP\": \"悟り\",\n";
-                ss << u8"    \"ptBR\": \"Iluminação\",\n";
-                ss << u8"    \"ruRU\": \"Просветление\",\n";
-                ss << u8"    \"zhCN\": \"启迪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20541,\n";
-                ss << u8"    \"Key\": \"Runeword35\",\n";
-                ss << u8"    \"enUS\": \"Envy\",\n";
-                ss << u8"    \"zhTW\": \"羨慕\",\n";
-                ss << u8"    \"deDE\": \"Neid\",\n";
-                ss << u8"    \"esES\": \"Envidia\",\n";
-                ss << u8"    \"frFR\": \"Envie\",\n";
-                ss << u8"    \"itIT\": \"Invidia\",\n";
-                ss << u8"    \"koKR\": \"시기\",\n";
-                ss << u8"    \"plPL\": \"Zawiść\",\n";
-                ss << u8"    \"esMX\": \"Envidia\",\n";
-                ss << u8"    \"jaJP\": \"羨望\",\n";
-                ss << u8"    \"ptBR\": \"Inveja\",\n";
-                ss << u8"    \"ruRU\": \"Зависть\",\n";
-                ss << u8"    \"zhCN\": \"羡慕\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20542,\n";
-                ss << u8"    \"Key\": \"Runeword36\",\n";
-                ss << u8"    \"enUS\": \"Eternity\",\n";
-                ss << u8"    \"zhTW\": \"永恆\",\n";
-                ss << u8"    \"deDE\": \"Ewigkeit\",\n";
-                ss << u8"    \"esES\": \"Eternidad\",\n";
-                ss << u8"    \"frFR\": \"Éternité\",\n";
-                ss << u8"    \"itIT\": \"Eternità\",\n";
-                ss << u8"    \"koKR\": \"영원\",\n";
-                ss << u8"    \"plPL\": \"Wieczność\",\n";
-                ss << u8"    \"esMX\": \"Eternidad\",\n";
-                ss << u8"    \"jaJP\": \"永遠\",\n";
-                ss << u8"    \"ptBR\": \"Eternidade\",\n";
-                ss << u8"    \"ruRU\": \"Вечность\",\n";
-                ss << u8"    \"zhCN\": \"永恒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20543,\n";
-                ss << u8"    \"Key\": \"Runeword37\",\n";
-                ss << u8"    \"enUS\": \"Exile\",\n";
-                ss << u8"    \"zhTW\": \"流亡\",\n";
-                ss << u8"    \"deDE\": \"Exil\",\n";
-                ss << u8"    \"esES\": \"Exilio\",\n";
-                ss << u8"    \"frFR\": \"Exil\",\n";
-                ss << u8"    \"itIT\": \"Esilio\",\n";
-                ss << u8"    \"koKR\": \"추방\",\n";
-                ss << u8"    \"plPL\": \"Wygnanie\",\n";
-                ss << u8"    \"esMX\": \"Exilio\",\n";
-                ss << u8"    \"jaJP\": \"追放\",\n";
-                ss << u8"    \"ptBR\": \"Exílio\",\n";
-                ss << u8"    \"ruRU\": \"Изгнание\",\n";
-                ss << u8"    \"zhCN\": \"流放\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20544,\n";
-                ss << u8"    \"Key\": \"Runeword38\",\n";
-                ss << u8"    \"enUS\": \"Faith\",\n";
-                ss << u8"    \"zhTW\": \"信心\",\n";
-                ss << u8"    \"deDE\": \"Glaube\",\n";
-                ss << u8"    \"esES\": \"Fe\",\n";
-                ss << u8"    \"frFR\": \"Foi\",\n";
-                ss << u8"    \"itIT\": \"Fede\",\n";
-                ss << u8"    \"koKR\": \"신념\",\n";
-                ss << u8"    \"plPL\": \"Wiara\",\n";
-                ss << u8"    \"esMX\": \"Fe\",\n";
-                ss << u8"    \"jaJP\": \"信念\",\n";
-                ss << u8"    \"ptBR\": \"Fé\",\n";
-                ss << u8"    \"ruRU\": \"Вера\",\n";
-                ss << u8"    \"zhCN\": \"信念\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20545,\n";
-                ss << u8"    \"Key\": \"Runeword39\",\n";
-                ss << u8"    \"enUS\": \"Famine\",\n";
-                ss << u8"    \"zhTW\": \"饑荒\",\n";
-                ss << u8"    \"deDE\": \"Hungersnot\",\n";
-                ss << u8"    \"esES\": \"Hambruna\",\n";
-                ss << u8"    \"frFR\": \"Famine\",\n";
-                ss << u8"    \"itIT\": \"Carestia\",\n";
-                ss << u8"    \"koKR\": \"기근\",\n";
-                ss << u8"    \"plPL\": \"Wygłodzenie\",\n";
-                ss << u8"    \"esMX\": \"Hambruna\",\n";
-                ss << u8"    \"jaJP\": \"飢饉\",\n";
-                ss << u8"    \"ptBR\": \"Penúria\",\n";
-                ss << u8"    \"ruRU\": \"Голод\",\n";
-                ss << u8"    \"zhCN\": \"饥荒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20546,\n";
-                ss << u8"    \"Key\": \"Runeword40\",\n";
-                ss << u8"    \"enUS\": \"Flickering Flame\",\n";
-                ss << u8"    \"zhTW\": \"閃爍火焰\",\n";
-                ss << u8"    \"deDE\": \"Flamme\",\n";
-                ss << u8"    \"esES\": \"Llama trémula\",\n";
-                ss << u8"    \"frFR\": \"Flamme vacillante\",\n";
-                ss << u8"    \"itIT\": \"Fiamma\",\n";
-                ss << u8"    \"koKR\": \"꺼져가는 불길\",\n";
-                ss << u8"    \"plPL\": \"Płomień\",\n";
-                ss << u8"    \"esMX\": \"Llama parpadeante\",\n";
-                ss << u8"    \"jaJP\": \"揺らめく炎\",\n";
-                ss << u8"    \"ptBR\": \"Chama Tremeluzente\",\n";
-                ss << u8"    \"ruRU\": \"Мерцающее пламя\",\n";
-                ss << u8"    \"zhCN\": \"闪烁火焰\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20547,\n";
-                ss << u8"    \"Key\": \"Runeword41\",\n";
-                ss << u8"    \"enUS\": \"Fortitude\",\n";
-                ss << u8"    \"zhTW\": \"剛毅\",\n";
-                ss << u8"    \"deDE\": \"Stärke\",\n";
-                ss << u8"    \"esES\": \"Fortaleza\",\n";
-                ss << u8"    \"frFR\": \"Fortitude\",\n";
-                ss << u8"    \"itIT\": \"Fermezza\",\n";
-                ss << u8"    \"koKR\": \"인내\",\n";
-                ss << u8"    \"plPL\": \"Hart\",\n";
-                ss << u8"    \"esMX\": \"Fortaleza\",\n";
-                ss << u8"    \"jaJP\": \"不屈\",\n";
-                ss << u8"    \"ptBR\": \"Fortitude\",\n";
-                ss << u8"    \"ruRU\": \"Сила духа\",\n";
-                ss << u8"    \"zhCN\": \"刚毅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20548,\n";
-                ss << u8"    \"Key\": \"Runeword42\",\n";
-                ss << u8"    \"enUS\": \"Fortune\",\n";
-                ss << u8"    \"zhTW\": \"機運\",\n";
-                ss << u8"    \"deDE\": \"Glück\",\n";
-                ss << u8"    \"esES\": \"Fortuna\",\n";
-                ss << u8"    \"frFR\": \"Fortune\",\n";
-                ss << u8"    \"itIT\": \"Fortuna\",\n";
-                ss << u8"    \"koKR\": \"행운\",\n";
-                ss << u8"    \"plPL\": \"Fortuna\",\n";
-                ss << u8"    \"esMX\": \"Fortuna\",\n";
-                ss << u8"    \"jaJP\": \"幸運\",\n";
-                ss << u8"    \"ptBR\": \"Fortuna\",\n";
-                ss << u8"    \"ruRU\": \"Удача\",\n";
-                ss << u8"    \"zhCN\": \"鸿运\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20549,\n";
-                ss << u8"    \"Key\": \"Runeword43\",\n";
-                ss << u8"    \"enUS\": \"Friendship\",\n";
-                ss << u8"    \"zhTW\": \"友情\",\n";
-                ss << u8"    \"deDE\": \"Freundschaft\",\n";
-                ss << u8"    \"esES\": \"Amistad\",\n";
-                ss << u8"    \"frFR\": \"Fraternité\",\n";
-                ss << u8"    \"itIT\": \"Amicizia\",\n";
-                ss << u8"    \"koKR\": \"우정\",\n";
-                ss << u8"    \"plPL\": \"Przyjaźń\",\n";
-                ss << u8"    \"esMX\": \"Amistad\",\n";
-                ss << u8"    \"jaJP\": \"友情\",\n";
-                ss << u8"    \"ptBR\": \"Amizade\",\n";
-                ss << u8"    \"ruRU\": \"Дружба\",\n";
-                ss << u8"    \"zhCN\": \"友谊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20550,\n";
-                ss << u8"    \"Key\": \"Runeword44\",\n";
-                ss << u8"    \"enUS\": \"Fury\",\n";
-                ss << u8"    \"zhTW\": \"狂怒\",\n";
-                ss << u8"    \"deDE\": \"Wut\",\n";
-                ss << u8"    \"esES\": \"Furia\",\n";
-                ss << u8"    \"frFR\": \"Fureur\",\n";
-                ss << u8"    \"itIT\": \"Furia\",\n";
-                ss << u8"    \"koKR\": \"분노\",\n";
-                ss << u8"    \"plPL\": \"Furia\",\n";
-                ss << u8"    \"esMX\": \"Furia\",\n";
-                ss << u8"    \"jaJP\": \"激情\",\n";
-                ss << u8"    \"ptBR\": \"Fúria\",\n";
-                ss << u8"    \"ruRU\": \"Ярость\",\n";
-                ss << u8"    \"zhCN\": \"愤怒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20551,\n";
-                ss << u8"    \"Key\": \"Runeword45\",\n";
-                ss << u8"    \"enUS\": \"Gloom\",\n";
-                ss << u8"    \"zhTW\": \"幽暗\",\n";
-                ss << u8"    \"deDE\": \"Düsternis\",\n";
-                ss << u8"    \"esES\": \"Melancolía\",\n";
-                ss << u8"    \"frFR\": \"Funérailles\",\n";
-                ss << u8"    \"itIT\": \"Tenebre\",\n";
-                ss << u8"    \"koKR\": \"어스름\",\n";
-                ss << u8"    \"plPL\": \"Mrok\",\n";
-                ss << u8"    \"esMX\": \"Penumbra\",\n";
-                ss << u8"    \"jaJP\": \"陰鬱\",\n";
-                ss << u8"    \"ptBR\": \"Melancolia\",\n";
-                ss << u8"    \"ruRU\": \"Сумрак\",\n";
-                ss << u8"    \"zhCN\": \"阴霾\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20552,\n";
-                ss << u8"    \"Key\": \"Runeword46\",\n";
-                ss << u8"    \"enUS\": \"Glory\",\n";
-                ss << u8"    \"zhTW\": \"榮譽\",\n";
-                ss << u8"    \"deDE\": \"Ruhm\",\n";
-                ss << u8"    \"esES\": \"Gloria\",\n";
-                ss << u8"    \"frFR\": \"Gloire\",\n";
-                ss << u8"    \"itIT\": \"Gloria\",\n";
-                ss << u8"    \"koKR\": \"영예\",\n";
-                ss << u8"    \"plPL\": \"Chwała\",\n";
-                ss << u8"    \"esMX\": \"Gloria\",\n";
-                ss << u8"    \"jaJP\": \"栄光\",\n";
-                ss << u8"    \"ptBR\": \"Glória\",\n";
-                ss << u8"    \"ruRU\": \"Слава\",\n";
-                ss << u8"    \"zhCN\": \"光华\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20553,\n";
-                ss << u8"    \"Key\": \"Runeword47\",\n";
-                ss << u8"    \"enUS\": \"Grief\",\n";
-                ss << u8"    \"zhTW\": \"悔恨\",\n";
-                ss << u8"    \"deDE\": \"Trauer\",\n";
-                ss << u8"    \"esES\": \"Dolor\",\n";
-                ss << u8"    \"frFR\": \"Grand chagrin\",\n";
-                ss << u8"    \"itIT\": \"Cordoglio\",\n";
-                ss << u8"    \"koKR\": \"슬픔\",\n";
-                ss << u8"    \"plPL\": \"Żal\",\n";
-                ss << u8"    \"esMX\": \"Pena\",\n";
-                ss << u8"    \"jaJP\": \"嘆き\",\n";
-                ss << u8"    \"ptBR\": \"Luto\",\n";
-                ss << u8"    \"ruRU\": \"Печаль\",\n";
-                ss << u8"    \"zhCN\": \"悔恨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20554,\n";
-                ss << u8"    \"Key\": \"Runeword48\",\n";
-                ss << u8"    \"enUS\": \"Hand of Justice\",\n";
-                ss << u8"    \"zhTW\": \"正義之手\",\n";
-                ss << u8"    \"deDE\": \"Hand der Gerechtigkeit\",\n";
-                ss << u8"    \"esES\": \"Mano justiciera\",\n";
-                ss << u8"    \"frFR\": \"Glaive de la justice\",\n";
-                ss << u8"    \"itIT\": \"Mano della Giustizia\",\n";
-                ss << u8"    \"koKR\": \"정의의 손길\",\n";
-                ss << u8"    \"plPL\": \"Ręka Sprawiedliwości\",\n";
-                ss << u8"    \"esMX\": \"Mano de la justicia\",\n";
-                ss << u8"    \"jaJP\": \"正義の手\",\n";
-                ss << u8"    \"ptBR\": \"Mão da Justiça\",\n";
-                ss << u8"    \"ruRU\": \"Длань правосудия\",\n";
-                ss << u8"    \"zhCN\": \"正义之手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20555,\n";
-                ss << u8"    \"Key\": \"Runeword49\",\n";
-                ss << u8"    \"enUS\": \"Harmony\",\n";
-                ss << u8"    \"zhTW\": \"和諧\",\n";
-                ss << u8"    \"deDE\": \"Harmonie\",\n";
-                ss << u8"    \"esES\": \"Armonía\",\n";
-                ss << u8"    \"frFR\": \"Harmonie\",\n";
-                ss << u8"    \"itIT\": \"Armonia\",\n";
-                ss << u8"    \"koKR\": \"조화\",\n";
-                ss << u8"    \"plPL\": \"Harmonia\",\n";
-                ss << u8"    \"esMX\": \"Armonía\",\n";
-                ss << u8"    \"jaJP\": \"調和\",\n";
-                ss << u8"    \"ptBR\": \"Harmonia\",\n";
-                ss << u8"    \"ruRU\": \"Гармония\",\n";
-                ss << u8"    \"zhCN\": \"和谐\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20556,\n";
-                ss << u8"    \"Key\": \"Runeword50\",\n";
-                ss << u8"    \"enUS\": \"Hatred\",\n";
-                ss << u8"    \"zhTW\": \"憎恨\",\n";
-                ss << u8"    \"deDE\": \"Hass\",\n";
-                ss << u8"    \"esES\": \"Odio\",\n";
-                ss << u8"    \"frFR\": \"Haine\",\n";
-                ss << u8"    \"itIT\": \"Odio\",\n";
-                ss << u8"    \"koKR\": \"증오\",\n";
-                ss << u8"    \"plPL\": \"Nienawiść\",\n";
-                ss << u8"    \"esMX\": \"Odio\",\n";
-                ss << u8"    \"jaJP\": \"憎悪\",\n";
-                ss << u8"    \"ptBR\": \"Ódio\",\n";
-                ss << u8"    \"ruRU\": \"Ненависть\",\n";
-                ss << u8"    \"zhCN\": \"憎恨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20557,\n";
-                ss << u8"    \"Key\": \"Runeword51\",\n";
-                ss << u8"    \"enUS\": \"Heart of the Oak\",\n";
-                ss << u8"    \"zhTW\": \"橡樹之心\",\n";
-                ss << u8"    \"deDE\": \"Herz der Eiche\",\n";
-                ss << u8"    \"esES\": \"Corazón de roble\",\n";
-                ss << u8"    \"frFR\": \"Haut chêne\",\n";
-                ss << u8"    \"itIT\": \"Cuore della Quercia\",\n";
-                ss << u8"    \"koKR\": \"참나무의 심장\",\n";
-                ss << u8"    \"plPL\": \"Serce Dębu\",\n";
-                ss << u8"    \"esMX\": \"Corazón de roble\",\n";
-                ss << u8"    \"jaJP\": \"神木の心\",\n";
-                ss << u8"    \"ptBR\": \"Coração do Carvalho\",\n";
-                ss << u8"    \"ruRU\": \"Сердце дуба\",\n";
-                ss << u8"    \"zhCN\": \"橡树之心\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20558,\n";
-                ss << u8"    \"Key\": \"Runeword52\",\n";
-                ss << u8"    \"enUS\": \"Heaven's Will\",\n";
-                ss << u8"    \"zhTW\": \"天堂意志\",\n";
-                ss << u8"    \"deDE\": \"Himmlischer Wille\",\n";
-                ss << u8"    \"esES\": \"Voluntad del cielo\",\n";
-                ss << u8"    \"frFR\": \"Volonté des Cieux\",\n";
-                ss << u8"    \"itIT\": \"Volontà Celeste\",\n";
-                ss << u8"    \"koKR\": \"천상의 의지\",\n";
-                ss << u8"    \"plPL\": \"Wola Niebios\",\n";
-                ss << u8"    \"esMX\": \"Voluntad del cielo\",\n";
-                ss << u8"    \"jaJP\": \"天命\",\n";
-                ss << u8"    \"ptBR\": \"Vontade do Paraíso\",\n";
-                ss << u8"    \"ruRU\": \"Воля небес\",\n";
-                ss << u8"    \"zhCN\": \"天堂意志\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20559,\n";
-                ss << u8"    \"Key\": \"Runeword53\",\n";
-                ss << u8"    \"enUS\": \"Holy Tears\",\n";
-                ss << u8"    \"zhTW\": \"神聖之淚\",\n";
-                ss << u8"    \"deDE\": \"Heilige Tränen\",\n";
-                ss << u8"    \"esES\": \"Lágrimas sagradas\",\n";
-                ss << u8"    \"frFR\": \"Larmes sacrées\",\n";
-                ss << u8"    \"itIT\": \"Sacre Lacrime\",\n";
-                ss << u8"    \"koKR\": \"신성한 눈물\",\n";
-                ss << u8"    \"plPL\": \"Święta Łza\",\n";
-                ss << u8"    \"esMX\": \"Lágrimas sagradas\",\n";
-                ss << u8"    \"jaJP\": \"聖なる涙\",\n";
-                ss << u8"    \"ptBR\": \"Lágrimas Sagradas\",\n";
-                ss << u8"    \"ruRU\": \"Слезы святого\",\n";
-                ss << u8"    \"zhCN\": \"神圣之泪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20560,\n";
-                ss << u8"    \"Key\": \"Runeword54\",\n";
-                ss << u8"    \"enUS\": \"Holy Thunder\",\n";
-                ss << u8"    \"zhTW\": \"神聖雷擊\",\n";
-                ss << u8"    \"deDE\": \"Heiliger Donner\",\n";
-                ss << u8"    \"esES\": \"Trueno sagrado\",\n";
-                ss << u8"    \"frFR\": \"Tonnerre sacré\",\n";
-                ss << u8"    \"itIT\": \"Sacro Tuono\",\n";
-                ss << u8"    \"koKR\": \"신성한 천둥\",\n";
-                ss << u8"    \"plPL\": \"Święty Grom\",\n";
-                ss << u8"    \"esMX\": \"Trueno sagrado\",\n";
-                ss << u8"    \"jaJP\": \"神の雷\",\n";
-                ss << u8"    \"ptBR\": \"Trovão Sagrado\",\n";
-                ss << u8"    \"ruRU\": \"Божественный гром\",\n";
-                ss << u8"    \"zhCN\": \"圣雷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20561,\n";
-                ss << u8"    \"Key\": \"Runeword55\",\n";
-                ss << u8"    \"enUS\": \"Honor\",\n";
-                ss << u8"    \"zhTW\": \"榮耀\",\n";
-                ss << u8"    \"deDE\": \"Ehre\",\n";
-                ss << u8"    \"esES\": \"Honor\",\n";
-                ss << u8"    \"frFR\": \"Honneur\",\n";
-                ss << u8"    \"itIT\": \"Onore\",\n";
-                ss << u8"    \"koKR\": \"명예\",\n";
-                ss << u8"    \"plPL\": \"Honor\",\n";
-                ss << u8"    \"esMX\": \"Honor\",\n";
-                ss << u8"    \"jaJP\": \"名誉\",\n";
-                ss << u8"    \"ptBR\": \"Honra\",\n";
-                ss << u8"    \"ruRU\": \"Честь\",\n";
-                ss << u8"    \"zhCN\": \"荣耀\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20562,\n";
-                ss << u8"    \"Key\": \"Runeword56\",\n";
-                ss << u8"    \"enUS\": \"Revenge\",\n";
-                ss << u8"    \"zhTW\": \"報復\",\n";
-                ss << u8"    \"deDE\": \"Rache\",\n";
-                ss << u8"    \"esES\": \"Revancha\",\n";
-                ss << u8"    \"frFR\": \"Revanche\",\n";
-                ss << u8"    \"itIT\": \"Rivincita\",\n";
-                ss << u8"    \"koKR\": \"보복\",\n";
-                ss << u8"    \"plPL\": \"Mściwość\",\n";
-                ss << u8"    \"esMX\": \"Represalia\",\n";
-                ss << u8"    \"jaJP\": \"復讐\",\n";
-                ss << u8"    \"ptBR\": \"Revanche\",\n";
-                ss << u8"    \"ruRU\": \"Возмездие\",\n";
-                ss << u8"    \"zhCN\": \"报复\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20563,\n";
-                ss << u8"    \"Key\": \"Runeword57\",\n";
-                ss << u8"    \"enUS\": \"Humility\",\n";
-                ss << u8"    \"zhTW\": \"謙恭\",\n";
-                ss << u8"    \"deDE\": \"Demut\",\n";
-                ss << u8"    \"esES\": \"Humildad\",\n";
-                ss << u8"    \"frFR\": \"Humilité\",\n";
-                ss << u8"    \"itIT\": \"Umiltà\",\n";
-                ss << u8"    \"koKR\": \"겸손\",\n";
-                ss << u8"    \"plPL\": \"Pokora\",\n";
-                ss << u8"    \"esMX\": \"Humildad\",\n";
-                ss << u8"    \"jaJP\": \"謙虚\",\n";
-                ss << u8"    \"ptBR\": \"Humildade\",\n";
-                ss << u8"    \"ruRU\": \"Смирение\",\n";
-                ss << u8"    \"zhCN\": \"谦逊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20564,\n";
-                ss << u8"    \"Key\": \"Runeword58\",\n";
-                ss << u8"    \"enUS\": \"Hunger\",\n";
-                ss << u8"    \"zhTW\": \"飢餓\",\n";
-                ss << u8"    \"deDE\": \"Hunger\",\n";
-                ss << u8"    \"esES\": \"Hambre\",\n";
-                ss << u8"    \"frFR\": \"Faim\",\n";
-                ss << u8"    \"itIT\": \"Fame\",\n";
-                ss << u8"    \"koKR\": \"굶주림\",\n";
-                ss << u8"    \"plPL\": \"Głód\",\n";
-                ss << u8"    \"esMX\": \"Hambre\",\n";
-                ss << u8"    \"jaJP\": \"飢え\",\n";
-                ss << u8"    \"ptBR\": \"Fome\",\n";
-                ss << u8"    \"ruRU\": \"Голод\",\n";
-                ss << u8"    \"zhCN\": \"饥饿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20565,\n";
-                ss << u8"    \"Key\": \"Runeword59\",\n";
-                ss << u8"    \"enUS\": \"Ice\",\n";
-                ss << u8"    \"zhTW\": \"寒冰\",\n";
-                ss << u8"    \"deDE\": \"Eis\",\n";
-                ss << u8"    \"esES\": \"Hielo\",\n";
-                ss << u8"    \"frFR\": \"Glace\",\n";
-                ss << u8"    \"itIT\": \"Ghiaccio\",\n";
-                ss << u8"    \"koKR\": \"얼음\",\n";
-                ss << u8"    \"plPL\": \"Lód\",\n";
-                ss << u8"    \"esMX\": \"Hielo\",\n";
-                ss << u8"    \"jaJP\": \"氷\",\n";
-                ss << u8"    \"ptBR\": \"Gelo\",\n";
-                ss << u8"    \"ruRU\": \"Лед\",\n";
-                ss << u8"    \"zhCN\": \"寒冰\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20566,\n";
-                ss << u8"    \"Key\": \"Runeword60\",\n";
-                ss << u8"    \"enUS\": \"Infinity\",\n";
-                ss << u8"    \"zhTW\": \"無限\",\n";
-                ss << u8"    \"deDE\": \"Unendlichkeit\",\n";
-                ss << u8"    \"esES\": \"Infinito\",\n";
-                ss << u8"    \"frFR\": \"Infinité\",\n";
-                ss << u8"    \"itIT\": \"Infinito\",\n";
-                ss << u8"    \"koKR\": \"무한\",\n";
-                ss << u8"    \"plPL\": \"Nieskończoność\",\n";
-                ss << u8"    \"esMX\": \"Infinito\",\n";
-                ss << u8"    \"jaJP\": \"無限\",\n";
-                ss << u8"    \"ptBR\": \"Infinito\",\n";
-                ss << u8"    \"ruRU\": \"Бесконечность\",\n";
-                ss << u8"    \"zhCN\": \"无限\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20567,\n";
-                ss << u8"    \"Key\": \"Runeword61\",\n";
-                ss << u8"    \"enUS\": \"Innocence\",\n";
-                ss << u8"    \"zhTW\": \"純真\",\n";
-                ss << u8"    \"deDE\": \"Unschuld\",\n";
-                ss << u8"    \"esES\": \"Inocencia\",\n";
-                ss << u8"    \"frFR\": \"Innocence\",\n";
-                ss << u8"    \"itIT\": \"Innocenza\",\n";
-                ss << u8"    \"koKR\": \"결백\",\n";
-                ss << u8"    \"plPL\": \"Niewinność\",\n";
-                ss << u8"    \"esMX\": \"Inocencia\",\n";
-                ss << u8"    \"jaJP\": \"無垢\",\n";
-                ss << u8"    \"ptBR\": \"Inocência\",\n";
-                ss << u8"    \"ruRU\": \"Невинность\",\n";
-                ss << u8"    \"zhCN\": \"无辜\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20568,\n";
-                ss << u8"    \"Key\": \"Runeword62\",\n";
-                ss << u8"    \"enUS\": \"Insight\",\n";
-                ss << u8"    \"zhTW\": \"靈光\",\n";
-                ss << u8"    \"deDE\": \"Einsicht\",\n";
-                ss << u8"    \"esES\": \"Perspicacia\",\n";
-                ss << u8"    \"frFR\": \"Spiritualité\",\n";
-                ss << u8"    \"itIT\": \"Intuito\",\n";
-                ss << u8"    \"koKR\": \"통찰\",\n";
-                ss << u8"    \"plPL\": \"Olśnienie\",\n";
-                ss << u8"    \"esMX\": \"Percepción\",\n";
-                ss << u8"    \"jaJP\": \"洞察\",\n";
-                ss << u8"    \"ptBR\": \"Intuição\",\n";
-                ss << u8"    \"ruRU\": \"Прозрение\",\n";
-                ss << u8"    \"zhCN\": \"眼光\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20569,\n";
-                ss << u8"    \"Key\": \"Runeword63\",\n";
-                ss << u8"    \"enUS\": \"Jealousy\",\n";
-                ss << u8"    \"zhTW\": \"妒忌\",\n";
-                ss << u8"    \"deDE\": \"Eifersucht\",\n";
-                ss << u8"    \"esES\": \"Celos\",\n";
-                ss << u8"    \"frFR\": \"Jalousie\",\n";
-                ss << u8"    \"itIT\": \"Gelosia\",\n";
-                ss << u8"    \"koKR\": \"질투\",\n";
-                ss << u8"    \"plPL\": \"Zazdrość\",\n";
-                ss << u8"    \"esMX\": \"Celos\",\n";
-                ss << u8"    \"jaJP\": \"嫉妬\",\n";
-                ss << u8"    \"ptBR\": \"Ciúme\",\n";
-                ss << u8"    \"ruRU\": \"Ревность\",\n";
-                ss << u8"    \"zhCN\": \"嫉妒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20570,\n";
-                ss << u8"    \"Key\": \"Runeword64\",\n";
-                ss << u8"    \"enUS\": \"Judgement\",\n";
-                ss << u8"    \"zhTW\": \"審判\",\n";
-                ss << u8"    \"deDE\": \"Urteil\",\n";
-                ss << u8"    \"esES\": \"Sentencia\",\n";
-                ss << u8"    \"frFR\": \"Jugement\",\n";
-                ss << u8"    \"itIT\": \"Giudizio\",\n";
-                ss << u8"    \"koKR\": \"심판\",\n";
-                ss << u8"    \"plPL\": \"Osąd\",\n";
-                ss << u8"    \"esMX\": \"Juicio\",\n";
-                ss << u8"    \"jaJP\": \"審判\",\n";
-                ss << u8"    \"ptBR\": \"Julgamento\",\n";
-                ss << u8"    \"ruRU\": \"Правосудие\",\n";
-                ss << u8"    \"zhCN\": \"审判\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20571,\n";
-                ss << u8"    \"Key\": \"Runeword65\",\n";
-                ss << u8"    \"enUS\": \"King's Grace\",\n";
-                ss << u8"    \"zhTW\": \"王者的慈悲\",\n";
-                ss << u8"    \"deDE\": \"Königliche Gnade\",\n";
-                ss << u8"    \"esES\": \"Gracia del rey\",\n";
-                ss << u8"    \"frFR\": \"Grâce du roi\",\n";
-                ss << u8"    \"itIT\": \"Grazia del Re\",\n";
-                ss << u8"    \"koKR\": \"왕의 은총\",\n";
-                ss << u8"    \"plPL\": \"Królewska Łaska\",\n";
-                ss << u8"    \"esMX\": \"Gracia del rey\",\n";
-                ss << u8"    \"jaJP\": \"王の赦し\",\n";
-                ss << u8"    \"ptBR\": \"Graça Régia\",\n";
-                ss << u8"    \"ruRU\": \"Милость короля\",\n";
-                ss << u8"    \"zhCN\": \"王恩\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20572,\n";
-                ss << u8"    \"Key\": \"Runeword66\",\n";
-                ss << u8"    \"enUS\": \"Kingslayer\",\n";
-                ss << u8"    \"zhTW\": \"弒王者\",\n";
-                ss << u8"    \"deDE\": \"Königsmord\",\n";
-                ss << u8"    \"esES\": \"Regicida\",\n";
-                ss << u8"    \"frFR\": \"Régicide\",\n";
-                ss << u8"    \"itIT\": \"Regicida\",\n";
-                ss << u8"    \"koKR\": \"왕 시해자\",\n";
-                ss << u8"    \"plPL\": \"Zabójca Królów\",\n";
-                ss << u8"    \"esMX\": \"Matarreyes\",\n";
-                ss << u8"    \"jaJP\": \"王殺し\",\n";
-                ss << u8"    \"ptBR\": \"Regicida\",\n";
-                ss << u8"    \"ruRU\": \"Цареубийца\",\n";
-                ss << u8"    \"zhCN\": \"弑君者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20573,\n";
-                ss << u8"    \"Key\": \"Runeword67\",\n";
-                ss << u8"    \"enUS\": \"Knight's Vigil\",\n";
-                ss << u8"    \"zhTW\": \"騎士守望\",\n";
-                ss << u8"    \"deDE\": \"Ritters Wacht\",\n";
-                ss << u8"    \"esES\": \"Vela del caballero\",\n";
-                ss << u8"    \"frFR\": \"Veille du chevalier\",\n";
-                ss << u8"    \"itIT\": \"Veglia del Cavaliere\",\n";
-                ss << u8"    \"koKR\": \"기사의 경계\",\n";
-                ss << u8"    \"plPL\": \"Rycerska Warta\",\n";
-                ss << u8"    \"esMX\": \"Vigilia del caballero\",\n";
-                ss << u8"    \"jaJP\": \"騎士の見張り\",\n";
-                ss << u8"    \"ptBR\": \"Vigília do Cavaleiro\",\n";
-                ss << u8"    \"ruRU\": \"Бдение рыцаря\",\n";
-                ss << u8"    \"zhCN\": \"骑士之印\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20574,\n";
-                ss << u8"    \"Key\": \"Runeword68\",\n";
-                ss << u8"    \"enUS\": \"Knowledge\",\n";
-                ss << u8"    \"zhTW\": \"學識\",\n";
-                ss << u8"    \"deDE\": \"Wissen\",\n";
-                ss << u8"    \"esES\": \"Saber\",\n";
-                ss << u8"    \"frFR\": \"Connaissance\",\n";
-                ss << u8"    \"itIT\": \"Conoscenza\",\n";
-                ss << u8"    \"koKR\": \"지식\",\n";
-                ss << u8"    \"plPL\": \"Poznanie\",\n";
-                ss << u8"    \"esMX\": \"Conocimiento\",\n";
-                ss << u8"    \"jaJP\": \"知識\",\n";
-                ss << u8"    \"ptBR\": \"Conhecimento\",\n";
-                ss << u8"    \"ruRU\": \"Знание\",\n";
-                ss << u8"    \"zhCN\": \"知识\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20575,\n";
-                ss << u8"    \"Key\": \"Runeword69\",\n";
-                ss << u8"    \"enUS\": \"Last Wish\",\n";
-                ss << u8"    \"zhTW\": \"最後遺願\",\n";
-                ss << u8"    \"deDE\": \"Letzter Wunsch\",\n";
-                ss << u8"    \"esES\": \"Último deseo\",\n";
-                ss << u8"    \"frFR\": \"Dernière volonté\",\n";
-                ss << u8"    \"itIT\": \"Ultimo Desiderio\",\n";
-                ss << u8"    \"koKR\": \"마지막 소원\",\n";
-                ss << u8"    \"plPL\": \"Ostatnie Życzenie\",\n";
-                ss << u8"    \"esMX\": \"Último deseo\",\n";
-                ss << u8"    \"jaJP\": \"最後の願い\",\n";
-                ss << u8"    \"ptBR\": \"Último Desejo\",\n";
-                ss << u8"    \"ruRU\": \"Последняя воля\",\n";
-                ss << u8"    \"zhCN\": \"临终之愿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20576,\n";
-                ss << u8"    \"Key\": \"Runeword70\",\n";
-                ss << u8"    \"enUS\": \"Law\",\n";
-                ss << u8"    \"zhTW\": \"律法\",\n";
-                ss << u8"    \"deDE\": \"Gesetz\",\n";
-                ss << u8"    \"esES\": \"Ley\",\n";
-                ss << u8"    \"frFR\": \"Loi\",\n";
-                ss << u8"    \"itIT\": \"Legge\",\n";
-                ss << u8"    \"koKR\": \"법률\",\n";
-                ss << u8"    \"plPL\": \"Prawo\",\n";
-                ss << u8"    \"esMX\": \"Ley\",\n";
-                ss << u8"    \"jaJP\": \"法\",\n";
-                ss << u8"    \"ptBR\": \"Lei\",\n";
-                ss << u8"    \"ruRU\": \"Закон\",\n";
-                ss << u8"    \"zhCN\": \"律法\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20577,\n";
-                ss << u8"    \"Key\": \"Runeword71\",\n";
-                ss << u8"    \"enUS\": \"Lawbringer\",\n";
-                ss << u8"    \"zhTW\": \"執法者\",\n";
-                ss << u8"    \"deDE\": \"Gesetzesbringer\",\n";
-                ss << u8"    \"esES\": \"Jurista\",\n";
-                ss << u8"    \"frFR\": \"Législateur\",\n";
-                ss << u8"    \"itIT\": \"Legiferatore\",\n";
-                ss << u8"    \"koKR\": \"집행자\",\n";
-                ss << u8"    \"plPL\": \"Prawodawca\",\n";
-                ss << u8"    \"esMX\": \"Justiciero\",\n";
-                ss << u8"    \"jaJP\": \"法の番人\",\n";
-                ss << u8"    \"ptBR\": \"Justiceiro\",\n";
-                ss << u8"    \"ruRU\": \"Судия\",\n";
-                ss << u8"    \"zhCN\": \"执法者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20578,\n";
-                ss << u8"    \"Key\": \"Runeword72\",\n";
-                ss << u8"    \"enUS\": \"Leaf\",\n";
-                ss << u8"    \"zhTW\": \"葉子\",\n";
-                ss << u8"    \"deDE\": \"Blatt\",\n";
-                ss << u8"    \"esES\": \"Hoja\",\n";
-                ss << u8"    \"frFR\": \"Feuille\",\n";
-                ss << u8"    \"itIT\": \"Foglia\",\n";
-                ss << u8"    \"koKR\": \"잎새\",\n";
-                ss << u8"    \"plPL\": \"Liść\",\n";
-                ss << u8"    \"esMX\": \"Hoja\",\n";
-                ss << u8"    \"jaJP\": \"葉\",\n";
-                ss << u8"    \"ptBR\": \"Folha\",\n";
-                ss << u8"    \"ruRU\": \"Лист\",\n";
-                ss << u8"    \"zhCN\": \"叶子\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20579,\n";
-                ss << u8"    \"Key\": \"Runeword73\",\n";
-                ss << u8"    \"enUS\": \"Lightning\",\n";
-                ss << u8"    \"zhTW\": \"閃電\",\n";
-                ss << u8"    \"deDE\": \"Blitzschlag\",\n";
-                ss << u8"    \"esES\": \"Rayo\",\n";
-                ss << u8"    \"frFR\": \"Foudre\",\n";
-                ss << u8"    \"itIT\": \"Fulmine\",\n";
-                ss << u8"    \"koKR\": \"번개\",\n";
-                ss << u8"    \"plPL\": \"Błyskawica\",\n";
-                ss << u8"    \"esMX\": \"Rayo\",\n";
-                ss << u8"    \"jaJP\": \"稲妻\",\n";
-                ss << u8"    \"ptBR\": \"Eletricidade\",\n";
-                ss << u8"    \"ruRU\": \"Молния\",\n";
-                ss << u8"    \"zhCN\": \"闪电\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20580,\n";
-                ss << u8"    \"Key\": \"Runeword74\",\n";
-                ss << u8"    \"enUS\": \"Lionheart\",\n";
-                ss << u8"    \"zhTW\": \"獅子心\",\n";
-                ss << u8"    \"deDE\": \"Löwenherz\",\n";
-                ss << u8"    \"esES\": \"Corazón de león\",\n";
-                ss << u8"    \"frFR\": \"Cœur-de-lion\",\n";
-                ss << u8"    \"itIT\": \"Cuor di Leone\",\n";
-                ss << u8"    \"koKR\": \"용맹\",\n";
-                ss << u8"    \"plPL\": \"Lwie Serce\",\n";
-                ss << u8"    \"esMX\": \"Corazón de león\",\n";
-                ss << u8"    \"jaJP\": \"勇猛\",\n";
-                ss << u8"    \"ptBR\": \"Coração de Leão\",\n";
-                ss << u8"    \"ruRU\": \"Львиное сердце\",\n";
-                ss << u8"    \"zhCN\": \"狮心\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20581,\n";
-                ss << u8"    \"Key\": \"Runeword75\",\n";
-                ss << u8"    \"enUS\": \"Lore\",\n";
-                ss << u8"    \"zhTW\": \"知識\",\n";
-                ss << u8"    \"deDE\": \"Überlieferung\",\n";
-                ss << u8"    \"esES\": \"Acervo\",\n";
-                ss << u8"    \"frFR\": \"Savoir\",\n";
-                ss << u8"    \"itIT\": \"Dottrina\",\n";
-                ss << u8"    \"koKR\": \"전승\",\n";
-                ss << u8"    \"plPL\": \"Wiedza\",\n";
-                ss << u8"    \"esMX\": \"Historia\",\n";
-                ss << u8"    \"jaJP\": \"伝承\",\n";
-                ss << u8"    \"ptBR\": \"Legado\",\n";
-                ss << u8"    \"ruRU\": \"История\",\n";
-                ss << u8"    \"zhCN\": \"学识\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20582,\n";
-                ss << u8"    \"Key\": \"Runeword76\",\n";
-                ss << u8"    \"enUS\": \"Love\",\n";
-                ss << u8"    \"zhTW\": \"愛情\",\n";
-                ss << u8"    \"deDE\": \"Liebe\",\n";
-                ss << u8"    \"esES\": \"Amor\",\n";
-                ss << u8"    \"frFR\": \"Lien amoureux\",\n";
-                ss << u8"    \"itIT\": \"Amore\",\n";
-                ss << u8"    \"koKR\": \"사랑\",\n";
-                ss << u8"    \"plPL\": \"Miłość\",\n";
-                ss << u8"    \"esMX\": \"Amor\",\n";
-                ss << u8"    \"jaJP\": \"愛\",\n";
-                ss << u8"    \"ptBR\": \"Amor\",\n";
-                ss << u8"    \"ruRU\": \"Любовь\",\n";
-                ss << u8"    \"zhCN\": \"爱情\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20583,\n";
-                ss << u8"    \"Key\": \"Runeword77\",\n";
-                ss << u8"    \"enUS\": \"Loyalty\",\n";
-                ss << u8"    \"zhTW\": \"忠誠\",\n";
-                ss << u8"    \"deDE\": \"Treue\",\n";
-                ss << u8"    \"esES\": \"Lealtad\",\n";
-                ss << u8"    \"frFR\": \"Loyauté\",\n";
-                ss << u8"    \"itIT\": \"Fedeltà\",\n";
-                ss << u8"    \"koKR\": \"충심\",\n";
-                ss << u8"    \"plPL\": \"Lojalność\",\n";
-                ss << u8"    \"esMX\": \"Lealtad\",\n";
-                ss << u8"    \"jaJP\": \"忠義\",\n";
-                ss << u8"    \"ptBR\": \"Lealdade\",\n";
-                ss << u8"    \"ruRU\": \"Преданность\",\n";
-                ss << u8"    \"zhCN\": \"忠诚\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20584,\n";
-                ss << u8"    \"Key\": \"Runeword78\",\n";
-                ss << u8"    \"enUS\": \"Lust\",\n";
-                ss << u8"    \"zhTW\": \"慾望\",\n";
-                ss << u8"    \"deDE\": \"Lust\",\n";
-                ss << u8"    \"esES\": \"Lujuria\",\n";
-                ss << u8"    \"frFR\": \"Luxure\",\n";
-                ss << u8"    \"itIT\": \"Lussuria\",\n";
-                ss << u8"    \"koKR\": \"욕정\",\n";
-                ss << u8"    \"plPL\": \"Żądza\",\n";
-                ss << u8"    \"esMX\": \"Lujuria\",\n";
-                ss << u8"    \"jaJP\": \"熱望\",\n";
-                ss << u8"    \"ptBR\": \"Luxúria\",\n";
-                ss << u8"    \"ruRU\": \"Похоть\",\n";
-                ss << u8"    \"zhCN\": \"欲望\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20585,\n";
-                ss << u8"    \"Key\": \"Runeword79\",\n";
-                ss << u8"    \"enUS\": \"Madness\",\n";
-                ss << u8"    \"zhTW\": \"瘋狂\",\n";
-                ss << u8"    \"deDE\": \"Wahnsinn\",\n";
-                ss << u8"    \"esES\": \"Locura\",\n";
-                ss << u8"    \"frFR\": \"Aliénation\",\n";
-                ss << u8"    \"itIT\": \"Follia\",\n";
-                ss << u8"    \"koKR\": \"광기\",\n";
-                ss << u8"    \"plPL\": \"Szaleństwo\",\n";
-                ss << u8"    \"esMX\": \"Locura\",\n";
-                ss << u8"    \"jaJP\": \"狂気\",\n";
-                ss << u8"    \"ptBR\": \"Loucura\",\n";
-                ss << u8"    \"ruRU\": \"Безумие\",\n";
-                ss << u8"    \"zhCN\": \"疯狂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20586,\n";
-                ss << u8"    \"Key\": \"Runeword81\",\n";
-                ss << u8"    \"enUS\": \"Malice\",\n";
-                ss << u8"    \"zhTW\": \"怨恨\",\n";
-                ss << u8"    \"deDE\": \"Boshaftigkeit\",\n";
-                ss << u8"    \"esES\": \"Maldad\",\n";
-                ss << u8"    \"frFR\": \"Méchanceté\",\n";
-                ss << u8"    \"itIT\": \"Malizia\",\n";
-                ss << u8"    \"koKR\": \"악의\",\n";
-                ss << u8"    \"plPL\": \"Złośliwość\",\n";
-                ss << u8"    \"esMX\": \"Malicia\",\n";
-                ss << u8"    \"jaJP\": \"恨み\",\n";
-                ss << u8"    \"ptBR\": \"Malícia\",\n";
-                ss << u8"    \"ruRU\": \"Злоба\",\n";
-                ss << u8"    \"zhCN\": \"怨恨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20587,\n";
-                ss << u8"    \"Key\": \"Runeword82\",\n";
-                ss << u8"    \"enUS\": \"Melody\",\n";
-                ss << u8"    \"zhTW\": \"旋律\",\n";
-                ss << u8"    \"deDE\": \"Melodie\",\n";
-                ss << u8"    \"esES\": \"Melodía\",\n";
-                ss << u8"    \"frFR\": \"Mélodie\",\n";
-                ss << u8"    \"itIT\": \"Melodia\",\n";
-                ss << u8"    \"koKR\": \"선율\",\n";
-                ss << u8"    \"plPL\": \"Melodia\",\n";
-                ss << u8"    \"esMX\": \"Melodía\",\n";
-                ss << u8"    \"jaJP\": \"旋律\",\n";
-                ss << u8"    \"ptBR\": \"Melodia\",\n";
-                ss << u8"    \"ruRU\": \"Мелодия\",\n";
-                ss << u8"    \"zhCN\": \"旋律\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20588,\n";
-                ss << u8"    \"Key\": \"Runeword83\",\n";
-                ss << u8"    \"enUS\": \"Memory\",\n";
-                ss << u8"    \"zhTW\": \"記憶\",\n";
-                ss << u8"    \"deDE\": \"Erinnerung\",\n";
-                ss << u8"    \"esES\": \"Memoria\",\n";
-                ss << u8"    \"frFR\": \"Mémoire\",\n";
-                ss << u8"    \"itIT\": \"Memoria\",\n";
-                ss << u8"    \"koKR\": \"기억\",\n";
-                ss << u8"    \"plPL\": \"Pamięć\",\n";
-                ss << u8"    \"esMX\": \"Memoria\",\n";
-                ss << u8"    \"jaJP\": \"記憶\",\n";
-                ss << u8"    \"ptBR\": \"Memória\",\n";
-                ss << u8"    \"ruRU\": \"Память\",\n";
-                ss << u8"    \"zhCN\": \"回忆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20589,\n";
-                ss << u8"    \"Key\": \"Runeword84\",\n";
-                ss << u8"    \"enUS\": \"Mist\",\n";
-                ss << u8"    \"zhTW\": \"迷霧\",\n";
-                ss << u8"    \"deDE\": \"Nebel\",\n";
-                ss << u8"    \"esES\": \"Bruma\",\n";
-                ss << u8"    \"frFR\": \"Brume\",\n";
-                ss << u8"    \"itIT\": \"Bruma\",\n";
-                ss << u8"    \"koKR\": \"안개\",\n";
-                ss << u8"    \"plPL\": \"Mgła\",\n";
-                ss << u8"    \"esMX\": \"Bruma\",\n";
-                ss << u8"    \"jaJP\": \"霧\",\n";
-                ss << u8"    \"ptBR\": \"Névoa\",\n";
-                ss << u8"    \"ruRU\": \"Туман\",\n";
-                ss << u8"    \"zhCN\": \"迷雾\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20590,\n";
-                ss << u8"    \"Key\": \"Runeword85\",\n";
-                ss << u8"    \"enUS\": \"Morning\",\n";
-                ss << u8"    \"zhTW\": \"清晨\",\n";
-                ss << u8"    \"deDE\": \"Morgen\",\n";
-                ss << u8"    \"esES\": \"Mañana\",\n";
-                ss << u8"    \"frFR\": \"Matin\",\n";
-                ss << u8"    \"itIT\": \"Mattino\",\n";
-                ss << u8"    \"koKR\": \"아침\",\n";
-                ss << u8"    \"plPL\": \"Poranek\",\n";
-                ss << u8"    \"esMX\": \"Mañana\",\n";
-                ss << u8"    \"jaJP\": \"朝\",\n";
-                ss << u8"    \"ptBR\": \"Manhã\",\n";
-                ss << u8"    \"ruRU\": \"Утро\",\n";
-                ss << u8"    \"zhCN\": \"清晨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20591,\n";
-                ss << u8"    \"Key\": \"Runeword86\",\n";
-                ss << u8"    \"enUS\": \"Mystery\",\n";
-                ss << u8"    \"zhTW\": \"神秘\",\n";
-                ss << u8"    \"deDE\": \"Geheimnis\",\n";
-                ss << u8"    \"esES\": \"Misterio\",\n";
-                ss << u8"    \"frFR\": \"Mystère\",\n";
-                ss << u8"    \"itIT\": \"Mistero\",\n";
-                ss << u8"    \"koKR\": \"신비\",\n";
-                ss << u8"    \"plPL\": \"Tajemnica\",\n";
-                ss << u8"    \"esMX\": \"Misterio\",\n";
-                ss << u8"    \"jaJP\": \"神秘\",\n";
-                ss << u8"    \"ptBR\": \"Mistério\",\n";
-                ss << u8"    \"ruRU\": \"Загадка\",\n";
-                ss << u8"    \"zhCN\": \"谜题\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20592,\n";
-                ss << u8"    \"Key\": \"Runeword87\",\n";
-                ss << u8"    \"enUS\": \"Myth\",\n";
-                ss << u8"    \"zhTW\": \"神話\",\n";
-                ss << u8"    \"deDE\": \"Mythos\",\n";
-                ss << u8"    \"esES\": \"Mito\",\n";
-                ss << u8"    \"frFR\": \"Mythe\",\n";
-                ss << u8"    \"itIT\": \"Mito\",\n";
-                ss << u8"    \"koKR\": \"신화\",\n";
-                ss << u8"    \"plPL\": \"Mit\",\n";
-                ss << u8"    \"esMX\": \"Mito\",\n";
-                ss << u8"    \"jaJP\": \"神話\",\n";
-                ss << u8"    \"ptBR\": \"Mito\",\n";
-                ss << u8"    \"ruRU\": \"Миф\",\n";
-                ss << u8"    \"zhCN\": \"神话\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20593,\n";
-                ss << u8"    \"Key\": \"Runeword88\",\n";
-                ss << u8"    \"enUS\": \"Nadir\",\n";
-                ss << u8"    \"zhTW\": \"天底\",\n";
-                ss << u8"    \"deDE\": \"Nadir\",\n";
-                ss << u8"    \"esES\": \"Nadir\",\n";
-                ss << u8"    \"frFR\": \"Nadir\",\n";
-                ss << u8"    \"itIT\": \"Nadir\",\n";
-                ss << u8"    \"koKR\": \"구렁텅이\",\n";
-                ss << u8"    \"plPL\": \"Nadir\",\n";
-                ss << u8"    \"esMX\": \"Nadir\",\n";
-                ss << u8"    \"jaJP\": \"奈落\",\n";
-                ss << u8"    \"ptBR\": \"Nadir\",\n";
-                ss << u8"    \"ruRU\": \"Упадок\",\n";
-                ss << u8"    \"zhCN\": \"天底\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20594,\n";
-                ss << u8"    \"Key\": \"Runeword89\",\n";
-                ss << u8"    \"enUS\": \"Nature's Kingdom\",\n";
-                ss << u8"    \"zhTW\": \"自然王國\",\n";
-                ss << u8"    \"deDE\": \"Königreich der Natur\",\n";
-                ss << u8"    \"esES\": \"Reino de la naturaleza\",\n";
-                ss << u8"    \"frFR\": \"Nature\",\n";
-                ss << u8"    \"itIT\": \"Regno della Natura\",\n";
-                ss << u8"    \"koKR\": \"자연의 왕국\",\n";
-                ss << u8"    \"plPL\": \"Królestwo Natury\",\n";
-                ss << u8"    \"esMX\": \"Reino de la naturaleza\",\n";
-                ss << u8"    \"jaJP\": \"自然の王国\",\n";
-                ss << u8"    \"ptBR\": \"Reino da Natureza\",\n";
-                ss << u8"    \"ruRU\": \"Царство природы\",\n";
-                ss << u8"    \"zhCN\": \"自然王国\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20595,\n";
-                ss << u8"    \"Key\": \"Runeword90\",\n";
-                ss << u8"    \"enUS\": \"Night\",\n";
-                ss << u8"    \"zhTW\": \"夜晚\",\n";
-                ss << u8"    \"deDE\": \"Nacht\",\n";
-                ss << u8"    \"esES\": \"Noche\",\n";
-                ss << u8"    \"frFR\": \"Nuit\",\n";
-                ss << u8"    \"itIT\": \"Notte\",\n";
-                ss << u8"    \"koKR\": \"밤\",\n";
-                ss << u8"    \"plPL\": \"Noc\",\n";
-                ss << u8"    \"esMX\": \"Noche\",\n";
-                ss << u8"    \"jaJP\": \"夜\",\n";
-                ss << u8"    \"ptBR\": \"Noite\",\n";
-                ss << u8"    \"ruRU\": \"Ночь\",\n";
-                ss << u8"    \"zhCN\": \"黑夜\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20596,\n";
-                ss << u8"    \"Key\": \"Runeword91\",\n";
-                ss << u8"    \"enUS\": \"Oath\",\n";
-                ss << u8"    \"zhTW\": \"誓約\",\n";
-                ss << u8"    \"deDE\": \"Eid\",\n";
-                ss << u8"    \"esES\": \"Juramento\",\n";
-                ss << u8"    \"frFR\": \"Serment\",\n";
-                ss << u8"    \"itIT\": \"Giuramento\",\n";
-                ss << u8"    \"koKR\": \"서약\",\n";
-                ss << u8"    \"plPL\": \"Przysięga\",\n";
-                ss << u8"    \"esMX\": \"Juramento\",\n";
-                ss << u8"    \"jaJP\": \"誓い\",\n";
-                ss << u8"    \"ptBR\": \"Juramento\",\n";
-                ss << u8"    \"ruRU\": \"Клятва\",\n";
-                ss << u8"    \"zhCN\": \"誓言\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20597,\n";
-                ss << u8"    \"Key\": \"Runeword92\",\n";
-                ss << u8"    \"enUS\": \"Obedience\",\n";
-                ss << u8"    \"zhTW\": \"遵從\",\n";
-                ss << u8"    \"deDE\": \"Gehorsam\",\n";
-                ss << u8"    \"esES\": \"Obediencia\",\n";
-                ss << u8"    \"frFR\": \"Obéissance \",\n";
-                ss << u8"    \"itIT\": \"Obbedienza\",\n";
-                ss << u8"    \"koKR\": \"순종\",\n";
-                ss << u8"    \"plPL\": \"Posłuszeństwo\",\n";
-                ss << u8"    \"esMX\": \"Obediencia\",\n";
-                ss << u8"    \"jaJP\": \"服従\",\n";
-                ss << u8"    \"ptBR\": \"Obediência\",\n";
-                ss << u8"    \"ruRU\": \"Послушание\",\n";
-                ss << u8"    \"zhCN\": \"顺从\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20598,\n";
-                ss << u8"    \"Key\": \"Runeword93\",\n";
-                ss << u8"    \"enUS\": \"Oblivion\",\n";
-                ss << u8"    \"zhTW\": \"湮沒\",\n";
-                ss << u8"    \"deDE\": \"Nichts\",\n";
-                ss << u8"    \"esES\": \"Olvido\",\n";
-                ss << u8"    \"frFR\": \"Oubli\",\n";
-                ss << u8"    \"itIT\": \"Oblio\",\n";
-                ss << u8"    \"koKR\": \"망각\",\n";
-                ss << u8"    \"plPL\": \"Zapomnienie\",\n";
-                ss << u8"    \"esMX\": \"Olvido\",\n";
-                ss << u8"    \"jaJP\": \"忘却\",\n";
-                ss << u8"    \"ptBR\": \"Esquecimento\",\n";
-                ss << u8"    \"ruRU\": \"Забвение\",\n";
-                ss << u8"    \"zhCN\": \"湮灭\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20599,\n";
-                ss << u8"    \"Key\": \"Runeword94\",\n";
-                ss << u8"    \"enUS\": \"Obsession\",\n";
-                ss << u8"    \"zhTW\": \"執念\",\n";
-                ss << u8"    \"deDE\": \"Besessenheit\",\n";
-                ss << u8"    \"esES\": \"Obsesión\",\n";
-                ss << u8"    \"frFR\": \"Obsession\",\n";
-                ss << u8"    \"itIT\": \"Ossessione\",\n";
-                ss << u8"    \"koKR\": \"집착\",\n";
-                ss << u8"    \"plPL\": \"Obsesja\",\n";
-                ss << u8"    \"esMX\": \"Obsesión\",\n";
-                ss << u8"    \"jaJP\": \"執着\",\n";
-                ss << u8"    \"ptBR\": \"Obsessão\",\n";
-                ss << u8"    \"ruRU\": \"Помешательство\",\n";
-                ss << u8"    \"zhCN\": \"执着\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20600,\n";
-                ss << u8"    \"Key\": \"Runeword95\",\n";
-                ss << u8"    \"enUS\": \"Passion\",\n";
-                ss << u8"    \"zhTW\": \"熱情\",\n";
-                ss << u8"    \"deDE\": \"Leidenschaft\",\n";
-                ss << u8"    \"esES\": \"Pasión\",\n";
-                ss << u8"    \"frFR\": \"Passion\",\n";
-                ss << u8"    \"itIT\": \"Passione\",\n";
-                ss << u8"    \"koKR\": \"열정\",\n";
-                ss << u8"    \"plPL\": \"Pasja\",\n";
-                ss << u8"    \"esMX\": \"Pasión\",\n";
-                ss << u8"    \"jaJP\": \"情熱\",\n";
-                ss << u8"    \"ptBR\": \"Paixão\",\n";
-                ss << u8"    \"ruRU\": \"Страсть\",\n";
-                ss << u8"    \"zhCN\": \"热情\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20601,\n";
-                ss << u8"    \"Key\": \"Runeword96\",\n";
-                ss << u8"    \"enUS\": \"Patience\",\n";
-                ss << u8"    \"zhTW\": \"耐心\",\n";
-                ss << u8"    \"deDE\": \"Geduld\",\n";
-                ss << u8"    \"esES\": \"Paciencia\",\n";
-                ss << u8"    \"frFR\": \"Patience\",\n";
-                ss << u8"    \"itIT\": \"Pazienza\",\n";
-                ss << u8"    \"koKR\": \"끈기\",\n";
-                ss << u8"    \"plPL\": \"Cierpliwość\",\n";
-                ss << u8"    \"esMX\": \"Paciencia\",\n";
-                ss << u8"    \"jaJP\": \"忍耐\",\n";
-                ss << u8"    \"ptBR\": \"Paciência\",\n";
-                ss << u8"    \"ruRU\": \"Терпение\",\n";
-                ss << u8"    \"zhCN\": \"耐心\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20602,\n";
-                ss << u8"    \"Key\": \"Runeword97\",\n";
-                ss << u8"    \"enUS\": \"Pattern\",\n";
-                ss << u8"    \"zhTW\": \"圖紋\",\n";
-                ss << u8"    \"deDE\": \"Prasseln\",\n";
-                ss << u8"    \"esES\": \"Patrón\",\n";
-                ss << u8"    \"frFR\": \"Patron\",\n";
-                ss << u8"    \"itIT\": \"Trama\",\n";
-                ss << u8"    \"koKR\": \"귀감\",\n";
-                ss << u8"    \"plPL\": \"Wzorzec\",\n";
-                ss << u8"    \"esMX\": \"Patrón\",\n";
-                ss << u8"    \"jaJP\": \"模範\",\n";
-                ss << u8"    \"ptBR\": \"Padrão\",\n";
-                ss << u8"    \"ruRU\": \"Узор\",\n";
-                ss << u8"    \"zhCN\": \"典范\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20603,\n";
-                ss << u8"    \"Key\": \"Runeword98\",\n";
-                ss << u8"    \"enUS\": \"Peace\",\n";
-                ss << u8"    \"zhTW\": \"和平\",\n";
-                ss << u8"    \"deDE\": \"Frieden\",\n";
-                ss << u8"    \"esES\": \"Paz\",\n";
-                ss << u8"    \"frFR\": \"Paix\",\n";
-                ss << u8"    \"itIT\": \"Pace\",\n";
-                ss << u8"    \"koKR\": \"평화\",\n";
-                ss << u8"    \"plPL\": \"Pokój\",\n";
-                ss << u8"    \"esMX\": \"Paz\",\n";
-                ss << u8"    \"jaJP\": \"平和\",\n";
-                ss << u8"    \"ptBR\": \"Paz\",\n";
-                ss << u8"    \"ruRU\": \"Мир\",\n";
-                ss << u8"    \"zhCN\": \"平和\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20604,\n";
-                ss << u8"    \"Key\": \"Runeword99\",\n";
-                ss << u8"    \"enUS\": \"Voice of Reason\",\n";
-                ss << u8"    \"zhTW\": \"理性之聲\",\n";
-                ss << u8"    \"deDE\": \"Stimme der Vernunft\",\n";
-                ss << u8"    \"esES\": \"Voz de la razón\",\n";
-                ss << u8"    \"frFR\": \"Voix de la raison\",\n";
-                ss << u8"    \"itIT\": \"Voce della Ragione\",\n";
-                ss << u8"    \"koKR\": \"이성의 목소리\",\n";
-                ss << u8"    \"plPL\": \"Głos Rozsądku\",\n";
-                ss << u8"    \"esMX\": \"Voz de la razón\",\n";
-                ss << u8"    \"jaJP\": \"理知の声\",\n";
-                ss << u8"    \"ptBR\": \"Voz da Razão\",\n";
-                ss << u8"    \"ruRU\": \"Голос разума\",\n";
-                ss << u8"    \"zhCN\": \"理智之声\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20605,\n";
-                ss << u8"    \"Key\": \"Runeword100\",\n";
-                ss << u8"    \"enUS\": \"Penitence\",\n";
-                ss << u8"    \"zhTW\": \"懺悔\",\n";
-                ss << u8"    \"deDE\": \"Reue\",\n";
-                ss << u8"    \"esES\": \"Penitencia\",\n";
-                ss << u8"    \"frFR\": \"Pénitence\",\n";
-                ss << u8"    \"itIT\": \"Penitenza\",\n";
-                ss << u8"    \"koKR\": \"참회\",\n";
-                ss << u8"    \"plPL\": \"Skrucha\",\n";
-                ss << u8"    \"esMX\": \"Penitencia\",\n";
-                ss << u8"    \"jaJP\": \"懺悔\",\n";
-                ss << u8"    \"ptBR\": \"Penitência\",\n";
-                ss << u8"    \"ruRU\": \"Покаяние\",\n";
-                ss << u8"    \"zhCN\": \"忏悔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20606,\n";
-                ss << u8"    \"Key\": \"Runeword101\",\n";
-                ss << u8"    \"enUS\": \"Peril\",\n";
-                ss << u8"    \"zhTW\": \"危害\",\n";
-                ss << u8"    \"deDE\": \"Gefahr\",\n";
-                ss << u8"    \"esES\": \"Peligro\",\n";
-                ss << u8"    \"frFR\": \"Péril\",\n";
-                ss << u8"    \"itIT\": \"Pericolo\",\n";
-                ss << u8"    \"koKR\": \"위기\",\n";
-                ss << u8"    \"plPL\": \"Niebezpieczeństwo\",\n";
-                ss << u8"    \"esMX\": \"Riesgo\",\n";
-                ss << u8"    \"jaJP\": \"危機\",\n";
-                ss << u8"    \"ptBR\": \"Perigo\",\n";
-                ss << u8"    \"ruRU\": \"Опасность\",\n";
-                ss << u8"    \"zhCN\": \"灾劫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20607,\n";
-                ss << u8"    \"Key\": \"Runeword102\",\n";
-                ss << u8"    \"enUS\": \"Pestilence\",\n";
-                ss << u8"    \"zhTW\": \"疫病\",\n";
-                ss << u8"    \"deDE\": \"Pestilenz\",\n";
-                ss << u8"    \"esES\": \"Pestilencia\",\n";
-                ss << u8"    \"frFR\": \"Pestilence\",\n";
-                ss << u8"    \"itIT\": \"Pestilenza\",\n";
-                ss << u8"    \"koKR\": \"질병\",\n";
-                ss << u8"    \"plPL\": \"Zaraza\",\n";
-                ss << u8"    \"esMX\": \"Pestilencia\",\n";
-                ss << u8"    \"jaJP\": \"悪疫\",\n";
-                ss << u8"    \"ptBR\": \"Pestilência\",\n";
-                ss << u8"    \"ruRU\": \"Мор\",\n";
-                ss << u8"    \"zhCN\": \"疾病\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20608,\n";
-                ss << u8"    \"Key\": \"Runeword103\",\n";
-                ss << u8"    \"enUS\": \"Phoenix\",\n";
-                ss << u8"    \"zhTW\": \"鳳凰\",\n";
-                ss << u8"    \"deDE\": \"Phönix\",\n";
-                ss << u8"    \"esES\": \"Fénix\",\n";
-                ss << u8"    \"frFR\": \"Phénix\",\n";
-                ss << u8"    \"itIT\": \"Fenice\",\n";
-                ss << u8"    \"koKR\": \"불사조\",\n";
-                ss << u8"    \"plPL\": \"Feniks\",\n";
-                ss << u8"    \"esMX\": \"Fénix\",\n";
-                ss << u8"    \"jaJP\": \"不死鳥\",\n";
-                ss << u8"    \"ptBR\": \"Fênix\",\n";
-                ss << u8"    \"ruRU\": \"Феникс\",\n";
-                ss << u8"    \"zhCN\": \"凤凰\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20609,\n";
-                ss << u8"    \"Key\": \"Runeword104\",\n";
-                ss << u8"    \"enUS\": \"Piety\",\n";
-                ss << u8"    \"zhTW\": \"虔誠\",\n";
-                ss << u8"    \"deDE\": \"Frömmigkeit\",\n";
-                ss << u8"    \"esES\": \"Piedad\",\n";
-                ss << u8"    \"frFR\": \"Piété\",\n";
-                ss << u8"    \"itIT\": \"Pietà\",\n";
-                ss << u8"    \"koKR\": \"경건\",\n";
-                ss << u8"    \"plPL\": \"Pobożność\",\n";
-                ss << u8"    \"esMX\": \"Piedad\",\n";
-                ss << u8"    \"jaJP\": \"敬神\",\n";
-                ss << u8"    \"ptBR\": \"Piedade\",\n";
-                ss << u8"    \"ruRU\": \"Благочестие\",\n";
-                ss << u8"    \"zhCN\": \"虔敬\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20610,\n";
-                ss << u8"    \"Key\": \"Runeword105\",\n";
-                ss << u8"    \"enUS\": \"Pillar of Faith\",\n";
-                ss << u8"    \"zhTW\": \"信念之柱\",\n";
-                ss << u8"    \"deDE\": \"Säule des Glaubens\",\n";
-                ss << u8"    \"esES\": \"Pilar de fe\",\n";
-                ss << u8"    \"frFR\": \"Pilier de la foi\",\n";
-                ss << u8"    \"itIT\": \"Pilastro della Fede\",\n";
-                ss << u8"    \"koKR\": \"신념의 기둥\",\n";
-                ss << u8"    \"plPL\": \"Filar Wiary\",\n";
-                ss << u8"    \"esMX\": \"Pilar de fe\",\n";
-                ss << u8"    \"jaJP\": \"信仰の柱\",\n";
-                ss << u8"    \"ptBR\": \"Pilar da Fé\",\n";
-                ss << u8"    \"ruRU\": \"Столп веры\",\n";
-                ss << u8"    \"zhCN\": \"信念之柱\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20611,\n";
-                ss << u8"    \"Key\": \"Runeword106\",\n";
-                ss << u8"    \"enUS\": \"Plague\",\n";
-                ss << u8"    \"zhTW\": \"瘟疫\",\n";
-                ss << u8"    \"deDE\": \"Pest\",\n";
-                ss << u8"    \"esES\": \"Peste\",\n";
-                ss << u8"    \"frFR\": \"Peste\",\n";
-                ss << u8"    \"itIT\": \"Contagio\",\n";
-                ss << u8"    \"koKR\": \"역병\",\n";
-                ss << u8"    \"plPL\": \"Plaga\",\n";
-                ss << u8"    \"esMX\": \"Peste\",\n";
-                ss << u8"    \"jaJP\": \"災厄\",\n";
-                ss << u8"    \"ptBR\": \"Peste\",\n";
-                ss << u8"    \"ruRU\": \"Чума\",\n";
-                ss << u8"    \"zhCN\": \"瘟疫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20612,\n";
-                ss << u8"    \"Key\": \"Runeword107\",\n";
-                ss << u8"    \"enUS\": \"Praise\",\n";
-                ss << u8"    \"zhTW\": \"頌揚\",\n";
-                ss << u8"    \"deDE\": \"Lobpreisung\",\n";
-                ss << u8"    \"esES\": \"Alabanza\",\n";
-                ss << u8"    \"frFR\": \"Louange\",\n";
-                ss << u8"    \"itIT\": \"Lode\",\n";
-                ss << u8"    \"koKR\": \"칭송\",\n";
-                ss << u8"    \"plPL\": \"Pochwała\",\n";
-                ss << u8"    \"esMX\": \"Loa\",\n";
-                ss << u8"    \"jaJP\": \"賛美\",\n";
-                ss << u8"    \"ptBR\": \"Louvor\",\n";
-                ss << u8"    \"ruRU\": \"Похвала\",\n";
-                ss << u8"    \"zhCN\": \"赞美\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20613,\n";
-                ss << u8"    \"Key\": \"Runeword108\",\n";
-                ss << u8"    \"enUS\": \"Prayer\",\n";
-                ss << u8"    \"zhTW\": \"祈禱\",\n";
-                ss << u8"    \"deDE\": \"Gebet\",\n";
-                ss << u8"    \"esES\": \"Oración\",\n";
-                ss << u8"    \"frFR\": \"Prière\",\n";
-                ss << u8"    \"itIT\": \"Preghiera\",\n";
-                ss << u8"    \"koKR\": \"기도\",\n";
-                ss << u8"    \"plPL\": \"Modlitwa\",\n";
-                ss << u8"    \"esMX\": \"Plegaria\",\n";
-                ss << u8"    \"jaJP\": \"祈願\",\n";
-                ss << u8"    \"ptBR\": \"Prece\",\n";
-                ss << u8"    \"ruRU\": \"Молитва\",\n";
-                ss << u8"    \"zhCN\": \"祈祷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20614,\n";
-                ss << u8"    \"Key\": \"Runeword109\",\n";
-                ss << u8"    \"enUS\": \"Pride\",\n";
-                ss << u8"    \"zhTW\": \"驕傲\",\n";
-                ss << u8"    \"deDE\": \"Stolz\",\n";
-                ss << u8"    \"esES\": \"Orgullo\",\n";
-                ss << u8"    \"frFR\": \"Fierté\",\n";
-                ss << u8"    \"itIT\": \"Superbia\",\n";
-                ss << u8"    \"koKR\": \"긍지\",\n";
-                ss << u8"    \"plPL\": \"Duma\",\n";
-                ss << u8"    \"esMX\": \"Orgullo\",\n";
-                ss << u8"    \"jaJP\": \"誇り\",\n";
-                ss << u8"    \"ptBR\": \"Orgulho\",\n";
-                ss << u8"    \"ruRU\": \"Гордость\",\n";
-                ss << u8"    \"zhCN\": \"骄傲\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20615,\n";
-                ss << u8"    \"Key\": \"Runeword110\",\n";
-                ss << u8"    \"enUS\": \"Principle\",\n";
-                ss << u8"    \"zhTW\": \"原則\",\n";
-                ss << u8"    \"deDE\": \"Prinzip\",\n";
-                ss << u8"    \"esES\": \"Principio\",\n";
-                ss << u8"    \"frFR\": \"Principe\",\n";
-                ss << u8"    \"itIT\": \"Principio\",\n";
-                ss << u8"    \"koKR\": \"원칙\",\n";
-                ss << u8"    \"plPL\": \"Zasada\",\n";
-                ss << u8"    \"esMX\": \"Principio\",\n";
-                ss << u8"    \"jaJP\": \"原理\",\n";
-                ss << u8"    \"ptBR\": \"Princípio\",\n";
-                ss << u8"    \"ruRU\": \"Убеждение\",\n";
-                ss << u8"    \"zhCN\": \"信条\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20616,\n";
-                ss << u8"    \"Key\": \"Runeword111\",\n";
-                ss << u8"    \"enUS\": \"Prowess in Battle\",\n";
-                ss << u8"    \"zhTW\": \"勇戰之力\",\n";
-                ss << u8"    \"deDE\": \"Tapferkeit im Kampf\",\n";
-                ss << u8"    \"esES\": \"Habilidad en combate\",\n";
-                ss << u8"    \"frFR\": \"Prouesse\",\n";
-                ss << u8"    \"itIT\": \"Prodezza\",\n";
-                ss << u8"    \"koKR\": \"전장의 기량\",\n";
-                ss << u8"    \"plPL\": \"Sprawność Bojowa\",\n";
-                ss << u8"    \"esMX\": \"Destreza en combate\",\n";
-                ss << u8"    \"jaJP\": \"武勇\",\n";
-                ss << u8"    \"ptBR\": \"Perícia em Batalha\",\n";
-                ss << u8"    \"ruRU\": \"Доблесть\",\n";
-                ss << u8"    \"zhCN\": \"战力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20617,\n";
-                ss << u8"    \"Key\": \"Runeword112\",\n";
-                ss << u8"    \"enUS\": \"Prudence\",\n";
-                ss << u8"    \"zhTW\": \"謹慎\",\n";
-                ss << u8"    \"deDE\": \"Besonnenheit\",\n";
-                ss << u8"    \"esES\": \"Prudencia\",\n";
-                ss << u8"    \"frFR\": \"Prudence\",\n";
-                ss << u8"    \"itIT\": \"Prudenza\",\n";
-                ss << u8"    \"koKR\": \"신중\",\n";
-                ss << u8"    \"plPL\": \"Rozwaga\",\n";
-                ss << u8"    \"esMX\": \"Prudencia\",\n";
-                ss << u8"    \"jaJP\": \"分別\",\n";
-                ss << u8"    \"ptBR\": \"Prudência\",\n";
-                ss << u8"    \"ruRU\": \"Благоразумие\",\n";
-                ss << u8"    \"zhCN\": \"谨慎\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20618,\n";
-                ss << u8"    \"Key\": \"Runeword113\",\n";
-                ss << u8"    \"enUS\": \"Punishment\",\n";
-                ss << u8"    \"zhTW\": \"懲罰\",\n";
-                ss << u8"    \"deDE\": \"Strafe\",\n";
-                ss << u8"    \"esES\": \"Castigo\",\n";
-                ss << u8"    \"frFR\": \"Punition\",\n";
-                ss << u8"    \"itIT\": \"Punizione\",\n";
-                ss << u8"    \"koKR\": \"징벌\",\n";
-                ss << u8"    \"plPL\": \"Kara\",\n";
-                ss << u8"    \"esMX\": \"Castigo\",\n";
-                ss << u8"    \"jaJP\": \"罰\",\n";
-                ss << u8"    \"ptBR\": \"Punição\",\n";
-                ss << u8"    \"ruRU\": \"Наказание\",\n";
-                ss << u8"    \"zhCN\": \"惩罚\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20619,\n";
-                ss << u8"    \"Key\": \"Runeword114\",\n";
-                ss << u8"    \"enUS\": \"Purity\",\n";
-                ss << u8"    \"zhTW\": \"純潔\",\n";
-                ss << u8"    \"deDE\": \"Reinheit\",\n";
-                ss << u8"    \"esES\": \"Pureza\",\n";
-                ss << u8"    \"frFR\": \"Pureté\",\n";
-                ss << u8"    \"itIT\": \"Purezza\",\n";
-                ss << u8"    \"koKR\": \"순수\",\n";
-                ss << u8"    \"plPL\": \"Czystość\",\n";
-                ss << u8"    \"esMX\": \"Pureza\",\n";
-                ss << u8"    \"jaJP\": \"純粋\",\n";
-                ss << u8"    \"ptBR\": \"Pureza\",\n";
-                ss << u8"    \"ruRU\": \"Чистота\",\n";
-                ss << u8"    \"zhCN\": \"纯洁\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20620,\n";
-                ss << u8"    \"Key\": \"Runeword115\",\n";
-                ss << u8"    \"enUS\": \"Question\",\n";
-                ss << u8"    \"zhTW\": \"疑問\",\n";
-                ss << u8"    \"deDE\": \"Frage\",\n";
-                ss << u8"    \"esES\": \"Duda\",\n";
-                ss << u8"    \"frFR\": \"Question\",\n";
-                ss << u8"    \"itIT\": \"Quesito\",\n";
-                ss << u8"    \"koKR\": \"의문\",\n";
-                ss << u8"    \"plPL\": \"Pytanie\",\n";
-                ss << u8"    \"esMX\": \"Pregunta\",\n";
-                ss << u8"    \"jaJP\": \"疑問\",\n";
-                ss << u8"    \"ptBR\": \"Questão\",\n";
-                ss << u8"    \"ruRU\": \"Вопрос\",\n";
-                ss << u8"    \"zhCN\": \"质问\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20621,\n";
-                ss << u8"    \"Key\": \"Runeword116\",\n";
-                ss << u8"    \"enUS\": \"Radiance\",\n";
-                ss << u8"    \"zhTW\": \"光輝\",\n";
-                ss << u8"    \"deDE\": \"Glanz\",\n";
-                ss << u8"    \"esES\": \"Resplandor\",\n";
-                ss << u8"    \"frFR\": \"Rayon\",\n";
-                ss << u8"    \"itIT\": \"Fulgore\",\n";
-                ss << u8"    \"koKR\": \"광휘\",\n";
-                ss << u8"    \"plPL\": \"Blask\",\n";
-                ss << u8"    \"esMX\": \"Resplandor\",\n";
-                ss << u8"    \"jaJP\": \"輝き\",\n";
-                ss << u8"    \"ptBR\": \"Luminosidade\",\n";
-                ss << u8"    \"ruRU\": \"Сияние\",\n";
-                ss << u8"    \"zhCN\": \"光辉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20622,\n";
-                ss << u8"    \"Key\": \"Runeword117\",\n";
-                ss << u8"    \"enUS\": \"Rain\",\n";
-                ss << u8"    \"zhTW\": \"降雨\",\n";
-                ss << u8"    \"deDE\": \"Regen\",\n";
-                ss << u8"    \"esES\": \"Lluvia\",\n";
-                ss << u8"    \"frFR\": \"Pluie\",\n";
-                ss << u8"    \"itIT\": \"Pioggia\",\n";
-                ss << u8"    \"koKR\": \"비\",\n";
-                ss << u8"    \"plPL\": \"Deszcz\",\n";
-                ss << u8"    \"esMX\": \"Lluvia\",\n";
-                ss << u8"    \"jaJP\": \"雨\",\n";
-                ss << u8"    \"ptBR\": \"Chuva\",\n";
-                ss << u8"    \"ruRU\": \"Ливень\",\n";
-                ss << u8"    \"zhCN\": \"暴雨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20623,\n";
-                ss << u8"    \"Key\": \"Runeword118\",\n";
-                ss << u8"    \"enUS\": \"Reason\",\n";
-                ss << u8"    \"zhTW\": \"理由\",\n";
-                ss << u8"    \"deDE\": \"Vernunft\",\n";
-                ss << u8"    \"esES\": \"Razón\",\n";
-                ss << u8"    \"frFR\": \"Raison\",\n";
-                ss << u8"    \"itIT\": \"Ragione\",\n";
-                ss << u8"    \"koKR\": \"이성\",\n";
-                ss << u8"    \"plPL\": \"Rozsądek\",\n";
-                ss << u8"    \"esMX\": \"Razón\",\n";
-                ss << u8"    \"jaJP\": \"理性\",\n";
-                ss << u8"    \"ptBR\": \"Razão\",\n";
-                ss << u8"    \"ruRU\": \"Разум\",\n";
-                ss << u8"    \"zhCN\": \"理性\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20624,\n";
-                ss << u8"    \"Key\": \"Runeword119\",\n";
-                ss << u8"    \"enUS\": \"Red\",\n";
-                ss << u8"    \"zhTW\": \"鮮紅\",\n";
-                ss << u8"    \"deDE\": \"Röte\",\n";
-                ss << u8"    \"esES\": \"Rojez\",\n";
-                ss << u8"    \"frFR\": \"Rouge\",\n";
-                ss << u8"    \"itIT\": \"Rosso\",\n";
-                ss << u8"    \"koKR\": \"핏빛\",\n";
-                ss << u8"    \"plPL\": \"Czerwień\",\n";
-                ss << u8"    \"esMX\": \"Rojo\",\n";
-                ss << u8"    \"jaJP\": \"赤\",\n";
-                ss << u8"    \"ptBR\": \"Vermelho\",\n";
-                ss << u8"    \"ruRU\": \"Багрянец\",\n";
-                ss << u8"    \"zhCN\": \"绯红\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20625,\n";
-                ss << u8"    \"Key\": \"Runeword120\",\n";
-                ss << u8"    \"enUS\": \"Rhyme\",\n";
-                ss << u8"    \"zhTW\": \"聲韻\",\n";
-                ss << u8"    \"deDE\": \"Reim\",\n";
-                ss << u8"    \"esES\": \"Rima\",\n";
-                ss << u8"    \"frFR\": \"Rime\",\n";
-                ss << u8"    \"itIT\": \"Rima\",\n";
-                ss << u8"    \"koKR\": \"각운\",\n";
-                ss << u8"    \"plPL\": \"Rym\",\n";
-                ss << u8"    \"esMX\": \"Rima\",\n";
-                ss << u8"    \"jaJP\": \"韻\",\n";
-                ss << u8"    \"ptBR\": \"Rima\",\n";
-                ss << u8"    \"ruRU\": \"Рифма\",\n";
-                ss << u8"    \"zhCN\": \"韵律\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20626,\n";
-                ss << u8"    \"Key\": \"Runeword121\",\n";
-                ss << u8"    \"enUS\": \"Rift\",\n";
-                ss << u8"    \"zhTW\": \"裂隙\",\n";
-                ss << u8"    \"deDE\": \"Zerrissenheit\",\n";
-                ss << u8"    \"esES\": \"Grieta\",\n";
-                ss << u8"    \"frFR\": \"Rupture\",\n";
-                ss << u8"    \"itIT\": \"Varco\",\n";
-                ss << u8"    \"koKR\": \"균열\",\n";
-                ss << u8"    \"plPL\": \"Szczelina\",\n";
-                ss << u8"    \"esMX\": \"Grieta\",\n";
-                ss << u8"    \"jaJP\": \"不和\",\n";
-                ss << u8"    \"ptBR\": \"Fenda\",\n";
-                ss << u8"    \"ruRU\": \"Разлом\",\n";
-                ss << u8"    \"zhCN\": \"裂隙\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20627,\n";
-                ss << u8"    \"Key\": \"Runeword122\",\n";
-                ss << u8"    \"enUS\": \"Sanctuary\",\n";
-                ss << u8"    \"zhTW\": \"聖堂\",\n";
-                ss << u8"    \"deDE\": \"Zuflucht\",\n";
-                ss << u8"    \"esES\": \"Santuario\",\n";
-                ss << u8"    \"frFR\": \"Sanctuaire\",\n";
-                ss << u8"    \"itIT\": \"Santuario\",\n";
-                ss << u8"    \"koKR\": \"성역\",\n";
-                ss << u8"    \"plPL\": \"Sanktuarium\",\n";
-                ss << u8"    \"esMX\": \"Santuario\",\n";
-                ss << u8"    \"jaJP\": \"聖域\",\n";
-                ss << u8"    \"ptBR\": \"Santuário\",\n";
-                ss << u8"    \"ruRU\": \"Убежище\",\n";
-                ss << u8"    \"zhCN\": \"庇护\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20628,\n";
-                ss << u8"    \"Key\": \"Runeword123\",\n";
-                ss << u8"    \"enUS\": \"Serendipity\",\n";
-                ss << u8"    \"zhTW\": \"機緣\",\n";
-                ss << u8"    \"deDE\": \"Glückseligkeit\",\n";
-                ss << u8"    \"esES\": \"Serendipia\",\n";
-                ss << u8"    \"frFR\": \"Veine\",\n";
-                ss << u8"    \"itIT\": \"Serendipità\",\n";
-                ss << u8"    \"koKR\": \"우연한 행운\",\n";
-                ss << u8"    \"plPL\": \"Łut Szczęścia\",\n";
-                ss << u8"    \"esMX\": \"Serendipia\",\n";
-                ss << u8"    \"jaJP\": \"僥倖\",\n";
-                ss << u8"    \"ptBR\": \"Acaso\",\n";
-                ss << u8"    \"ruRU\": \"Прозорливость\",\n";
-                ss << u8"    \"zhCN\": \"奇遇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20629,\n";
-                ss << u8"    \"Key\": \"Runeword124\",\n";
-                ss << u8"    \"enUS\": \"Shadow\",\n";
-                ss << u8"    \"zhTW\": \"暗影\",\n";
-                ss << u8"    \"deDE\": \"Schatten\",\n";
-                ss << u8"    \"esES\": \"Sombra\",\n";
-                ss << u8"    \"frFR\": \"Ombre\",\n";
-                ss << u8"    \"itIT\": \"Ombra\",\n";
-                ss << u8"    \"koKR\": \"그림자\",\n";
-                ss << u8"    \"plPL\": \"Cień\",\n";
-                ss << u8"    \"esMX\": \"Sombra\",\n";
-                ss << u8"    \"jaJP\": \"闇\",\n";
-                ss << u8"    \"ptBR\": \"Sombra\",\n";
-                ss << u8"    \"ruRU\": \"Тень\",\n";
-                ss << u8"    \"zhCN\": \"阴影\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20630,\n";
-                ss << u8"    \"Key\": \"Runeword125\",\n";
-                ss << u8"    \"enUS\": \"Shadow of Doubt\",\n";
-                ss << u8"    \"zhTW\": \"懷疑之影\",\n";
-                ss << u8"    \"deDE\": \"Schatten des Zweifels\",\n";
-                ss << u8"    \"esES\": \"Sombra de duda\",\n";
-                ss << u8"    \"frFR\": \"Ombre du doute\",\n";
-                ss << u8"    \"itIT\": \"Ombra del Dubbio\",\n";
-                ss << u8"    \"koKR\": \"의심의 그림자\",\n";
-                ss << u8"    \"plPL\": \"Cień Wątpliwości\",\n";
-                ss << u8"    \"esMX\": \"Sombra de la duda\",\n";
-                ss << u8"    \"jaJP\": \"疑惑の影\",\n";
-                ss << u8"    \"ptBR\": \"Sombra da Dúvida\",\n";
-                ss << u8"    \"ruRU\": \"Тень сомнения\",\n";
-                ss << u8"    \"zhCN\": \"疑虑之影\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20631,\n";
-                ss << u8"    \"Key\": \"Runeword126\",\n";
-                ss << u8"    \"enUS\": \"Silence\",\n";
-                ss << u8"    \"zhTW\": \"寂靜\",\n";
-                ss << u8"    \"deDE\": \"Stille\",\n";
-                ss << u8"    \"esES\": \"Silencio\",\n";
-                ss << u8"    \"frFR\": \"Silence\",\n";
-                ss << u8"    \"itIT\": \"Silenzio\",\n";
-                ss << u8"    \"koKR\": \"침묵\",\n";
-                ss << u8"    \"plPL\": \"Cisza\",\n";
-                ss << u8"    \"esMX\": \"Silencio\",\n";
-                ss << u8"    \"jaJP\": \"静寂\",\n";
-                ss << u8"    \"ptBR\": \"Silêncio\",\n";
-                ss << u8"    \"ruRU\": \"Безмолвие\",\n";
-                ss << u8"    \"zhCN\": \"沉默\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20632,\n";
-                ss << u8"    \"Key\": \"Runeword127\",\n";
-                ss << u8"    \"enUS\": \"Siren's Song\",\n";
-                ss << u8"    \"zhTW\": \"賽蓮之歌\",\n";
-                ss << u8"    \"deDE\": \"Sirenengesang\",\n";
-                ss << u8"    \"esES\": \"Canto de sirena\",\n";
-                ss << u8"    \"frFR\": \"Sirène\",\n";
-                ss << u8"    \"itIT\": \"Canto della Sirena\",\n";
-                ss << u8"    \"koKR\": \"세이렌의 노래\",\n";
-                ss << u8"    \"plPL\": \"Pieśń Syreny\",\n";
-                ss << u8"    \"esMX\": \"Canto de sirena\",\n";
-                ss << u8"    \"jaJP\": \"セイレーンの歌\",\n";
-                ss << u8"    \"ptBR\": \"Canto da Sirena\",\n";
-                ss << u8"    \"ruRU\": \"Песнь сирены\",\n";
-                ss << u8"    \"zhCN\": \"海妖之歌\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20633,\n";
-                ss << u8"    \"Key\": \"Runeword128\",\n";
-                ss << u8"    \"enUS\": \"Smoke\",\n";
-                ss << u8"    \"zhTW\": \"煙霧\",\n";
-                ss << u8"    \"deDE\": \"Rauch\",\n";
-                ss << u8"    \"esES\": \"Humo\",\n";
-                ss << u8"    \"frFR\": \"Fumée\",\n";
-                ss << u8"    \"itIT\": \"Fumo\",\n";
-                ss << u8"    \"koKR\": \"연기\",\n";
-                ss << u8"    \"plPL\": \"Dym\",\n";
-                ss << u8"    \"esMX\": \"Humo\",\n";
-                ss << u8"    \"jaJP\": \"煙\",\n";
-                ss << u8"    \"ptBR\": \"Fumaça\",\n";
-                ss << u8"    \"ruRU\": \"Дым\",\n";
-                ss << u8"    \"zhCN\": \"烟雾\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20634,\n";
-                ss << u8"    \"Key\": \"Runeword129\",\n";
-                ss << u8"    \"enUS\": \"Sorrow\",\n";
-                ss << u8"    \"zhTW\": \"哀傷\",\n";
-                ss << u8"    \"deDE\": \"Traurigkeit\",\n";
-                ss << u8"    \"esES\": \"Tristeza\",\n";
-                ss << u8"    \"frFR\": \"Tristesse\",\n";
-                ss << u8"    \"itIT\": \"Rimorso\",\n";
-                ss << u8"    \"koKR\": \"비탄\",\n";
-                ss << u8"    \"plPL\": \"Smutek\",\n";
-                ss << u8"    \"esMX\": \"Melancolía\",\n";
-                ss << u8"    \"jaJP\": \"悲哀\",\n";
-                ss << u8"    \"ptBR\": \"Mágoa\",\n";
-                ss << u8"    \"ruRU\": \"Скорбь\",\n";
-                ss << u8"    \"zhCN\": \"悲伤\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20635,\n";
-                ss << u8"    \"Key\": \"Runeword130\",\n";
-                ss << u8"    \"enUS\": \"Spirit\",\n";
-                ss << u8"    \"zhTW\": \"精神\",\n";
-                ss << u8"    \"deDE\": \"Geist\",\n";
-                ss << u8"    \"esES\": \"Espíritu\",\n";
-                ss << u8"    \"frFR\": \"Esprit\",\n";
-                ss << u8"    \"itIT\": \"Spirito\",\n";
-                ss << u8"    \"koKR\": \"영혼\",\n";
-                ss << u8"    \"plPL\": \"Duch\",\n";
-                ss << u8"    \"esMX\": \"Espíritu\",\n";
-                ss << u8"    \"jaJP\": \"精霊\",\n";
-                ss << u8"    \"ptBR\": \"Espírito\",\n";
-                ss << u8"    \"ruRU\": \"Дух\",\n";
-                ss << u8"    \"zhCN\": \"精神\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20636,\n";
-                ss << u8"    \"Key\": \"Runeword131\",\n";
-                ss << u8"    \"enUS\": \"Splendor\",\n";
-                ss << u8"    \"zhTW\": \"燦爛\",\n";
-                ss << u8"    \"deDE\": \"Pracht\",\n";
-                ss << u8"    \"esES\": \"Esplendor\",\n";
-                ss << u8"    \"frFR\": \"Splendeur\",\n";
-                ss << u8"    \"itIT\": \"Splendore\",\n";
-                ss << u8"    \"koKR\": \"광채\",\n";
-                ss << u8"    \"plPL\": \"Splendor\",\n";
-                ss << u8"    \"esMX\": \"Esplendor\",\n";
-                ss << u8"    \"jaJP\": \"壮麗\",\n";
-                ss << u8"    \"ptBR\": \"Esplendor\",\n";
-                ss << u8"    \"ruRU\": \"Великолепие\",\n";
-                ss << u8"    \"zhCN\": \"壮美\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20637,\n";
-                ss << u8"    \"Key\": \"Runeword132\",\n";
-                ss << u8"    \"enUS\": \"Starlight\",\n";
-                ss << u8"    \"zhTW\": \"星光\",\n";
-                ss << u8"    \"deDE\": \"Sternenlicht\",\n";
-                ss << u8"    \"esES\": \"Luz de las estrellas\",\n";
-                ss << u8"    \"frFR\": \"Lumière stellaire\",\n";
-                ss << u8"    \"itIT\": \"Luce Stellare\",\n";
-                ss << u8"    \"koKR\": \"별빛\",\n";
-                ss << u8"    \"plPL\": \"Światło Gwiazd\",\n";
-                ss << u8"    \"esMX\": \"Luz estelar\",\n";
-                ss << u8"    \"jaJP\": \"星の光\",\n";
-                ss << u8"    \"ptBR\": \"Luz Estelar\",\n";
-                ss << u8"    \"ruRU\": \"Звездный свет\",\n";
-                ss << u8"    \"zhCN\": \"星光\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20638,\n";
-                ss << u8"    \"Key\": \"Runeword133\",\n";
-                ss << u8"    \"enUS\": \"Stealth\",\n";
-                ss << u8"    \"zhTW\": \"隱密\",\n";
-                ss << u8"    \"deDE\": \"Verstohlenheit\",\n";
-                ss << u8"    \"esES\": \"Sigilo\",\n";
-                ss << u8"    \"frFR\": \"Discrétion\",\n";
-                ss << u8"    \"itIT\": \"Furtività\",\n";
-                ss << u8"    \"koKR\": \"잠행\",\n";
-                ss << u8"    \"plPL\": \"Skradanie\",\n";
-                ss << u8"    \"esMX\": \"Sigilo\",\n";
-                ss << u8"    \"jaJP\": \"隠密\",\n";
-                ss << u8"    \"ptBR\": \"Furtividade\",\n";
-                ss << u8"    \"ruRU\": \"Незаметность\",\n";
-                ss << u8"    \"zhCN\": \"隐秘\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20639,\n";
-                ss << u8"    \"Key\": \"Runeword134\",\n";
-                ss << u8"    \"enUS\": \"Steel\",\n";
-                ss << u8"    \"zhTW\": \"鋼鐵\",\n";
-                ss << u8"    \"deDE\": \"Stahl\",\n";
-                ss << u8"    \"esES\": \"Acero\",\n";
-                ss << u8"    \"frFR\": \"Acier\",\n";
-                ss << u8"    \"itIT\": \"Acciaio\",\n";
-                ss << u8"    \"koKR\": \"강철\",\n";
-                ss << u8"    \"plPL\": \"Stal\",\n";
-                ss << u8"    \"esMX\": \"Acero\",\n";
-                ss << u8"    \"jaJP\": \"鋼\",\n";
-                ss << u8"    \"ptBR\": \"Aço\",\n";
-                ss << u8"    \"ruRU\": \"Сталь\",\n";
-                ss << u8"    \"zhCN\": \"钢铁\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20640,\n";
-                ss << u8"    \"Key\": \"Runeword135\",\n";
-                ss << u8"    \"enUS\": \"Still Water\",\n";
-                ss << u8"    \"zhTW\": \"寂靜之水\",\n";
-                ss << u8"    \"deDE\": \"Stilles Wasser\",\n";
-                ss << u8"    \"esES\": \"Aguas tranquilas\",\n";
-                ss << u8"    \"frFR\": \"Eaux calmes\",\n";
-                ss << u8"    \"itIT\": \"Acqua Ferma\",\n";
-                ss << u8"    \"koKR\": \"고요한 물\",\n";
-                ss << u8"    \"plPL\": \"Spokojna Woda\",\n";
-                ss << u8"    \"esMX\": \"Agua estancada\",\n";
-                ss << u8"    \"jaJP\": \"淀み\",\n";
-                ss << u8"    \"ptBR\": \"Água Parada\",\n";
-                ss << u8"    \"ruRU\": \"Тихие воды\",\n";
-                ss << u8"    \"zhCN\": \"止水\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20641,\n";
-                ss << u8"    \"Key\": \"Runeword136\",\n";
-                ss << u8"    \"enUS\": \"Sting\",\n";
-                ss << u8"    \"zhTW\": \"螫刺\",\n";
-                ss << u8"    \"deDE\": \"Stachel\",\n";
-                ss << u8"    \"esES\": \"Aguijón\",\n";
-                ss << u8"    \"frFR\": \"Piqûre\",\n";
-                ss << u8"    \"itIT\": \"Pungiglione\",\n";
-                ss << u8"    \"koKR\": \"쐐기\",\n";
-                ss << u8"    \"plPL\": \"Żądło\",\n";
-                ss << u8"    \"esMX\": \"Aguijón\",\n";
-                ss << u8"    \"jaJP\": \"痛烈\",\n";
-                ss << u8"    \"ptBR\": \"Picada\",\n";
-                ss << u8"    \"ruRU\": \"Жало\",\n";
-                ss << u8"    \"zhCN\": \"钉刺\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20642,\n";
-                ss << u8"    \"Key\": \"Runeword137\",\n";
-                ss << u8"    \"enUS\": \"Stone\",\n";
-                ss << u8"    \"zhTW\": \"石塊\",\n";
-                ss << u8"    \"deDE\": \"Stein\",\n";
-                ss << u8"    \"esES\": \"Roca\",\n";
-                ss << u8"    \"frFR\": \"Pierre\",\n";
-                ss << u8"    \"itIT\": \"Pietra\",\n";
-                ss << u8"    \"koKR\": \"돌\",\n";
-                ss << u8"    \"plPL\": \"Kamień\",\n";
-                ss << u8"    \"esMX\": \"Piedra\",\n";
-                ss << u8"    \"jaJP\": \"石\",\n";
-                ss << u8"    \"ptBR\": \"Pedra\",\n";
-                ss << u8"    \"ruRU\": \"Камень\",\n";
-                ss << u8"    \"zhCN\": \"磐石\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20643,\n";
-                ss << u8"    \"Key\": \"Runeword138\",\n";
-                ss << u8"    \"enUS\": \"Storm\",\n";
-                ss << u8"    \"zhTW\": \"風暴\",\n";
-                ss << u8"    \"deDE\": \"Sturm\",\n";
-                ss << u8"    \"esES\": \"Tormenta\",\n";
-                ss << u8"    \"frFR\": \"Orage\",\n";
-                ss << u8"    \"itIT\": \"Ciclone\",\n";
-                ss << u8"    \"koKR\": \"폭풍\",\n";
-                ss << u8"    \"plPL\": \"Nawałnica\",\n";
-                ss << u8"    \"esMX\": \"Tormenta\",\n";
-                ss << u8"    \"jaJP\": \"嵐\",\n";
-                ss << u8"    \"ptBR\": \"Tempestade\",\n";
-                ss << u8"    \"ruRU\": \"Шторм\",\n";
-                ss << u8"    \"zhCN\": \"风暴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20644,\n";
-                ss << u8"    \"Key\": \"Runeword139\",\n";
-                ss << u8"    \"enUS\": \"Strength\",\n";
-                ss << u8"    \"zhTW\": \"力量\",\n";
-                ss << u8"    \"deDE\": \"Stärke\",\n";
-                ss << u8"    \"esES\": \"Fuerza\",\n";
-                ss << u8"    \"frFR\": \"Force\",\n";
-                ss << u8"    \"itIT\": \"Forza\",\n";
-                ss << u8"    \"koKR\": \"강함\",\n";
-                ss << u8"    \"plPL\": \"Siła\",\n";
-                ss << u8"    \"esMX\": \"Fuerza\",\n";
-                ss << u8"    \"jaJP\": \"力\",\n";
-                ss << u8"    \"ptBR\": \"Força\",\n";
-                ss << u8"    \"ruRU\": \"Сила\",\n";
-                ss << u8"    \"zhCN\": \"力量\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20645,\n";
-                ss << u8"    \"Key\": \"Runeword140\",\n";
-                ss << u8"    \"enUS\": \"Tempest\",\n";
-                ss << u8"    \"zhTW\": \"暴風雨\",\n";
-                ss << u8"    \"deDE\": \"Orkan\",\n";
-                ss << u8"    \"esES\": \"Tempestad\",\n";
-                ss << u8"    \"frFR\": \"Tempête\",\n";
-                ss << u8"    \"itIT\": \"Tempesta\",\n";
-                ss << u8"    \"koKR\": \"비바람\",\n";
-                ss << u8"    \"plPL\": \"Burza\",\n";
-                ss << u8"    \"esMX\": \"Tempestad\",\n";
-                ss << u8"    \"jaJP\": \"波乱\",\n";
-                ss << u8"    \"ptBR\": \"Tormenta\",\n";
-                ss << u8"    \"ruRU\": \"Буря\",\n";
-                ss << u8"    \"zhCN\": \"暴风雨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20646,\n";
-                ss << u8"    \"Key\": \"Runeword141\",\n";
-                ss << u8"    \"enUS\": \"Temptation\",\n";
-                ss << u8"    \"zhTW\": \"誘惑\",\n";
-                ss << u8"    \"deDE\": \"Versuchung\",\n";
-                ss << u8"    \"esES\": \"Tentación\",\n";
-                ss << u8"    \"frFR\": \"Tentation\",\n";
-                ss << u8"    \"itIT\": \"Tentazione\",\n";
-                ss << u8"    \"koKR\": \"유혹\",\n";
-                ss << u8"    \"plPL\": \"Pokusa\",\n";
-                ss << u8"    \"esMX\": \"Tentación\",\n";
-                ss << u8"    \"jaJP\": \"誘惑\",\n";
-                ss << u8"    \"ptBR\": \"Tentação\",\n";
-                ss << u8"    \"ruRU\": \"Искушение\",\n";
-                ss << u8"    \"zhCN\": \"诱惑\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20647,\n";
-                ss << u8"    \"Key\": \"Runeword142\",\n";
-                ss << u8"    \"enUS\": \"Terror\",\n";
-                ss << u8"    \"zhTW\": \"恐佈\",\n";
-                ss << u8"    \"deDE\": \"Terror\",\n";
-                ss << u8"    \"esES\": \"Terror\",\n";
-                ss << u8"    \"frFR\": \"Terreur\",\n";
-                ss << u8"    \"itIT\": \"Orrore\",\n";
-                ss << u8"    \"koKR\": \"공포\",\n";
-                ss << u8"    \"plPL\": \"Groza\",\n";
-                ss << u8"    \"esMX\": \"Terror\",\n";
-                ss << u8"    \"jaJP\": \"恐怖\",\n";
-                ss << u8"    \"ptBR\": \"Terror\",\n";
-                ss << u8"    \"ruRU\": \"Кошмар\",\n";
-                ss << u8"    \"zhCN\": \"恐惧\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20648,\n";
-                ss << u8"    \"Key\": \"Runeword143\",\n";
-                ss << u8"    \"enUS\": \"Thirst\",\n";
-                ss << u8"    \"zhTW\": \"飢渴\",\n";
-                ss << u8"    \"deDE\": \"Durst\",\n";
-                ss << u8"    \"esES\": \"Sed\",\n";
-                ss << u8"    \"frFR\": \"Soif\",\n";
-                ss << u8"    \"itIT\": \"Sete\",\n";
-                ss << u8"    \"koKR\": \"갈증\",\n";
-                ss << u8"    \"plPL\": \"Pragnienie\",\n";
-                ss << u8"    \"esMX\": \"Sed\",\n";
-                ss << u8"    \"jaJP\": \"渇望\",\n";
-                ss << u8"    \"ptBR\": \"Sede\",\n";
-                ss << u8"    \"ruRU\": \"Жажда\",\n";
-                ss << u8"    \"zhCN\": \"渴求\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20649,\n";
-                ss << u8"    \"Key\": \"Runeword144\",\n";
-                ss << u8"    \"enUS\": \"Thought\",\n";
-                ss << u8"    \"zhTW\": \"思維\",\n";
-                ss << u8"    \"deDE\": \"Gedanke\",\n";
-                ss << u8"    \"esES\": \"Pensamiento\",\n";
-                ss << u8"    \"frFR\": \"Stoïque\",\n";
-                ss << u8"    \"itIT\": \"Pensiero\",\n";
-                ss << u8"    \"koKR\": \"사고\",\n";
-                ss << u8"    \"plPL\": \"Myśl\",\n";
-                ss << u8"    \"esMX\": \"Pensamiento\",\n";
-                ss << u8"    \"jaJP\": \"思考\",\n";
-                ss << u8"    \"ptBR\": \"Pensamento\",\n";
-                ss << u8"    \"ruRU\": \"Мысль\",\n";
-                ss << u8"    \"zhCN\": \"思绪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20650,\n";
-                ss << u8"    \"Key\": \"Runeword145\",\n";
-                ss << u8"    \"enUS\": \"Thunder\",\n";
-                ss << u8"    \"zhTW\": \"雷霆\",\n";
-                ss << u8"    \"deDE\": \"Donner\",\n";
-                ss << u8"    \"esES\": \"Trueno\",\n";
-                ss << u8"    \"frFR\": \"Tonnerre\",\n";
-                ss << u8"    \"itIT\": \"Tuono\",\n";
-                ss << u8"    \"koKR\": \"천둥\",\n";
-                ss << u8"    \"plPL\": \"Grom\",\n";
-                ss << u8"    \"esMX\": \"Trueno\",\n";
-                ss << u8"    \"jaJP\": \"稲妻\",\n";
-                ss << u8"    \"ptBR\": \"Trovão\",\n";
-                ss << u8"    \"ruRU\": \"Гром\",\n";
-                ss << u8"    \"zhCN\": \"雷霆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20651,\n";
-                ss << u8"    \"Key\": \"Runeword146\",\n";
-                ss << u8"    \"enUS\": \"Time\",\n";
-                ss << u8"    \"zhTW\": \"時間\",\n";
-                ss << u8"    \"deDE\": \"Zeit\",\n";
-                ss << u8"    \"esES\": \"Tiempo\",\n";
-                ss << u8"    \"frFR\": \"Temps\",\n";
-                ss << u8"    \"itIT\": \"Tempo\",\n";
-                ss << u8"    \"koKR\": \"시간\",\n";
-                ss << u8"    \"plPL\": \"Czas\",\n";
-                ss << u8"    \"esMX\": \"Tiempo\",\n";
-                ss << u8"    \"jaJP\": \"時間\",\n";
-                ss << u8"    \"ptBR\": \"Tempo\",\n";
-                ss << u8"    \"ruRU\": \"Время\",\n";
-                ss << u8"    \"zhCN\": \"时光\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20652,\n";
-                ss << u8"    \"Key\": \"Runeword147\",\n";
-                ss << u8"    \"enUS\": \"Tradition\",\n";
-                ss << u8"    \"zhTW\": \"傳統\",\n";
-                ss << u8"    \"deDE\": \"Tradition\",\n";
-                ss << u8"    \"esES\": \"Tradición\",\n";
-                ss << u8"    \"frFR\": \"Tradition\",\n";
-                ss << u8"    \"itIT\": \"Tradizione\",\n";
-                ss << u8"    \"koKR\": \"전통\",\n";
-                ss << u8"    \"plPL\": \"Tradycja\",\n";
-                ss << u8"    \"esMX\": \"Tradición\",\n";
-                ss << u8"    \"jaJP\": \"伝統\",\n";
-                ss << u8"    \"ptBR\": \"Tradição\",\n";
-                ss << u8"    \"ruRU\": \"Традиция\",\n";
-                ss << u8"    \"zhCN\": \"传统\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20653,\n";
-                ss << u8"    \"Key\": \"Runeword148\",\n";
-                ss << u8"    \"enUS\": \"Treachery\",\n";
-                ss << u8"    \"zhTW\": \"背信\",\n";
-                ss << u8"    \"deDE\": \"Verrat\",\n";
-                ss << u8"    \"esES\": \"Traición\",\n";
-                ss << u8"    \"frFR\": \"Traîtrise\",\n";
-                ss << u8"    \"itIT\": \"Tradimento\",\n";
-                ss << u8"    \"koKR\": \"배신\",\n";
-                ss << u8"    \"plPL\": \"Zdrada\",\n";
-                ss << u8"    \"esMX\": \"Traición\",\n";
-                ss << u8"    \"jaJP\": \"不信\",\n";
-                ss << u8"    \"ptBR\": \"Deslealdade\",\n";
-                ss << u8"    \"ruRU\": \"Вероломство\",\n";
-                ss << u8"    \"zhCN\": \"背叛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20654,\n";
-                ss << u8"    \"Key\": \"Runeword149\",\n";
-                ss << u8"    \"enUS\": \"Trust\",\n";
-                ss << u8"    \"zhTW\": \"信任\",\n";
-                ss << u8"    \"deDE\": \"Vertrauen\",\n";
-                ss << u8"    \"esES\": \"Confianza\",\n";
-                ss << u8"    \"frFR\": \"Confiance\",\n";
-                ss << u8"    \"itIT\": \"Fiducia\",\n";
-                ss << u8"    \"koKR\": \"신임\",\n";
-                ss << u8"    \"plPL\": \"Zaufanie\",\n";
-                ss << u8"    \"esMX\": \"Confianza\",\n";
-                ss << u8"    \"jaJP\": \"信頼\",\n";
-                ss << u8"    \"ptBR\": \"Confiança\",\n";
-                ss << u8"    \"ruRU\": \"Доверие\",\n";
-                ss << u8"    \"zhCN\": \"信任\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20655,\n";
-                ss << u8"    \"Key\": \"Runeword150\",\n";
-                ss << u8"    \"enUS\": \"Truth\",\n";
-                ss << u8"    \"zhTW\": \"真理\",\n";
-                ss << u8"    \"deDE\": \"Wahrheit\",\n";
-                ss << u8"    \"esES\": \"Verdad\",\n";
-                ss << u8"    \"frFR\": \"Vérité\",\n";
-                ss << u8"    \"itIT\": \"Verità\",\n";
-                ss << u8"    \"koKR\": \"진실\",\n";
-                ss << u8"    \"plPL\": \"Prawda\",\n";
-                ss << u8"    \"esMX\": \"Verdad\",\n";
-                ss << u8"    \"jaJP\": \"真実\",\n";
-                ss << u8"    \"ptBR\": \"Verdade\",\n";
-                ss << u8"    \"ruRU\": \"Правда\",\n";
-                ss << u8"    \"zhCN\": \"真理\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20656,\n";
-                ss << u8"    \"Key\": \"Runeword151\",\n";
-                ss << u8"    \"enUS\": \"Unbending Will\",\n";
-                ss << u8"    \"zhTW\": \"不屈意志\",\n";
-                ss << u8"    \"deDE\": \"Unbeugsamer Wille\",\n";
-                ss << u8"    \"esES\": \"Voluntad de hierro\",\n";
-                ss << u8"    \"frFR\": \"Volonté inébranlable\",\n";
-                ss << u8"    \"itIT\": \"Volontà di Ferro\",\n";
-                ss << u8"    \"koKR\": \"불굴의 의지\",\n";
-                ss << u8"    \"plPL\": \"Nieugięta Wola\",\n";
-                ss << u8"    \"esMX\": \"Voluntad inflexible\",\n";
-                ss << u8"    \"jaJP\": \"恒心\",\n";
-                ss << u8"    \"ptBR\": \"Determinação\",\n";
-                ss << u8"    \"ruRU\": \"Непреклонность\",\n";
-                ss << u8"    \"zhCN\": \"不屈之志\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20657,\n";
-                ss << u8"    \"Key\": \"Runeword152\",\n";
-                ss << u8"    \"enUS\": \"Valor\",\n";
-                ss << u8"    \"zhTW\": \"英勇\",\n";
-                ss << u8"    \"deDE\": \"Heldenmut\",\n";
-                ss << u8"    \"esES\": \"Valor\",\n";
-                ss << u8"    \"frFR\": \"Valeur\",\n";
-                ss << u8"    \"itIT\": \"Valore\",\n";
-                ss << u8"    \"koKR\": \"용기\",\n";
-                ss << u8"    \"plPL\": \"Odwaga\",\n";
-                ss << u8"    \"esMX\": \"Valor\",\n";
-                ss << u8"    \"jaJP\": \"勇敢\",\n";
-                ss << u8"    \"ptBR\": \"Bravura\",\n";
-                ss << u8"    \"ruRU\": \"Отвага\",\n";
-                ss << u8"    \"zhCN\": \"勇气\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20658,\n";
-                ss << u8"    \"Key\": \"Runeword153\",\n";
-                ss << u8"    \"enUS\": \"Vengeance\",\n";
-                ss << u8"    \"zhTW\": \"復仇\",\n";
-                ss << u8"    \"deDE\": \"Rache\",\n";
-                ss << u8"    \"esES\": \"Venganza\",\n";
-                ss << u8"    \"frFR\": \"Vengeance\",\n";
-                ss << u8"    \"itIT\": \"Vendetta\",\n";
-                ss << u8"    \"koKR\": \"복수\",\n";
-                ss << u8"    \"plPL\": \"Zemsta\",\n";
-                ss << u8"    \"esMX\": \"Venganza\",\n";
-                ss << u8"    \"jaJP\": \"報復\",\n";
-                ss << u8"    \"ptBR\": \"Vingança\",\n";
-                ss << u8"    \"ruRU\": \"Отмщение\",\n";
-                ss << u8"    \"zhCN\": \"复仇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20659,\n";
-                ss << u8"    \"Key\": \"Runeword154\",\n";
-                ss << u8"    \"enUS\": \"Venom\",\n";
-                ss << u8"    \"zhTW\": \"劇毒\",\n";
-                ss << u8"    \"deDE\": \"Geifer\",\n";
-                ss << u8"    \"esES\": \"Ponzoña\",\n";
-                ss << u8"    \"frFR\": \"Venin\",\n";
-                ss << u8"    \"itIT\": \"Veleno\",\n";
-                ss << u8"    \"koKR\": \"맹독\",\n";
-                ss << u8"    \"plPL\": \"Jad\",\n";
-                ss << u8"    \"esMX\": \"Veneno\",\n";
-                ss << u8"    \"jaJP\": \"毒\",\n";
-                ss << u8"    \"ptBR\": \"Veneno\",\n";
-                ss << u8"    \"ruRU\": \"Яд\",\n";
-                ss << u8"    \"zhCN\": \"毒液\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20660,\n";
-                ss << u8"    \"Key\": \"Runeword155\",\n";
-                ss << u8"    \"enUS\": \"Victory\",\n";
-                ss << u8"    \"zhTW\": \"勝利\",\n";
-                ss << u8"    \"deDE\": \"Sieg\",\n";
-                ss << u8"    \"esES\": \"Victoria\",\n";
-                ss << u8"    \"frFR\": \"Victoire\",\n";
-                ss << u8"    \"itIT\": \"Vittoria\",\n";
-                ss << u8"    \"koKR\": \"승리\",\n";
-                ss << u8"    \"plPL\": \"Zwycięstwo\",\n";
-                ss << u8"    \"esMX\": \"Victoria\",\n";
-                ss << u8"    \"jaJP\": \"勝利\",\n";
-                ss << u8"    \"ptBR\": \"Vitória\",\n";
-                ss << u8"    \"ruRU\": \"Победа\",\n";
-                ss << u8"    \"zhCN\": \"胜利\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20661,\n";
-                ss << u8"    \"Key\": \"Runeword156\",\n";
-                ss << u8"    \"enUS\": \"Voice\",\n";
-                ss << u8"    \"zhTW\": \"聲音\",\n";
-                ss << u8"    \"deDE\": \"Stimme\",\n";
-                ss << u8"    \"esES\": \"Voz\",\n";
-                ss << u8"    \"frFR\": \"Voix\",\n";
-                ss << u8"    \"itIT\": \"Voce\",\n";
-                ss << u8"    \"koKR\": \"목소리\",\n";
-                ss << u8"    \"plPL\": \"Głos\",\n";
-                ss << u8"    \"esMX\": \"Voz\",\n";
-                ss << u8"    \"jaJP\": \"声\",\n";
-                ss << u8"    \"ptBR\": \"Voz\",\n";
-                ss << u8"    \"ruRU\": \"Голос\",\n";
-                ss << u8"    \"zhCN\": \"声音\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20662,\n";
-                ss << u8"    \"Key\": \"Runeword157\",\n";
-                ss << u8"    \"enUS\": \"Void\",\n";
-                ss << u8"    \"zhTW\": \"虛無\",\n";
-                ss << u8"    \"deDE\": \"[ms]leerer[fs]leere[ns]leeres[pl]leere\",\n";
-                ss << u8"    \"esES\": \"Vacío\",\n";
-                ss << u8"    \"frFR\": \"Vide\",\n";
-                ss << u8"    \"itIT\": \"Vuoto\",\n";
-                ss << u8"    \"koKR\": \"공허\",\n";
-                ss << u8"    \"plPL\": \"Pustka\",\n";
-                ss << u8"    \"esMX\": \"Vacío\",\n";
-                ss << u8"    \"jaJP\": \"虚無\",\n";
-                ss << u8"    \"ptBR\": \"Vazio\",\n";
-                ss << u8"    \"ruRU\": \"Бездна\",\n";
-                ss << u8"    \"zhCN\": \"虚空\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20663,\n";
-                ss << u8"    \"Key\": \"Runeword158\",\n";
-                ss << u8"    \"enUS\": \"War\",\n";
-                ss << u8"    \"zhTW\": \"戰爭\",\n";
-                ss << u8"    \"deDE\": \"Krieg\",\n";
-                ss << u8"    \"esES\": \"Guerra\",\n";
-                ss << u8"    \"frFR\": \"Guerre\",\n";
-                ss << u8"    \"itIT\": \"Guerra\",\n";
-                ss << u8"    \"koKR\": \"전쟁\",\n";
-                ss << u8"    \"plPL\": \"Wojna\",\n";
-                ss << u8"    \"esMX\": \"Guerra\",\n";
-                ss << u8"    \"jaJP\": \"戦争\",\n";
-                ss << u8"    \"ptBR\": \"Guerra\",\n";
-                ss << u8"    \"ruRU\": \"Война\",\n";
-                ss << u8"    \"zhCN\": \"战争\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20664,\n";
-                ss << u8"    \"Key\": \"Runeword159\",\n";
-                ss << u8"    \"enUS\": \"Water\",\n";
-                ss << u8"    \"zhTW\": \"清水\",\n";
-                ss << u8"    \"deDE\": \"Wasser\",\n";
-                ss << u8"    \"esES\": \"Agua\",\n";
-                ss << u8"    \"frFR\": \"Eau\",\n";
-                ss << u8"    \"itIT\": \"Acqua\",\n";
-                ss << u8"    \"koKR\": \"물\",\n";
-                ss << u8"    \"plPL\": \"Woda\",\n";
-                ss << u8"    \"esMX\": \"Agua\",\n";
-                ss << u8"    \"jaJP\": \"水\",\n";
-                ss << u8"    \"ptBR\": \"Água\",\n";
-                ss << u8"    \"ruRU\": \"Вода\",\n";
-                ss << u8"    \"zhCN\": \"源水\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20665,\n";
-                ss << u8"    \"Key\": \"Runeword160\",\n";
-                ss << u8"    \"enUS\": \"Wealth\",\n";
-                ss << u8"    \"zhTW\": \"財富\",\n";
-                ss << u8"    \"deDE\": \"Wohlstand\",\n";
-                ss << u8"    \"esES\": \"Riqueza\",\n";
-                ss << u8"    \"frFR\": \"Richesse\",\n";
-                ss << u8"    \"itIT\": \"Ricchezza\",\n";
-                ss << u8"    \"koKR\": \"부\",\n";
-                ss << u8"    \"plPL\": \"Bogactwo\",\n";
-                ss << u8"    \"esMX\": \"Riqueza\",\n";
-                ss << u8"    \"jaJP\": \"富\",\n";
-                ss << u8"    \"ptBR\": \"Riqueza\",\n";
-                ss << u8"    \"ruRU\": \"Изобилие\",\n";
-                ss << u8"    \"zhCN\": \"财富\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20666,\n";
-                ss << u8"    \"Key\": \"Runeword161\",\n";
-                ss << u8"    \"enUS\": \"Whisper\",\n";
-                ss << u8"    \"zhTW\": \"低語\",\n";
-                ss << u8"    \"deDE\": \"Flüstern\",\n";
-                ss << u8"    \"esES\": \"Susurro\",\n";
-                ss << u8"    \"frFR\": \"Murmure\",\n";
-                ss << u8"    \"itIT\": \"Sussurro\",\n";
-                ss << u8"    \"koKR\": \"속삭임\",\n";
-                ss << u8"    \"plPL\": \"Szept\",\n";
-                ss << u8"    \"esMX\": \"Susurro\",\n";
-                ss << u8"    \"jaJP\": \"囁き\",\n";
-                ss << u8"    \"ptBR\": \"Sussurro\",\n";
-                ss << u8"    \"ruRU\": \"Шепот\",\n";
-                ss << u8"    \"zhCN\": \"低语\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20667,\n";
-                ss << u8"    \"Key\": \"Runeword162\",\n";
-                ss << u8"    \"enUS\": \"White\",\n";
-                ss << u8"    \"zhTW\": \"蒼白\",\n";
-                ss << u8"    \"deDE\": \"Weiß\",\n";
-                ss << u8"    \"esES\": \"Blancura\",\n";
-                ss << u8"    \"frFR\": \"Blancheur\",\n";
-                ss << u8"    \"itIT\": \"Bianco\",\n";
-                ss << u8"    \"koKR\": \"순백\",\n";
-                ss << u8"    \"plPL\": \"Biel\",\n";
-                ss << u8"    \"esMX\": \"Blanco\",\n";
-                ss << u8"    \"jaJP\": \"白\",\n";
-                ss << u8"    \"ptBR\": \"Branco\",\n";
-                ss << u8"    \"ruRU\": \"Белизна\",\n";
-                ss << u8"    \"zhCN\": \"白色\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20668,\n";
-                ss << u8"    \"Key\": \"Runeword163\",\n";
-                ss << u8"    \"enUS\": \"Wind\",\n";
-                ss << u8"    \"zhTW\": \"輕風\",\n";
-                ss << u8"    \"deDE\": \"Wind\",\n";
-                ss << u8"    \"esES\": \"Viento\",\n";
-                ss << u8"    \"frFR\": \"Vent\",\n";
-                ss << u8"    \"itIT\": \"Vento\",\n";
-                ss << u8"    \"koKR\": \"바람\",\n";
-                ss << u8"    \"plPL\": \"Wiatr\",\n";
-                ss << u8"    \"esMX\": \"Viento\",\n";
-                ss << u8"    \"jaJP\": \"風\",\n";
-                ss << u8"    \"ptBR\": \"Vento\",\n";
-                ss << u8"    \"ruRU\": \"Ветер\",\n";
-                ss << u8"    \"zhCN\": \"疾风\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20669,\n";
-                ss << u8"    \"Key\": \"Runeword164\",\n";
-                ss << u8"    \"enUS\": \"Wings of Hope\",\n";
-                ss << u8"    \"zhTW\": \"希望之翼\",\n";
-                ss << u8"    \"deDE\": \"Schwingen der Hoffnung\",\n";
-                ss << u8"    \"esES\": \"Alas de esperanza\",\n";
-                ss << u8"    \"frFR\": \"Ailes de l’espoir\",\n";
-                ss << u8"    \"itIT\": \"Ali della Speranza\",\n";
-                ss << u8"    \"koKR\": \"희망의 날개\",\n";
-                ss << u8"    \"plPL\": \"Wiatr Nadziei\",\n";
-                ss << u8"    \"esMX\": \"Alas de esperanza\",\n";
-                ss << u8"    \"jaJP\": \"希望の翼\",\n";
-                ss << u8"    \"ptBR\": \"Asas da Esperança\",\n";
-                ss << u8"    \"ruRU\": \"Крылья надежды\",\n";
-                ss << u8"    \"zhCN\": \"希望之翼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20670,\n";
-                ss << u8"    \"Key\": \"Runeword165\",\n";
-                ss << u8"    \"enUS\": \"Wisdom\",\n";
-                ss << u8"    \"zhTW\": \"智慧\",\n";
-                ss << u8"    \"deDE\": \"Weisheit\",\n";
-                ss << u8"    \"esES\": \"Sabiduría\",\n";
-                ss << u8"    \"frFR\": \"Sagesse\",\n";
-                ss << u8"    \"itIT\": \"Saggezza\",\n";
-                ss << u8"    \"koKR\": \"지혜\",\n";
-                ss << u8"    \"plPL\": \"Mądrość\",\n";
-                ss << u8"    \"esMX\": \"Sabiduría\",\n";
-                ss << u8"    \"jaJP\": \"英知\",\n";
-                ss << u8"    \"ptBR\": \"Sabedoria\",\n";
-                ss << u8"    \"ruRU\": \"Мудрость\",\n";
-                ss << u8"    \"zhCN\": \"智慧\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20671,\n";
-                ss << u8"    \"Key\": \"Runeword166\",\n";
-                ss << u8"    \"enUS\": \"Woe\",\n";
-                ss << u8"    \"zhTW\": \"悲痛\",\n";
-                ss << u8"    \"deDE\": \"Unglück\",\n";
-                ss << u8"    \"esES\": \"Aflicción\",\n";
-                ss << u8"    \"frFR\": \"Malheur\",\n";
-                ss << u8"    \"itIT\": \"Pena\",\n";
-                ss << u8"    \"koKR\": \"재난\",\n";
-                ss << u8"    \"plPL\": \"Nieszczęście\",\n";
-                ss << u8"    \"esMX\": \"Aflicción\",\n";
-                ss << u8"    \"jaJP\": \"苦悩\",\n";
-                ss << u8"    \"ptBR\": \"Angústia\",\n";
-                ss << u8"    \"ruRU\": \"Горе\",\n";
-                ss << u8"    \"zhCN\": \"灾祸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20672,\n";
-                ss << u8"    \"Key\": \"Runeword167\",\n";
-                ss << u8"    \"enUS\": \"Wonder\",\n";
-                ss << u8"    \"zhTW\": \"驚奇\",\n";
-                ss << u8"    \"deDE\": \"Wunder\",\n";
-                ss << u8"    \"esES\": \"Asombro\",\n";
-                ss << u8"    \"frFR\": \"Merveille\",\n";
-                ss << u8"    \"itIT\": \"Meraviglia\",\n";
-                ss << u8"    \"koKR\": \"경이\",\n";
-                ss << u8"    \"plPL\": \"Cud\",\n";
-                ss << u8"    \"esMX\": \"Asombro\",\n";
-                ss << u8"    \"jaJP\": \"驚異\",\n";
-                ss << u8"    \"ptBR\": \"Fascínio\",\n";
-                ss << u8"    \"ruRU\": \"Чудо\",\n";
-                ss << u8"    \"zhCN\": \"奇迹\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20673,\n";
-                ss << u8"    \"Key\": \"Runeword168\",\n";
-                ss << u8"    \"enUS\": \"Wrath\",\n";
-                ss << u8"    \"zhTW\": \"憤怒\",\n";
-                ss << u8"    \"deDE\": \"Wut\",\n";
-                ss << u8"    \"esES\": \"Ira\",\n";
-                ss << u8"    \"frFR\": \"Courroux\",\n";
-                ss << u8"    \"itIT\": \"Ira\",\n";
-                ss << u8"    \"koKR\": \"진노\",\n";
-                ss << u8"    \"plPL\": \"Gniew\",\n";
-                ss << u8"    \"esMX\": \"Ira\",\n";
-                ss << u8"    \"jaJP\": \"激怒\",\n";
-                ss << u8"    \"ptBR\": \"Ira\",\n";
-                ss << u8"    \"ruRU\": \"Гнев\",\n";
-                ss << u8"    \"zhCN\": \"怒火\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20674,\n";
-                ss << u8"    \"Key\": \"Runeword169\",\n";
-                ss << u8"    \"enUS\": \"Youth\",\n";
-                ss << u8"    \"zhTW\": \"年輕\",\n";
-                ss << u8"    \"deDE\": \"Jugend\",\n";
-                ss << u8"    \"esES\": \"Juventud\",\n";
-                ss << u8"    \"frFR\": \"Jeunesse\",\n";
-                ss << u8"    \"itIT\": \"Gioventù\",\n";
-                ss << u8"    \"koKR\": \"젊음\",\n";
-                ss << u8"    \"plPL\": \"Młodość\",\n";
-                ss << u8"    \"esMX\": \"Juventud\",\n";
-                ss << u8"    \"jaJP\": \"若さ\",\n";
-                ss << u8"    \"ptBR\": \"Juventude\",\n";
-                ss << u8"    \"ruRU\": \"Юность\",\n";
-                ss << u8"    \"zhCN\": \"青春\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 20675,\n";
-                ss << u8"    \"Key\": \"Runeword170\",\n";
-                ss << u8"    \"enUS\": \"Zephyr\",\n";
-                ss << u8"    \"zhTW\": \"和風\",\n";
-                ss << u8"    \"deDE\": \"Zephyr\",\n";
-                ss << u8"    \"esES\": \"Céfiro\",\n";
-                ss << u8"    \"frFR\": \"Zéphyr\",\n";
-                ss << u8"    \"itIT\": \"Zefiro\",\n";
-                ss << u8"    \"koKR\": \"서풍\",\n";
-                ss << u8"    \"plPL\": \"Zefir\",\n";
-                ss << u8"    \"esMX\": \"Céfiro\",\n";
-                ss << u8"    \"jaJP\": \"軟風\",\n";
-                ss << u8"    \"ptBR\": \"Zefir\",\n";
-                ss << u8"    \"ruRU\": \"Бриз\",\n";
-                ss << u8"    \"zhCN\": \"和风\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27360,\n";
-                ss << u8"    \"Key\": \"Runeword171\",\n";
-                ss << u8"    \"enUS\": \"Hustle\",\n";
-                ss << u8"    \"zhTW\": \"催促\",\n";
-                ss << u8"    \"deDE\": \"Hetze\",\n";
-                ss << u8"    \"esES\": \"Apremio\",\n";
-                ss << u8"    \"frFR\": \"Tumulte\",\n";
-                ss << u8"    \"itIT\": \"Imbroglio\",\n";
-                ss << u8"    \"koKR\": \"투지\",\n";
-                ss << u8"    \"plPL\": \"Zgiełk\",\n";
-                ss << u8"    \"esMX\": \"Apuro\",\n";
-                ss << u8"    \"jaJP\": \"発奮\",\n";
-                ss << u8"    \"ptBR\": \"Agitação\",\n";
-                ss << u8"    \"ruRU\": \"Переполох\",\n";
-                ss << u8"    \"zhCN\": \"喧嚣\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27361,\n";
-                ss << u8"    \"Key\": \"Runeword172\",\n";
-                ss << u8"    \"enUS\": \"Hustle\",\n";
-                ss << u8"    \"zhTW\": \"催促\",\n";
-                ss << u8"    \"deDE\": \"Hetze\",\n";
-                ss << u8"    \"esES\": \"Apremio\",\n";
-                ss << u8"    \"frFR\": \"Tumulte\",\n";
-                ss << u8"    \"itIT\": \"Imbroglio\",\n";
-                ss << u8"    \"koKR\": \"투지\",\n";
-                ss << u8"    \"plPL\": \"Zgiełk\",\n";
-                ss << u8"    \"esMX\": \"Apuro\",\n";
-                ss << u8"    \"jaJP\": \"発奮\",\n";
-                ss << u8"    \"ptBR\": \"Agitação\",\n";
-                ss << u8"    \"ruRU\": \"Переполох\",\n";
-                ss << u8"    \"zhCN\": \"喧嚣\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27362,\n";
-                ss << u8"    \"Key\": \"Runeword173\",\n";
-                ss << u8"    \"enUS\": \"Mosaic\",\n";
-                ss << u8"    \"zhTW\": \"嵌飾\",\n";
-                ss << u8"    \"deDE\": \"Mosaik\",\n";
-                ss << u8"    \"esES\": \"Mosaico\",\n";
-                ss << u8"    \"frFR\": \"Mosaïque\",\n";
-                ss << u8"    \"itIT\": \"Mosaico\",\n";
-                ss << u8"    \"koKR\": \"모자이크\",\n";
-                ss << u8"    \"plPL\": \"Mozaika\",\n";
-                ss << u8"    \"esMX\": \"Mosaico\",\n";
-                ss << u8"    \"jaJP\": \"坩堝\",\n";
-                ss << u8"    \"ptBR\": \"Mosaico\",\n";
-                ss << u8"    \"ruRU\": \"Мозаика\",\n";
-                ss << u8"    \"zhCN\": \"模糊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27363,\n";
-                ss << u8"    \"Key\": \"Runeword174\",\n";
-                ss << u8"    \"enUS\": \"Metamorphosis\",\n";
-                ss << u8"    \"zhTW\": \"變化\",\n";
-                ss << u8"    \"deDE\": \"Metamorphose\",\n";
-                ss << u8"    \"esES\": \"Metamorfosis\",\n";
-                ss << u8"    \"frFR\": \"Métamorphose\",\n";
-                ss << u8"    \"itIT\": \"Metamorfosi\",\n";
-                ss << u8"    \"koKR\": \"탈태\",\n";
-                ss << u8"    \"plPL\": \"Metamorfoza\",\n";
-                ss << u8"    \"esMX\": \"Metamorfosis\",\n";
-                ss << u8"    \"jaJP\": \"変容\",\n";
-                ss << u8"    \"ptBR\": \"Metamorfose\",\n";
-                ss << u8"    \"ruRU\": \"Метаморфоза\",\n";
-                ss << u8"    \"zhCN\": \"变形\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27364,\n";
-                ss << u8"    \"Key\": \"Runeword175\",\n";
-                ss << u8"    \"enUS\": \"Ground\",\n";
-                ss << u8"    \"zhTW\": \"接地\",\n";
-                ss << u8"    \"deDE\": \"Boden\",\n";
-                ss << u8"    \"esES\": \"Tierra\",\n";
-                ss << u8"    \"frFR\": \"Terre\",\n";
-                ss << u8"    \"itIT\": \"Suolo\",\n";
-                ss << u8"    \"koKR\": \"접지\",\n";
-                ss << u8"    \"plPL\": \"Grunt\",\n";
-                ss << u8"    \"esMX\": \"Suelo\",\n";
-                ss << u8"    \"jaJP\": \"大地\",\n";
-                ss << u8"    \"ptBR\": \"Solo\",\n";
-                ss << u8"    \"ruRU\": \"Земля\",\n";
-                ss << u8"    \"zhCN\": \"地面\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27365,\n";
-                ss << u8"    \"Key\": \"Runeword176\",\n";
-                ss << u8"    \"enUS\": \"Temper\",\n";
-                ss << u8"    \"zhTW\": \"和緩\",\n";
-                ss << u8"    \"deDE\": \"Temperament\",\n";
-                ss << u8"    \"esES\": \"Temperamento\",\n";
-                ss << u8"    \"frFR\": \"Tempérament\",\n";
-                ss << u8"    \"itIT\": \"Tempra\",\n";
-                ss << u8"    \"koKR\": \"담금질\",\n";
-                ss << u8"    \"plPL\": \"Charakter\",\n";
-                ss << u8"    \"esMX\": \"Ira\",\n";
-                ss << u8"    \"jaJP\": \"沈着\",\n";
-                ss << u8"    \"ptBR\": \"Índole\",\n";
-                ss << u8"    \"ruRU\": \"Закалка\",\n";
-                ss << u8"    \"zhCN\": \"淬火\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27366,\n";
-                ss << u8"    \"Key\": \"Runeword177\",\n";
-                ss << u8"    \"enUS\": \"Hearth\",\n";
-                ss << u8"    \"zhTW\": \"火爐\",\n";
-                ss << u8"    \"deDE\": \"Heim\",\n";
-                ss << u8"    \"esES\": \"Hogar\",\n";
-                ss << u8"    \"frFR\": \"Âtre\",\n";
-                ss << u8"    \"itIT\": \"Focolare\",\n";
-                ss << u8"    \"koKR\": \"화로\",\n";
-                ss << u8"    \"plPL\": \"Palenisko\",\n";
-                ss << u8"    \"esMX\": \"Corazón\",\n";
-                ss << u8"    \"jaJP\": \"炉辺\",\n";
-                ss << u8"    \"ptBR\": \"Lar\",\n";
-                ss << u8"    \"ruRU\": \"Очаг\",\n";
-                ss << u8"    \"zhCN\": \"壁炉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27367,\n";
-                ss << u8"    \"Key\": \"Runeword178\",\n";
-                ss << u8"    \"enUS\": \"Cure\",\n";
-                ss << u8"    \"zhTW\": \"治癒\",\n";
-                ss << u8"    \"deDE\": \"Heilung\",\n";
-                ss << u8"    \"esES\": \"Cura\",\n";
-                ss << u8"    \"frFR\": \"Remède\",\n";
-                ss << u8"    \"itIT\": \"Cura\",\n";
-                ss << u8"    \"koKR\": \"치료\",\n";
-                ss << u8"    \"plPL\": \"Remedium\",\n";
-                ss << u8"    \"esMX\": \"Cura\",\n";
-                ss << u8"    \"jaJP\": \"治癒\",\n";
-                ss << u8"    \"ptBR\": \"Cura\",\n";
-                ss << u8"    \"ruRU\": \"Лекарство\",\n";
-                ss << u8"    \"zhCN\": \"解药\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27368,\n";
-                ss << u8"    \"Key\": \"Runeword179\",\n";
-                ss << u8"    \"enUS\": \"Bulwark\",\n";
-                ss << u8"    \"zhTW\": \"壁壘\",\n";
-                ss << u8"    \"deDE\": \"Bollwerk\",\n";
-                ss << u8"    \"esES\": \"Baluarte\",\n";
-                ss << u8"    \"frFR\": \"Rempart\",\n";
-                ss << u8"    \"itIT\": \"Baluardo\",\n";
-                ss << u8"    \"koKR\": \"방벽\",\n";
-                ss << u8"    \"plPL\": \"Szaniec\",\n";
-                ss << u8"    \"esMX\": \"Baluarte\",\n";
-                ss << u8"    \"jaJP\": \"防塁\",\n";
-                ss << u8"    \"ptBR\": \"Bastião\",\n";
-                ss << u8"    \"ruRU\": \"Оплот\",\n";
-                ss << u8"    \"zhCN\": \"壁垒\"\n";
-                ss << u8"  }\n";
-                ss << u8"]\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"[\n",
+                u8"  {\n",
+                u8"    \"id\": 10902,\n",
+                u8"    \"Key\": \"r16\",\n",
+                u8"    \"enUS\": \"Io Rune\",\n",
+                u8"    \"zhTW\": \"符文：埃歐\",\n",
+                u8"    \"deDE\": \"[fs]Io-Rune\",\n",
+                u8"    \"esES\": \"Runa Io\",\n",
+                u8"    \"frFR\": \"[fs]Rune Io\",\n",
+                u8"    \"itIT\": \"[fs]Runa Io\",\n",
+                u8"    \"koKR\": \"이오 룬\",\n",
+                u8"    \"plPL\": \"Runa Io\",\n",
+                u8"    \"esMX\": \"Runa Io\",\n",
+                u8"    \"jaJP\": \"イオ・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Io\",\n",
+                u8"    \"ruRU\": \"Руна Ио\",\n",
+                u8"    \"zhCN\": \"艾欧符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10903,\n",
+                u8"    \"Key\": \"r16L\",\n",
+                u8"    \"enUS\": \"Io\",\n",
+                u8"    \"zhTW\": \"埃歐\",\n",
+                u8"    \"deDE\": \"Io\",\n",
+                u8"    \"esES\": \"Io\",\n",
+                u8"    \"frFR\": \"Io\",\n",
+                u8"    \"itIT\": \"Io\",\n",
+                u8"    \"koKR\": \"이오\",\n",
+                u8"    \"plPL\": \"Io\",\n",
+                u8"    \"esMX\": \"Io\",\n",
+                u8"    \"jaJP\": \"イオ\",\n",
+                u8"    \"ptBR\": \"Io\",\n",
+                u8"    \"ruRU\": \"Ио\",\n",
+                u8"    \"zhCN\": \"艾欧\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10904,\n",
+                u8"    \"Key\": \"r13\",\n",
+                u8"    \"enUS\": \"Shael Rune\",\n",
+                u8"    \"zhTW\": \"符文：夏\",\n",
+                u8"    \"deDE\": \"[fs]Shael-Rune\",\n",
+                u8"    \"esES\": \"Runa Shael\",\n",
+                u8"    \"frFR\": \"[fs]Rune Shael\",\n",
+                u8"    \"itIT\": \"[fs]Runa Shael\",\n",
+                u8"    \"koKR\": \"샤엘 룬\",\n",
+                u8"    \"plPL\": \"Runa Shael\",\n",
+                u8"    \"esMX\": \"Runa Shael\",\n",
+                u8"    \"jaJP\": \"シャエル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Shael\",\n",
+                u8"    \"ruRU\": \"Руна Шаэль\",\n",
+                u8"    \"zhCN\": \"沙伊符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10905,\n",
+                u8"    \"Key\": \"r13L\",\n",
+                u8"    \"enUS\": \"Shael\",\n",
+                u8"    \"zhTW\": \"夏\",\n",
+                u8"    \"deDE\": \"Shael\",\n",
+                u8"    \"esES\": \"Shael\",\n",
+                u8"    \"frFR\": \"Shael\",\n",
+                u8"    \"itIT\": \"Shael\",\n",
+                u8"    \"koKR\": \"샤엘\",\n",
+                u8"    \"plPL\": \"Shael\",\n",
+                u8"    \"esMX\": \"Shael\",\n",
+                u8"    \"jaJP\": \"シャエル\",\n",
+                u8"    \"ptBR\": \"Shael\",\n",
+                u8"    \"ruRU\": \"Шаэль\",\n",
+                u8"    \"zhCN\": \"沙伊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10906,\n",
+                u8"    \"Key\": \"r31\",\n",
+                u8"    \"enUS\": \"Jah Rune\",\n",
+                u8"    \"zhTW\": \"符文：喬\",\n",
+                u8"    \"deDE\": \"[fs]Jah-Rune\",\n",
+                u8"    \"esES\": \"Runa Jah\",\n",
+                u8"    \"frFR\": \"[fs]Rune Jah\",\n",
+                u8"    \"itIT\": \"[fs]Runa Jah\",\n",
+                u8"    \"koKR\": \"자 룬\",\n",
+                u8"    \"plPL\": \"Runa Jah\",\n",
+                u8"    \"esMX\": \"Runa Jah\",\n",
+                u8"    \"jaJP\": \"ジャー・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Jah\",\n",
+                u8"    \"ruRU\": \"Руна Джа\",\n",
+                u8"    \"zhCN\": \"扎哈符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10907,\n",
+                u8"    \"Key\": \"r31L\",\n",
+                u8"    \"enUS\": \"Jah\",\n",
+                u8"    \"zhTW\": \"喬\",\n",
+                u8"    \"deDE\": \"Jah\",\n",
+                u8"    \"esES\": \"Jah\",\n",
+                u8"    \"frFR\": \"Jah\",\n",
+                u8"    \"itIT\": \"Jah\",\n",
+                u8"    \"koKR\": \"자\",\n",
+                u8"    \"plPL\": \"Jah\",\n",
+                u8"    \"esMX\": \"Jah\",\n",
+                u8"    \"jaJP\": \"ジャー\",\n",
+                u8"    \"ptBR\": \"Jah\",\n",
+                u8"    \"ruRU\": \"Джа\",\n",
+                u8"    \"zhCN\": \"扎哈\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10910,\n",
+                u8"    \"Key\": \"Runeword22\",\n",
+                u8"    \"enUS\": \"Delirium\",\n",
+                u8"    \"zhTW\": \"精神錯亂\",\n",
+                u8"    \"deDE\": \"Delirium\",\n",
+                u8"    \"esES\": \"Delirio\",\n",
+                u8"    \"frFR\": \"Délire\",\n",
+                u8"    \"itIT\": \"Delirio\",\n",
+                u8"    \"koKR\": \"착란\",\n",
+                u8"    \"plPL\": \"Delirium\",\n",
+                u8"    \"esMX\": \"Delirio\",\n",
+                u8"    \"jaJP\": \"デリリアム\",\n",
+                u8"    \"ptBR\": \"Delírios\",\n",
+                u8"    \"ruRU\": \"Бред\",\n",
+                u8"    \"zhCN\": \"迷狂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20440,\n",
+                u8"    \"Key\": \"r33\",\n",
+                u8"    \"enUS\": \"Zod Rune\",\n",
+                u8"    \"zhTW\": \"符文：薩德\",\n",
+                u8"    \"deDE\": \"[fs]Zod-Rune\",\n",
+                u8"    \"esES\": \"Runa Zod\",\n",
+                u8"    \"frFR\": \"[fs]Rune Zod\",\n",
+                u8"    \"itIT\": \"[fs]Runa Zod\",\n",
+                u8"    \"koKR\": \"조드 룬\",\n",
+                u8"    \"plPL\": \"Runa Zod\",\n",
+                u8"    \"esMX\": \"Runa Zod\",\n",
+                u8"    \"jaJP\": \"ゾッド・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Zod\",\n",
+                u8"    \"ruRU\": \"Руна Зод\",\n",
+                u8"    \"zhCN\": \"佐德符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20441,\n",
+                u8"    \"Key\": \"r32\",\n",
+                u8"    \"enUS\": \"Cham Rune\",\n",
+                u8"    \"zhTW\": \"符文：查姆\",\n",
+                u8"    \"deDE\": \"[fs]Cham-Rune\",\n",
+                u8"    \"esES\": \"Runa Cham\",\n",
+                u8"    \"frFR\": \"[fs]Rune Cham\",\n",
+                u8"    \"itIT\": \"[fs]Runa Cham\",\n",
+                u8"    \"koKR\": \"참 룬\",\n",
+                u8"    \"plPL\": \"Runa Cham\",\n",
+                u8"    \"esMX\": \"Runa Cham\",\n",
+                u8"    \"jaJP\": \"チャム・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Cham\",\n",
+                u8"    \"ruRU\": \"Руна Чам\",\n",
+                u8"    \"zhCN\": \"查姆符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20443,\n",
+                u8"    \"Key\": \"r30\",\n",
+                u8"    \"enUS\": \"Ber Rune\",\n",
+                u8"    \"zhTW\": \"符文：貝\",\n",
+                u8"    \"deDE\": \"[fs]Ber-Rune\",\n",
+                u8"    \"esES\": \"Runa Ber\",\n",
+                u8"    \"frFR\": \"[fs]Rune Ber\",\n",
+                u8"    \"itIT\": \"[fs]Runa Ber\",\n",
+                u8"    \"koKR\": \"베르 룬\",\n",
+                u8"    \"plPL\": \"Runa Ber\",\n",
+                u8"    \"esMX\": \"Runa Ber\",\n",
+                u8"    \"jaJP\": \"バー・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Ber\",\n",
+                u8"    \"ruRU\": \"Руна Бер\",\n",
+                u8"    \"zhCN\": \"贝符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20444,\n",
+                u8"    \"Key\": \"r29\",\n",
+                u8"    \"enUS\": \"Sur Rune\",\n",
+                u8"    \"zhTW\": \"符文：瑟\",\n",
+                u8"    \"deDE\": \"[fs]Sur-Rune\",\n",
+                u8"    \"esES\": \"Runa Sur\",\n",
+                u8"    \"frFR\": \"[fs]Rune Sur\",\n",
+                u8"    \"itIT\": \"[fs]Runa Sur\",\n",
+                u8"    \"koKR\": \"수르 룬\",\n",
+                u8"    \"plPL\": \"Runa Sur\",\n",
+                u8"    \"esMX\": \"Runa Sur\",\n",
+                u8"    \"jaJP\": \"サー・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Sur\",\n",
+                u8"    \"ruRU\": \"Руна Сур\",\n",
+                u8"    \"zhCN\": \"瑟符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20445,\n",
+                u8"    \"Key\": \"r28\",\n",
+                u8"    \"enUS\": \"Lo Rune\",\n",
+                u8"    \"zhTW\": \"符文：羅\",\n",
+                u8"    \"deDE\": \"[fs]Lo-Rune\",\n",
+                u8"    \"esES\": \"Runa Lo\",\n",
+                u8"    \"frFR\": \"[fs]Rune Lo\",\n",
+                u8"    \"itIT\": \"[fs]Runa Lo\",\n",
+                u8"    \"koKR\": \"로 룬\",\n",
+                u8"    \"plPL\": \"Runa Lo\",\n",
+                u8"    \"esMX\": \"Runa Lo\",\n",
+                u8"    \"jaJP\": \"ロー・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Lo\",\n",
+                u8"    \"ruRU\": \"Руна Ло\",\n",
+                u8"    \"zhCN\": \"罗符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20446,\n",
+                u8"    \"Key\": \"r27\",\n",
+                u8"    \"enUS\": \"Ohm Rune\",\n",
+                u8"    \"zhTW\": \"符文：歐姆\",\n",
+                u8"    \"deDE\": \"[fs]Ohm-Rune\",\n",
+                u8"    \"esES\": \"Runa Ohm\",\n",
+                u8"    \"frFR\": \"[fs]Rune Ohm\",\n",
+                u8"    \"itIT\": \"[fs]Runa Ohm\",\n",
+                u8"    \"koKR\": \"오움 룬\",\n",
+                u8"    \"plPL\": \"Runa Ohm\",\n",
+                u8"    \"esMX\": \"Runa Ohm\",\n",
+                u8"    \"jaJP\": \"オーム・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Ohm\",\n",
+                u8"    \"ruRU\": \"Руна Ом\",\n",
+                u8"    \"zhCN\": \"欧姆符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20447,\n",
+                u8"    \"Key\": \"r26\",\n",
+                u8"    \"enUS\": \"Vex Rune\",\n",
+                u8"    \"zhTW\": \"符文：伐克斯\",\n",
+                u8"    \"deDE\": \"[fs]Vex-Rune\",\n",
+                u8"    \"esES\": \"Runa Vex\",\n",
+                u8"    \"frFR\": \"[fs]Rune Vex\",\n",
+                u8"    \"itIT\": \"[fs]Runa Vex\",\n",
+                u8"    \"koKR\": \"벡스 룬\",\n",
+                u8"    \"plPL\": \"Runa Vex\",\n",
+                u8"    \"esMX\": \"Runa Vex\",\n",
+                u8"    \"jaJP\": \"ヴェックス・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Vex\",\n",
+                u8"    \"ruRU\": \"Руна Векс\",\n",
+                u8"    \"zhCN\": \"伐克斯符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20448,\n",
+                u8"    \"Key\": \"r25\",\n",
+                u8"    \"enUS\": \"Gul Rune\",\n",
+                u8"    \"zhTW\": \"符文：古爾\",\n",
+                u8"    \"deDE\": \"[fs]Gul-Rune\",\n",
+                u8"    \"esES\": \"Runa Gul\",\n",
+                u8"    \"frFR\": \"[fs]Rune Gul\",\n",
+                u8"    \"itIT\": \"[fs]Runa Gul\",\n",
+                u8"    \"koKR\": \"굴 룬\",\n",
+                u8"    \"plPL\": \"Runa Gul\",\n",
+                u8"    \"esMX\": \"Runa Gul\",\n",
+                u8"    \"jaJP\": \"ガル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Gul\",\n",
+                u8"    \"ruRU\": \"Руна Гул\",\n",
+                u8"    \"zhCN\": \"古尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20449,\n",
+                u8"    \"Key\": \"r24\",\n",
+                u8"    \"enUS\": \"Ist Rune\",\n",
+                u8"    \"zhTW\": \"符文：伊司特\",\n",
+                u8"    \"deDE\": \"[fs]Ist-Rune\",\n",
+                u8"    \"esES\": \"Runa Ist\",\n",
+                u8"    \"frFR\": \"[fs]Rune Ist\",\n",
+                u8"    \"itIT\": \"[fs]Runa Ist\",\n",
+                u8"    \"koKR\": \"이스트 룬\",\n",
+                u8"    \"plPL\": \"Runa Ist\",\n",
+                u8"    \"esMX\": \"Runa Ist\",\n",
+                u8"    \"jaJP\": \"イスト・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Ist\",\n",
+                u8"    \"ruRU\": \"Руна Ист\",\n",
+                u8"    \"zhCN\": \"伊司特符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20450,\n",
+                u8"    \"Key\": \"r23\",\n",
+                u8"    \"enUS\": \"Mal Rune\",\n",
+                u8"    \"zhTW\": \"符文：馬爾\",\n",
+                u8"    \"deDE\": \"[fs]Mal-Rune\",\n",
+                u8"    \"esES\": \"Runa Mal\",\n",
+                u8"    \"frFR\": \"[fs]Rune Mal\",\n",
+                u8"    \"itIT\": \"[fs]Runa Mal\",\n",
+                u8"    \"koKR\": \"말 룬\",\n",
+                u8"    \"plPL\": \"Runa Mal\",\n",
+                u8"    \"esMX\": \"Runa Mal\",\n",
+                u8"    \"jaJP\": \"マル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Mal\",\n",
+                u8"    \"ruRU\": \"Руна Мал\",\n",
+                u8"    \"zhCN\": \"玛尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20451,\n",
+                u8"    \"Key\": \"r22\",\n",
+                u8"    \"enUS\": \"Um Rune\",\n",
+                u8"    \"zhTW\": \"符文：烏姆\",\n",
+                u8"    \"deDE\": \"[fs]Um-Rune\",\n",
+                u8"    \"esES\": \"Runa Um\",\n",
+                u8"    \"frFR\": \"[fs]Rune Um\",\n",
+                u8"    \"itIT\": \"[fs]Runa Um\",\n",
+                u8"    \"koKR\": \"우움 룬\",\n",
+                u8"    \"plPL\": \"Runa Um\",\n",
+                u8"    \"esMX\": \"Runa Um\",\n",
+                u8"    \"jaJP\": \"アム・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Um\",\n",
+                u8"    \"ruRU\": \"Руна Ум\",\n",
+                u8"    \"zhCN\": \"乌姆符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20452,\n",
+                u8"    \"Key\": \"r21\",\n",
+                u8"    \"enUS\": \"Pul Rune\",\n",
+                u8"    \"zhTW\": \"符文：普爾\",\n",
+                u8"    \"deDE\": \"[fs]Pul-Rune\",\n",
+                u8"    \"esES\": \"Runa Pul\",\n",
+                u8"    \"frFR\": \"[fs]Rune Pul\",\n",
+                u8"    \"itIT\": \"[fs]Runa Pul\",\n",
+                u8"    \"koKR\": \"풀 룬\",\n",
+                u8"    \"plPL\": \"Runa Pul\",\n",
+                u8"    \"esMX\": \"Runa Pul\",\n",
+                u8"    \"jaJP\": \"プル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Pul\",\n",
+                u8"    \"ruRU\": \"Руна Пул\",\n",
+                u8"    \"zhCN\": \"普尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20453,\n",
+                u8"    \"Key\": \"r20\",\n",
+                u8"    \"enUS\": \"Lem Rune\",\n",
+                u8"    \"zhTW\": \"符文：藍姆\",\n",
+                u8"    \"deDE\": \"[fs]Lem-Rune\",\n",
+                u8"    \"esES\": \"Runa Lem\",\n",
+                u8"    \"frFR\": \"[fs]Rune Lem\",\n",
+                u8"    \"itIT\": \"[fs]Runa Lem\",\n",
+                u8"    \"koKR\": \"렘 룬\",\n",
+                u8"    \"plPL\": \"Runa Lem\",\n",
+                u8"    \"esMX\": \"Runa Lem\",\n",
+                u8"    \"jaJP\": \"レム・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Lem\",\n",
+                u8"    \"ruRU\": \"Руна Лем\",\n",
+                u8"    \"zhCN\": \"兰姆符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20454,\n",
+                u8"    \"Key\": \"r19\",\n",
+                u8"    \"enUS\": \"Fal Rune\",\n",
+                u8"    \"zhTW\": \"符文：法爾\",\n",
+                u8"    \"deDE\": \"[fs]Fal-Rune\",\n",
+                u8"    \"esES\": \"Runa Fal\",\n",
+                u8"    \"frFR\": \"[fs]Rune Fal\",\n",
+                u8"    \"itIT\": \"[fs]Runa Fal\",\n",
+                u8"    \"koKR\": \"팔 룬\",\n",
+                u8"    \"plPL\": \"Runa Fal\",\n",
+                u8"    \"esMX\": \"Runa Fal\",\n",
+                u8"    \"jaJP\": \"ファル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Fal\",\n",
+                u8"    \"ruRU\": \"Руна Фал\",\n",
+                u8"    \"zhCN\": \"法尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20455,\n",
+                u8"    \"Key\": \"r18\",\n",
+                u8"    \"enUS\": \"Ko Rune\",\n",
+                u8"    \"zhTW\": \"符文：科\",\n",
+                u8"    \"deDE\": \"[fs]Ko-Rune\",\n",
+                u8"    \"esES\": \"Runa Ko\",\n",
+                u8"    \"frFR\": \"[fs]Rune Ko\",\n",
+                u8"    \"itIT\": \"[fs]Runa Ko\",\n",
+                u8"    \"koKR\": \"코 룬\",\n",
+                u8"    \"plPL\": \"Runa Ko\",\n",
+                u8"    \"esMX\": \"Runa Ko\",\n",
+                u8"    \"jaJP\": \"コー・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Ko\",\n",
+                u8"    \"ruRU\": \"Руна Ко\",\n",
+                u8"    \"zhCN\": \"科符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20456,\n",
+                u8"    \"Key\": \"r17\",\n",
+                u8"    \"enUS\": \"Lum Rune\",\n",
+                u8"    \"zhTW\": \"符文：盧姆\",\n",
+                u8"    \"deDE\": \"[fs]Lum-Rune\",\n",
+                u8"    \"esES\": \"Runa Lum\",\n",
+                u8"    \"frFR\": \"[fs]Rune Lum\",\n",
+                u8"    \"itIT\": \"[fs]Runa Lum\",\n",
+                u8"    \"koKR\": \"룸 룬\",\n",
+                u8"    \"plPL\": \"Runa Lum\",\n",
+                u8"    \"esMX\": \"Runa Lum\",\n",
+                u8"    \"jaJP\": \"ラム・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Lum\",\n",
+                u8"    \"ruRU\": \"Руна Лум\",\n",
+                u8"    \"zhCN\": \"卢姆符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20458,\n",
+                u8"    \"Key\": \"r15\",\n",
+                u8"    \"enUS\": \"Hel Rune\",\n",
+                u8"    \"zhTW\": \"符文：海爾\",\n",
+                u8"    \"deDE\": \"[fs]Hel-Rune\",\n",
+                u8"    \"esES\": \"Runa Hel\",\n",
+                u8"    \"frFR\": \"[fs]Rune Hel\",\n",
+                u8"    \"itIT\": \"[fs]Runa Hel\",\n",
+                u8"    \"koKR\": \"헬 룬\",\n",
+                u8"    \"plPL\": \"Runa Hel\",\n",
+                u8"    \"esMX\": \"Runa Hel\",\n",
+                u8"    \"jaJP\": \"ヘル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Hel\",\n",
+                u8"    \"ruRU\": \"Руна Хел\",\n",
+                u8"    \"zhCN\": \"海尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20459,\n",
+                u8"    \"Key\": \"r14\",\n",
+                u8"    \"enUS\": \"Dol Rune\",\n",
+                u8"    \"zhTW\": \"符文：多爾\",\n",
+                u8"    \"deDE\": \"[fs]Dol-Rune\",\n",
+                u8"    \"esES\": \"Runa Dol\",\n",
+                u8"    \"frFR\": \"[fs]Rune Dol\",\n",
+                u8"    \"itIT\": \"[fs]Runa Dol\",\n",
+                u8"    \"koKR\": \"돌 룬\",\n",
+                u8"    \"plPL\": \"Runa Dol\",\n",
+                u8"    \"esMX\": \"Runa Dol\",\n",
+                u8"    \"jaJP\": \"ドル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Dol\",\n",
+                u8"    \"ruRU\": \"Руна Дол\",\n",
+                u8"    \"zhCN\": \"多尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20461,\n",
+                u8"    \"Key\": \"r12\",\n",
+                u8"    \"enUS\": \"Sol Rune\",\n",
+                u8"    \"zhTW\": \"符文：索爾\",\n",
+                u8"    \"deDE\": \"[fs]Sol-Rune\",\n",
+                u8"    \"esES\": \"Runa Sol\",\n",
+                u8"    \"frFR\": \"[fs]Rune Sol\",\n",
+                u8"    \"itIT\": \"[fs]Runa Sol\",\n",
+                u8"    \"koKR\": \"솔 룬\",\n",
+                u8"    \"plPL\": \"Runa Sol\",\n",
+                u8"    \"esMX\": \"Runa Sol\",\n",
+                u8"    \"jaJP\": \"ソル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Sol\",\n",
+                u8"    \"ruRU\": \"Руна Сол\",\n",
+                u8"    \"zhCN\": \"索尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20462,\n",
+                u8"    \"Key\": \"r11\",\n",
+                u8"    \"enUS\": \"Amn Rune\",\n",
+                u8"    \"zhTW\": \"符文：安姆\",\n",
+                u8"    \"deDE\": \"[fs]Amn-Rune\",\n",
+                u8"    \"esES\": \"Runa Amn\",\n",
+                u8"    \"frFR\": \"[fs]Rune Amn\",\n",
+                u8"    \"itIT\": \"[fs]Runa Amn\",\n",
+                u8"    \"koKR\": \"앰 룬\",\n",
+                u8"    \"plPL\": \"Runa Amn\",\n",
+                u8"    \"esMX\": \"Runa Amn\",\n",
+                u8"    \"jaJP\": \"アムン・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Amn\",\n",
+                u8"    \"ruRU\": \"Руна Амн\",\n",
+                u8"    \"zhCN\": \"安姆符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20463,\n",
+                u8"    \"Key\": \"r10\",\n",
+                u8"    \"enUS\": \"Thul Rune\",\n",
+                u8"    \"zhTW\": \"符文：書爾\",\n",
+                u8"    \"deDE\": \"[fs]Thul-Rune\",\n",
+                u8"    \"esES\": \"Runa Thul\",\n",
+                u8"    \"frFR\": \"[fs]Rune Thul\",\n",
+                u8"    \"itIT\": \"[fs]Runa Thul\",\n",
+                u8"    \"koKR\": \"주울 룬\",\n",
+                u8"    \"plPL\": \"Runa Thul\",\n",
+                u8"    \"esMX\": \"Runa Thul\",\n",
+                u8"    \"jaJP\": \"スル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Thul\",\n",
+                u8"    \"ruRU\": \"Руна Тул\",\n",
+                u8"    \"zhCN\": \"图尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20464,\n",
+                u8"    \"Key\": \"r09\",\n",
+                u8"    \"enUS\": \"Ort Rune\",\n",
+                u8"    \"zhTW\": \"符文：歐特\",\n",
+                u8"    \"deDE\": \"[fs]Ort-Rune\",\n",
+                u8"    \"esES\": \"Runa Ort\",\n",
+                u8"    \"frFR\": \"[fs]Rune Ort\",\n",
+                u8"    \"itIT\": \"[fs]Runa Ort\",\n",
+                u8"    \"koKR\": \"오르트 룬\",\n",
+                u8"    \"plPL\": \"Runa Ort\",\n",
+                u8"    \"esMX\": \"Runa Ort\",\n",
+                u8"    \"jaJP\": \"オルト・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Ort\",\n",
+                u8"    \"ruRU\": \"Руна Орт\",\n",
+                u8"    \"zhCN\": \"欧特符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20465,\n",
+                u8"    \"Key\": \"r08\",\n",
+                u8"    \"enUS\": \"Ral Rune\",\n",
+                u8"    \"zhTW\": \"符文：拉爾\",\n",
+                u8"    \"deDE\": \"[fs]Ral-Rune\",\n",
+                u8"    \"esES\": \"Runa Ral\",\n",
+                u8"    \"frFR\": \"[fs]Rune Ral\",\n",
+                u8"    \"itIT\": \"[fs]Runa Ral\",\n",
+                u8"    \"koKR\": \"랄 룬\",\n",
+                u8"    \"plPL\": \"Runa Ral\",\n",
+                u8"    \"esMX\": \"Runa Ral\",\n",
+                u8"    \"jaJP\": \"ラル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Ral\",\n",
+                u8"    \"ruRU\": \"Руна Рал\",\n",
+                u8"    \"zhCN\": \"拉尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20466,\n",
+                u8"    \"Key\": \"r07\",\n",
+                u8"    \"enUS\": \"Tal Rune\",\n",
+                u8"    \"zhTW\": \"符文：塔爾\",\n",
+                u8"    \"deDE\": \"[fs]Tal-Rune\",\n",
+                u8"    \"esES\": \"Runa Tal\",\n",
+                u8"    \"frFR\": \"[fs]Rune Tal\",\n",
+                u8"    \"itIT\": \"[fs]Runa Tal\",\n",
+                u8"    \"koKR\": \"탈 룬\",\n",
+                u8"    \"plPL\": \"Runa Tal\",\n",
+                u8"    \"esMX\": \"Runa Tal\",\n",
+                u8"    \"jaJP\": \"タル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Tal\",\n",
+                u8"    \"ruRU\": \"Руна Тал\",\n",
+                u8"    \"zhCN\": \"塔尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20467,\n",
+                u8"    \"Key\": \"r06\",\n",
+                u8"    \"enUS\": \"Ith Rune\",\n",
+                u8"    \"zhTW\": \"符文：伊司\",\n",
+                u8"    \"deDE\": \"[fs]Ith-Rune\",\n",
+                u8"    \"esES\": \"Runa Ith\",\n",
+                u8"    \"frFR\": \"[fs]Rune Ith\",\n",
+                u8"    \"itIT\": \"[fs]Runa Ith\",\n",
+                u8"    \"koKR\": \"아이드 룬\",\n",
+                u8"    \"plPL\": \"Runa Ith\",\n",
+                u8"    \"esMX\": \"Runa Ith\",\n",
+                u8"    \"jaJP\": \"イス・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Ith\",\n",
+                u8"    \"ruRU\": \"Руна Ит\",\n",
+                u8"    \"zhCN\": \"伊司符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20468,\n",
+                u8"    \"Key\": \"r05\",\n",
+                u8"    \"enUS\": \"Eth Rune\",\n",
+                u8"    \"zhTW\": \"符文：愛斯\",\n",
+                u8"    \"deDE\": \"[fs]Eth-Rune\",\n",
+                u8"    \"esES\": \"Runa Eth\",\n",
+                u8"    \"frFR\": \"[fs]Rune Eth\",\n",
+                u8"    \"itIT\": \"[fs]Runa Eth\",\n",
+                u8"    \"koKR\": \"에드 룬\",\n",
+                u8"    \"plPL\": \"Runa Eth\",\n",
+                u8"    \"esMX\": \"Runa Eth\",\n",
+                u8"    \"jaJP\": \"エス・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Eth\",\n",
+                u8"    \"ruRU\": \"Руна Эт\",\n",
+                u8"    \"zhCN\": \"艾斯符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20469,\n",
+                u8"    \"Key\": \"r04\",\n",
+                u8"    \"enUS\": \"Nef Rune\",\n",
+                u8"    \"zhTW\": \"符文：那夫\",\n",
+                u8"    \"deDE\": \"[fs]Nef-Rune\",\n",
+                u8"    \"esES\": \"Runa Nef\",\n",
+                u8"    \"frFR\": \"[fs]Rune Nef\",\n",
+                u8"    \"itIT\": \"[fs]Runa Nef\",\n",
+                u8"    \"koKR\": \"네프 룬\",\n",
+                u8"    \"plPL\": \"Runa Nef\",\n",
+                u8"    \"esMX\": \"Runa Nef\",\n",
+                u8"    \"jaJP\": \"ネフ・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Nef\",\n",
+                u8"    \"ruRU\": \"Руна Неф\",\n",
+                u8"    \"zhCN\": \"奈夫符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20470,\n",
+                u8"    \"Key\": \"r03\",\n",
+                u8"    \"enUS\": \"Tir Rune\",\n",
+                u8"    \"zhTW\": \"符文：特爾\",\n",
+                u8"    \"deDE\": \"[fs]Tir-Rune\",\n",
+                u8"    \"esES\": \"Runa Tir\",\n",
+                u8"    \"frFR\": \"[fs]Rune Tir\",\n",
+                u8"    \"itIT\": \"[fs]Runa Tir\",\n",
+                u8"    \"koKR\": \"티르 룬\",\n",
+                u8"    \"plPL\": \"Runa Tir\",\n",
+                u8"    \"esMX\": \"Runa Tir\",\n",
+                u8"    \"jaJP\": \"ティア・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Tir\",\n",
+                u8"    \"ruRU\": \"Руна Тир\",\n",
+                u8"    \"zhCN\": \"提尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20471,\n",
+                u8"    \"Key\": \"r02\",\n",
+                u8"    \"enUS\": \"Eld Rune\",\n",
+                u8"    \"zhTW\": \"符文：艾德\",\n",
+                u8"    \"deDE\": \"[fs]Eld-Rune\",\n",
+                u8"    \"esES\": \"Runa Eld\",\n",
+                u8"    \"frFR\": \"[fs]Rune Eld\",\n",
+                u8"    \"itIT\": \"[fs]Runa Eld\",\n",
+                u8"    \"koKR\": \"엘드 룬\",\n",
+                u8"    \"plPL\": \"Runa Eld\",\n",
+                u8"    \"esMX\": \"Runa Eld\",\n",
+                u8"    \"jaJP\": \"エルド・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa Eld\",\n",
+                u8"    \"ruRU\": \"Руна Элд\",\n",
+                u8"    \"zhCN\": \"艾德符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20472,\n",
+                u8"    \"Key\": \"r01\",\n",
+                u8"    \"enUS\": \"El Rune\",\n",
+                u8"    \"zhTW\": \"符文：艾爾\",\n",
+                u8"    \"deDE\": \"[fs]El-Rune\",\n",
+                u8"    \"esES\": \"Runa El\",\n",
+                u8"    \"frFR\": \"[fs]Rune El\",\n",
+                u8"    \"itIT\": \"[fs]Runa El\",\n",
+                u8"    \"koKR\": \"엘 룬\",\n",
+                u8"    \"plPL\": \"Runa El\",\n",
+                u8"    \"esMX\": \"Runa El\",\n",
+                u8"    \"jaJP\": \"エル・ルーン\",\n",
+                u8"    \"ptBR\": \"Runa El\",\n",
+                u8"    \"ruRU\": \"Руна Эль\",\n",
+                u8"    \"zhCN\": \"艾尔符文\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20473,\n",
+                u8"    \"Key\": \"r33L\",\n",
+                u8"    \"enUS\": \"Zod\",\n",
+                u8"    \"zhTW\": \"薩德\",\n",
+                u8"    \"deDE\": \"Zod\",\n",
+                u8"    \"esES\": \"Zod\",\n",
+                u8"    \"frFR\": \"Zod\",\n",
+                u8"    \"itIT\": \"Zod\",\n",
+                u8"    \"koKR\": \"조드\",\n",
+                u8"    \"plPL\": \"Zod\",\n",
+                u8"    \"esMX\": \"Zod\",\n",
+                u8"    \"jaJP\": \"ゾッド\",\n",
+                u8"    \"ptBR\": \"Zod\",\n",
+                u8"    \"ruRU\": \"Зод\",\n",
+                u8"    \"zhCN\": \"佐德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20474,\n",
+                u8"    \"Key\": \"r32L\",\n",
+                u8"    \"enUS\": \"Cham\",\n",
+                u8"    \"zhTW\": \"查姆\",\n",
+                u8"    \"deDE\": \"Cham\",\n",
+                u8"    \"esES\": \"Cham\",\n",
+                u8"    \"frFR\": \"Cham\",\n",
+                u8"    \"itIT\": \"Cham\",\n",
+                u8"    \"koKR\": \"참\",\n",
+                u8"    \"plPL\": \"Cham\",\n",
+                u8"    \"esMX\": \"Cham\",\n",
+                u8"    \"jaJP\": \"チャム\",\n",
+                u8"    \"ptBR\": \"Cham\",\n",
+                u8"    \"ruRU\": \"Чам\",\n",
+                u8"    \"zhCN\": \"查姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20476,\n",
+                u8"    \"Key\": \"r30L\",\n",
+                u8"    \"enUS\": \"Ber\",\n",
+                u8"    \"zhTW\": \"貝\",\n",
+                u8"    \"deDE\": \"Ber\",\n",
+                u8"    \"esES\": \"Ber\",\n",
+                u8"    \"frFR\": \"Ber\",\n",
+                u8"    \"itIT\": \"Ber\",\n",
+                u8"    \"koKR\": \"베르\",\n",
+                u8"    \"plPL\": \"Ber\",\n",
+                u8"    \"esMX\": \"Ber\",\n",
+                u8"    \"jaJP\": \"バー\",\n",
+                u8"    \"ptBR\": \"Ber\",\n",
+                u8"    \"ruRU\": \"Бер\",\n",
+                u8"    \"zhCN\": \"贝\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20477,\n",
+                u8"    \"Key\": \"r29L\",\n",
+                u8"    \"enUS\": \"Sur\",\n",
+                u8"    \"zhTW\": \"瑟\",\n",
+                u8"    \"deDE\": \"Sur\",\n",
+                u8"    \"esES\": \"Sur\",\n",
+                u8"    \"frFR\": \"Sur\",\n",
+                u8"    \"itIT\": \"Sur\",\n",
+                u8"    \"koKR\": \"수르\",\n",
+                u8"    \"plPL\": \"Sur\",\n",
+                u8"    \"esMX\": \"Sur\",\n",
+                u8"    \"jaJP\": \"サー\",\n",
+                u8"    \"ptBR\": \"Sur\",\n",
+                u8"    \"ruRU\": \"Сур\",\n",
+                u8"    \"zhCN\": \"瑟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20478,\n",
+                u8"    \"Key\": \"r28L\",\n",
+                u8"    \"enUS\": \"Lo\",\n",
+                u8"    \"zhTW\": \"羅\",\n",
+                u8"    \"deDE\": \"Lo\",\n",
+                u8"    \"esES\": \"Lo\",\n",
+                u8"    \"frFR\": \"Lo\",\n",
+                u8"    \"itIT\": \"Lo\",\n",
+                u8"    \"koKR\": \"로\",\n",
+                u8"    \"plPL\": \"Lo\",\n",
+                u8"    \"esMX\": \"Lo\",\n",
+                u8"    \"jaJP\": \"ロー\",\n",
+                u8"    \"ptBR\": \"Lo\",\n",
+                u8"    \"ruRU\": \"Ло\",\n",
+                u8"    \"zhCN\": \"罗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20479,\n",
+                u8"    \"Key\": \"r27L\",\n",
+                u8"    \"enUS\": \"Ohm\",\n",
+                u8"    \"zhTW\": \"歐姆\",\n",
+                u8"    \"deDE\": \"Ohm\",\n",
+                u8"    \"esES\": \"Ohm\",\n",
+                u8"    \"frFR\": \"Ohm\",\n",
+                u8"    \"itIT\": \"Ohm\",\n",
+                u8"    \"koKR\": \"오움\",\n",
+                u8"    \"plPL\": \"Ohm\",\n",
+                u8"    \"esMX\": \"Ohm\",\n",
+                u8"    \"jaJP\": \"オーム\",\n",
+                u8"    \"ptBR\": \"Ohm\",\n",
+                u8"    \"ruRU\": \"Ом\",\n",
+                u8"    \"zhCN\": \"欧姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20480,\n",
+                u8"    \"Key\": \"r26L\",\n",
+                u8"    \"enUS\": \"Vex\",\n",
+                u8"    \"zhTW\": \"伐克斯\",\n",
+                u8"    \"deDE\": \"Vex\",\n",
+                u8"    \"esES\": \"Vex\",\n",
+                u8"    \"frFR\": \"Vex\",\n",
+                u8"    \"itIT\": \"Vex\",\n",
+                u8"    \"koKR\": \"벡스\",\n",
+                u8"    \"plPL\": \"Vex\",\n",
+                u8"    \"esMX\": \"Vex\",\n",
+                u8"    \"jaJP\": \"ヴェックス\",\n",
+                u8"    \"ptBR\": \"Vex\",\n",
+                u8"    \"ruRU\": \"Векс\",\n",
+                u8"    \"zhCN\": \"伐克斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20481,\n",
+                u8"    \"Key\": \"r25L\",\n",
+                u8"    \"enUS\": \"Gul\",\n",
+                u8"    \"zhTW\": \"古爾\",\n",
+                u8"    \"deDE\": \"Gul\",\n",
+                u8"    \"esES\": \"Gul\",\n",
+                u8"    \"frFR\": \"Gul\",\n",
+                u8"    \"itIT\": \"Gul\",\n",
+                u8"    \"koKR\": \"굴\",\n",
+                u8"    \"plPL\": \"Gul\",\n",
+                u8"    \"esMX\": \"Gul\",\n",
+                u8"    \"jaJP\": \"ガル\",\n",
+                u8"    \"ptBR\": \"Gul\",\n",
+                u8"    \"ruRU\": \"Гул\",\n",
+                u8"    \"zhCN\": \"古尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20482,\n",
+                u8"    \"Key\": \"r24L\",\n",
+                u8"    \"enUS\": \"Ist\",\n",
+                u8"    \"zhTW\": \"伊司特\",\n",
+                u8"    \"deDE\": \"Ist\",\n",
+                u8"    \"esES\": \"Ist\",\n",
+                u8"    \"frFR\": \"Ist\",\n",
+                u8"    \"itIT\": \"Ist\",\n",
+                u8"    \"koKR\": \"이스트\",\n",
+                u8"    \"plPL\": \"Ist\",\n",
+                u8"    \"esMX\": \"Ist\",\n",
+                u8"    \"jaJP\": \"イスト\",\n",
+                u8"    \"ptBR\": \"Ist\",\n",
+                u8"    \"ruRU\": \"Ист\",\n",
+                u8"    \"zhCN\": \"伊司特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20483,\n",
+                u8"    \"Key\": \"r23L\",\n",
+                u8"    \"enUS\": \"Mal\",\n",
+                u8"    \"zhTW\": \"馬爾\",\n",
+                u8"    \"deDE\": \"Mal\",\n",
+                u8"    \"esES\": \"Mal\",\n",
+                u8"    \"frFR\": \"Mal\",\n",
+                u8"    \"itIT\": \"Mal\",\n",
+                u8"    \"koKR\": \"말\",\n",
+                u8"    \"plPL\": \"Mal\",\n",
+                u8"    \"esMX\": \"Mal\",\n",
+                u8"    \"jaJP\": \"マル\",\n",
+                u8"    \"ptBR\": \"Mal\",\n",
+                u8"    \"ruRU\": \"Мал\",\n",
+                u8"    \"zhCN\": \"玛尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20484,\n",
+                u8"    \"Key\": \"r22L\",\n",
+                u8"    \"enUS\": \"Um\",\n",
+                u8"    \"zhTW\": \"烏姆\",\n",
+                u8"    \"deDE\": \"Um\",\n",
+                u8"    \"esES\": \"Um\",\n",
+                u8"    \"frFR\": \"Um\",\n",
+                u8"    \"itIT\": \"Um\",\n",
+                u8"    \"koKR\": \"우움\",\n",
+                u8"    \"plPL\": \"Um\",\n",
+                u8"    \"esMX\": \"Um\",\n",
+                u8"    \"jaJP\": \"アム\",\n",
+                u8"    \"ptBR\": \"Um\",\n",
+                u8"    \"ruRU\": \"Ум\",\n",
+                u8"    \"zhCN\": \"乌姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20485,\n",
+                u8"    \"Key\": \"r21L\",\n",
+                u8"    \"enUS\": \"Pul\",\n",
+                u8"    \"zhTW\": \"普爾\",\n",
+                u8"    \"deDE\": \"Pul\",\n",
+                u8"    \"esES\": \"Pul\",\n",
+                u8"    \"frFR\": \"Pul\",\n",
+                u8"    \"itIT\": \"Pul\",\n",
+                u8"    \"koKR\": \"풀\",\n",
+                u8"    \"plPL\": \"Pul\",\n",
+                u8"    \"esMX\": \"Pul\",\n",
+                u8"    \"jaJP\": \"プル\",\n",
+                u8"    \"ptBR\": \"Pul\",\n",
+                u8"    \"ruRU\": \"Пул\",\n",
+                u8"    \"zhCN\": \"普尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20486,\n",
+                u8"    \"Key\": \"r20L\",\n",
+                u8"    \"enUS\": \"Lem\",\n",
+                u8"    \"zhTW\": \"藍姆\",\n",
+                u8"    \"deDE\": \"Lem\",\n",
+                u8"    \"esES\": \"Lem\",\n",
+                u8"    \"frFR\": \"Lem\",\n",
+                u8"    \"itIT\": \"Lem\",\n",
+                u8"    \"koKR\": \"렘\",\n",
+                u8"    \"plPL\": \"Lem\",\n",
+                u8"    \"esMX\": \"Lem\",\n",
+                u8"    \"jaJP\": \"レム\",\n",
+                u8"    \"ptBR\": \"Lem\",\n",
+                u8"    \"ruRU\": \"Лем\",\n",
+                u8"    \"zhCN\": \"兰姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20487,\n",
+                u8"    \"Key\": \"r19L\",\n",
+                u8"    \"enUS\": \"Fal\",\n",
+                u8"    \"zhTW\": \"法爾\",\n",
+                u8"    \"deDE\": \"Fal\",\n",
+                u8"    \"esES\": \"Fal\",\n",
+                u8"    \"frFR\": \"Fal\",\n",
+                u8"    \"itIT\": \"Fal\",\n",
+                u8"    \"koKR\": \"팔\",\n",
+                u8"    \"plPL\": \"Fal\",\n",
+                u8"    \"esMX\": \"Fal\",\n",
+                u8"    \"jaJP\": \"ファル\",\n",
+                u8"    \"ptBR\": \"Fal\",\n",
+                u8"    \"ruRU\": \"Фал\",\n",
+                u8"    \"zhCN\": \"法尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20488,\n",
+                u8"    \"Key\": \"r18L\",\n",
+                u8"    \"enUS\": \"Ko\",\n",
+                u8"    \"zhTW\": \"科\",\n",
+                u8"    \"deDE\": \"Ko\",\n",
+                u8"    \"esES\": \"Ko\",\n",
+                u8"    \"frFR\": \"Ko\",\n",
+                u8"    \"itIT\": \"Ko\",\n",
+                u8"    \"koKR\": \"코\",\n",
+                u8"    \"plPL\": \"Ko\",\n",
+                u8"    \"esMX\": \"Ko\",\n",
+                u8"    \"jaJP\": \"コー\",\n",
+                u8"    \"ptBR\": \"Ko\",\n",
+                u8"    \"ruRU\": \"Ко\",\n",
+                u8"    \"zhCN\": \"科\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20489,\n",
+                u8"    \"Key\": \"r17L\",\n",
+                u8"    \"enUS\": \"Lum\",\n",
+                u8"    \"zhTW\": \"盧姆\",\n",
+                u8"    \"deDE\": \"Lum\",\n",
+                u8"    \"esES\": \"Lum\",\n",
+                u8"    \"frFR\": \"Lum\",\n",
+                u8"    \"itIT\": \"Lum\",\n",
+                u8"    \"koKR\": \"룸\",\n",
+                u8"    \"plPL\": \"Lum\",\n",
+                u8"    \"esMX\": \"Lum\",\n",
+                u8"    \"jaJP\": \"ラム\",\n",
+                u8"    \"ptBR\": \"Lum\",\n",
+                u8"    \"ruRU\": \"Лум\",\n",
+                u8"    \"zhCN\": \"卢姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20491,\n",
+                u8"    \"Key\": \"r15L\",\n",
+                u8"    \"enUS\": \"Hel\",\n",
+                u8"    \"zhTW\": \"海爾\",\n",
+                u8"    \"deDE\": \"Hel\",\n",
+                u8"    \"esES\": \"Hel\",\n",
+                u8"    \"frFR\": \"Hel\",\n",
+                u8"    \"itIT\": \"Hel\",\n",
+                u8"    \"koKR\": \"헬\",\n",
+                u8"    \"plPL\": \"Hel\",\n",
+                u8"    \"esMX\": \"Hel\",\n",
+                u8"    \"jaJP\": \"ヘル\",\n",
+                u8"    \"ptBR\": \"Hel\",\n",
+                u8"    \"ruRU\": \"Хел\",\n",
+                u8"    \"zhCN\": \"海尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20492,\n",
+                u8"    \"Key\": \"r14L\",\n",
+                u8"    \"enUS\": \"Dol\",\n",
+                u8"    \"zhTW\": \"多爾\",\n",
+                u8"    \"deDE\": \"Dol\",\n",
+                u8"    \"esES\": \"Dol\",\n",
+                u8"    \"frFR\": \"Dol\",\n",
+                u8"    \"itIT\": \"Dol\",\n",
+                u8"    \"koKR\": \"돌\",\n",
+                u8"    \"plPL\": \"Dol\",\n",
+                u8"    \"esMX\": \"Dol\",\n",
+                u8"    \"jaJP\": \"ドル\",\n",
+                u8"    \"ptBR\": \"Dol\",\n",
+                u8"    \"ruRU\": \"Дол\",\n",
+                u8"    \"zhCN\": \"多尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20494,\n",
+                u8"    \"Key\": \"r12L\",\n",
+                u8"    \"enUS\": \"Sol\",\n",
+                u8"    \"zhTW\": \"索爾\",\n",
+                u8"    \"deDE\": \"Sol\",\n",
+                u8"    \"esES\": \"Sol\",\n",
+                u8"    \"frFR\": \"Sol\",\n",
+                u8"    \"itIT\": \"Sol\",\n",
+                u8"    \"koKR\": \"솔\",\n",
+                u8"    \"plPL\": \"Sol\",\n",
+                u8"    \"esMX\": \"Sol\",\n",
+                u8"    \"jaJP\": \"ソル\",\n",
+                u8"    \"ptBR\": \"Sol\",\n",
+                u8"    \"ruRU\": \"Сол\",\n",
+                u8"    \"zhCN\": \"索尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20495,\n",
+                u8"    \"Key\": \"r11L\",\n",
+                u8"    \"enUS\": \"Amn\",\n",
+                u8"    \"zhTW\": \"安姆\",\n",
+                u8"    \"deDE\": \"Amn\",\n",
+                u8"    \"esES\": \"Amn\",\n",
+                u8"    \"frFR\": \"Amn\",\n",
+                u8"    \"itIT\": \"Amn\",\n",
+                u8"    \"koKR\": \"앰\",\n",
+                u8"    \"plPL\": \"Amn\",\n",
+                u8"    \"esMX\": \"Amn\",\n",
+                u8"    \"jaJP\": \"アムン\",\n",
+                u8"    \"ptBR\": \"Amn\",\n",
+                u8"    \"ruRU\": \"Амн\",\n",
+                u8"    \"zhCN\": \"安姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20496,\n",
+                u8"    \"Key\": \"r10L\",\n",
+                u8"    \"enUS\": \"Thul\",\n",
+                u8"    \"zhTW\": \"書爾\",\n",
+                u8"    \"deDE\": \"Thul\",\n",
+                u8"    \"esES\": \"Thul\",\n",
+                u8"    \"frFR\": \"Thul\",\n",
+                u8"    \"itIT\": \"Thul\",\n",
+                u8"    \"koKR\": \"주울\",\n",
+                u8"    \"plPL\": \"Thul\",\n",
+                u8"    \"esMX\": \"Thul\",\n",
+                u8"    \"jaJP\": \"スル\",\n",
+                u8"    \"ptBR\": \"Thul\",\n",
+                u8"    \"ruRU\": \"Тул\",\n",
+                u8"    \"zhCN\": \"图尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20497,\n",
+                u8"    \"Key\": \"r09L\",\n",
+                u8"    \"enUS\": \"Ort\",\n",
+                u8"    \"zhTW\": \"歐特\",\n",
+                u8"    \"deDE\": \"Ort\",\n",
+                u8"    \"esES\": \"Ort\",\n",
+                u8"    \"frFR\": \"Ort\",\n",
+                u8"    \"itIT\": \"Ort\",\n",
+                u8"    \"koKR\": \"오르트\",\n",
+                u8"    \"plPL\": \"Ort\",\n",
+                u8"    \"esMX\": \"Ort\",\n",
+                u8"    \"jaJP\": \"オルト\",\n",
+                u8"    \"ptBR\": \"Ort\",\n",
+                u8"    \"ruRU\": \"Орт\",\n",
+                u8"    \"zhCN\": \"欧特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20498,\n",
+                u8"    \"Key\": \"r08L\",\n",
+                u8"    \"enUS\": \"Ral\",\n",
+                u8"    \"zhTW\": \"拉爾\",\n",
+                u8"    \"deDE\": \"Ral\",\n",
+                u8"    \"esES\": \"Ral\",\n",
+                u8"    \"frFR\": \"Ral\",\n",
+                u8"    \"itIT\": \"Ral\",\n",
+                u8"    \"koKR\": \"랄\",\n",
+                u8"    \"plPL\": \"Ral\",\n",
+                u8"    \"esMX\": \"Ral\",\n",
+                u8"    \"jaJP\": \"ラル\",\n",
+                u8"    \"ptBR\": \"Ral\",\n",
+                u8"    \"ruRU\": \"Рал\",\n",
+                u8"    \"zhCN\": \"拉尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20499,\n",
+                u8"    \"Key\": \"r07L\",\n",
+                u8"    \"enUS\": \"Tal\",\n",
+                u8"    \"zhTW\": \"塔爾\",\n",
+                u8"    \"deDE\": \"Tal\",\n",
+                u8"    \"esES\": \"Tal\",\n",
+                u8"    \"frFR\": \"Tal\",\n",
+                u8"    \"itIT\": \"Tal\",\n",
+                u8"    \"koKR\": \"탈\",\n",
+                u8"    \"plPL\": \"Tal\",\n",
+                u8"    \"esMX\": \"Tal\",\n",
+                u8"    \"jaJP\": \"タル\",\n",
+                u8"    \"ptBR\": \"Tal\",\n",
+                u8"    \"ruRU\": \"Тал\",\n",
+                u8"    \"zhCN\": \"塔尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20500,\n",
+                u8"    \"Key\": \"r06L\",\n",
+                u8"    \"enUS\": \"Ith\",\n",
+                u8"    \"zhTW\": \"伊司\",\n",
+                u8"    \"deDE\": \"Ith\",\n",
+                u8"    \"esES\": \"Ith\",\n",
+                u8"    \"frFR\": \"Ith\",\n",
+                u8"    \"itIT\": \"Ith\",\n",
+                u8"    \"koKR\": \"아이드\",\n",
+                u8"    \"plPL\": \"Ith\",\n",
+                u8"    \"esMX\": \"Ith\",\n",
+                u8"    \"jaJP\": \"イス\",\n",
+                u8"    \"ptBR\": \"Ith\",\n",
+                u8"    \"ruRU\": \"Ит\",\n",
+                u8"    \"zhCN\": \"伊司\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20501,\n",
+                u8"    \"Key\": \"r05L\",\n",
+                u8"    \"enUS\": \"Eth\",\n",
+                u8"    \"zhTW\": \"愛斯\",\n",
+                u8"    \"deDE\": \"Eth\",\n",
+                u8"    \"esES\": \"Eth\",\n",
+                u8"    \"frFR\": \"Eth\",\n",
+                u8"    \"itIT\": \"Eth\",\n",
+                u8"    \"koKR\": \"에드\",\n",
+                u8"    \"plPL\": \"Eth\",\n",
+                u8"    \"esMX\": \"Eth\",\n",
+                u8"    \"jaJP\": \"エス\",\n",
+                u8"    \"ptBR\": \"Eth\",\n",
+                u8"    \"ruRU\": \"Эт\",\n",
+                u8"    \"zhCN\": \"艾斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20502,\n",
+                u8"    \"Key\": \"r04L\",\n",
+                u8"    \"enUS\": \"Nef\",\n",
+                u8"    \"zhTW\": \"那夫\",\n",
+                u8"    \"deDE\": \"Nef\",\n",
+                u8"    \"esES\": \"Nef\",\n",
+                u8"    \"frFR\": \"Nef\",\n",
+                u8"    \"itIT\": \"Nef\",\n",
+                u8"    \"koKR\": \"네프\",\n",
+                u8"    \"plPL\": \"Nef\",\n",
+                u8"    \"esMX\": \"Nef\",\n",
+                u8"    \"jaJP\": \"ネフ\",\n",
+                u8"    \"ptBR\": \"Nef\",\n",
+                u8"    \"ruRU\": \"Неф\",\n",
+                u8"    \"zhCN\": \"奈夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20503,\n",
+                u8"    \"Key\": \"r03L\",\n",
+                u8"    \"enUS\": \"Tir\",\n",
+                u8"    \"zhTW\": \"特爾\",\n",
+                u8"    \"deDE\": \"Tir\",\n",
+                u8"    \"esES\": \"Tir\",\n",
+                u8"    \"frFR\": \"Tir\",\n",
+                u8"    \"itIT\": \"Tir\",\n",
+                u8"    \"koKR\": \"티르\",\n",
+                u8"    \"plPL\": \"Tir\",\n",
+                u8"    \"esMX\": \"Tir\",\n",
+                u8"    \"jaJP\": \"ティア\",\n",
+                u8"    \"ptBR\": \"Tir\",\n",
+                u8"    \"ruRU\": \"Тир\",\n",
+                u8"    \"zhCN\": \"提尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20504,\n",
+                u8"    \"Key\": \"r02L\",\n",
+                u8"    \"enUS\": \"Eld\",\n",
+                u8"    \"zhTW\": \"艾德\",\n",
+                u8"    \"deDE\": \"Eld\",\n",
+                u8"    \"esES\": \"Eld\",\n",
+                u8"    \"frFR\": \"Eld\",\n",
+                u8"    \"itIT\": \"Eld\",\n",
+                u8"    \"koKR\": \"엘드\",\n",
+                u8"    \"plPL\": \"Eld\",\n",
+                u8"    \"esMX\": \"Eld\",\n",
+                u8"    \"jaJP\": \"エルド\",\n",
+                u8"    \"ptBR\": \"Eld\",\n",
+                u8"    \"ruRU\": \"Элд\",\n",
+                u8"    \"zhCN\": \"艾德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20505,\n",
+                u8"    \"Key\": \"r01L\",\n",
+                u8"    \"enUS\": \"El\",\n",
+                u8"    \"zhTW\": \"艾爾\",\n",
+                u8"    \"deDE\": \"El\",\n",
+                u8"    \"esES\": \"El\",\n",
+                u8"    \"frFR\": \"El\",\n",
+                u8"    \"itIT\": \"El\",\n",
+                u8"    \"koKR\": \"엘\",\n",
+                u8"    \"plPL\": \"El\",\n",
+                u8"    \"esMX\": \"El\",\n",
+                u8"    \"jaJP\": \"エル\",\n",
+                u8"    \"ptBR\": \"El\",\n",
+                u8"    \"ruRU\": \"Эль\",\n",
+                u8"    \"zhCN\": \"艾尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20506,\n",
+                u8"    \"Key\": \"RuneQuote\",\n",
+                u8"    \"enUS\": \"'\",\n",
+                u8"    \"zhTW\": \"'\",\n",
+                u8"    \"deDE\": \"'\",\n",
+                u8"    \"esES\": \"'\",\n",
+                u8"    \"frFR\": \"\",\n",
+                u8"    \"itIT\": \"'\",\n",
+                u8"    \"koKR\": \"'\",\n",
+                u8"    \"plPL\": \"'\",\n",
+                u8"    \"esMX\": \"'\",\n",
+                u8"    \"jaJP\": \"'\",\n",
+                u8"    \"ptBR\": \"\\\"\",\n",
+                u8"    \"ruRU\": \"'\",\n",
+                u8"    \"zhCN\": \"'\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20507,\n",
+                u8"    \"Key\": \"Runeword1\",\n",
+                u8"    \"enUS\": \"Ancients' Pledge\",\n",
+                u8"    \"zhTW\": \"先祖之契\",\n",
+                u8"    \"deDE\": \"Schwur der Urahnen\",\n",
+                u8"    \"esES\": \"Promesa de los Antiguos\",\n",
+                u8"    \"frFR\": \"Anathème des Anciens\",\n",
+                u8"    \"itIT\": \"Pegno degli Antichi\",\n",
+                u8"    \"koKR\": \"고대인의 서약\",\n",
+                u8"    \"plPL\": \"Przysięga Starożytnych\",\n",
+                u8"    \"esMX\": \"Juramento de los ancestros\",\n",
+                u8"    \"jaJP\": \"古の民の誓約\",\n",
+                u8"    \"ptBR\": \"Promessa dos Ancestrais\",\n",
+                u8"    \"ruRU\": \"Клятва Древних\",\n",
+                u8"    \"zhCN\": \"先祖之誓\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20508,\n",
+                u8"    \"Key\": \"Runeword2\",\n",
+                u8"    \"enUS\": \"Armageddon\",\n",
+                u8"    \"zhTW\": \"毀天滅地\",\n",
+                u8"    \"deDE\": \"Armageddon\",\n",
+                u8"    \"esES\": \"Armagedón\",\n",
+                u8"    \"frFR\": \"Armageddon\",\n",
+                u8"    \"itIT\": \"Armageddon\",\n",
+                u8"    \"koKR\": \"대전쟁\",\n",
+                u8"    \"plPL\": \"Armagedon\",\n",
+                u8"    \"esMX\": \"Armagedón\",\n",
+                u8"    \"jaJP\": \"天変地異\",\n",
+                u8"    \"ptBR\": \"Armagedom\",\n",
+                u8"    \"ruRU\": \"Армагеддон\",\n",
+                u8"    \"zhCN\": \"末日\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20509,\n",
+                u8"    \"Key\": \"Runeword3\",\n",
+                u8"    \"enUS\": \"Authority\",\n",
+                u8"    \"zhTW\": \"權威\",\n",
+                u8"    \"deDE\": \"Macht\",\n",
+                u8"    \"esES\": \"Autoridad\",\n",
+                u8"    \"frFR\": \"Autorité\",\n",
+                u8"    \"itIT\": \"Autorità\",\n",
+                u8"    \"koKR\": \"권위\",\n",
+                u8"    \"plPL\": \"Władza\",\n",
+                u8"    \"esMX\": \"Autoridad\",\n",
+                u8"    \"jaJP\": \"権威\",\n",
+                u8"    \"ptBR\": \"Autoridade\",\n",
+                u8"    \"ruRU\": \"Власть\",\n",
+                u8"    \"zhCN\": \"权威\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20510,\n",
+                u8"    \"Key\": \"Runeword4\",\n",
+                u8"    \"enUS\": \"Beast\",\n",
+                u8"    \"zhTW\": \"野獸\",\n",
+                u8"    \"deDE\": \"Bestie\",\n",
+                u8"    \"esES\": \"Bestia\",\n",
+                u8"    \"frFR\": \"Bête\",\n",
+                u8"    \"itIT\": \"Bestia\",\n",
+                u8"    \"koKR\": \"야수\",\n",
+                u8"    \"plPL\": \"Bestia\",\n",
+                u8"    \"esMX\": \"Bestia\",\n",
+                u8"    \"jaJP\": \"獣\",\n",
+                u8"    \"ptBR\": \"Fera\",\n",
+                u8"    \"ruRU\": \"Зверь\",\n",
+                u8"    \"zhCN\": \"野兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20511,\n",
+                u8"    \"Key\": \"Runeword5\",\n",
+                u8"    \"enUS\": \"Beauty\",\n",
+                u8"    \"zhTW\": \"美貌\",\n",
+                u8"    \"deDE\": \"Schönheit\",\n",
+                u8"    \"esES\": \"Belleza\",\n",
+                u8"    \"frFR\": \"Beauté\",\n",
+                u8"    \"itIT\": \"Bellezza\",\n",
+                u8"    \"koKR\": \"아름다움\",\n",
+                u8"    \"plPL\": \"Piękno\",\n",
+                u8"    \"esMX\": \"Belleza\",\n",
+                u8"    \"jaJP\": \"美\",\n",
+                u8"    \"ptBR\": \"Beleza\",\n",
+                u8"    \"ruRU\": \"Красота\",\n",
+                u8"    \"zhCN\": \"美丽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20512,\n",
+                u8"    \"Key\": \"Runeword6\",\n",
+                u8"    \"enUS\": \"Black\",\n",
+                u8"    \"zhTW\": \"黑錘\",\n",
+                u8"    \"deDE\": \"Schwärze\",\n",
+                u8"    \"esES\": \"Negrura\",\n",
+                u8"    \"frFR\": \"Noir\",\n",
+                u8"    \"itIT\": \"Nero\",\n",
+                u8"    \"koKR\": \"어둠\",\n",
+                u8"    \"plPL\": \"Czerń\",\n",
+                u8"    \"esMX\": \"Opaco\",\n",
+                u8"    \"jaJP\": \"黒\",\n",
+                u8"    \"ptBR\": \"Ébano\",\n",
+                u8"    \"ruRU\": \"Мрак\",\n",
+                u8"    \"zhCN\": \"黑色\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20513,\n",
+                u8"    \"Key\": \"Runeword7\",\n",
+                u8"    \"enUS\": \"Blood\",\n",
+                u8"    \"zhTW\": \"鮮血\",\n",
+                u8"    \"deDE\": \"Blut\",\n",
+                u8"    \"esES\": \"Sangre\",\n",
+                u8"    \"frFR\": \"Sang\",\n",
+                u8"    \"itIT\": \"Sangue\",\n",
+                u8"    \"koKR\": \"피\",\n",
+                u8"    \"plPL\": \"Krew\",\n",
+                u8"    \"esMX\": \"Sangre\",\n",
+                u8"    \"jaJP\": \"血\",\n",
+                u8"    \"ptBR\": \"Sangue\",\n",
+                u8"    \"ruRU\": \"Кровь\",\n",
+                u8"    \"zhCN\": \"鲜血\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20514,\n",
+                u8"    \"Key\": \"Runeword8\",\n",
+                u8"    \"enUS\": \"Bone\",\n",
+                u8"    \"zhTW\": \"骸骨\",\n",
+                u8"    \"deDE\": \"Knochen\",\n",
+                u8"    \"esES\": \"Hueso\",\n",
+                u8"    \"frFR\": \"Os\",\n",
+                u8"    \"itIT\": \"Ossa\",\n",
+                u8"    \"koKR\": \"뼈\",\n",
+                u8"    \"plPL\": \"Kość\",\n",
+                u8"    \"esMX\": \"Hueso\",\n",
+                u8"    \"jaJP\": \"骨\",\n",
+                u8"    \"ptBR\": \"Osso\",\n",
+                u8"    \"ruRU\": \"Кость\",\n",
+                u8"    \"zhCN\": \"白骨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20515,\n",
+                u8"    \"Key\": \"Runeword9\",\n",
+                u8"    \"enUS\": \"Bramble\",\n",
+                u8"    \"zhTW\": \"刺藤\",\n",
+                u8"    \"deDE\": \"Dornen\",\n",
+                u8"    \"esES\": \"Zarza\",\n",
+                u8"    \"frFR\": \"Barbelé\",\n",
+                u8"    \"itIT\": \"Roveto\",\n",
+                u8"    \"koKR\": \"찔레\",\n",
+                u8"    \"plPL\": \"Kolec\",\n",
+                u8"    \"esMX\": \"Zarza\",\n",
+                u8"    \"jaJP\": \"茨\",\n",
+                u8"    \"ptBR\": \"Espinho\",\n",
+                u8"    \"ruRU\": \"Терновник\",\n",
+                u8"    \"zhCN\": \"荆棘\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20516,\n",
+                u8"    \"Key\": \"Runeword10\",\n",
+                u8"    \"enUS\": \"Brand\",\n",
+                u8"    \"zhTW\": \"烙印\",\n",
+                u8"    \"deDE\": \"Brand\",\n",
+                u8"    \"esES\": \"Tizón\",\n",
+                u8"    \"frFR\": \"Balafre\",\n",
+                u8"    \"itIT\": \"Marchio\",\n",
+                u8"    \"koKR\": \"낙인\",\n",
+                u8"    \"plPL\": \"Piętno\",\n",
+                u8"    \"esMX\": \"Marca\",\n",
+                u8"    \"jaJP\": \"烙印\",\n",
+                u8"    \"ptBR\": \"Marca\",\n",
+                u8"    \"ruRU\": \"Тавро\",\n",
+                u8"    \"zhCN\": \"烙印\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20517,\n",
+                u8"    \"Key\": \"Runeword11\",\n",
+                u8"    \"enUS\": \"Breath of the Dying\",\n",
+                u8"    \"zhTW\": \"死亡呼吸\",\n",
+                u8"    \"deDE\": \"Odem der Sterbenden\",\n",
+                u8"    \"esES\": \"Aliento de los muertos\",\n",
+                u8"    \"frFR\": \"Souffle des mourants\",\n",
+                u8"    \"itIT\": \"Ultimo Respiro\",\n",
+                u8"    \"koKR\": \"죽어가는 자의 숨결\",\n",
+                u8"    \"plPL\": \"Ostatni Oddech\",\n",
+                u8"    \"esMX\": \"Aliento de los moribundos\",\n",
+                u8"    \"jaJP\": \"死の吐息\",\n",
+                u8"    \"ptBR\": \"Sopro da Morbidez\",\n",
+                u8"    \"ruRU\": \"Вздох умирающего\",\n",
+                u8"    \"zhCN\": \"濒死之息\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20518,\n",
+                u8"    \"Key\": \"Runeword12\",\n",
+                u8"    \"enUS\": \"Broken Promise\",\n",
+                u8"    \"zhTW\": \"破碎誓言\",\n",
+                u8"    \"deDE\": \"Gebrochenes Versprechen\",\n",
+                u8"    \"esES\": \"Promesa rota\",\n",
+                u8"    \"frFR\": \"Promesse rompue\",\n",
+                u8"    \"itIT\": \"Promessa Spezzata\",\n",
+                u8"    \"koKR\": \"깨어진 약속\",\n",
+                u8"    \"plPL\": \"Złamana Obietnica\",\n",
+                u8"    \"esMX\": \"Promesa rota\",\n",
+                u8"    \"jaJP\": \"背約\",\n",
+                u8"    \"ptBR\": \"Promessa Quebrada\",\n",
+                u8"    \"ruRU\": \"Нарушенный обет\",\n",
+                u8"    \"zhCN\": \"破碎誓言\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20519,\n",
+                u8"    \"Key\": \"Runeword13\",\n",
+                u8"    \"enUS\": \"Call to Arms\",\n",
+                u8"    \"zhTW\": \"戰爭召喚\",\n",
+                u8"    \"deDE\": \"Ruf zu den Waffen\",\n",
+                u8"    \"esES\": \"Llamada a las armas\",\n",
+                u8"    \"frFR\": \"Cri de ralliement\",\n",
+                u8"    \"itIT\": \"Chiamata alle Armi\",\n",
+                u8"    \"koKR\": \"소집\",\n",
+                u8"    \"plPL\": \"Wezwanie do Broni\",\n",
+                u8"    \"esMX\": \"Llamado a las armas\",\n",
+                u8"    \"jaJP\": \"召集\",\n",
+                u8"    \"ptBR\": \"Chamado às Armas\",\n",
+                u8"    \"ruRU\": \"Призыв к оружию\",\n",
+                u8"    \"zhCN\": \"战争召唤\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20520,\n",
+                u8"    \"Key\": \"Runeword14\",\n",
+                u8"    \"enUS\": \"Chains of Honor\",\n",
+                u8"    \"zhTW\": \"榮耀之鍊\",\n",
+                u8"    \"deDE\": \"Ketten der Ehre\",\n",
+                u8"    \"esES\": \"Cadenas de honor\",\n",
+                u8"    \"frFR\": \"Chaînes de l’honneur\",\n",
+                u8"    \"itIT\": \"Catene dell'Onore\",\n",
+                u8"    \"koKR\": \"명예의 굴레\",\n",
+                u8"    \"plPL\": \"Okowy Honoru\",\n",
+                u8"    \"esMX\": \"Cadenas de honor\",\n",
+                u8"    \"jaJP\": \"名誉の連鎖\",\n",
+                u8"    \"ptBR\": \"Correntes da Honra\",\n",
+                u8"    \"ruRU\": \"Цепи чести\",\n",
+                u8"    \"zhCN\": \"荣耀之链\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20521,\n",
+                u8"    \"Key\": \"Runeword15\",\n",
+                u8"    \"enUS\": \"Chance\",\n",
+                u8"    \"zhTW\": \"機會\",\n",
+                u8"    \"deDE\": \"Zufall\",\n",
+                u8"    \"esES\": \"Casualidad\",\n",
+                u8"    \"frFR\": \"Chance\",\n",
+                u8"    \"itIT\": \"Probabilità\",\n",
+                u8"    \"koKR\": \"기회\",\n",
+                u8"    \"plPL\": \"Szansa\",\n",
+                u8"    \"esMX\": \"Azar\",\n",
+                u8"    \"jaJP\": \"好機\",\n",
+                u8"    \"ptBR\": \"Chance\",\n",
+                u8"    \"ruRU\": \"Шанс\",\n",
+                u8"    \"zhCN\": \"机遇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20522,\n",
+                u8"    \"Key\": \"Runeword16\",\n",
+                u8"    \"enUS\": \"Chaos\",\n",
+                u8"    \"zhTW\": \"混沌\",\n",
+                u8"    \"deDE\": \"Chaos\",\n",
+                u8"    \"esES\": \"Caos\",\n",
+                u8"    \"frFR\": \"Chaos\",\n",
+                u8"    \"itIT\": \"Caos\",\n",
+                u8"    \"koKR\": \"혼돈\",\n",
+                u8"    \"plPL\": \"Chaos\",\n",
+                u8"    \"esMX\": \"Caos\",\n",
+                u8"    \"jaJP\": \"混沌\",\n",
+                u8"    \"ptBR\": \"Caos\",\n",
+                u8"    \"ruRU\": \"Хаос\",\n",
+                u8"    \"zhCN\": \"混沌\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20523,\n",
+                u8"    \"Key\": \"Runeword17\",\n",
+                u8"    \"enUS\": \"Crescent Moon\",\n",
+                u8"    \"zhTW\": \"新月\",\n",
+                u8"    \"deDE\": \"Mondsichel\",\n",
+                u8"    \"esES\": \"Luna creciente\",\n",
+                u8"    \"frFR\": \"Croissant de lune\",\n",
+                u8"    \"itIT\": \"Falce di Luna\",\n",
+                u8"    \"koKR\": \"초승달\",\n",
+                u8"    \"plPL\": \"Sierp Księżyca\",\n",
+                u8"    \"esMX\": \"Luna creciente\",\n",
+                u8"    \"jaJP\": \"三日月\",\n",
+                u8"    \"ptBR\": \"Lua Crescente\",\n",
+                u8"    \"ruRU\": \"Полумесяц\",\n",
+                u8"    \"zhCN\": \"新月\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20524,\n",
+                u8"    \"Key\": \"Runeword18\",\n",
+                u8"    \"enUS\": \"Darkness\",\n",
+                u8"    \"zhTW\": \"黑暗\",\n",
+                u8"    \"deDE\": \"Dunkelheit\",\n",
+                u8"    \"esES\": \"Oscuridad\",\n",
+                u8"    \"frFR\": \"Ténèbres\",\n",
+                u8"    \"itIT\": \"Oscurità\",\n",
+                u8"    \"koKR\": \"암흑\",\n",
+                u8"    \"plPL\": \"Ciemność\",\n",
+                u8"    \"esMX\": \"Oscuridad\",\n",
+                u8"    \"jaJP\": \"暗闇\",\n",
+                u8"    \"ptBR\": \"Escuridão\",\n",
+                u8"    \"ruRU\": \"Тьма\",\n",
+                u8"    \"zhCN\": \"黑暗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20525,\n",
+                u8"    \"Key\": \"Runeword19\",\n",
+                u8"    \"enUS\": \"Daylight\",\n",
+                u8"    \"zhTW\": \"白晝\",\n",
+                u8"    \"deDE\": \"Tageslicht\",\n",
+                u8"    \"esES\": \"Luz\",\n",
+                u8"    \"frFR\": \"Divine lumière\",\n",
+                u8"    \"itIT\": \"Luce del Giorno\",\n",
+                u8"    \"koKR\": \"햇빛\",\n",
+                u8"    \"plPL\": \"Światło Dnia\",\n",
+                u8"    \"esMX\": \"Luz del día\",\n",
+                u8"    \"jaJP\": \"夜明け\",\n",
+                u8"    \"ptBR\": \"Luz do Dia\",\n",
+                u8"    \"ruRU\": \"Ясный день\",\n",
+                u8"    \"zhCN\": \"白昼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20526,\n",
+                u8"    \"Key\": \"Runeword20\",\n",
+                u8"    \"enUS\": \"Death\",\n",
+                u8"    \"zhTW\": \"死神\",\n",
+                u8"    \"deDE\": \"Tod\",\n",
+                u8"    \"esES\": \"Muerte\",\n",
+                u8"    \"frFR\": \"Décès\",\n",
+                u8"    \"itIT\": \"Morte\",\n",
+                u8"    \"koKR\": \"죽음\",\n",
+                u8"    \"plPL\": \"Śmierć\",\n",
+                u8"    \"esMX\": \"Muerte\",\n",
+                u8"    \"jaJP\": \"死\",\n",
+                u8"    \"ptBR\": \"Morte\",\n",
+                u8"    \"ruRU\": \"Смерть\",\n",
+                u8"    \"zhCN\": \"死亡\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20527,\n",
+                u8"    \"Key\": \"Runeword21\",\n",
+                u8"    \"enUS\": \"Deception\",\n",
+                u8"    \"zhTW\": \"欺暪\",\n",
+                u8"    \"deDE\": \"Täuschung\",\n",
+                u8"    \"esES\": \"Engaño\",\n",
+                u8"    \"frFR\": \"Duperie\",\n",
+                u8"    \"itIT\": \"Inganno\",\n",
+                u8"    \"koKR\": \"기만\",\n",
+                u8"    \"plPL\": \"Podstęp\",\n",
+                u8"    \"esMX\": \"Decepción\",\n",
+                u8"    \"jaJP\": \"欺瞞\",\n",
+                u8"    \"ptBR\": \"Engano\",\n",
+                u8"    \"ruRU\": \"Обман\",\n",
+                u8"    \"zhCN\": \"欺骗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20529,\n",
+                u8"    \"Key\": \"Runeword23\",\n",
+                u8"    \"enUS\": \"Desire\",\n",
+                u8"    \"zhTW\": \"渴望\",\n",
+                u8"    \"deDE\": \"Begierde\",\n",
+                u8"    \"esES\": \"Deseo\",\n",
+                u8"    \"frFR\": \"Désir\",\n",
+                u8"    \"itIT\": \"Desiderio\",\n",
+                u8"    \"koKR\": \"욕망\",\n",
+                u8"    \"plPL\": \"Pożądanie\",\n",
+                u8"    \"esMX\": \"Deseo\",\n",
+                u8"    \"jaJP\": \"欲望\",\n",
+                u8"    \"ptBR\": \"Desejo\",\n",
+                u8"    \"ruRU\": \"Желание\",\n",
+                u8"    \"zhCN\": \"欲望\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20530,\n",
+                u8"    \"Key\": \"Runeword24\",\n",
+                u8"    \"enUS\": \"Despair\",\n",
+                u8"    \"zhTW\": \"絕望\",\n",
+                u8"    \"deDE\": \"Verzweiflung\",\n",
+                u8"    \"esES\": \"Desesperación\",\n",
+                u8"    \"frFR\": \"Désespoir\",\n",
+                u8"    \"itIT\": \"Disperazione\",\n",
+                u8"    \"koKR\": \"절망\",\n",
+                u8"    \"plPL\": \"Rozpacz\",\n",
+                u8"    \"esMX\": \"Desesperación\",\n",
+                u8"    \"jaJP\": \"絶望\",\n",
+                u8"    \"ptBR\": \"Desespero\",\n",
+                u8"    \"ruRU\": \"Отчаяние\",\n",
+                u8"    \"zhCN\": \"绝望\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20531,\n",
+                u8"    \"Key\": \"Runeword25\",\n",
+                u8"    \"enUS\": \"Destruction\",\n",
+                u8"    \"zhTW\": \"毀滅\",\n",
+                u8"    \"deDE\": \"Zerstörung\",\n",
+                u8"    \"esES\": \"Destrucción\",\n",
+                u8"    \"frFR\": \"Destruction\",\n",
+                u8"    \"itIT\": \"Distruzione\",\n",
+                u8"    \"koKR\": \"파괴\",\n",
+                u8"    \"plPL\": \"Zniszczenie\",\n",
+                u8"    \"esMX\": \"Destrucción\",\n",
+                u8"    \"jaJP\": \"破壊\",\n",
+                u8"    \"ptBR\": \"Destruição\",\n",
+                u8"    \"ruRU\": \"Разрушение\",\n",
+                u8"    \"zhCN\": \"毁灭\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20532,\n",
+                u8"    \"Key\": \"Runeword26\",\n",
+                u8"    \"enUS\": \"Doom\",\n",
+                u8"    \"zhTW\": \"末日\",\n",
+                u8"    \"deDE\": \"Verdammnis\",\n",
+                u8"    \"esES\": \"Fatalidad\",\n",
+                u8"    \"frFR\": \"Dévastation\",\n",
+                u8"    \"itIT\": \"Rovina\",\n",
+                u8"    \"koKR\": \"파멸\",\n",
+                u8"    \"plPL\": \"Zagłada\",\n",
+                u8"    \"esMX\": \"Calamidad\",\n",
+                u8"    \"jaJP\": \"破滅\",\n",
+                u8"    \"ptBR\": \"Perdição\",\n",
+                u8"    \"ruRU\": \"Гибель\",\n",
+                u8"    \"zhCN\": \"厄运\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20533,\n",
+                u8"    \"Key\": \"Runeword27\",\n",
+                u8"    \"enUS\": \"Dragon\",\n",
+                u8"    \"zhTW\": \"飛龍\",\n",
+                u8"    \"deDE\": \"Drachen\",\n",
+                u8"    \"esES\": \"Dragón\",\n",
+                u8"    \"frFR\": \"Dragon\",\n",
+                u8"    \"itIT\": \"Drago\",\n",
+                u8"    \"koKR\": \"용\",\n",
+                u8"    \"plPL\": \"Smok\",\n",
+                u8"    \"esMX\": \"Dragón\",\n",
+                u8"    \"jaJP\": \"ドラゴン\",\n",
+                u8"    \"ptBR\": \"Dragão\",\n",
+                u8"    \"ruRU\": \"Дракон\",\n",
+                u8"    \"zhCN\": \"巨龙\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20534,\n",
+                u8"    \"Key\": \"Runeword28\",\n",
+                u8"    \"enUS\": \"Dread\",\n",
+                u8"    \"zhTW\": \"恐懼\",\n",
+                u8"    \"deDE\": \"Schrecken\",\n",
+                u8"    \"esES\": \"Pavor\",\n",
+                u8"    \"frFR\": \"Défiance\",\n",
+                u8"    \"itIT\": \"Terrore\",\n",
+                u8"    \"koKR\": \"두려움\",\n",
+                u8"    \"plPL\": \"Strach\",\n",
+                u8"    \"esMX\": \"Temor\",\n",
+                u8"    \"jaJP\": \"戦慄\",\n",
+                u8"    \"ptBR\": \"Pavor\",\n",
+                u8"    \"ruRU\": \"Ужас\",\n",
+                u8"    \"zhCN\": \"惊惧\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20535,\n",
+                u8"    \"Key\": \"Runeword29\",\n",
+                u8"    \"enUS\": \"Dream\",\n",
+                u8"    \"zhTW\": \"夢境\",\n",
+                u8"    \"deDE\": \"Traum\",\n",
+                u8"    \"esES\": \"Sueño\",\n",
+                u8"    \"frFR\": \"Rêve\",\n",
+                u8"    \"itIT\": \"Sogno\",\n",
+                u8"    \"koKR\": \"꿈\",\n",
+                u8"    \"plPL\": \"Sen\",\n",
+                u8"    \"esMX\": \"Sueño\",\n",
+                u8"    \"jaJP\": \"夢\",\n",
+                u8"    \"ptBR\": \"Sonho\",\n",
+                u8"    \"ruRU\": \"Видение\",\n",
+                u8"    \"zhCN\": \"梦境\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20536,\n",
+                u8"    \"Key\": \"Runeword30\",\n",
+                u8"    \"enUS\": \"Duress\",\n",
+                u8"    \"zhTW\": \"強制\",\n",
+                u8"    \"deDE\": \"Nötigung\",\n",
+                u8"    \"esES\": \"Coacción\",\n",
+                u8"    \"frFR\": \"Domination\",\n",
+                u8"    \"itIT\": \"Coercizione\",\n",
+                u8"    \"koKR\": \"협박\",\n",
+                u8"    \"plPL\": \"Przymus\",\n",
+                u8"    \"esMX\": \"Coerción\",\n",
+                u8"    \"jaJP\": \"威圧\",\n",
+                u8"    \"ptBR\": \"Coerção\",\n",
+                u8"    \"ruRU\": \"Принуждение\",\n",
+                u8"    \"zhCN\": \"强压\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20537,\n",
+                u8"    \"Key\": \"Runeword31\",\n",
+                u8"    \"enUS\": \"Edge\",\n",
+                u8"    \"zhTW\": \"邊緣\",\n",
+                u8"    \"deDE\": \"Schneide\",\n",
+                u8"    \"esES\": \"Filo\",\n",
+                u8"    \"frFR\": \"Arête\",\n",
+                u8"    \"itIT\": \"Lama\",\n",
+                u8"    \"koKR\": \"모서리\",\n",
+                u8"    \"plPL\": \"Ostrze\",\n",
+                u8"    \"esMX\": \"Filo\",\n",
+                u8"    \"jaJP\": \"刃\",\n",
+                u8"    \"ptBR\": \"Gume\",\n",
+                u8"    \"ruRU\": \"Острие\",\n",
+                u8"    \"zhCN\": \"锐锋\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20538,\n",
+                u8"    \"Key\": \"Runeword32\",\n",
+                u8"    \"enUS\": \"Elation\",\n",
+                u8"    \"zhTW\": \"興高彩烈\",\n",
+                u8"    \"deDE\": \"Erregung\",\n",
+                u8"    \"esES\": \"Júbilo\",\n",
+                u8"    \"frFR\": \"Effusion\",\n",
+                u8"    \"itIT\": \"Esultanza\",\n",
+                u8"    \"koKR\": \"득의\",\n",
+                u8"    \"plPL\": \"Radość\",\n",
+                u8"    \"esMX\": \"Euforia\",\n",
+                u8"    \"jaJP\": \"高揚\",\n",
+                u8"    \"ptBR\": \"Euforia\",\n",
+                u8"    \"ruRU\": \"Воодушевление\",\n",
+                u8"    \"zhCN\": \"欢欣\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20539,\n",
+                u8"    \"Key\": \"Runeword33\",\n",
+                u8"    \"enUS\": \"Enigma\",\n",
+                u8"    \"zhTW\": \"謎團\",\n",
+                u8"    \"deDE\": \"Rätsel\",\n",
+                u8"    \"esES\": \"Enigma\",\n",
+                u8"    \"frFR\": \"Énigme\",\n",
+                u8"    \"itIT\": \"Enigma\",\n",
+                u8"    \"koKR\": \"수수께끼\",\n",
+                u8"    \"plPL\": \"Enigma\",\n",
+                u8"    \"esMX\": \"Enigma\",\n",
+                u8"    \"jaJP\": \"不知\",\n",
+                u8"    \"ptBR\": \"Enigma\",\n",
+                u8"    \"ruRU\": \"Тайна\",\n",
+                u8"    \"zhCN\": \"谜团\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20540,\n",
+                u8"    \"Key\": \"Runeword34\",\n",
+                u8"    \"enUS\": \"Enlightenment\",\n",
+                u8"    \"zhTW\": \"教化\",\n",
+                u8"    \"deDE\": \"Erleuchtung\",\n",
+                u8"    \"esES\": \"Ilustración\",\n",
+                u8"    \"frFR\": \"Éclaircissement\",\n",
+                u8"    \"itIT\": \"Illuminazione\",\n",
+                u8"    \"koKR\": \"깨우침\",\n",
+                u8"    \"plPL\": \"Oświecenie\",\n",
+                u8"    \"esMX\": \"Iluminación\",\n",
+                u8"    \"jaJP\": \"悟り\",\n",
+                u8"    \"ptBR\": \"Iluminação\",\n",
+                u8"    \"ruRU\": \"Просветление\",\n",
+                u8"    \"zhCN\": \"启迪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20541,\n",
+                u8"    \"Key\": \"Runeword35\",\n",
+                u8"    \"enUS\": \"Envy\",\n",
+                u8"    \"zhTW\": \"羨慕\",\n",
+                u8"    \"deDE\": \"Neid\",\n",
+                u8"    \"esES\": \"Envidia\",\n",
+                u8"    \"frFR\": \"Envie\",\n",
+                u8"    \"itIT\": \"Invidia\",\n",
+                u8"    \"koKR\": \"시기\",\n",
+                u8"    \"plPL\": \"Zawiść\",\n",
+                u8"    \"esMX\": \"Envidia\",\n",
+                u8"    \"jaJP\": \"羨望\",\n",
+                u8"    \"ptBR\": \"Inveja\",\n",
+                u8"    \"ruRU\": \"Зависть\",\n",
+                u8"    \"zhCN\": \"羡慕\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20542,\n",
+                u8"    \"Key\": \"Runeword36\",\n",
+                u8"    \"enUS\": \"Eternity\",\n",
+                u8"    \"zhTW\": \"永恆\",\n",
+                u8"    \"deDE\": \"Ewigkeit\",\n",
+                u8"    \"esES\": \"Eternidad\",\n",
+                u8"    \"frFR\": \"Éternité\",\n",
+                u8"    \"itIT\": \"Eternità\",\n",
+                u8"    \"koKR\": \"영원\",\n",
+                u8"    \"plPL\": \"Wieczność\",\n",
+                u8"    \"esMX\": \"Eternidad\",\n",
+                u8"    \"jaJP\": \"永遠\",\n",
+                u8"    \"ptBR\": \"Eternidade\",\n",
+                u8"    \"ruRU\": \"Вечность\",\n",
+                u8"    \"zhCN\": \"永恒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20543,\n",
+                u8"    \"Key\": \"Runeword37\",\n",
+                u8"    \"enUS\": \"Exile\",\n",
+                u8"    \"zhTW\": \"流亡\",\n",
+                u8"    \"deDE\": \"Exil\",\n",
+                u8"    \"esES\": \"Exilio\",\n",
+                u8"    \"frFR\": \"Exil\",\n",
+                u8"    \"itIT\": \"Esilio\",\n",
+                u8"    \"koKR\": \"추방\",\n",
+                u8"    \"plPL\": \"Wygnanie\",\n",
+                u8"    \"esMX\": \"Exilio\",\n",
+                u8"    \"jaJP\": \"追放\",\n",
+                u8"    \"ptBR\": \"Exílio\",\n",
+                u8"    \"ruRU\": \"Изгнание\",\n",
+                u8"    \"zhCN\": \"流放\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20544,\n",
+                u8"    \"Key\": \"Runeword38\",\n",
+                u8"    \"enUS\": \"Faith\",\n",
+                u8"    \"zhTW\": \"信心\",\n",
+                u8"    \"deDE\": \"Glaube\",\n",
+                u8"    \"esES\": \"Fe\",\n",
+                u8"    \"frFR\": \"Foi\",\n",
+                u8"    \"itIT\": \"Fede\",\n",
+                u8"    \"koKR\": \"신념\",\n",
+                u8"    \"plPL\": \"Wiara\",\n",
+                u8"    \"esMX\": \"Fe\",\n",
+                u8"    \"jaJP\": \"信念\",\n",
+                u8"    \"ptBR\": \"Fé\",\n",
+                u8"    \"ruRU\": \"Вера\",\n",
+                u8"    \"zhCN\": \"信念\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20545,\n",
+                u8"    \"Key\": \"Runeword39\",\n",
+                u8"    \"enUS\": \"Famine\",\n",
+                u8"    \"zhTW\": \"饑荒\",\n",
+                u8"    \"deDE\": \"Hungersnot\",\n",
+                u8"    \"esES\": \"Hambruna\",\n",
+                u8"    \"frFR\": \"Famine\",\n",
+                u8"    \"itIT\": \"Carestia\",\n",
+                u8"    \"koKR\": \"기근\",\n",
+                u8"    \"plPL\": \"Wygłodzenie\",\n",
+                u8"    \"esMX\": \"Hambruna\",\n",
+                u8"    \"jaJP\": \"飢饉\",\n",
+                u8"    \"ptBR\": \"Penúria\",\n",
+                u8"    \"ruRU\": \"Голод\",\n",
+                u8"    \"zhCN\": \"饥荒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20546,\n",
+                u8"    \"Key\": \"Runeword40\",\n",
+                u8"    \"enUS\": \"Flickering Flame\",\n",
+                u8"    \"zhTW\": \"閃爍火焰\",\n",
+                u8"    \"deDE\": \"Flamme\",\n",
+                u8"    \"esES\": \"Llama trémula\",\n",
+                u8"    \"frFR\": \"Flamme vacillante\",\n",
+                u8"    \"itIT\": \"Fiamma\",\n",
+                u8"    \"koKR\": \"꺼져가는 불길\",\n",
+                u8"    \"plPL\": \"Płomień\",\n",
+                u8"    \"esMX\": \"Llama parpadeante\",\n",
+                u8"    \"jaJP\": \"揺らめく炎\",\n",
+                u8"    \"ptBR\": \"Chama Tremeluzente\",\n",
+                u8"    \"ruRU\": \"Мерцающее пламя\",\n",
+                u8"    \"zhCN\": \"闪烁火焰\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20547,\n",
+                u8"    \"Key\": \"Runeword41\",\n",
+                u8"    \"enUS\": \"Fortitude\",\n",
+                u8"    \"zhTW\": \"剛毅\",\n",
+                u8"    \"deDE\": \"Stärke\",\n",
+                u8"    \"esES\": \"Fortaleza\",\n",
+                u8"    \"frFR\": \"Fortitude\",\n",
+                u8"    \"itIT\": \"Fermezza\",\n",
+                u8"    \"koKR\": \"인내\",\n",
+                u8"    \"plPL\": \"Hart\",\n",
+                u8"    \"esMX\": \"Fortaleza\",\n",
+                u8"    \"jaJP\": \"不屈\",\n",
+                u8"    \"ptBR\": \"Fortitude\",\n",
+                u8"    \"ruRU\": \"Сила духа\",\n",
+                u8"    \"zhCN\": \"刚毅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20548,\n",
+                u8"    \"Key\": \"Runeword42\",\n",
+                u8"    \"enUS\": \"Fortune\",\n",
+                u8"    \"zhTW\": \"機運\",\n",
+                u8"    \"deDE\": \"Glück\",\n",
+                u8"    \"esES\": \"Fortuna\",\n",
+                u8"    \"frFR\": \"Fortune\",\n",
+                u8"    \"itIT\": \"Fortuna\",\n",
+                u8"    \"koKR\": \"행운\",\n",
+                u8"    \"plPL\": \"Fortuna\",\n",
+                u8"    \"esMX\": \"Fortuna\",\n",
+                u8"    \"jaJP\": \"幸運\",\n",
+                u8"    \"ptBR\": \"Fortuna\",\n",
+                u8"    \"ruRU\": \"Удача\",\n",
+                u8"    \"zhCN\": \"鸿运\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20549,\n",
+                u8"    \"Key\": \"Runeword43\",\n",
+                u8"    \"enUS\": \"Friendship\",\n",
+                u8"    \"zhTW\": \"友情\",\n",
+                u8"    \"deDE\": \"Freundschaft\",\n",
+                u8"    \"esES\": \"Amistad\",\n",
+                u8"    \"frFR\": \"Fraternité\",\n",
+                u8"    \"itIT\": \"Amicizia\",\n",
+                u8"    \"koKR\": \"우정\",\n",
+                u8"    \"plPL\": \"Przyjaźń\",\n",
+                u8"    \"esMX\": \"Amistad\",\n",
+                u8"    \"jaJP\": \"友情\",\n",
+                u8"    \"ptBR\": \"Amizade\",\n",
+                u8"    \"ruRU\": \"Дружба\",\n",
+                u8"    \"zhCN\": \"友谊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20550,\n",
+                u8"    \"Key\": \"Runeword44\",\n",
+                u8"    \"enUS\": \"Fury\",\n",
+                u8"    \"zhTW\": \"狂怒\",\n",
+                u8"    \"deDE\": \"Wut\",\n",
+                u8"    \"esES\": \"Furia\",\n",
+                u8"    \"frFR\": \"Fureur\",\n",
+                u8"    \"itIT\": \"Furia\",\n",
+                u8"    \"koKR\": \"분노\",\n",
+                u8"    \"plPL\": \"Furia\",\n",
+                u8"    \"esMX\": \"Furia\",\n",
+                u8"    \"jaJP\": \"激情\",\n",
+                u8"    \"ptBR\": \"Fúria\",\n",
+                u8"    \"ruRU\": \"Ярость\",\n",
+                u8"    \"zhCN\": \"愤怒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20551,\n",
+                u8"    \"Key\": \"Runeword45\",\n",
+                u8"    \"enUS\": \"Gloom\",\n",
+                u8"    \"zhTW\": \"幽暗\",\n",
+                u8"    \"deDE\": \"Düsternis\",\n",
+                u8"    \"esES\": \"Melancolía\",\n",
+                u8"    \"frFR\": \"Funérailles\",\n",
+                u8"    \"itIT\": \"Tenebre\",\n",
+                u8"    \"koKR\": \"어스름\",\n",
+                u8"    \"plPL\": \"Mrok\",\n",
+                u8"    \"esMX\": \"Penumbra\",\n",
+                u8"    \"jaJP\": \"陰鬱\",\n",
+                u8"    \"ptBR\": \"Melancolia\",\n",
+                u8"    \"ruRU\": \"Сумрак\",\n",
+                u8"    \"zhCN\": \"阴霾\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20552,\n",
+                u8"    \"Key\": \"Runeword46\",\n",
+                u8"    \"enUS\": \"Glory\",\n",
+                u8"    \"zhTW\": \"榮譽\",\n",
+                u8"    \"deDE\": \"Ruhm\",\n",
+                u8"    \"esES\": \"Gloria\",\n",
+                u8"    \"frFR\": \"Gloire\",\n",
+                u8"    \"itIT\": \"Gloria\",\n",
+                u8"    \"koKR\": \"영예\",\n",
+                u8"    \"plPL\": \"Chwała\",\n",
+                u8"    \"esMX\": \"Gloria\",\n",
+                u8"    \"jaJP\": \"栄光\",\n",
+                u8"    \"ptBR\": \"Glória\",\n",
+                u8"    \"ruRU\": \"Слава\",\n",
+                u8"    \"zhCN\": \"光华\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20553,\n",
+                u8"    \"Key\": \"Runeword47\",\n",
+                u8"    \"enUS\": \"Grief\",\n",
+                u8"    \"zhTW\": \"悔恨\",\n",
+                u8"    \"deDE\": \"Trauer\",\n",
+                u8"    \"esES\": \"Dolor\",\n",
+                u8"    \"frFR\": \"Grand chagrin\",\n",
+                u8"    \"itIT\": \"Cordoglio\",\n",
+                u8"    \"koKR\": \"슬픔\",\n",
+                u8"    \"plPL\": \"Żal\",\n",
+                u8"    \"esMX\": \"Pena\",\n",
+                u8"    \"jaJP\": \"嘆き\",\n",
+                u8"    \"ptBR\": \"Luto\",\n",
+                u8"    \"ruRU\": \"Печаль\",\n",
+                u8"    \"zhCN\": \"悔恨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20554,\n",
+                u8"    \"Key\": \"Runeword48\",\n",
+                u8"    \"enUS\": \"Hand of Justice\",\n",
+                u8"    \"zhTW\": \"正義之手\",\n",
+                u8"    \"deDE\": \"Hand der Gerechtigkeit\",\n",
+                u8"    \"esES\": \"Mano justiciera\",\n",
+                u8"    \"frFR\": \"Glaive de la justice\",\n",
+                u8"    \"itIT\": \"Mano della Giustizia\",\n",
+                u8"    \"koKR\": \"정의의 손길\",\n",
+                u8"    \"plPL\": \"Ręka Sprawiedliwości\",\n",
+                u8"    \"esMX\": \"Mano de la justicia\",\n",
+                u8"    \"jaJP\": \"正義の手\",\n",
+                u8"    \"ptBR\": \"Mão da Justiça\",\n",
+                u8"    \"ruRU\": \"Длань правосудия\",\n",
+                u8"    \"zhCN\": \"正义之手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20555,\n",
+                u8"    \"Key\": \"Runeword49\",\n",
+                u8"    \"enUS\": \"Harmony\",\n",
+                u8"    \"zhTW\": \"和諧\",\n",
+                u8"    \"deDE\": \"Harmonie\",\n",
+                u8"    \"esES\": \"Armonía\",\n",
+                u8"    \"frFR\": \"Harmonie\",\n",
+                u8"    \"itIT\": \"Armonia\",\n",
+                u8"    \"koKR\": \"조화\",\n",
+                u8"    \"plPL\": \"Harmonia\",\n",
+                u8"    \"esMX\": \"Armonía\",\n",
+                u8"    \"jaJP\": \"調和\",\n",
+                u8"    \"ptBR\": \"Harmonia\",\n",
+                u8"    \"ruRU\": \"Гармония\",\n",
+                u8"    \"zhCN\": \"和谐\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20556,\n",
+                u8"    \"Key\": \"Runeword50\",\n",
+                u8"    \"enUS\": \"Hatred\",\n",
+                u8"    \"zhTW\": \"憎恨\",\n",
+                u8"    \"deDE\": \"Hass\",\n",
+                u8"    \"esES\": \"Odio\",\n",
+                u8"    \"frFR\": \"Haine\",\n",
+                u8"    \"itIT\": \"Odio\",\n",
+                u8"    \"koKR\": \"증오\",\n",
+                u8"    \"plPL\": \"Nienawiść\",\n",
+                u8"    \"esMX\": \"Odio\",\n",
+                u8"    \"jaJP\": \"憎悪\",\n",
+                u8"    \"ptBR\": \"Ódio\",\n",
+                u8"    \"ruRU\": \"Ненависть\",\n",
+                u8"    \"zhCN\": \"憎恨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20557,\n",
+                u8"    \"Key\": \"Runeword51\",\n",
+                u8"    \"enUS\": \"Heart of the Oak\",\n",
+                u8"    \"zhTW\": \"橡樹之心\",\n",
+                u8"    \"deDE\": \"Herz der Eiche\",\n",
+                u8"    \"esES\": \"Corazón de roble\",\n",
+                u8"    \"frFR\": \"Haut chêne\",\n",
+                u8"    \"itIT\": \"Cuore della Quercia\",\n",
+                u8"    \"koKR\": \"참나무의 심장\",\n",
+                u8"    \"plPL\": \"Serce Dębu\",\n",
+                u8"    \"esMX\": \"Corazón de roble\",\n",
+                u8"    \"jaJP\": \"神木の心\",\n",
+                u8"    \"ptBR\": \"Coração do Carvalho\",\n",
+                u8"    \"ruRU\": \"Сердце дуба\",\n",
+                u8"    \"zhCN\": \"橡树之心\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20558,\n",
+                u8"    \"Key\": \"Runeword52\",\n",
+                u8"    \"enUS\": \"Heaven's Will\",\n",
+                u8"    \"zhTW\": \"天堂意志\",\n",
+                u8"    \"deDE\": \"Himmlischer Wille\",\n",
+                u8"    \"esES\": \"Voluntad del cielo\",\n",
+                u8"    \"frFR\": \"Volonté des Cieux\",\n",
+                u8"    \"itIT\": \"Volontà Celeste\",\n",
+                u8"    \"koKR\": \"천상의 의지\",\n",
+                u8"    \"plPL\": \"Wola Niebios\",\n",
+                u8"    \"esMX\": \"Voluntad del cielo\",\n",
+                u8"    \"jaJP\": \"天命\",\n",
+                u8"    \"ptBR\": \"Vontade do Paraíso\",\n",
+                u8"    \"ruRU\": \"Воля небес\",\n",
+                u8"    \"zhCN\": \"天堂意志\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20559,\n",
+                u8"    \"Key\": \"Runeword53\",\n",
+                u8"    \"enUS\": \"Holy Tears\",\n",
+                u8"    \"zhTW\": \"神聖之淚\",\n",
+                u8"    \"deDE\": \"Heilige Tränen\",\n",
+                u8"    \"esES\": \"Lágrimas sagradas\",\n",
+                u8"    \"frFR\": \"Larmes sacrées\",\n",
+                u8"    \"itIT\": \"Sacre Lacrime\",\n",
+                u8"    \"koKR\": \"신성한 눈물\",\n",
+                u8"    \"plPL\": \"Święta Łza\",\n",
+                u8"    \"esMX\": \"Lágrimas sagradas\",\n",
+                u8"    \"jaJP\": \"聖なる涙\",\n",
+                u8"    \"ptBR\": \"Lágrimas Sagradas\",\n",
+                u8"    \"ruRU\": \"Слезы святого\",\n",
+                u8"    \"zhCN\": \"神圣之泪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20560,\n",
+                u8"    \"Key\": \"Runeword54\",\n",
+                u8"    \"enUS\": \"Holy Thunder\",\n",
+                u8"    \"zhTW\": \"神聖雷擊\",\n",
+                u8"    \"deDE\": \"Heiliger Donner\",\n",
+                u8"    \"esES\": \"Trueno sagrado\",\n",
+                u8"    \"frFR\": \"Tonnerre sacré\",\n",
+                u8"    \"itIT\": \"Sacro Tuono\",\n",
+                u8"    \"koKR\": \"신성한 천둥\",\n",
+                u8"    \"plPL\": \"Święty Grom\",\n",
+                u8"    \"esMX\": \"Trueno sagrado\",\n",
+                u8"    \"jaJP\": \"神の雷\",\n",
+                u8"    \"ptBR\": \"Trovão Sagrado\",\n",
+                u8"    \"ruRU\": \"Божественный гром\",\n",
+                u8"    \"zhCN\": \"圣雷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20561,\n",
+                u8"    \"Key\": \"Runeword55\",\n",
+                u8"    \"enUS\": \"Honor\",\n",
+                u8"    \"zhTW\": \"榮耀\",\n",
+                u8"    \"deDE\": \"Ehre\",\n",
+                u8"    \"esES\": \"Honor\",\n",
+                u8"    \"frFR\": \"Honneur\",\n",
+                u8"    \"itIT\": \"Onore\",\n",
+                u8"    \"koKR\": \"명예\",\n",
+                u8"    \"plPL\": \"Honor\",\n",
+                u8"    \"esMX\": \"Honor\",\n",
+                u8"    \"jaJP\": \"名誉\",\n",
+                u8"    \"ptBR\": \"Honra\",\n",
+                u8"    \"ruRU\": \"Честь\",\n",
+                u8"    \"zhCN\": \"荣耀\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20562,\n",
+                u8"    \"Key\": \"Runeword56\",\n",
+                u8"    \"enUS\": \"Revenge\",\n",
+                u8"    \"zhTW\": \"報復\",\n",
+                u8"    \"deDE\": \"Rache\",\n",
+                u8"    \"esES\": \"Revancha\",\n",
+                u8"    \"frFR\": \"Revanche\",\n",
+                u8"    \"itIT\": \"Rivincita\",\n",
+                u8"    \"koKR\": \"보복\",\n",
+                u8"    \"plPL\": \"Mściwość\",\n",
+                u8"    \"esMX\": \"Represalia\",\n",
+                u8"    \"jaJP\": \"復讐\",\n",
+                u8"    \"ptBR\": \"Revanche\",\n",
+                u8"    \"ruRU\": \"Возмездие\",\n",
+                u8"    \"zhCN\": \"报复\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20563,\n",
+                u8"    \"Key\": \"Runeword57\",\n",
+                u8"    \"enUS\": \"Humility\",\n",
+                u8"    \"zhTW\": \"謙恭\",\n",
+                u8"    \"deDE\": \"Demut\",\n",
+                u8"    \"esES\": \"Humildad\",\n",
+                u8"    \"frFR\": \"Humilité\",\n",
+                u8"    \"itIT\": \"Umiltà\",\n",
+                u8"    \"koKR\": \"겸손\",\n",
+                u8"    \"plPL\": \"Pokora\",\n",
+                u8"    \"esMX\": \"Humildad\",\n",
+                u8"    \"jaJP\": \"謙虚\",\n",
+                u8"    \"ptBR\": \"Humildade\",\n",
+                u8"    \"ruRU\": \"Смирение\",\n",
+                u8"    \"zhCN\": \"谦逊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20564,\n",
+                u8"    \"Key\": \"Runeword58\",\n",
+                u8"    \"enUS\": \"Hunger\",\n",
+                u8"    \"zhTW\": \"飢餓\",\n",
+                u8"    \"deDE\": \"Hunger\",\n",
+                u8"    \"esES\": \"Hambre\",\n",
+                u8"    \"frFR\": \"Faim\",\n",
+                u8"    \"itIT\": \"Fame\",\n",
+                u8"    \"koKR\": \"굶주림\",\n",
+                u8"    \"plPL\": \"Głód\",\n",
+                u8"    \"esMX\": \"Hambre\",\n",
+                u8"    \"jaJP\": \"飢え\",\n",
+                u8"    \"ptBR\": \"Fome\",\n",
+                u8"    \"ruRU\": \"Голод\",\n",
+                u8"    \"zhCN\": \"饥饿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20565,\n",
+                u8"    \"Key\": \"Runeword59\",\n",
+                u8"    \"enUS\": \"Ice\",\n",
+                u8"    \"zhTW\": \"寒冰\",\n",
+                u8"    \"deDE\": \"Eis\",\n",
+                u8"    \"esES\": \"Hielo\",\n",
+                u8"    \"frFR\": \"Glace\",\n",
+                u8"    \"itIT\": \"Ghiaccio\",\n",
+                u8"    \"koKR\": \"얼음\",\n",
+                u8"    \"plPL\": \"Lód\",\n",
+                u8"    \"esMX\": \"Hielo\",\n",
+                u8"    \"jaJP\": \"氷\",\n",
+                u8"    \"ptBR\": \"Gelo\",\n",
+                u8"    \"ruRU\": \"Лед\",\n",
+                u8"    \"zhCN\": \"寒冰\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20566,\n",
+                u8"    \"Key\": \"Runeword60\",\n",
+                u8"    \"enUS\": \"Infinity\",\n",
+                u8"    \"zhTW\": \"無限\",\n",
+                u8"    \"deDE\": \"Unendlichkeit\",\n",
+                u8"    \"esES\": \"Infinito\",\n",
+                u8"    \"frFR\": \"Infinité\",\n",
+                u8"    \"itIT\": \"Infinito\",\n",
+                u8"    \"koKR\": \"무한\",\n",
+                u8"    \"plPL\": \"Nieskończoność\",\n",
+                u8"    \"esMX\": \"Infinito\",\n",
+                u8"    \"jaJP\": \"無限\",\n",
+                u8"    \"ptBR\": \"Infinito\",\n",
+                u8"    \"ruRU\": \"Бесконечность\",\n",
+                u8"    \"zhCN\": \"无限\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20567,\n",
+                u8"    \"Key\": \"Runeword61\",\n",
+                u8"    \"enUS\": \"Innocence\",\n",
+                u8"    \"zhTW\": \"純真\",\n",
+                u8"    \"deDE\": \"Unschuld\",\n",
+                u8"    \"esES\": \"Inocencia\",\n",
+                u8"    \"frFR\": \"Innocence\",\n",
+                u8"    \"itIT\": \"Innocenza\",\n",
+                u8"    \"koKR\": \"결백\",\n",
+                u8"    \"plPL\": \"Niewinność\",\n",
+                u8"    \"esMX\": \"Inocencia\",\n",
+                u8"    \"jaJP\": \"無垢\",\n",
+                u8"    \"ptBR\": \"Inocência\",\n",
+                u8"    \"ruRU\": \"Невинность\",\n",
+                u8"    \"zhCN\": \"无辜\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20568,\n",
+                u8"    \"Key\": \"Runeword62\",\n",
+                u8"    \"enUS\": \"Insight\",\n",
+                u8"    \"zhTW\": \"靈光\",\n",
+                u8"    \"deDE\": \"Einsicht\",\n",
+                u8"    \"esES\": \"Perspicacia\",\n",
+                u8"    \"frFR\": \"Spiritualité\",\n",
+                u8"    \"itIT\": \"Intuito\",\n",
+                u8"    \"koKR\": \"통찰\",\n",
+                u8"    \"plPL\": \"Olśnienie\",\n",
+                u8"    \"esMX\": \"Percepción\",\n",
+                u8"    \"jaJP\": \"洞察\",\n",
+                u8"    \"ptBR\": \"Intuição\",\n",
+                u8"    \"ruRU\": \"Прозрение\",\n",
+                u8"    \"zhCN\": \"眼光\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20569,\n",
+                u8"    \"Key\": \"Runeword63\",\n",
+                u8"    \"enUS\": \"Jealousy\",\n",
+                u8"    \"zhTW\": \"妒忌\",\n",
+                u8"    \"deDE\": \"Eifersucht\",\n",
+                u8"    \"esES\": \"Celos\",\n",
+                u8"    \"frFR\": \"Jalousie\",\n",
+                u8"    \"itIT\": \"Gelosia\",\n",
+                u8"    \"koKR\": \"질투\",\n",
+                u8"    \"plPL\": \"Zazdrość\",\n",
+                u8"    \"esMX\": \"Celos\",\n",
+                u8"    \"jaJP\": \"嫉妬\",\n",
+                u8"    \"ptBR\": \"Ciúme\",\n",
+                u8"    \"ruRU\": \"Ревность\",\n",
+                u8"    \"zhCN\": \"嫉妒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20570,\n",
+                u8"    \"Key\": \"Runeword64\",\n",
+                u8"    \"enUS\": \"Judgement\",\n",
+                u8"    \"zhTW\": \"審判\",\n",
+                u8"    \"deDE\": \"Urteil\",\n",
+                u8"    \"esES\": \"Sentencia\",\n",
+                u8"    \"frFR\": \"Jugement\",\n",
+                u8"    \"itIT\": \"Giudizio\",\n",
+                u8"    \"koKR\": \"심판\",\n",
+                u8"    \"plPL\": \"Osąd\",\n",
+                u8"    \"esMX\": \"Juicio\",\n",
+                u8"    \"jaJP\": \"審判\",\n",
+                u8"    \"ptBR\": \"Julgamento\",\n",
+                u8"    \"ruRU\": \"Правосудие\",\n",
+                u8"    \"zhCN\": \"审判\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20571,\n",
+                u8"    \"Key\": \"Runeword65\",\n",
+                u8"    \"enUS\": \"King's Grace\",\n",
+                u8"    \"zhTW\": \"王者的慈悲\",\n",
+                u8"    \"deDE\": \"Königliche Gnade\",\n",
+                u8"    \"esES\": \"Gracia del rey\",\n",
+                u8"    \"frFR\": \"Grâce du roi\",\n",
+                u8"    \"itIT\": \"Grazia del Re\",\n",
+                u8"    \"koKR\": \"왕의 은총\",\n",
+                u8"    \"plPL\": \"Królewska Łaska\",\n",
+                u8"    \"esMX\": \"Gracia del rey\",\n",
+                u8"    \"jaJP\": \"王の赦し\",\n",
+                u8"    \"ptBR\": \"Graça Régia\",\n",
+                u8"    \"ruRU\": \"Милость короля\",\n",
+                u8"    \"zhCN\": \"王恩\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20572,\n",
+                u8"    \"Key\": \"Runeword66\",\n",
+                u8"    \"enUS\": \"Kingslayer\",\n",
+                u8"    \"zhTW\": \"弒王者\",\n",
+                u8"    \"deDE\": \"Königsmord\",\n",
+                u8"    \"esES\": \"Regicida\",\n",
+                u8"    \"frFR\": \"Régicide\",\n",
+                u8"    \"itIT\": \"Regicida\",\n",
+                u8"    \"koKR\": \"왕 시해자\",\n",
+                u8"    \"plPL\": \"Zabójca Królów\",\n",
+                u8"    \"esMX\": \"Matarreyes\",\n",
+                u8"    \"jaJP\": \"王殺し\",\n",
+                u8"    \"ptBR\": \"Regicida\",\n",
+                u8"    \"ruRU\": \"Цареубийца\",\n",
+                u8"    \"zhCN\": \"弑君者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20573,\n",
+                u8"    \"Key\": \"Runeword67\",\n",
+                u8"    \"enUS\": \"Knight's Vigil\",\n",
+                u8"    \"zhTW\": \"騎士守望\",\n",
+                u8"    \"deDE\": \"Ritters Wacht\",\n",
+                u8"    \"esES\": \"Vela del caballero\",\n",
+                u8"    \"frFR\": \"Veille du chevalier\",\n",
+                u8"    \"itIT\": \"Veglia del Cavaliere\",\n",
+                u8"    \"koKR\": \"기사의 경계\",\n",
+                u8"    \"plPL\": \"Rycerska Warta\",\n",
+                u8"    \"esMX\": \"Vigilia del caballero\",\n",
+                u8"    \"jaJP\": \"騎士の見張り\",\n",
+                u8"    \"ptBR\": \"Vigília do Cavaleiro\",\n",
+                u8"    \"ruRU\": \"Бдение рыцаря\",\n",
+                u8"    \"zhCN\": \"骑士之印\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20574,\n",
+                u8"    \"Key\": \"Runeword68\",\n",
+                u8"    \"enUS\": \"Knowledge\",\n",
+                u8"    \"zhTW\": \"學識\",\n",
+                u8"    \"deDE\": \"Wissen\",\n",
+                u8"    \"esES\": \"Saber\",\n",
+                u8"    \"frFR\": \"Connaissance\",\n",
+                u8"    \"itIT\": \"Conoscenza\",\n",
+                u8"    \"koKR\": \"지식\",\n",
+                u8"    \"plPL\": \"Poznanie\",\n",
+                u8"    \"esMX\": \"Conocimiento\",\n",
+                u8"    \"jaJP\": \"知識\",\n",
+                u8"    \"ptBR\": \"Conhecimento\",\n",
+                u8"    \"ruRU\": \"Знание\",\n",
+                u8"    \"zhCN\": \"知识\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20575,\n",
+                u8"    \"Key\": \"Runeword69\",\n",
+                u8"    \"enUS\": \"Last Wish\",\n",
+                u8"    \"zhTW\": \"最後遺願\",\n",
+                u8"    \"deDE\": \"Letzter Wunsch\",\n",
+                u8"    \"esES\": \"Último deseo\",\n",
+                u8"    \"frFR\": \"Dernière volonté\",\n",
+                u8"    \"itIT\": \"Ultimo Desiderio\",\n",
+                u8"    \"koKR\": \"마지막 소원\",\n",
+                u8"    \"plPL\": \"Ostatnie Życzenie\",\n",
+                u8"    \"esMX\": \"Último deseo\",\n",
+                u8"    \"jaJP\": \"最後の願い\",\n",
+                u8"    \"ptBR\": \"Último Desejo\",\n",
+                u8"    \"ruRU\": \"Последняя воля\",\n",
+                u8"    \"zhCN\": \"临终之愿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20576,\n",
+                u8"    \"Key\": \"Runeword70\",\n",
+                u8"    \"enUS\": \"Law\",\n",
+                u8"    \"zhTW\": \"律法\",\n",
+                u8"    \"deDE\": \"Gesetz\",\n",
+                u8"    \"esES\": \"Ley\",\n",
+                u8"    \"frFR\": \"Loi\",\n",
+                u8"    \"itIT\": \"Legge\",\n",
+                u8"    \"koKR\": \"법률\",\n",
+                u8"    \"plPL\": \"Prawo\",\n",
+                u8"    \"esMX\": \"Ley\",\n",
+                u8"    \"jaJP\": \"法\",\n",
+                u8"    \"ptBR\": \"Lei\",\n",
+                u8"    \"ruRU\": \"Закон\",\n",
+                u8"    \"zhCN\": \"律法\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20577,\n",
+                u8"    \"Key\": \"Runeword71\",\n",
+                u8"    \"enUS\": \"Lawbringer\",\n",
+                u8"    \"zhTW\": \"執法者\",\n",
+                u8"    \"deDE\": \"Gesetzesbringer\",\n",
+                u8"    \"esES\": \"Jurista\",\n",
+                u8"    \"frFR\": \"Législateur\",\n",
+                u8"    \"itIT\": \"Legiferatore\",\n",
+                u8"    \"koKR\": \"집행자\",\n",
+                u8"    \"plPL\": \"Prawodawca\",\n",
+                u8"    \"esMX\": \"Justiciero\",\n",
+                u8"    \"jaJP\": \"法の番人\",\n",
+                u8"    \"ptBR\": \"Justiceiro\",\n",
+                u8"    \"ruRU\": \"Судия\",\n",
+                u8"    \"zhCN\": \"执法者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20578,\n",
+                u8"    \"Key\": \"Runeword72\",\n",
+                u8"    \"enUS\": \"Leaf\",\n",
+                u8"    \"zhTW\": \"葉子\",\n",
+                u8"    \"deDE\": \"Blatt\",\n",
+                u8"    \"esES\": \"Hoja\",\n",
+                u8"    \"frFR\": \"Feuille\",\n",
+                u8"    \"itIT\": \"Foglia\",\n",
+                u8"    \"koKR\": \"잎새\",\n",
+                u8"    \"plPL\": \"Liść\",\n",
+                u8"    \"esMX\": \"Hoja\",\n",
+                u8"    \"jaJP\": \"葉\",\n",
+                u8"    \"ptBR\": \"Folha\",\n",
+                u8"    \"ruRU\": \"Лист\",\n",
+                u8"    \"zhCN\": \"叶子\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20579,\n",
+                u8"    \"Key\": \"Runeword73\",\n",
+                u8"    \"enUS\": \"Lightning\",\n",
+                u8"    \"zhTW\": \"閃電\",\n",
+                u8"    \"deDE\": \"Blitzschlag\",\n",
+                u8"    \"esES\": \"Rayo\",\n",
+                u8"    \"frFR\": \"Foudre\",\n",
+                u8"    \"itIT\": \"Fulmine\",\n",
+                u8"    \"koKR\": \"번개\",\n",
+                u8"    \"plPL\": \"Błyskawica\",\n",
+                u8"    \"esMX\": \"Rayo\",\n",
+                u8"    \"jaJP\": \"稲妻\",\n",
+                u8"    \"ptBR\": \"Eletricidade\",\n",
+                u8"    \"ruRU\": \"Молния\",\n",
+                u8"    \"zhCN\": \"闪电\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20580,\n",
+                u8"    \"Key\": \"Runeword74\",\n",
+                u8"    \"enUS\": \"Lionheart\",\n",
+                u8"    \"zhTW\": \"獅子心\",\n",
+                u8"    \"deDE\": \"Löwenherz\",\n",
+                u8"    \"esES\": \"Corazón de león\",\n",
+                u8"    \"frFR\": \"Cœur-de-lion\",\n",
+                u8"    \"itIT\": \"Cuor di Leone\",\n",
+                u8"    \"koKR\": \"용맹\",\n",
+                u8"    \"plPL\": \"Lwie Serce\",\n",
+                u8"    \"esMX\": \"Corazón de león\",\n",
+                u8"    \"jaJP\": \"勇猛\",\n",
+                u8"    \"ptBR\": \"Coração de Leão\",\n",
+                u8"    \"ruRU\": \"Львиное сердце\",\n",
+                u8"    \"zhCN\": \"狮心\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20581,\n",
+                u8"    \"Key\": \"Runeword75\",\n",
+                u8"    \"enUS\": \"Lore\",\n",
+                u8"    \"zhTW\": \"知識\",\n",
+                u8"    \"deDE\": \"Überlieferung\",\n",
+                u8"    \"esES\": \"Acervo\",\n",
+                u8"    \"frFR\": \"Savoir\",\n",
+                u8"    \"itIT\": \"Dottrina\",\n",
+                u8"    \"koKR\": \"전승\",\n",
+                u8"    \"plPL\": \"Wiedza\",\n",
+                u8"    \"esMX\": \"Historia\",\n",
+                u8"    \"jaJP\": \"伝承\",\n",
+                u8"    \"ptBR\": \"Legado\",\n",
+                u8"    \"ruRU\": \"История\",\n",
+                u8"    \"zhCN\": \"学识\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20582,\n",
+                u8"    \"Key\": \"Runeword76\",\n",
+                u8"    \"enUS\": \"Love\",\n",
+                u8"    \"zhTW\": \"愛情\",\n",
+                u8"    \"deDE\": \"Liebe\",\n",
+                u8"    \"esES\": \"Amor\",\n",
+                u8"    \"frFR\": \"Lien amoureux\",\n",
+                u8"    \"itIT\": \"Amore\",\n",
+                u8"    \"koKR\": \"사랑\",\n",
+                u8"    \"plPL\": \"Miłość\",\n",
+                u8"    \"esMX\": \"Amor\",\n",
+                u8"    \"jaJP\": \"愛\",\n",
+                u8"    \"ptBR\": \"Amor\",\n",
+                u8"    \"ruRU\": \"Любовь\",\n",
+                u8"    \"zhCN\": \"爱情\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20583,\n",
+                u8"    \"Key\": \"Runeword77\",\n",
+                u8"    \"enUS\": \"Loyalty\",\n",
+                u8"    \"zhTW\": \"忠誠\",\n",
+                u8"    \"deDE\": \"Treue\",\n",
+                u8"    \"esES\": \"Lealtad\",\n",
+                u8"    \"frFR\": \"Loyauté\",\n",
+                u8"    \"itIT\": \"Fedeltà\",\n",
+                u8"    \"koKR\": \"충심\",\n",
+                u8"    \"plPL\": \"Lojalność\",\n",
+                u8"    \"esMX\": \"Lealtad\",\n",
+                u8"    \"jaJP\": \"忠義\",\n",
+                u8"    \"ptBR\": \"Lealdade\",\n",
+                u8"    \"ruRU\": \"Преданность\",\n",
+                u8"    \"zhCN\": \"忠诚\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20584,\n",
+                u8"    \"Key\": \"Runeword78\",\n",
+                u8"    \"enUS\": \"Lust\",\n",
+                u8"    \"zhTW\": \"慾望\",\n",
+                u8"    \"deDE\": \"Lust\",\n",
+                u8"    \"esES\": \"Lujuria\",\n",
+                u8"    \"frFR\": \"Luxure\",\n",
+                u8"    \"itIT\": \"Lussuria\",\n",
+                u8"    \"koKR\": \"욕정\",\n",
+                u8"    \"plPL\": \"Żądza\",\n",
+                u8"    \"esMX\": \"Lujuria\",\n",
+                u8"    \"jaJP\": \"熱望\",\n",
+                u8"    \"ptBR\": \"Luxúria\",\n",
+                u8"    \"ruRU\": \"Похоть\",\n",
+                u8"    \"zhCN\": \"欲望\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20585,\n",
+                u8"    \"Key\": \"Runeword79\",\n",
+                u8"    \"enUS\": \"Madness\",\n",
+                u8"    \"zhTW\": \"瘋狂\",\n",
+                u8"    \"deDE\": \"Wahnsinn\",\n",
+                u8"    \"esES\": \"Locura\",\n",
+                u8"    \"frFR\": \"Aliénation\",\n",
+                u8"    \"itIT\": \"Follia\",\n",
+                u8"    \"koKR\": \"광기\",\n",
+                u8"    \"plPL\": \"Szaleństwo\",\n",
+                u8"    \"esMX\": \"Locura\",\n",
+                u8"    \"jaJP\": \"狂気\",\n",
+                u8"    \"ptBR\": \"Loucura\",\n",
+                u8"    \"ruRU\": \"Безумие\",\n",
+                u8"    \"zhCN\": \"疯狂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20586,\n",
+                u8"    \"Key\": \"Runeword81\",\n",
+                u8"    \"enUS\": \"Malice\",\n",
+                u8"    \"zhTW\": \"怨恨\",\n",
+                u8"    \"deDE\": \"Boshaftigkeit\",\n",
+                u8"    \"esES\": \"Maldad\",\n",
+                u8"    \"frFR\": \"Méchanceté\",\n",
+                u8"    \"itIT\": \"Malizia\",\n",
+                u8"    \"koKR\": \"악의\",\n",
+                u8"    \"plPL\": \"Złośliwość\",\n",
+                u8"    \"esMX\": \"Malicia\",\n",
+                u8"    \"jaJP\": \"恨み\",\n",
+                u8"    \"ptBR\": \"Malícia\",\n",
+                u8"    \"ruRU\": \"Злоба\",\n",
+                u8"    \"zhCN\": \"怨恨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20587,\n",
+                u8"    \"Key\": \"Runeword82\",\n",
+                u8"    \"enUS\": \"Melody\",\n",
+                u8"    \"zhTW\": \"旋律\",\n",
+                u8"    \"deDE\": \"Melodie\",\n",
+                u8"    \"esES\": \"Melodía\",\n",
+                u8"    \"frFR\": \"Mélodie\",\n",
+                u8"    \"itIT\": \"Melodia\",\n",
+                u8"    \"koKR\": \"선율\",\n",
+                u8"    \"plPL\": \"Melodia\",\n",
+                u8"    \"esMX\": \"Melodía\",\n",
+                u8"    \"jaJP\": \"旋律\",\n",
+                u8"    \"ptBR\": \"Melodia\",\n",
+                u8"    \"ruRU\": \"Мелодия\",\n",
+                u8"    \"zhCN\": \"旋律\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20588,\n",
+                u8"    \"Key\": \"Runeword83\",\n",
+                u8"    \"enUS\": \"Memory\",\n",
+                u8"    \"zhTW\": \"記憶\",\n",
+                u8"    \"deDE\": \"Erinnerung\",\n",
+                u8"    \"esES\": \"Memoria\",\n",
+                u8"    \"frFR\": \"Mémoire\",\n",
+                u8"    \"itIT\": \"Memoria\",\n",
+                u8"    \"koKR\": \"기억\",\n",
+                u8"    \"plPL\": \"Pamięć\",\n",
+                u8"    \"esMX\": \"Memoria\",\n",
+                u8"    \"jaJP\": \"記憶\",\n",
+                u8"    \"ptBR\": \"Memória\",\n",
+                u8"    \"ruRU\": \"Память\",\n",
+                u8"    \"zhCN\": \"回忆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20589,\n",
+                u8"    \"Key\": \"Runeword84\",\n",
+                u8"    \"enUS\": \"Mist\",\n",
+                u8"    \"zhTW\": \"迷霧\",\n",
+                u8"    \"deDE\": \"Nebel\",\n",
+                u8"    \"esES\": \"Bruma\",\n",
+                u8"    \"frFR\": \"Brume\",\n",
+                u8"    \"itIT\": \"Bruma\",\n",
+                u8"    \"koKR\": \"안개\",\n",
+                u8"    \"plPL\": \"Mgła\",\n",
+                u8"    \"esMX\": \"Bruma\",\n",
+                u8"    \"jaJP\": \"霧\",\n",
+                u8"    \"ptBR\": \"Névoa\",\n",
+                u8"    \"ruRU\": \"Туман\",\n",
+                u8"    \"zhCN\": \"迷雾\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20590,\n",
+                u8"    \"Key\": \"Runeword85\",\n",
+                u8"    \"enUS\": \"Morning\",\n",
+                u8"    \"zhTW\": \"清晨\",\n",
+                u8"    \"deDE\": \"Morgen\",\n",
+                u8"    \"esES\": \"Mañana\",\n",
+                u8"    \"frFR\": \"Matin\",\n",
+                u8"    \"itIT\": \"Mattino\",\n",
+                u8"    \"koKR\": \"아침\",\n",
+                u8"    \"plPL\": \"Poranek\",\n",
+                u8"    \"esMX\": \"Mañana\",\n",
+                u8"    \"jaJP\": \"朝\",\n",
+                u8"    \"ptBR\": \"Manhã\",\n",
+                u8"    \"ruRU\": \"Утро\",\n",
+                u8"    \"zhCN\": \"清晨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20591,\n",
+                u8"    \"Key\": \"Runeword86\",\n",
+                u8"    \"enUS\": \"Mystery\",\n",
+                u8"    \"zhTW\": \"神秘\",\n",
+                u8"    \"deDE\": \"Geheimnis\",\n",
+                u8"    \"esES\": \"Misterio\",\n",
+                u8"    \"frFR\": \"Mystère\",\n",
+                u8"    \"itIT\": \"Mistero\",\n",
+                u8"    \"koKR\": \"신비\",\n",
+                u8"    \"plPL\": \"Tajemnica\",\n",
+                u8"    \"esMX\": \"Misterio\",\n",
+                u8"    \"jaJP\": \"神秘\",\n",
+                u8"    \"ptBR\": \"Mistério\",\n",
+                u8"    \"ruRU\": \"Загадка\",\n",
+                u8"    \"zhCN\": \"谜题\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20592,\n",
+                u8"    \"Key\": \"Runeword87\",\n",
+                u8"    \"enUS\": \"Myth\",\n",
+                u8"    \"zhTW\": \"神話\",\n",
+                u8"    \"deDE\": \"Mythos\",\n",
+                u8"    \"esES\": \"Mito\",\n",
+                u8"    \"frFR\": \"Mythe\",\n",
+                u8"    \"itIT\": \"Mito\",\n",
+                u8"    \"koKR\": \"신화\",\n",
+                u8"    \"plPL\": \"Mit\",\n",
+                u8"    \"esMX\": \"Mito\",\n",
+                u8"    \"jaJP\": \"神話\",\n",
+                u8"    \"ptBR\": \"Mito\",\n",
+                u8"    \"ruRU\": \"Миф\",\n",
+                u8"    \"zhCN\": \"神话\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20593,\n",
+                u8"    \"Key\": \"Runeword88\",\n",
+                u8"    \"enUS\": \"Nadir\",\n",
+                u8"    \"zhTW\": \"天底\",\n",
+                u8"    \"deDE\": \"Nadir\",\n",
+                u8"    \"esES\": \"Nadir\",\n",
+                u8"    \"frFR\": \"Nadir\",\n",
+                u8"    \"itIT\": \"Nadir\",\n",
+                u8"    \"koKR\": \"구렁텅이\",\n",
+                u8"    \"plPL\": \"Nadir\",\n",
+                u8"    \"esMX\": \"Nadir\",\n",
+                u8"    \"jaJP\": \"奈落\",\n",
+                u8"    \"ptBR\": \"Nadir\",\n",
+                u8"    \"ruRU\": \"Упадок\",\n",
+                u8"    \"zhCN\": \"天底\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20594,\n",
+                u8"    \"Key\": \"Runeword89\",\n",
+                u8"    \"enUS\": \"Nature's Kingdom\",\n",
+                u8"    \"zhTW\": \"自然王國\",\n",
+                u8"    \"deDE\": \"Königreich der Natur\",\n",
+                u8"    \"esES\": \"Reino de la naturaleza\",\n",
+                u8"    \"frFR\": \"Nature\",\n",
+                u8"    \"itIT\": \"Regno della Natura\",\n",
+                u8"    \"koKR\": \"자연의 왕국\",\n",
+                u8"    \"plPL\": \"Królestwo Natury\",\n",
+                u8"    \"esMX\": \"Reino de la naturaleza\",\n",
+                u8"    \"jaJP\": \"自然の王国\",\n",
+                u8"    \"ptBR\": \"Reino da Natureza\",\n",
+                u8"    \"ruRU\": \"Царство природы\",\n",
+                u8"    \"zhCN\": \"自然王国\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20595,\n",
+                u8"    \"Key\": \"Runeword90\",\n",
+                u8"    \"enUS\": \"Night\",\n",
+                u8"    \"zhTW\": \"夜晚\",\n",
+                u8"    \"deDE\": \"Nacht\",\n",
+                u8"    \"esES\": \"Noche\",\n",
+                u8"    \"frFR\": \"Nuit\",\n",
+                u8"    \"itIT\": \"Notte\",\n",
+                u8"    \"koKR\": \"밤\",\n",
+                u8"    \"plPL\": \"Noc\",\n",
+                u8"    \"esMX\": \"Noche\",\n",
+                u8"    \"jaJP\": \"夜\",\n",
+                u8"    \"ptBR\": \"Noite\",\n",
+                u8"    \"ruRU\": \"Ночь\",\n",
+                u8"    \"zhCN\": \"黑夜\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20596,\n",
+                u8"    \"Key\": \"Runeword91\",\n",
+                u8"    \"enUS\": \"Oath\",\n",
+                u8"    \"zhTW\": \"誓約\",\n",
+                u8"    \"deDE\": \"Eid\",\n",
+                u8"    \"esES\": \"Juramento\",\n",
+                u8"    \"frFR\": \"Serment\",\n",
+                u8"    \"itIT\": \"Giuramento\",\n",
+                u8"    \"koKR\": \"서약\",\n",
+                u8"    \"plPL\": \"Przysięga\",\n",
+                u8"    \"esMX\": \"Juramento\",\n",
+                u8"    \"jaJP\": \"誓い\",\n",
+                u8"    \"ptBR\": \"Juramento\",\n",
+                u8"    \"ruRU\": \"Клятва\",\n",
+                u8"    \"zhCN\": \"誓言\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20597,\n",
+                u8"    \"Key\": \"Runeword92\",\n",
+                u8"    \"enUS\": \"Obedience\",\n",
+                u8"    \"zhTW\": \"遵從\",\n",
+                u8"    \"deDE\": \"Gehorsam\",\n",
+                u8"    \"esES\": \"Obediencia\",\n",
+                u8"    \"frFR\": \"Obéissance \",\n",
+                u8"    \"itIT\": \"Obbedienza\",\n",
+                u8"    \"koKR\": \"순종\",\n",
+                u8"    \"plPL\": \"Posłuszeństwo\",\n",
+                u8"    \"esMX\": \"Obediencia\",\n",
+                u8"    \"jaJP\": \"服従\",\n",
+                u8"    \"ptBR\": \"Obediência\",\n",
+                u8"    \"ruRU\": \"Послушание\",\n",
+                u8"    \"zhCN\": \"顺从\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20598,\n",
+                u8"    \"Key\": \"Runeword93\",\n",
+                u8"    \"enUS\": \"Oblivion\",\n",
+                u8"    \"zhTW\": \"湮沒\",\n",
+                u8"    \"deDE\": \"Nichts\",\n",
+                u8"    \"esES\": \"Olvido\",\n",
+                u8"    \"frFR\": \"Oubli\",\n",
+                u8"    \"itIT\": \"Oblio\",\n",
+                u8"    \"koKR\": \"망각\",\n",
+                u8"    \"plPL\": \"Zapomnienie\",\n",
+                u8"    \"esMX\": \"Olvido\",\n",
+                u8"    \"jaJP\": \"忘却\",\n",
+                u8"    \"ptBR\": \"Esquecimento\",\n",
+                u8"    \"ruRU\": \"Забвение\",\n",
+                u8"    \"zhCN\": \"湮灭\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20599,\n",
+                u8"    \"Key\": \"Runeword94\",\n",
+                u8"    \"enUS\": \"Obsession\",\n",
+                u8"    \"zhTW\": \"執念\",\n",
+                u8"    \"deDE\": \"Besessenheit\",\n",
+                u8"    \"esES\": \"Obsesión\",\n",
+                u8"    \"frFR\": \"Obsession\",\n",
+                u8"    \"itIT\": \"Ossessione\",\n",
+                u8"    \"koKR\": \"집착\",\n",
+                u8"    \"plPL\": \"Obsesja\",\n",
+                u8"    \"esMX\": \"Obsesión\",\n",
+                u8"    \"jaJP\": \"執着\",\n",
+                u8"    \"ptBR\": \"Obsessão\",\n",
+                u8"    \"ruRU\": \"Помешательство\",\n",
+                u8"    \"zhCN\": \"执着\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20600,\n",
+                u8"    \"Key\": \"Runeword95\",\n",
+                u8"    \"enUS\": \"Passion\",\n",
+                u8"    \"zhTW\": \"熱情\",\n",
+                u8"    \"deDE\": \"Leidenschaft\",\n",
+                u8"    \"esES\": \"Pasión\",\n",
+                u8"    \"frFR\": \"Passion\",\n",
+                u8"    \"itIT\": \"Passione\",\n",
+                u8"    \"koKR\": \"열정\",\n",
+                u8"    \"plPL\": \"Pasja\",\n",
+                u8"    \"esMX\": \"Pasión\",\n",
+                u8"    \"jaJP\": \"情熱\",\n",
+                u8"    \"ptBR\": \"Paixão\",\n",
+                u8"    \"ruRU\": \"Страсть\",\n",
+                u8"    \"zhCN\": \"热情\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20601,\n",
+                u8"    \"Key\": \"Runeword96\",\n",
+                u8"    \"enUS\": \"Patience\",\n",
+                u8"    \"zhTW\": \"耐心\",\n",
+                u8"    \"deDE\": \"Geduld\",\n",
+                u8"    \"esES\": \"Paciencia\",\n",
+                u8"    \"frFR\": \"Patience\",\n",
+                u8"    \"itIT\": \"Pazienza\",\n",
+                u8"    \"koKR\": \"끈기\",\n",
+                u8"    \"plPL\": \"Cierpliwość\",\n",
+                u8"    \"esMX\": \"Paciencia\",\n",
+                u8"    \"jaJP\": \"忍耐\",\n",
+                u8"    \"ptBR\": \"Paciência\",\n",
+                u8"    \"ruRU\": \"Терпение\",\n",
+                u8"    \"zhCN\": \"耐心\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20602,\n",
+                u8"    \"Key\": \"Runeword97\",\n",
+                u8"    \"enUS\": \"Pattern\",\n",
+                u8"    \"zhTW\": \"圖紋\",\n",
+                u8"    \"deDE\": \"Prasseln\",\n",
+                u8"    \"esES\": \"Patrón\",\n",
+                u8"    \"frFR\": \"Patron\",\n",
+                u8"    \"itIT\": \"Trama\",\n",
+                u8"    \"koKR\": \"귀감\",\n",
+                u8"    \"plPL\": \"Wzorzec\",\n",
+                u8"    \"esMX\": \"Patrón\",\n",
+                u8"    \"jaJP\": \"模範\",\n",
+                u8"    \"ptBR\": \"Padrão\",\n",
+                u8"    \"ruRU\": \"Узор\",\n",
+                u8"    \"zhCN\": \"典范\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20603,\n",
+                u8"    \"Key\": \"Runeword98\",\n",
+                u8"    \"enUS\": \"Peace\",\n",
+                u8"    \"zhTW\": \"和平\",\n",
+                u8"    \"deDE\": \"Frieden\",\n",
+                u8"    \"esES\": \"Paz\",\n",
+                u8"    \"frFR\": \"Paix\",\n",
+                u8"    \"itIT\": \"Pace\",\n",
+                u8"    \"koKR\": \"평화\",\n",
+                u8"    \"plPL\": \"Pokój\",\n",
+                u8"    \"esMX\": \"Paz\",\n",
+                u8"    \"jaJP\": \"平和\",\n",
+                u8"    \"ptBR\": \"Paz\",\n",
+                u8"    \"ruRU\": \"Мир\",\n",
+                u8"    \"zhCN\": \"平和\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20604,\n",
+                u8"    \"Key\": \"Runeword99\",\n",
+                u8"    \"enUS\": \"Voice of Reason\",\n",
+                u8"    \"zhTW\": \"理性之聲\",\n",
+                u8"    \"deDE\": \"Stimme der Vernunft\",\n",
+                u8"    \"esES\": \"Voz de la razón\",\n",
+                u8"    \"frFR\": \"Voix de la raison\",\n",
+                u8"    \"itIT\": \"Voce della Ragione\",\n",
+                u8"    \"koKR\": \"이성의 목소리\",\n",
+                u8"    \"plPL\": \"Głos Rozsądku\",\n",
+                u8"    \"esMX\": \"Voz de la razón\",\n",
+                u8"    \"jaJP\": \"理知の声\",\n",
+                u8"    \"ptBR\": \"Voz da Razão\",\n",
+                u8"    \"ruRU\": \"Голос разума\",\n",
+                u8"    \"zhCN\": \"理智之声\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20605,\n",
+                u8"    \"Key\": \"Runeword100\",\n",
+                u8"    \"enUS\": \"Penitence\",\n",
+                u8"    \"zhTW\": \"懺悔\",\n",
+                u8"    \"deDE\": \"Reue\",\n",
+                u8"    \"esES\": \"Penitencia\",\n",
+                u8"    \"frFR\": \"Pénitence\",\n",
+                u8"    \"itIT\": \"Penitenza\",\n",
+                u8"    \"koKR\": \"참회\",\n",
+                u8"    \"plPL\": \"Skrucha\",\n",
+                u8"    \"esMX\": \"Penitencia\",\n",
+                u8"    \"jaJP\": \"懺悔\",\n",
+                u8"    \"ptBR\": \"Penitência\",\n",
+                u8"    \"ruRU\": \"Покаяние\",\n",
+                u8"    \"zhCN\": \"忏悔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20606,\n",
+                u8"    \"Key\": \"Runeword101\",\n",
+                u8"    \"enUS\": \"Peril\",\n",
+                u8"    \"zhTW\": \"危害\",\n",
+                u8"    \"deDE\": \"Gefahr\",\n",
+                u8"    \"esES\": \"Peligro\",\n",
+                u8"    \"frFR\": \"Péril\",\n",
+                u8"    \"itIT\": \"Pericolo\",\n",
+                u8"    \"koKR\": \"위기\",\n",
+                u8"    \"plPL\": \"Niebezpieczeństwo\",\n",
+                u8"    \"esMX\": \"Riesgo\",\n",
+                u8"    \"jaJP\": \"危機\",\n",
+                u8"    \"ptBR\": \"Perigo\",\n",
+                u8"    \"ruRU\": \"Опасность\",\n",
+                u8"    \"zhCN\": \"灾劫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20607,\n",
+                u8"    \"Key\": \"Runeword102\",\n",
+                u8"    \"enUS\": \"Pestilence\",\n",
+                u8"    \"zhTW\": \"疫病\",\n",
+                u8"    \"deDE\": \"Pestilenz\",\n",
+                u8"    \"esES\": \"Pestilencia\",\n",
+                u8"    \"frFR\": \"Pestilence\",\n",
+                u8"    \"itIT\": \"Pestilenza\",\n",
+                u8"    \"koKR\": \"질병\",\n",
+                u8"    \"plPL\": \"Zaraza\",\n",
+                u8"    \"esMX\": \"Pestilencia\",\n",
+                u8"    \"jaJP\": \"悪疫\",\n",
+                u8"    \"ptBR\": \"Pestilência\",\n",
+                u8"    \"ruRU\": \"Мор\",\n",
+                u8"    \"zhCN\": \"疾病\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20608,\n",
+                u8"    \"Key\": \"Runeword103\",\n",
+                u8"    \"enUS\": \"Phoenix\",\n",
+                u8"    \"zhTW\": \"鳳凰\",\n",
+                u8"    \"deDE\": \"Phönix\",\n",
+                u8"    \"esES\": \"Fénix\",\n",
+                u8"    \"frFR\": \"Phénix\",\n",
+                u8"    \"itIT\": \"Fenice\",\n",
+                u8"    \"koKR\": \"불사조\",\n",
+                u8"    \"plPL\": \"Feniks\",\n",
+                u8"    \"esMX\": \"Fénix\",\n",
+                u8"    \"jaJP\": \"不死鳥\",\n",
+                u8"    \"ptBR\": \"Fênix\",\n",
+                u8"    \"ruRU\": \"Феникс\",\n",
+                u8"    \"zhCN\": \"凤凰\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20609,\n",
+                u8"    \"Key\": \"Runeword104\",\n",
+                u8"    \"enUS\": \"Piety\",\n",
+                u8"    \"zhTW\": \"虔誠\",\n",
+                u8"    \"deDE\": \"Frömmigkeit\",\n",
+                u8"    \"esES\": \"Piedad\",\n",
+                u8"    \"frFR\": \"Piété\",\n",
+                u8"    \"itIT\": \"Pietà\",\n",
+                u8"    \"koKR\": \"경건\",\n",
+                u8"    \"plPL\": \"Pobożność\",\n",
+                u8"    \"esMX\": \"Piedad\",\n",
+                u8"    \"jaJP\": \"敬神\",\n",
+                u8"    \"ptBR\": \"Piedade\",\n",
+                u8"    \"ruRU\": \"Благочестие\",\n",
+                u8"    \"zhCN\": \"虔敬\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20610,\n",
+                u8"    \"Key\": \"Runeword105\",\n",
+                u8"    \"enUS\": \"Pillar of Faith\",\n",
+                u8"    \"zhTW\": \"信念之柱\",\n",
+                u8"    \"deDE\": \"Säule des Glaubens\",\n",
+                u8"    \"esES\": \"Pilar de fe\",\n",
+                u8"    \"frFR\": \"Pilier de la foi\",\n",
+                u8"    \"itIT\": \"Pilastro della Fede\",\n",
+                u8"    \"koKR\": \"신념의 기둥\",\n",
+                u8"    \"plPL\": \"Filar Wiary\",\n",
+                u8"    \"esMX\": \"Pilar de fe\",\n",
+                u8"    \"jaJP\": \"信仰の柱\",\n",
+                u8"    \"ptBR\": \"Pilar da Fé\",\n",
+                u8"    \"ruRU\": \"Столп веры\",\n",
+                u8"    \"zhCN\": \"信念之柱\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20611,\n",
+                u8"    \"Key\": \"Runeword106\",\n",
+                u8"    \"enUS\": \"Plague\",\n",
+                u8"    \"zhTW\": \"瘟疫\",\n",
+                u8"    \"deDE\": \"Pest\",\n",
+                u8"    \"esES\": \"Peste\",\n",
+                u8"    \"frFR\": \"Peste\",\n",
+                u8"    \"itIT\": \"Contagio\",\n",
+                u8"    \"koKR\": \"역병\",\n",
+                u8"    \"plPL\": \"Plaga\",\n",
+                u8"    \"esMX\": \"Peste\",\n",
+                u8"    \"jaJP\": \"災厄\",\n",
+                u8"    \"ptBR\": \"Peste\",\n",
+                u8"    \"ruRU\": \"Чума\",\n",
+                u8"    \"zhCN\": \"瘟疫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20612,\n",
+                u8"    \"Key\": \"Runeword107\",\n",
+                u8"    \"enUS\": \"Praise\",\n",
+                u8"    \"zhTW\": \"頌揚\",\n",
+                u8"    \"deDE\": \"Lobpreisung\",\n",
+                u8"    \"esES\": \"Alabanza\",\n",
+                u8"    \"frFR\": \"Louange\",\n",
+                u8"    \"itIT\": \"Lode\",\n",
+                u8"    \"koKR\": \"칭송\",\n",
+                u8"    \"plPL\": \"Pochwała\",\n",
+                u8"    \"esMX\": \"Loa\",\n",
+                u8"    \"jaJP\": \"賛美\",\n",
+                u8"    \"ptBR\": \"Louvor\",\n",
+                u8"    \"ruRU\": \"Похвала\",\n",
+                u8"    \"zhCN\": \"赞美\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20613,\n",
+                u8"    \"Key\": \"Runeword108\",\n",
+                u8"    \"enUS\": \"Prayer\",\n",
+                u8"    \"zhTW\": \"祈禱\",\n",
+                u8"    \"deDE\": \"Gebet\",\n",
+                u8"    \"esES\": \"Oración\",\n",
+                u8"    \"frFR\": \"Prière\",\n",
+                u8"    \"itIT\": \"Preghiera\",\n",
+                u8"    \"koKR\": \"기도\",\n",
+                u8"    \"plPL\": \"Modlitwa\",\n",
+                u8"    \"esMX\": \"Plegaria\",\n",
+                u8"    \"jaJP\": \"祈願\",\n",
+                u8"    \"ptBR\": \"Prece\",\n",
+                u8"    \"ruRU\": \"Молитва\",\n",
+                u8"    \"zhCN\": \"祈祷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20614,\n",
+                u8"    \"Key\": \"Runeword109\",\n",
+                u8"    \"enUS\": \"Pride\",\n",
+                u8"    \"zhTW\": \"驕傲\",\n",
+                u8"    \"deDE\": \"Stolz\",\n",
+                u8"    \"esES\": \"Orgullo\",\n",
+                u8"    \"frFR\": \"Fierté\",\n",
+                u8"    \"itIT\": \"Superbia\",\n",
+                u8"    \"koKR\": \"긍지\",\n",
+                u8"    \"plPL\": \"Duma\",\n",
+                u8"    \"esMX\": \"Orgullo\",\n",
+                u8"    \"jaJP\": \"誇り\",\n",
+                u8"    \"ptBR\": \"Orgulho\",\n",
+                u8"    \"ruRU\": \"Гордость\",\n",
+                u8"    \"zhCN\": \"骄傲\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20615,\n",
+                u8"    \"Key\": \"Runeword110\",\n",
+                u8"    \"enUS\": \"Principle\",\n",
+                u8"    \"zhTW\": \"原則\",\n",
+                u8"    \"deDE\": \"Prinzip\",\n",
+                u8"    \"esES\": \"Principio\",\n",
+                u8"    \"frFR\": \"Principe\",\n",
+                u8"    \"itIT\": \"Principio\",\n",
+                u8"    \"koKR\": \"원칙\",\n",
+                u8"    \"plPL\": \"Zasada\",\n",
+                u8"    \"esMX\": \"Principio\",\n",
+                u8"    \"jaJP\": \"原理\",\n",
+                u8"    \"ptBR\": \"Princípio\",\n",
+                u8"    \"ruRU\": \"Убеждение\",\n",
+                u8"    \"zhCN\": \"信条\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20616,\n",
+                u8"    \"Key\": \"Runeword111\",\n",
+                u8"    \"enUS\": \"Prowess in Battle\",\n",
+                u8"    \"zhTW\": \"勇戰之力\",\n",
+                u8"    \"deDE\": \"Tapferkeit im Kampf\",\n",
+                u8"    \"esES\": \"Habilidad en combate\",\n",
+                u8"    \"frFR\": \"Prouesse\",\n",
+                u8"    \"itIT\": \"Prodezza\",\n",
+                u8"    \"koKR\": \"전장의 기량\",\n",
+                u8"    \"plPL\": \"Sprawność Bojowa\",\n",
+                u8"    \"esMX\": \"Destreza en combate\",\n",
+                u8"    \"jaJP\": \"武勇\",\n",
+                u8"    \"ptBR\": \"Perícia em Batalha\",\n",
+                u8"    \"ruRU\": \"Доблесть\",\n",
+                u8"    \"zhCN\": \"战力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20617,\n",
+                u8"    \"Key\": \"Runeword112\",\n",
+                u8"    \"enUS\": \"Prudence\",\n",
+                u8"    \"zhTW\": \"謹慎\",\n",
+                u8"    \"deDE\": \"Besonnenheit\",\n",
+                u8"    \"esES\": \"Prudencia\",\n",
+                u8"    \"frFR\": \"Prudence\",\n",
+                u8"    \"itIT\": \"Prudenza\",\n",
+                u8"    \"koKR\": \"신중\",\n",
+                u8"    \"plPL\": \"Rozwaga\",\n",
+                u8"    \"esMX\": \"Prudencia\",\n",
+                u8"    \"jaJP\": \"分別\",\n",
+                u8"    \"ptBR\": \"Prudência\",\n",
+                u8"    \"ruRU\": \"Благоразумие\",\n",
+                u8"    \"zhCN\": \"谨慎\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20618,\n",
+                u8"    \"Key\": \"Runeword113\",\n",
+                u8"    \"enUS\": \"Punishment\",\n",
+                u8"    \"zhTW\": \"懲罰\",\n",
+                u8"    \"deDE\": \"Strafe\",\n",
+                u8"    \"esES\": \"Castigo\",\n",
+                u8"    \"frFR\": \"Punition\",\n",
+                u8"    \"itIT\": \"Punizione\",\n",
+                u8"    \"koKR\": \"징벌\",\n",
+                u8"    \"plPL\": \"Kara\",\n",
+                u8"    \"esMX\": \"Castigo\",\n",
+                u8"    \"jaJP\": \"罰\",\n",
+                u8"    \"ptBR\": \"Punição\",\n",
+                u8"    \"ruRU\": \"Наказание\",\n",
+                u8"    \"zhCN\": \"惩罚\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20619,\n",
+                u8"    \"Key\": \"Runeword114\",\n",
+                u8"    \"enUS\": \"Purity\",\n",
+                u8"    \"zhTW\": \"純潔\",\n",
+                u8"    \"deDE\": \"Reinheit\",\n",
+                u8"    \"esES\": \"Pureza\",\n",
+                u8"    \"frFR\": \"Pureté\",\n",
+                u8"    \"itIT\": \"Purezza\",\n",
+                u8"    \"koKR\": \"순수\",\n",
+                u8"    \"plPL\": \"Czystość\",\n",
+                u8"    \"esMX\": \"Pureza\",\n",
+                u8"    \"jaJP\": \"純粋\",\n",
+                u8"    \"ptBR\": \"Pureza\",\n",
+                u8"    \"ruRU\": \"Чистота\",\n",
+                u8"    \"zhCN\": \"纯洁\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20620,\n",
+                u8"    \"Key\": \"Runeword115\",\n",
+                u8"    \"enUS\": \"Question\",\n",
+                u8"    \"zhTW\": \"疑問\",\n",
+                u8"    \"deDE\": \"Frage\",\n",
+                u8"    \"esES\": \"Duda\",\n",
+                u8"    \"frFR\": \"Question\",\n",
+                u8"    \"itIT\": \"Quesito\",\n",
+                u8"    \"koKR\": \"의문\",\n",
+                u8"    \"plPL\": \"Pytanie\",\n",
+                u8"    \"esMX\": \"Pregunta\",\n",
+                u8"    \"jaJP\": \"疑問\",\n",
+                u8"    \"ptBR\": \"Questão\",\n",
+                u8"    \"ruRU\": \"Вопрос\",\n",
+                u8"    \"zhCN\": \"质问\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20621,\n",
+                u8"    \"Key\": \"Runeword116\",\n",
+                u8"    \"enUS\": \"Radiance\",\n",
+                u8"    \"zhTW\": \"光輝\",\n",
+                u8"    \"deDE\": \"Glanz\",\n",
+                u8"    \"esES\": \"Resplandor\",\n",
+                u8"    \"frFR\": \"Rayon\",\n",
+                u8"    \"itIT\": \"Fulgore\",\n",
+                u8"    \"koKR\": \"광휘\",\n",
+                u8"    \"plPL\": \"Blask\",\n",
+                u8"    \"esMX\": \"Resplandor\",\n",
+                u8"    \"jaJP\": \"輝き\",\n",
+                u8"    \"ptBR\": \"Luminosidade\",\n",
+                u8"    \"ruRU\": \"Сияние\",\n",
+                u8"    \"zhCN\": \"光辉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20622,\n",
+                u8"    \"Key\": \"Runeword117\",\n",
+                u8"    \"enUS\": \"Rain\",\n",
+                u8"    \"zhTW\": \"降雨\",\n",
+                u8"    \"deDE\": \"Regen\",\n",
+                u8"    \"esES\": \"Lluvia\",\n",
+                u8"    \"frFR\": \"Pluie\",\n",
+                u8"    \"itIT\": \"Pioggia\",\n",
+                u8"    \"koKR\": \"비\",\n",
+                u8"    \"plPL\": \"Deszcz\",\n",
+                u8"    \"esMX\": \"Lluvia\",\n",
+                u8"    \"jaJP\": \"雨\",\n",
+                u8"    \"ptBR\": \"Chuva\",\n",
+                u8"    \"ruRU\": \"Ливень\",\n",
+                u8"    \"zhCN\": \"暴雨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20623,\n",
+                u8"    \"Key\": \"Runeword118\",\n",
+                u8"    \"enUS\": \"Reason\",\n",
+                u8"    \"zhTW\": \"理由\",\n",
+                u8"    \"deDE\": \"Vernunft\",\n",
+                u8"    \"esES\": \"Razón\",\n",
+                u8"    \"frFR\": \"Raison\",\n",
+                u8"    \"itIT\": \"Ragione\",\n",
+                u8"    \"koKR\": \"이성\",\n",
+                u8"    \"plPL\": \"Rozsądek\",\n",
+                u8"    \"esMX\": \"Razón\",\n",
+                u8"    \"jaJP\": \"理性\",\n",
+                u8"    \"ptBR\": \"Razão\",\n",
+                u8"    \"ruRU\": \"Разум\",\n",
+                u8"    \"zhCN\": \"理性\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20624,\n",
+                u8"    \"Key\": \"Runeword119\",\n",
+                u8"    \"enUS\": \"Red\",\n",
+                u8"    \"zhTW\": \"鮮紅\",\n",
+                u8"    \"deDE\": \"Röte\",\n",
+                u8"    \"esES\": \"Rojez\",\n",
+                u8"    \"frFR\": \"Rouge\",\n",
+                u8"    \"itIT\": \"Rosso\",\n",
+                u8"    \"koKR\": \"핏빛\",\n",
+                u8"    \"plPL\": \"Czerwień\",\n",
+                u8"    \"esMX\": \"Rojo\",\n",
+                u8"    \"jaJP\": \"赤\",\n",
+                u8"    \"ptBR\": \"Vermelho\",\n",
+                u8"    \"ruRU\": \"Багрянец\",\n",
+                u8"    \"zhCN\": \"绯红\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20625,\n",
+                u8"    \"Key\": \"Runeword120\",\n",
+                u8"    \"enUS\": \"Rhyme\",\n",
+                u8"    \"zhTW\": \"聲韻\",\n",
+                u8"    \"deDE\": \"Reim\",\n",
+                u8"    \"esES\": \"Rima\",\n",
+                u8"    \"frFR\": \"Rime\",\n",
+                u8"    \"itIT\": \"Rima\",\n",
+                u8"    \"koKR\": \"각운\",\n",
+                u8"    \"plPL\": \"Rym\",\n",
+                u8"    \"esMX\": \"Rima\",\n",
+                u8"    \"jaJP\": \"韻\",\n",
+                u8"    \"ptBR\": \"Rima\",\n",
+                u8"    \"ruRU\": \"Рифма\",\n",
+                u8"    \"zhCN\": \"韵律\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20626,\n",
+                u8"    \"Key\": \"Runeword121\",\n",
+                u8"    \"enUS\": \"Rift\",\n",
+                u8"    \"zhTW\": \"裂隙\",\n",
+                u8"    \"deDE\": \"Zerrissenheit\",\n",
+                u8"    \"esES\": \"Grieta\",\n",
+                u8"    \"frFR\": \"Rupture\",\n",
+                u8"    \"itIT\": \"Varco\",\n",
+                u8"    \"koKR\": \"균열\",\n",
+                u8"    \"plPL\": \"Szczelina\",\n",
+                u8"    \"esMX\": \"Grieta\",\n",
+                u8"    \"jaJP\": \"不和\",\n",
+                u8"    \"ptBR\": \"Fenda\",\n",
+                u8"    \"ruRU\": \"Разлом\",\n",
+                u8"    \"zhCN\": \"裂隙\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20627,\n",
+                u8"    \"Key\": \"Runeword122\",\n",
+                u8"    \"enUS\": \"Sanctuary\",\n",
+                u8"    \"zhTW\": \"聖堂\",\n",
+                u8"    \"deDE\": \"Zuflucht\",\n",
+                u8"    \"esES\": \"Santuario\",\n",
+                u8"    \"frFR\": \"Sanctuaire\",\n",
+                u8"    \"itIT\": \"Santuario\",\n",
+                u8"    \"koKR\": \"성역\",\n",
+                u8"    \"plPL\": \"Sanktuarium\",\n",
+                u8"    \"esMX\": \"Santuario\",\n",
+                u8"    \"jaJP\": \"聖域\",\n",
+                u8"    \"ptBR\": \"Santuário\",\n",
+                u8"    \"ruRU\": \"Убежище\",\n",
+                u8"    \"zhCN\": \"庇护\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20628,\n",
+                u8"    \"Key\": \"Runeword123\",\n",
+                u8"    \"enUS\": \"Serendipity\",\n",
+                u8"    \"zhTW\": \"機緣\",\n",
+                u8"    \"deDE\": \"Glückseligkeit\",\n",
+                u8"    \"esES\": \"Serendipia\",\n",
+                u8"    \"frFR\": \"Veine\",\n",
+                u8"    \"itIT\": \"Serendipità\",\n",
+                u8"    \"koKR\": \"우연한 행운\",\n",
+                u8"    \"plPL\": \"Łut Szczęścia\",\n",
+                u8"    \"esMX\": \"Serendipia\",\n",
+                u8"    \"jaJP\": \"僥倖\",\n",
+                u8"    \"ptBR\": \"Acaso\",\n",
+                u8"    \"ruRU\": \"Прозорливость\",\n",
+                u8"    \"zhCN\": \"奇遇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20629,\n",
+                u8"    \"Key\": \"Runeword124\",\n",
+                u8"    \"enUS\": \"Shadow\",\n",
+                u8"    \"zhTW\": \"暗影\",\n",
+                u8"    \"deDE\": \"Schatten\",\n",
+                u8"    \"esES\": \"Sombra\",\n",
+                u8"    \"frFR\": \"Ombre\",\n",
+                u8"    \"itIT\": \"Ombra\",\n",
+                u8"    \"koKR\": \"그림자\",\n",
+                u8"    \"plPL\": \"Cień\",\n",
+                u8"    \"esMX\": \"Sombra\",\n",
+                u8"    \"jaJP\": \"闇\",\n",
+                u8"    \"ptBR\": \"Sombra\",\n",
+                u8"    \"ruRU\": \"Тень\",\n",
+                u8"    \"zhCN\": \"阴影\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20630,\n",
+                u8"    \"Key\": \"Runeword125\",\n",
+                u8"    \"enUS\": \"Shadow of Doubt\",\n",
+                u8"    \"zhTW\": \"懷疑之影\",\n",
+                u8"    \"deDE\": \"Schatten des Zweifels\",\n",
+                u8"    \"esES\": \"Sombra de duda\",\n",
+                u8"    \"frFR\": \"Ombre du doute\",\n",
+                u8"    \"itIT\": \"Ombra del Dubbio\",\n",
+                u8"    \"koKR\": \"의심의 그림자\",\n",
+                u8"    \"plPL\": \"Cień Wątpliwości\",\n",
+                u8"    \"esMX\": \"Sombra de la duda\",\n",
+                u8"    \"jaJP\": \"疑惑の影\",\n",
+                u8"    \"ptBR\": \"Sombra da Dúvida\",\n",
+                u8"    \"ruRU\": \"Тень сомнения\",\n",
+                u8"    \"zhCN\": \"疑虑之影\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20631,\n",
+                u8"    \"Key\": \"Runeword126\",\n",
+                u8"    \"enUS\": \"Silence\",\n",
+                u8"    \"zhTW\": \"寂靜\",\n",
+                u8"    \"deDE\": \"Stille\",\n",
+                u8"    \"esES\": \"Silencio\",\n",
+                u8"    \"frFR\": \"Silence\",\n",
+                u8"    \"itIT\": \"Silenzio\",\n",
+                u8"    \"koKR\": \"침묵\",\n",
+                u8"    \"plPL\": \"Cisza\",\n",
+                u8"    \"esMX\": \"Silencio\",\n",
+                u8"    \"jaJP\": \"静寂\",\n",
+                u8"    \"ptBR\": \"Silêncio\",\n",
+                u8"    \"ruRU\": \"Безмолвие\",\n",
+                u8"    \"zhCN\": \"沉默\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20632,\n",
+                u8"    \"Key\": \"Runeword127\",\n",
+                u8"    \"enUS\": \"Siren's Song\",\n",
+                u8"    \"zhTW\": \"賽蓮之歌\",\n",
+                u8"    \"deDE\": \"Sirenengesang\",\n",
+                u8"    \"esES\": \"Canto de sirena\",\n",
+                u8"    \"frFR\": \"Sirène\",\n",
+                u8"    \"itIT\": \"Canto della Sirena\",\n",
+                u8"    \"koKR\": \"세이렌의 노래\",\n",
+                u8"    \"plPL\": \"Pieśń Syreny\",\n",
+                u8"    \"esMX\": \"Canto de sirena\",\n",
+                u8"    \"jaJP\": \"セイレーンの歌\",\n",
+                u8"    \"ptBR\": \"Canto da Sirena\",\n",
+                u8"    \"ruRU\": \"Песнь сирены\",\n",
+                u8"    \"zhCN\": \"海妖之歌\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20633,\n",
+                u8"    \"Key\": \"Runeword128\",\n",
+                u8"    \"enUS\": \"Smoke\",\n",
+                u8"    \"zhTW\": \"煙霧\",\n",
+                u8"    \"deDE\": \"Rauch\",\n",
+                u8"    \"esES\": \"Humo\",\n",
+                u8"    \"frFR\": \"Fumée\",\n",
+                u8"    \"itIT\": \"Fumo\",\n",
+                u8"    \"koKR\": \"연기\",\n",
+                u8"    \"plPL\": \"Dym\",\n",
+                u8"    \"esMX\": \"Humo\",\n",
+                u8"    \"jaJP\": \"煙\",\n",
+                u8"    \"ptBR\": \"Fumaça\",\n",
+                u8"    \"ruRU\": \"Дым\",\n",
+                u8"    \"zhCN\": \"烟雾\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20634,\n",
+                u8"    \"Key\": \"Runeword129\",\n",
+                u8"    \"enUS\": \"Sorrow\",\n",
+                u8"    \"zhTW\": \"哀傷\",\n",
+                u8"    \"deDE\": \"Traurigkeit\",\n",
+                u8"    \"esES\": \"Tristeza\",\n",
+                u8"    \"frFR\": \"Tristesse\",\n",
+                u8"    \"itIT\": \"Rimorso\",\n",
+                u8"    \"koKR\": \"비탄\",\n",
+                u8"    \"plPL\": \"Smutek\",\n",
+                u8"    \"esMX\": \"Melancolía\",\n",
+                u8"    \"jaJP\": \"悲哀\",\n",
+                u8"    \"ptBR\": \"Mágoa\",\n",
+                u8"    \"ruRU\": \"Скорбь\",\n",
+                u8"    \"zhCN\": \"悲伤\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20635,\n",
+                u8"    \"Key\": \"Runeword130\",\n",
+                u8"    \"enUS\": \"Spirit\",\n",
+                u8"    \"zhTW\": \"精神\",\n",
+                u8"    \"deDE\": \"Geist\",\n",
+                u8"    \"esES\": \"Espíritu\",\n",
+                u8"    \"frFR\": \"Esprit\",\n",
+                u8"    \"itIT\": \"Spirito\",\n",
+                u8"    \"koKR\": \"영혼\",\n",
+                u8"    \"plPL\": \"Duch\",\n",
+                u8"    \"esMX\": \"Espíritu\",\n",
+                u8"    \"jaJP\": \"精霊\",\n",
+                u8"    \"ptBR\": \"Espírito\",\n",
+                u8"    \"ruRU\": \"Дух\",\n",
+                u8"    \"zhCN\": \"精神\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20636,\n",
+                u8"    \"Key\": \"Runeword131\",\n",
+                u8"    \"enUS\": \"Splendor\",\n",
+                u8"    \"zhTW\": \"燦爛\",\n",
+                u8"    \"deDE\": \"Pracht\",\n",
+                u8"    \"esES\": \"Esplendor\",\n",
+                u8"    \"frFR\": \"Splendeur\",\n",
+                u8"    \"itIT\": \"Splendore\",\n",
+                u8"    \"koKR\": \"광채\",\n",
+                u8"    \"plPL\": \"Splendor\",\n",
+                u8"    \"esMX\": \"Esplendor\",\n",
+                u8"    \"jaJP\": \"壮麗\",\n",
+                u8"    \"ptBR\": \"Esplendor\",\n",
+                u8"    \"ruRU\": \"Великолепие\",\n",
+                u8"    \"zhCN\": \"壮美\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20637,\n",
+                u8"    \"Key\": \"Runeword132\",\n",
+                u8"    \"enUS\": \"Starlight\",\n",
+                u8"    \"zhTW\": \"星光\",\n",
+                u8"    \"deDE\": \"Sternenlicht\",\n",
+                u8"    \"esES\": \"Luz de las estrellas\",\n",
+                u8"    \"frFR\": \"Lumière stellaire\",\n",
+                u8"    \"itIT\": \"Luce Stellare\",\n",
+                u8"    \"koKR\": \"별빛\",\n",
+                u8"    \"plPL\": \"Światło Gwiazd\",\n",
+                u8"    \"esMX\": \"Luz estelar\",\n",
+                u8"    \"jaJP\": \"星の光\",\n",
+                u8"    \"ptBR\": \"Luz Estelar\",\n",
+                u8"    \"ruRU\": \"Звездный свет\",\n",
+                u8"    \"zhCN\": \"星光\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20638,\n",
+                u8"    \"Key\": \"Runeword133\",\n",
+                u8"    \"enUS\": \"Stealth\",\n",
+                u8"    \"zhTW\": \"隱密\",\n",
+                u8"    \"deDE\": \"Verstohlenheit\",\n",
+                u8"    \"esES\": \"Sigilo\",\n",
+                u8"    \"frFR\": \"Discrétion\",\n",
+                u8"    \"itIT\": \"Furtività\",\n",
+                u8"    \"koKR\": \"잠행\",\n",
+                u8"    \"plPL\": \"Skradanie\",\n",
+                u8"    \"esMX\": \"Sigilo\",\n",
+                u8"    \"jaJP\": \"隠密\",\n",
+                u8"    \"ptBR\": \"Furtividade\",\n",
+                u8"    \"ruRU\": \"Незаметность\",\n",
+                u8"    \"zhCN\": \"隐秘\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20639,\n",
+                u8"    \"Key\": \"Runeword134\",\n",
+                u8"    \"enUS\": \"Steel\",\n",
+                u8"    \"zhTW\": \"鋼鐵\",\n",
+                u8"    \"deDE\": \"Stahl\",\n",
+                u8"    \"esES\": \"Acero\",\n",
+                u8"    \"frFR\": \"Acier\",\n",
+                u8"    \"itIT\": \"Acciaio\",\n",
+                u8"    \"koKR\": \"강철\",\n",
+                u8"    \"plPL\": \"Stal\",\n",
+                u8"    \"esMX\": \"Acero\",\n",
+                u8"    \"jaJP\": \"鋼\",\n",
+                u8"    \"ptBR\": \"Aço\",\n",
+                u8"    \"ruRU\": \"Сталь\",\n",
+                u8"    \"zhCN\": \"钢铁\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20640,\n",
+                u8"    \"Key\": \"Runeword135\",\n",
+                u8"    \"enUS\": \"Still Water\",\n",
+                u8"    \"zhTW\": \"寂靜之水\",\n",
+                u8"    \"deDE\": \"Stilles Wasser\",\n",
+                u8"    \"esES\": \"Aguas tranquilas\",\n",
+                u8"    \"frFR\": \"Eaux calmes\",\n",
+                u8"    \"itIT\": \"Acqua Ferma\",\n",
+                u8"    \"koKR\": \"고요한 물\",\n",
+                u8"    \"plPL\": \"Spokojna Woda\",\n",
+                u8"    \"esMX\": \"Agua estancada\",\n",
+                u8"    \"jaJP\": \"淀み\",\n",
+                u8"    \"ptBR\": \"Água Parada\",\n",
+                u8"    \"ruRU\": \"Тихие воды\",\n",
+                u8"    \"zhCN\": \"止水\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20641,\n",
+                u8"    \"Key\": \"Runeword136\",\n",
+                u8"    \"enUS\": \"Sting\",\n",
+                u8"    \"zhTW\": \"螫刺\",\n",
+                u8"    \"deDE\": \"Stachel\",\n",
+                u8"    \"esES\": \"Aguijón\",\n",
+                u8"    \"frFR\": \"Piqûre\",\n",
+                u8"    \"itIT\": \"Pungiglione\",\n",
+                u8"    \"koKR\": \"쐐기\",\n",
+                u8"    \"plPL\": \"Żądło\",\n",
+                u8"    \"esMX\": \"Aguijón\",\n",
+                u8"    \"jaJP\": \"痛烈\",\n",
+                u8"    \"ptBR\": \"Picada\",\n",
+                u8"    \"ruRU\": \"Жало\",\n",
+                u8"    \"zhCN\": \"钉刺\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20642,\n",
+                u8"    \"Key\": \"Runeword137\",\n",
+                u8"    \"enUS\": \"Stone\",\n",
+                u8"    \"zhTW\": \"石塊\",\n",
+                u8"    \"deDE\": \"Stein\",\n",
+                u8"    \"esES\": \"Roca\",\n",
+                u8"    \"frFR\": \"Pierre\",\n",
+                u8"    \"itIT\": \"Pietra\",\n",
+                u8"    \"koKR\": \"돌\",\n",
+                u8"    \"plPL\": \"Kamień\",\n",
+                u8"    \"esMX\": \"Piedra\",\n",
+                u8"    \"jaJP\": \"石\",\n",
+                u8"    \"ptBR\": \"Pedra\",\n",
+                u8"    \"ruRU\": \"Камень\",\n",
+                u8"    \"zhCN\": \"磐石\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20643,\n",
+                u8"    \"Key\": \"Runeword138\",\n",
+                u8"    \"enUS\": \"Storm\",\n",
+                u8"    \"zhTW\": \"風暴\",\n",
+                u8"    \"deDE\": \"Sturm\",\n",
+                u8"    \"esES\": \"Tormenta\",\n",
+                u8"    \"frFR\": \"Orage\",\n",
+                u8"    \"itIT\": \"Ciclone\",\n",
+                u8"    \"koKR\": \"폭풍\",\n",
+                u8"    \"plPL\": \"Nawałnica\",\n",
+                u8"    \"esMX\": \"Tormenta\",\n",
+                u8"    \"jaJP\": \"嵐\",\n",
+                u8"    \"ptBR\": \"Tempestade\",\n",
+                u8"    \"ruRU\": \"Шторм\",\n",
+                u8"    \"zhCN\": \"风暴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20644,\n",
+                u8"    \"Key\": \"Runeword139\",\n",
+                u8"    \"enUS\": \"Strength\",\n",
+                u8"    \"zhTW\": \"力量\",\n",
+                u8"    \"deDE\": \"Stärke\",\n",
+                u8"    \"esES\": \"Fuerza\",\n",
+                u8"    \"frFR\": \"Force\",\n",
+                u8"    \"itIT\": \"Forza\",\n",
+                u8"    \"koKR\": \"강함\",\n",
+                u8"    \"plPL\": \"Siła\",\n",
+                u8"    \"esMX\": \"Fuerza\",\n",
+                u8"    \"jaJP\": \"力\",\n",
+                u8"    \"ptBR\": \"Força\",\n",
+                u8"    \"ruRU\": \"Сила\",\n",
+                u8"    \"zhCN\": \"力量\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20645,\n",
+                u8"    \"Key\": \"Runeword140\",\n",
+                u8"    \"enUS\": \"Tempest\",\n",
+                u8"    \"zhTW\": \"暴風雨\",\n",
+                u8"    \"deDE\": \"Orkan\",\n",
+                u8"    \"esES\": \"Tempestad\",\n",
+                u8"    \"frFR\": \"Tempête\",\n",
+                u8"    \"itIT\": \"Tempesta\",\n",
+                u8"    \"koKR\": \"비바람\",\n",
+                u8"    \"plPL\": \"Burza\",\n",
+                u8"    \"esMX\": \"Tempestad\",\n",
+                u8"    \"jaJP\": \"波乱\",\n",
+                u8"    \"ptBR\": \"Tormenta\",\n",
+                u8"    \"ruRU\": \"Буря\",\n",
+                u8"    \"zhCN\": \"暴风雨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20646,\n",
+                u8"    \"Key\": \"Runeword141\",\n",
+                u8"    \"enUS\": \"Temptation\",\n",
+                u8"    \"zhTW\": \"誘惑\",\n",
+                u8"    \"deDE\": \"Versuchung\",\n",
+                u8"    \"esES\": \"Tentación\",\n",
+                u8"    \"frFR\": \"Tentation\",\n",
+                u8"    \"itIT\": \"Tentazione\",\n",
+                u8"    \"koKR\": \"유혹\",\n",
+                u8"    \"plPL\": \"Pokusa\",\n",
+                u8"    \"esMX\": \"Tentación\",\n",
+                u8"    \"jaJP\": \"誘惑\",\n",
+                u8"    \"ptBR\": \"Tentação\",\n",
+                u8"    \"ruRU\": \"Искушение\",\n",
+                u8"    \"zhCN\": \"诱惑\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20647,\n",
+                u8"    \"Key\": \"Runeword142\",\n",
+                u8"    \"enUS\": \"Terror\",\n",
+                u8"    \"zhTW\": \"恐佈\",\n",
+                u8"    \"deDE\": \"Terror\",\n",
+                u8"    \"esES\": \"Terror\",\n",
+                u8"    \"frFR\": \"Terreur\",\n",
+                u8"    \"itIT\": \"Orrore\",\n",
+                u8"    \"koKR\": \"공포\",\n",
+                u8"    \"plPL\": \"Groza\",\n",
+                u8"    \"esMX\": \"Terror\",\n",
+                u8"    \"jaJP\": \"恐怖\",\n",
+                u8"    \"ptBR\": \"Terror\",\n",
+                u8"    \"ruRU\": \"Кошмар\",\n",
+                u8"    \"zhCN\": \"恐惧\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20648,\n",
+                u8"    \"Key\": \"Runeword143\",\n",
+                u8"    \"enUS\": \"Thirst\",\n",
+                u8"    \"zhTW\": \"飢渴\",\n",
+                u8"    \"deDE\": \"Durst\",\n",
+                u8"    \"esES\": \"Sed\",\n",
+                u8"    \"frFR\": \"Soif\",\n",
+                u8"    \"itIT\": \"Sete\",\n",
+                u8"    \"koKR\": \"갈증\",\n",
+                u8"    \"plPL\": \"Pragnienie\",\n",
+                u8"    \"esMX\": \"Sed\",\n",
+                u8"    \"jaJP\": \"渇望\",\n",
+                u8"    \"ptBR\": \"Sede\",\n",
+                u8"    \"ruRU\": \"Жажда\",\n",
+                u8"    \"zhCN\": \"渴求\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20649,\n",
+                u8"    \"Key\": \"Runeword144\",\n",
+                u8"    \"enUS\": \"Thought\",\n",
+                u8"    \"zhTW\": \"思維\",\n",
+                u8"    \"deDE\": \"Gedanke\",\n",
+                u8"    \"esES\": \"Pensamiento\",\n",
+                u8"    \"frFR\": \"Stoïque\",\n",
+                u8"    \"itIT\": \"Pensiero\",\n",
+                u8"    \"koKR\": \"사고\",\n",
+                u8"    \"plPL\": \"Myśl\",\n",
+                u8"    \"esMX\": \"Pensamiento\",\n",
+                u8"    \"jaJP\": \"思考\",\n",
+                u8"    \"ptBR\": \"Pensamento\",\n",
+                u8"    \"ruRU\": \"Мысль\",\n",
+                u8"    \"zhCN\": \"思绪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20650,\n",
+                u8"    \"Key\": \"Runeword145\",\n",
+                u8"    \"enUS\": \"Thunder\",\n",
+                u8"    \"zhTW\": \"雷霆\",\n",
+                u8"    \"deDE\": \"Donner\",\n",
+                u8"    \"esES\": \"Trueno\",\n",
+                u8"    \"frFR\": \"Tonnerre\",\n",
+                u8"    \"itIT\": \"Tuono\",\n",
+                u8"    \"koKR\": \"천둥\",\n",
+                u8"    \"plPL\": \"Grom\",\n",
+                u8"    \"esMX\": \"Trueno\",\n",
+                u8"    \"jaJP\": \"稲妻\",\n",
+                u8"    \"ptBR\": \"Trovão\",\n",
+                u8"    \"ruRU\": \"Гром\",\n",
+                u8"    \"zhCN\": \"雷霆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20651,\n",
+                u8"    \"Key\": \"Runeword146\",\n",
+                u8"    \"enUS\": \"Time\",\n",
+                u8"    \"zhTW\": \"時間\",\n",
+                u8"    \"deDE\": \"Zeit\",\n",
+                u8"    \"esES\": \"Tiempo\",\n",
+                u8"    \"frFR\": \"Temps\",\n",
+                u8"    \"itIT\": \"Tempo\",\n",
+                u8"    \"koKR\": \"시간\",\n",
+                u8"    \"plPL\": \"Czas\",\n",
+                u8"    \"esMX\": \"Tiempo\",\n",
+                u8"    \"jaJP\": \"時間\",\n",
+                u8"    \"ptBR\": \"Tempo\",\n",
+                u8"    \"ruRU\": \"Время\",\n",
+                u8"    \"zhCN\": \"时光\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20652,\n",
+                u8"    \"Key\": \"Runeword147\",\n",
+                u8"    \"enUS\": \"Tradition\",\n",
+                u8"    \"zhTW\": \"傳統\",\n",
+                u8"    \"deDE\": \"Tradition\",\n",
+                u8"    \"esES\": \"Tradición\",\n",
+                u8"    \"frFR\": \"Tradition\",\n",
+                u8"    \"itIT\": \"Tradizione\",\n",
+                u8"    \"koKR\": \"전통\",\n",
+                u8"    \"plPL\": \"Tradycja\",\n",
+                u8"    \"esMX\": \"Tradición\",\n",
+                u8"    \"jaJP\": \"伝統\",\n",
+                u8"    \"ptBR\": \"Tradição\",\n",
+                u8"    \"ruRU\": \"Традиция\",\n",
+                u8"    \"zhCN\": \"传统\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20653,\n",
+                u8"    \"Key\": \"Runeword148\",\n",
+                u8"    \"enUS\": \"Treachery\",\n",
+                u8"    \"zhTW\": \"背信\",\n",
+                u8"    \"deDE\": \"Verrat\",\n",
+                u8"    \"esES\": \"Traición\",\n",
+                u8"    \"frFR\": \"Traîtrise\",\n",
+                u8"    \"itIT\": \"Tradimento\",\n",
+                u8"    \"koKR\": \"배신\",\n",
+                u8"    \"plPL\": \"Zdrada\",\n",
+                u8"    \"esMX\": \"Traición\",\n",
+                u8"    \"jaJP\": \"不信\",\n",
+                u8"    \"ptBR\": \"Deslealdade\",\n",
+                u8"    \"ruRU\": \"Вероломство\",\n",
+                u8"    \"zhCN\": \"背叛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20654,\n",
+                u8"    \"Key\": \"Runeword149\",\n",
+                u8"    \"enUS\": \"Trust\",\n",
+                u8"    \"zhTW\": \"信任\",\n",
+                u8"    \"deDE\": \"Vertrauen\",\n",
+                u8"    \"esES\": \"Confianza\",\n",
+                u8"    \"frFR\": \"Confiance\",\n",
+                u8"    \"itIT\": \"Fiducia\",\n",
+                u8"    \"koKR\": \"신임\",\n",
+                u8"    \"plPL\": \"Zaufanie\",\n",
+                u8"    \"esMX\": \"Confianza\",\n",
+                u8"    \"jaJP\": \"信頼\",\n",
+                u8"    \"ptBR\": \"Confiança\",\n",
+                u8"    \"ruRU\": \"Доверие\",\n",
+                u8"    \"zhCN\": \"信任\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20655,\n",
+                u8"    \"Key\": \"Runeword150\",\n",
+                u8"    \"enUS\": \"Truth\",\n",
+                u8"    \"zhTW\": \"真理\",\n",
+                u8"    \"deDE\": \"Wahrheit\",\n",
+                u8"    \"esES\": \"Verdad\",\n",
+                u8"    \"frFR\": \"Vérité\",\n",
+                u8"    \"itIT\": \"Verità\",\n",
+                u8"    \"koKR\": \"진실\",\n",
+                u8"    \"plPL\": \"Prawda\",\n",
+                u8"    \"esMX\": \"Verdad\",\n",
+                u8"    \"jaJP\": \"真実\",\n",
+                u8"    \"ptBR\": \"Verdade\",\n",
+                u8"    \"ruRU\": \"Правда\",\n",
+                u8"    \"zhCN\": \"真理\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20656,\n",
+                u8"    \"Key\": \"Runeword151\",\n",
+                u8"    \"enUS\": \"Unbending Will\",\n",
+                u8"    \"zhTW\": \"不屈意志\",\n",
+                u8"    \"deDE\": \"Unbeugsamer Wille\",\n",
+                u8"    \"esES\": \"Voluntad de hierro\",\n",
+                u8"    \"frFR\": \"Volonté inébranlable\",\n",
+                u8"    \"itIT\": \"Volontà di Ferro\",\n",
+                u8"    \"koKR\": \"불굴의 의지\",\n",
+                u8"    \"plPL\": \"Nieugięta Wola\",\n",
+                u8"    \"esMX\": \"Voluntad inflexible\",\n",
+                u8"    \"jaJP\": \"恒心\",\n",
+                u8"    \"ptBR\": \"Determinação\",\n",
+                u8"    \"ruRU\": \"Непреклонность\",\n",
+                u8"    \"zhCN\": \"不屈之志\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20657,\n",
+                u8"    \"Key\": \"Runeword152\",\n",
+                u8"    \"enUS\": \"Valor\",\n",
+                u8"    \"zhTW\": \"英勇\",\n",
+                u8"    \"deDE\": \"Heldenmut\",\n",
+                u8"    \"esES\": \"Valor\",\n",
+                u8"    \"frFR\": \"Valeur\",\n",
+                u8"    \"itIT\": \"Valore\",\n",
+                u8"    \"koKR\": \"용기\",\n",
+                u8"    \"plPL\": \"Odwaga\",\n",
+                u8"    \"esMX\": \"Valor\",\n",
+                u8"    \"jaJP\": \"勇敢\",\n",
+                u8"    \"ptBR\": \"Bravura\",\n",
+                u8"    \"ruRU\": \"Отвага\",\n",
+                u8"    \"zhCN\": \"勇气\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20658,\n",
+                u8"    \"Key\": \"Runeword153\",\n",
+                u8"    \"enUS\": \"Vengeance\",\n",
+                u8"    \"zhTW\": \"復仇\",\n",
+                u8"    \"deDE\": \"Rache\",\n",
+                u8"    \"esES\": \"Venganza\",\n",
+                u8"    \"frFR\": \"Vengeance\",\n",
+                u8"    \"itIT\": \"Vendetta\",\n",
+                u8"    \"koKR\": \"복수\",\n",
+                u8"    \"plPL\": \"Zemsta\",\n",
+                u8"    \"esMX\": \"Venganza\",\n",
+                u8"    \"jaJP\": \"報復\",\n",
+                u8"    \"ptBR\": \"Vingança\",\n",
+                u8"    \"ruRU\": \"Отмщение\",\n",
+                u8"    \"zhCN\": \"复仇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20659,\n",
+                u8"    \"Key\": \"Runeword154\",\n",
+                u8"    \"enUS\": \"Venom\",\n",
+                u8"    \"zhTW\": \"劇毒\",\n",
+                u8"    \"deDE\": \"Geifer\",\n",
+                u8"    \"esES\": \"Ponzoña\",\n",
+                u8"    \"frFR\": \"Venin\",\n",
+                u8"    \"itIT\": \"Veleno\",\n",
+                u8"    \"koKR\": \"맹독\",\n",
+                u8"    \"plPL\": \"Jad\",\n",
+                u8"    \"esMX\": \"Veneno\",\n",
+                u8"    \"jaJP\": \"毒\",\n",
+                u8"    \"ptBR\": \"Veneno\",\n",
+                u8"    \"ruRU\": \"Яд\",\n",
+                u8"    \"zhCN\": \"毒液\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20660,\n",
+                u8"    \"Key\": \"Runeword155\",\n",
+                u8"    \"enUS\": \"Victory\",\n",
+                u8"    \"zhTW\": \"勝利\",\n",
+                u8"    \"deDE\": \"Sieg\",\n",
+                u8"    \"esES\": \"Victoria\",\n",
+                u8"    \"frFR\": \"Victoire\",\n",
+                u8"    \"itIT\": \"Vittoria\",\n",
+                u8"    \"koKR\": \"승리\",\n",
+                u8"    \"plPL\": \"Zwycięstwo\",\n",
+                u8"    \"esMX\": \"Victoria\",\n",
+                u8"    \"jaJP\": \"勝利\",\n",
+                u8"    \"ptBR\": \"Vitória\",\n",
+                u8"    \"ruRU\": \"Победа\",\n",
+                u8"    \"zhCN\": \"胜利\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20661,\n",
+                u8"    \"Key\": \"Runeword156\",\n",
+                u8"    \"enUS\": \"Voice\",\n",
+                u8"    \"zhTW\": \"聲音\",\n",
+                u8"    \"deDE\": \"Stimme\",\n",
+                u8"    \"esES\": \"Voz\",\n",
+                u8"    \"frFR\": \"Voix\",\n",
+                u8"    \"itIT\": \"Voce\",\n",
+                u8"    \"koKR\": \"목소리\",\n",
+                u8"    \"plPL\": \"Głos\",\n",
+                u8"    \"esMX\": \"Voz\",\n",
+                u8"    \"jaJP\": \"声\",\n",
+                u8"    \"ptBR\": \"Voz\",\n",
+                u8"    \"ruRU\": \"Голос\",\n",
+                u8"    \"zhCN\": \"声音\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20662,\n",
+                u8"    \"Key\": \"Runeword157\",\n",
+                u8"    \"enUS\": \"Void\",\n",
+                u8"    \"zhTW\": \"虛無\",\n",
+                u8"    \"deDE\": \"[ms]leerer[fs]leere[ns]leeres[pl]leere\",\n",
+                u8"    \"esES\": \"Vacío\",\n",
+                u8"    \"frFR\": \"Vide\",\n",
+                u8"    \"itIT\": \"Vuoto\",\n",
+                u8"    \"koKR\": \"공허\",\n",
+                u8"    \"plPL\": \"Pustka\",\n",
+                u8"    \"esMX\": \"Vacío\",\n",
+                u8"    \"jaJP\": \"虚無\",\n",
+                u8"    \"ptBR\": \"Vazio\",\n",
+                u8"    \"ruRU\": \"Бездна\",\n",
+                u8"    \"zhCN\": \"虚空\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20663,\n",
+                u8"    \"Key\": \"Runeword158\",\n",
+                u8"    \"enUS\": \"War\",\n",
+                u8"    \"zhTW\": \"戰爭\",\n",
+                u8"    \"deDE\": \"Krieg\",\n",
+                u8"    \"esES\": \"Guerra\",\n",
+                u8"    \"frFR\": \"Guerre\",\n",
+                u8"    \"itIT\": \"Guerra\",\n",
+                u8"    \"koKR\": \"전쟁\",\n",
+                u8"    \"plPL\": \"Wojna\",\n",
+                u8"    \"esMX\": \"Guerra\",\n",
+                u8"    \"jaJP\": \"戦争\",\n",
+                u8"    \"ptBR\": \"Guerra\",\n",
+                u8"    \"ruRU\": \"Война\",\n",
+                u8"    \"zhCN\": \"战争\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20664,\n",
+                u8"    \"Key\": \"Runeword159\",\n",
+                u8"    \"enUS\": \"Water\",\n",
+                u8"    \"zhTW\": \"清水\",\n",
+                u8"    \"deDE\": \"Wasser\",\n",
+                u8"    \"esES\": \"Agua\",\n",
+                u8"    \"frFR\": \"Eau\",\n",
+                u8"    \"itIT\": \"Acqua\",\n",
+                u8"    \"koKR\": \"물\",\n",
+                u8"    \"plPL\": \"Woda\",\n",
+                u8"    \"esMX\": \"Agua\",\n",
+                u8"    \"jaJP\": \"水\",\n",
+                u8"    \"ptBR\": \"Água\",\n",
+                u8"    \"ruRU\": \"Вода\",\n",
+                u8"    \"zhCN\": \"源水\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20665,\n",
+                u8"    \"Key\": \"Runeword160\",\n",
+                u8"    \"enUS\": \"Wealth\",\n",
+                u8"    \"zhTW\": \"財富\",\n",
+                u8"    \"deDE\": \"Wohlstand\",\n",
+                u8"    \"esES\": \"Riqueza\",\n",
+                u8"    \"frFR\": \"Richesse\",\n",
+                u8"    \"itIT\": \"Ricchezza\",\n",
+                u8"    \"koKR\": \"부\",\n",
+                u8"    \"plPL\": \"Bogactwo\",\n",
+                u8"    \"esMX\": \"Riqueza\",\n",
+                u8"    \"jaJP\": \"富\",\n",
+                u8"    \"ptBR\": \"Riqueza\",\n",
+                u8"    \"ruRU\": \"Изобилие\",\n",
+                u8"    \"zhCN\": \"财富\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20666,\n",
+                u8"    \"Key\": \"Runeword161\",\n",
+                u8"    \"enUS\": \"Whisper\",\n",
+                u8"    \"zhTW\": \"低語\",\n",
+                u8"    \"deDE\": \"Flüstern\",\n",
+                u8"    \"esES\": \"Susurro\",\n",
+                u8"    \"frFR\": \"Murmure\",\n",
+                u8"    \"itIT\": \"Sussurro\",\n",
+                u8"    \"koKR\": \"속삭임\",\n",
+                u8"    \"plPL\": \"Szept\",\n",
+                u8"    \"esMX\": \"Susurro\",\n",
+                u8"    \"jaJP\": \"囁き\",\n",
+                u8"    \"ptBR\": \"Sussurro\",\n",
+                u8"    \"ruRU\": \"Шепот\",\n",
+                u8"    \"zhCN\": \"低语\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20667,\n",
+                u8"    \"Key\": \"Runeword162\",\n",
+                u8"    \"enUS\": \"White\",\n",
+                u8"    \"zhTW\": \"蒼白\",\n",
+                u8"    \"deDE\": \"Weiß\",\n",
+                u8"    \"esES\": \"Blancura\",\n",
+                u8"    \"frFR\": \"Blancheur\",\n",
+                u8"    \"itIT\": \"Bianco\",\n",
+                u8"    \"koKR\": \"순백\",\n",
+                u8"    \"plPL\": \"Biel\",\n",
+                u8"    \"esMX\": \"Blanco\",\n",
+                u8"    \"jaJP\": \"白\",\n",
+                u8"    \"ptBR\": \"Branco\",\n",
+                u8"    \"ruRU\": \"Белизна\",\n",
+                u8"    \"zhCN\": \"白色\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20668,\n",
+                u8"    \"Key\": \"Runeword163\",\n",
+                u8"    \"enUS\": \"Wind\",\n",
+                u8"    \"zhTW\": \"輕風\",\n",
+                u8"    \"deDE\": \"Wind\",\n",
+                u8"    \"esES\": \"Viento\",\n",
+                u8"    \"frFR\": \"Vent\",\n",
+                u8"    \"itIT\": \"Vento\",\n",
+                u8"    \"koKR\": \"바람\",\n",
+                u8"    \"plPL\": \"Wiatr\",\n",
+                u8"    \"esMX\": \"Viento\",\n",
+                u8"    \"jaJP\": \"風\",\n",
+                u8"    \"ptBR\": \"Vento\",\n",
+                u8"    \"ruRU\": \"Ветер\",\n",
+                u8"    \"zhCN\": \"疾风\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20669,\n",
+                u8"    \"Key\": \"Runeword164\",\n",
+                u8"    \"enUS\": \"Wings of Hope\",\n",
+                u8"    \"zhTW\": \"希望之翼\",\n",
+                u8"    \"deDE\": \"Schwingen der Hoffnung\",\n",
+                u8"    \"esES\": \"Alas de esperanza\",\n",
+                u8"    \"frFR\": \"Ailes de l’espoir\",\n",
+                u8"    \"itIT\": \"Ali della Speranza\",\n",
+                u8"    \"koKR\": \"희망의 날개\",\n",
+                u8"    \"plPL\": \"Wiatr Nadziei\",\n",
+                u8"    \"esMX\": \"Alas de esperanza\",\n",
+                u8"    \"jaJP\": \"希望の翼\",\n",
+                u8"    \"ptBR\": \"Asas da Esperança\",\n",
+                u8"    \"ruRU\": \"Крылья надежды\",\n",
+                u8"    \"zhCN\": \"希望之翼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20670,\n",
+                u8"    \"Key\": \"Runeword165\",\n",
+                u8"    \"enUS\": \"Wisdom\",\n",
+                u8"    \"zhTW\": \"智慧\",\n",
+                u8"    \"deDE\": \"Weisheit\",\n",
+                u8"    \"esES\": \"Sabiduría\",\n",
+                u8"    \"frFR\": \"Sagesse\",\n",
+                u8"    \"itIT\": \"Saggezza\",\n",
+                u8"    \"koKR\": \"지혜\",\n",
+                u8"    \"plPL\": \"Mądrość\",\n",
+                u8"    \"esMX\": \"Sabiduría\",\n",
+                u8"    \"jaJP\": \"英知\",\n",
+                u8"    \"ptBR\": \"Sabedoria\",\n",
+                u8"    \"ruRU\": \"Мудрость\",\n",
+                u8"    \"zhCN\": \"智慧\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20671,\n",
+                u8"    \"Key\": \"Runeword166\",\n",
+                u8"    \"enUS\": \"Woe\",\n",
+                u8"    \"zhTW\": \"悲痛\",\n",
+                u8"    \"deDE\": \"Unglück\",\n",
+                u8"    \"esES\": \"Aflicción\",\n",
+                u8"    \"frFR\": \"Malheur\",\n",
+                u8"    \"itIT\": \"Pena\",\n",
+                u8"    \"koKR\": \"재난\",\n",
+                u8"    \"plPL\": \"Nieszczęście\",\n",
+                u8"    \"esMX\": \"Aflicción\",\n",
+                u8"    \"jaJP\": \"苦悩\",\n",
+                u8"    \"ptBR\": \"Angústia\",\n",
+                u8"    \"ruRU\": \"Горе\",\n",
+                u8"    \"zhCN\": \"灾祸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20672,\n",
+                u8"    \"Key\": \"Runeword167\",\n",
+                u8"    \"enUS\": \"Wonder\",\n",
+                u8"    \"zhTW\": \"驚奇\",\n",
+                u8"    \"deDE\": \"Wunder\",\n",
+                u8"    \"esES\": \"Asombro\",\n",
+                u8"    \"frFR\": \"Merveille\",\n",
+                u8"    \"itIT\": \"Meraviglia\",\n",
+                u8"    \"koKR\": \"경이\",\n",
+                u8"    \"plPL\": \"Cud\",\n",
+                u8"    \"esMX\": \"Asombro\",\n",
+                u8"    \"jaJP\": \"驚異\",\n",
+                u8"    \"ptBR\": \"Fascínio\",\n",
+                u8"    \"ruRU\": \"Чудо\",\n",
+                u8"    \"zhCN\": \"奇迹\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20673,\n",
+                u8"    \"Key\": \"Runeword168\",\n",
+                u8"    \"enUS\": \"Wrath\",\n",
+                u8"    \"zhTW\": \"憤怒\",\n",
+                u8"    \"deDE\": \"Wut\",\n",
+                u8"    \"esES\": \"Ira\",\n",
+                u8"    \"frFR\": \"Courroux\",\n",
+                u8"    \"itIT\": \"Ira\",\n",
+                u8"    \"koKR\": \"진노\",\n",
+                u8"    \"plPL\": \"Gniew\",\n",
+                u8"    \"esMX\": \"Ira\",\n",
+                u8"    \"jaJP\": \"激怒\",\n",
+                u8"    \"ptBR\": \"Ira\",\n",
+                u8"    \"ruRU\": \"Гнев\",\n",
+                u8"    \"zhCN\": \"怒火\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20674,\n",
+                u8"    \"Key\": \"Runeword169\",\n",
+                u8"    \"enUS\": \"Youth\",\n",
+                u8"    \"zhTW\": \"年輕\",\n",
+                u8"    \"deDE\": \"Jugend\",\n",
+                u8"    \"esES\": \"Juventud\",\n",
+                u8"    \"frFR\": \"Jeunesse\",\n",
+                u8"    \"itIT\": \"Gioventù\",\n",
+                u8"    \"koKR\": \"젊음\",\n",
+                u8"    \"plPL\": \"Młodość\",\n",
+                u8"    \"esMX\": \"Juventud\",\n",
+                u8"    \"jaJP\": \"若さ\",\n",
+                u8"    \"ptBR\": \"Juventude\",\n",
+                u8"    \"ruRU\": \"Юность\",\n",
+                u8"    \"zhCN\": \"青春\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 20675,\n",
+                u8"    \"Key\": \"Runeword170\",\n",
+                u8"    \"enUS\": \"Zephyr\",\n",
+                u8"    \"zhTW\": \"和風\",\n",
+                u8"    \"deDE\": \"Zephyr\",\n",
+                u8"    \"esES\": \"Céfiro\",\n",
+                u8"    \"frFR\": \"Zéphyr\",\n",
+                u8"    \"itIT\": \"Zefiro\",\n",
+                u8"    \"koKR\": \"서풍\",\n",
+                u8"    \"plPL\": \"Zefir\",\n",
+                u8"    \"esMX\": \"Céfiro\",\n",
+                u8"    \"jaJP\": \"軟風\",\n",
+                u8"    \"ptBR\": \"Zefir\",\n",
+                u8"    \"ruRU\": \"Бриз\",\n",
+                u8"    \"zhCN\": \"和风\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27360,\n",
+                u8"    \"Key\": \"Runeword171\",\n",
+                u8"    \"enUS\": \"Hustle\",\n",
+                u8"    \"zhTW\": \"催促\",\n",
+                u8"    \"deDE\": \"Hetze\",\n",
+                u8"    \"esES\": \"Apremio\",\n",
+                u8"    \"frFR\": \"Tumulte\",\n",
+                u8"    \"itIT\": \"Imbroglio\",\n",
+                u8"    \"koKR\": \"투지\",\n",
+                u8"    \"plPL\": \"Zgiełk\",\n",
+                u8"    \"esMX\": \"Apuro\",\n",
+                u8"    \"jaJP\": \"発奮\",\n",
+                u8"    \"ptBR\": \"Agitação\",\n",
+                u8"    \"ruRU\": \"Переполох\",\n",
+                u8"    \"zhCN\": \"喧嚣\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27361,\n",
+                u8"    \"Key\": \"Runeword172\",\n",
+                u8"    \"enUS\": \"Hustle\",\n",
+                u8"    \"zhTW\": \"催促\",\n",
+                u8"    \"deDE\": \"Hetze\",\n",
+                u8"    \"esES\": \"Apremio\",\n",
+                u8"    \"frFR\": \"Tumulte\",\n",
+                u8"    \"itIT\": \"Imbroglio\",\n",
+                u8"    \"koKR\": \"투지\",\n",
+                u8"    \"plPL\": \"Zgiełk\",\n",
+                u8"    \"esMX\": \"Apuro\",\n",
+                u8"    \"jaJP\": \"発奮\",\n",
+                u8"    \"ptBR\": \"Agitação\",\n",
+                u8"    \"ruRU\": \"Переполох\",\n",
+                u8"    \"zhCN\": \"喧嚣\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27362,\n",
+                u8"    \"Key\": \"Runeword173\",\n",
+                u8"    \"enUS\": \"Mosaic\",\n",
+                u8"    \"zhTW\": \"嵌飾\",\n",
+                u8"    \"deDE\": \"Mosaik\",\n",
+                u8"    \"esES\": \"Mosaico\",\n",
+                u8"    \"frFR\": \"Mosaïque\",\n",
+                u8"    \"itIT\": \"Mosaico\",\n",
+                u8"    \"koKR\": \"모자이크\",\n",
+                u8"    \"plPL\": \"Mozaika\",\n",
+                u8"    \"esMX\": \"Mosaico\",\n",
+                u8"    \"jaJP\": \"坩堝\",\n",
+                u8"    \"ptBR\": \"Mosaico\",\n",
+                u8"    \"ruRU\": \"Мозаика\",\n",
+                u8"    \"zhCN\": \"模糊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27363,\n",
+                u8"    \"Key\": \"Runeword174\",\n",
+                u8"    \"enUS\": \"Metamorphosis\",\n",
+                u8"    \"zhTW\": \"變化\",\n",
+                u8"    \"deDE\": \"Metamorphose\",\n",
+                u8"    \"esES\": \"Metamorfosis\",\n",
+                u8"    \"frFR\": \"Métamorphose\",\n",
+                u8"    \"itIT\": \"Metamorfosi\",\n",
+                u8"    \"koKR\": \"탈태\",\n",
+                u8"    \"plPL\": \"Metamorfoza\",\n",
+                u8"    \"esMX\": \"Metamorfosis\",\n",
+                u8"    \"jaJP\": \"変容\",\n",
+                u8"    \"ptBR\": \"Metamorfose\",\n",
+                u8"    \"ruRU\": \"Метаморфоза\",\n",
+                u8"    \"zhCN\": \"变形\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27364,\n",
+                u8"    \"Key\": \"Runeword175\",\n",
+                u8"    \"enUS\": \"Ground\",\n",
+                u8"    \"zhTW\": \"接地\",\n",
+                u8"    \"deDE\": \"Boden\",\n",
+                u8"    \"esES\": \"Tierra\",\n",
+                u8"    \"frFR\": \"Terre\",\n",
+                u8"    \"itIT\": \"Suolo\",\n",
+                u8"    \"koKR\": \"접지\",\n",
+                u8"    \"plPL\": \"Grunt\",\n",
+                u8"    \"esMX\": \"Suelo\",\n",
+                u8"    \"jaJP\": \"大地\",\n",
+                u8"    \"ptBR\": \"Solo\",\n",
+                u8"    \"ruRU\": \"Земля\",\n",
+                u8"    \"zhCN\": \"地面\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27365,\n",
+                u8"    \"Key\": \"Runeword176\",\n",
+                u8"    \"enUS\": \"Temper\",\n",
+                u8"    \"zhTW\": \"和緩\",\n",
+                u8"    \"deDE\": \"Temperament\",\n",
+                u8"    \"esES\": \"Temperamento\",\n",
+                u8"    \"frFR\": \"Tempérament\",\n",
+                u8"    \"itIT\": \"Tempra\",\n",
+                u8"    \"koKR\": \"담금질\",\n",
+                u8"    \"plPL\": \"Charakter\",\n",
+                u8"    \"esMX\": \"Ira\",\n",
+                u8"    \"jaJP\": \"沈着\",\n",
+                u8"    \"ptBR\": \"Índole\",\n",
+                u8"    \"ruRU\": \"Закалка\",\n",
+                u8"    \"zhCN\": \"淬火\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27366,\n",
+                u8"    \"Key\": \"Runeword177\",\n",
+                u8"    \"enUS\": \"Hearth\",\n",
+                u8"    \"zhTW\": \"火爐\",\n",
+                u8"    \"deDE\": \"Heim\",\n",
+                u8"    \"esES\": \"Hogar\",\n",
+                u8"    \"frFR\": \"Âtre\",\n",
+                u8"    \"itIT\": \"Focolare\",\n",
+                u8"    \"koKR\": \"화로\",\n",
+                u8"    \"plPL\": \"Palenisko\",\n",
+                u8"    \"esMX\": \"Corazón\",\n",
+                u8"    \"jaJP\": \"炉辺\",\n",
+                u8"    \"ptBR\": \"Lar\",\n",
+                u8"    \"ruRU\": \"Очаг\",\n",
+                u8"    \"zhCN\": \"壁炉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27367,\n",
+                u8"    \"Key\": \"Runeword178\",\n",
+                u8"    \"enUS\": \"Cure\",\n",
+                u8"    \"zhTW\": \"治癒\",\n",
+                u8"    \"deDE\": \"Heilung\",\n",
+                u8"    \"esES\": \"Cura\",\n",
+                u8"    \"frFR\": \"Remède\",\n",
+                u8"    \"itIT\": \"Cura\",\n",
+                u8"    \"koKR\": \"치료\",\n",
+                u8"    \"plPL\": \"Remedium\",\n",
+                u8"    \"esMX\": \"Cura\",\n",
+                u8"    \"jaJP\": \"治癒\",\n",
+                u8"    \"ptBR\": \"Cura\",\n",
+                u8"    \"ruRU\": \"Лекарство\",\n",
+                u8"    \"zhCN\": \"解药\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27368,\n",
+                u8"    \"Key\": \"Runeword179\",\n",
+                u8"    \"enUS\": \"Bulwark\",\n",
+                u8"    \"zhTW\": \"壁壘\",\n",
+                u8"    \"deDE\": \"Bollwerk\",\n",
+                u8"    \"esES\": \"Baluarte\",\n",
+                u8"    \"frFR\": \"Rempart\",\n",
+                u8"    \"itIT\": \"Baluardo\",\n",
+                u8"    \"koKR\": \"방벽\",\n",
+                u8"    \"plPL\": \"Szaniec\",\n",
+                u8"    \"esMX\": \"Baluarte\",\n",
+                u8"    \"jaJP\": \"防塁\",\n",
+                u8"    \"ptBR\": \"Bastião\",\n",
+                u8"    \"ruRU\": \"Оплот\",\n",
+                u8"    \"zhCN\": \"壁垒\"\n",
+                u8"  }\n",
+                u8"]\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
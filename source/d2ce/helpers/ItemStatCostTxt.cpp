@@ -18,383 +18,379 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetItemStatCost()
+        EmbeddedText GetItemStatCost()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"Stat\t*ID\tSend Other\tSigned\tSend Bits\tSend Param Bits\tUpdateAnimRate\tSaved\tCSvSigned\tCSvBits\tCSvParam\tfCallback\tfMin\tMinAccr\tEncode\tAdd\tMultiply\tValShift\t1.09-Save Bits\t1.09-Save Add\tSave Bits\tSave Add\tSave Param Bits\tkeepzero\top\top param\top base\top stat1\top stat2\top stat3\tdirect\tmaxstat\tdamagerelated\titemevent1\titemeventfunc1\titemevent2\titemeventfunc2\tdescpriority\tdescfunc\tdescval\tdescstrpos\tdescstrneg\tdescstr2\tdgrp\tdgrpfunc\tdgrpval\tdgrpstrpos\tdgrpstrneg\tdgrpstr2\tstuff\tadvdisplay\t*eol\n";
-                ss << u8"strength\t0\t1\t\t11\t\t\t1\t0\t10\t\t\t1\t1\t\t125\t55\t\t7\t32\t8\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t67\t19\t\tModStr1a\tModStr1a\t\t1\t19\t\tModitem2allattrib\tModitem2allattrib\t\t6\t\t0\n";
-                ss << u8"energy\t1\t\t\t11\t\t\t1\t0\t10\t\t\t1\t1\t\t100\t55\t\t7\t32\t7\t32\t\t\t8\t\t\tmaxmana\t\t\t\t\t\t\t\t\t\t61\t19\t\tModStr1d\tModStr1d\t\t1\t19\t\tModitem2allattrib\tModitem2allattrib\t\t\t\t0\n";
-                ss << u8"dexterity\t2\t1\t\t11\t\t\t1\t0\t10\t\t\t1\t1\t\t125\t55\t\t7\t32\t7\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t65\t19\t\tModStr1b\tModStr1b\t\t1\t19\t\tModitem2allattrib\tModitem2allattrib\t\t\t\t0\n";
-                ss << u8"vitality\t3\t\t\t11\t\t\t1\t0\t10\t\t\t1\t1\t\t100\t55\t\t7\t32\t7\t32\t\t\t9\t\t\tmaxhp\tmaxstamina\t\t\t\t\t\t\t\t\t63\t19\t\tModStr1c\tModStr1c\t\t1\t19\t\tModitem2allattrib\tModitem2allattrib\t\t\t\t0\n";
-                ss << u8"statpts\t4\t\t\t9\t\t\t1\t0\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"newskills\t5\t\t\t9\t\t\t1\t0\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"hitpoints\t6\t\t\t32\t\t\t1\t0\t21\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t1\tmaxhp\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"maxhp\t7\t\t\t32\t\t\t1\t0\t21\t\t1\t1\t1\t\t56\t20\t8\t8\t32\t9\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t59\t19\t\tModStr1u\tModStr1u\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"mana\t8\t\t\t32\t\t\t1\t0\t21\t\t\t\t\t\t\t\t8\t\t\t\t\t\t1\t\t\t\t\t\t\t1\tmaxmana\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"maxmana\t9\t\t\t32\t\t\t1\t0\t21\t\t1\t1\t0\t\t81\t20\t8\t8\t32\t8\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t55\t19\t\tModStr1e\tModStr1e\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"stamina\t10\t\t\t32\t\t\t1\t0\t21\t\t\t\t\t\t\t\t8\t\t\t\t\t\t1\t\t\t\t\t\t\t1\tmaxstamina\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"maxstamina\t11\t\t\t32\t\t\t1\t0\t21\t\t1\t1\t0\t\t75\t20\t8\t8\t32\t8\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t51\t19\t\tModStr5d\tModStr5d\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"level\t12\t\t\t9\t\t\t1\t0\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"experience\t13\t\t\t32\t\t\t1\t0\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"gold\t14\t\t\t32\t\t\t1\t0\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"goldbank\t15\t\t\t32\t\t\t1\t0\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_armor_percent\t16\t\t1\t11\t\t\t\t\t\t\t\t\t\t\t47\t20\t\t9\t0\t9\t0\t\t\t13\t\t\tarmorclass\t\t\t\t\t\t\t\t\t\t74\t19\t\tModstr2v\tModstr2v\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_maxdamage_percent\t17\t\t1\t11\t\t\t\t\t\t\t\t\t\t\t45\t20\t\t9\t0\t9\t0\t\t\t13\t\t\tmaxdamage\tsecondary_maxdamage\titem_throw_maxdamage\t\t\t1\t\t\t\t\t129\t19\t\tModStr2j\tModStr2j\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_mindamage_percent\t18\t\t1\t11\t\t\t\t\t\t\t\t\t\t\t45\t20\t\t9\t0\t9\t0\t\t\t13\t\t\tmindamage\tsecondary_mindamage\titem_throw_mindamage\t\t\t1\t\t\t\t\t130\t19\t\tModStr2k\tModStr2k\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"tohit\t19\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t15\t10\t\t10\t\t10\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t115\t19\t\tModStr1h\tModStr1h\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"toblock\t20\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t89\t204\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t134\t19\t\tModStr3g\tModStr3g\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"mindamage\t21\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t122\t25\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t127\t19\t\tModStr1g\tModStr1g\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"maxdamage\t22\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t94\t16\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t126\t19\t\tModStr1f\tModStr1f\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"secondary_mindamage\t23\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t97\t15\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t124\t19\t\tModStr1g\tModStr1g\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"secondary_maxdamage\t24\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t85\t11\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t123\t19\t\tModStr1f\tModStr1f\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"damagepercent\t25\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t45\t40\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"manarecovery\t26\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"manarecoverybonus\t27\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t52\t19\t\tModStr4g\tModStr4g\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"staminarecoverybonus\t28\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t19\t\tModStr3v\tModStr3v\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"lastexp\t29\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"nextexp\t30\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"armorclass\t31\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t17\t10\t\t10\t10\t11\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t71\t19\t\tModStr1i\tModStr1i\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"armorclass_vs_missile\t32\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t11\t5\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t69\t19\t\tModStr6a\tModStr6a\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"armorclass_vs_hth\t33\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t13\t7\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t70\t19\t\tModStr6b\tModStr6b\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"normal_damage_reduction\t34\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t188\t200\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\t19\t\tModStr2u\tModStr2u\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"magic_damage_reduction\t35\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t397\t340\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t21\t19\t\tModStr2t\tModStr2t\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"damageresist\t36\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t152\t68\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\t29\t\tModStr2uPercent\tModStr2uPercentNegative\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"magicresist\t37\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t164\t68\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t41\t19\t\tModStr1m\tModStr1m\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"maxmagicresist\t38\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1091\t409\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t46\t19\t\tModStr5x\tModStr5x\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"fireresist\t39\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t43\t20\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\t19\t\tModStr1j\tModStr1j\t\t2\t19\t\tstrModAllResistances\tstrModAllResistances\t\t\t\t0\n";
-                ss << u8"maxfireresist\t40\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t584\t256\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42\t19\t\tModStr5u\tModStr5u\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lightresist\t41\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t43\t20\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t38\t19\t\tModStr1l\tModStr1l\t\t2\t19\t\tstrModAllResistances\tstrModAllResistances\t\t\t\t0\n";
-                ss << u8"maxlightresist\t42\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t584\t256\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t43\t19\t\tModStr5w\tModStr5w\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"coldresist\t43\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t43\t20\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\t19\t\tModStr1k\tModStr1k\t\t2\t19\t\tstrModAllResistances\tstrModAllResistances\t\t\t\t0\n";
-                ss << u8"maxcoldresist\t44\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t584\t256\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\t19\t\tModStr5v\tModStr5v\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"poisonresist\t45\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t43\t20\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34\t19\t\tModStr1n\tModStr1n\t\t2\t19\t\tstrModAllResistances\tstrModAllResistances\t\t\t\t0\n";
-                ss << u8"maxpoisonresist\t46\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t526\t256\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t45\t19\t\tModStr5y\tModStr5y\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"damageaura\t47\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"firemindam\t48\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t11\t10\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t102\t19\t\tModStr1p\tModStr1p\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"firemaxdam\t49\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t19\t10\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t101\t19\t\tModStr1o\tModStr1o\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lightmindam\t50\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t12\t10\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t99\t19\t\tModStr1r\tModStr1r\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lightmaxdam\t51\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t17\t10\t\t9\t0\t10\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t98\t19\t\tModStr1q\tModStr1q\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"magicmindam\t52\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t196\t20\t\t6\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t104\t19\t\tstrModMagicDamage\tstrModMagicDamage\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"magicmaxdam\t53\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t183\t20\t\t7\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t103\t19\t\tstrModMagicDamage\tstrModMagicDamage\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"coldmindam\t54\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t451\t512\t\t6\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t96\t19\t\tModStr1t\tModStr1t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"coldmaxdam\t55\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t128\t340\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t95\t19\t\tModStr1s\tModStr1s\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"coldlength\t56\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t77\t4\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"poisonmindam\t57\t\t1\t19\t\t\t\t\t\t\t\t\t\t\t12\t28\t\t9\t0\t10\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t92\t19\t\tModStr4i\tModStr4i\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"poisonmaxdam\t58\t\t1\t19\t\t\t\t\t\t\t\t\t\t\t11\t34\t\t9\t0\t10\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t91\t19\t\tModStr4h\tModStr4h\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"poisonlength\t59\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t0\t4\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lifedrainmindam\t60\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t1044\t341\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t88\t19\t\tModStr2z\tModStr2z\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"lifedrainmaxdam\t61\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"manadrainmindam\t62\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t1179\t341\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t89\t19\t\tModStr2y\tModStr2y\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"manadrainmaxdam\t63\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"stamdrainmindam\t64\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"stamdrainmaxdam\t65\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"stunlength\t66\t\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"velocitypercent\t67\t1\t1\t10\t\t1\t\t\t\t\t\t\t\t\t\t\t\t7\t30\t7\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"attackrate\t68\t1\t1\t10\t\t1\t\t\t\t\t\t\t\t\t\t\t\t7\t30\t7\t30\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"other_animrate\t69\t1\t1\t10\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"quantity\t70\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"value\t71\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t100\t8\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"durability\t72\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t1\tmaxdurability\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"maxdurability\t73\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t9\t4\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"hpregen\t74\t\t\t\t\t\t\t\t\t\t\t\t\t\t451\t410\t\t6\t30\t6\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\t19\t\tModStr2l\tModStr2w\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_maxdurability_percent\t75\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t117\t10\t\t7\t20\t7\t20\t\t\t13\t\t\tmaxdurability\t\t\t\t\t\t\t\t\t\t3\t19\t\tModStr2i\tModStr2i\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_maxhp_percent\t76\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t32093\t204\t\t6\t10\t6\t10\t\t\t11\t\t\tmaxhp\t\t\t\t\t\t\t\t\t\t58\t19\t\tModStr2g\tModStr2g\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_maxmana_percent\t77\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t56452\t204\t\t6\t10\t6\t10\t\t\t11\t\t\tmaxmana\t\t\t\t\t\t\t\t\t\t54\t19\t\tModStr2h\tModStr2h\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_attackertakesdamage\t78\t\t1\t16\t\t\t\t\t\t\t1\t\t\t\t112\t128\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\tattackedinmelee\t6\t\t\t13\t19\t\tModStr1v\tModStr1v\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_goldbonus\t79\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t187\t34\t\t9\t100\t9\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t19\t\tModStr1w\tModStr1w\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_magicbonus\t80\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t577\t102\t\t8\t100\t8\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t19\t\tModStr1x\tModStr1x\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_knockback\t81\t\t1\t8\t\t\t\t\t\t\t1\t\t\t\t105\t0\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t7\tdomissiledamage\t7\t76\t19\t\tModStr1y\tModStr1y\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_timeduration\t82\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_addclassskills\t83\t\t1\t4\t3\t\t\t\t\t\t1\t\t\t\t49523\t1560\t\t3\t0\t3\t0\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t150\t13\t\tModStr3a\tModStr3a\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"unsentparam1\t84\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_addexperience\t85\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t36015\t519\t\t3\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t19\t\tModitem2ExpG\tModitem2ExpG\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_healafterkill\t86\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t30\t101\t\t3\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\tkill\t28\t\t\t16\t19\t\tModitemHPaK\tModitemHPaK\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_reducedprices\t87\t\t\t8\t\t\t\t\t\t\t\t\t\t\t18957\t203\t\t3\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t19\t\tModitemRedVendP\tModitemRedVendP\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_doubleherbduration\t88\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_lightradius\t89\t\t1\t5\t\t\t\t\t\t\t1\t\t\t\t15\t51\t\t4\t4\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t19\t\tModStr3f\tModStr3f\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_lightcolor\t90\t\t1\t24\t\t\t\t\t\t\t1\t\t\t\t155\t0\t\t5\t0\t24\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_req_percent\t91\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t26\t-34\t\t8\t100\t8\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t19\t\tModStr3h\tModStr3h\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_levelreq\t92\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_fasterattackrate\t93\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t1042\t156\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t145\t19\t\tModStr4m\tModStr4m\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_levelreqpct\t94\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t20\t7\t64\t\t\t13\t\t\titem_levelreq\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lastblockframe\t95\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_fastermovevelocity\t96\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t4083\t156\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t148\t19\t\tModStr4s\tModStr4s\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_nonclassskill\t97\t\t1\t15\t9\t\t\t\t\t\t1\t\t\t1\t181\t327\t\t7\t20\t6\t0\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t81\t28\t\tItemModifierNonClassSkill\tItemModifierNonClassSkill\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"state\t98\t1\t\t1\t8\t\t\t\t\t\t1\t\t\t\t415\t64\t\t6\t20\t1\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_fastergethitrate\t99\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t1065\t72\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t139\t19\t\tModStr4p\tModStr4p\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"monster_playercount\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_poison_override_length\t101\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_fasterblockrate\t102\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t1484\t72\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t136\t19\t\tModStr4y\tModStr4y\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"skill_bypass_undead\t103\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_bypass_demons\t104\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_fastercastrate\t105\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t3876\t156\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t142\t19\t\tModStr4v\tModStr4v\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"skill_bypass_beasts\t106\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_singleskill\t107\t\t1\t15\t9\t\t\t\t\t\t1\t\t\t1\t181\t256\t\t14\t0\t3\t0\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t81\t27\t\tItemModifierClassSkill\tItemModifierClassSkill\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_restinpeace\t108\t\t\t1\t\t\t\t\t\t\t1\t\t\t\t1987\t0\t\t14\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t1\tkill\t29\t\t\t81\t19\t\tModitemSMRIP\tModitemSMRIP\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"curse_resistance\t109\t\t\t9\t\t\t\t\t\t\t\t\t\t\t159\t33\t\t14\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_poisonlengthresist\t110\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t27\t10\t\t8\t20\t8\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t19\t\tModStr3r\tModStr3r\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_normaldamage\t111\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t94\t100\t\t7\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t122\t19\t\tModStr5b\tModStr5b\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_howl\t112\t\t1\t8\t\t\t\t\t\t\t1\t\t\t\t55\t10\t\t7\t-1\t7\t-1\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t8\tdomissiledamage\t8\t79\t5\t\tModStr3u\tModStr3u\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_stupidity\t113\t\t1\t8\t\t\t\t\t\t\t1\t\t\t\t332\t1024\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t9\tdomissiledamage\t9\t80\t12\t2\tModStr6d\tModStr6d\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_damagetomana\t114\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t43\t20\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t13\tdamagedbymissile\t13\t11\t19\t\tModStr3w\tModStr3w\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_ignoretargetac\t115\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t1088\t1024\t\t1\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t119\t19\t\tModStr3y\tModStr3y\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_fractionaltargetac\t116\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t67\t20\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t118\t19\t\tModStr5o\tModStr5o\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_preventheal\t117\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t48\t50\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t81\t19\t\tModStr4a\tModStr4a\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_halffreezeduration\t118\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t5096\t988\t\t1\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t19\t19\t\tModStr4b\tModStr4b\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_tohit_percent\t119\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t981\t40\t\t9\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t117\t19\t\tModStr4c\tModStr4c\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_damagetargetac\t120\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t24\t-20\t\t7\t128\t7\t128\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t75\t19\t\tModStr4d\tModStr4d\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_demondamage_percent\t121\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t19\t12\t\t9\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t112\t19\t\tModStr4e\tModStr4e\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_undeaddamage_percent\t122\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t13\t12\t\t9\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t108\t19\t\tModStr4f\tModStr4f\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_demon_tohit\t123\t\t1\t13\t\t\t\t\t\t\t\t\t\t\t15\t7\t\t10\t128\t10\t128\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t110\t19\t\tModStr4j\tModStr4j\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_undead_tohit\t124\t\t1\t13\t\t\t\t\t\t\t\t\t\t\t11\t7\t\t10\t128\t10\t128\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t106\t19\t\tModStr4k\tModStr4k\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_throwable\t125\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t82\t1024\t\t1\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t19\t\tModStr5a\tModStr5a\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_elemskill\t126\t\t1\t3\t3\t\t\t\t\t\t1\t\t\t\t76\t1024\t\t4\t0\t3\t0\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t157\t19\t\tModStr3i\tModStr3i\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_allskills\t127\t\t1\t8\t\t\t\t\t\t\t1\t\t\t\t15123\t4096\t\t3\t0\t3\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t158\t19\t\tModStr3k\tModStr3k\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_attackertakeslightdamage\t128\t\t1\t6\t\t\t\t\t\t\t1\t\t\t\t4\t102\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t10\t\t\t14\t19\t\tModStr3j\tModStr3j\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"ironmaiden_level\t129\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lifetap_level\t130\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"thorns_percent\t131\t\t\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bonearmor\t132\t\t1\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bonearmormax\t133\t\t1\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_freeze\t134\t\t1\t5\t\t\t\t\t\t\t1\t\t\t\t666\t12\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t14\tdomissiledamage\t14\t78\t12\t2\tModStr3l\tModStr3l\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_openwounds\t135\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t23\t10\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t15\tdomissiledamage\t15\t83\t19\t\tModStr3m\tModStr3m\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_crushingblow\t136\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t98\t40\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t16\tdomissiledamage\t16\t87\t19\t\tModStr5c\tModStr5c\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_kickdamage\t137\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t77\t51\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t121\t19\t\tModStr5e\tModStr5e\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_manaafterkill\t138\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t17\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\tkill\t17\t\t\t16\t19\t\tModStr5f\tModStr5f\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_healafterdemonkill\t139\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t18\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\tkill\t18\t\t\t15\t19\t\tModStr6c\tModStr6c\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_extrablood\t140\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t15\t10\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_deadlystrike\t141\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t31\t25\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t85\t19\t\tModStr5q\tModStr5q\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorbfire_percent\t142\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t5486\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t19\t\tModStr5g\tModStr5g\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorbfire\t143\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1739\t204\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t27\t19\t\tModStr5h\tModStr5h\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorblight_percent\t144\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t5486\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t19\t\tModStr5i\tModStr5i\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorblight\t145\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1739\t204\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t29\t19\t\tModStr5j\tModStr5j\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorbmagic_percent\t146\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t5486\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t26\t19\t\tModStr5k\tModStr5k\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorbmagic\t147\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1739\t204\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t33\t19\t\tModStr5l\tModStr5l\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorbcold_percent\t148\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t5486\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t19\t\tModStr5m\tModStr5m\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorbcold\t149\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1739\t204\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\t19\t\tModStr5n\tModStr5n\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_slow\t150\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t101\t40\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t19\tdomissiledamage\t19\t77\t19\t\tModStr5r\tModStr5r\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_aura\t151\t\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t7\t0\t5\t0\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t159\t16\t0\tModitemAura\tModitemAura\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_indesctructible\t152\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t160\t19\t\tModStre9s\tModStre9s\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_cannotbefrozen\t153\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t15011\t2048\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\t19\t\tModStr5z\tModStr5z\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_staminadrainpct\t154\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t102\t20\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t49\t19\t\tModStr6e\tModStr6e\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_reanimate\t155\t\t\t7\t10\t\t\t\t\t\t1\t\t\t\t\t\t\t7\t0\t7\t0\t10\t\t\t\t\t\t\t\t\t\t1\tkill\t31\t\t\t17\t23\t\tModitemreanimas\tModitemreanimas\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_pierce\t156\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1924\t2048\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t132\t19\t\tModStr6g\tModStr6g\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_magicarrow\t157\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t511\t1024\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t131\t19\t\tModStr6h\tModStr6h\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_explosivearrow\t158\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t492\t1536\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t133\t19\t\tModStr6i\tModStr6i\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_throw_mindamage\t159\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t76\t128\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_throw_maxdamage\t160\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t88\t128\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_handofathena\t161\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_staminapercent\t162\t\t1\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\tmaxstamina\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_passive_staminapercent\t163\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\tmaxstamina\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_concentration\t164\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_enchant\t165\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_pierce\t166\t\t1\t12\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_conviction\t167\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_chillingarmor\t168\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_frenzy\t169\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_decrepify\t170\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_armor_percent\t171\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"alignment\t172\t1\t\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"target0\t173\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"target1\t174\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"goldlost\t175\t\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"conversion_level\t176\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"conversion_maxhp\t177\t\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"unit_dooverlay\t178\t\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"attack_vs_montype\t179\t\t\t9\t10\t\t\t\t\t\t\t\t\t\t19\t14\t\t3\t0\t9\t\t10\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t108\t22\t\tModitemAttratvsM\tModitemAttratvsM\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"damage_vs_montype\t180\t\t\t9\t10\t\t\t\t\t\t\t\t\t\t27\t17\t\t3\t0\t9\t\t10\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t106\t22\t\tModitemdamvsm\tModitemdamvsm\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fade\t181\t1\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t0\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"armor_override_percent\t182\t1\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lasthitreactframe\t183\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"create_season\t184\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bonus_mindamage\t185\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bonus_maxdamage\t186\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_pierce_cold_immunity\t187\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonColdSunder\tModItemMonColdSunder\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_addskill_tab\t188\t\t1\t3\t6\t\t\t\t\t\t1\t\t\t\t11042\t768\t\t10\t0\t3\t0\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t151\t14\t\tStrSklTabItem1\tStrSklTabItem1\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_pierce_fire_immunity\t189\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonFireSunder\tModItemMonFireSunder\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_pierce_light_immunity\t190\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonLightSunder\tModItemMonLightSunder\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_pierce_poison_immunity\t191\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonPoisonSunder\tModItemMonPoisonSunder\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_pierce_damage_immunity\t192\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonPhysicalSunder\tModItemMonPhysicalSunder\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_pierce_magic_immunity\t193\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonMagicSunder\tModItemMonMagicSunder\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_numsockets\t194\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t38\t170\t\t4\t0\t4\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_skillonattack\t195\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t190\t256\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t1\tdomeleeattack\t20\tdomissileattack\t20\t160\t15\t\tItemExpansiveChancX\tItemExpansiveChancX\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_skillonkill\t196\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t85\t19\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t1\tkill\t20\t\t\t160\t15\t\tModitemskonKill\tModitemskonKill\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_skillondeath\t197\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t11\t9\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t\tkilled\t30\t\t\t160\t15\t\tModitemskondeath\tModitemskondeath\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_skillonhit\t198\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t190\t256\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t20\tdomissiledamage\t20\t160\t15\t\tItemExpansiveChanc1\tItemExpansiveChanc1\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_skillonlevelup\t199\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t7\t6\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t\tlevelup\t30\t\t\t160\t15\t\tModitemskonLevel\tModitemskonLevel\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_charge_noconsume\t200\t\t\t7\t\t\t\t\t\t\t\t\t\t\t106\t256\t\t\t\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t159\t19\t\tModStr6k\tModStr6k\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_skillongethit\t201\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t190\t256\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t21\tdamagedbymissile\t21\t160\t15\t\tItemExpansiveChanc2\tItemExpansiveChanc2\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"modifierlist_castid\t202\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"unused203\t203\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t21\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_charged_skill\t204\t\t1\t30\t\t\t\t\t\t\t1\t\t\t3\t401\t256\t\t30\t0\t16\t0\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t24\t\tModStre10d\tModStre10d\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_noconsume\t205\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t106\t256\t\t\t\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t4\t19\t\tModStr6j\tModStr6j\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"passive_mastery_noconsume\t206\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mastery_replenish_oncrit\t206\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"unused208\t208\t\t1\t30\t\t\t\t\t\t\t\t\t\t3\t401\t256\t\t30\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"unused209\t209\t\t1\t30\t\t\t\t\t\t\t\t\t\t3\t401\t256\t\t30\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"unused210\t210\t\t1\t30\t\t\t\t\t\t\t\t\t\t3\t401\t256\t\t30\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"unused211\t211\t\t1\t30\t\t\t\t\t\t\t\t\t\t3\t401\t256\t\t30\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mastery_gethit_rate\t213\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mastery_attack_speed\t213\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_armor_perlevel\t214\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t43\t42\t\t6\t0\t6\t0\t\t\t4\t3\tlevel\tarmorclass\t\t\t\t\t\t\t\t\t\t72\t19\t\tModStr1i\tModStr1i\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_armorpercent_perlevel\t215\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t87\t100\t\t6\t0\t6\t0\t\t\t5\t3\tlevel\tarmorclass\t\t\t\t\t\t\t\t\t\t73\t19\t\tModstr2v\tModstr2v\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_hp_perlevel\t216\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t92\t64\t8\t6\t0\t6\t0\t\t\t2\t3\tlevel\tmaxhp\t\t\t\t\t\t\t\t\t\t57\t19\t\tModStr1u\tModStr1u\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_mana_perlevel\t217\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t90\t128\t8\t6\t0\t6\t0\t\t\t2\t3\tlevel\tmaxmana\t\t\t\t\t\t\t\t\t\t53\t19\t\tModStr1e\tModStr1e\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_maxdamage_perlevel\t218\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t54\t204\t\t6\t0\t6\t0\t\t\t4\t3\tlevel\tmaxdamage\tsecondary_maxdamage\titem_throw_maxdamage\t\t\t1\t\t\t\t\t125\t19\t\tModStr1f\tModStr1f\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_maxdamage_percent_perlevel\t219\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t86\t100\t\t6\t0\t6\t0\t\t\t5\t3\tlevel\tmaxdamage\tsecondary_maxdamage\titem_throw_maxdamage\t\t\t1\t\t\t\t\t128\t19\t\tModStr2j\tModStr2j\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_strength_perlevel\t220\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t132\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tstrength\t\t\t\t\t\t\t\t\t\t66\t19\t\tModStr1a\tModStr1a\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_dexterity_perlevel\t221\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t132\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tdexterity\t\t\t\t\t\t\t\t\t\t64\t19\t\tModStr1b\tModStr1b\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_energy_perlevel\t222\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t105\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tenergy\t\t\t\t\t\t\t\t\t\t60\t19\t\tModStr1d\tModStr1d\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_vitality_perlevel\t223\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t105\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tvitality\t\t\t\t\t\t\t\t\t\t62\t19\t\tModStr1c\tModStr1c\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_tohit_perlevel\t224\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t53\t20\t\t6\t0\t6\t0\t\t\t2\t1\tlevel\ttohit\t\t\t\t\t1\t\t\t\t\t114\t19\t\tModStr1h\tModStr1h\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_tohitpercent_perlevel\t225\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t10\t256\t\t6\t0\t6\t0\t\t\t2\t1\tlevel\titem_tohit_percent\t\t\t\t\t1\t\t\t\t\t116\t19\t\tModStr4c\tModStr4c\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_cold_damagemax_perlevel\t226\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t1058\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tcoldmaxdam\t\t\t\t\t1\t\t\t\t\t94\t19\t\tModStr1s\tModStr1s\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_fire_damagemax_perlevel\t227\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t49\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tfiremaxdam\t\t\t\t\t1\t\t\t\t\t100\t19\t\tModStr1o\tModStr1o\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_ltng_damagemax_perlevel\t228\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t49\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tlightmaxdam\t\t\t\t\t1\t\t\t\t\t97\t19\t\tModStr1q\tModStr1q\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_pois_damagemax_perlevel\t229\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t49\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tpoisonmaxdam\t\t\t\t\t1\t\t\t\t\t90\t19\t\tModStr4h\tModStr4h\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_resist_cold_perlevel\t230\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t101\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tcoldresist\t\t\t\t\t\t\t\t\t\t39\t19\t\tModStr1k\tModStr1k\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_resist_fire_perlevel\t231\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t101\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tfireresist\t\t\t\t\t\t\t\t\t\t35\t19\t\tModStr1j\tModStr1j\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_resist_ltng_perlevel\t232\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t101\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tlightresist\t\t\t\t\t\t\t\t\t\t37\t19\t\tModStr1l\tModStr1l\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_resist_pois_perlevel\t233\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t101\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tpoisonresist\t\t\t\t\t\t\t\t\t\t33\t19\t\tModStr1n\tModStr1n\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_absorb_cold_perlevel\t234\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t207\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_absorbcold\t\t\t\t\t\t\t\t\t\t32\t19\t\tModStre9p\tModStre9p\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorb_fire_perlevel\t235\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t207\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_absorbfire\t\t\t\t\t\t\t\t\t\t28\t19\t\tModStre9o\tModStre9o\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorb_ltng_perlevel\t236\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t207\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_absorblight\t\t\t\t\t\t\t\t\t\t30\t19\t\tModStre9q\tModStre9q\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorb_pois_perlevel\t237\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t207\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_absorbmagic\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_thorns_perlevel\t238\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t55\t256\t\t6\t0\t5\t0\t\t\t2\t3\tlevel\titem_attackertakesdamage\t\t\t\t\t\t\t\t\t\t12\t19\t\tModStr1v\tModStr1v\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_find_gold_perlevel\t239\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t42\t256\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_goldbonus\t\t\t\t\t\t\t\t\t\t9\t19\t\tModStr1w\tModStr1w\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_find_magic_perlevel\t240\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t814\t1024\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_magicbonus\t\t\t\t\t\t\t\t\t\t7\t19\t\tModStr1x\tModStr1x\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_regenstamina_perlevel\t241\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t79\t256\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tstaminarecoverybonus\t\t\t\t\t\t\t\t\t\t47\t19\t\tModStr3v\tModStr3v\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_stamina_perlevel\t242\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t104\t64\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tmaxstamina\t\t\t\t\t\t\t\t\t\t50\t19\t\tModStr5d\tModStr5d\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_damage_demon_perlevel\t243\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t56\t10\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_demondamage_percent\t\t\t\t\t1\t\t\t\t\t111\t19\t\tModStr4e\tModStr4e\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_damage_undead_perlevel\t244\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t91\t10\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_undeaddamage_percent\t\t\t\t\t1\t\t\t\t\t107\t19\t\tModStr4f\tModStr4f\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_tohit_demon_perlevel\t245\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t55\t10\t\t6\t0\t6\t0\t\t\t2\t1\tlevel\titem_demon_tohit\t\t\t\t\t1\t\t\t\t\t109\t19\t\tModStr4j\tModStr4j\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_tohit_undead_perlevel\t246\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t12\t10\t\t6\t0\t6\t0\t\t\t2\t1\tlevel\titem_undead_tohit\t\t\t\t\t1\t\t\t\t\t105\t19\t\tModStr4k\tModStr4k\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_crushingblow_perlevel\t247\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t213\t1024\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_crushingblow\t\t\t\t\t1\t\t\t\t\t86\t19\t\tModStr5c\tModStr5c\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_openwounds_perlevel\t248\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t181\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_openwounds\t\t\t\t\t1\t\t\t\t\t82\t19\t\tModStr3m\tModStr3m\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_kick_damage_perlevel\t249\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t104\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_kickdamage\t\t\t\t\t1\t\t\t\t\t120\t19\t\tModStr5e\tModStr5e\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_deadlystrike_perlevel\t250\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t118\t512\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_deadlystrike\t\t\t\t\t1\t\t\t\t\t84\t19\t\tModStr5q\tModStr5q\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_find_gems_perlevel\t251\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_replenish_durability\t252\t\t1\t5\t\t\t\t\t\t\t\t\t\t\t106\t256\t\t5\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t11\t\tModStre9t\tModStre9t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_replenish_quantity\t253\t\t1\t5\t\t\t\t\t\t\t\t\t\t\t106\t256\t\t5\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t19\t\tModStre9v\tModStre9v\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_extra_stack\t254\t\t1\t\t\t\t\t\t\t\t\t\t\t\t99\t10\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t19\t\tModStre9i\tModStre9i\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_find_item\t255\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_slash_damage\t256\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_slash_damage_percent\t257\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_crush_damage\t258\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_crush_damage_percent\t259\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_thrust_damage\t260\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_thrust_damage_percent\t261\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_absorb_slash\t262\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_absorb_crush\t263\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_absorb_thrust\t264\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_absorb_slash_percent\t265\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_absorb_crush_percent\t266\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_absorb_thrust_percent\t267\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_armor_bytime\t268\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tarmorclass\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1i\tModStr1i\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_armorpercent_bytime\t269\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t7\t\t\tarmorclass\t\t\t\t\t\t\t\t\t\t180\t18\t\tModstr2v\tModstr2v\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_hp_bytime\t270\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tmaxhp\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1u\tModStr1u\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_mana_bytime\t271\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tmaxmana\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1e\tModStr1e\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_maxdamage_bytime\t272\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tmaxdamage\tsecondary_maxdamage\titem_throw_maxdamage\t\t\t1\t\t\t\t\t180\t17\t\tModStr1f\tModStr1f\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_maxdamage_percent_bytime\t273\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t7\t\t\tmaxdamage\tsecondary_mindamage\titem_throw_mindamage\t\t\t1\t\t\t\t\t180\t18\t\tModStr2j\tModStr2j\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_strength_bytime\t274\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tstrength\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1a\tModStr1a\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_dexterity_bytime\t275\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tdexterity\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1b\tModStr1b\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_energy_bytime\t276\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tenergy\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1d\tModStr1d\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_vitality_bytime\t277\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tvitality\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1c\tModStr1c\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_tohit_bytime\t278\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\ttohit\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr1h\tModStr1h\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_tohitpercent_bytime\t279\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_tohit_percent\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr4c\tModStr4c\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_cold_damagemax_bytime\t280\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tcoldmaxdam\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr1s\tModStr1s\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_fire_damagemax_bytime\t281\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tfiremaxdam\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr1o\tModStr1o\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_ltng_damagemax_bytime\t282\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tlightmaxdam\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr1q\tModStr1q\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_pois_damagemax_bytime\t283\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tpoisonmaxdam\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr4h\tModStr4h\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_resist_cold_bytime\t284\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tcoldresist\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1k\tModStr1k\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_resist_fire_bytime\t285\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tfireresist\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1j\tModStr1j\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_resist_ltng_bytime\t286\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tlightresist\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1l\tModStr1l\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_resist_pois_bytime\t287\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tpoisonresist\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1n\tModStr1n\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_absorb_cold_bytime\t288\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_absorbcold\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStre9p\tModStre9p\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorb_fire_bytime\t289\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_absorbfire\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStre9o\tModStre9o\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorb_ltng_bytime\t290\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_absorblight\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStre9q\tModStre9q\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_absorb_pois_bytime\t291\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_absorbmagic\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"item_find_gold_bytime\t292\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_goldbonus\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1w\tModStr1w\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_find_magic_bytime\t293\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_magicbonus\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1x\tModStr1x\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_regenstamina_bytime\t294\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tstaminarecoverybonus\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr3v\tModStr3v\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_stamina_bytime\t295\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tmaxstamina\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr5d\tModStr5d\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_damage_demon_bytime\t296\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_demondamage_percent\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr4e\tModStr4e\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_damage_undead_bytime\t297\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_undeaddamage_percent\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr4f\tModStr4f\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_tohit_demon_bytime\t298\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_demon_tohit\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr4j\tModStr4j\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_tohit_undead_bytime\t299\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_undead_tohit\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr4k\tModStr4k\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_crushingblow_bytime\t300\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_crushingblow\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr5c\tModStr5c\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_openwounds_bytime\t301\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_openwounds\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr3m\tModStr3m\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_kick_damage_bytime\t302\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_kickdamage\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr5e\tModStr5e\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_deadlystrike_bytime\t303\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_deadlystrike\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr5q\tModStr5q\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_find_gems_bytime\t304\t\t1\t\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_pierce_cold\t305\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t8\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenrescoldsk\tModitemenrescoldsk\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_pierce_fire\t306\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1240\t497\t\t\t\t8\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenresfiresk\tModitemenresfiresk\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_pierce_ltng\t307\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1187\t481\t\t\t\t8\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenresltngsk\tModitemenresltngsk\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_pierce_pois\t308\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1322\t506\t\t\t\t8\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenrespoissk\tModitemenrespoissk\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_damage_vs_monster\t309\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_damage_percent_vs_monster\t310\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_tohit_vs_monster\t311\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_tohit_percent_vs_monster\t312\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_ac_vs_monster\t313\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_ac_percent_vs_monster\t314\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"firelength\t315\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"burningmin\t316\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"burningmax\t317\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"progressive_damage\t318\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"progressive_steal\t319\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"progressive_other\t320\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"progressive_fire\t321\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"progressive_cold\t322\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"progressive_lightning\t323\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"item_extra_charges\t324\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"progressive_tohit\t325\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"poison_count\t326\t\t1\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"damage_framerate\t327\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"pierce_idx\t328\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_fire_mastery\t329\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t1117\t415\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemdamFiresk\tModitemdamFiresk\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"passive_ltng_mastery\t330\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t1054\t408\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemdamLtngsk\tModitemdamLtngsk\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"passive_cold_mastery\t331\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t1295\t379\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemdamColdsk\tModitemdamColdsk\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"passive_pois_mastery\t332\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t978\t394\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemdamPoissk\tModitemdamPoissk\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"passive_fire_pierce\t333\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t2578\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenresfiresk\tModitemenresfiresk\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"passive_ltng_pierce\t334\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t2493\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenresltngsk\tModitemenresltngsk\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"passive_cold_pierce\t335\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t1984\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenrescoldsk\tModitemenrescoldsk\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"passive_pois_pierce\t336\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t2345\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenrespoissk\tModitemenrespoissk\t\t\t\t\t\t\t\t\t2\t0\n";
-                ss << u8"passive_critical_strike\t337\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_dodge\t338\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_avoid\t339\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_evade\t340\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_warmth\t341\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mastery_melee_th\t342\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mastery_melee_dmg\t343\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mastery_melee_crit\t344\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mastery_throw_th\t345\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mastery_throw_dmg\t346\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mastery_throw_crit\t347\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_weaponblock\t348\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_summon_resist\t349\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"modifierlist_skill\t350\t\t\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"modifierlist_level\t351\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"last_sent_hp_pct\t352\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"source_unit_type\t353\t\t\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"source_unit_id\t354\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"shortparam1\t355\t\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"questitemdifficulty\t356\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mag_mastery\t357\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t1211\t431\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"passive_mag_pierce\t358\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t2812\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_cooldown\t359\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skill_missile_damage_scale\t360\t\t\t32\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"Stat\t*ID\tSend Other\tSigned\tSend Bits\tSend Param Bits\tUpdateAnimRate\tSaved\tCSvSigned\tCSvBits\tCSvParam\tfCallback\tfMin\tMinAccr\tEncode\tAdd\tMultiply\tValShift\t1.09-Save Bits\t1.09-Save Add\tSave Bits\tSave Add\tSave Param Bits\tkeepzero\top\top param\top base\top stat1\top stat2\top stat3\tdirect\tmaxstat\tdamagerelated\titemevent1\titemeventfunc1\titemevent2\titemeventfunc2\tdescpriority\tdescfunc\tdescval\tdescstrpos\tdescstrneg\tdescstr2\tdgrp\tdgrpfunc\tdgrpval\tdgrpstrpos\tdgrpstrneg\tdgrpstr2\tstuff\tadvdisplay\t*eol\n",
+                u8"strength\t0\t1\t\t11\t\t\t1\t0\t10\t\t\t1\t1\t\t125\t55\t\t7\t32\t8\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t67\t19\t\tModStr1a\tModStr1a\t\t1\t19\t\tModitem2allattrib\tModitem2allattrib\t\t6\t\t0\n",
+                u8"energy\t1\t\t\t11\t\t\t1\t0\t10\t\t\t1\t1\t\t100\t55\t\t7\t32\t7\t32\t\t\t8\t\t\tmaxmana\t\t\t\t\t\t\t\t\t\t61\t19\t\tModStr1d\tModStr1d\t\t1\t19\t\tModitem2allattrib\tModitem2allattrib\t\t\t\t0\n",
+                u8"dexterity\t2\t1\t\t11\t\t\t1\t0\t10\t\t\t1\t1\t\t125\t55\t\t7\t32\t7\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t65\t19\t\tModStr1b\tModStr1b\t\t1\t19\t\tModitem2allattrib\tModitem2allattrib\t\t\t\t0\n",
+                u8"vitality\t3\t\t\t11\t\t\t1\t0\t10\t\t\t1\t1\t\t100\t55\t\t7\t32\t7\t32\t\t\t9\t\t\tmaxhp\tmaxstamina\t\t\t\t\t\t\t\t\t63\t19\t\tModStr1c\tModStr1c\t\t1\t19\t\tModitem2allattrib\tModitem2allattrib\t\t\t\t0\n",
+                u8"statpts\t4\t\t\t9\t\t\t1\t0\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"newskills\t5\t\t\t9\t\t\t1\t0\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"hitpoints\t6\t\t\t32\t\t\t1\t0\t21\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t1\tmaxhp\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"maxhp\t7\t\t\t32\t\t\t1\t0\t21\t\t1\t1\t1\t\t56\t20\t8\t8\t32\t9\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t59\t19\t\tModStr1u\tModStr1u\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"mana\t8\t\t\t32\t\t\t1\t0\t21\t\t\t\t\t\t\t\t8\t\t\t\t\t\t1\t\t\t\t\t\t\t1\tmaxmana\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"maxmana\t9\t\t\t32\t\t\t1\t0\t21\t\t1\t1\t0\t\t81\t20\t8\t8\t32\t8\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t55\t19\t\tModStr1e\tModStr1e\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"stamina\t10\t\t\t32\t\t\t1\t0\t21\t\t\t\t\t\t\t\t8\t\t\t\t\t\t1\t\t\t\t\t\t\t1\tmaxstamina\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"maxstamina\t11\t\t\t32\t\t\t1\t0\t21\t\t1\t1\t0\t\t75\t20\t8\t8\t32\t8\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t51\t19\t\tModStr5d\tModStr5d\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"level\t12\t\t\t9\t\t\t1\t0\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"experience\t13\t\t\t32\t\t\t1\t0\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"gold\t14\t\t\t32\t\t\t1\t0\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"goldbank\t15\t\t\t32\t\t\t1\t0\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_armor_percent\t16\t\t1\t11\t\t\t\t\t\t\t\t\t\t\t47\t20\t\t9\t0\t9\t0\t\t\t13\t\t\tarmorclass\t\t\t\t\t\t\t\t\t\t74\t19\t\tModstr2v\tModstr2v\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_maxdamage_percent\t17\t\t1\t11\t\t\t\t\t\t\t\t\t\t\t45\t20\t\t9\t0\t9\t0\t\t\t13\t\t\tmaxdamage\tsecondary_maxdamage\titem_throw_maxdamage\t\t\t1\t\t\t\t\t129\t19\t\tModStr2j\tModStr2j\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_mindamage_percent\t18\t\t1\t11\t\t\t\t\t\t\t\t\t\t\t45\t20\t\t9\t0\t9\t0\t\t\t13\t\t\tmindamage\tsecondary_mindamage\titem_throw_mindamage\t\t\t1\t\t\t\t\t130\t19\t\tModStr2k\tModStr2k\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"tohit\t19\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t15\t10\t\t10\t\t10\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t115\t19\t\tModStr1h\tModStr1h\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"toblock\t20\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t89\t204\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t134\t19\t\tModStr3g\tModStr3g\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"mindamage\t21\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t122\t25\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t127\t19\t\tModStr1g\tModStr1g\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"maxdamage\t22\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t94\t16\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t126\t19\t\tModStr1f\tModStr1f\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"secondary_mindamage\t23\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t97\t15\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t124\t19\t\tModStr1g\tModStr1g\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"secondary_maxdamage\t24\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t85\t11\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t123\t19\t\tModStr1f\tModStr1f\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"damagepercent\t25\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t45\t40\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"manarecovery\t26\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"manarecoverybonus\t27\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t52\t19\t\tModStr4g\tModStr4g\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"staminarecoverybonus\t28\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t19\t\tModStr3v\tModStr3v\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"lastexp\t29\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"nextexp\t30\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"armorclass\t31\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t17\t10\t\t10\t10\t11\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t71\t19\t\tModStr1i\tModStr1i\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"armorclass_vs_missile\t32\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t11\t5\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t69\t19\t\tModStr6a\tModStr6a\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"armorclass_vs_hth\t33\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t13\t7\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t70\t19\t\tModStr6b\tModStr6b\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"normal_damage_reduction\t34\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t188\t200\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\t19\t\tModStr2u\tModStr2u\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"magic_damage_reduction\t35\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t397\t340\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t21\t19\t\tModStr2t\tModStr2t\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"damageresist\t36\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t152\t68\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\t29\t\tModStr2uPercent\tModStr2uPercentNegative\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"magicresist\t37\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t164\t68\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t41\t19\t\tModStr1m\tModStr1m\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"maxmagicresist\t38\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1091\t409\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t46\t19\t\tModStr5x\tModStr5x\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"fireresist\t39\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t43\t20\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\t19\t\tModStr1j\tModStr1j\t\t2\t19\t\tstrModAllResistances\tstrModAllResistances\t\t\t\t0\n",
+                u8"maxfireresist\t40\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t584\t256\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42\t19\t\tModStr5u\tModStr5u\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lightresist\t41\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t43\t20\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t38\t19\t\tModStr1l\tModStr1l\t\t2\t19\t\tstrModAllResistances\tstrModAllResistances\t\t\t\t0\n",
+                u8"maxlightresist\t42\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t584\t256\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t43\t19\t\tModStr5w\tModStr5w\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"coldresist\t43\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t43\t20\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\t19\t\tModStr1k\tModStr1k\t\t2\t19\t\tstrModAllResistances\tstrModAllResistances\t\t\t\t0\n",
+                u8"maxcoldresist\t44\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t584\t256\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\t19\t\tModStr5v\tModStr5v\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"poisonresist\t45\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t43\t20\t\t8\t0\t9\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34\t19\t\tModStr1n\tModStr1n\t\t2\t19\t\tstrModAllResistances\tstrModAllResistances\t\t\t\t0\n",
+                u8"maxpoisonresist\t46\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t526\t256\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t45\t19\t\tModStr5y\tModStr5y\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"damageaura\t47\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"firemindam\t48\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t11\t10\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t102\t19\t\tModStr1p\tModStr1p\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"firemaxdam\t49\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t19\t10\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t101\t19\t\tModStr1o\tModStr1o\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lightmindam\t50\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t12\t10\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t99\t19\t\tModStr1r\tModStr1r\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lightmaxdam\t51\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t17\t10\t\t9\t0\t10\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t98\t19\t\tModStr1q\tModStr1q\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"magicmindam\t52\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t196\t20\t\t6\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t104\t19\t\tstrModMagicDamage\tstrModMagicDamage\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"magicmaxdam\t53\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t183\t20\t\t7\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t103\t19\t\tstrModMagicDamage\tstrModMagicDamage\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"coldmindam\t54\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t451\t512\t\t6\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t96\t19\t\tModStr1t\tModStr1t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"coldmaxdam\t55\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t128\t340\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t95\t19\t\tModStr1s\tModStr1s\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"coldlength\t56\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t77\t4\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"poisonmindam\t57\t\t1\t19\t\t\t\t\t\t\t\t\t\t\t12\t28\t\t9\t0\t10\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t92\t19\t\tModStr4i\tModStr4i\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"poisonmaxdam\t58\t\t1\t19\t\t\t\t\t\t\t\t\t\t\t11\t34\t\t9\t0\t10\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t91\t19\t\tModStr4h\tModStr4h\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"poisonlength\t59\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t0\t4\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lifedrainmindam\t60\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t1044\t341\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t88\t19\t\tModStr2z\tModStr2z\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"lifedrainmaxdam\t61\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"manadrainmindam\t62\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t1179\t341\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t89\t19\t\tModStr2y\tModStr2y\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"manadrainmaxdam\t63\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"stamdrainmindam\t64\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"stamdrainmaxdam\t65\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"stunlength\t66\t\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"velocitypercent\t67\t1\t1\t10\t\t1\t\t\t\t\t\t\t\t\t\t\t\t7\t30\t7\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"attackrate\t68\t1\t1\t10\t\t1\t\t\t\t\t\t\t\t\t\t\t\t7\t30\t7\t30\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"other_animrate\t69\t1\t1\t10\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"quantity\t70\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"value\t71\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t100\t8\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"durability\t72\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t9\t0\t\t\t\t\t\t\t\t\t1\tmaxdurability\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"maxdurability\t73\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t9\t4\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"hpregen\t74\t\t\t\t\t\t\t\t\t\t\t\t\t\t451\t410\t\t6\t30\t6\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\t19\t\tModStr2l\tModStr2w\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_maxdurability_percent\t75\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t117\t10\t\t7\t20\t7\t20\t\t\t13\t\t\tmaxdurability\t\t\t\t\t\t\t\t\t\t3\t19\t\tModStr2i\tModStr2i\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_maxhp_percent\t76\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t32093\t204\t\t6\t10\t6\t10\t\t\t11\t\t\tmaxhp\t\t\t\t\t\t\t\t\t\t58\t19\t\tModStr2g\tModStr2g\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_maxmana_percent\t77\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t56452\t204\t\t6\t10\t6\t10\t\t\t11\t\t\tmaxmana\t\t\t\t\t\t\t\t\t\t54\t19\t\tModStr2h\tModStr2h\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_attackertakesdamage\t78\t\t1\t16\t\t\t\t\t\t\t1\t\t\t\t112\t128\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\tattackedinmelee\t6\t\t\t13\t19\t\tModStr1v\tModStr1v\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_goldbonus\t79\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t187\t34\t\t9\t100\t9\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t19\t\tModStr1w\tModStr1w\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_magicbonus\t80\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t577\t102\t\t8\t100\t8\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t19\t\tModStr1x\tModStr1x\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_knockback\t81\t\t1\t8\t\t\t\t\t\t\t1\t\t\t\t105\t0\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t7\tdomissiledamage\t7\t76\t19\t\tModStr1y\tModStr1y\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_timeduration\t82\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_addclassskills\t83\t\t1\t4\t3\t\t\t\t\t\t1\t\t\t\t49523\t1560\t\t3\t0\t3\t0\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t150\t13\t\tModStr3a\tModStr3a\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"unsentparam1\t84\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_addexperience\t85\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t36015\t519\t\t3\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t19\t\tModitem2ExpG\tModitem2ExpG\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_healafterkill\t86\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t30\t101\t\t3\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\tkill\t28\t\t\t16\t19\t\tModitemHPaK\tModitemHPaK\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_reducedprices\t87\t\t\t8\t\t\t\t\t\t\t\t\t\t\t18957\t203\t\t3\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t19\t\tModitemRedVendP\tModitemRedVendP\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_doubleherbduration\t88\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_lightradius\t89\t\t1\t5\t\t\t\t\t\t\t1\t\t\t\t15\t51\t\t4\t4\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t19\t\tModStr3f\tModStr3f\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_lightcolor\t90\t\t1\t24\t\t\t\t\t\t\t1\t\t\t\t155\t0\t\t5\t0\t24\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_req_percent\t91\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t26\t-34\t\t8\t100\t8\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t19\t\tModStr3h\tModStr3h\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_levelreq\t92\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_fasterattackrate\t93\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t1042\t156\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t145\t19\t\tModStr4m\tModStr4m\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_levelreqpct\t94\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t20\t7\t64\t\t\t13\t\t\titem_levelreq\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lastblockframe\t95\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_fastermovevelocity\t96\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t4083\t156\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t148\t19\t\tModStr4s\tModStr4s\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_nonclassskill\t97\t\t1\t15\t9\t\t\t\t\t\t1\t\t\t1\t181\t327\t\t7\t20\t6\t0\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t81\t28\t\tItemModifierNonClassSkill\tItemModifierNonClassSkill\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"state\t98\t1\t\t1\t8\t\t\t\t\t\t1\t\t\t\t415\t64\t\t6\t20\t1\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_fastergethitrate\t99\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t1065\t72\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t139\t19\t\tModStr4p\tModStr4p\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"monster_playercount\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_poison_override_length\t101\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_fasterblockrate\t102\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t1484\t72\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t136\t19\t\tModStr4y\tModStr4y\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"skill_bypass_undead\t103\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_bypass_demons\t104\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_fastercastrate\t105\t1\t1\t9\t\t\t\t\t\t\t\t\t\t\t3876\t156\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t142\t19\t\tModStr4v\tModStr4v\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"skill_bypass_beasts\t106\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_singleskill\t107\t\t1\t15\t9\t\t\t\t\t\t1\t\t\t1\t181\t256\t\t14\t0\t3\t0\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t81\t27\t\tItemModifierClassSkill\tItemModifierClassSkill\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_restinpeace\t108\t\t\t1\t\t\t\t\t\t\t1\t\t\t\t1987\t0\t\t14\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t1\tkill\t29\t\t\t81\t19\t\tModitemSMRIP\tModitemSMRIP\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"curse_resistance\t109\t\t\t9\t\t\t\t\t\t\t\t\t\t\t159\t33\t\t14\t0\t9\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_poisonlengthresist\t110\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t27\t10\t\t8\t20\t8\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t19\t\tModStr3r\tModStr3r\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_normaldamage\t111\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t94\t100\t\t7\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t122\t19\t\tModStr5b\tModStr5b\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_howl\t112\t\t1\t8\t\t\t\t\t\t\t1\t\t\t\t55\t10\t\t7\t-1\t7\t-1\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t8\tdomissiledamage\t8\t79\t5\t\tModStr3u\tModStr3u\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_stupidity\t113\t\t1\t8\t\t\t\t\t\t\t1\t\t\t\t332\t1024\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t9\tdomissiledamage\t9\t80\t12\t2\tModStr6d\tModStr6d\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_damagetomana\t114\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t43\t20\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t13\tdamagedbymissile\t13\t11\t19\t\tModStr3w\tModStr3w\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_ignoretargetac\t115\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t1088\t1024\t\t1\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t119\t19\t\tModStr3y\tModStr3y\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_fractionaltargetac\t116\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t67\t20\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t118\t19\t\tModStr5o\tModStr5o\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_preventheal\t117\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t48\t50\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t81\t19\t\tModStr4a\tModStr4a\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_halffreezeduration\t118\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t5096\t988\t\t1\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t19\t19\t\tModStr4b\tModStr4b\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_tohit_percent\t119\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t981\t40\t\t9\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t117\t19\t\tModStr4c\tModStr4c\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_damagetargetac\t120\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t24\t-20\t\t7\t128\t7\t128\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t75\t19\t\tModStr4d\tModStr4d\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_demondamage_percent\t121\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t19\t12\t\t9\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t112\t19\t\tModStr4e\tModStr4e\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_undeaddamage_percent\t122\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t13\t12\t\t9\t20\t9\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t108\t19\t\tModStr4f\tModStr4f\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_demon_tohit\t123\t\t1\t13\t\t\t\t\t\t\t\t\t\t\t15\t7\t\t10\t128\t10\t128\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t110\t19\t\tModStr4j\tModStr4j\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_undead_tohit\t124\t\t1\t13\t\t\t\t\t\t\t\t\t\t\t11\t7\t\t10\t128\t10\t128\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t106\t19\t\tModStr4k\tModStr4k\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_throwable\t125\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t82\t1024\t\t1\t0\t1\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t19\t\tModStr5a\tModStr5a\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_elemskill\t126\t\t1\t3\t3\t\t\t\t\t\t1\t\t\t\t76\t1024\t\t4\t0\t3\t0\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t157\t19\t\tModStr3i\tModStr3i\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_allskills\t127\t\t1\t8\t\t\t\t\t\t\t1\t\t\t\t15123\t4096\t\t3\t0\t3\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t158\t19\t\tModStr3k\tModStr3k\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_attackertakeslightdamage\t128\t\t1\t6\t\t\t\t\t\t\t1\t\t\t\t4\t102\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t10\t\t\t14\t19\t\tModStr3j\tModStr3j\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"ironmaiden_level\t129\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lifetap_level\t130\t\t1\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"thorns_percent\t131\t\t\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bonearmor\t132\t\t1\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bonearmormax\t133\t\t1\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_freeze\t134\t\t1\t5\t\t\t\t\t\t\t1\t\t\t\t666\t12\t\t5\t0\t5\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t14\tdomissiledamage\t14\t78\t12\t2\tModStr3l\tModStr3l\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_openwounds\t135\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t23\t10\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t15\tdomissiledamage\t15\t83\t19\t\tModStr3m\tModStr3m\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_crushingblow\t136\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t98\t40\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t16\tdomissiledamage\t16\t87\t19\t\tModStr5c\tModStr5c\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_kickdamage\t137\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t77\t51\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t121\t19\t\tModStr5e\tModStr5e\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_manaafterkill\t138\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t17\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\tkill\t17\t\t\t16\t19\t\tModStr5f\tModStr5f\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_healafterdemonkill\t139\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t18\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\tkill\t18\t\t\t15\t19\t\tModStr6c\tModStr6c\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_extrablood\t140\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t15\t10\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_deadlystrike\t141\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t31\t25\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t85\t19\t\tModStr5q\tModStr5q\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorbfire_percent\t142\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t5486\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t19\t\tModStr5g\tModStr5g\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorbfire\t143\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1739\t204\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t27\t19\t\tModStr5h\tModStr5h\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorblight_percent\t144\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t5486\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t19\t\tModStr5i\tModStr5i\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorblight\t145\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1739\t204\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t29\t19\t\tModStr5j\tModStr5j\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorbmagic_percent\t146\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t5486\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t26\t19\t\tModStr5k\tModStr5k\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorbmagic\t147\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1739\t204\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t33\t19\t\tModStr5l\tModStr5l\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorbcold_percent\t148\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t5486\t102\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t19\t\tModStr5m\tModStr5m\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorbcold\t149\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1739\t204\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\t19\t\tModStr5n\tModStr5n\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_slow\t150\t\t1\t7\t\t\t\t\t\t\t1\t\t\t\t101\t40\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t19\tdomissiledamage\t19\t77\t19\t\tModStr5r\tModStr5r\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_aura\t151\t\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t7\t0\t5\t0\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t159\t16\t0\tModitemAura\tModitemAura\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_indesctructible\t152\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t160\t19\t\tModStre9s\tModStre9s\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_cannotbefrozen\t153\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t15011\t2048\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\t19\t\tModStr5z\tModStr5z\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_staminadrainpct\t154\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t102\t20\t\t7\t20\t7\t20\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t49\t19\t\tModStr6e\tModStr6e\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_reanimate\t155\t\t\t7\t10\t\t\t\t\t\t1\t\t\t\t\t\t\t7\t0\t7\t0\t10\t\t\t\t\t\t\t\t\t\t1\tkill\t31\t\t\t17\t23\t\tModitemreanimas\tModitemreanimas\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_pierce\t156\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t1924\t2048\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t132\t19\t\tModStr6g\tModStr6g\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_magicarrow\t157\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t511\t1024\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t131\t19\t\tModStr6h\tModStr6h\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_explosivearrow\t158\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t492\t1536\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t133\t19\t\tModStr6i\tModStr6i\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_throw_mindamage\t159\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t76\t128\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_throw_maxdamage\t160\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t88\t128\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_handofathena\t161\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_staminapercent\t162\t\t1\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\tmaxstamina\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_passive_staminapercent\t163\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\tmaxstamina\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_concentration\t164\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_enchant\t165\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_pierce\t166\t\t1\t12\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_conviction\t167\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_chillingarmor\t168\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_frenzy\t169\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_decrepify\t170\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_armor_percent\t171\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"alignment\t172\t1\t\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"target0\t173\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"target1\t174\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"goldlost\t175\t\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"conversion_level\t176\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"conversion_maxhp\t177\t\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"unit_dooverlay\t178\t\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"attack_vs_montype\t179\t\t\t9\t10\t\t\t\t\t\t\t\t\t\t19\t14\t\t3\t0\t9\t\t10\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t108\t22\t\tModitemAttratvsM\tModitemAttratvsM\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"damage_vs_montype\t180\t\t\t9\t10\t\t\t\t\t\t\t\t\t\t27\t17\t\t3\t0\t9\t\t10\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t106\t22\t\tModitemdamvsm\tModitemdamvsm\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fade\t181\t1\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t0\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"armor_override_percent\t182\t1\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lasthitreactframe\t183\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"create_season\t184\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bonus_mindamage\t185\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bonus_maxdamage\t186\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_pierce_cold_immunity\t187\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonColdSunder\tModItemMonColdSunder\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_addskill_tab\t188\t\t1\t3\t6\t\t\t\t\t\t1\t\t\t\t11042\t768\t\t10\t0\t3\t0\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t151\t14\t\tStrSklTabItem1\tStrSklTabItem1\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_pierce_fire_immunity\t189\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonFireSunder\tModItemMonFireSunder\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_pierce_light_immunity\t190\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonLightSunder\tModItemMonLightSunder\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_pierce_poison_immunity\t191\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonPoisonSunder\tModItemMonPoisonSunder\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_pierce_damage_immunity\t192\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonPhysicalSunder\tModItemMonPhysicalSunder\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_pierce_magic_immunity\t193\t\t\t10\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\t19\t\tModItemMonMagicSunder\tModItemMonMagicSunder\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_numsockets\t194\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t38\t170\t\t4\t0\t4\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_skillonattack\t195\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t190\t256\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t1\tdomeleeattack\t20\tdomissileattack\t20\t160\t15\t\tItemExpansiveChancX\tItemExpansiveChancX\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_skillonkill\t196\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t85\t19\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t1\tkill\t20\t\t\t160\t15\t\tModitemskonKill\tModitemskonKill\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_skillondeath\t197\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t11\t9\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t\tkilled\t30\t\t\t160\t15\t\tModitemskondeath\tModitemskondeath\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_skillonhit\t198\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t190\t256\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t1\tdomeleedamage\t20\tdomissiledamage\t20\t160\t15\t\tItemExpansiveChanc1\tItemExpansiveChanc1\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_skillonlevelup\t199\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t7\t6\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t\tlevelup\t30\t\t\t160\t15\t\tModitemskonLevel\tModitemskonLevel\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_charge_noconsume\t200\t\t\t7\t\t\t\t\t\t\t\t\t\t\t106\t256\t\t\t\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t159\t19\t\tModStr6k\tModStr6k\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_skillongethit\t201\t\t1\t7\t16\t\t\t\t\t\t1\t\t\t2\t190\t256\t\t21\t0\t7\t0\t16\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t21\tdamagedbymissile\t21\t160\t15\t\tItemExpansiveChanc2\tItemExpansiveChanc2\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"modifierlist_castid\t202\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"unused203\t203\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t21\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_charged_skill\t204\t\t1\t30\t\t\t\t\t\t\t1\t\t\t3\t401\t256\t\t30\t0\t16\t0\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t24\t\tModStre10d\tModStre10d\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_noconsume\t205\t\t1\t7\t\t\t\t\t\t\t\t\t\t\t106\t256\t\t\t\t7\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t4\t19\t\tModStr6j\tModStr6j\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"passive_mastery_noconsume\t206\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mastery_replenish_oncrit\t206\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"unused208\t208\t\t1\t30\t\t\t\t\t\t\t\t\t\t3\t401\t256\t\t30\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"unused209\t209\t\t1\t30\t\t\t\t\t\t\t\t\t\t3\t401\t256\t\t30\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"unused210\t210\t\t1\t30\t\t\t\t\t\t\t\t\t\t3\t401\t256\t\t30\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"unused211\t211\t\t1\t30\t\t\t\t\t\t\t\t\t\t3\t401\t256\t\t30\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mastery_gethit_rate\t213\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mastery_attack_speed\t213\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_armor_perlevel\t214\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t43\t42\t\t6\t0\t6\t0\t\t\t4\t3\tlevel\tarmorclass\t\t\t\t\t\t\t\t\t\t72\t19\t\tModStr1i\tModStr1i\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_armorpercent_perlevel\t215\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t87\t100\t\t6\t0\t6\t0\t\t\t5\t3\tlevel\tarmorclass\t\t\t\t\t\t\t\t\t\t73\t19\t\tModstr2v\tModstr2v\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_hp_perlevel\t216\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t92\t64\t8\t6\t0\t6\t0\t\t\t2\t3\tlevel\tmaxhp\t\t\t\t\t\t\t\t\t\t57\t19\t\tModStr1u\tModStr1u\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_mana_perlevel\t217\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t90\t128\t8\t6\t0\t6\t0\t\t\t2\t3\tlevel\tmaxmana\t\t\t\t\t\t\t\t\t\t53\t19\t\tModStr1e\tModStr1e\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_maxdamage_perlevel\t218\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t54\t204\t\t6\t0\t6\t0\t\t\t4\t3\tlevel\tmaxdamage\tsecondary_maxdamage\titem_throw_maxdamage\t\t\t1\t\t\t\t\t125\t19\t\tModStr1f\tModStr1f\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_maxdamage_percent_perlevel\t219\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t86\t100\t\t6\t0\t6\t0\t\t\t5\t3\tlevel\tmaxdamage\tsecondary_maxdamage\titem_throw_maxdamage\t\t\t1\t\t\t\t\t128\t19\t\tModStr2j\tModStr2j\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_strength_perlevel\t220\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t132\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tstrength\t\t\t\t\t\t\t\t\t\t66\t19\t\tModStr1a\tModStr1a\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_dexterity_perlevel\t221\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t132\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tdexterity\t\t\t\t\t\t\t\t\t\t64\t19\t\tModStr1b\tModStr1b\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_energy_perlevel\t222\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t105\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tenergy\t\t\t\t\t\t\t\t\t\t60\t19\t\tModStr1d\tModStr1d\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_vitality_perlevel\t223\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t105\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tvitality\t\t\t\t\t\t\t\t\t\t62\t19\t\tModStr1c\tModStr1c\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_tohit_perlevel\t224\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t53\t20\t\t6\t0\t6\t0\t\t\t2\t1\tlevel\ttohit\t\t\t\t\t1\t\t\t\t\t114\t19\t\tModStr1h\tModStr1h\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_tohitpercent_perlevel\t225\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t10\t256\t\t6\t0\t6\t0\t\t\t2\t1\tlevel\titem_tohit_percent\t\t\t\t\t1\t\t\t\t\t116\t19\t\tModStr4c\tModStr4c\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_cold_damagemax_perlevel\t226\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t1058\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tcoldmaxdam\t\t\t\t\t1\t\t\t\t\t94\t19\t\tModStr1s\tModStr1s\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_fire_damagemax_perlevel\t227\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t49\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tfiremaxdam\t\t\t\t\t1\t\t\t\t\t100\t19\t\tModStr1o\tModStr1o\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_ltng_damagemax_perlevel\t228\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t49\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tlightmaxdam\t\t\t\t\t1\t\t\t\t\t97\t19\t\tModStr1q\tModStr1q\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_pois_damagemax_perlevel\t229\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t49\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tpoisonmaxdam\t\t\t\t\t1\t\t\t\t\t90\t19\t\tModStr4h\tModStr4h\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_resist_cold_perlevel\t230\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t101\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tcoldresist\t\t\t\t\t\t\t\t\t\t39\t19\t\tModStr1k\tModStr1k\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_resist_fire_perlevel\t231\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t101\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tfireresist\t\t\t\t\t\t\t\t\t\t35\t19\t\tModStr1j\tModStr1j\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_resist_ltng_perlevel\t232\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t101\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tlightresist\t\t\t\t\t\t\t\t\t\t37\t19\t\tModStr1l\tModStr1l\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_resist_pois_perlevel\t233\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t101\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tpoisonresist\t\t\t\t\t\t\t\t\t\t33\t19\t\tModStr1n\tModStr1n\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_absorb_cold_perlevel\t234\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t207\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_absorbcold\t\t\t\t\t\t\t\t\t\t32\t19\t\tModStre9p\tModStre9p\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorb_fire_perlevel\t235\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t207\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_absorbfire\t\t\t\t\t\t\t\t\t\t28\t19\t\tModStre9o\tModStre9o\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorb_ltng_perlevel\t236\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t207\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_absorblight\t\t\t\t\t\t\t\t\t\t30\t19\t\tModStre9q\tModStre9q\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorb_pois_perlevel\t237\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t207\t340\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_absorbmagic\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_thorns_perlevel\t238\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t55\t256\t\t6\t0\t5\t0\t\t\t2\t3\tlevel\titem_attackertakesdamage\t\t\t\t\t\t\t\t\t\t12\t19\t\tModStr1v\tModStr1v\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_find_gold_perlevel\t239\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t42\t256\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_goldbonus\t\t\t\t\t\t\t\t\t\t9\t19\t\tModStr1w\tModStr1w\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_find_magic_perlevel\t240\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t814\t1024\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_magicbonus\t\t\t\t\t\t\t\t\t\t7\t19\t\tModStr1x\tModStr1x\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_regenstamina_perlevel\t241\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t79\t256\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tstaminarecoverybonus\t\t\t\t\t\t\t\t\t\t47\t19\t\tModStr3v\tModStr3v\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_stamina_perlevel\t242\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t104\t64\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\tmaxstamina\t\t\t\t\t\t\t\t\t\t50\t19\t\tModStr5d\tModStr5d\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_damage_demon_perlevel\t243\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t56\t10\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_demondamage_percent\t\t\t\t\t1\t\t\t\t\t111\t19\t\tModStr4e\tModStr4e\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_damage_undead_perlevel\t244\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t91\t10\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_undeaddamage_percent\t\t\t\t\t1\t\t\t\t\t107\t19\t\tModStr4f\tModStr4f\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_tohit_demon_perlevel\t245\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t55\t10\t\t6\t0\t6\t0\t\t\t2\t1\tlevel\titem_demon_tohit\t\t\t\t\t1\t\t\t\t\t109\t19\t\tModStr4j\tModStr4j\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_tohit_undead_perlevel\t246\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t12\t10\t\t6\t0\t6\t0\t\t\t2\t1\tlevel\titem_undead_tohit\t\t\t\t\t1\t\t\t\t\t105\t19\t\tModStr4k\tModStr4k\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_crushingblow_perlevel\t247\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t213\t1024\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_crushingblow\t\t\t\t\t1\t\t\t\t\t86\t19\t\tModStr5c\tModStr5c\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_openwounds_perlevel\t248\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t181\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_openwounds\t\t\t\t\t1\t\t\t\t\t82\t19\t\tModStr3m\tModStr3m\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_kick_damage_perlevel\t249\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t104\t128\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_kickdamage\t\t\t\t\t1\t\t\t\t\t120\t19\t\tModStr5e\tModStr5e\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_deadlystrike_perlevel\t250\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t118\t512\t\t6\t0\t6\t0\t\t\t2\t3\tlevel\titem_deadlystrike\t\t\t\t\t1\t\t\t\t\t84\t19\t\tModStr5q\tModStr5q\tincreaseswithplaylevelX\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_find_gems_perlevel\t251\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_replenish_durability\t252\t\t1\t5\t\t\t\t\t\t\t\t\t\t\t106\t256\t\t5\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t11\t\tModStre9t\tModStre9t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_replenish_quantity\t253\t\t1\t5\t\t\t\t\t\t\t\t\t\t\t106\t256\t\t5\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t19\t\tModStre9v\tModStre9v\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_extra_stack\t254\t\t1\t\t\t\t\t\t\t\t\t\t\t\t99\t10\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t19\t\tModStre9i\tModStre9i\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_find_item\t255\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_slash_damage\t256\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_slash_damage_percent\t257\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_crush_damage\t258\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_crush_damage_percent\t259\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_thrust_damage\t260\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_thrust_damage_percent\t261\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_absorb_slash\t262\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_absorb_crush\t263\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_absorb_thrust\t264\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_absorb_slash_percent\t265\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_absorb_crush_percent\t266\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_absorb_thrust_percent\t267\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_armor_bytime\t268\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tarmorclass\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1i\tModStr1i\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_armorpercent_bytime\t269\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t7\t\t\tarmorclass\t\t\t\t\t\t\t\t\t\t180\t18\t\tModstr2v\tModstr2v\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_hp_bytime\t270\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tmaxhp\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1u\tModStr1u\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_mana_bytime\t271\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tmaxmana\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1e\tModStr1e\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_maxdamage_bytime\t272\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tmaxdamage\tsecondary_maxdamage\titem_throw_maxdamage\t\t\t1\t\t\t\t\t180\t17\t\tModStr1f\tModStr1f\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_maxdamage_percent_bytime\t273\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t7\t\t\tmaxdamage\tsecondary_mindamage\titem_throw_mindamage\t\t\t1\t\t\t\t\t180\t18\t\tModStr2j\tModStr2j\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_strength_bytime\t274\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tstrength\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1a\tModStr1a\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_dexterity_bytime\t275\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tdexterity\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1b\tModStr1b\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_energy_bytime\t276\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tenergy\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1d\tModStr1d\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_vitality_bytime\t277\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tvitality\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr1c\tModStr1c\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_tohit_bytime\t278\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\ttohit\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr1h\tModStr1h\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_tohitpercent_bytime\t279\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_tohit_percent\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr4c\tModStr4c\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_cold_damagemax_bytime\t280\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tcoldmaxdam\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr1s\tModStr1s\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_fire_damagemax_bytime\t281\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tfiremaxdam\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr1o\tModStr1o\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_ltng_damagemax_bytime\t282\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tlightmaxdam\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr1q\tModStr1q\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_pois_damagemax_bytime\t283\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tpoisonmaxdam\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr4h\tModStr4h\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_resist_cold_bytime\t284\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tcoldresist\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1k\tModStr1k\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_resist_fire_bytime\t285\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tfireresist\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1j\tModStr1j\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_resist_ltng_bytime\t286\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tlightresist\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1l\tModStr1l\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_resist_pois_bytime\t287\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tpoisonresist\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1n\tModStr1n\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_absorb_cold_bytime\t288\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_absorbcold\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStre9p\tModStre9p\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorb_fire_bytime\t289\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_absorbfire\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStre9o\tModStre9o\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorb_ltng_bytime\t290\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_absorblight\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStre9q\tModStre9q\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_absorb_pois_bytime\t291\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_absorbmagic\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"item_find_gold_bytime\t292\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_goldbonus\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1w\tModStr1w\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_find_magic_bytime\t293\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_magicbonus\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr1x\tModStr1x\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_regenstamina_bytime\t294\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tstaminarecoverybonus\t\t\t\t\t\t\t\t\t\t180\t18\t\tModStr3v\tModStr3v\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_stamina_bytime\t295\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\tmaxstamina\t\t\t\t\t\t\t\t\t\t180\t17\t\tModStr5d\tModStr5d\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_damage_demon_bytime\t296\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_demondamage_percent\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr4e\tModStr4e\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_damage_undead_bytime\t297\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_undeaddamage_percent\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr4f\tModStr4f\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_tohit_demon_bytime\t298\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_demon_tohit\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr4j\tModStr4j\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_tohit_undead_bytime\t299\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_undead_tohit\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr4k\tModStr4k\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_crushingblow_bytime\t300\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_crushingblow\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr5c\tModStr5c\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_openwounds_bytime\t301\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_openwounds\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr3m\tModStr3m\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_kick_damage_bytime\t302\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_kickdamage\t\t\t\t\t1\t\t\t\t\t180\t17\t\tModStr5e\tModStr5e\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_deadlystrike_bytime\t303\t\t1\t22\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t22\t0\t22\t0\t\t\t6\t\t\titem_deadlystrike\t\t\t\t\t1\t\t\t\t\t180\t18\t\tModStr5q\tModStr5q\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_find_gems_bytime\t304\t\t1\t\t\t\t\t\t\t\t\t\t\t4\t\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_pierce_cold\t305\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1432\t513\t\t\t\t8\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenrescoldsk\tModitemenrescoldsk\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_pierce_fire\t306\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1240\t497\t\t\t\t8\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenresfiresk\tModitemenresfiresk\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_pierce_ltng\t307\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1187\t481\t\t\t\t8\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenresltngsk\tModitemenresltngsk\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_pierce_pois\t308\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t1322\t506\t\t\t\t8\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenrespoissk\tModitemenrespoissk\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_damage_vs_monster\t309\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_damage_percent_vs_monster\t310\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_tohit_vs_monster\t311\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_tohit_percent_vs_monster\t312\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_ac_vs_monster\t313\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_ac_percent_vs_monster\t314\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"firelength\t315\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"burningmin\t316\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"burningmax\t317\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"progressive_damage\t318\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"progressive_steal\t319\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"progressive_other\t320\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"progressive_fire\t321\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"progressive_cold\t322\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"progressive_lightning\t323\t\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"item_extra_charges\t324\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t0\t6\t0\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"progressive_tohit\t325\t\t1\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"poison_count\t326\t\t1\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"damage_framerate\t327\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"pierce_idx\t328\t\t1\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_fire_mastery\t329\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t1117\t415\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemdamFiresk\tModitemdamFiresk\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"passive_ltng_mastery\t330\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t1054\t408\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemdamLtngsk\tModitemdamLtngsk\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"passive_cold_mastery\t331\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t1295\t379\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemdamColdsk\tModitemdamColdsk\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"passive_pois_mastery\t332\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t978\t394\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemdamPoissk\tModitemdamPoissk\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"passive_fire_pierce\t333\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t2578\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenresfiresk\tModitemenresfiresk\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"passive_ltng_pierce\t334\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t2493\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenresltngsk\tModitemenresltngsk\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"passive_cold_pierce\t335\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t1984\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenrescoldsk\tModitemenrescoldsk\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"passive_pois_pierce\t336\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t2345\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t88\t19\t\tModitemenrespoissk\tModitemenrespoissk\t\t\t\t\t\t\t\t\t2\t0\n",
+                u8"passive_critical_strike\t337\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_dodge\t338\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_avoid\t339\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_evade\t340\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t0\t7\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_warmth\t341\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mastery_melee_th\t342\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mastery_melee_dmg\t343\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mastery_melee_crit\t344\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mastery_throw_th\t345\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mastery_throw_dmg\t346\t\t1\t11\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mastery_throw_crit\t347\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_weaponblock\t348\t\t1\t9\t16\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_summon_resist\t349\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"modifierlist_skill\t350\t\t\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"modifierlist_level\t351\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"last_sent_hp_pct\t352\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"source_unit_type\t353\t\t\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"source_unit_id\t354\t\t\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"shortparam1\t355\t\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"questitemdifficulty\t356\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mag_mastery\t357\t\t1\t12\t\t\t\t\t\t\t\t\t\t\t1211\t431\t\t8\t0\t9\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"passive_mag_pierce\t358\t\t1\t9\t\t\t\t\t\t\t\t\t\t\t\t2812\t\t8\t0\t8\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_cooldown\t359\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skill_missile_damage_scale\t360\t\t\t32\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
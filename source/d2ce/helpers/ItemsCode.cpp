@@ -18,69 +18,65 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetItemsCode()
+        EmbeddedText GetItemsCode()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"offset\tcode\n";
-                ss << u8"0\t5\n";
-                ss << u8"3\t750\n";
-                ss << u8"7\t5000\n";
-                ss << u8"11\t750\n";
-                ss << u8"15\t50\n";
-                ss << u8"18\t10\n";
-                ss << u8"21\t35\n";
-                ss << u8"24\t35\n";
-                ss << u8"27\t35\n";
-                ss << u8"30\t100\n";
-                ss << u8"33\t100\n";
-                ss << u8"36\t100\n";
-                ss << u8"39\t750\n";
-                ss << u8"43\t50\n";
-                ss << u8"46\t10\n";
-                ss << u8"49\t192\n";
-                ss << u8"53\t30\n";
-                ss << u8"56\t30\n";
-                ss << u8"59\t160\n";
-                ss << u8"63\t60\n";
-                ss << u8"66\t60\n";
-                ss << u8"69\t171\n";
-                ss << u8"73\t100\n";
-                ss << u8"76\t100\n";
-                ss << u8"79\t192\n";
-                ss << u8"83\t180\n";
-                ss << u8"87\t180\n";
-                ss << u8"91\t256\n";
-                ss << u8"95\t320\n";
-                ss << u8"99\t320\n";
-                ss << u8"103\t128\n";
-                ss << u8"107\t20\n";
-                ss << u8"110\t20\n";
-                ss << u8"113\t128\n";
-                ss << u8"117\t40\n";
-                ss << u8"120\t40\n";
-                ss << u8"123\t128\n";
-                ss << u8"127\t80\n";
-                ss << u8"130\t80\n";
-                ss << u8"133\t128\n";
-                ss << u8"137\t150\n";
-                ss << u8"141\t150\n";
-                ss << u8"145\t128\n";
-                ss << u8"149\t250\n";
-                ss << u8"153\t250\n";
-                ss << u8"157\t1000\n";
-                ss << u8"161\t25\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"offset\tcode\n",
+                u8"0\t5\n",
+                u8"3\t750\n",
+                u8"7\t5000\n",
+                u8"11\t750\n",
+                u8"15\t50\n",
+                u8"18\t10\n",
+                u8"21\t35\n",
+                u8"24\t35\n",
+                u8"27\t35\n",
+                u8"30\t100\n",
+                u8"33\t100\n",
+                u8"36\t100\n",
+                u8"39\t750\n",
+                u8"43\t50\n",
+                u8"46\t10\n",
+                u8"49\t192\n",
+                u8"53\t30\n",
+                u8"56\t30\n",
+                u8"59\t160\n",
+                u8"63\t60\n",
+                u8"66\t60\n",
+                u8"69\t171\n",
+                u8"73\t100\n",
+                u8"76\t100\n",
+                u8"79\t192\n",
+                u8"83\t180\n",
+                u8"87\t180\n",
+                u8"91\t256\n",
+                u8"95\t320\n",
+                u8"99\t320\n",
+                u8"103\t128\n",
+                u8"107\t20\n",
+                u8"110\t20\n",
+                u8"113\t128\n",
+                u8"117\t40\n",
+                u8"120\t40\n",
+                u8"123\t128\n",
+                u8"127\t80\n",
+                u8"130\t80\n",
+                u8"133\t128\n",
+                u8"137\t150\n",
+                u8"141\t150\n",
+                u8"145\t128\n",
+                u8"149\t250\n",
+                u8"153\t250\n",
+                u8"157\t1000\n",
+                u8"161\t25\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,7146 +18,7142 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace JsonReaderHelper
     {
-        const std::string& GetLevels()
+        EmbeddedText GetLevels()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"[\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 788,\n";
-                ss << u8"    \"Key\": \"Moo Moo Farm\",\n";
-                ss << u8"    \"enUS\": \"The Secret Cow Level\",\n";
-                ss << u8"    \"zhTW\": \"秘密乳牛關\",\n";
-                ss << u8"    \"deDE\": \"Das Geheime Kuhlevel\",\n";
-                ss << u8"    \"esES\": \"Nivel Secreto de las Vacas\",\n";
-                ss << u8"    \"frFR\": \"Le niveau secret des vaches\",\n";
-                ss << u8"    \"itIT\": \"Livello Bovino Segreto\",\n";
-                ss << u8"    \"koKR\": \"비밀의 젖소방\",\n";
-                ss << u8"    \"plPL\": \"Sekretny krowi poziom\",\n";
-                ss << u8"    \"esMX\": \"El Nivel Secreto de la Vaca\",\n";
-                ss << u8"    \"jaJP\": \"秘密のモーモー牧場\",\n";
-                ss << u8"    \"ptBR\": \"O Nível Secreto da Vaca\",\n";
-                ss << u8"    \"ruRU\": \"Секретный коровий уровень\",\n";
-                ss << u8"    \"zhCN\": \"神秘的奶牛关\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 789,\n";
-                ss << u8"    \"Key\": \"Chaos Sanctum\",\n";
-                ss << u8"    \"enUS\": \"The Chaos Sanctuary\",\n";
-                ss << u8"    \"zhTW\": \"混沌魔殿\",\n";
-                ss << u8"    \"deDE\": \"Das Chaossanktuarium\",\n";
-                ss << u8"    \"esES\": \"Santuario del Caos\",\n";
-                ss << u8"    \"frFR\": \"Le Sanctuaire du chaos\",\n";
-                ss << u8"    \"itIT\": \"Il Santuario del Caos\",\n";
-                ss << u8"    \"koKR\": \"혼돈의 성역\",\n";
-                ss << u8"    \"plPL\": \"Sanktuarium Chaosu\",\n";
-                ss << u8"    \"esMX\": \"El Santuario del Caos\",\n";
-                ss << u8"    \"jaJP\": \"混沌の聖域\",\n";
-                ss << u8"    \"ptBR\": \"O Santuário do Caos\",\n";
-                ss << u8"    \"ruRU\": \"Святилище Хаоса\",\n";
-                ss << u8"    \"zhCN\": \"混沌避难所\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 790,\n";
-                ss << u8"    \"Key\": \"The Pandemonium Fortress\",\n";
-                ss << u8"    \"enUS\": \"The Pandemonium Fortress\",\n";
-                ss << u8"    \"zhTW\": \"混沌界要塞\",\n";
-                ss << u8"    \"deDE\": \"Die Festung des Wahnsinns\",\n";
-                ss << u8"    \"esES\": \"Fortaleza del Pandemónium\",\n";
-                ss << u8"    \"frFR\": \"La forteresse de Pandémonium\",\n";
-                ss << u8"    \"itIT\": \"La Fortezza del Pandemonio\",\n";
-                ss << u8"    \"koKR\": \"혼돈의 요새\",\n";
-                ss << u8"    \"plPL\": \"Forteca Pandemonium\",\n";
-                ss << u8"    \"esMX\": \"La Fortaleza del Pandemonio\",\n";
-                ss << u8"    \"jaJP\": \"伏魔殿の砦\",\n";
-                ss << u8"    \"ptBR\": \"A Fortaleza Pandemônio\",\n";
-                ss << u8"    \"ruRU\": \"Крепость Пандемония\",\n";
-                ss << u8"    \"zhCN\": \"混沌要塞\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 791,\n";
-                ss << u8"    \"Key\": \"River of Flame\",\n";
-                ss << u8"    \"enUS\": \"River of Flame\",\n";
-                ss << u8"    \"zhTW\": \"火焰之河\",\n";
-                ss << u8"    \"deDE\": \"Flammenfluss\",\n";
-                ss << u8"    \"esES\": \"Río de Llamas\",\n";
-                ss << u8"    \"frFR\": \"La Rivière de feu\",\n";
-                ss << u8"    \"itIT\": \"Fiume Infuocato\",\n";
-                ss << u8"    \"koKR\": \"불길의 강\",\n";
-                ss << u8"    \"plPL\": \"Rzeka Płomieni\",\n";
-                ss << u8"    \"esMX\": \"Río de Fuego\",\n";
-                ss << u8"    \"jaJP\": \"炎の河\",\n";
-                ss << u8"    \"ptBR\": \"Rio de Chamas\",\n";
-                ss << u8"    \"ruRU\": \"Огненная река\",\n";
-                ss << u8"    \"zhCN\": \"火焰之河\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 792,\n";
-                ss << u8"    \"Key\": \"Outer Steppes\",\n";
-                ss << u8"    \"enUS\": \"Outer Steppes\",\n";
-                ss << u8"    \"zhTW\": \"外圍荒原\",\n";
-                ss << u8"    \"deDE\": \"Äußere Steppe\",\n";
-                ss << u8"    \"esES\": \"Estepas Exteriores\",\n";
-                ss << u8"    \"frFR\": \"Les Steppes infinies\",\n";
-                ss << u8"    \"itIT\": \"Steppe Esterne\",\n";
-                ss << u8"    \"koKR\": \"평원 외곽\",\n";
-                ss << u8"    \"plPL\": \"Zewnętrzne Stepy\",\n";
-                ss << u8"    \"esMX\": \"Estepa Exterior\",\n";
-                ss << u8"    \"jaJP\": \"果ての草原\",\n";
-                ss << u8"    \"ptBR\": \"Estepes Externas\",\n";
-                ss << u8"    \"ruRU\": \"Рубежные степи\",\n";
-                ss << u8"    \"zhCN\": \"外域荒原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 793,\n";
-                ss << u8"    \"Key\": \"Plains of Despair\",\n";
-                ss << u8"    \"enUS\": \"Plains of Despair\",\n";
-                ss << u8"    \"zhTW\": \"絕望平原\",\n";
-                ss << u8"    \"deDE\": \"Ebene der Verzweiflung\",\n";
-                ss << u8"    \"esES\": \"Llanuras del Desaliento\",\n";
-                ss << u8"    \"frFR\": \"Les Plaines du désespoir\",\n";
-                ss << u8"    \"itIT\": \"Pianure della Disperazione\",\n";
-                ss << u8"    \"koKR\": \"절망의 평원\",\n";
-                ss << u8"    \"plPL\": \"Równina Rozpaczy\",\n";
-                ss << u8"    \"esMX\": \"Llanura del Desespero\",\n";
-                ss << u8"    \"jaJP\": \"絶望の平原\",\n";
-                ss << u8"    \"ptBR\": \"Planície do Desespero\",\n";
-                ss << u8"    \"ruRU\": \"Долина Отчаяния\",\n";
-                ss << u8"    \"zhCN\": \"绝望平原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 794,\n";
-                ss << u8"    \"Key\": \"City of the Damned\",\n";
-                ss << u8"    \"enUS\": \"City of the Damned\",\n";
-                ss << u8"    \"zhTW\": \"罪罰之城\",\n";
-                ss << u8"    \"deDE\": \"Stadt der Verdammten\",\n";
-                ss << u8"    \"esES\": \"Ciudad de los Malditos\",\n";
-                ss << u8"    \"frFR\": \"La Ville des damnés\",\n";
-                ss << u8"    \"itIT\": \"Città Dannata\",\n";
-                ss << u8"    \"koKR\": \"저주받은 자들의 도시\",\n";
-                ss << u8"    \"plPL\": \"Miasto Potępionych\",\n";
-                ss << u8"    \"esMX\": \"Ciudad de los Condenados\",\n";
-                ss << u8"    \"jaJP\": \"呪われし街\",\n";
-                ss << u8"    \"ptBR\": \"Cidade dos Condenados\",\n";
-                ss << u8"    \"ruRU\": \"Город Проклятых\",\n";
-                ss << u8"    \"zhCN\": \"神罚之城\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 795,\n";
-                ss << u8"    \"Key\": \"Durance of Hate Level 3\",\n";
-                ss << u8"    \"enUS\": \"Durance of Hate Level 3\",\n";
-                ss << u8"    \"zhTW\": \"憎恨囚牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Kerker des Hasses, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Represión del Odio nivel 3\",\n";
-                ss << u8"    \"frFR\": \"La Prison de la Haine niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Prigione dell'Odio L3\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지 3층\",\n";
-                ss << u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Prisión de Odio Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"憎悪の檻: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Cárcere do Ódio Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Узилище Ненависти: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"憎恨囚牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 796,\n";
-                ss << u8"    \"Key\": \"Durance of Hate Level 2\",\n";
-                ss << u8"    \"enUS\": \"Durance of Hate Level 2\",\n";
-                ss << u8"    \"zhTW\": \"憎恨囚牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Kerker des Hasses, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Represión del Odio nivel 2\",\n";
-                ss << u8"    \"frFR\": \"La Prison de la Haine niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Prigione dell'Odio L2\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지 2층\",\n";
-                ss << u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Prisión de Odio Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"憎悪の檻: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Cárcere do Ódio Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Узилище Ненависти: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"憎恨囚牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 797,\n";
-                ss << u8"    \"Key\": \"Durance of Hate Level 1\",\n";
-                ss << u8"    \"enUS\": \"Durance of Hate Level 1\",\n";
-                ss << u8"    \"zhTW\": \"憎恨囚牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Kerker des Hasses, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Represión del Odio nivel 1\",\n";
-                ss << u8"    \"frFR\": \"La Prison de la Haine niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Prigione dell'Odio L1\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지 1층\",\n";
-                ss << u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Prisión de Odio Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"憎悪の檻: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Cárcere do Ódio Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Узилище Ненависти: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"憎恨囚牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 798,\n";
-                ss << u8"    \"Key\": \"Disused Reliquary\",\n";
-                ss << u8"    \"enUS\": \"Disused Reliquary\",\n";
-                ss << u8"    \"zhTW\": \"廢棄的聖殿\",\n";
-                ss << u8"    \"deDE\": \"Verlassener Reliquienschrein\",\n";
-                ss << u8"    \"esES\": \"Relicario Abandonado\",\n";
-                ss << u8"    \"frFR\": \"Le Reliquaire abandonné\",\n";
-                ss << u8"    \"itIT\": \"Reliquiario Abbandonato\",\n";
-                ss << u8"    \"koKR\": \"버려진 성물실\",\n";
-                ss << u8"    \"plPL\": \"Opuszczony Relikwiarz\",\n";
-                ss << u8"    \"esMX\": \"Relicario Abandonado\",\n";
-                ss << u8"    \"jaJP\": \"打ち捨てられし聖廟\",\n";
-                ss << u8"    \"ptBR\": \"Relicário Abandonado\",\n";
-                ss << u8"    \"ruRU\": \"Заброшенный реликварий\",\n";
-                ss << u8"    \"zhCN\": \"废弃的藏骨室\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 799,\n";
-                ss << u8"    \"Key\": \"Ruined Fane\",\n";
-                ss << u8"    \"enUS\": \"Ruined Fane\",\n";
-                ss << u8"    \"zhTW\": \"荒廢的寺院\",\n";
-                ss << u8"    \"deDE\": \"Zerfallenes Heiligtum\",\n";
-                ss << u8"    \"esES\": \"Fano en Ruinas\",\n";
-                ss << u8"    \"frFR\": \"Le Sanctuaire en ruine\",\n";
-                ss << u8"    \"itIT\": \"Tempio Antico\",\n";
-                ss << u8"    \"koKR\": \"허물어진 교회당\",\n";
-                ss << u8"    \"plPL\": \"Zrujnowana Kaplica\",\n";
-                ss << u8"    \"esMX\": \"Santuario Destruido\",\n";
-                ss << u8"    \"jaJP\": \"荒れ果てた神殿\",\n";
-                ss << u8"    \"ptBR\": \"Ádito Arruinado\",\n";
-                ss << u8"    \"ruRU\": \"Разрушенная церковь\",\n";
-                ss << u8"    \"zhCN\": \"被毁的礼拜堂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 800,\n";
-                ss << u8"    \"Key\": \"Forgotten Temple\",\n";
-                ss << u8"    \"enUS\": \"Forgotten Temple\",\n";
-                ss << u8"    \"zhTW\": \"遺忘神殿\",\n";
-                ss << u8"    \"deDE\": \"Vergessener Tempel\",\n";
-                ss << u8"    \"esES\": \"Templo Olvidado\",\n";
-                ss << u8"    \"frFR\": \"Le Temple oublié\",\n";
-                ss << u8"    \"itIT\": \"Tempio Dimenticato\",\n";
-                ss << u8"    \"koKR\": \"잊힌 사원\",\n";
-                ss << u8"    \"plPL\": \"Zapomniana Świątynia\",\n";
-                ss << u8"    \"esMX\": \"Templo Olvidado\",\n";
-                ss << u8"    \"jaJP\": \"忘れ去られし寺院\",\n";
-                ss << u8"    \"ptBR\": \"Templo Esquecido\",\n";
-                ss << u8"    \"ruRU\": \"Забытый храм\",\n";
-                ss << u8"    \"zhCN\": \"被遗忘的神殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 801,\n";
-                ss << u8"    \"Key\": \"Forgotten Reliquary\",\n";
-                ss << u8"    \"enUS\": \"Forgotten Reliquary\",\n";
-                ss << u8"    \"zhTW\": \"遺忘的聖殿\",\n";
-                ss << u8"    \"deDE\": \"Vergessener Reliquienschrein\",\n";
-                ss << u8"    \"esES\": \"Relicario Olvidado\",\n";
-                ss << u8"    \"frFR\": \"Le Reliquaire oublié\",\n";
-                ss << u8"    \"itIT\": \"Reliquiario Dimenticato\",\n";
-                ss << u8"    \"koKR\": \"잊힌 성물실\",\n";
-                ss << u8"    \"plPL\": \"Zapomniany Relikwiarz\",\n";
-                ss << u8"    \"esMX\": \"Relicario Olvidado\",\n";
-                ss << u8"    \"jaJP\": \"忘れ去られし聖廟\",\n";
-                ss << u8"    \"ptBR\": \"Relicário Esquecido\",\n";
-                ss << u8"    \"ruRU\": \"Забытый реликварий\",\n";
-                ss << u8"    \"zhCN\": \"被遗忘的藏骨室\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 802,\n";
-                ss << u8"    \"Key\": \"Disused Fane\",\n";
-                ss << u8"    \"enUS\": \"Disused Fane\",\n";
-                ss << u8"    \"zhTW\": \"廢棄的寺院\",\n";
-                ss << u8"    \"deDE\": \"Verlassenes Heiligtum\",\n";
-                ss << u8"    \"esES\": \"Fano Abandonado\",\n";
-                ss << u8"    \"frFR\": \"Le Sanctuaire abandonné\",\n";
-                ss << u8"    \"itIT\": \"Tempio Abbandonato\",\n";
-                ss << u8"    \"koKR\": \"버려진 교회당\",\n";
-                ss << u8"    \"plPL\": \"Opuszczona Kaplica\",\n";
-                ss << u8"    \"esMX\": \"Santuario Abandonado\",\n";
-                ss << u8"    \"jaJP\": \"打ち捨てられし神殿\",\n";
-                ss << u8"    \"ptBR\": \"Ádito Abandonado\",\n";
-                ss << u8"    \"ruRU\": \"Заброшенная церковь\",\n";
-                ss << u8"    \"zhCN\": \"废弃的礼拜堂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 803,\n";
-                ss << u8"    \"Key\": \"Ruined Temple\",\n";
-                ss << u8"    \"enUS\": \"Ruined Temple\",\n";
-                ss << u8"    \"zhTW\": \"荒廢的神殿\",\n";
-                ss << u8"    \"deDE\": \"Zerfallener Tempel\",\n";
-                ss << u8"    \"esES\": \"Templo en Ruinas\",\n";
-                ss << u8"    \"frFR\": \"Le Temple en ruine\",\n";
-                ss << u8"    \"itIT\": \"Tempio in Rovina\",\n";
-                ss << u8"    \"koKR\": \"허물어진 사원\",\n";
-                ss << u8"    \"plPL\": \"Zrujnowana Świątynia\",\n";
-                ss << u8"    \"esMX\": \"Templo Destruido\",\n";
-                ss << u8"    \"jaJP\": \"荒れ果てた寺院\",\n";
-                ss << u8"    \"ptBR\": \"Templo Arruinado\",\n";
-                ss << u8"    \"ruRU\": \"Разрушенный храм\",\n";
-                ss << u8"    \"zhCN\": \"毁灭的神庙\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 804,\n";
-                ss << u8"    \"Key\": \"Flayer Dungeon Level 3\",\n";
-                ss << u8"    \"enUS\": \"Flayer Dungeon Level 3\",\n";
-                ss << u8"    \"zhTW\": \"剝皮地牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Schinderdungeon, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Mazmorra de Desollamiento nivel 3\",\n";
-                ss << u8"    \"frFR\": \"La Prison de l’Écorcheur niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo Scorticatore L3\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴 3층\",\n";
-                ss << u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Calabozo de los Desolladores Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの地下牢: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Masmorra dos Esfoladores Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Подземелье свежевателей: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"剥皮魔监牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 805,\n";
-                ss << u8"    \"Key\": \"Flayer Dungeon Level 2\",\n";
-                ss << u8"    \"enUS\": \"Flayer Dungeon Level 2\",\n";
-                ss << u8"    \"zhTW\": \"剝皮地牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Schinderdungeon, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Mazmorra de Desollamiento nivel 2\",\n";
-                ss << u8"    \"frFR\": \"La Prison de l’Écorcheur niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo Scorticatore L2\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴 2층\",\n";
-                ss << u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Calabozo de los Desolladores Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの地下牢: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Masmorra dos Esfoladores Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Подземелье свежевателей: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"剥皮魔监牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 806,\n";
-                ss << u8"    \"Key\": \"Flayer Dungeon Level 1\",\n";
-                ss << u8"    \"enUS\": \"Flayer Dungeon Level 1\",\n";
-                ss << u8"    \"zhTW\": \"剝皮地牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Schinderdungeon, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Mazmorra de Desollamiento nivel 1\",\n";
-                ss << u8"    \"frFR\": \"La Prison de l’Écorcheur niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo Scorticatore L1\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴 1층\",\n";
-                ss << u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Calabozo de los Desolladores Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの地下牢: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Masmorra dos Esfoladores Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Подземелье свежевателей: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"剥皮魔监牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 807,\n";
-                ss << u8"    \"Key\": \"Swampy Pit Level 3\",\n";
-                ss << u8"    \"enUS\": \"Swampy Pit Level 3\",\n";
-                ss << u8"    \"zhTW\": \"沼澤地穴第三層\",\n";
-                ss << u8"    \"deDE\": \"Sumpfloch, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Foso Pantanoso nivel 3\",\n";
-                ss << u8"    \"frFR\": \"Le Bourbier niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Abisso Paludoso L3\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이 3층\",\n";
-                ss << u8"    \"plPL\": \"Bagienna Czeluść – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Foso Pantanoso Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"沼地の穴ぐら: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Fosso Pantanoso Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Глубокая трясина: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"沼泽陷坑三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 808,\n";
-                ss << u8"    \"Key\": \"Swampy Pit Level 2\",\n";
-                ss << u8"    \"enUS\": \"Swampy Pit Level 2\",\n";
-                ss << u8"    \"zhTW\": \"沼澤地穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Sumpfloch, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Foso Pantanoso nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Le Bourbier niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Abisso Paludoso L2\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이 2층\",\n";
-                ss << u8"    \"plPL\": \"Bagienna Czeluść – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Foso Pantanoso Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"沼地の穴ぐら: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Fosso Pantanoso Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Глубокая трясина: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"沼泽陷坑二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 809,\n";
-                ss << u8"    \"Key\": \"Swampy Pit Level 1\",\n";
-                ss << u8"    \"enUS\": \"Swampy Pit Level 1\",\n";
-                ss << u8"    \"zhTW\": \"沼澤地穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Sumpfloch, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Foso Pantanoso nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Le Bourbier niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Abisso Paludoso L1\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이 1층\",\n";
-                ss << u8"    \"plPL\": \"Bagienna Czeluść – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Foso Pantanoso Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"沼地の穴ぐら: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Fosso Pantanoso Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Глубокая трясина: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"沼泽陷坑一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 810,\n";
-                ss << u8"    \"Key\": \"Spider Cave\",\n";
-                ss << u8"    \"enUS\": \"Arachnid Lair\",\n";
-                ss << u8"    \"zhTW\": \"蜘蛛巢穴\",\n";
-                ss << u8"    \"deDE\": \"Spinnenmonstergruft\",\n";
-                ss << u8"    \"esES\": \"Cubil Arácnido\",\n";
-                ss << u8"    \"frFR\": \"Le Repaire de l’Arachnide\",\n";
-                ss << u8"    \"itIT\": \"Covo degli Aracnidi\",\n";
-                ss << u8"    \"koKR\": \"독거미 둥지\",\n";
-                ss << u8"    \"plPL\": \"Legowisko Arachnidów\",\n";
-                ss << u8"    \"esMX\": \"Guarida Arácnida\",\n";
-                ss << u8"    \"jaJP\": \"蜘蛛の巣穴\",\n";
-                ss << u8"    \"ptBR\": \"Covil Aracnídeo\",\n";
-                ss << u8"    \"ruRU\": \"Логово арахнидов\",\n";
-                ss << u8"    \"zhCN\": \"巨蛛巢穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 811,\n";
-                ss << u8"    \"Key\": \"Spider Cavern\",\n";
-                ss << u8"    \"enUS\": \"Spider Cavern\",\n";
-                ss << u8"    \"zhTW\": \"蜘蛛洞窟\",\n";
-                ss << u8"    \"deDE\": \"Spinnenhöhle\",\n";
-                ss << u8"    \"esES\": \"Caverna de Arañas\",\n";
-                ss << u8"    \"frFR\": \"La Caverne de l’Araignée\",\n";
-                ss << u8"    \"itIT\": \"Caverna del Ragno\",\n";
-                ss << u8"    \"koKR\": \"거미 동굴\",\n";
-                ss << u8"    \"plPL\": \"Grota Pająków\",\n";
-                ss << u8"    \"esMX\": \"Caverna de Arañas\",\n";
-                ss << u8"    \"jaJP\": \"蜘蛛の洞窟\",\n";
-                ss << u8"    \"ptBR\": \"Caverna Aracnídea\",\n";
-                ss << u8"    \"ruRU\": \"Паучья пещера\",\n";
-                ss << u8"    \"zhCN\": \"蜘蛛洞穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 812,\n";
-                ss << u8"    \"Key\": \"Travincal\",\n";
-                ss << u8"    \"enUS\": \"Travincal\",\n";
-                ss << u8"    \"zhTW\": \"崔凡克\",\n";
-                ss << u8"    \"deDE\": \"Travincal\",\n";
-                ss << u8"    \"esES\": \"Travincal\",\n";
-                ss << u8"    \"frFR\": \"Travincal\",\n";
-                ss << u8"    \"itIT\": \"Travincal\",\n";
-                ss << u8"    \"koKR\": \"트라빈칼\",\n";
-                ss << u8"    \"plPL\": \"Travincal\",\n";
-                ss << u8"    \"esMX\": \"Travincal\",\n";
-                ss << u8"    \"jaJP\": \"トラヴィンカル\",\n";
-                ss << u8"    \"ptBR\": \"Travincal\",\n";
-                ss << u8"    \"ruRU\": \"Травинкаль\",\n";
-                ss << u8"    \"zhCN\": \"崔凡克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 813,\n";
-                ss << u8"    \"Key\": \"Kurast Causeway\",\n";
-                ss << u8"    \"enUS\": \"Kurast Causeway\",\n";
-                ss << u8"    \"zhTW\": \"庫拉斯特堤道\",\n";
-                ss << u8"    \"deDE\": \"Damm von Kurast\",\n";
-                ss << u8"    \"esES\": \"Calzada de Kurast\",\n";
-                ss << u8"    \"frFR\": \"La Chaussée de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Strada per Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 둑길\",\n";
-                ss << u8"    \"plPL\": \"Grobla Kurast\",\n";
-                ss << u8"    \"esMX\": \"Calzada de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト舗道\",\n";
-                ss << u8"    \"ptBR\": \"Passagem de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"Курастская дамба\",\n";
-                ss << u8"    \"zhCN\": \"库拉斯特堤道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 814,\n";
-                ss << u8"    \"Key\": \"Upper Kurast\",\n";
-                ss << u8"    \"enUS\": \"Upper Kurast\",\n";
-                ss << u8"    \"zhTW\": \"庫拉斯特上層\",\n";
-                ss << u8"    \"deDE\": \"Oberkurast\",\n";
-                ss << u8"    \"esES\": \"Parte Alta de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Kurast - La ville haute\",\n";
-                ss << u8"    \"itIT\": \"Kurast Superiore\",\n";
-                ss << u8"    \"koKR\": \"상부 쿠라스트\",\n";
-                ss << u8"    \"plPL\": \"Górne Kurast\",\n";
-                ss << u8"    \"esMX\": \"Alta Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト上層\",\n";
-                ss << u8"    \"ptBR\": \"Kurast Superior\",\n";
-                ss << u8"    \"ruRU\": \"Верхний Кураст\",\n";
-                ss << u8"    \"zhCN\": \"库拉斯特上层区\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 815,\n";
-                ss << u8"    \"Key\": \"Kurast Bazaar\",\n";
-                ss << u8"    \"enUS\": \"Kurast Bazaar\",\n";
-                ss << u8"    \"zhTW\": \"庫拉斯特市集\",\n";
-                ss << u8"    \"deDE\": \"Basar von Kurast\",\n";
-                ss << u8"    \"esES\": \"Bazar de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Le Bazar de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Bazar di Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 시장\",\n";
-                ss << u8"    \"plPL\": \"Bazar Kurast\",\n";
-                ss << u8"    \"esMX\": \"Bazar de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト・バザール\",\n";
-                ss << u8"    \"ptBR\": \"Bazar de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"Курастский базар\",\n";
-                ss << u8"    \"zhCN\": \"库拉斯特集市\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 816,\n";
-                ss << u8"    \"Key\": \"Lower Kurast\",\n";
-                ss << u8"    \"enUS\": \"Lower Kurast\",\n";
-                ss << u8"    \"zhTW\": \"庫拉斯特下層\",\n";
-                ss << u8"    \"deDE\": \"Unterkurast\",\n";
-                ss << u8"    \"esES\": \"Parte Baja de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Kurast - La ville basse\",\n";
-                ss << u8"    \"itIT\": \"Kurast Inferiore\",\n";
-                ss << u8"    \"koKR\": \"하부 쿠라스트\",\n";
-                ss << u8"    \"plPL\": \"Dolne Kurast\",\n";
-                ss << u8"    \"esMX\": \"Baja Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト下層\",\n";
-                ss << u8"    \"ptBR\": \"Kurast Inferior\",\n";
-                ss << u8"    \"ruRU\": \"Нижний Кураст\",\n";
-                ss << u8"    \"zhCN\": \"库拉斯特下层区\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 817,\n";
-                ss << u8"    \"Key\": \"Flayer Jungle\",\n";
-                ss << u8"    \"enUS\": \"Flayer Jungle\",\n";
-                ss << u8"    \"zhTW\": \"剝皮叢林\",\n";
-                ss << u8"    \"deDE\": \"Schinderdschungel\",\n";
-                ss << u8"    \"esES\": \"Selva Desolladora\",\n";
-                ss << u8"    \"frFR\": \"La Jungle de l’Écorcheur\",\n";
-                ss << u8"    \"itIT\": \"Giungla Scorticatrice\",\n";
-                ss << u8"    \"koKR\": \"약탈자 밀림\",\n";
-                ss << u8"    \"plPL\": \"Dżungla Łupieżców\",\n";
-                ss << u8"    \"esMX\": \"Jungla de los Desolladores\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの密林\",\n";
-                ss << u8"    \"ptBR\": \"Selva dos Esfoladores\",\n";
-                ss << u8"    \"ruRU\": \"Джунгли свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"剥皮魔丛林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 818,\n";
-                ss << u8"    \"Key\": \"Great Marsh\",\n";
-                ss << u8"    \"enUS\": \"Great Marsh\",\n";
-                ss << u8"    \"zhTW\": \"大沼澤\",\n";
-                ss << u8"    \"deDE\": \"Großes Moor\",\n";
-                ss << u8"    \"esES\": \"Gran Pantano\",\n";
-                ss << u8"    \"frFR\": \"Le Grand marais\",\n";
-                ss << u8"    \"itIT\": \"Grande Palude\",\n";
-                ss << u8"    \"koKR\": \"거대 습지\",\n";
-                ss << u8"    \"plPL\": \"Wielkie Moczary\",\n";
-                ss << u8"    \"esMX\": \"Gran Marisma\",\n";
-                ss << u8"    \"jaJP\": \"大湿原\",\n";
-                ss << u8"    \"ptBR\": \"Grande Charco\",\n";
-                ss << u8"    \"ruRU\": \"Болотина\",\n";
-                ss << u8"    \"zhCN\": \"庞大湿地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 819,\n";
-                ss << u8"    \"Key\": \"Spider Forest\",\n";
-                ss << u8"    \"enUS\": \"Spider Forest\",\n";
-                ss << u8"    \"zhTW\": \"蜘蛛森林\",\n";
-                ss << u8"    \"deDE\": \"Spinnenwald\",\n";
-                ss << u8"    \"esES\": \"Bosque de Arañas\",\n";
-                ss << u8"    \"frFR\": \"La Forêt de l’Araignée\",\n";
-                ss << u8"    \"itIT\": \"Foresta del Ragno\",\n";
-                ss << u8"    \"koKR\": \"거미 숲\",\n";
-                ss << u8"    \"plPL\": \"Las Pająków\",\n";
-                ss << u8"    \"esMX\": \"Bosque de Arañas\",\n";
-                ss << u8"    \"jaJP\": \"蜘蛛の森\",\n";
-                ss << u8"    \"ptBR\": \"Floresta Aracnídea\",\n";
-                ss << u8"    \"ruRU\": \"Паучий лес\",\n";
-                ss << u8"    \"zhCN\": \"蜘蛛森林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 820,\n";
-                ss << u8"    \"Key\": \"Kurast Docktown\",\n";
-                ss << u8"    \"enUS\": \"Kurast Docks\",\n";
-                ss << u8"    \"zhTW\": \"庫拉斯特港口\",\n";
-                ss << u8"    \"deDE\": \"Docks von Kurast\",\n";
-                ss << u8"    \"esES\": \"Muelles de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Les Quais de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Zona Portuale di Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 부두\",\n";
-                ss << u8"    \"plPL\": \"Doki Kurast\",\n";
-                ss << u8"    \"esMX\": \"Muelles de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト港\",\n";
-                ss << u8"    \"ptBR\": \"Docas de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"Доки Кураста\",\n";
-                ss << u8"    \"zhCN\": \"库拉斯特海港\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 821,\n";
-                ss << u8"    \"Key\": \"Durance of Hate\",\n";
-                ss << u8"    \"enUS\": \"Durance of Hate\",\n";
-                ss << u8"    \"zhTW\": \"憎恨囚牢\",\n";
-                ss << u8"    \"deDE\": \"Kerker des Hasses\",\n";
-                ss << u8"    \"esES\": \"Represión del Odio\",\n";
-                ss << u8"    \"frFR\": \"La Prison de la Haine\",\n";
-                ss << u8"    \"itIT\": \"Prigione dell'Odio\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지\",\n";
-                ss << u8"    \"plPL\": \"Kazamaty Nienawiści\",\n";
-                ss << u8"    \"esMX\": \"Prisión de Odio\",\n";
-                ss << u8"    \"jaJP\": \"憎悪の檻\",\n";
-                ss << u8"    \"ptBR\": \"Cárcere do Ódio\",\n";
-                ss << u8"    \"ruRU\": \"Узилище ненависти\",\n";
-                ss << u8"    \"zhCN\": \"憎恨囚牢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 822,\n";
-                ss << u8"    \"Key\": \"Flayer Dungeon\",\n";
-                ss << u8"    \"enUS\": \"Flayer Dungeon\",\n";
-                ss << u8"    \"zhTW\": \"剝皮地牢\",\n";
-                ss << u8"    \"deDE\": \"Schinderdungeon\",\n";
-                ss << u8"    \"esES\": \"Mazmorra de Desollamiento\",\n";
-                ss << u8"    \"frFR\": \"La Prison de l’Écorcheur\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo Scorticatore\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴\",\n";
-                ss << u8"    \"plPL\": \"Podziemia Łupieżców\",\n";
-                ss << u8"    \"esMX\": \"Calabozo de los Desolladores\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの地下牢\",\n";
-                ss << u8"    \"ptBR\": \"Masmorra dos Esfoladores\",\n";
-                ss << u8"    \"ruRU\": \"Подземелье свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"剥皮魔监牢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 823,\n";
-                ss << u8"    \"Key\": \"Swampy Pit\",\n";
-                ss << u8"    \"enUS\": \"Swampy Pit\",\n";
-                ss << u8"    \"zhTW\": \"沼澤地穴\",\n";
-                ss << u8"    \"deDE\": \"Sumpfloch\",\n";
-                ss << u8"    \"esES\": \"Foso Pantanoso\",\n";
-                ss << u8"    \"frFR\": \"Le Bourbier\",\n";
-                ss << u8"    \"itIT\": \"Abisso Paludoso\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이\",\n";
-                ss << u8"    \"plPL\": \"Bagienna Czeluść\",\n";
-                ss << u8"    \"esMX\": \"Foso Pantanoso\",\n";
-                ss << u8"    \"jaJP\": \"沼地の穴ぐら\",\n";
-                ss << u8"    \"ptBR\": \"Fosso Pantanoso\",\n";
-                ss << u8"    \"ruRU\": \"Глубокая трясина\",\n";
-                ss << u8"    \"zhCN\": \"沼泽陷坑\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 824,\n";
-                ss << u8"    \"Key\": \"Arcane Sanctuary\",\n";
-                ss << u8"    \"enUS\": \"Arcane Sanctuary\",\n";
-                ss << u8"    \"zhTW\": \"秘法聖殿\",\n";
-                ss << u8"    \"deDE\": \"Geheime Zuflucht\",\n";
-                ss << u8"    \"esES\": \"Santuario Arcano\",\n";
-                ss << u8"    \"frFR\": \"Le Sanctuaire des Arcanes\",\n";
-                ss << u8"    \"itIT\": \"Santuario Arcano\",\n";
-                ss << u8"    \"koKR\": \"비전의 성역\",\n";
-                ss << u8"    \"plPL\": \"Tajemne Sanktuarium\",\n";
-                ss << u8"    \"esMX\": \"Santuario Arcano\",\n";
-                ss << u8"    \"jaJP\": \"深遠なる聖域\",\n";
-                ss << u8"    \"ptBR\": \"Santuário Arcano\",\n";
-                ss << u8"    \"ruRU\": \"Магическое убежище\",\n";
-                ss << u8"    \"zhCN\": \"神秘避难所\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 825,\n";
-                ss << u8"    \"Key\": \"Duriel's Lair\",\n";
-                ss << u8"    \"enUS\": \"Tal Rasha's Chamber\",\n";
-                ss << u8"    \"zhTW\": \"塔拉夏的密室\",\n";
-                ss << u8"    \"deDE\": \"Tal Rashas Kammer\",\n";
-                ss << u8"    \"esES\": \"Cámara de Tal Rasha\",\n";
-                ss << u8"    \"frFR\": \"La Chambre de Tal Rasha\",\n";
-                ss << u8"    \"itIT\": \"Cripta di Tal Rasha\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 방\",\n";
-                ss << u8"    \"plPL\": \"Komnata Tal Rashy\",\n";
-                ss << u8"    \"esMX\": \"Cámara de Tal Rasha\",\n";
-                ss << u8"    \"jaJP\": \"タル・ラシャの間\",\n";
-                ss << u8"    \"ptBR\": \"Câmara de Tal Rasha\",\n";
-                ss << u8"    \"ruRU\": \"Погребальный зал Тал Раши\",\n";
-                ss << u8"    \"zhCN\": \"塔·拉夏的墓室\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 826,\n";
-                ss << u8"    \"Key\": \"Tal Rasha's Tomb\",\n";
-                ss << u8"    \"enUS\": \"Tal Rasha's Tomb\",\n";
-                ss << u8"    \"zhTW\": \"塔拉夏的古墓\",\n";
-                ss << u8"    \"deDE\": \"Tal Rashas Grab\",\n";
-                ss << u8"    \"esES\": \"Tumba de Tal Rasha\",\n";
-                ss << u8"    \"frFR\": \"Le Tombeau de Tal Rasha\",\n";
-                ss << u8"    \"itIT\": \"Tomba di Tal Rasha\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 무덤\",\n";
-                ss << u8"    \"plPL\": \"Grobowiec Tal Rashy\",\n";
-                ss << u8"    \"esMX\": \"Tumba de Tal Rasha\",\n";
-                ss << u8"    \"jaJP\": \"タル・ラシャの墓\",\n";
-                ss << u8"    \"ptBR\": \"Tumba de Tal Rasha\",\n";
-                ss << u8"    \"ruRU\": \"Гробница Тал Раши\",\n";
-                ss << u8"    \"zhCN\": \"塔·拉夏之墓\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 827,\n";
-                ss << u8"    \"Key\": \"Ancient Tunnels\",\n";
-                ss << u8"    \"enUS\": \"Ancient Tunnels\",\n";
-                ss << u8"    \"zhTW\": \"古代通道\",\n";
-                ss << u8"    \"deDE\": \"Alte Tunnels\",\n";
-                ss << u8"    \"esES\": \"Túneles Antiguos\",\n";
-                ss << u8"    \"frFR\": \"Les Tunnels antiques\",\n";
-                ss << u8"    \"itIT\": \"Antichi Tunnel\",\n";
-                ss << u8"    \"koKR\": \"고대 토굴\",\n";
-                ss << u8"    \"plPL\": \"Prastare Tunele\",\n";
-                ss << u8"    \"esMX\": \"Túneles Antiguos\",\n";
-                ss << u8"    \"jaJP\": \"古の坑道\",\n";
-                ss << u8"    \"ptBR\": \"Túneis Ancestrais\",\n";
-                ss << u8"    \"ruRU\": \"Древние туннели\",\n";
-                ss << u8"    \"zhCN\": \"古代水道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 828,\n";
-                ss << u8"    \"Key\": \"Maggot Lair Level 3\",\n";
-                ss << u8"    \"enUS\": \"Maggot Lair Level 3\",\n";
-                ss << u8"    \"zhTW\": \"蛆蟲巢穴第三層\",\n";
-                ss << u8"    \"deDE\": \"Wurmgruft, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Cubil de Gusanos nivel 3\",\n";
-                ss << u8"    \"frFR\": \"Le Repaire du ver niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Covo delle Larve L3\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴 3층\",\n";
-                ss << u8"    \"plPL\": \"Robacze Gniazdo – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Guarida de Gusanos Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"地虫の巣穴: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Covil de Vermes Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Логово мокриц: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"蛆虫巢穴三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 829,\n";
-                ss << u8"    \"Key\": \"Maggot Lair Level 2\",\n";
-                ss << u8"    \"enUS\": \"Maggot Lair Level 2\",\n";
-                ss << u8"    \"zhTW\": \"蛆蟲巢穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Wurmgruft, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Cubil de Gusanos nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Le Repaire du ver niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Covo delle Larve L2\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴 2층\",\n";
-                ss << u8"    \"plPL\": \"Robacze Gniazdo – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Guarida de Gusanos Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"地虫の巣穴: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Covil de Vermes Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Логово мокриц: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"蛆虫巢穴二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 830,\n";
-                ss << u8"    \"Key\": \"Maggot Lair Level 1\",\n";
-                ss << u8"    \"enUS\": \"Maggot Lair Level 1\",\n";
-                ss << u8"    \"zhTW\": \"蛆蟲巢穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Wurmgruft, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Cubil de Gusanos nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Le Repaire du ver niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Covo delle Larve L1\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴 1층\",\n";
-                ss << u8"    \"plPL\": \"Robacze Gniazdo – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Guarida de Gusanos Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"地虫の巣穴: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Covil de Vermes Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Логово мокриц: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"蛆虫巢穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 831,\n";
-                ss << u8"    \"Key\": \"Claw Viper Temple Level 2\",\n";
-                ss << u8"    \"enUS\": \"Claw Viper Temple Level 2\",\n";
-                ss << u8"    \"zhTW\": \"利爪蛇魔神殿第二層\",\n";
-                ss << u8"    \"deDE\": \"Tempel der Klauenvipern, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Templo de la Garra Viperina nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Le Temple des Vipères niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Tempio delle Vipere L2\",\n";
-                ss << u8"    \"koKR\": \"발톱 독사 사원 2층\",\n";
-                ss << u8"    \"plPL\": \"Świątynia Żmijoszponów – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Templo del Vipérido de Garras Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Templo da Víbora da Garra Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Храм Когтистого Змея: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"利爪腹蛇神庙二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 832,\n";
-                ss << u8"    \"Key\": \"Halls of the Dead Level 3\",\n";
-                ss << u8"    \"enUS\": \"Halls of the Dead Level 3\",\n";
-                ss << u8"    \"zhTW\": \"死亡之殿第三層\",\n";
-                ss << u8"    \"deDE\": \"Hallen der Toten, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Salas de la Muerte nivel 3\",\n";
-                ss << u8"    \"frFR\": \"Les Couloirs des morts niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Sale dei Morti L3\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당 3층\",\n";
-                ss << u8"    \"plPL\": \"Sale Umarłych – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Salas de la Muerte Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"亡者の広間: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Salões dos Mortos Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Мертвых: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"亡者大殿三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 833,\n";
-                ss << u8"    \"Key\": \"Stony Tomb Level 2\",\n";
-                ss << u8"    \"enUS\": \"Stony Tomb Level 2\",\n";
-                ss << u8"    \"zhTW\": \"古老石墓第二層\",\n";
-                ss << u8"    \"deDE\": \"Steingrab, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Tumba Pedregosa nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Le Tombeau de pierre niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Tomba di Pietra L2\",\n";
-                ss << u8"    \"koKR\": \"바위 무덤 2층\",\n";
-                ss << u8"    \"plPL\": \"Kamienny Grobowiec – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Tumba Pedregosa Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"石造りの墓所: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Tumba Pétrea Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Каменная гробница: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"碎石古墓二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 834,\n";
-                ss << u8"    \"Key\": \"Claw Viper Temple Level 1\",\n";
-                ss << u8"    \"enUS\": \"Claw Viper Temple Level 1\",\n";
-                ss << u8"    \"zhTW\": \"利爪蛇魔神殿第一層\",\n";
-                ss << u8"    \"deDE\": \"Tempel der Klauenvipern, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Templo de la Garra Viperina nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Le Temple des Vipères niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Tempio delle Vipere L1\",\n";
-                ss << u8"    \"koKR\": \"발톱 독사 사원 1층\",\n";
-                ss << u8"    \"plPL\": \"Świątynia Żmijoszponów – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Templo del Vipérido de Garras Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Templo da Víbora da Garra Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Храм Когтистого Змея: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"利爪蝮蛇神殿一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 835,\n";
-                ss << u8"    \"Key\": \"Halls of the Dead Level 2\",\n";
-                ss << u8"    \"enUS\": \"Halls of the Dead Level 2\",\n";
-                ss << u8"    \"zhTW\": \"死亡之殿第二層\",\n";
-                ss << u8"    \"deDE\": \"Hallen der Toten, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Salas de la Muerte nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Les Couloirs des morts niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Sale dei Morti L2\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당 2층\",\n";
-                ss << u8"    \"plPL\": \"Sale Umarłych – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Salas de la Muerte Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"亡者の広間: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Salões dos Mortos Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Мертвых: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"亡者大殿二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 836,\n";
-                ss << u8"    \"Key\": \"Halls of the Dead Level 1\",\n";
-                ss << u8"    \"enUS\": \"Halls of the Dead Level 1\",\n";
-                ss << u8"    \"zhTW\": \"死亡之殿第一層\",\n";
-                ss << u8"    \"deDE\": \"Hallen der Toten, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Salas de la Muerte nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Les Couloirs des morts niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Sale dei Morti L1\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당 1층\",\n";
-                ss << u8"    \"plPL\": \"Sale Umarłych – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Salas de la Muerte Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"亡者の広間: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Salões dos Mortos Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Мертвых: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"亡者大殿一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 837,\n";
-                ss << u8"    \"Key\": \"Stony Tomb Level 1\",\n";
-                ss << u8"    \"enUS\": \"Stony Tomb Level 1\",\n";
-                ss << u8"    \"zhTW\": \"古老石墓第一層\",\n";
-                ss << u8"    \"deDE\": \"Steingrab, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Tumba Pedregosa nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Le Tombeau de pierre niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Tomba di Pietra L1\",\n";
-                ss << u8"    \"koKR\": \"바위 무덤 1층\",\n";
-                ss << u8"    \"plPL\": \"Kamienny Grobowiec – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Tumba Pedregosa Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"石造りの墓所: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Tumba Pétrea Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Каменная гробница: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"碎石古墓一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 838,\n";
-                ss << u8"    \"Key\": \"Palace Cellar Level 3\",\n";
-                ss << u8"    \"enUS\": \"Palace Cellar Level 3\",\n";
-                ss << u8"    \"zhTW\": \"皇宮地窖第三層\",\n";
-                ss << u8"    \"deDE\": \"Palastkeller, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Sótano del Palacio nivel 3\",\n";
-                ss << u8"    \"frFR\": \"Les Caves du Palais niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Sotterranei del Palazzo L3\",\n";
-                ss << u8"    \"koKR\": \"궁전 지하 3층\",\n";
-                ss << u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Sótano del Palacio Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"宮殿地下室: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Porão do Palácio Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Дворцовый погреб: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"王宫监牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 839,\n";
-                ss << u8"    \"Key\": \"Palace Cellar Level 2\",\n";
-                ss << u8"    \"enUS\": \"Palace Cellar Level 2\",\n";
-                ss << u8"    \"zhTW\": \"皇宮地窖第二層\",\n";
-                ss << u8"    \"deDE\": \"Palastkeller, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Sótano del Palacio nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Les Caves du Palais niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Sotterranei del Palazzo L2\",\n";
-                ss << u8"    \"koKR\": \"궁전 지하 2층\",\n";
-                ss << u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Sótano del Palacio Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"宮殿地下室: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Porão do Palácio Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Дворцовый погреб: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"王宫监牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 840,\n";
-                ss << u8"    \"Key\": \"Palace Cellar Level 1\",\n";
-                ss << u8"    \"enUS\": \"Palace Cellar Level 1\",\n";
-                ss << u8"    \"zhTW\": \"皇宮地窖第一層\",\n";
-                ss << u8"    \"deDE\": \"Palastkeller, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Sótano del Palacio nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Les Caves du Palais niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Sotterranei del Palazzo L1\",\n";
-                ss << u8"    \"koKR\": \"궁전 지하 1층\",\n";
-                ss << u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Sótano del Palacio Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"宮殿地下室: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Porão do Palácio Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Дворцовый погреб: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"王宫监牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 841,\n";
-                ss << u8"    \"Key\": \"Harem Level 2\",\n";
-                ss << u8"    \"enUS\": \"Harem Level 2\",\n";
-                ss << u8"    \"zhTW\": \"後宮第二層\",\n";
-                ss << u8"    \"deDE\": \"Harem, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Harén nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Le Harem niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Harem L2\",\n";
-                ss << u8"    \"koKR\": \"하렘 2층\",\n";
-                ss << u8"    \"plPL\": \"Harem – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Harén Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"ハーレム: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Harém Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Гарем: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"女眷住处二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 842,\n";
-                ss << u8"    \"Key\": \"Harem Level 1\",\n";
-                ss << u8"    \"enUS\": \"Harem Level 1\",\n";
-                ss << u8"    \"zhTW\": \"後宮第一層\",\n";
-                ss << u8"    \"deDE\": \"Harem, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Harén nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Le Harem niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Harem L1\",\n";
-                ss << u8"    \"koKR\": \"하렘 1층\",\n";
-                ss << u8"    \"plPL\": \"Harem – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Harén Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"ハーレム: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Harém Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Гарем: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"女眷住处一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 843,\n";
-                ss << u8"    \"Key\": \"Sewers Level 3\",\n";
-                ss << u8"    \"enUS\": \"Sewers Level 3\",\n";
-                ss << u8"    \"zhTW\": \"下水道第三層\",\n";
-                ss << u8"    \"deDE\": \"Kanalisation, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Cloacas nivel 3\",\n";
-                ss << u8"    \"frFR\": \"Les Égouts niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Fogne L3\",\n";
-                ss << u8"    \"koKR\": \"하수도 3층\",\n";
-                ss << u8"    \"plPL\": \"Kanały – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Cloacas Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"下水道: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Esgoto Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Стоки: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"下水道三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 844,\n";
-                ss << u8"    \"Key\": \"Sewers Level 2\",\n";
-                ss << u8"    \"enUS\": \"Sewers Level 2\",\n";
-                ss << u8"    \"zhTW\": \"下水道第二層\",\n";
-                ss << u8"    \"deDE\": \"Kanalisation, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Cloacas nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Les Égouts niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Fogne L2\",\n";
-                ss << u8"    \"koKR\": \"하수도 2층\",\n";
-                ss << u8"    \"plPL\": \"Kanały – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Cloacas Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"下水道: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Esgoto Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Стоки: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"下水道二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 845,\n";
-                ss << u8"    \"Key\": \"Sewers Level 1\",\n";
-                ss << u8"    \"enUS\": \"Sewers Level 1\",\n";
-                ss << u8"    \"zhTW\": \"下水道第一層\",\n";
-                ss << u8"    \"deDE\": \"Kanalisation, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Cloacas nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Les Égouts niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Fogne L1\",\n";
-                ss << u8"    \"koKR\": \"하수도 1층\",\n";
-                ss << u8"    \"plPL\": \"Kanały – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Cloacas Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"下水道: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Esgoto Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Стоки: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"下水道一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 846,\n";
-                ss << u8"    \"Key\": \"Canyon of the Magi\",\n";
-                ss << u8"    \"enUS\": \"Canyon of the Magi\",\n";
-                ss << u8"    \"zhTW\": \"賢者之谷\",\n";
-                ss << u8"    \"deDE\": \"Schlucht der Magier\",\n";
-                ss << u8"    \"esES\": \"Cañón de los Magos\",\n";
-                ss << u8"    \"frFR\": \"Le Canyon des Mages\",\n";
-                ss << u8"    \"itIT\": \"Canyon dei Maghi\",\n";
-                ss << u8"    \"koKR\": \"신비술사의 협곡\",\n";
-                ss << u8"    \"plPL\": \"Kanion Magów\",\n";
-                ss << u8"    \"esMX\": \"Cañón de los Magos\",\n";
-                ss << u8"    \"jaJP\": \"魔術師の峡谷\",\n";
-                ss << u8"    \"ptBR\": \"Cânion dos Magi\",\n";
-                ss << u8"    \"ruRU\": \"Каньон волхвов\",\n";
-                ss << u8"    \"zhCN\": \"法师峡谷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 847,\n";
-                ss << u8"    \"Key\": \"Valley of Snakes\",\n";
-                ss << u8"    \"enUS\": \"Valley of Snakes\",\n";
-                ss << u8"    \"zhTW\": \"群蛇峽谷\",\n";
-                ss << u8"    \"deDE\": \"Tal der Schlangen\",\n";
-                ss << u8"    \"esES\": \"Valle de las Serpientes\",\n";
-                ss << u8"    \"frFR\": \"La Vallée des serpents\",\n";
-                ss << u8"    \"itIT\": \"Valle dei Serpenti\",\n";
-                ss << u8"    \"koKR\": \"뱀의 골짜기\",\n";
-                ss << u8"    \"plPL\": \"Dolina Węży\",\n";
-                ss << u8"    \"esMX\": \"Valle de las Culebras\",\n";
-                ss << u8"    \"jaJP\": \"蛇の谷\",\n";
-                ss << u8"    \"ptBR\": \"Vale das Cobras\",\n";
-                ss << u8"    \"ruRU\": \"Долина змей\",\n";
-                ss << u8"    \"zhCN\": \"群蛇峡谷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 848,\n";
-                ss << u8"    \"Key\": \"Lost City\",\n";
-                ss << u8"    \"enUS\": \"Lost City\",\n";
-                ss << u8"    \"zhTW\": \"失落古城\",\n";
-                ss << u8"    \"deDE\": \"Vergessene Stadt\",\n";
-                ss << u8"    \"esES\": \"Ciudad Perdida\",\n";
-                ss << u8"    \"frFR\": \"La Ville oubliée\",\n";
-                ss << u8"    \"itIT\": \"Città Perduta\",\n";
-                ss << u8"    \"koKR\": \"잊힌 도시\",\n";
-                ss << u8"    \"plPL\": \"Zaginione Miasto\",\n";
-                ss << u8"    \"esMX\": \"Ciudad Perdida\",\n";
-                ss << u8"    \"jaJP\": \"失われし都\",\n";
-                ss << u8"    \"ptBR\": \"Cidade Perdida\",\n";
-                ss << u8"    \"ruRU\": \"Затерянный город\",\n";
-                ss << u8"    \"zhCN\": \"失落之城\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 849,\n";
-                ss << u8"    \"Key\": \"Far Oasis\",\n";
-                ss << u8"    \"enUS\": \"Far Oasis\",\n";
-                ss << u8"    \"zhTW\": \"遙遠的綠洲\",\n";
-                ss << u8"    \"deDE\": \"Ferne Oase\",\n";
-                ss << u8"    \"esES\": \"Oasis Lejano\",\n";
-                ss << u8"    \"frFR\": \"L’Oasis lointaine\",\n";
-                ss << u8"    \"itIT\": \"Oasi Lontana\",\n";
-                ss << u8"    \"koKR\": \"머나먼 오아시스\",\n";
-                ss << u8"    \"plPL\": \"Daleka Oaza\",\n";
-                ss << u8"    \"esMX\": \"Oasis Lejano\",\n";
-                ss << u8"    \"jaJP\": \"遥かなるオアシス\",\n";
-                ss << u8"    \"ptBR\": \"Oásis Longínquo\",\n";
-                ss << u8"    \"ruRU\": \"Дальний оазис\",\n";
-                ss << u8"    \"zhCN\": \"偏远绿洲\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 850,\n";
-                ss << u8"    \"Key\": \"Dry Hills\",\n";
-                ss << u8"    \"enUS\": \"Dry Hills\",\n";
-                ss << u8"    \"zhTW\": \"乾土高地\",\n";
-                ss << u8"    \"deDE\": \"Verdorrte Hügel\",\n";
-                ss << u8"    \"esES\": \"Colinas Áridas\",\n";
-                ss << u8"    \"frFR\": \"Les Collines arides\",\n";
-                ss << u8"    \"itIT\": \"Colline Aride\",\n";
-                ss << u8"    \"koKR\": \"메마른 언덕\",\n";
-                ss << u8"    \"plPL\": \"Suche Wzgórza\",\n";
-                ss << u8"    \"esMX\": \"Colinas Áridas\",\n";
-                ss << u8"    \"jaJP\": \"乾きの丘\",\n";
-                ss << u8"    \"ptBR\": \"Colinas Áridas\",\n";
-                ss << u8"    \"ruRU\": \"Иссохшие холмы\",\n";
-                ss << u8"    \"zhCN\": \"干燥高地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 851,\n";
-                ss << u8"    \"Key\": \"Rocky Waste\",\n";
-                ss << u8"    \"enUS\": \"Rocky Waste\",\n";
-                ss << u8"    \"zhTW\": \"碎石荒地\",\n";
-                ss << u8"    \"deDE\": \"Felsige Öde\",\n";
-                ss << u8"    \"esES\": \"Erial Rocoso\",\n";
-                ss << u8"    \"frFR\": \"Le Désert de roche\",\n";
-                ss << u8"    \"itIT\": \"Landa Rocciosa\",\n";
-                ss << u8"    \"koKR\": \"바위투성이 황무지\",\n";
-                ss << u8"    \"plPL\": \"Skalne Pustkowie\",\n";
-                ss << u8"    \"esMX\": \"Estepa Rocosa\",\n";
-                ss << u8"    \"jaJP\": \"岩だらけの荒れ地\",\n";
-                ss << u8"    \"ptBR\": \"Ermo Rochoso\",\n";
-                ss << u8"    \"ruRU\": \"Каменистая пустошь\",\n";
-                ss << u8"    \"zhCN\": \"碎石荒野\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 852,\n";
-                ss << u8"    \"Key\": \"Lut Gholein\",\n";
-                ss << u8"    \"enUS\": \"Lut Gholein\",\n";
-                ss << u8"    \"zhTW\": \"魯高因\",\n";
-                ss << u8"    \"deDE\": \"Lut Gholein\",\n";
-                ss << u8"    \"esES\": \"Lut Gholein\",\n";
-                ss << u8"    \"frFR\": \"Lut Gholein\",\n";
-                ss << u8"    \"itIT\": \"Lut Gholein\",\n";
-                ss << u8"    \"koKR\": \"루트 골레인\",\n";
-                ss << u8"    \"plPL\": \"Lut Gholein\",\n";
-                ss << u8"    \"esMX\": \"Lut Gholein\",\n";
-                ss << u8"    \"jaJP\": \"ラット・ゴーレイン\",\n";
-                ss << u8"    \"ptBR\": \"Lut Gholein\",\n";
-                ss << u8"    \"ruRU\": \"Лут-Голейн\",\n";
-                ss << u8"    \"zhCN\": \"鲁·高因\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 853,\n";
-                ss << u8"    \"Key\": \"Maggot Lair\",\n";
-                ss << u8"    \"enUS\": \"Maggot Lair\",\n";
-                ss << u8"    \"zhTW\": \"蛆蟲巢穴\",\n";
-                ss << u8"    \"deDE\": \"Wurmgruft\",\n";
-                ss << u8"    \"esES\": \"Cubil de Gusanos\",\n";
-                ss << u8"    \"frFR\": \"Le Repaire du ver\",\n";
-                ss << u8"    \"itIT\": \"Covo delle Larve\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴\",\n";
-                ss << u8"    \"plPL\": \"Robacze Gniazdo\",\n";
-                ss << u8"    \"esMX\": \"Guarida de Gusanos\",\n";
-                ss << u8"    \"jaJP\": \"地虫の巣穴\",\n";
-                ss << u8"    \"ptBR\": \"Covil de Vermes\",\n";
-                ss << u8"    \"ruRU\": \"Логово мокриц\",\n";
-                ss << u8"    \"zhCN\": \"蛆虫巢穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 854,\n";
-                ss << u8"    \"Key\": \"Claw Viper Temple\",\n";
-                ss << u8"    \"enUS\": \"Claw Viper Temple\",\n";
-                ss << u8"    \"zhTW\": \"利爪蛇魔神殿\",\n";
-                ss << u8"    \"deDE\": \"Tempel der Klauenvipern\",\n";
-                ss << u8"    \"esES\": \"Templo de la Garra Viperina\",\n";
-                ss << u8"    \"frFR\": \"Le Temple des Vipères\",\n";
-                ss << u8"    \"itIT\": \"Tempio delle Vipere\",\n";
-                ss << u8"    \"koKR\": \"발톱 독사 사원\",\n";
-                ss << u8"    \"plPL\": \"Świątynia Żmijoszponów\",\n";
-                ss << u8"    \"esMX\": \"Templo del Vipérido de Garras\",\n";
-                ss << u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院\",\n";
-                ss << u8"    \"ptBR\": \"Templo da Víbora da Garra\",\n";
-                ss << u8"    \"ruRU\": \"Храм Когтистого Змея\",\n";
-                ss << u8"    \"zhCN\": \"利爪蝮蛇神殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 855,\n";
-                ss << u8"    \"Key\": \"Halls of the Dead\",\n";
-                ss << u8"    \"enUS\": \"Halls of the Dead\",\n";
-                ss << u8"    \"zhTW\": \"死亡之殿\",\n";
-                ss << u8"    \"deDE\": \"Hallen der Toten\",\n";
-                ss << u8"    \"esES\": \"Salas de la Muerte\",\n";
-                ss << u8"    \"frFR\": \"Les Couloirs des morts\",\n";
-                ss << u8"    \"itIT\": \"Sale dei Morti\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당\",\n";
-                ss << u8"    \"plPL\": \"Sale Umarłych\",\n";
-                ss << u8"    \"esMX\": \"Salas de la Muerte\",\n";
-                ss << u8"    \"jaJP\": \"亡者の広間\",\n";
-                ss << u8"    \"ptBR\": \"Salões dos Mortos\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги мертвых\",\n";
-                ss << u8"    \"zhCN\": \"亡者大殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 856,\n";
-                ss << u8"    \"Key\": \"Stony Tomb\",\n";
-                ss << u8"    \"enUS\": \"Stony Tomb\",\n";
-                ss << u8"    \"zhTW\": \"古老石墓\",\n";
-                ss << u8"    \"deDE\": \"Steingrab\",\n";
-                ss << u8"    \"esES\": \"Tumba Pedregosa\",\n";
-                ss << u8"    \"frFR\": \"Le Tombeau de pierre\",\n";
-                ss << u8"    \"itIT\": \"Tomba di Pietra\",\n";
-                ss << u8"    \"koKR\": \"바위 무덤\",\n";
-                ss << u8"    \"plPL\": \"Kamienny Grobowiec\",\n";
-                ss << u8"    \"esMX\": \"Tumba Pedregosa\",\n";
-                ss << u8"    \"jaJP\": \"石造りの墓所\",\n";
-                ss << u8"    \"ptBR\": \"Tumba Pétrea\",\n";
-                ss << u8"    \"ruRU\": \"Каменная гробница\",\n";
-                ss << u8"    \"zhCN\": \"碎石古墓\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 857,\n";
-                ss << u8"    \"Key\": \"Palace Cellar\",\n";
-                ss << u8"    \"enUS\": \"Palace Cellar\",\n";
-                ss << u8"    \"zhTW\": \"皇宮地窖\",\n";
-                ss << u8"    \"deDE\": \"Palastkeller\",\n";
-                ss << u8"    \"esES\": \"Sótano del Palacio\",\n";
-                ss << u8"    \"frFR\": \"Les Caves du Palais\",\n";
-                ss << u8"    \"itIT\": \"Sotterranei del Palazzo\",\n";
-                ss << u8"    \"koKR\": \"궁전 지하\",\n";
-                ss << u8"    \"plPL\": \"Pałacowe Piwnice\",\n";
-                ss << u8"    \"esMX\": \"Sótano del Palacio\",\n";
-                ss << u8"    \"jaJP\": \"宮殿地下室\",\n";
-                ss << u8"    \"ptBR\": \"Porão do Palácio\",\n";
-                ss << u8"    \"ruRU\": \"Дворцовый погреб\",\n";
-                ss << u8"    \"zhCN\": \"王宫监牢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 858,\n";
-                ss << u8"    \"Key\": \"Harem\",\n";
-                ss << u8"    \"enUS\": \"Harem\",\n";
-                ss << u8"    \"zhTW\": \"後宮\",\n";
-                ss << u8"    \"deDE\": \"Harem\",\n";
-                ss << u8"    \"esES\": \"Harén\",\n";
-                ss << u8"    \"frFR\": \"Le Harem\",\n";
-                ss << u8"    \"itIT\": \"Harem\",\n";
-                ss << u8"    \"koKR\": \"하렘\",\n";
-                ss << u8"    \"plPL\": \"Harem\",\n";
-                ss << u8"    \"esMX\": \"Harén\",\n";
-                ss << u8"    \"jaJP\": \"ハーレム\",\n";
-                ss << u8"    \"ptBR\": \"Harém\",\n";
-                ss << u8"    \"ruRU\": \"Гарем\",\n";
-                ss << u8"    \"zhCN\": \"女眷住处\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 859,\n";
-                ss << u8"    \"Key\": \"Sewers\",\n";
-                ss << u8"    \"enUS\": \"Sewers\",\n";
-                ss << u8"    \"zhTW\": \"下水道\",\n";
-                ss << u8"    \"deDE\": \"Kanalisation\",\n";
-                ss << u8"    \"esES\": \"Cloacas\",\n";
-                ss << u8"    \"frFR\": \"Les Égouts\",\n";
-                ss << u8"    \"itIT\": \"Fogne\",\n";
-                ss << u8"    \"koKR\": \"하수도\",\n";
-                ss << u8"    \"plPL\": \"Kanały\",\n";
-                ss << u8"    \"esMX\": \"Cloacas\",\n";
-                ss << u8"    \"jaJP\": \"下水道\",\n";
-                ss << u8"    \"ptBR\": \"Esgoto\",\n";
-                ss << u8"    \"ruRU\": \"Стоки\",\n";
-                ss << u8"    \"zhCN\": \"下水道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 860,\n";
-                ss << u8"    \"Key\": \"To The Moo Moo Farm\",\n";
-                ss << u8"    \"enUS\": \"To The Secret Cow Level\",\n";
-                ss << u8"    \"zhTW\": \"前往秘密乳牛關\",\n";
-                ss << u8"    \"deDE\": \"Zum Geheimen Kuhlevel\",\n";
-                ss << u8"    \"esES\": \"Al Nivel Secreto de las Vacas\",\n";
-                ss << u8"    \"frFR\": \"Vers le niveau secret des vaches\",\n";
-                ss << u8"    \"itIT\": \"Per il Livello Bovino Segreto\",\n";
-                ss << u8"    \"koKR\": \"비밀의 젖소방으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Sekretny krowi poziom\",\n";
-                ss << u8"    \"esMX\": \"Al Nivel Secreto de la Vaca\",\n";
-                ss << u8"    \"jaJP\": \"秘密のモーモー牧場へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Nível Secreto da Vaca\",\n";
-                ss << u8"    \"ruRU\": \"На секретный коровий уровень\",\n";
-                ss << u8"    \"zhCN\": \"前往神秘的奶牛关\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 861,\n";
-                ss << u8"    \"Key\": \"To Chaos Sanctum\",\n";
-                ss << u8"    \"enUS\": \"To The Chaos Sanctuary\",\n";
-                ss << u8"    \"zhTW\": \"前往混沌魔殿\",\n";
-                ss << u8"    \"deDE\": \"Zum Chaossanktuarium\",\n";
-                ss << u8"    \"esES\": \"Al Santuario del Caos\",\n";
-                ss << u8"    \"frFR\": \"Vers le Sanctuaire du chaos\",\n";
-                ss << u8"    \"itIT\": \"Per il Santuario del Caos\",\n";
-                ss << u8"    \"koKR\": \"혼돈의 성역으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Sanktuarium Chaosu\",\n";
-                ss << u8"    \"esMX\": \"Al Santuario del Caos\",\n";
-                ss << u8"    \"jaJP\": \"混沌の聖域へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Santuário do Caos\",\n";
-                ss << u8"    \"ruRU\": \"В Святилище Хаоса\",\n";
-                ss << u8"    \"zhCN\": \"前往混沌避难所\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 862,\n";
-                ss << u8"    \"Key\": \"To The River of Flame\",\n";
-                ss << u8"    \"enUS\": \"To The River of Flame\",\n";
-                ss << u8"    \"zhTW\": \"前往火焰之河\",\n";
-                ss << u8"    \"deDE\": \"Zum Flammenfluss\",\n";
-                ss << u8"    \"esES\": \"Al Río de Llamas\",\n";
-                ss << u8"    \"frFR\": \"Vers la Rivière de feu\",\n";
-                ss << u8"    \"itIT\": \"Per il Fiume Infuocato\",\n";
-                ss << u8"    \"koKR\": \"불길의 강으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Rzeka Płomieni\",\n";
-                ss << u8"    \"esMX\": \"Al Río de Fuego\",\n";
-                ss << u8"    \"jaJP\": \"炎の河へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Rio de Chamas\",\n";
-                ss << u8"    \"ruRU\": \"К Огненной реке\",\n";
-                ss << u8"    \"zhCN\": \"前往火焰之河\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 863,\n";
-                ss << u8"    \"Key\": \"To The Outer Steppes\",\n";
-                ss << u8"    \"enUS\": \"To The Outer Steppes\",\n";
-                ss << u8"    \"zhTW\": \"前往外圍荒原\",\n";
-                ss << u8"    \"deDE\": \"Zur äußeren Steppe\",\n";
-                ss << u8"    \"esES\": \"A las Estepas Exteriores\",\n";
-                ss << u8"    \"frFR\": \"Vers les Steppes infinies\",\n";
-                ss << u8"    \"itIT\": \"Per le Steppe Esterne\",\n";
-                ss << u8"    \"koKR\": \"평원 외곽으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zewnętrzne Stepy\",\n";
-                ss << u8"    \"esMX\": \"A la Estepa Exterior\",\n";
-                ss << u8"    \"jaJP\": \"果ての草原へ\",\n";
-                ss << u8"    \"ptBR\": \"Para as Estepes Externas\",\n";
-                ss << u8"    \"ruRU\": \"В Рубежные Степи\",\n";
-                ss << u8"    \"zhCN\": \"前往外域荒原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 864,\n";
-                ss << u8"    \"Key\": \"To The Plains of Despair\",\n";
-                ss << u8"    \"enUS\": \"To The Plains of Despair\",\n";
-                ss << u8"    \"zhTW\": \"前往絕望平原\",\n";
-                ss << u8"    \"deDE\": \"Zur Ebene der Verzweiflung\",\n";
-                ss << u8"    \"esES\": \"A las Llanuras del Desaliento\",\n";
-                ss << u8"    \"frFR\": \"Vers les Plaines du désespoir\",\n";
-                ss << u8"    \"itIT\": \"Per le Pianure della Disperazione\",\n";
-                ss << u8"    \"koKR\": \"절망의 평원으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Równina Rozpaczy\",\n";
-                ss << u8"    \"esMX\": \"A la Llanura del Desespero\",\n";
-                ss << u8"    \"jaJP\": \"絶望の平原へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Planície do Desespero\",\n";
-                ss << u8"    \"ruRU\": \"В долину Отчаяния\",\n";
-                ss << u8"    \"zhCN\": \"前往绝望平原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 865,\n";
-                ss << u8"    \"Key\": \"To The City of the Damned\",\n";
-                ss << u8"    \"enUS\": \"To The City of the Damned\",\n";
-                ss << u8"    \"zhTW\": \"前往罪罰之城\",\n";
-                ss << u8"    \"deDE\": \"Zur Stadt der Verdammten\",\n";
-                ss << u8"    \"esES\": \"A la Ciudad de los Malditos\",\n";
-                ss << u8"    \"frFR\": \"Vers la Ville des damnés\",\n";
-                ss << u8"    \"itIT\": \"Per la Città Dannata\",\n";
-                ss << u8"    \"koKR\": \"저주받은 자들의 도시로 이동\",\n";
-                ss << u8"    \"plPL\": \"Miasto Potępionych\",\n";
-                ss << u8"    \"esMX\": \"A la Ciudad de los Condenados\",\n";
-                ss << u8"    \"jaJP\": \"呪われし街へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Cidade dos Condenados\",\n";
-                ss << u8"    \"ruRU\": \"В Город Проклятых\",\n";
-                ss << u8"    \"zhCN\": \"前往神罚之城\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 866,\n";
-                ss << u8"    \"Key\": \"To The Pandemonium Fortress\",\n";
-                ss << u8"    \"enUS\": \"To The Pandemonium Fortress\",\n";
-                ss << u8"    \"zhTW\": \"前往混沌界要塞\",\n";
-                ss << u8"    \"deDE\": \"Zur Festung des Wahnsinns\",\n";
-                ss << u8"    \"esES\": \"A la Fortaleza del Pandemónium\",\n";
-                ss << u8"    \"frFR\": \"Vers la Forteresse de Pandémonium\",\n";
-                ss << u8"    \"itIT\": \"Per la Fortezza del Pandemonio\",\n";
-                ss << u8"    \"koKR\": \"혼돈의 요새로 이동\",\n";
-                ss << u8"    \"plPL\": \"Forteca Pandemonium\",\n";
-                ss << u8"    \"esMX\": \"A la Fortaleza del Pandemonio\",\n";
-                ss << u8"    \"jaJP\": \"伏魔殿の砦へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Fortaleza Pandemônio\",\n";
-                ss << u8"    \"ruRU\": \"В крепость Пандемония\",\n";
-                ss << u8"    \"zhCN\": \"前往混沌要塞\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 867,\n";
-                ss << u8"    \"Key\": \"To The Durance of Hate Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Durance of Hate Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往憎恨囚牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Zum Kerker des Hasses, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 de la Represión del Odio\",\n";
-                ss << u8"    \"frFR\": \"Vers la Prison de la Haine niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per la Prigione dell'Odio L3\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"A la Prisión de Odio Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"憎悪の檻: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Cárcere do Ódio Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень Узилища Ненависти\",\n";
-                ss << u8"    \"zhCN\": \"前往憎恨囚牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 868,\n";
-                ss << u8"    \"Key\": \"To The Durance of Hate Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Durance of Hate Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往憎恨囚牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Kerker des Hasses, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 de la Represión del Odio\",\n";
-                ss << u8"    \"frFR\": \"Vers la Prison de la Haine niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per la Prigione dell'Odio L2\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"A la Prisión de Odio Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"憎悪の檻: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Cárcere do Ódio Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень Узилища Ненависти\",\n";
-                ss << u8"    \"zhCN\": \"前往憎恨囚牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 869,\n";
-                ss << u8"    \"Key\": \"To The Durance of Hate Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Durance of Hate Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往憎恨囚牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Kerker des Hasses, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 de la Represión del Odio\",\n";
-                ss << u8"    \"frFR\": \"Vers la Prison de la Haine niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per la Prigione dell'Odio L1\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"A la Prisión de Odio Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"憎悪の檻: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Cárcere do Ódio Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень Узилища Ненависти\",\n";
-                ss << u8"    \"zhCN\": \"前往憎恨囚牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 870,\n";
-                ss << u8"    \"Key\": \"To The Disused Reliquary\",\n";
-                ss << u8"    \"enUS\": \"To The Disused Reliquary\",\n";
-                ss << u8"    \"zhTW\": \"前往廢棄的聖殿\",\n";
-                ss << u8"    \"deDE\": \"Zum verlassenen Reliquienschrein\",\n";
-                ss << u8"    \"esES\": \"Al Relicario Abandonado\",\n";
-                ss << u8"    \"frFR\": \"Vers le Reliquaire abandonné\",\n";
-                ss << u8"    \"itIT\": \"Per il Reliquiario Abbandonato\",\n";
-                ss << u8"    \"koKR\": \"버려진 성물실로 이동\",\n";
-                ss << u8"    \"plPL\": \"Opuszczony Relikwiarz\",\n";
-                ss << u8"    \"esMX\": \"Al Relicario Abandonado\",\n";
-                ss << u8"    \"jaJP\": \"打ち捨てられし聖廟へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Relicário Abandonado\",\n";
-                ss << u8"    \"ruRU\": \"В заброшенный реликварий\",\n";
-                ss << u8"    \"zhCN\": \"前往废弃的藏骨室\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 871,\n";
-                ss << u8"    \"Key\": \"To The Ruined Fane\",\n";
-                ss << u8"    \"enUS\": \"To The Ruined Fane\",\n";
-                ss << u8"    \"zhTW\": \"前往荒廢的寺院\",\n";
-                ss << u8"    \"deDE\": \"Zum zerfallenen Heiligtum\",\n";
-                ss << u8"    \"esES\": \"Al Fano en Ruinas\",\n";
-                ss << u8"    \"frFR\": \"Vers le Sanctuaire en ruine\",\n";
-                ss << u8"    \"itIT\": \"Per il Tempio Antico\",\n";
-                ss << u8"    \"koKR\": \"허물어진 교회당으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zrujnowana Kaplica\",\n";
-                ss << u8"    \"esMX\": \"Al Santuario Destruido\",\n";
-                ss << u8"    \"jaJP\": \"荒れ果てた神殿へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Ádito Arruinado\",\n";
-                ss << u8"    \"ruRU\": \"В разрушенную церковь\",\n";
-                ss << u8"    \"zhCN\": \"前往被毁的礼拜堂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 872,\n";
-                ss << u8"    \"Key\": \"To The Forgotten Temple\",\n";
-                ss << u8"    \"enUS\": \"To The Forgotten Temple\",\n";
-                ss << u8"    \"zhTW\": \"前往遺忘神殿\",\n";
-                ss << u8"    \"deDE\": \"Zum vergessenen Tempel\",\n";
-                ss << u8"    \"esES\": \"Al Templo Olvidado\",\n";
-                ss << u8"    \"frFR\": \"Vers le Temple oublié\",\n";
-                ss << u8"    \"itIT\": \"Per il Tempio Dimenticato\",\n";
-                ss << u8"    \"koKR\": \"잊힌 사원으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zapomniana Świątynia\",\n";
-                ss << u8"    \"esMX\": \"Al Templo Olvidado\",\n";
-                ss << u8"    \"jaJP\": \"忘れ去られし寺院へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Templo Esquecido\",\n";
-                ss << u8"    \"ruRU\": \"В забытый храм\",\n";
-                ss << u8"    \"zhCN\": \"前往被遗忘的神殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 873,\n";
-                ss << u8"    \"Key\": \"To The Forgotten Reliquary\",\n";
-                ss << u8"    \"enUS\": \"To The Forgotten Reliquary\",\n";
-                ss << u8"    \"zhTW\": \"前往遺忘的聖殿\",\n";
-                ss << u8"    \"deDE\": \"Zum vergessenen Reliquienschrein\",\n";
-                ss << u8"    \"esES\": \"Al Relicario Olvidado\",\n";
-                ss << u8"    \"frFR\": \"Vers le Reliquaire oublié\",\n";
-                ss << u8"    \"itIT\": \"Per il Reliquiario Dimenticato\",\n";
-                ss << u8"    \"koKR\": \"잊힌 성물실로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zapomniany Relikwiarz\",\n";
-                ss << u8"    \"esMX\": \"Al Relicario Olvidado\",\n";
-                ss << u8"    \"jaJP\": \"忘れ去られし聖廟へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Relicário Esquecido\",\n";
-                ss << u8"    \"ruRU\": \"В забытый реликварий\",\n";
-                ss << u8"    \"zhCN\": \"前往被遗忘的藏骨室\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 874,\n";
-                ss << u8"    \"Key\": \"To The Disused Fane\",\n";
-                ss << u8"    \"enUS\": \"To The Disused Fane\",\n";
-                ss << u8"    \"zhTW\": \"前往廢棄的寺院\",\n";
-                ss << u8"    \"deDE\": \"Zum verlassenen Heiligtum\",\n";
-                ss << u8"    \"esES\": \"Al Fano Abandonado\",\n";
-                ss << u8"    \"frFR\": \"Vers le Sanctuaire abandonné\",\n";
-                ss << u8"    \"itIT\": \"Per il Tempio Abbandonato\",\n";
-                ss << u8"    \"koKR\": \"버려진 교회당으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Opuszczona Kaplica\",\n";
-                ss << u8"    \"esMX\": \"Al Santuario Abandonado\",\n";
-                ss << u8"    \"jaJP\": \"打ち捨てられし神殿へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Ádito Abandonado\",\n";
-                ss << u8"    \"ruRU\": \"В заброшенную церковь\",\n";
-                ss << u8"    \"zhCN\": \"前往废弃的礼拜堂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 875,\n";
-                ss << u8"    \"Key\": \"To The Ruined Temple\",\n";
-                ss << u8"    \"enUS\": \"To The Ruined Temple\",\n";
-                ss << u8"    \"zhTW\": \"前往荒廢的神殿\",\n";
-                ss << u8"    \"deDE\": \"Zum zerfallenen Tempel\",\n";
-                ss << u8"    \"esES\": \"Al Templo en Ruinas\",\n";
-                ss << u8"    \"frFR\": \"Vers le Temple en ruine\",\n";
-                ss << u8"    \"itIT\": \"Per il Tempio in Rovina\",\n";
-                ss << u8"    \"koKR\": \"허물어진 사원으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zrujnowana Świątynia\",\n";
-                ss << u8"    \"esMX\": \"Al Templo Destruido\",\n";
-                ss << u8"    \"jaJP\": \"荒れ果てた寺院へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Templo Arruinado\",\n";
-                ss << u8"    \"ruRU\": \"В разрушенный храм\",\n";
-                ss << u8"    \"zhCN\": \"前往毁灭的神庙\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 876,\n";
-                ss << u8"    \"Key\": \"To The Flayer Dungeon Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Flayer Dungeon Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往剝皮地牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Schinderdungeon, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 de la Mazmorra de Desollamiento\",\n";
-                ss << u8"    \"frFR\": \"Vers la Prison de l’Écorcheur niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per il Sotterraneo Scorticatore L1\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Al Calabozo de los Desolladores Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの地下牢: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Masmorra dos Esfoladores Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень Подземелья свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"前往剥皮魔监牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 877,\n";
-                ss << u8"    \"Key\": \"To The Flayer Dungeon Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Flayer Dungeon Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往剝皮地牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Schinderdungeon, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 de la Mazmorra de Desollamiento\",\n";
-                ss << u8"    \"frFR\": \"Vers la Prison de l’Écorcheur niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per il Sotterraneo Scorticatore L2\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Al Calabozo de los Desolladores Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの地下牢: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Masmorra dos Esfoladores Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень Подземелья свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"前往剥皮魔监牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 878,\n";
-                ss << u8"    \"Key\": \"To The Flayer Dungeon Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Flayer Dungeon Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往剝皮地牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Zum Schinderdungeon, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 de la Mazmorra de Desollamiento\",\n";
-                ss << u8"    \"frFR\": \"Ver la Prison de l’Écorcheur niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per il Sotterraneo Scorticatore L3\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Al Calabozo de los Desolladores Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの地下牢: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Masmorra dos Esfoladores Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень Подземелья свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"前往剥皮魔监牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 879,\n";
-                ss << u8"    \"Key\": \"To The Swampy Pit Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Swampy Pit Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往沼澤地穴第三層\",\n";
-                ss << u8"    \"deDE\": \"Zum Sumpfloch, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 del Foso Pantanoso\",\n";
-                ss << u8"    \"frFR\": \"Vers le Bourbier niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per l'Abisso Paludoso L3\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Bagienna Czeluść – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Al Foso Pantanoso Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"沼地の穴ぐら: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Fosso Pantanoso Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень Глубокой трясины\",\n";
-                ss << u8"    \"zhCN\": \"前往沼泽陷坑三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 880,\n";
-                ss << u8"    \"Key\": \"To The Swampy Pit Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Swampy Pit Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往沼澤地穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Sumpfloch, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 del Foso Pantanoso\",\n";
-                ss << u8"    \"frFR\": \"Vers le Bourbier niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per l'Abisso Paludoso L2\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Bagienna Czeluść – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Al Foso Pantanoso Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"沼地の穴ぐら: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Fosso Pantanoso Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень Глубокой трясины\",\n";
-                ss << u8"    \"zhCN\": \"前往沼泽陷坑二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 881,\n";
-                ss << u8"    \"Key\": \"To The Swampy Pit Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Swampy Pit Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往沼澤地穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Sumpfloch, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 del Foso Pantanoso\",\n";
-                ss << u8"    \"frFR\": \"Vers le Bourbier niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per l'Abisso Paludoso L1\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Bagienna Czeluść – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Al Foso Pantanoso Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"沼地の穴ぐら: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Fosso Pantanoso Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень Глубокой трясины\",\n";
-                ss << u8"    \"zhCN\": \"前往沼泽陷坑一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 882,\n";
-                ss << u8"    \"Key\": \"To The Spider Cave\",\n";
-                ss << u8"    \"enUS\": \"To The Arachnid Lair\",\n";
-                ss << u8"    \"zhTW\": \"前往蜘蛛巢穴\",\n";
-                ss << u8"    \"deDE\": \"Zur Spinnenmonstergruft\",\n";
-                ss << u8"    \"esES\": \"Al Cubil Arácnido\",\n";
-                ss << u8"    \"frFR\": \"Vers le Repaire de l’Arachnide\",\n";
-                ss << u8"    \"itIT\": \"Per il Covo degli Aracnidi\",\n";
-                ss << u8"    \"koKR\": \"독거미 둥지로 이동\",\n";
-                ss << u8"    \"plPL\": \"Legowisko Arachnidów\",\n";
-                ss << u8"    \"esMX\": \"A la Guarida Arácnida\",\n";
-                ss << u8"    \"jaJP\": \"蜘蛛の巣穴へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Covil Aracnídeo\",\n";
-                ss << u8"    \"ruRU\": \"В логово арахнидов\",\n";
-                ss << u8"    \"zhCN\": \"前往巨蛛巢穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 883,\n";
-                ss << u8"    \"Key\": \"To The Spider Cavern\",\n";
-                ss << u8"    \"enUS\": \"To The Spider Cavern\",\n";
-                ss << u8"    \"zhTW\": \"前往蜘蛛洞窟\",\n";
-                ss << u8"    \"deDE\": \"Zur Spinnenhöhle\",\n";
-                ss << u8"    \"esES\": \"A la Caverna de Arañas\",\n";
-                ss << u8"    \"frFR\": \"Vers la Caverne de l’Araignée\",\n";
-                ss << u8"    \"itIT\": \"Per la Caverna del Ragno\",\n";
-                ss << u8"    \"koKR\": \"거미 동굴로 이동\",\n";
-                ss << u8"    \"plPL\": \"Grota Pająków\",\n";
-                ss << u8"    \"esMX\": \"A la Caverna de Arañas\",\n";
-                ss << u8"    \"jaJP\": \"蜘蛛の洞窟へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Caverna Aracnídea\",\n";
-                ss << u8"    \"ruRU\": \"В Паучью пещеру\",\n";
-                ss << u8"    \"zhCN\": \"前往蜘蛛洞穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 884,\n";
-                ss << u8"    \"Key\": \"To Travincal\",\n";
-                ss << u8"    \"enUS\": \"To Travincal\",\n";
-                ss << u8"    \"zhTW\": \"前往崔凡克\",\n";
-                ss << u8"    \"deDE\": \"Nach Travincal\",\n";
-                ss << u8"    \"esES\": \"A Travincal\",\n";
-                ss << u8"    \"frFR\": \"Vers Travincal\",\n";
-                ss << u8"    \"itIT\": \"Per Travincal\",\n";
-                ss << u8"    \"koKR\": \"트라빈칼로 이동\",\n";
-                ss << u8"    \"plPL\": \"Travincal\",\n";
-                ss << u8"    \"esMX\": \"A Travincal\",\n";
-                ss << u8"    \"jaJP\": \"トラヴィンカルへ\",\n";
-                ss << u8"    \"ptBR\": \"Para Travincal\",\n";
-                ss << u8"    \"ruRU\": \"В Травинкаль\",\n";
-                ss << u8"    \"zhCN\": \"前往崔凡克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 885,\n";
-                ss << u8"    \"Key\": \"To The Kurast Causeway\",\n";
-                ss << u8"    \"enUS\": \"To The Kurast Causeway\",\n";
-                ss << u8"    \"zhTW\": \"前往庫拉斯特堤道\",\n";
-                ss << u8"    \"deDE\": \"Zum Damm von Kurast\",\n";
-                ss << u8"    \"esES\": \"A la Calzada de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Vers la Chaussée de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Per la Strada di Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 둑길로 이동\",\n";
-                ss << u8"    \"plPL\": \"Grobla Kurast\",\n";
-                ss << u8"    \"esMX\": \"A la Calzada de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト舗道へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Passagem de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"На Курастскую дамбу\",\n";
-                ss << u8"    \"zhCN\": \"前往库拉斯特堤道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 886,\n";
-                ss << u8"    \"Key\": \"To Upper Kurast\",\n";
-                ss << u8"    \"enUS\": \"To Upper Kurast\",\n";
-                ss << u8"    \"zhTW\": \"前往庫拉斯特上層\",\n";
-                ss << u8"    \"deDE\": \"Nach Oberkurast\",\n";
-                ss << u8"    \"esES\": \"A la Parte Alta de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Vers Kurast - La ville haute\",\n";
-                ss << u8"    \"itIT\": \"Per Kurast Superiore\",\n";
-                ss << u8"    \"koKR\": \"상부 쿠라스트로 이동\",\n";
-                ss << u8"    \"plPL\": \"Górne Kurast\",\n";
-                ss << u8"    \"esMX\": \"A Alta Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト上層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para Kurast Superior\",\n";
-                ss << u8"    \"ruRU\": \"В Верхний Кураст\",\n";
-                ss << u8"    \"zhCN\": \"前往库拉斯特上层区\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 887,\n";
-                ss << u8"    \"Key\": \"To The Kurast Bazaar\",\n";
-                ss << u8"    \"enUS\": \"To The Kurast Bazaar\",\n";
-                ss << u8"    \"zhTW\": \"前往庫拉斯特市集\",\n";
-                ss << u8"    \"deDE\": \"Zum Basar von Kurast\",\n";
-                ss << u8"    \"esES\": \"Al Bazar de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Vers le Bazar de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Per il Bazar di Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 시장으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Bazar Kurast\",\n";
-                ss << u8"    \"esMX\": \"Al Bazar de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト・バザールへ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Bazar de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"На Курастский базар\",\n";
-                ss << u8"    \"zhCN\": \"前往库拉斯特集市\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 888,\n";
-                ss << u8"    \"Key\": \"To Lower Kurast\",\n";
-                ss << u8"    \"enUS\": \"To Lower Kurast\",\n";
-                ss << u8"    \"zhTW\": \"前往庫拉斯特下層\",\n";
-                ss << u8"    \"deDE\": \"Nach Unterkurast\",\n";
-                ss << u8"    \"esES\": \"A la Parte Baja de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Vers Kurast - La ville basse\",\n";
-                ss << u8"    \"itIT\": \"Per Kurast Inferiore\",\n";
-                ss << u8"    \"koKR\": \"하부 쿠라스트로 이동\",\n";
-                ss << u8"    \"plPL\": \"Dolne Kurast\",\n";
-                ss << u8"    \"esMX\": \"A Baja Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト下層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para Kurast Inferior\",\n";
-                ss << u8"    \"ruRU\": \"В Нижний Кураст\",\n";
-                ss << u8"    \"zhCN\": \"前往库拉斯特下层区\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 889,\n";
-                ss << u8"    \"Key\": \"To The Flayer Jungle\",\n";
-                ss << u8"    \"enUS\": \"To The Flayer Jungle\",\n";
-                ss << u8"    \"zhTW\": \"前往剝皮叢林\",\n";
-                ss << u8"    \"deDE\": \"Zum Schinderdschungel\",\n";
-                ss << u8"    \"esES\": \"A la Selva Desolladora\",\n";
-                ss << u8"    \"frFR\": \"Vers la Jungle de l’Écorcheur\",\n";
-                ss << u8"    \"itIT\": \"Per la Giungla Scorticatrice\",\n";
-                ss << u8"    \"koKR\": \"약탈자 밀림으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Dżungla Łupieżców\",\n";
-                ss << u8"    \"esMX\": \"A la Jungla de los Desolladores\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの密林へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Selva dos Esfoladores\",\n";
-                ss << u8"    \"ruRU\": \"В Джунгли свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"前往剥皮魔丛林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 890,\n";
-                ss << u8"    \"Key\": \"To The Great Marsh\",\n";
-                ss << u8"    \"enUS\": \"To The Great Marsh\",\n";
-                ss << u8"    \"zhTW\": \"前往大沼澤\",\n";
-                ss << u8"    \"deDE\": \"Zum großen Moor\",\n";
-                ss << u8"    \"esES\": \"Al Gran Pantano\",\n";
-                ss << u8"    \"frFR\": \"Vers le Grand marais\",\n";
-                ss << u8"    \"itIT\": \"Per la Grande Palude\",\n";
-                ss << u8"    \"koKR\": \"거대 습지로 이동\",\n";
-                ss << u8"    \"plPL\": \"Wielkie Moczary\",\n";
-                ss << u8"    \"esMX\": \"A la Gran Marisma\",\n";
-                ss << u8"    \"jaJP\": \"大湿原へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Grande Charco\",\n";
-                ss << u8"    \"ruRU\": \"В Болотину\",\n";
-                ss << u8"    \"zhCN\": \"前往庞大湿地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 891,\n";
-                ss << u8"    \"Key\": \"To The Spider Forest\",\n";
-                ss << u8"    \"enUS\": \"To The Spider Forest\",\n";
-                ss << u8"    \"zhTW\": \"前往蜘蛛森林\",\n";
-                ss << u8"    \"deDE\": \"Zum Spinnenwald\",\n";
-                ss << u8"    \"esES\": \"Al Bosque de Arañas\",\n";
-                ss << u8"    \"frFR\": \"Vers la Forêt de l’Araignée\",\n";
-                ss << u8"    \"itIT\": \"Per la Foresta del Ragno\",\n";
-                ss << u8"    \"koKR\": \"거미 숲으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Las Pająków\",\n";
-                ss << u8"    \"esMX\": \"Al Bosque de Arañas\",\n";
-                ss << u8"    \"jaJP\": \"蜘蛛の森へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Floresta Aracnídea\",\n";
-                ss << u8"    \"ruRU\": \"В Паучий лес\",\n";
-                ss << u8"    \"zhCN\": \"前往蜘蛛森林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 892,\n";
-                ss << u8"    \"Key\": \"To The Kurast Docktown\",\n";
-                ss << u8"    \"enUS\": \"To The Kurast Docks\",\n";
-                ss << u8"    \"zhTW\": \"前往庫拉斯特港口\",\n";
-                ss << u8"    \"deDE\": \"Zu den Docks von Kurast\",\n";
-                ss << u8"    \"esES\": \"A los Muelles de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Vers les Quais de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Per la Zona Portuale di Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 부두로 이동\",\n";
-                ss << u8"    \"plPL\": \"Doki Kurast\",\n";
-                ss << u8"    \"esMX\": \"A los Muelles de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラスト港へ\",\n";
-                ss << u8"    \"ptBR\": \"Para as Docas de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"В доки Кураста\",\n";
-                ss << u8"    \"zhCN\": \"前往库拉斯特海港\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 893,\n";
-                ss << u8"    \"Key\": \"To The Arcane Sanctuary\",\n";
-                ss << u8"    \"enUS\": \"To The Arcane Sanctuary\",\n";
-                ss << u8"    \"zhTW\": \"前往秘法聖殿\",\n";
-                ss << u8"    \"deDE\": \"Zur geheimen Zuflucht\",\n";
-                ss << u8"    \"esES\": \"Al Santuario Arcano\",\n";
-                ss << u8"    \"frFR\": \"Vers le Sanctuaire des Arcanes\",\n";
-                ss << u8"    \"itIT\": \"Per il Santuario Arcano\",\n";
-                ss << u8"    \"koKR\": \"비전의 성역으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Tajemne Sanktuarium\",\n";
-                ss << u8"    \"esMX\": \"Al Santuario Arcano\",\n";
-                ss << u8"    \"jaJP\": \"深遠なる聖域へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Santuário Arcano\",\n";
-                ss << u8"    \"ruRU\": \"В Магическое убежище\",\n";
-                ss << u8"    \"zhCN\": \"前往神秘避难所\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 894,\n";
-                ss << u8"    \"Key\": \"To Duriel's Lair\",\n";
-                ss << u8"    \"enUS\": \"To Tal Rasha's Chamber\",\n";
-                ss << u8"    \"zhTW\": \"前往塔拉夏的密室\",\n";
-                ss << u8"    \"deDE\": \"Zu Tal Rashas Kammer\",\n";
-                ss << u8"    \"esES\": \"A la Cámara de Tal Rasha\",\n";
-                ss << u8"    \"frFR\": \"Vers la Chambre de Tal Rasha\",\n";
-                ss << u8"    \"itIT\": \"Per la Cripta di Tal Rasha\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 방으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Komnata Tal Rashy\",\n";
-                ss << u8"    \"esMX\": \"A la Cámara de Tal Rasha\",\n";
-                ss << u8"    \"jaJP\": \"タル・ラシャの間へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Câmara de Tal Rasha\",\n";
-                ss << u8"    \"ruRU\": \"В погребальный зал Тал Раши\",\n";
-                ss << u8"    \"zhCN\": \"前往塔·拉夏的墓室\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 895,\n";
-                ss << u8"    \"Key\": \"To Tal Rasha's Tomb\",\n";
-                ss << u8"    \"enUS\": \"To Tal Rasha's Tomb\",\n";
-                ss << u8"    \"zhTW\": \"前往塔拉夏的古墓\",\n";
-                ss << u8"    \"deDE\": \"Zu Tal Rashas Grab\",\n";
-                ss << u8"    \"esES\": \"A la Tumba de Tal Rasha\",\n";
-                ss << u8"    \"frFR\": \"Vers le Tombeau de Tal Rasha\",\n";
-                ss << u8"    \"itIT\": \"Per la Tomba di Tal Rasha\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 무덤으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Grobowiec Tal Rashy\",\n";
-                ss << u8"    \"esMX\": \"A la Tumba de Tal Rasha\",\n";
-                ss << u8"    \"jaJP\": \"タル・ラシャの墓へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Tumba de Tal Rasha\",\n";
-                ss << u8"    \"ruRU\": \"В гробницу Тал Раши\",\n";
-                ss << u8"    \"zhCN\": \"前往塔·拉夏之墓\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 896,\n";
-                ss << u8"    \"Key\": \"To The Ancient Tunnels\",\n";
-                ss << u8"    \"enUS\": \"To The Ancient Tunnels\",\n";
-                ss << u8"    \"zhTW\": \"前往古代通道\",\n";
-                ss << u8"    \"deDE\": \"Zu den alten Tunnels\",\n";
-                ss << u8"    \"esES\": \"A los Túneles Antiguos\",\n";
-                ss << u8"    \"frFR\": \"Vers les Tunnels antiques\",\n";
-                ss << u8"    \"itIT\": \"Per gli Antichi Tunnel\",\n";
-                ss << u8"    \"koKR\": \"고대 토굴로 이동\",\n";
-                ss << u8"    \"plPL\": \"Prastare Tunele\",\n";
-                ss << u8"    \"esMX\": \"A los Túneles Antiguos\",\n";
-                ss << u8"    \"jaJP\": \"古の坑道へ\",\n";
-                ss << u8"    \"ptBR\": \"Para os Túneis Ancestrais\",\n";
-                ss << u8"    \"ruRU\": \"В древние туннели\",\n";
-                ss << u8"    \"zhCN\": \"前往古代水道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 897,\n";
-                ss << u8"    \"Key\": \"To The Maggot Lair Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Maggot Lair Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往蛆蟲巢穴第三層\",\n";
-                ss << u8"    \"deDE\": \"Zur Wurmgruft, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 del Cubil de Gusanos\",\n";
-                ss << u8"    \"frFR\": \"Vers le Repaire du ver niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per il Covo delle Larve L3\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Robacze Gniazdo – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"A la Guarida de Gusanos Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"地虫の巣穴: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Covil de Vermes Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень логова мокриц\",\n";
-                ss << u8"    \"zhCN\": \"前往蛆虫巢穴三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 898,\n";
-                ss << u8"    \"Key\": \"To The Maggot Lair Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Maggot Lair Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往蛆蟲巢穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Zur Wurmgruft, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 del Cubil de Gusanos\",\n";
-                ss << u8"    \"frFR\": \"Vers le Repaire du ver niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per il Covo delle Larve L2\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Robacze Gniazdo – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"A la Guarida de Gusanos Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"地虫の巣穴: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Covil de Vermes Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень логова мокриц\",\n";
-                ss << u8"    \"zhCN\": \"前往蛆虫巢穴二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 899,\n";
-                ss << u8"    \"Key\": \"To The Maggot Lair Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Maggot Lair Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往蛆蟲巢穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Zur Wurmgruft, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 del Cubil de Gusanos\",\n";
-                ss << u8"    \"frFR\": \"Vers le Repaire du ver niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per il Covo delle Larve L1\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Robacze Gniazdo – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"A la Guarida de Gusanos Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"地虫の巣穴: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Covil de Vermes Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень логова мокриц\",\n";
-                ss << u8"    \"zhCN\": \"前往蛆虫巢穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 900,\n";
-                ss << u8"    \"Key\": \"To The Claw Viper Temple Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Claw Viper Temple Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往利爪蛇魔神殿第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Tempel der Klauenvipern, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 del Templo de la Garra Viperina\",\n";
-                ss << u8"    \"frFR\": \"Vers le Temple des Vipères niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per il Tempio delle Vipere L2\",\n";
-                ss << u8"    \"koKR\": \"발톱 독사 사원 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Świątynia Żmijoszponów – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Al Templo del Vipérido de Garras Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Templo da Víbora da Garra Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень храма Когтистого Змея\",\n";
-                ss << u8"    \"zhCN\": \"前往利爪蝮蛇神殿二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 901,\n";
-                ss << u8"    \"Key\": \"To The Halls of the Dead Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Halls of the Dead Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往死亡之殿第三層\",\n";
-                ss << u8"    \"deDE\": \"Zu den Hallen der Toten, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 de las Salas de la Muerte\",\n";
-                ss << u8"    \"frFR\": \"Vers les Couloirs des morts niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per le Sale dei Morti L3\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Sale Umarłych – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"A las Salas de la Muerte Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"亡者の広間: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para os Salões dos Mortos Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень Чертогов Мертвых\",\n";
-                ss << u8"    \"zhCN\": \"前往亡者大殿三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 902,\n";
-                ss << u8"    \"Key\": \"To The Stony Tomb Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Stony Tomb Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往古老石墓第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Steingrab, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 de la Tumba Pedregosa\",\n";
-                ss << u8"    \"frFR\": \"Vers le Tombeau de pierre niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per la Tomba di Pietra L2\",\n";
-                ss << u8"    \"koKR\": \"바위 무덤 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kamienny Grobowiec – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"A la Tumba Pedregosa Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"石造りの墓所: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Tumba Pétrea Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень каменной гробницы\",\n";
-                ss << u8"    \"zhCN\": \"前往碎石古墓二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 903,\n";
-                ss << u8"    \"Key\": \"To The Claw Viper Temple Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Claw Viper Temple Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往利爪蛇魔神殿第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Tempel der Klauenvipern, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 del Templo de la Garra Viperina\",\n";
-                ss << u8"    \"frFR\": \"Vers le Temple des Vipères niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per il Tempio delle Vipere L1\",\n";
-                ss << u8"    \"koKR\": \"발톱 독사 사원 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Świątynia Żmijoszponów – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Al Templo del Vipérido de Garras Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Templo da Víbora da Garra Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень храма Когтистого Змея\",\n";
-                ss << u8"    \"zhCN\": \"前往利爪蝮蛇神殿一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 904,\n";
-                ss << u8"    \"Key\": \"To The Halls of the Dead Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Halls of the Dead Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往死亡之殿第二層\",\n";
-                ss << u8"    \"deDE\": \"Zu den Hallen der Toten, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 de las Salas de la Muerte\",\n";
-                ss << u8"    \"frFR\": \"Vers les Couloirs des morts niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per le Sale dei Morti L2\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Sale Umarłych – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"A las Salas de la Muerte Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"亡者の広間: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para os Salões dos Mortos Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень Чертогов Мертвых\",\n";
-                ss << u8"    \"zhCN\": \"前往亡者大殿二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 905,\n";
-                ss << u8"    \"Key\": \"To The Halls of the Dead Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Halls of the Dead Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往死亡之殿第一層\",\n";
-                ss << u8"    \"deDE\": \"Zu den Hallen der Toten, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 de las Salas de la Muerte\",\n";
-                ss << u8"    \"frFR\": \"Vers les Couloirs des morts niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per le Sale dei Morti L1\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Sale Umarłych – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"A las Salas de la Muerte Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"亡者の広間: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para os Salões dos Mortos Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень Чертогов Мертвых\",\n";
-                ss << u8"    \"zhCN\": \"前往亡者大殿一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 906,\n";
-                ss << u8"    \"Key\": \"To The Stony Tomb Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Stony Tomb Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往古老石墓第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Steingrab, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 de la Tumba Pedregosa\",\n";
-                ss << u8"    \"frFR\": \"Vers le Tombeau de pierre niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per la Tomba di Pietra L1\",\n";
-                ss << u8"    \"koKR\": \"바위 무덤 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kamienny Grobowiec – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"A la Tumba Pedregosa Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"石造りの墓所: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Tumba Pétrea Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень каменной гробницы\",\n";
-                ss << u8"    \"zhCN\": \"前往碎石古墓一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 907,\n";
-                ss << u8"    \"Key\": \"To The Palace Cellar Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Palace Cellar Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往皇宮地窖第三層\",\n";
-                ss << u8"    \"deDE\": \"Zum Palastkeller, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 del Sótano del Palacio\",\n";
-                ss << u8"    \"frFR\": \"Vers les Caves du Palais niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per i Sotterranei del Palazzo L3\",\n";
-                ss << u8"    \"koKR\": \"궁전 지하 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Al Sótano del Palacio Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"宮殿地下室: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Porão do Palácio Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень дворцового погреба\",\n";
-                ss << u8"    \"zhCN\": \"前往王宫监牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 908,\n";
-                ss << u8"    \"Key\": \"To The Palace Cellar Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Palace Cellar Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往皇宮地窖第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Palastkeller, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 del Sótano del Palacio\",\n";
-                ss << u8"    \"frFR\": \"Vers les Caves du Palais niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per i Sotterranei del Palazzo L2\",\n";
-                ss << u8"    \"koKR\": \"궁전 지하 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Al Sótano del Palacio Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"宮殿地下室: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Porão do Palácio Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень дворцового погреба\",\n";
-                ss << u8"    \"zhCN\": \"前往王宫监牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 909,\n";
-                ss << u8"    \"Key\": \"To The Palace Cellar Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Palace Cellar Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往皇宮地窖第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Palastkeller, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 del Sótano del Palacio\",\n";
-                ss << u8"    \"frFR\": \"Vers les Caves du Palais niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per i Sotterranei del Palazzo L1\",\n";
-                ss << u8"    \"koKR\": \"궁전 지하 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Al Sótano del Palacio Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"宮殿地下室: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Porão do Palácio Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень дворцового погреба\",\n";
-                ss << u8"    \"zhCN\": \"前往王宫监牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 910,\n";
-                ss << u8"    \"Key\": \"To The Harem Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Harem Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往後宮第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Harem, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 del Harén\",\n";
-                ss << u8"    \"frFR\": \"Vers le Harem niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per l'Harem L2\",\n";
-                ss << u8"    \"koKR\": \"하렘 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Harem – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Al Harén Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"ハーレム: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Harém Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень гарема\",\n";
-                ss << u8"    \"zhCN\": \"前往女眷住处二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 911,\n";
-                ss << u8"    \"Key\": \"To The Harem Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Harem Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往後宮第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Harem, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 del Harén\",\n";
-                ss << u8"    \"frFR\": \"Vers le Harem niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per l'Harem L1\",\n";
-                ss << u8"    \"koKR\": \"하렘 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Harem – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Al Harén Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"ハーレム: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Harém Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень гарема\",\n";
-                ss << u8"    \"zhCN\": \"前往女眷住处一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 912,\n";
-                ss << u8"    \"Key\": \"To The Sewers Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Sewers Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往下水道第三層\",\n";
-                ss << u8"    \"deDE\": \"Zur Kanalisation, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 de las Cloacas\",\n";
-                ss << u8"    \"frFR\": \"Vers les Égouts niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per le Fogne L3\",\n";
-                ss << u8"    \"koKR\": \"하수도 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kanały – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"A las Cloacas Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"下水道: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Esgoto Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень стоков\",\n";
-                ss << u8"    \"zhCN\": \"前往下水道三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 913,\n";
-                ss << u8"    \"Key\": \"To The Sewers Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Sewers Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往下水道第二層\",\n";
-                ss << u8"    \"deDE\": \"Zur Kanalisation, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 de las Cloacas\",\n";
-                ss << u8"    \"frFR\": \"Vers les Égouts niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per le Fogne L2\",\n";
-                ss << u8"    \"koKR\": \"하수도 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kanały – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"A las Cloacas Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"下水道: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Esgoto Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень стоков\",\n";
-                ss << u8"    \"zhCN\": \"前往下水道二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 914,\n";
-                ss << u8"    \"Key\": \"To The Sewers Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Sewers Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往下水道第一層\",\n";
-                ss << u8"    \"deDE\": \"Zur Kanalisation, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 de las Cloacas\",\n";
-                ss << u8"    \"frFR\": \"Vers les Égouts niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per le Fogne L1\",\n";
-                ss << u8"    \"koKR\": \"하수도 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kanały – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"A las Cloacas Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"下水道: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Esgoto Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень стоков\",\n";
-                ss << u8"    \"zhCN\": \"前往下水道一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 915,\n";
-                ss << u8"    \"Key\": \"To The Canyon of the Magi\",\n";
-                ss << u8"    \"enUS\": \"To The Canyon of the Magi\",\n";
-                ss << u8"    \"zhTW\": \"前往賢者之谷\",\n";
-                ss << u8"    \"deDE\": \"Zur Schlucht der Magier\",\n";
-                ss << u8"    \"esES\": \"Al Cañón de los Magos\",\n";
-                ss << u8"    \"frFR\": \"Vers le Canyon des Mages\",\n";
-                ss << u8"    \"itIT\": \"Per il Canyon dei Maghi\",\n";
-                ss << u8"    \"koKR\": \"신비술사의 협곡으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kanion Magów\",\n";
-                ss << u8"    \"esMX\": \"Al Cañón de los Magos\",\n";
-                ss << u8"    \"jaJP\": \"魔術師の峡谷へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Cânion dos Magi\",\n";
-                ss << u8"    \"ruRU\": \"В Каньон волхвов\",\n";
-                ss << u8"    \"zhCN\": \"前往法师峡谷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 916,\n";
-                ss << u8"    \"Key\": \"To The Valley of Snakes\",\n";
-                ss << u8"    \"enUS\": \"To The Valley of Snakes\",\n";
-                ss << u8"    \"zhTW\": \"前往群蛇峽谷\",\n";
-                ss << u8"    \"deDE\": \"Zum Tal der Schlangen\",\n";
-                ss << u8"    \"esES\": \"Al Valle de las Serpientes\",\n";
-                ss << u8"    \"frFR\": \"Vers la Vallée des serpents\",\n";
-                ss << u8"    \"itIT\": \"Per la Valle dei Serpenti\",\n";
-                ss << u8"    \"koKR\": \"뱀의 골짜기로 이동\",\n";
-                ss << u8"    \"plPL\": \"Dolina Węży\",\n";
-                ss << u8"    \"esMX\": \"Al Valle de las Culebras\",\n";
-                ss << u8"    \"jaJP\": \"蛇の谷へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Vale das Cobras\",\n";
-                ss << u8"    \"ruRU\": \"В Долину змей\",\n";
-                ss << u8"    \"zhCN\": \"前往群蛇峡谷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 917,\n";
-                ss << u8"    \"Key\": \"To The Lost City\",\n";
-                ss << u8"    \"enUS\": \"To The Lost City\",\n";
-                ss << u8"    \"zhTW\": \"前往失落古城\",\n";
-                ss << u8"    \"deDE\": \"Zur vergessenen Stadt\",\n";
-                ss << u8"    \"esES\": \"A la Ciudad Perdida\",\n";
-                ss << u8"    \"frFR\": \"Vers la Ville oubliée\",\n";
-                ss << u8"    \"itIT\": \"Per la Città Perduta\",\n";
-                ss << u8"    \"koKR\": \"잊힌 도시로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zaginione Miasto\",\n";
-                ss << u8"    \"esMX\": \"A la Ciudad Perdida\",\n";
-                ss << u8"    \"jaJP\": \"失われし都へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Cidade Perdida\",\n";
-                ss << u8"    \"ruRU\": \"В затерянный город\",\n";
-                ss << u8"    \"zhCN\": \"前往失落之城\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 918,\n";
-                ss << u8"    \"Key\": \"To The Far Oasis\",\n";
-                ss << u8"    \"enUS\": \"To The Far Oasis\",\n";
-                ss << u8"    \"zhTW\": \"前往遙遠的綠洲\",\n";
-                ss << u8"    \"deDE\": \"Zur fernen Oase\",\n";
-                ss << u8"    \"esES\": \"Al Oasis Lejano\",\n";
-                ss << u8"    \"frFR\": \"Vers l’Oasis lointaine\",\n";
-                ss << u8"    \"itIT\": \"Per l'Oasi Lontana\",\n";
-                ss << u8"    \"koKR\": \"머나먼 오아시스로 이동\",\n";
-                ss << u8"    \"plPL\": \"Daleka Oaza\",\n";
-                ss << u8"    \"esMX\": \"Al Oasis Lejano\",\n";
-                ss << u8"    \"jaJP\": \"遥かなるオアシスへ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Oásis Longínquo\",\n";
-                ss << u8"    \"ruRU\": \"В Дальний оазис\",\n";
-                ss << u8"    \"zhCN\": \"前往偏远绿洲\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 919,\n";
-                ss << u8"    \"Key\": \"To The Dry Hills\",\n";
-                ss << u8"    \"enUS\": \"To The Dry Hills\",\n";
-                ss << u8"    \"zhTW\": \"前往乾土高地\",\n";
-                ss << u8"    \"deDE\": \"Zu den verdorrten Hügeln\",\n";
-                ss << u8"    \"esES\": \"A las Colinas Áridas\",\n";
-                ss << u8"    \"frFR\": \"Vers les Collines arides\",\n";
-                ss << u8"    \"itIT\": \"Per le Colline Aride\",\n";
-                ss << u8"    \"koKR\": \"메마른 언덕으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Suche Wzgórza\",\n";
-                ss << u8"    \"esMX\": \"A las Colinas Áridas\",\n";
-                ss << u8"    \"jaJP\": \"乾きの丘へ\",\n";
-                ss << u8"    \"ptBR\": \"Para as Colinas Áridas\",\n";
-                ss << u8"    \"ruRU\": \"На Иссохшие холмы\",\n";
-                ss << u8"    \"zhCN\": \"前往干燥高地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 920,\n";
-                ss << u8"    \"Key\": \"To The Rocky Waste\",\n";
-                ss << u8"    \"enUS\": \"To The Rocky Waste\",\n";
-                ss << u8"    \"zhTW\": \"前往碎石荒地\",\n";
-                ss << u8"    \"deDE\": \"Zur felsigen Öde\",\n";
-                ss << u8"    \"esES\": \"Al Erial Rocoso\",\n";
-                ss << u8"    \"frFR\": \"Vers le Désert de roche\",\n";
-                ss << u8"    \"itIT\": \"Per la Landa Rocciosa\",\n";
-                ss << u8"    \"koKR\": \"바위투성이 황무지로 이동\",\n";
-                ss << u8"    \"plPL\": \"Skalne Pustkowie\",\n";
-                ss << u8"    \"esMX\": \"A la Estepa Rocosa\",\n";
-                ss << u8"    \"jaJP\": \"岩だらけの荒れ地へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Ermo Rochoso\",\n";
-                ss << u8"    \"ruRU\": \"В Каменистую пустошь\",\n";
-                ss << u8"    \"zhCN\": \"前往碎石荒野\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 921,\n";
-                ss << u8"    \"Key\": \"To Lut Gholein\",\n";
-                ss << u8"    \"enUS\": \"To Lut Gholein\",\n";
-                ss << u8"    \"zhTW\": \"前往魯高因\",\n";
-                ss << u8"    \"deDE\": \"Nach Lut Gholein\",\n";
-                ss << u8"    \"esES\": \"A Lut Gholein\",\n";
-                ss << u8"    \"frFR\": \"Vers Lut Gholein\",\n";
-                ss << u8"    \"itIT\": \"Per Lut Gholein\",\n";
-                ss << u8"    \"koKR\": \"루트 골레인으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Lut Gholein\",\n";
-                ss << u8"    \"esMX\": \"A Lut Gholein\",\n";
-                ss << u8"    \"jaJP\": \"ラット・ゴーレインへ\",\n";
-                ss << u8"    \"ptBR\": \"Para Lut Gholein\",\n";
-                ss << u8"    \"ruRU\": \"В Лут-Голейн\",\n";
-                ss << u8"    \"zhCN\": \"前往鲁·高因\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1640,\n";
-                ss << u8"    \"Key\": \"To Guild 5\",\n";
-                ss << u8"    \"enUS\": \"          \",\n";
-                ss << u8"    \"zhTW\": \"          \",\n";
-                ss << u8"    \"deDE\": \"          \",\n";
-                ss << u8"    \"esES\": \"          \",\n";
-                ss << u8"    \"frFR\": \"          \",\n";
-                ss << u8"    \"itIT\": \"          \",\n";
-                ss << u8"    \"koKR\": \"To Guild 5\",\n";
-                ss << u8"    \"plPL\": \"          \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"          \"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1641,\n";
-                ss << u8"    \"Key\": \"To Guild 4\",\n";
-                ss << u8"    \"enUS\": \"          \",\n";
-                ss << u8"    \"zhTW\": \"          \",\n";
-                ss << u8"    \"deDE\": \"          \",\n";
-                ss << u8"    \"esES\": \"          \",\n";
-                ss << u8"    \"frFR\": \"          \",\n";
-                ss << u8"    \"itIT\": \"          \",\n";
-                ss << u8"    \"koKR\": \"To Guild 4\",\n";
-                ss << u8"    \"plPL\": \"          \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"          \"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1642,\n";
-                ss << u8"    \"Key\": \"To Guild 3\",\n";
-                ss << u8"    \"enUS\": \"          \",\n";
-                ss << u8"    \"zhTW\": \"          \",\n";
-                ss << u8"    \"deDE\": \"          \",\n";
-                ss << u8"    \"esES\": \"          \",\n";
-                ss << u8"    \"frFR\": \"          \",\n";
-                ss << u8"    \"itIT\": \"          \",\n";
-                ss << u8"    \"koKR\": \"To Guild 3\",\n";
-                ss << u8"    \"plPL\": \"          \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"          \"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1643,\n";
-                ss << u8"    \"Key\": \"To Guild 2\",\n";
-                ss << u8"    \"enUS\": \"          \",\n";
-                ss << u8"    \"zhTW\": \"          \",\n";
-                ss << u8"    \"deDE\": \"          \",\n";
-                ss << u8"    \"esES\": \"          \",\n";
-                ss << u8"    \"frFR\": \"          \",\n";
-                ss << u8"    \"itIT\": \"          \",\n";
-                ss << u8"    \"koKR\": \"To Guild 2\",\n";
-                ss << u8"    \"plPL\": \"          \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"          \"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1644,\n";
-                ss << u8"    \"Key\": \"To Guild 1\",\n";
-                ss << u8"    \"enUS\": \"          \",\n";
-                ss << u8"    \"zhTW\": \"          \",\n";
-                ss << u8"    \"deDE\": \"          \",\n";
-                ss << u8"    \"esES\": \"          \",\n";
-                ss << u8"    \"frFR\": \"          \",\n";
-                ss << u8"    \"itIT\": \"          \",\n";
-                ss << u8"    \"koKR\": \"To Guild 1\",\n";
-                ss << u8"    \"plPL\": \"          \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"          \"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4137,\n";
-                ss << u8"    \"Key\": \"act1\",\n";
-                ss << u8"    \"enUS\": \"Act 1\",\n";
-                ss << u8"    \"zhTW\": \"第一章\",\n";
-                ss << u8"    \"deDE\": \"Akt 1\",\n";
-                ss << u8"    \"esES\": \"Acto 1\",\n";
-                ss << u8"    \"frFR\": \"Acte I\",\n";
-                ss << u8"    \"itIT\": \"Atto 1\",\n";
-                ss << u8"    \"koKR\": \"1막\",\n";
-                ss << u8"    \"plPL\": \"Akt I\",\n";
-                ss << u8"    \"esMX\": \"Acto 1\",\n";
-                ss << u8"    \"jaJP\": \"第1章\",\n";
-                ss << u8"    \"ptBR\": \"Ato 1\",\n";
-                ss << u8"    \"ruRU\": \"Акт I\",\n";
-                ss << u8"    \"zhCN\": \"一幕\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4138,\n";
-                ss << u8"    \"Key\": \"act2\",\n";
-                ss << u8"    \"enUS\": \"Act 2\",\n";
-                ss << u8"    \"zhTW\": \"第二章\",\n";
-                ss << u8"    \"deDE\": \"Akt 2\",\n";
-                ss << u8"    \"esES\": \"Acto 2\",\n";
-                ss << u8"    \"frFR\": \"Acte II\",\n";
-                ss << u8"    \"itIT\": \"Atto 2\",\n";
-                ss << u8"    \"koKR\": \"2막\",\n";
-                ss << u8"    \"plPL\": \"Akt II\",\n";
-                ss << u8"    \"esMX\": \"Acto 2\",\n";
-                ss << u8"    \"jaJP\": \"第2章\",\n";
-                ss << u8"    \"ptBR\": \"Ato 2\",\n";
-                ss << u8"    \"ruRU\": \"Акт II \",\n";
-                ss << u8"    \"zhCN\": \"二幕\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4139,\n";
-                ss << u8"    \"Key\": \"act3\",\n";
-                ss << u8"    \"enUS\": \"Act 3\",\n";
-                ss << u8"    \"zhTW\": \"第三章\",\n";
-                ss << u8"    \"deDE\": \"Akt 3\",\n";
-                ss << u8"    \"esES\": \"Acto 3\",\n";
-                ss << u8"    \"frFR\": \"Acte III\",\n";
-                ss << u8"    \"itIT\": \"Atto 3\",\n";
-                ss << u8"    \"koKR\": \"3막\",\n";
-                ss << u8"    \"plPL\": \"Akt III\",\n";
-                ss << u8"    \"esMX\": \"Acto 3\",\n";
-                ss << u8"    \"jaJP\": \"第3章\",\n";
-                ss << u8"    \"ptBR\": \"Ato 3\",\n";
-                ss << u8"    \"ruRU\": \"Акт III\",\n";
-                ss << u8"    \"zhCN\": \"三幕\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4140,\n";
-                ss << u8"    \"Key\": \"act4\",\n";
-                ss << u8"    \"enUS\": \"Act 4\",\n";
-                ss << u8"    \"zhTW\": \"第四章\",\n";
-                ss << u8"    \"deDE\": \"Akt 4\",\n";
-                ss << u8"    \"esES\": \"Acto 4\",\n";
-                ss << u8"    \"frFR\": \"Acte VI\",\n";
-                ss << u8"    \"itIT\": \"Atto 4\",\n";
-                ss << u8"    \"koKR\": \"4막\",\n";
-                ss << u8"    \"plPL\": \"Akt IV\",\n";
-                ss << u8"    \"esMX\": \"Acto 4\",\n";
-                ss << u8"    \"jaJP\": \"第4章\",\n";
-                ss << u8"    \"ptBR\": \"Ato 4\",\n";
-                ss << u8"    \"ruRU\": \"Акт IV\",\n";
-                ss << u8"    \"zhCN\": \"四幕\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 4152,\n";
-                ss << u8"    \"Key\": \"Leave\",\n";
-                ss << u8"    \"enUS\": \"LEAVE\",\n";
-                ss << u8"    \"zhTW\": \"離開\",\n";
-                ss << u8"    \"deDE\": \"ENDE\",\n";
-                ss << u8"    \"esES\": \"IRSE\",\n";
-                ss << u8"    \"frFR\": \"QUITTER\",\n";
-                ss << u8"    \"itIT\": \"LASCIA\",\n";
-                ss << u8"    \"koKR\": \"나가기\",\n";
-                ss << u8"    \"plPL\": \"WYJDŹ\",\n";
-                ss << u8"    \"esMX\": \"ABANDONAR\",\n";
-                ss << u8"    \"jaJP\": \"立ち去る\",\n";
-                ss << u8"    \"ptBR\": \"SAIR\",\n";
-                ss << u8"    \"ruRU\": \"НАЗАД\",\n";
-                ss << u8"    \"zhCN\": \"离开\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5018,\n";
-                ss << u8"    \"Key\": \"Tristram\",\n";
-                ss << u8"    \"enUS\": \"Tristram\",\n";
-                ss << u8"    \"zhTW\": \"崔斯特姆\",\n";
-                ss << u8"    \"deDE\": \"Tristram\",\n";
-                ss << u8"    \"esES\": \"Tristán\",\n";
-                ss << u8"    \"frFR\": \"Tristram\",\n";
-                ss << u8"    \"itIT\": \"Tristram\",\n";
-                ss << u8"    \"koKR\": \"트리스트럼\",\n";
-                ss << u8"    \"plPL\": \"Tristram\",\n";
-                ss << u8"    \"esMX\": \"Tristram\",\n";
-                ss << u8"    \"jaJP\": \"トリストラム\",\n";
-                ss << u8"    \"ptBR\": \"Tristram\",\n";
-                ss << u8"    \"ruRU\": \"Тристрам\",\n";
-                ss << u8"    \"zhCN\": \"崔斯特姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5019,\n";
-                ss << u8"    \"Key\": \"Catacombs Level 4\",\n";
-                ss << u8"    \"enUS\": \"Catacombs Level 4\",\n";
-                ss << u8"    \"zhTW\": \"地下墓穴第四層\",\n";
-                ss << u8"    \"deDE\": \"Katakomben, Ebene 4\",\n";
-                ss << u8"    \"esES\": \"Catacumbas nivel 4\",\n";
-                ss << u8"    \"frFR\": \"Les Catacombes niv. 4\",\n";
-                ss << u8"    \"itIT\": \"Catacombe L4\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 4층\",\n";
-                ss << u8"    \"plPL\": \"Katakumby – Poziom 4\",\n";
-                ss << u8"    \"esMX\": \"Catacumbas Nivel 4\",\n";
-                ss << u8"    \"jaJP\": \"地下墓地: 第4階層\",\n";
-                ss << u8"    \"ptBR\": \"Catacumbas Nível 4\",\n";
-                ss << u8"    \"ruRU\": \"Катакомбы: 4-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"地下墓穴四层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5020,\n";
-                ss << u8"    \"Key\": \"Catacombs Level 3\",\n";
-                ss << u8"    \"enUS\": \"Catacombs Level 3\",\n";
-                ss << u8"    \"zhTW\": \"地下墓穴第三層\",\n";
-                ss << u8"    \"deDE\": \"Katakomben, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Catacumbas nivel 3\",\n";
-                ss << u8"    \"frFR\": \"Les Catacombes niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Catacombe L3\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 3층\",\n";
-                ss << u8"    \"plPL\": \"Katakumby – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Catacumbas Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"地下墓地: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Catacumbas Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Катакомбы: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"地下墓穴三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5021,\n";
-                ss << u8"    \"Key\": \"Catacombs Level 2\",\n";
-                ss << u8"    \"enUS\": \"Catacombs Level 2\",\n";
-                ss << u8"    \"zhTW\": \"地下墓穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Katakomben, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Catacumbas nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Les Catacombes niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Catacombe L2\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 2층\",\n";
-                ss << u8"    \"plPL\": \"Katakumby – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Catacumbas Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"地下墓地: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Catacumbas Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Катакомбы: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"地下墓穴二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5022,\n";
-                ss << u8"    \"Key\": \"Catacombs Level 1\",\n";
-                ss << u8"    \"enUS\": \"Catacombs Level 1\",\n";
-                ss << u8"    \"zhTW\": \"地下墓穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Katakomben, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Catacumbas nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Les Catacombes niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Catacombe L1\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 1층\",\n";
-                ss << u8"    \"plPL\": \"Katakumby – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Catacumbas Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"地下墓地: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Catacumbas Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Катакомбы: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"地下墓穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5023,\n";
-                ss << u8"    \"Key\": \"Cathedral\",\n";
-                ss << u8"    \"enUS\": \"Cathedral\",\n";
-                ss << u8"    \"zhTW\": \"大教堂\",\n";
-                ss << u8"    \"deDE\": \"Kathedrale\",\n";
-                ss << u8"    \"esES\": \"Catedral\",\n";
-                ss << u8"    \"frFR\": \"La Cathédrale\",\n";
-                ss << u8"    \"itIT\": \"Cattedrale\",\n";
-                ss << u8"    \"koKR\": \"대성당\",\n";
-                ss << u8"    \"plPL\": \"Katedra\",\n";
-                ss << u8"    \"esMX\": \"Catedral\",\n";
-                ss << u8"    \"jaJP\": \"大聖堂\",\n";
-                ss << u8"    \"ptBR\": \"Catedral\",\n";
-                ss << u8"    \"ruRU\": \"Собор\",\n";
-                ss << u8"    \"zhCN\": \"大教堂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5024,\n";
-                ss << u8"    \"Key\": \"Inner Cloister\",\n";
-                ss << u8"    \"enUS\": \"Inner Cloister\",\n";
-                ss << u8"    \"zhTW\": \"內側迴廊\",\n";
-                ss << u8"    \"deDE\": \"Inneres Kloster\",\n";
-                ss << u8"    \"esES\": \"Claustro Interior\",\n";
-                ss << u8"    \"frFR\": \"Le Cloître intérieur\",\n";
-                ss << u8"    \"itIT\": \"Chiostro Interno\",\n";
-                ss << u8"    \"koKR\": \"내부 회랑\",\n";
-                ss << u8"    \"plPL\": \"Wewnętrzny Monastyr\",\n";
-                ss << u8"    \"esMX\": \"Claustro Interno\",\n";
-                ss << u8"    \"jaJP\": \"修道院内部\",\n";
-                ss << u8"    \"ptBR\": \"Claustro Interno\",\n";
-                ss << u8"    \"ruRU\": \"Внутренний двор\",\n";
-                ss << u8"    \"zhCN\": \"内侧回廊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5025,\n";
-                ss << u8"    \"Key\": \"Jail Level 3\",\n";
-                ss << u8"    \"enUS\": \"Jail Level 3\",\n";
-                ss << u8"    \"zhTW\": \"監牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Gefängnis, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Cárcel nivel 3\",\n";
-                ss << u8"    \"frFR\": \"La Prison niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Prigione L3\",\n";
-                ss << u8"    \"koKR\": \"감옥 3층\",\n";
-                ss << u8"    \"plPL\": \"Więzienie – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Prisión Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"牢獄: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Prisão Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Тюрьма: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"监牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5026,\n";
-                ss << u8"    \"Key\": \"Jail Level 2\",\n";
-                ss << u8"    \"enUS\": \"Jail Level 2\",\n";
-                ss << u8"    \"zhTW\": \"監牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Gefängnis, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Cárcel nivel 2\",\n";
-                ss << u8"    \"frFR\": \"La Prison niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Prigione L2\",\n";
-                ss << u8"    \"koKR\": \"감옥 2층\",\n";
-                ss << u8"    \"plPL\": \"Więzienie – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Prisión Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"牢獄: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Prisão Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Тюрьма: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"监牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5027,\n";
-                ss << u8"    \"Key\": \"Jail Level 1\",\n";
-                ss << u8"    \"enUS\": \"Jail Level 1\",\n";
-                ss << u8"    \"zhTW\": \"監牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Gefängnis, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Cárcel nivel 1\",\n";
-                ss << u8"    \"frFR\": \"La Prison niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Prigione L1\",\n";
-                ss << u8"    \"koKR\": \"감옥 1층\",\n";
-                ss << u8"    \"plPL\": \"Więzienie – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Prisión Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"牢獄: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Prisão Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Тюрьма: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"监牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5028,\n";
-                ss << u8"    \"Key\": \"Barracks\",\n";
-                ss << u8"    \"enUS\": \"Barracks\",\n";
-                ss << u8"    \"zhTW\": \"兵營\",\n";
-                ss << u8"    \"deDE\": \"Kaserne\",\n";
-                ss << u8"    \"esES\": \"Barracones\",\n";
-                ss << u8"    \"frFR\": \"La Caserne\",\n";
-                ss << u8"    \"itIT\": \"Caserma\",\n";
-                ss << u8"    \"koKR\": \"병영\",\n";
-                ss << u8"    \"plPL\": \"Koszary\",\n";
-                ss << u8"    \"esMX\": \"Cuartel\",\n";
-                ss << u8"    \"jaJP\": \"兵舎\",\n";
-                ss << u8"    \"ptBR\": \"Quartel\",\n";
-                ss << u8"    \"ruRU\": \"Казармы\",\n";
-                ss << u8"    \"zhCN\": \"营房\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5029,\n";
-                ss << u8"    \"Key\": \"Outer Cloister\",\n";
-                ss << u8"    \"enUS\": \"Outer Cloister\",\n";
-                ss << u8"    \"zhTW\": \"外側迴廊\",\n";
-                ss << u8"    \"deDE\": \"Äußeres Kloster\",\n";
-                ss << u8"    \"esES\": \"Claustro Exterior\",\n";
-                ss << u8"    \"frFR\": \"Le Cloître extérieur\",\n";
-                ss << u8"    \"itIT\": \"Chiostro Esterno\",\n";
-                ss << u8"    \"koKR\": \"외부 회랑\",\n";
-                ss << u8"    \"plPL\": \"Zewnętrzny Monastyr\",\n";
-                ss << u8"    \"esMX\": \"Claustro Exterior\",\n";
-                ss << u8"    \"jaJP\": \"修道院外部\",\n";
-                ss << u8"    \"ptBR\": \"Claustro Externo\",\n";
-                ss << u8"    \"ruRU\": \"Внешний двор\",\n";
-                ss << u8"    \"zhCN\": \"外侧回廊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5030,\n";
-                ss << u8"    \"Key\": \"Monastery Gate\",\n";
-                ss << u8"    \"enUS\": \"Monastery Gate\",\n";
-                ss << u8"    \"zhTW\": \"修道院大門\",\n";
-                ss << u8"    \"deDE\": \"Klosterpforte\",\n";
-                ss << u8"    \"esES\": \"Puertas del Monasterio\",\n";
-                ss << u8"    \"frFR\": \"Les Portes du Monastère\",\n";
-                ss << u8"    \"itIT\": \"Atrio del Monastero\",\n";
-                ss << u8"    \"koKR\": \"수도원 정문\",\n";
-                ss << u8"    \"plPL\": \"Klasztorna Brama\",\n";
-                ss << u8"    \"esMX\": \"Entrada del Monasterio\",\n";
-                ss << u8"    \"jaJP\": \"修道院の門\",\n";
-                ss << u8"    \"ptBR\": \"Portão do Monastério\",\n";
-                ss << u8"    \"ruRU\": \"Монастырские ворота\",\n";
-                ss << u8"    \"zhCN\": \"修道院大门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5031,\n";
-                ss << u8"    \"Key\": \"Tower Cellar Level 5\",\n";
-                ss << u8"    \"enUS\": \"Tower Cellar Level 5\",\n";
-                ss << u8"    \"zhTW\": \"高塔地牢第五層\",\n";
-                ss << u8"    \"deDE\": \"Turmkeller, Ebene 5\",\n";
-                ss << u8"    \"esES\": \"Sótano de la Torre nivel 5\",\n";
-                ss << u8"    \"frFR\": \"La Cave de la Tour niv. 5\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo della Torre L5\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 5층\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 5\",\n";
-                ss << u8"    \"esMX\": \"Sótano de la Torre Nivel 5\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第5階層\",\n";
-                ss << u8"    \"ptBR\": \"Porão da Torre Nível 5\",\n";
-                ss << u8"    \"ruRU\": \"Подвал башни: 5-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"高塔地窖五层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5032,\n";
-                ss << u8"    \"Key\": \"Tower Cellar Level 4\",\n";
-                ss << u8"    \"enUS\": \"Tower Cellar Level 4\",\n";
-                ss << u8"    \"zhTW\": \"高塔地牢第四層\",\n";
-                ss << u8"    \"deDE\": \"Turmkeller, Ebene 4\",\n";
-                ss << u8"    \"esES\": \"Sótano de la Torre nivel 4\",\n";
-                ss << u8"    \"frFR\": \"La Cave de la Tour niv. 4\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo della Torre L4\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 4층\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 4\",\n";
-                ss << u8"    \"esMX\": \"Sótano de la Torre Nivel 4\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第4階層\",\n";
-                ss << u8"    \"ptBR\": \"Porão da Torre Nível 4\",\n";
-                ss << u8"    \"ruRU\": \"Подвал башни: 4-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"高塔地窖四层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5033,\n";
-                ss << u8"    \"Key\": \"Tower Cellar Level 3\",\n";
-                ss << u8"    \"enUS\": \"Tower Cellar Level 3\",\n";
-                ss << u8"    \"zhTW\": \"高塔地牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Turmkeller, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Sótano de la Torre nivel 3\",\n";
-                ss << u8"    \"frFR\": \"La Cave de la Tour niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo della Torre L3\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 3층\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Sótano de la Torre Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Porão da Torre Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Подвал башни: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"高塔地窖三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5034,\n";
-                ss << u8"    \"Key\": \"Tower Cellar Level 2\",\n";
-                ss << u8"    \"enUS\": \"Tower Cellar Level 2\",\n";
-                ss << u8"    \"zhTW\": \"高塔地牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Turmkeller, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Sótano de la Torre nivel 2\",\n";
-                ss << u8"    \"frFR\": \"La Cave de la Tour niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo della Torre L2\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 2층\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Sótano de la Torre Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Porão da Torre Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Подвал башни: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"高塔地窖二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5035,\n";
-                ss << u8"    \"Key\": \"Tower Cellar Level 1\",\n";
-                ss << u8"    \"enUS\": \"Tower Cellar Level 1\",\n";
-                ss << u8"    \"zhTW\": \"高塔地牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Turmkeller, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Sótano de la Torre nivel 1\",\n";
-                ss << u8"    \"frFR\": \"La Cave de la Tour niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo della Torre L1\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 1층\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Sótano de la Torre Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Porão da Torre Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Подвал башни: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"高塔地窖一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5036,\n";
-                ss << u8"    \"Key\": \"Forgotten Tower\",\n";
-                ss << u8"    \"enUS\": \"Forgotten Tower\",\n";
-                ss << u8"    \"zhTW\": \"遺忘之塔\",\n";
-                ss << u8"    \"deDE\": \"Vergessener Turm\",\n";
-                ss << u8"    \"esES\": \"Torre Olvidada\",\n";
-                ss << u8"    \"frFR\": \"La Tour oubliée\",\n";
-                ss << u8"    \"itIT\": \"Torre Dimenticata\",\n";
-                ss << u8"    \"koKR\": \"잊힌 탑\",\n";
-                ss << u8"    \"plPL\": \"Zapomniana Wieża\",\n";
-                ss << u8"    \"esMX\": \"Torre Olvidada\",\n";
-                ss << u8"    \"jaJP\": \"忘れ去られし塔\",\n";
-                ss << u8"    \"ptBR\": \"Torre Esquecida\",\n";
-                ss << u8"    \"ruRU\": \"Заброшенная башня\",\n";
-                ss << u8"    \"zhCN\": \"被遗忘的高塔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5037,\n";
-                ss << u8"    \"Key\": \"Mausoleum\",\n";
-                ss << u8"    \"enUS\": \"Mausoleum\",\n";
-                ss << u8"    \"zhTW\": \"大陵墓\",\n";
-                ss << u8"    \"deDE\": \"Mausoleum\",\n";
-                ss << u8"    \"esES\": \"Mausoleo\",\n";
-                ss << u8"    \"frFR\": \"Le Mausolée\",\n";
-                ss << u8"    \"itIT\": \"Mausoleo\",\n";
-                ss << u8"    \"koKR\": \"영묘\",\n";
-                ss << u8"    \"plPL\": \"Mauzoleum\",\n";
-                ss << u8"    \"esMX\": \"Mausoleo\",\n";
-                ss << u8"    \"jaJP\": \"霊廟\",\n";
-                ss << u8"    \"ptBR\": \"Mausoléu\",\n";
-                ss << u8"    \"ruRU\": \"Мавзолей\",\n";
-                ss << u8"    \"zhCN\": \"寝陵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5038,\n";
-                ss << u8"    \"Key\": \"Crypt\",\n";
-                ss << u8"    \"enUS\": \"Crypt\",\n";
-                ss << u8"    \"zhTW\": \"墓地\",\n";
-                ss << u8"    \"deDE\": \"Krypta\",\n";
-                ss << u8"    \"esES\": \"Cripta\",\n";
-                ss << u8"    \"frFR\": \"La Crypte\",\n";
-                ss << u8"    \"itIT\": \"Cripta\",\n";
-                ss << u8"    \"koKR\": \"묘실\",\n";
-                ss << u8"    \"plPL\": \"Krypta\",\n";
-                ss << u8"    \"esMX\": \"Cripta\",\n";
-                ss << u8"    \"jaJP\": \"地下墓所\",\n";
-                ss << u8"    \"ptBR\": \"Cripta\",\n";
-                ss << u8"    \"ruRU\": \"Склеп\",\n";
-                ss << u8"    \"zhCN\": \"墓穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5039,\n";
-                ss << u8"    \"Key\": \"Burial Grounds\",\n";
-                ss << u8"    \"enUS\": \"Burial Grounds\",\n";
-                ss << u8"    \"zhTW\": \"埋骨之地\",\n";
-                ss << u8"    \"deDE\": \"Friedhof\",\n";
-                ss << u8"    \"esES\": \"Cementerio\",\n";
-                ss << u8"    \"frFR\": \"Le Cimetière\",\n";
-                ss << u8"    \"itIT\": \"Cimitero\",\n";
-                ss << u8"    \"koKR\": \"매장지\",\n";
-                ss << u8"    \"plPL\": \"Cmentarz\",\n";
-                ss << u8"    \"esMX\": \"Cementerio\",\n";
-                ss << u8"    \"jaJP\": \"墓地\",\n";
-                ss << u8"    \"ptBR\": \"Cemitério\",\n";
-                ss << u8"    \"ruRU\": \"Погост\",\n";
-                ss << u8"    \"zhCN\": \"埋骨之地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5040,\n";
-                ss << u8"    \"Key\": \"Pit Level 2\",\n";
-                ss << u8"    \"enUS\": \"Pit Level 2\",\n";
-                ss << u8"    \"zhTW\": \"地穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Grube, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Foso nivel 2\",\n";
-                ss << u8"    \"frFR\": \"La Fosse niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Abisso L2\",\n";
-                ss << u8"    \"koKR\": \"구덩이 2층\",\n";
-                ss << u8"    \"plPL\": \"Czeluść – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Foso Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"穴ぐら: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Fosso Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Яма: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"深坑二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5041,\n";
-                ss << u8"    \"Key\": \"Hole Level 2\",\n";
-                ss << u8"    \"enUS\": \"Hole Level 2\",\n";
-                ss << u8"    \"zhTW\": \"地洞第二層\",\n";
-                ss << u8"    \"deDE\": \"Loch, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Hoyo nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Le Gouffre niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Buco L2\",\n";
-                ss << u8"    \"koKR\": \"구렁 2층\",\n";
-                ss << u8"    \"plPL\": \"Jama – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Agujero Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"洞穴: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Buraco Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Нора: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"洞坑二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5042,\n";
-                ss << u8"    \"Key\": \"Underground Passage Level 2\",\n";
-                ss << u8"    \"enUS\": \"Underground Passage Level 2\",\n";
-                ss << u8"    \"zhTW\": \"地底通道第二層\",\n";
-                ss << u8"    \"deDE\": \"Unterirdischer Durchgang, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Pasadizo Subterráneo nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Le Passage souterrain niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Passaggio Sotterraneo L2\",\n";
-                ss << u8"    \"koKR\": \"지하 통로 2층\",\n";
-                ss << u8"    \"plPL\": \"Podziemny Tunel – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Pasaje Subterráneo Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"地下道: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Passagem Subterrânea Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Подземный проход: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"地下通道二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5043,\n";
-                ss << u8"    \"Key\": \"Cave Level 2\",\n";
-                ss << u8"    \"enUS\": \"Cave Level 2\",\n";
-                ss << u8"    \"zhTW\": \"洞穴第二層  洞穴\",\n";
-                ss << u8"    \"deDE\": \"Grotte, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Cueva nivel 2\",\n";
-                ss << u8"    \"frFR\": \"La Grotte niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Caverna L2\",\n";
-                ss << u8"    \"koKR\": \"동굴 2층\",\n";
-                ss << u8"    \"plPL\": \"Jaskinia – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Cueva Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"洞窟: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Caverna Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Пещера: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"洞穴二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5044,\n";
-                ss << u8"    \"Key\": \"Pit Level 1\",\n";
-                ss << u8"    \"enUS\": \"Pit Level 1\",\n";
-                ss << u8"    \"zhTW\": \"地穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Grube, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Foso nivel 1\",\n";
-                ss << u8"    \"frFR\": \"La Fosse niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Abisso L1\",\n";
-                ss << u8"    \"koKR\": \"구덩이 1층\",\n";
-                ss << u8"    \"plPL\": \"Czeluść – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Foso Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"穴ぐら: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Fosso Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Яма: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"深坑一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5045,\n";
-                ss << u8"    \"Key\": \"Hole Level 1\",\n";
-                ss << u8"    \"enUS\": \"Hole Level 1\",\n";
-                ss << u8"    \"zhTW\": \"地洞第一層\",\n";
-                ss << u8"    \"deDE\": \"Loch, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Hoyo nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Le Gouffre niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Buco L1\",\n";
-                ss << u8"    \"koKR\": \"구렁 1층\",\n";
-                ss << u8"    \"plPL\": \"Jama – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Agujero Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"洞穴: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Buraco Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Нора: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"洞坑一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5046,\n";
-                ss << u8"    \"Key\": \"Underground Passage Level 1\",\n";
-                ss << u8"    \"enUS\": \"Underground Passage Level 1\",\n";
-                ss << u8"    \"zhTW\": \"地底通道第一層\",\n";
-                ss << u8"    \"deDE\": \"Unterirdischer Durchgang, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Pasadizo Subterráneo nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Le Passage souterrain niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Passaggio Sotterraneo L1\",\n";
-                ss << u8"    \"koKR\": \"지하 통로 1층\",\n";
-                ss << u8"    \"plPL\": \"Podziemny Tunel – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Pasaje Subterráneo Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"地下道: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Passagem Subterrânea Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Подземный проход: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"地下通道一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5047,\n";
-                ss << u8"    \"Key\": \"Cave Level 1\",\n";
-                ss << u8"    \"enUS\": \"Cave Level 1\",\n";
-                ss << u8"    \"zhTW\": \"洞穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Grotte, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Cueva nivel 1\",\n";
-                ss << u8"    \"frFR\": \"La Grotte niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Caverna L1\",\n";
-                ss << u8"    \"koKR\": \"동굴 1층\",\n";
-                ss << u8"    \"plPL\": \"Jaskinia – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Cueva Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"洞窟: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Caverna Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Пещера: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"洞穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5048,\n";
-                ss << u8"    \"Key\": \"Den of Evil\",\n";
-                ss << u8"    \"enUS\": \"Den of Evil\",\n";
-                ss << u8"    \"zhTW\": \"邪惡洞窟\",\n";
-                ss << u8"    \"deDE\": \"Höhle des Bösen\",\n";
-                ss << u8"    \"esES\": \"Cubil del Mal\",\n";
-                ss << u8"    \"frFR\": \"Le Repaire du Mal\",\n";
-                ss << u8"    \"itIT\": \"Antro del Male\",\n";
-                ss << u8"    \"koKR\": \"악의 소굴\",\n";
-                ss << u8"    \"plPL\": \"Siedlisko Zła\",\n";
-                ss << u8"    \"esMX\": \"Guarida del Mal\",\n";
-                ss << u8"    \"jaJP\": \"邪悪の巣窟\",\n";
-                ss << u8"    \"ptBR\": \"Covil do Mal\",\n";
-                ss << u8"    \"ruRU\": \"Логово зла\",\n";
-                ss << u8"    \"zhCN\": \"邪恶洞穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5049,\n";
-                ss << u8"    \"Key\": \"Tamoe Highland\",\n";
-                ss << u8"    \"enUS\": \"Tamoe Highland\",\n";
-                ss << u8"    \"zhTW\": \"泰摩高地\",\n";
-                ss << u8"    \"deDE\": \"Tamohochland\",\n";
-                ss << u8"    \"esES\": \"Tierras Altas de Tamoe\",\n";
-                ss << u8"    \"frFR\": \"Les Hautes-Terres de Tamoe\",\n";
-                ss << u8"    \"itIT\": \"Altopiano di Tamoe\",\n";
-                ss << u8"    \"koKR\": \"타모 고원\",\n";
-                ss << u8"    \"plPL\": \"Wyżyna Tamoe\",\n";
-                ss << u8"    \"esMX\": \"Tierras Altas de Tamoe\",\n";
-                ss << u8"    \"jaJP\": \"タモエ高原\",\n";
-                ss << u8"    \"ptBR\": \"Planalto Tamoe\",\n";
-                ss << u8"    \"ruRU\": \"Нагорье Тамоэ\",\n";
-                ss << u8"    \"zhCN\": \"泰摩高地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5050,\n";
-                ss << u8"    \"Key\": \"Black Marsh\",\n";
-                ss << u8"    \"enUS\": \"Black Marsh\",\n";
-                ss << u8"    \"zhTW\": \"黑色荒地\",\n";
-                ss << u8"    \"deDE\": \"Schwarzmoor\",\n";
-                ss << u8"    \"esES\": \"Pantano Negro\",\n";
-                ss << u8"    \"frFR\": \"Le Marais sombre\",\n";
-                ss << u8"    \"itIT\": \"Palude Nera\",\n";
-                ss << u8"    \"koKR\": \"검은 습지\",\n";
-                ss << u8"    \"plPL\": \"Czarne Moczary\",\n";
-                ss << u8"    \"esMX\": \"Marisma Oscura\",\n";
-                ss << u8"    \"jaJP\": \"黒の湿原\",\n";
-                ss << u8"    \"ptBR\": \"Charco Tenebroso\",\n";
-                ss << u8"    \"ruRU\": \"Черная топь\",\n";
-                ss << u8"    \"zhCN\": \"黑色沼泽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5051,\n";
-                ss << u8"    \"Key\": \"Dark Wood\",\n";
-                ss << u8"    \"enUS\": \"Dark Wood\",\n";
-                ss << u8"    \"zhTW\": \"黑暗森林\",\n";
-                ss << u8"    \"deDE\": \"Dunkelwald\",\n";
-                ss << u8"    \"esES\": \"Bosque Oscuro\",\n";
-                ss << u8"    \"frFR\": \"Le Bois obscur\",\n";
-                ss << u8"    \"itIT\": \"Foresta Oscura\",\n";
-                ss << u8"    \"koKR\": \"어둠숲\",\n";
-                ss << u8"    \"plPL\": \"Mroczna Knieja\",\n";
-                ss << u8"    \"esMX\": \"Bosque Oscuro\",\n";
-                ss << u8"    \"jaJP\": \"常闇の森\",\n";
-                ss << u8"    \"ptBR\": \"Floresta Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Темнолесье\",\n";
-                ss << u8"    \"zhCN\": \"黑暗森林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5052,\n";
-                ss << u8"    \"Key\": \"Stony Field\",\n";
-                ss << u8"    \"enUS\": \"Stony Field\",\n";
-                ss << u8"    \"zhTW\": \"亂石曠野\",\n";
-                ss << u8"    \"deDE\": \"Feld der Steine\",\n";
-                ss << u8"    \"esES\": \"Campo Pedregoso\",\n";
-                ss << u8"    \"frFR\": \"Le Champ de pierres\",\n";
-                ss << u8"    \"itIT\": \"Campo di Pietra\",\n";
-                ss << u8"    \"koKR\": \"바위 벌판\",\n";
-                ss << u8"    \"plPL\": \"Kamienne Pole\",\n";
-                ss << u8"    \"esMX\": \"Campo Rocoso\",\n";
-                ss << u8"    \"jaJP\": \"石の原野\",\n";
-                ss << u8"    \"ptBR\": \"Campo Rochoso\",\n";
-                ss << u8"    \"ruRU\": \"Каменистое поле\",\n";
-                ss << u8"    \"zhCN\": \"石块旷野\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5053,\n";
-                ss << u8"    \"Key\": \"Cold Plains\",\n";
-                ss << u8"    \"enUS\": \"Cold Plains\",\n";
-                ss << u8"    \"zhTW\": \"冰冷之原\",\n";
-                ss << u8"    \"deDE\": \"Kalte Ebene\",\n";
-                ss << u8"    \"esES\": \"Llanuras Frías\",\n";
-                ss << u8"    \"frFR\": \"Les Plaines gelées\",\n";
-                ss << u8"    \"itIT\": \"Pianure Gelate\",\n";
-                ss << u8"    \"koKR\": \"차가운 평야\",\n";
-                ss << u8"    \"plPL\": \"Zimna Równina\",\n";
-                ss << u8"    \"esMX\": \"Llanuras Heladas\",\n";
-                ss << u8"    \"jaJP\": \"荒涼の平原\",\n";
-                ss << u8"    \"ptBR\": \"Planície Gélida\",\n";
-                ss << u8"    \"ruRU\": \"Стылые равнины\",\n";
-                ss << u8"    \"zhCN\": \"冰冷之原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5054,\n";
-                ss << u8"    \"Key\": \"Blood Moor\",\n";
-                ss << u8"    \"enUS\": \"Blood Moor\",\n";
-                ss << u8"    \"zhTW\": \"鮮血荒地\",\n";
-                ss << u8"    \"deDE\": \"Blutmoor\",\n";
-                ss << u8"    \"esES\": \"Landa de Sangre\",\n";
-                ss << u8"    \"frFR\": \"La Lande sanglante\",\n";
-                ss << u8"    \"itIT\": \"Lande Insanguinate\",\n";
-                ss << u8"    \"koKR\": \"핏빛 황무지\",\n";
-                ss << u8"    \"plPL\": \"Krwawe Wrzosowisko\",\n";
-                ss << u8"    \"esMX\": \"Páramo Sangriento\",\n";
-                ss << u8"    \"jaJP\": \"血の荒野\",\n";
-                ss << u8"    \"ptBR\": \"Charco Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Кровавая пустошь\",\n";
-                ss << u8"    \"zhCN\": \"鲜血荒地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5055,\n";
-                ss << u8"    \"Key\": \"Rogue Encampment\",\n";
-                ss << u8"    \"enUS\": \"Rogue Encampment\",\n";
-                ss << u8"    \"zhTW\": \"俠盜營地\",\n";
-                ss << u8"    \"deDE\": \"Lager der Jägerinnen\",\n";
-                ss << u8"    \"esES\": \"Campamento de las Arpías\",\n";
-                ss << u8"    \"frFR\": \"Le Camp des Rogues\",\n";
-                ss << u8"    \"itIT\": \"Campo delle Scolte\",\n";
-                ss << u8"    \"koKR\": \"자매단 야영지\",\n";
-                ss << u8"    \"plPL\": \"Obozowisko Łotrzyc\",\n";
-                ss << u8"    \"esMX\": \"Campamento de Renegadas\",\n";
-                ss << u8"    \"jaJP\": \"ローグの野営地\",\n";
-                ss << u8"    \"ptBR\": \"Acampamento Renegado\",\n";
-                ss << u8"    \"ruRU\": \"Лагерь разбойниц\",\n";
-                ss << u8"    \"zhCN\": \"流亡者营地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5056,\n";
-                ss << u8"    \"Key\": \"To Tristram\",\n";
-                ss << u8"    \"enUS\": \"To Tristram\",\n";
-                ss << u8"    \"zhTW\": \"前往崔斯特姆\",\n";
-                ss << u8"    \"deDE\": \"Nach Tristram\",\n";
-                ss << u8"    \"esES\": \"A Tristán\",\n";
-                ss << u8"    \"frFR\": \"Vers Tristram\",\n";
-                ss << u8"    \"itIT\": \"Per Tristram\",\n";
-                ss << u8"    \"koKR\": \"트리스트럼으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Tristram\",\n";
-                ss << u8"    \"esMX\": \"A Tristram\",\n";
-                ss << u8"    \"jaJP\": \"トリストラムへ\",\n";
-                ss << u8"    \"ptBR\": \"Para Tristram\",\n";
-                ss << u8"    \"ruRU\": \"В Тристрам\",\n";
-                ss << u8"    \"zhCN\": \"前往崔斯特姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5057,\n";
-                ss << u8"    \"Key\": \"To The Catacombs Level 4\",\n";
-                ss << u8"    \"enUS\": \"To The Catacombs Level 4\",\n";
-                ss << u8"    \"zhTW\": \"前往地下墓穴第四層\",\n";
-                ss << u8"    \"deDE\": \"Zu den Katakomben, Ebene 4\",\n";
-                ss << u8"    \"esES\": \"Al nivel 4 de las Catacumbas\",\n";
-                ss << u8"    \"frFR\": \"Vers les Catacombes niv. 4\",\n";
-                ss << u8"    \"itIT\": \"Per le Catacombe L4\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 4층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Katakumby – Poziom 4\",\n";
-                ss << u8"    \"esMX\": \"A las Catacumbas Nivel 4\",\n";
-                ss << u8"    \"jaJP\": \"地下墓地: 第4階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para as Catacumbas Nível 4\",\n";
-                ss << u8"    \"ruRU\": \"На 4-й уровень катакомб\",\n";
-                ss << u8"    \"zhCN\": \"前往地下墓穴四层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5058,\n";
-                ss << u8"    \"Key\": \"To The Catacombs Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Catacombs Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往地下墓穴第三層\",\n";
-                ss << u8"    \"deDE\": \"Zu den Katakomben, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 de las Catacumbas\",\n";
-                ss << u8"    \"frFR\": \"Vers les Catacombes niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per le Catacombe L3\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Katakumby – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"A las Catacumbas Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"地下墓地: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para as Catacumbas Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень катакомб\",\n";
-                ss << u8"    \"zhCN\": \"前往地下墓穴三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5059,\n";
-                ss << u8"    \"Key\": \"To The Catacombs Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Catacombs Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往地下墓穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Zu den Katakomben, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 de las Catacumbas\",\n";
-                ss << u8"    \"frFR\": \"Vers les Catacombes niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per le Catacombe L2\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Katakumby – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"A las Catacumbas Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"地下墓地: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para as Catacumbas Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень катакомб\",\n";
-                ss << u8"    \"zhCN\": \"前往地下墓穴二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5060,\n";
-                ss << u8"    \"Key\": \"To The Catacombs Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Catacombs Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往地下墓穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Zu den Katakomben, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 de las Catacumbas\",\n";
-                ss << u8"    \"frFR\": \"Vers les Catacombes niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per le Catacombe L1\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Katakumby – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"A las Catacumbas Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"地下墓地: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para as Catacumbas Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень катакомб\",\n";
-                ss << u8"    \"zhCN\": \"前往地下墓穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5061,\n";
-                ss << u8"    \"Key\": \"To The Cathedral\",\n";
-                ss << u8"    \"enUS\": \"To The Cathedral\",\n";
-                ss << u8"    \"zhTW\": \"前往大教堂\",\n";
-                ss << u8"    \"deDE\": \"Zur Kathedrale\",\n";
-                ss << u8"    \"esES\": \"A la Catedral\",\n";
-                ss << u8"    \"frFR\": \"Vers la Cathédrale\",\n";
-                ss << u8"    \"itIT\": \"Per la Cattedrale\",\n";
-                ss << u8"    \"koKR\": \"대성당으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Katedra\",\n";
-                ss << u8"    \"esMX\": \"A la Catedral\",\n";
-                ss << u8"    \"jaJP\": \"大聖堂へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Catedral\",\n";
-                ss << u8"    \"ruRU\": \"Собор\",\n";
-                ss << u8"    \"zhCN\": \"前往大教堂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5062,\n";
-                ss << u8"    \"Key\": \"To The Inner Cloister\",\n";
-                ss << u8"    \"enUS\": \"To The Inner Cloister\",\n";
-                ss << u8"    \"zhTW\": \"前往內側迴廊\",\n";
-                ss << u8"    \"deDE\": \"Zum inneren Kloster\",\n";
-                ss << u8"    \"esES\": \"Al Claustro Interior\",\n";
-                ss << u8"    \"frFR\": \"Vers le Cloître intérieur\",\n";
-                ss << u8"    \"itIT\": \"Per il Chiostro Interno\",\n";
-                ss << u8"    \"koKR\": \"내부 회랑으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Wewnętrzny Monastyr\",\n";
-                ss << u8"    \"esMX\": \"Al Claustro Interno\",\n";
-                ss << u8"    \"jaJP\": \"修道院内部へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Claustro Interno\",\n";
-                ss << u8"    \"ruRU\": \"Во внутренний двор\",\n";
-                ss << u8"    \"zhCN\": \"前往内侧回廊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5063,\n";
-                ss << u8"    \"Key\": \"To The Jail Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Jail Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往監牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Zum Gefängnis, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 de la Cárcel\",\n";
-                ss << u8"    \"frFR\": \"Vers la Prison niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per la Prigione L3\",\n";
-                ss << u8"    \"koKR\": \"감옥 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Więzienie – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"A la Prisión Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"牢獄: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Prisão Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень тюрьмы\",\n";
-                ss << u8"    \"zhCN\": \"前往监牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5064,\n";
-                ss << u8"    \"Key\": \"To The Jail Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Jail Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往監牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Gefängnis, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 de la Cárcel\",\n";
-                ss << u8"    \"frFR\": \"Vers la Prison niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per la Prigione L2\",\n";
-                ss << u8"    \"koKR\": \"감옥 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Więzienie – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"A la Prisión Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"牢獄: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Prisão Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень тюрьмы\",\n";
-                ss << u8"    \"zhCN\": \"前往监牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5065,\n";
-                ss << u8"    \"Key\": \"To The Jail Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Jail Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往監牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Gefängnis, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 de la Cárcel\",\n";
-                ss << u8"    \"frFR\": \"Vers la Prison niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per la Prigione L1\",\n";
-                ss << u8"    \"koKR\": \"감옥 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Więzienie – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"A la Prisión Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"牢獄: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Prisão Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень тюрьмы\",\n";
-                ss << u8"    \"zhCN\": \"前往监牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5066,\n";
-                ss << u8"    \"Key\": \"To The Barracks\",\n";
-                ss << u8"    \"enUS\": \"To The Barracks\",\n";
-                ss << u8"    \"zhTW\": \"前往兵營\",\n";
-                ss << u8"    \"deDE\": \"Zur Kaserne\",\n";
-                ss << u8"    \"esES\": \"A los Barracones\",\n";
-                ss << u8"    \"frFR\": \"Vers la Caserne\",\n";
-                ss << u8"    \"itIT\": \"Per la Caserma\",\n";
-                ss << u8"    \"koKR\": \"병영으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Koszary\",\n";
-                ss << u8"    \"esMX\": \"Al Cuartel\",\n";
-                ss << u8"    \"jaJP\": \"兵舎へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Quartel\",\n";
-                ss << u8"    \"ruRU\": \"В Казармы.\",\n";
-                ss << u8"    \"zhCN\": \"前往营房\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5067,\n";
-                ss << u8"    \"Key\": \"To The Outer Cloister\",\n";
-                ss << u8"    \"enUS\": \"To The Outer Cloister\",\n";
-                ss << u8"    \"zhTW\": \"前往外側迴廊\",\n";
-                ss << u8"    \"deDE\": \"Zum äußeren Kloster\",\n";
-                ss << u8"    \"esES\": \"Al Claustro Exterior\",\n";
-                ss << u8"    \"frFR\": \"Vers le Cloître extérieur\",\n";
-                ss << u8"    \"itIT\": \"Per il Chiostro Esterno\",\n";
-                ss << u8"    \"koKR\": \"외부 회랑으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zewnętrzny Monastyr\",\n";
-                ss << u8"    \"esMX\": \"Al Claustro Exterior\",\n";
-                ss << u8"    \"jaJP\": \"修道院外部へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Claustro Externo\",\n";
-                ss << u8"    \"ruRU\": \"Во внешний двор\",\n";
-                ss << u8"    \"zhCN\": \"前往外侧回廊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5068,\n";
-                ss << u8"    \"Key\": \"To The Monastery Gate\",\n";
-                ss << u8"    \"enUS\": \"To The Monastery Gate\",\n";
-                ss << u8"    \"zhTW\": \"前往修道院大門\",\n";
-                ss << u8"    \"deDE\": \"Zur Klosterpforte\",\n";
-                ss << u8"    \"esES\": \"A las Puertas del Monasterio\",\n";
-                ss << u8"    \"frFR\": \"Vers les Portes du Monastère\",\n";
-                ss << u8"    \"itIT\": \"Per l'Atrio del Monastero\",\n";
-                ss << u8"    \"koKR\": \"수도원 정문으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Klasztorna Brama\",\n";
-                ss << u8"    \"esMX\": \"A la Entrada del Monasterio\",\n";
-                ss << u8"    \"jaJP\": \"修道院の門へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Portão do Monastério\",\n";
-                ss << u8"    \"ruRU\": \"К монастырским воротам\",\n";
-                ss << u8"    \"zhCN\": \"前往修道院大门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5069,\n";
-                ss << u8"    \"Key\": \"To The Tower Cellar Level 5\",\n";
-                ss << u8"    \"enUS\": \"To The Tower Cellar Level 5\",\n";
-                ss << u8"    \"zhTW\": \"前往高塔地牢第五層\",\n";
-                ss << u8"    \"deDE\": \"Zum Turmkeller, Ebene 5\",\n";
-                ss << u8"    \"esES\": \"Al nivel 5 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Vers la Cave de la Tour niv. 5\",\n";
-                ss << u8"    \"itIT\": \"Per il Sotterraneo della Torre L5\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 5층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 5\",\n";
-                ss << u8"    \"esMX\": \"Al Sótano de la Torre Nivel 5\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第5階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Porão da Torre Nível 5\",\n";
-                ss << u8"    \"ruRU\": \"На 5-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"前往高塔地窖五层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5070,\n";
-                ss << u8"    \"Key\": \"To The Tower Cellar Level 4\",\n";
-                ss << u8"    \"enUS\": \"To The Tower Cellar Level 4\",\n";
-                ss << u8"    \"zhTW\": \"前往高塔地牢第四層\",\n";
-                ss << u8"    \"deDE\": \"Zum Turmkeller, Ebene 4\",\n";
-                ss << u8"    \"esES\": \"Al nivel 4 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Vers la Cave de la Tour niv. 4\",\n";
-                ss << u8"    \"itIT\": \"Per il Sotterraneo della Torre L4\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 4층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 4\",\n";
-                ss << u8"    \"esMX\": \"Al Sótano de la Torre Nivel 4\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第4階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Porão da Torre Nível 4\",\n";
-                ss << u8"    \"ruRU\": \"На 4-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"前往高塔地窖四层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5071,\n";
-                ss << u8"    \"Key\": \"To The Tower Cellar Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Tower Cellar Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往高塔地牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Zum Turmkeller, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Vers la Cave de la Tour niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per il Sotterraneo della Torre L3\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Al Sótano de la Torre Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Porão da Torre Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"前往高塔地窖三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5072,\n";
-                ss << u8"    \"Key\": \"To The Tower Cellar Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Tower Cellar Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往高塔地牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Turmkeller, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Vers la Cave de la Tour niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per il Sotterraneo della Torre L2\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Al Sótano de la Torre Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Porão da Torre Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"前往高塔地窖二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5073,\n";
-                ss << u8"    \"Key\": \"To The Tower Cellar Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Tower Cellar Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往高塔地牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Turmkeller, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Vers la Cave de la Tour niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per il Sotterraneo della Torre L1\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Al Sótano de la Torre Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"塔の地下室: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Porão da Torre Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"前往高塔地窖一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5074,\n";
-                ss << u8"    \"Key\": \"To The Forgotten Tower\",\n";
-                ss << u8"    \"enUS\": \"To The Forgotten Tower\",\n";
-                ss << u8"    \"zhTW\": \"前往遺忘之塔\",\n";
-                ss << u8"    \"deDE\": \"Zum vergessenen Turm\",\n";
-                ss << u8"    \"esES\": \"A la Torre Olvidada\",\n";
-                ss << u8"    \"frFR\": \"Vers la Tour oubliée\",\n";
-                ss << u8"    \"itIT\": \"Per la Torre Dimenticata\",\n";
-                ss << u8"    \"koKR\": \"잊힌 탑으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zapomniana Wieża\",\n";
-                ss << u8"    \"esMX\": \"A la Torre Olvidada\",\n";
-                ss << u8"    \"jaJP\": \"忘れ去られし塔へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Torre Esquecida\",\n";
-                ss << u8"    \"ruRU\": \"В Заброшенную башню\",\n";
-                ss << u8"    \"zhCN\": \"前往被遗忘的高塔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5075,\n";
-                ss << u8"    \"Key\": \"To The Mausoleum\",\n";
-                ss << u8"    \"enUS\": \"To The Mausoleum\",\n";
-                ss << u8"    \"zhTW\": \"前往大陵墓\",\n";
-                ss << u8"    \"deDE\": \"Zum Mausoleum\",\n";
-                ss << u8"    \"esES\": \"Al Mausoleo\",\n";
-                ss << u8"    \"frFR\": \"Vers le Mausolée\",\n";
-                ss << u8"    \"itIT\": \"Per il Mausoleo\",\n";
-                ss << u8"    \"koKR\": \"영묘로 이동\",\n";
-                ss << u8"    \"plPL\": \"Mauzoleum\",\n";
-                ss << u8"    \"esMX\": \"Al Mausoleo\",\n";
-                ss << u8"    \"jaJP\": \"霊廟へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Mausoléu\",\n";
-                ss << u8"    \"ruRU\": \"В мавзолей\",\n";
-                ss << u8"    \"zhCN\": \"前往寝陵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5076,\n";
-                ss << u8"    \"Key\": \"To The Crypt\",\n";
-                ss << u8"    \"enUS\": \"To The Crypt\",\n";
-                ss << u8"    \"zhTW\": \"前往墓地\",\n";
-                ss << u8"    \"deDE\": \"Zur Krypta\",\n";
-                ss << u8"    \"esES\": \"A la Cripta\",\n";
-                ss << u8"    \"frFR\": \"Vers la Crypte\",\n";
-                ss << u8"    \"itIT\": \"Per la Cripta\",\n";
-                ss << u8"    \"koKR\": \"묘실로 이동\",\n";
-                ss << u8"    \"plPL\": \"Krypta\",\n";
-                ss << u8"    \"esMX\": \"A la Cripta\",\n";
-                ss << u8"    \"jaJP\": \"地下墓所へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Cripta\",\n";
-                ss << u8"    \"ruRU\": \"В склеп\",\n";
-                ss << u8"    \"zhCN\": \"前往墓穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5077,\n";
-                ss << u8"    \"Key\": \"To The Burial Grounds\",\n";
-                ss << u8"    \"enUS\": \"To The Burial Grounds\",\n";
-                ss << u8"    \"zhTW\": \"前往埋骨之地\",\n";
-                ss << u8"    \"deDE\": \"Zum Friedhof\",\n";
-                ss << u8"    \"esES\": \"Al Cementerio\",\n";
-                ss << u8"    \"frFR\": \"Vers le Cimetière\",\n";
-                ss << u8"    \"itIT\": \"Per il Cimitero\",\n";
-                ss << u8"    \"koKR\": \"매장지로 이동\",\n";
-                ss << u8"    \"plPL\": \"Cmentarz\",\n";
-                ss << u8"    \"esMX\": \"Al Cementerio\",\n";
-                ss << u8"    \"jaJP\": \"墓地へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Cemitério\",\n";
-                ss << u8"    \"ruRU\": \"На Погост\",\n";
-                ss << u8"    \"zhCN\": \"前往埋骨之地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5078,\n";
-                ss << u8"    \"Key\": \"To The Pit Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Pit Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往地穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Zur Grube, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 del Foso\",\n";
-                ss << u8"    \"frFR\": \"Vers la Fosse niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per l'Abisso L2\",\n";
-                ss << u8"    \"koKR\": \"구덩이 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Czeluść – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Al Foso Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"穴ぐら: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Fosso Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень ямы\",\n";
-                ss << u8"    \"zhCN\": \"前往深渊二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5079,\n";
-                ss << u8"    \"Key\": \"To The Hole Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Hole Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往地洞第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Loch, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 del Hoyo\",\n";
-                ss << u8"    \"frFR\": \"Vers le Gouffre niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per il Buco L2\",\n";
-                ss << u8"    \"koKR\": \"구렁 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Jama – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Al Agujero Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"洞穴: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Buraco Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень норы\",\n";
-                ss << u8"    \"zhCN\": \"前往洞坑二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5080,\n";
-                ss << u8"    \"Key\": \"To Underground Passage Level 2\",\n";
-                ss << u8"    \"enUS\": \"To Underground Passage Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往地底通道第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Unterirdischen Durchgang, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 del Pasadizo Subterráneo\",\n";
-                ss << u8"    \"frFR\": \"Vers le Passage souterrain niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per il Passaggio Sotterraneo L2\",\n";
-                ss << u8"    \"koKR\": \"지하 통로 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Podziemny Tunel – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Al Pasaje Subterráneo Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"地下道: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Passagem Subterrânea Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень подземного прохода\",\n";
-                ss << u8"    \"zhCN\": \"前往地下通道二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5081,\n";
-                ss << u8"    \"Key\": \"To The Cave Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Cave Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往洞穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Zur Grotte, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 de la Cueva\",\n";
-                ss << u8"    \"frFR\": \"Vers la Grotte niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per la Caverna L2\",\n";
-                ss << u8"    \"koKR\": \"동굴 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Jaskinia – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"A la Cueva Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"洞窟: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Caverna Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень пещеры\",\n";
-                ss << u8"    \"zhCN\": \"前往洞穴二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5082,\n";
-                ss << u8"    \"Key\": \"To The Pit Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Pit Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往地穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Zur Grube, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 del Foso\",\n";
-                ss << u8"    \"frFR\": \"Vers la Fosse niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per l'Abisso L1\",\n";
-                ss << u8"    \"koKR\": \"구덩이 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Czeluść – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Al Foso Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"穴ぐら: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Fosso Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень ямы\",\n";
-                ss << u8"    \"zhCN\": \"前往深渊一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5083,\n";
-                ss << u8"    \"Key\": \"To The Hole Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Hole Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往地洞第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Loch, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 del Hoyo\",\n";
-                ss << u8"    \"frFR\": \"Ver le Gouffre niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per il Buco L1\",\n";
-                ss << u8"    \"koKR\": \"구렁 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Jama – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Al Agujero Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"洞穴: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Buraco Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень норы\",\n";
-                ss << u8"    \"zhCN\": \"前往洞坑一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5084,\n";
-                ss << u8"    \"Key\": \"To Underground Passage Level 1\",\n";
-                ss << u8"    \"enUS\": \"To Underground Passage Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往地底通道第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Unterirdischen Durchgang, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 del Pasadizo Subterráneo\",\n";
-                ss << u8"    \"frFR\": \"Vers le Passage souterrain niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per il Passaggio Sotterraneo L1\",\n";
-                ss << u8"    \"koKR\": \"지하 통로 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Podziemny Tunel – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Al Pasaje Subterráneo Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"地下道: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Passagem Subterrânea Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень подземного прохода\",\n";
-                ss << u8"    \"zhCN\": \"前往地下通道一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5085,\n";
-                ss << u8"    \"Key\": \"To The Cave Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Cave Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往洞穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Zur Grotte, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 de la Cueva\",\n";
-                ss << u8"    \"frFR\": \"Vers la Grotte niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per la Caverna L1\",\n";
-                ss << u8"    \"koKR\": \"동굴 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Jaskinia – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"A la Cueva Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"洞窟: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Caverna Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень пещеры\",\n";
-                ss << u8"    \"zhCN\": \"前往洞穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5086,\n";
-                ss << u8"    \"Key\": \"To The Den of Evil\",\n";
-                ss << u8"    \"enUS\": \"To The Den of Evil\",\n";
-                ss << u8"    \"zhTW\": \"前往邪惡洞窟\",\n";
-                ss << u8"    \"deDE\": \"Zur Höhle des Bösen\",\n";
-                ss << u8"    \"esES\": \"Al Cubil del Mal\",\n";
-                ss << u8"    \"frFR\": \"Vers le Repaire du Mal\",\n";
-                ss << u8"    \"itIT\": \"Per l'Antro del Male\",\n";
-                ss << u8"    \"koKR\": \"악의 소굴로 이동\",\n";
-                ss << u8"    \"plPL\": \"Siedlisko Zła\",\n";
-                ss << u8"    \"esMX\": \"A la Guarida del Mal\",\n";
-                ss << u8"    \"jaJP\": \"邪悪の巣窟へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Covil do Mal\",\n";
-                ss << u8"    \"ruRU\": \"В Логово зла\",\n";
-                ss << u8"    \"zhCN\": \"前往邪恶洞穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5087,\n";
-                ss << u8"    \"Key\": \"To The Tamoe Highland\",\n";
-                ss << u8"    \"enUS\": \"To The Tamoe Highland\",\n";
-                ss << u8"    \"zhTW\": \"前往泰摩高地\",\n";
-                ss << u8"    \"deDE\": \"Zum Tamohochland\",\n";
-                ss << u8"    \"esES\": \"A las Tierras Altas de Tamoe\",\n";
-                ss << u8"    \"frFR\": \"Vers les Hautes-Terres de Tamoe\",\n";
-                ss << u8"    \"itIT\": \"Per l'Altopiano di Tamoe\",\n";
-                ss << u8"    \"koKR\": \"타모 고원으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Wyżyna Tamoe\",\n";
-                ss << u8"    \"esMX\": \"A las Tierras Altas de Tamoe\",\n";
-                ss << u8"    \"jaJP\": \"タモエ高原へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Planalto Tamoe\",\n";
-                ss << u8"    \"ruRU\": \"На нагорье Тамоэ\",\n";
-                ss << u8"    \"zhCN\": \"前往泰摩高地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5088,\n";
-                ss << u8"    \"Key\": \"To The Black Marsh\",\n";
-                ss << u8"    \"enUS\": \"To The Black Marsh\",\n";
-                ss << u8"    \"zhTW\": \"前往黑色荒地\",\n";
-                ss << u8"    \"deDE\": \"Zum Schwarzmoor\",\n";
-                ss << u8"    \"esES\": \"Al Pantano Negro\",\n";
-                ss << u8"    \"frFR\": \"Vers le Marais sombre\",\n";
-                ss << u8"    \"itIT\": \"Per la Palude Nera\",\n";
-                ss << u8"    \"koKR\": \"검은 습지로 이동\",\n";
-                ss << u8"    \"plPL\": \"Czarne Moczary\",\n";
-                ss << u8"    \"esMX\": \"A la Marisma Oscura\",\n";
-                ss << u8"    \"jaJP\": \"黒の湿原へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Charco Tenebroso\",\n";
-                ss << u8"    \"ruRU\": \"В Черную топь\",\n";
-                ss << u8"    \"zhCN\": \"前往黑色沼泽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5089,\n";
-                ss << u8"    \"Key\": \"To The Dark Wood\",\n";
-                ss << u8"    \"enUS\": \"To The Dark Wood\",\n";
-                ss << u8"    \"zhTW\": \"前往黑暗森林\",\n";
-                ss << u8"    \"deDE\": \"Zum Dunkelwald\",\n";
-                ss << u8"    \"esES\": \"Al Bosque Oscuro\",\n";
-                ss << u8"    \"frFR\": \"Vers le Bois obscur\",\n";
-                ss << u8"    \"itIT\": \"Per la Foresta Oscura\",\n";
-                ss << u8"    \"koKR\": \"어둠숲으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Mroczna Knieja\",\n";
-                ss << u8"    \"esMX\": \"Al Bosque Oscuro\",\n";
-                ss << u8"    \"jaJP\": \"常闇の森へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Floresta Sombria\",\n";
-                ss << u8"    \"ruRU\": \"В Темнолесье\",\n";
-                ss << u8"    \"zhCN\": \"前往黑暗森林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5090,\n";
-                ss << u8"    \"Key\": \"To The Stony Field\",\n";
-                ss << u8"    \"enUS\": \"To The Stony Field\",\n";
-                ss << u8"    \"zhTW\": \"前往亂石曠野\",\n";
-                ss << u8"    \"deDE\": \"Zum Feld der Steine\",\n";
-                ss << u8"    \"esES\": \"Al Campo Pedregoso\",\n";
-                ss << u8"    \"frFR\": \"Vers le Champ de pierres\",\n";
-                ss << u8"    \"itIT\": \"Per il Campo di Pietra\",\n";
-                ss << u8"    \"koKR\": \"바위 벌판으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kamienne Pole\",\n";
-                ss << u8"    \"esMX\": \"Al Campo Rocoso\",\n";
-                ss << u8"    \"jaJP\": \"石の原野へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Campo Rochoso\",\n";
-                ss << u8"    \"ruRU\": \"В Каменистое поле\",\n";
-                ss << u8"    \"zhCN\": \"前往石块旷野\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5091,\n";
-                ss << u8"    \"Key\": \"To The Cold Plains\",\n";
-                ss << u8"    \"enUS\": \"To The Cold Plains\",\n";
-                ss << u8"    \"zhTW\": \"前往冰冷之原\",\n";
-                ss << u8"    \"deDE\": \"Zur kalten Ebene\",\n";
-                ss << u8"    \"esES\": \"A las Llanuras Frías\",\n";
-                ss << u8"    \"frFR\": \"Vers les Plaines gelées\",\n";
-                ss << u8"    \"itIT\": \"Per le Pianure Gelate\",\n";
-                ss << u8"    \"koKR\": \"차가운 평야로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zimna Równina\",\n";
-                ss << u8"    \"esMX\": \"A las Llanuras Heladas\",\n";
-                ss << u8"    \"jaJP\": \"荒涼の平原へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Planície Gélida\",\n";
-                ss << u8"    \"ruRU\": \"В Стылые равнины\",\n";
-                ss << u8"    \"zhCN\": \"前往冰冷之原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5092,\n";
-                ss << u8"    \"Key\": \"To The Blood Moor\",\n";
-                ss << u8"    \"enUS\": \"To The Blood Moor\",\n";
-                ss << u8"    \"zhTW\": \"前往鮮血荒地\",\n";
-                ss << u8"    \"deDE\": \"Zum Blutmoor\",\n";
-                ss << u8"    \"esES\": \"A la Landa de Sangre\",\n";
-                ss << u8"    \"frFR\": \"Vers la Lande sanglante\",\n";
-                ss << u8"    \"itIT\": \"Per le Lande Insanguinate\",\n";
-                ss << u8"    \"koKR\": \"핏빛 황무지로 이동\",\n";
-                ss << u8"    \"plPL\": \"Krwawe Wrzosowisko\",\n";
-                ss << u8"    \"esMX\": \"Al Páramo Sangriento\",\n";
-                ss << u8"    \"jaJP\": \"血の荒野へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Charco Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"В Кровавую пустошь\",\n";
-                ss << u8"    \"zhCN\": \"前往鲜血荒地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 5093,\n";
-                ss << u8"    \"Key\": \"To The Rogue Encampment\",\n";
-                ss << u8"    \"enUS\": \"To The Rogue Encampment\",\n";
-                ss << u8"    \"zhTW\": \"前往俠盜營地\",\n";
-                ss << u8"    \"deDE\": \"Zum Lager der Jägerinnen\",\n";
-                ss << u8"    \"esES\": \"Al Campamento de las Arpías\",\n";
-                ss << u8"    \"frFR\": \"Vers le Camp des Rogues\",\n";
-                ss << u8"    \"itIT\": \"Per il Campo delle Scolte\",\n";
-                ss << u8"    \"koKR\": \"자매단 야영지로 이동\",\n";
-                ss << u8"    \"plPL\": \"Obozowisko Łotrzyc\",\n";
-                ss << u8"    \"esMX\": \"Al Campamento de Renegadas\",\n";
-                ss << u8"    \"jaJP\": \"ローグの野営地へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Acampamento Renegado\",\n";
-                ss << u8"    \"ruRU\": \"В лагерь разбойниц\",\n";
-                ss << u8"    \"zhCN\": \"前往流亡者营地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11155,\n";
-                ss << u8"    \"Key\": \"Pandemonium Run 1\",\n";
-                ss << u8"    \"enUS\": \"Matron's Den\",\n";
-                ss << u8"    \"zhTW\": \"魔母巢穴\",\n";
-                ss << u8"    \"deDE\": \"Matronenhöhle\",\n";
-                ss << u8"    \"esES\": \"Guarida de la Matrona\",\n";
-                ss << u8"    \"frFR\": \"Repaire de la Matrone\",\n";
-                ss << u8"    \"itIT\": \"Tana della Matrona\",\n";
-                ss << u8"    \"koKR\": \"여제의 소굴\",\n";
-                ss << u8"    \"plPL\": \"Legowisko Matrony\",\n";
-                ss << u8"    \"esMX\": \"Guarida de la Matrona\",\n";
-                ss << u8"    \"jaJP\": \"貴婦人の巣窟\",\n";
-                ss << u8"    \"ptBR\": \"Covil da Matriarca\",\n";
-                ss << u8"    \"ruRU\": \"Логово Госпожи\",\n";
-                ss << u8"    \"zhCN\": \"主母的巢穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11156,\n";
-                ss << u8"    \"Key\": \"Pandemonium Run 2\",\n";
-                ss << u8"    \"enUS\": \"Forgotten Sands\",\n";
-                ss << u8"    \"zhTW\": \"遺忘沙漠\",\n";
-                ss << u8"    \"deDE\": \"Die Vergessenen Sande\",\n";
-                ss << u8"    \"esES\": \"Arenas Olvidadas\",\n";
-                ss << u8"    \"frFR\": \"Les Sables oubliés\",\n";
-                ss << u8"    \"itIT\": \"Sabbie Dimenticate\",\n";
-                ss << u8"    \"koKR\": \"잊힌 사막\",\n";
-                ss << u8"    \"plPL\": \"Zapomniane Piaski\",\n";
-                ss << u8"    \"esMX\": \"Arenas Olvidadas\",\n";
-                ss << u8"    \"jaJP\": \"忘れ去られし砂漠\",\n";
-                ss << u8"    \"ptBR\": \"Areias Esquecidas\",\n";
-                ss << u8"    \"ruRU\": \"Забытые пески\",\n";
-                ss << u8"    \"zhCN\": \"遗忘的沙丘\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11157,\n";
-                ss << u8"    \"Key\": \"Pandemonium Run 3\",\n";
-                ss << u8"    \"enUS\": \"Furnace of Pain\",\n";
-                ss << u8"    \"zhTW\": \"苦痛熔爐\",\n";
-                ss << u8"    \"deDE\": \"Glutofen der Pein\",\n";
-                ss << u8"    \"esES\": \"Caldera del Dolor\",\n";
-                ss << u8"    \"frFR\": \"Fournaise de la douleur\",\n";
-                ss << u8"    \"itIT\": \"Fornace del Dolore\",\n";
-                ss << u8"    \"koKR\": \"고통의 용광로\",\n";
-                ss << u8"    \"plPL\": \"Piec Bólu\",\n";
-                ss << u8"    \"esMX\": \"Forja del Dolor\",\n";
-                ss << u8"    \"jaJP\": \"苦痛のかまど\",\n";
-                ss << u8"    \"ptBR\": \"Fornalha da Dor\",\n";
-                ss << u8"    \"ruRU\": \"Горнило Боли\",\n";
-                ss << u8"    \"zhCN\": \"苦痛的熔炉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21797,\n";
-                ss << u8"    \"Key\": \"act1X\",\n";
-                ss << u8"    \"enUS\": \"THE SISTER'S LAMENT\",\n";
-                ss << u8"    \"zhTW\": \"痛惜往事\",\n";
-                ss << u8"    \"deDE\": \"DIE KLAGE DER SCHWESTER\",\n";
-                ss << u8"    \"esES\": \"LLANTO DE LAS HERMANAS\",\n";
-                ss << u8"    \"frFR\": \"LA PLAINTE DE LA SŒUR\",\n";
-                ss << u8"    \"itIT\": \"LAMENTO DELLE SORELLE\",\n";
-                ss << u8"    \"koKR\": \"자매의 탄식\",\n";
-                ss << u8"    \"plPL\": \"LAMENT SIÓSTR\",\n";
-                ss << u8"    \"esMX\": \"EL LAMENTO DE LAS HERMANAS\",\n";
-                ss << u8"    \"jaJP\": \"姉妹の嘆き\",\n";
-                ss << u8"    \"ptBR\": \"O LAMENTO DAS IRMÃS\",\n";
-                ss << u8"    \"ruRU\": \"ПЛАЧ СЕСТЕР\",\n";
-                ss << u8"    \"zhCN\": \"修女的挽歌\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21798,\n";
-                ss << u8"    \"Key\": \"act2X\",\n";
-                ss << u8"    \"enUS\": \"DESERT JOURNEY\",\n";
-                ss << u8"    \"zhTW\": \"沙漠旅程\",\n";
-                ss << u8"    \"deDE\": \"WÜSTENREISE\",\n";
-                ss << u8"    \"esES\": \"TRAVESÍA DEL DESIERTO\",\n";
-                ss << u8"    \"frFR\": \"VOYAGE DANS LE DÉSERT\",\n";
-                ss << u8"    \"itIT\": \"VIAGGIO NEL DESERTO\",\n";
-                ss << u8"    \"koKR\": \"사막 여행\",\n";
-                ss << u8"    \"plPL\": \"PODRÓŻ PRZEZ PUSTYNIĘ\",\n";
-                ss << u8"    \"esMX\": \"VIAJE POR EL DESIERTO\",\n";
-                ss << u8"    \"jaJP\": \"砂漠の旅\",\n";
-                ss << u8"    \"ptBR\": \"JORNADA NO DESERTO\",\n";
-                ss << u8"    \"ruRU\": \"ПЕРЕХОД ЧЕРЕЗ ПУСТЫНЮ\",\n";
-                ss << u8"    \"zhCN\": \"沙漠之旅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21799,\n";
-                ss << u8"    \"Key\": \"act3X\",\n";
-                ss << u8"    \"enUS\": \"MEPHISTO'S JUNGLE\",\n";
-                ss << u8"    \"zhTW\": \"墨菲斯托的叢林\",\n";
-                ss << u8"    \"deDE\": \"MEPHISTOS DSCHUNGEL\",\n";
-                ss << u8"    \"esES\": \"JUNGLA DE MEFISTO\",\n";
-                ss << u8"    \"frFR\": \"LA JUNGLE DE MÉPHISTO\",\n";
-                ss << u8"    \"itIT\": \"LA GIUNGLA DI MEFISTO\",\n";
-                ss << u8"    \"koKR\": \"메피스토의 밀림\",\n";
-                ss << u8"    \"plPL\": \"DŻUNGLA MEFISTA\",\n";
-                ss << u8"    \"esMX\": \"LA JUNGLA DE MEFISTO\",\n";
-                ss << u8"    \"jaJP\": \"メフィストの密林\",\n";
-                ss << u8"    \"ptBR\": \"SELVA DE MEFISTO\",\n";
-                ss << u8"    \"ruRU\": \"ДЖУНГЛИ МЕФИСТО\",\n";
-                ss << u8"    \"zhCN\": \"墨菲斯托的丛林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21800,\n";
-                ss << u8"    \"Key\": \"act4X\",\n";
-                ss << u8"    \"enUS\": \"ENTER HELL\",\n";
-                ss << u8"    \"zhTW\": \"進入地獄\",\n";
-                ss << u8"    \"deDE\": \"HINEIN IN DIE HÖLLE\",\n";
-                ss << u8"    \"esES\": \"ENTRADA EN EL INFIERNO\",\n";
-                ss << u8"    \"frFR\": \"L’ENTRÉE EN ENFER\",\n";
-                ss << u8"    \"itIT\": \"INGRESSO ALL'INFERNO\",\n";
-                ss << u8"    \"koKR\": \"지옥 진입\",\n";
-                ss << u8"    \"plPL\": \"WEJŚCIE DO PIEKŁA\",\n";
-                ss << u8"    \"esMX\": \"ENTRADA AL INFIERNO\",\n";
-                ss << u8"    \"jaJP\": \"地獄への道\",\n";
-                ss << u8"    \"ptBR\": \"ENTRADA NO INFERNO\",\n";
-                ss << u8"    \"ruRU\": \"ВРАТА В ПРЕИСПОДНЮЮ\",\n";
-                ss << u8"    \"zhCN\": \"踏入地狱\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21802,\n";
-                ss << u8"    \"Key\": \"act5X\",\n";
-                ss << u8"    \"enUS\": \"SEARCH FOR BAAL\",\n";
-                ss << u8"    \"zhTW\": \"找尋巴爾\",\n";
-                ss << u8"    \"deDE\": \"SUCHE NACH BAAL\",\n";
-                ss << u8"    \"esES\": \"BÚSQUEDA DE BAAL\",\n";
-                ss << u8"    \"frFR\": \"À LA RECHERCHE DE BAAL\",\n";
-                ss << u8"    \"itIT\": \"ALLA RICERCA DI BAAL\",\n";
-                ss << u8"    \"koKR\": \"바알을 찾아서\",\n";
-                ss << u8"    \"plPL\": \"W POSZUKIWANIU BAALA\",\n";
-                ss << u8"    \"esMX\": \"LA BÚSQUEDA DE BAAL\",\n";
-                ss << u8"    \"jaJP\": \"バールを追って\",\n";
-                ss << u8"    \"ptBR\": \"BUSCA POR BAAL\",\n";
-                ss << u8"    \"ruRU\": \"ПОИСКИ БААЛА\",\n";
-                ss << u8"    \"zhCN\": \"寻找巴尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21865,\n";
-                ss << u8"    \"Key\": \"Hell1\",\n";
-                ss << u8"    \"enUS\": \"Abaddon\",\n";
-                ss << u8"    \"zhTW\": \"亞巴頓\",\n";
-                ss << u8"    \"deDE\": \"Abaddon\",\n";
-                ss << u8"    \"esES\": \"Abaddon\",\n";
-                ss << u8"    \"frFR\": \"Abaddon\",\n";
-                ss << u8"    \"itIT\": \"Abaddon\",\n";
-                ss << u8"    \"koKR\": \"나락\",\n";
-                ss << u8"    \"plPL\": \"Abaddon\",\n";
-                ss << u8"    \"esMX\": \"Abadón\",\n";
-                ss << u8"    \"jaJP\": \"奈落\",\n";
-                ss << u8"    \"ptBR\": \"Abadom\",\n";
-                ss << u8"    \"ruRU\": \"Аваддон\",\n";
-                ss << u8"    \"zhCN\": \"亚巴顿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21866,\n";
-                ss << u8"    \"Key\": \"Hell2\",\n";
-                ss << u8"    \"enUS\": \"Pit of Acheron\",\n";
-                ss << u8"    \"zhTW\": \"冥河地穴\",\n";
-                ss << u8"    \"deDE\": \"Grube von Acheron\",\n";
-                ss << u8"    \"esES\": \"Foso de Acheron\",\n";
-                ss << u8"    \"frFR\": \"Puits d’Acheron\",\n";
-                ss << u8"    \"itIT\": \"Abisso dell'Acheronte\",\n";
-                ss << u8"    \"koKR\": \"아케론의 구덩이\",\n";
-                ss << u8"    \"plPL\": \"Otchłań Acheronu\",\n";
-                ss << u8"    \"esMX\": \"Foso de Aqueronte\",\n";
-                ss << u8"    \"jaJP\": \"冥穴\",\n";
-                ss << u8"    \"ptBR\": \"Fosso de Aqueron\",\n";
-                ss << u8"    \"ruRU\": \"Пропасть Ахерона\",\n";
-                ss << u8"    \"zhCN\": \"阿克隆深渊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21867,\n";
-                ss << u8"    \"Key\": \"Hell3\",\n";
-                ss << u8"    \"enUS\": \"Infernal Pit\",\n";
-                ss << u8"    \"zhTW\": \"煉獄地穴\",\n";
-                ss << u8"    \"deDE\": \"Infernogrube\",\n";
-                ss << u8"    \"esES\": \"Foso Infernal\",\n";
-                ss << u8"    \"frFR\": \"Puits infernal\",\n";
-                ss << u8"    \"itIT\": \"Abisso Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥불 구덩이\",\n";
-                ss << u8"    \"plPL\": \"Piekielna Czeluść\",\n";
-                ss << u8"    \"esMX\": \"Foso del Infierno\",\n";
-                ss << u8"    \"jaJP\": \"獄穴\",\n";
-                ss << u8"    \"ptBR\": \"Fosso Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Инфернальный провал\",\n";
-                ss << u8"    \"zhCN\": \"炼狱深渊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21868,\n";
-                ss << u8"    \"Key\": \"To Hell1\",\n";
-                ss << u8"    \"enUS\": \"To Abaddon\",\n";
-                ss << u8"    \"zhTW\": \"前往亞巴頓\",\n";
-                ss << u8"    \"deDE\": \"Nach Abaddon\",\n";
-                ss << u8"    \"esES\": \"A Abaddon\",\n";
-                ss << u8"    \"frFR\": \"Vers Abaddon\",\n";
-                ss << u8"    \"itIT\": \"Per l'Abaddon\",\n";
-                ss << u8"    \"koKR\": \"나락으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Abaddon\",\n";
-                ss << u8"    \"esMX\": \"A Abadón\",\n";
-                ss << u8"    \"jaJP\": \"奈落へ\",\n";
-                ss << u8"    \"ptBR\": \"Para Abadom\",\n";
-                ss << u8"    \"ruRU\": \"В Аваддон\",\n";
-                ss << u8"    \"zhCN\": \"前往亚巴顿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21869,\n";
-                ss << u8"    \"Key\": \"To Hell2\",\n";
-                ss << u8"    \"enUS\": \"To The Pit of Acheron\",\n";
-                ss << u8"    \"zhTW\": \"前往冥河地穴\",\n";
-                ss << u8"    \"deDE\": \"Zur Grube von Acheron\",\n";
-                ss << u8"    \"esES\": \"Al Foso de Acheron\",\n";
-                ss << u8"    \"frFR\": \"Vers le Puits d’Acheron\",\n";
-                ss << u8"    \"itIT\": \"Per l'Abisso dell'Acheronte\",\n";
-                ss << u8"    \"koKR\": \"아케론의 구덩이로 이동\",\n";
-                ss << u8"    \"plPL\": \"Otchłań Acheronu\",\n";
-                ss << u8"    \"esMX\": \"Al Foso de Aqueronte\",\n";
-                ss << u8"    \"jaJP\": \"冥穴へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Fosso de Aqueron\",\n";
-                ss << u8"    \"ruRU\": \"В пропасть Ахерона\",\n";
-                ss << u8"    \"zhCN\": \"前往阿克隆深渊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21870,\n";
-                ss << u8"    \"Key\": \"To Hell3\",\n";
-                ss << u8"    \"enUS\": \"To The Infernal Pit\",\n";
-                ss << u8"    \"zhTW\": \"前往煉獄地穴\",\n";
-                ss << u8"    \"deDE\": \"Zur Infernogrube\",\n";
-                ss << u8"    \"esES\": \"Al Foso Infernal\",\n";
-                ss << u8"    \"frFR\": \"Vers le Puits infernal\",\n";
-                ss << u8"    \"itIT\": \"Per l'Abisso Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥불 구덩이로 이동\",\n";
-                ss << u8"    \"plPL\": \"Piekielna Czeluść\",\n";
-                ss << u8"    \"esMX\": \"Al Foso del Infierno\",\n";
-                ss << u8"    \"jaJP\": \"獄穴へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Fosso Infernal\",\n";
-                ss << u8"    \"ruRU\": \"В Инфернальный провал\",\n";
-                ss << u8"    \"zhCN\": \"前往炼狱深渊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22646,\n";
-                ss << u8"    \"Key\": \"Harrogath\",\n";
-                ss << u8"    \"enUS\": \"Harrogath\",\n";
-                ss << u8"    \"zhTW\": \"哈洛加斯\",\n";
-                ss << u8"    \"deDE\": \"Harrogath\",\n";
-                ss << u8"    \"esES\": \"Harrogath\",\n";
-                ss << u8"    \"frFR\": \"Harrogath\",\n";
-                ss << u8"    \"itIT\": \"Harrogath\",\n";
-                ss << u8"    \"koKR\": \"하로가스\",\n";
-                ss << u8"    \"plPL\": \"Harrogath\",\n";
-                ss << u8"    \"esMX\": \"Harrogat\",\n";
-                ss << u8"    \"jaJP\": \"ハロガス\",\n";
-                ss << u8"    \"ptBR\": \"Harrogath\",\n";
-                ss << u8"    \"ruRU\": \"Харрогат\",\n";
-                ss << u8"    \"zhCN\": \"哈洛加斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22647,\n";
-                ss << u8"    \"Key\": \"Bloody Foothills\",\n";
-                ss << u8"    \"enUS\": \"Bloody Foothills\",\n";
-                ss << u8"    \"zhTW\": \"血腥丘陵\",\n";
-                ss << u8"    \"deDE\": \"Blutiges Vorgebirge\",\n";
-                ss << u8"    \"esES\": \"Estribaciones Sangrientas\",\n";
-                ss << u8"    \"frFR\": \"Les Collines Sanglantes\",\n";
-                ss << u8"    \"itIT\": \"Colline Insanguinate\",\n";
-                ss << u8"    \"koKR\": \"핏빛 언덕\",\n";
-                ss << u8"    \"plPL\": \"Krwawe Wzgórza\",\n";
-                ss << u8"    \"esMX\": \"Laderas Sangrientas\",\n";
-                ss << u8"    \"jaJP\": \"血に塗れし丘陵\",\n";
-                ss << u8"    \"ptBR\": \"Colinas Sangrentas\",\n";
-                ss << u8"    \"ruRU\": \"Кровавые предгорья\",\n";
-                ss << u8"    \"zhCN\": \"血腥丘陵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22648,\n";
-                ss << u8"    \"Key\": \"Rigid Highlands\",\n";
-                ss << u8"    \"enUS\": \"Frigid Highlands\",\n";
-                ss << u8"    \"zhTW\": \"冰凍高地\",\n";
-                ss << u8"    \"deDE\": \"Eishochland\",\n";
-                ss << u8"    \"esES\": \"Tierras Altas Glaciales\",\n";
-                ss << u8"    \"frFR\": \"Les Hautes-Glaces\",\n";
-                ss << u8"    \"itIT\": \"Altopiani del Gelo\",\n";
-                ss << u8"    \"koKR\": \"혹한의 고산지\",\n";
-                ss << u8"    \"plPL\": \"Zlodowaciała Wyżyna\",\n";
-                ss << u8"    \"esMX\": \"Tierras Altas Gélidas\",\n";
-                ss << u8"    \"jaJP\": \"極寒の高原\",\n";
-                ss << u8"    \"ptBR\": \"Terras Altas Gélidas\",\n";
-                ss << u8"    \"ruRU\": \"Мерзлое нагорье\",\n";
-                ss << u8"    \"zhCN\": \"冰冻高地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22649,\n";
-                ss << u8"    \"Key\": \"Arreat Plateau\",\n";
-                ss << u8"    \"enUS\": \"Arreat Plateau\",\n";
-                ss << u8"    \"zhTW\": \"亞瑞特高原\",\n";
-                ss << u8"    \"deDE\": \"Arreathochebene\",\n";
-                ss << u8"    \"esES\": \"Meseta Arreat\",\n";
-                ss << u8"    \"frFR\": \"Le Mont Arreat\",\n";
-                ss << u8"    \"itIT\": \"Plateau dell'Arreat\",\n";
-                ss << u8"    \"koKR\": \"아리앗 고원\",\n";
-                ss << u8"    \"plPL\": \"Płaskowyż Arreat\",\n";
-                ss << u8"    \"esMX\": \"Planicie de Arreat\",\n";
-                ss << u8"    \"jaJP\": \"アリート高地\",\n";
-                ss << u8"    \"ptBR\": \"Platô de Arreat\",\n";
-                ss << u8"    \"ruRU\": \"Арреатское плато\",\n";
-                ss << u8"    \"zhCN\": \"亚瑞特高原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22650,\n";
-                ss << u8"    \"Key\": \"Crystalized Cavern Level 1\",\n";
-                ss << u8"    \"enUS\": \"Crystalline Passage\",\n";
-                ss << u8"    \"zhTW\": \"水晶通道\",\n";
-                ss << u8"    \"deDE\": \"Kristalldurchgang\",\n";
-                ss << u8"    \"esES\": \"Pasaje Cristalino\",\n";
-                ss << u8"    \"frFR\": \"Le Passage Cristallin\",\n";
-                ss << u8"    \"itIT\": \"Passaggio Cristallino\",\n";
-                ss << u8"    \"koKR\": \"수정 동굴\",\n";
-                ss << u8"    \"plPL\": \"Kryształowe Przejście\",\n";
-                ss << u8"    \"esMX\": \"Pasaje Cristalino\",\n";
-                ss << u8"    \"jaJP\": \"結晶道\",\n";
-                ss << u8"    \"ptBR\": \"Passagem Cristalina\",\n";
-                ss << u8"    \"ruRU\": \"Ледяные пещеры\",\n";
-                ss << u8"    \"zhCN\": \"水晶通道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22651,\n";
-                ss << u8"    \"Key\": \"Cellar of Pity\",\n";
-                ss << u8"    \"enUS\": \"Frozen River\",\n";
-                ss << u8"    \"zhTW\": \"冰凍之河\",\n";
-                ss << u8"    \"deDE\": \"Frostfluss\",\n";
-                ss << u8"    \"esES\": \"Río Helado\",\n";
-                ss << u8"    \"frFR\": \"La Rivière Glacée\",\n";
-                ss << u8"    \"itIT\": \"Fiume Gelido\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 강\",\n";
-                ss << u8"    \"plPL\": \"Zamarznięta Rzeka\",\n";
-                ss << u8"    \"esMX\": \"Río Congelado\",\n";
-                ss << u8"    \"jaJP\": \"凍てつく川\",\n";
-                ss << u8"    \"ptBR\": \"Rio Congelado\",\n";
-                ss << u8"    \"ruRU\": \"Замерзшая река\",\n";
-                ss << u8"    \"zhCN\": \"冰冻之河\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22652,\n";
-                ss << u8"    \"Key\": \"Crystalized Cavern Level 2\",\n";
-                ss << u8"    \"enUS\": \"Glacial Trail\",\n";
-                ss << u8"    \"zhTW\": \"冰河小徑\",\n";
-                ss << u8"    \"deDE\": \"Gletscherweg\",\n";
-                ss << u8"    \"esES\": \"Senda Glacial\",\n";
-                ss << u8"    \"frFR\": \"La Piste des Glaces\",\n";
-                ss << u8"    \"itIT\": \"Sentiero Ghiacciato\",\n";
-                ss << u8"    \"koKR\": \"빙하의 길\",\n";
-                ss << u8"    \"plPL\": \"Lodowy Trakt\",\n";
-                ss << u8"    \"esMX\": \"Sendero Glacial\",\n";
-                ss << u8"    \"jaJP\": \"氷の道\",\n";
-                ss << u8"    \"ptBR\": \"Trilha Glacial\",\n";
-                ss << u8"    \"ruRU\": \"Ледовый ход\",\n";
-                ss << u8"    \"zhCN\": \"冰川小径\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22653,\n";
-                ss << u8"    \"Key\": \"Echo Chamber\",\n";
-                ss << u8"    \"enUS\": \"Drifter Cavern\",\n";
-                ss << u8"    \"zhTW\": \"漂泊者洞窟\",\n";
-                ss << u8"    \"deDE\": \"Flockenhöhle\",\n";
-                ss << u8"    \"esES\": \"Caverna del Errante\",\n";
-                ss << u8"    \"frFR\": \"La Caverne du Yéti\",\n";
-                ss << u8"    \"itIT\": \"Caverna dei Viandanti\",\n";
-                ss << u8"    \"koKR\": \"부랑자의 동굴\",\n";
-                ss << u8"    \"plPL\": \"Grota Tułaczy\",\n";
-                ss << u8"    \"esMX\": \"Caverna del Morador\",\n";
-                ss << u8"    \"jaJP\": \"流れ者の洞窟\",\n";
-                ss << u8"    \"ptBR\": \"Caverna do Errante\",\n";
-                ss << u8"    \"ruRU\": \"Пещера скитальцев\",\n";
-                ss << u8"    \"zhCN\": \"漂流洞窟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22654,\n";
-                ss << u8"    \"Key\": \"Tundra Wastelands\",\n";
-                ss << u8"    \"enUS\": \"Frozen Tundra\",\n";
-                ss << u8"    \"zhTW\": \"冰凍苔原\",\n";
-                ss << u8"    \"deDE\": \"Gefrorene Tundra\",\n";
-                ss << u8"    \"esES\": \"Tundra Helada\",\n";
-                ss << u8"    \"frFR\": \"La Toundra Glacée\",\n";
-                ss << u8"    \"itIT\": \"Tundra Congelata\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 동토\",\n";
-                ss << u8"    \"plPL\": \"Zamarznięta Tundra\",\n";
-                ss << u8"    \"esMX\": \"Tundra Congelada\",\n";
-                ss << u8"    \"jaJP\": \"氷結の凍原\",\n";
-                ss << u8"    \"ptBR\": \"Tundra Congelada\",\n";
-                ss << u8"    \"ruRU\": \"Морозная тундра\",\n";
-                ss << u8"    \"zhCN\": \"冰冻苔原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22655,\n";
-                ss << u8"    \"Key\": \"Glacial Caves Level 1\",\n";
-                ss << u8"    \"enUS\": \"The Ancients' Way\",\n";
-                ss << u8"    \"zhTW\": \"先祖之路\",\n";
-                ss << u8"    \"deDE\": \"Der Weg der Urahnen\",\n";
-                ss << u8"    \"esES\": \"Camino de los Antiguos\",\n";
-                ss << u8"    \"frFR\": \"Le Chemin des Anciens\",\n";
-                ss << u8"    \"itIT\": \"Via degli Antichi\",\n";
-                ss << u8"    \"koKR\": \"고대인의 길\",\n";
-                ss << u8"    \"plPL\": \"Droga Starożytnych\",\n";
-                ss << u8"    \"esMX\": \"El Camino de los Ancestros\",\n";
-                ss << u8"    \"jaJP\": \"古の民の通り道\",\n";
-                ss << u8"    \"ptBR\": \"Caminho dos Ancestrais\",\n";
-                ss << u8"    \"ruRU\": \"Путь Древних\",\n";
-                ss << u8"    \"zhCN\": \"先祖之路\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22656,\n";
-                ss << u8"    \"Key\": \"Glacial Caves Level 2\",\n";
-                ss << u8"    \"enUS\": \"Icy Cellar\",\n";
-                ss << u8"    \"zhTW\": \"冰窖\",\n";
-                ss << u8"    \"deDE\": \"Eiskeller\",\n";
-                ss << u8"    \"esES\": \"Sótano Helado\",\n";
-                ss << u8"    \"frFR\": \"La Cave Glaciale\",\n";
-                ss << u8"    \"itIT\": \"Sotterraneo di Ghiaccio\",\n";
-                ss << u8"    \"koKR\": \"얼음 지하실\",\n";
-                ss << u8"    \"plPL\": \"Lodowa Piwnica\",\n";
-                ss << u8"    \"esMX\": \"Caverna Helada\",\n";
-                ss << u8"    \"jaJP\": \"氷の穴ぐら\",\n";
-                ss << u8"    \"ptBR\": \"Porão Gélido\",\n";
-                ss << u8"    \"ruRU\": \"Ледяной грот\",\n";
-                ss << u8"    \"zhCN\": \"寒冰地窖\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22657,\n";
-                ss << u8"    \"Key\": \"Rocky Summit\",\n";
-                ss << u8"    \"enUS\": \"Arreat Summit\",\n";
-                ss << u8"    \"zhTW\": \"亞瑞特山巔\",\n";
-                ss << u8"    \"deDE\": \"Gipfel des Arreat\",\n";
-                ss << u8"    \"esES\": \"Cima Arreat\",\n";
-                ss << u8"    \"frFR\": \"Le Sommet Arreat\",\n";
-                ss << u8"    \"itIT\": \"Sommità dell'Arreat\",\n";
-                ss << u8"    \"koKR\": \"아리앗 정상\",\n";
-                ss << u8"    \"plPL\": \"Szczyt Arreat\",\n";
-                ss << u8"    \"esMX\": \"Cima de Arreat\",\n";
-                ss << u8"    \"jaJP\": \"アリート山の頂き\",\n";
-                ss << u8"    \"ptBR\": \"Cume de Arreat\",\n";
-                ss << u8"    \"ruRU\": \"Вершина Арреата\",\n";
-                ss << u8"    \"zhCN\": \"亚瑞特之巅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22658,\n";
-                ss << u8"    \"Key\": \"Nihlathaks Temple\",\n";
-                ss << u8"    \"enUS\": \"Nihlathak's Temple\",\n";
-                ss << u8"    \"zhTW\": \"尼拉塞克的神殿\",\n";
-                ss << u8"    \"deDE\": \"Nihlathaks Tempel\",\n";
-                ss << u8"    \"esES\": \"Templo de Nihlathak\",\n";
-                ss << u8"    \"frFR\": \"Le Temple de Nihlathak\",\n";
-                ss << u8"    \"itIT\": \"Tempio di Nihlathak\",\n";
-                ss << u8"    \"koKR\": \"니흘라탁의 사원\",\n";
-                ss << u8"    \"plPL\": \"Świątynia Nihlathaka\",\n";
-                ss << u8"    \"esMX\": \"Templo de Nihlathak\",\n";
-                ss << u8"    \"jaJP\": \"ニーラサックの寺院\",\n";
-                ss << u8"    \"ptBR\": \"Templo de Nilatak\",\n";
-                ss << u8"    \"ruRU\": \"Храм Нильятака\",\n";
-                ss << u8"    \"zhCN\": \"尼拉塞克的神殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22659,\n";
-                ss << u8"    \"Key\": \"Halls of Anguish\",\n";
-                ss << u8"    \"enUS\": \"Halls of Anguish\",\n";
-                ss << u8"    \"zhTW\": \"怨慟之廳\",\n";
-                ss << u8"    \"deDE\": \"Hallen der Qual\",\n";
-                ss << u8"    \"esES\": \"Salas de la Angustia\",\n";
-                ss << u8"    \"frFR\": \"Les Corridors de l’Angoisse\",\n";
-                ss << u8"    \"itIT\": \"Sale dell'Angoscia\",\n";
-                ss << u8"    \"koKR\": \"고뇌의 전당\",\n";
-                ss << u8"    \"plPL\": \"Sale Cierpienia\",\n";
-                ss << u8"    \"esMX\": \"Salas de la Angustia\",\n";
-                ss << u8"    \"jaJP\": \"苦悶の広間\",\n";
-                ss << u8"    \"ptBR\": \"Salões da Angústia\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Мучений\",\n";
-                ss << u8"    \"zhCN\": \"痛楚大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22660,\n";
-                ss << u8"    \"Key\": \"Halls of Death's Calling\",\n";
-                ss << u8"    \"enUS\": \"Halls of Pain\",\n";
-                ss << u8"    \"zhTW\": \"苦痛之廳\",\n";
-                ss << u8"    \"deDE\": \"Hallen der Schmerzen\",\n";
-                ss << u8"    \"esES\": \"Salas del Dolor\",\n";
-                ss << u8"    \"frFR\": \"Les Corridors de la Souffrance\",\n";
-                ss << u8"    \"itIT\": \"Sale del Dolore\",\n";
-                ss << u8"    \"koKR\": \"고통의 전당\",\n";
-                ss << u8"    \"plPL\": \"Sale Bólu\",\n";
-                ss << u8"    \"esMX\": \"Salas del Dolor\",\n";
-                ss << u8"    \"jaJP\": \"苦痛の広間\",\n";
-                ss << u8"    \"ptBR\": \"Salões da Dor\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Боли\",\n";
-                ss << u8"    \"zhCN\": \"苦痛大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22661,\n";
-                ss << u8"    \"Key\": \"Halls of Tormented Insanity\",\n";
-                ss << u8"    \"enUS\": \"Halls of Torment\",\n";
-                ss << u8"    \"zhTW\": \"折磨之廳\",\n";
-                ss << u8"    \"deDE\": \"Hallen der Pein\",\n";
-                ss << u8"    \"esES\": \"Salas del Tormento\",\n";
-                ss << u8"    \"frFR\": \"Les Corridors de l’Expiation\",\n";
-                ss << u8"    \"itIT\": \"Sale del Tormento\",\n";
-                ss << u8"    \"koKR\": \"고문의 전당\",\n";
-                ss << u8"    \"plPL\": \"Sale Udręki\",\n";
-                ss << u8"    \"esMX\": \"Salas del Tormento\",\n";
-                ss << u8"    \"jaJP\": \"苦悩の広間\",\n";
-                ss << u8"    \"ptBR\": \"Salões do Tormento\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Страданий\",\n";
-                ss << u8"    \"zhCN\": \"折磨大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22662,\n";
-                ss << u8"    \"Key\": \"Halls of Vaught\",\n";
-                ss << u8"    \"enUS\": \"Halls of Vaught\",\n";
-                ss << u8"    \"zhTW\": \"沃特之廳\",\n";
-                ss << u8"    \"deDE\": \"Hallen von Vaught\",\n";
-                ss << u8"    \"esES\": \"Salas de Vaught\",\n";
-                ss << u8"    \"frFR\": \"Les Corridors du Martyre\",\n";
-                ss << u8"    \"itIT\": \"Sale di Vaught\",\n";
-                ss << u8"    \"koKR\": \"보트의 전당\",\n";
-                ss << u8"    \"plPL\": \"Sale Nieszczęścia\",\n";
-                ss << u8"    \"esMX\": \"Salas de Vaught\",\n";
-                ss << u8"    \"jaJP\": \"ヴォートの広間\",\n";
-                ss << u8"    \"ptBR\": \"Salões de Vaught\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Воута\",\n";
-                ss << u8"    \"zhCN\": \"沃特大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22663,\n";
-                ss << u8"    \"Key\": \"The Worldstone Keep Level 1\",\n";
-                ss << u8"    \"enUS\": \"Worldstone Keep Level 1\",\n";
-                ss << u8"    \"zhTW\": \"世界之石要塞第一層\",\n";
-                ss << u8"    \"deDE\": \"Weltsteinturm, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Torre de la Piedra del Mundo nivel 1\",\n";
-                ss << u8"    \"frFR\": \"Donjon de la Pierre-Monde niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Forte della Pietra del Mondo L1\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채 1층\",\n";
-                ss << u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Fortaleza de la Piedra Ecuménica Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"ワールドストーン城塞: 第1階層\",\n";
-                ss << u8"    \"ptBR\": \"Forte da Pedra do Mundo Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"Цитадель Мироздания: 1-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"世界之石要塞一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22664,\n";
-                ss << u8"    \"Key\": \"The Worldstone Keep Level 2\",\n";
-                ss << u8"    \"enUS\": \"Worldstone Keep Level 2\",\n";
-                ss << u8"    \"zhTW\": \"世界之石要塞第二層\",\n";
-                ss << u8"    \"deDE\": \"Weltsteinturm, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Torre de la Piedra del Mundo nivel 2\",\n";
-                ss << u8"    \"frFR\": \"Donjon de la Pierre-Monde niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Forte della Pietra del Mondo L2\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채 2층\",\n";
-                ss << u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Fortaleza de la Piedra Ecuménica Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"ワールドストーン城塞: 第2階層\",\n";
-                ss << u8"    \"ptBR\": \"Forte da Pedra do Mundo Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"Цитадель Мироздания: 2-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"世界之石要塞二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22665,\n";
-                ss << u8"    \"Key\": \"The Worldstone Keep Level 3\",\n";
-                ss << u8"    \"enUS\": \"Worldstone Keep Level 3\",\n";
-                ss << u8"    \"zhTW\": \"世界之石要塞第三層\",\n";
-                ss << u8"    \"deDE\": \"Weltsteinturm, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Torre de la Piedra del Mundo nivel 3\",\n";
-                ss << u8"    \"frFR\": \"Donjon de la Pierre-Monde niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Forte della Pietra del Mondo L3\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채 3층\",\n";
-                ss << u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Fortaleza de la Piedra Ecuménica Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"ワールドストーン城塞: 第3階層\",\n";
-                ss << u8"    \"ptBR\": \"Forte da Pedra do Mundo Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"Цитадель Мироздания: 3-й уровень\",\n";
-                ss << u8"    \"zhCN\": \"世界之石要塞三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22666,\n";
-                ss << u8"    \"Key\": \"The Worldstone Chamber\",\n";
-                ss << u8"    \"enUS\": \"The Worldstone Chamber\",\n";
-                ss << u8"    \"zhTW\": \"世界之石大殿\",\n";
-                ss << u8"    \"deDE\": \"Die Kammer des Weltsteins\",\n";
-                ss << u8"    \"esES\": \"Cámara de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"La Chambre de la Pierre-Monde\",\n";
-                ss << u8"    \"itIT\": \"Sale della Pietra del Mondo\",\n";
-                ss << u8"    \"koKR\": \"세계석 보관실\",\n";
-                ss << u8"    \"plPL\": \"Komnata Kamienia Świata\",\n";
-                ss << u8"    \"esMX\": \"Cámara de la Piedra Ecuménica\",\n";
-                ss << u8"    \"jaJP\": \"ワールドストーンの間\",\n";
-                ss << u8"    \"ptBR\": \"Câmara da Pedra do Mundo\",\n";
-                ss << u8"    \"ruRU\": \"Святилище Мироздания\",\n";
-                ss << u8"    \"zhCN\": \"世界之石大殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22667,\n";
-                ss << u8"    \"Key\": \"Throne of Destruction\",\n";
-                ss << u8"    \"enUS\": \"Throne of Destruction\",\n";
-                ss << u8"    \"zhTW\": \"毀滅王座\",\n";
-                ss << u8"    \"deDE\": \"Thron der Zerstörung\",\n";
-                ss << u8"    \"esES\": \"Trono de la Destrucción\",\n";
-                ss << u8"    \"frFR\": \"Le Trône de la Destruction\",\n";
-                ss << u8"    \"itIT\": \"Trono della Distruzione\",\n";
-                ss << u8"    \"koKR\": \"파괴의 왕좌\",\n";
-                ss << u8"    \"plPL\": \"Tron Zniszczenia\",\n";
-                ss << u8"    \"esMX\": \"Trono de la Destrucción\",\n";
-                ss << u8"    \"jaJP\": \"破壊の玉座\",\n";
-                ss << u8"    \"ptBR\": \"Trono da Destruição\",\n";
-                ss << u8"    \"ruRU\": \"Престол Разрушения\",\n";
-                ss << u8"    \"zhCN\": \"毁灭王座\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22668,\n";
-                ss << u8"    \"Key\": \"To Harrogath\",\n";
-                ss << u8"    \"enUS\": \"To Harrogath\",\n";
-                ss << u8"    \"zhTW\": \"前往哈洛加斯\",\n";
-                ss << u8"    \"deDE\": \"Nach Harrogath\",\n";
-                ss << u8"    \"esES\": \"A Harrogath\",\n";
-                ss << u8"    \"frFR\": \"Vers Harrogath\",\n";
-                ss << u8"    \"itIT\": \"Per Harrogath\",\n";
-                ss << u8"    \"koKR\": \"하로가스로 이동\",\n";
-                ss << u8"    \"plPL\": \"Harrogath\",\n";
-                ss << u8"    \"esMX\": \"A Harrogat\",\n";
-                ss << u8"    \"jaJP\": \"ハロガスへ\",\n";
-                ss << u8"    \"ptBR\": \"Para Harrogath\",\n";
-                ss << u8"    \"ruRU\": \"В Харрогат\",\n";
-                ss << u8"    \"zhCN\": \"前往哈洛加斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22669,\n";
-                ss << u8"    \"Key\": \"To The Bloody Foothills\",\n";
-                ss << u8"    \"enUS\": \"To The Bloody Foothills\",\n";
-                ss << u8"    \"zhTW\": \"前往血腥丘陵\",\n";
-                ss << u8"    \"deDE\": \"Zum Blutigen Vorgebirge\",\n";
-                ss << u8"    \"esES\": \"A las Estribaciones Sangrientas\",\n";
-                ss << u8"    \"frFR\": \"Vers les Collines Sanglantes\",\n";
-                ss << u8"    \"itIT\": \"Per le Colline Insanguinate\",\n";
-                ss << u8"    \"koKR\": \"핏빛 언덕으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Krwawe Wzgórza\",\n";
-                ss << u8"    \"esMX\": \"A las Laderas Sangrientas\",\n";
-                ss << u8"    \"jaJP\": \"血に塗れし丘陵へ\",\n";
-                ss << u8"    \"ptBR\": \"Para as Colinas Sangrentas\",\n";
-                ss << u8"    \"ruRU\": \"В Кровавые предгорья\",\n";
-                ss << u8"    \"zhCN\": \"前往血腥丘陵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22670,\n";
-                ss << u8"    \"Key\": \"To The Rigid Highlands\",\n";
-                ss << u8"    \"enUS\": \"To The Frigid Highlands\",\n";
-                ss << u8"    \"zhTW\": \"前往冰凍高地\",\n";
-                ss << u8"    \"deDE\": \"Zum Eishochland\",\n";
-                ss << u8"    \"esES\": \"A las Tierras Altas Glaciales\",\n";
-                ss << u8"    \"frFR\": \"Vers les Hautes-Glaces\",\n";
-                ss << u8"    \"itIT\": \"Per gli Altopiani del Gelo\",\n";
-                ss << u8"    \"koKR\": \"혹한의 고산지로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zlodowaciała Wyżyna\",\n";
-                ss << u8"    \"esMX\": \"A las Tierras Altas Gélidas\",\n";
-                ss << u8"    \"jaJP\": \"極寒の高原へ\",\n";
-                ss << u8"    \"ptBR\": \"Para as Terras Altas Gélidas\",\n";
-                ss << u8"    \"ruRU\": \"На Мерзлое нагорье\",\n";
-                ss << u8"    \"zhCN\": \"前往冰冻高地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22671,\n";
-                ss << u8"    \"Key\": \"To The Arreat Plateau\",\n";
-                ss << u8"    \"enUS\": \"To The Arreat Plateau\",\n";
-                ss << u8"    \"zhTW\": \"前往亞瑞特高原\",\n";
-                ss << u8"    \"deDE\": \"Zur Arreathochebene\",\n";
-                ss << u8"    \"esES\": \"A la Meseta Arreat\",\n";
-                ss << u8"    \"frFR\": \"Vers le Mont Arreat\",\n";
-                ss << u8"    \"itIT\": \"Per il Plateau dell'Arreat\",\n";
-                ss << u8"    \"koKR\": \"아리앗 고원으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Płaskowyż Arreat\",\n";
-                ss << u8"    \"esMX\": \"A la Planicie de Arreat\",\n";
-                ss << u8"    \"jaJP\": \"アリート高地へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Platô de Arreat\",\n";
-                ss << u8"    \"ruRU\": \"На Арреатское плато\",\n";
-                ss << u8"    \"zhCN\": \"前往亚瑞特高原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22672,\n";
-                ss << u8"    \"Key\": \"To The Crystalized Cavern Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Crystalline Passage\",\n";
-                ss << u8"    \"zhTW\": \"前往水晶通道\",\n";
-                ss << u8"    \"deDE\": \"Zum Kristalldurchgang\",\n";
-                ss << u8"    \"esES\": \"Al Pasaje Cristalino\",\n";
-                ss << u8"    \"frFR\": \"Vers le Passage Cristallin\",\n";
-                ss << u8"    \"itIT\": \"Per il Passaggio Cristallino\",\n";
-                ss << u8"    \"koKR\": \"수정 동굴로 이동\",\n";
-                ss << u8"    \"plPL\": \"Kryształowe Przejście\",\n";
-                ss << u8"    \"esMX\": \"Al Pasaje Cristalino\",\n";
-                ss << u8"    \"jaJP\": \"結晶道へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Passagem Cristalina\",\n";
-                ss << u8"    \"ruRU\": \"В Ледяные пещеры\",\n";
-                ss << u8"    \"zhCN\": \"前往水晶通道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22673,\n";
-                ss << u8"    \"Key\": \"To The Cellar of Pity\",\n";
-                ss << u8"    \"enUS\": \"To The Frozen River\",\n";
-                ss << u8"    \"zhTW\": \"前往冰凍之河\",\n";
-                ss << u8"    \"deDE\": \"Zum Frostfluss\",\n";
-                ss << u8"    \"esES\": \"Al Río Helado\",\n";
-                ss << u8"    \"frFR\": \"Vers la Rivière Glacée\",\n";
-                ss << u8"    \"itIT\": \"Per il Fiume Gelido\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 강으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zamarznięta Rzeka\",\n";
-                ss << u8"    \"esMX\": \"Al Río Congelado\",\n";
-                ss << u8"    \"jaJP\": \"凍てつく川へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Rio Congelado\",\n";
-                ss << u8"    \"ruRU\": \"К Замерзшей реке\",\n";
-                ss << u8"    \"zhCN\": \"前往冰冻之河\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22674,\n";
-                ss << u8"    \"Key\": \"To The Crystalized Cavern Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Glacial Trail\",\n";
-                ss << u8"    \"zhTW\": \"前往冰河小徑\",\n";
-                ss << u8"    \"deDE\": \"Zum Gletscherweg\",\n";
-                ss << u8"    \"esES\": \"A la Senda Glacial\",\n";
-                ss << u8"    \"frFR\": \"Vers la Piste des Glaces\",\n";
-                ss << u8"    \"itIT\": \"Per il Sentiero Ghiacciato\",\n";
-                ss << u8"    \"koKR\": \"빙하의 길로 이동\",\n";
-                ss << u8"    \"plPL\": \"Lodowy Trakt\",\n";
-                ss << u8"    \"esMX\": \"Al Sendero Glacial\",\n";
-                ss << u8"    \"jaJP\": \"氷の道へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Trilha Glacial\",\n";
-                ss << u8"    \"ruRU\": \"В Ледовый ход\",\n";
-                ss << u8"    \"zhCN\": \"前往冰川小径\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22675,\n";
-                ss << u8"    \"Key\": \"To The Echo Chamber\",\n";
-                ss << u8"    \"enUS\": \"To The Drifter Cavern\",\n";
-                ss << u8"    \"zhTW\": \"前往漂泊者洞窟\",\n";
-                ss << u8"    \"deDE\": \"Zur Flockenhöhle\",\n";
-                ss << u8"    \"esES\": \"A la Caverna del Errante\",\n";
-                ss << u8"    \"frFR\": \"Vers la Caverne du Yéti\",\n";
-                ss << u8"    \"itIT\": \"Per la Caverna Serpeggiante\",\n";
-                ss << u8"    \"koKR\": \"부랑자의 동굴로 이동\",\n";
-                ss << u8"    \"plPL\": \"Grota Tułaczy\",\n";
-                ss << u8"    \"esMX\": \"A la Caverna del Morador\",\n";
-                ss << u8"    \"jaJP\": \"流れ者の洞窟へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Caverna do Errante\",\n";
-                ss << u8"    \"ruRU\": \"В Пещеру скитальцев\",\n";
-                ss << u8"    \"zhCN\": \"前往漂流洞窟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22676,\n";
-                ss << u8"    \"Key\": \"To The Tundra Wastelands\",\n";
-                ss << u8"    \"enUS\": \"To The Frozen Tundra\",\n";
-                ss << u8"    \"zhTW\": \"前往冰凍苔原\",\n";
-                ss << u8"    \"deDE\": \"Zur Eistundra\",\n";
-                ss << u8"    \"esES\": \"A la Tundra Helada\",\n";
-                ss << u8"    \"frFR\": \"Vers la Toundra Glacée\",\n";
-                ss << u8"    \"itIT\": \"Per la Tundra Congelata\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 동토로 이동\",\n";
-                ss << u8"    \"plPL\": \"Zamarznięta Tundra\",\n";
-                ss << u8"    \"esMX\": \"A la Tundra Congelada\",\n";
-                ss << u8"    \"jaJP\": \"氷結の凍原へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Tundra Congelada\",\n";
-                ss << u8"    \"ruRU\": \"В Морозную тундру\",\n";
-                ss << u8"    \"zhCN\": \"前往冰冻苔原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22677,\n";
-                ss << u8"    \"Key\": \"To The Glacier Caves Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Ancients' Way\",\n";
-                ss << u8"    \"zhTW\": \"前往先祖之路\",\n";
-                ss << u8"    \"deDE\": \"Zum Weg der Urahnen\",\n";
-                ss << u8"    \"esES\": \"Al Camino de los Antiguos\",\n";
-                ss << u8"    \"frFR\": \"Vers le Chemin des Anciens\",\n";
-                ss << u8"    \"itIT\": \"Per la Via degli Antichi\",\n";
-                ss << u8"    \"koKR\": \"고대인의 길로 이동\",\n";
-                ss << u8"    \"plPL\": \"Droga Starożytnych\",\n";
-                ss << u8"    \"esMX\": \"Al Camino de los Ancestros\",\n";
-                ss << u8"    \"jaJP\": \"古の民の通り道へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Caminho dos Ancestrais\",\n";
-                ss << u8"    \"ruRU\": \"К Пути Древних\",\n";
-                ss << u8"    \"zhCN\": \"前往先祖之路\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22678,\n";
-                ss << u8"    \"Key\": \"To The Glacier Caves Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Icy Cellar\",\n";
-                ss << u8"    \"zhTW\": \"前往冰窖\",\n";
-                ss << u8"    \"deDE\": \"Zum Eiskeller\",\n";
-                ss << u8"    \"esES\": \"Al Sótano Helado\",\n";
-                ss << u8"    \"frFR\": \"Vers la Cave Glaciale\",\n";
-                ss << u8"    \"itIT\": \"Per il Sotterraneo di Ghiaccio\",\n";
-                ss << u8"    \"koKR\": \"얼음 지하실로 이동\",\n";
-                ss << u8"    \"plPL\": \"Lodowa Piwnica\",\n";
-                ss << u8"    \"esMX\": \"A la Caverna Helada\",\n";
-                ss << u8"    \"jaJP\": \"氷の穴ぐらへ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Porão Gélido\",\n";
-                ss << u8"    \"ruRU\": \"В Ледяной грот\",\n";
-                ss << u8"    \"zhCN\": \"前往寒冰地窖\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22679,\n";
-                ss << u8"    \"Key\": \"To The Rocky Summit\",\n";
-                ss << u8"    \"enUS\": \"To The Arreat Summit\",\n";
-                ss << u8"    \"zhTW\": \"前往亞瑞特山巔\",\n";
-                ss << u8"    \"deDE\": \"Zum Gipfel des Arreat\",\n";
-                ss << u8"    \"esES\": \"A la Cima Arreat\",\n";
-                ss << u8"    \"frFR\": \"Vers le Sommet Arreat\",\n";
-                ss << u8"    \"itIT\": \"Per la Sommità dell'Arreat\",\n";
-                ss << u8"    \"koKR\": \"아리앗 정상으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Szczyt Arreat\",\n";
-                ss << u8"    \"esMX\": \"A la Cima de Arreat\",\n";
-                ss << u8"    \"jaJP\": \"アリート山の頂きへ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Cume de Arreat\",\n";
-                ss << u8"    \"ruRU\": \"На вершину Арреата\",\n";
-                ss << u8"    \"zhCN\": \"前往亚瑞特之巅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22680,\n";
-                ss << u8"    \"Key\": \"To Nihlathaks Temple\",\n";
-                ss << u8"    \"enUS\": \"To Nihlathak's Temple\",\n";
-                ss << u8"    \"zhTW\": \"前往尼拉塞克的神殿\",\n";
-                ss << u8"    \"deDE\": \"Zu Nihlathaks Tempel\",\n";
-                ss << u8"    \"esES\": \"Al Templo de Nihlathak\",\n";
-                ss << u8"    \"frFR\": \"Vers le Temple de Nihlathak\",\n";
-                ss << u8"    \"itIT\": \"Per il Tempio di Nihlathak\",\n";
-                ss << u8"    \"koKR\": \"니흘라탁의 사원으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Świątynia Nihlathaka\",\n";
-                ss << u8"    \"esMX\": \"Al Templo de Nihlathak\",\n";
-                ss << u8"    \"jaJP\": \"ニーラサックの寺院へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Templo de Nilatak\",\n";
-                ss << u8"    \"ruRU\": \"В храм Нильятака\",\n";
-                ss << u8"    \"zhCN\": \"前往尼拉塞克的神殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22681,\n";
-                ss << u8"    \"Key\": \"To The Halls of Anguish\",\n";
-                ss << u8"    \"enUS\": \"To The Halls of Anguish\",\n";
-                ss << u8"    \"zhTW\": \"前往怨慟之廳\",\n";
-                ss << u8"    \"deDE\": \"Zu den Hallen der Qual\",\n";
-                ss << u8"    \"esES\": \"A las Salas de la Angustia\",\n";
-                ss << u8"    \"frFR\": \"Vers les Corridors de l’Angoisse\",\n";
-                ss << u8"    \"itIT\": \"Per le Sale dell'Angoscia\",\n";
-                ss << u8"    \"koKR\": \"고뇌의 전당으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Sale Cierpienia\",\n";
-                ss << u8"    \"esMX\": \"A las Salas de la Angustia\",\n";
-                ss << u8"    \"jaJP\": \"苦悶の広間へ\",\n";
-                ss << u8"    \"ptBR\": \"Para os Salões da Angústia\",\n";
-                ss << u8"    \"ruRU\": \"В Чертоги Мучений\",\n";
-                ss << u8"    \"zhCN\": \"前往痛楚大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22682,\n";
-                ss << u8"    \"Key\": \"To The Halls of Death's Calling\",\n";
-                ss << u8"    \"enUS\": \"To The Halls of Pain\",\n";
-                ss << u8"    \"zhTW\": \"前往苦痛之廳\",\n";
-                ss << u8"    \"deDE\": \"Zu den Hallen der Schmerzen\",\n";
-                ss << u8"    \"esES\": \"A las Salas del Dolor\",\n";
-                ss << u8"    \"frFR\": \"Vers les Corridors de la Souffrance\",\n";
-                ss << u8"    \"itIT\": \"Per le Sale del Dolore\",\n";
-                ss << u8"    \"koKR\": \"고통의 전당으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Sale Bólu\",\n";
-                ss << u8"    \"esMX\": \"A las Salas del Dolor\",\n";
-                ss << u8"    \"jaJP\": \"苦痛の広間へ\",\n";
-                ss << u8"    \"ptBR\": \"Para os Salões da Dor\",\n";
-                ss << u8"    \"ruRU\": \"В Чертоги Боли\",\n";
-                ss << u8"    \"zhCN\": \"前往苦痛大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22683,\n";
-                ss << u8"    \"Key\": \"To The Halls of Tormented Insanity\",\n";
-                ss << u8"    \"enUS\": \"To The Halls of Torment\",\n";
-                ss << u8"    \"zhTW\": \"前往折磨之廳\",\n";
-                ss << u8"    \"deDE\": \"Zu den Hallen der Pein\",\n";
-                ss << u8"    \"esES\": \"A las Salas del Tormento\",\n";
-                ss << u8"    \"frFR\": \"Vers les Corridors de l’Expiation\",\n";
-                ss << u8"    \"itIT\": \"Per le Sale del Tormento\",\n";
-                ss << u8"    \"koKR\": \"고문의 전당으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Do Sal Udręki\",\n";
-                ss << u8"    \"esMX\": \"A las Salas del Tormento\",\n";
-                ss << u8"    \"jaJP\": \"苦悩の広間へ\",\n";
-                ss << u8"    \"ptBR\": \"Para os Salões do Tormento\",\n";
-                ss << u8"    \"ruRU\": \"В Чертоги Страданий\",\n";
-                ss << u8"    \"zhCN\": \"前往折磨大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22684,\n";
-                ss << u8"    \"Key\": \"To The Halls of Vaught\",\n";
-                ss << u8"    \"enUS\": \"To The Halls of Vaught\",\n";
-                ss << u8"    \"zhTW\": \"前往沃特之廳\",\n";
-                ss << u8"    \"deDE\": \"Zu den Hallen von Vaught\",\n";
-                ss << u8"    \"esES\": \"A las Salas de Vaught\",\n";
-                ss << u8"    \"frFR\": \"Vers les Corridors du Martyre\",\n";
-                ss << u8"    \"itIT\": \"Per le Sale di Vaught\",\n";
-                ss << u8"    \"koKR\": \"보트의 전당으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Sale Nieszczęścia\",\n";
-                ss << u8"    \"esMX\": \"A las Salas de Vaught\",\n";
-                ss << u8"    \"jaJP\": \"ヴォートの広間へ\",\n";
-                ss << u8"    \"ptBR\": \"Para os Salões de Vaught\",\n";
-                ss << u8"    \"ruRU\": \"В Чертоги Воута\",\n";
-                ss << u8"    \"zhCN\": \"前往沃特大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22685,\n";
-                ss << u8"    \"Key\": \"To The Worldstone Keep Level 1\",\n";
-                ss << u8"    \"enUS\": \"To The Worldstone Keep Level 1\",\n";
-                ss << u8"    \"zhTW\": \"前往世界之石要塞第一層\",\n";
-                ss << u8"    \"deDE\": \"Zum Weltsteinturm, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Al nivel 1 de la Torre de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"Vers le donjon de la Pierre-Monde niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Per il Forte della Pietra del Mondo L1\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채 1층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"A la Fortaleza de la Piedra Ecuménica Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"ワールドストーン城塞: 第1階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Forte da Pedra do Mundo Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"На 1-й уровень Цитадели Мироздания\",\n";
-                ss << u8"    \"zhCN\": \"前往世界之石要塞一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22686,\n";
-                ss << u8"    \"Key\": \"To The Worldstone Keep Level 2\",\n";
-                ss << u8"    \"enUS\": \"To The Worldstone Keep Level 2\",\n";
-                ss << u8"    \"zhTW\": \"前往世界之石要塞第二層\",\n";
-                ss << u8"    \"deDE\": \"Zum Weltsteinturm, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Al nivel 2 de la Torre de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"Vers le donjon de la Pierre-Monde niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Per il Forte della Pietra del Mondo L2\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채 2층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"A la Fortaleza de la Piedra Ecuménica Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"ワールドストーン城塞: 第2階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Forte da Pedra do Mundo Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"На 2-й уровень Цитадели Мироздания\",\n";
-                ss << u8"    \"zhCN\": \"前往世界之石要塞二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22687,\n";
-                ss << u8"    \"Key\": \"To The Worldstone Keep Level 3\",\n";
-                ss << u8"    \"enUS\": \"To The Worldstone Keep Level 3\",\n";
-                ss << u8"    \"zhTW\": \"前往世界之石要塞第三層\",\n";
-                ss << u8"    \"deDE\": \"Zum Weltsteinturm, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Al nivel 3 de la Torre de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"Vers le donjon de la Pierre-Monde niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Per il Forte della Pietra del Mondo L3\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채 3층으로 이동\",\n";
-                ss << u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"A la Fortaleza de la Piedra Ecuménica Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"ワールドストーン城塞: 第3階層へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Forte da Pedra do Mundo Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"На 3-й уровень Цитадели Мироздания\",\n";
-                ss << u8"    \"zhCN\": \"前往世界之石要塞三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22688,\n";
-                ss << u8"    \"Key\": \"To The Worldstone Chamber\",\n";
-                ss << u8"    \"enUS\": \"To The Worldstone Chamber\",\n";
-                ss << u8"    \"zhTW\": \"前往世界之石大殿\",\n";
-                ss << u8"    \"deDE\": \"Zur Kammer des Weltsteins\",\n";
-                ss << u8"    \"esES\": \"A la Cámara de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"Vers la Chambre de la Pierre-Monde\",\n";
-                ss << u8"    \"itIT\": \"Per le Sale della Pietra del Mondo\",\n";
-                ss << u8"    \"koKR\": \"세계석 보관실로 이동\",\n";
-                ss << u8"    \"plPL\": \"Komnata Kamienia Świata\",\n";
-                ss << u8"    \"esMX\": \"A la Cámara de la Piedra Ecuménica\",\n";
-                ss << u8"    \"jaJP\": \"ワールドストーンの間へ\",\n";
-                ss << u8"    \"ptBR\": \"Para a Câmara da Pedra do Mundo\",\n";
-                ss << u8"    \"ruRU\": \"В Святилище Мироздания\",\n";
-                ss << u8"    \"zhCN\": \"前往世界之石大殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22689,\n";
-                ss << u8"    \"Key\": \"To The Throne of Destruction\",\n";
-                ss << u8"    \"enUS\": \"To The Throne of Destruction\",\n";
-                ss << u8"    \"zhTW\": \"前往毀滅王座\",\n";
-                ss << u8"    \"deDE\": \"Zum Thron der Zerstörung\",\n";
-                ss << u8"    \"esES\": \"Al Trono de la Destrucción\",\n";
-                ss << u8"    \"frFR\": \"Vers le Trône de la Destruction\",\n";
-                ss << u8"    \"itIT\": \"Per il Trono della Distruzione\",\n";
-                ss << u8"    \"koKR\": \"파괴의 왕좌로 이동\",\n";
-                ss << u8"    \"plPL\": \"Tron Zniszczenia\",\n";
-                ss << u8"    \"esMX\": \"Al Trono de la Destrucción\",\n";
-                ss << u8"    \"jaJP\": \"破壊の玉座へ\",\n";
-                ss << u8"    \"ptBR\": \"Para o Trono da Destruição\",\n";
-                ss << u8"    \"ruRU\": \"К Престолу Разрушения\",\n";
-                ss << u8"    \"zhCN\": \"前往毁灭王座\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22765,\n";
-                ss << u8"    \"Key\": \"EnteringTheRogueEncampment\",\n";
-                ss << u8"    \"enUS\": \"Entering The Rogue Encampment\",\n";
-                ss << u8"    \"zhTW\": \"進入俠盜營地\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Lager der Jägerinnen\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Campamento de las Arpías\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Camp des Rogues\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Campo delle Scolte\",\n";
-                ss << u8"    \"koKR\": \"자매단 야영지에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Obozowiska Łotrzyc\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Campamento de Renegadas\",\n";
-                ss << u8"    \"jaJP\": \"〈ローグの野営地〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Acampamento Renegado\",\n";
-                ss << u8"    \"ruRU\": \"Лагерь разбойниц\",\n";
-                ss << u8"    \"zhCN\": \"进入流亡者营地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22766,\n";
-                ss << u8"    \"Key\": \"EnteringTheBloodMoor\",\n";
-                ss << u8"    \"enUS\": \"Entering The Blood Moor\",\n";
-                ss << u8"    \"zhTW\": \"進入鮮血荒地\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Blutmoor\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Landa de Sangre\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Lande sanglante\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Lande Insanguinate\",\n";
-                ss << u8"    \"koKR\": \"핏빛 황무지에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Krwawe Wrzosowisko\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Páramo Sangriento\",\n";
-                ss << u8"    \"jaJP\": \"〈血の荒野〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Charco Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Кровавая пустошь\",\n";
-                ss << u8"    \"zhCN\": \"进入鲜血荒地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22767,\n";
-                ss << u8"    \"Key\": \"EnteringTheColdPlains\",\n";
-                ss << u8"    \"enUS\": \"Entering The Cold Plains\",\n";
-                ss << u8"    \"zhTW\": \"進入冰冷之原\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Kalte Ebene\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Llanuras Frías\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Plaines gelées\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Pianure Gelate\",\n";
-                ss << u8"    \"koKR\": \"차가운 평야에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Zimną Równinę\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Llanuras Heladas\",\n";
-                ss << u8"    \"jaJP\": \"〈荒涼の平原〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Planície Gélida\",\n";
-                ss << u8"    \"ruRU\": \"Стылые равнины\",\n";
-                ss << u8"    \"zhCN\": \"进入冰冷之原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22768,\n";
-                ss << u8"    \"Key\": \"EnteringTheStonyField\",\n";
-                ss << u8"    \"enUS\": \"Entering The Stony Field\",\n";
-                ss << u8"    \"zhTW\": \"進入亂石曠野\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Feld der Steine\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Campo Pedregoso\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Champ de pierres\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Campo di Pietra\",\n";
-                ss << u8"    \"koKR\": \"바위 벌판에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Kamienne Pole\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Campo Rocoso\",\n";
-                ss << u8"    \"jaJP\": \"〈石の原野〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Campo Rochoso\",\n";
-                ss << u8"    \"ruRU\": \"Каменистое поле\",\n";
-                ss << u8"    \"zhCN\": \"进入石块旷野\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22769,\n";
-                ss << u8"    \"Key\": \"EnteringTheDarkWood\",\n";
-                ss << u8"    \"enUS\": \"Entering The Dark Wood\",\n";
-                ss << u8"    \"zhTW\": \"進入黑暗森林\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Dunkelwald\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Bosque Oscuro\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Bois obscur\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Foresta Oscura\",\n";
-                ss << u8"    \"koKR\": \"어둠숲에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Mrocznej Kniei\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Bosque Oscuro\",\n";
-                ss << u8"    \"jaJP\": \"〈常闇の森〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Floresta Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Темнолесье\",\n";
-                ss << u8"    \"zhCN\": \"进入黑暗森林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22770,\n";
-                ss << u8"    \"Key\": \"EnteringTheBlackMarsh\",\n";
-                ss << u8"    \"enUS\": \"Entering The Black Marsh\",\n";
-                ss << u8"    \"zhTW\": \"進入黑色荒地\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Schwarzmoor\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Pantano Negro\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Marais sombre\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Palude Nera\",\n";
-                ss << u8"    \"koKR\": \"검은 습지에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Czarne Moczary\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Marisma Oscura\",\n";
-                ss << u8"    \"jaJP\": \"〈黒の湿原〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Charco Tenebroso\",\n";
-                ss << u8"    \"ruRU\": \"Черная топь\",\n";
-                ss << u8"    \"zhCN\": \"进入黑色沼泽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22771,\n";
-                ss << u8"    \"Key\": \"EnteringTheTamoeHighland\",\n";
-                ss << u8"    \"enUS\": \"Entering The Tamoe Highland\",\n";
-                ss << u8"    \"zhTW\": \"進入泰摩高地\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Tamohochland\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Tierras Altas de Tamoe\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Hautes-Terres de Tamoe\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Altopiano di Tamoe\",\n";
-                ss << u8"    \"koKR\": \"타모 고원에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Wyżynę Tamoe\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Tierras Altas de Tamoe\",\n";
-                ss << u8"    \"jaJP\": \"〈タモエ高原〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Planalto Tamoe\",\n";
-                ss << u8"    \"ruRU\": \"Нагорье Тамоэ\",\n";
-                ss << u8"    \"zhCN\": \"进入泰摩高地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22772,\n";
-                ss << u8"    \"Key\": \"EnteringTheDenOfEvilInQuest\",\n";
-                ss << u8"    \"enUS\": \"Entering The Den of Evil\",\n";
-                ss << u8"    \"zhTW\": \"進入邪惡洞窟\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Höhle des Bösen\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Cubil del Mal\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Repaire du Mal\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Antro del Male\",\n";
-                ss << u8"    \"koKR\": \"악의 소굴에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Siedliska Zła\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Guarida del Mal\",\n";
-                ss << u8"    \"jaJP\": \"〈邪悪の巣窟〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Covil do Mal\",\n";
-                ss << u8"    \"ruRU\": \"Логово зла\",\n";
-                ss << u8"    \"zhCN\": \"进入邪恶洞穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22773,\n";
-                ss << u8"    \"Key\": \"EnteringTheDenOfEvilPostQuest\",\n";
-                ss << u8"    \"enUS\": \"Entering The Cave Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入洞穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Grotte, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de la Cueva\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Grotte niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Caverna L1\",\n";
-                ss << u8"    \"koKR\": \"동굴 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Jaskini – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Cueva Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈洞窟: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Caverna Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень пещеры\",\n";
-                ss << u8"    \"zhCN\": \"进入洞穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22774,\n";
-                ss << u8"    \"Key\": \"EnteringTheCaveLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Cave Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入洞穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Grotte, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de la Cueva\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Grotte niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Caverna L1\",\n";
-                ss << u8"    \"koKR\": \"동굴 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Jaskini – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Cueva Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈洞窟: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Caverna Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень пещеры\",\n";
-                ss << u8"    \"zhCN\": \"进入洞穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22775,\n";
-                ss << u8"    \"Key\": \"EnteringUndergroundPassageLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Underground Passage Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入地底通道第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Unterirdische Durchgang, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 del Pasadizo Subterráneo\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Passage souterrain niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Passaggio Sotterraneo L1\",\n";
-                ss << u8"    \"koKR\": \"지하 통로 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Podziemnego Tunelu – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Pasaje Subterráneo Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈地下道: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Passagem Subterrânea Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень подземного прохода\",\n";
-                ss << u8"    \"zhCN\": \"进入地下通道一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22776,\n";
-                ss << u8"    \"Key\": \"EnteringTheHoleLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Hole Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入地洞第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Loch, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 del Hoyo\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Gouffre niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Buco L1\",\n";
-                ss << u8"    \"koKR\": \"구렁 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Jamy – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Agujero Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈洞穴: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Buraco Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень норы\",\n";
-                ss << u8"    \"zhCN\": \"进入洞坑一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22777,\n";
-                ss << u8"    \"Key\": \"EnteringThePitLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Pit Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入地穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Grube, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 del Foso\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Fosse niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Abisso L1\",\n";
-                ss << u8"    \"koKR\": \"구덩이 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Czeluści – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Foso Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈穴ぐら: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Fosso Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень ямы\",\n";
-                ss << u8"    \"zhCN\": \"进入深渊一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22778,\n";
-                ss << u8"    \"Key\": \"EnteringTheCaveLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Cave Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入洞穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Grotte, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 de la Cueva\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Grotte niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Caverna L2\",\n";
-                ss << u8"    \"koKR\": \"동굴 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Jaskini – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Cueva Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈洞窟: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Caverna Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень пещеры\",\n";
-                ss << u8"    \"zhCN\": \"进入洞穴二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22779,\n";
-                ss << u8"    \"Key\": \"EnteringUndergroundPassageLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Underground Passage Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入地底通道第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Unterirdische Durchgang, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 del Pasadizo Subterráneo\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Passage souterrain niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Passaggio Sotterraneo L2\",\n";
-                ss << u8"    \"koKR\": \"지하 통로 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Podziemnego Tunelu – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Pasaje Subterráneo Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈地下道: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Passagem Subterrânea Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень подземного прохода\",\n";
-                ss << u8"    \"zhCN\": \"进入地下通道二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22780,\n";
-                ss << u8"    \"Key\": \"EnteringTheHoleLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Hole Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入地洞第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Loch, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 del Hoyo\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Gouffre niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Buco L2\",\n";
-                ss << u8"    \"koKR\": \"구렁 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Jamy – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Agujero Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈洞穴: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Buraco Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень норы\",\n";
-                ss << u8"    \"zhCN\": \"进入洞坑二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22781,\n";
-                ss << u8"    \"Key\": \"EnteringThePitLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Pit Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入地穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Grube, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 del Foso\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Fosse niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Abisso L2\",\n";
-                ss << u8"    \"koKR\": \"구덩이 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Czeluści – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Foso Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈穴ぐら: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Fosso Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень ямы\",\n";
-                ss << u8"    \"zhCN\": \"进入深渊二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22782,\n";
-                ss << u8"    \"Key\": \"EnteringTheBurialGrounds\",\n";
-                ss << u8"    \"enUS\": \"Entering The Burial Grounds\",\n";
-                ss << u8"    \"zhTW\": \"進入埋骨之地\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Friedhof\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Cementerio\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Cimetière\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Cimitero\",\n";
-                ss << u8"    \"koKR\": \"매장지에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Cmentarz\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Cementerio\",\n";
-                ss << u8"    \"jaJP\": \"〈墓地〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Cemitério\",\n";
-                ss << u8"    \"ruRU\": \"Погост\",\n";
-                ss << u8"    \"zhCN\": \"进入埋骨之地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22783,\n";
-                ss << u8"    \"Key\": \"EnteringTheCrypt\",\n";
-                ss << u8"    \"enUS\": \"Entering The Crypt\",\n";
-                ss << u8"    \"zhTW\": \"進入墓地\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Krypta\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Cripta\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Crypte\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Cripta\",\n";
-                ss << u8"    \"koKR\": \"묘실에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Krypty\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Cripta\",\n";
-                ss << u8"    \"jaJP\": \"〈地下墓所〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Cripta\",\n";
-                ss << u8"    \"ruRU\": \"Склеп\",\n";
-                ss << u8"    \"zhCN\": \"进入墓穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22784,\n";
-                ss << u8"    \"Key\": \"EnteringTheMausoleum\",\n";
-                ss << u8"    \"enUS\": \"Entering The Mausoleum\",\n";
-                ss << u8"    \"zhTW\": \"進入大陵墓\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Mausoleum\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Mausoleo\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Mausolée\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Mausoleo\",\n";
-                ss << u8"    \"koKR\": \"영묘에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Mauzoleum\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Mausoleo\",\n";
-                ss << u8"    \"jaJP\": \"〈霊廟〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Mausoléu\",\n";
-                ss << u8"    \"ruRU\": \"Мавзолей\",\n";
-                ss << u8"    \"zhCN\": \"进入寝陵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22785,\n";
-                ss << u8"    \"Key\": \"EnteringTheForgottenTower\",\n";
-                ss << u8"    \"enUS\": \"Entering The Forgotten Tower\",\n";
-                ss << u8"    \"zhTW\": \"進入遺忘之塔\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Vergessene Turm\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Torre Olvidada\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Tour oubliée\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Torre Dimenticata\",\n";
-                ss << u8"    \"koKR\": \"잊힌 탑에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Zapomnianej Wieży\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Torre Olvidada\",\n";
-                ss << u8"    \"jaJP\": \"〈忘れ去られし塔〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Torre Esquecida\",\n";
-                ss << u8"    \"ruRU\": \"Заброшенная башня\",\n";
-                ss << u8"    \"zhCN\": \"进入被遗忘的高塔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22786,\n";
-                ss << u8"    \"Key\": \"EnteringTheTowerCellarLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Tower Cellar Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入高塔地牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L1\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈塔の地下室: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"进入高塔地窖一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22787,\n";
-                ss << u8"    \"Key\": \"EnteringTheTowerCellarLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Tower Cellar Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入高塔地牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L2\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈塔の地下室: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"进入高塔地窖二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22788,\n";
-                ss << u8"    \"Key\": \"EnteringTheTowerCellarLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Tower Cellar Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入高塔地牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L3\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈塔の地下室: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"进入高塔地窖三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22789,\n";
-                ss << u8"    \"Key\": \"EnteringTheTowerCellarLevel4\",\n";
-                ss << u8"    \"enUS\": \"Entering The Tower Cellar Level 4\",\n";
-                ss << u8"    \"zhTW\": \"進入高塔地牢第四層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 4\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 4 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 4\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L4\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 4층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 4\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 4\",\n";
-                ss << u8"    \"jaJP\": \"〈塔の地下室: 第4階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 4\",\n";
-                ss << u8"    \"ruRU\": \"4-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"进入高塔地窖四层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22790,\n";
-                ss << u8"    \"Key\": \"EnteringTheTowerCellarLevel5\",\n";
-                ss << u8"    \"enUS\": \"Entering The Tower Cellar Level 5\",\n";
-                ss << u8"    \"zhTW\": \"進入高塔地牢第五層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 5\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 5 del Sótano de la Torre\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 5\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L5\",\n";
-                ss << u8"    \"koKR\": \"탑 지하 5층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 5\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 5\",\n";
-                ss << u8"    \"jaJP\": \"〈塔の地下室: 第5階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 5\",\n";
-                ss << u8"    \"ruRU\": \"5-й уровень подвала башни\",\n";
-                ss << u8"    \"zhCN\": \"进入高塔地窖五层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22791,\n";
-                ss << u8"    \"Key\": \"EnteringTheMonasteryGate\",\n";
-                ss << u8"    \"enUS\": \"Entering The Monastery Gate\",\n";
-                ss << u8"    \"zhTW\": \"進入修道院大門\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Klosterpforte\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Puertas del Monasterio\",\n";
-                ss << u8"    \"frFR\": \"Passe les Portes du Monastère\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Atrio del Monastero\",\n";
-                ss << u8"    \"koKR\": \"수도원 정문에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Klasztornej Bramy\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Entrada del Monasterio\",\n";
-                ss << u8"    \"jaJP\": \"〈修道院の門〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Portão do Monastério\",\n";
-                ss << u8"    \"ruRU\": \"Монастырские ворота\",\n";
-                ss << u8"    \"zhCN\": \"进入修道院大门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22792,\n";
-                ss << u8"    \"Key\": \"EnteringTheOuterCloister\",\n";
-                ss << u8"    \"enUS\": \"Entering The Outer Cloister\",\n";
-                ss << u8"    \"zhTW\": \"進入外側迴廊\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Äußere Kloster\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Claustro Exterior\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Cloître extérieur\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Chiostro Esterno\",\n";
-                ss << u8"    \"koKR\": \"외부 회랑에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Zewnętrznego Monastyru\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Claustro Exterior\",\n";
-                ss << u8"    \"jaJP\": \"〈修道院外部〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Claustro Externo\",\n";
-                ss << u8"    \"ruRU\": \"Внешний двор\",\n";
-                ss << u8"    \"zhCN\": \"进入外侧回廊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22793,\n";
-                ss << u8"    \"Key\": \"EnteringTheBarracks\",\n";
-                ss << u8"    \"enUS\": \"Entering The Barracks\",\n";
-                ss << u8"    \"zhTW\": \"進入兵營\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Kaserne\",\n";
-                ss << u8"    \"esES\": \"Entrando en los Barracones\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Caserne\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Caserma\",\n";
-                ss << u8"    \"koKR\": \"병영에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Koszar\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Cuartel\",\n";
-                ss << u8"    \"jaJP\": \"〈兵舎〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Quartel\",\n";
-                ss << u8"    \"ruRU\": \"Казармы\",\n";
-                ss << u8"    \"zhCN\": \"进入营房\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22794,\n";
-                ss << u8"    \"Key\": \"EnteringTheJailLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Jail Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入監牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Gefängnis, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de la Cárcel\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Prison niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Prigione L1\",\n";
-                ss << u8"    \"koKR\": \"감옥 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Więzienia – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Prisión Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈牢獄: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Prisão Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень тюрьмы\",\n";
-                ss << u8"    \"zhCN\": \"进入监牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22795,\n";
-                ss << u8"    \"Key\": \"EnteringTheJailLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Jail Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入監牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Gefängnis, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 de la Cárcel\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Prison niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Prigione L2\",\n";
-                ss << u8"    \"koKR\": \"감옥 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Więzienia – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Prisión Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈牢獄: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Prisão Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень тюрьмы\",\n";
-                ss << u8"    \"zhCN\": \"进入监牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22796,\n";
-                ss << u8"    \"Key\": \"EnteringTheJailLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Jail Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入監牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Gefängnis, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 de la Cárcel\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Prison niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Prigione L3\",\n";
-                ss << u8"    \"koKR\": \"감옥 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Więzienia – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Prisión Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈牢獄: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Prisão Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень тюрьмы\",\n";
-                ss << u8"    \"zhCN\": \"进入监牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22797,\n";
-                ss << u8"    \"Key\": \"EnteringTheInnerCloister\",\n";
-                ss << u8"    \"enUS\": \"Entering The Inner Cloister\",\n";
-                ss << u8"    \"zhTW\": \"進入內側迴廊\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Innere Kloster\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Claustro Interior\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Cloître intérieur\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Chiostro Interno\",\n";
-                ss << u8"    \"koKR\": \"내부 회랑에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Wewnętrznego Monastyru\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Claustro Interno\",\n";
-                ss << u8"    \"jaJP\": \"〈修道院内部〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Claustro Interno\",\n";
-                ss << u8"    \"ruRU\": \"Внутренний двор\",\n";
-                ss << u8"    \"zhCN\": \"进入内侧回廊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22798,\n";
-                ss << u8"    \"Key\": \"EnteringTheCathedral\",\n";
-                ss << u8"    \"enUS\": \"Entering The Cathedral\",\n";
-                ss << u8"    \"zhTW\": \"進入大教堂\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Kathedrale\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Catedral\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Cathédrale\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Cattedrale\",\n";
-                ss << u8"    \"koKR\": \"대성당에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Katedry\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Catedral\",\n";
-                ss << u8"    \"jaJP\": \"〈大聖堂〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Catedral\",\n";
-                ss << u8"    \"ruRU\": \"Собор\",\n";
-                ss << u8"    \"zhCN\": \"进入大教堂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22799,\n";
-                ss << u8"    \"Key\": \"EnteringTheCatacombsLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Catacombs Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入地下墓穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Katakomben, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de las Catacumbas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Catacombes niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Catacombe L1\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Katakumb – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Catacumbas Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈地下墓地: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Catacumbas Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень катакомб\",\n";
-                ss << u8"    \"zhCN\": \"进入地下墓穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22800,\n";
-                ss << u8"    \"Key\": \"EnteringTheCatacombsLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Catacombs Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入地下墓穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Katakomben, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 de las Catacumbas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Catacombes niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Catacombe L2\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Katakumb – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Catacumbas Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈地下墓地: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Catacumbas Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень катакомб\",\n";
-                ss << u8"    \"zhCN\": \"进入地下墓穴二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22801,\n";
-                ss << u8"    \"Key\": \"EnteringTheCatacombsLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Catacombs Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入地下墓穴第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Katakomben, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 de las Catacumbas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Catacombes niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Catacombe L3\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Katakumb – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Catacumbas Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈地下墓地: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Catacumbas Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень катакомб\",\n";
-                ss << u8"    \"zhCN\": \"进入地下墓穴三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22802,\n";
-                ss << u8"    \"Key\": \"EnteringTheCatacombsLevel4\",\n";
-                ss << u8"    \"enUS\": \"Entering The Catacombs Level 4\",\n";
-                ss << u8"    \"zhTW\": \"進入地下墓穴第四層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Katakomben, Ebene 4\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 4 de las Catacumbas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Catacombes niv. 4\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Catacombe L4\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지 4층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Katakumb – Poziom 4\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Catacumbas Nivel 4\",\n";
-                ss << u8"    \"jaJP\": \"〈地下墓地: 第4階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Catacumbas Nível 4\",\n";
-                ss << u8"    \"ruRU\": \"4-й уровень катакомб\",\n";
-                ss << u8"    \"zhCN\": \"进入地下墓穴四层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22803,\n";
-                ss << u8"    \"Key\": \"EnteringTristram\",\n";
-                ss << u8"    \"enUS\": \"Entering Tristram\",\n";
-                ss << u8"    \"zhTW\": \"進入崔斯特姆\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Tristram\",\n";
-                ss << u8"    \"esES\": \"Entrando en Tristán\",\n";
-                ss << u8"    \"frFR\": \"Entre dans Tristram\",\n";
-                ss << u8"    \"itIT\": \"Ingresso a Tristram\",\n";
-                ss << u8"    \"koKR\": \"트리스트럼에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Tristram\",\n";
-                ss << u8"    \"esMX\": \"Entrando a Tristram\",\n";
-                ss << u8"    \"jaJP\": \"〈トリストラム〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando em Tristram\",\n";
-                ss << u8"    \"ruRU\": \"Тристрам\",\n";
-                ss << u8"    \"zhCN\": \"进入崔斯特姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22804,\n";
-                ss << u8"    \"Key\": \"EnteringTheMooMooFarm\",\n";
-                ss << u8"    \"enUS\": \"Entering The Moo Moo Farm\",\n";
-                ss << u8"    \"zhTW\": \"進入哞哞農莊\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Muh-Muh-Farm\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Granja Mu Mu\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Ferme Meuh-Meuh\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Fattoria Muu Muu\",\n";
-                ss << u8"    \"koKR\": \"음메음메 농장에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Farmę Muu Muu\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Granja Mu Mu\",\n";
-                ss << u8"    \"jaJP\": \"〈秘密のモーモー牧場〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Fazenda Mu-mu\",\n";
-                ss << u8"    \"ruRU\": \"Ферма «Му-му»\",\n";
-                ss << u8"    \"zhCN\": \"进入哞哞农场\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22805,\n";
-                ss << u8"    \"Key\": \"EnteringLutGholein\",\n";
-                ss << u8"    \"enUS\": \"Entering Lut Gholein\",\n";
-                ss << u8"    \"zhTW\": \"進入魯高因\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Lut Gholein\",\n";
-                ss << u8"    \"esES\": \"Entrando en Lut Gholein\",\n";
-                ss << u8"    \"frFR\": \"Entre dans Lut Gholein\",\n";
-                ss << u8"    \"itIT\": \"Ingresso a Lut Gholein\",\n";
-                ss << u8"    \"koKR\": \"루트 골레인에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Lut Gholein\",\n";
-                ss << u8"    \"esMX\": \"Entrando a Lut Gholein\",\n";
-                ss << u8"    \"jaJP\": \"〈ラット・ゴーレイン〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando em Lut Gholein\",\n";
-                ss << u8"    \"ruRU\": \"Лут-Голейн\",\n";
-                ss << u8"    \"zhCN\": \"进入鲁·高因\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22806,\n";
-                ss << u8"    \"Key\": \"EnteringTheRockyWaste\",\n";
-                ss << u8"    \"enUS\": \"Entering The Rocky Waste\",\n";
-                ss << u8"    \"zhTW\": \"進入碎石荒地\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Felsige Öde\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Erial Rocoso\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Désert de roche\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Landa Rocciosa\",\n";
-                ss << u8"    \"koKR\": \"바위투성이 황무지에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Skalne Pustkowie\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Estepa Rocosa\",\n";
-                ss << u8"    \"jaJP\": \"〈岩だらけの荒れ地〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Ermo Rochoso\",\n";
-                ss << u8"    \"ruRU\": \"Каменистая пустошь\",\n";
-                ss << u8"    \"zhCN\": \"进入碎石荒野\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22807,\n";
-                ss << u8"    \"Key\": \"EnteringTheDryHills\",\n";
-                ss << u8"    \"enUS\": \"Entering The Dry Hills\",\n";
-                ss << u8"    \"zhTW\": \"進入乾土高地\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Verdorrten Hügel\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Colinas Áridas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Collines arides\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Colline Aride\",\n";
-                ss << u8"    \"koKR\": \"메마른 언덕에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Suche Wzgórza\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Colinas Áridas\",\n";
-                ss << u8"    \"jaJP\": \"〈乾きの丘〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Colinas Áridas\",\n";
-                ss << u8"    \"ruRU\": \"Иссохшие холмы\",\n";
-                ss << u8"    \"zhCN\": \"进入干燥高地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22808,\n";
-                ss << u8"    \"Key\": \"EnteringTheFarOasis\",\n";
-                ss << u8"    \"enUS\": \"Entering The Far Oasis\",\n";
-                ss << u8"    \"zhTW\": \"進入遙遠的綠洲\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Ferne Oase\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Oasis Lejano\",\n";
-                ss << u8"    \"frFR\": \"Entre dans l’Oasis lointaine\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Oasi Lontana\",\n";
-                ss << u8"    \"koKR\": \"머나먼 오아시스에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Dalekiej Oazy\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Oasis Lejano\",\n";
-                ss << u8"    \"jaJP\": \"〈遥かなるオアシス〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Oásis Longínquo\",\n";
-                ss << u8"    \"ruRU\": \"Дальний оазис\",\n";
-                ss << u8"    \"zhCN\": \"进入偏远绿洲\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22809,\n";
-                ss << u8"    \"Key\": \"EnteringTheLostCity\",\n";
-                ss << u8"    \"enUS\": \"Entering The Lost City\",\n";
-                ss << u8"    \"zhTW\": \"進入失落古城\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Vergessene Stadt\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Ciudad Perdida\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Ville oubliée\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Città Perduta\",\n";
-                ss << u8"    \"koKR\": \"잊힌 도시에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Zaginionego Miasta\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Ciudad Perdida\",\n";
-                ss << u8"    \"jaJP\": \"〈失われし都〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Cidade Perdida\",\n";
-                ss << u8"    \"ruRU\": \"Затерянный город\",\n";
-                ss << u8"    \"zhCN\": \"进入失落之城\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22810,\n";
-                ss << u8"    \"Key\": \"EnteringTheValleyOfSnakes\",\n";
-                ss << u8"    \"enUS\": \"Entering The Valley of Snakes\",\n";
-                ss << u8"    \"zhTW\": \"進入群蛇峽谷\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Tal der Schlangen\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Valle de las Serpientes\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Vallée des serpents\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Valle dei Serpenti\",\n";
-                ss << u8"    \"koKR\": \"뱀의 골짜기에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Doliny Węży\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Valle de las Culebras\",\n";
-                ss << u8"    \"jaJP\": \"〈蛇の谷〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Vale das Cobras\",\n";
-                ss << u8"    \"ruRU\": \"Долина змей\",\n";
-                ss << u8"    \"zhCN\": \"进入群蛇峡谷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22811,\n";
-                ss << u8"    \"Key\": \"EnteringTheCanyonOfTheMagi\",\n";
-                ss << u8"    \"enUS\": \"Entering The Canyon of the Magi\",\n";
-                ss << u8"    \"zhTW\": \"進入賢者之谷\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Schlucht der Magier\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Cañón de los Magos\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Canyon des Mages\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Canyon dei Maghi\",\n";
-                ss << u8"    \"koKR\": \"신비술사의 협곡에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kanionu Magów\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Cañón de los Magos\",\n";
-                ss << u8"    \"jaJP\": \"〈魔術師の峡谷〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Cânion dos Magi\",\n";
-                ss << u8"    \"ruRU\": \"Каньон волхвов\",\n";
-                ss << u8"    \"zhCN\": \"进入法师峡谷\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22812,\n";
-                ss << u8"    \"Key\": \"EnteringTheSewersLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Sewers Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入下水道第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Kanalisation, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de las Cloacas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Égouts niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Fogne L1\",\n";
-                ss << u8"    \"koKR\": \"하수도 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kanałów – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Cloacas Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈下水道: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Esgoto Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень стоков\",\n";
-                ss << u8"    \"zhCN\": \"进入下水道一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22813,\n";
-                ss << u8"    \"Key\": \"EnteringTheSewersLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Sewers Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入下水道第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Kanalisation, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 de las Cloacas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Égouts niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Fogne L2\",\n";
-                ss << u8"    \"koKR\": \"하수도 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kanałów – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Cloacas Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈下水道: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Esgoto Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень стоков\",\n";
-                ss << u8"    \"zhCN\": \"进入下水道二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22814,\n";
-                ss << u8"    \"Key\": \"EnteringTheSewersLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Sewers Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入下水道第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Kanalisation, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 de las Cloacas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Égouts niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Fogne L3\",\n";
-                ss << u8"    \"koKR\": \"하수도 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kanałów – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Cloacas Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈下水道: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Esgoto Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень стоков\",\n";
-                ss << u8"    \"zhCN\": \"进入下水道三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22815,\n";
-                ss << u8"    \"Key\": \"EnteringTheHaremLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Harem Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入後宮第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Harem, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 del Harén\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Harem niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Harem L1\",\n";
-                ss << u8"    \"koKR\": \"하렘 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Haremu – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Harén Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈ハーレム: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Harém Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень гарема\",\n";
-                ss << u8"    \"zhCN\": \"进入女眷住处一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22816,\n";
-                ss << u8"    \"Key\": \"EnteringTheHaremLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Harem Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入後宮第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Harem, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 del Harén\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Harem niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Harem L2\",\n";
-                ss << u8"    \"koKR\": \"하렘 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Haremu – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Harén Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈ハーレム: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Harém Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень гарема\",\n";
-                ss << u8"    \"zhCN\": \"进入女眷住处二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22817,\n";
-                ss << u8"    \"Key\": \"EnteringThePalaceCellarLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Palace Cellar Level 1 \",\n";
-                ss << u8"    \"zhTW\": \"進入皇宮地窖第一層 \",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Palastkeller, Ebene 1 \",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 del Sótano del Palacio\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Caves du Palais niv. 1 \",\n";
-                ss << u8"    \"itIT\": \"Ingresso nei Sotterranei del Palazzo L1 \",\n";
-                ss << u8"    \"koKR\": \"궁전 지하 1층에 진입 \",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Pałacowych Piwnic – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Sótano del Palacio Nivel 1 \",\n";
-                ss << u8"    \"jaJP\": \"〈宮殿地下室: 第1階層〉 \",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Porão do Palácio Nível 1 \",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень дворцового погреба \",\n";
-                ss << u8"    \"zhCN\": \"进入王宫监牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22818,\n";
-                ss << u8"    \"Key\": \"EnteringThePalaceCellarLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Palace Cellar Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入皇宮地窖第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Palastkeller, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 del Sótano del Palacio\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Caves du Palais niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nei Sotterranei del Palazzo L2\",\n";
-                ss << u8"    \"koKR\": \"궁전 지하 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Pałacowych Piwnic – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Sótano del Palacio Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈宮殿地下室: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Porão do Palácio Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень дворцового погреба\",\n";
-                ss << u8"    \"zhCN\": \"进入王宫监牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22819,\n";
-                ss << u8"    \"Key\": \"EnteringThePalaceCellarLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Palace Cellar Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入皇宮地窖第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Palastkeller, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 del Sótano del Palacio\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Caves du Palais niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nei Sotterranei del Palazzo L3\",\n";
-                ss << u8"    \"koKR\": \"궁전 지하 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Pałacowych Piwnic – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Sótano del Palacio Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈宮殿地下室: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Porão do Palácio Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень дворцового погреба\",\n";
-                ss << u8"    \"zhCN\": \"进入王宫监牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22820,\n";
-                ss << u8"    \"Key\": \"EnteringTheStonyTombLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Stony Tomb Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入古老石墓第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Steingrab, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de la Tumba Pedregosa\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Tombeau de pierre niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Tomba di Pietra L1\",\n";
-                ss << u8"    \"koKR\": \"바위 무덤 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kamiennego Grobowca – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Tumba Pedregosa Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈石造りの墓所: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Tumba Pétrea Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень каменной гробницы\",\n";
-                ss << u8"    \"zhCN\": \"进入碎石古墓一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22821,\n";
-                ss << u8"    \"Key\": \"EnteringTheHallsOfTheDeadLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Halls of the Dead Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入死亡之殿第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Hallen der Toten, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de las Salas de la Muerte\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Couloirs des morts niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Sale dei Morti L1\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Sal Umarłych – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Salas de la Muerte Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈亡者の広間: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nos Salões dos Mortos Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень Чертогов Мертвых\",\n";
-                ss << u8"    \"zhCN\": \"进入亡者大殿一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22822,\n";
-                ss << u8"    \"Key\": \"EnteringTheHallsOfTheDeadLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Halls of the Dead Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入死亡之殿第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Hallen der Toten, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 de las Salas de la Muerte\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Couloirs des morts niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Sale dei Morti L2\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Sal Umarłych – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Salas de la Muerte Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈亡者の広間: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nos Salões dos Mortos Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень Чертогов Мертвых\",\n";
-                ss << u8"    \"zhCN\": \"进入亡者大殿二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22823,\n";
-                ss << u8"    \"Key\": \"EnteringTheClawViperTempleLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Claw Viper Temple Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入利爪蛇魔神殿第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Tempel der Klauenvipern, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 del Templo de la Garra Viperina\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Temple des Vipères, niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Tempio delle Vipere L1\",\n";
-                ss << u8"    \"koKR\": \"발톱 독사 사원 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Świątyni Żmijoszponów – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Templo del Vipérido de Garras Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈クロウ・ヴァイパーの寺院: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Templo da Víbora da Garra Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень храма Когтистого Змея\",\n";
-                ss << u8"    \"zhCN\": \"进入利爪蝮蛇神殿一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22824,\n";
-                ss << u8"    \"Key\": \"EnteringTheStonyTombLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Stony Tomb Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入古老石墓第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Steingrab, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 de la Tumba Pedregosa\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Tombeau de pierre niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Tomba di Pietra L2\",\n";
-                ss << u8"    \"koKR\": \"바위 무덤 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kamiennego Grobowca – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Tumba Pedregosa Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈石造りの墓所: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Tumba Pétrea Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень каменной гробницы\",\n";
-                ss << u8"    \"zhCN\": \"进入碎石古墓二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22825,\n";
-                ss << u8"    \"Key\": \"EnteringTheHallsOfTheDeadLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Halls of the Dead Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入死亡之殿第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Hallen der Toten, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 de las Salas de la Muerte\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Couloirs des morts niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Sale dei Morti L3\",\n";
-                ss << u8"    \"koKR\": \"망자의 전당 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Sal Umarłych – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Salas de la Muerte Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈亡者の広間: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nos Salões dos Mortos Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень Чертогов Мертвых\",\n";
-                ss << u8"    \"zhCN\": \"进入亡者大殿三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22826,\n";
-                ss << u8"    \"Key\": \"EnteringTheClawViperTempleLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Claw Viper Temple Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入利爪蛇魔神殿第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Tempel der Klauenvipern, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 del Templo de la Garra Viperina\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Temple des Vipères, niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Tempio delle Vipere L2\",\n";
-                ss << u8"    \"koKR\": \"발톱 독사 사원 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Świątyni Żmijoszponów – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Templo del Vipérido de Garras Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈クロウ・ヴァイパーの寺院: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Templo da Víbora da Garra Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень храма Когтистого Змея\",\n";
-                ss << u8"    \"zhCN\": \"进入利爪蝮蛇神殿二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22827,\n";
-                ss << u8"    \"Key\": \"EnteringTheMaggotLairLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Maggot Lair Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入蛆蟲巢穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Wurmgruft, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 del Cubil de Gusanos\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Repaire du ver, niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Covo delle Larve L1\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Robaczego Gniazda – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Guarida de Gusanos Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈地虫の巣穴: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Covil de Vermes Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень логова мокриц\",\n";
-                ss << u8"    \"zhCN\": \"进入蛆虫巢穴一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22828,\n";
-                ss << u8"    \"Key\": \"EnteringTheMaggotLairLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Maggot Lair Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入蛆蟲巢穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Wurmgruft, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 del Cubil de Gusanos\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Repaire du ver, niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Covo delle Larve L2\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Robaczego Gniazda – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Guarida de Gusanos Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈地虫の巣穴: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Covil de Vermes Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень логова мокриц\",\n";
-                ss << u8"    \"zhCN\": \"进入蛆虫巢穴二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22829,\n";
-                ss << u8"    \"Key\": \"EnteringTheMaggotLairLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Maggot Lair Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入蛆蟲巢穴第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Wurmgruft, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 del Cubil de Gusanos\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Repaire du ver, niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Covo delle Larve L3\",\n";
-                ss << u8"    \"koKR\": \"구더기 굴 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Robaczego Gniazda – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Guarida de Gusanos Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈地虫の巣穴: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Covil de Vermes Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень логова мокриц\",\n";
-                ss << u8"    \"zhCN\": \"进入蛆虫巢穴三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22830,\n";
-                ss << u8"    \"Key\": \"EnteringTheAncientTunnels\",\n";
-                ss << u8"    \"enUS\": \"Entering The Ancient Tunnels\",\n";
-                ss << u8"    \"zhTW\": \"進入古代通道\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Alten Tunnel\",\n";
-                ss << u8"    \"esES\": \"Entrando en los Túneles Antiguos\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Tunnels antiques\",\n";
-                ss << u8"    \"itIT\": \"Ingresso negli Antichi Tunnel\",\n";
-                ss << u8"    \"koKR\": \"고대 토굴에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Prastarych Tuneli\",\n";
-                ss << u8"    \"esMX\": \"Entrando a los Túneles Antiguos\",\n";
-                ss << u8"    \"jaJP\": \"〈古の坑道〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nos Túneis Ancestrais\",\n";
-                ss << u8"    \"ruRU\": \"Древние туннели\",\n";
-                ss << u8"    \"zhCN\": \"进入古代水道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22831,\n";
-                ss << u8"    \"Key\": \"EnteringTalRasha'sTomb\",\n";
-                ss << u8"    \"enUS\": \"Entering Tal Rasha's Tomb\",\n";
-                ss << u8"    \"zhTW\": \"進入塔拉夏的古墓\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Tal Rashas Grab\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Tumba de Tal Rasha\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Tombeau de Tal Rasha\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Tomba di Tal Rasha\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 무덤에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Grobowca Tal Rashy\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Tumba de Tal Rasha\",\n";
-                ss << u8"    \"jaJP\": \"〈タル・ラシャの墓〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Tumba de Tal Rasha\",\n";
-                ss << u8"    \"ruRU\": \"Гробница Тал Раши\",\n";
-                ss << u8"    \"zhCN\": \"进入塔·拉夏之墓\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22832,\n";
-                ss << u8"    \"Key\": \"EnteringDuriel'sLair\",\n";
-                ss << u8"    \"enUS\": \"Entering Tal Rasha's Chamber\",\n";
-                ss << u8"    \"zhTW\": \"進入塔拉夏的密室\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Tal Rashas Kammer\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Cámara de Tal Rasha\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Chambre de Tal Rasha\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Cripta di Tal Rasha\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 방에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Komnaty Tal Rashy\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Cámara de Tal Rasha\",\n";
-                ss << u8"    \"jaJP\": \"〈タル・ラシャの間〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Câmara de Tal Rasha\",\n";
-                ss << u8"    \"ruRU\": \"Погребальный зал Тал Раши\",\n";
-                ss << u8"    \"zhCN\": \"进入塔·拉夏的墓室\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22833,\n";
-                ss << u8"    \"Key\": \"EnteringTheArcaneSanctuary\",\n";
-                ss << u8"    \"enUS\": \"Entering The Arcane Sanctuary\",\n";
-                ss << u8"    \"zhTW\": \"進入秘法聖殿\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Geheime Zuflucht\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Santuario Arcano\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Sanctuaire des Arcanes\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Santuario Arcano\",\n";
-                ss << u8"    \"koKR\": \"비전의 성역에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Tajemnego Sanktuarium\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Santuario Arcano\",\n";
-                ss << u8"    \"jaJP\": \"〈深遠なる聖域〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Santuário Arcano\",\n";
-                ss << u8"    \"ruRU\": \"Магическое убежище\",\n";
-                ss << u8"    \"zhCN\": \"进入神秘避难所\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22834,\n";
-                ss << u8"    \"Key\": \"EnteringTheKurastDocktown\",\n";
-                ss << u8"    \"enUS\": \"Entering The Kurast Docks\",\n";
-                ss << u8"    \"zhTW\": \"進入庫拉斯特港口\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Docks von Kurast\",\n";
-                ss << u8"    \"esES\": \"Entrando en los Muelles de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Quais de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Zona Portuale di Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 부두에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Doków Kurast\",\n";
-                ss << u8"    \"esMX\": \"Entrando a los Muelles de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"〈クラスト港〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Docas de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"Доки Кураста\",\n";
-                ss << u8"    \"zhCN\": \"进入库拉斯特海港\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22835,\n";
-                ss << u8"    \"Key\": \"EnteringTheSpiderForest\",\n";
-                ss << u8"    \"enUS\": \"Entering The Spider Forest\",\n";
-                ss << u8"    \"zhTW\": \"進入蜘蛛森林\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Spinnenwald\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Bosque de Arañas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Forêt de l’Araignée\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Foresta del Ragno\",\n";
-                ss << u8"    \"koKR\": \"거미 숲에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Lasu Pająków\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Bosque de Arañas\",\n";
-                ss << u8"    \"jaJP\": \"〈蜘蛛の森〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Floresta Aracnídea\",\n";
-                ss << u8"    \"ruRU\": \"Паучий лес\",\n";
-                ss << u8"    \"zhCN\": \"进入蜘蛛森林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22836,\n";
-                ss << u8"    \"Key\": \"EnteringTheGreatMarsh\",\n";
-                ss << u8"    \"enUS\": \"Entering The Great Marsh\",\n";
-                ss << u8"    \"zhTW\": \"進入大沼澤\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Große Moor\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Gran Pantano\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Grand marais\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Grande Palude\",\n";
-                ss << u8"    \"koKR\": \"거대 습지에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Wielkie Moczary\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Gran Marisma\",\n";
-                ss << u8"    \"jaJP\": \"〈大湿原〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Grande Charco\",\n";
-                ss << u8"    \"ruRU\": \"Болотина\",\n";
-                ss << u8"    \"zhCN\": \"进入庞大湿地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22837,\n";
-                ss << u8"    \"Key\": \"EnteringTheFlayerJungle\",\n";
-                ss << u8"    \"enUS\": \"Entering The Flayer Jungle\",\n";
-                ss << u8"    \"zhTW\": \"進入剝皮叢林\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Schinderdschungel\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Selva Desolladora\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Jungle de l’Écorcheur\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Giungla Scorticatrice\",\n";
-                ss << u8"    \"koKR\": \"약탈자 밀림에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Dżungli Łupieżców\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Jungla de los Desolladores\",\n";
-                ss << u8"    \"jaJP\": \"〈フレイヤーの密林〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Selva dos Esfoladores\",\n";
-                ss << u8"    \"ruRU\": \"Джунгли свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"进入剥皮魔丛林\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22838,\n";
-                ss << u8"    \"Key\": \"EnteringLowerKurast\",\n";
-                ss << u8"    \"enUS\": \"Entering Lower Kurast\",\n";
-                ss << u8"    \"zhTW\": \"進入庫拉斯特下層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Unterkurast\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Parte Baja de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la ville basse de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Ingresso a Kurast Inferiore\",\n";
-                ss << u8"    \"koKR\": \"하부 쿠라스트에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Dolnego Kurast\",\n";
-                ss << u8"    \"esMX\": \"Entrando a Baja Kurast\",\n";
-                ss << u8"    \"jaJP\": \"〈クラスト下層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando em Kurast Inferior\",\n";
-                ss << u8"    \"ruRU\": \"Нижний Кураст\",\n";
-                ss << u8"    \"zhCN\": \"进入库拉斯特下层区\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22839,\n";
-                ss << u8"    \"Key\": \"EnteringTheKurastBazaar\",\n";
-                ss << u8"    \"enUS\": \"Entering The Kurast Bazaar\",\n";
-                ss << u8"    \"zhTW\": \"進入庫拉斯特市集\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Basar von Kurast\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Bazar de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Bazar de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Bazar di Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 시장에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Bazar Kurast\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Bazar de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"〈クラスト・バザール〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Bazar de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"Курастский базар\",\n";
-                ss << u8"    \"zhCN\": \"进入库拉斯特集市\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22840,\n";
-                ss << u8"    \"Key\": \"EnteringUpperKurast\",\n";
-                ss << u8"    \"enUS\": \"Entering Upper Kurast\",\n";
-                ss << u8"    \"zhTW\": \"進入庫拉斯特上層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Oberkurast\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Parte Alta de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la ville haute de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Ingresso a Kurast Superiore\",\n";
-                ss << u8"    \"koKR\": \"상부 쿠라스트에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Górnego Kurast\",\n";
-                ss << u8"    \"esMX\": \"Entrando a Alta Kurast\",\n";
-                ss << u8"    \"jaJP\": \"〈クラスト上層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando em Kurast Superior\",\n";
-                ss << u8"    \"ruRU\": \"Верхний Кураст\",\n";
-                ss << u8"    \"zhCN\": \"进入库拉斯特上层区\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22841,\n";
-                ss << u8"    \"Key\": \"EnteringTheKurastCauseway\",\n";
-                ss << u8"    \"enUS\": \"Entering The Kurast Causeway\",\n";
-                ss << u8"    \"zhTW\": \"進入庫拉斯特堤道\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Damm von Kurast\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Calzada de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Chaussée de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Strada per Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 둑길에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Groblę Kurast\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Calzada de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"〈クラスト舗道〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Passagem de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"Курастская дамба\",\n";
-                ss << u8"    \"zhCN\": \"进入库拉斯特堤道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22842,\n";
-                ss << u8"    \"Key\": \"EnteringTravincal\",\n";
-                ss << u8"    \"enUS\": \"Entering Travincal\",\n";
-                ss << u8"    \"zhTW\": \"進入崔凡克\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Travincal\",\n";
-                ss << u8"    \"esES\": \"Entrando en Travincal\",\n";
-                ss << u8"    \"frFR\": \"Entre dans Travincal\",\n";
-                ss << u8"    \"itIT\": \"Ingresso a Travincal\",\n";
-                ss << u8"    \"koKR\": \"트라빈칼에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Travincal\",\n";
-                ss << u8"    \"esMX\": \"Entrando a Travincal\",\n";
-                ss << u8"    \"jaJP\": \"〈トラヴィンカル〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando em Travincal\",\n";
-                ss << u8"    \"ruRU\": \"Травинкаль\",\n";
-                ss << u8"    \"zhCN\": \"进入崔凡克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22843,\n";
-                ss << u8"    \"Key\": \"EnteringTheSpiderCave\",\n";
-                ss << u8"    \"enUS\": \"Entering The Arachnid Lair\",\n";
-                ss << u8"    \"zhTW\": \"進入蜘蛛巢穴\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Spinnenmonstergruft\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Cubil Arácnido\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Repaire de l’Arachnide\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Covo degli Aracnidi\",\n";
-                ss << u8"    \"koKR\": \"독거미 둥지에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Legowiska Arachnidów\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Guarida Arácnida\",\n";
-                ss << u8"    \"jaJP\": \"〈蜘蛛の巣穴〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Covil Aracnídeo\",\n";
-                ss << u8"    \"ruRU\": \"Логово арахнидов\",\n";
-                ss << u8"    \"zhCN\": \"进入巨蛛巢穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22844,\n";
-                ss << u8"    \"Key\": \"EnteringTheSpiderCavern\",\n";
-                ss << u8"    \"enUS\": \"Entering The Spider Cavern\",\n";
-                ss << u8"    \"zhTW\": \"進入蜘蛛洞窟\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Spinnenhöhle\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Caverna de Arañas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Caverne de l’Araignée\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Caverna del Ragno\",\n";
-                ss << u8"    \"koKR\": \"거미 동굴에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Groty Pająków\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Caverna de Arañas\",\n";
-                ss << u8"    \"jaJP\": \"〈蜘蛛の洞窟〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Caverna Aracnídea\",\n";
-                ss << u8"    \"ruRU\": \"Паучья пещера\",\n";
-                ss << u8"    \"zhCN\": \"进入蜘蛛洞穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22845,\n";
-                ss << u8"    \"Key\": \"EnteringTheSwampyPitLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Swampy Pit Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入沼澤地穴第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Sumpfloch, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 del Foso Pantanoso\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Bourbier niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Abisso Paludoso L1\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Bagiennej Czeluści – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Foso Pantanoso Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈沼地の穴ぐら: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Fosso Pantanoso Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень Глубокой трясины\",\n";
-                ss << u8"    \"zhCN\": \"进入沼泽陷坑一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22846,\n";
-                ss << u8"    \"Key\": \"EnteringTheSwampyPitLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Swampy Pit Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入沼澤地穴第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Sumpfloch, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 del Foso Pantanoso\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Bourbier niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Abisso Paludoso L2\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Bagiennej Czeluści – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Foso Pantanoso Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈沼地の穴ぐら: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Fosso Pantanoso Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень Глубокой трясины\",\n";
-                ss << u8"    \"zhCN\": \"进入沼泽陷坑二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22847,\n";
-                ss << u8"    \"Key\": \"EnteringTheFlayerDungeonLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Flayer Dungeon Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入剝皮地牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Schinderdungeon, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de la Mazmorra de Desollamiento\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Prison de l’Écorcheur niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sotterraneo Scorticatore L1\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Podziemi Łupieżców – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Calabozo de los Desolladores Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈フレイヤーの地下牢: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Masmorra dos Esfoladores Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень Подземелья свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"进入剥皮魔监牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22848,\n";
-                ss << u8"    \"Key\": \"EnteringTheFlayerDungeonLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Flayer Dungeon Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入剝皮地牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Schinderdungeon, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 de la Mazmorra de Desollamiento\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Prison de l’Écorcheur niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sotterraneo Scorticatore L2\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Podziemi Łupieżców – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Calabozo de los Desolladores Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈フレイヤーの地下牢: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Masmorra dos Esfoladores Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень Подземелья свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"进入剥皮魔监牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22849,\n";
-                ss << u8"    \"Key\": \"EnteringTheSwampyPitLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Swampy Pit Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入沼澤地穴第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Sumpfloch, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 del Foso Pantanoso\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Bourbier niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Abisso Paludoso L3\",\n";
-                ss << u8"    \"koKR\": \"습한 구덩이 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Bagiennej Czeluści – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Foso Pantanoso Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈沼地の穴ぐら: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Fosso Pantanoso Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень Глубокой трясины\",\n";
-                ss << u8"    \"zhCN\": \"进入沼泽陷坑三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22850,\n";
-                ss << u8"    \"Key\": \"EnteringTheFlayerDungeonLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Flayer Dungeon Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入剝皮地牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Schinderdungeon, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 de la Mazmorra de Desollamiento\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Prison de l’Écorcheur niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sotterraneo Scorticatore L3\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Podziemi Łupieżców – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Calabozo de los Desolladores Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈フレイヤーの地下牢: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Masmorra dos Esfoladores Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень Подземелья свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"进入剥皮魔监牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22853,\n";
-                ss << u8"    \"Key\": \"EnteringTheRuinedTemple\",\n";
-                ss << u8"    \"enUS\": \"Entering The Ruined Temple\",\n";
-                ss << u8"    \"zhTW\": \"進入荒廢的神殿\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Zerfallene Tempel\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Templo en Ruinas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Temple en ruine\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Tempio in Rovina\",\n";
-                ss << u8"    \"koKR\": \"허물어진 사원에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Zrujnowanej Świątyni\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Templo Destruido\",\n";
-                ss << u8"    \"jaJP\": \"〈荒れ果てた寺院〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Templo Arruinado\",\n";
-                ss << u8"    \"ruRU\": \"Разрушенный храм\",\n";
-                ss << u8"    \"zhCN\": \"进入毁灭的神庙\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22854,\n";
-                ss << u8"    \"Key\": \"EnteringTheDisusedFane\",\n";
-                ss << u8"    \"enUS\": \"Entering The Disused Fane\",\n";
-                ss << u8"    \"zhTW\": \"進入廢棄的寺院\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Verlassene Heiligtum\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Fano Abandonado\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Sanctuaire abandonné\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Tempio Abbandonato\",\n";
-                ss << u8"    \"koKR\": \"버려진 교회당에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Opuszczonej Kaplicy\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Santuario Abandonado\",\n";
-                ss << u8"    \"jaJP\": \"〈打ち捨てられし神殿〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Ádito Abandonado\",\n";
-                ss << u8"    \"ruRU\": \"Заброшенная церковь\",\n";
-                ss << u8"    \"zhCN\": \"进入废弃的礼拜堂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22855,\n";
-                ss << u8"    \"Key\": \"EnteringTheForgottenReliquary\",\n";
-                ss << u8"    \"enUS\": \"Entering The Forgotten Reliquary\",\n";
-                ss << u8"    \"zhTW\": \"進入遺忘的聖殿\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Vergessene Reliquienschrein\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Relicario Olvidado\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Reliquaire oublié\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Reliquiario Dimenticato\",\n";
-                ss << u8"    \"koKR\": \"잊힌 성물실에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Zapomnianego Relikwiarza\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Relicario Olvidado\",\n";
-                ss << u8"    \"jaJP\": \"〈忘れ去られし聖廟〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Relicário Esquecido\",\n";
-                ss << u8"    \"ruRU\": \"Забытый реликварий\",\n";
-                ss << u8"    \"zhCN\": \"进入被遗忘的藏骨室\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22856,\n";
-                ss << u8"    \"Key\": \"EnteringTheForgottenTemple\",\n";
-                ss << u8"    \"enUS\": \"Entering The Forgotten Temple\",\n";
-                ss << u8"    \"zhTW\": \"進入遺忘神殿\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Vergessene Tempel\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Templo Olvidado\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Temple oublié\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Tempio Dimenticato\",\n";
-                ss << u8"    \"koKR\": \"잊힌 사원에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Zapomnianej Świątyni\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Templo Olvidado\",\n";
-                ss << u8"    \"jaJP\": \"〈忘れ去られし寺院〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Templo Esquecido\",\n";
-                ss << u8"    \"ruRU\": \"Забытый храм\",\n";
-                ss << u8"    \"zhCN\": \"进入被遗忘的神殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22857,\n";
-                ss << u8"    \"Key\": \"EnteringTheRuinedFane\",\n";
-                ss << u8"    \"enUS\": \"Entering The Ruined Fane\",\n";
-                ss << u8"    \"zhTW\": \"進入荒廢的寺院\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Zerfallene Heiligtum\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Fano en Ruinas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Sanctuaire en ruine\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Tempio Antico\",\n";
-                ss << u8"    \"koKR\": \"허물어진 교회당에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Zrujnowanej Kaplicy\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Santuario Destruido\",\n";
-                ss << u8"    \"jaJP\": \"〈荒れ果てた神殿〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Ádito Arruinado\",\n";
-                ss << u8"    \"ruRU\": \"Разрушенная церковь\",\n";
-                ss << u8"    \"zhCN\": \"进入被毁的礼拜堂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22858,\n";
-                ss << u8"    \"Key\": \"EnteringTheDisusedReliquary\",\n";
-                ss << u8"    \"enUS\": \"Entering The Disused Reliquary\",\n";
-                ss << u8"    \"zhTW\": \"進入廢棄的聖殿\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Verlassene Reliquienschrein\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Relicario Abandonado\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Reliquaire abandonné\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Reliquiario Abbandonato\",\n";
-                ss << u8"    \"koKR\": \"버려진 성물실에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Opuszczonego Relikwiarza\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Relicario Abandonado\",\n";
-                ss << u8"    \"jaJP\": \"〈打ち捨てられし聖廟〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Relicário Abandonado\",\n";
-                ss << u8"    \"ruRU\": \"Заброшенный реликварий\",\n";
-                ss << u8"    \"zhCN\": \"进入废弃的藏骨室\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22859,\n";
-                ss << u8"    \"Key\": \"EnteringTheDuranceOfHateLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Durance of Hate Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入憎恨囚牢第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Kerker des Hasses, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de la Represión del Odio\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Prison de la Haine niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Prigione dell'Odio L1\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kazamat Nienawiści – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Prisión de Odio Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈憎悪の檻: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Cárcere do Ódio Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень Узилища Ненависти\",\n";
-                ss << u8"    \"zhCN\": \"进入憎恨囚牢一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22860,\n";
-                ss << u8"    \"Key\": \"EnteringTheDuranceOfHateLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Durance of Hate Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入憎恨囚牢第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Kerker des Hasses, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 de la Represión del Odio\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Prison de la Haine niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Prigione dell'Odio L2\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kazamat Nienawiści – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Prisión de Odio Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈憎悪の檻: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Cárcere do Ódio Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень Узилища Ненависти\",\n";
-                ss << u8"    \"zhCN\": \"进入憎恨囚牢二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22861,\n";
-                ss << u8"    \"Key\": \"EnteringTheDuranceOfHateLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Durance of Hate Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入憎恨囚牢第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Kerker des Hasses, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 de la Represión del Odio\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Prison de la Haine niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Prigione dell'Odio L3\",\n";
-                ss << u8"    \"koKR\": \"증오의 억류지 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kazamat Nienawiści – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Prisión de Odio Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈憎悪の檻: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Cárcere do Ódio Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень Узилища Ненависти\",\n";
-                ss << u8"    \"zhCN\": \"进入憎恨囚牢三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22862,\n";
-                ss << u8"    \"Key\": \"EnteringThePandemoniumFortress\",\n";
-                ss << u8"    \"enUS\": \"Entering The Pandemonium Fortress\",\n";
-                ss << u8"    \"zhTW\": \"進入混沌界要塞\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Festung des Wahnsinns\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Fortaleza del Pandemónium\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Forteresse de Pandémonium\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Fortezza del Pandemonio\",\n";
-                ss << u8"    \"koKR\": \"혼돈의 요새에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Fortecy Pandemonium\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Fortaleza del Pandemonio\",\n";
-                ss << u8"    \"jaJP\": \"〈伏魔殿の砦〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Fortaleza Pandemônio\",\n";
-                ss << u8"    \"ruRU\": \"Крепость Пандемония\",\n";
-                ss << u8"    \"zhCN\": \"进入混沌要塞\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22863,\n";
-                ss << u8"    \"Key\": \"EnteringTheOuterSteppes\",\n";
-                ss << u8"    \"enUS\": \"Entering The Outer Steppes\",\n";
-                ss << u8"    \"zhTW\": \"進入外圍荒原\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Äußere Steppe\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Estepas Exteriores\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Steppes infinies\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Steppe Esterne\",\n";
-                ss << u8"    \"koKR\": \"평원 외곽에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Zewnętrzne Stepy\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Estepa Exterior\",\n";
-                ss << u8"    \"jaJP\": \"〈果ての草原〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Estepes Externas\",\n";
-                ss << u8"    \"ruRU\": \"Рубежные степи\",\n";
-                ss << u8"    \"zhCN\": \"进入外域荒原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22864,\n";
-                ss << u8"    \"Key\": \"EnteringThePlainsOfDespair\",\n";
-                ss << u8"    \"enUS\": \"Entering The Plains of Despair\",\n";
-                ss << u8"    \"zhTW\": \"進入絕望平原\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Ebene der Verzweiflung\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Llanuras del Desaliento\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Plaines du désespoir\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Pianure della Disperazione\",\n";
-                ss << u8"    \"koKR\": \"절망의 평원에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Równinę Rozpaczy\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Llanura del Desespero\",\n";
-                ss << u8"    \"jaJP\": \"〈絶望の平原〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Planície do Desespero\",\n";
-                ss << u8"    \"ruRU\": \"Долина Отчаяния\",\n";
-                ss << u8"    \"zhCN\": \"进入绝望平原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22865,\n";
-                ss << u8"    \"Key\": \"EnteringTheCityOfTheDamned\",\n";
-                ss << u8"    \"enUS\": \"Entering The City of the Damned\",\n";
-                ss << u8"    \"zhTW\": \"進入罪罰之城\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Stadt der Verdammten\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Ciudad de los Malditos\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Ville des damnés\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Città Dannata\",\n";
-                ss << u8"    \"koKR\": \"저주받은 자들의 도시에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Miasta Potępionych\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Ciudad de los Condenados\",\n";
-                ss << u8"    \"jaJP\": \"〈呪われし街〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Cidade dos Condenados\",\n";
-                ss << u8"    \"ruRU\": \"Город Проклятых\",\n";
-                ss << u8"    \"zhCN\": \"进入神罚之城\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22866,\n";
-                ss << u8"    \"Key\": \"EnteringTheRiverOfFlame\",\n";
-                ss << u8"    \"enUS\": \"Entering The River of Flame\",\n";
-                ss << u8"    \"zhTW\": \"進入火焰之河\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Flammenfluss\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Río de Llamas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Rivière de feu\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Fiume Infuocato\",\n";
-                ss << u8"    \"koKR\": \"불길의 강에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Rzekę Płomieni\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Río de Fuego\",\n";
-                ss << u8"    \"jaJP\": \"〈炎の河〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Rio de Chamas\",\n";
-                ss << u8"    \"ruRU\": \"Огненная река\",\n";
-                ss << u8"    \"zhCN\": \"进入火焰之河\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22867,\n";
-                ss << u8"    \"Key\": \"EnteringChaosSanctum\",\n";
-                ss << u8"    \"enUS\": \"Entering Chaos Sanctuary\",\n";
-                ss << u8"    \"zhTW\": \"進入混沌魔殿\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Chaossanktuarium\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Santuario del Caos\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Sanctuaire du chaos\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Santuario del Caos\",\n";
-                ss << u8"    \"koKR\": \"혼돈의 성역에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Sanktuarium Chaosu\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Santuario del Caos\",\n";
-                ss << u8"    \"jaJP\": \"〈混沌の聖域〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Santuário do Caos\",\n";
-                ss << u8"    \"ruRU\": \"Святилище Хаоса\",\n";
-                ss << u8"    \"zhCN\": \"进入混沌避难所\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22868,\n";
-                ss << u8"    \"Key\": \"EnteringHarrogath\",\n";
-                ss << u8"    \"enUS\": \"Entering Harrogath\",\n";
-                ss << u8"    \"zhTW\": \"進入哈洛加斯\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Harrogath\",\n";
-                ss << u8"    \"esES\": \"Entrando en Harrogath\",\n";
-                ss << u8"    \"frFR\": \"Entre dans Harrogath\",\n";
-                ss << u8"    \"itIT\": \"Ingresso ad Harrogath\",\n";
-                ss << u8"    \"koKR\": \"하로가스에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Harrogath\",\n";
-                ss << u8"    \"esMX\": \"Entrando a Harrogat\",\n";
-                ss << u8"    \"jaJP\": \"〈ハロガス〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando em Harrogath\",\n";
-                ss << u8"    \"ruRU\": \"Харрогат\",\n";
-                ss << u8"    \"zhCN\": \"进入哈洛加斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22869,\n";
-                ss << u8"    \"Key\": \"EnteringTheBloodyFoothills\",\n";
-                ss << u8"    \"enUS\": \"Entering The Bloody Foothills\",\n";
-                ss << u8"    \"zhTW\": \"進入血腥丘陵\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Blutige Vorgebirge\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Estribaciones Sangrientas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Collines Sanglantes\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Colline Insanguinate\",\n";
-                ss << u8"    \"koKR\": \"핏빛 언덕에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Krwawe Wzgórza\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Laderas Sangrientas\",\n";
-                ss << u8"    \"jaJP\": \"〈血に塗れし丘陵〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Colinas Sangrentas\",\n";
-                ss << u8"    \"ruRU\": \"Кровавые предгорья\",\n";
-                ss << u8"    \"zhCN\": \"进入血腥丘陵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22870,\n";
-                ss << u8"    \"Key\": \"EnteringTheRigidHighlands\",\n";
-                ss << u8"    \"enUS\": \"Entering The Frigid Highlands\",\n";
-                ss << u8"    \"zhTW\": \"進入冰凍高地\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Das Eishochland\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Tierras Altas Glaciales\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Hautes-Glaces\",\n";
-                ss << u8"    \"itIT\": \"Ingresso negli Altopiani del Gelo\",\n";
-                ss << u8"    \"koKR\": \"혹한의 고산지에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Zlodowaciałą Wyżynę\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Tierras Altas Gélidas\",\n";
-                ss << u8"    \"jaJP\": \"〈極寒の高原〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Terras Altas Gélidas\",\n";
-                ss << u8"    \"ruRU\": \"Мерзлое нагорье\",\n";
-                ss << u8"    \"zhCN\": \"进入冰冻高地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22871,\n";
-                ss << u8"    \"Key\": \"EnteringTheArreatPlateau\",\n";
-                ss << u8"    \"enUS\": \"Entering The Arreat Plateau\",\n";
-                ss << u8"    \"zhTW\": \"進入亞瑞特高原\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Arreathochebene\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Meseta Arreat\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Mont Arreat\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Plateau dell'Arreat\",\n";
-                ss << u8"    \"koKR\": \"아리앗 고원에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Płaskowyż Arreat\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Planicie de Arreat\",\n";
-                ss << u8"    \"jaJP\": \"〈アリート高地〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Platô de Arreat\",\n";
-                ss << u8"    \"ruRU\": \"Арреатское плато\",\n";
-                ss << u8"    \"zhCN\": \"进入亚瑞特高原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22872,\n";
-                ss << u8"    \"Key\": \"EnteringTheCrystalizedCavernLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Crystalline Passage\",\n";
-                ss << u8"    \"zhTW\": \"進入水晶通道\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Kristalldurchgang\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Pasaje Cristalino\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Passage cristallin\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Passaggio Cristallino\",\n";
-                ss << u8"    \"koKR\": \"수정 동굴에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Kryształowego Przejścia\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Pasaje Cristalino\",\n";
-                ss << u8"    \"jaJP\": \"〈結晶道〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Passagem Cristalina\",\n";
-                ss << u8"    \"ruRU\": \"Ледяные пещеры\",\n";
-                ss << u8"    \"zhCN\": \"进入水晶通道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22873,\n";
-                ss << u8"    \"Key\": \"EnteringTheCellarOfPity\",\n";
-                ss << u8"    \"enUS\": \"Entering The Frozen River\",\n";
-                ss << u8"    \"zhTW\": \"進入冰凍之河\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Frostfluss\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Río Helado\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Rivière Glacée\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Fiume Gelido\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 강에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz nad Zamarzniętą Rzekę\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Río Congelado\",\n";
-                ss << u8"    \"jaJP\": \"〈凍てつく川〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Rio Congelado\",\n";
-                ss << u8"    \"ruRU\": \"Замерзшая река\",\n";
-                ss << u8"    \"zhCN\": \"进入冰冻之河\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22874,\n";
-                ss << u8"    \"Key\": \"EnteringTheCrystalizedCavernLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Glacial Trail\",\n";
-                ss << u8"    \"zhTW\": \"進入冰河小徑\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Gletscherweg\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Senda Glacial\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Piste des glaces\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sentiero Ghiacciato\",\n";
-                ss << u8"    \"koKR\": \"빙하의 길에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Lodowy Trakt\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Sendero Glacial\",\n";
-                ss << u8"    \"jaJP\": \"〈氷の道〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Trilha Glacial\",\n";
-                ss << u8"    \"ruRU\": \"Ледовый ход\",\n";
-                ss << u8"    \"zhCN\": \"进入冰川小径\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22875,\n";
-                ss << u8"    \"Key\": \"EnteringTheEchoChamber\",\n";
-                ss << u8"    \"enUS\": \"Entering The Drifter Cavern\",\n";
-                ss << u8"    \"zhTW\": \"進入漂泊者洞窟\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Flockenhöhle\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Caverna del Errante\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Caverne du Yéti\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Caverna dei Viandanti\",\n";
-                ss << u8"    \"koKR\": \"부랑자의 동굴에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Groty Tułaczy\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Caverna del Morador\",\n";
-                ss << u8"    \"jaJP\": \"〈流れ者の洞窟〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Caverna do Errante\",\n";
-                ss << u8"    \"ruRU\": \"Пещера скитальцев\",\n";
-                ss << u8"    \"zhCN\": \"进入漂流洞窟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22876,\n";
-                ss << u8"    \"Key\": \"EnteringTheTundraWastelands\",\n";
-                ss << u8"    \"enUS\": \"Entering The Frozen Tundra\",\n";
-                ss << u8"    \"zhTW\": \"進入冰凍苔原\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Gefrorene Tundra\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Tundra Helada\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Toundra glacée\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Tundra Congelata\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 동토에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Zamarzniętej Tundry\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Tundra Congelada\",\n";
-                ss << u8"    \"jaJP\": \"〈氷結の凍原〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Tundra Congelada\",\n";
-                ss << u8"    \"ruRU\": \"Морозная тундра\",\n";
-                ss << u8"    \"zhCN\": \"进入冰冻苔原\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22877,\n";
-                ss << u8"    \"Key\": \"EnteringTheGlacierCavesLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Ancients' Way\",\n";
-                ss << u8"    \"zhTW\": \"進入先祖之路\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Weg der Urahnen\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Camino de los Antiguos\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Chemin des Anciens\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Via degli Antichi\",\n";
-                ss << u8"    \"koKR\": \"고대인의 길에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Drogę Starożytnych\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Camino de los Ancestros\",\n";
-                ss << u8"    \"jaJP\": \"〈古の民の通り道〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Caminho dos Ancestrais\",\n";
-                ss << u8"    \"ruRU\": \"Путь Древних\",\n";
-                ss << u8"    \"zhCN\": \"进入先祖之路\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22878,\n";
-                ss << u8"    \"Key\": \"EnteringTheGlacierCavesLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Icy Cellar\",\n";
-                ss << u8"    \"zhTW\": \"進入冰窖\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Eiskeller\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Sótano Helado\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Cave glaciale\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Sotterraneo di Ghiaccio\",\n";
-                ss << u8"    \"koKR\": \"얼음 지하실에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Lodowej Piwnicy\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Caverna Helada\",\n";
-                ss << u8"    \"jaJP\": \"〈氷の穴ぐら〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Porão Gélido\",\n";
-                ss << u8"    \"ruRU\": \"Ледяной грот\",\n";
-                ss << u8"    \"zhCN\": \"进入寒冰地窖\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22879,\n";
-                ss << u8"    \"Key\": \"EnteringTheRockySummit\",\n";
-                ss << u8"    \"enUS\": \"Entering The Arreat Summit\",\n";
-                ss << u8"    \"zhTW\": \"進入亞瑞特山巔\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Gipfel des Arreat\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Cima Arreat\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Sommet Arreat\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Sommità dell'Arreat\",\n";
-                ss << u8"    \"koKR\": \"아리앗 정상에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Szczyt Arreat\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Cima de Arreat\",\n";
-                ss << u8"    \"jaJP\": \"〈アリート山の頂き〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Cume de Arreat\",\n";
-                ss << u8"    \"ruRU\": \"Вершина Арреата\",\n";
-                ss << u8"    \"zhCN\": \"进入亚瑞特之巅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22880,\n";
-                ss << u8"    \"Key\": \"EnteringNihlathaksTemple\",\n";
-                ss << u8"    \"enUS\": \"Entering Nihlathak's Temple\",\n";
-                ss << u8"    \"zhTW\": \"進入尼拉塞克的神殿\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Nihlathaks Tempel\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Templo de Nihlathak\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Temple de Nihlathak\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Tempio di Nihlathak\",\n";
-                ss << u8"    \"koKR\": \"니흘라탁의 사원에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Świątyni Nihlathaka\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Templo de Nihlathak\",\n";
-                ss << u8"    \"jaJP\": \"〈ニーラサックの寺院〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Templo de Nilatak\",\n";
-                ss << u8"    \"ruRU\": \"Храм Нильятака\",\n";
-                ss << u8"    \"zhCN\": \"进入尼拉塞克的神殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22881,\n";
-                ss << u8"    \"Key\": \"EnteringTheHallsOfAnguish\",\n";
-                ss << u8"    \"enUS\": \"Entering The Halls of Anguish\",\n";
-                ss << u8"    \"zhTW\": \"進入怨慟之廳\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Hallen der Qual\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Salas de la Angustia\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Corridors de l’Angoisse\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Sale dell'Angoscia\",\n";
-                ss << u8"    \"koKR\": \"고뇌의 전당에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Sal Cierpienia\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Salas de la Angustia\",\n";
-                ss << u8"    \"jaJP\": \"〈苦悶の広間〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nos Salões da Angústia\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Мучений\",\n";
-                ss << u8"    \"zhCN\": \"进入痛楚大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22882,\n";
-                ss << u8"    \"Key\": \"EnteringTheHallsOfDeath'sCalling\",\n";
-                ss << u8"    \"enUS\": \"Entering The Halls of Pain\",\n";
-                ss << u8"    \"zhTW\": \"進入苦痛之廳\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Hallen der Schmerzen\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Salas del Dolor\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Corridors de la Souffrance\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Sale del Dolore\",\n";
-                ss << u8"    \"koKR\": \"고통의 전당에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Sal Bólu\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Salas del Dolor\",\n";
-                ss << u8"    \"jaJP\": \"〈苦痛の広間〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nos Salões da Dor\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Боли\",\n";
-                ss << u8"    \"zhCN\": \"进入苦痛大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22883,\n";
-                ss << u8"    \"Key\": \"EnteringTheHallsOfVaught\",\n";
-                ss << u8"    \"enUS\": \"Entering The Halls of Vaught\",\n";
-                ss << u8"    \"zhTW\": \"進入沃特之廳\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Hallen von Vaught\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Salas de Vaught\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Corridors du Martyre\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Sale di Vaught\",\n";
-                ss << u8"    \"koKR\": \"보트의 전당에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Sal Nieszczęścia\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Salas de Vaught\",\n";
-                ss << u8"    \"jaJP\": \"〈ヴォートの広間〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nos Salões de Vaught\",\n";
-                ss << u8"    \"ruRU\": \"Чертоги Воута\",\n";
-                ss << u8"    \"zhCN\": \"进入沃特大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22884,\n";
-                ss << u8"    \"Key\": \"EnteringHell1\",\n";
-                ss << u8"    \"enUS\": \"Entering Abaddon\",\n";
-                ss << u8"    \"zhTW\": \"進入亞巴頓\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Abaddon\",\n";
-                ss << u8"    \"esES\": \"Entrando en Abaddon\",\n";
-                ss << u8"    \"frFR\": \"Entre dans Abaddon\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Abaddon\",\n";
-                ss << u8"    \"koKR\": \"나락에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Abaddonu\",\n";
-                ss << u8"    \"esMX\": \"Entrando a Abadón\",\n";
-                ss << u8"    \"jaJP\": \"〈奈落〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando em Abadom\",\n";
-                ss << u8"    \"ruRU\": \"Аваддон\",\n";
-                ss << u8"    \"zhCN\": \"进入亚巴顿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22885,\n";
-                ss << u8"    \"Key\": \"EnteringHell2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Pit of Acheron\",\n";
-                ss << u8"    \"zhTW\": \"進入冥河地穴\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Grube von Acheron\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Foso de Acheron\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Puits d’Acheron\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Abisso dell'Acheronte\",\n";
-                ss << u8"    \"koKR\": \"아케론의 구덩이에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Otchłani Acheronu\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Foso de Aqueronte\",\n";
-                ss << u8"    \"jaJP\": \"〈冥穴〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Fosso de Aqueron\",\n";
-                ss << u8"    \"ruRU\": \"Пропасть Ахерона\",\n";
-                ss << u8"    \"zhCN\": \"进入阿克隆深渊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22886,\n";
-                ss << u8"    \"Key\": \"EnteringHell3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Infernal Pit\",\n";
-                ss << u8"    \"zhTW\": \"進入煉獄地穴\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Infernogrube\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Foso Infernal\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Puits infernal\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nell'Abisso Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥불 구덩이에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Piekielnej Czeluści\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Foso del Infierno\",\n";
-                ss << u8"    \"jaJP\": \"〈獄穴〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Fosso Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Инфернальный провал\",\n";
-                ss << u8"    \"zhCN\": \"进入炼狱深渊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22887,\n";
-                ss << u8"    \"Key\": \"EnteringTheWorldstoneKeepLevel1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Worldstone Keep Level 1\",\n";
-                ss << u8"    \"zhTW\": \"進入世界之石要塞第一層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Weltsteinturm, Ebene 1\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 1 de la Torre de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Donjon de la Pierre-Monde niv. 1\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Forte della Pietra del Mondo L1\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채 1층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Twierdzy Kamienia Świata – Poziom 1\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Fortaleza de la Piedra Ecuménica Nivel 1\",\n";
-                ss << u8"    \"jaJP\": \"〈ワールドストーン城塞: 第1階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Forte da Pedra do Mundo Nível 1\",\n";
-                ss << u8"    \"ruRU\": \"1-й уровень Цитадели Мироздания\",\n";
-                ss << u8"    \"zhCN\": \"进入世界之石要塞一层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22888,\n";
-                ss << u8"    \"Key\": \"EnteringTheWorldstoneKeepLevel2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Worldstone Keep Level 2\",\n";
-                ss << u8"    \"zhTW\": \"進入世界之石要塞第二層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Weltsteinturm, Ebene 2\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 2 de la Torre de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Donjon de la Pierre-Monde niv. 2\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Forte della Pietra del Mondo L2\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채 2층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Twierdzy Kamienia Świata – Poziom 2\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Fortaleza de la Piedra Ecuménica Nivel 2\",\n";
-                ss << u8"    \"jaJP\": \"〈ワールドストーン城塞: 第2階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Forte da Pedra do Mundo Nível 2\",\n";
-                ss << u8"    \"ruRU\": \"2-й уровень Цитадели Мироздания\",\n";
-                ss << u8"    \"zhCN\": \"进入世界之石要塞二层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22889,\n";
-                ss << u8"    \"Key\": \"EnteringTheWorldstoneKeepLevel3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Worldstone Keep Level 3\",\n";
-                ss << u8"    \"zhTW\": \"進入世界之石要塞第三層\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Weltsteinturm, Ebene 3\",\n";
-                ss << u8"    \"esES\": \"Entrando en el nivel 3 de la Torre de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Donjon de la Pierre-Monde niv. 3\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Forte della Pietra del Mondo L3\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채 3층에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Twierdzy Kamienia Świata – Poziom 3\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Fortaleza de la Piedra Ecuménica Nivel 3\",\n";
-                ss << u8"    \"jaJP\": \"〈ワールドストーン城塞: 第3階層〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Forte da Pedra do Mundo Nível 3\",\n";
-                ss << u8"    \"ruRU\": \"3-й уровень Цитадели Мироздания\",\n";
-                ss << u8"    \"zhCN\": \"进入世界之石要塞三层\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22890,\n";
-                ss << u8"    \"Key\": \"EnteringTheThroneOfDestruction\",\n";
-                ss << u8"    \"enUS\": \"Entering The Throne of Destruction\",\n";
-                ss << u8"    \"zhTW\": \"進入毀滅王座\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Thron der Zerstörung\",\n";
-                ss << u8"    \"esES\": \"Entrando en el Trono de la Destrucción\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Trône de la Destruction\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nel Trono della Distruzione\",\n";
-                ss << u8"    \"koKR\": \"파괴의 왕좌에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Tronu Zniszczenia\",\n";
-                ss << u8"    \"esMX\": \"Entrando al Trono de la Destrucción\",\n";
-                ss << u8"    \"jaJP\": \"〈破壊の玉座〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Trono da Destruição\",\n";
-                ss << u8"    \"ruRU\": \"Престол Разрушения\",\n";
-                ss << u8"    \"zhCN\": \"进入毁灭王座\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22891,\n";
-                ss << u8"    \"Key\": \"EnteringTheWorldstoneChamber\",\n";
-                ss << u8"    \"enUS\": \"Entering The Worldstone Chamber\",\n";
-                ss << u8"    \"zhTW\": \"進入世界之石大殿\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Kammer des Weltsteins\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Cámara de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Chambre de la Pierre-Monde\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Sale della Pietra del Mondo\",\n";
-                ss << u8"    \"koKR\": \"세계석 보관실에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Komnaty Kamienia Świata\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Cámara de la Piedra Ecuménica\",\n";
-                ss << u8"    \"jaJP\": \"〈ワールドストーンの間〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Câmara da Pedra do Mundo\",\n";
-                ss << u8"    \"ruRU\": \"Святилище Мироздания\",\n";
-                ss << u8"    \"zhCN\": \"进入世界之石大殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22892,\n";
-                ss << u8"    \"Key\": \"EnteringThePandemoniumRun1\",\n";
-                ss << u8"    \"enUS\": \"Entering The Matron's Den\",\n";
-                ss << u8"    \"zhTW\": \"進入魔母巢穴\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Matronenhöhle\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Guarida de la Matrona\",\n";
-                ss << u8"    \"frFR\": \"Entre dans le Repaire de la Matrone\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Tana della Matrona\",\n";
-                ss << u8"    \"koKR\": \"여제의 소굴에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Legowiska Matrony\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Guarida de la Matrona\",\n";
-                ss << u8"    \"jaJP\": \"〈貴婦人の巣窟〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando no Covil da Matriarca\",\n";
-                ss << u8"    \"ruRU\": \"Логово Госпожи\",\n";
-                ss << u8"    \"zhCN\": \"进入主母的巢穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22893,\n";
-                ss << u8"    \"Key\": \"EnteringThePandemoniumRun2\",\n";
-                ss << u8"    \"enUS\": \"Entering The Forgotten Sands\",\n";
-                ss << u8"    \"zhTW\": \"進入遺忘沙漠\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Die Vergessenen Sande\",\n";
-                ss << u8"    \"esES\": \"Entrando en las Arenas Olvidadas\",\n";
-                ss << u8"    \"frFR\": \"Entre dans les Sables oubliés\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nelle Sabbie Dimenticate\",\n";
-                ss << u8"    \"koKR\": \"잊힌 사막에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz na Zapomniane Piaski\",\n";
-                ss << u8"    \"esMX\": \"Entrando a las Arenas Olvidadas\",\n";
-                ss << u8"    \"jaJP\": \"〈忘れ去られし砂漠〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando nas Areias Esquecidas\",\n";
-                ss << u8"    \"ruRU\": \"Забытые пески\",\n";
-                ss << u8"    \"zhCN\": \"进入遗忘的沙丘\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22894,\n";
-                ss << u8"    \"Key\": \"EnteringThePandemoniumRun3\",\n";
-                ss << u8"    \"enUS\": \"Entering The Furnace of Pain\",\n";
-                ss << u8"    \"zhTW\": \"進入苦痛熔爐\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Der Glutofen der Pein\",\n";
-                ss << u8"    \"esES\": \"Entrando en la Caldera del Dolor\",\n";
-                ss << u8"    \"frFR\": \"Entre dans la Fournaise de la douleur\",\n";
-                ss << u8"    \"itIT\": \"Ingresso nella Fornace del Dolore\",\n";
-                ss << u8"    \"koKR\": \"고통의 용광로에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Pieca Bólu\",\n";
-                ss << u8"    \"esMX\": \"Entrando a la Forja del Dolor\",\n";
-                ss << u8"    \"jaJP\": \"〈苦痛のかまど〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando na Fornalha da Dor\",\n";
-                ss << u8"    \"ruRU\": \"Горнило Боли\",\n";
-                ss << u8"    \"zhCN\": \"进入苦痛的熔炉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22895,\n";
-                ss << u8"    \"Key\": \"EnteringThePandemoniumFinale\",\n";
-                ss << u8"    \"enUS\": \"Entering Tristram\",\n";
-                ss << u8"    \"zhTW\": \"進入崔斯特姆\",\n";
-                ss << u8"    \"deDE\": \"Jetzt: Tristram\",\n";
-                ss << u8"    \"esES\": \"Entrando en Tristán\",\n";
-                ss << u8"    \"frFR\": \"Entre dans Tristram\",\n";
-                ss << u8"    \"itIT\": \"Ingresso a Tristram\",\n";
-                ss << u8"    \"koKR\": \"트리스트럼에 진입\",\n";
-                ss << u8"    \"plPL\": \"Wkraczasz do Tristram\",\n";
-                ss << u8"    \"esMX\": \"Entrando a Tristram\",\n";
-                ss << u8"    \"jaJP\": \"〈トリストラム〉\",\n";
-                ss << u8"    \"ptBR\": \"Entrando em Tristram\",\n";
-                ss << u8"    \"ruRU\": \"Тристрам\",\n";
-                ss << u8"    \"zhCN\": \"进入崔斯特姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 26815,\n";
-                ss << u8"    \"Key\": \"act5\",\n";
-                ss << u8"    \"enUS\": \"Act 5\",\n";
-                ss << u8"    \"zhTW\": \"第五章\",\n";
-                ss << u8"    \"deDE\": \"Akt 5\",\n";
-                ss << u8"    \"esES\": \"Acto 5\",\n";
-                ss << u8"    \"frFR\": \"Acte V\",\n";
-                ss << u8"    \"itIT\": \"Atto 5\",\n";
-                ss << u8"    \"koKR\": \"5막\",\n";
-                ss << u8"    \"plPL\": \"Akt V\",\n";
-                ss << u8"    \"esMX\": \"Acto 5\",\n";
-                ss << u8"    \"jaJP\": \"第5章\",\n";
-                ss << u8"    \"ptBR\": \"Ato 5\",\n";
-                ss << u8"    \"ruRU\": \"Акт 5\",\n";
-                ss << u8"    \"zhCN\": \"五幕\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27281,\n";
-                ss << u8"    \"Key\": \"Cave\",\n";
-                ss << u8"    \"enUS\": \"Cave\",\n";
-                ss << u8"    \"zhTW\": \"洞穴\",\n";
-                ss << u8"    \"deDE\": \"Grotte\",\n";
-                ss << u8"    \"esES\": \"Cueva\",\n";
-                ss << u8"    \"frFR\": \"Grotte\",\n";
-                ss << u8"    \"itIT\": \"Caverna\",\n";
-                ss << u8"    \"koKR\": \"동굴\",\n";
-                ss << u8"    \"plPL\": \"Jaskinia\",\n";
-                ss << u8"    \"esMX\": \"Cueva\",\n";
-                ss << u8"    \"jaJP\": \"洞窟\",\n";
-                ss << u8"    \"ptBR\": \"Caverna\",\n";
-                ss << u8"    \"ruRU\": \"Пещера\",\n";
-                ss << u8"    \"zhCN\": \"洞穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27282,\n";
-                ss << u8"    \"Key\": \"Underground Passage\",\n";
-                ss << u8"    \"enUS\": \"Underground Passage\",\n";
-                ss << u8"    \"zhTW\": \"地底通道\",\n";
-                ss << u8"    \"deDE\": \"Unterirdischer Durchgang\",\n";
-                ss << u8"    \"esES\": \"Pasadizo Subterráneo\",\n";
-                ss << u8"    \"frFR\": \"Passage souterrain\",\n";
-                ss << u8"    \"itIT\": \"Passaggio Sotterraneo\",\n";
-                ss << u8"    \"koKR\": \"지하 통로\",\n";
-                ss << u8"    \"plPL\": \"Podziemny Tunel\",\n";
-                ss << u8"    \"esMX\": \"Pasaje Subterráneo\",\n";
-                ss << u8"    \"jaJP\": \"地下道\",\n";
-                ss << u8"    \"ptBR\": \"Passagem Subterrânea\",\n";
-                ss << u8"    \"ruRU\": \"Подземный проход\",\n";
-                ss << u8"    \"zhCN\": \"地下通道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27283,\n";
-                ss << u8"    \"Key\": \"Hole\",\n";
-                ss << u8"    \"enUS\": \"Hole\",\n";
-                ss << u8"    \"zhTW\": \"地洞\",\n";
-                ss << u8"    \"deDE\": \"Loch\",\n";
-                ss << u8"    \"esES\": \"Hoyo\",\n";
-                ss << u8"    \"frFR\": \"Gouffre\",\n";
-                ss << u8"    \"itIT\": \"Buco\",\n";
-                ss << u8"    \"koKR\": \"구렁\",\n";
-                ss << u8"    \"plPL\": \"Jama\",\n";
-                ss << u8"    \"esMX\": \"Agujero\",\n";
-                ss << u8"    \"jaJP\": \"洞穴\",\n";
-                ss << u8"    \"ptBR\": \"Buraco\",\n";
-                ss << u8"    \"ruRU\": \"Нора\",\n";
-                ss << u8"    \"zhCN\": \"地洞\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27284,\n";
-                ss << u8"    \"Key\": \"Act 1 Pit\",\n";
-                ss << u8"    \"enUS\": \"Pit\",\n";
-                ss << u8"    \"zhTW\": \"地穴\",\n";
-                ss << u8"    \"deDE\": \"Grube\",\n";
-                ss << u8"    \"esES\": \"Foso\",\n";
-                ss << u8"    \"frFR\": \"Fosse\",\n";
-                ss << u8"    \"itIT\": \"Abisso\",\n";
-                ss << u8"    \"koKR\": \"구덩이\",\n";
-                ss << u8"    \"plPL\": \"Czeluść\",\n";
-                ss << u8"    \"esMX\": \"Foso\",\n";
-                ss << u8"    \"jaJP\": \"穴ぐら\",\n";
-                ss << u8"    \"ptBR\": \"Fosso\",\n";
-                ss << u8"    \"ruRU\": \"Дыра\",\n";
-                ss << u8"    \"zhCN\": \"深坑\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27285,\n";
-                ss << u8"    \"Key\": \"Jail\",\n";
-                ss << u8"    \"enUS\": \"Jail\",\n";
-                ss << u8"    \"zhTW\": \"監牢\",\n";
-                ss << u8"    \"deDE\": \"Gefängnis\",\n";
-                ss << u8"    \"esES\": \"Cárcel\",\n";
-                ss << u8"    \"frFR\": \"Prison\",\n";
-                ss << u8"    \"itIT\": \"Prigione\",\n";
-                ss << u8"    \"koKR\": \"감옥\",\n";
-                ss << u8"    \"plPL\": \"Więzienie\",\n";
-                ss << u8"    \"esMX\": \"Prisión\",\n";
-                ss << u8"    \"jaJP\": \"牢獄\",\n";
-                ss << u8"    \"ptBR\": \"Prisão\",\n";
-                ss << u8"    \"ruRU\": \"Тюрьма\",\n";
-                ss << u8"    \"zhCN\": \"监狱\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27286,\n";
-                ss << u8"    \"Key\": \"Catacombs\",\n";
-                ss << u8"    \"enUS\": \"Catacombs\",\n";
-                ss << u8"    \"zhTW\": \"地下墓穴\",\n";
-                ss << u8"    \"deDE\": \"Katakomben\",\n";
-                ss << u8"    \"esES\": \"Catacumbas\",\n";
-                ss << u8"    \"frFR\": \"Catacombes\",\n";
-                ss << u8"    \"itIT\": \"Catacombe\",\n";
-                ss << u8"    \"koKR\": \"지하 묘지\",\n";
-                ss << u8"    \"plPL\": \"Katakumby\",\n";
-                ss << u8"    \"esMX\": \"Catacumbas\",\n";
-                ss << u8"    \"jaJP\": \"地下墓地\",\n";
-                ss << u8"    \"ptBR\": \"Catacumbas\",\n";
-                ss << u8"    \"ruRU\": \"Катакомбы\",\n";
-                ss << u8"    \"zhCN\": \"地下墓穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27287,\n";
-                ss << u8"    \"Key\": \"Lut Gholein Sewers\",\n";
-                ss << u8"    \"enUS\": \"Lut Gholein Sewers\",\n";
-                ss << u8"    \"zhTW\": \"魯高因下水道\",\n";
-                ss << u8"    \"deDE\": \"Kanalisation von Lut Gholein\",\n";
-                ss << u8"    \"esES\": \"Cloacas de Lut Gholein\",\n";
-                ss << u8"    \"frFR\": \"Égouts de Lut Gholein\",\n";
-                ss << u8"    \"itIT\": \"Fogne di Lut Gholein\",\n";
-                ss << u8"    \"koKR\": \"루트 골레인 하수도\",\n";
-                ss << u8"    \"plPL\": \"Kanały pod Lut Gholein\",\n";
-                ss << u8"    \"esMX\": \"Cloacas de Lut Gholein\",\n";
-                ss << u8"    \"jaJP\": \"ラット・ゴーレインの下水道\",\n";
-                ss << u8"    \"ptBR\": \"Esgoto de Lut Gholein\",\n";
-                ss << u8"    \"ruRU\": \"Стоки Лут Голейна\",\n";
-                ss << u8"    \"zhCN\": \"鲁·高因下水道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27288,\n";
-                ss << u8"    \"Key\": \"Kurast Sewers\",\n";
-                ss << u8"    \"enUS\": \"Kurast Sewers\",\n";
-                ss << u8"    \"zhTW\": \"庫拉斯特下水道\",\n";
-                ss << u8"    \"deDE\": \"Kanalisation von Kurast\",\n";
-                ss << u8"    \"esES\": \"Cloacas de Kurast\",\n";
-                ss << u8"    \"frFR\": \"Égouts de Kurast\",\n";
-                ss << u8"    \"itIT\": \"Fogne di Kurast\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 하수도\",\n";
-                ss << u8"    \"plPL\": \"Kanały pod Kurast\",\n";
-                ss << u8"    \"esMX\": \"Cloacas de Kurast\",\n";
-                ss << u8"    \"jaJP\": \"クラストの下水道\",\n";
-                ss << u8"    \"ptBR\": \"Esgoto de Kurast\",\n";
-                ss << u8"    \"ruRU\": \"Стоки Кураста\",\n";
-                ss << u8"    \"zhCN\": \"库拉斯特下水道\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27289,\n";
-                ss << u8"    \"Key\": \"Temple Halls\",\n";
-                ss << u8"    \"enUS\": \"Temple Halls\",\n";
-                ss << u8"    \"zhTW\": \"神殿大廳\",\n";
-                ss << u8"    \"deDE\": \"Tempelhallen\",\n";
-                ss << u8"    \"esES\": \"Salas del Templo\",\n";
-                ss << u8"    \"frFR\": \"Salles du temple\",\n";
-                ss << u8"    \"itIT\": \"Sale del Tempio\",\n";
-                ss << u8"    \"koKR\": \"사원 전당\",\n";
-                ss << u8"    \"plPL\": \"Komnaty Świątynne\",\n";
-                ss << u8"    \"esMX\": \"Salas del Templo\",\n";
-                ss << u8"    \"jaJP\": \"寺院の広間\",\n";
-                ss << u8"    \"ptBR\": \"Salões do Templo\",\n";
-                ss << u8"    \"ruRU\": \"Залы храма\",\n";
-                ss << u8"    \"zhCN\": \"神殿大厅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27290,\n";
-                ss << u8"    \"Key\": \"The Worldstone Keep\",\n";
-                ss << u8"    \"enUS\": \"Worldstone Keep\",\n";
-                ss << u8"    \"zhTW\": \"世界之石要塞\",\n";
-                ss << u8"    \"deDE\": \"Weltsteinturm\",\n";
-                ss << u8"    \"esES\": \"Torre de la Piedra del Mundo\",\n";
-                ss << u8"    \"frFR\": \"Donjon de la Pierre-Monde\",\n";
-                ss << u8"    \"itIT\": \"Forte della Pietra del Mondo\",\n";
-                ss << u8"    \"koKR\": \"세계석 성채\",\n";
-                ss << u8"    \"plPL\": \"Twierdza Kamienia Świata\",\n";
-                ss << u8"    \"esMX\": \"Fortaleza de la Piedra Ecuménica\",\n";
-                ss << u8"    \"jaJP\": \"ワールドストーン城塞\",\n";
-                ss << u8"    \"ptBR\": \"Forte da Pedra do Mundo\",\n";
-                ss << u8"    \"ruRU\": \"Крепость камня мироздания\",\n";
-                ss << u8"    \"zhCN\": \"世界之石要塞\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 27338,\n";
-                ss << u8"    \"Key\": \"MooMooFarmGroup\",\n";
-                ss << u8"    \"enUS\": \"ÿc8a non-existent levelÿc0\",\n";
-                ss << u8"    \"zhTW\": \"ÿc8不存在的關卡ÿc0\",\n";
-                ss << u8"    \"deDE\": \"ÿc8ein Level, das es gar nicht gibtÿc0\",\n";
-                ss << u8"    \"esES\": \"ÿc8un nivel que no existeÿc0\",\n";
-                ss << u8"    \"frFR\": \"ÿc8un niveau inexistantÿc0\",\n";
-                ss << u8"    \"itIT\": \"ÿc8un livello inesistenteÿc0\",\n";
-                ss << u8"    \"koKR\": \"ÿc8존재하지 않는 곳ÿc0\",\n";
-                ss << u8"    \"plPL\": \"ÿc8nieistniejący poziomÿc0\",\n";
-                ss << u8"    \"esMX\": \"ÿc8un nivel inexistenteÿc0\",\n";
-                ss << u8"    \"jaJP\": \"ÿc8存在しないところÿc0\",\n";
-                ss << u8"    \"ptBR\": \"ÿc8um nível inexistenteÿc0\",\n";
-                ss << u8"    \"ruRU\": \"ÿc8несуществующий уровеньÿc0\",\n";
-                ss << u8"    \"zhCN\": \"ÿc8不存在的等级ÿc0\"\n";
-                ss << u8"  }\n";
-                ss << u8"]\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"[\n",
+                u8"  {\n",
+                u8"    \"id\": 788,\n",
+                u8"    \"Key\": \"Moo Moo Farm\",\n",
+                u8"    \"enUS\": \"The Secret Cow Level\",\n",
+                u8"    \"zhTW\": \"秘密乳牛關\",\n",
+                u8"    \"deDE\": \"Das Geheime Kuhlevel\",\n",
+                u8"    \"esES\": \"Nivel Secreto de las Vacas\",\n",
+                u8"    \"frFR\": \"Le niveau secret des vaches\",\n",
+                u8"    \"itIT\": \"Livello Bovino Segreto\",\n",
+                u8"    \"koKR\": \"비밀의 젖소방\",\n",
+                u8"    \"plPL\": \"Sekretny krowi poziom\",\n",
+                u8"    \"esMX\": \"El Nivel Secreto de la Vaca\",\n",
+                u8"    \"jaJP\": \"秘密のモーモー牧場\",\n",
+                u8"    \"ptBR\": \"O Nível Secreto da Vaca\",\n",
+                u8"    \"ruRU\": \"Секретный коровий уровень\",\n",
+                u8"    \"zhCN\": \"神秘的奶牛关\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 789,\n",
+                u8"    \"Key\": \"Chaos Sanctum\",\n",
+                u8"    \"enUS\": \"The Chaos Sanctuary\",\n",
+                u8"    \"zhTW\": \"混沌魔殿\",\n",
+                u8"    \"deDE\": \"Das Chaossanktuarium\",\n",
+                u8"    \"esES\": \"Santuario del Caos\",\n",
+                u8"    \"frFR\": \"Le Sanctuaire du chaos\",\n",
+                u8"    \"itIT\": \"Il Santuario del Caos\",\n",
+                u8"    \"koKR\": \"혼돈의 성역\",\n",
+                u8"    \"plPL\": \"Sanktuarium Chaosu\",\n",
+                u8"    \"esMX\": \"El Santuario del Caos\",\n",
+                u8"    \"jaJP\": \"混沌の聖域\",\n",
+                u8"    \"ptBR\": \"O Santuário do Caos\",\n",
+                u8"    \"ruRU\": \"Святилище Хаоса\",\n",
+                u8"    \"zhCN\": \"混沌避难所\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 790,\n",
+                u8"    \"Key\": \"The Pandemonium Fortress\",\n",
+                u8"    \"enUS\": \"The Pandemonium Fortress\",\n",
+                u8"    \"zhTW\": \"混沌界要塞\",\n",
+                u8"    \"deDE\": \"Die Festung des Wahnsinns\",\n",
+                u8"    \"esES\": \"Fortaleza del Pandemónium\",\n",
+                u8"    \"frFR\": \"La forteresse de Pandémonium\",\n",
+                u8"    \"itIT\": \"La Fortezza del Pandemonio\",\n",
+                u8"    \"koKR\": \"혼돈의 요새\",\n",
+                u8"    \"plPL\": \"Forteca Pandemonium\",\n",
+                u8"    \"esMX\": \"La Fortaleza del Pandemonio\",\n",
+                u8"    \"jaJP\": \"伏魔殿の砦\",\n",
+                u8"    \"ptBR\": \"A Fortaleza Pandemônio\",\n",
+                u8"    \"ruRU\": \"Крепость Пандемония\",\n",
+                u8"    \"zhCN\": \"混沌要塞\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 791,\n",
+                u8"    \"Key\": \"River of Flame\",\n",
+                u8"    \"enUS\": \"River of Flame\",\n",
+                u8"    \"zhTW\": \"火焰之河\",\n",
+                u8"    \"deDE\": \"Flammenfluss\",\n",
+                u8"    \"esES\": \"Río de Llamas\",\n",
+                u8"    \"frFR\": \"La Rivière de feu\",\n",
+                u8"    \"itIT\": \"Fiume Infuocato\",\n",
+                u8"    \"koKR\": \"불길의 강\",\n",
+                u8"    \"plPL\": \"Rzeka Płomieni\",\n",
+                u8"    \"esMX\": \"Río de Fuego\",\n",
+                u8"    \"jaJP\": \"炎の河\",\n",
+                u8"    \"ptBR\": \"Rio de Chamas\",\n",
+                u8"    \"ruRU\": \"Огненная река\",\n",
+                u8"    \"zhCN\": \"火焰之河\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 792,\n",
+                u8"    \"Key\": \"Outer Steppes\",\n",
+                u8"    \"enUS\": \"Outer Steppes\",\n",
+                u8"    \"zhTW\": \"外圍荒原\",\n",
+                u8"    \"deDE\": \"Äußere Steppe\",\n",
+                u8"    \"esES\": \"Estepas Exteriores\",\n",
+                u8"    \"frFR\": \"Les Steppes infinies\",\n",
+                u8"    \"itIT\": \"Steppe Esterne\",\n",
+                u8"    \"koKR\": \"평원 외곽\",\n",
+                u8"    \"plPL\": \"Zewnętrzne Stepy\",\n",
+                u8"    \"esMX\": \"Estepa Exterior\",\n",
+                u8"    \"jaJP\": \"果ての草原\",\n",
+                u8"    \"ptBR\": \"Estepes Externas\",\n",
+                u8"    \"ruRU\": \"Рубежные степи\",\n",
+                u8"    \"zhCN\": \"外域荒原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 793,\n",
+                u8"    \"Key\": \"Plains of Despair\",\n",
+                u8"    \"enUS\": \"Plains of Despair\",\n",
+                u8"    \"zhTW\": \"絕望平原\",\n",
+                u8"    \"deDE\": \"Ebene der Verzweiflung\",\n",
+                u8"    \"esES\": \"Llanuras del Desaliento\",\n",
+                u8"    \"frFR\": \"Les Plaines du désespoir\",\n",
+                u8"    \"itIT\": \"Pianure della Disperazione\",\n",
+                u8"    \"koKR\": \"절망의 평원\",\n",
+                u8"    \"plPL\": \"Równina Rozpaczy\",\n",
+                u8"    \"esMX\": \"Llanura del Desespero\",\n",
+                u8"    \"jaJP\": \"絶望の平原\",\n",
+                u8"    \"ptBR\": \"Planície do Desespero\",\n",
+                u8"    \"ruRU\": \"Долина Отчаяния\",\n",
+                u8"    \"zhCN\": \"绝望平原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 794,\n",
+                u8"    \"Key\": \"City of the Damned\",\n",
+                u8"    \"enUS\": \"City of the Damned\",\n",
+                u8"    \"zhTW\": \"罪罰之城\",\n",
+                u8"    \"deDE\": \"Stadt der Verdammten\",\n",
+                u8"    \"esES\": \"Ciudad de los Malditos\",\n",
+                u8"    \"frFR\": \"La Ville des damnés\",\n",
+                u8"    \"itIT\": \"Città Dannata\",\n",
+                u8"    \"koKR\": \"저주받은 자들의 도시\",\n",
+                u8"    \"plPL\": \"Miasto Potępionych\",\n",
+                u8"    \"esMX\": \"Ciudad de los Condenados\",\n",
+                u8"    \"jaJP\": \"呪われし街\",\n",
+                u8"    \"ptBR\": \"Cidade dos Condenados\",\n",
+                u8"    \"ruRU\": \"Город Проклятых\",\n",
+                u8"    \"zhCN\": \"神罚之城\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 795,\n",
+                u8"    \"Key\": \"Durance of Hate Level 3\",\n",
+                u8"    \"enUS\": \"Durance of Hate Level 3\",\n",
+                u8"    \"zhTW\": \"憎恨囚牢第三層\",\n",
+                u8"    \"deDE\": \"Kerker des Hasses, Ebene 3\",\n",
+                u8"    \"esES\": \"Represión del Odio nivel 3\",\n",
+                u8"    \"frFR\": \"La Prison de la Haine niv. 3\",\n",
+                u8"    \"itIT\": \"Prigione dell'Odio L3\",\n",
+                u8"    \"koKR\": \"증오의 억류지 3층\",\n",
+                u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 3\",\n",
+                u8"    \"esMX\": \"Prisión de Odio Nivel 3\",\n",
+                u8"    \"jaJP\": \"憎悪の檻: 第3階層\",\n",
+                u8"    \"ptBR\": \"Cárcere do Ódio Nível 3\",\n",
+                u8"    \"ruRU\": \"Узилище Ненависти: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"憎恨囚牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 796,\n",
+                u8"    \"Key\": \"Durance of Hate Level 2\",\n",
+                u8"    \"enUS\": \"Durance of Hate Level 2\",\n",
+                u8"    \"zhTW\": \"憎恨囚牢第二層\",\n",
+                u8"    \"deDE\": \"Kerker des Hasses, Ebene 2\",\n",
+                u8"    \"esES\": \"Represión del Odio nivel 2\",\n",
+                u8"    \"frFR\": \"La Prison de la Haine niv. 2\",\n",
+                u8"    \"itIT\": \"Prigione dell'Odio L2\",\n",
+                u8"    \"koKR\": \"증오의 억류지 2층\",\n",
+                u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 2\",\n",
+                u8"    \"esMX\": \"Prisión de Odio Nivel 2\",\n",
+                u8"    \"jaJP\": \"憎悪の檻: 第2階層\",\n",
+                u8"    \"ptBR\": \"Cárcere do Ódio Nível 2\",\n",
+                u8"    \"ruRU\": \"Узилище Ненависти: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"憎恨囚牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 797,\n",
+                u8"    \"Key\": \"Durance of Hate Level 1\",\n",
+                u8"    \"enUS\": \"Durance of Hate Level 1\",\n",
+                u8"    \"zhTW\": \"憎恨囚牢第一層\",\n",
+                u8"    \"deDE\": \"Kerker des Hasses, Ebene 1\",\n",
+                u8"    \"esES\": \"Represión del Odio nivel 1\",\n",
+                u8"    \"frFR\": \"La Prison de la Haine niv. 1\",\n",
+                u8"    \"itIT\": \"Prigione dell'Odio L1\",\n",
+                u8"    \"koKR\": \"증오의 억류지 1층\",\n",
+                u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 1\",\n",
+                u8"    \"esMX\": \"Prisión de Odio Nivel 1\",\n",
+                u8"    \"jaJP\": \"憎悪の檻: 第1階層\",\n",
+                u8"    \"ptBR\": \"Cárcere do Ódio Nível 1\",\n",
+                u8"    \"ruRU\": \"Узилище Ненависти: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"憎恨囚牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 798,\n",
+                u8"    \"Key\": \"Disused Reliquary\",\n",
+                u8"    \"enUS\": \"Disused Reliquary\",\n",
+                u8"    \"zhTW\": \"廢棄的聖殿\",\n",
+                u8"    \"deDE\": \"Verlassener Reliquienschrein\",\n",
+                u8"    \"esES\": \"Relicario Abandonado\",\n",
+                u8"    \"frFR\": \"Le Reliquaire abandonné\",\n",
+                u8"    \"itIT\": \"Reliquiario Abbandonato\",\n",
+                u8"    \"koKR\": \"버려진 성물실\",\n",
+                u8"    \"plPL\": \"Opuszczony Relikwiarz\",\n",
+                u8"    \"esMX\": \"Relicario Abandonado\",\n",
+                u8"    \"jaJP\": \"打ち捨てられし聖廟\",\n",
+                u8"    \"ptBR\": \"Relicário Abandonado\",\n",
+                u8"    \"ruRU\": \"Заброшенный реликварий\",\n",
+                u8"    \"zhCN\": \"废弃的藏骨室\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 799,\n",
+                u8"    \"Key\": \"Ruined Fane\",\n",
+                u8"    \"enUS\": \"Ruined Fane\",\n",
+                u8"    \"zhTW\": \"荒廢的寺院\",\n",
+                u8"    \"deDE\": \"Zerfallenes Heiligtum\",\n",
+                u8"    \"esES\": \"Fano en Ruinas\",\n",
+                u8"    \"frFR\": \"Le Sanctuaire en ruine\",\n",
+                u8"    \"itIT\": \"Tempio Antico\",\n",
+                u8"    \"koKR\": \"허물어진 교회당\",\n",
+                u8"    \"plPL\": \"Zrujnowana Kaplica\",\n",
+                u8"    \"esMX\": \"Santuario Destruido\",\n",
+                u8"    \"jaJP\": \"荒れ果てた神殿\",\n",
+                u8"    \"ptBR\": \"Ádito Arruinado\",\n",
+                u8"    \"ruRU\": \"Разрушенная церковь\",\n",
+                u8"    \"zhCN\": \"被毁的礼拜堂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 800,\n",
+                u8"    \"Key\": \"Forgotten Temple\",\n",
+                u8"    \"enUS\": \"Forgotten Temple\",\n",
+                u8"    \"zhTW\": \"遺忘神殿\",\n",
+                u8"    \"deDE\": \"Vergessener Tempel\",\n",
+                u8"    \"esES\": \"Templo Olvidado\",\n",
+                u8"    \"frFR\": \"Le Temple oublié\",\n",
+                u8"    \"itIT\": \"Tempio Dimenticato\",\n",
+                u8"    \"koKR\": \"잊힌 사원\",\n",
+                u8"    \"plPL\": \"Zapomniana Świątynia\",\n",
+                u8"    \"esMX\": \"Templo Olvidado\",\n",
+                u8"    \"jaJP\": \"忘れ去られし寺院\",\n",
+                u8"    \"ptBR\": \"Templo Esquecido\",\n",
+                u8"    \"ruRU\": \"Забытый храм\",\n",
+                u8"    \"zhCN\": \"被遗忘的神殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 801,\n",
+                u8"    \"Key\": \"Forgotten Reliquary\",\n",
+                u8"    \"enUS\": \"Forgotten Reliquary\",\n",
+                u8"    \"zhTW\": \"遺忘的聖殿\",\n",
+                u8"    \"deDE\": \"Vergessener Reliquienschrein\",\n",
+                u8"    \"esES\": \"Relicario Olvidado\",\n",
+                u8"    \"frFR\": \"Le Reliquaire oublié\",\n",
+                u8"    \"itIT\": \"Reliquiario Dimenticato\",\n",
+                u8"    \"koKR\": \"잊힌 성물실\",\n",
+                u8"    \"plPL\": \"Zapomniany Relikwiarz\",\n",
+                u8"    \"esMX\": \"Relicario Olvidado\",\n",
+                u8"    \"jaJP\": \"忘れ去られし聖廟\",\n",
+                u8"    \"ptBR\": \"Relicário Esquecido\",\n",
+                u8"    \"ruRU\": \"Забытый реликварий\",\n",
+                u8"    \"zhCN\": \"被遗忘的藏骨室\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 802,\n",
+                u8"    \"Key\": \"Disused Fane\",\n",
+                u8"    \"enUS\": \"Disused Fane\",\n",
+                u8"    \"zhTW\": \"廢棄的寺院\",\n",
+                u8"    \"deDE\": \"Verlassenes Heiligtum\",\n",
+                u8"    \"esES\": \"Fano Abandonado\",\n",
+                u8"    \"frFR\": \"Le Sanctuaire abandonné\",\n",
+                u8"    \"itIT\": \"Tempio Abbandonato\",\n",
+                u8"    \"koKR\": \"버려진 교회당\",\n",
+                u8"    \"plPL\": \"Opuszczona Kaplica\",\n",
+                u8"    \"esMX\": \"Santuario Abandonado\",\n",
+                u8"    \"jaJP\": \"打ち捨てられし神殿\",\n",
+                u8"    \"ptBR\": \"Ádito Abandonado\",\n",
+                u8"    \"ruRU\": \"Заброшенная церковь\",\n",
+                u8"    \"zhCN\": \"废弃的礼拜堂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 803,\n",
+                u8"    \"Key\": \"Ruined Temple\",\n",
+                u8"    \"enUS\": \"Ruined Temple\",\n",
+                u8"    \"zhTW\": \"荒廢的神殿\",\n",
+                u8"    \"deDE\": \"Zerfallener Tempel\",\n",
+                u8"    \"esES\": \"Templo en Ruinas\",\n",
+                u8"    \"frFR\": \"Le Temple en ruine\",\n",
+                u8"    \"itIT\": \"Tempio in Rovina\",\n",
+                u8"    \"koKR\": \"허물어진 사원\",\n",
+                u8"    \"plPL\": \"Zrujnowana Świątynia\",\n",
+                u8"    \"esMX\": \"Templo Destruido\",\n",
+                u8"    \"jaJP\": \"荒れ果てた寺院\",\n",
+                u8"    \"ptBR\": \"Templo Arruinado\",\n",
+                u8"    \"ruRU\": \"Разрушенный храм\",\n",
+                u8"    \"zhCN\": \"毁灭的神庙\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 804,\n",
+                u8"    \"Key\": \"Flayer Dungeon Level 3\",\n",
+                u8"    \"enUS\": \"Flayer Dungeon Level 3\",\n",
+                u8"    \"zhTW\": \"剝皮地牢第三層\",\n",
+                u8"    \"deDE\": \"Schinderdungeon, Ebene 3\",\n",
+                u8"    \"esES\": \"Mazmorra de Desollamiento nivel 3\",\n",
+                u8"    \"frFR\": \"La Prison de l’Écorcheur niv. 3\",\n",
+                u8"    \"itIT\": \"Sotterraneo Scorticatore L3\",\n",
+                u8"    \"koKR\": \"약탈자 소굴 3층\",\n",
+                u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 3\",\n",
+                u8"    \"esMX\": \"Calabozo de los Desolladores Nivel 3\",\n",
+                u8"    \"jaJP\": \"フレイヤーの地下牢: 第3階層\",\n",
+                u8"    \"ptBR\": \"Masmorra dos Esfoladores Nível 3\",\n",
+                u8"    \"ruRU\": \"Подземелье свежевателей: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"剥皮魔监牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 805,\n",
+                u8"    \"Key\": \"Flayer Dungeon Level 2\",\n",
+                u8"    \"enUS\": \"Flayer Dungeon Level 2\",\n",
+                u8"    \"zhTW\": \"剝皮地牢第二層\",\n",
+                u8"    \"deDE\": \"Schinderdungeon, Ebene 2\",\n",
+                u8"    \"esES\": \"Mazmorra de Desollamiento nivel 2\",\n",
+                u8"    \"frFR\": \"La Prison de l’Écorcheur niv. 2\",\n",
+                u8"    \"itIT\": \"Sotterraneo Scorticatore L2\",\n",
+                u8"    \"koKR\": \"약탈자 소굴 2층\",\n",
+                u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 2\",\n",
+                u8"    \"esMX\": \"Calabozo de los Desolladores Nivel 2\",\n",
+                u8"    \"jaJP\": \"フレイヤーの地下牢: 第2階層\",\n",
+                u8"    \"ptBR\": \"Masmorra dos Esfoladores Nível 2\",\n",
+                u8"    \"ruRU\": \"Подземелье свежевателей: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"剥皮魔监牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 806,\n",
+                u8"    \"Key\": \"Flayer Dungeon Level 1\",\n",
+                u8"    \"enUS\": \"Flayer Dungeon Level 1\",\n",
+                u8"    \"zhTW\": \"剝皮地牢第一層\",\n",
+                u8"    \"deDE\": \"Schinderdungeon, Ebene 1\",\n",
+                u8"    \"esES\": \"Mazmorra de Desollamiento nivel 1\",\n",
+                u8"    \"frFR\": \"La Prison de l’Écorcheur niv. 1\",\n",
+                u8"    \"itIT\": \"Sotterraneo Scorticatore L1\",\n",
+                u8"    \"koKR\": \"약탈자 소굴 1층\",\n",
+                u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 1\",\n",
+                u8"    \"esMX\": \"Calabozo de los Desolladores Nivel 1\",\n",
+                u8"    \"jaJP\": \"フレイヤーの地下牢: 第1階層\",\n",
+                u8"    \"ptBR\": \"Masmorra dos Esfoladores Nível 1\",\n",
+                u8"    \"ruRU\": \"Подземелье свежевателей: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"剥皮魔监牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 807,\n",
+                u8"    \"Key\": \"Swampy Pit Level 3\",\n",
+                u8"    \"enUS\": \"Swampy Pit Level 3\",\n",
+                u8"    \"zhTW\": \"沼澤地穴第三層\",\n",
+                u8"    \"deDE\": \"Sumpfloch, Ebene 3\",\n",
+                u8"    \"esES\": \"Foso Pantanoso nivel 3\",\n",
+                u8"    \"frFR\": \"Le Bourbier niv. 3\",\n",
+                u8"    \"itIT\": \"Abisso Paludoso L3\",\n",
+                u8"    \"koKR\": \"습한 구덩이 3층\",\n",
+                u8"    \"plPL\": \"Bagienna Czeluść – Poziom 3\",\n",
+                u8"    \"esMX\": \"Foso Pantanoso Nivel 3\",\n",
+                u8"    \"jaJP\": \"沼地の穴ぐら: 第3階層\",\n",
+                u8"    \"ptBR\": \"Fosso Pantanoso Nível 3\",\n",
+                u8"    \"ruRU\": \"Глубокая трясина: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"沼泽陷坑三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 808,\n",
+                u8"    \"Key\": \"Swampy Pit Level 2\",\n",
+                u8"    \"enUS\": \"Swampy Pit Level 2\",\n",
+                u8"    \"zhTW\": \"沼澤地穴第二層\",\n",
+                u8"    \"deDE\": \"Sumpfloch, Ebene 2\",\n",
+                u8"    \"esES\": \"Foso Pantanoso nivel 2\",\n",
+                u8"    \"frFR\": \"Le Bourbier niv. 2\",\n",
+                u8"    \"itIT\": \"Abisso Paludoso L2\",\n",
+                u8"    \"koKR\": \"습한 구덩이 2층\",\n",
+                u8"    \"plPL\": \"Bagienna Czeluść – Poziom 2\",\n",
+                u8"    \"esMX\": \"Foso Pantanoso Nivel 2\",\n",
+                u8"    \"jaJP\": \"沼地の穴ぐら: 第2階層\",\n",
+                u8"    \"ptBR\": \"Fosso Pantanoso Nível 2\",\n",
+                u8"    \"ruRU\": \"Глубокая трясина: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"沼泽陷坑二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 809,\n",
+                u8"    \"Key\": \"Swampy Pit Level 1\",\n",
+                u8"    \"enUS\": \"Swampy Pit Level 1\",\n",
+                u8"    \"zhTW\": \"沼澤地穴第一層\",\n",
+                u8"    \"deDE\": \"Sumpfloch, Ebene 1\",\n",
+                u8"    \"esES\": \"Foso Pantanoso nivel 1\",\n",
+                u8"    \"frFR\": \"Le Bourbier niv. 1\",\n",
+                u8"    \"itIT\": \"Abisso Paludoso L1\",\n",
+                u8"    \"koKR\": \"습한 구덩이 1층\",\n",
+                u8"    \"plPL\": \"Bagienna Czeluść – Poziom 1\",\n",
+                u8"    \"esMX\": \"Foso Pantanoso Nivel 1\",\n",
+                u8"    \"jaJP\": \"沼地の穴ぐら: 第1階層\",\n",
+                u8"    \"ptBR\": \"Fosso Pantanoso Nível 1\",\n",
+                u8"    \"ruRU\": \"Глубокая трясина: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"沼泽陷坑一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 810,\n",
+                u8"    \"Key\": \"Spider Cave\",\n",
+                u8"    \"enUS\": \"Arachnid Lair\",\n",
+                u8"    \"zhTW\": \"蜘蛛巢穴\",\n",
+                u8"    \"deDE\": \"Spinnenmonstergruft\",\n",
+                u8"    \"esES\": \"Cubil Arácnido\",\n",
+                u8"    \"frFR\": \"Le Repaire de l’Arachnide\",\n",
+                u8"    \"itIT\": \"Covo degli Aracnidi\",\n",
+                u8"    \"koKR\": \"독거미 둥지\",\n",
+                u8"    \"plPL\": \"Legowisko Arachnidów\",\n",
+                u8"    \"esMX\": \"Guarida Arácnida\",\n",
+                u8"    \"jaJP\": \"蜘蛛の巣穴\",\n",
+                u8"    \"ptBR\": \"Covil Aracnídeo\",\n",
+                u8"    \"ruRU\": \"Логово арахнидов\",\n",
+                u8"    \"zhCN\": \"巨蛛巢穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 811,\n",
+                u8"    \"Key\": \"Spider Cavern\",\n",
+                u8"    \"enUS\": \"Spider Cavern\",\n",
+                u8"    \"zhTW\": \"蜘蛛洞窟\",\n",
+                u8"    \"deDE\": \"Spinnenhöhle\",\n",
+                u8"    \"esES\": \"Caverna de Arañas\",\n",
+                u8"    \"frFR\": \"La Caverne de l’Araignée\",\n",
+                u8"    \"itIT\": \"Caverna del Ragno\",\n",
+                u8"    \"koKR\": \"거미 동굴\",\n",
+                u8"    \"plPL\": \"Grota Pająków\",\n",
+                u8"    \"esMX\": \"Caverna de Arañas\",\n",
+                u8"    \"jaJP\": \"蜘蛛の洞窟\",\n",
+                u8"    \"ptBR\": \"Caverna Aracnídea\",\n",
+                u8"    \"ruRU\": \"Паучья пещера\",\n",
+                u8"    \"zhCN\": \"蜘蛛洞穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 812,\n",
+                u8"    \"Key\": \"Travincal\",\n",
+                u8"    \"enUS\": \"Travincal\",\n",
+                u8"    \"zhTW\": \"崔凡克\",\n",
+                u8"    \"deDE\": \"Travincal\",\n",
+                u8"    \"esES\": \"Travincal\",\n",
+                u8"    \"frFR\": \"Travincal\",\n",
+                u8"    \"itIT\": \"Travincal\",\n",
+                u8"    \"koKR\": \"트라빈칼\",\n",
+                u8"    \"plPL\": \"Travincal\",\n",
+                u8"    \"esMX\": \"Travincal\",\n",
+                u8"    \"jaJP\": \"トラヴィンカル\",\n",
+                u8"    \"ptBR\": \"Travincal\",\n",
+                u8"    \"ruRU\": \"Травинкаль\",\n",
+                u8"    \"zhCN\": \"崔凡克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 813,\n",
+                u8"    \"Key\": \"Kurast Causeway\",\n",
+                u8"    \"enUS\": \"Kurast Causeway\",\n",
+                u8"    \"zhTW\": \"庫拉斯特堤道\",\n",
+                u8"    \"deDE\": \"Damm von Kurast\",\n",
+                u8"    \"esES\": \"Calzada de Kurast\",\n",
+                u8"    \"frFR\": \"La Chaussée de Kurast\",\n",
+                u8"    \"itIT\": \"Strada per Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 둑길\",\n",
+                u8"    \"plPL\": \"Grobla Kurast\",\n",
+                u8"    \"esMX\": \"Calzada de Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト舗道\",\n",
+                u8"    \"ptBR\": \"Passagem de Kurast\",\n",
+                u8"    \"ruRU\": \"Курастская дамба\",\n",
+                u8"    \"zhCN\": \"库拉斯特堤道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 814,\n",
+                u8"    \"Key\": \"Upper Kurast\",\n",
+                u8"    \"enUS\": \"Upper Kurast\",\n",
+                u8"    \"zhTW\": \"庫拉斯特上層\",\n",
+                u8"    \"deDE\": \"Oberkurast\",\n",
+                u8"    \"esES\": \"Parte Alta de Kurast\",\n",
+                u8"    \"frFR\": \"Kurast - La ville haute\",\n",
+                u8"    \"itIT\": \"Kurast Superiore\",\n",
+                u8"    \"koKR\": \"상부 쿠라스트\",\n",
+                u8"    \"plPL\": \"Górne Kurast\",\n",
+                u8"    \"esMX\": \"Alta Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト上層\",\n",
+                u8"    \"ptBR\": \"Kurast Superior\",\n",
+                u8"    \"ruRU\": \"Верхний Кураст\",\n",
+                u8"    \"zhCN\": \"库拉斯特上层区\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 815,\n",
+                u8"    \"Key\": \"Kurast Bazaar\",\n",
+                u8"    \"enUS\": \"Kurast Bazaar\",\n",
+                u8"    \"zhTW\": \"庫拉斯特市集\",\n",
+                u8"    \"deDE\": \"Basar von Kurast\",\n",
+                u8"    \"esES\": \"Bazar de Kurast\",\n",
+                u8"    \"frFR\": \"Le Bazar de Kurast\",\n",
+                u8"    \"itIT\": \"Bazar di Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 시장\",\n",
+                u8"    \"plPL\": \"Bazar Kurast\",\n",
+                u8"    \"esMX\": \"Bazar de Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト・バザール\",\n",
+                u8"    \"ptBR\": \"Bazar de Kurast\",\n",
+                u8"    \"ruRU\": \"Курастский базар\",\n",
+                u8"    \"zhCN\": \"库拉斯特集市\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 816,\n",
+                u8"    \"Key\": \"Lower Kurast\",\n",
+                u8"    \"enUS\": \"Lower Kurast\",\n",
+                u8"    \"zhTW\": \"庫拉斯特下層\",\n",
+                u8"    \"deDE\": \"Unterkurast\",\n",
+                u8"    \"esES\": \"Parte Baja de Kurast\",\n",
+                u8"    \"frFR\": \"Kurast - La ville basse\",\n",
+                u8"    \"itIT\": \"Kurast Inferiore\",\n",
+                u8"    \"koKR\": \"하부 쿠라스트\",\n",
+                u8"    \"plPL\": \"Dolne Kurast\",\n",
+                u8"    \"esMX\": \"Baja Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト下層\",\n",
+                u8"    \"ptBR\": \"Kurast Inferior\",\n",
+                u8"    \"ruRU\": \"Нижний Кураст\",\n",
+                u8"    \"zhCN\": \"库拉斯特下层区\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 817,\n",
+                u8"    \"Key\": \"Flayer Jungle\",\n",
+                u8"    \"enUS\": \"Flayer Jungle\",\n",
+                u8"    \"zhTW\": \"剝皮叢林\",\n",
+                u8"    \"deDE\": \"Schinderdschungel\",\n",
+                u8"    \"esES\": \"Selva Desolladora\",\n",
+                u8"    \"frFR\": \"La Jungle de l’Écorcheur\",\n",
+                u8"    \"itIT\": \"Giungla Scorticatrice\",\n",
+                u8"    \"koKR\": \"약탈자 밀림\",\n",
+                u8"    \"plPL\": \"Dżungla Łupieżców\",\n",
+                u8"    \"esMX\": \"Jungla de los Desolladores\",\n",
+                u8"    \"jaJP\": \"フレイヤーの密林\",\n",
+                u8"    \"ptBR\": \"Selva dos Esfoladores\",\n",
+                u8"    \"ruRU\": \"Джунгли свежевателей\",\n",
+                u8"    \"zhCN\": \"剥皮魔丛林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 818,\n",
+                u8"    \"Key\": \"Great Marsh\",\n",
+                u8"    \"enUS\": \"Great Marsh\",\n",
+                u8"    \"zhTW\": \"大沼澤\",\n",
+                u8"    \"deDE\": \"Großes Moor\",\n",
+                u8"    \"esES\": \"Gran Pantano\",\n",
+                u8"    \"frFR\": \"Le Grand marais\",\n",
+                u8"    \"itIT\": \"Grande Palude\",\n",
+                u8"    \"koKR\": \"거대 습지\",\n",
+                u8"    \"plPL\": \"Wielkie Moczary\",\n",
+                u8"    \"esMX\": \"Gran Marisma\",\n",
+                u8"    \"jaJP\": \"大湿原\",\n",
+                u8"    \"ptBR\": \"Grande Charco\",\n",
+                u8"    \"ruRU\": \"Болотина\",\n",
+                u8"    \"zhCN\": \"庞大湿地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 819,\n",
+                u8"    \"Key\": \"Spider Forest\",\n",
+                u8"    \"enUS\": \"Spider Forest\",\n",
+                u8"    \"zhTW\": \"蜘蛛森林\",\n",
+                u8"    \"deDE\": \"Spinnenwald\",\n",
+                u8"    \"esES\": \"Bosque de Arañas\",\n",
+                u8"    \"frFR\": \"La Forêt de l’Araignée\",\n",
+                u8"    \"itIT\": \"Foresta del Ragno\",\n",
+                u8"    \"koKR\": \"거미 숲\",\n",
+                u8"    \"plPL\": \"Las Pająków\",\n",
+                u8"    \"esMX\": \"Bosque de Arañas\",\n",
+                u8"    \"jaJP\": \"蜘蛛の森\",\n",
+                u8"    \"ptBR\": \"Floresta Aracnídea\",\n",
+                u8"    \"ruRU\": \"Паучий лес\",\n",
+                u8"    \"zhCN\": \"蜘蛛森林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 820,\n",
+                u8"    \"Key\": \"Kurast Docktown\",\n",
+                u8"    \"enUS\": \"Kurast Docks\",\n",
+                u8"    \"zhTW\": \"庫拉斯特港口\",\n",
+                u8"    \"deDE\": \"Docks von Kurast\",\n",
+                u8"    \"esES\": \"Muelles de Kurast\",\n",
+                u8"    \"frFR\": \"Les Quais de Kurast\",\n",
+                u8"    \"itIT\": \"Zona Portuale di Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 부두\",\n",
+                u8"    \"plPL\": \"Doki Kurast\",\n",
+                u8"    \"esMX\": \"Muelles de Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト港\",\n",
+                u8"    \"ptBR\": \"Docas de Kurast\",\n",
+                u8"    \"ruRU\": \"Доки Кураста\",\n",
+                u8"    \"zhCN\": \"库拉斯特海港\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 821,\n",
+                u8"    \"Key\": \"Durance of Hate\",\n",
+                u8"    \"enUS\": \"Durance of Hate\",\n",
+                u8"    \"zhTW\": \"憎恨囚牢\",\n",
+                u8"    \"deDE\": \"Kerker des Hasses\",\n",
+                u8"    \"esES\": \"Represión del Odio\",\n",
+                u8"    \"frFR\": \"La Prison de la Haine\",\n",
+                u8"    \"itIT\": \"Prigione dell'Odio\",\n",
+                u8"    \"koKR\": \"증오의 억류지\",\n",
+                u8"    \"plPL\": \"Kazamaty Nienawiści\",\n",
+                u8"    \"esMX\": \"Prisión de Odio\",\n",
+                u8"    \"jaJP\": \"憎悪の檻\",\n",
+                u8"    \"ptBR\": \"Cárcere do Ódio\",\n",
+                u8"    \"ruRU\": \"Узилище ненависти\",\n",
+                u8"    \"zhCN\": \"憎恨囚牢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 822,\n",
+                u8"    \"Key\": \"Flayer Dungeon\",\n",
+                u8"    \"enUS\": \"Flayer Dungeon\",\n",
+                u8"    \"zhTW\": \"剝皮地牢\",\n",
+                u8"    \"deDE\": \"Schinderdungeon\",\n",
+                u8"    \"esES\": \"Mazmorra de Desollamiento\",\n",
+                u8"    \"frFR\": \"La Prison de l’Écorcheur\",\n",
+                u8"    \"itIT\": \"Sotterraneo Scorticatore\",\n",
+                u8"    \"koKR\": \"약탈자 소굴\",\n",
+                u8"    \"plPL\": \"Podziemia Łupieżców\",\n",
+                u8"    \"esMX\": \"Calabozo de los Desolladores\",\n",
+                u8"    \"jaJP\": \"フレイヤーの地下牢\",\n",
+                u8"    \"ptBR\": \"Masmorra dos Esfoladores\",\n",
+                u8"    \"ruRU\": \"Подземелье свежевателей\",\n",
+                u8"    \"zhCN\": \"剥皮魔监牢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 823,\n",
+                u8"    \"Key\": \"Swampy Pit\",\n",
+                u8"    \"enUS\": \"Swampy Pit\",\n",
+                u8"    \"zhTW\": \"沼澤地穴\",\n",
+                u8"    \"deDE\": \"Sumpfloch\",\n",
+                u8"    \"esES\": \"Foso Pantanoso\",\n",
+                u8"    \"frFR\": \"Le Bourbier\",\n",
+                u8"    \"itIT\": \"Abisso Paludoso\",\n",
+                u8"    \"koKR\": \"습한 구덩이\",\n",
+                u8"    \"plPL\": \"Bagienna Czeluść\",\n",
+                u8"    \"esMX\": \"Foso Pantanoso\",\n",
+                u8"    \"jaJP\": \"沼地の穴ぐら\",\n",
+                u8"    \"ptBR\": \"Fosso Pantanoso\",\n",
+                u8"    \"ruRU\": \"Глубокая трясина\",\n",
+                u8"    \"zhCN\": \"沼泽陷坑\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 824,\n",
+                u8"    \"Key\": \"Arcane Sanctuary\",\n",
+                u8"    \"enUS\": \"Arcane Sanctuary\",\n",
+                u8"    \"zhTW\": \"秘法聖殿\",\n",
+                u8"    \"deDE\": \"Geheime Zuflucht\",\n",
+                u8"    \"esES\": \"Santuario Arcano\",\n",
+                u8"    \"frFR\": \"Le Sanctuaire des Arcanes\",\n",
+                u8"    \"itIT\": \"Santuario Arcano\",\n",
+                u8"    \"koKR\": \"비전의 성역\",\n",
+                u8"    \"plPL\": \"Tajemne Sanktuarium\",\n",
+                u8"    \"esMX\": \"Santuario Arcano\",\n",
+                u8"    \"jaJP\": \"深遠なる聖域\",\n",
+                u8"    \"ptBR\": \"Santuário Arcano\",\n",
+                u8"    \"ruRU\": \"Магическое убежище\",\n",
+                u8"    \"zhCN\": \"神秘避难所\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 825,\n",
+                u8"    \"Key\": \"Duriel's Lair\",\n",
+                u8"    \"enUS\": \"Tal Rasha's Chamber\",\n",
+                u8"    \"zhTW\": \"塔拉夏的密室\",\n",
+                u8"    \"deDE\": \"Tal Rashas Kammer\",\n",
+                u8"    \"esES\": \"Cámara de Tal Rasha\",\n",
+                u8"    \"frFR\": \"La Chambre de Tal Rasha\",\n",
+                u8"    \"itIT\": \"Cripta di Tal Rasha\",\n",
+                u8"    \"koKR\": \"탈 라샤의 방\",\n",
+                u8"    \"plPL\": \"Komnata Tal Rashy\",\n",
+                u8"    \"esMX\": \"Cámara de Tal Rasha\",\n",
+                u8"    \"jaJP\": \"タル・ラシャの間\",\n",
+                u8"    \"ptBR\": \"Câmara de Tal Rasha\",\n",
+                u8"    \"ruRU\": \"Погребальный зал Тал Раши\",\n",
+                u8"    \"zhCN\": \"塔·拉夏的墓室\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 826,\n",
+                u8"    \"Key\": \"Tal Rasha's Tomb\",\n",
+                u8"    \"enUS\": \"Tal Rasha's Tomb\",\n",
+                u8"    \"zhTW\": \"塔拉夏的古墓\",\n",
+                u8"    \"deDE\": \"Tal Rashas Grab\",\n",
+                u8"    \"esES\": \"Tumba de Tal Rasha\",\n",
+                u8"    \"frFR\": \"Le Tombeau de Tal Rasha\",\n",
+                u8"    \"itIT\": \"Tomba di Tal Rasha\",\n",
+                u8"    \"koKR\": \"탈 라샤의 무덤\",\n",
+                u8"    \"plPL\": \"Grobowiec Tal Rashy\",\n",
+                u8"    \"esMX\": \"Tumba de Tal Rasha\",\n",
+                u8"    \"jaJP\": \"タル・ラシャの墓\",\n",
+                u8"    \"ptBR\": \"Tumba de Tal Rasha\",\n",
+                u8"    \"ruRU\": \"Гробница Тал Раши\",\n",
+                u8"    \"zhCN\": \"塔·拉夏之墓\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 827,\n",
+                u8"    \"Key\": \"Ancient Tunnels\",\n",
+                u8"    \"enUS\": \"Ancient Tunnels\",\n",
+                u8"    \"zhTW\": \"古代通道\",\n",
+                u8"    \"deDE\": \"Alte Tunnels\",\n",
+                u8"    \"esES\": \"Túneles Antiguos\",\n",
+                u8"    \"frFR\": \"Les Tunnels antiques\",\n",
+                u8"    \"itIT\": \"Antichi Tunnel\",\n",
+                u8"    \"koKR\": \"고대 토굴\",\n",
+                u8"    \"plPL\": \"Prastare Tunele\",\n",
+                u8"    \"esMX\": \"Túneles Antiguos\",\n",
+                u8"    \"jaJP\": \"古の坑道\",\n",
+                u8"    \"ptBR\": \"Túneis Ancestrais\",\n",
+                u8"    \"ruRU\": \"Древние туннели\",\n",
+                u8"    \"zhCN\": \"古代水道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 828,\n",
+                u8"    \"Key\": \"Maggot Lair Level 3\",\n",
+                u8"    \"enUS\": \"Maggot Lair Level 3\",\n",
+                u8"    \"zhTW\": \"蛆蟲巢穴第三層\",\n",
+                u8"    \"deDE\": \"Wurmgruft, Ebene 3\",\n",
+                u8"    \"esES\": \"Cubil de Gusanos nivel 3\",\n",
+                u8"    \"frFR\": \"Le Repaire du ver niv. 3\",\n",
+                u8"    \"itIT\": \"Covo delle Larve L3\",\n",
+                u8"    \"koKR\": \"구더기 굴 3층\",\n",
+                u8"    \"plPL\": \"Robacze Gniazdo – Poziom 3\",\n",
+                u8"    \"esMX\": \"Guarida de Gusanos Nivel 3\",\n",
+                u8"    \"jaJP\": \"地虫の巣穴: 第3階層\",\n",
+                u8"    \"ptBR\": \"Covil de Vermes Nível 3\",\n",
+                u8"    \"ruRU\": \"Логово мокриц: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"蛆虫巢穴三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 829,\n",
+                u8"    \"Key\": \"Maggot Lair Level 2\",\n",
+                u8"    \"enUS\": \"Maggot Lair Level 2\",\n",
+                u8"    \"zhTW\": \"蛆蟲巢穴第二層\",\n",
+                u8"    \"deDE\": \"Wurmgruft, Ebene 2\",\n",
+                u8"    \"esES\": \"Cubil de Gusanos nivel 2\",\n",
+                u8"    \"frFR\": \"Le Repaire du ver niv. 2\",\n",
+                u8"    \"itIT\": \"Covo delle Larve L2\",\n",
+                u8"    \"koKR\": \"구더기 굴 2층\",\n",
+                u8"    \"plPL\": \"Robacze Gniazdo – Poziom 2\",\n",
+                u8"    \"esMX\": \"Guarida de Gusanos Nivel 2\",\n",
+                u8"    \"jaJP\": \"地虫の巣穴: 第2階層\",\n",
+                u8"    \"ptBR\": \"Covil de Vermes Nível 2\",\n",
+                u8"    \"ruRU\": \"Логово мокриц: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"蛆虫巢穴二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 830,\n",
+                u8"    \"Key\": \"Maggot Lair Level 1\",\n",
+                u8"    \"enUS\": \"Maggot Lair Level 1\",\n",
+                u8"    \"zhTW\": \"蛆蟲巢穴第一層\",\n",
+                u8"    \"deDE\": \"Wurmgruft, Ebene 1\",\n",
+                u8"    \"esES\": \"Cubil de Gusanos nivel 1\",\n",
+                u8"    \"frFR\": \"Le Repaire du ver niv. 1\",\n",
+                u8"    \"itIT\": \"Covo delle Larve L1\",\n",
+                u8"    \"koKR\": \"구더기 굴 1층\",\n",
+                u8"    \"plPL\": \"Robacze Gniazdo – Poziom 1\",\n",
+                u8"    \"esMX\": \"Guarida de Gusanos Nivel 1\",\n",
+                u8"    \"jaJP\": \"地虫の巣穴: 第1階層\",\n",
+                u8"    \"ptBR\": \"Covil de Vermes Nível 1\",\n",
+                u8"    \"ruRU\": \"Логово мокриц: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"蛆虫巢穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 831,\n",
+                u8"    \"Key\": \"Claw Viper Temple Level 2\",\n",
+                u8"    \"enUS\": \"Claw Viper Temple Level 2\",\n",
+                u8"    \"zhTW\": \"利爪蛇魔神殿第二層\",\n",
+                u8"    \"deDE\": \"Tempel der Klauenvipern, Ebene 2\",\n",
+                u8"    \"esES\": \"Templo de la Garra Viperina nivel 2\",\n",
+                u8"    \"frFR\": \"Le Temple des Vipères niv. 2\",\n",
+                u8"    \"itIT\": \"Tempio delle Vipere L2\",\n",
+                u8"    \"koKR\": \"발톱 독사 사원 2층\",\n",
+                u8"    \"plPL\": \"Świątynia Żmijoszponów – Poziom 2\",\n",
+                u8"    \"esMX\": \"Templo del Vipérido de Garras Nivel 2\",\n",
+                u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院: 第2階層\",\n",
+                u8"    \"ptBR\": \"Templo da Víbora da Garra Nível 2\",\n",
+                u8"    \"ruRU\": \"Храм Когтистого Змея: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"利爪腹蛇神庙二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 832,\n",
+                u8"    \"Key\": \"Halls of the Dead Level 3\",\n",
+                u8"    \"enUS\": \"Halls of the Dead Level 3\",\n",
+                u8"    \"zhTW\": \"死亡之殿第三層\",\n",
+                u8"    \"deDE\": \"Hallen der Toten, Ebene 3\",\n",
+                u8"    \"esES\": \"Salas de la Muerte nivel 3\",\n",
+                u8"    \"frFR\": \"Les Couloirs des morts niv. 3\",\n",
+                u8"    \"itIT\": \"Sale dei Morti L3\",\n",
+                u8"    \"koKR\": \"망자의 전당 3층\",\n",
+                u8"    \"plPL\": \"Sale Umarłych – Poziom 3\",\n",
+                u8"    \"esMX\": \"Salas de la Muerte Nivel 3\",\n",
+                u8"    \"jaJP\": \"亡者の広間: 第3階層\",\n",
+                u8"    \"ptBR\": \"Salões dos Mortos Nível 3\",\n",
+                u8"    \"ruRU\": \"Чертоги Мертвых: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"亡者大殿三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 833,\n",
+                u8"    \"Key\": \"Stony Tomb Level 2\",\n",
+                u8"    \"enUS\": \"Stony Tomb Level 2\",\n",
+                u8"    \"zhTW\": \"古老石墓第二層\",\n",
+                u8"    \"deDE\": \"Steingrab, Ebene 2\",\n",
+                u8"    \"esES\": \"Tumba Pedregosa nivel 2\",\n",
+                u8"    \"frFR\": \"Le Tombeau de pierre niv. 2\",\n",
+                u8"    \"itIT\": \"Tomba di Pietra L2\",\n",
+                u8"    \"koKR\": \"바위 무덤 2층\",\n",
+                u8"    \"plPL\": \"Kamienny Grobowiec – Poziom 2\",\n",
+                u8"    \"esMX\": \"Tumba Pedregosa Nivel 2\",\n",
+                u8"    \"jaJP\": \"石造りの墓所: 第2階層\",\n",
+                u8"    \"ptBR\": \"Tumba Pétrea Nível 2\",\n",
+                u8"    \"ruRU\": \"Каменная гробница: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"碎石古墓二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 834,\n",
+                u8"    \"Key\": \"Claw Viper Temple Level 1\",\n",
+                u8"    \"enUS\": \"Claw Viper Temple Level 1\",\n",
+                u8"    \"zhTW\": \"利爪蛇魔神殿第一層\",\n",
+                u8"    \"deDE\": \"Tempel der Klauenvipern, Ebene 1\",\n",
+                u8"    \"esES\": \"Templo de la Garra Viperina nivel 1\",\n",
+                u8"    \"frFR\": \"Le Temple des Vipères niv. 1\",\n",
+                u8"    \"itIT\": \"Tempio delle Vipere L1\",\n",
+                u8"    \"koKR\": \"발톱 독사 사원 1층\",\n",
+                u8"    \"plPL\": \"Świątynia Żmijoszponów – Poziom 1\",\n",
+                u8"    \"esMX\": \"Templo del Vipérido de Garras Nivel 1\",\n",
+                u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院: 第1階層\",\n",
+                u8"    \"ptBR\": \"Templo da Víbora da Garra Nível 1\",\n",
+                u8"    \"ruRU\": \"Храм Когтистого Змея: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"利爪蝮蛇神殿一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 835,\n",
+                u8"    \"Key\": \"Halls of the Dead Level 2\",\n",
+                u8"    \"enUS\": \"Halls of the Dead Level 2\",\n",
+                u8"    \"zhTW\": \"死亡之殿第二層\",\n",
+                u8"    \"deDE\": \"Hallen der Toten, Ebene 2\",\n",
+                u8"    \"esES\": \"Salas de la Muerte nivel 2\",\n",
+                u8"    \"frFR\": \"Les Couloirs des morts niv. 2\",\n",
+                u8"    \"itIT\": \"Sale dei Morti L2\",\n",
+                u8"    \"koKR\": \"망자의 전당 2층\",\n",
+                u8"    \"plPL\": \"Sale Umarłych – Poziom 2\",\n",
+                u8"    \"esMX\": \"Salas de la Muerte Nivel 2\",\n",
+                u8"    \"jaJP\": \"亡者の広間: 第2階層\",\n",
+                u8"    \"ptBR\": \"Salões dos Mortos Nível 2\",\n",
+                u8"    \"ruRU\": \"Чертоги Мертвых: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"亡者大殿二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 836,\n",
+                u8"    \"Key\": \"Halls of the Dead Level 1\",\n",
+                u8"    \"enUS\": \"Halls of the Dead Level 1\",\n",
+                u8"    \"zhTW\": \"死亡之殿第一層\",\n",
+                u8"    \"deDE\": \"Hallen der Toten, Ebene 1\",\n",
+                u8"    \"esES\": \"Salas de la Muerte nivel 1\",\n",
+                u8"    \"frFR\": \"Les Couloirs des morts niv. 1\",\n",
+                u8"    \"itIT\": \"Sale dei Morti L1\",\n",
+                u8"    \"koKR\": \"망자의 전당 1층\",\n",
+                u8"    \"plPL\": \"Sale Umarłych – Poziom 1\",\n",
+                u8"    \"esMX\": \"Salas de la Muerte Nivel 1\",\n",
+                u8"    \"jaJP\": \"亡者の広間: 第1階層\",\n",
+                u8"    \"ptBR\": \"Salões dos Mortos Nível 1\",\n",
+                u8"    \"ruRU\": \"Чертоги Мертвых: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"亡者大殿一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 837,\n",
+                u8"    \"Key\": \"Stony Tomb Level 1\",\n",
+                u8"    \"enUS\": \"Stony Tomb Level 1\",\n",
+                u8"    \"zhTW\": \"古老石墓第一層\",\n",
+                u8"    \"deDE\": \"Steingrab, Ebene 1\",\n",
+                u8"    \"esES\": \"Tumba Pedregosa nivel 1\",\n",
+                u8"    \"frFR\": \"Le Tombeau de pierre niv. 1\",\n",
+                u8"    \"itIT\": \"Tomba di Pietra L1\",\n",
+                u8"    \"koKR\": \"바위 무덤 1층\",\n",
+                u8"    \"plPL\": \"Kamienny Grobowiec – Poziom 1\",\n",
+                u8"    \"esMX\": \"Tumba Pedregosa Nivel 1\",\n",
+                u8"    \"jaJP\": \"石造りの墓所: 第1階層\",\n",
+                u8"    \"ptBR\": \"Tumba Pétrea Nível 1\",\n",
+                u8"    \"ruRU\": \"Каменная гробница: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"碎石古墓一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 838,\n",
+                u8"    \"Key\": \"Palace Cellar Level 3\",\n",
+                u8"    \"enUS\": \"Palace Cellar Level 3\",\n",
+                u8"    \"zhTW\": \"皇宮地窖第三層\",\n",
+                u8"    \"deDE\": \"Palastkeller, Ebene 3\",\n",
+                u8"    \"esES\": \"Sótano del Palacio nivel 3\",\n",
+                u8"    \"frFR\": \"Les Caves du Palais niv. 3\",\n",
+                u8"    \"itIT\": \"Sotterranei del Palazzo L3\",\n",
+                u8"    \"koKR\": \"궁전 지하 3층\",\n",
+                u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 3\",\n",
+                u8"    \"esMX\": \"Sótano del Palacio Nivel 3\",\n",
+                u8"    \"jaJP\": \"宮殿地下室: 第3階層\",\n",
+                u8"    \"ptBR\": \"Porão do Palácio Nível 3\",\n",
+                u8"    \"ruRU\": \"Дворцовый погреб: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"王宫监牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 839,\n",
+                u8"    \"Key\": \"Palace Cellar Level 2\",\n",
+                u8"    \"enUS\": \"Palace Cellar Level 2\",\n",
+                u8"    \"zhTW\": \"皇宮地窖第二層\",\n",
+                u8"    \"deDE\": \"Palastkeller, Ebene 2\",\n",
+                u8"    \"esES\": \"Sótano del Palacio nivel 2\",\n",
+                u8"    \"frFR\": \"Les Caves du Palais niv. 2\",\n",
+                u8"    \"itIT\": \"Sotterranei del Palazzo L2\",\n",
+                u8"    \"koKR\": \"궁전 지하 2층\",\n",
+                u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 2\",\n",
+                u8"    \"esMX\": \"Sótano del Palacio Nivel 2\",\n",
+                u8"    \"jaJP\": \"宮殿地下室: 第2階層\",\n",
+                u8"    \"ptBR\": \"Porão do Palácio Nível 2\",\n",
+                u8"    \"ruRU\": \"Дворцовый погреб: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"王宫监牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 840,\n",
+                u8"    \"Key\": \"Palace Cellar Level 1\",\n",
+                u8"    \"enUS\": \"Palace Cellar Level 1\",\n",
+                u8"    \"zhTW\": \"皇宮地窖第一層\",\n",
+                u8"    \"deDE\": \"Palastkeller, Ebene 1\",\n",
+                u8"    \"esES\": \"Sótano del Palacio nivel 1\",\n",
+                u8"    \"frFR\": \"Les Caves du Palais niv. 1\",\n",
+                u8"    \"itIT\": \"Sotterranei del Palazzo L1\",\n",
+                u8"    \"koKR\": \"궁전 지하 1층\",\n",
+                u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 1\",\n",
+                u8"    \"esMX\": \"Sótano del Palacio Nivel 1\",\n",
+                u8"    \"jaJP\": \"宮殿地下室: 第1階層\",\n",
+                u8"    \"ptBR\": \"Porão do Palácio Nível 1\",\n",
+                u8"    \"ruRU\": \"Дворцовый погреб: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"王宫监牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 841,\n",
+                u8"    \"Key\": \"Harem Level 2\",\n",
+                u8"    \"enUS\": \"Harem Level 2\",\n",
+                u8"    \"zhTW\": \"後宮第二層\",\n",
+                u8"    \"deDE\": \"Harem, Ebene 2\",\n",
+                u8"    \"esES\": \"Harén nivel 2\",\n",
+                u8"    \"frFR\": \"Le Harem niv. 2\",\n",
+                u8"    \"itIT\": \"Harem L2\",\n",
+                u8"    \"koKR\": \"하렘 2층\",\n",
+                u8"    \"plPL\": \"Harem – Poziom 2\",\n",
+                u8"    \"esMX\": \"Harén Nivel 2\",\n",
+                u8"    \"jaJP\": \"ハーレム: 第2階層\",\n",
+                u8"    \"ptBR\": \"Harém Nível 2\",\n",
+                u8"    \"ruRU\": \"Гарем: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"女眷住处二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 842,\n",
+                u8"    \"Key\": \"Harem Level 1\",\n",
+                u8"    \"enUS\": \"Harem Level 1\",\n",
+                u8"    \"zhTW\": \"後宮第一層\",\n",
+                u8"    \"deDE\": \"Harem, Ebene 1\",\n",
+                u8"    \"esES\": \"Harén nivel 1\",\n",
+                u8"    \"frFR\": \"Le Harem niv. 1\",\n",
+                u8"    \"itIT\": \"Harem L1\",\n",
+                u8"    \"koKR\": \"하렘 1층\",\n",
+                u8"    \"plPL\": \"Harem – Poziom 1\",\n",
+                u8"    \"esMX\": \"Harén Nivel 1\",\n",
+                u8"    \"jaJP\": \"ハーレム: 第1階層\",\n",
+                u8"    \"ptBR\": \"Harém Nível 1\",\n",
+                u8"    \"ruRU\": \"Гарем: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"女眷住处一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 843,\n",
+                u8"    \"Key\": \"Sewers Level 3\",\n",
+                u8"    \"enUS\": \"Sewers Level 3\",\n",
+                u8"    \"zhTW\": \"下水道第三層\",\n",
+                u8"    \"deDE\": \"Kanalisation, Ebene 3\",\n",
+                u8"    \"esES\": \"Cloacas nivel 3\",\n",
+                u8"    \"frFR\": \"Les Égouts niv. 3\",\n",
+                u8"    \"itIT\": \"Fogne L3\",\n",
+                u8"    \"koKR\": \"하수도 3층\",\n",
+                u8"    \"plPL\": \"Kanały – Poziom 3\",\n",
+                u8"    \"esMX\": \"Cloacas Nivel 3\",\n",
+                u8"    \"jaJP\": \"下水道: 第3階層\",\n",
+                u8"    \"ptBR\": \"Esgoto Nível 3\",\n",
+                u8"    \"ruRU\": \"Стоки: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"下水道三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 844,\n",
+                u8"    \"Key\": \"Sewers Level 2\",\n",
+                u8"    \"enUS\": \"Sewers Level 2\",\n",
+                u8"    \"zhTW\": \"下水道第二層\",\n",
+                u8"    \"deDE\": \"Kanalisation, Ebene 2\",\n",
+                u8"    \"esES\": \"Cloacas nivel 2\",\n",
+                u8"    \"frFR\": \"Les Égouts niv. 2\",\n",
+                u8"    \"itIT\": \"Fogne L2\",\n",
+                u8"    \"koKR\": \"하수도 2층\",\n",
+                u8"    \"plPL\": \"Kanały – Poziom 2\",\n",
+                u8"    \"esMX\": \"Cloacas Nivel 2\",\n",
+                u8"    \"jaJP\": \"下水道: 第2階層\",\n",
+                u8"    \"ptBR\": \"Esgoto Nível 2\",\n",
+                u8"    \"ruRU\": \"Стоки: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"下水道二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 845,\n",
+                u8"    \"Key\": \"Sewers Level 1\",\n",
+                u8"    \"enUS\": \"Sewers Level 1\",\n",
+                u8"    \"zhTW\": \"下水道第一層\",\n",
+                u8"    \"deDE\": \"Kanalisation, Ebene 1\",\n",
+                u8"    \"esES\": \"Cloacas nivel 1\",\n",
+                u8"    \"frFR\": \"Les Égouts niv. 1\",\n",
+                u8"    \"itIT\": \"Fogne L1\",\n",
+                u8"    \"koKR\": \"하수도 1층\",\n",
+                u8"    \"plPL\": \"Kanały – Poziom 1\",\n",
+                u8"    \"esMX\": \"Cloacas Nivel 1\",\n",
+                u8"    \"jaJP\": \"下水道: 第1階層\",\n",
+                u8"    \"ptBR\": \"Esgoto Nível 1\",\n",
+                u8"    \"ruRU\": \"Стоки: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"下水道一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 846,\n",
+                u8"    \"Key\": \"Canyon of the Magi\",\n",
+                u8"    \"enUS\": \"Canyon of the Magi\",\n",
+                u8"    \"zhTW\": \"賢者之谷\",\n",
+                u8"    \"deDE\": \"Schlucht der Magier\",\n",
+                u8"    \"esES\": \"Cañón de los Magos\",\n",
+                u8"    \"frFR\": \"Le Canyon des Mages\",\n",
+                u8"    \"itIT\": \"Canyon dei Maghi\",\n",
+                u8"    \"koKR\": \"신비술사의 협곡\",\n",
+                u8"    \"plPL\": \"Kanion Magów\",\n",
+                u8"    \"esMX\": \"Cañón de los Magos\",\n",
+                u8"    \"jaJP\": \"魔術師の峡谷\",\n",
+                u8"    \"ptBR\": \"Cânion dos Magi\",\n",
+                u8"    \"ruRU\": \"Каньон волхвов\",\n",
+                u8"    \"zhCN\": \"法师峡谷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 847,\n",
+                u8"    \"Key\": \"Valley of Snakes\",\n",
+                u8"    \"enUS\": \"Valley of Snakes\",\n",
+                u8"    \"zhTW\": \"群蛇峽谷\",\n",
+                u8"    \"deDE\": \"Tal der Schlangen\",\n",
+                u8"    \"esES\": \"Valle de las Serpientes\",\n",
+                u8"    \"frFR\": \"La Vallée des serpents\",\n",
+                u8"    \"itIT\": \"Valle dei Serpenti\",\n",
+                u8"    \"koKR\": \"뱀의 골짜기\",\n",
+                u8"    \"plPL\": \"Dolina Węży\",\n",
+                u8"    \"esMX\": \"Valle de las Culebras\",\n",
+                u8"    \"jaJP\": \"蛇の谷\",\n",
+                u8"    \"ptBR\": \"Vale das Cobras\",\n",
+                u8"    \"ruRU\": \"Долина змей\",\n",
+                u8"    \"zhCN\": \"群蛇峡谷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 848,\n",
+                u8"    \"Key\": \"Lost City\",\n",
+                u8"    \"enUS\": \"Lost City\",\n",
+                u8"    \"zhTW\": \"失落古城\",\n",
+                u8"    \"deDE\": \"Vergessene Stadt\",\n",
+                u8"    \"esES\": \"Ciudad Perdida\",\n",
+                u8"    \"frFR\": \"La Ville oubliée\",\n",
+                u8"    \"itIT\": \"Città Perduta\",\n",
+                u8"    \"koKR\": \"잊힌 도시\",\n",
+                u8"    \"plPL\": \"Zaginione Miasto\",\n",
+                u8"    \"esMX\": \"Ciudad Perdida\",\n",
+                u8"    \"jaJP\": \"失われし都\",\n",
+                u8"    \"ptBR\": \"Cidade Perdida\",\n",
+                u8"    \"ruRU\": \"Затерянный город\",\n",
+                u8"    \"zhCN\": \"失落之城\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 849,\n",
+                u8"    \"Key\": \"Far Oasis\",\n",
+                u8"    \"enUS\": \"Far Oasis\",\n",
+                u8"    \"zhTW\": \"遙遠的綠洲\",\n",
+                u8"    \"deDE\": \"Ferne Oase\",\n",
+                u8"    \"esES\": \"Oasis Lejano\",\n",
+                u8"    \"frFR\": \"L’Oasis lointaine\",\n",
+                u8"    \"itIT\": \"Oasi Lontana\",\n",
+                u8"    \"koKR\": \"머나먼 오아시스\",\n",
+                u8"    \"plPL\": \"Daleka Oaza\",\n",
+                u8"    \"esMX\": \"Oasis Lejano\",\n",
+                u8"    \"jaJP\": \"遥かなるオアシス\",\n",
+                u8"    \"ptBR\": \"Oásis Longínquo\",\n",
+                u8"    \"ruRU\": \"Дальний оазис\",\n",
+                u8"    \"zhCN\": \"偏远绿洲\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 850,\n",
+                u8"    \"Key\": \"Dry Hills\",\n",
+                u8"    \"enUS\": \"Dry Hills\",\n",
+                u8"    \"zhTW\": \"乾土高地\",\n",
+                u8"    \"deDE\": \"Verdorrte Hügel\",\n",
+                u8"    \"esES\": \"Colinas Áridas\",\n",
+                u8"    \"frFR\": \"Les Collines arides\",\n",
+                u8"    \"itIT\": \"Colline Aride\",\n",
+                u8"    \"koKR\": \"메마른 언덕\",\n",
+                u8"    \"plPL\": \"Suche Wzgórza\",\n",
+                u8"    \"esMX\": \"Colinas Áridas\",\n",
+                u8"    \"jaJP\": \"乾きの丘\",\n",
+                u8"    \"ptBR\": \"Colinas Áridas\",\n",
+                u8"    \"ruRU\": \"Иссохшие холмы\",\n",
+                u8"    \"zhCN\": \"干燥高地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 851,\n",
+                u8"    \"Key\": \"Rocky Waste\",\n",
+                u8"    \"enUS\": \"Rocky Waste\",\n",
+                u8"    \"zhTW\": \"碎石荒地\",\n",
+                u8"    \"deDE\": \"Felsige Öde\",\n",
+                u8"    \"esES\": \"Erial Rocoso\",\n",
+                u8"    \"frFR\": \"Le Désert de roche\",\n",
+                u8"    \"itIT\": \"Landa Rocciosa\",\n",
+                u8"    \"koKR\": \"바위투성이 황무지\",\n",
+                u8"    \"plPL\": \"Skalne Pustkowie\",\n",
+                u8"    \"esMX\": \"Estepa Rocosa\",\n",
+                u8"    \"jaJP\": \"岩だらけの荒れ地\",\n",
+                u8"    \"ptBR\": \"Ermo Rochoso\",\n",
+                u8"    \"ruRU\": \"Каменистая пустошь\",\n",
+                u8"    \"zhCN\": \"碎石荒野\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 852,\n",
+                u8"    \"Key\": \"Lut Gholein\",\n",
+                u8"    \"enUS\": \"Lut Gholein\",\n",
+                u8"    \"zhTW\": \"魯高因\",\n",
+                u8"    \"deDE\": \"Lut Gholein\",\n",
+                u8"    \"esES\": \"Lut Gholein\",\n",
+                u8"    \"frFR\": \"Lut Gholein\",\n",
+                u8"    \"itIT\": \"Lut Gholein\",\n",
+                u8"    \"koKR\": \"루트 골레인\",\n",
+                u8"    \"plPL\": \"Lut Gholein\",\n",
+                u8"    \"esMX\": \"Lut Gholein\",\n",
+                u8"    \"jaJP\": \"ラット・ゴーレイン\",\n",
+                u8"    \"ptBR\": \"Lut Gholein\",\n",
+                u8"    \"ruRU\": \"Лут-Голейн\",\n",
+                u8"    \"zhCN\": \"鲁·高因\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 853,\n",
+                u8"    \"Key\": \"Maggot Lair\",\n",
+                u8"    \"enUS\": \"Maggot Lair\",\n",
+                u8"    \"zhTW\": \"蛆蟲巢穴\",\n",
+                u8"    \"deDE\": \"Wurmgruft\",\n",
+                u8"    \"esES\": \"Cubil de Gusanos\",\n",
+                u8"    \"frFR\": \"Le Repaire du ver\",\n",
+                u8"    \"itIT\": \"Covo delle Larve\",\n",
+                u8"    \"koKR\": \"구더기 굴\",\n",
+                u8"    \"plPL\": \"Robacze Gniazdo\",\n",
+                u8"    \"esMX\": \"Guarida de Gusanos\",\n",
+                u8"    \"jaJP\": \"地虫の巣穴\",\n",
+                u8"    \"ptBR\": \"Covil de Vermes\",\n",
+                u8"    \"ruRU\": \"Логово мокриц\",\n",
+                u8"    \"zhCN\": \"蛆虫巢穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 854,\n",
+                u8"    \"Key\": \"Claw Viper Temple\",\n",
+                u8"    \"enUS\": \"Claw Viper Temple\",\n",
+                u8"    \"zhTW\": \"利爪蛇魔神殿\",\n",
+                u8"    \"deDE\": \"Tempel der Klauenvipern\",\n",
+                u8"    \"esES\": \"Templo de la Garra Viperina\",\n",
+                u8"    \"frFR\": \"Le Temple des Vipères\",\n",
+                u8"    \"itIT\": \"Tempio delle Vipere\",\n",
+                u8"    \"koKR\": \"발톱 독사 사원\",\n",
+                u8"    \"plPL\": \"Świątynia Żmijoszponów\",\n",
+                u8"    \"esMX\": \"Templo del Vipérido de Garras\",\n",
+                u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院\",\n",
+                u8"    \"ptBR\": \"Templo da Víbora da Garra\",\n",
+                u8"    \"ruRU\": \"Храм Когтистого Змея\",\n",
+                u8"    \"zhCN\": \"利爪蝮蛇神殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 855,\n",
+                u8"    \"Key\": \"Halls of the Dead\",\n",
+                u8"    \"enUS\": \"Halls of the Dead\",\n",
+                u8"    \"zhTW\": \"死亡之殿\",\n",
+                u8"    \"deDE\": \"Hallen der Toten\",\n",
+                u8"    \"esES\": \"Salas de la Muerte\",\n",
+                u8"    \"frFR\": \"Les Couloirs des morts\",\n",
+                u8"    \"itIT\": \"Sale dei Morti\",\n",
+                u8"    \"koKR\": \"망자의 전당\",\n",
+                u8"    \"plPL\": \"Sale Umarłych\",\n",
+                u8"    \"esMX\": \"Salas de la Muerte\",\n",
+                u8"    \"jaJP\": \"亡者の広間\",\n",
+                u8"    \"ptBR\": \"Salões dos Mortos\",\n",
+                u8"    \"ruRU\": \"Чертоги мертвых\",\n",
+                u8"    \"zhCN\": \"亡者大殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 856,\n",
+                u8"    \"Key\": \"Stony Tomb\",\n",
+                u8"    \"enUS\": \"Stony Tomb\",\n",
+                u8"    \"zhTW\": \"古老石墓\",\n",
+                u8"    \"deDE\": \"Steingrab\",\n",
+                u8"    \"esES\": \"Tumba Pedregosa\",\n",
+                u8"    \"frFR\": \"Le Tombeau de pierre\",\n",
+                u8"    \"itIT\": \"Tomba di Pietra\",\n",
+                u8"    \"koKR\": \"바위 무덤\",\n",
+                u8"    \"plPL\": \"Kamienny Grobowiec\",\n",
+                u8"    \"esMX\": \"Tumba Pedregosa\",\n",
+                u8"    \"jaJP\": \"石造りの墓所\",\n",
+                u8"    \"ptBR\": \"Tumba Pétrea\",\n",
+                u8"    \"ruRU\": \"Каменная гробница\",\n",
+                u8"    \"zhCN\": \"碎石古墓\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 857,\n",
+                u8"    \"Key\": \"Palace Cellar\",\n",
+                u8"    \"enUS\": \"Palace Cellar\",\n",
+                u8"    \"zhTW\": \"皇宮地窖\",\n",
+                u8"    \"deDE\": \"Palastkeller\",\n",
+                u8"    \"esES\": \"Sótano del Palacio\",\n",
+                u8"    \"frFR\": \"Les Caves du Palais\",\n",
+                u8"    \"itIT\": \"Sotterranei del Palazzo\",\n",
+                u8"    \"koKR\": \"궁전 지하\",\n",
+                u8"    \"plPL\": \"Pałacowe Piwnice\",\n",
+                u8"    \"esMX\": \"Sótano del Palacio\",\n",
+                u8"    \"jaJP\": \"宮殿地下室\",\n",
+                u8"    \"ptBR\": \"Porão do Palácio\",\n",
+                u8"    \"ruRU\": \"Дворцовый погреб\",\n",
+                u8"    \"zhCN\": \"王宫监牢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 858,\n",
+                u8"    \"Key\": \"Harem\",\n",
+                u8"    \"enUS\": \"Harem\",\n",
+                u8"    \"zhTW\": \"後宮\",\n",
+                u8"    \"deDE\": \"Harem\",\n",
+                u8"    \"esES\": \"Harén\",\n",
+                u8"    \"frFR\": \"Le Harem\",\n",
+                u8"    \"itIT\": \"Harem\",\n",
+                u8"    \"koKR\": \"하렘\",\n",
+                u8"    \"plPL\": \"Harem\",\n",
+                u8"    \"esMX\": \"Harén\",\n",
+                u8"    \"jaJP\": \"ハーレム\",\n",
+                u8"    \"ptBR\": \"Harém\",\n",
+                u8"    \"ruRU\": \"Гарем\",\n",
+                u8"    \"zhCN\": \"女眷住处\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 859,\n",
+                u8"    \"Key\": \"Sewers\",\n",
+                u8"    \"enUS\": \"Sewers\",\n",
+                u8"    \"zhTW\": \"下水道\",\n",
+                u8"    \"deDE\": \"Kanalisation\",\n",
+                u8"    \"esES\": \"Cloacas\",\n",
+                u8"    \"frFR\": \"Les Égouts\",\n",
+                u8"    \"itIT\": \"Fogne\",\n",
+                u8"    \"koKR\": \"하수도\",\n",
+                u8"    \"plPL\": \"Kanały\",\n",
+                u8"    \"esMX\": \"Cloacas\",\n",
+                u8"    \"jaJP\": \"下水道\",\n",
+                u8"    \"ptBR\": \"Esgoto\",\n",
+                u8"    \"ruRU\": \"Стоки\",\n",
+                u8"    \"zhCN\": \"下水道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 860,\n",
+                u8"    \"Key\": \"To The Moo Moo Farm\",\n",
+                u8"    \"enUS\": \"To The Secret Cow Level\",\n",
+                u8"    \"zhTW\": \"前往秘密乳牛關\",\n",
+                u8"    \"deDE\": \"Zum Geheimen Kuhlevel\",\n",
+                u8"    \"esES\": \"Al Nivel Secreto de las Vacas\",\n",
+                u8"    \"frFR\": \"Vers le niveau secret des vaches\",\n",
+                u8"    \"itIT\": \"Per il Livello Bovino Segreto\",\n",
+                u8"    \"koKR\": \"비밀의 젖소방으로 이동\",\n",
+                u8"    \"plPL\": \"Sekretny krowi poziom\",\n",
+                u8"    \"esMX\": \"Al Nivel Secreto de la Vaca\",\n",
+                u8"    \"jaJP\": \"秘密のモーモー牧場へ\",\n",
+                u8"    \"ptBR\": \"Para o Nível Secreto da Vaca\",\n",
+                u8"    \"ruRU\": \"На секретный коровий уровень\",\n",
+                u8"    \"zhCN\": \"前往神秘的奶牛关\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 861,\n",
+                u8"    \"Key\": \"To Chaos Sanctum\",\n",
+                u8"    \"enUS\": \"To The Chaos Sanctuary\",\n",
+                u8"    \"zhTW\": \"前往混沌魔殿\",\n",
+                u8"    \"deDE\": \"Zum Chaossanktuarium\",\n",
+                u8"    \"esES\": \"Al Santuario del Caos\",\n",
+                u8"    \"frFR\": \"Vers le Sanctuaire du chaos\",\n",
+                u8"    \"itIT\": \"Per il Santuario del Caos\",\n",
+                u8"    \"koKR\": \"혼돈의 성역으로 이동\",\n",
+                u8"    \"plPL\": \"Sanktuarium Chaosu\",\n",
+                u8"    \"esMX\": \"Al Santuario del Caos\",\n",
+                u8"    \"jaJP\": \"混沌の聖域へ\",\n",
+                u8"    \"ptBR\": \"Para o Santuário do Caos\",\n",
+                u8"    \"ruRU\": \"В Святилище Хаоса\",\n",
+                u8"    \"zhCN\": \"前往混沌避难所\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 862,\n",
+                u8"    \"Key\": \"To The River of Flame\",\n",
+                u8"    \"enUS\": \"To The River of Flame\",\n",
+                u8"    \"zhTW\": \"前往火焰之河\",\n",
+                u8"    \"deDE\": \"Zum Flammenfluss\",\n",
+                u8"    \"esES\": \"Al Río de Llamas\",\n",
+                u8"    \"frFR\": \"Vers la Rivière de feu\",\n",
+                u8"    \"itIT\": \"Per il Fiume Infuocato\",\n",
+                u8"    \"koKR\": \"불길의 강으로 이동\",\n",
+                u8"    \"plPL\": \"Rzeka Płomieni\",\n",
+                u8"    \"esMX\": \"Al Río de Fuego\",\n",
+                u8"    \"jaJP\": \"炎の河へ\",\n",
+                u8"    \"ptBR\": \"Para o Rio de Chamas\",\n",
+                u8"    \"ruRU\": \"К Огненной реке\",\n",
+                u8"    \"zhCN\": \"前往火焰之河\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 863,\n",
+                u8"    \"Key\": \"To The Outer Steppes\",\n",
+                u8"    \"enUS\": \"To The Outer Steppes\",\n",
+                u8"    \"zhTW\": \"前往外圍荒原\",\n",
+                u8"    \"deDE\": \"Zur äußeren Steppe\",\n",
+                u8"    \"esES\": \"A las Estepas Exteriores\",\n",
+                u8"    \"frFR\": \"Vers les Steppes infinies\",\n",
+                u8"    \"itIT\": \"Per le Steppe Esterne\",\n",
+                u8"    \"koKR\": \"평원 외곽으로 이동\",\n",
+                u8"    \"plPL\": \"Zewnętrzne Stepy\",\n",
+                u8"    \"esMX\": \"A la Estepa Exterior\",\n",
+                u8"    \"jaJP\": \"果ての草原へ\",\n",
+                u8"    \"ptBR\": \"Para as Estepes Externas\",\n",
+                u8"    \"ruRU\": \"В Рубежные Степи\",\n",
+                u8"    \"zhCN\": \"前往外域荒原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 864,\n",
+                u8"    \"Key\": \"To The Plains of Despair\",\n",
+                u8"    \"enUS\": \"To The Plains of Despair\",\n",
+                u8"    \"zhTW\": \"前往絕望平原\",\n",
+                u8"    \"deDE\": \"Zur Ebene der Verzweiflung\",\n",
+                u8"    \"esES\": \"A las Llanuras del Desaliento\",\n",
+                u8"    \"frFR\": \"Vers les Plaines du désespoir\",\n",
+                u8"    \"itIT\": \"Per le Pianure della Disperazione\",\n",
+                u8"    \"koKR\": \"절망의 평원으로 이동\",\n",
+                u8"    \"plPL\": \"Równina Rozpaczy\",\n",
+                u8"    \"esMX\": \"A la Llanura del Desespero\",\n",
+                u8"    \"jaJP\": \"絶望の平原へ\",\n",
+                u8"    \"ptBR\": \"Para a Planície do Desespero\",\n",
+                u8"    \"ruRU\": \"В долину Отчаяния\",\n",
+                u8"    \"zhCN\": \"前往绝望平原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 865,\n",
+                u8"    \"Key\": \"To The City of the Damned\",\n",
+                u8"    \"enUS\": \"To The City of the Damned\",\n",
+                u8"    \"zhTW\": \"前往罪罰之城\",\n",
+                u8"    \"deDE\": \"Zur Stadt der Verdammten\",\n",
+                u8"    \"esES\": \"A la Ciudad de los Malditos\",\n",
+                u8"    \"frFR\": \"Vers la Ville des damnés\",\n",
+                u8"    \"itIT\": \"Per la Città Dannata\",\n",
+                u8"    \"koKR\": \"저주받은 자들의 도시로 이동\",\n",
+                u8"    \"plPL\": \"Miasto Potępionych\",\n",
+                u8"    \"esMX\": \"A la Ciudad de los Condenados\",\n",
+                u8"    \"jaJP\": \"呪われし街へ\",\n",
+                u8"    \"ptBR\": \"Para a Cidade dos Condenados\",\n",
+                u8"    \"ruRU\": \"В Город Проклятых\",\n",
+                u8"    \"zhCN\": \"前往神罚之城\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 866,\n",
+                u8"    \"Key\": \"To The Pandemonium Fortress\",\n",
+                u8"    \"enUS\": \"To The Pandemonium Fortress\",\n",
+                u8"    \"zhTW\": \"前往混沌界要塞\",\n",
+                u8"    \"deDE\": \"Zur Festung des Wahnsinns\",\n",
+                u8"    \"esES\": \"A la Fortaleza del Pandemónium\",\n",
+                u8"    \"frFR\": \"Vers la Forteresse de Pandémonium\",\n",
+                u8"    \"itIT\": \"Per la Fortezza del Pandemonio\",\n",
+                u8"    \"koKR\": \"혼돈의 요새로 이동\",\n",
+                u8"    \"plPL\": \"Forteca Pandemonium\",\n",
+                u8"    \"esMX\": \"A la Fortaleza del Pandemonio\",\n",
+                u8"    \"jaJP\": \"伏魔殿の砦へ\",\n",
+                u8"    \"ptBR\": \"Para a Fortaleza Pandemônio\",\n",
+                u8"    \"ruRU\": \"В крепость Пандемония\",\n",
+                u8"    \"zhCN\": \"前往混沌要塞\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 867,\n",
+                u8"    \"Key\": \"To The Durance of Hate Level 3\",\n",
+                u8"    \"enUS\": \"To The Durance of Hate Level 3\",\n",
+                u8"    \"zhTW\": \"前往憎恨囚牢第三層\",\n",
+                u8"    \"deDE\": \"Zum Kerker des Hasses, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 de la Represión del Odio\",\n",
+                u8"    \"frFR\": \"Vers la Prison de la Haine niv. 3\",\n",
+                u8"    \"itIT\": \"Per la Prigione dell'Odio L3\",\n",
+                u8"    \"koKR\": \"증오의 억류지 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 3\",\n",
+                u8"    \"esMX\": \"A la Prisión de Odio Nivel 3\",\n",
+                u8"    \"jaJP\": \"憎悪の檻: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Cárcere do Ódio Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень Узилища Ненависти\",\n",
+                u8"    \"zhCN\": \"前往憎恨囚牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 868,\n",
+                u8"    \"Key\": \"To The Durance of Hate Level 2\",\n",
+                u8"    \"enUS\": \"To The Durance of Hate Level 2\",\n",
+                u8"    \"zhTW\": \"前往憎恨囚牢第二層\",\n",
+                u8"    \"deDE\": \"Zum Kerker des Hasses, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 de la Represión del Odio\",\n",
+                u8"    \"frFR\": \"Vers la Prison de la Haine niv. 2\",\n",
+                u8"    \"itIT\": \"Per la Prigione dell'Odio L2\",\n",
+                u8"    \"koKR\": \"증오의 억류지 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 2\",\n",
+                u8"    \"esMX\": \"A la Prisión de Odio Nivel 2\",\n",
+                u8"    \"jaJP\": \"憎悪の檻: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Cárcere do Ódio Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень Узилища Ненависти\",\n",
+                u8"    \"zhCN\": \"前往憎恨囚牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 869,\n",
+                u8"    \"Key\": \"To The Durance of Hate Level 1\",\n",
+                u8"    \"enUS\": \"To The Durance of Hate Level 1\",\n",
+                u8"    \"zhTW\": \"前往憎恨囚牢第一層\",\n",
+                u8"    \"deDE\": \"Zum Kerker des Hasses, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 de la Represión del Odio\",\n",
+                u8"    \"frFR\": \"Vers la Prison de la Haine niv. 1\",\n",
+                u8"    \"itIT\": \"Per la Prigione dell'Odio L1\",\n",
+                u8"    \"koKR\": \"증오의 억류지 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Kazamaty Nienawiści – Poziom 1\",\n",
+                u8"    \"esMX\": \"A la Prisión de Odio Nivel 1\",\n",
+                u8"    \"jaJP\": \"憎悪の檻: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Cárcere do Ódio Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень Узилища Ненависти\",\n",
+                u8"    \"zhCN\": \"前往憎恨囚牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 870,\n",
+                u8"    \"Key\": \"To The Disused Reliquary\",\n",
+                u8"    \"enUS\": \"To The Disused Reliquary\",\n",
+                u8"    \"zhTW\": \"前往廢棄的聖殿\",\n",
+                u8"    \"deDE\": \"Zum verlassenen Reliquienschrein\",\n",
+                u8"    \"esES\": \"Al Relicario Abandonado\",\n",
+                u8"    \"frFR\": \"Vers le Reliquaire abandonné\",\n",
+                u8"    \"itIT\": \"Per il Reliquiario Abbandonato\",\n",
+                u8"    \"koKR\": \"버려진 성물실로 이동\",\n",
+                u8"    \"plPL\": \"Opuszczony Relikwiarz\",\n",
+                u8"    \"esMX\": \"Al Relicario Abandonado\",\n",
+                u8"    \"jaJP\": \"打ち捨てられし聖廟へ\",\n",
+                u8"    \"ptBR\": \"Para o Relicário Abandonado\",\n",
+                u8"    \"ruRU\": \"В заброшенный реликварий\",\n",
+                u8"    \"zhCN\": \"前往废弃的藏骨室\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 871,\n",
+                u8"    \"Key\": \"To The Ruined Fane\",\n",
+                u8"    \"enUS\": \"To The Ruined Fane\",\n",
+                u8"    \"zhTW\": \"前往荒廢的寺院\",\n",
+                u8"    \"deDE\": \"Zum zerfallenen Heiligtum\",\n",
+                u8"    \"esES\": \"Al Fano en Ruinas\",\n",
+                u8"    \"frFR\": \"Vers le Sanctuaire en ruine\",\n",
+                u8"    \"itIT\": \"Per il Tempio Antico\",\n",
+                u8"    \"koKR\": \"허물어진 교회당으로 이동\",\n",
+                u8"    \"plPL\": \"Zrujnowana Kaplica\",\n",
+                u8"    \"esMX\": \"Al Santuario Destruido\",\n",
+                u8"    \"jaJP\": \"荒れ果てた神殿へ\",\n",
+                u8"    \"ptBR\": \"Para o Ádito Arruinado\",\n",
+                u8"    \"ruRU\": \"В разрушенную церковь\",\n",
+                u8"    \"zhCN\": \"前往被毁的礼拜堂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 872,\n",
+                u8"    \"Key\": \"To The Forgotten Temple\",\n",
+                u8"    \"enUS\": \"To The Forgotten Temple\",\n",
+                u8"    \"zhTW\": \"前往遺忘神殿\",\n",
+                u8"    \"deDE\": \"Zum vergessenen Tempel\",\n",
+                u8"    \"esES\": \"Al Templo Olvidado\",\n",
+                u8"    \"frFR\": \"Vers le Temple oublié\",\n",
+                u8"    \"itIT\": \"Per il Tempio Dimenticato\",\n",
+                u8"    \"koKR\": \"잊힌 사원으로 이동\",\n",
+                u8"    \"plPL\": \"Zapomniana Świątynia\",\n",
+                u8"    \"esMX\": \"Al Templo Olvidado\",\n",
+                u8"    \"jaJP\": \"忘れ去られし寺院へ\",\n",
+                u8"    \"ptBR\": \"Para o Templo Esquecido\",\n",
+                u8"    \"ruRU\": \"В забытый храм\",\n",
+                u8"    \"zhCN\": \"前往被遗忘的神殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 873,\n",
+                u8"    \"Key\": \"To The Forgotten Reliquary\",\n",
+                u8"    \"enUS\": \"To The Forgotten Reliquary\",\n",
+                u8"    \"zhTW\": \"前往遺忘的聖殿\",\n",
+                u8"    \"deDE\": \"Zum vergessenen Reliquienschrein\",\n",
+                u8"    \"esES\": \"Al Relicario Olvidado\",\n",
+                u8"    \"frFR\": \"Vers le Reliquaire oublié\",\n",
+                u8"    \"itIT\": \"Per il Reliquiario Dimenticato\",\n",
+                u8"    \"koKR\": \"잊힌 성물실로 이동\",\n",
+                u8"    \"plPL\": \"Zapomniany Relikwiarz\",\n",
+                u8"    \"esMX\": \"Al Relicario Olvidado\",\n",
+                u8"    \"jaJP\": \"忘れ去られし聖廟へ\",\n",
+                u8"    \"ptBR\": \"Para o Relicário Esquecido\",\n",
+                u8"    \"ruRU\": \"В забытый реликварий\",\n",
+                u8"    \"zhCN\": \"前往被遗忘的藏骨室\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 874,\n",
+                u8"    \"Key\": \"To The Disused Fane\",\n",
+                u8"    \"enUS\": \"To The Disused Fane\",\n",
+                u8"    \"zhTW\": \"前往廢棄的寺院\",\n",
+                u8"    \"deDE\": \"Zum verlassenen Heiligtum\",\n",
+                u8"    \"esES\": \"Al Fano Abandonado\",\n",
+                u8"    \"frFR\": \"Vers le Sanctuaire abandonné\",\n",
+                u8"    \"itIT\": \"Per il Tempio Abbandonato\",\n",
+                u8"    \"koKR\": \"버려진 교회당으로 이동\",\n",
+                u8"    \"plPL\": \"Opuszczona Kaplica\",\n",
+                u8"    \"esMX\": \"Al Santuario Abandonado\",\n",
+                u8"    \"jaJP\": \"打ち捨てられし神殿へ\",\n",
+                u8"    \"ptBR\": \"Para o Ádito Abandonado\",\n",
+                u8"    \"ruRU\": \"В заброшенную церковь\",\n",
+                u8"    \"zhCN\": \"前往废弃的礼拜堂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 875,\n",
+                u8"    \"Key\": \"To The Ruined Temple\",\n",
+                u8"    \"enUS\": \"To The Ruined Temple\",\n",
+                u8"    \"zhTW\": \"前往荒廢的神殿\",\n",
+                u8"    \"deDE\": \"Zum zerfallenen Tempel\",\n",
+                u8"    \"esES\": \"Al Templo en Ruinas\",\n",
+                u8"    \"frFR\": \"Vers le Temple en ruine\",\n",
+                u8"    \"itIT\": \"Per il Tempio in Rovina\",\n",
+                u8"    \"koKR\": \"허물어진 사원으로 이동\",\n",
+                u8"    \"plPL\": \"Zrujnowana Świątynia\",\n",
+                u8"    \"esMX\": \"Al Templo Destruido\",\n",
+                u8"    \"jaJP\": \"荒れ果てた寺院へ\",\n",
+                u8"    \"ptBR\": \"Para o Templo Arruinado\",\n",
+                u8"    \"ruRU\": \"В разрушенный храм\",\n",
+                u8"    \"zhCN\": \"前往毁灭的神庙\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 876,\n",
+                u8"    \"Key\": \"To The Flayer Dungeon Level 1\",\n",
+                u8"    \"enUS\": \"To The Flayer Dungeon Level 1\",\n",
+                u8"    \"zhTW\": \"前往剝皮地牢第一層\",\n",
+                u8"    \"deDE\": \"Zum Schinderdungeon, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 de la Mazmorra de Desollamiento\",\n",
+                u8"    \"frFR\": \"Vers la Prison de l’Écorcheur niv. 1\",\n",
+                u8"    \"itIT\": \"Per il Sotterraneo Scorticatore L1\",\n",
+                u8"    \"koKR\": \"약탈자 소굴 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 1\",\n",
+                u8"    \"esMX\": \"Al Calabozo de los Desolladores Nivel 1\",\n",
+                u8"    \"jaJP\": \"フレイヤーの地下牢: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Masmorra dos Esfoladores Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень Подземелья свежевателей\",\n",
+                u8"    \"zhCN\": \"前往剥皮魔监牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 877,\n",
+                u8"    \"Key\": \"To The Flayer Dungeon Level 2\",\n",
+                u8"    \"enUS\": \"To The Flayer Dungeon Level 2\",\n",
+                u8"    \"zhTW\": \"前往剝皮地牢第二層\",\n",
+                u8"    \"deDE\": \"Zum Schinderdungeon, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 de la Mazmorra de Desollamiento\",\n",
+                u8"    \"frFR\": \"Vers la Prison de l’Écorcheur niv. 2\",\n",
+                u8"    \"itIT\": \"Per il Sotterraneo Scorticatore L2\",\n",
+                u8"    \"koKR\": \"약탈자 소굴 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 2\",\n",
+                u8"    \"esMX\": \"Al Calabozo de los Desolladores Nivel 2\",\n",
+                u8"    \"jaJP\": \"フレイヤーの地下牢: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Masmorra dos Esfoladores Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень Подземелья свежевателей\",\n",
+                u8"    \"zhCN\": \"前往剥皮魔监牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 878,\n",
+                u8"    \"Key\": \"To The Flayer Dungeon Level 3\",\n",
+                u8"    \"enUS\": \"To The Flayer Dungeon Level 3\",\n",
+                u8"    \"zhTW\": \"前往剝皮地牢第三層\",\n",
+                u8"    \"deDE\": \"Zum Schinderdungeon, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 de la Mazmorra de Desollamiento\",\n",
+                u8"    \"frFR\": \"Ver la Prison de l’Écorcheur niv. 3\",\n",
+                u8"    \"itIT\": \"Per il Sotterraneo Scorticatore L3\",\n",
+                u8"    \"koKR\": \"약탈자 소굴 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Podziemia Łupieżców – Poziom 3\",\n",
+                u8"    \"esMX\": \"Al Calabozo de los Desolladores Nivel 3\",\n",
+                u8"    \"jaJP\": \"フレイヤーの地下牢: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Masmorra dos Esfoladores Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень Подземелья свежевателей\",\n",
+                u8"    \"zhCN\": \"前往剥皮魔监牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 879,\n",
+                u8"    \"Key\": \"To The Swampy Pit Level 3\",\n",
+                u8"    \"enUS\": \"To The Swampy Pit Level 3\",\n",
+                u8"    \"zhTW\": \"前往沼澤地穴第三層\",\n",
+                u8"    \"deDE\": \"Zum Sumpfloch, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 del Foso Pantanoso\",\n",
+                u8"    \"frFR\": \"Vers le Bourbier niv. 3\",\n",
+                u8"    \"itIT\": \"Per l'Abisso Paludoso L3\",\n",
+                u8"    \"koKR\": \"습한 구덩이 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Bagienna Czeluść – Poziom 3\",\n",
+                u8"    \"esMX\": \"Al Foso Pantanoso Nivel 3\",\n",
+                u8"    \"jaJP\": \"沼地の穴ぐら: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Fosso Pantanoso Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень Глубокой трясины\",\n",
+                u8"    \"zhCN\": \"前往沼泽陷坑三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 880,\n",
+                u8"    \"Key\": \"To The Swampy Pit Level 2\",\n",
+                u8"    \"enUS\": \"To The Swampy Pit Level 2\",\n",
+                u8"    \"zhTW\": \"前往沼澤地穴第二層\",\n",
+                u8"    \"deDE\": \"Zum Sumpfloch, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 del Foso Pantanoso\",\n",
+                u8"    \"frFR\": \"Vers le Bourbier niv. 2\",\n",
+                u8"    \"itIT\": \"Per l'Abisso Paludoso L2\",\n",
+                u8"    \"koKR\": \"습한 구덩이 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Bagienna Czeluść – Poziom 2\",\n",
+                u8"    \"esMX\": \"Al Foso Pantanoso Nivel 2\",\n",
+                u8"    \"jaJP\": \"沼地の穴ぐら: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Fosso Pantanoso Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень Глубокой трясины\",\n",
+                u8"    \"zhCN\": \"前往沼泽陷坑二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 881,\n",
+                u8"    \"Key\": \"To The Swampy Pit Level 1\",\n",
+                u8"    \"enUS\": \"To The Swampy Pit Level 1\",\n",
+                u8"    \"zhTW\": \"前往沼澤地穴第一層\",\n",
+                u8"    \"deDE\": \"Zum Sumpfloch, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 del Foso Pantanoso\",\n",
+                u8"    \"frFR\": \"Vers le Bourbier niv. 1\",\n",
+                u8"    \"itIT\": \"Per l'Abisso Paludoso L1\",\n",
+                u8"    \"koKR\": \"습한 구덩이 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Bagienna Czeluść – Poziom 1\",\n",
+                u8"    \"esMX\": \"Al Foso Pantanoso Nivel 1\",\n",
+                u8"    \"jaJP\": \"沼地の穴ぐら: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Fosso Pantanoso Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень Глубокой трясины\",\n",
+                u8"    \"zhCN\": \"前往沼泽陷坑一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 882,\n",
+                u8"    \"Key\": \"To The Spider Cave\",\n",
+                u8"    \"enUS\": \"To The Arachnid Lair\",\n",
+                u8"    \"zhTW\": \"前往蜘蛛巢穴\",\n",
+                u8"    \"deDE\": \"Zur Spinnenmonstergruft\",\n",
+                u8"    \"esES\": \"Al Cubil Arácnido\",\n",
+                u8"    \"frFR\": \"Vers le Repaire de l’Arachnide\",\n",
+                u8"    \"itIT\": \"Per il Covo degli Aracnidi\",\n",
+                u8"    \"koKR\": \"독거미 둥지로 이동\",\n",
+                u8"    \"plPL\": \"Legowisko Arachnidów\",\n",
+                u8"    \"esMX\": \"A la Guarida Arácnida\",\n",
+                u8"    \"jaJP\": \"蜘蛛の巣穴へ\",\n",
+                u8"    \"ptBR\": \"Para o Covil Aracnídeo\",\n",
+                u8"    \"ruRU\": \"В логово арахнидов\",\n",
+                u8"    \"zhCN\": \"前往巨蛛巢穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 883,\n",
+                u8"    \"Key\": \"To The Spider Cavern\",\n",
+                u8"    \"enUS\": \"To The Spider Cavern\",\n",
+                u8"    \"zhTW\": \"前往蜘蛛洞窟\",\n",
+                u8"    \"deDE\": \"Zur Spinnenhöhle\",\n",
+                u8"    \"esES\": \"A la Caverna de Arañas\",\n",
+                u8"    \"frFR\": \"Vers la Caverne de l’Araignée\",\n",
+                u8"    \"itIT\": \"Per la Caverna del Ragno\",\n",
+                u8"    \"koKR\": \"거미 동굴로 이동\",\n",
+                u8"    \"plPL\": \"Grota Pająków\",\n",
+                u8"    \"esMX\": \"A la Caverna de Arañas\",\n",
+                u8"    \"jaJP\": \"蜘蛛の洞窟へ\",\n",
+                u8"    \"ptBR\": \"Para a Caverna Aracnídea\",\n",
+                u8"    \"ruRU\": \"В Паучью пещеру\",\n",
+                u8"    \"zhCN\": \"前往蜘蛛洞穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 884,\n",
+                u8"    \"Key\": \"To Travincal\",\n",
+                u8"    \"enUS\": \"To Travincal\",\n",
+                u8"    \"zhTW\": \"前往崔凡克\",\n",
+                u8"    \"deDE\": \"Nach Travincal\",\n",
+                u8"    \"esES\": \"A Travincal\",\n",
+                u8"    \"frFR\": \"Vers Travincal\",\n",
+                u8"    \"itIT\": \"Per Travincal\",\n",
+                u8"    \"koKR\": \"트라빈칼로 이동\",\n",
+                u8"    \"plPL\": \"Travincal\",\n",
+                u8"    \"esMX\": \"A Travincal\",\n",
+                u8"    \"jaJP\": \"トラヴィンカルへ\",\n",
+                u8"    \"ptBR\": \"Para Travincal\",\n",
+                u8"    \"ruRU\": \"В Травинкаль\",\n",
+                u8"    \"zhCN\": \"前往崔凡克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 885,\n",
+                u8"    \"Key\": \"To The Kurast Causeway\",\n",
+                u8"    \"enUS\": \"To The Kurast Causeway\",\n",
+                u8"    \"zhTW\": \"前往庫拉斯特堤道\",\n",
+                u8"    \"deDE\": \"Zum Damm von Kurast\",\n",
+                u8"    \"esES\": \"A la Calzada de Kurast\",\n",
+                u8"    \"frFR\": \"Vers la Chaussée de Kurast\",\n",
+                u8"    \"itIT\": \"Per la Strada di Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 둑길로 이동\",\n",
+                u8"    \"plPL\": \"Grobla Kurast\",\n",
+                u8"    \"esMX\": \"A la Calzada de Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト舗道へ\",\n",
+                u8"    \"ptBR\": \"Para a Passagem de Kurast\",\n",
+                u8"    \"ruRU\": \"На Курастскую дамбу\",\n",
+                u8"    \"zhCN\": \"前往库拉斯特堤道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 886,\n",
+                u8"    \"Key\": \"To Upper Kurast\",\n",
+                u8"    \"enUS\": \"To Upper Kurast\",\n",
+                u8"    \"zhTW\": \"前往庫拉斯特上層\",\n",
+                u8"    \"deDE\": \"Nach Oberkurast\",\n",
+                u8"    \"esES\": \"A la Parte Alta de Kurast\",\n",
+                u8"    \"frFR\": \"Vers Kurast - La ville haute\",\n",
+                u8"    \"itIT\": \"Per Kurast Superiore\",\n",
+                u8"    \"koKR\": \"상부 쿠라스트로 이동\",\n",
+                u8"    \"plPL\": \"Górne Kurast\",\n",
+                u8"    \"esMX\": \"A Alta Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト上層へ\",\n",
+                u8"    \"ptBR\": \"Para Kurast Superior\",\n",
+                u8"    \"ruRU\": \"В Верхний Кураст\",\n",
+                u8"    \"zhCN\": \"前往库拉斯特上层区\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 887,\n",
+                u8"    \"Key\": \"To The Kurast Bazaar\",\n",
+                u8"    \"enUS\": \"To The Kurast Bazaar\",\n",
+                u8"    \"zhTW\": \"前往庫拉斯特市集\",\n",
+                u8"    \"deDE\": \"Zum Basar von Kurast\",\n",
+                u8"    \"esES\": \"Al Bazar de Kurast\",\n",
+                u8"    \"frFR\": \"Vers le Bazar de Kurast\",\n",
+                u8"    \"itIT\": \"Per il Bazar di Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 시장으로 이동\",\n",
+                u8"    \"plPL\": \"Bazar Kurast\",\n",
+                u8"    \"esMX\": \"Al Bazar de Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト・バザールへ\",\n",
+                u8"    \"ptBR\": \"Para o Bazar de Kurast\",\n",
+                u8"    \"ruRU\": \"На Курастский базар\",\n",
+                u8"    \"zhCN\": \"前往库拉斯特集市\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 888,\n",
+                u8"    \"Key\": \"To Lower Kurast\",\n",
+                u8"    \"enUS\": \"To Lower Kurast\",\n",
+                u8"    \"zhTW\": \"前往庫拉斯特下層\",\n",
+                u8"    \"deDE\": \"Nach Unterkurast\",\n",
+                u8"    \"esES\": \"A la Parte Baja de Kurast\",\n",
+                u8"    \"frFR\": \"Vers Kurast - La ville basse\",\n",
+                u8"    \"itIT\": \"Per Kurast Inferiore\",\n",
+                u8"    \"koKR\": \"하부 쿠라스트로 이동\",\n",
+                u8"    \"plPL\": \"Dolne Kurast\",\n",
+                u8"    \"esMX\": \"A Baja Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト下層へ\",\n",
+                u8"    \"ptBR\": \"Para Kurast Inferior\",\n",
+                u8"    \"ruRU\": \"В Нижний Кураст\",\n",
+                u8"    \"zhCN\": \"前往库拉斯特下层区\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 889,\n",
+                u8"    \"Key\": \"To The Flayer Jungle\",\n",
+                u8"    \"enUS\": \"To The Flayer Jungle\",\n",
+                u8"    \"zhTW\": \"前往剝皮叢林\",\n",
+                u8"    \"deDE\": \"Zum Schinderdschungel\",\n",
+                u8"    \"esES\": \"A la Selva Desolladora\",\n",
+                u8"    \"frFR\": \"Vers la Jungle de l’Écorcheur\",\n",
+                u8"    \"itIT\": \"Per la Giungla Scorticatrice\",\n",
+                u8"    \"koKR\": \"약탈자 밀림으로 이동\",\n",
+                u8"    \"plPL\": \"Dżungla Łupieżców\",\n",
+                u8"    \"esMX\": \"A la Jungla de los Desolladores\",\n",
+                u8"    \"jaJP\": \"フレイヤーの密林へ\",\n",
+                u8"    \"ptBR\": \"Para a Selva dos Esfoladores\",\n",
+                u8"    \"ruRU\": \"В Джунгли свежевателей\",\n",
+                u8"    \"zhCN\": \"前往剥皮魔丛林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 890,\n",
+                u8"    \"Key\": \"To The Great Marsh\",\n",
+                u8"    \"enUS\": \"To The Great Marsh\",\n",
+                u8"    \"zhTW\": \"前往大沼澤\",\n",
+                u8"    \"deDE\": \"Zum großen Moor\",\n",
+                u8"    \"esES\": \"Al Gran Pantano\",\n",
+                u8"    \"frFR\": \"Vers le Grand marais\",\n",
+                u8"    \"itIT\": \"Per la Grande Palude\",\n",
+                u8"    \"koKR\": \"거대 습지로 이동\",\n",
+                u8"    \"plPL\": \"Wielkie Moczary\",\n",
+                u8"    \"esMX\": \"A la Gran Marisma\",\n",
+                u8"    \"jaJP\": \"大湿原へ\",\n",
+                u8"    \"ptBR\": \"Para o Grande Charco\",\n",
+                u8"    \"ruRU\": \"В Болотину\",\n",
+                u8"    \"zhCN\": \"前往庞大湿地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 891,\n",
+                u8"    \"Key\": \"To The Spider Forest\",\n",
+                u8"    \"enUS\": \"To The Spider Forest\",\n",
+                u8"    \"zhTW\": \"前往蜘蛛森林\",\n",
+                u8"    \"deDE\": \"Zum Spinnenwald\",\n",
+                u8"    \"esES\": \"Al Bosque de Arañas\",\n",
+                u8"    \"frFR\": \"Vers la Forêt de l’Araignée\",\n",
+                u8"    \"itIT\": \"Per la Foresta del Ragno\",\n",
+                u8"    \"koKR\": \"거미 숲으로 이동\",\n",
+                u8"    \"plPL\": \"Las Pająków\",\n",
+                u8"    \"esMX\": \"Al Bosque de Arañas\",\n",
+                u8"    \"jaJP\": \"蜘蛛の森へ\",\n",
+                u8"    \"ptBR\": \"Para a Floresta Aracnídea\",\n",
+                u8"    \"ruRU\": \"В Паучий лес\",\n",
+                u8"    \"zhCN\": \"前往蜘蛛森林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 892,\n",
+                u8"    \"Key\": \"To The Kurast Docktown\",\n",
+                u8"    \"enUS\": \"To The Kurast Docks\",\n",
+                u8"    \"zhTW\": \"前往庫拉斯特港口\",\n",
+                u8"    \"deDE\": \"Zu den Docks von Kurast\",\n",
+                u8"    \"esES\": \"A los Muelles de Kurast\",\n",
+                u8"    \"frFR\": \"Vers les Quais de Kurast\",\n",
+                u8"    \"itIT\": \"Per la Zona Portuale di Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 부두로 이동\",\n",
+                u8"    \"plPL\": \"Doki Kurast\",\n",
+                u8"    \"esMX\": \"A los Muelles de Kurast\",\n",
+                u8"    \"jaJP\": \"クラスト港へ\",\n",
+                u8"    \"ptBR\": \"Para as Docas de Kurast\",\n",
+                u8"    \"ruRU\": \"В доки Кураста\",\n",
+                u8"    \"zhCN\": \"前往库拉斯特海港\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 893,\n",
+                u8"    \"Key\": \"To The Arcane Sanctuary\",\n",
+                u8"    \"enUS\": \"To The Arcane Sanctuary\",\n",
+                u8"    \"zhTW\": \"前往秘法聖殿\",\n",
+                u8"    \"deDE\": \"Zur geheimen Zuflucht\",\n",
+                u8"    \"esES\": \"Al Santuario Arcano\",\n",
+                u8"    \"frFR\": \"Vers le Sanctuaire des Arcanes\",\n",
+                u8"    \"itIT\": \"Per il Santuario Arcano\",\n",
+                u8"    \"koKR\": \"비전의 성역으로 이동\",\n",
+                u8"    \"plPL\": \"Tajemne Sanktuarium\",\n",
+                u8"    \"esMX\": \"Al Santuario Arcano\",\n",
+                u8"    \"jaJP\": \"深遠なる聖域へ\",\n",
+                u8"    \"ptBR\": \"Para o Santuário Arcano\",\n",
+                u8"    \"ruRU\": \"В Магическое убежище\",\n",
+                u8"    \"zhCN\": \"前往神秘避难所\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 894,\n",
+                u8"    \"Key\": \"To Duriel's Lair\",\n",
+                u8"    \"enUS\": \"To Tal Rasha's Chamber\",\n",
+                u8"    \"zhTW\": \"前往塔拉夏的密室\",\n",
+                u8"    \"deDE\": \"Zu Tal Rashas Kammer\",\n",
+                u8"    \"esES\": \"A la Cámara de Tal Rasha\",\n",
+                u8"    \"frFR\": \"Vers la Chambre de Tal Rasha\",\n",
+                u8"    \"itIT\": \"Per la Cripta di Tal Rasha\",\n",
+                u8"    \"koKR\": \"탈 라샤의 방으로 이동\",\n",
+                u8"    \"plPL\": \"Komnata Tal Rashy\",\n",
+                u8"    \"esMX\": \"A la Cámara de Tal Rasha\",\n",
+                u8"    \"jaJP\": \"タル・ラシャの間へ\",\n",
+                u8"    \"ptBR\": \"Para a Câmara de Tal Rasha\",\n",
+                u8"    \"ruRU\": \"В погребальный зал Тал Раши\",\n",
+                u8"    \"zhCN\": \"前往塔·拉夏的墓室\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 895,\n",
+                u8"    \"Key\": \"To Tal Rasha's Tomb\",\n",
+                u8"    \"enUS\": \"To Tal Rasha's Tomb\",\n",
+                u8"    \"zhTW\": \"前往塔拉夏的古墓\",\n",
+                u8"    \"deDE\": \"Zu Tal Rashas Grab\",\n",
+                u8"    \"esES\": \"A la Tumba de Tal Rasha\",\n",
+                u8"    \"frFR\": \"Vers le Tombeau de Tal Rasha\",\n",
+                u8"    \"itIT\": \"Per la Tomba di Tal Rasha\",\n",
+                u8"    \"koKR\": \"탈 라샤의 무덤으로 이동\",\n",
+                u8"    \"plPL\": \"Grobowiec Tal Rashy\",\n",
+                u8"    \"esMX\": \"A la Tumba de Tal Rasha\",\n",
+                u8"    \"jaJP\": \"タル・ラシャの墓へ\",\n",
+                u8"    \"ptBR\": \"Para a Tumba de Tal Rasha\",\n",
+                u8"    \"ruRU\": \"В гробницу Тал Раши\",\n",
+                u8"    \"zhCN\": \"前往塔·拉夏之墓\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 896,\n",
+                u8"    \"Key\": \"To The Ancient Tunnels\",\n",
+                u8"    \"enUS\": \"To The Ancient Tunnels\",\n",
+                u8"    \"zhTW\": \"前往古代通道\",\n",
+                u8"    \"deDE\": \"Zu den alten Tunnels\",\n",
+                u8"    \"esES\": \"A los Túneles Antiguos\",\n",
+                u8"    \"frFR\": \"Vers les Tunnels antiques\",\n",
+                u8"    \"itIT\": \"Per gli Antichi Tunnel\",\n",
+                u8"    \"koKR\": \"고대 토굴로 이동\",\n",
+                u8"    \"plPL\": \"Prastare Tunele\",\n",
+                u8"    \"esMX\": \"A los Túneles Antiguos\",\n",
+                u8"    \"jaJP\": \"古の坑道へ\",\n",
+                u8"    \"ptBR\": \"Para os Túneis Ancestrais\",\n",
+                u8"    \"ruRU\": \"В древние туннели\",\n",
+                u8"    \"zhCN\": \"前往古代水道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 897,\n",
+                u8"    \"Key\": \"To The Maggot Lair Level 3\",\n",
+                u8"    \"enUS\": \"To The Maggot Lair Level 3\",\n",
+                u8"    \"zhTW\": \"前往蛆蟲巢穴第三層\",\n",
+                u8"    \"deDE\": \"Zur Wurmgruft, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 del Cubil de Gusanos\",\n",
+                u8"    \"frFR\": \"Vers le Repaire du ver niv. 3\",\n",
+                u8"    \"itIT\": \"Per il Covo delle Larve L3\",\n",
+                u8"    \"koKR\": \"구더기 굴 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Robacze Gniazdo – Poziom 3\",\n",
+                u8"    \"esMX\": \"A la Guarida de Gusanos Nivel 3\",\n",
+                u8"    \"jaJP\": \"地虫の巣穴: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Covil de Vermes Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень логова мокриц\",\n",
+                u8"    \"zhCN\": \"前往蛆虫巢穴三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 898,\n",
+                u8"    \"Key\": \"To The Maggot Lair Level 2\",\n",
+                u8"    \"enUS\": \"To The Maggot Lair Level 2\",\n",
+                u8"    \"zhTW\": \"前往蛆蟲巢穴第二層\",\n",
+                u8"    \"deDE\": \"Zur Wurmgruft, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 del Cubil de Gusanos\",\n",
+                u8"    \"frFR\": \"Vers le Repaire du ver niv. 2\",\n",
+                u8"    \"itIT\": \"Per il Covo delle Larve L2\",\n",
+                u8"    \"koKR\": \"구더기 굴 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Robacze Gniazdo – Poziom 2\",\n",
+                u8"    \"esMX\": \"A la Guarida de Gusanos Nivel 2\",\n",
+                u8"    \"jaJP\": \"地虫の巣穴: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Covil de Vermes Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень логова мокриц\",\n",
+                u8"    \"zhCN\": \"前往蛆虫巢穴二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 899,\n",
+                u8"    \"Key\": \"To The Maggot Lair Level 1\",\n",
+                u8"    \"enUS\": \"To The Maggot Lair Level 1\",\n",
+                u8"    \"zhTW\": \"前往蛆蟲巢穴第一層\",\n",
+                u8"    \"deDE\": \"Zur Wurmgruft, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 del Cubil de Gusanos\",\n",
+                u8"    \"frFR\": \"Vers le Repaire du ver niv. 1\",\n",
+                u8"    \"itIT\": \"Per il Covo delle Larve L1\",\n",
+                u8"    \"koKR\": \"구더기 굴 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Robacze Gniazdo – Poziom 1\",\n",
+                u8"    \"esMX\": \"A la Guarida de Gusanos Nivel 1\",\n",
+                u8"    \"jaJP\": \"地虫の巣穴: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Covil de Vermes Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень логова мокриц\",\n",
+                u8"    \"zhCN\": \"前往蛆虫巢穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 900,\n",
+                u8"    \"Key\": \"To The Claw Viper Temple Level 2\",\n",
+                u8"    \"enUS\": \"To The Claw Viper Temple Level 2\",\n",
+                u8"    \"zhTW\": \"前往利爪蛇魔神殿第二層\",\n",
+                u8"    \"deDE\": \"Zum Tempel der Klauenvipern, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 del Templo de la Garra Viperina\",\n",
+                u8"    \"frFR\": \"Vers le Temple des Vipères niv. 2\",\n",
+                u8"    \"itIT\": \"Per il Tempio delle Vipere L2\",\n",
+                u8"    \"koKR\": \"발톱 독사 사원 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Świątynia Żmijoszponów – Poziom 2\",\n",
+                u8"    \"esMX\": \"Al Templo del Vipérido de Garras Nivel 2\",\n",
+                u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Templo da Víbora da Garra Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень храма Когтистого Змея\",\n",
+                u8"    \"zhCN\": \"前往利爪蝮蛇神殿二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 901,\n",
+                u8"    \"Key\": \"To The Halls of the Dead Level 3\",\n",
+                u8"    \"enUS\": \"To The Halls of the Dead Level 3\",\n",
+                u8"    \"zhTW\": \"前往死亡之殿第三層\",\n",
+                u8"    \"deDE\": \"Zu den Hallen der Toten, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 de las Salas de la Muerte\",\n",
+                u8"    \"frFR\": \"Vers les Couloirs des morts niv. 3\",\n",
+                u8"    \"itIT\": \"Per le Sale dei Morti L3\",\n",
+                u8"    \"koKR\": \"망자의 전당 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Sale Umarłych – Poziom 3\",\n",
+                u8"    \"esMX\": \"A las Salas de la Muerte Nivel 3\",\n",
+                u8"    \"jaJP\": \"亡者の広間: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para os Salões dos Mortos Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень Чертогов Мертвых\",\n",
+                u8"    \"zhCN\": \"前往亡者大殿三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 902,\n",
+                u8"    \"Key\": \"To The Stony Tomb Level 2\",\n",
+                u8"    \"enUS\": \"To The Stony Tomb Level 2\",\n",
+                u8"    \"zhTW\": \"前往古老石墓第二層\",\n",
+                u8"    \"deDE\": \"Zum Steingrab, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 de la Tumba Pedregosa\",\n",
+                u8"    \"frFR\": \"Vers le Tombeau de pierre niv. 2\",\n",
+                u8"    \"itIT\": \"Per la Tomba di Pietra L2\",\n",
+                u8"    \"koKR\": \"바위 무덤 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Kamienny Grobowiec – Poziom 2\",\n",
+                u8"    \"esMX\": \"A la Tumba Pedregosa Nivel 2\",\n",
+                u8"    \"jaJP\": \"石造りの墓所: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Tumba Pétrea Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень каменной гробницы\",\n",
+                u8"    \"zhCN\": \"前往碎石古墓二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 903,\n",
+                u8"    \"Key\": \"To The Claw Viper Temple Level 1\",\n",
+                u8"    \"enUS\": \"To The Claw Viper Temple Level 1\",\n",
+                u8"    \"zhTW\": \"前往利爪蛇魔神殿第一層\",\n",
+                u8"    \"deDE\": \"Zum Tempel der Klauenvipern, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 del Templo de la Garra Viperina\",\n",
+                u8"    \"frFR\": \"Vers le Temple des Vipères niv. 1\",\n",
+                u8"    \"itIT\": \"Per il Tempio delle Vipere L1\",\n",
+                u8"    \"koKR\": \"발톱 독사 사원 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Świątynia Żmijoszponów – Poziom 1\",\n",
+                u8"    \"esMX\": \"Al Templo del Vipérido de Garras Nivel 1\",\n",
+                u8"    \"jaJP\": \"クロウ・ヴァイパーの寺院: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Templo da Víbora da Garra Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень храма Когтистого Змея\",\n",
+                u8"    \"zhCN\": \"前往利爪蝮蛇神殿一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 904,\n",
+                u8"    \"Key\": \"To The Halls of the Dead Level 2\",\n",
+                u8"    \"enUS\": \"To The Halls of the Dead Level 2\",\n",
+                u8"    \"zhTW\": \"前往死亡之殿第二層\",\n",
+                u8"    \"deDE\": \"Zu den Hallen der Toten, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 de las Salas de la Muerte\",\n",
+                u8"    \"frFR\": \"Vers les Couloirs des morts niv. 2\",\n",
+                u8"    \"itIT\": \"Per le Sale dei Morti L2\",\n",
+                u8"    \"koKR\": \"망자의 전당 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Sale Umarłych – Poziom 2\",\n",
+                u8"    \"esMX\": \"A las Salas de la Muerte Nivel 2\",\n",
+                u8"    \"jaJP\": \"亡者の広間: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para os Salões dos Mortos Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень Чертогов Мертвых\",\n",
+                u8"    \"zhCN\": \"前往亡者大殿二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 905,\n",
+                u8"    \"Key\": \"To The Halls of the Dead Level 1\",\n",
+                u8"    \"enUS\": \"To The Halls of the Dead Level 1\",\n",
+                u8"    \"zhTW\": \"前往死亡之殿第一層\",\n",
+                u8"    \"deDE\": \"Zu den Hallen der Toten, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 de las Salas de la Muerte\",\n",
+                u8"    \"frFR\": \"Vers les Couloirs des morts niv. 1\",\n",
+                u8"    \"itIT\": \"Per le Sale dei Morti L1\",\n",
+                u8"    \"koKR\": \"망자의 전당 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Sale Umarłych – Poziom 1\",\n",
+                u8"    \"esMX\": \"A las Salas de la Muerte Nivel 1\",\n",
+                u8"    \"jaJP\": \"亡者の広間: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para os Salões dos Mortos Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень Чертогов Мертвых\",\n",
+                u8"    \"zhCN\": \"前往亡者大殿一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 906,\n",
+                u8"    \"Key\": \"To The Stony Tomb Level 1\",\n",
+                u8"    \"enUS\": \"To The Stony Tomb Level 1\",\n",
+                u8"    \"zhTW\": \"前往古老石墓第一層\",\n",
+                u8"    \"deDE\": \"Zum Steingrab, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 de la Tumba Pedregosa\",\n",
+                u8"    \"frFR\": \"Vers le Tombeau de pierre niv. 1\",\n",
+                u8"    \"itIT\": \"Per la Tomba di Pietra L1\",\n",
+                u8"    \"koKR\": \"바위 무덤 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Kamienny Grobowiec – Poziom 1\",\n",
+                u8"    \"esMX\": \"A la Tumba Pedregosa Nivel 1\",\n",
+                u8"    \"jaJP\": \"石造りの墓所: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Tumba Pétrea Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень каменной гробницы\",\n",
+                u8"    \"zhCN\": \"前往碎石古墓一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 907,\n",
+                u8"    \"Key\": \"To The Palace Cellar Level 3\",\n",
+                u8"    \"enUS\": \"To The Palace Cellar Level 3\",\n",
+                u8"    \"zhTW\": \"前往皇宮地窖第三層\",\n",
+                u8"    \"deDE\": \"Zum Palastkeller, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 del Sótano del Palacio\",\n",
+                u8"    \"frFR\": \"Vers les Caves du Palais niv. 3\",\n",
+                u8"    \"itIT\": \"Per i Sotterranei del Palazzo L3\",\n",
+                u8"    \"koKR\": \"궁전 지하 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 3\",\n",
+                u8"    \"esMX\": \"Al Sótano del Palacio Nivel 3\",\n",
+                u8"    \"jaJP\": \"宮殿地下室: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Porão do Palácio Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень дворцового погреба\",\n",
+                u8"    \"zhCN\": \"前往王宫监牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 908,\n",
+                u8"    \"Key\": \"To The Palace Cellar Level 2\",\n",
+                u8"    \"enUS\": \"To The Palace Cellar Level 2\",\n",
+                u8"    \"zhTW\": \"前往皇宮地窖第二層\",\n",
+                u8"    \"deDE\": \"Zum Palastkeller, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 del Sótano del Palacio\",\n",
+                u8"    \"frFR\": \"Vers les Caves du Palais niv. 2\",\n",
+                u8"    \"itIT\": \"Per i Sotterranei del Palazzo L2\",\n",
+                u8"    \"koKR\": \"궁전 지하 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 2\",\n",
+                u8"    \"esMX\": \"Al Sótano del Palacio Nivel 2\",\n",
+                u8"    \"jaJP\": \"宮殿地下室: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Porão do Palácio Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень дворцового погреба\",\n",
+                u8"    \"zhCN\": \"前往王宫监牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 909,\n",
+                u8"    \"Key\": \"To The Palace Cellar Level 1\",\n",
+                u8"    \"enUS\": \"To The Palace Cellar Level 1\",\n",
+                u8"    \"zhTW\": \"前往皇宮地窖第一層\",\n",
+                u8"    \"deDE\": \"Zum Palastkeller, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 del Sótano del Palacio\",\n",
+                u8"    \"frFR\": \"Vers les Caves du Palais niv. 1\",\n",
+                u8"    \"itIT\": \"Per i Sotterranei del Palazzo L1\",\n",
+                u8"    \"koKR\": \"궁전 지하 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Pałacowe Piwnice – Poziom 1\",\n",
+                u8"    \"esMX\": \"Al Sótano del Palacio Nivel 1\",\n",
+                u8"    \"jaJP\": \"宮殿地下室: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Porão do Palácio Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень дворцового погреба\",\n",
+                u8"    \"zhCN\": \"前往王宫监牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 910,\n",
+                u8"    \"Key\": \"To The Harem Level 2\",\n",
+                u8"    \"enUS\": \"To The Harem Level 2\",\n",
+                u8"    \"zhTW\": \"前往後宮第二層\",\n",
+                u8"    \"deDE\": \"Zum Harem, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 del Harén\",\n",
+                u8"    \"frFR\": \"Vers le Harem niv. 2\",\n",
+                u8"    \"itIT\": \"Per l'Harem L2\",\n",
+                u8"    \"koKR\": \"하렘 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Harem – Poziom 2\",\n",
+                u8"    \"esMX\": \"Al Harén Nivel 2\",\n",
+                u8"    \"jaJP\": \"ハーレム: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Harém Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень гарема\",\n",
+                u8"    \"zhCN\": \"前往女眷住处二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 911,\n",
+                u8"    \"Key\": \"To The Harem Level 1\",\n",
+                u8"    \"enUS\": \"To The Harem Level 1\",\n",
+                u8"    \"zhTW\": \"前往後宮第一層\",\n",
+                u8"    \"deDE\": \"Zum Harem, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 del Harén\",\n",
+                u8"    \"frFR\": \"Vers le Harem niv. 1\",\n",
+                u8"    \"itIT\": \"Per l'Harem L1\",\n",
+                u8"    \"koKR\": \"하렘 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Harem – Poziom 1\",\n",
+                u8"    \"esMX\": \"Al Harén Nivel 1\",\n",
+                u8"    \"jaJP\": \"ハーレム: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Harém Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень гарема\",\n",
+                u8"    \"zhCN\": \"前往女眷住处一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 912,\n",
+                u8"    \"Key\": \"To The Sewers Level 3\",\n",
+                u8"    \"enUS\": \"To The Sewers Level 3\",\n",
+                u8"    \"zhTW\": \"前往下水道第三層\",\n",
+                u8"    \"deDE\": \"Zur Kanalisation, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 de las Cloacas\",\n",
+                u8"    \"frFR\": \"Vers les Égouts niv. 3\",\n",
+                u8"    \"itIT\": \"Per le Fogne L3\",\n",
+                u8"    \"koKR\": \"하수도 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Kanały – Poziom 3\",\n",
+                u8"    \"esMX\": \"A las Cloacas Nivel 3\",\n",
+                u8"    \"jaJP\": \"下水道: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Esgoto Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень стоков\",\n",
+                u8"    \"zhCN\": \"前往下水道三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 913,\n",
+                u8"    \"Key\": \"To The Sewers Level 2\",\n",
+                u8"    \"enUS\": \"To The Sewers Level 2\",\n",
+                u8"    \"zhTW\": \"前往下水道第二層\",\n",
+                u8"    \"deDE\": \"Zur Kanalisation, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 de las Cloacas\",\n",
+                u8"    \"frFR\": \"Vers les Égouts niv. 2\",\n",
+                u8"    \"itIT\": \"Per le Fogne L2\",\n",
+                u8"    \"koKR\": \"하수도 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Kanały – Poziom 2\",\n",
+                u8"    \"esMX\": \"A las Cloacas Nivel 2\",\n",
+                u8"    \"jaJP\": \"下水道: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Esgoto Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень стоков\",\n",
+                u8"    \"zhCN\": \"前往下水道二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 914,\n",
+                u8"    \"Key\": \"To The Sewers Level 1\",\n",
+                u8"    \"enUS\": \"To The Sewers Level 1\",\n",
+                u8"    \"zhTW\": \"前往下水道第一層\",\n",
+                u8"    \"deDE\": \"Zur Kanalisation, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 de las Cloacas\",\n",
+                u8"    \"frFR\": \"Vers les Égouts niv. 1\",\n",
+                u8"    \"itIT\": \"Per le Fogne L1\",\n",
+                u8"    \"koKR\": \"하수도 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Kanały – Poziom 1\",\n",
+                u8"    \"esMX\": \"A las Cloacas Nivel 1\",\n",
+                u8"    \"jaJP\": \"下水道: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Esgoto Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень стоков\",\n",
+                u8"    \"zhCN\": \"前往下水道一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 915,\n",
+                u8"    \"Key\": \"To The Canyon of the Magi\",\n",
+                u8"    \"enUS\": \"To The Canyon of the Magi\",\n",
+                u8"    \"zhTW\": \"前往賢者之谷\",\n",
+                u8"    \"deDE\": \"Zur Schlucht der Magier\",\n",
+                u8"    \"esES\": \"Al Cañón de los Magos\",\n",
+                u8"    \"frFR\": \"Vers le Canyon des Mages\",\n",
+                u8"    \"itIT\": \"Per il Canyon dei Maghi\",\n",
+                u8"    \"koKR\": \"신비술사의 협곡으로 이동\",\n",
+                u8"    \"plPL\": \"Kanion Magów\",\n",
+                u8"    \"esMX\": \"Al Cañón de los Magos\",\n",
+                u8"    \"jaJP\": \"魔術師の峡谷へ\",\n",
+                u8"    \"ptBR\": \"Para o Cânion dos Magi\",\n",
+                u8"    \"ruRU\": \"В Каньон волхвов\",\n",
+                u8"    \"zhCN\": \"前往法师峡谷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 916,\n",
+                u8"    \"Key\": \"To The Valley of Snakes\",\n",
+                u8"    \"enUS\": \"To The Valley of Snakes\",\n",
+                u8"    \"zhTW\": \"前往群蛇峽谷\",\n",
+                u8"    \"deDE\": \"Zum Tal der Schlangen\",\n",
+                u8"    \"esES\": \"Al Valle de las Serpientes\",\n",
+                u8"    \"frFR\": \"Vers la Vallée des serpents\",\n",
+                u8"    \"itIT\": \"Per la Valle dei Serpenti\",\n",
+                u8"    \"koKR\": \"뱀의 골짜기로 이동\",\n",
+                u8"    \"plPL\": \"Dolina Węży\",\n",
+                u8"    \"esMX\": \"Al Valle de las Culebras\",\n",
+                u8"    \"jaJP\": \"蛇の谷へ\",\n",
+                u8"    \"ptBR\": \"Para o Vale das Cobras\",\n",
+                u8"    \"ruRU\": \"В Долину змей\",\n",
+                u8"    \"zhCN\": \"前往群蛇峡谷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 917,\n",
+                u8"    \"Key\": \"To The Lost City\",\n",
+                u8"    \"enUS\": \"To The Lost City\",\n",
+                u8"    \"zhTW\": \"前往失落古城\",\n",
+                u8"    \"deDE\": \"Zur vergessenen Stadt\",\n",
+                u8"    \"esES\": \"A la Ciudad Perdida\",\n",
+                u8"    \"frFR\": \"Vers la Ville oubliée\",\n",
+                u8"    \"itIT\": \"Per la Città Perduta\",\n",
+                u8"    \"koKR\": \"잊힌 도시로 이동\",\n",
+                u8"    \"plPL\": \"Zaginione Miasto\",\n",
+                u8"    \"esMX\": \"A la Ciudad Perdida\",\n",
+                u8"    \"jaJP\": \"失われし都へ\",\n",
+                u8"    \"ptBR\": \"Para a Cidade Perdida\",\n",
+                u8"    \"ruRU\": \"В затерянный город\",\n",
+                u8"    \"zhCN\": \"前往失落之城\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 918,\n",
+                u8"    \"Key\": \"To The Far Oasis\",\n",
+                u8"    \"enUS\": \"To The Far Oasis\",\n",
+                u8"    \"zhTW\": \"前往遙遠的綠洲\",\n",
+                u8"    \"deDE\": \"Zur fernen Oase\",\n",
+                u8"    \"esES\": \"Al Oasis Lejano\",\n",
+                u8"    \"frFR\": \"Vers l’Oasis lointaine\",\n",
+                u8"    \"itIT\": \"Per l'Oasi Lontana\",\n",
+                u8"    \"koKR\": \"머나먼 오아시스로 이동\",\n",
+                u8"    \"plPL\": \"Daleka Oaza\",\n",
+                u8"    \"esMX\": \"Al Oasis Lejano\",\n",
+                u8"    \"jaJP\": \"遥かなるオアシスへ\",\n",
+                u8"    \"ptBR\": \"Para o Oásis Longínquo\",\n",
+                u8"    \"ruRU\": \"В Дальний оазис\",\n",
+                u8"    \"zhCN\": \"前往偏远绿洲\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 919,\n",
+                u8"    \"Key\": \"To The Dry Hills\",\n",
+                u8"    \"enUS\": \"To The Dry Hills\",\n",
+                u8"    \"zhTW\": \"前往乾土高地\",\n",
+                u8"    \"deDE\": \"Zu den verdorrten Hügeln\",\n",
+                u8"    \"esES\": \"A las Colinas Áridas\",\n",
+                u8"    \"frFR\": \"Vers les Collines arides\",\n",
+                u8"    \"itIT\": \"Per le Colline Aride\",\n",
+                u8"    \"koKR\": \"메마른 언덕으로 이동\",\n",
+                u8"    \"plPL\": \"Suche Wzgórza\",\n",
+                u8"    \"esMX\": \"A las Colinas Áridas\",\n",
+                u8"    \"jaJP\": \"乾きの丘へ\",\n",
+                u8"    \"ptBR\": \"Para as Colinas Áridas\",\n",
+                u8"    \"ruRU\": \"На Иссохшие холмы\",\n",
+                u8"    \"zhCN\": \"前往干燥高地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 920,\n",
+                u8"    \"Key\": \"To The Rocky Waste\",\n",
+                u8"    \"enUS\": \"To The Rocky Waste\",\n",
+                u8"    \"zhTW\": \"前往碎石荒地\",\n",
+                u8"    \"deDE\": \"Zur felsigen Öde\",\n",
+                u8"    \"esES\": \"Al Erial Rocoso\",\n",
+                u8"    \"frFR\": \"Vers le Désert de roche\",\n",
+                u8"    \"itIT\": \"Per la Landa Rocciosa\",\n",
+                u8"    \"koKR\": \"바위투성이 황무지로 이동\",\n",
+                u8"    \"plPL\": \"Skalne Pustkowie\",\n",
+                u8"    \"esMX\": \"A la Estepa Rocosa\",\n",
+                u8"    \"jaJP\": \"岩だらけの荒れ地へ\",\n",
+                u8"    \"ptBR\": \"Para o Ermo Rochoso\",\n",
+                u8"    \"ruRU\": \"В Каменистую пустошь\",\n",
+                u8"    \"zhCN\": \"前往碎石荒野\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 921,\n",
+                u8"    \"Key\": \"To Lut Gholein\",\n",
+                u8"    \"enUS\": \"To Lut Gholein\",\n",
+                u8"    \"zhTW\": \"前往魯高因\",\n",
+                u8"    \"deDE\": \"Nach Lut Gholein\",\n",
+                u8"    \"esES\": \"A Lut Gholein\",\n",
+                u8"    \"frFR\": \"Vers Lut Gholein\",\n",
+                u8"    \"itIT\": \"Per Lut Gholein\",\n",
+                u8"    \"koKR\": \"루트 골레인으로 이동\",\n",
+                u8"    \"plPL\": \"Lut Gholein\",\n",
+                u8"    \"esMX\": \"A Lut Gholein\",\n",
+                u8"    \"jaJP\": \"ラット・ゴーレインへ\",\n",
+                u8"    \"ptBR\": \"Para Lut Gholein\",\n",
+                u8"    \"ruRU\": \"В Лут-Голейн\",\n",
+                u8"    \"zhCN\": \"前往鲁·高因\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1640,\n",
+                u8"    \"Key\": \"To Guild 5\",\n",
+                u8"    \"enUS\": \"          \",\n",
+                u8"    \"zhTW\": \"          \",\n",
+                u8"    \"deDE\": \"          \",\n",
+                u8"    \"esES\": \"          \",\n",
+                u8"    \"frFR\": \"          \",\n",
+                u8"    \"itIT\": \"          \",\n",
+                u8"    \"koKR\": \"To Guild 5\",\n",
+                u8"    \"plPL\": \"          \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"          \"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1641,\n",
+                u8"    \"Key\": \"To Guild 4\",\n",
+                u8"    \"enUS\": \"          \",\n",
+                u8"    \"zhTW\": \"          \",\n",
+                u8"    \"deDE\": \"          \",\n",
+                u8"    \"esES\": \"          \",\n",
+                u8"    \"frFR\": \"          \",\n",
+                u8"    \"itIT\": \"          \",\n",
+                u8"    \"koKR\": \"To Guild 4\",\n",
+                u8"    \"plPL\": \"          \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"          \"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1642,\n",
+                u8"    \"Key\": \"To Guild 3\",\n",
+                u8"    \"enUS\": \"          \",\n",
+                u8"    \"zhTW\": \"          \",\n",
+                u8"    \"deDE\": \"          \",\n",
+                u8"    \"esES\": \"          \",\n",
+                u8"    \"frFR\": \"          \",\n",
+                u8"    \"itIT\": \"          \",\n",
+                u8"    \"koKR\": \"To Guild 3\",\n",
+                u8"    \"plPL\": \"          \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"          \"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1643,\n",
+                u8"    \"Key\": \"To Guild 2\",\n",
+                u8"    \"enUS\": \"          \",\n",
+                u8"    \"zhTW\": \"          \",\n",
+                u8"    \"deDE\": \"          \",\n",
+                u8"    \"esES\": \"          \",\n",
+                u8"    \"frFR\": \"          \",\n",
+                u8"    \"itIT\": \"          \",\n",
+                u8"    \"koKR\": \"To Guild 2\",\n",
+                u8"    \"plPL\": \"          \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"          \"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1644,\n",
+                u8"    \"Key\": \"To Guild 1\",\n",
+                u8"    \"enUS\": \"          \",\n",
+                u8"    \"zhTW\": \"          \",\n",
+                u8"    \"deDE\": \"          \",\n",
+                u8"    \"esES\": \"          \",\n",
+                u8"    \"frFR\": \"          \",\n",
+                u8"    \"itIT\": \"          \",\n",
+                u8"    \"koKR\": \"To Guild 1\",\n",
+                u8"    \"plPL\": \"          \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"          \"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4137,\n",
+                u8"    \"Key\": \"act1\",\n",
+                u8"    \"enUS\": \"Act 1\",\n",
+                u8"    \"zhTW\": \"第一章\",\n",
+                u8"    \"deDE\": \"Akt 1\",\n",
+                u8"    \"esES\": \"Acto 1\",\n",
+                u8"    \"frFR\": \"Acte I\",\n",
+                u8"    \"itIT\": \"Atto 1\",\n",
+                u8"    \"koKR\": \"1막\",\n",
+                u8"    \"plPL\": \"Akt I\",\n",
+                u8"    \"esMX\": \"Acto 1\",\n",
+                u8"    \"jaJP\": \"第1章\",\n",
+                u8"    \"ptBR\": \"Ato 1\",\n",
+                u8"    \"ruRU\": \"Акт I\",\n",
+                u8"    \"zhCN\": \"一幕\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4138,\n",
+                u8"    \"Key\": \"act2\",\n",
+                u8"    \"enUS\": \"Act 2\",\n",
+                u8"    \"zhTW\": \"第二章\",\n",
+                u8"    \"deDE\": \"Akt 2\",\n",
+                u8"    \"esES\": \"Acto 2\",\n",
+                u8"    \"frFR\": \"Acte II\",\n",
+                u8"    \"itIT\": \"Atto 2\",\n",
+                u8"    \"koKR\": \"2막\",\n",
+                u8"    \"plPL\": \"Akt II\",\n",
+                u8"    \"esMX\": \"Acto 2\",\n",
+                u8"    \"jaJP\": \"第2章\",\n",
+                u8"    \"ptBR\": \"Ato 2\",\n",
+                u8"    \"ruRU\": \"Акт II \",\n",
+                u8"    \"zhCN\": \"二幕\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4139,\n",
+                u8"    \"Key\": \"act3\",\n",
+                u8"    \"enUS\": \"Act 3\",\n",
+                u8"    \"zhTW\": \"第三章\",\n",
+                u8"    \"deDE\": \"Akt 3\",\n",
+                u8"    \"esES\": \"Acto 3\",\n",
+                u8"    \"frFR\": \"Acte III\",\n",
+                u8"    \"itIT\": \"Atto 3\",\n",
+                u8"    \"koKR\": \"3막\",\n",
+                u8"    \"plPL\": \"Akt III\",\n",
+                u8"    \"esMX\": \"Acto 3\",\n",
+                u8"    \"jaJP\": \"第3章\",\n",
+                u8"    \"ptBR\": \"Ato 3\",\n",
+                u8"    \"ruRU\": \"Акт III\",\n",
+                u8"    \"zhCN\": \"三幕\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4140,\n",
+                u8"    \"Key\": \"act4\",\n",
+                u8"    \"enUS\": \"Act 4\",\n",
+                u8"    \"zhTW\": \"第四章\",\n",
+                u8"    \"deDE\": \"Akt 4\",\n",
+                u8"    \"esES\": \"Acto 4\",\n",
+                u8"    \"frFR\": \"Acte VI\",\n",
+                u8"    \"itIT\": \"Atto 4\",\n",
+                u8"    \"koKR\": \"4막\",\n",
+                u8"    \"plPL\": \"Akt IV\",\n",
+                u8"    \"esMX\": \"Acto 4\",\n",
+                u8"    \"jaJP\": \"第4章\",\n",
+                u8"    \"ptBR\": \"Ato 4\",\n",
+                u8"    \"ruRU\": \"Акт IV\",\n",
+                u8"    \"zhCN\": \"四幕\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 4152,\n",
+                u8"    \"Key\": \"Leave\",\n",
+                u8"    \"enUS\": \"LEAVE\",\n",
+                u8"    \"zhTW\": \"離開\",\n",
+                u8"    \"deDE\": \"ENDE\",\n",
+                u8"    \"esES\": \"IRSE\",\n",
+                u8"    \"frFR\": \"QUITTER\",\n",
+                u8"    \"itIT\": \"LASCIA\",\n",
+                u8"    \"koKR\": \"나가기\",\n",
+                u8"    \"plPL\": \"WYJDŹ\",\n",
+                u8"    \"esMX\": \"ABANDONAR\",\n",
+                u8"    \"jaJP\": \"立ち去る\",\n",
+                u8"    \"ptBR\": \"SAIR\",\n",
+                u8"    \"ruRU\": \"НАЗАД\",\n",
+                u8"    \"zhCN\": \"离开\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5018,\n",
+                u8"    \"Key\": \"Tristram\",\n",
+                u8"    \"enUS\": \"Tristram\",\n",
+                u8"    \"zhTW\": \"崔斯特姆\",\n",
+                u8"    \"deDE\": \"Tristram\",\n",
+                u8"    \"esES\": \"Tristán\",\n",
+                u8"    \"frFR\": \"Tristram\",\n",
+                u8"    \"itIT\": \"Tristram\",\n",
+                u8"    \"koKR\": \"트리스트럼\",\n",
+                u8"    \"plPL\": \"Tristram\",\n",
+                u8"    \"esMX\": \"Tristram\",\n",
+                u8"    \"jaJP\": \"トリストラム\",\n",
+                u8"    \"ptBR\": \"Tristram\",\n",
+                u8"    \"ruRU\": \"Тристрам\",\n",
+                u8"    \"zhCN\": \"崔斯特姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5019,\n",
+                u8"    \"Key\": \"Catacombs Level 4\",\n",
+                u8"    \"enUS\": \"Catacombs Level 4\",\n",
+                u8"    \"zhTW\": \"地下墓穴第四層\",\n",
+                u8"    \"deDE\": \"Katakomben, Ebene 4\",\n",
+                u8"    \"esES\": \"Catacumbas nivel 4\",\n",
+                u8"    \"frFR\": \"Les Catacombes niv. 4\",\n",
+                u8"    \"itIT\": \"Catacombe L4\",\n",
+                u8"    \"koKR\": \"지하 묘지 4층\",\n",
+                u8"    \"plPL\": \"Katakumby – Poziom 4\",\n",
+                u8"    \"esMX\": \"Catacumbas Nivel 4\",\n",
+                u8"    \"jaJP\": \"地下墓地: 第4階層\",\n",
+                u8"    \"ptBR\": \"Catacumbas Nível 4\",\n",
+                u8"    \"ruRU\": \"Катакомбы: 4-й уровень\",\n",
+                u8"    \"zhCN\": \"地下墓穴四层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5020,\n",
+                u8"    \"Key\": \"Catacombs Level 3\",\n",
+                u8"    \"enUS\": \"Catacombs Level 3\",\n",
+                u8"    \"zhTW\": \"地下墓穴第三層\",\n",
+                u8"    \"deDE\": \"Katakomben, Ebene 3\",\n",
+                u8"    \"esES\": \"Catacumbas nivel 3\",\n",
+                u8"    \"frFR\": \"Les Catacombes niv. 3\",\n",
+                u8"    \"itIT\": \"Catacombe L3\",\n",
+                u8"    \"koKR\": \"지하 묘지 3층\",\n",
+                u8"    \"plPL\": \"Katakumby – Poziom 3\",\n",
+                u8"    \"esMX\": \"Catacumbas Nivel 3\",\n",
+                u8"    \"jaJP\": \"地下墓地: 第3階層\",\n",
+                u8"    \"ptBR\": \"Catacumbas Nível 3\",\n",
+                u8"    \"ruRU\": \"Катакомбы: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"地下墓穴三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5021,\n",
+                u8"    \"Key\": \"Catacombs Level 2\",\n",
+                u8"    \"enUS\": \"Catacombs Level 2\",\n",
+                u8"    \"zhTW\": \"地下墓穴第二層\",\n",
+                u8"    \"deDE\": \"Katakomben, Ebene 2\",\n",
+                u8"    \"esES\": \"Catacumbas nivel 2\",\n",
+                u8"    \"frFR\": \"Les Catacombes niv. 2\",\n",
+                u8"    \"itIT\": \"Catacombe L2\",\n",
+                u8"    \"koKR\": \"지하 묘지 2층\",\n",
+                u8"    \"plPL\": \"Katakumby – Poziom 2\",\n",
+                u8"    \"esMX\": \"Catacumbas Nivel 2\",\n",
+                u8"    \"jaJP\": \"地下墓地: 第2階層\",\n",
+                u8"    \"ptBR\": \"Catacumbas Nível 2\",\n",
+                u8"    \"ruRU\": \"Катакомбы: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"地下墓穴二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5022,\n",
+                u8"    \"Key\": \"Catacombs Level 1\",\n",
+                u8"    \"enUS\": \"Catacombs Level 1\",\n",
+                u8"    \"zhTW\": \"地下墓穴第一層\",\n",
+                u8"    \"deDE\": \"Katakomben, Ebene 1\",\n",
+                u8"    \"esES\": \"Catacumbas nivel 1\",\n",
+                u8"    \"frFR\": \"Les Catacombes niv. 1\",\n",
+                u8"    \"itIT\": \"Catacombe L1\",\n",
+                u8"    \"koKR\": \"지하 묘지 1층\",\n",
+                u8"    \"plPL\": \"Katakumby – Poziom 1\",\n",
+                u8"    \"esMX\": \"Catacumbas Nivel 1\",\n",
+                u8"    \"jaJP\": \"地下墓地: 第1階層\",\n",
+                u8"    \"ptBR\": \"Catacumbas Nível 1\",\n",
+                u8"    \"ruRU\": \"Катакомбы: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"地下墓穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5023,\n",
+                u8"    \"Key\": \"Cathedral\",\n",
+                u8"    \"enUS\": \"Cathedral\",\n",
+                u8"    \"zhTW\": \"大教堂\",\n",
+                u8"    \"deDE\": \"Kathedrale\",\n",
+                u8"    \"esES\": \"Catedral\",\n",
+                u8"    \"frFR\": \"La Cathédrale\",\n",
+                u8"    \"itIT\": \"Cattedrale\",\n",
+                u8"    \"koKR\": \"대성당\",\n",
+                u8"    \"plPL\": \"Katedra\",\n",
+                u8"    \"esMX\": \"Catedral\",\n",
+                u8"    \"jaJP\": \"大聖堂\",\n",
+                u8"    \"ptBR\": \"Catedral\",\n",
+                u8"    \"ruRU\": \"Собор\",\n",
+                u8"    \"zhCN\": \"大教堂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5024,\n",
+                u8"    \"Key\": \"Inner Cloister\",\n",
+                u8"    \"enUS\": \"Inner Cloister\",\n",
+                u8"    \"zhTW\": \"內側迴廊\",\n",
+                u8"    \"deDE\": \"Inneres Kloster\",\n",
+                u8"    \"esES\": \"Claustro Interior\",\n",
+                u8"    \"frFR\": \"Le Cloître intérieur\",\n",
+                u8"    \"itIT\": \"Chiostro Interno\",\n",
+                u8"    \"koKR\": \"내부 회랑\",\n",
+                u8"    \"plPL\": \"Wewnętrzny Monastyr\",\n",
+                u8"    \"esMX\": \"Claustro Interno\",\n",
+                u8"    \"jaJP\": \"修道院内部\",\n",
+                u8"    \"ptBR\": \"Claustro Interno\",\n",
+                u8"    \"ruRU\": \"Внутренний двор\",\n",
+                u8"    \"zhCN\": \"内侧回廊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5025,\n",
+                u8"    \"Key\": \"Jail Level 3\",\n",
+                u8"    \"enUS\": \"Jail Level 3\",\n",
+                u8"    \"zhTW\": \"監牢第三層\",\n",
+                u8"    \"deDE\": \"Gefängnis, Ebene 3\",\n",
+                u8"    \"esES\": \"Cárcel nivel 3\",\n",
+                u8"    \"frFR\": \"La Prison niv. 3\",\n",
+                u8"    \"itIT\": \"Prigione L3\",\n",
+                u8"    \"koKR\": \"감옥 3층\",\n",
+                u8"    \"plPL\": \"Więzienie – Poziom 3\",\n",
+                u8"    \"esMX\": \"Prisión Nivel 3\",\n",
+                u8"    \"jaJP\": \"牢獄: 第3階層\",\n",
+                u8"    \"ptBR\": \"Prisão Nível 3\",\n",
+                u8"    \"ruRU\": \"Тюрьма: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"监牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5026,\n",
+                u8"    \"Key\": \"Jail Level 2\",\n",
+                u8"    \"enUS\": \"Jail Level 2\",\n",
+                u8"    \"zhTW\": \"監牢第二層\",\n",
+                u8"    \"deDE\": \"Gefängnis, Ebene 2\",\n",
+                u8"    \"esES\": \"Cárcel nivel 2\",\n",
+                u8"    \"frFR\": \"La Prison niv. 2\",\n",
+                u8"    \"itIT\": \"Prigione L2\",\n",
+                u8"    \"koKR\": \"감옥 2층\",\n",
+                u8"    \"plPL\": \"Więzienie – Poziom 2\",\n",
+                u8"    \"esMX\": \"Prisión Nivel 2\",\n",
+                u8"    \"jaJP\": \"牢獄: 第2階層\",\n",
+                u8"    \"ptBR\": \"Prisão Nível 2\",\n",
+                u8"    \"ruRU\": \"Тюрьма: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"监牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5027,\n",
+                u8"    \"Key\": \"Jail Level 1\",\n",
+                u8"    \"enUS\": \"Jail Level 1\",\n",
+                u8"    \"zhTW\": \"監牢第一層\",\n",
+                u8"    \"deDE\": \"Gefängnis, Ebene 1\",\n",
+                u8"    \"esES\": \"Cárcel nivel 1\",\n",
+                u8"    \"frFR\": \"La Prison niv. 1\",\n",
+                u8"    \"itIT\": \"Prigione L1\",\n",
+                u8"    \"koKR\": \"감옥 1층\",\n",
+                u8"    \"plPL\": \"Więzienie – Poziom 1\",\n",
+                u8"    \"esMX\": \"Prisión Nivel 1\",\n",
+                u8"    \"jaJP\": \"牢獄: 第1階層\",\n",
+                u8"    \"ptBR\": \"Prisão Nível 1\",\n",
+                u8"    \"ruRU\": \"Тюрьма: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"监牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5028,\n",
+                u8"    \"Key\": \"Barracks\",\n",
+                u8"    \"enUS\": \"Barracks\",\n",
+                u8"    \"zhTW\": \"兵營\",\n",
+                u8"    \"deDE\": \"Kaserne\",\n",
+                u8"    \"esES\": \"Barracones\",\n",
+                u8"    \"frFR\": \"La Caserne\",\n",
+                u8"    \"itIT\": \"Caserma\",\n",
+                u8"    \"koKR\": \"병영\",\n",
+                u8"    \"plPL\": \"Koszary\",\n",
+                u8"    \"esMX\": \"Cuartel\",\n",
+                u8"    \"jaJP\": \"兵舎\",\n",
+                u8"    \"ptBR\": \"Quartel\",\n",
+                u8"    \"ruRU\": \"Казармы\",\n",
+                u8"    \"zhCN\": \"营房\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5029,\n",
+                u8"    \"Key\": \"Outer Cloister\",\n",
+                u8"    \"enUS\": \"Outer Cloister\",\n",
+                u8"    \"zhTW\": \"外側迴廊\",\n",
+                u8"    \"deDE\": \"Äußeres Kloster\",\n",
+                u8"    \"esES\": \"Claustro Exterior\",\n",
+                u8"    \"frFR\": \"Le Cloître extérieur\",\n",
+                u8"    \"itIT\": \"Chiostro Esterno\",\n",
+                u8"    \"koKR\": \"외부 회랑\",\n",
+                u8"    \"plPL\": \"Zewnętrzny Monastyr\",\n",
+                u8"    \"esMX\": \"Claustro Exterior\",\n",
+                u8"    \"jaJP\": \"修道院外部\",\n",
+                u8"    \"ptBR\": \"Claustro Externo\",\n",
+                u8"    \"ruRU\": \"Внешний двор\",\n",
+                u8"    \"zhCN\": \"外侧回廊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5030,\n",
+                u8"    \"Key\": \"Monastery Gate\",\n",
+                u8"    \"enUS\": \"Monastery Gate\",\n",
+                u8"    \"zhTW\": \"修道院大門\",\n",
+                u8"    \"deDE\": \"Klosterpforte\",\n",
+                u8"    \"esES\": \"Puertas del Monasterio\",\n",
+                u8"    \"frFR\": \"Les Portes du Monastère\",\n",
+                u8"    \"itIT\": \"Atrio del Monastero\",\n",
+                u8"    \"koKR\": \"수도원 정문\",\n",
+                u8"    \"plPL\": \"Klasztorna Brama\",\n",
+                u8"    \"esMX\": \"Entrada del Monasterio\",\n",
+                u8"    \"jaJP\": \"修道院の門\",\n",
+                u8"    \"ptBR\": \"Portão do Monastério\",\n",
+                u8"    \"ruRU\": \"Монастырские ворота\",\n",
+                u8"    \"zhCN\": \"修道院大门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5031,\n",
+                u8"    \"Key\": \"Tower Cellar Level 5\",\n",
+                u8"    \"enUS\": \"Tower Cellar Level 5\",\n",
+                u8"    \"zhTW\": \"高塔地牢第五層\",\n",
+                u8"    \"deDE\": \"Turmkeller, Ebene 5\",\n",
+                u8"    \"esES\": \"Sótano de la Torre nivel 5\",\n",
+                u8"    \"frFR\": \"La Cave de la Tour niv. 5\",\n",
+                u8"    \"itIT\": \"Sotterraneo della Torre L5\",\n",
+                u8"    \"koKR\": \"탑 지하 5층\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 5\",\n",
+                u8"    \"esMX\": \"Sótano de la Torre Nivel 5\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第5階層\",\n",
+                u8"    \"ptBR\": \"Porão da Torre Nível 5\",\n",
+                u8"    \"ruRU\": \"Подвал башни: 5-й уровень\",\n",
+                u8"    \"zhCN\": \"高塔地窖五层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5032,\n",
+                u8"    \"Key\": \"Tower Cellar Level 4\",\n",
+                u8"    \"enUS\": \"Tower Cellar Level 4\",\n",
+                u8"    \"zhTW\": \"高塔地牢第四層\",\n",
+                u8"    \"deDE\": \"Turmkeller, Ebene 4\",\n",
+                u8"    \"esES\": \"Sótano de la Torre nivel 4\",\n",
+                u8"    \"frFR\": \"La Cave de la Tour niv. 4\",\n",
+                u8"    \"itIT\": \"Sotterraneo della Torre L4\",\n",
+                u8"    \"koKR\": \"탑 지하 4층\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 4\",\n",
+                u8"    \"esMX\": \"Sótano de la Torre Nivel 4\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第4階層\",\n",
+                u8"    \"ptBR\": \"Porão da Torre Nível 4\",\n",
+                u8"    \"ruRU\": \"Подвал башни: 4-й уровень\",\n",
+                u8"    \"zhCN\": \"高塔地窖四层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5033,\n",
+                u8"    \"Key\": \"Tower Cellar Level 3\",\n",
+                u8"    \"enUS\": \"Tower Cellar Level 3\",\n",
+                u8"    \"zhTW\": \"高塔地牢第三層\",\n",
+                u8"    \"deDE\": \"Turmkeller, Ebene 3\",\n",
+                u8"    \"esES\": \"Sótano de la Torre nivel 3\",\n",
+                u8"    \"frFR\": \"La Cave de la Tour niv. 3\",\n",
+                u8"    \"itIT\": \"Sotterraneo della Torre L3\",\n",
+                u8"    \"koKR\": \"탑 지하 3층\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 3\",\n",
+                u8"    \"esMX\": \"Sótano de la Torre Nivel 3\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第3階層\",\n",
+                u8"    \"ptBR\": \"Porão da Torre Nível 3\",\n",
+                u8"    \"ruRU\": \"Подвал башни: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"高塔地窖三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5034,\n",
+                u8"    \"Key\": \"Tower Cellar Level 2\",\n",
+                u8"    \"enUS\": \"Tower Cellar Level 2\",\n",
+                u8"    \"zhTW\": \"高塔地牢第二層\",\n",
+                u8"    \"deDE\": \"Turmkeller, Ebene 2\",\n",
+                u8"    \"esES\": \"Sótano de la Torre nivel 2\",\n",
+                u8"    \"frFR\": \"La Cave de la Tour niv. 2\",\n",
+                u8"    \"itIT\": \"Sotterraneo della Torre L2\",\n",
+                u8"    \"koKR\": \"탑 지하 2층\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 2\",\n",
+                u8"    \"esMX\": \"Sótano de la Torre Nivel 2\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第2階層\",\n",
+                u8"    \"ptBR\": \"Porão da Torre Nível 2\",\n",
+                u8"    \"ruRU\": \"Подвал башни: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"高塔地窖二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5035,\n",
+                u8"    \"Key\": \"Tower Cellar Level 1\",\n",
+                u8"    \"enUS\": \"Tower Cellar Level 1\",\n",
+                u8"    \"zhTW\": \"高塔地牢第一層\",\n",
+                u8"    \"deDE\": \"Turmkeller, Ebene 1\",\n",
+                u8"    \"esES\": \"Sótano de la Torre nivel 1\",\n",
+                u8"    \"frFR\": \"La Cave de la Tour niv. 1\",\n",
+                u8"    \"itIT\": \"Sotterraneo della Torre L1\",\n",
+                u8"    \"koKR\": \"탑 지하 1층\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 1\",\n",
+                u8"    \"esMX\": \"Sótano de la Torre Nivel 1\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第1階層\",\n",
+                u8"    \"ptBR\": \"Porão da Torre Nível 1\",\n",
+                u8"    \"ruRU\": \"Подвал башни: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"高塔地窖一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5036,\n",
+                u8"    \"Key\": \"Forgotten Tower\",\n",
+                u8"    \"enUS\": \"Forgotten Tower\",\n",
+                u8"    \"zhTW\": \"遺忘之塔\",\n",
+                u8"    \"deDE\": \"Vergessener Turm\",\n",
+                u8"    \"esES\": \"Torre Olvidada\",\n",
+                u8"    \"frFR\": \"La Tour oubliée\",\n",
+                u8"    \"itIT\": \"Torre Dimenticata\",\n",
+                u8"    \"koKR\": \"잊힌 탑\",\n",
+                u8"    \"plPL\": \"Zapomniana Wieża\",\n",
+                u8"    \"esMX\": \"Torre Olvidada\",\n",
+                u8"    \"jaJP\": \"忘れ去られし塔\",\n",
+                u8"    \"ptBR\": \"Torre Esquecida\",\n",
+                u8"    \"ruRU\": \"Заброшенная башня\",\n",
+                u8"    \"zhCN\": \"被遗忘的高塔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5037,\n",
+                u8"    \"Key\": \"Mausoleum\",\n",
+                u8"    \"enUS\": \"Mausoleum\",\n",
+                u8"    \"zhTW\": \"大陵墓\",\n",
+                u8"    \"deDE\": \"Mausoleum\",\n",
+                u8"    \"esES\": \"Mausoleo\",\n",
+                u8"    \"frFR\": \"Le Mausolée\",\n",
+                u8"    \"itIT\": \"Mausoleo\",\n",
+                u8"    \"koKR\": \"영묘\",\n",
+                u8"    \"plPL\": \"Mauzoleum\",\n",
+                u8"    \"esMX\": \"Mausoleo\",\n",
+                u8"    \"jaJP\": \"霊廟\",\n",
+                u8"    \"ptBR\": \"Mausoléu\",\n",
+                u8"    \"ruRU\": \"Мавзолей\",\n",
+                u8"    \"zhCN\": \"寝陵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5038,\n",
+                u8"    \"Key\": \"Crypt\",\n",
+                u8"    \"enUS\": \"Crypt\",\n",
+                u8"    \"zhTW\": \"墓地\",\n",
+                u8"    \"deDE\": \"Krypta\",\n",
+                u8"    \"esES\": \"Cripta\",\n",
+                u8"    \"frFR\": \"La Crypte\",\n",
+                u8"    \"itIT\": \"Cripta\",\n",
+                u8"    \"koKR\": \"묘실\",\n",
+                u8"    \"plPL\": \"Krypta\",\n",
+                u8"    \"esMX\": \"Cripta\",\n",
+                u8"    \"jaJP\": \"地下墓所\",\n",
+                u8"    \"ptBR\": \"Cripta\",\n",
+                u8"    \"ruRU\": \"Склеп\",\n",
+                u8"    \"zhCN\": \"墓穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5039,\n",
+                u8"    \"Key\": \"Burial Grounds\",\n",
+                u8"    \"enUS\": \"Burial Grounds\",\n",
+                u8"    \"zhTW\": \"埋骨之地\",\n",
+                u8"    \"deDE\": \"Friedhof\",\n",
+                u8"    \"esES\": \"Cementerio\",\n",
+                u8"    \"frFR\": \"Le Cimetière\",\n",
+                u8"    \"itIT\": \"Cimitero\",\n",
+                u8"    \"koKR\": \"매장지\",\n",
+                u8"    \"plPL\": \"Cmentarz\",\n",
+                u8"    \"esMX\": \"Cementerio\",\n",
+                u8"    \"jaJP\": \"墓地\",\n",
+                u8"    \"ptBR\": \"Cemitério\",\n",
+                u8"    \"ruRU\": \"Погост\",\n",
+                u8"    \"zhCN\": \"埋骨之地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5040,\n",
+                u8"    \"Key\": \"Pit Level 2\",\n",
+                u8"    \"enUS\": \"Pit Level 2\",\n",
+                u8"    \"zhTW\": \"地穴第二層\",\n",
+                u8"    \"deDE\": \"Grube, Ebene 2\",\n",
+                u8"    \"esES\": \"Foso nivel 2\",\n",
+                u8"    \"frFR\": \"La Fosse niv. 2\",\n",
+                u8"    \"itIT\": \"Abisso L2\",\n",
+                u8"    \"koKR\": \"구덩이 2층\",\n",
+                u8"    \"plPL\": \"Czeluść – Poziom 2\",\n",
+                u8"    \"esMX\": \"Foso Nivel 2\",\n",
+                u8"    \"jaJP\": \"穴ぐら: 第2階層\",\n",
+                u8"    \"ptBR\": \"Fosso Nível 2\",\n",
+                u8"    \"ruRU\": \"Яма: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"深坑二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5041,\n",
+                u8"    \"Key\": \"Hole Level 2\",\n",
+                u8"    \"enUS\": \"Hole Level 2\",\n",
+                u8"    \"zhTW\": \"地洞第二層\",\n",
+                u8"    \"deDE\": \"Loch, Ebene 2\",\n",
+                u8"    \"esES\": \"Hoyo nivel 2\",\n",
+                u8"    \"frFR\": \"Le Gouffre niv. 2\",\n",
+                u8"    \"itIT\": \"Buco L2\",\n",
+                u8"    \"koKR\": \"구렁 2층\",\n",
+                u8"    \"plPL\": \"Jama – Poziom 2\",\n",
+                u8"    \"esMX\": \"Agujero Nivel 2\",\n",
+                u8"    \"jaJP\": \"洞穴: 第2階層\",\n",
+                u8"    \"ptBR\": \"Buraco Nível 2\",\n",
+                u8"    \"ruRU\": \"Нора: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"洞坑二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5042,\n",
+                u8"    \"Key\": \"Underground Passage Level 2\",\n",
+                u8"    \"enUS\": \"Underground Passage Level 2\",\n",
+                u8"    \"zhTW\": \"地底通道第二層\",\n",
+                u8"    \"deDE\": \"Unterirdischer Durchgang, Ebene 2\",\n",
+                u8"    \"esES\": \"Pasadizo Subterráneo nivel 2\",\n",
+                u8"    \"frFR\": \"Le Passage souterrain niv. 2\",\n",
+                u8"    \"itIT\": \"Passaggio Sotterraneo L2\",\n",
+                u8"    \"koKR\": \"지하 통로 2층\",\n",
+                u8"    \"plPL\": \"Podziemny Tunel – Poziom 2\",\n",
+                u8"    \"esMX\": \"Pasaje Subterráneo Nivel 2\",\n",
+                u8"    \"jaJP\": \"地下道: 第2階層\",\n",
+                u8"    \"ptBR\": \"Passagem Subterrânea Nível 2\",\n",
+                u8"    \"ruRU\": \"Подземный проход: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"地下通道二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5043,\n",
+                u8"    \"Key\": \"Cave Level 2\",\n",
+                u8"    \"enUS\": \"Cave Level 2\",\n",
+                u8"    \"zhTW\": \"洞穴第二層  洞穴\",\n",
+                u8"    \"deDE\": \"Grotte, Ebene 2\",\n",
+                u8"    \"esES\": \"Cueva nivel 2\",\n",
+                u8"    \"frFR\": \"La Grotte niv. 2\",\n",
+                u8"    \"itIT\": \"Caverna L2\",\n",
+                u8"    \"koKR\": \"동굴 2층\",\n",
+                u8"    \"plPL\": \"Jaskinia – Poziom 2\",\n",
+                u8"    \"esMX\": \"Cueva Nivel 2\",\n",
+                u8"    \"jaJP\": \"洞窟: 第2階層\",\n",
+                u8"    \"ptBR\": \"Caverna Nível 2\",\n",
+                u8"    \"ruRU\": \"Пещера: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"洞穴二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5044,\n",
+                u8"    \"Key\": \"Pit Level 1\",\n",
+                u8"    \"enUS\": \"Pit Level 1\",\n",
+                u8"    \"zhTW\": \"地穴第一層\",\n",
+                u8"    \"deDE\": \"Grube, Ebene 1\",\n",
+                u8"    \"esES\": \"Foso nivel 1\",\n",
+                u8"    \"frFR\": \"La Fosse niv. 1\",\n",
+                u8"    \"itIT\": \"Abisso L1\",\n",
+                u8"    \"koKR\": \"구덩이 1층\",\n",
+                u8"    \"plPL\": \"Czeluść – Poziom 1\",\n",
+                u8"    \"esMX\": \"Foso Nivel 1\",\n",
+                u8"    \"jaJP\": \"穴ぐら: 第1階層\",\n",
+                u8"    \"ptBR\": \"Fosso Nível 1\",\n",
+                u8"    \"ruRU\": \"Яма: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"深坑一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5045,\n",
+                u8"    \"Key\": \"Hole Level 1\",\n",
+                u8"    \"enUS\": \"Hole Level 1\",\n",
+                u8"    \"zhTW\": \"地洞第一層\",\n",
+                u8"    \"deDE\": \"Loch, Ebene 1\",\n",
+                u8"    \"esES\": \"Hoyo nivel 1\",\n",
+                u8"    \"frFR\": \"Le Gouffre niv. 1\",\n",
+                u8"    \"itIT\": \"Buco L1\",\n",
+                u8"    \"koKR\": \"구렁 1층\",\n",
+                u8"    \"plPL\": \"Jama – Poziom 1\",\n",
+                u8"    \"esMX\": \"Agujero Nivel 1\",\n",
+                u8"    \"jaJP\": \"洞穴: 第1階層\",\n",
+                u8"    \"ptBR\": \"Buraco Nível 1\",\n",
+                u8"    \"ruRU\": \"Нора: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"洞坑一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5046,\n",
+                u8"    \"Key\": \"Underground Passage Level 1\",\n",
+                u8"    \"enUS\": \"Underground Passage Level 1\",\n",
+                u8"    \"zhTW\": \"地底通道第一層\",\n",
+                u8"    \"deDE\": \"Unterirdischer Durchgang, Ebene 1\",\n",
+                u8"    \"esES\": \"Pasadizo Subterráneo nivel 1\",\n",
+                u8"    \"frFR\": \"Le Passage souterrain niv. 1\",\n",
+                u8"    \"itIT\": \"Passaggio Sotterraneo L1\",\n",
+                u8"    \"koKR\": \"지하 통로 1층\",\n",
+                u8"    \"plPL\": \"Podziemny Tunel – Poziom 1\",\n",
+                u8"    \"esMX\": \"Pasaje Subterráneo Nivel 1\",\n",
+                u8"    \"jaJP\": \"地下道: 第1階層\",\n",
+                u8"    \"ptBR\": \"Passagem Subterrânea Nível 1\",\n",
+                u8"    \"ruRU\": \"Подземный проход: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"地下通道一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5047,\n",
+                u8"    \"Key\": \"Cave Level 1\",\n",
+                u8"    \"enUS\": \"Cave Level 1\",\n",
+                u8"    \"zhTW\": \"洞穴第一層\",\n",
+                u8"    \"deDE\": \"Grotte, Ebene 1\",\n",
+                u8"    \"esES\": \"Cueva nivel 1\",\n",
+                u8"    \"frFR\": \"La Grotte niv. 1\",\n",
+                u8"    \"itIT\": \"Caverna L1\",\n",
+                u8"    \"koKR\": \"동굴 1층\",\n",
+                u8"    \"plPL\": \"Jaskinia – Poziom 1\",\n",
+                u8"    \"esMX\": \"Cueva Nivel 1\",\n",
+                u8"    \"jaJP\": \"洞窟: 第1階層\",\n",
+                u8"    \"ptBR\": \"Caverna Nível 1\",\n",
+                u8"    \"ruRU\": \"Пещера: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"洞穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5048,\n",
+                u8"    \"Key\": \"Den of Evil\",\n",
+                u8"    \"enUS\": \"Den of Evil\",\n",
+                u8"    \"zhTW\": \"邪惡洞窟\",\n",
+                u8"    \"deDE\": \"Höhle des Bösen\",\n",
+                u8"    \"esES\": \"Cubil del Mal\",\n",
+                u8"    \"frFR\": \"Le Repaire du Mal\",\n",
+                u8"    \"itIT\": \"Antro del Male\",\n",
+                u8"    \"koKR\": \"악의 소굴\",\n",
+                u8"    \"plPL\": \"Siedlisko Zła\",\n",
+                u8"    \"esMX\": \"Guarida del Mal\",\n",
+                u8"    \"jaJP\": \"邪悪の巣窟\",\n",
+                u8"    \"ptBR\": \"Covil do Mal\",\n",
+                u8"    \"ruRU\": \"Логово зла\",\n",
+                u8"    \"zhCN\": \"邪恶洞穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5049,\n",
+                u8"    \"Key\": \"Tamoe Highland\",\n",
+                u8"    \"enUS\": \"Tamoe Highland\",\n",
+                u8"    \"zhTW\": \"泰摩高地\",\n",
+                u8"    \"deDE\": \"Tamohochland\",\n",
+                u8"    \"esES\": \"Tierras Altas de Tamoe\",\n",
+                u8"    \"frFR\": \"Les Hautes-Terres de Tamoe\",\n",
+                u8"    \"itIT\": \"Altopiano di Tamoe\",\n",
+                u8"    \"koKR\": \"타모 고원\",\n",
+                u8"    \"plPL\": \"Wyżyna Tamoe\",\n",
+                u8"    \"esMX\": \"Tierras Altas de Tamoe\",\n",
+                u8"    \"jaJP\": \"タモエ高原\",\n",
+                u8"    \"ptBR\": \"Planalto Tamoe\",\n",
+                u8"    \"ruRU\": \"Нагорье Тамоэ\",\n",
+                u8"    \"zhCN\": \"泰摩高地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5050,\n",
+                u8"    \"Key\": \"Black Marsh\",\n",
+                u8"    \"enUS\": \"Black Marsh\",\n",
+                u8"    \"zhTW\": \"黑色荒地\",\n",
+                u8"    \"deDE\": \"Schwarzmoor\",\n",
+                u8"    \"esES\": \"Pantano Negro\",\n",
+                u8"    \"frFR\": \"Le Marais sombre\",\n",
+                u8"    \"itIT\": \"Palude Nera\",\n",
+                u8"    \"koKR\": \"검은 습지\",\n",
+                u8"    \"plPL\": \"Czarne Moczary\",\n",
+                u8"    \"esMX\": \"Marisma Oscura\",\n",
+                u8"    \"jaJP\": \"黒の湿原\",\n",
+                u8"    \"ptBR\": \"Charco Tenebroso\",\n",
+                u8"    \"ruRU\": \"Черная топь\",\n",
+                u8"    \"zhCN\": \"黑色沼泽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5051,\n",
+                u8"    \"Key\": \"Dark Wood\",\n",
+                u8"    \"enUS\": \"Dark Wood\",\n",
+                u8"    \"zhTW\": \"黑暗森林\",\n",
+                u8"    \"deDE\": \"Dunkelwald\",\n",
+                u8"    \"esES\": \"Bosque Oscuro\",\n",
+                u8"    \"frFR\": \"Le Bois obscur\",\n",
+                u8"    \"itIT\": \"Foresta Oscura\",\n",
+                u8"    \"koKR\": \"어둠숲\",\n",
+                u8"    \"plPL\": \"Mroczna Knieja\",\n",
+                u8"    \"esMX\": \"Bosque Oscuro\",\n",
+                u8"    \"jaJP\": \"常闇の森\",\n",
+                u8"    \"ptBR\": \"Floresta Sombria\",\n",
+                u8"    \"ruRU\": \"Темнолесье\",\n",
+                u8"    \"zhCN\": \"黑暗森林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5052,\n",
+                u8"    \"Key\": \"Stony Field\",\n",
+                u8"    \"enUS\": \"Stony Field\",\n",
+                u8"    \"zhTW\": \"亂石曠野\",\n",
+                u8"    \"deDE\": \"Feld der Steine\",\n",
+                u8"    \"esES\": \"Campo Pedregoso\",\n",
+                u8"    \"frFR\": \"Le Champ de pierres\",\n",
+                u8"    \"itIT\": \"Campo di Pietra\",\n",
+                u8"    \"koKR\": \"바위 벌판\",\n",
+                u8"    \"plPL\": \"Kamienne Pole\",\n",
+                u8"    \"esMX\": \"Campo Rocoso\",\n",
+                u8"    \"jaJP\": \"石の原野\",\n",
+                u8"    \"ptBR\": \"Campo Rochoso\",\n",
+                u8"    \"ruRU\": \"Каменистое поле\",\n",
+                u8"    \"zhCN\": \"石块旷野\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5053,\n",
+                u8"    \"Key\": \"Cold Plains\",\n",
+                u8"    \"enUS\": \"Cold Plains\",\n",
+                u8"    \"zhTW\": \"冰冷之原\",\n",
+                u8"    \"deDE\": \"Kalte Ebene\",\n",
+                u8"    \"esES\": \"Llanuras Frías\",\n",
+                u8"    \"frFR\": \"Les Plaines gelées\",\n",
+                u8"    \"itIT\": \"Pianure Gelate\",\n",
+                u8"    \"koKR\": \"차가운 평야\",\n",
+                u8"    \"plPL\": \"Zimna Równina\",\n",
+                u8"    \"esMX\": \"Llanuras Heladas\",\n",
+                u8"    \"jaJP\": \"荒涼の平原\",\n",
+                u8"    \"ptBR\": \"Planície Gélida\",\n",
+                u8"    \"ruRU\": \"Стылые равнины\",\n",
+                u8"    \"zhCN\": \"冰冷之原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5054,\n",
+                u8"    \"Key\": \"Blood Moor\",\n",
+                u8"    \"enUS\": \"Blood Moor\",\n",
+                u8"    \"zhTW\": \"鮮血荒地\",\n",
+                u8"    \"deDE\": \"Blutmoor\",\n",
+                u8"    \"esES\": \"Landa de Sangre\",\n",
+                u8"    \"frFR\": \"La Lande sanglante\",\n",
+                u8"    \"itIT\": \"Lande Insanguinate\",\n",
+                u8"    \"koKR\": \"핏빛 황무지\",\n",
+                u8"    \"plPL\": \"Krwawe Wrzosowisko\",\n",
+                u8"    \"esMX\": \"Páramo Sangriento\",\n",
+                u8"    \"jaJP\": \"血の荒野\",\n",
+                u8"    \"ptBR\": \"Charco Sangrento\",\n",
+                u8"    \"ruRU\": \"Кровавая пустошь\",\n",
+                u8"    \"zhCN\": \"鲜血荒地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5055,\n",
+                u8"    \"Key\": \"Rogue Encampment\",\n",
+                u8"    \"enUS\": \"Rogue Encampment\",\n",
+                u8"    \"zhTW\": \"俠盜營地\",\n",
+                u8"    \"deDE\": \"Lager der Jägerinnen\",\n",
+                u8"    \"esES\": \"Campamento de las Arpías\",\n",
+                u8"    \"frFR\": \"Le Camp des Rogues\",\n",
+                u8"    \"itIT\": \"Campo delle Scolte\",\n",
+                u8"    \"koKR\": \"자매단 야영지\",\n",
+                u8"    \"plPL\": \"Obozowisko Łotrzyc\",\n",
+                u8"    \"esMX\": \"Campamento de Renegadas\",\n",
+                u8"    \"jaJP\": \"ローグの野営地\",\n",
+                u8"    \"ptBR\": \"Acampamento Renegado\",\n",
+                u8"    \"ruRU\": \"Лагерь разбойниц\",\n",
+                u8"    \"zhCN\": \"流亡者营地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5056,\n",
+                u8"    \"Key\": \"To Tristram\",\n",
+                u8"    \"enUS\": \"To Tristram\",\n",
+                u8"    \"zhTW\": \"前往崔斯特姆\",\n",
+                u8"    \"deDE\": \"Nach Tristram\",\n",
+                u8"    \"esES\": \"A Tristán\",\n",
+                u8"    \"frFR\": \"Vers Tristram\",\n",
+                u8"    \"itIT\": \"Per Tristram\",\n",
+                u8"    \"koKR\": \"트리스트럼으로 이동\",\n",
+                u8"    \"plPL\": \"Tristram\",\n",
+                u8"    \"esMX\": \"A Tristram\",\n",
+                u8"    \"jaJP\": \"トリストラムへ\",\n",
+                u8"    \"ptBR\": \"Para Tristram\",\n",
+                u8"    \"ruRU\": \"В Тристрам\",\n",
+                u8"    \"zhCN\": \"前往崔斯特姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5057,\n",
+                u8"    \"Key\": \"To The Catacombs Level 4\",\n",
+                u8"    \"enUS\": \"To The Catacombs Level 4\",\n",
+                u8"    \"zhTW\": \"前往地下墓穴第四層\",\n",
+                u8"    \"deDE\": \"Zu den Katakomben, Ebene 4\",\n",
+                u8"    \"esES\": \"Al nivel 4 de las Catacumbas\",\n",
+                u8"    \"frFR\": \"Vers les Catacombes niv. 4\",\n",
+                u8"    \"itIT\": \"Per le Catacombe L4\",\n",
+                u8"    \"koKR\": \"지하 묘지 4층으로 이동\",\n",
+                u8"    \"plPL\": \"Katakumby – Poziom 4\",\n",
+                u8"    \"esMX\": \"A las Catacumbas Nivel 4\",\n",
+                u8"    \"jaJP\": \"地下墓地: 第4階層へ\",\n",
+                u8"    \"ptBR\": \"Para as Catacumbas Nível 4\",\n",
+                u8"    \"ruRU\": \"На 4-й уровень катакомб\",\n",
+                u8"    \"zhCN\": \"前往地下墓穴四层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5058,\n",
+                u8"    \"Key\": \"To The Catacombs Level 3\",\n",
+                u8"    \"enUS\": \"To The Catacombs Level 3\",\n",
+                u8"    \"zhTW\": \"前往地下墓穴第三層\",\n",
+                u8"    \"deDE\": \"Zu den Katakomben, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 de las Catacumbas\",\n",
+                u8"    \"frFR\": \"Vers les Catacombes niv. 3\",\n",
+                u8"    \"itIT\": \"Per le Catacombe L3\",\n",
+                u8"    \"koKR\": \"지하 묘지 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Katakumby – Poziom 3\",\n",
+                u8"    \"esMX\": \"A las Catacumbas Nivel 3\",\n",
+                u8"    \"jaJP\": \"地下墓地: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para as Catacumbas Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень катакомб\",\n",
+                u8"    \"zhCN\": \"前往地下墓穴三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5059,\n",
+                u8"    \"Key\": \"To The Catacombs Level 2\",\n",
+                u8"    \"enUS\": \"To The Catacombs Level 2\",\n",
+                u8"    \"zhTW\": \"前往地下墓穴第二層\",\n",
+                u8"    \"deDE\": \"Zu den Katakomben, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 de las Catacumbas\",\n",
+                u8"    \"frFR\": \"Vers les Catacombes niv. 2\",\n",
+                u8"    \"itIT\": \"Per le Catacombe L2\",\n",
+                u8"    \"koKR\": \"지하 묘지 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Katakumby – Poziom 2\",\n",
+                u8"    \"esMX\": \"A las Catacumbas Nivel 2\",\n",
+                u8"    \"jaJP\": \"地下墓地: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para as Catacumbas Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень катакомб\",\n",
+                u8"    \"zhCN\": \"前往地下墓穴二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5060,\n",
+                u8"    \"Key\": \"To The Catacombs Level 1\",\n",
+                u8"    \"enUS\": \"To The Catacombs Level 1\",\n",
+                u8"    \"zhTW\": \"前往地下墓穴第一層\",\n",
+                u8"    \"deDE\": \"Zu den Katakomben, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 de las Catacumbas\",\n",
+                u8"    \"frFR\": \"Vers les Catacombes niv. 1\",\n",
+                u8"    \"itIT\": \"Per le Catacombe L1\",\n",
+                u8"    \"koKR\": \"지하 묘지 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Katakumby – Poziom 1\",\n",
+                u8"    \"esMX\": \"A las Catacumbas Nivel 1\",\n",
+                u8"    \"jaJP\": \"地下墓地: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para as Catacumbas Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень катакомб\",\n",
+                u8"    \"zhCN\": \"前往地下墓穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5061,\n",
+                u8"    \"Key\": \"To The Cathedral\",\n",
+                u8"    \"enUS\": \"To The Cathedral\",\n",
+                u8"    \"zhTW\": \"前往大教堂\",\n",
+                u8"    \"deDE\": \"Zur Kathedrale\",\n",
+                u8"    \"esES\": \"A la Catedral\",\n",
+                u8"    \"frFR\": \"Vers la Cathédrale\",\n",
+                u8"    \"itIT\": \"Per la Cattedrale\",\n",
+                u8"    \"koKR\": \"대성당으로 이동\",\n",
+                u8"    \"plPL\": \"Katedra\",\n",
+                u8"    \"esMX\": \"A la Catedral\",\n",
+                u8"    \"jaJP\": \"大聖堂へ\",\n",
+                u8"    \"ptBR\": \"Para a Catedral\",\n",
+                u8"    \"ruRU\": \"Собор\",\n",
+                u8"    \"zhCN\": \"前往大教堂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5062,\n",
+                u8"    \"Key\": \"To The Inner Cloister\",\n",
+                u8"    \"enUS\": \"To The Inner Cloister\",\n",
+                u8"    \"zhTW\": \"前往內側迴廊\",\n",
+                u8"    \"deDE\": \"Zum inneren Kloster\",\n",
+                u8"    \"esES\": \"Al Claustro Interior\",\n",
+                u8"    \"frFR\": \"Vers le Cloître intérieur\",\n",
+                u8"    \"itIT\": \"Per il Chiostro Interno\",\n",
+                u8"    \"koKR\": \"내부 회랑으로 이동\",\n",
+                u8"    \"plPL\": \"Wewnętrzny Monastyr\",\n",
+                u8"    \"esMX\": \"Al Claustro Interno\",\n",
+                u8"    \"jaJP\": \"修道院内部へ\",\n",
+                u8"    \"ptBR\": \"Para o Claustro Interno\",\n",
+                u8"    \"ruRU\": \"Во внутренний двор\",\n",
+                u8"    \"zhCN\": \"前往内侧回廊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5063,\n",
+                u8"    \"Key\": \"To The Jail Level 3\",\n",
+                u8"    \"enUS\": \"To The Jail Level 3\",\n",
+                u8"    \"zhTW\": \"前往監牢第三層\",\n",
+                u8"    \"deDE\": \"Zum Gefängnis, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 de la Cárcel\",\n",
+                u8"    \"frFR\": \"Vers la Prison niv. 3\",\n",
+                u8"    \"itIT\": \"Per la Prigione L3\",\n",
+                u8"    \"koKR\": \"감옥 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Więzienie – Poziom 3\",\n",
+                u8"    \"esMX\": \"A la Prisión Nivel 3\",\n",
+                u8"    \"jaJP\": \"牢獄: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Prisão Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень тюрьмы\",\n",
+                u8"    \"zhCN\": \"前往监牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5064,\n",
+                u8"    \"Key\": \"To The Jail Level 2\",\n",
+                u8"    \"enUS\": \"To The Jail Level 2\",\n",
+                u8"    \"zhTW\": \"前往監牢第二層\",\n",
+                u8"    \"deDE\": \"Zum Gefängnis, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 de la Cárcel\",\n",
+                u8"    \"frFR\": \"Vers la Prison niv. 2\",\n",
+                u8"    \"itIT\": \"Per la Prigione L2\",\n",
+                u8"    \"koKR\": \"감옥 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Więzienie – Poziom 2\",\n",
+                u8"    \"esMX\": \"A la Prisión Nivel 2\",\n",
+                u8"    \"jaJP\": \"牢獄: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Prisão Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень тюрьмы\",\n",
+                u8"    \"zhCN\": \"前往监牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5065,\n",
+                u8"    \"Key\": \"To The Jail Level 1\",\n",
+                u8"    \"enUS\": \"To The Jail Level 1\",\n",
+                u8"    \"zhTW\": \"前往監牢第一層\",\n",
+                u8"    \"deDE\": \"Zum Gefängnis, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 de la Cárcel\",\n",
+                u8"    \"frFR\": \"Vers la Prison niv. 1\",\n",
+                u8"    \"itIT\": \"Per la Prigione L1\",\n",
+                u8"    \"koKR\": \"감옥 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Więzienie – Poziom 1\",\n",
+                u8"    \"esMX\": \"A la Prisión Nivel 1\",\n",
+                u8"    \"jaJP\": \"牢獄: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Prisão Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень тюрьмы\",\n",
+                u8"    \"zhCN\": \"前往监牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5066,\n",
+                u8"    \"Key\": \"To The Barracks\",\n",
+                u8"    \"enUS\": \"To The Barracks\",\n",
+                u8"    \"zhTW\": \"前往兵營\",\n",
+                u8"    \"deDE\": \"Zur Kaserne\",\n",
+                u8"    \"esES\": \"A los Barracones\",\n",
+                u8"    \"frFR\": \"Vers la Caserne\",\n",
+                u8"    \"itIT\": \"Per la Caserma\",\n",
+                u8"    \"koKR\": \"병영으로 이동\",\n",
+                u8"    \"plPL\": \"Koszary\",\n",
+                u8"    \"esMX\": \"Al Cuartel\",\n",
+                u8"    \"jaJP\": \"兵舎へ\",\n",
+                u8"    \"ptBR\": \"Para o Quartel\",\n",
+                u8"    \"ruRU\": \"В Казармы.\",\n",
+                u8"    \"zhCN\": \"前往营房\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5067,\n",
+                u8"    \"Key\": \"To The Outer Cloister\",\n",
+                u8"    \"enUS\": \"To The Outer Cloister\",\n",
+                u8"    \"zhTW\": \"前往外側迴廊\",\n",
+                u8"    \"deDE\": \"Zum äußeren Kloster\",\n",
+                u8"    \"esES\": \"Al Claustro Exterior\",\n",
+                u8"    \"frFR\": \"Vers le Cloître extérieur\",\n",
+                u8"    \"itIT\": \"Per il Chiostro Esterno\",\n",
+                u8"    \"koKR\": \"외부 회랑으로 이동\",\n",
+                u8"    \"plPL\": \"Zewnętrzny Monastyr\",\n",
+                u8"    \"esMX\": \"Al Claustro Exterior\",\n",
+                u8"    \"jaJP\": \"修道院外部へ\",\n",
+                u8"    \"ptBR\": \"Para o Claustro Externo\",\n",
+                u8"    \"ruRU\": \"Во внешний двор\",\n",
+                u8"    \"zhCN\": \"前往外侧回廊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5068,\n",
+                u8"    \"Key\": \"To The Monastery Gate\",\n",
+                u8"    \"enUS\": \"To The Monastery Gate\",\n",
+                u8"    \"zhTW\": \"前往修道院大門\",\n",
+                u8"    \"deDE\": \"Zur Klosterpforte\",\n",
+                u8"    \"esES\": \"A las Puertas del Monasterio\",\n",
+                u8"    \"frFR\": \"Vers les Portes du Monastère\",\n",
+                u8"    \"itIT\": \"Per l'Atrio del Monastero\",\n",
+                u8"    \"koKR\": \"수도원 정문으로 이동\",\n",
+                u8"    \"plPL\": \"Klasztorna Brama\",\n",
+                u8"    \"esMX\": \"A la Entrada del Monasterio\",\n",
+                u8"    \"jaJP\": \"修道院の門へ\",\n",
+                u8"    \"ptBR\": \"Para o Portão do Monastério\",\n",
+                u8"    \"ruRU\": \"К монастырским воротам\",\n",
+                u8"    \"zhCN\": \"前往修道院大门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5069,\n",
+                u8"    \"Key\": \"To The Tower Cellar Level 5\",\n",
+                u8"    \"enUS\": \"To The Tower Cellar Level 5\",\n",
+                u8"    \"zhTW\": \"前往高塔地牢第五層\",\n",
+                u8"    \"deDE\": \"Zum Turmkeller, Ebene 5\",\n",
+                u8"    \"esES\": \"Al nivel 5 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Vers la Cave de la Tour niv. 5\",\n",
+                u8"    \"itIT\": \"Per il Sotterraneo della Torre L5\",\n",
+                u8"    \"koKR\": \"탑 지하 5층으로 이동\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 5\",\n",
+                u8"    \"esMX\": \"Al Sótano de la Torre Nivel 5\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第5階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Porão da Torre Nível 5\",\n",
+                u8"    \"ruRU\": \"На 5-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"前往高塔地窖五层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5070,\n",
+                u8"    \"Key\": \"To The Tower Cellar Level 4\",\n",
+                u8"    \"enUS\": \"To The Tower Cellar Level 4\",\n",
+                u8"    \"zhTW\": \"前往高塔地牢第四層\",\n",
+                u8"    \"deDE\": \"Zum Turmkeller, Ebene 4\",\n",
+                u8"    \"esES\": \"Al nivel 4 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Vers la Cave de la Tour niv. 4\",\n",
+                u8"    \"itIT\": \"Per il Sotterraneo della Torre L4\",\n",
+                u8"    \"koKR\": \"탑 지하 4층으로 이동\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 4\",\n",
+                u8"    \"esMX\": \"Al Sótano de la Torre Nivel 4\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第4階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Porão da Torre Nível 4\",\n",
+                u8"    \"ruRU\": \"На 4-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"前往高塔地窖四层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5071,\n",
+                u8"    \"Key\": \"To The Tower Cellar Level 3\",\n",
+                u8"    \"enUS\": \"To The Tower Cellar Level 3\",\n",
+                u8"    \"zhTW\": \"前往高塔地牢第三層\",\n",
+                u8"    \"deDE\": \"Zum Turmkeller, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Vers la Cave de la Tour niv. 3\",\n",
+                u8"    \"itIT\": \"Per il Sotterraneo della Torre L3\",\n",
+                u8"    \"koKR\": \"탑 지하 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 3\",\n",
+                u8"    \"esMX\": \"Al Sótano de la Torre Nivel 3\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Porão da Torre Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"前往高塔地窖三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5072,\n",
+                u8"    \"Key\": \"To The Tower Cellar Level 2\",\n",
+                u8"    \"enUS\": \"To The Tower Cellar Level 2\",\n",
+                u8"    \"zhTW\": \"前往高塔地牢第二層\",\n",
+                u8"    \"deDE\": \"Zum Turmkeller, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Vers la Cave de la Tour niv. 2\",\n",
+                u8"    \"itIT\": \"Per il Sotterraneo della Torre L2\",\n",
+                u8"    \"koKR\": \"탑 지하 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 2\",\n",
+                u8"    \"esMX\": \"Al Sótano de la Torre Nivel 2\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Porão da Torre Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"前往高塔地窖二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5073,\n",
+                u8"    \"Key\": \"To The Tower Cellar Level 1\",\n",
+                u8"    \"enUS\": \"To The Tower Cellar Level 1\",\n",
+                u8"    \"zhTW\": \"前往高塔地牢第一層\",\n",
+                u8"    \"deDE\": \"Zum Turmkeller, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Vers la Cave de la Tour niv. 1\",\n",
+                u8"    \"itIT\": \"Per il Sotterraneo della Torre L1\",\n",
+                u8"    \"koKR\": \"탑 지하 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Piwnice pod Wieżą – Poziom 1\",\n",
+                u8"    \"esMX\": \"Al Sótano de la Torre Nivel 1\",\n",
+                u8"    \"jaJP\": \"塔の地下室: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Porão da Torre Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"前往高塔地窖一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5074,\n",
+                u8"    \"Key\": \"To The Forgotten Tower\",\n",
+                u8"    \"enUS\": \"To The Forgotten Tower\",\n",
+                u8"    \"zhTW\": \"前往遺忘之塔\",\n",
+                u8"    \"deDE\": \"Zum vergessenen Turm\",\n",
+                u8"    \"esES\": \"A la Torre Olvidada\",\n",
+                u8"    \"frFR\": \"Vers la Tour oubliée\",\n",
+                u8"    \"itIT\": \"Per la Torre Dimenticata\",\n",
+                u8"    \"koKR\": \"잊힌 탑으로 이동\",\n",
+                u8"    \"plPL\": \"Zapomniana Wieża\",\n",
+                u8"    \"esMX\": \"A la Torre Olvidada\",\n",
+                u8"    \"jaJP\": \"忘れ去られし塔へ\",\n",
+                u8"    \"ptBR\": \"Para a Torre Esquecida\",\n",
+                u8"    \"ruRU\": \"В Заброшенную башню\",\n",
+                u8"    \"zhCN\": \"前往被遗忘的高塔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5075,\n",
+                u8"    \"Key\": \"To The Mausoleum\",\n",
+                u8"    \"enUS\": \"To The Mausoleum\",\n",
+                u8"    \"zhTW\": \"前往大陵墓\",\n",
+                u8"    \"deDE\": \"Zum Mausoleum\",\n",
+                u8"    \"esES\": \"Al Mausoleo\",\n",
+                u8"    \"frFR\": \"Vers le Mausolée\",\n",
+                u8"    \"itIT\": \"Per il Mausoleo\",\n",
+                u8"    \"koKR\": \"영묘로 이동\",\n",
+                u8"    \"plPL\": \"Mauzoleum\",\n",
+                u8"    \"esMX\": \"Al Mausoleo\",\n",
+                u8"    \"jaJP\": \"霊廟へ\",\n",
+                u8"    \"ptBR\": \"Para o Mausoléu\",\n",
+                u8"    \"ruRU\": \"В мавзолей\",\n",
+                u8"    \"zhCN\": \"前往寝陵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5076,\n",
+                u8"    \"Key\": \"To The Crypt\",\n",
+                u8"    \"enUS\": \"To The Crypt\",\n",
+                u8"    \"zhTW\": \"前往墓地\",\n",
+                u8"    \"deDE\": \"Zur Krypta\",\n",
+                u8"    \"esES\": \"A la Cripta\",\n",
+                u8"    \"frFR\": \"Vers la Crypte\",\n",
+                u8"    \"itIT\": \"Per la Cripta\",\n",
+                u8"    \"koKR\": \"묘실로 이동\",\n",
+                u8"    \"plPL\": \"Krypta\",\n",
+                u8"    \"esMX\": \"A la Cripta\",\n",
+                u8"    \"jaJP\": \"地下墓所へ\",\n",
+                u8"    \"ptBR\": \"Para a Cripta\",\n",
+                u8"    \"ruRU\": \"В склеп\",\n",
+                u8"    \"zhCN\": \"前往墓穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5077,\n",
+                u8"    \"Key\": \"To The Burial Grounds\",\n",
+                u8"    \"enUS\": \"To The Burial Grounds\",\n",
+                u8"    \"zhTW\": \"前往埋骨之地\",\n",
+                u8"    \"deDE\": \"Zum Friedhof\",\n",
+                u8"    \"esES\": \"Al Cementerio\",\n",
+                u8"    \"frFR\": \"Vers le Cimetière\",\n",
+                u8"    \"itIT\": \"Per il Cimitero\",\n",
+                u8"    \"koKR\": \"매장지로 이동\",\n",
+                u8"    \"plPL\": \"Cmentarz\",\n",
+                u8"    \"esMX\": \"Al Cementerio\",\n",
+                u8"    \"jaJP\": \"墓地へ\",\n",
+                u8"    \"ptBR\": \"Para o Cemitério\",\n",
+                u8"    \"ruRU\": \"На Погост\",\n",
+                u8"    \"zhCN\": \"前往埋骨之地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5078,\n",
+                u8"    \"Key\": \"To The Pit Level 2\",\n",
+                u8"    \"enUS\": \"To The Pit Level 2\",\n",
+                u8"    \"zhTW\": \"前往地穴第二層\",\n",
+                u8"    \"deDE\": \"Zur Grube, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 del Foso\",\n",
+                u8"    \"frFR\": \"Vers la Fosse niv. 2\",\n",
+                u8"    \"itIT\": \"Per l'Abisso L2\",\n",
+                u8"    \"koKR\": \"구덩이 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Czeluść – Poziom 2\",\n",
+                u8"    \"esMX\": \"Al Foso Nivel 2\",\n",
+                u8"    \"jaJP\": \"穴ぐら: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Fosso Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень ямы\",\n",
+                u8"    \"zhCN\": \"前往深渊二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5079,\n",
+                u8"    \"Key\": \"To The Hole Level 2\",\n",
+                u8"    \"enUS\": \"To The Hole Level 2\",\n",
+                u8"    \"zhTW\": \"前往地洞第二層\",\n",
+                u8"    \"deDE\": \"Zum Loch, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 del Hoyo\",\n",
+                u8"    \"frFR\": \"Vers le Gouffre niv. 2\",\n",
+                u8"    \"itIT\": \"Per il Buco L2\",\n",
+                u8"    \"koKR\": \"구렁 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Jama – Poziom 2\",\n",
+                u8"    \"esMX\": \"Al Agujero Nivel 2\",\n",
+                u8"    \"jaJP\": \"洞穴: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Buraco Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень норы\",\n",
+                u8"    \"zhCN\": \"前往洞坑二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5080,\n",
+                u8"    \"Key\": \"To Underground Passage Level 2\",\n",
+                u8"    \"enUS\": \"To Underground Passage Level 2\",\n",
+                u8"    \"zhTW\": \"前往地底通道第二層\",\n",
+                u8"    \"deDE\": \"Zum Unterirdischen Durchgang, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 del Pasadizo Subterráneo\",\n",
+                u8"    \"frFR\": \"Vers le Passage souterrain niv. 2\",\n",
+                u8"    \"itIT\": \"Per il Passaggio Sotterraneo L2\",\n",
+                u8"    \"koKR\": \"지하 통로 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Podziemny Tunel – Poziom 2\",\n",
+                u8"    \"esMX\": \"Al Pasaje Subterráneo Nivel 2\",\n",
+                u8"    \"jaJP\": \"地下道: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Passagem Subterrânea Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень подземного прохода\",\n",
+                u8"    \"zhCN\": \"前往地下通道二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5081,\n",
+                u8"    \"Key\": \"To The Cave Level 2\",\n",
+                u8"    \"enUS\": \"To The Cave Level 2\",\n",
+                u8"    \"zhTW\": \"前往洞穴第二層\",\n",
+                u8"    \"deDE\": \"Zur Grotte, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 de la Cueva\",\n",
+                u8"    \"frFR\": \"Vers la Grotte niv. 2\",\n",
+                u8"    \"itIT\": \"Per la Caverna L2\",\n",
+                u8"    \"koKR\": \"동굴 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Jaskinia – Poziom 2\",\n",
+                u8"    \"esMX\": \"A la Cueva Nivel 2\",\n",
+                u8"    \"jaJP\": \"洞窟: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Caverna Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень пещеры\",\n",
+                u8"    \"zhCN\": \"前往洞穴二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5082,\n",
+                u8"    \"Key\": \"To The Pit Level 1\",\n",
+                u8"    \"enUS\": \"To The Pit Level 1\",\n",
+                u8"    \"zhTW\": \"前往地穴第一層\",\n",
+                u8"    \"deDE\": \"Zur Grube, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 del Foso\",\n",
+                u8"    \"frFR\": \"Vers la Fosse niv. 1\",\n",
+                u8"    \"itIT\": \"Per l'Abisso L1\",\n",
+                u8"    \"koKR\": \"구덩이 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Czeluść – Poziom 1\",\n",
+                u8"    \"esMX\": \"Al Foso Nivel 1\",\n",
+                u8"    \"jaJP\": \"穴ぐら: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Fosso Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень ямы\",\n",
+                u8"    \"zhCN\": \"前往深渊一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5083,\n",
+                u8"    \"Key\": \"To The Hole Level 1\",\n",
+                u8"    \"enUS\": \"To The Hole Level 1\",\n",
+                u8"    \"zhTW\": \"前往地洞第一層\",\n",
+                u8"    \"deDE\": \"Zum Loch, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 del Hoyo\",\n",
+                u8"    \"frFR\": \"Ver le Gouffre niv. 1\",\n",
+                u8"    \"itIT\": \"Per il Buco L1\",\n",
+                u8"    \"koKR\": \"구렁 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Jama – Poziom 1\",\n",
+                u8"    \"esMX\": \"Al Agujero Nivel 1\",\n",
+                u8"    \"jaJP\": \"洞穴: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Buraco Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень норы\",\n",
+                u8"    \"zhCN\": \"前往洞坑一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5084,\n",
+                u8"    \"Key\": \"To Underground Passage Level 1\",\n",
+                u8"    \"enUS\": \"To Underground Passage Level 1\",\n",
+                u8"    \"zhTW\": \"前往地底通道第一層\",\n",
+                u8"    \"deDE\": \"Zum Unterirdischen Durchgang, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 del Pasadizo Subterráneo\",\n",
+                u8"    \"frFR\": \"Vers le Passage souterrain niv. 1\",\n",
+                u8"    \"itIT\": \"Per il Passaggio Sotterraneo L1\",\n",
+                u8"    \"koKR\": \"지하 통로 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Podziemny Tunel – Poziom 1\",\n",
+                u8"    \"esMX\": \"Al Pasaje Subterráneo Nivel 1\",\n",
+                u8"    \"jaJP\": \"地下道: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Passagem Subterrânea Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень подземного прохода\",\n",
+                u8"    \"zhCN\": \"前往地下通道一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5085,\n",
+                u8"    \"Key\": \"To The Cave Level 1\",\n",
+                u8"    \"enUS\": \"To The Cave Level 1\",\n",
+                u8"    \"zhTW\": \"前往洞穴第一層\",\n",
+                u8"    \"deDE\": \"Zur Grotte, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 de la Cueva\",\n",
+                u8"    \"frFR\": \"Vers la Grotte niv. 1\",\n",
+                u8"    \"itIT\": \"Per la Caverna L1\",\n",
+                u8"    \"koKR\": \"동굴 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Jaskinia – Poziom 1\",\n",
+                u8"    \"esMX\": \"A la Cueva Nivel 1\",\n",
+                u8"    \"jaJP\": \"洞窟: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para a Caverna Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень пещеры\",\n",
+                u8"    \"zhCN\": \"前往洞穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5086,\n",
+                u8"    \"Key\": \"To The Den of Evil\",\n",
+                u8"    \"enUS\": \"To The Den of Evil\",\n",
+                u8"    \"zhTW\": \"前往邪惡洞窟\",\n",
+                u8"    \"deDE\": \"Zur Höhle des Bösen\",\n",
+                u8"    \"esES\": \"Al Cubil del Mal\",\n",
+                u8"    \"frFR\": \"Vers le Repaire du Mal\",\n",
+                u8"    \"itIT\": \"Per l'Antro del Male\",\n",
+                u8"    \"koKR\": \"악의 소굴로 이동\",\n",
+                u8"    \"plPL\": \"Siedlisko Zła\",\n",
+                u8"    \"esMX\": \"A la Guarida del Mal\",\n",
+                u8"    \"jaJP\": \"邪悪の巣窟へ\",\n",
+                u8"    \"ptBR\": \"Para o Covil do Mal\",\n",
+                u8"    \"ruRU\": \"В Логово зла\",\n",
+                u8"    \"zhCN\": \"前往邪恶洞穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5087,\n",
+                u8"    \"Key\": \"To The Tamoe Highland\",\n",
+                u8"    \"enUS\": \"To The Tamoe Highland\",\n",
+                u8"    \"zhTW\": \"前往泰摩高地\",\n",
+                u8"    \"deDE\": \"Zum Tamohochland\",\n",
+                u8"    \"esES\": \"A las Tierras Altas de Tamoe\",\n",
+                u8"    \"frFR\": \"Vers les Hautes-Terres de Tamoe\",\n",
+                u8"    \"itIT\": \"Per l'Altopiano di Tamoe\",\n",
+                u8"    \"koKR\": \"타모 고원으로 이동\",\n",
+                u8"    \"plPL\": \"Wyżyna Tamoe\",\n",
+                u8"    \"esMX\": \"A las Tierras Altas de Tamoe\",\n",
+                u8"    \"jaJP\": \"タモエ高原へ\",\n",
+                u8"    \"ptBR\": \"Para o Planalto Tamoe\",\n",
+                u8"    \"ruRU\": \"На нагорье Тамоэ\",\n",
+                u8"    \"zhCN\": \"前往泰摩高地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5088,\n",
+                u8"    \"Key\": \"To The Black Marsh\",\n",
+                u8"    \"enUS\": \"To The Black Marsh\",\n",
+                u8"    \"zhTW\": \"前往黑色荒地\",\n",
+                u8"    \"deDE\": \"Zum Schwarzmoor\",\n",
+                u8"    \"esES\": \"Al Pantano Negro\",\n",
+                u8"    \"frFR\": \"Vers le Marais sombre\",\n",
+                u8"    \"itIT\": \"Per la Palude Nera\",\n",
+                u8"    \"koKR\": \"검은 습지로 이동\",\n",
+                u8"    \"plPL\": \"Czarne Moczary\",\n",
+                u8"    \"esMX\": \"A la Marisma Oscura\",\n",
+                u8"    \"jaJP\": \"黒の湿原へ\",\n",
+                u8"    \"ptBR\": \"Para o Charco Tenebroso\",\n",
+                u8"    \"ruRU\": \"В Черную топь\",\n",
+                u8"    \"zhCN\": \"前往黑色沼泽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5089,\n",
+                u8"    \"Key\": \"To The Dark Wood\",\n",
+                u8"    \"enUS\": \"To The Dark Wood\",\n",
+                u8"    \"zhTW\": \"前往黑暗森林\",\n",
+                u8"    \"deDE\": \"Zum Dunkelwald\",\n",
+                u8"    \"esES\": \"Al Bosque Oscuro\",\n",
+                u8"    \"frFR\": \"Vers le Bois obscur\",\n",
+                u8"    \"itIT\": \"Per la Foresta Oscura\",\n",
+                u8"    \"koKR\": \"어둠숲으로 이동\",\n",
+                u8"    \"plPL\": \"Mroczna Knieja\",\n",
+                u8"    \"esMX\": \"Al Bosque Oscuro\",\n",
+                u8"    \"jaJP\": \"常闇の森へ\",\n",
+                u8"    \"ptBR\": \"Para a Floresta Sombria\",\n",
+                u8"    \"ruRU\": \"В Темнолесье\",\n",
+                u8"    \"zhCN\": \"前往黑暗森林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5090,\n",
+                u8"    \"Key\": \"To The Stony Field\",\n",
+                u8"    \"enUS\": \"To The Stony Field\",\n",
+                u8"    \"zhTW\": \"前往亂石曠野\",\n",
+                u8"    \"deDE\": \"Zum Feld der Steine\",\n",
+                u8"    \"esES\": \"Al Campo Pedregoso\",\n",
+                u8"    \"frFR\": \"Vers le Champ de pierres\",\n",
+                u8"    \"itIT\": \"Per il Campo di Pietra\",\n",
+                u8"    \"koKR\": \"바위 벌판으로 이동\",\n",
+                u8"    \"plPL\": \"Kamienne Pole\",\n",
+                u8"    \"esMX\": \"Al Campo Rocoso\",\n",
+                u8"    \"jaJP\": \"石の原野へ\",\n",
+                u8"    \"ptBR\": \"Para o Campo Rochoso\",\n",
+                u8"    \"ruRU\": \"В Каменистое поле\",\n",
+                u8"    \"zhCN\": \"前往石块旷野\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5091,\n",
+                u8"    \"Key\": \"To The Cold Plains\",\n",
+                u8"    \"enUS\": \"To The Cold Plains\",\n",
+                u8"    \"zhTW\": \"前往冰冷之原\",\n",
+                u8"    \"deDE\": \"Zur kalten Ebene\",\n",
+                u8"    \"esES\": \"A las Llanuras Frías\",\n",
+                u8"    \"frFR\": \"Vers les Plaines gelées\",\n",
+                u8"    \"itIT\": \"Per le Pianure Gelate\",\n",
+                u8"    \"koKR\": \"차가운 평야로 이동\",\n",
+                u8"    \"plPL\": \"Zimna Równina\",\n",
+                u8"    \"esMX\": \"A las Llanuras Heladas\",\n",
+                u8"    \"jaJP\": \"荒涼の平原へ\",\n",
+                u8"    \"ptBR\": \"Para a Planície Gélida\",\n",
+                u8"    \"ruRU\": \"В Стылые равнины\",\n",
+                u8"    \"zhCN\": \"前往冰冷之原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5092,\n",
+                u8"    \"Key\": \"To The Blood Moor\",\n",
+                u8"    \"enUS\": \"To The Blood Moor\",\n",
+                u8"    \"zhTW\": \"前往鮮血荒地\",\n",
+                u8"    \"deDE\": \"Zum Blutmoor\",\n",
+                u8"    \"esES\": \"A la Landa de Sangre\",\n",
+                u8"    \"frFR\": \"Vers la Lande sanglante\",\n",
+                u8"    \"itIT\": \"Per le Lande Insanguinate\",\n",
+                u8"    \"koKR\": \"핏빛 황무지로 이동\",\n",
+                u8"    \"plPL\": \"Krwawe Wrzosowisko\",\n",
+                u8"    \"esMX\": \"Al Páramo Sangriento\",\n",
+                u8"    \"jaJP\": \"血の荒野へ\",\n",
+                u8"    \"ptBR\": \"Para o Charco Sangrento\",\n",
+                u8"    \"ruRU\": \"В Кровавую пустошь\",\n",
+                u8"    \"zhCN\": \"前往鲜血荒地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 5093,\n",
+                u8"    \"Key\": \"To The Rogue Encampment\",\n",
+                u8"    \"enUS\": \"To The Rogue Encampment\",\n",
+                u8"    \"zhTW\": \"前往俠盜營地\",\n",
+                u8"    \"deDE\": \"Zum Lager der Jägerinnen\",\n",
+                u8"    \"esES\": \"Al Campamento de las Arpías\",\n",
+                u8"    \"frFR\": \"Vers le Camp des Rogues\",\n",
+                u8"    \"itIT\": \"Per il Campo delle Scolte\",\n",
+                u8"    \"koKR\": \"자매단 야영지로 이동\",\n",
+                u8"    \"plPL\": \"Obozowisko Łotrzyc\",\n",
+                u8"    \"esMX\": \"Al Campamento de Renegadas\",\n",
+                u8"    \"jaJP\": \"ローグの野営地へ\",\n",
+                u8"    \"ptBR\": \"Para o Acampamento Renegado\",\n",
+                u8"    \"ruRU\": \"В лагерь разбойниц\",\n",
+                u8"    \"zhCN\": \"前往流亡者营地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11155,\n",
+                u8"    \"Key\": \"Pandemonium Run 1\",\n",
+                u8"    \"enUS\": \"Matron's Den\",\n",
+                u8"    \"zhTW\": \"魔母巢穴\",\n",
+                u8"    \"deDE\": \"Matronenhöhle\",\n",
+                u8"    \"esES\": \"Guarida de la Matrona\",\n",
+                u8"    \"frFR\": \"Repaire de la Matrone\",\n",
+                u8"    \"itIT\": \"Tana della Matrona\",\n",
+                u8"    \"koKR\": \"여제의 소굴\",\n",
+                u8"    \"plPL\": \"Legowisko Matrony\",\n",
+                u8"    \"esMX\": \"Guarida de la Matrona\",\n",
+                u8"    \"jaJP\": \"貴婦人の巣窟\",\n",
+                u8"    \"ptBR\": \"Covil da Matriarca\",\n",
+                u8"    \"ruRU\": \"Логово Госпожи\",\n",
+                u8"    \"zhCN\": \"主母的巢穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11156,\n",
+                u8"    \"Key\": \"Pandemonium Run 2\",\n",
+                u8"    \"enUS\": \"Forgotten Sands\",\n",
+                u8"    \"zhTW\": \"遺忘沙漠\",\n",
+                u8"    \"deDE\": \"Die Vergessenen Sande\",\n",
+                u8"    \"esES\": \"Arenas Olvidadas\",\n",
+                u8"    \"frFR\": \"Les Sables oubliés\",\n",
+                u8"    \"itIT\": \"Sabbie Dimenticate\",\n",
+                u8"    \"koKR\": \"잊힌 사막\",\n",
+                u8"    \"plPL\": \"Zapomniane Piaski\",\n",
+                u8"    \"esMX\": \"Arenas Olvidadas\",\n",
+                u8"    \"jaJP\": \"忘れ去られし砂漠\",\n",
+                u8"    \"ptBR\": \"Areias Esquecidas\",\n",
+                u8"    \"ruRU\": \"Забытые пески\",\n",
+                u8"    \"zhCN\": \"遗忘的沙丘\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11157,\n",
+                u8"    \"Key\": \"Pandemonium Run 3\",\n",
+                u8"    \"enUS\": \"Furnace of Pain\",\n",
+                u8"    \"zhTW\": \"苦痛熔爐\",\n",
+                u8"    \"deDE\": \"Glutofen der Pein\",\n",
+                u8"    \"esES\": \"Caldera del Dolor\",\n",
+                u8"    \"frFR\": \"Fournaise de la douleur\",\n",
+                u8"    \"itIT\": \"Fornace del Dolore\",\n",
+                u8"    \"koKR\": \"고통의 용광로\",\n",
+                u8"    \"plPL\": \"Piec Bólu\",\n",
+                u8"    \"esMX\": \"Forja del Dolor\",\n",
+                u8"    \"jaJP\": \"苦痛のかまど\",\n",
+                u8"    \"ptBR\": \"Fornalha da Dor\",\n",
+                u8"    \"ruRU\": \"Горнило Боли\",\n",
+                u8"    \"zhCN\": \"苦痛的熔炉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21797,\n",
+                u8"    \"Key\": \"act1X\",\n",
+                u8"    \"enUS\": \"THE SISTER'S LAMENT\",\n",
+                u8"    \"zhTW\": \"痛惜往事\",\n",
+                u8"    \"deDE\": \"DIE KLAGE DER SCHWESTER\",\n",
+                u8"    \"esES\": \"LLANTO DE LAS HERMANAS\",\n",
+                u8"    \"frFR\": \"LA PLAINTE DE LA SŒUR\",\n",
+                u8"    \"itIT\": \"LAMENTO DELLE SORELLE\",\n",
+                u8"    \"koKR\": \"자매의 탄식\",\n",
+                u8"    \"plPL\": \"LAMENT SIÓSTR\",\n",
+                u8"    \"esMX\": \"EL LAMENTO DE LAS HERMANAS\",\n",
+                u8"    \"jaJP\": \"姉妹の嘆き\",\n",
+                u8"    \"ptBR\": \"O LAMENTO DAS IRMÃS\",\n",
+                u8"    \"ruRU\": \"ПЛАЧ СЕСТЕР\",\n",
+                u8"    \"zhCN\": \"修女的挽歌\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21798,\n",
+                u8"    \"Key\": \"act2X\",\n",
+                u8"    \"enUS\": \"DESERT JOURNEY\",\n",
+                u8"    \"zhTW\": \"沙漠旅程\",\n",
+                u8"    \"deDE\": \"WÜSTENREISE\",\n",
+                u8"    \"esES\": \"TRAVESÍA DEL DESIERTO\",\n",
+                u8"    \"frFR\": \"VOYAGE DANS LE DÉSERT\",\n",
+                u8"    \"itIT\": \"VIAGGIO NEL DESERTO\",\n",
+                u8"    \"koKR\": \"사막 여행\",\n",
+                u8"    \"plPL\": \"PODRÓŻ PRZEZ PUSTYNIĘ\",\n",
+                u8"    \"esMX\": \"VIAJE POR EL DESIERTO\",\n",
+                u8"    \"jaJP\": \"砂漠の旅\",\n",
+                u8"    \"ptBR\": \"JORNADA NO DESERTO\",\n",
+                u8"    \"ruRU\": \"ПЕРЕХОД ЧЕРЕЗ ПУСТЫНЮ\",\n",
+                u8"    \"zhCN\": \"沙漠之旅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21799,\n",
+                u8"    \"Key\": \"act3X\",\n",
+                u8"    \"enUS\": \"MEPHISTO'S JUNGLE\",\n",
+                u8"    \"zhTW\": \"墨菲斯托的叢林\",\n",
+                u8"    \"deDE\": \"MEPHISTOS DSCHUNGEL\",\n",
+                u8"    \"esES\": \"JUNGLA DE MEFISTO\",\n",
+                u8"    \"frFR\": \"LA JUNGLE DE MÉPHISTO\",\n",
+                u8"    \"itIT\": \"LA GIUNGLA DI MEFISTO\",\n",
+                u8"    \"koKR\": \"메피스토의 밀림\",\n",
+                u8"    \"plPL\": \"DŻUNGLA MEFISTA\",\n",
+                u8"    \"esMX\": \"LA JUNGLA DE MEFISTO\",\n",
+                u8"    \"jaJP\": \"メフィストの密林\",\n",
+                u8"    \"ptBR\": \"SELVA DE MEFISTO\",\n",
+                u8"    \"ruRU\": \"ДЖУНГЛИ МЕФИСТО\",\n",
+                u8"    \"zhCN\": \"墨菲斯托的丛林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21800,\n",
+                u8"    \"Key\": \"act4X\",\n",
+                u8"    \"enUS\": \"ENTER HELL\",\n",
+                u8"    \"zhTW\": \"進入地獄\",\n",
+                u8"    \"deDE\": \"HINEIN IN DIE HÖLLE\",\n",
+                u8"    \"esES\": \"ENTRADA EN EL INFIERNO\",\n",
+                u8"    \"frFR\": \"L’ENTRÉE EN ENFER\",\n",
+                u8"    \"itIT\": \"INGRESSO ALL'INFERNO\",\n",
+                u8"    \"koKR\": \"지옥 진입\",\n",
+                u8"    \"plPL\": \"WEJŚCIE DO PIEKŁA\",\n",
+                u8"    \"esMX\": \"ENTRADA AL INFIERNO\",\n",
+                u8"    \"jaJP\": \"地獄への道\",\n",
+                u8"    \"ptBR\": \"ENTRADA NO INFERNO\",\n",
+                u8"    \"ruRU\": \"ВРАТА В ПРЕИСПОДНЮЮ\",\n",
+                u8"    \"zhCN\": \"踏入地狱\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21802,\n",
+                u8"    \"Key\": \"act5X\",\n",
+                u8"    \"enUS\": \"SEARCH FOR BAAL\",\n",
+                u8"    \"zhTW\": \"找尋巴爾\",\n",
+                u8"    \"deDE\": \"SUCHE NACH BAAL\",\n",
+                u8"    \"esES\": \"BÚSQUEDA DE BAAL\",\n",
+                u8"    \"frFR\": \"À LA RECHERCHE DE BAAL\",\n",
+                u8"    \"itIT\": \"ALLA RICERCA DI BAAL\",\n",
+                u8"    \"koKR\": \"바알을 찾아서\",\n",
+                u8"    \"plPL\": \"W POSZUKIWANIU BAALA\",\n",
+                u8"    \"esMX\": \"LA BÚSQUEDA DE BAAL\",\n",
+                u8"    \"jaJP\": \"バールを追って\",\n",
+                u8"    \"ptBR\": \"BUSCA POR BAAL\",\n",
+                u8"    \"ruRU\": \"ПОИСКИ БААЛА\",\n",
+                u8"    \"zhCN\": \"寻找巴尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21865,\n",
+                u8"    \"Key\": \"Hell1\",\n",
+                u8"    \"enUS\": \"Abaddon\",\n",
+                u8"    \"zhTW\": \"亞巴頓\",\n",
+                u8"    \"deDE\": \"Abaddon\",\n",
+                u8"    \"esES\": \"Abaddon\",\n",
+                u8"    \"frFR\": \"Abaddon\",\n",
+                u8"    \"itIT\": \"Abaddon\",\n",
+                u8"    \"koKR\": \"나락\",\n",
+                u8"    \"plPL\": \"Abaddon\",\n",
+                u8"    \"esMX\": \"Abadón\",\n",
+                u8"    \"jaJP\": \"奈落\",\n",
+                u8"    \"ptBR\": \"Abadom\",\n",
+                u8"    \"ruRU\": \"Аваддон\",\n",
+                u8"    \"zhCN\": \"亚巴顿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21866,\n",
+                u8"    \"Key\": \"Hell2\",\n",
+                u8"    \"enUS\": \"Pit of Acheron\",\n",
+                u8"    \"zhTW\": \"冥河地穴\",\n",
+                u8"    \"deDE\": \"Grube von Acheron\",\n",
+                u8"    \"esES\": \"Foso de Acheron\",\n",
+                u8"    \"frFR\": \"Puits d’Acheron\",\n",
+                u8"    \"itIT\": \"Abisso dell'Acheronte\",\n",
+                u8"    \"koKR\": \"아케론의 구덩이\",\n",
+                u8"    \"plPL\": \"Otchłań Acheronu\",\n",
+                u8"    \"esMX\": \"Foso de Aqueronte\",\n",
+                u8"    \"jaJP\": \"冥穴\",\n",
+                u8"    \"ptBR\": \"Fosso de Aqueron\",\n",
+                u8"    \"ruRU\": \"Пропасть Ахерона\",\n",
+                u8"    \"zhCN\": \"阿克隆深渊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21867,\n",
+                u8"    \"Key\": \"Hell3\",\n",
+                u8"    \"enUS\": \"Infernal Pit\",\n",
+                u8"    \"zhTW\": \"煉獄地穴\",\n",
+                u8"    \"deDE\": \"Infernogrube\",\n",
+                u8"    \"esES\": \"Foso Infernal\",\n",
+                u8"    \"frFR\": \"Puits infernal\",\n",
+                u8"    \"itIT\": \"Abisso Infernale\",\n",
+                u8"    \"koKR\": \"지옥불 구덩이\",\n",
+                u8"    \"plPL\": \"Piekielna Czeluść\",\n",
+                u8"    \"esMX\": \"Foso del Infierno\",\n",
+                u8"    \"jaJP\": \"獄穴\",\n",
+                u8"    \"ptBR\": \"Fosso Infernal\",\n",
+                u8"    \"ruRU\": \"Инфернальный провал\",\n",
+                u8"    \"zhCN\": \"炼狱深渊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21868,\n",
+                u8"    \"Key\": \"To Hell1\",\n",
+                u8"    \"enUS\": \"To Abaddon\",\n",
+                u8"    \"zhTW\": \"前往亞巴頓\",\n",
+                u8"    \"deDE\": \"Nach Abaddon\",\n",
+                u8"    \"esES\": \"A Abaddon\",\n",
+                u8"    \"frFR\": \"Vers Abaddon\",\n",
+                u8"    \"itIT\": \"Per l'Abaddon\",\n",
+                u8"    \"koKR\": \"나락으로 이동\",\n",
+                u8"    \"plPL\": \"Abaddon\",\n",
+                u8"    \"esMX\": \"A Abadón\",\n",
+                u8"    \"jaJP\": \"奈落へ\",\n",
+                u8"    \"ptBR\": \"Para Abadom\",\n",
+                u8"    \"ruRU\": \"В Аваддон\",\n",
+                u8"    \"zhCN\": \"前往亚巴顿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21869,\n",
+                u8"    \"Key\": \"To Hell2\",\n",
+                u8"    \"enUS\": \"To The Pit of Acheron\",\n",
+                u8"    \"zhTW\": \"前往冥河地穴\",\n",
+                u8"    \"deDE\": \"Zur Grube von Acheron\",\n",
+                u8"    \"esES\": \"Al Foso de Acheron\",\n",
+                u8"    \"frFR\": \"Vers le Puits d’Acheron\",\n",
+                u8"    \"itIT\": \"Per l'Abisso dell'Acheronte\",\n",
+                u8"    \"koKR\": \"아케론의 구덩이로 이동\",\n",
+                u8"    \"plPL\": \"Otchłań Acheronu\",\n",
+                u8"    \"esMX\": \"Al Foso de Aqueronte\",\n",
+                u8"    \"jaJP\": \"冥穴へ\",\n",
+                u8"    \"ptBR\": \"Para o Fosso de Aqueron\",\n",
+                u8"    \"ruRU\": \"В пропасть Ахерона\",\n",
+                u8"    \"zhCN\": \"前往阿克隆深渊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21870,\n",
+                u8"    \"Key\": \"To Hell3\",\n",
+                u8"    \"enUS\": \"To The Infernal Pit\",\n",
+                u8"    \"zhTW\": \"前往煉獄地穴\",\n",
+                u8"    \"deDE\": \"Zur Infernogrube\",\n",
+                u8"    \"esES\": \"Al Foso Infernal\",\n",
+                u8"    \"frFR\": \"Vers le Puits infernal\",\n",
+                u8"    \"itIT\": \"Per l'Abisso Infernale\",\n",
+                u8"    \"koKR\": \"지옥불 구덩이로 이동\",\n",
+                u8"    \"plPL\": \"Piekielna Czeluść\",\n",
+                u8"    \"esMX\": \"Al Foso del Infierno\",\n",
+                u8"    \"jaJP\": \"獄穴へ\",\n",
+                u8"    \"ptBR\": \"Para o Fosso Infernal\",\n",
+                u8"    \"ruRU\": \"В Инфернальный провал\",\n",
+                u8"    \"zhCN\": \"前往炼狱深渊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22646,\n",
+                u8"    \"Key\": \"Harrogath\",\n",
+                u8"    \"enUS\": \"Harrogath\",\n",
+                u8"    \"zhTW\": \"哈洛加斯\",\n",
+                u8"    \"deDE\": \"Harrogath\",\n",
+                u8"    \"esES\": \"Harrogath\",\n",
+                u8"    \"frFR\": \"Harrogath\",\n",
+                u8"    \"itIT\": \"Harrogath\",\n",
+                u8"    \"koKR\": \"하로가스\",\n",
+                u8"    \"plPL\": \"Harrogath\",\n",
+                u8"    \"esMX\": \"Harrogat\",\n",
+                u8"    \"jaJP\": \"ハロガス\",\n",
+                u8"    \"ptBR\": \"Harrogath\",\n",
+                u8"    \"ruRU\": \"Харрогат\",\n",
+                u8"    \"zhCN\": \"哈洛加斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22647,\n",
+                u8"    \"Key\": \"Bloody Foothills\",\n",
+                u8"    \"enUS\": \"Bloody Foothills\",\n",
+                u8"    \"zhTW\": \"血腥丘陵\",\n",
+                u8"    \"deDE\": \"Blutiges Vorgebirge\",\n",
+                u8"    \"esES\": \"Estribaciones Sangrientas\",\n",
+                u8"    \"frFR\": \"Les Collines Sanglantes\",\n",
+                u8"    \"itIT\": \"Colline Insanguinate\",\n",
+                u8"    \"koKR\": \"핏빛 언덕\",\n",
+                u8"    \"plPL\": \"Krwawe Wzgórza\",\n",
+                u8"    \"esMX\": \"Laderas Sangrientas\",\n",
+                u8"    \"jaJP\": \"血に塗れし丘陵\",\n",
+                u8"    \"ptBR\": \"Colinas Sangrentas\",\n",
+                u8"    \"ruRU\": \"Кровавые предгорья\",\n",
+                u8"    \"zhCN\": \"血腥丘陵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22648,\n",
+                u8"    \"Key\": \"Rigid Highlands\",\n",
+                u8"    \"enUS\": \"Frigid Highlands\",\n",
+                u8"    \"zhTW\": \"冰凍高地\",\n",
+                u8"    \"deDE\": \"Eishochland\",\n",
+                u8"    \"esES\": \"Tierras Altas Glaciales\",\n",
+                u8"    \"frFR\": \"Les Hautes-Glaces\",\n",
+                u8"    \"itIT\": \"Altopiani del Gelo\",\n",
+                u8"    \"koKR\": \"혹한의 고산지\",\n",
+                u8"    \"plPL\": \"Zlodowaciała Wyżyna\",\n",
+                u8"    \"esMX\": \"Tierras Altas Gélidas\",\n",
+                u8"    \"jaJP\": \"極寒の高原\",\n",
+                u8"    \"ptBR\": \"Terras Altas Gélidas\",\n",
+                u8"    \"ruRU\": \"Мерзлое нагорье\",\n",
+                u8"    \"zhCN\": \"冰冻高地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22649,\n",
+                u8"    \"Key\": \"Arreat Plateau\",\n",
+                u8"    \"enUS\": \"Arreat Plateau\",\n",
+                u8"    \"zhTW\": \"亞瑞特高原\",\n",
+                u8"    \"deDE\": \"Arreathochebene\",\n",
+                u8"    \"esES\": \"Meseta Arreat\",\n",
+                u8"    \"frFR\": \"Le Mont Arreat\",\n",
+                u8"    \"itIT\": \"Plateau dell'Arreat\",\n",
+                u8"    \"koKR\": \"아리앗 고원\",\n",
+                u8"    \"plPL\": \"Płaskowyż Arreat\",\n",
+                u8"    \"esMX\": \"Planicie de Arreat\",\n",
+                u8"    \"jaJP\": \"アリート高地\",\n",
+                u8"    \"ptBR\": \"Platô de Arreat\",\n",
+                u8"    \"ruRU\": \"Арреатское плато\",\n",
+                u8"    \"zhCN\": \"亚瑞特高原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22650,\n",
+                u8"    \"Key\": \"Crystalized Cavern Level 1\",\n",
+                u8"    \"enUS\": \"Crystalline Passage\",\n",
+                u8"    \"zhTW\": \"水晶通道\",\n",
+                u8"    \"deDE\": \"Kristalldurchgang\",\n",
+                u8"    \"esES\": \"Pasaje Cristalino\",\n",
+                u8"    \"frFR\": \"Le Passage Cristallin\",\n",
+                u8"    \"itIT\": \"Passaggio Cristallino\",\n",
+                u8"    \"koKR\": \"수정 동굴\",\n",
+                u8"    \"plPL\": \"Kryształowe Przejście\",\n",
+                u8"    \"esMX\": \"Pasaje Cristalino\",\n",
+                u8"    \"jaJP\": \"結晶道\",\n",
+                u8"    \"ptBR\": \"Passagem Cristalina\",\n",
+                u8"    \"ruRU\": \"Ледяные пещеры\",\n",
+                u8"    \"zhCN\": \"水晶通道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22651,\n",
+                u8"    \"Key\": \"Cellar of Pity\",\n",
+                u8"    \"enUS\": \"Frozen River\",\n",
+                u8"    \"zhTW\": \"冰凍之河\",\n",
+                u8"    \"deDE\": \"Frostfluss\",\n",
+                u8"    \"esES\": \"Río Helado\",\n",
+                u8"    \"frFR\": \"La Rivière Glacée\",\n",
+                u8"    \"itIT\": \"Fiume Gelido\",\n",
+                u8"    \"koKR\": \"얼어붙은 강\",\n",
+                u8"    \"plPL\": \"Zamarznięta Rzeka\",\n",
+                u8"    \"esMX\": \"Río Congelado\",\n",
+                u8"    \"jaJP\": \"凍てつく川\",\n",
+                u8"    \"ptBR\": \"Rio Congelado\",\n",
+                u8"    \"ruRU\": \"Замерзшая река\",\n",
+                u8"    \"zhCN\": \"冰冻之河\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22652,\n",
+                u8"    \"Key\": \"Crystalized Cavern Level 2\",\n",
+                u8"    \"enUS\": \"Glacial Trail\",\n",
+                u8"    \"zhTW\": \"冰河小徑\",\n",
+                u8"    \"deDE\": \"Gletscherweg\",\n",
+                u8"    \"esES\": \"Senda Glacial\",\n",
+                u8"    \"frFR\": \"La Piste des Glaces\",\n",
+                u8"    \"itIT\": \"Sentiero Ghiacciato\",\n",
+                u8"    \"koKR\": \"빙하의 길\",\n",
+                u8"    \"plPL\": \"Lodowy Trakt\",\n",
+                u8"    \"esMX\": \"Sendero Glacial\",\n",
+                u8"    \"jaJP\": \"氷の道\",\n",
+                u8"    \"ptBR\": \"Trilha Glacial\",\n",
+                u8"    \"ruRU\": \"Ледовый ход\",\n",
+                u8"    \"zhCN\": \"冰川小径\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22653,\n",
+                u8"    \"Key\": \"Echo Chamber\",\n",
+                u8"    \"enUS\": \"Drifter Cavern\",\n",
+                u8"    \"zhTW\": \"漂泊者洞窟\",\n",
+                u8"    \"deDE\": \"Flockenhöhle\",\n",
+                u8"    \"esES\": \"Caverna del Errante\",\n",
+                u8"    \"frFR\": \"La Caverne du Yéti\",\n",
+                u8"    \"itIT\": \"Caverna dei Viandanti\",\n",
+                u8"    \"koKR\": \"부랑자의 동굴\",\n",
+                u8"    \"plPL\": \"Grota Tułaczy\",\n",
+                u8"    \"esMX\": \"Caverna del Morador\",\n",
+                u8"    \"jaJP\": \"流れ者の洞窟\",\n",
+                u8"    \"ptBR\": \"Caverna do Errante\",\n",
+                u8"    \"ruRU\": \"Пещера скитальцев\",\n",
+                u8"    \"zhCN\": \"漂流洞窟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22654,\n",
+                u8"    \"Key\": \"Tundra Wastelands\",\n",
+                u8"    \"enUS\": \"Frozen Tundra\",\n",
+                u8"    \"zhTW\": \"冰凍苔原\",\n",
+                u8"    \"deDE\": \"Gefrorene Tundra\",\n",
+                u8"    \"esES\": \"Tundra Helada\",\n",
+                u8"    \"frFR\": \"La Toundra Glacée\",\n",
+                u8"    \"itIT\": \"Tundra Congelata\",\n",
+                u8"    \"koKR\": \"얼어붙은 동토\",\n",
+                u8"    \"plPL\": \"Zamarznięta Tundra\",\n",
+                u8"    \"esMX\": \"Tundra Congelada\",\n",
+                u8"    \"jaJP\": \"氷結の凍原\",\n",
+                u8"    \"ptBR\": \"Tundra Congelada\",\n",
+                u8"    \"ruRU\": \"Морозная тундра\",\n",
+                u8"    \"zhCN\": \"冰冻苔原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22655,\n",
+                u8"    \"Key\": \"Glacial Caves Level 1\",\n",
+                u8"    \"enUS\": \"The Ancients' Way\",\n",
+                u8"    \"zhTW\": \"先祖之路\",\n",
+                u8"    \"deDE\": \"Der Weg der Urahnen\",\n",
+                u8"    \"esES\": \"Camino de los Antiguos\",\n",
+                u8"    \"frFR\": \"Le Chemin des Anciens\",\n",
+                u8"    \"itIT\": \"Via degli Antichi\",\n",
+                u8"    \"koKR\": \"고대인의 길\",\n",
+                u8"    \"plPL\": \"Droga Starożytnych\",\n",
+                u8"    \"esMX\": \"El Camino de los Ancestros\",\n",
+                u8"    \"jaJP\": \"古の民の通り道\",\n",
+                u8"    \"ptBR\": \"Caminho dos Ancestrais\",\n",
+                u8"    \"ruRU\": \"Путь Древних\",\n",
+                u8"    \"zhCN\": \"先祖之路\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22656,\n",
+                u8"    \"Key\": \"Glacial Caves Level 2\",\n",
+                u8"    \"enUS\": \"Icy Cellar\",\n",
+                u8"    \"zhTW\": \"冰窖\",\n",
+                u8"    \"deDE\": \"Eiskeller\",\n",
+                u8"    \"esES\": \"Sótano Helado\",\n",
+                u8"    \"frFR\": \"La Cave Glaciale\",\n",
+                u8"    \"itIT\": \"Sotterraneo di Ghiaccio\",\n",
+                u8"    \"koKR\": \"얼음 지하실\",\n",
+                u8"    \"plPL\": \"Lodowa Piwnica\",\n",
+                u8"    \"esMX\": \"Caverna Helada\",\n",
+                u8"    \"jaJP\": \"氷の穴ぐら\",\n",
+                u8"    \"ptBR\": \"Porão Gélido\",\n",
+                u8"    \"ruRU\": \"Ледяной грот\",\n",
+                u8"    \"zhCN\": \"寒冰地窖\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22657,\n",
+                u8"    \"Key\": \"Rocky Summit\",\n",
+                u8"    \"enUS\": \"Arreat Summit\",\n",
+                u8"    \"zhTW\": \"亞瑞特山巔\",\n",
+                u8"    \"deDE\": \"Gipfel des Arreat\",\n",
+                u8"    \"esES\": \"Cima Arreat\",\n",
+                u8"    \"frFR\": \"Le Sommet Arreat\",\n",
+                u8"    \"itIT\": \"Sommità dell'Arreat\",\n",
+                u8"    \"koKR\": \"아리앗 정상\",\n",
+                u8"    \"plPL\": \"Szczyt Arreat\",\n",
+                u8"    \"esMX\": \"Cima de Arreat\",\n",
+                u8"    \"jaJP\": \"アリート山の頂き\",\n",
+                u8"    \"ptBR\": \"Cume de Arreat\",\n",
+                u8"    \"ruRU\": \"Вершина Арреата\",\n",
+                u8"    \"zhCN\": \"亚瑞特之巅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22658,\n",
+                u8"    \"Key\": \"Nihlathaks Temple\",\n",
+                u8"    \"enUS\": \"Nihlathak's Temple\",\n",
+                u8"    \"zhTW\": \"尼拉塞克的神殿\",\n",
+                u8"    \"deDE\": \"Nihlathaks Tempel\",\n",
+                u8"    \"esES\": \"Templo de Nihlathak\",\n",
+                u8"    \"frFR\": \"Le Temple de Nihlathak\",\n",
+                u8"    \"itIT\": \"Tempio di Nihlathak\",\n",
+                u8"    \"koKR\": \"니흘라탁의 사원\",\n",
+                u8"    \"plPL\": \"Świątynia Nihlathaka\",\n",
+                u8"    \"esMX\": \"Templo de Nihlathak\",\n",
+                u8"    \"jaJP\": \"ニーラサックの寺院\",\n",
+                u8"    \"ptBR\": \"Templo de Nilatak\",\n",
+                u8"    \"ruRU\": \"Храм Нильятака\",\n",
+                u8"    \"zhCN\": \"尼拉塞克的神殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22659,\n",
+                u8"    \"Key\": \"Halls of Anguish\",\n",
+                u8"    \"enUS\": \"Halls of Anguish\",\n",
+                u8"    \"zhTW\": \"怨慟之廳\",\n",
+                u8"    \"deDE\": \"Hallen der Qual\",\n",
+                u8"    \"esES\": \"Salas de la Angustia\",\n",
+                u8"    \"frFR\": \"Les Corridors de l’Angoisse\",\n",
+                u8"    \"itIT\": \"Sale dell'Angoscia\",\n",
+                u8"    \"koKR\": \"고뇌의 전당\",\n",
+                u8"    \"plPL\": \"Sale Cierpienia\",\n",
+                u8"    \"esMX\": \"Salas de la Angustia\",\n",
+                u8"    \"jaJP\": \"苦悶の広間\",\n",
+                u8"    \"ptBR\": \"Salões da Angústia\",\n",
+                u8"    \"ruRU\": \"Чертоги Мучений\",\n",
+                u8"    \"zhCN\": \"痛楚大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22660,\n",
+                u8"    \"Key\": \"Halls of Death's Calling\",\n",
+                u8"    \"enUS\": \"Halls of Pain\",\n",
+                u8"    \"zhTW\": \"苦痛之廳\",\n",
+                u8"    \"deDE\": \"Hallen der Schmerzen\",\n",
+                u8"    \"esES\": \"Salas del Dolor\",\n",
+                u8"    \"frFR\": \"Les Corridors de la Souffrance\",\n",
+                u8"    \"itIT\": \"Sale del Dolore\",\n",
+                u8"    \"koKR\": \"고통의 전당\",\n",
+                u8"    \"plPL\": \"Sale Bólu\",\n",
+                u8"    \"esMX\": \"Salas del Dolor\",\n",
+                u8"    \"jaJP\": \"苦痛の広間\",\n",
+                u8"    \"ptBR\": \"Salões da Dor\",\n",
+                u8"    \"ruRU\": \"Чертоги Боли\",\n",
+                u8"    \"zhCN\": \"苦痛大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22661,\n",
+                u8"    \"Key\": \"Halls of Tormented Insanity\",\n",
+                u8"    \"enUS\": \"Halls of Torment\",\n",
+                u8"    \"zhTW\": \"折磨之廳\",\n",
+                u8"    \"deDE\": \"Hallen der Pein\",\n",
+                u8"    \"esES\": \"Salas del Tormento\",\n",
+                u8"    \"frFR\": \"Les Corridors de l’Expiation\",\n",
+                u8"    \"itIT\": \"Sale del Tormento\",\n",
+                u8"    \"koKR\": \"고문의 전당\",\n",
+                u8"    \"plPL\": \"Sale Udręki\",\n",
+                u8"    \"esMX\": \"Salas del Tormento\",\n",
+                u8"    \"jaJP\": \"苦悩の広間\",\n",
+                u8"    \"ptBR\": \"Salões do Tormento\",\n",
+                u8"    \"ruRU\": \"Чертоги Страданий\",\n",
+                u8"    \"zhCN\": \"折磨大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22662,\n",
+                u8"    \"Key\": \"Halls of Vaught\",\n",
+                u8"    \"enUS\": \"Halls of Vaught\",\n",
+                u8"    \"zhTW\": \"沃特之廳\",\n",
+                u8"    \"deDE\": \"Hallen von Vaught\",\n",
+                u8"    \"esES\": \"Salas de Vaught\",\n",
+                u8"    \"frFR\": \"Les Corridors du Martyre\",\n",
+                u8"    \"itIT\": \"Sale di Vaught\",\n",
+                u8"    \"koKR\": \"보트의 전당\",\n",
+                u8"    \"plPL\": \"Sale Nieszczęścia\",\n",
+                u8"    \"esMX\": \"Salas de Vaught\",\n",
+                u8"    \"jaJP\": \"ヴォートの広間\",\n",
+                u8"    \"ptBR\": \"Salões de Vaught\",\n",
+                u8"    \"ruRU\": \"Чертоги Воута\",\n",
+                u8"    \"zhCN\": \"沃特大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22663,\n",
+                u8"    \"Key\": \"The Worldstone Keep Level 1\",\n",
+                u8"    \"enUS\": \"Worldstone Keep Level 1\",\n",
+                u8"    \"zhTW\": \"世界之石要塞第一層\",\n",
+                u8"    \"deDE\": \"Weltsteinturm, Ebene 1\",\n",
+                u8"    \"esES\": \"Torre de la Piedra del Mundo nivel 1\",\n",
+                u8"    \"frFR\": \"Donjon de la Pierre-Monde niv. 1\",\n",
+                u8"    \"itIT\": \"Forte della Pietra del Mondo L1\",\n",
+                u8"    \"koKR\": \"세계석 성채 1층\",\n",
+                u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 1\",\n",
+                u8"    \"esMX\": \"Fortaleza de la Piedra Ecuménica Nivel 1\",\n",
+                u8"    \"jaJP\": \"ワールドストーン城塞: 第1階層\",\n",
+                u8"    \"ptBR\": \"Forte da Pedra do Mundo Nível 1\",\n",
+                u8"    \"ruRU\": \"Цитадель Мироздания: 1-й уровень\",\n",
+                u8"    \"zhCN\": \"世界之石要塞一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22664,\n",
+                u8"    \"Key\": \"The Worldstone Keep Level 2\",\n",
+                u8"    \"enUS\": \"Worldstone Keep Level 2\",\n",
+                u8"    \"zhTW\": \"世界之石要塞第二層\",\n",
+                u8"    \"deDE\": \"Weltsteinturm, Ebene 2\",\n",
+                u8"    \"esES\": \"Torre de la Piedra del Mundo nivel 2\",\n",
+                u8"    \"frFR\": \"Donjon de la Pierre-Monde niv. 2\",\n",
+                u8"    \"itIT\": \"Forte della Pietra del Mondo L2\",\n",
+                u8"    \"koKR\": \"세계석 성채 2층\",\n",
+                u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 2\",\n",
+                u8"    \"esMX\": \"Fortaleza de la Piedra Ecuménica Nivel 2\",\n",
+                u8"    \"jaJP\": \"ワールドストーン城塞: 第2階層\",\n",
+                u8"    \"ptBR\": \"Forte da Pedra do Mundo Nível 2\",\n",
+                u8"    \"ruRU\": \"Цитадель Мироздания: 2-й уровень\",\n",
+                u8"    \"zhCN\": \"世界之石要塞二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22665,\n",
+                u8"    \"Key\": \"The Worldstone Keep Level 3\",\n",
+                u8"    \"enUS\": \"Worldstone Keep Level 3\",\n",
+                u8"    \"zhTW\": \"世界之石要塞第三層\",\n",
+                u8"    \"deDE\": \"Weltsteinturm, Ebene 3\",\n",
+                u8"    \"esES\": \"Torre de la Piedra del Mundo nivel 3\",\n",
+                u8"    \"frFR\": \"Donjon de la Pierre-Monde niv. 3\",\n",
+                u8"    \"itIT\": \"Forte della Pietra del Mondo L3\",\n",
+                u8"    \"koKR\": \"세계석 성채 3층\",\n",
+                u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 3\",\n",
+                u8"    \"esMX\": \"Fortaleza de la Piedra Ecuménica Nivel 3\",\n",
+                u8"    \"jaJP\": \"ワールドストーン城塞: 第3階層\",\n",
+                u8"    \"ptBR\": \"Forte da Pedra do Mundo Nível 3\",\n",
+                u8"    \"ruRU\": \"Цитадель Мироздания: 3-й уровень\",\n",
+                u8"    \"zhCN\": \"世界之石要塞三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22666,\n",
+                u8"    \"Key\": \"The Worldstone Chamber\",\n",
+                u8"    \"enUS\": \"The Worldstone Chamber\",\n",
+                u8"    \"zhTW\": \"世界之石大殿\",\n",
+                u8"    \"deDE\": \"Die Kammer des Weltsteins\",\n",
+                u8"    \"esES\": \"Cámara de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"La Chambre de la Pierre-Monde\",\n",
+                u8"    \"itIT\": \"Sale della Pietra del Mondo\",\n",
+                u8"    \"koKR\": \"세계석 보관실\",\n",
+                u8"    \"plPL\": \"Komnata Kamienia Świata\",\n",
+                u8"    \"esMX\": \"Cámara de la Piedra Ecuménica\",\n",
+                u8"    \"jaJP\": \"ワールドストーンの間\",\n",
+                u8"    \"ptBR\": \"Câmara da Pedra do Mundo\",\n",
+                u8"    \"ruRU\": \"Святилище Мироздания\",\n",
+                u8"    \"zhCN\": \"世界之石大殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22667,\n",
+                u8"    \"Key\": \"Throne of Destruction\",\n",
+                u8"    \"enUS\": \"Throne of Destruction\",\n",
+                u8"    \"zhTW\": \"毀滅王座\",\n",
+                u8"    \"deDE\": \"Thron der Zerstörung\",\n",
+                u8"    \"esES\": \"Trono de la Destrucción\",\n",
+                u8"    \"frFR\": \"Le Trône de la Destruction\",\n",
+                u8"    \"itIT\": \"Trono della Distruzione\",\n",
+                u8"    \"koKR\": \"파괴의 왕좌\",\n",
+                u8"    \"plPL\": \"Tron Zniszczenia\",\n",
+                u8"    \"esMX\": \"Trono de la Destrucción\",\n",
+                u8"    \"jaJP\": \"破壊の玉座\",\n",
+                u8"    \"ptBR\": \"Trono da Destruição\",\n",
+                u8"    \"ruRU\": \"Престол Разрушения\",\n",
+                u8"    \"zhCN\": \"毁灭王座\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22668,\n",
+                u8"    \"Key\": \"To Harrogath\",\n",
+                u8"    \"enUS\": \"To Harrogath\",\n",
+                u8"    \"zhTW\": \"前往哈洛加斯\",\n",
+                u8"    \"deDE\": \"Nach Harrogath\",\n",
+                u8"    \"esES\": \"A Harrogath\",\n",
+                u8"    \"frFR\": \"Vers Harrogath\",\n",
+                u8"    \"itIT\": \"Per Harrogath\",\n",
+                u8"    \"koKR\": \"하로가스로 이동\",\n",
+                u8"    \"plPL\": \"Harrogath\",\n",
+                u8"    \"esMX\": \"A Harrogat\",\n",
+                u8"    \"jaJP\": \"ハロガスへ\",\n",
+                u8"    \"ptBR\": \"Para Harrogath\",\n",
+                u8"    \"ruRU\": \"В Харрогат\",\n",
+                u8"    \"zhCN\": \"前往哈洛加斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22669,\n",
+                u8"    \"Key\": \"To The Bloody Foothills\",\n",
+                u8"    \"enUS\": \"To The Bloody Foothills\",\n",
+                u8"    \"zhTW\": \"前往血腥丘陵\",\n",
+                u8"    \"deDE\": \"Zum Blutigen Vorgebirge\",\n",
+                u8"    \"esES\": \"A las Estribaciones Sangrientas\",\n",
+                u8"    \"frFR\": \"Vers les Collines Sanglantes\",\n",
+                u8"    \"itIT\": \"Per le Colline Insanguinate\",\n",
+                u8"    \"koKR\": \"핏빛 언덕으로 이동\",\n",
+                u8"    \"plPL\": \"Krwawe Wzgórza\",\n",
+                u8"    \"esMX\": \"A las Laderas Sangrientas\",\n",
+                u8"    \"jaJP\": \"血に塗れし丘陵へ\",\n",
+                u8"    \"ptBR\": \"Para as Colinas Sangrentas\",\n",
+                u8"    \"ruRU\": \"В Кровавые предгорья\",\n",
+                u8"    \"zhCN\": \"前往血腥丘陵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22670,\n",
+                u8"    \"Key\": \"To The Rigid Highlands\",\n",
+                u8"    \"enUS\": \"To The Frigid Highlands\",\n",
+                u8"    \"zhTW\": \"前往冰凍高地\",\n",
+                u8"    \"deDE\": \"Zum Eishochland\",\n",
+                u8"    \"esES\": \"A las Tierras Altas Glaciales\",\n",
+                u8"    \"frFR\": \"Vers les Hautes-Glaces\",\n",
+                u8"    \"itIT\": \"Per gli Altopiani del Gelo\",\n",
+                u8"    \"koKR\": \"혹한의 고산지로 이동\",\n",
+                u8"    \"plPL\": \"Zlodowaciała Wyżyna\",\n",
+                u8"    \"esMX\": \"A las Tierras Altas Gélidas\",\n",
+                u8"    \"jaJP\": \"極寒の高原へ\",\n",
+                u8"    \"ptBR\": \"Para as Terras Altas Gélidas\",\n",
+                u8"    \"ruRU\": \"На Мерзлое нагорье\",\n",
+                u8"    \"zhCN\": \"前往冰冻高地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22671,\n",
+                u8"    \"Key\": \"To The Arreat Plateau\",\n",
+                u8"    \"enUS\": \"To The Arreat Plateau\",\n",
+                u8"    \"zhTW\": \"前往亞瑞特高原\",\n",
+                u8"    \"deDE\": \"Zur Arreathochebene\",\n",
+                u8"    \"esES\": \"A la Meseta Arreat\",\n",
+                u8"    \"frFR\": \"Vers le Mont Arreat\",\n",
+                u8"    \"itIT\": \"Per il Plateau dell'Arreat\",\n",
+                u8"    \"koKR\": \"아리앗 고원으로 이동\",\n",
+                u8"    \"plPL\": \"Płaskowyż Arreat\",\n",
+                u8"    \"esMX\": \"A la Planicie de Arreat\",\n",
+                u8"    \"jaJP\": \"アリート高地へ\",\n",
+                u8"    \"ptBR\": \"Para o Platô de Arreat\",\n",
+                u8"    \"ruRU\": \"На Арреатское плато\",\n",
+                u8"    \"zhCN\": \"前往亚瑞特高原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22672,\n",
+                u8"    \"Key\": \"To The Crystalized Cavern Level 1\",\n",
+                u8"    \"enUS\": \"To The Crystalline Passage\",\n",
+                u8"    \"zhTW\": \"前往水晶通道\",\n",
+                u8"    \"deDE\": \"Zum Kristalldurchgang\",\n",
+                u8"    \"esES\": \"Al Pasaje Cristalino\",\n",
+                u8"    \"frFR\": \"Vers le Passage Cristallin\",\n",
+                u8"    \"itIT\": \"Per il Passaggio Cristallino\",\n",
+                u8"    \"koKR\": \"수정 동굴로 이동\",\n",
+                u8"    \"plPL\": \"Kryształowe Przejście\",\n",
+                u8"    \"esMX\": \"Al Pasaje Cristalino\",\n",
+                u8"    \"jaJP\": \"結晶道へ\",\n",
+                u8"    \"ptBR\": \"Para a Passagem Cristalina\",\n",
+                u8"    \"ruRU\": \"В Ледяные пещеры\",\n",
+                u8"    \"zhCN\": \"前往水晶通道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22673,\n",
+                u8"    \"Key\": \"To The Cellar of Pity\",\n",
+                u8"    \"enUS\": \"To The Frozen River\",\n",
+                u8"    \"zhTW\": \"前往冰凍之河\",\n",
+                u8"    \"deDE\": \"Zum Frostfluss\",\n",
+                u8"    \"esES\": \"Al Río Helado\",\n",
+                u8"    \"frFR\": \"Vers la Rivière Glacée\",\n",
+                u8"    \"itIT\": \"Per il Fiume Gelido\",\n",
+                u8"    \"koKR\": \"얼어붙은 강으로 이동\",\n",
+                u8"    \"plPL\": \"Zamarznięta Rzeka\",\n",
+                u8"    \"esMX\": \"Al Río Congelado\",\n",
+                u8"    \"jaJP\": \"凍てつく川へ\",\n",
+                u8"    \"ptBR\": \"Para o Rio Congelado\",\n",
+                u8"    \"ruRU\": \"К Замерзшей реке\",\n",
+                u8"    \"zhCN\": \"前往冰冻之河\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22674,\n",
+                u8"    \"Key\": \"To The Crystalized Cavern Level 2\",\n",
+                u8"    \"enUS\": \"To The Glacial Trail\",\n",
+                u8"    \"zhTW\": \"前往冰河小徑\",\n",
+                u8"    \"deDE\": \"Zum Gletscherweg\",\n",
+                u8"    \"esES\": \"A la Senda Glacial\",\n",
+                u8"    \"frFR\": \"Vers la Piste des Glaces\",\n",
+                u8"    \"itIT\": \"Per il Sentiero Ghiacciato\",\n",
+                u8"    \"koKR\": \"빙하의 길로 이동\",\n",
+                u8"    \"plPL\": \"Lodowy Trakt\",\n",
+                u8"    \"esMX\": \"Al Sendero Glacial\",\n",
+                u8"    \"jaJP\": \"氷の道へ\",\n",
+                u8"    \"ptBR\": \"Para a Trilha Glacial\",\n",
+                u8"    \"ruRU\": \"В Ледовый ход\",\n",
+                u8"    \"zhCN\": \"前往冰川小径\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22675,\n",
+                u8"    \"Key\": \"To The Echo Chamber\",\n",
+                u8"    \"enUS\": \"To The Drifter Cavern\",\n",
+                u8"    \"zhTW\": \"前往漂泊者洞窟\",\n",
+                u8"    \"deDE\": \"Zur Flockenhöhle\",\n",
+                u8"    \"esES\": \"A la Caverna del Errante\",\n",
+                u8"    \"frFR\": \"Vers la Caverne du Yéti\",\n",
+                u8"    \"itIT\": \"Per la Caverna Serpeggiante\",\n",
+                u8"    \"koKR\": \"부랑자의 동굴로 이동\",\n",
+                u8"    \"plPL\": \"Grota Tułaczy\",\n",
+                u8"    \"esMX\": \"A la Caverna del Morador\",\n",
+                u8"    \"jaJP\": \"流れ者の洞窟へ\",\n",
+                u8"    \"ptBR\": \"Para a Caverna do Errante\",\n",
+                u8"    \"ruRU\": \"В Пещеру скитальцев\",\n",
+                u8"    \"zhCN\": \"前往漂流洞窟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22676,\n",
+                u8"    \"Key\": \"To The Tundra Wastelands\",\n",
+                u8"    \"enUS\": \"To The Frozen Tundra\",\n",
+                u8"    \"zhTW\": \"前往冰凍苔原\",\n",
+                u8"    \"deDE\": \"Zur Eistundra\",\n",
+                u8"    \"esES\": \"A la Tundra Helada\",\n",
+                u8"    \"frFR\": \"Vers la Toundra Glacée\",\n",
+                u8"    \"itIT\": \"Per la Tundra Congelata\",\n",
+                u8"    \"koKR\": \"얼어붙은 동토로 이동\",\n",
+                u8"    \"plPL\": \"Zamarznięta Tundra\",\n",
+                u8"    \"esMX\": \"A la Tundra Congelada\",\n",
+                u8"    \"jaJP\": \"氷結の凍原へ\",\n",
+                u8"    \"ptBR\": \"Para a Tundra Congelada\",\n",
+                u8"    \"ruRU\": \"В Морозную тундру\",\n",
+                u8"    \"zhCN\": \"前往冰冻苔原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22677,\n",
+                u8"    \"Key\": \"To The Glacier Caves Level 1\",\n",
+                u8"    \"enUS\": \"To The Ancients' Way\",\n",
+                u8"    \"zhTW\": \"前往先祖之路\",\n",
+                u8"    \"deDE\": \"Zum Weg der Urahnen\",\n",
+                u8"    \"esES\": \"Al Camino de los Antiguos\",\n",
+                u8"    \"frFR\": \"Vers le Chemin des Anciens\",\n",
+                u8"    \"itIT\": \"Per la Via degli Antichi\",\n",
+                u8"    \"koKR\": \"고대인의 길로 이동\",\n",
+                u8"    \"plPL\": \"Droga Starożytnych\",\n",
+                u8"    \"esMX\": \"Al Camino de los Ancestros\",\n",
+                u8"    \"jaJP\": \"古の民の通り道へ\",\n",
+                u8"    \"ptBR\": \"Para o Caminho dos Ancestrais\",\n",
+                u8"    \"ruRU\": \"К Пути Древних\",\n",
+                u8"    \"zhCN\": \"前往先祖之路\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22678,\n",
+                u8"    \"Key\": \"To The Glacier Caves Level 2\",\n",
+                u8"    \"enUS\": \"To The Icy Cellar\",\n",
+                u8"    \"zhTW\": \"前往冰窖\",\n",
+                u8"    \"deDE\": \"Zum Eiskeller\",\n",
+                u8"    \"esES\": \"Al Sótano Helado\",\n",
+                u8"    \"frFR\": \"Vers la Cave Glaciale\",\n",
+                u8"    \"itIT\": \"Per il Sotterraneo di Ghiaccio\",\n",
+                u8"    \"koKR\": \"얼음 지하실로 이동\",\n",
+                u8"    \"plPL\": \"Lodowa Piwnica\",\n",
+                u8"    \"esMX\": \"A la Caverna Helada\",\n",
+                u8"    \"jaJP\": \"氷の穴ぐらへ\",\n",
+                u8"    \"ptBR\": \"Para o Porão Gélido\",\n",
+                u8"    \"ruRU\": \"В Ледяной грот\",\n",
+                u8"    \"zhCN\": \"前往寒冰地窖\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22679,\n",
+                u8"    \"Key\": \"To The Rocky Summit\",\n",
+                u8"    \"enUS\": \"To The Arreat Summit\",\n",
+                u8"    \"zhTW\": \"前往亞瑞特山巔\",\n",
+                u8"    \"deDE\": \"Zum Gipfel des Arreat\",\n",
+                u8"    \"esES\": \"A la Cima Arreat\",\n",
+                u8"    \"frFR\": \"Vers le Sommet Arreat\",\n",
+                u8"    \"itIT\": \"Per la Sommità dell'Arreat\",\n",
+                u8"    \"koKR\": \"아리앗 정상으로 이동\",\n",
+                u8"    \"plPL\": \"Szczyt Arreat\",\n",
+                u8"    \"esMX\": \"A la Cima de Arreat\",\n",
+                u8"    \"jaJP\": \"アリート山の頂きへ\",\n",
+                u8"    \"ptBR\": \"Para o Cume de Arreat\",\n",
+                u8"    \"ruRU\": \"На вершину Арреата\",\n",
+                u8"    \"zhCN\": \"前往亚瑞特之巅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22680,\n",
+                u8"    \"Key\": \"To Nihlathaks Temple\",\n",
+                u8"    \"enUS\": \"To Nihlathak's Temple\",\n",
+                u8"    \"zhTW\": \"前往尼拉塞克的神殿\",\n",
+                u8"    \"deDE\": \"Zu Nihlathaks Tempel\",\n",
+                u8"    \"esES\": \"Al Templo de Nihlathak\",\n",
+                u8"    \"frFR\": \"Vers le Temple de Nihlathak\",\n",
+                u8"    \"itIT\": \"Per il Tempio di Nihlathak\",\n",
+                u8"    \"koKR\": \"니흘라탁의 사원으로 이동\",\n",
+                u8"    \"plPL\": \"Świątynia Nihlathaka\",\n",
+                u8"    \"esMX\": \"Al Templo de Nihlathak\",\n",
+                u8"    \"jaJP\": \"ニーラサックの寺院へ\",\n",
+                u8"    \"ptBR\": \"Para o Templo de Nilatak\",\n",
+                u8"    \"ruRU\": \"В храм Нильятака\",\n",
+                u8"    \"zhCN\": \"前往尼拉塞克的神殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22681,\n",
+                u8"    \"Key\": \"To The Halls of Anguish\",\n",
+                u8"    \"enUS\": \"To The Halls of Anguish\",\n",
+                u8"    \"zhTW\": \"前往怨慟之廳\",\n",
+                u8"    \"deDE\": \"Zu den Hallen der Qual\",\n",
+                u8"    \"esES\": \"A las Salas de la Angustia\",\n",
+                u8"    \"frFR\": \"Vers les Corridors de l’Angoisse\",\n",
+                u8"    \"itIT\": \"Per le Sale dell'Angoscia\",\n",
+                u8"    \"koKR\": \"고뇌의 전당으로 이동\",\n",
+                u8"    \"plPL\": \"Sale Cierpienia\",\n",
+                u8"    \"esMX\": \"A las Salas de la Angustia\",\n",
+                u8"    \"jaJP\": \"苦悶の広間へ\",\n",
+                u8"    \"ptBR\": \"Para os Salões da Angústia\",\n",
+                u8"    \"ruRU\": \"В Чертоги Мучений\",\n",
+                u8"    \"zhCN\": \"前往痛楚大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22682,\n",
+                u8"    \"Key\": \"To The Halls of Death's Calling\",\n",
+                u8"    \"enUS\": \"To The Halls of Pain\",\n",
+                u8"    \"zhTW\": \"前往苦痛之廳\",\n",
+                u8"    \"deDE\": \"Zu den Hallen der Schmerzen\",\n",
+                u8"    \"esES\": \"A las Salas del Dolor\",\n",
+                u8"    \"frFR\": \"Vers les Corridors de la Souffrance\",\n",
+                u8"    \"itIT\": \"Per le Sale del Dolore\",\n",
+                u8"    \"koKR\": \"고통의 전당으로 이동\",\n",
+                u8"    \"plPL\": \"Sale Bólu\",\n",
+                u8"    \"esMX\": \"A las Salas del Dolor\",\n",
+                u8"    \"jaJP\": \"苦痛の広間へ\",\n",
+                u8"    \"ptBR\": \"Para os Salões da Dor\",\n",
+                u8"    \"ruRU\": \"В Чертоги Боли\",\n",
+                u8"    \"zhCN\": \"前往苦痛大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22683,\n",
+                u8"    \"Key\": \"To The Halls of Tormented Insanity\",\n",
+                u8"    \"enUS\": \"To The Halls of Torment\",\n",
+                u8"    \"zhTW\": \"前往折磨之廳\",\n",
+                u8"    \"deDE\": \"Zu den Hallen der Pein\",\n",
+                u8"    \"esES\": \"A las Salas del Tormento\",\n",
+                u8"    \"frFR\": \"Vers les Corridors de l’Expiation\",\n",
+                u8"    \"itIT\": \"Per le Sale del Tormento\",\n",
+                u8"    \"koKR\": \"고문의 전당으로 이동\",\n",
+                u8"    \"plPL\": \"Do Sal Udręki\",\n",
+                u8"    \"esMX\": \"A las Salas del Tormento\",\n",
+                u8"    \"jaJP\": \"苦悩の広間へ\",\n",
+                u8"    \"ptBR\": \"Para os Salões do Tormento\",\n",
+                u8"    \"ruRU\": \"В Чертоги Страданий\",\n",
+                u8"    \"zhCN\": \"前往折磨大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22684,\n",
+                u8"    \"Key\": \"To The Halls of Vaught\",\n",
+                u8"    \"enUS\": \"To The Halls of Vaught\",\n",
+                u8"    \"zhTW\": \"前往沃特之廳\",\n",
+                u8"    \"deDE\": \"Zu den Hallen von Vaught\",\n",
+                u8"    \"esES\": \"A las Salas de Vaught\",\n",
+                u8"    \"frFR\": \"Vers les Corridors du Martyre\",\n",
+                u8"    \"itIT\": \"Per le Sale di Vaught\",\n",
+                u8"    \"koKR\": \"보트의 전당으로 이동\",\n",
+                u8"    \"plPL\": \"Sale Nieszczęścia\",\n",
+                u8"    \"esMX\": \"A las Salas de Vaught\",\n",
+                u8"    \"jaJP\": \"ヴォートの広間へ\",\n",
+                u8"    \"ptBR\": \"Para os Salões de Vaught\",\n",
+                u8"    \"ruRU\": \"В Чертоги Воута\",\n",
+                u8"    \"zhCN\": \"前往沃特大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22685,\n",
+                u8"    \"Key\": \"To The Worldstone Keep Level 1\",\n",
+                u8"    \"enUS\": \"To The Worldstone Keep Level 1\",\n",
+                u8"    \"zhTW\": \"前往世界之石要塞第一層\",\n",
+                u8"    \"deDE\": \"Zum Weltsteinturm, Ebene 1\",\n",
+                u8"    \"esES\": \"Al nivel 1 de la Torre de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"Vers le donjon de la Pierre-Monde niv. 1\",\n",
+                u8"    \"itIT\": \"Per il Forte della Pietra del Mondo L1\",\n",
+                u8"    \"koKR\": \"세계석 성채 1층으로 이동\",\n",
+                u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 1\",\n",
+                u8"    \"esMX\": \"A la Fortaleza de la Piedra Ecuménica Nivel 1\",\n",
+                u8"    \"jaJP\": \"ワールドストーン城塞: 第1階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Forte da Pedra do Mundo Nível 1\",\n",
+                u8"    \"ruRU\": \"На 1-й уровень Цитадели Мироздания\",\n",
+                u8"    \"zhCN\": \"前往世界之石要塞一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22686,\n",
+                u8"    \"Key\": \"To The Worldstone Keep Level 2\",\n",
+                u8"    \"enUS\": \"To The Worldstone Keep Level 2\",\n",
+                u8"    \"zhTW\": \"前往世界之石要塞第二層\",\n",
+                u8"    \"deDE\": \"Zum Weltsteinturm, Ebene 2\",\n",
+                u8"    \"esES\": \"Al nivel 2 de la Torre de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"Vers le donjon de la Pierre-Monde niv. 2\",\n",
+                u8"    \"itIT\": \"Per il Forte della Pietra del Mondo L2\",\n",
+                u8"    \"koKR\": \"세계석 성채 2층으로 이동\",\n",
+                u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 2\",\n",
+                u8"    \"esMX\": \"A la Fortaleza de la Piedra Ecuménica Nivel 2\",\n",
+                u8"    \"jaJP\": \"ワールドストーン城塞: 第2階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Forte da Pedra do Mundo Nível 2\",\n",
+                u8"    \"ruRU\": \"На 2-й уровень Цитадели Мироздания\",\n",
+                u8"    \"zhCN\": \"前往世界之石要塞二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22687,\n",
+                u8"    \"Key\": \"To The Worldstone Keep Level 3\",\n",
+                u8"    \"enUS\": \"To The Worldstone Keep Level 3\",\n",
+                u8"    \"zhTW\": \"前往世界之石要塞第三層\",\n",
+                u8"    \"deDE\": \"Zum Weltsteinturm, Ebene 3\",\n",
+                u8"    \"esES\": \"Al nivel 3 de la Torre de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"Vers le donjon de la Pierre-Monde niv. 3\",\n",
+                u8"    \"itIT\": \"Per il Forte della Pietra del Mondo L3\",\n",
+                u8"    \"koKR\": \"세계석 성채 3층으로 이동\",\n",
+                u8"    \"plPL\": \"Twierdza Kamienia Świata – Poziom 3\",\n",
+                u8"    \"esMX\": \"A la Fortaleza de la Piedra Ecuménica Nivel 3\",\n",
+                u8"    \"jaJP\": \"ワールドストーン城塞: 第3階層へ\",\n",
+                u8"    \"ptBR\": \"Para o Forte da Pedra do Mundo Nível 3\",\n",
+                u8"    \"ruRU\": \"На 3-й уровень Цитадели Мироздания\",\n",
+                u8"    \"zhCN\": \"前往世界之石要塞三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22688,\n",
+                u8"    \"Key\": \"To The Worldstone Chamber\",\n",
+                u8"    \"enUS\": \"To The Worldstone Chamber\",\n",
+                u8"    \"zhTW\": \"前往世界之石大殿\",\n",
+                u8"    \"deDE\": \"Zur Kammer des Weltsteins\",\n",
+                u8"    \"esES\": \"A la Cámara de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"Vers la Chambre de la Pierre-Monde\",\n",
+                u8"    \"itIT\": \"Per le Sale della Pietra del Mondo\",\n",
+                u8"    \"koKR\": \"세계석 보관실로 이동\",\n",
+                u8"    \"plPL\": \"Komnata Kamienia Świata\",\n",
+                u8"    \"esMX\": \"A la Cámara de la Piedra Ecuménica\",\n",
+                u8"    \"jaJP\": \"ワールドストーンの間へ\",\n",
+                u8"    \"ptBR\": \"Para a Câmara da Pedra do Mundo\",\n",
+                u8"    \"ruRU\": \"В Святилище Мироздания\",\n",
+                u8"    \"zhCN\": \"前往世界之石大殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22689,\n",
+                u8"    \"Key\": \"To The Throne of Destruction\",\n",
+                u8"    \"enUS\": \"To The Throne of Destruction\",\n",
+                u8"    \"zhTW\": \"前往毀滅王座\",\n",
+                u8"    \"deDE\": \"Zum Thron der Zerstörung\",\n",
+                u8"    \"esES\": \"Al Trono de la Destrucción\",\n",
+                u8"    \"frFR\": \"Vers le Trône de la Destruction\",\n",
+                u8"    \"itIT\": \"Per il Trono della Distruzione\",\n",
+                u8"    \"koKR\": \"파괴의 왕좌로 이동\",\n",
+                u8"    \"plPL\": \"Tron Zniszczenia\",\n",
+                u8"    \"esMX\": \"Al Trono de la Destrucción\",\n",
+                u8"    \"jaJP\": \"破壊の玉座へ\",\n",
+                u8"    \"ptBR\": \"Para o Trono da Destruição\",\n",
+                u8"    \"ruRU\": \"К Престолу Разрушения\",\n",
+                u8"    \"zhCN\": \"前往毁灭王座\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22765,\n",
+                u8"    \"Key\": \"EnteringTheRogueEncampment\",\n",
+                u8"    \"enUS\": \"Entering The Rogue Encampment\",\n",
+                u8"    \"zhTW\": \"進入俠盜營地\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Lager der Jägerinnen\",\n",
+                u8"    \"esES\": \"Entrando en el Campamento de las Arpías\",\n",
+                u8"    \"frFR\": \"Entre dans le Camp des Rogues\",\n",
+                u8"    \"itIT\": \"Ingresso nel Campo delle Scolte\",\n",
+                u8"    \"koKR\": \"자매단 야영지에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Obozowiska Łotrzyc\",\n",
+                u8"    \"esMX\": \"Entrando al Campamento de Renegadas\",\n",
+                u8"    \"jaJP\": \"〈ローグの野営地〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Acampamento Renegado\",\n",
+                u8"    \"ruRU\": \"Лагерь разбойниц\",\n",
+                u8"    \"zhCN\": \"进入流亡者营地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22766,\n",
+                u8"    \"Key\": \"EnteringTheBloodMoor\",\n",
+                u8"    \"enUS\": \"Entering The Blood Moor\",\n",
+                u8"    \"zhTW\": \"進入鮮血荒地\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Blutmoor\",\n",
+                u8"    \"esES\": \"Entrando en la Landa de Sangre\",\n",
+                u8"    \"frFR\": \"Entre dans la Lande sanglante\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Lande Insanguinate\",\n",
+                u8"    \"koKR\": \"핏빛 황무지에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Krwawe Wrzosowisko\",\n",
+                u8"    \"esMX\": \"Entrando al Páramo Sangriento\",\n",
+                u8"    \"jaJP\": \"〈血の荒野〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Charco Sangrento\",\n",
+                u8"    \"ruRU\": \"Кровавая пустошь\",\n",
+                u8"    \"zhCN\": \"进入鲜血荒地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22767,\n",
+                u8"    \"Key\": \"EnteringTheColdPlains\",\n",
+                u8"    \"enUS\": \"Entering The Cold Plains\",\n",
+                u8"    \"zhTW\": \"進入冰冷之原\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Kalte Ebene\",\n",
+                u8"    \"esES\": \"Entrando en las Llanuras Frías\",\n",
+                u8"    \"frFR\": \"Entre dans les Plaines gelées\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Pianure Gelate\",\n",
+                u8"    \"koKR\": \"차가운 평야에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Zimną Równinę\",\n",
+                u8"    \"esMX\": \"Entrando a las Llanuras Heladas\",\n",
+                u8"    \"jaJP\": \"〈荒涼の平原〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Planície Gélida\",\n",
+                u8"    \"ruRU\": \"Стылые равнины\",\n",
+                u8"    \"zhCN\": \"进入冰冷之原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22768,\n",
+                u8"    \"Key\": \"EnteringTheStonyField\",\n",
+                u8"    \"enUS\": \"Entering The Stony Field\",\n",
+                u8"    \"zhTW\": \"進入亂石曠野\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Feld der Steine\",\n",
+                u8"    \"esES\": \"Entrando en el Campo Pedregoso\",\n",
+                u8"    \"frFR\": \"Entre dans le Champ de pierres\",\n",
+                u8"    \"itIT\": \"Ingresso nel Campo di Pietra\",\n",
+                u8"    \"koKR\": \"바위 벌판에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Kamienne Pole\",\n",
+                u8"    \"esMX\": \"Entrando al Campo Rocoso\",\n",
+                u8"    \"jaJP\": \"〈石の原野〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Campo Rochoso\",\n",
+                u8"    \"ruRU\": \"Каменистое поле\",\n",
+                u8"    \"zhCN\": \"进入石块旷野\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22769,\n",
+                u8"    \"Key\": \"EnteringTheDarkWood\",\n",
+                u8"    \"enUS\": \"Entering The Dark Wood\",\n",
+                u8"    \"zhTW\": \"進入黑暗森林\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Dunkelwald\",\n",
+                u8"    \"esES\": \"Entrando en el Bosque Oscuro\",\n",
+                u8"    \"frFR\": \"Entre dans le Bois obscur\",\n",
+                u8"    \"itIT\": \"Ingresso nella Foresta Oscura\",\n",
+                u8"    \"koKR\": \"어둠숲에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Mrocznej Kniei\",\n",
+                u8"    \"esMX\": \"Entrando al Bosque Oscuro\",\n",
+                u8"    \"jaJP\": \"〈常闇の森〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Floresta Sombria\",\n",
+                u8"    \"ruRU\": \"Темнолесье\",\n",
+                u8"    \"zhCN\": \"进入黑暗森林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22770,\n",
+                u8"    \"Key\": \"EnteringTheBlackMarsh\",\n",
+                u8"    \"enUS\": \"Entering The Black Marsh\",\n",
+                u8"    \"zhTW\": \"進入黑色荒地\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Schwarzmoor\",\n",
+                u8"    \"esES\": \"Entrando en el Pantano Negro\",\n",
+                u8"    \"frFR\": \"Entre dans le Marais sombre\",\n",
+                u8"    \"itIT\": \"Ingresso nella Palude Nera\",\n",
+                u8"    \"koKR\": \"검은 습지에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Czarne Moczary\",\n",
+                u8"    \"esMX\": \"Entrando a la Marisma Oscura\",\n",
+                u8"    \"jaJP\": \"〈黒の湿原〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Charco Tenebroso\",\n",
+                u8"    \"ruRU\": \"Черная топь\",\n",
+                u8"    \"zhCN\": \"进入黑色沼泽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22771,\n",
+                u8"    \"Key\": \"EnteringTheTamoeHighland\",\n",
+                u8"    \"enUS\": \"Entering The Tamoe Highland\",\n",
+                u8"    \"zhTW\": \"進入泰摩高地\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Tamohochland\",\n",
+                u8"    \"esES\": \"Entrando en las Tierras Altas de Tamoe\",\n",
+                u8"    \"frFR\": \"Entre dans les Hautes-Terres de Tamoe\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Altopiano di Tamoe\",\n",
+                u8"    \"koKR\": \"타모 고원에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Wyżynę Tamoe\",\n",
+                u8"    \"esMX\": \"Entrando a las Tierras Altas de Tamoe\",\n",
+                u8"    \"jaJP\": \"〈タモエ高原〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Planalto Tamoe\",\n",
+                u8"    \"ruRU\": \"Нагорье Тамоэ\",\n",
+                u8"    \"zhCN\": \"进入泰摩高地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22772,\n",
+                u8"    \"Key\": \"EnteringTheDenOfEvilInQuest\",\n",
+                u8"    \"enUS\": \"Entering The Den of Evil\",\n",
+                u8"    \"zhTW\": \"進入邪惡洞窟\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Höhle des Bösen\",\n",
+                u8"    \"esES\": \"Entrando en el Cubil del Mal\",\n",
+                u8"    \"frFR\": \"Entre dans le Repaire du Mal\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Antro del Male\",\n",
+                u8"    \"koKR\": \"악의 소굴에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Siedliska Zła\",\n",
+                u8"    \"esMX\": \"Entrando a la Guarida del Mal\",\n",
+                u8"    \"jaJP\": \"〈邪悪の巣窟〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Covil do Mal\",\n",
+                u8"    \"ruRU\": \"Логово зла\",\n",
+                u8"    \"zhCN\": \"进入邪恶洞穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22773,\n",
+                u8"    \"Key\": \"EnteringTheDenOfEvilPostQuest\",\n",
+                u8"    \"enUS\": \"Entering The Cave Level 1\",\n",
+                u8"    \"zhTW\": \"進入洞穴第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Grotte, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de la Cueva\",\n",
+                u8"    \"frFR\": \"Entre dans la Grotte niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nella Caverna L1\",\n",
+                u8"    \"koKR\": \"동굴 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Jaskini – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a la Cueva Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈洞窟: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Caverna Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень пещеры\",\n",
+                u8"    \"zhCN\": \"进入洞穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22774,\n",
+                u8"    \"Key\": \"EnteringTheCaveLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Cave Level 1\",\n",
+                u8"    \"zhTW\": \"進入洞穴第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Grotte, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de la Cueva\",\n",
+                u8"    \"frFR\": \"Entre dans la Grotte niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nella Caverna L1\",\n",
+                u8"    \"koKR\": \"동굴 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Jaskini – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a la Cueva Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈洞窟: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Caverna Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень пещеры\",\n",
+                u8"    \"zhCN\": \"进入洞穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22775,\n",
+                u8"    \"Key\": \"EnteringUndergroundPassageLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Underground Passage Level 1\",\n",
+                u8"    \"zhTW\": \"進入地底通道第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Unterirdische Durchgang, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 del Pasadizo Subterráneo\",\n",
+                u8"    \"frFR\": \"Entre dans le Passage souterrain niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nel Passaggio Sotterraneo L1\",\n",
+                u8"    \"koKR\": \"지하 통로 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Podziemnego Tunelu – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando al Pasaje Subterráneo Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈地下道: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Passagem Subterrânea Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень подземного прохода\",\n",
+                u8"    \"zhCN\": \"进入地下通道一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22776,\n",
+                u8"    \"Key\": \"EnteringTheHoleLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Hole Level 1\",\n",
+                u8"    \"zhTW\": \"進入地洞第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Loch, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 del Hoyo\",\n",
+                u8"    \"frFR\": \"Entre dans le Gouffre niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nel Buco L1\",\n",
+                u8"    \"koKR\": \"구렁 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Jamy – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando al Agujero Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈洞穴: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Buraco Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень норы\",\n",
+                u8"    \"zhCN\": \"进入洞坑一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22777,\n",
+                u8"    \"Key\": \"EnteringThePitLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Pit Level 1\",\n",
+                u8"    \"zhTW\": \"進入地穴第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Grube, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 del Foso\",\n",
+                u8"    \"frFR\": \"Entre dans la Fosse niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Abisso L1\",\n",
+                u8"    \"koKR\": \"구덩이 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Czeluści – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando al Foso Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈穴ぐら: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Fosso Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень ямы\",\n",
+                u8"    \"zhCN\": \"进入深渊一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22778,\n",
+                u8"    \"Key\": \"EnteringTheCaveLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Cave Level 2\",\n",
+                u8"    \"zhTW\": \"進入洞穴第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Grotte, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 de la Cueva\",\n",
+                u8"    \"frFR\": \"Entre dans la Grotte niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nella Caverna L2\",\n",
+                u8"    \"koKR\": \"동굴 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Jaskini – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando a la Cueva Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈洞窟: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Caverna Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень пещеры\",\n",
+                u8"    \"zhCN\": \"进入洞穴二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22779,\n",
+                u8"    \"Key\": \"EnteringUndergroundPassageLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Underground Passage Level 2\",\n",
+                u8"    \"zhTW\": \"進入地底通道第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Unterirdische Durchgang, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 del Pasadizo Subterráneo\",\n",
+                u8"    \"frFR\": \"Entre dans le Passage souterrain niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nel Passaggio Sotterraneo L2\",\n",
+                u8"    \"koKR\": \"지하 통로 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Podziemnego Tunelu – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando al Pasaje Subterráneo Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈地下道: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Passagem Subterrânea Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень подземного прохода\",\n",
+                u8"    \"zhCN\": \"进入地下通道二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22780,\n",
+                u8"    \"Key\": \"EnteringTheHoleLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Hole Level 2\",\n",
+                u8"    \"zhTW\": \"進入地洞第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Loch, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 del Hoyo\",\n",
+                u8"    \"frFR\": \"Entre dans le Gouffre niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nel Buco L2\",\n",
+                u8"    \"koKR\": \"구렁 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Jamy – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando al Agujero Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈洞穴: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Buraco Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень норы\",\n",
+                u8"    \"zhCN\": \"进入洞坑二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22781,\n",
+                u8"    \"Key\": \"EnteringThePitLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Pit Level 2\",\n",
+                u8"    \"zhTW\": \"進入地穴第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Grube, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 del Foso\",\n",
+                u8"    \"frFR\": \"Entre dans la Fosse niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Abisso L2\",\n",
+                u8"    \"koKR\": \"구덩이 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Czeluści – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando al Foso Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈穴ぐら: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Fosso Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень ямы\",\n",
+                u8"    \"zhCN\": \"进入深渊二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22782,\n",
+                u8"    \"Key\": \"EnteringTheBurialGrounds\",\n",
+                u8"    \"enUS\": \"Entering The Burial Grounds\",\n",
+                u8"    \"zhTW\": \"進入埋骨之地\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Friedhof\",\n",
+                u8"    \"esES\": \"Entrando en el Cementerio\",\n",
+                u8"    \"frFR\": \"Entre dans le Cimetière\",\n",
+                u8"    \"itIT\": \"Ingresso nel Cimitero\",\n",
+                u8"    \"koKR\": \"매장지에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Cmentarz\",\n",
+                u8"    \"esMX\": \"Entrando al Cementerio\",\n",
+                u8"    \"jaJP\": \"〈墓地〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Cemitério\",\n",
+                u8"    \"ruRU\": \"Погост\",\n",
+                u8"    \"zhCN\": \"进入埋骨之地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22783,\n",
+                u8"    \"Key\": \"EnteringTheCrypt\",\n",
+                u8"    \"enUS\": \"Entering The Crypt\",\n",
+                u8"    \"zhTW\": \"進入墓地\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Krypta\",\n",
+                u8"    \"esES\": \"Entrando en la Cripta\",\n",
+                u8"    \"frFR\": \"Entre dans la Crypte\",\n",
+                u8"    \"itIT\": \"Ingresso nella Cripta\",\n",
+                u8"    \"koKR\": \"묘실에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Krypty\",\n",
+                u8"    \"esMX\": \"Entrando a la Cripta\",\n",
+                u8"    \"jaJP\": \"〈地下墓所〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Cripta\",\n",
+                u8"    \"ruRU\": \"Склеп\",\n",
+                u8"    \"zhCN\": \"进入墓穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22784,\n",
+                u8"    \"Key\": \"EnteringTheMausoleum\",\n",
+                u8"    \"enUS\": \"Entering The Mausoleum\",\n",
+                u8"    \"zhTW\": \"進入大陵墓\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Mausoleum\",\n",
+                u8"    \"esES\": \"Entrando en el Mausoleo\",\n",
+                u8"    \"frFR\": \"Entre dans le Mausolée\",\n",
+                u8"    \"itIT\": \"Ingresso nel Mausoleo\",\n",
+                u8"    \"koKR\": \"영묘에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Mauzoleum\",\n",
+                u8"    \"esMX\": \"Entrando al Mausoleo\",\n",
+                u8"    \"jaJP\": \"〈霊廟〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Mausoléu\",\n",
+                u8"    \"ruRU\": \"Мавзолей\",\n",
+                u8"    \"zhCN\": \"进入寝陵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22785,\n",
+                u8"    \"Key\": \"EnteringTheForgottenTower\",\n",
+                u8"    \"enUS\": \"Entering The Forgotten Tower\",\n",
+                u8"    \"zhTW\": \"進入遺忘之塔\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Vergessene Turm\",\n",
+                u8"    \"esES\": \"Entrando en la Torre Olvidada\",\n",
+                u8"    \"frFR\": \"Entre dans la Tour oubliée\",\n",
+                u8"    \"itIT\": \"Ingresso nella Torre Dimenticata\",\n",
+                u8"    \"koKR\": \"잊힌 탑에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Zapomnianej Wieży\",\n",
+                u8"    \"esMX\": \"Entrando a la Torre Olvidada\",\n",
+                u8"    \"jaJP\": \"〈忘れ去られし塔〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Torre Esquecida\",\n",
+                u8"    \"ruRU\": \"Заброшенная башня\",\n",
+                u8"    \"zhCN\": \"进入被遗忘的高塔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22786,\n",
+                u8"    \"Key\": \"EnteringTheTowerCellarLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Tower Cellar Level 1\",\n",
+                u8"    \"zhTW\": \"進入高塔地牢第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L1\",\n",
+                u8"    \"koKR\": \"탑 지하 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈塔の地下室: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"进入高塔地窖一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22787,\n",
+                u8"    \"Key\": \"EnteringTheTowerCellarLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Tower Cellar Level 2\",\n",
+                u8"    \"zhTW\": \"進入高塔地牢第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L2\",\n",
+                u8"    \"koKR\": \"탑 지하 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈塔の地下室: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"进入高塔地窖二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22788,\n",
+                u8"    \"Key\": \"EnteringTheTowerCellarLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Tower Cellar Level 3\",\n",
+                u8"    \"zhTW\": \"進入高塔地牢第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L3\",\n",
+                u8"    \"koKR\": \"탑 지하 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈塔の地下室: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"进入高塔地窖三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22789,\n",
+                u8"    \"Key\": \"EnteringTheTowerCellarLevel4\",\n",
+                u8"    \"enUS\": \"Entering The Tower Cellar Level 4\",\n",
+                u8"    \"zhTW\": \"進入高塔地牢第四層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 4\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 4 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 4\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L4\",\n",
+                u8"    \"koKR\": \"탑 지하 4층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 4\",\n",
+                u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 4\",\n",
+                u8"    \"jaJP\": \"〈塔の地下室: 第4階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 4\",\n",
+                u8"    \"ruRU\": \"4-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"进入高塔地窖四层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22790,\n",
+                u8"    \"Key\": \"EnteringTheTowerCellarLevel5\",\n",
+                u8"    \"enUS\": \"Entering The Tower Cellar Level 5\",\n",
+                u8"    \"zhTW\": \"進入高塔地牢第五層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Turmkeller, Ebene 5\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 5 del Sótano de la Torre\",\n",
+                u8"    \"frFR\": \"Entre dans la Cave de la Tour niv. 5\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sotterraneo della Torre L5\",\n",
+                u8"    \"koKR\": \"탑 지하 5층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Piwnic pod Wieżą – Poziom 5\",\n",
+                u8"    \"esMX\": \"Entrando al Sótano de la Torre Nivel 5\",\n",
+                u8"    \"jaJP\": \"〈塔の地下室: 第5階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Porão da Torre Nível 5\",\n",
+                u8"    \"ruRU\": \"5-й уровень подвала башни\",\n",
+                u8"    \"zhCN\": \"进入高塔地窖五层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22791,\n",
+                u8"    \"Key\": \"EnteringTheMonasteryGate\",\n",
+                u8"    \"enUS\": \"Entering The Monastery Gate\",\n",
+                u8"    \"zhTW\": \"進入修道院大門\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Klosterpforte\",\n",
+                u8"    \"esES\": \"Entrando en las Puertas del Monasterio\",\n",
+                u8"    \"frFR\": \"Passe les Portes du Monastère\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Atrio del Monastero\",\n",
+                u8"    \"koKR\": \"수도원 정문에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Klasztornej Bramy\",\n",
+                u8"    \"esMX\": \"Entrando a la Entrada del Monasterio\",\n",
+                u8"    \"jaJP\": \"〈修道院の門〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Portão do Monastério\",\n",
+                u8"    \"ruRU\": \"Монастырские ворота\",\n",
+                u8"    \"zhCN\": \"进入修道院大门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22792,\n",
+                u8"    \"Key\": \"EnteringTheOuterCloister\",\n",
+                u8"    \"enUS\": \"Entering The Outer Cloister\",\n",
+                u8"    \"zhTW\": \"進入外側迴廊\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Äußere Kloster\",\n",
+                u8"    \"esES\": \"Entrando en el Claustro Exterior\",\n",
+                u8"    \"frFR\": \"Entre dans le Cloître extérieur\",\n",
+                u8"    \"itIT\": \"Ingresso nel Chiostro Esterno\",\n",
+                u8"    \"koKR\": \"외부 회랑에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Zewnętrznego Monastyru\",\n",
+                u8"    \"esMX\": \"Entrando al Claustro Exterior\",\n",
+                u8"    \"jaJP\": \"〈修道院外部〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Claustro Externo\",\n",
+                u8"    \"ruRU\": \"Внешний двор\",\n",
+                u8"    \"zhCN\": \"进入外侧回廊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22793,\n",
+                u8"    \"Key\": \"EnteringTheBarracks\",\n",
+                u8"    \"enUS\": \"Entering The Barracks\",\n",
+                u8"    \"zhTW\": \"進入兵營\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Kaserne\",\n",
+                u8"    \"esES\": \"Entrando en los Barracones\",\n",
+                u8"    \"frFR\": \"Entre dans la Caserne\",\n",
+                u8"    \"itIT\": \"Ingresso nella Caserma\",\n",
+                u8"    \"koKR\": \"병영에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Koszar\",\n",
+                u8"    \"esMX\": \"Entrando al Cuartel\",\n",
+                u8"    \"jaJP\": \"〈兵舎〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Quartel\",\n",
+                u8"    \"ruRU\": \"Казармы\",\n",
+                u8"    \"zhCN\": \"进入营房\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22794,\n",
+                u8"    \"Key\": \"EnteringTheJailLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Jail Level 1\",\n",
+                u8"    \"zhTW\": \"進入監牢第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Gefängnis, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de la Cárcel\",\n",
+                u8"    \"frFR\": \"Entre dans la Prison niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nella Prigione L1\",\n",
+                u8"    \"koKR\": \"감옥 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Więzienia – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a la Prisión Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈牢獄: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Prisão Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень тюрьмы\",\n",
+                u8"    \"zhCN\": \"进入监牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22795,\n",
+                u8"    \"Key\": \"EnteringTheJailLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Jail Level 2\",\n",
+                u8"    \"zhTW\": \"進入監牢第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Gefängnis, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 de la Cárcel\",\n",
+                u8"    \"frFR\": \"Entre dans la Prison niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nella Prigione L2\",\n",
+                u8"    \"koKR\": \"감옥 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Więzienia – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando a la Prisión Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈牢獄: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Prisão Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень тюрьмы\",\n",
+                u8"    \"zhCN\": \"进入监牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22796,\n",
+                u8"    \"Key\": \"EnteringTheJailLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Jail Level 3\",\n",
+                u8"    \"zhTW\": \"進入監牢第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Gefängnis, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 de la Cárcel\",\n",
+                u8"    \"frFR\": \"Entre dans la Prison niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nella Prigione L3\",\n",
+                u8"    \"koKR\": \"감옥 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Więzienia – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando a la Prisión Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈牢獄: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Prisão Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень тюрьмы\",\n",
+                u8"    \"zhCN\": \"进入监牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22797,\n",
+                u8"    \"Key\": \"EnteringTheInnerCloister\",\n",
+                u8"    \"enUS\": \"Entering The Inner Cloister\",\n",
+                u8"    \"zhTW\": \"進入內側迴廊\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Innere Kloster\",\n",
+                u8"    \"esES\": \"Entrando en el Claustro Interior\",\n",
+                u8"    \"frFR\": \"Entre dans le Cloître intérieur\",\n",
+                u8"    \"itIT\": \"Ingresso nel Chiostro Interno\",\n",
+                u8"    \"koKR\": \"내부 회랑에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Wewnętrznego Monastyru\",\n",
+                u8"    \"esMX\": \"Entrando al Claustro Interno\",\n",
+                u8"    \"jaJP\": \"〈修道院内部〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Claustro Interno\",\n",
+                u8"    \"ruRU\": \"Внутренний двор\",\n",
+                u8"    \"zhCN\": \"进入内侧回廊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22798,\n",
+                u8"    \"Key\": \"EnteringTheCathedral\",\n",
+                u8"    \"enUS\": \"Entering The Cathedral\",\n",
+                u8"    \"zhTW\": \"進入大教堂\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Kathedrale\",\n",
+                u8"    \"esES\": \"Entrando en la Catedral\",\n",
+                u8"    \"frFR\": \"Entre dans la Cathédrale\",\n",
+                u8"    \"itIT\": \"Ingresso nella Cattedrale\",\n",
+                u8"    \"koKR\": \"대성당에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Katedry\",\n",
+                u8"    \"esMX\": \"Entrando a la Catedral\",\n",
+                u8"    \"jaJP\": \"〈大聖堂〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Catedral\",\n",
+                u8"    \"ruRU\": \"Собор\",\n",
+                u8"    \"zhCN\": \"进入大教堂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22799,\n",
+                u8"    \"Key\": \"EnteringTheCatacombsLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Catacombs Level 1\",\n",
+                u8"    \"zhTW\": \"進入地下墓穴第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Katakomben, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de las Catacumbas\",\n",
+                u8"    \"frFR\": \"Entre dans les Catacombes niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Catacombe L1\",\n",
+                u8"    \"koKR\": \"지하 묘지 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Katakumb – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a las Catacumbas Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈地下墓地: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Catacumbas Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень катакомб\",\n",
+                u8"    \"zhCN\": \"进入地下墓穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22800,\n",
+                u8"    \"Key\": \"EnteringTheCatacombsLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Catacombs Level 2\",\n",
+                u8"    \"zhTW\": \"進入地下墓穴第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Katakomben, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 de las Catacumbas\",\n",
+                u8"    \"frFR\": \"Entre dans les Catacombes niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Catacombe L2\",\n",
+                u8"    \"koKR\": \"지하 묘지 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Katakumb – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando a las Catacumbas Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈地下墓地: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Catacumbas Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень катакомб\",\n",
+                u8"    \"zhCN\": \"进入地下墓穴二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22801,\n",
+                u8"    \"Key\": \"EnteringTheCatacombsLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Catacombs Level 3\",\n",
+                u8"    \"zhTW\": \"進入地下墓穴第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Katakomben, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 de las Catacumbas\",\n",
+                u8"    \"frFR\": \"Entre dans les Catacombes niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Catacombe L3\",\n",
+                u8"    \"koKR\": \"지하 묘지 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Katakumb – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando a las Catacumbas Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈地下墓地: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Catacumbas Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень катакомб\",\n",
+                u8"    \"zhCN\": \"进入地下墓穴三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22802,\n",
+                u8"    \"Key\": \"EnteringTheCatacombsLevel4\",\n",
+                u8"    \"enUS\": \"Entering The Catacombs Level 4\",\n",
+                u8"    \"zhTW\": \"進入地下墓穴第四層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Katakomben, Ebene 4\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 4 de las Catacumbas\",\n",
+                u8"    \"frFR\": \"Entre dans les Catacombes niv. 4\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Catacombe L4\",\n",
+                u8"    \"koKR\": \"지하 묘지 4층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Katakumb – Poziom 4\",\n",
+                u8"    \"esMX\": \"Entrando a las Catacumbas Nivel 4\",\n",
+                u8"    \"jaJP\": \"〈地下墓地: 第4階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Catacumbas Nível 4\",\n",
+                u8"    \"ruRU\": \"4-й уровень катакомб\",\n",
+                u8"    \"zhCN\": \"进入地下墓穴四层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22803,\n",
+                u8"    \"Key\": \"EnteringTristram\",\n",
+                u8"    \"enUS\": \"Entering Tristram\",\n",
+                u8"    \"zhTW\": \"進入崔斯特姆\",\n",
+                u8"    \"deDE\": \"Jetzt: Tristram\",\n",
+                u8"    \"esES\": \"Entrando en Tristán\",\n",
+                u8"    \"frFR\": \"Entre dans Tristram\",\n",
+                u8"    \"itIT\": \"Ingresso a Tristram\",\n",
+                u8"    \"koKR\": \"트리스트럼에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Tristram\",\n",
+                u8"    \"esMX\": \"Entrando a Tristram\",\n",
+                u8"    \"jaJP\": \"〈トリストラム〉\",\n",
+                u8"    \"ptBR\": \"Entrando em Tristram\",\n",
+                u8"    \"ruRU\": \"Тристрам\",\n",
+                u8"    \"zhCN\": \"进入崔斯特姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22804,\n",
+                u8"    \"Key\": \"EnteringTheMooMooFarm\",\n",
+                u8"    \"enUS\": \"Entering The Moo Moo Farm\",\n",
+                u8"    \"zhTW\": \"進入哞哞農莊\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Muh-Muh-Farm\",\n",
+                u8"    \"esES\": \"Entrando en la Granja Mu Mu\",\n",
+                u8"    \"frFR\": \"Entre dans la Ferme Meuh-Meuh\",\n",
+                u8"    \"itIT\": \"Ingresso nella Fattoria Muu Muu\",\n",
+                u8"    \"koKR\": \"음메음메 농장에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Farmę Muu Muu\",\n",
+                u8"    \"esMX\": \"Entrando a la Granja Mu Mu\",\n",
+                u8"    \"jaJP\": \"〈秘密のモーモー牧場〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Fazenda Mu-mu\",\n",
+                u8"    \"ruRU\": \"Ферма «Му-му»\",\n",
+                u8"    \"zhCN\": \"进入哞哞农场\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22805,\n",
+                u8"    \"Key\": \"EnteringLutGholein\",\n",
+                u8"    \"enUS\": \"Entering Lut Gholein\",\n",
+                u8"    \"zhTW\": \"進入魯高因\",\n",
+                u8"    \"deDE\": \"Jetzt: Lut Gholein\",\n",
+                u8"    \"esES\": \"Entrando en Lut Gholein\",\n",
+                u8"    \"frFR\": \"Entre dans Lut Gholein\",\n",
+                u8"    \"itIT\": \"Ingresso a Lut Gholein\",\n",
+                u8"    \"koKR\": \"루트 골레인에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Lut Gholein\",\n",
+                u8"    \"esMX\": \"Entrando a Lut Gholein\",\n",
+                u8"    \"jaJP\": \"〈ラット・ゴーレイン〉\",\n",
+                u8"    \"ptBR\": \"Entrando em Lut Gholein\",\n",
+                u8"    \"ruRU\": \"Лут-Голейн\",\n",
+                u8"    \"zhCN\": \"进入鲁·高因\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22806,\n",
+                u8"    \"Key\": \"EnteringTheRockyWaste\",\n",
+                u8"    \"enUS\": \"Entering The Rocky Waste\",\n",
+                u8"    \"zhTW\": \"進入碎石荒地\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Felsige Öde\",\n",
+                u8"    \"esES\": \"Entrando en el Erial Rocoso\",\n",
+                u8"    \"frFR\": \"Entre dans le Désert de roche\",\n",
+                u8"    \"itIT\": \"Ingresso nella Landa Rocciosa\",\n",
+                u8"    \"koKR\": \"바위투성이 황무지에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Skalne Pustkowie\",\n",
+                u8"    \"esMX\": \"Entrando a la Estepa Rocosa\",\n",
+                u8"    \"jaJP\": \"〈岩だらけの荒れ地〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Ermo Rochoso\",\n",
+                u8"    \"ruRU\": \"Каменистая пустошь\",\n",
+                u8"    \"zhCN\": \"进入碎石荒野\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22807,\n",
+                u8"    \"Key\": \"EnteringTheDryHills\",\n",
+                u8"    \"enUS\": \"Entering The Dry Hills\",\n",
+                u8"    \"zhTW\": \"進入乾土高地\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Verdorrten Hügel\",\n",
+                u8"    \"esES\": \"Entrando en las Colinas Áridas\",\n",
+                u8"    \"frFR\": \"Entre dans les Collines arides\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Colline Aride\",\n",
+                u8"    \"koKR\": \"메마른 언덕에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Suche Wzgórza\",\n",
+                u8"    \"esMX\": \"Entrando a las Colinas Áridas\",\n",
+                u8"    \"jaJP\": \"〈乾きの丘〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Colinas Áridas\",\n",
+                u8"    \"ruRU\": \"Иссохшие холмы\",\n",
+                u8"    \"zhCN\": \"进入干燥高地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22808,\n",
+                u8"    \"Key\": \"EnteringTheFarOasis\",\n",
+                u8"    \"enUS\": \"Entering The Far Oasis\",\n",
+                u8"    \"zhTW\": \"進入遙遠的綠洲\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Ferne Oase\",\n",
+                u8"    \"esES\": \"Entrando en el Oasis Lejano\",\n",
+                u8"    \"frFR\": \"Entre dans l’Oasis lointaine\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Oasi Lontana\",\n",
+                u8"    \"koKR\": \"머나먼 오아시스에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Dalekiej Oazy\",\n",
+                u8"    \"esMX\": \"Entrando al Oasis Lejano\",\n",
+                u8"    \"jaJP\": \"〈遥かなるオアシス〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Oásis Longínquo\",\n",
+                u8"    \"ruRU\": \"Дальний оазис\",\n",
+                u8"    \"zhCN\": \"进入偏远绿洲\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22809,\n",
+                u8"    \"Key\": \"EnteringTheLostCity\",\n",
+                u8"    \"enUS\": \"Entering The Lost City\",\n",
+                u8"    \"zhTW\": \"進入失落古城\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Vergessene Stadt\",\n",
+                u8"    \"esES\": \"Entrando en la Ciudad Perdida\",\n",
+                u8"    \"frFR\": \"Entre dans la Ville oubliée\",\n",
+                u8"    \"itIT\": \"Ingresso nella Città Perduta\",\n",
+                u8"    \"koKR\": \"잊힌 도시에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Zaginionego Miasta\",\n",
+                u8"    \"esMX\": \"Entrando a la Ciudad Perdida\",\n",
+                u8"    \"jaJP\": \"〈失われし都〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Cidade Perdida\",\n",
+                u8"    \"ruRU\": \"Затерянный город\",\n",
+                u8"    \"zhCN\": \"进入失落之城\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22810,\n",
+                u8"    \"Key\": \"EnteringTheValleyOfSnakes\",\n",
+                u8"    \"enUS\": \"Entering The Valley of Snakes\",\n",
+                u8"    \"zhTW\": \"進入群蛇峽谷\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Tal der Schlangen\",\n",
+                u8"    \"esES\": \"Entrando en el Valle de las Serpientes\",\n",
+                u8"    \"frFR\": \"Entre dans la Vallée des serpents\",\n",
+                u8"    \"itIT\": \"Ingresso nella Valle dei Serpenti\",\n",
+                u8"    \"koKR\": \"뱀의 골짜기에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Doliny Węży\",\n",
+                u8"    \"esMX\": \"Entrando al Valle de las Culebras\",\n",
+                u8"    \"jaJP\": \"〈蛇の谷〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Vale das Cobras\",\n",
+                u8"    \"ruRU\": \"Долина змей\",\n",
+                u8"    \"zhCN\": \"进入群蛇峡谷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22811,\n",
+                u8"    \"Key\": \"EnteringTheCanyonOfTheMagi\",\n",
+                u8"    \"enUS\": \"Entering The Canyon of the Magi\",\n",
+                u8"    \"zhTW\": \"進入賢者之谷\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Schlucht der Magier\",\n",
+                u8"    \"esES\": \"Entrando en el Cañón de los Magos\",\n",
+                u8"    \"frFR\": \"Entre dans le Canyon des Mages\",\n",
+                u8"    \"itIT\": \"Ingresso nel Canyon dei Maghi\",\n",
+                u8"    \"koKR\": \"신비술사의 협곡에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kanionu Magów\",\n",
+                u8"    \"esMX\": \"Entrando al Cañón de los Magos\",\n",
+                u8"    \"jaJP\": \"〈魔術師の峡谷〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Cânion dos Magi\",\n",
+                u8"    \"ruRU\": \"Каньон волхвов\",\n",
+                u8"    \"zhCN\": \"进入法师峡谷\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22812,\n",
+                u8"    \"Key\": \"EnteringTheSewersLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Sewers Level 1\",\n",
+                u8"    \"zhTW\": \"進入下水道第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Kanalisation, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de las Cloacas\",\n",
+                u8"    \"frFR\": \"Entre dans les Égouts niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Fogne L1\",\n",
+                u8"    \"koKR\": \"하수도 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kanałów – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a las Cloacas Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈下水道: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Esgoto Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень стоков\",\n",
+                u8"    \"zhCN\": \"进入下水道一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22813,\n",
+                u8"    \"Key\": \"EnteringTheSewersLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Sewers Level 2\",\n",
+                u8"    \"zhTW\": \"進入下水道第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Kanalisation, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 de las Cloacas\",\n",
+                u8"    \"frFR\": \"Entre dans les Égouts niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Fogne L2\",\n",
+                u8"    \"koKR\": \"하수도 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kanałów – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando a las Cloacas Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈下水道: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Esgoto Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень стоков\",\n",
+                u8"    \"zhCN\": \"进入下水道二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22814,\n",
+                u8"    \"Key\": \"EnteringTheSewersLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Sewers Level 3\",\n",
+                u8"    \"zhTW\": \"進入下水道第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Kanalisation, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 de las Cloacas\",\n",
+                u8"    \"frFR\": \"Entre dans les Égouts niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Fogne L3\",\n",
+                u8"    \"koKR\": \"하수도 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kanałów – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando a las Cloacas Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈下水道: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Esgoto Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень стоков\",\n",
+                u8"    \"zhCN\": \"进入下水道三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22815,\n",
+                u8"    \"Key\": \"EnteringTheHaremLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Harem Level 1\",\n",
+                u8"    \"zhTW\": \"進入後宮第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Harem, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 del Harén\",\n",
+                u8"    \"frFR\": \"Entre dans le Harem niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Harem L1\",\n",
+                u8"    \"koKR\": \"하렘 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Haremu – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando al Harén Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈ハーレム: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Harém Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень гарема\",\n",
+                u8"    \"zhCN\": \"进入女眷住处一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22816,\n",
+                u8"    \"Key\": \"EnteringTheHaremLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Harem Level 2\",\n",
+                u8"    \"zhTW\": \"進入後宮第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Harem, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 del Harén\",\n",
+                u8"    \"frFR\": \"Entre dans le Harem niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Harem L2\",\n",
+                u8"    \"koKR\": \"하렘 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Haremu – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando al Harén Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈ハーレム: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Harém Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень гарема\",\n",
+                u8"    \"zhCN\": \"进入女眷住处二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22817,\n",
+                u8"    \"Key\": \"EnteringThePalaceCellarLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Palace Cellar Level 1 \",\n",
+                u8"    \"zhTW\": \"進入皇宮地窖第一層 \",\n",
+                u8"    \"deDE\": \"Jetzt: Der Palastkeller, Ebene 1 \",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 del Sótano del Palacio\",\n",
+                u8"    \"frFR\": \"Entre dans les Caves du Palais niv. 1 \",\n",
+                u8"    \"itIT\": \"Ingresso nei Sotterranei del Palazzo L1 \",\n",
+                u8"    \"koKR\": \"궁전 지하 1층에 진입 \",\n",
+                u8"    \"plPL\": \"Wkraczasz do Pałacowych Piwnic – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando al Sótano del Palacio Nivel 1 \",\n",
+                u8"    \"jaJP\": \"〈宮殿地下室: 第1階層〉 \",\n",
+                u8"    \"ptBR\": \"Entrando no Porão do Palácio Nível 1 \",\n",
+                u8"    \"ruRU\": \"1-й уровень дворцового погреба \",\n",
+                u8"    \"zhCN\": \"进入王宫监牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22818,\n",
+                u8"    \"Key\": \"EnteringThePalaceCellarLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Palace Cellar Level 2\",\n",
+                u8"    \"zhTW\": \"進入皇宮地窖第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Palastkeller, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 del Sótano del Palacio\",\n",
+                u8"    \"frFR\": \"Entre dans les Caves du Palais niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nei Sotterranei del Palazzo L2\",\n",
+                u8"    \"koKR\": \"궁전 지하 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Pałacowych Piwnic – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando al Sótano del Palacio Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈宮殿地下室: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Porão do Palácio Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень дворцового погреба\",\n",
+                u8"    \"zhCN\": \"进入王宫监牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22819,\n",
+                u8"    \"Key\": \"EnteringThePalaceCellarLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Palace Cellar Level 3\",\n",
+                u8"    \"zhTW\": \"進入皇宮地窖第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Palastkeller, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 del Sótano del Palacio\",\n",
+                u8"    \"frFR\": \"Entre dans les Caves du Palais niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nei Sotterranei del Palazzo L3\",\n",
+                u8"    \"koKR\": \"궁전 지하 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Pałacowych Piwnic – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando al Sótano del Palacio Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈宮殿地下室: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Porão do Palácio Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень дворцового погреба\",\n",
+                u8"    \"zhCN\": \"进入王宫监牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22820,\n",
+                u8"    \"Key\": \"EnteringTheStonyTombLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Stony Tomb Level 1\",\n",
+                u8"    \"zhTW\": \"進入古老石墓第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Steingrab, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de la Tumba Pedregosa\",\n",
+                u8"    \"frFR\": \"Entre dans le Tombeau de pierre niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nella Tomba di Pietra L1\",\n",
+                u8"    \"koKR\": \"바위 무덤 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kamiennego Grobowca – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a la Tumba Pedregosa Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈石造りの墓所: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Tumba Pétrea Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень каменной гробницы\",\n",
+                u8"    \"zhCN\": \"进入碎石古墓一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22821,\n",
+                u8"    \"Key\": \"EnteringTheHallsOfTheDeadLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Halls of the Dead Level 1\",\n",
+                u8"    \"zhTW\": \"進入死亡之殿第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Hallen der Toten, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de las Salas de la Muerte\",\n",
+                u8"    \"frFR\": \"Entre dans les Couloirs des morts niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Sale dei Morti L1\",\n",
+                u8"    \"koKR\": \"망자의 전당 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Sal Umarłych – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a las Salas de la Muerte Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈亡者の広間: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando nos Salões dos Mortos Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень Чертогов Мертвых\",\n",
+                u8"    \"zhCN\": \"进入亡者大殿一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22822,\n",
+                u8"    \"Key\": \"EnteringTheHallsOfTheDeadLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Halls of the Dead Level 2\",\n",
+                u8"    \"zhTW\": \"進入死亡之殿第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Hallen der Toten, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 de las Salas de la Muerte\",\n",
+                u8"    \"frFR\": \"Entre dans les Couloirs des morts niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Sale dei Morti L2\",\n",
+                u8"    \"koKR\": \"망자의 전당 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Sal Umarłych – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando a las Salas de la Muerte Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈亡者の広間: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando nos Salões dos Mortos Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень Чертогов Мертвых\",\n",
+                u8"    \"zhCN\": \"进入亡者大殿二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22823,\n",
+                u8"    \"Key\": \"EnteringTheClawViperTempleLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Claw Viper Temple Level 1\",\n",
+                u8"    \"zhTW\": \"進入利爪蛇魔神殿第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Tempel der Klauenvipern, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 del Templo de la Garra Viperina\",\n",
+                u8"    \"frFR\": \"Entre dans le Temple des Vipères, niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nel Tempio delle Vipere L1\",\n",
+                u8"    \"koKR\": \"발톱 독사 사원 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Świątyni Żmijoszponów – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando al Templo del Vipérido de Garras Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈クロウ・ヴァイパーの寺院: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Templo da Víbora da Garra Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень храма Когтистого Змея\",\n",
+                u8"    \"zhCN\": \"进入利爪蝮蛇神殿一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22824,\n",
+                u8"    \"Key\": \"EnteringTheStonyTombLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Stony Tomb Level 2\",\n",
+                u8"    \"zhTW\": \"進入古老石墓第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Steingrab, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 de la Tumba Pedregosa\",\n",
+                u8"    \"frFR\": \"Entre dans le Tombeau de pierre niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nella Tomba di Pietra L2\",\n",
+                u8"    \"koKR\": \"바위 무덤 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kamiennego Grobowca – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando a la Tumba Pedregosa Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈石造りの墓所: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Tumba Pétrea Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень каменной гробницы\",\n",
+                u8"    \"zhCN\": \"进入碎石古墓二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22825,\n",
+                u8"    \"Key\": \"EnteringTheHallsOfTheDeadLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Halls of the Dead Level 3\",\n",
+                u8"    \"zhTW\": \"進入死亡之殿第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Hallen der Toten, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 de las Salas de la Muerte\",\n",
+                u8"    \"frFR\": \"Entre dans les Couloirs des morts niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Sale dei Morti L3\",\n",
+                u8"    \"koKR\": \"망자의 전당 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Sal Umarłych – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando a las Salas de la Muerte Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈亡者の広間: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando nos Salões dos Mortos Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень Чертогов Мертвых\",\n",
+                u8"    \"zhCN\": \"进入亡者大殿三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22826,\n",
+                u8"    \"Key\": \"EnteringTheClawViperTempleLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Claw Viper Temple Level 2\",\n",
+                u8"    \"zhTW\": \"進入利爪蛇魔神殿第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Tempel der Klauenvipern, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 del Templo de la Garra Viperina\",\n",
+                u8"    \"frFR\": \"Entre dans le Temple des Vipères, niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nel Tempio delle Vipere L2\",\n",
+                u8"    \"koKR\": \"발톱 독사 사원 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Świątyni Żmijoszponów – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando al Templo del Vipérido de Garras Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈クロウ・ヴァイパーの寺院: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Templo da Víbora da Garra Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень храма Когтистого Змея\",\n",
+                u8"    \"zhCN\": \"进入利爪蝮蛇神殿二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22827,\n",
+                u8"    \"Key\": \"EnteringTheMaggotLairLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Maggot Lair Level 1\",\n",
+                u8"    \"zhTW\": \"進入蛆蟲巢穴第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Wurmgruft, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 del Cubil de Gusanos\",\n",
+                u8"    \"frFR\": \"Entre dans le Repaire du ver, niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nel Covo delle Larve L1\",\n",
+                u8"    \"koKR\": \"구더기 굴 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Robaczego Gniazda – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a la Guarida de Gusanos Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈地虫の巣穴: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Covil de Vermes Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень логова мокриц\",\n",
+                u8"    \"zhCN\": \"进入蛆虫巢穴一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22828,\n",
+                u8"    \"Key\": \"EnteringTheMaggotLairLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Maggot Lair Level 2\",\n",
+                u8"    \"zhTW\": \"進入蛆蟲巢穴第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Wurmgruft, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 del Cubil de Gusanos\",\n",
+                u8"    \"frFR\": \"Entre dans le Repaire du ver, niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nel Covo delle Larve L2\",\n",
+                u8"    \"koKR\": \"구더기 굴 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Robaczego Gniazda – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando a la Guarida de Gusanos Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈地虫の巣穴: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Covil de Vermes Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень логова мокриц\",\n",
+                u8"    \"zhCN\": \"进入蛆虫巢穴二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22829,\n",
+                u8"    \"Key\": \"EnteringTheMaggotLairLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Maggot Lair Level 3\",\n",
+                u8"    \"zhTW\": \"進入蛆蟲巢穴第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Wurmgruft, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 del Cubil de Gusanos\",\n",
+                u8"    \"frFR\": \"Entre dans le Repaire du ver, niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nel Covo delle Larve L3\",\n",
+                u8"    \"koKR\": \"구더기 굴 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Robaczego Gniazda – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando a la Guarida de Gusanos Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈地虫の巣穴: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Covil de Vermes Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень логова мокриц\",\n",
+                u8"    \"zhCN\": \"进入蛆虫巢穴三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22830,\n",
+                u8"    \"Key\": \"EnteringTheAncientTunnels\",\n",
+                u8"    \"enUS\": \"Entering The Ancient Tunnels\",\n",
+                u8"    \"zhTW\": \"進入古代通道\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Alten Tunnel\",\n",
+                u8"    \"esES\": \"Entrando en los Túneles Antiguos\",\n",
+                u8"    \"frFR\": \"Entre dans les Tunnels antiques\",\n",
+                u8"    \"itIT\": \"Ingresso negli Antichi Tunnel\",\n",
+                u8"    \"koKR\": \"고대 토굴에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Prastarych Tuneli\",\n",
+                u8"    \"esMX\": \"Entrando a los Túneles Antiguos\",\n",
+                u8"    \"jaJP\": \"〈古の坑道〉\",\n",
+                u8"    \"ptBR\": \"Entrando nos Túneis Ancestrais\",\n",
+                u8"    \"ruRU\": \"Древние туннели\",\n",
+                u8"    \"zhCN\": \"进入古代水道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22831,\n",
+                u8"    \"Key\": \"EnteringTalRasha'sTomb\",\n",
+                u8"    \"enUS\": \"Entering Tal Rasha's Tomb\",\n",
+                u8"    \"zhTW\": \"進入塔拉夏的古墓\",\n",
+                u8"    \"deDE\": \"Jetzt: Tal Rashas Grab\",\n",
+                u8"    \"esES\": \"Entrando en la Tumba de Tal Rasha\",\n",
+                u8"    \"frFR\": \"Entre dans le Tombeau de Tal Rasha\",\n",
+                u8"    \"itIT\": \"Ingresso nella Tomba di Tal Rasha\",\n",
+                u8"    \"koKR\": \"탈 라샤의 무덤에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Grobowca Tal Rashy\",\n",
+                u8"    \"esMX\": \"Entrando a la Tumba de Tal Rasha\",\n",
+                u8"    \"jaJP\": \"〈タル・ラシャの墓〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Tumba de Tal Rasha\",\n",
+                u8"    \"ruRU\": \"Гробница Тал Раши\",\n",
+                u8"    \"zhCN\": \"进入塔·拉夏之墓\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22832,\n",
+                u8"    \"Key\": \"EnteringDuriel'sLair\",\n",
+                u8"    \"enUS\": \"Entering Tal Rasha's Chamber\",\n",
+                u8"    \"zhTW\": \"進入塔拉夏的密室\",\n",
+                u8"    \"deDE\": \"Jetzt: Tal Rashas Kammer\",\n",
+                u8"    \"esES\": \"Entrando en la Cámara de Tal Rasha\",\n",
+                u8"    \"frFR\": \"Entre dans la Chambre de Tal Rasha\",\n",
+                u8"    \"itIT\": \"Ingresso nella Cripta di Tal Rasha\",\n",
+                u8"    \"koKR\": \"탈 라샤의 방에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Komnaty Tal Rashy\",\n",
+                u8"    \"esMX\": \"Entrando a la Cámara de Tal Rasha\",\n",
+                u8"    \"jaJP\": \"〈タル・ラシャの間〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Câmara de Tal Rasha\",\n",
+                u8"    \"ruRU\": \"Погребальный зал Тал Раши\",\n",
+                u8"    \"zhCN\": \"进入塔·拉夏的墓室\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22833,\n",
+                u8"    \"Key\": \"EnteringTheArcaneSanctuary\",\n",
+                u8"    \"enUS\": \"Entering The Arcane Sanctuary\",\n",
+                u8"    \"zhTW\": \"進入秘法聖殿\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Geheime Zuflucht\",\n",
+                u8"    \"esES\": \"Entrando en el Santuario Arcano\",\n",
+                u8"    \"frFR\": \"Entre dans le Sanctuaire des Arcanes\",\n",
+                u8"    \"itIT\": \"Ingresso nel Santuario Arcano\",\n",
+                u8"    \"koKR\": \"비전의 성역에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Tajemnego Sanktuarium\",\n",
+                u8"    \"esMX\": \"Entrando al Santuario Arcano\",\n",
+                u8"    \"jaJP\": \"〈深遠なる聖域〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Santuário Arcano\",\n",
+                u8"    \"ruRU\": \"Магическое убежище\",\n",
+                u8"    \"zhCN\": \"进入神秘避难所\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22834,\n",
+                u8"    \"Key\": \"EnteringTheKurastDocktown\",\n",
+                u8"    \"enUS\": \"Entering The Kurast Docks\",\n",
+                u8"    \"zhTW\": \"進入庫拉斯特港口\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Docks von Kurast\",\n",
+                u8"    \"esES\": \"Entrando en los Muelles de Kurast\",\n",
+                u8"    \"frFR\": \"Entre dans les Quais de Kurast\",\n",
+                u8"    \"itIT\": \"Ingresso nella Zona Portuale di Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 부두에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Doków Kurast\",\n",
+                u8"    \"esMX\": \"Entrando a los Muelles de Kurast\",\n",
+                u8"    \"jaJP\": \"〈クラスト港〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Docas de Kurast\",\n",
+                u8"    \"ruRU\": \"Доки Кураста\",\n",
+                u8"    \"zhCN\": \"进入库拉斯特海港\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22835,\n",
+                u8"    \"Key\": \"EnteringTheSpiderForest\",\n",
+                u8"    \"enUS\": \"Entering The Spider Forest\",\n",
+                u8"    \"zhTW\": \"進入蜘蛛森林\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Spinnenwald\",\n",
+                u8"    \"esES\": \"Entrando en el Bosque de Arañas\",\n",
+                u8"    \"frFR\": \"Entre dans la Forêt de l’Araignée\",\n",
+                u8"    \"itIT\": \"Ingresso nella Foresta del Ragno\",\n",
+                u8"    \"koKR\": \"거미 숲에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Lasu Pająków\",\n",
+                u8"    \"esMX\": \"Entrando al Bosque de Arañas\",\n",
+                u8"    \"jaJP\": \"〈蜘蛛の森〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Floresta Aracnídea\",\n",
+                u8"    \"ruRU\": \"Паучий лес\",\n",
+                u8"    \"zhCN\": \"进入蜘蛛森林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22836,\n",
+                u8"    \"Key\": \"EnteringTheGreatMarsh\",\n",
+                u8"    \"enUS\": \"Entering The Great Marsh\",\n",
+                u8"    \"zhTW\": \"進入大沼澤\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Große Moor\",\n",
+                u8"    \"esES\": \"Entrando en el Gran Pantano\",\n",
+                u8"    \"frFR\": \"Entre dans le Grand marais\",\n",
+                u8"    \"itIT\": \"Ingresso nella Grande Palude\",\n",
+                u8"    \"koKR\": \"거대 습지에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Wielkie Moczary\",\n",
+                u8"    \"esMX\": \"Entrando a la Gran Marisma\",\n",
+                u8"    \"jaJP\": \"〈大湿原〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Grande Charco\",\n",
+                u8"    \"ruRU\": \"Болотина\",\n",
+                u8"    \"zhCN\": \"进入庞大湿地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22837,\n",
+                u8"    \"Key\": \"EnteringTheFlayerJungle\",\n",
+                u8"    \"enUS\": \"Entering The Flayer Jungle\",\n",
+                u8"    \"zhTW\": \"進入剝皮叢林\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Schinderdschungel\",\n",
+                u8"    \"esES\": \"Entrando en la Selva Desolladora\",\n",
+                u8"    \"frFR\": \"Entre dans la Jungle de l’Écorcheur\",\n",
+                u8"    \"itIT\": \"Ingresso nella Giungla Scorticatrice\",\n",
+                u8"    \"koKR\": \"약탈자 밀림에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Dżungli Łupieżców\",\n",
+                u8"    \"esMX\": \"Entrando a la Jungla de los Desolladores\",\n",
+                u8"    \"jaJP\": \"〈フレイヤーの密林〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Selva dos Esfoladores\",\n",
+                u8"    \"ruRU\": \"Джунгли свежевателей\",\n",
+                u8"    \"zhCN\": \"进入剥皮魔丛林\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22838,\n",
+                u8"    \"Key\": \"EnteringLowerKurast\",\n",
+                u8"    \"enUS\": \"Entering Lower Kurast\",\n",
+                u8"    \"zhTW\": \"進入庫拉斯特下層\",\n",
+                u8"    \"deDE\": \"Jetzt: Unterkurast\",\n",
+                u8"    \"esES\": \"Entrando en la Parte Baja de Kurast\",\n",
+                u8"    \"frFR\": \"Entre dans la ville basse de Kurast\",\n",
+                u8"    \"itIT\": \"Ingresso a Kurast Inferiore\",\n",
+                u8"    \"koKR\": \"하부 쿠라스트에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Dolnego Kurast\",\n",
+                u8"    \"esMX\": \"Entrando a Baja Kurast\",\n",
+                u8"    \"jaJP\": \"〈クラスト下層〉\",\n",
+                u8"    \"ptBR\": \"Entrando em Kurast Inferior\",\n",
+                u8"    \"ruRU\": \"Нижний Кураст\",\n",
+                u8"    \"zhCN\": \"进入库拉斯特下层区\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22839,\n",
+                u8"    \"Key\": \"EnteringTheKurastBazaar\",\n",
+                u8"    \"enUS\": \"Entering The Kurast Bazaar\",\n",
+                u8"    \"zhTW\": \"進入庫拉斯特市集\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Basar von Kurast\",\n",
+                u8"    \"esES\": \"Entrando en el Bazar de Kurast\",\n",
+                u8"    \"frFR\": \"Entre dans le Bazar de Kurast\",\n",
+                u8"    \"itIT\": \"Ingresso nel Bazar di Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 시장에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Bazar Kurast\",\n",
+                u8"    \"esMX\": \"Entrando al Bazar de Kurast\",\n",
+                u8"    \"jaJP\": \"〈クラスト・バザール〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Bazar de Kurast\",\n",
+                u8"    \"ruRU\": \"Курастский базар\",\n",
+                u8"    \"zhCN\": \"进入库拉斯特集市\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22840,\n",
+                u8"    \"Key\": \"EnteringUpperKurast\",\n",
+                u8"    \"enUS\": \"Entering Upper Kurast\",\n",
+                u8"    \"zhTW\": \"進入庫拉斯特上層\",\n",
+                u8"    \"deDE\": \"Jetzt: Oberkurast\",\n",
+                u8"    \"esES\": \"Entrando en la Parte Alta de Kurast\",\n",
+                u8"    \"frFR\": \"Entre dans la ville haute de Kurast\",\n",
+                u8"    \"itIT\": \"Ingresso a Kurast Superiore\",\n",
+                u8"    \"koKR\": \"상부 쿠라스트에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Górnego Kurast\",\n",
+                u8"    \"esMX\": \"Entrando a Alta Kurast\",\n",
+                u8"    \"jaJP\": \"〈クラスト上層〉\",\n",
+                u8"    \"ptBR\": \"Entrando em Kurast Superior\",\n",
+                u8"    \"ruRU\": \"Верхний Кураст\",\n",
+                u8"    \"zhCN\": \"进入库拉斯特上层区\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22841,\n",
+                u8"    \"Key\": \"EnteringTheKurastCauseway\",\n",
+                u8"    \"enUS\": \"Entering The Kurast Causeway\",\n",
+                u8"    \"zhTW\": \"進入庫拉斯特堤道\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Damm von Kurast\",\n",
+                u8"    \"esES\": \"Entrando en la Calzada de Kurast\",\n",
+                u8"    \"frFR\": \"Entre dans la Chaussée de Kurast\",\n",
+                u8"    \"itIT\": \"Ingresso nella Strada per Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 둑길에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Groblę Kurast\",\n",
+                u8"    \"esMX\": \"Entrando a la Calzada de Kurast\",\n",
+                u8"    \"jaJP\": \"〈クラスト舗道〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Passagem de Kurast\",\n",
+                u8"    \"ruRU\": \"Курастская дамба\",\n",
+                u8"    \"zhCN\": \"进入库拉斯特堤道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22842,\n",
+                u8"    \"Key\": \"EnteringTravincal\",\n",
+                u8"    \"enUS\": \"Entering Travincal\",\n",
+                u8"    \"zhTW\": \"進入崔凡克\",\n",
+                u8"    \"deDE\": \"Jetzt: Travincal\",\n",
+                u8"    \"esES\": \"Entrando en Travincal\",\n",
+                u8"    \"frFR\": \"Entre dans Travincal\",\n",
+                u8"    \"itIT\": \"Ingresso a Travincal\",\n",
+                u8"    \"koKR\": \"트라빈칼에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Travincal\",\n",
+                u8"    \"esMX\": \"Entrando a Travincal\",\n",
+                u8"    \"jaJP\": \"〈トラヴィンカル〉\",\n",
+                u8"    \"ptBR\": \"Entrando em Travincal\",\n",
+                u8"    \"ruRU\": \"Травинкаль\",\n",
+                u8"    \"zhCN\": \"进入崔凡克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22843,\n",
+                u8"    \"Key\": \"EnteringTheSpiderCave\",\n",
+                u8"    \"enUS\": \"Entering The Arachnid Lair\",\n",
+                u8"    \"zhTW\": \"進入蜘蛛巢穴\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Spinnenmonstergruft\",\n",
+                u8"    \"esES\": \"Entrando en el Cubil Arácnido\",\n",
+                u8"    \"frFR\": \"Entre dans le Repaire de l’Arachnide\",\n",
+                u8"    \"itIT\": \"Ingresso nel Covo degli Aracnidi\",\n",
+                u8"    \"koKR\": \"독거미 둥지에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Legowiska Arachnidów\",\n",
+                u8"    \"esMX\": \"Entrando a la Guarida Arácnida\",\n",
+                u8"    \"jaJP\": \"〈蜘蛛の巣穴〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Covil Aracnídeo\",\n",
+                u8"    \"ruRU\": \"Логово арахнидов\",\n",
+                u8"    \"zhCN\": \"进入巨蛛巢穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22844,\n",
+                u8"    \"Key\": \"EnteringTheSpiderCavern\",\n",
+                u8"    \"enUS\": \"Entering The Spider Cavern\",\n",
+                u8"    \"zhTW\": \"進入蜘蛛洞窟\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Spinnenhöhle\",\n",
+                u8"    \"esES\": \"Entrando en la Caverna de Arañas\",\n",
+                u8"    \"frFR\": \"Entre dans la Caverne de l’Araignée\",\n",
+                u8"    \"itIT\": \"Ingresso nella Caverna del Ragno\",\n",
+                u8"    \"koKR\": \"거미 동굴에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Groty Pająków\",\n",
+                u8"    \"esMX\": \"Entrando a la Caverna de Arañas\",\n",
+                u8"    \"jaJP\": \"〈蜘蛛の洞窟〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Caverna Aracnídea\",\n",
+                u8"    \"ruRU\": \"Паучья пещера\",\n",
+                u8"    \"zhCN\": \"进入蜘蛛洞穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22845,\n",
+                u8"    \"Key\": \"EnteringTheSwampyPitLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Swampy Pit Level 1\",\n",
+                u8"    \"zhTW\": \"進入沼澤地穴第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Sumpfloch, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 del Foso Pantanoso\",\n",
+                u8"    \"frFR\": \"Entre dans le Bourbier niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Abisso Paludoso L1\",\n",
+                u8"    \"koKR\": \"습한 구덩이 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Bagiennej Czeluści – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando al Foso Pantanoso Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈沼地の穴ぐら: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Fosso Pantanoso Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень Глубокой трясины\",\n",
+                u8"    \"zhCN\": \"进入沼泽陷坑一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22846,\n",
+                u8"    \"Key\": \"EnteringTheSwampyPitLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Swampy Pit Level 2\",\n",
+                u8"    \"zhTW\": \"進入沼澤地穴第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Sumpfloch, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 del Foso Pantanoso\",\n",
+                u8"    \"frFR\": \"Entre dans le Bourbier niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Abisso Paludoso L2\",\n",
+                u8"    \"koKR\": \"습한 구덩이 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Bagiennej Czeluści – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando al Foso Pantanoso Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈沼地の穴ぐら: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Fosso Pantanoso Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень Глубокой трясины\",\n",
+                u8"    \"zhCN\": \"进入沼泽陷坑二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22847,\n",
+                u8"    \"Key\": \"EnteringTheFlayerDungeonLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Flayer Dungeon Level 1\",\n",
+                u8"    \"zhTW\": \"進入剝皮地牢第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Schinderdungeon, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de la Mazmorra de Desollamiento\",\n",
+                u8"    \"frFR\": \"Entre dans la Prison de l’Écorcheur niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sotterraneo Scorticatore L1\",\n",
+                u8"    \"koKR\": \"약탈자 소굴 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Podziemi Łupieżców – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando al Calabozo de los Desolladores Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈フレイヤーの地下牢: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Masmorra dos Esfoladores Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень Подземелья свежевателей\",\n",
+                u8"    \"zhCN\": \"进入剥皮魔监牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22848,\n",
+                u8"    \"Key\": \"EnteringTheFlayerDungeonLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Flayer Dungeon Level 2\",\n",
+                u8"    \"zhTW\": \"進入剝皮地牢第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Schinderdungeon, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 de la Mazmorra de Desollamiento\",\n",
+                u8"    \"frFR\": \"Entre dans la Prison de l’Écorcheur niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sotterraneo Scorticatore L2\",\n",
+                u8"    \"koKR\": \"약탈자 소굴 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Podziemi Łupieżców – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando al Calabozo de los Desolladores Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈フレイヤーの地下牢: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Masmorra dos Esfoladores Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень Подземелья свежевателей\",\n",
+                u8"    \"zhCN\": \"进入剥皮魔监牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22849,\n",
+                u8"    \"Key\": \"EnteringTheSwampyPitLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Swampy Pit Level 3\",\n",
+                u8"    \"zhTW\": \"進入沼澤地穴第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Sumpfloch, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 del Foso Pantanoso\",\n",
+                u8"    \"frFR\": \"Entre dans le Bourbier niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Abisso Paludoso L3\",\n",
+                u8"    \"koKR\": \"습한 구덩이 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Bagiennej Czeluści – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando al Foso Pantanoso Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈沼地の穴ぐら: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Fosso Pantanoso Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень Глубокой трясины\",\n",
+                u8"    \"zhCN\": \"进入沼泽陷坑三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22850,\n",
+                u8"    \"Key\": \"EnteringTheFlayerDungeonLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Flayer Dungeon Level 3\",\n",
+                u8"    \"zhTW\": \"進入剝皮地牢第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Schinderdungeon, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 de la Mazmorra de Desollamiento\",\n",
+                u8"    \"frFR\": \"Entre dans la Prison de l’Écorcheur niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sotterraneo Scorticatore L3\",\n",
+                u8"    \"koKR\": \"약탈자 소굴 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Podziemi Łupieżców – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando al Calabozo de los Desolladores Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈フレイヤーの地下牢: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Masmorra dos Esfoladores Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень Подземелья свежевателей\",\n",
+                u8"    \"zhCN\": \"进入剥皮魔监牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22853,\n",
+                u8"    \"Key\": \"EnteringTheRuinedTemple\",\n",
+                u8"    \"enUS\": \"Entering The Ruined Temple\",\n",
+                u8"    \"zhTW\": \"進入荒廢的神殿\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Zerfallene Tempel\",\n",
+                u8"    \"esES\": \"Entrando en el Templo en Ruinas\",\n",
+                u8"    \"frFR\": \"Entre dans le Temple en ruine\",\n",
+                u8"    \"itIT\": \"Ingresso nel Tempio in Rovina\",\n",
+                u8"    \"koKR\": \"허물어진 사원에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Zrujnowanej Świątyni\",\n",
+                u8"    \"esMX\": \"Entrando al Templo Destruido\",\n",
+                u8"    \"jaJP\": \"〈荒れ果てた寺院〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Templo Arruinado\",\n",
+                u8"    \"ruRU\": \"Разрушенный храм\",\n",
+                u8"    \"zhCN\": \"进入毁灭的神庙\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22854,\n",
+                u8"    \"Key\": \"EnteringTheDisusedFane\",\n",
+                u8"    \"enUS\": \"Entering The Disused Fane\",\n",
+                u8"    \"zhTW\": \"進入廢棄的寺院\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Verlassene Heiligtum\",\n",
+                u8"    \"esES\": \"Entrando en el Fano Abandonado\",\n",
+                u8"    \"frFR\": \"Entre dans le Sanctuaire abandonné\",\n",
+                u8"    \"itIT\": \"Ingresso nel Tempio Abbandonato\",\n",
+                u8"    \"koKR\": \"버려진 교회당에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Opuszczonej Kaplicy\",\n",
+                u8"    \"esMX\": \"Entrando al Santuario Abandonado\",\n",
+                u8"    \"jaJP\": \"〈打ち捨てられし神殿〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Ádito Abandonado\",\n",
+                u8"    \"ruRU\": \"Заброшенная церковь\",\n",
+                u8"    \"zhCN\": \"进入废弃的礼拜堂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22855,\n",
+                u8"    \"Key\": \"EnteringTheForgottenReliquary\",\n",
+                u8"    \"enUS\": \"Entering The Forgotten Reliquary\",\n",
+                u8"    \"zhTW\": \"進入遺忘的聖殿\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Vergessene Reliquienschrein\",\n",
+                u8"    \"esES\": \"Entrando en el Relicario Olvidado\",\n",
+                u8"    \"frFR\": \"Entre dans le Reliquaire oublié\",\n",
+                u8"    \"itIT\": \"Ingresso nel Reliquiario Dimenticato\",\n",
+                u8"    \"koKR\": \"잊힌 성물실에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Zapomnianego Relikwiarza\",\n",
+                u8"    \"esMX\": \"Entrando al Relicario Olvidado\",\n",
+                u8"    \"jaJP\": \"〈忘れ去られし聖廟〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Relicário Esquecido\",\n",
+                u8"    \"ruRU\": \"Забытый реликварий\",\n",
+                u8"    \"zhCN\": \"进入被遗忘的藏骨室\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22856,\n",
+                u8"    \"Key\": \"EnteringTheForgottenTemple\",\n",
+                u8"    \"enUS\": \"Entering The Forgotten Temple\",\n",
+                u8"    \"zhTW\": \"進入遺忘神殿\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Vergessene Tempel\",\n",
+                u8"    \"esES\": \"Entrando en el Templo Olvidado\",\n",
+                u8"    \"frFR\": \"Entre dans le Temple oublié\",\n",
+                u8"    \"itIT\": \"Ingresso nel Tempio Dimenticato\",\n",
+                u8"    \"koKR\": \"잊힌 사원에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Zapomnianej Świątyni\",\n",
+                u8"    \"esMX\": \"Entrando al Templo Olvidado\",\n",
+                u8"    \"jaJP\": \"〈忘れ去られし寺院〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Templo Esquecido\",\n",
+                u8"    \"ruRU\": \"Забытый храм\",\n",
+                u8"    \"zhCN\": \"进入被遗忘的神殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22857,\n",
+                u8"    \"Key\": \"EnteringTheRuinedFane\",\n",
+                u8"    \"enUS\": \"Entering The Ruined Fane\",\n",
+                u8"    \"zhTW\": \"進入荒廢的寺院\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Zerfallene Heiligtum\",\n",
+                u8"    \"esES\": \"Entrando en el Fano en Ruinas\",\n",
+                u8"    \"frFR\": \"Entre dans le Sanctuaire en ruine\",\n",
+                u8"    \"itIT\": \"Ingresso nel Tempio Antico\",\n",
+                u8"    \"koKR\": \"허물어진 교회당에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Zrujnowanej Kaplicy\",\n",
+                u8"    \"esMX\": \"Entrando al Santuario Destruido\",\n",
+                u8"    \"jaJP\": \"〈荒れ果てた神殿〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Ádito Arruinado\",\n",
+                u8"    \"ruRU\": \"Разрушенная церковь\",\n",
+                u8"    \"zhCN\": \"进入被毁的礼拜堂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22858,\n",
+                u8"    \"Key\": \"EnteringTheDisusedReliquary\",\n",
+                u8"    \"enUS\": \"Entering The Disused Reliquary\",\n",
+                u8"    \"zhTW\": \"進入廢棄的聖殿\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Verlassene Reliquienschrein\",\n",
+                u8"    \"esES\": \"Entrando en el Relicario Abandonado\",\n",
+                u8"    \"frFR\": \"Entre dans le Reliquaire abandonné\",\n",
+                u8"    \"itIT\": \"Ingresso nel Reliquiario Abbandonato\",\n",
+                u8"    \"koKR\": \"버려진 성물실에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Opuszczonego Relikwiarza\",\n",
+                u8"    \"esMX\": \"Entrando al Relicario Abandonado\",\n",
+                u8"    \"jaJP\": \"〈打ち捨てられし聖廟〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Relicário Abandonado\",\n",
+                u8"    \"ruRU\": \"Заброшенный реликварий\",\n",
+                u8"    \"zhCN\": \"进入废弃的藏骨室\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22859,\n",
+                u8"    \"Key\": \"EnteringTheDuranceOfHateLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Durance of Hate Level 1\",\n",
+                u8"    \"zhTW\": \"進入憎恨囚牢第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Kerker des Hasses, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de la Represión del Odio\",\n",
+                u8"    \"frFR\": \"Entre dans la Prison de la Haine niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nella Prigione dell'Odio L1\",\n",
+                u8"    \"koKR\": \"증오의 억류지 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kazamat Nienawiści – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a la Prisión de Odio Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈憎悪の檻: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Cárcere do Ódio Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень Узилища Ненависти\",\n",
+                u8"    \"zhCN\": \"进入憎恨囚牢一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22860,\n",
+                u8"    \"Key\": \"EnteringTheDuranceOfHateLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Durance of Hate Level 2\",\n",
+                u8"    \"zhTW\": \"進入憎恨囚牢第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Kerker des Hasses, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 de la Represión del Odio\",\n",
+                u8"    \"frFR\": \"Entre dans la Prison de la Haine niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nella Prigione dell'Odio L2\",\n",
+                u8"    \"koKR\": \"증오의 억류지 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kazamat Nienawiści – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando a la Prisión de Odio Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈憎悪の檻: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Cárcere do Ódio Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень Узилища Ненависти\",\n",
+                u8"    \"zhCN\": \"进入憎恨囚牢二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22861,\n",
+                u8"    \"Key\": \"EnteringTheDuranceOfHateLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Durance of Hate Level 3\",\n",
+                u8"    \"zhTW\": \"進入憎恨囚牢第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Kerker des Hasses, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 de la Represión del Odio\",\n",
+                u8"    \"frFR\": \"Entre dans la Prison de la Haine niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nella Prigione dell'Odio L3\",\n",
+                u8"    \"koKR\": \"증오의 억류지 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kazamat Nienawiści – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando a la Prisión de Odio Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈憎悪の檻: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Cárcere do Ódio Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень Узилища Ненависти\",\n",
+                u8"    \"zhCN\": \"进入憎恨囚牢三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22862,\n",
+                u8"    \"Key\": \"EnteringThePandemoniumFortress\",\n",
+                u8"    \"enUS\": \"Entering The Pandemonium Fortress\",\n",
+                u8"    \"zhTW\": \"進入混沌界要塞\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Festung des Wahnsinns\",\n",
+                u8"    \"esES\": \"Entrando en la Fortaleza del Pandemónium\",\n",
+                u8"    \"frFR\": \"Entre dans la Forteresse de Pandémonium\",\n",
+                u8"    \"itIT\": \"Ingresso nella Fortezza del Pandemonio\",\n",
+                u8"    \"koKR\": \"혼돈의 요새에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Fortecy Pandemonium\",\n",
+                u8"    \"esMX\": \"Entrando a la Fortaleza del Pandemonio\",\n",
+                u8"    \"jaJP\": \"〈伏魔殿の砦〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Fortaleza Pandemônio\",\n",
+                u8"    \"ruRU\": \"Крепость Пандемония\",\n",
+                u8"    \"zhCN\": \"进入混沌要塞\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22863,\n",
+                u8"    \"Key\": \"EnteringTheOuterSteppes\",\n",
+                u8"    \"enUS\": \"Entering The Outer Steppes\",\n",
+                u8"    \"zhTW\": \"進入外圍荒原\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Äußere Steppe\",\n",
+                u8"    \"esES\": \"Entrando en las Estepas Exteriores\",\n",
+                u8"    \"frFR\": \"Entre dans les Steppes infinies\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Steppe Esterne\",\n",
+                u8"    \"koKR\": \"평원 외곽에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Zewnętrzne Stepy\",\n",
+                u8"    \"esMX\": \"Entrando a la Estepa Exterior\",\n",
+                u8"    \"jaJP\": \"〈果ての草原〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Estepes Externas\",\n",
+                u8"    \"ruRU\": \"Рубежные степи\",\n",
+                u8"    \"zhCN\": \"进入外域荒原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22864,\n",
+                u8"    \"Key\": \"EnteringThePlainsOfDespair\",\n",
+                u8"    \"enUS\": \"Entering The Plains of Despair\",\n",
+                u8"    \"zhTW\": \"進入絕望平原\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Ebene der Verzweiflung\",\n",
+                u8"    \"esES\": \"Entrando en las Llanuras del Desaliento\",\n",
+                u8"    \"frFR\": \"Entre dans les Plaines du désespoir\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Pianure della Disperazione\",\n",
+                u8"    \"koKR\": \"절망의 평원에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Równinę Rozpaczy\",\n",
+                u8"    \"esMX\": \"Entrando a la Llanura del Desespero\",\n",
+                u8"    \"jaJP\": \"〈絶望の平原〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Planície do Desespero\",\n",
+                u8"    \"ruRU\": \"Долина Отчаяния\",\n",
+                u8"    \"zhCN\": \"进入绝望平原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22865,\n",
+                u8"    \"Key\": \"EnteringTheCityOfTheDamned\",\n",
+                u8"    \"enUS\": \"Entering The City of the Damned\",\n",
+                u8"    \"zhTW\": \"進入罪罰之城\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Stadt der Verdammten\",\n",
+                u8"    \"esES\": \"Entrando en la Ciudad de los Malditos\",\n",
+                u8"    \"frFR\": \"Entre dans la Ville des damnés\",\n",
+                u8"    \"itIT\": \"Ingresso nella Città Dannata\",\n",
+                u8"    \"koKR\": \"저주받은 자들의 도시에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Miasta Potępionych\",\n",
+                u8"    \"esMX\": \"Entrando a la Ciudad de los Condenados\",\n",
+                u8"    \"jaJP\": \"〈呪われし街〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Cidade dos Condenados\",\n",
+                u8"    \"ruRU\": \"Город Проклятых\",\n",
+                u8"    \"zhCN\": \"进入神罚之城\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22866,\n",
+                u8"    \"Key\": \"EnteringTheRiverOfFlame\",\n",
+                u8"    \"enUS\": \"Entering The River of Flame\",\n",
+                u8"    \"zhTW\": \"進入火焰之河\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Flammenfluss\",\n",
+                u8"    \"esES\": \"Entrando en el Río de Llamas\",\n",
+                u8"    \"frFR\": \"Entre dans la Rivière de feu\",\n",
+                u8"    \"itIT\": \"Ingresso nel Fiume Infuocato\",\n",
+                u8"    \"koKR\": \"불길의 강에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Rzekę Płomieni\",\n",
+                u8"    \"esMX\": \"Entrando al Río de Fuego\",\n",
+                u8"    \"jaJP\": \"〈炎の河〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Rio de Chamas\",\n",
+                u8"    \"ruRU\": \"Огненная река\",\n",
+                u8"    \"zhCN\": \"进入火焰之河\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22867,\n",
+                u8"    \"Key\": \"EnteringChaosSanctum\",\n",
+                u8"    \"enUS\": \"Entering Chaos Sanctuary\",\n",
+                u8"    \"zhTW\": \"進入混沌魔殿\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Chaossanktuarium\",\n",
+                u8"    \"esES\": \"Entrando en el Santuario del Caos\",\n",
+                u8"    \"frFR\": \"Entre dans le Sanctuaire du chaos\",\n",
+                u8"    \"itIT\": \"Ingresso nel Santuario del Caos\",\n",
+                u8"    \"koKR\": \"혼돈의 성역에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Sanktuarium Chaosu\",\n",
+                u8"    \"esMX\": \"Entrando al Santuario del Caos\",\n",
+                u8"    \"jaJP\": \"〈混沌の聖域〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Santuário do Caos\",\n",
+                u8"    \"ruRU\": \"Святилище Хаоса\",\n",
+                u8"    \"zhCN\": \"进入混沌避难所\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22868,\n",
+                u8"    \"Key\": \"EnteringHarrogath\",\n",
+                u8"    \"enUS\": \"Entering Harrogath\",\n",
+                u8"    \"zhTW\": \"進入哈洛加斯\",\n",
+                u8"    \"deDE\": \"Jetzt: Harrogath\",\n",
+                u8"    \"esES\": \"Entrando en Harrogath\",\n",
+                u8"    \"frFR\": \"Entre dans Harrogath\",\n",
+                u8"    \"itIT\": \"Ingresso ad Harrogath\",\n",
+                u8"    \"koKR\": \"하로가스에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Harrogath\",\n",
+                u8"    \"esMX\": \"Entrando a Harrogat\",\n",
+                u8"    \"jaJP\": \"〈ハロガス〉\",\n",
+                u8"    \"ptBR\": \"Entrando em Harrogath\",\n",
+                u8"    \"ruRU\": \"Харрогат\",\n",
+                u8"    \"zhCN\": \"进入哈洛加斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22869,\n",
+                u8"    \"Key\": \"EnteringTheBloodyFoothills\",\n",
+                u8"    \"enUS\": \"Entering The Bloody Foothills\",\n",
+                u8"    \"zhTW\": \"進入血腥丘陵\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Blutige Vorgebirge\",\n",
+                u8"    \"esES\": \"Entrando en las Estribaciones Sangrientas\",\n",
+                u8"    \"frFR\": \"Entre dans les Collines Sanglantes\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Colline Insanguinate\",\n",
+                u8"    \"koKR\": \"핏빛 언덕에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Krwawe Wzgórza\",\n",
+                u8"    \"esMX\": \"Entrando a las Laderas Sangrientas\",\n",
+                u8"    \"jaJP\": \"〈血に塗れし丘陵〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Colinas Sangrentas\",\n",
+                u8"    \"ruRU\": \"Кровавые предгорья\",\n",
+                u8"    \"zhCN\": \"进入血腥丘陵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22870,\n",
+                u8"    \"Key\": \"EnteringTheRigidHighlands\",\n",
+                u8"    \"enUS\": \"Entering The Frigid Highlands\",\n",
+                u8"    \"zhTW\": \"進入冰凍高地\",\n",
+                u8"    \"deDE\": \"Jetzt: Das Eishochland\",\n",
+                u8"    \"esES\": \"Entrando en las Tierras Altas Glaciales\",\n",
+                u8"    \"frFR\": \"Entre dans les Hautes-Glaces\",\n",
+                u8"    \"itIT\": \"Ingresso negli Altopiani del Gelo\",\n",
+                u8"    \"koKR\": \"혹한의 고산지에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Zlodowaciałą Wyżynę\",\n",
+                u8"    \"esMX\": \"Entrando a las Tierras Altas Gélidas\",\n",
+                u8"    \"jaJP\": \"〈極寒の高原〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Terras Altas Gélidas\",\n",
+                u8"    \"ruRU\": \"Мерзлое нагорье\",\n",
+                u8"    \"zhCN\": \"进入冰冻高地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22871,\n",
+                u8"    \"Key\": \"EnteringTheArreatPlateau\",\n",
+                u8"    \"enUS\": \"Entering The Arreat Plateau\",\n",
+                u8"    \"zhTW\": \"進入亞瑞特高原\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Arreathochebene\",\n",
+                u8"    \"esES\": \"Entrando en la Meseta Arreat\",\n",
+                u8"    \"frFR\": \"Entre dans le Mont Arreat\",\n",
+                u8"    \"itIT\": \"Ingresso nel Plateau dell'Arreat\",\n",
+                u8"    \"koKR\": \"아리앗 고원에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Płaskowyż Arreat\",\n",
+                u8"    \"esMX\": \"Entrando a la Planicie de Arreat\",\n",
+                u8"    \"jaJP\": \"〈アリート高地〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Platô de Arreat\",\n",
+                u8"    \"ruRU\": \"Арреатское плато\",\n",
+                u8"    \"zhCN\": \"进入亚瑞特高原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22872,\n",
+                u8"    \"Key\": \"EnteringTheCrystalizedCavernLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Crystalline Passage\",\n",
+                u8"    \"zhTW\": \"進入水晶通道\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Kristalldurchgang\",\n",
+                u8"    \"esES\": \"Entrando en el Pasaje Cristalino\",\n",
+                u8"    \"frFR\": \"Entre dans le Passage cristallin\",\n",
+                u8"    \"itIT\": \"Ingresso nel Passaggio Cristallino\",\n",
+                u8"    \"koKR\": \"수정 동굴에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Kryształowego Przejścia\",\n",
+                u8"    \"esMX\": \"Entrando al Pasaje Cristalino\",\n",
+                u8"    \"jaJP\": \"〈結晶道〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Passagem Cristalina\",\n",
+                u8"    \"ruRU\": \"Ледяные пещеры\",\n",
+                u8"    \"zhCN\": \"进入水晶通道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22873,\n",
+                u8"    \"Key\": \"EnteringTheCellarOfPity\",\n",
+                u8"    \"enUS\": \"Entering The Frozen River\",\n",
+                u8"    \"zhTW\": \"進入冰凍之河\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Frostfluss\",\n",
+                u8"    \"esES\": \"Entrando en el Río Helado\",\n",
+                u8"    \"frFR\": \"Entre dans la Rivière Glacée\",\n",
+                u8"    \"itIT\": \"Ingresso nel Fiume Gelido\",\n",
+                u8"    \"koKR\": \"얼어붙은 강에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz nad Zamarzniętą Rzekę\",\n",
+                u8"    \"esMX\": \"Entrando al Río Congelado\",\n",
+                u8"    \"jaJP\": \"〈凍てつく川〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Rio Congelado\",\n",
+                u8"    \"ruRU\": \"Замерзшая река\",\n",
+                u8"    \"zhCN\": \"进入冰冻之河\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22874,\n",
+                u8"    \"Key\": \"EnteringTheCrystalizedCavernLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Glacial Trail\",\n",
+                u8"    \"zhTW\": \"進入冰河小徑\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Gletscherweg\",\n",
+                u8"    \"esES\": \"Entrando en la Senda Glacial\",\n",
+                u8"    \"frFR\": \"Entre dans la Piste des glaces\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sentiero Ghiacciato\",\n",
+                u8"    \"koKR\": \"빙하의 길에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Lodowy Trakt\",\n",
+                u8"    \"esMX\": \"Entrando al Sendero Glacial\",\n",
+                u8"    \"jaJP\": \"〈氷の道〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Trilha Glacial\",\n",
+                u8"    \"ruRU\": \"Ледовый ход\",\n",
+                u8"    \"zhCN\": \"进入冰川小径\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22875,\n",
+                u8"    \"Key\": \"EnteringTheEchoChamber\",\n",
+                u8"    \"enUS\": \"Entering The Drifter Cavern\",\n",
+                u8"    \"zhTW\": \"進入漂泊者洞窟\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Flockenhöhle\",\n",
+                u8"    \"esES\": \"Entrando en la Caverna del Errante\",\n",
+                u8"    \"frFR\": \"Entre dans la Caverne du Yéti\",\n",
+                u8"    \"itIT\": \"Ingresso nella Caverna dei Viandanti\",\n",
+                u8"    \"koKR\": \"부랑자의 동굴에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Groty Tułaczy\",\n",
+                u8"    \"esMX\": \"Entrando a la Caverna del Morador\",\n",
+                u8"    \"jaJP\": \"〈流れ者の洞窟〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Caverna do Errante\",\n",
+                u8"    \"ruRU\": \"Пещера скитальцев\",\n",
+                u8"    \"zhCN\": \"进入漂流洞窟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22876,\n",
+                u8"    \"Key\": \"EnteringTheTundraWastelands\",\n",
+                u8"    \"enUS\": \"Entering The Frozen Tundra\",\n",
+                u8"    \"zhTW\": \"進入冰凍苔原\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Gefrorene Tundra\",\n",
+                u8"    \"esES\": \"Entrando en la Tundra Helada\",\n",
+                u8"    \"frFR\": \"Entre dans la Toundra glacée\",\n",
+                u8"    \"itIT\": \"Ingresso nella Tundra Congelata\",\n",
+                u8"    \"koKR\": \"얼어붙은 동토에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Zamarzniętej Tundry\",\n",
+                u8"    \"esMX\": \"Entrando a la Tundra Congelada\",\n",
+                u8"    \"jaJP\": \"〈氷結の凍原〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Tundra Congelada\",\n",
+                u8"    \"ruRU\": \"Морозная тундра\",\n",
+                u8"    \"zhCN\": \"进入冰冻苔原\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22877,\n",
+                u8"    \"Key\": \"EnteringTheGlacierCavesLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Ancients' Way\",\n",
+                u8"    \"zhTW\": \"進入先祖之路\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Weg der Urahnen\",\n",
+                u8"    \"esES\": \"Entrando en el Camino de los Antiguos\",\n",
+                u8"    \"frFR\": \"Entre dans le Chemin des Anciens\",\n",
+                u8"    \"itIT\": \"Ingresso nella Via degli Antichi\",\n",
+                u8"    \"koKR\": \"고대인의 길에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Drogę Starożytnych\",\n",
+                u8"    \"esMX\": \"Entrando al Camino de los Ancestros\",\n",
+                u8"    \"jaJP\": \"〈古の民の通り道〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Caminho dos Ancestrais\",\n",
+                u8"    \"ruRU\": \"Путь Древних\",\n",
+                u8"    \"zhCN\": \"进入先祖之路\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22878,\n",
+                u8"    \"Key\": \"EnteringTheGlacierCavesLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Icy Cellar\",\n",
+                u8"    \"zhTW\": \"進入冰窖\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Eiskeller\",\n",
+                u8"    \"esES\": \"Entrando en el Sótano Helado\",\n",
+                u8"    \"frFR\": \"Entre dans la Cave glaciale\",\n",
+                u8"    \"itIT\": \"Ingresso nel Sotterraneo di Ghiaccio\",\n",
+                u8"    \"koKR\": \"얼음 지하실에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Lodowej Piwnicy\",\n",
+                u8"    \"esMX\": \"Entrando a la Caverna Helada\",\n",
+                u8"    \"jaJP\": \"〈氷の穴ぐら〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Porão Gélido\",\n",
+                u8"    \"ruRU\": \"Ледяной грот\",\n",
+                u8"    \"zhCN\": \"进入寒冰地窖\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22879,\n",
+                u8"    \"Key\": \"EnteringTheRockySummit\",\n",
+                u8"    \"enUS\": \"Entering The Arreat Summit\",\n",
+                u8"    \"zhTW\": \"進入亞瑞特山巔\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Gipfel des Arreat\",\n",
+                u8"    \"esES\": \"Entrando en la Cima Arreat\",\n",
+                u8"    \"frFR\": \"Entre dans le Sommet Arreat\",\n",
+                u8"    \"itIT\": \"Ingresso nella Sommità dell'Arreat\",\n",
+                u8"    \"koKR\": \"아리앗 정상에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Szczyt Arreat\",\n",
+                u8"    \"esMX\": \"Entrando a la Cima de Arreat\",\n",
+                u8"    \"jaJP\": \"〈アリート山の頂き〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Cume de Arreat\",\n",
+                u8"    \"ruRU\": \"Вершина Арреата\",\n",
+                u8"    \"zhCN\": \"进入亚瑞特之巅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22880,\n",
+                u8"    \"Key\": \"EnteringNihlathaksTemple\",\n",
+                u8"    \"enUS\": \"Entering Nihlathak's Temple\",\n",
+                u8"    \"zhTW\": \"進入尼拉塞克的神殿\",\n",
+                u8"    \"deDE\": \"Jetzt: Nihlathaks Tempel\",\n",
+                u8"    \"esES\": \"Entrando en el Templo de Nihlathak\",\n",
+                u8"    \"frFR\": \"Entre dans le Temple de Nihlathak\",\n",
+                u8"    \"itIT\": \"Ingresso nel Tempio di Nihlathak\",\n",
+                u8"    \"koKR\": \"니흘라탁의 사원에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Świątyni Nihlathaka\",\n",
+                u8"    \"esMX\": \"Entrando al Templo de Nihlathak\",\n",
+                u8"    \"jaJP\": \"〈ニーラサックの寺院〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Templo de Nilatak\",\n",
+                u8"    \"ruRU\": \"Храм Нильятака\",\n",
+                u8"    \"zhCN\": \"进入尼拉塞克的神殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22881,\n",
+                u8"    \"Key\": \"EnteringTheHallsOfAnguish\",\n",
+                u8"    \"enUS\": \"Entering The Halls of Anguish\",\n",
+                u8"    \"zhTW\": \"進入怨慟之廳\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Hallen der Qual\",\n",
+                u8"    \"esES\": \"Entrando en las Salas de la Angustia\",\n",
+                u8"    \"frFR\": \"Entre dans les Corridors de l’Angoisse\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Sale dell'Angoscia\",\n",
+                u8"    \"koKR\": \"고뇌의 전당에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Sal Cierpienia\",\n",
+                u8"    \"esMX\": \"Entrando a las Salas de la Angustia\",\n",
+                u8"    \"jaJP\": \"〈苦悶の広間〉\",\n",
+                u8"    \"ptBR\": \"Entrando nos Salões da Angústia\",\n",
+                u8"    \"ruRU\": \"Чертоги Мучений\",\n",
+                u8"    \"zhCN\": \"进入痛楚大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22882,\n",
+                u8"    \"Key\": \"EnteringTheHallsOfDeath'sCalling\",\n",
+                u8"    \"enUS\": \"Entering The Halls of Pain\",\n",
+                u8"    \"zhTW\": \"進入苦痛之廳\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Hallen der Schmerzen\",\n",
+                u8"    \"esES\": \"Entrando en las Salas del Dolor\",\n",
+                u8"    \"frFR\": \"Entre dans les Corridors de la Souffrance\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Sale del Dolore\",\n",
+                u8"    \"koKR\": \"고통의 전당에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Sal Bólu\",\n",
+                u8"    \"esMX\": \"Entrando a las Salas del Dolor\",\n",
+                u8"    \"jaJP\": \"〈苦痛の広間〉\",\n",
+                u8"    \"ptBR\": \"Entrando nos Salões da Dor\",\n",
+                u8"    \"ruRU\": \"Чертоги Боли\",\n",
+                u8"    \"zhCN\": \"进入苦痛大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22883,\n",
+                u8"    \"Key\": \"EnteringTheHallsOfVaught\",\n",
+                u8"    \"enUS\": \"Entering The Halls of Vaught\",\n",
+                u8"    \"zhTW\": \"進入沃特之廳\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Hallen von Vaught\",\n",
+                u8"    \"esES\": \"Entrando en las Salas de Vaught\",\n",
+                u8"    \"frFR\": \"Entre dans les Corridors du Martyre\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Sale di Vaught\",\n",
+                u8"    \"koKR\": \"보트의 전당에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Sal Nieszczęścia\",\n",
+                u8"    \"esMX\": \"Entrando a las Salas de Vaught\",\n",
+                u8"    \"jaJP\": \"〈ヴォートの広間〉\",\n",
+                u8"    \"ptBR\": \"Entrando nos Salões de Vaught\",\n",
+                u8"    \"ruRU\": \"Чертоги Воута\",\n",
+                u8"    \"zhCN\": \"进入沃特大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22884,\n",
+                u8"    \"Key\": \"EnteringHell1\",\n",
+                u8"    \"enUS\": \"Entering Abaddon\",\n",
+                u8"    \"zhTW\": \"進入亞巴頓\",\n",
+                u8"    \"deDE\": \"Jetzt: Abaddon\",\n",
+                u8"    \"esES\": \"Entrando en Abaddon\",\n",
+                u8"    \"frFR\": \"Entre dans Abaddon\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Abaddon\",\n",
+                u8"    \"koKR\": \"나락에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Abaddonu\",\n",
+                u8"    \"esMX\": \"Entrando a Abadón\",\n",
+                u8"    \"jaJP\": \"〈奈落〉\",\n",
+                u8"    \"ptBR\": \"Entrando em Abadom\",\n",
+                u8"    \"ruRU\": \"Аваддон\",\n",
+                u8"    \"zhCN\": \"进入亚巴顿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22885,\n",
+                u8"    \"Key\": \"EnteringHell2\",\n",
+                u8"    \"enUS\": \"Entering The Pit of Acheron\",\n",
+                u8"    \"zhTW\": \"進入冥河地穴\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Grube von Acheron\",\n",
+                u8"    \"esES\": \"Entrando en el Foso de Acheron\",\n",
+                u8"    \"frFR\": \"Entre dans le Puits d’Acheron\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Abisso dell'Acheronte\",\n",
+                u8"    \"koKR\": \"아케론의 구덩이에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Otchłani Acheronu\",\n",
+                u8"    \"esMX\": \"Entrando al Foso de Aqueronte\",\n",
+                u8"    \"jaJP\": \"〈冥穴〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Fosso de Aqueron\",\n",
+                u8"    \"ruRU\": \"Пропасть Ахерона\",\n",
+                u8"    \"zhCN\": \"进入阿克隆深渊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22886,\n",
+                u8"    \"Key\": \"EnteringHell3\",\n",
+                u8"    \"enUS\": \"Entering The Infernal Pit\",\n",
+                u8"    \"zhTW\": \"進入煉獄地穴\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Infernogrube\",\n",
+                u8"    \"esES\": \"Entrando en el Foso Infernal\",\n",
+                u8"    \"frFR\": \"Entre dans le Puits infernal\",\n",
+                u8"    \"itIT\": \"Ingresso nell'Abisso Infernale\",\n",
+                u8"    \"koKR\": \"지옥불 구덩이에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Piekielnej Czeluści\",\n",
+                u8"    \"esMX\": \"Entrando al Foso del Infierno\",\n",
+                u8"    \"jaJP\": \"〈獄穴〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Fosso Infernal\",\n",
+                u8"    \"ruRU\": \"Инфернальный провал\",\n",
+                u8"    \"zhCN\": \"进入炼狱深渊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22887,\n",
+                u8"    \"Key\": \"EnteringTheWorldstoneKeepLevel1\",\n",
+                u8"    \"enUS\": \"Entering The Worldstone Keep Level 1\",\n",
+                u8"    \"zhTW\": \"進入世界之石要塞第一層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Weltsteinturm, Ebene 1\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 1 de la Torre de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"Entre dans le Donjon de la Pierre-Monde niv. 1\",\n",
+                u8"    \"itIT\": \"Ingresso nel Forte della Pietra del Mondo L1\",\n",
+                u8"    \"koKR\": \"세계석 성채 1층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Twierdzy Kamienia Świata – Poziom 1\",\n",
+                u8"    \"esMX\": \"Entrando a la Fortaleza de la Piedra Ecuménica Nivel 1\",\n",
+                u8"    \"jaJP\": \"〈ワールドストーン城塞: 第1階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Forte da Pedra do Mundo Nível 1\",\n",
+                u8"    \"ruRU\": \"1-й уровень Цитадели Мироздания\",\n",
+                u8"    \"zhCN\": \"进入世界之石要塞一层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22888,\n",
+                u8"    \"Key\": \"EnteringTheWorldstoneKeepLevel2\",\n",
+                u8"    \"enUS\": \"Entering The Worldstone Keep Level 2\",\n",
+                u8"    \"zhTW\": \"進入世界之石要塞第二層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Weltsteinturm, Ebene 2\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 2 de la Torre de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"Entre dans le Donjon de la Pierre-Monde niv. 2\",\n",
+                u8"    \"itIT\": \"Ingresso nel Forte della Pietra del Mondo L2\",\n",
+                u8"    \"koKR\": \"세계석 성채 2층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Twierdzy Kamienia Świata – Poziom 2\",\n",
+                u8"    \"esMX\": \"Entrando a la Fortaleza de la Piedra Ecuménica Nivel 2\",\n",
+                u8"    \"jaJP\": \"〈ワールドストーン城塞: 第2階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Forte da Pedra do Mundo Nível 2\",\n",
+                u8"    \"ruRU\": \"2-й уровень Цитадели Мироздания\",\n",
+                u8"    \"zhCN\": \"进入世界之石要塞二层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22889,\n",
+                u8"    \"Key\": \"EnteringTheWorldstoneKeepLevel3\",\n",
+                u8"    \"enUS\": \"Entering The Worldstone Keep Level 3\",\n",
+                u8"    \"zhTW\": \"進入世界之石要塞第三層\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Weltsteinturm, Ebene 3\",\n",
+                u8"    \"esES\": \"Entrando en el nivel 3 de la Torre de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"Entre dans le Donjon de la Pierre-Monde niv. 3\",\n",
+                u8"    \"itIT\": \"Ingresso nel Forte della Pietra del Mondo L3\",\n",
+                u8"    \"koKR\": \"세계석 성채 3층에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Twierdzy Kamienia Świata – Poziom 3\",\n",
+                u8"    \"esMX\": \"Entrando a la Fortaleza de la Piedra Ecuménica Nivel 3\",\n",
+                u8"    \"jaJP\": \"〈ワールドストーン城塞: 第3階層〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Forte da Pedra do Mundo Nível 3\",\n",
+                u8"    \"ruRU\": \"3-й уровень Цитадели Мироздания\",\n",
+                u8"    \"zhCN\": \"进入世界之石要塞三层\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22890,\n",
+                u8"    \"Key\": \"EnteringTheThroneOfDestruction\",\n",
+                u8"    \"enUS\": \"Entering The Throne of Destruction\",\n",
+                u8"    \"zhTW\": \"進入毀滅王座\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Thron der Zerstörung\",\n",
+                u8"    \"esES\": \"Entrando en el Trono de la Destrucción\",\n",
+                u8"    \"frFR\": \"Entre dans le Trône de la Destruction\",\n",
+                u8"    \"itIT\": \"Ingresso nel Trono della Distruzione\",\n",
+                u8"    \"koKR\": \"파괴의 왕좌에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Tronu Zniszczenia\",\n",
+                u8"    \"esMX\": \"Entrando al Trono de la Destrucción\",\n",
+                u8"    \"jaJP\": \"〈破壊の玉座〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Trono da Destruição\",\n",
+                u8"    \"ruRU\": \"Престол Разрушения\",\n",
+                u8"    \"zhCN\": \"进入毁灭王座\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22891,\n",
+                u8"    \"Key\": \"EnteringTheWorldstoneChamber\",\n",
+                u8"    \"enUS\": \"Entering The Worldstone Chamber\",\n",
+                u8"    \"zhTW\": \"進入世界之石大殿\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Kammer des Weltsteins\",\n",
+                u8"    \"esES\": \"Entrando en la Cámara de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"Entre dans la Chambre de la Pierre-Monde\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Sale della Pietra del Mondo\",\n",
+                u8"    \"koKR\": \"세계석 보관실에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Komnaty Kamienia Świata\",\n",
+                u8"    \"esMX\": \"Entrando a la Cámara de la Piedra Ecuménica\",\n",
+                u8"    \"jaJP\": \"〈ワールドストーンの間〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Câmara da Pedra do Mundo\",\n",
+                u8"    \"ruRU\": \"Святилище Мироздания\",\n",
+                u8"    \"zhCN\": \"进入世界之石大殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22892,\n",
+                u8"    \"Key\": \"EnteringThePandemoniumRun1\",\n",
+                u8"    \"enUS\": \"Entering The Matron's Den\",\n",
+                u8"    \"zhTW\": \"進入魔母巢穴\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Matronenhöhle\",\n",
+                u8"    \"esES\": \"Entrando en la Guarida de la Matrona\",\n",
+                u8"    \"frFR\": \"Entre dans le Repaire de la Matrone\",\n",
+                u8"    \"itIT\": \"Ingresso nella Tana della Matrona\",\n",
+                u8"    \"koKR\": \"여제의 소굴에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Legowiska Matrony\",\n",
+                u8"    \"esMX\": \"Entrando a la Guarida de la Matrona\",\n",
+                u8"    \"jaJP\": \"〈貴婦人の巣窟〉\",\n",
+                u8"    \"ptBR\": \"Entrando no Covil da Matriarca\",\n",
+                u8"    \"ruRU\": \"Логово Госпожи\",\n",
+                u8"    \"zhCN\": \"进入主母的巢穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22893,\n",
+                u8"    \"Key\": \"EnteringThePandemoniumRun2\",\n",
+                u8"    \"enUS\": \"Entering The Forgotten Sands\",\n",
+                u8"    \"zhTW\": \"進入遺忘沙漠\",\n",
+                u8"    \"deDE\": \"Jetzt: Die Vergessenen Sande\",\n",
+                u8"    \"esES\": \"Entrando en las Arenas Olvidadas\",\n",
+                u8"    \"frFR\": \"Entre dans les Sables oubliés\",\n",
+                u8"    \"itIT\": \"Ingresso nelle Sabbie Dimenticate\",\n",
+                u8"    \"koKR\": \"잊힌 사막에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz na Zapomniane Piaski\",\n",
+                u8"    \"esMX\": \"Entrando a las Arenas Olvidadas\",\n",
+                u8"    \"jaJP\": \"〈忘れ去られし砂漠〉\",\n",
+                u8"    \"ptBR\": \"Entrando nas Areias Esquecidas\",\n",
+                u8"    \"ruRU\": \"Забытые пески\",\n",
+                u8"    \"zhCN\": \"进入遗忘的沙丘\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22894,\n",
+                u8"    \"Key\": \"EnteringThePandemoniumRun3\",\n",
+                u8"    \"enUS\": \"Entering The Furnace of Pain\",\n",
+                u8"    \"zhTW\": \"進入苦痛熔爐\",\n",
+                u8"    \"deDE\": \"Jetzt: Der Glutofen der Pein\",\n",
+                u8"    \"esES\": \"Entrando en la Caldera del Dolor\",\n",
+                u8"    \"frFR\": \"Entre dans la Fournaise de la douleur\",\n",
+                u8"    \"itIT\": \"Ingresso nella Fornace del Dolore\",\n",
+                u8"    \"koKR\": \"고통의 용광로에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Pieca Bólu\",\n",
+                u8"    \"esMX\": \"Entrando a la Forja del Dolor\",\n",
+                u8"    \"jaJP\": \"〈苦痛のかまど〉\",\n",
+                u8"    \"ptBR\": \"Entrando na Fornalha da Dor\",\n",
+                u8"    \"ruRU\": \"Горнило Боли\",\n",
+                u8"    \"zhCN\": \"进入苦痛的熔炉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22895,\n",
+                u8"    \"Key\": \"EnteringThePandemoniumFinale\",\n",
+                u8"    \"enUS\": \"Entering Tristram\",\n",
+                u8"    \"zhTW\": \"進入崔斯特姆\",\n",
+                u8"    \"deDE\": \"Jetzt: Tristram\",\n",
+                u8"    \"esES\": \"Entrando en Tristán\",\n",
+                u8"    \"frFR\": \"Entre dans Tristram\",\n",
+                u8"    \"itIT\": \"Ingresso a Tristram\",\n",
+                u8"    \"koKR\": \"트리스트럼에 진입\",\n",
+                u8"    \"plPL\": \"Wkraczasz do Tristram\",\n",
+                u8"    \"esMX\": \"Entrando a Tristram\",\n",
+                u8"    \"jaJP\": \"〈トリストラム〉\",\n",
+                u8"    \"ptBR\": \"Entrando em Tristram\",\n",
+                u8"    \"ruRU\": \"Тристрам\",\n",
+                u8"    \"zhCN\": \"进入崔斯特姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 26815,\n",
+                u8"    \"Key\": \"act5\",\n",
+                u8"    \"enUS\": \"Act 5\",\n",
+                u8"    \"zhTW\": \"第五章\",\n",
+                u8"    \"deDE\": \"Akt 5\",\n",
+                u8"    \"esES\": \"Acto 5\",\n",
+                u8"    \"frFR\": \"Acte V\",\n",
+                u8"    \"itIT\": \"Atto 5\",\n",
+                u8"    \"koKR\": \"5막\",\n",
+                u8"    \"plPL\": \"Akt V\",\n",
+                u8"    \"esMX\": \"Acto 5\",\n",
+                u8"    \"jaJP\": \"第5章\",\n",
+                u8"    \"ptBR\": \"Ato 5\",\n",
+                u8"    \"ruRU\": \"Акт 5\",\n",
+                u8"    \"zhCN\": \"五幕\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27281,\n",
+                u8"    \"Key\": \"Cave\",\n",
+                u8"    \"enUS\": \"Cave\",\n",
+                u8"    \"zhTW\": \"洞穴\",\n",
+                u8"    \"deDE\": \"Grotte\",\n",
+                u8"    \"esES\": \"Cueva\",\n",
+                u8"    \"frFR\": \"Grotte\",\n",
+                u8"    \"itIT\": \"Caverna\",\n",
+                u8"    \"koKR\": \"동굴\",\n",
+                u8"    \"plPL\": \"Jaskinia\",\n",
+                u8"    \"esMX\": \"Cueva\",\n",
+                u8"    \"jaJP\": \"洞窟\",\n",
+                u8"    \"ptBR\": \"Caverna\",\n",
+                u8"    \"ruRU\": \"Пещера\",\n",
+                u8"    \"zhCN\": \"洞穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27282,\n",
+                u8"    \"Key\": \"Underground Passage\",\n",
+                u8"    \"enUS\": \"Underground Passage\",\n",
+                u8"    \"zhTW\": \"地底通道\",\n",
+                u8"    \"deDE\": \"Unterirdischer Durchgang\",\n",
+                u8"    \"esES\": \"Pasadizo Subterráneo\",\n",
+                u8"    \"frFR\": \"Passage souterrain\",\n",
+                u8"    \"itIT\": \"Passaggio Sotterraneo\",\n",
+                u8"    \"koKR\": \"지하 통로\",\n",
+                u8"    \"plPL\": \"Podziemny Tunel\",\n",
+                u8"    \"esMX\": \"Pasaje Subterráneo\",\n",
+                u8"    \"jaJP\": \"地下道\",\n",
+                u8"    \"ptBR\": \"Passagem Subterrânea\",\n",
+                u8"    \"ruRU\": \"Подземный проход\",\n",
+                u8"    \"zhCN\": \"地下通道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27283,\n",
+                u8"    \"Key\": \"Hole\",\n",
+                u8"    \"enUS\": \"Hole\",\n",
+                u8"    \"zhTW\": \"地洞\",\n",
+                u8"    \"deDE\": \"Loch\",\n",
+                u8"    \"esES\": \"Hoyo\",\n",
+                u8"    \"frFR\": \"Gouffre\",\n",
+                u8"    \"itIT\": \"Buco\",\n",
+                u8"    \"koKR\": \"구렁\",\n",
+                u8"    \"plPL\": \"Jama\",\n",
+                u8"    \"esMX\": \"Agujero\",\n",
+                u8"    \"jaJP\": \"洞穴\",\n",
+                u8"    \"ptBR\": \"Buraco\",\n",
+                u8"    \"ruRU\": \"Нора\",\n",
+                u8"    \"zhCN\": \"地洞\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27284,\n",
+                u8"    \"Key\": \"Act 1 Pit\",\n",
+                u8"    \"enUS\": \"Pit\",\n",
+                u8"    \"zhTW\": \"地穴\",\n",
+                u8"    \"deDE\": \"Grube\",\n",
+                u8"    \"esES\": \"Foso\",\n",
+                u8"    \"frFR\": \"Fosse\",\n",
+                u8"    \"itIT\": \"Abisso\",\n",
+                u8"    \"koKR\": \"구덩이\",\n",
+                u8"    \"plPL\": \"Czeluść\",\n",
+                u8"    \"esMX\": \"Foso\",\n",
+                u8"    \"jaJP\": \"穴ぐら\",\n",
+                u8"    \"ptBR\": \"Fosso\",\n",
+                u8"    \"ruRU\": \"Дыра\",\n",
+                u8"    \"zhCN\": \"深坑\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27285,\n",
+                u8"    \"Key\": \"Jail\",\n",
+                u8"    \"enUS\": \"Jail\",\n",
+                u8"    \"zhTW\": \"監牢\",\n",
+                u8"    \"deDE\": \"Gefängnis\",\n",
+                u8"    \"esES\": \"Cárcel\",\n",
+                u8"    \"frFR\": \"Prison\",\n",
+                u8"    \"itIT\": \"Prigione\",\n",
+                u8"    \"koKR\": \"감옥\",\n",
+                u8"    \"plPL\": \"Więzienie\",\n",
+                u8"    \"esMX\": \"Prisión\",\n",
+                u8"    \"jaJP\": \"牢獄\",\n",
+                u8"    \"ptBR\": \"Prisão\",\n",
+                u8"    \"ruRU\": \"Тюрьма\",\n",
+                u8"    \"zhCN\": \"监狱\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27286,\n",
+                u8"    \"Key\": \"Catacombs\",\n",
+                u8"    \"enUS\": \"Catacombs\",\n",
+                u8"    \"zhTW\": \"地下墓穴\",\n",
+                u8"    \"deDE\": \"Katakomben\",\n",
+                u8"    \"esES\": \"Catacumbas\",\n",
+                u8"    \"frFR\": \"Catacombes\",\n",
+                u8"    \"itIT\": \"Catacombe\",\n",
+                u8"    \"koKR\": \"지하 묘지\",\n",
+                u8"    \"plPL\": \"Katakumby\",\n",
+                u8"    \"esMX\": \"Catacumbas\",\n",
+                u8"    \"jaJP\": \"地下墓地\",\n",
+                u8"    \"ptBR\": \"Catacumbas\",\n",
+                u8"    \"ruRU\": \"Катакомбы\",\n",
+                u8"    \"zhCN\": \"地下墓穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27287,\n",
+                u8"    \"Key\": \"Lut Gholein Sewers\",\n",
+                u8"    \"enUS\": \"Lut Gholein Sewers\",\n",
+                u8"    \"zhTW\": \"魯高因下水道\",\n",
+                u8"    \"deDE\": \"Kanalisation von Lut Gholein\",\n",
+                u8"    \"esES\": \"Cloacas de Lut Gholein\",\n",
+                u8"    \"frFR\": \"Égouts de Lut Gholein\",\n",
+                u8"    \"itIT\": \"Fogne di Lut Gholein\",\n",
+                u8"    \"koKR\": \"루트 골레인 하수도\",\n",
+                u8"    \"plPL\": \"Kanały pod Lut Gholein\",\n",
+                u8"    \"esMX\": \"Cloacas de Lut Gholein\",\n",
+                u8"    \"jaJP\": \"ラット・ゴーレインの下水道\",\n",
+                u8"    \"ptBR\": \"Esgoto de Lut Gholein\",\n",
+                u8"    \"ruRU\": \"Стоки Лут Голейна\",\n",
+                u8"    \"zhCN\": \"鲁·高因下水道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27288,\n",
+                u8"    \"Key\": \"Kurast Sewers\",\n",
+                u8"    \"enUS\": \"Kurast Sewers\",\n",
+                u8"    \"zhTW\": \"庫拉斯特下水道\",\n",
+                u8"    \"deDE\": \"Kanalisation von Kurast\",\n",
+                u8"    \"esES\": \"Cloacas de Kurast\",\n",
+                u8"    \"frFR\": \"Égouts de Kurast\",\n",
+                u8"    \"itIT\": \"Fogne di Kurast\",\n",
+                u8"    \"koKR\": \"쿠라스트 하수도\",\n",
+                u8"    \"plPL\": \"Kanały pod Kurast\",\n",
+                u8"    \"esMX\": \"Cloacas de Kurast\",\n",
+                u8"    \"jaJP\": \"クラストの下水道\",\n",
+                u8"    \"ptBR\": \"Esgoto de Kurast\",\n",
+                u8"    \"ruRU\": \"Стоки Кураста\",\n",
+                u8"    \"zhCN\": \"库拉斯特下水道\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27289,\n",
+                u8"    \"Key\": \"Temple Halls\",\n",
+                u8"    \"enUS\": \"Temple Halls\",\n",
+                u8"    \"zhTW\": \"神殿大廳\",\n",
+                u8"    \"deDE\": \"Tempelhallen\",\n",
+                u8"    \"esES\": \"Salas del Templo\",\n",
+                u8"    \"frFR\": \"Salles du temple\",\n",
+                u8"    \"itIT\": \"Sale del Tempio\",\n",
+                u8"    \"koKR\": \"사원 전당\",\n",
+                u8"    \"plPL\": \"Komnaty Świątynne\",\n",
+                u8"    \"esMX\": \"Salas del Templo\",\n",
+                u8"    \"jaJP\": \"寺院の広間\",\n",
+                u8"    \"ptBR\": \"Salões do Templo\",\n",
+                u8"    \"ruRU\": \"Залы храма\",\n",
+                u8"    \"zhCN\": \"神殿大厅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27290,\n",
+                u8"    \"Key\": \"The Worldstone Keep\",\n",
+                u8"    \"enUS\": \"Worldstone Keep\",\n",
+                u8"    \"zhTW\": \"世界之石要塞\",\n",
+                u8"    \"deDE\": \"Weltsteinturm\",\n",
+                u8"    \"esES\": \"Torre de la Piedra del Mundo\",\n",
+                u8"    \"frFR\": \"Donjon de la Pierre-Monde\",\n",
+                u8"    \"itIT\": \"Forte della Pietra del Mondo\",\n",
+                u8"    \"koKR\": \"세계석 성채\",\n",
+                u8"    \"plPL\": \"Twierdza Kamienia Świata\",\n",
+                u8"    \"esMX\": \"Fortaleza de la Piedra Ecuménica\",\n",
+                u8"    \"jaJP\": \"ワールドストーン城塞\",\n",
+                u8"    \"ptBR\": \"Forte da Pedra do Mundo\",\n",
+                u8"    \"ruRU\": \"Крепость камня мироздания\",\n",
+                u8"    \"zhCN\": \"世界之石要塞\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 27338,\n",
+                u8"    \"Key\": \"MooMooFarmGroup\",\n",
+                u8"    \"enUS\": \"ÿc8a non-existent levelÿc0\",\n",
+                u8"    \"zhTW\": \"ÿc8不存在的關卡ÿc0\",\n",
+                u8"    \"deDE\": \"ÿc8ein Level, das es gar nicht gibtÿc0\",\n",
+                u8"    \"esES\": \"ÿc8un nivel que no existeÿc0\",\n",
+                u8"    \"frFR\": \"ÿc8un niveau inexistantÿc0\",\n",
+                u8"    \"itIT\": \"ÿc8un livello inesistenteÿc0\",\n",
+                u8"    \"koKR\": \"ÿc8존재하지 않는 곳ÿc0\",\n",
+                u8"    \"plPL\": \"ÿc8nieistniejący poziomÿc0\",\n",
+                u8"    \"esMX\": \"ÿc8un nivel inexistenteÿc0\",\n",
+                u8"    \"jaJP\": \"ÿc8存在しないところÿc0\",\n",
+                u8"    \"ptBR\": \"ÿc8um nível inexistenteÿc0\",\n",
+                u8"    \"ruRU\": \"ÿc8несуществующий уровеньÿc0\",\n",
+                u8"    \"zhCN\": \"ÿc8不存在的等级ÿc0\"\n",
+                u8"  }\n",
+                u8"]\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,692 +18,688 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetMagicPrefix()
+        EmbeddedText GetMagicPrefix()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"Name\tversion\tspawnable\trare\tlevel\tmaxlevel\tlevelreq\tclassspecific\tclass\tclasslevelreq\tfrequency\tgroup\tmod1code\tmod1param\tmod1min\tmod1max\tmod2code\tmod2param\tmod2min\tmod2max\tmod3code\tmod3param\tmod3min\tmod3max\ttransformcolor\titype1\titype2\titype3\titype4\titype5\titype6\titype7\tetype1\tetype2\tetype3\tetype4\tetype5\tmultiply\tadd\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sturdy\t0\t1\t1\t4\t\t3\t\t\t\t0\t101\tac%\t\t20\t30\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Strong\t0\t1\t1\t9\t\t6\t\t\t\t0\t101\tac%\t\t31\t40\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glorious\t0\t1\t1\t19\t\t14\t\t\t\t0\t101\tac%\t\t41\t50\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Blessed\t0\t1\t1\t25\t\t18\t\t\t\t0\t101\tac%\t\t51\t65\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Saintly\t0\t1\t1\t31\t\t23\t\t\t\t0\t101\tac%\t\t66\t80\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Holy\t0\t1\t1\t36\t\t27\t\t\t\t0\t101\tac%\t\t81\t100\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Devious\t0\t1\t1\t7\t\t5\t\t\t\t0\t103\tred-mag\t0\t1\t1\t\t\t\t\t\t\t\t\tdblu\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fortified\t0\t1\t1\t14\t\t10\t\t\t\t0\t103\tred-mag\t0\t2\t2\t\t\t\t\t\t\t\t\tdblu\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t0\t1\t1\t1\t\t1\t\t\t\t0\t106\tdmg%\t0\t10\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Deadly\t0\t1\t1\t5\t\t3\t\t\t\t0\t106\tdmg%\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Vicious\t0\t1\t1\t8\t\t6\t\t\t\t0\t106\tdmg%\t0\t31\t40\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Brutal\t0\t1\t1\t14\t\t10\t\t\t\t0\t106\tdmg%\t0\t41\t50\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Massive\t0\t1\t1\t20\t\t15\t\t\t\t0\t106\tdmg%\t0\t51\t65\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Savage\t0\t1\t1\t26\t\t19\t\t\t\t0\t106\tdmg%\t0\t66\t80\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n";
-                ss << u8"Merciless\t0\t1\t1\t32\t\t24\t\t\t\t0\t106\tdmg%\t0\t81\t100\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n";
-                ss << u8"Vulpine\t0\t1\t1\t9\t\t6\t\t\t\t0\t107\tdmg-to-mana\t0\t10\t10\t\t\t\t\t\t\t\t\tcblu\tshld\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tireless\t0\t1\t1\t14\t\t10\t\t\t\t0\t109\tregen-stam\t0\t50\t50\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t0\t1\t1\t14\t\t10\t\t\t\t0\t110\tstam\t0\t5\t10\t\t\t\t\t\t\t\t\t\tboot\tglov\tbelt\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t0\t1\t1\t1\t\t1\t\t\t\t0\t111\tatt\t0\t10\t20\t\t\t\t\t\t\t\t\t\tweap\tring\tglov\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Iron\t0\t1\t1\t4\t\t3\t\t\t\t0\t111\tatt\t0\t21\t40\t\t\t\t\t\t\t\t\t\tweap\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Steel\t0\t1\t1\t8\t\t6\t\t\t\t0\t111\tatt\t0\t41\t60\t\t\t\t\t\t\t\t\t\tweap\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Silver\t0\t1\t1\t12\t\t9\t\t\t\t0\t111\tatt\t0\t61\t80\t\t\t\t\t\t\t\t\t\tweap\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Gold\t0\t1\t1\t17\t\t12\t\t\t\t0\t111\tatt\t0\t81\t100\t\t\t\t\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Platinum\t0\t1\t1\t22\t\t16\t\t\t\t0\t111\tatt\t0\t101\t120\t\t\t\t\t\t\t\t\tlgld\tweap\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Meteoric\t0\t1\t1\t27\t\t20\t\t\t\t0\t111\tatt\t0\t121\t150\t\t\t\t\t\t\t\t\tlgld\tweap\tring\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n";
-                ss << u8"Sharp\t0\t1\t1\t5\t\t3\t\t\t\t0\t112\tatt\t0\t10\t20\tdmg%\t0\t10\t20\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fine\t0\t1\t1\t9\t\t6\t\t\t\t0\t112\tatt\t0\t21\t40\tdmg%\t0\t21\t30\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Warrior's\t0\t1\t1\t15\t\t11\t\t\t\t0\t112\tatt\t0\t41\t60\tdmg%\t0\t31\t40\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Soldier's\t0\t1\t1\t21\t\t15\t\t\t\t0\t112\tatt\t0\t61\t80\tdmg%\t0\t41\t50\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Knight's\t0\t1\t1\t25\t\t18\t\t\t\t0\t112\tatt\t0\t81\t100\tdmg%\t0\t51\t65\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lord's\t0\t1\t1\t30\t\t22\t\t\t\t0\t112\tatt\t0\t101\t120\tdmg%\t0\t66\t80\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n";
-                ss << u8"King's\t0\t1\t1\t35\t\t26\t\t\t\t0\t112\tatt\t0\t121\t150\tdmg%\t0\t81\t100\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n";
-                ss << u8"Howling\t0\t1\t1\t16\t\t12\t\t\t\t0\t113\thowl\t0\t128\t128\t\t\t\t\t\t\t\t\toran\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"Fortuitous\t0\t1\t1\t5\t\t3\t\t\t\t0\t114\tmag%\t0\t10\t15\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glimmering\t0\t1\t1\t1\t\t1\t\t\t\t0\t116\tlight\t0\t1\t1\t\t\t\t\t\t\t\t\t\tarmo\twand\tstaf\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glowing\t0\t1\t1\t6\t\t4\t\t\t\t0\t116\tlight\t0\t2\t2\t\t\t\t\t\t\t\t\tlyel\tarmo\twand\tstaf\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t0\t1\t1\t3\t\t2\t\t\t\t0\t118\tmana\t0\t1\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\tboot\tglov\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snake's\t0\t1\t1\t6\t\t4\t\t\t\t0\t118\tmana\t0\t5\t10\t\t\t\t\t\t\t\t\t\tshld\trod\tbelt\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t0\t1\t1\t14\t\t10\t\t\t\t0\t118\tmana\t0\t11\t20\t\t\t\t\t\t\t\t\t\tshld\trod\tbelt\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t0\t1\t1\t37\t\t27\t\t\t\t0\t118\tmana\t0\t11\t20\t\t\t\t\t\t\t\t\t\ttors\thelm\tboot\tglov\tmele\t\t\th2h\trod\t\t\t\t0\t0\n";
-                ss << u8"Drake's\t0\t1\t1\t20\t\t15\t\t\t\t0\t118\tmana\t0\t21\t30\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\tbelt\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Dragon's\t0\t1\t1\t24\t\t18\t\t\t\t0\t118\tmana\t0\t31\t40\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Dragon's\t0\t1\t1\t52\t\t39\t\t\t\t0\t118\tmana\t0\t31\t40\t\t\t\t\t\t\t\t\tcblu\ttors\thelm\tboot\tglov\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Wyrm's\t0\t1\t1\t30\t\t22\t\t\t\t0\t118\tmana\t0\t41\t60\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Prismatic\t0\t1\t1\t27\t\t20\t\t\t\t0\t120\tres-all\t0\t15\t25\t\t\t\t\t\t\t\t\tlpur\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Prismatic\t0\t1\t1\t62\t\t46\t\t\t\t0\t120\tres-all\t0\t15\t15\t\t\t\t\t\t\t\t\tlpur\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Azure\t0\t1\t1\t5\t\t3\t\t\t\t0\t121\tres-cold\t0\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\trod\tmiss\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lapis\t0\t1\t1\t12\t\t9\t\t\t\t0\t121\tres-cold\t0\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lapis\t0\t1\t1\t35\t\t26\t\t\t\t0\t121\tres-cold\t0\t11\t20\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"Cobalt\t0\t1\t1\t18\t\t13\t\t\t\t0\t121\tres-cold\t0\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"Cobalt\t0\t1\t1\t55\t\t41\t\t\t\t0\t121\tres-cold\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sapphire\t0\t1\t1\t25\t\t18\t\t\t\t0\t121\tres-cold\t0\t31\t50\t\t\t\t\t\t\t\t\tlblu\trod\tboot\tring\tamul\tmiss\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Crimson\t0\t1\t1\t5\t\t3\t\t\t\t0\t122\tres-fire\t0\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\trod\tmiss\tring\tamul\tamul\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burgundy\t0\t1\t1\t12\t\t9\t\t\t\t0\t122\tres-fire\t0\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burgundy\t0\t1\t1\t35\t\t26\t\t\t\t0\t122\tres-fire\t0\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"Garnet\t0\t1\t1\t18\t\t13\t\t\t\t0\t122\tres-fire\t0\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"Garnet\t0\t1\t1\t55\t\t41\t\t\t\t0\t122\tres-fire\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ruby\t0\t1\t1\t25\t\t18\t\t\t\t0\t122\tres-fire\t0\t31\t50\t\t\t\t\t\t\t\t\tlred\twand\tstaf\tboot\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ocher\t0\t1\t1\t5\t\t3\t\t\t\t0\t123\tres-ltng\t0\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\tmiss\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tangerine\t0\t1\t1\t12\t\t9\t\t\t\t0\t123\tres-ltng\t0\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tangerine\t0\t1\t1\t35\t\t26\t\t\t\t0\t123\tres-ltng\t0\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"Coral\t0\t1\t1\t18\t\t13\t\t\t\t0\t123\tres-ltng\t0\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"Coral\t0\t1\t1\t55\t\t41\t\t\t\t0\t123\tres-ltng\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Amber\t0\t1\t1\t25\t\t18\t\t\t\t0\t123\tres-ltng\t0\t31\t50\t\t\t\t\t\t\t\t\tlyel\tarmo\tring\tamul\tstaf\twand\t\t\tshld\tglov\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Beryl\t0\t1\t1\t5\t\t3\t\t\t\t0\t124\tres-pois\t0\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\tscep\tstaf\tmiss\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jade\t0\t1\t1\t12\t\t9\t\t\t\t0\t124\tres-pois\t0\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\tscep\tstaf\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jade\t0\t1\t1\t35\t\t26\t\t\t\t0\t124\tres-pois\t0\t11\t20\t\t\t\t\t\t\t\t\t\tweap\tring\t\t\t\t\t\tstaf\tscep\t\t\t\t0\t0\n";
-                ss << u8"Viridian\t0\t1\t1\t18\t\t13\t\t\t\t0\t124\tres-pois\t0\t21\t30\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tscep\tstaf\tring\tamul\t\t\t\t\t\t0\t0\n";
-                ss << u8"Viridian\t0\t1\t1\t55\t\t41\t\t\t\t0\t124\tres-pois\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tboot\tglov\tbelt\t\t\t\tstaf\tscep\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Emerald\t0\t1\t1\t25\t\t18\t\t\t\t0\t124\tres-pois\t0\t31\t50\t\t\t\t\t\t\t\t\tlgrn\tscep\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fletcher's\t0\t1\t1\t30\t\t22\t\t\t\t0\t125\tama\t0\t1\t1\t\t\t\t\t\t\t\t\t\tmiss\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Archer's\t0\t1\t1\t40\t\t30\t\t\t\t0\t125\tama\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tmiss\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Archer's\t0\t1\t1\t90\t\t67\t\t\t\t0\t125\tama\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Monk's\t0\t1\t1\t30\t\t22\t\t\t\t0\t126\tpal\t0\t1\t1\t\t\t\t\t\t\t\t\t\tscep\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Priest's\t0\t1\t1\t40\t\t30\t\t\t\t0\t126\tpal\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tscep\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Priest's\t0\t1\t1\t90\t\t67\t\t\t\t0\t126\tpal\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Summoner's\t0\t1\t1\t30\t\t22\t\t\t\t0\t127\tnec\t0\t1\t1\t\t\t\t\t\t\t\t\t\twand\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Necromancer's\t0\t1\t1\t40\t\t30\t\t\t\t0\t127\tnec\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\twand\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Necromancer's\t0\t1\t1\t90\t\t67\t\t\t\t0\t127\tnec\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Angel's\t0\t1\t1\t30\t\t22\t\t\t\t0\t128\tsor\t0\t1\t1\t\t\t\t\t\t\t\t\t\tstaf\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Arch-Angel's\t0\t1\t1\t40\t\t30\t\t\t\t0\t128\tsor\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Arch-Angel's\t0\t1\t1\t90\t\t67\t\t\t\t0\t128\tsor\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Slayer's\t0\t1\t1\t30\t\t22\t\t\t\t0\t129\tbar\t0\t1\t1\t\t\t\t\t\t\t\t\t\tmele\tamul\t\t\t\t\t\trod\th2h\t\t\t\t0\t0\n";
-                ss << u8"Berserker's\t0\t1\t1\t40\t\t30\t\t\t\t0\t129\tbar\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tmele\t\t\t\t\t\t\trod\th2h\t\t\t\t0\t0\n";
-                ss << u8"Berserker's\t0\t1\t1\t90\t\t67\t\t\t\t0\t129\tbar\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Triumphant\t0\t1\t1\t3\t\t2\t\t\t\t0\t132\tmana-kill\t0\t1\t1\t\t\t\t\t\t\t\t\t\tmele\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                ss << u8"Stout\t100\t1\t1\t1\t\t1\t\t\t\t4\t101\tac\t\t3\t5\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stout\t100\t1\t1\t7\t\t5\t\t\t\t4\t101\tac\t\t6\t9\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stout\t100\t1\t1\t12\t\t9\t\t\t\t4\t101\tac\t\t10\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burly\t100\t1\t1\t17\t\t12\t\t\t\t4\t101\tac\t\t13\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burly\t100\t1\t1\t22\t\t16\t\t\t\t4\t101\tac\t\t16\t22\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burly\t100\t1\t1\t27\t\t20\t\t\t\t4\t101\tac\t\t23\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stalwart\t100\t1\t\t32\t\t24\t\t\t\t4\t101\tac\t\t33\t40\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stalwart\t100\t1\t\t37\t\t29\t\t\t\t4\t101\tac\t\t44\t50\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stalwart\t100\t1\t\t42\t\t34\t\t\t\t4\t101\tac\t\t60\t100\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stout\t100\t1\t1\t1\t\t1\t\t\t\t4\t101\tac\t\t2\t3\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stout\t100\t1\t1\t14\t\t10\t\t\t\t4\t101\tac\t\t4\t6\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stout\t100\t1\t1\t20\t\t15\t\t\t\t4\t101\tac\t\t8\t12\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burly\t100\t1\t1\t26\t\t19\t\t\t\t4\t101\tac\t\t13\t18\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burly\t100\t1\t1\t32\t\t24\t\t\t\t4\t101\tac\t\t20\t30\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stalwart\t100\t1\t\t38\t\t30\t\t\t\t4\t101\tac\t\t30\t40\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stalwart\t100\t1\t\t45\t\t37\t\t\t\t4\t101\tac\t\t45\t60\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stout\t100\t1\t1\t1\t\t1\t\t\t\t4\t101\tac\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stout\t100\t1\t1\t21\t\t15\t\t\t\t4\t101\tac\t\t4\t8\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burly\t100\t1\t1\t36\t\t28\t\t\t\t4\t101\tac\t\t15\t20\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Stalwart\t100\t1\t\t48\t\t40\t\t\t\t4\t101\tac\t\t20\t30\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Blanched\t100\t1\t1\t1\t\t1\t\t\t\t4\t101\tac\t\t5\t8\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Eburin\t100\t1\t1\t16\t\t12\t\t\t\t4\t101\tac\t\t9\t20\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bone\t100\t1\t1\t32\t\t24\t\t\t\t4\t101\tac\t\t21\t40\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ivory\t100\t1\t\t64\t\t56\t\t\t\t4\t101\tac\t\t41\t64\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sturdy\t1\t1\t1\t1\t\t1\t\t\t\t9\t101\tac%\t\t10\t20\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sturdy\t1\t1\t1\t4\t\t3\t\t\t\t9\t101\tac%\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Strong\t1\t1\t1\t9\t\t6\t\t\t\t8\t101\tac%\t\t31\t40\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glorious\t1\t1\t1\t19\t\t14\t\t\t\t8\t101\tac%\t\t41\t50\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Blessed\t1\t1\t1\t25\t\t18\t\t\t\t7\t101\tac%\t\t51\t65\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Saintly\t1\t1\t1\t31\t\t23\t\t\t\t7\t101\tac%\t\t66\t80\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Holy\t1\t1\t1\t36\t\t27\t\t\t\t6\t101\tac%\t\t81\t100\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Godly\t100\t1\t\t45\t\t38\t\t\t\t3\t101\tac%\t\t101\t200\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Devious\t1\t0\t1\t7\t\t5\t\t\t\t5\t102\tred-mag\t\t1\t1\t\t\t\t\t\t\t\t\t\tshld\tcirc\torb\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Blank\t1\t0\t1\t14\t\t10\t\t\t\t4\t102\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\tshld\tcirc\torb\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Null\t100\t0\t1\t21\t\t16\t\t\t\t4\t102\tred-mag\t\t3\t5\t\t\t\t\t\t\t\t\tdblu\tshld\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Antimagic\t100\t0\t\t28\t\t21\t\t\t\t4\t102\tred-mag\t\t6\t10\t\t\t\t\t\t\t\t\tdblu\tshld\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Red\t100\t0\t1\t4\t\t3\t\t\t\t4\t103\tdmg-min\t\t1\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Red\t100\t0\t1\t16\t\t12\t\t\t\t4\t103\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sanguinary\t100\t0\t1\t28\t\t21\t\t\t\t4\t103\tdmg-min\t\t4\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sanguinary\t100\t0\t1\t40\t\t32\t\t\t\t4\t103\tdmg-min\t\t5\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bloody\t100\t0\t\t52\t\t46\t\t\t\t4\t103\tdmg-min\t\t7\t8\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Red\t100\t0\t1\t11\t\t8\t\t\t\t4\t103\tdmg-min\t\t1\t2\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sanguinary\t100\t0\t1\t33\t\t25\t\t\t\t4\t103\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bloody\t100\t0\t\t55\t\t47\t\t\t\t4\t103\tdmg-min\t\t4\t4\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Red\t100\t0\t1\t24\t\t16\t\t\t\t4\t103\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sanguinary\t100\t0\t1\t41\t\t33\t\t\t\t4\t103\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bloody\t100\t0\t\t58\t\t50\t\t\t\t4\t103\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Scarlet\t100\t1\t1\t8\t\t6\t\t\t\t4\t103\tdmg-min\t\t1\t4\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Crimson\t100\t1\t1\t38\t\t30\t\t\t\t4\t103\tdmg-min\t\t5\t8\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t100\t0\t1\t3\t\t2\t\t\t\t4\t104\tdmg-max\t\t1\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t100\t0\t1\t10\t\t7\t\t\t\t4\t104\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t100\t0\t1\t17\t\t12\t\t\t\t4\t104\tdmg-max\t\t5\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Forked\t100\t0\t1\t25\t\t18\t\t\t\t4\t104\tdmg-max\t\t7\t8\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Forked\t100\t0\t1\t32\t\t24\t\t\t\t4\t104\tdmg-max\t\t9\t10\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serrated\t100\t0\t\t39\t\t31\t\t\t\t4\t104\tdmg-max\t\t11\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serrated\t100\t0\t\t47\t\t39\t\t\t\t4\t104\tdmg-max\t\t13\t14\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t100\t0\t1\t10\t\t7\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t100\t0\t1\t20\t\t15\t\t\t\t4\t104\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Forked\t100\t0\t1\t30\t\t22\t\t\t\t4\t104\tdmg-max\t\t3\t3\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Forked\t100\t0\t1\t40\t\t32\t\t\t\t4\t104\tdmg-max\t\t4\t5\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serrated\t100\t0\t\t50\t\t42\t\t\t\t4\t104\tdmg-max\t\t6\t7\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t100\t0\t1\t23\t\t17\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\tblac\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Forked\t100\t0\t1\t38\t\t30\t\t\t\t4\t104\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\tblac\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serrated\t100\t0\t\t53\t\t45\t\t\t\t4\t104\tdmg-max\t\t3\t3\t\t\t\t\t\t\t\t\tblac\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Carbuncle\t100\t1\t1\t12\t\t9\t\t\t\t4\t104\tdmg-max\t\t1\t5\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Carmine\t100\t1\t1\t35\t\t27\t\t\t\t4\t104\tdmg-max\t\t6\t9\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Vermillion\t100\t1\t\t58\t\t50\t\t\t\t4\t104\tdmg-max\t\t11\t15\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t1\t1\t1\t1\t\t1\t\t\t\t9\t105\tdmg%\t\t10\t20\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Deadly\t1\t1\t1\t5\t\t3\t\t\t\t9\t105\tdmg%\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Vicious\t1\t1\t1\t8\t\t6\t\t\t\t8\t105\tdmg%\t\t31\t40\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Brutal\t1\t1\t1\t14\t\t10\t\t\t\t8\t105\tdmg%\t\t41\t50\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Massive\t1\t1\t1\t20\t\t15\t\t\t\t7\t105\tdmg%\t\t51\t65\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Savage\t1\t1\t1\t26\t\t19\t\t\t\t7\t105\tdmg%\t\t66\t80\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Merciless\t1\t1\t1\t32\t\t24\t\t\t\t6\t105\tdmg%\t\t81\t100\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Ferocious\t100\t1\t1\t41\t\t33\t\t\t\t6\t105\tdmg%\t\t101\t200\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Cruel\t100\t1\t\t51\t\t43\t\t\t\t5\t105\tdmg%\t\t201\t300\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Cinnabar\t100\t1\t1\t1\t\t1\t\t\t\t4\t105\tdmg%\t\t5\t10\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rusty\t100\t1\t1\t13\t\t9\t\t\t\t4\t105\tdmg%\t\t11\t20\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Realgar\t100\t1\t1\t45\t\t37\t\t\t\t4\t105\tdmg%\t\t21\t30\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ruby\t100\t1\t\t66\t\t58\t\t\t\t4\t105\tdmg%\t\t31\t40\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Vulpine\t1\t1\t1\t9\t\t6\t\t\t\t3\t107\tdmg-to-mana\t\t7\t12\t\t\t\t\t\t\t\t\tcblu\tshld\tamul\torb\tstaf\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Dun\t100\t1\t1\t7\t\t5\t\t\t\t3\t107\tdmg-to-mana\t\t7\t12\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tireless\t1\t1\t1\t6\t\t4\t\t\t\t4\t108\tregen-stam\t\t25\t25\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tireless\t100\t1\t1\t14\t\t10\t\t\t\t4\t108\tregen-stam\t\t50\t50\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Brown\t100\t1\t1\t39\t\t31\t\t\t\t4\t108\tregen-stam\t\t10\t15\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t100\t1\t1\t1\t\t1\t\t\t\t4\t109\tstam\t\t12\t24\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t100\t1\t1\t7\t\t5\t\t\t\t4\t109\tstam\t\t25\t36\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t100\t1\t1\t21\t\t15\t\t\t\t4\t109\tstam\t\t37\t50\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t100\t1\t1\t1\t\t\t\t\t\t4\t109\tstam\t\t8\t16\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                ss << u8"Rugged\t100\t1\t1\t7\t\t5\t\t\t\t4\t109\tstam\t\t17\t25\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t100\t1\t1\t21\t\t15\t\t\t\t4\t109\tstam\t\t26\t32\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t100\t1\t1\t1\t\t\t\t\t\t4\t109\tstam\t\t4\t8\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                ss << u8"Rugged\t100\t1\t1\t21\t\t15\t\t\t\t4\t109\tstam\t\t9\t16\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t1\t1\t1\t1\t\t1\t\t\t\t4\t109\tstam\t\t5\t10\t\t\t\t\t\t\t\t\t\tboot\tglov\tbelt\tring\tamul\tcirc\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t1\t1\t1\t8\t\t6\t\t\t\t4\t109\tstam\t\t11\t20\t\t\t\t\t\t\t\t\t\tboot\tbelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rugged\t1\t1\t1\t8\t\t6\t\t\t\t4\t109\tstam\t\t11\t20\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Vigorous\t100\t1\t1\t16\t\t12\t\t\t\t4\t109\tstam\t\t21\t30\t\t\t\t\t\t\t\t\t\tboot\tbelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Chestnut\t100\t1\t1\t1\t\t1\t\t\t\t4\t109\tstam\t\t10\t15\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Maroon\t100\t1\t1\t17\t\t12\t\t\t\t4\t109\tstam\t\t16\t25\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t100\t1\t1\t1\t\t1\t\t\t\t4\t110\tatt\t\t6\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t100\t1\t1\t7\t\t5\t\t\t\t4\t110\tatt\t\t13\t27\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t100\t1\t1\t13\t\t9\t\t\t\t4\t110\tatt\t\t28\t42\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Iron\t100\t1\t1\t19\t\t14\t\t\t\t4\t110\tatt\t\t43\t57\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Iron\t100\t1\t1\t25\t\t18\t\t\t\t4\t110\tatt\t\t58\t72\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Iron\t100\t1\t1\t31\t\t23\t\t\t\t4\t110\tatt\t\t73\t87\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Steel\t100\t1\t\t37\t\t29\t\t\t\t4\t110\tatt\t\t88\t102\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Steel\t100\t1\t\t43\t\t35\t\t\t\t4\t110\tatt\t\t103\t117\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Steel\t100\t1\t\t49\t\t41\t\t\t\t4\t110\tatt\t\t118\t132\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t100\t1\t1\t1\t\t1\t\t\t\t4\t110\tatt\t\t4\t8\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t100\t1\t1\t7\t\t5\t\t\t\t4\t110\tatt\t\t6\t12\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t100\t1\t1\t16\t\t12\t\t\t\t4\t110\tatt\t\t13\t25\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Iron\t100\t1\t1\t25\t\t18\t\t\t\t4\t110\tatt\t\t26\t38\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Iron\t100\t1\t1\t34\t\t26\t\t\t\t4\t110\tatt\t\t39\t51\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Steel\t100\t1\t\t43\t\t36\t\t\t\t4\t110\tatt\t\t52\t64\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Steel\t100\t1\t\t52\t\t44\t\t\t\t4\t110\tatt\t\t65\t77\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t100\t1\t1\t1\t\t1\t\t\t\t4\t110\tatt\t\t2\t4\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t100\t1\t1\t21\t\t15\t\t\t\t4\t110\tatt\t\t6\t12\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Iron\t100\t1\t1\t39\t\t31\t\t\t\t4\t110\tatt\t\t13\t24\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Steel\t100\t1\t\t57\t\t49\t\t\t\t4\t110\tatt\t\t25\t36\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bronze\t1\t1\t1\t1\t\t1\t\t\t\t8\t110\tatt\t\t10\t20\t\t\t\t\t\t\t\t\t\tweap\tring\tglov\tamul\tcirc\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Iron\t1\t1\t1\t4\t\t3\t\t\t\t8\t110\tatt\t\t21\t40\t\t\t\t\t\t\t\t\t\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Steel\t1\t1\t1\t8\t\t6\t\t\t\t7\t110\tatt\t\t41\t60\t\t\t\t\t\t\t\t\t\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Silver\t1\t1\t1\t12\t\t9\t\t\t\t7\t110\tatt\t\t61\t80\t\t\t\t\t\t\t\t\t\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Gold\t1\t1\t1\t17\t\t12\t\t\t\t6\t110\tatt\t\t81\t100\t\t\t\t\t\t\t\t\tlgld\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Platinum\t1\t1\t1\t22\t\t16\t\t\t\t6\t110\tatt\t\t101\t120\t\t\t\t\t\t\t\t\tlgld\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Meteoric\t1\t1\t1\t27\t\t20\t\t\t\t5\t110\tatt\t\t121\t150\t\t\t\t\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Strange\t100\t1\t1\t32\t\t24\t\t\t\t5\t110\tatt\t\t151\t300\t\t\t\t\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Weird\t100\t1\t\t37\t\t27\t\t\t\t4\t110\tatt\t\t301\t450\t\t\t\t\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Nickel\t100\t1\t1\t1\t\t1\t\t\t\t4\t110\tatt\t\t10\t20\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tin\t100\t1\t1\t8\t\t6\t\t\t\t4\t110\tatt\t\t21\t40\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Silver\t100\t1\t1\t25\t\t18\t\t\t\t4\t110\tatt\t\t41\t60\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Argent\t100\t1\t\t44\t\t36\t\t\t\t4\t110\tatt\t\t61\t100\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fine\t100\t1\t1\t15\t\t11\t\t\t\t4\t111\tatt\t\t10\t20\tdmg-max\t\t1\t3\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fine\t100\t1\t1\t22\t\t16\t\t\t\t4\t111\tatt\t\t21\t48\tdmg-max\t\t4\t6\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sharp\t100\t1\t1\t29\t\t21\t\t\t\t4\t111\tatt\t\t49\t76\tdmg-max\t\t7\t10\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fine\t100\t1\t1\t19\t\t14\t\t\t\t4\t111\tatt\t\t10\t20\tdmg-max\t\t1\t3\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sharp\t100\t1\t1\t28\t\t21\t\t\t\t4\t111\tatt\t\t21\t48\tdmg-max\t\t4\t6\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fine\t100\t1\t\t28\t\t21\t\t\t\t4\t111\tatt\t\t10\t20\tdmg-max\t\t1\t3\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sharp\t1\t1\t1\t5\t\t3\t\t\t\t9\t111\tatt\t\t10\t20\tdmg%\t\t10\t20\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Fine\t1\t1\t1\t12\t\t9\t\t\t\t9\t111\tatt\t\t21\t40\tdmg%\t\t21\t30\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Warrior's\t1\t1\t1\t19\t\t13\t\t\t\t8\t111\tatt\t\t41\t60\tdmg%\t\t31\t40\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Soldier's\t1\t1\t1\t27\t\t19\t\t\t\t8\t111\tatt\t\t61\t80\tdmg%\t\t41\t50\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Knight's\t1\t1\t1\t38\t\t30\t\t\t\t7\t111\tatt\t\t81\t100\tdmg%\t\t51\t65\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Lord's\t1\t1\t1\t47\t\t39\t\t\t\t6\t111\tatt\t\t101\t120\tdmg%\t\t66\t80\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"King's\t1\t1\t1\t56\t\t48\t\t\t\t5\t111\tatt\t\t121\t150\tdmg%\t\t81\t100\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Master's\t100\t1\t1\t56\t\t48\t\t\t\t5\t111\tatt\t\t151\t250\tdmg%\t\t101\t150\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Grandmaster's\t100\t1\t\t69\t\t61\t\t\t\t4\t111\tatt\t\t251\t300\tdmg%\t\t151\t200\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Glimmering\t1\t1\t1\t1\t\t1\t\t\t\t1\t112\tlight\t\t1\t1\t\t\t\t\t\t\t\t\t\tarmo\twand\tstaf\tring\tamul\torb\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glowing\t1\t1\t1\t6\t\t4\t\t\t\t1\t112\tlight\t\t2\t2\t\t\t\t\t\t\t\t\tlyel\tarmo\twand\tstaf\tring\tamul\torb\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bright\t100\t1\t1\t1\t\t1\t\t\t\t1\t112\tlight\t\t1\t1\tatt\t\t10\t10\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Screaming\t100\t1\t1\t10\t\t7\t\t\t\t3\t113\thowl\t\t32\t32\t\t\t\t\t\t\t\t\toran\tweap\t\t\t\t\t\t\tmiss\tswor\taxe\tpole\tspea\t0\t0\n";
-                ss << u8"Howling\t1\t1\t1\t16\t\t12\t\t\t\t3\t113\thowl\t\t64\t64\t\t\t\t\t\t\t\t\toran\tweap\t\t\t\t\t\t\tmiss\tswor\taxe\tpole\tspea\t0\t0\n";
-                ss << u8"Wailing\t100\t1\t1\t20\t\t13\t\t\t\t3\t113\thowl\t\t128\t128\t\t\t\t\t\t\t\t\toran\tweap\t\t\t\t\t\t\tmiss\tswor\taxe\tpole\tspea\t0\t0\n";
-                ss << u8"Screaming\t100\t1\t1\t10\t\t7\t\t\t\t4\t113\thowl\t\t16\t16\t\t\t\t\t\t\t\t\toran\tmiss\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Howling\t100\t1\t1\t16\t\t12\t\t\t\t4\t113\thowl\t\t24\t24\t\t\t\t\t\t\t\t\toran\tmiss\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Wailing\t100\t1\t\t24\t\t18\t\t\t\t4\t113\thowl\t\t32\t32\t\t\t\t\t\t\t\t\toran\tmiss\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lucky\t100\t1\t1\t21\t\t\t\t\t\t4\t114\tmag%\t\t1\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lucky\t100\t1\t\t38\t\t\t\t\t\t4\t114\tmag%\t\t5\t7\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lucky\t100\t1\t\t55\t\t\t\t\t\t4\t114\tmag%\t\t8\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lucky\t100\t1\t1\t34\t\t\t\t\t\t4\t114\tmag%\t\t1\t1\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lucky\t100\t1\t\t53\t\t\t\t\t\t4\t114\tmag%\t\t2\t3\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lucky\t100\t1\t\t51\t\t\t\t\t\t4\t114\tmag%\t\t4\t6\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Felicitous\t100\t1\t1\t5\t\t3\t\t\t\t4\t114\tmag%\t\t5\t10\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fortuitous\t1\t1\t\t12\t\t8\t\t\t\t4\t114\tmag%\t\t11\t15\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Emerald\t100\t1\t1\t16\t\t12\t\t\t\t4\t114\tmag%\t\t3\t7\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t100\t1\t1\t1\t\t1\t\t\t\t4\t115\tmana\t\t3\t7\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t100\t1\t1\t7\t\t5\t\t\t\t4\t115\tmana\t\t8\t13\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t100\t1\t1\t13\t\t9\t\t\t\t4\t115\tmana\t\t14\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snake's\t100\t1\t1\t19\t\t14\t\t\t\t4\t115\tmana\t\t21\t26\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snake's\t100\t1\t1\t25\t\t18\t\t\t\t4\t115\tmana\t\t27\t33\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snake's\t100\t1\t1\t31\t\t23\t\t\t\t4\t115\tmana\t\t34\t39\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t100\t1\t1\t37\t\t29\t\t\t\t4\t115\tmana\t\t40\t46\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t100\t1\t1\t43\t\t35\t\t\t\t4\t115\tmana\t\t47\t52\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t100\t1\t1\t49\t\t41\t\t\t\t4\t115\tmana\t\t53\t59\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t100\t1\t1\t1\t\t1\t\t\t\t4\t115\tmana\t\t2\t4\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t100\t1\t1\t9\t\t6\t\t\t\t4\t115\tmana\t\t5\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t100\t1\t1\t17\t\t12\t\t\t\t4\t115\tmana\t\t8\t12\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snake's\t100\t1\t1\t25\t\t18\t\t\t\t4\t115\tmana\t\t13\t18\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snake's\t100\t1\t1\t33\t\t25\t\t\t\t4\t115\tmana\t\t19\t23\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t100\t1\t1\t41\t\t33\t\t\t\t4\t115\tmana\t\t24\t29\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t100\t1\t1\t49\t\t41\t\t\t\t4\t115\tmana\t\t30\t34\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t100\t1\t1\t16\t\t12\t\t\t\t4\t115\tmana\t\t1\t2\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t100\t1\t1\t16\t\t12\t\t\t\t4\t115\tmana\t\t3\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snake's\t100\t1\t1\t32\t\t24\t\t\t\t4\t115\tmana\t\t8\t12\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t100\t1\t\t48\t\t40\t\t\t\t4\t115\tmana\t\t13\t17\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t1\t1\t1\t3\t\t2\t\t\t\t4\t115\tmana\t\t3\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\torb\t\t\tboot\tglov\t\t\t\t0\t0\n";
-                ss << u8"Snake's\t1\t1\t1\t6\t\t4\t\t\t\t4\t115\tmana\t\t5\t10\t\t\t\t\t\t\t\t\t\tshld\trod\tbelt\tring\tamul\tcirc\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t1\t1\t1\t14\t\t10\t\t\t\t3\t115\tmana\t\t11\t20\t\t\t\t\t\t\t\t\t\tshld\trod\tbelt\tring\tamul\tcirc\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serpent's\t1\t1\t1\t37\t\t27\t\t\t\t2\t115\tmana\t\t11\t20\t\t\t\t\t\t\t\t\t\ttors\tboot\tglov\tweap\torb\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"Drake's\t1\t1\t1\t20\t\t15\t\t\t\t2\t115\tmana\t\t21\t30\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Dragon's\t1\t1\t1\t24\t\t18\t\t\t\t2\t115\tmana\t\t31\t40\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Dragon's\t1\t1\t1\t52\t\t39\t\t\t\t2\t115\tmana\t\t31\t40\t\t\t\t\t\t\t\t\tcblu\ttors\tboot\tglov\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Wyrm's\t1\t1\t1\t30\t\t22\t\t\t\t2\t115\tmana\t\t41\t60\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Great Wyrm's\t100\t1\t1\t37\t\t29\t\t\t\t2\t115\tmana\t\t61\t90\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bahamut's\t100\t1\t\t45\t\t37\t\t\t\t2\t115\tmana\t\t91\t120\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Zircon\t100\t1\t1\t3\t\t2\t\t\t\t2\t115\tmana\t\t5\t10\t\t\t\t\t\t\t\t\tcblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jacinth\t100\t1\t1\t17\t\t12\t\t\t\t2\t115\tmana\t\t11\t15\t\t\t\t\t\t\t\t\tcblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Turquoise\t100\t1\t\t29\t\t21\t\t\t\t2\t115\tmana\t\t16\t20\t\t\t\t\t\t\t\t\tcblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                ss << u8"Shimmering\t100\t1\t\t8\t13\t6\t\t\t\t1\t116\tres-all\t\t3\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t500\n";
-                ss << u8"Shimmering\t100\t1\t\t14\t34\t10\t\t\t\t1\t116\tres-all\t\t8\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t1500\n";
-                ss << u8"Shimmering\t100\t1\t\t35\t\t27\t\t\t\t1\t116\tres-all\t\t13\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t5000\n";
-                ss << u8"Shimmering\t100\t1\t\t17\t33\t12\t\t\t\t1\t116\tres-all\t\t3\t5\t\t\t\t\t\t\t\t\tlpur\tmcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t1500\n";
-                ss << u8"Shimmering\t100\t1\t\t34\t\t26\t\t\t\t1\t116\tres-all\t\t6\t8\t\t\t\t\t\t\t\t\tlpur\tmcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t5000\n";
-                ss << u8"Shimmering\t100\t1\t\t33\t\t25\t\t\t\t1\t116\tres-all\t\t3\t5\t\t\t\t\t\t\t\t\tlpur\tscha\t\t\t\t\t\t\t\t\t\t\t\t1280\t10000\n";
-                ss << u8"Shimmering\t100\t1\t1\t6\t\t4\t\t\t\t5\t116\tres-all\t\t3\t7\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t500\n";
-                ss << u8"Rainbow\t100\t1\t1\t18\t\t13\t\t\t\t5\t116\tres-all\t\t8\t11\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t2000\n";
-                ss << u8"Scintillating\t100\t1\t1\t28\t\t21\t\t\t\t5\t116\tres-all\t\t12\t15\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t4000\n";
-                ss << u8"Prismatic\t1\t1\t1\t39\t\t31\t\t\t\t4\t116\tres-all\t\t16\t20\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t8000\n";
-                ss << u8"Chromatic\t100\t1\t\t50\t\t42\t\t\t\t4\t116\tres-all\t\t21\t30\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t16000\n";
-                ss << u8"Shimmering\t100\t1\t1\t8\t\t6\t\t\t\t5\t116\tres-all\t\t3\t7\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t3000\n";
-                ss << u8"Rainbow\t100\t1\t1\t21\t\t15\t\t\t\t5\t116\tres-all\t\t8\t11\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t6000\n";
-                ss << u8"Scintillating\t100\t1\t1\t34\t\t25\t\t\t\t5\t116\tres-all\t\t12\t15\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t12000\n";
-                ss << u8"Prismatic\t1\t1\t1\t42\t\t31\t\t\t\t4\t116\tres-all\t\t16\t20\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t24000\n";
-                ss << u8"Chromatic\t100\t1\t\t55\t\t41\t\t\t\t3\t116\tres-all\t\t21\t30\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t32000\n";
-                ss << u8"Shimmering\t100\t1\t1\t45\t\t37\t\t\t\t3\t116\tres-all\t\t3\t7\t\t\t\t\t\t\t\t\tlpur\tring\t\t\t\t\t\t\t\t\t\t\t\t1280\t4000\n";
-                ss << u8"Rainbow\t100\t1\t1\t56\t\t48\t\t\t\t2\t116\tres-all\t\t8\t11\t\t\t\t\t\t\t\t\tlpur\tring\t\t\t\t\t\t\t\t\t\t\t\t1280\t8000\n";
-                ss << u8"Scintillating\t100\t1\t\t67\t\t59\t\t\t\t2\t116\tres-all\t\t12\t15\t\t\t\t\t\t\t\t\tlpur\tring\t\t\t\t\t\t\t\t\t\t\t\t1280\t16000\n";
-                ss << u8"Shimmering\t100\t1\t1\t16\t\t12\t\t\t\t1\t116\tres-all\t\t5\t10\t\t\t\t\t\t\t\t\tlpur\tjewl\t\t\t\t\t\t\t\t\t\t\t\t1280\t3000\n";
-                ss << u8"Scintillating\t100\t1\t\t34\t\t26\t\t\t\t1\t116\tres-all\t\t11\t15\t\t\t\t\t\t\t\t\tlpur\tjewl\t\t\t\t\t\t\t\t\t\t\t\t1280\t8000\n";
-                ss << u8"Azure\t100\t1\t1\t1\t\t1\t\t\t\t2\t117\tres-cold\t\t7\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lapis\t100\t1\t1\t10\t\t7\t\t\t\t2\t117\tres-cold\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Cobalt\t100\t1\t1\t20\t\t15\t\t\t\t2\t117\tres-cold\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sapphire\t100\t1\t\t30\t\t22\t\t\t\t2\t117\tres-cold\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Azure\t100\t1\t1\t1\t\t1\t\t\t\t2\t117\tres-cold\t\t4\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lapis\t100\t1\t1\t16\t\t12\t\t\t\t2\t117\tres-cold\t\t8\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Cobalt\t100\t1\t1\t25\t\t18\t\t\t\t2\t117\tres-cold\t\t11\t12\t\t\t\t\t\t\t\t\tlblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sapphire\t100\t1\t\t35\t\t27\t\t\t\t2\t117\tres-cold\t\t13\t15\t\t\t\t\t\t\t\t\tlblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Azure\t100\t1\t1\t1\t\t1\t\t\t\t2\t117\tres-cold\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lapis\t100\t1\t1\t14\t\t10\t\t\t\t2\t117\tres-cold\t\t6\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Cobalt\t100\t1\t1\t27\t\t20\t\t\t\t2\t117\tres-cold\t\t8\t9\t\t\t\t\t\t\t\t\tlblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sapphire\t100\t1\t\t40\t\t32\t\t\t\t2\t117\tres-cold\t\t10\t11\t\t\t\t\t\t\t\t\tlblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Azure\t1\t1\t1\t5\t\t3\t\t\t\t2\t117\tres-cold\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tweap\tring\tamul\torb\tcirc\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lapis\t1\t1\t1\t12\t\t9\t\t\t\t4\t117\tres-cold\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lapis\t1\t1\t1\t35\t\t26\t\t\t\t2\t117\tres-cold\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"Cobalt\t1\t1\t1\t18\t\t13\t\t\t\t3\t117\tres-cold\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Cobalt\t1\t1\t1\t55\t\t41\t\t\t\t2\t117\tres-cold\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"Sapphire\t1\t1\t1\t25\t\t18\t\t\t\t3\t117\tres-cold\t\t31\t40\t\t\t\t\t\t\t\t\tlblu\trod\tboot\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lapis Lazuli\t100\t1\t1\t2\t\t1\t\t\t\t4\t117\tres-cold\t\t5\t15\t\t\t\t\t\t\t\t\tlblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sapphire\t100\t1\t1\t19\t\t14\t\t\t\t4\t117\tres-cold\t\t16\t30\t\t\t\t\t\t\t\t\tlblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Crimson\t100\t1\t1\t1\t\t1\t\t\t\t2\t118\tres-fire\t\t7\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Russet\t100\t1\t1\t10\t\t7\t\t\t\t2\t118\tres-fire\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Garnet\t100\t1\t1\t20\t\t15\t\t\t\t2\t118\tres-fire\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ruby\t100\t1\t\t30\t\t22\t\t\t\t2\t118\tres-fire\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Crimson\t100\t1\t1\t1\t\t1\t\t\t\t2\t118\tres-fire\t\t4\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Russet\t100\t1\t1\t16\t\t12\t\t\t\t2\t118\tres-fire\t\t8\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Garnet\t100\t1\t1\t25\t\t18\t\t\t\t2\t118\tres-fire\t\t11\t12\t\t\t\t\t\t\t\t\tlred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ruby\t100\t1\t\t35\t\t27\t\t\t\t2\t118\tres-fire\t\t13\t15\t\t\t\t\t\t\t\t\tlred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Crimson\t100\t1\t1\t1\t\t1\t\t\t\t2\t118\tres-fire\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Russet\t100\t1\t1\t14\t\t10\t\t\t\t2\t118\tres-fire\t\t6\t7\t\t\t\t\t\t\t\t\tlred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Garnet\t100\t1\t\t27\t\t20\t\t\t\t2\t118\tres-fire\t\t8\t9\t\t\t\t\t\t\t\t\tlred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ruby\t100\t1\t1\t40\t\t32\t\t\t\t2\t118\tres-fire\t\t10\t11\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Russet\t1\t1\t1\t12\t\t9\t\t\t\t4\t118\tres-fire\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Russet\t1\t1\t1\t35\t\t26\t\t\t\t1\t118\tres-fire\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"Garnet\t1\t1\t1\t18\t\t13\t\t\t\t3\t118\tres-fire\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Garnet\t1\t1\t1\t55\t\t41\t\t\t\t1\t118\tres-fire\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"Ruby\t1\t1\t1\t25\t\t18\t\t\t\t3\t118\tres-fire\t\t31\t40\t\t\t\t\t\t\t\t\tlred\trod\tboot\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Garnet\t100\t1\t1\t2\t\t1\t\t\t\t4\t117\tres-fire\t\t5\t15\t\t\t\t\t\t\t\t\tlred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ruby\t100\t1\t1\t18\t\t13\t\t\t\t4\t117\tres-fire\t\t16\t30\t\t\t\t\t\t\t\t\tlred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tangerine\t100\t1\t1\t1\t\t1\t\t\t\t2\t119\tres-ltng\t\t7\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ocher\t100\t1\t1\t10\t\t7\t\t\t\t2\t119\tres-ltng\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Coral\t100\t1\t1\t20\t\t15\t\t\t\t2\t119\tres-ltng\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Amber\t100\t1\t\t30\t\t22\t\t\t\t2\t119\tres-ltng\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tangerine\t100\t1\t1\t1\t\t1\t\t\t\t2\t119\tres-ltng\t\t4\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ocher\t100\t1\t1\t16\t\t12\t\t\t\t2\t119\tres-ltng\t\t8\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Coral\t100\t1\t1\t25\t\t18\t\t\t\t2\t119\tres-ltng\t\t11\t12\t\t\t\t\t\t\t\t\tlyel\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Amber\t100\t1\t\t35\t\t27\t\t\t\t2\t119\tres-ltng\t\t13\t15\t\t\t\t\t\t\t\t\tlyel\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tangerine\t100\t1\t1\t1\t\t1\t\t\t\t2\t119\tres-ltng\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ocher\t100\t1\t1\t14\t\t10\t\t\t\t2\t119\tres-ltng\t\t6\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Coral\t100\t1\t1\t27\t\t20\t\t\t\t2\t119\tres-ltng\t\t8\t9\t\t\t\t\t\t\t\t\tlyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Amber\t100\t1\t\t40\t\t32\t\t\t\t2\t119\tres-ltng\t\t10\t11\t\t\t\t\t\t\t\t\tlyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tangerine\t1\t1\t1\t5\t\t3\t\t\t\t4\t119\tres-ltng\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tweap\tring\tamul\torb\tcirc\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ocher\t1\t1\t1\t12\t\t9\t\t\t\t4\t119\tres-ltng\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ocher\t1\t1\t1\t35\t\t26\t\t\t\t1\t119\tres-ltng\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"Coral\t1\t1\t1\t18\t\t13\t\t\t\t3\t119\tres-ltng\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Coral\t1\t1\t1\t55\t\t41\t\t\t\t1\t119\tres-ltng\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"Amber\t1\t1\t1\t25\t\t18\t\t\t\t3\t119\tres-ltng\t\t31\t40\t\t\t\t\t\t\t\t\tlyel\trod\tboot\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Camphor\t100\t1\t1\t2\t\t1\t\t\t\t4\t117\tres-ltng\t\t5\t15\t\t\t\t\t\t\t\t\tlyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ambergris\t100\t1\t1\t19\t\t14\t\t\t\t4\t117\tres-ltng\t\t16\t30\t\t\t\t\t\t\t\t\tlyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Beryl\t100\t1\t1\t1\t\t1\t\t\t\t2\t120\tres-pois\t\t7\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Viridian\t100\t1\t1\t10\t\t7\t\t\t\t2\t120\tres-pois\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jade\t100\t1\t1\t20\t\t15\t\t\t\t2\t120\tres-pois\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Emerald\t100\t1\t\t30\t\t22\t\t\t\t2\t120\tres-pois\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Beryl\t100\t1\t1\t1\t\t1\t\t\t\t2\t120\tres-pois\t\t4\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Viridian\t100\t1\t1\t16\t\t12\t\t\t\t2\t120\tres-pois\t\t8\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jade\t100\t1\t1\t25\t\t18\t\t\t\t2\t120\tres-pois\t\t11\t12\t\t\t\t\t\t\t\t\tcgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Emerald\t100\t1\t\t35\t\t27\t\t\t\t2\t120\tres-pois\t\t13\t15\t\t\t\t\t\t\t\t\tcgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Beryl\t100\t1\t1\t1\t\t1\t\t\t\t2\t120\tres-pois\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Viridian\t100\t1\t1\t14\t\t10\t\t\t\t2\t120\tres-pois\t\t6\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jade\t100\t1\t1\t27\t\t20\t\t\t\t2\t120\tres-pois\t\t8\t9\t\t\t\t\t\t\t\t\tcgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Emerald\t100\t1\t\t40\t\t32\t\t\t\t2\t120\tres-pois\t\t10\t11\t\t\t\t\t\t\t\t\tcgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Beryl\t1\t1\t1\t5\t\t3\t\t\t\t4\t120\tres-pois\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tweap\tring\tamul\torb\tcirc\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Viridian\t1\t1\t1\t12\t\t9\t\t\t\t4\t120\tres-pois\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Viridian\t1\t1\t1\t35\t\t26\t\t\t\t1\t120\tres-pois\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"Jade\t1\t1\t1\t18\t\t13\t\t\t\t3\t120\tres-pois\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jade\t1\t1\t1\t55\t\t41\t\t\t\t1\t120\tres-pois\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"Emerald\t1\t1\t1\t25\t\t18\t\t\t\t3\t120\tres-pois\t\t31\t40\t\t\t\t\t\t\t\t\tcgrn\trod\tboot\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Beryl\t100\t1\t1\t2\t\t1\t\t\t\t4\t117\tres-pois\t\t5\t15\t\t\t\t\t\t\t\t\tcgrn\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jade\t100\t1\t1\t19\t\t14\t\t\t\t4\t117\tres-pois\t\t16\t30\t\t\t\t\t\t\t\t\tcgrn\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Triumphant\t1\t1\t1\t3\t\t2\t\t\t\t4\t121\tmana-kill\t\t1\t1\t\t\t\t\t\t\t\t\t\tweap\tring\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Victorious\t100\t1\t1\t17\t\t12\t\t\t\t4\t121\tmana-kill\t\t2\t5\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Aureolin\t100\t1\t1\t22\t\t16\t\t\t\t4\t121\tmana-kill\t\t1\t3\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Mechanist's\t100\t1\t1\t10\t\t7\t\t\t\t3\t122\tsock\t\t1\t2\t\t\t\t\t\t\t\t\t\tweap\tshld\thelm\ttors\tcirc\t\t\tthro\t\t\t\t\t0\t0\n";
-                ss << u8"Artificer's\t100\t1\t\t33\t\t25\t\t\t\t2\t122\tsock\t3\t\t\t\t\t\t\t\t\t\t\t\tweap\tshld\thelm\ttors\t\t\t\tthro\t\t\t\t\t0\t0\n";
-                ss << u8"Jeweler's\t100\t1\t\t55\t\t47\t\t\t\t1\t122\tsock\t4\t\t\t\t\t\t\t\t\t\t\t\tweap\tshld\thelm\ttors\t\t\t\tthro\t\t\t\t\t0\t0\n";
-                ss << u8"Assamic\t100\t1\t1\t3\t\t1\t\t\t\t2\t123\tatt-demon\t\t25\t50\tdmg-demon\t\t10\t25\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Arcadian\t100\t1\t1\t15\t\t11\t\t\t\t2\t123\tatt-demon\t\t51\t100\tdmg-demon\t\t26\t50\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Unearthly\t100\t1\t1\t25\t\t18\t\t\t\t1\t123\tatt-demon\t\t101\t150\tdmg-demon\t\t51\t100\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Astral\t100\t1\t1\t35\t\t26\t\t\t\t1\t123\tatt-demon\t\t151\t200\tdmg-demon\t\t101\t150\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Elysian\t100\t1\t1\t45\t\t33\t\t\t\t1\t123\tatt-demon\t\t201\t300\tdmg-demon\t\t151\t200\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Celestial\t100\t1\t\t55\t\t41\t\t\t\t1\t123\tatt-demon\t\t301\t400\tdmg-demon\t\t201\t300\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Diamond\t100\t1\t1\t26\t\t19\t\t\t\t1\t123\tatt-demon\t\t25\t50\tdmg-demon\t\t25\t40\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fletcher's\t100\t1\t\t50\t\t42\tama\t\t\t1\t125\tskilltab\t0\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Acrobat's\t100\t1\t\t50\t\t42\tama\t\t\t1\t125\tskilltab\t1\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Harpoonist's\t100\t1\t\t50\t\t42\tama\t\t\t1\t125\tskilltab\t2\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fletcher's\t100\t1\t1\t20\t\t15\tama\t\t\t1\t125\tskilltab\t0\t1\t1\t\t\t\t\t\t\t\t\t\tmiss\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bowyer's\t100\t1\t1\t40\t\t30\tama\t\t\t1\t125\tskilltab\t0\t2\t2\t\t\t\t\t\t\t\t\tlgld\tmiss\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Archer's\t100\t1\t\t60\t\t45\tama\t\t\t1\t125\tskilltab\t0\t3\t3\t\t\t\t\t\t\t\t\tlgld\tmiss\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Acrobat's\t100\t1\t1\t20\t\t15\tama\t\t\t1\t125\tskilltab\t1\t1\t1\t\t\t\t\t\t\t\t\t\tglov\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Gymnast's\t100\t1\t1\t40\t\t30\tama\t\t\t1\t125\tskilltab\t1\t2\t2\t\t\t\t\t\t\t\t\tlgld\tglov\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Athlete's\t100\t1\t\t60\t\t45\tama\t\t\t1\t125\tskilltab\t1\t3\t3\t\t\t\t\t\t\t\t\tlgld\tglov\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Harpoonist's\t100\t1\t1\t20\t\t15\tama\t\t\t1\t125\tskilltab\t2\t1\t1\t\t\t\t\t\t\t\t\t\tspea\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Spearmaiden's\t100\t1\t1\t40\t\t30\tama\t\t\t1\t125\tskilltab\t2\t2\t2\t\t\t\t\t\t\t\t\tlgld\tspea\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lancer's\t100\t1\t\t60\t\t45\tama\t\t\t1\t125\tskilltab\t2\t3\t3\t\t\t\t\t\t\t\t\tlgld\tspea\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burning\t100\t1\t1\t50\t\t42\tsor\t\t\t1\t125\tskilltab\t3\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sparking\t100\t1\t1\t50\t\t42\tsor\t\t\t1\t125\tskilltab\t4\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Chilling\t100\t1\t1\t50\t\t42\tsor\t\t\t1\t125\tskilltab\t5\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Burning\t100\t1\t1\t20\t\t15\tsor\t\t\t1\t125\tskilltab\t3\t1\t1\t\t\t\t\t\t\t\t\t\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Blazing\t100\t1\t1\t40\t\t30\tsor\t\t\t1\t125\tskilltab\t3\t2\t2\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Volcanic\t100\t1\t\t60\t\t45\tsor\t\t\t1\t125\tskilltab\t3\t3\t3\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sparking\t100\t1\t1\t20\t\t15\tsor\t\t\t1\t125\tskilltab\t4\t1\t1\t\t\t\t\t\t\t\t\t\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Charged\t100\t1\t1\t40\t\t30\tsor\t\t\t1\t125\tskilltab\t4\t2\t2\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Powered\t100\t1\t\t60\t\t45\tsor\t\t\t1\t125\tskilltab\t4\t3\t3\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Chilling\t100\t1\t1\t20\t\t15\tsor\t\t\t1\t125\tskilltab\t5\t1\t1\t\t\t\t\t\t\t\t\t\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Freezing\t100\t1\t1\t40\t\t30\tsor\t\t\t1\t125\tskilltab\t5\t2\t2\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glacial\t100\t1\t\t60\t\t45\tsor\t\t\t1\t125\tskilltab\t5\t3\t3\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Hexing\t100\t1\t1\t50\t\t42\tnec\t\t\t1\t125\tskilltab\t6\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fungal\t100\t1\t1\t50\t\t42\tnec\t\t\t1\t125\tskilltab\t7\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Graverobber's\t100\t1\t1\t50\t\t42\tnec\t\t\t1\t125\tskilltab\t8\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Hexing\t100\t1\t1\t20\t\t15\tnec\t\t\t1\t125\tskilltab\t6\t1\t1\t\t\t\t\t\t\t\t\t\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Blighting\t100\t1\t1\t40\t\t30\tnec\t\t\t1\t125\tskilltab\t6\t2\t2\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Accursed\t100\t1\t\t60\t\t45\tnec\t\t\t1\t125\tskilltab\t6\t3\t3\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fungal\t100\t1\t1\t20\t\t15\tnec\t\t\t1\t125\tskilltab\t7\t1\t1\t\t\t\t\t\t\t\t\t\twand\thead\tamul\tknif\tcirc\t\t\ttkni\t\t\t\t\t0\t0\n";
-                ss << u8"Noxious\t100\t1\t1\t40\t\t30\tnec\t\t\t1\t125\tskilltab\t7\t2\t2\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tknif\tcirc\t\t\ttkni\t\t\t\t\t0\t0\n";
-                ss << u8"Venomous\t100\t1\t\t60\t\t45\tnec\t\t\t1\t125\tskilltab\t7\t3\t3\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tknif\tcirc\t\t\ttkni\t\t\t\t\t0\t0\n";
-                ss << u8"Graverobber's\t100\t1\t1\t20\t\t15\tnec\t\t\t1\t125\tskilltab\t8\t1\t1\t\t\t\t\t\t\t\t\t\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Vodoun\t100\t1\t1\t40\t\t30\tnec\t\t\t1\t125\tskilltab\t8\t2\t2\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Golemlord's\t100\t1\t\t60\t\t45\tnec\t\t\t1\t125\tskilltab\t8\t3\t3\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lion Branded\t100\t1\t1\t50\t\t42\tpal\t\t\t1\t125\tskilltab\t9\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Captain's\t100\t1\t1\t50\t\t42\tpal\t\t\t1\t125\tskilltab\t10\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Preserver's\t100\t1\t1\t50\t\t42\tpal\t\t\t1\t125\tskilltab\t11\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lion Branded\t100\t1\t1\t20\t\t15\tpal\t\t\t1\t125\tskilltab\t9\t1\t1\t\t\t\t\t\t\t\t\t\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n";
-                ss << u8"Hawk Branded\t100\t1\t1\t40\t\t30\tpal\t\t\t1\t125\tskilltab\t9\t2\t2\t\t\t\t\t\t\t\t\tlgld\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n";
-                ss << u8"Rose Branded\t100\t1\t\t60\t\t45\tpal\t\t\t1\t125\tskilltab\t9\t3\t3\t\t\t\t\t\t\t\t\tlgld\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n";
-                ss << u8"Captain's\t100\t1\t1\t20\t\t15\tpal\t\t\t1\t125\tskilltab\t10\t1\t1\t\t\t\t\t\t\t\t\t\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n";
-                ss << u8"Commander's\t100\t1\t1\t40\t\t30\tpal\t\t\t1\t125\tskilltab\t10\t2\t2\t\t\t\t\t\t\t\t\tlgld\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n";
-                ss << u8"Marshal's\t100\t1\t\t60\t\t45\tpal\t\t\t1\t125\tskilltab\t10\t3\t3\t\t\t\t\t\t\t\t\tlgld\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n";
-                ss << u8"Preserver's\t100\t1\t1\t20\t\t15\tpal\t\t\t1\t125\tskilltab\t11\t1\t1\t\t\t\t\t\t\t\t\t\tshld\tashd\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Warder's\t100\t1\t1\t40\t\t30\tpal\t\t\t1\t125\tskilltab\t11\t2\t2\t\t\t\t\t\t\t\t\tlgld\tshld\tashd\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Guardian's\t100\t1\t\t60\t\t45\tpal\t\t\t1\t125\tskilltab\t11\t3\t3\t\t\t\t\t\t\t\t\tlgld\tshld\tashd\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Expert's\t100\t1\t1\t50\t\t42\tbar\t\t\t1\t125\tskilltab\t12\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Fanatic\t100\t1\t1\t50\t\t42\tbar\t\t\t1\t125\tskilltab\t13\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sounding\t100\t1\t1\t50\t\t42\tbar\t\t\t1\t125\tskilltab\t14\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Expert's\t100\t1\t1\t20\t\t15\tbar\t\t\t1\t125\tskilltab\t12\t1\t1\t\t\t\t\t\t\t\t\t\tphlm\tweap\thelm\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"Veteran's\t100\t1\t1\t40\t\t30\tbar\t\t\t1\t125\tskilltab\t12\t2\t2\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\thelm\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"Master's\t100\t1\t\t60\t\t45\tbar\t\t\t1\t125\tskilltab\t12\t3\t3\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\thelm\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"Fanatic\t100\t1\t1\t20\t\t15\tbar\t\t\t1\t125\tskilltab\t13\t1\t1\t\t\t\t\t\t\t\t\t\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"Raging\t100\t1\t1\t40\t\t30\tbar\t\t\t1\t125\tskilltab\t13\t2\t2\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"Furious\t100\t1\t\t60\t\t45\tbar\t\t\t1\t125\tskilltab\t13\t3\t3\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"Sounding\t100\t1\t1\t20\t\t15\tbar\t\t\t1\t125\tskilltab\t14\t1\t1\t\t\t\t\t\t\t\t\t\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"Resonant\t100\t1\t1\t40\t\t30\tbar\t\t\t1\t125\tskilltab\t14\t2\t2\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"Echoing\t100\t1\t\t60\t\t45\tbar\t\t\t1\t125\tskilltab\t14\t3\t3\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"Trainer's\t100\t1\t1\t50\t\t42\tdru\t\t\t1\t125\tskilltab\t15\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Spiritual\t100\t1\t1\t50\t\t42\tdru\t\t\t1\t125\tskilltab\t16\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Nature's\t100\t1\t1\t50\t\t42\tdru\t\t\t1\t125\tskilltab\t17\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Trainer's\t100\t1\t1\t20\t\t15\tdru\t\t\t1\t125\tskilltab\t15\t1\t1\t\t\t\t\t\t\t\t\t\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Caretaker's\t100\t1\t1\t40\t\t30\tdru\t\t\t1\t125\tskilltab\t15\t2\t2\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Keeper's\t100\t1\t\t60\t\t45\tdru\t\t\t1\t125\tskilltab\t15\t3\t3\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Spiritual\t100\t1\t1\t20\t\t15\tdru\t\t\t1\t125\tskilltab\t16\t1\t1\t\t\t\t\t\t\t\t\t\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Feral\t100\t1\t1\t40\t\t30\tdru\t\t\t1\t125\tskilltab\t16\t2\t2\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Communal\t100\t1\t\t60\t\t45\tdru\t\t\t1\t125\tskilltab\t16\t3\t3\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Nature's\t100\t1\t1\t20\t\t15\tdru\t\t\t1\t125\tskilltab\t17\t1\t1\t\t\t\t\t\t\t\t\t\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Terra's\t100\t1\t1\t40\t\t30\tdru\t\t\t1\t125\tskilltab\t17\t2\t2\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Gaea's\t100\t1\t\t60\t\t45\tdru\t\t\t1\t125\tskilltab\t17\t3\t3\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Entrapping\t100\t1\t1\t50\t\t42\tass\t\t\t1\t125\tskilltab\t18\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Mentalist's\t100\t1\t1\t50\t\t42\tass\t\t\t1\t125\tskilltab\t19\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shogukusha's\t100\t1\t1\t50\t\t42\tass\t\t\t1\t125\tskilltab\t20\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Entrapping\t100\t1\t1\t20\t\t15\tass\t\t\t1\t125\tskilltab\t18\t1\t1\t\t\t\t\t\t\t\t\t\th2h\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Trickster's\t100\t1\t1\t40\t\t30\tass\t\t\t1\t125\tskilltab\t18\t2\t2\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Cunning\t100\t1\t\t60\t\t45\tass\t\t\t1\t125\tskilltab\t18\t3\t3\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Mentalist's\t100\t1\t1\t20\t\t15\tass\t\t\t1\t125\tskilltab\t19\t1\t1\t\t\t\t\t\t\t\t\t\th2h\tamul\thelm\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Psychic\t100\t1\t1\t40\t\t30\tass\t\t\t1\t125\tskilltab\t19\t2\t2\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\thelm\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shadow\t100\t1\t\t60\t\t45\tass\t\t\t1\t125\tskilltab\t19\t3\t3\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\thelm\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shogukusha's\t100\t1\t1\t20\t\t15\tass\t\t\t1\t125\tskilltab\t20\t1\t1\t\t\t\t\t\t\t\t\t\th2h\tamul\tglov\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sensei's\t100\t1\t1\t40\t\t30\tass\t\t\t1\t125\tskilltab\t20\t2\t2\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\tglov\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Kenshi's\t100\t1\t\t60\t\t45\tass\t\t\t1\t125\tskilltab\t20\t3\t3\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\tglov\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Miocene\t100\t\t\t1\t\t1\t\t\t\t1\t101\tac/lvl\t6\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Miocene\t100\t\t1\t1\t\t1\t\t\t\t1\t101\tac/lvl\t1\t\t\t\t\t\t\t\t\t\t\twhit\tglov\tboot\tbelt\tshld\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Oligocene\t100\t\t1\t10\t\t7\t\t\t\t1\t101\tac/lvl\t9\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Oligocene\t100\t\t1\t10\t\t7\t\t\t\t1\t101\tac/lvl\t2\t\t\t\t\t\t\t\t\t\t\twhit\tglov\tboot\tbelt\tshld\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Eocene\t100\t\t1\t20\t\t15\t\t\t\t1\t101\tac/lvl\t18\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Eocene\t100\t\t1\t20\t\t15\t\t\t\t1\t101\tac/lvl\t3\t\t\t\t\t\t\t\t\t\t\twhit\tglov\tboot\tbelt\tshld\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Paleocene\t100\t1\t1\t30\t\t22\t\t\t\t4\t101\tac/lvl\t24\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Paleocene\t100\t1\t1\t30\t\t22\t\t\t\t3\t101\tac/lvl\t4\t\t\t\t\t\t\t\t\t\t\twhit\tglov\tboot\tbelt\tshld\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Knave's\t100\t\t\t1\t\t1\t\t\t\t1\t111\tdmg/lvl\t1\t\t\tatt/lvl\t10\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Jack's\t100\t\t1\t10\t\t7\t\t\t\t1\t111\tdmg/lvl\t2\t\t\tatt/lvl\t15\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Jester's\t100\t\t1\t20\t\t15\t\t\t\t1\t111\tdmg/lvl\t3\t\t\tatt/lvl\t22\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Joker's\t100\t\t1\t35\t\t26\t\t\t\t1\t111\tdmg/lvl\t4\t\t\tatt/lvl\t33\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Trump\t100\t1\t1\t50\t\t37\t\t\t\t7\t111\tdmg/lvl\t4\t\t\tatt/lvl\t33\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Loud\t100\t\t\t1\t\t1\t\t\t\t1\t105\tdmg/lvl\t2\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Calling\t100\t\t1\t10\t\t7\t\t\t\t1\t105\tdmg/lvl\t3\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Yelling\t100\t\t1\t20\t\t15\t\t\t\t1\t105\tdmg/lvl\t4\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Shouting\t100\t\t1\t35\t\t26\t\t\t\t1\t105\tdmg/lvl\t5\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Gritty\t100\t1\t1\t50\t\t37\t\t\t\t7\t105\tdmg/lvl\t6\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Paradox\t100\t\t1\t25\t\t18\t\t\t\t1\t101\tac%/lvl\t12\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Paradox\t100\t\t1\t25\t\t18\t\t\t\t1\t105\tdmg%/lvl\t12\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Robineye\t100\t\t\t1\t\t1\t\t\t\t1\t111\tatt/lvl\t4\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Sparroweye\t100\t\t\t10\t\t7\t\t\t\t1\t111\tatt/lvl\t6\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Falconeye\t100\t\t\t20\t\t15\t\t\t\t1\t111\tatt/lvl\t8\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Hawkeye\t100\t1\t\t35\t\t26\t\t\t\t7\t111\tatt/lvl\t12\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Eagleeye\t100\t\t\t50\t\t37\t\t\t\t1\t111\tatt/lvl\t16\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"Visionary\t100\t1\t1\t25\t\t18\t\t\t\t1\t111\tatt%/lvl\t2\t\t\t\t\t\t\t\t\t\t\twhit\thelm\tmiss\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Mnemonic\t100\t1\t1\t25\t\t18\t\t\t\t1\t115\tmana/lvl\t6\t\t\t\t\t\t\t\t\t\t\tcblu\thelm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snowflake\t100\t1\t1\t25\t\t18\t\t\t\t3\t137\tcold-len\t\t25\t25\tcold-min\t\t6\t9\tcold-max\t\t19\t30\tlblu\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shivering\t100\t1\t1\t35\t\t26\t\t\t\t2\t137\tcold-len\t\t50\t50\tcold-min\t\t10\t15\tcold-max\t\t31\t45\tlblu\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Boreal\t100\t1\t1\t50\t\t40\t\t\t\t1\t137\tcold-len\t\t75\t75\tcold-min\t\t16\t23\tcold-max\t\t46\t90\tlblu\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Hibernal\t100\t1\t1\t70\t\t60\t\t\t\t1\t137\tcold-len\t\t100\t100\tcold-min\t\t24\t45\tcold-max\t\t91\t140\tlblu\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ember\t100\t1\t1\t25\t\t18\t\t\t\t3\t138\tfire-min\t\t16\t25\tfire-max\t\t31\t60\t\t\t\t\tdred\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Smoldering\t100\t1\t1\t35\t\t26\t\t\t\t2\t138\tfire-min\t\t26\t50\tfire-max\t\t61\t90\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Smoking\t100\t1\t1\t47\t\t37\t\t\t\t1\t138\tfire-min\t\t51\t80\tfire-max\t\t91\t130\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Flaming\t100\t1\t1\t61\t\t51\t\t\t\t1\t138\tfire-min\t\t81\t120\tfire-max\t\t131\t180\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Scorching\t100\t1\t1\t77\t\t67\t\t\t\t1\t138\tfire-min\t\t121\t170\tfire-max\t\t181\t240\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Static\t100\t1\t1\t25\t\t18\t\t\t\t3\t139\tltng-min\t\t1\t1\tltng-max\t\t49\t120\t\t\t\t\tlyel\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glowing\t100\t1\t1\t34\t\t25\t\t\t\t2\t139\tltng-min\t\t1\t1\tltng-max\t\t121\t180\t\t\t\t\tlyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Buzzing\t100\t1\t1\t46\t\t36\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t181\t260\t\t\t\t\tlyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Arcing\t100\t1\t1\t60\t\t50\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t261\t360\t\t\t\t\tlyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shocking\t100\t1\t1\t76\t\t66\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t361\t480\t\t\t\t\tlyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Septic\t100\t1\t1\t1\t\t1\t\t\t\t3\t140\tdmg-pois\t50\t31\t31\t\t\t\t\t\t\t\t\tdgrn\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Envenomed\t100\t1\t1\t10\t\t7\t\t\t\t2\t140\tdmg-pois\t75\t41\t41\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Corosive\t100\t1\t1\t20\t\t15\t\t\t\t1\t140\tdmg-pois\t100\t205\t205\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Toxic\t100\t1\t1\t35\t\t26\t\t\t\t1\t140\tdmg-pois\t125\t308\t308\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Pestilent\t100\t1\t\t50\t\t37\t\t\t\t1\t140\tdmg-pois\t150\t470\t470\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Maiden's\t1\t1\t1\t36\t\t27\tama\t\t\t4\t125\tama\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Valkyrie's\t1\t1\t1\t90\t\t67\tama\t\t\t2\t125\tama\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Maiden's\t1\t1\t1\t30\t\t22\tama\t\t\t4\t125\tama\t\t1\t1\t\t\t\t\t\t\t\t\t\tmiss\tspea\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Valkyrie's\t1\t1\t1\t50\t\t42\tama\t\t\t2\t125\tama\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tmiss\tspea\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Monk's\t1\t1\t1\t36\t\t27\tpal\t\t\t4\t125\tpal\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Priest's\t1\t1\t1\t90\t\t67\tpal\t\t\t2\t125\tpal\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Monk's\t1\t1\t1\t30\t\t22\tpal\t\t\t4\t125\tpal\t\t1\t1\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Priest's\t1\t1\t1\t50\t\t42\tpal\t\t\t2\t125\tpal\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Monk's\t1\t1\t1\t35\t\t27\tpal\t\t\t4\t125\tpal\t\t1\t1\t\t\t\t\t\t\t\t\t\tswor\tmace\thamm\tshld\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Priest's\t1\t1\t1\t65\t\t58\tpal\t\t\t2\t125\tpal\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tswor\tmace\thamm\tshld\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Summoner's\t1\t1\t1\t36\t\t27\tnec\t\t\t4\t125\tnec\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Necromancer's\t1\t1\t1\t90\t\t67\tnec\t\t\t2\t125\tnec\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Summoner's\t1\t1\t1\t30\t\t22\tnec\t\t\t4\t125\tnec\t\t1\t1\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Necromancer's\t1\t1\t1\t50\t\t42\tnec\t\t\t2\t125\tnec\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Angel's\t1\t1\t1\t36\t\t27\tsor\t\t\t4\t125\tsor\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Arch-Angel's\t1\t1\t1\t90\t\t67\tsor\t\t\t2\t125\tsor\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Angel's\t1\t1\t1\t30\t\t22\tsor\t\t\t4\t125\tsor\t\t1\t1\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Arch-Angel's\t1\t1\t1\t50\t\t42\tsor\t\t\t2\t125\tsor\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Slayer's\t1\t1\t1\t36\t\t27\tbar\t\t\t4\t125\tbar\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Berserker's\t1\t1\t1\t90\t\t67\tbar\t\t\t2\t125\tbar\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Slayer's\t1\t1\t1\t30\t\t22\tbar\t\t\t4\t125\tbar\t\t1\t1\t\t\t\t\t\t\t\t\t\ttkni\taxe\tspea\tclub\tswor\thamm\tmace\tjave\t\t\t\t\t0\t0\n";
-                ss << u8"Berserker's\t1\t1\t1\t50\t\t42\tbar\t\t\t1\t125\tbar\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\ttkni\taxe\tspea\tclub\tswor\thamm\tmace\tjave\t\t\t\t\t0\t0\n";
-                ss << u8"Slayer's\t100\t1\t1\t30\t\t22\tbar\t\t\t4\t125\tbar\t\t1\t1\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Berserker's\t100\t1\t1\t50\t\t42\tbar\t\t\t2\t125\tbar\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shaman's\t100\t1\t1\t36\t\t27\tdru\t\t\t4\t125\tdru\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Hierophant's\t100\t1\t1\t90\t\t67\tdru\t\t\t2\t125\tdru\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shaman's\t100\t1\t1\t30\t\t22\tdru\t\t\t4\t125\tdru\t\t1\t1\t\t\t\t\t\t\t\t\t\tclub\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Hierophant's\t100\t1\t1\t50\t\t42\tdru\t\t\t2\t125\tdru\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tclub\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Magekiller's\t100\t1\t1\t36\t\t27\tass\t\t\t4\t125\tass\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Witch-hunter's\t100\t1\t1\t90\t\t67\tass\t\t\t2\t125\tass\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Magekiller's\t100\t1\t1\t30\t\t22\tass\t\t\t4\t125\tass\t\t1\t1\t\t\t\t\t\t\t\t\t\th2h\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Witch-hunter's\t100\t1\t1\t50\t\t42\tass\t\t\t2\t125\tass\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\th2h\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Compact\t100\t1\t1\t1\t\t1\t\t\t\t6\t141\tstack\t\t20\t40\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Thin\t100\t1\t1\t17\t\t12\t\t\t\t5\t141\tstack\t\t41\t80\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Dense\t100\t1\t1\t38\t\t30\t\t\t\t4\t141\tstack\t\t81\t120\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Consecrated\t100\t1\t1\t1\t\t1\t\t\t\t4\t142\tatt-undead\t\t25\t75\tdmg-undead\t\t25\t75\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Pure\t100\t1\t1\t15\t\t11\t\t\t\t3\t142\tatt-undead\t\t76\t175\tdmg-undead\t\t76\t125\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Sacred\t100\t1\t1\t25\t\t18\t\t\t\t2\t142\tatt-undead\t\t175\t250\tdmg-undead\t\t126\t200\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Hallowed\t100\t1\t1\t35\t\t27\t\t\t\t1\t142\tatt-undead\t\t251\t325\tdmg-undead\t\t201\t275\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Divine\t100\t1\t\t45\t\t37\t\t\t\t1\t142\tatt-undead\t\t326\t450\tdmg-undead\t\t276\t350\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"Pearl\t100\t1\t1\t18\t\t13\t\t\t\t1\t142\tatt-undead\t\t25\t50\tdmg-undead\t\t25\t50\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Crimson\t1\t1\t1\t5\t\t3\t\t\t\t4\t118\tres-fire\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\tweap\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Red\t100\t1\t1\t15\t\t11\t\t\t\t4\t103\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sanguinary\t100\t1\t1\t45\t\t37\t\t\t\t4\t103\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bloody\t100\t1\t\t75\t\t67\t\t\t\t4\t103\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Red\t100\t1\t1\t30\t\t22\t\t\t\t4\t103\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Sanguinary\t100\t1\t\t60\t\t52\t\t\t\t4\t103\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Red\t100\t1\t1\t90\t\t82\t\t\t\t4\t103\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t100\t1\t1\t7\t\t5\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Forked\t100\t1\t1\t37\t\t29\t\t\t\t4\t104\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Serrated\t100\t1\t\t67\t\t59\t\t\t\t4\t104\tdmg-max\t\t3\t3\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t100\t1\t1\t22\t\t16\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Forked\t100\t1\t\t52\t\t44\t\t\t\t4\t104\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jagged\t100\t1\t1\t81\t\t73\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\tblac\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snowflake\t100\t1\t1\t9\t\t6\t\t\t\t2\t137\tcold-len\t\t25\t25\tcold-min\t\t1\t1\tcold-max\t\t2\t3\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shivering\t100\t1\t1\t15\t\t11\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t2\t4\tcold-max\t\t4\t8\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Boreal\t100\t1\t1\t30\t\t22\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t5\t7\tcold-max\t\t9\t15\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Hibernal\t100\t1\t\t45\t\t38\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t8\t13\tcold-max\t\t16\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snowflake\t100\t1\t1\t18\t\t13\t\t\t\t2\t137\tcold-len\t\t25\t25\tcold-min\t\t2\t3\tcold-max\t\t3\t5\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shivering\t100\t1\t1\t29\t\t21\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t4\t5\tcold-max\t\t6\t10\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Boreal\t100\t1\t1\t49\t\t41\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t6\t10\tcold-max\t\t11\t20\tlblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Hibernal\t100\t1\t\t69\t\t61\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t11\t15\tcold-max\t\t21\t30\tlblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Snowflake\t100\t1\t1\t27\t\t20\t\t\t\t2\t137\tcold-len\t\t25\t25\tcold-min\t\t1\t2\tcold-max\t\t2\t4\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shivering\t100\t1\t1\t42\t\t34\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t3\t4\tcold-max\t\t5\t8\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Boreal\t100\t1\t1\t66\t\t58\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t5\t7\tcold-max\t\t9\t14\tlblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Hibernal\t100\t1\t\t91\t\t83\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t8\t10\tcold-max\t\t15\t20\tlblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ember\t100\t1\t1\t5\t\t3\t\t\t\t2\t138\tfire-min\t\t1\t1\tfire-max\t\t2\t3\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Smoldering\t100\t1\t1\t15\t\t11\t\t\t\t1\t138\tfire-min\t\t2\t3\tfire-max\t\t4\t7\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Smoking\t100\t1\t1\t28\t\t21\t\t\t\t1\t138\tfire-min\t\t4\t7\tfire-max\t\t8\t19\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Flaming\t100\t1\t\t43\t\t35\t\t\t\t1\t138\tfire-min\t\t8\t18\tfire-max\t\t20\t36\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ember\t100\t1\t1\t13\t\t9\t\t\t\t2\t138\tfire-min\t\t1\t1\tfire-max\t\t2\t3\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Smoldering\t100\t1\t1\t27\t\t20\t\t\t\t1\t138\tfire-min\t\t2\t3\tfire-max\t\t4\t12\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Smoking\t100\t1\t1\t47\t\t39\t\t\t\t1\t138\tfire-min\t\t4\t9\tfire-max\t\t13\t27\t\t\t\t\tlred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Flaming\t100\t1\t\t67\t\t59\t\t\t\t1\t138\tfire-min\t\t10\t27\tfire-max\t\t28\t43\t\t\t\t\tlred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Ember\t100\t1\t1\t21\t\t15\t\t\t\t2\t138\tfire-min\t\t1\t1\tfire-max\t\t2\t3\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Smoldering\t100\t1\t1\t40\t\t32\t\t\t\t1\t138\tfire-min\t\t2\t3\tfire-max\t\t4\t10\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Smoking\t100\t1\t1\t64\t\t56\t\t\t\t1\t138\tfire-min\t\t4\t9\tfire-max\t\t11\t19\t\t\t\t\tlred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Flaming\t100\t1\t\t89\t\t81\t\t\t\t1\t138\tfire-min\t\t10\t19\tfire-max\t\t20\t29\t\t\t\t\tlred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Static\t100\t1\t1\t7\t\t5\t\t\t\t2\t139\tltng-min\t\t1\t1\tltng-max\t\t4\t5\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glowing\t100\t1\t1\t14\t\t10\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t6\t17\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Arcing\t100\t1\t1\t29\t\t21\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t18\t44\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shocking\t100\t1\t\t44\t\t36\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t45\t79\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Static\t100\t1\t1\t14\t\t10\t\t\t\t2\t139\tltng-min\t\t1\t1\tltng-max\t\t5\t9\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glowing\t100\t1\t1\t28\t\t20\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t10\t26\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Arcing\t100\t1\t1\t48\t\t40\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t27\t58\t\t\t\t\twhit\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shocking\t100\t1\t\t68\t\t60\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t59\t90\t\t\t\t\twhit\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Static\t100\t1\t1\t23\t\t17\t\t\t\t2\t139\tltng-min\t\t1\t1\tltng-max\t\t6\t11\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Glowing\t100\t1\t1\t41\t\t33\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t12\t24\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Arcing\t100\t1\t1\t65\t\t57\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t25\t43\t\t\t\t\twhit\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Shocking\t100\t1\t\t90\t\t82\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t44\t71\t\t\t\t\twhit\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Septic\t100\t1\t1\t1\t\t1\t\t\t\t2\t140\tdmg-pois\t75\t18\t18\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Envenomed\t100\t1\t1\t12\t\t9\t\t\t\t1\t140\tdmg-pois\t100\t39\t39\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Toxic\t100\t1\t1\t27\t\t20\t\t\t\t1\t140\tdmg-pois\t125\t103\t103\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Pestilent\t100\t1\t\t42\t\t34\t\t\t\t1\t140\tdmg-pois\t150\t171\t171\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Septic\t100\t1\t1\t9\t\t6\t\t\t\t2\t140\tdmg-pois\t75\t35\t35\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Envenomed\t100\t1\t1\t26\t\t19\t\t\t\t1\t140\tdmg-pois\t100\t77\t77\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Toxic\t100\t1\t1\t46\t\t38\t\t\t\t1\t140\tdmg-pois\t125\t185\t185\t\t\t\t\t\t\t\t\tdgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Pestilent\t100\t1\t\t66\t\t58\t\t\t\t1\t140\tdmg-pois\t150\t299\t299\t\t\t\t\t\t\t\t\tdgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Septic\t100\t1\t1\t18\t\t13\t\t\t\t2\t140\tdmg-pois\t75\t52\t52\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Envenomed\t100\t1\t1\t39\t\t31\t\t\t\t1\t140\tdmg-pois\t100\t128\t128\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Toxic\t100\t1\t1\t63\t\t55\t\t\t\t1\t140\tdmg-pois\t125\t205\t205\t\t\t\t\t\t\t\t\tdgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Pestilent\t100\t1\t\t88\t\t80\t\t\t\t1\t140\tdmg-pois\t150\t299\t299\t\t\t\t\t\t\t\t\tdgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tireless\t1\t1\t1\t1\t5\t1\t\t\t\t4\t108\tregen-stam\t\t10\t10\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Lizard's\t1\t1\t1\t1\t2\t1\t\t\t\t4\t115\tmana\t\t1\t2\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\torb\t\t\tboot\tglov\t\t\t\t0\t0\n";
-                ss << u8"Azure\t1\t1\t1\t1\t4\t1\t\t\t\t3\t117\tres-cold\t\t5\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Crimson\t1\t1\t1\t1\t4\t1\t\t\t\t3\t118\tres-fire\t\t5\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Tangerine\t1\t1\t1\t1\t4\t1\t\t\t\t3\t119\tres-ltng\t\t5\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Beryl\t1\t1\t1\t1\t4\t1\t\t\t\t3\t120\tres-pois\t\t5\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Godly\t100\t1\t1\t50\t\t43\t\t\t\t1\t101\tac%\t\t101\t200\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Cruel\t100\t1\t1\t56\t\t48\t\t\t\t1\t105\tdmg%\t\t201\t300\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"Name\tversion\tspawnable\trare\tlevel\tmaxlevel\tlevelreq\tclassspecific\tclass\tclasslevelreq\tfrequency\tgroup\tmod1code\tmod1param\tmod1min\tmod1max\tmod2code\tmod2param\tmod2min\tmod2max\tmod3code\tmod3param\tmod3min\tmod3max\ttransformcolor\titype1\titype2\titype3\titype4\titype5\titype6\titype7\tetype1\tetype2\tetype3\tetype4\tetype5\tmultiply\tadd\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sturdy\t0\t1\t1\t4\t\t3\t\t\t\t0\t101\tac%\t\t20\t30\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Strong\t0\t1\t1\t9\t\t6\t\t\t\t0\t101\tac%\t\t31\t40\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Glorious\t0\t1\t1\t19\t\t14\t\t\t\t0\t101\tac%\t\t41\t50\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Blessed\t0\t1\t1\t25\t\t18\t\t\t\t0\t101\tac%\t\t51\t65\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Saintly\t0\t1\t1\t31\t\t23\t\t\t\t0\t101\tac%\t\t66\t80\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Holy\t0\t1\t1\t36\t\t27\t\t\t\t0\t101\tac%\t\t81\t100\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Devious\t0\t1\t1\t7\t\t5\t\t\t\t0\t103\tred-mag\t0\t1\t1\t\t\t\t\t\t\t\t\tdblu\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fortified\t0\t1\t1\t14\t\t10\t\t\t\t0\t103\tred-mag\t0\t2\t2\t\t\t\t\t\t\t\t\tdblu\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t0\t1\t1\t1\t\t1\t\t\t\t0\t106\tdmg%\t0\t10\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Deadly\t0\t1\t1\t5\t\t3\t\t\t\t0\t106\tdmg%\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Vicious\t0\t1\t1\t8\t\t6\t\t\t\t0\t106\tdmg%\t0\t31\t40\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Brutal\t0\t1\t1\t14\t\t10\t\t\t\t0\t106\tdmg%\t0\t41\t50\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Massive\t0\t1\t1\t20\t\t15\t\t\t\t0\t106\tdmg%\t0\t51\t65\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Savage\t0\t1\t1\t26\t\t19\t\t\t\t0\t106\tdmg%\t0\t66\t80\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n",
+                u8"Merciless\t0\t1\t1\t32\t\t24\t\t\t\t0\t106\tdmg%\t0\t81\t100\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n",
+                u8"Vulpine\t0\t1\t1\t9\t\t6\t\t\t\t0\t107\tdmg-to-mana\t0\t10\t10\t\t\t\t\t\t\t\t\tcblu\tshld\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tireless\t0\t1\t1\t14\t\t10\t\t\t\t0\t109\tregen-stam\t0\t50\t50\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t0\t1\t1\t14\t\t10\t\t\t\t0\t110\tstam\t0\t5\t10\t\t\t\t\t\t\t\t\t\tboot\tglov\tbelt\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t0\t1\t1\t1\t\t1\t\t\t\t0\t111\tatt\t0\t10\t20\t\t\t\t\t\t\t\t\t\tweap\tring\tglov\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Iron\t0\t1\t1\t4\t\t3\t\t\t\t0\t111\tatt\t0\t21\t40\t\t\t\t\t\t\t\t\t\tweap\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Steel\t0\t1\t1\t8\t\t6\t\t\t\t0\t111\tatt\t0\t41\t60\t\t\t\t\t\t\t\t\t\tweap\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Silver\t0\t1\t1\t12\t\t9\t\t\t\t0\t111\tatt\t0\t61\t80\t\t\t\t\t\t\t\t\t\tweap\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Gold\t0\t1\t1\t17\t\t12\t\t\t\t0\t111\tatt\t0\t81\t100\t\t\t\t\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Platinum\t0\t1\t1\t22\t\t16\t\t\t\t0\t111\tatt\t0\t101\t120\t\t\t\t\t\t\t\t\tlgld\tweap\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Meteoric\t0\t1\t1\t27\t\t20\t\t\t\t0\t111\tatt\t0\t121\t150\t\t\t\t\t\t\t\t\tlgld\tweap\tring\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n",
+                u8"Sharp\t0\t1\t1\t5\t\t3\t\t\t\t0\t112\tatt\t0\t10\t20\tdmg%\t0\t10\t20\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fine\t0\t1\t1\t9\t\t6\t\t\t\t0\t112\tatt\t0\t21\t40\tdmg%\t0\t21\t30\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Warrior's\t0\t1\t1\t15\t\t11\t\t\t\t0\t112\tatt\t0\t41\t60\tdmg%\t0\t31\t40\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Soldier's\t0\t1\t1\t21\t\t15\t\t\t\t0\t112\tatt\t0\t61\t80\tdmg%\t0\t41\t50\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Knight's\t0\t1\t1\t25\t\t18\t\t\t\t0\t112\tatt\t0\t81\t100\tdmg%\t0\t51\t65\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lord's\t0\t1\t1\t30\t\t22\t\t\t\t0\t112\tatt\t0\t101\t120\tdmg%\t0\t66\t80\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n",
+                u8"King's\t0\t1\t1\t35\t\t26\t\t\t\t0\t112\tatt\t0\t121\t150\tdmg%\t0\t81\t100\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\t\t\t\t0\t0\n",
+                u8"Howling\t0\t1\t1\t16\t\t12\t\t\t\t0\t113\thowl\t0\t128\t128\t\t\t\t\t\t\t\t\toran\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"Fortuitous\t0\t1\t1\t5\t\t3\t\t\t\t0\t114\tmag%\t0\t10\t15\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Glimmering\t0\t1\t1\t1\t\t1\t\t\t\t0\t116\tlight\t0\t1\t1\t\t\t\t\t\t\t\t\t\tarmo\twand\tstaf\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Glowing\t0\t1\t1\t6\t\t4\t\t\t\t0\t116\tlight\t0\t2\t2\t\t\t\t\t\t\t\t\tlyel\tarmo\twand\tstaf\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t0\t1\t1\t3\t\t2\t\t\t\t0\t118\tmana\t0\t1\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\tboot\tglov\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snake's\t0\t1\t1\t6\t\t4\t\t\t\t0\t118\tmana\t0\t5\t10\t\t\t\t\t\t\t\t\t\tshld\trod\tbelt\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t0\t1\t1\t14\t\t10\t\t\t\t0\t118\tmana\t0\t11\t20\t\t\t\t\t\t\t\t\t\tshld\trod\tbelt\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t0\t1\t1\t37\t\t27\t\t\t\t0\t118\tmana\t0\t11\t20\t\t\t\t\t\t\t\t\t\ttors\thelm\tboot\tglov\tmele\t\t\th2h\trod\t\t\t\t0\t0\n",
+                u8"Drake's\t0\t1\t1\t20\t\t15\t\t\t\t0\t118\tmana\t0\t21\t30\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\tbelt\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Dragon's\t0\t1\t1\t24\t\t18\t\t\t\t0\t118\tmana\t0\t31\t40\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Dragon's\t0\t1\t1\t52\t\t39\t\t\t\t0\t118\tmana\t0\t31\t40\t\t\t\t\t\t\t\t\tcblu\ttors\thelm\tboot\tglov\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Wyrm's\t0\t1\t1\t30\t\t22\t\t\t\t0\t118\tmana\t0\t41\t60\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Prismatic\t0\t1\t1\t27\t\t20\t\t\t\t0\t120\tres-all\t0\t15\t25\t\t\t\t\t\t\t\t\tlpur\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Prismatic\t0\t1\t1\t62\t\t46\t\t\t\t0\t120\tres-all\t0\t15\t15\t\t\t\t\t\t\t\t\tlpur\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Azure\t0\t1\t1\t5\t\t3\t\t\t\t0\t121\tres-cold\t0\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\trod\tmiss\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lapis\t0\t1\t1\t12\t\t9\t\t\t\t0\t121\tres-cold\t0\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lapis\t0\t1\t1\t35\t\t26\t\t\t\t0\t121\tres-cold\t0\t11\t20\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"Cobalt\t0\t1\t1\t18\t\t13\t\t\t\t0\t121\tres-cold\t0\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"Cobalt\t0\t1\t1\t55\t\t41\t\t\t\t0\t121\tres-cold\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sapphire\t0\t1\t1\t25\t\t18\t\t\t\t0\t121\tres-cold\t0\t31\t50\t\t\t\t\t\t\t\t\tlblu\trod\tboot\tring\tamul\tmiss\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Crimson\t0\t1\t1\t5\t\t3\t\t\t\t0\t122\tres-fire\t0\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\trod\tmiss\tring\tamul\tamul\t\t\t\t\t\t\t0\t0\n",
+                u8"Burgundy\t0\t1\t1\t12\t\t9\t\t\t\t0\t122\tres-fire\t0\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Burgundy\t0\t1\t1\t35\t\t26\t\t\t\t0\t122\tres-fire\t0\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"Garnet\t0\t1\t1\t18\t\t13\t\t\t\t0\t122\tres-fire\t0\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"Garnet\t0\t1\t1\t55\t\t41\t\t\t\t0\t122\tres-fire\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ruby\t0\t1\t1\t25\t\t18\t\t\t\t0\t122\tres-fire\t0\t31\t50\t\t\t\t\t\t\t\t\tlred\twand\tstaf\tboot\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ocher\t0\t1\t1\t5\t\t3\t\t\t\t0\t123\tres-ltng\t0\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\tmiss\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tangerine\t0\t1\t1\t12\t\t9\t\t\t\t0\t123\tres-ltng\t0\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tangerine\t0\t1\t1\t35\t\t26\t\t\t\t0\t123\tres-ltng\t0\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"Coral\t0\t1\t1\t18\t\t13\t\t\t\t0\t123\tres-ltng\t0\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"Coral\t0\t1\t1\t55\t\t41\t\t\t\t0\t123\tres-ltng\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Amber\t0\t1\t1\t25\t\t18\t\t\t\t0\t123\tres-ltng\t0\t31\t50\t\t\t\t\t\t\t\t\tlyel\tarmo\tring\tamul\tstaf\twand\t\t\tshld\tglov\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Beryl\t0\t1\t1\t5\t\t3\t\t\t\t0\t124\tres-pois\t0\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\tscep\tstaf\tmiss\t\t\t\t\t\t\t0\t0\n",
+                u8"Jade\t0\t1\t1\t12\t\t9\t\t\t\t0\t124\tres-pois\t0\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\tscep\tstaf\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jade\t0\t1\t1\t35\t\t26\t\t\t\t0\t124\tres-pois\t0\t11\t20\t\t\t\t\t\t\t\t\t\tweap\tring\t\t\t\t\t\tstaf\tscep\t\t\t\t0\t0\n",
+                u8"Viridian\t0\t1\t1\t18\t\t13\t\t\t\t0\t124\tres-pois\t0\t21\t30\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tscep\tstaf\tring\tamul\t\t\t\t\t\t0\t0\n",
+                u8"Viridian\t0\t1\t1\t55\t\t41\t\t\t\t0\t124\tres-pois\t0\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tboot\tglov\tbelt\t\t\t\tstaf\tscep\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Emerald\t0\t1\t1\t25\t\t18\t\t\t\t0\t124\tres-pois\t0\t31\t50\t\t\t\t\t\t\t\t\tlgrn\tscep\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fletcher's\t0\t1\t1\t30\t\t22\t\t\t\t0\t125\tama\t0\t1\t1\t\t\t\t\t\t\t\t\t\tmiss\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Archer's\t0\t1\t1\t40\t\t30\t\t\t\t0\t125\tama\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tmiss\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Archer's\t0\t1\t1\t90\t\t67\t\t\t\t0\t125\tama\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Monk's\t0\t1\t1\t30\t\t22\t\t\t\t0\t126\tpal\t0\t1\t1\t\t\t\t\t\t\t\t\t\tscep\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Priest's\t0\t1\t1\t40\t\t30\t\t\t\t0\t126\tpal\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tscep\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Priest's\t0\t1\t1\t90\t\t67\t\t\t\t0\t126\tpal\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Summoner's\t0\t1\t1\t30\t\t22\t\t\t\t0\t127\tnec\t0\t1\t1\t\t\t\t\t\t\t\t\t\twand\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Necromancer's\t0\t1\t1\t40\t\t30\t\t\t\t0\t127\tnec\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\twand\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Necromancer's\t0\t1\t1\t90\t\t67\t\t\t\t0\t127\tnec\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Angel's\t0\t1\t1\t30\t\t22\t\t\t\t0\t128\tsor\t0\t1\t1\t\t\t\t\t\t\t\t\t\tstaf\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Arch-Angel's\t0\t1\t1\t40\t\t30\t\t\t\t0\t128\tsor\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Arch-Angel's\t0\t1\t1\t90\t\t67\t\t\t\t0\t128\tsor\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Slayer's\t0\t1\t1\t30\t\t22\t\t\t\t0\t129\tbar\t0\t1\t1\t\t\t\t\t\t\t\t\t\tmele\tamul\t\t\t\t\t\trod\th2h\t\t\t\t0\t0\n",
+                u8"Berserker's\t0\t1\t1\t40\t\t30\t\t\t\t0\t129\tbar\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tmele\t\t\t\t\t\t\trod\th2h\t\t\t\t0\t0\n",
+                u8"Berserker's\t0\t1\t1\t90\t\t67\t\t\t\t0\t129\tbar\t0\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Triumphant\t0\t1\t1\t3\t\t2\t\t\t\t0\t132\tmana-kill\t0\t1\t1\t\t\t\t\t\t\t\t\t\tmele\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n",
+                u8"Stout\t100\t1\t1\t1\t\t1\t\t\t\t4\t101\tac\t\t3\t5\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stout\t100\t1\t1\t7\t\t5\t\t\t\t4\t101\tac\t\t6\t9\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stout\t100\t1\t1\t12\t\t9\t\t\t\t4\t101\tac\t\t10\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Burly\t100\t1\t1\t17\t\t12\t\t\t\t4\t101\tac\t\t13\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Burly\t100\t1\t1\t22\t\t16\t\t\t\t4\t101\tac\t\t16\t22\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Burly\t100\t1\t1\t27\t\t20\t\t\t\t4\t101\tac\t\t23\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stalwart\t100\t1\t\t32\t\t24\t\t\t\t4\t101\tac\t\t33\t40\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stalwart\t100\t1\t\t37\t\t29\t\t\t\t4\t101\tac\t\t44\t50\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stalwart\t100\t1\t\t42\t\t34\t\t\t\t4\t101\tac\t\t60\t100\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stout\t100\t1\t1\t1\t\t1\t\t\t\t4\t101\tac\t\t2\t3\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stout\t100\t1\t1\t14\t\t10\t\t\t\t4\t101\tac\t\t4\t6\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stout\t100\t1\t1\t20\t\t15\t\t\t\t4\t101\tac\t\t8\t12\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Burly\t100\t1\t1\t26\t\t19\t\t\t\t4\t101\tac\t\t13\t18\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Burly\t100\t1\t1\t32\t\t24\t\t\t\t4\t101\tac\t\t20\t30\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stalwart\t100\t1\t\t38\t\t30\t\t\t\t4\t101\tac\t\t30\t40\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stalwart\t100\t1\t\t45\t\t37\t\t\t\t4\t101\tac\t\t45\t60\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stout\t100\t1\t1\t1\t\t1\t\t\t\t4\t101\tac\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stout\t100\t1\t1\t21\t\t15\t\t\t\t4\t101\tac\t\t4\t8\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Burly\t100\t1\t1\t36\t\t28\t\t\t\t4\t101\tac\t\t15\t20\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Stalwart\t100\t1\t\t48\t\t40\t\t\t\t4\t101\tac\t\t20\t30\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Blanched\t100\t1\t1\t1\t\t1\t\t\t\t4\t101\tac\t\t5\t8\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Eburin\t100\t1\t1\t16\t\t12\t\t\t\t4\t101\tac\t\t9\t20\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bone\t100\t1\t1\t32\t\t24\t\t\t\t4\t101\tac\t\t21\t40\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ivory\t100\t1\t\t64\t\t56\t\t\t\t4\t101\tac\t\t41\t64\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sturdy\t1\t1\t1\t1\t\t1\t\t\t\t9\t101\tac%\t\t10\t20\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sturdy\t1\t1\t1\t4\t\t3\t\t\t\t9\t101\tac%\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Strong\t1\t1\t1\t9\t\t6\t\t\t\t8\t101\tac%\t\t31\t40\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Glorious\t1\t1\t1\t19\t\t14\t\t\t\t8\t101\tac%\t\t41\t50\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Blessed\t1\t1\t1\t25\t\t18\t\t\t\t7\t101\tac%\t\t51\t65\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Saintly\t1\t1\t1\t31\t\t23\t\t\t\t7\t101\tac%\t\t66\t80\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Holy\t1\t1\t1\t36\t\t27\t\t\t\t6\t101\tac%\t\t81\t100\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Godly\t100\t1\t\t45\t\t38\t\t\t\t3\t101\tac%\t\t101\t200\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Devious\t1\t0\t1\t7\t\t5\t\t\t\t5\t102\tred-mag\t\t1\t1\t\t\t\t\t\t\t\t\t\tshld\tcirc\torb\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Blank\t1\t0\t1\t14\t\t10\t\t\t\t4\t102\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\tshld\tcirc\torb\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Null\t100\t0\t1\t21\t\t16\t\t\t\t4\t102\tred-mag\t\t3\t5\t\t\t\t\t\t\t\t\tdblu\tshld\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Antimagic\t100\t0\t\t28\t\t21\t\t\t\t4\t102\tred-mag\t\t6\t10\t\t\t\t\t\t\t\t\tdblu\tshld\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Red\t100\t0\t1\t4\t\t3\t\t\t\t4\t103\tdmg-min\t\t1\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Red\t100\t0\t1\t16\t\t12\t\t\t\t4\t103\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sanguinary\t100\t0\t1\t28\t\t21\t\t\t\t4\t103\tdmg-min\t\t4\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sanguinary\t100\t0\t1\t40\t\t32\t\t\t\t4\t103\tdmg-min\t\t5\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bloody\t100\t0\t\t52\t\t46\t\t\t\t4\t103\tdmg-min\t\t7\t8\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Red\t100\t0\t1\t11\t\t8\t\t\t\t4\t103\tdmg-min\t\t1\t2\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sanguinary\t100\t0\t1\t33\t\t25\t\t\t\t4\t103\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bloody\t100\t0\t\t55\t\t47\t\t\t\t4\t103\tdmg-min\t\t4\t4\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Red\t100\t0\t1\t24\t\t16\t\t\t\t4\t103\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sanguinary\t100\t0\t1\t41\t\t33\t\t\t\t4\t103\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bloody\t100\t0\t\t58\t\t50\t\t\t\t4\t103\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Scarlet\t100\t1\t1\t8\t\t6\t\t\t\t4\t103\tdmg-min\t\t1\t4\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Crimson\t100\t1\t1\t38\t\t30\t\t\t\t4\t103\tdmg-min\t\t5\t8\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t100\t0\t1\t3\t\t2\t\t\t\t4\t104\tdmg-max\t\t1\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t100\t0\t1\t10\t\t7\t\t\t\t4\t104\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t100\t0\t1\t17\t\t12\t\t\t\t4\t104\tdmg-max\t\t5\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Forked\t100\t0\t1\t25\t\t18\t\t\t\t4\t104\tdmg-max\t\t7\t8\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Forked\t100\t0\t1\t32\t\t24\t\t\t\t4\t104\tdmg-max\t\t9\t10\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serrated\t100\t0\t\t39\t\t31\t\t\t\t4\t104\tdmg-max\t\t11\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serrated\t100\t0\t\t47\t\t39\t\t\t\t4\t104\tdmg-max\t\t13\t14\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t100\t0\t1\t10\t\t7\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t100\t0\t1\t20\t\t15\t\t\t\t4\t104\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Forked\t100\t0\t1\t30\t\t22\t\t\t\t4\t104\tdmg-max\t\t3\t3\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Forked\t100\t0\t1\t40\t\t32\t\t\t\t4\t104\tdmg-max\t\t4\t5\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serrated\t100\t0\t\t50\t\t42\t\t\t\t4\t104\tdmg-max\t\t6\t7\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t100\t0\t1\t23\t\t17\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\tblac\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Forked\t100\t0\t1\t38\t\t30\t\t\t\t4\t104\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\tblac\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serrated\t100\t0\t\t53\t\t45\t\t\t\t4\t104\tdmg-max\t\t3\t3\t\t\t\t\t\t\t\t\tblac\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Carbuncle\t100\t1\t1\t12\t\t9\t\t\t\t4\t104\tdmg-max\t\t1\t5\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Carmine\t100\t1\t1\t35\t\t27\t\t\t\t4\t104\tdmg-max\t\t6\t9\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Vermillion\t100\t1\t\t58\t\t50\t\t\t\t4\t104\tdmg-max\t\t11\t15\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t1\t1\t1\t1\t\t1\t\t\t\t9\t105\tdmg%\t\t10\t20\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Deadly\t1\t1\t1\t5\t\t3\t\t\t\t9\t105\tdmg%\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Vicious\t1\t1\t1\t8\t\t6\t\t\t\t8\t105\tdmg%\t\t31\t40\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Brutal\t1\t1\t1\t14\t\t10\t\t\t\t8\t105\tdmg%\t\t41\t50\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Massive\t1\t1\t1\t20\t\t15\t\t\t\t7\t105\tdmg%\t\t51\t65\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Savage\t1\t1\t1\t26\t\t19\t\t\t\t7\t105\tdmg%\t\t66\t80\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Merciless\t1\t1\t1\t32\t\t24\t\t\t\t6\t105\tdmg%\t\t81\t100\t\t\t\t\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Ferocious\t100\t1\t1\t41\t\t33\t\t\t\t6\t105\tdmg%\t\t101\t200\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Cruel\t100\t1\t\t51\t\t43\t\t\t\t5\t105\tdmg%\t\t201\t300\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Cinnabar\t100\t1\t1\t1\t\t1\t\t\t\t4\t105\tdmg%\t\t5\t10\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rusty\t100\t1\t1\t13\t\t9\t\t\t\t4\t105\tdmg%\t\t11\t20\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Realgar\t100\t1\t1\t45\t\t37\t\t\t\t4\t105\tdmg%\t\t21\t30\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ruby\t100\t1\t\t66\t\t58\t\t\t\t4\t105\tdmg%\t\t31\t40\t\t\t\t\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Vulpine\t1\t1\t1\t9\t\t6\t\t\t\t3\t107\tdmg-to-mana\t\t7\t12\t\t\t\t\t\t\t\t\tcblu\tshld\tamul\torb\tstaf\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Dun\t100\t1\t1\t7\t\t5\t\t\t\t3\t107\tdmg-to-mana\t\t7\t12\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tireless\t1\t1\t1\t6\t\t4\t\t\t\t4\t108\tregen-stam\t\t25\t25\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tireless\t100\t1\t1\t14\t\t10\t\t\t\t4\t108\tregen-stam\t\t50\t50\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Brown\t100\t1\t1\t39\t\t31\t\t\t\t4\t108\tregen-stam\t\t10\t15\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t100\t1\t1\t1\t\t1\t\t\t\t4\t109\tstam\t\t12\t24\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t100\t1\t1\t7\t\t5\t\t\t\t4\t109\tstam\t\t25\t36\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t100\t1\t1\t21\t\t15\t\t\t\t4\t109\tstam\t\t37\t50\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t100\t1\t1\t1\t\t\t\t\t\t4\t109\tstam\t\t8\t16\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t\t\n",
+                u8"Rugged\t100\t1\t1\t7\t\t5\t\t\t\t4\t109\tstam\t\t17\t25\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t100\t1\t1\t21\t\t15\t\t\t\t4\t109\tstam\t\t26\t32\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t100\t1\t1\t1\t\t\t\t\t\t4\t109\tstam\t\t4\t8\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t\t\n",
+                u8"Rugged\t100\t1\t1\t21\t\t15\t\t\t\t4\t109\tstam\t\t9\t16\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t1\t1\t1\t1\t\t1\t\t\t\t4\t109\tstam\t\t5\t10\t\t\t\t\t\t\t\t\t\tboot\tglov\tbelt\tring\tamul\tcirc\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t1\t1\t1\t8\t\t6\t\t\t\t4\t109\tstam\t\t11\t20\t\t\t\t\t\t\t\t\t\tboot\tbelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Rugged\t1\t1\t1\t8\t\t6\t\t\t\t4\t109\tstam\t\t11\t20\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Vigorous\t100\t1\t1\t16\t\t12\t\t\t\t4\t109\tstam\t\t21\t30\t\t\t\t\t\t\t\t\t\tboot\tbelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Chestnut\t100\t1\t1\t1\t\t1\t\t\t\t4\t109\tstam\t\t10\t15\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Maroon\t100\t1\t1\t17\t\t12\t\t\t\t4\t109\tstam\t\t16\t25\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t100\t1\t1\t1\t\t1\t\t\t\t4\t110\tatt\t\t6\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t100\t1\t1\t7\t\t5\t\t\t\t4\t110\tatt\t\t13\t27\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t100\t1\t1\t13\t\t9\t\t\t\t4\t110\tatt\t\t28\t42\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Iron\t100\t1\t1\t19\t\t14\t\t\t\t4\t110\tatt\t\t43\t57\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Iron\t100\t1\t1\t25\t\t18\t\t\t\t4\t110\tatt\t\t58\t72\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Iron\t100\t1\t1\t31\t\t23\t\t\t\t4\t110\tatt\t\t73\t87\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Steel\t100\t1\t\t37\t\t29\t\t\t\t4\t110\tatt\t\t88\t102\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Steel\t100\t1\t\t43\t\t35\t\t\t\t4\t110\tatt\t\t103\t117\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Steel\t100\t1\t\t49\t\t41\t\t\t\t4\t110\tatt\t\t118\t132\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t100\t1\t1\t1\t\t1\t\t\t\t4\t110\tatt\t\t4\t8\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t100\t1\t1\t7\t\t5\t\t\t\t4\t110\tatt\t\t6\t12\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t100\t1\t1\t16\t\t12\t\t\t\t4\t110\tatt\t\t13\t25\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Iron\t100\t1\t1\t25\t\t18\t\t\t\t4\t110\tatt\t\t26\t38\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Iron\t100\t1\t1\t34\t\t26\t\t\t\t4\t110\tatt\t\t39\t51\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Steel\t100\t1\t\t43\t\t36\t\t\t\t4\t110\tatt\t\t52\t64\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Steel\t100\t1\t\t52\t\t44\t\t\t\t4\t110\tatt\t\t65\t77\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t100\t1\t1\t1\t\t1\t\t\t\t4\t110\tatt\t\t2\t4\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t100\t1\t1\t21\t\t15\t\t\t\t4\t110\tatt\t\t6\t12\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Iron\t100\t1\t1\t39\t\t31\t\t\t\t4\t110\tatt\t\t13\t24\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Steel\t100\t1\t\t57\t\t49\t\t\t\t4\t110\tatt\t\t25\t36\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bronze\t1\t1\t1\t1\t\t1\t\t\t\t8\t110\tatt\t\t10\t20\t\t\t\t\t\t\t\t\t\tweap\tring\tglov\tamul\tcirc\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Iron\t1\t1\t1\t4\t\t3\t\t\t\t8\t110\tatt\t\t21\t40\t\t\t\t\t\t\t\t\t\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Steel\t1\t1\t1\t8\t\t6\t\t\t\t7\t110\tatt\t\t41\t60\t\t\t\t\t\t\t\t\t\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Silver\t1\t1\t1\t12\t\t9\t\t\t\t7\t110\tatt\t\t61\t80\t\t\t\t\t\t\t\t\t\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Gold\t1\t1\t1\t17\t\t12\t\t\t\t6\t110\tatt\t\t81\t100\t\t\t\t\t\t\t\t\tlgld\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Platinum\t1\t1\t1\t22\t\t16\t\t\t\t6\t110\tatt\t\t101\t120\t\t\t\t\t\t\t\t\tlgld\tweap\tring\tcirc\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Meteoric\t1\t1\t1\t27\t\t20\t\t\t\t5\t110\tatt\t\t121\t150\t\t\t\t\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Strange\t100\t1\t1\t32\t\t24\t\t\t\t5\t110\tatt\t\t151\t300\t\t\t\t\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Weird\t100\t1\t\t37\t\t27\t\t\t\t4\t110\tatt\t\t301\t450\t\t\t\t\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Nickel\t100\t1\t1\t1\t\t1\t\t\t\t4\t110\tatt\t\t10\t20\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tin\t100\t1\t1\t8\t\t6\t\t\t\t4\t110\tatt\t\t21\t40\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Silver\t100\t1\t1\t25\t\t18\t\t\t\t4\t110\tatt\t\t41\t60\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Argent\t100\t1\t\t44\t\t36\t\t\t\t4\t110\tatt\t\t61\t100\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fine\t100\t1\t1\t15\t\t11\t\t\t\t4\t111\tatt\t\t10\t20\tdmg-max\t\t1\t3\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fine\t100\t1\t1\t22\t\t16\t\t\t\t4\t111\tatt\t\t21\t48\tdmg-max\t\t4\t6\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sharp\t100\t1\t1\t29\t\t21\t\t\t\t4\t111\tatt\t\t49\t76\tdmg-max\t\t7\t10\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fine\t100\t1\t1\t19\t\t14\t\t\t\t4\t111\tatt\t\t10\t20\tdmg-max\t\t1\t3\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sharp\t100\t1\t1\t28\t\t21\t\t\t\t4\t111\tatt\t\t21\t48\tdmg-max\t\t4\t6\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fine\t100\t1\t\t28\t\t21\t\t\t\t4\t111\tatt\t\t10\t20\tdmg-max\t\t1\t3\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sharp\t1\t1\t1\t5\t\t3\t\t\t\t9\t111\tatt\t\t10\t20\tdmg%\t\t10\t20\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Fine\t1\t1\t1\t12\t\t9\t\t\t\t9\t111\tatt\t\t21\t40\tdmg%\t\t21\t30\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Warrior's\t1\t1\t1\t19\t\t13\t\t\t\t8\t111\tatt\t\t41\t60\tdmg%\t\t31\t40\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Soldier's\t1\t1\t1\t27\t\t19\t\t\t\t8\t111\tatt\t\t61\t80\tdmg%\t\t41\t50\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Knight's\t1\t1\t1\t38\t\t30\t\t\t\t7\t111\tatt\t\t81\t100\tdmg%\t\t51\t65\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Lord's\t1\t1\t1\t47\t\t39\t\t\t\t6\t111\tatt\t\t101\t120\tdmg%\t\t66\t80\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"King's\t1\t1\t1\t56\t\t48\t\t\t\t5\t111\tatt\t\t121\t150\tdmg%\t\t81\t100\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Master's\t100\t1\t1\t56\t\t48\t\t\t\t5\t111\tatt\t\t151\t250\tdmg%\t\t101\t150\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Grandmaster's\t100\t1\t\t69\t\t61\t\t\t\t4\t111\tatt\t\t251\t300\tdmg%\t\t151\t200\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Glimmering\t1\t1\t1\t1\t\t1\t\t\t\t1\t112\tlight\t\t1\t1\t\t\t\t\t\t\t\t\t\tarmo\twand\tstaf\tring\tamul\torb\t\t\t\t\t\t\t0\t0\n",
+                u8"Glowing\t1\t1\t1\t6\t\t4\t\t\t\t1\t112\tlight\t\t2\t2\t\t\t\t\t\t\t\t\tlyel\tarmo\twand\tstaf\tring\tamul\torb\t\t\t\t\t\t\t0\t0\n",
+                u8"Bright\t100\t1\t1\t1\t\t1\t\t\t\t1\t112\tlight\t\t1\t1\tatt\t\t10\t10\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Screaming\t100\t1\t1\t10\t\t7\t\t\t\t3\t113\thowl\t\t32\t32\t\t\t\t\t\t\t\t\toran\tweap\t\t\t\t\t\t\tmiss\tswor\taxe\tpole\tspea\t0\t0\n",
+                u8"Howling\t1\t1\t1\t16\t\t12\t\t\t\t3\t113\thowl\t\t64\t64\t\t\t\t\t\t\t\t\toran\tweap\t\t\t\t\t\t\tmiss\tswor\taxe\tpole\tspea\t0\t0\n",
+                u8"Wailing\t100\t1\t1\t20\t\t13\t\t\t\t3\t113\thowl\t\t128\t128\t\t\t\t\t\t\t\t\toran\tweap\t\t\t\t\t\t\tmiss\tswor\taxe\tpole\tspea\t0\t0\n",
+                u8"Screaming\t100\t1\t1\t10\t\t7\t\t\t\t4\t113\thowl\t\t16\t16\t\t\t\t\t\t\t\t\toran\tmiss\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Howling\t100\t1\t1\t16\t\t12\t\t\t\t4\t113\thowl\t\t24\t24\t\t\t\t\t\t\t\t\toran\tmiss\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Wailing\t100\t1\t\t24\t\t18\t\t\t\t4\t113\thowl\t\t32\t32\t\t\t\t\t\t\t\t\toran\tmiss\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lucky\t100\t1\t1\t21\t\t\t\t\t\t4\t114\tmag%\t\t1\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lucky\t100\t1\t\t38\t\t\t\t\t\t4\t114\tmag%\t\t5\t7\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lucky\t100\t1\t\t55\t\t\t\t\t\t4\t114\tmag%\t\t8\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lucky\t100\t1\t1\t34\t\t\t\t\t\t4\t114\tmag%\t\t1\t1\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lucky\t100\t1\t\t53\t\t\t\t\t\t4\t114\tmag%\t\t2\t3\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lucky\t100\t1\t\t51\t\t\t\t\t\t4\t114\tmag%\t\t4\t6\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Felicitous\t100\t1\t1\t5\t\t3\t\t\t\t4\t114\tmag%\t\t5\t10\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fortuitous\t1\t1\t\t12\t\t8\t\t\t\t4\t114\tmag%\t\t11\t15\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Emerald\t100\t1\t1\t16\t\t12\t\t\t\t4\t114\tmag%\t\t3\t7\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t100\t1\t1\t1\t\t1\t\t\t\t4\t115\tmana\t\t3\t7\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t100\t1\t1\t7\t\t5\t\t\t\t4\t115\tmana\t\t8\t13\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t100\t1\t1\t13\t\t9\t\t\t\t4\t115\tmana\t\t14\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snake's\t100\t1\t1\t19\t\t14\t\t\t\t4\t115\tmana\t\t21\t26\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snake's\t100\t1\t1\t25\t\t18\t\t\t\t4\t115\tmana\t\t27\t33\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snake's\t100\t1\t1\t31\t\t23\t\t\t\t4\t115\tmana\t\t34\t39\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t100\t1\t1\t37\t\t29\t\t\t\t4\t115\tmana\t\t40\t46\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t100\t1\t1\t43\t\t35\t\t\t\t4\t115\tmana\t\t47\t52\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t100\t1\t1\t49\t\t41\t\t\t\t4\t115\tmana\t\t53\t59\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t100\t1\t1\t1\t\t1\t\t\t\t4\t115\tmana\t\t2\t4\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t100\t1\t1\t9\t\t6\t\t\t\t4\t115\tmana\t\t5\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t100\t1\t1\t17\t\t12\t\t\t\t4\t115\tmana\t\t8\t12\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snake's\t100\t1\t1\t25\t\t18\t\t\t\t4\t115\tmana\t\t13\t18\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snake's\t100\t1\t1\t33\t\t25\t\t\t\t4\t115\tmana\t\t19\t23\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t100\t1\t1\t41\t\t33\t\t\t\t4\t115\tmana\t\t24\t29\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t100\t1\t1\t49\t\t41\t\t\t\t4\t115\tmana\t\t30\t34\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t100\t1\t1\t16\t\t12\t\t\t\t4\t115\tmana\t\t1\t2\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t100\t1\t1\t16\t\t12\t\t\t\t4\t115\tmana\t\t3\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snake's\t100\t1\t1\t32\t\t24\t\t\t\t4\t115\tmana\t\t8\t12\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t100\t1\t\t48\t\t40\t\t\t\t4\t115\tmana\t\t13\t17\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t1\t1\t1\t3\t\t2\t\t\t\t4\t115\tmana\t\t3\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\torb\t\t\tboot\tglov\t\t\t\t0\t0\n",
+                u8"Snake's\t1\t1\t1\t6\t\t4\t\t\t\t4\t115\tmana\t\t5\t10\t\t\t\t\t\t\t\t\t\tshld\trod\tbelt\tring\tamul\tcirc\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t1\t1\t1\t14\t\t10\t\t\t\t3\t115\tmana\t\t11\t20\t\t\t\t\t\t\t\t\t\tshld\trod\tbelt\tring\tamul\tcirc\t\t\t\t\t\t\t0\t0\n",
+                u8"Serpent's\t1\t1\t1\t37\t\t27\t\t\t\t2\t115\tmana\t\t11\t20\t\t\t\t\t\t\t\t\t\ttors\tboot\tglov\tweap\torb\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"Drake's\t1\t1\t1\t20\t\t15\t\t\t\t2\t115\tmana\t\t21\t30\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Dragon's\t1\t1\t1\t24\t\t18\t\t\t\t2\t115\tmana\t\t31\t40\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Dragon's\t1\t1\t1\t52\t\t39\t\t\t\t2\t115\tmana\t\t31\t40\t\t\t\t\t\t\t\t\tcblu\ttors\tboot\tglov\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Wyrm's\t1\t1\t1\t30\t\t22\t\t\t\t2\t115\tmana\t\t41\t60\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Great Wyrm's\t100\t1\t1\t37\t\t29\t\t\t\t2\t115\tmana\t\t61\t90\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bahamut's\t100\t1\t\t45\t\t37\t\t\t\t2\t115\tmana\t\t91\t120\t\t\t\t\t\t\t\t\tcblu\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Zircon\t100\t1\t1\t3\t\t2\t\t\t\t2\t115\tmana\t\t5\t10\t\t\t\t\t\t\t\t\tcblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jacinth\t100\t1\t1\t17\t\t12\t\t\t\t2\t115\tmana\t\t11\t15\t\t\t\t\t\t\t\t\tcblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Turquoise\t100\t1\t\t29\t\t21\t\t\t\t2\t115\tmana\t\t16\t20\t\t\t\t\t\t\t\t\tcblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t\t\n",
+                u8"Shimmering\t100\t1\t\t8\t13\t6\t\t\t\t1\t116\tres-all\t\t3\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t500\n",
+                u8"Shimmering\t100\t1\t\t14\t34\t10\t\t\t\t1\t116\tres-all\t\t8\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t1500\n",
+                u8"Shimmering\t100\t1\t\t35\t\t27\t\t\t\t1\t116\tres-all\t\t13\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t5000\n",
+                u8"Shimmering\t100\t1\t\t17\t33\t12\t\t\t\t1\t116\tres-all\t\t3\t5\t\t\t\t\t\t\t\t\tlpur\tmcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t1500\n",
+                u8"Shimmering\t100\t1\t\t34\t\t26\t\t\t\t1\t116\tres-all\t\t6\t8\t\t\t\t\t\t\t\t\tlpur\tmcha\t\t\t\t\t\t\t\t\t\t\t\t1280\t5000\n",
+                u8"Shimmering\t100\t1\t\t33\t\t25\t\t\t\t1\t116\tres-all\t\t3\t5\t\t\t\t\t\t\t\t\tlpur\tscha\t\t\t\t\t\t\t\t\t\t\t\t1280\t10000\n",
+                u8"Shimmering\t100\t1\t1\t6\t\t4\t\t\t\t5\t116\tres-all\t\t3\t7\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t500\n",
+                u8"Rainbow\t100\t1\t1\t18\t\t13\t\t\t\t5\t116\tres-all\t\t8\t11\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t2000\n",
+                u8"Scintillating\t100\t1\t1\t28\t\t21\t\t\t\t5\t116\tres-all\t\t12\t15\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t4000\n",
+                u8"Prismatic\t1\t1\t1\t39\t\t31\t\t\t\t4\t116\tres-all\t\t16\t20\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t8000\n",
+                u8"Chromatic\t100\t1\t\t50\t\t42\t\t\t\t4\t116\tres-all\t\t21\t30\t\t\t\t\t\t\t\t\tlpur\tshld\t\t\t\t\t\t\t\t\t\t\t\t1280\t16000\n",
+                u8"Shimmering\t100\t1\t1\t8\t\t6\t\t\t\t5\t116\tres-all\t\t3\t7\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t3000\n",
+                u8"Rainbow\t100\t1\t1\t21\t\t15\t\t\t\t5\t116\tres-all\t\t8\t11\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t6000\n",
+                u8"Scintillating\t100\t1\t1\t34\t\t25\t\t\t\t5\t116\tres-all\t\t12\t15\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t12000\n",
+                u8"Prismatic\t1\t1\t1\t42\t\t31\t\t\t\t4\t116\tres-all\t\t16\t20\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t24000\n",
+                u8"Chromatic\t100\t1\t\t55\t\t41\t\t\t\t3\t116\tres-all\t\t21\t30\t\t\t\t\t\t\t\t\tlpur\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t1280\t32000\n",
+                u8"Shimmering\t100\t1\t1\t45\t\t37\t\t\t\t3\t116\tres-all\t\t3\t7\t\t\t\t\t\t\t\t\tlpur\tring\t\t\t\t\t\t\t\t\t\t\t\t1280\t4000\n",
+                u8"Rainbow\t100\t1\t1\t56\t\t48\t\t\t\t2\t116\tres-all\t\t8\t11\t\t\t\t\t\t\t\t\tlpur\tring\t\t\t\t\t\t\t\t\t\t\t\t1280\t8000\n",
+                u8"Scintillating\t100\t1\t\t67\t\t59\t\t\t\t2\t116\tres-all\t\t12\t15\t\t\t\t\t\t\t\t\tlpur\tring\t\t\t\t\t\t\t\t\t\t\t\t1280\t16000\n",
+                u8"Shimmering\t100\t1\t1\t16\t\t12\t\t\t\t1\t116\tres-all\t\t5\t10\t\t\t\t\t\t\t\t\tlpur\tjewl\t\t\t\t\t\t\t\t\t\t\t\t1280\t3000\n",
+                u8"Scintillating\t100\t1\t\t34\t\t26\t\t\t\t1\t116\tres-all\t\t11\t15\t\t\t\t\t\t\t\t\tlpur\tjewl\t\t\t\t\t\t\t\t\t\t\t\t1280\t8000\n",
+                u8"Azure\t100\t1\t1\t1\t\t1\t\t\t\t2\t117\tres-cold\t\t7\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lapis\t100\t1\t1\t10\t\t7\t\t\t\t2\t117\tres-cold\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Cobalt\t100\t1\t1\t20\t\t15\t\t\t\t2\t117\tres-cold\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sapphire\t100\t1\t\t30\t\t22\t\t\t\t2\t117\tres-cold\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Azure\t100\t1\t1\t1\t\t1\t\t\t\t2\t117\tres-cold\t\t4\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lapis\t100\t1\t1\t16\t\t12\t\t\t\t2\t117\tres-cold\t\t8\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Cobalt\t100\t1\t1\t25\t\t18\t\t\t\t2\t117\tres-cold\t\t11\t12\t\t\t\t\t\t\t\t\tlblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sapphire\t100\t1\t\t35\t\t27\t\t\t\t2\t117\tres-cold\t\t13\t15\t\t\t\t\t\t\t\t\tlblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Azure\t100\t1\t1\t1\t\t1\t\t\t\t2\t117\tres-cold\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lapis\t100\t1\t1\t14\t\t10\t\t\t\t2\t117\tres-cold\t\t6\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Cobalt\t100\t1\t1\t27\t\t20\t\t\t\t2\t117\tres-cold\t\t8\t9\t\t\t\t\t\t\t\t\tlblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sapphire\t100\t1\t\t40\t\t32\t\t\t\t2\t117\tres-cold\t\t10\t11\t\t\t\t\t\t\t\t\tlblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Azure\t1\t1\t1\t5\t\t3\t\t\t\t2\t117\tres-cold\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tweap\tring\tamul\torb\tcirc\t\t\t\t\t\t\t0\t0\n",
+                u8"Lapis\t1\t1\t1\t12\t\t9\t\t\t\t4\t117\tres-cold\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lapis\t1\t1\t1\t35\t\t26\t\t\t\t2\t117\tres-cold\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"Cobalt\t1\t1\t1\t18\t\t13\t\t\t\t3\t117\tres-cold\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Cobalt\t1\t1\t1\t55\t\t41\t\t\t\t2\t117\tres-cold\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"Sapphire\t1\t1\t1\t25\t\t18\t\t\t\t3\t117\tres-cold\t\t31\t40\t\t\t\t\t\t\t\t\tlblu\trod\tboot\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lapis Lazuli\t100\t1\t1\t2\t\t1\t\t\t\t4\t117\tres-cold\t\t5\t15\t\t\t\t\t\t\t\t\tlblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sapphire\t100\t1\t1\t19\t\t14\t\t\t\t4\t117\tres-cold\t\t16\t30\t\t\t\t\t\t\t\t\tlblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Crimson\t100\t1\t1\t1\t\t1\t\t\t\t2\t118\tres-fire\t\t7\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Russet\t100\t1\t1\t10\t\t7\t\t\t\t2\t118\tres-fire\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Garnet\t100\t1\t1\t20\t\t15\t\t\t\t2\t118\tres-fire\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ruby\t100\t1\t\t30\t\t22\t\t\t\t2\t118\tres-fire\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Crimson\t100\t1\t1\t1\t\t1\t\t\t\t2\t118\tres-fire\t\t4\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Russet\t100\t1\t1\t16\t\t12\t\t\t\t2\t118\tres-fire\t\t8\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Garnet\t100\t1\t1\t25\t\t18\t\t\t\t2\t118\tres-fire\t\t11\t12\t\t\t\t\t\t\t\t\tlred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ruby\t100\t1\t\t35\t\t27\t\t\t\t2\t118\tres-fire\t\t13\t15\t\t\t\t\t\t\t\t\tlred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Crimson\t100\t1\t1\t1\t\t1\t\t\t\t2\t118\tres-fire\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Russet\t100\t1\t1\t14\t\t10\t\t\t\t2\t118\tres-fire\t\t6\t7\t\t\t\t\t\t\t\t\tlred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Garnet\t100\t1\t\t27\t\t20\t\t\t\t2\t118\tres-fire\t\t8\t9\t\t\t\t\t\t\t\t\tlred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ruby\t100\t1\t1\t40\t\t32\t\t\t\t2\t118\tres-fire\t\t10\t11\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Russet\t1\t1\t1\t12\t\t9\t\t\t\t4\t118\tres-fire\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Russet\t1\t1\t1\t35\t\t26\t\t\t\t1\t118\tres-fire\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"Garnet\t1\t1\t1\t18\t\t13\t\t\t\t3\t118\tres-fire\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Garnet\t1\t1\t1\t55\t\t41\t\t\t\t1\t118\tres-fire\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"Ruby\t1\t1\t1\t25\t\t18\t\t\t\t3\t118\tres-fire\t\t31\t40\t\t\t\t\t\t\t\t\tlred\trod\tboot\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Garnet\t100\t1\t1\t2\t\t1\t\t\t\t4\t117\tres-fire\t\t5\t15\t\t\t\t\t\t\t\t\tlred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ruby\t100\t1\t1\t18\t\t13\t\t\t\t4\t117\tres-fire\t\t16\t30\t\t\t\t\t\t\t\t\tlred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tangerine\t100\t1\t1\t1\t\t1\t\t\t\t2\t119\tres-ltng\t\t7\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ocher\t100\t1\t1\t10\t\t7\t\t\t\t2\t119\tres-ltng\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Coral\t100\t1\t1\t20\t\t15\t\t\t\t2\t119\tres-ltng\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Amber\t100\t1\t\t30\t\t22\t\t\t\t2\t119\tres-ltng\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tangerine\t100\t1\t1\t1\t\t1\t\t\t\t2\t119\tres-ltng\t\t4\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ocher\t100\t1\t1\t16\t\t12\t\t\t\t2\t119\tres-ltng\t\t8\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Coral\t100\t1\t1\t25\t\t18\t\t\t\t2\t119\tres-ltng\t\t11\t12\t\t\t\t\t\t\t\t\tlyel\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Amber\t100\t1\t\t35\t\t27\t\t\t\t2\t119\tres-ltng\t\t13\t15\t\t\t\t\t\t\t\t\tlyel\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tangerine\t100\t1\t1\t1\t\t1\t\t\t\t2\t119\tres-ltng\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ocher\t100\t1\t1\t14\t\t10\t\t\t\t2\t119\tres-ltng\t\t6\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Coral\t100\t1\t1\t27\t\t20\t\t\t\t2\t119\tres-ltng\t\t8\t9\t\t\t\t\t\t\t\t\tlyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Amber\t100\t1\t\t40\t\t32\t\t\t\t2\t119\tres-ltng\t\t10\t11\t\t\t\t\t\t\t\t\tlyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tangerine\t1\t1\t1\t5\t\t3\t\t\t\t4\t119\tres-ltng\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tweap\tring\tamul\torb\tcirc\t\t\t\t\t\t\t0\t0\n",
+                u8"Ocher\t1\t1\t1\t12\t\t9\t\t\t\t4\t119\tres-ltng\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ocher\t1\t1\t1\t35\t\t26\t\t\t\t1\t119\tres-ltng\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"Coral\t1\t1\t1\t18\t\t13\t\t\t\t3\t119\tres-ltng\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Coral\t1\t1\t1\t55\t\t41\t\t\t\t1\t119\tres-ltng\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"Amber\t1\t1\t1\t25\t\t18\t\t\t\t3\t119\tres-ltng\t\t31\t40\t\t\t\t\t\t\t\t\tlyel\trod\tboot\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Camphor\t100\t1\t1\t2\t\t1\t\t\t\t4\t117\tres-ltng\t\t5\t15\t\t\t\t\t\t\t\t\tlyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ambergris\t100\t1\t1\t19\t\t14\t\t\t\t4\t117\tres-ltng\t\t16\t30\t\t\t\t\t\t\t\t\tlyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Beryl\t100\t1\t1\t1\t\t1\t\t\t\t2\t120\tres-pois\t\t7\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Viridian\t100\t1\t1\t10\t\t7\t\t\t\t2\t120\tres-pois\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jade\t100\t1\t1\t20\t\t15\t\t\t\t2\t120\tres-pois\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Emerald\t100\t1\t\t30\t\t22\t\t\t\t2\t120\tres-pois\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Beryl\t100\t1\t1\t1\t\t1\t\t\t\t2\t120\tres-pois\t\t4\t7\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Viridian\t100\t1\t1\t16\t\t12\t\t\t\t2\t120\tres-pois\t\t8\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jade\t100\t1\t1\t25\t\t18\t\t\t\t2\t120\tres-pois\t\t11\t12\t\t\t\t\t\t\t\t\tcgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Emerald\t100\t1\t\t35\t\t27\t\t\t\t2\t120\tres-pois\t\t13\t15\t\t\t\t\t\t\t\t\tcgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Beryl\t100\t1\t1\t1\t\t1\t\t\t\t2\t120\tres-pois\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Viridian\t100\t1\t1\t14\t\t10\t\t\t\t2\t120\tres-pois\t\t6\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jade\t100\t1\t1\t27\t\t20\t\t\t\t2\t120\tres-pois\t\t8\t9\t\t\t\t\t\t\t\t\tcgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Emerald\t100\t1\t\t40\t\t32\t\t\t\t2\t120\tres-pois\t\t10\t11\t\t\t\t\t\t\t\t\tcgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Beryl\t1\t1\t1\t5\t\t3\t\t\t\t4\t120\tres-pois\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tweap\tring\tamul\torb\tcirc\t\t\t\t\t\t\t0\t0\n",
+                u8"Viridian\t1\t1\t1\t12\t\t9\t\t\t\t4\t120\tres-pois\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Viridian\t1\t1\t1\t35\t\t26\t\t\t\t1\t120\tres-pois\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"Jade\t1\t1\t1\t18\t\t13\t\t\t\t3\t120\tres-pois\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jade\t1\t1\t1\t55\t\t41\t\t\t\t1\t120\tres-pois\t\t21\t30\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"Emerald\t1\t1\t1\t25\t\t18\t\t\t\t3\t120\tres-pois\t\t31\t40\t\t\t\t\t\t\t\t\tcgrn\trod\tboot\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Beryl\t100\t1\t1\t2\t\t1\t\t\t\t4\t117\tres-pois\t\t5\t15\t\t\t\t\t\t\t\t\tcgrn\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jade\t100\t1\t1\t19\t\t14\t\t\t\t4\t117\tres-pois\t\t16\t30\t\t\t\t\t\t\t\t\tcgrn\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Triumphant\t1\t1\t1\t3\t\t2\t\t\t\t4\t121\tmana-kill\t\t1\t1\t\t\t\t\t\t\t\t\t\tweap\tring\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Victorious\t100\t1\t1\t17\t\t12\t\t\t\t4\t121\tmana-kill\t\t2\t5\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Aureolin\t100\t1\t1\t22\t\t16\t\t\t\t4\t121\tmana-kill\t\t1\t3\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Mechanist's\t100\t1\t1\t10\t\t7\t\t\t\t3\t122\tsock\t\t1\t2\t\t\t\t\t\t\t\t\t\tweap\tshld\thelm\ttors\tcirc\t\t\tthro\t\t\t\t\t0\t0\n",
+                u8"Artificer's\t100\t1\t\t33\t\t25\t\t\t\t2\t122\tsock\t3\t\t\t\t\t\t\t\t\t\t\t\tweap\tshld\thelm\ttors\t\t\t\tthro\t\t\t\t\t0\t0\n",
+                u8"Jeweler's\t100\t1\t\t55\t\t47\t\t\t\t1\t122\tsock\t4\t\t\t\t\t\t\t\t\t\t\t\tweap\tshld\thelm\ttors\t\t\t\tthro\t\t\t\t\t0\t0\n",
+                u8"Assamic\t100\t1\t1\t3\t\t1\t\t\t\t2\t123\tatt-demon\t\t25\t50\tdmg-demon\t\t10\t25\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Arcadian\t100\t1\t1\t15\t\t11\t\t\t\t2\t123\tatt-demon\t\t51\t100\tdmg-demon\t\t26\t50\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Unearthly\t100\t1\t1\t25\t\t18\t\t\t\t1\t123\tatt-demon\t\t101\t150\tdmg-demon\t\t51\t100\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Astral\t100\t1\t1\t35\t\t26\t\t\t\t1\t123\tatt-demon\t\t151\t200\tdmg-demon\t\t101\t150\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Elysian\t100\t1\t1\t45\t\t33\t\t\t\t1\t123\tatt-demon\t\t201\t300\tdmg-demon\t\t151\t200\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Celestial\t100\t1\t\t55\t\t41\t\t\t\t1\t123\tatt-demon\t\t301\t400\tdmg-demon\t\t201\t300\t\t\t\t\tdgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Diamond\t100\t1\t1\t26\t\t19\t\t\t\t1\t123\tatt-demon\t\t25\t50\tdmg-demon\t\t25\t40\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fletcher's\t100\t1\t\t50\t\t42\tama\t\t\t1\t125\tskilltab\t0\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Acrobat's\t100\t1\t\t50\t\t42\tama\t\t\t1\t125\tskilltab\t1\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Harpoonist's\t100\t1\t\t50\t\t42\tama\t\t\t1\t125\tskilltab\t2\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fletcher's\t100\t1\t1\t20\t\t15\tama\t\t\t1\t125\tskilltab\t0\t1\t1\t\t\t\t\t\t\t\t\t\tmiss\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bowyer's\t100\t1\t1\t40\t\t30\tama\t\t\t1\t125\tskilltab\t0\t2\t2\t\t\t\t\t\t\t\t\tlgld\tmiss\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Archer's\t100\t1\t\t60\t\t45\tama\t\t\t1\t125\tskilltab\t0\t3\t3\t\t\t\t\t\t\t\t\tlgld\tmiss\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Acrobat's\t100\t1\t1\t20\t\t15\tama\t\t\t1\t125\tskilltab\t1\t1\t1\t\t\t\t\t\t\t\t\t\tglov\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Gymnast's\t100\t1\t1\t40\t\t30\tama\t\t\t1\t125\tskilltab\t1\t2\t2\t\t\t\t\t\t\t\t\tlgld\tglov\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Athlete's\t100\t1\t\t60\t\t45\tama\t\t\t1\t125\tskilltab\t1\t3\t3\t\t\t\t\t\t\t\t\tlgld\tglov\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Harpoonist's\t100\t1\t1\t20\t\t15\tama\t\t\t1\t125\tskilltab\t2\t1\t1\t\t\t\t\t\t\t\t\t\tspea\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Spearmaiden's\t100\t1\t1\t40\t\t30\tama\t\t\t1\t125\tskilltab\t2\t2\t2\t\t\t\t\t\t\t\t\tlgld\tspea\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lancer's\t100\t1\t\t60\t\t45\tama\t\t\t1\t125\tskilltab\t2\t3\t3\t\t\t\t\t\t\t\t\tlgld\tspea\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Burning\t100\t1\t1\t50\t\t42\tsor\t\t\t1\t125\tskilltab\t3\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sparking\t100\t1\t1\t50\t\t42\tsor\t\t\t1\t125\tskilltab\t4\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Chilling\t100\t1\t1\t50\t\t42\tsor\t\t\t1\t125\tskilltab\t5\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Burning\t100\t1\t1\t20\t\t15\tsor\t\t\t1\t125\tskilltab\t3\t1\t1\t\t\t\t\t\t\t\t\t\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Blazing\t100\t1\t1\t40\t\t30\tsor\t\t\t1\t125\tskilltab\t3\t2\t2\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Volcanic\t100\t1\t\t60\t\t45\tsor\t\t\t1\t125\tskilltab\t3\t3\t3\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sparking\t100\t1\t1\t20\t\t15\tsor\t\t\t1\t125\tskilltab\t4\t1\t1\t\t\t\t\t\t\t\t\t\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Charged\t100\t1\t1\t40\t\t30\tsor\t\t\t1\t125\tskilltab\t4\t2\t2\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Powered\t100\t1\t\t60\t\t45\tsor\t\t\t1\t125\tskilltab\t4\t3\t3\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Chilling\t100\t1\t1\t20\t\t15\tsor\t\t\t1\t125\tskilltab\t5\t1\t1\t\t\t\t\t\t\t\t\t\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Freezing\t100\t1\t1\t40\t\t30\tsor\t\t\t1\t125\tskilltab\t5\t2\t2\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Glacial\t100\t1\t\t60\t\t45\tsor\t\t\t1\t125\tskilltab\t5\t3\t3\t\t\t\t\t\t\t\t\tlgld\tstaff\torb\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Hexing\t100\t1\t1\t50\t\t42\tnec\t\t\t1\t125\tskilltab\t6\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fungal\t100\t1\t1\t50\t\t42\tnec\t\t\t1\t125\tskilltab\t7\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Graverobber's\t100\t1\t1\t50\t\t42\tnec\t\t\t1\t125\tskilltab\t8\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Hexing\t100\t1\t1\t20\t\t15\tnec\t\t\t1\t125\tskilltab\t6\t1\t1\t\t\t\t\t\t\t\t\t\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Blighting\t100\t1\t1\t40\t\t30\tnec\t\t\t1\t125\tskilltab\t6\t2\t2\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Accursed\t100\t1\t\t60\t\t45\tnec\t\t\t1\t125\tskilltab\t6\t3\t3\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fungal\t100\t1\t1\t20\t\t15\tnec\t\t\t1\t125\tskilltab\t7\t1\t1\t\t\t\t\t\t\t\t\t\twand\thead\tamul\tknif\tcirc\t\t\ttkni\t\t\t\t\t0\t0\n",
+                u8"Noxious\t100\t1\t1\t40\t\t30\tnec\t\t\t1\t125\tskilltab\t7\t2\t2\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tknif\tcirc\t\t\ttkni\t\t\t\t\t0\t0\n",
+                u8"Venomous\t100\t1\t\t60\t\t45\tnec\t\t\t1\t125\tskilltab\t7\t3\t3\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tknif\tcirc\t\t\ttkni\t\t\t\t\t0\t0\n",
+                u8"Graverobber's\t100\t1\t1\t20\t\t15\tnec\t\t\t1\t125\tskilltab\t8\t1\t1\t\t\t\t\t\t\t\t\t\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Vodoun\t100\t1\t1\t40\t\t30\tnec\t\t\t1\t125\tskilltab\t8\t2\t2\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Golemlord's\t100\t1\t\t60\t\t45\tnec\t\t\t1\t125\tskilltab\t8\t3\t3\t\t\t\t\t\t\t\t\tlgld\twand\thead\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lion Branded\t100\t1\t1\t50\t\t42\tpal\t\t\t1\t125\tskilltab\t9\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Captain's\t100\t1\t1\t50\t\t42\tpal\t\t\t1\t125\tskilltab\t10\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Preserver's\t100\t1\t1\t50\t\t42\tpal\t\t\t1\t125\tskilltab\t11\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lion Branded\t100\t1\t1\t20\t\t15\tpal\t\t\t1\t125\tskilltab\t9\t1\t1\t\t\t\t\t\t\t\t\t\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n",
+                u8"Hawk Branded\t100\t1\t1\t40\t\t30\tpal\t\t\t1\t125\tskilltab\t9\t2\t2\t\t\t\t\t\t\t\t\tlgld\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n",
+                u8"Rose Branded\t100\t1\t\t60\t\t45\tpal\t\t\t1\t125\tskilltab\t9\t3\t3\t\t\t\t\t\t\t\t\tlgld\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n",
+                u8"Captain's\t100\t1\t1\t20\t\t15\tpal\t\t\t1\t125\tskilltab\t10\t1\t1\t\t\t\t\t\t\t\t\t\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n",
+                u8"Commander's\t100\t1\t1\t40\t\t30\tpal\t\t\t1\t125\tskilltab\t10\t2\t2\t\t\t\t\t\t\t\t\tlgld\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n",
+                u8"Marshal's\t100\t1\t\t60\t\t45\tpal\t\t\t1\t125\tskilltab\t10\t3\t3\t\t\t\t\t\t\t\t\tlgld\tscep\tswor\tmace\tshld\tashd\tamul\tcirc\t\t\t\t\t\t0\t0\n",
+                u8"Preserver's\t100\t1\t1\t20\t\t15\tpal\t\t\t1\t125\tskilltab\t11\t1\t1\t\t\t\t\t\t\t\t\t\tshld\tashd\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Warder's\t100\t1\t1\t40\t\t30\tpal\t\t\t1\t125\tskilltab\t11\t2\t2\t\t\t\t\t\t\t\t\tlgld\tshld\tashd\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Guardian's\t100\t1\t\t60\t\t45\tpal\t\t\t1\t125\tskilltab\t11\t3\t3\t\t\t\t\t\t\t\t\tlgld\tshld\tashd\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Expert's\t100\t1\t1\t50\t\t42\tbar\t\t\t1\t125\tskilltab\t12\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Fanatic\t100\t1\t1\t50\t\t42\tbar\t\t\t1\t125\tskilltab\t13\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sounding\t100\t1\t1\t50\t\t42\tbar\t\t\t1\t125\tskilltab\t14\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Expert's\t100\t1\t1\t20\t\t15\tbar\t\t\t1\t125\tskilltab\t12\t1\t1\t\t\t\t\t\t\t\t\t\tphlm\tweap\thelm\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"Veteran's\t100\t1\t1\t40\t\t30\tbar\t\t\t1\t125\tskilltab\t12\t2\t2\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\thelm\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"Master's\t100\t1\t\t60\t\t45\tbar\t\t\t1\t125\tskilltab\t12\t3\t3\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\thelm\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"Fanatic\t100\t1\t1\t20\t\t15\tbar\t\t\t1\t125\tskilltab\t13\t1\t1\t\t\t\t\t\t\t\t\t\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"Raging\t100\t1\t1\t40\t\t30\tbar\t\t\t1\t125\tskilltab\t13\t2\t2\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"Furious\t100\t1\t\t60\t\t45\tbar\t\t\t1\t125\tskilltab\t13\t3\t3\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"Sounding\t100\t1\t1\t20\t\t15\tbar\t\t\t1\t125\tskilltab\t14\t1\t1\t\t\t\t\t\t\t\t\t\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"Resonant\t100\t1\t1\t40\t\t30\tbar\t\t\t1\t125\tskilltab\t14\t2\t2\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"Echoing\t100\t1\t\t60\t\t45\tbar\t\t\t1\t125\tskilltab\t14\t3\t3\t\t\t\t\t\t\t\t\tlgld\tphlm\tweap\tamul\t\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"Trainer's\t100\t1\t1\t50\t\t42\tdru\t\t\t1\t125\tskilltab\t15\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Spiritual\t100\t1\t1\t50\t\t42\tdru\t\t\t1\t125\tskilltab\t16\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Nature's\t100\t1\t1\t50\t\t42\tdru\t\t\t1\t125\tskilltab\t17\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Trainer's\t100\t1\t1\t20\t\t15\tdru\t\t\t1\t125\tskilltab\t15\t1\t1\t\t\t\t\t\t\t\t\t\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Caretaker's\t100\t1\t1\t40\t\t30\tdru\t\t\t1\t125\tskilltab\t15\t2\t2\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Keeper's\t100\t1\t\t60\t\t45\tdru\t\t\t1\t125\tskilltab\t15\t3\t3\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Spiritual\t100\t1\t1\t20\t\t15\tdru\t\t\t1\t125\tskilltab\t16\t1\t1\t\t\t\t\t\t\t\t\t\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Feral\t100\t1\t1\t40\t\t30\tdru\t\t\t1\t125\tskilltab\t16\t2\t2\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Communal\t100\t1\t\t60\t\t45\tdru\t\t\t1\t125\tskilltab\t16\t3\t3\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Nature's\t100\t1\t1\t20\t\t15\tdru\t\t\t1\t125\tskilltab\t17\t1\t1\t\t\t\t\t\t\t\t\t\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Terra's\t100\t1\t1\t40\t\t30\tdru\t\t\t1\t125\tskilltab\t17\t2\t2\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Gaea's\t100\t1\t\t60\t\t45\tdru\t\t\t1\t125\tskilltab\t17\t3\t3\t\t\t\t\t\t\t\t\tlgld\tclub\tpelt\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Entrapping\t100\t1\t1\t50\t\t42\tass\t\t\t1\t125\tskilltab\t18\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Mentalist's\t100\t1\t1\t50\t\t42\tass\t\t\t1\t125\tskilltab\t19\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shogukusha's\t100\t1\t1\t50\t\t42\tass\t\t\t1\t125\tskilltab\t20\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Entrapping\t100\t1\t1\t20\t\t15\tass\t\t\t1\t125\tskilltab\t18\t1\t1\t\t\t\t\t\t\t\t\t\th2h\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Trickster's\t100\t1\t1\t40\t\t30\tass\t\t\t1\t125\tskilltab\t18\t2\t2\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Cunning\t100\t1\t\t60\t\t45\tass\t\t\t1\t125\tskilltab\t18\t3\t3\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Mentalist's\t100\t1\t1\t20\t\t15\tass\t\t\t1\t125\tskilltab\t19\t1\t1\t\t\t\t\t\t\t\t\t\th2h\tamul\thelm\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Psychic\t100\t1\t1\t40\t\t30\tass\t\t\t1\t125\tskilltab\t19\t2\t2\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\thelm\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shadow\t100\t1\t\t60\t\t45\tass\t\t\t1\t125\tskilltab\t19\t3\t3\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\thelm\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shogukusha's\t100\t1\t1\t20\t\t15\tass\t\t\t1\t125\tskilltab\t20\t1\t1\t\t\t\t\t\t\t\t\t\th2h\tamul\tglov\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sensei's\t100\t1\t1\t40\t\t30\tass\t\t\t1\t125\tskilltab\t20\t2\t2\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\tglov\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Kenshi's\t100\t1\t\t60\t\t45\tass\t\t\t1\t125\tskilltab\t20\t3\t3\t\t\t\t\t\t\t\t\tlgld\th2h\tamul\tglov\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Miocene\t100\t\t\t1\t\t1\t\t\t\t1\t101\tac/lvl\t6\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Miocene\t100\t\t1\t1\t\t1\t\t\t\t1\t101\tac/lvl\t1\t\t\t\t\t\t\t\t\t\t\twhit\tglov\tboot\tbelt\tshld\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Oligocene\t100\t\t1\t10\t\t7\t\t\t\t1\t101\tac/lvl\t9\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Oligocene\t100\t\t1\t10\t\t7\t\t\t\t1\t101\tac/lvl\t2\t\t\t\t\t\t\t\t\t\t\twhit\tglov\tboot\tbelt\tshld\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Eocene\t100\t\t1\t20\t\t15\t\t\t\t1\t101\tac/lvl\t18\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Eocene\t100\t\t1\t20\t\t15\t\t\t\t1\t101\tac/lvl\t3\t\t\t\t\t\t\t\t\t\t\twhit\tglov\tboot\tbelt\tshld\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Paleocene\t100\t1\t1\t30\t\t22\t\t\t\t4\t101\tac/lvl\t24\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Paleocene\t100\t1\t1\t30\t\t22\t\t\t\t3\t101\tac/lvl\t4\t\t\t\t\t\t\t\t\t\t\twhit\tglov\tboot\tbelt\tshld\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Knave's\t100\t\t\t1\t\t1\t\t\t\t1\t111\tdmg/lvl\t1\t\t\tatt/lvl\t10\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Jack's\t100\t\t1\t10\t\t7\t\t\t\t1\t111\tdmg/lvl\t2\t\t\tatt/lvl\t15\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Jester's\t100\t\t1\t20\t\t15\t\t\t\t1\t111\tdmg/lvl\t3\t\t\tatt/lvl\t22\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Joker's\t100\t\t1\t35\t\t26\t\t\t\t1\t111\tdmg/lvl\t4\t\t\tatt/lvl\t33\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Trump\t100\t1\t1\t50\t\t37\t\t\t\t7\t111\tdmg/lvl\t4\t\t\tatt/lvl\t33\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Loud\t100\t\t\t1\t\t1\t\t\t\t1\t105\tdmg/lvl\t2\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Calling\t100\t\t1\t10\t\t7\t\t\t\t1\t105\tdmg/lvl\t3\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Yelling\t100\t\t1\t20\t\t15\t\t\t\t1\t105\tdmg/lvl\t4\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Shouting\t100\t\t1\t35\t\t26\t\t\t\t1\t105\tdmg/lvl\t5\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Gritty\t100\t1\t1\t50\t\t37\t\t\t\t7\t105\tdmg/lvl\t6\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Paradox\t100\t\t1\t25\t\t18\t\t\t\t1\t101\tac%/lvl\t12\t\t\t\t\t\t\t\t\t\t\twhit\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Paradox\t100\t\t1\t25\t\t18\t\t\t\t1\t105\tdmg%/lvl\t12\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Robineye\t100\t\t\t1\t\t1\t\t\t\t1\t111\tatt/lvl\t4\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Sparroweye\t100\t\t\t10\t\t7\t\t\t\t1\t111\tatt/lvl\t6\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Falconeye\t100\t\t\t20\t\t15\t\t\t\t1\t111\tatt/lvl\t8\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Hawkeye\t100\t1\t\t35\t\t26\t\t\t\t7\t111\tatt/lvl\t12\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Eagleeye\t100\t\t\t50\t\t37\t\t\t\t1\t111\tatt/lvl\t16\t\t\t\t\t\t\t\t\t\t\twhit\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"Visionary\t100\t1\t1\t25\t\t18\t\t\t\t1\t111\tatt%/lvl\t2\t\t\t\t\t\t\t\t\t\t\twhit\thelm\tmiss\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Mnemonic\t100\t1\t1\t25\t\t18\t\t\t\t1\t115\tmana/lvl\t6\t\t\t\t\t\t\t\t\t\t\tcblu\thelm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snowflake\t100\t1\t1\t25\t\t18\t\t\t\t3\t137\tcold-len\t\t25\t25\tcold-min\t\t6\t9\tcold-max\t\t19\t30\tlblu\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shivering\t100\t1\t1\t35\t\t26\t\t\t\t2\t137\tcold-len\t\t50\t50\tcold-min\t\t10\t15\tcold-max\t\t31\t45\tlblu\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Boreal\t100\t1\t1\t50\t\t40\t\t\t\t1\t137\tcold-len\t\t75\t75\tcold-min\t\t16\t23\tcold-max\t\t46\t90\tlblu\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Hibernal\t100\t1\t1\t70\t\t60\t\t\t\t1\t137\tcold-len\t\t100\t100\tcold-min\t\t24\t45\tcold-max\t\t91\t140\tlblu\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ember\t100\t1\t1\t25\t\t18\t\t\t\t3\t138\tfire-min\t\t16\t25\tfire-max\t\t31\t60\t\t\t\t\tdred\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Smoldering\t100\t1\t1\t35\t\t26\t\t\t\t2\t138\tfire-min\t\t26\t50\tfire-max\t\t61\t90\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Smoking\t100\t1\t1\t47\t\t37\t\t\t\t1\t138\tfire-min\t\t51\t80\tfire-max\t\t91\t130\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Flaming\t100\t1\t1\t61\t\t51\t\t\t\t1\t138\tfire-min\t\t81\t120\tfire-max\t\t131\t180\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Scorching\t100\t1\t1\t77\t\t67\t\t\t\t1\t138\tfire-min\t\t121\t170\tfire-max\t\t181\t240\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Static\t100\t1\t1\t25\t\t18\t\t\t\t3\t139\tltng-min\t\t1\t1\tltng-max\t\t49\t120\t\t\t\t\tlyel\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Glowing\t100\t1\t1\t34\t\t25\t\t\t\t2\t139\tltng-min\t\t1\t1\tltng-max\t\t121\t180\t\t\t\t\tlyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Buzzing\t100\t1\t1\t46\t\t36\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t181\t260\t\t\t\t\tlyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Arcing\t100\t1\t1\t60\t\t50\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t261\t360\t\t\t\t\tlyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shocking\t100\t1\t1\t76\t\t66\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t361\t480\t\t\t\t\tlyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Septic\t100\t1\t1\t1\t\t1\t\t\t\t3\t140\tdmg-pois\t50\t31\t31\t\t\t\t\t\t\t\t\tdgrn\tweap\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Envenomed\t100\t1\t1\t10\t\t7\t\t\t\t2\t140\tdmg-pois\t75\t41\t41\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Corosive\t100\t1\t1\t20\t\t15\t\t\t\t1\t140\tdmg-pois\t100\t205\t205\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Toxic\t100\t1\t1\t35\t\t26\t\t\t\t1\t140\tdmg-pois\t125\t308\t308\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Pestilent\t100\t1\t\t50\t\t37\t\t\t\t1\t140\tdmg-pois\t150\t470\t470\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Maiden's\t1\t1\t1\t36\t\t27\tama\t\t\t4\t125\tama\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Valkyrie's\t1\t1\t1\t90\t\t67\tama\t\t\t2\t125\tama\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Maiden's\t1\t1\t1\t30\t\t22\tama\t\t\t4\t125\tama\t\t1\t1\t\t\t\t\t\t\t\t\t\tmiss\tspea\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Valkyrie's\t1\t1\t1\t50\t\t42\tama\t\t\t2\t125\tama\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tmiss\tspea\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Monk's\t1\t1\t1\t36\t\t27\tpal\t\t\t4\t125\tpal\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Priest's\t1\t1\t1\t90\t\t67\tpal\t\t\t2\t125\tpal\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Monk's\t1\t1\t1\t30\t\t22\tpal\t\t\t4\t125\tpal\t\t1\t1\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Priest's\t1\t1\t1\t50\t\t42\tpal\t\t\t2\t125\tpal\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Monk's\t1\t1\t1\t35\t\t27\tpal\t\t\t4\t125\tpal\t\t1\t1\t\t\t\t\t\t\t\t\t\tswor\tmace\thamm\tshld\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Priest's\t1\t1\t1\t65\t\t58\tpal\t\t\t2\t125\tpal\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tswor\tmace\thamm\tshld\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Summoner's\t1\t1\t1\t36\t\t27\tnec\t\t\t4\t125\tnec\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Necromancer's\t1\t1\t1\t90\t\t67\tnec\t\t\t2\t125\tnec\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Summoner's\t1\t1\t1\t30\t\t22\tnec\t\t\t4\t125\tnec\t\t1\t1\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Necromancer's\t1\t1\t1\t50\t\t42\tnec\t\t\t2\t125\tnec\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Angel's\t1\t1\t1\t36\t\t27\tsor\t\t\t4\t125\tsor\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Arch-Angel's\t1\t1\t1\t90\t\t67\tsor\t\t\t2\t125\tsor\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Angel's\t1\t1\t1\t30\t\t22\tsor\t\t\t4\t125\tsor\t\t1\t1\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Arch-Angel's\t1\t1\t1\t50\t\t42\tsor\t\t\t2\t125\tsor\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Slayer's\t1\t1\t1\t36\t\t27\tbar\t\t\t4\t125\tbar\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Berserker's\t1\t1\t1\t90\t\t67\tbar\t\t\t2\t125\tbar\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Slayer's\t1\t1\t1\t30\t\t22\tbar\t\t\t4\t125\tbar\t\t1\t1\t\t\t\t\t\t\t\t\t\ttkni\taxe\tspea\tclub\tswor\thamm\tmace\tjave\t\t\t\t\t0\t0\n",
+                u8"Berserker's\t1\t1\t1\t50\t\t42\tbar\t\t\t1\t125\tbar\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\ttkni\taxe\tspea\tclub\tswor\thamm\tmace\tjave\t\t\t\t\t0\t0\n",
+                u8"Slayer's\t100\t1\t1\t30\t\t22\tbar\t\t\t4\t125\tbar\t\t1\t1\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Berserker's\t100\t1\t1\t50\t\t42\tbar\t\t\t2\t125\tbar\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shaman's\t100\t1\t1\t36\t\t27\tdru\t\t\t4\t125\tdru\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Hierophant's\t100\t1\t1\t90\t\t67\tdru\t\t\t2\t125\tdru\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shaman's\t100\t1\t1\t30\t\t22\tdru\t\t\t4\t125\tdru\t\t1\t1\t\t\t\t\t\t\t\t\t\tclub\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Hierophant's\t100\t1\t1\t50\t\t42\tdru\t\t\t2\t125\tdru\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tclub\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Magekiller's\t100\t1\t1\t36\t\t27\tass\t\t\t4\t125\tass\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Witch-hunter's\t100\t1\t1\t90\t\t67\tass\t\t\t2\t125\tass\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Magekiller's\t100\t1\t1\t30\t\t22\tass\t\t\t4\t125\tass\t\t1\t1\t\t\t\t\t\t\t\t\t\th2h\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Witch-hunter's\t100\t1\t1\t50\t\t42\tass\t\t\t2\t125\tass\t\t2\t2\t\t\t\t\t\t\t\t\tcgrn\th2h\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Compact\t100\t1\t1\t1\t\t1\t\t\t\t6\t141\tstack\t\t20\t40\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Thin\t100\t1\t1\t17\t\t12\t\t\t\t5\t141\tstack\t\t41\t80\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Dense\t100\t1\t1\t38\t\t30\t\t\t\t4\t141\tstack\t\t81\t120\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Consecrated\t100\t1\t1\t1\t\t1\t\t\t\t4\t142\tatt-undead\t\t25\t75\tdmg-undead\t\t25\t75\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Pure\t100\t1\t1\t15\t\t11\t\t\t\t3\t142\tatt-undead\t\t76\t175\tdmg-undead\t\t76\t125\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Sacred\t100\t1\t1\t25\t\t18\t\t\t\t2\t142\tatt-undead\t\t175\t250\tdmg-undead\t\t126\t200\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Hallowed\t100\t1\t1\t35\t\t27\t\t\t\t1\t142\tatt-undead\t\t251\t325\tdmg-undead\t\t201\t275\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Divine\t100\t1\t\t45\t\t37\t\t\t\t1\t142\tatt-undead\t\t326\t450\tdmg-undead\t\t276\t350\t\t\t\t\tlgld\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"Pearl\t100\t1\t1\t18\t\t13\t\t\t\t1\t142\tatt-undead\t\t25\t50\tdmg-undead\t\t25\t50\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Crimson\t1\t1\t1\t5\t\t3\t\t\t\t4\t118\tres-fire\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\tweap\t\t\t\t\t\t\t0\t0\n",
+                u8"Red\t100\t1\t1\t15\t\t11\t\t\t\t4\t103\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sanguinary\t100\t1\t1\t45\t\t37\t\t\t\t4\t103\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bloody\t100\t1\t\t75\t\t67\t\t\t\t4\t103\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Red\t100\t1\t1\t30\t\t22\t\t\t\t4\t103\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Sanguinary\t100\t1\t\t60\t\t52\t\t\t\t4\t103\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Red\t100\t1\t1\t90\t\t82\t\t\t\t4\t103\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t100\t1\t1\t7\t\t5\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Forked\t100\t1\t1\t37\t\t29\t\t\t\t4\t104\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Serrated\t100\t1\t\t67\t\t59\t\t\t\t4\t104\tdmg-max\t\t3\t3\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t100\t1\t1\t22\t\t16\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Forked\t100\t1\t\t52\t\t44\t\t\t\t4\t104\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\tblac\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jagged\t100\t1\t1\t81\t\t73\t\t\t\t4\t104\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\tblac\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snowflake\t100\t1\t1\t9\t\t6\t\t\t\t2\t137\tcold-len\t\t25\t25\tcold-min\t\t1\t1\tcold-max\t\t2\t3\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shivering\t100\t1\t1\t15\t\t11\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t2\t4\tcold-max\t\t4\t8\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Boreal\t100\t1\t1\t30\t\t22\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t5\t7\tcold-max\t\t9\t15\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Hibernal\t100\t1\t\t45\t\t38\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t8\t13\tcold-max\t\t16\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snowflake\t100\t1\t1\t18\t\t13\t\t\t\t2\t137\tcold-len\t\t25\t25\tcold-min\t\t2\t3\tcold-max\t\t3\t5\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shivering\t100\t1\t1\t29\t\t21\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t4\t5\tcold-max\t\t6\t10\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Boreal\t100\t1\t1\t49\t\t41\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t6\t10\tcold-max\t\t11\t20\tlblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Hibernal\t100\t1\t\t69\t\t61\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t11\t15\tcold-max\t\t21\t30\tlblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Snowflake\t100\t1\t1\t27\t\t20\t\t\t\t2\t137\tcold-len\t\t25\t25\tcold-min\t\t1\t2\tcold-max\t\t2\t4\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shivering\t100\t1\t1\t42\t\t34\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t3\t4\tcold-max\t\t5\t8\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Boreal\t100\t1\t1\t66\t\t58\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t5\t7\tcold-max\t\t9\t14\tlblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Hibernal\t100\t1\t\t91\t\t83\t\t\t\t1\t137\tcold-len\t\t25\t25\tcold-min\t\t8\t10\tcold-max\t\t15\t20\tlblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ember\t100\t1\t1\t5\t\t3\t\t\t\t2\t138\tfire-min\t\t1\t1\tfire-max\t\t2\t3\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Smoldering\t100\t1\t1\t15\t\t11\t\t\t\t1\t138\tfire-min\t\t2\t3\tfire-max\t\t4\t7\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Smoking\t100\t1\t1\t28\t\t21\t\t\t\t1\t138\tfire-min\t\t4\t7\tfire-max\t\t8\t19\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Flaming\t100\t1\t\t43\t\t35\t\t\t\t1\t138\tfire-min\t\t8\t18\tfire-max\t\t20\t36\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ember\t100\t1\t1\t13\t\t9\t\t\t\t2\t138\tfire-min\t\t1\t1\tfire-max\t\t2\t3\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Smoldering\t100\t1\t1\t27\t\t20\t\t\t\t1\t138\tfire-min\t\t2\t3\tfire-max\t\t4\t12\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Smoking\t100\t1\t1\t47\t\t39\t\t\t\t1\t138\tfire-min\t\t4\t9\tfire-max\t\t13\t27\t\t\t\t\tlred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Flaming\t100\t1\t\t67\t\t59\t\t\t\t1\t138\tfire-min\t\t10\t27\tfire-max\t\t28\t43\t\t\t\t\tlred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Ember\t100\t1\t1\t21\t\t15\t\t\t\t2\t138\tfire-min\t\t1\t1\tfire-max\t\t2\t3\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Smoldering\t100\t1\t1\t40\t\t32\t\t\t\t1\t138\tfire-min\t\t2\t3\tfire-max\t\t4\t10\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Smoking\t100\t1\t1\t64\t\t56\t\t\t\t1\t138\tfire-min\t\t4\t9\tfire-max\t\t11\t19\t\t\t\t\tlred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Flaming\t100\t1\t\t89\t\t81\t\t\t\t1\t138\tfire-min\t\t10\t19\tfire-max\t\t20\t29\t\t\t\t\tlred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Static\t100\t1\t1\t7\t\t5\t\t\t\t2\t139\tltng-min\t\t1\t1\tltng-max\t\t4\t5\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Glowing\t100\t1\t1\t14\t\t10\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t6\t17\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Arcing\t100\t1\t1\t29\t\t21\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t18\t44\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shocking\t100\t1\t\t44\t\t36\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t45\t79\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Static\t100\t1\t1\t14\t\t10\t\t\t\t2\t139\tltng-min\t\t1\t1\tltng-max\t\t5\t9\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Glowing\t100\t1\t1\t28\t\t20\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t10\t26\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Arcing\t100\t1\t1\t48\t\t40\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t27\t58\t\t\t\t\twhit\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shocking\t100\t1\t\t68\t\t60\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t59\t90\t\t\t\t\twhit\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Static\t100\t1\t1\t23\t\t17\t\t\t\t2\t139\tltng-min\t\t1\t1\tltng-max\t\t6\t11\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Glowing\t100\t1\t1\t41\t\t33\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t12\t24\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Arcing\t100\t1\t1\t65\t\t57\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t25\t43\t\t\t\t\twhit\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Shocking\t100\t1\t\t90\t\t82\t\t\t\t1\t139\tltng-min\t\t1\t1\tltng-max\t\t44\t71\t\t\t\t\twhit\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Septic\t100\t1\t1\t1\t\t1\t\t\t\t2\t140\tdmg-pois\t75\t18\t18\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Envenomed\t100\t1\t1\t12\t\t9\t\t\t\t1\t140\tdmg-pois\t100\t39\t39\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Toxic\t100\t1\t1\t27\t\t20\t\t\t\t1\t140\tdmg-pois\t125\t103\t103\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Pestilent\t100\t1\t\t42\t\t34\t\t\t\t1\t140\tdmg-pois\t150\t171\t171\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Septic\t100\t1\t1\t9\t\t6\t\t\t\t2\t140\tdmg-pois\t75\t35\t35\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Envenomed\t100\t1\t1\t26\t\t19\t\t\t\t1\t140\tdmg-pois\t100\t77\t77\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Toxic\t100\t1\t1\t46\t\t38\t\t\t\t1\t140\tdmg-pois\t125\t185\t185\t\t\t\t\t\t\t\t\tdgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Pestilent\t100\t1\t\t66\t\t58\t\t\t\t1\t140\tdmg-pois\t150\t299\t299\t\t\t\t\t\t\t\t\tdgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Septic\t100\t1\t1\t18\t\t13\t\t\t\t2\t140\tdmg-pois\t75\t52\t52\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Envenomed\t100\t1\t1\t39\t\t31\t\t\t\t1\t140\tdmg-pois\t100\t128\t128\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Toxic\t100\t1\t1\t63\t\t55\t\t\t\t1\t140\tdmg-pois\t125\t205\t205\t\t\t\t\t\t\t\t\tdgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Pestilent\t100\t1\t\t88\t\t80\t\t\t\t1\t140\tdmg-pois\t150\t299\t299\t\t\t\t\t\t\t\t\tdgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tireless\t1\t1\t1\t1\t5\t1\t\t\t\t4\t108\tregen-stam\t\t10\t10\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Lizard's\t1\t1\t1\t1\t2\t1\t\t\t\t4\t115\tmana\t\t1\t2\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\trod\torb\t\t\tboot\tglov\t\t\t\t0\t0\n",
+                u8"Azure\t1\t1\t1\t1\t4\t1\t\t\t\t3\t117\tres-cold\t\t5\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Crimson\t1\t1\t1\t1\t4\t1\t\t\t\t3\t118\tres-fire\t\t5\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Tangerine\t1\t1\t1\t1\t4\t1\t\t\t\t3\t119\tres-ltng\t\t5\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Beryl\t1\t1\t1\t1\t4\t1\t\t\t\t3\t120\tres-pois\t\t5\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Godly\t100\t1\t1\t50\t\t43\t\t\t\t1\t101\tac%\t\t101\t200\t\t\t\t\t\t\t\t\tdgld\tarmo\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Cruel\t100\t1\t1\t56\t\t48\t\t\t\t1\t105\tdmg%\t\t201\t300\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,770 +18,766 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetMagicSuffix()
+        EmbeddedText GetMagicSuffix()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"Name\tversion\tspawnable\trare\tlevel\tmaxlevel\tlevelreq\tclassspecific\tclass\tclasslevelreq\tfrequency\tgroup\tmod1code\tmod1param\tmod1min\tmod1max\tmod2code\tmod2param\tmod2min\tmod2max\tmod3code\tmod3param\tmod3min\tmod3max\ttransformcolor\titype1\titype2\titype3\titype4\titype5\titype6\titype7\tetype1\tetype2\tetype3\tetype4\tetype5\tmultiply\tadd\n";
-                ss << u8"of Health\t0\t1\t1\t7\t\t5\t\t\t\t\t1\tred-dmg\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Protection\t0\t1\t1\t18\t\t13\t\t\t\t\t1\tred-dmg\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Absorption\t0\t1\t1\t26\t\t19\t\t\t\t\t1\tred-dmg\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t0\t1\t1\t35\t\t26\t\t\t\t\t1\tred-dmg\t\t4\t4\t\t\t\t\t\t\t\t\tdblu\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Warding\t0\t1\t1\t7\t\t5\t\t\t\t\t2\tred-mag\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Sentinel\t0\t1\t1\t18\t\t13\t\t\t\t\t2\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Guarding\t0\t1\t1\t26\t\t19\t\t\t\t\t2\tred-mag\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Negation\t0\t1\t1\t35\t\t26\t\t\t\t\t2\tred-mag\t\t4\t4\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Piercing\t0\t1\t1\t25\t\t18\t\t\t\t\t3\tignore-ac\t\t1\t1\t\t\t\t\t\t\t\t\t\trod\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bashing\t0\t1\t1\t16\t\t12\t\t\t\t\t4\tdmg-ac\t\t-25\t-40\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n";
-                ss << u8"of Puncturing\t0\t1\t1\t6\t\t4\t\t\t\t\t4\tdmg-ac\t\t-10\t-20\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n";
-                ss << u8"of Thorns\t0\t1\t1\t14\t\t10\t\t\t\t\t5\tthorns\t\t1\t3\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tbelt\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Spikes\t0\t1\t1\t21\t\t15\t\t\t\t\t5\tthorns\t\t2\t6\t\t\t\t\t\t\t\t\toran\ttors\thelm\tshld\tbelt\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Readiness\t0\t1\t1\t1\t\t1\t\t\t\t\t6\tswing1\t\t10\t10\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Alacrity\t0\t1\t1\t8\t\t6\t\t\t\t\t6\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Swiftness\t0\t1\t1\t19\t\t14\t\t\t\t\t6\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n";
-                ss << u8"of Quickness\t0\t1\t1\t25\t\t18\t\t\t\t\t6\tswing3\t\t40\t40\t\t\t\t\t\t\t\t\tdyel\tmele\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n";
-                ss << u8"of Blocking\t0\t1\t1\t1\t\t1\t\t\t\t\t7\tblock\t\t10\t10\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Deflecting\t0\t1\t1\t11\t\t8\t\t\t\t\t7\tblock\t\t20\t20\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Apprentice\t0\t1\t1\t5\t\t3\t\t\t\t\t8\tcast1\t\t10\t10\t\t\t\t\t\t\t\t\t\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Magus\t0\t1\t1\t17\t\t12\t\t\t\t\t8\tcast3\t\t20\t20\t\t\t\t\t\t\t\t\t\trod\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost\t0\t1\t1\t4\t\t3\t\t\t\t\t9\tcold-min\t\t1\t1\tcold-max\t\t1\t4\tcold-len\t\t125\t125\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Glacier\t0\t1\t1\t18\t\t13\t\t\t\t\t9\tcold-min\t\t4\t4\tcold-max\t\t4\t12\tcold-len\t\t150\t150\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost\t0\t1\t1\t55\t\t41\t\t\t\t\t9\tcold-min\t\t1\t1\tcold-max\t\t1\t4\tcold-len\t\t125\t125\t\tbelt\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Warmth\t0\t1\t1\t10\t\t7\t\t\t\t\t10\thalf-freeze\t\t1\t1\t\t\t\t\t\t\t\t\t\tshld\tboot\tglov\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Flame\t0\t1\t1\t4\t\t3\t\t\t\t\t11\tfire-min\t\t1\t1\tfire-max\t\t2\t6\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire\t0\t1\t1\t15\t\t11\t\t\t\t\t11\tfire-min\t\t2\t2\tfire-max\t\t6\t11\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Burning\t0\t1\t1\t25\t\t18\t\t\t\t\t11\tfire-min\t\t10\t10\tfire-max\t\t10\t20\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Flame\t0\t1\t1\t40\t\t30\t\t\t\t\t11\tfire-min\t\t1\t1\tfire-max\t\t2\t6\t\t\t\t\t\tglov\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shock\t0\t1\t1\t4\t\t3\t\t\t\t\t12\tltng-min\t\t1\t1\tltng-max\t\t8\t8\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t0\t1\t1\t15\t\t11\t\t\t\t\t12\tltng-min\t\t1\t1\tltng-max\t\t16\t16\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thunder\t0\t1\t1\t25\t\t18\t\t\t\t\t12\tltng-min\t\t1\t1\tltng-max\t\t32\t32\t\t\t\t\tdyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shock\t0\t1\t1\t50\t\t37\t\t\t\t\t12\tltng-min\t\t1\t1\tltng-max\t\t8\t8\t\t\t\t\t\tboot\tring\tamul\tweap\t\t\t\tmiss\trod\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t0\t1\t1\t1\t\t1\t\t\t\t\t13\tdmg-max\t\t1\t2\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Quality\t0\t1\t1\t4\t\t3\t\t\t\t\t13\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Maiming\t0\t1\t1\t7\t\t5\t\t\t\t\t13\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Slaying\t0\t1\t1\t11\t\t8\t\t\t\t\t13\tdmg-max\t\t5\t7\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Gore\t0\t1\t1\t14\t\t10\t\t\t\t\t13\tdmg-max\t\t8\t10\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Carnage\t0\t1\t1\t19\t\t14\t\t\t\t\t13\tdmg-max\t\t11\t14\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n";
-                ss << u8"of Slaughter\t0\t1\t1\t25\t\t18\t\t\t\t\t13\tdmg-max\t\t15\t20\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n";
-                ss << u8"of Maiming\t0\t1\t1\t42\t\t31\t\t\t\t\t13\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tshld\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Worth\t0\t1\t1\t2\t\t1\t\t\t\t\t14\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"of Measure\t0\t1\t1\t6\t\t4\t\t\t\t\t14\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Excellence\t0\t1\t1\t12\t\t9\t\t\t\t\t14\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Performance\t0\t1\t1\t18\t\t13\t\t\t\t\t14\tdmg-min\t\t4\t5\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Measure\t0\t1\t1\t37\t\t27\t\t\t\t\t14\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\thelm\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blight\t0\t1\t1\t5\t\t3\t\t\t\t\t15\tpois-min\t\t8\t8\tpois-max\t\t24\t24\tpois-len\t\t75\t75\t\tweap\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"of Venom\t0\t1\t1\t15\t\t11\t\t\t\t\t15\tpois-min\t\t16\t16\tpois-max\t\t48\t48\tpois-len\t\t75\t75\t\tweap\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"of Pestilence\t0\t1\t1\t25\t\t18\t\t\t\t\t15\tpois-min\t\t32\t32\tpois-max\t\t72\t72\tpois-len\t\t100\t100\tdgrn\tweap\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"of Blight\t0\t1\t1\t45\t\t33\t\t\t\t\t15\tpois-min\t\t8\t8\tpois-max\t\t24\t24\tpois-len\t\t75\t75\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t0\t1\t1\t4\t\t3\t\t\t\t\t16\tdex\t\t1\t1\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t0\t1\t1\t5\t\t3\t\t\t\t\t16\tdex\t\t1\t3\t\t\t\t\t\t\t\t\t\tscep\tmiss\tboot\tglov\tring\tamul\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Skill\t0\t1\t1\t10\t\t7\t\t\t\t\t16\tdex\t\t4\t6\t\t\t\t\t\t\t\t\t\tscep\tmiss\tboot\tglov\tring\tamul\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Skill\t0\t1\t1\t45\t\t33\t\t\t\t\t16\tdex\t\t4\t6\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\tboot\tglov\t\t\t\t0\t0\n";
-                ss << u8"of Accuracy\t0\t1\t1\t18\t\t13\t\t\t\t\t16\tdex\t\t7\t10\t\t\t\t\t\t\t\t\t\tscep\tmiss\tboot\tglov\tring\tamul\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Precision\t0\t1\t1\t22\t\t16\t\t\t\t\t16\tdex\t\t11\t15\t\t\t\t\t\t\t\t\t\tscep\tmiss\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Precision\t0\t1\t1\t60\t\t45\t\t\t\t\t16\tdex\t\t11\t15\t\t\t\t\t\t\t\t\t\tarmo\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Perfection\t0\t1\t1\t30\t\t22\t\t\t\t\t16\tdex\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tmiss\tglov\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Balance\t0\t1\t1\t5\t\t3\t\t\t\t\t17\tbalance1\t\t10\t10\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"of Stability\t0\t1\t1\t9\t\t6\t\t\t\t\t17\tbalance3\t\t20\t20\t\t\t\t\t\t\t\t\tdyel\tarmo\t\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Regeneration\t0\t1\t1\t10\t\t7\t\t\t\t\t19\tregen\t\t3\t3\t\t\t\t\t\t\t\t\t\tscep\tbelt\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Regeneration\t0\t1\t1\t40\t\t30\t\t\t\t\t19\tregen\t\t3\t3\t\t\t\t\t\t\t\t\t\tshld\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Regeneration\t0\t1\t1\t70\t\t52\t\t\t\t\t19\tregen\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\thelm\tweap\tboot\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"of Regrowth\t0\t1\t1\t17\t\t12\t\t\t\t\t19\tregen\t\t5\t5\t\t\t\t\t\t\t\t\tcred\tscep\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Regrowth\t0\t1\t1\t55\t\t41\t\t\t\t\t19\tregen\t\t5\t5\t\t\t\t\t\t\t\t\tcred\tbelt\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Vileness\t0\t1\t1\t9\t\t6\t\t\t\t\t20\tnoheal\t\t1\t1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Greed\t0\t1\t1\t2\t\t1\t\t\t\t\t22\tgold%\t\t40\t60\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Wealth\t0\t1\t1\t17\t\t12\t\t\t\t\t22\tgold%\t\t80\t120\t\t\t\t\t\t\t\t\tlgld\tboot\tglov\tbelt\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Chance\t0\t1\t1\t12\t\t9\t\t\t\t\t23\tmag%\t\t10\t19\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fortune\t0\t1\t1\t16\t\t12\t\t\t\t\t23\tmag%\t\t20\t35\t\t\t\t\t\t\t\t\tlgld\tboot\tglov\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Energy\t0\t1\t1\t4\t\t3\t\t\t\t\t24\tmana\t\t1\t1\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Energy\t0\t1\t1\t5\t\t3\t\t\t\t\t24\tmana\t\t1\t5\t\t\t\t\t\t\t\t\t\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Mind\t0\t1\t1\t10\t\t7\t\t\t\t\t24\tmana\t\t6\t10\t\t\t\t\t\t\t\t\t\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Brilliance\t0\t1\t1\t18\t\t13\t\t\t\t\t24\tmana\t\t11\t15\t\t\t\t\t\t\t\t\t\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Sorcery\t0\t1\t1\t22\t\t16\t\t\t\t\t24\tmana\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\trod\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Wizardry\t0\t1\t1\t30\t\t22\t\t\t\t\t24\tmana\t\t21\t30\t\t\t\t\t\t\t\t\tdgld\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Bear\t0\t1\t1\t8\t\t6\t\t\t\t\t25\tknock\t\t1\t1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Light\t0\t1\t1\t6\t\t4\t\t\t\t\t26\tlight\t\t1\t1\t\t\t\t\t\t\t\t\t\tarmo\trod\tmiss\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Radiance\t0\t1\t1\t15\t\t11\t\t\t\t\t26\tlight\t\t3\t3\t\t\t\t\t\t\t\t\t\trod\tmiss\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Sun\t0\t1\t1\t17\t\t12\t\t\t\t\t26\tlight\t\t5\t5\t\t\t\t\t\t\t\t\t\trod\tmiss\tglov\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t0\t1\t1\t23\t\t17\t\t\t\t\t27\thp\t\t5\t5\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tbelt\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Jackal\t0\t1\t1\t3\t\t2\t\t\t\t\t27\thp\t\t1\t5\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Fox\t0\t1\t1\t6\t\t4\t\t\t\t\t27\thp\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Wolf\t0\t1\t1\t14\t\t10\t\t\t\t\t27\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Wolf\t0\t1\t1\t45\t\t33\t\t\t\t\t27\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"of the Tiger\t0\t1\t1\t20\t\t15\t\t\t\t\t27\thp\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Mammoth\t0\t1\t1\t24\t\t18\t\t\t\t\t27\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\ttors\thelm\tshld\tring\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Mammoth\t0\t1\t1\t60\t\t45\t\t\t\t\t27\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\tmele\tglov\tbelt\t\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"of the Colosuss\t0\t1\t1\t30\t\t22\t\t\t\t\t27\thp\t\t41\t60\t\t\t\t\t\t\t\t\tcred\ttors\thelm\tshld\tbelt\tamul\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Leech\t0\t1\t1\t6\t\t4\t\t\t\t\t28\tlifesteal\t\t4\t7\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Locust\t0\t1\t1\t20\t\t15\t\t\t\t\t28\tlifesteal\t\t8\t10\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Bat\t0\t1\t1\t6\t\t4\t\t\t\t\t29\tmanasteal\t\t4\t8\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Vampire\t0\t1\t1\t20\t\t15\t\t\t\t\t29\tmanasteal\t\t9\t12\t\t\t\t\t\t\t\t\tcblu\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Defiance\t0\t1\t1\t25\t\t18\t\t\t\t\t30\tres-pois-len\t\t75\t75\t\t\t\t\t\t\t\t\tdred\ttors\thelm\tshld\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Amelioration\t0\t1\t1\t18\t\t13\t\t\t\t\t30\tres-pois-len\t\t50\t50\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Remedy\t0\t1\t1\t7\t\t5\t\t\t\t\t30\tres-pois-len\t\t25\t25\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Simplicity\t0\t1\t1\t25\t\t18\t\t\t\t\t32\tease\t\t-40\t-40\t\t\t\t\t\t\t\t\t\ttors\thelm\tweap\tshld\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"of Ease\t0\t1\t1\t15\t\t11\t\t\t\t\t32\tease\t\t-20\t-20\t\t\t\t\t\t\t\t\t\ttors\thelm\tweap\tshld\t\t\t\trod\t\t\t\t\t0\t0\n";
-                ss << u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t0\t1\t1\t5\t\t3\t\t\t\t\t34\tstr\t\t1\t3\t\t\t\t\t\t\t\t\t\tbelt\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Might\t0\t1\t1\t10\t\t7\t\t\t\t\t34\tstr\t\t4\t6\t\t\t\t\t\t\t\t\t\tmele\tshld\tring\tamul\t\t\t\twand\tstaf\t\t\t\t0\t0\n";
-                ss << u8"of the Ox\t0\t1\t1\t18\t\t13\t\t\t\t\t34\tstr\t\t7\t10\t\t\t\t\t\t\t\t\t\tmele\tbelt\tring\tamul\t\t\t\twand\tstaf\t\t\t\t0\t0\n";
-                ss << u8"of the Ox\t0\t1\t1\t47\t\t35\t\t\t\t\t34\tstr\t\t7\t10\t\t\t\t\t\t\t\t\t\tshld\tboot\tglov\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Giant\t0\t1\t1\t22\t\t16\t\t\t\t\t34\tstr\t\t11\t15\t\t\t\t\t\t\t\t\tdgld\tmele\tbelt\tamul\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n";
-                ss << u8"of the Giant\t0\t1\t1\t62\t\t46\t\t\t\t\t34\tstr\t\t11\t15\t\t\t\t\t\t\t\t\tdgld\tboot\tglov\tring\tshld\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Titan\t0\t1\t1\t30\t\t22\t\t\t\t\t34\tstr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tboot\tbelt\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Pacing\t0\t1\t1\t2\t\t1\t\t\t\t\t35\tmove1\t\t10\t10\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Haste\t0\t1\t1\t12\t\t9\t\t\t\t\t35\tmove2\t\t20\t20\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Speed\t0\t1\t1\t22\t\t16\t\t\t\t\t35\tmove3\t\t30\t30\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                ss << u8"of Health\t1\t1\t1\t7\t\t5\t\t\t\t4\t1\tred-dmg\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\tshld\tring\tamul\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Protection\t1\t1\t1\t18\t\t13\t\t\t\t4\t1\tred-dmg\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Absorption\t1\t1\t1\t26\t\t19\t\t\t\t4\t1\tred-dmg\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t1\t1\t1\t35\t\t26\t\t\t\t4\t1\tred-dmg\t\t4\t4\t\t\t\t\t\t\t\t\tdblu\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life Everlasting\t100\t1\t\t45\t\t37\t\t\t\t4\t1\tred-dmg\t\t10\t25\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Protection\t1\t1\t1\t24\t\t18\t\t\t\t4\t1\tred-dmg\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Absorption\t1\t1\t1\t32\t\t24\t\t\t\t4\t1\tred-dmg\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t1\t1\t1\t41\t\t33\t\t\t\t4\t1\tred-dmg\t\t4\t7\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Anima\t100\t1\t\t51\t\t43\t\t\t\t4\t1\tred-dmg\t\t8\t15\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Warding\t1\t1\t1\t7\t\t5\t\t\t\t4\t2\tred-mag\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\tshld\tring\tamul\torb\tcirc\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Sentinel\t1\t1\t1\t18\t\t12\t\t\t\t4\t2\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Guarding\t1\t1\t1\t26\t\t19\t\t\t\t4\t2\tred-mag\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Negation\t100\t1\t\t42\t\t35\t\t\t\t4\t2\tred-mag\t\t4\t6\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Sentinel\t1\t1\t1\t24\t\t18\t\t\t\t4\t2\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Guarding\t1\t1\t1\t32\t\t24\t\t\t\t4\t2\tred-mag\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Negation\t100\t1\t\t41\t\t33\t\t\t\t4\t2\tred-mag\t\t4\t6\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Coolness\t100\t\t1\t11\t\t8\t\t\t\t1\t3\tabs-fire\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Incombustibility\t100\t\t1\t19\t\t14\t\t\t\t1\t3\tabs-fire\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Amianthus\t100\t\t1\t28\t\t21\t\t\t\t1\t3\tabs-fire\t\t4\t5\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Quenching\t100\t\t\t38\t\t30\t\t\t\t1\t3\tabs-fire\t\t6\t8\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Coolness\t100\t\t1\t13\t\t9\t\t\t\t1\t3\tabs-fire\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Incombustibility\t100\t\t1\t22\t\t16\t\t\t\t1\t3\tabs-fire\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Amianthus\t100\t\t1\t33\t\t25\t\t\t\t1\t3\tabs-fire\t\t4\t5\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Quenching\t100\t\t\t46\t\t38\t\t\t\t1\t3\tabs-fire\t\t6\t8\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Faith\t100\t\t1\t23\t\t17\t\t\t\t1\t3\tabs-fire\t\t1\t2\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Resistance\t100\t\t1\t11\t\t8\t\t\t\t1\t3\tabs-ltng\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Insulation\t100\t\t1\t19\t\t14\t\t\t\t1\t3\tabs-ltng\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Grounding\t100\t\t1\t28\t\t21\t\t\t\t1\t3\tabs-ltng\t\t4\t5\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Dynamo\t100\t\t\t38\t\t30\t\t\t\t1\t3\tabs-ltng\t\t6\t8\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Resistance\t100\t\t1\t13\t\t9\t\t\t\t1\t3\tabs-ltng\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Insulation\t100\t\t1\t22\t\t16\t\t\t\t1\t3\tabs-ltng\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Grounding\t100\t\t1\t33\t\t25\t\t\t\t1\t3\tabs-ltng\t\t4\t5\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Dynamo\t100\t\t\t46\t\t38\t\t\t\t1\t3\tabs-ltng\t\t6\t8\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Stoicism\t100\t\t1\t22\t\t16\t\t\t\t1\t3\tabs-ltng\t\t1\t2\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Warming\t100\t\t1\t11\t\t8\t\t\t\t1\t3\tabs-cold\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thawing\t100\t\t1\t19\t\t14\t\t\t\t1\t3\tabs-cold\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Dunes\t100\t\t1\t28\t\t21\t\t\t\t1\t3\tabs-cold\t\t4\t5\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Sirocco\t100\t\t\t38\t\t30\t\t\t\t1\t3\tabs-cold\t\t6\t8\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Warming\t100\t\t1\t13\t\t9\t\t\t\t1\t3\tabs-cold\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thawing\t100\t\t1\t22\t\t16\t\t\t\t1\t3\tabs-cold\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Dunes\t100\t\t1\t33\t\t25\t\t\t\t1\t3\tabs-cold\t\t4\t5\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Sirocco\t100\t\t\t46\t\t38\t\t\t\t1\t3\tabs-cold\t\t6\t8\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Desire\t100\t\t1\t23\t\t17\t\t\t\t1\t3\tabs-cold\t\t1\t2\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Piercing\t1\t1\t1\t25\t\t18\t\t\t\t2\t4\tignore-ac\t\t1\t1\t\t\t\t\t\t\t\t\t\trod\tknif\th2h\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bashing\t100\t\t1\t16\t\t12\t\t\t\t4\t5\tdmg-ac\t\t-25\t-40\t\t\t\t\t\t\t\t\t\tblun\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Puncturing\t100\t\t1\t6\t\t4\t\t\t\t4\t5\tdmg-ac\t\t-10\t-20\t\t\t\t\t\t\t\t\t\tspea\tknif\th2h\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thorns\t1\t1\t1\t14\t\t10\t\t\t\t4\t6\tthorns\t\t1\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tbelt\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Spikes\t1\t1\t1\t21\t\t15\t\t\t\t4\t6\tthorns\t\t4\t6\t\t\t\t\t\t\t\t\toran\ttors\tshld\tbelt\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Razors\t100\t1\t1\t34\t\t26\t\t\t\t4\t6\tthorns\t\t7\t9\t\t\t\t\t\t\t\t\toran\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Swords\t100\t1\t\t47\t\t39\t\t\t\t4\t6\tthorns\t\t10\t20\t\t\t\t\t\t\t\t\toran\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Malice\t100\t1\t1\t37\t\t29\t\t\t\t4\t6\tthorns\t\t1\t5\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Readiness\t1\t1\t1\t5\t\t3\t\t\t\t6\t7\tswing1\t\t10\t10\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Alacrity\t1\t1\t1\t25\t\t17\t\t\t\t6\t7\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Swiftness\t1\t1\t1\t34\t\t26\t\t\t\t6\t7\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Quickness\t1\t1\t1\t46\t\t38\t\t\t\t5\t7\tswing3\t\t40\t40\t\t\t\t\t\t\t\t\tdyel\tmele\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Alacrity\t100\t1\t1\t43\t\t35\t\t\t\t4\t7\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\tdyel\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fervor\t100\t1\t\t39\t\t31\t\t\t\t4\t7\tswing1\t\t15\t15\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blocking\t1\t1\t1\t1\t\t1\t\t\t\t7\t8\tblock\t\t10\t10\tblock2\t\t15\t15\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Deflecting\t1\t1\t1\t11\t\t8\t\t\t\t6\t8\tblock\t\t20\t20\tblock2\t\t30\t30\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Apprentice\t1\t1\t1\t5\t\t3\t\t\t\t6\t9\tcast1\t\t10\t10\t\t\t\t\t\t\t\t\t\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Magus\t1\t1\t1\t29\t\t21\t\t\t\t5\t9\tcast3\t\t20\t20\t\t\t\t\t\t\t\t\t\trod\torb\tcirc\t\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost\t1\t1\t1\t4\t\t3\t\t\t\t5\t10\tcold-min\t\t1\t1\tcold-max\t\t1\t2\tcold-len\t\t50\t50\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of the Icicle\t100\t1\t1\t13\t\t9\t\t\t\t4\t10\tcold-min\t\t1\t1\tcold-max\t\t3\t4\tcold-len\t\t75\t75\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of the Glacier\t1\t1\t1\t27\t\t20\t\t\t\t3\t10\tcold-min\t\t2\t4\tcold-max\t\t4\t15\tcold-len\t\t100\t100\tdblu\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Winter\t100\t1\t1\t45\t\t37\t\t\t\t2\t10\tcold-min\t\t5\t9\tcold-max\t\t16\t50\tcold-len\t\t150\t150\tdblu\tmele\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Frost\t1\t1\t1\t55\t\t41\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t3\t6\tcold-len\t\t50\t50\t\tbelt\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frigidity\t100\t1\t1\t16\t\t12\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t3\t5\tcold-len\t\t50\t50\tdblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Warmth\t1\t1\t1\t10\t\t7\t\t\t\t4\t11\thalf-freeze\t\t1\t1\t\t\t\t\t\t\t\t\t\tshld\tboot\tglov\tring\tamul\tcirc\torb\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Flame\t1\t1\t1\t4\t\t3\t\t\t\t5\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t5\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Fire\t1\t1\t1\t15\t\t11\t\t\t\t4\t12\tfire-min\t\t1\t4\tfire-max\t\t6\t11\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Burning\t1\t1\t1\t25\t\t18\t\t\t\t3\t12\tfire-min\t\t5\t9\tfire-max\t\t10\t20\t\t\t\t\tdred\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Incineration\t100\t1\t1\t43\t\t35\t\t\t\t2\t12\tfire-min\t\t10\t20\tfire-max\t\t21\t75\t\t\t\t\tdred\tmele\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Flame\t100\t1\t1\t40\t\t30\t\t\t\t2\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t6\t\t\t\t\t\tglov\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Passion\t100\t1\t1\t15\t\t11\t\t\t\t2\t12\tfire-min\t\t1\t3\tfire-max\t\t6\t10\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shock\t1\t1\t1\t4\t\t3\t\t\t\t5\t13\tltng-min\t\t1\t1\tltng-max\t\t6\t8\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t1\t1\t1\t15\t\t11\t\t\t\t4\t13\tltng-min\t\t1\t1\tltng-max\t\t9\t16\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Thunder\t1\t1\t1\t25\t\t18\t\t\t\t3\t13\tltng-min\t\t1\t1\tltng-max\t\t17\t40\t\t\t\t\tdyel\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Storms\t100\t1\t1\t34\t\t26\t\t\t\t2\t13\tltng-min\t\t1\t6\tltng-max\t\t41\t120\t\t\t\t\tdyel\tmele\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n";
-                ss << u8"of Shock\t100\t1\t1\t50\t\t37\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t11\t23\t\t\t\t\t\tboot\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Ennui\t100\t1\t1\t15\t\t11\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t10\t20\t\t\t\t\tdyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t1\t1\t1\t1\t\t1\t\t\t\t8\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Quality\t1\t1\t1\t4\t\t3\t\t\t\t8\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Maiming\t1\t1\t1\t7\t\t5\t\t\t\t7\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Slaying\t1\t1\t1\t11\t\t8\t\t\t\t7\t14\tdmg-max\t\t5\t7\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Gore\t1\t1\t1\t14\t\t10\t\t\t\t6\t14\tdmg-max\t\t8\t10\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Carnage\t1\t1\t1\t19\t\t14\t\t\t\t6\t14\tdmg-max\t\t11\t14\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Slaughter\t1\t1\t1\t25\t\t18\t\t\t\t5\t14\tdmg-max\t\t15\t20\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Butchery\t100\t1\t\t35\t\t27\t\t\t\t5\t14\tdmg-max\t\t21\t40\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Evisceration\t100\t1\t\t45\t\t37\t\t\t\t4\t14\tdmg-max\t\t41\t63\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Maiming\t1\t1\t1\t42\t\t34\t\t\t\t4\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tshld\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t100\t1\t1\t1\t7\t1\t\t\t\t4\t14\tdmg-max\t\t1\t2\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t100\t1\t1\t8\t14\t6\t\t\t\t4\t14\tdmg-max\t\t2\t3\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t100\t1\t1\t15\t\t11\t\t\t\t4\t14\tdmg-max\t\t4\t5\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Quality\t100\t1\t1\t23\t29\t17\t\t\t\t4\t14\tdmg-max\t\t6\t7\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Quality\t100\t1\t1\t30\t\t22\t\t\t\t4\t14\tdmg-max\t\t7\t8\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Maiming\t100\t1\t\t37\t44\t29\t\t\t\t4\t14\tdmg-max\t\t9\t10\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Maiming\t100\t1\t\t45\t\t37\t\t\t\t4\t14\tdmg-max\t\t11\t12\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t100\t0\t1\t8\t17\t6\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t100\t0\t1\t18\t\t13\t\t\t\t4\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Quality\t100\t0\t1\t28\t37\t21\t\t\t\t4\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Quality\t100\t0\t1\t38\t\t30\t\t\t\t4\t14\tdmg-max\t\t5\t6\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Maiming\t100\t0\t\t48\t\t40\t\t\t\t4\t14\tdmg-max\t\t7\t8\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t100\t0\t1\t21\t\t15\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Quality\t100\t0\t1\t36\t\t28\t\t\t\t4\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Maiming\t100\t0\t\t51\t\t43\t\t\t\t4\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Ire\t100\t1\t1\t4\t\t3\t\t\t\t4\t14\tdmg-max\t\t2\t5\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Wrath\t100\t1\t1\t11\t\t8\t\t\t\t4\t14\tdmg-max\t\t6\t9\t\t\t\t\t\t\t\t\tblac\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Carnage\t100\t1\t\t25\t\t18\t\t\t\t4\t14\tdmg-max\t\t11\t15\t\t\t\t\t\t\t\t\tblac\tjewl\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                ss << u8"of Worth\t1\t1\t1\t1\t\t1\t\t\t\t8\t15\tdmg-min\t\t1\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Measure\t1\t1\t1\t12\t\t9\t\t\t\t7\t15\tdmg-min\t\t3\t4\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Excellence\t1\t1\t1\t24\t\t18\t\t\t\t6\t15\tdmg-min\t\t5\t8\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Performance\t1\t1\t1\t48\t\t40\t\t\t\t5\t15\tdmg-min\t\t9\t14\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Transcendence\t100\t1\t1\t76\t\t68\t\t\t\t4\t15\tdmg-min\t\t15\t20\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Worth\t1\t1\t1\t15\t\t11\t\t\t\t4\t15\tdmg-min\t\t2\t3\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Measure\t1\t1\t1\t37\t\t29\t\t\t\t4\t15\tdmg-min\t\t4\t5\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Excellence\t1\t1\t1\t59\t\t51\t\t\t\t4\t15\tdmg-min\t\t6\t9\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Performance\t100\t1\t\t81\t\t73\t\t\t\t4\t15\tdmg-min\t\t10\t13\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Joyfulness\t100\t1\t1\t5\t\t3\t\t\t\t4\t15\tdmg-min\t\t1\t4\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bliss\t100\t1\t1\t43\t\t37\t\t\t\t4\t15\tdmg-min\t\t5\t10\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blight\t1\t1\t1\t5\t\t3\t\t\t\t5\t16\tdmg-pois\t75\t24\t24\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n";
-                ss << u8"of Venom\t1\t1\t1\t15\t\t11\t\t\t\t4\t16\tdmg-pois\t100\t54\t54\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n";
-                ss << u8"of Pestilence\t1\t1\t1\t25\t\t18\t\t\t\t3\t16\tdmg-pois\t125\t103\t103\t\t\t\t\t\t\t\t\tdgrn\tweap\tcirc\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n";
-                ss << u8"of Anthrax\t100\t1\t1\t33\t\t25\t\t\t\t2\t16\tdmg-pois\t150\t171\t171\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n";
-                ss << u8"of Blight\t100\t1\t1\t45\t\t33\t\t\t\t2\t16\tdmg-pois\t75\t171\t171\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Envy\t100\t1\t1\t1\t\t1\t\t\t\t2\t16\tdmg-pois\t50\t103\t103\t\t\t\t\t\t\t\t\tdgrn\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t1\t1\t1\t1\t\t1\t\t\t\t4\t17\tdex\t\t1\t2\t\t\t\t\t\t\t\t\t\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Skill\t1\t1\t1\t11\t\t8\t\t\t\t3\t17\tdex\t\t3\t5\t\t\t\t\t\t\t\t\t\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Accuracy\t1\t1\t1\t27\t\t20\t\t\t\t3\t17\tdex\t\t6\t9\t\t\t\t\t\t\t\t\t\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Precision\t1\t1\t1\t43\t\t35\t\t\t\t3\t17\tdex\t\t10\t15\t\t\t\t\t\t\t\t\t\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Perfection\t1\t1\t1\t59\t\t51\t\t\t\t3\t17\tdex\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Nirvana\t100\t1\t\t72\t\t64\t\t\t\t3\t17\tdex\t\t21\t30\t\t\t\t\t\t\t\t\tdgld\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t1\t1\t1\t6\t\t4\t\t\t\t4\t17\tdex\t\t1\t2\t\t\t\t\t\t\t\t\t\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Skill\t1\t1\t1\t22\t\t16\t\t\t\t3\t17\tdex\t\t3\t5\t\t\t\t\t\t\t\t\t\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Accuracy\t1\t1\t1\t39\t\t31\t\t\t\t3\t17\tdex\t\t6\t9\t\t\t\t\t\t\t\t\t\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Precision\t1\t1\t1\t56\t\t48\t\t\t\t3\t17\tdex\t\t10\t15\t\t\t\t\t\t\t\t\t\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Perfection\t100\t1\t\t75\t\t67\t\t\t\t3\t17\tdex\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t1\t1\t1\t13\t\t9\t\t\t\t3\t17\tdex\t\t2\t3\t\t\t\t\t\t\t\t\t\ttors\tboot\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"of Skill\t1\t1\t1\t34\t\t26\t\t\t\t3\t17\tdex\t\t4\t5\t\t\t\t\t\t\t\t\t\ttors\tboot\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"of Accuracy\t1\t1\t1\t46\t\t38\t\t\t\t3\t17\tdex\t\t6\t9\t\t\t\t\t\t\t\t\t\ttors\tboot\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"of Precision\t100\t1\t\t60\t\t52\t\t\t\t3\t17\tdex\t\t10\t15\t\t\t\t\t\t\t\t\tdgld\ttors\tboot\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t100\t1\t1\t1\t\t1\t\t\t\t4\t31\tdex\t\t3\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t100\t1\t1\t3\t\t2\t\t\t\t4\t31\tdex\t\t2\t3\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t100\t1\t1\t7\t\t5\t\t\t\t4\t31\tdex\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t100\t1\t1\t14\t\t10\t\t\t\t4\t31\tdex\t\t5\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t100\t1\t1\t18\t\t13\t\t\t\t4\t31\tdex\t\t4\t5\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t100\t1\t1\t22\t\t16\t\t\t\t4\t31\tdex\t\t2\t2\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Daring\t100\t1\t1\t7\t\t5\t\t\t\t3\t17\tdex\t\t1\t3\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Balance\t1\t1\t1\t5\t\t3\t\t\t\t4\t18\tbalance1\t\t10\t10\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n";
-                ss << u8"of Equilibrium\t1\t1\t1\t9\t\t6\t\t\t\t4\t18\tbalance2\t\t17\t17\t\t\t\t\t\t\t\t\t\ttors\tbelt\tshld\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Stability\t1\t1\t1\t18\t\t13\t\t\t\t4\t18\tbalance3\t\t24\t24\t\t\t\t\t\t\t\t\tdyel\ttors\tbelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Balance\t100\t1\t1\t1\t\t1\t\t\t\t4\t18\tbalance3\t\t12\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Balance\t100\t1\t1\t19\t\t14\t\t\t\t4\t18\tbalance2\t\t8\t8\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Balance\t100\t1\t1\t37\t\t29\t\t\t\t4\t18\tbalance1\t\t5\t5\t\t\t\t\t\t\t\t\tdyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Truth\t100\t1\t1\t44\t\t36\t\t\t\t4\t18\tbalance1\t\t7\t7\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Regeneration\t1\t1\t1\t10\t\t7\t\t\t\t4\t19\tregen\t\t3\t5\t\t\t\t\t\t\t\t\t\tscep\tbelt\tring\tamul\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Regeneration\t1\t1\t1\t40\t\t30\t\t\t\t4\t19\tregen\t\t3\t5\t\t\t\t\t\t\t\t\t\tshld\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Regeneration\t1\t1\t1\t70\t\t52\t\t\t\t4\t19\tregen\t\t3\t5\t\t\t\t\t\t\t\t\t\ttors\tweap\tboot\t\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"of Regrowth\t1\t1\t1\t17\t\t12\t\t\t\t4\t19\tregen\t\t6\t10\t\t\t\t\t\t\t\t\tcred\tscep\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Regrowth\t1\t1\t1\t55\t\t41\t\t\t\t4\t19\tregen\t\t6\t9\t\t\t\t\t\t\t\t\tcred\tbelt\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Revivification\t100\t1\t\t38\t\t30\t\t\t\t4\t19\tregen\t\t11\t15\t\t\t\t\t\t\t\t\tcred\tscep\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Honor\t100\t1\t1\t47\t\t35\t\t\t\t4\t19\tregen\t\t1\t4\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Vileness\t1\t1\t1\t9\t\t6\t\t\t\t3\t20\tnoheal\t\t1\t1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n";
-                ss << u8"of Greed\t1\t1\t1\t1\t\t1\t\t\t\t4\t21\tgold%\t\t25\t40\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Wealth\t1\t1\t1\t17\t\t12\t\t\t\t4\t21\tgold%\t\t41\t80\t\t\t\t\t\t\t\t\tlgld\tboot\tglov\tbelt\tamul\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Greed\t100\t1\t1\t1\t\t1\t\t\t\t4\t21\tgold%\t\t10\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Greed\t100\t1\t1\t7\t\t5\t\t\t\t4\t21\tgold%\t\t21\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Greed\t100\t1\t1\t19\t\t14\t\t\t\t4\t21\tgold%\t\t31\t40\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Greed\t100\t1\t1\t1\t\t5\t\t\t\t4\t21\tgold%\t\t5\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Greed\t100\t1\t1\t20\t\t15\t\t\t\t4\t21\tgold%\t\t11\t22\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Greed\t100\t1\t1\t1\t\t15\t\t\t\t4\t21\tgold%\t\t5\t10\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Avarice\t100\t1\t1\t1\t\t1\t\t\t\t4\t21\tgold%\t\t10\t30\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Chance\t1\t1\t1\t12\t\t9\t\t\t\t4\t22\tmag%\t\t5\t15\t\t\t\t\t\t\t\t\t\tboot\tglov\tring\tamul\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fortune\t1\t1\t1\t16\t\t12\t\t\t\t4\t22\tmag%\t\t16\t25\t\t\t\t\t\t\t\t\tlgld\tboot\tglov\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fortune\t1\t1\t\t42\t\t31\t\t\t\t4\t22\tmag%\t\t16\t25\t\t\t\t\t\t\t\t\tlgld\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Luck\t100\t1\t\t26\t\t19\t\t\t\t4\t22\tmag%\t\t26\t35\t\t\t\t\t\t\t\t\tlgld\tboot\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fortune\t100\t1\t1\t31\t\t18\t\t\t\t3\t22\tmag%\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Good Luck\t100\t1\t\t47\t\t33\t\t\t\t2\t22\tmag%\t\t6\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Prosperity\t100\t1\t1\t26\t\t19\t\t\t\t2\t22\tmag%\t\t5\t10\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Energy\t1\t1\t1\t1\t\t1\t\t\t\t4\t23\tenr\t\t1\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Mind\t1\t1\t1\t7\t\t3\t\t\t\t4\t23\tenr\t\t4\t6\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Brilliance\t1\t1\t1\t13\t\t9\t\t\t\t3\t23\tenr\t\t7\t10\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Sorcery\t1\t1\t1\t21\t\t16\t\t\t\t3\t23\tenr\t\t11\t15\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Wizardry\t1\t1\t1\t31\t\t23\t\t\t\t3\t23\tenr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Enlightenment\t100\t1\t\t41\t\t33\t\t\t\t3\t23\tenr\t\t21\t30\t\t\t\t\t\t\t\t\tdgld\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Energy\t1\t1\t1\t7\t\t5\t\t\t\t4\t23\tenr\t\t1\t3\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Mind\t1\t1\t1\t13\t\t9\t\t\t\t3\t23\tenr\t\t4\t6\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Brilliance\t1\t1\t1\t21\t\t16\t\t\t\t3\t23\tenr\t\t7\t10\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Sorcery\t1\t1\t1\t31\t\t23\t\t\t\t3\t23\tenr\t\t11\t15\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Wizardry\t100\t1\t\t41\t\t33\t\t\t\t3\t23\tenr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Energy\t1\t1\t1\t4\t\t3\t\t\t\t3\t23\tenr\t\t1\t3\t\t\t\t\t\t\t\t\t\thelm\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Mind\t1\t1\t1\t10\t\t7\t\t\t\t3\t23\tenr\t\t4\t6\t\t\t\t\t\t\t\t\t\thelm\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Brilliance\t1\t1\t1\t16\t\t12\t\t\t\t3\t23\tenr\t\t7\t10\t\t\t\t\t\t\t\t\t\thelm\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Sorcery\t100\t1\t\t26\t\t21\t\t\t\t3\t23\tenr\t\t11\t15\t\t\t\t\t\t\t\t\tdgld\thelm\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Knowledge\t100\t1\t1\t9\t\t6\t\t\t\t3\t23\tenr\t\t1\t5\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Bear\t1\t1\t1\t8\t\t6\t\t\t\t3\t24\tknock\t\t1\t1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Light\t1\t1\t1\t6\t\t4\t\t\t\t1\t25\tlight\t\t1\t1\tatt\t\t15\t15\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Radiance\t1\t1\t1\t15\t\t11\t\t\t\t1\t25\tlight\t\t3\t3\tatt\t\t30\t30\t\t\t\t\t\trod\tmiss\tring\tamul\thelm\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Sun\t1\t1\t1\t17\t\t12\t\t\t\t1\t25\tlight\t\t5\t5\tatt%\t\t5\t5\t\t\t\t\t\trod\tmiss\tglov\tring\tamul\thelm\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Jackal\t1\t1\t1\t1\t\t1\t\t\t\t3\t26\thp\t\t1\t5\t\t\t\t\t\t\t\t\t\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Fox\t1\t1\t1\t7\t\t5\t\t\t\t3\t26\thp\t\t6\t10\t\t\t\t\t\t\t\t\t\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Wolf\t1\t1\t1\t15\t\t11\t\t\t\t3\t26\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Tiger\t1\t1\t1\t20\t\t15\t\t\t\t3\t26\thp\t\t21\t30\t\t\t\t\t\t\t\t\t\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Mammoth\t1\t1\t1\t25\t\t18\t\t\t\t3\t26\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Colosuss\t1\t1\t1\t30\t\t22\t\t\t\t3\t26\thp\t\t41\t60\t\t\t\t\t\t\t\t\tcred\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Squid\t100\t1\t\t40\t\t30\t\t\t\t3\t26\thp\t\t61\t80\t\t\t\t\t\t\t\t\tcred\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Whale\t100\t1\t\t50\t\t37\t\t\t\t3\t26\thp\t\t81\t100\t\t\t\t\t\t\t\t\tcred\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Jackal\t100\t1\t1\t4\t\t3\t\t\t\t3\t26\thp\t\t1\t5\t\t\t\t\t\t\t\t\t\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Fox\t100\t1\t1\t11\t\t8\t\t\t\t3\t26\thp\t\t6\t10\t\t\t\t\t\t\t\t\t\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Wolf\t100\t1\t1\t27\t\t20\t\t\t\t3\t26\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Tiger\t100\t1\t1\t43\t\t35\t\t\t\t3\t26\thp\t\t21\t30\t\t\t\t\t\t\t\t\t\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Mammoth\t100\t1\t1\t59\t\t51\t\t\t\t3\t26\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Colosuss\t100\t1\t\t75\t\t67\t\t\t\t3\t26\thp\t\t41\t60\t\t\t\t\t\t\t\t\tcred\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Jackal\t1\t1\t1\t8\t\t6\t\t\t\t3\t26\thp\t\t1\t5\t\t\t\t\t\t\t\t\t\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Fox\t1\t1\t1\t17\t\t13\t\t\t\t3\t26\thp\t\t6\t10\t\t\t\t\t\t\t\t\t\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Wolf\t1\t1\t1\t34\t\t26\t\t\t\t3\t26\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Tiger\t1\t1\t1\t51\t\t43\t\t\t\t3\t26\thp\t\t21\t30\t\t\t\t\t\t\t\t\t\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Mammoth\t1\t1\t1\t68\t\t60\t\t\t\t3\t26\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t100\t1\t1\t1\t\t1\t\t\t\t4\t26\thp\t\t5\t10\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t100\t1\t1\t9\t\t6\t\t\t\t4\t26\thp\t\t11\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t100\t1\t1\t19\t\t14\t\t\t\t4\t26\thp\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Substinence\t100\t1\t1\t31\t\t23\t\t\t\t4\t26\thp\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Substinence\t100\t1\t1\t45\t\t37\t\t\t\t4\t26\thp\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Substinence\t100\t1\t1\t61\t\t53\t\t\t\t4\t26\thp\t\t31\t35\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Vita\t100\t1\t\t77\t\t69\t\t\t\t4\t26\thp\t\t36\t40\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Vita\t100\t1\t\t91\t\t83\t\t\t\t4\t26\thp\t\t41\t45\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Vita\t100\t1\t\t110\t\t97\t\t\t\t4\t26\thp\t\t46\t50\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t100\t1\t1\t1\t\t9\t\t\t\t4\t26\thp\t\t6\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t100\t1\t1\t12\t\t9\t\t\t\t4\t26\thp\t\t11\t15\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Substinence\t100\t1\t1\t26\t\t19\t\t\t\t4\t26\thp\t\t16\t20\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Substinence\t100\t1\t1\t42\t\t34\t\t\t\t4\t26\thp\t\t21\t25\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Vita\t100\t1\t\t58\t\t50\t\t\t\t4\t26\thp\t\t26\t30\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Vita\t100\t1\t\t74\t\t66\t\t\t\t4\t26\thp\t\t31\t35\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life\t100\t1\t1\t1\t\t14\t\t\t\t4\t26\thp\t\t5\t10\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Substinence\t100\t1\t1\t23\t\t17\t\t\t\t4\t26\thp\t\t11\t15\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Vita\t100\t1\t\t47\t\t39\t\t\t\t4\t26\thp\t\t16\t20\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Spirit\t100\t1\t1\t1\t\t1\t\t\t\t4\t26\thp\t\t3\t8\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Hope\t100\t1\t\t45\t\t37\t\t\t\t4\t26\thp\t\t9\t20\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Leech\t1\t1\t1\t6\t\t4\t\t\t\t7\t27\tlifesteal\t\t4\t5\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"of the Locust\t1\t1\t1\t20\t\t15\t\t\t\t7\t27\tlifesteal\t\t6\t7\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"of the Lamprey\t100\t1\t1\t55\t\t43\t\t\t\t7\t27\tlifesteal\t\t8\t9\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"of the Leech\t1\t1\t1\t14\t\t10\t\t\t\t4\t27\tlifesteal\t\t3\t4\t\t\t\t\t\t\t\t\t\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Locust\t1\t1\t1\t47\t\t35\t\t\t\t4\t27\tlifesteal\t\t5\t6\t\t\t\t\t\t\t\t\t\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Lamprey\t100\t1\t1\t77\t\t65\t\t\t\t4\t27\tlifesteal\t\t7\t8\t\t\t\t\t\t\t\t\tcred\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Leech\t1\t1\t1\t34\t\t26\t\t\t\t4\t27\tlifesteal\t\t3\t3\t\t\t\t\t\t\t\t\tcred\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Bat\t1\t1\t1\t7\t\t4\t\t\t\t7\t28\tmanasteal\t\t4\t5\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"of the Wraith\t1\t1\t1\t21\t\t16\t\t\t\t7\t28\tmanasteal\t\t6\t7\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Vampire\t100\t1\t1\t56\t\t48\t\t\t\t7\t28\tmanasteal\t\t8\t9\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Bat\t1\t1\t1\t15\t\t11\t\t\t\t4\t28\tmanasteal\t\t3\t4\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Wraith\t1\t1\t1\t58\t\t40\t\t\t\t4\t28\tmanasteal\t\t5\t6\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Vampire\t100\t1\t1\t78\t\t66\t\t\t\t4\t28\tmanasteal\t\t7\t8\t\t\t\t\t\t\t\t\tcred\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Bat\t1\t1\t1\t35\t\t27\t\t\t\t4\t28\tmanasteal\t\t3\t3\t\t\t\t\t\t\t\t\tcred\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Defiance\t1\t1\t1\t25\t\t18\t\t\t\t2\t29\tres-pois-len\t\t75\t75\t\t\t\t\t\t\t\t\tdred\ttors\tshld\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Amelioration\t1\t1\t1\t18\t\t13\t\t\t\t3\t29\tres-pois-len\t\t50\t50\t\t\t\t\t\t\t\t\t\ttors\tshld\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Remedy\t100\t1\t1\t7\t\t5\t\t\t\t3\t29\tres-pois-len\t\t25\t25\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Simplicity\t1\t1\t1\t25\t\t18\t\t\t\t2\t30\tease\t\t-30\t-30\t\t\t\t\t\t\t\t\t\ttors\tweap\tshld\t\t\t\t\trod\torb\t\t\t\t0\t0\n";
-                ss << u8"of Ease\t1\t1\t1\t15\t\t11\t\t\t\t3\t30\tease\t\t-20\t-20\t\t\t\t\t\t\t\t\t\ttors\tweap\tshld\t\t\t\t\trod\torb\t\t\t\t0\t0\n";
-                ss << u8"of Freedom\t100\t1\t1\t1\t\t1\t\t\t\t3\t30\tease\t\t-15\t-15\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t1\t1\t1\t1\t\t1\t\t\t\t4\t31\tstr\t\t1\t2\t\t\t\t\t\t\t\t\t\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Might\t1\t1\t1\t10\t\t8\t\t\t\t3\t31\tstr\t\t3\t5\t\t\t\t\t\t\t\t\t\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Ox\t1\t1\t1\t26\t\t19\t\t\t\t3\t31\tstr\t\t6\t9\t\t\t\t\t\t\t\t\t\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Giant\t1\t1\t1\t42\t\t34\t\t\t\t3\t31\tstr\t\t10\t15\t\t\t\t\t\t\t\t\t\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Titan\t1\t1\t1\t58\t\t50\t\t\t\t3\t31\tstr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Atlus\t100\t1\t1\t71\t\t63\t\t\t\t3\t31\tstr\t\t21\t30\t\t\t\t\t\t\t\t\tdgld\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t1\t1\t1\t5\t\t3\t\t\t\t4\t31\tstr\t\t1\t2\t\t\t\t\t\t\t\t\t\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Might\t1\t1\t1\t21\t\t15\t\t\t\t3\t31\tstr\t\t3\t5\t\t\t\t\t\t\t\t\t\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Ox\t1\t1\t1\t38\t\t30\t\t\t\t3\t31\tstr\t\t6\t9\t\t\t\t\t\t\t\t\t\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Giant\t1\t1\t1\t55\t\t47\t\t\t\t3\t31\tstr\t\t10\t15\t\t\t\t\t\t\t\t\t\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Titan\t100\t1\t1\t74\t\t66\t\t\t\t3\t31\tstr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t1\t1\t1\t12\t\t8\t\t\t\t3\t31\tstr\t\t1\t2\t\t\t\t\t\t\t\t\t\tmele\tglov\tshld\t\t\t\t\tblun\t\t\t\t\t0\t0\n";
-                ss << u8"of Might\t1\t1\t1\t33\t\t25\t\t\t\t3\t31\tstr\t\t3\t5\t\t\t\t\t\t\t\t\t\tmele\tglov\tshld\t\t\t\t\tblun\t\t\t\t\t0\t0\n";
-                ss << u8"of the Ox\t1\t1\t1\t45\t\t37\t\t\t\t3\t31\tstr\t\t6\t9\t\t\t\t\t\t\t\t\t\tmele\tglov\tshld\t\t\t\t\tblun\t\t\t\t\t0\t0\n";
-                ss << u8"of the Giant\t100\t1\t1\t59\t\t51\t\t\t\t3\t31\tstr\t\t10\t15\t\t\t\t\t\t\t\t\tdgld\tmele\tglov\t\t\t\t\t\tblun\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t100\t1\t1\t1\t\t1\t\t\t\t4\t31\tstr\t\t3\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t100\t1\t1\t3\t\t2\t\t\t\t4\t31\tstr\t\t2\t3\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t100\t1\t1\t7\t\t5\t\t\t\t4\t31\tstr\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t100\t1\t1\t14\t\t10\t\t\t\t4\t31\tstr\t\t5\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t100\t1\t1\t18\t\t13\t\t\t\t4\t31\tstr\t\t4\t5\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t100\t1\t1\t22\t\t16\t\t\t\t4\t31\tstr\t\t2\t2\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Virility\t100\t1\t1\t18\t\t13\t\t\t\t4\t31\tstr\t\t1\t4\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Pacing\t1\t1\t1\t12\t\t8\t\t\t\t3\t35\tmove1\t\t10\t10\t\t\t\t\t\t\t\t\t\tboot\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Haste\t1\t1\t1\t22\t\t16\t\t\t\t4\t35\tmove2\t\t20\t20\t\t\t\t\t\t\t\t\t\tboot\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Speed\t1\t1\t1\t37\t\t29\t\t\t\t4\t35\tmove3\t\t30\t30\t\t\t\t\t\t\t\t\t\tboot\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Traveling\t100\t1\t\t65\t\t57\t\t\t\t4\t35\tmove3\t\t30\t30\tstamdrain\t\t80\t90\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Acceleration\t100\t1\t\t51\t\t43\t\t\t\t4\t35\tmove3\t\t40\t40\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Inertia\t100\t1\t1\t19\t\t14\t\t\t\t4\t35\tmove3\t\t7\t7\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Inertia\t100\t1\t1\t24\t\t18\t\t\t\t4\t35\tmove2\t\t5\t5\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Inertia\t100\t1\t\t35\t\t27\t\t\t\t4\t35\tmove1\t\t3\t3\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Self-Repair\t100\t1\t1\t3\t\t1\t\t\t\t3\t37\trep-dur\t3\t\t\t\t\t\t\t\t\t\t\t\tweap\tarmo\t\t\t\t\t\tthro\tmiss\t\t\t\t0\t0\n";
-                ss << u8"of Fast Repair\t100\t1\t1\t20\t\t12\t\t\t\t2\t37\trep-dur\t5\t\t\t\t\t\t\t\t\t\t\t\tweap\tarmo\t\t\t\t\t\tthro\tmiss\t\t\t\t0\t0\n";
-                ss << u8"of Ages\t100\t1\t\t50\t\t42\t\t\t\t1\t39\tindestruct\t\t\t\t\t\t\t\t\t\t\t\t\tweap\tarmo\t\t\t\t\t\tthro\tmiss\t\t\t\t0\t0\n";
-                ss << u8"of Replenishing\t100\t1\t1\t5\t\t3\t\t\t\t6\t39\trep-quant\t5\t\t\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Propogation\t100\t1\t1\t24\t\t18\t\t\t\t5\t39\trep-quant\t10\t\t\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Kraken\t100\t1\t\t20\t\t1\t\t\t\t1\t41\thp/lvl\t6\t\t\t\t\t\t\t\t\t\t\tcred\ttors\tamul\tpelt\tphlm\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Memory\t100\t1\t\t20\t\t1\t\t\t\t1\t41\tmana/lvl\t6\t\t\t\t\t\t\t\t\t\t\tcred\tcirc\tamul\tpelt\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Elephant\t100\t1\t\t37\t\t7\t\t\t\t2\t41\thp/lvl\t4\t\t\tmana/lvl\t2\t\t\t\t\t\t\tcred\tcirc\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Power\t100\t\t\t1\t\t1\t\t\t\t1\t42\tstr/lvl\t3\t\t\t\t\t\t\t\t\t\t\tdgld\tbelt\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Grace\t100\t\t\t1\t\t1\t\t\t\t1\t42\tdex/lvl\t3\t\t\t\t\t\t\t\t\t\t\tdgld\thelm\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Grace and Power\t100\t\t\t1\t\t1\t\t\t\t1\t42\tstr/lvl\t1\t\t\tdex/lvl\t1\t\t\t\t\t\t\tdgld\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Yeti\t100\t\t\t1\t\t1\t\t\t\t1\t43\tres-cold/lvl\t3\t\t\t\t\t\t\t\t\t\t\tlblu\ttors\tglov\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Phoenix\t100\t\t\t1\t\t1\t\t\t\t1\t43\tres-fire/lvl\t3\t\t\t\t\t\t\t\t\t\t\tcred\tshld\thelm\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Efreeti\t100\t\t\t1\t\t1\t\t\t\t1\t43\tres-ltng/lvl\t3\t\t\t\t\t\t\t\t\t\t\tcblu\tglov\tboot\tring\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Cobra\t100\t\t\t1\t\t1\t\t\t\t1\t43\tres-pois/lvl\t3\t\t\t\t\t\t\t\t\t\t\tdyel\tbelt\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Elements\t100\t\t\t1\t\t1\t\t\t\t10\t43\tres-cold/lvl\t1\t\t\tres-fire/lvl\t1\t\t\tres-ltng/lvl\t1\t\t\tdgld\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Firebolts\t100\t1\t1\t16\t\t12\t\t\t\t1\t44\thit-skill\t36\t10\t8\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Firebolts\t100\t1\t1\t6\t\t4\t\t\t\t1\t44\tatt-skill\t36\t5\t3\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Firebolts\t100\t1\t1\t20\t\t15\t\t\t\t1\t44\tatt-skill\t36\t10\t4\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Charged Shield\t100\t1\t1\t6\t\t4\t\t\t\t1\t44\tgethit-skill\t38\t10\t3\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Charged Shield\t100\t1\t1\t16\t\t12\t\t\t\t1\t44\tgethit-skill\t38\t12\t4\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Charged Shield\t100\t1\t1\t26\t\t19\t\t\t\t1\t44\tgethit-skill\t38\t14\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Icebolt\t100\t1\t1\t6\t\t4\t\t\t\t1\t44\tatt-skill\t39\t5\t3\t\t\t\t\t\t\t\t\tlblu\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Frozen Armor\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Static Field\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Telekinesis\t100\t1\t1\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost Shield\t100\t1\t1\t12\t\t9\t\t\t\t1\t44\tgethit-skill\t44\t5\t3\t\t\t\t\t\t\t\t\tlblu\tarmo\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Ice Blast\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blaze\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Ball\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Nova\t100\t1\t1\t18\t\t13\t\t\t\t1\t44\thit-skill\t48\t10\t3\t\t\t\t\t\t\t\t\tcblu\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Nova\t100\t1\t1\t28\t\t21\t\t\t\t1\t44\thit-skill\t48\t12\t4\t\t\t\t\t\t\t\t\tcblu\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Nova Shield\t100\t1\t1\t18\t\t13\t\t\t\t1\t44\tgethit-skill\t48\t10\t3\t\t\t\t\t\t\t\t\tcblu\tarmo\tring \t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Nova Shield\t100\t1\t1\t28\t\t21\t\t\t\t1\t44\tgethit-skill\t48\t12\t4\t\t\t\t\t\t\t\t\tcblu\tarmo\tring \t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Nova Shield\t100\t1\t1\t38\t\t28\t\t\t\t1\t44\tgethit-skill\t48\t14\t5\t\t\t\t\t\t\t\t\tcblu\tarmo\tring \t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t100\t1\t1\t18\t\t13\t\t\t\t1\t44\tatt-skill\t49\t5\t3\t\t\t\t\t\t\t\t\tcblu\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t100\t\t\t12\t\t18\t\tsor\t9\t1\t44\tcharged\t49\t50\t1\t\t\t\t\t\t\t\t\tcblu\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shiver Armor\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Wall\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Enchant\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Chain Lightning\t100\t1\t1\t25\t\t18\t\t\t\t1\t44\tatt-skill\t53\t5\t3\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Chain Lightning\t100\t1\t1\t35\t\t26\t\t\t\t1\t44\tatt-skill\t53\t8\t3\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Chain Lightning\t100\t1\t1\t45\t\t33\t\t\t\t1\t44\tatt-skill\t53\t8\t5\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\tmiss\t\t\t\t\t0\t0\n";
-                ss << u8"of Teleport Shield\t100\t\t\t25\t\t18\t\t\t\t1\t44\tgethit-skill\t54\t10\t3\t\t\t\t\t\t\t\t\twhit\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Teleport Shield\t100\t\t\t35\t\t26\t\t\t\t1\t44\tgethit-skill\t54\t14\t3\t\t\t\t\t\t\t\t\twhit\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Teleport Shield\t100\t\t\t45\t\t33\t\t\t\t1\t44\tgethit-skill\t54\t18\t3\t\t\t\t\t\t\t\t\twhit\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Glacial Spike\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Meteor\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thunder Storm\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Energy Shield\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blizzard\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Chilling Armor\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Hydra Shield\t100\t1\t1\t40\t\t30\t\t\t\t1\t44\tgethit-skill\t62\t10\t3\t\t\t\t\t\t\t\t\tcred\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frozen Orb\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dawn\t100\t\t\t30\t\t22\t\t\t\t0\t45\tac/time\t3\t10\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Sunlight\t100\t\t\t30\t\t22\t\t\t\t0\t45\tac/time\t0\t-10\t60\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Magic Arrows\t100\t1\t1\t12\t\t11\t\tama\t1\t1\t44\tcharged\t6\t-30\t-10\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Magic Arrows\t100\t\t\t35\t\t28\t\tama\t3\t1\t44\tcharged\t6\t-20\t-6\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Arrows\t100\t\t\t13\t\t12\t\tama\t1\t1\t44\tcharged\t7\t-30\t-10\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Arrows\t100\t1\t1\t40\t\t32\t\tama\t3\t1\t44\tcharged\t7\t-20\t-6\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Inner Sight\t100\t1\t1\t18\t\t14\t\tama\t2\t1\t44\tcharged\t8\t-30\t-6\t\t\t\t\t\t\t\t\t\tamul\tamaz\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Inner Sight\t100\t1\t1\t50\t\t42\t\tama\t5\t1\t44\tcharged\t8\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Jabbing\t100\t\t\t24\t\t18\t\tama\t3\t1\t44\tcharged\t10\t-60\t-7\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Jabbing\t100\t\t\t50\t\t42\t\tama\t5\t1\t44\tcharged\t10\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Cold Arrows\t100\t1\t1\t15\t\t16\t\tama\t6\t1\t44\tcharged\t11\t-30\t-8\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Cold Arrows\t100\t1\t1\t47\t\t39\t\tama\t9\t1\t44\tcharged\t11\t-20\t-5\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Multiple Shot\t100\t1\t1\t18\t\t19\t\tama\t6\t1\t44\tcharged\t12\t-30\t-8\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Multiple Shot\t100\t1\t1\t63\t\t55\t\tama\t12\t1\t44\tcharged\t12\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Power Strike\t100\t1\t1\t12\t\t13\t\tama\t6\t1\t44\tcharged\t14\t-60\t-6\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Power Strike\t100\t1\t1\t55\t\t47\t\tama\t9\t1\t44\tcharged\t14\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Poison Jab\t100\t\t\t17\t\t18\t\tama\t6\t1\t44\tcharged\t15\t-60\t-6\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Poison Jab\t100\t\t\t67\t\t59\t\tama\t13\t1\t44\tcharged\t15\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Exploding Arrows\t100\t1\t1\t30\t\t26\t\tama\t12\t1\t44\tcharged\t16\t-30\t-6\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Exploding Arrows\t100\t1\t1\t69\t\t61\t\tama\t17\t1\t44\tcharged\t16\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Slow Missiles\t100\t\t\t33\t\t27\t\tama\t12\t1\t44\tcharged\t17\t-30\t-5\t\t\t\t\t\t\t\t\t\tamaz\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Slow Missiles\t100\t\t\t68\t\t60\t\tama\t15\t1\t44\tcharged\t17\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Impaling Strike\t100\t\t\t24\t\t18\t\tama\t12\t1\t44\tcharged\t19\t-60\t-6\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Impaling Strike\t100\t\t\t59\t\t51\t\tama\t15\t1\t44\tcharged\t19\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning Javelin\t100\t\t\t25\t\t18\t\tama\t12\t1\t44\tcharged\t20\t-60\t-6\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning Javelin\t100\t\t\t70\t\t62\t\tama\t17\t1\t44\tcharged\t20\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Ice Arrows\t100\t1\t1\t36\t\t28\t\tama\t18\t1\t44\tcharged\t21\t-30\t-5\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Ice Arrows\t100\t1\t1\t72\t\t64\t\tama\t22\t1\t44\tcharged\t21\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Guided Arrows\t100\t\t\t34\t\t26\t\tama\t18\t1\t44\tcharged\t22\t-30\t-5\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Guided Arrows\t100\t\t\t69\t\t61\t\tama\t21\t1\t44\tcharged\t22\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Charged Strike\t100\t1\t1\t33\t\t25\t\tama\t18\t1\t44\tcharged\t24\t-60\t-5\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Charged Strike\t100\t1\t1\t68\t\t60\t\tama\t21\t1\t44\tcharged\t24\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Plague Jab\t100\t\t\t35\t\t27\t\tama\t18\t1\t44\tcharged\t25\t-60\t-5\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Plague Jab\t100\t\t\t71\t\t63\t\tama\t22\t1\t44\tcharged\t25\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Immolating Arrows\t100\t\t\t42\t\t36\t\tama\t24\t1\t44\tcharged\t27\t-30\t-4\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Immolating Arrows\t100\t\t\t85\t\t77\t\tama\t27\t1\t44\tcharged\t27\t-20\t-2\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fending\t100\t\t\t41\t\t35\t\tama\t24\t1\t44\tcharged\t30\t-60\t-5\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fending\t100\t\t\t83\t\t75\t\tama\t26\t1\t44\tcharged\t30\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Freezing Arrows\t100\t1\t1\t50\t\t42\t\tama\t30\t1\t44\tcharged\t31\t-30\t-4\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Freezing Arrows\t100\t1\t1\t94\t\t86\t\tama\t33\t1\t44\tcharged\t31\t-20\t-2\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning Strike\t100\t1\t1\t47\t\t39\t\tama\t30\t1\t44\tcharged\t34\t-60\t-4\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning Strike\t100\t1\t1\t90\t\t82\t\tama\t32\t1\t44\tcharged\t34\t-20\t-2\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning Fury\t100\t\t\t49\t\t41\t\tama\t30\t1\t44\tcharged\t35\t-60\t-4\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning Fury\t100\t\t\t92\t\t84\t\tama\t33\t1\t44\tcharged\t35\t-20\t-2\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Bolts\t100\t1\t1\t7\t\t7\t\tsor\t1\t1\t44\tcharged\t36\t-30\t-10\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Bolts\t100\t1\t1\t14\t\t14\t\tsor\t1\t1\t44\tcharged\t36\t-20\t-6\t\t\t\t\t\t\t\t\t\tswor\tring\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Charged Bolts\t100\t1\t1\t7\t\t7\t\tsor\t1\t1\t44\tcharged\t38\t-30\t-10\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Charged Bolts\t100\t1\t1\t14\t\t14\t\tsor\t1\t1\t44\tcharged\t38\t-20\t-6\t\t\t\t\t\t\t\t\t\thamm\tmace\tscep\tring\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Ice Bolts\t100\t1\t1\t7\t\t7\t\tsor\t1\t1\t44\tcharged\t39\t-30\t-10\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Ice Bolts\t100\t1\t1\t14\t\t14\t\tsor\t1\t1\t44\tcharged\t39\t-20\t-6\t\t\t\t\t\t\t\t\t\tknif\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frozen Armor\t100\t\t\t7\t\t7\t\tsor\t1\t1\t44\tcharged\t40\t-30\t-10\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frozen Armor\t100\t\t\t14\t\t14\t\tsor\t1\t1\t44\tcharged\t40\t-20\t-6\t\t\t\t\t\t\t\t\t\tknif\ttors\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Static Field\t100\t\t\t12\t\t12\t\tsor\t6\t1\t44\tcharged\t42\t-30\t-8\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Static Field\t100\t\t\t24\t\t24\t\tsor\t6\t1\t44\tcharged\t42\t-20\t-5\t\t\t\t\t\t\t\t\t\thamm\tmace\tscep\tring\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Telekinesis\t100\t1\t1\t12\t\t12\t\tsor\t6\t1\t44\tcharged\t43\t-30\t-8\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Telekinesis\t100\t1\t1\t24\t\t24\t\tsor\t6\t1\t44\tcharged\t43\t-20\t-5\t\t\t\t\t\t\t\t\t\thamm\tmace\tscep\tring\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost Novas\t100\t1\t1\t12\t\t12\t\tsor\t6\t1\t44\tcharged\t44\t-30\t-8\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost Novas\t100\t1\t1\t24\t\t24\t\tsor\t6\t1\t44\tcharged\t44\t-20\t-5\t\t\t\t\t\t\t\t\t\tknif\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Ice Blasts\t100\t1\t1\t12\t\t12\t\tsor\t6\t1\t44\tcharged\t45\t-30\t-8\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Ice Blasts\t100\t1\t1\t24\t\t24\t\tsor\t6\t1\t44\tcharged\t45\t-20\t-5\t\t\t\t\t\t\t\t\t\thamm\tmace\tscep\tring\tcirc\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blazing\t100\t\t\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t46\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blazing\t100\t\t\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t46\t-20\t-4\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Balls\t100\t1\t1\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t47\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Balls\t100\t1\t1\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t47\t-20\t-4\t\t\t\t\t\t\t\t\t\tspea\twand\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Novas\t100\t1\t1\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t48\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Novas\t100\t1\t1\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t48\t-20\t-4\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t100\t1\t1\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t49\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t100\t1\t1\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t49\t-20\t-4\t\t\t\t\t\t\t\t\t\taxe\thamm\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shiver Armor\t100\t\t\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t50\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shiver Armor\t100\t\t\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t50\t-20\t-4\t\t\t\t\t\t\t\t\t\tknif\ttors\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Walls\t100\t\t\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t51\t-30\t-6\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Walls\t100\t\t\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t51\t-20\t-3\t\t\t\t\t\t\t\t\t\tpole\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Enchantment\t100\t1\t1\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t52\t-20\t-3\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Enchantment\t100\t1\t1\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t52\t-10\t-1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Chain Lightning\t100\t1\t1\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t53\t-30\t-6\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Chain Lightning\t100\t1\t1\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t53\t-20\t-3\t\t\t\t\t\t\t\t\t\tspea\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Teleportation\t100\t1\t1\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t54\t-30\t-6\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Teleportation\t100\t1\t1\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t54\t-20\t-3\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Glacial Spikes\t100\t1\t1\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t55\t-30\t-6\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Glacial Spikes\t100\t1\t1\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t55\t-20\t-3\t\t\t\t\t\t\t\t\t\tknif\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Meteors\t100\t1\t1\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t56\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Meteors\t100\t1\t1\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t56\t-20\t-2\t\t\t\t\t\t\t\t\t\tknif\tclub\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thunder Storm\t100\t\t\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t57\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thunder Storm\t100\t\t\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t57\t-20\t-2\t\t\t\t\t\t\t\t\t\thamm\tclub\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Energy Shield\t100\t\t\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t58\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Energy Shield\t100\t\t\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t58\t-20\t-2\t\t\t\t\t\t\t\t\t\thelm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blizzards\t100\t1\t1\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t59\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blizzards\t100\t1\t1\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t59\t-20\t-2\t\t\t\t\t\t\t\t\t\tknif\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Chilling Armor\t100\t\t\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t60\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Chilling Armor\t100\t\t\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t60\t-20\t-2\t\t\t\t\t\t\t\t\t\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Hydras\t100\t\t\t36\t\t36\t\tsor\t30\t1\t44\tcharged\t62\t-30\t-3\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Hydras\t100\t\t\t72\t\t72\t\tsor\t30\t1\t44\tcharged\t62\t-20\t-1\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frozen Orbs\t100\t1\t1\t36\t\t36\t\tsor\t30\t1\t44\tcharged\t64\t-30\t-3\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frozen Orbs\t100\t1\t1\t72\t\t72\t\tsor\t30\t1\t44\tcharged\t64\t-20\t-1\t\t\t\t\t\t\t\t\t\tknif\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Amplify Damage\t100\t\t\t7\t\t7\t\tnec\t1\t1\t44\tcharged\t66\t-60\t-10\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Amplify Damage\t100\t\t\t14\t\t14\t\tnec\t1\t1\t44\tcharged\t66\t-20\t-6\t\t\t\t\t\t\t\t\t\tblun\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Teeth\t100\t1\t1\t7\t\t7\t\tnec\t1\t1\t44\tcharged\t67\t-60\t-10\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Teeth\t100\t1\t1\t14\t\t14\t\tnec\t1\t1\t44\tcharged\t67\t-20\t-6\t\t\t\t\t\t\t\t\t\tswor\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Armor\t100\t\t\t7\t\t7\t\tnec\t1\t1\t44\tcharged\t68\t-60\t-10\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Armor\t100\t\t\t14\t\t14\t\tnec\t1\t1\t44\tcharged\t68\t-20\t-6\t\t\t\t\t\t\t\t\t\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Raise Skeletons\t100\t\t\t7\t\t7\t\tnec\t1\t1\t44\tcharged\t70\t-60\t-10\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Raise Skeletons\t100\t\t\t14\t\t14\t\tnec\t1\t1\t44\tcharged\t70\t-20\t-6\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dim Vision\t100\t1\t1\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t71\t-60\t-8\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dim Vision\t100\t1\t1\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t71\t-20\t-5\t\t\t\t\t\t\t\t\t\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Weaken\t100\t1\t1\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t72\t-60\t-8\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Weaken\t100\t1\t1\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t72\t-20\t-5\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Poison Dagger\t100\t1\t1\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t73\t-60\t-8\t\t\t\t\t\t\t\t\t\tknif\thead\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Poison Dagger\t100\t1\t1\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t73\t-20\t-5\t\t\t\t\t\t\t\t\t\tglov\tring\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Corpse Explosions\t100\t\t\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t74\t-60\t-8\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Corpse Explosions\t100\t\t\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t74\t-20\t-5\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Clay Golem Summoning\t100\t\t\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t75\t-60\t-8\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Clay Golem Summoning\t100\t\t\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t75\t-20\t-5\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Iron Maiden\t100\t\t\t18\t\t18\t\tnec\t12\t1\t44\tcharged\t76\t-60\t-7\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Iron Maiden\t100\t\t\t36\t\t36\t\tnec\t12\t1\t44\tcharged\t76\t-20\t-4\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Terror\t100\t1\t1\t18\t\t18\t\tnec\t12\t1\t44\tcharged\t77\t-60\t-7\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Terror\t100\t1\t1\t36\t\t36\t\tnec\t12\t1\t44\tcharged\t77\t-20\t-4\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Walls\t100\t\t\t18\t\t18\t\tnec\t12\t1\t44\tcharged\t78\t-60\t-7\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Walls\t100\t\t\t36\t\t36\t\tnec\t12\t1\t44\tcharged\t78\t-20\t-4\t\t\t\t\t\t\t\t\t\tclub\tmace\tscep\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Raise Skeletal Mages\t100\t\t\t18\t\t18\t\tnec\t12\t1\t44\tcharged\t80\t-60\t-7\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Raise Skeletal Mages\t100\t\t\t36\t\t36\t\tnec\t12\t1\t44\tcharged\t80\t-20\t-4\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Confusion\t100\t1\t1\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t81\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Confusion\t100\t1\t1\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t81\t-20\t-3\t\t\t\t\t\t\t\t\t\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life Tap\t100\t1\t1\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t82\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Life Tap\t100\t1\t1\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t82\t-20\t-3\t\t\t\t\t\t\t\t\t\taxe\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Poison Explosion\t100\t\t\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t83\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Poison Explosion\t100\t\t\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t83\t-20\t-3\t\t\t\t\t\t\t\t\t\tblun\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Spears\t100\t1\t1\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t84\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Spears\t100\t1\t1\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t84\t-20\t-3\t\t\t\t\t\t\t\t\t\tspea\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blood Golem Summoning\t100\t\t\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t85\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blood Golem Summoning\t100\t\t\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t85\t-20\t-3\t\t\t\t\t\t\t\t\t\taxe\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Attraction\t100\t1\t1\t30\t\t30\t\tnec\t24\t1\t44\tcharged\t86\t-60\t-5\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Attraction\t100\t1\t1\t60\t\t60\t\tnec\t24\t1\t44\tcharged\t86\t-20\t-2\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Decrepification\t100\t\t\t30\t\t30\t\tnec\t24\t1\t44\tcharged\t87\t-60\t-5\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Decrepification\t100\t\t\t60\t\t60\t\tnec\t24\t1\t44\tcharged\t87\t-20\t-2\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Imprisonment\t100\t\t\t30\t\t30\t\tnec\t24\t1\t44\tcharged\t88\t-60\t-5\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Imprisonment\t100\t\t\t60\t\t60\t\tnec\t24\t1\t44\tcharged\t88\t-20\t-2\t\t\t\t\t\t\t\t\t\tmace\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Iron Golem Creation\t100\t\t\t30\t\t30\t\tnec\t24\t1\t44\tcharged\t90\t-60\t-5\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Iron Golem Creation\t100\t\t\t60\t\t60\t\tnec\t24\t1\t44\tcharged\t90\t-20\t-2\t\t\t\t\t\t\t\t\t\tswor\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lower Resistance\t100\t1\t1\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t91\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lower Resistance\t100\t1\t1\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t91\t-20\t-1\t\t\t\t\t\t\t\t\t\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Poison Novas\t100\t1\t1\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t92\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Poison Novas\t100\t1\t1\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t92\t-20\t-1\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Spirits\t100\t1\t1\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t93\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bone Spirits\t100\t1\t1\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t93\t-20\t-1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Golem Summoning\t100\t\t\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t94\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire Golem Summoning\t100\t\t\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t94\t-20\t-1\t\t\t\t\t\t\t\t\t\thamm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Revivification\t100\t\t\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t95\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Revivification\t100\t\t\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t95\t-20\t-1\t\t\t\t\t\t\t\t\t\tpole\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Sacrifice\t100\t1\t1\t7\t\t7\t\tpal\t1\t1\t44\tcharged\t96\t-30\t-10\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Sacrifice\t100\t1\t1\t14\t\t14\t\tpal\t1\t1\t44\tcharged\t96\t-20\t-6\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"of Holy Bolts\t100\t1\t1\t12\t\t12\t\tpal\t6\t1\t44\tcharged\t101\t-30\t-8\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Holy Bolts\t100\t1\t1\t24\t\t24\t\tpal\t6\t1\t44\tcharged\t101\t-20\t-5\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Zeal\t100\t1\t1\t18\t\t18\t\tpal\t12\t1\t44\tcharged\t106\t-30\t-7\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Zeal\t100\t1\t1\t36\t\t36\t\tpal\t12\t1\t44\tcharged\t106\t-20\t-4\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"of Vengeance\t100\t1\t1\t24\t\t24\t\tpal\t18\t1\t44\tcharged\t111\t-30\t-6\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Vengeance\t100\t1\t1\t48\t\t48\t\tpal\t18\t1\t44\tcharged\t111\t-20\t-3\t\t\t\t\t\t\t\t\t\tswor\taxe\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blessed Hammers\t100\t1\t1\t24\t\t24\t\tpal\t18\t1\t44\tcharged\t112\t-30\t-6\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blessed Hammers\t100\t1\t1\t48\t\t48\t\tpal\t18\t1\t44\tcharged\t112\t-20\t-3\t\t\t\t\t\t\t\t\t\thamm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Conversion\t100\t\t\t30\t\t30\t\tpal\t24\t1\t44\tcharged\t116\t-30\t-5\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Conversion\t100\t\t\t60\t\t60\t\tpal\t24\t1\t44\tcharged\t116\t-20\t-2\t\t\t\t\t\t\t\t\t\tblun\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n";
-                ss << u8"of Fist of the Heavens\t100\t\t\t36\t\t36\t\tpal\t30\t1\t44\tcharged\t121\t-30\t-3\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fist of the Heavens\t100\t\t\t72\t\t72\t\tpal\t30\t1\t44\tcharged\t121\t-20\t-1\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bashing\t100\t1\t1\t7\t\t7\t\tbar\t1\t1\t44\tcharged\t126\t-60\t-10\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Bashing\t100\t1\t1\t14\t\t14\t\tbar\t1\t1\t44\tcharged\t126\t-20\t-6\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Howling\t100\t\t\t7\t\t7\t\tbar\t1\t1\t44\tcharged\t130\t-60\t-10\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Howling\t100\t\t\t14\t\t14\t\tbar\t1\t1\t44\tcharged\t130\t-20\t-6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Potion Finding\t100\t\t\t7\t\t7\t\tbar\t1\t1\t44\tcharged\t131\t-60\t-10\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Potion Finding\t100\t\t\t14\t\t14\t\tbar\t1\t1\t44\tcharged\t131\t-20\t-6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Taunting\t100\t\t\t12\t\t12\t\tbar\t6\t1\t44\tcharged\t137\t-60\t-8\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Taunting\t100\t\t\t24\t\t24\t\tbar\t6\t1\t44\tcharged\t137\t-20\t-5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shouting\t100\t\t\t12\t\t12\t\tbar\t6\t1\t44\tcharged\t138\t-60\t-8\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shouting\t100\t\t\t24\t\t24\t\tbar\t6\t1\t44\tcharged\t138\t-20\t-5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Stunning\t100\t1\t1\t18\t\t18\t\tbar\t12\t1\t44\tcharged\t139\t-60\t-7\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Stunning\t100\t1\t1\t36\t\t36\t\tbar\t12\t1\t44\tcharged\t139\t-20\t-4\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Item Finding\t100\t\t\t18\t\t18\t\tbar\t12\t1\t44\tcharged\t142\t-60\t-7\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Item Finding\t100\t\t\t36\t\t36\t\tbar\t12\t1\t44\tcharged\t142\t-20\t-4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Concentration\t100\t1\t1\t24\t\t24\t\tbar\t18\t1\t44\tcharged\t144\t-60\t-6\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Concentration\t100\t1\t1\t48\t\t48\t\tbar\t18\t1\t44\tcharged\t144\t-20\t-3\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Battle Cry\t100\t\t\t24\t\t24\t\tbar\t18\t1\t44\tcharged\t146\t-60\t-6\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Battle Cry\t100\t\t\t48\t\t48\t\tbar\t18\t1\t44\tcharged\t146\t-20\t-3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Battle Orders\t100\t\t\t30\t\t30\t\tbar\t24\t1\t44\tcharged\t149\t-60\t-5\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Battle Orders\t100\t\t\t60\t\t60\t\tbar\t24\t1\t44\tcharged\t149\t-20\t-2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Grim Ward\t100\t1\t1\t30\t\t30\t\tbar\t24\t1\t44\tcharged\t150\t-60\t-5\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Grim Ward\t100\t1\t1\t60\t\t60\t\tbar\t24\t1\t44\tcharged\t150\t-20\t-2\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of War Cry\t100\t\t\t36\t\t36\t\tbar\t30\t1\t44\tcharged\t154\t-60\t-3\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of War Cry\t100\t\t\t72\t\t72\t\tbar\t30\t1\t44\tcharged\t154\t-20\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Battle Command\t100\t\t\t36\t\t36\t\tbar\t30\t1\t44\tcharged\t155\t-60\t-3\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Battle Command\t100\t\t\t72\t\t72\t\tbar\t30\t1\t44\tcharged\t155\t-20\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Firestorms\t100\t1\t1\t7\t\t7\t\tdru\t1\t1\t44\tcharged\t225\t-30\t-10\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Firestorms\t100\t1\t1\t14\t\t14\t\tdru\t1\t1\t44\tcharged\t225\t-20\t-6\t\t\t\t\t\t\t\t\t\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Molten Boulders\t100\t\t\t12\t\t12\t\tdru\t6\t1\t44\tcharged\t229\t-30\t-8\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Molten Boulders\t100\t\t\t24\t\t24\t\tdru\t6\t1\t44\tcharged\t229\t-20\t-5\t\t\t\t\t\t\t\t\t\tmace\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Eruption\t100\t1\t1\t18\t\t18\t\tdru\t12\t1\t44\tcharged\t234\t-30\t-7\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Eruption\t100\t1\t1\t36\t\t36\t\tdru\t12\t1\t44\tcharged\t234\t-20\t-4\t\t\t\t\t\t\t\t\t\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Cyclone Armor\t100\t\t\t18\t\t18\t\tdru\t12\t1\t44\tcharged\t235\t-30\t-7\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Cyclone Armor\t100\t\t\t36\t\t36\t\tdru\t12\t1\t44\tcharged\t235\t-20\t-4\t\t\t\t\t\t\t\t\t\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Twister\t100\t1\t1\t24\t\t24\t\tdru\t18\t1\t44\tcharged\t240\t-30\t-6\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Twister\t100\t1\t1\t48\t\t48\t\tdru\t18\t1\t44\tcharged\t240\t-20\t-3\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Volcano\t100\t1\t1\t30\t\t30\t\tdru\t24\t1\t44\tcharged\t244\t-30\t-6\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Volcano\t100\t1\t1\t60\t\t60\t\tdru\t24\t1\t44\tcharged\t244\t-20\t-3\t\t\t\t\t\t\t\t\t\thamm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Tornado\t100\t1\t1\t30\t\t30\t\tdru\t24\t1\t44\tcharged\t245\t-30\t-5\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Tornado\t100\t1\t1\t60\t\t60\t\tdru\t24\t1\t44\tcharged\t245\t-20\t-2\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Armageddon\t100\t\t\t36\t\t36\t\tdru\t30\t1\t44\tcharged\t249\t-30\t-3\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Armageddon\t100\t\t\t72\t\t72\t\tdru\t30\t1\t44\tcharged\t249\t-20\t-1\t\t\t\t\t\t\t\t\t\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Hurricane\t100\t\t\t36\t\t36\t\tdru\t30\t1\t44\tcharged\t250\t-30\t-3\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Hurricane\t100\t\t\t72\t\t72\t\tdru\t30\t1\t44\tcharged\t250\t-20\t-1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Damage Amplification\t100\t1\t1\t3\t\t\t\t\t\t1\t44\thit-skill\t66\t5\t1\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n";
-                ss << u8"of the Icicle\t100\t1\t1\t37\t\t29\t\t\t\t2\t10\tcold-min\t\t2\t3\tcold-max\t\t6\t10\tcold-len\t\t50\t50\tdblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Glacier\t100\t1\t\t58\t\t50\t\t\t\t2\t10\tcold-min\t\t4\t5\tcold-max\t\t11\t15\tcold-len\t\t50\t50\tdblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire\t100\t1\t1\t36\t\t28\t\t\t\t2\t12\tfire-min\t\t4\t10\tfire-max\t\t11\t30\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Burning\t100\t1\t1\t57\t\t49\t\t\t\t2\t12\tfire-min\t\t11\t25\tfire-max\t\t31\t50\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t100\t1\t1\t36\t\t28\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t21\t60\t\t\t\t\tdyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thunder\t100\t1\t1\t57\t\t49\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t61\t100\t\t\t\t\tdyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Daring\t100\t1\t1\t19\t\t14\t\t\t\t3\t17\tdex\t\t4\t6\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Daring\t100\t1\t1\t36\t\t28\t\t\t\t3\t17\tdex\t\t7\t9\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Knowledge\t100\t1\t1\t24\t\t18\t\t\t\t3\t23\tenr\t\t4\t6\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Knowledge\t100\t1\t1\t41\t\t33\t\t\t\t3\t23\tenr\t\t7\t9\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Virility\t100\t1\t1\t33\t\t25\t\t\t\t4\t31\tstr\t\t5\t6\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Virility\t100\t1\t1\t50\t\t42\t\t\t\t4\t31\tstr\t\t7\t9\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Readiness\t1\t1\t1\t20\t\t15\t\t\t\t2\t7\tswing1\t\t10\t10\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t100\t1\t1\t1\t\t1\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Quality\t100\t1\t1\t41\t\t33\t\t\t\t4\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Maiming\t100\t1\t\t71\t\t63\t\t\t\t4\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t100\t1\t1\t26\t\t19\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Quality\t100\t1\t\t56\t\t48\t\t\t\t4\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Craftsmanship\t100\t1\t1\t85\t\t77\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blight\t100\t1\t1\t1\t\t1\t\t\t\t2\t16\tdmg-pois\t75\t21\t21\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Venom\t100\t1\t1\t6\t\t4\t\t\t\t1\t16\tdmg-pois\t100\t39\t39\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Pestilence\t100\t1\t1\t14\t\t10\t\t\t\t1\t16\tdmg-pois\t125\t52\t52\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Anthrax\t100\t1\t\t21\t\t15\t\t\t\t1\t16\tdmg-pois\t150\t86\t86\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blight\t100\t1\t1\t5\t\t3\t\t\t\t2\t16\tdmg-pois\t75\t21\t21\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Venom\t100\t1\t1\t13\t\t9\t\t\t\t1\t16\tdmg-pois\t100\t39\t39\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Pestilence\t100\t1\t1\t23\t\t17\t\t\t\t1\t16\tdmg-pois\t125\t52\t52\t\t\t\t\t\t\t\t\tdgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Anthrax\t100\t1\t\t33\t\t25\t\t\t\t1\t16\tdmg-pois\t150\t86\t86\t\t\t\t\t\t\t\t\tdgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Blight\t100\t1\t1\t9\t\t6\t\t\t\t2\t16\tdmg-pois\t75\t21\t21\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Venom\t100\t1\t1\t20\t\t15\t\t\t\t1\t16\tdmg-pois\t100\t39\t39\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Pestilence\t100\t1\t1\t32\t\t24\t\t\t\t1\t16\tdmg-pois\t125\t52\t52\t\t\t\t\t\t\t\t\tdgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Anthrax\t100\t1\t\t44\t\t36\t\t\t\t1\t16\tdmg-pois\t150\t86\t86\t\t\t\t\t\t\t\t\tdgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost\t100\t1\t1\t5\t\t3\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t2\t2\tcold-len\t\t25\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Icicle\t100\t1\t1\t8\t\t6\t\t\t\t1\t10\tcold-min\t\t2\t2\tcold-max\t\t3\t4\tcold-len\t\t25\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Glacier\t100\t1\t1\t15\t\t11\t\t\t\t1\t10\tcold-min\t\t3\t3\tcold-max\t\t5\t7\tcold-len\t\t25\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Winter\t100\t1\t\t23\t\t17\t\t\t\t1\t10\tcold-min\t\t4\t6\tcold-max\t\t8\t11\tcold-len\t\t25\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost\t100\t1\t1\t9\t\t6\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t2\t3\tcold-len\t\t25\t25\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Icicle\t100\t1\t1\t15\t\t11\t\t\t\t1\t10\tcold-min\t\t2\t2\tcold-max\t\t4\t5\tcold-len\t\t25\t25\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Glacier\t100\t1\t1\t25\t\t18\t\t\t\t1\t10\tcold-min\t\t3\t3\tcold-max\t\t6\t8\tcold-len\t\t25\t25\tdblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Winter\t100\t1\t\t35\t\t27\t\t\t\t1\t10\tcold-min\t\t4\t6\tcold-max\t\t9\t12\tcold-len\t\t25\t25\tdblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost\t100\t1\t1\t14\t\t10\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t2\t2\tcold-len\t\t25\t25\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Icicle\t100\t1\t1\t21\t\t15\t\t\t\t1\t10\tcold-min\t\t2\t2\tcold-max\t\t3\t4\tcold-len\t\t25\t25\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Glacier\t100\t1\t1\t33\t\t25\t\t\t\t1\t10\tcold-min\t\t3\t3\tcold-max\t\t5\t6\tcold-len\t\t25\t25\tdblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Winter\t100\t1\t\t46\t\t38\t\t\t\t1\t10\tcold-min\t\t4\t5\tcold-max\t\t7\t9\tcold-len\t\t25\t25\tdblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Flame\t100\t1\t1\t3\t\t2\t\t\t\t2\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t2\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire\t100\t1\t1\t8\t\t6\t\t\t\t1\t12\tfire-min\t\t1\t2\tfire-max\t\t3\t3\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Burning\t100\t1\t1\t14\t\t10\t\t\t\t1\t12\tfire-min\t\t2\t3\tfire-max\t\t4\t7\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Incineration\t100\t1\t\t22\t\t16\t\t\t\t1\t12\tfire-min\t\t4\t7\tfire-max\t\t8\t14\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Flame\t100\t1\t1\t7\t\t5\t\t\t\t2\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t2\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire\t100\t1\t1\t14\t\t10\t\t\t\t1\t12\tfire-min\t\t2\t2\tfire-max\t\t3\t5\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Burning\t100\t1\t1\t24\t\t18\t\t\t\t1\t12\tfire-min\t\t3\t5\tfire-max\t\t6\t11\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Incineration\t100\t1\t\t34\t\t26\t\t\t\t1\t12\tfire-min\t\t6\t10\tfire-max\t\t12\t17\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Flame\t100\t1\t1\t11\t\t8\t\t\t\t2\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t2\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Fire\t100\t1\t1\t20\t\t15\t\t\t\t1\t12\tfire-min\t\t2\t2\tfire-max\t\t3\t4\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Burning\t100\t1\t1\t32\t\t24\t\t\t\t1\t12\tfire-min\t\t3\t4\tfire-max\t\t5\t8\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Incineration\t100\t1\t\t45\t\t37\t\t\t\t1\t12\tfire-min\t\t5\t7\tfire-max\t\t9\t13\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shock\t100\t1\t1\t4\t\t3\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t2\t3\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t100\t1\t1\t7\t\t5\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t4\t7\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thunder\t100\t1\t1\t15\t\t11\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t8\t21\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Storms\t100\t1\t\t22\t\t16\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t22\t33\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shock\t100\t1\t1\t7\t\t5\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t3\t5\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t100\t1\t1\t14\t\t10\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t6\t13\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thunder\t100\t1\t1\t24\t\t18\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t14\t25\t\t\t\t\tdyel\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Storms\t100\t1\t\t34\t\t26\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t26\t38\t\t\t\t\tdyel\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Shock\t100\t1\t1\t12\t\t9\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t3\t6\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Lightning\t100\t1\t1\t21\t\t15\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t7\t10\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thunder\t100\t1\t1\t33\t\t25\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t11\t18\t\t\t\t\tdyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Storms\t100\t1\t\t45\t\t37\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t19\t28\t\t\t\t\tdyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t1\t1\t1\t1\t12\t1\t\t\t\t4\t17\tdex\t\t1\t1\t\t\t\t\t\t\t\t\t\tboot\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Dexterity\t1\t1\t1\t1\t5\t1\t\t\t\t4\t17\tdex\t\t1\t1\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t1\t1\t1\t1\t11\t1\t\t\t\t4\t31\tstr\t\t1\t1\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Strength\t1\t1\t1\t1\t4\t1\t\t\t\t4\t31\tstr\t\t1\t1\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Thorns\t1\t1\t1\t1\t13\t1\t\t\t\t4\t6\tthorns\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\tbelt\tshld\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Frost\t1\t1\t1\t1\t3\t1\t\t\t\t4\t10\tdmg-cold\t25\t1\t1\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Flame\t1\t1\t1\t1\t3\t1\t\t\t\t4\t12\tdmg-fire\t\t1\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Blight\t1\t1\t1\t1\t4\t1\t\t\t\t4\t16\tdmg-pois\t50\t8\t8\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tscep\tstaf\torb\t\t\t0\t0\n";
-                ss << u8"of Shock\t1\t1\t1\t1\t3\t1\t\t\t\t4\t13\tdmg-ltng\t\t1\t3\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n";
-                ss << u8"of Regeneration\t1\t1\t1\t1\t9\t1\t\t\t\t3\t19\tregen\t\t2\t2\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Energy\t1\t1\t1\t1\t4\t1\t\t\t\t4\t23\tenr\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\thelm\tring\t\t\t\t\t\t0\t0\n";
-                ss << u8"of Light\t1\t1\t1\t1\t5\t1\t\t\t\t4\t25\tlight\t\t1\t1\tatt\t\t10\t10\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Leech\t100\t1\t1\t24\t\t20\t\t\t\t2\t27\tlifesteal\t\t2\t3\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Locust\t100\t1\t1\t57\t\t45\t\t\t\t2\t27\tlifesteal\t\t4\t5\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Lamprey\t100\t1\t1\t85\t\t73\t\t\t\t2\t27\tlifesteal\t\t6\t6\t\t\t\t\t\t\t\t\tcred\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Bat\t1\t1\t1\t25\t\t21\t\t\t\t2\t28\tmanasteal\t\t2\t3\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Wraith\t1\t1\t1\t58\t\t46\t\t\t\t2\t28\tmanasteal\t\t4\t5\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"of the Vampire\t100\t1\t1\t86\t\t74\t\t\t\t2\t28\tmanasteal\t\t6\t6\t\t\t\t\t\t\t\t\tcred\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"Name\tversion\tspawnable\trare\tlevel\tmaxlevel\tlevelreq\tclassspecific\tclass\tclasslevelreq\tfrequency\tgroup\tmod1code\tmod1param\tmod1min\tmod1max\tmod2code\tmod2param\tmod2min\tmod2max\tmod3code\tmod3param\tmod3min\tmod3max\ttransformcolor\titype1\titype2\titype3\titype4\titype5\titype6\titype7\tetype1\tetype2\tetype3\tetype4\tetype5\tmultiply\tadd\n",
+                u8"of Health\t0\t1\t1\t7\t\t5\t\t\t\t\t1\tred-dmg\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Protection\t0\t1\t1\t18\t\t13\t\t\t\t\t1\tred-dmg\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Absorption\t0\t1\t1\t26\t\t19\t\t\t\t\t1\tred-dmg\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t0\t1\t1\t35\t\t26\t\t\t\t\t1\tred-dmg\t\t4\t4\t\t\t\t\t\t\t\t\tdblu\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Warding\t0\t1\t1\t7\t\t5\t\t\t\t\t2\tred-mag\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Sentinel\t0\t1\t1\t18\t\t13\t\t\t\t\t2\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Guarding\t0\t1\t1\t26\t\t19\t\t\t\t\t2\tred-mag\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Negation\t0\t1\t1\t35\t\t26\t\t\t\t\t2\tred-mag\t\t4\t4\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Piercing\t0\t1\t1\t25\t\t18\t\t\t\t\t3\tignore-ac\t\t1\t1\t\t\t\t\t\t\t\t\t\trod\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bashing\t0\t1\t1\t16\t\t12\t\t\t\t\t4\tdmg-ac\t\t-25\t-40\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n",
+                u8"of Puncturing\t0\t1\t1\t6\t\t4\t\t\t\t\t4\tdmg-ac\t\t-10\t-20\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n",
+                u8"of Thorns\t0\t1\t1\t14\t\t10\t\t\t\t\t5\tthorns\t\t1\t3\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tbelt\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Spikes\t0\t1\t1\t21\t\t15\t\t\t\t\t5\tthorns\t\t2\t6\t\t\t\t\t\t\t\t\toran\ttors\thelm\tshld\tbelt\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Readiness\t0\t1\t1\t1\t\t1\t\t\t\t\t6\tswing1\t\t10\t10\t\t\t\t\t\t\t\t\t\tweap\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Alacrity\t0\t1\t1\t8\t\t6\t\t\t\t\t6\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Swiftness\t0\t1\t1\t19\t\t14\t\t\t\t\t6\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n",
+                u8"of Quickness\t0\t1\t1\t25\t\t18\t\t\t\t\t6\tswing3\t\t40\t40\t\t\t\t\t\t\t\t\tdyel\tmele\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n",
+                u8"of Blocking\t0\t1\t1\t1\t\t1\t\t\t\t\t7\tblock\t\t10\t10\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Deflecting\t0\t1\t1\t11\t\t8\t\t\t\t\t7\tblock\t\t20\t20\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Apprentice\t0\t1\t1\t5\t\t3\t\t\t\t\t8\tcast1\t\t10\t10\t\t\t\t\t\t\t\t\t\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Magus\t0\t1\t1\t17\t\t12\t\t\t\t\t8\tcast3\t\t20\t20\t\t\t\t\t\t\t\t\t\trod\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frost\t0\t1\t1\t4\t\t3\t\t\t\t\t9\tcold-min\t\t1\t1\tcold-max\t\t1\t4\tcold-len\t\t125\t125\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Glacier\t0\t1\t1\t18\t\t13\t\t\t\t\t9\tcold-min\t\t4\t4\tcold-max\t\t4\t12\tcold-len\t\t150\t150\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frost\t0\t1\t1\t55\t\t41\t\t\t\t\t9\tcold-min\t\t1\t1\tcold-max\t\t1\t4\tcold-len\t\t125\t125\t\tbelt\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Warmth\t0\t1\t1\t10\t\t7\t\t\t\t\t10\thalf-freeze\t\t1\t1\t\t\t\t\t\t\t\t\t\tshld\tboot\tglov\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Flame\t0\t1\t1\t4\t\t3\t\t\t\t\t11\tfire-min\t\t1\t1\tfire-max\t\t2\t6\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire\t0\t1\t1\t15\t\t11\t\t\t\t\t11\tfire-min\t\t2\t2\tfire-max\t\t6\t11\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Burning\t0\t1\t1\t25\t\t18\t\t\t\t\t11\tfire-min\t\t10\t10\tfire-max\t\t10\t20\t\t\t\t\tdred\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Flame\t0\t1\t1\t40\t\t30\t\t\t\t\t11\tfire-min\t\t1\t1\tfire-max\t\t2\t6\t\t\t\t\t\tglov\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shock\t0\t1\t1\t4\t\t3\t\t\t\t\t12\tltng-min\t\t1\t1\tltng-max\t\t8\t8\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning\t0\t1\t1\t15\t\t11\t\t\t\t\t12\tltng-min\t\t1\t1\tltng-max\t\t16\t16\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thunder\t0\t1\t1\t25\t\t18\t\t\t\t\t12\tltng-min\t\t1\t1\tltng-max\t\t32\t32\t\t\t\t\tdyel\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shock\t0\t1\t1\t50\t\t37\t\t\t\t\t12\tltng-min\t\t1\t1\tltng-max\t\t8\t8\t\t\t\t\t\tboot\tring\tamul\tweap\t\t\t\tmiss\trod\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t0\t1\t1\t1\t\t1\t\t\t\t\t13\tdmg-max\t\t1\t2\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Quality\t0\t1\t1\t4\t\t3\t\t\t\t\t13\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Maiming\t0\t1\t1\t7\t\t5\t\t\t\t\t13\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Slaying\t0\t1\t1\t11\t\t8\t\t\t\t\t13\tdmg-max\t\t5\t7\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Gore\t0\t1\t1\t14\t\t10\t\t\t\t\t13\tdmg-max\t\t8\t10\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Carnage\t0\t1\t1\t19\t\t14\t\t\t\t\t13\tdmg-max\t\t11\t14\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n",
+                u8"of Slaughter\t0\t1\t1\t25\t\t18\t\t\t\t\t13\tdmg-max\t\t15\t20\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n",
+                u8"of Maiming\t0\t1\t1\t42\t\t31\t\t\t\t\t13\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tshld\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Worth\t0\t1\t1\t2\t\t1\t\t\t\t\t14\tdmg-min\t\t1\t1\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"of Measure\t0\t1\t1\t6\t\t4\t\t\t\t\t14\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Excellence\t0\t1\t1\t12\t\t9\t\t\t\t\t14\tdmg-min\t\t3\t3\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Performance\t0\t1\t1\t18\t\t13\t\t\t\t\t14\tdmg-min\t\t4\t5\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Measure\t0\t1\t1\t37\t\t27\t\t\t\t\t14\tdmg-min\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\thelm\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blight\t0\t1\t1\t5\t\t3\t\t\t\t\t15\tpois-min\t\t8\t8\tpois-max\t\t24\t24\tpois-len\t\t75\t75\t\tweap\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"of Venom\t0\t1\t1\t15\t\t11\t\t\t\t\t15\tpois-min\t\t16\t16\tpois-max\t\t48\t48\tpois-len\t\t75\t75\t\tweap\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"of Pestilence\t0\t1\t1\t25\t\t18\t\t\t\t\t15\tpois-min\t\t32\t32\tpois-max\t\t72\t72\tpois-len\t\t100\t100\tdgrn\tweap\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"of Blight\t0\t1\t1\t45\t\t33\t\t\t\t\t15\tpois-min\t\t8\t8\tpois-max\t\t24\t24\tpois-len\t\t75\t75\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t0\t1\t1\t4\t\t3\t\t\t\t\t16\tdex\t\t1\t1\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t0\t1\t1\t5\t\t3\t\t\t\t\t16\tdex\t\t1\t3\t\t\t\t\t\t\t\t\t\tscep\tmiss\tboot\tglov\tring\tamul\t\t\t\t\t\t\t0\t0\n",
+                u8"of Skill\t0\t1\t1\t10\t\t7\t\t\t\t\t16\tdex\t\t4\t6\t\t\t\t\t\t\t\t\t\tscep\tmiss\tboot\tglov\tring\tamul\t\t\t\t\t\t\t0\t0\n",
+                u8"of Skill\t0\t1\t1\t45\t\t33\t\t\t\t\t16\tdex\t\t4\t6\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\tboot\tglov\t\t\t\t0\t0\n",
+                u8"of Accuracy\t0\t1\t1\t18\t\t13\t\t\t\t\t16\tdex\t\t7\t10\t\t\t\t\t\t\t\t\t\tscep\tmiss\tboot\tglov\tring\tamul\t\t\t\t\t\t\t0\t0\n",
+                u8"of Precision\t0\t1\t1\t22\t\t16\t\t\t\t\t16\tdex\t\t11\t15\t\t\t\t\t\t\t\t\t\tscep\tmiss\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Precision\t0\t1\t1\t60\t\t45\t\t\t\t\t16\tdex\t\t11\t15\t\t\t\t\t\t\t\t\t\tarmo\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Perfection\t0\t1\t1\t30\t\t22\t\t\t\t\t16\tdex\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tmiss\tglov\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Balance\t0\t1\t1\t5\t\t3\t\t\t\t\t17\tbalance1\t\t10\t10\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"of Stability\t0\t1\t1\t9\t\t6\t\t\t\t\t17\tbalance3\t\t20\t20\t\t\t\t\t\t\t\t\tdyel\tarmo\t\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Regeneration\t0\t1\t1\t10\t\t7\t\t\t\t\t19\tregen\t\t3\t3\t\t\t\t\t\t\t\t\t\tscep\tbelt\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Regeneration\t0\t1\t1\t40\t\t30\t\t\t\t\t19\tregen\t\t3\t3\t\t\t\t\t\t\t\t\t\tshld\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Regeneration\t0\t1\t1\t70\t\t52\t\t\t\t\t19\tregen\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\thelm\tweap\tboot\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"of Regrowth\t0\t1\t1\t17\t\t12\t\t\t\t\t19\tregen\t\t5\t5\t\t\t\t\t\t\t\t\tcred\tscep\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Regrowth\t0\t1\t1\t55\t\t41\t\t\t\t\t19\tregen\t\t5\t5\t\t\t\t\t\t\t\t\tcred\tbelt\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Vileness\t0\t1\t1\t9\t\t6\t\t\t\t\t20\tnoheal\t\t1\t1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Greed\t0\t1\t1\t2\t\t1\t\t\t\t\t22\tgold%\t\t40\t60\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Wealth\t0\t1\t1\t17\t\t12\t\t\t\t\t22\tgold%\t\t80\t120\t\t\t\t\t\t\t\t\tlgld\tboot\tglov\tbelt\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Chance\t0\t1\t1\t12\t\t9\t\t\t\t\t23\tmag%\t\t10\t19\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fortune\t0\t1\t1\t16\t\t12\t\t\t\t\t23\tmag%\t\t20\t35\t\t\t\t\t\t\t\t\tlgld\tboot\tglov\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Energy\t0\t1\t1\t4\t\t3\t\t\t\t\t24\tmana\t\t1\t1\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Energy\t0\t1\t1\t5\t\t3\t\t\t\t\t24\tmana\t\t1\t5\t\t\t\t\t\t\t\t\t\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Mind\t0\t1\t1\t10\t\t7\t\t\t\t\t24\tmana\t\t6\t10\t\t\t\t\t\t\t\t\t\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Brilliance\t0\t1\t1\t18\t\t13\t\t\t\t\t24\tmana\t\t11\t15\t\t\t\t\t\t\t\t\t\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Sorcery\t0\t1\t1\t22\t\t16\t\t\t\t\t24\tmana\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\trod\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Wizardry\t0\t1\t1\t30\t\t22\t\t\t\t\t24\tmana\t\t21\t30\t\t\t\t\t\t\t\t\tdgld\trod\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Bear\t0\t1\t1\t8\t\t6\t\t\t\t\t25\tknock\t\t1\t1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Light\t0\t1\t1\t6\t\t4\t\t\t\t\t26\tlight\t\t1\t1\t\t\t\t\t\t\t\t\t\tarmo\trod\tmiss\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Radiance\t0\t1\t1\t15\t\t11\t\t\t\t\t26\tlight\t\t3\t3\t\t\t\t\t\t\t\t\t\trod\tmiss\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Sun\t0\t1\t1\t17\t\t12\t\t\t\t\t26\tlight\t\t5\t5\t\t\t\t\t\t\t\t\t\trod\tmiss\tglov\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t0\t1\t1\t23\t\t17\t\t\t\t\t27\thp\t\t5\t5\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tbelt\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Jackal\t0\t1\t1\t3\t\t2\t\t\t\t\t27\thp\t\t1\t5\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Fox\t0\t1\t1\t6\t\t4\t\t\t\t\t27\thp\t\t5\t10\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Wolf\t0\t1\t1\t14\t\t10\t\t\t\t\t27\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Wolf\t0\t1\t1\t45\t\t33\t\t\t\t\t27\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"of the Tiger\t0\t1\t1\t20\t\t15\t\t\t\t\t27\thp\t\t21\t30\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Mammoth\t0\t1\t1\t24\t\t18\t\t\t\t\t27\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\ttors\thelm\tshld\tring\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Mammoth\t0\t1\t1\t60\t\t45\t\t\t\t\t27\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\tmele\tglov\tbelt\t\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"of the Colosuss\t0\t1\t1\t30\t\t22\t\t\t\t\t27\thp\t\t41\t60\t\t\t\t\t\t\t\t\tcred\ttors\thelm\tshld\tbelt\tamul\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Leech\t0\t1\t1\t6\t\t4\t\t\t\t\t28\tlifesteal\t\t4\t7\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Locust\t0\t1\t1\t20\t\t15\t\t\t\t\t28\tlifesteal\t\t8\t10\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Bat\t0\t1\t1\t6\t\t4\t\t\t\t\t29\tmanasteal\t\t4\t8\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Vampire\t0\t1\t1\t20\t\t15\t\t\t\t\t29\tmanasteal\t\t9\t12\t\t\t\t\t\t\t\t\tcblu\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Defiance\t0\t1\t1\t25\t\t18\t\t\t\t\t30\tres-pois-len\t\t75\t75\t\t\t\t\t\t\t\t\tdred\ttors\thelm\tshld\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Amelioration\t0\t1\t1\t18\t\t13\t\t\t\t\t30\tres-pois-len\t\t50\t50\t\t\t\t\t\t\t\t\t\ttors\thelm\tshld\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Remedy\t0\t1\t1\t7\t\t5\t\t\t\t\t30\tres-pois-len\t\t25\t25\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Simplicity\t0\t1\t1\t25\t\t18\t\t\t\t\t32\tease\t\t-40\t-40\t\t\t\t\t\t\t\t\t\ttors\thelm\tweap\tshld\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"of Ease\t0\t1\t1\t15\t\t11\t\t\t\t\t32\tease\t\t-20\t-20\t\t\t\t\t\t\t\t\t\ttors\thelm\tweap\tshld\t\t\t\trod\t\t\t\t\t0\t0\n",
+                u8"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t0\t1\t1\t5\t\t3\t\t\t\t\t34\tstr\t\t1\t3\t\t\t\t\t\t\t\t\t\tbelt\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Might\t0\t1\t1\t10\t\t7\t\t\t\t\t34\tstr\t\t4\t6\t\t\t\t\t\t\t\t\t\tmele\tshld\tring\tamul\t\t\t\twand\tstaf\t\t\t\t0\t0\n",
+                u8"of the Ox\t0\t1\t1\t18\t\t13\t\t\t\t\t34\tstr\t\t7\t10\t\t\t\t\t\t\t\t\t\tmele\tbelt\tring\tamul\t\t\t\twand\tstaf\t\t\t\t0\t0\n",
+                u8"of the Ox\t0\t1\t1\t47\t\t35\t\t\t\t\t34\tstr\t\t7\t10\t\t\t\t\t\t\t\t\t\tshld\tboot\tglov\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Giant\t0\t1\t1\t22\t\t16\t\t\t\t\t34\tstr\t\t11\t15\t\t\t\t\t\t\t\t\tdgld\tmele\tbelt\tamul\t\t\t\t\twand\tstaf\t\t\t\t0\t0\n",
+                u8"of the Giant\t0\t1\t1\t62\t\t46\t\t\t\t\t34\tstr\t\t11\t15\t\t\t\t\t\t\t\t\tdgld\tboot\tglov\tring\tshld\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Titan\t0\t1\t1\t30\t\t22\t\t\t\t\t34\tstr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tboot\tbelt\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Pacing\t0\t1\t1\t2\t\t1\t\t\t\t\t35\tmove1\t\t10\t10\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Haste\t0\t1\t1\t12\t\t9\t\t\t\t\t35\tmove2\t\t20\t20\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Speed\t0\t1\t1\t22\t\t16\t\t\t\t\t35\tmove3\t\t30\t30\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n",
+                u8"of Health\t1\t1\t1\t7\t\t5\t\t\t\t4\t1\tred-dmg\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\tshld\tring\tamul\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Protection\t1\t1\t1\t18\t\t13\t\t\t\t4\t1\tred-dmg\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Absorption\t1\t1\t1\t26\t\t19\t\t\t\t4\t1\tred-dmg\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t1\t1\t1\t35\t\t26\t\t\t\t4\t1\tred-dmg\t\t4\t4\t\t\t\t\t\t\t\t\tdblu\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life Everlasting\t100\t1\t\t45\t\t37\t\t\t\t4\t1\tred-dmg\t\t10\t25\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Protection\t1\t1\t1\t24\t\t18\t\t\t\t4\t1\tred-dmg\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Absorption\t1\t1\t1\t32\t\t24\t\t\t\t4\t1\tred-dmg\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t1\t1\t1\t41\t\t33\t\t\t\t4\t1\tred-dmg\t\t4\t7\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Anima\t100\t1\t\t51\t\t43\t\t\t\t4\t1\tred-dmg\t\t8\t15\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Warding\t1\t1\t1\t7\t\t5\t\t\t\t4\t2\tred-mag\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\tshld\tring\tamul\torb\tcirc\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Sentinel\t1\t1\t1\t18\t\t12\t\t\t\t4\t2\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Guarding\t1\t1\t1\t26\t\t19\t\t\t\t4\t2\tred-mag\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Negation\t100\t1\t\t42\t\t35\t\t\t\t4\t2\tred-mag\t\t4\t6\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Sentinel\t1\t1\t1\t24\t\t18\t\t\t\t4\t2\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Guarding\t1\t1\t1\t32\t\t24\t\t\t\t4\t2\tred-mag\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Negation\t100\t1\t\t41\t\t33\t\t\t\t4\t2\tred-mag\t\t4\t6\t\t\t\t\t\t\t\t\t\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Coolness\t100\t\t1\t11\t\t8\t\t\t\t1\t3\tabs-fire\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Incombustibility\t100\t\t1\t19\t\t14\t\t\t\t1\t3\tabs-fire\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Amianthus\t100\t\t1\t28\t\t21\t\t\t\t1\t3\tabs-fire\t\t4\t5\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Quenching\t100\t\t\t38\t\t30\t\t\t\t1\t3\tabs-fire\t\t6\t8\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Coolness\t100\t\t1\t13\t\t9\t\t\t\t1\t3\tabs-fire\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Incombustibility\t100\t\t1\t22\t\t16\t\t\t\t1\t3\tabs-fire\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Amianthus\t100\t\t1\t33\t\t25\t\t\t\t1\t3\tabs-fire\t\t4\t5\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Quenching\t100\t\t\t46\t\t38\t\t\t\t1\t3\tabs-fire\t\t6\t8\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Faith\t100\t\t1\t23\t\t17\t\t\t\t1\t3\tabs-fire\t\t1\t2\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Resistance\t100\t\t1\t11\t\t8\t\t\t\t1\t3\tabs-ltng\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Insulation\t100\t\t1\t19\t\t14\t\t\t\t1\t3\tabs-ltng\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Grounding\t100\t\t1\t28\t\t21\t\t\t\t1\t3\tabs-ltng\t\t4\t5\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Dynamo\t100\t\t\t38\t\t30\t\t\t\t1\t3\tabs-ltng\t\t6\t8\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Resistance\t100\t\t1\t13\t\t9\t\t\t\t1\t3\tabs-ltng\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Insulation\t100\t\t1\t22\t\t16\t\t\t\t1\t3\tabs-ltng\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Grounding\t100\t\t1\t33\t\t25\t\t\t\t1\t3\tabs-ltng\t\t4\t5\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Dynamo\t100\t\t\t46\t\t38\t\t\t\t1\t3\tabs-ltng\t\t6\t8\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Stoicism\t100\t\t1\t22\t\t16\t\t\t\t1\t3\tabs-ltng\t\t1\t2\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Warming\t100\t\t1\t11\t\t8\t\t\t\t1\t3\tabs-cold\t\t2\t2\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thawing\t100\t\t1\t19\t\t14\t\t\t\t1\t3\tabs-cold\t\t3\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Dunes\t100\t\t1\t28\t\t21\t\t\t\t1\t3\tabs-cold\t\t4\t5\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Sirocco\t100\t\t\t38\t\t30\t\t\t\t1\t3\tabs-cold\t\t6\t8\t\t\t\t\t\t\t\t\t\ttors\tshld\tboot\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Warming\t100\t\t1\t13\t\t9\t\t\t\t1\t3\tabs-cold\t\t2\t2\t\t\t\t\t\t\t\t\t\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thawing\t100\t\t1\t22\t\t16\t\t\t\t1\t3\tabs-cold\t\t3\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Dunes\t100\t\t1\t33\t\t25\t\t\t\t1\t3\tabs-cold\t\t4\t5\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Sirocco\t100\t\t\t46\t\t38\t\t\t\t1\t3\tabs-cold\t\t6\t8\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Desire\t100\t\t1\t23\t\t17\t\t\t\t1\t3\tabs-cold\t\t1\t2\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Piercing\t1\t1\t1\t25\t\t18\t\t\t\t2\t4\tignore-ac\t\t1\t1\t\t\t\t\t\t\t\t\t\trod\tknif\th2h\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bashing\t100\t\t1\t16\t\t12\t\t\t\t4\t5\tdmg-ac\t\t-25\t-40\t\t\t\t\t\t\t\t\t\tblun\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Puncturing\t100\t\t1\t6\t\t4\t\t\t\t4\t5\tdmg-ac\t\t-10\t-20\t\t\t\t\t\t\t\t\t\tspea\tknif\th2h\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thorns\t1\t1\t1\t14\t\t10\t\t\t\t4\t6\tthorns\t\t1\t3\t\t\t\t\t\t\t\t\t\ttors\tshld\tbelt\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Spikes\t1\t1\t1\t21\t\t15\t\t\t\t4\t6\tthorns\t\t4\t6\t\t\t\t\t\t\t\t\toran\ttors\tshld\tbelt\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Razors\t100\t1\t1\t34\t\t26\t\t\t\t4\t6\tthorns\t\t7\t9\t\t\t\t\t\t\t\t\toran\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Swords\t100\t1\t\t47\t\t39\t\t\t\t4\t6\tthorns\t\t10\t20\t\t\t\t\t\t\t\t\toran\ttors\tshld\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Malice\t100\t1\t1\t37\t\t29\t\t\t\t4\t6\tthorns\t\t1\t5\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Readiness\t1\t1\t1\t5\t\t3\t\t\t\t6\t7\tswing1\t\t10\t10\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Alacrity\t1\t1\t1\t25\t\t17\t\t\t\t6\t7\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Swiftness\t1\t1\t1\t34\t\t26\t\t\t\t6\t7\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Quickness\t1\t1\t1\t46\t\t38\t\t\t\t5\t7\tswing3\t\t40\t40\t\t\t\t\t\t\t\t\tdyel\tmele\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Alacrity\t100\t1\t1\t43\t\t35\t\t\t\t4\t7\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\tdyel\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fervor\t100\t1\t\t39\t\t31\t\t\t\t4\t7\tswing1\t\t15\t15\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blocking\t1\t1\t1\t1\t\t1\t\t\t\t7\t8\tblock\t\t10\t10\tblock2\t\t15\t15\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Deflecting\t1\t1\t1\t11\t\t8\t\t\t\t6\t8\tblock\t\t20\t20\tblock2\t\t30\t30\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Apprentice\t1\t1\t1\t5\t\t3\t\t\t\t6\t9\tcast1\t\t10\t10\t\t\t\t\t\t\t\t\t\trod\tring\tamul\torb\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Magus\t1\t1\t1\t29\t\t21\t\t\t\t5\t9\tcast3\t\t20\t20\t\t\t\t\t\t\t\t\t\trod\torb\tcirc\t\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"of Frost\t1\t1\t1\t4\t\t3\t\t\t\t5\t10\tcold-min\t\t1\t1\tcold-max\t\t1\t2\tcold-len\t\t50\t50\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of the Icicle\t100\t1\t1\t13\t\t9\t\t\t\t4\t10\tcold-min\t\t1\t1\tcold-max\t\t3\t4\tcold-len\t\t75\t75\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of the Glacier\t1\t1\t1\t27\t\t20\t\t\t\t3\t10\tcold-min\t\t2\t4\tcold-max\t\t4\t15\tcold-len\t\t100\t100\tdblu\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Winter\t100\t1\t1\t45\t\t37\t\t\t\t2\t10\tcold-min\t\t5\t9\tcold-max\t\t16\t50\tcold-len\t\t150\t150\tdblu\tmele\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Frost\t1\t1\t1\t55\t\t41\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t3\t6\tcold-len\t\t50\t50\t\tbelt\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frigidity\t100\t1\t1\t16\t\t12\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t3\t5\tcold-len\t\t50\t50\tdblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Warmth\t1\t1\t1\t10\t\t7\t\t\t\t4\t11\thalf-freeze\t\t1\t1\t\t\t\t\t\t\t\t\t\tshld\tboot\tglov\tring\tamul\tcirc\torb\t\t\t\t\t\t0\t0\n",
+                u8"of Flame\t1\t1\t1\t4\t\t3\t\t\t\t5\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t5\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Fire\t1\t1\t1\t15\t\t11\t\t\t\t4\t12\tfire-min\t\t1\t4\tfire-max\t\t6\t11\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Burning\t1\t1\t1\t25\t\t18\t\t\t\t3\t12\tfire-min\t\t5\t9\tfire-max\t\t10\t20\t\t\t\t\tdred\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Incineration\t100\t1\t1\t43\t\t35\t\t\t\t2\t12\tfire-min\t\t10\t20\tfire-max\t\t21\t75\t\t\t\t\tdred\tmele\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Flame\t100\t1\t1\t40\t\t30\t\t\t\t2\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t6\t\t\t\t\t\tglov\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Passion\t100\t1\t1\t15\t\t11\t\t\t\t2\t12\tfire-min\t\t1\t3\tfire-max\t\t6\t10\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shock\t1\t1\t1\t4\t\t3\t\t\t\t5\t13\tltng-min\t\t1\t1\tltng-max\t\t6\t8\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Lightning\t1\t1\t1\t15\t\t11\t\t\t\t4\t13\tltng-min\t\t1\t1\tltng-max\t\t9\t16\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Thunder\t1\t1\t1\t25\t\t18\t\t\t\t3\t13\tltng-min\t\t1\t1\tltng-max\t\t17\t40\t\t\t\t\tdyel\tweap\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Storms\t100\t1\t1\t34\t\t26\t\t\t\t2\t13\tltng-min\t\t1\t6\tltng-max\t\t41\t120\t\t\t\t\tdyel\tmele\t\t\t\t\t\t\twand\torb\t\t\t\t0\t0\n",
+                u8"of Shock\t100\t1\t1\t50\t\t37\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t11\t23\t\t\t\t\t\tboot\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Ennui\t100\t1\t1\t15\t\t11\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t10\t20\t\t\t\t\tdyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t1\t1\t1\t1\t\t1\t\t\t\t8\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Quality\t1\t1\t1\t4\t\t3\t\t\t\t8\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Maiming\t1\t1\t1\t7\t\t5\t\t\t\t7\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Slaying\t1\t1\t1\t11\t\t8\t\t\t\t7\t14\tdmg-max\t\t5\t7\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Gore\t1\t1\t1\t14\t\t10\t\t\t\t6\t14\tdmg-max\t\t8\t10\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Carnage\t1\t1\t1\t19\t\t14\t\t\t\t6\t14\tdmg-max\t\t11\t14\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Slaughter\t1\t1\t1\t25\t\t18\t\t\t\t5\t14\tdmg-max\t\t15\t20\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Butchery\t100\t1\t\t35\t\t27\t\t\t\t5\t14\tdmg-max\t\t21\t40\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Evisceration\t100\t1\t\t45\t\t37\t\t\t\t4\t14\tdmg-max\t\t41\t63\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\twand\tstaf\torb\t\t\t0\t0\n",
+                u8"of Maiming\t1\t1\t1\t42\t\t34\t\t\t\t4\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tshld\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t100\t1\t1\t1\t7\t1\t\t\t\t4\t14\tdmg-max\t\t1\t2\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t100\t1\t1\t8\t14\t6\t\t\t\t4\t14\tdmg-max\t\t2\t3\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t100\t1\t1\t15\t\t11\t\t\t\t4\t14\tdmg-max\t\t4\t5\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Quality\t100\t1\t1\t23\t29\t17\t\t\t\t4\t14\tdmg-max\t\t6\t7\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Quality\t100\t1\t1\t30\t\t22\t\t\t\t4\t14\tdmg-max\t\t7\t8\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Maiming\t100\t1\t\t37\t44\t29\t\t\t\t4\t14\tdmg-max\t\t9\t10\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Maiming\t100\t1\t\t45\t\t37\t\t\t\t4\t14\tdmg-max\t\t11\t12\t\t\t\t\t\t\t\t\t\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t100\t0\t1\t8\t17\t6\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t100\t0\t1\t18\t\t13\t\t\t\t4\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Quality\t100\t0\t1\t28\t37\t21\t\t\t\t4\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Quality\t100\t0\t1\t38\t\t30\t\t\t\t4\t14\tdmg-max\t\t5\t6\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Maiming\t100\t0\t\t48\t\t40\t\t\t\t4\t14\tdmg-max\t\t7\t8\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t100\t0\t1\t21\t\t15\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Quality\t100\t0\t1\t36\t\t28\t\t\t\t4\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Maiming\t100\t0\t\t51\t\t43\t\t\t\t4\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Ire\t100\t1\t1\t4\t\t3\t\t\t\t4\t14\tdmg-max\t\t2\t5\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Wrath\t100\t1\t1\t11\t\t8\t\t\t\t4\t14\tdmg-max\t\t6\t9\t\t\t\t\t\t\t\t\tblac\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Carnage\t100\t1\t\t25\t\t18\t\t\t\t4\t14\tdmg-max\t\t11\t15\t\t\t\t\t\t\t\t\tblac\tjewl\t\t\t\t\t\t\t\t\t\t\t\t\t\n",
+                u8"of Worth\t1\t1\t1\t1\t\t1\t\t\t\t8\t15\tdmg-min\t\t1\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Measure\t1\t1\t1\t12\t\t9\t\t\t\t7\t15\tdmg-min\t\t3\t4\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Excellence\t1\t1\t1\t24\t\t18\t\t\t\t6\t15\tdmg-min\t\t5\t8\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Performance\t1\t1\t1\t48\t\t40\t\t\t\t5\t15\tdmg-min\t\t9\t14\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Transcendence\t100\t1\t1\t76\t\t68\t\t\t\t4\t15\tdmg-min\t\t15\t20\t\t\t\t\t\t\t\t\tblac\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Worth\t1\t1\t1\t15\t\t11\t\t\t\t4\t15\tdmg-min\t\t2\t3\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Measure\t1\t1\t1\t37\t\t29\t\t\t\t4\t15\tdmg-min\t\t4\t5\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Excellence\t1\t1\t1\t59\t\t51\t\t\t\t4\t15\tdmg-min\t\t6\t9\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Performance\t100\t1\t\t81\t\t73\t\t\t\t4\t15\tdmg-min\t\t10\t13\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Joyfulness\t100\t1\t1\t5\t\t3\t\t\t\t4\t15\tdmg-min\t\t1\t4\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bliss\t100\t1\t1\t43\t\t37\t\t\t\t4\t15\tdmg-min\t\t5\t10\t\t\t\t\t\t\t\t\twhit\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blight\t1\t1\t1\t5\t\t3\t\t\t\t5\t16\tdmg-pois\t75\t24\t24\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n",
+                u8"of Venom\t1\t1\t1\t15\t\t11\t\t\t\t4\t16\tdmg-pois\t100\t54\t54\t\t\t\t\t\t\t\t\t\tweap\tcirc\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n",
+                u8"of Pestilence\t1\t1\t1\t25\t\t18\t\t\t\t3\t16\tdmg-pois\t125\t103\t103\t\t\t\t\t\t\t\t\tdgrn\tweap\tcirc\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n",
+                u8"of Anthrax\t100\t1\t1\t33\t\t25\t\t\t\t2\t16\tdmg-pois\t150\t171\t171\t\t\t\t\t\t\t\t\tdgrn\tweap\t\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n",
+                u8"of Blight\t100\t1\t1\t45\t\t33\t\t\t\t2\t16\tdmg-pois\t75\t171\t171\t\t\t\t\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Envy\t100\t1\t1\t1\t\t1\t\t\t\t2\t16\tdmg-pois\t50\t103\t103\t\t\t\t\t\t\t\t\tdgrn\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t1\t1\t1\t1\t\t1\t\t\t\t4\t17\tdex\t\t1\t2\t\t\t\t\t\t\t\t\t\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Skill\t1\t1\t1\t11\t\t8\t\t\t\t3\t17\tdex\t\t3\t5\t\t\t\t\t\t\t\t\t\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Accuracy\t1\t1\t1\t27\t\t20\t\t\t\t3\t17\tdex\t\t6\t9\t\t\t\t\t\t\t\t\t\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Precision\t1\t1\t1\t43\t\t35\t\t\t\t3\t17\tdex\t\t10\t15\t\t\t\t\t\t\t\t\t\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Perfection\t1\t1\t1\t59\t\t51\t\t\t\t3\t17\tdex\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Nirvana\t100\t1\t\t72\t\t64\t\t\t\t3\t17\tdex\t\t21\t30\t\t\t\t\t\t\t\t\tdgld\tamul\tmiss\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t1\t1\t1\t6\t\t4\t\t\t\t4\t17\tdex\t\t1\t2\t\t\t\t\t\t\t\t\t\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Skill\t1\t1\t1\t22\t\t16\t\t\t\t3\t17\tdex\t\t3\t5\t\t\t\t\t\t\t\t\t\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Accuracy\t1\t1\t1\t39\t\t31\t\t\t\t3\t17\tdex\t\t6\t9\t\t\t\t\t\t\t\t\t\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Precision\t1\t1\t1\t56\t\t48\t\t\t\t3\t17\tdex\t\t10\t15\t\t\t\t\t\t\t\t\t\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Perfection\t100\t1\t\t75\t\t67\t\t\t\t3\t17\tdex\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tring\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t1\t1\t1\t13\t\t9\t\t\t\t3\t17\tdex\t\t2\t3\t\t\t\t\t\t\t\t\t\ttors\tboot\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"of Skill\t1\t1\t1\t34\t\t26\t\t\t\t3\t17\tdex\t\t4\t5\t\t\t\t\t\t\t\t\t\ttors\tboot\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"of Accuracy\t1\t1\t1\t46\t\t38\t\t\t\t3\t17\tdex\t\t6\t9\t\t\t\t\t\t\t\t\t\ttors\tboot\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"of Precision\t100\t1\t\t60\t\t52\t\t\t\t3\t17\tdex\t\t10\t15\t\t\t\t\t\t\t\t\tdgld\ttors\tboot\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t100\t1\t1\t1\t\t1\t\t\t\t4\t31\tdex\t\t3\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t100\t1\t1\t3\t\t2\t\t\t\t4\t31\tdex\t\t2\t3\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t100\t1\t1\t7\t\t5\t\t\t\t4\t31\tdex\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t100\t1\t1\t14\t\t10\t\t\t\t4\t31\tdex\t\t5\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t100\t1\t1\t18\t\t13\t\t\t\t4\t31\tdex\t\t4\t5\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t100\t1\t1\t22\t\t16\t\t\t\t4\t31\tdex\t\t2\t2\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Daring\t100\t1\t1\t7\t\t5\t\t\t\t3\t17\tdex\t\t1\t3\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Balance\t1\t1\t1\t5\t\t3\t\t\t\t4\t18\tbalance1\t\t10\t10\t\t\t\t\t\t\t\t\t\tarmo\t\t\t\t\t\t\tglov\t\t\t\t\t0\t0\n",
+                u8"of Equilibrium\t1\t1\t1\t9\t\t6\t\t\t\t4\t18\tbalance2\t\t17\t17\t\t\t\t\t\t\t\t\t\ttors\tbelt\tshld\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Stability\t1\t1\t1\t18\t\t13\t\t\t\t4\t18\tbalance3\t\t24\t24\t\t\t\t\t\t\t\t\tdyel\ttors\tbelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Balance\t100\t1\t1\t1\t\t1\t\t\t\t4\t18\tbalance3\t\t12\t12\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Balance\t100\t1\t1\t19\t\t14\t\t\t\t4\t18\tbalance2\t\t8\t8\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Balance\t100\t1\t1\t37\t\t29\t\t\t\t4\t18\tbalance1\t\t5\t5\t\t\t\t\t\t\t\t\tdyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Truth\t100\t1\t1\t44\t\t36\t\t\t\t4\t18\tbalance1\t\t7\t7\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Regeneration\t1\t1\t1\t10\t\t7\t\t\t\t4\t19\tregen\t\t3\t5\t\t\t\t\t\t\t\t\t\tscep\tbelt\tring\tamul\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Regeneration\t1\t1\t1\t40\t\t30\t\t\t\t4\t19\tregen\t\t3\t5\t\t\t\t\t\t\t\t\t\tshld\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Regeneration\t1\t1\t1\t70\t\t52\t\t\t\t4\t19\tregen\t\t3\t5\t\t\t\t\t\t\t\t\t\ttors\tweap\tboot\t\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"of Regrowth\t1\t1\t1\t17\t\t12\t\t\t\t4\t19\tregen\t\t6\t10\t\t\t\t\t\t\t\t\tcred\tscep\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Regrowth\t1\t1\t1\t55\t\t41\t\t\t\t4\t19\tregen\t\t6\t9\t\t\t\t\t\t\t\t\tcred\tbelt\tring\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Revivification\t100\t1\t\t38\t\t30\t\t\t\t4\t19\tregen\t\t11\t15\t\t\t\t\t\t\t\t\tcred\tscep\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Honor\t100\t1\t1\t47\t\t35\t\t\t\t4\t19\tregen\t\t1\t4\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Vileness\t1\t1\t1\t9\t\t6\t\t\t\t3\t20\tnoheal\t\t1\t1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\trod\torb\t\t\t\t0\t0\n",
+                u8"of Greed\t1\t1\t1\t1\t\t1\t\t\t\t4\t21\tgold%\t\t25\t40\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Wealth\t1\t1\t1\t17\t\t12\t\t\t\t4\t21\tgold%\t\t41\t80\t\t\t\t\t\t\t\t\tlgld\tboot\tglov\tbelt\tamul\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Greed\t100\t1\t1\t1\t\t1\t\t\t\t4\t21\tgold%\t\t10\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Greed\t100\t1\t1\t7\t\t5\t\t\t\t4\t21\tgold%\t\t21\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Greed\t100\t1\t1\t19\t\t14\t\t\t\t4\t21\tgold%\t\t31\t40\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Greed\t100\t1\t1\t1\t\t5\t\t\t\t4\t21\tgold%\t\t5\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Greed\t100\t1\t1\t20\t\t15\t\t\t\t4\t21\tgold%\t\t11\t22\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Greed\t100\t1\t1\t1\t\t15\t\t\t\t4\t21\tgold%\t\t5\t10\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Avarice\t100\t1\t1\t1\t\t1\t\t\t\t4\t21\tgold%\t\t10\t30\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Chance\t1\t1\t1\t12\t\t9\t\t\t\t4\t22\tmag%\t\t5\t15\t\t\t\t\t\t\t\t\t\tboot\tglov\tring\tamul\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fortune\t1\t1\t1\t16\t\t12\t\t\t\t4\t22\tmag%\t\t16\t25\t\t\t\t\t\t\t\t\tlgld\tboot\tglov\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fortune\t1\t1\t\t42\t\t31\t\t\t\t4\t22\tmag%\t\t16\t25\t\t\t\t\t\t\t\t\tlgld\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Luck\t100\t1\t\t26\t\t19\t\t\t\t4\t22\tmag%\t\t26\t35\t\t\t\t\t\t\t\t\tlgld\tboot\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fortune\t100\t1\t1\t31\t\t18\t\t\t\t3\t22\tmag%\t\t3\t5\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Good Luck\t100\t1\t\t47\t\t33\t\t\t\t2\t22\tmag%\t\t6\t7\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Prosperity\t100\t1\t1\t26\t\t19\t\t\t\t2\t22\tmag%\t\t5\t10\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Energy\t1\t1\t1\t1\t\t1\t\t\t\t4\t23\tenr\t\t1\t3\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Mind\t1\t1\t1\t7\t\t3\t\t\t\t4\t23\tenr\t\t4\t6\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Brilliance\t1\t1\t1\t13\t\t9\t\t\t\t3\t23\tenr\t\t7\t10\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Sorcery\t1\t1\t1\t21\t\t16\t\t\t\t3\t23\tenr\t\t11\t15\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Wizardry\t1\t1\t1\t31\t\t23\t\t\t\t3\t23\tenr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Enlightenment\t100\t1\t\t41\t\t33\t\t\t\t3\t23\tenr\t\t21\t30\t\t\t\t\t\t\t\t\tdgld\tamul\torb\tcirc\twand\tstaf\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Energy\t1\t1\t1\t7\t\t5\t\t\t\t4\t23\tenr\t\t1\t3\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Mind\t1\t1\t1\t13\t\t9\t\t\t\t3\t23\tenr\t\t4\t6\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Brilliance\t1\t1\t1\t21\t\t16\t\t\t\t3\t23\tenr\t\t7\t10\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Sorcery\t1\t1\t1\t31\t\t23\t\t\t\t3\t23\tenr\t\t11\t15\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Wizardry\t100\t1\t\t41\t\t33\t\t\t\t3\t23\tenr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Energy\t1\t1\t1\t4\t\t3\t\t\t\t3\t23\tenr\t\t1\t3\t\t\t\t\t\t\t\t\t\thelm\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Mind\t1\t1\t1\t10\t\t7\t\t\t\t3\t23\tenr\t\t4\t6\t\t\t\t\t\t\t\t\t\thelm\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Brilliance\t1\t1\t1\t16\t\t12\t\t\t\t3\t23\tenr\t\t7\t10\t\t\t\t\t\t\t\t\t\thelm\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Sorcery\t100\t1\t\t26\t\t21\t\t\t\t3\t23\tenr\t\t11\t15\t\t\t\t\t\t\t\t\tdgld\thelm\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Knowledge\t100\t1\t1\t9\t\t6\t\t\t\t3\t23\tenr\t\t1\t5\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Bear\t1\t1\t1\t8\t\t6\t\t\t\t3\t24\tknock\t\t1\t1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Light\t1\t1\t1\t6\t\t4\t\t\t\t1\t25\tlight\t\t1\t1\tatt\t\t15\t15\t\t\t\t\t\tarmo\trod\tring\tamul\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Radiance\t1\t1\t1\t15\t\t11\t\t\t\t1\t25\tlight\t\t3\t3\tatt\t\t30\t30\t\t\t\t\t\trod\tmiss\tring\tamul\thelm\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Sun\t1\t1\t1\t17\t\t12\t\t\t\t1\t25\tlight\t\t5\t5\tatt%\t\t5\t5\t\t\t\t\t\trod\tmiss\tglov\tring\tamul\thelm\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Jackal\t1\t1\t1\t1\t\t1\t\t\t\t3\t26\thp\t\t1\t5\t\t\t\t\t\t\t\t\t\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Fox\t1\t1\t1\t7\t\t5\t\t\t\t3\t26\thp\t\t6\t10\t\t\t\t\t\t\t\t\t\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Wolf\t1\t1\t1\t15\t\t11\t\t\t\t3\t26\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Tiger\t1\t1\t1\t20\t\t15\t\t\t\t3\t26\thp\t\t21\t30\t\t\t\t\t\t\t\t\t\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Mammoth\t1\t1\t1\t25\t\t18\t\t\t\t3\t26\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Colosuss\t1\t1\t1\t30\t\t22\t\t\t\t3\t26\thp\t\t41\t60\t\t\t\t\t\t\t\t\tcred\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Squid\t100\t1\t\t40\t\t30\t\t\t\t3\t26\thp\t\t61\t80\t\t\t\t\t\t\t\t\tcred\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Whale\t100\t1\t\t50\t\t37\t\t\t\t3\t26\thp\t\t81\t100\t\t\t\t\t\t\t\t\tcred\ttors\tbelt\tamul\tphlm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Jackal\t100\t1\t1\t4\t\t3\t\t\t\t3\t26\thp\t\t1\t5\t\t\t\t\t\t\t\t\t\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Fox\t100\t1\t1\t11\t\t8\t\t\t\t3\t26\thp\t\t6\t10\t\t\t\t\t\t\t\t\t\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Wolf\t100\t1\t1\t27\t\t20\t\t\t\t3\t26\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Tiger\t100\t1\t1\t43\t\t35\t\t\t\t3\t26\thp\t\t21\t30\t\t\t\t\t\t\t\t\t\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Mammoth\t100\t1\t1\t59\t\t51\t\t\t\t3\t26\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Colosuss\t100\t1\t\t75\t\t67\t\t\t\t3\t26\thp\t\t41\t60\t\t\t\t\t\t\t\t\tcred\tshld\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Jackal\t1\t1\t1\t8\t\t6\t\t\t\t3\t26\thp\t\t1\t5\t\t\t\t\t\t\t\t\t\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Fox\t1\t1\t1\t17\t\t13\t\t\t\t3\t26\thp\t\t6\t10\t\t\t\t\t\t\t\t\t\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Wolf\t1\t1\t1\t34\t\t26\t\t\t\t3\t26\thp\t\t11\t20\t\t\t\t\t\t\t\t\t\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Tiger\t1\t1\t1\t51\t\t43\t\t\t\t3\t26\thp\t\t21\t30\t\t\t\t\t\t\t\t\t\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Mammoth\t1\t1\t1\t68\t\t60\t\t\t\t3\t26\thp\t\t31\t40\t\t\t\t\t\t\t\t\tcred\tclub\thamm\tmace\tring\thelm\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t100\t1\t1\t1\t\t1\t\t\t\t4\t26\thp\t\t5\t10\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t100\t1\t1\t9\t\t6\t\t\t\t4\t26\thp\t\t11\t15\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t100\t1\t1\t19\t\t14\t\t\t\t4\t26\thp\t\t16\t20\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Substinence\t100\t1\t1\t31\t\t23\t\t\t\t4\t26\thp\t\t21\t25\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Substinence\t100\t1\t1\t45\t\t37\t\t\t\t4\t26\thp\t\t26\t30\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Substinence\t100\t1\t1\t61\t\t53\t\t\t\t4\t26\thp\t\t31\t35\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Vita\t100\t1\t\t77\t\t69\t\t\t\t4\t26\thp\t\t36\t40\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Vita\t100\t1\t\t91\t\t83\t\t\t\t4\t26\thp\t\t41\t45\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Vita\t100\t1\t\t110\t\t97\t\t\t\t4\t26\thp\t\t46\t50\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t100\t1\t1\t1\t\t9\t\t\t\t4\t26\thp\t\t6\t10\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t100\t1\t1\t12\t\t9\t\t\t\t4\t26\thp\t\t11\t15\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Substinence\t100\t1\t1\t26\t\t19\t\t\t\t4\t26\thp\t\t16\t20\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Substinence\t100\t1\t1\t42\t\t34\t\t\t\t4\t26\thp\t\t21\t25\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Vita\t100\t1\t\t58\t\t50\t\t\t\t4\t26\thp\t\t26\t30\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Vita\t100\t1\t\t74\t\t66\t\t\t\t4\t26\thp\t\t31\t35\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life\t100\t1\t1\t1\t\t14\t\t\t\t4\t26\thp\t\t5\t10\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Substinence\t100\t1\t1\t23\t\t17\t\t\t\t4\t26\thp\t\t11\t15\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Vita\t100\t1\t\t47\t\t39\t\t\t\t4\t26\thp\t\t16\t20\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Spirit\t100\t1\t1\t1\t\t1\t\t\t\t4\t26\thp\t\t3\t8\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Hope\t100\t1\t\t45\t\t37\t\t\t\t4\t26\thp\t\t9\t20\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Leech\t1\t1\t1\t6\t\t4\t\t\t\t7\t27\tlifesteal\t\t4\t5\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"of the Locust\t1\t1\t1\t20\t\t15\t\t\t\t7\t27\tlifesteal\t\t6\t7\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"of the Lamprey\t100\t1\t1\t55\t\t43\t\t\t\t7\t27\tlifesteal\t\t8\t9\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"of the Leech\t1\t1\t1\t14\t\t10\t\t\t\t4\t27\tlifesteal\t\t3\t4\t\t\t\t\t\t\t\t\t\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Locust\t1\t1\t1\t47\t\t35\t\t\t\t4\t27\tlifesteal\t\t5\t6\t\t\t\t\t\t\t\t\t\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Lamprey\t100\t1\t1\t77\t\t65\t\t\t\t4\t27\tlifesteal\t\t7\t8\t\t\t\t\t\t\t\t\tcred\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Leech\t1\t1\t1\t34\t\t26\t\t\t\t4\t27\tlifesteal\t\t3\t3\t\t\t\t\t\t\t\t\tcred\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Bat\t1\t1\t1\t7\t\t4\t\t\t\t7\t28\tmanasteal\t\t4\t5\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"of the Wraith\t1\t1\t1\t21\t\t16\t\t\t\t7\t28\tmanasteal\t\t6\t7\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Vampire\t100\t1\t1\t56\t\t48\t\t\t\t7\t28\tmanasteal\t\t8\t9\t\t\t\t\t\t\t\t\tcred\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Bat\t1\t1\t1\t15\t\t11\t\t\t\t4\t28\tmanasteal\t\t3\t4\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Wraith\t1\t1\t1\t58\t\t40\t\t\t\t4\t28\tmanasteal\t\t5\t6\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Vampire\t100\t1\t1\t78\t\t66\t\t\t\t4\t28\tmanasteal\t\t7\t8\t\t\t\t\t\t\t\t\tcred\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Bat\t1\t1\t1\t35\t\t27\t\t\t\t4\t28\tmanasteal\t\t3\t3\t\t\t\t\t\t\t\t\tcred\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Defiance\t1\t1\t1\t25\t\t18\t\t\t\t2\t29\tres-pois-len\t\t75\t75\t\t\t\t\t\t\t\t\tdred\ttors\tshld\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Amelioration\t1\t1\t1\t18\t\t13\t\t\t\t3\t29\tres-pois-len\t\t50\t50\t\t\t\t\t\t\t\t\t\ttors\tshld\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Remedy\t100\t1\t1\t7\t\t5\t\t\t\t3\t29\tres-pois-len\t\t25\t25\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Simplicity\t1\t1\t1\t25\t\t18\t\t\t\t2\t30\tease\t\t-30\t-30\t\t\t\t\t\t\t\t\t\ttors\tweap\tshld\t\t\t\t\trod\torb\t\t\t\t0\t0\n",
+                u8"of Ease\t1\t1\t1\t15\t\t11\t\t\t\t3\t30\tease\t\t-20\t-20\t\t\t\t\t\t\t\t\t\ttors\tweap\tshld\t\t\t\t\trod\torb\t\t\t\t0\t0\n",
+                u8"of Freedom\t100\t1\t1\t1\t\t1\t\t\t\t3\t30\tease\t\t-15\t-15\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t1\t1\t1\t1\t\t1\t\t\t\t4\t31\tstr\t\t1\t2\t\t\t\t\t\t\t\t\t\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Might\t1\t1\t1\t10\t\t8\t\t\t\t3\t31\tstr\t\t3\t5\t\t\t\t\t\t\t\t\t\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Ox\t1\t1\t1\t26\t\t19\t\t\t\t3\t31\tstr\t\t6\t9\t\t\t\t\t\t\t\t\t\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Giant\t1\t1\t1\t42\t\t34\t\t\t\t3\t31\tstr\t\t10\t15\t\t\t\t\t\t\t\t\t\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Titan\t1\t1\t1\t58\t\t50\t\t\t\t3\t31\tstr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Atlus\t100\t1\t1\t71\t\t63\t\t\t\t3\t31\tstr\t\t21\t30\t\t\t\t\t\t\t\t\tdgld\tamul\tbelt\tclub\thamm\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t1\t1\t1\t5\t\t3\t\t\t\t4\t31\tstr\t\t1\t2\t\t\t\t\t\t\t\t\t\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Might\t1\t1\t1\t21\t\t15\t\t\t\t3\t31\tstr\t\t3\t5\t\t\t\t\t\t\t\t\t\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Ox\t1\t1\t1\t38\t\t30\t\t\t\t3\t31\tstr\t\t6\t9\t\t\t\t\t\t\t\t\t\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Giant\t1\t1\t1\t55\t\t47\t\t\t\t3\t31\tstr\t\t10\t15\t\t\t\t\t\t\t\t\t\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Titan\t100\t1\t1\t74\t\t66\t\t\t\t3\t31\tstr\t\t16\t20\t\t\t\t\t\t\t\t\tdgld\tring\tscep\tmace\ttors\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t1\t1\t1\t12\t\t8\t\t\t\t3\t31\tstr\t\t1\t2\t\t\t\t\t\t\t\t\t\tmele\tglov\tshld\t\t\t\t\tblun\t\t\t\t\t0\t0\n",
+                u8"of Might\t1\t1\t1\t33\t\t25\t\t\t\t3\t31\tstr\t\t3\t5\t\t\t\t\t\t\t\t\t\tmele\tglov\tshld\t\t\t\t\tblun\t\t\t\t\t0\t0\n",
+                u8"of the Ox\t1\t1\t1\t45\t\t37\t\t\t\t3\t31\tstr\t\t6\t9\t\t\t\t\t\t\t\t\t\tmele\tglov\tshld\t\t\t\t\tblun\t\t\t\t\t0\t0\n",
+                u8"of the Giant\t100\t1\t1\t59\t\t51\t\t\t\t3\t31\tstr\t\t10\t15\t\t\t\t\t\t\t\t\tdgld\tmele\tglov\t\t\t\t\t\tblun\t\t\t\t\t0\t0\n",
+                u8"of Strength\t100\t1\t1\t1\t\t1\t\t\t\t4\t31\tstr\t\t3\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t100\t1\t1\t3\t\t2\t\t\t\t4\t31\tstr\t\t2\t3\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t100\t1\t1\t7\t\t5\t\t\t\t4\t31\tstr\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t100\t1\t1\t14\t\t10\t\t\t\t4\t31\tstr\t\t5\t6\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t100\t1\t1\t18\t\t13\t\t\t\t4\t31\tstr\t\t4\t5\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t100\t1\t1\t22\t\t16\t\t\t\t4\t31\tstr\t\t2\t2\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Virility\t100\t1\t1\t18\t\t13\t\t\t\t4\t31\tstr\t\t1\t4\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Pacing\t1\t1\t1\t12\t\t8\t\t\t\t3\t35\tmove1\t\t10\t10\t\t\t\t\t\t\t\t\t\tboot\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Haste\t1\t1\t1\t22\t\t16\t\t\t\t4\t35\tmove2\t\t20\t20\t\t\t\t\t\t\t\t\t\tboot\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Speed\t1\t1\t1\t37\t\t29\t\t\t\t4\t35\tmove3\t\t30\t30\t\t\t\t\t\t\t\t\t\tboot\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Traveling\t100\t1\t\t65\t\t57\t\t\t\t4\t35\tmove3\t\t30\t30\tstamdrain\t\t80\t90\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Acceleration\t100\t1\t\t51\t\t43\t\t\t\t4\t35\tmove3\t\t40\t40\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Inertia\t100\t1\t1\t19\t\t14\t\t\t\t4\t35\tmove3\t\t7\t7\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Inertia\t100\t1\t1\t24\t\t18\t\t\t\t4\t35\tmove2\t\t5\t5\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Inertia\t100\t1\t\t35\t\t27\t\t\t\t4\t35\tmove1\t\t3\t3\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Self-Repair\t100\t1\t1\t3\t\t1\t\t\t\t3\t37\trep-dur\t3\t\t\t\t\t\t\t\t\t\t\t\tweap\tarmo\t\t\t\t\t\tthro\tmiss\t\t\t\t0\t0\n",
+                u8"of Fast Repair\t100\t1\t1\t20\t\t12\t\t\t\t2\t37\trep-dur\t5\t\t\t\t\t\t\t\t\t\t\t\tweap\tarmo\t\t\t\t\t\tthro\tmiss\t\t\t\t0\t0\n",
+                u8"of Ages\t100\t1\t\t50\t\t42\t\t\t\t1\t39\tindestruct\t\t\t\t\t\t\t\t\t\t\t\t\tweap\tarmo\t\t\t\t\t\tthro\tmiss\t\t\t\t0\t0\n",
+                u8"of Replenishing\t100\t1\t1\t5\t\t3\t\t\t\t6\t39\trep-quant\t5\t\t\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Propogation\t100\t1\t1\t24\t\t18\t\t\t\t5\t39\trep-quant\t10\t\t\t\t\t\t\t\t\t\t\t\tthro\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Kraken\t100\t1\t\t20\t\t1\t\t\t\t1\t41\thp/lvl\t6\t\t\t\t\t\t\t\t\t\t\tcred\ttors\tamul\tpelt\tphlm\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Memory\t100\t1\t\t20\t\t1\t\t\t\t1\t41\tmana/lvl\t6\t\t\t\t\t\t\t\t\t\t\tcred\tcirc\tamul\tpelt\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Elephant\t100\t1\t\t37\t\t7\t\t\t\t2\t41\thp/lvl\t4\t\t\tmana/lvl\t2\t\t\t\t\t\t\tcred\tcirc\tpelt\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Power\t100\t\t\t1\t\t1\t\t\t\t1\t42\tstr/lvl\t3\t\t\t\t\t\t\t\t\t\t\tdgld\tbelt\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Grace\t100\t\t\t1\t\t1\t\t\t\t1\t42\tdex/lvl\t3\t\t\t\t\t\t\t\t\t\t\tdgld\thelm\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Grace and Power\t100\t\t\t1\t\t1\t\t\t\t1\t42\tstr/lvl\t1\t\t\tdex/lvl\t1\t\t\t\t\t\t\tdgld\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Yeti\t100\t\t\t1\t\t1\t\t\t\t1\t43\tres-cold/lvl\t3\t\t\t\t\t\t\t\t\t\t\tlblu\ttors\tglov\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Phoenix\t100\t\t\t1\t\t1\t\t\t\t1\t43\tres-fire/lvl\t3\t\t\t\t\t\t\t\t\t\t\tcred\tshld\thelm\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Efreeti\t100\t\t\t1\t\t1\t\t\t\t1\t43\tres-ltng/lvl\t3\t\t\t\t\t\t\t\t\t\t\tcblu\tglov\tboot\tring\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Cobra\t100\t\t\t1\t\t1\t\t\t\t1\t43\tres-pois/lvl\t3\t\t\t\t\t\t\t\t\t\t\tdyel\tbelt\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Elements\t100\t\t\t1\t\t1\t\t\t\t10\t43\tres-cold/lvl\t1\t\t\tres-fire/lvl\t1\t\t\tres-ltng/lvl\t1\t\t\tdgld\tcirc\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Firebolts\t100\t1\t1\t16\t\t12\t\t\t\t1\t44\thit-skill\t36\t10\t8\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Firebolts\t100\t1\t1\t6\t\t4\t\t\t\t1\t44\tatt-skill\t36\t5\t3\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Firebolts\t100\t1\t1\t20\t\t15\t\t\t\t1\t44\tatt-skill\t36\t10\t4\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Charged Shield\t100\t1\t1\t6\t\t4\t\t\t\t1\t44\tgethit-skill\t38\t10\t3\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Charged Shield\t100\t1\t1\t16\t\t12\t\t\t\t1\t44\tgethit-skill\t38\t12\t4\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Charged Shield\t100\t1\t1\t26\t\t19\t\t\t\t1\t44\tgethit-skill\t38\t14\t5\t\t\t\t\t\t\t\t\t\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Icebolt\t100\t1\t1\t6\t\t4\t\t\t\t1\t44\tatt-skill\t39\t5\t3\t\t\t\t\t\t\t\t\tlblu\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Frozen Armor\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Static Field\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Telekinesis\t100\t1\t1\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frost Shield\t100\t1\t1\t12\t\t9\t\t\t\t1\t44\tgethit-skill\t44\t5\t3\t\t\t\t\t\t\t\t\tlblu\tarmo\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Ice Blast\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blaze\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Ball\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Nova\t100\t1\t1\t18\t\t13\t\t\t\t1\t44\thit-skill\t48\t10\t3\t\t\t\t\t\t\t\t\tcblu\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Nova\t100\t1\t1\t28\t\t21\t\t\t\t1\t44\thit-skill\t48\t12\t4\t\t\t\t\t\t\t\t\tcblu\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Nova Shield\t100\t1\t1\t18\t\t13\t\t\t\t1\t44\tgethit-skill\t48\t10\t3\t\t\t\t\t\t\t\t\tcblu\tarmo\tring \t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Nova Shield\t100\t1\t1\t28\t\t21\t\t\t\t1\t44\tgethit-skill\t48\t12\t4\t\t\t\t\t\t\t\t\tcblu\tarmo\tring \t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Nova Shield\t100\t1\t1\t38\t\t28\t\t\t\t1\t44\tgethit-skill\t48\t14\t5\t\t\t\t\t\t\t\t\tcblu\tarmo\tring \t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning\t100\t1\t1\t18\t\t13\t\t\t\t1\t44\tatt-skill\t49\t5\t3\t\t\t\t\t\t\t\t\tcblu\tweap\t\t\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Lightning\t100\t\t\t12\t\t18\t\tsor\t9\t1\t44\tcharged\t49\t50\t1\t\t\t\t\t\t\t\t\tcblu\tweap\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shiver Armor\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Wall\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Enchant\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Chain Lightning\t100\t1\t1\t25\t\t18\t\t\t\t1\t44\tatt-skill\t53\t5\t3\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Chain Lightning\t100\t1\t1\t35\t\t26\t\t\t\t1\t44\tatt-skill\t53\t8\t3\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Chain Lightning\t100\t1\t1\t45\t\t33\t\t\t\t1\t44\tatt-skill\t53\t8\t5\t\t\t\t\t\t\t\t\t\tweap\tring\tamul\t\t\t\t\tmiss\t\t\t\t\t0\t0\n",
+                u8"of Teleport Shield\t100\t\t\t25\t\t18\t\t\t\t1\t44\tgethit-skill\t54\t10\t3\t\t\t\t\t\t\t\t\twhit\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Teleport Shield\t100\t\t\t35\t\t26\t\t\t\t1\t44\tgethit-skill\t54\t14\t3\t\t\t\t\t\t\t\t\twhit\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Teleport Shield\t100\t\t\t45\t\t33\t\t\t\t1\t44\tgethit-skill\t54\t18\t3\t\t\t\t\t\t\t\t\twhit\tarmo\tring\tamul\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Glacial Spike\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Meteor\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thunder Storm\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Energy Shield\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blizzard\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Chilling Armor\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Hydra Shield\t100\t1\t1\t40\t\t30\t\t\t\t1\t44\tgethit-skill\t62\t10\t3\t\t\t\t\t\t\t\t\tcred\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frozen Orb\t100\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dawn\t100\t\t\t30\t\t22\t\t\t\t0\t45\tac/time\t3\t10\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Sunlight\t100\t\t\t30\t\t22\t\t\t\t0\t45\tac/time\t0\t-10\t60\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Magic Arrows\t100\t1\t1\t12\t\t11\t\tama\t1\t1\t44\tcharged\t6\t-30\t-10\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Magic Arrows\t100\t\t\t35\t\t28\t\tama\t3\t1\t44\tcharged\t6\t-20\t-6\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Arrows\t100\t\t\t13\t\t12\t\tama\t1\t1\t44\tcharged\t7\t-30\t-10\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Arrows\t100\t1\t1\t40\t\t32\t\tama\t3\t1\t44\tcharged\t7\t-20\t-6\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Inner Sight\t100\t1\t1\t18\t\t14\t\tama\t2\t1\t44\tcharged\t8\t-30\t-6\t\t\t\t\t\t\t\t\t\tamul\tamaz\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Inner Sight\t100\t1\t1\t50\t\t42\t\tama\t5\t1\t44\tcharged\t8\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Jabbing\t100\t\t\t24\t\t18\t\tama\t3\t1\t44\tcharged\t10\t-60\t-7\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Jabbing\t100\t\t\t50\t\t42\t\tama\t5\t1\t44\tcharged\t10\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Cold Arrows\t100\t1\t1\t15\t\t16\t\tama\t6\t1\t44\tcharged\t11\t-30\t-8\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Cold Arrows\t100\t1\t1\t47\t\t39\t\tama\t9\t1\t44\tcharged\t11\t-20\t-5\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Multiple Shot\t100\t1\t1\t18\t\t19\t\tama\t6\t1\t44\tcharged\t12\t-30\t-8\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Multiple Shot\t100\t1\t1\t63\t\t55\t\tama\t12\t1\t44\tcharged\t12\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Power Strike\t100\t1\t1\t12\t\t13\t\tama\t6\t1\t44\tcharged\t14\t-60\t-6\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Power Strike\t100\t1\t1\t55\t\t47\t\tama\t9\t1\t44\tcharged\t14\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Poison Jab\t100\t\t\t17\t\t18\t\tama\t6\t1\t44\tcharged\t15\t-60\t-6\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Poison Jab\t100\t\t\t67\t\t59\t\tama\t13\t1\t44\tcharged\t15\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Exploding Arrows\t100\t1\t1\t30\t\t26\t\tama\t12\t1\t44\tcharged\t16\t-30\t-6\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Exploding Arrows\t100\t1\t1\t69\t\t61\t\tama\t17\t1\t44\tcharged\t16\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Slow Missiles\t100\t\t\t33\t\t27\t\tama\t12\t1\t44\tcharged\t17\t-30\t-5\t\t\t\t\t\t\t\t\t\tamaz\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Slow Missiles\t100\t\t\t68\t\t60\t\tama\t15\t1\t44\tcharged\t17\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Impaling Strike\t100\t\t\t24\t\t18\t\tama\t12\t1\t44\tcharged\t19\t-60\t-6\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Impaling Strike\t100\t\t\t59\t\t51\t\tama\t15\t1\t44\tcharged\t19\t-20\t-4\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning Javelin\t100\t\t\t25\t\t18\t\tama\t12\t1\t44\tcharged\t20\t-60\t-6\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning Javelin\t100\t\t\t70\t\t62\t\tama\t17\t1\t44\tcharged\t20\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Ice Arrows\t100\t1\t1\t36\t\t28\t\tama\t18\t1\t44\tcharged\t21\t-30\t-5\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Ice Arrows\t100\t1\t1\t72\t\t64\t\tama\t22\t1\t44\tcharged\t21\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Guided Arrows\t100\t\t\t34\t\t26\t\tama\t18\t1\t44\tcharged\t22\t-30\t-5\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Guided Arrows\t100\t\t\t69\t\t61\t\tama\t21\t1\t44\tcharged\t22\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Charged Strike\t100\t1\t1\t33\t\t25\t\tama\t18\t1\t44\tcharged\t24\t-60\t-5\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Charged Strike\t100\t1\t1\t68\t\t60\t\tama\t21\t1\t44\tcharged\t24\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Plague Jab\t100\t\t\t35\t\t27\t\tama\t18\t1\t44\tcharged\t25\t-60\t-5\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Plague Jab\t100\t\t\t71\t\t63\t\tama\t22\t1\t44\tcharged\t25\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Immolating Arrows\t100\t\t\t42\t\t36\t\tama\t24\t1\t44\tcharged\t27\t-30\t-4\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Immolating Arrows\t100\t\t\t85\t\t77\t\tama\t27\t1\t44\tcharged\t27\t-20\t-2\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fending\t100\t\t\t41\t\t35\t\tama\t24\t1\t44\tcharged\t30\t-60\t-5\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fending\t100\t\t\t83\t\t75\t\tama\t26\t1\t44\tcharged\t30\t-20\t-3\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Freezing Arrows\t100\t1\t1\t50\t\t42\t\tama\t30\t1\t44\tcharged\t31\t-30\t-4\t\t\t\t\t\t\t\t\t\tmiss\tabow\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Freezing Arrows\t100\t1\t1\t94\t\t86\t\tama\t33\t1\t44\tcharged\t31\t-20\t-2\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning Strike\t100\t1\t1\t47\t\t39\t\tama\t30\t1\t44\tcharged\t34\t-60\t-4\t\t\t\t\t\t\t\t\t\tspea\taspe\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning Strike\t100\t1\t1\t90\t\t82\t\tama\t32\t1\t44\tcharged\t34\t-20\t-2\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning Fury\t100\t\t\t49\t\t41\t\tama\t30\t1\t44\tcharged\t35\t-60\t-4\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning Fury\t100\t\t\t92\t\t84\t\tama\t33\t1\t44\tcharged\t35\t-20\t-2\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Bolts\t100\t1\t1\t7\t\t7\t\tsor\t1\t1\t44\tcharged\t36\t-30\t-10\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Bolts\t100\t1\t1\t14\t\t14\t\tsor\t1\t1\t44\tcharged\t36\t-20\t-6\t\t\t\t\t\t\t\t\t\tswor\tring\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Charged Bolts\t100\t1\t1\t7\t\t7\t\tsor\t1\t1\t44\tcharged\t38\t-30\t-10\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Charged Bolts\t100\t1\t1\t14\t\t14\t\tsor\t1\t1\t44\tcharged\t38\t-20\t-6\t\t\t\t\t\t\t\t\t\thamm\tmace\tscep\tring\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Ice Bolts\t100\t1\t1\t7\t\t7\t\tsor\t1\t1\t44\tcharged\t39\t-30\t-10\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Ice Bolts\t100\t1\t1\t14\t\t14\t\tsor\t1\t1\t44\tcharged\t39\t-20\t-6\t\t\t\t\t\t\t\t\t\tknif\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frozen Armor\t100\t\t\t7\t\t7\t\tsor\t1\t1\t44\tcharged\t40\t-30\t-10\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frozen Armor\t100\t\t\t14\t\t14\t\tsor\t1\t1\t44\tcharged\t40\t-20\t-6\t\t\t\t\t\t\t\t\t\tknif\ttors\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Static Field\t100\t\t\t12\t\t12\t\tsor\t6\t1\t44\tcharged\t42\t-30\t-8\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Static Field\t100\t\t\t24\t\t24\t\tsor\t6\t1\t44\tcharged\t42\t-20\t-5\t\t\t\t\t\t\t\t\t\thamm\tmace\tscep\tring\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Telekinesis\t100\t1\t1\t12\t\t12\t\tsor\t6\t1\t44\tcharged\t43\t-30\t-8\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Telekinesis\t100\t1\t1\t24\t\t24\t\tsor\t6\t1\t44\tcharged\t43\t-20\t-5\t\t\t\t\t\t\t\t\t\thamm\tmace\tscep\tring\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frost Novas\t100\t1\t1\t12\t\t12\t\tsor\t6\t1\t44\tcharged\t44\t-30\t-8\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frost Novas\t100\t1\t1\t24\t\t24\t\tsor\t6\t1\t44\tcharged\t44\t-20\t-5\t\t\t\t\t\t\t\t\t\tknif\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Ice Blasts\t100\t1\t1\t12\t\t12\t\tsor\t6\t1\t44\tcharged\t45\t-30\t-8\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Ice Blasts\t100\t1\t1\t24\t\t24\t\tsor\t6\t1\t44\tcharged\t45\t-20\t-5\t\t\t\t\t\t\t\t\t\thamm\tmace\tscep\tring\tcirc\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blazing\t100\t\t\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t46\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blazing\t100\t\t\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t46\t-20\t-4\t\t\t\t\t\t\t\t\t\tboot\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Balls\t100\t1\t1\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t47\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Balls\t100\t1\t1\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t47\t-20\t-4\t\t\t\t\t\t\t\t\t\tspea\twand\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Novas\t100\t1\t1\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t48\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Novas\t100\t1\t1\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t48\t-20\t-4\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning\t100\t1\t1\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t49\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning\t100\t1\t1\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t49\t-20\t-4\t\t\t\t\t\t\t\t\t\taxe\thamm\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shiver Armor\t100\t\t\t18\t\t18\t\tsor\t12\t1\t44\tcharged\t50\t-30\t-7\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shiver Armor\t100\t\t\t36\t\t36\t\tsor\t12\t1\t44\tcharged\t50\t-20\t-4\t\t\t\t\t\t\t\t\t\tknif\ttors\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Walls\t100\t\t\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t51\t-30\t-6\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Walls\t100\t\t\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t51\t-20\t-3\t\t\t\t\t\t\t\t\t\tpole\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Enchantment\t100\t1\t1\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t52\t-20\t-3\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Enchantment\t100\t1\t1\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t52\t-10\t-1\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Chain Lightning\t100\t1\t1\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t53\t-30\t-6\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Chain Lightning\t100\t1\t1\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t53\t-20\t-3\t\t\t\t\t\t\t\t\t\tspea\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Teleportation\t100\t1\t1\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t54\t-30\t-6\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Teleportation\t100\t1\t1\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t54\t-20\t-3\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Glacial Spikes\t100\t1\t1\t24\t\t24\t\tsor\t18\t1\t44\tcharged\t55\t-30\t-6\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Glacial Spikes\t100\t1\t1\t48\t\t48\t\tsor\t18\t1\t44\tcharged\t55\t-20\t-3\t\t\t\t\t\t\t\t\t\tknif\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Meteors\t100\t1\t1\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t56\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Meteors\t100\t1\t1\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t56\t-20\t-2\t\t\t\t\t\t\t\t\t\tknif\tclub\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thunder Storm\t100\t\t\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t57\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thunder Storm\t100\t\t\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t57\t-20\t-2\t\t\t\t\t\t\t\t\t\thamm\tclub\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Energy Shield\t100\t\t\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t58\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Energy Shield\t100\t\t\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t58\t-20\t-2\t\t\t\t\t\t\t\t\t\thelm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blizzards\t100\t1\t1\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t59\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blizzards\t100\t1\t1\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t59\t-20\t-2\t\t\t\t\t\t\t\t\t\tknif\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Chilling Armor\t100\t\t\t30\t\t30\t\tsor\t24\t1\t44\tcharged\t60\t-30\t-5\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Chilling Armor\t100\t\t\t60\t\t60\t\tsor\t24\t1\t44\tcharged\t60\t-20\t-2\t\t\t\t\t\t\t\t\t\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Hydras\t100\t\t\t36\t\t36\t\tsor\t30\t1\t44\tcharged\t62\t-30\t-3\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Hydras\t100\t\t\t72\t\t72\t\tsor\t30\t1\t44\tcharged\t62\t-20\t-1\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frozen Orbs\t100\t1\t1\t36\t\t36\t\tsor\t30\t1\t44\tcharged\t64\t-30\t-3\t\t\t\t\t\t\t\t\t\tstaf\torb\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frozen Orbs\t100\t1\t1\t72\t\t72\t\tsor\t30\t1\t44\tcharged\t64\t-20\t-1\t\t\t\t\t\t\t\t\t\tknif\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Amplify Damage\t100\t\t\t7\t\t7\t\tnec\t1\t1\t44\tcharged\t66\t-60\t-10\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Amplify Damage\t100\t\t\t14\t\t14\t\tnec\t1\t1\t44\tcharged\t66\t-20\t-6\t\t\t\t\t\t\t\t\t\tblun\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Teeth\t100\t1\t1\t7\t\t7\t\tnec\t1\t1\t44\tcharged\t67\t-60\t-10\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Teeth\t100\t1\t1\t14\t\t14\t\tnec\t1\t1\t44\tcharged\t67\t-20\t-6\t\t\t\t\t\t\t\t\t\tswor\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Armor\t100\t\t\t7\t\t7\t\tnec\t1\t1\t44\tcharged\t68\t-60\t-10\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Armor\t100\t\t\t14\t\t14\t\tnec\t1\t1\t44\tcharged\t68\t-20\t-6\t\t\t\t\t\t\t\t\t\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Raise Skeletons\t100\t\t\t7\t\t7\t\tnec\t1\t1\t44\tcharged\t70\t-60\t-10\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Raise Skeletons\t100\t\t\t14\t\t14\t\tnec\t1\t1\t44\tcharged\t70\t-20\t-6\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dim Vision\t100\t1\t1\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t71\t-60\t-8\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dim Vision\t100\t1\t1\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t71\t-20\t-5\t\t\t\t\t\t\t\t\t\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Weaken\t100\t1\t1\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t72\t-60\t-8\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Weaken\t100\t1\t1\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t72\t-20\t-5\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Poison Dagger\t100\t1\t1\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t73\t-60\t-8\t\t\t\t\t\t\t\t\t\tknif\thead\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Poison Dagger\t100\t1\t1\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t73\t-20\t-5\t\t\t\t\t\t\t\t\t\tglov\tring\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Corpse Explosions\t100\t\t\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t74\t-60\t-8\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Corpse Explosions\t100\t\t\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t74\t-20\t-5\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Clay Golem Summoning\t100\t\t\t12\t\t12\t\tnec\t6\t1\t44\tcharged\t75\t-60\t-8\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Clay Golem Summoning\t100\t\t\t24\t\t24\t\tnec\t6\t1\t44\tcharged\t75\t-20\t-5\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Iron Maiden\t100\t\t\t18\t\t18\t\tnec\t12\t1\t44\tcharged\t76\t-60\t-7\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Iron Maiden\t100\t\t\t36\t\t36\t\tnec\t12\t1\t44\tcharged\t76\t-20\t-4\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Terror\t100\t1\t1\t18\t\t18\t\tnec\t12\t1\t44\tcharged\t77\t-60\t-7\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Terror\t100\t1\t1\t36\t\t36\t\tnec\t12\t1\t44\tcharged\t77\t-20\t-4\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Walls\t100\t\t\t18\t\t18\t\tnec\t12\t1\t44\tcharged\t78\t-60\t-7\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Walls\t100\t\t\t36\t\t36\t\tnec\t12\t1\t44\tcharged\t78\t-20\t-4\t\t\t\t\t\t\t\t\t\tclub\tmace\tscep\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Raise Skeletal Mages\t100\t\t\t18\t\t18\t\tnec\t12\t1\t44\tcharged\t80\t-60\t-7\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Raise Skeletal Mages\t100\t\t\t36\t\t36\t\tnec\t12\t1\t44\tcharged\t80\t-20\t-4\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Confusion\t100\t1\t1\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t81\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Confusion\t100\t1\t1\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t81\t-20\t-3\t\t\t\t\t\t\t\t\t\tring\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life Tap\t100\t1\t1\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t82\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Life Tap\t100\t1\t1\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t82\t-20\t-3\t\t\t\t\t\t\t\t\t\taxe\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Poison Explosion\t100\t\t\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t83\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Poison Explosion\t100\t\t\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t83\t-20\t-3\t\t\t\t\t\t\t\t\t\tblun\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Spears\t100\t1\t1\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t84\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Spears\t100\t1\t1\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t84\t-20\t-3\t\t\t\t\t\t\t\t\t\tspea\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blood Golem Summoning\t100\t\t\t24\t\t24\t\tnec\t18\t1\t44\tcharged\t85\t-60\t-6\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blood Golem Summoning\t100\t\t\t48\t\t48\t\tnec\t18\t1\t44\tcharged\t85\t-20\t-3\t\t\t\t\t\t\t\t\t\taxe\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Attraction\t100\t1\t1\t30\t\t30\t\tnec\t24\t1\t44\tcharged\t86\t-60\t-5\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Attraction\t100\t1\t1\t60\t\t60\t\tnec\t24\t1\t44\tcharged\t86\t-20\t-2\t\t\t\t\t\t\t\t\t\tring\tamul\tcirc\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Decrepification\t100\t\t\t30\t\t30\t\tnec\t24\t1\t44\tcharged\t87\t-60\t-5\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Decrepification\t100\t\t\t60\t\t60\t\tnec\t24\t1\t44\tcharged\t87\t-20\t-2\t\t\t\t\t\t\t\t\t\tshld\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Imprisonment\t100\t\t\t30\t\t30\t\tnec\t24\t1\t44\tcharged\t88\t-60\t-5\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Imprisonment\t100\t\t\t60\t\t60\t\tnec\t24\t1\t44\tcharged\t88\t-20\t-2\t\t\t\t\t\t\t\t\t\tmace\tscep\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Iron Golem Creation\t100\t\t\t30\t\t30\t\tnec\t24\t1\t44\tcharged\t90\t-60\t-5\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Iron Golem Creation\t100\t\t\t60\t\t60\t\tnec\t24\t1\t44\tcharged\t90\t-20\t-2\t\t\t\t\t\t\t\t\t\tswor\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lower Resistance\t100\t1\t1\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t91\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lower Resistance\t100\t1\t1\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t91\t-20\t-1\t\t\t\t\t\t\t\t\t\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Poison Novas\t100\t1\t1\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t92\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Poison Novas\t100\t1\t1\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t92\t-20\t-1\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Spirits\t100\t1\t1\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t93\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bone Spirits\t100\t1\t1\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t93\t-20\t-1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Golem Summoning\t100\t\t\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t94\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire Golem Summoning\t100\t\t\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t94\t-20\t-1\t\t\t\t\t\t\t\t\t\thamm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Revivification\t100\t\t\t36\t\t36\t\tnec\t30\t1\t44\tcharged\t95\t-60\t-3\t\t\t\t\t\t\t\t\t\twand\tknif\thead\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Revivification\t100\t\t\t72\t\t72\t\tnec\t30\t1\t44\tcharged\t95\t-20\t-1\t\t\t\t\t\t\t\t\t\tpole\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Sacrifice\t100\t1\t1\t7\t\t7\t\tpal\t1\t1\t44\tcharged\t96\t-30\t-10\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Sacrifice\t100\t1\t1\t14\t\t14\t\tpal\t1\t1\t44\tcharged\t96\t-20\t-6\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"of Holy Bolts\t100\t1\t1\t12\t\t12\t\tpal\t6\t1\t44\tcharged\t101\t-30\t-8\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Holy Bolts\t100\t1\t1\t24\t\t24\t\tpal\t6\t1\t44\tcharged\t101\t-20\t-5\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Zeal\t100\t1\t1\t18\t\t18\t\tpal\t12\t1\t44\tcharged\t106\t-30\t-7\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Zeal\t100\t1\t1\t36\t\t36\t\tpal\t12\t1\t44\tcharged\t106\t-20\t-4\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"of Vengeance\t100\t1\t1\t24\t\t24\t\tpal\t18\t1\t44\tcharged\t111\t-30\t-6\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Vengeance\t100\t1\t1\t48\t\t48\t\tpal\t18\t1\t44\tcharged\t111\t-20\t-3\t\t\t\t\t\t\t\t\t\tswor\taxe\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blessed Hammers\t100\t1\t1\t24\t\t24\t\tpal\t18\t1\t44\tcharged\t112\t-30\t-6\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blessed Hammers\t100\t1\t1\t48\t\t48\t\tpal\t18\t1\t44\tcharged\t112\t-20\t-3\t\t\t\t\t\t\t\t\t\thamm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Conversion\t100\t\t\t30\t\t30\t\tpal\t24\t1\t44\tcharged\t116\t-30\t-5\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Conversion\t100\t\t\t60\t\t60\t\tpal\t24\t1\t44\tcharged\t116\t-20\t-2\t\t\t\t\t\t\t\t\t\tblun\t\t\t\t\t\t\tscep\t\t\t\t\t0\t0\n",
+                u8"of Fist of the Heavens\t100\t\t\t36\t\t36\t\tpal\t30\t1\t44\tcharged\t121\t-30\t-3\t\t\t\t\t\t\t\t\t\tscep\tashd\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fist of the Heavens\t100\t\t\t72\t\t72\t\tpal\t30\t1\t44\tcharged\t121\t-20\t-1\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bashing\t100\t1\t1\t7\t\t7\t\tbar\t1\t1\t44\tcharged\t126\t-60\t-10\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Bashing\t100\t1\t1\t14\t\t14\t\tbar\t1\t1\t44\tcharged\t126\t-20\t-6\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Howling\t100\t\t\t7\t\t7\t\tbar\t1\t1\t44\tcharged\t130\t-60\t-10\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Howling\t100\t\t\t14\t\t14\t\tbar\t1\t1\t44\tcharged\t130\t-20\t-6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Potion Finding\t100\t\t\t7\t\t7\t\tbar\t1\t1\t44\tcharged\t131\t-60\t-10\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Potion Finding\t100\t\t\t14\t\t14\t\tbar\t1\t1\t44\tcharged\t131\t-20\t-6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Taunting\t100\t\t\t12\t\t12\t\tbar\t6\t1\t44\tcharged\t137\t-60\t-8\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Taunting\t100\t\t\t24\t\t24\t\tbar\t6\t1\t44\tcharged\t137\t-20\t-5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shouting\t100\t\t\t12\t\t12\t\tbar\t6\t1\t44\tcharged\t138\t-60\t-8\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shouting\t100\t\t\t24\t\t24\t\tbar\t6\t1\t44\tcharged\t138\t-20\t-5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Stunning\t100\t1\t1\t18\t\t18\t\tbar\t12\t1\t44\tcharged\t139\t-60\t-7\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Stunning\t100\t1\t1\t36\t\t36\t\tbar\t12\t1\t44\tcharged\t139\t-20\t-4\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Item Finding\t100\t\t\t18\t\t18\t\tbar\t12\t1\t44\tcharged\t142\t-60\t-7\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Item Finding\t100\t\t\t36\t\t36\t\tbar\t12\t1\t44\tcharged\t142\t-20\t-4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Concentration\t100\t1\t1\t24\t\t24\t\tbar\t18\t1\t44\tcharged\t144\t-60\t-6\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Concentration\t100\t1\t1\t48\t\t48\t\tbar\t18\t1\t44\tcharged\t144\t-20\t-3\t\t\t\t\t\t\t\t\t\tmele\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Battle Cry\t100\t\t\t24\t\t24\t\tbar\t18\t1\t44\tcharged\t146\t-60\t-6\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Battle Cry\t100\t\t\t48\t\t48\t\tbar\t18\t1\t44\tcharged\t146\t-20\t-3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Battle Orders\t100\t\t\t30\t\t30\t\tbar\t24\t1\t44\tcharged\t149\t-60\t-5\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Battle Orders\t100\t\t\t60\t\t60\t\tbar\t24\t1\t44\tcharged\t149\t-20\t-2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Grim Ward\t100\t1\t1\t30\t\t30\t\tbar\t24\t1\t44\tcharged\t150\t-60\t-5\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Grim Ward\t100\t1\t1\t60\t\t60\t\tbar\t24\t1\t44\tcharged\t150\t-20\t-2\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of War Cry\t100\t\t\t36\t\t36\t\tbar\t30\t1\t44\tcharged\t154\t-60\t-3\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of War Cry\t100\t\t\t72\t\t72\t\tbar\t30\t1\t44\tcharged\t154\t-20\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Battle Command\t100\t\t\t36\t\t36\t\tbar\t30\t1\t44\tcharged\t155\t-60\t-3\t\t\t\t\t\t\t\t\t\tphlm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Battle Command\t100\t\t\t72\t\t72\t\tbar\t30\t1\t44\tcharged\t155\t-20\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Firestorms\t100\t1\t1\t7\t\t7\t\tdru\t1\t1\t44\tcharged\t225\t-30\t-10\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Firestorms\t100\t1\t1\t14\t\t14\t\tdru\t1\t1\t44\tcharged\t225\t-20\t-6\t\t\t\t\t\t\t\t\t\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Molten Boulders\t100\t\t\t12\t\t12\t\tdru\t6\t1\t44\tcharged\t229\t-30\t-8\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Molten Boulders\t100\t\t\t24\t\t24\t\tdru\t6\t1\t44\tcharged\t229\t-20\t-5\t\t\t\t\t\t\t\t\t\tmace\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Eruption\t100\t1\t1\t18\t\t18\t\tdru\t12\t1\t44\tcharged\t234\t-30\t-7\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Eruption\t100\t1\t1\t36\t\t36\t\tdru\t12\t1\t44\tcharged\t234\t-20\t-4\t\t\t\t\t\t\t\t\t\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Cyclone Armor\t100\t\t\t18\t\t18\t\tdru\t12\t1\t44\tcharged\t235\t-30\t-7\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Cyclone Armor\t100\t\t\t36\t\t36\t\tdru\t12\t1\t44\tcharged\t235\t-20\t-4\t\t\t\t\t\t\t\t\t\ttors\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Twister\t100\t1\t1\t24\t\t24\t\tdru\t18\t1\t44\tcharged\t240\t-30\t-6\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Twister\t100\t1\t1\t48\t\t48\t\tdru\t18\t1\t44\tcharged\t240\t-20\t-3\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Volcano\t100\t1\t1\t30\t\t30\t\tdru\t24\t1\t44\tcharged\t244\t-30\t-6\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Volcano\t100\t1\t1\t60\t\t60\t\tdru\t24\t1\t44\tcharged\t244\t-20\t-3\t\t\t\t\t\t\t\t\t\thamm\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Tornado\t100\t1\t1\t30\t\t30\t\tdru\t24\t1\t44\tcharged\t245\t-30\t-5\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Tornado\t100\t1\t1\t60\t\t60\t\tdru\t24\t1\t44\tcharged\t245\t-20\t-2\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Armageddon\t100\t\t\t36\t\t36\t\tdru\t30\t1\t44\tcharged\t249\t-30\t-3\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Armageddon\t100\t\t\t72\t\t72\t\tdru\t30\t1\t44\tcharged\t249\t-20\t-1\t\t\t\t\t\t\t\t\t\tstaf\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Hurricane\t100\t\t\t36\t\t36\t\tdru\t30\t1\t44\tcharged\t250\t-30\t-3\t\t\t\t\t\t\t\t\t\tclub\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Hurricane\t100\t\t\t72\t\t72\t\tdru\t30\t1\t44\tcharged\t250\t-20\t-1\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Damage Amplification\t100\t1\t1\t3\t\t\t\t\t\t1\t44\thit-skill\t66\t5\t1\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\torb\t\t\t\t\t0\t0\n",
+                u8"of the Icicle\t100\t1\t1\t37\t\t29\t\t\t\t2\t10\tcold-min\t\t2\t3\tcold-max\t\t6\t10\tcold-len\t\t50\t50\tdblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Glacier\t100\t1\t\t58\t\t50\t\t\t\t2\t10\tcold-min\t\t4\t5\tcold-max\t\t11\t15\tcold-len\t\t50\t50\tdblu\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire\t100\t1\t1\t36\t\t28\t\t\t\t2\t12\tfire-min\t\t4\t10\tfire-max\t\t11\t30\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Burning\t100\t1\t1\t57\t\t49\t\t\t\t2\t12\tfire-min\t\t11\t25\tfire-max\t\t31\t50\t\t\t\t\tdred\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning\t100\t1\t1\t36\t\t28\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t21\t60\t\t\t\t\tdyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thunder\t100\t1\t1\t57\t\t49\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t61\t100\t\t\t\t\tdyel\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Daring\t100\t1\t1\t19\t\t14\t\t\t\t3\t17\tdex\t\t4\t6\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Daring\t100\t1\t1\t36\t\t28\t\t\t\t3\t17\tdex\t\t7\t9\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Knowledge\t100\t1\t1\t24\t\t18\t\t\t\t3\t23\tenr\t\t4\t6\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Knowledge\t100\t1\t1\t41\t\t33\t\t\t\t3\t23\tenr\t\t7\t9\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Virility\t100\t1\t1\t33\t\t25\t\t\t\t4\t31\tstr\t\t5\t6\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Virility\t100\t1\t1\t50\t\t42\t\t\t\t4\t31\tstr\t\t7\t9\t\t\t\t\t\t\t\t\t\tjewl\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Readiness\t1\t1\t1\t20\t\t15\t\t\t\t2\t7\tswing1\t\t10\t10\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t100\t1\t1\t1\t\t1\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Quality\t100\t1\t1\t41\t\t33\t\t\t\t4\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Maiming\t100\t1\t\t71\t\t63\t\t\t\t4\t14\tdmg-max\t\t3\t4\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t100\t1\t1\t26\t\t19\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Quality\t100\t1\t\t56\t\t48\t\t\t\t4\t14\tdmg-max\t\t2\t2\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Craftsmanship\t100\t1\t1\t85\t\t77\t\t\t\t4\t14\tdmg-max\t\t1\t1\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blight\t100\t1\t1\t1\t\t1\t\t\t\t2\t16\tdmg-pois\t75\t21\t21\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Venom\t100\t1\t1\t6\t\t4\t\t\t\t1\t16\tdmg-pois\t100\t39\t39\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Pestilence\t100\t1\t1\t14\t\t10\t\t\t\t1\t16\tdmg-pois\t125\t52\t52\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Anthrax\t100\t1\t\t21\t\t15\t\t\t\t1\t16\tdmg-pois\t150\t86\t86\t\t\t\t\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blight\t100\t1\t1\t5\t\t3\t\t\t\t2\t16\tdmg-pois\t75\t21\t21\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Venom\t100\t1\t1\t13\t\t9\t\t\t\t1\t16\tdmg-pois\t100\t39\t39\t\t\t\t\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Pestilence\t100\t1\t1\t23\t\t17\t\t\t\t1\t16\tdmg-pois\t125\t52\t52\t\t\t\t\t\t\t\t\tdgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Anthrax\t100\t1\t\t33\t\t25\t\t\t\t1\t16\tdmg-pois\t150\t86\t86\t\t\t\t\t\t\t\t\tdgrn\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Blight\t100\t1\t1\t9\t\t6\t\t\t\t2\t16\tdmg-pois\t75\t21\t21\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Venom\t100\t1\t1\t20\t\t15\t\t\t\t1\t16\tdmg-pois\t100\t39\t39\t\t\t\t\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Pestilence\t100\t1\t1\t32\t\t24\t\t\t\t1\t16\tdmg-pois\t125\t52\t52\t\t\t\t\t\t\t\t\tdgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Anthrax\t100\t1\t\t44\t\t36\t\t\t\t1\t16\tdmg-pois\t150\t86\t86\t\t\t\t\t\t\t\t\tdgrn\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frost\t100\t1\t1\t5\t\t3\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t2\t2\tcold-len\t\t25\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Icicle\t100\t1\t1\t8\t\t6\t\t\t\t1\t10\tcold-min\t\t2\t2\tcold-max\t\t3\t4\tcold-len\t\t25\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Glacier\t100\t1\t1\t15\t\t11\t\t\t\t1\t10\tcold-min\t\t3\t3\tcold-max\t\t5\t7\tcold-len\t\t25\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Winter\t100\t1\t\t23\t\t17\t\t\t\t1\t10\tcold-min\t\t4\t6\tcold-max\t\t8\t11\tcold-len\t\t25\t25\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frost\t100\t1\t1\t9\t\t6\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t2\t3\tcold-len\t\t25\t25\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Icicle\t100\t1\t1\t15\t\t11\t\t\t\t1\t10\tcold-min\t\t2\t2\tcold-max\t\t4\t5\tcold-len\t\t25\t25\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Glacier\t100\t1\t1\t25\t\t18\t\t\t\t1\t10\tcold-min\t\t3\t3\tcold-max\t\t6\t8\tcold-len\t\t25\t25\tdblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Winter\t100\t1\t\t35\t\t27\t\t\t\t1\t10\tcold-min\t\t4\t6\tcold-max\t\t9\t12\tcold-len\t\t25\t25\tdblu\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frost\t100\t1\t1\t14\t\t10\t\t\t\t2\t10\tcold-min\t\t1\t1\tcold-max\t\t2\t2\tcold-len\t\t25\t25\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Icicle\t100\t1\t1\t21\t\t15\t\t\t\t1\t10\tcold-min\t\t2\t2\tcold-max\t\t3\t4\tcold-len\t\t25\t25\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Glacier\t100\t1\t1\t33\t\t25\t\t\t\t1\t10\tcold-min\t\t3\t3\tcold-max\t\t5\t6\tcold-len\t\t25\t25\tdblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Winter\t100\t1\t\t46\t\t38\t\t\t\t1\t10\tcold-min\t\t4\t5\tcold-max\t\t7\t9\tcold-len\t\t25\t25\tdblu\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Flame\t100\t1\t1\t3\t\t2\t\t\t\t2\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t2\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire\t100\t1\t1\t8\t\t6\t\t\t\t1\t12\tfire-min\t\t1\t2\tfire-max\t\t3\t3\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Burning\t100\t1\t1\t14\t\t10\t\t\t\t1\t12\tfire-min\t\t2\t3\tfire-max\t\t4\t7\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Incineration\t100\t1\t\t22\t\t16\t\t\t\t1\t12\tfire-min\t\t4\t7\tfire-max\t\t8\t14\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Flame\t100\t1\t1\t7\t\t5\t\t\t\t2\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t2\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire\t100\t1\t1\t14\t\t10\t\t\t\t1\t12\tfire-min\t\t2\t2\tfire-max\t\t3\t5\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Burning\t100\t1\t1\t24\t\t18\t\t\t\t1\t12\tfire-min\t\t3\t5\tfire-max\t\t6\t11\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Incineration\t100\t1\t\t34\t\t26\t\t\t\t1\t12\tfire-min\t\t6\t10\tfire-max\t\t12\t17\t\t\t\t\tdred\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Flame\t100\t1\t1\t11\t\t8\t\t\t\t2\t12\tfire-min\t\t1\t1\tfire-max\t\t2\t2\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Fire\t100\t1\t1\t20\t\t15\t\t\t\t1\t12\tfire-min\t\t2\t2\tfire-max\t\t3\t4\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Burning\t100\t1\t1\t32\t\t24\t\t\t\t1\t12\tfire-min\t\t3\t4\tfire-max\t\t5\t8\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Incineration\t100\t1\t\t45\t\t37\t\t\t\t1\t12\tfire-min\t\t5\t7\tfire-max\t\t9\t13\t\t\t\t\tdred\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shock\t100\t1\t1\t4\t\t3\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t2\t3\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning\t100\t1\t1\t7\t\t5\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t4\t7\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thunder\t100\t1\t1\t15\t\t11\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t8\t21\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Storms\t100\t1\t\t22\t\t16\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t22\t33\t\t\t\t\t\tlcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shock\t100\t1\t1\t7\t\t5\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t3\t5\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning\t100\t1\t1\t14\t\t10\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t6\t13\t\t\t\t\t\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thunder\t100\t1\t1\t24\t\t18\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t14\t25\t\t\t\t\tdyel\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Storms\t100\t1\t\t34\t\t26\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t26\t38\t\t\t\t\tdyel\tmcha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Shock\t100\t1\t1\t12\t\t9\t\t\t\t2\t13\tltng-min\t\t1\t1\tltng-max\t\t3\t6\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Lightning\t100\t1\t1\t21\t\t15\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t7\t10\t\t\t\t\t\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thunder\t100\t1\t1\t33\t\t25\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t11\t18\t\t\t\t\tdyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Storms\t100\t1\t\t45\t\t37\t\t\t\t1\t13\tltng-min\t\t1\t1\tltng-max\t\t19\t28\t\t\t\t\tdyel\tscha\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t1\t1\t1\t1\t12\t1\t\t\t\t4\t17\tdex\t\t1\t1\t\t\t\t\t\t\t\t\t\tboot\tglov\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Dexterity\t1\t1\t1\t1\t5\t1\t\t\t\t4\t17\tdex\t\t1\t1\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t1\t1\t1\t1\t11\t1\t\t\t\t4\t31\tstr\t\t1\t1\t\t\t\t\t\t\t\t\t\tglov\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Strength\t1\t1\t1\t1\t4\t1\t\t\t\t4\t31\tstr\t\t1\t1\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Thorns\t1\t1\t1\t1\t13\t1\t\t\t\t4\t6\tthorns\t\t1\t1\t\t\t\t\t\t\t\t\t\ttors\tbelt\tshld\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Frost\t1\t1\t1\t1\t3\t1\t\t\t\t4\t10\tdmg-cold\t25\t1\t1\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Flame\t1\t1\t1\t1\t3\t1\t\t\t\t4\t12\tdmg-fire\t\t1\t2\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Blight\t1\t1\t1\t1\t4\t1\t\t\t\t4\t16\tdmg-pois\t50\t8\t8\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tscep\tstaf\torb\t\t\t0\t0\n",
+                u8"of Shock\t1\t1\t1\t1\t3\t1\t\t\t\t4\t13\tdmg-ltng\t\t1\t3\t\t\t\t\t\t\t\t\t\tweap\t\t\t\t\t\t\tstaf\twand\torb\t\t\t0\t0\n",
+                u8"of Regeneration\t1\t1\t1\t1\t9\t1\t\t\t\t3\t19\tregen\t\t2\t2\t\t\t\t\t\t\t\t\t\tamul\tcirc\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of Energy\t1\t1\t1\t1\t4\t1\t\t\t\t4\t23\tenr\t\t1\t1\t\t\t\t\t\t\t\t\t\tamul\torb\tcirc\twand\tstaf\thelm\tring\t\t\t\t\t\t0\t0\n",
+                u8"of Light\t1\t1\t1\t1\t5\t1\t\t\t\t4\t25\tlight\t\t1\t1\tatt\t\t10\t10\t\t\t\t\t\tring\tamul\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Leech\t100\t1\t1\t24\t\t20\t\t\t\t2\t27\tlifesteal\t\t2\t3\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Locust\t100\t1\t1\t57\t\t45\t\t\t\t2\t27\tlifesteal\t\t4\t5\t\t\t\t\t\t\t\t\t\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Lamprey\t100\t1\t1\t85\t\t73\t\t\t\t2\t27\tlifesteal\t\t6\t6\t\t\t\t\t\t\t\t\tcred\tamul\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Bat\t1\t1\t1\t25\t\t21\t\t\t\t2\t28\tmanasteal\t\t2\t3\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Wraith\t1\t1\t1\t58\t\t46\t\t\t\t2\t28\tmanasteal\t\t4\t5\t\t\t\t\t\t\t\t\t\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"of the Vampire\t100\t1\t1\t86\t\t74\t\t\t\t2\t28\tmanasteal\t\t6\t6\t\t\t\t\t\t\t\t\tcred\tring\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
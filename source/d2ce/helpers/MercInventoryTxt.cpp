@@ -18,26 +18,22 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetMercInventoryTxt()
+        EmbeddedText GetMercInventoryTxt()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"location\n";
-                ss << u8"head\n";
-                ss << u8"torso\n";
-                ss << u8"right_arm\n";
-                ss << u8"left_arm\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"location\n",
+                u8"head\n",
+                u8"torso\n",
+                u8"right_arm\n",
+                u8"left_arm\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,2556 +18,2552 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace JsonReaderHelper
     {
-        const std::string& GetMercenaries()
+        EmbeddedText GetMercenaries()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"[\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1019,\n";
-                ss << u8"    \"Key\": \"merca201\",\n";
-                ss << u8"    \"enUS\": \"Hazade\",\n";
-                ss << u8"    \"zhTW\": \"哈撒迪\",\n";
-                ss << u8"    \"deDE\": \"Hasade\",\n";
-                ss << u8"    \"esES\": \"Hazade\",\n";
-                ss << u8"    \"frFR\": \"Hazade\",\n";
-                ss << u8"    \"itIT\": \"Hazade\",\n";
-                ss << u8"    \"koKR\": \"하자데\",\n";
-                ss << u8"    \"plPL\": \"Hazade\",\n";
-                ss << u8"    \"esMX\": \"Hazade\",\n";
-                ss << u8"    \"jaJP\": \"ハザデ\",\n";
-                ss << u8"    \"ptBR\": \"Razade\",\n";
-                ss << u8"    \"ruRU\": \"Хазад\",\n";
-                ss << u8"    \"zhCN\": \"哈扎德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1020,\n";
-                ss << u8"    \"Key\": \"merca202\",\n";
-                ss << u8"    \"enUS\": \"Alhizeer\",\n";
-                ss << u8"    \"zhTW\": \"艾利希爾\",\n";
-                ss << u8"    \"deDE\": \"Alhiseer\",\n";
-                ss << u8"    \"esES\": \"Alhizeer\",\n";
-                ss << u8"    \"frFR\": \"Alhizir\",\n";
-                ss << u8"    \"itIT\": \"Alhizeer\",\n";
-                ss << u8"    \"koKR\": \"알히지르\",\n";
-                ss << u8"    \"plPL\": \"Alhizeer\",\n";
-                ss << u8"    \"esMX\": \"Alhizeer\",\n";
-                ss << u8"    \"jaJP\": \"アルヒッツァ\",\n";
-                ss << u8"    \"ptBR\": \"Alizer\",\n";
-                ss << u8"    \"ruRU\": \"Альхизир\",\n";
-                ss << u8"    \"zhCN\": \"阿西兹尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1021,\n";
-                ss << u8"    \"Key\": \"merca203\",\n";
-                ss << u8"    \"enUS\": \"Azrael\",\n";
-                ss << u8"    \"zhTW\": \"阿撒爾\",\n";
-                ss << u8"    \"deDE\": \"Asrael\",\n";
-                ss << u8"    \"esES\": \"Azrael\",\n";
-                ss << u8"    \"frFR\": \"Azraël\",\n";
-                ss << u8"    \"itIT\": \"Azrael\",\n";
-                ss << u8"    \"koKR\": \"아즈라엘\",\n";
-                ss << u8"    \"plPL\": \"Azrael\",\n";
-                ss << u8"    \"esMX\": \"Azrael\",\n";
-                ss << u8"    \"jaJP\": \"アズラエル\",\n";
-                ss << u8"    \"ptBR\": \"Azrael\",\n";
-                ss << u8"    \"ruRU\": \"Азраэль\",\n";
-                ss << u8"    \"zhCN\": \"艾兹瑞尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1022,\n";
-                ss << u8"    \"Key\": \"merca204\",\n";
-                ss << u8"    \"enUS\": \"Ahsab\",\n";
-                ss << u8"    \"zhTW\": \"亞斯哈\",\n";
-                ss << u8"    \"deDE\": \"Ahsab\",\n";
-                ss << u8"    \"esES\": \"Ahsab\",\n";
-                ss << u8"    \"frFR\": \"Ahsab\",\n";
-                ss << u8"    \"itIT\": \"Ahsab\",\n";
-                ss << u8"    \"koKR\": \"아흐사브\",\n";
-                ss << u8"    \"plPL\": \"Ahsab\",\n";
-                ss << u8"    \"esMX\": \"Ahsab\",\n";
-                ss << u8"    \"jaJP\": \"アーサブ\",\n";
-                ss << u8"    \"ptBR\": \"Asab\",\n";
-                ss << u8"    \"ruRU\": \"Ахсаб\",\n";
-                ss << u8"    \"zhCN\": \"阿萨布\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1023,\n";
-                ss << u8"    \"Key\": \"merca205\",\n";
-                ss << u8"    \"enUS\": \"Chalan\",\n";
-                ss << u8"    \"zhTW\": \"克哈蘭\",\n";
-                ss << u8"    \"deDE\": \"Chalan\",\n";
-                ss << u8"    \"esES\": \"Chalán\",\n";
-                ss << u8"    \"frFR\": \"Chalan\",\n";
-                ss << u8"    \"itIT\": \"Chalan\",\n";
-                ss << u8"    \"koKR\": \"찰란\",\n";
-                ss << u8"    \"plPL\": \"Chalan\",\n";
-                ss << u8"    \"esMX\": \"Chalan\",\n";
-                ss << u8"    \"jaJP\": \"チャラン\",\n";
-                ss << u8"    \"ptBR\": \"Chalan\",\n";
-                ss << u8"    \"ruRU\": \"Чалан\",\n";
-                ss << u8"    \"zhCN\": \"卡兰\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1024,\n";
-                ss << u8"    \"Key\": \"merca206\",\n";
-                ss << u8"    \"enUS\": \"Haseen\",\n";
-                ss << u8"    \"zhTW\": \"哈辛\",\n";
-                ss << u8"    \"deDE\": \"Hasien\",\n";
-                ss << u8"    \"esES\": \"Haseen\",\n";
-                ss << u8"    \"frFR\": \"Hasin\",\n";
-                ss << u8"    \"itIT\": \"Haseen\",\n";
-                ss << u8"    \"koKR\": \"하신\",\n";
-                ss << u8"    \"plPL\": \"Haseen\",\n";
-                ss << u8"    \"esMX\": \"Haseen\",\n";
-                ss << u8"    \"jaJP\": \"ハシーン\",\n";
-                ss << u8"    \"ptBR\": \"Hassin\",\n";
-                ss << u8"    \"ruRU\": \"Хазин\",\n";
-                ss << u8"    \"zhCN\": \"哈辛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1025,\n";
-                ss << u8"    \"Key\": \"merca207\",\n";
-                ss << u8"    \"enUS\": \"Razan\",\n";
-                ss << u8"    \"zhTW\": \"羅森\",\n";
-                ss << u8"    \"deDE\": \"Rasan\",\n";
-                ss << u8"    \"esES\": \"Razán\",\n";
-                ss << u8"    \"frFR\": \"Razan\",\n";
-                ss << u8"    \"itIT\": \"Razan\",\n";
-                ss << u8"    \"koKR\": \"라잔\",\n";
-                ss << u8"    \"plPL\": \"Razan\",\n";
-                ss << u8"    \"esMX\": \"Razan\",\n";
-                ss << u8"    \"jaJP\": \"ラザン\",\n";
-                ss << u8"    \"ptBR\": \"Razan\",\n";
-                ss << u8"    \"ruRU\": \"Разан\",\n";
-                ss << u8"    \"zhCN\": \"拉赞\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1026,\n";
-                ss << u8"    \"Key\": \"merca208\",\n";
-                ss << u8"    \"enUS\": \"Emilio\",\n";
-                ss << u8"    \"zhTW\": \"艾米羅\",\n";
-                ss << u8"    \"deDE\": \"Emilio\",\n";
-                ss << u8"    \"esES\": \"Emilio\",\n";
-                ss << u8"    \"frFR\": \"Emilio\",\n";
-                ss << u8"    \"itIT\": \"Emilio\",\n";
-                ss << u8"    \"koKR\": \"에밀리오\",\n";
-                ss << u8"    \"plPL\": \"Emilio\",\n";
-                ss << u8"    \"esMX\": \"Emilio\",\n";
-                ss << u8"    \"jaJP\": \"エミリオ\",\n";
-                ss << u8"    \"ptBR\": \"Emílio\",\n";
-                ss << u8"    \"ruRU\": \"Эмилио\",\n";
-                ss << u8"    \"zhCN\": \"艾米罗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1027,\n";
-                ss << u8"    \"Key\": \"merca209\",\n";
-                ss << u8"    \"enUS\": \"Pratham\",\n";
-                ss << u8"    \"zhTW\": \"培撒姆\",\n";
-                ss << u8"    \"deDE\": \"Pratham\",\n";
-                ss << u8"    \"esES\": \"Pratham\",\n";
-                ss << u8"    \"frFR\": \"Pratham\",\n";
-                ss << u8"    \"itIT\": \"Pratham\",\n";
-                ss << u8"    \"koKR\": \"프라탐\",\n";
-                ss << u8"    \"plPL\": \"Pratham\",\n";
-                ss << u8"    \"esMX\": \"Pratham\",\n";
-                ss << u8"    \"jaJP\": \"プラサム\",\n";
-                ss << u8"    \"ptBR\": \"Pratam\",\n";
-                ss << u8"    \"ruRU\": \"Пратам\",\n";
-                ss << u8"    \"zhCN\": \"普拉桑\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1028,\n";
-                ss << u8"    \"Key\": \"merca210\",\n";
-                ss << u8"    \"enUS\": \"Fazel\",\n";
-                ss << u8"    \"zhTW\": \"費索\",\n";
-                ss << u8"    \"deDE\": \"Fassel\",\n";
-                ss << u8"    \"esES\": \"Fazel\",\n";
-                ss << u8"    \"frFR\": \"Fazel\",\n";
-                ss << u8"    \"itIT\": \"Fazel\",\n";
-                ss << u8"    \"koKR\": \"파젤\",\n";
-                ss << u8"    \"plPL\": \"Fazel\",\n";
-                ss << u8"    \"esMX\": \"Fazel\",\n";
-                ss << u8"    \"jaJP\": \"フェイゼル\",\n";
-                ss << u8"    \"ptBR\": \"Fazel\",\n";
-                ss << u8"    \"ruRU\": \"Фазиль\",\n";
-                ss << u8"    \"zhCN\": \"菲泽尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1029,\n";
-                ss << u8"    \"Key\": \"merca211\",\n";
-                ss << u8"    \"enUS\": \"Jemali\",\n";
-                ss << u8"    \"zhTW\": \"傑馬利\",\n";
-                ss << u8"    \"deDE\": \"Jemali\",\n";
-                ss << u8"    \"esES\": \"Jemali\",\n";
-                ss << u8"    \"frFR\": \"Jemali\",\n";
-                ss << u8"    \"itIT\": \"Jemali\",\n";
-                ss << u8"    \"koKR\": \"제말리\",\n";
-                ss << u8"    \"plPL\": \"Jemali\",\n";
-                ss << u8"    \"esMX\": \"Jemali\",\n";
-                ss << u8"    \"jaJP\": \"ジェマリ\",\n";
-                ss << u8"    \"ptBR\": \"Jemali\",\n";
-                ss << u8"    \"ruRU\": \"Джемали\",\n";
-                ss << u8"    \"zhCN\": \"杰马里\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1030,\n";
-                ss << u8"    \"Key\": \"merca212\",\n";
-                ss << u8"    \"enUS\": \"Kasim\",\n";
-                ss << u8"    \"zhTW\": \"卡辛姆\",\n";
-                ss << u8"    \"deDE\": \"Kasim\",\n";
-                ss << u8"    \"esES\": \"Kasim\",\n";
-                ss << u8"    \"frFR\": \"Kasim\",\n";
-                ss << u8"    \"itIT\": \"Kasim\",\n";
-                ss << u8"    \"koKR\": \"카심\",\n";
-                ss << u8"    \"plPL\": \"Kasim\",\n";
-                ss << u8"    \"esMX\": \"Kasim\",\n";
-                ss << u8"    \"jaJP\": \"カシム\",\n";
-                ss << u8"    \"ptBR\": \"Kasim\",\n";
-                ss << u8"    \"ruRU\": \"Касим\",\n";
-                ss << u8"    \"zhCN\": \"卡辛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1031,\n";
-                ss << u8"    \"Key\": \"merca213\",\n";
-                ss << u8"    \"enUS\": \"Gulzar\",\n";
-                ss << u8"    \"zhTW\": \"古爾薩\",\n";
-                ss << u8"    \"deDE\": \"Gulsar\",\n";
-                ss << u8"    \"esES\": \"Gulzar\",\n";
-                ss << u8"    \"frFR\": \"Gulzar\",\n";
-                ss << u8"    \"itIT\": \"Gulzar\",\n";
-                ss << u8"    \"koKR\": \"굴자르\",\n";
-                ss << u8"    \"plPL\": \"Gulzar\",\n";
-                ss << u8"    \"esMX\": \"Gulzar\",\n";
-                ss << u8"    \"jaJP\": \"ガルザル\",\n";
-                ss << u8"    \"ptBR\": \"Gulzar\",\n";
-                ss << u8"    \"ruRU\": \"Гюльзар\",\n";
-                ss << u8"    \"zhCN\": \"古札\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1032,\n";
-                ss << u8"    \"Key\": \"merca214\",\n";
-                ss << u8"    \"enUS\": \"Mizan\",\n";
-                ss << u8"    \"zhTW\": \"米山\",\n";
-                ss << u8"    \"deDE\": \"Misan\",\n";
-                ss << u8"    \"esES\": \"Mizán\",\n";
-                ss << u8"    \"frFR\": \"Mizan\",\n";
-                ss << u8"    \"itIT\": \"Mizan\",\n";
-                ss << u8"    \"koKR\": \"미잔\",\n";
-                ss << u8"    \"plPL\": \"Mizan\",\n";
-                ss << u8"    \"esMX\": \"Mizan\",\n";
-                ss << u8"    \"jaJP\": \"ミザン\",\n";
-                ss << u8"    \"ptBR\": \"Mizan\",\n";
-                ss << u8"    \"ruRU\": \"Мизан\",\n";
-                ss << u8"    \"zhCN\": \"米山\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1033,\n";
-                ss << u8"    \"Key\": \"merca215\",\n";
-                ss << u8"    \"enUS\": \"Leharas\",\n";
-                ss << u8"    \"zhTW\": \"雷哈拉\",\n";
-                ss << u8"    \"deDE\": \"Leharas\",\n";
-                ss << u8"    \"esES\": \"Leharas\",\n";
-                ss << u8"    \"frFR\": \"Leharas\",\n";
-                ss << u8"    \"itIT\": \"Leharas\",\n";
-                ss << u8"    \"koKR\": \"레하라스\",\n";
-                ss << u8"    \"plPL\": \"Leharas\",\n";
-                ss << u8"    \"esMX\": \"Leharas\",\n";
-                ss << u8"    \"jaJP\": \"レハラス\",\n";
-                ss << u8"    \"ptBR\": \"Learas\",\n";
-                ss << u8"    \"ruRU\": \"Лехарас\",\n";
-                ss << u8"    \"zhCN\": \"勒哈纳斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1034,\n";
-                ss << u8"    \"Key\": \"merca216\",\n";
-                ss << u8"    \"enUS\": \"Durga\",\n";
-                ss << u8"    \"zhTW\": \"杜爾加\",\n";
-                ss << u8"    \"deDE\": \"Durga\",\n";
-                ss << u8"    \"esES\": \"Durga\",\n";
-                ss << u8"    \"frFR\": \"Durga\",\n";
-                ss << u8"    \"itIT\": \"Durga\",\n";
-                ss << u8"    \"koKR\": \"두르가\",\n";
-                ss << u8"    \"plPL\": \"Durga\",\n";
-                ss << u8"    \"esMX\": \"Durga\",\n";
-                ss << u8"    \"jaJP\": \"ダルガ\",\n";
-                ss << u8"    \"ptBR\": \"Durga\",\n";
-                ss << u8"    \"ruRU\": \"Дурга\",\n";
-                ss << u8"    \"zhCN\": \"杜尔加\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1035,\n";
-                ss << u8"    \"Key\": \"merca217\",\n";
-                ss << u8"    \"enUS\": \"Neeraj\",\n";
-                ss << u8"    \"zhTW\": \"尼爾亞\",\n";
-                ss << u8"    \"deDE\": \"Neeraj\",\n";
-                ss << u8"    \"esES\": \"Neeraj\",\n";
-                ss << u8"    \"frFR\": \"Niraj\",\n";
-                ss << u8"    \"itIT\": \"Neeraj\",\n";
-                ss << u8"    \"koKR\": \"니라즈\",\n";
-                ss << u8"    \"plPL\": \"Neeraj\",\n";
-                ss << u8"    \"esMX\": \"Neeraj\",\n";
-                ss << u8"    \"jaJP\": \"ニーラジュ\",\n";
-                ss << u8"    \"ptBR\": \"Niraj\",\n";
-                ss << u8"    \"ruRU\": \"Нирадж\",\n";
-                ss << u8"    \"zhCN\": \"妮拉吉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1036,\n";
-                ss << u8"    \"Key\": \"merca218\",\n";
-                ss << u8"    \"enUS\": \"Ilzan\",\n";
-                ss << u8"    \"zhTW\": \"伊爾森\",\n";
-                ss << u8"    \"deDE\": \"Ilsan\",\n";
-                ss << u8"    \"esES\": \"Ilzán\",\n";
-                ss << u8"    \"frFR\": \"Ilzan\",\n";
-                ss << u8"    \"itIT\": \"Ilzan\",\n";
-                ss << u8"    \"koKR\": \"준영\",\n";
-                ss << u8"    \"plPL\": \"Ilzan\",\n";
-                ss << u8"    \"esMX\": \"Ilzan\",\n";
-                ss << u8"    \"jaJP\": \"イルザン\",\n";
-                ss << u8"    \"ptBR\": \"Ilzan\",\n";
-                ss << u8"    \"ruRU\": \"Ильзан\",\n";
-                ss << u8"    \"zhCN\": \"伊尔赞\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1037,\n";
-                ss << u8"    \"Key\": \"merca219\",\n";
-                ss << u8"    \"enUS\": \"Zanarhi\",\n";
-                ss << u8"    \"zhTW\": \"撒那利\",\n";
-                ss << u8"    \"deDE\": \"Zanarhi\",\n";
-                ss << u8"    \"esES\": \"Zanarhi\",\n";
-                ss << u8"    \"frFR\": \"Zanarhi\",\n";
-                ss << u8"    \"itIT\": \"Zanarhi\",\n";
-                ss << u8"    \"koKR\": \"자나르히\",\n";
-                ss << u8"    \"plPL\": \"Zanarhi\",\n";
-                ss << u8"    \"esMX\": \"Zanarhi\",\n";
-                ss << u8"    \"jaJP\": \"ザナルヒ\",\n";
-                ss << u8"    \"ptBR\": \"Zanari\",\n";
-                ss << u8"    \"ruRU\": \"Занари\",\n";
-                ss << u8"    \"zhCN\": \"扎纳尔西\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1038,\n";
-                ss << u8"    \"Key\": \"merca220\",\n";
-                ss << u8"    \"enUS\": \"Waheed\",\n";
-                ss << u8"    \"zhTW\": \"瓦黑德\",\n";
-                ss << u8"    \"deDE\": \"Wahid\",\n";
-                ss << u8"    \"esES\": \"Waheed\",\n";
-                ss << u8"    \"frFR\": \"Wahid\",\n";
-                ss << u8"    \"itIT\": \"Waheed\",\n";
-                ss << u8"    \"koKR\": \"와히드\",\n";
-                ss << u8"    \"plPL\": \"Waheed\",\n";
-                ss << u8"    \"esMX\": \"Waheed\",\n";
-                ss << u8"    \"jaJP\": \"ワヒード\",\n";
-                ss << u8"    \"ptBR\": \"Warrid\",\n";
-                ss << u8"    \"ruRU\": \"Вахид\",\n";
-                ss << u8"    \"zhCN\": \"瓦希德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1039,\n";
-                ss << u8"    \"Key\": \"merca221\",\n";
-                ss << u8"    \"enUS\": \"Vikhyat\",\n";
-                ss << u8"    \"zhTW\": \"維克懷特\",\n";
-                ss << u8"    \"deDE\": \"Vichiat\",\n";
-                ss << u8"    \"esES\": \"Vikhyat\",\n";
-                ss << u8"    \"frFR\": \"Vikhyat\",\n";
-                ss << u8"    \"itIT\": \"Vikhyat\",\n";
-                ss << u8"    \"koKR\": \"비크햐트\",\n";
-                ss << u8"    \"plPL\": \"Vikhyat\",\n";
-                ss << u8"    \"esMX\": \"Vikhyat\",\n";
-                ss << u8"    \"jaJP\": \"ヴィクヒャト\",\n";
-                ss << u8"    \"ptBR\": \"Vikiat\",\n";
-                ss << u8"    \"ruRU\": \"Вихьят\",\n";
-                ss << u8"    \"zhCN\": \"维希亚特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1040,\n";
-                ss << u8"    \"Key\": \"merca222\",\n";
-                ss << u8"    \"enUS\": \"Jelani\",\n";
-                ss << u8"    \"zhTW\": \"賈拉尼\",\n";
-                ss << u8"    \"deDE\": \"Jelani\",\n";
-                ss << u8"    \"esES\": \"Jelani\",\n";
-                ss << u8"    \"frFR\": \"Jelani\",\n";
-                ss << u8"    \"itIT\": \"Jelani\",\n";
-                ss << u8"    \"koKR\": \"젤라니\",\n";
-                ss << u8"    \"plPL\": \"Jelani\",\n";
-                ss << u8"    \"esMX\": \"Jelani\",\n";
-                ss << u8"    \"jaJP\": \"ジェラーニ\",\n";
-                ss << u8"    \"ptBR\": \"Jelani\",\n";
-                ss << u8"    \"ruRU\": \"Джелани\",\n";
-                ss << u8"    \"zhCN\": \"杰拉尼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1041,\n";
-                ss << u8"    \"Key\": \"merca223\",\n";
-                ss << u8"    \"enUS\": \"Barani\",\n";
-                ss << u8"    \"zhTW\": \"巴拉尼\",\n";
-                ss << u8"    \"deDE\": \"Barani\",\n";
-                ss << u8"    \"esES\": \"Barani\",\n";
-                ss << u8"    \"frFR\": \"Barani\",\n";
-                ss << u8"    \"itIT\": \"Barani\",\n";
-                ss << u8"    \"koKR\": \"석철\",\n";
-                ss << u8"    \"plPL\": \"Barani\",\n";
-                ss << u8"    \"esMX\": \"Barani\",\n";
-                ss << u8"    \"jaJP\": \"バラーニ\",\n";
-                ss << u8"    \"ptBR\": \"Barani\",\n";
-                ss << u8"    \"ruRU\": \"Барани\",\n";
-                ss << u8"    \"zhCN\": \"巴纳尼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1042,\n";
-                ss << u8"    \"Key\": \"merca224\",\n";
-                ss << u8"    \"enUS\": \"Jabari\",\n";
-                ss << u8"    \"zhTW\": \"賈巴利\",\n";
-                ss << u8"    \"deDE\": \"Jabari\",\n";
-                ss << u8"    \"esES\": \"Jabari\",\n";
-                ss << u8"    \"frFR\": \"Jabari\",\n";
-                ss << u8"    \"itIT\": \"Jabari\",\n";
-                ss << u8"    \"koKR\": \"성호\",\n";
-                ss << u8"    \"plPL\": \"Jabari\",\n";
-                ss << u8"    \"esMX\": \"Jabari\",\n";
-                ss << u8"    \"jaJP\": \"ジャバリ\",\n";
-                ss << u8"    \"ptBR\": \"Jabari\",\n";
-                ss << u8"    \"ruRU\": \"Джабари\",\n";
-                ss << u8"    \"zhCN\": \"贾巴里\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1043,\n";
-                ss << u8"    \"Key\": \"merca225\",\n";
-                ss << u8"    \"enUS\": \"Devak\",\n";
-                ss << u8"    \"zhTW\": \"迪法\",\n";
-                ss << u8"    \"deDE\": \"Devak\",\n";
-                ss << u8"    \"esES\": \"Devak\",\n";
-                ss << u8"    \"frFR\": \"Devak\",\n";
-                ss << u8"    \"itIT\": \"Devak\",\n";
-                ss << u8"    \"koKR\": \"데바크\",\n";
-                ss << u8"    \"plPL\": \"Devak\",\n";
-                ss << u8"    \"esMX\": \"Devak\",\n";
-                ss << u8"    \"jaJP\": \"デヴァク\",\n";
-                ss << u8"    \"ptBR\": \"Devak\",\n";
-                ss << u8"    \"ruRU\": \"Девак\",\n";
-                ss << u8"    \"zhCN\": \"德瓦克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1044,\n";
-                ss << u8"    \"Key\": \"merca226\",\n";
-                ss << u8"    \"enUS\": \"Raldin\",\n";
-                ss << u8"    \"zhTW\": \"拉爾丁\",\n";
-                ss << u8"    \"deDE\": \"Raldin\",\n";
-                ss << u8"    \"esES\": \"Raldín\",\n";
-                ss << u8"    \"frFR\": \"Raldin\",\n";
-                ss << u8"    \"itIT\": \"Raldin\",\n";
-                ss << u8"    \"koKR\": \"랄딘\",\n";
-                ss << u8"    \"plPL\": \"Raldin\",\n";
-                ss << u8"    \"esMX\": \"Raldin\",\n";
-                ss << u8"    \"jaJP\": \"ラルディン\",\n";
-                ss << u8"    \"ptBR\": \"Raldin\",\n";
-                ss << u8"    \"ruRU\": \"Ралдин\",\n";
-                ss << u8"    \"zhCN\": \"拉尔丁\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1045,\n";
-                ss << u8"    \"Key\": \"merca227\",\n";
-                ss << u8"    \"enUS\": \"Telash\",\n";
-                ss << u8"    \"zhTW\": \"鐵拉西\",\n";
-                ss << u8"    \"deDE\": \"Telasch\",\n";
-                ss << u8"    \"esES\": \"Telash\",\n";
-                ss << u8"    \"frFR\": \"Telash\",\n";
-                ss << u8"    \"itIT\": \"Telash\",\n";
-                ss << u8"    \"koKR\": \"텔라시\",\n";
-                ss << u8"    \"plPL\": \"Telash\",\n";
-                ss << u8"    \"esMX\": \"Telash\",\n";
-                ss << u8"    \"jaJP\": \"テラッシュ\",\n";
-                ss << u8"    \"ptBR\": \"Telash\",\n";
-                ss << u8"    \"ruRU\": \"Телаш\",\n";
-                ss << u8"    \"zhCN\": \"特拉斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1046,\n";
-                ss << u8"    \"Key\": \"merca228\",\n";
-                ss << u8"    \"enUS\": \"Ajheed\",\n";
-                ss << u8"    \"zhTW\": \"艾傑希德\",\n";
-                ss << u8"    \"deDE\": \"Ajheed\",\n";
-                ss << u8"    \"esES\": \"Ajheed\",\n";
-                ss << u8"    \"frFR\": \"Ajhid\",\n";
-                ss << u8"    \"itIT\": \"Ajheed\",\n";
-                ss << u8"    \"koKR\": \"아지드\",\n";
-                ss << u8"    \"plPL\": \"Ajheed\",\n";
-                ss << u8"    \"esMX\": \"Ajheed\",\n";
-                ss << u8"    \"jaJP\": \"アジュヒード\",\n";
-                ss << u8"    \"ptBR\": \"Ajid\",\n";
-                ss << u8"    \"ruRU\": \"Аджид\",\n";
-                ss << u8"    \"zhCN\": \"阿吉希德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1047,\n";
-                ss << u8"    \"Key\": \"merca229\",\n";
-                ss << u8"    \"enUS\": \"Narphet\",\n";
-                ss << u8"    \"zhTW\": \"拿費特\",\n";
-                ss << u8"    \"deDE\": \"Narphet\",\n";
-                ss << u8"    \"esES\": \"Narphet\",\n";
-                ss << u8"    \"frFR\": \"Narphet\",\n";
-                ss << u8"    \"itIT\": \"Narphet\",\n";
-                ss << u8"    \"koKR\": \"나르페트\",\n";
-                ss << u8"    \"plPL\": \"Narphet\",\n";
-                ss << u8"    \"esMX\": \"Narphet\",\n";
-                ss << u8"    \"jaJP\": \"ナルフェット\",\n";
-                ss << u8"    \"ptBR\": \"Narfet\",\n";
-                ss << u8"    \"ruRU\": \"Нарфет\",\n";
-                ss << u8"    \"zhCN\": \"纳菲特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1048,\n";
-                ss << u8"    \"Key\": \"merca230\",\n";
-                ss << u8"    \"enUS\": \"Khaleel\",\n";
-                ss << u8"    \"zhTW\": \"凱立爾\",\n";
-                ss << u8"    \"deDE\": \"Khalil\",\n";
-                ss << u8"    \"esES\": \"Khaleel\",\n";
-                ss << u8"    \"frFR\": \"Khalil\",\n";
-                ss << u8"    \"itIT\": \"Khaleel\",\n";
-                ss << u8"    \"koKR\": \"칼릴\",\n";
-                ss << u8"    \"plPL\": \"Khaleel\",\n";
-                ss << u8"    \"esMX\": \"Khalil\",\n";
-                ss << u8"    \"jaJP\": \"カリール\",\n";
-                ss << u8"    \"ptBR\": \"Khalil\",\n";
-                ss << u8"    \"ruRU\": \"Халил\",\n";
-                ss << u8"    \"zhCN\": \"卡里尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1049,\n";
-                ss << u8"    \"Key\": \"merca231\",\n";
-                ss << u8"    \"enUS\": \"Phaet\",\n";
-                ss << u8"    \"zhTW\": \"費特\",\n";
-                ss << u8"    \"deDE\": \"Phaet\",\n";
-                ss << u8"    \"esES\": \"Phaet\",\n";
-                ss << u8"    \"frFR\": \"Phaet\",\n";
-                ss << u8"    \"itIT\": \"Phaet\",\n";
-                ss << u8"    \"koKR\": \"파에트\",\n";
-                ss << u8"    \"plPL\": \"Phaet\",\n";
-                ss << u8"    \"esMX\": \"Phaet\",\n";
-                ss << u8"    \"jaJP\": \"フィート\",\n";
-                ss << u8"    \"ptBR\": \"Fet\",\n";
-                ss << u8"    \"ruRU\": \"Фаэт\",\n";
-                ss << u8"    \"zhCN\": \"菲伊特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1050,\n";
-                ss << u8"    \"Key\": \"merca232\",\n";
-                ss << u8"    \"enUS\": \"Geshef\",\n";
-                ss << u8"    \"zhTW\": \"杰希夫\",\n";
-                ss << u8"    \"deDE\": \"Geschef\",\n";
-                ss << u8"    \"esES\": \"Geshef\",\n";
-                ss << u8"    \"frFR\": \"Geshef\",\n";
-                ss << u8"    \"itIT\": \"Geshef\",\n";
-                ss << u8"    \"koKR\": \"게셰프\",\n";
-                ss << u8"    \"plPL\": \"Geshef\",\n";
-                ss << u8"    \"esMX\": \"Geshef\",\n";
-                ss << u8"    \"jaJP\": \"ゲシェフ\",\n";
-                ss << u8"    \"ptBR\": \"Geshef\",\n";
-                ss << u8"    \"ruRU\": \"Гешеф\",\n";
-                ss << u8"    \"zhCN\": \"基舍夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1051,\n";
-                ss << u8"    \"Key\": \"merca233\",\n";
-                ss << u8"    \"enUS\": \"Vanji\",\n";
-                ss << u8"    \"zhTW\": \"凡吉\",\n";
-                ss << u8"    \"deDE\": \"Vanji\",\n";
-                ss << u8"    \"esES\": \"Vanji\",\n";
-                ss << u8"    \"frFR\": \"Vanji\",\n";
-                ss << u8"    \"itIT\": \"Vanji\",\n";
-                ss << u8"    \"koKR\": \"밴지\",\n";
-                ss << u8"    \"plPL\": \"Vanji\",\n";
-                ss << u8"    \"esMX\": \"Vanji\",\n";
-                ss << u8"    \"jaJP\": \"ヴァンジ\",\n";
-                ss << u8"    \"ptBR\": \"Vanji\",\n";
-                ss << u8"    \"ruRU\": \"Ванджи\",\n";
-                ss << u8"    \"zhCN\": \"万基\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1052,\n";
-                ss << u8"    \"Key\": \"merca234\",\n";
-                ss << u8"    \"enUS\": \"Haphet\",\n";
-                ss << u8"    \"zhTW\": \"海費特\",\n";
-                ss << u8"    \"deDE\": \"Haphet\",\n";
-                ss << u8"    \"esES\": \"Haphet\",\n";
-                ss << u8"    \"frFR\": \"Haphet\",\n";
-                ss << u8"    \"itIT\": \"Haphet\",\n";
-                ss << u8"    \"koKR\": \"하페트\",\n";
-                ss << u8"    \"plPL\": \"Haphet\",\n";
-                ss << u8"    \"esMX\": \"Haphet\",\n";
-                ss << u8"    \"jaJP\": \"ハフェット\",\n";
-                ss << u8"    \"ptBR\": \"Hafet\",\n";
-                ss << u8"    \"ruRU\": \"Хафет\",\n";
-                ss << u8"    \"zhCN\": \"哈菲特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1053,\n";
-                ss << u8"    \"Key\": \"merca235\",\n";
-                ss << u8"    \"enUS\": \"Thadar\",\n";
-                ss << u8"    \"zhTW\": \"撒達\",\n";
-                ss << u8"    \"deDE\": \"Thadar\",\n";
-                ss << u8"    \"esES\": \"Thadar\",\n";
-                ss << u8"    \"frFR\": \"Thadar\",\n";
-                ss << u8"    \"itIT\": \"Thadar\",\n";
-                ss << u8"    \"koKR\": \"타다르\",\n";
-                ss << u8"    \"plPL\": \"Thadar\",\n";
-                ss << u8"    \"esMX\": \"Tadar\",\n";
-                ss << u8"    \"jaJP\": \"サダル\",\n";
-                ss << u8"    \"ptBR\": \"Tadar\",\n";
-                ss << u8"    \"ruRU\": \"Тадар\",\n";
-                ss << u8"    \"zhCN\": \"萨达尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1054,\n";
-                ss << u8"    \"Key\": \"merca236\",\n";
-                ss << u8"    \"enUS\": \"Yatiraj\",\n";
-                ss << u8"    \"zhTW\": \"亞提賈\",\n";
-                ss << u8"    \"deDE\": \"Yatiraj\",\n";
-                ss << u8"    \"esES\": \"Yatiraj\",\n";
-                ss << u8"    \"frFR\": \"Yatiraj\",\n";
-                ss << u8"    \"itIT\": \"Yatiraj\",\n";
-                ss << u8"    \"koKR\": \"야티라즈\",\n";
-                ss << u8"    \"plPL\": \"Yatiraj\",\n";
-                ss << u8"    \"esMX\": \"Yatiraj\",\n";
-                ss << u8"    \"jaJP\": \"ヤティラジュ\",\n";
-                ss << u8"    \"ptBR\": \"Yatiraj\",\n";
-                ss << u8"    \"ruRU\": \"Ятираж\",\n";
-                ss << u8"    \"zhCN\": \"亚提拉吉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1055,\n";
-                ss << u8"    \"Key\": \"merca237\",\n";
-                ss << u8"    \"enUS\": \"Rhadge\",\n";
-                ss << u8"    \"zhTW\": \"拉黑德\",\n";
-                ss << u8"    \"deDE\": \"Rhadge\",\n";
-                ss << u8"    \"esES\": \"Rhadge\",\n";
-                ss << u8"    \"frFR\": \"Rhadge\",\n";
-                ss << u8"    \"itIT\": \"Rhadge\",\n";
-                ss << u8"    \"koKR\": \"라드게\",\n";
-                ss << u8"    \"plPL\": \"Rhadge\",\n";
-                ss << u8"    \"esMX\": \"Rhadge\",\n";
-                ss << u8"    \"jaJP\": \"ラッジ\",\n";
-                ss << u8"    \"ptBR\": \"Rade\",\n";
-                ss << u8"    \"ruRU\": \"Радге\",\n";
-                ss << u8"    \"zhCN\": \"拉德吉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1056,\n";
-                ss << u8"    \"Key\": \"merca238\",\n";
-                ss << u8"    \"enUS\": \"Yashied\",\n";
-                ss << u8"    \"zhTW\": \"亞席德\",\n";
-                ss << u8"    \"deDE\": \"Yaschid\",\n";
-                ss << u8"    \"esES\": \"Yashied\",\n";
-                ss << u8"    \"frFR\": \"Yashied\",\n";
-                ss << u8"    \"itIT\": \"Yashied\",\n";
-                ss << u8"    \"koKR\": \"야시에드\",\n";
-                ss << u8"    \"plPL\": \"Yashied\",\n";
-                ss << u8"    \"esMX\": \"Yashied\",\n";
-                ss << u8"    \"jaJP\": \"ヤシード\",\n";
-                ss << u8"    \"ptBR\": \"Yashid\",\n";
-                ss << u8"    \"ruRU\": \"Яшид\",\n";
-                ss << u8"    \"zhCN\": \"亚希艾德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1057,\n";
-                ss << u8"    \"Key\": \"merca239\",\n";
-                ss << u8"    \"enUS\": \"Jarulf\",\n";
-                ss << u8"    \"zhTW\": \"賈魯夫\",\n";
-                ss << u8"    \"deDE\": \"Jarulf\",\n";
-                ss << u8"    \"esES\": \"Jarulf\",\n";
-                ss << u8"    \"frFR\": \"Jarulf\",\n";
-                ss << u8"    \"itIT\": \"Jarulf\",\n";
-                ss << u8"    \"koKR\": \"자룰프\",\n";
-                ss << u8"    \"plPL\": \"Jarulf\",\n";
-                ss << u8"    \"esMX\": \"Jarulf\",\n";
-                ss << u8"    \"jaJP\": \"ジャラルフ\",\n";
-                ss << u8"    \"ptBR\": \"Jarulf\",\n";
-                ss << u8"    \"ruRU\": \"Ярульф\",\n";
-                ss << u8"    \"zhCN\": \"亚鲁夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1058,\n";
-                ss << u8"    \"Key\": \"merca240\",\n";
-                ss << u8"    \"enUS\": \"Flux\",\n";
-                ss << u8"    \"zhTW\": \"弗勒克斯\",\n";
-                ss << u8"    \"deDE\": \"Flux\",\n";
-                ss << u8"    \"esES\": \"Flujo\",\n";
-                ss << u8"    \"frFR\": \"Flux\",\n";
-                ss << u8"    \"itIT\": \"Flux\",\n";
-                ss << u8"    \"koKR\": \"플럭스\",\n";
-                ss << u8"    \"plPL\": \"Flux\",\n";
-                ss << u8"    \"esMX\": \"Flux\",\n";
-                ss << u8"    \"jaJP\": \"フラックス\",\n";
-                ss << u8"    \"ptBR\": \"Flux\",\n";
-                ss << u8"    \"ruRU\": \"Флакс\",\n";
-                ss << u8"    \"zhCN\": \"弗拉克斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1059,\n";
-                ss << u8"    \"Key\": \"merca241\",\n";
-                ss << u8"    \"enUS\": \"Scorch\",\n";
-                ss << u8"    \"zhTW\": \"斯高屈\",\n";
-                ss << u8"    \"deDE\": \"Scorch\",\n";
-                ss << u8"    \"esES\": \"Quemar\",\n";
-                ss << u8"    \"frFR\": \"Cram\",\n";
-                ss << u8"    \"itIT\": \"Scorch\",\n";
-                ss << u8"    \"koKR\": \"스코치\",\n";
-                ss << u8"    \"plPL\": \"Scorch\",\n";
-                ss << u8"    \"esMX\": \"Calcinar\",\n";
-                ss << u8"    \"jaJP\": \"スコルチ\",\n";
-                ss << u8"    \"ptBR\": \"Scorch\",\n";
-                ss << u8"    \"ruRU\": \"Скорч\",\n";
-                ss << u8"    \"zhCN\": \"斯科奇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3411,\n";
-                ss << u8"    \"Key\": \"merc01\",\n";
-                ss << u8"    \"enUS\": \"Aliza\",\n";
-                ss << u8"    \"zhTW\": \"艾莉薩\",\n";
-                ss << u8"    \"deDE\": \"Alisa\",\n";
-                ss << u8"    \"esES\": \"Aliza\",\n";
-                ss << u8"    \"frFR\": \"Aliza\",\n";
-                ss << u8"    \"itIT\": \"Aliza\",\n";
-                ss << u8"    \"koKR\": \"알리자\",\n";
-                ss << u8"    \"plPL\": \"Aliza\",\n";
-                ss << u8"    \"esMX\": \"Aliza\",\n";
-                ss << u8"    \"jaJP\": \"アリザ\",\n";
-                ss << u8"    \"ptBR\": \"Aliza\",\n";
-                ss << u8"    \"ruRU\": \"Ализа\",\n";
-                ss << u8"    \"zhCN\": \"阿丽萨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3412,\n";
-                ss << u8"    \"Key\": \"merc02\",\n";
-                ss << u8"    \"enUS\": \"Amplisa\",\n";
-                ss << u8"    \"zhTW\": \"安普利莎\",\n";
-                ss << u8"    \"deDE\": \"Amplisa\",\n";
-                ss << u8"    \"esES\": \"Amplisa\",\n";
-                ss << u8"    \"frFR\": \"Amplisa\",\n";
-                ss << u8"    \"itIT\": \"Amplisa\",\n";
-                ss << u8"    \"koKR\": \"암플리사\",\n";
-                ss << u8"    \"plPL\": \"Amplisa\",\n";
-                ss << u8"    \"esMX\": \"Amplisa\",\n";
-                ss << u8"    \"jaJP\": \"アンプリーサ\",\n";
-                ss << u8"    \"ptBR\": \"Amplisa\",\n";
-                ss << u8"    \"ruRU\": \"Амплиса\",\n";
-                ss << u8"    \"zhCN\": \"安普丽萨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3413,\n";
-                ss << u8"    \"Key\": \"merc03\",\n";
-                ss << u8"    \"enUS\": \"Annor\",\n";
-                ss << u8"    \"zhTW\": \"安諾\",\n";
-                ss << u8"    \"deDE\": \"Annor\",\n";
-                ss << u8"    \"esES\": \"Annor\",\n";
-                ss << u8"    \"frFR\": \"Annor\",\n";
-                ss << u8"    \"itIT\": \"Annor\",\n";
-                ss << u8"    \"koKR\": \"안노르\",\n";
-                ss << u8"    \"plPL\": \"Annor\",\n";
-                ss << u8"    \"esMX\": \"Annor\",\n";
-                ss << u8"    \"jaJP\": \"アノール\",\n";
-                ss << u8"    \"ptBR\": \"Annor\",\n";
-                ss << u8"    \"ruRU\": \"Аннор\",\n";
-                ss << u8"    \"zhCN\": \"安诺儿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3414,\n";
-                ss << u8"    \"Key\": \"merc04\",\n";
-                ss << u8"    \"enUS\": \"Abhaya\",\n";
-                ss << u8"    \"zhTW\": \"艾伯海雅\",\n";
-                ss << u8"    \"deDE\": \"Abhaya\",\n";
-                ss << u8"    \"esES\": \"Abhaya\",\n";
-                ss << u8"    \"frFR\": \"Abhaya\",\n";
-                ss << u8"    \"itIT\": \"Abhaya\",\n";
-                ss << u8"    \"koKR\": \"아브하야\",\n";
-                ss << u8"    \"plPL\": \"Abhaya\",\n";
-                ss << u8"    \"esMX\": \"Abhaya\",\n";
-                ss << u8"    \"jaJP\": \"アブハヤ\",\n";
-                ss << u8"    \"ptBR\": \"Abaia\",\n";
-                ss << u8"    \"ruRU\": \"Абайя\",\n";
-                ss << u8"    \"zhCN\": \"阿巴雅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3415,\n";
-                ss << u8"    \"Key\": \"merc05\",\n";
-                ss << u8"    \"enUS\": \"Elly\",\n";
-                ss << u8"    \"zhTW\": \"艾莉\",\n";
-                ss << u8"    \"deDE\": \"Elly\",\n";
-                ss << u8"    \"esES\": \"Elly\",\n";
-                ss << u8"    \"frFR\": \"Elly\",\n";
-                ss << u8"    \"itIT\": \"Elly\",\n";
-                ss << u8"    \"koKR\": \"엘리\",\n";
-                ss << u8"    \"plPL\": \"Elly\",\n";
-                ss << u8"    \"esMX\": \"Elly\",\n";
-                ss << u8"    \"jaJP\": \"エリー\",\n";
-                ss << u8"    \"ptBR\": \"Elly\",\n";
-                ss << u8"    \"ruRU\": \"Элли\",\n";
-                ss << u8"    \"zhCN\": \"艾丽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3416,\n";
-                ss << u8"    \"Key\": \"merc06\",\n";
-                ss << u8"    \"enUS\": \"Paige\",\n";
-                ss << u8"    \"zhTW\": \"佩吉\",\n";
-                ss << u8"    \"deDE\": \"Paige\",\n";
-                ss << u8"    \"esES\": \"Paige\",\n";
-                ss << u8"    \"frFR\": \"Paige\",\n";
-                ss << u8"    \"itIT\": \"Paige\",\n";
-                ss << u8"    \"koKR\": \"페이지\",\n";
-                ss << u8"    \"plPL\": \"Paige\",\n";
-                ss << u8"    \"esMX\": \"Paige\",\n";
-                ss << u8"    \"jaJP\": \"ペイジ\",\n";
-                ss << u8"    \"ptBR\": \"Priscila\",\n";
-                ss << u8"    \"ruRU\": \"Пейдж\",\n";
-                ss << u8"    \"zhCN\": \"派吉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3417,\n";
-                ss << u8"    \"Key\": \"merc07\",\n";
-                ss << u8"    \"enUS\": \"Basanti\",\n";
-                ss << u8"    \"zhTW\": \"巴森媞\",\n";
-                ss << u8"    \"deDE\": \"Basanti\",\n";
-                ss << u8"    \"esES\": \"Basanti\",\n";
-                ss << u8"    \"frFR\": \"Basanti\",\n";
-                ss << u8"    \"itIT\": \"Basanti\",\n";
-                ss << u8"    \"koKR\": \"바산티\",\n";
-                ss << u8"    \"plPL\": \"Basanti\",\n";
-                ss << u8"    \"esMX\": \"Basanti\",\n";
-                ss << u8"    \"jaJP\": \"バサンティ\",\n";
-                ss << u8"    \"ptBR\": \"Basanti\",\n";
-                ss << u8"    \"ruRU\": \"Басанти\",\n";
-                ss << u8"    \"zhCN\": \"巴森提\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3418,\n";
-                ss << u8"    \"Key\": \"merc08\",\n";
-                ss << u8"    \"enUS\": \"Blaise\",\n";
-                ss << u8"    \"zhTW\": \"布萊絲\",\n";
-                ss << u8"    \"deDE\": \"Blaise\",\n";
-                ss << u8"    \"esES\": \"Blaise\",\n";
-                ss << u8"    \"frFR\": \"Blaise\",\n";
-                ss << u8"    \"itIT\": \"Blaise\",\n";
-                ss << u8"    \"koKR\": \"블레이즈\",\n";
-                ss << u8"    \"plPL\": \"Blaise\",\n";
-                ss << u8"    \"esMX\": \"Blaise\",\n";
-                ss << u8"    \"jaJP\": \"ブレーズ\",\n";
-                ss << u8"    \"ptBR\": \"Bianca\",\n";
-                ss << u8"    \"ruRU\": \"Блейз\",\n";
-                ss << u8"    \"zhCN\": \"布蕾西\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3419,\n";
-                ss << u8"    \"Key\": \"merc09\",\n";
-                ss << u8"    \"enUS\": \"Kyoko\",\n";
-                ss << u8"    \"zhTW\": \"京子\",\n";
-                ss << u8"    \"deDE\": \"Kyoko\",\n";
-                ss << u8"    \"esES\": \"Kyoko\",\n";
-                ss << u8"    \"frFR\": \"Kyoko\",\n";
-                ss << u8"    \"itIT\": \"Kyoko\",\n";
-                ss << u8"    \"koKR\": \"유리\",\n";
-                ss << u8"    \"plPL\": \"Kyoko\",\n";
-                ss << u8"    \"esMX\": \"Kyoko\",\n";
-                ss << u8"    \"jaJP\": \"キョウコ\",\n";
-                ss << u8"    \"ptBR\": \"Kyoko\",\n";
-                ss << u8"    \"ruRU\": \"Киоко\",\n";
-                ss << u8"    \"zhCN\": \"京子\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3420,\n";
-                ss << u8"    \"Key\": \"merc10\",\n";
-                ss << u8"    \"enUS\": \"Klaudia\",\n";
-                ss << u8"    \"zhTW\": \"克勞蒂亞\",\n";
-                ss << u8"    \"deDE\": \"Klaudia\",\n";
-                ss << u8"    \"esES\": \"Klaudia\",\n";
-                ss << u8"    \"frFR\": \"Klaudia\",\n";
-                ss << u8"    \"itIT\": \"Klaudia\",\n";
-                ss << u8"    \"koKR\": \"클라우디아\",\n";
-                ss << u8"    \"plPL\": \"Klaudia\",\n";
-                ss << u8"    \"esMX\": \"Klaudia\",\n";
-                ss << u8"    \"jaJP\": \"クローディア\",\n";
-                ss << u8"    \"ptBR\": \"Claudia\",\n";
-                ss << u8"    \"ruRU\": \"Клаудия\",\n";
-                ss << u8"    \"zhCN\": \"克劳蒂亚\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3421,\n";
-                ss << u8"    \"Key\": \"merc11\",\n";
-                ss << u8"    \"enUS\": \"Kundri\",\n";
-                ss << u8"    \"zhTW\": \"昆德莉\",\n";
-                ss << u8"    \"deDE\": \"Kundri\",\n";
-                ss << u8"    \"esES\": \"Kundri\",\n";
-                ss << u8"    \"frFR\": \"Kundri\",\n";
-                ss << u8"    \"itIT\": \"Kundri\",\n";
-                ss << u8"    \"koKR\": \"쿤드리\",\n";
-                ss << u8"    \"plPL\": \"Kundri\",\n";
-                ss << u8"    \"esMX\": \"Kundri\",\n";
-                ss << u8"    \"jaJP\": \"クンドゥリ\",\n";
-                ss << u8"    \"ptBR\": \"Kundri\",\n";
-                ss << u8"    \"ruRU\": \"Кундри\",\n";
-                ss << u8"    \"zhCN\": \"昆德蕊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3422,\n";
-                ss << u8"    \"Key\": \"merc12\",\n";
-                ss << u8"    \"enUS\": \"Kyle\",\n";
-                ss << u8"    \"zhTW\": \"凱爾\",\n";
-                ss << u8"    \"deDE\": \"Kylo\",\n";
-                ss << u8"    \"esES\": \"Kyle\",\n";
-                ss << u8"    \"frFR\": \"Kyle\",\n";
-                ss << u8"    \"itIT\": \"Kyle\",\n";
-                ss << u8"    \"koKR\": \"카일\",\n";
-                ss << u8"    \"plPL\": \"Kyle\",\n";
-                ss << u8"    \"esMX\": \"Kyle\",\n";
-                ss << u8"    \"jaJP\": \"カイル\",\n";
-                ss << u8"    \"ptBR\": \"Caio\",\n";
-                ss << u8"    \"ruRU\": \"Кайли\",\n";
-                ss << u8"    \"zhCN\": \"凯尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3423,\n";
-                ss << u8"    \"Key\": \"merc13\",\n";
-                ss << u8"    \"enUS\": \"Visala\",\n";
-                ss << u8"    \"zhTW\": \"維莎莉亞\",\n";
-                ss << u8"    \"deDE\": \"Visala\",\n";
-                ss << u8"    \"esES\": \"Visala\",\n";
-                ss << u8"    \"frFR\": \"Visala\",\n";
-                ss << u8"    \"itIT\": \"Visala\",\n";
-                ss << u8"    \"koKR\": \"비살라\",\n";
-                ss << u8"    \"plPL\": \"Visala\",\n";
-                ss << u8"    \"esMX\": \"Visala\",\n";
-                ss << u8"    \"jaJP\": \"ヴィサラ\",\n";
-                ss << u8"    \"ptBR\": \"Visala\",\n";
-                ss << u8"    \"ruRU\": \"Висала\",\n";
-                ss << u8"    \"zhCN\": \"维萨拉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3424,\n";
-                ss << u8"    \"Key\": \"merc14\",\n";
-                ss << u8"    \"enUS\": \"Elexa\",\n";
-                ss << u8"    \"zhTW\": \"依麗莎\",\n";
-                ss << u8"    \"deDE\": \"Elexa\",\n";
-                ss << u8"    \"esES\": \"Elexa\",\n";
-                ss << u8"    \"frFR\": \"Elexa\",\n";
-                ss << u8"    \"itIT\": \"Elexa\",\n";
-                ss << u8"    \"koKR\": \"엘렉사\",\n";
-                ss << u8"    \"plPL\": \"Elexa\",\n";
-                ss << u8"    \"esMX\": \"Elexa\",\n";
-                ss << u8"    \"jaJP\": \"エレクサ\",\n";
-                ss << u8"    \"ptBR\": \"Elexa\",\n";
-                ss << u8"    \"ruRU\": \"Элекса\",\n";
-                ss << u8"    \"zhCN\": \"奥雷克萨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3425,\n";
-                ss << u8"    \"Key\": \"merc15\",\n";
-                ss << u8"    \"enUS\": \"Floria\",\n";
-                ss << u8"    \"zhTW\": \"弗蘿利亞\",\n";
-                ss << u8"    \"deDE\": \"Floria\",\n";
-                ss << u8"    \"esES\": \"Floria\",\n";
-                ss << u8"    \"frFR\": \"Floria\",\n";
-                ss << u8"    \"itIT\": \"Floria\",\n";
-                ss << u8"    \"koKR\": \"플로리아\",\n";
-                ss << u8"    \"plPL\": \"Floria\",\n";
-                ss << u8"    \"esMX\": \"Floria\",\n";
-                ss << u8"    \"jaJP\": \"フローリア\",\n";
-                ss << u8"    \"ptBR\": \"Flória\",\n";
-                ss << u8"    \"ruRU\": \"Флория\",\n";
-                ss << u8"    \"zhCN\": \"弗萝利亚\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3426,\n";
-                ss << u8"    \"Key\": \"merc16\",\n";
-                ss << u8"    \"enUS\": \"Fiona\",\n";
-                ss << u8"    \"zhTW\": \"費歐娜\",\n";
-                ss << u8"    \"deDE\": \"Fiona\",\n";
-                ss << u8"    \"esES\": \"Fiona\",\n";
-                ss << u8"    \"frFR\": \"Fiona\",\n";
-                ss << u8"    \"itIT\": \"Fiona\",\n";
-                ss << u8"    \"koKR\": \"피오나\",\n";
-                ss << u8"    \"plPL\": \"Fiona\",\n";
-                ss << u8"    \"esMX\": \"Fiona\",\n";
-                ss << u8"    \"jaJP\": \"フィオナ\",\n";
-                ss << u8"    \"ptBR\": \"Fiona\",\n";
-                ss << u8"    \"ruRU\": \"Фиона\",\n";
-                ss << u8"    \"zhCN\": \"菲欧娜\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3427,\n";
-                ss << u8"    \"Key\": \"merc17\",\n";
-                ss << u8"    \"enUS\": \"Gwinni\",\n";
-                ss << u8"    \"zhTW\": \"吉溫妮\",\n";
-                ss << u8"    \"deDE\": \"Gwinni\",\n";
-                ss << u8"    \"esES\": \"Gwinni\",\n";
-                ss << u8"    \"frFR\": \"Gwinni\",\n";
-                ss << u8"    \"itIT\": \"Gwinni\",\n";
-                ss << u8"    \"koKR\": \"그위니\",\n";
-                ss << u8"    \"plPL\": \"Gwinni\",\n";
-                ss << u8"    \"esMX\": \"Gwinni\",\n";
-                ss << u8"    \"jaJP\": \"グウィニ\",\n";
-                ss << u8"    \"ptBR\": \"Guinni\",\n";
-                ss << u8"    \"ruRU\": \"Гвинни\",\n";
-                ss << u8"    \"zhCN\": \"基温尼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3428,\n";
-                ss << u8"    \"Key\": \"merc18\",\n";
-                ss << u8"    \"enUS\": \"Gaile\",\n";
-                ss << u8"    \"zhTW\": \"蓋兒\",\n";
-                ss << u8"    \"deDE\": \"Geli\",\n";
-                ss << u8"    \"esES\": \"Gaile\",\n";
-                ss << u8"    \"frFR\": \"Gaile\",\n";
-                ss << u8"    \"itIT\": \"Gaile\",\n";
-                ss << u8"    \"koKR\": \"게일\",\n";
-                ss << u8"    \"plPL\": \"Gaile\",\n";
-                ss << u8"    \"esMX\": \"Gaile\",\n";
-                ss << u8"    \"jaJP\": \"ゲイル\",\n";
-                ss << u8"    \"ptBR\": \"Gilda\",\n";
-                ss << u8"    \"ruRU\": \"Гейл\",\n";
-                ss << u8"    \"zhCN\": \"盖尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3429,\n";
-                ss << u8"    \"Key\": \"merc19\",\n";
-                ss << u8"    \"enUS\": \"Hannah\",\n";
-                ss << u8"    \"zhTW\": \"哈娜\",\n";
-                ss << u8"    \"deDE\": \"Hannah\",\n";
-                ss << u8"    \"esES\": \"Hannah\",\n";
-                ss << u8"    \"frFR\": \"Hannah\",\n";
-                ss << u8"    \"itIT\": \"Hannah\",\n";
-                ss << u8"    \"koKR\": \"한나\",\n";
-                ss << u8"    \"plPL\": \"Hannah\",\n";
-                ss << u8"    \"esMX\": \"Atenea\",\n";
-                ss << u8"    \"jaJP\": \"ハンナ\",\n";
-                ss << u8"    \"ptBR\": \"Hanna\",\n";
-                ss << u8"    \"ruRU\": \"Ханна\",\n";
-                ss << u8"    \"zhCN\": \"哈娜\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3430,\n";
-                ss << u8"    \"Key\": \"merc20\",\n";
-                ss << u8"    \"enUS\": \"Heather\",\n";
-                ss << u8"    \"zhTW\": \"海瑟\",\n";
-                ss << u8"    \"deDE\": \"Heide\",\n";
-                ss << u8"    \"esES\": \"Heather\",\n";
-                ss << u8"    \"frFR\": \"Heather\",\n";
-                ss << u8"    \"itIT\": \"Heather\",\n";
-                ss << u8"    \"koKR\": \"헤더\",\n";
-                ss << u8"    \"plPL\": \"Heather\",\n";
-                ss << u8"    \"esMX\": \"Heather\",\n";
-                ss << u8"    \"jaJP\": \"ヘザー\",\n";
-                ss << u8"    \"ptBR\": \"Ester\",\n";
-                ss << u8"    \"ruRU\": \"Хезер\",\n";
-                ss << u8"    \"zhCN\": \"希瑟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3431,\n";
-                ss << u8"    \"Key\": \"merc21\",\n";
-                ss << u8"    \"enUS\": \"Iantha\",\n";
-                ss << u8"    \"zhTW\": \"艾蓮娜\",\n";
-                ss << u8"    \"deDE\": \"Iantha\",\n";
-                ss << u8"    \"esES\": \"Iantha\",\n";
-                ss << u8"    \"frFR\": \"Iantha\",\n";
-                ss << u8"    \"itIT\": \"Iantha\",\n";
-                ss << u8"    \"koKR\": \"이안타\",\n";
-                ss << u8"    \"plPL\": \"Iantha\",\n";
-                ss << u8"    \"esMX\": \"Iantha\",\n";
-                ss << u8"    \"jaJP\": \"イアンサ\",\n";
-                ss << u8"    \"ptBR\": \"Ianta\",\n";
-                ss << u8"    \"ruRU\": \"Ианта\",\n";
-                ss << u8"    \"zhCN\": \"伊安萨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3432,\n";
-                ss << u8"    \"Key\": \"merc22\",\n";
-                ss << u8"    \"enUS\": \"Diane\",\n";
-                ss << u8"    \"zhTW\": \"黛安\",\n";
-                ss << u8"    \"deDE\": \"Diane\",\n";
-                ss << u8"    \"esES\": \"Diana\",\n";
-                ss << u8"    \"frFR\": \"Diane\",\n";
-                ss << u8"    \"itIT\": \"Diane\",\n";
-                ss << u8"    \"koKR\": \"다이엔\",\n";
-                ss << u8"    \"plPL\": \"Diane\",\n";
-                ss << u8"    \"esMX\": \"Diane\",\n";
-                ss << u8"    \"jaJP\": \"ダイアン\",\n";
-                ss << u8"    \"ptBR\": \"Diana\",\n";
-                ss << u8"    \"ruRU\": \"Диана\",\n";
-                ss << u8"    \"zhCN\": \"戴安妮\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3433,\n";
-                ss << u8"    \"Key\": \"merc23\",\n";
-                ss << u8"    \"enUS\": \"Isolde\",\n";
-                ss << u8"    \"zhTW\": \"依索德\",\n";
-                ss << u8"    \"deDE\": \"Isolde\",\n";
-                ss << u8"    \"esES\": \"Isolda\",\n";
-                ss << u8"    \"frFR\": \"Isolde\",\n";
-                ss << u8"    \"itIT\": \"Isolde\",\n";
-                ss << u8"    \"koKR\": \"이졸데\",\n";
-                ss << u8"    \"plPL\": \"Isolde\",\n";
-                ss << u8"    \"esMX\": \"Isolde\",\n";
-                ss << u8"    \"jaJP\": \"イゾルダ\",\n";
-                ss << u8"    \"ptBR\": \"Isolda\",\n";
-                ss << u8"    \"ruRU\": \"Изольда\",\n";
-                ss << u8"    \"zhCN\": \"伊索德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3434,\n";
-                ss << u8"    \"Key\": \"merc24\",\n";
-                ss << u8"    \"enUS\": \"Divo\",\n";
-                ss << u8"    \"zhTW\": \"迪佛\",\n";
-                ss << u8"    \"deDE\": \"Divo\",\n";
-                ss << u8"    \"esES\": \"Divo\",\n";
-                ss << u8"    \"frFR\": \"Divo\",\n";
-                ss << u8"    \"itIT\": \"Divo\",\n";
-                ss << u8"    \"koKR\": \"디보\",\n";
-                ss << u8"    \"plPL\": \"Divo\",\n";
-                ss << u8"    \"esMX\": \"Divo\",\n";
-                ss << u8"    \"jaJP\": \"ディーヴォ\",\n";
-                ss << u8"    \"ptBR\": \"Divo\",\n";
-                ss << u8"    \"ruRU\": \"Диво\",\n";
-                ss << u8"    \"zhCN\": \"迪沃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3435,\n";
-                ss << u8"    \"Key\": \"merc25\",\n";
-                ss << u8"    \"enUS\": \"Ithera\",\n";
-                ss << u8"    \"zhTW\": \"依索拉\",\n";
-                ss << u8"    \"deDE\": \"Ithera\",\n";
-                ss << u8"    \"esES\": \"Ithera\",\n";
-                ss << u8"    \"frFR\": \"Ithera\",\n";
-                ss << u8"    \"itIT\": \"Ithera\",\n";
-                ss << u8"    \"koKR\": \"미라\",\n";
-                ss << u8"    \"plPL\": \"Ithera\",\n";
-                ss << u8"    \"esMX\": \"Ithera\",\n";
-                ss << u8"    \"jaJP\": \"イセラ\",\n";
-                ss << u8"    \"ptBR\": \"Itera\",\n";
-                ss << u8"    \"ruRU\": \"Итера\",\n";
-                ss << u8"    \"zhCN\": \"伊瑟拉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3436,\n";
-                ss << u8"    \"Key\": \"merc26\",\n";
-                ss << u8"    \"enUS\": \"Itonya\",\n";
-                ss << u8"    \"zhTW\": \"伊東亞\",\n";
-                ss << u8"    \"deDE\": \"Itonya\",\n";
-                ss << u8"    \"esES\": \"Itonya\",\n";
-                ss << u8"    \"frFR\": \"Itonya\",\n";
-                ss << u8"    \"itIT\": \"Itonya\",\n";
-                ss << u8"    \"koKR\": \"이토냐\",\n";
-                ss << u8"    \"plPL\": \"Itonya\",\n";
-                ss << u8"    \"esMX\": \"Itonya\",\n";
-                ss << u8"    \"jaJP\": \"アイトーニャ\",\n";
-                ss << u8"    \"ptBR\": \"Itônia\",\n";
-                ss << u8"    \"ruRU\": \"Итония\",\n";
-                ss << u8"    \"zhCN\": \"伊童雅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3437,\n";
-                ss << u8"    \"Key\": \"merc27\",\n";
-                ss << u8"    \"enUS\": \"Liene\",\n";
-                ss << u8"    \"zhTW\": \"雷伊妮\",\n";
-                ss << u8"    \"deDE\": \"Liene\",\n";
-                ss << u8"    \"esES\": \"Liene\",\n";
-                ss << u8"    \"frFR\": \"Liene\",\n";
-                ss << u8"    \"itIT\": \"Liene\",\n";
-                ss << u8"    \"koKR\": \"리엔\",\n";
-                ss << u8"    \"plPL\": \"Liene\",\n";
-                ss << u8"    \"esMX\": \"Liene\",\n";
-                ss << u8"    \"jaJP\": \"リアン\",\n";
-                ss << u8"    \"ptBR\": \"Liane\",\n";
-                ss << u8"    \"ruRU\": \"Лиена\",\n";
-                ss << u8"    \"zhCN\": \"黎恩\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3438,\n";
-                ss << u8"    \"Key\": \"merc28\",\n";
-                ss << u8"    \"enUS\": \"Maeko\",\n";
-                ss << u8"    \"zhTW\": \"梅可\",\n";
-                ss << u8"    \"deDE\": \"Mäko\",\n";
-                ss << u8"    \"esES\": \"Maeko\",\n";
-                ss << u8"    \"frFR\": \"Maeko\",\n";
-                ss << u8"    \"itIT\": \"Maeko\",\n";
-                ss << u8"    \"koKR\": \"마에코\",\n";
-                ss << u8"    \"plPL\": \"Maeko\",\n";
-                ss << u8"    \"esMX\": \"Maeko\",\n";
-                ss << u8"    \"jaJP\": \"メイコ\",\n";
-                ss << u8"    \"ptBR\": \"Maeko\",\n";
-                ss << u8"    \"ruRU\": \"Маэко\",\n";
-                ss << u8"    \"zhCN\": \"米克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3439,\n";
-                ss << u8"    \"Key\": \"merc29\",\n";
-                ss << u8"    \"enUS\": \"Mahala\",\n";
-                ss << u8"    \"zhTW\": \"瑪哈拉\",\n";
-                ss << u8"    \"deDE\": \"Mahala\",\n";
-                ss << u8"    \"esES\": \"Mahala\",\n";
-                ss << u8"    \"frFR\": \"Mahala\",\n";
-                ss << u8"    \"itIT\": \"Mahala\",\n";
-                ss << u8"    \"koKR\": \"마할라\",\n";
-                ss << u8"    \"plPL\": \"Mahala\",\n";
-                ss << u8"    \"esMX\": \"Mahala\",\n";
-                ss << u8"    \"jaJP\": \"マハーラ\",\n";
-                ss << u8"    \"ptBR\": \"Maala\",\n";
-                ss << u8"    \"ruRU\": \"Магала\",\n";
-                ss << u8"    \"zhCN\": \"马哈拉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3440,\n";
-                ss << u8"    \"Key\": \"merc30\",\n";
-                ss << u8"    \"enUS\": \"Liaza\",\n";
-                ss << u8"    \"zhTW\": \"莉莎\",\n";
-                ss << u8"    \"deDE\": \"Liasa\",\n";
-                ss << u8"    \"esES\": \"Liaza\",\n";
-                ss << u8"    \"frFR\": \"Liaza\",\n";
-                ss << u8"    \"itIT\": \"Liaza\",\n";
-                ss << u8"    \"koKR\": \"리아자\",\n";
-                ss << u8"    \"plPL\": \"Liaza\",\n";
-                ss << u8"    \"esMX\": \"Liaza\",\n";
-                ss << u8"    \"jaJP\": \"リアーザ\",\n";
-                ss << u8"    \"ptBR\": \"Liaza\",\n";
-                ss << u8"    \"ruRU\": \"Лиаза\",\n";
-                ss << u8"    \"zhCN\": \"利亚萨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3441,\n";
-                ss << u8"    \"Key\": \"merc31\",\n";
-                ss << u8"    \"enUS\": \"Meghan\",\n";
-                ss << u8"    \"zhTW\": \"梅葛哈\",\n";
-                ss << u8"    \"deDE\": \"Meghan\",\n";
-                ss << u8"    \"esES\": \"Meghan\",\n";
-                ss << u8"    \"frFR\": \"Meghan\",\n";
-                ss << u8"    \"itIT\": \"Meghan\",\n";
-                ss << u8"    \"koKR\": \"메간\",\n";
-                ss << u8"    \"plPL\": \"Meghan\",\n";
-                ss << u8"    \"esMX\": \"Meghan\",\n";
-                ss << u8"    \"jaJP\": \"メーガン\",\n";
-                ss << u8"    \"ptBR\": \"Megan\",\n";
-                ss << u8"    \"ruRU\": \"Меган\",\n";
-                ss << u8"    \"zhCN\": \"梅甘\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3442,\n";
-                ss << u8"    \"Key\": \"merc32\",\n";
-                ss << u8"    \"enUS\": \"Olena\",\n";
-                ss << u8"    \"zhTW\": \"奧蓮娜\",\n";
-                ss << u8"    \"deDE\": \"Olena\",\n";
-                ss << u8"    \"esES\": \"Olena\",\n";
-                ss << u8"    \"frFR\": \"Olena\",\n";
-                ss << u8"    \"itIT\": \"Olena\",\n";
-                ss << u8"    \"koKR\": \"올레나\",\n";
-                ss << u8"    \"plPL\": \"Olena\",\n";
-                ss << u8"    \"esMX\": \"Olena\",\n";
-                ss << u8"    \"jaJP\": \"オレーナ\",\n";
-                ss << u8"    \"ptBR\": \"Olena\",\n";
-                ss << u8"    \"ruRU\": \"Олена\",\n";
-                ss << u8"    \"zhCN\": \"奥蕾娜\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3443,\n";
-                ss << u8"    \"Key\": \"merc33\",\n";
-                ss << u8"    \"enUS\": \"Oriana\",\n";
-                ss << u8"    \"zhTW\": \"奧麗亞娜\",\n";
-                ss << u8"    \"deDE\": \"Oriana\",\n";
-                ss << u8"    \"esES\": \"Oriana\",\n";
-                ss << u8"    \"frFR\": \"Oriana\",\n";
-                ss << u8"    \"itIT\": \"Oriana\",\n";
-                ss << u8"    \"koKR\": \"오리아나\",\n";
-                ss << u8"    \"plPL\": \"Oriana\",\n";
-                ss << u8"    \"esMX\": \"Oriana\",\n";
-                ss << u8"    \"jaJP\": \"オリアーナ\",\n";
-                ss << u8"    \"ptBR\": \"Oriana\",\n";
-                ss << u8"    \"ruRU\": \"Ориана\",\n";
-                ss << u8"    \"zhCN\": \"奥利安娜\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3444,\n";
-                ss << u8"    \"Key\": \"merc34\",\n";
-                ss << u8"    \"enUS\": \"Ryann\",\n";
-                ss << u8"    \"zhTW\": \"萊恩\",\n";
-                ss << u8"    \"deDE\": \"Ryann\",\n";
-                ss << u8"    \"esES\": \"Ryann\",\n";
-                ss << u8"    \"frFR\": \"Ryann\",\n";
-                ss << u8"    \"itIT\": \"Ryann\",\n";
-                ss << u8"    \"koKR\": \"라이앤\",\n";
-                ss << u8"    \"plPL\": \"Ryann\",\n";
-                ss << u8"    \"esMX\": \"Ryann\",\n";
-                ss << u8"    \"jaJP\": \"レアンヌ\",\n";
-                ss << u8"    \"ptBR\": \"Rian\",\n";
-                ss << u8"    \"ruRU\": \"Рианн\",\n";
-                ss << u8"    \"zhCN\": \"瑞安\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3445,\n";
-                ss << u8"    \"Key\": \"merc35\",\n";
-                ss << u8"    \"enUS\": \"Rozene\",\n";
-                ss << u8"    \"zhTW\": \"羅珊妮\",\n";
-                ss << u8"    \"deDE\": \"Rosene\",\n";
-                ss << u8"    \"esES\": \"Rozene\",\n";
-                ss << u8"    \"frFR\": \"Rozene\",\n";
-                ss << u8"    \"itIT\": \"Rozene\",\n";
-                ss << u8"    \"koKR\": \"로젠\",\n";
-                ss << u8"    \"plPL\": \"Rozene\",\n";
-                ss << u8"    \"esMX\": \"Rozene\",\n";
-                ss << u8"    \"jaJP\": \"ロゼーヌ\",\n";
-                ss << u8"    \"ptBR\": \"Rozene\",\n";
-                ss << u8"    \"ruRU\": \"Розена\",\n";
-                ss << u8"    \"zhCN\": \"罗泽妮\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3446,\n";
-                ss << u8"    \"Key\": \"merc36\",\n";
-                ss << u8"    \"enUS\": \"Raissa\",\n";
-                ss << u8"    \"zhTW\": \"萊莎\",\n";
-                ss << u8"    \"deDE\": \"Raissa\",\n";
-                ss << u8"    \"esES\": \"Raisa\",\n";
-                ss << u8"    \"frFR\": \"Raissa\",\n";
-                ss << u8"    \"itIT\": \"Raissa\",\n";
-                ss << u8"    \"koKR\": \"라이사\",\n";
-                ss << u8"    \"plPL\": \"Raissa\",\n";
-                ss << u8"    \"esMX\": \"Raissa\",\n";
-                ss << u8"    \"jaJP\": \"ライサ\",\n";
-                ss << u8"    \"ptBR\": \"Raíssa\",\n";
-                ss << u8"    \"ruRU\": \"Раисса\",\n";
-                ss << u8"    \"zhCN\": \"雷萨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3447,\n";
-                ss << u8"    \"Key\": \"merc37\",\n";
-                ss << u8"    \"enUS\": \"Sharyn\",\n";
-                ss << u8"    \"zhTW\": \"夏琳\",\n";
-                ss << u8"    \"deDE\": \"Scharyn\",\n";
-                ss << u8"    \"esES\": \"Sharyn\",\n";
-                ss << u8"    \"frFR\": \"Sharyn\",\n";
-                ss << u8"    \"itIT\": \"Sharyn\",\n";
-                ss << u8"    \"koKR\": \"샤린\",\n";
-                ss << u8"    \"plPL\": \"Sharyn\",\n";
-                ss << u8"    \"esMX\": \"Sharyn\",\n";
-                ss << u8"    \"jaJP\": \"シャリン\",\n";
-                ss << u8"    \"ptBR\": \"Sharin\",\n";
-                ss << u8"    \"ruRU\": \"Шарин\",\n";
-                ss << u8"    \"zhCN\": \"夏琳\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3448,\n";
-                ss << u8"    \"Key\": \"merc38\",\n";
-                ss << u8"    \"enUS\": \"Shikha\",\n";
-                ss << u8"    \"zhTW\": \"席克哈\",\n";
-                ss << u8"    \"deDE\": \"Schicha\",\n";
-                ss << u8"    \"esES\": \"Shija\",\n";
-                ss << u8"    \"frFR\": \"Shikha\",\n";
-                ss << u8"    \"itIT\": \"Shikha\",\n";
-                ss << u8"    \"koKR\": \"쉬카\",\n";
-                ss << u8"    \"plPL\": \"Shikha\",\n";
-                ss << u8"    \"esMX\": \"Shikha\",\n";
-                ss << u8"    \"jaJP\": \"シクハ\",\n";
-                ss << u8"    \"ptBR\": \"Shika\",\n";
-                ss << u8"    \"ruRU\": \"Шикха\",\n";
-                ss << u8"    \"zhCN\": \"席卡\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3449,\n";
-                ss << u8"    \"Key\": \"merc39\",\n";
-                ss << u8"    \"enUS\": \"Debi\",\n";
-                ss << u8"    \"zhTW\": \"戴比\",\n";
-                ss << u8"    \"deDE\": \"Debi\",\n";
-                ss << u8"    \"esES\": \"Debi\",\n";
-                ss << u8"    \"frFR\": \"Debi\",\n";
-                ss << u8"    \"itIT\": \"Debi\",\n";
-                ss << u8"    \"koKR\": \"데비\",\n";
-                ss << u8"    \"plPL\": \"Debi\",\n";
-                ss << u8"    \"esMX\": \"Debi\",\n";
-                ss << u8"    \"jaJP\": \"デビー\",\n";
-                ss << u8"    \"ptBR\": \"Debi\",\n";
-                ss << u8"    \"ruRU\": \"Деби\",\n";
-                ss << u8"    \"zhCN\": \"黛比\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3450,\n";
-                ss << u8"    \"Key\": \"merc40\",\n";
-                ss << u8"    \"enUS\": \"Tylena\",\n";
-                ss << u8"    \"zhTW\": \"泰蓮娜\",\n";
-                ss << u8"    \"deDE\": \"Tylena\",\n";
-                ss << u8"    \"esES\": \"Tylena\",\n";
-                ss << u8"    \"frFR\": \"Tylena\",\n";
-                ss << u8"    \"itIT\": \"Tylena\",\n";
-                ss << u8"    \"koKR\": \"틸레나\",\n";
-                ss << u8"    \"plPL\": \"Tylena\",\n";
-                ss << u8"    \"esMX\": \"Tylena\",\n";
-                ss << u8"    \"jaJP\": \"ティレーナ\",\n";
-                ss << u8"    \"ptBR\": \"Tilena\",\n";
-                ss << u8"    \"ruRU\": \"Тилена\",\n";
-                ss << u8"    \"zhCN\": \"泰蕾娜\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3451,\n";
-                ss << u8"    \"Key\": \"merc41\",\n";
-                ss << u8"    \"enUS\": \"Wendy\",\n";
-                ss << u8"    \"zhTW\": \"溫蒂\",\n";
-                ss << u8"    \"deDE\": \"Wendy\",\n";
-                ss << u8"    \"esES\": \"Wendy\",\n";
-                ss << u8"    \"frFR\": \"Wendy\",\n";
-                ss << u8"    \"itIT\": \"Wendy\",\n";
-                ss << u8"    \"koKR\": \"웬디\",\n";
-                ss << u8"    \"plPL\": \"Wendy\",\n";
-                ss << u8"    \"esMX\": \"Wendy\",\n";
-                ss << u8"    \"jaJP\": \"ウェンディ\",\n";
-                ss << u8"    \"ptBR\": \"Wendy\",\n";
-                ss << u8"    \"ruRU\": \"Венди\",\n";
-                ss << u8"    \"zhCN\": \"温迪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10835,\n";
-                ss << u8"    \"Key\": \"MercX101\",\n";
-                ss << u8"    \"enUS\": \"Varaya\",\n";
-                ss << u8"    \"zhTW\": \"伐拉亞\",\n";
-                ss << u8"    \"deDE\": \"Vakir\",\n";
-                ss << u8"    \"esES\": \"Vakir\",\n";
-                ss << u8"    \"frFR\": \"Varaya\",\n";
-                ss << u8"    \"itIT\": \"Varaya\",\n";
-                ss << u8"    \"koKR\": \"바라야\",\n";
-                ss << u8"    \"plPL\": \"Varaya\",\n";
-                ss << u8"    \"esMX\": \"Varaya\",\n";
-                ss << u8"    \"jaJP\": \"ヴァラヤ\",\n";
-                ss << u8"    \"ptBR\": \"Varaia\",\n";
-                ss << u8"    \"ruRU\": \"Варайя\",\n";
-                ss << u8"    \"zhCN\": \"瓦拉亚\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10836,\n";
-                ss << u8"    \"Key\": \"MercX102\",\n";
-                ss << u8"    \"enUS\": \"Khan\",\n";
-                ss << u8"    \"zhTW\": \"可汗\",\n";
-                ss << u8"    \"deDE\": \"Khan\",\n";
-                ss << u8"    \"esES\": \"Khan\",\n";
-                ss << u8"    \"frFR\": \"Khan\",\n";
-                ss << u8"    \"itIT\": \"Khan\",\n";
-                ss << u8"    \"koKR\": \"칸\",\n";
-                ss << u8"    \"plPL\": \"Khan\",\n";
-                ss << u8"    \"esMX\": \"Khan\",\n";
-                ss << u8"    \"jaJP\": \"カーン\",\n";
-                ss << u8"    \"ptBR\": \"Khan\",\n";
-                ss << u8"    \"ruRU\": \"Хан\",\n";
-                ss << u8"    \"zhCN\": \"可汗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10837,\n";
-                ss << u8"    \"Key\": \"MercX103\",\n";
-                ss << u8"    \"enUS\": \"Klisk\",\n";
-                ss << u8"    \"zhTW\": \"克理斯克\",\n";
-                ss << u8"    \"deDE\": \"Lwik\",\n";
-                ss << u8"    \"esES\": \"Lwik\",\n";
-                ss << u8"    \"frFR\": \"Klisk\",\n";
-                ss << u8"    \"itIT\": \"Klisk\",\n";
-                ss << u8"    \"koKR\": \"클리스크\",\n";
-                ss << u8"    \"plPL\": \"Klisk\",\n";
-                ss << u8"    \"esMX\": \"Klisk\",\n";
-                ss << u8"    \"jaJP\": \"クリスク\",\n";
-                ss << u8"    \"ptBR\": \"Klisk\",\n";
-                ss << u8"    \"ruRU\": \"Клиск\",\n";
-                ss << u8"    \"zhCN\": \"克里斯克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10838,\n";
-                ss << u8"    \"Key\": \"MercX104\",\n";
-                ss << u8"    \"enUS\": \"Bors\",\n";
-                ss << u8"    \"zhTW\": \"柏斯\",\n";
-                ss << u8"    \"deDE\": \"Bors\",\n";
-                ss << u8"    \"esES\": \"Bors\",\n";
-                ss << u8"    \"frFR\": \"Bors\",\n";
-                ss << u8"    \"itIT\": \"Bors\",\n";
-                ss << u8"    \"koKR\": \"보르스\",\n";
-                ss << u8"    \"plPL\": \"Bors\",\n";
-                ss << u8"    \"esMX\": \"Bors\",\n";
-                ss << u8"    \"jaJP\": \"ボルス\",\n";
-                ss << u8"    \"ptBR\": \"Bors\",\n";
-                ss << u8"    \"ruRU\": \"Борс\",\n";
-                ss << u8"    \"zhCN\": \"波尔斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10839,\n";
-                ss << u8"    \"Key\": \"MercX105\",\n";
-                ss << u8"    \"enUS\": \"Brom\",\n";
-                ss << u8"    \"zhTW\": \"波姆\",\n";
-                ss << u8"    \"deDE\": \"Brom\",\n";
-                ss << u8"    \"esES\": \"Brom\",\n";
-                ss << u8"    \"frFR\": \"Brom\",\n";
-                ss << u8"    \"itIT\": \"Brom\",\n";
-                ss << u8"    \"koKR\": \"브롬\",\n";
-                ss << u8"    \"plPL\": \"Brom\",\n";
-                ss << u8"    \"esMX\": \"Brom\",\n";
-                ss << u8"    \"jaJP\": \"ブロム\",\n";
-                ss << u8"    \"ptBR\": \"Brom\",\n";
-                ss << u8"    \"ruRU\": \"Бром\",\n";
-                ss << u8"    \"zhCN\": \"布隆姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10840,\n";
-                ss << u8"    \"Key\": \"MercX106\",\n";
-                ss << u8"    \"enUS\": \"Wiglaf\",\n";
-                ss << u8"    \"zhTW\": \"衛格萊夫\",\n";
-                ss << u8"    \"deDE\": \"Wiaf\",\n";
-                ss << u8"    \"esES\": \"Wiaf\",\n";
-                ss << u8"    \"frFR\": \"Wiglaf\",\n";
-                ss << u8"    \"itIT\": \"Wiglaf\",\n";
-                ss << u8"    \"koKR\": \"위글라프\",\n";
-                ss << u8"    \"plPL\": \"Wiglaf\",\n";
-                ss << u8"    \"esMX\": \"Wiglaf\",\n";
-                ss << u8"    \"jaJP\": \"ウィグラフ\",\n";
-                ss << u8"    \"ptBR\": \"Wiglaf\",\n";
-                ss << u8"    \"ruRU\": \"Виглаф\",\n";
-                ss << u8"    \"zhCN\": \"维格拉夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10841,\n";
-                ss << u8"    \"Key\": \"MercX107\",\n";
-                ss << u8"    \"enUS\": \"Hrothgar\",\n";
-                ss << u8"    \"zhTW\": \"霍勒斯加\",\n";
-                ss << u8"    \"deDE\": \"Litot\",\n";
-                ss << u8"    \"esES\": \"Litot\",\n";
-                ss << u8"    \"frFR\": \"Hrothgar\",\n";
-                ss << u8"    \"itIT\": \"Hrothgar\",\n";
-                ss << u8"    \"koKR\": \"흐로스가\",\n";
-                ss << u8"    \"plPL\": \"Hrothgar\",\n";
-                ss << u8"    \"esMX\": \"Hrothgar\",\n";
-                ss << u8"    \"jaJP\": \"フロスガル\",\n";
-                ss << u8"    \"ptBR\": \"Rotgar\",\n";
-                ss << u8"    \"ruRU\": \"Хротгар\",\n";
-                ss << u8"    \"zhCN\": \"赫洛斯加\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10842,\n";
-                ss << u8"    \"Key\": \"MercX108\",\n";
-                ss << u8"    \"enUS\": \"Scyld\",\n";
-                ss << u8"    \"zhTW\": \"西勒德\",\n";
-                ss << u8"    \"deDE\": \"Scyld\",\n";
-                ss << u8"    \"esES\": \"Scyld\",\n";
-                ss << u8"    \"frFR\": \"Scyld\",\n";
-                ss << u8"    \"itIT\": \"Scyld\",\n";
-                ss << u8"    \"koKR\": \"스킬드\",\n";
-                ss << u8"    \"plPL\": \"Scyld\",\n";
-                ss << u8"    \"esMX\": \"Scyld\",\n";
-                ss << u8"    \"jaJP\": \"サイルド\",\n";
-                ss << u8"    \"ptBR\": \"Cylde\",\n";
-                ss << u8"    \"ruRU\": \"Скильд\",\n";
-                ss << u8"    \"zhCN\": \"赛尔德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10843,\n";
-                ss << u8"    \"Key\": \"MercX109\",\n";
-                ss << u8"    \"enUS\": \"Healfdane\",\n";
-                ss << u8"    \"zhTW\": \"海爾夫坦\",\n";
-                ss << u8"    \"deDE\": \"Hilfn\",\n";
-                ss << u8"    \"esES\": \"Hilfn\",\n";
-                ss << u8"    \"frFR\": \"Hilfdane\",\n";
-                ss << u8"    \"itIT\": \"Healfdane\",\n";
-                ss << u8"    \"koKR\": \"힐프데인\",\n";
-                ss << u8"    \"plPL\": \"Healfdane\",\n";
-                ss << u8"    \"esMX\": \"Healfdane\",\n";
-                ss << u8"    \"jaJP\": \"ヘルフデイン\",\n";
-                ss << u8"    \"ptBR\": \"Hafdan\",\n";
-                ss << u8"    \"ruRU\": \"Хальфдан\",\n";
-                ss << u8"    \"zhCN\": \"希福达恩\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10844,\n";
-                ss << u8"    \"Key\": \"MercX110\",\n";
-                ss << u8"    \"enUS\": \"Heorogar\",\n";
-                ss << u8"    \"zhTW\": \"赫羅加\",\n";
-                ss << u8"    \"deDE\": \"Jogar\",\n";
-                ss << u8"    \"esES\": \"Rogar\",\n";
-                ss << u8"    \"frFR\": \"Heorogar\",\n";
-                ss << u8"    \"itIT\": \"Heorogar\",\n";
-                ss << u8"    \"koKR\": \"헤오로가르\",\n";
-                ss << u8"    \"plPL\": \"Heorogar\",\n";
-                ss << u8"    \"esMX\": \"Heorogar\",\n";
-                ss << u8"    \"jaJP\": \"ヘオロガル\",\n";
-                ss << u8"    \"ptBR\": \"Erogar\",\n";
-                ss << u8"    \"ruRU\": \"Хеорогар\",\n";
-                ss << u8"    \"zhCN\": \"西奥洛迦\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10845,\n";
-                ss << u8"    \"Key\": \"MercX111\",\n";
-                ss << u8"    \"enUS\": \"Halgaunt\",\n";
-                ss << u8"    \"zhTW\": \"海爾甘特\",\n";
-                ss << u8"    \"deDE\": \"Iaent\",\n";
-                ss << u8"    \"esES\": \"Haent\",\n";
-                ss << u8"    \"frFR\": \"Halgaunt\",\n";
-                ss << u8"    \"itIT\": \"Halgaunt\",\n";
-                ss << u8"    \"koKR\": \"할가운트\",\n";
-                ss << u8"    \"plPL\": \"Halgaunt\",\n";
-                ss << u8"    \"esMX\": \"Halgaunt\",\n";
-                ss << u8"    \"jaJP\": \"ハルガウント\",\n";
-                ss << u8"    \"ptBR\": \"Halgaunt\",\n";
-                ss << u8"    \"ruRU\": \"Халгаунт\",\n";
-                ss << u8"    \"zhCN\": \"哈尔贡特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10846,\n";
-                ss << u8"    \"Key\": \"MercX112\",\n";
-                ss << u8"    \"enUS\": \"Hygelac\",\n";
-                ss << u8"    \"zhTW\": \"海格拉克\",\n";
-                ss << u8"    \"deDE\": \"Qelac\",\n";
-                ss << u8"    \"esES\": \"Qelac\",\n";
-                ss << u8"    \"frFR\": \"Hygelac\",\n";
-                ss << u8"    \"itIT\": \"Hygelac\",\n";
-                ss << u8"    \"koKR\": \"하이겔락\",\n";
-                ss << u8"    \"plPL\": \"Hygelac\",\n";
-                ss << u8"    \"esMX\": \"Hygelac\",\n";
-                ss << u8"    \"jaJP\": \"ヒジェラック\",\n";
-                ss << u8"    \"ptBR\": \"Riguelac\",\n";
-                ss << u8"    \"ruRU\": \"Хигелак\",\n";
-                ss << u8"    \"zhCN\": \"海格纳克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10847,\n";
-                ss << u8"    \"Key\": \"MercX113\",\n";
-                ss << u8"    \"enUS\": \"Egtheow\",\n";
-                ss << u8"    \"zhTW\": \"艾格索\",\n";
-                ss << u8"    \"deDE\": \"Ehoui\",\n";
-                ss << u8"    \"esES\": \"Ehoui\",\n";
-                ss << u8"    \"frFR\": \"Egtheow\",\n";
-                ss << u8"    \"itIT\": \"Egtheow\",\n";
-                ss << u8"    \"koKR\": \"에그소\",\n";
-                ss << u8"    \"plPL\": \"Egtheow\",\n";
-                ss << u8"    \"esMX\": \"Egtheow\",\n";
-                ss << u8"    \"jaJP\": \"エグシオウ\",\n";
-                ss << u8"    \"ptBR\": \"Egteo\",\n";
-                ss << u8"    \"ruRU\": \"Эгтеов\",\n";
-                ss << u8"    \"zhCN\": \"艾格西乌\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10848,\n";
-                ss << u8"    \"Key\": \"MercX114\",\n";
-                ss << u8"    \"enUS\": \"Bohdan\",\n";
-                ss << u8"    \"zhTW\": \"波赫丹\",\n";
-                ss << u8"    \"deDE\": \"Bidan\",\n";
-                ss << u8"    \"esES\": \"Bidan\",\n";
-                ss << u8"    \"frFR\": \"Bohdan\",\n";
-                ss << u8"    \"itIT\": \"Bohdan\",\n";
-                ss << u8"    \"koKR\": \"보단\",\n";
-                ss << u8"    \"plPL\": \"Bohdan\",\n";
-                ss << u8"    \"esMX\": \"Bohdan\",\n";
-                ss << u8"    \"jaJP\": \"ボーダン\",\n";
-                ss << u8"    \"ptBR\": \"Bodan\",\n";
-                ss << u8"    \"ruRU\": \"Бодан\",\n";
-                ss << u8"    \"zhCN\": \"柏和丹\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10849,\n";
-                ss << u8"    \"Key\": \"MercX115\",\n";
-                ss << u8"    \"enUS\": \"Wulfgar\",\n";
-                ss << u8"    \"zhTW\": \"沃夫加\",\n";
-                ss << u8"    \"deDE\": \"Ifger\",\n";
-                ss << u8"    \"esES\": \"Ifger\",\n";
-                ss << u8"    \"frFR\": \"Wulfgar\",\n";
-                ss << u8"    \"itIT\": \"Wulfgar\",\n";
-                ss << u8"    \"koKR\": \"울프가르\",\n";
-                ss << u8"    \"plPL\": \"Wulfgar\",\n";
-                ss << u8"    \"esMX\": \"Wulfgar\",\n";
-                ss << u8"    \"jaJP\": \"ウォルフガル\",\n";
-                ss << u8"    \"ptBR\": \"Wulfgar\",\n";
-                ss << u8"    \"ruRU\": \"Вульфгар\",\n";
-                ss << u8"    \"zhCN\": \"沃夫加尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10850,\n";
-                ss << u8"    \"Key\": \"MercX116\",\n";
-                ss << u8"    \"enUS\": \"Hild\",\n";
-                ss << u8"    \"zhTW\": \"希爾德\",\n";
-                ss << u8"    \"deDE\": \"Hild\",\n";
-                ss << u8"    \"esES\": \"Hild\",\n";
-                ss << u8"    \"frFR\": \"Hild\",\n";
-                ss << u8"    \"itIT\": \"Hild\",\n";
-                ss << u8"    \"koKR\": \"힐드\",\n";
-                ss << u8"    \"plPL\": \"Hild\",\n";
-                ss << u8"    \"esMX\": \"Hild\",\n";
-                ss << u8"    \"jaJP\": \"ヒルド\",\n";
-                ss << u8"    \"ptBR\": \"Hild\",\n";
-                ss << u8"    \"ruRU\": \"Хильд\",\n";
-                ss << u8"    \"zhCN\": \"希尔德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10851,\n";
-                ss << u8"    \"Key\": \"MercX117\",\n";
-                ss << u8"    \"enUS\": \"Heatholaf\",\n";
-                ss << u8"    \"zhTW\": \"希斯洛夫\",\n";
-                ss << u8"    \"deDE\": \"Hatho\",\n";
-                ss << u8"    \"esES\": \"Hatho\",\n";
-                ss << u8"    \"frFR\": \"Heatholaf\",\n";
-                ss << u8"    \"itIT\": \"Heatholaf\",\n";
-                ss << u8"    \"koKR\": \"히솔라프\",\n";
-                ss << u8"    \"plPL\": \"Heatholaf\",\n";
-                ss << u8"    \"esMX\": \"Heatholaf\",\n";
-                ss << u8"    \"jaJP\": \"ハーソラフ\",\n";
-                ss << u8"    \"ptBR\": \"Etolaf\",\n";
-                ss << u8"    \"ruRU\": \"Хитолаф\",\n";
-                ss << u8"    \"zhCN\": \"西索拉夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10852,\n";
-                ss << u8"    \"Key\": \"MercX118\",\n";
-                ss << u8"    \"enUS\": \"Weder\",\n";
-                ss << u8"    \"zhTW\": \"魏德\",\n";
-                ss << u8"    \"deDE\": \"Veder\",\n";
-                ss << u8"    \"esES\": \"Veder\",\n";
-                ss << u8"    \"frFR\": \"Weder\",\n";
-                ss << u8"    \"itIT\": \"Weder\",\n";
-                ss << u8"    \"koKR\": \"웨데르\",\n";
-                ss << u8"    \"plPL\": \"Weder\",\n";
-                ss << u8"    \"esMX\": \"Weder\",\n";
-                ss << u8"    \"jaJP\": \"ウェダル\",\n";
-                ss << u8"    \"ptBR\": \"Weder\",\n";
-                ss << u8"    \"ruRU\": \"Ведер\",\n";
-                ss << u8"    \"zhCN\": \"维德尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10853,\n";
-                ss << u8"    \"Key\": \"MercX119\",\n";
-                ss << u8"    \"enUS\": \"Vikhyat\",\n";
-                ss << u8"    \"zhTW\": \"維克海亞特\",\n";
-                ss << u8"    \"deDE\": \"Vihat\",\n";
-                ss << u8"    \"esES\": \"Vikhyat\",\n";
-                ss << u8"    \"frFR\": \"Vikhyat\",\n";
-                ss << u8"    \"itIT\": \"Vikhyat\",\n";
-                ss << u8"    \"koKR\": \"비크햐트\",\n";
-                ss << u8"    \"plPL\": \"Vikhyat\",\n";
-                ss << u8"    \"esMX\": \"Vikhyat\",\n";
-                ss << u8"    \"jaJP\": \"ヴィクヒャト\",\n";
-                ss << u8"    \"ptBR\": \"Vikiat\",\n";
-                ss << u8"    \"ruRU\": \"Вихьят\",\n";
-                ss << u8"    \"zhCN\": \"维基亚特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10854,\n";
-                ss << u8"    \"Key\": \"MercX120\",\n";
-                ss << u8"    \"enUS\": \"Unferth\",\n";
-                ss << u8"    \"zhTW\": \"安佛斯\",\n";
-                ss << u8"    \"deDE\": \"Flrth\",\n";
-                ss << u8"    \"esES\": \"Ferth\",\n";
-                ss << u8"    \"frFR\": \"Unferth\",\n";
-                ss << u8"    \"itIT\": \"Unferth\",\n";
-                ss << u8"    \"koKR\": \"운페르트\",\n";
-                ss << u8"    \"plPL\": \"Unferth\",\n";
-                ss << u8"    \"esMX\": \"Unferth\",\n";
-                ss << u8"    \"jaJP\": \"アンフェルス\",\n";
-                ss << u8"    \"ptBR\": \"Unfert\",\n";
-                ss << u8"    \"ruRU\": \"Унферт\",\n";
-                ss << u8"    \"zhCN\": \"昂菲斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10855,\n";
-                ss << u8"    \"Key\": \"MercX121\",\n";
-                ss << u8"    \"enUS\": \"Sigemund\",\n";
-                ss << u8"    \"zhTW\": \"希格門德\",\n";
-                ss << u8"    \"deDE\": \"Tund\",\n";
-                ss << u8"    \"esES\": \"Tund\",\n";
-                ss << u8"    \"frFR\": \"Sigemund\",\n";
-                ss << u8"    \"itIT\": \"Sigemund\",\n";
-                ss << u8"    \"koKR\": \"시게문드\",\n";
-                ss << u8"    \"plPL\": \"Sigemund\",\n";
-                ss << u8"    \"esMX\": \"Sigemund\",\n";
-                ss << u8"    \"jaJP\": \"シグムンド\",\n";
-                ss << u8"    \"ptBR\": \"Sigmund\",\n";
-                ss << u8"    \"ruRU\": \"Сигемунд\",\n";
-                ss << u8"    \"zhCN\": \"希格蒙德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10856,\n";
-                ss << u8"    \"Key\": \"MercX122\",\n";
-                ss << u8"    \"enUS\": \"Heremod\",\n";
-                ss << u8"    \"zhTW\": \"希爾穆特\",\n";
-                ss << u8"    \"deDE\": \"Ermd\",\n";
-                ss << u8"    \"esES\": \"Ermod\",\n";
-                ss << u8"    \"frFR\": \"Heremod\",\n";
-                ss << u8"    \"itIT\": \"Heremod\",\n";
-                ss << u8"    \"koKR\": \"헤레모드\",\n";
-                ss << u8"    \"plPL\": \"Heremod\",\n";
-                ss << u8"    \"esMX\": \"Heremod\",\n";
-                ss << u8"    \"jaJP\": \"ヘレモッド\",\n";
-                ss << u8"    \"ptBR\": \"Eremod\",\n";
-                ss << u8"    \"ruRU\": \"Геремод\",\n";
-                ss << u8"    \"zhCN\": \"赫雷默德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10857,\n";
-                ss << u8"    \"Key\": \"MercX123\",\n";
-                ss << u8"    \"enUS\": \"Hengest\",\n";
-                ss << u8"    \"zhTW\": \"罕格斯特\",\n";
-                ss << u8"    \"deDE\": \"Hoglt\",\n";
-                ss << u8"    \"esES\": \"Hogst\",\n";
-                ss << u8"    \"frFR\": \"Hengest\",\n";
-                ss << u8"    \"itIT\": \"Hengest\",\n";
-                ss << u8"    \"koKR\": \"헨게스트\",\n";
-                ss << u8"    \"plPL\": \"Hengest\",\n";
-                ss << u8"    \"esMX\": \"Hengest\",\n";
-                ss << u8"    \"jaJP\": \"ヘンジェスト\",\n";
-                ss << u8"    \"ptBR\": \"Engest\",\n";
-                ss << u8"    \"ruRU\": \"Хенгист\",\n";
-                ss << u8"    \"zhCN\": \"亨杰斯特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10858,\n";
-                ss << u8"    \"Key\": \"MercX124\",\n";
-                ss << u8"    \"enUS\": \"Folcwald\",\n";
-                ss << u8"    \"zhTW\": \"弗克魏爾德\",\n";
-                ss << u8"    \"deDE\": \"Feol\",\n";
-                ss << u8"    \"esES\": \"Feold\",\n";
-                ss << u8"    \"frFR\": \"Folcwald\",\n";
-                ss << u8"    \"itIT\": \"Folcwald\",\n";
-                ss << u8"    \"koKR\": \"폴크왈드\",\n";
-                ss << u8"    \"plPL\": \"Folcwald\",\n";
-                ss << u8"    \"esMX\": \"Folcwald\",\n";
-                ss << u8"    \"jaJP\": \"フルクワルド\",\n";
-                ss << u8"    \"ptBR\": \"Folcwald\",\n";
-                ss << u8"    \"ruRU\": \"Фольквальд\",\n";
-                ss << u8"    \"zhCN\": \"佛科瓦尔德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10859,\n";
-                ss << u8"    \"Key\": \"MercX125\",\n";
-                ss << u8"    \"enUS\": \"Frisian\",\n";
-                ss << u8"    \"zhTW\": \"弗雷斯坦\",\n";
-                ss << u8"    \"deDE\": \"Fianz\",\n";
-                ss << u8"    \"esES\": \"Fianz\",\n";
-                ss << u8"    \"frFR\": \"Frisian\",\n";
-                ss << u8"    \"itIT\": \"Frisian\",\n";
-                ss << u8"    \"koKR\": \"프리지안\",\n";
-                ss << u8"    \"plPL\": \"Frisian\",\n";
-                ss << u8"    \"esMX\": \"Frisian\",\n";
-                ss << u8"    \"jaJP\": \"フリジアン\",\n";
-                ss << u8"    \"ptBR\": \"Frisian\",\n";
-                ss << u8"    \"ruRU\": \"Фризиан\",\n";
-                ss << u8"    \"zhCN\": \"弗里贤\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10860,\n";
-                ss << u8"    \"Key\": \"MercX126\",\n";
-                ss << u8"    \"enUS\": \"Hnaef\",\n";
-                ss << u8"    \"zhTW\": \"荷那夫\",\n";
-                ss << u8"    \"deDE\": \"Hnaf\",\n";
-                ss << u8"    \"esES\": \"Hnaef\",\n";
-                ss << u8"    \"frFR\": \"Hnaef\",\n";
-                ss << u8"    \"itIT\": \"Hnaef\",\n";
-                ss << u8"    \"koKR\": \"흐네프\",\n";
-                ss << u8"    \"plPL\": \"Hnaef\",\n";
-                ss << u8"    \"esMX\": \"Hnaef\",\n";
-                ss << u8"    \"jaJP\": \"フネイフ\",\n";
-                ss << u8"    \"ptBR\": \"Nef\",\n";
-                ss << u8"    \"ruRU\": \"Хнаф\",\n";
-                ss << u8"    \"zhCN\": \"纳伊夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10861,\n";
-                ss << u8"    \"Key\": \"MercX127\",\n";
-                ss << u8"    \"enUS\": \"Guthlaf\",\n";
-                ss << u8"    \"zhTW\": \"高斯拉夫\",\n";
-                ss << u8"    \"deDE\": \"Thlf\",\n";
-                ss << u8"    \"esES\": \"Thlaf\",\n";
-                ss << u8"    \"frFR\": \"Guthlaf\",\n";
-                ss << u8"    \"itIT\": \"Guthlaf\",\n";
-                ss << u8"    \"koKR\": \"구슬라프\",\n";
-                ss << u8"    \"plPL\": \"Guthlaf\",\n";
-                ss << u8"    \"esMX\": \"Guthlaf\",\n";
-                ss << u8"    \"jaJP\": \"ガスラフ\",\n";
-                ss << u8"    \"ptBR\": \"Gutlaf\",\n";
-                ss << u8"    \"ruRU\": \"Гутлаф\",\n";
-                ss << u8"    \"zhCN\": \"古特拉夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10862,\n";
-                ss << u8"    \"Key\": \"MercX128\",\n";
-                ss << u8"    \"enUS\": \"Oslaf\",\n";
-                ss << u8"    \"zhTW\": \"歐斯拉夫\",\n";
-                ss << u8"    \"deDE\": \"Oslaf\",\n";
-                ss << u8"    \"esES\": \"Oslaf\",\n";
-                ss << u8"    \"frFR\": \"Oslaf\",\n";
-                ss << u8"    \"itIT\": \"Oslaf\",\n";
-                ss << u8"    \"koKR\": \"오슬라프\",\n";
-                ss << u8"    \"plPL\": \"Oslaf\",\n";
-                ss << u8"    \"esMX\": \"Oslaf\",\n";
-                ss << u8"    \"jaJP\": \"オスラフ\",\n";
-                ss << u8"    \"ptBR\": \"Oslaf\",\n";
-                ss << u8"    \"ruRU\": \"Ослаф\",\n";
-                ss << u8"    \"zhCN\": \"欧斯拉夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10863,\n";
-                ss << u8"    \"Key\": \"MercX129\",\n";
-                ss << u8"    \"enUS\": \"Yrmenlaf\",\n";
-                ss << u8"    \"zhTW\": \"亞門拉夫\",\n";
-                ss << u8"    \"deDE\": \"Jlaf\",\n";
-                ss << u8"    \"esES\": \"Jlaf\",\n";
-                ss << u8"    \"frFR\": \"Yrmenlaf\",\n";
-                ss << u8"    \"itIT\": \"Yrmenlaf\",\n";
-                ss << u8"    \"koKR\": \"이르멘라프\",\n";
-                ss << u8"    \"plPL\": \"Yrmenlaf\",\n";
-                ss << u8"    \"esMX\": \"Yrmenlaf\",\n";
-                ss << u8"    \"jaJP\": \"ヨルムンラフ\",\n";
-                ss << u8"    \"ptBR\": \"Irmenlaf\",\n";
-                ss << u8"    \"ruRU\": \"Ирменлаф\",\n";
-                ss << u8"    \"zhCN\": \"伊门拉夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10864,\n";
-                ss << u8"    \"Key\": \"MercX130\",\n";
-                ss << u8"    \"enUS\": \"Garmund\",\n";
-                ss << u8"    \"zhTW\": \"加門德\",\n";
-                ss << u8"    \"deDE\": \"Oslae\",\n";
-                ss << u8"    \"esES\": \"Osfae\",\n";
-                ss << u8"    \"frFR\": \"Garmund\",\n";
-                ss << u8"    \"itIT\": \"Garmund\",\n";
-                ss << u8"    \"koKR\": \"가르문드\",\n";
-                ss << u8"    \"plPL\": \"Garmund\",\n";
-                ss << u8"    \"esMX\": \"Garmund\",\n";
-                ss << u8"    \"jaJP\": \"ガルムンド\",\n";
-                ss << u8"    \"ptBR\": \"Garmund\",\n";
-                ss << u8"    \"ruRU\": \"Гармунд\",\n";
-                ss << u8"    \"zhCN\": \"加尔蒙德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10865,\n";
-                ss << u8"    \"Key\": \"MercX131\",\n";
-                ss << u8"    \"enUS\": \"Lanth\",\n";
-                ss << u8"    \"zhTW\": \"拉恩斯\",\n";
-                ss << u8"    \"deDE\": \"Friu\",\n";
-                ss << u8"    \"esES\": \"Freu\",\n";
-                ss << u8"    \"frFR\": \"Freawaru\",\n";
-                ss << u8"    \"itIT\": \"Freawaru\",\n";
-                ss << u8"    \"koKR\": \"란트\",\n";
-                ss << u8"    \"plPL\": \"Lanth\",\n";
-                ss << u8"    \"esMX\": \"Lanth\",\n";
-                ss << u8"    \"jaJP\": \"ランス\",\n";
-                ss << u8"    \"ptBR\": \"Lant\",\n";
-                ss << u8"    \"ruRU\": \"Лант\",\n";
-                ss << u8"    \"zhCN\": \"朗斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10866,\n";
-                ss << u8"    \"Key\": \"MercX132\",\n";
-                ss << u8"    \"enUS\": \"Eadgils\",\n";
-                ss << u8"    \"zhTW\": \"艾德格理斯\",\n";
-                ss << u8"    \"deDE\": \"Agils\",\n";
-                ss << u8"    \"esES\": \"Agils\",\n";
-                ss << u8"    \"frFR\": \"Eadgils\",\n";
-                ss << u8"    \"itIT\": \"Eadgils\",\n";
-                ss << u8"    \"koKR\": \"이드길스\",\n";
-                ss << u8"    \"plPL\": \"Eadgils\",\n";
-                ss << u8"    \"esMX\": \"Eadgils\",\n";
-                ss << u8"    \"jaJP\": \"イードギルズ\",\n";
-                ss << u8"    \"ptBR\": \"Eguil\",\n";
-                ss << u8"    \"ruRU\": \"Адильс\",\n";
-                ss << u8"    \"zhCN\": \"伊德吉斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10867,\n";
-                ss << u8"    \"Key\": \"MercX133\",\n";
-                ss << u8"    \"enUS\": \"Onela\",\n";
-                ss << u8"    \"zhTW\": \"奧尼拉\",\n";
-                ss << u8"    \"deDE\": \"Onel\",\n";
-                ss << u8"    \"esES\": \"Onela\",\n";
-                ss << u8"    \"frFR\": \"Onela\",\n";
-                ss << u8"    \"itIT\": \"Onela\",\n";
-                ss << u8"    \"koKR\": \"오넬라\",\n";
-                ss << u8"    \"plPL\": \"Onela\",\n";
-                ss << u8"    \"esMX\": \"Onela\",\n";
-                ss << u8"    \"jaJP\": \"オニーラ\",\n";
-                ss << u8"    \"ptBR\": \"Onela\",\n";
-                ss << u8"    \"ruRU\": \"Онела\",\n";
-                ss << u8"    \"zhCN\": \"欧内拉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10868,\n";
-                ss << u8"    \"Key\": \"MercX134\",\n";
-                ss << u8"    \"enUS\": \"Damien\",\n";
-                ss << u8"    \"zhTW\": \"戴米安\",\n";
-                ss << u8"    \"deDE\": \"Dama\",\n";
-                ss << u8"    \"esES\": \"Damien\",\n";
-                ss << u8"    \"frFR\": \"Damien\",\n";
-                ss << u8"    \"itIT\": \"Damien\",\n";
-                ss << u8"    \"koKR\": \"다미엔\",\n";
-                ss << u8"    \"plPL\": \"Damien\",\n";
-                ss << u8"    \"esMX\": \"Damien\",\n";
-                ss << u8"    \"jaJP\": \"ダミアン\",\n";
-                ss << u8"    \"ptBR\": \"Damião\",\n";
-                ss << u8"    \"ruRU\": \"Дамиен\",\n";
-                ss << u8"    \"zhCN\": \"达米恩\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10869,\n";
-                ss << u8"    \"Key\": \"MercX135\",\n";
-                ss << u8"    \"enUS\": \"Tryneus\",\n";
-                ss << u8"    \"zhTW\": \"崔尼爾斯\",\n";
-                ss << u8"    \"deDE\": \"Erfor\",\n";
-                ss << u8"    \"esES\": \"Erfor\",\n";
-                ss << u8"    \"frFR\": \"Erfor\",\n";
-                ss << u8"    \"itIT\": \"Erfor\",\n";
-                ss << u8"    \"koKR\": \"트리네우스\",\n";
-                ss << u8"    \"plPL\": \"Tryneus\",\n";
-                ss << u8"    \"esMX\": \"Tryneus\",\n";
-                ss << u8"    \"jaJP\": \"トリニュース\",\n";
-                ss << u8"    \"ptBR\": \"Trineu\",\n";
-                ss << u8"    \"ruRU\": \"Триней\",\n";
-                ss << u8"    \"zhCN\": \"特瑞纽斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10870,\n";
-                ss << u8"    \"Key\": \"MercX136\",\n";
-                ss << u8"    \"enUS\": \"Klar\",\n";
-                ss << u8"    \"zhTW\": \"克拉爾\",\n";
-                ss << u8"    \"deDE\": \"Iejyz\",\n";
-                ss << u8"    \"esES\": \"Wejyz\",\n";
-                ss << u8"    \"frFR\": \"Weohstan\",\n";
-                ss << u8"    \"itIT\": \"Weohstan\",\n";
-                ss << u8"    \"koKR\": \"클라르\",\n";
-                ss << u8"    \"plPL\": \"Klar\",\n";
-                ss << u8"    \"esMX\": \"Klar\",\n";
-                ss << u8"    \"jaJP\": \"クラル\",\n";
-                ss << u8"    \"ptBR\": \"Klar\",\n";
-                ss << u8"    \"ruRU\": \"Клар\",\n";
-                ss << u8"    \"zhCN\": \"克拉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10871,\n";
-                ss << u8"    \"Key\": \"MercX137\",\n";
-                ss << u8"    \"enUS\": \"Wulf\",\n";
-                ss << u8"    \"zhTW\": \"沃爾夫\",\n";
-                ss << u8"    \"deDE\": \"Wulf\",\n";
-                ss << u8"    \"esES\": \"Wulf\",\n";
-                ss << u8"    \"frFR\": \"Wulf\",\n";
-                ss << u8"    \"itIT\": \"Wulf\",\n";
-                ss << u8"    \"koKR\": \"울프\",\n";
-                ss << u8"    \"plPL\": \"Wulf\",\n";
-                ss << u8"    \"esMX\": \"Wulf\",\n";
-                ss << u8"    \"jaJP\": \"ウォルフ\",\n";
-                ss << u8"    \"ptBR\": \"Wulf\",\n";
-                ss << u8"    \"ruRU\": \"Вульф\",\n";
-                ss << u8"    \"zhCN\": \"沃夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10872,\n";
-                ss << u8"    \"Key\": \"MercX138\",\n";
-                ss << u8"    \"enUS\": \"Bulwye\",\n";
-                ss << u8"    \"zhTW\": \"布爾溫\",\n";
-                ss << u8"    \"deDE\": \"Liwie\",\n";
-                ss << u8"    \"esES\": \"Liwye\",\n";
-                ss << u8"    \"frFR\": \"Bulwye\",\n";
-                ss << u8"    \"itIT\": \"Bulwye\",\n";
-                ss << u8"    \"koKR\": \"불와이\",\n";
-                ss << u8"    \"plPL\": \"Bulwye\",\n";
-                ss << u8"    \"esMX\": \"Bulwye\",\n";
-                ss << u8"    \"jaJP\": \"バルウィ\",\n";
-                ss << u8"    \"ptBR\": \"Bulif\",\n";
-                ss << u8"    \"ruRU\": \"Балвий\",\n";
-                ss << u8"    \"zhCN\": \"布尔维\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10873,\n";
-                ss << u8"    \"Key\": \"MercX139\",\n";
-                ss << u8"    \"enUS\": \"Lief\",\n";
-                ss << u8"    \"zhTW\": \"理夫\",\n";
-                ss << u8"    \"deDE\": \"Lief\",\n";
-                ss << u8"    \"esES\": \"Lief\",\n";
-                ss << u8"    \"frFR\": \"Lief\",\n";
-                ss << u8"    \"itIT\": \"Lief\",\n";
-                ss << u8"    \"koKR\": \"리프\",\n";
-                ss << u8"    \"plPL\": \"Lief\",\n";
-                ss << u8"    \"esMX\": \"Lief\",\n";
-                ss << u8"    \"jaJP\": \"リエフ\",\n";
-                ss << u8"    \"ptBR\": \"Lief\",\n";
-                ss << u8"    \"ruRU\": \"Лиеф\",\n";
-                ss << u8"    \"zhCN\": \"列夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10874,\n";
-                ss << u8"    \"Key\": \"MercX140\",\n";
-                ss << u8"    \"enUS\": \"Magnus\",\n";
-                ss << u8"    \"zhTW\": \"馬格納斯\",\n";
-                ss << u8"    \"deDE\": \"Magu\",\n";
-                ss << u8"    \"esES\": \"Magus\",\n";
-                ss << u8"    \"frFR\": \"Magnus\",\n";
-                ss << u8"    \"itIT\": \"Magnus\",\n";
-                ss << u8"    \"koKR\": \"마그누스\",\n";
-                ss << u8"    \"plPL\": \"Magnus\",\n";
-                ss << u8"    \"esMX\": \"[ms]Magnus\",\n";
-                ss << u8"    \"jaJP\": \"マグナス\",\n";
-                ss << u8"    \"ptBR\": \"Magnus\",\n";
-                ss << u8"    \"ruRU\": \"Магнус\",\n";
-                ss << u8"    \"zhCN\": \"玛格努斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10875,\n";
-                ss << u8"    \"Key\": \"MercX141\",\n";
-                ss << u8"    \"enUS\": \"Klatu\",\n";
-                ss << u8"    \"zhTW\": \"格拉圖\",\n";
-                ss << u8"    \"deDE\": \"Klatu\",\n";
-                ss << u8"    \"esES\": \"Klatu\",\n";
-                ss << u8"    \"frFR\": \"Klatu\",\n";
-                ss << u8"    \"itIT\": \"Klatu\",\n";
-                ss << u8"    \"koKR\": \"클라투\",\n";
-                ss << u8"    \"plPL\": \"Klatu\",\n";
-                ss << u8"    \"esMX\": \"Klatu\",\n";
-                ss << u8"    \"jaJP\": \"クラトゥ\",\n";
-                ss << u8"    \"ptBR\": \"Klatu\",\n";
-                ss << u8"    \"ruRU\": \"Клату\",\n";
-                ss << u8"    \"zhCN\": \"克拉图\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10876,\n";
-                ss << u8"    \"Key\": \"MercX142\",\n";
-                ss << u8"    \"enUS\": \"Drus\",\n";
-                ss << u8"    \"zhTW\": \"圖魯斯\",\n";
-                ss << u8"    \"deDE\": \"Drus\",\n";
-                ss << u8"    \"esES\": \"Drus\",\n";
-                ss << u8"    \"frFR\": \"Drus\",\n";
-                ss << u8"    \"itIT\": \"Drus\",\n";
-                ss << u8"    \"koKR\": \"드루스\",\n";
-                ss << u8"    \"plPL\": \"Drus\",\n";
-                ss << u8"    \"esMX\": \"Drus\",\n";
-                ss << u8"    \"jaJP\": \"ドルス\",\n";
-                ss << u8"    \"ptBR\": \"Drus\",\n";
-                ss << u8"    \"ruRU\": \"Друс\",\n";
-                ss << u8"    \"zhCN\": \"德鲁斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10877,\n";
-                ss << u8"    \"Key\": \"MercX143\",\n";
-                ss << u8"    \"enUS\": \"Hoku\",\n";
-                ss << u8"    \"zhTW\": \"候克\",\n";
-                ss << u8"    \"deDE\": \"Hoku\",\n";
-                ss << u8"    \"esES\": \"Hoku\",\n";
-                ss << u8"    \"frFR\": \"Hoku\",\n";
-                ss << u8"    \"itIT\": \"Hoku\",\n";
-                ss << u8"    \"koKR\": \"호쿠\",\n";
-                ss << u8"    \"plPL\": \"Hoku\",\n";
-                ss << u8"    \"esMX\": \"Hoku\",\n";
-                ss << u8"    \"jaJP\": \"ホク\",\n";
-                ss << u8"    \"ptBR\": \"Hokan\",\n";
-                ss << u8"    \"ruRU\": \"Хоку\",\n";
-                ss << u8"    \"zhCN\": \"霍库\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10878,\n";
-                ss << u8"    \"Key\": \"MercX144\",\n";
-                ss << u8"    \"enUS\": \"Kord\",\n";
-                ss << u8"    \"zhTW\": \"科杜\",\n";
-                ss << u8"    \"deDE\": \"Kord\",\n";
-                ss << u8"    \"esES\": \"Kord\",\n";
-                ss << u8"    \"frFR\": \"Kord\",\n";
-                ss << u8"    \"itIT\": \"Kord\",\n";
-                ss << u8"    \"koKR\": \"코르드\",\n";
-                ss << u8"    \"plPL\": \"Kord\",\n";
-                ss << u8"    \"esMX\": \"Kord\",\n";
-                ss << u8"    \"jaJP\": \"コルド\",\n";
-                ss << u8"    \"ptBR\": \"Kord\",\n";
-                ss << u8"    \"ruRU\": \"Корд\",\n";
-                ss << u8"    \"zhCN\": \"科德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10879,\n";
-                ss << u8"    \"Key\": \"MercX145\",\n";
-                ss << u8"    \"enUS\": \"Uther\",\n";
-                ss << u8"    \"zhTW\": \"烏瑟爾\",\n";
-                ss << u8"    \"deDE\": \"Uthr\",\n";
-                ss << u8"    \"esES\": \"Uther\",\n";
-                ss << u8"    \"frFR\": \"Uther\",\n";
-                ss << u8"    \"itIT\": \"Uther\",\n";
-                ss << u8"    \"koKR\": \"우서\",\n";
-                ss << u8"    \"plPL\": \"Uther\",\n";
-                ss << u8"    \"esMX\": \"Uther\",\n";
-                ss << u8"    \"jaJP\": \"ウーサー\",\n";
-                ss << u8"    \"ptBR\": \"Uther\",\n";
-                ss << u8"    \"ruRU\": \"Утер\",\n";
-                ss << u8"    \"zhCN\": \"乌瑟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10880,\n";
-                ss << u8"    \"Key\": \"MercX146\",\n";
-                ss << u8"    \"enUS\": \"Ip\",\n";
-                ss << u8"    \"zhTW\": \"艾普\",\n";
-                ss << u8"    \"deDE\": \"Stuu\",\n";
-                ss << u8"    \"esES\": \"Stu\",\n";
-                ss << u8"    \"frFR\": \"Ip\",\n";
-                ss << u8"    \"itIT\": \"Ip\",\n";
-                ss << u8"    \"koKR\": \"아이프\",\n";
-                ss << u8"    \"plPL\": \"Ip\",\n";
-                ss << u8"    \"esMX\": \"Ip\",\n";
-                ss << u8"    \"jaJP\": \"イプ\",\n";
-                ss << u8"    \"ptBR\": \"Ip\",\n";
-                ss << u8"    \"ruRU\": \"Ип\",\n";
-                ss << u8"    \"zhCN\": \"艾普\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10881,\n";
-                ss << u8"    \"Key\": \"MercX147\",\n";
-                ss << u8"    \"enUS\": \"Ulf\",\n";
-                ss << u8"    \"zhTW\": \"伍夫\",\n";
-                ss << u8"    \"deDE\": \"Ulf\",\n";
-                ss << u8"    \"esES\": \"Ulf\",\n";
-                ss << u8"    \"frFR\": \"Ulf\",\n";
-                ss << u8"    \"itIT\": \"Ulf\",\n";
-                ss << u8"    \"koKR\": \"얼프\",\n";
-                ss << u8"    \"plPL\": \"Ulf\",\n";
-                ss << u8"    \"esMX\": \"Ulf\",\n";
-                ss << u8"    \"jaJP\": \"ユルフ\",\n";
-                ss << u8"    \"ptBR\": \"Ulf\",\n";
-                ss << u8"    \"ruRU\": \"Ульф\",\n";
-                ss << u8"    \"zhCN\": \"乌尔夫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10882,\n";
-                ss << u8"    \"Key\": \"MercX148\",\n";
-                ss << u8"    \"enUS\": \"Tharr\",\n";
-                ss << u8"    \"zhTW\": \"撒爾\",\n";
-                ss << u8"    \"deDE\": \"Tharr\",\n";
-                ss << u8"    \"esES\": \"Tharr\",\n";
-                ss << u8"    \"frFR\": \"Tharr\",\n";
-                ss << u8"    \"itIT\": \"Tharr\",\n";
-                ss << u8"    \"koKR\": \"타르\",\n";
-                ss << u8"    \"plPL\": \"Tharr\",\n";
-                ss << u8"    \"esMX\": \"Tharr\",\n";
-                ss << u8"    \"jaJP\": \"タール\",\n";
-                ss << u8"    \"ptBR\": \"Tarr\",\n";
-                ss << u8"    \"ruRU\": \"Тарр\",\n";
-                ss << u8"    \"zhCN\": \"萨尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10883,\n";
-                ss << u8"    \"Key\": \"MercX149\",\n";
-                ss << u8"    \"enUS\": \"Kaelim\",\n";
-                ss << u8"    \"zhTW\": \"卡林姆\",\n";
-                ss << u8"    \"deDE\": \"Kalim\",\n";
-                ss << u8"    \"esES\": \"Kalim\",\n";
-                ss << u8"    \"frFR\": \"Kaelim\",\n";
-                ss << u8"    \"itIT\": \"Kaelim\",\n";
-                ss << u8"    \"koKR\": \"캘림\",\n";
-                ss << u8"    \"plPL\": \"Kaelim\",\n";
-                ss << u8"    \"esMX\": \"Kaelim\",\n";
-                ss << u8"    \"jaJP\": \"ケイリム\",\n";
-                ss << u8"    \"ptBR\": \"Kaelim\",\n";
-                ss << u8"    \"ruRU\": \"Кэлим\",\n";
-                ss << u8"    \"zhCN\": \"凯林姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10884,\n";
-                ss << u8"    \"Key\": \"MercX150\",\n";
-                ss << u8"    \"enUS\": \"Ulric\",\n";
-                ss << u8"    \"zhTW\": \"烏瑞克\",\n";
-                ss << u8"    \"deDE\": \"lIric\",\n";
-                ss << u8"    \"esES\": \"Ulric\",\n";
-                ss << u8"    \"frFR\": \"Ulric\",\n";
-                ss << u8"    \"itIT\": \"Ulric\",\n";
-                ss << u8"    \"koKR\": \"울릭\",\n";
-                ss << u8"    \"plPL\": \"Ulryk\",\n";
-                ss << u8"    \"esMX\": \"Ulric\",\n";
-                ss << u8"    \"jaJP\": \"ウルリック\",\n";
-                ss << u8"    \"ptBR\": \"Ulric\",\n";
-                ss << u8"    \"ruRU\": \"Ульрик\",\n";
-                ss << u8"    \"zhCN\": \"奥瑞克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10885,\n";
-                ss << u8"    \"Key\": \"MercX151\",\n";
-                ss << u8"    \"enUS\": \"Alaric\",\n";
-                ss << u8"    \"zhTW\": \"艾勒瑞克\",\n";
-                ss << u8"    \"deDE\": \"Aric\",\n";
-                ss << u8"    \"esES\": \"Aric\",\n";
-                ss << u8"    \"frFR\": \"Alaric\",\n";
-                ss << u8"    \"itIT\": \"Alaric\",\n";
-                ss << u8"    \"koKR\": \"알라릭\",\n";
-                ss << u8"    \"plPL\": \"Alaryk\",\n";
-                ss << u8"    \"esMX\": \"Alaric\",\n";
-                ss << u8"    \"jaJP\": \"アラリック\",\n";
-                ss << u8"    \"ptBR\": \"Alaric\",\n";
-                ss << u8"    \"ruRU\": \"Аларик\",\n";
-                ss << u8"    \"zhCN\": \"埃拉里克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10886,\n";
-                ss << u8"    \"Key\": \"MercX152\",\n";
-                ss << u8"    \"enUS\": \"Ethelred\",\n";
-                ss << u8"    \"zhTW\": \"愛瑟瑞德\",\n";
-                ss << u8"    \"deDE\": \"Eleyd\",\n";
-                ss << u8"    \"esES\": \"Eleyd\",\n";
-                ss << u8"    \"frFR\": \"Ethelred\",\n";
-                ss << u8"    \"itIT\": \"Ethelred\",\n";
-                ss << u8"    \"koKR\": \"에텔레드\",\n";
-                ss << u8"    \"plPL\": \"Ethelred\",\n";
-                ss << u8"    \"esMX\": \"Ethelred\",\n";
-                ss << u8"    \"jaJP\": \"エセルレッド\",\n";
-                ss << u8"    \"ptBR\": \"Etelred\",\n";
-                ss << u8"    \"ruRU\": \"Этельред\",\n";
-                ss << u8"    \"zhCN\": \"伊瑟雷德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10887,\n";
-                ss << u8"    \"Key\": \"MercX153\",\n";
-                ss << u8"    \"enUS\": \"Caden\",\n";
-                ss << u8"    \"zhTW\": \"卡登\",\n";
-                ss << u8"    \"deDE\": \"Caden\",\n";
-                ss << u8"    \"esES\": \"Jay\",\n";
-                ss << u8"    \"frFR\": \"Caden\",\n";
-                ss << u8"    \"itIT\": \"Caden\",\n";
-                ss << u8"    \"koKR\": \"카덴\",\n";
-                ss << u8"    \"plPL\": \"Caden\",\n";
-                ss << u8"    \"esMX\": \"Caden\",\n";
-                ss << u8"    \"jaJP\": \"ケイデン\",\n";
-                ss << u8"    \"ptBR\": \"Cáden\",\n";
-                ss << u8"    \"ruRU\": \"Кейден\",\n";
-                ss << u8"    \"zhCN\": \"卡登\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10888,\n";
-                ss << u8"    \"Key\": \"MercX154\",\n";
-                ss << u8"    \"enUS\": \"Elgifu\",\n";
-                ss << u8"    \"zhTW\": \"伊爾吉夫\",\n";
-                ss << u8"    \"deDE\": \"Elgif\",\n";
-                ss << u8"    \"esES\": \"Elgif\",\n";
-                ss << u8"    \"frFR\": \"Elgifu\",\n";
-                ss << u8"    \"itIT\": \"Elgifu\",\n";
-                ss << u8"    \"koKR\": \"엘기푸\",\n";
-                ss << u8"    \"plPL\": \"Elgifu\",\n";
-                ss << u8"    \"esMX\": \"Elgifu\",\n";
-                ss << u8"    \"jaJP\": \"エルギフ\",\n";
-                ss << u8"    \"ptBR\": \"Elguif\",\n";
-                ss << u8"    \"ruRU\": \"Эльгифу\",\n";
-                ss << u8"    \"zhCN\": \"艾尔基弗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10889,\n";
-                ss << u8"    \"Key\": \"MercX155\",\n";
-                ss << u8"    \"enUS\": \"Tostig\",\n";
-                ss << u8"    \"zhTW\": \"托斯提克\",\n";
-                ss << u8"    \"deDE\": \"Aehi\",\n";
-                ss << u8"    \"esES\": \"Aehi\",\n";
-                ss << u8"    \"frFR\": \"Tostig\",\n";
-                ss << u8"    \"itIT\": \"Tostig\",\n";
-                ss << u8"    \"koKR\": \"토스티그\",\n";
-                ss << u8"    \"plPL\": \"Tostig\",\n";
-                ss << u8"    \"esMX\": \"Tostig\",\n";
-                ss << u8"    \"jaJP\": \"トスティグ\",\n";
-                ss << u8"    \"ptBR\": \"Tostig\",\n";
-                ss << u8"    \"ruRU\": \"Тостиг\",\n";
-                ss << u8"    \"zhCN\": \"托斯蒂格\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10890,\n";
-                ss << u8"    \"Key\": \"MercX156\",\n";
-                ss << u8"    \"enUS\": \"Alcuin\",\n";
-                ss << u8"    \"zhTW\": \"艾爾昆\",\n";
-                ss << u8"    \"deDE\": \"JIuni\",\n";
-                ss << u8"    \"esES\": \"Alcun\",\n";
-                ss << u8"    \"frFR\": \"Alcuin\",\n";
-                ss << u8"    \"itIT\": \"Alcuin\",\n";
-                ss << u8"    \"koKR\": \"알쿠인\",\n";
-                ss << u8"    \"plPL\": \"Alcuin\",\n";
-                ss << u8"    \"esMX\": \"Alcuin\",\n";
-                ss << u8"    \"jaJP\": \"アルクイン\",\n";
-                ss << u8"    \"ptBR\": \"Alquin\",\n";
-                ss << u8"    \"ruRU\": \"Алкуин\",\n";
-                ss << u8"    \"zhCN\": \"奥尔奎因\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10891,\n";
-                ss << u8"    \"Key\": \"MercX157\",\n";
-                ss << u8"    \"enUS\": \"Emund\",\n";
-                ss << u8"    \"zhTW\": \"艾蒙特\",\n";
-                ss << u8"    \"deDE\": \"Emund\",\n";
-                ss << u8"    \"esES\": \"Emund\",\n";
-                ss << u8"    \"frFR\": \"Emund\",\n";
-                ss << u8"    \"itIT\": \"Emund\",\n";
-                ss << u8"    \"koKR\": \"에먼드\",\n";
-                ss << u8"    \"plPL\": \"Emund\",\n";
-                ss << u8"    \"esMX\": \"Emund\",\n";
-                ss << u8"    \"jaJP\": \"エムンド\",\n";
-                ss << u8"    \"ptBR\": \"Emund\",\n";
-                ss << u8"    \"ruRU\": \"Эмунд\",\n";
-                ss << u8"    \"zhCN\": \"埃蒙德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10892,\n";
-                ss << u8"    \"Key\": \"MercX158\",\n";
-                ss << u8"    \"enUS\": \"Sigurd\",\n";
-                ss << u8"    \"zhTW\": \"希格爾德\",\n";
-                ss << u8"    \"deDE\": \"Sigud\",\n";
-                ss << u8"    \"esES\": \"Sigud\",\n";
-                ss << u8"    \"frFR\": \"Sigurd\",\n";
-                ss << u8"    \"itIT\": \"Sigurd\",\n";
-                ss << u8"    \"koKR\": \"시구르드\",\n";
-                ss << u8"    \"plPL\": \"Sigurd\",\n";
-                ss << u8"    \"esMX\": \"Sigurd\",\n";
-                ss << u8"    \"jaJP\": \"シグルド\",\n";
-                ss << u8"    \"ptBR\": \"Sigurd\",\n";
-                ss << u8"    \"ruRU\": \"Сигурд\",\n";
-                ss << u8"    \"zhCN\": \"西古德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10893,\n";
-                ss << u8"    \"Key\": \"MercX159\",\n";
-                ss << u8"    \"enUS\": \"Gorm\",\n";
-                ss << u8"    \"zhTW\": \"格姆\",\n";
-                ss << u8"    \"deDE\": \"Gorm\",\n";
-                ss << u8"    \"esES\": \"Gorm\",\n";
-                ss << u8"    \"frFR\": \"Gorm\",\n";
-                ss << u8"    \"itIT\": \"Gorm\",\n";
-                ss << u8"    \"koKR\": \"고름\",\n";
-                ss << u8"    \"plPL\": \"Gorm\",\n";
-                ss << u8"    \"esMX\": \"Gorm\",\n";
-                ss << u8"    \"jaJP\": \"ゴルム\",\n";
-                ss << u8"    \"ptBR\": \"Gorm\",\n";
-                ss << u8"    \"ruRU\": \"Горм\",\n";
-                ss << u8"    \"zhCN\": \"戈姆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10894,\n";
-                ss << u8"    \"Key\": \"MercX160\",\n";
-                ss << u8"    \"enUS\": \"Hollis\",\n";
-                ss << u8"    \"zhTW\": \"荷理斯\",\n";
-                ss << u8"    \"deDE\": \"Holis\",\n";
-                ss << u8"    \"esES\": \"Holis\",\n";
-                ss << u8"    \"frFR\": \"Hollis\",\n";
-                ss << u8"    \"itIT\": \"Hollis\",\n";
-                ss << u8"    \"koKR\": \"홀리스\",\n";
-                ss << u8"    \"plPL\": \"Hollis\",\n";
-                ss << u8"    \"esMX\": \"Hollis\",\n";
-                ss << u8"    \"jaJP\": \"ホリス\",\n";
-                ss << u8"    \"ptBR\": \"Ollis\",\n";
-                ss << u8"    \"ruRU\": \"Холлис\",\n";
-                ss << u8"    \"zhCN\": \"霍利斯\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10895,\n";
-                ss << u8"    \"Key\": \"MercX161\",\n";
-                ss << u8"    \"enUS\": \"Ragnar\",\n";
-                ss << u8"    \"zhTW\": \"拉格那\",\n";
-                ss << u8"    \"deDE\": \"Rinar\",\n";
-                ss << u8"    \"esES\": \"Ranar\",\n";
-                ss << u8"    \"frFR\": \"Ragnar\",\n";
-                ss << u8"    \"itIT\": \"Ragnar\",\n";
-                ss << u8"    \"koKR\": \"라그나르\",\n";
-                ss << u8"    \"plPL\": \"Ragnar\",\n";
-                ss << u8"    \"esMX\": \"Ragnar\",\n";
-                ss << u8"    \"jaJP\": \"ラグナル\",\n";
-                ss << u8"    \"ptBR\": \"Ragnar\",\n";
-                ss << u8"    \"ruRU\": \"Рагнар\",\n";
-                ss << u8"    \"zhCN\": \"拉格纳\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10896,\n";
-                ss << u8"    \"Key\": \"MercX162\",\n";
-                ss << u8"    \"enUS\": \"Torkel\",\n";
-                ss << u8"    \"zhTW\": \"托克爾\",\n";
-                ss << u8"    \"deDE\": \"Tokel\",\n";
-                ss << u8"    \"esES\": \"Tokel\",\n";
-                ss << u8"    \"frFR\": \"Torkel\",\n";
-                ss << u8"    \"itIT\": \"Torkel\",\n";
-                ss << u8"    \"koKR\": \"토르켈\",\n";
-                ss << u8"    \"plPL\": \"Torkel\",\n";
-                ss << u8"    \"esMX\": \"Torkel\",\n";
-                ss << u8"    \"jaJP\": \"トルケル\",\n";
-                ss << u8"    \"ptBR\": \"Torkel\",\n";
-                ss << u8"    \"ruRU\": \"Торкель\",\n";
-                ss << u8"    \"zhCN\": \"托克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10897,\n";
-                ss << u8"    \"Key\": \"MercX163\",\n";
-                ss << u8"    \"enUS\": \"Wulfstan\",\n";
-                ss << u8"    \"zhTW\": \"沃夫斯坦\",\n";
-                ss << u8"    \"deDE\": \"Juan\",\n";
-                ss << u8"    \"esES\": \"Wuan\",\n";
-                ss << u8"    \"frFR\": \"Wulfstan\",\n";
-                ss << u8"    \"itIT\": \"Wulfstan\",\n";
-                ss << u8"    \"koKR\": \"울프스탄\",\n";
-                ss << u8"    \"plPL\": \"Wulfstan\",\n";
-                ss << u8"    \"esMX\": \"Wulfstan\",\n";
-                ss << u8"    \"jaJP\": \"ウルフスタン\",\n";
-                ss << u8"    \"ptBR\": \"Wulfstan\",\n";
-                ss << u8"    \"ruRU\": \"Вульфстан\",\n";
-                ss << u8"    \"zhCN\": \"沃夫斯坦\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10898,\n";
-                ss << u8"    \"Key\": \"MercX164\",\n";
-                ss << u8"    \"enUS\": \"Alban\",\n";
-                ss << u8"    \"zhTW\": \"阿爾班\",\n";
-                ss << u8"    \"deDE\": \"llbin\",\n";
-                ss << u8"    \"esES\": \"Alban\",\n";
-                ss << u8"    \"frFR\": \"Alban\",\n";
-                ss << u8"    \"itIT\": \"Alban\",\n";
-                ss << u8"    \"koKR\": \"알반\",\n";
-                ss << u8"    \"plPL\": \"Alban\",\n";
-                ss << u8"    \"esMX\": \"Alban\",\n";
-                ss << u8"    \"jaJP\": \"アルバン\",\n";
-                ss << u8"    \"ptBR\": \"Alban\",\n";
-                ss << u8"    \"ruRU\": \"Альбан\",\n";
-                ss << u8"    \"zhCN\": \"阿尔班\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10899,\n";
-                ss << u8"    \"Key\": \"MercX165\",\n";
-                ss << u8"    \"enUS\": \"Barloc\",\n";
-                ss << u8"    \"zhTW\": \"巴洛克\",\n";
-                ss << u8"    \"deDE\": \"Jiloc\",\n";
-                ss << u8"    \"esES\": \"Jiloc\",\n";
-                ss << u8"    \"frFR\": \"Barloc\",\n";
-                ss << u8"    \"itIT\": \"Barloc\",\n";
-                ss << u8"    \"koKR\": \"발록\",\n";
-                ss << u8"    \"plPL\": \"Barloc\",\n";
-                ss << u8"    \"esMX\": \"Barloc\",\n";
-                ss << u8"    \"jaJP\": \"バルロック\",\n";
-                ss << u8"    \"ptBR\": \"Barloc\",\n";
-                ss << u8"    \"ruRU\": \"Барлок\",\n";
-                ss << u8"    \"zhCN\": \"巴洛克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10900,\n";
-                ss << u8"    \"Key\": \"MercX166\",\n";
-                ss << u8"    \"enUS\": \"Bill\",\n";
-                ss << u8"    \"zhTW\": \"比爾\",\n";
-                ss << u8"    \"deDE\": \"Pinne\",\n";
-                ss << u8"    \"esES\": \"Pinne\",\n";
-                ss << u8"    \"frFR\": \"Bill\",\n";
-                ss << u8"    \"itIT\": \"Bill\",\n";
-                ss << u8"    \"koKR\": \"빌\",\n";
-                ss << u8"    \"plPL\": \"Bill\",\n";
-                ss << u8"    \"esMX\": \"Bill\",\n";
-                ss << u8"    \"jaJP\": \"ビル\",\n";
-                ss << u8"    \"ptBR\": \"Bill\",\n";
-                ss << u8"    \"ruRU\": \"Билл\",\n";
-                ss << u8"    \"zhCN\": \"比尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10901,\n";
-                ss << u8"    \"Key\": \"MercX167\",\n";
-                ss << u8"    \"enUS\": \"Theodoric\",\n";
-                ss << u8"    \"zhTW\": \"狄奧多理\",\n";
-                ss << u8"    \"deDE\": \"Odric\",\n";
-                ss << u8"    \"esES\": \"Odric\",\n";
-                ss << u8"    \"frFR\": \"Théodoric\",\n";
-                ss << u8"    \"itIT\": \"Theodoric\",\n";
-                ss << u8"    \"koKR\": \"테오도릭\",\n";
-                ss << u8"    \"plPL\": \"Theodoryk\",\n";
-                ss << u8"    \"esMX\": \"Teodoric\",\n";
-                ss << u8"    \"jaJP\": \"セオドリック\",\n";
-                ss << u8"    \"ptBR\": \"Theodoric\",\n";
-                ss << u8"    \"ruRU\": \"Теодорик\",\n";
-                ss << u8"    \"zhCN\": \"瑟多里克\"\n";
-                ss << u8"  }\n";
-                ss << u8"]\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"[\n",
+                u8"  {\n",
+                u8"    \"id\": 1019,\n",
+                u8"    \"Key\": \"merca201\",\n",
+                u8"    \"enUS\": \"Hazade\",\n",
+                u8"    \"zhTW\": \"哈撒迪\",\n",
+                u8"    \"deDE\": \"Hasade\",\n",
+                u8"    \"esES\": \"Hazade\",\n",
+                u8"    \"frFR\": \"Hazade\",\n",
+                u8"    \"itIT\": \"Hazade\",\n",
+                u8"    \"koKR\": \"하자데\",\n",
+                u8"    \"plPL\": \"Hazade\",\n",
+                u8"    \"esMX\": \"Hazade\",\n",
+                u8"    \"jaJP\": \"ハザデ\",\n",
+                u8"    \"ptBR\": \"Razade\",\n",
+                u8"    \"ruRU\": \"Хазад\",\n",
+                u8"    \"zhCN\": \"哈扎德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1020,\n",
+                u8"    \"Key\": \"merca202\",\n",
+                u8"    \"enUS\": \"Alhizeer\",\n",
+                u8"    \"zhTW\": \"艾利希爾\",\n",
+                u8"    \"deDE\": \"Alhiseer\",\n",
+                u8"    \"esES\": \"Alhizeer\",\n",
+                u8"    \"frFR\": \"Alhizir\",\n",
+                u8"    \"itIT\": \"Alhizeer\",\n",
+                u8"    \"koKR\": \"알히지르\",\n",
+                u8"    \"plPL\": \"Alhizeer\",\n",
+                u8"    \"esMX\": \"Alhizeer\",\n",
+                u8"    \"jaJP\": \"アルヒッツァ\",\n",
+                u8"    \"ptBR\": \"Alizer\",\n",
+                u8"    \"ruRU\": \"Альхизир\",\n",
+                u8"    \"zhCN\": \"阿西兹尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1021,\n",
+                u8"    \"Key\": \"merca203\",\n",
+                u8"    \"enUS\": \"Azrael\",\n",
+                u8"    \"zhTW\": \"阿撒爾\",\n",
+                u8"    \"deDE\": \"Asrael\",\n",
+                u8"    \"esES\": \"Azrael\",\n",
+                u8"    \"frFR\": \"Azraël\",\n",
+                u8"    \"itIT\": \"Azrael\",\n",
+                u8"    \"koKR\": \"아즈라엘\",\n",
+                u8"    \"plPL\": \"Azrael\",\n",
+                u8"    \"esMX\": \"Azrael\",\n",
+                u8"    \"jaJP\": \"アズラエル\",\n",
+                u8"    \"ptBR\": \"Azrael\",\n",
+                u8"    \"ruRU\": \"Азраэль\",\n",
+                u8"    \"zhCN\": \"艾兹瑞尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1022,\n",
+                u8"    \"Key\": \"merca204\",\n",
+                u8"    \"enUS\": \"Ahsab\",\n",
+                u8"    \"zhTW\": \"亞斯哈\",\n",
+                u8"    \"deDE\": \"Ahsab\",\n",
+                u8"    \"esES\": \"Ahsab\",\n",
+                u8"    \"frFR\": \"Ahsab\",\n",
+                u8"    \"itIT\": \"Ahsab\",\n",
+                u8"    \"koKR\": \"아흐사브\",\n",
+                u8"    \"plPL\": \"Ahsab\",\n",
+                u8"    \"esMX\": \"Ahsab\",\n",
+                u8"    \"jaJP\": \"アーサブ\",\n",
+                u8"    \"ptBR\": \"Asab\",\n",
+                u8"    \"ruRU\": \"Ахсаб\",\n",
+                u8"    \"zhCN\": \"阿萨布\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1023,\n",
+                u8"    \"Key\": \"merca205\",\n",
+                u8"    \"enUS\": \"Chalan\",\n",
+                u8"    \"zhTW\": \"克哈蘭\",\n",
+                u8"    \"deDE\": \"Chalan\",\n",
+                u8"    \"esES\": \"Chalán\",\n",
+                u8"    \"frFR\": \"Chalan\",\n",
+                u8"    \"itIT\": \"Chalan\",\n",
+                u8"    \"koKR\": \"찰란\",\n",
+                u8"    \"plPL\": \"Chalan\",\n",
+                u8"    \"esMX\": \"Chalan\",\n",
+                u8"    \"jaJP\": \"チャラン\",\n",
+                u8"    \"ptBR\": \"Chalan\",\n",
+                u8"    \"ruRU\": \"Чалан\",\n",
+                u8"    \"zhCN\": \"卡兰\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1024,\n",
+                u8"    \"Key\": \"merca206\",\n",
+                u8"    \"enUS\": \"Haseen\",\n",
+                u8"    \"zhTW\": \"哈辛\",\n",
+                u8"    \"deDE\": \"Hasien\",\n",
+                u8"    \"esES\": \"Haseen\",\n",
+                u8"    \"frFR\": \"Hasin\",\n",
+                u8"    \"itIT\": \"Haseen\",\n",
+                u8"    \"koKR\": \"하신\",\n",
+                u8"    \"plPL\": \"Haseen\",\n",
+                u8"    \"esMX\": \"Haseen\",\n",
+                u8"    \"jaJP\": \"ハシーン\",\n",
+                u8"    \"ptBR\": \"Hassin\",\n",
+                u8"    \"ruRU\": \"Хазин\",\n",
+                u8"    \"zhCN\": \"哈辛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1025,\n",
+                u8"    \"Key\": \"merca207\",\n",
+                u8"    \"enUS\": \"Razan\",\n",
+                u8"    \"zhTW\": \"羅森\",\n",
+                u8"    \"deDE\": \"Rasan\",\n",
+                u8"    \"esES\": \"Razán\",\n",
+                u8"    \"frFR\": \"Razan\",\n",
+                u8"    \"itIT\": \"Razan\",\n",
+                u8"    \"koKR\": \"라잔\",\n",
+                u8"    \"plPL\": \"Razan\",\n",
+                u8"    \"esMX\": \"Razan\",\n",
+                u8"    \"jaJP\": \"ラザン\",\n",
+                u8"    \"ptBR\": \"Razan\",\n",
+                u8"    \"ruRU\": \"Разан\",\n",
+                u8"    \"zhCN\": \"拉赞\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1026,\n",
+                u8"    \"Key\": \"merca208\",\n",
+                u8"    \"enUS\": \"Emilio\",\n",
+                u8"    \"zhTW\": \"艾米羅\",\n",
+                u8"    \"deDE\": \"Emilio\",\n",
+                u8"    \"esES\": \"Emilio\",\n",
+                u8"    \"frFR\": \"Emilio\",\n",
+                u8"    \"itIT\": \"Emilio\",\n",
+                u8"    \"koKR\": \"에밀리오\",\n",
+                u8"    \"plPL\": \"Emilio\",\n",
+                u8"    \"esMX\": \"Emilio\",\n",
+                u8"    \"jaJP\": \"エミリオ\",\n",
+                u8"    \"ptBR\": \"Emílio\",\n",
+                u8"    \"ruRU\": \"Эмилио\",\n",
+                u8"    \"zhCN\": \"艾米罗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1027,\n",
+                u8"    \"Key\": \"merca209\",\n",
+                u8"    \"enUS\": \"Pratham\",\n",
+                u8"    \"zhTW\": \"培撒姆\",\n",
+                u8"    \"deDE\": \"Pratham\",\n",
+                u8"    \"esES\": \"Pratham\",\n",
+                u8"    \"frFR\": \"Pratham\",\n",
+                u8"    \"itIT\": \"Pratham\",\n",
+                u8"    \"koKR\": \"프라탐\",\n",
+                u8"    \"plPL\": \"Pratham\",\n",
+                u8"    \"esMX\": \"Pratham\",\n",
+                u8"    \"jaJP\": \"プラサム\",\n",
+                u8"    \"ptBR\": \"Pratam\",\n",
+                u8"    \"ruRU\": \"Пратам\",\n",
+                u8"    \"zhCN\": \"普拉桑\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1028,\n",
+                u8"    \"Key\": \"merca210\",\n",
+                u8"    \"enUS\": \"Fazel\",\n",
+                u8"    \"zhTW\": \"費索\",\n",
+                u8"    \"deDE\": \"Fassel\",\n",
+                u8"    \"esES\": \"Fazel\",\n",
+                u8"    \"frFR\": \"Fazel\",\n",
+                u8"    \"itIT\": \"Fazel\",\n",
+                u8"    \"koKR\": \"파젤\",\n",
+                u8"    \"plPL\": \"Fazel\",\n",
+                u8"    \"esMX\": \"Fazel\",\n",
+                u8"    \"jaJP\": \"フェイゼル\",\n",
+                u8"    \"ptBR\": \"Fazel\",\n",
+                u8"    \"ruRU\": \"Фазиль\",\n",
+                u8"    \"zhCN\": \"菲泽尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1029,\n",
+                u8"    \"Key\": \"merca211\",\n",
+                u8"    \"enUS\": \"Jemali\",\n",
+                u8"    \"zhTW\": \"傑馬利\",\n",
+                u8"    \"deDE\": \"Jemali\",\n",
+                u8"    \"esES\": \"Jemali\",\n",
+                u8"    \"frFR\": \"Jemali\",\n",
+                u8"    \"itIT\": \"Jemali\",\n",
+                u8"    \"koKR\": \"제말리\",\n",
+                u8"    \"plPL\": \"Jemali\",\n",
+                u8"    \"esMX\": \"Jemali\",\n",
+                u8"    \"jaJP\": \"ジェマリ\",\n",
+                u8"    \"ptBR\": \"Jemali\",\n",
+                u8"    \"ruRU\": \"Джемали\",\n",
+                u8"    \"zhCN\": \"杰马里\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1030,\n",
+                u8"    \"Key\": \"merca212\",\n",
+                u8"    \"enUS\": \"Kasim\",\n",
+                u8"    \"zhTW\": \"卡辛姆\",\n",
+                u8"    \"deDE\": \"Kasim\",\n",
+                u8"    \"esES\": \"Kasim\",\n",
+                u8"    \"frFR\": \"Kasim\",\n",
+                u8"    \"itIT\": \"Kasim\",\n",
+                u8"    \"koKR\": \"카심\",\n",
+                u8"    \"plPL\": \"Kasim\",\n",
+                u8"    \"esMX\": \"Kasim\",\n",
+                u8"    \"jaJP\": \"カシム\",\n",
+                u8"    \"ptBR\": \"Kasim\",\n",
+                u8"    \"ruRU\": \"Касим\",\n",
+                u8"    \"zhCN\": \"卡辛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1031,\n",
+                u8"    \"Key\": \"merca213\",\n",
+                u8"    \"enUS\": \"Gulzar\",\n",
+                u8"    \"zhTW\": \"古爾薩\",\n",
+                u8"    \"deDE\": \"Gulsar\",\n",
+                u8"    \"esES\": \"Gulzar\",\n",
+                u8"    \"frFR\": \"Gulzar\",\n",
+                u8"    \"itIT\": \"Gulzar\",\n",
+                u8"    \"koKR\": \"굴자르\",\n",
+                u8"    \"plPL\": \"Gulzar\",\n",
+                u8"    \"esMX\": \"Gulzar\",\n",
+                u8"    \"jaJP\": \"ガルザル\",\n",
+                u8"    \"ptBR\": \"Gulzar\",\n",
+                u8"    \"ruRU\": \"Гюльзар\",\n",
+                u8"    \"zhCN\": \"古札\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1032,\n",
+                u8"    \"Key\": \"merca214\",\n",
+                u8"    \"enUS\": \"Mizan\",\n",
+                u8"    \"zhTW\": \"米山\",\n",
+                u8"    \"deDE\": \"Misan\",\n",
+                u8"    \"esES\": \"Mizán\",\n",
+                u8"    \"frFR\": \"Mizan\",\n",
+                u8"    \"itIT\": \"Mizan\",\n",
+                u8"    \"koKR\": \"미잔\",\n",
+                u8"    \"plPL\": \"Mizan\",\n",
+                u8"    \"esMX\": \"Mizan\",\n",
+                u8"    \"jaJP\": \"ミザン\",\n",
+                u8"    \"ptBR\": \"Mizan\",\n",
+                u8"    \"ruRU\": \"Мизан\",\n",
+                u8"    \"zhCN\": \"米山\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1033,\n",
+                u8"    \"Key\": \"merca215\",\n",
+                u8"    \"enUS\": \"Leharas\",\n",
+                u8"    \"zhTW\": \"雷哈拉\",\n",
+                u8"    \"deDE\": \"Leharas\",\n",
+                u8"    \"esES\": \"Leharas\",\n",
+                u8"    \"frFR\": \"Leharas\",\n",
+                u8"    \"itIT\": \"Leharas\",\n",
+                u8"    \"koKR\": \"레하라스\",\n",
+                u8"    \"plPL\": \"Leharas\",\n",
+                u8"    \"esMX\": \"Leharas\",\n",
+                u8"    \"jaJP\": \"レハラス\",\n",
+                u8"    \"ptBR\": \"Learas\",\n",
+                u8"    \"ruRU\": \"Лехарас\",\n",
+                u8"    \"zhCN\": \"勒哈纳斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1034,\n",
+                u8"    \"Key\": \"merca216\",\n",
+                u8"    \"enUS\": \"Durga\",\n",
+                u8"    \"zhTW\": \"杜爾加\",\n",
+                u8"    \"deDE\": \"Durga\",\n",
+                u8"    \"esES\": \"Durga\",\n",
+                u8"    \"frFR\": \"Durga\",\n",
+                u8"    \"itIT\": \"Durga\",\n",
+                u8"    \"koKR\": \"두르가\",\n",
+                u8"    \"plPL\": \"Durga\",\n",
+                u8"    \"esMX\": \"Durga\",\n",
+                u8"    \"jaJP\": \"ダルガ\",\n",
+                u8"    \"ptBR\": \"Durga\",\n",
+                u8"    \"ruRU\": \"Дурга\",\n",
+                u8"    \"zhCN\": \"杜尔加\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1035,\n",
+                u8"    \"Key\": \"merca217\",\n",
+                u8"    \"enUS\": \"Neeraj\",\n",
+                u8"    \"zhTW\": \"尼爾亞\",\n",
+                u8"    \"deDE\": \"Neeraj\",\n",
+                u8"    \"esES\": \"Neeraj\",\n",
+                u8"    \"frFR\": \"Niraj\",\n",
+                u8"    \"itIT\": \"Neeraj\",\n",
+                u8"    \"koKR\": \"니라즈\",\n",
+                u8"    \"plPL\": \"Neeraj\",\n",
+                u8"    \"esMX\": \"Neeraj\",\n",
+                u8"    \"jaJP\": \"ニーラジュ\",\n",
+                u8"    \"ptBR\": \"Niraj\",\n",
+                u8"    \"ruRU\": \"Нирадж\",\n",
+                u8"    \"zhCN\": \"妮拉吉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1036,\n",
+                u8"    \"Key\": \"merca218\",\n",
+                u8"    \"enUS\": \"Ilzan\",\n",
+                u8"    \"zhTW\": \"伊爾森\",\n",
+                u8"    \"deDE\": \"Ilsan\",\n",
+                u8"    \"esES\": \"Ilzán\",\n",
+                u8"    \"frFR\": \"Ilzan\",\n",
+                u8"    \"itIT\": \"Ilzan\",\n",
+                u8"    \"koKR\": \"준영\",\n",
+                u8"    \"plPL\": \"Ilzan\",\n",
+                u8"    \"esMX\": \"Ilzan\",\n",
+                u8"    \"jaJP\": \"イルザン\",\n",
+                u8"    \"ptBR\": \"Ilzan\",\n",
+                u8"    \"ruRU\": \"Ильзан\",\n",
+                u8"    \"zhCN\": \"伊尔赞\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1037,\n",
+                u8"    \"Key\": \"merca219\",\n",
+                u8"    \"enUS\": \"Zanarhi\",\n",
+                u8"    \"zhTW\": \"撒那利\",\n",
+                u8"    \"deDE\": \"Zanarhi\",\n",
+                u8"    \"esES\": \"Zanarhi\",\n",
+                u8"    \"frFR\": \"Zanarhi\",\n",
+                u8"    \"itIT\": \"Zanarhi\",\n",
+                u8"    \"koKR\": \"자나르히\",\n",
+                u8"    \"plPL\": \"Zanarhi\",\n",
+                u8"    \"esMX\": \"Zanarhi\",\n",
+                u8"    \"jaJP\": \"ザナルヒ\",\n",
+                u8"    \"ptBR\": \"Zanari\",\n",
+                u8"    \"ruRU\": \"Занари\",\n",
+                u8"    \"zhCN\": \"扎纳尔西\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1038,\n",
+                u8"    \"Key\": \"merca220\",\n",
+                u8"    \"enUS\": \"Waheed\",\n",
+                u8"    \"zhTW\": \"瓦黑德\",\n",
+                u8"    \"deDE\": \"Wahid\",\n",
+                u8"    \"esES\": \"Waheed\",\n",
+                u8"    \"frFR\": \"Wahid\",\n",
+                u8"    \"itIT\": \"Waheed\",\n",
+                u8"    \"koKR\": \"와히드\",\n",
+                u8"    \"plPL\": \"Waheed\",\n",
+                u8"    \"esMX\": \"Waheed\",\n",
+                u8"    \"jaJP\": \"ワヒード\",\n",
+                u8"    \"ptBR\": \"Warrid\",\n",
+                u8"    \"ruRU\": \"Вахид\",\n",
+                u8"    \"zhCN\": \"瓦希德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1039,\n",
+                u8"    \"Key\": \"merca221\",\n",
+                u8"    \"enUS\": \"Vikhyat\",\n",
+                u8"    \"zhTW\": \"維克懷特\",\n",
+                u8"    \"deDE\": \"Vichiat\",\n",
+                u8"    \"esES\": \"Vikhyat\",\n",
+                u8"    \"frFR\": \"Vikhyat\",\n",
+                u8"    \"itIT\": \"Vikhyat\",\n",
+                u8"    \"koKR\": \"비크햐트\",\n",
+                u8"    \"plPL\": \"Vikhyat\",\n",
+                u8"    \"esMX\": \"Vikhyat\",\n",
+                u8"    \"jaJP\": \"ヴィクヒャト\",\n",
+                u8"    \"ptBR\": \"Vikiat\",\n",
+                u8"    \"ruRU\": \"Вихьят\",\n",
+                u8"    \"zhCN\": \"维希亚特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1040,\n",
+                u8"    \"Key\": \"merca222\",\n",
+                u8"    \"enUS\": \"Jelani\",\n",
+                u8"    \"zhTW\": \"賈拉尼\",\n",
+                u8"    \"deDE\": \"Jelani\",\n",
+                u8"    \"esES\": \"Jelani\",\n",
+                u8"    \"frFR\": \"Jelani\",\n",
+                u8"    \"itIT\": \"Jelani\",\n",
+                u8"    \"koKR\": \"젤라니\",\n",
+                u8"    \"plPL\": \"Jelani\",\n",
+                u8"    \"esMX\": \"Jelani\",\n",
+                u8"    \"jaJP\": \"ジェラーニ\",\n",
+                u8"    \"ptBR\": \"Jelani\",\n",
+                u8"    \"ruRU\": \"Джелани\",\n",
+                u8"    \"zhCN\": \"杰拉尼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1041,\n",
+                u8"    \"Key\": \"merca223\",\n",
+                u8"    \"enUS\": \"Barani\",\n",
+                u8"    \"zhTW\": \"巴拉尼\",\n",
+                u8"    \"deDE\": \"Barani\",\n",
+                u8"    \"esES\": \"Barani\",\n",
+                u8"    \"frFR\": \"Barani\",\n",
+                u8"    \"itIT\": \"Barani\",\n",
+                u8"    \"koKR\": \"석철\",\n",
+                u8"    \"plPL\": \"Barani\",\n",
+                u8"    \"esMX\": \"Barani\",\n",
+                u8"    \"jaJP\": \"バラーニ\",\n",
+                u8"    \"ptBR\": \"Barani\",\n",
+                u8"    \"ruRU\": \"Барани\",\n",
+                u8"    \"zhCN\": \"巴纳尼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1042,\n",
+                u8"    \"Key\": \"merca224\",\n",
+                u8"    \"enUS\": \"Jabari\",\n",
+                u8"    \"zhTW\": \"賈巴利\",\n",
+                u8"    \"deDE\": \"Jabari\",\n",
+                u8"    \"esES\": \"Jabari\",\n",
+                u8"    \"frFR\": \"Jabari\",\n",
+                u8"    \"itIT\": \"Jabari\",\n",
+                u8"    \"koKR\": \"성호\",\n",
+                u8"    \"plPL\": \"Jabari\",\n",
+                u8"    \"esMX\": \"Jabari\",\n",
+                u8"    \"jaJP\": \"ジャバリ\",\n",
+                u8"    \"ptBR\": \"Jabari\",\n",
+                u8"    \"ruRU\": \"Джабари\",\n",
+                u8"    \"zhCN\": \"贾巴里\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1043,\n",
+                u8"    \"Key\": \"merca225\",\n",
+                u8"    \"enUS\": \"Devak\",\n",
+                u8"    \"zhTW\": \"迪法\",\n",
+                u8"    \"deDE\": \"Devak\",\n",
+                u8"    \"esES\": \"Devak\",\n",
+                u8"    \"frFR\": \"Devak\",\n",
+                u8"    \"itIT\": \"Devak\",\n",
+                u8"    \"koKR\": \"데바크\",\n",
+                u8"    \"plPL\": \"Devak\",\n",
+                u8"    \"esMX\": \"Devak\",\n",
+                u8"    \"jaJP\": \"デヴァク\",\n",
+                u8"    \"ptBR\": \"Devak\",\n",
+                u8"    \"ruRU\": \"Девак\",\n",
+                u8"    \"zhCN\": \"德瓦克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1044,\n",
+                u8"    \"Key\": \"merca226\",\n",
+                u8"    \"enUS\": \"Raldin\",\n",
+                u8"    \"zhTW\": \"拉爾丁\",\n",
+                u8"    \"deDE\": \"Raldin\",\n",
+                u8"    \"esES\": \"Raldín\",\n",
+                u8"    \"frFR\": \"Raldin\",\n",
+                u8"    \"itIT\": \"Raldin\",\n",
+                u8"    \"koKR\": \"랄딘\",\n",
+                u8"    \"plPL\": \"Raldin\",\n",
+                u8"    \"esMX\": \"Raldin\",\n",
+                u8"    \"jaJP\": \"ラルディン\",\n",
+                u8"    \"ptBR\": \"Raldin\",\n",
+                u8"    \"ruRU\": \"Ралдин\",\n",
+                u8"    \"zhCN\": \"拉尔丁\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1045,\n",
+                u8"    \"Key\": \"merca227\",\n",
+                u8"    \"enUS\": \"Telash\",\n",
+                u8"    \"zhTW\": \"鐵拉西\",\n",
+                u8"    \"deDE\": \"Telasch\",\n",
+                u8"    \"esES\": \"Telash\",\n",
+                u8"    \"frFR\": \"Telash\",\n",
+                u8"    \"itIT\": \"Telash\",\n",
+                u8"    \"koKR\": \"텔라시\",\n",
+                u8"    \"plPL\": \"Telash\",\n",
+                u8"    \"esMX\": \"Telash\",\n",
+                u8"    \"jaJP\": \"テラッシュ\",\n",
+                u8"    \"ptBR\": \"Telash\",\n",
+                u8"    \"ruRU\": \"Телаш\",\n",
+                u8"    \"zhCN\": \"特拉斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1046,\n",
+                u8"    \"Key\": \"merca228\",\n",
+                u8"    \"enUS\": \"Ajheed\",\n",
+                u8"    \"zhTW\": \"艾傑希德\",\n",
+                u8"    \"deDE\": \"Ajheed\",\n",
+                u8"    \"esES\": \"Ajheed\",\n",
+                u8"    \"frFR\": \"Ajhid\",\n",
+                u8"    \"itIT\": \"Ajheed\",\n",
+                u8"    \"koKR\": \"아지드\",\n",
+                u8"    \"plPL\": \"Ajheed\",\n",
+                u8"    \"esMX\": \"Ajheed\",\n",
+                u8"    \"jaJP\": \"アジュヒード\",\n",
+                u8"    \"ptBR\": \"Ajid\",\n",
+                u8"    \"ruRU\": \"Аджид\",\n",
+                u8"    \"zhCN\": \"阿吉希德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1047,\n",
+                u8"    \"Key\": \"merca229\",\n",
+                u8"    \"enUS\": \"Narphet\",\n",
+                u8"    \"zhTW\": \"拿費特\",\n",
+                u8"    \"deDE\": \"Narphet\",\n",
+                u8"    \"esES\": \"Narphet\",\n",
+                u8"    \"frFR\": \"Narphet\",\n",
+                u8"    \"itIT\": \"Narphet\",\n",
+                u8"    \"koKR\": \"나르페트\",\n",
+                u8"    \"plPL\": \"Narphet\",\n",
+                u8"    \"esMX\": \"Narphet\",\n",
+                u8"    \"jaJP\": \"ナルフェット\",\n",
+                u8"    \"ptBR\": \"Narfet\",\n",
+                u8"    \"ruRU\": \"Нарфет\",\n",
+                u8"    \"zhCN\": \"纳菲特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1048,\n",
+                u8"    \"Key\": \"merca230\",\n",
+                u8"    \"enUS\": \"Khaleel\",\n",
+                u8"    \"zhTW\": \"凱立爾\",\n",
+                u8"    \"deDE\": \"Khalil\",\n",
+                u8"    \"esES\": \"Khaleel\",\n",
+                u8"    \"frFR\": \"Khalil\",\n",
+                u8"    \"itIT\": \"Khaleel\",\n",
+                u8"    \"koKR\": \"칼릴\",\n",
+                u8"    \"plPL\": \"Khaleel\",\n",
+                u8"    \"esMX\": \"Khalil\",\n",
+                u8"    \"jaJP\": \"カリール\",\n",
+                u8"    \"ptBR\": \"Khalil\",\n",
+                u8"    \"ruRU\": \"Халил\",\n",
+                u8"    \"zhCN\": \"卡里尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1049,\n",
+                u8"    \"Key\": \"merca231\",\n",
+                u8"    \"enUS\": \"Phaet\",\n",
+                u8"    \"zhTW\": \"費特\",\n",
+                u8"    \"deDE\": \"Phaet\",\n",
+                u8"    \"esES\": \"Phaet\",\n",
+                u8"    \"frFR\": \"Phaet\",\n",
+                u8"    \"itIT\": \"Phaet\",\n",
+                u8"    \"koKR\": \"파에트\",\n",
+                u8"    \"plPL\": \"Phaet\",\n",
+                u8"    \"esMX\": \"Phaet\",\n",
+                u8"    \"jaJP\": \"フィート\",\n",
+                u8"    \"ptBR\": \"Fet\",\n",
+                u8"    \"ruRU\": \"Фаэт\",\n",
+                u8"    \"zhCN\": \"菲伊特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1050,\n",
+                u8"    \"Key\": \"merca232\",\n",
+                u8"    \"enUS\": \"Geshef\",\n",
+                u8"    \"zhTW\": \"杰希夫\",\n",
+                u8"    \"deDE\": \"Geschef\",\n",
+                u8"    \"esES\": \"Geshef\",\n",
+                u8"    \"frFR\": \"Geshef\",\n",
+                u8"    \"itIT\": \"Geshef\",\n",
+                u8"    \"koKR\": \"게셰프\",\n",
+                u8"    \"plPL\": \"Geshef\",\n",
+                u8"    \"esMX\": \"Geshef\",\n",
+                u8"    \"jaJP\": \"ゲシェフ\",\n",
+                u8"    \"ptBR\": \"Geshef\",\n",
+                u8"    \"ruRU\": \"Гешеф\",\n",
+                u8"    \"zhCN\": \"基舍夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1051,\n",
+                u8"    \"Key\": \"merca233\",\n",
+                u8"    \"enUS\": \"Vanji\",\n",
+                u8"    \"zhTW\": \"凡吉\",\n",
+                u8"    \"deDE\": \"Vanji\",\n",
+                u8"    \"esES\": \"Vanji\",\n",
+                u8"    \"frFR\": \"Vanji\",\n",
+                u8"    \"itIT\": \"Vanji\",\n",
+                u8"    \"koKR\": \"밴지\",\n",
+                u8"    \"plPL\": \"Vanji\",\n",
+                u8"    \"esMX\": \"Vanji\",\n",
+                u8"    \"jaJP\": \"ヴァンジ\",\n",
+                u8"    \"ptBR\": \"Vanji\",\n",
+                u8"    \"ruRU\": \"Ванджи\",\n",
+                u8"    \"zhCN\": \"万基\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1052,\n",
+                u8"    \"Key\": \"merca234\",\n",
+                u8"    \"enUS\": \"Haphet\",\n",
+                u8"    \"zhTW\": \"海費特\",\n",
+                u8"    \"deDE\": \"Haphet\",\n",
+                u8"    \"esES\": \"Haphet\",\n",
+                u8"    \"frFR\": \"Haphet\",\n",
+                u8"    \"itIT\": \"Haphet\",\n",
+                u8"    \"koKR\": \"하페트\",\n",
+                u8"    \"plPL\": \"Haphet\",\n",
+                u8"    \"esMX\": \"Haphet\",\n",
+                u8"    \"jaJP\": \"ハフェット\",\n",
+                u8"    \"ptBR\": \"Hafet\",\n",
+                u8"    \"ruRU\": \"Хафет\",\n",
+                u8"    \"zhCN\": \"哈菲特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1053,\n",
+                u8"    \"Key\": \"merca235\",\n",
+                u8"    \"enUS\": \"Thadar\",\n",
+                u8"    \"zhTW\": \"撒達\",\n",
+                u8"    \"deDE\": \"Thadar\",\n",
+                u8"    \"esES\": \"Thadar\",\n",
+                u8"    \"frFR\": \"Thadar\",\n",
+                u8"    \"itIT\": \"Thadar\",\n",
+                u8"    \"koKR\": \"타다르\",\n",
+                u8"    \"plPL\": \"Thadar\",\n",
+                u8"    \"esMX\": \"Tadar\",\n",
+                u8"    \"jaJP\": \"サダル\",\n",
+                u8"    \"ptBR\": \"Tadar\",\n",
+                u8"    \"ruRU\": \"Тадар\",\n",
+                u8"    \"zhCN\": \"萨达尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1054,\n",
+                u8"    \"Key\": \"merca236\",\n",
+                u8"    \"enUS\": \"Yatiraj\",\n",
+                u8"    \"zhTW\": \"亞提賈\",\n",
+                u8"    \"deDE\": \"Yatiraj\",\n",
+                u8"    \"esES\": \"Yatiraj\",\n",
+                u8"    \"frFR\": \"Yatiraj\",\n",
+                u8"    \"itIT\": \"Yatiraj\",\n",
+                u8"    \"koKR\": \"야티라즈\",\n",
+                u8"    \"plPL\": \"Yatiraj\",\n",
+                u8"    \"esMX\": \"Yatiraj\",\n",
+                u8"    \"jaJP\": \"ヤティラジュ\",\n",
+                u8"    \"ptBR\": \"Yatiraj\",\n",
+                u8"    \"ruRU\": \"Ятираж\",\n",
+                u8"    \"zhCN\": \"亚提拉吉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1055,\n",
+                u8"    \"Key\": \"merca237\",\n",
+                u8"    \"enUS\": \"Rhadge\",\n",
+                u8"    \"zhTW\": \"拉黑德\",\n",
+                u8"    \"deDE\": \"Rhadge\",\n",
+                u8"    \"esES\": \"Rhadge\",\n",
+                u8"    \"frFR\": \"Rhadge\",\n",
+                u8"    \"itIT\": \"Rhadge\",\n",
+                u8"    \"koKR\": \"라드게\",\n",
+                u8"    \"plPL\": \"Rhadge\",\n",
+                u8"    \"esMX\": \"Rhadge\",\n",
+                u8"    \"jaJP\": \"ラッジ\",\n",
+                u8"    \"ptBR\": \"Rade\",\n",
+                u8"    \"ruRU\": \"Радге\",\n",
+                u8"    \"zhCN\": \"拉德吉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1056,\n",
+                u8"    \"Key\": \"merca238\",\n",
+                u8"    \"enUS\": \"Yashied\",\n",
+                u8"    \"zhTW\": \"亞席德\",\n",
+                u8"    \"deDE\": \"Yaschid\",\n",
+                u8"    \"esES\": \"Yashied\",\n",
+                u8"    \"frFR\": \"Yashied\",\n",
+                u8"    \"itIT\": \"Yashied\",\n",
+                u8"    \"koKR\": \"야시에드\",\n",
+                u8"    \"plPL\": \"Yashied\",\n",
+                u8"    \"esMX\": \"Yashied\",\n",
+                u8"    \"jaJP\": \"ヤシード\",\n",
+                u8"    \"ptBR\": \"Yashid\",\n",
+                u8"    \"ruRU\": \"Яшид\",\n",
+                u8"    \"zhCN\": \"亚希艾德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1057,\n",
+                u8"    \"Key\": \"merca239\",\n",
+                u8"    \"enUS\": \"Jarulf\",\n",
+                u8"    \"zhTW\": \"賈魯夫\",\n",
+                u8"    \"deDE\": \"Jarulf\",\n",
+                u8"    \"esES\": \"Jarulf\",\n",
+                u8"    \"frFR\": \"Jarulf\",\n",
+                u8"    \"itIT\": \"Jarulf\",\n",
+                u8"    \"koKR\": \"자룰프\",\n",
+                u8"    \"plPL\": \"Jarulf\",\n",
+                u8"    \"esMX\": \"Jarulf\",\n",
+                u8"    \"jaJP\": \"ジャラルフ\",\n",
+                u8"    \"ptBR\": \"Jarulf\",\n",
+                u8"    \"ruRU\": \"Ярульф\",\n",
+                u8"    \"zhCN\": \"亚鲁夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1058,\n",
+                u8"    \"Key\": \"merca240\",\n",
+                u8"    \"enUS\": \"Flux\",\n",
+                u8"    \"zhTW\": \"弗勒克斯\",\n",
+                u8"    \"deDE\": \"Flux\",\n",
+                u8"    \"esES\": \"Flujo\",\n",
+                u8"    \"frFR\": \"Flux\",\n",
+                u8"    \"itIT\": \"Flux\",\n",
+                u8"    \"koKR\": \"플럭스\",\n",
+                u8"    \"plPL\": \"Flux\",\n",
+                u8"    \"esMX\": \"Flux\",\n",
+                u8"    \"jaJP\": \"フラックス\",\n",
+                u8"    \"ptBR\": \"Flux\",\n",
+                u8"    \"ruRU\": \"Флакс\",\n",
+                u8"    \"zhCN\": \"弗拉克斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1059,\n",
+                u8"    \"Key\": \"merca241\",\n",
+                u8"    \"enUS\": \"Scorch\",\n",
+                u8"    \"zhTW\": \"斯高屈\",\n",
+                u8"    \"deDE\": \"Scorch\",\n",
+                u8"    \"esES\": \"Quemar\",\n",
+                u8"    \"frFR\": \"Cram\",\n",
+                u8"    \"itIT\": \"Scorch\",\n",
+                u8"    \"koKR\": \"스코치\",\n",
+                u8"    \"plPL\": \"Scorch\",\n",
+                u8"    \"esMX\": \"Calcinar\",\n",
+                u8"    \"jaJP\": \"スコルチ\",\n",
+                u8"    \"ptBR\": \"Scorch\",\n",
+                u8"    \"ruRU\": \"Скорч\",\n",
+                u8"    \"zhCN\": \"斯科奇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3411,\n",
+                u8"    \"Key\": \"merc01\",\n",
+                u8"    \"enUS\": \"Aliza\",\n",
+                u8"    \"zhTW\": \"艾莉薩\",\n",
+                u8"    \"deDE\": \"Alisa\",\n",
+                u8"    \"esES\": \"Aliza\",\n",
+                u8"    \"frFR\": \"Aliza\",\n",
+                u8"    \"itIT\": \"Aliza\",\n",
+                u8"    \"koKR\": \"알리자\",\n",
+                u8"    \"plPL\": \"Aliza\",\n",
+                u8"    \"esMX\": \"Aliza\",\n",
+                u8"    \"jaJP\": \"アリザ\",\n",
+                u8"    \"ptBR\": \"Aliza\",\n",
+                u8"    \"ruRU\": \"Ализа\",\n",
+                u8"    \"zhCN\": \"阿丽萨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3412,\n",
+                u8"    \"Key\": \"merc02\",\n",
+                u8"    \"enUS\": \"Amplisa\",\n",
+                u8"    \"zhTW\": \"安普利莎\",\n",
+                u8"    \"deDE\": \"Amplisa\",\n",
+                u8"    \"esES\": \"Amplisa\",\n",
+                u8"    \"frFR\": \"Amplisa\",\n",
+                u8"    \"itIT\": \"Amplisa\",\n",
+                u8"    \"koKR\": \"암플리사\",\n",
+                u8"    \"plPL\": \"Amplisa\",\n",
+                u8"    \"esMX\": \"Amplisa\",\n",
+                u8"    \"jaJP\": \"アンプリーサ\",\n",
+                u8"    \"ptBR\": \"Amplisa\",\n",
+                u8"    \"ruRU\": \"Амплиса\",\n",
+                u8"    \"zhCN\": \"安普丽萨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3413,\n",
+                u8"    \"Key\": \"merc03\",\n",
+                u8"    \"enUS\": \"Annor\",\n",
+                u8"    \"zhTW\": \"安諾\",\n",
+                u8"    \"deDE\": \"Annor\",\n",
+                u8"    \"esES\": \"Annor\",\n",
+                u8"    \"frFR\": \"Annor\",\n",
+                u8"    \"itIT\": \"Annor\",\n",
+                u8"    \"koKR\": \"안노르\",\n",
+                u8"    \"plPL\": \"Annor\",\n",
+                u8"    \"esMX\": \"Annor\",\n",
+                u8"    \"jaJP\": \"アノール\",\n",
+                u8"    \"ptBR\": \"Annor\",\n",
+                u8"    \"ruRU\": \"Аннор\",\n",
+                u8"    \"zhCN\": \"安诺儿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3414,\n",
+                u8"    \"Key\": \"merc04\",\n",
+                u8"    \"enUS\": \"Abhaya\",\n",
+                u8"    \"zhTW\": \"艾伯海雅\",\n",
+                u8"    \"deDE\": \"Abhaya\",\n",
+                u8"    \"esES\": \"Abhaya\",\n",
+                u8"    \"frFR\": \"Abhaya\",\n",
+                u8"    \"itIT\": \"Abhaya\",\n",
+                u8"    \"koKR\": \"아브하야\",\n",
+                u8"    \"plPL\": \"Abhaya\",\n",
+                u8"    \"esMX\": \"Abhaya\",\n",
+                u8"    \"jaJP\": \"アブハヤ\",\n",
+                u8"    \"ptBR\": \"Abaia\",\n",
+                u8"    \"ruRU\": \"Абайя\",\n",
+                u8"    \"zhCN\": \"阿巴雅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3415,\n",
+                u8"    \"Key\": \"merc05\",\n",
+                u8"    \"enUS\": \"Elly\",\n",
+                u8"    \"zhTW\": \"艾莉\",\n",
+                u8"    \"deDE\": \"Elly\",\n",
+                u8"    \"esES\": \"Elly\",\n",
+                u8"    \"frFR\": \"Elly\",\n",
+                u8"    \"itIT\": \"Elly\",\n",
+                u8"    \"koKR\": \"엘리\",\n",
+                u8"    \"plPL\": \"Elly\",\n",
+                u8"    \"esMX\": \"Elly\",\n",
+                u8"    \"jaJP\": \"エリー\",\n",
+                u8"    \"ptBR\": \"Elly\",\n",
+                u8"    \"ruRU\": \"Элли\",\n",
+                u8"    \"zhCN\": \"艾丽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3416,\n",
+                u8"    \"Key\": \"merc06\",\n",
+                u8"    \"enUS\": \"Paige\",\n",
+                u8"    \"zhTW\": \"佩吉\",\n",
+                u8"    \"deDE\": \"Paige\",\n",
+                u8"    \"esES\": \"Paige\",\n",
+                u8"    \"frFR\": \"Paige\",\n",
+                u8"    \"itIT\": \"Paige\",\n",
+                u8"    \"koKR\": \"페이지\",\n",
+                u8"    \"plPL\": \"Paige\",\n",
+                u8"    \"esMX\": \"Paige\",\n",
+                u8"    \"jaJP\": \"ペイジ\",\n",
+                u8"    \"ptBR\": \"Priscila\",\n",
+                u8"    \"ruRU\": \"Пейдж\",\n",
+                u8"    \"zhCN\": \"派吉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3417,\n",
+                u8"    \"Key\": \"merc07\",\n",
+                u8"    \"enUS\": \"Basanti\",\n",
+                u8"    \"zhTW\": \"巴森媞\",\n",
+                u8"    \"deDE\": \"Basanti\",\n",
+                u8"    \"esES\": \"Basanti\",\n",
+                u8"    \"frFR\": \"Basanti\",\n",
+                u8"    \"itIT\": \"Basanti\",\n",
+                u8"    \"koKR\": \"바산티\",\n",
+                u8"    \"plPL\": \"Basanti\",\n",
+                u8"    \"esMX\": \"Basanti\",\n",
+                u8"    \"jaJP\": \"バサンティ\",\n",
+                u8"    \"ptBR\": \"Basanti\",\n",
+                u8"    \"ruRU\": \"Басанти\",\n",
+                u8"    \"zhCN\": \"巴森提\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3418,\n",
+                u8"    \"Key\": \"merc08\",\n",
+                u8"    \"enUS\": \"Blaise\",\n",
+                u8"    \"zhTW\": \"布萊絲\",\n",
+                u8"    \"deDE\": \"Blaise\",\n",
+                u8"    \"esES\": \"Blaise\",\n",
+                u8"    \"frFR\": \"Blaise\",\n",
+                u8"    \"itIT\": \"Blaise\",\n",
+                u8"    \"koKR\": \"블레이즈\",\n",
+                u8"    \"plPL\": \"Blaise\",\n",
+                u8"    \"esMX\": \"Blaise\",\n",
+                u8"    \"jaJP\": \"ブレーズ\",\n",
+                u8"    \"ptBR\": \"Bianca\",\n",
+                u8"    \"ruRU\": \"Блейз\",\n",
+                u8"    \"zhCN\": \"布蕾西\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3419,\n",
+                u8"    \"Key\": \"merc09\",\n",
+                u8"    \"enUS\": \"Kyoko\",\n",
+                u8"    \"zhTW\": \"京子\",\n",
+                u8"    \"deDE\": \"Kyoko\",\n",
+                u8"    \"esES\": \"Kyoko\",\n",
+                u8"    \"frFR\": \"Kyoko\",\n",
+                u8"    \"itIT\": \"Kyoko\",\n",
+                u8"    \"koKR\": \"유리\",\n",
+                u8"    \"plPL\": \"Kyoko\",\n",
+                u8"    \"esMX\": \"Kyoko\",\n",
+                u8"    \"jaJP\": \"キョウコ\",\n",
+                u8"    \"ptBR\": \"Kyoko\",\n",
+                u8"    \"ruRU\": \"Киоко\",\n",
+                u8"    \"zhCN\": \"京子\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3420,\n",
+                u8"    \"Key\": \"merc10\",\n",
+                u8"    \"enUS\": \"Klaudia\",\n",
+                u8"    \"zhTW\": \"克勞蒂亞\",\n",
+                u8"    \"deDE\": \"Klaudia\",\n",
+                u8"    \"esES\": \"Klaudia\",\n",
+                u8"    \"frFR\": \"Klaudia\",\n",
+                u8"    \"itIT\": \"Klaudia\",\n",
+                u8"    \"koKR\": \"클라우디아\",\n",
+                u8"    \"plPL\": \"Klaudia\",\n",
+                u8"    \"esMX\": \"Klaudia\",\n",
+                u8"    \"jaJP\": \"クローディア\",\n",
+                u8"    \"ptBR\": \"Claudia\",\n",
+                u8"    \"ruRU\": \"Клаудия\",\n",
+                u8"    \"zhCN\": \"克劳蒂亚\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3421,\n",
+                u8"    \"Key\": \"merc11\",\n",
+                u8"    \"enUS\": \"Kundri\",\n",
+                u8"    \"zhTW\": \"昆德莉\",\n",
+                u8"    \"deDE\": \"Kundri\",\n",
+                u8"    \"esES\": \"Kundri\",\n",
+                u8"    \"frFR\": \"Kundri\",\n",
+                u8"    \"itIT\": \"Kundri\",\n",
+                u8"    \"koKR\": \"쿤드리\",\n",
+                u8"    \"plPL\": \"Kundri\",\n",
+                u8"    \"esMX\": \"Kundri\",\n",
+                u8"    \"jaJP\": \"クンドゥリ\",\n",
+                u8"    \"ptBR\": \"Kundri\",\n",
+                u8"    \"ruRU\": \"Кундри\",\n",
+                u8"    \"zhCN\": \"昆德蕊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3422,\n",
+                u8"    \"Key\": \"merc12\",\n",
+                u8"    \"enUS\": \"Kyle\",\n",
+                u8"    \"zhTW\": \"凱爾\",\n",
+                u8"    \"deDE\": \"Kylo\",\n",
+                u8"    \"esES\": \"Kyle\",\n",
+                u8"    \"frFR\": \"Kyle\",\n",
+                u8"    \"itIT\": \"Kyle\",\n",
+                u8"    \"koKR\": \"카일\",\n",
+                u8"    \"plPL\": \"Kyle\",\n",
+                u8"    \"esMX\": \"Kyle\",\n",
+                u8"    \"jaJP\": \"カイル\",\n",
+                u8"    \"ptBR\": \"Caio\",\n",
+                u8"    \"ruRU\": \"Кайли\",\n",
+                u8"    \"zhCN\": \"凯尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3423,\n",
+                u8"    \"Key\": \"merc13\",\n",
+                u8"    \"enUS\": \"Visala\",\n",
+                u8"    \"zhTW\": \"維莎莉亞\",\n",
+                u8"    \"deDE\": \"Visala\",\n",
+                u8"    \"esES\": \"Visala\",\n",
+                u8"    \"frFR\": \"Visala\",\n",
+                u8"    \"itIT\": \"Visala\",\n",
+                u8"    \"koKR\": \"비살라\",\n",
+                u8"    \"plPL\": \"Visala\",\n",
+                u8"    \"esMX\": \"Visala\",\n",
+                u8"    \"jaJP\": \"ヴィサラ\",\n",
+                u8"    \"ptBR\": \"Visala\",\n",
+                u8"    \"ruRU\": \"Висала\",\n",
+                u8"    \"zhCN\": \"维萨拉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3424,\n",
+                u8"    \"Key\": \"merc14\",\n",
+                u8"    \"enUS\": \"Elexa\",\n",
+                u8"    \"zhTW\": \"依麗莎\",\n",
+                u8"    \"deDE\": \"Elexa\",\n",
+                u8"    \"esES\": \"Elexa\",\n",
+                u8"    \"frFR\": \"Elexa\",\n",
+                u8"    \"itIT\": \"Elexa\",\n",
+                u8"    \"koKR\": \"엘렉사\",\n",
+                u8"    \"plPL\": \"Elexa\",\n",
+                u8"    \"esMX\": \"Elexa\",\n",
+                u8"    \"jaJP\": \"エレクサ\",\n",
+                u8"    \"ptBR\": \"Elexa\",\n",
+                u8"    \"ruRU\": \"Элекса\",\n",
+                u8"    \"zhCN\": \"奥雷克萨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3425,\n",
+                u8"    \"Key\": \"merc15\",\n",
+                u8"    \"enUS\": \"Floria\",\n",
+                u8"    \"zhTW\": \"弗蘿利亞\",\n",
+                u8"    \"deDE\": \"Floria\",\n",
+                u8"    \"esES\": \"Floria\",\n",
+                u8"    \"frFR\": \"Floria\",\n",
+                u8"    \"itIT\": \"Floria\",\n",
+                u8"    \"koKR\": \"플로리아\",\n",
+                u8"    \"plPL\": \"Floria\",\n",
+                u8"    \"esMX\": \"Floria\",\n",
+                u8"    \"jaJP\": \"フローリア\",\n",
+                u8"    \"ptBR\": \"Flória\",\n",
+                u8"    \"ruRU\": \"Флория\",\n",
+                u8"    \"zhCN\": \"弗萝利亚\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3426,\n",
+                u8"    \"Key\": \"merc16\",\n",
+                u8"    \"enUS\": \"Fiona\",\n",
+                u8"    \"zhTW\": \"費歐娜\",\n",
+                u8"    \"deDE\": \"Fiona\",\n",
+                u8"    \"esES\": \"Fiona\",\n",
+                u8"    \"frFR\": \"Fiona\",\n",
+                u8"    \"itIT\": \"Fiona\",\n",
+                u8"    \"koKR\": \"피오나\",\n",
+                u8"    \"plPL\": \"Fiona\",\n",
+                u8"    \"esMX\": \"Fiona\",\n",
+                u8"    \"jaJP\": \"フィオナ\",\n",
+                u8"    \"ptBR\": \"Fiona\",\n",
+                u8"    \"ruRU\": \"Фиона\",\n",
+                u8"    \"zhCN\": \"菲欧娜\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3427,\n",
+                u8"    \"Key\": \"merc17\",\n",
+                u8"    \"enUS\": \"Gwinni\",\n",
+                u8"    \"zhTW\": \"吉溫妮\",\n",
+                u8"    \"deDE\": \"Gwinni\",\n",
+                u8"    \"esES\": \"Gwinni\",\n",
+                u8"    \"frFR\": \"Gwinni\",\n",
+                u8"    \"itIT\": \"Gwinni\",\n",
+                u8"    \"koKR\": \"그위니\",\n",
+                u8"    \"plPL\": \"Gwinni\",\n",
+                u8"    \"esMX\": \"Gwinni\",\n",
+                u8"    \"jaJP\": \"グウィニ\",\n",
+                u8"    \"ptBR\": \"Guinni\",\n",
+                u8"    \"ruRU\": \"Гвинни\",\n",
+                u8"    \"zhCN\": \"基温尼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3428,\n",
+                u8"    \"Key\": \"merc18\",\n",
+                u8"    \"enUS\": \"Gaile\",\n",
+                u8"    \"zhTW\": \"蓋兒\",\n",
+                u8"    \"deDE\": \"Geli\",\n",
+                u8"    \"esES\": \"Gaile\",\n",
+                u8"    \"frFR\": \"Gaile\",\n",
+                u8"    \"itIT\": \"Gaile\",\n",
+                u8"    \"koKR\": \"게일\",\n",
+                u8"    \"plPL\": \"Gaile\",\n",
+                u8"    \"esMX\": \"Gaile\",\n",
+                u8"    \"jaJP\": \"ゲイル\",\n",
+                u8"    \"ptBR\": \"Gilda\",\n",
+                u8"    \"ruRU\": \"Гейл\",\n",
+                u8"    \"zhCN\": \"盖尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3429,\n",
+                u8"    \"Key\": \"merc19\",\n",
+                u8"    \"enUS\": \"Hannah\",\n",
+                u8"    \"zhTW\": \"哈娜\",\n",
+                u8"    \"deDE\": \"Hannah\",\n",
+                u8"    \"esES\": \"Hannah\",\n",
+                u8"    \"frFR\": \"Hannah\",\n",
+                u8"    \"itIT\": \"Hannah\",\n",
+                u8"    \"koKR\": \"한나\",\n",
+                u8"    \"plPL\": \"Hannah\",\n",
+                u8"    \"esMX\": \"Atenea\",\n",
+                u8"    \"jaJP\": \"ハンナ\",\n",
+                u8"    \"ptBR\": \"Hanna\",\n",
+                u8"    \"ruRU\": \"Ханна\",\n",
+                u8"    \"zhCN\": \"哈娜\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3430,\n",
+                u8"    \"Key\": \"merc20\",\n",
+                u8"    \"enUS\": \"Heather\",\n",
+                u8"    \"zhTW\": \"海瑟\",\n",
+                u8"    \"deDE\": \"Heide\",\n",
+                u8"    \"esES\": \"Heather\",\n",
+                u8"    \"frFR\": \"Heather\",\n",
+                u8"    \"itIT\": \"Heather\",\n",
+                u8"    \"koKR\": \"헤더\",\n",
+                u8"    \"plPL\": \"Heather\",\n",
+                u8"    \"esMX\": \"Heather\",\n",
+                u8"    \"jaJP\": \"ヘザー\",\n",
+                u8"    \"ptBR\": \"Ester\",\n",
+                u8"    \"ruRU\": \"Хезер\",\n",
+                u8"    \"zhCN\": \"希瑟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3431,\n",
+                u8"    \"Key\": \"merc21\",\n",
+                u8"    \"enUS\": \"Iantha\",\n",
+                u8"    \"zhTW\": \"艾蓮娜\",\n",
+                u8"    \"deDE\": \"Iantha\",\n",
+                u8"    \"esES\": \"Iantha\",\n",
+                u8"    \"frFR\": \"Iantha\",\n",
+                u8"    \"itIT\": \"Iantha\",\n",
+                u8"    \"koKR\": \"이안타\",\n",
+                u8"    \"plPL\": \"Iantha\",\n",
+                u8"    \"esMX\": \"Iantha\",\n",
+                u8"    \"jaJP\": \"イアンサ\",\n",
+                u8"    \"ptBR\": \"Ianta\",\n",
+                u8"    \"ruRU\": \"Ианта\",\n",
+                u8"    \"zhCN\": \"伊安萨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3432,\n",
+                u8"    \"Key\": \"merc22\",\n",
+                u8"    \"enUS\": \"Diane\",\n",
+                u8"    \"zhTW\": \"黛安\",\n",
+                u8"    \"deDE\": \"Diane\",\n",
+                u8"    \"esES\": \"Diana\",\n",
+                u8"    \"frFR\": \"Diane\",\n",
+                u8"    \"itIT\": \"Diane\",\n",
+                u8"    \"koKR\": \"다이엔\",\n",
+                u8"    \"plPL\": \"Diane\",\n",
+                u8"    \"esMX\": \"Diane\",\n",
+                u8"    \"jaJP\": \"ダイアン\",\n",
+                u8"    \"ptBR\": \"Diana\",\n",
+                u8"    \"ruRU\": \"Диана\",\n",
+                u8"    \"zhCN\": \"戴安妮\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3433,\n",
+                u8"    \"Key\": \"merc23\",\n",
+                u8"    \"enUS\": \"Isolde\",\n",
+                u8"    \"zhTW\": \"依索德\",\n",
+                u8"    \"deDE\": \"Isolde\",\n",
+                u8"    \"esES\": \"Isolda\",\n",
+                u8"    \"frFR\": \"Isolde\",\n",
+                u8"    \"itIT\": \"Isolde\",\n",
+                u8"    \"koKR\": \"이졸데\",\n",
+                u8"    \"plPL\": \"Isolde\",\n",
+                u8"    \"esMX\": \"Isolde\",\n",
+                u8"    \"jaJP\": \"イゾルダ\",\n",
+                u8"    \"ptBR\": \"Isolda\",\n",
+                u8"    \"ruRU\": \"Изольда\",\n",
+                u8"    \"zhCN\": \"伊索德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3434,\n",
+                u8"    \"Key\": \"merc24\",\n",
+                u8"    \"enUS\": \"Divo\",\n",
+                u8"    \"zhTW\": \"迪佛\",\n",
+                u8"    \"deDE\": \"Divo\",\n",
+                u8"    \"esES\": \"Divo\",\n",
+                u8"    \"frFR\": \"Divo\",\n",
+                u8"    \"itIT\": \"Divo\",\n",
+                u8"    \"koKR\": \"디보\",\n",
+                u8"    \"plPL\": \"Divo\",\n",
+                u8"    \"esMX\": \"Divo\",\n",
+                u8"    \"jaJP\": \"ディーヴォ\",\n",
+                u8"    \"ptBR\": \"Divo\",\n",
+                u8"    \"ruRU\": \"Диво\",\n",
+                u8"    \"zhCN\": \"迪沃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3435,\n",
+                u8"    \"Key\": \"merc25\",\n",
+                u8"    \"enUS\": \"Ithera\",\n",
+                u8"    \"zhTW\": \"依索拉\",\n",
+                u8"    \"deDE\": \"Ithera\",\n",
+                u8"    \"esES\": \"Ithera\",\n",
+                u8"    \"frFR\": \"Ithera\",\n",
+                u8"    \"itIT\": \"Ithera\",\n",
+                u8"    \"koKR\": \"미라\",\n",
+                u8"    \"plPL\": \"Ithera\",\n",
+                u8"    \"esMX\": \"Ithera\",\n",
+                u8"    \"jaJP\": \"イセラ\",\n",
+                u8"    \"ptBR\": \"Itera\",\n",
+                u8"    \"ruRU\": \"Итера\",\n",
+                u8"    \"zhCN\": \"伊瑟拉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3436,\n",
+                u8"    \"Key\": \"merc26\",\n",
+                u8"    \"enUS\": \"Itonya\",\n",
+                u8"    \"zhTW\": \"伊東亞\",\n",
+                u8"    \"deDE\": \"Itonya\",\n",
+                u8"    \"esES\": \"Itonya\",\n",
+                u8"    \"frFR\": \"Itonya\",\n",
+                u8"    \"itIT\": \"Itonya\",\n",
+                u8"    \"koKR\": \"이토냐\",\n",
+                u8"    \"plPL\": \"Itonya\",\n",
+                u8"    \"esMX\": \"Itonya\",\n",
+                u8"    \"jaJP\": \"アイトーニャ\",\n",
+                u8"    \"ptBR\": \"Itônia\",\n",
+                u8"    \"ruRU\": \"Итония\",\n",
+                u8"    \"zhCN\": \"伊童雅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3437,\n",
+                u8"    \"Key\": \"merc27\",\n",
+                u8"    \"enUS\": \"Liene\",\n",
+                u8"    \"zhTW\": \"雷伊妮\",\n",
+                u8"    \"deDE\": \"Liene\",\n",
+                u8"    \"esES\": \"Liene\",\n",
+                u8"    \"frFR\": \"Liene\",\n",
+                u8"    \"itIT\": \"Liene\",\n",
+                u8"    \"koKR\": \"리엔\",\n",
+                u8"    \"plPL\": \"Liene\",\n",
+                u8"    \"esMX\": \"Liene\",\n",
+                u8"    \"jaJP\": \"リアン\",\n",
+                u8"    \"ptBR\": \"Liane\",\n",
+                u8"    \"ruRU\": \"Лиена\",\n",
+                u8"    \"zhCN\": \"黎恩\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3438,\n",
+                u8"    \"Key\": \"merc28\",\n",
+                u8"    \"enUS\": \"Maeko\",\n",
+                u8"    \"zhTW\": \"梅可\",\n",
+                u8"    \"deDE\": \"Mäko\",\n",
+                u8"    \"esES\": \"Maeko\",\n",
+                u8"    \"frFR\": \"Maeko\",\n",
+                u8"    \"itIT\": \"Maeko\",\n",
+                u8"    \"koKR\": \"마에코\",\n",
+                u8"    \"plPL\": \"Maeko\",\n",
+                u8"    \"esMX\": \"Maeko\",\n",
+                u8"    \"jaJP\": \"メイコ\",\n",
+                u8"    \"ptBR\": \"Maeko\",\n",
+                u8"    \"ruRU\": \"Маэко\",\n",
+                u8"    \"zhCN\": \"米克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3439,\n",
+                u8"    \"Key\": \"merc29\",\n",
+                u8"    \"enUS\": \"Mahala\",\n",
+                u8"    \"zhTW\": \"瑪哈拉\",\n",
+                u8"    \"deDE\": \"Mahala\",\n",
+                u8"    \"esES\": \"Mahala\",\n",
+                u8"    \"frFR\": \"Mahala\",\n",
+                u8"    \"itIT\": \"Mahala\",\n",
+                u8"    \"koKR\": \"마할라\",\n",
+                u8"    \"plPL\": \"Mahala\",\n",
+                u8"    \"esMX\": \"Mahala\",\n",
+                u8"    \"jaJP\": \"マハーラ\",\n",
+                u8"    \"ptBR\": \"Maala\",\n",
+                u8"    \"ruRU\": \"Магала\",\n",
+                u8"    \"zhCN\": \"马哈拉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3440,\n",
+                u8"    \"Key\": \"merc30\",\n",
+                u8"    \"enUS\": \"Liaza\",\n",
+                u8"    \"zhTW\": \"莉莎\",\n",
+                u8"    \"deDE\": \"Liasa\",\n",
+                u8"    \"esES\": \"Liaza\",\n",
+                u8"    \"frFR\": \"Liaza\",\n",
+                u8"    \"itIT\": \"Liaza\",\n",
+                u8"    \"koKR\": \"리아자\",\n",
+                u8"    \"plPL\": \"Liaza\",\n",
+                u8"    \"esMX\": \"Liaza\",\n",
+                u8"    \"jaJP\": \"リアーザ\",\n",
+                u8"    \"ptBR\": \"Liaza\",\n",
+                u8"    \"ruRU\": \"Лиаза\",\n",
+                u8"    \"zhCN\": \"利亚萨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3441,\n",
+                u8"    \"Key\": \"merc31\",\n",
+                u8"    \"enUS\": \"Meghan\",\n",
+                u8"    \"zhTW\": \"梅葛哈\",\n",
+                u8"    \"deDE\": \"Meghan\",\n",
+                u8"    \"esES\": \"Meghan\",\n",
+                u8"    \"frFR\": \"Meghan\",\n",
+                u8"    \"itIT\": \"Meghan\",\n",
+                u8"    \"koKR\": \"메간\",\n",
+                u8"    \"plPL\": \"Meghan\",\n",
+                u8"    \"esMX\": \"Meghan\",\n",
+                u8"    \"jaJP\": \"メーガン\",\n",
+                u8"    \"ptBR\": \"Megan\",\n",
+                u8"    \"ruRU\": \"Меган\",\n",
+                u8"    \"zhCN\": \"梅甘\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3442,\n",
+                u8"    \"Key\": \"merc32\",\n",
+                u8"    \"enUS\": \"Olena\",\n",
+                u8"    \"zhTW\": \"奧蓮娜\",\n",
+                u8"    \"deDE\": \"Olena\",\n",
+                u8"    \"esES\": \"Olena\",\n",
+                u8"    \"frFR\": \"Olena\",\n",
+                u8"    \"itIT\": \"Olena\",\n",
+                u8"    \"koKR\": \"올레나\",\n",
+                u8"    \"plPL\": \"Olena\",\n",
+                u8"    \"esMX\": \"Olena\",\n",
+                u8"    \"jaJP\": \"オレーナ\",\n",
+                u8"    \"ptBR\": \"Olena\",\n",
+                u8"    \"ruRU\": \"Олена\",\n",
+                u8"    \"zhCN\": \"奥蕾娜\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3443,\n",
+                u8"    \"Key\": \"merc33\",\n",
+                u8"    \"enUS\": \"Oriana\",\n",
+                u8"    \"zhTW\": \"奧麗亞娜\",\n",
+                u8"    \"deDE\": \"Oriana\",\n",
+                u8"    \"esES\": \"Oriana\",\n",
+                u8"    \"frFR\": \"Oriana\",\n",
+                u8"    \"itIT\": \"Oriana\",\n",
+                u8"    \"koKR\": \"오리아나\",\n",
+                u8"    \"plPL\": \"Oriana\",\n",
+                u8"    \"esMX\": \"Oriana\",\n",
+                u8"    \"jaJP\": \"オリアーナ\",\n",
+                u8"    \"ptBR\": \"Oriana\",\n",
+                u8"    \"ruRU\": \"Ориана\",\n",
+                u8"    \"zhCN\": \"奥利安娜\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3444,\n",
+                u8"    \"Key\": \"merc34\",\n",
+                u8"    \"enUS\": \"Ryann\",\n",
+                u8"    \"zhTW\": \"萊恩\",\n",
+                u8"    \"deDE\": \"Ryann\",\n",
+                u8"    \"esES\": \"Ryann\",\n",
+                u8"    \"frFR\": \"Ryann\",\n",
+                u8"    \"itIT\": \"Ryann\",\n",
+                u8"    \"koKR\": \"라이앤\",\n",
+                u8"    \"plPL\": \"Ryann\",\n",
+                u8"    \"esMX\": \"Ryann\",\n",
+                u8"    \"jaJP\": \"レアンヌ\",\n",
+                u8"    \"ptBR\": \"Rian\",\n",
+                u8"    \"ruRU\": \"Рианн\",\n",
+                u8"    \"zhCN\": \"瑞安\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3445,\n",
+                u8"    \"Key\": \"merc35\",\n",
+                u8"    \"enUS\": \"Rozene\",\n",
+                u8"    \"zhTW\": \"羅珊妮\",\n",
+                u8"    \"deDE\": \"Rosene\",\n",
+                u8"    \"esES\": \"Rozene\",\n",
+                u8"    \"frFR\": \"Rozene\",\n",
+                u8"    \"itIT\": \"Rozene\",\n",
+                u8"    \"koKR\": \"로젠\",\n",
+                u8"    \"plPL\": \"Rozene\",\n",
+                u8"    \"esMX\": \"Rozene\",\n",
+                u8"    \"jaJP\": \"ロゼーヌ\",\n",
+                u8"    \"ptBR\": \"Rozene\",\n",
+                u8"    \"ruRU\": \"Розена\",\n",
+                u8"    \"zhCN\": \"罗泽妮\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3446,\n",
+                u8"    \"Key\": \"merc36\",\n",
+                u8"    \"enUS\": \"Raissa\",\n",
+                u8"    \"zhTW\": \"萊莎\",\n",
+                u8"    \"deDE\": \"Raissa\",\n",
+                u8"    \"esES\": \"Raisa\",\n",
+                u8"    \"frFR\": \"Raissa\",\n",
+                u8"    \"itIT\": \"Raissa\",\n",
+                u8"    \"koKR\": \"라이사\",\n",
+                u8"    \"plPL\": \"Raissa\",\n",
+                u8"    \"esMX\": \"Raissa\",\n",
+                u8"    \"jaJP\": \"ライサ\",\n",
+                u8"    \"ptBR\": \"Raíssa\",\n",
+                u8"    \"ruRU\": \"Раисса\",\n",
+                u8"    \"zhCN\": \"雷萨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3447,\n",
+                u8"    \"Key\": \"merc37\",\n",
+                u8"    \"enUS\": \"Sharyn\",\n",
+                u8"    \"zhTW\": \"夏琳\",\n",
+                u8"    \"deDE\": \"Scharyn\",\n",
+                u8"    \"esES\": \"Sharyn\",\n",
+                u8"    \"frFR\": \"Sharyn\",\n",
+                u8"    \"itIT\": \"Sharyn\",\n",
+                u8"    \"koKR\": \"샤린\",\n",
+                u8"    \"plPL\": \"Sharyn\",\n",
+                u8"    \"esMX\": \"Sharyn\",\n",
+                u8"    \"jaJP\": \"シャリン\",\n",
+                u8"    \"ptBR\": \"Sharin\",\n",
+                u8"    \"ruRU\": \"Шарин\",\n",
+                u8"    \"zhCN\": \"夏琳\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3448,\n",
+                u8"    \"Key\": \"merc38\",\n",
+                u8"    \"enUS\": \"Shikha\",\n",
+                u8"    \"zhTW\": \"席克哈\",\n",
+                u8"    \"deDE\": \"Schicha\",\n",
+                u8"    \"esES\": \"Shija\",\n",
+                u8"    \"frFR\": \"Shikha\",\n",
+                u8"    \"itIT\": \"Shikha\",\n",
+                u8"    \"koKR\": \"쉬카\",\n",
+                u8"    \"plPL\": \"Shikha\",\n",
+                u8"    \"esMX\": \"Shikha\",\n",
+                u8"    \"jaJP\": \"シクハ\",\n",
+                u8"    \"ptBR\": \"Shika\",\n",
+                u8"    \"ruRU\": \"Шикха\",\n",
+                u8"    \"zhCN\": \"席卡\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3449,\n",
+                u8"    \"Key\": \"merc39\",\n",
+                u8"    \"enUS\": \"Debi\",\n",
+                u8"    \"zhTW\": \"戴比\",\n",
+                u8"    \"deDE\": \"Debi\",\n",
+                u8"    \"esES\": \"Debi\",\n",
+                u8"    \"frFR\": \"Debi\",\n",
+                u8"    \"itIT\": \"Debi\",\n",
+                u8"    \"koKR\": \"데비\",\n",
+                u8"    \"plPL\": \"Debi\",\n",
+                u8"    \"esMX\": \"Debi\",\n",
+                u8"    \"jaJP\": \"デビー\",\n",
+                u8"    \"ptBR\": \"Debi\",\n",
+                u8"    \"ruRU\": \"Деби\",\n",
+                u8"    \"zhCN\": \"黛比\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3450,\n",
+                u8"    \"Key\": \"merc40\",\n",
+                u8"    \"enUS\": \"Tylena\",\n",
+                u8"    \"zhTW\": \"泰蓮娜\",\n",
+                u8"    \"deDE\": \"Tylena\",\n",
+                u8"    \"esES\": \"Tylena\",\n",
+                u8"    \"frFR\": \"Tylena\",\n",
+                u8"    \"itIT\": \"Tylena\",\n",
+                u8"    \"koKR\": \"틸레나\",\n",
+                u8"    \"plPL\": \"Tylena\",\n",
+                u8"    \"esMX\": \"Tylena\",\n",
+                u8"    \"jaJP\": \"ティレーナ\",\n",
+                u8"    \"ptBR\": \"Tilena\",\n",
+                u8"    \"ruRU\": \"Тилена\",\n",
+                u8"    \"zhCN\": \"泰蕾娜\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3451,\n",
+                u8"    \"Key\": \"merc41\",\n",
+                u8"    \"enUS\": \"Wendy\",\n",
+                u8"    \"zhTW\": \"溫蒂\",\n",
+                u8"    \"deDE\": \"Wendy\",\n",
+                u8"    \"esES\": \"Wendy\",\n",
+                u8"    \"frFR\": \"Wendy\",\n",
+                u8"    \"itIT\": \"Wendy\",\n",
+                u8"    \"koKR\": \"웬디\",\n",
+                u8"    \"plPL\": \"Wendy\",\n",
+                u8"    \"esMX\": \"Wendy\",\n",
+                u8"    \"jaJP\": \"ウェンディ\",\n",
+                u8"    \"ptBR\": \"Wendy\",\n",
+                u8"    \"ruRU\": \"Венди\",\n",
+                u8"    \"zhCN\": \"温迪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10835,\n",
+                u8"    \"Key\": \"MercX101\",\n",
+                u8"    \"enUS\": \"Varaya\",\n",
+                u8"    \"zhTW\": \"伐拉亞\",\n",
+                u8"    \"deDE\": \"Vakir\",\n",
+                u8"    \"esES\": \"Vakir\",\n",
+                u8"    \"frFR\": \"Varaya\",\n",
+                u8"    \"itIT\": \"Varaya\",\n",
+                u8"    \"koKR\": \"바라야\",\n",
+                u8"    \"plPL\": \"Varaya\",\n",
+                u8"    \"esMX\": \"Varaya\",\n",
+                u8"    \"jaJP\": \"ヴァラヤ\",\n",
+                u8"    \"ptBR\": \"Varaia\",\n",
+                u8"    \"ruRU\": \"Варайя\",\n",
+                u8"    \"zhCN\": \"瓦拉亚\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10836,\n",
+                u8"    \"Key\": \"MercX102\",\n",
+                u8"    \"enUS\": \"Khan\",\n",
+                u8"    \"zhTW\": \"可汗\",\n",
+                u8"    \"deDE\": \"Khan\",\n",
+                u8"    \"esES\": \"Khan\",\n",
+                u8"    \"frFR\": \"Khan\",\n",
+                u8"    \"itIT\": \"Khan\",\n",
+                u8"    \"koKR\": \"칸\",\n",
+                u8"    \"plPL\": \"Khan\",\n",
+                u8"    \"esMX\": \"Khan\",\n",
+                u8"    \"jaJP\": \"カーン\",\n",
+                u8"    \"ptBR\": \"Khan\",\n",
+                u8"    \"ruRU\": \"Хан\",\n",
+                u8"    \"zhCN\": \"可汗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10837,\n",
+                u8"    \"Key\": \"MercX103\",\n",
+                u8"    \"enUS\": \"Klisk\",\n",
+                u8"    \"zhTW\": \"克理斯克\",\n",
+                u8"    \"deDE\": \"Lwik\",\n",
+                u8"    \"esES\": \"Lwik\",\n",
+                u8"    \"frFR\": \"Klisk\",\n",
+                u8"    \"itIT\": \"Klisk\",\n",
+                u8"    \"koKR\": \"클리스크\",\n",
+                u8"    \"plPL\": \"Klisk\",\n",
+                u8"    \"esMX\": \"Klisk\",\n",
+                u8"    \"jaJP\": \"クリスク\",\n",
+                u8"    \"ptBR\": \"Klisk\",\n",
+                u8"    \"ruRU\": \"Клиск\",\n",
+                u8"    \"zhCN\": \"克里斯克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10838,\n",
+                u8"    \"Key\": \"MercX104\",\n",
+                u8"    \"enUS\": \"Bors\",\n",
+                u8"    \"zhTW\": \"柏斯\",\n",
+                u8"    \"deDE\": \"Bors\",\n",
+                u8"    \"esES\": \"Bors\",\n",
+                u8"    \"frFR\": \"Bors\",\n",
+                u8"    \"itIT\": \"Bors\",\n",
+                u8"    \"koKR\": \"보르스\",\n",
+                u8"    \"plPL\": \"Bors\",\n",
+                u8"    \"esMX\": \"Bors\",\n",
+                u8"    \"jaJP\": \"ボルス\",\n",
+                u8"    \"ptBR\": \"Bors\",\n",
+                u8"    \"ruRU\": \"Борс\",\n",
+                u8"    \"zhCN\": \"波尔斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10839,\n",
+                u8"    \"Key\": \"MercX105\",\n",
+                u8"    \"enUS\": \"Brom\",\n",
+                u8"    \"zhTW\": \"波姆\",\n",
+                u8"    \"deDE\": \"Brom\",\n",
+                u8"    \"esES\": \"Brom\",\n",
+                u8"    \"frFR\": \"Brom\",\n",
+                u8"    \"itIT\": \"Brom\",\n",
+                u8"    \"koKR\": \"브롬\",\n",
+                u8"    \"plPL\": \"Brom\",\n",
+                u8"    \"esMX\": \"Brom\",\n",
+                u8"    \"jaJP\": \"ブロム\",\n",
+                u8"    \"ptBR\": \"Brom\",\n",
+                u8"    \"ruRU\": \"Бром\",\n",
+                u8"    \"zhCN\": \"布隆姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10840,\n",
+                u8"    \"Key\": \"MercX106\",\n",
+                u8"    \"enUS\": \"Wiglaf\",\n",
+                u8"    \"zhTW\": \"衛格萊夫\",\n",
+                u8"    \"deDE\": \"Wiaf\",\n",
+                u8"    \"esES\": \"Wiaf\",\n",
+                u8"    \"frFR\": \"Wiglaf\",\n",
+                u8"    \"itIT\": \"Wiglaf\",\n",
+                u8"    \"koKR\": \"위글라프\",\n",
+                u8"    \"plPL\": \"Wiglaf\",\n",
+                u8"    \"esMX\": \"Wiglaf\",\n",
+                u8"    \"jaJP\": \"ウィグラフ\",\n",
+                u8"    \"ptBR\": \"Wiglaf\",\n",
+                u8"    \"ruRU\": \"Виглаф\",\n",
+                u8"    \"zhCN\": \"维格拉夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10841,\n",
+                u8"    \"Key\": \"MercX107\",\n",
+                u8"    \"enUS\": \"Hrothgar\",\n",
+                u8"    \"zhTW\": \"霍勒斯加\",\n",
+                u8"    \"deDE\": \"Litot\",\n",
+                u8"    \"esES\": \"Litot\",\n",
+                u8"    \"frFR\": \"Hrothgar\",\n",
+                u8"    \"itIT\": \"Hrothgar\",\n",
+                u8"    \"koKR\": \"흐로스가\",\n",
+                u8"    \"plPL\": \"Hrothgar\",\n",
+                u8"    \"esMX\": \"Hrothgar\",\n",
+                u8"    \"jaJP\": \"フロスガル\",\n",
+                u8"    \"ptBR\": \"Rotgar\",\n",
+                u8"    \"ruRU\": \"Хротгар\",\n",
+                u8"    \"zhCN\": \"赫洛斯加\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10842,\n",
+                u8"    \"Key\": \"MercX108\",\n",
+                u8"    \"enUS\": \"Scyld\",\n",
+                u8"    \"zhTW\": \"西勒德\",\n",
+                u8"    \"deDE\": \"Scyld\",\n",
+                u8"    \"esES\": \"Scyld\",\n",
+                u8"    \"frFR\": \"Scyld\",\n",
+                u8"    \"itIT\": \"Scyld\",\n",
+                u8"    \"koKR\": \"스킬드\",\n",
+                u8"    \"plPL\": \"Scyld\",\n",
+                u8"    \"esMX\": \"Scyld\",\n",
+                u8"    \"jaJP\": \"サイルド\",\n",
+                u8"    \"ptBR\": \"Cylde\",\n",
+                u8"    \"ruRU\": \"Скильд\",\n",
+                u8"    \"zhCN\": \"赛尔德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10843,\n",
+                u8"    \"Key\": \"MercX109\",\n",
+                u8"    \"enUS\": \"Healfdane\",\n",
+                u8"    \"zhTW\": \"海爾夫坦\",\n",
+                u8"    \"deDE\": \"Hilfn\",\n",
+                u8"    \"esES\": \"Hilfn\",\n",
+                u8"    \"frFR\": \"Hilfdane\",\n",
+                u8"    \"itIT\": \"Healfdane\",\n",
+                u8"    \"koKR\": \"힐프데인\",\n",
+                u8"    \"plPL\": \"Healfdane\",\n",
+                u8"    \"esMX\": \"Healfdane\",\n",
+                u8"    \"jaJP\": \"ヘルフデイン\",\n",
+                u8"    \"ptBR\": \"Hafdan\",\n",
+                u8"    \"ruRU\": \"Хальфдан\",\n",
+                u8"    \"zhCN\": \"希福达恩\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10844,\n",
+                u8"    \"Key\": \"MercX110\",\n",
+                u8"    \"enUS\": \"Heorogar\",\n",
+                u8"    \"zhTW\": \"赫羅加\",\n",
+                u8"    \"deDE\": \"Jogar\",\n",
+                u8"    \"esES\": \"Rogar\",\n",
+                u8"    \"frFR\": \"Heorogar\",\n",
+                u8"    \"itIT\": \"Heorogar\",\n",
+                u8"    \"koKR\": \"헤오로가르\",\n",
+                u8"    \"plPL\": \"Heorogar\",\n",
+                u8"    \"esMX\": \"Heorogar\",\n",
+                u8"    \"jaJP\": \"ヘオロガル\",\n",
+                u8"    \"ptBR\": \"Erogar\",\n",
+                u8"    \"ruRU\": \"Хеорогар\",\n",
+                u8"    \"zhCN\": \"西奥洛迦\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10845,\n",
+                u8"    \"Key\": \"MercX111\",\n",
+                u8"    \"enUS\": \"Halgaunt\",\n",
+                u8"    \"zhTW\": \"海爾甘特\",\n",
+                u8"    \"deDE\": \"Iaent\",\n",
+                u8"    \"esES\": \"Haent\",\n",
+                u8"    \"frFR\": \"Halgaunt\",\n",
+                u8"    \"itIT\": \"Halgaunt\",\n",
+                u8"    \"koKR\": \"할가운트\",\n",
+                u8"    \"plPL\": \"Halgaunt\",\n",
+                u8"    \"esMX\": \"Halgaunt\",\n",
+                u8"    \"jaJP\": \"ハルガウント\",\n",
+                u8"    \"ptBR\": \"Halgaunt\",\n",
+                u8"    \"ruRU\": \"Халгаунт\",\n",
+                u8"    \"zhCN\": \"哈尔贡特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10846,\n",
+                u8"    \"Key\": \"MercX112\",\n",
+                u8"    \"enUS\": \"Hygelac\",\n",
+                u8"    \"zhTW\": \"海格拉克\",\n",
+                u8"    \"deDE\": \"Qelac\",\n",
+                u8"    \"esES\": \"Qelac\",\n",
+                u8"    \"frFR\": \"Hygelac\",\n",
+                u8"    \"itIT\": \"Hygelac\",\n",
+                u8"    \"koKR\": \"하이겔락\",\n",
+                u8"    \"plPL\": \"Hygelac\",\n",
+                u8"    \"esMX\": \"Hygelac\",\n",
+                u8"    \"jaJP\": \"ヒジェラック\",\n",
+                u8"    \"ptBR\": \"Riguelac\",\n",
+                u8"    \"ruRU\": \"Хигелак\",\n",
+                u8"    \"zhCN\": \"海格纳克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10847,\n",
+                u8"    \"Key\": \"MercX113\",\n",
+                u8"    \"enUS\": \"Egtheow\",\n",
+                u8"    \"zhTW\": \"艾格索\",\n",
+                u8"    \"deDE\": \"Ehoui\",\n",
+                u8"    \"esES\": \"Ehoui\",\n",
+                u8"    \"frFR\": \"Egtheow\",\n",
+                u8"    \"itIT\": \"Egtheow\",\n",
+                u8"    \"koKR\": \"에그소\",\n",
+                u8"    \"plPL\": \"Egtheow\",\n",
+                u8"    \"esMX\": \"Egtheow\",\n",
+                u8"    \"jaJP\": \"エグシオウ\",\n",
+                u8"    \"ptBR\": \"Egteo\",\n",
+                u8"    \"ruRU\": \"Эгтеов\",\n",
+                u8"    \"zhCN\": \"艾格西乌\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10848,\n",
+                u8"    \"Key\": \"MercX114\",\n",
+                u8"    \"enUS\": \"Bohdan\",\n",
+                u8"    \"zhTW\": \"波赫丹\",\n",
+                u8"    \"deDE\": \"Bidan\",\n",
+                u8"    \"esES\": \"Bidan\",\n",
+                u8"    \"frFR\": \"Bohdan\",\n",
+                u8"    \"itIT\": \"Bohdan\",\n",
+                u8"    \"koKR\": \"보단\",\n",
+                u8"    \"plPL\": \"Bohdan\",\n",
+                u8"    \"esMX\": \"Bohdan\",\n",
+                u8"    \"jaJP\": \"ボーダン\",\n",
+                u8"    \"ptBR\": \"Bodan\",\n",
+                u8"    \"ruRU\": \"Бодан\",\n",
+                u8"    \"zhCN\": \"柏和丹\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10849,\n",
+                u8"    \"Key\": \"MercX115\",\n",
+                u8"    \"enUS\": \"Wulfgar\",\n",
+                u8"    \"zhTW\": \"沃夫加\",\n",
+                u8"    \"deDE\": \"Ifger\",\n",
+                u8"    \"esES\": \"Ifger\",\n",
+                u8"    \"frFR\": \"Wulfgar\",\n",
+                u8"    \"itIT\": \"Wulfgar\",\n",
+                u8"    \"koKR\": \"울프가르\",\n",
+                u8"    \"plPL\": \"Wulfgar\",\n",
+                u8"    \"esMX\": \"Wulfgar\",\n",
+                u8"    \"jaJP\": \"ウォルフガル\",\n",
+                u8"    \"ptBR\": \"Wulfgar\",\n",
+                u8"    \"ruRU\": \"Вульфгар\",\n",
+                u8"    \"zhCN\": \"沃夫加尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10850,\n",
+                u8"    \"Key\": \"MercX116\",\n",
+                u8"    \"enUS\": \"Hild\",\n",
+                u8"    \"zhTW\": \"希爾德\",\n",
+                u8"    \"deDE\": \"Hild\",\n",
+                u8"    \"esES\": \"Hild\",\n",
+                u8"    \"frFR\": \"Hild\",\n",
+                u8"    \"itIT\": \"Hild\",\n",
+                u8"    \"koKR\": \"힐드\",\n",
+                u8"    \"plPL\": \"Hild\",\n",
+                u8"    \"esMX\": \"Hild\",\n",
+                u8"    \"jaJP\": \"ヒルド\",\n",
+                u8"    \"ptBR\": \"Hild\",\n",
+                u8"    \"ruRU\": \"Хильд\",\n",
+                u8"    \"zhCN\": \"希尔德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10851,\n",
+                u8"    \"Key\": \"MercX117\",\n",
+                u8"    \"enUS\": \"Heatholaf\",\n",
+                u8"    \"zhTW\": \"希斯洛夫\",\n",
+                u8"    \"deDE\": \"Hatho\",\n",
+                u8"    \"esES\": \"Hatho\",\n",
+                u8"    \"frFR\": \"Heatholaf\",\n",
+                u8"    \"itIT\": \"Heatholaf\",\n",
+                u8"    \"koKR\": \"히솔라프\",\n",
+                u8"    \"plPL\": \"Heatholaf\",\n",
+                u8"    \"esMX\": \"Heatholaf\",\n",
+                u8"    \"jaJP\": \"ハーソラフ\",\n",
+                u8"    \"ptBR\": \"Etolaf\",\n",
+                u8"    \"ruRU\": \"Хитолаф\",\n",
+                u8"    \"zhCN\": \"西索拉夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10852,\n",
+                u8"    \"Key\": \"MercX118\",\n",
+                u8"    \"enUS\": \"Weder\",\n",
+                u8"    \"zhTW\": \"魏德\",\n",
+                u8"    \"deDE\": \"Veder\",\n",
+                u8"    \"esES\": \"Veder\",\n",
+                u8"    \"frFR\": \"Weder\",\n",
+                u8"    \"itIT\": \"Weder\",\n",
+                u8"    \"koKR\": \"웨데르\",\n",
+                u8"    \"plPL\": \"Weder\",\n",
+                u8"    \"esMX\": \"Weder\",\n",
+                u8"    \"jaJP\": \"ウェダル\",\n",
+                u8"    \"ptBR\": \"Weder\",\n",
+                u8"    \"ruRU\": \"Ведер\",\n",
+                u8"    \"zhCN\": \"维德尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10853,\n",
+                u8"    \"Key\": \"MercX119\",\n",
+                u8"    \"enUS\": \"Vikhyat\",\n",
+                u8"    \"zhTW\": \"維克海亞特\",\n",
+                u8"    \"deDE\": \"Vihat\",\n",
+                u8"    \"esES\": \"Vikhyat\",\n",
+                u8"    \"frFR\": \"Vikhyat\",\n",
+                u8"    \"itIT\": \"Vikhyat\",\n",
+                u8"    \"koKR\": \"비크햐트\",\n",
+                u8"    \"plPL\": \"Vikhyat\",\n",
+                u8"    \"esMX\": \"Vikhyat\",\n",
+                u8"    \"jaJP\": \"ヴィクヒャト\",\n",
+                u8"    \"ptBR\": \"Vikiat\",\n",
+                u8"    \"ruRU\": \"Вихьят\",\n",
+                u8"    \"zhCN\": \"维基亚特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10854,\n",
+                u8"    \"Key\": \"MercX120\",\n",
+                u8"    \"enUS\": \"Unferth\",\n",
+                u8"    \"zhTW\": \"安佛斯\",\n",
+                u8"    \"deDE\": \"Flrth\",\n",
+                u8"    \"esES\": \"Ferth\",\n",
+                u8"    \"frFR\": \"Unferth\",\n",
+                u8"    \"itIT\": \"Unferth\",\n",
+                u8"    \"koKR\": \"운페르트\",\n",
+                u8"    \"plPL\": \"Unferth\",\n",
+                u8"    \"esMX\": \"Unferth\",\n",
+                u8"    \"jaJP\": \"アンフェルス\",\n",
+                u8"    \"ptBR\": \"Unfert\",\n",
+                u8"    \"ruRU\": \"Унферт\",\n",
+                u8"    \"zhCN\": \"昂菲斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10855,\n",
+                u8"    \"Key\": \"MercX121\",\n",
+                u8"    \"enUS\": \"Sigemund\",\n",
+                u8"    \"zhTW\": \"希格門德\",\n",
+                u8"    \"deDE\": \"Tund\",\n",
+                u8"    \"esES\": \"Tund\",\n",
+                u8"    \"frFR\": \"Sigemund\",\n",
+                u8"    \"itIT\": \"Sigemund\",\n",
+                u8"    \"koKR\": \"시게문드\",\n",
+                u8"    \"plPL\": \"Sigemund\",\n",
+                u8"    \"esMX\": \"Sigemund\",\n",
+                u8"    \"jaJP\": \"シグムンド\",\n",
+                u8"    \"ptBR\": \"Sigmund\",\n",
+                u8"    \"ruRU\": \"Сигемунд\",\n",
+                u8"    \"zhCN\": \"希格蒙德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10856,\n",
+                u8"    \"Key\": \"MercX122\",\n",
+                u8"    \"enUS\": \"Heremod\",\n",
+                u8"    \"zhTW\": \"希爾穆特\",\n",
+                u8"    \"deDE\": \"Ermd\",\n",
+                u8"    \"esES\": \"Ermod\",\n",
+                u8"    \"frFR\": \"Heremod\",\n",
+                u8"    \"itIT\": \"Heremod\",\n",
+                u8"    \"koKR\": \"헤레모드\",\n",
+                u8"    \"plPL\": \"Heremod\",\n",
+                u8"    \"esMX\": \"Heremod\",\n",
+                u8"    \"jaJP\": \"ヘレモッド\",\n",
+                u8"    \"ptBR\": \"Eremod\",\n",
+                u8"    \"ruRU\": \"Геремод\",\n",
+                u8"    \"zhCN\": \"赫雷默德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10857,\n",
+                u8"    \"Key\": \"MercX123\",\n",
+                u8"    \"enUS\": \"Hengest\",\n",
+                u8"    \"zhTW\": \"罕格斯特\",\n",
+                u8"    \"deDE\": \"Hoglt\",\n",
+                u8"    \"esES\": \"Hogst\",\n",
+                u8"    \"frFR\": \"Hengest\",\n",
+                u8"    \"itIT\": \"Hengest\",\n",
+                u8"    \"koKR\": \"헨게스트\",\n",
+                u8"    \"plPL\": \"Hengest\",\n",
+                u8"    \"esMX\": \"Hengest\",\n",
+                u8"    \"jaJP\": \"ヘンジェスト\",\n",
+                u8"    \"ptBR\": \"Engest\",\n",
+                u8"    \"ruRU\": \"Хенгист\",\n",
+                u8"    \"zhCN\": \"亨杰斯特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10858,\n",
+                u8"    \"Key\": \"MercX124\",\n",
+                u8"    \"enUS\": \"Folcwald\",\n",
+                u8"    \"zhTW\": \"弗克魏爾德\",\n",
+                u8"    \"deDE\": \"Feol\",\n",
+                u8"    \"esES\": \"Feold\",\n",
+                u8"    \"frFR\": \"Folcwald\",\n",
+                u8"    \"itIT\": \"Folcwald\",\n",
+                u8"    \"koKR\": \"폴크왈드\",\n",
+                u8"    \"plPL\": \"Folcwald\",\n",
+                u8"    \"esMX\": \"Folcwald\",\n",
+                u8"    \"jaJP\": \"フルクワルド\",\n",
+                u8"    \"ptBR\": \"Folcwald\",\n",
+                u8"    \"ruRU\": \"Фольквальд\",\n",
+                u8"    \"zhCN\": \"佛科瓦尔德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10859,\n",
+                u8"    \"Key\": \"MercX125\",\n",
+                u8"    \"enUS\": \"Frisian\",\n",
+                u8"    \"zhTW\": \"弗雷斯坦\",\n",
+                u8"    \"deDE\": \"Fianz\",\n",
+                u8"    \"esES\": \"Fianz\",\n",
+                u8"    \"frFR\": \"Frisian\",\n",
+                u8"    \"itIT\": \"Frisian\",\n",
+                u8"    \"koKR\": \"프리지안\",\n",
+                u8"    \"plPL\": \"Frisian\",\n",
+                u8"    \"esMX\": \"Frisian\",\n",
+                u8"    \"jaJP\": \"フリジアン\",\n",
+                u8"    \"ptBR\": \"Frisian\",\n",
+                u8"    \"ruRU\": \"Фризиан\",\n",
+                u8"    \"zhCN\": \"弗里贤\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10860,\n",
+                u8"    \"Key\": \"MercX126\",\n",
+                u8"    \"enUS\": \"Hnaef\",\n",
+                u8"    \"zhTW\": \"荷那夫\",\n",
+                u8"    \"deDE\": \"Hnaf\",\n",
+                u8"    \"esES\": \"Hnaef\",\n",
+                u8"    \"frFR\": \"Hnaef\",\n",
+                u8"    \"itIT\": \"Hnaef\",\n",
+                u8"    \"koKR\": \"흐네프\",\n",
+                u8"    \"plPL\": \"Hnaef\",\n",
+                u8"    \"esMX\": \"Hnaef\",\n",
+                u8"    \"jaJP\": \"フネイフ\",\n",
+                u8"    \"ptBR\": \"Nef\",\n",
+                u8"    \"ruRU\": \"Хнаф\",\n",
+                u8"    \"zhCN\": \"纳伊夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10861,\n",
+                u8"    \"Key\": \"MercX127\",\n",
+                u8"    \"enUS\": \"Guthlaf\",\n",
+                u8"    \"zhTW\": \"高斯拉夫\",\n",
+                u8"    \"deDE\": \"Thlf\",\n",
+                u8"    \"esES\": \"Thlaf\",\n",
+                u8"    \"frFR\": \"Guthlaf\",\n",
+                u8"    \"itIT\": \"Guthlaf\",\n",
+                u8"    \"koKR\": \"구슬라프\",\n",
+                u8"    \"plPL\": \"Guthlaf\",\n",
+                u8"    \"esMX\": \"Guthlaf\",\n",
+                u8"    \"jaJP\": \"ガスラフ\",\n",
+                u8"    \"ptBR\": \"Gutlaf\",\n",
+                u8"    \"ruRU\": \"Гутлаф\",\n",
+                u8"    \"zhCN\": \"古特拉夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10862,\n",
+                u8"    \"Key\": \"MercX128\",\n",
+                u8"    \"enUS\": \"Oslaf\",\n",
+                u8"    \"zhTW\": \"歐斯拉夫\",\n",
+                u8"    \"deDE\": \"Oslaf\",\n",
+                u8"    \"esES\": \"Oslaf\",\n",
+                u8"    \"frFR\": \"Oslaf\",\n",
+                u8"    \"itIT\": \"Oslaf\",\n",
+                u8"    \"koKR\": \"오슬라프\",\n",
+                u8"    \"plPL\": \"Oslaf\",\n",
+                u8"    \"esMX\": \"Oslaf\",\n",
+                u8"    \"jaJP\": \"オスラフ\",\n",
+                u8"    \"ptBR\": \"Oslaf\",\n",
+                u8"    \"ruRU\": \"Ослаф\",\n",
+                u8"    \"zhCN\": \"欧斯拉夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10863,\n",
+                u8"    \"Key\": \"MercX129\",\n",
+                u8"    \"enUS\": \"Yrmenlaf\",\n",
+                u8"    \"zhTW\": \"亞門拉夫\",\n",
+                u8"    \"deDE\": \"Jlaf\",\n",
+                u8"    \"esES\": \"Jlaf\",\n",
+                u8"    \"frFR\": \"Yrmenlaf\",\n",
+                u8"    \"itIT\": \"Yrmenlaf\",\n",
+                u8"    \"koKR\": \"이르멘라프\",\n",
+                u8"    \"plPL\": \"Yrmenlaf\",\n",
+                u8"    \"esMX\": \"Yrmenlaf\",\n",
+                u8"    \"jaJP\": \"ヨルムンラフ\",\n",
+                u8"    \"ptBR\": \"Irmenlaf\",\n",
+                u8"    \"ruRU\": \"Ирменлаф\",\n",
+                u8"    \"zhCN\": \"伊门拉夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10864,\n",
+                u8"    \"Key\": \"MercX130\",\n",
+                u8"    \"enUS\": \"Garmund\",\n",
+                u8"    \"zhTW\": \"加門德\",\n",
+                u8"    \"deDE\": \"Oslae\",\n",
+                u8"    \"esES\": \"Osfae\",\n",
+                u8"    \"frFR\": \"Garmund\",\n",
+                u8"    \"itIT\": \"Garmund\",\n",
+                u8"    \"koKR\": \"가르문드\",\n",
+                u8"    \"plPL\": \"Garmund\",\n",
+                u8"    \"esMX\": \"Garmund\",\n",
+                u8"    \"jaJP\": \"ガルムンド\",\n",
+                u8"    \"ptBR\": \"Garmund\",\n",
+                u8"    \"ruRU\": \"Гармунд\",\n",
+                u8"    \"zhCN\": \"加尔蒙德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10865,\n",
+                u8"    \"Key\": \"MercX131\",\n",
+                u8"    \"enUS\": \"Lanth\",\n",
+                u8"    \"zhTW\": \"拉恩斯\",\n",
+                u8"    \"deDE\": \"Friu\",\n",
+                u8"    \"esES\": \"Freu\",\n",
+                u8"    \"frFR\": \"Freawaru\",\n",
+                u8"    \"itIT\": \"Freawaru\",\n",
+                u8"    \"koKR\": \"란트\",\n",
+                u8"    \"plPL\": \"Lanth\",\n",
+                u8"    \"esMX\": \"Lanth\",\n",
+                u8"    \"jaJP\": \"ランス\",\n",
+                u8"    \"ptBR\": \"Lant\",\n",
+                u8"    \"ruRU\": \"Лант\",\n",
+                u8"    \"zhCN\": \"朗斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10866,\n",
+                u8"    \"Key\": \"MercX132\",\n",
+                u8"    \"enUS\": \"Eadgils\",\n",
+                u8"    \"zhTW\": \"艾德格理斯\",\n",
+                u8"    \"deDE\": \"Agils\",\n",
+                u8"    \"esES\": \"Agils\",\n",
+                u8"    \"frFR\": \"Eadgils\",\n",
+                u8"    \"itIT\": \"Eadgils\",\n",
+                u8"    \"koKR\": \"이드길스\",\n",
+                u8"    \"plPL\": \"Eadgils\",\n",
+                u8"    \"esMX\": \"Eadgils\",\n",
+                u8"    \"jaJP\": \"イードギルズ\",\n",
+                u8"    \"ptBR\": \"Eguil\",\n",
+                u8"    \"ruRU\": \"Адильс\",\n",
+                u8"    \"zhCN\": \"伊德吉斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10867,\n",
+                u8"    \"Key\": \"MercX133\",\n",
+                u8"    \"enUS\": \"Onela\",\n",
+                u8"    \"zhTW\": \"奧尼拉\",\n",
+                u8"    \"deDE\": \"Onel\",\n",
+                u8"    \"esES\": \"Onela\",\n",
+                u8"    \"frFR\": \"Onela\",\n",
+                u8"    \"itIT\": \"Onela\",\n",
+                u8"    \"koKR\": \"오넬라\",\n",
+                u8"    \"plPL\": \"Onela\",\n",
+                u8"    \"esMX\": \"Onela\",\n",
+                u8"    \"jaJP\": \"オニーラ\",\n",
+                u8"    \"ptBR\": \"Onela\",\n",
+                u8"    \"ruRU\": \"Онела\",\n",
+                u8"    \"zhCN\": \"欧内拉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10868,\n",
+                u8"    \"Key\": \"MercX134\",\n",
+                u8"    \"enUS\": \"Damien\",\n",
+                u8"    \"zhTW\": \"戴米安\",\n",
+                u8"    \"deDE\": \"Dama\",\n",
+                u8"    \"esES\": \"Damien\",\n",
+                u8"    \"frFR\": \"Damien\",\n",
+                u8"    \"itIT\": \"Damien\",\n",
+                u8"    \"koKR\": \"다미엔\",\n",
+                u8"    \"plPL\": \"Damien\",\n",
+                u8"    \"esMX\": \"Damien\",\n",
+                u8"    \"jaJP\": \"ダミアン\",\n",
+                u8"    \"ptBR\": \"Damião\",\n",
+                u8"    \"ruRU\": \"Дамиен\",\n",
+                u8"    \"zhCN\": \"达米恩\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10869,\n",
+                u8"    \"Key\": \"MercX135\",\n",
+                u8"    \"enUS\": \"Tryneus\",\n",
+                u8"    \"zhTW\": \"崔尼爾斯\",\n",
+                u8"    \"deDE\": \"Erfor\",\n",
+                u8"    \"esES\": \"Erfor\",\n",
+                u8"    \"frFR\": \"Erfor\",\n",
+                u8"    \"itIT\": \"Erfor\",\n",
+                u8"    \"koKR\": \"트리네우스\",\n",
+                u8"    \"plPL\": \"Tryneus\",\n",
+                u8"    \"esMX\": \"Tryneus\",\n",
+                u8"    \"jaJP\": \"トリニュース\",\n",
+                u8"    \"ptBR\": \"Trineu\",\n",
+                u8"    \"ruRU\": \"Триней\",\n",
+                u8"    \"zhCN\": \"特瑞纽斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10870,\n",
+                u8"    \"Key\": \"MercX136\",\n",
+                u8"    \"enUS\": \"Klar\",\n",
+                u8"    \"zhTW\": \"克拉爾\",\n",
+                u8"    \"deDE\": \"Iejyz\",\n",
+                u8"    \"esES\": \"Wejyz\",\n",
+                u8"    \"frFR\": \"Weohstan\",\n",
+                u8"    \"itIT\": \"Weohstan\",\n",
+                u8"    \"koKR\": \"클라르\",\n",
+                u8"    \"plPL\": \"Klar\",\n",
+                u8"    \"esMX\": \"Klar\",\n",
+                u8"    \"jaJP\": \"クラル\",\n",
+                u8"    \"ptBR\": \"Klar\",\n",
+                u8"    \"ruRU\": \"Клар\",\n",
+                u8"    \"zhCN\": \"克拉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10871,\n",
+                u8"    \"Key\": \"MercX137\",\n",
+                u8"    \"enUS\": \"Wulf\",\n",
+                u8"    \"zhTW\": \"沃爾夫\",\n",
+                u8"    \"deDE\": \"Wulf\",\n",
+                u8"    \"esES\": \"Wulf\",\n",
+                u8"    \"frFR\": \"Wulf\",\n",
+                u8"    \"itIT\": \"Wulf\",\n",
+                u8"    \"koKR\": \"울프\",\n",
+                u8"    \"plPL\": \"Wulf\",\n",
+                u8"    \"esMX\": \"Wulf\",\n",
+                u8"    \"jaJP\": \"ウォルフ\",\n",
+                u8"    \"ptBR\": \"Wulf\",\n",
+                u8"    \"ruRU\": \"Вульф\",\n",
+                u8"    \"zhCN\": \"沃夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10872,\n",
+                u8"    \"Key\": \"MercX138\",\n",
+                u8"    \"enUS\": \"Bulwye\",\n",
+                u8"    \"zhTW\": \"布爾溫\",\n",
+                u8"    \"deDE\": \"Liwie\",\n",
+                u8"    \"esES\": \"Liwye\",\n",
+                u8"    \"frFR\": \"Bulwye\",\n",
+                u8"    \"itIT\": \"Bulwye\",\n",
+                u8"    \"koKR\": \"불와이\",\n",
+                u8"    \"plPL\": \"Bulwye\",\n",
+                u8"    \"esMX\": \"Bulwye\",\n",
+                u8"    \"jaJP\": \"バルウィ\",\n",
+                u8"    \"ptBR\": \"Bulif\",\n",
+                u8"    \"ruRU\": \"Балвий\",\n",
+                u8"    \"zhCN\": \"布尔维\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10873,\n",
+                u8"    \"Key\": \"MercX139\",\n",
+                u8"    \"enUS\": \"Lief\",\n",
+                u8"    \"zhTW\": \"理夫\",\n",
+                u8"    \"deDE\": \"Lief\",\n",
+                u8"    \"esES\": \"Lief\",\n",
+                u8"    \"frFR\": \"Lief\",\n",
+                u8"    \"itIT\": \"Lief\",\n",
+                u8"    \"koKR\": \"리프\",\n",
+                u8"    \"plPL\": \"Lief\",\n",
+                u8"    \"esMX\": \"Lief\",\n",
+                u8"    \"jaJP\": \"リエフ\",\n",
+                u8"    \"ptBR\": \"Lief\",\n",
+                u8"    \"ruRU\": \"Лиеф\",\n",
+                u8"    \"zhCN\": \"列夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10874,\n",
+                u8"    \"Key\": \"MercX140\",\n",
+                u8"    \"enUS\": \"Magnus\",\n",
+                u8"    \"zhTW\": \"馬格納斯\",\n",
+                u8"    \"deDE\": \"Magu\",\n",
+                u8"    \"esES\": \"Magus\",\n",
+                u8"    \"frFR\": \"Magnus\",\n",
+                u8"    \"itIT\": \"Magnus\",\n",
+                u8"    \"koKR\": \"마그누스\",\n",
+                u8"    \"plPL\": \"Magnus\",\n",
+                u8"    \"esMX\": \"[ms]Magnus\",\n",
+                u8"    \"jaJP\": \"マグナス\",\n",
+                u8"    \"ptBR\": \"Magnus\",\n",
+                u8"    \"ruRU\": \"Магнус\",\n",
+                u8"    \"zhCN\": \"玛格努斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10875,\n",
+                u8"    \"Key\": \"MercX141\",\n",
+                u8"    \"enUS\": \"Klatu\",\n",
+                u8"    \"zhTW\": \"格拉圖\",\n",
+                u8"    \"deDE\": \"Klatu\",\n",
+                u8"    \"esES\": \"Klatu\",\n",
+                u8"    \"frFR\": \"Klatu\",\n",
+                u8"    \"itIT\": \"Klatu\",\n",
+                u8"    \"koKR\": \"클라투\",\n",
+                u8"    \"plPL\": \"Klatu\",\n",
+                u8"    \"esMX\": \"Klatu\",\n",
+                u8"    \"jaJP\": \"クラトゥ\",\n",
+                u8"    \"ptBR\": \"Klatu\",\n",
+                u8"    \"ruRU\": \"Клату\",\n",
+                u8"    \"zhCN\": \"克拉图\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10876,\n",
+                u8"    \"Key\": \"MercX142\",\n",
+                u8"    \"enUS\": \"Drus\",\n",
+                u8"    \"zhTW\": \"圖魯斯\",\n",
+                u8"    \"deDE\": \"Drus\",\n",
+                u8"    \"esES\": \"Drus\",\n",
+                u8"    \"frFR\": \"Drus\",\n",
+                u8"    \"itIT\": \"Drus\",\n",
+                u8"    \"koKR\": \"드루스\",\n",
+                u8"    \"plPL\": \"Drus\",\n",
+                u8"    \"esMX\": \"Drus\",\n",
+                u8"    \"jaJP\": \"ドルス\",\n",
+                u8"    \"ptBR\": \"Drus\",\n",
+                u8"    \"ruRU\": \"Друс\",\n",
+                u8"    \"zhCN\": \"德鲁斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10877,\n",
+                u8"    \"Key\": \"MercX143\",\n",
+                u8"    \"enUS\": \"Hoku\",\n",
+                u8"    \"zhTW\": \"候克\",\n",
+                u8"    \"deDE\": \"Hoku\",\n",
+                u8"    \"esES\": \"Hoku\",\n",
+                u8"    \"frFR\": \"Hoku\",\n",
+                u8"    \"itIT\": \"Hoku\",\n",
+                u8"    \"koKR\": \"호쿠\",\n",
+                u8"    \"plPL\": \"Hoku\",\n",
+                u8"    \"esMX\": \"Hoku\",\n",
+                u8"    \"jaJP\": \"ホク\",\n",
+                u8"    \"ptBR\": \"Hokan\",\n",
+                u8"    \"ruRU\": \"Хоку\",\n",
+                u8"    \"zhCN\": \"霍库\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10878,\n",
+                u8"    \"Key\": \"MercX144\",\n",
+                u8"    \"enUS\": \"Kord\",\n",
+                u8"    \"zhTW\": \"科杜\",\n",
+                u8"    \"deDE\": \"Kord\",\n",
+                u8"    \"esES\": \"Kord\",\n",
+                u8"    \"frFR\": \"Kord\",\n",
+                u8"    \"itIT\": \"Kord\",\n",
+                u8"    \"koKR\": \"코르드\",\n",
+                u8"    \"plPL\": \"Kord\",\n",
+                u8"    \"esMX\": \"Kord\",\n",
+                u8"    \"jaJP\": \"コルド\",\n",
+                u8"    \"ptBR\": \"Kord\",\n",
+                u8"    \"ruRU\": \"Корд\",\n",
+                u8"    \"zhCN\": \"科德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10879,\n",
+                u8"    \"Key\": \"MercX145\",\n",
+                u8"    \"enUS\": \"Uther\",\n",
+                u8"    \"zhTW\": \"烏瑟爾\",\n",
+                u8"    \"deDE\": \"Uthr\",\n",
+                u8"    \"esES\": \"Uther\",\n",
+                u8"    \"frFR\": \"Uther\",\n",
+                u8"    \"itIT\": \"Uther\",\n",
+                u8"    \"koKR\": \"우서\",\n",
+                u8"    \"plPL\": \"Uther\",\n",
+                u8"    \"esMX\": \"Uther\",\n",
+                u8"    \"jaJP\": \"ウーサー\",\n",
+                u8"    \"ptBR\": \"Uther\",\n",
+                u8"    \"ruRU\": \"Утер\",\n",
+                u8"    \"zhCN\": \"乌瑟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10880,\n",
+                u8"    \"Key\": \"MercX146\",\n",
+                u8"    \"enUS\": \"Ip\",\n",
+                u8"    \"zhTW\": \"艾普\",\n",
+                u8"    \"deDE\": \"Stuu\",\n",
+                u8"    \"esES\": \"Stu\",\n",
+                u8"    \"frFR\": \"Ip\",\n",
+                u8"    \"itIT\": \"Ip\",\n",
+                u8"    \"koKR\": \"아이프\",\n",
+                u8"    \"plPL\": \"Ip\",\n",
+                u8"    \"esMX\": \"Ip\",\n",
+                u8"    \"jaJP\": \"イプ\",\n",
+                u8"    \"ptBR\": \"Ip\",\n",
+                u8"    \"ruRU\": \"Ип\",\n",
+                u8"    \"zhCN\": \"艾普\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10881,\n",
+                u8"    \"Key\": \"MercX147\",\n",
+                u8"    \"enUS\": \"Ulf\",\n",
+                u8"    \"zhTW\": \"伍夫\",\n",
+                u8"    \"deDE\": \"Ulf\",\n",
+                u8"    \"esES\": \"Ulf\",\n",
+                u8"    \"frFR\": \"Ulf\",\n",
+                u8"    \"itIT\": \"Ulf\",\n",
+                u8"    \"koKR\": \"얼프\",\n",
+                u8"    \"plPL\": \"Ulf\",\n",
+                u8"    \"esMX\": \"Ulf\",\n",
+                u8"    \"jaJP\": \"ユルフ\",\n",
+                u8"    \"ptBR\": \"Ulf\",\n",
+                u8"    \"ruRU\": \"Ульф\",\n",
+                u8"    \"zhCN\": \"乌尔夫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10882,\n",
+                u8"    \"Key\": \"MercX148\",\n",
+                u8"    \"enUS\": \"Tharr\",\n",
+                u8"    \"zhTW\": \"撒爾\",\n",
+                u8"    \"deDE\": \"Tharr\",\n",
+                u8"    \"esES\": \"Tharr\",\n",
+                u8"    \"frFR\": \"Tharr\",\n",
+                u8"    \"itIT\": \"Tharr\",\n",
+                u8"    \"koKR\": \"타르\",\n",
+                u8"    \"plPL\": \"Tharr\",\n",
+                u8"    \"esMX\": \"Tharr\",\n",
+                u8"    \"jaJP\": \"タール\",\n",
+                u8"    \"ptBR\": \"Tarr\",\n",
+                u8"    \"ruRU\": \"Тарр\",\n",
+                u8"    \"zhCN\": \"萨尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10883,\n",
+                u8"    \"Key\": \"MercX149\",\n",
+                u8"    \"enUS\": \"Kaelim\",\n",
+                u8"    \"zhTW\": \"卡林姆\",\n",
+                u8"    \"deDE\": \"Kalim\",\n",
+                u8"    \"esES\": \"Kalim\",\n",
+                u8"    \"frFR\": \"Kaelim\",\n",
+                u8"    \"itIT\": \"Kaelim\",\n",
+                u8"    \"koKR\": \"캘림\",\n",
+                u8"    \"plPL\": \"Kaelim\",\n",
+                u8"    \"esMX\": \"Kaelim\",\n",
+                u8"    \"jaJP\": \"ケイリム\",\n",
+                u8"    \"ptBR\": \"Kaelim\",\n",
+                u8"    \"ruRU\": \"Кэлим\",\n",
+                u8"    \"zhCN\": \"凯林姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10884,\n",
+                u8"    \"Key\": \"MercX150\",\n",
+                u8"    \"enUS\": \"Ulric\",\n",
+                u8"    \"zhTW\": \"烏瑞克\",\n",
+                u8"    \"deDE\": \"lIric\",\n",
+                u8"    \"esES\": \"Ulric\",\n",
+                u8"    \"frFR\": \"Ulric\",\n",
+                u8"    \"itIT\": \"Ulric\",\n",
+                u8"    \"koKR\": \"울릭\",\n",
+                u8"    \"plPL\": \"Ulryk\",\n",
+                u8"    \"esMX\": \"Ulric\",\n",
+                u8"    \"jaJP\": \"ウルリック\",\n",
+                u8"    \"ptBR\": \"Ulric\",\n",
+                u8"    \"ruRU\": \"Ульрик\",\n",
+                u8"    \"zhCN\": \"奥瑞克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10885,\n",
+                u8"    \"Key\": \"MercX151\",\n",
+                u8"    \"enUS\": \"Alaric\",\n",
+                u8"    \"zhTW\": \"艾勒瑞克\",\n",
+                u8"    \"deDE\": \"Aric\",\n",
+                u8"    \"esES\": \"Aric\",\n",
+                u8"    \"frFR\": \"Alaric\",\n",
+                u8"    \"itIT\": \"Alaric\",\n",
+                u8"    \"koKR\": \"알라릭\",\n",
+                u8"    \"plPL\": \"Alaryk\",\n",
+                u8"    \"esMX\": \"Alaric\",\n",
+                u8"    \"jaJP\": \"アラリック\",\n",
+                u8"    \"ptBR\": \"Alaric\",\n",
+                u8"    \"ruRU\": \"Аларик\",\n",
+                u8"    \"zhCN\": \"埃拉里克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10886,\n",
+                u8"    \"Key\": \"MercX152\",\n",
+                u8"    \"enUS\": \"Ethelred\",\n",
+                u8"    \"zhTW\": \"愛瑟瑞德\",\n",
+                u8"    \"deDE\": \"Eleyd\",\n",
+                u8"    \"esES\": \"Eleyd\",\n",
+                u8"    \"frFR\": \"Ethelred\",\n",
+                u8"    \"itIT\": \"Ethelred\",\n",
+                u8"    \"koKR\": \"에텔레드\",\n",
+                u8"    \"plPL\": \"Ethelred\",\n",
+                u8"    \"esMX\": \"Ethelred\",\n",
+                u8"    \"jaJP\": \"エセルレッド\",\n",
+                u8"    \"ptBR\": \"Etelred\",\n",
+                u8"    \"ruRU\": \"Этельред\",\n",
+                u8"    \"zhCN\": \"伊瑟雷德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10887,\n",
+                u8"    \"Key\": \"MercX153\",\n",
+                u8"    \"enUS\": \"Caden\",\n",
+                u8"    \"zhTW\": \"卡登\",\n",
+                u8"    \"deDE\": \"Caden\",\n",
+                u8"    \"esES\": \"Jay\",\n",
+                u8"    \"frFR\": \"Caden\",\n",
+                u8"    \"itIT\": \"Caden\",\n",
+                u8"    \"koKR\": \"카덴\",\n",
+                u8"    \"plPL\": \"Caden\",\n",
+                u8"    \"esMX\": \"Caden\",\n",
+                u8"    \"jaJP\": \"ケイデン\",\n",
+                u8"    \"ptBR\": \"Cáden\",\n",
+                u8"    \"ruRU\": \"Кейден\",\n",
+                u8"    \"zhCN\": \"卡登\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10888,\n",
+                u8"    \"Key\": \"MercX154\",\n",
+                u8"    \"enUS\": \"Elgifu\",\n",
+                u8"    \"zhTW\": \"伊爾吉夫\",\n",
+                u8"    \"deDE\": \"Elgif\",\n",
+                u8"    \"esES\": \"Elgif\",\n",
+                u8"    \"frFR\": \"Elgifu\",\n",
+                u8"    \"itIT\": \"Elgifu\",\n",
+                u8"    \"koKR\": \"엘기푸\",\n",
+                u8"    \"plPL\": \"Elgifu\",\n",
+                u8"    \"esMX\": \"Elgifu\",\n",
+                u8"    \"jaJP\": \"エルギフ\",\n",
+                u8"    \"ptBR\": \"Elguif\",\n",
+                u8"    \"ruRU\": \"Эльгифу\",\n",
+                u8"    \"zhCN\": \"艾尔基弗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10889,\n",
+                u8"    \"Key\": \"MercX155\",\n",
+                u8"    \"enUS\": \"Tostig\",\n",
+                u8"    \"zhTW\": \"托斯提克\",\n",
+                u8"    \"deDE\": \"Aehi\",\n",
+                u8"    \"esES\": \"Aehi\",\n",
+                u8"    \"frFR\": \"Tostig\",\n",
+                u8"    \"itIT\": \"Tostig\",\n",
+                u8"    \"koKR\": \"토스티그\",\n",
+                u8"    \"plPL\": \"Tostig\",\n",
+                u8"    \"esMX\": \"Tostig\",\n",
+                u8"    \"jaJP\": \"トスティグ\",\n",
+                u8"    \"ptBR\": \"Tostig\",\n",
+                u8"    \"ruRU\": \"Тостиг\",\n",
+                u8"    \"zhCN\": \"托斯蒂格\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10890,\n",
+                u8"    \"Key\": \"MercX156\",\n",
+                u8"    \"enUS\": \"Alcuin\",\n",
+                u8"    \"zhTW\": \"艾爾昆\",\n",
+                u8"    \"deDE\": \"JIuni\",\n",
+                u8"    \"esES\": \"Alcun\",\n",
+                u8"    \"frFR\": \"Alcuin\",\n",
+                u8"    \"itIT\": \"Alcuin\",\n",
+                u8"    \"koKR\": \"알쿠인\",\n",
+                u8"    \"plPL\": \"Alcuin\",\n",
+                u8"    \"esMX\": \"Alcuin\",\n",
+                u8"    \"jaJP\": \"アルクイン\",\n",
+                u8"    \"ptBR\": \"Alquin\",\n",
+                u8"    \"ruRU\": \"Алкуин\",\n",
+                u8"    \"zhCN\": \"奥尔奎因\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10891,\n",
+                u8"    \"Key\": \"MercX157\",\n",
+                u8"    \"enUS\": \"Emund\",\n",
+                u8"    \"zhTW\": \"艾蒙特\",\n",
+                u8"    \"deDE\": \"Emund\",\n",
+                u8"    \"esES\": \"Emund\",\n",
+                u8"    \"frFR\": \"Emund\",\n",
+                u8"    \"itIT\": \"Emund\",\n",
+                u8"    \"koKR\": \"에먼드\",\n",
+                u8"    \"plPL\": \"Emund\",\n",
+                u8"    \"esMX\": \"Emund\",\n",
+                u8"    \"jaJP\": \"エムンド\",\n",
+                u8"    \"ptBR\": \"Emund\",\n",
+                u8"    \"ruRU\": \"Эмунд\",\n",
+                u8"    \"zhCN\": \"埃蒙德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10892,\n",
+                u8"    \"Key\": \"MercX158\",\n",
+                u8"    \"enUS\": \"Sigurd\",\n",
+                u8"    \"zhTW\": \"希格爾德\",\n",
+                u8"    \"deDE\": \"Sigud\",\n",
+                u8"    \"esES\": \"Sigud\",\n",
+                u8"    \"frFR\": \"Sigurd\",\n",
+                u8"    \"itIT\": \"Sigurd\",\n",
+                u8"    \"koKR\": \"시구르드\",\n",
+                u8"    \"plPL\": \"Sigurd\",\n",
+                u8"    \"esMX\": \"Sigurd\",\n",
+                u8"    \"jaJP\": \"シグルド\",\n",
+                u8"    \"ptBR\": \"Sigurd\",\n",
+                u8"    \"ruRU\": \"Сигурд\",\n",
+                u8"    \"zhCN\": \"西古德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10893,\n",
+                u8"    \"Key\": \"MercX159\",\n",
+                u8"    \"enUS\": \"Gorm\",\n",
+                u8"    \"zhTW\": \"格姆\",\n",
+                u8"    \"deDE\": \"Gorm\",\n",
+                u8"    \"esES\": \"Gorm\",\n",
+                u8"    \"frFR\": \"Gorm\",\n",
+                u8"    \"itIT\": \"Gorm\",\n",
+                u8"    \"koKR\": \"고름\",\n",
+                u8"    \"plPL\": \"Gorm\",\n",
+                u8"    \"esMX\": \"Gorm\",\n",
+                u8"    \"jaJP\": \"ゴルム\",\n",
+                u8"    \"ptBR\": \"Gorm\",\n",
+                u8"    \"ruRU\": \"Горм\",\n",
+                u8"    \"zhCN\": \"戈姆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10894,\n",
+                u8"    \"Key\": \"MercX160\",\n",
+                u8"    \"enUS\": \"Hollis\",\n",
+                u8"    \"zhTW\": \"荷理斯\",\n",
+                u8"    \"deDE\": \"Holis\",\n",
+                u8"    \"esES\": \"Holis\",\n",
+                u8"    \"frFR\": \"Hollis\",\n",
+                u8"    \"itIT\": \"Hollis\",\n",
+                u8"    \"koKR\": \"홀리스\",\n",
+                u8"    \"plPL\": \"Hollis\",\n",
+                u8"    \"esMX\": \"Hollis\",\n",
+                u8"    \"jaJP\": \"ホリス\",\n",
+                u8"    \"ptBR\": \"Ollis\",\n",
+                u8"    \"ruRU\": \"Холлис\",\n",
+                u8"    \"zhCN\": \"霍利斯\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10895,\n",
+                u8"    \"Key\": \"MercX161\",\n",
+                u8"    \"enUS\": \"Ragnar\",\n",
+                u8"    \"zhTW\": \"拉格那\",\n",
+                u8"    \"deDE\": \"Rinar\",\n",
+                u8"    \"esES\": \"Ranar\",\n",
+                u8"    \"frFR\": \"Ragnar\",\n",
+                u8"    \"itIT\": \"Ragnar\",\n",
+                u8"    \"koKR\": \"라그나르\",\n",
+                u8"    \"plPL\": \"Ragnar\",\n",
+                u8"    \"esMX\": \"Ragnar\",\n",
+                u8"    \"jaJP\": \"ラグナル\",\n",
+                u8"    \"ptBR\": \"Ragnar\",\n",
+                u8"    \"ruRU\": \"Рагнар\",\n",
+                u8"    \"zhCN\": \"拉格纳\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10896,\n",
+                u8"    \"Key\": \"MercX162\",\n",
+                u8"    \"enUS\": \"Torkel\",\n",
+                u8"    \"zhTW\": \"托克爾\",\n",
+                u8"    \"deDE\": \"Tokel\",\n",
+                u8"    \"esES\": \"Tokel\",\n",
+                u8"    \"frFR\": \"Torkel\",\n",
+                u8"    \"itIT\": \"Torkel\",\n",
+                u8"    \"koKR\": \"토르켈\",\n",
+                u8"    \"plPL\": \"Torkel\",\n",
+                u8"    \"esMX\": \"Torkel\",\n",
+                u8"    \"jaJP\": \"トルケル\",\n",
+                u8"    \"ptBR\": \"Torkel\",\n",
+                u8"    \"ruRU\": \"Торкель\",\n",
+                u8"    \"zhCN\": \"托克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10897,\n",
+                u8"    \"Key\": \"MercX163\",\n",
+                u8"    \"enUS\": \"Wulfstan\",\n",
+                u8"    \"zhTW\": \"沃夫斯坦\",\n",
+                u8"    \"deDE\": \"Juan\",\n",
+                u8"    \"esES\": \"Wuan\",\n",
+                u8"    \"frFR\": \"Wulfstan\",\n",
+                u8"    \"itIT\": \"Wulfstan\",\n",
+                u8"    \"koKR\": \"울프스탄\",\n",
+                u8"    \"plPL\": \"Wulfstan\",\n",
+                u8"    \"esMX\": \"Wulfstan\",\n",
+                u8"    \"jaJP\": \"ウルフスタン\",\n",
+                u8"    \"ptBR\": \"Wulfstan\",\n",
+                u8"    \"ruRU\": \"Вульфстан\",\n",
+                u8"    \"zhCN\": \"沃夫斯坦\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10898,\n",
+                u8"    \"Key\": \"MercX164\",\n",
+                u8"    \"enUS\": \"Alban\",\n",
+                u8"    \"zhTW\": \"阿爾班\",\n",
+                u8"    \"deDE\": \"llbin\",\n",
+                u8"    \"esES\": \"Alban\",\n",
+                u8"    \"frFR\": \"Alban\",\n",
+                u8"    \"itIT\": \"Alban\",\n",
+                u8"    \"koKR\": \"알반\",\n",
+                u8"    \"plPL\": \"Alban\",\n",
+                u8"    \"esMX\": \"Alban\",\n",
+                u8"    \"jaJP\": \"アルバン\",\n",
+                u8"    \"ptBR\": \"Alban\",\n",
+                u8"    \"ruRU\": \"Альбан\",\n",
+                u8"    \"zhCN\": \"阿尔班\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10899,\n",
+                u8"    \"Key\": \"MercX165\",\n",
+                u8"    \"enUS\": \"Barloc\",\n",
+                u8"    \"zhTW\": \"巴洛克\",\n",
+                u8"    \"deDE\": \"Jiloc\",\n",
+                u8"    \"esES\": \"Jiloc\",\n",
+                u8"    \"frFR\": \"Barloc\",\n",
+                u8"    \"itIT\": \"Barloc\",\n",
+                u8"    \"koKR\": \"발록\",\n",
+                u8"    \"plPL\": \"Barloc\",\n",
+                u8"    \"esMX\": \"Barloc\",\n",
+                u8"    \"jaJP\": \"バルロック\",\n",
+                u8"    \"ptBR\": \"Barloc\",\n",
+                u8"    \"ruRU\": \"Барлок\",\n",
+                u8"    \"zhCN\": \"巴洛克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10900,\n",
+                u8"    \"Key\": \"MercX166\",\n",
+                u8"    \"enUS\": \"Bill\",\n",
+                u8"    \"zhTW\": \"比爾\",\n",
+                u8"    \"deDE\": \"Pinne\",\n",
+                u8"    \"esES\": \"Pinne\",\n",
+                u8"    \"frFR\": \"Bill\",\n",
+                u8"    \"itIT\": \"Bill\",\n",
+                u8"    \"koKR\": \"빌\",\n",
+                u8"    \"plPL\": \"Bill\",\n",
+                u8"    \"esMX\": \"Bill\",\n",
+                u8"    \"jaJP\": \"ビル\",\n",
+                u8"    \"ptBR\": \"Bill\",\n",
+                u8"    \"ruRU\": \"Билл\",\n",
+                u8"    \"zhCN\": \"比尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10901,\n",
+                u8"    \"Key\": \"MercX167\",\n",
+                u8"    \"enUS\": \"Theodoric\",\n",
+                u8"    \"zhTW\": \"狄奧多理\",\n",
+                u8"    \"deDE\": \"Odric\",\n",
+                u8"    \"esES\": \"Odric\",\n",
+                u8"    \"frFR\": \"Théodoric\",\n",
+                u8"    \"itIT\": \"Theodoric\",\n",
+                u8"    \"koKR\": \"테오도릭\",\n",
+                u8"    \"plPL\": \"Theodoryk\",\n",
+                u8"    \"esMX\": \"Teodoric\",\n",
+                u8"    \"jaJP\": \"セオドリック\",\n",
+                u8"    \"ptBR\": \"Theodoric\",\n",
+                u8"    \"ruRU\": \"Теодорик\",\n",
+                u8"    \"zhCN\": \"瑟多里克\"\n",
+                u8"  }\n",
+                u8"]\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
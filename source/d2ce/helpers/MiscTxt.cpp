@@ -18,174 +18,170 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetMisc()
+        EmbeddedText GetMisc()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"name\tcompactsave\tversion\tlevel\tShowLevel\tlevelreq\treqstr\treqdex\trarity\tspawnable\tspeed\tnodurability\tcost\tgamble cost\tcode\talternategfx\tnamestr\tcomponent\tinvwidth\tinvheight\thasinv\tgemsockets\tgemapplytype\tflippyfile\tinvfile\tuniqueinvfile\tTransmogrify\tTMogType\tTMogMin\tTMogMax\tuseable\ttype\ttype2\tdropsound\tdropsfxframe\tusesound\tunique\ttransparent\ttranstbl\tlightradius\tbelt\tautobelt\tstackable\tminstack\tmaxstack\tspawnstack\tquest\tquestdiffcheck\tmissiletype\tspellicon\tpSpell\tstate\tcstate1\tcstate2\tlen\tstat1\tcalc1\tstat2\tcalc2\tstat3\tcalc3\tspelldesc\tspelldescstr\tspelldescstr2\tspelldesccalc\tspelldesccolor\tdurwarning\tqntwarning\tgemoffset\tBetterGem\tbitfield1\tCharsiMin\tCharsiMax\tCharsiMagicMin\tCharsiMagicMax\tCharsiMagicLvl\tGheedMin\tGheedMax\tGheedMagicMin\tGheedMagicMax\tGheedMagicLvl\tAkaraMin\tAkaraMax\tAkaraMagicMin\tAkaraMagicMax\tAkaraMagicLvl\tFaraMin\tFaraMax\tFaraMagicMin\tFaraMagicMax\tFaraMagicLvl\tLysanderMin\tLysanderMax\tLysanderMagicMin\tLysanderMagicMax\tLysanderMagicLvl\tDrognanMin\tDrognanMax\tDrognanMagicMin\tDrognanMagicMax\tDrognanMagicLvl\tHratliMin\tHratliMax\tHratliMagicMin\tHratliMagicMax\tHratliMagicLvl\tAlkorMin\tAlkorMax\tAlkorMagicMin\tAlkorMagicMax\tAlkorMagicLvl\tOrmusMin\tOrmusMax\tOrmusMagicMin\tOrmusMagicMax\tOrmusMagicLvl\tElzixMin\tElzixMax\tElzixMagicMin\tElzixMagicMax\tElzixMagicLvl\tAshearaMin\tAshearaMax\tAshearaMagicMin\tAshearaMagicMax\tAshearaMagicLvl\tCainMin\tCainMax\tCainMagicMin\tCainMagicMax\tCainMagicLvl\tHalbuMin\tHalbuMax\tHalbuMagicMin\tHalbuMagicMax\tHalbuMagicLvl\tMalahMin\tMalahMax\tMalahMagicMin\tMalahMagicMax\tMalahMagicLvl\tLarzukMin\tLarzukMax\tLarzukMagicMin\tLarzukMagicMax\tLarzukMagicLvl\tAnyaMin\tAnyaMax\tAnyaMagicMin\tAnyaMagicMax\tAnyaMagicLvl\tJamellaMin\tJamellaMax\tJamellaMagicMin\tJamellaMagicMax\tJamellaMagicLvl\tTransform\tInvTrans\tSkipName\tNightmareUpgrade\tHellUpgrade\tmindam\tmaxdam\tPermStoreItem\tmultibuy\tNameable\tdiablocloneweight\n";
-                ss << u8"Elixir\t1\t0\t21\t0\t0\t\t\t4\t1\t0\t1\t20\t\telx\telx\telx\t16\t1\t1\t0\t0\t0\tflppot\tinvpot\t\t0\txxx\t\t\t1\telix\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t8\t\t\t\t\texperience\t5\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t30\t\thpo\thpo\thpo\t16\t1\t1\t0\t0\t0\tflprps\tinvrps\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t30\t\tmpo\tmpo\tmpo\t16\t1\t1\t0\t0\t0\tflpbps\tinvbps\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Full Healing Potion\t1\t0\t0\t0\t0\t\t\t2\t0\t0\t1\t150\t\thpf\thpo\thpf\t16\t1\t1\t0\t0\t0\tflprpl\tinvrpl\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Full Mana Potion\t1\t0\t0\t0\t0\t\t\t2\t0\t0\t1\t150\t\tmpf\tmpo\tmpf\t16\t1\t1\t0\t0\t0\tflpbpl\tinvbpl\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Stamina Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t25\t\tvps\tvps\tvps\t16\t1\t1\t0\t0\t0\tflpwps\tinvwps\t\t0\txxx\t\t\t1\tspot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t9\tstaminapot\t\t\t750\tstaminarecoverybonus\t5000\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t\t\t255\t\t\t\t\t255\t3\t5\t3\t5\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Antidote Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t40\t\typs\typs\typs\t16\t1\t1\t0\t0\t0\tflpnps\tinvnps\t\t0\txxx\t\t\t1\tapot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t6\tantidote\tpoison\t\t750\tpoisonresist\t50\tmaxpoisonresist\t10\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t\t\t255\t\t\t\t\t255\t9\t15\t9\t15\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t11\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t11\t\t\t255\t\t\t\t\t255\t3\t5\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Rejuvenation Potion\t1\t0\t0\t0\t0\t\t\t2\t0\t0\t1\t400\t\trvs\typs\trvs\t16\t1\t1\t0\t0\t0\tflpvps\tinvvps\t\t0\txxx\t\t\t1\trpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t5\t\t\t\t\thitpoints\t35\tmana\t35\t\t\t4\tItemStatsrejuv1\t\t35\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Full Rejuvenation Potion\t1\t0\t0\t0\t0\t\t\t2\t0\t0\t1\t1500\t\trvl\typl\trvl\t16\t1\t1\t0\t0\t0\tflpvpl\tinvvpl\t\t0\txxx\t\t\t1\trpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t5\t\t\t\t\thitpoints\t100\tmana\t100\t\t\t4\tItemStatsrejuv1\t\t100\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Thawing Potion\t1\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t25\t\twms\typs\twms\t16\t1\t1\t0\t0\t0\tflpyps\tinvyps\t\t0\txxx\t\t\t1\twpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t6\tthawing\tfreeze\tcold\t750\tcoldresist\t50\tmaxcoldresist\t10\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t3\t5\t3\t5\t255\t\t\t\t\t255\t\t\t\t\t255\t6\t9\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t6\t9\t\t\t255\t\t\t\t\t255\t2\t4\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Tome of Town Portal\t0\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t250\t\ttbk\tbbk\ttbk\t16\t1\t2\t0\t0\t0\tflpbbk\tinvbbk\t\t0\txxx\t\t\t1\tbook\t\titem_book\t12\titem_book\t0\t0\t5\t0\t0\t0\t1\t1\t20\t5\t\t\t0\t-1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t2\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t\t\t\n";
-                ss << u8"Tome of Identify\t0\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t200\t\tibk\trbk\tibk\t16\t1\t2\t0\t0\t0\tflprbk\tinvrbk\t\t0\txxx\t\t\t1\tbook\t\titem_book\t12\titem_book\t0\t0\t5\t0\t0\t0\t1\t1\t20\t5\t\t\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t2\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t\t\t\n";
-                ss << u8"Amulet\t0\t0\t1\t0\t0\t\t\t4\t1\t0\t1\t2400\t63000\tamu\tamu\tamu\t16\t1\t1\t1\t1\t1\tflpamu\tinvamu\t\t0\txxx\t\t\t0\tamul\t\titem_amulet\t12\titem_amulet\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Amulet of the Viper\t0\t0\t15\t0\t0\t\t\t4\t0\t0\t1\t400\t\tvip\tvip\tvip\t16\t1\t1\t0\t0\t0\tflpamu\tinvvip\tinvvip\t0\txxx\t\t\t0\tamul\t\titem_amulet\t12\titem_amulet\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t10\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t1\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ring\t0\t0\t1\t0\t0\t\t\t4\t1\t0\t1\t1800\t50000\trin\trin\trin\t16\t1\t1\t1\t1\t1\tflprin\tinvrin\t\t0\txxx\t\t\t0\tring\t\titem_ring\t12\titem_ring\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Gold\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t0\t\tgld\tgld\tgld\t16\t1\t1\t0\t0\t0\tflpgld\tinvgld\t\t0\txxx\t\t\t0\tgold\t\titem_gold\t12\titem_gold\t0\t0\t5\t0\t0\t0\t1\t0\t5000\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Scroll of Inifuss\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t100\t\tbks\tbks\tbks\t16\t2\t2\t0\t0\t0\tflpscr\tinvscb\t\t0\txxx\t\t\t1\tques\t\titem_scroll\t10\titem_scroll\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t5\t1\t0\t-1\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Key to the Cairn Stones\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t12000\t\tbkd\tbkd\tbkd\t16\t2\t2\t0\t0\t0\tflpscr\tinvscb\t\t0\txxx\t\t\t1\tques\t\titem_scroll\t10\titem_scroll\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t5\t1\t0\t-1\t14\t\t\t\t\t\t\t\t\t\t\t1\tReadScroll\tReadScrollController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Arrows\t0\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t256\t\taqv\taqv\taqv\t16\t1\t3\t0\t0\t0\tflpqvr\tinvqvr\t\t0\txxx\t\t\t0\tbowq\t\titem_quiver\t12\titem_quiver\t0\t0\t5\t0\t0\t0\t1\t150\t500\t250\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t0\tnon\t0\t3\t5\t\t\t255\t1\t3\t\t\t255\t\t\t\t\t255\t3\t4\t3\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t4\t3\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t2\t3\t\t\t255\t\t\t\t\t255\t3\t4\t\t\t255\t\t\t\t\t255\t3\t4\t\t\t255\t3\t4\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t\t\t\n";
-                ss << u8"Torch\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t50\t\ttch\tbsh\ttch\t7\t1\t2\t0\t0\t0\tflptrch\tinvtrch\t\t0\txxx\t\t\t0\ttorc\t\titem_staff\t12\titem_staff\t0\t1\t3\t6\t0\t0\t0\t2\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Bolts\t0\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t256\t\tcqv\tcqv\tcqv\t16\t1\t3\t0\t0\t0\tflpqvr\tinvcqv\t\t0\txxx\t\t\t0\txboq\t\titem_quiver\t12\titem_quiver\t0\t0\t5\t0\t0\t0\t1\t150\t500\t250\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t0\tnon\t0\t2\t4\t\t\t255\t2\t4\t\t\t255\t\t\t\t\t255\t3\t4\t3\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t4\t3\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t2\t3\t\t\t255\t\t\t\t\t255\t3\t4\t\t\t255\t\t\t\t\t255\t3\t4\t\t\t255\t3\t4\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t\t\t\n";
-                ss << u8"Scroll of Town Portal\t1\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t100\t\ttsc\tbsc\ttsc\t16\t1\t1\t0\t0\t0\tflpbsc\tinvbsc\t\t0\txxx\t\t\t1\tscro\t\titem_scroll\t10\titem_scroll\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t11\t17\t255\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t11\t17\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t7\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t7\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Scroll of Identify\t1\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t80\t\tisc\trsc\tisc\t16\t1\t1\t0\t0\t0\tflprsc\tinvrsc\t\t0\txxx\t\t\t1\tscro\t\titem_scroll\t10\titem_scroll\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t11\t17\t255\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t11\t17\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t7\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t7\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Heart\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t60\t\thrt\thrt\thrt\t16\t1\t1\t0\t0\t0\tflphrt\tinvhrt\t\t1\thpo\t0\t0\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Brain\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t60\t\tbrz\tbrz\tbrz\t16\t1\t1\t0\t0\t0\tflpbrnz\tinvbrnz\t\t1\topm\t1\t1\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Jawbone\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t75\t\tjaw\tjaw\tjaw\t16\t1\t1\t0\t0\t0\tflpjaw\tinvjaw\t\t1\tcqv\t10\t40\t0\tbody\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Eye\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t45\t\teyz\teyz\teyz\t16\t1\t1\t0\t0\t0\tflpeye\tinveye\t\t1\tmpo\t0\t0\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Horn\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t48\t\thrn\thrn\thrn\t16\t1\t1\t0\t0\t0\tflphorn\tinvhorn\t\t1\taqv\t10\t40\t0\tbody\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Tail\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t63\t\ttal\ttal\ttal\t16\t1\t1\t0\t0\t0\tflptail\tinvtail\t\t1\tvps\t0\t0\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flag\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t98\t\tflg\tflg\tflg\t16\t1\t1\t0\t0\t0\tflpflag\tinvflag\t\t0\txxx\t\t\t0\tbody\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Fang\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t80\t\tfng\tfng\tfng\t16\t1\t1\t0\t0\t0\tflpfang\tinvfang\t\t1\tkey\t1\t1\t0\tbody\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Quill\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t32\t\tqll\tqll\tqll\t16\t1\t1\t0\t0\t0\tflpquil\tinvquil\t\t1\taqv\t10\t40\t0\tbody\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Soul\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\tsol\tsol\tsol\t16\t1\t1\t0\t0\t0\tflpsple\tinvsple\t\t1\tmpo\t0\t0\t0\tbody\t\titem_rare\t12\t\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Scalp\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t40\t\tscz\tscz\tscz\t16\t1\t1\t0\t0\t0\tflpscp\tinvscp\t\t1\thpf\t0\t0\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Spleen\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t85\t\tspe\tspe\tspe\t16\t1\t1\t0\t0\t0\tflpsple\tinvsple\t\t1\tgps\t1\t1\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Key\t0\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t45\t\tkey\tkey\tkey\t16\t1\t1\t0\t0\t0\tflpkey\tinvkey\t\t0\txxx\t\t\t0\tkey\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t1\t1\t12\t6\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t5\t9\t5\t9\t255\t1\t2\t1\t2\t255\t\t\t\t\t255\t6\t9\t6\t9\t255\t\t\t\t\t255\t2\t3\t2\t3\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t2\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"The Black Tower Key\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t99999\t\tluv\tkey\tluv\t16\t1\t2\t0\t0\t0\tflpmph\tinvmph\t\t0\txxx\t\t\t0\tkey\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t20\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Potion of Life\t0\t0\t0\t0\t0\t\t\t999\t0\t0\t1\t10000\t\txyz\tscr\txyz\t16\t1\t1\t0\t0\t0\tflpwps\tinvxyz\t\t0\txxx\t\t\t1\tques\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t19\t1\t0\t-1\t11\t\t\t\t\t\t\t\t\t\t\t1\tUsePotionOfLife\tUsePotionOfLifeController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"A Jade Figurine\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t100\t\tj34\tbks\tj34\t16\t1\t2\t0\t0\t0\tflpjbi\tinvjbi\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\t\t1\t0\t3\t0\t0\t0\t0\t0\t0\t0\t19\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"The Golden Bird\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t100\t\tg34\tbks\tg34\t16\t1\t2\t0\t0\t0\tflpgbi\tinvgbi\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\t\t1\t0\t4\t0\t0\t0\t0\t0\t0\t0\t19\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Lam Esen's Tome\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t100\t\tbbb\tbbb\tbbb\t16\t2\t2\t0\t0\t0\tflpbbb\tinvbbb\t\t0\txxx\t\t\t0\tques\t\titem_book\t12\titem_book\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t16\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Horadric Cube\t0\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t0\t\tbox\trbk\tbox\t16\t2\t2\t0\t0\t0\tflpbox\tinvbox\t\t0\txxx\t\t\t1\tques\t\titem_rare\t12\t\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t10\t\t0\t-1\t7\t\t\t\t\t\t\t\t\t\t\t1\tOpenHoradricCube\tOpenHoradricCubeController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Horadric Scroll\t1\t0\t0\t0\t0\t\t\t999\t0\t0\t1\t0\t\ttr1\tgrg\ttr1\t16\t2\t2\t0\t0\t0\tflphscr\tinvhscr\t\t0\txxx\t\t\t0\tques\t\titem_book\t12\titem_book\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t10\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Mephisto's Soulstone\t1\t0\t0\t0\t0\t\t\t999\t0\t0\t1\t0\t\tmss\tscr\tmss\t16\t1\t1\t0\t0\t0\tflpmss\tinvmss\t\t0\txxx\t\t\t0\tques\t\titem_gem\t12\titem_gem\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t25\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Book of Skill\t1\t0\t0\t0\t0\t\t\t999\t0\t0\t1\t0\t\tass\ttbk\tass\t16\t2\t2\t0\t0\t0\tflpbbk\tinvsbk\t\t0\txxx\t\t\t1\tques\t\titem_book\t12\titem_book\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t15\t1\t0\t-1\t10\t\t\t\t\t\t\t\t\t\t\t1\tUseBookOfSkill\tUseBookOfSkillController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Khalim's Eye\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t45\t\tqey\teyz\tqey\t16\t1\t1\t0\t0\t0\tflpeye\tinveye\t\t0\txxx\t\t\t0\tques\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t17\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Khalim's Heart\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t60\t\tqhr\thrt\tqhr\t16\t1\t1\t0\t0\t0\tflphrt\tinvhrt\t\t0\txxx\t\t\t0\tques\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t17\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Khalim's Brain\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t60\t\tqbr\tbrz\tqbr\t16\t1\t1\t0\t0\t0\tflpbrnz\tinvbrnz\t\t0\txxx\t\t\t0\tques\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t17\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ear\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t0\t\tear\tear\tear\t16\t1\t1\t0\t0\t0\tflpear\tinvear\t\t0\txxx\t\t\t0\tplay\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Chipped Amethyst\t1\t0\t0\t0\t1\t\t\t2\t1\t0\t1\t500\t\tgcv\tgcv\tgcv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsva\t\t0\txxx\t\t\t0\tgema\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfv\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawed Amethyst\t1\t0\t0\t0\t5\t\t\t3\t1\t0\t1\t1500\t\tgfv\tgfv\tgfv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsvb\t\t0\txxx\t\t\t0\tgema\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsv\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Amethyst\t1\t0\t0\t0\t12\t\t\t4\t1\t0\t1\t5000\t\tgsv\tgsv\tgsv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsvc\t\t0\txxx\t\t\t0\tgema\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgzv\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawless Amethyst\t1\t0\t0\t0\t15\t\t\t5\t1\t0\t1\t15000\t\tgzv\tgzv\tgzv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsvd\t\t0\txxx\t\t\t0\tgema\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpv\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Perfect Amethyst\t1\t0\t0\t0\t18\t\t\t6\t1\t0\t1\t30000\t\tgpv\tgpv\tgpv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsve\t\t0\txxx\t\t\t0\tgema\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Chipped Topaz\t1\t0\t0\t0\t1\t\t\t3\t1\t0\t1\t500\t\tgcy\tgcy\tgcy\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsya\t\t0\txxx\t\t\t0\tgemt\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfy\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawed Topaz\t1\t0\t0\t0\t5\t\t\t4\t1\t0\t1\t1500\t\tgfy\tgfy\tgfy\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsyb\t\t0\txxx\t\t\t0\tgemt\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsy\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Topaz\t1\t0\t0\t0\t12\t\t\t5\t1\t0\t1\t5000\t\tgsy\tgsy\tgsy\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsyc\t\t0\txxx\t\t\t0\tgemt\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgly\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawless Topaz\t1\t0\t0\t0\t15\t\t\t6\t1\t0\t1\t15000\t\tgly\tgly\tgly\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsyd\t\t0\txxx\t\t\t0\tgemt\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpy\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Perfect Topaz\t1\t0\t0\t0\t18\t\t\t7\t1\t0\t1\t30000\t\tgpy\tgpy\tgpy\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsye\t\t0\txxx\t\t\t0\tgemt\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Chipped Sapphire\t1\t0\t0\t0\t1\t\t\t4\t1\t0\t1\t500\t\tgcb\tgcb\tgcb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsba\t\t0\txxx\t\t\t0\tgems\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfb\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawed Sapphire\t1\t0\t0\t0\t5\t\t\t5\t1\t0\t1\t1500\t\tgfb\tgfb\tgfb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsbb\t\t0\txxx\t\t\t0\tgems\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsb\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Sapphire\t1\t0\t0\t0\t12\t\t\t6\t1\t0\t1\t5000\t\tgsb\tgsb\tgsb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsbc\t\t0\txxx\t\t\t0\tgems\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tglb\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawless Sapphire\t1\t0\t0\t0\t15\t\t\t7\t1\t0\t1\t15000\t\tglb\tglb\tglb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsbd\t\t0\txxx\t\t\t0\tgems\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpb\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Perfect Sapphire\t1\t0\t0\t0\t18\t\t\t8\t1\t0\t1\t30000\t\tgpb\tgpb\tgpb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsbe\t\t0\txxx\t\t\t0\tgems\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Chipped Emerald\t1\t0\t0\t0\t1\t\t\t5\t1\t0\t1\t500\t\tgcg\tgcg\tgcg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsga\t\t0\txxx\t\t\t0\tgeme\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfg\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawed Emerald\t1\t0\t0\t0\t5\t\t\t6\t1\t0\t1\t1500\t\tgfg\tgfg\tgfg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsgb\t\t0\txxx\t\t\t0\tgeme\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsg\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Emerald\t1\t0\t0\t0\t12\t\t\t7\t1\t0\t1\t5000\t\tgsg\tgsg\tgsg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsgc\t\t0\txxx\t\t\t0\tgeme\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tglg\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawless Emerald\t1\t0\t0\t0\t15\t\t\t8\t1\t0\t1\t15000\t\tglg\tglg\tglg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsgd\t\t0\txxx\t\t\t0\tgeme\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpg\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Perfect Emerald\t1\t0\t0\t0\t18\t\t\t9\t1\t0\t1\t30000\t\tgpg\tgpg\tgpg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsge\t\t0\txxx\t\t\t0\tgeme\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Chipped Ruby\t1\t0\t0\t0\t1\t\t\t6\t1\t0\t1\t500\t\tgcr\tgcr\tgcr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsra\t\t0\txxx\t\t\t0\tgemr\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfr\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawed Ruby\t1\t0\t0\t0\t5\t\t\t7\t1\t0\t1\t1500\t\tgfr\tgfr\tgfr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsrb\t\t0\txxx\t\t\t0\tgemr\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsr\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ruby\t1\t0\t0\t0\t12\t\t\t8\t1\t0\t1\t5000\t\tgsr\tgsr\tgsr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsrc\t\t0\txxx\t\t\t0\tgemr\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tglr\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawless Ruby\t1\t0\t0\t0\t15\t\t\t9\t1\t0\t1\t15000\t\tglr\tglr\tglr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsrd\t\t0\txxx\t\t\t0\tgemr\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpr\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Perfect Ruby\t1\t0\t0\t0\t18\t\t\t10\t1\t0\t1\t30000\t\tgpr\tgpr\tgpr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsre\t\t0\txxx\t\t\t0\tgemr\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Chipped Diamond\t1\t0\t0\t0\t1\t\t\t7\t1\t0\t1\t500\t\tgcw\tgcw\tgcw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswa\t\t0\txxx\t\t\t0\tgemd\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfw\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawed Diamond\t1\t0\t0\t0\t5\t\t\t8\t1\t0\t1\t1500\t\tgfw\tgfw\tgfw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswb\t\t0\txxx\t\t\t0\tgemd\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsw\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Diamond\t1\t0\t0\t0\t12\t\t\t9\t1\t0\t1\t5000\t\tgsw\tgsw\tgsw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswc\t\t0\txxx\t\t\t0\tgemd\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tglw\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawless Diamond\t1\t0\t0\t0\t15\t\t\t10\t1\t0\t1\t15000\t\tglw\tglw\tglw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswd\t\t0\txxx\t\t\t0\tgemd\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpw\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Perfect Diamond\t1\t0\t0\t0\t18\t\t\t11\t1\t0\t1\t30000\t\tgpw\tgpw\tgpw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswe\t\t0\txxx\t\t\t0\tgemd\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Minor Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t30\t\thp1\thp1\thp1\t16\t1\t1\t0\t0\t0\tflprps\tinvhp1\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t192\thpregen\t30\t\t\t\t\t2\tItemStats1q\t\t30\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\thp4\thp5\t\t\t1\t1\t\t\n";
-                ss << u8"Light Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t75\t\thp2\thp2\thp2\t16\t1\t1\t0\t0\t0\tflprps\tinvhp2\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t160\thpregen\t60\t\t\t\t\t2\tItemStats1q\t\t60\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\thp4\thp5\t\t\t1\t1\t\t\n";
-                ss << u8"Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t125\t\thp3\thp3\thp3\t16\t1\t1\t0\t0\t0\tflprps\tinvhp3\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t171\thpregen\t100\t\t\t\t\t2\tItemStats1q\t\t100\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\thp4\thp5\t\t\t1\t1\t\t\n";
-                ss << u8"Greater Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t250\t\thp4\thp4\thp4\t16\t1\t1\t0\t0\t0\tflprpl\tinvhp4\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t192\thpregen\t180\t\t\t\t\t2\tItemStats1q\t\t180\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\txxx\thp5\t\t\t1\t1\t\t\n";
-                ss << u8"Super Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t500\t\thp5\thp5\thp5\t16\t1\t1\t0\t0\t0\tflprpl\tinvhp5\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t256\thpregen\t320\t\t\t\t\t2\tItemStats1q\t\t320\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Minor Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t60\t\tmp1\tmp1\tmp1\t16\t1\t1\t0\t0\t0\tflpbps\tinvmp1\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t20\t\t\t\t\t2\tItemStats1q\t\t20\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\tmp4\tmp5\t\t\t1\t1\t\t\n";
-                ss << u8"Light Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t150\t\tmp2\tmp2\tmp2\t16\t1\t1\t0\t0\t0\tflpbps\tinvmp2\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t40\t\t\t\t\t2\tItemStats1q\t\t40\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\tmp4\tmp5\t\t\t1\t1\t\t\n";
-                ss << u8"Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t300\t\tmp3\tmp3\tmp3\t16\t1\t1\t0\t0\t0\tflpbps\tinvmp3\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t80\t\t\t\t\t2\tItemStats1q\t\t80\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\tmp4\tmp5\t\t\t1\t1\t\t\n";
-                ss << u8"Greater Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t500\t\tmp4\tmp4\tmp4\t16\t1\t1\t0\t0\t0\tflpbpl\tinvmp4\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t150\t\t\t\t\t2\tItemStats1q\t\t150\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\txxx\tmp5\t\t\t1\t1\t\t\n";
-                ss << u8"Super Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t1000\t\tmp5\tmp5\tmp5\t16\t1\t1\t0\t0\t0\tflpbpl\tinvmp5\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t250\t\t\t\t\t2\tItemStats1q\t\t250\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n";
-                ss << u8"Chipped Skull\t1\t0\t0\t0\t1\t\t\t8\t1\t0\t1\t1000\t\tskc\tskc\tskc\t16\t1\t1\t0\t0\t0\tflpskl\tinvskc\t\t0\txxx\t\t\t0\tgemz\tgem0\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tskf\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawed Skull\t1\t0\t0\t0\t5\t\t\t9\t1\t0\t1\t3000\t\tskf\tskf\tskf\t16\t1\t1\t0\t0\t0\tflpskl\tinvskf\t\t0\txxx\t\t\t0\tgemz\tgem1\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tsku\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Skull\t1\t0\t0\t0\t12\t\t\t10\t1\t0\t1\t10000\t\tsku\tsku\tsku\t16\t1\t1\t0\t0\t0\tflpskl\tinvsku\t\t0\txxx\t\t\t0\tgemz\tgem2\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tskl\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Flawless Skull\t1\t0\t0\t0\t15\t\t\t11\t1\t0\t1\t30000\t\tskl\tskl\tskl\t16\t1\t1\t0\t0\t0\tflpskl\tinvskl\t\t0\txxx\t\t\t0\tgemz\tgem3\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tskz\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Perfect Skull\t1\t0\t0\t0\t18\t\t\t12\t1\t0\t1\t100000\t\tskz\tskz\tskz\t16\t1\t1\t0\t0\t0\tflpskl\tinvskz\t\t0\txxx\t\t\t0\tgemz\tgem4\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                ss << u8"Herb\t0\t100\t3\t0\t0\t\t\t3\t0\t0\t1\t75\t\thrb\thrb\thrb\t16\t1\t1\t0\t0\t0\tflphrb\tinvhrb\t\t0\txxx\t\t\t1\therb\t\titem_herb\t12\titem_herb\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t10\tinnersight\t\t\t1000\tvelocitypercent\t25\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Small Charm\t0\t100\t28\t0\t0\t\t\t4\t1\t0\t1\t2000\t45000\tcm1\trld\tcm1\t16\t1\t1\t0\t0\t0\tflpchm1\tinvchm\t\t0\txxx\t\t\t0\tscha\t\titem_charm\t12\titem_charm\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Large Charm\t0\t100\t14\t0\t0\t\t\t8\t1\t0\t1\t1000\t38000\tcm2\trda\tcm2\t16\t1\t2\t0\t0\t0\tflpchm2\tinvwnd\t\t0\txxx\t\t\t0\tmcha\t\titem_charm\t12\titem_charm\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Grand Charm\t0\t100\t1\t0\t0\t\t\t12\t1\t0\t1\t600\t32000\tcm3\trgd\tcm3\t16\t1\t3\t0\t0\t0\tflpchm3\tinvsst\t\t0\txxx\t\t\t0\tlcha\t\titem_charm\t12\titem_charm\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Small Red Potion\t1\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\trps\trps\trps\t16\t1\t1\t0\t0\t0\tflprps\tinvrps\t\t0\txxx\t\t\t0\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t1\t5\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Large Red Potion\t1\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\trpl\trpl\trpl\t16\t1\t1\t0\t0\t0\tflprpl\tinvrpl\t\t0\txxx\t\t\t0\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t1\t5\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Small Blue Potion\t1\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\tbps\tbps\tbps\t16\t1\t1\t0\t0\t0\tflpbps\tinvbps\t\t0\txxx\t\t\t0\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t1\t5\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Large Blue Potion\t1\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\tbpl\tbpl\tbpl\t16\t1\t1\t0\t0\t0\tflpbpl\tinvbpl\t\t0\txxx\t\t\t0\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t1\t5\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"El Rune\t1\t100\t11\t0\t11\t\t\t1\t1\t0\t1\t560\t\tr01\tr01\tr01\t16\t1\t1\t0\t0\t0\tflprun\tinvrEl\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Eld Rune\t1\t100\t11\t0\t11\t\t\t1\t1\t0\t1\t560\t\tr02\tr02\tr02\t16\t1\t1\t0\t0\t0\tflprun\tinvrEld\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Tir Rune\t1\t100\t13\t0\t13\t\t\t2\t1\t0\t1\t1260\t\tr03\tr03\tr03\t16\t1\t1\t0\t0\t0\tflprun\tinvrTir\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Nef Rune\t1\t100\t13\t0\t13\t\t\t2\t1\t0\t1\t1260\t\tr04\tr04\tr04\t16\t1\t1\t0\t0\t0\tflprun\tinvrNef\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Eth Rune\t1\t100\t15\t0\t15\t\t\t3\t1\t0\t1\t2240\t\tr05\tr05\tr05\t16\t1\t1\t0\t0\t0\tflprun\tinvrEth\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ith Rune\t1\t100\t15\t0\t15\t\t\t3\t1\t0\t1\t2240\t\tr06\tr06\tr06\t16\t1\t1\t0\t0\t0\tflprun\tinvrIth\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Tal Rune\t1\t100\t17\t0\t17\t\t\t4\t1\t0\t1\t3500\t\tr07\tr07\tr07\t16\t1\t1\t0\t0\t0\tflprun\tinvrTal\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ral Rune\t1\t100\t19\t0\t19\t\t\t5\t1\t0\t1\t5040\t\tr08\tr08\tr08\t16\t1\t1\t0\t0\t0\tflprun\tinvrRal\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ort Rune\t1\t100\t21\t0\t21\t\t\t6\t1\t0\t1\t6860\t\tr09\tr09\tr09\t16\t1\t1\t0\t0\t0\tflprun\tinvrOrt\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Thul Rune\t1\t100\t23\t0\t23\t\t\t7\t1\t0\t1\t8960\t\tr10\tr10\tr10\t16\t1\t1\t0\t0\t0\tflprun\tinvrThul\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Amn Rune\t1\t100\t25\t0\t25\t\t\t8\t1\t0\t1\t11340\t\tr11\tr11\tr11\t16\t1\t1\t0\t0\t0\tflprun\tinvrAmn\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Sol Rune\t1\t100\t27\t0\t27\t\t\t9\t1\t0\t1\t14000\t\tr12\tr12\tr12\t16\t1\t1\t0\t0\t0\tflprun\tinvrSol\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Shael Rune\t1\t100\t29\t0\t29\t\t\t10\t1\t0\t1\t16940\t\tr13\tr13\tr13\t16\t1\t1\t0\t0\t0\tflprun\tinvrShae\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Dol Rune\t1\t100\t31\t0\t31\t\t\t11\t1\t0\t1\t20160\t\tr14\tr14\tr14\t16\t1\t1\t0\t0\t0\tflprun\tinvrDol\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Hel Rune\t1\t100\t33\t0\t0\t\t\t12\t1\t0\t1\t1715\t\tr15\tr15\tr15\t16\t1\t1\t0\t0\t0\tflprun\tinvrHel\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Io Rune\t1\t100\t35\t0\t35\t\t\t13\t1\t0\t1\t27440\t\tr16\tr16\tr16\t16\t1\t1\t0\t0\t0\tflprun\tinvrIo\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Lum Rune\t1\t100\t37\t0\t37\t\t\t14\t1\t0\t1\t31500\t\tr17\tr17\tr17\t16\t1\t1\t0\t0\t0\tflprun\tinvrLum\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ko Rune\t1\t100\t39\t0\t39\t\t\t15\t1\t0\t1\t35840\t\tr18\tr18\tr18\t16\t1\t1\t0\t0\t0\tflprun\tinvrKo\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Fal Rune\t1\t100\t41\t0\t41\t\t\t16\t1\t0\t1\t40460\t\tr19\tr19\tr19\t16\t1\t1\t0\t0\t0\tflprun\tinvrFal\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Lem Rune\t1\t100\t43\t0\t43\t\t\t17\t1\t0\t1\t45360\t\tr20\tr20\tr20\t16\t1\t1\t0\t0\t0\tflprun\tinvrLem\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Pul Rune\t1\t100\t45\t0\t45\t\t\t18\t1\t0\t1\t50540\t\tr21\tr21\tr21\t16\t1\t1\t0\t0\t0\tflprun\tinvrPul\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Um Rune\t1\t100\t47\t0\t47\t\t\t19\t1\t0\t1\t56000\t\tr22\tr22\tr22\t16\t1\t1\t0\t0\t0\tflprun\tinvrUm\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Mal Rune\t1\t100\t49\t0\t49\t\t\t20\t1\t0\t1\t61740\t\tr23\tr23\tr23\t16\t1\t1\t0\t0\t0\tflprun\tinvrMal\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ist Rune\t1\t100\t51\t0\t51\t\t\t21\t1\t0\t1\t67760\t\tr24\tr24\tr24\t16\t1\t1\t0\t0\t0\tflprun\tinvrIst\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Gul Rune\t1\t100\t53\t0\t53\t\t\t22\t1\t0\t1\t74060\t\tr25\tr25\tr25\t16\t1\t1\t0\t0\t0\tflprun\tinvrGul\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Vex Rune\t1\t100\t55\t0\t55\t\t\t23\t1\t0\t1\t80640\t\tr26\tr26\tr26\t16\t1\t1\t0\t0\t0\tflprun\tinvrVex\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ohm Rune\t1\t100\t57\t0\t57\t\t\t24\t1\t0\t1\t87500\t\tr27\tr27\tr27\t16\t1\t1\t0\t0\t0\tflprun\tinvrOhm\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Lo Rune\t1\t100\t59\t0\t59\t\t\t25\t1\t0\t1\t94640\t\tr28\tr28\tr28\t16\t1\t1\t0\t0\t0\tflprun\tinvrLo\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Sur Rune\t1\t100\t61\t0\t61\t\t\t26\t1\t0\t1\t102060\t\tr29\tr29\tr29\t16\t1\t1\t0\t0\t0\tflprun\tinvrSur\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Ber Rune\t1\t100\t63\t0\t63\t\t\t27\t1\t0\t1\t109760\t\tr30\tr30\tr30\t16\t1\t1\t0\t0\t0\tflprun\tinvrBer\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Jah Rune\t1\t100\t65\t0\t65\t\t\t28\t1\t0\t1\t117740\t\tr31\tr31\tr31\t16\t1\t1\t0\t0\t0\tflprun\tinvrJo\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Cham Rune\t1\t100\t67\t0\t67\t\t\t29\t1\t0\t1\t126000\t\tr32\tr32\tr32\t16\t1\t1\t0\t0\t0\tflprun\tinvrCham\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Zod Rune\t1\t100\t69\t0\t69\t\t\t30\t1\t0\t1\t134540\t\tr33\tr33\tr33\t16\t1\t1\t0\t0\t0\tflprun\tinvrZod\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Jewel\t0\t100\t1\t0\t0\t\t\t8\t1\t0\t1\t1000\t\tjew\tgpw\tjew\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswe\t\t0\txxx\t\t\t0\tjewl\t\titem_jewel\t12\titem_jewel\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Malah's Potion\t0\t100\t0\t0\t0\t\t\t999\t0\t0\t1\t10000\t\tice\tscr\tice\t16\t1\t1\t0\t0\t0\tflpwps\tinvxyz\t\t0\txxx\t\t\t0\tques\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t32\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tMalahsPotionDescription\t\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Scroll of Knowledge\t0\t100\t0\t0\t0\t\t\t0\t1\t0\t1\t100\t\t0sc\trsc\t0sc\t16\t1\t1\t0\t0\t0\tflprsc\tinvrsc\t\t0\txxx\t\t\t0\tscro\t\titem_scroll\t10\titem_scroll\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Scroll of Resistance\t1\t100\t0\t0\t0\t\t\t999\t0\t0\t1\t0\t\ttr2\tscr\ttr2\t16\t2\t2\t0\t0\t0\tflpscr\tinvscb\t\t0\txxx\t\t\t1\tques\t\titem_scroll\t10\titem_scroll\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t32\t1\t0\t-1\t12\t\t\t\t\t\t\t\t\t\t\t1\tUseScrollOfResistance\tUseScrollOfResistanceController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Key of Terror\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t99999\t\tpk1\tkey\tpk1\t16\t1\t2\t0\t0\t0\tflpmph\tinvmph\t\t0\txxx\t\t\t0\tques\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Key of Hate\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t99999\t\tpk2\tkey\tpk2\t16\t1\t2\t0\t0\t0\tflpmph\tinvmph\t\t0\txxx\t\t\t0\tques\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Key of Destruction\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t99999\t\tpk3\tkey\tpk3\t16\t1\t2\t0\t0\t0\tflpmph\tinvmph\t\t0\txxx\t\t\t0\tques\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Diablo's Horn\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t80\t\tdhn\tfng\tdhn\t16\t1\t1\t0\t0\t0\tflpfang\tinvfang\t\t0\txxx\t\t\t0\tques\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Baal's Eye\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t80\t\tbey\teyz\tbey\t16\t1\t1\t0\t0\t0\tflpeye\tinveye\t\t0\txxx\t\t\t0\tques\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Mephisto's Brain\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t80\t\tmbr\tbrz\tmbr\t16\t1\t1\t0\t0\t0\tflpbrnz\tinvbrnz\t\t0\txxx\t\t\t0\tques\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Token of Absolution\t0\t100\t0\t0\t0\t\t\t999\t0\t0\t1\t99999\t\ttoa\ttoa\ttoa\t16\t1\t1\t0\t0\t0\tflprun\tinvtoa\t\t0\txxx\t\t\t1\tques\t\titem_amulet\t14\titem_book\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t13\t\t\t\t\t\t\t\t\t\t\t1\tUseTokenOfAbsolution\tUseTokenOfAbsolutionController\t\t8\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Twisted Essence of Suffering\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t10000\t\ttes\tfng\ttes\t16\t1\t1\t0\t0\t0\tflpgsb\tinvtes\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\titem_rare\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Charged Essense of Hatred\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t10000\t\tceh\teyz\tceh\t16\t1\t1\t0\t0\t0\tflpgsy\tinvceh\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\titem_rare\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Burning Essence of Terror\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t10000\t\tbet\tfng\tbet\t16\t1\t1\t0\t0\t0\tflpgsr\tinvbet\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\titem_rare\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Festering Essence of Destruction\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t10000\t\tfed\tbrz\tfed\t16\t1\t1\t0\t0\t0\tflpgsg\tinvfed\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\titem_rare\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                ss << u8"Standard of Heroes\t0\t100\t90\t0\t90\t\t\t4\t1\t0\t1\t2000\t\tstd\tflg\tstd\t16\t1\t1\t0\t0\t0\tflpflag\tinvflag\t\t0\txxx\t\t\t0\tques\t\titem_charm\t12\titem_charm\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"name\tcompactsave\tversion\tlevel\tShowLevel\tlevelreq\treqstr\treqdex\trarity\tspawnable\tspeed\tnodurability\tcost\tgamble cost\tcode\talternategfx\tnamestr\tcomponent\tinvwidth\tinvheight\thasinv\tgemsockets\tgemapplytype\tflippyfile\tinvfile\tuniqueinvfile\tTransmogrify\tTMogType\tTMogMin\tTMogMax\tuseable\ttype\ttype2\tdropsound\tdropsfxframe\tusesound\tunique\ttransparent\ttranstbl\tlightradius\tbelt\tautobelt\tstackable\tminstack\tmaxstack\tspawnstack\tquest\tquestdiffcheck\tmissiletype\tspellicon\tpSpell\tstate\tcstate1\tcstate2\tlen\tstat1\tcalc1\tstat2\tcalc2\tstat3\tcalc3\tspelldesc\tspelldescstr\tspelldescstr2\tspelldesccalc\tspelldesccolor\tdurwarning\tqntwarning\tgemoffset\tBetterGem\tbitfield1\tCharsiMin\tCharsiMax\tCharsiMagicMin\tCharsiMagicMax\tCharsiMagicLvl\tGheedMin\tGheedMax\tGheedMagicMin\tGheedMagicMax\tGheedMagicLvl\tAkaraMin\tAkaraMax\tAkaraMagicMin\tAkaraMagicMax\tAkaraMagicLvl\tFaraMin\tFaraMax\tFaraMagicMin\tFaraMagicMax\tFaraMagicLvl\tLysanderMin\tLysanderMax\tLysanderMagicMin\tLysanderMagicMax\tLysanderMagicLvl\tDrognanMin\tDrognanMax\tDrognanMagicMin\tDrognanMagicMax\tDrognanMagicLvl\tHratliMin\tHratliMax\tHratliMagicMin\tHratliMagicMax\tHratliMagicLvl\tAlkorMin\tAlkorMax\tAlkorMagicMin\tAlkorMagicMax\tAlkorMagicLvl\tOrmusMin\tOrmusMax\tOrmusMagicMin\tOrmusMagicMax\tOrmusMagicLvl\tElzixMin\tElzixMax\tElzixMagicMin\tElzixMagicMax\tElzixMagicLvl\tAshearaMin\tAshearaMax\tAshearaMagicMin\tAshearaMagicMax\tAshearaMagicLvl\tCainMin\tCainMax\tCainMagicMin\tCainMagicMax\tCainMagicLvl\tHalbuMin\tHalbuMax\tHalbuMagicMin\tHalbuMagicMax\tHalbuMagicLvl\tMalahMin\tMalahMax\tMalahMagicMin\tMalahMagicMax\tMalahMagicLvl\tLarzukMin\tLarzukMax\tLarzukMagicMin\tLarzukMagicMax\tLarzukMagicLvl\tAnyaMin\tAnyaMax\tAnyaMagicMin\tAnyaMagicMax\tAnyaMagicLvl\tJamellaMin\tJamellaMax\tJamellaMagicMin\tJamellaMagicMax\tJamellaMagicLvl\tTransform\tInvTrans\tSkipName\tNightmareUpgrade\tHellUpgrade\tmindam\tmaxdam\tPermStoreItem\tmultibuy\tNameable\tdiablocloneweight\n",
+                u8"Elixir\t1\t0\t21\t0\t0\t\t\t4\t1\t0\t1\t20\t\telx\telx\telx\t16\t1\t1\t0\t0\t0\tflppot\tinvpot\t\t0\txxx\t\t\t1\telix\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t8\t\t\t\t\texperience\t5\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t30\t\thpo\thpo\thpo\t16\t1\t1\t0\t0\t0\tflprps\tinvrps\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t30\t\tmpo\tmpo\tmpo\t16\t1\t1\t0\t0\t0\tflpbps\tinvbps\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Full Healing Potion\t1\t0\t0\t0\t0\t\t\t2\t0\t0\t1\t150\t\thpf\thpo\thpf\t16\t1\t1\t0\t0\t0\tflprpl\tinvrpl\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Full Mana Potion\t1\t0\t0\t0\t0\t\t\t2\t0\t0\t1\t150\t\tmpf\tmpo\tmpf\t16\t1\t1\t0\t0\t0\tflpbpl\tinvbpl\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Stamina Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t25\t\tvps\tvps\tvps\t16\t1\t1\t0\t0\t0\tflpwps\tinvwps\t\t0\txxx\t\t\t1\tspot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t9\tstaminapot\t\t\t750\tstaminarecoverybonus\t5000\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t\t\t255\t\t\t\t\t255\t3\t5\t3\t5\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Antidote Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t40\t\typs\typs\typs\t16\t1\t1\t0\t0\t0\tflpnps\tinvnps\t\t0\txxx\t\t\t1\tapot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t6\tantidote\tpoison\t\t750\tpoisonresist\t50\tmaxpoisonresist\t10\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t\t\t255\t\t\t\t\t255\t9\t15\t9\t15\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t11\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t11\t\t\t255\t\t\t\t\t255\t3\t5\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Rejuvenation Potion\t1\t0\t0\t0\t0\t\t\t2\t0\t0\t1\t400\t\trvs\typs\trvs\t16\t1\t1\t0\t0\t0\tflpvps\tinvvps\t\t0\txxx\t\t\t1\trpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t5\t\t\t\t\thitpoints\t35\tmana\t35\t\t\t4\tItemStatsrejuv1\t\t35\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Full Rejuvenation Potion\t1\t0\t0\t0\t0\t\t\t2\t0\t0\t1\t1500\t\trvl\typl\trvl\t16\t1\t1\t0\t0\t0\tflpvpl\tinvvpl\t\t0\txxx\t\t\t1\trpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t5\t\t\t\t\thitpoints\t100\tmana\t100\t\t\t4\tItemStatsrejuv1\t\t100\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Thawing Potion\t1\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t25\t\twms\typs\twms\t16\t1\t1\t0\t0\t0\tflpyps\tinvyps\t\t0\txxx\t\t\t1\twpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t6\tthawing\tfreeze\tcold\t750\tcoldresist\t50\tmaxcoldresist\t10\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t3\t5\t3\t5\t255\t\t\t\t\t255\t\t\t\t\t255\t6\t9\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t6\t9\t\t\t255\t\t\t\t\t255\t2\t4\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Tome of Town Portal\t0\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t250\t\ttbk\tbbk\ttbk\t16\t1\t2\t0\t0\t0\tflpbbk\tinvbbk\t\t0\txxx\t\t\t1\tbook\t\titem_book\t12\titem_book\t0\t0\t5\t0\t0\t0\t1\t1\t20\t5\t\t\t0\t-1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t2\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t\t\t\n",
+                u8"Tome of Identify\t0\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t200\t\tibk\trbk\tibk\t16\t1\t2\t0\t0\t0\tflprbk\tinvrbk\t\t0\txxx\t\t\t1\tbook\t\titem_book\t12\titem_book\t0\t0\t5\t0\t0\t0\t1\t1\t20\t5\t\t\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t2\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t\t\t\n",
+                u8"Amulet\t0\t0\t1\t0\t0\t\t\t4\t1\t0\t1\t2400\t63000\tamu\tamu\tamu\t16\t1\t1\t1\t1\t1\tflpamu\tinvamu\t\t0\txxx\t\t\t0\tamul\t\titem_amulet\t12\titem_amulet\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Amulet of the Viper\t0\t0\t15\t0\t0\t\t\t4\t0\t0\t1\t400\t\tvip\tvip\tvip\t16\t1\t1\t0\t0\t0\tflpamu\tinvvip\tinvvip\t0\txxx\t\t\t0\tamul\t\titem_amulet\t12\titem_amulet\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t10\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t1\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ring\t0\t0\t1\t0\t0\t\t\t4\t1\t0\t1\t1800\t50000\trin\trin\trin\t16\t1\t1\t1\t1\t1\tflprin\tinvrin\t\t0\txxx\t\t\t0\tring\t\titem_ring\t12\titem_ring\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Gold\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t0\t\tgld\tgld\tgld\t16\t1\t1\t0\t0\t0\tflpgld\tinvgld\t\t0\txxx\t\t\t0\tgold\t\titem_gold\t12\titem_gold\t0\t0\t5\t0\t0\t0\t1\t0\t5000\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Scroll of Inifuss\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t100\t\tbks\tbks\tbks\t16\t2\t2\t0\t0\t0\tflpscr\tinvscb\t\t0\txxx\t\t\t1\tques\t\titem_scroll\t10\titem_scroll\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t5\t1\t0\t-1\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Key to the Cairn Stones\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t12000\t\tbkd\tbkd\tbkd\t16\t2\t2\t0\t0\t0\tflpscr\tinvscb\t\t0\txxx\t\t\t1\tques\t\titem_scroll\t10\titem_scroll\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t5\t1\t0\t-1\t14\t\t\t\t\t\t\t\t\t\t\t1\tReadScroll\tReadScrollController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Arrows\t0\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t256\t\taqv\taqv\taqv\t16\t1\t3\t0\t0\t0\tflpqvr\tinvqvr\t\t0\txxx\t\t\t0\tbowq\t\titem_quiver\t12\titem_quiver\t0\t0\t5\t0\t0\t0\t1\t150\t500\t250\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t0\tnon\t0\t3\t5\t\t\t255\t1\t3\t\t\t255\t\t\t\t\t255\t3\t4\t3\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t4\t3\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t2\t3\t\t\t255\t\t\t\t\t255\t3\t4\t\t\t255\t\t\t\t\t255\t3\t4\t\t\t255\t3\t4\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t\t\t\n",
+                u8"Torch\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t50\t\ttch\tbsh\ttch\t7\t1\t2\t0\t0\t0\tflptrch\tinvtrch\t\t0\txxx\t\t\t0\ttorc\t\titem_staff\t12\titem_staff\t0\t1\t3\t6\t0\t0\t0\t2\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Bolts\t0\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t256\t\tcqv\tcqv\tcqv\t16\t1\t3\t0\t0\t0\tflpqvr\tinvcqv\t\t0\txxx\t\t\t0\txboq\t\titem_quiver\t12\titem_quiver\t0\t0\t5\t0\t0\t0\t1\t150\t500\t250\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t0\tnon\t0\t2\t4\t\t\t255\t2\t4\t\t\t255\t\t\t\t\t255\t3\t4\t3\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t4\t3\t4\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t\t\t255\t2\t3\t\t\t255\t\t\t\t\t255\t3\t4\t\t\t255\t\t\t\t\t255\t3\t4\t\t\t255\t3\t4\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t\t\t\n",
+                u8"Scroll of Town Portal\t1\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t100\t\ttsc\tbsc\ttsc\t16\t1\t1\t0\t0\t0\tflpbsc\tinvbsc\t\t0\txxx\t\t\t1\tscro\t\titem_scroll\t10\titem_scroll\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t11\t17\t255\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t11\t17\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t7\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t7\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Scroll of Identify\t1\t0\t0\t0\t0\t\t\t2\t1\t0\t1\t80\t\tisc\trsc\tisc\t16\t1\t1\t0\t0\t0\tflprsc\tinvrsc\t\t0\txxx\t\t\t1\tscro\t\titem_scroll\t10\titem_scroll\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t11\t17\t255\t\t\t\t\t255\t\t\t\t\t255\t11\t17\t11\t17\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t7\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t7\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Heart\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t60\t\thrt\thrt\thrt\t16\t1\t1\t0\t0\t0\tflphrt\tinvhrt\t\t1\thpo\t0\t0\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Brain\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t60\t\tbrz\tbrz\tbrz\t16\t1\t1\t0\t0\t0\tflpbrnz\tinvbrnz\t\t1\topm\t1\t1\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Jawbone\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t75\t\tjaw\tjaw\tjaw\t16\t1\t1\t0\t0\t0\tflpjaw\tinvjaw\t\t1\tcqv\t10\t40\t0\tbody\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Eye\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t45\t\teyz\teyz\teyz\t16\t1\t1\t0\t0\t0\tflpeye\tinveye\t\t1\tmpo\t0\t0\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Horn\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t48\t\thrn\thrn\thrn\t16\t1\t1\t0\t0\t0\tflphorn\tinvhorn\t\t1\taqv\t10\t40\t0\tbody\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Tail\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t63\t\ttal\ttal\ttal\t16\t1\t1\t0\t0\t0\tflptail\tinvtail\t\t1\tvps\t0\t0\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flag\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t98\t\tflg\tflg\tflg\t16\t1\t1\t0\t0\t0\tflpflag\tinvflag\t\t0\txxx\t\t\t0\tbody\t\titem_lightarmor\t12\titem_lightarmor\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Fang\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t80\t\tfng\tfng\tfng\t16\t1\t1\t0\t0\t0\tflpfang\tinvfang\t\t1\tkey\t1\t1\t0\tbody\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Quill\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t32\t\tqll\tqll\tqll\t16\t1\t1\t0\t0\t0\tflpquil\tinvquil\t\t1\taqv\t10\t40\t0\tbody\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Soul\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\tsol\tsol\tsol\t16\t1\t1\t0\t0\t0\tflpsple\tinvsple\t\t1\tmpo\t0\t0\t0\tbody\t\titem_rare\t12\t\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Scalp\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t40\t\tscz\tscz\tscz\t16\t1\t1\t0\t0\t0\tflpscp\tinvscp\t\t1\thpf\t0\t0\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Spleen\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t85\t\tspe\tspe\tspe\t16\t1\t1\t0\t0\t0\tflpsple\tinvsple\t\t1\tgps\t1\t1\t0\tbody\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tconvertsto\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Key\t0\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t45\t\tkey\tkey\tkey\t16\t1\t1\t0\t0\t0\tflpkey\tinvkey\t\t0\txxx\t\t\t0\tkey\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t1\t1\t12\t6\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t5\t9\t5\t9\t255\t1\t2\t1\t2\t255\t\t\t\t\t255\t6\t9\t6\t9\t255\t\t\t\t\t255\t2\t3\t2\t3\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t2\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"The Black Tower Key\t0\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t99999\t\tluv\tkey\tluv\t16\t1\t2\t0\t0\t0\tflpmph\tinvmph\t\t0\txxx\t\t\t0\tkey\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t20\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Potion of Life\t0\t0\t0\t0\t0\t\t\t999\t0\t0\t1\t10000\t\txyz\tscr\txyz\t16\t1\t1\t0\t0\t0\tflpwps\tinvxyz\t\t0\txxx\t\t\t1\tques\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t19\t1\t0\t-1\t11\t\t\t\t\t\t\t\t\t\t\t1\tUsePotionOfLife\tUsePotionOfLifeController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"A Jade Figurine\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t100\t\tj34\tbks\tj34\t16\t1\t2\t0\t0\t0\tflpjbi\tinvjbi\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\t\t1\t0\t3\t0\t0\t0\t0\t0\t0\t0\t19\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"The Golden Bird\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t100\t\tg34\tbks\tg34\t16\t1\t2\t0\t0\t0\tflpgbi\tinvgbi\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\t\t1\t0\t4\t0\t0\t0\t0\t0\t0\t0\t19\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Lam Esen's Tome\t1\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t100\t\tbbb\tbbb\tbbb\t16\t2\t2\t0\t0\t0\tflpbbb\tinvbbb\t\t0\txxx\t\t\t0\tques\t\titem_book\t12\titem_book\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t16\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Horadric Cube\t0\t0\t0\t0\t0\t\t\t0\t0\t0\t1\t0\t\tbox\trbk\tbox\t16\t2\t2\t0\t0\t0\tflpbox\tinvbox\t\t0\txxx\t\t\t1\tques\t\titem_rare\t12\t\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t10\t\t0\t-1\t7\t\t\t\t\t\t\t\t\t\t\t1\tOpenHoradricCube\tOpenHoradricCubeController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Horadric Scroll\t1\t0\t0\t0\t0\t\t\t999\t0\t0\t1\t0\t\ttr1\tgrg\ttr1\t16\t2\t2\t0\t0\t0\tflphscr\tinvhscr\t\t0\txxx\t\t\t0\tques\t\titem_book\t12\titem_book\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t10\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Mephisto's Soulstone\t1\t0\t0\t0\t0\t\t\t999\t0\t0\t1\t0\t\tmss\tscr\tmss\t16\t1\t1\t0\t0\t0\tflpmss\tinvmss\t\t0\txxx\t\t\t0\tques\t\titem_gem\t12\titem_gem\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t25\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Book of Skill\t1\t0\t0\t0\t0\t\t\t999\t0\t0\t1\t0\t\tass\ttbk\tass\t16\t2\t2\t0\t0\t0\tflpbbk\tinvsbk\t\t0\txxx\t\t\t1\tques\t\titem_book\t12\titem_book\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t15\t1\t0\t-1\t10\t\t\t\t\t\t\t\t\t\t\t1\tUseBookOfSkill\tUseBookOfSkillController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Khalim's Eye\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t45\t\tqey\teyz\tqey\t16\t1\t1\t0\t0\t0\tflpeye\tinveye\t\t0\txxx\t\t\t0\tques\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t17\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Khalim's Heart\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t60\t\tqhr\thrt\tqhr\t16\t1\t1\t0\t0\t0\tflphrt\tinvhrt\t\t0\txxx\t\t\t0\tques\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t17\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Khalim's Brain\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t60\t\tqbr\tbrz\tqbr\t16\t1\t1\t0\t0\t0\tflpbrnz\tinvbrnz\t\t0\txxx\t\t\t0\tques\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t17\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ear\t1\t0\t0\t0\t0\t\t\t1\t0\t0\t1\t0\t\tear\tear\tear\t16\t1\t1\t0\t0\t0\tflpear\tinvear\t\t0\txxx\t\t\t0\tplay\t\titem_monsterguts\t14\titem_monsterguts\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Chipped Amethyst\t1\t0\t0\t0\t1\t\t\t2\t1\t0\t1\t500\t\tgcv\tgcv\tgcv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsva\t\t0\txxx\t\t\t0\tgema\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfv\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawed Amethyst\t1\t0\t0\t0\t5\t\t\t3\t1\t0\t1\t1500\t\tgfv\tgfv\tgfv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsvb\t\t0\txxx\t\t\t0\tgema\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsv\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Amethyst\t1\t0\t0\t0\t12\t\t\t4\t1\t0\t1\t5000\t\tgsv\tgsv\tgsv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsvc\t\t0\txxx\t\t\t0\tgema\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgzv\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawless Amethyst\t1\t0\t0\t0\t15\t\t\t5\t1\t0\t1\t15000\t\tgzv\tgzv\tgzv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsvd\t\t0\txxx\t\t\t0\tgema\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpv\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Perfect Amethyst\t1\t0\t0\t0\t18\t\t\t6\t1\t0\t1\t30000\t\tgpv\tgpv\tgpv\t16\t1\t1\t0\t0\t0\tflpgsv\tinvgsve\t\t0\txxx\t\t\t0\tgema\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Chipped Topaz\t1\t0\t0\t0\t1\t\t\t3\t1\t0\t1\t500\t\tgcy\tgcy\tgcy\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsya\t\t0\txxx\t\t\t0\tgemt\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfy\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawed Topaz\t1\t0\t0\t0\t5\t\t\t4\t1\t0\t1\t1500\t\tgfy\tgfy\tgfy\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsyb\t\t0\txxx\t\t\t0\tgemt\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsy\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Topaz\t1\t0\t0\t0\t12\t\t\t5\t1\t0\t1\t5000\t\tgsy\tgsy\tgsy\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsyc\t\t0\txxx\t\t\t0\tgemt\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgly\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawless Topaz\t1\t0\t0\t0\t15\t\t\t6\t1\t0\t1\t15000\t\tgly\tgly\tgly\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsyd\t\t0\txxx\t\t\t0\tgemt\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpy\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Perfect Topaz\t1\t0\t0\t0\t18\t\t\t7\t1\t0\t1\t30000\t\tgpy\tgpy\tgpy\t16\t1\t1\t0\t0\t0\tflpgsy\tinvgsye\t\t0\txxx\t\t\t0\tgemt\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Chipped Sapphire\t1\t0\t0\t0\t1\t\t\t4\t1\t0\t1\t500\t\tgcb\tgcb\tgcb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsba\t\t0\txxx\t\t\t0\tgems\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfb\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawed Sapphire\t1\t0\t0\t0\t5\t\t\t5\t1\t0\t1\t1500\t\tgfb\tgfb\tgfb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsbb\t\t0\txxx\t\t\t0\tgems\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsb\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Sapphire\t1\t0\t0\t0\t12\t\t\t6\t1\t0\t1\t5000\t\tgsb\tgsb\tgsb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsbc\t\t0\txxx\t\t\t0\tgems\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tglb\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawless Sapphire\t1\t0\t0\t0\t15\t\t\t7\t1\t0\t1\t15000\t\tglb\tglb\tglb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsbd\t\t0\txxx\t\t\t0\tgems\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpb\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Perfect Sapphire\t1\t0\t0\t0\t18\t\t\t8\t1\t0\t1\t30000\t\tgpb\tgpb\tgpb\t16\t1\t1\t0\t0\t0\tflpgsb\tinvgsbe\t\t0\txxx\t\t\t0\tgems\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Chipped Emerald\t1\t0\t0\t0\t1\t\t\t5\t1\t0\t1\t500\t\tgcg\tgcg\tgcg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsga\t\t0\txxx\t\t\t0\tgeme\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfg\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawed Emerald\t1\t0\t0\t0\t5\t\t\t6\t1\t0\t1\t1500\t\tgfg\tgfg\tgfg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsgb\t\t0\txxx\t\t\t0\tgeme\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsg\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Emerald\t1\t0\t0\t0\t12\t\t\t7\t1\t0\t1\t5000\t\tgsg\tgsg\tgsg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsgc\t\t0\txxx\t\t\t0\tgeme\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tglg\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawless Emerald\t1\t0\t0\t0\t15\t\t\t8\t1\t0\t1\t15000\t\tglg\tglg\tglg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsgd\t\t0\txxx\t\t\t0\tgeme\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpg\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Perfect Emerald\t1\t0\t0\t0\t18\t\t\t9\t1\t0\t1\t30000\t\tgpg\tgpg\tgpg\t16\t1\t1\t0\t0\t0\tflpgsg\tinvgsge\t\t0\txxx\t\t\t0\tgeme\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Chipped Ruby\t1\t0\t0\t0\t1\t\t\t6\t1\t0\t1\t500\t\tgcr\tgcr\tgcr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsra\t\t0\txxx\t\t\t0\tgemr\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfr\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawed Ruby\t1\t0\t0\t0\t5\t\t\t7\t1\t0\t1\t1500\t\tgfr\tgfr\tgfr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsrb\t\t0\txxx\t\t\t0\tgemr\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsr\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ruby\t1\t0\t0\t0\t12\t\t\t8\t1\t0\t1\t5000\t\tgsr\tgsr\tgsr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsrc\t\t0\txxx\t\t\t0\tgemr\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tglr\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawless Ruby\t1\t0\t0\t0\t15\t\t\t9\t1\t0\t1\t15000\t\tglr\tglr\tglr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsrd\t\t0\txxx\t\t\t0\tgemr\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpr\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Perfect Ruby\t1\t0\t0\t0\t18\t\t\t10\t1\t0\t1\t30000\t\tgpr\tgpr\tgpr\t16\t1\t1\t0\t0\t0\tflpgsr\tinvgsre\t\t0\txxx\t\t\t0\tgemr\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Chipped Diamond\t1\t0\t0\t0\t1\t\t\t7\t1\t0\t1\t500\t\tgcw\tgcw\tgcw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswa\t\t0\txxx\t\t\t0\tgemd\tgem0\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgfw\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawed Diamond\t1\t0\t0\t0\t5\t\t\t8\t1\t0\t1\t1500\t\tgfw\tgfw\tgfw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswb\t\t0\txxx\t\t\t0\tgemd\tgem1\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgsw\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Diamond\t1\t0\t0\t0\t12\t\t\t9\t1\t0\t1\t5000\t\tgsw\tgsw\tgsw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswc\t\t0\txxx\t\t\t0\tgemd\tgem2\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tglw\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawless Diamond\t1\t0\t0\t0\t15\t\t\t10\t1\t0\t1\t15000\t\tglw\tglw\tglw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswd\t\t0\txxx\t\t\t0\tgemd\tgem3\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tgpw\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Perfect Diamond\t1\t0\t0\t0\t18\t\t\t11\t1\t0\t1\t30000\t\tgpw\tgpw\tgpw\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswe\t\t0\txxx\t\t\t0\tgemd\tgem4\titem_gem\t12\titem_gem\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Minor Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t30\t\thp1\thp1\thp1\t16\t1\t1\t0\t0\t0\tflprps\tinvhp1\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t192\thpregen\t30\t\t\t\t\t2\tItemStats1q\t\t30\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\thp4\thp5\t\t\t1\t1\t\t\n",
+                u8"Light Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t75\t\thp2\thp2\thp2\t16\t1\t1\t0\t0\t0\tflprps\tinvhp2\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t160\thpregen\t60\t\t\t\t\t2\tItemStats1q\t\t60\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\thp4\thp5\t\t\t1\t1\t\t\n",
+                u8"Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t125\t\thp3\thp3\thp3\t16\t1\t1\t0\t0\t0\tflprps\tinvhp3\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t171\thpregen\t100\t\t\t\t\t2\tItemStats1q\t\t100\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\thp4\thp5\t\t\t1\t1\t\t\n",
+                u8"Greater Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t250\t\thp4\thp4\thp4\t16\t1\t1\t0\t0\t0\tflprpl\tinvhp4\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t192\thpregen\t180\t\t\t\t\t2\tItemStats1q\t\t180\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\txxx\thp5\t\t\t1\t1\t\t\n",
+                u8"Super Healing Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t500\t\thp5\thp5\thp5\t16\t1\t1\t0\t0\t0\tflprpl\tinvhp5\t\t0\txxx\t\t\t1\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\thealthpot\t\t\t256\thpregen\t320\t\t\t\t\t2\tItemStats1q\t\t320\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Minor Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t60\t\tmp1\tmp1\tmp1\t16\t1\t1\t0\t0\t0\tflpbps\tinvmp1\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t20\t\t\t\t\t2\tItemStats1q\t\t20\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\tmp4\tmp5\t\t\t1\t1\t\t\n",
+                u8"Light Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t150\t\tmp2\tmp2\tmp2\t16\t1\t1\t0\t0\t0\tflpbps\tinvmp2\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t40\t\t\t\t\t2\tItemStats1q\t\t40\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\tmp4\tmp5\t\t\t1\t1\t\t\n",
+                u8"Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t300\t\tmp3\tmp3\tmp3\t16\t1\t1\t0\t0\t0\tflpbps\tinvmp3\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t80\t\t\t\t\t2\tItemStats1q\t\t80\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\tmp4\tmp5\t\t\t1\t1\t\t\n",
+                u8"Greater Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t500\t\tmp4\tmp4\tmp4\t16\t1\t1\t0\t0\t0\tflpbpl\tinvmp4\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t150\t\t\t\t\t2\tItemStats1q\t\t150\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t0\t0\t0\txxx\tmp5\t\t\t1\t1\t\t\n",
+                u8"Super Mana Potion\t1\t0\t0\t0\t0\t\t\t1\t1\t0\t1\t1000\t\tmp5\tmp5\tmp5\t16\t1\t1\t0\t0\t0\tflpbpl\tinvmp5\t\t0\txxx\t\t\t1\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t1\t1\t0\t0\t0\t0\t\t\t0\t-1\t3\tmanapot\t\t\t128\tmanarecovery\t250\t\t\t\t\t2\tItemStats1q\t\t250\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t1\t1\t\t\n",
+                u8"Chipped Skull\t1\t0\t0\t0\t1\t\t\t8\t1\t0\t1\t1000\t\tskc\tskc\tskc\t16\t1\t1\t0\t0\t0\tflpskl\tinvskc\t\t0\txxx\t\t\t0\tgemz\tgem0\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tskf\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawed Skull\t1\t0\t0\t0\t5\t\t\t9\t1\t0\t1\t3000\t\tskf\tskf\tskf\t16\t1\t1\t0\t0\t0\tflpskl\tinvskf\t\t0\txxx\t\t\t0\tgemz\tgem1\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tsku\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Skull\t1\t0\t0\t0\t12\t\t\t10\t1\t0\t1\t10000\t\tsku\tsku\tsku\t16\t1\t1\t0\t0\t0\tflpskl\tinvsku\t\t0\txxx\t\t\t0\tgemz\tgem2\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tskl\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Flawless Skull\t1\t0\t0\t0\t15\t\t\t11\t1\t0\t1\t30000\t\tskl\tskl\tskl\t16\t1\t1\t0\t0\t0\tflpskl\tinvskl\t\t0\txxx\t\t\t0\tgemz\tgem3\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tskz\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Perfect Skull\t1\t0\t0\t0\t18\t\t\t12\t1\t0\t1\t100000\t\tskz\tskz\tskz\t16\t1\t1\t0\t0\t0\tflpskl\tinvskz\t\t0\txxx\t\t\t0\tgemz\tgem4\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n",
+                u8"Herb\t0\t100\t3\t0\t0\t\t\t3\t0\t0\t1\t75\t\thrb\thrb\thrb\t16\t1\t1\t0\t0\t0\tflphrb\tinvhrb\t\t0\txxx\t\t\t1\therb\t\titem_herb\t12\titem_herb\t0\t0\t5\t0\t1\t0\t0\t0\t0\t0\t\t\t0\t-1\t10\tinnersight\t\t\t1000\tvelocitypercent\t25\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Small Charm\t0\t100\t28\t0\t0\t\t\t4\t1\t0\t1\t2000\t45000\tcm1\trld\tcm1\t16\t1\t1\t0\t0\t0\tflpchm1\tinvchm\t\t0\txxx\t\t\t0\tscha\t\titem_charm\t12\titem_charm\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Large Charm\t0\t100\t14\t0\t0\t\t\t8\t1\t0\t1\t1000\t38000\tcm2\trda\tcm2\t16\t1\t2\t0\t0\t0\tflpchm2\tinvwnd\t\t0\txxx\t\t\t0\tmcha\t\titem_charm\t12\titem_charm\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Grand Charm\t0\t100\t1\t0\t0\t\t\t12\t1\t0\t1\t600\t32000\tcm3\trgd\tcm3\t16\t1\t3\t0\t0\t0\tflpchm3\tinvsst\t\t0\txxx\t\t\t0\tlcha\t\titem_charm\t12\titem_charm\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t8\t8\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Small Red Potion\t1\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\trps\trps\trps\t16\t1\t1\t0\t0\t0\tflprps\tinvrps\t\t0\txxx\t\t\t0\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t1\t5\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Large Red Potion\t1\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\trpl\trpl\trpl\t16\t1\t1\t0\t0\t0\tflprpl\tinvrpl\t\t0\txxx\t\t\t0\thpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t1\t5\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Small Blue Potion\t1\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\tbps\tbps\tbps\t16\t1\t1\t0\t0\t0\tflpbps\tinvbps\t\t0\txxx\t\t\t0\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t1\t5\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Large Blue Potion\t1\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t100\t\tbpl\tbpl\tbpl\t16\t1\t1\t0\t0\t0\tflpbpl\tinvbpl\t\t0\txxx\t\t\t0\tmpot\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t1\t5\t10\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"El Rune\t1\t100\t11\t0\t11\t\t\t1\t1\t0\t1\t560\t\tr01\tr01\tr01\t16\t1\t1\t0\t0\t0\tflprun\tinvrEl\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Eld Rune\t1\t100\t11\t0\t11\t\t\t1\t1\t0\t1\t560\t\tr02\tr02\tr02\t16\t1\t1\t0\t0\t0\tflprun\tinvrEld\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Tir Rune\t1\t100\t13\t0\t13\t\t\t2\t1\t0\t1\t1260\t\tr03\tr03\tr03\t16\t1\t1\t0\t0\t0\tflprun\tinvrTir\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Nef Rune\t1\t100\t13\t0\t13\t\t\t2\t1\t0\t1\t1260\t\tr04\tr04\tr04\t16\t1\t1\t0\t0\t0\tflprun\tinvrNef\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Eth Rune\t1\t100\t15\t0\t15\t\t\t3\t1\t0\t1\t2240\t\tr05\tr05\tr05\t16\t1\t1\t0\t0\t0\tflprun\tinvrEth\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ith Rune\t1\t100\t15\t0\t15\t\t\t3\t1\t0\t1\t2240\t\tr06\tr06\tr06\t16\t1\t1\t0\t0\t0\tflprun\tinvrIth\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Tal Rune\t1\t100\t17\t0\t17\t\t\t4\t1\t0\t1\t3500\t\tr07\tr07\tr07\t16\t1\t1\t0\t0\t0\tflprun\tinvrTal\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ral Rune\t1\t100\t19\t0\t19\t\t\t5\t1\t0\t1\t5040\t\tr08\tr08\tr08\t16\t1\t1\t0\t0\t0\tflprun\tinvrRal\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ort Rune\t1\t100\t21\t0\t21\t\t\t6\t1\t0\t1\t6860\t\tr09\tr09\tr09\t16\t1\t1\t0\t0\t0\tflprun\tinvrOrt\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Thul Rune\t1\t100\t23\t0\t23\t\t\t7\t1\t0\t1\t8960\t\tr10\tr10\tr10\t16\t1\t1\t0\t0\t0\tflprun\tinvrThul\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Amn Rune\t1\t100\t25\t0\t25\t\t\t8\t1\t0\t1\t11340\t\tr11\tr11\tr11\t16\t1\t1\t0\t0\t0\tflprun\tinvrAmn\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Sol Rune\t1\t100\t27\t0\t27\t\t\t9\t1\t0\t1\t14000\t\tr12\tr12\tr12\t16\t1\t1\t0\t0\t0\tflprun\tinvrSol\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Shael Rune\t1\t100\t29\t0\t29\t\t\t10\t1\t0\t1\t16940\t\tr13\tr13\tr13\t16\t1\t1\t0\t0\t0\tflprun\tinvrShae\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Dol Rune\t1\t100\t31\t0\t31\t\t\t11\t1\t0\t1\t20160\t\tr14\tr14\tr14\t16\t1\t1\t0\t0\t0\tflprun\tinvrDol\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Hel Rune\t1\t100\t33\t0\t0\t\t\t12\t1\t0\t1\t1715\t\tr15\tr15\tr15\t16\t1\t1\t0\t0\t0\tflprun\tinvrHel\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Io Rune\t1\t100\t35\t0\t35\t\t\t13\t1\t0\t1\t27440\t\tr16\tr16\tr16\t16\t1\t1\t0\t0\t0\tflprun\tinvrIo\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Lum Rune\t1\t100\t37\t0\t37\t\t\t14\t1\t0\t1\t31500\t\tr17\tr17\tr17\t16\t1\t1\t0\t0\t0\tflprun\tinvrLum\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ko Rune\t1\t100\t39\t0\t39\t\t\t15\t1\t0\t1\t35840\t\tr18\tr18\tr18\t16\t1\t1\t0\t0\t0\tflprun\tinvrKo\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Fal Rune\t1\t100\t41\t0\t41\t\t\t16\t1\t0\t1\t40460\t\tr19\tr19\tr19\t16\t1\t1\t0\t0\t0\tflprun\tinvrFal\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Lem Rune\t1\t100\t43\t0\t43\t\t\t17\t1\t0\t1\t45360\t\tr20\tr20\tr20\t16\t1\t1\t0\t0\t0\tflprun\tinvrLem\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Pul Rune\t1\t100\t45\t0\t45\t\t\t18\t1\t0\t1\t50540\t\tr21\tr21\tr21\t16\t1\t1\t0\t0\t0\tflprun\tinvrPul\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Um Rune\t1\t100\t47\t0\t47\t\t\t19\t1\t0\t1\t56000\t\tr22\tr22\tr22\t16\t1\t1\t0\t0\t0\tflprun\tinvrUm\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Mal Rune\t1\t100\t49\t0\t49\t\t\t20\t1\t0\t1\t61740\t\tr23\tr23\tr23\t16\t1\t1\t0\t0\t0\tflprun\tinvrMal\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ist Rune\t1\t100\t51\t0\t51\t\t\t21\t1\t0\t1\t67760\t\tr24\tr24\tr24\t16\t1\t1\t0\t0\t0\tflprun\tinvrIst\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Gul Rune\t1\t100\t53\t0\t53\t\t\t22\t1\t0\t1\t74060\t\tr25\tr25\tr25\t16\t1\t1\t0\t0\t0\tflprun\tinvrGul\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Vex Rune\t1\t100\t55\t0\t55\t\t\t23\t1\t0\t1\t80640\t\tr26\tr26\tr26\t16\t1\t1\t0\t0\t0\tflprun\tinvrVex\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ohm Rune\t1\t100\t57\t0\t57\t\t\t24\t1\t0\t1\t87500\t\tr27\tr27\tr27\t16\t1\t1\t0\t0\t0\tflprun\tinvrOhm\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Lo Rune\t1\t100\t59\t0\t59\t\t\t25\t1\t0\t1\t94640\t\tr28\tr28\tr28\t16\t1\t1\t0\t0\t0\tflprun\tinvrLo\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Sur Rune\t1\t100\t61\t0\t61\t\t\t26\t1\t0\t1\t102060\t\tr29\tr29\tr29\t16\t1\t1\t0\t0\t0\tflprun\tinvrSur\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Ber Rune\t1\t100\t63\t0\t63\t\t\t27\t1\t0\t1\t109760\t\tr30\tr30\tr30\t16\t1\t1\t0\t0\t0\tflprun\tinvrBer\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Jah Rune\t1\t100\t65\t0\t65\t\t\t28\t1\t0\t1\t117740\t\tr31\tr31\tr31\t16\t1\t1\t0\t0\t0\tflprun\tinvrJo\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Cham Rune\t1\t100\t67\t0\t67\t\t\t29\t1\t0\t1\t126000\t\tr32\tr32\tr32\t16\t1\t1\t0\t0\t0\tflprun\tinvrCham\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Zod Rune\t1\t100\t69\t0\t69\t\t\t30\t1\t0\t1\t134540\t\tr33\tr33\tr33\t16\t1\t1\t0\t0\t0\tflprun\tinvrZod\t\t0\txxx\t\t\t0\trune\t\titem_rune\t12\titem_rune\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Jewel\t0\t100\t1\t0\t0\t\t\t8\t1\t0\t1\t1000\t\tjew\tgpw\tjew\t16\t1\t1\t0\t0\t0\tflpgsw\tinvgswe\t\t0\txxx\t\t\t0\tjewl\t\titem_jewel\t12\titem_jewel\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Malah's Potion\t0\t100\t0\t0\t0\t\t\t999\t0\t0\t1\t10000\t\tice\tscr\tice\t16\t1\t1\t0\t0\t0\tflpwps\tinvxyz\t\t0\txxx\t\t\t0\tques\t\titem_potion\t14\titem_potion_drink\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t32\t1\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t1\tMalahsPotionDescription\t\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Scroll of Knowledge\t0\t100\t0\t0\t0\t\t\t0\t1\t0\t1\t100\t\t0sc\trsc\t0sc\t16\t1\t1\t0\t0\t0\tflprsc\tinvrsc\t\t0\txxx\t\t\t0\tscro\t\titem_scroll\t10\titem_scroll\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Scroll of Resistance\t1\t100\t0\t0\t0\t\t\t999\t0\t0\t1\t0\t\ttr2\tscr\ttr2\t16\t2\t2\t0\t0\t0\tflpscr\tinvscb\t\t0\txxx\t\t\t1\tques\t\titem_scroll\t10\titem_scroll\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t32\t1\t0\t-1\t12\t\t\t\t\t\t\t\t\t\t\t1\tUseScrollOfResistance\tUseScrollOfResistanceController\t\t4\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Key of Terror\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t99999\t\tpk1\tkey\tpk1\t16\t1\t2\t0\t0\t0\tflpmph\tinvmph\t\t0\txxx\t\t\t0\tques\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Key of Hate\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t99999\t\tpk2\tkey\tpk2\t16\t1\t2\t0\t0\t0\tflpmph\tinvmph\t\t0\txxx\t\t\t0\tques\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Key of Destruction\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t99999\t\tpk3\tkey\tpk3\t16\t1\t2\t0\t0\t0\tflpmph\tinvmph\t\t0\txxx\t\t\t0\tques\t\titem_key\t12\titem_key\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Diablo's Horn\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t80\t\tdhn\tfng\tdhn\t16\t1\t1\t0\t0\t0\tflpfang\tinvfang\t\t0\txxx\t\t\t0\tques\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Baal's Eye\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t80\t\tbey\teyz\tbey\t16\t1\t1\t0\t0\t0\tflpeye\tinveye\t\t0\txxx\t\t\t0\tques\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Mephisto's Brain\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t80\t\tmbr\tbrz\tmbr\t16\t1\t1\t0\t0\t0\tflpbrnz\tinvbrnz\t\t0\txxx\t\t\t0\tques\t\titem_monsterbone\t12\titem_monsterbone\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Token of Absolution\t0\t100\t0\t0\t0\t\t\t999\t0\t0\t1\t99999\t\ttoa\ttoa\ttoa\t16\t1\t1\t0\t0\t0\tflprun\tinvtoa\t\t0\txxx\t\t\t1\tques\t\titem_amulet\t14\titem_book\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t13\t\t\t\t\t\t\t\t\t\t\t1\tUseTokenOfAbsolution\tUseTokenOfAbsolutionController\t\t8\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Twisted Essence of Suffering\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t10000\t\ttes\tfng\ttes\t16\t1\t1\t0\t0\t0\tflpgsb\tinvtes\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\titem_rare\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Charged Essense of Hatred\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t10000\t\tceh\teyz\tceh\t16\t1\t1\t0\t0\t0\tflpgsy\tinvceh\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\titem_rare\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Burning Essence of Terror\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t10000\t\tbet\tfng\tbet\t16\t1\t1\t0\t0\t0\tflpgsr\tinvbet\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\titem_rare\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Festering Essence of Destruction\t0\t100\t0\t0\t0\t\t\t1\t0\t0\t1\t10000\t\tfed\tbrz\tfed\t16\t1\t1\t0\t0\t0\tflpgsg\tinvfed\t\t0\txxx\t\t\t0\tques\t\titem_rare\t12\titem_rare\t0\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n",
+                u8"Standard of Heroes\t0\t100\t90\t0\t90\t\t\t4\t1\t0\t1\t2000\t\tstd\tflg\tstd\t16\t1\t1\t0\t0\t0\tflpflag\tinvflag\t\t0\txxx\t\t\t0\tques\t\titem_charm\t12\titem_charm\t1\t0\t5\t0\t0\t0\t0\t0\t0\t0\t\t\t0\t-1\t-1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t0\tnon\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t\t\t\t\t\t\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,9016 +18,9012 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace JsonReaderHelper
     {
-        const std::string& GetMonsters()
+        EmbeddedText GetMonsters()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"[\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1014,\n";
-                ss << u8"    \"Key\": \"Izual\",\n";
-                ss << u8"    \"enUS\": \"Izual\",\n";
-                ss << u8"    \"zhTW\": \"伊卒爾\",\n";
-                ss << u8"    \"deDE\": \"Izual\",\n";
-                ss << u8"    \"esES\": \"Izual\",\n";
-                ss << u8"    \"frFR\": \"Izual\",\n";
-                ss << u8"    \"itIT\": \"Izual\",\n";
-                ss << u8"    \"koKR\": \"이주알\",\n";
-                ss << u8"    \"plPL\": \"Izual\",\n";
-                ss << u8"    \"esMX\": \"Izual\",\n";
-                ss << u8"    \"jaJP\": \"イズアル\",\n";
-                ss << u8"    \"ptBR\": \"Izual\",\n";
-                ss << u8"    \"ruRU\": \"Изуал\",\n";
-                ss << u8"    \"zhCN\": \"衣卒尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1015,\n";
-                ss << u8"    \"Key\": \"izual\",\n";
-                ss << u8"    \"enUS\": \"Izual\",\n";
-                ss << u8"    \"zhTW\": \"伊卒爾\",\n";
-                ss << u8"    \"deDE\": \"Izual\",\n";
-                ss << u8"    \"esES\": \"Izual\",\n";
-                ss << u8"    \"frFR\": \"Izual\",\n";
-                ss << u8"    \"itIT\": \"Izual\",\n";
-                ss << u8"    \"koKR\": \"이주알\",\n";
-                ss << u8"    \"plPL\": \"Izual\",\n";
-                ss << u8"    \"esMX\": \"Izual\",\n";
-                ss << u8"    \"jaJP\": \"イズアル\",\n";
-                ss << u8"    \"ptBR\": \"Izual\",\n";
-                ss << u8"    \"ruRU\": \"Изуал\",\n";
-                ss << u8"    \"zhCN\": \"衣卒尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1067,\n";
-                ss << u8"    \"Key\": \"The Feature Creep\",\n";
-                ss << u8"    \"enUS\": \"Hephasto The Armorer\",\n";
-                ss << u8"    \"zhTW\": \"護甲鍛造師海法斯特\",\n";
-                ss << u8"    \"deDE\": \"Hephaisto der Schmied\",\n";
-                ss << u8"    \"esES\": \"Hefasto el Fabricante de Armaduras\",\n";
-                ss << u8"    \"frFR\": \"Hephasto l’Armurier\",\n";
-                ss << u8"    \"itIT\": \"Efesto l'Armaiolo\",\n";
-                ss << u8"    \"koKR\": \"대장장이 헤파스토\",\n";
-                ss << u8"    \"plPL\": \"Hefasto Zbrojmistrz\",\n";
-                ss << u8"    \"esMX\": \"Efasto el Armero\",\n";
-                ss << u8"    \"jaJP\": \"鎧職人へファスト\",\n";
-                ss << u8"    \"ptBR\": \"Hefasto, o Armoreiro\",\n";
-                ss << u8"    \"ruRU\": \"Гефасто Оружейник\",\n";
-                ss << u8"    \"zhCN\": \"铸甲师赫法斯托\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1068,\n";
-                ss << u8"    \"Key\": \"Hell Bovine\",\n";
-                ss << u8"    \"enUS\": \"Hell Bovine\",\n";
-                ss << u8"    \"zhTW\": \"地獄之牛\",\n";
-                ss << u8"    \"deDE\": \"Höllenbulle\",\n";
-                ss << u8"    \"esES\": \"Bovino del infierno\",\n";
-                ss << u8"    \"frFR\": \"Bovin des Enfers\",\n";
-                ss << u8"    \"itIT\": \"Bovino Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥 젖소\",\n";
-                ss << u8"    \"plPL\": \"Piekielna krowa\",\n";
-                ss << u8"    \"esMX\": \"Bovino infernal\",\n";
-                ss << u8"    \"jaJP\": \"地獄の牛\",\n";
-                ss << u8"    \"ptBR\": \"Bovino Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Адская корова\",\n";
-                ss << u8"    \"zhCN\": \"地狱魔牛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1235,\n";
-                ss << u8"    \"Key\": \"nodarkwanderer\",\n";
-                ss << u8"    \"enUS\": \"Not in Game\",\n";
-                ss << u8"    \"zhTW\": \"Not in Game\",\n";
-                ss << u8"    \"deDE\": \"Nicht im Spiel\",\n";
-                ss << u8"    \"esES\": \"Not in Game\",\n";
-                ss << u8"    \"frFR\": \"Pas dans le jeu\",\n";
-                ss << u8"    \"itIT\": \"Non in gioco\",\n";
-                ss << u8"    \"koKR\": \"게임에 없음\",\n";
-                ss << u8"    \"plPL\": \"Nie występuje w grze\",\n";
-                ss << u8"    \"esMX\": \"No está en la partida\",\n";
-                ss << u8"    \"jaJP\": \"ゲーム未登場\",\n";
-                ss << u8"    \"ptBR\": \"Não está no jogo\",\n";
-                ss << u8"    \"ruRU\": \"Не в игре\",\n";
-                ss << u8"    \"zhCN\": \"不在游戏中\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1580,\n";
-                ss << u8"    \"Key\": \"Seige Beast\",\n";
-                ss << u8"    \"enUS\": \"           \",\n";
-                ss << u8"    \"zhTW\": \"           \",\n";
-                ss << u8"    \"deDE\": \"           \",\n";
-                ss << u8"    \"esES\": \"           \",\n";
-                ss << u8"    \"frFR\": \"           \",\n";
-                ss << u8"    \"itIT\": \"           \",\n";
-                ss << u8"    \"koKR\": \"Seige Beast\",\n";
-                ss << u8"    \"plPL\": \"           \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1611,\n";
-                ss << u8"    \"Key\": \"BlightWing\",\n";
-                ss << u8"    \"enUS\": \"           \",\n";
-                ss << u8"    \"zhTW\": \"           \",\n";
-                ss << u8"    \"deDE\": \"           \",\n";
-                ss << u8"    \"esES\": \"           \",\n";
-                ss << u8"    \"frFR\": \"           \",\n";
-                ss << u8"    \"itIT\": \"           \",\n";
-                ss << u8"    \"koKR\": \"Blight Wing\",\n";
-                ss << u8"    \"plPL\": \"           \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1612,\n";
-                ss << u8"    \"Key\": \"BloodWitch\",\n";
-                ss << u8"    \"enUS\": \"           \",\n";
-                ss << u8"    \"zhTW\": \"           \",\n";
-                ss << u8"    \"deDE\": \"           \",\n";
-                ss << u8"    \"esES\": \"           \",\n";
-                ss << u8"    \"frFR\": \"           \",\n";
-                ss << u8"    \"itIT\": \"           \",\n";
-                ss << u8"    \"koKR\": \"Blood Witch\",\n";
-                ss << u8"    \"plPL\": \"           \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1616,\n";
-                ss << u8"    \"Key\": \"MageWing\",\n";
-                ss << u8"    \"enUS\": \"         \",\n";
-                ss << u8"    \"zhTW\": \"         \",\n";
-                ss << u8"    \"deDE\": \"         \",\n";
-                ss << u8"    \"esES\": \"         \",\n";
-                ss << u8"    \"frFR\": \"         \",\n";
-                ss << u8"    \"itIT\": \"         \",\n";
-                ss << u8"    \"koKR\": \"Mage Wing\",\n";
-                ss << u8"    \"plPL\": \"         \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1617,\n";
-                ss << u8"    \"Key\": \"HellWitch\",\n";
-                ss << u8"    \"enUS\": \"          \",\n";
-                ss << u8"    \"zhTW\": \"          \",\n";
-                ss << u8"    \"deDE\": \"          \",\n";
-                ss << u8"    \"esES\": \"          \",\n";
-                ss << u8"    \"frFR\": \"          \",\n";
-                ss << u8"    \"itIT\": \"          \",\n";
-                ss << u8"    \"koKR\": \"Hell Witch\",\n";
-                ss << u8"    \"plPL\": \"          \",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2286,\n";
-                ss << u8"    \"Key\": \"GhoulRI\",\n";
-                ss << u8"    \"enUS\": \"Ghoul\",\n";
-                ss << u8"    \"zhTW\": \"食屍鬼\",\n";
-                ss << u8"    \"deDE\": \"Ghul\",\n";
-                ss << u8"    \"esES\": \"Necrófago\",\n";
-                ss << u8"    \"frFR\": \"Goule\",\n";
-                ss << u8"    \"itIT\": \"Mangiamorti\",\n";
-                ss << u8"    \"koKR\": \"구울\",\n";
-                ss << u8"    \"plPL\": \"[fs]Krwiopijcza[ms]Krwiopijczy[nl]Krwiopijcze\",\n";
-                ss << u8"    \"esMX\": \"[ms]de necrófago[fs]de necrófago[mp]de necrófago[fp]de necrófago\",\n";
-                ss << u8"    \"jaJP\": \"グールの\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Carniçal[ms]Carniçal[fp]Carniçais[mp]Carniçais\",\n";
-                ss << u8"    \"ruRU\": \"[ms]вурдалачий[fs]вурдалачья[ns]вурдалачье[pl]вурдалачьи\",\n";
-                ss << u8"    \"zhCN\": \"食尸鬼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2349,\n";
-                ss << u8"    \"Key\": \"crusher\",\n";
-                ss << u8"    \"enUS\": \"Crusher\",\n";
-                ss << u8"    \"zhTW\": \"粉碎者\",\n";
-                ss << u8"    \"deDE\": \"Zermalmer\",\n";
-                ss << u8"    \"esES\": \"Machacadora\",\n";
-                ss << u8"    \"frFR\": \"Broyeur\",\n";
-                ss << u8"    \"itIT\": \"Demolitore\",\n";
-                ss << u8"    \"koKR\": \"분쇄자\",\n";
-                ss << u8"    \"plPL\": \"Miażdżyciel\",\n";
-                ss << u8"    \"esMX\": \"Triturador\",\n";
-                ss << u8"    \"jaJP\": \"壊滅者\",\n";
-                ss << u8"    \"ptBR\": \"Esmagador\",\n";
-                ss << u8"    \"ruRU\": \"Сокрушитель\",\n";
-                ss << u8"    \"zhCN\": \"暴砸兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2463,\n";
-                ss << u8"    \"Key\": \"scarab\",\n";
-                ss << u8"    \"enUS\": \"Scarab\",\n";
-                ss << u8"    \"zhTW\": \"惡魔甲蟲\",\n";
-                ss << u8"    \"deDE\": \"Skarabäus\",\n";
-                ss << u8"    \"esES\": \"Alfazaque\",\n";
-                ss << u8"    \"frFR\": \"Scarabée\",\n";
-                ss << u8"    \"itIT\": \"Scarabeo\",\n";
-                ss << u8"    \"koKR\": \"풍뎅이\",\n";
-                ss << u8"    \"plPL\": \"Skarabeusz\",\n";
-                ss << u8"    \"esMX\": \"Escarabajo\",\n";
-                ss << u8"    \"jaJP\": \"スカラベ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Escaravelho\",\n";
-                ss << u8"    \"ruRU\": \"Скарабей\",\n";
-                ss << u8"    \"zhCN\": \"圣甲虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2850,\n";
-                ss << u8"    \"Key\": \"The Cow King\",\n";
-                ss << u8"    \"enUS\": \"The Cow King\",\n";
-                ss << u8"    \"zhTW\": \"牛王\",\n";
-                ss << u8"    \"deDE\": \"Der Kuhkönig\",\n";
-                ss << u8"    \"esES\": \"Rey de las Vacas\",\n";
-                ss << u8"    \"frFR\": \"Le roi des vaches\",\n";
-                ss << u8"    \"itIT\": \"Il Re Bovino\",\n";
-                ss << u8"    \"koKR\": \"젖소 왕\",\n";
-                ss << u8"    \"plPL\": \"Krowi Król\",\n";
-                ss << u8"    \"esMX\": \"El Rey Vaca\",\n";
-                ss << u8"    \"jaJP\": \"牛王\",\n";
-                ss << u8"    \"ptBR\": \"O Rei Vaca\",\n";
-                ss << u8"    \"ruRU\": \"Коровий король\",\n";
-                ss << u8"    \"zhCN\": \"母牛之王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2851,\n";
-                ss << u8"    \"Key\": \"Grand Vizier of Chaos\",\n";
-                ss << u8"    \"enUS\": \"Grand Vizier of Chaos\",\n";
-                ss << u8"    \"zhTW\": \"混沌首相\",\n";
-                ss << u8"    \"deDE\": \"Großwesir des Chaos\",\n";
-                ss << u8"    \"esES\": \"Gran Visir del Caos\",\n";
-                ss << u8"    \"frFR\": \"Grand vizir du Chaos\",\n";
-                ss << u8"    \"itIT\": \"Gran Visir del Caos\",\n";
-                ss << u8"    \"koKR\": \"혼돈의 대장로\",\n";
-                ss << u8"    \"plPL\": \"Wielki Wezyr Chaosu\",\n";
-                ss << u8"    \"esMX\": \"Gran Visir del Caos\",\n";
-                ss << u8"    \"jaJP\": \"混沌の大宰相\",\n";
-                ss << u8"    \"ptBR\": \"Grão-vizir do Caos\",\n";
-                ss << u8"    \"ruRU\": \"Великий визирь хаоса\",\n";
-                ss << u8"    \"zhCN\": \"混沌之大维兹尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2852,\n";
-                ss << u8"    \"Key\": \"Lord De Seis\",\n";
-                ss << u8"    \"enUS\": \"Lord De Seis\",\n";
-                ss << u8"    \"zhTW\": \"迪塞斯勳爵\",\n";
-                ss << u8"    \"deDE\": \"Fürst de Seis\",\n";
-                ss << u8"    \"esES\": \"Señor De Seis\",\n";
-                ss << u8"    \"frFR\": \"Seigneur de Seis\",\n";
-                ss << u8"    \"itIT\": \"Lord De Seis\",\n";
-                ss << u8"    \"koKR\": \"군주 사이스\",\n";
-                ss << u8"    \"plPL\": \"Lord De Seis\",\n";
-                ss << u8"    \"esMX\": \"Señor de Seis\",\n";
-                ss << u8"    \"jaJP\": \"サイス卿\",\n";
-                ss << u8"    \"ptBR\": \"Lorde De Seis\",\n";
-                ss << u8"    \"ruRU\": \"Лорд Де Зейс\",\n";
-                ss << u8"    \"zhCN\": \"希斯王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2853,\n";
-                ss << u8"    \"Key\": \"Infector of Souls\",\n";
-                ss << u8"    \"enUS\": \"Infector of Souls\",\n";
-                ss << u8"    \"zhTW\": \"靈魂傳播者\",\n";
-                ss << u8"    \"deDE\": \"Vergifter der Seelen\",\n";
-                ss << u8"    \"esES\": \"Infectador de Almas\",\n";
-                ss << u8"    \"frFR\": \"Corrupteur d’âmes\",\n";
-                ss << u8"    \"itIT\": \"Contaminatore di Anime\",\n";
-                ss << u8"    \"koKR\": \"영혼의 잠식자\",\n";
-                ss << u8"    \"plPL\": \"Zatruwacz Dusz\",\n";
-                ss << u8"    \"esMX\": \"Corruptor de Almas\",\n";
-                ss << u8"    \"jaJP\": \"魂を汚す者\",\n";
-                ss << u8"    \"ptBR\": \"Infestador de Almas\",\n";
-                ss << u8"    \"ruRU\": \"Заразитель душ\",\n";
-                ss << u8"    \"zhCN\": \"灵魂传播者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2854,\n";
-                ss << u8"    \"Key\": \"Riftwraith the Cannibal\",\n";
-                ss << u8"    \"enUS\": \"Riftwraith the Cannibal\",\n";
-                ss << u8"    \"zhTW\": \"食人的裂口之怒\",\n";
-                ss << u8"    \"deDE\": \"Spaltengeist der Kannibale\",\n";
-                ss << u8"    \"esES\": \"Ánima de Falla el Caníbal\",\n";
-                ss << u8"    \"frFR\": \"Spectre-Faille le Cannibale\",\n";
-                ss << u8"    \"itIT\": \"Varcospettro il Cannibale\",\n";
-                ss << u8"    \"koKR\": \"식인귀 리프트레이스\",\n";
-                ss << u8"    \"plPL\": \"Upiór Cienia\",\n";
-                ss << u8"    \"esMX\": \"Grietavil el Caníbal\",\n";
-                ss << u8"    \"jaJP\": \"人食いのリフトレイス\",\n";
-                ss << u8"    \"ptBR\": \"Espectral, o Canibal\",\n";
-                ss << u8"    \"ruRU\": \"Безднород Каннибал\",\n";
-                ss << u8"    \"zhCN\": \"裂隙怨魂·食人者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2855,\n";
-                ss << u8"    \"Key\": \"Taintbreeder\",\n";
-                ss << u8"    \"enUS\": \"Taintbreeder\",\n";
-                ss << u8"    \"zhTW\": \"汙染飼育者\",\n";
-                ss << u8"    \"deDE\": \"Übelbringer\",\n";
-                ss << u8"    \"esES\": \"Contaminador\",\n";
-                ss << u8"    \"frFR\": \"Le grand Corrupteur\",\n";
-                ss << u8"    \"itIT\": \"Contaminatore\",\n";
-                ss << u8"    \"koKR\": \"테인트브리더\",\n";
-                ss << u8"    \"plPL\": \"Plugawiciel\",\n";
-                ss << u8"    \"esMX\": \"Reproductor Impío\",\n";
-                ss << u8"    \"jaJP\": \"腐れの源\",\n";
-                ss << u8"    \"ptBR\": \"Maculador\",\n";
-                ss << u8"    \"ruRU\": \"Сеятель гнили\",\n";
-                ss << u8"    \"zhCN\": \"腐化滋生者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2856,\n";
-                ss << u8"    \"Key\": \"The Tormentor\",\n";
-                ss << u8"    \"enUS\": \"The Tormentor\",\n";
-                ss << u8"    \"zhTW\": \"折磨者\",\n";
-                ss << u8"    \"deDE\": \"der Quäler\",\n";
-                ss << u8"    \"esES\": \"El Atormentador\",\n";
-                ss << u8"    \"frFR\": \"Le Tourmenteur\",\n";
-                ss << u8"    \"itIT\": \"Il Tormentatore\",\n";
-                ss << u8"    \"koKR\": \"고통을 주는 자\",\n";
-                ss << u8"    \"plPL\": \"Oprawca\",\n";
-                ss << u8"    \"esMX\": \"El Atormentador\",\n";
-                ss << u8"    \"jaJP\": \"トーメンター\",\n";
-                ss << u8"    \"ptBR\": \"O Atormentador\",\n";
-                ss << u8"    \"ruRU\": \"Мучитель\",\n";
-                ss << u8"    \"zhCN\": \"折磨者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2857,\n";
-                ss << u8"    \"Key\": \"Winged Death\",\n";
-                ss << u8"    \"enUS\": \"Darkwing\",\n";
-                ss << u8"    \"zhTW\": \"黑暗之翼\",\n";
-                ss << u8"    \"deDE\": \"Schwarzschwinge\",\n";
-                ss << u8"    \"esES\": \"Ala Negra\",\n";
-                ss << u8"    \"frFR\": \"Aile-sombre\",\n";
-                ss << u8"    \"itIT\": \"Alacupa\",\n";
-                ss << u8"    \"koKR\": \"암흑의 날개\",\n";
-                ss << u8"    \"plPL\": \"Ciemnoskrzydły\",\n";
-                ss << u8"    \"esMX\": \"Alanoche\",\n";
-                ss << u8"    \"jaJP\": \"闇の翼\",\n";
-                ss << u8"    \"ptBR\": \"Asa Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Темнокрыл\",\n";
-                ss << u8"    \"zhCN\": \"黑暗之翼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2858,\n";
-                ss << u8"    \"Key\": \"Maffer Dragonhand\",\n";
-                ss << u8"    \"enUS\": \"Maffer Dragonhand\",\n";
-                ss << u8"    \"zhTW\": \"龍手馬弗\",\n";
-                ss << u8"    \"deDE\": \"Maffer Drachenhand\",\n";
-                ss << u8"    \"esES\": \"Maffer Mano de Dragón\",\n";
-                ss << u8"    \"frFR\": \"Maffer Main-de-Dragon\",\n";
-                ss << u8"    \"itIT\": \"Maffer Mano di Drago\",\n";
-                ss << u8"    \"koKR\": \"매퍼 드래곤핸드\",\n";
-                ss << u8"    \"plPL\": \"Maffer Smokoręki\",\n";
-                ss << u8"    \"esMX\": \"Maffer Mano de Dragón\",\n";
-                ss << u8"    \"jaJP\": \"竜掌のマファー\",\n";
-                ss << u8"    \"ptBR\": \"Maffer Dracomano\",\n";
-                ss << u8"    \"ruRU\": \"Маффер Драконорукий\",\n";
-                ss << u8"    \"zhCN\": \"马弗·龙手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2859,\n";
-                ss << u8"    \"Key\": \"Wyand Voidfinger\",\n";
-                ss << u8"    \"enUS\": \"Wyand Voidbringer\",\n";
-                ss << u8"    \"zhTW\": \"虛空指維恩\",\n";
-                ss << u8"    \"deDE\": \"Wyand Todbringer\",\n";
-                ss << u8"    \"esES\": \"Wyand el Vaciador\",\n";
-                ss << u8"    \"frFR\": \"Wyand Porte-Vide\",\n";
-                ss << u8"    \"itIT\": \"Wyand Latore del Vuoto\",\n";
-                ss << u8"    \"koKR\": \"와이앤드 보이드브링어\",\n";
-                ss << u8"    \"plPL\": \"Wyand Pustoszyciel\",\n";
-                ss << u8"    \"esMX\": \"Wyand Portavacío\",\n";
-                ss << u8"    \"jaJP\": \"虚無の遣いワイアンド\",\n";
-                ss << u8"    \"ptBR\": \"Wyand Nulificante\",\n";
-                ss << u8"    \"ruRU\": \"Вианд Призыватель Бездны\",\n";
-                ss << u8"    \"zhCN\": \"韦恩·虚空使者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2860,\n";
-                ss << u8"    \"Key\": \"Toorc Icefist\",\n";
-                ss << u8"    \"enUS\": \"Toorc Icefist\",\n";
-                ss << u8"    \"zhTW\": \"冰拳托克\",\n";
-                ss << u8"    \"deDE\": \"Toorc Eisfaust\",\n";
-                ss << u8"    \"esES\": \"Toorc Puño de Hielo\",\n";
-                ss << u8"    \"frFR\": \"Toorc Poing-de-Glace\",\n";
-                ss << u8"    \"itIT\": \"Toorc Pugno di Ghiaccio\",\n";
-                ss << u8"    \"koKR\": \"투르크 아이스피스트\",\n";
-                ss << u8"    \"plPL\": \"Toorc Lodowa Pięść\",\n";
-                ss << u8"    \"esMX\": \"Toorc Puño de Hielo\",\n";
-                ss << u8"    \"jaJP\": \"氷拳のトゥールク\",\n";
-                ss << u8"    \"ptBR\": \"Toorc Punhofrio\",\n";
-                ss << u8"    \"ruRU\": \"Турк Ледяной Кулак\",\n";
-                ss << u8"    \"zhCN\": \"托克·冰拳\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2861,\n";
-                ss << u8"    \"Key\": \"Bremm Sparkfist\",\n";
-                ss << u8"    \"enUS\": \"Bremm Sparkfist\",\n";
-                ss << u8"    \"zhTW\": \"電光拳布瑞姆\",\n";
-                ss << u8"    \"deDE\": \"Bremm Funkenfaust\",\n";
-                ss << u8"    \"esES\": \"Bremm Puño de Chispas\",\n";
-                ss << u8"    \"frFR\": \"Bremm Poing-de-Feu\",\n";
-                ss << u8"    \"itIT\": \"Bremm Pugno di Folgore\",\n";
-                ss << u8"    \"koKR\": \"브렘 스파크피스트\",\n";
-                ss << u8"    \"plPL\": \"Bremm Iskrząca Pięść\",\n";
-                ss << u8"    \"esMX\": \"Bremm Puño Chispeante\",\n";
-                ss << u8"    \"jaJP\": \"閃拳のブレム\",\n";
-                ss << u8"    \"ptBR\": \"Bremm Punho Faiscante\",\n";
-                ss << u8"    \"ruRU\": \"Бремм Искристый Кулак\",\n";
-                ss << u8"    \"zhCN\": \"布瑞姆·火花之拳\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2862,\n";
-                ss << u8"    \"Key\": \"Geleb Flamefinger\",\n";
-                ss << u8"    \"enUS\": \"Geleb Flamefinger\",\n";
-                ss << u8"    \"zhTW\": \"火焰指吉列布\",\n";
-                ss << u8"    \"deDE\": \"Geleb Flammenfinger\",\n";
-                ss << u8"    \"esES\": \"Geleb Dedo Ardiente\",\n";
-                ss << u8"    \"frFR\": \"Geleb Doigts-de-Feu\",\n";
-                ss << u8"    \"itIT\": \"Geleb Dito di Fiamma\",\n";
-                ss << u8"    \"koKR\": \"겔레브 플레임핑거\",\n";
-                ss << u8"    \"plPL\": \"Geleb Ognistopalcy\",\n";
-                ss << u8"    \"esMX\": \"Geleb Dedo Llameante\",\n";
-                ss << u8"    \"jaJP\": \"炎指のゲレブ\",\n";
-                ss << u8"    \"ptBR\": \"Geleb Incendiário\",\n";
-                ss << u8"    \"ruRU\": \"Гелеб Огнепал\",\n";
-                ss << u8"    \"zhCN\": \"吉勒布·火焰指\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2863,\n";
-                ss << u8"    \"Key\": \"Ismail Vilehand\",\n";
-                ss << u8"    \"enUS\": \"Ismail Vilehand\",\n";
-                ss << u8"    \"zhTW\": \"邪之手伊斯梅爾\",\n";
-                ss << u8"    \"deDE\": \"Ismail Übelhand\",\n";
-                ss << u8"    \"esES\": \"Ismail Mano Vil\",\n";
-                ss << u8"    \"frFR\": \"Ismail Brise-Main\",\n";
-                ss << u8"    \"itIT\": \"Ismail Mano Vile\",\n";
-                ss << u8"    \"koKR\": \"이스마일 바일핸드\",\n";
-                ss << u8"    \"plPL\": \"Ismail Plugaworęki\",\n";
-                ss << u8"    \"esMX\": \"Ismail Manovil\",\n";
-                ss << u8"    \"jaJP\": \"邪掌のイスマイル\",\n";
-                ss << u8"    \"ptBR\": \"Ismail Vilmano\",\n";
-                ss << u8"    \"ruRU\": \"Исмаил Мерзорукий\",\n";
-                ss << u8"    \"zhCN\": \"伊斯梅尔·邪手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2864,\n";
-                ss << u8"    \"Key\": \"Icehawk Riftwing\",\n";
-                ss << u8"    \"enUS\": \"Icehawk Riftwing\",\n";
-                ss << u8"    \"zhTW\": \"裂隙之翼冰鷹\",\n";
-                ss << u8"    \"deDE\": \"Eisfalke Riftflügel\",\n";
-                ss << u8"    \"esES\": \"Alafalla Gerifalte de Hielo\",\n";
-                ss << u8"    \"frFR\": \"Froid-faucon de la faille\",\n";
-                ss << u8"    \"itIT\": \"Gelofalco Alavarco\",\n";
-                ss << u8"    \"koKR\": \"아이스호크 리프트윙\",\n";
-                ss << u8"    \"plPL\": \"Szczelinoskrzydły\",\n";
-                ss << u8"    \"esMX\": \"Alagélida de la Grieta\",\n";
-                ss << u8"    \"jaJP\": \"八つ裂く翼のアイスホーク\",\n";
-                ss << u8"    \"ptBR\": \"Asafenda Gélido\",\n";
-                ss << u8"    \"ruRU\": \"Когтистый ледокрыл\",\n";
-                ss << u8"    \"zhCN\": \"冰鹰·裂痕之翼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2865,\n";
-                ss << u8"    \"Key\": \"Sarina the Battlemaid\",\n";
-                ss << u8"    \"enUS\": \"Battlemaid Sarina\",\n";
-                ss << u8"    \"zhTW\": \"戰場女傑莎莉娜\",\n";
-                ss << u8"    \"deDE\": \"Kampfmaid Sarina\",\n";
-                ss << u8"    \"esES\": \"Doncella Guerrera Sarina\",\n";
-                ss << u8"    \"frFR\": \"Sarina la Vestale\",\n";
-                ss << u8"    \"itIT\": \"Sarina la Guerriera\",\n";
-                ss << u8"    \"koKR\": \"여전사 사리나\",\n";
-                ss << u8"    \"plPL\": \"Wojowniczka Sarina\",\n";
-                ss << u8"    \"esMX\": \"Doncella Sarina\",\n";
-                ss << u8"    \"jaJP\": \"バトルメイド・サリナ\",\n";
-                ss << u8"    \"ptBR\": \"Guerreira Sarina\",\n";
-                ss << u8"    \"ruRU\": \"Дева битвы Сарина\",\n";
-                ss << u8"    \"zhCN\": \"战斗侍女沙利娜\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2866,\n";
-                ss << u8"    \"Key\": \"Stormtree\",\n";
-                ss << u8"    \"enUS\": \"Stormtree\",\n";
-                ss << u8"    \"zhTW\": \"暴風之樹\",\n";
-                ss << u8"    \"deDE\": \"Sturmbaum\",\n";
-                ss << u8"    \"esES\": \"Árbol de Tormenta\",\n";
-                ss << u8"    \"frFR\": \"Arbre-Tonnerre\",\n";
-                ss << u8"    \"itIT\": \"Albero delle Tempeste\",\n";
-                ss << u8"    \"koKR\": \"스톰트리\",\n";
-                ss << u8"    \"plPL\": \"Burzowe Drzewo\",\n";
-                ss << u8"    \"esMX\": \"Árbol Tormentoso\",\n";
-                ss << u8"    \"jaJP\": \"ストームツリー\",\n";
-                ss << u8"    \"ptBR\": \"Tempestárvore\",\n";
-                ss << u8"    \"ruRU\": \"Древо бури\",\n";
-                ss << u8"    \"zhCN\": \"树木风暴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2867,\n";
-                ss << u8"    \"Key\": \"Witch Doctor Endugu\",\n";
-                ss << u8"    \"enUS\": \"Witch Doctor Endugu\",\n";
-                ss << u8"    \"zhTW\": \"巫醫印都古\",\n";
-                ss << u8"    \"deDE\": \"Hexendoktor Endugu\",\n";
-                ss << u8"    \"esES\": \"Hechicero Curandero Endugu\",\n";
-                ss << u8"    \"frFR\": \"Endugu le féticheur\",\n";
-                ss << u8"    \"itIT\": \"Stregone Endugu\",\n";
-                ss << u8"    \"koKR\": \"부두술사 엔두구\",\n";
-                ss << u8"    \"plPL\": \"Szaman Endugu\",\n";
-                ss << u8"    \"esMX\": \"Santero Endugu\",\n";
-                ss << u8"    \"jaJP\": \"呪術医エンドゥグ\",\n";
-                ss << u8"    \"ptBR\": \"Feiticeiro Endugu\",\n";
-                ss << u8"    \"ruRU\": \"Колдун Эндугу\",\n";
-                ss << u8"    \"zhCN\": \"巫医恩杜古\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2868,\n";
-                ss << u8"    \"Key\": \"Web Mage the Burning\",\n";
-                ss << u8"    \"enUS\": \"Sszark the Burning\",\n";
-                ss << u8"    \"zhTW\": \"灼熱的斯札克\",\n";
-                ss << u8"    \"deDE\": \"Zark der Brenner\",\n";
-                ss << u8"    \"esES\": \"Sszark la Ardiente\",\n";
-                ss << u8"    \"frFR\": \"Sszark l’Ardent\",\n";
-                ss << u8"    \"itIT\": \"Sszark il Fiammeggiante\",\n";
-                ss << u8"    \"koKR\": \"불타는 스자크\",\n";
-                ss << u8"    \"plPL\": \"Sszark Płonący\",\n";
-                ss << u8"    \"esMX\": \"Sszark el Ardiente\",\n";
-                ss << u8"    \"jaJP\": \"劫火のスザーク\",\n";
-                ss << u8"    \"ptBR\": \"Sszark, o Flamejante\",\n";
-                ss << u8"    \"ruRU\": \"Ссзарк Пылающий\",\n";
-                ss << u8"    \"zhCN\": \"燃烧的斯扎克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2869,\n";
-                ss << u8"    \"Key\": \"Bishibosh\",\n";
-                ss << u8"    \"enUS\": \"Bishibosh\",\n";
-                ss << u8"    \"zhTW\": \"畢須博須\",\n";
-                ss << u8"    \"deDE\": \"Bischibosch\",\n";
-                ss << u8"    \"esES\": \"Bishibosh\",\n";
-                ss << u8"    \"frFR\": \"Bishibosh\",\n";
-                ss << u8"    \"itIT\": \"Bishibosh\",\n";
-                ss << u8"    \"koKR\": \"비시보시\",\n";
-                ss << u8"    \"plPL\": \"Biszibosz\",\n";
-                ss << u8"    \"esMX\": \"Bishibosh\",\n";
-                ss << u8"    \"jaJP\": \"ビシボシュ\",\n";
-                ss << u8"    \"ptBR\": \"Bishibosh\",\n";
-                ss << u8"    \"ruRU\": \"Бишибош\",\n";
-                ss << u8"    \"zhCN\": \"毕须博须\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2870,\n";
-                ss << u8"    \"Key\": \"Bonebreak\",\n";
-                ss << u8"    \"enUS\": \"Bonebreaker\",\n";
-                ss << u8"    \"zhTW\": \"碎骨者\",\n";
-                ss << u8"    \"deDE\": \"Knochenbrecher\",\n";
-                ss << u8"    \"esES\": \"Quebrantahuesos\",\n";
-                ss << u8"    \"frFR\": \"Concasseur d’os\",\n";
-                ss << u8"    \"itIT\": \"Schiantaossa\",\n";
-                ss << u8"    \"koKR\": \"본브레이커\",\n";
-                ss << u8"    \"plPL\": \"Kościołamacz\",\n";
-                ss << u8"    \"esMX\": \"Rompehuesos\",\n";
-                ss << u8"    \"jaJP\": \"ボーンブレイカー\",\n";
-                ss << u8"    \"ptBR\": \"Quebra-ossos\",\n";
-                ss << u8"    \"ruRU\": \"Костедробильщик\",\n";
-                ss << u8"    \"zhCN\": \"碎骨者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2871,\n";
-                ss << u8"    \"Key\": \"Coldcrow\",\n";
-                ss << u8"    \"enUS\": \"Coldcrow\",\n";
-                ss << u8"    \"zhTW\": \"冰烏鴉\",\n";
-                ss << u8"    \"deDE\": \"Kaltkrähe\",\n";
-                ss << u8"    \"esES\": \"Cuervo Frío\",\n";
-                ss << u8"    \"frFR\": \"Corbeau de froid\",\n";
-                ss << u8"    \"itIT\": \"Corvofreddo\",\n";
-                ss << u8"    \"koKR\": \"콜드크로우\",\n";
-                ss << u8"    \"plPL\": \"Zimna Kruczyca\",\n";
-                ss << u8"    \"esMX\": \"Cuervo Gélido\",\n";
-                ss << u8"    \"jaJP\": \"コールドクロウ\",\n";
-                ss << u8"    \"ptBR\": \"Gelicorvo\",\n";
-                ss << u8"    \"ruRU\": \"Ледяная Ворона\",\n";
-                ss << u8"    \"zhCN\": \"冰冷乌鸦\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2872,\n";
-                ss << u8"    \"Key\": \"Rakanishu\",\n";
-                ss << u8"    \"enUS\": \"Rakanishu\",\n";
-                ss << u8"    \"zhTW\": \"拉卡尼休\",\n";
-                ss << u8"    \"deDE\": \"Rakanischu\",\n";
-                ss << u8"    \"esES\": \"Rakanishu\",\n";
-                ss << u8"    \"frFR\": \"Rakanishu\",\n";
-                ss << u8"    \"itIT\": \"Rakanishu\",\n";
-                ss << u8"    \"koKR\": \"라카니슈\",\n";
-                ss << u8"    \"plPL\": \"Rakaniszu\",\n";
-                ss << u8"    \"esMX\": \"Rakanishu\",\n";
-                ss << u8"    \"jaJP\": \"ラカニシュ\",\n";
-                ss << u8"    \"ptBR\": \"Rakanishu\",\n";
-                ss << u8"    \"ruRU\": \"Раканишу\",\n";
-                ss << u8"    \"zhCN\": \"拉卡尼休\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2873,\n";
-                ss << u8"    \"Key\": \"Treehead WoodFist\",\n";
-                ss << u8"    \"enUS\": \"Treehead WoodFist\",\n";
-                ss << u8"    \"zhTW\": \"樹頭木拳\",\n";
-                ss << u8"    \"deDE\": \"Baumkopf Holzfaust\",\n";
-                ss << u8"    \"esES\": \"Puño de Madera de la Copa del Árbol\",\n";
-                ss << u8"    \"frFR\": \"Crânebois Pognebûche\",\n";
-                ss << u8"    \"itIT\": \"Arborius Pugno di Legno\",\n";
-                ss << u8"    \"koKR\": \"트리헤드 우드피스트\",\n";
-                ss << u8"    \"plPL\": \"Gałęzioręki\",\n";
-                ss << u8"    \"esMX\": \"Puñoleño del Árbol\",\n";
-                ss << u8"    \"jaJP\": \"木拳のツリーヘッド\",\n";
-                ss << u8"    \"ptBR\": \"Arbóreo Lenhoso\",\n";
-                ss << u8"    \"ruRU\": \"Древолоб Дуборук\",\n";
-                ss << u8"    \"zhCN\": \"树头木拳\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2874,\n";
-                ss << u8"    \"Key\": \"Griswold\",\n";
-                ss << u8"    \"enUS\": \"Griswold\",\n";
-                ss << u8"    \"zhTW\": \"格里斯瓦德\",\n";
-                ss << u8"    \"deDE\": \"Griswold\",\n";
-                ss << u8"    \"esES\": \"Griswold\",\n";
-                ss << u8"    \"frFR\": \"Griswold\",\n";
-                ss << u8"    \"itIT\": \"Griswold\",\n";
-                ss << u8"    \"koKR\": \"그리스월드\",\n";
-                ss << u8"    \"plPL\": \"Griswold\",\n";
-                ss << u8"    \"esMX\": \"Griswold\",\n";
-                ss << u8"    \"jaJP\": \"グリズウォルド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Griswold\",\n";
-                ss << u8"    \"ruRU\": \"Гризвольд\",\n";
-                ss << u8"    \"zhCN\": \"格里斯沃尔德\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2875,\n";
-                ss << u8"    \"Key\": \"The Countess\",\n";
-                ss << u8"    \"enUS\": \"The Countess\",\n";
-                ss << u8"    \"zhTW\": \"女伯爵\",\n";
-                ss << u8"    \"deDE\": \"Die Gräfin\",\n";
-                ss << u8"    \"esES\": \"La Condesa\",\n";
-                ss << u8"    \"frFR\": \"La Comtesse\",\n";
-                ss << u8"    \"itIT\": \"La Contessa\",\n";
-                ss << u8"    \"koKR\": \"백작\",\n";
-                ss << u8"    \"plPL\": \"Hrabina\",\n";
-                ss << u8"    \"esMX\": \"La Condesa\",\n";
-                ss << u8"    \"jaJP\": \"伯爵夫人\",\n";
-                ss << u8"    \"ptBR\": \"A Condessa\",\n";
-                ss << u8"    \"ruRU\": \"Графиня\",\n";
-                ss << u8"    \"zhCN\": \"女伯爵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2876,\n";
-                ss << u8"    \"Key\": \"Pitspawn Fouldog\",\n";
-                ss << u8"    \"enUS\": \"Pitspawn Fouldog\",\n";
-                ss << u8"    \"zhTW\": \"獄淵惡犬\",\n";
-                ss << u8"    \"deDE\": \"Schleimer Faulhund\",\n";
-                ss << u8"    \"esES\": \"Perro Fétido del Foso\",\n";
-                ss << u8"    \"frFR\": \"Chien fétide de la fosse\",\n";
-                ss << u8"    \"itIT\": \"Cane dell'Abisso\",\n";
-                ss << u8"    \"koKR\": \"핏스폰 파울도그\",\n";
-                ss << u8"    \"plPL\": \"Pomiot Czeluści\",\n";
-                ss << u8"    \"esMX\": \"Perro Fétido del Foso\",\n";
-                ss << u8"    \"jaJP\": \"奈落の腐犬\",\n";
-                ss << u8"    \"ptBR\": \"Cão Pestilento\",\n";
-                ss << u8"    \"ruRU\": \"Сквернопес Отродье Преисподней\",\n";
-                ss << u8"    \"zhCN\": \"渊生邪犬\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2877,\n";
-                ss << u8"    \"Key\": \"Flamespike the Crawler\",\n";
-                ss << u8"    \"enUS\": \"Flamespike the Crawler\",\n";
-                ss << u8"    \"zhTW\": \"爬行者火釘\",\n";
-                ss << u8"    \"deDE\": \"Flammenstoß der Kriecher\",\n";
-                ss << u8"    \"esES\": \"Punta Llameante el Reptador\",\n";
-                ss << u8"    \"frFR\": \"Pique-flamme le servile\",\n";
-                ss << u8"    \"itIT\": \"Spinardente lo Strisciante\",\n";
-                ss << u8"    \"koKR\": \"꿈틀거리는 플레임스파이크\",\n";
-                ss << u8"    \"plPL\": \"Płonący Pełzacz\",\n";
-                ss << u8"    \"esMX\": \"Púardiente el Rastrero\",\n";
-                ss << u8"    \"jaJP\": \"這いまわる炎の棘\",\n";
-                ss << u8"    \"ptBR\": \"Espetochama, o Rastejante\",\n";
-                ss << u8"    \"ruRU\": \"Ползучий Огнешип\",\n";
-                ss << u8"    \"zhCN\": \"火焰脊刺\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2878,\n";
-                ss << u8"    \"Key\": \"Boneash\",\n";
-                ss << u8"    \"enUS\": \"Bone Ash\",\n";
-                ss << u8"    \"zhTW\": \"骨灰\",\n";
-                ss << u8"    \"deDE\": \"Knochenasche\",\n";
-                ss << u8"    \"esES\": \"Ceniza de Hueso\",\n";
-                ss << u8"    \"frFR\": \"Cendros\",\n";
-                ss << u8"    \"itIT\": \"Cenere d'Ossa\",\n";
-                ss << u8"    \"koKR\": \"본 애쉬\",\n";
-                ss << u8"    \"plPL\": \"Popiół z Kości\",\n";
-                ss << u8"    \"esMX\": \"Ceniza Ósea\",\n";
-                ss << u8"    \"jaJP\": \"ボーン・アッシュ\",\n";
-                ss << u8"    \"ptBR\": \"Poeira Óssea\",\n";
-                ss << u8"    \"ruRU\": \"Костяной Пепел\",\n";
-                ss << u8"    \"zhCN\": \"骨灰\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2879,\n";
-                ss << u8"    \"Key\": \"Radament\",\n";
-                ss << u8"    \"enUS\": \"Radament\",\n";
-                ss << u8"    \"zhTW\": \"羅達門特\",\n";
-                ss << u8"    \"deDE\": \"Radament\",\n";
-                ss << u8"    \"esES\": \"Radament\",\n";
-                ss << u8"    \"frFR\": \"Radament\",\n";
-                ss << u8"    \"itIT\": \"Radament\",\n";
-                ss << u8"    \"koKR\": \"라다먼트\",\n";
-                ss << u8"    \"plPL\": \"Radament\",\n";
-                ss << u8"    \"esMX\": \"Radament\",\n";
-                ss << u8"    \"jaJP\": \"ラダメント\",\n";
-                ss << u8"    \"ptBR\": \"Radament\",\n";
-                ss << u8"    \"ruRU\": \"Радамант\",\n";
-                ss << u8"    \"zhCN\": \"罗达门特\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2880,\n";
-                ss << u8"    \"Key\": \"Bloodwitch the Wild\",\n";
-                ss << u8"    \"enUS\": \"Bloodwitch the Wild\",\n";
-                ss << u8"    \"zhTW\": \"瘋狂血腥女巫\",\n";
-                ss << u8"    \"deDE\": \"Bluthexe die Wilde\",\n";
-                ss << u8"    \"esES\": \"Bruja Sangrienta la Salvaje\",\n";
-                ss << u8"    \"frFR\": \"Furie-Sanglante la Sauvage\",\n";
-                ss << u8"    \"itIT\": \"Stregarossa la Selvaggia\",\n";
-                ss << u8"    \"koKR\": \"야생의 블러드위치\",\n";
-                ss << u8"    \"plPL\": \"Krwawa Wiedźma\",\n";
-                ss << u8"    \"esMX\": \"Bruja Sangrienta la Salvaje\",\n";
-                ss << u8"    \"jaJP\": \"荒々しきブラッド・ウィッチ\",\n";
-                ss << u8"    \"ptBR\": \"Bruxassangue, a Selvagem\",\n";
-                ss << u8"    \"ruRU\": \"Кровожадка Хищница\",\n";
-                ss << u8"    \"zhCN\": \"狂野的血腥女巫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2881,\n";
-                ss << u8"    \"Key\": \"Fangskin\",\n";
-                ss << u8"    \"enUS\": \"Fangskin\",\n";
-                ss << u8"    \"zhTW\": \"牙皮\",\n";
-                ss << u8"    \"deDE\": \"Reißzahn\",\n";
-                ss << u8"    \"esES\": \"Piel Dentada\",\n";
-                ss << u8"    \"frFR\": \"Sang-Peau\",\n";
-                ss << u8"    \"itIT\": \"Scuoiartiglio\",\n";
-                ss << u8"    \"koKR\": \"팽스킨\",\n";
-                ss << u8"    \"plPL\": \"Zęboskóry\",\n";
-                ss << u8"    \"esMX\": \"Piel Dentada\",\n";
-                ss << u8"    \"jaJP\": \"ファングスキン\",\n";
-                ss << u8"    \"ptBR\": \"Presapele\",\n";
-                ss << u8"    \"ruRU\": \"Кожеклык\",\n";
-                ss << u8"    \"zhCN\": \"牙皮\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2882,\n";
-                ss << u8"    \"Key\": \"Beetleburst\",\n";
-                ss << u8"    \"enUS\": \"Beetleburst\",\n";
-                ss << u8"    \"zhTW\": \"爆蟲\",\n";
-                ss << u8"    \"deDE\": \"Käferkau\",\n";
-                ss << u8"    \"esES\": \"Gran Estallido\",\n";
-                ss << u8"    \"frFR\": \"Scarabée explosif\",\n";
-                ss << u8"    \"itIT\": \"Blattanera\",\n";
-                ss << u8"    \"koKR\": \"비틀버스트\",\n";
-                ss << u8"    \"plPL\": \"Bryzgacz\",\n";
-                ss << u8"    \"esMX\": \"Ráfaga de Escarabajos\",\n";
-                ss << u8"    \"jaJP\": \"ビートルバースト\",\n";
-                ss << u8"    \"ptBR\": \"Bestouro\",\n";
-                ss << u8"    \"ruRU\": \"Взрывожук\",\n";
-                ss << u8"    \"zhCN\": \"突爆甲虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2883,\n";
-                ss << u8"    \"Key\": \"Leatherarm\",\n";
-                ss << u8"    \"enUS\": \"Creeping Feature\",\n";
-                ss << u8"    \"zhTW\": \"蔓延症狀\",\n";
-                ss << u8"    \"deDE\": \"Kriecharm\",\n";
-                ss << u8"    \"esES\": \"Brazo de Cuero\",\n";
-                ss << u8"    \"frFR\": \"Être insidieux\",\n";
-                ss << u8"    \"itIT\": \"Lo Strascicante\",\n";
-                ss << u8"    \"koKR\": \"크리핑 피쳐\",\n";
-                ss << u8"    \"plPL\": \"Pełzająca Część Twarzy\",\n";
-                ss << u8"    \"esMX\": \"Aparición Espeluznante\",\n";
-                ss << u8"    \"jaJP\": \"這い寄りし者\",\n";
-                ss << u8"    \"ptBR\": \"Coisa Arrepiante\",\n";
-                ss << u8"    \"ruRU\": \"Бредущее тело\",\n";
-                ss << u8"    \"zhCN\": \"缓行恐面\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2884,\n";
-                ss << u8"    \"Key\": \"Coldworm the Burrower\",\n";
-                ss << u8"    \"enUS\": \"Coldworm the Burrower\",\n";
-                ss << u8"    \"zhTW\": \"冰蟲鑽地者\",\n";
-                ss << u8"    \"deDE\": \"Kaltwurm der Gräber\",\n";
-                ss << u8"    \"esES\": \"Gusano Frío el Excavador\",\n";
-                ss << u8"    \"frFR\": \"Froide-Larve la Fossoyeuse\",\n";
-                ss << u8"    \"itIT\": \"Vermefreddo lo Scavatore\",\n";
-                ss << u8"    \"koKR\": \"땅굴꾼 콜드웜\",\n";
-                ss << u8"    \"plPL\": \"Zimnoczerw Kopacz\",\n";
-                ss << u8"    \"esMX\": \"Cresálido el Excavador\",\n";
-                ss << u8"    \"jaJP\": \"穴掘るコールドワーム\",\n";
-                ss << u8"    \"ptBR\": \"Vermefrio, o Escavador\",\n";
-                ss << u8"    \"ruRU\": \"Ледочервь Копатель\",\n";
-                ss << u8"    \"zhCN\": \"钻地的冰虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2885,\n";
-                ss << u8"    \"Key\": \"Fire Eye\",\n";
-                ss << u8"    \"enUS\": \"Fire Eye\",\n";
-                ss << u8"    \"zhTW\": \"火之眼\",\n";
-                ss << u8"    \"deDE\": \"Feuerauge\",\n";
-                ss << u8"    \"esES\": \"Ojo de Fuego\",\n";
-                ss << u8"    \"frFR\": \"Œil de Feu\",\n";
-                ss << u8"    \"itIT\": \"Occhio Infuocato\",\n";
-                ss << u8"    \"koKR\": \"파이어 아이\",\n";
-                ss << u8"    \"plPL\": \"Ognistooki\",\n";
-                ss << u8"    \"esMX\": \"Ojo Ardiente\",\n";
-                ss << u8"    \"jaJP\": \"焼ける瞳\",\n";
-                ss << u8"    \"ptBR\": \"Olho Flamejante\",\n";
-                ss << u8"    \"ruRU\": \"Огненный Глаз\",\n";
-                ss << u8"    \"zhCN\": \"火眼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2886,\n";
-                ss << u8"    \"Key\": \"Dark Elder\",\n";
-                ss << u8"    \"enUS\": \"Dark Elder\",\n";
-                ss << u8"    \"zhTW\": \"黑暗長老\",\n";
-                ss << u8"    \"deDE\": \"Dunkler Vorfahr\",\n";
-                ss << u8"    \"esES\": \"Anciano Oscuro\",\n";
-                ss << u8"    \"frFR\": \"Sombre Ancien\",\n";
-                ss << u8"    \"itIT\": \"Anziano Oscuro\",\n";
-                ss << u8"    \"koKR\": \"사악한 장로\",\n";
-                ss << u8"    \"plPL\": \"Mroczny Starzec\",\n";
-                ss << u8"    \"esMX\": \"Ancestro Oscuro\",\n";
-                ss << u8"    \"jaJP\": \"闇のエルダー\",\n";
-                ss << u8"    \"ptBR\": \"Ancião Sombrio\",\n";
-                ss << u8"    \"ruRU\": \"Темный старейшина\",\n";
-                ss << u8"    \"zhCN\": \"黑暗长老\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2887,\n";
-                ss << u8"    \"Key\": \"The Summoner\",\n";
-                ss << u8"    \"enUS\": \"The Summoner\",\n";
-                ss << u8"    \"zhTW\": \"召喚師\",\n";
-                ss << u8"    \"deDE\": \"Der Geisterbeschwörer\",\n";
-                ss << u8"    \"esES\": \"El Invocador\",\n";
-                ss << u8"    \"frFR\": \"L’invocateur\",\n";
-                ss << u8"    \"itIT\": \"L'Evocatore\",\n";
-                ss << u8"    \"koKR\": \"소환사\",\n";
-                ss << u8"    \"plPL\": \"Demonolog\",\n";
-                ss << u8"    \"esMX\": \"El Invocador\",\n";
-                ss << u8"    \"jaJP\": \"召喚師\",\n";
-                ss << u8"    \"ptBR\": \"O Evocador\",\n";
-                ss << u8"    \"ruRU\": \"Призыватель\",\n";
-                ss << u8"    \"zhCN\": \"召唤者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2888,\n";
-                ss << u8"    \"Key\": \"Ancient Kaa the Soulless\",\n";
-                ss << u8"    \"enUS\": \"Ancient Kaa the Soulless\",\n";
-                ss << u8"    \"zhTW\": \"遠古無魂者卡厄\",\n";
-                ss << u8"    \"deDE\": \"Kaa der Seelenlose\",\n";
-                ss << u8"    \"esES\": \"Anciano Kaa el Desalmado\",\n";
-                ss << u8"    \"frFR\": \"Vieux Kaa, l’inhumain\",\n";
-                ss << u8"    \"itIT\": \"Kaa il Senz'Anima\",\n";
-                ss << u8"    \"koKR\": \"넋 나간 고대 카아\",\n";
-                ss << u8"    \"plPL\": \"Prastary Kaa, Bezduszny\",\n";
-                ss << u8"    \"esMX\": \"Anciano Kaa el Desalmado\",\n";
-                ss << u8"    \"jaJP\": \"魂なき古のカー\",\n";
-                ss << u8"    \"ptBR\": \"Kaa Ancestral, o Sem-alma\",\n";
-                ss << u8"    \"ruRU\": \"Древний Каа Бездушник\",\n";
-                ss << u8"    \"zhCN\": \"失魂的先贤卡\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2889,\n";
-                ss << u8"    \"Key\": \"The Smith\",\n";
-                ss << u8"    \"enUS\": \"The Smith\",\n";
-                ss << u8"    \"zhTW\": \"鐵匠\",\n";
-                ss << u8"    \"deDE\": \"Der Schmied\",\n";
-                ss << u8"    \"esES\": \"El Herrero\",\n";
-                ss << u8"    \"frFR\": \"Le forgeron\",\n";
-                ss << u8"    \"itIT\": \"Il Fabbro\",\n";
-                ss << u8"    \"koKR\": \"대장장이\",\n";
-                ss << u8"    \"plPL\": \"Kowal\",\n";
-                ss << u8"    \"esMX\": \"El Herrero\",\n";
-                ss << u8"    \"jaJP\": \"穢れた鍛冶師\",\n";
-                ss << u8"    \"ptBR\": \"O Ferreiro\",\n";
-                ss << u8"    \"ruRU\": \"Кузнец\",\n";
-                ss << u8"    \"zhCN\": \"铁匠\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2897,\n";
-                ss << u8"    \"Key\": \"Rogue\",\n";
-                ss << u8"    \"enUS\": \"Rogue\",\n";
-                ss << u8"    \"zhTW\": \"俠盜\",\n";
-                ss << u8"    \"deDE\": \"Jägerin\",\n";
-                ss << u8"    \"esES\": \"Arpía\",\n";
-                ss << u8"    \"frFR\": \"Rogue\",\n";
-                ss << u8"    \"itIT\": \"Scolta\",\n";
-                ss << u8"    \"koKR\": \"도적\",\n";
-                ss << u8"    \"plPL\": \"Łotrzyca\",\n";
-                ss << u8"    \"esMX\": \"Renegada\",\n";
-                ss << u8"    \"jaJP\": \"ローグ\",\n";
-                ss << u8"    \"ptBR\": \"Renegada\",\n";
-                ss << u8"    \"ruRU\": \"Разбойница\",\n";
-                ss << u8"    \"zhCN\": \"流亡者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2898,\n";
-                ss << u8"    \"Key\": \"StygianDoll\",\n";
-                ss << u8"    \"enUS\": \"Stygian Doll\",\n";
-                ss << u8"    \"zhTW\": \"冥河鬼娃\",\n";
-                ss << u8"    \"deDE\": \"Stygische Puppe\",\n";
-                ss << u8"    \"esES\": \"Muñeco estigio\",\n";
-                ss << u8"    \"frFR\": \"Poupée stygienne\",\n";
-                ss << u8"    \"itIT\": \"Bambola dello Stige\",\n";
-                ss << u8"    \"koKR\": \"저승 꼭두각시\",\n";
-                ss << u8"    \"plPL\": \"Stygijczyk\",\n";
-                ss << u8"    \"esMX\": \"Muñeco estigio\",\n";
-                ss << u8"    \"jaJP\": \"スティジャンドール\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Boneco Estígio\",\n";
-                ss << u8"    \"ruRU\": \"Стигийская кукла\",\n";
-                ss << u8"    \"zhCN\": \"冥河娃娃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2899,\n";
-                ss << u8"    \"Key\": \"SoulKiller\",\n";
-                ss << u8"    \"enUS\": \"Soul Killer\",\n";
-                ss << u8"    \"zhTW\": \"靈魂殺手\",\n";
-                ss << u8"    \"deDE\": \"Seelentöter\",\n";
-                ss << u8"    \"esES\": \"Asesino de almas\",\n";
-                ss << u8"    \"frFR\": \"Dévoreur d’âmes\",\n";
-                ss << u8"    \"itIT\": \"Uccisore di Anime\",\n";
-                ss << u8"    \"koKR\": \"영혼살해자\",\n";
-                ss << u8"    \"plPL\": \"Zabójca dusz\",\n";
-                ss << u8"    \"esMX\": \"Asesino de almas\",\n";
-                ss << u8"    \"jaJP\": \"ソウルキラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Mata-almas\",\n";
-                ss << u8"    \"ruRU\": \"Душегуб\",\n";
-                ss << u8"    \"zhCN\": \"灵魂杀手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2900,\n";
-                ss << u8"    \"Key\": \"Flayer\",\n";
-                ss << u8"    \"enUS\": \"Flayer\",\n";
-                ss << u8"    \"zhTW\": \"剝皮手\",\n";
-                ss << u8"    \"deDE\": \"Schinder\",\n";
-                ss << u8"    \"esES\": \"Desollador\",\n";
-                ss << u8"    \"frFR\": \"Écorcheur\",\n";
-                ss << u8"    \"itIT\": \"Scorticatore\",\n";
-                ss << u8"    \"koKR\": \"약탈자\",\n";
-                ss << u8"    \"plPL\": \"Łupieżca\",\n";
-                ss << u8"    \"esMX\": \"Desollador\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Esfolador\",\n";
-                ss << u8"    \"ruRU\": \"Свежеватель\",\n";
-                ss << u8"    \"zhCN\": \"剥皮魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2901,\n";
-                ss << u8"    \"Key\": \"Fetish\",\n";
-                ss << u8"    \"enUS\": \"Fetish\",\n";
-                ss << u8"    \"zhTW\": \"鬼娃\",\n";
-                ss << u8"    \"deDE\": \"Fetisch\",\n";
-                ss << u8"    \"esES\": \"Fetiche\",\n";
-                ss << u8"    \"frFR\": \"Fétiche\",\n";
-                ss << u8"    \"itIT\": \"Feticcio\",\n";
-                ss << u8"    \"koKR\": \"우상족\",\n";
-                ss << u8"    \"plPL\": \"Fetysz\",\n";
-                ss << u8"    \"esMX\": \"Fetiche\",\n";
-                ss << u8"    \"jaJP\": \"フェティッシュ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Carranco\",\n";
-                ss << u8"    \"ruRU\": \"Фетиш\",\n";
-                ss << u8"    \"zhCN\": \"鬼娃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2902,\n";
-                ss << u8"    \"Key\": \"RatMan\",\n";
-                ss << u8"    \"enUS\": \"Rat Man\",\n";
-                ss << u8"    \"zhTW\": \"鼠人\",\n";
-                ss << u8"    \"deDE\": \"Rattenmann\",\n";
-                ss << u8"    \"esES\": \"Hombre rata\",\n";
-                ss << u8"    \"frFR\": \"Homme-rat\",\n";
-                ss << u8"    \"itIT\": \"Uomo Ratto\",\n";
-                ss << u8"    \"koKR\": \"쥐 인간\",\n";
-                ss << u8"    \"plPL\": \"Szczuroczłek\",\n";
-                ss << u8"    \"esMX\": \"Ratonero\",\n";
-                ss << u8"    \"jaJP\": \"ラットマン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Homem-rato\",\n";
-                ss << u8"    \"ruRU\": \"Крысолюд\",\n";
-                ss << u8"    \"zhCN\": \"鼠人\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2903,\n";
-                ss << u8"    \"Key\": \"Undead StygianDoll\",\n";
-                ss << u8"    \"enUS\": \"Undead Stygian Doll\",\n";
-                ss << u8"    \"zhTW\": \"不死冥河鬼娃\",\n";
-                ss << u8"    \"deDE\": \"untote stygische Puppe\",\n";
-                ss << u8"    \"esES\": \"Muñeco estigio viviente\",\n";
-                ss << u8"    \"frFR\": \"Poupée stygienne morte-vivante\",\n";
-                ss << u8"    \"itIT\": \"Bambola dello Stige Non Morta\",\n";
-                ss << u8"    \"koKR\": \"언데드 저승 꼭두각시\",\n";
-                ss << u8"    \"plPL\": \"Nieumarły stygijczyk\",\n";
-                ss << u8"    \"esMX\": \"Muñeco estigio no muerto\",\n";
-                ss << u8"    \"jaJP\": \"蘇りしスティジャンドール\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Boneco Estígio Morto-vivo\",\n";
-                ss << u8"    \"ruRU\": \"Оживленная стигийская кукла\",\n";
-                ss << u8"    \"zhCN\": \"亡灵冥河娃娃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2904,\n";
-                ss << u8"    \"Key\": \"Undead SoulKiller\",\n";
-                ss << u8"    \"enUS\": \"Undead Soul Killer\",\n";
-                ss << u8"    \"zhTW\": \"不死靈魂殺手\",\n";
-                ss << u8"    \"deDE\": \"untoter Seelentöter\",\n";
-                ss << u8"    \"esES\": \"Asesino de almas viviente\",\n";
-                ss << u8"    \"frFR\": \"Faucheur d’âmes mort-vivant\",\n";
-                ss << u8"    \"itIT\": \"Uccisore di Anime Non Morto\",\n";
-                ss << u8"    \"koKR\": \"언데드 영혼살해자\",\n";
-                ss << u8"    \"plPL\": \"Nieumarły zabójca dusz\",\n";
-                ss << u8"    \"esMX\": \"Asesino de almas no muerto\",\n";
-                ss << u8"    \"jaJP\": \"蘇りしソウルキラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Mata-almas Morto-vivo\",\n";
-                ss << u8"    \"ruRU\": \"Оживленный душегуб\",\n";
-                ss << u8"    \"zhCN\": \"亡灵灵魂杀手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2905,\n";
-                ss << u8"    \"Key\": \"Undead Flayer\",\n";
-                ss << u8"    \"enUS\": \"Undead Flayer\",\n";
-                ss << u8"    \"zhTW\": \"不死剝皮手\",\n";
-                ss << u8"    \"deDE\": \"untoter Schinder\",\n";
-                ss << u8"    \"esES\": \"Desollador viviente\",\n";
-                ss << u8"    \"frFR\": \"Écorcheur mort-vivant\",\n";
-                ss << u8"    \"itIT\": \"Scorticatore Non Morto\",\n";
-                ss << u8"    \"koKR\": \"언데드 약탈자\",\n";
-                ss << u8"    \"plPL\": \"Nieumarły łupieżca\",\n";
-                ss << u8"    \"esMX\": \"Desollador no muerto\",\n";
-                ss << u8"    \"jaJP\": \"蘇りしフレイヤー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Esfolador Morto-vivo\",\n";
-                ss << u8"    \"ruRU\": \"Оживленный свежеватель\",\n";
-                ss << u8"    \"zhCN\": \"亡灵剥皮魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2906,\n";
-                ss << u8"    \"Key\": \"Undead Fetish\",\n";
-                ss << u8"    \"enUS\": \"Undead Fetish\",\n";
-                ss << u8"    \"zhTW\": \"不死鬼娃\",\n";
-                ss << u8"    \"deDE\": \"untoter Fetisch\",\n";
-                ss << u8"    \"esES\": \"Fetiche viviente\",\n";
-                ss << u8"    \"frFR\": \"Fétiche mort-vivant\",\n";
-                ss << u8"    \"itIT\": \"Feticcio Non Morto\",\n";
-                ss << u8"    \"koKR\": \"언데드 우상족\",\n";
-                ss << u8"    \"plPL\": \"Nieumarły fetysz\",\n";
-                ss << u8"    \"esMX\": \"Fetiche no muerto\",\n";
-                ss << u8"    \"jaJP\": \"蘇りしフェティッシュ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Carranco Morto-vivo\",\n";
-                ss << u8"    \"ruRU\": \"Оживленный фетиш\",\n";
-                ss << u8"    \"zhCN\": \"亡灵鬼娃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2907,\n";
-                ss << u8"    \"Key\": \"Undead RatMan\",\n";
-                ss << u8"    \"enUS\": \"Undead Rat Man\",\n";
-                ss << u8"    \"zhTW\": \"不死鼠人\",\n";
-                ss << u8"    \"deDE\": \"untoter Rattenmann\",\n";
-                ss << u8"    \"esES\": \"Hombre rata viviente\",\n";
-                ss << u8"    \"frFR\": \"Homme-rat mort-vivant\",\n";
-                ss << u8"    \"itIT\": \"Uomo Ratto Non Morto\",\n";
-                ss << u8"    \"koKR\": \"언데드 쥐 인간\",\n";
-                ss << u8"    \"plPL\": \"Nieumarły szczuroczłek\",\n";
-                ss << u8"    \"esMX\": \"Ratonero no muerto\",\n";
-                ss << u8"    \"jaJP\": \"蘇りしラットマン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Homem-rato Morto-vivo\",\n";
-                ss << u8"    \"ruRU\": \"Оживленный крысолюд\",\n";
-                ss << u8"    \"zhCN\": \"亡灵鼠人\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2908,\n";
-                ss << u8"    \"Key\": \"DarkFamiliar\",\n";
-                ss << u8"    \"enUS\": \"Dark Familiar\",\n";
-                ss << u8"    \"zhTW\": \"黑暗魔寵\",\n";
-                ss << u8"    \"deDE\": \"Dunkler Familiar\",\n";
-                ss << u8"    \"esES\": \"Familiar oscuro\",\n";
-                ss << u8"    \"frFR\": \"Familier sombre\",\n";
-                ss << u8"    \"itIT\": \"Demonietto Oscuro\",\n";
-                ss << u8"    \"koKR\": \"어둠의 사역마\",\n";
-                ss << u8"    \"plPL\": \"Mroczny chowaniec\",\n";
-                ss << u8"    \"esMX\": \"Familiar oscuro\",\n";
-                ss << u8"    \"jaJP\": \"闇の眷属\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Familiar Sombrio\",\n";
-                ss << u8"    \"ruRU\": \"Темный фамилиар\",\n";
-                ss << u8"    \"zhCN\": \"黑暗邪蝠\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2909,\n";
-                ss << u8"    \"Key\": \"BloodDiver\",\n";
-                ss << u8"    \"enUS\": \"Blood Diver\",\n";
-                ss << u8"    \"zhTW\": \"鮮血俯衝者\",\n";
-                ss << u8"    \"deDE\": \"Bluttaucher\",\n";
-                ss << u8"    \"esES\": \"Saltador sangriento\",\n";
-                ss << u8"    \"frFR\": \"Desmodon de sang\",\n";
-                ss << u8"    \"itIT\": \"Succhiasangue\",\n";
-                ss << u8"    \"koKR\": \"피 잠수꾼\",\n";
-                ss << u8"    \"plPL\": \"Krwiopijca\",\n";
-                ss << u8"    \"esMX\": \"Zambullidor sangriento\",\n";
-                ss << u8"    \"jaJP\": \"血濡れたコウモリ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Mergulhador Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Кровавый пикировщик\",\n";
-                ss << u8"    \"zhCN\": \"俯冲血蝠\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2910,\n";
-                ss << u8"    \"Key\": \"Gloombat\",\n";
-                ss << u8"    \"enUS\": \"Gloombat\",\n";
-                ss << u8"    \"zhTW\": \"幽暗蝙蝠\",\n";
-                ss << u8"    \"deDE\": \"Düstertier\",\n";
-                ss << u8"    \"esES\": \"Murciélago penumbroso\",\n";
-                ss << u8"    \"frFR\": \"Chauve-souris des ténèbres\",\n";
-                ss << u8"    \"itIT\": \"Pipistrello Oscuro\",\n";
-                ss << u8"    \"koKR\": \"어스름박쥐\",\n";
-                ss << u8"    \"plPL\": \"Ciemnoperz\",\n";
-                ss << u8"    \"esMX\": \"Murcilóbrego\",\n";
-                ss << u8"    \"jaJP\": \"闇コウモリ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Morcego Soturno\",\n";
-                ss << u8"    \"ruRU\": \"Сумрачный нетопырь\",\n";
-                ss << u8"    \"zhCN\": \"幽暗蝠\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2911,\n";
-                ss << u8"    \"Key\": \"DesertWing\",\n";
-                ss << u8"    \"enUS\": \"Desert Wing\",\n";
-                ss << u8"    \"zhTW\": \"沙漠之翼\",\n";
-                ss << u8"    \"deDE\": \"Wüstenflügel\",\n";
-                ss << u8"    \"esES\": \"Ala desértica\",\n";
-                ss << u8"    \"frFR\": \"Aile du désert\",\n";
-                ss << u8"    \"itIT\": \"Ala del Deserto\",\n";
-                ss << u8"    \"koKR\": \"사막 날개\",\n";
-                ss << u8"    \"plPL\": \"Piaskoskrzydły\",\n";
-                ss << u8"    \"esMX\": \"Alas desérticas\",\n";
-                ss << u8"    \"jaJP\": \"砂漠コウモリ\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Asa do Deserto\",\n";
-                ss << u8"    \"ruRU\": \"Пустынный летун\",\n";
-                ss << u8"    \"zhCN\": \"沙漠之翼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2912,\n";
-                ss << u8"    \"Key\": \"Banished\",\n";
-                ss << u8"    \"enUS\": \"The Banished\",\n";
-                ss << u8"    \"zhTW\": \"放逐者\",\n";
-                ss << u8"    \"deDE\": \"Die Verbannten\",\n";
-                ss << u8"    \"esES\": \"Desterrado\",\n";
-                ss << u8"    \"frFR\": \"Le Banni\",\n";
-                ss << u8"    \"itIT\": \"Esiliato\",\n";
-                ss << u8"    \"koKR\": \"추방당한 자\",\n";
-                ss << u8"    \"plPL\": \"Wygnany\",\n";
-                ss << u8"    \"esMX\": \"El desterrado\",\n";
-                ss << u8"    \"jaJP\": \"追放されし者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]O Banido\",\n";
-                ss << u8"    \"ruRU\": \"Изгнанный\",\n";
-                ss << u8"    \"zhCN\": \"被放逐者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2913,\n";
-                ss << u8"    \"Key\": \"BloodLord\",\n";
-                ss << u8"    \"enUS\": \"Blood Lord\",\n";
-                ss << u8"    \"zhTW\": \"鮮血鬼爵\",\n";
-                ss << u8"    \"deDE\": \"Blutfürst\",\n";
-                ss << u8"    \"esES\": \"Señor de la sangre\",\n";
-                ss << u8"    \"frFR\": \"Seigneur de sang\",\n";
-                ss << u8"    \"itIT\": \"Signore del Sangue\",\n";
-                ss << u8"    \"koKR\": \"피의 군주\",\n";
-                ss << u8"    \"plPL\": \"Władca krwi\",\n";
-                ss << u8"    \"esMX\": \"Señor sangriento\",\n";
-                ss << u8"    \"jaJP\": \"血の支配者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lorde Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Владыка крови\",\n";
-                ss << u8"    \"zhCN\": \"血王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2914,\n";
-                ss << u8"    \"Key\": \"DarkLord\",\n";
-                ss << u8"    \"enUS\": \"Dark Lord\",\n";
-                ss << u8"    \"zhTW\": \"黑暗鬼爵\",\n";
-                ss << u8"    \"deDE\": \"Dunkler Fürst\",\n";
-                ss << u8"    \"esES\": \"Señor de la oscuridad\",\n";
-                ss << u8"    \"frFR\": \"Seigneur sombre\",\n";
-                ss << u8"    \"itIT\": \"Signore Oscuro\",\n";
-                ss << u8"    \"koKR\": \"어둠의 군주\",\n";
-                ss << u8"    \"plPL\": \"Pan mroku\",\n";
-                ss << u8"    \"esMX\": \"Señor oscuro\",\n";
-                ss << u8"    \"jaJP\": \"闇の支配者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lorde Sombrio\",\n";
-                ss << u8"    \"ruRU\": \"Владыка Тьмы\",\n";
-                ss << u8"    \"zhCN\": \"黑王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2915,\n";
-                ss << u8"    \"Key\": \"NightLord\",\n";
-                ss << u8"    \"enUS\": \"Night Lord\",\n";
-                ss << u8"    \"zhTW\": \"暗夜鬼爵\",\n";
-                ss << u8"    \"deDE\": \"Nachtfürst\",\n";
-                ss << u8"    \"esES\": \"Señor de la noche\",\n";
-                ss << u8"    \"frFR\": \"Seigneur de la Nuit\",\n";
-                ss << u8"    \"itIT\": \"Signore della Notte\",\n";
-                ss << u8"    \"koKR\": \"밤의 군주\",\n";
-                ss << u8"    \"plPL\": \"Władca nocy\",\n";
-                ss << u8"    \"esMX\": \"Señor nocturno\",\n";
-                ss << u8"    \"jaJP\": \"夜の支配者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lorde Noturno\",\n";
-                ss << u8"    \"ruRU\": \"Владыка ночи\",\n";
-                ss << u8"    \"zhCN\": \"夜王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2916,\n";
-                ss << u8"    \"Key\": \"GhoulLord\",\n";
-                ss << u8"    \"enUS\": \"Ghoul Lord\",\n";
-                ss << u8"    \"zhTW\": \"食屍鬼爵\",\n";
-                ss << u8"    \"deDE\": \"Ghulfürst\",\n";
-                ss << u8"    \"esES\": \"Señor necrófago\",\n";
-                ss << u8"    \"frFR\": \"Seigneur des goules\",\n";
-                ss << u8"    \"itIT\": \"Signore dei Ghoul\",\n";
-                ss << u8"    \"koKR\": \"구울 군주\",\n";
-                ss << u8"    \"plPL\": \"Pan ghuli\",\n";
-                ss << u8"    \"esMX\": \"Señor necrófago\",\n";
-                ss << u8"    \"jaJP\": \"死肉の支配者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lorde Carniçal\",\n";
-                ss << u8"    \"ruRU\": \"Владыка вурдалаков\",\n";
-                ss << u8"    \"zhCN\": \"食尸鬼王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2917,\n";
-                ss << u8"    \"Key\": \"Spikefist\",\n";
-                ss << u8"    \"enUS\": \"Spikefist\",\n";
-                ss << u8"    \"zhTW\": \"釘拳木魔\",\n";
-                ss << u8"    \"deDE\": \"Stachelfaust\",\n";
-                ss << u8"    \"esES\": \"Puño punzante\",\n";
-                ss << u8"    \"frFR\": \"Poing de fer\",\n";
-                ss << u8"    \"itIT\": \"Pugnospino\",\n";
-                ss << u8"    \"koKR\": \"쐐기주먹\",\n";
-                ss << u8"    \"plPL\": \"Kolcopięść\",\n";
-                ss << u8"    \"esMX\": \"Puño espinoso\",\n";
-                ss << u8"    \"jaJP\": \"棘拳の怪物\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Punho Espinhoso\",\n";
-                ss << u8"    \"ruRU\": \"Шипорук\",\n";
-                ss << u8"    \"zhCN\": \"刺拳\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2918,\n";
-                ss << u8"    \"Key\": \"Thrasher\",\n";
-                ss << u8"    \"enUS\": \"Thrasher\",\n";
-                ss << u8"    \"zhTW\": \"笞擊木魔\",\n";
-                ss << u8"    \"deDE\": \"Prügler\",\n";
-                ss << u8"    \"esES\": \"Azotador\",\n";
-                ss << u8"    \"frFR\": \"Vandale\",\n";
-                ss << u8"    \"itIT\": \"Spazzatronchi\",\n";
-                ss << u8"    \"koKR\": \"타작꾼\",\n";
-                ss << u8"    \"plPL\": \"Zgniatacz\",\n";
-                ss << u8"    \"esMX\": \"Moledor\",\n";
-                ss << u8"    \"jaJP\": \"枝打つ巨木\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Solapador\",\n";
-                ss << u8"    \"ruRU\": \"Молотильщик\",\n";
-                ss << u8"    \"zhCN\": \"鞭笞魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2919,\n";
-                ss << u8"    \"Key\": \"BrambleHulk\",\n";
-                ss << u8"    \"enUS\": \"Bramble Hulk\",\n";
-                ss << u8"    \"zhTW\": \"刺藤木魔\",\n";
-                ss << u8"    \"deDE\": \"Stacheldrescher\",\n";
-                ss << u8"    \"esES\": \"Mole de zarzas\",\n";
-                ss << u8"    \"frFR\": \"Colosse des forêts\",\n";
-                ss << u8"    \"itIT\": \"Colosso di Rovi\",\n";
-                ss << u8"    \"koKR\": \"찔레 거수\",\n";
-                ss << u8"    \"plPL\": \"Spaczony kolos\",\n";
-                ss << u8"    \"esMX\": \"Coloso punzante\",\n";
-                ss << u8"    \"jaJP\": \"茨の怪物\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Colosso Sarçoso\",\n";
-                ss << u8"    \"ruRU\": \"Терновый гигант\",\n";
-                ss << u8"    \"zhCN\": \"灌木魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2920,\n";
-                ss << u8"    \"Key\": \"ThornedHulk\",\n";
-                ss << u8"    \"enUS\": \"Thorned Hulk\",\n";
-                ss << u8"    \"zhTW\": \"荊棘木魔\",\n";
-                ss << u8"    \"deDE\": \"Dornendrescher\",\n";
-                ss << u8"    \"esES\": \"Mole espinada\",\n";
-                ss << u8"    \"frFR\": \"Colosse à épine\",\n";
-                ss << u8"    \"itIT\": \"Colosso di Spine\",\n";
-                ss << u8"    \"koKR\": \"바늘 돋친 거수\",\n";
-                ss << u8"    \"plPL\": \"Cierniowy kolos\",\n";
-                ss << u8"    \"esMX\": \"Coloso espinoso\",\n";
-                ss << u8"    \"jaJP\": \"刺の怪物\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Colosso Espinhoso\",\n";
-                ss << u8"    \"ruRU\": \"Шипастый гигант\",\n";
-                ss << u8"    \"zhCN\": \"刺木魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2921,\n";
-                ss << u8"    \"Key\": \"SpiderMagus\",\n";
-                ss << u8"    \"enUS\": \"Spider Magus\",\n";
-                ss << u8"    \"zhTW\": \"法毒蜘蛛\",\n";
-                ss << u8"    \"deDE\": \"Spinnenmagier\",\n";
-                ss << u8"    \"esES\": \"Araña maga\",\n";
-                ss << u8"    \"frFR\": \"Araignée-maga\",\n";
-                ss << u8"    \"itIT\": \"Mago Ragno\",\n";
-                ss << u8"    \"koKR\": \"거미 마술사\",\n";
-                ss << u8"    \"plPL\": \"Pajęczy magus\",\n";
-                ss << u8"    \"esMX\": \"Araña maga\",\n";
-                ss << u8"    \"jaJP\": \"大王蜘蛛\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Magus Aranha\",\n";
-                ss << u8"    \"ruRU\": \"Паук-маг\",\n";
-                ss << u8"    \"zhCN\": \"妖蛛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2922,\n";
-                ss << u8"    \"Key\": \"FlameSpider\",\n";
-                ss << u8"    \"enUS\": \"Flame Spider\",\n";
-                ss << u8"    \"zhTW\": \"火焰蜘蛛\",\n";
-                ss << u8"    \"deDE\": \"Flammenspinne\",\n";
-                ss << u8"    \"esES\": \"Araña llameante\",\n";
-                ss << u8"    \"frFR\": \"Araignée ardente\",\n";
-                ss << u8"    \"itIT\": \"Ragno di Fuoco\",\n";
-                ss << u8"    \"koKR\": \"불길 거미\",\n";
-                ss << u8"    \"plPL\": \"Ognisty pająk\",\n";
-                ss << u8"    \"esMX\": \"Araña ígnea\",\n";
-                ss << u8"    \"jaJP\": \"赤殻蜘蛛\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Aranha Flamejante\",\n";
-                ss << u8"    \"ruRU\": \"Огненный паук\",\n";
-                ss << u8"    \"zhCN\": \"火焰蛛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2923,\n";
-                ss << u8"    \"Key\": \"PoisonSpinner\",\n";
-                ss << u8"    \"enUS\": \"Poison Spinner\",\n";
-                ss << u8"    \"zhTW\": \"劇毒紡織者\",\n";
-                ss << u8"    \"deDE\": \"Giftspinne\",\n";
-                ss << u8"    \"esES\": \"Hilandera venenosa\",\n";
-                ss << u8"    \"frFR\": \"Tisseuse de poison\",\n";
-                ss << u8"    \"itIT\": \"Tessiveleno\",\n";
-                ss << u8"    \"koKR\": \"독 물레거미\",\n";
-                ss << u8"    \"plPL\": \"Tkacz trucizny\",\n";
-                ss << u8"    \"esMX\": \"Tejedora venenosa\",\n";
-                ss << u8"    \"jaJP\": \"毒吐き蜘蛛\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Tece-veneno\",\n";
-                ss << u8"    \"ruRU\": \"Ядовитый ткач\",\n";
-                ss << u8"    \"zhCN\": \"剧毒缠丝蛛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2924,\n";
-                ss << u8"    \"Key\": \"SandFisher\",\n";
-                ss << u8"    \"enUS\": \"Sand Fisher\",\n";
-                ss << u8"    \"zhTW\": \"沙漠釣蛛\",\n";
-                ss << u8"    \"deDE\": \"Sandfischer\",\n";
-                ss << u8"    \"esES\": \"Pescadora de arena\",\n";
-                ss << u8"    \"frFR\": \"Pêcheur des sables\",\n";
-                ss << u8"    \"itIT\": \"Abitatore delle Sabbie\",\n";
-                ss << u8"    \"koKR\": \"모래 사냥꾼\",\n";
-                ss << u8"    \"plPL\": \"Piaskowy rybak\",\n";
-                ss << u8"    \"esMX\": \"Araña arenera\",\n";
-                ss << u8"    \"jaJP\": \"砂漠蜘蛛\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Pescador Arenoso\",\n";
-                ss << u8"    \"ruRU\": \"Ловец песков\",\n";
-                ss << u8"    \"zhCN\": \"沙地捕食蛛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2925,\n";
-                ss << u8"    \"Key\": \"Arach\",\n";
-                ss << u8"    \"enUS\": \"Arach\",\n";
-                ss << u8"    \"zhTW\": \"巨大蜘蛛\",\n";
-                ss << u8"    \"deDE\": \"Arach\",\n";
-                ss << u8"    \"esES\": \"Arácnido\",\n";
-                ss << u8"    \"frFR\": \"Arach\",\n";
-                ss << u8"    \"itIT\": \"Aracnide\",\n";
-                ss << u8"    \"koKR\": \"거대 거미\",\n";
-                ss << u8"    \"plPL\": \"Arachnid\",\n";
-                ss << u8"    \"esMX\": \"Arácnida\",\n";
-                ss << u8"    \"jaJP\": \"大蜘蛛\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Aracnídea\",\n";
-                ss << u8"    \"ruRU\": \"Арах\",\n";
-                ss << u8"    \"zhCN\": \"结网蛛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2926,\n";
-                ss << u8"    \"Key\": \"BloodWing\",\n";
-                ss << u8"    \"enUS\": \"Blood Wing\",\n";
-                ss << u8"    \"zhTW\": \"血翅蚊\",\n";
-                ss << u8"    \"deDE\": \"Blutflügel\",\n";
-                ss << u8"    \"esES\": \"Ala sangrienta\",\n";
-                ss << u8"    \"frFR\": \"Aile sanglante\",\n";
-                ss << u8"    \"itIT\": \"Ala Insanguinata\",\n";
-                ss << u8"    \"koKR\": \"핏빛날개\",\n";
-                ss << u8"    \"plPL\": \"Krwawoskrzydły\",\n";
-                ss << u8"    \"esMX\": \"Alas sangrientas\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・ウィング\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Asa Sangrenta\",\n";
-                ss << u8"    \"ruRU\": \"Кровокрыл\",\n";
-                ss << u8"    \"zhCN\": \"血翼蚊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2927,\n";
-                ss << u8"    \"Key\": \"BloodHook\",\n";
-                ss << u8"    \"enUS\": \"Blood Hook\",\n";
-                ss << u8"    \"zhTW\": \"血鉤蚊\",\n";
-                ss << u8"    \"deDE\": \"Bluthaken\",\n";
-                ss << u8"    \"esES\": \"Garfio sangriento\",\n";
-                ss << u8"    \"frFR\": \"Crochet sanglant\",\n";
-                ss << u8"    \"itIT\": \"Uncino di Sangue\",\n";
-                ss << u8"    \"koKR\": \"피 갈고리\",\n";
-                ss << u8"    \"plPL\": \"Krwawy szpon\",\n";
-                ss << u8"    \"esMX\": \"Mosquito sanguinario\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・フック\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Gancho Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Кровавый коготь\",\n";
-                ss << u8"    \"zhCN\": \"血钩蚊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2928,\n";
-                ss << u8"    \"Key\": \"Feeder\",\n";
-                ss << u8"    \"enUS\": \"Feeder\",\n";
-                ss << u8"    \"zhTW\": \"餵血蚊\",\n";
-                ss << u8"    \"deDE\": \"Fresser\",\n";
-                ss << u8"    \"esES\": \"Comilón\",\n";
-                ss << u8"    \"frFR\": \"Nourricière\",\n";
-                ss << u8"    \"itIT\": \"Succhiavita\",\n";
-                ss << u8"    \"koKR\": \"피먹이\",\n";
-                ss << u8"    \"plPL\": \"Karmiciel\",\n";
-                ss << u8"    \"esMX\": \"Devorador alado\",\n";
-                ss << u8"    \"jaJP\": \"フィーダー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cevador\",\n";
-                ss << u8"    \"ruRU\": \"Едок\",\n";
-                ss << u8"    \"zhCN\": \"捕食蚊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2929,\n";
-                ss << u8"    \"Key\": \"Sucker\",\n";
-                ss << u8"    \"enUS\": \"Sucker\",\n";
-                ss << u8"    \"zhTW\": \"吸血蚊\",\n";
-                ss << u8"    \"deDE\": \"Sauger\",\n";
-                ss << u8"    \"esES\": \"Chupóptero\",\n";
-                ss << u8"    \"frFR\": \"Ventouse\",\n";
-                ss << u8"    \"itIT\": \"Prosciugatore\",\n";
-                ss << u8"    \"koKR\": \"피빨이\",\n";
-                ss << u8"    \"plPL\": \"Pijawka\",\n";
-                ss << u8"    \"esMX\": \"Succionador\",\n";
-                ss << u8"    \"jaJP\": \"サッカー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Sugador\",\n";
-                ss << u8"    \"ruRU\": \"Кровосос\",\n";
-                ss << u8"    \"zhCN\": \"吸食蚊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2930,\n";
-                ss << u8"    \"Key\": \"WingedNightmare\",\n";
-                ss << u8"    \"enUS\": \"Winged Nightmare\",\n";
-                ss << u8"    \"zhTW\": \"飛翼夢魘\",\n";
-                ss << u8"    \"deDE\": \"Geflügelter Alptraum\",\n";
-                ss << u8"    \"esES\": \"Pesadilla alada\",\n";
-                ss << u8"    \"frFR\": \"Cauchemar ailé\",\n";
-                ss << u8"    \"itIT\": \"Incubo Alato\",\n";
-                ss << u8"    \"koKR\": \"날개 달린 악몽\",\n";
-                ss << u8"    \"plPL\": \"Skrzydlaty koszmar\",\n";
-                ss << u8"    \"esMX\": \"Pesadilla alada\",\n";
-                ss << u8"    \"jaJP\": \"ウィングド・ナイトメア\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Pesadelo Alado\",\n";
-                ss << u8"    \"ruRU\": \"Крылатый кошмар\",\n";
-                ss << u8"    \"zhCN\": \"噩梦鸟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2931,\n";
-                ss << u8"    \"Key\": \"HellBuzzard\",\n";
-                ss << u8"    \"enUS\": \"Hell Buzzard\",\n";
-                ss << u8"    \"zhTW\": \"地獄兀鷹\",\n";
-                ss << u8"    \"deDE\": \"Höllenbussard\",\n";
-                ss << u8"    \"esES\": \"Águila infernal\",\n";
-                ss << u8"    \"frFR\": \"Buse des Enfers\",\n";
-                ss << u8"    \"itIT\": \"Avvoltoio Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥 독수리\",\n";
-                ss << u8"    \"plPL\": \"Piekielny ścierwojad\",\n";
-                ss << u8"    \"esMX\": \"Gavilán infernal\",\n";
-                ss << u8"    \"jaJP\": \"ヘル・バザード\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Urubu Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Адский канюк\",\n";
-                ss << u8"    \"zhCN\": \"地狱秃鹫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2932,\n";
-                ss << u8"    \"Key\": \"UndeadScavenger\",\n";
-                ss << u8"    \"enUS\": \"Undead Scavenger\",\n";
-                ss << u8"    \"zhTW\": \"不死食腐鳥\",\n";
-                ss << u8"    \"deDE\": \"Untoter Aasfresser\",\n";
-                ss << u8"    \"esES\": \"Carroñero viviente\",\n";
-                ss << u8"    \"frFR\": \"Charognard mort-vivant\",\n";
-                ss << u8"    \"itIT\": \"Saprofago Non Morto\",\n";
-                ss << u8"    \"koKR\": \"언데드 시체청소부\",\n";
-                ss << u8"    \"plPL\": \"Trupojad\",\n";
-                ss << u8"    \"esMX\": \"Carroñero no muerto\",\n";
-                ss << u8"    \"jaJP\": \"アンデッド・スカヴェンジャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Vorazgo Morto-vivo\",\n";
-                ss << u8"    \"ruRU\": \"Оживленный падальщик\",\n";
-                ss << u8"    \"zhCN\": \"食尸鸟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2933,\n";
-                ss << u8"    \"Key\": \"CarrionBird\",\n";
-                ss << u8"    \"enUS\": \"Carrion Bird\",\n";
-                ss << u8"    \"zhTW\": \"食腐鳥\",\n";
-                ss << u8"    \"deDE\": \"Aasvogel\",\n";
-                ss << u8"    \"esES\": \"Pájaro carroñero\",\n";
-                ss << u8"    \"frFR\": \"Charognard\",\n";
-                ss << u8"    \"itIT\": \"Mangiacarogne\",\n";
-                ss << u8"    \"koKR\": \"송장새\",\n";
-                ss << u8"    \"plPL\": \"Zgnilec\",\n";
-                ss << u8"    \"esMX\": \"Ave carroñera\",\n";
-                ss << u8"    \"jaJP\": \"キャリオン・バード\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Ave Carniceira\",\n";
-                ss << u8"    \"ruRU\": \"Стервятник\",\n";
-                ss << u8"    \"zhCN\": \"食腐鸟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2934,\n";
-                ss << u8"    \"Key\": \"Unraveler\",\n";
-                ss << u8"    \"enUS\": \"Unraveler\",\n";
-                ss << u8"    \"zhTW\": \"解繃者\",\n";
-                ss << u8"    \"deDE\": \"Vernichter\",\n";
-                ss << u8"    \"esES\": \"Desenredador\",\n";
-                ss << u8"    \"frFR\": \"Disloqueuse\",\n";
-                ss << u8"    \"itIT\": \"Celato\",\n";
-                ss << u8"    \"koKR\": \"풀어헤치는 자\",\n";
-                ss << u8"    \"plPL\": \"Wyzwoliciel\",\n";
-                ss << u8"    \"esMX\": \"Desenredador\",\n";
-                ss << u8"    \"jaJP\": \"綻びし者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Desfiador\",\n";
-                ss << u8"    \"ruRU\": \"Разматыватель\",\n";
-                ss << u8"    \"zhCN\": \"剖尸者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2935,\n";
-                ss << u8"    \"Key\": \"Guardian\",\n";
-                ss << u8"    \"enUS\": \"Guardian\",\n";
-                ss << u8"    \"zhTW\": \"守護者\",\n";
-                ss << u8"    \"deDE\": \"Wächter\",\n";
-                ss << u8"    \"esES\": \"Guardián\",\n";
-                ss << u8"    \"frFR\": \"Gardienne\",\n";
-                ss << u8"    \"itIT\": \"Guardiano\",\n";
-                ss << u8"    \"koKR\": \"수호자\",\n";
-                ss << u8"    \"plPL\": \"Strażnik\",\n";
-                ss << u8"    \"esMX\": \"Guardián\",\n";
-                ss << u8"    \"jaJP\": \"守護せし者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Guardião\",\n";
-                ss << u8"    \"ruRU\": \"Страж\",\n";
-                ss << u8"    \"zhCN\": \"墓穴守卫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2936,\n";
-                ss << u8"    \"Key\": \"HollowOne\",\n";
-                ss << u8"    \"enUS\": \"Hollow One\",\n";
-                ss << u8"    \"zhTW\": \"中空屍怪\",\n";
-                ss << u8"    \"deDE\": \"Leere Kreatur\",\n";
-                ss << u8"    \"esES\": \"Vacuo\",\n";
-                ss << u8"    \"frFR\": \"Caverneux\",\n";
-                ss << u8"    \"itIT\": \"Affamato\",\n";
-                ss << u8"    \"koKR\": \"공허한 자\",\n";
-                ss << u8"    \"plPL\": \"Pusta istota\",\n";
-                ss << u8"    \"esMX\": \"Oquedad\",\n";
-                ss << u8"    \"jaJP\": \"虚ろなる者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Desolado\",\n";
-                ss << u8"    \"ruRU\": \"Опустошенный\",\n";
-                ss << u8"    \"zhCN\": \"空壳尸魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2937,\n";
-                ss << u8"    \"Key\": \"Horadrim Ancient\",\n";
-                ss << u8"    \"enUS\": \"Horadrim Ancient\",\n";
-                ss << u8"    \"zhTW\": \"赫拉迪姆古屍\",\n";
-                ss << u8"    \"deDE\": \"Horadrimvorfahr\",\n";
-                ss << u8"    \"esES\": \"Anciano Horadrim\",\n";
-                ss << u8"    \"frFR\": \"Ancien horadrim\",\n";
-                ss << u8"    \"itIT\": \"Antico Horadrim\",\n";
-                ss << u8"    \"koKR\": \"고대 호라드림\",\n";
-                ss << u8"    \"plPL\": \"Prastary horadrim\",\n";
-                ss << u8"    \"esMX\": \"Ancestro horadrim\",\n";
-                ss << u8"    \"jaJP\": \"古代のホラドリム\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ancestral Horadrim\",\n";
-                ss << u8"    \"ruRU\": \"Хорадримский древний\",\n";
-                ss << u8"    \"zhCN\": \"赫拉迪姆先贤\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2938,\n";
-                ss << u8"    \"Key\": \"AlbinoRoach\",\n";
-                ss << u8"    \"enUS\": \"Bone Scarab\",\n";
-                ss << u8"    \"zhTW\": \"骸骨甲蟲\",\n";
-                ss << u8"    \"deDE\": \"Knochenkäfer\",\n";
-                ss << u8"    \"esES\": \"Alfazaque de hueso\",\n";
-                ss << u8"    \"frFR\": \"Scarabée d’os\",\n";
-                ss << u8"    \"itIT\": \"Scarabeo d'Ossa\",\n";
-                ss << u8"    \"koKR\": \"뼈 풍뎅이\",\n";
-                ss << u8"    \"plPL\": \"Kościany skarabeusz\",\n";
-                ss << u8"    \"esMX\": \"Escarabajo óseo\",\n";
-                ss << u8"    \"jaJP\": \"ボーン・スカラベ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Escaravelho Ósseo\",\n";
-                ss << u8"    \"ruRU\": \"Костяной скарабей\",\n";
-                ss << u8"    \"zhCN\": \"白骨圣甲虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2939,\n";
-                ss << u8"    \"Key\": \"SteelWeevil\",\n";
-                ss << u8"    \"enUS\": \"Steel Scarab\",\n";
-                ss << u8"    \"zhTW\": \"鋼鐵甲蟲\",\n";
-                ss << u8"    \"deDE\": \"Stahlkäfer\",\n";
-                ss << u8"    \"esES\": \"Alfazaque de acero\",\n";
-                ss << u8"    \"frFR\": \"Scarabée d’acier\",\n";
-                ss << u8"    \"itIT\": \"Scarabeo d'Acciaio\",\n";
-                ss << u8"    \"koKR\": \"강철 풍뎅이\",\n";
-                ss << u8"    \"plPL\": \"Stalowy skarabeusz\",\n";
-                ss << u8"    \"esMX\": \"Escarabajo metálico\",\n";
-                ss << u8"    \"jaJP\": \"スチール・スカラベ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Escaravelho de Aço\",\n";
-                ss << u8"    \"ruRU\": \"Стальной скарабей\",\n";
-                ss << u8"    \"zhCN\": \"钢铁圣甲虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2940,\n";
-                ss << u8"    \"Key\": \"Scarab\",\n";
-                ss << u8"    \"enUS\": \"Scarab\",\n";
-                ss << u8"    \"zhTW\": \"惡魔甲蟲\",\n";
-                ss << u8"    \"deDE\": \"Skarabäus\",\n";
-                ss << u8"    \"esES\": \"Alfazaque\",\n";
-                ss << u8"    \"frFR\": \"Scarabée\",\n";
-                ss << u8"    \"itIT\": \"Scarabeo\",\n";
-                ss << u8"    \"koKR\": \"풍뎅이\",\n";
-                ss << u8"    \"plPL\": \"Skarabeusz\",\n";
-                ss << u8"    \"esMX\": \"Escarabajo\",\n";
-                ss << u8"    \"jaJP\": \"スカラベ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Escaravelho\",\n";
-                ss << u8"    \"ruRU\": \"Скарабей\",\n";
-                ss << u8"    \"zhCN\": \"圣甲虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2941,\n";
-                ss << u8"    \"Key\": \"SandWarrior\",\n";
-                ss << u8"    \"enUS\": \"Death Beetle\",\n";
-                ss << u8"    \"zhTW\": \"死亡甲蟲\",\n";
-                ss << u8"    \"deDE\": \"Todeskäfer\",\n";
-                ss << u8"    \"esES\": \"Escarabajo de la muerte\",\n";
-                ss << u8"    \"frFR\": \"Scarabée de mort\",\n";
-                ss << u8"    \"itIT\": \"Scarafaggio della Morte\",\n";
-                ss << u8"    \"koKR\": \"죽음의 딱정벌레\",\n";
-                ss << u8"    \"plPL\": \"Żuk śmierci\",\n";
-                ss << u8"    \"esMX\": \"Escarabajo mortal\",\n";
-                ss << u8"    \"jaJP\": \"デス・ビートル\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Besouro Fúnebre\",\n";
-                ss << u8"    \"ruRU\": \"Жук-убийца\",\n";
-                ss << u8"    \"zhCN\": \"死亡甲虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2942,\n";
-                ss << u8"    \"Key\": \"DungSoldier\",\n";
-                ss << u8"    \"enUS\": \"Dung Soldier\",\n";
-                ss << u8"    \"zhTW\": \"蜣螂兵蟲\",\n";
-                ss << u8"    \"deDE\": \"Dungsoldat\",\n";
-                ss << u8"    \"esES\": \"Soldado coprófago\",\n";
-                ss << u8"    \"frFR\": \"Soldat de la fange\",\n";
-                ss << u8"    \"itIT\": \"Stercorario Soldato\",\n";
-                ss << u8"    \"koKR\": \"쇠똥구리 병사\",\n";
-                ss << u8"    \"plPL\": \"Żuk wojownik\",\n";
-                ss << u8"    \"esMX\": \"Escarabajo estercolero\",\n";
-                ss << u8"    \"jaJP\": \"ダング・ソルジャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Escaravelho Soldado\",\n";
-                ss << u8"    \"ruRU\": \"Навозник-солдат\",\n";
-                ss << u8"    \"zhCN\": \"水肥战士\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2943,\n";
-                ss << u8"    \"Key\": \"HellSwarm\",\n";
-                ss << u8"    \"enUS\": \"Hell Swarm\",\n";
-                ss << u8"    \"zhTW\": \"地獄蟲群\",\n";
-                ss << u8"    \"deDE\": \"Höllenschwarm\",\n";
-                ss << u8"    \"esES\": \"Enjambre infernal\",\n";
-                ss << u8"    \"frFR\": \"Essaim des Enfers\",\n";
-                ss << u8"    \"itIT\": \"Sciame Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥 벌레떼\",\n";
-                ss << u8"    \"plPL\": \"Piekielny rój\",\n";
-                ss << u8"    \"esMX\": \"Enjambre infernal\",\n";
-                ss << u8"    \"jaJP\": \"地獄蝗の群れ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Enxame Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Адский рой\",\n";
-                ss << u8"    \"zhCN\": \"地狱虫群\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2944,\n";
-                ss << u8"    \"Key\": \"PlagueBugs\",\n";
-                ss << u8"    \"enUS\": \"Plague Bugs\",\n";
-                ss << u8"    \"zhTW\": \"瘟疫之蟲\",\n";
-                ss << u8"    \"deDE\": \"Pestkäfer\",\n";
-                ss << u8"    \"esES\": \"Chinches de la peste\",\n";
-                ss << u8"    \"frFR\": \"Vermine pestiférée\",\n";
-                ss << u8"    \"itIT\": \"Sciame Morbifero\",\n";
-                ss << u8"    \"koKR\": \"역병 벌레떼\",\n";
-                ss << u8"    \"plPL\": \"Pluskwy zarazy\",\n";
-                ss << u8"    \"esMX\": \"Bichos pestilentes\",\n";
-                ss << u8"    \"jaJP\": \"厄災蝗の群れ\",\n";
-                ss << u8"    \"ptBR\": \"[mp]Insetos Pestilentos\",\n";
-                ss << u8"    \"ruRU\": \"Чумные жуки\",\n";
-                ss << u8"    \"zhCN\": \"疫虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2945,\n";
-                ss << u8"    \"Key\": \"BlackLocusts\",\n";
-                ss << u8"    \"enUS\": \"Black Locusts\",\n";
-                ss << u8"    \"zhTW\": \"黑色蝗蟲\",\n";
-                ss << u8"    \"deDE\": \"Schwarze Heuschrecken\",\n";
-                ss << u8"    \"esES\": \"Langostas negras\",\n";
-                ss << u8"    \"frFR\": \"Criquets noirs\",\n";
-                ss << u8"    \"itIT\": \"Sciame di Locuste\",\n";
-                ss << u8"    \"koKR\": \"검은 메뚜기 떼\",\n";
-                ss << u8"    \"plPL\": \"Czarna szarańcza\",\n";
-                ss << u8"    \"esMX\": \"Langostas oscuras\",\n";
-                ss << u8"    \"jaJP\": \"闇蝗の群れ\",\n";
-                ss << u8"    \"ptBR\": \"[mp]Gafanhotos Tenebrosos\",\n";
-                ss << u8"    \"ruRU\": \"Черная саранча\",\n";
-                ss << u8"    \"zhCN\": \"黑蝗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2946,\n";
-                ss << u8"    \"Key\": \"Itchies\",\n";
-                ss << u8"    \"enUS\": \"Itchies\",\n";
-                ss << u8"    \"zhTW\": \"刺螫蟲群\",\n";
-                ss << u8"    \"deDE\": \"Stichlinge\",\n";
-                ss << u8"    \"esES\": \"Cínifes\",\n";
-                ss << u8"    \"frFR\": \"Punaises\",\n";
-                ss << u8"    \"itIT\": \"Sciame Urticante\",\n";
-                ss << u8"    \"koKR\": \"피부병 벌레떼\",\n";
-                ss << u8"    \"plPL\": \"Świerzb\",\n";
-                ss << u8"    \"esMX\": \"Sarnosos\",\n";
-                ss << u8"    \"jaJP\": \"蝗の群れ\",\n";
-                ss << u8"    \"ptBR\": \"[mp]Sarnentos\",\n";
-                ss << u8"    \"ruRU\": \"Гнус\",\n";
-                ss << u8"    \"zhCN\": \"蚤群\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2947,\n";
-                ss << u8"    \"Key\": \"HellCat\",\n";
-                ss << u8"    \"enUS\": \"Hell Cat\",\n";
-                ss << u8"    \"zhTW\": \"地獄拉庫尼\",\n";
-                ss << u8"    \"deDE\": \"Höllenkatze\",\n";
-                ss << u8"    \"esES\": \"Gata infernal\",\n";
-                ss << u8"    \"frFR\": \"Chat des Enfers\",\n";
-                ss << u8"    \"itIT\": \"Felino Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥 고양이\",\n";
-                ss << u8"    \"plPL\": \"Piekielny kot\",\n";
-                ss << u8"    \"esMX\": \"Gata infernal\",\n";
-                ss << u8"    \"jaJP\": \"ヘル・キャット\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Felino Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Адская кошка\",\n";
-                ss << u8"    \"zhCN\": \"地狱猫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2948,\n";
-                ss << u8"    \"Key\": \"NightTiger\",\n";
-                ss << u8"    \"enUS\": \"Night Tiger\",\n";
-                ss << u8"    \"zhTW\": \"暗夜拉庫尼\",\n";
-                ss << u8"    \"deDE\": \"Nachttiger\",\n";
-                ss << u8"    \"esES\": \"Tigresa de la noche\",\n";
-                ss << u8"    \"frFR\": \"Tigre de la nuit\",\n";
-                ss << u8"    \"itIT\": \"Tigre della Notte\",\n";
-                ss << u8"    \"koKR\": \"밤 호랑이\",\n";
-                ss << u8"    \"plPL\": \"Nocny tygrys\",\n";
-                ss << u8"    \"esMX\": \"Tigresa nocturna\",\n";
-                ss << u8"    \"jaJP\": \"ナイト・タイガー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Tigre Noturno\",\n";
-                ss << u8"    \"ruRU\": \"Ночная тигрица\",\n";
-                ss << u8"    \"zhCN\": \"夜行虎\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2949,\n";
-                ss << u8"    \"Key\": \"SaberCat\",\n";
-                ss << u8"    \"enUS\": \"Saber Cat\",\n";
-                ss << u8"    \"zhTW\": \"拉庫尼\",\n";
-                ss << u8"    \"deDE\": \"Säbelkatze\",\n";
-                ss << u8"    \"esES\": \"Dientes de sable\",\n";
-                ss << u8"    \"frFR\": \"Tigre à dents de sabre\",\n";
-                ss << u8"    \"itIT\": \"Felino dai Denti a Sciabola\",\n";
-                ss << u8"    \"koKR\": \"사브르 고양이\",\n";
-                ss << u8"    \"plPL\": \"Szablokot\",\n";
-                ss << u8"    \"esMX\": \"Gata filosa\",\n";
-                ss << u8"    \"jaJP\": \"サーベル・キャット\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Felino-de-Sabre\",\n";
-                ss << u8"    \"ruRU\": \"Саблезубая кошка\",\n";
-                ss << u8"    \"zhCN\": \"剑齿猫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2950,\n";
-                ss << u8"    \"Key\": \"Huntress\",\n";
-                ss << u8"    \"enUS\": \"Huntress\",\n";
-                ss << u8"    \"zhTW\": \"女獵手\",\n";
-                ss << u8"    \"deDE\": \"Sucherin\",\n";
-                ss << u8"    \"esES\": \"Cazadora\",\n";
-                ss << u8"    \"frFR\": \"Chasseresse\",\n";
-                ss << u8"    \"itIT\": \"Cacciatrice\",\n";
-                ss << u8"    \"koKR\": \"여사냥꾼\",\n";
-                ss << u8"    \"plPL\": \"Łowczyni\",\n";
-                ss << u8"    \"esMX\": \"Cazadora\",\n";
-                ss << u8"    \"jaJP\": \"ハントレス\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Caçadora\",\n";
-                ss << u8"    \"ruRU\": \"Охотница\",\n";
-                ss << u8"    \"zhCN\": \"母猎猫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2951,\n";
-                ss << u8"    \"Key\": \"RazorPitDemon\",\n";
-                ss << u8"    \"enUS\": \"Cliff Lurker\",\n";
-                ss << u8"    \"zhTW\": \"峭壁潛伏者\",\n";
-                ss << u8"    \"deDE\": \"Klippenschleicher\",\n";
-                ss << u8"    \"esES\": \"Rondador de los acantilados\",\n";
-                ss << u8"    \"frFR\": \"Rôdeur des falaises\",\n";
-                ss << u8"    \"itIT\": \"Creatura dei Dirupi\",\n";
-                ss << u8"    \"koKR\": \"벼랑 잠복꾼\",\n";
-                ss << u8"    \"plPL\": \"Skalny skoczek\",\n";
-                ss << u8"    \"esMX\": \"Acechador escarpado\",\n";
-                ss << u8"    \"jaJP\": \"クリフ・ラーカー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Espreitador do Penhasco\",\n";
-                ss << u8"    \"ruRU\": \"Скальный прыгун\",\n";
-                ss << u8"    \"zhCN\": \"峭壁潜伏魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2952,\n";
-                ss << u8"    \"Key\": \"TreeLurker\",\n";
-                ss << u8"    \"enUS\": \"Tree Lurker\",\n";
-                ss << u8"    \"zhTW\": \"樹木潛伏者\",\n";
-                ss << u8"    \"deDE\": \"Baumschleicher\",\n";
-                ss << u8"    \"esES\": \"Rondador de los árboles\",\n";
-                ss << u8"    \"frFR\": \"Sycophante\",\n";
-                ss << u8"    \"itIT\": \"Bestia degli Alberi\",\n";
-                ss << u8"    \"koKR\": \"나무 잠복꾼\",\n";
-                ss << u8"    \"plPL\": \"Leśny skoczek\",\n";
-                ss << u8"    \"esMX\": \"Acechador arbóreo\",\n";
-                ss << u8"    \"jaJP\": \"ツリー・ラーカー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Espreitador Arbóreo\",\n";
-                ss << u8"    \"ruRU\": \"Древесный прыгун\",\n";
-                ss << u8"    \"zhCN\": \"林木潜伏魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2953,\n";
-                ss << u8"    \"Key\": \"CaveLeaper\",\n";
-                ss << u8"    \"enUS\": \"Cave Leaper\",\n";
-                ss << u8"    \"zhTW\": \"洞穴躍行魔\",\n";
-                ss << u8"    \"deDE\": \"Höhlenspringer\",\n";
-                ss << u8"    \"esES\": \"Saltador de las cavernas\",\n";
-                ss << u8"    \"frFR\": \"Farfadet cavernicole\",\n";
-                ss << u8"    \"itIT\": \"Saltatore delle Caverne\",\n";
-                ss << u8"    \"koKR\": \"동굴 껑충이\",\n";
-                ss << u8"    \"plPL\": \"Jaskiniowy skoczek\",\n";
-                ss << u8"    \"esMX\": \"Saltador de cuevas\",\n";
-                ss << u8"    \"jaJP\": \"ケイブ・リーパー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Saltador da Caverna\",\n";
-                ss << u8"    \"ruRU\": \"Пещерный прыгун\",\n";
-                ss << u8"    \"zhCN\": \"洞穴跃行魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2954,\n";
-                ss << u8"    \"Key\": \"TombCreeper\",\n";
-                ss << u8"    \"enUS\": \"Tomb Creeper\",\n";
-                ss << u8"    \"zhTW\": \"古墓爬跳者\",\n";
-                ss << u8"    \"deDE\": \"Grabkriecher\",\n";
-                ss << u8"    \"esES\": \"Salteador de tumbas\",\n";
-                ss << u8"    \"frFR\": \"Lierre tombal\",\n";
-                ss << u8"    \"itIT\": \"Orrore delle Tombe\",\n";
-                ss << u8"    \"koKR\": \"무덤 추적수\",\n";
-                ss << u8"    \"plPL\": \"Grobowy pełzacz\",\n";
-                ss << u8"    \"esMX\": \"Reptante de tumbas\",\n";
-                ss << u8"    \"jaJP\": \"トゥーム・クリーパー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Rastejante da Tumba\",\n";
-                ss << u8"    \"ruRU\": \"Могильный ползун\",\n";
-                ss << u8"    \"zhCN\": \"墓地跃行魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2955,\n";
-                ss << u8"    \"Key\": \"SandLeaper\",\n";
-                ss << u8"    \"enUS\": \"Sand Leaper\",\n";
-                ss << u8"    \"zhTW\": \"沙漠躍行魔\",\n";
-                ss << u8"    \"deDE\": \"Sandspringer\",\n";
-                ss << u8"    \"esES\": \"Saltador de arena\",\n";
-                ss << u8"    \"frFR\": \"Farfadet des sables\",\n";
-                ss << u8"    \"itIT\": \"Saltatore delle Sabbie\",\n";
-                ss << u8"    \"koKR\": \"모래 껑충이\",\n";
-                ss << u8"    \"plPL\": \"Piaskowy skoczek\",\n";
-                ss << u8"    \"esMX\": \"Saltador de arena\",\n";
-                ss << u8"    \"jaJP\": \"サンド・リーパー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Saltador Arenoso\",\n";
-                ss << u8"    \"ruRU\": \"Песчаный прыгун\",\n";
-                ss << u8"    \"zhCN\": \"沙地跃行魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2956,\n";
-                ss << u8"    \"Key\": \"TombViper\",\n";
-                ss << u8"    \"enUS\": \"Tomb Viper\",\n";
-                ss << u8"    \"zhTW\": \"古墓蛇魔\",\n";
-                ss << u8"    \"deDE\": \"Grabviper\",\n";
-                ss << u8"    \"esES\": \"Víbora de la tumba\",\n";
-                ss << u8"    \"frFR\": \"Vipère des tombes\",\n";
-                ss << u8"    \"itIT\": \"Vipera delle Tombe\",\n";
-                ss << u8"    \"koKR\": \"무덤 독사\",\n";
-                ss << u8"    \"plPL\": \"Grobowa żmija\",\n";
-                ss << u8"    \"esMX\": \"Vipérido sepulcral\",\n";
-                ss << u8"    \"jaJP\": \"トゥーム・ヴァイパー\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Víbora da Tumba\",\n";
-                ss << u8"    \"ruRU\": \"Могильный змей\",\n";
-                ss << u8"    \"zhCN\": \"古墓蝮蛇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2957,\n";
-                ss << u8"    \"Key\": \"PitViper\",\n";
-                ss << u8"    \"enUS\": \"Pit Viper\",\n";
-                ss << u8"    \"zhTW\": \"地穴蛇魔\",\n";
-                ss << u8"    \"deDE\": \"Grubenviper\",\n";
-                ss << u8"    \"esES\": \"Víbora del foso\",\n";
-                ss << u8"    \"frFR\": \"Vipère de la fosse\",\n";
-                ss << u8"    \"itIT\": \"Vipera dell'Abisso\",\n";
-                ss << u8"    \"koKR\": \"구덩이 독사\",\n";
-                ss << u8"    \"plPL\": \"Żmija czeluści\",\n";
-                ss << u8"    \"esMX\": \"Vipérido del foso\",\n";
-                ss << u8"    \"jaJP\": \"ピット・ヴァイパー\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Víbora do Fosso\",\n";
-                ss << u8"    \"ruRU\": \"Змей бездны\",\n";
-                ss << u8"    \"zhCN\": \"深渊蝮蛇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2958,\n";
-                ss << u8"    \"Key\": \"Salamander\",\n";
-                ss << u8"    \"enUS\": \"Salamander\",\n";
-                ss << u8"    \"zhTW\": \"火蜥蛇魔\",\n";
-                ss << u8"    \"deDE\": \"Salamander\",\n";
-                ss << u8"    \"esES\": \"Salamandra\",\n";
-                ss << u8"    \"frFR\": \"Salamandre\",\n";
-                ss << u8"    \"itIT\": \"Salamandra\",\n";
-                ss << u8"    \"koKR\": \"불도마뱀\",\n";
-                ss << u8"    \"plPL\": \"Salamandra\",\n";
-                ss << u8"    \"esMX\": \"Salamandra\",\n";
-                ss << u8"    \"jaJP\": \"サラマンダー\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Salamandra\",\n";
-                ss << u8"    \"ruRU\": \"Саламандра\",\n";
-                ss << u8"    \"zhCN\": \"蟒螈蛇妖\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2959,\n";
-                ss << u8"    \"Key\": \"ClawViper\",\n";
-                ss << u8"    \"enUS\": \"Claw Viper\",\n";
-                ss << u8"    \"zhTW\": \"利爪蛇魔\",\n";
-                ss << u8"    \"deDE\": \"Klauenviper\",\n";
-                ss << u8"    \"esES\": \"Garra viperina\",\n";
-                ss << u8"    \"frFR\": \"Vipère de la Griffe\",\n";
-                ss << u8"    \"itIT\": \"Vipera Artigliata\",\n";
-                ss << u8"    \"koKR\": \"발톱 독사\",\n";
-                ss << u8"    \"plPL\": \"Żmijoszpon\",\n";
-                ss << u8"    \"esMX\": \"Vipérido de garras\",\n";
-                ss << u8"    \"jaJP\": \"クロウ・ヴァイパー\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Víbora da Garra\",\n";
-                ss << u8"    \"ruRU\": \"Когтистый змей\",\n";
-                ss << u8"    \"zhCN\": \"利爪蝮蛇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2960,\n";
-                ss << u8"    \"Key\": \"SerpentMagus\",\n";
-                ss << u8"    \"enUS\": \"Serpent Magus\",\n";
-                ss << u8"    \"zhTW\": \"蛇魔法師\",\n";
-                ss << u8"    \"deDE\": \"Natternmagier\",\n";
-                ss << u8"    \"esES\": \"Serpiente maga\",\n";
-                ss << u8"    \"frFR\": \"Magus serpentin\",\n";
-                ss << u8"    \"itIT\": \"Mago Serpente\",\n";
-                ss << u8"    \"koKR\": \"구렁이 마술사\",\n";
-                ss << u8"    \"plPL\": \"Wężowy magus\",\n";
-                ss << u8"    \"esMX\": \"Mago serpentino\",\n";
-                ss << u8"    \"jaJP\": \"サーペント・マグス\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Magus Serpente\",\n";
-                ss << u8"    \"ruRU\": \"Змей-колдун\",\n";
-                ss << u8"    \"zhCN\": \"蛇妖法师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2961,\n";
-                ss << u8"    \"Key\": \"WorldKiller\",\n";
-                ss << u8"    \"enUS\": \"Blood Maggot\",\n";
-                ss << u8"    \"zhTW\": \"鮮血蛆蟲\",\n";
-                ss << u8"    \"deDE\": \"Blutwurm\",\n";
-                ss << u8"    \"esES\": \"Gusano de sangre\",\n";
-                ss << u8"    \"frFR\": \"Asticot de sang\",\n";
-                ss << u8"    \"itIT\": \"Larva del Sangue\",\n";
-                ss << u8"    \"koKR\": \"피 구더기\",\n";
-                ss << u8"    \"plPL\": \"Krwiożercza larwa\",\n";
-                ss << u8"    \"esMX\": \"Cresa de sangre\",\n";
-                ss << u8"    \"jaJP\": \"血濡れた地虫\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Verme Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Кровавая мокрица\",\n";
-                ss << u8"    \"zhCN\": \"血虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2962,\n";
-                ss << u8"    \"Key\": \"GiantLamprey\",\n";
-                ss << u8"    \"enUS\": \"Giant Lamprey\",\n";
-                ss << u8"    \"zhTW\": \"吸血巨蟲\",\n";
-                ss << u8"    \"deDE\": \"Riesenmuräne\",\n";
-                ss << u8"    \"esES\": \"Lamprea gigante\",\n";
-                ss << u8"    \"frFR\": \"Lamproie géante\",\n";
-                ss << u8"    \"itIT\": \"Lampreda Gigante\",\n";
-                ss << u8"    \"koKR\": \"거대 빨판구더기\",\n";
-                ss << u8"    \"plPL\": \"Skolopendromorf\",\n";
-                ss << u8"    \"esMX\": \"Lamprea gigante\",\n";
-                ss << u8"    \"jaJP\": \"吸血地虫\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Lampreia Gigante\",\n";
-                ss << u8"    \"ruRU\": \"Гигантская жужелица\",\n";
-                ss << u8"    \"zhCN\": \"巨型八目虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2963,\n";
-                ss << u8"    \"Key\": \"Devourer\",\n";
-                ss << u8"    \"enUS\": \"Devourer\",\n";
-                ss << u8"    \"zhTW\": \"吞噬者\",\n";
-                ss << u8"    \"deDE\": \"Verschlinger\",\n";
-                ss << u8"    \"esES\": \"Devorador\",\n";
-                ss << u8"    \"frFR\": \"Dévoreur\",\n";
-                ss << u8"    \"itIT\": \"Divoratore\",\n";
-                ss << u8"    \"koKR\": \"걸신구더기\",\n";
-                ss << u8"    \"plPL\": \"Pożeracz\",\n";
-                ss << u8"    \"esMX\": \"Devorador\",\n";
-                ss << u8"    \"jaJP\": \"貪る地虫\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Devorador\",\n";
-                ss << u8"    \"ruRU\": \"Пожиратель\",\n";
-                ss << u8"    \"zhCN\": \"吞食虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2964,\n";
-                ss << u8"    \"Key\": \"RockWorm\",\n";
-                ss << u8"    \"enUS\": \"Rock Worm\",\n";
-                ss << u8"    \"zhTW\": \"鑽岩蛆蟲\",\n";
-                ss << u8"    \"deDE\": \"Felswurm\",\n";
-                ss << u8"    \"esES\": \"Gusano de roca\",\n";
-                ss << u8"    \"frFR\": \"Ver des roches\",\n";
-                ss << u8"    \"itIT\": \"Verme di Roccia\",\n";
-                ss << u8"    \"koKR\": \"바위 벌레\",\n";
-                ss << u8"    \"plPL\": \"Skalny robak\",\n";
-                ss << u8"    \"esMX\": \"Gusano de piedra\",\n";
-                ss << u8"    \"jaJP\": \"岩棲みの地虫\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Verme Rochoso\",\n";
-                ss << u8"    \"ruRU\": \"Каменный червь\",\n";
-                ss << u8"    \"zhCN\": \"岩虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2965,\n";
-                ss << u8"    \"Key\": \"SandMaggot\",\n";
-                ss << u8"    \"enUS\": \"Sand Maggot\",\n";
-                ss << u8"    \"zhTW\": \"沙漠蛆蟲\",\n";
-                ss << u8"    \"deDE\": \"Sandwurm\",\n";
-                ss << u8"    \"esES\": \"Gusano de arena\",\n";
-                ss << u8"    \"frFR\": \"Asticot des sables\",\n";
-                ss << u8"    \"itIT\": \"Larva della Sabbia\",\n";
-                ss << u8"    \"koKR\": \"모래 구더기\",\n";
-                ss << u8"    \"plPL\": \"Piasecznik\",\n";
-                ss << u8"    \"esMX\": \"Cresa de arena\",\n";
-                ss << u8"    \"jaJP\": \"砂漠の地虫\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Verme Arenoso\",\n";
-                ss << u8"    \"ruRU\": \"Песчаная мокрица\",\n";
-                ss << u8"    \"zhCN\": \"沙虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2966,\n";
-                ss << u8"    \"Key\": \"JungleUrchin\",\n";
-                ss << u8"    \"enUS\": \"Bush Barb\",\n";
-                ss << u8"    \"zhTW\": \"灌木倒刺怪\",\n";
-                ss << u8"    \"deDE\": \"Buschdorn\",\n";
-                ss << u8"    \"esES\": \"Púa de maleza\",\n";
-                ss << u8"    \"frFR\": \"Oursin des forêts\",\n";
-                ss << u8"    \"itIT\": \"Barbiglio Acuminato\",\n";
-                ss << u8"    \"koKR\": \"덤불 가시\",\n";
-                ss << u8"    \"plPL\": \"Kolcokrzew\",\n";
-                ss << u8"    \"esMX\": \"Arbusto de púas\",\n";
-                ss << u8"    \"jaJP\": \"ブッシュ・バーブ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Arbusto Farpado\",\n";
-                ss << u8"    \"ruRU\": \"Травяной вредитель\",\n";
-                ss << u8"    \"zhCN\": \"棘丛魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2967,\n";
-                ss << u8"    \"Key\": \"RazorSpine\",\n";
-                ss << u8"    \"enUS\": \"Razor Spine\",\n";
-                ss << u8"    \"zhTW\": \"刃脊獸\",\n";
-                ss << u8"    \"deDE\": \"Klingenrücken\",\n";
-                ss << u8"    \"esES\": \"Espina afilada\",\n";
-                ss << u8"    \"frFR\": \"Démon à épines\",\n";
-                ss << u8"    \"itIT\": \"Lama di Rasoio\",\n";
-                ss << u8"    \"koKR\": \"서슬 가시\",\n";
-                ss << u8"    \"plPL\": \"Kolcobrzytwa\",\n";
-                ss << u8"    \"esMX\": \"Espina de navajas\",\n";
-                ss << u8"    \"jaJP\": \"レイザー・スパイン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Espinha-navalha\",\n";
-                ss << u8"    \"ruRU\": \"Остроспин\",\n";
-                ss << u8"    \"zhCN\": \"剃刀刺魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2968,\n";
-                ss << u8"    \"Key\": \"ThornBeast\",\n";
-                ss << u8"    \"enUS\": \"Thorn Beast\",\n";
-                ss << u8"    \"zhTW\": \"荊棘獸\",\n";
-                ss << u8"    \"deDE\": \"Dornenbestie\",\n";
-                ss << u8"    \"esES\": \"Bestia de espinas\",\n";
-                ss << u8"    \"frFR\": \"Bête à épines\",\n";
-                ss << u8"    \"itIT\": \"Bestia Spinosa\",\n";
-                ss << u8"    \"koKR\": \"가시 야수\",\n";
-                ss << u8"    \"plPL\": \"Cierniowa bestia\",\n";
-                ss << u8"    \"esMX\": \"Bestia espinosa\",\n";
-                ss << u8"    \"jaJP\": \"ソーン・ビースト\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Fera Espinhosa\",\n";
-                ss << u8"    \"ruRU\": \"Шипастая тварь\",\n";
-                ss << u8"    \"zhCN\": \"棘刺兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2969,\n";
-                ss << u8"    \"Key\": \"SpikeFiend\",\n";
-                ss << u8"    \"enUS\": \"Spike Fiend\",\n";
-                ss << u8"    \"zhTW\": \"釘刺魔\",\n";
-                ss << u8"    \"deDE\": \"Dornendämon\",\n";
-                ss << u8"    \"esES\": \"Maligno con pinchos\",\n";
-                ss << u8"    \"frFR\": \"Démon à pointes\",\n";
-                ss << u8"    \"itIT\": \"Demone Spinato\",\n";
-                ss << u8"    \"koKR\": \"쐐기 마귀\",\n";
-                ss << u8"    \"plPL\": \"Kolczasty bies\",\n";
-                ss << u8"    \"esMX\": \"Demonio espinoso\",\n";
-                ss << u8"    \"jaJP\": \"スパイク・フィーンド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Demônio Espinhoso\",\n";
-                ss << u8"    \"ruRU\": \"Шипастый бес\",\n";
-                ss << u8"    \"zhCN\": \"刺脊魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2970,\n";
-                ss << u8"    \"Key\": \"QuillRat\",\n";
-                ss << u8"    \"enUS\": \"Quill Rat\",\n";
-                ss << u8"    \"zhTW\": \"針刺鼠\",\n";
-                ss << u8"    \"deDE\": \"Stachelratte\",\n";
-                ss << u8"    \"esES\": \"Rata con cálamos\",\n";
-                ss << u8"    \"frFR\": \"Rat-épic\",\n";
-                ss << u8"    \"itIT\": \"Rattospino\",\n";
-                ss << u8"    \"koKR\": \"가시 쥐\",\n";
-                ss << u8"    \"plPL\": \"Kolczasty szczur\",\n";
-                ss << u8"    \"esMX\": \"Ratón crampón\",\n";
-                ss << u8"    \"jaJP\": \"クィル・ラット\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Rato-ouriço\",\n";
-                ss << u8"    \"ruRU\": \"Шипастая крыса\",\n";
-                ss << u8"    \"zhCN\": \"刺毛鼠\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2971,\n";
-                ss << u8"    \"Key\": \"HellClan\",\n";
-                ss << u8"    \"enUS\": \"Hell Clan\",\n";
-                ss << u8"    \"zhTW\": \"冥府羊頭人\",\n";
-                ss << u8"    \"deDE\": \"Höllenclan\",\n";
-                ss << u8"    \"esES\": \"Clan infernal\",\n";
-                ss << u8"    \"frFR\": \"Clan des Enfers\",\n";
-                ss << u8"    \"itIT\": \"Clan degli Inferi\",\n";
-                ss << u8"    \"koKR\": \"지옥혈족원\",\n";
-                ss << u8"    \"plPL\": \"Klan Piekieł\",\n";
-                ss << u8"    \"esMX\": \"Clan infernal\",\n";
-                ss << u8"    \"jaJP\": \"地獄の一族\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Clã Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Прислужник Преисподней\",\n";
-                ss << u8"    \"zhCN\": \"地狱氏族\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2972,\n";
-                ss << u8"    \"Key\": \"MoonClan\",\n";
-                ss << u8"    \"enUS\": \"Moon Clan\",\n";
-                ss << u8"    \"zhTW\": \"月族羊頭人\",\n";
-                ss << u8"    \"deDE\": \"Mondclan\",\n";
-                ss << u8"    \"esES\": \"Clan de la luna\",\n";
-                ss << u8"    \"frFR\": \"Clan de la Lune\",\n";
-                ss << u8"    \"itIT\": \"Clan della Luna\",\n";
-                ss << u8"    \"koKR\": \"달혈족원\",\n";
-                ss << u8"    \"plPL\": \"Klan Księżyca\",\n";
-                ss << u8"    \"esMX\": \"Clan lunar\",\n";
-                ss << u8"    \"jaJP\": \"月の一族\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Clã da Lua\",\n";
-                ss << u8"    \"ruRU\": \"Прислужник луны\",\n";
-                ss << u8"    \"zhCN\": \"月亮氏族\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2973,\n";
-                ss << u8"    \"Key\": \"NightClan\",\n";
-                ss << u8"    \"enUS\": \"Night Clan\",\n";
-                ss << u8"    \"zhTW\": \"夜族羊頭人\",\n";
-                ss << u8"    \"deDE\": \"Nachtclan\",\n";
-                ss << u8"    \"esES\": \"Clan de la noche\",\n";
-                ss << u8"    \"frFR\": \"Clan de la Nuit\",\n";
-                ss << u8"    \"itIT\": \"Clan della Notte\",\n";
-                ss << u8"    \"koKR\": \"밤혈족원\",\n";
-                ss << u8"    \"plPL\": \"Klan Nocy\",\n";
-                ss << u8"    \"esMX\": \"Clan nocturno\",\n";
-                ss << u8"    \"jaJP\": \"夜の一族\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Clã da Noite\",\n";
-                ss << u8"    \"ruRU\": \"Прислужник ночи\",\n";
-                ss << u8"    \"zhCN\": \"黑夜氏族\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2974,\n";
-                ss << u8"    \"Key\": \"DeathClan\",\n";
-                ss << u8"    \"enUS\": \"Death Clan\",\n";
-                ss << u8"    \"zhTW\": \"死族羊頭人\",\n";
-                ss << u8"    \"deDE\": \"Todesclan\",\n";
-                ss << u8"    \"esES\": \"Clan de la muerte\",\n";
-                ss << u8"    \"frFR\": \"Clan de la Mort\",\n";
-                ss << u8"    \"itIT\": \"Clan della Morte\",\n";
-                ss << u8"    \"koKR\": \"사멸혈족원\",\n";
-                ss << u8"    \"plPL\": \"Klan Śmierci\",\n";
-                ss << u8"    \"esMX\": \"Clan fúnebre\",\n";
-                ss << u8"    \"jaJP\": \"死の一族\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Clã da Morte\",\n";
-                ss << u8"    \"ruRU\": \"Прислужник смерти\",\n";
-                ss << u8"    \"zhCN\": \"死亡氏族\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2975,\n";
-                ss << u8"    \"Key\": \"BloodClan\",\n";
-                ss << u8"    \"enUS\": \"Blood Clan\",\n";
-                ss << u8"    \"zhTW\": \"血族羊頭人\",\n";
-                ss << u8"    \"deDE\": \"Blutclan\",\n";
-                ss << u8"    \"esES\": \"Clan de los sangrientos\",\n";
-                ss << u8"    \"frFR\": \"Clan du Sang\",\n";
-                ss << u8"    \"itIT\": \"Clan del Sangue\",\n";
-                ss << u8"    \"koKR\": \"핏빛혈족원\",\n";
-                ss << u8"    \"plPL\": \"Klan Krwi\",\n";
-                ss << u8"    \"esMX\": \"Clan sangriento\",\n";
-                ss << u8"    \"jaJP\": \"血の一族\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Clã do Sangue\",\n";
-                ss << u8"    \"ruRU\": \"Прислужник крови\",\n";
-                ss << u8"    \"zhCN\": \"鲜血氏族\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2976,\n";
-                ss << u8"    \"Key\": \"TempleGuard\",\n";
-                ss << u8"    \"enUS\": \"Temple Guard\",\n";
-                ss << u8"    \"zhTW\": \"神殿守衛\",\n";
-                ss << u8"    \"deDE\": \"Tempelwächter\",\n";
-                ss << u8"    \"esES\": \"Guardia del templo\",\n";
-                ss << u8"    \"frFR\": \"Garde du temple\",\n";
-                ss << u8"    \"itIT\": \"Guardia del Tempio\",\n";
-                ss << u8"    \"koKR\": \"사원 파수꾼\",\n";
-                ss << u8"    \"plPL\": \"Strażnik świątyni\",\n";
-                ss << u8"    \"esMX\": \"Guardia del templo\",\n";
-                ss << u8"    \"jaJP\": \"寺院の魔獣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Guarda do Templo\",\n";
-                ss << u8"    \"ruRU\": \"Храмовый страж\",\n";
-                ss << u8"    \"zhCN\": \"神庙守卫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2977,\n";
-                ss << u8"    \"Key\": \"DoomApe\",\n";
-                ss << u8"    \"enUS\": \"Doom Ape\",\n";
-                ss << u8"    \"zhTW\": \"毀滅猿怪\",\n";
-                ss << u8"    \"deDE\": \"Affe der Verdammnis\",\n";
-                ss << u8"    \"esES\": \"Simio de la fatalidad\",\n";
-                ss << u8"    \"frFR\": \"Singe maudit\",\n";
-                ss << u8"    \"itIT\": \"Gorilla della Rovina\",\n";
-                ss << u8"    \"koKR\": \"파멸의 유인원\",\n";
-                ss << u8"    \"plPL\": \"Małpa zagłady\",\n";
-                ss << u8"    \"esMX\": \"Simio de la calamidad\",\n";
-                ss << u8"    \"jaJP\": \"ドゥーム・エイプ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Símio da Perdição\",\n";
-                ss << u8"    \"ruRU\": \"Жуткая обезьяна\",\n";
-                ss << u8"    \"zhCN\": \"厄运猿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2978,\n";
-                ss << u8"    \"Key\": \"JungleHunter\",\n";
-                ss << u8"    \"enUS\": \"Jungle Hunter\",\n";
-                ss << u8"    \"zhTW\": \"叢林獵手\",\n";
-                ss << u8"    \"deDE\": \"Dschungeljäger\",\n";
-                ss << u8"    \"esES\": \"Cazador de la selva\",\n";
-                ss << u8"    \"frFR\": \"Chasseur de la jungle\",\n";
-                ss << u8"    \"itIT\": \"Cacciatore della Giungla\",\n";
-                ss << u8"    \"koKR\": \"밀림 사냥꾼\",\n";
-                ss << u8"    \"plPL\": \"Leśny łowca\",\n";
-                ss << u8"    \"esMX\": \"Cazador de la selva\",\n";
-                ss << u8"    \"jaJP\": \"密林の魔獣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Caçador da Selva\",\n";
-                ss << u8"    \"ruRU\": \"Джунглевый охотник\",\n";
-                ss << u8"    \"zhCN\": \"丛林猎手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2979,\n";
-                ss << u8"    \"Key\": \"RockDweller\",\n";
-                ss << u8"    \"enUS\": \"Rock Dweller\",\n";
-                ss << u8"    \"zhTW\": \"石居猿\",\n";
-                ss << u8"    \"deDE\": \"Felsenbewohner\",\n";
-                ss << u8"    \"esES\": \"Morador de la roca\",\n";
-                ss << u8"    \"frFR\": \"Habitant des roches\",\n";
-                ss << u8"    \"itIT\": \"Creatura delle Rocce\",\n";
-                ss << u8"    \"koKR\": \"바위 괴수\",\n";
-                ss << u8"    \"plPL\": \"Skalnik\",\n";
-                ss << u8"    \"esMX\": \"Morador pétreo\",\n";
-                ss << u8"    \"jaJP\": \"岩地の魔獣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Habitante das Rochas\",\n";
-                ss << u8"    \"ruRU\": \"Обитатель камней\",\n";
-                ss << u8"    \"zhCN\": \"岩居兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2980,\n";
-                ss << u8"    \"Key\": \"DuneBeast\",\n";
-                ss << u8"    \"enUS\": \"Dune Beast\",\n";
-                ss << u8"    \"zhTW\": \"沙丘猿獸\",\n";
-                ss << u8"    \"deDE\": \"Dünenbestie\",\n";
-                ss << u8"    \"esES\": \"Bestia de la duna\",\n";
-                ss << u8"    \"frFR\": \"Bête des dunes\",\n";
-                ss << u8"    \"itIT\": \"Bestia delle Dune\",\n";
-                ss << u8"    \"koKR\": \"모래사막 야수\",\n";
-                ss << u8"    \"plPL\": \"Bestia z wydm\",\n";
-                ss << u8"    \"esMX\": \"Bestia de las dunas\",\n";
-                ss << u8"    \"jaJP\": \"砂丘の魔獣\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Fera das Dunas\",\n";
-                ss << u8"    \"ruRU\": \"Дюнный зверь\",\n";
-                ss << u8"    \"zhCN\": \"沙丘兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2981,\n";
-                ss << u8"    \"Key\": \"FleshHunter\",\n";
-                ss << u8"    \"enUS\": \"Flesh Hunter\",\n";
-                ss << u8"    \"zhTW\": \"血肉獵人\",\n";
-                ss << u8"    \"deDE\": \"Fleischjägerin\",\n";
-                ss << u8"    \"esES\": \"Cazadora de la carne\",\n";
-                ss << u8"    \"frFR\": \"Chasseur de chair\",\n";
-                ss << u8"    \"itIT\": \"Cacciatrice di Carne\",\n";
-                ss << u8"    \"koKR\": \"살점 사냥꾼\",\n";
-                ss << u8"    \"plPL\": \"Łowczyni ciał\",\n";
-                ss << u8"    \"esMX\": \"Cazadora carnal\",\n";
-                ss << u8"    \"jaJP\": \"血肉の狩人\",\n";
-                ss << u8"    \"ptBR\": \"Caçadora Cárnea\",\n";
-                ss << u8"    \"ruRU\": \"Охотница за плотью\",\n";
-                ss << u8"    \"zhCN\": \"血肉猎手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2982,\n";
-                ss << u8"    \"Key\": \"BlackRogue\",\n";
-                ss << u8"    \"enUS\": \"Black Rogue\",\n";
-                ss << u8"    \"zhTW\": \"黑色俠盜\",\n";
-                ss << u8"    \"deDE\": \"Schwarze Jägerin\",\n";
-                ss << u8"    \"esES\": \"Arpía negra\",\n";
-                ss << u8"    \"frFR\": \"Rogue noire\",\n";
-                ss << u8"    \"itIT\": \"Scolta Nera\",\n";
-                ss << u8"    \"koKR\": \"검은 도적\",\n";
-                ss << u8"    \"plPL\": \"Czarna Łotrzyca\",\n";
-                ss << u8"    \"esMX\": \"Renegada sombría\",\n";
-                ss << u8"    \"jaJP\": \"暗黒のローグ\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Renegada Tenebrosa\",\n";
-                ss << u8"    \"ruRU\": \"Черная разбойница\",\n";
-                ss << u8"    \"zhCN\": \"黑化流亡者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2984,\n";
-                ss << u8"    \"Key\": \"VileHunter\",\n";
-                ss << u8"    \"enUS\": \"Vile Hunter\",\n";
-                ss << u8"    \"zhTW\": \"兇邪獵手\",\n";
-                ss << u8"    \"deDE\": \"Böse Jägerin\",\n";
-                ss << u8"    \"esES\": \"Cazadora vil\",\n";
-                ss << u8"    \"frFR\": \"Chasseuse infâme\",\n";
-                ss << u8"    \"itIT\": \"Cacciatrice Vile\",\n";
-                ss << u8"    \"koKR\": \"끔찍한 사냥꾼\",\n";
-                ss << u8"    \"plPL\": \"Ohydna łowczyni\",\n";
-                ss << u8"    \"esMX\": \"Cazadora vil\",\n";
-                ss << u8"    \"jaJP\": \"穢れし狩人\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Caçadora Vil\",\n";
-                ss << u8"    \"ruRU\": \"Злобная охотница\",\n";
-                ss << u8"    \"zhCN\": \"邪恶猎手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2985,\n";
-                ss << u8"    \"Key\": \"DarkHunter\",\n";
-                ss << u8"    \"enUS\": \"Dark Hunter\",\n";
-                ss << u8"    \"zhTW\": \"黑暗獵人\",\n";
-                ss << u8"    \"deDE\": \"Dunkle Jägerin\",\n";
-                ss << u8"    \"esES\": \"Cazadora de la oscuridad\",\n";
-                ss << u8"    \"frFR\": \"Chasseuse sombre\",\n";
-                ss << u8"    \"itIT\": \"Cacciatrice Oscura\",\n";
-                ss << u8"    \"koKR\": \"어둠의 사냥꾼\",\n";
-                ss << u8"    \"plPL\": \"Mroczna myśliwa\",\n";
-                ss << u8"    \"esMX\": \"Cazadora oscura\",\n";
-                ss << u8"    \"jaJP\": \"闇の狩人\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Caçadora Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Темная охотница\",\n";
-                ss << u8"    \"zhCN\": \"黑暗猎手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2986,\n";
-                ss << u8"    \"Key\": \"DarkShape\",\n";
-                ss << u8"    \"enUS\": \"Dark Shape\",\n";
-                ss << u8"    \"zhTW\": \"幽影\",\n";
-                ss << u8"    \"deDE\": \"Dunkle Gestalt\",\n";
-                ss << u8"    \"esES\": \"Forma oscura\",\n";
-                ss << u8"    \"frFR\": \"Forme sombre\",\n";
-                ss << u8"    \"itIT\": \"Forma Nera\",\n";
-                ss << u8"    \"koKR\": \"어둠의 형상\",\n";
-                ss << u8"    \"plPL\": \"Mroczny kształt\",\n";
-                ss << u8"    \"esMX\": \"Forma sombría\",\n";
-                ss << u8"    \"jaJP\": \"ダーク・シェイプ\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Forma Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Темная фигура\",\n";
-                ss << u8"    \"zhCN\": \"黑暗阴魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2987,\n";
-                ss << u8"    \"Key\": \"Apparition\",\n";
-                ss << u8"    \"enUS\": \"Apparition\",\n";
-                ss << u8"    \"zhTW\": \"幽影\",\n";
-                ss << u8"    \"deDE\": \"Erscheinung\",\n";
-                ss << u8"    \"esES\": \"Aparición\",\n";
-                ss << u8"    \"frFR\": \"Apparition\",\n";
-                ss << u8"    \"itIT\": \"Apparizione\",\n";
-                ss << u8"    \"koKR\": \"환영\",\n";
-                ss << u8"    \"plPL\": \"Wcielenie\",\n";
-                ss << u8"    \"esMX\": \"Aparición\",\n";
-                ss << u8"    \"jaJP\": \"アペリション\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Aparição\",\n";
-                ss << u8"    \"ruRU\": \"Привидение\",\n";
-                ss << u8"    \"zhCN\": \"恶魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2988,\n";
-                ss << u8"    \"Key\": \"Specter\",\n";
-                ss << u8"    \"enUS\": \"Specter\",\n";
-                ss << u8"    \"zhTW\": \"亡靈\",\n";
-                ss << u8"    \"deDE\": \"Gespenst\",\n";
-                ss << u8"    \"esES\": \"Espectro\",\n";
-                ss << u8"    \"frFR\": \"Spectre\",\n";
-                ss << u8"    \"itIT\": \"Spettro\",\n";
-                ss << u8"    \"koKR\": \"허깨비\",\n";
-                ss << u8"    \"plPL\": \"Upiór\",\n";
-                ss << u8"    \"esMX\": \"Espectro\",\n";
-                ss << u8"    \"jaJP\": \"スペクター\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Assombração\",\n";
-                ss << u8"    \"ruRU\": \"Фантом\",\n";
-                ss << u8"    \"zhCN\": \"妖魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2990,\n";
-                ss << u8"    \"Key\": \"Ghost\",\n";
-                ss << u8"    \"enUS\": \"Ghost\",\n";
-                ss << u8"    \"zhTW\": \"鬼魂\",\n";
-                ss << u8"    \"deDE\": \"Geist\",\n";
-                ss << u8"    \"esES\": \"Fantasma\",\n";
-                ss << u8"    \"frFR\": \"Fantôme\",\n";
-                ss << u8"    \"itIT\": \"Fantasma\",\n";
-                ss << u8"    \"koKR\": \"유령\",\n";
-                ss << u8"    \"plPL\": \"Duch\",\n";
-                ss << u8"    \"esMX\": \"Fantasma\",\n";
-                ss << u8"    \"jaJP\": \"ゴースト\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Fantasma\",\n";
-                ss << u8"    \"ruRU\": \"Призрак\",\n";
-                ss << u8"    \"zhCN\": \"幽灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2991,\n";
-                ss << u8"    \"Key\": \"Assailant\",\n";
-                ss << u8"    \"enUS\": \"Assailant\",\n";
-                ss << u8"    \"zhTW\": \"襲擊者\",\n";
-                ss << u8"    \"deDE\": \"Angreifer\",\n";
-                ss << u8"    \"esES\": \"Agresor\",\n";
-                ss << u8"    \"frFR\": \"Assaillant\",\n";
-                ss << u8"    \"itIT\": \"Assalitore\",\n";
-                ss << u8"    \"koKR\": \"기습자\",\n";
-                ss << u8"    \"plPL\": \"Ciemiężca\",\n";
-                ss << u8"    \"esMX\": \"Asaltante\",\n";
-                ss << u8"    \"jaJP\": \"アサイラント\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Agressor\",\n";
-                ss << u8"    \"ruRU\": \"Налетчик\",\n";
-                ss << u8"    \"zhCN\": \"行凶者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2992,\n";
-                ss << u8"    \"Key\": \"Infidel\",\n";
-                ss << u8"    \"enUS\": \"Infidel\",\n";
-                ss << u8"    \"zhTW\": \"異信者\",\n";
-                ss << u8"    \"deDE\": \"Ungläubiger\",\n";
-                ss << u8"    \"esES\": \"Infiel\",\n";
-                ss << u8"    \"frFR\": \"Infidèle\",\n";
-                ss << u8"    \"itIT\": \"Infedele\",\n";
-                ss << u8"    \"koKR\": \"불신자\",\n";
-                ss << u8"    \"plPL\": \"Heretyk\",\n";
-                ss << u8"    \"esMX\": \"Infiel\",\n";
-                ss << u8"    \"jaJP\": \"インフィデル\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Infiel\",\n";
-                ss << u8"    \"ruRU\": \"Неверный\",\n";
-                ss << u8"    \"zhCN\": \"信邪者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2993,\n";
-                ss << u8"    \"Key\": \"Invader\",\n";
-                ss << u8"    \"enUS\": \"Invader\",\n";
-                ss << u8"    \"zhTW\": \"入侵者\",\n";
-                ss << u8"    \"deDE\": \"Eindringling\",\n";
-                ss << u8"    \"esES\": \"Invasor\",\n";
-                ss << u8"    \"frFR\": \"Envahisseur\",\n";
-                ss << u8"    \"itIT\": \"Invasore\",\n";
-                ss << u8"    \"koKR\": \"침략자\",\n";
-                ss << u8"    \"plPL\": \"Najeźdźca\",\n";
-                ss << u8"    \"esMX\": \"Invasor\",\n";
-                ss << u8"    \"jaJP\": \"インベイダー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Invasor\",\n";
-                ss << u8"    \"ruRU\": \"Захватчик\",\n";
-                ss << u8"    \"zhCN\": \"入侵者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2994,\n";
-                ss << u8"    \"Key\": \"Marauder\",\n";
-                ss << u8"    \"enUS\": \"Marauder\",\n";
-                ss << u8"    \"zhTW\": \"掠奪者\",\n";
-                ss << u8"    \"deDE\": \"Plünderer\",\n";
-                ss << u8"    \"esES\": \"Maleante\",\n";
-                ss << u8"    \"frFR\": \"Maraudeur\",\n";
-                ss << u8"    \"itIT\": \"Predone\",\n";
-                ss << u8"    \"koKR\": \"습격자\",\n";
-                ss << u8"    \"plPL\": \"Maruder\",\n";
-                ss << u8"    \"esMX\": \"Merodeador\",\n";
-                ss << u8"    \"jaJP\": \"マローダー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Saqueador\",\n";
-                ss << u8"    \"ruRU\": \"Мародер\",\n";
-                ss << u8"    \"zhCN\": \"掠夺者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2995,\n";
-                ss << u8"    \"Key\": \"SandRaider\",\n";
-                ss << u8"    \"enUS\": \"Sand Raider\",\n";
-                ss << u8"    \"zhTW\": \"沙漠劫掠者\",\n";
-                ss << u8"    \"deDE\": \"Sandräuber\",\n";
-                ss << u8"    \"esES\": \"Asaltante de arena\",\n";
-                ss << u8"    \"frFR\": \"Pilleur des sables\",\n";
-                ss << u8"    \"itIT\": \"Bandito delle Sabbie\",\n";
-                ss << u8"    \"koKR\": \"모래 침략자\",\n";
-                ss << u8"    \"plPL\": \"Piaskowy najeźdźca\",\n";
-                ss << u8"    \"esMX\": \"Invasor arenoso\",\n";
-                ss << u8"    \"jaJP\": \"サンド・レイダー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Invasor Arenoso\",\n";
-                ss << u8"    \"ruRU\": \"Пустынный налетчик\",\n";
-                ss << u8"    \"zhCN\": \"沙漠袭击者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2996,\n";
-                ss << u8"    \"Key\": \"GargantuanBeast\",\n";
-                ss << u8"    \"enUS\": \"Gargantuan Beast\",\n";
-                ss << u8"    \"zhTW\": \"巨獸毛怪\",\n";
-                ss << u8"    \"deDE\": \"Gargantua\",\n";
-                ss << u8"    \"esES\": \"Bestia gigante\",\n";
-                ss << u8"    \"frFR\": \"Monstre gargantuesque\",\n";
-                ss << u8"    \"itIT\": \"Gargantua\",\n";
-                ss << u8"    \"koKR\": \"거대 야수\",\n";
-                ss << u8"    \"plPL\": \"Monstrualna bestia\",\n";
-                ss << u8"    \"esMX\": \"Bestia jayán\",\n";
-                ss << u8"    \"jaJP\": \"ガルガンチュア・ビースト\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Fera Gargântua\",\n";
-                ss << u8"    \"ruRU\": \"Исполинский зверь\",\n";
-                ss << u8"    \"zhCN\": \"巨身兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2997,\n";
-                ss << u8"    \"Key\": \"WailingBeast\",\n";
-                ss << u8"    \"enUS\": \"Wailing Beast\",\n";
-                ss << u8"    \"zhTW\": \"尖嘯毛怪\",\n";
-                ss << u8"    \"deDE\": \"Heulbestie\",\n";
-                ss << u8"    \"esES\": \"Bestia ululante\",\n";
-                ss << u8"    \"frFR\": \"Bête gémissante\",\n";
-                ss << u8"    \"itIT\": \"Lamentatore\",\n";
-                ss << u8"    \"koKR\": \"울부짖는 야수\",\n";
-                ss << u8"    \"plPL\": \"Skowycząca bestia\",\n";
-                ss << u8"    \"esMX\": \"Bestia sollozante\",\n";
-                ss << u8"    \"jaJP\": \"ウェイリング・ビースト\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Fera Uivante\",\n";
-                ss << u8"    \"ruRU\": \"Воющий зверь\",\n";
-                ss << u8"    \"zhCN\": \"恸哭兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2998,\n";
-                ss << u8"    \"Key\": \"Yeti\",\n";
-                ss << u8"    \"enUS\": \"Yeti\",\n";
-                ss << u8"    \"zhTW\": \"雪怪\",\n";
-                ss << u8"    \"deDE\": \"Yeti\",\n";
-                ss << u8"    \"esES\": \"Yeti\",\n";
-                ss << u8"    \"frFR\": \"Yéti\",\n";
-                ss << u8"    \"itIT\": \"Yeti\",\n";
-                ss << u8"    \"koKR\": \"설인\",\n";
-                ss << u8"    \"plPL\": \"Yeti\",\n";
-                ss << u8"    \"esMX\": \"Yeti\",\n";
-                ss << u8"    \"jaJP\": \"イエティ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Yeti\",\n";
-                ss << u8"    \"ruRU\": \"Йети\",\n";
-                ss << u8"    \"zhCN\": \"雪人怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 2999,\n";
-                ss << u8"    \"Key\": \"Crusher\",\n";
-                ss << u8"    \"enUS\": \"Crusher\",\n";
-                ss << u8"    \"zhTW\": \"碎拳毛怪\",\n";
-                ss << u8"    \"deDE\": \"Zermalmer\",\n";
-                ss << u8"    \"esES\": \"Machacadora\",\n";
-                ss << u8"    \"frFR\": \"Broyeur\",\n";
-                ss << u8"    \"itIT\": \"Demolitore\",\n";
-                ss << u8"    \"koKR\": \"분쇄자\",\n";
-                ss << u8"    \"plPL\": \"Miażdżyciel\",\n";
-                ss << u8"    \"esMX\": \"Triturador\",\n";
-                ss << u8"    \"jaJP\": \"クラッシャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Esmagador\",\n";
-                ss << u8"    \"ruRU\": \"Крушитель\",\n";
-                ss << u8"    \"zhCN\": \"暴砸兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3000,\n";
-                ss << u8"    \"Key\": \"Brute\",\n";
-                ss << u8"    \"enUS\": \"Brute\",\n";
-                ss << u8"    \"zhTW\": \"兇蠻毛怪\",\n";
-                ss << u8"    \"deDE\": \"Untier\",\n";
-                ss << u8"    \"esES\": \"Bruto\",\n";
-                ss << u8"    \"frFR\": \"Brute\",\n";
-                ss << u8"    \"itIT\": \"Bruto\",\n";
-                ss << u8"    \"koKR\": \"거수\",\n";
-                ss << u8"    \"plPL\": \"Monstrum\",\n";
-                ss << u8"    \"esMX\": \"Bruto\",\n";
-                ss << u8"    \"jaJP\": \"ブルート\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Bruto\",\n";
-                ss << u8"    \"ruRU\": \"Изверг\",\n";
-                ss << u8"    \"zhCN\": \"蛮力兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3001,\n";
-                ss << u8"    \"Key\": \"CloudStalker\",\n";
-                ss << u8"    \"enUS\": \"Cloud Stalker\",\n";
-                ss << u8"    \"zhTW\": \"雲襲血鷹\",\n";
-                ss << u8"    \"deDE\": \"Wolkenschleicher\",\n";
-                ss << u8"    \"esES\": \"Acechador de las nubes\",\n";
-                ss << u8"    \"frFR\": \"Vagabond des nuages\",\n";
-                ss << u8"    \"itIT\": \"Predatore delle Nuvole\",\n";
-                ss << u8"    \"koKR\": \"구름 추적자\",\n";
-                ss << u8"    \"plPL\": \"Chmuroskrzydły\",\n";
-                ss << u8"    \"esMX\": \"Acechador nebuloso\",\n";
-                ss << u8"    \"jaJP\": \"クラウド・ストーカー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Perseguidor Nebuloso\",\n";
-                ss << u8"    \"ruRU\": \"Облачный охотник\",\n";
-                ss << u8"    \"zhCN\": \"烟雾偷袭者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3002,\n";
-                ss << u8"    \"Key\": \"BlackVulture\",\n";
-                ss << u8"    \"enUS\": \"Black Vulture\",\n";
-                ss << u8"    \"zhTW\": \"黑色禿鷹\",\n";
-                ss << u8"    \"deDE\": \"Schwarzer Geier\",\n";
-                ss << u8"    \"esES\": \"Buitre negro\",\n";
-                ss << u8"    \"frFR\": \"Vautour noir\",\n";
-                ss << u8"    \"itIT\": \"Avvoltoio Nero\",\n";
-                ss << u8"    \"koKR\": \"검은 독수리\",\n";
-                ss << u8"    \"plPL\": \"Czarny sęp\",\n";
-                ss << u8"    \"esMX\": \"Buitre sombrío\",\n";
-                ss << u8"    \"jaJP\": \"ブラック・ヴァルチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Abutre Tenebroso\",\n";
-                ss << u8"    \"ruRU\": \"Черный стервятник\",\n";
-                ss << u8"    \"zhCN\": \"黑羽秃鹫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3003,\n";
-                ss << u8"    \"Key\": \"BlackRaptor\",\n";
-                ss << u8"    \"enUS\": \"Black Raptor\",\n";
-                ss << u8"    \"zhTW\": \"黑色猛禽\",\n";
-                ss << u8"    \"deDE\": \"Schwarzer Greifer\",\n";
-                ss << u8"    \"esES\": \"Ave de presa negra\",\n";
-                ss << u8"    \"frFR\": \"Rapace noir\",\n";
-                ss << u8"    \"itIT\": \"Rapace Nero\",\n";
-                ss << u8"    \"koKR\": \"검은 맹금\",\n";
-                ss << u8"    \"plPL\": \"Czarny krogulec\",\n";
-                ss << u8"    \"esMX\": \"Rapaz sombría\",\n";
-                ss << u8"    \"jaJP\": \"ブラック・ラプター\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Raptor Tenebroso\",\n";
-                ss << u8"    \"ruRU\": \"Черный ящер\",\n";
-                ss << u8"    \"zhCN\": \"黑羽猛禽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3004,\n";
-                ss << u8"    \"Key\": \"BloodHawk\",\n";
-                ss << u8"    \"enUS\": \"Blood Hawk\",\n";
-                ss << u8"    \"zhTW\": \"血鷹\",\n";
-                ss << u8"    \"deDE\": \"Blutfalke\",\n";
-                ss << u8"    \"esES\": \"Gerifalte sangriento\",\n";
-                ss << u8"    \"frFR\": \"Faucon de sang\",\n";
-                ss << u8"    \"itIT\": \"Falco Vermiglio\",\n";
-                ss << u8"    \"koKR\": \"핏빛매\",\n";
-                ss << u8"    \"plPL\": \"Krwawy jastrząb\",\n";
-                ss << u8"    \"esMX\": \"Halcón sanguinario\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・ホーク\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Falcão Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Кровавый ястреб\",\n";
-                ss << u8"    \"zhCN\": \"血鹰\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3005,\n";
-                ss << u8"    \"Key\": \"FoulCrow\",\n";
-                ss << u8"    \"enUS\": \"Foul Crow\",\n";
-                ss << u8"    \"zhTW\": \"惡毒穢鴉\",\n";
-                ss << u8"    \"deDE\": \"Faulkrähe\",\n";
-                ss << u8"    \"esES\": \"Cuervo fétido\",\n";
-                ss << u8"    \"frFR\": \"Corbeau fétide\",\n";
-                ss << u8"    \"itIT\": \"Corvo Fetido\",\n";
-                ss << u8"    \"koKR\": \"불결한 까마귀\",\n";
-                ss << u8"    \"plPL\": \"Plugawy kruk\",\n";
-                ss << u8"    \"esMX\": \"Cuervo repugnante\",\n";
-                ss << u8"    \"jaJP\": \"ファウル・クロウ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Corvo Sórdido\",\n";
-                ss << u8"    \"ruRU\": \"Нечистая птица\",\n";
-                ss << u8"    \"zhCN\": \"恶臭乌鸦\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3006,\n";
-                ss << u8"    \"Key\": \"PlagueBearer\",\n";
-                ss << u8"    \"enUS\": \"Plague Bearer\",\n";
-                ss << u8"    \"zhTW\": \"瘟疫散布者\",\n";
-                ss << u8"    \"deDE\": \"Pestbringer\",\n";
-                ss << u8"    \"esES\": \"Apestado\",\n";
-                ss << u8"    \"frFR\": \"Pestiféré\",\n";
-                ss << u8"    \"itIT\": \"Contaminatore\",\n";
-                ss << u8"    \"koKR\": \"역병 유발자\",\n";
-                ss << u8"    \"plPL\": \"Siewca zarazy\",\n";
-                ss << u8"    \"esMX\": \"Llevador de plaga\",\n";
-                ss << u8"    \"jaJP\": \"プレイグ・ベアラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Empesteador\",\n";
-                ss << u8"    \"ruRU\": \"Разносчик чумы\",\n";
-                ss << u8"    \"zhCN\": \"疫尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3007,\n";
-                ss << u8"    \"Key\": \"Ghoul\",\n";
-                ss << u8"    \"enUS\": \"Ghoul\",\n";
-                ss << u8"    \"zhTW\": \"食屍鬼\",\n";
-                ss << u8"    \"deDE\": \"Ghul\",\n";
-                ss << u8"    \"esES\": \"Necrófago\",\n";
-                ss << u8"    \"frFR\": \"Goule\",\n";
-                ss << u8"    \"itIT\": \"Ghoul\",\n";
-                ss << u8"    \"koKR\": \"구울\",\n";
-                ss << u8"    \"plPL\": \"Ghul\",\n";
-                ss << u8"    \"esMX\": \"Necrófago\",\n";
-                ss << u8"    \"jaJP\": \"グール\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Carniçal\",\n";
-                ss << u8"    \"ruRU\": \"Вурдалак\",\n";
-                ss << u8"    \"zhCN\": \"食尸鬼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3008,\n";
-                ss << u8"    \"Key\": \"DrownedCarcass\",\n";
-                ss << u8"    \"enUS\": \"Drowned Carcass\",\n";
-                ss << u8"    \"zhTW\": \"溺斃死屍\",\n";
-                ss << u8"    \"deDE\": \"Ertrunkener Kadaver\",\n";
-                ss << u8"    \"esES\": \"Occiso ahogado\",\n";
-                ss << u8"    \"frFR\": \"Cadavre noyé\",\n";
-                ss << u8"    \"itIT\": \"Carcassa di Affogato\",\n";
-                ss << u8"    \"koKR\": \"물에 빠진 송장\",\n";
-                ss << u8"    \"plPL\": \"Topielec\",\n";
-                ss << u8"    \"esMX\": \"Cadáver ahogado\",\n";
-                ss << u8"    \"jaJP\": \"ドラウンド・カーカス\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Carcaça Encharcada\",\n";
-                ss << u8"    \"ruRU\": \"Утопленный труп\",\n";
-                ss << u8"    \"zhCN\": \"溺尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3009,\n";
-                ss << u8"    \"Key\": \"HungryDead\",\n";
-                ss << u8"    \"enUS\": \"Hungry Dead\",\n";
-                ss << u8"    \"zhTW\": \"飢餓死者\",\n";
-                ss << u8"    \"deDE\": \"Hungriger Toter\",\n";
-                ss << u8"    \"esES\": \"Muerto hambriento\",\n";
-                ss << u8"    \"frFR\": \"Mort affamé\",\n";
-                ss << u8"    \"itIT\": \"Cadavere Affamato\",\n";
-                ss << u8"    \"koKR\": \"굶주린 망자\",\n";
-                ss << u8"    \"plPL\": \"Głodny trup\",\n";
-                ss << u8"    \"esMX\": \"Muerto hambriento\",\n";
-                ss << u8"    \"jaJP\": \"ハングリー・デッド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Morto Faminto\",\n";
-                ss << u8"    \"ruRU\": \"Голодный мертвец\",\n";
-                ss << u8"    \"zhCN\": \"饥饿行尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3010,\n";
-                ss << u8"    \"Key\": \"Zombie\",\n";
-                ss << u8"    \"enUS\": \"Zombie\",\n";
-                ss << u8"    \"zhTW\": \"殭屍\",\n";
-                ss << u8"    \"deDE\": \"Zombie\",\n";
-                ss << u8"    \"esES\": \"Zombi\",\n";
-                ss << u8"    \"frFR\": \"Zombie\",\n";
-                ss << u8"    \"itIT\": \"Zombi\",\n";
-                ss << u8"    \"koKR\": \"좀비\",\n";
-                ss << u8"    \"plPL\": \"Zombie\",\n";
-                ss << u8"    \"esMX\": \"Zombi\",\n";
-                ss << u8"    \"jaJP\": \"ゾンビ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Zumbi\",\n";
-                ss << u8"    \"ruRU\": \"Зомби\",\n";
-                ss << u8"    \"zhCN\": \"僵尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3011,\n";
-                ss << u8"    \"Key\": \"Skeleton\",\n";
-                ss << u8"    \"enUS\": \"Skeleton\",\n";
-                ss << u8"    \"zhTW\": \"骷髏\",\n";
-                ss << u8"    \"deDE\": \"Skelettkrieger\",\n";
-                ss << u8"    \"esES\": \"Esqueleto\",\n";
-                ss << u8"    \"frFR\": \"Squelette\",\n";
-                ss << u8"    \"itIT\": \"Scheletro\",\n";
-                ss << u8"    \"koKR\": \"해골\",\n";
-                ss << u8"    \"plPL\": \"Szkielet\",\n";
-                ss << u8"    \"esMX\": \"Esqueleto\",\n";
-                ss << u8"    \"jaJP\": \"骸骨\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Esqueleto\",\n";
-                ss << u8"    \"ruRU\": \"Скелет\",\n";
-                ss << u8"    \"zhCN\": \"骷髅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3012,\n";
-                ss << u8"    \"Key\": \"Horror\",\n";
-                ss << u8"    \"enUS\": \"Horror\",\n";
-                ss << u8"    \"zhTW\": \"恐骨骷髏\",\n";
-                ss << u8"    \"deDE\": \"Horror\",\n";
-                ss << u8"    \"esES\": \"Horror\",\n";
-                ss << u8"    \"frFR\": \"Horreur\",\n";
-                ss << u8"    \"itIT\": \"Orrore\",\n";
-                ss << u8"    \"koKR\": \"피바람\",\n";
-                ss << u8"    \"plPL\": \"Kościej\",\n";
-                ss << u8"    \"esMX\": \"Tenebroso\",\n";
-                ss << u8"    \"jaJP\": \"ホラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Horror\",\n";
-                ss << u8"    \"ruRU\": \"Ужас\",\n";
-                ss << u8"    \"zhCN\": \"恐怖骸骨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3013,\n";
-                ss << u8"    \"Key\": \"Returned\",\n";
-                ss << u8"    \"enUS\": \"Returned\",\n";
-                ss << u8"    \"zhTW\": \"返世亡靈\",\n";
-                ss << u8"    \"deDE\": \"Zurückgekehrter\",\n";
-                ss << u8"    \"esES\": \"Retornado\",\n";
-                ss << u8"    \"frFR\": \"Ranimé\",\n";
-                ss << u8"    \"itIT\": \"Ritornato\",\n";
-                ss << u8"    \"koKR\": \"되돌아온 자\",\n";
-                ss << u8"    \"plPL\": \"Przywrócony\",\n";
-                ss << u8"    \"esMX\": \"Retornado\",\n";
-                ss << u8"    \"jaJP\": \"リターンド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Retornado\",\n";
-                ss << u8"    \"ruRU\": \"Воскресший\",\n";
-                ss << u8"    \"zhCN\": \"回魂骷髅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3014,\n";
-                ss << u8"    \"Key\": \"BurningDead\",\n";
-                ss << u8"    \"enUS\": \"Burning Dead\",\n";
-                ss << u8"    \"zhTW\": \"烈焰骷髏\",\n";
-                ss << u8"    \"deDE\": \"Brennender Toter\",\n";
-                ss << u8"    \"esES\": \"Muerto ardiente\",\n";
-                ss << u8"    \"frFR\": \"Brûlé vif\",\n";
-                ss << u8"    \"itIT\": \"Scheletro Fiammeggiante\",\n";
-                ss << u8"    \"koKR\": \"불타는 망자\",\n";
-                ss << u8"    \"plPL\": \"Płonący trup\",\n";
-                ss << u8"    \"esMX\": \"Muerto ardiente\",\n";
-                ss << u8"    \"jaJP\": \"バーニングデッド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Morto Flamejante\",\n";
-                ss << u8"    \"ruRU\": \"Горящий мертвец\",\n";
-                ss << u8"    \"zhCN\": \"烈焰亡骨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3015,\n";
-                ss << u8"    \"Key\": \"BoneWarrior\",\n";
-                ss << u8"    \"enUS\": \"Bone Warrior\",\n";
-                ss << u8"    \"zhTW\": \"骸骨戰士\",\n";
-                ss << u8"    \"deDE\": \"Knochenkrieger\",\n";
-                ss << u8"    \"esES\": \"Guerrero óseo\",\n";
-                ss << u8"    \"frFR\": \"Guerrier d’os\",\n";
-                ss << u8"    \"itIT\": \"Guerriero d'Ossa\",\n";
-                ss << u8"    \"koKR\": \"뼈 전사\",\n";
-                ss << u8"    \"plPL\": \"Kościany wojownik\",\n";
-                ss << u8"    \"esMX\": \"Guerrero óseo\",\n";
-                ss << u8"    \"jaJP\": \"ボーン・ウォリアー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Guerreiro Esquelético\",\n";
-                ss << u8"    \"ruRU\": \"Костяной воин\",\n";
-                ss << u8"    \"zhCN\": \"白骨战士\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3016,\n";
-                ss << u8"    \"Key\": \"Damned\",\n";
-                ss << u8"    \"enUS\": \"Damned\",\n";
-                ss << u8"    \"zhTW\": \"詛咒魔汙怪\",\n";
-                ss << u8"    \"deDE\": \"Verdammter\",\n";
-                ss << u8"    \"esES\": \"Condenado\",\n";
-                ss << u8"    \"frFR\": \"Damné\",\n";
-                ss << u8"    \"itIT\": \"Dannato\",\n";
-                ss << u8"    \"koKR\": \"저주받은 자\",\n";
-                ss << u8"    \"plPL\": \"Potępiony\",\n";
-                ss << u8"    \"esMX\": \"Maldito\",\n";
-                ss << u8"    \"jaJP\": \"ダムド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Maldito\",\n";
-                ss << u8"    \"ruRU\": \"Проклятый\",\n";
-                ss << u8"    \"zhCN\": \"天谴魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3017,\n";
-                ss << u8"    \"Key\": \"Disfigured\",\n";
-                ss << u8"    \"enUS\": \"Disfigured\",\n";
-                ss << u8"    \"zhTW\": \"醜惡魔汙怪\",\n";
-                ss << u8"    \"deDE\": \"Entstellter\",\n";
-                ss << u8"    \"esES\": \"Desfigurado\",\n";
-                ss << u8"    \"frFR\": \"Défiguré\",\n";
-                ss << u8"    \"itIT\": \"Sfigurato\",\n";
-                ss << u8"    \"koKR\": \"일그러진 자\",\n";
-                ss << u8"    \"plPL\": \"Szpetny\",\n";
-                ss << u8"    \"esMX\": \"Desfigurado\",\n";
-                ss << u8"    \"jaJP\": \"ディス・フィギュアード\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Desfigurado\",\n";
-                ss << u8"    \"ruRU\": \"Изувеченный\",\n";
-                ss << u8"    \"zhCN\": \"残身魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3018,\n";
-                ss << u8"    \"Key\": \"Misshapen\",\n";
-                ss << u8"    \"enUS\": \"Misshapen\",\n";
-                ss << u8"    \"zhTW\": \"畸形魔汙怪\",\n";
-                ss << u8"    \"deDE\": \"Missgestalteter\",\n";
-                ss << u8"    \"esES\": \"Deforme\",\n";
-                ss << u8"    \"frFR\": \"Déformé\",\n";
-                ss << u8"    \"itIT\": \"Immondo\",\n";
-                ss << u8"    \"koKR\": \"흉측한 자\",\n";
-                ss << u8"    \"plPL\": \"Zniekształcony\",\n";
-                ss << u8"    \"esMX\": \"Deforme\",\n";
-                ss << u8"    \"jaJP\": \"ミスシェイプン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Disforme\",\n";
-                ss << u8"    \"ruRU\": \"Уродливый\",\n";
-                ss << u8"    \"zhCN\": \"畸形魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3019,\n";
-                ss << u8"    \"Key\": \"Tainted\",\n";
-                ss << u8"    \"enUS\": \"Tainted\",\n";
-                ss << u8"    \"zhTW\": \"魔汙怪\",\n";
-                ss << u8"    \"deDE\": \"Besudelter\",\n";
-                ss << u8"    \"esES\": \"Mancillado\",\n";
-                ss << u8"    \"frFR\": \"Corrompu\",\n";
-                ss << u8"    \"itIT\": \"Contaminato\",\n";
-                ss << u8"    \"koKR\": \"오염된 자\",\n";
-                ss << u8"    \"plPL\": \"Splamiony\",\n";
-                ss << u8"    \"esMX\": \"Impío\",\n";
-                ss << u8"    \"jaJP\": \"テインテッド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Maculado\",\n";
-                ss << u8"    \"ruRU\": \"Помутненный\",\n";
-                ss << u8"    \"zhCN\": \"污染魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3020,\n";
-                ss << u8"    \"Key\": \"Afflicted\",\n";
-                ss << u8"    \"enUS\": \"Afflicted\",\n";
-                ss << u8"    \"zhTW\": \"災劫魔汙怪\",\n";
-                ss << u8"    \"deDE\": \"Infizierter\",\n";
-                ss << u8"    \"esES\": \"Afligido\",\n";
-                ss << u8"    \"frFR\": \"Malade\",\n";
-                ss << u8"    \"itIT\": \"Afflitto\",\n";
-                ss << u8"    \"koKR\": \"고통받는 자\",\n";
-                ss << u8"    \"plPL\": \"Naznaczony\",\n";
-                ss << u8"    \"esMX\": \"Afligido\",\n";
-                ss << u8"    \"jaJP\": \"アフリクテッド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Torpe\",\n";
-                ss << u8"    \"ruRU\": \"Пораженный\",\n";
-                ss << u8"    \"zhCN\": \"受难魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3021,\n";
-                ss << u8"    \"Key\": \"Andariel\",\n";
-                ss << u8"    \"enUS\": \"Andariel\",\n";
-                ss << u8"    \"zhTW\": \"安達莉爾\",\n";
-                ss << u8"    \"deDE\": \"Andariel\",\n";
-                ss << u8"    \"esES\": \"Andariel\",\n";
-                ss << u8"    \"frFR\": \"Andarielle\",\n";
-                ss << u8"    \"itIT\": \"Andariel\",\n";
-                ss << u8"    \"koKR\": \"안다리엘\",\n";
-                ss << u8"    \"plPL\": \"Andariel\",\n";
-                ss << u8"    \"esMX\": \"Andariel\",\n";
-                ss << u8"    \"jaJP\": \"アンダリエル\",\n";
-                ss << u8"    \"ptBR\": \"Andariel\",\n";
-                ss << u8"    \"ruRU\": \"Андариэль\",\n";
-                ss << u8"    \"zhCN\": \"安达莉尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3033,\n";
-                ss << u8"    \"Key\": \"Camel\",\n";
-                ss << u8"    \"enUS\": \"Camel\",\n";
-                ss << u8"    \"zhTW\": \"駱駝\",\n";
-                ss << u8"    \"deDE\": \"Kamel\",\n";
-                ss << u8"    \"esES\": \"Camello\",\n";
-                ss << u8"    \"frFR\": \"Dromadaire\",\n";
-                ss << u8"    \"itIT\": \"Cammello\",\n";
-                ss << u8"    \"koKR\": \"낙타\",\n";
-                ss << u8"    \"plPL\": \"Wielbłąd\",\n";
-                ss << u8"    \"esMX\": \"Camello\",\n";
-                ss << u8"    \"jaJP\": \"ラクダ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Camelo\",\n";
-                ss << u8"    \"ruRU\": \"Верблюд\",\n";
-                ss << u8"    \"zhCN\": \"骆驼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3034,\n";
-                ss << u8"    \"Key\": \"Cadaver\",\n";
-                ss << u8"    \"enUS\": \"Cadaver\",\n";
-                ss << u8"    \"zhTW\": \"活屍木乃伊\",\n";
-                ss << u8"    \"deDE\": \"Kadaver\",\n";
-                ss << u8"    \"esES\": \"Cadáver\",\n";
-                ss << u8"    \"frFR\": \"Cadavre\",\n";
-                ss << u8"    \"itIT\": \"Mummificato\",\n";
-                ss << u8"    \"koKR\": \"송장\",\n";
-                ss << u8"    \"plPL\": \"Kadawer\",\n";
-                ss << u8"    \"esMX\": \"Cadáver\",\n";
-                ss << u8"    \"jaJP\": \"腑分けされしミイラ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cadáver\",\n";
-                ss << u8"    \"ruRU\": \"Кадавр\",\n";
-                ss << u8"    \"zhCN\": \"解剖尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3035,\n";
-                ss << u8"    \"Key\": \"PreservedDead\",\n";
-                ss << u8"    \"enUS\": \"Preserved Dead\",\n";
-                ss << u8"    \"zhTW\": \"長存木乃伊\",\n";
-                ss << u8"    \"deDE\": \"Erhaltener Toter\",\n";
-                ss << u8"    \"esES\": \"Muerto preservado\",\n";
-                ss << u8"    \"frFR\": \"Mort préservé\",\n";
-                ss << u8"    \"itIT\": \"Preservato\",\n";
-                ss << u8"    \"koKR\": \"보존된 망자\",\n";
-                ss << u8"    \"plPL\": \"Zakonserwowany trup\",\n";
-                ss << u8"    \"esMX\": \"Muerto preservado\",\n";
-                ss << u8"    \"jaJP\": \"保存されしミイラ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Morto Preservado\",\n";
-                ss << u8"    \"ruRU\": \"Сохранившийся мертвец\",\n";
-                ss << u8"    \"zhCN\": \"蜡化尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3036,\n";
-                ss << u8"    \"Key\": \"Embalmed\",\n";
-                ss << u8"    \"enUS\": \"Embalmed\",\n";
-                ss << u8"    \"zhTW\": \"防腐木乃伊\",\n";
-                ss << u8"    \"deDE\": \"Einbalsamierter\",\n";
-                ss << u8"    \"esES\": \"Embalsamado\",\n";
-                ss << u8"    \"frFR\": \"Embaumé\",\n";
-                ss << u8"    \"itIT\": \"Imbalsamato\",\n";
-                ss << u8"    \"koKR\": \"미라\",\n";
-                ss << u8"    \"plPL\": \"Zabalsamowany\",\n";
-                ss << u8"    \"esMX\": \"Embalsamado\",\n";
-                ss << u8"    \"jaJP\": \"埋葬されしミイラ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Embalsamado\",\n";
-                ss << u8"    \"ruRU\": \"Нетленный\",\n";
-                ss << u8"    \"zhCN\": \"防腐尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3037,\n";
-                ss << u8"    \"Key\": \"DriedCorpse\",\n";
-                ss << u8"    \"enUS\": \"Dried Corpse\",\n";
-                ss << u8"    \"zhTW\": \"乾屍木乃伊\",\n";
-                ss << u8"    \"deDE\": \"Vertrocknete Leiche\",\n";
-                ss << u8"    \"esES\": \"Cadáver seco\",\n";
-                ss << u8"    \"frFR\": \"Corps desséché\",\n";
-                ss << u8"    \"itIT\": \"Essiccato\",\n";
-                ss << u8"    \"koKR\": \"메마른 시체\",\n";
-                ss << u8"    \"plPL\": \"Wysuszone zwłoki\",\n";
-                ss << u8"    \"esMX\": \"Cadáver disecado\",\n";
-                ss << u8"    \"jaJP\": \"乾いたミイラ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cadáver Ressequido\",\n";
-                ss << u8"    \"ruRU\": \"Иссушенный труп\",\n";
-                ss << u8"    \"zhCN\": \"干尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3038,\n";
-                ss << u8"    \"Key\": \"Decayed\",\n";
-                ss << u8"    \"enUS\": \"Decayed\",\n";
-                ss << u8"    \"zhTW\": \"腐屍木乃伊\",\n";
-                ss << u8"    \"deDE\": \"Verfallener\",\n";
-                ss << u8"    \"esES\": \"Podrido\",\n";
-                ss << u8"    \"frFR\": \"Décomposé\",\n";
-                ss << u8"    \"itIT\": \"Decomposto\",\n";
-                ss << u8"    \"koKR\": \"부패한 자\",\n";
-                ss << u8"    \"plPL\": \"Nadgnity\",\n";
-                ss << u8"    \"esMX\": \"Putrefacto\",\n";
-                ss << u8"    \"jaJP\": \"腐りしミイラ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Decomposto\",\n";
-                ss << u8"    \"ruRU\": \"Гниющий\",\n";
-                ss << u8"    \"zhCN\": \"腐尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3039,\n";
-                ss << u8"    \"Key\": \"Urdar\",\n";
-                ss << u8"    \"enUS\": \"Urdar\",\n";
-                ss << u8"    \"zhTW\": \"烏爾達巨怪\",\n";
-                ss << u8"    \"deDE\": \"Urdar\",\n";
-                ss << u8"    \"esES\": \"Urdar\",\n";
-                ss << u8"    \"frFR\": \"Urdar\",\n";
-                ss << u8"    \"itIT\": \"Urdar\",\n";
-                ss << u8"    \"koKR\": \"우르다르\",\n";
-                ss << u8"    \"plPL\": \"Urdar\",\n";
-                ss << u8"    \"esMX\": \"Urdar\",\n";
-                ss << u8"    \"jaJP\": \"ウルダー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Urdar\",\n";
-                ss << u8"    \"ruRU\": \"Урдар\",\n";
-                ss << u8"    \"zhCN\": \"乌达兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3041,\n";
-                ss << u8"    \"Key\": \"Gorbelly\",\n";
-                ss << u8"    \"enUS\": \"Gorebelly\",\n";
-                ss << u8"    \"zhTW\": \"血腹巨怪\",\n";
-                ss << u8"    \"deDE\": \"Blutbauch\",\n";
-                ss << u8"    \"esES\": \"Ogrotesco\",\n";
-                ss << u8"    \"frFR\": \"Éventreur\",\n";
-                ss << u8"    \"itIT\": \"Ventrerosso\",\n";
-                ss << u8"    \"koKR\": \"피불뚝이\",\n";
-                ss << u8"    \"plPL\": \"Rzezibrzuch\",\n";
-                ss << u8"    \"esMX\": \"Truculento\",\n";
-                ss << u8"    \"jaJP\": \"ゴアベリー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Sanguepança\",\n";
-                ss << u8"    \"ruRU\": \"Кровобрюх\",\n";
-                ss << u8"    \"zhCN\": \"血腹魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3042,\n";
-                ss << u8"    \"Key\": \"Blunderbore\",\n";
-                ss << u8"    \"enUS\": \"Blunderbore\",\n";
-                ss << u8"    \"zhTW\": \"蠻力巨怪\",\n";
-                ss << u8"    \"deDE\": \"Tölpelträger\",\n";
-                ss << u8"    \"esES\": \"Mamotreto\",\n";
-                ss << u8"    \"frFR\": \"Gueulard\",\n";
-                ss << u8"    \"itIT\": \"Picchiacarne\",\n";
-                ss << u8"    \"koKR\": \"뿔방망이\",\n";
-                ss << u8"    \"plPL\": \"Tępogłów\",\n";
-                ss << u8"    \"esMX\": \"Muelehuesos\",\n";
-                ss << u8"    \"jaJP\": \"ブランダーボア\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Tritura-ossos\",\n";
-                ss << u8"    \"ruRU\": \"Лютобой\",\n";
-                ss << u8"    \"zhCN\": \"愚笨魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3043,\n";
-                ss << u8"    \"Key\": \"WorldKillerYoung\",\n";
-                ss << u8"    \"enUS\": \"Blood Maggot Young\",\n";
-                ss << u8"    \"zhTW\": \"鮮血蛆蟲幼體\",\n";
-                ss << u8"    \"deDE\": \"Blutwurmnachwuchs\",\n";
-                ss << u8"    \"esES\": \"Cría de gusano de sangre\",\n";
-                ss << u8"    \"frFR\": \"Petit asticot de sang\",\n";
-                ss << u8"    \"itIT\": \"Larva del Sangue Giovane\",\n";
-                ss << u8"    \"koKR\": \"피 구더기 새끼\",\n";
-                ss << u8"    \"plPL\": \"Młode krwiożerczej larwy\",\n";
-                ss << u8"    \"esMX\": \"Cresa de sangre joven\",\n";
-                ss << u8"    \"jaJP\": \"血濡れた地虫の幼生\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Filhote de Verme Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Личинка кровавой мокрицы\",\n";
-                ss << u8"    \"zhCN\": \"幼年血虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3044,\n";
-                ss << u8"    \"Key\": \"GiantLampreyYoung\",\n";
-                ss << u8"    \"enUS\": \"Giant Lamprey Young\",\n";
-                ss << u8"    \"zhTW\": \"吸血巨蟲幼體\",\n";
-                ss << u8"    \"deDE\": \"Riesenmuränennachwuchs\",\n";
-                ss << u8"    \"esES\": \"Cría de lamprea gigante\",\n";
-                ss << u8"    \"frFR\": \"Jeune lamproie géante\",\n";
-                ss << u8"    \"itIT\": \"Lampreda Gigante Giovane\",\n";
-                ss << u8"    \"koKR\": \"거대 빨판구더기 새끼\",\n";
-                ss << u8"    \"plPL\": \"Młode skolopendromorfa\",\n";
-                ss << u8"    \"esMX\": \"Lamprea gigante joven\",\n";
-                ss << u8"    \"jaJP\": \"吸血地虫の幼生\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Filhote de Lampreia Gigante\",\n";
-                ss << u8"    \"ruRU\": \"Молодая гигантская жужелица\",\n";
-                ss << u8"    \"zhCN\": \"幼年八目虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3045,\n";
-                ss << u8"    \"Key\": \"DevourerYoung\",\n";
-                ss << u8"    \"enUS\": \"Devourer Young\",\n";
-                ss << u8"    \"zhTW\": \"吞噬者幼體\",\n";
-                ss << u8"    \"deDE\": \"Verschlingernachwuchs\",\n";
-                ss << u8"    \"esES\": \"Cría de devorador\",\n";
-                ss << u8"    \"frFR\": \"Jeune dévoreur\",\n";
-                ss << u8"    \"itIT\": \"Divoratore Giovane\",\n";
-                ss << u8"    \"koKR\": \"걸신구더기 새끼\",\n";
-                ss << u8"    \"plPL\": \"Młode pożeracza\",\n";
-                ss << u8"    \"esMX\": \"Devorador joven\",\n";
-                ss << u8"    \"jaJP\": \"貪る地虫の幼生\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Filhote de Devorador\",\n";
-                ss << u8"    \"ruRU\": \"Молодой пожиратель\",\n";
-                ss << u8"    \"zhCN\": \"幼年吞食虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3046,\n";
-                ss << u8"    \"Key\": \"RockWormYoung\",\n";
-                ss << u8"    \"enUS\": \"Rock Worm Young\",\n";
-                ss << u8"    \"zhTW\": \"鑽岩蛆蟲幼體\",\n";
-                ss << u8"    \"deDE\": \"Felswurmnachwuchs\",\n";
-                ss << u8"    \"esES\": \"Cría de gusano de roca\",\n";
-                ss << u8"    \"frFR\": \"Jeune ver des roches\",\n";
-                ss << u8"    \"itIT\": \"Verme di Roccia Giovane\",\n";
-                ss << u8"    \"koKR\": \"바위 벌레 새끼\",\n";
-                ss << u8"    \"plPL\": \"Młode skalnego robaka\",\n";
-                ss << u8"    \"esMX\": \"Gusano de piedra joven\",\n";
-                ss << u8"    \"jaJP\": \"岩棲みの地虫の幼生\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Filhote de Verme Rochoso\",\n";
-                ss << u8"    \"ruRU\": \"Личинка каменного червя\",\n";
-                ss << u8"    \"zhCN\": \"幼年岩虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3047,\n";
-                ss << u8"    \"Key\": \"SandMaggotYoung\",\n";
-                ss << u8"    \"enUS\": \"Sand Maggot Young\",\n";
-                ss << u8"    \"zhTW\": \"沙漠蛆蟲幼體\",\n";
-                ss << u8"    \"deDE\": \"Sandwurmnachwuchs\",\n";
-                ss << u8"    \"esES\": \"Cría de gusano de arena\",\n";
-                ss << u8"    \"frFR\": \"Petit asticot des sables\",\n";
-                ss << u8"    \"itIT\": \"Larva della Sabbia Giovane\",\n";
-                ss << u8"    \"koKR\": \"모래 구더기 새끼\",\n";
-                ss << u8"    \"plPL\": \"Młode piasecznika\",\n";
-                ss << u8"    \"esMX\": \"Cresa de arena joven\",\n";
-                ss << u8"    \"jaJP\": \"砂漠の地虫の幼生\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Filhote de Verme Arenoso\",\n";
-                ss << u8"    \"ruRU\": \"Личинка песчаной мокрицы\",\n";
-                ss << u8"    \"zhCN\": \"幼年沙虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3048,\n";
-                ss << u8"    \"Key\": \"WorldKillerEgg\",\n";
-                ss << u8"    \"enUS\": \"Blood Maggot Egg\",\n";
-                ss << u8"    \"zhTW\": \"鮮血蛆蟲之卵\",\n";
-                ss << u8"    \"deDE\": \"Blutwurmei\",\n";
-                ss << u8"    \"esES\": \"Larva de gusano de sangre\",\n";
-                ss << u8"    \"frFR\": \"Œuf d’asticot de sang\",\n";
-                ss << u8"    \"itIT\": \"Uovo di Larva del Sangue\",\n";
-                ss << u8"    \"koKR\": \"피 구더기 알\",\n";
-                ss << u8"    \"plPL\": \"Jajo krwiożerczej larwy\",\n";
-                ss << u8"    \"esMX\": \"Huevo de Cresa de sangre\",\n";
-                ss << u8"    \"jaJP\": \"血濡れた地虫の卵\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ovo de Verme Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Яйцо кровавой мокрицы\",\n";
-                ss << u8"    \"zhCN\": \"血虫蛋\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3049,\n";
-                ss << u8"    \"Key\": \"GiantLampreyEgg\",\n";
-                ss << u8"    \"enUS\": \"Giant Lamprey Egg\",\n";
-                ss << u8"    \"zhTW\": \"吸血巨蟲之卵\",\n";
-                ss << u8"    \"deDE\": \"Riesenmuränenei\",\n";
-                ss << u8"    \"esES\": \"Larva de lamprea gigante\",\n";
-                ss << u8"    \"frFR\": \"Œuf de lamproie géante\",\n";
-                ss << u8"    \"itIT\": \"Uovo di Lampreda Gigante\",\n";
-                ss << u8"    \"koKR\": \"거대 빨판구더기 알\",\n";
-                ss << u8"    \"plPL\": \"Jajo skolopendromorfa\",\n";
-                ss << u8"    \"esMX\": \"Huevo de Lamprea gigante\",\n";
-                ss << u8"    \"jaJP\": \"吸血地虫の卵\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ovo de Lampreia Gigante\",\n";
-                ss << u8"    \"ruRU\": \"Яйцо гигантской жужелицы\",\n";
-                ss << u8"    \"zhCN\": \"巨型八目虫蛋\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3050,\n";
-                ss << u8"    \"Key\": \"DevourerEgg\",\n";
-                ss << u8"    \"enUS\": \"Devourer Egg\",\n";
-                ss << u8"    \"zhTW\": \"吞噬者之卵\",\n";
-                ss << u8"    \"deDE\": \"Verschlingerei\",\n";
-                ss << u8"    \"esES\": \"Larva de devorador\",\n";
-                ss << u8"    \"frFR\": \"Œuf de dévoreur\",\n";
-                ss << u8"    \"itIT\": \"Uovo di Divoratore\",\n";
-                ss << u8"    \"koKR\": \"걸신구더기 알\",\n";
-                ss << u8"    \"plPL\": \"Jajo pożeracza\",\n";
-                ss << u8"    \"esMX\": \"Huevo de Devorador\",\n";
-                ss << u8"    \"jaJP\": \"貪る地虫の卵\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ovo de Devorador\",\n";
-                ss << u8"    \"ruRU\": \"Яйцо пожирателя\",\n";
-                ss << u8"    \"zhCN\": \"吞食虫蛋\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3051,\n";
-                ss << u8"    \"Key\": \"RockWormEgg\",\n";
-                ss << u8"    \"enUS\": \"Rock Worm Egg\",\n";
-                ss << u8"    \"zhTW\": \"鑽岩蛆蟲之卵\",\n";
-                ss << u8"    \"deDE\": \"Felswurmei\",\n";
-                ss << u8"    \"esES\": \"Larva de gusano de roca\",\n";
-                ss << u8"    \"frFR\": \"Œuf de ver des roches\",\n";
-                ss << u8"    \"itIT\": \"Uovo di Verme di Roccia\",\n";
-                ss << u8"    \"koKR\": \"바위 벌레 알\",\n";
-                ss << u8"    \"plPL\": \"Jajo skalnego robaka\",\n";
-                ss << u8"    \"esMX\": \"Huevo de Gusano de piedra\",\n";
-                ss << u8"    \"jaJP\": \"岩棲みの地虫の卵\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ovo de Verme Rochoso\",\n";
-                ss << u8"    \"ruRU\": \"Яйцо каменного червя\",\n";
-                ss << u8"    \"zhCN\": \"岩虫蛋\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3052,\n";
-                ss << u8"    \"Key\": \"SandMaggotEgg\",\n";
-                ss << u8"    \"enUS\": \"Sand Maggot Egg\",\n";
-                ss << u8"    \"zhTW\": \"沙漠蛆蟲之卵\",\n";
-                ss << u8"    \"deDE\": \"Sandwurmei\",\n";
-                ss << u8"    \"esES\": \"Larva de gusano de arena\",\n";
-                ss << u8"    \"frFR\": \"Œuf d’asticot des sables\",\n";
-                ss << u8"    \"itIT\": \"Uovo di Larva della Sabbia\",\n";
-                ss << u8"    \"koKR\": \"모래 구더기 알\",\n";
-                ss << u8"    \"plPL\": \"Jajo piasecznika\",\n";
-                ss << u8"    \"esMX\": \"Huevo de Cresa de arena\",\n";
-                ss << u8"    \"jaJP\": \"砂漠の地虫の卵\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ovo de Verme Arenoso\",\n";
-                ss << u8"    \"ruRU\": \"Яйцо песчаной мокрицы\",\n";
-                ss << u8"    \"zhCN\": \"沙虫蛋\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3053,\n";
-                ss << u8"    \"Key\": \"Maggot\",\n";
-                ss << u8"    \"enUS\": \"Maggot\",\n";
-                ss << u8"    \"zhTW\": \"蛆蟲\",\n";
-                ss << u8"    \"deDE\": \"Wurm\",\n";
-                ss << u8"    \"esES\": \"Gusano\",\n";
-                ss << u8"    \"frFR\": \"Asticot\",\n";
-                ss << u8"    \"itIT\": \"Larva\",\n";
-                ss << u8"    \"koKR\": \"구더기\",\n";
-                ss << u8"    \"plPL\": \"Robak\",\n";
-                ss << u8"    \"esMX\": \"Cresa\",\n";
-                ss << u8"    \"jaJP\": \"地虫\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Verme\",\n";
-                ss << u8"    \"ruRU\": \"Мокрица\",\n";
-                ss << u8"    \"zhCN\": \"蛆虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3054,\n";
-                ss << u8"    \"Key\": \"Duriel\",\n";
-                ss << u8"    \"enUS\": \"Duriel\",\n";
-                ss << u8"    \"zhTW\": \"都瑞爾\",\n";
-                ss << u8"    \"deDE\": \"Duriel\",\n";
-                ss << u8"    \"esES\": \"Duriel\",\n";
-                ss << u8"    \"frFR\": \"Duriel\",\n";
-                ss << u8"    \"itIT\": \"Duriel\",\n";
-                ss << u8"    \"koKR\": \"두리엘\",\n";
-                ss << u8"    \"plPL\": \"Duriel\",\n";
-                ss << u8"    \"esMX\": \"Duriel\",\n";
-                ss << u8"    \"jaJP\": \"デュリエル\",\n";
-                ss << u8"    \"ptBR\": \"Duriel\",\n";
-                ss << u8"    \"ruRU\": \"Дюриэль\",\n";
-                ss << u8"    \"zhCN\": \"督瑞尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3055,\n";
-                ss << u8"    \"Key\": \"BloodHawkNest\",\n";
-                ss << u8"    \"enUS\": \"Blood Hawk Nest\",\n";
-                ss << u8"    \"zhTW\": \"血鷹之巢\",\n";
-                ss << u8"    \"deDE\": \"Blutfalkennest\",\n";
-                ss << u8"    \"esES\": \"Nido de gerifalte sangriento\",\n";
-                ss << u8"    \"frFR\": \"Nid de faucons de sang\",\n";
-                ss << u8"    \"itIT\": \"Nido di Falco Vermiglio\",\n";
-                ss << u8"    \"koKR\": \"핏빛매 둥지\",\n";
-                ss << u8"    \"plPL\": \"Gniazdo krwawych jastrzębi\",\n";
-                ss << u8"    \"esMX\": \"Nido de Halcón sanguinario\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・ホークの巣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ninho de Falcão Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Гнездо кровавых ястребов\",\n";
-                ss << u8"    \"zhCN\": \"血鹰巢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3056,\n";
-                ss << u8"    \"Key\": \"FlyingScimitar\",\n";
-                ss << u8"    \"enUS\": \"Flying Scimitar\",\n";
-                ss << u8"    \"zhTW\": \"鬼靈彎刀\",\n";
-                ss << u8"    \"deDE\": \"Fliegender Krummsäbel\",\n";
-                ss << u8"    \"esES\": \"Cimitarra volante\",\n";
-                ss << u8"    \"frFR\": \"Cimeterre volant\",\n";
-                ss << u8"    \"itIT\": \"Scimitarra Volante\",\n";
-                ss << u8"    \"koKR\": \"깨어난 시미터\",\n";
-                ss << u8"    \"plPL\": \"Latający sejmitar\",\n";
-                ss << u8"    \"esMX\": \"Cimitarra flotante\",\n";
-                ss << u8"    \"jaJP\": \"フライング・シミター\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Cimitarra Voadora\",\n";
-                ss << u8"    \"ruRU\": \"Парящий ятаган\",\n";
-                ss << u8"    \"zhCN\": \"飞空弯刀\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3057,\n";
-                ss << u8"    \"Key\": \"CloudStalkerNest\",\n";
-                ss << u8"    \"enUS\": \"Cloud Stalker Nest\",\n";
-                ss << u8"    \"zhTW\": \"雲襲血鷹之巢\",\n";
-                ss << u8"    \"deDE\": \"Wolkenschleichernest\",\n";
-                ss << u8"    \"esES\": \"Nido de acechador de las nubes\",\n";
-                ss << u8"    \"frFR\": \"Nid de vagabonds des nuages\",\n";
-                ss << u8"    \"itIT\": \"Nido di Predatore delle Nuvole\",\n";
-                ss << u8"    \"koKR\": \"구름 추적자 둥지\",\n";
-                ss << u8"    \"plPL\": \"Gniazdo chmuroskrzydłych\",\n";
-                ss << u8"    \"esMX\": \"Nido de Acechador nebuloso\",\n";
-                ss << u8"    \"jaJP\": \"クラウド・ストーカーの巣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ninho de Perseguidor Nebuloso\",\n";
-                ss << u8"    \"ruRU\": \"Гнездо облачных охотников\",\n";
-                ss << u8"    \"zhCN\": \"烟雾偷袭者巢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3058,\n";
-                ss << u8"    \"Key\": \"BlackVultureNest\",\n";
-                ss << u8"    \"enUS\": \"Black Raptor Nest\",\n";
-                ss << u8"    \"zhTW\": \"黑色猛禽之巢\",\n";
-                ss << u8"    \"deDE\": \"Schwarzgreifernest\",\n";
-                ss << u8"    \"esES\": \"Nido de ave de presa negra\",\n";
-                ss << u8"    \"frFR\": \"Nid de rapaces noirs\",\n";
-                ss << u8"    \"itIT\": \"Nido di Rapace Nero\",\n";
-                ss << u8"    \"koKR\": \"검은 맹금 둥지\",\n";
-                ss << u8"    \"plPL\": \"Gniazdo czarnych krogulców\",\n";
-                ss << u8"    \"esMX\": \"Nido de Rapaz sombría\",\n";
-                ss << u8"    \"jaJP\": \"ブラック・ラプターの巣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ninho de Raptor Tenebroso\",\n";
-                ss << u8"    \"ruRU\": \"Гнездо черного ящера\",\n";
-                ss << u8"    \"zhCN\": \"黑羽猛禽巢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3059,\n";
-                ss << u8"    \"Key\": \"FoulCrowNest\",\n";
-                ss << u8"    \"enUS\": \"Foul Crow Nest\",\n";
-                ss << u8"    \"zhTW\": \"惡毒穢鴉之巢\",\n";
-                ss << u8"    \"deDE\": \"Faulkrähennest\",\n";
-                ss << u8"    \"esES\": \"Nido de cuervo fétido\",\n";
-                ss << u8"    \"frFR\": \"Nid de corbeaux fétides\",\n";
-                ss << u8"    \"itIT\": \"Nido di Corvo Fetido\",\n";
-                ss << u8"    \"koKR\": \"불결한 까마귀 둥지\",\n";
-                ss << u8"    \"plPL\": \"Gniazdo plugawych kruków\",\n";
-                ss << u8"    \"esMX\": \"Nido de Cuervo repugnante\",\n";
-                ss << u8"    \"jaJP\": \"ファウル・クロウの巣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ninho de Corvo Sórdido\",\n";
-                ss << u8"    \"ruRU\": \"Гнездо нечистой птицы\",\n";
-                ss << u8"    \"zhCN\": \"恶臭乌鸦巢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3060,\n";
-                ss << u8"    \"Key\": \"Diablo\",\n";
-                ss << u8"    \"enUS\": \"Diablo\",\n";
-                ss << u8"    \"zhTW\": \"迪亞布羅\",\n";
-                ss << u8"    \"deDE\": \"Diablo\",\n";
-                ss << u8"    \"esES\": \"Diablo\",\n";
-                ss << u8"    \"frFR\": \"Diablo\",\n";
-                ss << u8"    \"itIT\": \"Diablo\",\n";
-                ss << u8"    \"koKR\": \"디아블로\",\n";
-                ss << u8"    \"plPL\": \"Diablo\",\n";
-                ss << u8"    \"esMX\": \"Diablo\",\n";
-                ss << u8"    \"jaJP\": \"ディアブロ\",\n";
-                ss << u8"    \"ptBR\": \"Diablo\",\n";
-                ss << u8"    \"ruRU\": \"Диабло\",\n";
-                ss << u8"    \"zhCN\": \"迪亚波罗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3061,\n";
-                ss << u8"    \"Key\": \"Baal\",\n";
-                ss << u8"    \"enUS\": \"Baal\",\n";
-                ss << u8"    \"zhTW\": \"巴爾\",\n";
-                ss << u8"    \"deDE\": \"Baal\",\n";
-                ss << u8"    \"esES\": \"Baal\",\n";
-                ss << u8"    \"frFR\": \"Baal\",\n";
-                ss << u8"    \"itIT\": \"Baal\",\n";
-                ss << u8"    \"koKR\": \"바알\",\n";
-                ss << u8"    \"plPL\": \"Baal\",\n";
-                ss << u8"    \"esMX\": \"Baal\",\n";
-                ss << u8"    \"jaJP\": \"バール\",\n";
-                ss << u8"    \"ptBR\": \"Baal\",\n";
-                ss << u8"    \"ruRU\": \"Баал\",\n";
-                ss << u8"    \"zhCN\": \"巴尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3062,\n";
-                ss << u8"    \"Key\": \"Mephisto\",\n";
-                ss << u8"    \"enUS\": \"Mephisto\",\n";
-                ss << u8"    \"zhTW\": \"墨菲斯托\",\n";
-                ss << u8"    \"deDE\": \"Mephisto\",\n";
-                ss << u8"    \"esES\": \"Mefisto\",\n";
-                ss << u8"    \"frFR\": \"Méphisto\",\n";
-                ss << u8"    \"itIT\": \"Mefisto\",\n";
-                ss << u8"    \"koKR\": \"메피스토\",\n";
-                ss << u8"    \"plPL\": \"Mefisto\",\n";
-                ss << u8"    \"esMX\": \"Mefisto\",\n";
-                ss << u8"    \"jaJP\": \"メフィスト\",\n";
-                ss << u8"    \"ptBR\": \"Mefisto\",\n";
-                ss << u8"    \"ruRU\": \"Мефисто\",\n";
-                ss << u8"    \"zhCN\": \"墨菲斯托\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3063,\n";
-                ss << u8"    \"Key\": \"Cantor\",\n";
-                ss << u8"    \"enUS\": \"Cantor\",\n";
-                ss << u8"    \"zhTW\": \"領唱者\",\n";
-                ss << u8"    \"deDE\": \"Kantor\",\n";
-                ss << u8"    \"esES\": \"Cantor\",\n";
-                ss << u8"    \"frFR\": \"Chantre\",\n";
-                ss << u8"    \"itIT\": \"Cantore\",\n";
-                ss << u8"    \"koKR\": \"낭송자\",\n";
-                ss << u8"    \"plPL\": \"Kantor\",\n";
-                ss << u8"    \"esMX\": \"Capiscol\",\n";
-                ss << u8"    \"jaJP\": \"聖歌隊長\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cantor\",\n";
-                ss << u8"    \"ruRU\": \"Кантор\",\n";
-                ss << u8"    \"zhCN\": \"领唱者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3064,\n";
-                ss << u8"    \"Key\": \"Heirophant\",\n";
-                ss << u8"    \"enUS\": \"Hierophant\",\n";
-                ss << u8"    \"zhTW\": \"祭司\",\n";
-                ss << u8"    \"deDE\": \"Hierophant\",\n";
-                ss << u8"    \"esES\": \"Hierofante\",\n";
-                ss << u8"    \"frFR\": \"Hiérophante\",\n";
-                ss << u8"    \"itIT\": \"Ierofante\",\n";
-                ss << u8"    \"koKR\": \"신비사제\",\n";
-                ss << u8"    \"plPL\": \"Hierofant\",\n";
-                ss << u8"    \"esMX\": \"Hierofante\",\n";
-                ss << u8"    \"jaJP\": \"司祭長\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Hierofante\",\n";
-                ss << u8"    \"ruRU\": \"Верховный жрец\",\n";
-                ss << u8"    \"zhCN\": \"圣师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3065,\n";
-                ss << u8"    \"Key\": \"Sexton\",\n";
-                ss << u8"    \"enUS\": \"Sexton\",\n";
-                ss << u8"    \"zhTW\": \"司事\",\n";
-                ss << u8"    \"deDE\": \"Küster\",\n";
-                ss << u8"    \"esES\": \"Sacristán\",\n";
-                ss << u8"    \"frFR\": \"Sacristain\",\n";
-                ss << u8"    \"itIT\": \"Necroforo\",\n";
-                ss << u8"    \"koKR\": \"교회지기\",\n";
-                ss << u8"    \"plPL\": \"Akolita\",\n";
-                ss << u8"    \"esMX\": \"Sacristán\",\n";
-                ss << u8"    \"jaJP\": \"会堂奉仕者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Sexton\",\n";
-                ss << u8"    \"ruRU\": \"Алтарник\",\n";
-                ss << u8"    \"zhCN\": \"教堂司事\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3066,\n";
-                ss << u8"    \"Key\": \"Zealot\",\n";
-                ss << u8"    \"enUS\": \"Zealot\",\n";
-                ss << u8"    \"zhTW\": \"狂熱信徒\",\n";
-                ss << u8"    \"deDE\": \"Fanatiker\",\n";
-                ss << u8"    \"esES\": \"Zelote\",\n";
-                ss << u8"    \"frFR\": \"Zélote\",\n";
-                ss << u8"    \"itIT\": \"Zelota\",\n";
-                ss << u8"    \"koKR\": \"광신도\",\n";
-                ss << u8"    \"plPL\": \"Fanatyk\",\n";
-                ss << u8"    \"esMX\": \"Zelote\",\n";
-                ss << u8"    \"jaJP\": \"ザカラム狂信者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Zelote\",\n";
-                ss << u8"    \"ruRU\": \"Фанатик\",\n";
-                ss << u8"    \"zhCN\": \"热忱者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3067,\n";
-                ss << u8"    \"Key\": \"Faithful\",\n";
-                ss << u8"    \"enUS\": \"Faithful\",\n";
-                ss << u8"    \"zhTW\": \"忠誠信徒\",\n";
-                ss << u8"    \"deDE\": \"Gläubiger\",\n";
-                ss << u8"    \"esES\": \"Fiel\",\n";
-                ss << u8"    \"frFR\": \"Fidèle\",\n";
-                ss << u8"    \"itIT\": \"Fedele\",\n";
-                ss << u8"    \"koKR\": \"신봉자\",\n";
-                ss << u8"    \"plPL\": \"Wierny\",\n";
-                ss << u8"    \"esMX\": \"Fiel\",\n";
-                ss << u8"    \"jaJP\": \"ザカラム信徒\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Fiel\",\n";
-                ss << u8"    \"ruRU\": \"Послушник\",\n";
-                ss << u8"    \"zhCN\": \"虔诚者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3068,\n";
-                ss << u8"    \"Key\": \"Zakarumite\",\n";
-                ss << u8"    \"enUS\": \"Zakarumite\",\n";
-                ss << u8"    \"zhTW\": \"撒卡蘭姆信徒\",\n";
-                ss << u8"    \"deDE\": \"Zakarumit\",\n";
-                ss << u8"    \"esES\": \"Zakarumite\",\n";
-                ss << u8"    \"frFR\": \"Zakarumite\",\n";
-                ss << u8"    \"itIT\": \"Zakarumita\",\n";
-                ss << u8"    \"koKR\": \"자카룸 교도\",\n";
-                ss << u8"    \"plPL\": \"Zakarumita\",\n";
-                ss << u8"    \"esMX\": \"Zakarumita\",\n";
-                ss << u8"    \"jaJP\": \"ザカラム教徒\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Zakarumita\",\n";
-                ss << u8"    \"ruRU\": \"Закарумит\",\n";
-                ss << u8"    \"zhCN\": \"萨卡兰姆教徒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3069,\n";
-                ss << u8"    \"Key\": \"BlackSoul\",\n";
-                ss << u8"    \"enUS\": \"Black Soul\",\n";
-                ss << u8"    \"zhTW\": \"黑魂鬼火\",\n";
-                ss << u8"    \"deDE\": \"Schwarze Seele\",\n";
-                ss << u8"    \"esES\": \"Alma negra\",\n";
-                ss << u8"    \"frFR\": \"Âme noire\",\n";
-                ss << u8"    \"itIT\": \"Anima Nera\",\n";
-                ss << u8"    \"koKR\": \"어둠의 영혼\",\n";
-                ss << u8"    \"plPL\": \"Czarna dusza\",\n";
-                ss << u8"    \"esMX\": \"Alma sombría\",\n";
-                ss << u8"    \"jaJP\": \"ブラック・ソウル\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Alma Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Черная душа\",\n";
-                ss << u8"    \"zhCN\": \"黑魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3070,\n";
-                ss << u8"    \"Key\": \"BurningSoul\",\n";
-                ss << u8"    \"enUS\": \"Burning Soul\",\n";
-                ss << u8"    \"zhTW\": \"燃魂鬼火\",\n";
-                ss << u8"    \"deDE\": \"Brennende Seele\",\n";
-                ss << u8"    \"esES\": \"Alma ardiente\",\n";
-                ss << u8"    \"frFR\": \"Âme ardente\",\n";
-                ss << u8"    \"itIT\": \"Anima Fiammeggiante\",\n";
-                ss << u8"    \"koKR\": \"불타는 영혼\",\n";
-                ss << u8"    \"plPL\": \"Płonąca dusza\",\n";
-                ss << u8"    \"esMX\": \"Alma ardiente\",\n";
-                ss << u8"    \"jaJP\": \"バーニング・ソウル\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Alma Flamejante\",\n";
-                ss << u8"    \"ruRU\": \"Пылающая душа\",\n";
-                ss << u8"    \"zhCN\": \"燃魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3071,\n";
-                ss << u8"    \"Key\": \"SwampGhost\",\n";
-                ss << u8"    \"enUS\": \"Swamp Ghost\",\n";
-                ss << u8"    \"zhTW\": \"沼澤鬼魂\",\n";
-                ss << u8"    \"deDE\": \"Sumpfgeist\",\n";
-                ss << u8"    \"esES\": \"Fantasma del pantano\",\n";
-                ss << u8"    \"frFR\": \"Fantôme des marais\",\n";
-                ss << u8"    \"itIT\": \"Fantasma della Palude\",\n";
-                ss << u8"    \"koKR\": \"늪 유령\",\n";
-                ss << u8"    \"plPL\": \"Bagienny duch\",\n";
-                ss << u8"    \"esMX\": \"Fantasma del pantano\",\n";
-                ss << u8"    \"jaJP\": \"スワンプ・ゴースト\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Fantasma do Pântano\",\n";
-                ss << u8"    \"ruRU\": \"Болотный призрак\",\n";
-                ss << u8"    \"zhCN\": \"沼魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3072,\n";
-                ss << u8"    \"Key\": \"Gloam\",\n";
-                ss << u8"    \"enUS\": \"Gloam\",\n";
-                ss << u8"    \"zhTW\": \"薄暮鬼火\",\n";
-                ss << u8"    \"deDE\": \"Düsternis\",\n";
-                ss << u8"    \"esES\": \"Ocaso\",\n";
-                ss << u8"    \"frFR\": \"Crépuscule\",\n";
-                ss << u8"    \"itIT\": \"Bruma\",\n";
-                ss << u8"    \"koKR\": \"황혼의 영혼\",\n";
-                ss << u8"    \"plPL\": \"Błysk\",\n";
-                ss << u8"    \"esMX\": \"Crepuscular\",\n";
-                ss << u8"    \"jaJP\": \"グローム\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Fusco\",\n";
-                ss << u8"    \"ruRU\": \"Сумеречник\",\n";
-                ss << u8"    \"zhCN\": \"暮灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3073,\n";
-                ss << u8"    \"Key\": \"WarpedShaman\",\n";
-                ss << u8"    \"enUS\": \"Warped Shaman\",\n";
-                ss << u8"    \"zhTW\": \"扭曲薩滿\",\n";
-                ss << u8"    \"deDE\": \"Verdrehter Schamane\",\n";
-                ss << u8"    \"esES\": \"Chamán retorcido\",\n";
-                ss << u8"    \"frFR\": \"Chaman perverti\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Deforme\",\n";
-                ss << u8"    \"koKR\": \"뒤틀린 악마 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman spaczeńców\",\n";
-                ss << u8"    \"esMX\": \"Chamán retorcido\",\n";
-                ss << u8"    \"jaJP\": \"ウォープト・ワンの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Distorcido\",\n";
-                ss << u8"    \"ruRU\": \"Искаженный-шаман\",\n";
-                ss << u8"    \"zhCN\": \"扭曲魔萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3074,\n";
-                ss << u8"    \"Key\": \"DarkShaman\",\n";
-                ss << u8"    \"enUS\": \"Dark Shaman\",\n";
-                ss << u8"    \"zhTW\": \"暗黑薩滿\",\n";
-                ss << u8"    \"deDE\": \"Dunkler Schamane\",\n";
-                ss << u8"    \"esES\": \"Chamán oscuro\",\n";
-                ss << u8"    \"frFR\": \"Chaman sombre\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Oscuro\",\n";
-                ss << u8"    \"koKR\": \"어둠의 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman mrocznych\",\n";
-                ss << u8"    \"esMX\": \"Chamán oscuro\",\n";
-                ss << u8"    \"jaJP\": \"ダーク・ワンの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Trevoso\",\n";
-                ss << u8"    \"ruRU\": \"Темный-шаман\",\n";
-                ss << u8"    \"zhCN\": \"黑暗魔萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3075,\n";
-                ss << u8"    \"Key\": \"DevilkinShaman\",\n";
-                ss << u8"    \"enUS\": \"Devilkin Shaman\",\n";
-                ss << u8"    \"zhTW\": \"魔妖薩滿\",\n";
-                ss << u8"    \"deDE\": \"Teuflischer Schamane\",\n";
-                ss << u8"    \"esES\": \"Chamán diabólico\",\n";
-                ss << u8"    \"frFR\": \"Chaman démonoïde\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Malefico\",\n";
-                ss << u8"    \"koKR\": \"악마피붙이 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman diablików\",\n";
-                ss << u8"    \"esMX\": \"Chamán demonante\",\n";
-                ss << u8"    \"jaJP\": \"デビルキンの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Demonante\",\n";
-                ss << u8"    \"ruRU\": \"Дьяволенок-шаман\",\n";
-                ss << u8"    \"zhCN\": \"小恶魔萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3076,\n";
-                ss << u8"    \"Key\": \"CarverShaman\",\n";
-                ss << u8"    \"enUS\": \"Carver Shaman\",\n";
-                ss << u8"    \"zhTW\": \"刨肉薩滿\",\n";
-                ss << u8"    \"deDE\": \"Schlächterschamane\",\n";
-                ss << u8"    \"esES\": \"Chamán trinchante\",\n";
-                ss << u8"    \"frFR\": \"Chaman équarrisseur\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Incisore\",\n";
-                ss << u8"    \"koKR\": \"도륙자 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman wycinaczy\",\n";
-                ss << u8"    \"esMX\": \"Chamán tajador\",\n";
-                ss << u8"    \"jaJP\": \"カーヴァーの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Entalhador\",\n";
-                ss << u8"    \"ruRU\": \"Плоторез-шаман\",\n";
-                ss << u8"    \"zhCN\": \"利刃魔萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3077,\n";
-                ss << u8"    \"Key\": \"FallenShaman\",\n";
-                ss << u8"    \"enUS\": \"Fallen Shaman\",\n";
-                ss << u8"    \"zhTW\": \"沉淪魔薩滿\",\n";
-                ss << u8"    \"deDE\": \"Gefallener Schamane\",\n";
-                ss << u8"    \"esES\": \"Chamán caído\",\n";
-                ss << u8"    \"frFR\": \"Chaman déchu\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Caduto\",\n";
-                ss << u8"    \"koKR\": \"몰락자 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman upadłych\",\n";
-                ss << u8"    \"esMX\": \"Chamán caído\",\n";
-                ss << u8"    \"jaJP\": \"フォールンの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Decaído\",\n";
-                ss << u8"    \"ruRU\": \"Падший-шаман\",\n";
-                ss << u8"    \"zhCN\": \"沉沦魔萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3078,\n";
-                ss << u8"    \"Key\": \"WarpedFallen\",\n";
-                ss << u8"    \"enUS\": \"Warped One\",\n";
-                ss << u8"    \"zhTW\": \"扭曲沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Verdrehter\",\n";
-                ss << u8"    \"esES\": \"Retorcido\",\n";
-                ss << u8"    \"frFR\": \"Le Perverti\",\n";
-                ss << u8"    \"itIT\": \"Deforme\",\n";
-                ss << u8"    \"koKR\": \"뒤틀린 악마\",\n";
-                ss << u8"    \"plPL\": \"Spaczeniec\",\n";
-                ss << u8"    \"esMX\": \"Retorcido\",\n";
-                ss << u8"    \"jaJP\": \"ウォープト・ワン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Distorcido\",\n";
-                ss << u8"    \"ruRU\": \"Искаженный\",\n";
-                ss << u8"    \"zhCN\": \"扭曲魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3079,\n";
-                ss << u8"    \"Key\": \"DarkOne\",\n";
-                ss << u8"    \"enUS\": \"Dark One\",\n";
-                ss << u8"    \"zhTW\": \"暗黑沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Dunkle Kreatur\",\n";
-                ss << u8"    \"esES\": \"Oscuro\",\n";
-                ss << u8"    \"frFR\": \"Le Sombre\",\n";
-                ss << u8"    \"itIT\": \"Oscuro\",\n";
-                ss << u8"    \"koKR\": \"어둠의 악마\",\n";
-                ss << u8"    \"plPL\": \"Mroczny\",\n";
-                ss << u8"    \"esMX\": \"Oscuro\",\n";
-                ss << u8"    \"jaJP\": \"ダーク・ワン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Trevoso\",\n";
-                ss << u8"    \"ruRU\": \"Темный\",\n";
-                ss << u8"    \"zhCN\": \"暗魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3080,\n";
-                ss << u8"    \"Key\": \"Devilkin\",\n";
-                ss << u8"    \"enUS\": \"Devilkin\",\n";
-                ss << u8"    \"zhTW\": \"魔妖沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Teuflischer\",\n";
-                ss << u8"    \"esES\": \"Diabólico\",\n";
-                ss << u8"    \"frFR\": \"Démonoïde\",\n";
-                ss << u8"    \"itIT\": \"Malefico\",\n";
-                ss << u8"    \"koKR\": \"악마피붙이\",\n";
-                ss << u8"    \"plPL\": \"Diablik\",\n";
-                ss << u8"    \"esMX\": \"Demonante\",\n";
-                ss << u8"    \"jaJP\": \"デビルキン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Demonante\",\n";
-                ss << u8"    \"ruRU\": \"Дьяволенок\",\n";
-                ss << u8"    \"zhCN\": \"小恶魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3081,\n";
-                ss << u8"    \"Key\": \"Carver\",\n";
-                ss << u8"    \"enUS\": \"Carver\",\n";
-                ss << u8"    \"zhTW\": \"刨肉沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Schlächter\",\n";
-                ss << u8"    \"esES\": \"Trinchante\",\n";
-                ss << u8"    \"frFR\": \"Équarrisseur\",\n";
-                ss << u8"    \"itIT\": \"Incisore\",\n";
-                ss << u8"    \"koKR\": \"도륙자\",\n";
-                ss << u8"    \"plPL\": \"Wycinacz\",\n";
-                ss << u8"    \"esMX\": \"Tajador\",\n";
-                ss << u8"    \"jaJP\": \"カーヴァー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Entalhador\",\n";
-                ss << u8"    \"ruRU\": \"Плоторез\",\n";
-                ss << u8"    \"zhCN\": \"利刃魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3082,\n";
-                ss << u8"    \"Key\": \"Fallen\",\n";
-                ss << u8"    \"enUS\": \"Fallen\",\n";
-                ss << u8"    \"zhTW\": \"沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Gefallener\",\n";
-                ss << u8"    \"esES\": \"Caído\",\n";
-                ss << u8"    \"frFR\": \"Déchu\",\n";
-                ss << u8"    \"itIT\": \"Caduto\",\n";
-                ss << u8"    \"koKR\": \"몰락자\",\n";
-                ss << u8"    \"plPL\": \"Upadły\",\n";
-                ss << u8"    \"esMX\": \"Caído\",\n";
-                ss << u8"    \"jaJP\": \"フォールン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Decaído\",\n";
-                ss << u8"    \"ruRU\": \"Падший\",\n";
-                ss << u8"    \"zhCN\": \"沉沦魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3083,\n";
-                ss << u8"    \"Key\": \"ReturnedArcher\",\n";
-                ss << u8"    \"enUS\": \"Returned Archer\",\n";
-                ss << u8"    \"zhTW\": \"返世亡靈弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Zurückgekehrter Bogenschütze\",\n";
-                ss << u8"    \"esES\": \"Arquero retornado\",\n";
-                ss << u8"    \"frFR\": \"Archer ranimé\",\n";
-                ss << u8"    \"itIT\": \"Arciere Ritornato\",\n";
-                ss << u8"    \"koKR\": \"되돌아온 궁수\",\n";
-                ss << u8"    \"plPL\": \"Przywrócony łucznik\",\n";
-                ss << u8"    \"esMX\": \"Arquero retornado\",\n";
-                ss << u8"    \"jaJP\": \"リターンド・アーチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Arqueiro Retornado\",\n";
-                ss << u8"    \"ruRU\": \"Воскресший лучник\",\n";
-                ss << u8"    \"zhCN\": \"回魂弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3084,\n";
-                ss << u8"    \"Key\": \"HorrorArcher\",\n";
-                ss << u8"    \"enUS\": \"Horror Archer\",\n";
-                ss << u8"    \"zhTW\": \"恐骨弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Horrorbogenschütze\",\n";
-                ss << u8"    \"esES\": \"Arquero del horror\",\n";
-                ss << u8"    \"frFR\": \"Archer d’horreur\",\n";
-                ss << u8"    \"itIT\": \"Arciere dell'Orrore\",\n";
-                ss << u8"    \"koKR\": \"피바람 궁수\",\n";
-                ss << u8"    \"plPL\": \"Kościej łucznik\",\n";
-                ss << u8"    \"esMX\": \"Arquero tenebroso\",\n";
-                ss << u8"    \"jaJP\": \"ホラー・アーチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Horror Arqueiro\",\n";
-                ss << u8"    \"ruRU\": \"Лучник ужаса\",\n";
-                ss << u8"    \"zhCN\": \"恐怖骸骨弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3085,\n";
-                ss << u8"    \"Key\": \"BurningDeadArcher\",\n";
-                ss << u8"    \"enUS\": \"Burning Dead Archer\",\n";
-                ss << u8"    \"zhTW\": \"烈焰骷髏弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Bogenschütze der brennenden Toten\",\n";
-                ss << u8"    \"esES\": \"Arquero de la muerte ardiente\",\n";
-                ss << u8"    \"frFR\": \"Archer brûlé vif\",\n";
-                ss << u8"    \"itIT\": \"Arciere Fiammeggiante\",\n";
-                ss << u8"    \"koKR\": \"불타는 망자 궁수\",\n";
-                ss << u8"    \"plPL\": \"Płonący trupi łucznik\",\n";
-                ss << u8"    \"esMX\": \"Arquero muerto ardiente\",\n";
-                ss << u8"    \"jaJP\": \"バーニングデッド・アーチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Arqueiro Morto Flamejante\",\n";
-                ss << u8"    \"ruRU\": \"Горящий скелет-лучник\",\n";
-                ss << u8"    \"zhCN\": \"烈焰亡骨弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3086,\n";
-                ss << u8"    \"Key\": \"BoneArcher\",\n";
-                ss << u8"    \"enUS\": \"Bone Archer\",\n";
-                ss << u8"    \"zhTW\": \"骸骨弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Knochenbogenschütze\",\n";
-                ss << u8"    \"esES\": \"Arquero óseo\",\n";
-                ss << u8"    \"frFR\": \"Archer d’os\",\n";
-                ss << u8"    \"itIT\": \"Arciere d'Ossa\",\n";
-                ss << u8"    \"koKR\": \"뼈 궁수\",\n";
-                ss << u8"    \"plPL\": \"Kościany łucznik\",\n";
-                ss << u8"    \"esMX\": \"Arquero óseo\",\n";
-                ss << u8"    \"jaJP\": \"ボーン・アーチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Arqueiro Esquelético\",\n";
-                ss << u8"    \"ruRU\": \"Костяной лучник\",\n";
-                ss << u8"    \"zhCN\": \"白骨弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3087,\n";
-                ss << u8"    \"Key\": \"CorpseArcher\",\n";
-                ss << u8"    \"enUS\": \"Corpse Archer\",\n";
-                ss << u8"    \"zhTW\": \"屍骸弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Leichenbogenschütze\",\n";
-                ss << u8"    \"esES\": \"Arquero cadáver\",\n";
-                ss << u8"    \"frFR\": \"Archer cadavre\",\n";
-                ss << u8"    \"itIT\": \"Arciere Cadavere\",\n";
-                ss << u8"    \"koKR\": \"시체 궁수\",\n";
-                ss << u8"    \"plPL\": \"Trupi łucznik\",\n";
-                ss << u8"    \"esMX\": \"Arquera cadavérica\",\n";
-                ss << u8"    \"jaJP\": \"コープス・アーチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Arqueiro Cadáver\",\n";
-                ss << u8"    \"ruRU\": \"Труп-лучник\",\n";
-                ss << u8"    \"zhCN\": \"尸魔弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3088,\n";
-                ss << u8"    \"Key\": \"SkeletonArcher\",\n";
-                ss << u8"    \"enUS\": \"Skeleton Archer\",\n";
-                ss << u8"    \"zhTW\": \"骷髏弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Skelettbogenschütze\",\n";
-                ss << u8"    \"esES\": \"Arquero esqueleto\",\n";
-                ss << u8"    \"frFR\": \"Archer squelette\",\n";
-                ss << u8"    \"itIT\": \"Arciere Scheletrico\",\n";
-                ss << u8"    \"koKR\": \"해골 궁수\",\n";
-                ss << u8"    \"plPL\": \"Szkieletowy łucznik\",\n";
-                ss << u8"    \"esMX\": \"Arquero esquelético\",\n";
-                ss << u8"    \"jaJP\": \"スケルトン・アーチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Esqueleto Arqueiro\",\n";
-                ss << u8"    \"ruRU\": \"Скелет-лучник\",\n";
-                ss << u8"    \"zhCN\": \"骷髅弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3089,\n";
-                ss << u8"    \"Key\": \"FleshLancer\",\n";
-                ss << u8"    \"enUS\": \"Flesh Lancer\",\n";
-                ss << u8"    \"zhTW\": \"血肉長槍手\",\n";
-                ss << u8"    \"deDE\": \"Fleischlanzenträgerin\",\n";
-                ss << u8"    \"esES\": \"Lancera de la carne\",\n";
-                ss << u8"    \"frFR\": \"Lancière de chair\",\n";
-                ss << u8"    \"itIT\": \"Lanciera della Carne\",\n";
-                ss << u8"    \"koKR\": \"살점 장창병\",\n";
-                ss << u8"    \"plPL\": \"Wojowniczka trzewi\",\n";
-                ss << u8"    \"esMX\": \"Lancera carnal\",\n";
-                ss << u8"    \"jaJP\": \"血肉の槍兵\",\n";
-                ss << u8"    \"ptBR\": \"Lanceira Cárnea\",\n";
-                ss << u8"    \"ruRU\": \"Кровавая копейщица\",\n";
-                ss << u8"    \"zhCN\": \"血肉长枪手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3090,\n";
-                ss << u8"    \"Key\": \"BlackLancer\",\n";
-                ss << u8"    \"enUS\": \"Black Lancer\",\n";
-                ss << u8"    \"zhTW\": \"黑色長槍手\",\n";
-                ss << u8"    \"deDE\": \"Schwarze Lanzenträgerin\",\n";
-                ss << u8"    \"esES\": \"Lancera negra\",\n";
-                ss << u8"    \"frFR\": \"Lancière noire\",\n";
-                ss << u8"    \"itIT\": \"Lanciera Nera\",\n";
-                ss << u8"    \"koKR\": \"검은 장창병\",\n";
-                ss << u8"    \"plPL\": \"Czarna wojowniczka\",\n";
-                ss << u8"    \"esMX\": \"Lancera sombría\",\n";
-                ss << u8"    \"jaJP\": \"暗黒の槍兵\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Lanceira Tenebrosa\",\n";
-                ss << u8"    \"ruRU\": \"Черная копейщица\",\n";
-                ss << u8"    \"zhCN\": \"黑化长枪手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3091,\n";
-                ss << u8"    \"Key\": \"DarkLancer\",\n";
-                ss << u8"    \"enUS\": \"Dark Lancer\",\n";
-                ss << u8"    \"zhTW\": \"黑暗長槍手\",\n";
-                ss << u8"    \"deDE\": \"Dunkle Lanzenträgerin\",\n";
-                ss << u8"    \"esES\": \"Lancera de la oscuridad\",\n";
-                ss << u8"    \"frFR\": \"Lancière sombre\",\n";
-                ss << u8"    \"itIT\": \"Lanciera Oscura\",\n";
-                ss << u8"    \"koKR\": \"어둠의 장창병\",\n";
-                ss << u8"    \"plPL\": \"Mroczna wojowniczka\",\n";
-                ss << u8"    \"esMX\": \"Lancera oscura\",\n";
-                ss << u8"    \"jaJP\": \"闇の槍兵\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Lanceira Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Темная копейщица\",\n";
-                ss << u8"    \"zhCN\": \"黑暗长枪手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3092,\n";
-                ss << u8"    \"Key\": \"VileLancer\",\n";
-                ss << u8"    \"enUS\": \"Vile Lancer\",\n";
-                ss << u8"    \"zhTW\": \"兇邪長槍手\",\n";
-                ss << u8"    \"deDE\": \"Böse Lanzenträgerin\",\n";
-                ss << u8"    \"esES\": \"Lancera vil\",\n";
-                ss << u8"    \"frFR\": \"Lancière infâme\",\n";
-                ss << u8"    \"itIT\": \"Lanciera Vile\",\n";
-                ss << u8"    \"koKR\": \"끔찍한 장창병\",\n";
-                ss << u8"    \"plPL\": \"Nikczemna wojowniczka\",\n";
-                ss << u8"    \"esMX\": \"Lancera vil\",\n";
-                ss << u8"    \"jaJP\": \"穢れし槍兵\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Lanceira Vil\",\n";
-                ss << u8"    \"ruRU\": \"Злобная копейщица\",\n";
-                ss << u8"    \"zhCN\": \"邪恶长枪手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3093,\n";
-                ss << u8"    \"Key\": \"DarkSpearwoman\",\n";
-                ss << u8"    \"enUS\": \"Dark Spearwoman\",\n";
-                ss << u8"    \"zhTW\": \"黑暗女槍手\",\n";
-                ss << u8"    \"deDE\": \"Dunkle Speerträgerin\",\n";
-                ss << u8"    \"esES\": \"Piquera de la oscuridad\",\n";
-                ss << u8"    \"frFR\": \"Lancière des Ténèbres\",\n";
-                ss << u8"    \"itIT\": \"Impalatrice Oscura\",\n";
-                ss << u8"    \"koKR\": \"어둠의 창병\",\n";
-                ss << u8"    \"plPL\": \"Mroczna włóczniczka\",\n";
-                ss << u8"    \"esMX\": \"Lancera siniestra\",\n";
-                ss << u8"    \"jaJP\": \"闇の槍使い\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Lanceira Sinistra\",\n";
-                ss << u8"    \"ruRU\": \"Темная воительница\",\n";
-                ss << u8"    \"zhCN\": \"黑暗女矛手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3094,\n";
-                ss << u8"    \"Key\": \"FleshArcher\",\n";
-                ss << u8"    \"enUS\": \"Flesh Archer\",\n";
-                ss << u8"    \"zhTW\": \"血肉弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Fleischbogenschützin\",\n";
-                ss << u8"    \"esES\": \"Arquera de carne\",\n";
-                ss << u8"    \"frFR\": \"Archère de chair\",\n";
-                ss << u8"    \"itIT\": \"Arciera della Carne\",\n";
-                ss << u8"    \"koKR\": \"살점 궁수\",\n";
-                ss << u8"    \"plPL\": \"Łuczniczka trzewi\",\n";
-                ss << u8"    \"esMX\": \"Arquera carnal\",\n";
-                ss << u8"    \"jaJP\": \"血肉の弓使い\",\n";
-                ss << u8"    \"ptBR\": \"Arqueira Cárnea\",\n";
-                ss << u8"    \"ruRU\": \"Кровавая лучница\",\n";
-                ss << u8"    \"zhCN\": \"血肉弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3095,\n";
-                ss << u8"    \"Key\": \"BlackArcher\",\n";
-                ss << u8"    \"enUS\": \"Black Archer\",\n";
-                ss << u8"    \"zhTW\": \"黑色弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Schwarze Bogenschützin\",\n";
-                ss << u8"    \"esES\": \"Arquera negra\",\n";
-                ss << u8"    \"frFR\": \"Archère noire\",\n";
-                ss << u8"    \"itIT\": \"Arciera Nera\",\n";
-                ss << u8"    \"koKR\": \"검은 궁수\",\n";
-                ss << u8"    \"plPL\": \"Czarna łuczniczka\",\n";
-                ss << u8"    \"esMX\": \"Arquera sombría\",\n";
-                ss << u8"    \"jaJP\": \"暗黒の弓使い\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Arqueira Tenebrosa\",\n";
-                ss << u8"    \"ruRU\": \"Черная лучница\",\n";
-                ss << u8"    \"zhCN\": \"黑化弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3096,\n";
-                ss << u8"    \"Key\": \"DarkRanger\",\n";
-                ss << u8"    \"enUS\": \"Dark Ranger\",\n";
-                ss << u8"    \"zhTW\": \"黑暗遊俠\",\n";
-                ss << u8"    \"deDE\": \"Dunkle Waldläuferin\",\n";
-                ss << u8"    \"esES\": \"Guardabosques de la oscuridad\",\n";
-                ss << u8"    \"frFR\": \"Guerrière sombre\",\n";
-                ss << u8"    \"itIT\": \"Guardaboschi Oscura\",\n";
-                ss << u8"    \"koKR\": \"어둠의 순찰자\",\n";
-                ss << u8"    \"plPL\": \"Mroczna łowczyni\",\n";
-                ss << u8"    \"esMX\": \"Forestal oscura\",\n";
-                ss << u8"    \"jaJP\": \"闇の野伏り\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Patrulheira Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Темная разведчица\",\n";
-                ss << u8"    \"zhCN\": \"黑暗游侠\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3098,\n";
-                ss << u8"    \"Key\": \"DarkArcher\",\n";
-                ss << u8"    \"enUS\": \"Dark Archer\",\n";
-                ss << u8"    \"zhTW\": \"黑暗弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Dunkle Bogenschützin\",\n";
-                ss << u8"    \"esES\": \"Arquera de la oscuridad\",\n";
-                ss << u8"    \"frFR\": \"Archère sombre\",\n";
-                ss << u8"    \"itIT\": \"Arciera Oscura\",\n";
-                ss << u8"    \"koKR\": \"어둠의 궁수\",\n";
-                ss << u8"    \"plPL\": \"Mroczna łuczniczka\",\n";
-                ss << u8"    \"esMX\": \"Arquera oscura\",\n";
-                ss << u8"    \"jaJP\": \"闇の弓使い\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Arqueira Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Темная лучница\",\n";
-                ss << u8"    \"zhCN\": \"黑暗弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3099,\n";
-                ss << u8"    \"Key\": \"Summoner\",\n";
-                ss << u8"    \"enUS\": \"The Summoner\",\n";
-                ss << u8"    \"zhTW\": \"召喚師\",\n";
-                ss << u8"    \"deDE\": \"Der Geisterbeschwörer\",\n";
-                ss << u8"    \"esES\": \"El Invocador\",\n";
-                ss << u8"    \"frFR\": \"L’Invocateur\",\n";
-                ss << u8"    \"itIT\": \"L'Evocatore\",\n";
-                ss << u8"    \"koKR\": \"소환사\",\n";
-                ss << u8"    \"plPL\": \"Demonolog\",\n";
-                ss << u8"    \"esMX\": \"El Invocador\",\n";
-                ss << u8"    \"jaJP\": \"召喚師\",\n";
-                ss << u8"    \"ptBR\": \"O Evocador\",\n";
-                ss << u8"    \"ruRU\": \"Призыватель\",\n";
-                ss << u8"    \"zhCN\": \"召唤者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3100,\n";
-                ss << u8"    \"Key\": \"StygianDollShaman\",\n";
-                ss << u8"    \"enUS\": \"Stygian Doll Shaman\",\n";
-                ss << u8"    \"zhTW\": \"冥河鬼娃薩滿\",\n";
-                ss << u8"    \"deDE\": \"Stygischer Puppenschamane\",\n";
-                ss << u8"    \"esES\": \"Chamán muñeco estigio\",\n";
-                ss << u8"    \"frFR\": \"Chaman des poupées stygiennes\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Bambola dello Stige\",\n";
-                ss << u8"    \"koKR\": \"저승 꼭두각시 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman stygijczyków\",\n";
-                ss << u8"    \"esMX\": \"Chamán muñeco estigio\",\n";
-                ss << u8"    \"jaJP\": \"スティジャンドールの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Boneco Estígio\",\n";
-                ss << u8"    \"ruRU\": \"Стигийская кукла – шаман\",\n";
-                ss << u8"    \"zhCN\": \"冥河娃娃萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3101,\n";
-                ss << u8"    \"Key\": \"SoulKillerShaman\",\n";
-                ss << u8"    \"enUS\": \"Soul Killer Shaman\",\n";
-                ss << u8"    \"zhTW\": \"靈魂殺手薩滿\",\n";
-                ss << u8"    \"deDE\": \"Seelentöterschamane\",\n";
-                ss << u8"    \"esES\": \"Chamán asesino de almas\",\n";
-                ss << u8"    \"frFR\": \"Chaman tueur d’âmes\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Uccisore di Anime\",\n";
-                ss << u8"    \"koKR\": \"영혼살해자 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman zabójców dusz\",\n";
-                ss << u8"    \"esMX\": \"Chamán asesino de almas\",\n";
-                ss << u8"    \"jaJP\": \"ソウルキラーの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Mata-almas\",\n";
-                ss << u8"    \"ruRU\": \"Душегуб-шаман\",\n";
-                ss << u8"    \"zhCN\": \"灵魂杀手萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3102,\n";
-                ss << u8"    \"Key\": \"FlayerShaman\",\n";
-                ss << u8"    \"enUS\": \"Flayer Shaman\",\n";
-                ss << u8"    \"zhTW\": \"剝皮手薩滿\",\n";
-                ss << u8"    \"deDE\": \"Schinderschamane\",\n";
-                ss << u8"    \"esES\": \"Chamán desollador\",\n";
-                ss << u8"    \"frFR\": \"Chaman écorcheur\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Scorticatore\",\n";
-                ss << u8"    \"koKR\": \"약탈자 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman łupieżców\",\n";
-                ss << u8"    \"esMX\": \"Chamán desollador\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Esfolador\",\n";
-                ss << u8"    \"ruRU\": \"Свежеватель-шаман\",\n";
-                ss << u8"    \"zhCN\": \"剥皮魔萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3103,\n";
-                ss << u8"    \"Key\": \"FetishShaman\",\n";
-                ss << u8"    \"enUS\": \"Fetish Shaman\",\n";
-                ss << u8"    \"zhTW\": \"鬼娃薩滿\",\n";
-                ss << u8"    \"deDE\": \"Fetischschamane\",\n";
-                ss << u8"    \"esES\": \"Chamán fetiche\",\n";
-                ss << u8"    \"frFR\": \"Chaman féticheur\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Feticcio\",\n";
-                ss << u8"    \"koKR\": \"우상족 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman fetyszy\",\n";
-                ss << u8"    \"esMX\": \"Chamán fetiche\",\n";
-                ss << u8"    \"jaJP\": \"フェティッシュの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Carranco\",\n";
-                ss << u8"    \"ruRU\": \"Фетиш-шаман\",\n";
-                ss << u8"    \"zhCN\": \"鬼娃萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3104,\n";
-                ss << u8"    \"Key\": \"RatManShaman\",\n";
-                ss << u8"    \"enUS\": \"RatMan Shaman\",\n";
-                ss << u8"    \"zhTW\": \"鼠人薩滿\",\n";
-                ss << u8"    \"deDE\": \"Rattenmannschamane\",\n";
-                ss << u8"    \"esES\": \"Chamán hombre rata\",\n";
-                ss << u8"    \"frFR\": \"Chaman homme-rat\",\n";
-                ss << u8"    \"itIT\": \"Sciamano Uomo Ratto\",\n";
-                ss << u8"    \"koKR\": \"쥐 인간 영매\",\n";
-                ss << u8"    \"plPL\": \"Szaman szczuroczłeków\",\n";
-                ss << u8"    \"esMX\": \"Chamán ratonero\",\n";
-                ss << u8"    \"jaJP\": \"ラットマンの呪術師\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Xamã Homem-rato\",\n";
-                ss << u8"    \"ruRU\": \"Крысолюд-шаман\",\n";
-                ss << u8"    \"zhCN\": \"鼠人萨满\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3105,\n";
-                ss << u8"    \"Key\": \"HorrorMage\",\n";
-                ss << u8"    \"enUS\": \"Horror Mage\",\n";
-                ss << u8"    \"zhTW\": \"恐骨法師\",\n";
-                ss << u8"    \"deDE\": \"Horrormagier\",\n";
-                ss << u8"    \"esES\": \"Mago del horror\",\n";
-                ss << u8"    \"frFR\": \"Mage d’horreur\",\n";
-                ss << u8"    \"itIT\": \"Mago dell'Orrore\",\n";
-                ss << u8"    \"koKR\": \"피바람 마술사\",\n";
-                ss << u8"    \"plPL\": \"Kościej mag\",\n";
-                ss << u8"    \"esMX\": \"Mago tenebroso\",\n";
-                ss << u8"    \"jaJP\": \"ホラー・メイジ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Horror Mago\",\n";
-                ss << u8"    \"ruRU\": \"Маг ужаса\",\n";
-                ss << u8"    \"zhCN\": \"恐怖骸骨法师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3106,\n";
-                ss << u8"    \"Key\": \"BurningDeadMage\",\n";
-                ss << u8"    \"enUS\": \"Burning Dead Mage\",\n";
-                ss << u8"    \"zhTW\": \"烈焰骷髏法師\",\n";
-                ss << u8"    \"deDE\": \"Magier der brennenden Toten\",\n";
-                ss << u8"    \"esES\": \"Mago de la muerte ardiente\",\n";
-                ss << u8"    \"frFR\": \"Mage brûlé vif\",\n";
-                ss << u8"    \"itIT\": \"Mago Fiammeggiante\",\n";
-                ss << u8"    \"koKR\": \"불타는 망자 마술사\",\n";
-                ss << u8"    \"plPL\": \"Płonący trupi mag\",\n";
-                ss << u8"    \"esMX\": \"Mago muerto ardiente\",\n";
-                ss << u8"    \"jaJP\": \"バーニングデッド・メイジ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Mago Morto Flamejante\",\n";
-                ss << u8"    \"ruRU\": \"Горящий скелет-маг\",\n";
-                ss << u8"    \"zhCN\": \"烈焰亡骨法师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3107,\n";
-                ss << u8"    \"Key\": \"BoneMage\",\n";
-                ss << u8"    \"enUS\": \"Bone Mage\",\n";
-                ss << u8"    \"zhTW\": \"骸骨法師\",\n";
-                ss << u8"    \"deDE\": \"Knochenmagier\",\n";
-                ss << u8"    \"esES\": \"Mago óseo\",\n";
-                ss << u8"    \"frFR\": \"Mage d’os\",\n";
-                ss << u8"    \"itIT\": \"Mago d'Ossa\",\n";
-                ss << u8"    \"koKR\": \"뼈 마술사\",\n";
-                ss << u8"    \"plPL\": \"Kościany mag\",\n";
-                ss << u8"    \"esMX\": \"Mago óseo\",\n";
-                ss << u8"    \"jaJP\": \"ボーン・メイジ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Mago Esquelético\",\n";
-                ss << u8"    \"ruRU\": \"Костяной маг\",\n";
-                ss << u8"    \"zhCN\": \"白骨法师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3108,\n";
-                ss << u8"    \"Key\": \"CorpseMage\",\n";
-                ss << u8"    \"enUS\": \"Corpse Mage\",\n";
-                ss << u8"    \"zhTW\": \"死屍法師\",\n";
-                ss << u8"    \"deDE\": \"Leichenmagier\",\n";
-                ss << u8"    \"esES\": \"Mago cadáver\",\n";
-                ss << u8"    \"frFR\": \"Mage cadavre\",\n";
-                ss << u8"    \"itIT\": \"Mago Cadavere\",\n";
-                ss << u8"    \"koKR\": \"시체 마술사\",\n";
-                ss << u8"    \"plPL\": \"Trupi mag\",\n";
-                ss << u8"    \"esMX\": \"Mago cadavérico\",\n";
-                ss << u8"    \"jaJP\": \"コープス・メイジ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Mago Cadáver\",\n";
-                ss << u8"    \"ruRU\": \"Труп-маг\",\n";
-                ss << u8"    \"zhCN\": \"尸魔法师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3109,\n";
-                ss << u8"    \"Key\": \"ReturnedMage\",\n";
-                ss << u8"    \"enUS\": \"Returned Mage\",\n";
-                ss << u8"    \"zhTW\": \"返世亡靈法師\",\n";
-                ss << u8"    \"deDE\": \"Zurückgekehrter Magier\",\n";
-                ss << u8"    \"esES\": \"Mago retornado\",\n";
-                ss << u8"    \"frFR\": \"Mage ranimé\",\n";
-                ss << u8"    \"itIT\": \"Mago Ritornato\",\n";
-                ss << u8"    \"koKR\": \"되돌아온 마술사\",\n";
-                ss << u8"    \"plPL\": \"Przywrócony mag\",\n";
-                ss << u8"    \"esMX\": \"Mago retornado\",\n";
-                ss << u8"    \"jaJP\": \"リターンド・メイジ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Mago Retornado\",\n";
-                ss << u8"    \"ruRU\": \"Воскресший маг\",\n";
-                ss << u8"    \"zhCN\": \"回魂法师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3110,\n";
-                ss << u8"    \"Key\": \"GargoyleTrap\",\n";
-                ss << u8"    \"enUS\": \"Gargoyle Trap\",\n";
-                ss << u8"    \"zhTW\": \"石像鬼陷阱\",\n";
-                ss << u8"    \"deDE\": \"Gargoylefalle\",\n";
-                ss << u8"    \"esES\": \"Trampa de gárgolas\",\n";
-                ss << u8"    \"frFR\": \"Piège à gargouille\",\n";
-                ss << u8"    \"itIT\": \"Trappola Gargoyle\",\n";
-                ss << u8"    \"koKR\": \"가고일 덫\",\n";
-                ss << u8"    \"plPL\": \"Gargulcowa pułapka\",\n";
-                ss << u8"    \"esMX\": \"Trampa de gárgola\",\n";
-                ss << u8"    \"jaJP\": \"ガーゴイル・トラップ\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Armadilha da Gárgula\",\n";
-                ss << u8"    \"ruRU\": \"Ловушка-горгулья\",\n";
-                ss << u8"    \"zhCN\": \"石像鬼陷阱\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3111,\n";
-                ss << u8"    \"Key\": \"Bloodraven\",\n";
-                ss << u8"    \"enUS\": \"Blood Raven\",\n";
-                ss << u8"    \"zhTW\": \"血鴉\",\n";
-                ss << u8"    \"deDE\": \"Blutrabe\",\n";
-                ss << u8"    \"esES\": \"Cuervo Sangriento\",\n";
-                ss << u8"    \"frFR\": \"Blood Raven\",\n";
-                ss << u8"    \"itIT\": \"Corvo Vermiglio\",\n";
-                ss << u8"    \"koKR\": \"핏빛 큰까마귀\",\n";
-                ss << u8"    \"plPL\": \"Krwawa Orlica\",\n";
-                ss << u8"    \"esMX\": \"Cuervo Sangriento\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・レイヴン\",\n";
-                ss << u8"    \"ptBR\": \"Rapina Sangrenta\",\n";
-                ss << u8"    \"ruRU\": \"Кровавый Ворон\",\n";
-                ss << u8"    \"zhCN\": \"血鸦\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3115,\n";
-                ss << u8"    \"Key\": \"StygianWatcherHead\",\n";
-                ss << u8"    \"enUS\": \"Stygian Watcher\",\n";
-                ss << u8"    \"zhTW\": \"冥河水怪\",\n";
-                ss << u8"    \"deDE\": \"Stygischer Wächter\",\n";
-                ss << u8"    \"esES\": \"Vigía estigio\",\n";
-                ss << u8"    \"frFR\": \"Garde stygien\",\n";
-                ss << u8"    \"itIT\": \"Custode dello Stige\",\n";
-                ss << u8"    \"koKR\": \"저승 감시자\",\n";
-                ss << u8"    \"plPL\": \"Stygijski strażnik\",\n";
-                ss << u8"    \"esMX\": \"Vigía estigio\",\n";
-                ss << u8"    \"jaJP\": \"スティジャン・ウォッチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Vigia Estígio\",\n";
-                ss << u8"    \"ruRU\": \"Стигийский наблюдатель\",\n";
-                ss << u8"    \"zhCN\": \"冥河看守水怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3116,\n";
-                ss << u8"    \"Key\": \"RiverStalkerHead\",\n";
-                ss << u8"    \"enUS\": \"River Stalker\",\n";
-                ss << u8"    \"zhTW\": \"河流水怪\",\n";
-                ss << u8"    \"deDE\": \"Flussschleicher\",\n";
-                ss << u8"    \"esES\": \"Acechador del río\",\n";
-                ss << u8"    \"frFR\": \"Vagabond des rivières\",\n";
-                ss << u8"    \"itIT\": \"Predatore dei Fiumi\",\n";
-                ss << u8"    \"koKR\": \"강 추적자\",\n";
-                ss << u8"    \"plPL\": \"Wąż rzeczny\",\n";
-                ss << u8"    \"esMX\": \"Acechador fluvial\",\n";
-                ss << u8"    \"jaJP\": \"リバー・ストーカー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Perseguidor Fluvial\",\n";
-                ss << u8"    \"ruRU\": \"Речной охотник\",\n";
-                ss << u8"    \"zhCN\": \"潜河水怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3117,\n";
-                ss << u8"    \"Key\": \"WaterWatcherHead\",\n";
-                ss << u8"    \"enUS\": \"Water Watcher\",\n";
-                ss << u8"    \"zhTW\": \"水坑水怪\",\n";
-                ss << u8"    \"deDE\": \"Wasserwächter\",\n";
-                ss << u8"    \"esES\": \"Vigía del agua\",\n";
-                ss << u8"    \"frFR\": \"Gardien des eaux\",\n";
-                ss << u8"    \"itIT\": \"Custode delle Acque\",\n";
-                ss << u8"    \"koKR\": \"물길 망꾼\",\n";
-                ss << u8"    \"plPL\": \"Czerw wodny\",\n";
-                ss << u8"    \"esMX\": \"Vigía acuático\",\n";
-                ss << u8"    \"jaJP\": \"ウォーター・ウォッチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Vigia Aquático\",\n";
-                ss << u8"    \"ruRU\": \"Водяной страж\",\n";
-                ss << u8"    \"zhCN\": \"水域看守水怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3118,\n";
-                ss << u8"    \"Key\": \"StygianWatcherLimb\",\n";
-                ss << u8"    \"enUS\": \"Stygian Watcher\",\n";
-                ss << u8"    \"zhTW\": \"冥河水怪\",\n";
-                ss << u8"    \"deDE\": \"Stygischer Wächter\",\n";
-                ss << u8"    \"esES\": \"Vigía estigio\",\n";
-                ss << u8"    \"frFR\": \"Garde stygien\",\n";
-                ss << u8"    \"itIT\": \"Custode dello Stige\",\n";
-                ss << u8"    \"koKR\": \"저승 감시자\",\n";
-                ss << u8"    \"plPL\": \"Stygijski strażnik\",\n";
-                ss << u8"    \"esMX\": \"Vigía estigio\",\n";
-                ss << u8"    \"jaJP\": \"スティジャン・ウォッチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Vigia Estígio\",\n";
-                ss << u8"    \"ruRU\": \"Стигийский наблюдатель\",\n";
-                ss << u8"    \"zhCN\": \"冥河看守水怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3119,\n";
-                ss << u8"    \"Key\": \"RiverStalkerLimb\",\n";
-                ss << u8"    \"enUS\": \"River Stalker\",\n";
-                ss << u8"    \"zhTW\": \"河流水怪\",\n";
-                ss << u8"    \"deDE\": \"Flussschleiche\",\n";
-                ss << u8"    \"esES\": \"Acechador del río\",\n";
-                ss << u8"    \"frFR\": \"Vagabond des rivières\",\n";
-                ss << u8"    \"itIT\": \"Predatore dei Fiumi\",\n";
-                ss << u8"    \"koKR\": \"강 추적자\",\n";
-                ss << u8"    \"plPL\": \"Wąż rzeczny\",\n";
-                ss << u8"    \"esMX\": \"Acechador fluvial\",\n";
-                ss << u8"    \"jaJP\": \"リバー・ストーカー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Perseguidor Fluvial\",\n";
-                ss << u8"    \"ruRU\": \"Речной охотник\",\n";
-                ss << u8"    \"zhCN\": \"潜河水怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3120,\n";
-                ss << u8"    \"Key\": \"WaterWatcherLimb\",\n";
-                ss << u8"    \"enUS\": \"Water Watcher\",\n";
-                ss << u8"    \"zhTW\": \"水坑水怪\",\n";
-                ss << u8"    \"deDE\": \"Wasserwächter\",\n";
-                ss << u8"    \"esES\": \"Vigía del agua\",\n";
-                ss << u8"    \"frFR\": \"Gardien des eaux\",\n";
-                ss << u8"    \"itIT\": \"Custode delle Acque\",\n";
-                ss << u8"    \"koKR\": \"물길 망꾼\",\n";
-                ss << u8"    \"plPL\": \"Czerw wodny\",\n";
-                ss << u8"    \"esMX\": \"Vigía acuático\",\n";
-                ss << u8"    \"jaJP\": \"ウォーター・ウォッチャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Vigia Aquático\",\n";
-                ss << u8"    \"ruRU\": \"Водяной страж\",\n";
-                ss << u8"    \"zhCN\": \"水域看守水怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3121,\n";
-                ss << u8"    \"Key\": \"NightMarauder\",\n";
-                ss << u8"    \"enUS\": \"Night Marauder\",\n";
-                ss << u8"    \"zhTW\": \"暗夜掠奪者\",\n";
-                ss << u8"    \"deDE\": \"Nachtplünderer\",\n";
-                ss << u8"    \"esES\": \"Maleante de la noche\",\n";
-                ss << u8"    \"frFR\": \"Maraudeur de la nuit\",\n";
-                ss << u8"    \"itIT\": \"Predone della Notte\",\n";
-                ss << u8"    \"koKR\": \"밤의 습격자\",\n";
-                ss << u8"    \"plPL\": \"Nocny maruder\",\n";
-                ss << u8"    \"esMX\": \"Merodeador nocturno\",\n";
-                ss << u8"    \"jaJP\": \"ナイト・マローダー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Saqueador Noturno\",\n";
-                ss << u8"    \"ruRU\": \"Ночной мародер\",\n";
-                ss << u8"    \"zhCN\": \"黑夜掠夺者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3126,\n";
-                ss << u8"    \"Key\": \"WorldKillerQueen\",\n";
-                ss << u8"    \"enUS\": \"Blood Maggot Queen\",\n";
-                ss << u8"    \"zhTW\": \"鮮血蛆蟲之后\",\n";
-                ss << u8"    \"deDE\": \"Blutwurmkönigin\",\n";
-                ss << u8"    \"esES\": \"Reina de los gusanos de sangre\",\n";
-                ss << u8"    \"frFR\": \"Reine des asticots de sang\",\n";
-                ss << u8"    \"itIT\": \"Larva del Sangue Regina\",\n";
-                ss << u8"    \"koKR\": \"피 구더기 여왕\",\n";
-                ss << u8"    \"plPL\": \"Królowa krwiożerczych larw\",\n";
-                ss << u8"    \"esMX\": \"Reina de las cresas de sangre\",\n";
-                ss << u8"    \"jaJP\": \"血濡れた地虫の女王\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Rainha Verme Sangrenta\",\n";
-                ss << u8"    \"ruRU\": \"Королева кровавых мокриц\",\n";
-                ss << u8"    \"zhCN\": \"血虫后\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3127,\n";
-                ss << u8"    \"Key\": \"GiantLampreyQueen\",\n";
-                ss << u8"    \"enUS\": \"Giant Lamprey Queen\",\n";
-                ss << u8"    \"zhTW\": \"吸血巨蟲之后\",\n";
-                ss << u8"    \"deDE\": \"Riesenmuränenkönigin\",\n";
-                ss << u8"    \"esES\": \"Reina de las lampreas gigantes\",\n";
-                ss << u8"    \"frFR\": \"Reines des lamproies géantes\",\n";
-                ss << u8"    \"itIT\": \"Lampreda Gigante Regina\",\n";
-                ss << u8"    \"koKR\": \"거대 빨판구더기 여왕\",\n";
-                ss << u8"    \"plPL\": \"Królowa skolopendromorfów\",\n";
-                ss << u8"    \"esMX\": \"Reina de las lampreas gigantes\",\n";
-                ss << u8"    \"jaJP\": \"吸血地虫の女王\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Rainha Lampreia Gigante\",\n";
-                ss << u8"    \"ruRU\": \"Королева гигантских жужелиц\",\n";
-                ss << u8"    \"zhCN\": \"巨型八目虫后\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3128,\n";
-                ss << u8"    \"Key\": \"DevourerQueen\",\n";
-                ss << u8"    \"enUS\": \"Devourer Queen\",\n";
-                ss << u8"    \"zhTW\": \"吞噬者之后\",\n";
-                ss << u8"    \"deDE\": \"Verschlingerkönigin\",\n";
-                ss << u8"    \"esES\": \"Reina de los devoradores\",\n";
-                ss << u8"    \"frFR\": \"Reine des dévoreurs\",\n";
-                ss << u8"    \"itIT\": \"Divoratore Regina\",\n";
-                ss << u8"    \"koKR\": \"걸신구더기 여왕\",\n";
-                ss << u8"    \"plPL\": \"Królowa pożeraczy\",\n";
-                ss << u8"    \"esMX\": \"Reina de los devoradores\",\n";
-                ss << u8"    \"jaJP\": \"貪る地虫の女王\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Rainha Devoradora\",\n";
-                ss << u8"    \"ruRU\": \"Королева пожирателей\",\n";
-                ss << u8"    \"zhCN\": \"吞食虫后\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3129,\n";
-                ss << u8"    \"Key\": \"RockWormQueen\",\n";
-                ss << u8"    \"enUS\": \"Rock Worm Queen\",\n";
-                ss << u8"    \"zhTW\": \"鑽岩蛆蟲之后\",\n";
-                ss << u8"    \"deDE\": \"Felswurmkönigin\",\n";
-                ss << u8"    \"esES\": \"Reina de los gusanos de roca\",\n";
-                ss << u8"    \"frFR\": \"Reine des vers des roches\",\n";
-                ss << u8"    \"itIT\": \"Verme di Roccia Regina\",\n";
-                ss << u8"    \"koKR\": \"바위 벌레 여왕\",\n";
-                ss << u8"    \"plPL\": \"Królowa skalnych robaków\",\n";
-                ss << u8"    \"esMX\": \"Reina de los gusanos de piedra\",\n";
-                ss << u8"    \"jaJP\": \"岩棲みの地虫の女王\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Rainha Verme Rochosa\",\n";
-                ss << u8"    \"ruRU\": \"Королева каменных червей\",\n";
-                ss << u8"    \"zhCN\": \"岩虫后\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3130,\n";
-                ss << u8"    \"Key\": \"SandMaggotQueen\",\n";
-                ss << u8"    \"enUS\": \"Sand Maggot Queen\",\n";
-                ss << u8"    \"zhTW\": \"沙漠蛆蟲之后\",\n";
-                ss << u8"    \"deDE\": \"Sandwurmkönigin\",\n";
-                ss << u8"    \"esES\": \"Reina de los gusanos de arena\",\n";
-                ss << u8"    \"frFR\": \"Reine des asticots des sables\",\n";
-                ss << u8"    \"itIT\": \"Larva della Sabbia Regina\",\n";
-                ss << u8"    \"koKR\": \"모래 구더기 여왕\",\n";
-                ss << u8"    \"plPL\": \"Królowa piaseczników\",\n";
-                ss << u8"    \"esMX\": \"Reina de las cresas de arena\",\n";
-                ss << u8"    \"jaJP\": \"砂漠の地虫の女王\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Rainha Verme Arenosa\",\n";
-                ss << u8"    \"ruRU\": \"Королева песчаных мокриц\",\n";
-                ss << u8"    \"zhCN\": \"沙虫后\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3131,\n";
-                ss << u8"    \"Key\": \"Slime Prince\",\n";
-                ss << u8"    \"enUS\": \"Slime Prince\",\n";
-                ss << u8"    \"zhTW\": \"黏液蛙王\",\n";
-                ss << u8"    \"deDE\": \"Schleimprinz\",\n";
-                ss << u8"    \"esES\": \"Príncipe del cieno\",\n";
-                ss << u8"    \"frFR\": \"Prince de la Fange\",\n";
-                ss << u8"    \"itIT\": \"Principe della Melma\",\n";
-                ss << u8"    \"koKR\": \"점액 개구리\",\n";
-                ss << u8"    \"plPL\": \"Książę szlamu\",\n";
-                ss << u8"    \"esMX\": \"Príncipe limoso\",\n";
-                ss << u8"    \"jaJP\": \"粘液ガエル\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Príncipe Viscoso\",\n";
-                ss << u8"    \"ruRU\": \"Хозяин тины\",\n";
-                ss << u8"    \"zhCN\": \"涎液蛙魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3132,\n";
-                ss << u8"    \"Key\": \"Bog Creature\",\n";
-                ss << u8"    \"enUS\": \"Bog Creature\",\n";
-                ss << u8"    \"zhTW\": \"泥沼魔蛙\",\n";
-                ss << u8"    \"deDE\": \"Schlammkreatur\",\n";
-                ss << u8"    \"esES\": \"Criatura del pantano\",\n";
-                ss << u8"    \"frFR\": \"Créature des marais\",\n";
-                ss << u8"    \"itIT\": \"Creatura della Palude\",\n";
-                ss << u8"    \"koKR\": \"수렁 괴물\",\n";
-                ss << u8"    \"plPL\": \"Stwór z bagien\",\n";
-                ss << u8"    \"esMX\": \"Criatura de la ciénaga\",\n";
-                ss << u8"    \"jaJP\": \"沼地の魔物\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Criatura do Pântano\",\n";
-                ss << u8"    \"ruRU\": \"Болотная тварь\",\n";
-                ss << u8"    \"zhCN\": \"泥塘蛙魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3133,\n";
-                ss << u8"    \"Key\": \"Swamp Dweller\",\n";
-                ss << u8"    \"enUS\": \"Swamp Dweller\",\n";
-                ss << u8"    \"zhTW\": \"沼澤魔蛙\",\n";
-                ss << u8"    \"deDE\": \"Sumpfbewohner\",\n";
-                ss << u8"    \"esES\": \"Morador del pantano\",\n";
-                ss << u8"    \"frFR\": \"Habitant des marais\",\n";
-                ss << u8"    \"itIT\": \"Abitante degli Acquitrini\",\n";
-                ss << u8"    \"koKR\": \"늪 괴수\",\n";
-                ss << u8"    \"plPL\": \"Mieszkaniec bagna\",\n";
-                ss << u8"    \"esMX\": \"Morador del pantano\",\n";
-                ss << u8"    \"jaJP\": \"沼棲み\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Habitante do Pântano\",\n";
-                ss << u8"    \"ruRU\": \"Обитатель болот\",\n";
-                ss << u8"    \"zhCN\": \"沼泽蛙魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3134,\n";
-                ss << u8"    \"Key\": \"GiantUrchin\",\n";
-                ss << u8"    \"enUS\": \"Barbed Giant\",\n";
-                ss << u8"    \"zhTW\": \"倒刺巨獸\",\n";
-                ss << u8"    \"deDE\": \"Stachelriese\",\n";
-                ss << u8"    \"esES\": \"Gigante de púas\",\n";
-                ss << u8"    \"frFR\": \"Géant barbu\",\n";
-                ss << u8"    \"itIT\": \"Gigante Barbuto\",\n";
-                ss << u8"    \"koKR\": \"미늘 돋친 괴물\",\n";
-                ss << u8"    \"plPL\": \"Ciernisty gigant\",\n";
-                ss << u8"    \"esMX\": \"Gigante punzante\",\n";
-                ss << u8"    \"jaJP\": \"バーブド・ジャイアント\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Gigante Farpado\",\n";
-                ss << u8"    \"ruRU\": \"Колючий великан\",\n";
-                ss << u8"    \"zhCN\": \"勾刺巨人\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3135,\n";
-                ss << u8"    \"Key\": \"RazorBeast\",\n";
-                ss << u8"    \"enUS\": \"Razor Beast\",\n";
-                ss << u8"    \"zhTW\": \"剃刀獸\",\n";
-                ss << u8"    \"deDE\": \"Klingenbestie\",\n";
-                ss << u8"    \"esES\": \"Bestia afilada\",\n";
-                ss << u8"    \"frFR\": \"Bête tranchante\",\n";
-                ss << u8"    \"itIT\": \"Bestia Rasoio\",\n";
-                ss << u8"    \"koKR\": \"서슬 야수\",\n";
-                ss << u8"    \"plPL\": \"Brzytwobestia\",\n";
-                ss << u8"    \"esMX\": \"Bestia de navajas\",\n";
-                ss << u8"    \"jaJP\": \"レイザー・ビースト\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Fera-navalha\",\n";
-                ss << u8"    \"ruRU\": \"Бритвенный зверь\",\n";
-                ss << u8"    \"zhCN\": \"剃刀兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3136,\n";
-                ss << u8"    \"Key\": \"ThornBrute\",\n";
-                ss << u8"    \"enUS\": \"Thorn Brute\",\n";
-                ss << u8"    \"zhTW\": \"棘刺獸\",\n";
-                ss << u8"    \"deDE\": \"Dornenuntier\",\n";
-                ss << u8"    \"esES\": \"Animal de espinas\",\n";
-                ss << u8"    \"frFR\": \"Brute à épines\",\n";
-                ss << u8"    \"itIT\": \"Bruto Spinoso\",\n";
-                ss << u8"    \"koKR\": \"가시 짐승\",\n";
-                ss << u8"    \"plPL\": \"Cierniowe monstrum\",\n";
-                ss << u8"    \"esMX\": \"Bruto espinoso\",\n";
-                ss << u8"    \"jaJP\": \"ソーン・ブルート\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Bruto Espinhoso\",\n";
-                ss << u8"    \"ruRU\": \"Шипастый изверг\",\n";
-                ss << u8"    \"zhCN\": \"荆棘蛮兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3137,\n";
-                ss << u8"    \"Key\": \"SpikeGiant\",\n";
-                ss << u8"    \"enUS\": \"Spike Giant\",\n";
-                ss << u8"    \"zhTW\": \"尖釘巨獸\",\n";
-                ss << u8"    \"deDE\": \"Dornenriese\",\n";
-                ss << u8"    \"esES\": \"Gigante con pinchos\",\n";
-                ss << u8"    \"frFR\": \"Géant à pointes\",\n";
-                ss << u8"    \"itIT\": \"Gigante Spinoso\",\n";
-                ss << u8"    \"koKR\": \"쐐기 돋친 괴물\",\n";
-                ss << u8"    \"plPL\": \"Kolczasty gigant\",\n";
-                ss << u8"    \"esMX\": \"Gigante espinoso\",\n";
-                ss << u8"    \"jaJP\": \"スパイク・ジャイアント\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Gigante Espinhoso\",\n";
-                ss << u8"    \"ruRU\": \"Шипастый великан\",\n";
-                ss << u8"    \"zhCN\": \"尖刺巨人\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3138,\n";
-                ss << u8"    \"Key\": \"QuillBear\",\n";
-                ss << u8"    \"enUS\": \"Quill Bear\",\n";
-                ss << u8"    \"zhTW\": \"刺熊怪\",\n";
-                ss << u8"    \"deDE\": \"Stachelbär\",\n";
-                ss << u8"    \"esES\": \"Oso con cálamos\",\n";
-                ss << u8"    \"frFR\": \"Ours à piquants\",\n";
-                ss << u8"    \"itIT\": \"Orsospino\",\n";
-                ss << u8"    \"koKR\": \"가시 곰\",\n";
-                ss << u8"    \"plPL\": \"Kolczasty niedźwiedź\",\n";
-                ss << u8"    \"esMX\": \"Oso crampón\",\n";
-                ss << u8"    \"jaJP\": \"クィル・ベアー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Urso-ouriço\",\n";
-                ss << u8"    \"ruRU\": \"Шипастый медведь\",\n";
-                ss << u8"    \"zhCN\": \"刺脊熊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3139,\n";
-                ss << u8"    \"Key\": \"Council Member\",\n";
-                ss << u8"    \"enUS\": \"Council Member\",\n";
-                ss << u8"    \"zhTW\": \"議會成員\",\n";
-                ss << u8"    \"deDE\": \"Ratsmitglied\",\n";
-                ss << u8"    \"esES\": \"Miembro del consejo\",\n";
-                ss << u8"    \"frFR\": \"Membre du conseil\",\n";
-                ss << u8"    \"itIT\": \"Membro del Concilio\",\n";
-                ss << u8"    \"koKR\": \"의회원\",\n";
-                ss << u8"    \"plPL\": \"Członek Rady\",\n";
-                ss << u8"    \"esMX\": \"Miembro del concilio\",\n";
-                ss << u8"    \"jaJP\": \"評議会員\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Membro do Conselho\",\n";
-                ss << u8"    \"ruRU\": \"Советник\",\n";
-                ss << u8"    \"zhCN\": \"理事会成员\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3140,\n";
-                ss << u8"    \"Key\": \"youngdiablo\",\n";
-                ss << u8"    \"enUS\": \"Dark Wanderer\",\n";
-                ss << u8"    \"zhTW\": \"黑暗流浪者\",\n";
-                ss << u8"    \"deDE\": \"Dunkler Wanderer\",\n";
-                ss << u8"    \"esES\": \"Vagabundo oscuro\",\n";
-                ss << u8"    \"frFR\": \"Rôdeur noir\",\n";
-                ss << u8"    \"itIT\": \"Oscuro Viandante\",\n";
-                ss << u8"    \"koKR\": \"어둠의 방랑자\",\n";
-                ss << u8"    \"plPL\": \"Mroczny Wędrowiec\",\n";
-                ss << u8"    \"esMX\": \"Errante oscuro\",\n";
-                ss << u8"    \"jaJP\": \"黒衣の放浪者\",\n";
-                ss << u8"    \"ptBR\": \"Errante Sombrio\",\n";
-                ss << u8"    \"ruRU\": \"Темный Странник\",\n";
-                ss << u8"    \"zhCN\": \"黑暗流浪者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3141,\n";
-                ss << u8"    \"Key\": \"darkwanderer\",\n";
-                ss << u8"    \"enUS\": \"Dark Wanderer\",\n";
-                ss << u8"    \"zhTW\": \"黑暗流浪者\",\n";
-                ss << u8"    \"deDE\": \"Dunkler Wanderer\",\n";
-                ss << u8"    \"esES\": \"Vagabundo oscuro\",\n";
-                ss << u8"    \"frFR\": \"Rôdeur noir\",\n";
-                ss << u8"    \"itIT\": \"Oscuro Viandante\",\n";
-                ss << u8"    \"koKR\": \"어둠의 방랑자\",\n";
-                ss << u8"    \"plPL\": \"Mroczny Wędrowiec\",\n";
-                ss << u8"    \"esMX\": \"Errante oscuro\",\n";
-                ss << u8"    \"jaJP\": \"黒衣の放浪者\",\n";
-                ss << u8"    \"ptBR\": \"Errante Sombrio\",\n";
-                ss << u8"    \"ruRU\": \"Темный Странник\",\n";
-                ss << u8"    \"zhCN\": \"黑暗流浪者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3142,\n";
-                ss << u8"    \"Key\": \"HellSlinger\",\n";
-                ss << u8"    \"enUS\": \"Hell Slinger\",\n";
-                ss << u8"    \"zhTW\": \"地獄投擲者\",\n";
-                ss << u8"    \"deDE\": \"Höllenschleuderer\",\n";
-                ss << u8"    \"esES\": \"Tirador infernal\",\n";
-                ss << u8"    \"frFR\": \"Frondeur des Enfers\",\n";
-                ss << u8"    \"itIT\": \"Lanciatore Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥 덫팔매\",\n";
-                ss << u8"    \"plPL\": \"Piekielny miotacz\",\n";
-                ss << u8"    \"esMX\": \"Hondero infernal\",\n";
-                ss << u8"    \"jaJP\": \"ヘル・スリンガー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lançador Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Адская пращница\",\n";
-                ss << u8"    \"zhCN\": \"地狱投枪手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3143,\n";
-                ss << u8"    \"Key\": \"NightSlinger\",\n";
-                ss << u8"    \"enUS\": \"Night Slinger\",\n";
-                ss << u8"    \"zhTW\": \"暗夜投擲者\",\n";
-                ss << u8"    \"deDE\": \"Nachtschleuderer\",\n";
-                ss << u8"    \"esES\": \"Tirador nocturno\",\n";
-                ss << u8"    \"frFR\": \"Frondeur de la nuit\",\n";
-                ss << u8"    \"itIT\": \"Lanciatore Notturno\",\n";
-                ss << u8"    \"koKR\": \"밤의 덫팔매\",\n";
-                ss << u8"    \"plPL\": \"Nocny miotacz\",\n";
-                ss << u8"    \"esMX\": \"Hondero nocturno\",\n";
-                ss << u8"    \"jaJP\": \"ナイト・スリンガー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lançador Noturno\",\n";
-                ss << u8"    \"ruRU\": \"Ночная пращница\",\n";
-                ss << u8"    \"zhCN\": \"夜幕投枪手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3144,\n";
-                ss << u8"    \"Key\": \"SpearCat\",\n";
-                ss << u8"    \"enUS\": \"Spear Cat\",\n";
-                ss << u8"    \"zhTW\": \"標槍拉庫尼\",\n";
-                ss << u8"    \"deDE\": \"Speerkatze\",\n";
-                ss << u8"    \"esES\": \"Gato lanza\",\n";
-                ss << u8"    \"frFR\": \"Chat harponneur\",\n";
-                ss << u8"    \"itIT\": \"Felino Lanciatore\",\n";
-                ss << u8"    \"koKR\": \"창 고양이\",\n";
-                ss << u8"    \"plPL\": \"Kotołak\",\n";
-                ss << u8"    \"esMX\": \"Gato lancero\",\n";
-                ss << u8"    \"jaJP\": \"スピア・キャット\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Felino Lanceiro\",\n";
-                ss << u8"    \"ruRU\": \"Кошка-копейщица\",\n";
-                ss << u8"    \"zhCN\": \"投枪猫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3145,\n";
-                ss << u8"    \"Key\": \"Slinger\",\n";
-                ss << u8"    \"enUS\": \"Slinger\",\n";
-                ss << u8"    \"zhTW\": \"投擲者\",\n";
-                ss << u8"    \"deDE\": \"Schleuderer\",\n";
-                ss << u8"    \"esES\": \"Tirador\",\n";
-                ss << u8"    \"frFR\": \"Frondeur\",\n";
-                ss << u8"    \"itIT\": \"Lanciatore\",\n";
-                ss << u8"    \"koKR\": \"덫팔매\",\n";
-                ss << u8"    \"plPL\": \"Miotacz\",\n";
-                ss << u8"    \"esMX\": \"Hondero\",\n";
-                ss << u8"    \"jaJP\": \"スリンガー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lançador\",\n";
-                ss << u8"    \"ruRU\": \"Пращница\",\n";
-                ss << u8"    \"zhCN\": \"投枪手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3146,\n";
-                ss << u8"    \"Key\": \"FireTower\",\n";
-                ss << u8"    \"enUS\": \"Fire Tower\",\n";
-                ss << u8"    \"zhTW\": \"火焰塔\",\n";
-                ss << u8"    \"deDE\": \"Feuerturm\",\n";
-                ss << u8"    \"esES\": \"Torre de fuego\",\n";
-                ss << u8"    \"frFR\": \"Tour de feu\",\n";
-                ss << u8"    \"itIT\": \"Torre di Fuoco\",\n";
-                ss << u8"    \"koKR\": \"화염 탑\",\n";
-                ss << u8"    \"plPL\": \"Ognista wieża\",\n";
-                ss << u8"    \"esMX\": \"Torre ígnea\",\n";
-                ss << u8"    \"jaJP\": \"火炎の塔\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Torre Ígnea\",\n";
-                ss << u8"    \"ruRU\": \"Огненная башня\",\n";
-                ss << u8"    \"zhCN\": \"火焰塔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3147,\n";
-                ss << u8"    \"Key\": \"LightningSpire\",\n";
-                ss << u8"    \"enUS\": \"Lightning Spire\",\n";
-                ss << u8"    \"zhTW\": \"閃電塔\",\n";
-                ss << u8"    \"deDE\": \"Blitzspitze\",\n";
-                ss << u8"    \"esES\": \"Aguja relámpago\",\n";
-                ss << u8"    \"frFR\": \"Flèche de foudre\",\n";
-                ss << u8"    \"itIT\": \"Guglia Fulminante\",\n";
-                ss << u8"    \"koKR\": \"번개 첨탑\",\n";
-                ss << u8"    \"plPL\": \"Iglica błyskawic\",\n";
-                ss << u8"    \"esMX\": \"Pináculo de relámpagos\",\n";
-                ss << u8"    \"jaJP\": \"雷撃の塔\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Torre Elétrica\",\n";
-                ss << u8"    \"ruRU\": \"Шпиль молний\",\n";
-                ss << u8"    \"zhCN\": \"闪电尖塔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3148,\n";
-                ss << u8"    \"Key\": \"PitLord\",\n";
-                ss << u8"    \"enUS\": \"Pit Lord\",\n";
-                ss << u8"    \"zhTW\": \"獄淵領主\",\n";
-                ss << u8"    \"deDE\": \"Grubenfürst\",\n";
-                ss << u8"    \"esES\": \"Señor del foso\",\n";
-                ss << u8"    \"frFR\": \"Seigneur de la fosse\",\n";
-                ss << u8"    \"itIT\": \"Signore dell'Abisso\",\n";
-                ss << u8"    \"koKR\": \"지옥군주\",\n";
-                ss << u8"    \"plPL\": \"Pan czeluści\",\n";
-                ss << u8"    \"esMX\": \"Señor del foso\",\n";
-                ss << u8"    \"jaJP\": \"ピット・ロード\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Senhor do Fosso\",\n";
-                ss << u8"    \"ruRU\": \"Владыка бездны\",\n";
-                ss << u8"    \"zhCN\": \"深渊领主\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3149,\n";
-                ss << u8"    \"Key\": \"Balrog\",\n";
-                ss << u8"    \"enUS\": \"Balrog\",\n";
-                ss << u8"    \"zhTW\": \"炎魔\",\n";
-                ss << u8"    \"deDE\": \"Balrog\",\n";
-                ss << u8"    \"esES\": \"Balrog\",\n";
-                ss << u8"    \"frFR\": \"Balrog\",\n";
-                ss << u8"    \"itIT\": \"Balrog\",\n";
-                ss << u8"    \"koKR\": \"발록\",\n";
-                ss << u8"    \"plPL\": \"Balrog\",\n";
-                ss << u8"    \"esMX\": \"Balrog\",\n";
-                ss << u8"    \"jaJP\": \"バルログ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Balrog\",\n";
-                ss << u8"    \"ruRU\": \"Балрог\",\n";
-                ss << u8"    \"zhCN\": \"炎魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3150,\n";
-                ss << u8"    \"Key\": \"VenomLord\",\n";
-                ss << u8"    \"enUS\": \"Venom Lord\",\n";
-                ss << u8"    \"zhTW\": \"毒魔領主\",\n";
-                ss << u8"    \"deDE\": \"Giftfürst\",\n";
-                ss << u8"    \"esES\": \"Señor de la ponzoña\",\n";
-                ss << u8"    \"frFR\": \"Seigneur du venin\",\n";
-                ss << u8"    \"itIT\": \"Signore del Veleno\",\n";
-                ss << u8"    \"koKR\": \"독의 군주\",\n";
-                ss << u8"    \"plPL\": \"Pan jadu\",\n";
-                ss << u8"    \"esMX\": \"Señor de la ponzoña\",\n";
-                ss << u8"    \"jaJP\": \"ヴェノム・ロード\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Senhor do Veneno\",\n";
-                ss << u8"    \"ruRU\": \"Властелин ядов\",\n";
-                ss << u8"    \"zhCN\": \"剧毒领主\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3151,\n";
-                ss << u8"    \"Key\": \"Iron Wolf\",\n";
-                ss << u8"    \"enUS\": \"Iron Wolf\",\n";
-                ss << u8"    \"zhTW\": \"鐵狼衛士\",\n";
-                ss << u8"    \"deDE\": \"Eisenwolf\",\n";
-                ss << u8"    \"esES\": \"Lobo de Hierro\",\n";
-                ss << u8"    \"frFR\": \"Loup de fer\",\n";
-                ss << u8"    \"itIT\": \"Lupo di Ferro\",\n";
-                ss << u8"    \"koKR\": \"강철늑대단원\",\n";
-                ss << u8"    \"plPL\": \"Żelazny Wilk\",\n";
-                ss << u8"    \"esMX\": \"Lobo de Hierro\",\n";
-                ss << u8"    \"jaJP\": \"鉄狼団\",\n";
-                ss << u8"    \"ptBR\": \"Lobo de Ferro\",\n";
-                ss << u8"    \"ruRU\": \"Стальной Волк\",\n";
-                ss << u8"    \"zhCN\": \"铁狼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3152,\n";
-                ss << u8"    \"Key\": \"InvisoSpawner\",\n";
-                ss << u8"    \"enUS\": \"Inviso Spawner\",\n";
-                ss << u8"    \"zhTW\": \"Inviso Spawner\",\n";
-                ss << u8"    \"deDE\": \"Invisoschleimer\",\n";
-                ss << u8"    \"esES\": \"Desovador Inviso\",\n";
-                ss << u8"    \"frFR\": \"Engendreur invisible\",\n";
-                ss << u8"    \"itIT\": \"Inviso Prolificatore\",\n";
-                ss << u8"    \"koKR\": \"투명 생성기\",\n";
-                ss << u8"    \"plPL\": \"Wijostwór\",\n";
-                ss << u8"    \"esMX\": \"Engendradora invisible\",\n";
-                ss << u8"    \"jaJP\": \"インヴィッソ・スポーナー\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Parideira Invisível\",\n";
-                ss << u8"    \"ruRU\": \"Породитель невидимок\",\n";
-                ss << u8"    \"zhCN\": \"Inviso Spawner\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3153,\n";
-                ss << u8"    \"Key\": \"OblivionKnight\",\n";
-                ss << u8"    \"enUS\": \"Oblivion Knight\",\n";
-                ss << u8"    \"zhTW\": \"遺忘騎士\",\n";
-                ss << u8"    \"deDE\": \"Ritter des Vergessens\",\n";
-                ss << u8"    \"esES\": \"Caballero del olvido\",\n";
-                ss << u8"    \"frFR\": \"Chevalier de l’oubli\",\n";
-                ss << u8"    \"itIT\": \"Cavaliere dell'Oblio\",\n";
-                ss << u8"    \"koKR\": \"망각의 기사\",\n";
-                ss << u8"    \"plPL\": \"Rycerz zapomnienia\",\n";
-                ss << u8"    \"esMX\": \"Caballero olvidado\",\n";
-                ss << u8"    \"jaJP\": \"虚無の騎士\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cavaleiro Soturno\",\n";
-                ss << u8"    \"ruRU\": \"Рыцарь забвения\",\n";
-                ss << u8"    \"zhCN\": \"湮灭骑士\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3154,\n";
-                ss << u8"    \"Key\": \"Mage\",\n";
-                ss << u8"    \"enUS\": \"Mage\",\n";
-                ss << u8"    \"zhTW\": \"法師\",\n";
-                ss << u8"    \"deDE\": \"Magier\",\n";
-                ss << u8"    \"esES\": \"Mago\",\n";
-                ss << u8"    \"frFR\": \"Mage\",\n";
-                ss << u8"    \"itIT\": \"Mago\",\n";
-                ss << u8"    \"koKR\": \"마법학자\",\n";
-                ss << u8"    \"plPL\": \"Mag\",\n";
-                ss << u8"    \"esMX\": \"Mago\",\n";
-                ss << u8"    \"jaJP\": \"メイジ\",\n";
-                ss << u8"    \"ptBR\": \"Mago\",\n";
-                ss << u8"    \"ruRU\": \"Маг\",\n";
-                ss << u8"    \"zhCN\": \"法师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3155,\n";
-                ss << u8"    \"Key\": \"AbyssKnight\",\n";
-                ss << u8"    \"enUS\": \"Abyss Knight\",\n";
-                ss << u8"    \"zhTW\": \"深淵騎士\",\n";
-                ss << u8"    \"deDE\": \"Ritter des Abgrundes\",\n";
-                ss << u8"    \"esES\": \"Caballero del abismo\",\n";
-                ss << u8"    \"frFR\": \"Chevalier des abysses\",\n";
-                ss << u8"    \"itIT\": \"Cavaliere dell'Abisso\",\n";
-                ss << u8"    \"koKR\": \"심연의 기사\",\n";
-                ss << u8"    \"plPL\": \"Rycerz otchłani\",\n";
-                ss << u8"    \"esMX\": \"Caballero abismal\",\n";
-                ss << u8"    \"jaJP\": \"深淵の騎士\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cavaleiro Abissal\",\n";
-                ss << u8"    \"ruRU\": \"Рыцарь бездны\",\n";
-                ss << u8"    \"zhCN\": \"深渊骑士\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3156,\n";
-                ss << u8"    \"Key\": \"Fighter Mage\",\n";
-                ss << u8"    \"enUS\": \"Fighter Mage\",\n";
-                ss << u8"    \"zhTW\": \"戰士法師\",\n";
-                ss << u8"    \"deDE\": \"Kampfmagier\",\n";
-                ss << u8"    \"esES\": \"Mago luchador\",\n";
-                ss << u8"    \"frFR\": \"Mage combattant\",\n";
-                ss << u8"    \"itIT\": \"Mago Guerriero\",\n";
-                ss << u8"    \"koKR\": \"투사 마술사\",\n";
-                ss << u8"    \"plPL\": \"Mag wojownik\",\n";
-                ss << u8"    \"esMX\": \"Mago luchador\",\n";
-                ss << u8"    \"jaJP\": \"ファイター・メイジ\",\n";
-                ss << u8"    \"ptBR\": \"Mago Guerreiro\",\n";
-                ss << u8"    \"ruRU\": \"Воин-маг\",\n";
-                ss << u8"    \"zhCN\": \"战斗法师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3157,\n";
-                ss << u8"    \"Key\": \"DoomKnight\",\n";
-                ss << u8"    \"enUS\": \"Doom Knight\",\n";
-                ss << u8"    \"zhTW\": \"末日騎士\",\n";
-                ss << u8"    \"deDE\": \"Ritter der Verdammnis\",\n";
-                ss << u8"    \"esES\": \"Caballero de la fatalidad\",\n";
-                ss << u8"    \"frFR\": \"Chevalier funeste\",\n";
-                ss << u8"    \"itIT\": \"Cavaliere della Rovina\",\n";
-                ss << u8"    \"koKR\": \"파멸의 기사\",\n";
-                ss << u8"    \"plPL\": \"Rycerz zagłady\",\n";
-                ss << u8"    \"esMX\": \"Caballero condenado\",\n";
-                ss << u8"    \"jaJP\": \"破滅の騎士\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cavaleiro da Perdição\",\n";
-                ss << u8"    \"ruRU\": \"Рыцарь рока\",\n";
-                ss << u8"    \"zhCN\": \"末日骑士\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3158,\n";
-                ss << u8"    \"Key\": \"Fighter\",\n";
-                ss << u8"    \"enUS\": \"Fighter\",\n";
-                ss << u8"    \"zhTW\": \"戰士\",\n";
-                ss << u8"    \"deDE\": \"Kämpfer\",\n";
-                ss << u8"    \"esES\": \"Luchador\",\n";
-                ss << u8"    \"frFR\": \"Combattant\",\n";
-                ss << u8"    \"itIT\": \"Guerriero\",\n";
-                ss << u8"    \"koKR\": \"투사\",\n";
-                ss << u8"    \"plPL\": \"Wojownik\",\n";
-                ss << u8"    \"esMX\": \"Luchador\",\n";
-                ss << u8"    \"jaJP\": \"ファイター\",\n";
-                ss << u8"    \"ptBR\": \"Guerreiro\",\n";
-                ss << u8"    \"ruRU\": \"Воин\",\n";
-                ss << u8"    \"zhCN\": \"斗士\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3159,\n";
-                ss << u8"    \"Key\": \"MawFiend\",\n";
-                ss << u8"    \"enUS\": \"Maw Fiend\",\n";
-                ss << u8"    \"zhTW\": \"魔口吐屍怪\",\n";
-                ss << u8"    \"deDE\": \"Teufelsmaul\",\n";
-                ss << u8"    \"esES\": \"Fauces del maligno\",\n";
-                ss << u8"    \"frFR\": \"Démon dégobilleur\",\n";
-                ss << u8"    \"itIT\": \"Fauci Demoniache\",\n";
-                ss << u8"    \"koKR\": \"아귀 마귀\",\n";
-                ss << u8"    \"plPL\": \"Trupożerca\",\n";
-                ss << u8"    \"esMX\": \"Demonio feral\",\n";
-                ss << u8"    \"jaJP\": \"モー・フィーンド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Demônio da Bocarra\",\n";
-                ss << u8"    \"ruRU\": \"Зеводемон\",\n";
-                ss << u8"    \"zhCN\": \"大胃魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3160,\n";
-                ss << u8"    \"Key\": \"CorpseSpitter\",\n";
-                ss << u8"    \"enUS\": \"Corpse Spitter\",\n";
-                ss << u8"    \"zhTW\": \"吐屍怪\",\n";
-                ss << u8"    \"deDE\": \"Leichenspucker\",\n";
-                ss << u8"    \"esES\": \"Escupecadáveres\",\n";
-                ss << u8"    \"frFR\": \"Cracheur de cadavre\",\n";
-                ss << u8"    \"itIT\": \"Sputacorpi\",\n";
-                ss << u8"    \"koKR\": \"시체 분사자\",\n";
-                ss << u8"    \"plPL\": \"Ścierwopluj\",\n";
-                ss << u8"    \"esMX\": \"Escupecuerpos\",\n";
-                ss << u8"    \"jaJP\": \"コープス・スピッター\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cospe-cadáver\",\n";
-                ss << u8"    \"ruRU\": \"Исторгатель трупов\",\n";
-                ss << u8"    \"zhCN\": \"吐尸魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3161,\n";
-                ss << u8"    \"Key\": \"Corpulent\",\n";
-                ss << u8"    \"enUS\": \"Corpulent\",\n";
-                ss << u8"    \"zhTW\": \"臃腫吐屍怪\",\n";
-                ss << u8"    \"deDE\": \"Korpulenter\",\n";
-                ss << u8"    \"esES\": \"Corpulento\",\n";
-                ss << u8"    \"frFR\": \"Corpulent\",\n";
-                ss << u8"    \"itIT\": \"Corpulento\",\n";
-                ss << u8"    \"koKR\": \"비대살덩이\",\n";
-                ss << u8"    \"plPL\": \"Rzygacz\",\n";
-                ss << u8"    \"esMX\": \"Corpulento\",\n";
-                ss << u8"    \"jaJP\": \"コルピュラント\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Corpulento\",\n";
-                ss << u8"    \"ruRU\": \"Брюхач\",\n";
-                ss << u8"    \"zhCN\": \"化尸魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3162,\n";
-                ss << u8"    \"Key\": \"StormCaster\",\n";
-                ss << u8"    \"enUS\": \"Storm Caster\",\n";
-                ss << u8"    \"zhTW\": \"暴風施術者\",\n";
-                ss << u8"    \"deDE\": \"Sturmrufer\",\n";
-                ss << u8"    \"esES\": \"Invocador de tormentas\",\n";
-                ss << u8"    \"frFR\": \"Invocateur de tempêtes\",\n";
-                ss << u8"    \"itIT\": \"Lanciatempeste\",\n";
-                ss << u8"    \"koKR\": \"폭풍 주문사\",\n";
-                ss << u8"    \"plPL\": \"Miotacz burzy\",\n";
-                ss << u8"    \"esMX\": \"Lanzatormentas\",\n";
-                ss << u8"    \"jaJP\": \"ストーム・キャスター\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lança-tempestade\",\n";
-                ss << u8"    \"ruRU\": \"Маг бури\",\n";
-                ss << u8"    \"zhCN\": \"风暴法魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3163,\n";
-                ss << u8"    \"Key\": \"Strangler\",\n";
-                ss << u8"    \"enUS\": \"Strangler\",\n";
-                ss << u8"    \"zhTW\": \"扼殺者\",\n";
-                ss << u8"    \"deDE\": \"Würger\",\n";
-                ss << u8"    \"esES\": \"Estrangulador\",\n";
-                ss << u8"    \"frFR\": \"Étrangleur\",\n";
-                ss << u8"    \"itIT\": \"Strangolatore\",\n";
-                ss << u8"    \"koKR\": \"교살자\",\n";
-                ss << u8"    \"plPL\": \"Dusiciel\",\n";
-                ss << u8"    \"esMX\": \"Estrangulador\",\n";
-                ss << u8"    \"jaJP\": \"ストラングラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Estrangulador\",\n";
-                ss << u8"    \"ruRU\": \"Душитель\",\n";
-                ss << u8"    \"zhCN\": \"扼喉法魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3164,\n";
-                ss << u8"    \"Key\": \"Groper\",\n";
-                ss << u8"    \"enUS\": \"Doom Caster\",\n";
-                ss << u8"    \"zhTW\": \"厄運施術者\",\n";
-                ss << u8"    \"deDE\": \"Unheilbringer\",\n";
-                ss << u8"    \"esES\": \"Invocador de la fatalidad\",\n";
-                ss << u8"    \"frFR\": \"Épandeur de sort\",\n";
-                ss << u8"    \"itIT\": \"Lanciarovina\",\n";
-                ss << u8"    \"koKR\": \"파멸 주문사\",\n";
-                ss << u8"    \"plPL\": \"Siewca zagłady\",\n";
-                ss << u8"    \"esMX\": \"Lanzarruina\",\n";
-                ss << u8"    \"jaJP\": \"ドゥーム・キャスター\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lança-ruína\",\n";
-                ss << u8"    \"ruRU\": \"Маг рока\",\n";
-                ss << u8"    \"zhCN\": \"厄运法魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3165,\n";
-                ss << u8"    \"Key\": \"GrotesqueWyrm\",\n";
-                ss << u8"    \"enUS\": \"Grotesque Wyrm\",\n";
-                ss << u8"    \"zhTW\": \"異魔鬼子\",\n";
-                ss << u8"    \"deDE\": \"Grotesker Lindwurm\",\n";
-                ss << u8"    \"esES\": \"Dragón pequeño grotesco\",\n";
-                ss << u8"    \"frFR\": \"Wyrm grotesque\",\n";
-                ss << u8"    \"itIT\": \"Verme Grottesco\",\n";
-                ss << u8"    \"koKR\": \"기괴살덩이 구렁이\",\n";
-                ss << u8"    \"plPL\": \"Maszkaronowy wij\",\n";
-                ss << u8"    \"esMX\": \"Vermis grotesco\",\n";
-                ss << u8"    \"jaJP\": \"グロテスク・ウィルム\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Serpe Grotesca\",\n";
-                ss << u8"    \"ruRU\": \"Уродливый червь\",\n";
-                ss << u8"    \"zhCN\": \"怪诞肉蛆\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3166,\n";
-                ss << u8"    \"Key\": \"StygianDog\",\n";
-                ss << u8"    \"enUS\": \"Stygian Dog\",\n";
-                ss << u8"    \"zhTW\": \"冥河鬼子\",\n";
-                ss << u8"    \"deDE\": \"Stygischer Hund\",\n";
-                ss << u8"    \"esES\": \"Perro estigio\",\n";
-                ss << u8"    \"frFR\": \"Chien stygien\",\n";
-                ss << u8"    \"itIT\": \"Cane dello Stige\",\n";
-                ss << u8"    \"koKR\": \"저승 개\",\n";
-                ss << u8"    \"plPL\": \"Stygijski robak\",\n";
-                ss << u8"    \"esMX\": \"Cachorro estigio\",\n";
-                ss << u8"    \"jaJP\": \"スティジャン・ドッグ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cão Estígio\",\n";
-                ss << u8"    \"ruRU\": \"Стигийская собака\",\n";
-                ss << u8"    \"zhCN\": \"冥河犬\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3167,\n";
-                ss << u8"    \"Key\": \"FleshBeast\",\n";
-                ss << u8"    \"enUS\": \"Flesh Beast\",\n";
-                ss << u8"    \"zhTW\": \"血獸鬼子\",\n";
-                ss << u8"    \"deDE\": \"Fleischbestie\",\n";
-                ss << u8"    \"esES\": \"Bestia de la carne\",\n";
-                ss << u8"    \"frFR\": \"Bête de chair\",\n";
-                ss << u8"    \"itIT\": \"Bestia di Carne\",\n";
-                ss << u8"    \"koKR\": \"살점 야수\",\n";
-                ss << u8"    \"plPL\": \"Bestia trzewi\",\n";
-                ss << u8"    \"esMX\": \"Bestia carnal\",\n";
-                ss << u8"    \"jaJP\": \"フレッシュ・ビースト\",\n";
-                ss << u8"    \"ptBR\": \"Fera Cárnea\",\n";
-                ss << u8"    \"ruRU\": \"Кровавый зверь\",\n";
-                ss << u8"    \"zhCN\": \"血肉兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3168,\n";
-                ss << u8"    \"Key\": \"Grotesque\",\n";
-                ss << u8"    \"enUS\": \"Grotesque\",\n";
-                ss << u8"    \"zhTW\": \"異魔鬼母\",\n";
-                ss << u8"    \"deDE\": \"Grotesker\",\n";
-                ss << u8"    \"esES\": \"Grotesca\",\n";
-                ss << u8"    \"frFR\": \"Grotesque\",\n";
-                ss << u8"    \"itIT\": \"Madre Grottesca\",\n";
-                ss << u8"    \"koKR\": \"기괴살덩이\",\n";
-                ss << u8"    \"plPL\": \"Maszkaron\",\n";
-                ss << u8"    \"esMX\": \"Grotesca\",\n";
-                ss << u8"    \"jaJP\": \"グロテスク\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Grotesca\",\n";
-                ss << u8"    \"ruRU\": \"Макабр\",\n";
-                ss << u8"    \"zhCN\": \"怪诞魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3169,\n";
-                ss << u8"    \"Key\": \"StygianHag\",\n";
-                ss << u8"    \"enUS\": \"Stygian Hag\",\n";
-                ss << u8"    \"zhTW\": \"冥河鬼母\",\n";
-                ss << u8"    \"deDE\": \"Stygische Hexe\",\n";
-                ss << u8"    \"esES\": \"Bruja estigia\",\n";
-                ss << u8"    \"frFR\": \"Mégère stygienne\",\n";
-                ss << u8"    \"itIT\": \"Strega dello Stige\",\n";
-                ss << u8"    \"koKR\": \"저승 노파\",\n";
-                ss << u8"    \"plPL\": \"Stygijska wiedźma\",\n";
-                ss << u8"    \"esMX\": \"Vieja estigia\",\n";
-                ss << u8"    \"jaJP\": \"スティジャン・ハッグ\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Megera Estígia\",\n";
-                ss << u8"    \"ruRU\": \"Стигийская ведьма\",\n";
-                ss << u8"    \"zhCN\": \"冥河母夜叉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3170,\n";
-                ss << u8"    \"Key\": \"FleshSpawner\",\n";
-                ss << u8"    \"enUS\": \"Flesh Spawner\",\n";
-                ss << u8"    \"zhTW\": \"血獸鬼母\",\n";
-                ss << u8"    \"deDE\": \"Fleischschleimer\",\n";
-                ss << u8"    \"esES\": \"Engendradora de la carne\",\n";
-                ss << u8"    \"frFR\": \"Engendreur de chair\",\n";
-                ss << u8"    \"itIT\": \"Generatrice di Carne\",\n";
-                ss << u8"    \"koKR\": \"살점 어미\",\n";
-                ss << u8"    \"plPL\": \"Trzewiostwór\",\n";
-                ss << u8"    \"esMX\": \"Engendradora carnal\",\n";
-                ss << u8"    \"jaJP\": \"フレッシュ・スポーナー\",\n";
-                ss << u8"    \"ptBR\": \"Parideira Cárnea\",\n";
-                ss << u8"    \"ruRU\": \"Породительница плоти\",\n";
-                ss << u8"    \"zhCN\": \"血肉孵化者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3171,\n";
-                ss << u8"    \"Key\": \"RogueScout\",\n";
-                ss << u8"    \"enUS\": \"Rogue Scout\",\n";
-                ss << u8"    \"zhTW\": \"俠盜斥候\",\n";
-                ss << u8"    \"deDE\": \"Jägerinnenspäher\",\n";
-                ss << u8"    \"esES\": \"Arpía exploradora\",\n";
-                ss << u8"    \"frFR\": \"Éclaireuse rogue\",\n";
-                ss << u8"    \"itIT\": \"Scolta Esploratrice\",\n";
-                ss << u8"    \"koKR\": \"도적 정찰병\",\n";
-                ss << u8"    \"plPL\": \"Zwiadowczyni Łotrzyc\",\n";
-                ss << u8"    \"esMX\": \"Exploradora renegada\",\n";
-                ss << u8"    \"jaJP\": \"ローグ・スカウト\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Batedora Renegada\",\n";
-                ss << u8"    \"ruRU\": \"Разбойница-разведчица\",\n";
-                ss << u8"    \"zhCN\": \"流亡者斥候\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3172,\n";
-                ss << u8"    \"Key\": \"BloodWingNest\",\n";
-                ss << u8"    \"enUS\": \"Blood Wing Nest\",\n";
-                ss << u8"    \"zhTW\": \"血翅蚊之巢\",\n";
-                ss << u8"    \"deDE\": \"Blutflügelnest\",\n";
-                ss << u8"    \"esES\": \"Nido de ala sangrienta\",\n";
-                ss << u8"    \"frFR\": \"Nid d’ailes sanglantes\",\n";
-                ss << u8"    \"itIT\": \"Nido di Ala Insanguinata\",\n";
-                ss << u8"    \"koKR\": \"핏빛날개 둥지\",\n";
-                ss << u8"    \"plPL\": \"Gniazdo krwawoskrzydłych\",\n";
-                ss << u8"    \"esMX\": \"Nido de Alas sangrientas\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・ウィングの巣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ninho de Asa Sangrenta\",\n";
-                ss << u8"    \"ruRU\": \"Гнездо кровокрылов\",\n";
-                ss << u8"    \"zhCN\": \"血翼蚊之巢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3173,\n";
-                ss << u8"    \"Key\": \"BloodHookNest\",\n";
-                ss << u8"    \"enUS\": \"Blood Hook Nest\",\n";
-                ss << u8"    \"zhTW\": \"血鉤蚊之巢\",\n";
-                ss << u8"    \"deDE\": \"Bluthakennest\",\n";
-                ss << u8"    \"esES\": \"Nido de garfio sangriento\",\n";
-                ss << u8"    \"frFR\": \"Nid de crochets sanglants\",\n";
-                ss << u8"    \"itIT\": \"Nido di Uncino di Sangue\",\n";
-                ss << u8"    \"koKR\": \"피 갈고리 둥지\",\n";
-                ss << u8"    \"plPL\": \"Gniazdo krwawych szponów\",\n";
-                ss << u8"    \"esMX\": \"Nido de Mosquito sanguinario\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・フックの巣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ninho de Gancho Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Гнездо кровавых когтей\",\n";
-                ss << u8"    \"zhCN\": \"血钩蚊之巢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3174,\n";
-                ss << u8"    \"Key\": \"FeederNest\",\n";
-                ss << u8"    \"enUS\": \"Feeder Nest\",\n";
-                ss << u8"    \"zhTW\": \"餵血蚊之巢\",\n";
-                ss << u8"    \"deDE\": \"Fressernest\",\n";
-                ss << u8"    \"esES\": \"Nido de comilón\",\n";
-                ss << u8"    \"frFR\": \"Nid de nourricières\",\n";
-                ss << u8"    \"itIT\": \"Nido di Succhiavita\",\n";
-                ss << u8"    \"koKR\": \"피먹이 둥지\",\n";
-                ss << u8"    \"plPL\": \"Gniazdo karmicieli\",\n";
-                ss << u8"    \"esMX\": \"Nido de Devorador alado\",\n";
-                ss << u8"    \"jaJP\": \"フィーダーの巣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ninho de Cevador\",\n";
-                ss << u8"    \"ruRU\": \"Гнездо едоков\",\n";
-                ss << u8"    \"zhCN\": \"捕食蚊之巢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3175,\n";
-                ss << u8"    \"Key\": \"SuckerNest\",\n";
-                ss << u8"    \"enUS\": \"Sucker Nest\",\n";
-                ss << u8"    \"zhTW\": \"吸血蚊之巢\",\n";
-                ss << u8"    \"deDE\": \"Saugernest\",\n";
-                ss << u8"    \"esES\": \"Nido de chupóptero\",\n";
-                ss << u8"    \"frFR\": \"Nid de ventouses\",\n";
-                ss << u8"    \"itIT\": \"Nido di Prosciugatore\",\n";
-                ss << u8"    \"koKR\": \"피빨이 둥지\",\n";
-                ss << u8"    \"plPL\": \"Gniazdo pijawek\",\n";
-                ss << u8"    \"esMX\": \"Nido de Succionador\",\n";
-                ss << u8"    \"jaJP\": \"サッカーの巣\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ninho de Sugador\",\n";
-                ss << u8"    \"ruRU\": \"Гнездо кровососов\",\n";
-                ss << u8"    \"zhCN\": \"吸食蚊之巢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3176,\n";
-                ss << u8"    \"Key\": \"NecroMage\",\n";
-                ss << u8"    \"enUS\": \"Necromage\",\n";
-                ss << u8"    \"zhTW\": \"死靈師\",\n";
-                ss << u8"    \"deDE\": \"Nekromagier\",\n";
-                ss << u8"    \"esES\": \"Nigromago\",\n";
-                ss << u8"    \"frFR\": \"Nécromage\",\n";
-                ss << u8"    \"itIT\": \"Necromago\",\n";
-                ss << u8"    \"koKR\": \"강령 마술사\",\n";
-                ss << u8"    \"plPL\": \"Nekromag\",\n";
-                ss << u8"    \"esMX\": \"Nigromago\",\n";
-                ss << u8"    \"jaJP\": \"ネクロメイジ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Necromago\",\n";
-                ss << u8"    \"ruRU\": \"Некромаг\",\n";
-                ss << u8"    \"zhCN\": \"死灵法师\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3177,\n";
-                ss << u8"    \"Key\": \"NecroSkeleton\",\n";
-                ss << u8"    \"enUS\": \"Necroskeleton\",\n";
-                ss << u8"    \"zhTW\": \"死靈骷髏\",\n";
-                ss << u8"    \"deDE\": \"Nekroskelett\",\n";
-                ss << u8"    \"esES\": \"Nigroesqueleto\",\n";
-                ss << u8"    \"frFR\": \"Nécrosquelette\",\n";
-                ss << u8"    \"itIT\": \"Necroscheletro\",\n";
-                ss << u8"    \"koKR\": \"강령 해골\",\n";
-                ss << u8"    \"plPL\": \"Nekroszkielet\",\n";
-                ss << u8"    \"esMX\": \"Nigroesqueleto\",\n";
-                ss << u8"    \"jaJP\": \"ネクロスケルトン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Necroesqueleto\",\n";
-                ss << u8"    \"ruRU\": \"Некроскелет\",\n";
-                ss << u8"    \"zhCN\": \"死灵骷髅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3178,\n";
-                ss << u8"    \"Key\": \"TrappedSoul\",\n";
-                ss << u8"    \"enUS\": \"Trapped Soul\",\n";
-                ss << u8"    \"zhTW\": \"受困的靈魂\",\n";
-                ss << u8"    \"deDE\": \"Gefangene Seele\",\n";
-                ss << u8"    \"esES\": \"Alma atrapada\",\n";
-                ss << u8"    \"frFR\": \"Âme piégée\",\n";
-                ss << u8"    \"itIT\": \"Anima Intrappolata\",\n";
-                ss << u8"    \"koKR\": \"사로잡힌 영혼\",\n";
-                ss << u8"    \"plPL\": \"Uwięziona dusza\",\n";
-                ss << u8"    \"esMX\": \"Alma aprisionada\",\n";
-                ss << u8"    \"jaJP\": \"囚われた魂\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Alma Aprisionada\",\n";
-                ss << u8"    \"ruRU\": \"Пленная душа\",\n";
-                ss << u8"    \"zhCN\": \"被禁锢的灵魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3181,\n";
-                ss << u8"    \"Key\": \"Raises Fetishes\",\n";
-                ss << u8"    \"enUS\": \"Raises Fetishes\",\n";
-                ss << u8"    \"zhTW\": \"復活鬼娃\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Fetische\",\n";
-                ss << u8"    \"esES\": \"Invoca fetiches\",\n";
-                ss << u8"    \"frFR\": \"Invoque des fétiches\",\n";
-                ss << u8"    \"itIT\": \"Rianima Feticci\",\n";
-                ss << u8"    \"koKR\": \"우상족을 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia fetyszy\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Fetiches\",\n";
-                ss << u8"    \"jaJP\": \"フェティッシュを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive carrancos\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет фетишей\",\n";
-                ss << u8"    \"zhCN\": \"复活鬼娃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3182,\n";
-                ss << u8"    \"Key\": \"Raises Undead\",\n";
-                ss << u8"    \"enUS\": \"Raises Undead\",\n";
-                ss << u8"    \"zhTW\": \"復活不死怪物\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Untote\",\n";
-                ss << u8"    \"esES\": \"Invoca muertos vivientes\",\n";
-                ss << u8"    \"frFR\": \"Crée des morts\",\n";
-                ss << u8"    \"itIT\": \"Rianima Non Morti\",\n";
-                ss << u8"    \"koKR\": \"언데드를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia nieumarłych\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los No muertos\",\n";
-                ss << u8"    \"jaJP\": \"アンデッドを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive mortos-vivos\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет нежить\",\n";
-                ss << u8"    \"zhCN\": \"复活亡灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3183,\n";
-                ss << u8"    \"Key\": \"Lays Eggs\",\n";
-                ss << u8"    \"enUS\": \"Lays Eggs\",\n";
-                ss << u8"    \"zhTW\": \"產卵\",\n";
-                ss << u8"    \"deDE\": \"Legt Eier\",\n";
-                ss << u8"    \"esES\": \"Pone huevos\",\n";
-                ss << u8"    \"frFR\": \"Pond des œufs\",\n";
-                ss << u8"    \"itIT\": \"Depone uova\",\n";
-                ss << u8"    \"koKR\": \"알을 낳음\",\n";
-                ss << u8"    \"plPL\": \"Składa jaja\",\n";
-                ss << u8"    \"esMX\": \"Pone huevos\",\n";
-                ss << u8"    \"jaJP\": \"産卵する\",\n";
-                ss << u8"    \"ptBR\": \"Põe ovos\",\n";
-                ss << u8"    \"ruRU\": \"Откладывает яйца\",\n";
-                ss << u8"    \"zhCN\": \"孵蛋\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3184,\n";
-                ss << u8"    \"Key\": \"Raises Fallen\",\n";
-                ss << u8"    \"enUS\": \"Raises Fallen\",\n";
-                ss << u8"    \"zhTW\": \"復活沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Gefallene\",\n";
-                ss << u8"    \"esES\": \"Invoca caídos\",\n";
-                ss << u8"    \"frFR\": \"Invoque des déchus\",\n";
-                ss << u8"    \"itIT\": \"Rianima Caduti\",\n";
-                ss << u8"    \"koKR\": \"몰락자를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia upadłych\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Caídos\",\n";
-                ss << u8"    \"jaJP\": \"フォールンを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive decaídos\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет падших\",\n";
-                ss << u8"    \"zhCN\": \"复活沉沦魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3185,\n";
-                ss << u8"    \"Key\": \"heals Zealots and Cantors\",\n";
-                ss << u8"    \"enUS\": \"Heals Others\",\n";
-                ss << u8"    \"zhTW\": \"治療其他同伴\",\n";
-                ss << u8"    \"deDE\": \"Heilt andere\",\n";
-                ss << u8"    \"esES\": \"Cura a otros\",\n";
-                ss << u8"    \"frFR\": \"Soigne les autres\",\n";
-                ss << u8"    \"itIT\": \"Cura gli altri\",\n";
-                ss << u8"    \"koKR\": \"동료 치유\",\n";
-                ss << u8"    \"plPL\": \"Leczy innych\",\n";
-                ss << u8"    \"esMX\": \"Sana a los demás\",\n";
-                ss << u8"    \"jaJP\": \"他のモンスターを回復する\",\n";
-                ss << u8"    \"ptBR\": \"Cura outros\",\n";
-                ss << u8"    \"ruRU\": \"Лекарь\",\n";
-                ss << u8"    \"zhCN\": \"治疗他人\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3186,\n";
-                ss << u8"    \"Key\": \"drains mana and stamina\",\n";
-                ss << u8"    \"enUS\": \"Drains Mana and Stamina\",\n";
-                ss << u8"    \"zhTW\": \"吸取法力和精力\",\n";
-                ss << u8"    \"deDE\": \"Entzieht Mana und Ausdauer\",\n";
-                ss << u8"    \"esES\": \"Drena maná y aguante\",\n";
-                ss << u8"    \"frFR\": \"Draine le mana et l’endurance\",\n";
-                ss << u8"    \"itIT\": \"Risucchia mana e vigore\",\n";
-                ss << u8"    \"koKR\": \"마나와 지구력 흡수\",\n";
-                ss << u8"    \"plPL\": \"Wysysa manę i wytrzymałość\",\n";
-                ss << u8"    \"esMX\": \"Drena maná y vigor\",\n";
-                ss << u8"    \"jaJP\": \"マナとスタミナを奪い取る\",\n";
-                ss << u8"    \"ptBR\": \"Drena mana e vigor\",\n";
-                ss << u8"    \"ruRU\": \"Высасывает ману и выносливость\",\n";
-                ss << u8"    \"zhCN\": \"抽取法力和耐力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3187,\n";
-                ss << u8"    \"Key\": \"drains mana\",\n";
-                ss << u8"    \"enUS\": \"Drains Mana\",\n";
-                ss << u8"    \"zhTW\": \"吸取法力\",\n";
-                ss << u8"    \"deDE\": \"Saugt Mana ab\",\n";
-                ss << u8"    \"esES\": \"Drena maná\",\n";
-                ss << u8"    \"frFR\": \"Draine le mana\",\n";
-                ss << u8"    \"itIT\": \"Risucchia mana\",\n";
-                ss << u8"    \"koKR\": \"마나 흡수\",\n";
-                ss << u8"    \"plPL\": \"Wysysa manę\",\n";
-                ss << u8"    \"esMX\": \"Drena maná\",\n";
-                ss << u8"    \"jaJP\": \"マナを奪い取る\",\n";
-                ss << u8"    \"ptBR\": \"Drena mana\",\n";
-                ss << u8"    \"ruRU\": \"Высасывает ману\",\n";
-                ss << u8"    \"zhCN\": \"抽取法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3188,\n";
-                ss << u8"    \"Key\": \"drains stamina\",\n";
-                ss << u8"    \"enUS\": \"Drains Stamina\",\n";
-                ss << u8"    \"zhTW\": \"吸取精力\",\n";
-                ss << u8"    \"deDE\": \"Saugt Ausdauer ab\",\n";
-                ss << u8"    \"esES\": \"Drena aguante\",\n";
-                ss << u8"    \"frFR\": \"Draine l’endurance\",\n";
-                ss << u8"    \"itIT\": \"Risucchia vigore\",\n";
-                ss << u8"    \"koKR\": \"지구력 흡수\",\n";
-                ss << u8"    \"plPL\": \"Wysysa wytrzymałość\",\n";
-                ss << u8"    \"esMX\": \"Drena vigor\",\n";
-                ss << u8"    \"jaJP\": \"スタミナを奪い取る\",\n";
-                ss << u8"    \"ptBR\": \"Drena vigor\",\n";
-                ss << u8"    \"ruRU\": \"Высасывает выносливость\",\n";
-                ss << u8"    \"zhCN\": \"抽取耐力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3189,\n";
-                ss << u8"    \"Key\": \"stun attack\",\n";
-                ss << u8"    \"enUS\": \"Stun Attack\",\n";
-                ss << u8"    \"zhTW\": \"昏迷攻擊\",\n";
-                ss << u8"    \"deDE\": \"Betäubungsangriff\",\n";
-                ss << u8"    \"esES\": \"Ataque aturdidor\",\n";
-                ss << u8"    \"frFR\": \"Étourdit\",\n";
-                ss << u8"    \"itIT\": \"Attacco stordente\",\n";
-                ss << u8"    \"koKR\": \"기절 공격\",\n";
-                ss << u8"    \"plPL\": \"Ogłuszający atak\",\n";
-                ss << u8"    \"esMX\": \"Ataque de aturdimiento\",\n";
-                ss << u8"    \"jaJP\": \"スタン攻撃\",\n";
-                ss << u8"    \"ptBR\": \"Ataque de atordoamento\",\n";
-                ss << u8"    \"ruRU\": \"Оглушает при атаке\",\n";
-                ss << u8"    \"zhCN\": \"击晕\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3190,\n";
-                ss << u8"    \"Key\": \"eats and spits corspes\",\n";
-                ss << u8"    \"enUS\": \"Eats and Spits Corspes\",\n";
-                ss << u8"    \"zhTW\": \"吞食與吐出屍體\",\n";
-                ss << u8"    \"deDE\": \"Frisst und spuckt Leichen\",\n";
-                ss << u8"    \"esES\": \"Come y escupe cadáveres\",\n";
-                ss << u8"    \"frFR\": \"Mange et crache des cadavres\",\n";
-                ss << u8"    \"itIT\": \"Mangia e sputa cadaveri\",\n";
-                ss << u8"    \"koKR\": \"시체를 먹고 뱉음\",\n";
-                ss << u8"    \"plPL\": \"Pożera zwłoki i nimi pluje\",\n";
-                ss << u8"    \"esMX\": \"Come y escupe cadáveres\",\n";
-                ss << u8"    \"jaJP\": \"死体を食べて吐き出す\",\n";
-                ss << u8"    \"ptBR\": \"Come e cospe cadáveres\",\n";
-                ss << u8"    \"ruRU\": \"Пожирает и извергает трупы\",\n";
-                ss << u8"    \"zhCN\": \"吃吐尸体\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3191,\n";
-                ss << u8"    \"Key\": \"homing missiles\",\n";
-                ss << u8"    \"enUS\": \"Homing Missiles Drain Mana\",\n";
-                ss << u8"    \"zhTW\": \"追蹤飛箭吸取法力\",\n";
-                ss << u8"    \"deDE\": \"Zielsuchende Geschosse entziehen Mana\",\n";
-                ss << u8"    \"esES\": \"Misiles rastreadores que drenan maná\",\n";
-                ss << u8"    \"frFR\": \"Les projectiles drainent le mana\",\n";
-                ss << u8"    \"itIT\": \"Missili a ricerca Risucchia mana\",\n";
-                ss << u8"    \"koKR\": \"유도 투사체 마나 흡수\",\n";
-                ss << u8"    \"plPL\": \"Pociski wysysające manę\",\n";
-                ss << u8"    \"esMX\": \"Los misiles dirigidos drenan maná\",\n";
-                ss << u8"    \"jaJP\": \"追尾する攻撃でマナを奪い取る\",\n";
-                ss << u8"    \"ptBR\": \"Projéteis guiados drenam mana\",\n";
-                ss << u8"    \"ruRU\": \"Самонаводящиеся снаряды, вытягивает ману\",\n";
-                ss << u8"    \"zhCN\": \"追踪飞弹 吸取法力\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3192,\n";
-                ss << u8"    \"Key\": \"raises Stygian Dolls\",\n";
-                ss << u8"    \"enUS\": \"Raises Stygian Dolls\",\n";
-                ss << u8"    \"zhTW\": \"復活冥河鬼娃\",\n";
-                ss << u8"    \"deDE\": \"Erweckt stygische Puppen\",\n";
-                ss << u8"    \"esES\": \"Invoca muñecos estigios\",\n";
-                ss << u8"    \"frFR\": \"Invoque des poupées\",\n";
-                ss << u8"    \"itIT\": \"Rianima Bambole dello Stige\",\n";
-                ss << u8"    \"koKR\": \"저승 꼭두각시를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia stygijczyków\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Muñecos estigios\",\n";
-                ss << u8"    \"jaJP\": \"スティジャンドールを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive bonecos estígios\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет стигийских кукол\",\n";
-                ss << u8"    \"zhCN\": \"复活冥河娃娃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3193,\n";
-                ss << u8"    \"Key\": \"raises Soul Killers\",\n";
-                ss << u8"    \"enUS\": \"Raises Soul Killers\",\n";
-                ss << u8"    \"zhTW\": \"復活靈魂殺手\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Seelentöter\",\n";
-                ss << u8"    \"esES\": \"Invoca asesinos de almas\",\n";
-                ss << u8"    \"frFR\": \"Invoque des dévoreurs d’âmes\",\n";
-                ss << u8"    \"itIT\": \"Rianima Uccisori di Anime\",\n";
-                ss << u8"    \"koKR\": \"영혼살해자를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia zabójców dusz\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Asesinos de almas\",\n";
-                ss << u8"    \"jaJP\": \"ソウルキラーを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive mata-almas\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет душегубов\",\n";
-                ss << u8"    \"zhCN\": \"复活灵魂杀手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3194,\n";
-                ss << u8"    \"Key\": \"raises Flayers\",\n";
-                ss << u8"    \"enUS\": \"Raises Flayers\",\n";
-                ss << u8"    \"zhTW\": \"復活剝皮手\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Schinder\",\n";
-                ss << u8"    \"esES\": \"Invoca desolladores\",\n";
-                ss << u8"    \"frFR\": \"Invoque des écorcheurs\",\n";
-                ss << u8"    \"itIT\": \"Rianima Scorticatori\",\n";
-                ss << u8"    \"koKR\": \"약탈자를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia łupieżców\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Desolladores\",\n";
-                ss << u8"    \"jaJP\": \"フレイヤーを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive esfoladores\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет свежевателей\",\n";
-                ss << u8"    \"zhCN\": \"复活剥皮魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3195,\n";
-                ss << u8"    \"Key\": \"raises Fetishes\",\n";
-                ss << u8"    \"enUS\": \"Raises Fetishes\",\n";
-                ss << u8"    \"zhTW\": \"復活鬼娃\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Fetische\",\n";
-                ss << u8"    \"esES\": \"Invoca fetiches\",\n";
-                ss << u8"    \"frFR\": \"Invoque des fétiches\",\n";
-                ss << u8"    \"itIT\": \"Rianima Feticci\",\n";
-                ss << u8"    \"koKR\": \"우상족을 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia fetyszy\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Fetiches\",\n";
-                ss << u8"    \"jaJP\": \"フェティッシュを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive carrancos\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет фетишей\",\n";
-                ss << u8"    \"zhCN\": \"复活鬼娃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3196,\n";
-                ss << u8"    \"Key\": \"raises Ratmen\",\n";
-                ss << u8"    \"enUS\": \"Raises Ratmen\",\n";
-                ss << u8"    \"zhTW\": \"復活鼠人\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Rattenmänner\",\n";
-                ss << u8"    \"esES\": \"Invoca hombres rata\",\n";
-                ss << u8"    \"frFR\": \"Invoque des hommes-rats\",\n";
-                ss << u8"    \"itIT\": \"Rianima Uomini Ratto\",\n";
-                ss << u8"    \"koKR\": \"쥐 인간을 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia szczuroczłeków\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Ratoneros\",\n";
-                ss << u8"    \"jaJP\": \"ラットマンを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive homens-rato\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет крысолюдов\",\n";
-                ss << u8"    \"zhCN\": \"复活鼠人\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3197,\n";
-                ss << u8"    \"Key\": \"steals life\",\n";
-                ss << u8"    \"enUS\": \"Steals Life\",\n";
-                ss << u8"    \"zhTW\": \"生命竊取\",\n";
-                ss << u8"    \"deDE\": \"Stiehlt Leben\",\n";
-                ss << u8"    \"esES\": \"Roba vida\",\n";
-                ss << u8"    \"frFR\": \"Vole de la vie\",\n";
-                ss << u8"    \"itIT\": \"Ruba vita\",\n";
-                ss << u8"    \"koKR\": \"생명력 훔침\",\n";
-                ss << u8"    \"plPL\": \"Kradnie zdrowie\",\n";
-                ss << u8"    \"esMX\": \"Roba vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフを奪う\",\n";
-                ss << u8"    \"ptBR\": \"Rouba pontos de vida\",\n";
-                ss << u8"    \"ruRU\": \"Похищает здоровье\",\n";
-                ss << u8"    \"zhCN\": \"偷取生命\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3198,\n";
-                ss << u8"    \"Key\": \"raises undead\",\n";
-                ss << u8"    \"enUS\": \"Raises Undead\",\n";
-                ss << u8"    \"zhTW\": \"復活不死怪物\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Untote\",\n";
-                ss << u8"    \"esES\": \"Invoca muertos vivientes\",\n";
-                ss << u8"    \"frFR\": \"Crée des morts-vivants\",\n";
-                ss << u8"    \"itIT\": \"Rianima Non Morti\",\n";
-                ss << u8"    \"koKR\": \"언데드를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia nieumarłych\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los no muertos\",\n";
-                ss << u8"    \"jaJP\": \"アンデッドを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive mortos-vivos\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет нежить\",\n";
-                ss << u8"    \"zhCN\": \"复活亡灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3199,\n";
-                ss << u8"    \"Key\": \"raises Dark Ones\",\n";
-                ss << u8"    \"enUS\": \"Raises Dark Ones\",\n";
-                ss << u8"    \"zhTW\": \"復活暗黑沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Erweckt dunkle Kreaturen\",\n";
-                ss << u8"    \"esES\": \"Invoca oscuros\",\n";
-                ss << u8"    \"frFR\": \"Invoque des sombres\",\n";
-                ss << u8"    \"itIT\": \"Rianima Oscuri\",\n";
-                ss << u8"    \"koKR\": \"어둠의 악마를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia mrocznych\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Oscuros\",\n";
-                ss << u8"    \"jaJP\": \"ダーク・ワンを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive trevosos\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет темных\",\n";
-                ss << u8"    \"zhCN\": \"复活暗魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3200,\n";
-                ss << u8"    \"Key\": \"raises Devilkin\",\n";
-                ss << u8"    \"enUS\": \"Raises Devilkin\",\n";
-                ss << u8"    \"zhTW\": \"復活魔妖沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Teufelskreaturen\",\n";
-                ss << u8"    \"esES\": \"Invoca diabólicos\",\n";
-                ss << u8"    \"frFR\": \"Invoque des démonoïdes\",\n";
-                ss << u8"    \"itIT\": \"Rianima Malefici\",\n";
-                ss << u8"    \"koKR\": \"악마피붙이를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia diabliki\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Demonantes\",\n";
-                ss << u8"    \"jaJP\": \"デビルキンを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive demonantes\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет дьяволят\",\n";
-                ss << u8"    \"zhCN\": \"复活小恶魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3201,\n";
-                ss << u8"    \"Key\": \"raises Carvers\",\n";
-                ss << u8"    \"enUS\": \"Raises Carvers\",\n";
-                ss << u8"    \"zhTW\": \"復活刨肉沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Schlächter\",\n";
-                ss << u8"    \"esES\": \"Invoca trinchantes\",\n";
-                ss << u8"    \"frFR\": \"Invoque des équarrisseurs\",\n";
-                ss << u8"    \"itIT\": \"Rianima Incisori\",\n";
-                ss << u8"    \"koKR\": \"도륙자를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia wycinaczy\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Talladores\",\n";
-                ss << u8"    \"jaJP\": \"カーヴァーを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive entalhadores\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет плоторезов\",\n";
-                ss << u8"    \"zhCN\": \"复活利刃魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3202,\n";
-                ss << u8"    \"Key\": \"raises Fallen\",\n";
-                ss << u8"    \"enUS\": \"Raises Fallen\",\n";
-                ss << u8"    \"zhTW\": \"復活沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Erweckt Gefallene\",\n";
-                ss << u8"    \"esES\": \"Invoca caídos\",\n";
-                ss << u8"    \"frFR\": \"Invoque des déchus\",\n";
-                ss << u8"    \"itIT\": \"Rianima Caduti\",\n";
-                ss << u8"    \"koKR\": \"몰락자를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia upadłych\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Caídos\",\n";
-                ss << u8"    \"jaJP\": \"フォールンを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive decaídos\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет падших\",\n";
-                ss << u8"    \"zhCN\": \"复活沉沦魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3203,\n";
-                ss << u8"    \"Key\": \"raises Warped Fallen\",\n";
-                ss << u8"    \"enUS\": \"Raises The Warped\",\n";
-                ss << u8"    \"zhTW\": \"復活扭曲沉淪魔\",\n";
-                ss << u8"    \"deDE\": \"Erweckt die Verdrehten\",\n";
-                ss << u8"    \"esES\": \"Invoca retorcidos\",\n";
-                ss << u8"    \"frFR\": \"Invoque le Perverti\",\n";
-                ss << u8"    \"itIT\": \"Rianima Deformi\",\n";
-                ss << u8"    \"koKR\": \"뒤틀린 악마를 되살림\",\n";
-                ss << u8"    \"plPL\": \"Ożywia spaczeńców\",\n";
-                ss << u8"    \"esMX\": \"Resucita a los Retorcidos\",\n";
-                ss << u8"    \"jaJP\": \"ウォープト・ワンを復活させる\",\n";
-                ss << u8"    \"ptBR\": \"Revive distorcidos\",\n";
-                ss << u8"    \"ruRU\": \"Оживляет искаженных\",\n";
-                ss << u8"    \"zhCN\": \"复活扭曲魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3204,\n";
-                ss << u8"    \"Key\": \"shocking hit\",\n";
-                ss << u8"    \"enUS\": \"shocking hit\",\n";
-                ss << u8"    \"zhTW\": \"放電攻擊\",\n";
-                ss << u8"    \"deDE\": \"Schockangriff\",\n";
-                ss << u8"    \"esES\": \"Golpe eléctrico\",\n";
-                ss << u8"    \"frFR\": \"Choc électrique\",\n";
-                ss << u8"    \"itIT\": \"Colpo fulminante\",\n";
-                ss << u8"    \"koKR\": \"감전 공격\",\n";
-                ss << u8"    \"plPL\": \"Porażające uderzenie\",\n";
-                ss << u8"    \"esMX\": \"Golpe eléctrico\",\n";
-                ss << u8"    \"jaJP\": \"電撃攻撃\",\n";
-                ss << u8"    \"ptBR\": \"acerto elétrico\",\n";
-                ss << u8"    \"ruRU\": \"Шокирующий удар\",\n";
-                ss << u8"    \"zhCN\": \"闪电打击\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3205,\n";
-                ss << u8"    \"Key\": \"uniquextrastrong\",\n";
-                ss << u8"    \"enUS\": \"Extra Strong\",\n";
-                ss << u8"    \"zhTW\": \"特別強壯\",\n";
-                ss << u8"    \"deDE\": \"Extra stark\",\n";
-                ss << u8"    \"esES\": \"Extrafuerte\",\n";
-                ss << u8"    \"frFR\": \"Très fort\",\n";
-                ss << u8"    \"itIT\": \"Forza extra\",\n";
-                ss << u8"    \"koKR\": \"매우 강함\",\n";
-                ss << u8"    \"plPL\": \"Wyjątkowa siła\",\n";
-                ss << u8"    \"esMX\": \"Extra fuerte\",\n";
-                ss << u8"    \"jaJP\": \"屈強\",\n";
-                ss << u8"    \"ptBR\": \"Extraforte\",\n";
-                ss << u8"    \"ruRU\": \"Сверхсила\",\n";
-                ss << u8"    \"zhCN\": \"额外强壮\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3206,\n";
-                ss << u8"    \"Key\": \"uniqueextrafast\",\n";
-                ss << u8"    \"enUS\": \"Extra Fast\",\n";
-                ss << u8"    \"zhTW\": \"特別快速\",\n";
-                ss << u8"    \"deDE\": \"Extra schnell\",\n";
-                ss << u8"    \"esES\": \"Extrarrápido\",\n";
-                ss << u8"    \"frFR\": \"Très rapide\",\n";
-                ss << u8"    \"itIT\": \"Velocità extra\",\n";
-                ss << u8"    \"koKR\": \"매우 빠름\",\n";
-                ss << u8"    \"plPL\": \"Wyjątkowa szybkość\",\n";
-                ss << u8"    \"esMX\": \"Extra rápido\",\n";
-                ss << u8"    \"jaJP\": \"俊敏\",\n";
-                ss << u8"    \"ptBR\": \"Extrarrápido\",\n";
-                ss << u8"    \"ruRU\": \"Стремительность\",\n";
-                ss << u8"    \"zhCN\": \"额外快速\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3207,\n";
-                ss << u8"    \"Key\": \"uniquecursed\",\n";
-                ss << u8"    \"enUS\": \"Cursed\",\n";
-                ss << u8"    \"zhTW\": \"施加詛咒\",\n";
-                ss << u8"    \"deDE\": \"Verflucht\",\n";
-                ss << u8"    \"esES\": \"Maldito\",\n";
-                ss << u8"    \"frFR\": \"Maudit\",\n";
-                ss << u8"    \"itIT\": \"Anatemi\",\n";
-                ss << u8"    \"koKR\": \"저주받음\",\n";
-                ss << u8"    \"plPL\": \"Przekleństwo\",\n";
-                ss << u8"    \"esMX\": \"Maldecido\",\n";
-                ss << u8"    \"jaJP\": \"呪い\",\n";
-                ss << u8"    \"ptBR\": \"Amaldiçoado\",\n";
-                ss << u8"    \"ruRU\": \"Проклятие\",\n";
-                ss << u8"    \"zhCN\": \"诅咒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3208,\n";
-                ss << u8"    \"Key\": \"uniquemagicresistance\",\n";
-                ss << u8"    \"enUS\": \"Magic Resistant\",\n";
-                ss << u8"    \"zhTW\": \"魔法抗性\",\n";
-                ss << u8"    \"deDE\": \"Magieresistent\",\n";
-                ss << u8"    \"esES\": \"Resistencia a la magia\",\n";
-                ss << u8"    \"frFR\": \"Résiste à la magie\",\n";
-                ss << u8"    \"itIT\": \"Resistenza magica\",\n";
-                ss << u8"    \"koKR\": \"마법 저항\",\n";
-                ss << u8"    \"plPL\": \"Odporność na magię\",\n";
-                ss << u8"    \"esMX\": \"Resistente a la magia\",\n";
-                ss << u8"    \"jaJP\": \"魔法耐性\",\n";
-                ss << u8"    \"ptBR\": \"Resistente a Magia\",\n";
-                ss << u8"    \"ruRU\": \"Сопротивление магии\",\n";
-                ss << u8"    \"zhCN\": \"魔法抵抗\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3209,\n";
-                ss << u8"    \"Key\": \"uniquefireenchanted\",\n";
-                ss << u8"    \"enUS\": \"Fire Enchanted\",\n";
-                ss << u8"    \"zhTW\": \"火焰強化\",\n";
-                ss << u8"    \"deDE\": \"Feuerverzauberung\",\n";
-                ss << u8"    \"esES\": \"Encantamiento de fuego\",\n";
-                ss << u8"    \"frFR\": \"Enchanté par le feu\",\n";
-                ss << u8"    \"itIT\": \"Ardente\",\n";
-                ss << u8"    \"koKR\": \"화염 강화\",\n";
-                ss << u8"    \"plPL\": \"Zaklęty ogień\",\n";
-                ss << u8"    \"esMX\": \"Daño de fuego\",\n";
-                ss << u8"    \"jaJP\": \"火炎強化\",\n";
-                ss << u8"    \"ptBR\": \"Encantamento Ígneo\",\n";
-                ss << u8"    \"ruRU\": \"Чары огня\",\n";
-                ss << u8"    \"zhCN\": \"火焰强化\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3210,\n";
-                ss << u8"    \"Key\": \"monsteruniqueprop1\",\n";
-                ss << u8"    \"enUS\": \"Cold Enchanted\",\n";
-                ss << u8"    \"zhTW\": \"冰寒強化\",\n";
-                ss << u8"    \"deDE\": \"Kälteverzauberung\",\n";
-                ss << u8"    \"esES\": \"Encantamiento de frío\",\n";
-                ss << u8"    \"frFR\": \"Enchanté par le froid\",\n";
-                ss << u8"    \"itIT\": \"Congelante\",\n";
-                ss << u8"    \"koKR\": \"냉기 강화\",\n";
-                ss << u8"    \"plPL\": \"Zaklęte zimno\",\n";
-                ss << u8"    \"esMX\": \"Daño de frío\",\n";
-                ss << u8"    \"jaJP\": \"冷気強化\",\n";
-                ss << u8"    \"ptBR\": \"Encantamento Gélido\",\n";
-                ss << u8"    \"ruRU\": \"Чары льда\",\n";
-                ss << u8"    \"zhCN\": \"冰霜强化\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3211,\n";
-                ss << u8"    \"Key\": \"monsteruniqueprop2\",\n";
-                ss << u8"    \"enUS\": \"Lightning Enchanted\",\n";
-                ss << u8"    \"zhTW\": \"電擊強化\",\n";
-                ss << u8"    \"deDE\": \"Blitzverzauberung\",\n";
-                ss << u8"    \"esES\": \"Encantamiento de rayos\",\n";
-                ss << u8"    \"frFR\": \"Enchanté par la foudre\",\n";
-                ss << u8"    \"itIT\": \"Fulminante\",\n";
-                ss << u8"    \"koKR\": \"번개 강화\",\n";
-                ss << u8"    \"plPL\": \"Zaklęte błyskawice\",\n";
-                ss << u8"    \"esMX\": \"Daño de rayo\",\n";
-                ss << u8"    \"jaJP\": \"電撃強化\",\n";
-                ss << u8"    \"ptBR\": \"Encantamento Elétrico\",\n";
-                ss << u8"    \"ruRU\": \"Чары молнии\",\n";
-                ss << u8"    \"zhCN\": \"闪电强化\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3212,\n";
-                ss << u8"    \"Key\": \"monsteruniqueprop3\",\n";
-                ss << u8"    \"enUS\": \"Mana Burn\",\n";
-                ss << u8"    \"zhTW\": \"法力燃燒\",\n";
-                ss << u8"    \"deDE\": \"Manaverbrennung\",\n";
-                ss << u8"    \"esES\": \"Quemadura de maná\",\n";
-                ss << u8"    \"frFR\": \"Brûlure de mana\",\n";
-                ss << u8"    \"itIT\": \"Consuma mana\",\n";
-                ss << u8"    \"koKR\": \"마나 연소\",\n";
-                ss << u8"    \"plPL\": \"Spalanie many\",\n";
-                ss << u8"    \"esMX\": \"Quemadura de maná\",\n";
-                ss << u8"    \"jaJP\": \"マナダメージ\",\n";
-                ss << u8"    \"ptBR\": \"Exaustão de Mana\",\n";
-                ss << u8"    \"ruRU\": \"Сожжение маны\",\n";
-                ss << u8"    \"zhCN\": \"法力燃烧\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3213,\n";
-                ss << u8"    \"Key\": \"monsteruniqueprop4\",\n";
-                ss << u8"    \"enUS\": \"Spectral Hit\",\n";
-                ss << u8"    \"zhTW\": \"灌能打擊\",\n";
-                ss << u8"    \"deDE\": \"Spektralschlag\",\n";
-                ss << u8"    \"esES\": \"Golpe espectral\",\n";
-                ss << u8"    \"frFR\": \"Choc spectral\",\n";
-                ss << u8"    \"itIT\": \"Colpo spettrale\",\n";
-                ss << u8"    \"koKR\": \"혼령 공격\",\n";
-                ss << u8"    \"plPL\": \"Widmowe uderzenie\",\n";
-                ss << u8"    \"esMX\": \"Golpe espectral\",\n";
-                ss << u8"    \"jaJP\": \"スペクトラルヒット\",\n";
-                ss << u8"    \"ptBR\": \"Golpe Espectral\",\n";
-                ss << u8"    \"ruRU\": \"Призрачный удар\",\n";
-                ss << u8"    \"zhCN\": \"鬼魂打击\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3215,\n";
-                ss << u8"    \"Key\": \"monsteruniqueprop6\",\n";
-                ss << u8"    \"enUS\": \"Stone Skin\",\n";
-                ss << u8"    \"zhTW\": \"硬化外皮\",\n";
-                ss << u8"    \"deDE\": \"Steinhaut\",\n";
-                ss << u8"    \"esES\": \"Piel pétrea\",\n";
-                ss << u8"    \"frFR\": \"Peau de pierre\",\n";
-                ss << u8"    \"itIT\": \"Pelle di pietra\",\n";
-                ss << u8"    \"koKR\": \"돌가죽\",\n";
-                ss << u8"    \"plPL\": \"Kamienna skóra\",\n";
-                ss << u8"    \"esMX\": \"Piel pétrea\",\n";
-                ss << u8"    \"jaJP\": \"ストーンスキン\",\n";
-                ss << u8"    \"ptBR\": \"Pele de Pedra\",\n";
-                ss << u8"    \"ruRU\": \"Каменная кожа\",\n";
-                ss << u8"    \"zhCN\": \"石肤术\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3216,\n";
-                ss << u8"    \"Key\": \"monsteruniqueprop7\",\n";
-                ss << u8"    \"enUS\": \"Multiple Shots\",\n";
-                ss << u8"    \"zhTW\": \"多重射擊\",\n";
-                ss << u8"    \"deDE\": \"Mehrfachschüsse\",\n";
-                ss << u8"    \"esES\": \"Disparos múltiples\",\n";
-                ss << u8"    \"frFR\": \"Tirs multiples\",\n";
-                ss << u8"    \"itIT\": \"Tiro multiplo\",\n";
-                ss << u8"    \"koKR\": \"다발 사격\",\n";
-                ss << u8"    \"plPL\": \"Seria pocisków\",\n";
-                ss << u8"    \"esMX\": \"Disparos múltiples\",\n";
-                ss << u8"    \"jaJP\": \"一斉射撃\",\n";
-                ss << u8"    \"ptBR\": \"Disparos Múltiplos\",\n";
-                ss << u8"    \"ruRU\": \"Залп\",\n";
-                ss << u8"    \"zhCN\": \"多重射击\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3217,\n";
-                ss << u8"    \"Key\": \"monsteruniqueprop8\",\n";
-                ss << u8"    \"enUS\": \"Thief\",\n";
-                ss << u8"    \"zhTW\": \"偷盜\",\n";
-                ss << u8"    \"deDE\": \"Dieb\",\n";
-                ss << u8"    \"esES\": \"Ladrón\",\n";
-                ss << u8"    \"frFR\": \"Voleur\",\n";
-                ss << u8"    \"itIT\": \"Ladro\",\n";
-                ss << u8"    \"koKR\": \"도둑\",\n";
-                ss << u8"    \"plPL\": \"Złodziej\",\n";
-                ss << u8"    \"esMX\": \"Ladrón\",\n";
-                ss << u8"    \"jaJP\": \"盗賊\",\n";
-                ss << u8"    \"ptBR\": \"Ladrão\",\n";
-                ss << u8"    \"ruRU\": \"Вор\",\n";
-                ss << u8"    \"zhCN\": \"偷窃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3218,\n";
-                ss << u8"    \"Key\": \"monsteruniqueprop9\",\n";
-                ss << u8"    \"enUS\": \"Aura Enchanted\",\n";
-                ss << u8"    \"zhTW\": \"靈氣強化\",\n";
-                ss << u8"    \"deDE\": \"verzauberte Aura\",\n";
-                ss << u8"    \"esES\": \"Encantamiento de aura\",\n";
-                ss << u8"    \"frFR\": \"Enchanté par l’aura\",\n";
-                ss << u8"    \"itIT\": \"Aura incantata\",\n";
-                ss << u8"    \"koKR\": \"오라 강화\",\n";
-                ss << u8"    \"plPL\": \"Zaklęta aura\",\n";
-                ss << u8"    \"esMX\": \"Encantado con aura\",\n";
-                ss << u8"    \"jaJP\": \"オーラ強化\",\n";
-                ss << u8"    \"ptBR\": \"Encantamento de Aura\",\n";
-                ss << u8"    \"ruRU\": \"Зачарованная аура\",\n";
-                ss << u8"    \"zhCN\": \"光环强化\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3219,\n";
-                ss << u8"    \"Key\": \"This Cow Bites\",\n";
-                ss << u8"    \"enUS\": \"This Cow Bites\",\n";
-                ss << u8"    \"zhTW\": \"這頭牛會咬人\",\n";
-                ss << u8"    \"deDE\": \"Diese Kuh beißt\",\n";
-                ss << u8"    \"esES\": \"Esta vaca muerde\",\n";
-                ss << u8"    \"frFR\": \"Cette vache mord\",\n";
-                ss << u8"    \"itIT\": \"Questa mucca morde\",\n";
-                ss << u8"    \"koKR\": \"물어뜯는 공격\",\n";
-                ss << u8"    \"plPL\": \"Ta krowa gryzie\",\n";
-                ss << u8"    \"esMX\": \"Esta vaca muerde\",\n";
-                ss << u8"    \"jaJP\": \"噛みつきに注意！\",\n";
-                ss << u8"    \"ptBR\": \"Esta vaca morde\",\n";
-                ss << u8"    \"ruRU\": \"Эта корова кусается\",\n";
-                ss << u8"    \"zhCN\": \"这头奶牛咬人\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3221,\n";
-                ss << u8"    \"Key\": \"minion\",\n";
-                ss << u8"    \"enUS\": \"Minion\",\n";
-                ss << u8"    \"zhTW\": \"僕從\",\n";
-                ss << u8"    \"deDE\": \"Diener\",\n";
-                ss << u8"    \"esES\": \"Esbirro\",\n";
-                ss << u8"    \"frFR\": \"Serviteur\",\n";
-                ss << u8"    \"itIT\": \"Servo\",\n";
-                ss << u8"    \"koKR\": \"하수인\",\n";
-                ss << u8"    \"plPL\": \"Sługa\",\n";
-                ss << u8"    \"esMX\": \"Esbirro\",\n";
-                ss << u8"    \"jaJP\": \"ミニオン\",\n";
-                ss << u8"    \"ptBR\": \"Lacaio\",\n";
-                ss << u8"    \"ruRU\": \"Прислужник\",\n";
-                ss << u8"    \"zhCN\": \"爪牙\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3246,\n";
-                ss << u8"    \"Key\": \"MummyGenerator\",\n";
-                ss << u8"    \"enUS\": \"Mummy Sarcophagus\",\n";
-                ss << u8"    \"zhTW\": \"木乃伊石棺\",\n";
-                ss << u8"    \"deDE\": \"Mumiensarkophag\",\n";
-                ss << u8"    \"esES\": \"Sarcófago de momias\",\n";
-                ss << u8"    \"frFR\": \"Sarcophage de momie\",\n";
-                ss << u8"    \"itIT\": \"Sarcofago della Mummia\",\n";
-                ss << u8"    \"koKR\": \"미라 석관\",\n";
-                ss << u8"    \"plPL\": \"Sarkofag mumii\",\n";
-                ss << u8"    \"esMX\": \"Sarcófago\",\n";
-                ss << u8"    \"jaJP\": \"ミイラの棺\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Sarcófago da Múmia\",\n";
-                ss << u8"    \"ruRU\": \"Саркофаг мумии\",\n";
-                ss << u8"    \"zhCN\": \"木乃伊石棺\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3283,\n";
-                ss << u8"    \"Key\": \"skeleton\",\n";
-                ss << u8"    \"enUS\": \"Skeleton\",\n";
-                ss << u8"    \"zhTW\": \"骷髏\",\n";
-                ss << u8"    \"deDE\": \"Skelettkrieger\",\n";
-                ss << u8"    \"esES\": \"Esqueleto\",\n";
-                ss << u8"    \"frFR\": \"Squelette\",\n";
-                ss << u8"    \"itIT\": \"Scheletro\",\n";
-                ss << u8"    \"koKR\": \"해골\",\n";
-                ss << u8"    \"plPL\": \"Szkielet\",\n";
-                ss << u8"    \"esMX\": \"Esqueleto\",\n";
-                ss << u8"    \"jaJP\": \"スケルトン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Esqueleto\",\n";
-                ss << u8"    \"ruRU\": \"Скелет\",\n";
-                ss << u8"    \"zhCN\": \"骷髅\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3319,\n";
-                ss << u8"    \"Key\": \"Corpsefire\",\n";
-                ss << u8"    \"enUS\": \"Corpsefire\",\n";
-                ss << u8"    \"zhTW\": \"屍火\",\n";
-                ss << u8"    \"deDE\": \"Totenfeuer\",\n";
-                ss << u8"    \"esES\": \"Fuego de Cadáveres\",\n";
-                ss << u8"    \"frFR\": \"Crémation\",\n";
-                ss << u8"    \"itIT\": \"Cadavere Infuocato\",\n";
-                ss << u8"    \"koKR\": \"불타는 시체\",\n";
-                ss << u8"    \"plPL\": \"Gorejący Trup\",\n";
-                ss << u8"    \"esMX\": \"Cadáver ardiente\",\n";
-                ss << u8"    \"jaJP\": \"コープス・ファイア\",\n";
-                ss << u8"    \"ptBR\": \"Flamorto\",\n";
-                ss << u8"    \"ruRU\": \"Пылающий труп\",\n";
-                ss << u8"    \"zhCN\": \"尸体发火\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10002,\n";
-                ss << u8"    \"Key\": \"Mauler\",\n";
-                ss << u8"    \"enUS\": \"Mauler\",\n";
-                ss << u8"    \"zhTW\": \"重擊巨怪\",\n";
-                ss << u8"    \"deDE\": \"Schläger\",\n";
-                ss << u8"    \"esES\": \"Vapuleador\",\n";
-                ss << u8"    \"frFR\": \"Marteleur\",\n";
-                ss << u8"    \"itIT\": \"Distruttore\",\n";
-                ss << u8"    \"koKR\": \"망치주먹\",\n";
-                ss << u8"    \"plPL\": \"Oprawca\",\n";
-                ss << u8"    \"esMX\": \"Mutilador\",\n";
-                ss << u8"    \"jaJP\": \"モーラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Marretador\",\n";
-                ss << u8"    \"ruRU\": \"Мучитель\",\n";
-                ss << u8"    \"zhCN\": \"巨槌魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10077,\n";
-                ss << u8"    \"Key\": \"UndeadDescriptX\",\n";
-                ss << u8"    \"enUS\": \"Undead\",\n";
-                ss << u8"    \"zhTW\": \"不死怪物\",\n";
-                ss << u8"    \"deDE\": \"Untoter\",\n";
-                ss << u8"    \"esES\": \"Muerto viviente\",\n";
-                ss << u8"    \"frFR\": \"Mort-vivant\",\n";
-                ss << u8"    \"itIT\": \"Non morto\",\n";
-                ss << u8"    \"koKR\": \"언데드\",\n";
-                ss << u8"    \"plPL\": \"Nieumarły\",\n";
-                ss << u8"    \"esMX\": \"No muerto\",\n";
-                ss << u8"    \"jaJP\": \"＜アンデッド＞\",\n";
-                ss << u8"    \"ptBR\": \"Morto-vivo\",\n";
-                ss << u8"    \"ruRU\": \"Нежить\",\n";
-                ss << u8"    \"zhCN\": \"亡灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10078,\n";
-                ss << u8"    \"Key\": \"DemonID\",\n";
-                ss << u8"    \"enUS\": \"Demon\",\n";
-                ss << u8"    \"zhTW\": \"惡魔\",\n";
-                ss << u8"    \"deDE\": \"Dämon\",\n";
-                ss << u8"    \"esES\": \"Demonio\",\n";
-                ss << u8"    \"frFR\": \"Démon\",\n";
-                ss << u8"    \"itIT\": \"Demone\",\n";
-                ss << u8"    \"koKR\": \"악마\",\n";
-                ss << u8"    \"plPL\": \"Demon\",\n";
-                ss << u8"    \"esMX\": \"Demonio\",\n";
-                ss << u8"    \"jaJP\": \"＜デーモン＞\",\n";
-                ss << u8"    \"ptBR\": \"Demônio\",\n";
-                ss << u8"    \"ruRU\": \"Демон\",\n";
-                ss << u8"    \"zhCN\": \"恶魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10908,\n";
-                ss << u8"    \"Key\": \"DarkStalker\",\n";
-                ss << u8"    \"enUS\": \"Dark Stalker\",\n";
-                ss << u8"    \"zhTW\": \"黑暗潛襲者\",\n";
-                ss << u8"    \"deDE\": \"Dunkle Schleicherin\",\n";
-                ss << u8"    \"esES\": \"Acechadora de la oscuridad\",\n";
-                ss << u8"    \"frFR\": \"Vagabond sombre\",\n";
-                ss << u8"    \"itIT\": \"Predatrice Oscura\",\n";
-                ss << u8"    \"koKR\": \"어둠의 추적자\",\n";
-                ss << u8"    \"plPL\": \"Mroczna tropicielka\",\n";
-                ss << u8"    \"esMX\": \"Acechadora oscura\",\n";
-                ss << u8"    \"jaJP\": \"闇の追跡者\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Perseguidora Sombria\",\n";
-                ss << u8"    \"ruRU\": \"Темная следопытка\",\n";
-                ss << u8"    \"zhCN\": \"黑暗偷袭者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 10909,\n";
-                ss << u8"    \"Key\": \"VileArcher\",\n";
-                ss << u8"    \"enUS\": \"Vile Archer\",\n";
-                ss << u8"    \"zhTW\": \"兇邪弓箭手\",\n";
-                ss << u8"    \"deDE\": \"Böse Bogenschützin\",\n";
-                ss << u8"    \"esES\": \"Arquera vil\",\n";
-                ss << u8"    \"frFR\": \"Archère inhumaine\",\n";
-                ss << u8"    \"itIT\": \"Arciera Vile\",\n";
-                ss << u8"    \"koKR\": \"끔찍한 궁수\",\n";
-                ss << u8"    \"plPL\": \"Nikczemna łuczniczka\",\n";
-                ss << u8"    \"esMX\": \"Arquera vil\",\n";
-                ss << u8"    \"jaJP\": \"穢れし弓使い\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Arqueira Vil\",\n";
-                ss << u8"    \"ruRU\": \"Злобная лучница\",\n";
-                ss << u8"    \"zhCN\": \"邪恶弓手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11007,\n";
-                ss << u8"    \"Key\": \"TrappDoor\",\n";
-                ss << u8"    \"enUS\": \"Trap Door\",\n";
-                ss << u8"    \"zhTW\": \"暗門\",\n";
-                ss << u8"    \"deDE\": \"Falltür\",\n";
-                ss << u8"    \"esES\": \"Trampilla\",\n";
-                ss << u8"    \"frFR\": \"Trappe\",\n";
-                ss << u8"    \"itIT\": \"Botola\",\n";
-                ss << u8"    \"koKR\": \"함정 문\",\n";
-                ss << u8"    \"plPL\": \"Klapa\",\n";
-                ss << u8"    \"esMX\": \"Trampilla\",\n";
-                ss << u8"    \"jaJP\": \"落とし戸\",\n";
-                ss << u8"    \"ptBR\": \"Alçapão\",\n";
-                ss << u8"    \"ruRU\": \"Черный ход\",\n";
-                ss << u8"    \"zhCN\": \"活板门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11013,\n";
-                ss << u8"    \"Key\": \"Fiendra\",\n";
-                ss << u8"    \"enUS\": \"Fiend\",\n";
-                ss << u8"    \"zhTW\": \"魔蝠\",\n";
-                ss << u8"    \"deDE\": \"Teufel\",\n";
-                ss << u8"    \"esES\": \"Maligno\",\n";
-                ss << u8"    \"frFR\": \"Fiel\",\n";
-                ss << u8"    \"itIT\": \"del Demonio\",\n";
-                ss << u8"    \"koKR\": \"마귀\",\n";
-                ss << u8"    \"plPL\": \"[fs]Biesowa[ms]Biesowy[nl]Biesowe\",\n";
-                ss << u8"    \"esMX\": \"[ms]diablesco[fs]diablesca[mp]diablescos[fp]diablescas\",\n";
-                ss << u8"    \"jaJP\": \"魔魅なる\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Satânica[ms]Satânico[fp]Satânicas[mp]Satânicos\",\n";
-                ss << u8"    \"ruRU\": \"[ms]изуверский[fs]изуверская[ns]изуверское[pl]изуверские\",\n";
-                ss << u8"    \"zhCN\": \"妖蝠\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11014,\n";
-                ss << u8"    \"Key\": \"Wraithra\",\n";
-                ss << u8"    \"enUS\": \"Wraith\",\n";
-                ss << u8"    \"zhTW\": \"怨靈\",\n";
-                ss << u8"    \"deDE\": \"Gespenst\",\n";
-                ss << u8"    \"esES\": \"Ánima\",\n";
-                ss << u8"    \"frFR\": \"Spectre\",\n";
-                ss << u8"    \"itIT\": \"dello Spettro\",\n";
-                ss << u8"    \"koKR\": \"망령\",\n";
-                ss << u8"    \"plPL\": \"[fs]Upiorna[ms]Upiorny[nl]Upiorne\",\n";
-                ss << u8"    \"esMX\": \"[ms]de ánima[fs]de ánima[mp]de ánima[fp]de ánima\",\n";
-                ss << u8"    \"jaJP\": \"死霊の\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Espectral[ms]Espectral[fp]Espectrais[mp]Espectrais\",\n";
-                ss << u8"    \"ruRU\": \"[ms]фантомный[fs]фантомная[ns]фантомное[pl]фантомные\",\n";
-                ss << u8"    \"zhCN\": \"怨魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11015,\n";
-                ss << u8"    \"Key\": \"Fiend\",\n";
-                ss << u8"    \"enUS\": \"Fiend\",\n";
-                ss << u8"    \"zhTW\": \"魔蝠\",\n";
-                ss << u8"    \"deDE\": \"Teufel\",\n";
-                ss << u8"    \"esES\": \"Maligno\",\n";
-                ss << u8"    \"frFR\": \"Fiel\",\n";
-                ss << u8"    \"itIT\": \"Demonio\",\n";
-                ss << u8"    \"koKR\": \"마귀\",\n";
-                ss << u8"    \"plPL\": \"Bies\",\n";
-                ss << u8"    \"esMX\": \"Diablejo\",\n";
-                ss << u8"    \"jaJP\": \"悪魔\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Demônio Alado\",\n";
-                ss << u8"    \"ruRU\": \"Бес\",\n";
-                ss << u8"    \"zhCN\": \"妖蝠\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11016,\n";
-                ss << u8"    \"Key\": \"Wraith\",\n";
-                ss << u8"    \"enUS\": \"Wraith\",\n";
-                ss << u8"    \"zhTW\": \"怨靈\",\n";
-                ss << u8"    \"deDE\": \"Gespenst\",\n";
-                ss << u8"    \"esES\": \"Ánima\",\n";
-                ss << u8"    \"frFR\": \"Spectre\",\n";
-                ss << u8"    \"itIT\": \"Spettro\",\n";
-                ss << u8"    \"koKR\": \"망령\",\n";
-                ss << u8"    \"plPL\": \"Widmo\",\n";
-                ss << u8"    \"esMX\": \"Ánima\",\n";
-                ss << u8"    \"jaJP\": \"レイス\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Espectro\",\n";
-                ss << u8"    \"ruRU\": \"Дух\",\n";
-                ss << u8"    \"zhCN\": \"怨魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11029,\n";
-                ss << u8"    \"Key\": \"eats and spits corpses\",\n";
-                ss << u8"    \"enUS\": \"Eats and Spits Corpses\",\n";
-                ss << u8"    \"zhTW\": \"吞食與吐出屍體\",\n";
-                ss << u8"    \"deDE\": \"Frisst und spuckt Leichen\",\n";
-                ss << u8"    \"esES\": \"Come y escupe cadáveres\",\n";
-                ss << u8"    \"frFR\": \"Mange et crache des cadavres\",\n";
-                ss << u8"    \"itIT\": \"Mangia e sputa cadaveri\",\n";
-                ss << u8"    \"koKR\": \"시체를 먹고 뱉음\",\n";
-                ss << u8"    \"plPL\": \"Pożera zwłoki i nimi pluje\",\n";
-                ss << u8"    \"esMX\": \"Come y escupe cadáveres\",\n";
-                ss << u8"    \"jaJP\": \"死体を食べて吐き出す\",\n";
-                ss << u8"    \"ptBR\": \"Come e cospe cadáveres\",\n";
-                ss << u8"    \"ruRU\": \"Пожирает и извергает трупы\",\n";
-                ss << u8"    \"zhCN\": \"吃吐尸体\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11031,\n";
-                ss << u8"    \"Key\": \"Shocking Hit\",\n";
-                ss << u8"    \"enUS\": \"Shocking Hit\",\n";
-                ss << u8"    \"zhTW\": \"放電攻擊\",\n";
-                ss << u8"    \"deDE\": \"Schockangriff\",\n";
-                ss << u8"    \"esES\": \"Golpe de conmoción\",\n";
-                ss << u8"    \"frFR\": \"Choc brutal\",\n";
-                ss << u8"    \"itIT\": \"Colpo fulminante\",\n";
-                ss << u8"    \"koKR\": \"감전 공격\",\n";
-                ss << u8"    \"plPL\": \"Porażające uderzenie\",\n";
-                ss << u8"    \"esMX\": \"Golpe eléctrico\",\n";
-                ss << u8"    \"jaJP\": \"電撃攻撃\",\n";
-                ss << u8"    \"ptBR\": \"Acerto elétrico\",\n";
-                ss << u8"    \"ruRU\": \"Шокирующий удар\",\n";
-                ss << u8"    \"zhCN\": \"闪电打击\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11084,\n";
-                ss << u8"    \"Key\": \"champghostlyX\",\n";
-                ss << u8"    \"enUS\": \"Ghostly\",\n";
-                ss << u8"    \"zhTW\": \"幽靈\",\n";
-                ss << u8"    \"deDE\": \"[ms]geisterhafter[fs]geisterhafte[ns]geisterhaftes[pl]geisterhafte\",\n";
-                ss << u8"    \"esES\": \"Fantasmal\",\n";
-                ss << u8"    \"frFR\": \"[ms]fantomatique[fs]fantomatique[mp]fantomatiques[fp]fantomatiques\",\n";
-                ss << u8"    \"itIT\": \"Fantasma\",\n";
-                ss << u8"    \"koKR\": \"유령\",\n";
-                ss << u8"    \"plPL\": \"Duch –\",\n";
-                ss << u8"    \"esMX\": \"[ms]fantasmal[fs]fantasmal[mp]fantasmales[fp]fantasmales\",\n";
-                ss << u8"    \"jaJP\": \"幽かなる\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Fantasmagórica[ms]Fantasmagórico[fp]Fantasmagóricas[mp]Fantasmagóricos\",\n";
-                ss << u8"    \"ruRU\": \"призрак\",\n";
-                ss << u8"    \"zhCN\": \"[厉魂]\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11086,\n";
-                ss << u8"    \"Key\": \"champpossessedX\",\n";
-                ss << u8"    \"enUS\": \"Possessed\",\n";
-                ss << u8"    \"zhTW\": \"著魔\",\n";
-                ss << u8"    \"deDE\": \"[ms]besessener[fs]besessene[ns]besessenes[pl]besessene\",\n";
-                ss << u8"    \"esES\": \"[fs]poseída[ms]poseído[fp]poseídas[mp]poseídos\",\n";
-                ss << u8"    \"frFR\": \"[ms]possédé[fs]possédée[mp]possédés[fp]possédées\",\n";
-                ss << u8"    \"itIT\": \"Senz'Anima\",\n";
-                ss << u8"    \"koKR\": \"빙의된\",\n";
-                ss << u8"    \"plPL\": \"Opętana istota –\",\n";
-                ss << u8"    \"esMX\": \"[ms]poseído[fs]poseída[mp]poseídos[fp]poseídas\",\n";
-                ss << u8"    \"jaJP\": \"憑りつかれた\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Possuída[ms]Possuído[fp]Possuídas[mp]Possuídos\",\n";
-                ss << u8"    \"ruRU\": \"одержимость\",\n";
-                ss << u8"    \"zhCN\": \"[邪魔附身]\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11154,\n";
-                ss << u8"    \"Key\": \"Lilith\",\n";
-                ss << u8"    \"enUS\": \"Lilith\",\n";
-                ss << u8"    \"zhTW\": \"莉莉絲\",\n";
-                ss << u8"    \"deDE\": \"Lilith\",\n";
-                ss << u8"    \"esES\": \"Lilith\",\n";
-                ss << u8"    \"frFR\": \"Lilith\",\n";
-                ss << u8"    \"itIT\": \"Lilith\",\n";
-                ss << u8"    \"koKR\": \"릴리트\",\n";
-                ss << u8"    \"plPL\": \"Lilit\",\n";
-                ss << u8"    \"esMX\": \"Lilith\",\n";
-                ss << u8"    \"jaJP\": \"リリス\",\n";
-                ss << u8"    \"ptBR\": \"Lilith\",\n";
-                ss << u8"    \"ruRU\": \"Лилит\",\n";
-                ss << u8"    \"zhCN\": \"莉莉丝\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21851,\n";
-                ss << u8"    \"Key\": \"Baal Subject 1\",\n";
-                ss << u8"    \"enUS\": \"Colenzo the Annihilator\",\n";
-                ss << u8"    \"zhTW\": \"破壞者卡蘭索\",\n";
-                ss << u8"    \"deDE\": \"Colenzo der Vernichter\",\n";
-                ss << u8"    \"esES\": \"Colenzo el Aniquilador\",\n";
-                ss << u8"    \"frFR\": \"Colenzo l’Annihilateur\",\n";
-                ss << u8"    \"itIT\": \"Colenzo il Distruttore\",\n";
-                ss << u8"    \"koKR\": \"종결자 콜렌조\",\n";
-                ss << u8"    \"plPL\": \"Colenzo Niszczyciel\",\n";
-                ss << u8"    \"esMX\": \"Colenzo el Aniquilador\",\n";
-                ss << u8"    \"jaJP\": \"根絶やしのコレンゾ\",\n";
-                ss << u8"    \"ptBR\": \"Colenzo, o Aniquilador\",\n";
-                ss << u8"    \"ruRU\": \"Колензо Аннигилятор\",\n";
-                ss << u8"    \"zhCN\": \"卡兰索·破坏者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21852,\n";
-                ss << u8"    \"Key\": \"Baal Subject 2\",\n";
-                ss << u8"    \"enUS\": \"Achmel the Cursed\",\n";
-                ss << u8"    \"zhTW\": \"詛咒的阿克姆\",\n";
-                ss << u8"    \"deDE\": \"Achmel der Verfluchte\",\n";
-                ss << u8"    \"esES\": \"Achmel el Maldito\",\n";
-                ss << u8"    \"frFR\": \"Achmel le Maudit\",\n";
-                ss << u8"    \"itIT\": \"Achmel il Maledetto\",\n";
-                ss << u8"    \"koKR\": \"저주받은 자 아크멜\",\n";
-                ss << u8"    \"plPL\": \"Achmel Przeklęty\",\n";
-                ss << u8"    \"esMX\": \"Achmel el Maldito\",\n";
-                ss << u8"    \"jaJP\": \"呪われしアクメル\",\n";
-                ss << u8"    \"ptBR\": \"Achmel, o Amaldiçoado\",\n";
-                ss << u8"    \"ruRU\": \"Акмел Проклятый\",\n";
-                ss << u8"    \"zhCN\": \"阿克姆·被诅咒者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21853,\n";
-                ss << u8"    \"Key\": \"Baal Subject 3\",\n";
-                ss << u8"    \"enUS\": \"Bartuc the Bloody\",\n";
-                ss << u8"    \"zhTW\": \"血腥的霸圖克\",\n";
-                ss << u8"    \"deDE\": \"Batuc der Blutige\",\n";
-                ss << u8"    \"esES\": \"Bartuc el Sangriento\",\n";
-                ss << u8"    \"frFR\": \"Bartuc le Sanglant\",\n";
-                ss << u8"    \"itIT\": \"Bartuc il Sanguinario\",\n";
-                ss << u8"    \"koKR\": \"피투성이 바르툭\",\n";
-                ss << u8"    \"plPL\": \"Krwawy Bartuk\",\n";
-                ss << u8"    \"esMX\": \"Bartuc el Sangriento\",\n";
-                ss << u8"    \"jaJP\": \"血まみれバルトゥク\",\n";
-                ss << u8"    \"ptBR\": \"Bartuc, o Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Бартук Кровавый\",\n";
-                ss << u8"    \"zhCN\": \"嗜血的巴图克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21854,\n";
-                ss << u8"    \"Key\": \"Baal Subject 4\",\n";
-                ss << u8"    \"enUS\": \"Ventar the Unholy\",\n";
-                ss << u8"    \"zhTW\": \"不潔的凡塔\",\n";
-                ss << u8"    \"deDE\": \"Ventar der Unheilige\",\n";
-                ss << u8"    \"esES\": \"Ventar el Pecaminoso\",\n";
-                ss << u8"    \"frFR\": \"Ventar l’Impie\",\n";
-                ss << u8"    \"itIT\": \"Ventar l'Empio\",\n";
-                ss << u8"    \"koKR\": \"부정한 자 벤타르\",\n";
-                ss << u8"    \"plPL\": \"Ventar Wyklęty\",\n";
-                ss << u8"    \"esMX\": \"Ventar el Impío\",\n";
-                ss << u8"    \"jaJP\": \"不浄なるヴェンター\",\n";
-                ss << u8"    \"ptBR\": \"Ventar, o Profano\",\n";
-                ss << u8"    \"ruRU\": \"Вентар Нечестивый\",\n";
-                ss << u8"    \"zhCN\": \"温塔尔·不洁者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21855,\n";
-                ss << u8"    \"Key\": \"Baal Subject 5\",\n";
-                ss << u8"    \"enUS\": \"Lister the Tormentor\",\n";
-                ss << u8"    \"zhTW\": \"折磨者立斯特\",\n";
-                ss << u8"    \"deDE\": \"Lister der Quäler\",\n";
-                ss << u8"    \"esES\": \"Lister el Torturador\",\n";
-                ss << u8"    \"frFR\": \"Lister le Tourmenteur\",\n";
-                ss << u8"    \"itIT\": \"Lister il Tormentatore\",\n";
-                ss << u8"    \"koKR\": \"고문자 리스터\",\n";
-                ss << u8"    \"plPL\": \"Lister Oprawca\",\n";
-                ss << u8"    \"esMX\": \"Lister el Atormentador\",\n";
-                ss << u8"    \"jaJP\": \"暴虐のリスター\",\n";
-                ss << u8"    \"ptBR\": \"Lister, o Atormentador\",\n";
-                ss << u8"    \"ruRU\": \"Листер Истязатель\",\n";
-                ss << u8"    \"zhCN\": \"利斯特·折磨者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21859,\n";
-                ss << u8"    \"Key\": \"Baal Crab Clone\",\n";
-                ss << u8"    \"enUS\": \"Baal\",\n";
-                ss << u8"    \"zhTW\": \"巴爾\",\n";
-                ss << u8"    \"deDE\": \"Baal\",\n";
-                ss << u8"    \"esES\": \"Baal\",\n";
-                ss << u8"    \"frFR\": \"Baal\",\n";
-                ss << u8"    \"itIT\": \"Baal\",\n";
-                ss << u8"    \"koKR\": \"바알\",\n";
-                ss << u8"    \"plPL\": \"Baal\",\n";
-                ss << u8"    \"esMX\": \"Baal\",\n";
-                ss << u8"    \"jaJP\": \"バール\",\n";
-                ss << u8"    \"ptBR\": \"Baal\",\n";
-                ss << u8"    \"ruRU\": \"Баал\",\n";
-                ss << u8"    \"zhCN\": \"巴尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21860,\n";
-                ss << u8"    \"Key\": \"Baal Crab to Stairs\",\n";
-                ss << u8"    \"enUS\": \"Baal\",\n";
-                ss << u8"    \"zhTW\": \"巴爾\",\n";
-                ss << u8"    \"deDE\": \"Baal\",\n";
-                ss << u8"    \"esES\": \"Baal\",\n";
-                ss << u8"    \"frFR\": \"Baal\",\n";
-                ss << u8"    \"itIT\": \"Baal\",\n";
-                ss << u8"    \"koKR\": \"바알\",\n";
-                ss << u8"    \"plPL\": \"Baal\",\n";
-                ss << u8"    \"esMX\": \"Baal\",\n";
-                ss << u8"    \"jaJP\": \"バール\",\n";
-                ss << u8"    \"ptBR\": \"Baal\",\n";
-                ss << u8"    \"ruRU\": \"Баал\",\n";
-                ss << u8"    \"zhCN\": \"巴尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21862,\n";
-                ss << u8"    \"Key\": \"Baal Subject Mummy\",\n";
-                ss << u8"    \"enUS\": \"Unraveler\",\n";
-                ss << u8"    \"zhTW\": \"解繃者\",\n";
-                ss << u8"    \"deDE\": \"Entwirrer\",\n";
-                ss << u8"    \"esES\": \"Desenredador\",\n";
-                ss << u8"    \"frFR\": \"Disloqueuse\",\n";
-                ss << u8"    \"itIT\": \"Celato\",\n";
-                ss << u8"    \"koKR\": \"풀어헤치는 자\",\n";
-                ss << u8"    \"plPL\": \"Wyzwoliciel\",\n";
-                ss << u8"    \"esMX\": \"Desenredador\",\n";
-                ss << u8"    \"jaJP\": \"綻びし者\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Desfiador\",\n";
-                ss << u8"    \"ruRU\": \"Разматыватель\",\n";
-                ss << u8"    \"zhCN\": \"剖尸者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21864,\n";
-                ss << u8"    \"Key\": \"Baals Minion\",\n";
-                ss << u8"    \"enUS\": \"Minion of Destruction\",\n";
-                ss << u8"    \"zhTW\": \"毀滅僕從\",\n";
-                ss << u8"    \"deDE\": \"Diener der Zerstörung\",\n";
-                ss << u8"    \"esES\": \"Esbirro de destrucción\",\n";
-                ss << u8"    \"frFR\": \"Serviteur de la destruction\",\n";
-                ss << u8"    \"itIT\": \"Seguace della Distruzione\",\n";
-                ss << u8"    \"koKR\": \"파괴의 하수인\",\n";
-                ss << u8"    \"plPL\": \"Sługa Zniszczenia\",\n";
-                ss << u8"    \"esMX\": \"Esbirros de la destrucción\",\n";
-                ss << u8"    \"jaJP\": \"破壊のしもべ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lacaio da Destruição\",\n";
-                ss << u8"    \"ruRU\": \"Слуга Разрушения\",\n";
-                ss << u8"    \"zhCN\": \"毁灭的爪牙\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22330,\n";
-                ss << u8"    \"Key\": \"UIFenirsui\",\n";
-                ss << u8"    \"enUS\": \"Dire Wolf\",\n";
-                ss << u8"    \"zhTW\": \"恐狼\",\n";
-                ss << u8"    \"deDE\": \"Todeswolf\",\n";
-                ss << u8"    \"esES\": \"Lobo atroz\",\n";
-                ss << u8"    \"frFR\": \"Loup féroce\",\n";
-                ss << u8"    \"itIT\": \"Lupo Feroce\",\n";
-                ss << u8"    \"koKR\": \"광포한 늑대\",\n";
-                ss << u8"    \"plPL\": \"Upiorny wilk\",\n";
-                ss << u8"    \"esMX\": \"Lobo temible\",\n";
-                ss << u8"    \"jaJP\": \"ダイアウルフ\",\n";
-                ss << u8"    \"ptBR\": \"Lobo Atroz\",\n";
-                ss << u8"    \"ruRU\": \"Лютый волк\",\n";
-                ss << u8"    \"zhCN\": \"狂狼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22331,\n";
-                ss << u8"    \"Key\": \"UiRescuedBarUI\",\n";
-                ss << u8"    \"enUS\": \"Warrior\",\n";
-                ss << u8"    \"zhTW\": \"戰士\",\n";
-                ss << u8"    \"deDE\": \"Krieger\",\n";
-                ss << u8"    \"esES\": \"Guerrero\",\n";
-                ss << u8"    \"frFR\": \"Guerrier\",\n";
-                ss << u8"    \"itIT\": \"Guerriero\",\n";
-                ss << u8"    \"koKR\": \"전사\",\n";
-                ss << u8"    \"plPL\": \"Wojownik\",\n";
-                ss << u8"    \"esMX\": \"Guerrero\",\n";
-                ss << u8"    \"jaJP\": \"ウォリアー\",\n";
-                ss << u8"    \"ptBR\": \"Guerreiro\",\n";
-                ss << u8"    \"ruRU\": \"Воин\",\n";
-                ss << u8"    \"zhCN\": \"战士\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22334,\n";
-                ss << u8"    \"Key\": \"Spike Generator\",\n";
-                ss << u8"    \"enUS\": \"Spike Generator\",\n";
-                ss << u8"    \"zhTW\": \"尖刺製造機\",\n";
-                ss << u8"    \"deDE\": \"Dornengenerator\",\n";
-                ss << u8"    \"esES\": \"Generador de pinchos\",\n";
-                ss << u8"    \"frFR\": \"Générateur d’éclairs\",\n";
-                ss << u8"    \"itIT\": \"Generatore di Spine\",\n";
-                ss << u8"    \"koKR\": \"쐐기 생성기\",\n";
-                ss << u8"    \"plPL\": \"Generator kolców\",\n";
-                ss << u8"    \"esMX\": \"Generador de púas\",\n";
-                ss << u8"    \"jaJP\": \"スパイク・ジェネレーター\",\n";
-                ss << u8"    \"ptBR\": \"Gerador de Espetos\",\n";
-                ss << u8"    \"ruRU\": \"Источник шипов\",\n";
-                ss << u8"    \"zhCN\": \"尖刺生成器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22338,\n";
-                ss << u8"    \"Key\": \"Invis Pet\",\n";
-                ss << u8"    \"enUS\": \"Pet\",\n";
-                ss << u8"    \"zhTW\": \"寵物\",\n";
-                ss << u8"    \"deDE\": \"Haustier\",\n";
-                ss << u8"    \"esES\": \"Mascota\",\n";
-                ss << u8"    \"frFR\": \"Familier\",\n";
-                ss << u8"    \"itIT\": \"Animale\",\n";
-                ss << u8"    \"koKR\": \"소환수\",\n";
-                ss << u8"    \"plPL\": \"Pomocnik\",\n";
-                ss << u8"    \"esMX\": \"Mascota\",\n";
-                ss << u8"    \"jaJP\": \"ペット\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Mascote\",\n";
-                ss << u8"    \"ruRU\": \"Питомец\",\n";
-                ss << u8"    \"zhCN\": \"宠物\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22340,\n";
-                ss << u8"    \"Key\": \"Druid Wolf\",\n";
-                ss << u8"    \"enUS\": \"Wolf\",\n";
-                ss << u8"    \"zhTW\": \"狼\",\n";
-                ss << u8"    \"deDE\": \"Wolf\",\n";
-                ss << u8"    \"esES\": \"Lobo\",\n";
-                ss << u8"    \"frFR\": \"Loup\",\n";
-                ss << u8"    \"itIT\": \"Lupo\",\n";
-                ss << u8"    \"koKR\": \"늑대\",\n";
-                ss << u8"    \"plPL\": \"Wilk\",\n";
-                ss << u8"    \"esMX\": \"Lobo\",\n";
-                ss << u8"    \"jaJP\": \"ウルフ\",\n";
-                ss << u8"    \"ptBR\": \"Lobo\",\n";
-                ss << u8"    \"ruRU\": \"Волк\",\n";
-                ss << u8"    \"zhCN\": \"狼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22341,\n";
-                ss << u8"    \"Key\": \"Druid Totem\",\n";
-                ss << u8"    \"enUS\": \"Druid Spirit\",\n";
-                ss << u8"    \"zhTW\": \"德魯伊魂靈\",\n";
-                ss << u8"    \"deDE\": \"Druidengeist\",\n";
-                ss << u8"    \"esES\": \"Espíritu druida\",\n";
-                ss << u8"    \"frFR\": \"Esprit de druide\",\n";
-                ss << u8"    \"itIT\": \"Spirito Druidico\",\n";
-                ss << u8"    \"koKR\": \"드루이드 혼령\",\n";
-                ss << u8"    \"plPL\": \"Duch druida\",\n";
-                ss << u8"    \"esMX\": \"Espíritu druida\",\n";
-                ss << u8"    \"jaJP\": \"ドルイド・スピリット\",\n";
-                ss << u8"    \"ptBR\": \"Espírito Druida\",\n";
-                ss << u8"    \"ruRU\": \"Дух друида\",\n";
-                ss << u8"    \"zhCN\": \"德鲁伊灵体\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22342,\n";
-                ss << u8"    \"Key\": \"Druid Fenris\",\n";
-                ss << u8"    \"enUS\": \"Dire Wolf\",\n";
-                ss << u8"    \"zhTW\": \"恐狼\",\n";
-                ss << u8"    \"deDE\": \"Todeswolf\",\n";
-                ss << u8"    \"esES\": \"Lobo atroz\",\n";
-                ss << u8"    \"frFR\": \"Loup féroce\",\n";
-                ss << u8"    \"itIT\": \"Lupo Feroce\",\n";
-                ss << u8"    \"koKR\": \"광포한 늑대\",\n";
-                ss << u8"    \"plPL\": \"Upiorny wilk\",\n";
-                ss << u8"    \"esMX\": \"Lobo temible\",\n";
-                ss << u8"    \"jaJP\": \"ダイアウルフ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lobo Atroz\",\n";
-                ss << u8"    \"ruRU\": \"Лютый волк\",\n";
-                ss << u8"    \"zhCN\": \"狂狼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22343,\n";
-                ss << u8"    \"Key\": \"Druid Spirit Wolf\",\n";
-                ss << u8"    \"enUS\": \"Spirit Wolf\",\n";
-                ss << u8"    \"zhTW\": \"幽靈狼\",\n";
-                ss << u8"    \"deDE\": \"Geisterwolf\",\n";
-                ss << u8"    \"esES\": \"Lobo espíritu\",\n";
-                ss << u8"    \"frFR\": \"Esprit du loup\",\n";
-                ss << u8"    \"itIT\": \"Spirito di Lupo\",\n";
-                ss << u8"    \"koKR\": \"영혼 늑대\",\n";
-                ss << u8"    \"plPL\": \"Duch wilka\",\n";
-                ss << u8"    \"esMX\": \"Lobo espiritual\",\n";
-                ss << u8"    \"jaJP\": \"スピリット・ウルフ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lobo Espiritual\",\n";
-                ss << u8"    \"ruRU\": \"Призрачный волк\",\n";
-                ss << u8"    \"zhCN\": \"灵狼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22344,\n";
-                ss << u8"    \"Key\": \"Druid Bear\",\n";
-                ss << u8"    \"enUS\": \"Grizzly\",\n";
-                ss << u8"    \"zhTW\": \"灰熊\",\n";
-                ss << u8"    \"deDE\": \"Grizzly\",\n";
-                ss << u8"    \"esES\": \"Oso pardo\",\n";
-                ss << u8"    \"frFR\": \"Grizzly\",\n";
-                ss << u8"    \"itIT\": \"Grizzly\",\n";
-                ss << u8"    \"koKR\": \"회색곰\",\n";
-                ss << u8"    \"plPL\": \"Grizzly\",\n";
-                ss << u8"    \"esMX\": \"Oso pardo\",\n";
-                ss << u8"    \"jaJP\": \"グリズリー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Urso-cinzento\",\n";
-                ss << u8"    \"ruRU\": \"Гризли\",\n";
-                ss << u8"    \"zhCN\": \"灰熊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22345,\n";
-                ss << u8"    \"Key\": \"Druid Plague Poppy\",\n";
-                ss << u8"    \"enUS\": \"Plague Poppy\",\n";
-                ss << u8"    \"zhTW\": \"瘟疫罌粟\",\n";
-                ss << u8"    \"deDE\": \"Pestmohn\",\n";
-                ss << u8"    \"esES\": \"Amapopeste\",\n";
-                ss << u8"    \"frFR\": \"Graine de peste\",\n";
-                ss << u8"    \"itIT\": \"Papavero della Piaga\",\n";
-                ss << u8"    \"koKR\": \"역병 꽃\",\n";
-                ss << u8"    \"plPL\": \"Kłącza zarazy\",\n";
-                ss << u8"    \"esMX\": \"Amapola apestada\",\n";
-                ss << u8"    \"jaJP\": \"プレイグ・ポピー\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Papoula Pestilenta\",\n";
-                ss << u8"    \"ruRU\": \"Чумной мак\",\n";
-                ss << u8"    \"zhCN\": \"瘟疫罂粟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22346,\n";
-                ss << u8"    \"Key\": \"Druid Cycle of Life\",\n";
-                ss << u8"    \"enUS\": \"Cycle of Life\",\n";
-                ss << u8"    \"zhTW\": \"生命輪迴\",\n";
-                ss << u8"    \"deDE\": \"Lebenszyklus\",\n";
-                ss << u8"    \"esES\": \"Ciclo vital\",\n";
-                ss << u8"    \"frFR\": \"Cycle de la vie\",\n";
-                ss << u8"    \"itIT\": \"Ciclo Vitale\",\n";
-                ss << u8"    \"koKR\": \"삶의 순환\",\n";
-                ss << u8"    \"plPL\": \"Cykl życia\",\n";
-                ss << u8"    \"esMX\": \"Ciclo de la vida\",\n";
-                ss << u8"    \"jaJP\": \"サイクル・オブ・ライフ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Ciclo da Vida\",\n";
-                ss << u8"    \"ruRU\": \"Жизненный цикл\",\n";
-                ss << u8"    \"zhCN\": \"生命循环\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22347,\n";
-                ss << u8"    \"Key\": \"Vine Creature\",\n";
-                ss << u8"    \"enUS\": \"Vine Creature\",\n";
-                ss << u8"    \"zhTW\": \"藤蔓生物\",\n";
-                ss << u8"    \"deDE\": \"Rankenkreatur\",\n";
-                ss << u8"    \"esES\": \"Criatura liana\",\n";
-                ss << u8"    \"frFR\": \"Créature des sarments\",\n";
-                ss << u8"    \"itIT\": \"Vite Vivente\",\n";
-                ss << u8"    \"koKR\": \"덩굴 괴물\",\n";
-                ss << u8"    \"plPL\": \"Ożywiona Winorośl\",\n";
-                ss << u8"    \"esMX\": \"Criatura de la liana\",\n";
-                ss << u8"    \"jaJP\": \"ヴァイン・クリーチャー\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Criatura Vínea\",\n";
-                ss << u8"    \"ruRU\": \"Обитатель лозы\",\n";
-                ss << u8"    \"zhCN\": \"藤蔓生物\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22348,\n";
-                ss << u8"    \"Key\": \"Eagleexp\",\n";
-                ss << u8"    \"enUS\": \"Eagle\",\n";
-                ss << u8"    \"zhTW\": \"老鷹\",\n";
-                ss << u8"    \"deDE\": \"Adler\",\n";
-                ss << u8"    \"esES\": \"Águila\",\n";
-                ss << u8"    \"frFR\": \"Aigle\",\n";
-                ss << u8"    \"itIT\": \"Aquila\",\n";
-                ss << u8"    \"koKR\": \"독수리\",\n";
-                ss << u8"    \"plPL\": \"Orzeł\",\n";
-                ss << u8"    \"esMX\": \"Águila\",\n";
-                ss << u8"    \"jaJP\": \"イーグル\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Águia\",\n";
-                ss << u8"    \"ruRU\": \"Орел\",\n";
-                ss << u8"    \"zhCN\": \"鹰\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22349,\n";
-                ss << u8"    \"Key\": \"Wolf\",\n";
-                ss << u8"    \"enUS\": \"Wolf\",\n";
-                ss << u8"    \"zhTW\": \"狼\",\n";
-                ss << u8"    \"deDE\": \"Wolf\",\n";
-                ss << u8"    \"esES\": \"Lobo\",\n";
-                ss << u8"    \"frFR\": \"Loup\",\n";
-                ss << u8"    \"itIT\": \"Lupo\",\n";
-                ss << u8"    \"koKR\": \"늑대\",\n";
-                ss << u8"    \"plPL\": \"Wilk\",\n";
-                ss << u8"    \"esMX\": \"Lobo\",\n";
-                ss << u8"    \"jaJP\": \"ウルフ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Lobo\",\n";
-                ss << u8"    \"ruRU\": \"Волк\",\n";
-                ss << u8"    \"zhCN\": \"狼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22350,\n";
-                ss << u8"    \"Key\": \"Bear\",\n";
-                ss << u8"    \"enUS\": \"Bear\",\n";
-                ss << u8"    \"zhTW\": \"熊\",\n";
-                ss << u8"    \"deDE\": \"Bär\",\n";
-                ss << u8"    \"esES\": \"Oso\",\n";
-                ss << u8"    \"frFR\": \"Ours\",\n";
-                ss << u8"    \"itIT\": \"Orso\",\n";
-                ss << u8"    \"koKR\": \"곰\",\n";
-                ss << u8"    \"plPL\": \"Niedźwiedź\",\n";
-                ss << u8"    \"esMX\": \"Oso\",\n";
-                ss << u8"    \"jaJP\": \"ベアー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Urso\",\n";
-                ss << u8"    \"ruRU\": \"Медведь\",\n";
-                ss << u8"    \"zhCN\": \"熊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22351,\n";
-                ss << u8"    \"Key\": \"Siege Door\",\n";
-                ss << u8"    \"enUS\": \"Siege Door\",\n";
-                ss << u8"    \"zhTW\": \"攻城門\",\n";
-                ss << u8"    \"deDE\": \"Belagerungstür\",\n";
-                ss << u8"    \"esES\": \"Puerta de asedio\",\n";
-                ss << u8"    \"frFR\": \"Porte de siège\",\n";
-                ss << u8"    \"itIT\": \"Porta d'Assedio\",\n";
-                ss << u8"    \"koKR\": \"공성 문\",\n";
-                ss << u8"    \"plPL\": \"Brama oblężnicza\",\n";
-                ss << u8"    \"esMX\": \"Puerta de asedio\",\n";
-                ss << u8"    \"jaJP\": \"シージ・ドア\",\n";
-                ss << u8"    \"ptBR\": \"Porta de Cerco\",\n";
-                ss << u8"    \"ruRU\": \"Трап осадной башни\",\n";
-                ss << u8"    \"zhCN\": \"攻城门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22352,\n";
-                ss << u8"    \"Key\": \"Seige Tower\",\n";
-                ss << u8"    \"enUS\": \"Seige Tower\",\n";
-                ss << u8"    \"zhTW\": \"攻城塔\",\n";
-                ss << u8"    \"deDE\": \"Belagerungsturm\",\n";
-                ss << u8"    \"esES\": \"Torre de asedio\",\n";
-                ss << u8"    \"frFR\": \"Tour de siège\",\n";
-                ss << u8"    \"itIT\": \"Torre d'Assedio\",\n";
-                ss << u8"    \"koKR\": \"공성 탑\",\n";
-                ss << u8"    \"plPL\": \"Wieża oblężnicza\",\n";
-                ss << u8"    \"esMX\": \"Torre de asedio\",\n";
-                ss << u8"    \"jaJP\": \"シージ・タワー\",\n";
-                ss << u8"    \"ptBR\": \"Torre de Cerco\",\n";
-                ss << u8"    \"ruRU\": \"Осадная башня\",\n";
-                ss << u8"    \"zhCN\": \"攻城塔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22353,\n";
-                ss << u8"    \"Key\": \"RotWalker\",\n";
-                ss << u8"    \"enUS\": \"Rot Walker\",\n";
-                ss << u8"    \"zhTW\": \"腐行者\",\n";
-                ss << u8"    \"deDE\": \"Fäulniswandler\",\n";
-                ss << u8"    \"esES\": \"Viajero podrido\",\n";
-                ss << u8"    \"frFR\": \"Marcheur putride\",\n";
-                ss << u8"    \"itIT\": \"Camminatore Putrefatto\",\n";
-                ss << u8"    \"koKR\": \"부패 방랑자\",\n";
-                ss << u8"    \"plPL\": \"Zgniłaz\",\n";
-                ss << u8"    \"esMX\": \"Errante putrefacto\",\n";
-                ss << u8"    \"jaJP\": \"ロット・ウォーカー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Caminhante Putrefato\",\n";
-                ss << u8"    \"ruRU\": \"Гниющий ходок\",\n";
-                ss << u8"    \"zhCN\": \"腐烂行骸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22354,\n";
-                ss << u8"    \"Key\": \"ReanimatedHorde\",\n";
-                ss << u8"    \"enUS\": \"Reanimated Horde\",\n";
-                ss << u8"    \"zhTW\": \"再生屍兵\",\n";
-                ss << u8"    \"deDE\": \"Wiederbelebte Horde\",\n";
-                ss << u8"    \"esES\": \"Horda reanimada\",\n";
-                ss << u8"    \"frFR\": \"Réanimé\",\n";
-                ss << u8"    \"itIT\": \"Combattente Rianimato\",\n";
-                ss << u8"    \"koKR\": \"소생한 무리\",\n";
-                ss << u8"    \"plPL\": \"Ożywione ścierwo\",\n";
-                ss << u8"    \"esMX\": \"Horda reanimada\",\n";
-                ss << u8"    \"jaJP\": \"リアニメイテッド・ホード\",\n";
-                ss << u8"    \"ptBR\": \"Horda Reanimada\",\n";
-                ss << u8"    \"ruRU\": \"Оживленный солдат\",\n";
-                ss << u8"    \"zhCN\": \"复活行尸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22355,\n";
-                ss << u8"    \"Key\": \"ProwlingDead\",\n";
-                ss << u8"    \"enUS\": \"Prowling Dead\",\n";
-                ss << u8"    \"zhTW\": \"巡行屍兵\",\n";
-                ss << u8"    \"deDE\": \"Schleichende Tote\",\n";
-                ss << u8"    \"esES\": \"Muerto merodeador\",\n";
-                ss << u8"    \"frFR\": \"Mort en maraude\",\n";
-                ss << u8"    \"itIT\": \"Carcassa Vagante\",\n";
-                ss << u8"    \"koKR\": \"배회하는 망자\",\n";
-                ss << u8"    \"plPL\": \"Szwendacz\",\n";
-                ss << u8"    \"esMX\": \"Muerto merodeador\",\n";
-                ss << u8"    \"jaJP\": \"プロウリング・デッド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cadáver Sorrateiro\",\n";
-                ss << u8"    \"ruRU\": \"Хищный мертвец\",\n";
-                ss << u8"    \"zhCN\": \"徘徊亡骨\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22356,\n";
-                ss << u8"    \"Key\": \"UnholyCorpse\",\n";
-                ss << u8"    \"enUS\": \"Unholy Corpse\",\n";
-                ss << u8"    \"zhTW\": \"穢邪屍兵\",\n";
-                ss << u8"    \"deDE\": \"Unheilige Kadaver\",\n";
-                ss << u8"    \"esES\": \"Cadáver pecaminoso\",\n";
-                ss << u8"    \"frFR\": \"Cadavre impie\",\n";
-                ss << u8"    \"itIT\": \"Cadavere Sconsacrato\",\n";
-                ss << u8"    \"koKR\": \"부정한 시체\",\n";
-                ss << u8"    \"plPL\": \"Przeklęte zwłoki\",\n";
-                ss << u8"    \"esMX\": \"Cadáver impío\",\n";
-                ss << u8"    \"jaJP\": \"アンホーリー・コープス\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cadáver Profano\",\n";
-                ss << u8"    \"ruRU\": \"Оскверненный труп\",\n";
-                ss << u8"    \"zhCN\": \"不洁尸骸\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22357,\n";
-                ss << u8"    \"Key\": \"DefiledWarrior\",\n";
-                ss << u8"    \"enUS\": \"Defiled Warrior\",\n";
-                ss << u8"    \"zhTW\": \"褻瀆戰士\",\n";
-                ss << u8"    \"deDE\": \"Entweihter Krieger\",\n";
-                ss << u8"    \"esES\": \"Guerrero deshonrado\",\n";
-                ss << u8"    \"frFR\": \"Guerrier déchu\",\n";
-                ss << u8"    \"itIT\": \"Guerriero Profanato\",\n";
-                ss << u8"    \"koKR\": \"더럽혀진 전사\",\n";
-                ss << u8"    \"plPL\": \"Splugawiony wojownik\",\n";
-                ss << u8"    \"esMX\": \"Guerrero profano\",\n";
-                ss << u8"    \"jaJP\": \"デファイルド・ウォリアー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Guerreiro Profanado\",\n";
-                ss << u8"    \"ruRU\": \"Потревоженный воин\",\n";
-                ss << u8"    \"zhCN\": \"污邪战士\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22358,\n";
-                ss << u8"    \"Key\": \"Siege Beast\",\n";
-                ss << u8"    \"enUS\": \"Siege Beast\",\n";
-                ss << u8"    \"zhTW\": \"攻城獸\",\n";
-                ss << u8"    \"deDE\": \"Belagerungsbestie\",\n";
-                ss << u8"    \"esES\": \"Bestia de asedio\",\n";
-                ss << u8"    \"frFR\": \"Bête de siège\",\n";
-                ss << u8"    \"itIT\": \"Bestia d'Assedio\",\n";
-                ss << u8"    \"koKR\": \"공성 야수\",\n";
-                ss << u8"    \"plPL\": \"Bestia oblężnicza\",\n";
-                ss << u8"    \"esMX\": \"Bestia asediadora\",\n";
-                ss << u8"    \"jaJP\": \"シージ・ビースト\",\n";
-                ss << u8"    \"ptBR\": \"Fera de Cerco\",\n";
-                ss << u8"    \"ruRU\": \"Осадный зверь\",\n";
-                ss << u8"    \"zhCN\": \"攻城兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22359,\n";
-                ss << u8"    \"Key\": \"CrushBiest\",\n";
-                ss << u8"    \"enUS\": \"Crush Beast\",\n";
-                ss << u8"    \"zhTW\": \"重擊攻城獸\",\n";
-                ss << u8"    \"deDE\": \"Zerquetscher\",\n";
-                ss << u8"    \"esES\": \"Bestia aplastadora\",\n";
-                ss << u8"    \"frFR\": \"Bête de choc\",\n";
-                ss << u8"    \"itIT\": \"Bestia Demolitrice\",\n";
-                ss << u8"    \"koKR\": \"분쇄 야수\",\n";
-                ss << u8"    \"plPL\": \"Miażdżybestia\",\n";
-                ss << u8"    \"esMX\": \"Bestia demoledora\",\n";
-                ss << u8"    \"jaJP\": \"クラッシュ・ビースト\",\n";
-                ss << u8"    \"ptBR\": \"Fera Esmagadora\",\n";
-                ss << u8"    \"ruRU\": \"Крушащий зверь\",\n";
-                ss << u8"    \"zhCN\": \"破阵兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22360,\n";
-                ss << u8"    \"Key\": \"BloodBringer\",\n";
-                ss << u8"    \"enUS\": \"Blood Bringer\",\n";
-                ss << u8"    \"zhTW\": \"血腥攻城獸\",\n";
-                ss << u8"    \"deDE\": \"Blutbringer\",\n";
-                ss << u8"    \"esES\": \"Portador de la sangre\",\n";
-                ss << u8"    \"frFR\": \"Bête de sang\",\n";
-                ss << u8"    \"itIT\": \"Insanguinatore\",\n";
-                ss << u8"    \"koKR\": \"피 인도자\",\n";
-                ss << u8"    \"plPL\": \"Siewca krwi\",\n";
-                ss << u8"    \"esMX\": \"Bestia sangrienta\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・ブリンガー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Arauto Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Кровавый разносчик\",\n";
-                ss << u8"    \"zhCN\": \"溅血兽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22361,\n";
-                ss << u8"    \"Key\": \"GoreBearer\",\n";
-                ss << u8"    \"enUS\": \"Gore Bearer\",\n";
-                ss << u8"    \"zhTW\": \"蝕肉獸\",\n";
-                ss << u8"    \"deDE\": \"Verstümmler\",\n";
-                ss << u8"    \"esES\": \"Portador de la violencia\",\n";
-                ss << u8"    \"frFR\": \"Bête d’horreur\",\n";
-                ss << u8"    \"itIT\": \"Portatore di Sangue\",\n";
-                ss << u8"    \"koKR\": \"선혈 유발자\",\n";
-                ss << u8"    \"plPL\": \"Zwiastun rzezi\",\n";
-                ss << u8"    \"esMX\": \"Portador truculento\",\n";
-                ss << u8"    \"jaJP\": \"ゴア・ベアラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Sanguinolento\",\n";
-                ss << u8"    \"ruRU\": \"Гигант плоти\",\n";
-                ss << u8"    \"zhCN\": \"血污魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22362,\n";
-                ss << u8"    \"Key\": \"DeamonSteed\",\n";
-                ss << u8"    \"enUS\": \"Demon Steed\",\n";
-                ss << u8"    \"zhTW\": \"惡魔戰馬\",\n";
-                ss << u8"    \"deDE\": \"Dämonenross\",\n";
-                ss << u8"    \"esES\": \"Corcel demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Palefroi démoniaque\",\n";
-                ss << u8"    \"itIT\": \"Destriero Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 군마\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny wierzchowiec\",\n";
-                ss << u8"    \"esMX\": \"Corcel demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"デーモン・スティード\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Corcel Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Демонический скакун\",\n";
-                ss << u8"    \"zhCN\": \"恶魔战马\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22363,\n";
-                ss << u8"    \"Key\": \"WailingSpirit\",\n";
-                ss << u8"    \"enUS\": \"Wailing Spirit\",\n";
-                ss << u8"    \"zhTW\": \"泣靈\",\n";
-                ss << u8"    \"deDE\": \"Klagegeist\",\n";
-                ss << u8"    \"esES\": \"Espíritu afligido\",\n";
-                ss << u8"    \"frFR\": \"Esprit gémissant\",\n";
-                ss << u8"    \"itIT\": \"Spirito Lamentoso\",\n";
-                ss << u8"    \"koKR\": \"울부짖는 혼령\",\n";
-                ss << u8"    \"plPL\": \"Zawodzący duch\",\n";
-                ss << u8"    \"esMX\": \"Espíritu sollozante\",\n";
-                ss << u8"    \"jaJP\": \"ウェイリング・スピリット\",\n";
-                ss << u8"    \"ptBR\": \"Espírito Uivante\",\n";
-                ss << u8"    \"ruRU\": \"Стенающий дух\",\n";
-                ss << u8"    \"zhCN\": \"恸哭之灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22364,\n";
-                ss << u8"    \"Key\": \"LifeSeeker\",\n";
-                ss << u8"    \"enUS\": \"Life Seeker\",\n";
-                ss << u8"    \"zhTW\": \"索命者\",\n";
-                ss << u8"    \"deDE\": \"Lebenssucher\",\n";
-                ss << u8"    \"esES\": \"Buscador de vidas\",\n";
-                ss << u8"    \"frFR\": \"Vampiqueur\",\n";
-                ss << u8"    \"itIT\": \"Cercatore di Vita\",\n";
-                ss << u8"    \"koKR\": \"생명 추적자\",\n";
-                ss << u8"    \"plPL\": \"Poszukiwacz życia\",\n";
-                ss << u8"    \"esMX\": \"Buscador de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフ・シーカー\",\n";
-                ss << u8"    \"ptBR\": \"Caçador de Vidas\",\n";
-                ss << u8"    \"ruRU\": \"Искатель жизни\",\n";
-                ss << u8"    \"zhCN\": \"活物寻获者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22365,\n";
-                ss << u8"    \"Key\": \"LifeStealer\",\n";
-                ss << u8"    \"enUS\": \"Life Stealer\",\n";
-                ss << u8"    \"zhTW\": \"偷命者\",\n";
-                ss << u8"    \"deDE\": \"Lebensstehler\",\n";
-                ss << u8"    \"esES\": \"Ladrón de vidas\",\n";
-                ss << u8"    \"frFR\": \"Voleur de vie\",\n";
-                ss << u8"    \"itIT\": \"Ladro di Vita\",\n";
-                ss << u8"    \"koKR\": \"생명 강탈자\",\n";
-                ss << u8"    \"plPL\": \"Złodziej życia\",\n";
-                ss << u8"    \"esMX\": \"Ladrón de vida\",\n";
-                ss << u8"    \"jaJP\": \"ライフ・スティーラー\",\n";
-                ss << u8"    \"ptBR\": \"Ladrão de Vida\",\n";
-                ss << u8"    \"ruRU\": \"Похититель жизни\",\n";
-                ss << u8"    \"zhCN\": \"生命偷取者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22366,\n";
-                ss << u8"    \"Key\": \"DeathlyVisage\",\n";
-                ss << u8"    \"enUS\": \"Deathly Visage\",\n";
-                ss << u8"    \"zhTW\": \"死亡幻影\",\n";
-                ss << u8"    \"deDE\": \"Todesfratze\",\n";
-                ss << u8"    \"esES\": \"Rostro mortal\",\n";
-                ss << u8"    \"frFR\": \"Épouvanteur\",\n";
-                ss << u8"    \"itIT\": \"Viso Mortale\",\n";
-                ss << u8"    \"koKR\": \"죽음의 얼굴\",\n";
-                ss << u8"    \"plPL\": \"Oblicze śmierci\",\n";
-                ss << u8"    \"esMX\": \"Semblante mortífero\",\n";
-                ss << u8"    \"jaJP\": \"デスリィ・ヴィゼッジ\",\n";
-                ss << u8"    \"ptBR\": \"Semblante Mortífero\",\n";
-                ss << u8"    \"ruRU\": \"Мертвенный лик\",\n";
-                ss << u8"    \"zhCN\": \"索命鬼影\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22367,\n";
-                ss << u8"    \"Key\": \"BoundSpirit\",\n";
-                ss << u8"    \"enUS\": \"Bound Spirit\",\n";
-                ss << u8"    \"zhTW\": \"縛靈\",\n";
-                ss << u8"    \"deDE\": \"Gefesselter Geist\",\n";
-                ss << u8"    \"esES\": \"Espíritu aprisionado\",\n";
-                ss << u8"    \"frFR\": \"Esprit lié\",\n";
-                ss << u8"    \"itIT\": \"Spirito Incatenato\",\n";
-                ss << u8"    \"koKR\": \"속박된 혼령\",\n";
-                ss << u8"    \"plPL\": \"Spętany duch\",\n";
-                ss << u8"    \"esMX\": \"Espíritu confinado\",\n";
-                ss << u8"    \"jaJP\": \"バウンド・スピリット\",\n";
-                ss << u8"    \"ptBR\": \"Espírito Prisioneiro\",\n";
-                ss << u8"    \"ruRU\": \"Плененный дух\",\n";
-                ss << u8"    \"zhCN\": \"束缚之灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22368,\n";
-                ss << u8"    \"Key\": \"BanishedSoul\",\n";
-                ss << u8"    \"enUS\": \"Banished Soul\",\n";
-                ss << u8"    \"zhTW\": \"流放之魂\",\n";
-                ss << u8"    \"deDE\": \"Verbannte Seele\",\n";
-                ss << u8"    \"esES\": \"Alma desterrada\",\n";
-                ss << u8"    \"frFR\": \"Âme bannie\",\n";
-                ss << u8"    \"itIT\": \"Anima Esiliata\",\n";
-                ss << u8"    \"koKR\": \"추방당한 영혼\",\n";
-                ss << u8"    \"plPL\": \"Wypędzona dusza\",\n";
-                ss << u8"    \"esMX\": \"Alma desterrada\",\n";
-                ss << u8"    \"jaJP\": \"バニッシュト・ソウル\",\n";
-                ss << u8"    \"ptBR\": \"Alma Banida\",\n";
-                ss << u8"    \"ruRU\": \"Изгнанная душа\",\n";
-                ss << u8"    \"zhCN\": \"被逐之魂\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22369,\n";
-                ss << u8"    \"Key\": \"Deathexp\",\n";
-                ss << u8"    \"enUS\": \"Death\",\n";
-                ss << u8"    \"zhTW\": \"死亡化身\",\n";
-                ss << u8"    \"deDE\": \"Tod\",\n";
-                ss << u8"    \"esES\": \"Muerte\",\n";
-                ss << u8"    \"frFR\": \"Camarde\",\n";
-                ss << u8"    \"itIT\": \"Morte\",\n";
-                ss << u8"    \"koKR\": \"죽음\",\n";
-                ss << u8"    \"plPL\": \"Śmierć\",\n";
-                ss << u8"    \"esMX\": \"Muerte\",\n";
-                ss << u8"    \"jaJP\": \"デス\",\n";
-                ss << u8"    \"ptBR\": \"Morte\",\n";
-                ss << u8"    \"ruRU\": \"Смерть\",\n";
-                ss << u8"    \"zhCN\": \"死神\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22370,\n";
-                ss << u8"    \"Key\": \"Minionexp\",\n";
-                ss << u8"    \"enUS\": \"Enslaved\",\n";
-                ss << u8"    \"zhTW\": \"僕魔\",\n";
-                ss << u8"    \"deDE\": \"Sklave\",\n";
-                ss << u8"    \"esES\": \"Esclavo\",\n";
-                ss << u8"    \"frFR\": \"Servant damné\",\n";
-                ss << u8"    \"itIT\": \"Servo\",\n";
-                ss << u8"    \"koKR\": \"사로잡힌 자\",\n";
-                ss << u8"    \"plPL\": \"Zniewolony\",\n";
-                ss << u8"    \"esMX\": \"Esclavo\",\n";
-                ss << u8"    \"jaJP\": \"エンスレイヴド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Escravizado\",\n";
-                ss << u8"    \"ruRU\": \"Порабощенный\",\n";
-                ss << u8"    \"zhCN\": \"仆魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22371,\n";
-                ss << u8"    \"Key\": \"Slayerexp\",\n";
-                ss << u8"    \"enUS\": \"Slayer\",\n";
-                ss << u8"    \"zhTW\": \"殺戮僕魔\",\n";
-                ss << u8"    \"deDE\": \"Schlitzer\",\n";
-                ss << u8"    \"esES\": \"Criminal\",\n";
-                ss << u8"    \"frFR\": \"Flagelleur\",\n";
-                ss << u8"    \"itIT\": \"Massacratore\",\n";
-                ss << u8"    \"koKR\": \"학살자\",\n";
-                ss << u8"    \"plPL\": \"Pogromca\",\n";
-                ss << u8"    \"esMX\": \"Exterminador\",\n";
-                ss << u8"    \"jaJP\": \"スレイヤー\",\n";
-                ss << u8"    \"ptBR\": \"Homicida\",\n";
-                ss << u8"    \"ruRU\": \"Истребитель\",\n";
-                ss << u8"    \"zhCN\": \"屠杀者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22372,\n";
-                ss << u8"    \"Key\": \"IceBoar\",\n";
-                ss << u8"    \"enUS\": \"Ice Boar\",\n";
-                ss << u8"    \"zhTW\": \"寒冰僕魔\",\n";
-                ss << u8"    \"deDE\": \"Eiskeiler\",\n";
-                ss << u8"    \"esES\": \"Jabalí de hielo\",\n";
-                ss << u8"    \"frFR\": \"Sanglier de glace\",\n";
-                ss << u8"    \"itIT\": \"Cinghiale Gelido\",\n";
-                ss << u8"    \"koKR\": \"얼음 멧돼지\",\n";
-                ss << u8"    \"plPL\": \"Lodowy bies\",\n";
-                ss << u8"    \"esMX\": \"Verraco de hielo\",\n";
-                ss << u8"    \"jaJP\": \"アイスボア\",\n";
-                ss << u8"    \"ptBR\": \"Javali Gélido\",\n";
-                ss << u8"    \"ruRU\": \"Ледяной вепрь\",\n";
-                ss << u8"    \"zhCN\": \"冰野猪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22373,\n";
-                ss << u8"    \"Key\": \"FireBoar\",\n";
-                ss << u8"    \"enUS\": \"Fire Boar\",\n";
-                ss << u8"    \"zhTW\": \"火焰僕魔\",\n";
-                ss << u8"    \"deDE\": \"Feuerkeiler\",\n";
-                ss << u8"    \"esES\": \"Jabalí de fuego\",\n";
-                ss << u8"    \"frFR\": \"Sanglier de feu\",\n";
-                ss << u8"    \"itIT\": \"Cinghiale Infuocato\",\n";
-                ss << u8"    \"koKR\": \"불 멧돼지\",\n";
-                ss << u8"    \"plPL\": \"Ognisty bies\",\n";
-                ss << u8"    \"esMX\": \"Verraco de fuego\",\n";
-                ss << u8"    \"jaJP\": \"ファイアボア\",\n";
-                ss << u8"    \"ptBR\": \"Javali Ígneo\",\n";
-                ss << u8"    \"ruRU\": \"Огненный вепрь\",\n";
-                ss << u8"    \"zhCN\": \"火野猪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22374,\n";
-                ss << u8"    \"Key\": \"HellSpawn\",\n";
-                ss << u8"    \"enUS\": \"Hell Spawn\",\n";
-                ss << u8"    \"zhTW\": \"地獄爪牙\",\n";
-                ss << u8"    \"deDE\": \"Höllenbrut\",\n";
-                ss << u8"    \"esES\": \"Engendro infernal\",\n";
-                ss << u8"    \"frFR\": \"Engeance infernale\",\n";
-                ss << u8"    \"itIT\": \"Stirpe Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥 종자\",\n";
-                ss << u8"    \"plPL\": \"Piekielny pomiot\",\n";
-                ss << u8"    \"esMX\": \"Engendro infernal\",\n";
-                ss << u8"    \"jaJP\": \"ヘルスポーン\",\n";
-                ss << u8"    \"ptBR\": \"Cria Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Адская тварь\",\n";
-                ss << u8"    \"zhCN\": \"地狱恶灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22375,\n";
-                ss << u8"    \"Key\": \"IceSpawn\",\n";
-                ss << u8"    \"enUS\": \"Ice Spawn\",\n";
-                ss << u8"    \"zhTW\": \"冰封爪牙\",\n";
-                ss << u8"    \"deDE\": \"Eisbrut\",\n";
-                ss << u8"    \"esES\": \"Engendro helado\",\n";
-                ss << u8"    \"frFR\": \"Engeance de glace\",\n";
-                ss << u8"    \"itIT\": \"Stirpe Gelida\",\n";
-                ss << u8"    \"koKR\": \"얼음 종자\",\n";
-                ss << u8"    \"plPL\": \"Lodowy pomiot\",\n";
-                ss << u8"    \"esMX\": \"Engendro gélido\",\n";
-                ss << u8"    \"jaJP\": \"アイススポーン\",\n";
-                ss << u8"    \"ptBR\": \"Cria Gélida\",\n";
-                ss << u8"    \"ruRU\": \"Ледяная тварь\",\n";
-                ss << u8"    \"zhCN\": \"寒冰恶灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22376,\n";
-                ss << u8"    \"Key\": \"GreaterHellSpawn\",\n";
-                ss << u8"    \"enUS\": \"Greater Hell Spawn\",\n";
-                ss << u8"    \"zhTW\": \"高階地獄爪牙\",\n";
-                ss << u8"    \"deDE\": \"Große Höllenbrut\",\n";
-                ss << u8"    \"esES\": \"Gran engendro infernal\",\n";
-                ss << u8"    \"frFR\": \"Engeance infernale majeure\",\n";
-                ss << u8"    \"itIT\": \"Stirpe Infernale Maggiore\",\n";
-                ss << u8"    \"koKR\": \"상급 지옥 종자\",\n";
-                ss << u8"    \"plPL\": \"Większy piekielny pomiot\",\n";
-                ss << u8"    \"esMX\": \"Engendro infernal superior\",\n";
-                ss << u8"    \"jaJP\": \"グレーター・ヘルスポーン\",\n";
-                ss << u8"    \"ptBR\": \"Cria Infernal Superior\",\n";
-                ss << u8"    \"ruRU\": \"Гигантская адская тварь\",\n";
-                ss << u8"    \"zhCN\": \"大型地狱恶灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22377,\n";
-                ss << u8"    \"Key\": \"GreaterIceSpawn\",\n";
-                ss << u8"    \"enUS\": \"Greater Ice Spawn\",\n";
-                ss << u8"    \"zhTW\": \"高等冰封爪牙\",\n";
-                ss << u8"    \"deDE\": \"Große Eisbrut\",\n";
-                ss << u8"    \"esES\": \"Gran engendro helado\",\n";
-                ss << u8"    \"frFR\": \"Engeance de glace majeure\",\n";
-                ss << u8"    \"itIT\": \"Stirpe Gelida Maggiore\",\n";
-                ss << u8"    \"koKR\": \"상급 얼음 종자\",\n";
-                ss << u8"    \"plPL\": \"Większy lodowy pomiot\",\n";
-                ss << u8"    \"esMX\": \"Engendro gélido superior\",\n";
-                ss << u8"    \"jaJP\": \"グレーター・アイススポーン\",\n";
-                ss << u8"    \"ptBR\": \"Cria Gélida Superior\",\n";
-                ss << u8"    \"ruRU\": \"Гигантская ледяная тварь\",\n";
-                ss << u8"    \"zhCN\": \"大型寒冰恶灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22378,\n";
-                ss << u8"    \"Key\": \"FanaticMinion\",\n";
-                ss << u8"    \"enUS\": \"Fanatic Enslaved\",\n";
-                ss << u8"    \"zhTW\": \"狂熱僕魔\",\n";
-                ss << u8"    \"deDE\": \"Fanatischer Sklave\",\n";
-                ss << u8"    \"esES\": \"Esclavo fanático\",\n";
-                ss << u8"    \"frFR\": \"Servant fanatique\",\n";
-                ss << u8"    \"itIT\": \"Servo Fanatico\",\n";
-                ss << u8"    \"koKR\": \"사로잡힌 광신자\",\n";
-                ss << u8"    \"plPL\": \"Zniewolony fanatyk\",\n";
-                ss << u8"    \"esMX\": \"Fanático esclavo\",\n";
-                ss << u8"    \"jaJP\": \"狂いしエンスレイヴド\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Escravizado Fanático\",\n";
-                ss << u8"    \"ruRU\": \"Порабощенный фанатик\",\n";
-                ss << u8"    \"zhCN\": \"狂热仆魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22379,\n";
-                ss << u8"    \"Key\": \"BerserkSlayer\",\n";
-                ss << u8"    \"enUS\": \"Berserker Slayer\",\n";
-                ss << u8"    \"zhTW\": \"凶暴殺戮僕魔\",\n";
-                ss << u8"    \"deDE\": \"Berserkerschlächter\",\n";
-                ss << u8"    \"esES\": \"Criminal berserker\",\n";
-                ss << u8"    \"frFR\": \"Flagelleur berserker\",\n";
-                ss << u8"    \"itIT\": \"Massacratore Berserker\",\n";
-                ss << u8"    \"koKR\": \"광전사 학살자\",\n";
-                ss << u8"    \"plPL\": \"Berserker pogromca\",\n";
-                ss << u8"    \"esMX\": \"Exterminador vesánico\",\n";
-                ss << u8"    \"jaJP\": \"狂いしスレイヤー\",\n";
-                ss << u8"    \"ptBR\": \"Homicida Berserker\",\n";
-                ss << u8"    \"ruRU\": \"Берсерк-палач\",\n";
-                ss << u8"    \"zhCN\": \"狂暴屠杀者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22380,\n";
-                ss << u8"    \"Key\": \"ConsumedFireBoar\",\n";
-                ss << u8"    \"enUS\": \"Consumed Fire Boar\",\n";
-                ss << u8"    \"zhTW\": \"狂亂寒冰僕魔\",\n";
-                ss << u8"    \"deDE\": \"Verzehrter Feuerkeiler\",\n";
-                ss << u8"    \"esES\": \"Jabalí de fuego consumido\",\n";
-                ss << u8"    \"frFR\": \"Sanglier de feu damné\",\n";
-                ss << u8"    \"itIT\": \"Cinghiale Infuocato Consumato\",\n";
-                ss << u8"    \"koKR\": \"잠식당한 불 멧돼지\",\n";
-                ss << u8"    \"plPL\": \"Przeżarty ognisty bies\",\n";
-                ss << u8"    \"esMX\": \"Verraco de fuego arruinado\",\n";
-                ss << u8"    \"jaJP\": \"侵されしファイアボア\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Javali Ígneo Arruinado\",\n";
-                ss << u8"    \"ruRU\": \"Одержимый огненный вепрь\",\n";
-                ss << u8"    \"zhCN\": \"毁灭的冰野猪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22381,\n";
-                ss << u8"    \"Key\": \"ConsumedIceBoar\",\n";
-                ss << u8"    \"enUS\": \"Consumed Ice Boar\",\n";
-                ss << u8"    \"zhTW\": \"狂亂火焰僕魔\",\n";
-                ss << u8"    \"deDE\": \"Verzehrter Eiskeiler\",\n";
-                ss << u8"    \"esES\": \"Jabalí de hielo consumido\",\n";
-                ss << u8"    \"frFR\": \"Sanglier de glace damné\",\n";
-                ss << u8"    \"itIT\": \"Cinghiale Gelido Consumato\",\n";
-                ss << u8"    \"koKR\": \"잠식당한 얼음 멧돼지\",\n";
-                ss << u8"    \"plPL\": \"Przeżarty lodowy bies\",\n";
-                ss << u8"    \"esMX\": \"Verraco de hielo arruinado\",\n";
-                ss << u8"    \"jaJP\": \"侵されしアイスボア\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Javali Gélido Arruinado\",\n";
-                ss << u8"    \"ruRU\": \"Одержимый ледяной вепрь\",\n";
-                ss << u8"    \"zhCN\": \"毁灭的火野猪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22382,\n";
-                ss << u8"    \"Key\": \"FrenziedHellSpawn\",\n";
-                ss << u8"    \"enUS\": \"Frenzied Hell Spawn\",\n";
-                ss << u8"    \"zhTW\": \"狂怒地獄爪牙\",\n";
-                ss << u8"    \"deDE\": \"Tobsüchtige Höllenbrut\",\n";
-                ss << u8"    \"esES\": \"Engendro infernal desenfrenado\",\n";
-                ss << u8"    \"frFR\": \"Engeance infernale forcenée\",\n";
-                ss << u8"    \"itIT\": \"Stirpe Infernale Frenetica\",\n";
-                ss << u8"    \"koKR\": \"광포한 지옥 종자\",\n";
-                ss << u8"    \"plPL\": \"Oszalały piekielny pomiot\",\n";
-                ss << u8"    \"esMX\": \"Engendro infernal frenético\",\n";
-                ss << u8"    \"jaJP\": \"激昂せしヘルスポーン\",\n";
-                ss << u8"    \"ptBR\": \"Cria Infernal Frenética\",\n";
-                ss << u8"    \"ruRU\": \"Озверевшая адская тварь\",\n";
-                ss << u8"    \"zhCN\": \"狂乱地狱恶灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22383,\n";
-                ss << u8"    \"Key\": \"FrenziedIceSpawn\",\n";
-                ss << u8"    \"enUS\": \"Frenzied Ice Spawn\",\n";
-                ss << u8"    \"zhTW\": \"狂怒冰封爪牙\",\n";
-                ss << u8"    \"deDE\": \"Tobsüchtige Eisbrut\",\n";
-                ss << u8"    \"esES\": \"Engendro helado desenfrenado\",\n";
-                ss << u8"    \"frFR\": \"Engeance de glace forcenée\",\n";
-                ss << u8"    \"itIT\": \"Stirpe Gelida Frenetica\",\n";
-                ss << u8"    \"koKR\": \"광포한 얼음 종자\",\n";
-                ss << u8"    \"plPL\": \"Oszalały lodowy pomiot\",\n";
-                ss << u8"    \"esMX\": \"Engendro gélido frenético\",\n";
-                ss << u8"    \"jaJP\": \"激昂せしアイススポーン\",\n";
-                ss << u8"    \"ptBR\": \"Cria Gélida Frenética\",\n";
-                ss << u8"    \"ruRU\": \"Озверевшая ледяная тварь\",\n";
-                ss << u8"    \"zhCN\": \"狂乱寒冰恶灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22384,\n";
-                ss << u8"    \"Key\": \"InsaneHellSpawn\",\n";
-                ss << u8"    \"enUS\": \"Insane Hell Spawn\",\n";
-                ss << u8"    \"zhTW\": \"瘋狂地獄爪牙\",\n";
-                ss << u8"    \"deDE\": \"Wahnsinnige Höllenbrut\",\n";
-                ss << u8"    \"esES\": \"Engendro infernal demente\",\n";
-                ss << u8"    \"frFR\": \"Engeance infernale aliénée\",\n";
-                ss << u8"    \"itIT\": \"Stirpe Infernale Impazzita\",\n";
-                ss << u8"    \"koKR\": \"미치광이 지옥 종자\",\n";
-                ss << u8"    \"plPL\": \"Szalony piekielny pomiot\",\n";
-                ss << u8"    \"esMX\": \"Engendro infernal demente\",\n";
-                ss << u8"    \"jaJP\": \"惑乱せしヘルスポーン\",\n";
-                ss << u8"    \"ptBR\": \"Cria Infernal Insana\",\n";
-                ss << u8"    \"ruRU\": \"Безумная адская тварь\",\n";
-                ss << u8"    \"zhCN\": \"疯狂地狱恶灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22385,\n";
-                ss << u8"    \"Key\": \"InsaneIceSpawn\",\n";
-                ss << u8"    \"enUS\": \"Insane Ice Spawn\",\n";
-                ss << u8"    \"zhTW\": \"瘋狂冰封爪牙\",\n";
-                ss << u8"    \"deDE\": \"Wahnsinnige Eisbrut\",\n";
-                ss << u8"    \"esES\": \"Engendro helado demente\",\n";
-                ss << u8"    \"frFR\": \"Engeance de glace aliénée\",\n";
-                ss << u8"    \"itIT\": \"Stirpe Gelida Impazzita\",\n";
-                ss << u8"    \"koKR\": \"미치광이 얼음 종자\",\n";
-                ss << u8"    \"plPL\": \"Szalony lodowy pomiot\",\n";
-                ss << u8"    \"esMX\": \"Engendro gélido demente\",\n";
-                ss << u8"    \"jaJP\": \"惑乱せしアイススポーン\",\n";
-                ss << u8"    \"ptBR\": \"Cria Gélida Insana\",\n";
-                ss << u8"    \"ruRU\": \"Безумная ледяная тварь\",\n";
-                ss << u8"    \"zhCN\": \"疯狂寒冰恶灵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22386,\n";
-                ss << u8"    \"Key\": \"Succubusexp\",\n";
-                ss << u8"    \"enUS\": \"Succubus\",\n";
-                ss << u8"    \"zhTW\": \"魅魔\",\n";
-                ss << u8"    \"deDE\": \"Sukkubus\",\n";
-                ss << u8"    \"esES\": \"Súcubo\",\n";
-                ss << u8"    \"frFR\": \"Succube\",\n";
-                ss << u8"    \"itIT\": \"Succube\",\n";
-                ss << u8"    \"koKR\": \"서큐버스\",\n";
-                ss << u8"    \"plPL\": \"Sukkub\",\n";
-                ss << u8"    \"esMX\": \"Súcubo\",\n";
-                ss << u8"    \"jaJP\": \"サキュバス\",\n";
-                ss << u8"    \"ptBR\": \"Súcubo\",\n";
-                ss << u8"    \"ruRU\": \"Суккуб\",\n";
-                ss << u8"    \"zhCN\": \"魅魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22387,\n";
-                ss << u8"    \"Key\": \"VileTemptress\",\n";
-                ss << u8"    \"enUS\": \"Vile Temptress\",\n";
-                ss << u8"    \"zhTW\": \"兇邪妖魅\",\n";
-                ss << u8"    \"deDE\": \"Schändliche Verführerin\",\n";
-                ss << u8"    \"esES\": \"Tentación vil\",\n";
-                ss << u8"    \"frFR\": \"Tentatrice infâme\",\n";
-                ss << u8"    \"itIT\": \"Adescatrice Vile\",\n";
-                ss << u8"    \"koKR\": \"끔찍한 요부\",\n";
-                ss << u8"    \"plPL\": \"Plugawa kusicielka\",\n";
-                ss << u8"    \"esMX\": \"Tentadora vil\",\n";
-                ss << u8"    \"jaJP\": \"ヴァイル・テンプトレス\",\n";
-                ss << u8"    \"ptBR\": \"Sedutora Vil\",\n";
-                ss << u8"    \"ruRU\": \"Порочная искусительница\",\n";
-                ss << u8"    \"zhCN\": \"邪恶妖妇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22388,\n";
-                ss << u8"    \"Key\": \"StygianHarlot\",\n";
-                ss << u8"    \"enUS\": \"Stygian Harlot\",\n";
-                ss << u8"    \"zhTW\": \"冥河淫魅\",\n";
-                ss << u8"    \"deDE\": \"Stygische Hure\",\n";
-                ss << u8"    \"esES\": \"Ramera estigia\",\n";
-                ss << u8"    \"frFR\": \"Catin stygienne\",\n";
-                ss << u8"    \"itIT\": \"Meretrice dello Stige\",\n";
-                ss << u8"    \"koKR\": \"저승 요부\",\n";
-                ss << u8"    \"plPL\": \"Stygijska ladacznica\",\n";
-                ss << u8"    \"esMX\": \"Cortesana estigia\",\n";
-                ss << u8"    \"jaJP\": \"スティジャン・ハーロット\",\n";
-                ss << u8"    \"ptBR\": \"Cortesã Estígia\",\n";
-                ss << u8"    \"ruRU\": \"Стигийская блудница\",\n";
-                ss << u8"    \"zhCN\": \"冥河妖妇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22389,\n";
-                ss << u8"    \"Key\": \"Hell Temptress\",\n";
-                ss << u8"    \"enUS\": \"Hell Temptress\",\n";
-                ss << u8"    \"zhTW\": \"地獄妖魅\",\n";
-                ss << u8"    \"deDE\": \"Höllische Verführerin\",\n";
-                ss << u8"    \"esES\": \"Tentación infernal\",\n";
-                ss << u8"    \"frFR\": \"Tentatrice des Enfers\",\n";
-                ss << u8"    \"itIT\": \"Tentatrice Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥 요부\",\n";
-                ss << u8"    \"plPL\": \"Piekielna kusicielka\",\n";
-                ss << u8"    \"esMX\": \"Tentadora infernal\",\n";
-                ss << u8"    \"jaJP\": \"ヘル・テンプトレス\",\n";
-                ss << u8"    \"ptBR\": \"Sedutora Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Адская искусительница\",\n";
-                ss << u8"    \"zhCN\": \"地狱妖妇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22390,\n";
-                ss << u8"    \"Key\": \"Blood Temptress\",\n";
-                ss << u8"    \"enUS\": \"Blood Temptress\",\n";
-                ss << u8"    \"zhTW\": \"血腥妖魅\",\n";
-                ss << u8"    \"deDE\": \"Blutverführerin\",\n";
-                ss << u8"    \"esES\": \"Tentación sangrienta\",\n";
-                ss << u8"    \"frFR\": \"Tentatrice de sang\",\n";
-                ss << u8"    \"itIT\": \"Tentatrice del Sangue\",\n";
-                ss << u8"    \"koKR\": \"피의 요부\",\n";
-                ss << u8"    \"plPL\": \"Krwawa kusicielka\",\n";
-                ss << u8"    \"esMX\": \"Tentadora sanguinaria\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・テンプトレス\",\n";
-                ss << u8"    \"ptBR\": \"Sedutora Sangrenta\",\n";
-                ss << u8"    \"ruRU\": \"Кровавая искусительница\",\n";
-                ss << u8"    \"zhCN\": \"血腥妖妇\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22391,\n";
-                ss << u8"    \"Key\": \"Dominus\",\n";
-                ss << u8"    \"enUS\": \"Siren\",\n";
-                ss << u8"    \"zhTW\": \"賽蓮女妖\",\n";
-                ss << u8"    \"deDE\": \"Sirene\",\n";
-                ss << u8"    \"esES\": \"Sirena\",\n";
-                ss << u8"    \"frFR\": \"Sirène\",\n";
-                ss << u8"    \"itIT\": \"Sirena\",\n";
-                ss << u8"    \"koKR\": \"세이렌\",\n";
-                ss << u8"    \"plPL\": \"Syrena\",\n";
-                ss << u8"    \"esMX\": \"Arpía\",\n";
-                ss << u8"    \"jaJP\": \"セイレーン\",\n";
-                ss << u8"    \"ptBR\": \"Sirena\",\n";
-                ss << u8"    \"ruRU\": \"Сирена\",\n";
-                ss << u8"    \"zhCN\": \"妖女\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22392,\n";
-                ss << u8"    \"Key\": \"VileWitch\",\n";
-                ss << u8"    \"enUS\": \"Vile Witch\",\n";
-                ss << u8"    \"zhTW\": \"兇邪女妖\",\n";
-                ss << u8"    \"deDE\": \"Schändliche Hexe\",\n";
-                ss << u8"    \"esES\": \"Bruja repugnante\",\n";
-                ss << u8"    \"frFR\": \"Sorcière infâme\",\n";
-                ss << u8"    \"itIT\": \"Strega Vile\",\n";
-                ss << u8"    \"koKR\": \"끔찍한 마녀\",\n";
-                ss << u8"    \"plPL\": \"Plugawa wiedźma\",\n";
-                ss << u8"    \"esMX\": \"Bruja vil\",\n";
-                ss << u8"    \"jaJP\": \"ヴァイル・ウィッチ\",\n";
-                ss << u8"    \"ptBR\": \"Bruxa Vil\",\n";
-                ss << u8"    \"ruRU\": \"Злобная ведьма\",\n";
-                ss << u8"    \"zhCN\": \"邪恶女巫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22393,\n";
-                ss << u8"    \"Key\": \"StygianFury\",\n";
-                ss << u8"    \"enUS\": \"Stygian Fury\",\n";
-                ss << u8"    \"zhTW\": \"冥怒女妖\",\n";
-                ss << u8"    \"deDE\": \"Stygische Wut\",\n";
-                ss << u8"    \"esES\": \"Furia estigia\",\n";
-                ss << u8"    \"frFR\": \"Furie stygienne\",\n";
-                ss << u8"    \"itIT\": \"Furia dello Stige\",\n";
-                ss << u8"    \"koKR\": \"저승 마녀\",\n";
-                ss << u8"    \"plPL\": \"Stygijska furia\",\n";
-                ss << u8"    \"esMX\": \"Furia estigia\",\n";
-                ss << u8"    \"jaJP\": \"スティジャン・フューリー\",\n";
-                ss << u8"    \"ptBR\": \"Fúria Estígia\",\n";
-                ss << u8"    \"ruRU\": \"Стигийская фурия\",\n";
-                ss << u8"    \"zhCN\": \"冥河之怒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22394,\n";
-                ss << u8"    \"Key\": \"Blood Witch\",\n";
-                ss << u8"    \"enUS\": \"Blood Witch\",\n";
-                ss << u8"    \"zhTW\": \"血巫女妖\",\n";
-                ss << u8"    \"deDE\": \"Bluthexe\",\n";
-                ss << u8"    \"esES\": \"Bruja sangrienta\",\n";
-                ss << u8"    \"frFR\": \"Sorcière de sang\",\n";
-                ss << u8"    \"itIT\": \"Strega del Sangue\",\n";
-                ss << u8"    \"koKR\": \"피의 마녀\",\n";
-                ss << u8"    \"plPL\": \"Krwawa wiedźma\",\n";
-                ss << u8"    \"esMX\": \"Bruja sanguinaria\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・ウィッチ\",\n";
-                ss << u8"    \"ptBR\": \"Bruxa Sangrenta\",\n";
-                ss << u8"    \"ruRU\": \"Ведьма крови\",\n";
-                ss << u8"    \"zhCN\": \"血腥女巫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22395,\n";
-                ss << u8"    \"Key\": \"Hell Witch\",\n";
-                ss << u8"    \"enUS\": \"Hell Witch\",\n";
-                ss << u8"    \"zhTW\": \"地獄女妖\",\n";
-                ss << u8"    \"deDE\": \"Höllenhexe\",\n";
-                ss << u8"    \"esES\": \"Bruja infernal\",\n";
-                ss << u8"    \"frFR\": \"Sorcière infernale\",\n";
-                ss << u8"    \"itIT\": \"Strega Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥 마녀\",\n";
-                ss << u8"    \"plPL\": \"Piekielna wiedźma\",\n";
-                ss << u8"    \"esMX\": \"Bruja infernal\",\n";
-                ss << u8"    \"jaJP\": \"ヘル・ウィッチ\",\n";
-                ss << u8"    \"ptBR\": \"Bruxa Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Адская ведьма\",\n";
-                ss << u8"    \"zhCN\": \"地狱女巫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22396,\n";
-                ss << u8"    \"Key\": \"OverSeer\",\n";
-                ss << u8"    \"enUS\": \"Overseer\",\n";
-                ss << u8"    \"zhTW\": \"督軍\",\n";
-                ss << u8"    \"deDE\": \"Aufseher\",\n";
-                ss << u8"    \"esES\": \"Supervisor\",\n";
-                ss << u8"    \"frFR\": \"Surveillant\",\n";
-                ss << u8"    \"itIT\": \"Sovrintendente\",\n";
-                ss << u8"    \"koKR\": \"감독관\",\n";
-                ss << u8"    \"plPL\": \"Nadzorca\",\n";
-                ss << u8"    \"esMX\": \"Mayoral\",\n";
-                ss << u8"    \"jaJP\": \"オーバーシアー\",\n";
-                ss << u8"    \"ptBR\": \"Capataz\",\n";
-                ss << u8"    \"ruRU\": \"Надзиратель\",\n";
-                ss << u8"    \"zhCN\": \"督军\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22397,\n";
-                ss << u8"    \"Key\": \"Lasher\",\n";
-                ss << u8"    \"enUS\": \"Lasher\",\n";
-                ss << u8"    \"zhTW\": \"鞭笞者\",\n";
-                ss << u8"    \"deDE\": \"Peitscher\",\n";
-                ss << u8"    \"esES\": \"Fustigador\",\n";
-                ss << u8"    \"frFR\": \"Flagellant\",\n";
-                ss << u8"    \"itIT\": \"Flagellatore\",\n";
-                ss << u8"    \"koKR\": \"휘갈이\",\n";
-                ss << u8"    \"plPL\": \"Biczownik\",\n";
-                ss << u8"    \"esMX\": \"Azotador\",\n";
-                ss << u8"    \"jaJP\": \"ラッシャー\",\n";
-                ss << u8"    \"ptBR\": \"Açoitador\",\n";
-                ss << u8"    \"ruRU\": \"Хлестатель\",\n";
-                ss << u8"    \"zhCN\": \"鞭笞者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22398,\n";
-                ss << u8"    \"Key\": \"OverLord\",\n";
-                ss << u8"    \"enUS\": \"Overlord\",\n";
-                ss << u8"    \"zhTW\": \"霸主\",\n";
-                ss << u8"    \"deDE\": \"Kriegsfürst\",\n";
-                ss << u8"    \"esES\": \"Cacique\",\n";
-                ss << u8"    \"frFR\": \"Suzerain\",\n";
-                ss << u8"    \"itIT\": \"Sorvegliante\",\n";
-                ss << u8"    \"koKR\": \"대군주\",\n";
-                ss << u8"    \"plPL\": \"Władca\",\n";
-                ss << u8"    \"esMX\": \"Régulo\",\n";
-                ss << u8"    \"jaJP\": \"オーバーロード\",\n";
-                ss << u8"    \"ptBR\": \"Suserano\",\n";
-                ss << u8"    \"ruRU\": \"Властитель\",\n";
-                ss << u8"    \"zhCN\": \"霸王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22399,\n";
-                ss << u8"    \"Key\": \"BloodBoss\",\n";
-                ss << u8"    \"enUS\": \"Blood Boss\",\n";
-                ss << u8"    \"zhTW\": \"血腥統治者\",\n";
-                ss << u8"    \"deDE\": \"Blutherrscher\",\n";
-                ss << u8"    \"esES\": \"Jefe sangriento\",\n";
-                ss << u8"    \"frFR\": \"Duc de sang\",\n";
-                ss << u8"    \"itIT\": \"Signore del Sangue\",\n";
-                ss << u8"    \"koKR\": \"피의 우두머리\",\n";
-                ss << u8"    \"plPL\": \"Krwawy wódz\",\n";
-                ss << u8"    \"esMX\": \"Jefe sangriento\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・ボス\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Chefe Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Кровавый повелитель\",\n";
-                ss << u8"    \"zhCN\": \"鲜血统领\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22400,\n";
-                ss << u8"    \"Key\": \"HellWhip\",\n";
-                ss << u8"    \"enUS\": \"Hell Whip\",\n";
-                ss << u8"    \"zhTW\": \"地獄之鞭\",\n";
-                ss << u8"    \"deDE\": \"Höllenpeitsche\",\n";
-                ss << u8"    \"esES\": \"Fusta infernal\",\n";
-                ss << u8"    \"frFR\": \"Fouet infernal\",\n";
-                ss << u8"    \"itIT\": \"Frusta Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥 채찍꾼\",\n";
-                ss << u8"    \"plPL\": \"Piekielny biczownik\",\n";
-                ss << u8"    \"esMX\": \"Látigo infernal\",\n";
-                ss << u8"    \"jaJP\": \"ヘル・ウィップ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Chicote Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Адский бичеватель\",\n";
-                ss << u8"    \"zhCN\": \"地狱鞭\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22401,\n";
-                ss << u8"    \"Key\": \"MinionSpawner\",\n";
-                ss << u8"    \"enUS\": \"Demon Portal\",\n";
-                ss << u8"    \"zhTW\": \"惡魔傳送門\",\n";
-                ss << u8"    \"deDE\": \"Dämonenportal\",\n";
-                ss << u8"    \"esES\": \"Portal demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Porte démoniaque\",\n";
-                ss << u8"    \"itIT\": \"Portale Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 차원문\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny portal\",\n";
-                ss << u8"    \"esMX\": \"Portal demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"悪魔のポータル\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Portal Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Демонический портал\",\n";
-                ss << u8"    \"zhCN\": \"恶魔传送门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22402,\n";
-                ss << u8"    \"Key\": \"MinionSlayerSpawner\",\n";
-                ss << u8"    \"enUS\": \"Demon Portal\",\n";
-                ss << u8"    \"zhTW\": \"惡魔傳送門\",\n";
-                ss << u8"    \"deDE\": \"Dämonenportal\",\n";
-                ss << u8"    \"esES\": \"Portal demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Porte démoniaque\",\n";
-                ss << u8"    \"itIT\": \"Portale Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 차원문\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny portal\",\n";
-                ss << u8"    \"esMX\": \"Portal demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"悪魔のポータル\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Portal Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Демонический портал\",\n";
-                ss << u8"    \"zhCN\": \"恶魔传送门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22403,\n";
-                ss << u8"    \"Key\": \"MinionIce/fireBoarSpawner\",\n";
-                ss << u8"    \"enUS\": \"Demon Portal\",\n";
-                ss << u8"    \"zhTW\": \"惡魔傳送門\",\n";
-                ss << u8"    \"deDE\": \"Dämonenportal\",\n";
-                ss << u8"    \"esES\": \"Portal demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Porte démoniaque\",\n";
-                ss << u8"    \"itIT\": \"Portale Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 차원문\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny portal\",\n";
-                ss << u8"    \"esMX\": \"Portal demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"悪魔のポータル\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Portal Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Демонический портал\",\n";
-                ss << u8"    \"zhCN\": \"恶魔传送门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22404,\n";
-                ss << u8"    \"Key\": \"Minionice/hellSpawnSpawner\",\n";
-                ss << u8"    \"enUS\": \"Demon Portal\",\n";
-                ss << u8"    \"zhTW\": \"惡魔傳送門\",\n";
-                ss << u8"    \"deDE\": \"Dämonenportal\",\n";
-                ss << u8"    \"esES\": \"Portal demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Porte démoniaque\",\n";
-                ss << u8"    \"itIT\": \"Portale Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 차원문\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny portal\",\n";
-                ss << u8"    \"esMX\": \"Portal demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"悪魔のポータル\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Portal Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Демонический портал\",\n";
-                ss << u8"    \"zhCN\": \"恶魔传送门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22405,\n";
-                ss << u8"    \"Key\": \"MinionGreaterIce/hellSpawnSpawner\",\n";
-                ss << u8"    \"enUS\": \"Demon Portal\",\n";
-                ss << u8"    \"zhTW\": \"惡魔傳送門\",\n";
-                ss << u8"    \"deDE\": \"Dämonenportal\",\n";
-                ss << u8"    \"esES\": \"Portal demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Portail démoniaque\",\n";
-                ss << u8"    \"itIT\": \"Portale Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 차원문\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny portal\",\n";
-                ss << u8"    \"esMX\": \"Portal demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"悪魔のポータル\",\n";
-                ss << u8"    \"ptBR\": \"Portal Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Демонический портал\",\n";
-                ss << u8"    \"zhCN\": \"恶魔传送门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22406,\n";
-                ss << u8"    \"Key\": \"Imp1\",\n";
-                ss << u8"    \"enUS\": \"Demon Imp\",\n";
-                ss << u8"    \"zhTW\": \"惡魔小鬼\",\n";
-                ss << u8"    \"deDE\": \"Dämonenkobold\",\n";
-                ss << u8"    \"esES\": \"Diablillo demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Diablotin\",\n";
-                ss << u8"    \"itIT\": \"Folletto Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 임프\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny chochlik\",\n";
-                ss << u8"    \"esMX\": \"Diablillo demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"デーモン・インプ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Diabrete Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Бес\",\n";
-                ss << u8"    \"zhCN\": \"恶魔小鬼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22407,\n";
-                ss << u8"    \"Key\": \"Imp2\",\n";
-                ss << u8"    \"enUS\": \"Demon Rascal\",\n";
-                ss << u8"    \"zhTW\": \"嘍囉小鬼\",\n";
-                ss << u8"    \"deDE\": \"Dämonenhalunke\",\n";
-                ss << u8"    \"esES\": \"Granuja demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Racaille démoniaque\",\n";
-                ss << u8"    \"itIT\": \"Briccone Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 불한당\",\n";
-                ss << u8"    \"plPL\": \"Demoniczna kreatura\",\n";
-                ss << u8"    \"esMX\": \"Granuja demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"デーモン・ラスカル\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Peralta Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Проказник\",\n";
-                ss << u8"    \"zhCN\": \"恶魔喽啰\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22408,\n";
-                ss << u8"    \"Key\": \"Imp3\",\n";
-                ss << u8"    \"enUS\": \"Demon Gremlin\",\n";
-                ss << u8"    \"zhTW\": \"妖魔小鬼\",\n";
-                ss << u8"    \"deDE\": \"Dämonengremlin\",\n";
-                ss << u8"    \"esES\": \"Duendecillo demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Gremlin\",\n";
-                ss << u8"    \"itIT\": \"Gremlin Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 그렘린\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny gremlin\",\n";
-                ss << u8"    \"esMX\": \"Duende demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"デーモン・グレムリン\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Gremlin Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Гремлин\",\n";
-                ss << u8"    \"zhCN\": \"恶魔妖精\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22409,\n";
-                ss << u8"    \"Key\": \"Imp4\",\n";
-                ss << u8"    \"enUS\": \"Demon Trickster\",\n";
-                ss << u8"    \"zhTW\": \"欺瞞小鬼\",\n";
-                ss << u8"    \"deDE\": \"Dämonenschwindler\",\n";
-                ss << u8"    \"esES\": \"Pillo demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Entourloupeur\",\n";
-                ss << u8"    \"itIT\": \"Rinnegato Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 말썽꾼\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny szachraj\",\n";
-                ss << u8"    \"esMX\": \"Embustero demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"デーモン・トリックスター\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Trapaceiro Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Трикстер\",\n";
-                ss << u8"    \"zhCN\": \"恶魔骗徒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22410,\n";
-                ss << u8"    \"Key\": \"Imp5\",\n";
-                ss << u8"    \"enUS\": \"Demon Sprite\",\n";
-                ss << u8"    \"zhTW\": \"精怪小鬼\",\n";
-                ss << u8"    \"deDE\": \"Dämonengeist\",\n";
-                ss << u8"    \"esES\": \"Trasgo demoníaco\",\n";
-                ss << u8"    \"frFR\": \"Korrigan\",\n";
-                ss << u8"    \"itIT\": \"Spiritello Demoniaco\",\n";
-                ss << u8"    \"koKR\": \"악마 요마\",\n";
-                ss << u8"    \"plPL\": \"Demoniczny skrzat\",\n";
-                ss << u8"    \"esMX\": \"Duendecillo demoníaco\",\n";
-                ss << u8"    \"jaJP\": \"デーモン・スプライト\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Duende Demoníaco\",\n";
-                ss << u8"    \"ruRU\": \"Демонический дух\",\n";
-                ss << u8"    \"zhCN\": \"恶魔顽徒\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22411,\n";
-                ss << u8"    \"Key\": \"CatapultN\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22412,\n";
-                ss << u8"    \"Key\": \"CatapultS\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"[fs]Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22413,\n";
-                ss << u8"    \"Key\": \"CatapultE\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22414,\n";
-                ss << u8"    \"Key\": \"CatapultW\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22415,\n";
-                ss << u8"    \"Key\": \"Frozen Horror1\",\n";
-                ss << u8"    \"enUS\": \"Frozen Creeper\",\n";
-                ss << u8"    \"zhTW\": \"爬行冰怪\",\n";
-                ss << u8"    \"deDE\": \"Frostkriecher\",\n";
-                ss << u8"    \"esES\": \"Depredador helado\",\n";
-                ss << u8"    \"frFR\": \"Rampant des glaces\",\n";
-                ss << u8"    \"itIT\": \"Bestia Congelata\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 땅지기\",\n";
-                ss << u8"    \"plPL\": \"Zlodowaciały pełzacz\",\n";
-                ss << u8"    \"esMX\": \"Pavor congelado\",\n";
-                ss << u8"    \"jaJP\": \"フローズン・クリーパー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Rastejante Congelado\",\n";
-                ss << u8"    \"ruRU\": \"Ледяной ходок\",\n";
-                ss << u8"    \"zhCN\": \"冰霜爬行者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22416,\n";
-                ss << u8"    \"Key\": \"Frozen Horror2\",\n";
-                ss << u8"    \"enUS\": \"Frozen Terror\",\n";
-                ss << u8"    \"zhTW\": \"恐怖冰怪\",\n";
-                ss << u8"    \"deDE\": \"Frostschrecken\",\n";
-                ss << u8"    \"esES\": \"Terror helado\",\n";
-                ss << u8"    \"frFR\": \"Terreur des glaces\",\n";
-                ss << u8"    \"itIT\": \"Terrore Congelato\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 공포\",\n";
-                ss << u8"    \"plPL\": \"Zlodowaciała groza\",\n";
-                ss << u8"    \"esMX\": \"Terror congelado\",\n";
-                ss << u8"    \"jaJP\": \"フローズン・テラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Terror Congelado\",\n";
-                ss << u8"    \"ruRU\": \"Ледяной кошмар\",\n";
-                ss << u8"    \"zhCN\": \"冰霜恐魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22417,\n";
-                ss << u8"    \"Key\": \"Frozen Horror3\",\n";
-                ss << u8"    \"enUS\": \"Frozen Scourge\",\n";
-                ss << u8"    \"zhTW\": \"禍害冰怪\",\n";
-                ss << u8"    \"deDE\": \"Frostgeißel\",\n";
-                ss << u8"    \"esES\": \"Azote helado\",\n";
-                ss << u8"    \"frFR\": \"Ladre des glaces\",\n";
-                ss << u8"    \"itIT\": \"Flagello Congelato\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 재앙\",\n";
-                ss << u8"    \"plPL\": \"Zlodowaciała zmora\",\n";
-                ss << u8"    \"esMX\": \"Flagelo congelado\",\n";
-                ss << u8"    \"jaJP\": \"フローズン・スカージ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Flagelo Congelado\",\n";
-                ss << u8"    \"ruRU\": \"Ледяное отродье\",\n";
-                ss << u8"    \"zhCN\": \"冰霜造劫者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22418,\n";
-                ss << u8"    \"Key\": \"Frozen Horror4\",\n";
-                ss << u8"    \"enUS\": \"Frozen Horror\",\n";
-                ss << u8"    \"zhTW\": \"驚恐冰怪\",\n";
-                ss << u8"    \"deDE\": \"Frostgrauen\",\n";
-                ss << u8"    \"esES\": \"Horror helado\",\n";
-                ss << u8"    \"frFR\": \"Horreur des glaces\",\n";
-                ss << u8"    \"itIT\": \"Orrore Congelato\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 공포\",\n";
-                ss << u8"    \"plPL\": \"Zlodowaciały koszmar\",\n";
-                ss << u8"    \"esMX\": \"Horror congelado\",\n";
-                ss << u8"    \"jaJP\": \"フローズン・ホラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Horror Congelado\",\n";
-                ss << u8"    \"ruRU\": \"Ледяной ужас\",\n";
-                ss << u8"    \"zhCN\": \"冰霜骇魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22419,\n";
-                ss << u8"    \"Key\": \"Frozen Horror5\",\n";
-                ss << u8"    \"enUS\": \"Frozen Scorch\",\n";
-                ss << u8"    \"zhTW\": \"焦凍冰怪\",\n";
-                ss << u8"    \"deDE\": \"Frostversenger\",\n";
-                ss << u8"    \"esES\": \"Quemadura helada\",\n";
-                ss << u8"    \"frFR\": \"Coureur des glaces\",\n";
-                ss << u8"    \"itIT\": \"Inceneritore Congelato\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 불덩이\",\n";
-                ss << u8"    \"plPL\": \"Zlodowaciały żar\",\n";
-                ss << u8"    \"esMX\": \"Azote congelado\",\n";
-                ss << u8"    \"jaJP\": \"フローズン・スコルチ\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Braseiro Congelado\",\n";
-                ss << u8"    \"ruRU\": \"Ледяной выжигатель\",\n";
-                ss << u8"    \"zhCN\": \"冰霜焦枯魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22420,\n";
-                ss << u8"    \"Key\": \"Blood Lord1\",\n";
-                ss << u8"    \"enUS\": \"Moon Lord\",\n";
-                ss << u8"    \"zhTW\": \"月族統領\",\n";
-                ss << u8"    \"deDE\": \"Mondfürst\",\n";
-                ss << u8"    \"esES\": \"Señor de la luna\",\n";
-                ss << u8"    \"frFR\": \"Seigneur de la Lune\",\n";
-                ss << u8"    \"itIT\": \"Signore della Luna\",\n";
-                ss << u8"    \"koKR\": \"달의 군주\",\n";
-                ss << u8"    \"plPL\": \"Władca księżyca\",\n";
-                ss << u8"    \"esMX\": \"Señor lunar\",\n";
-                ss << u8"    \"jaJP\": \"月の闘将\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Senhor Lunar\",\n";
-                ss << u8"    \"ruRU\": \"Владыка луны\",\n";
-                ss << u8"    \"zhCN\": \"月王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22421,\n";
-                ss << u8"    \"Key\": \"Blood Lord2\",\n";
-                ss << u8"    \"enUS\": \"Night Lord\",\n";
-                ss << u8"    \"zhTW\": \"夜族統領\",\n";
-                ss << u8"    \"deDE\": \"Nachtfürst\",\n";
-                ss << u8"    \"esES\": \"Señor de la noche\",\n";
-                ss << u8"    \"frFR\": \"Seigneur de la Nuit\",\n";
-                ss << u8"    \"itIT\": \"Signore della Notte\",\n";
-                ss << u8"    \"koKR\": \"밤의 군주\",\n";
-                ss << u8"    \"plPL\": \"Władca nocy\",\n";
-                ss << u8"    \"esMX\": \"Señor nocturno\",\n";
-                ss << u8"    \"jaJP\": \"夜の闘将\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Senhor Noturno\",\n";
-                ss << u8"    \"ruRU\": \"Владыка ночи\",\n";
-                ss << u8"    \"zhCN\": \"夜王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22422,\n";
-                ss << u8"    \"Key\": \"Blood Lord3\",\n";
-                ss << u8"    \"enUS\": \"Blood Lord\",\n";
-                ss << u8"    \"zhTW\": \"血族統領\",\n";
-                ss << u8"    \"deDE\": \"Blutfürst\",\n";
-                ss << u8"    \"esES\": \"Señor de la sangre\",\n";
-                ss << u8"    \"frFR\": \"Seigneur du Sang\",\n";
-                ss << u8"    \"itIT\": \"Signore del Sangue\",\n";
-                ss << u8"    \"koKR\": \"피의 군주\",\n";
-                ss << u8"    \"plPL\": \"Władca krwi\",\n";
-                ss << u8"    \"esMX\": \"Señor sangriento\",\n";
-                ss << u8"    \"jaJP\": \"血の闘将\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Senhor Sangrento\",\n";
-                ss << u8"    \"ruRU\": \"Владыка крови\",\n";
-                ss << u8"    \"zhCN\": \"血王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22423,\n";
-                ss << u8"    \"Key\": \"Blood Lord4\",\n";
-                ss << u8"    \"enUS\": \"Hell Lord\",\n";
-                ss << u8"    \"zhTW\": \"冥府統領\",\n";
-                ss << u8"    \"deDE\": \"Höllenfürst\",\n";
-                ss << u8"    \"esES\": \"Señor del infierno\",\n";
-                ss << u8"    \"frFR\": \"Seigneur des Enfers\",\n";
-                ss << u8"    \"itIT\": \"Signore degli Inferi\",\n";
-                ss << u8"    \"koKR\": \"지옥 군주\",\n";
-                ss << u8"    \"plPL\": \"Władca piekła\",\n";
-                ss << u8"    \"esMX\": \"Señor infernal\",\n";
-                ss << u8"    \"jaJP\": \"地獄の闘将\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Senhor Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Владыка ада\",\n";
-                ss << u8"    \"zhCN\": \"地狱王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22424,\n";
-                ss << u8"    \"Key\": \"Blood Lord5\",\n";
-                ss << u8"    \"enUS\": \"Death Lord\",\n";
-                ss << u8"    \"zhTW\": \"死族統領\",\n";
-                ss << u8"    \"deDE\": \"Todesfürst\",\n";
-                ss << u8"    \"esES\": \"Señor de la muerte\",\n";
-                ss << u8"    \"frFR\": \"Seigneur de la Mort\",\n";
-                ss << u8"    \"itIT\": \"Signore della Morte\",\n";
-                ss << u8"    \"koKR\": \"죽음의 군주\",\n";
-                ss << u8"    \"plPL\": \"Władca śmierci\",\n";
-                ss << u8"    \"esMX\": \"Señor de la muerte\",\n";
-                ss << u8"    \"jaJP\": \"死の闘将\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Senhor Fúnebre\",\n";
-                ss << u8"    \"ruRU\": \"Владыка смерти\",\n";
-                ss << u8"    \"zhCN\": \"煞王\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22425,\n";
-                ss << u8"    \"Key\": \"Catapult Spotter N\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22426,\n";
-                ss << u8"    \"Key\": \"Catapult Spotter S\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22427,\n";
-                ss << u8"    \"Key\": \"Catapult Spotter E\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22428,\n";
-                ss << u8"    \"Key\": \"Catapult Spotter W\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22429,\n";
-                ss << u8"    \"Key\": \"Catapult Spotter Siege\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22430,\n";
-                ss << u8"    \"Key\": \"CatapultSiege\",\n";
-                ss << u8"    \"enUS\": \"Catapult\",\n";
-                ss << u8"    \"zhTW\": \"投石機\",\n";
-                ss << u8"    \"deDE\": \"Katapult\",\n";
-                ss << u8"    \"esES\": \"Catapulta\",\n";
-                ss << u8"    \"frFR\": \"Catapulte\",\n";
-                ss << u8"    \"itIT\": \"Catapulta\",\n";
-                ss << u8"    \"koKR\": \"투석기\",\n";
-                ss << u8"    \"plPL\": \"Katapulta\",\n";
-                ss << u8"    \"esMX\": \"Catapulta\",\n";
-                ss << u8"    \"jaJP\": \"投石機\",\n";
-                ss << u8"    \"ptBR\": \"Catapulta\",\n";
-                ss << u8"    \"ruRU\": \"Катапульта\",\n";
-                ss << u8"    \"zhCN\": \"投石器\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22431,\n";
-                ss << u8"    \"Key\": \"Barricade Wall Right\",\n";
-                ss << u8"    \"enUS\": \"Barricade\",\n";
-                ss << u8"    \"zhTW\": \"防禦工事\",\n";
-                ss << u8"    \"deDE\": \"Barrikade\",\n";
-                ss << u8"    \"esES\": \"Barricada\",\n";
-                ss << u8"    \"frFR\": \"Barricade\",\n";
-                ss << u8"    \"itIT\": \"Barricata\",\n";
-                ss << u8"    \"koKR\": \"방벽\",\n";
-                ss << u8"    \"plPL\": \"Barykada\",\n";
-                ss << u8"    \"esMX\": \"Barricada\",\n";
-                ss << u8"    \"jaJP\": \"バリケード\",\n";
-                ss << u8"    \"ptBR\": \"Barricada\",\n";
-                ss << u8"    \"ruRU\": \"Баррикада\",\n";
-                ss << u8"    \"zhCN\": \"壁障\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22432,\n";
-                ss << u8"    \"Key\": \"Barricade Wall Left\",\n";
-                ss << u8"    \"enUS\": \"Barricade\",\n";
-                ss << u8"    \"zhTW\": \"防禦工事\",\n";
-                ss << u8"    \"deDE\": \"Barrikade\",\n";
-                ss << u8"    \"esES\": \"Barricada\",\n";
-                ss << u8"    \"frFR\": \"Barricade\",\n";
-                ss << u8"    \"itIT\": \"Barricata\",\n";
-                ss << u8"    \"koKR\": \"방벽\",\n";
-                ss << u8"    \"plPL\": \"Barykada\",\n";
-                ss << u8"    \"esMX\": \"Barricada\",\n";
-                ss << u8"    \"jaJP\": \"バリケード\",\n";
-                ss << u8"    \"ptBR\": \"Barricada\",\n";
-                ss << u8"    \"ruRU\": \"Баррикада\",\n";
-                ss << u8"    \"zhCN\": \"壁障\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22433,\n";
-                ss << u8"    \"Key\": \"Barricade Door\",\n";
-                ss << u8"    \"enUS\": \"Barricaded Door\",\n";
-                ss << u8"    \"zhTW\": \"封住的門\",\n";
-                ss << u8"    \"deDE\": \"Verbarrikadierte Tür\",\n";
-                ss << u8"    \"esES\": \"Puerta con barricada\",\n";
-                ss << u8"    \"frFR\": \"Porte barricadée\",\n";
-                ss << u8"    \"itIT\": \"Porta Sbarrata\",\n";
-                ss << u8"    \"koKR\": \"차단문\",\n";
-                ss << u8"    \"plPL\": \"Zabarykadowane drzwi\",\n";
-                ss << u8"    \"esMX\": \"Puerta obstruida\",\n";
-                ss << u8"    \"jaJP\": \"封鎖された扉\",\n";
-                ss << u8"    \"ptBR\": \"Porta Bloqueada\",\n";
-                ss << u8"    \"ruRU\": \"Заваленная дверь\",\n";
-                ss << u8"    \"zhCN\": \"封堵的大门\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22434,\n";
-                ss << u8"    \"Key\": \"Barricade Tower\",\n";
-                ss << u8"    \"enUS\": \"Barricaded Tower\",\n";
-                ss << u8"    \"zhTW\": \"防禦塔\",\n";
-                ss << u8"    \"deDE\": \"Verbarrikadierter Turm\",\n";
-                ss << u8"    \"esES\": \"Torre con barricada\",\n";
-                ss << u8"    \"frFR\": \"Tour barricadée\",\n";
-                ss << u8"    \"itIT\": \"Torre Barricata\",\n";
-                ss << u8"    \"koKR\": \"방벽으로 막힌 탑\",\n";
-                ss << u8"    \"plPL\": \"Zabarykadowana wieża\",\n";
-                ss << u8"    \"esMX\": \"Torre obstruida\",\n";
-                ss << u8"    \"jaJP\": \"バリケード・タワー\",\n";
-                ss << u8"    \"ptBR\": \"Torre Bloqueada\",\n";
-                ss << u8"    \"ruRU\": \"Заваленная башня\",\n";
-                ss << u8"    \"zhCN\": \"封堵的塔楼\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22435,\n";
-                ss << u8"    \"Key\": \"Siege Boss\",\n";
-                ss << u8"    \"enUS\": \"Shenk the Overseer\",\n";
-                ss << u8"    \"zhTW\": \"督軍山克\",\n";
-                ss << u8"    \"deDE\": \"Schenk der Aufseher\",\n";
-                ss << u8"    \"esES\": \"Shenk, el que todo lo ve\",\n";
-                ss << u8"    \"frFR\": \"Shenk le surveillant\",\n";
-                ss << u8"    \"itIT\": \"Shenk il Sovrintendente\",\n";
-                ss << u8"    \"koKR\": \"감독관 쉔크\",\n";
-                ss << u8"    \"plPL\": \"Shenk Nadzorca\",\n";
-                ss << u8"    \"esMX\": \"Shenk el Mayoral\",\n";
-                ss << u8"    \"jaJP\": \"監視者シェンク\",\n";
-                ss << u8"    \"ptBR\": \"Shenk, o Capataz\",\n";
-                ss << u8"    \"ruRU\": \"Шенк Надзиратель\",\n";
-                ss << u8"    \"zhCN\": \"督军山克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22436,\n";
-                ss << u8"    \"Key\": \"Evil hut\",\n";
-                ss << u8"    \"enUS\": \"Evil Demon Hut\",\n";
-                ss << u8"    \"zhTW\": \"邪惡魔屋\",\n";
-                ss << u8"    \"deDE\": \"Hütte des bösen Dämons\",\n";
-                ss << u8"    \"esES\": \"Cabaña demoníaca\",\n";
-                ss << u8"    \"frFR\": \"Hutte de démon maléfique\",\n";
-                ss << u8"    \"itIT\": \"Rifugio dei Demoni Maligni\",\n";
-                ss << u8"    \"koKR\": \"사악한 악마 오두막\",\n";
-                ss << u8"    \"plPL\": \"Siedziba demonów\",\n";
-                ss << u8"    \"esMX\": \"Cabaña de los Demonios malignos\",\n";
-                ss << u8"    \"jaJP\": \"悪鬼の巣\",\n";
-                ss << u8"    \"ptBR\": \"Cabana de Demônio Malévolo\",\n";
-                ss << u8"    \"ruRU\": \"Лачуга злобных демонов\",\n";
-                ss << u8"    \"zhCN\": \"邪魔小屋\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22437,\n";
-                ss << u8"    \"Key\": \"Death Mauler1\",\n";
-                ss << u8"    \"enUS\": \"Death Mauler\",\n";
-                ss << u8"    \"zhTW\": \"亡軍重擊魔\",\n";
-                ss << u8"    \"deDE\": \"Todesprügler\",\n";
-                ss << u8"    \"esES\": \"Vapuleador mortal\",\n";
-                ss << u8"    \"frFR\": \"Marteleur de la Mort\",\n";
-                ss << u8"    \"itIT\": \"Massacratore Mortale\",\n";
-                ss << u8"    \"koKR\": \"죽음의 망치주먹\",\n";
-                ss << u8"    \"plPL\": \"Oprawca śmierci\",\n";
-                ss << u8"    \"esMX\": \"Mutilador letal\",\n";
-                ss << u8"    \"jaJP\": \"デス・モーラー\",\n";
-                ss << u8"    \"ptBR\": \"Marretador Fúnebre\",\n";
-                ss << u8"    \"ruRU\": \"Жуткий терзатель\",\n";
-                ss << u8"    \"zhCN\": \"重殴触手魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22438,\n";
-                ss << u8"    \"Key\": \"Death Mauler2\",\n";
-                ss << u8"    \"enUS\": \"Death Brawler\",\n";
-                ss << u8"    \"zhTW\": \"亡軍征戰者\",\n";
-                ss << u8"    \"deDE\": \"Todeszänker\",\n";
-                ss << u8"    \"esES\": \"Luchador mortal\",\n";
-                ss << u8"    \"frFR\": \"Bastonneur de la Mort\",\n";
-                ss << u8"    \"itIT\": \"Lottatore Mortale\",\n";
-                ss << u8"    \"koKR\": \"죽음의 싸움꾼\",\n";
-                ss << u8"    \"plPL\": \"Warchoł śmierci\",\n";
-                ss << u8"    \"esMX\": \"Retador letal\",\n";
-                ss << u8"    \"jaJP\": \"デス・ブローラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Briguento Fúnebre\",\n";
-                ss << u8"    \"ruRU\": \"Жуткий задира\",\n";
-                ss << u8"    \"zhCN\": \"殴斗触手魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22439,\n";
-                ss << u8"    \"Key\": \"Death Mauler3\",\n";
-                ss << u8"    \"enUS\": \"Death Slasher\",\n";
-                ss << u8"    \"zhTW\": \"亡軍斬殺者\",\n";
-                ss << u8"    \"deDE\": \"Todesschlitzer\",\n";
-                ss << u8"    \"esES\": \"Asesino mortal\",\n";
-                ss << u8"    \"frFR\": \"Entailleur de la Mort\",\n";
-                ss << u8"    \"itIT\": \"Squartatore Mortale\",\n";
-                ss << u8"    \"koKR\": \"죽음의 난도질꾼\",\n";
-                ss << u8"    \"plPL\": \"Rozrzynacz śmierci\",\n";
-                ss << u8"    \"esMX\": \"Degollador letal\",\n";
-                ss << u8"    \"jaJP\": \"デス・スラッシャー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Retalhador Fúnebre\",\n";
-                ss << u8"    \"ruRU\": \"Жуткий раздиратель\",\n";
-                ss << u8"    \"zhCN\": \"挥砍触手魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22440,\n";
-                ss << u8"    \"Key\": \"Death Mauler4\",\n";
-                ss << u8"    \"enUS\": \"Death Berserker\",\n";
-                ss << u8"    \"zhTW\": \"亡軍狂戰士\",\n";
-                ss << u8"    \"deDE\": \"Todesberserker\",\n";
-                ss << u8"    \"esES\": \"Berserker mortal\",\n";
-                ss << u8"    \"frFR\": \"Berserker de la Mort\",\n";
-                ss << u8"    \"itIT\": \"Berserker Mortale\",\n";
-                ss << u8"    \"koKR\": \"죽음의 광전사\",\n";
-                ss << u8"    \"plPL\": \"Berserker śmierci\",\n";
-                ss << u8"    \"esMX\": \"Vesánico letal\",\n";
-                ss << u8"    \"jaJP\": \"デス・バーサーカー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Berserker Fúnebre\",\n";
-                ss << u8"    \"ruRU\": \"Берсерк смерти\",\n";
-                ss << u8"    \"zhCN\": \"狂暴触手魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22441,\n";
-                ss << u8"    \"Key\": \"Death Mauler5\",\n";
-                ss << u8"    \"enUS\": \"Death Brigadier\",\n";
-                ss << u8"    \"zhTW\": \"亡軍戰將\",\n";
-                ss << u8"    \"deDE\": \"Todesbrigadier\",\n";
-                ss << u8"    \"esES\": \"Brigada mortal\",\n";
-                ss << u8"    \"frFR\": \"Brigadier de la Mort\",\n";
-                ss << u8"    \"itIT\": \"Generale Mortale\",\n";
-                ss << u8"    \"koKR\": \"죽음의 지휘관\",\n";
-                ss << u8"    \"plPL\": \"Żołnierz śmierci\",\n";
-                ss << u8"    \"esMX\": \"Brigadier letal\",\n";
-                ss << u8"    \"jaJP\": \"デス・ブリガディア\",\n";
-                ss << u8"    \"ptBR\": \"General Fúnebre\",\n";
-                ss << u8"    \"ruRU\": \"Жуткий офицер\",\n";
-                ss << u8"    \"zhCN\": \"触手魔头\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22442,\n";
-                ss << u8"    \"Key\": \"SnowYeti1\",\n";
-                ss << u8"    \"enUS\": \"Snow Drifter\",\n";
-                ss << u8"    \"zhTW\": \"雪原雪怪\",\n";
-                ss << u8"    \"deDE\": \"Schneetreiber\",\n";
-                ss << u8"    \"esES\": \"Errante níveo\",\n";
-                ss << u8"    \"frFR\": \"Yéti errant\",\n";
-                ss << u8"    \"itIT\": \"Viandante delle Nevi\",\n";
-                ss << u8"    \"koKR\": \"눈 떠돌이\",\n";
-                ss << u8"    \"plPL\": \"Śniegowy tułacz\",\n";
-                ss << u8"    \"esMX\": \"Errante glacial\",\n";
-                ss << u8"    \"jaJP\": \"スノー・ドリフター\",\n";
-                ss << u8"    \"ptBR\": \"Errante Glacial\",\n";
-                ss << u8"    \"ruRU\": \"Снежный скиталец\",\n";
-                ss << u8"    \"zhCN\": \"冰雪流民\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22443,\n";
-                ss << u8"    \"Key\": \"SnowYeti2\",\n";
-                ss << u8"    \"enUS\": \"Abominable\",\n";
-                ss << u8"    \"zhTW\": \"厚毛雪怪\",\n";
-                ss << u8"    \"deDE\": \"Abschaum\",\n";
-                ss << u8"    \"esES\": \"Abominable\",\n";
-                ss << u8"    \"frFR\": \"Yéti abominable\",\n";
-                ss << u8"    \"itIT\": \"Abominevole\",\n";
-                ss << u8"    \"koKR\": \"흉물\",\n";
-                ss << u8"    \"plPL\": \"Plugawiec\",\n";
-                ss << u8"    \"esMX\": \"Abominable\",\n";
-                ss << u8"    \"jaJP\": \"アボミナブル\",\n";
-                ss << u8"    \"ptBR\": \"Abominável\",\n";
-                ss << u8"    \"ruRU\": \"Отвратный\",\n";
-                ss << u8"    \"zhCN\": \"雪毛怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22444,\n";
-                ss << u8"    \"Key\": \"SnowYeti3\",\n";
-                ss << u8"    \"enUS\": \"Chilled Froth\",\n";
-                ss << u8"    \"zhTW\": \"寒冰霜\",\n";
-                ss << u8"    \"deDE\": \"Frostschaum\",\n";
-                ss << u8"    \"esES\": \"Espuma gélida\",\n";
-                ss << u8"    \"frFR\": \"Yéti glacial\",\n";
-                ss << u8"    \"itIT\": \"Schiumante Gelido\",\n";
-                ss << u8"    \"koKR\": \"한기서린 거품\",\n";
-                ss << u8"    \"plPL\": \"Lodowe monstrum\",\n";
-                ss << u8"    \"esMX\": \"Espuma helada\",\n";
-                ss << u8"    \"jaJP\": \"チルド・フロス\",\n";
-                ss << u8"    \"ptBR\": \"Espuma Gélida\",\n";
-                ss << u8"    \"ruRU\": \"Замерзшая пена\",\n";
-                ss << u8"    \"zhCN\": \"冰涎怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22445,\n";
-                ss << u8"    \"Key\": \"SnowYeti4\",\n";
-                ss << u8"    \"enUS\": \"Frozen Abyss\",\n";
-                ss << u8"    \"zhTW\": \"冰封雪怪\",\n";
-                ss << u8"    \"deDE\": \"Frostkluft\",\n";
-                ss << u8"    \"esES\": \"Abismo helado\",\n";
-                ss << u8"    \"frFR\": \"Yéti abyssal\",\n";
-                ss << u8"    \"itIT\": \"Mostro degli Abissi\",\n";
-                ss << u8"    \"koKR\": \"얼어붙은 심연\",\n";
-                ss << u8"    \"plPL\": \"Bestia mrozu\",\n";
-                ss << u8"    \"esMX\": \"Abisal congelado\",\n";
-                ss << u8"    \"jaJP\": \"フローズン・アビス\",\n";
-                ss << u8"    \"ptBR\": \"Abissal Congelado\",\n";
-                ss << u8"    \"ruRU\": \"Ледяная бездна\",\n";
-                ss << u8"    \"zhCN\": \"冰封冥渊怪\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22446,\n";
-                ss << u8"    \"Key\": \"Baal Throne\",\n";
-                ss << u8"    \"enUS\": \"Baal\",\n";
-                ss << u8"    \"zhTW\": \"巴爾\",\n";
-                ss << u8"    \"deDE\": \"Baal\",\n";
-                ss << u8"    \"esES\": \"Baal\",\n";
-                ss << u8"    \"frFR\": \"Baal\",\n";
-                ss << u8"    \"itIT\": \"Baal\",\n";
-                ss << u8"    \"koKR\": \"바알\",\n";
-                ss << u8"    \"plPL\": \"Baal\",\n";
-                ss << u8"    \"esMX\": \"Baal\",\n";
-                ss << u8"    \"jaJP\": \"バール\",\n";
-                ss << u8"    \"ptBR\": \"Baal\",\n";
-                ss << u8"    \"ruRU\": \"Баал\",\n";
-                ss << u8"    \"zhCN\": \"巴尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22447,\n";
-                ss << u8"    \"Key\": \"Baal Crab\",\n";
-                ss << u8"    \"enUS\": \"Baal\",\n";
-                ss << u8"    \"zhTW\": \"巴爾\",\n";
-                ss << u8"    \"deDE\": \"Baal\",\n";
-                ss << u8"    \"esES\": \"Baal\",\n";
-                ss << u8"    \"frFR\": \"Baal\",\n";
-                ss << u8"    \"itIT\": \"Baal\",\n";
-                ss << u8"    \"koKR\": \"바알\",\n";
-                ss << u8"    \"plPL\": \"Baal\",\n";
-                ss << u8"    \"esMX\": \"Baal\",\n";
-                ss << u8"    \"jaJP\": \"バール\",\n";
-                ss << u8"    \"ptBR\": \"Baal\",\n";
-                ss << u8"    \"ruRU\": \"Баал\",\n";
-                ss << u8"    \"zhCN\": \"巴尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22448,\n";
-                ss << u8"    \"Key\": \"Baal Taunt\",\n";
-                ss << u8"    \"enUS\": \"Baal\",\n";
-                ss << u8"    \"zhTW\": \"巴爾\",\n";
-                ss << u8"    \"deDE\": \"Baal\",\n";
-                ss << u8"    \"esES\": \"Baal\",\n";
-                ss << u8"    \"frFR\": \"Baal\",\n";
-                ss << u8"    \"itIT\": \"Baal\",\n";
-                ss << u8"    \"koKR\": \"바알\",\n";
-                ss << u8"    \"plPL\": \"Baal\",\n";
-                ss << u8"    \"esMX\": \"Baal\",\n";
-                ss << u8"    \"jaJP\": \"バール\",\n";
-                ss << u8"    \"ptBR\": \"Baal\",\n";
-                ss << u8"    \"ruRU\": \"Баал\",\n";
-                ss << u8"    \"zhCN\": \"巴尔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22449,\n";
-                ss << u8"    \"Key\": \"Putrid Defiler1\",\n";
-                ss << u8"    \"enUS\": \"Putrid Defiler\",\n";
-                ss << u8"    \"zhTW\": \"腐敗褻瀆者\",\n";
-                ss << u8"    \"deDE\": \"Verfaulter Entweiher\",\n";
-                ss << u8"    \"esES\": \"Profanador pútrido\",\n";
-                ss << u8"    \"frFR\": \"Profanateur putride\",\n";
-                ss << u8"    \"itIT\": \"Contaminatore Putrido\",\n";
-                ss << u8"    \"koKR\": \"문드러진 파멸자\",\n";
-                ss << u8"    \"plPL\": \"Gnijący plugawiciel\",\n";
-                ss << u8"    \"esMX\": \"Profanador pútrido\",\n";
-                ss << u8"    \"jaJP\": \"ピュトリッド・デファイラー\",\n";
-                ss << u8"    \"ptBR\": \"Profanador Pútrido\",\n";
-                ss << u8"    \"ruRU\": \"Гниющий осквернитель\",\n";
-                ss << u8"    \"zhCN\": \"腥臭污秽者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22450,\n";
-                ss << u8"    \"Key\": \"Putrid Defiler2\",\n";
-                ss << u8"    \"enUS\": \"Wretched Defiler\",\n";
-                ss << u8"    \"zhTW\": \"卑汙褻瀆者\",\n";
-                ss << u8"    \"deDE\": \"Übler Entweiher\",\n";
-                ss << u8"    \"esES\": \"Profanador aterrador\",\n";
-                ss << u8"    \"frFR\": \"Profanateur de misère\",\n";
-                ss << u8"    \"itIT\": \"Contaminatore Abietto\",\n";
-                ss << u8"    \"koKR\": \"뒤틀린 파멸자\",\n";
-                ss << u8"    \"plPL\": \"Nędzny plugawiciel\",\n";
-                ss << u8"    \"esMX\": \"Profanador miserable\",\n";
-                ss << u8"    \"jaJP\": \"レッチド・デファイラー\",\n";
-                ss << u8"    \"ptBR\": \"Profanador Terrível\",\n";
-                ss << u8"    \"ruRU\": \"Проклятый осквернитель\",\n";
-                ss << u8"    \"zhCN\": \"卑劣污秽者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22451,\n";
-                ss << u8"    \"Key\": \"Putrid Defiler3\",\n";
-                ss << u8"    \"enUS\": \"Fetid Defiler\",\n";
-                ss << u8"    \"zhTW\": \"惡臭褻瀆者\",\n";
-                ss << u8"    \"deDE\": \"Stinkender Entweiher\",\n";
-                ss << u8"    \"esES\": \"Profanador fétido\",\n";
-                ss << u8"    \"frFR\": \"Profanateur fétide\",\n";
-                ss << u8"    \"itIT\": \"Contaminatore Fetido\",\n";
-                ss << u8"    \"koKR\": \"썩은 파멸자\",\n";
-                ss << u8"    \"plPL\": \"Cuchnący plugawiciel\",\n";
-                ss << u8"    \"esMX\": \"Profanador fétido\",\n";
-                ss << u8"    \"jaJP\": \"フェティド・デファイラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Profanador Fétido\",\n";
-                ss << u8"    \"ruRU\": \"Зловонный осквернитель\",\n";
-                ss << u8"    \"zhCN\": \"恶臭污秽者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22452,\n";
-                ss << u8"    \"Key\": \"Putrid Defiler4\",\n";
-                ss << u8"    \"enUS\": \"Rancid Defiler\",\n";
-                ss << u8"    \"zhTW\": \"腐臭褻瀆者\",\n";
-                ss << u8"    \"deDE\": \"Ranziger Entweiher\",\n";
-                ss << u8"    \"esES\": \"Profanador rancio\",\n";
-                ss << u8"    \"frFR\": \"Profanateur rance\",\n";
-                ss << u8"    \"itIT\": \"Contaminatore Rancido\",\n";
-                ss << u8"    \"koKR\": \"부패한 파멸자\",\n";
-                ss << u8"    \"plPL\": \"Spleśniały plugawiciel\",\n";
-                ss << u8"    \"esMX\": \"Profanador rancio\",\n";
-                ss << u8"    \"jaJP\": \"ランシド・デファイラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Profanador Repugnante\",\n";
-                ss << u8"    \"ruRU\": \"Гадкий осквернитель\",\n";
-                ss << u8"    \"zhCN\": \"腐臭污秽者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22453,\n";
-                ss << u8"    \"Key\": \"Putrid Defiler5\",\n";
-                ss << u8"    \"enUS\": \"Rank Defiler\",\n";
-                ss << u8"    \"zhTW\": \"狠劣褻瀆者\",\n";
-                ss << u8"    \"deDE\": \"Modernder Entweiher\",\n";
-                ss << u8"    \"esES\": \"Profanador repugnante\",\n";
-                ss << u8"    \"frFR\": \"Profanateur puant\",\n";
-                ss << u8"    \"itIT\": \"Contaminatore Marcio\",\n";
-                ss << u8"    \"koKR\": \"악취 나는 파멸자\",\n";
-                ss << u8"    \"plPL\": \"Śmierdzący plugawiciel\",\n";
-                ss << u8"    \"esMX\": \"Profanador añejo\",\n";
-                ss << u8"    \"jaJP\": \"ランク・デファイラー\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Profanador Rançoso\",\n";
-                ss << u8"    \"ruRU\": \"Мерзкий осквернитель\",\n";
-                ss << u8"    \"zhCN\": \"异臭污秽者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22454,\n";
-                ss << u8"    \"Key\": \"Pain Worm1\",\n";
-                ss << u8"    \"enUS\": \"Pain Worm\",\n";
-                ss << u8"    \"zhTW\": \"苦痛之蟲\",\n";
-                ss << u8"    \"deDE\": \"Schmerzwurm\",\n";
-                ss << u8"    \"esES\": \"Gusano de dolor\",\n";
-                ss << u8"    \"frFR\": \"Ver de souffrance\",\n";
-                ss << u8"    \"itIT\": \"Verme del Dolore\",\n";
-                ss << u8"    \"koKR\": \"고통 벌레\",\n";
-                ss << u8"    \"plPL\": \"Czerw bólu\",\n";
-                ss << u8"    \"esMX\": \"Gusano doloroso\",\n";
-                ss << u8"    \"jaJP\": \"ペイン・ワーム\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Verme Doloroso\",\n";
-                ss << u8"    \"ruRU\": \"Червь боли\",\n";
-                ss << u8"    \"zhCN\": \"痛苦蠕虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22455,\n";
-                ss << u8"    \"Key\": \"Pain Worm2\",\n";
-                ss << u8"    \"enUS\": \"Torment Worm\",\n";
-                ss << u8"    \"zhTW\": \"折磨之蟲\",\n";
-                ss << u8"    \"deDE\": \"Peinwurm\",\n";
-                ss << u8"    \"esES\": \"Gusano de tormento\",\n";
-                ss << u8"    \"frFR\": \"Ver de tourment\",\n";
-                ss << u8"    \"itIT\": \"Verme del Tormento\",\n";
-                ss << u8"    \"koKR\": \"고문 벌레\",\n";
-                ss << u8"    \"plPL\": \"Czerw udręki\",\n";
-                ss << u8"    \"esMX\": \"Gusano tormentoso\",\n";
-                ss << u8"    \"jaJP\": \"トーメント・ワーム\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Verme Tormentoso\",\n";
-                ss << u8"    \"ruRU\": \"Червь страданий\",\n";
-                ss << u8"    \"zhCN\": \"折磨蠕虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22456,\n";
-                ss << u8"    \"Key\": \"Pain Worm3\",\n";
-                ss << u8"    \"enUS\": \"Agony Worm\",\n";
-                ss << u8"    \"zhTW\": \"苦惱之蟲\",\n";
-                ss << u8"    \"deDE\": \"Qualwurm\",\n";
-                ss << u8"    \"esES\": \"Gusano de agonía\",\n";
-                ss << u8"    \"frFR\": \"Ver d’agonie\",\n";
-                ss << u8"    \"itIT\": \"Verme dell'Agonia\",\n";
-                ss << u8"    \"koKR\": \"번뇌 벌레\",\n";
-                ss << u8"    \"plPL\": \"Czerw agonii\",\n";
-                ss << u8"    \"esMX\": \"Gusano desolador\",\n";
-                ss << u8"    \"jaJP\": \"アゴニー・ワーム\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Verme Desolador\",\n";
-                ss << u8"    \"ruRU\": \"Червь агонии\",\n";
-                ss << u8"    \"zhCN\": \"痛楚蠕虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22457,\n";
-                ss << u8"    \"Key\": \"Pain Worm4\",\n";
-                ss << u8"    \"enUS\": \"Menace Worm\",\n";
-                ss << u8"    \"zhTW\": \"脅迫之蟲\",\n";
-                ss << u8"    \"deDE\": \"Drohwurm\",\n";
-                ss << u8"    \"esES\": \"Gusano de amenaza\",\n";
-                ss << u8"    \"frFR\": \"Ver de menace\",\n";
-                ss << u8"    \"itIT\": \"Verme della Minaccia\",\n";
-                ss << u8"    \"koKR\": \"참상 벌레\",\n";
-                ss << u8"    \"plPL\": \"Czerw grozy\",\n";
-                ss << u8"    \"esMX\": \"Gusano amenazador\",\n";
-                ss << u8"    \"jaJP\": \"メナス・ワーム\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Verme Ameaçador\",\n";
-                ss << u8"    \"ruRU\": \"Червь угрозы\",\n";
-                ss << u8"    \"zhCN\": \"恶痛蠕虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22458,\n";
-                ss << u8"    \"Key\": \"Pain Worm5\",\n";
-                ss << u8"    \"enUS\": \"Anguish Worm\",\n";
-                ss << u8"    \"zhTW\": \"怨慟之蟲   \",\n";
-                ss << u8"    \"deDE\": \"Zornwurm\",\n";
-                ss << u8"    \"esES\": \"Gusano de angustia\",\n";
-                ss << u8"    \"frFR\": \"Ver d’angoisse\",\n";
-                ss << u8"    \"itIT\": \"Verme dell'Angoscia\",\n";
-                ss << u8"    \"koKR\": \"고뇌 벌레\",\n";
-                ss << u8"    \"plPL\": \"Czerw cierpienia\",\n";
-                ss << u8"    \"esMX\": \"Gusano agonizador\",\n";
-                ss << u8"    \"jaJP\": \"アンギッシュ・ワーム\",\n";
-                ss << u8"    \"ptBR\": \"Verme Angustiante\",\n";
-                ss << u8"    \"ruRU\": \"Червь мучений\",\n";
-                ss << u8"    \"zhCN\": \"剧痛蠕虫\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22459,\n";
-                ss << u8"    \"Key\": \"WolfRider5\",\n";
-                ss << u8"    \"enUS\": \"Warped Fallen Wolfrider\",\n";
-                ss << u8"    \"zhTW\": \"扭曲沉淪魔狼騎士\",\n";
-                ss << u8"    \"deDE\": \"Verderbter gefallener Wolfreiter\",\n";
-                ss << u8"    \"esES\": \"Jinete lupino caído retorcido\",\n";
-                ss << u8"    \"frFR\": \"Monte-loup déchu déformé\",\n";
-                ss << u8"    \"itIT\": \"Cavalcalupi Caduto Deforme\",\n";
-                ss << u8"    \"koKR\": \"뒤틀린 몰락자 늑대 기수\",\n";
-                ss << u8"    \"plPL\": \"Spaczony jeździec upadłych\",\n";
-                ss << u8"    \"esMX\": \"Montalobos caído retorcido\",\n";
-                ss << u8"    \"jaJP\": \"ウォープト・ワンの狼騎兵\",\n";
-                ss << u8"    \"ptBR\": \"Cavalga-lobo Decaído Distorcido\",\n";
-                ss << u8"    \"ruRU\": \"Искаженный падший-наездник\",\n";
-                ss << u8"    \"zhCN\": \"扭曲沉沦魔狼骑手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22460,\n";
-                ss << u8"    \"Key\": \"WolfRider4\",\n";
-                ss << u8"    \"enUS\": \"Darkone Wolfrider\",\n";
-                ss << u8"    \"zhTW\": \"暗黑狼騎士\",\n";
-                ss << u8"    \"deDE\": \"Dunkler Wolfreiter\",\n";
-                ss << u8"    \"esES\": \"Jinete lupino siniestro\",\n";
-                ss << u8"    \"frFR\": \"Monte-loup noir\",\n";
-                ss << u8"    \"itIT\": \"Cavalcalupi Oscuro\",\n";
-                ss << u8"    \"koKR\": \"어둠의 악마 늑대 기수\",\n";
-                ss << u8"    \"plPL\": \"Jeździec mrocznych\",\n";
-                ss << u8"    \"esMX\": \"Montalobos oscuro\",\n";
-                ss << u8"    \"jaJP\": \"ダーク・ワンの狼騎兵\",\n";
-                ss << u8"    \"ptBR\": \"Cavalga-lobo Trevoso\",\n";
-                ss << u8"    \"ruRU\": \"Темный наездник\",\n";
-                ss << u8"    \"zhCN\": \"暗魔狼骑手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22461,\n";
-                ss << u8"    \"Key\": \"WolfRider3\",\n";
-                ss << u8"    \"enUS\": \"Devilkin Wolfrider\",\n";
-                ss << u8"    \"zhTW\": \"魔妖狼騎士\",\n";
-                ss << u8"    \"deDE\": \"Teufelsbrutwolfreiter\",\n";
-                ss << u8"    \"esES\": \"Jinete lupino diabólico\",\n";
-                ss << u8"    \"frFR\": \"Monte-loup démonoïde\",\n";
-                ss << u8"    \"itIT\": \"Cavalcalupi Malefico\",\n";
-                ss << u8"    \"koKR\": \"악마피붙이 늑대 기수\",\n";
-                ss << u8"    \"plPL\": \"Jeździec diablików\",\n";
-                ss << u8"    \"esMX\": \"Montalobos demonante\",\n";
-                ss << u8"    \"jaJP\": \"デビルキンの狼騎兵\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cavalga-lobo Demonante\",\n";
-                ss << u8"    \"ruRU\": \"Дьяволенок-наездник\",\n";
-                ss << u8"    \"zhCN\": \"小恶魔狼骑手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22462,\n";
-                ss << u8"    \"Key\": \"WolfRider2\",\n";
-                ss << u8"    \"enUS\": \"Carver Wolfrider\",\n";
-                ss << u8"    \"zhTW\": \"刨肉狼騎士\",\n";
-                ss << u8"    \"deDE\": \"Schlächterwolfreiter\",\n";
-                ss << u8"    \"esES\": \"Jinete lupino trinchante\",\n";
-                ss << u8"    \"frFR\": \"Monte-loup équarrisseur\",\n";
-                ss << u8"    \"itIT\": \"Cavalcalupi Incisore\",\n";
-                ss << u8"    \"koKR\": \"도륙자 늑대 기수\",\n";
-                ss << u8"    \"plPL\": \"Jeździec wycinaczy\",\n";
-                ss << u8"    \"esMX\": \"Montalobos tajador\",\n";
-                ss << u8"    \"jaJP\": \"カーヴァーの狼騎兵\",\n";
-                ss << u8"    \"ptBR\": \"Cavalga-lobo Entalhador\",\n";
-                ss << u8"    \"ruRU\": \"Плоторез-наездник\",\n";
-                ss << u8"    \"zhCN\": \"利刃魔狼骑手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22463,\n";
-                ss << u8"    \"Key\": \"WolfRider1\",\n";
-                ss << u8"    \"enUS\": \"Fallen Wolfrider\",\n";
-                ss << u8"    \"zhTW\": \"沉淪魔狼騎士\",\n";
-                ss << u8"    \"deDE\": \"Gefallener Wolfreiter\",\n";
-                ss << u8"    \"esES\": \"Jinete lupino caído\",\n";
-                ss << u8"    \"frFR\": \"Monte-loup déchu\",\n";
-                ss << u8"    \"itIT\": \"Cavalcalupi Caduto\",\n";
-                ss << u8"    \"koKR\": \"몰락자 늑대 기수\",\n";
-                ss << u8"    \"plPL\": \"Jeździec upadłych\",\n";
-                ss << u8"    \"esMX\": \"Montalobos caído\",\n";
-                ss << u8"    \"jaJP\": \"フォールンの狼騎兵\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Cavalga-lobo Decaído\",\n";
-                ss << u8"    \"ruRU\": \"Падший-наездник\",\n";
-                ss << u8"    \"zhCN\": \"沉沦魔狼骑手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22469,\n";
-                ss << u8"    \"Key\": \"Inferno Sentry\",\n";
-                ss << u8"    \"enUS\": \"Inferno Sentry\",\n";
-                ss << u8"    \"zhTW\": \"煉獄衛兵\",\n";
-                ss << u8"    \"deDE\": \"Infernowächter\",\n";
-                ss << u8"    \"esES\": \"Centinela infernal\",\n";
-                ss << u8"    \"frFR\": \"Sentinelle infernale\",\n";
-                ss << u8"    \"itIT\": \"Sentinella Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥불 파수기\",\n";
-                ss << u8"    \"plPL\": \"Wartownik piekieł\",\n";
-                ss << u8"    \"esMX\": \"Centinela del Infierno\",\n";
-                ss << u8"    \"jaJP\": \"インフェルノ・セントリー\",\n";
-                ss << u8"    \"ptBR\": \"Sentinela Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Инфернальный часовой\",\n";
-                ss << u8"    \"zhCN\": \"炼狱哨兵\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22486,\n";
-                ss << u8"    \"Key\": \"Curly\",\n";
-                ss << u8"    \"enUS\": \"Curly\",\n";
-                ss << u8"    \"zhTW\": \"蜷曲\",\n";
-                ss << u8"    \"deDE\": \"Curly\",\n";
-                ss << u8"    \"esES\": \"Curly\",\n";
-                ss << u8"    \"frFR\": \"Pam\",\n";
-                ss << u8"    \"itIT\": \"Curly\",\n";
-                ss << u8"    \"koKR\": \"컬리\",\n";
-                ss << u8"    \"plPL\": \"Curly\",\n";
-                ss << u8"    \"esMX\": \"Curly\",\n";
-                ss << u8"    \"jaJP\": \"カーリー\",\n";
-                ss << u8"    \"ptBR\": \"Crespo\",\n";
-                ss << u8"    \"ruRU\": \"Кудряш\",\n";
-                ss << u8"    \"zhCN\": \"毛毛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22487,\n";
-                ss << u8"    \"Key\": \"Larry\",\n";
-                ss << u8"    \"enUS\": \"Larry\",\n";
-                ss << u8"    \"zhTW\": \"賴瑞\",\n";
-                ss << u8"    \"deDE\": \"Larry\",\n";
-                ss << u8"    \"esES\": \"Larry\",\n";
-                ss << u8"    \"frFR\": \"Poum\",\n";
-                ss << u8"    \"itIT\": \"Larry\",\n";
-                ss << u8"    \"koKR\": \"래리\",\n";
-                ss << u8"    \"plPL\": \"Larry\",\n";
-                ss << u8"    \"esMX\": \"Larry\",\n";
-                ss << u8"    \"jaJP\": \"ラリー\",\n";
-                ss << u8"    \"ptBR\": \"Larry\",\n";
-                ss << u8"    \"ruRU\": \"Ларри\",\n";
-                ss << u8"    \"zhCN\": \"拉蕊\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22488,\n";
-                ss << u8"    \"Key\": \"Ancient Barbarian 3\",\n";
-                ss << u8"    \"enUS\": \"Korlic\",\n";
-                ss << u8"    \"zhTW\": \"科力克\",\n";
-                ss << u8"    \"deDE\": \"Korlic\",\n";
-                ss << u8"    \"esES\": \"Korlic\",\n";
-                ss << u8"    \"frFR\": \"Korlic\",\n";
-                ss << u8"    \"itIT\": \"Korlic\",\n";
-                ss << u8"    \"koKR\": \"콜릭\",\n";
-                ss << u8"    \"plPL\": \"Korlik\",\n";
-                ss << u8"    \"esMX\": \"Korlic\",\n";
-                ss << u8"    \"jaJP\": \"コーリック\",\n";
-                ss << u8"    \"ptBR\": \"Korlic\",\n";
-                ss << u8"    \"ruRU\": \"Корлик\",\n";
-                ss << u8"    \"zhCN\": \"科里克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22489,\n";
-                ss << u8"    \"Key\": \"Ancient Barbarian 2\",\n";
-                ss << u8"    \"enUS\": \"Madawc\",\n";
-                ss << u8"    \"zhTW\": \"馬道克\",\n";
-                ss << u8"    \"deDE\": \"Madawc\",\n";
-                ss << u8"    \"esES\": \"Madawc\",\n";
-                ss << u8"    \"frFR\": \"Madawc\",\n";
-                ss << u8"    \"itIT\": \"Madawc\",\n";
-                ss << u8"    \"koKR\": \"마도크\",\n";
-                ss << u8"    \"plPL\": \"Madok\",\n";
-                ss << u8"    \"esMX\": \"Madawc\",\n";
-                ss << u8"    \"jaJP\": \"マドウク\",\n";
-                ss << u8"    \"ptBR\": \"Madawc\",\n";
-                ss << u8"    \"ruRU\": \"Мадавк\",\n";
-                ss << u8"    \"zhCN\": \"马道克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22490,\n";
-                ss << u8"    \"Key\": \"Ancient Barbarian 1\",\n";
-                ss << u8"    \"enUS\": \"Talic\",\n";
-                ss << u8"    \"zhTW\": \"塔力克\",\n";
-                ss << u8"    \"deDE\": \"Talic\",\n";
-                ss << u8"    \"esES\": \"Talic\",\n";
-                ss << u8"    \"frFR\": \"Talic\",\n";
-                ss << u8"    \"itIT\": \"Talic\",\n";
-                ss << u8"    \"koKR\": \"탈릭\",\n";
-                ss << u8"    \"plPL\": \"Talik\",\n";
-                ss << u8"    \"esMX\": \"Talic\",\n";
-                ss << u8"    \"jaJP\": \"タリック\",\n";
-                ss << u8"    \"ptBR\": \"[ms]Talic\",\n";
-                ss << u8"    \"ruRU\": \"Талик\",\n";
-                ss << u8"    \"zhCN\": \"塔力克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22491,\n";
-                ss << u8"    \"Key\": \"Blaze Ripper\",\n";
-                ss << u8"    \"enUS\": \"Blaze Ripper\",\n";
-                ss << u8"    \"zhTW\": \"刀鋒撕裂者\",\n";
-                ss << u8"    \"deDE\": \"Feuersbrunstripper\",\n";
-                ss << u8"    \"esES\": \"Destripador de Fuego\",\n";
-                ss << u8"    \"frFR\": \"Étripe-Braise\",\n";
-                ss << u8"    \"itIT\": \"Squartatore Ardente\",\n";
-                ss << u8"    \"koKR\": \"블레이즈 리퍼\",\n";
-                ss << u8"    \"plPL\": \"Rozpruwacz Płomieni\",\n";
-                ss << u8"    \"esMX\": \"Destripador Flameante\",\n";
-                ss << u8"    \"jaJP\": \"豪炎のリッパー\",\n";
-                ss << u8"    \"ptBR\": \"Estripador Fulgurante\",\n";
-                ss << u8"    \"ruRU\": \"Адский потрошитель\",\n";
-                ss << u8"    \"zhCN\": \"炽焰撕裂者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22492,\n";
-                ss << u8"    \"Key\": \"Magma Torquer\",\n";
-                ss << u8"    \"enUS\": \"Magma Torquer\",\n";
-                ss << u8"    \"zhTW\": \"熔岩扭曲者\",\n";
-                ss << u8"    \"deDE\": \"Magmariese\",\n";
-                ss << u8"    \"esES\": \"Retuercemagma\",\n";
-                ss << u8"    \"frFR\": \"Tord-Magma\",\n";
-                ss << u8"    \"itIT\": \"Torcimagma\",\n";
-                ss << u8"    \"koKR\": \"마그마 토커\",\n";
-                ss << u8"    \"plPL\": \"Kłąb Magmy\",\n";
-                ss << u8"    \"esMX\": \"Torquer de Magma\",\n";
-                ss << u8"    \"jaJP\": \"マグマ・トルクァー\",\n";
-                ss << u8"    \"ptBR\": \"Arrasador Magmático\",\n";
-                ss << u8"    \"ruRU\": \"Извращенная магма\",\n";
-                ss << u8"    \"zhCN\": \"岩浆扭转者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22493,\n";
-                ss << u8"    \"Key\": \"Sharp Tooth Sayer\",\n";
-                ss << u8"    \"enUS\": \"Sharptooth Slayer\",\n";
-                ss << u8"    \"zhTW\": \"利牙殺手\",\n";
-                ss << u8"    \"deDE\": \"Scharfzahnschlächter\",\n";
-                ss << u8"    \"esES\": \"Asesino de Dientes Afilados\",\n";
-                ss << u8"    \"frFR\": \"Croc-Tueur\",\n";
-                ss << u8"    \"itIT\": \"Squartatore Acuminato\",\n";
-                ss << u8"    \"koKR\": \"샤프투스 슬레이어\",\n";
-                ss << u8"    \"plPL\": \"Ostrozębny Pogromca\",\n";
-                ss << u8"    \"esMX\": \"Exterminador de Dientes Afilados\",\n";
-                ss << u8"    \"jaJP\": \"鋭牙のスレイヤー\",\n";
-                ss << u8"    \"ptBR\": \"Homicida Navalhodonte\",\n";
-                ss << u8"    \"ruRU\": \"Острозуб Истребитель\",\n";
-                ss << u8"    \"zhCN\": \"尖牙杀戮者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22494,\n";
-                ss << u8"    \"Key\": \"Vinvear Molech\",\n";
-                ss << u8"    \"enUS\": \"Vinvear Molech\",\n";
-                ss << u8"    \"zhTW\": \"芬維爾‧摩洛克\",\n";
-                ss << u8"    \"deDE\": \"Vinvear Molech\",\n";
-                ss << u8"    \"esES\": \"Vinvear Molech\",\n";
-                ss << u8"    \"frFR\": \"Vinvear Molech\",\n";
-                ss << u8"    \"itIT\": \"Molech Vinvear\",\n";
-                ss << u8"    \"koKR\": \"빈비어 몰레크\",\n";
-                ss << u8"    \"plPL\": \"Moloch z Vinvear\",\n";
-                ss << u8"    \"esMX\": \"Vinvear Molech\",\n";
-                ss << u8"    \"jaJP\": \"ヴィンヴィア・モレック\",\n";
-                ss << u8"    \"ptBR\": \"Moloque Vinvear\",\n";
-                ss << u8"    \"ruRU\": \"Винвеар Молох\",\n";
-                ss << u8"    \"zhCN\": \"温伟尔·摩洛克\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22495,\n";
-                ss << u8"    \"Key\": \"Anodized Elite\",\n";
-                ss << u8"    \"enUS\": \"Hell's Belle\",\n";
-                ss << u8"    \"zhTW\": \"地獄佳人\",\n";
-                ss << u8"    \"deDE\": \"Höllenbraut\",\n";
-                ss << u8"    \"esES\": \"Belleza Infernal\",\n";
-                ss << u8"    \"frFR\": \"Belle des Enfers\",\n";
-                ss << u8"    \"itIT\": \"Bellezza Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥의 미녀\",\n";
-                ss << u8"    \"plPL\": \"Piekielna Piękność\",\n";
-                ss << u8"    \"esMX\": \"Belleza del Infierno\",\n";
-                ss << u8"    \"jaJP\": \"ヘルズ・ベル\",\n";
-                ss << u8"    \"ptBR\": \"Belle do Inferno\",\n";
-                ss << u8"    \"ruRU\": \"Белладонна\",\n";
-                ss << u8"    \"zhCN\": \"地狱妖姬\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22496,\n";
-                ss << u8"    \"Key\": \"Snapchip Shatter\",\n";
-                ss << u8"    \"enUS\": \"Snapchip Shatter\",\n";
-                ss << u8"    \"zhTW\": \"碎冰\",\n";
-                ss << u8"    \"deDE\": \"Schnappzapp Schmetter\",\n";
-                ss << u8"    \"esES\": \"Destructor Ruidoso\",\n";
-                ss << u8"    \"frFR\": \"Brise-Éclat\",\n";
-                ss << u8"    \"itIT\": \"Spezzaschegge il Fracassatore\",\n";
-                ss << u8"    \"koKR\": \"스냅칩 섀터\",\n";
-                ss << u8"    \"plPL\": \"Szczerbiciel\",\n";
-                ss << u8"    \"esMX\": \"Destructor de Estalactitas\",\n";
-                ss << u8"    \"jaJP\": \"スナップチップ・シャッター\",\n";
-                ss << u8"    \"ptBR\": \"Esfacelador Lascado\",\n";
-                ss << u8"    \"ruRU\": \"Трескун Сотрясатель\",\n";
-                ss << u8"    \"zhCN\": \"嚼筋粉碎者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22497,\n";
-                ss << u8"    \"Key\": \"Pindleskin\",\n";
-                ss << u8"    \"enUS\": \"Pindleskin\",\n";
-                ss << u8"    \"zhTW\": \"暴皮\",\n";
-                ss << u8"    \"deDE\": \"Knochenhaut\",\n";
-                ss << u8"    \"esES\": \"Pindleskin\",\n";
-                ss << u8"    \"frFR\": \"Picaillon\",\n";
-                ss << u8"    \"itIT\": \"Pellefragile\",\n";
-                ss << u8"    \"koKR\": \"핀들스킨\",\n";
-                ss << u8"    \"plPL\": \"Pryszczoskór\",\n";
-                ss << u8"    \"esMX\": \"Granujo\",\n";
-                ss << u8"    \"jaJP\": \"ピンドルスキン\",\n";
-                ss << u8"    \"ptBR\": \"Pelefermo\",\n";
-                ss << u8"    \"ruRU\": \"Пиндлскин\",\n";
-                ss << u8"    \"zhCN\": \"暴躁外皮\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22498,\n";
-                ss << u8"    \"Key\": \"Threash Socket\",\n";
-                ss << u8"    \"enUS\": \"Thresh Socket\",\n";
-                ss << u8"    \"zhTW\": \"剝孔\",\n";
-                ss << u8"    \"deDE\": \"Dresch Zocker\",\n";
-                ss << u8"    \"esES\": \"Fosa de Trilla\",\n";
-                ss << u8"    \"frFR\": \"Corne-Chair\",\n";
-                ss << u8"    \"itIT\": \"Il Battitore\",\n";
-                ss << u8"    \"koKR\": \"쓰레쉬 소켓\",\n";
-                ss << u8"    \"plPL\": \"Niszczyskała\",\n";
-                ss << u8"    \"esMX\": \"Azotador Engarzado\",\n";
-                ss << u8"    \"jaJP\": \"スレッシュ・ソケット\",\n";
-                ss << u8"    \"ptBR\": \"Descascador\",\n";
-                ss << u8"    \"ruRU\": \"Гнездовой молотитель\",\n";
-                ss << u8"    \"zhCN\": \"锤槽\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22499,\n";
-                ss << u8"    \"Key\": \"Eyeback Unleashed\",\n";
-                ss << u8"    \"enUS\": \"Eyeback the Unleashed\",\n";
-                ss << u8"    \"zhTW\": \"爆發者艾巴克\",\n";
-                ss << u8"    \"deDE\": \"Triefauge der Entfesselte\",\n";
-                ss << u8"    \"esES\": \"Eyeback el Desatado\",\n";
-                ss << u8"    \"frFR\": \"Barthok le Déchaîné\",\n";
-                ss << u8"    \"itIT\": \"Occhiospino lo Scatenato\",\n";
-                ss << u8"    \"koKR\": \"풀려난 자 아이백\",\n";
-                ss << u8"    \"plPL\": \"Okogłów Wyzwolony\",\n";
-                ss << u8"    \"esMX\": \"Espaldojo el Desatado\",\n";
-                ss << u8"    \"jaJP\": \"解き放たれしアイバック\",\n";
-                ss << u8"    \"ptBR\": \"Costolho, o Desenfreado\",\n";
-                ss << u8"    \"ruRU\": \"Спиноок Высвобожденный\",\n";
-                ss << u8"    \"zhCN\": \"眼魔·狂暴者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22500,\n";
-                ss << u8"    \"Key\": \"Megaflow Rectifier\",\n";
-                ss << u8"    \"enUS\": \"Eldritch the Rectifier\",\n";
-                ss << u8"    \"zhTW\": \"矯正者艾德瑞奇\",\n";
-                ss << u8"    \"deDE\": \"Eldritch der Richter\",\n";
-                ss << u8"    \"esES\": \"Eldritch el Rectificador\",\n";
-                ss << u8"    \"frFR\": \"Eldritch le Rectifieur\",\n";
-                ss << u8"    \"itIT\": \"Il Rettificatore\",\n";
-                ss << u8"    \"koKR\": \"바로잡는 자 엘드리치\",\n";
-                ss << u8"    \"plPL\": \"Eldritch Sprawca\",\n";
-                ss << u8"    \"esMX\": \"Eldritch el Rectificador\",\n";
-                ss << u8"    \"jaJP\": \"矯正者エルドリッチ\",\n";
-                ss << u8"    \"ptBR\": \"Ancestral, o Retificador\",\n";
-                ss << u8"    \"ruRU\": \"Зловещ Уравнитель\",\n";
-                ss << u8"    \"zhCN\": \"艾德雷奇·矫正者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22501,\n";
-                ss << u8"    \"Key\": \"Dac Farren\",\n";
-                ss << u8"    \"enUS\": \"Dac Farren\",\n";
-                ss << u8"    \"zhTW\": \"達克法恩\",\n";
-                ss << u8"    \"deDE\": \"Dac Farren\",\n";
-                ss << u8"    \"esES\": \"Dac Farren\",\n";
-                ss << u8"    \"frFR\": \"Dac Farren\",\n";
-                ss << u8"    \"itIT\": \"Dac Farren\",\n";
-                ss << u8"    \"koKR\": \"닥 파렌\",\n";
-                ss << u8"    \"plPL\": \"Dac Farren\",\n";
-                ss << u8"    \"esMX\": \"Dac Farren\",\n";
-                ss << u8"    \"jaJP\": \"ダック・ファレン\",\n";
-                ss << u8"    \"ptBR\": \"Dac Farren\",\n";
-                ss << u8"    \"ruRU\": \"Дак Фаррен\",\n";
-                ss << u8"    \"zhCN\": \"达克·法伦\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22502,\n";
-                ss << u8"    \"Key\": \"Bonesaw Breaker\",\n";
-                ss << u8"    \"enUS\": \"Bonesaw Breaker\",\n";
-                ss << u8"    \"zhTW\": \"骨鋸破壞者\",\n";
-                ss << u8"    \"deDE\": \"Knochenbrecher\",\n";
-                ss << u8"    \"esES\": \"Rompehuesos\",\n";
-                ss << u8"    \"frFR\": \"L’équarisseur\",\n";
-                ss << u8"    \"itIT\": \"Spezzaossa\",\n";
-                ss << u8"    \"koKR\": \"뼈톱 파괴자\",\n";
-                ss << u8"    \"plPL\": \"Kościozłam\",\n";
-                ss << u8"    \"esMX\": \"Quebrantador de Sierra Ósea\",\n";
-                ss << u8"    \"jaJP\": \"ボーンソー・ブレイカー\",\n";
-                ss << u8"    \"ptBR\": \"Destruidor Serra-ossos\",\n";
-                ss << u8"    \"ruRU\": \"Пилорез Разбиватель\",\n";
-                ss << u8"    \"zhCN\": \"骨锯破坏者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22503,\n";
-                ss << u8"    \"Key\": \"Axe Dweller\",\n";
-                ss << u8"    \"enUS\": \"Axe Dweller\",\n";
-                ss << u8"    \"zhTW\": \"居斧者\",\n";
-                ss << u8"    \"deDE\": \"Axtschwinger\",\n";
-                ss << u8"    \"esES\": \"Morador Hachero\",\n";
-                ss << u8"    \"frFR\": \"Carnefer\",\n";
-                ss << u8"    \"itIT\": \"Ascia Vivente\",\n";
-                ss << u8"    \"koKR\": \"액스 드웰러\",\n";
-                ss << u8"    \"plPL\": \"Siekiernik\",\n";
-                ss << u8"    \"esMX\": \"Morador del Hacha\",\n";
-                ss << u8"    \"jaJP\": \"アクス・ドゥウェラー\",\n";
-                ss << u8"    \"ptBR\": \"Machadino\",\n";
-                ss << u8"    \"ruRU\": \"Топорщик\",\n";
-                ss << u8"    \"zhCN\": \"持斧手\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22504,\n";
-                ss << u8"    \"Key\": \"Frozenstein\",\n";
-                ss << u8"    \"enUS\": \"Frozenstein\",\n";
-                ss << u8"    \"zhTW\": \"冰凍怪魔\",\n";
-                ss << u8"    \"deDE\": \"Froststein\",\n";
-                ss << u8"    \"esES\": \"Heladostein\",\n";
-                ss << u8"    \"frFR\": \"Frankenglace\",\n";
-                ss << u8"    \"itIT\": \"Freddenstein\",\n";
-                ss << u8"    \"koKR\": \"프로즌슈타인\",\n";
-                ss << u8"    \"plPL\": \"Fragmenstein\",\n";
-                ss << u8"    \"esMX\": \"Frozenstein\",\n";
-                ss << u8"    \"jaJP\": \"フローズンシュタイン\",\n";
-                ss << u8"    \"ptBR\": \"Congelenstein\",\n";
-                ss << u8"    \"ruRU\": \"Морозище\",\n";
-                ss << u8"    \"zhCN\": \"冰冻怪魔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 23966,\n";
-                ss << u8"    \"Key\": \"StrMonsterWindow\",\n";
-                ss << u8"    \"enUS\": \"Stained Glass Window\",\n";
-                ss << u8"    \"zhTW\": \"彩玻璃窗\",\n";
-                ss << u8"    \"deDE\": \"Buntglasfenster\",\n";
-                ss << u8"    \"esES\": \"Vitral\",\n";
-                ss << u8"    \"frFR\": \"Vitrail\",\n";
-                ss << u8"    \"itIT\": \"Vetro dipinto - Giallo\",\n";
-                ss << u8"    \"koKR\": \"색유리 창\",\n";
-                ss << u8"    \"plPL\": \"Witraż\",\n";
-                ss << u8"    \"esMX\": \"Ventana de cristal coloreado\",\n";
-                ss << u8"    \"jaJP\": \"ステンドグラス\",\n";
-                ss << u8"    \"ptBR\": \"Janela de Vitral\",\n";
-                ss << u8"    \"ruRU\": \"Витраж\",\n";
-                ss << u8"    \"zhCN\": \"花窗玻璃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 26802,\n";
-                ss << u8"    \"Key\": \"MonsterCorpseNameFormat\",\n";
-                ss << u8"    \"enUS\": \"%s Corpse\",\n";
-                ss << u8"    \"zhTW\": \"%s的屍體\",\n";
-                ss << u8"    \"deDE\": \"Leiche (%s)\",\n";
-                ss << u8"    \"esES\": \"Cadáver de %s\",\n";
-                ss << u8"    \"frFR\": \"Cadavre (%s)\",\n";
-                ss << u8"    \"itIT\": \"Cadavere di %s\",\n";
-                ss << u8"    \"koKR\": \"%s 시체\",\n";
-                ss << u8"    \"plPL\": \"%s (Zwłoki)\",\n";
-                ss << u8"    \"esMX\": \"Cadáver %s\",\n";
-                ss << u8"    \"jaJP\": \"%sの屍\",\n";
-                ss << u8"    \"ptBR\": \"Cadáver de %s\",\n";
-                ss << u8"    \"ruRU\": \"%s – труп\",\n";
-                ss << u8"    \"zhCN\": \"%s残骸\"\n";
-                ss << u8"  }\n";
-                ss << u8"]\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"[\n",
+                u8"  {\n",
+                u8"    \"id\": 1014,\n",
+                u8"    \"Key\": \"Izual\",\n",
+                u8"    \"enUS\": \"Izual\",\n",
+                u8"    \"zhTW\": \"伊卒爾\",\n",
+                u8"    \"deDE\": \"Izual\",\n",
+                u8"    \"esES\": \"Izual\",\n",
+                u8"    \"frFR\": \"Izual\",\n",
+                u8"    \"itIT\": \"Izual\",\n",
+                u8"    \"koKR\": \"이주알\",\n",
+                u8"    \"plPL\": \"Izual\",\n",
+                u8"    \"esMX\": \"Izual\",\n",
+                u8"    \"jaJP\": \"イズアル\",\n",
+                u8"    \"ptBR\": \"Izual\",\n",
+                u8"    \"ruRU\": \"Изуал\",\n",
+                u8"    \"zhCN\": \"衣卒尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1015,\n",
+                u8"    \"Key\": \"izual\",\n",
+                u8"    \"enUS\": \"Izual\",\n",
+                u8"    \"zhTW\": \"伊卒爾\",\n",
+                u8"    \"deDE\": \"Izual\",\n",
+                u8"    \"esES\": \"Izual\",\n",
+                u8"    \"frFR\": \"Izual\",\n",
+                u8"    \"itIT\": \"Izual\",\n",
+                u8"    \"koKR\": \"이주알\",\n",
+                u8"    \"plPL\": \"Izual\",\n",
+                u8"    \"esMX\": \"Izual\",\n",
+                u8"    \"jaJP\": \"イズアル\",\n",
+                u8"    \"ptBR\": \"Izual\",\n",
+                u8"    \"ruRU\": \"Изуал\",\n",
+                u8"    \"zhCN\": \"衣卒尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1067,\n",
+                u8"    \"Key\": \"The Feature Creep\",\n",
+                u8"    \"enUS\": \"Hephasto The Armorer\",\n",
+                u8"    \"zhTW\": \"護甲鍛造師海法斯特\",\n",
+                u8"    \"deDE\": \"Hephaisto der Schmied\",\n",
+                u8"    \"esES\": \"Hefasto el Fabricante de Armaduras\",\n",
+                u8"    \"frFR\": \"Hephasto l’Armurier\",\n",
+                u8"    \"itIT\": \"Efesto l'Armaiolo\",\n",
+                u8"    \"koKR\": \"대장장이 헤파스토\",\n",
+                u8"    \"plPL\": \"Hefasto Zbrojmistrz\",\n",
+                u8"    \"esMX\": \"Efasto el Armero\",\n",
+                u8"    \"jaJP\": \"鎧職人へファスト\",\n",
+                u8"    \"ptBR\": \"Hefasto, o Armoreiro\",\n",
+                u8"    \"ruRU\": \"Гефасто Оружейник\",\n",
+                u8"    \"zhCN\": \"铸甲师赫法斯托\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1068,\n",
+                u8"    \"Key\": \"Hell Bovine\",\n",
+                u8"    \"enUS\": \"Hell Bovine\",\n",
+                u8"    \"zhTW\": \"地獄之牛\",\n",
+                u8"    \"deDE\": \"Höllenbulle\",\n",
+                u8"    \"esES\": \"Bovino del infierno\",\n",
+                u8"    \"frFR\": \"Bovin des Enfers\",\n",
+                u8"    \"itIT\": \"Bovino Infernale\",\n",
+                u8"    \"koKR\": \"지옥 젖소\",\n",
+                u8"    \"plPL\": \"Piekielna krowa\",\n",
+                u8"    \"esMX\": \"Bovino infernal\",\n",
+                u8"    \"jaJP\": \"地獄の牛\",\n",
+                u8"    \"ptBR\": \"Bovino Infernal\",\n",
+                u8"    \"ruRU\": \"Адская корова\",\n",
+                u8"    \"zhCN\": \"地狱魔牛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1235,\n",
+                u8"    \"Key\": \"nodarkwanderer\",\n",
+                u8"    \"enUS\": \"Not in Game\",\n",
+                u8"    \"zhTW\": \"Not in Game\",\n",
+                u8"    \"deDE\": \"Nicht im Spiel\",\n",
+                u8"    \"esES\": \"Not in Game\",\n",
+                u8"    \"frFR\": \"Pas dans le jeu\",\n",
+                u8"    \"itIT\": \"Non in gioco\",\n",
+                u8"    \"koKR\": \"게임에 없음\",\n",
+                u8"    \"plPL\": \"Nie występuje w grze\",\n",
+                u8"    \"esMX\": \"No está en la partida\",\n",
+                u8"    \"jaJP\": \"ゲーム未登場\",\n",
+                u8"    \"ptBR\": \"Não está no jogo\",\n",
+                u8"    \"ruRU\": \"Не в игре\",\n",
+                u8"    \"zhCN\": \"不在游戏中\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1580,\n",
+                u8"    \"Key\": \"Seige Beast\",\n",
+                u8"    \"enUS\": \"           \",\n",
+                u8"    \"zhTW\": \"           \",\n",
+                u8"    \"deDE\": \"           \",\n",
+                u8"    \"esES\": \"           \",\n",
+                u8"    \"frFR\": \"           \",\n",
+                u8"    \"itIT\": \"           \",\n",
+                u8"    \"koKR\": \"Seige Beast\",\n",
+                u8"    \"plPL\": \"           \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1611,\n",
+                u8"    \"Key\": \"BlightWing\",\n",
+                u8"    \"enUS\": \"           \",\n",
+                u8"    \"zhTW\": \"           \",\n",
+                u8"    \"deDE\": \"           \",\n",
+                u8"    \"esES\": \"           \",\n",
+                u8"    \"frFR\": \"           \",\n",
+                u8"    \"itIT\": \"           \",\n",
+                u8"    \"koKR\": \"Blight Wing\",\n",
+                u8"    \"plPL\": \"           \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1612,\n",
+                u8"    \"Key\": \"BloodWitch\",\n",
+                u8"    \"enUS\": \"           \",\n",
+                u8"    \"zhTW\": \"           \",\n",
+                u8"    \"deDE\": \"           \",\n",
+                u8"    \"esES\": \"           \",\n",
+                u8"    \"frFR\": \"           \",\n",
+                u8"    \"itIT\": \"           \",\n",
+                u8"    \"koKR\": \"Blood Witch\",\n",
+                u8"    \"plPL\": \"           \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1616,\n",
+                u8"    \"Key\": \"MageWing\",\n",
+                u8"    \"enUS\": \"         \",\n",
+                u8"    \"zhTW\": \"         \",\n",
+                u8"    \"deDE\": \"         \",\n",
+                u8"    \"esES\": \"         \",\n",
+                u8"    \"frFR\": \"         \",\n",
+                u8"    \"itIT\": \"         \",\n",
+                u8"    \"koKR\": \"Mage Wing\",\n",
+                u8"    \"plPL\": \"         \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1617,\n",
+                u8"    \"Key\": \"HellWitch\",\n",
+                u8"    \"enUS\": \"          \",\n",
+                u8"    \"zhTW\": \"          \",\n",
+                u8"    \"deDE\": \"          \",\n",
+                u8"    \"esES\": \"          \",\n",
+                u8"    \"frFR\": \"          \",\n",
+                u8"    \"itIT\": \"          \",\n",
+                u8"    \"koKR\": \"Hell Witch\",\n",
+                u8"    \"plPL\": \"          \",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2286,\n",
+                u8"    \"Key\": \"GhoulRI\",\n",
+                u8"    \"enUS\": \"Ghoul\",\n",
+                u8"    \"zhTW\": \"食屍鬼\",\n",
+                u8"    \"deDE\": \"Ghul\",\n",
+                u8"    \"esES\": \"Necrófago\",\n",
+                u8"    \"frFR\": \"Goule\",\n",
+                u8"    \"itIT\": \"Mangiamorti\",\n",
+                u8"    \"koKR\": \"구울\",\n",
+                u8"    \"plPL\": \"[fs]Krwiopijcza[ms]Krwiopijczy[nl]Krwiopijcze\",\n",
+                u8"    \"esMX\": \"[ms]de necrófago[fs]de necrófago[mp]de necrófago[fp]de necrófago\",\n",
+                u8"    \"jaJP\": \"グールの\",\n",
+                u8"    \"ptBR\": \"[fs]Carniçal[ms]Carniçal[fp]Carniçais[mp]Carniçais\",\n",
+                u8"    \"ruRU\": \"[ms]вурдалачий[fs]вурдалачья[ns]вурдалачье[pl]вурдалачьи\",\n",
+                u8"    \"zhCN\": \"食尸鬼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2349,\n",
+                u8"    \"Key\": \"crusher\",\n",
+                u8"    \"enUS\": \"Crusher\",\n",
+                u8"    \"zhTW\": \"粉碎者\",\n",
+                u8"    \"deDE\": \"Zermalmer\",\n",
+                u8"    \"esES\": \"Machacadora\",\n",
+                u8"    \"frFR\": \"Broyeur\",\n",
+                u8"    \"itIT\": \"Demolitore\",\n",
+                u8"    \"koKR\": \"분쇄자\",\n",
+                u8"    \"plPL\": \"Miażdżyciel\",\n",
+                u8"    \"esMX\": \"Triturador\",\n",
+                u8"    \"jaJP\": \"壊滅者\",\n",
+                u8"    \"ptBR\": \"Esmagador\",\n",
+                u8"    \"ruRU\": \"Сокрушитель\",\n",
+                u8"    \"zhCN\": \"暴砸兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2463,\n",
+                u8"    \"Key\": \"scarab\",\n",
+                u8"    \"enUS\": \"Scarab\",\n",
+                u8"    \"zhTW\": \"惡魔甲蟲\",\n",
+                u8"    \"deDE\": \"Skarabäus\",\n",
+                u8"    \"esES\": \"Alfazaque\",\n",
+                u8"    \"frFR\": \"Scarabée\",\n",
+                u8"    \"itIT\": \"Scarabeo\",\n",
+                u8"    \"koKR\": \"풍뎅이\",\n",
+                u8"    \"plPL\": \"Skarabeusz\",\n",
+                u8"    \"esMX\": \"Escarabajo\",\n",
+                u8"    \"jaJP\": \"スカラベ\",\n",
+                u8"    \"ptBR\": \"[ms]Escaravelho\",\n",
+                u8"    \"ruRU\": \"Скарабей\",\n",
+                u8"    \"zhCN\": \"圣甲虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2850,\n",
+                u8"    \"Key\": \"The Cow King\",\n",
+                u8"    \"enUS\": \"The Cow King\",\n",
+                u8"    \"zhTW\": \"牛王\",\n",
+                u8"    \"deDE\": \"Der Kuhkönig\",\n",
+                u8"    \"esES\": \"Rey de las Vacas\",\n",
+                u8"    \"frFR\": \"Le roi des vaches\",\n",
+                u8"    \"itIT\": \"Il Re Bovino\",\n",
+                u8"    \"koKR\": \"젖소 왕\",\n",
+                u8"    \"plPL\": \"Krowi Król\",\n",
+                u8"    \"esMX\": \"El Rey Vaca\",\n",
+                u8"    \"jaJP\": \"牛王\",\n",
+                u8"    \"ptBR\": \"O Rei Vaca\",\n",
+                u8"    \"ruRU\": \"Коровий король\",\n",
+                u8"    \"zhCN\": \"母牛之王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2851,\n",
+                u8"    \"Key\": \"Grand Vizier of Chaos\",\n",
+                u8"    \"enUS\": \"Grand Vizier of Chaos\",\n",
+                u8"    \"zhTW\": \"混沌首相\",\n",
+                u8"    \"deDE\": \"Großwesir des Chaos\",\n",
+                u8"    \"esES\": \"Gran Visir del Caos\",\n",
+                u8"    \"frFR\": \"Grand vizir du Chaos\",\n",
+                u8"    \"itIT\": \"Gran Visir del Caos\",\n",
+                u8"    \"koKR\": \"혼돈의 대장로\",\n",
+                u8"    \"plPL\": \"Wielki Wezyr Chaosu\",\n",
+                u8"    \"esMX\": \"Gran Visir del Caos\",\n",
+                u8"    \"jaJP\": \"混沌の大宰相\",\n",
+                u8"    \"ptBR\": \"Grão-vizir do Caos\",\n",
+                u8"    \"ruRU\": \"Великий визирь хаоса\",\n",
+                u8"    \"zhCN\": \"混沌之大维兹尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2852,\n",
+                u8"    \"Key\": \"Lord De Seis\",\n",
+                u8"    \"enUS\": \"Lord De Seis\",\n",
+                u8"    \"zhTW\": \"迪塞斯勳爵\",\n",
+                u8"    \"deDE\": \"Fürst de Seis\",\n",
+                u8"    \"esES\": \"Señor De Seis\",\n",
+                u8"    \"frFR\": \"Seigneur de Seis\",\n",
+                u8"    \"itIT\": \"Lord De Seis\",\n",
+                u8"    \"koKR\": \"군주 사이스\",\n",
+                u8"    \"plPL\": \"Lord De Seis\",\n",
+                u8"    \"esMX\": \"Señor de Seis\",\n",
+                u8"    \"jaJP\": \"サイス卿\",\n",
+                u8"    \"ptBR\": \"Lorde De Seis\",\n",
+                u8"    \"ruRU\": \"Лорд Де Зейс\",\n",
+                u8"    \"zhCN\": \"希斯王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2853,\n",
+                u8"    \"Key\": \"Infector of Souls\",\n",
+                u8"    \"enUS\": \"Infector of Souls\",\n",
+                u8"    \"zhTW\": \"靈魂傳播者\",\n",
+                u8"    \"deDE\": \"Vergifter der Seelen\",\n",
+                u8"    \"esES\": \"Infectador de Almas\",\n",
+                u8"    \"frFR\": \"Corrupteur d’âmes\",\n",
+                u8"    \"itIT\": \"Contaminatore di Anime\",\n",
+                u8"    \"koKR\": \"영혼의 잠식자\",\n",
+                u8"    \"plPL\": \"Zatruwacz Dusz\",\n",
+                u8"    \"esMX\": \"Corruptor de Almas\",\n",
+                u8"    \"jaJP\": \"魂を汚す者\",\n",
+                u8"    \"ptBR\": \"Infestador de Almas\",\n",
+                u8"    \"ruRU\": \"Заразитель душ\",\n",
+                u8"    \"zhCN\": \"灵魂传播者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2854,\n",
+                u8"    \"Key\": \"Riftwraith the Cannibal\",\n",
+                u8"    \"enUS\": \"Riftwraith the Cannibal\",\n",
+                u8"    \"zhTW\": \"食人的裂口之怒\",\n",
+                u8"    \"deDE\": \"Spaltengeist der Kannibale\",\n",
+                u8"    \"esES\": \"Ánima de Falla el Caníbal\",\n",
+                u8"    \"frFR\": \"Spectre-Faille le Cannibale\",\n",
+                u8"    \"itIT\": \"Varcospettro il Cannibale\",\n",
+                u8"    \"koKR\": \"식인귀 리프트레이스\",\n",
+                u8"    \"plPL\": \"Upiór Cienia\",\n",
+                u8"    \"esMX\": \"Grietavil el Caníbal\",\n",
+                u8"    \"jaJP\": \"人食いのリフトレイス\",\n",
+                u8"    \"ptBR\": \"Espectral, o Canibal\",\n",
+                u8"    \"ruRU\": \"Безднород Каннибал\",\n",
+                u8"    \"zhCN\": \"裂隙怨魂·食人者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2855,\n",
+                u8"    \"Key\": \"Taintbreeder\",\n",
+                u8"    \"enUS\": \"Taintbreeder\",\n",
+                u8"    \"zhTW\": \"汙染飼育者\",\n",
+                u8"    \"deDE\": \"Übelbringer\",\n",
+                u8"    \"esES\": \"Contaminador\",\n",
+                u8"    \"frFR\": \"Le grand Corrupteur\",\n",
+                u8"    \"itIT\": \"Contaminatore\",\n",
+                u8"    \"koKR\": \"테인트브리더\",\n",
+                u8"    \"plPL\": \"Plugawiciel\",\n",
+                u8"    \"esMX\": \"Reproductor Impío\",\n",
+                u8"    \"jaJP\": \"腐れの源\",\n",
+                u8"    \"ptBR\": \"Maculador\",\n",
+                u8"    \"ruRU\": \"Сеятель гнили\",\n",
+                u8"    \"zhCN\": \"腐化滋生者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2856,\n",
+                u8"    \"Key\": \"The Tormentor\",\n",
+                u8"    \"enUS\": \"The Tormentor\",\n",
+                u8"    \"zhTW\": \"折磨者\",\n",
+                u8"    \"deDE\": \"der Quäler\",\n",
+                u8"    \"esES\": \"El Atormentador\",\n",
+                u8"    \"frFR\": \"Le Tourmenteur\",\n",
+                u8"    \"itIT\": \"Il Tormentatore\",\n",
+                u8"    \"koKR\": \"고통을 주는 자\",\n",
+                u8"    \"plPL\": \"Oprawca\",\n",
+                u8"    \"esMX\": \"El Atormentador\",\n",
+                u8"    \"jaJP\": \"トーメンター\",\n",
+                u8"    \"ptBR\": \"O Atormentador\",\n",
+                u8"    \"ruRU\": \"Мучитель\",\n",
+                u8"    \"zhCN\": \"折磨者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2857,\n",
+                u8"    \"Key\": \"Winged Death\",\n",
+                u8"    \"enUS\": \"Darkwing\",\n",
+                u8"    \"zhTW\": \"黑暗之翼\",\n",
+                u8"    \"deDE\": \"Schwarzschwinge\",\n",
+                u8"    \"esES\": \"Ala Negra\",\n",
+                u8"    \"frFR\": \"Aile-sombre\",\n",
+                u8"    \"itIT\": \"Alacupa\",\n",
+                u8"    \"koKR\": \"암흑의 날개\",\n",
+                u8"    \"plPL\": \"Ciemnoskrzydły\",\n",
+                u8"    \"esMX\": \"Alanoche\",\n",
+                u8"    \"jaJP\": \"闇の翼\",\n",
+                u8"    \"ptBR\": \"Asa Sombria\",\n",
+                u8"    \"ruRU\": \"Темнокрыл\",\n",
+                u8"    \"zhCN\": \"黑暗之翼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2858,\n",
+                u8"    \"Key\": \"Maffer Dragonhand\",\n",
+                u8"    \"enUS\": \"Maffer Dragonhand\",\n",
+                u8"    \"zhTW\": \"龍手馬弗\",\n",
+                u8"    \"deDE\": \"Maffer Drachenhand\",\n",
+                u8"    \"esES\": \"Maffer Mano de Dragón\",\n",
+                u8"    \"frFR\": \"Maffer Main-de-Dragon\",\n",
+                u8"    \"itIT\": \"Maffer Mano di Drago\",\n",
+                u8"    \"koKR\": \"매퍼 드래곤핸드\",\n",
+                u8"    \"plPL\": \"Maffer Smokoręki\",\n",
+                u8"    \"esMX\": \"Maffer Mano de Dragón\",\n",
+                u8"    \"jaJP\": \"竜掌のマファー\",\n",
+                u8"    \"ptBR\": \"Maffer Dracomano\",\n",
+                u8"    \"ruRU\": \"Маффер Драконорукий\",\n",
+                u8"    \"zhCN\": \"马弗·龙手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2859,\n",
+                u8"    \"Key\": \"Wyand Voidfinger\",\n",
+                u8"    \"enUS\": \"Wyand Voidbringer\",\n",
+                u8"    \"zhTW\": \"虛空指維恩\",\n",
+                u8"    \"deDE\": \"Wyand Todbringer\",\n",
+                u8"    \"esES\": \"Wyand el Vaciador\",\n",
+                u8"    \"frFR\": \"Wyand Porte-Vide\",\n",
+                u8"    \"itIT\": \"Wyand Latore del Vuoto\",\n",
+                u8"    \"koKR\": \"와이앤드 보이드브링어\",\n",
+                u8"    \"plPL\": \"Wyand Pustoszyciel\",\n",
+                u8"    \"esMX\": \"Wyand Portavacío\",\n",
+                u8"    \"jaJP\": \"虚無の遣いワイアンド\",\n",
+                u8"    \"ptBR\": \"Wyand Nulificante\",\n",
+                u8"    \"ruRU\": \"Вианд Призыватель Бездны\",\n",
+                u8"    \"zhCN\": \"韦恩·虚空使者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2860,\n",
+                u8"    \"Key\": \"Toorc Icefist\",\n",
+                u8"    \"enUS\": \"Toorc Icefist\",\n",
+                u8"    \"zhTW\": \"冰拳托克\",\n",
+                u8"    \"deDE\": \"Toorc Eisfaust\",\n",
+                u8"    \"esES\": \"Toorc Puño de Hielo\",\n",
+                u8"    \"frFR\": \"Toorc Poing-de-Glace\",\n",
+                u8"    \"itIT\": \"Toorc Pugno di Ghiaccio\",\n",
+                u8"    \"koKR\": \"투르크 아이스피스트\",\n",
+                u8"    \"plPL\": \"Toorc Lodowa Pięść\",\n",
+                u8"    \"esMX\": \"Toorc Puño de Hielo\",\n",
+                u8"    \"jaJP\": \"氷拳のトゥールク\",\n",
+                u8"    \"ptBR\": \"Toorc Punhofrio\",\n",
+                u8"    \"ruRU\": \"Турк Ледяной Кулак\",\n",
+                u8"    \"zhCN\": \"托克·冰拳\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2861,\n",
+                u8"    \"Key\": \"Bremm Sparkfist\",\n",
+                u8"    \"enUS\": \"Bremm Sparkfist\",\n",
+                u8"    \"zhTW\": \"電光拳布瑞姆\",\n",
+                u8"    \"deDE\": \"Bremm Funkenfaust\",\n",
+                u8"    \"esES\": \"Bremm Puño de Chispas\",\n",
+                u8"    \"frFR\": \"Bremm Poing-de-Feu\",\n",
+                u8"    \"itIT\": \"Bremm Pugno di Folgore\",\n",
+                u8"    \"koKR\": \"브렘 스파크피스트\",\n",
+                u8"    \"plPL\": \"Bremm Iskrząca Pięść\",\n",
+                u8"    \"esMX\": \"Bremm Puño Chispeante\",\n",
+                u8"    \"jaJP\": \"閃拳のブレム\",\n",
+                u8"    \"ptBR\": \"Bremm Punho Faiscante\",\n",
+                u8"    \"ruRU\": \"Бремм Искристый Кулак\",\n",
+                u8"    \"zhCN\": \"布瑞姆·火花之拳\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2862,\n",
+                u8"    \"Key\": \"Geleb Flamefinger\",\n",
+                u8"    \"enUS\": \"Geleb Flamefinger\",\n",
+                u8"    \"zhTW\": \"火焰指吉列布\",\n",
+                u8"    \"deDE\": \"Geleb Flammenfinger\",\n",
+                u8"    \"esES\": \"Geleb Dedo Ardiente\",\n",
+                u8"    \"frFR\": \"Geleb Doigts-de-Feu\",\n",
+                u8"    \"itIT\": \"Geleb Dito di Fiamma\",\n",
+                u8"    \"koKR\": \"겔레브 플레임핑거\",\n",
+                u8"    \"plPL\": \"Geleb Ognistopalcy\",\n",
+                u8"    \"esMX\": \"Geleb Dedo Llameante\",\n",
+                u8"    \"jaJP\": \"炎指のゲレブ\",\n",
+                u8"    \"ptBR\": \"Geleb Incendiário\",\n",
+                u8"    \"ruRU\": \"Гелеб Огнепал\",\n",
+                u8"    \"zhCN\": \"吉勒布·火焰指\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2863,\n",
+                u8"    \"Key\": \"Ismail Vilehand\",\n",
+                u8"    \"enUS\": \"Ismail Vilehand\",\n",
+                u8"    \"zhTW\": \"邪之手伊斯梅爾\",\n",
+                u8"    \"deDE\": \"Ismail Übelhand\",\n",
+                u8"    \"esES\": \"Ismail Mano Vil\",\n",
+                u8"    \"frFR\": \"Ismail Brise-Main\",\n",
+                u8"    \"itIT\": \"Ismail Mano Vile\",\n",
+                u8"    \"koKR\": \"이스마일 바일핸드\",\n",
+                u8"    \"plPL\": \"Ismail Plugaworęki\",\n",
+                u8"    \"esMX\": \"Ismail Manovil\",\n",
+                u8"    \"jaJP\": \"邪掌のイスマイル\",\n",
+                u8"    \"ptBR\": \"Ismail Vilmano\",\n",
+                u8"    \"ruRU\": \"Исмаил Мерзорукий\",\n",
+                u8"    \"zhCN\": \"伊斯梅尔·邪手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2864,\n",
+                u8"    \"Key\": \"Icehawk Riftwing\",\n",
+                u8"    \"enUS\": \"Icehawk Riftwing\",\n",
+                u8"    \"zhTW\": \"裂隙之翼冰鷹\",\n",
+                u8"    \"deDE\": \"Eisfalke Riftflügel\",\n",
+                u8"    \"esES\": \"Alafalla Gerifalte de Hielo\",\n",
+                u8"    \"frFR\": \"Froid-faucon de la faille\",\n",
+                u8"    \"itIT\": \"Gelofalco Alavarco\",\n",
+                u8"    \"koKR\": \"아이스호크 리프트윙\",\n",
+                u8"    \"plPL\": \"Szczelinoskrzydły\",\n",
+                u8"    \"esMX\": \"Alagélida de la Grieta\",\n",
+                u8"    \"jaJP\": \"八つ裂く翼のアイスホーク\",\n",
+                u8"    \"ptBR\": \"Asafenda Gélido\",\n",
+                u8"    \"ruRU\": \"Когтистый ледокрыл\",\n",
+                u8"    \"zhCN\": \"冰鹰·裂痕之翼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2865,\n",
+                u8"    \"Key\": \"Sarina the Battlemaid\",\n",
+                u8"    \"enUS\": \"Battlemaid Sarina\",\n",
+                u8"    \"zhTW\": \"戰場女傑莎莉娜\",\n",
+                u8"    \"deDE\": \"Kampfmaid Sarina\",\n",
+                u8"    \"esES\": \"Doncella Guerrera Sarina\",\n",
+                u8"    \"frFR\": \"Sarina la Vestale\",\n",
+                u8"    \"itIT\": \"Sarina la Guerriera\",\n",
+                u8"    \"koKR\": \"여전사 사리나\",\n",
+                u8"    \"plPL\": \"Wojowniczka Sarina\",\n",
+                u8"    \"esMX\": \"Doncella Sarina\",\n",
+                u8"    \"jaJP\": \"バトルメイド・サリナ\",\n",
+                u8"    \"ptBR\": \"Guerreira Sarina\",\n",
+                u8"    \"ruRU\": \"Дева битвы Сарина\",\n",
+                u8"    \"zhCN\": \"战斗侍女沙利娜\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2866,\n",
+                u8"    \"Key\": \"Stormtree\",\n",
+                u8"    \"enUS\": \"Stormtree\",\n",
+                u8"    \"zhTW\": \"暴風之樹\",\n",
+                u8"    \"deDE\": \"Sturmbaum\",\n",
+                u8"    \"esES\": \"Árbol de Tormenta\",\n",
+                u8"    \"frFR\": \"Arbre-Tonnerre\",\n",
+                u8"    \"itIT\": \"Albero delle Tempeste\",\n",
+                u8"    \"koKR\": \"스톰트리\",\n",
+                u8"    \"plPL\": \"Burzowe Drzewo\",\n",
+                u8"    \"esMX\": \"Árbol Tormentoso\",\n",
+                u8"    \"jaJP\": \"ストームツリー\",\n",
+                u8"    \"ptBR\": \"Tempestárvore\",\n",
+                u8"    \"ruRU\": \"Древо бури\",\n",
+                u8"    \"zhCN\": \"树木风暴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2867,\n",
+                u8"    \"Key\": \"Witch Doctor Endugu\",\n",
+                u8"    \"enUS\": \"Witch Doctor Endugu\",\n",
+                u8"    \"zhTW\": \"巫醫印都古\",\n",
+                u8"    \"deDE\": \"Hexendoktor Endugu\",\n",
+                u8"    \"esES\": \"Hechicero Curandero Endugu\",\n",
+                u8"    \"frFR\": \"Endugu le féticheur\",\n",
+                u8"    \"itIT\": \"Stregone Endugu\",\n",
+                u8"    \"koKR\": \"부두술사 엔두구\",\n",
+                u8"    \"plPL\": \"Szaman Endugu\",\n",
+                u8"    \"esMX\": \"Santero Endugu\",\n",
+                u8"    \"jaJP\": \"呪術医エンドゥグ\",\n",
+                u8"    \"ptBR\": \"Feiticeiro Endugu\",\n",
+                u8"    \"ruRU\": \"Колдун Эндугу\",\n",
+                u8"    \"zhCN\": \"巫医恩杜古\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2868,\n",
+                u8"    \"Key\": \"Web Mage the Burning\",\n",
+                u8"    \"enUS\": \"Sszark the Burning\",\n",
+                u8"    \"zhTW\": \"灼熱的斯札克\",\n",
+                u8"    \"deDE\": \"Zark der Brenner\",\n",
+                u8"    \"esES\": \"Sszark la Ardiente\",\n",
+                u8"    \"frFR\": \"Sszark l’Ardent\",\n",
+                u8"    \"itIT\": \"Sszark il Fiammeggiante\",\n",
+                u8"    \"koKR\": \"불타는 스자크\",\n",
+                u8"    \"plPL\": \"Sszark Płonący\",\n",
+                u8"    \"esMX\": \"Sszark el Ardiente\",\n",
+                u8"    \"jaJP\": \"劫火のスザーク\",\n",
+                u8"    \"ptBR\": \"Sszark, o Flamejante\",\n",
+                u8"    \"ruRU\": \"Ссзарк Пылающий\",\n",
+                u8"    \"zhCN\": \"燃烧的斯扎克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2869,\n",
+                u8"    \"Key\": \"Bishibosh\",\n",
+                u8"    \"enUS\": \"Bishibosh\",\n",
+                u8"    \"zhTW\": \"畢須博須\",\n",
+                u8"    \"deDE\": \"Bischibosch\",\n",
+                u8"    \"esES\": \"Bishibosh\",\n",
+                u8"    \"frFR\": \"Bishibosh\",\n",
+                u8"    \"itIT\": \"Bishibosh\",\n",
+                u8"    \"koKR\": \"비시보시\",\n",
+                u8"    \"plPL\": \"Biszibosz\",\n",
+                u8"    \"esMX\": \"Bishibosh\",\n",
+                u8"    \"jaJP\": \"ビシボシュ\",\n",
+                u8"    \"ptBR\": \"Bishibosh\",\n",
+                u8"    \"ruRU\": \"Бишибош\",\n",
+                u8"    \"zhCN\": \"毕须博须\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2870,\n",
+                u8"    \"Key\": \"Bonebreak\",\n",
+                u8"    \"enUS\": \"Bonebreaker\",\n",
+                u8"    \"zhTW\": \"碎骨者\",\n",
+                u8"    \"deDE\": \"Knochenbrecher\",\n",
+                u8"    \"esES\": \"Quebrantahuesos\",\n",
+                u8"    \"frFR\": \"Concasseur d’os\",\n",
+                u8"    \"itIT\": \"Schiantaossa\",\n",
+                u8"    \"koKR\": \"본브레이커\",\n",
+                u8"    \"plPL\": \"Kościołamacz\",\n",
+                u8"    \"esMX\": \"Rompehuesos\",\n",
+                u8"    \"jaJP\": \"ボーンブレイカー\",\n",
+                u8"    \"ptBR\": \"Quebra-ossos\",\n",
+                u8"    \"ruRU\": \"Костедробильщик\",\n",
+                u8"    \"zhCN\": \"碎骨者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2871,\n",
+                u8"    \"Key\": \"Coldcrow\",\n",
+                u8"    \"enUS\": \"Coldcrow\",\n",
+                u8"    \"zhTW\": \"冰烏鴉\",\n",
+                u8"    \"deDE\": \"Kaltkrähe\",\n",
+                u8"    \"esES\": \"Cuervo Frío\",\n",
+                u8"    \"frFR\": \"Corbeau de froid\",\n",
+                u8"    \"itIT\": \"Corvofreddo\",\n",
+                u8"    \"koKR\": \"콜드크로우\",\n",
+                u8"    \"plPL\": \"Zimna Kruczyca\",\n",
+                u8"    \"esMX\": \"Cuervo Gélido\",\n",
+                u8"    \"jaJP\": \"コールドクロウ\",\n",
+                u8"    \"ptBR\": \"Gelicorvo\",\n",
+                u8"    \"ruRU\": \"Ледяная Ворона\",\n",
+                u8"    \"zhCN\": \"冰冷乌鸦\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2872,\n",
+                u8"    \"Key\": \"Rakanishu\",\n",
+                u8"    \"enUS\": \"Rakanishu\",\n",
+                u8"    \"zhTW\": \"拉卡尼休\",\n",
+                u8"    \"deDE\": \"Rakanischu\",\n",
+                u8"    \"esES\": \"Rakanishu\",\n",
+                u8"    \"frFR\": \"Rakanishu\",\n",
+                u8"    \"itIT\": \"Rakanishu\",\n",
+                u8"    \"koKR\": \"라카니슈\",\n",
+                u8"    \"plPL\": \"Rakaniszu\",\n",
+                u8"    \"esMX\": \"Rakanishu\",\n",
+                u8"    \"jaJP\": \"ラカニシュ\",\n",
+                u8"    \"ptBR\": \"Rakanishu\",\n",
+                u8"    \"ruRU\": \"Раканишу\",\n",
+                u8"    \"zhCN\": \"拉卡尼休\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2873,\n",
+                u8"    \"Key\": \"Treehead WoodFist\",\n",
+                u8"    \"enUS\": \"Treehead WoodFist\",\n",
+                u8"    \"zhTW\": \"樹頭木拳\",\n",
+                u8"    \"deDE\": \"Baumkopf Holzfaust\",\n",
+                u8"    \"esES\": \"Puño de Madera de la Copa del Árbol\",\n",
+                u8"    \"frFR\": \"Crânebois Pognebûche\",\n",
+                u8"    \"itIT\": \"Arborius Pugno di Legno\",\n",
+                u8"    \"koKR\": \"트리헤드 우드피스트\",\n",
+                u8"    \"plPL\": \"Gałęzioręki\",\n",
+                u8"    \"esMX\": \"Puñoleño del Árbol\",\n",
+                u8"    \"jaJP\": \"木拳のツリーヘッド\",\n",
+                u8"    \"ptBR\": \"Arbóreo Lenhoso\",\n",
+                u8"    \"ruRU\": \"Древолоб Дуборук\",\n",
+                u8"    \"zhCN\": \"树头木拳\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2874,\n",
+                u8"    \"Key\": \"Griswold\",\n",
+                u8"    \"enUS\": \"Griswold\",\n",
+                u8"    \"zhTW\": \"格里斯瓦德\",\n",
+                u8"    \"deDE\": \"Griswold\",\n",
+                u8"    \"esES\": \"Griswold\",\n",
+                u8"    \"frFR\": \"Griswold\",\n",
+                u8"    \"itIT\": \"Griswold\",\n",
+                u8"    \"koKR\": \"그리스월드\",\n",
+                u8"    \"plPL\": \"Griswold\",\n",
+                u8"    \"esMX\": \"Griswold\",\n",
+                u8"    \"jaJP\": \"グリズウォルド\",\n",
+                u8"    \"ptBR\": \"[ms]Griswold\",\n",
+                u8"    \"ruRU\": \"Гризвольд\",\n",
+                u8"    \"zhCN\": \"格里斯沃尔德\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2875,\n",
+                u8"    \"Key\": \"The Countess\",\n",
+                u8"    \"enUS\": \"The Countess\",\n",
+                u8"    \"zhTW\": \"女伯爵\",\n",
+                u8"    \"deDE\": \"Die Gräfin\",\n",
+                u8"    \"esES\": \"La Condesa\",\n",
+                u8"    \"frFR\": \"La Comtesse\",\n",
+                u8"    \"itIT\": \"La Contessa\",\n",
+                u8"    \"koKR\": \"백작\",\n",
+                u8"    \"plPL\": \"Hrabina\",\n",
+                u8"    \"esMX\": \"La Condesa\",\n",
+                u8"    \"jaJP\": \"伯爵夫人\",\n",
+                u8"    \"ptBR\": \"A Condessa\",\n",
+                u8"    \"ruRU\": \"Графиня\",\n",
+                u8"    \"zhCN\": \"女伯爵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2876,\n",
+                u8"    \"Key\": \"Pitspawn Fouldog\",\n",
+                u8"    \"enUS\": \"Pitspawn Fouldog\",\n",
+                u8"    \"zhTW\": \"獄淵惡犬\",\n",
+                u8"    \"deDE\": \"Schleimer Faulhund\",\n",
+                u8"    \"esES\": \"Perro Fétido del Foso\",\n",
+                u8"    \"frFR\": \"Chien fétide de la fosse\",\n",
+                u8"    \"itIT\": \"Cane dell'Abisso\",\n",
+                u8"    \"koKR\": \"핏스폰 파울도그\",\n",
+                u8"    \"plPL\": \"Pomiot Czeluści\",\n",
+                u8"    \"esMX\": \"Perro Fétido del Foso\",\n",
+                u8"    \"jaJP\": \"奈落の腐犬\",\n",
+                u8"    \"ptBR\": \"Cão Pestilento\",\n",
+                u8"    \"ruRU\": \"Сквернопес Отродье Преисподней\",\n",
+                u8"    \"zhCN\": \"渊生邪犬\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2877,\n",
+                u8"    \"Key\": \"Flamespike the Crawler\",\n",
+                u8"    \"enUS\": \"Flamespike the Crawler\",\n",
+                u8"    \"zhTW\": \"爬行者火釘\",\n",
+                u8"    \"deDE\": \"Flammenstoß der Kriecher\",\n",
+                u8"    \"esES\": \"Punta Llameante el Reptador\",\n",
+                u8"    \"frFR\": \"Pique-flamme le servile\",\n",
+                u8"    \"itIT\": \"Spinardente lo Strisciante\",\n",
+                u8"    \"koKR\": \"꿈틀거리는 플레임스파이크\",\n",
+                u8"    \"plPL\": \"Płonący Pełzacz\",\n",
+                u8"    \"esMX\": \"Púardiente el Rastrero\",\n",
+                u8"    \"jaJP\": \"這いまわる炎の棘\",\n",
+                u8"    \"ptBR\": \"Espetochama, o Rastejante\",\n",
+                u8"    \"ruRU\": \"Ползучий Огнешип\",\n",
+                u8"    \"zhCN\": \"火焰脊刺\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2878,\n",
+                u8"    \"Key\": \"Boneash\",\n",
+                u8"    \"enUS\": \"Bone Ash\",\n",
+                u8"    \"zhTW\": \"骨灰\",\n",
+                u8"    \"deDE\": \"Knochenasche\",\n",
+                u8"    \"esES\": \"Ceniza de Hueso\",\n",
+                u8"    \"frFR\": \"Cendros\",\n",
+                u8"    \"itIT\": \"Cenere d'Ossa\",\n",
+                u8"    \"koKR\": \"본 애쉬\",\n",
+                u8"    \"plPL\": \"Popiół z Kości\",\n",
+                u8"    \"esMX\": \"Ceniza Ósea\",\n",
+                u8"    \"jaJP\": \"ボーン・アッシュ\",\n",
+                u8"    \"ptBR\": \"Poeira Óssea\",\n",
+                u8"    \"ruRU\": \"Костяной Пепел\",\n",
+                u8"    \"zhCN\": \"骨灰\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2879,\n",
+                u8"    \"Key\": \"Radament\",\n",
+                u8"    \"enUS\": \"Radament\",\n",
+                u8"    \"zhTW\": \"羅達門特\",\n",
+                u8"    \"deDE\": \"Radament\",\n",
+                u8"    \"esES\": \"Radament\",\n",
+                u8"    \"frFR\": \"Radament\",\n",
+                u8"    \"itIT\": \"Radament\",\n",
+                u8"    \"koKR\": \"라다먼트\",\n",
+                u8"    \"plPL\": \"Radament\",\n",
+                u8"    \"esMX\": \"Radament\",\n",
+                u8"    \"jaJP\": \"ラダメント\",\n",
+                u8"    \"ptBR\": \"Radament\",\n",
+                u8"    \"ruRU\": \"Радамант\",\n",
+                u8"    \"zhCN\": \"罗达门特\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2880,\n",
+                u8"    \"Key\": \"Bloodwitch the Wild\",\n",
+                u8"    \"enUS\": \"Bloodwitch the Wild\",\n",
+                u8"    \"zhTW\": \"瘋狂血腥女巫\",\n",
+                u8"    \"deDE\": \"Bluthexe die Wilde\",\n",
+                u8"    \"esES\": \"Bruja Sangrienta la Salvaje\",\n",
+                u8"    \"frFR\": \"Furie-Sanglante la Sauvage\",\n",
+                u8"    \"itIT\": \"Stregarossa la Selvaggia\",\n",
+                u8"    \"koKR\": \"야생의 블러드위치\",\n",
+                u8"    \"plPL\": \"Krwawa Wiedźma\",\n",
+                u8"    \"esMX\": \"Bruja Sangrienta la Salvaje\",\n",
+                u8"    \"jaJP\": \"荒々しきブラッド・ウィッチ\",\n",
+                u8"    \"ptBR\": \"Bruxassangue, a Selvagem\",\n",
+                u8"    \"ruRU\": \"Кровожадка Хищница\",\n",
+                u8"    \"zhCN\": \"狂野的血腥女巫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2881,\n",
+                u8"    \"Key\": \"Fangskin\",\n",
+                u8"    \"enUS\": \"Fangskin\",\n",
+                u8"    \"zhTW\": \"牙皮\",\n",
+                u8"    \"deDE\": \"Reißzahn\",\n",
+                u8"    \"esES\": \"Piel Dentada\",\n",
+                u8"    \"frFR\": \"Sang-Peau\",\n",
+                u8"    \"itIT\": \"Scuoiartiglio\",\n",
+                u8"    \"koKR\": \"팽스킨\",\n",
+                u8"    \"plPL\": \"Zęboskóry\",\n",
+                u8"    \"esMX\": \"Piel Dentada\",\n",
+                u8"    \"jaJP\": \"ファングスキン\",\n",
+                u8"    \"ptBR\": \"Presapele\",\n",
+                u8"    \"ruRU\": \"Кожеклык\",\n",
+                u8"    \"zhCN\": \"牙皮\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2882,\n",
+                u8"    \"Key\": \"Beetleburst\",\n",
+                u8"    \"enUS\": \"Beetleburst\",\n",
+                u8"    \"zhTW\": \"爆蟲\",\n",
+                u8"    \"deDE\": \"Käferkau\",\n",
+                u8"    \"esES\": \"Gran Estallido\",\n",
+                u8"    \"frFR\": \"Scarabée explosif\",\n",
+                u8"    \"itIT\": \"Blattanera\",\n",
+                u8"    \"koKR\": \"비틀버스트\",\n",
+                u8"    \"plPL\": \"Bryzgacz\",\n",
+                u8"    \"esMX\": \"Ráfaga de Escarabajos\",\n",
+                u8"    \"jaJP\": \"ビートルバースト\",\n",
+                u8"    \"ptBR\": \"Bestouro\",\n",
+                u8"    \"ruRU\": \"Взрывожук\",\n",
+                u8"    \"zhCN\": \"突爆甲虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2883,\n",
+                u8"    \"Key\": \"Leatherarm\",\n",
+                u8"    \"enUS\": \"Creeping Feature\",\n",
+                u8"    \"zhTW\": \"蔓延症狀\",\n",
+                u8"    \"deDE\": \"Kriecharm\",\n",
+                u8"    \"esES\": \"Brazo de Cuero\",\n",
+                u8"    \"frFR\": \"Être insidieux\",\n",
+                u8"    \"itIT\": \"Lo Strascicante\",\n",
+                u8"    \"koKR\": \"크리핑 피쳐\",\n",
+                u8"    \"plPL\": \"Pełzająca Część Twarzy\",\n",
+                u8"    \"esMX\": \"Aparición Espeluznante\",\n",
+                u8"    \"jaJP\": \"這い寄りし者\",\n",
+                u8"    \"ptBR\": \"Coisa Arrepiante\",\n",
+                u8"    \"ruRU\": \"Бредущее тело\",\n",
+                u8"    \"zhCN\": \"缓行恐面\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2884,\n",
+                u8"    \"Key\": \"Coldworm the Burrower\",\n",
+                u8"    \"enUS\": \"Coldworm the Burrower\",\n",
+                u8"    \"zhTW\": \"冰蟲鑽地者\",\n",
+                u8"    \"deDE\": \"Kaltwurm der Gräber\",\n",
+                u8"    \"esES\": \"Gusano Frío el Excavador\",\n",
+                u8"    \"frFR\": \"Froide-Larve la Fossoyeuse\",\n",
+                u8"    \"itIT\": \"Vermefreddo lo Scavatore\",\n",
+                u8"    \"koKR\": \"땅굴꾼 콜드웜\",\n",
+                u8"    \"plPL\": \"Zimnoczerw Kopacz\",\n",
+                u8"    \"esMX\": \"Cresálido el Excavador\",\n",
+                u8"    \"jaJP\": \"穴掘るコールドワーム\",\n",
+                u8"    \"ptBR\": \"Vermefrio, o Escavador\",\n",
+                u8"    \"ruRU\": \"Ледочервь Копатель\",\n",
+                u8"    \"zhCN\": \"钻地的冰虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2885,\n",
+                u8"    \"Key\": \"Fire Eye\",\n",
+                u8"    \"enUS\": \"Fire Eye\",\n",
+                u8"    \"zhTW\": \"火之眼\",\n",
+                u8"    \"deDE\": \"Feuerauge\",\n",
+                u8"    \"esES\": \"Ojo de Fuego\",\n",
+                u8"    \"frFR\": \"Œil de Feu\",\n",
+                u8"    \"itIT\": \"Occhio Infuocato\",\n",
+                u8"    \"koKR\": \"파이어 아이\",\n",
+                u8"    \"plPL\": \"Ognistooki\",\n",
+                u8"    \"esMX\": \"Ojo Ardiente\",\n",
+                u8"    \"jaJP\": \"焼ける瞳\",\n",
+                u8"    \"ptBR\": \"Olho Flamejante\",\n",
+                u8"    \"ruRU\": \"Огненный Глаз\",\n",
+                u8"    \"zhCN\": \"火眼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2886,\n",
+                u8"    \"Key\": \"Dark Elder\",\n",
+                u8"    \"enUS\": \"Dark Elder\",\n",
+                u8"    \"zhTW\": \"黑暗長老\",\n",
+                u8"    \"deDE\": \"Dunkler Vorfahr\",\n",
+                u8"    \"esES\": \"Anciano Oscuro\",\n",
+                u8"    \"frFR\": \"Sombre Ancien\",\n",
+                u8"    \"itIT\": \"Anziano Oscuro\",\n",
+                u8"    \"koKR\": \"사악한 장로\",\n",
+                u8"    \"plPL\": \"Mroczny Starzec\",\n",
+                u8"    \"esMX\": \"Ancestro Oscuro\",\n",
+                u8"    \"jaJP\": \"闇のエルダー\",\n",
+                u8"    \"ptBR\": \"Ancião Sombrio\",\n",
+                u8"    \"ruRU\": \"Темный старейшина\",\n",
+                u8"    \"zhCN\": \"黑暗长老\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2887,\n",
+                u8"    \"Key\": \"The Summoner\",\n",
+                u8"    \"enUS\": \"The Summoner\",\n",
+                u8"    \"zhTW\": \"召喚師\",\n",
+                u8"    \"deDE\": \"Der Geisterbeschwörer\",\n",
+                u8"    \"esES\": \"El Invocador\",\n",
+                u8"    \"frFR\": \"L’invocateur\",\n",
+                u8"    \"itIT\": \"L'Evocatore\",\n",
+                u8"    \"koKR\": \"소환사\",\n",
+                u8"    \"plPL\": \"Demonolog\",\n",
+                u8"    \"esMX\": \"El Invocador\",\n",
+                u8"    \"jaJP\": \"召喚師\",\n",
+                u8"    \"ptBR\": \"O Evocador\",\n",
+                u8"    \"ruRU\": \"Призыватель\",\n",
+                u8"    \"zhCN\": \"召唤者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2888,\n",
+                u8"    \"Key\": \"Ancient Kaa the Soulless\",\n",
+                u8"    \"enUS\": \"Ancient Kaa the Soulless\",\n",
+                u8"    \"zhTW\": \"遠古無魂者卡厄\",\n",
+                u8"    \"deDE\": \"Kaa der Seelenlose\",\n",
+                u8"    \"esES\": \"Anciano Kaa el Desalmado\",\n",
+                u8"    \"frFR\": \"Vieux Kaa, l’inhumain\",\n",
+                u8"    \"itIT\": \"Kaa il Senz'Anima\",\n",
+                u8"    \"koKR\": \"넋 나간 고대 카아\",\n",
+                u8"    \"plPL\": \"Prastary Kaa, Bezduszny\",\n",
+                u8"    \"esMX\": \"Anciano Kaa el Desalmado\",\n",
+                u8"    \"jaJP\": \"魂なき古のカー\",\n",
+                u8"    \"ptBR\": \"Kaa Ancestral, o Sem-alma\",\n",
+                u8"    \"ruRU\": \"Древний Каа Бездушник\",\n",
+                u8"    \"zhCN\": \"失魂的先贤卡\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2889,\n",
+                u8"    \"Key\": \"The Smith\",\n",
+                u8"    \"enUS\": \"The Smith\",\n",
+                u8"    \"zhTW\": \"鐵匠\",\n",
+                u8"    \"deDE\": \"Der Schmied\",\n",
+                u8"    \"esES\": \"El Herrero\",\n",
+                u8"    \"frFR\": \"Le forgeron\",\n",
+                u8"    \"itIT\": \"Il Fabbro\",\n",
+                u8"    \"koKR\": \"대장장이\",\n",
+                u8"    \"plPL\": \"Kowal\",\n",
+                u8"    \"esMX\": \"El Herrero\",\n",
+                u8"    \"jaJP\": \"穢れた鍛冶師\",\n",
+                u8"    \"ptBR\": \"O Ferreiro\",\n",
+                u8"    \"ruRU\": \"Кузнец\",\n",
+                u8"    \"zhCN\": \"铁匠\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2897,\n",
+                u8"    \"Key\": \"Rogue\",\n",
+                u8"    \"enUS\": \"Rogue\",\n",
+                u8"    \"zhTW\": \"俠盜\",\n",
+                u8"    \"deDE\": \"Jägerin\",\n",
+                u8"    \"esES\": \"Arpía\",\n",
+                u8"    \"frFR\": \"Rogue\",\n",
+                u8"    \"itIT\": \"Scolta\",\n",
+                u8"    \"koKR\": \"도적\",\n",
+                u8"    \"plPL\": \"Łotrzyca\",\n",
+                u8"    \"esMX\": \"Renegada\",\n",
+                u8"    \"jaJP\": \"ローグ\",\n",
+                u8"    \"ptBR\": \"Renegada\",\n",
+                u8"    \"ruRU\": \"Разбойница\",\n",
+                u8"    \"zhCN\": \"流亡者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2898,\n",
+                u8"    \"Key\": \"StygianDoll\",\n",
+                u8"    \"enUS\": \"Stygian Doll\",\n",
+                u8"    \"zhTW\": \"冥河鬼娃\",\n",
+                u8"    \"deDE\": \"Stygische Puppe\",\n",
+                u8"    \"esES\": \"Muñeco estigio\",\n",
+                u8"    \"frFR\": \"Poupée stygienne\",\n",
+                u8"    \"itIT\": \"Bambola dello Stige\",\n",
+                u8"    \"koKR\": \"저승 꼭두각시\",\n",
+                u8"    \"plPL\": \"Stygijczyk\",\n",
+                u8"    \"esMX\": \"Muñeco estigio\",\n",
+                u8"    \"jaJP\": \"スティジャンドール\",\n",
+                u8"    \"ptBR\": \"[ms]Boneco Estígio\",\n",
+                u8"    \"ruRU\": \"Стигийская кукла\",\n",
+                u8"    \"zhCN\": \"冥河娃娃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2899,\n",
+                u8"    \"Key\": \"SoulKiller\",\n",
+                u8"    \"enUS\": \"Soul Killer\",\n",
+                u8"    \"zhTW\": \"靈魂殺手\",\n",
+                u8"    \"deDE\": \"Seelentöter\",\n",
+                u8"    \"esES\": \"Asesino de almas\",\n",
+                u8"    \"frFR\": \"Dévoreur d’âmes\",\n",
+                u8"    \"itIT\": \"Uccisore di Anime\",\n",
+                u8"    \"koKR\": \"영혼살해자\",\n",
+                u8"    \"plPL\": \"Zabójca dusz\",\n",
+                u8"    \"esMX\": \"Asesino de almas\",\n",
+                u8"    \"jaJP\": \"ソウルキラー\",\n",
+                u8"    \"ptBR\": \"[ms]Mata-almas\",\n",
+                u8"    \"ruRU\": \"Душегуб\",\n",
+                u8"    \"zhCN\": \"灵魂杀手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2900,\n",
+                u8"    \"Key\": \"Flayer\",\n",
+                u8"    \"enUS\": \"Flayer\",\n",
+                u8"    \"zhTW\": \"剝皮手\",\n",
+                u8"    \"deDE\": \"Schinder\",\n",
+                u8"    \"esES\": \"Desollador\",\n",
+                u8"    \"frFR\": \"Écorcheur\",\n",
+                u8"    \"itIT\": \"Scorticatore\",\n",
+                u8"    \"koKR\": \"약탈자\",\n",
+                u8"    \"plPL\": \"Łupieżca\",\n",
+                u8"    \"esMX\": \"Desollador\",\n",
+                u8"    \"jaJP\": \"フレイヤー\",\n",
+                u8"    \"ptBR\": \"[ms]Esfolador\",\n",
+                u8"    \"ruRU\": \"Свежеватель\",\n",
+                u8"    \"zhCN\": \"剥皮魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2901,\n",
+                u8"    \"Key\": \"Fetish\",\n",
+                u8"    \"enUS\": \"Fetish\",\n",
+                u8"    \"zhTW\": \"鬼娃\",\n",
+                u8"    \"deDE\": \"Fetisch\",\n",
+                u8"    \"esES\": \"Fetiche\",\n",
+                u8"    \"frFR\": \"Fétiche\",\n",
+                u8"    \"itIT\": \"Feticcio\",\n",
+                u8"    \"koKR\": \"우상족\",\n",
+                u8"    \"plPL\": \"Fetysz\",\n",
+                u8"    \"esMX\": \"Fetiche\",\n",
+                u8"    \"jaJP\": \"フェティッシュ\",\n",
+                u8"    \"ptBR\": \"[ms]Carranco\",\n",
+                u8"    \"ruRU\": \"Фетиш\",\n",
+                u8"    \"zhCN\": \"鬼娃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2902,\n",
+                u8"    \"Key\": \"RatMan\",\n",
+                u8"    \"enUS\": \"Rat Man\",\n",
+                u8"    \"zhTW\": \"鼠人\",\n",
+                u8"    \"deDE\": \"Rattenmann\",\n",
+                u8"    \"esES\": \"Hombre rata\",\n",
+                u8"    \"frFR\": \"Homme-rat\",\n",
+                u8"    \"itIT\": \"Uomo Ratto\",\n",
+                u8"    \"koKR\": \"쥐 인간\",\n",
+                u8"    \"plPL\": \"Szczuroczłek\",\n",
+                u8"    \"esMX\": \"Ratonero\",\n",
+                u8"    \"jaJP\": \"ラットマン\",\n",
+                u8"    \"ptBR\": \"[ms]Homem-rato\",\n",
+                u8"    \"ruRU\": \"Крысолюд\",\n",
+                u8"    \"zhCN\": \"鼠人\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2903,\n",
+                u8"    \"Key\": \"Undead StygianDoll\",\n",
+                u8"    \"enUS\": \"Undead Stygian Doll\",\n",
+                u8"    \"zhTW\": \"不死冥河鬼娃\",\n",
+                u8"    \"deDE\": \"untote stygische Puppe\",\n",
+                u8"    \"esES\": \"Muñeco estigio viviente\",\n",
+                u8"    \"frFR\": \"Poupée stygienne morte-vivante\",\n",
+                u8"    \"itIT\": \"Bambola dello Stige Non Morta\",\n",
+                u8"    \"koKR\": \"언데드 저승 꼭두각시\",\n",
+                u8"    \"plPL\": \"Nieumarły stygijczyk\",\n",
+                u8"    \"esMX\": \"Muñeco estigio no muerto\",\n",
+                u8"    \"jaJP\": \"蘇りしスティジャンドール\",\n",
+                u8"    \"ptBR\": \"[ms]Boneco Estígio Morto-vivo\",\n",
+                u8"    \"ruRU\": \"Оживленная стигийская кукла\",\n",
+                u8"    \"zhCN\": \"亡灵冥河娃娃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2904,\n",
+                u8"    \"Key\": \"Undead SoulKiller\",\n",
+                u8"    \"enUS\": \"Undead Soul Killer\",\n",
+                u8"    \"zhTW\": \"不死靈魂殺手\",\n",
+                u8"    \"deDE\": \"untoter Seelentöter\",\n",
+                u8"    \"esES\": \"Asesino de almas viviente\",\n",
+                u8"    \"frFR\": \"Faucheur d’âmes mort-vivant\",\n",
+                u8"    \"itIT\": \"Uccisore di Anime Non Morto\",\n",
+                u8"    \"koKR\": \"언데드 영혼살해자\",\n",
+                u8"    \"plPL\": \"Nieumarły zabójca dusz\",\n",
+                u8"    \"esMX\": \"Asesino de almas no muerto\",\n",
+                u8"    \"jaJP\": \"蘇りしソウルキラー\",\n",
+                u8"    \"ptBR\": \"[ms]Mata-almas Morto-vivo\",\n",
+                u8"    \"ruRU\": \"Оживленный душегуб\",\n",
+                u8"    \"zhCN\": \"亡灵灵魂杀手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2905,\n",
+                u8"    \"Key\": \"Undead Flayer\",\n",
+                u8"    \"enUS\": \"Undead Flayer\",\n",
+                u8"    \"zhTW\": \"不死剝皮手\",\n",
+                u8"    \"deDE\": \"untoter Schinder\",\n",
+                u8"    \"esES\": \"Desollador viviente\",\n",
+                u8"    \"frFR\": \"Écorcheur mort-vivant\",\n",
+                u8"    \"itIT\": \"Scorticatore Non Morto\",\n",
+                u8"    \"koKR\": \"언데드 약탈자\",\n",
+                u8"    \"plPL\": \"Nieumarły łupieżca\",\n",
+                u8"    \"esMX\": \"Desollador no muerto\",\n",
+                u8"    \"jaJP\": \"蘇りしフレイヤー\",\n",
+                u8"    \"ptBR\": \"[ms]Esfolador Morto-vivo\",\n",
+                u8"    \"ruRU\": \"Оживленный свежеватель\",\n",
+                u8"    \"zhCN\": \"亡灵剥皮魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2906,\n",
+                u8"    \"Key\": \"Undead Fetish\",\n",
+                u8"    \"enUS\": \"Undead Fetish\",\n",
+                u8"    \"zhTW\": \"不死鬼娃\",\n",
+                u8"    \"deDE\": \"untoter Fetisch\",\n",
+                u8"    \"esES\": \"Fetiche viviente\",\n",
+                u8"    \"frFR\": \"Fétiche mort-vivant\",\n",
+                u8"    \"itIT\": \"Feticcio Non Morto\",\n",
+                u8"    \"koKR\": \"언데드 우상족\",\n",
+                u8"    \"plPL\": \"Nieumarły fetysz\",\n",
+                u8"    \"esMX\": \"Fetiche no muerto\",\n",
+                u8"    \"jaJP\": \"蘇りしフェティッシュ\",\n",
+                u8"    \"ptBR\": \"[ms]Carranco Morto-vivo\",\n",
+                u8"    \"ruRU\": \"Оживленный фетиш\",\n",
+                u8"    \"zhCN\": \"亡灵鬼娃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2907,\n",
+                u8"    \"Key\": \"Undead RatMan\",\n",
+                u8"    \"enUS\": \"Undead Rat Man\",\n",
+                u8"    \"zhTW\": \"不死鼠人\",\n",
+                u8"    \"deDE\": \"untoter Rattenmann\",\n",
+                u8"    \"esES\": \"Hombre rata viviente\",\n",
+                u8"    \"frFR\": \"Homme-rat mort-vivant\",\n",
+                u8"    \"itIT\": \"Uomo Ratto Non Morto\",\n",
+                u8"    \"koKR\": \"언데드 쥐 인간\",\n",
+                u8"    \"plPL\": \"Nieumarły szczuroczłek\",\n",
+                u8"    \"esMX\": \"Ratonero no muerto\",\n",
+                u8"    \"jaJP\": \"蘇りしラットマン\",\n",
+                u8"    \"ptBR\": \"[ms]Homem-rato Morto-vivo\",\n",
+                u8"    \"ruRU\": \"Оживленный крысолюд\",\n",
+                u8"    \"zhCN\": \"亡灵鼠人\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2908,\n",
+                u8"    \"Key\": \"DarkFamiliar\",\n",
+                u8"    \"enUS\": \"Dark Familiar\",\n",
+                u8"    \"zhTW\": \"黑暗魔寵\",\n",
+                u8"    \"deDE\": \"Dunkler Familiar\",\n",
+                u8"    \"esES\": \"Familiar oscuro\",\n",
+                u8"    \"frFR\": \"Familier sombre\",\n",
+                u8"    \"itIT\": \"Demonietto Oscuro\",\n",
+                u8"    \"koKR\": \"어둠의 사역마\",\n",
+                u8"    \"plPL\": \"Mroczny chowaniec\",\n",
+                u8"    \"esMX\": \"Familiar oscuro\",\n",
+                u8"    \"jaJP\": \"闇の眷属\",\n",
+                u8"    \"ptBR\": \"[ms]Familiar Sombrio\",\n",
+                u8"    \"ruRU\": \"Темный фамилиар\",\n",
+                u8"    \"zhCN\": \"黑暗邪蝠\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2909,\n",
+                u8"    \"Key\": \"BloodDiver\",\n",
+                u8"    \"enUS\": \"Blood Diver\",\n",
+                u8"    \"zhTW\": \"鮮血俯衝者\",\n",
+                u8"    \"deDE\": \"Bluttaucher\",\n",
+                u8"    \"esES\": \"Saltador sangriento\",\n",
+                u8"    \"frFR\": \"Desmodon de sang\",\n",
+                u8"    \"itIT\": \"Succhiasangue\",\n",
+                u8"    \"koKR\": \"피 잠수꾼\",\n",
+                u8"    \"plPL\": \"Krwiopijca\",\n",
+                u8"    \"esMX\": \"Zambullidor sangriento\",\n",
+                u8"    \"jaJP\": \"血濡れたコウモリ\",\n",
+                u8"    \"ptBR\": \"[ms]Mergulhador Sangrento\",\n",
+                u8"    \"ruRU\": \"Кровавый пикировщик\",\n",
+                u8"    \"zhCN\": \"俯冲血蝠\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2910,\n",
+                u8"    \"Key\": \"Gloombat\",\n",
+                u8"    \"enUS\": \"Gloombat\",\n",
+                u8"    \"zhTW\": \"幽暗蝙蝠\",\n",
+                u8"    \"deDE\": \"Düstertier\",\n",
+                u8"    \"esES\": \"Murciélago penumbroso\",\n",
+                u8"    \"frFR\": \"Chauve-souris des ténèbres\",\n",
+                u8"    \"itIT\": \"Pipistrello Oscuro\",\n",
+                u8"    \"koKR\": \"어스름박쥐\",\n",
+                u8"    \"plPL\": \"Ciemnoperz\",\n",
+                u8"    \"esMX\": \"Murcilóbrego\",\n",
+                u8"    \"jaJP\": \"闇コウモリ\",\n",
+                u8"    \"ptBR\": \"[ms]Morcego Soturno\",\n",
+                u8"    \"ruRU\": \"Сумрачный нетопырь\",\n",
+                u8"    \"zhCN\": \"幽暗蝠\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2911,\n",
+                u8"    \"Key\": \"DesertWing\",\n",
+                u8"    \"enUS\": \"Desert Wing\",\n",
+                u8"    \"zhTW\": \"沙漠之翼\",\n",
+                u8"    \"deDE\": \"Wüstenflügel\",\n",
+                u8"    \"esES\": \"Ala desértica\",\n",
+                u8"    \"frFR\": \"Aile du désert\",\n",
+                u8"    \"itIT\": \"Ala del Deserto\",\n",
+                u8"    \"koKR\": \"사막 날개\",\n",
+                u8"    \"plPL\": \"Piaskoskrzydły\",\n",
+                u8"    \"esMX\": \"Alas desérticas\",\n",
+                u8"    \"jaJP\": \"砂漠コウモリ\",\n",
+                u8"    \"ptBR\": \"[fs]Asa do Deserto\",\n",
+                u8"    \"ruRU\": \"Пустынный летун\",\n",
+                u8"    \"zhCN\": \"沙漠之翼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2912,\n",
+                u8"    \"Key\": \"Banished\",\n",
+                u8"    \"enUS\": \"The Banished\",\n",
+                u8"    \"zhTW\": \"放逐者\",\n",
+                u8"    \"deDE\": \"Die Verbannten\",\n",
+                u8"    \"esES\": \"Desterrado\",\n",
+                u8"    \"frFR\": \"Le Banni\",\n",
+                u8"    \"itIT\": \"Esiliato\",\n",
+                u8"    \"koKR\": \"추방당한 자\",\n",
+                u8"    \"plPL\": \"Wygnany\",\n",
+                u8"    \"esMX\": \"El desterrado\",\n",
+                u8"    \"jaJP\": \"追放されし者\",\n",
+                u8"    \"ptBR\": \"[ms]O Banido\",\n",
+                u8"    \"ruRU\": \"Изгнанный\",\n",
+                u8"    \"zhCN\": \"被放逐者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2913,\n",
+                u8"    \"Key\": \"BloodLord\",\n",
+                u8"    \"enUS\": \"Blood Lord\",\n",
+                u8"    \"zhTW\": \"鮮血鬼爵\",\n",
+                u8"    \"deDE\": \"Blutfürst\",\n",
+                u8"    \"esES\": \"Señor de la sangre\",\n",
+                u8"    \"frFR\": \"Seigneur de sang\",\n",
+                u8"    \"itIT\": \"Signore del Sangue\",\n",
+                u8"    \"koKR\": \"피의 군주\",\n",
+                u8"    \"plPL\": \"Władca krwi\",\n",
+                u8"    \"esMX\": \"Señor sangriento\",\n",
+                u8"    \"jaJP\": \"血の支配者\",\n",
+                u8"    \"ptBR\": \"[ms]Lorde Sangrento\",\n",
+                u8"    \"ruRU\": \"Владыка крови\",\n",
+                u8"    \"zhCN\": \"血王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2914,\n",
+                u8"    \"Key\": \"DarkLord\",\n",
+                u8"    \"enUS\": \"Dark Lord\",\n",
+                u8"    \"zhTW\": \"黑暗鬼爵\",\n",
+                u8"    \"deDE\": \"Dunkler Fürst\",\n",
+                u8"    \"esES\": \"Señor de la oscuridad\",\n",
+                u8"    \"frFR\": \"Seigneur sombre\",\n",
+                u8"    \"itIT\": \"Signore Oscuro\",\n",
+                u8"    \"koKR\": \"어둠의 군주\",\n",
+                u8"    \"plPL\": \"Pan mroku\",\n",
+                u8"    \"esMX\": \"Señor oscuro\",\n",
+                u8"    \"jaJP\": \"闇の支配者\",\n",
+                u8"    \"ptBR\": \"[ms]Lorde Sombrio\",\n",
+                u8"    \"ruRU\": \"Владыка Тьмы\",\n",
+                u8"    \"zhCN\": \"黑王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2915,\n",
+                u8"    \"Key\": \"NightLord\",\n",
+                u8"    \"enUS\": \"Night Lord\",\n",
+                u8"    \"zhTW\": \"暗夜鬼爵\",\n",
+                u8"    \"deDE\": \"Nachtfürst\",\n",
+                u8"    \"esES\": \"Señor de la noche\",\n",
+                u8"    \"frFR\": \"Seigneur de la Nuit\",\n",
+                u8"    \"itIT\": \"Signore della Notte\",\n",
+                u8"    \"koKR\": \"밤의 군주\",\n",
+                u8"    \"plPL\": \"Władca nocy\",\n",
+                u8"    \"esMX\": \"Señor nocturno\",\n",
+                u8"    \"jaJP\": \"夜の支配者\",\n",
+                u8"    \"ptBR\": \"[ms]Lorde Noturno\",\n",
+                u8"    \"ruRU\": \"Владыка ночи\",\n",
+                u8"    \"zhCN\": \"夜王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2916,\n",
+                u8"    \"Key\": \"GhoulLord\",\n",
+                u8"    \"enUS\": \"Ghoul Lord\",\n",
+                u8"    \"zhTW\": \"食屍鬼爵\",\n",
+                u8"    \"deDE\": \"Ghulfürst\",\n",
+                u8"    \"esES\": \"Señor necrófago\",\n",
+                u8"    \"frFR\": \"Seigneur des goules\",\n",
+                u8"    \"itIT\": \"Signore dei Ghoul\",\n",
+                u8"    \"koKR\": \"구울 군주\",\n",
+                u8"    \"plPL\": \"Pan ghuli\",\n",
+                u8"    \"esMX\": \"Señor necrófago\",\n",
+                u8"    \"jaJP\": \"死肉の支配者\",\n",
+                u8"    \"ptBR\": \"[ms]Lorde Carniçal\",\n",
+                u8"    \"ruRU\": \"Владыка вурдалаков\",\n",
+                u8"    \"zhCN\": \"食尸鬼王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2917,\n",
+                u8"    \"Key\": \"Spikefist\",\n",
+                u8"    \"enUS\": \"Spikefist\",\n",
+                u8"    \"zhTW\": \"釘拳木魔\",\n",
+                u8"    \"deDE\": \"Stachelfaust\",\n",
+                u8"    \"esES\": \"Puño punzante\",\n",
+                u8"    \"frFR\": \"Poing de fer\",\n",
+                u8"    \"itIT\": \"Pugnospino\",\n",
+                u8"    \"koKR\": \"쐐기주먹\",\n",
+                u8"    \"plPL\": \"Kolcopięść\",\n",
+                u8"    \"esMX\": \"Puño espinoso\",\n",
+                u8"    \"jaJP\": \"棘拳の怪物\",\n",
+                u8"    \"ptBR\": \"[ms]Punho Espinhoso\",\n",
+                u8"    \"ruRU\": \"Шипорук\",\n",
+                u8"    \"zhCN\": \"刺拳\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2918,\n",
+                u8"    \"Key\": \"Thrasher\",\n",
+                u8"    \"enUS\": \"Thrasher\",\n",
+                u8"    \"zhTW\": \"笞擊木魔\",\n",
+                u8"    \"deDE\": \"Prügler\",\n",
+                u8"    \"esES\": \"Azotador\",\n",
+                u8"    \"frFR\": \"Vandale\",\n",
+                u8"    \"itIT\": \"Spazzatronchi\",\n",
+                u8"    \"koKR\": \"타작꾼\",\n",
+                u8"    \"plPL\": \"Zgniatacz\",\n",
+                u8"    \"esMX\": \"Moledor\",\n",
+                u8"    \"jaJP\": \"枝打つ巨木\",\n",
+                u8"    \"ptBR\": \"[ms]Solapador\",\n",
+                u8"    \"ruRU\": \"Молотильщик\",\n",
+                u8"    \"zhCN\": \"鞭笞魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2919,\n",
+                u8"    \"Key\": \"BrambleHulk\",\n",
+                u8"    \"enUS\": \"Bramble Hulk\",\n",
+                u8"    \"zhTW\": \"刺藤木魔\",\n",
+                u8"    \"deDE\": \"Stacheldrescher\",\n",
+                u8"    \"esES\": \"Mole de zarzas\",\n",
+                u8"    \"frFR\": \"Colosse des forêts\",\n",
+                u8"    \"itIT\": \"Colosso di Rovi\",\n",
+                u8"    \"koKR\": \"찔레 거수\",\n",
+                u8"    \"plPL\": \"Spaczony kolos\",\n",
+                u8"    \"esMX\": \"Coloso punzante\",\n",
+                u8"    \"jaJP\": \"茨の怪物\",\n",
+                u8"    \"ptBR\": \"[ms]Colosso Sarçoso\",\n",
+                u8"    \"ruRU\": \"Терновый гигант\",\n",
+                u8"    \"zhCN\": \"灌木魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2920,\n",
+                u8"    \"Key\": \"ThornedHulk\",\n",
+                u8"    \"enUS\": \"Thorned Hulk\",\n",
+                u8"    \"zhTW\": \"荊棘木魔\",\n",
+                u8"    \"deDE\": \"Dornendrescher\",\n",
+                u8"    \"esES\": \"Mole espinada\",\n",
+                u8"    \"frFR\": \"Colosse à épine\",\n",
+                u8"    \"itIT\": \"Colosso di Spine\",\n",
+                u8"    \"koKR\": \"바늘 돋친 거수\",\n",
+                u8"    \"plPL\": \"Cierniowy kolos\",\n",
+                u8"    \"esMX\": \"Coloso espinoso\",\n",
+                u8"    \"jaJP\": \"刺の怪物\",\n",
+                u8"    \"ptBR\": \"[ms]Colosso Espinhoso\",\n",
+                u8"    \"ruRU\": \"Шипастый гигант\",\n",
+                u8"    \"zhCN\": \"刺木魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2921,\n",
+                u8"    \"Key\": \"SpiderMagus\",\n",
+                u8"    \"enUS\": \"Spider Magus\",\n",
+                u8"    \"zhTW\": \"法毒蜘蛛\",\n",
+                u8"    \"deDE\": \"Spinnenmagier\",\n",
+                u8"    \"esES\": \"Araña maga\",\n",
+                u8"    \"frFR\": \"Araignée-maga\",\n",
+                u8"    \"itIT\": \"Mago Ragno\",\n",
+                u8"    \"koKR\": \"거미 마술사\",\n",
+                u8"    \"plPL\": \"Pajęczy magus\",\n",
+                u8"    \"esMX\": \"Araña maga\",\n",
+                u8"    \"jaJP\": \"大王蜘蛛\",\n",
+                u8"    \"ptBR\": \"[ms]Magus Aranha\",\n",
+                u8"    \"ruRU\": \"Паук-маг\",\n",
+                u8"    \"zhCN\": \"妖蛛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2922,\n",
+                u8"    \"Key\": \"FlameSpider\",\n",
+                u8"    \"enUS\": \"Flame Spider\",\n",
+                u8"    \"zhTW\": \"火焰蜘蛛\",\n",
+                u8"    \"deDE\": \"Flammenspinne\",\n",
+                u8"    \"esES\": \"Araña llameante\",\n",
+                u8"    \"frFR\": \"Araignée ardente\",\n",
+                u8"    \"itIT\": \"Ragno di Fuoco\",\n",
+                u8"    \"koKR\": \"불길 거미\",\n",
+                u8"    \"plPL\": \"Ognisty pająk\",\n",
+                u8"    \"esMX\": \"Araña ígnea\",\n",
+                u8"    \"jaJP\": \"赤殻蜘蛛\",\n",
+                u8"    \"ptBR\": \"[fs]Aranha Flamejante\",\n",
+                u8"    \"ruRU\": \"Огненный паук\",\n",
+                u8"    \"zhCN\": \"火焰蛛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2923,\n",
+                u8"    \"Key\": \"PoisonSpinner\",\n",
+                u8"    \"enUS\": \"Poison Spinner\",\n",
+                u8"    \"zhTW\": \"劇毒紡織者\",\n",
+                u8"    \"deDE\": \"Giftspinne\",\n",
+                u8"    \"esES\": \"Hilandera venenosa\",\n",
+                u8"    \"frFR\": \"Tisseuse de poison\",\n",
+                u8"    \"itIT\": \"Tessiveleno\",\n",
+                u8"    \"koKR\": \"독 물레거미\",\n",
+                u8"    \"plPL\": \"Tkacz trucizny\",\n",
+                u8"    \"esMX\": \"Tejedora venenosa\",\n",
+                u8"    \"jaJP\": \"毒吐き蜘蛛\",\n",
+                u8"    \"ptBR\": \"[ms]Tece-veneno\",\n",
+                u8"    \"ruRU\": \"Ядовитый ткач\",\n",
+                u8"    \"zhCN\": \"剧毒缠丝蛛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2924,\n",
+                u8"    \"Key\": \"SandFisher\",\n",
+                u8"    \"enUS\": \"Sand Fisher\",\n",
+                u8"    \"zhTW\": \"沙漠釣蛛\",\n",
+                u8"    \"deDE\": \"Sandfischer\",\n",
+                u8"    \"esES\": \"Pescadora de arena\",\n",
+                u8"    \"frFR\": \"Pêcheur des sables\",\n",
+                u8"    \"itIT\": \"Abitatore delle Sabbie\",\n",
+                u8"    \"koKR\": \"모래 사냥꾼\",\n",
+                u8"    \"plPL\": \"Piaskowy rybak\",\n",
+                u8"    \"esMX\": \"Araña arenera\",\n",
+                u8"    \"jaJP\": \"砂漠蜘蛛\",\n",
+                u8"    \"ptBR\": \"[ms]Pescador Arenoso\",\n",
+                u8"    \"ruRU\": \"Ловец песков\",\n",
+                u8"    \"zhCN\": \"沙地捕食蛛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2925,\n",
+                u8"    \"Key\": \"Arach\",\n",
+                u8"    \"enUS\": \"Arach\",\n",
+                u8"    \"zhTW\": \"巨大蜘蛛\",\n",
+                u8"    \"deDE\": \"Arach\",\n",
+                u8"    \"esES\": \"Arácnido\",\n",
+                u8"    \"frFR\": \"Arach\",\n",
+                u8"    \"itIT\": \"Aracnide\",\n",
+                u8"    \"koKR\": \"거대 거미\",\n",
+                u8"    \"plPL\": \"Arachnid\",\n",
+                u8"    \"esMX\": \"Arácnida\",\n",
+                u8"    \"jaJP\": \"大蜘蛛\",\n",
+                u8"    \"ptBR\": \"[ms]Aracnídea\",\n",
+                u8"    \"ruRU\": \"Арах\",\n",
+                u8"    \"zhCN\": \"结网蛛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2926,\n",
+                u8"    \"Key\": \"BloodWing\",\n",
+                u8"    \"enUS\": \"Blood Wing\",\n",
+                u8"    \"zhTW\": \"血翅蚊\",\n",
+                u8"    \"deDE\": \"Blutflügel\",\n",
+                u8"    \"esES\": \"Ala sangrienta\",\n",
+                u8"    \"frFR\": \"Aile sanglante\",\n",
+                u8"    \"itIT\": \"Ala Insanguinata\",\n",
+                u8"    \"koKR\": \"핏빛날개\",\n",
+                u8"    \"plPL\": \"Krwawoskrzydły\",\n",
+                u8"    \"esMX\": \"Alas sangrientas\",\n",
+                u8"    \"jaJP\": \"ブラッド・ウィング\",\n",
+                u8"    \"ptBR\": \"[fs]Asa Sangrenta\",\n",
+                u8"    \"ruRU\": \"Кровокрыл\",\n",
+                u8"    \"zhCN\": \"血翼蚊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2927,\n",
+                u8"    \"Key\": \"BloodHook\",\n",
+                u8"    \"enUS\": \"Blood Hook\",\n",
+                u8"    \"zhTW\": \"血鉤蚊\",\n",
+                u8"    \"deDE\": \"Bluthaken\",\n",
+                u8"    \"esES\": \"Garfio sangriento\",\n",
+                u8"    \"frFR\": \"Crochet sanglant\",\n",
+                u8"    \"itIT\": \"Uncino di Sangue\",\n",
+                u8"    \"koKR\": \"피 갈고리\",\n",
+                u8"    \"plPL\": \"Krwawy szpon\",\n",
+                u8"    \"esMX\": \"Mosquito sanguinario\",\n",
+                u8"    \"jaJP\": \"ブラッド・フック\",\n",
+                u8"    \"ptBR\": \"[ms]Gancho Sangrento\",\n",
+                u8"    \"ruRU\": \"Кровавый коготь\",\n",
+                u8"    \"zhCN\": \"血钩蚊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2928,\n",
+                u8"    \"Key\": \"Feeder\",\n",
+                u8"    \"enUS\": \"Feeder\",\n",
+                u8"    \"zhTW\": \"餵血蚊\",\n",
+                u8"    \"deDE\": \"Fresser\",\n",
+                u8"    \"esES\": \"Comilón\",\n",
+                u8"    \"frFR\": \"Nourricière\",\n",
+                u8"    \"itIT\": \"Succhiavita\",\n",
+                u8"    \"koKR\": \"피먹이\",\n",
+                u8"    \"plPL\": \"Karmiciel\",\n",
+                u8"    \"esMX\": \"Devorador alado\",\n",
+                u8"    \"jaJP\": \"フィーダー\",\n",
+                u8"    \"ptBR\": \"[ms]Cevador\",\n",
+                u8"    \"ruRU\": \"Едок\",\n",
+                u8"    \"zhCN\": \"捕食蚊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2929,\n",
+                u8"    \"Key\": \"Sucker\",\n",
+                u8"    \"enUS\": \"Sucker\",\n",
+                u8"    \"zhTW\": \"吸血蚊\",\n",
+                u8"    \"deDE\": \"Sauger\",\n",
+                u8"    \"esES\": \"Chupóptero\",\n",
+                u8"    \"frFR\": \"Ventouse\",\n",
+                u8"    \"itIT\": \"Prosciugatore\",\n",
+                u8"    \"koKR\": \"피빨이\",\n",
+                u8"    \"plPL\": \"Pijawka\",\n",
+                u8"    \"esMX\": \"Succionador\",\n",
+                u8"    \"jaJP\": \"サッカー\",\n",
+                u8"    \"ptBR\": \"[ms]Sugador\",\n",
+                u8"    \"ruRU\": \"Кровосос\",\n",
+                u8"    \"zhCN\": \"吸食蚊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2930,\n",
+                u8"    \"Key\": \"WingedNightmare\",\n",
+                u8"    \"enUS\": \"Winged Nightmare\",\n",
+                u8"    \"zhTW\": \"飛翼夢魘\",\n",
+                u8"    \"deDE\": \"Geflügelter Alptraum\",\n",
+                u8"    \"esES\": \"Pesadilla alada\",\n",
+                u8"    \"frFR\": \"Cauchemar ailé\",\n",
+                u8"    \"itIT\": \"Incubo Alato\",\n",
+                u8"    \"koKR\": \"날개 달린 악몽\",\n",
+                u8"    \"plPL\": \"Skrzydlaty koszmar\",\n",
+                u8"    \"esMX\": \"Pesadilla alada\",\n",
+                u8"    \"jaJP\": \"ウィングド・ナイトメア\",\n",
+                u8"    \"ptBR\": \"[ms]Pesadelo Alado\",\n",
+                u8"    \"ruRU\": \"Крылатый кошмар\",\n",
+                u8"    \"zhCN\": \"噩梦鸟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2931,\n",
+                u8"    \"Key\": \"HellBuzzard\",\n",
+                u8"    \"enUS\": \"Hell Buzzard\",\n",
+                u8"    \"zhTW\": \"地獄兀鷹\",\n",
+                u8"    \"deDE\": \"Höllenbussard\",\n",
+                u8"    \"esES\": \"Águila infernal\",\n",
+                u8"    \"frFR\": \"Buse des Enfers\",\n",
+                u8"    \"itIT\": \"Avvoltoio Infernale\",\n",
+                u8"    \"koKR\": \"지옥 독수리\",\n",
+                u8"    \"plPL\": \"Piekielny ścierwojad\",\n",
+                u8"    \"esMX\": \"Gavilán infernal\",\n",
+                u8"    \"jaJP\": \"ヘル・バザード\",\n",
+                u8"    \"ptBR\": \"[ms]Urubu Infernal\",\n",
+                u8"    \"ruRU\": \"Адский канюк\",\n",
+                u8"    \"zhCN\": \"地狱秃鹫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2932,\n",
+                u8"    \"Key\": \"UndeadScavenger\",\n",
+                u8"    \"enUS\": \"Undead Scavenger\",\n",
+                u8"    \"zhTW\": \"不死食腐鳥\",\n",
+                u8"    \"deDE\": \"Untoter Aasfresser\",\n",
+                u8"    \"esES\": \"Carroñero viviente\",\n",
+                u8"    \"frFR\": \"Charognard mort-vivant\",\n",
+                u8"    \"itIT\": \"Saprofago Non Morto\",\n",
+                u8"    \"koKR\": \"언데드 시체청소부\",\n",
+                u8"    \"plPL\": \"Trupojad\",\n",
+                u8"    \"esMX\": \"Carroñero no muerto\",\n",
+                u8"    \"jaJP\": \"アンデッド・スカヴェンジャー\",\n",
+                u8"    \"ptBR\": \"[ms]Vorazgo Morto-vivo\",\n",
+                u8"    \"ruRU\": \"Оживленный падальщик\",\n",
+                u8"    \"zhCN\": \"食尸鸟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2933,\n",
+                u8"    \"Key\": \"CarrionBird\",\n",
+                u8"    \"enUS\": \"Carrion Bird\",\n",
+                u8"    \"zhTW\": \"食腐鳥\",\n",
+                u8"    \"deDE\": \"Aasvogel\",\n",
+                u8"    \"esES\": \"Pájaro carroñero\",\n",
+                u8"    \"frFR\": \"Charognard\",\n",
+                u8"    \"itIT\": \"Mangiacarogne\",\n",
+                u8"    \"koKR\": \"송장새\",\n",
+                u8"    \"plPL\": \"Zgnilec\",\n",
+                u8"    \"esMX\": \"Ave carroñera\",\n",
+                u8"    \"jaJP\": \"キャリオン・バード\",\n",
+                u8"    \"ptBR\": \"[fs]Ave Carniceira\",\n",
+                u8"    \"ruRU\": \"Стервятник\",\n",
+                u8"    \"zhCN\": \"食腐鸟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2934,\n",
+                u8"    \"Key\": \"Unraveler\",\n",
+                u8"    \"enUS\": \"Unraveler\",\n",
+                u8"    \"zhTW\": \"解繃者\",\n",
+                u8"    \"deDE\": \"Vernichter\",\n",
+                u8"    \"esES\": \"Desenredador\",\n",
+                u8"    \"frFR\": \"Disloqueuse\",\n",
+                u8"    \"itIT\": \"Celato\",\n",
+                u8"    \"koKR\": \"풀어헤치는 자\",\n",
+                u8"    \"plPL\": \"Wyzwoliciel\",\n",
+                u8"    \"esMX\": \"Desenredador\",\n",
+                u8"    \"jaJP\": \"綻びし者\",\n",
+                u8"    \"ptBR\": \"[ms]Desfiador\",\n",
+                u8"    \"ruRU\": \"Разматыватель\",\n",
+                u8"    \"zhCN\": \"剖尸者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2935,\n",
+                u8"    \"Key\": \"Guardian\",\n",
+                u8"    \"enUS\": \"Guardian\",\n",
+                u8"    \"zhTW\": \"守護者\",\n",
+                u8"    \"deDE\": \"Wächter\",\n",
+                u8"    \"esES\": \"Guardián\",\n",
+                u8"    \"frFR\": \"Gardienne\",\n",
+                u8"    \"itIT\": \"Guardiano\",\n",
+                u8"    \"koKR\": \"수호자\",\n",
+                u8"    \"plPL\": \"Strażnik\",\n",
+                u8"    \"esMX\": \"Guardián\",\n",
+                u8"    \"jaJP\": \"守護せし者\",\n",
+                u8"    \"ptBR\": \"[ms]Guardião\",\n",
+                u8"    \"ruRU\": \"Страж\",\n",
+                u8"    \"zhCN\": \"墓穴守卫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2936,\n",
+                u8"    \"Key\": \"HollowOne\",\n",
+                u8"    \"enUS\": \"Hollow One\",\n",
+                u8"    \"zhTW\": \"中空屍怪\",\n",
+                u8"    \"deDE\": \"Leere Kreatur\",\n",
+                u8"    \"esES\": \"Vacuo\",\n",
+                u8"    \"frFR\": \"Caverneux\",\n",
+                u8"    \"itIT\": \"Affamato\",\n",
+                u8"    \"koKR\": \"공허한 자\",\n",
+                u8"    \"plPL\": \"Pusta istota\",\n",
+                u8"    \"esMX\": \"Oquedad\",\n",
+                u8"    \"jaJP\": \"虚ろなる者\",\n",
+                u8"    \"ptBR\": \"[ms]Desolado\",\n",
+                u8"    \"ruRU\": \"Опустошенный\",\n",
+                u8"    \"zhCN\": \"空壳尸魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2937,\n",
+                u8"    \"Key\": \"Horadrim Ancient\",\n",
+                u8"    \"enUS\": \"Horadrim Ancient\",\n",
+                u8"    \"zhTW\": \"赫拉迪姆古屍\",\n",
+                u8"    \"deDE\": \"Horadrimvorfahr\",\n",
+                u8"    \"esES\": \"Anciano Horadrim\",\n",
+                u8"    \"frFR\": \"Ancien horadrim\",\n",
+                u8"    \"itIT\": \"Antico Horadrim\",\n",
+                u8"    \"koKR\": \"고대 호라드림\",\n",
+                u8"    \"plPL\": \"Prastary horadrim\",\n",
+                u8"    \"esMX\": \"Ancestro horadrim\",\n",
+                u8"    \"jaJP\": \"古代のホラドリム\",\n",
+                u8"    \"ptBR\": \"[ms]Ancestral Horadrim\",\n",
+                u8"    \"ruRU\": \"Хорадримский древний\",\n",
+                u8"    \"zhCN\": \"赫拉迪姆先贤\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2938,\n",
+                u8"    \"Key\": \"AlbinoRoach\",\n",
+                u8"    \"enUS\": \"Bone Scarab\",\n",
+                u8"    \"zhTW\": \"骸骨甲蟲\",\n",
+                u8"    \"deDE\": \"Knochenkäfer\",\n",
+                u8"    \"esES\": \"Alfazaque de hueso\",\n",
+                u8"    \"frFR\": \"Scarabée d’os\",\n",
+                u8"    \"itIT\": \"Scarabeo d'Ossa\",\n",
+                u8"    \"koKR\": \"뼈 풍뎅이\",\n",
+                u8"    \"plPL\": \"Kościany skarabeusz\",\n",
+                u8"    \"esMX\": \"Escarabajo óseo\",\n",
+                u8"    \"jaJP\": \"ボーン・スカラベ\",\n",
+                u8"    \"ptBR\": \"[ms]Escaravelho Ósseo\",\n",
+                u8"    \"ruRU\": \"Костяной скарабей\",\n",
+                u8"    \"zhCN\": \"白骨圣甲虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2939,\n",
+                u8"    \"Key\": \"SteelWeevil\",\n",
+                u8"    \"enUS\": \"Steel Scarab\",\n",
+                u8"    \"zhTW\": \"鋼鐵甲蟲\",\n",
+                u8"    \"deDE\": \"Stahlkäfer\",\n",
+                u8"    \"esES\": \"Alfazaque de acero\",\n",
+                u8"    \"frFR\": \"Scarabée d’acier\",\n",
+                u8"    \"itIT\": \"Scarabeo d'Acciaio\",\n",
+                u8"    \"koKR\": \"강철 풍뎅이\",\n",
+                u8"    \"plPL\": \"Stalowy skarabeusz\",\n",
+                u8"    \"esMX\": \"Escarabajo metálico\",\n",
+                u8"    \"jaJP\": \"スチール・スカラベ\",\n",
+                u8"    \"ptBR\": \"[ms]Escaravelho de Aço\",\n",
+                u8"    \"ruRU\": \"Стальной скарабей\",\n",
+                u8"    \"zhCN\": \"钢铁圣甲虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2940,\n",
+                u8"    \"Key\": \"Scarab\",\n",
+                u8"    \"enUS\": \"Scarab\",\n",
+                u8"    \"zhTW\": \"惡魔甲蟲\",\n",
+                u8"    \"deDE\": \"Skarabäus\",\n",
+                u8"    \"esES\": \"Alfazaque\",\n",
+                u8"    \"frFR\": \"Scarabée\",\n",
+                u8"    \"itIT\": \"Scarabeo\",\n",
+                u8"    \"koKR\": \"풍뎅이\",\n",
+                u8"    \"plPL\": \"Skarabeusz\",\n",
+                u8"    \"esMX\": \"Escarabajo\",\n",
+                u8"    \"jaJP\": \"スカラベ\",\n",
+                u8"    \"ptBR\": \"[ms]Escaravelho\",\n",
+                u8"    \"ruRU\": \"Скарабей\",\n",
+                u8"    \"zhCN\": \"圣甲虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2941,\n",
+                u8"    \"Key\": \"SandWarrior\",\n",
+                u8"    \"enUS\": \"Death Beetle\",\n",
+                u8"    \"zhTW\": \"死亡甲蟲\",\n",
+                u8"    \"deDE\": \"Todeskäfer\",\n",
+                u8"    \"esES\": \"Escarabajo de la muerte\",\n",
+                u8"    \"frFR\": \"Scarabée de mort\",\n",
+                u8"    \"itIT\": \"Scarafaggio della Morte\",\n",
+                u8"    \"koKR\": \"죽음의 딱정벌레\",\n",
+                u8"    \"plPL\": \"Żuk śmierci\",\n",
+                u8"    \"esMX\": \"Escarabajo mortal\",\n",
+                u8"    \"jaJP\": \"デス・ビートル\",\n",
+                u8"    \"ptBR\": \"[ms]Besouro Fúnebre\",\n",
+                u8"    \"ruRU\": \"Жук-убийца\",\n",
+                u8"    \"zhCN\": \"死亡甲虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2942,\n",
+                u8"    \"Key\": \"DungSoldier\",\n",
+                u8"    \"enUS\": \"Dung Soldier\",\n",
+                u8"    \"zhTW\": \"蜣螂兵蟲\",\n",
+                u8"    \"deDE\": \"Dungsoldat\",\n",
+                u8"    \"esES\": \"Soldado coprófago\",\n",
+                u8"    \"frFR\": \"Soldat de la fange\",\n",
+                u8"    \"itIT\": \"Stercorario Soldato\",\n",
+                u8"    \"koKR\": \"쇠똥구리 병사\",\n",
+                u8"    \"plPL\": \"Żuk wojownik\",\n",
+                u8"    \"esMX\": \"Escarabajo estercolero\",\n",
+                u8"    \"jaJP\": \"ダング・ソルジャー\",\n",
+                u8"    \"ptBR\": \"[ms]Escaravelho Soldado\",\n",
+                u8"    \"ruRU\": \"Навозник-солдат\",\n",
+                u8"    \"zhCN\": \"水肥战士\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2943,\n",
+                u8"    \"Key\": \"HellSwarm\",\n",
+                u8"    \"enUS\": \"Hell Swarm\",\n",
+                u8"    \"zhTW\": \"地獄蟲群\",\n",
+                u8"    \"deDE\": \"Höllenschwarm\",\n",
+                u8"    \"esES\": \"Enjambre infernal\",\n",
+                u8"    \"frFR\": \"Essaim des Enfers\",\n",
+                u8"    \"itIT\": \"Sciame Infernale\",\n",
+                u8"    \"koKR\": \"지옥 벌레떼\",\n",
+                u8"    \"plPL\": \"Piekielny rój\",\n",
+                u8"    \"esMX\": \"Enjambre infernal\",\n",
+                u8"    \"jaJP\": \"地獄蝗の群れ\",\n",
+                u8"    \"ptBR\": \"[ms]Enxame Infernal\",\n",
+                u8"    \"ruRU\": \"Адский рой\",\n",
+                u8"    \"zhCN\": \"地狱虫群\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2944,\n",
+                u8"    \"Key\": \"PlagueBugs\",\n",
+                u8"    \"enUS\": \"Plague Bugs\",\n",
+                u8"    \"zhTW\": \"瘟疫之蟲\",\n",
+                u8"    \"deDE\": \"Pestkäfer\",\n",
+                u8"    \"esES\": \"Chinches de la peste\",\n",
+                u8"    \"frFR\": \"Vermine pestiférée\",\n",
+                u8"    \"itIT\": \"Sciame Morbifero\",\n",
+                u8"    \"koKR\": \"역병 벌레떼\",\n",
+                u8"    \"plPL\": \"Pluskwy zarazy\",\n",
+                u8"    \"esMX\": \"Bichos pestilentes\",\n",
+                u8"    \"jaJP\": \"厄災蝗の群れ\",\n",
+                u8"    \"ptBR\": \"[mp]Insetos Pestilentos\",\n",
+                u8"    \"ruRU\": \"Чумные жуки\",\n",
+                u8"    \"zhCN\": \"疫虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2945,\n",
+                u8"    \"Key\": \"BlackLocusts\",\n",
+                u8"    \"enUS\": \"Black Locusts\",\n",
+                u8"    \"zhTW\": \"黑色蝗蟲\",\n",
+                u8"    \"deDE\": \"Schwarze Heuschrecken\",\n",
+                u8"    \"esES\": \"Langostas negras\",\n",
+                u8"    \"frFR\": \"Criquets noirs\",\n",
+                u8"    \"itIT\": \"Sciame di Locuste\",\n",
+                u8"    \"koKR\": \"검은 메뚜기 떼\",\n",
+                u8"    \"plPL\": \"Czarna szarańcza\",\n",
+                u8"    \"esMX\": \"Langostas oscuras\",\n",
+                u8"    \"jaJP\": \"闇蝗の群れ\",\n",
+                u8"    \"ptBR\": \"[mp]Gafanhotos Tenebrosos\",\n",
+                u8"    \"ruRU\": \"Черная саранча\",\n",
+                u8"    \"zhCN\": \"黑蝗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2946,\n",
+                u8"    \"Key\": \"Itchies\",\n",
+                u8"    \"enUS\": \"Itchies\",\n",
+                u8"    \"zhTW\": \"刺螫蟲群\",\n",
+                u8"    \"deDE\": \"Stichlinge\",\n",
+                u8"    \"esES\": \"Cínifes\",\n",
+                u8"    \"frFR\": \"Punaises\",\n",
+                u8"    \"itIT\": \"Sciame Urticante\",\n",
+                u8"    \"koKR\": \"피부병 벌레떼\",\n",
+                u8"    \"plPL\": \"Świerzb\",\n",
+                u8"    \"esMX\": \"Sarnosos\",\n",
+                u8"    \"jaJP\": \"蝗の群れ\",\n",
+                u8"    \"ptBR\": \"[mp]Sarnentos\",\n",
+                u8"    \"ruRU\": \"Гнус\",\n",
+                u8"    \"zhCN\": \"蚤群\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2947,\n",
+                u8"    \"Key\": \"HellCat\",\n",
+                u8"    \"enUS\": \"Hell Cat\",\n",
+                u8"    \"zhTW\": \"地獄拉庫尼\",\n",
+                u8"    \"deDE\": \"Höllenkatze\",\n",
+                u8"    \"esES\": \"Gata infernal\",\n",
+                u8"    \"frFR\": \"Chat des Enfers\",\n",
+                u8"    \"itIT\": \"Felino Infernale\",\n",
+                u8"    \"koKR\": \"지옥 고양이\",\n",
+                u8"    \"plPL\": \"Piekielny kot\",\n",
+                u8"    \"esMX\": \"Gata infernal\",\n",
+                u8"    \"jaJP\": \"ヘル・キャット\",\n",
+                u8"    \"ptBR\": \"[ms]Felino Infernal\",\n",
+                u8"    \"ruRU\": \"Адская кошка\",\n",
+                u8"    \"zhCN\": \"地狱猫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2948,\n",
+                u8"    \"Key\": \"NightTiger\",\n",
+                u8"    \"enUS\": \"Night Tiger\",\n",
+                u8"    \"zhTW\": \"暗夜拉庫尼\",\n",
+                u8"    \"deDE\": \"Nachttiger\",\n",
+                u8"    \"esES\": \"Tigresa de la noche\",\n",
+                u8"    \"frFR\": \"Tigre de la nuit\",\n",
+                u8"    \"itIT\": \"Tigre della Notte\",\n",
+                u8"    \"koKR\": \"밤 호랑이\",\n",
+                u8"    \"plPL\": \"Nocny tygrys\",\n",
+                u8"    \"esMX\": \"Tigresa nocturna\",\n",
+                u8"    \"jaJP\": \"ナイト・タイガー\",\n",
+                u8"    \"ptBR\": \"[ms]Tigre Noturno\",\n",
+                u8"    \"ruRU\": \"Ночная тигрица\",\n",
+                u8"    \"zhCN\": \"夜行虎\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2949,\n",
+                u8"    \"Key\": \"SaberCat\",\n",
+                u8"    \"enUS\": \"Saber Cat\",\n",
+                u8"    \"zhTW\": \"拉庫尼\",\n",
+                u8"    \"deDE\": \"Säbelkatze\",\n",
+                u8"    \"esES\": \"Dientes de sable\",\n",
+                u8"    \"frFR\": \"Tigre à dents de sabre\",\n",
+                u8"    \"itIT\": \"Felino dai Denti a Sciabola\",\n",
+                u8"    \"koKR\": \"사브르 고양이\",\n",
+                u8"    \"plPL\": \"Szablokot\",\n",
+                u8"    \"esMX\": \"Gata filosa\",\n",
+                u8"    \"jaJP\": \"サーベル・キャット\",\n",
+                u8"    \"ptBR\": \"[ms]Felino-de-Sabre\",\n",
+                u8"    \"ruRU\": \"Саблезубая кошка\",\n",
+                u8"    \"zhCN\": \"剑齿猫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2950,\n",
+                u8"    \"Key\": \"Huntress\",\n",
+                u8"    \"enUS\": \"Huntress\",\n",
+                u8"    \"zhTW\": \"女獵手\",\n",
+                u8"    \"deDE\": \"Sucherin\",\n",
+                u8"    \"esES\": \"Cazadora\",\n",
+                u8"    \"frFR\": \"Chasseresse\",\n",
+                u8"    \"itIT\": \"Cacciatrice\",\n",
+                u8"    \"koKR\": \"여사냥꾼\",\n",
+                u8"    \"plPL\": \"Łowczyni\",\n",
+                u8"    \"esMX\": \"Cazadora\",\n",
+                u8"    \"jaJP\": \"ハントレス\",\n",
+                u8"    \"ptBR\": \"[fs]Caçadora\",\n",
+                u8"    \"ruRU\": \"Охотница\",\n",
+                u8"    \"zhCN\": \"母猎猫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2951,\n",
+                u8"    \"Key\": \"RazorPitDemon\",\n",
+                u8"    \"enUS\": \"Cliff Lurker\",\n",
+                u8"    \"zhTW\": \"峭壁潛伏者\",\n",
+                u8"    \"deDE\": \"Klippenschleicher\",\n",
+                u8"    \"esES\": \"Rondador de los acantilados\",\n",
+                u8"    \"frFR\": \"Rôdeur des falaises\",\n",
+                u8"    \"itIT\": \"Creatura dei Dirupi\",\n",
+                u8"    \"koKR\": \"벼랑 잠복꾼\",\n",
+                u8"    \"plPL\": \"Skalny skoczek\",\n",
+                u8"    \"esMX\": \"Acechador escarpado\",\n",
+                u8"    \"jaJP\": \"クリフ・ラーカー\",\n",
+                u8"    \"ptBR\": \"[ms]Espreitador do Penhasco\",\n",
+                u8"    \"ruRU\": \"Скальный прыгун\",\n",
+                u8"    \"zhCN\": \"峭壁潜伏魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2952,\n",
+                u8"    \"Key\": \"TreeLurker\",\n",
+                u8"    \"enUS\": \"Tree Lurker\",\n",
+                u8"    \"zhTW\": \"樹木潛伏者\",\n",
+                u8"    \"deDE\": \"Baumschleicher\",\n",
+                u8"    \"esES\": \"Rondador de los árboles\",\n",
+                u8"    \"frFR\": \"Sycophante\",\n",
+                u8"    \"itIT\": \"Bestia degli Alberi\",\n",
+                u8"    \"koKR\": \"나무 잠복꾼\",\n",
+                u8"    \"plPL\": \"Leśny skoczek\",\n",
+                u8"    \"esMX\": \"Acechador arbóreo\",\n",
+                u8"    \"jaJP\": \"ツリー・ラーカー\",\n",
+                u8"    \"ptBR\": \"[ms]Espreitador Arbóreo\",\n",
+                u8"    \"ruRU\": \"Древесный прыгун\",\n",
+                u8"    \"zhCN\": \"林木潜伏魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2953,\n",
+                u8"    \"Key\": \"CaveLeaper\",\n",
+                u8"    \"enUS\": \"Cave Leaper\",\n",
+                u8"    \"zhTW\": \"洞穴躍行魔\",\n",
+                u8"    \"deDE\": \"Höhlenspringer\",\n",
+                u8"    \"esES\": \"Saltador de las cavernas\",\n",
+                u8"    \"frFR\": \"Farfadet cavernicole\",\n",
+                u8"    \"itIT\": \"Saltatore delle Caverne\",\n",
+                u8"    \"koKR\": \"동굴 껑충이\",\n",
+                u8"    \"plPL\": \"Jaskiniowy skoczek\",\n",
+                u8"    \"esMX\": \"Saltador de cuevas\",\n",
+                u8"    \"jaJP\": \"ケイブ・リーパー\",\n",
+                u8"    \"ptBR\": \"[ms]Saltador da Caverna\",\n",
+                u8"    \"ruRU\": \"Пещерный прыгун\",\n",
+                u8"    \"zhCN\": \"洞穴跃行魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2954,\n",
+                u8"    \"Key\": \"TombCreeper\",\n",
+                u8"    \"enUS\": \"Tomb Creeper\",\n",
+                u8"    \"zhTW\": \"古墓爬跳者\",\n",
+                u8"    \"deDE\": \"Grabkriecher\",\n",
+                u8"    \"esES\": \"Salteador de tumbas\",\n",
+                u8"    \"frFR\": \"Lierre tombal\",\n",
+                u8"    \"itIT\": \"Orrore delle Tombe\",\n",
+                u8"    \"koKR\": \"무덤 추적수\",\n",
+                u8"    \"plPL\": \"Grobowy pełzacz\",\n",
+                u8"    \"esMX\": \"Reptante de tumbas\",\n",
+                u8"    \"jaJP\": \"トゥーム・クリーパー\",\n",
+                u8"    \"ptBR\": \"[ms]Rastejante da Tumba\",\n",
+                u8"    \"ruRU\": \"Могильный ползун\",\n",
+                u8"    \"zhCN\": \"墓地跃行魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2955,\n",
+                u8"    \"Key\": \"SandLeaper\",\n",
+                u8"    \"enUS\": \"Sand Leaper\",\n",
+                u8"    \"zhTW\": \"沙漠躍行魔\",\n",
+                u8"    \"deDE\": \"Sandspringer\",\n",
+                u8"    \"esES\": \"Saltador de arena\",\n",
+                u8"    \"frFR\": \"Farfadet des sables\",\n",
+                u8"    \"itIT\": \"Saltatore delle Sabbie\",\n",
+                u8"    \"koKR\": \"모래 껑충이\",\n",
+                u8"    \"plPL\": \"Piaskowy skoczek\",\n",
+                u8"    \"esMX\": \"Saltador de arena\",\n",
+                u8"    \"jaJP\": \"サンド・リーパー\",\n",
+                u8"    \"ptBR\": \"[ms]Saltador Arenoso\",\n",
+                u8"    \"ruRU\": \"Песчаный прыгун\",\n",
+                u8"    \"zhCN\": \"沙地跃行魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2956,\n",
+                u8"    \"Key\": \"TombViper\",\n",
+                u8"    \"enUS\": \"Tomb Viper\",\n",
+                u8"    \"zhTW\": \"古墓蛇魔\",\n",
+                u8"    \"deDE\": \"Grabviper\",\n",
+                u8"    \"esES\": \"Víbora de la tumba\",\n",
+                u8"    \"frFR\": \"Vipère des tombes\",\n",
+                u8"    \"itIT\": \"Vipera delle Tombe\",\n",
+                u8"    \"koKR\": \"무덤 독사\",\n",
+                u8"    \"plPL\": \"Grobowa żmija\",\n",
+                u8"    \"esMX\": \"Vipérido sepulcral\",\n",
+                u8"    \"jaJP\": \"トゥーム・ヴァイパー\",\n",
+                u8"    \"ptBR\": \"[fs]Víbora da Tumba\",\n",
+                u8"    \"ruRU\": \"Могильный змей\",\n",
+                u8"    \"zhCN\": \"古墓蝮蛇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2957,\n",
+                u8"    \"Key\": \"PitViper\",\n",
+                u8"    \"enUS\": \"Pit Viper\",\n",
+                u8"    \"zhTW\": \"地穴蛇魔\",\n",
+                u8"    \"deDE\": \"Grubenviper\",\n",
+                u8"    \"esES\": \"Víbora del foso\",\n",
+                u8"    \"frFR\": \"Vipère de la fosse\",\n",
+                u8"    \"itIT\": \"Vipera dell'Abisso\",\n",
+                u8"    \"koKR\": \"구덩이 독사\",\n",
+                u8"    \"plPL\": \"Żmija czeluści\",\n",
+                u8"    \"esMX\": \"Vipérido del foso\",\n",
+                u8"    \"jaJP\": \"ピット・ヴァイパー\",\n",
+                u8"    \"ptBR\": \"[fs]Víbora do Fosso\",\n",
+                u8"    \"ruRU\": \"Змей бездны\",\n",
+                u8"    \"zhCN\": \"深渊蝮蛇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2958,\n",
+                u8"    \"Key\": \"Salamander\",\n",
+                u8"    \"enUS\": \"Salamander\",\n",
+                u8"    \"zhTW\": \"火蜥蛇魔\",\n",
+                u8"    \"deDE\": \"Salamander\",\n",
+                u8"    \"esES\": \"Salamandra\",\n",
+                u8"    \"frFR\": \"Salamandre\",\n",
+                u8"    \"itIT\": \"Salamandra\",\n",
+                u8"    \"koKR\": \"불도마뱀\",\n",
+                u8"    \"plPL\": \"Salamandra\",\n",
+                u8"    \"esMX\": \"Salamandra\",\n",
+                u8"    \"jaJP\": \"サラマンダー\",\n",
+                u8"    \"ptBR\": \"[fs]Salamandra\",\n",
+                u8"    \"ruRU\": \"Саламандра\",\n",
+                u8"    \"zhCN\": \"蟒螈蛇妖\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2959,\n",
+                u8"    \"Key\": \"ClawViper\",\n",
+                u8"    \"enUS\": \"Claw Viper\",\n",
+                u8"    \"zhTW\": \"利爪蛇魔\",\n",
+                u8"    \"deDE\": \"Klauenviper\",\n",
+                u8"    \"esES\": \"Garra viperina\",\n",
+                u8"    \"frFR\": \"Vipère de la Griffe\",\n",
+                u8"    \"itIT\": \"Vipera Artigliata\",\n",
+                u8"    \"koKR\": \"발톱 독사\",\n",
+                u8"    \"plPL\": \"Żmijoszpon\",\n",
+                u8"    \"esMX\": \"Vipérido de garras\",\n",
+                u8"    \"jaJP\": \"クロウ・ヴァイパー\",\n",
+                u8"    \"ptBR\": \"[fs]Víbora da Garra\",\n",
+                u8"    \"ruRU\": \"Когтистый змей\",\n",
+                u8"    \"zhCN\": \"利爪蝮蛇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2960,\n",
+                u8"    \"Key\": \"SerpentMagus\",\n",
+                u8"    \"enUS\": \"Serpent Magus\",\n",
+                u8"    \"zhTW\": \"蛇魔法師\",\n",
+                u8"    \"deDE\": \"Natternmagier\",\n",
+                u8"    \"esES\": \"Serpiente maga\",\n",
+                u8"    \"frFR\": \"Magus serpentin\",\n",
+                u8"    \"itIT\": \"Mago Serpente\",\n",
+                u8"    \"koKR\": \"구렁이 마술사\",\n",
+                u8"    \"plPL\": \"Wężowy magus\",\n",
+                u8"    \"esMX\": \"Mago serpentino\",\n",
+                u8"    \"jaJP\": \"サーペント・マグス\",\n",
+                u8"    \"ptBR\": \"[ms]Magus Serpente\",\n",
+                u8"    \"ruRU\": \"Змей-колдун\",\n",
+                u8"    \"zhCN\": \"蛇妖法师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2961,\n",
+                u8"    \"Key\": \"WorldKiller\",\n",
+                u8"    \"enUS\": \"Blood Maggot\",\n",
+                u8"    \"zhTW\": \"鮮血蛆蟲\",\n",
+                u8"    \"deDE\": \"Blutwurm\",\n",
+                u8"    \"esES\": \"Gusano de sangre\",\n",
+                u8"    \"frFR\": \"Asticot de sang\",\n",
+                u8"    \"itIT\": \"Larva del Sangue\",\n",
+                u8"    \"koKR\": \"피 구더기\",\n",
+                u8"    \"plPL\": \"Krwiożercza larwa\",\n",
+                u8"    \"esMX\": \"Cresa de sangre\",\n",
+                u8"    \"jaJP\": \"血濡れた地虫\",\n",
+                u8"    \"ptBR\": \"[ms]Verme Sangrento\",\n",
+                u8"    \"ruRU\": \"Кровавая мокрица\",\n",
+                u8"    \"zhCN\": \"血虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2962,\n",
+                u8"    \"Key\": \"GiantLamprey\",\n",
+                u8"    \"enUS\": \"Giant Lamprey\",\n",
+                u8"    \"zhTW\": \"吸血巨蟲\",\n",
+                u8"    \"deDE\": \"Riesenmuräne\",\n",
+                u8"    \"esES\": \"Lamprea gigante\",\n",
+                u8"    \"frFR\": \"Lamproie géante\",\n",
+                u8"    \"itIT\": \"Lampreda Gigante\",\n",
+                u8"    \"koKR\": \"거대 빨판구더기\",\n",
+                u8"    \"plPL\": \"Skolopendromorf\",\n",
+                u8"    \"esMX\": \"Lamprea gigante\",\n",
+                u8"    \"jaJP\": \"吸血地虫\",\n",
+                u8"    \"ptBR\": \"[fs]Lampreia Gigante\",\n",
+                u8"    \"ruRU\": \"Гигантская жужелица\",\n",
+                u8"    \"zhCN\": \"巨型八目虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2963,\n",
+                u8"    \"Key\": \"Devourer\",\n",
+                u8"    \"enUS\": \"Devourer\",\n",
+                u8"    \"zhTW\": \"吞噬者\",\n",
+                u8"    \"deDE\": \"Verschlinger\",\n",
+                u8"    \"esES\": \"Devorador\",\n",
+                u8"    \"frFR\": \"Dévoreur\",\n",
+                u8"    \"itIT\": \"Divoratore\",\n",
+                u8"    \"koKR\": \"걸신구더기\",\n",
+                u8"    \"plPL\": \"Pożeracz\",\n",
+                u8"    \"esMX\": \"Devorador\",\n",
+                u8"    \"jaJP\": \"貪る地虫\",\n",
+                u8"    \"ptBR\": \"[ms]Devorador\",\n",
+                u8"    \"ruRU\": \"Пожиратель\",\n",
+                u8"    \"zhCN\": \"吞食虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2964,\n",
+                u8"    \"Key\": \"RockWorm\",\n",
+                u8"    \"enUS\": \"Rock Worm\",\n",
+                u8"    \"zhTW\": \"鑽岩蛆蟲\",\n",
+                u8"    \"deDE\": \"Felswurm\",\n",
+                u8"    \"esES\": \"Gusano de roca\",\n",
+                u8"    \"frFR\": \"Ver des roches\",\n",
+                u8"    \"itIT\": \"Verme di Roccia\",\n",
+                u8"    \"koKR\": \"바위 벌레\",\n",
+                u8"    \"plPL\": \"Skalny robak\",\n",
+                u8"    \"esMX\": \"Gusano de piedra\",\n",
+                u8"    \"jaJP\": \"岩棲みの地虫\",\n",
+                u8"    \"ptBR\": \"[ms]Verme Rochoso\",\n",
+                u8"    \"ruRU\": \"Каменный червь\",\n",
+                u8"    \"zhCN\": \"岩虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2965,\n",
+                u8"    \"Key\": \"SandMaggot\",\n",
+                u8"    \"enUS\": \"Sand Maggot\",\n",
+                u8"    \"zhTW\": \"沙漠蛆蟲\",\n",
+                u8"    \"deDE\": \"Sandwurm\",\n",
+                u8"    \"esES\": \"Gusano de arena\",\n",
+                u8"    \"frFR\": \"Asticot des sables\",\n",
+                u8"    \"itIT\": \"Larva della Sabbia\",\n",
+                u8"    \"koKR\": \"모래 구더기\",\n",
+                u8"    \"plPL\": \"Piasecznik\",\n",
+                u8"    \"esMX\": \"Cresa de arena\",\n",
+                u8"    \"jaJP\": \"砂漠の地虫\",\n",
+                u8"    \"ptBR\": \"[ms]Verme Arenoso\",\n",
+                u8"    \"ruRU\": \"Песчаная мокрица\",\n",
+                u8"    \"zhCN\": \"沙虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2966,\n",
+                u8"    \"Key\": \"JungleUrchin\",\n",
+                u8"    \"enUS\": \"Bush Barb\",\n",
+                u8"    \"zhTW\": \"灌木倒刺怪\",\n",
+                u8"    \"deDE\": \"Buschdorn\",\n",
+                u8"    \"esES\": \"Púa de maleza\",\n",
+                u8"    \"frFR\": \"Oursin des forêts\",\n",
+                u8"    \"itIT\": \"Barbiglio Acuminato\",\n",
+                u8"    \"koKR\": \"덤불 가시\",\n",
+                u8"    \"plPL\": \"Kolcokrzew\",\n",
+                u8"    \"esMX\": \"Arbusto de púas\",\n",
+                u8"    \"jaJP\": \"ブッシュ・バーブ\",\n",
+                u8"    \"ptBR\": \"[ms]Arbusto Farpado\",\n",
+                u8"    \"ruRU\": \"Травяной вредитель\",\n",
+                u8"    \"zhCN\": \"棘丛魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2967,\n",
+                u8"    \"Key\": \"RazorSpine\",\n",
+                u8"    \"enUS\": \"Razor Spine\",\n",
+                u8"    \"zhTW\": \"刃脊獸\",\n",
+                u8"    \"deDE\": \"Klingenrücken\",\n",
+                u8"    \"esES\": \"Espina afilada\",\n",
+                u8"    \"frFR\": \"Démon à épines\",\n",
+                u8"    \"itIT\": \"Lama di Rasoio\",\n",
+                u8"    \"koKR\": \"서슬 가시\",\n",
+                u8"    \"plPL\": \"Kolcobrzytwa\",\n",
+                u8"    \"esMX\": \"Espina de navajas\",\n",
+                u8"    \"jaJP\": \"レイザー・スパイン\",\n",
+                u8"    \"ptBR\": \"[ms]Espinha-navalha\",\n",
+                u8"    \"ruRU\": \"Остроспин\",\n",
+                u8"    \"zhCN\": \"剃刀刺魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2968,\n",
+                u8"    \"Key\": \"ThornBeast\",\n",
+                u8"    \"enUS\": \"Thorn Beast\",\n",
+                u8"    \"zhTW\": \"荊棘獸\",\n",
+                u8"    \"deDE\": \"Dornenbestie\",\n",
+                u8"    \"esES\": \"Bestia de espinas\",\n",
+                u8"    \"frFR\": \"Bête à épines\",\n",
+                u8"    \"itIT\": \"Bestia Spinosa\",\n",
+                u8"    \"koKR\": \"가시 야수\",\n",
+                u8"    \"plPL\": \"Cierniowa bestia\",\n",
+                u8"    \"esMX\": \"Bestia espinosa\",\n",
+                u8"    \"jaJP\": \"ソーン・ビースト\",\n",
+                u8"    \"ptBR\": \"[fs]Fera Espinhosa\",\n",
+                u8"    \"ruRU\": \"Шипастая тварь\",\n",
+                u8"    \"zhCN\": \"棘刺兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2969,\n",
+                u8"    \"Key\": \"SpikeFiend\",\n",
+                u8"    \"enUS\": \"Spike Fiend\",\n",
+                u8"    \"zhTW\": \"釘刺魔\",\n",
+                u8"    \"deDE\": \"Dornendämon\",\n",
+                u8"    \"esES\": \"Maligno con pinchos\",\n",
+                u8"    \"frFR\": \"Démon à pointes\",\n",
+                u8"    \"itIT\": \"Demone Spinato\",\n",
+                u8"    \"koKR\": \"쐐기 마귀\",\n",
+                u8"    \"plPL\": \"Kolczasty bies\",\n",
+                u8"    \"esMX\": \"Demonio espinoso\",\n",
+                u8"    \"jaJP\": \"スパイク・フィーンド\",\n",
+                u8"    \"ptBR\": \"[ms]Demônio Espinhoso\",\n",
+                u8"    \"ruRU\": \"Шипастый бес\",\n",
+                u8"    \"zhCN\": \"刺脊魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2970,\n",
+                u8"    \"Key\": \"QuillRat\",\n",
+                u8"    \"enUS\": \"Quill Rat\",\n",
+                u8"    \"zhTW\": \"針刺鼠\",\n",
+                u8"    \"deDE\": \"Stachelratte\",\n",
+                u8"    \"esES\": \"Rata con cálamos\",\n",
+                u8"    \"frFR\": \"Rat-épic\",\n",
+                u8"    \"itIT\": \"Rattospino\",\n",
+                u8"    \"koKR\": \"가시 쥐\",\n",
+                u8"    \"plPL\": \"Kolczasty szczur\",\n",
+                u8"    \"esMX\": \"Ratón crampón\",\n",
+                u8"    \"jaJP\": \"クィル・ラット\",\n",
+                u8"    \"ptBR\": \"[ms]Rato-ouriço\",\n",
+                u8"    \"ruRU\": \"Шипастая крыса\",\n",
+                u8"    \"zhCN\": \"刺毛鼠\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2971,\n",
+                u8"    \"Key\": \"HellClan\",\n",
+                u8"    \"enUS\": \"Hell Clan\",\n",
+                u8"    \"zhTW\": \"冥府羊頭人\",\n",
+                u8"    \"deDE\": \"Höllenclan\",\n",
+                u8"    \"esES\": \"Clan infernal\",\n",
+                u8"    \"frFR\": \"Clan des Enfers\",\n",
+                u8"    \"itIT\": \"Clan degli Inferi\",\n",
+                u8"    \"koKR\": \"지옥혈족원\",\n",
+                u8"    \"plPL\": \"Klan Piekieł\",\n",
+                u8"    \"esMX\": \"Clan infernal\",\n",
+                u8"    \"jaJP\": \"地獄の一族\",\n",
+                u8"    \"ptBR\": \"[ms]Clã Infernal\",\n",
+                u8"    \"ruRU\": \"Прислужник Преисподней\",\n",
+                u8"    \"zhCN\": \"地狱氏族\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2972,\n",
+                u8"    \"Key\": \"MoonClan\",\n",
+                u8"    \"enUS\": \"Moon Clan\",\n",
+                u8"    \"zhTW\": \"月族羊頭人\",\n",
+                u8"    \"deDE\": \"Mondclan\",\n",
+                u8"    \"esES\": \"Clan de la luna\",\n",
+                u8"    \"frFR\": \"Clan de la Lune\",\n",
+                u8"    \"itIT\": \"Clan della Luna\",\n",
+                u8"    \"koKR\": \"달혈족원\",\n",
+                u8"    \"plPL\": \"Klan Księżyca\",\n",
+                u8"    \"esMX\": \"Clan lunar\",\n",
+                u8"    \"jaJP\": \"月の一族\",\n",
+                u8"    \"ptBR\": \"[ms]Clã da Lua\",\n",
+                u8"    \"ruRU\": \"Прислужник луны\",\n",
+                u8"    \"zhCN\": \"月亮氏族\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2973,\n",
+                u8"    \"Key\": \"NightClan\",\n",
+                u8"    \"enUS\": \"Night Clan\",\n",
+                u8"    \"zhTW\": \"夜族羊頭人\",\n",
+                u8"    \"deDE\": \"Nachtclan\",\n",
+                u8"    \"esES\": \"Clan de la noche\",\n",
+                u8"    \"frFR\": \"Clan de la Nuit\",\n",
+                u8"    \"itIT\": \"Clan della Notte\",\n",
+                u8"    \"koKR\": \"밤혈족원\",\n",
+                u8"    \"plPL\": \"Klan Nocy\",\n",
+                u8"    \"esMX\": \"Clan nocturno\",\n",
+                u8"    \"jaJP\": \"夜の一族\",\n",
+                u8"    \"ptBR\": \"[ms]Clã da Noite\",\n",
+                u8"    \"ruRU\": \"Прислужник ночи\",\n",
+                u8"    \"zhCN\": \"黑夜氏族\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2974,\n",
+                u8"    \"Key\": \"DeathClan\",\n",
+                u8"    \"enUS\": \"Death Clan\",\n",
+                u8"    \"zhTW\": \"死族羊頭人\",\n",
+                u8"    \"deDE\": \"Todesclan\",\n",
+                u8"    \"esES\": \"Clan de la muerte\",\n",
+                u8"    \"frFR\": \"Clan de la Mort\",\n",
+                u8"    \"itIT\": \"Clan della Morte\",\n",
+                u8"    \"koKR\": \"사멸혈족원\",\n",
+                u8"    \"plPL\": \"Klan Śmierci\",\n",
+                u8"    \"esMX\": \"Clan fúnebre\",\n",
+                u8"    \"jaJP\": \"死の一族\",\n",
+                u8"    \"ptBR\": \"[ms]Clã da Morte\",\n",
+                u8"    \"ruRU\": \"Прислужник смерти\",\n",
+                u8"    \"zhCN\": \"死亡氏族\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2975,\n",
+                u8"    \"Key\": \"BloodClan\",\n",
+                u8"    \"enUS\": \"Blood Clan\",\n",
+                u8"    \"zhTW\": \"血族羊頭人\",\n",
+                u8"    \"deDE\": \"Blutclan\",\n",
+                u8"    \"esES\": \"Clan de los sangrientos\",\n",
+                u8"    \"frFR\": \"Clan du Sang\",\n",
+                u8"    \"itIT\": \"Clan del Sangue\",\n",
+                u8"    \"koKR\": \"핏빛혈족원\",\n",
+                u8"    \"plPL\": \"Klan Krwi\",\n",
+                u8"    \"esMX\": \"Clan sangriento\",\n",
+                u8"    \"jaJP\": \"血の一族\",\n",
+                u8"    \"ptBR\": \"[ms]Clã do Sangue\",\n",
+                u8"    \"ruRU\": \"Прислужник крови\",\n",
+                u8"    \"zhCN\": \"鲜血氏族\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2976,\n",
+                u8"    \"Key\": \"TempleGuard\",\n",
+                u8"    \"enUS\": \"Temple Guard\",\n",
+                u8"    \"zhTW\": \"神殿守衛\",\n",
+                u8"    \"deDE\": \"Tempelwächter\",\n",
+                u8"    \"esES\": \"Guardia del templo\",\n",
+                u8"    \"frFR\": \"Garde du temple\",\n",
+                u8"    \"itIT\": \"Guardia del Tempio\",\n",
+                u8"    \"koKR\": \"사원 파수꾼\",\n",
+                u8"    \"plPL\": \"Strażnik świątyni\",\n",
+                u8"    \"esMX\": \"Guardia del templo\",\n",
+                u8"    \"jaJP\": \"寺院の魔獣\",\n",
+                u8"    \"ptBR\": \"[ms]Guarda do Templo\",\n",
+                u8"    \"ruRU\": \"Храмовый страж\",\n",
+                u8"    \"zhCN\": \"神庙守卫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2977,\n",
+                u8"    \"Key\": \"DoomApe\",\n",
+                u8"    \"enUS\": \"Doom Ape\",\n",
+                u8"    \"zhTW\": \"毀滅猿怪\",\n",
+                u8"    \"deDE\": \"Affe der Verdammnis\",\n",
+                u8"    \"esES\": \"Simio de la fatalidad\",\n",
+                u8"    \"frFR\": \"Singe maudit\",\n",
+                u8"    \"itIT\": \"Gorilla della Rovina\",\n",
+                u8"    \"koKR\": \"파멸의 유인원\",\n",
+                u8"    \"plPL\": \"Małpa zagłady\",\n",
+                u8"    \"esMX\": \"Simio de la calamidad\",\n",
+                u8"    \"jaJP\": \"ドゥーム・エイプ\",\n",
+                u8"    \"ptBR\": \"[ms]Símio da Perdição\",\n",
+                u8"    \"ruRU\": \"Жуткая обезьяна\",\n",
+                u8"    \"zhCN\": \"厄运猿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2978,\n",
+                u8"    \"Key\": \"JungleHunter\",\n",
+                u8"    \"enUS\": \"Jungle Hunter\",\n",
+                u8"    \"zhTW\": \"叢林獵手\",\n",
+                u8"    \"deDE\": \"Dschungeljäger\",\n",
+                u8"    \"esES\": \"Cazador de la selva\",\n",
+                u8"    \"frFR\": \"Chasseur de la jungle\",\n",
+                u8"    \"itIT\": \"Cacciatore della Giungla\",\n",
+                u8"    \"koKR\": \"밀림 사냥꾼\",\n",
+                u8"    \"plPL\": \"Leśny łowca\",\n",
+                u8"    \"esMX\": \"Cazador de la selva\",\n",
+                u8"    \"jaJP\": \"密林の魔獣\",\n",
+                u8"    \"ptBR\": \"[ms]Caçador da Selva\",\n",
+                u8"    \"ruRU\": \"Джунглевый охотник\",\n",
+                u8"    \"zhCN\": \"丛林猎手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2979,\n",
+                u8"    \"Key\": \"RockDweller\",\n",
+                u8"    \"enUS\": \"Rock Dweller\",\n",
+                u8"    \"zhTW\": \"石居猿\",\n",
+                u8"    \"deDE\": \"Felsenbewohner\",\n",
+                u8"    \"esES\": \"Morador de la roca\",\n",
+                u8"    \"frFR\": \"Habitant des roches\",\n",
+                u8"    \"itIT\": \"Creatura delle Rocce\",\n",
+                u8"    \"koKR\": \"바위 괴수\",\n",
+                u8"    \"plPL\": \"Skalnik\",\n",
+                u8"    \"esMX\": \"Morador pétreo\",\n",
+                u8"    \"jaJP\": \"岩地の魔獣\",\n",
+                u8"    \"ptBR\": \"[ms]Habitante das Rochas\",\n",
+                u8"    \"ruRU\": \"Обитатель камней\",\n",
+                u8"    \"zhCN\": \"岩居兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2980,\n",
+                u8"    \"Key\": \"DuneBeast\",\n",
+                u8"    \"enUS\": \"Dune Beast\",\n",
+                u8"    \"zhTW\": \"沙丘猿獸\",\n",
+                u8"    \"deDE\": \"Dünenbestie\",\n",
+                u8"    \"esES\": \"Bestia de la duna\",\n",
+                u8"    \"frFR\": \"Bête des dunes\",\n",
+                u8"    \"itIT\": \"Bestia delle Dune\",\n",
+                u8"    \"koKR\": \"모래사막 야수\",\n",
+                u8"    \"plPL\": \"Bestia z wydm\",\n",
+                u8"    \"esMX\": \"Bestia de las dunas\",\n",
+                u8"    \"jaJP\": \"砂丘の魔獣\",\n",
+                u8"    \"ptBR\": \"[fs]Fera das Dunas\",\n",
+                u8"    \"ruRU\": \"Дюнный зверь\",\n",
+                u8"    \"zhCN\": \"沙丘兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2981,\n",
+                u8"    \"Key\": \"FleshHunter\",\n",
+                u8"    \"enUS\": \"Flesh Hunter\",\n",
+                u8"    \"zhTW\": \"血肉獵人\",\n",
+                u8"    \"deDE\": \"Fleischjägerin\",\n",
+                u8"    \"esES\": \"Cazadora de la carne\",\n",
+                u8"    \"frFR\": \"Chasseur de chair\",\n",
+                u8"    \"itIT\": \"Cacciatrice di Carne\",\n",
+                u8"    \"koKR\": \"살점 사냥꾼\",\n",
+                u8"    \"plPL\": \"Łowczyni ciał\",\n",
+                u8"    \"esMX\": \"Cazadora carnal\",\n",
+                u8"    \"jaJP\": \"血肉の狩人\",\n",
+                u8"    \"ptBR\": \"Caçadora Cárnea\",\n",
+                u8"    \"ruRU\": \"Охотница за плотью\",\n",
+                u8"    \"zhCN\": \"血肉猎手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2982,\n",
+                u8"    \"Key\": \"BlackRogue\",\n",
+                u8"    \"enUS\": \"Black Rogue\",\n",
+                u8"    \"zhTW\": \"黑色俠盜\",\n",
+                u8"    \"deDE\": \"Schwarze Jägerin\",\n",
+                u8"    \"esES\": \"Arpía negra\",\n",
+                u8"    \"frFR\": \"Rogue noire\",\n",
+                u8"    \"itIT\": \"Scolta Nera\",\n",
+                u8"    \"koKR\": \"검은 도적\",\n",
+                u8"    \"plPL\": \"Czarna Łotrzyca\",\n",
+                u8"    \"esMX\": \"Renegada sombría\",\n",
+                u8"    \"jaJP\": \"暗黒のローグ\",\n",
+                u8"    \"ptBR\": \"[fs]Renegada Tenebrosa\",\n",
+                u8"    \"ruRU\": \"Черная разбойница\",\n",
+                u8"    \"zhCN\": \"黑化流亡者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2984,\n",
+                u8"    \"Key\": \"VileHunter\",\n",
+                u8"    \"enUS\": \"Vile Hunter\",\n",
+                u8"    \"zhTW\": \"兇邪獵手\",\n",
+                u8"    \"deDE\": \"Böse Jägerin\",\n",
+                u8"    \"esES\": \"Cazadora vil\",\n",
+                u8"    \"frFR\": \"Chasseuse infâme\",\n",
+                u8"    \"itIT\": \"Cacciatrice Vile\",\n",
+                u8"    \"koKR\": \"끔찍한 사냥꾼\",\n",
+                u8"    \"plPL\": \"Ohydna łowczyni\",\n",
+                u8"    \"esMX\": \"Cazadora vil\",\n",
+                u8"    \"jaJP\": \"穢れし狩人\",\n",
+                u8"    \"ptBR\": \"[fs]Caçadora Vil\",\n",
+                u8"    \"ruRU\": \"Злобная охотница\",\n",
+                u8"    \"zhCN\": \"邪恶猎手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2985,\n",
+                u8"    \"Key\": \"DarkHunter\",\n",
+                u8"    \"enUS\": \"Dark Hunter\",\n",
+                u8"    \"zhTW\": \"黑暗獵人\",\n",
+                u8"    \"deDE\": \"Dunkle Jägerin\",\n",
+                u8"    \"esES\": \"Cazadora de la oscuridad\",\n",
+                u8"    \"frFR\": \"Chasseuse sombre\",\n",
+                u8"    \"itIT\": \"Cacciatrice Oscura\",\n",
+                u8"    \"koKR\": \"어둠의 사냥꾼\",\n",
+                u8"    \"plPL\": \"Mroczna myśliwa\",\n",
+                u8"    \"esMX\": \"Cazadora oscura\",\n",
+                u8"    \"jaJP\": \"闇の狩人\",\n",
+                u8"    \"ptBR\": \"[fs]Caçadora Sombria\",\n",
+                u8"    \"ruRU\": \"Темная охотница\",\n",
+                u8"    \"zhCN\": \"黑暗猎手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2986,\n",
+                u8"    \"Key\": \"DarkShape\",\n",
+                u8"    \"enUS\": \"Dark Shape\",\n",
+                u8"    \"zhTW\": \"幽影\",\n",
+                u8"    \"deDE\": \"Dunkle Gestalt\",\n",
+                u8"    \"esES\": \"Forma oscura\",\n",
+                u8"    \"frFR\": \"Forme sombre\",\n",
+                u8"    \"itIT\": \"Forma Nera\",\n",
+                u8"    \"koKR\": \"어둠의 형상\",\n",
+                u8"    \"plPL\": \"Mroczny kształt\",\n",
+                u8"    \"esMX\": \"Forma sombría\",\n",
+                u8"    \"jaJP\": \"ダーク・シェイプ\",\n",
+                u8"    \"ptBR\": \"[fs]Forma Sombria\",\n",
+                u8"    \"ruRU\": \"Темная фигура\",\n",
+                u8"    \"zhCN\": \"黑暗阴魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2987,\n",
+                u8"    \"Key\": \"Apparition\",\n",
+                u8"    \"enUS\": \"Apparition\",\n",
+                u8"    \"zhTW\": \"幽影\",\n",
+                u8"    \"deDE\": \"Erscheinung\",\n",
+                u8"    \"esES\": \"Aparición\",\n",
+                u8"    \"frFR\": \"Apparition\",\n",
+                u8"    \"itIT\": \"Apparizione\",\n",
+                u8"    \"koKR\": \"환영\",\n",
+                u8"    \"plPL\": \"Wcielenie\",\n",
+                u8"    \"esMX\": \"Aparición\",\n",
+                u8"    \"jaJP\": \"アペリション\",\n",
+                u8"    \"ptBR\": \"[fs]Aparição\",\n",
+                u8"    \"ruRU\": \"Привидение\",\n",
+                u8"    \"zhCN\": \"恶魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2988,\n",
+                u8"    \"Key\": \"Specter\",\n",
+                u8"    \"enUS\": \"Specter\",\n",
+                u8"    \"zhTW\": \"亡靈\",\n",
+                u8"    \"deDE\": \"Gespenst\",\n",
+                u8"    \"esES\": \"Espectro\",\n",
+                u8"    \"frFR\": \"Spectre\",\n",
+                u8"    \"itIT\": \"Spettro\",\n",
+                u8"    \"koKR\": \"허깨비\",\n",
+                u8"    \"plPL\": \"Upiór\",\n",
+                u8"    \"esMX\": \"Espectro\",\n",
+                u8"    \"jaJP\": \"スペクター\",\n",
+                u8"    \"ptBR\": \"[fs]Assombração\",\n",
+                u8"    \"ruRU\": \"Фантом\",\n",
+                u8"    \"zhCN\": \"妖魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2990,\n",
+                u8"    \"Key\": \"Ghost\",\n",
+                u8"    \"enUS\": \"Ghost\",\n",
+                u8"    \"zhTW\": \"鬼魂\",\n",
+                u8"    \"deDE\": \"Geist\",\n",
+                u8"    \"esES\": \"Fantasma\",\n",
+                u8"    \"frFR\": \"Fantôme\",\n",
+                u8"    \"itIT\": \"Fantasma\",\n",
+                u8"    \"koKR\": \"유령\",\n",
+                u8"    \"plPL\": \"Duch\",\n",
+                u8"    \"esMX\": \"Fantasma\",\n",
+                u8"    \"jaJP\": \"ゴースト\",\n",
+                u8"    \"ptBR\": \"[ms]Fantasma\",\n",
+                u8"    \"ruRU\": \"Призрак\",\n",
+                u8"    \"zhCN\": \"幽灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2991,\n",
+                u8"    \"Key\": \"Assailant\",\n",
+                u8"    \"enUS\": \"Assailant\",\n",
+                u8"    \"zhTW\": \"襲擊者\",\n",
+                u8"    \"deDE\": \"Angreifer\",\n",
+                u8"    \"esES\": \"Agresor\",\n",
+                u8"    \"frFR\": \"Assaillant\",\n",
+                u8"    \"itIT\": \"Assalitore\",\n",
+                u8"    \"koKR\": \"기습자\",\n",
+                u8"    \"plPL\": \"Ciemiężca\",\n",
+                u8"    \"esMX\": \"Asaltante\",\n",
+                u8"    \"jaJP\": \"アサイラント\",\n",
+                u8"    \"ptBR\": \"[ms]Agressor\",\n",
+                u8"    \"ruRU\": \"Налетчик\",\n",
+                u8"    \"zhCN\": \"行凶者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2992,\n",
+                u8"    \"Key\": \"Infidel\",\n",
+                u8"    \"enUS\": \"Infidel\",\n",
+                u8"    \"zhTW\": \"異信者\",\n",
+                u8"    \"deDE\": \"Ungläubiger\",\n",
+                u8"    \"esES\": \"Infiel\",\n",
+                u8"    \"frFR\": \"Infidèle\",\n",
+                u8"    \"itIT\": \"Infedele\",\n",
+                u8"    \"koKR\": \"불신자\",\n",
+                u8"    \"plPL\": \"Heretyk\",\n",
+                u8"    \"esMX\": \"Infiel\",\n",
+                u8"    \"jaJP\": \"インフィデル\",\n",
+                u8"    \"ptBR\": \"[ms]Infiel\",\n",
+                u8"    \"ruRU\": \"Неверный\",\n",
+                u8"    \"zhCN\": \"信邪者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2993,\n",
+                u8"    \"Key\": \"Invader\",\n",
+                u8"    \"enUS\": \"Invader\",\n",
+                u8"    \"zhTW\": \"入侵者\",\n",
+                u8"    \"deDE\": \"Eindringling\",\n",
+                u8"    \"esES\": \"Invasor\",\n",
+                u8"    \"frFR\": \"Envahisseur\",\n",
+                u8"    \"itIT\": \"Invasore\",\n",
+                u8"    \"koKR\": \"침략자\",\n",
+                u8"    \"plPL\": \"Najeźdźca\",\n",
+                u8"    \"esMX\": \"Invasor\",\n",
+                u8"    \"jaJP\": \"インベイダー\",\n",
+                u8"    \"ptBR\": \"[ms]Invasor\",\n",
+                u8"    \"ruRU\": \"Захватчик\",\n",
+                u8"    \"zhCN\": \"入侵者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2994,\n",
+                u8"    \"Key\": \"Marauder\",\n",
+                u8"    \"enUS\": \"Marauder\",\n",
+                u8"    \"zhTW\": \"掠奪者\",\n",
+                u8"    \"deDE\": \"Plünderer\",\n",
+                u8"    \"esES\": \"Maleante\",\n",
+                u8"    \"frFR\": \"Maraudeur\",\n",
+                u8"    \"itIT\": \"Predone\",\n",
+                u8"    \"koKR\": \"습격자\",\n",
+                u8"    \"plPL\": \"Maruder\",\n",
+                u8"    \"esMX\": \"Merodeador\",\n",
+                u8"    \"jaJP\": \"マローダー\",\n",
+                u8"    \"ptBR\": \"[ms]Saqueador\",\n",
+                u8"    \"ruRU\": \"Мародер\",\n",
+                u8"    \"zhCN\": \"掠夺者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2995,\n",
+                u8"    \"Key\": \"SandRaider\",\n",
+                u8"    \"enUS\": \"Sand Raider\",\n",
+                u8"    \"zhTW\": \"沙漠劫掠者\",\n",
+                u8"    \"deDE\": \"Sandräuber\",\n",
+                u8"    \"esES\": \"Asaltante de arena\",\n",
+                u8"    \"frFR\": \"Pilleur des sables\",\n",
+                u8"    \"itIT\": \"Bandito delle Sabbie\",\n",
+                u8"    \"koKR\": \"모래 침략자\",\n",
+                u8"    \"plPL\": \"Piaskowy najeźdźca\",\n",
+                u8"    \"esMX\": \"Invasor arenoso\",\n",
+                u8"    \"jaJP\": \"サンド・レイダー\",\n",
+                u8"    \"ptBR\": \"[ms]Invasor Arenoso\",\n",
+                u8"    \"ruRU\": \"Пустынный налетчик\",\n",
+                u8"    \"zhCN\": \"沙漠袭击者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2996,\n",
+                u8"    \"Key\": \"GargantuanBeast\",\n",
+                u8"    \"enUS\": \"Gargantuan Beast\",\n",
+                u8"    \"zhTW\": \"巨獸毛怪\",\n",
+                u8"    \"deDE\": \"Gargantua\",\n",
+                u8"    \"esES\": \"Bestia gigante\",\n",
+                u8"    \"frFR\": \"Monstre gargantuesque\",\n",
+                u8"    \"itIT\": \"Gargantua\",\n",
+                u8"    \"koKR\": \"거대 야수\",\n",
+                u8"    \"plPL\": \"Monstrualna bestia\",\n",
+                u8"    \"esMX\": \"Bestia jayán\",\n",
+                u8"    \"jaJP\": \"ガルガンチュア・ビースト\",\n",
+                u8"    \"ptBR\": \"[fs]Fera Gargântua\",\n",
+                u8"    \"ruRU\": \"Исполинский зверь\",\n",
+                u8"    \"zhCN\": \"巨身兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2997,\n",
+                u8"    \"Key\": \"WailingBeast\",\n",
+                u8"    \"enUS\": \"Wailing Beast\",\n",
+                u8"    \"zhTW\": \"尖嘯毛怪\",\n",
+                u8"    \"deDE\": \"Heulbestie\",\n",
+                u8"    \"esES\": \"Bestia ululante\",\n",
+                u8"    \"frFR\": \"Bête gémissante\",\n",
+                u8"    \"itIT\": \"Lamentatore\",\n",
+                u8"    \"koKR\": \"울부짖는 야수\",\n",
+                u8"    \"plPL\": \"Skowycząca bestia\",\n",
+                u8"    \"esMX\": \"Bestia sollozante\",\n",
+                u8"    \"jaJP\": \"ウェイリング・ビースト\",\n",
+                u8"    \"ptBR\": \"[fs]Fera Uivante\",\n",
+                u8"    \"ruRU\": \"Воющий зверь\",\n",
+                u8"    \"zhCN\": \"恸哭兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2998,\n",
+                u8"    \"Key\": \"Yeti\",\n",
+                u8"    \"enUS\": \"Yeti\",\n",
+                u8"    \"zhTW\": \"雪怪\",\n",
+                u8"    \"deDE\": \"Yeti\",\n",
+                u8"    \"esES\": \"Yeti\",\n",
+                u8"    \"frFR\": \"Yéti\",\n",
+                u8"    \"itIT\": \"Yeti\",\n",
+                u8"    \"koKR\": \"설인\",\n",
+                u8"    \"plPL\": \"Yeti\",\n",
+                u8"    \"esMX\": \"Yeti\",\n",
+                u8"    \"jaJP\": \"イエティ\",\n",
+                u8"    \"ptBR\": \"[ms]Yeti\",\n",
+                u8"    \"ruRU\": \"Йети\",\n",
+                u8"    \"zhCN\": \"雪人怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 2999,\n",
+                u8"    \"Key\": \"Crusher\",\n",
+                u8"    \"enUS\": \"Crusher\",\n",
+                u8"    \"zhTW\": \"碎拳毛怪\",\n",
+                u8"    \"deDE\": \"Zermalmer\",\n",
+                u8"    \"esES\": \"Machacadora\",\n",
+                u8"    \"frFR\": \"Broyeur\",\n",
+                u8"    \"itIT\": \"Demolitore\",\n",
+                u8"    \"koKR\": \"분쇄자\",\n",
+                u8"    \"plPL\": \"Miażdżyciel\",\n",
+                u8"    \"esMX\": \"Triturador\",\n",
+                u8"    \"jaJP\": \"クラッシャー\",\n",
+                u8"    \"ptBR\": \"[ms]Esmagador\",\n",
+                u8"    \"ruRU\": \"Крушитель\",\n",
+                u8"    \"zhCN\": \"暴砸兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3000,\n",
+                u8"    \"Key\": \"Brute\",\n",
+                u8"    \"enUS\": \"Brute\",\n",
+                u8"    \"zhTW\": \"兇蠻毛怪\",\n",
+                u8"    \"deDE\": \"Untier\",\n",
+                u8"    \"esES\": \"Bruto\",\n",
+                u8"    \"frFR\": \"Brute\",\n",
+                u8"    \"itIT\": \"Bruto\",\n",
+                u8"    \"koKR\": \"거수\",\n",
+                u8"    \"plPL\": \"Monstrum\",\n",
+                u8"    \"esMX\": \"Bruto\",\n",
+                u8"    \"jaJP\": \"ブルート\",\n",
+                u8"    \"ptBR\": \"[ms]Bruto\",\n",
+                u8"    \"ruRU\": \"Изверг\",\n",
+                u8"    \"zhCN\": \"蛮力兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3001,\n",
+                u8"    \"Key\": \"CloudStalker\",\n",
+                u8"    \"enUS\": \"Cloud Stalker\",\n",
+                u8"    \"zhTW\": \"雲襲血鷹\",\n",
+                u8"    \"deDE\": \"Wolkenschleicher\",\n",
+                u8"    \"esES\": \"Acechador de las nubes\",\n",
+                u8"    \"frFR\": \"Vagabond des nuages\",\n",
+                u8"    \"itIT\": \"Predatore delle Nuvole\",\n",
+                u8"    \"koKR\": \"구름 추적자\",\n",
+                u8"    \"plPL\": \"Chmuroskrzydły\",\n",
+                u8"    \"esMX\": \"Acechador nebuloso\",\n",
+                u8"    \"jaJP\": \"クラウド・ストーカー\",\n",
+                u8"    \"ptBR\": \"[ms]Perseguidor Nebuloso\",\n",
+                u8"    \"ruRU\": \"Облачный охотник\",\n",
+                u8"    \"zhCN\": \"烟雾偷袭者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3002,\n",
+                u8"    \"Key\": \"BlackVulture\",\n",
+                u8"    \"enUS\": \"Black Vulture\",\n",
+                u8"    \"zhTW\": \"黑色禿鷹\",\n",
+                u8"    \"deDE\": \"Schwarzer Geier\",\n",
+                u8"    \"esES\": \"Buitre negro\",\n",
+                u8"    \"frFR\": \"Vautour noir\",\n",
+                u8"    \"itIT\": \"Avvoltoio Nero\",\n",
+                u8"    \"koKR\": \"검은 독수리\",\n",
+                u8"    \"plPL\": \"Czarny sęp\",\n",
+                u8"    \"esMX\": \"Buitre sombrío\",\n",
+                u8"    \"jaJP\": \"ブラック・ヴァルチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Abutre Tenebroso\",\n",
+                u8"    \"ruRU\": \"Черный стервятник\",\n",
+                u8"    \"zhCN\": \"黑羽秃鹫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3003,\n",
+                u8"    \"Key\": \"BlackRaptor\",\n",
+                u8"    \"enUS\": \"Black Raptor\",\n",
+                u8"    \"zhTW\": \"黑色猛禽\",\n",
+                u8"    \"deDE\": \"Schwarzer Greifer\",\n",
+                u8"    \"esES\": \"Ave de presa negra\",\n",
+                u8"    \"frFR\": \"Rapace noir\",\n",
+                u8"    \"itIT\": \"Rapace Nero\",\n",
+                u8"    \"koKR\": \"검은 맹금\",\n",
+                u8"    \"plPL\": \"Czarny krogulec\",\n",
+                u8"    \"esMX\": \"Rapaz sombría\",\n",
+                u8"    \"jaJP\": \"ブラック・ラプター\",\n",
+                u8"    \"ptBR\": \"[ms]Raptor Tenebroso\",\n",
+                u8"    \"ruRU\": \"Черный ящер\",\n",
+                u8"    \"zhCN\": \"黑羽猛禽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3004,\n",
+                u8"    \"Key\": \"BloodHawk\",\n",
+                u8"    \"enUS\": \"Blood Hawk\",\n",
+                u8"    \"zhTW\": \"血鷹\",\n",
+                u8"    \"deDE\": \"Blutfalke\",\n",
+                u8"    \"esES\": \"Gerifalte sangriento\",\n",
+                u8"    \"frFR\": \"Faucon de sang\",\n",
+                u8"    \"itIT\": \"Falco Vermiglio\",\n",
+                u8"    \"koKR\": \"핏빛매\",\n",
+                u8"    \"plPL\": \"Krwawy jastrząb\",\n",
+                u8"    \"esMX\": \"Halcón sanguinario\",\n",
+                u8"    \"jaJP\": \"ブラッド・ホーク\",\n",
+                u8"    \"ptBR\": \"[ms]Falcão Sangrento\",\n",
+                u8"    \"ruRU\": \"Кровавый ястреб\",\n",
+                u8"    \"zhCN\": \"血鹰\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3005,\n",
+                u8"    \"Key\": \"FoulCrow\",\n",
+                u8"    \"enUS\": \"Foul Crow\",\n",
+                u8"    \"zhTW\": \"惡毒穢鴉\",\n",
+                u8"    \"deDE\": \"Faulkrähe\",\n",
+                u8"    \"esES\": \"Cuervo fétido\",\n",
+                u8"    \"frFR\": \"Corbeau fétide\",\n",
+                u8"    \"itIT\": \"Corvo Fetido\",\n",
+                u8"    \"koKR\": \"불결한 까마귀\",\n",
+                u8"    \"plPL\": \"Plugawy kruk\",\n",
+                u8"    \"esMX\": \"Cuervo repugnante\",\n",
+                u8"    \"jaJP\": \"ファウル・クロウ\",\n",
+                u8"    \"ptBR\": \"[ms]Corvo Sórdido\",\n",
+                u8"    \"ruRU\": \"Нечистая птица\",\n",
+                u8"    \"zhCN\": \"恶臭乌鸦\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3006,\n",
+                u8"    \"Key\": \"PlagueBearer\",\n",
+                u8"    \"enUS\": \"Plague Bearer\",\n",
+                u8"    \"zhTW\": \"瘟疫散布者\",\n",
+                u8"    \"deDE\": \"Pestbringer\",\n",
+                u8"    \"esES\": \"Apestado\",\n",
+                u8"    \"frFR\": \"Pestiféré\",\n",
+                u8"    \"itIT\": \"Contaminatore\",\n",
+                u8"    \"koKR\": \"역병 유발자\",\n",
+                u8"    \"plPL\": \"Siewca zarazy\",\n",
+                u8"    \"esMX\": \"Llevador de plaga\",\n",
+                u8"    \"jaJP\": \"プレイグ・ベアラー\",\n",
+                u8"    \"ptBR\": \"[ms]Empesteador\",\n",
+                u8"    \"ruRU\": \"Разносчик чумы\",\n",
+                u8"    \"zhCN\": \"疫尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3007,\n",
+                u8"    \"Key\": \"Ghoul\",\n",
+                u8"    \"enUS\": \"Ghoul\",\n",
+                u8"    \"zhTW\": \"食屍鬼\",\n",
+                u8"    \"deDE\": \"Ghul\",\n",
+                u8"    \"esES\": \"Necrófago\",\n",
+                u8"    \"frFR\": \"Goule\",\n",
+                u8"    \"itIT\": \"Ghoul\",\n",
+                u8"    \"koKR\": \"구울\",\n",
+                u8"    \"plPL\": \"Ghul\",\n",
+                u8"    \"esMX\": \"Necrófago\",\n",
+                u8"    \"jaJP\": \"グール\",\n",
+                u8"    \"ptBR\": \"[ms]Carniçal\",\n",
+                u8"    \"ruRU\": \"Вурдалак\",\n",
+                u8"    \"zhCN\": \"食尸鬼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3008,\n",
+                u8"    \"Key\": \"DrownedCarcass\",\n",
+                u8"    \"enUS\": \"Drowned Carcass\",\n",
+                u8"    \"zhTW\": \"溺斃死屍\",\n",
+                u8"    \"deDE\": \"Ertrunkener Kadaver\",\n",
+                u8"    \"esES\": \"Occiso ahogado\",\n",
+                u8"    \"frFR\": \"Cadavre noyé\",\n",
+                u8"    \"itIT\": \"Carcassa di Affogato\",\n",
+                u8"    \"koKR\": \"물에 빠진 송장\",\n",
+                u8"    \"plPL\": \"Topielec\",\n",
+                u8"    \"esMX\": \"Cadáver ahogado\",\n",
+                u8"    \"jaJP\": \"ドラウンド・カーカス\",\n",
+                u8"    \"ptBR\": \"[fs]Carcaça Encharcada\",\n",
+                u8"    \"ruRU\": \"Утопленный труп\",\n",
+                u8"    \"zhCN\": \"溺尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3009,\n",
+                u8"    \"Key\": \"HungryDead\",\n",
+                u8"    \"enUS\": \"Hungry Dead\",\n",
+                u8"    \"zhTW\": \"飢餓死者\",\n",
+                u8"    \"deDE\": \"Hungriger Toter\",\n",
+                u8"    \"esES\": \"Muerto hambriento\",\n",
+                u8"    \"frFR\": \"Mort affamé\",\n",
+                u8"    \"itIT\": \"Cadavere Affamato\",\n",
+                u8"    \"koKR\": \"굶주린 망자\",\n",
+                u8"    \"plPL\": \"Głodny trup\",\n",
+                u8"    \"esMX\": \"Muerto hambriento\",\n",
+                u8"    \"jaJP\": \"ハングリー・デッド\",\n",
+                u8"    \"ptBR\": \"[ms]Morto Faminto\",\n",
+                u8"    \"ruRU\": \"Голодный мертвец\",\n",
+                u8"    \"zhCN\": \"饥饿行尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3010,\n",
+                u8"    \"Key\": \"Zombie\",\n",
+                u8"    \"enUS\": \"Zombie\",\n",
+                u8"    \"zhTW\": \"殭屍\",\n",
+                u8"    \"deDE\": \"Zombie\",\n",
+                u8"    \"esES\": \"Zombi\",\n",
+                u8"    \"frFR\": \"Zombie\",\n",
+                u8"    \"itIT\": \"Zombi\",\n",
+                u8"    \"koKR\": \"좀비\",\n",
+                u8"    \"plPL\": \"Zombie\",\n",
+                u8"    \"esMX\": \"Zombi\",\n",
+                u8"    \"jaJP\": \"ゾンビ\",\n",
+                u8"    \"ptBR\": \"[ms]Zumbi\",\n",
+                u8"    \"ruRU\": \"Зомби\",\n",
+                u8"    \"zhCN\": \"僵尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3011,\n",
+                u8"    \"Key\": \"Skeleton\",\n",
+                u8"    \"enUS\": \"Skeleton\",\n",
+                u8"    \"zhTW\": \"骷髏\",\n",
+                u8"    \"deDE\": \"Skelettkrieger\",\n",
+                u8"    \"esES\": \"Esqueleto\",\n",
+                u8"    \"frFR\": \"Squelette\",\n",
+                u8"    \"itIT\": \"Scheletro\",\n",
+                u8"    \"koKR\": \"해골\",\n",
+                u8"    \"plPL\": \"Szkielet\",\n",
+                u8"    \"esMX\": \"Esqueleto\",\n",
+                u8"    \"jaJP\": \"骸骨\",\n",
+                u8"    \"ptBR\": \"[ms]Esqueleto\",\n",
+                u8"    \"ruRU\": \"Скелет\",\n",
+                u8"    \"zhCN\": \"骷髅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3012,\n",
+                u8"    \"Key\": \"Horror\",\n",
+                u8"    \"enUS\": \"Horror\",\n",
+                u8"    \"zhTW\": \"恐骨骷髏\",\n",
+                u8"    \"deDE\": \"Horror\",\n",
+                u8"    \"esES\": \"Horror\",\n",
+                u8"    \"frFR\": \"Horreur\",\n",
+                u8"    \"itIT\": \"Orrore\",\n",
+                u8"    \"koKR\": \"피바람\",\n",
+                u8"    \"plPL\": \"Kościej\",\n",
+                u8"    \"esMX\": \"Tenebroso\",\n",
+                u8"    \"jaJP\": \"ホラー\",\n",
+                u8"    \"ptBR\": \"[ms]Horror\",\n",
+                u8"    \"ruRU\": \"Ужас\",\n",
+                u8"    \"zhCN\": \"恐怖骸骨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3013,\n",
+                u8"    \"Key\": \"Returned\",\n",
+                u8"    \"enUS\": \"Returned\",\n",
+                u8"    \"zhTW\": \"返世亡靈\",\n",
+                u8"    \"deDE\": \"Zurückgekehrter\",\n",
+                u8"    \"esES\": \"Retornado\",\n",
+                u8"    \"frFR\": \"Ranimé\",\n",
+                u8"    \"itIT\": \"Ritornato\",\n",
+                u8"    \"koKR\": \"되돌아온 자\",\n",
+                u8"    \"plPL\": \"Przywrócony\",\n",
+                u8"    \"esMX\": \"Retornado\",\n",
+                u8"    \"jaJP\": \"リターンド\",\n",
+                u8"    \"ptBR\": \"[ms]Retornado\",\n",
+                u8"    \"ruRU\": \"Воскресший\",\n",
+                u8"    \"zhCN\": \"回魂骷髅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3014,\n",
+                u8"    \"Key\": \"BurningDead\",\n",
+                u8"    \"enUS\": \"Burning Dead\",\n",
+                u8"    \"zhTW\": \"烈焰骷髏\",\n",
+                u8"    \"deDE\": \"Brennender Toter\",\n",
+                u8"    \"esES\": \"Muerto ardiente\",\n",
+                u8"    \"frFR\": \"Brûlé vif\",\n",
+                u8"    \"itIT\": \"Scheletro Fiammeggiante\",\n",
+                u8"    \"koKR\": \"불타는 망자\",\n",
+                u8"    \"plPL\": \"Płonący trup\",\n",
+                u8"    \"esMX\": \"Muerto ardiente\",\n",
+                u8"    \"jaJP\": \"バーニングデッド\",\n",
+                u8"    \"ptBR\": \"[ms]Morto Flamejante\",\n",
+                u8"    \"ruRU\": \"Горящий мертвец\",\n",
+                u8"    \"zhCN\": \"烈焰亡骨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3015,\n",
+                u8"    \"Key\": \"BoneWarrior\",\n",
+                u8"    \"enUS\": \"Bone Warrior\",\n",
+                u8"    \"zhTW\": \"骸骨戰士\",\n",
+                u8"    \"deDE\": \"Knochenkrieger\",\n",
+                u8"    \"esES\": \"Guerrero óseo\",\n",
+                u8"    \"frFR\": \"Guerrier d’os\",\n",
+                u8"    \"itIT\": \"Guerriero d'Ossa\",\n",
+                u8"    \"koKR\": \"뼈 전사\",\n",
+                u8"    \"plPL\": \"Kościany wojownik\",\n",
+                u8"    \"esMX\": \"Guerrero óseo\",\n",
+                u8"    \"jaJP\": \"ボーン・ウォリアー\",\n",
+                u8"    \"ptBR\": \"[ms]Guerreiro Esquelético\",\n",
+                u8"    \"ruRU\": \"Костяной воин\",\n",
+                u8"    \"zhCN\": \"白骨战士\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3016,\n",
+                u8"    \"Key\": \"Damned\",\n",
+                u8"    \"enUS\": \"Damned\",\n",
+                u8"    \"zhTW\": \"詛咒魔汙怪\",\n",
+                u8"    \"deDE\": \"Verdammter\",\n",
+                u8"    \"esES\": \"Condenado\",\n",
+                u8"    \"frFR\": \"Damné\",\n",
+                u8"    \"itIT\": \"Dannato\",\n",
+                u8"    \"koKR\": \"저주받은 자\",\n",
+                u8"    \"plPL\": \"Potępiony\",\n",
+                u8"    \"esMX\": \"Maldito\",\n",
+                u8"    \"jaJP\": \"ダムド\",\n",
+                u8"    \"ptBR\": \"[ms]Maldito\",\n",
+                u8"    \"ruRU\": \"Проклятый\",\n",
+                u8"    \"zhCN\": \"天谴魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3017,\n",
+                u8"    \"Key\": \"Disfigured\",\n",
+                u8"    \"enUS\": \"Disfigured\",\n",
+                u8"    \"zhTW\": \"醜惡魔汙怪\",\n",
+                u8"    \"deDE\": \"Entstellter\",\n",
+                u8"    \"esES\": \"Desfigurado\",\n",
+                u8"    \"frFR\": \"Défiguré\",\n",
+                u8"    \"itIT\": \"Sfigurato\",\n",
+                u8"    \"koKR\": \"일그러진 자\",\n",
+                u8"    \"plPL\": \"Szpetny\",\n",
+                u8"    \"esMX\": \"Desfigurado\",\n",
+                u8"    \"jaJP\": \"ディス・フィギュアード\",\n",
+                u8"    \"ptBR\": \"[ms]Desfigurado\",\n",
+                u8"    \"ruRU\": \"Изувеченный\",\n",
+                u8"    \"zhCN\": \"残身魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3018,\n",
+                u8"    \"Key\": \"Misshapen\",\n",
+                u8"    \"enUS\": \"Misshapen\",\n",
+                u8"    \"zhTW\": \"畸形魔汙怪\",\n",
+                u8"    \"deDE\": \"Missgestalteter\",\n",
+                u8"    \"esES\": \"Deforme\",\n",
+                u8"    \"frFR\": \"Déformé\",\n",
+                u8"    \"itIT\": \"Immondo\",\n",
+                u8"    \"koKR\": \"흉측한 자\",\n",
+                u8"    \"plPL\": \"Zniekształcony\",\n",
+                u8"    \"esMX\": \"Deforme\",\n",
+                u8"    \"jaJP\": \"ミスシェイプン\",\n",
+                u8"    \"ptBR\": \"[ms]Disforme\",\n",
+                u8"    \"ruRU\": \"Уродливый\",\n",
+                u8"    \"zhCN\": \"畸形魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3019,\n",
+                u8"    \"Key\": \"Tainted\",\n",
+                u8"    \"enUS\": \"Tainted\",\n",
+                u8"    \"zhTW\": \"魔汙怪\",\n",
+                u8"    \"deDE\": \"Besudelter\",\n",
+                u8"    \"esES\": \"Mancillado\",\n",
+                u8"    \"frFR\": \"Corrompu\",\n",
+                u8"    \"itIT\": \"Contaminato\",\n",
+                u8"    \"koKR\": \"오염된 자\",\n",
+                u8"    \"plPL\": \"Splamiony\",\n",
+                u8"    \"esMX\": \"Impío\",\n",
+                u8"    \"jaJP\": \"テインテッド\",\n",
+                u8"    \"ptBR\": \"[ms]Maculado\",\n",
+                u8"    \"ruRU\": \"Помутненный\",\n",
+                u8"    \"zhCN\": \"污染魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3020,\n",
+                u8"    \"Key\": \"Afflicted\",\n",
+                u8"    \"enUS\": \"Afflicted\",\n",
+                u8"    \"zhTW\": \"災劫魔汙怪\",\n",
+                u8"    \"deDE\": \"Infizierter\",\n",
+                u8"    \"esES\": \"Afligido\",\n",
+                u8"    \"frFR\": \"Malade\",\n",
+                u8"    \"itIT\": \"Afflitto\",\n",
+                u8"    \"koKR\": \"고통받는 자\",\n",
+                u8"    \"plPL\": \"Naznaczony\",\n",
+                u8"    \"esMX\": \"Afligido\",\n",
+                u8"    \"jaJP\": \"アフリクテッド\",\n",
+                u8"    \"ptBR\": \"[ms]Torpe\",\n",
+                u8"    \"ruRU\": \"Пораженный\",\n",
+                u8"    \"zhCN\": \"受难魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3021,\n",
+                u8"    \"Key\": \"Andariel\",\n",
+                u8"    \"enUS\": \"Andariel\",\n",
+                u8"    \"zhTW\": \"安達莉爾\",\n",
+                u8"    \"deDE\": \"Andariel\",\n",
+                u8"    \"esES\": \"Andariel\",\n",
+                u8"    \"frFR\": \"Andarielle\",\n",
+                u8"    \"itIT\": \"Andariel\",\n",
+                u8"    \"koKR\": \"안다리엘\",\n",
+                u8"    \"plPL\": \"Andariel\",\n",
+                u8"    \"esMX\": \"Andariel\",\n",
+                u8"    \"jaJP\": \"アンダリエル\",\n",
+                u8"    \"ptBR\": \"Andariel\",\n",
+                u8"    \"ruRU\": \"Андариэль\",\n",
+                u8"    \"zhCN\": \"安达莉尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3033,\n",
+                u8"    \"Key\": \"Camel\",\n",
+                u8"    \"enUS\": \"Camel\",\n",
+                u8"    \"zhTW\": \"駱駝\",\n",
+                u8"    \"deDE\": \"Kamel\",\n",
+                u8"    \"esES\": \"Camello\",\n",
+                u8"    \"frFR\": \"Dromadaire\",\n",
+                u8"    \"itIT\": \"Cammello\",\n",
+                u8"    \"koKR\": \"낙타\",\n",
+                u8"    \"plPL\": \"Wielbłąd\",\n",
+                u8"    \"esMX\": \"Camello\",\n",
+                u8"    \"jaJP\": \"ラクダ\",\n",
+                u8"    \"ptBR\": \"[ms]Camelo\",\n",
+                u8"    \"ruRU\": \"Верблюд\",\n",
+                u8"    \"zhCN\": \"骆驼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3034,\n",
+                u8"    \"Key\": \"Cadaver\",\n",
+                u8"    \"enUS\": \"Cadaver\",\n",
+                u8"    \"zhTW\": \"活屍木乃伊\",\n",
+                u8"    \"deDE\": \"Kadaver\",\n",
+                u8"    \"esES\": \"Cadáver\",\n",
+                u8"    \"frFR\": \"Cadavre\",\n",
+                u8"    \"itIT\": \"Mummificato\",\n",
+                u8"    \"koKR\": \"송장\",\n",
+                u8"    \"plPL\": \"Kadawer\",\n",
+                u8"    \"esMX\": \"Cadáver\",\n",
+                u8"    \"jaJP\": \"腑分けされしミイラ\",\n",
+                u8"    \"ptBR\": \"[ms]Cadáver\",\n",
+                u8"    \"ruRU\": \"Кадавр\",\n",
+                u8"    \"zhCN\": \"解剖尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3035,\n",
+                u8"    \"Key\": \"PreservedDead\",\n",
+                u8"    \"enUS\": \"Preserved Dead\",\n",
+                u8"    \"zhTW\": \"長存木乃伊\",\n",
+                u8"    \"deDE\": \"Erhaltener Toter\",\n",
+                u8"    \"esES\": \"Muerto preservado\",\n",
+                u8"    \"frFR\": \"Mort préservé\",\n",
+                u8"    \"itIT\": \"Preservato\",\n",
+                u8"    \"koKR\": \"보존된 망자\",\n",
+                u8"    \"plPL\": \"Zakonserwowany trup\",\n",
+                u8"    \"esMX\": \"Muerto preservado\",\n",
+                u8"    \"jaJP\": \"保存されしミイラ\",\n",
+                u8"    \"ptBR\": \"[ms]Morto Preservado\",\n",
+                u8"    \"ruRU\": \"Сохранившийся мертвец\",\n",
+                u8"    \"zhCN\": \"蜡化尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3036,\n",
+                u8"    \"Key\": \"Embalmed\",\n",
+                u8"    \"enUS\": \"Embalmed\",\n",
+                u8"    \"zhTW\": \"防腐木乃伊\",\n",
+                u8"    \"deDE\": \"Einbalsamierter\",\n",
+                u8"    \"esES\": \"Embalsamado\",\n",
+                u8"    \"frFR\": \"Embaumé\",\n",
+                u8"    \"itIT\": \"Imbalsamato\",\n",
+                u8"    \"koKR\": \"미라\",\n",
+                u8"    \"plPL\": \"Zabalsamowany\",\n",
+                u8"    \"esMX\": \"Embalsamado\",\n",
+                u8"    \"jaJP\": \"埋葬されしミイラ\",\n",
+                u8"    \"ptBR\": \"[ms]Embalsamado\",\n",
+                u8"    \"ruRU\": \"Нетленный\",\n",
+                u8"    \"zhCN\": \"防腐尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3037,\n",
+                u8"    \"Key\": \"DriedCorpse\",\n",
+                u8"    \"enUS\": \"Dried Corpse\",\n",
+                u8"    \"zhTW\": \"乾屍木乃伊\",\n",
+                u8"    \"deDE\": \"Vertrocknete Leiche\",\n",
+                u8"    \"esES\": \"Cadáver seco\",\n",
+                u8"    \"frFR\": \"Corps desséché\",\n",
+                u8"    \"itIT\": \"Essiccato\",\n",
+                u8"    \"koKR\": \"메마른 시체\",\n",
+                u8"    \"plPL\": \"Wysuszone zwłoki\",\n",
+                u8"    \"esMX\": \"Cadáver disecado\",\n",
+                u8"    \"jaJP\": \"乾いたミイラ\",\n",
+                u8"    \"ptBR\": \"[ms]Cadáver Ressequido\",\n",
+                u8"    \"ruRU\": \"Иссушенный труп\",\n",
+                u8"    \"zhCN\": \"干尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3038,\n",
+                u8"    \"Key\": \"Decayed\",\n",
+                u8"    \"enUS\": \"Decayed\",\n",
+                u8"    \"zhTW\": \"腐屍木乃伊\",\n",
+                u8"    \"deDE\": \"Verfallener\",\n",
+                u8"    \"esES\": \"Podrido\",\n",
+                u8"    \"frFR\": \"Décomposé\",\n",
+                u8"    \"itIT\": \"Decomposto\",\n",
+                u8"    \"koKR\": \"부패한 자\",\n",
+                u8"    \"plPL\": \"Nadgnity\",\n",
+                u8"    \"esMX\": \"Putrefacto\",\n",
+                u8"    \"jaJP\": \"腐りしミイラ\",\n",
+                u8"    \"ptBR\": \"[ms]Decomposto\",\n",
+                u8"    \"ruRU\": \"Гниющий\",\n",
+                u8"    \"zhCN\": \"腐尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3039,\n",
+                u8"    \"Key\": \"Urdar\",\n",
+                u8"    \"enUS\": \"Urdar\",\n",
+                u8"    \"zhTW\": \"烏爾達巨怪\",\n",
+                u8"    \"deDE\": \"Urdar\",\n",
+                u8"    \"esES\": \"Urdar\",\n",
+                u8"    \"frFR\": \"Urdar\",\n",
+                u8"    \"itIT\": \"Urdar\",\n",
+                u8"    \"koKR\": \"우르다르\",\n",
+                u8"    \"plPL\": \"Urdar\",\n",
+                u8"    \"esMX\": \"Urdar\",\n",
+                u8"    \"jaJP\": \"ウルダー\",\n",
+                u8"    \"ptBR\": \"[ms]Urdar\",\n",
+                u8"    \"ruRU\": \"Урдар\",\n",
+                u8"    \"zhCN\": \"乌达兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3041,\n",
+                u8"    \"Key\": \"Gorbelly\",\n",
+                u8"    \"enUS\": \"Gorebelly\",\n",
+                u8"    \"zhTW\": \"血腹巨怪\",\n",
+                u8"    \"deDE\": \"Blutbauch\",\n",
+                u8"    \"esES\": \"Ogrotesco\",\n",
+                u8"    \"frFR\": \"Éventreur\",\n",
+                u8"    \"itIT\": \"Ventrerosso\",\n",
+                u8"    \"koKR\": \"피불뚝이\",\n",
+                u8"    \"plPL\": \"Rzezibrzuch\",\n",
+                u8"    \"esMX\": \"Truculento\",\n",
+                u8"    \"jaJP\": \"ゴアベリー\",\n",
+                u8"    \"ptBR\": \"[ms]Sanguepança\",\n",
+                u8"    \"ruRU\": \"Кровобрюх\",\n",
+                u8"    \"zhCN\": \"血腹魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3042,\n",
+                u8"    \"Key\": \"Blunderbore\",\n",
+                u8"    \"enUS\": \"Blunderbore\",\n",
+                u8"    \"zhTW\": \"蠻力巨怪\",\n",
+                u8"    \"deDE\": \"Tölpelträger\",\n",
+                u8"    \"esES\": \"Mamotreto\",\n",
+                u8"    \"frFR\": \"Gueulard\",\n",
+                u8"    \"itIT\": \"Picchiacarne\",\n",
+                u8"    \"koKR\": \"뿔방망이\",\n",
+                u8"    \"plPL\": \"Tępogłów\",\n",
+                u8"    \"esMX\": \"Muelehuesos\",\n",
+                u8"    \"jaJP\": \"ブランダーボア\",\n",
+                u8"    \"ptBR\": \"[ms]Tritura-ossos\",\n",
+                u8"    \"ruRU\": \"Лютобой\",\n",
+                u8"    \"zhCN\": \"愚笨魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3043,\n",
+                u8"    \"Key\": \"WorldKillerYoung\",\n",
+                u8"    \"enUS\": \"Blood Maggot Young\",\n",
+                u8"    \"zhTW\": \"鮮血蛆蟲幼體\",\n",
+                u8"    \"deDE\": \"Blutwurmnachwuchs\",\n",
+                u8"    \"esES\": \"Cría de gusano de sangre\",\n",
+                u8"    \"frFR\": \"Petit asticot de sang\",\n",
+                u8"    \"itIT\": \"Larva del Sangue Giovane\",\n",
+                u8"    \"koKR\": \"피 구더기 새끼\",\n",
+                u8"    \"plPL\": \"Młode krwiożerczej larwy\",\n",
+                u8"    \"esMX\": \"Cresa de sangre joven\",\n",
+                u8"    \"jaJP\": \"血濡れた地虫の幼生\",\n",
+                u8"    \"ptBR\": \"[ms]Filhote de Verme Sangrento\",\n",
+                u8"    \"ruRU\": \"Личинка кровавой мокрицы\",\n",
+                u8"    \"zhCN\": \"幼年血虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3044,\n",
+                u8"    \"Key\": \"GiantLampreyYoung\",\n",
+                u8"    \"enUS\": \"Giant Lamprey Young\",\n",
+                u8"    \"zhTW\": \"吸血巨蟲幼體\",\n",
+                u8"    \"deDE\": \"Riesenmuränennachwuchs\",\n",
+                u8"    \"esES\": \"Cría de lamprea gigante\",\n",
+                u8"    \"frFR\": \"Jeune lamproie géante\",\n",
+                u8"    \"itIT\": \"Lampreda Gigante Giovane\",\n",
+                u8"    \"koKR\": \"거대 빨판구더기 새끼\",\n",
+                u8"    \"plPL\": \"Młode skolopendromorfa\",\n",
+                u8"    \"esMX\": \"Lamprea gigante joven\",\n",
+                u8"    \"jaJP\": \"吸血地虫の幼生\",\n",
+                u8"    \"ptBR\": \"[ms]Filhote de Lampreia Gigante\",\n",
+                u8"    \"ruRU\": \"Молодая гигантская жужелица\",\n",
+                u8"    \"zhCN\": \"幼年八目虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3045,\n",
+                u8"    \"Key\": \"DevourerYoung\",\n",
+                u8"    \"enUS\": \"Devourer Young\",\n",
+                u8"    \"zhTW\": \"吞噬者幼體\",\n",
+                u8"    \"deDE\": \"Verschlingernachwuchs\",\n",
+                u8"    \"esES\": \"Cría de devorador\",\n",
+                u8"    \"frFR\": \"Jeune dévoreur\",\n",
+                u8"    \"itIT\": \"Divoratore Giovane\",\n",
+                u8"    \"koKR\": \"걸신구더기 새끼\",\n",
+                u8"    \"plPL\": \"Młode pożeracza\",\n",
+                u8"    \"esMX\": \"Devorador joven\",\n",
+                u8"    \"jaJP\": \"貪る地虫の幼生\",\n",
+                u8"    \"ptBR\": \"[ms]Filhote de Devorador\",\n",
+                u8"    \"ruRU\": \"Молодой пожиратель\",\n",
+                u8"    \"zhCN\": \"幼年吞食虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3046,\n",
+                u8"    \"Key\": \"RockWormYoung\",\n",
+                u8"    \"enUS\": \"Rock Worm Young\",\n",
+                u8"    \"zhTW\": \"鑽岩蛆蟲幼體\",\n",
+                u8"    \"deDE\": \"Felswurmnachwuchs\",\n",
+                u8"    \"esES\": \"Cría de gusano de roca\",\n",
+                u8"    \"frFR\": \"Jeune ver des roches\",\n",
+                u8"    \"itIT\": \"Verme di Roccia Giovane\",\n",
+                u8"    \"koKR\": \"바위 벌레 새끼\",\n",
+                u8"    \"plPL\": \"Młode skalnego robaka\",\n",
+                u8"    \"esMX\": \"Gusano de piedra joven\",\n",
+                u8"    \"jaJP\": \"岩棲みの地虫の幼生\",\n",
+                u8"    \"ptBR\": \"[ms]Filhote de Verme Rochoso\",\n",
+                u8"    \"ruRU\": \"Личинка каменного червя\",\n",
+                u8"    \"zhCN\": \"幼年岩虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3047,\n",
+                u8"    \"Key\": \"SandMaggotYoung\",\n",
+                u8"    \"enUS\": \"Sand Maggot Young\",\n",
+                u8"    \"zhTW\": \"沙漠蛆蟲幼體\",\n",
+                u8"    \"deDE\": \"Sandwurmnachwuchs\",\n",
+                u8"    \"esES\": \"Cría de gusano de arena\",\n",
+                u8"    \"frFR\": \"Petit asticot des sables\",\n",
+                u8"    \"itIT\": \"Larva della Sabbia Giovane\",\n",
+                u8"    \"koKR\": \"모래 구더기 새끼\",\n",
+                u8"    \"plPL\": \"Młode piasecznika\",\n",
+                u8"    \"esMX\": \"Cresa de arena joven\",\n",
+                u8"    \"jaJP\": \"砂漠の地虫の幼生\",\n",
+                u8"    \"ptBR\": \"[ms]Filhote de Verme Arenoso\",\n",
+                u8"    \"ruRU\": \"Личинка песчаной мокрицы\",\n",
+                u8"    \"zhCN\": \"幼年沙虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3048,\n",
+                u8"    \"Key\": \"WorldKillerEgg\",\n",
+                u8"    \"enUS\": \"Blood Maggot Egg\",\n",
+                u8"    \"zhTW\": \"鮮血蛆蟲之卵\",\n",
+                u8"    \"deDE\": \"Blutwurmei\",\n",
+                u8"    \"esES\": \"Larva de gusano de sangre\",\n",
+                u8"    \"frFR\": \"Œuf d’asticot de sang\",\n",
+                u8"    \"itIT\": \"Uovo di Larva del Sangue\",\n",
+                u8"    \"koKR\": \"피 구더기 알\",\n",
+                u8"    \"plPL\": \"Jajo krwiożerczej larwy\",\n",
+                u8"    \"esMX\": \"Huevo de Cresa de sangre\",\n",
+                u8"    \"jaJP\": \"血濡れた地虫の卵\",\n",
+                u8"    \"ptBR\": \"[ms]Ovo de Verme Sangrento\",\n",
+                u8"    \"ruRU\": \"Яйцо кровавой мокрицы\",\n",
+                u8"    \"zhCN\": \"血虫蛋\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3049,\n",
+                u8"    \"Key\": \"GiantLampreyEgg\",\n",
+                u8"    \"enUS\": \"Giant Lamprey Egg\",\n",
+                u8"    \"zhTW\": \"吸血巨蟲之卵\",\n",
+                u8"    \"deDE\": \"Riesenmuränenei\",\n",
+                u8"    \"esES\": \"Larva de lamprea gigante\",\n",
+                u8"    \"frFR\": \"Œuf de lamproie géante\",\n",
+                u8"    \"itIT\": \"Uovo di Lampreda Gigante\",\n",
+                u8"    \"koKR\": \"거대 빨판구더기 알\",\n",
+                u8"    \"plPL\": \"Jajo skolopendromorfa\",\n",
+                u8"    \"esMX\": \"Huevo de Lamprea gigante\",\n",
+                u8"    \"jaJP\": \"吸血地虫の卵\",\n",
+                u8"    \"ptBR\": \"[ms]Ovo de Lampreia Gigante\",\n",
+                u8"    \"ruRU\": \"Яйцо гигантской жужелицы\",\n",
+                u8"    \"zhCN\": \"巨型八目虫蛋\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3050,\n",
+                u8"    \"Key\": \"DevourerEgg\",\n",
+                u8"    \"enUS\": \"Devourer Egg\",\n",
+                u8"    \"zhTW\": \"吞噬者之卵\",\n",
+                u8"    \"deDE\": \"Verschlingerei\",\n",
+                u8"    \"esES\": \"Larva de devorador\",\n",
+                u8"    \"frFR\": \"Œuf de dévoreur\",\n",
+                u8"    \"itIT\": \"Uovo di Divoratore\",\n",
+                u8"    \"koKR\": \"걸신구더기 알\",\n",
+                u8"    \"plPL\": \"Jajo pożeracza\",\n",
+                u8"    \"esMX\": \"Huevo de Devorador\",\n",
+                u8"    \"jaJP\": \"貪る地虫の卵\",\n",
+                u8"    \"ptBR\": \"[ms]Ovo de Devorador\",\n",
+                u8"    \"ruRU\": \"Яйцо пожирателя\",\n",
+                u8"    \"zhCN\": \"吞食虫蛋\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3051,\n",
+                u8"    \"Key\": \"RockWormEgg\",\n",
+                u8"    \"enUS\": \"Rock Worm Egg\",\n",
+                u8"    \"zhTW\": \"鑽岩蛆蟲之卵\",\n",
+                u8"    \"deDE\": \"Felswurmei\",\n",
+                u8"    \"esES\": \"Larva de gusano de roca\",\n",
+                u8"    \"frFR\": \"Œuf de ver des roches\",\n",
+                u8"    \"itIT\": \"Uovo di Verme di Roccia\",\n",
+                u8"    \"koKR\": \"바위 벌레 알\",\n",
+                u8"    \"plPL\": \"Jajo skalnego robaka\",\n",
+                u8"    \"esMX\": \"Huevo de Gusano de piedra\",\n",
+                u8"    \"jaJP\": \"岩棲みの地虫の卵\",\n",
+                u8"    \"ptBR\": \"[ms]Ovo de Verme Rochoso\",\n",
+                u8"    \"ruRU\": \"Яйцо каменного червя\",\n",
+                u8"    \"zhCN\": \"岩虫蛋\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3052,\n",
+                u8"    \"Key\": \"SandMaggotEgg\",\n",
+                u8"    \"enUS\": \"Sand Maggot Egg\",\n",
+                u8"    \"zhTW\": \"沙漠蛆蟲之卵\",\n",
+                u8"    \"deDE\": \"Sandwurmei\",\n",
+                u8"    \"esES\": \"Larva de gusano de arena\",\n",
+                u8"    \"frFR\": \"Œuf d’asticot des sables\",\n",
+                u8"    \"itIT\": \"Uovo di Larva della Sabbia\",\n",
+                u8"    \"koKR\": \"모래 구더기 알\",\n",
+                u8"    \"plPL\": \"Jajo piasecznika\",\n",
+                u8"    \"esMX\": \"Huevo de Cresa de arena\",\n",
+                u8"    \"jaJP\": \"砂漠の地虫の卵\",\n",
+                u8"    \"ptBR\": \"[ms]Ovo de Verme Arenoso\",\n",
+                u8"    \"ruRU\": \"Яйцо песчаной мокрицы\",\n",
+                u8"    \"zhCN\": \"沙虫蛋\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3053,\n",
+                u8"    \"Key\": \"Maggot\",\n",
+                u8"    \"enUS\": \"Maggot\",\n",
+                u8"    \"zhTW\": \"蛆蟲\",\n",
+                u8"    \"deDE\": \"Wurm\",\n",
+                u8"    \"esES\": \"Gusano\",\n",
+                u8"    \"frFR\": \"Asticot\",\n",
+                u8"    \"itIT\": \"Larva\",\n",
+                u8"    \"koKR\": \"구더기\",\n",
+                u8"    \"plPL\": \"Robak\",\n",
+                u8"    \"esMX\": \"Cresa\",\n",
+                u8"    \"jaJP\": \"地虫\",\n",
+                u8"    \"ptBR\": \"[ms]Verme\",\n",
+                u8"    \"ruRU\": \"Мокрица\",\n",
+                u8"    \"zhCN\": \"蛆虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3054,\n",
+                u8"    \"Key\": \"Duriel\",\n",
+                u8"    \"enUS\": \"Duriel\",\n",
+                u8"    \"zhTW\": \"都瑞爾\",\n",
+                u8"    \"deDE\": \"Duriel\",\n",
+                u8"    \"esES\": \"Duriel\",\n",
+                u8"    \"frFR\": \"Duriel\",\n",
+                u8"    \"itIT\": \"Duriel\",\n",
+                u8"    \"koKR\": \"두리엘\",\n",
+                u8"    \"plPL\": \"Duriel\",\n",
+                u8"    \"esMX\": \"Duriel\",\n",
+                u8"    \"jaJP\": \"デュリエル\",\n",
+                u8"    \"ptBR\": \"Duriel\",\n",
+                u8"    \"ruRU\": \"Дюриэль\",\n",
+                u8"    \"zhCN\": \"督瑞尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3055,\n",
+                u8"    \"Key\": \"BloodHawkNest\",\n",
+                u8"    \"enUS\": \"Blood Hawk Nest\",\n",
+                u8"    \"zhTW\": \"血鷹之巢\",\n",
+                u8"    \"deDE\": \"Blutfalkennest\",\n",
+                u8"    \"esES\": \"Nido de gerifalte sangriento\",\n",
+                u8"    \"frFR\": \"Nid de faucons de sang\",\n",
+                u8"    \"itIT\": \"Nido di Falco Vermiglio\",\n",
+                u8"    \"koKR\": \"핏빛매 둥지\",\n",
+                u8"    \"plPL\": \"Gniazdo krwawych jastrzębi\",\n",
+                u8"    \"esMX\": \"Nido de Halcón sanguinario\",\n",
+                u8"    \"jaJP\": \"ブラッド・ホークの巣\",\n",
+                u8"    \"ptBR\": \"[ms]Ninho de Falcão Sangrento\",\n",
+                u8"    \"ruRU\": \"Гнездо кровавых ястребов\",\n",
+                u8"    \"zhCN\": \"血鹰巢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3056,\n",
+                u8"    \"Key\": \"FlyingScimitar\",\n",
+                u8"    \"enUS\": \"Flying Scimitar\",\n",
+                u8"    \"zhTW\": \"鬼靈彎刀\",\n",
+                u8"    \"deDE\": \"Fliegender Krummsäbel\",\n",
+                u8"    \"esES\": \"Cimitarra volante\",\n",
+                u8"    \"frFR\": \"Cimeterre volant\",\n",
+                u8"    \"itIT\": \"Scimitarra Volante\",\n",
+                u8"    \"koKR\": \"깨어난 시미터\",\n",
+                u8"    \"plPL\": \"Latający sejmitar\",\n",
+                u8"    \"esMX\": \"Cimitarra flotante\",\n",
+                u8"    \"jaJP\": \"フライング・シミター\",\n",
+                u8"    \"ptBR\": \"[fs]Cimitarra Voadora\",\n",
+                u8"    \"ruRU\": \"Парящий ятаган\",\n",
+                u8"    \"zhCN\": \"飞空弯刀\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3057,\n",
+                u8"    \"Key\": \"CloudStalkerNest\",\n",
+                u8"    \"enUS\": \"Cloud Stalker Nest\",\n",
+                u8"    \"zhTW\": \"雲襲血鷹之巢\",\n",
+                u8"    \"deDE\": \"Wolkenschleichernest\",\n",
+                u8"    \"esES\": \"Nido de acechador de las nubes\",\n",
+                u8"    \"frFR\": \"Nid de vagabonds des nuages\",\n",
+                u8"    \"itIT\": \"Nido di Predatore delle Nuvole\",\n",
+                u8"    \"koKR\": \"구름 추적자 둥지\",\n",
+                u8"    \"plPL\": \"Gniazdo chmuroskrzydłych\",\n",
+                u8"    \"esMX\": \"Nido de Acechador nebuloso\",\n",
+                u8"    \"jaJP\": \"クラウド・ストーカーの巣\",\n",
+                u8"    \"ptBR\": \"[ms]Ninho de Perseguidor Nebuloso\",\n",
+                u8"    \"ruRU\": \"Гнездо облачных охотников\",\n",
+                u8"    \"zhCN\": \"烟雾偷袭者巢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3058,\n",
+                u8"    \"Key\": \"BlackVultureNest\",\n",
+                u8"    \"enUS\": \"Black Raptor Nest\",\n",
+                u8"    \"zhTW\": \"黑色猛禽之巢\",\n",
+                u8"    \"deDE\": \"Schwarzgreifernest\",\n",
+                u8"    \"esES\": \"Nido de ave de presa negra\",\n",
+                u8"    \"frFR\": \"Nid de rapaces noirs\",\n",
+                u8"    \"itIT\": \"Nido di Rapace Nero\",\n",
+                u8"    \"koKR\": \"검은 맹금 둥지\",\n",
+                u8"    \"plPL\": \"Gniazdo czarnych krogulców\",\n",
+                u8"    \"esMX\": \"Nido de Rapaz sombría\",\n",
+                u8"    \"jaJP\": \"ブラック・ラプターの巣\",\n",
+                u8"    \"ptBR\": \"[ms]Ninho de Raptor Tenebroso\",\n",
+                u8"    \"ruRU\": \"Гнездо черного ящера\",\n",
+                u8"    \"zhCN\": \"黑羽猛禽巢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3059,\n",
+                u8"    \"Key\": \"FoulCrowNest\",\n",
+                u8"    \"enUS\": \"Foul Crow Nest\",\n",
+                u8"    \"zhTW\": \"惡毒穢鴉之巢\",\n",
+                u8"    \"deDE\": \"Faulkrähennest\",\n",
+                u8"    \"esES\": \"Nido de cuervo fétido\",\n",
+                u8"    \"frFR\": \"Nid de corbeaux fétides\",\n",
+                u8"    \"itIT\": \"Nido di Corvo Fetido\",\n",
+                u8"    \"koKR\": \"불결한 까마귀 둥지\",\n",
+                u8"    \"plPL\": \"Gniazdo plugawych kruków\",\n",
+                u8"    \"esMX\": \"Nido de Cuervo repugnante\",\n",
+                u8"    \"jaJP\": \"ファウル・クロウの巣\",\n",
+                u8"    \"ptBR\": \"[ms]Ninho de Corvo Sórdido\",\n",
+                u8"    \"ruRU\": \"Гнездо нечистой птицы\",\n",
+                u8"    \"zhCN\": \"恶臭乌鸦巢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3060,\n",
+                u8"    \"Key\": \"Diablo\",\n",
+                u8"    \"enUS\": \"Diablo\",\n",
+                u8"    \"zhTW\": \"迪亞布羅\",\n",
+                u8"    \"deDE\": \"Diablo\",\n",
+                u8"    \"esES\": \"Diablo\",\n",
+                u8"    \"frFR\": \"Diablo\",\n",
+                u8"    \"itIT\": \"Diablo\",\n",
+                u8"    \"koKR\": \"디아블로\",\n",
+                u8"    \"plPL\": \"Diablo\",\n",
+                u8"    \"esMX\": \"Diablo\",\n",
+                u8"    \"jaJP\": \"ディアブロ\",\n",
+                u8"    \"ptBR\": \"Diablo\",\n",
+                u8"    \"ruRU\": \"Диабло\",\n",
+                u8"    \"zhCN\": \"迪亚波罗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3061,\n",
+                u8"    \"Key\": \"Baal\",\n",
+                u8"    \"enUS\": \"Baal\",\n",
+                u8"    \"zhTW\": \"巴爾\",\n",
+                u8"    \"deDE\": \"Baal\",\n",
+                u8"    \"esES\": \"Baal\",\n",
+                u8"    \"frFR\": \"Baal\",\n",
+                u8"    \"itIT\": \"Baal\",\n",
+                u8"    \"koKR\": \"바알\",\n",
+                u8"    \"plPL\": \"Baal\",\n",
+                u8"    \"esMX\": \"Baal\",\n",
+                u8"    \"jaJP\": \"バール\",\n",
+                u8"    \"ptBR\": \"Baal\",\n",
+                u8"    \"ruRU\": \"Баал\",\n",
+                u8"    \"zhCN\": \"巴尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3062,\n",
+                u8"    \"Key\": \"Mephisto\",\n",
+                u8"    \"enUS\": \"Mephisto\",\n",
+                u8"    \"zhTW\": \"墨菲斯托\",\n",
+                u8"    \"deDE\": \"Mephisto\",\n",
+                u8"    \"esES\": \"Mefisto\",\n",
+                u8"    \"frFR\": \"Méphisto\",\n",
+                u8"    \"itIT\": \"Mefisto\",\n",
+                u8"    \"koKR\": \"메피스토\",\n",
+                u8"    \"plPL\": \"Mefisto\",\n",
+                u8"    \"esMX\": \"Mefisto\",\n",
+                u8"    \"jaJP\": \"メフィスト\",\n",
+                u8"    \"ptBR\": \"Mefisto\",\n",
+                u8"    \"ruRU\": \"Мефисто\",\n",
+                u8"    \"zhCN\": \"墨菲斯托\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3063,\n",
+                u8"    \"Key\": \"Cantor\",\n",
+                u8"    \"enUS\": \"Cantor\",\n",
+                u8"    \"zhTW\": \"領唱者\",\n",
+                u8"    \"deDE\": \"Kantor\",\n",
+                u8"    \"esES\": \"Cantor\",\n",
+                u8"    \"frFR\": \"Chantre\",\n",
+                u8"    \"itIT\": \"Cantore\",\n",
+                u8"    \"koKR\": \"낭송자\",\n",
+                u8"    \"plPL\": \"Kantor\",\n",
+                u8"    \"esMX\": \"Capiscol\",\n",
+                u8"    \"jaJP\": \"聖歌隊長\",\n",
+                u8"    \"ptBR\": \"[ms]Cantor\",\n",
+                u8"    \"ruRU\": \"Кантор\",\n",
+                u8"    \"zhCN\": \"领唱者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3064,\n",
+                u8"    \"Key\": \"Heirophant\",\n",
+                u8"    \"enUS\": \"Hierophant\",\n",
+                u8"    \"zhTW\": \"祭司\",\n",
+                u8"    \"deDE\": \"Hierophant\",\n",
+                u8"    \"esES\": \"Hierofante\",\n",
+                u8"    \"frFR\": \"Hiérophante\",\n",
+                u8"    \"itIT\": \"Ierofante\",\n",
+                u8"    \"koKR\": \"신비사제\",\n",
+                u8"    \"plPL\": \"Hierofant\",\n",
+                u8"    \"esMX\": \"Hierofante\",\n",
+                u8"    \"jaJP\": \"司祭長\",\n",
+                u8"    \"ptBR\": \"[ms]Hierofante\",\n",
+                u8"    \"ruRU\": \"Верховный жрец\",\n",
+                u8"    \"zhCN\": \"圣师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3065,\n",
+                u8"    \"Key\": \"Sexton\",\n",
+                u8"    \"enUS\": \"Sexton\",\n",
+                u8"    \"zhTW\": \"司事\",\n",
+                u8"    \"deDE\": \"Küster\",\n",
+                u8"    \"esES\": \"Sacristán\",\n",
+                u8"    \"frFR\": \"Sacristain\",\n",
+                u8"    \"itIT\": \"Necroforo\",\n",
+                u8"    \"koKR\": \"교회지기\",\n",
+                u8"    \"plPL\": \"Akolita\",\n",
+                u8"    \"esMX\": \"Sacristán\",\n",
+                u8"    \"jaJP\": \"会堂奉仕者\",\n",
+                u8"    \"ptBR\": \"[ms]Sexton\",\n",
+                u8"    \"ruRU\": \"Алтарник\",\n",
+                u8"    \"zhCN\": \"教堂司事\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3066,\n",
+                u8"    \"Key\": \"Zealot\",\n",
+                u8"    \"enUS\": \"Zealot\",\n",
+                u8"    \"zhTW\": \"狂熱信徒\",\n",
+                u8"    \"deDE\": \"Fanatiker\",\n",
+                u8"    \"esES\": \"Zelote\",\n",
+                u8"    \"frFR\": \"Zélote\",\n",
+                u8"    \"itIT\": \"Zelota\",\n",
+                u8"    \"koKR\": \"광신도\",\n",
+                u8"    \"plPL\": \"Fanatyk\",\n",
+                u8"    \"esMX\": \"Zelote\",\n",
+                u8"    \"jaJP\": \"ザカラム狂信者\",\n",
+                u8"    \"ptBR\": \"[ms]Zelote\",\n",
+                u8"    \"ruRU\": \"Фанатик\",\n",
+                u8"    \"zhCN\": \"热忱者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3067,\n",
+                u8"    \"Key\": \"Faithful\",\n",
+                u8"    \"enUS\": \"Faithful\",\n",
+                u8"    \"zhTW\": \"忠誠信徒\",\n",
+                u8"    \"deDE\": \"Gläubiger\",\n",
+                u8"    \"esES\": \"Fiel\",\n",
+                u8"    \"frFR\": \"Fidèle\",\n",
+                u8"    \"itIT\": \"Fedele\",\n",
+                u8"    \"koKR\": \"신봉자\",\n",
+                u8"    \"plPL\": \"Wierny\",\n",
+                u8"    \"esMX\": \"Fiel\",\n",
+                u8"    \"jaJP\": \"ザカラム信徒\",\n",
+                u8"    \"ptBR\": \"[ms]Fiel\",\n",
+                u8"    \"ruRU\": \"Послушник\",\n",
+                u8"    \"zhCN\": \"虔诚者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3068,\n",
+                u8"    \"Key\": \"Zakarumite\",\n",
+                u8"    \"enUS\": \"Zakarumite\",\n",
+                u8"    \"zhTW\": \"撒卡蘭姆信徒\",\n",
+                u8"    \"deDE\": \"Zakarumit\",\n",
+                u8"    \"esES\": \"Zakarumite\",\n",
+                u8"    \"frFR\": \"Zakarumite\",\n",
+                u8"    \"itIT\": \"Zakarumita\",\n",
+                u8"    \"koKR\": \"자카룸 교도\",\n",
+                u8"    \"plPL\": \"Zakarumita\",\n",
+                u8"    \"esMX\": \"Zakarumita\",\n",
+                u8"    \"jaJP\": \"ザカラム教徒\",\n",
+                u8"    \"ptBR\": \"[ms]Zakarumita\",\n",
+                u8"    \"ruRU\": \"Закарумит\",\n",
+                u8"    \"zhCN\": \"萨卡兰姆教徒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3069,\n",
+                u8"    \"Key\": \"BlackSoul\",\n",
+                u8"    \"enUS\": \"Black Soul\",\n",
+                u8"    \"zhTW\": \"黑魂鬼火\",\n",
+                u8"    \"deDE\": \"Schwarze Seele\",\n",
+                u8"    \"esES\": \"Alma negra\",\n",
+                u8"    \"frFR\": \"Âme noire\",\n",
+                u8"    \"itIT\": \"Anima Nera\",\n",
+                u8"    \"koKR\": \"어둠의 영혼\",\n",
+                u8"    \"plPL\": \"Czarna dusza\",\n",
+                u8"    \"esMX\": \"Alma sombría\",\n",
+                u8"    \"jaJP\": \"ブラック・ソウル\",\n",
+                u8"    \"ptBR\": \"[fs]Alma Sombria\",\n",
+                u8"    \"ruRU\": \"Черная душа\",\n",
+                u8"    \"zhCN\": \"黑魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3070,\n",
+                u8"    \"Key\": \"BurningSoul\",\n",
+                u8"    \"enUS\": \"Burning Soul\",\n",
+                u8"    \"zhTW\": \"燃魂鬼火\",\n",
+                u8"    \"deDE\": \"Brennende Seele\",\n",
+                u8"    \"esES\": \"Alma ardiente\",\n",
+                u8"    \"frFR\": \"Âme ardente\",\n",
+                u8"    \"itIT\": \"Anima Fiammeggiante\",\n",
+                u8"    \"koKR\": \"불타는 영혼\",\n",
+                u8"    \"plPL\": \"Płonąca dusza\",\n",
+                u8"    \"esMX\": \"Alma ardiente\",\n",
+                u8"    \"jaJP\": \"バーニング・ソウル\",\n",
+                u8"    \"ptBR\": \"[fs]Alma Flamejante\",\n",
+                u8"    \"ruRU\": \"Пылающая душа\",\n",
+                u8"    \"zhCN\": \"燃魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3071,\n",
+                u8"    \"Key\": \"SwampGhost\",\n",
+                u8"    \"enUS\": \"Swamp Ghost\",\n",
+                u8"    \"zhTW\": \"沼澤鬼魂\",\n",
+                u8"    \"deDE\": \"Sumpfgeist\",\n",
+                u8"    \"esES\": \"Fantasma del pantano\",\n",
+                u8"    \"frFR\": \"Fantôme des marais\",\n",
+                u8"    \"itIT\": \"Fantasma della Palude\",\n",
+                u8"    \"koKR\": \"늪 유령\",\n",
+                u8"    \"plPL\": \"Bagienny duch\",\n",
+                u8"    \"esMX\": \"Fantasma del pantano\",\n",
+                u8"    \"jaJP\": \"スワンプ・ゴースト\",\n",
+                u8"    \"ptBR\": \"[ms]Fantasma do Pântano\",\n",
+                u8"    \"ruRU\": \"Болотный призрак\",\n",
+                u8"    \"zhCN\": \"沼魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3072,\n",
+                u8"    \"Key\": \"Gloam\",\n",
+                u8"    \"enUS\": \"Gloam\",\n",
+                u8"    \"zhTW\": \"薄暮鬼火\",\n",
+                u8"    \"deDE\": \"Düsternis\",\n",
+                u8"    \"esES\": \"Ocaso\",\n",
+                u8"    \"frFR\": \"Crépuscule\",\n",
+                u8"    \"itIT\": \"Bruma\",\n",
+                u8"    \"koKR\": \"황혼의 영혼\",\n",
+                u8"    \"plPL\": \"Błysk\",\n",
+                u8"    \"esMX\": \"Crepuscular\",\n",
+                u8"    \"jaJP\": \"グローム\",\n",
+                u8"    \"ptBR\": \"[ms]Fusco\",\n",
+                u8"    \"ruRU\": \"Сумеречник\",\n",
+                u8"    \"zhCN\": \"暮灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3073,\n",
+                u8"    \"Key\": \"WarpedShaman\",\n",
+                u8"    \"enUS\": \"Warped Shaman\",\n",
+                u8"    \"zhTW\": \"扭曲薩滿\",\n",
+                u8"    \"deDE\": \"Verdrehter Schamane\",\n",
+                u8"    \"esES\": \"Chamán retorcido\",\n",
+                u8"    \"frFR\": \"Chaman perverti\",\n",
+                u8"    \"itIT\": \"Sciamano Deforme\",\n",
+                u8"    \"koKR\": \"뒤틀린 악마 영매\",\n",
+                u8"    \"plPL\": \"Szaman spaczeńców\",\n",
+                u8"    \"esMX\": \"Chamán retorcido\",\n",
+                u8"    \"jaJP\": \"ウォープト・ワンの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Distorcido\",\n",
+                u8"    \"ruRU\": \"Искаженный-шаман\",\n",
+                u8"    \"zhCN\": \"扭曲魔萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3074,\n",
+                u8"    \"Key\": \"DarkShaman\",\n",
+                u8"    \"enUS\": \"Dark Shaman\",\n",
+                u8"    \"zhTW\": \"暗黑薩滿\",\n",
+                u8"    \"deDE\": \"Dunkler Schamane\",\n",
+                u8"    \"esES\": \"Chamán oscuro\",\n",
+                u8"    \"frFR\": \"Chaman sombre\",\n",
+                u8"    \"itIT\": \"Sciamano Oscuro\",\n",
+                u8"    \"koKR\": \"어둠의 영매\",\n",
+                u8"    \"plPL\": \"Szaman mrocznych\",\n",
+                u8"    \"esMX\": \"Chamán oscuro\",\n",
+                u8"    \"jaJP\": \"ダーク・ワンの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Trevoso\",\n",
+                u8"    \"ruRU\": \"Темный-шаман\",\n",
+                u8"    \"zhCN\": \"黑暗魔萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3075,\n",
+                u8"    \"Key\": \"DevilkinShaman\",\n",
+                u8"    \"enUS\": \"Devilkin Shaman\",\n",
+                u8"    \"zhTW\": \"魔妖薩滿\",\n",
+                u8"    \"deDE\": \"Teuflischer Schamane\",\n",
+                u8"    \"esES\": \"Chamán diabólico\",\n",
+                u8"    \"frFR\": \"Chaman démonoïde\",\n",
+                u8"    \"itIT\": \"Sciamano Malefico\",\n",
+                u8"    \"koKR\": \"악마피붙이 영매\",\n",
+                u8"    \"plPL\": \"Szaman diablików\",\n",
+                u8"    \"esMX\": \"Chamán demonante\",\n",
+                u8"    \"jaJP\": \"デビルキンの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Demonante\",\n",
+                u8"    \"ruRU\": \"Дьяволенок-шаман\",\n",
+                u8"    \"zhCN\": \"小恶魔萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3076,\n",
+                u8"    \"Key\": \"CarverShaman\",\n",
+                u8"    \"enUS\": \"Carver Shaman\",\n",
+                u8"    \"zhTW\": \"刨肉薩滿\",\n",
+                u8"    \"deDE\": \"Schlächterschamane\",\n",
+                u8"    \"esES\": \"Chamán trinchante\",\n",
+                u8"    \"frFR\": \"Chaman équarrisseur\",\n",
+                u8"    \"itIT\": \"Sciamano Incisore\",\n",
+                u8"    \"koKR\": \"도륙자 영매\",\n",
+                u8"    \"plPL\": \"Szaman wycinaczy\",\n",
+                u8"    \"esMX\": \"Chamán tajador\",\n",
+                u8"    \"jaJP\": \"カーヴァーの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Entalhador\",\n",
+                u8"    \"ruRU\": \"Плоторез-шаман\",\n",
+                u8"    \"zhCN\": \"利刃魔萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3077,\n",
+                u8"    \"Key\": \"FallenShaman\",\n",
+                u8"    \"enUS\": \"Fallen Shaman\",\n",
+                u8"    \"zhTW\": \"沉淪魔薩滿\",\n",
+                u8"    \"deDE\": \"Gefallener Schamane\",\n",
+                u8"    \"esES\": \"Chamán caído\",\n",
+                u8"    \"frFR\": \"Chaman déchu\",\n",
+                u8"    \"itIT\": \"Sciamano Caduto\",\n",
+                u8"    \"koKR\": \"몰락자 영매\",\n",
+                u8"    \"plPL\": \"Szaman upadłych\",\n",
+                u8"    \"esMX\": \"Chamán caído\",\n",
+                u8"    \"jaJP\": \"フォールンの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Decaído\",\n",
+                u8"    \"ruRU\": \"Падший-шаман\",\n",
+                u8"    \"zhCN\": \"沉沦魔萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3078,\n",
+                u8"    \"Key\": \"WarpedFallen\",\n",
+                u8"    \"enUS\": \"Warped One\",\n",
+                u8"    \"zhTW\": \"扭曲沉淪魔\",\n",
+                u8"    \"deDE\": \"Verdrehter\",\n",
+                u8"    \"esES\": \"Retorcido\",\n",
+                u8"    \"frFR\": \"Le Perverti\",\n",
+                u8"    \"itIT\": \"Deforme\",\n",
+                u8"    \"koKR\": \"뒤틀린 악마\",\n",
+                u8"    \"plPL\": \"Spaczeniec\",\n",
+                u8"    \"esMX\": \"Retorcido\",\n",
+                u8"    \"jaJP\": \"ウォープト・ワン\",\n",
+                u8"    \"ptBR\": \"[ms]Distorcido\",\n",
+                u8"    \"ruRU\": \"Искаженный\",\n",
+                u8"    \"zhCN\": \"扭曲魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3079,\n",
+                u8"    \"Key\": \"DarkOne\",\n",
+                u8"    \"enUS\": \"Dark One\",\n",
+                u8"    \"zhTW\": \"暗黑沉淪魔\",\n",
+                u8"    \"deDE\": \"Dunkle Kreatur\",\n",
+                u8"    \"esES\": \"Oscuro\",\n",
+                u8"    \"frFR\": \"Le Sombre\",\n",
+                u8"    \"itIT\": \"Oscuro\",\n",
+                u8"    \"koKR\": \"어둠의 악마\",\n",
+                u8"    \"plPL\": \"Mroczny\",\n",
+                u8"    \"esMX\": \"Oscuro\",\n",
+                u8"    \"jaJP\": \"ダーク・ワン\",\n",
+                u8"    \"ptBR\": \"[ms]Trevoso\",\n",
+                u8"    \"ruRU\": \"Темный\",\n",
+                u8"    \"zhCN\": \"暗魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3080,\n",
+                u8"    \"Key\": \"Devilkin\",\n",
+                u8"    \"enUS\": \"Devilkin\",\n",
+                u8"    \"zhTW\": \"魔妖沉淪魔\",\n",
+                u8"    \"deDE\": \"Teuflischer\",\n",
+                u8"    \"esES\": \"Diabólico\",\n",
+                u8"    \"frFR\": \"Démonoïde\",\n",
+                u8"    \"itIT\": \"Malefico\",\n",
+                u8"    \"koKR\": \"악마피붙이\",\n",
+                u8"    \"plPL\": \"Diablik\",\n",
+                u8"    \"esMX\": \"Demonante\",\n",
+                u8"    \"jaJP\": \"デビルキン\",\n",
+                u8"    \"ptBR\": \"[ms]Demonante\",\n",
+                u8"    \"ruRU\": \"Дьяволенок\",\n",
+                u8"    \"zhCN\": \"小恶魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3081,\n",
+                u8"    \"Key\": \"Carver\",\n",
+                u8"    \"enUS\": \"Carver\",\n",
+                u8"    \"zhTW\": \"刨肉沉淪魔\",\n",
+                u8"    \"deDE\": \"Schlächter\",\n",
+                u8"    \"esES\": \"Trinchante\",\n",
+                u8"    \"frFR\": \"Équarrisseur\",\n",
+                u8"    \"itIT\": \"Incisore\",\n",
+                u8"    \"koKR\": \"도륙자\",\n",
+                u8"    \"plPL\": \"Wycinacz\",\n",
+                u8"    \"esMX\": \"Tajador\",\n",
+                u8"    \"jaJP\": \"カーヴァー\",\n",
+                u8"    \"ptBR\": \"[ms]Entalhador\",\n",
+                u8"    \"ruRU\": \"Плоторез\",\n",
+                u8"    \"zhCN\": \"利刃魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3082,\n",
+                u8"    \"Key\": \"Fallen\",\n",
+                u8"    \"enUS\": \"Fallen\",\n",
+                u8"    \"zhTW\": \"沉淪魔\",\n",
+                u8"    \"deDE\": \"Gefallener\",\n",
+                u8"    \"esES\": \"Caído\",\n",
+                u8"    \"frFR\": \"Déchu\",\n",
+                u8"    \"itIT\": \"Caduto\",\n",
+                u8"    \"koKR\": \"몰락자\",\n",
+                u8"    \"plPL\": \"Upadły\",\n",
+                u8"    \"esMX\": \"Caído\",\n",
+                u8"    \"jaJP\": \"フォールン\",\n",
+                u8"    \"ptBR\": \"[ms]Decaído\",\n",
+                u8"    \"ruRU\": \"Падший\",\n",
+                u8"    \"zhCN\": \"沉沦魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3083,\n",
+                u8"    \"Key\": \"ReturnedArcher\",\n",
+                u8"    \"enUS\": \"Returned Archer\",\n",
+                u8"    \"zhTW\": \"返世亡靈弓箭手\",\n",
+                u8"    \"deDE\": \"Zurückgekehrter Bogenschütze\",\n",
+                u8"    \"esES\": \"Arquero retornado\",\n",
+                u8"    \"frFR\": \"Archer ranimé\",\n",
+                u8"    \"itIT\": \"Arciere Ritornato\",\n",
+                u8"    \"koKR\": \"되돌아온 궁수\",\n",
+                u8"    \"plPL\": \"Przywrócony łucznik\",\n",
+                u8"    \"esMX\": \"Arquero retornado\",\n",
+                u8"    \"jaJP\": \"リターンド・アーチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Arqueiro Retornado\",\n",
+                u8"    \"ruRU\": \"Воскресший лучник\",\n",
+                u8"    \"zhCN\": \"回魂弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3084,\n",
+                u8"    \"Key\": \"HorrorArcher\",\n",
+                u8"    \"enUS\": \"Horror Archer\",\n",
+                u8"    \"zhTW\": \"恐骨弓箭手\",\n",
+                u8"    \"deDE\": \"Horrorbogenschütze\",\n",
+                u8"    \"esES\": \"Arquero del horror\",\n",
+                u8"    \"frFR\": \"Archer d’horreur\",\n",
+                u8"    \"itIT\": \"Arciere dell'Orrore\",\n",
+                u8"    \"koKR\": \"피바람 궁수\",\n",
+                u8"    \"plPL\": \"Kościej łucznik\",\n",
+                u8"    \"esMX\": \"Arquero tenebroso\",\n",
+                u8"    \"jaJP\": \"ホラー・アーチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Horror Arqueiro\",\n",
+                u8"    \"ruRU\": \"Лучник ужаса\",\n",
+                u8"    \"zhCN\": \"恐怖骸骨弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3085,\n",
+                u8"    \"Key\": \"BurningDeadArcher\",\n",
+                u8"    \"enUS\": \"Burning Dead Archer\",\n",
+                u8"    \"zhTW\": \"烈焰骷髏弓箭手\",\n",
+                u8"    \"deDE\": \"Bogenschütze der brennenden Toten\",\n",
+                u8"    \"esES\": \"Arquero de la muerte ardiente\",\n",
+                u8"    \"frFR\": \"Archer brûlé vif\",\n",
+                u8"    \"itIT\": \"Arciere Fiammeggiante\",\n",
+                u8"    \"koKR\": \"불타는 망자 궁수\",\n",
+                u8"    \"plPL\": \"Płonący trupi łucznik\",\n",
+                u8"    \"esMX\": \"Arquero muerto ardiente\",\n",
+                u8"    \"jaJP\": \"バーニングデッド・アーチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Arqueiro Morto Flamejante\",\n",
+                u8"    \"ruRU\": \"Горящий скелет-лучник\",\n",
+                u8"    \"zhCN\": \"烈焰亡骨弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3086,\n",
+                u8"    \"Key\": \"BoneArcher\",\n",
+                u8"    \"enUS\": \"Bone Archer\",\n",
+                u8"    \"zhTW\": \"骸骨弓箭手\",\n",
+                u8"    \"deDE\": \"Knochenbogenschütze\",\n",
+                u8"    \"esES\": \"Arquero óseo\",\n",
+                u8"    \"frFR\": \"Archer d’os\",\n",
+                u8"    \"itIT\": \"Arciere d'Ossa\",\n",
+                u8"    \"koKR\": \"뼈 궁수\",\n",
+                u8"    \"plPL\": \"Kościany łucznik\",\n",
+                u8"    \"esMX\": \"Arquero óseo\",\n",
+                u8"    \"jaJP\": \"ボーン・アーチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Arqueiro Esquelético\",\n",
+                u8"    \"ruRU\": \"Костяной лучник\",\n",
+                u8"    \"zhCN\": \"白骨弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3087,\n",
+                u8"    \"Key\": \"CorpseArcher\",\n",
+                u8"    \"enUS\": \"Corpse Archer\",\n",
+                u8"    \"zhTW\": \"屍骸弓箭手\",\n",
+                u8"    \"deDE\": \"Leichenbogenschütze\",\n",
+                u8"    \"esES\": \"Arquero cadáver\",\n",
+                u8"    \"frFR\": \"Archer cadavre\",\n",
+                u8"    \"itIT\": \"Arciere Cadavere\",\n",
+                u8"    \"koKR\": \"시체 궁수\",\n",
+                u8"    \"plPL\": \"Trupi łucznik\",\n",
+                u8"    \"esMX\": \"Arquera cadavérica\",\n",
+                u8"    \"jaJP\": \"コープス・アーチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Arqueiro Cadáver\",\n",
+                u8"    \"ruRU\": \"Труп-лучник\",\n",
+                u8"    \"zhCN\": \"尸魔弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3088,\n",
+                u8"    \"Key\": \"SkeletonArcher\",\n",
+                u8"    \"enUS\": \"Skeleton Archer\",\n",
+                u8"    \"zhTW\": \"骷髏弓箭手\",\n",
+                u8"    \"deDE\": \"Skelettbogenschütze\",\n",
+                u8"    \"esES\": \"Arquero esqueleto\",\n",
+                u8"    \"frFR\": \"Archer squelette\",\n",
+                u8"    \"itIT\": \"Arciere Scheletrico\",\n",
+                u8"    \"koKR\": \"해골 궁수\",\n",
+                u8"    \"plPL\": \"Szkieletowy łucznik\",\n",
+                u8"    \"esMX\": \"Arquero esquelético\",\n",
+                u8"    \"jaJP\": \"スケルトン・アーチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Esqueleto Arqueiro\",\n",
+                u8"    \"ruRU\": \"Скелет-лучник\",\n",
+                u8"    \"zhCN\": \"骷髅弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3089,\n",
+                u8"    \"Key\": \"FleshLancer\",\n",
+                u8"    \"enUS\": \"Flesh Lancer\",\n",
+                u8"    \"zhTW\": \"血肉長槍手\",\n",
+                u8"    \"deDE\": \"Fleischlanzenträgerin\",\n",
+                u8"    \"esES\": \"Lancera de la carne\",\n",
+                u8"    \"frFR\": \"Lancière de chair\",\n",
+                u8"    \"itIT\": \"Lanciera della Carne\",\n",
+                u8"    \"koKR\": \"살점 장창병\",\n",
+                u8"    \"plPL\": \"Wojowniczka trzewi\",\n",
+                u8"    \"esMX\": \"Lancera carnal\",\n",
+                u8"    \"jaJP\": \"血肉の槍兵\",\n",
+                u8"    \"ptBR\": \"Lanceira Cárnea\",\n",
+                u8"    \"ruRU\": \"Кровавая копейщица\",\n",
+                u8"    \"zhCN\": \"血肉长枪手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3090,\n",
+                u8"    \"Key\": \"BlackLancer\",\n",
+                u8"    \"enUS\": \"Black Lancer\",\n",
+                u8"    \"zhTW\": \"黑色長槍手\",\n",
+                u8"    \"deDE\": \"Schwarze Lanzenträgerin\",\n",
+                u8"    \"esES\": \"Lancera negra\",\n",
+                u8"    \"frFR\": \"Lancière noire\",\n",
+                u8"    \"itIT\": \"Lanciera Nera\",\n",
+                u8"    \"koKR\": \"검은 장창병\",\n",
+                u8"    \"plPL\": \"Czarna wojowniczka\",\n",
+                u8"    \"esMX\": \"Lancera sombría\",\n",
+                u8"    \"jaJP\": \"暗黒の槍兵\",\n",
+                u8"    \"ptBR\": \"[fs]Lanceira Tenebrosa\",\n",
+                u8"    \"ruRU\": \"Черная копейщица\",\n",
+                u8"    \"zhCN\": \"黑化长枪手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3091,\n",
+                u8"    \"Key\": \"DarkLancer\",\n",
+                u8"    \"enUS\": \"Dark Lancer\",\n",
+                u8"    \"zhTW\": \"黑暗長槍手\",\n",
+                u8"    \"deDE\": \"Dunkle Lanzenträgerin\",\n",
+                u8"    \"esES\": \"Lancera de la oscuridad\",\n",
+                u8"    \"frFR\": \"Lancière sombre\",\n",
+                u8"    \"itIT\": \"Lanciera Oscura\",\n",
+                u8"    \"koKR\": \"어둠의 장창병\",\n",
+                u8"    \"plPL\": \"Mroczna wojowniczka\",\n",
+                u8"    \"esMX\": \"Lancera oscura\",\n",
+                u8"    \"jaJP\": \"闇の槍兵\",\n",
+                u8"    \"ptBR\": \"[fs]Lanceira Sombria\",\n",
+                u8"    \"ruRU\": \"Темная копейщица\",\n",
+                u8"    \"zhCN\": \"黑暗长枪手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3092,\n",
+                u8"    \"Key\": \"VileLancer\",\n",
+                u8"    \"enUS\": \"Vile Lancer\",\n",
+                u8"    \"zhTW\": \"兇邪長槍手\",\n",
+                u8"    \"deDE\": \"Böse Lanzenträgerin\",\n",
+                u8"    \"esES\": \"Lancera vil\",\n",
+                u8"    \"frFR\": \"Lancière infâme\",\n",
+                u8"    \"itIT\": \"Lanciera Vile\",\n",
+                u8"    \"koKR\": \"끔찍한 장창병\",\n",
+                u8"    \"plPL\": \"Nikczemna wojowniczka\",\n",
+                u8"    \"esMX\": \"Lancera vil\",\n",
+                u8"    \"jaJP\": \"穢れし槍兵\",\n",
+                u8"    \"ptBR\": \"[fs]Lanceira Vil\",\n",
+                u8"    \"ruRU\": \"Злобная копейщица\",\n",
+                u8"    \"zhCN\": \"邪恶长枪手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3093,\n",
+                u8"    \"Key\": \"DarkSpearwoman\",\n",
+                u8"    \"enUS\": \"Dark Spearwoman\",\n",
+                u8"    \"zhTW\": \"黑暗女槍手\",\n",
+                u8"    \"deDE\": \"Dunkle Speerträgerin\",\n",
+                u8"    \"esES\": \"Piquera de la oscuridad\",\n",
+                u8"    \"frFR\": \"Lancière des Ténèbres\",\n",
+                u8"    \"itIT\": \"Impalatrice Oscura\",\n",
+                u8"    \"koKR\": \"어둠의 창병\",\n",
+                u8"    \"plPL\": \"Mroczna włóczniczka\",\n",
+                u8"    \"esMX\": \"Lancera siniestra\",\n",
+                u8"    \"jaJP\": \"闇の槍使い\",\n",
+                u8"    \"ptBR\": \"[fs]Lanceira Sinistra\",\n",
+                u8"    \"ruRU\": \"Темная воительница\",\n",
+                u8"    \"zhCN\": \"黑暗女矛手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3094,\n",
+                u8"    \"Key\": \"FleshArcher\",\n",
+                u8"    \"enUS\": \"Flesh Archer\",\n",
+                u8"    \"zhTW\": \"血肉弓箭手\",\n",
+                u8"    \"deDE\": \"Fleischbogenschützin\",\n",
+                u8"    \"esES\": \"Arquera de carne\",\n",
+                u8"    \"frFR\": \"Archère de chair\",\n",
+                u8"    \"itIT\": \"Arciera della Carne\",\n",
+                u8"    \"koKR\": \"살점 궁수\",\n",
+                u8"    \"plPL\": \"Łuczniczka trzewi\",\n",
+                u8"    \"esMX\": \"Arquera carnal\",\n",
+                u8"    \"jaJP\": \"血肉の弓使い\",\n",
+                u8"    \"ptBR\": \"Arqueira Cárnea\",\n",
+                u8"    \"ruRU\": \"Кровавая лучница\",\n",
+                u8"    \"zhCN\": \"血肉弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3095,\n",
+                u8"    \"Key\": \"BlackArcher\",\n",
+                u8"    \"enUS\": \"Black Archer\",\n",
+                u8"    \"zhTW\": \"黑色弓箭手\",\n",
+                u8"    \"deDE\": \"Schwarze Bogenschützin\",\n",
+                u8"    \"esES\": \"Arquera negra\",\n",
+                u8"    \"frFR\": \"Archère noire\",\n",
+                u8"    \"itIT\": \"Arciera Nera\",\n",
+                u8"    \"koKR\": \"검은 궁수\",\n",
+                u8"    \"plPL\": \"Czarna łuczniczka\",\n",
+                u8"    \"esMX\": \"Arquera sombría\",\n",
+                u8"    \"jaJP\": \"暗黒の弓使い\",\n",
+                u8"    \"ptBR\": \"[fs]Arqueira Tenebrosa\",\n",
+                u8"    \"ruRU\": \"Черная лучница\",\n",
+                u8"    \"zhCN\": \"黑化弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3096,\n",
+                u8"    \"Key\": \"DarkRanger\",\n",
+                u8"    \"enUS\": \"Dark Ranger\",\n",
+                u8"    \"zhTW\": \"黑暗遊俠\",\n",
+                u8"    \"deDE\": \"Dunkle Waldläuferin\",\n",
+                u8"    \"esES\": \"Guardabosques de la oscuridad\",\n",
+                u8"    \"frFR\": \"Guerrière sombre\",\n",
+                u8"    \"itIT\": \"Guardaboschi Oscura\",\n",
+                u8"    \"koKR\": \"어둠의 순찰자\",\n",
+                u8"    \"plPL\": \"Mroczna łowczyni\",\n",
+                u8"    \"esMX\": \"Forestal oscura\",\n",
+                u8"    \"jaJP\": \"闇の野伏り\",\n",
+                u8"    \"ptBR\": \"[fs]Patrulheira Sombria\",\n",
+                u8"    \"ruRU\": \"Темная разведчица\",\n",
+                u8"    \"zhCN\": \"黑暗游侠\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3098,\n",
+                u8"    \"Key\": \"DarkArcher\",\n",
+                u8"    \"enUS\": \"Dark Archer\",\n",
+                u8"    \"zhTW\": \"黑暗弓箭手\",\n",
+                u8"    \"deDE\": \"Dunkle Bogenschützin\",\n",
+                u8"    \"esES\": \"Arquera de la oscuridad\",\n",
+                u8"    \"frFR\": \"Archère sombre\",\n",
+                u8"    \"itIT\": \"Arciera Oscura\",\n",
+                u8"    \"koKR\": \"어둠의 궁수\",\n",
+                u8"    \"plPL\": \"Mroczna łuczniczka\",\n",
+                u8"    \"esMX\": \"Arquera oscura\",\n",
+                u8"    \"jaJP\": \"闇の弓使い\",\n",
+                u8"    \"ptBR\": \"[fs]Arqueira Sombria\",\n",
+                u8"    \"ruRU\": \"Темная лучница\",\n",
+                u8"    \"zhCN\": \"黑暗弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3099,\n",
+                u8"    \"Key\": \"Summoner\",\n",
+                u8"    \"enUS\": \"The Summoner\",\n",
+                u8"    \"zhTW\": \"召喚師\",\n",
+                u8"    \"deDE\": \"Der Geisterbeschwörer\",\n",
+                u8"    \"esES\": \"El Invocador\",\n",
+                u8"    \"frFR\": \"L’Invocateur\",\n",
+                u8"    \"itIT\": \"L'Evocatore\",\n",
+                u8"    \"koKR\": \"소환사\",\n",
+                u8"    \"plPL\": \"Demonolog\",\n",
+                u8"    \"esMX\": \"El Invocador\",\n",
+                u8"    \"jaJP\": \"召喚師\",\n",
+                u8"    \"ptBR\": \"O Evocador\",\n",
+                u8"    \"ruRU\": \"Призыватель\",\n",
+                u8"    \"zhCN\": \"召唤者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3100,\n",
+                u8"    \"Key\": \"StygianDollShaman\",\n",
+                u8"    \"enUS\": \"Stygian Doll Shaman\",\n",
+                u8"    \"zhTW\": \"冥河鬼娃薩滿\",\n",
+                u8"    \"deDE\": \"Stygischer Puppenschamane\",\n",
+                u8"    \"esES\": \"Chamán muñeco estigio\",\n",
+                u8"    \"frFR\": \"Chaman des poupées stygiennes\",\n",
+                u8"    \"itIT\": \"Sciamano Bambola dello Stige\",\n",
+                u8"    \"koKR\": \"저승 꼭두각시 영매\",\n",
+                u8"    \"plPL\": \"Szaman stygijczyków\",\n",
+                u8"    \"esMX\": \"Chamán muñeco estigio\",\n",
+                u8"    \"jaJP\": \"スティジャンドールの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Boneco Estígio\",\n",
+                u8"    \"ruRU\": \"Стигийская кукла – шаман\",\n",
+                u8"    \"zhCN\": \"冥河娃娃萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3101,\n",
+                u8"    \"Key\": \"SoulKillerShaman\",\n",
+                u8"    \"enUS\": \"Soul Killer Shaman\",\n",
+                u8"    \"zhTW\": \"靈魂殺手薩滿\",\n",
+                u8"    \"deDE\": \"Seelentöterschamane\",\n",
+                u8"    \"esES\": \"Chamán asesino de almas\",\n",
+                u8"    \"frFR\": \"Chaman tueur d’âmes\",\n",
+                u8"    \"itIT\": \"Sciamano Uccisore di Anime\",\n",
+                u8"    \"koKR\": \"영혼살해자 영매\",\n",
+                u8"    \"plPL\": \"Szaman zabójców dusz\",\n",
+                u8"    \"esMX\": \"Chamán asesino de almas\",\n",
+                u8"    \"jaJP\": \"ソウルキラーの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Mata-almas\",\n",
+                u8"    \"ruRU\": \"Душегуб-шаман\",\n",
+                u8"    \"zhCN\": \"灵魂杀手萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3102,\n",
+                u8"    \"Key\": \"FlayerShaman\",\n",
+                u8"    \"enUS\": \"Flayer Shaman\",\n",
+                u8"    \"zhTW\": \"剝皮手薩滿\",\n",
+                u8"    \"deDE\": \"Schinderschamane\",\n",
+                u8"    \"esES\": \"Chamán desollador\",\n",
+                u8"    \"frFR\": \"Chaman écorcheur\",\n",
+                u8"    \"itIT\": \"Sciamano Scorticatore\",\n",
+                u8"    \"koKR\": \"약탈자 영매\",\n",
+                u8"    \"plPL\": \"Szaman łupieżców\",\n",
+                u8"    \"esMX\": \"Chamán desollador\",\n",
+                u8"    \"jaJP\": \"フレイヤーの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Esfolador\",\n",
+                u8"    \"ruRU\": \"Свежеватель-шаман\",\n",
+                u8"    \"zhCN\": \"剥皮魔萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3103,\n",
+                u8"    \"Key\": \"FetishShaman\",\n",
+                u8"    \"enUS\": \"Fetish Shaman\",\n",
+                u8"    \"zhTW\": \"鬼娃薩滿\",\n",
+                u8"    \"deDE\": \"Fetischschamane\",\n",
+                u8"    \"esES\": \"Chamán fetiche\",\n",
+                u8"    \"frFR\": \"Chaman féticheur\",\n",
+                u8"    \"itIT\": \"Sciamano Feticcio\",\n",
+                u8"    \"koKR\": \"우상족 영매\",\n",
+                u8"    \"plPL\": \"Szaman fetyszy\",\n",
+                u8"    \"esMX\": \"Chamán fetiche\",\n",
+                u8"    \"jaJP\": \"フェティッシュの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Carranco\",\n",
+                u8"    \"ruRU\": \"Фетиш-шаман\",\n",
+                u8"    \"zhCN\": \"鬼娃萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3104,\n",
+                u8"    \"Key\": \"RatManShaman\",\n",
+                u8"    \"enUS\": \"RatMan Shaman\",\n",
+                u8"    \"zhTW\": \"鼠人薩滿\",\n",
+                u8"    \"deDE\": \"Rattenmannschamane\",\n",
+                u8"    \"esES\": \"Chamán hombre rata\",\n",
+                u8"    \"frFR\": \"Chaman homme-rat\",\n",
+                u8"    \"itIT\": \"Sciamano Uomo Ratto\",\n",
+                u8"    \"koKR\": \"쥐 인간 영매\",\n",
+                u8"    \"plPL\": \"Szaman szczuroczłeków\",\n",
+                u8"    \"esMX\": \"Chamán ratonero\",\n",
+                u8"    \"jaJP\": \"ラットマンの呪術師\",\n",
+                u8"    \"ptBR\": \"[ms]Xamã Homem-rato\",\n",
+                u8"    \"ruRU\": \"Крысолюд-шаман\",\n",
+                u8"    \"zhCN\": \"鼠人萨满\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3105,\n",
+                u8"    \"Key\": \"HorrorMage\",\n",
+                u8"    \"enUS\": \"Horror Mage\",\n",
+                u8"    \"zhTW\": \"恐骨法師\",\n",
+                u8"    \"deDE\": \"Horrormagier\",\n",
+                u8"    \"esES\": \"Mago del horror\",\n",
+                u8"    \"frFR\": \"Mage d’horreur\",\n",
+                u8"    \"itIT\": \"Mago dell'Orrore\",\n",
+                u8"    \"koKR\": \"피바람 마술사\",\n",
+                u8"    \"plPL\": \"Kościej mag\",\n",
+                u8"    \"esMX\": \"Mago tenebroso\",\n",
+                u8"    \"jaJP\": \"ホラー・メイジ\",\n",
+                u8"    \"ptBR\": \"[ms]Horror Mago\",\n",
+                u8"    \"ruRU\": \"Маг ужаса\",\n",
+                u8"    \"zhCN\": \"恐怖骸骨法师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3106,\n",
+                u8"    \"Key\": \"BurningDeadMage\",\n",
+                u8"    \"enUS\": \"Burning Dead Mage\",\n",
+                u8"    \"zhTW\": \"烈焰骷髏法師\",\n",
+                u8"    \"deDE\": \"Magier der brennenden Toten\",\n",
+                u8"    \"esES\": \"Mago de la muerte ardiente\",\n",
+                u8"    \"frFR\": \"Mage brûlé vif\",\n",
+                u8"    \"itIT\": \"Mago Fiammeggiante\",\n",
+                u8"    \"koKR\": \"불타는 망자 마술사\",\n",
+                u8"    \"plPL\": \"Płonący trupi mag\",\n",
+                u8"    \"esMX\": \"Mago muerto ardiente\",\n",
+                u8"    \"jaJP\": \"バーニングデッド・メイジ\",\n",
+                u8"    \"ptBR\": \"[ms]Mago Morto Flamejante\",\n",
+                u8"    \"ruRU\": \"Горящий скелет-маг\",\n",
+                u8"    \"zhCN\": \"烈焰亡骨法师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3107,\n",
+                u8"    \"Key\": \"BoneMage\",\n",
+                u8"    \"enUS\": \"Bone Mage\",\n",
+                u8"    \"zhTW\": \"骸骨法師\",\n",
+                u8"    \"deDE\": \"Knochenmagier\",\n",
+                u8"    \"esES\": \"Mago óseo\",\n",
+                u8"    \"frFR\": \"Mage d’os\",\n",
+                u8"    \"itIT\": \"Mago d'Ossa\",\n",
+                u8"    \"koKR\": \"뼈 마술사\",\n",
+                u8"    \"plPL\": \"Kościany mag\",\n",
+                u8"    \"esMX\": \"Mago óseo\",\n",
+                u8"    \"jaJP\": \"ボーン・メイジ\",\n",
+                u8"    \"ptBR\": \"[ms]Mago Esquelético\",\n",
+                u8"    \"ruRU\": \"Костяной маг\",\n",
+                u8"    \"zhCN\": \"白骨法师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3108,\n",
+                u8"    \"Key\": \"CorpseMage\",\n",
+                u8"    \"enUS\": \"Corpse Mage\",\n",
+                u8"    \"zhTW\": \"死屍法師\",\n",
+                u8"    \"deDE\": \"Leichenmagier\",\n",
+                u8"    \"esES\": \"Mago cadáver\",\n",
+                u8"    \"frFR\": \"Mage cadavre\",\n",
+                u8"    \"itIT\": \"Mago Cadavere\",\n",
+                u8"    \"koKR\": \"시체 마술사\",\n",
+                u8"    \"plPL\": \"Trupi mag\",\n",
+                u8"    \"esMX\": \"Mago cadavérico\",\n",
+                u8"    \"jaJP\": \"コープス・メイジ\",\n",
+                u8"    \"ptBR\": \"[ms]Mago Cadáver\",\n",
+                u8"    \"ruRU\": \"Труп-маг\",\n",
+                u8"    \"zhCN\": \"尸魔法师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3109,\n",
+                u8"    \"Key\": \"ReturnedMage\",\n",
+                u8"    \"enUS\": \"Returned Mage\",\n",
+                u8"    \"zhTW\": \"返世亡靈法師\",\n",
+                u8"    \"deDE\": \"Zurückgekehrter Magier\",\n",
+                u8"    \"esES\": \"Mago retornado\",\n",
+                u8"    \"frFR\": \"Mage ranimé\",\n",
+                u8"    \"itIT\": \"Mago Ritornato\",\n",
+                u8"    \"koKR\": \"되돌아온 마술사\",\n",
+                u8"    \"plPL\": \"Przywrócony mag\",\n",
+                u8"    \"esMX\": \"Mago retornado\",\n",
+                u8"    \"jaJP\": \"リターンド・メイジ\",\n",
+                u8"    \"ptBR\": \"[ms]Mago Retornado\",\n",
+                u8"    \"ruRU\": \"Воскресший маг\",\n",
+                u8"    \"zhCN\": \"回魂法师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3110,\n",
+                u8"    \"Key\": \"GargoyleTrap\",\n",
+                u8"    \"enUS\": \"Gargoyle Trap\",\n",
+                u8"    \"zhTW\": \"石像鬼陷阱\",\n",
+                u8"    \"deDE\": \"Gargoylefalle\",\n",
+                u8"    \"esES\": \"Trampa de gárgolas\",\n",
+                u8"    \"frFR\": \"Piège à gargouille\",\n",
+                u8"    \"itIT\": \"Trappola Gargoyle\",\n",
+                u8"    \"koKR\": \"가고일 덫\",\n",
+                u8"    \"plPL\": \"Gargulcowa pułapka\",\n",
+                u8"    \"esMX\": \"Trampa de gárgola\",\n",
+                u8"    \"jaJP\": \"ガーゴイル・トラップ\",\n",
+                u8"    \"ptBR\": \"[fs]Armadilha da Gárgula\",\n",
+                u8"    \"ruRU\": \"Ловушка-горгулья\",\n",
+                u8"    \"zhCN\": \"石像鬼陷阱\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3111,\n",
+                u8"    \"Key\": \"Bloodraven\",\n",
+                u8"    \"enUS\": \"Blood Raven\",\n",
+                u8"    \"zhTW\": \"血鴉\",\n",
+                u8"    \"deDE\": \"Blutrabe\",\n",
+                u8"    \"esES\": \"Cuervo Sangriento\",\n",
+                u8"    \"frFR\": \"Blood Raven\",\n",
+                u8"    \"itIT\": \"Corvo Vermiglio\",\n",
+                u8"    \"koKR\": \"핏빛 큰까마귀\",\n",
+                u8"    \"plPL\": \"Krwawa Orlica\",\n",
+                u8"    \"esMX\": \"Cuervo Sangriento\",\n",
+                u8"    \"jaJP\": \"ブラッド・レイヴン\",\n",
+                u8"    \"ptBR\": \"Rapina Sangrenta\",\n",
+                u8"    \"ruRU\": \"Кровавый Ворон\",\n",
+                u8"    \"zhCN\": \"血鸦\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3115,\n",
+                u8"    \"Key\": \"StygianWatcherHead\",\n",
+                u8"    \"enUS\": \"Stygian Watcher\",\n",
+                u8"    \"zhTW\": \"冥河水怪\",\n",
+                u8"    \"deDE\": \"Stygischer Wächter\",\n",
+                u8"    \"esES\": \"Vigía estigio\",\n",
+                u8"    \"frFR\": \"Garde stygien\",\n",
+                u8"    \"itIT\": \"Custode dello Stige\",\n",
+                u8"    \"koKR\": \"저승 감시자\",\n",
+                u8"    \"plPL\": \"Stygijski strażnik\",\n",
+                u8"    \"esMX\": \"Vigía estigio\",\n",
+                u8"    \"jaJP\": \"スティジャン・ウォッチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Vigia Estígio\",\n",
+                u8"    \"ruRU\": \"Стигийский наблюдатель\",\n",
+                u8"    \"zhCN\": \"冥河看守水怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3116,\n",
+                u8"    \"Key\": \"RiverStalkerHead\",\n",
+                u8"    \"enUS\": \"River Stalker\",\n",
+                u8"    \"zhTW\": \"河流水怪\",\n",
+                u8"    \"deDE\": \"Flussschleicher\",\n",
+                u8"    \"esES\": \"Acechador del río\",\n",
+                u8"    \"frFR\": \"Vagabond des rivières\",\n",
+                u8"    \"itIT\": \"Predatore dei Fiumi\",\n",
+                u8"    \"koKR\": \"강 추적자\",\n",
+                u8"    \"plPL\": \"Wąż rzeczny\",\n",
+                u8"    \"esMX\": \"Acechador fluvial\",\n",
+                u8"    \"jaJP\": \"リバー・ストーカー\",\n",
+                u8"    \"ptBR\": \"[ms]Perseguidor Fluvial\",\n",
+                u8"    \"ruRU\": \"Речной охотник\",\n",
+                u8"    \"zhCN\": \"潜河水怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3117,\n",
+                u8"    \"Key\": \"WaterWatcherHead\",\n",
+                u8"    \"enUS\": \"Water Watcher\",\n",
+                u8"    \"zhTW\": \"水坑水怪\",\n",
+                u8"    \"deDE\": \"Wasserwächter\",\n",
+                u8"    \"esES\": \"Vigía del agua\",\n",
+                u8"    \"frFR\": \"Gardien des eaux\",\n",
+                u8"    \"itIT\": \"Custode delle Acque\",\n",
+                u8"    \"koKR\": \"물길 망꾼\",\n",
+                u8"    \"plPL\": \"Czerw wodny\",\n",
+                u8"    \"esMX\": \"Vigía acuático\",\n",
+                u8"    \"jaJP\": \"ウォーター・ウォッチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Vigia Aquático\",\n",
+                u8"    \"ruRU\": \"Водяной страж\",\n",
+                u8"    \"zhCN\": \"水域看守水怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3118,\n",
+                u8"    \"Key\": \"StygianWatcherLimb\",\n",
+                u8"    \"enUS\": \"Stygian Watcher\",\n",
+                u8"    \"zhTW\": \"冥河水怪\",\n",
+                u8"    \"deDE\": \"Stygischer Wächter\",\n",
+                u8"    \"esES\": \"Vigía estigio\",\n",
+                u8"    \"frFR\": \"Garde stygien\",\n",
+                u8"    \"itIT\": \"Custode dello Stige\",\n",
+                u8"    \"koKR\": \"저승 감시자\",\n",
+                u8"    \"plPL\": \"Stygijski strażnik\",\n",
+                u8"    \"esMX\": \"Vigía estigio\",\n",
+                u8"    \"jaJP\": \"スティジャン・ウォッチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Vigia Estígio\",\n",
+                u8"    \"ruRU\": \"Стигийский наблюдатель\",\n",
+                u8"    \"zhCN\": \"冥河看守水怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3119,\n",
+                u8"    \"Key\": \"RiverStalkerLimb\",\n",
+                u8"    \"enUS\": \"River Stalker\",\n",
+                u8"    \"zhTW\": \"河流水怪\",\n",
+                u8"    \"deDE\": \"Flussschleiche\",\n",
+                u8"    \"esES\": \"Acechador del río\",\n",
+                u8"    \"frFR\": \"Vagabond des rivières\",\n",
+                u8"    \"itIT\": \"Predatore dei Fiumi\",\n",
+                u8"    \"koKR\": \"강 추적자\",\n",
+                u8"    \"plPL\": \"Wąż rzeczny\",\n",
+                u8"    \"esMX\": \"Acechador fluvial\",\n",
+                u8"    \"jaJP\": \"リバー・ストーカー\",\n",
+                u8"    \"ptBR\": \"[ms]Perseguidor Fluvial\",\n",
+                u8"    \"ruRU\": \"Речной охотник\",\n",
+                u8"    \"zhCN\": \"潜河水怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3120,\n",
+                u8"    \"Key\": \"WaterWatcherLimb\",\n",
+                u8"    \"enUS\": \"Water Watcher\",\n",
+                u8"    \"zhTW\": \"水坑水怪\",\n",
+                u8"    \"deDE\": \"Wasserwächter\",\n",
+                u8"    \"esES\": \"Vigía del agua\",\n",
+                u8"    \"frFR\": \"Gardien des eaux\",\n",
+                u8"    \"itIT\": \"Custode delle Acque\",\n",
+                u8"    \"koKR\": \"물길 망꾼\",\n",
+                u8"    \"plPL\": \"Czerw wodny\",\n",
+                u8"    \"esMX\": \"Vigía acuático\",\n",
+                u8"    \"jaJP\": \"ウォーター・ウォッチャー\",\n",
+                u8"    \"ptBR\": \"[ms]Vigia Aquático\",\n",
+                u8"    \"ruRU\": \"Водяной страж\",\n",
+                u8"    \"zhCN\": \"水域看守水怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3121,\n",
+                u8"    \"Key\": \"NightMarauder\",\n",
+                u8"    \"enUS\": \"Night Marauder\",\n",
+                u8"    \"zhTW\": \"暗夜掠奪者\",\n",
+                u8"    \"deDE\": \"Nachtplünderer\",\n",
+                u8"    \"esES\": \"Maleante de la noche\",\n",
+                u8"    \"frFR\": \"Maraudeur de la nuit\",\n",
+                u8"    \"itIT\": \"Predone della Notte\",\n",
+                u8"    \"koKR\": \"밤의 습격자\",\n",
+                u8"    \"plPL\": \"Nocny maruder\",\n",
+                u8"    \"esMX\": \"Merodeador nocturno\",\n",
+                u8"    \"jaJP\": \"ナイト・マローダー\",\n",
+                u8"    \"ptBR\": \"[ms]Saqueador Noturno\",\n",
+                u8"    \"ruRU\": \"Ночной мародер\",\n",
+                u8"    \"zhCN\": \"黑夜掠夺者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3126,\n",
+                u8"    \"Key\": \"WorldKillerQueen\",\n",
+                u8"    \"enUS\": \"Blood Maggot Queen\",\n",
+                u8"    \"zhTW\": \"鮮血蛆蟲之后\",\n",
+                u8"    \"deDE\": \"Blutwurmkönigin\",\n",
+                u8"    \"esES\": \"Reina de los gusanos de sangre\",\n",
+                u8"    \"frFR\": \"Reine des asticots de sang\",\n",
+                u8"    \"itIT\": \"Larva del Sangue Regina\",\n",
+                u8"    \"koKR\": \"피 구더기 여왕\",\n",
+                u8"    \"plPL\": \"Królowa krwiożerczych larw\",\n",
+                u8"    \"esMX\": \"Reina de las cresas de sangre\",\n",
+                u8"    \"jaJP\": \"血濡れた地虫の女王\",\n",
+                u8"    \"ptBR\": \"[fs]Rainha Verme Sangrenta\",\n",
+                u8"    \"ruRU\": \"Королева кровавых мокриц\",\n",
+                u8"    \"zhCN\": \"血虫后\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3127,\n",
+                u8"    \"Key\": \"GiantLampreyQueen\",\n",
+                u8"    \"enUS\": \"Giant Lamprey Queen\",\n",
+                u8"    \"zhTW\": \"吸血巨蟲之后\",\n",
+                u8"    \"deDE\": \"Riesenmuränenkönigin\",\n",
+                u8"    \"esES\": \"Reina de las lampreas gigantes\",\n",
+                u8"    \"frFR\": \"Reines des lamproies géantes\",\n",
+                u8"    \"itIT\": \"Lampreda Gigante Regina\",\n",
+                u8"    \"koKR\": \"거대 빨판구더기 여왕\",\n",
+                u8"    \"plPL\": \"Królowa skolopendromorfów\",\n",
+                u8"    \"esMX\": \"Reina de las lampreas gigantes\",\n",
+                u8"    \"jaJP\": \"吸血地虫の女王\",\n",
+                u8"    \"ptBR\": \"[fs]Rainha Lampreia Gigante\",\n",
+                u8"    \"ruRU\": \"Королева гигантских жужелиц\",\n",
+                u8"    \"zhCN\": \"巨型八目虫后\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3128,\n",
+                u8"    \"Key\": \"DevourerQueen\",\n",
+                u8"    \"enUS\": \"Devourer Queen\",\n",
+                u8"    \"zhTW\": \"吞噬者之后\",\n",
+                u8"    \"deDE\": \"Verschlingerkönigin\",\n",
+                u8"    \"esES\": \"Reina de los devoradores\",\n",
+                u8"    \"frFR\": \"Reine des dévoreurs\",\n",
+                u8"    \"itIT\": \"Divoratore Regina\",\n",
+                u8"    \"koKR\": \"걸신구더기 여왕\",\n",
+                u8"    \"plPL\": \"Królowa pożeraczy\",\n",
+                u8"    \"esMX\": \"Reina de los devoradores\",\n",
+                u8"    \"jaJP\": \"貪る地虫の女王\",\n",
+                u8"    \"ptBR\": \"[fs]Rainha Devoradora\",\n",
+                u8"    \"ruRU\": \"Королева пожирателей\",\n",
+                u8"    \"zhCN\": \"吞食虫后\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3129,\n",
+                u8"    \"Key\": \"RockWormQueen\",\n",
+                u8"    \"enUS\": \"Rock Worm Queen\",\n",
+                u8"    \"zhTW\": \"鑽岩蛆蟲之后\",\n",
+                u8"    \"deDE\": \"Felswurmkönigin\",\n",
+                u8"    \"esES\": \"Reina de los gusanos de roca\",\n",
+                u8"    \"frFR\": \"Reine des vers des roches\",\n",
+                u8"    \"itIT\": \"Verme di Roccia Regina\",\n",
+                u8"    \"koKR\": \"바위 벌레 여왕\",\n",
+                u8"    \"plPL\": \"Królowa skalnych robaków\",\n",
+                u8"    \"esMX\": \"Reina de los gusanos de piedra\",\n",
+                u8"    \"jaJP\": \"岩棲みの地虫の女王\",\n",
+                u8"    \"ptBR\": \"[fs]Rainha Verme Rochosa\",\n",
+                u8"    \"ruRU\": \"Королева каменных червей\",\n",
+                u8"    \"zhCN\": \"岩虫后\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3130,\n",
+                u8"    \"Key\": \"SandMaggotQueen\",\n",
+                u8"    \"enUS\": \"Sand Maggot Queen\",\n",
+                u8"    \"zhTW\": \"沙漠蛆蟲之后\",\n",
+                u8"    \"deDE\": \"Sandwurmkönigin\",\n",
+                u8"    \"esES\": \"Reina de los gusanos de arena\",\n",
+                u8"    \"frFR\": \"Reine des asticots des sables\",\n",
+                u8"    \"itIT\": \"Larva della Sabbia Regina\",\n",
+                u8"    \"koKR\": \"모래 구더기 여왕\",\n",
+                u8"    \"plPL\": \"Królowa piaseczników\",\n",
+                u8"    \"esMX\": \"Reina de las cresas de arena\",\n",
+                u8"    \"jaJP\": \"砂漠の地虫の女王\",\n",
+                u8"    \"ptBR\": \"[fs]Rainha Verme Arenosa\",\n",
+                u8"    \"ruRU\": \"Королева песчаных мокриц\",\n",
+                u8"    \"zhCN\": \"沙虫后\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3131,\n",
+                u8"    \"Key\": \"Slime Prince\",\n",
+                u8"    \"enUS\": \"Slime Prince\",\n",
+                u8"    \"zhTW\": \"黏液蛙王\",\n",
+                u8"    \"deDE\": \"Schleimprinz\",\n",
+                u8"    \"esES\": \"Príncipe del cieno\",\n",
+                u8"    \"frFR\": \"Prince de la Fange\",\n",
+                u8"    \"itIT\": \"Principe della Melma\",\n",
+                u8"    \"koKR\": \"점액 개구리\",\n",
+                u8"    \"plPL\": \"Książę szlamu\",\n",
+                u8"    \"esMX\": \"Príncipe limoso\",\n",
+                u8"    \"jaJP\": \"粘液ガエル\",\n",
+                u8"    \"ptBR\": \"[ms]Príncipe Viscoso\",\n",
+                u8"    \"ruRU\": \"Хозяин тины\",\n",
+                u8"    \"zhCN\": \"涎液蛙魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3132,\n",
+                u8"    \"Key\": \"Bog Creature\",\n",
+                u8"    \"enUS\": \"Bog Creature\",\n",
+                u8"    \"zhTW\": \"泥沼魔蛙\",\n",
+                u8"    \"deDE\": \"Schlammkreatur\",\n",
+                u8"    \"esES\": \"Criatura del pantano\",\n",
+                u8"    \"frFR\": \"Créature des marais\",\n",
+                u8"    \"itIT\": \"Creatura della Palude\",\n",
+                u8"    \"koKR\": \"수렁 괴물\",\n",
+                u8"    \"plPL\": \"Stwór z bagien\",\n",
+                u8"    \"esMX\": \"Criatura de la ciénaga\",\n",
+                u8"    \"jaJP\": \"沼地の魔物\",\n",
+                u8"    \"ptBR\": \"[fs]Criatura do Pântano\",\n",
+                u8"    \"ruRU\": \"Болотная тварь\",\n",
+                u8"    \"zhCN\": \"泥塘蛙魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3133,\n",
+                u8"    \"Key\": \"Swamp Dweller\",\n",
+                u8"    \"enUS\": \"Swamp Dweller\",\n",
+                u8"    \"zhTW\": \"沼澤魔蛙\",\n",
+                u8"    \"deDE\": \"Sumpfbewohner\",\n",
+                u8"    \"esES\": \"Morador del pantano\",\n",
+                u8"    \"frFR\": \"Habitant des marais\",\n",
+                u8"    \"itIT\": \"Abitante degli Acquitrini\",\n",
+                u8"    \"koKR\": \"늪 괴수\",\n",
+                u8"    \"plPL\": \"Mieszkaniec bagna\",\n",
+                u8"    \"esMX\": \"Morador del pantano\",\n",
+                u8"    \"jaJP\": \"沼棲み\",\n",
+                u8"    \"ptBR\": \"[ms]Habitante do Pântano\",\n",
+                u8"    \"ruRU\": \"Обитатель болот\",\n",
+                u8"    \"zhCN\": \"沼泽蛙魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3134,\n",
+                u8"    \"Key\": \"GiantUrchin\",\n",
+                u8"    \"enUS\": \"Barbed Giant\",\n",
+                u8"    \"zhTW\": \"倒刺巨獸\",\n",
+                u8"    \"deDE\": \"Stachelriese\",\n",
+                u8"    \"esES\": \"Gigante de púas\",\n",
+                u8"    \"frFR\": \"Géant barbu\",\n",
+                u8"    \"itIT\": \"Gigante Barbuto\",\n",
+                u8"    \"koKR\": \"미늘 돋친 괴물\",\n",
+                u8"    \"plPL\": \"Ciernisty gigant\",\n",
+                u8"    \"esMX\": \"Gigante punzante\",\n",
+                u8"    \"jaJP\": \"バーブド・ジャイアント\",\n",
+                u8"    \"ptBR\": \"[ms]Gigante Farpado\",\n",
+                u8"    \"ruRU\": \"Колючий великан\",\n",
+                u8"    \"zhCN\": \"勾刺巨人\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3135,\n",
+                u8"    \"Key\": \"RazorBeast\",\n",
+                u8"    \"enUS\": \"Razor Beast\",\n",
+                u8"    \"zhTW\": \"剃刀獸\",\n",
+                u8"    \"deDE\": \"Klingenbestie\",\n",
+                u8"    \"esES\": \"Bestia afilada\",\n",
+                u8"    \"frFR\": \"Bête tranchante\",\n",
+                u8"    \"itIT\": \"Bestia Rasoio\",\n",
+                u8"    \"koKR\": \"서슬 야수\",\n",
+                u8"    \"plPL\": \"Brzytwobestia\",\n",
+                u8"    \"esMX\": \"Bestia de navajas\",\n",
+                u8"    \"jaJP\": \"レイザー・ビースト\",\n",
+                u8"    \"ptBR\": \"[fs]Fera-navalha\",\n",
+                u8"    \"ruRU\": \"Бритвенный зверь\",\n",
+                u8"    \"zhCN\": \"剃刀兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3136,\n",
+                u8"    \"Key\": \"ThornBrute\",\n",
+                u8"    \"enUS\": \"Thorn Brute\",\n",
+                u8"    \"zhTW\": \"棘刺獸\",\n",
+                u8"    \"deDE\": \"Dornenuntier\",\n",
+                u8"    \"esES\": \"Animal de espinas\",\n",
+                u8"    \"frFR\": \"Brute à épines\",\n",
+                u8"    \"itIT\": \"Bruto Spinoso\",\n",
+                u8"    \"koKR\": \"가시 짐승\",\n",
+                u8"    \"plPL\": \"Cierniowe monstrum\",\n",
+                u8"    \"esMX\": \"Bruto espinoso\",\n",
+                u8"    \"jaJP\": \"ソーン・ブルート\",\n",
+                u8"    \"ptBR\": \"[ms]Bruto Espinhoso\",\n",
+                u8"    \"ruRU\": \"Шипастый изверг\",\n",
+                u8"    \"zhCN\": \"荆棘蛮兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3137,\n",
+                u8"    \"Key\": \"SpikeGiant\",\n",
+                u8"    \"enUS\": \"Spike Giant\",\n",
+                u8"    \"zhTW\": \"尖釘巨獸\",\n",
+                u8"    \"deDE\": \"Dornenriese\",\n",
+                u8"    \"esES\": \"Gigante con pinchos\",\n",
+                u8"    \"frFR\": \"Géant à pointes\",\n",
+                u8"    \"itIT\": \"Gigante Spinoso\",\n",
+                u8"    \"koKR\": \"쐐기 돋친 괴물\",\n",
+                u8"    \"plPL\": \"Kolczasty gigant\",\n",
+                u8"    \"esMX\": \"Gigante espinoso\",\n",
+                u8"    \"jaJP\": \"スパイク・ジャイアント\",\n",
+                u8"    \"ptBR\": \"[ms]Gigante Espinhoso\",\n",
+                u8"    \"ruRU\": \"Шипастый великан\",\n",
+                u8"    \"zhCN\": \"尖刺巨人\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3138,\n",
+                u8"    \"Key\": \"QuillBear\",\n",
+                u8"    \"enUS\": \"Quill Bear\",\n",
+                u8"    \"zhTW\": \"刺熊怪\",\n",
+                u8"    \"deDE\": \"Stachelbär\",\n",
+                u8"    \"esES\": \"Oso con cálamos\",\n",
+                u8"    \"frFR\": \"Ours à piquants\",\n",
+                u8"    \"itIT\": \"Orsospino\",\n",
+                u8"    \"koKR\": \"가시 곰\",\n",
+                u8"    \"plPL\": \"Kolczasty niedźwiedź\",\n",
+                u8"    \"esMX\": \"Oso crampón\",\n",
+                u8"    \"jaJP\": \"クィル・ベアー\",\n",
+                u8"    \"ptBR\": \"[ms]Urso-ouriço\",\n",
+                u8"    \"ruRU\": \"Шипастый медведь\",\n",
+                u8"    \"zhCN\": \"刺脊熊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3139,\n",
+                u8"    \"Key\": \"Council Member\",\n",
+                u8"    \"enUS\": \"Council Member\",\n",
+                u8"    \"zhTW\": \"議會成員\",\n",
+                u8"    \"deDE\": \"Ratsmitglied\",\n",
+                u8"    \"esES\": \"Miembro del consejo\",\n",
+                u8"    \"frFR\": \"Membre du conseil\",\n",
+                u8"    \"itIT\": \"Membro del Concilio\",\n",
+                u8"    \"koKR\": \"의회원\",\n",
+                u8"    \"plPL\": \"Członek Rady\",\n",
+                u8"    \"esMX\": \"Miembro del concilio\",\n",
+                u8"    \"jaJP\": \"評議会員\",\n",
+                u8"    \"ptBR\": \"[ms]Membro do Conselho\",\n",
+                u8"    \"ruRU\": \"Советник\",\n",
+                u8"    \"zhCN\": \"理事会成员\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3140,\n",
+                u8"    \"Key\": \"youngdiablo\",\n",
+                u8"    \"enUS\": \"Dark Wanderer\",\n",
+                u8"    \"zhTW\": \"黑暗流浪者\",\n",
+                u8"    \"deDE\": \"Dunkler Wanderer\",\n",
+                u8"    \"esES\": \"Vagabundo oscuro\",\n",
+                u8"    \"frFR\": \"Rôdeur noir\",\n",
+                u8"    \"itIT\": \"Oscuro Viandante\",\n",
+                u8"    \"koKR\": \"어둠의 방랑자\",\n",
+                u8"    \"plPL\": \"Mroczny Wędrowiec\",\n",
+                u8"    \"esMX\": \"Errante oscuro\",\n",
+                u8"    \"jaJP\": \"黒衣の放浪者\",\n",
+                u8"    \"ptBR\": \"Errante Sombrio\",\n",
+                u8"    \"ruRU\": \"Темный Странник\",\n",
+                u8"    \"zhCN\": \"黑暗流浪者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3141,\n",
+                u8"    \"Key\": \"darkwanderer\",\n",
+                u8"    \"enUS\": \"Dark Wanderer\",\n",
+                u8"    \"zhTW\": \"黑暗流浪者\",\n",
+                u8"    \"deDE\": \"Dunkler Wanderer\",\n",
+                u8"    \"esES\": \"Vagabundo oscuro\",\n",
+                u8"    \"frFR\": \"Rôdeur noir\",\n",
+                u8"    \"itIT\": \"Oscuro Viandante\",\n",
+                u8"    \"koKR\": \"어둠의 방랑자\",\n",
+                u8"    \"plPL\": \"Mroczny Wędrowiec\",\n",
+                u8"    \"esMX\": \"Errante oscuro\",\n",
+                u8"    \"jaJP\": \"黒衣の放浪者\",\n",
+                u8"    \"ptBR\": \"Errante Sombrio\",\n",
+                u8"    \"ruRU\": \"Темный Странник\",\n",
+                u8"    \"zhCN\": \"黑暗流浪者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3142,\n",
+                u8"    \"Key\": \"HellSlinger\",\n",
+                u8"    \"enUS\": \"Hell Slinger\",\n",
+                u8"    \"zhTW\": \"地獄投擲者\",\n",
+                u8"    \"deDE\": \"Höllenschleuderer\",\n",
+                u8"    \"esES\": \"Tirador infernal\",\n",
+                u8"    \"frFR\": \"Frondeur des Enfers\",\n",
+                u8"    \"itIT\": \"Lanciatore Infernale\",\n",
+                u8"    \"koKR\": \"지옥 덫팔매\",\n",
+                u8"    \"plPL\": \"Piekielny miotacz\",\n",
+                u8"    \"esMX\": \"Hondero infernal\",\n",
+                u8"    \"jaJP\": \"ヘル・スリンガー\",\n",
+                u8"    \"ptBR\": \"[ms]Lançador Infernal\",\n",
+                u8"    \"ruRU\": \"Адская пращница\",\n",
+                u8"    \"zhCN\": \"地狱投枪手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3143,\n",
+                u8"    \"Key\": \"NightSlinger\",\n",
+                u8"    \"enUS\": \"Night Slinger\",\n",
+                u8"    \"zhTW\": \"暗夜投擲者\",\n",
+                u8"    \"deDE\": \"Nachtschleuderer\",\n",
+                u8"    \"esES\": \"Tirador nocturno\",\n",
+                u8"    \"frFR\": \"Frondeur de la nuit\",\n",
+                u8"    \"itIT\": \"Lanciatore Notturno\",\n",
+                u8"    \"koKR\": \"밤의 덫팔매\",\n",
+                u8"    \"plPL\": \"Nocny miotacz\",\n",
+                u8"    \"esMX\": \"Hondero nocturno\",\n",
+                u8"    \"jaJP\": \"ナイト・スリンガー\",\n",
+                u8"    \"ptBR\": \"[ms]Lançador Noturno\",\n",
+                u8"    \"ruRU\": \"Ночная пращница\",\n",
+                u8"    \"zhCN\": \"夜幕投枪手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3144,\n",
+                u8"    \"Key\": \"SpearCat\",\n",
+                u8"    \"enUS\": \"Spear Cat\",\n",
+                u8"    \"zhTW\": \"標槍拉庫尼\",\n",
+                u8"    \"deDE\": \"Speerkatze\",\n",
+                u8"    \"esES\": \"Gato lanza\",\n",
+                u8"    \"frFR\": \"Chat harponneur\",\n",
+                u8"    \"itIT\": \"Felino Lanciatore\",\n",
+                u8"    \"koKR\": \"창 고양이\",\n",
+                u8"    \"plPL\": \"Kotołak\",\n",
+                u8"    \"esMX\": \"Gato lancero\",\n",
+                u8"    \"jaJP\": \"スピア・キャット\",\n",
+                u8"    \"ptBR\": \"[ms]Felino Lanceiro\",\n",
+                u8"    \"ruRU\": \"Кошка-копейщица\",\n",
+                u8"    \"zhCN\": \"投枪猫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3145,\n",
+                u8"    \"Key\": \"Slinger\",\n",
+                u8"    \"enUS\": \"Slinger\",\n",
+                u8"    \"zhTW\": \"投擲者\",\n",
+                u8"    \"deDE\": \"Schleuderer\",\n",
+                u8"    \"esES\": \"Tirador\",\n",
+                u8"    \"frFR\": \"Frondeur\",\n",
+                u8"    \"itIT\": \"Lanciatore\",\n",
+                u8"    \"koKR\": \"덫팔매\",\n",
+                u8"    \"plPL\": \"Miotacz\",\n",
+                u8"    \"esMX\": \"Hondero\",\n",
+                u8"    \"jaJP\": \"スリンガー\",\n",
+                u8"    \"ptBR\": \"[ms]Lançador\",\n",
+                u8"    \"ruRU\": \"Пращница\",\n",
+                u8"    \"zhCN\": \"投枪手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3146,\n",
+                u8"    \"Key\": \"FireTower\",\n",
+                u8"    \"enUS\": \"Fire Tower\",\n",
+                u8"    \"zhTW\": \"火焰塔\",\n",
+                u8"    \"deDE\": \"Feuerturm\",\n",
+                u8"    \"esES\": \"Torre de fuego\",\n",
+                u8"    \"frFR\": \"Tour de feu\",\n",
+                u8"    \"itIT\": \"Torre di Fuoco\",\n",
+                u8"    \"koKR\": \"화염 탑\",\n",
+                u8"    \"plPL\": \"Ognista wieża\",\n",
+                u8"    \"esMX\": \"Torre ígnea\",\n",
+                u8"    \"jaJP\": \"火炎の塔\",\n",
+                u8"    \"ptBR\": \"[fs]Torre Ígnea\",\n",
+                u8"    \"ruRU\": \"Огненная башня\",\n",
+                u8"    \"zhCN\": \"火焰塔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3147,\n",
+                u8"    \"Key\": \"LightningSpire\",\n",
+                u8"    \"enUS\": \"Lightning Spire\",\n",
+                u8"    \"zhTW\": \"閃電塔\",\n",
+                u8"    \"deDE\": \"Blitzspitze\",\n",
+                u8"    \"esES\": \"Aguja relámpago\",\n",
+                u8"    \"frFR\": \"Flèche de foudre\",\n",
+                u8"    \"itIT\": \"Guglia Fulminante\",\n",
+                u8"    \"koKR\": \"번개 첨탑\",\n",
+                u8"    \"plPL\": \"Iglica błyskawic\",\n",
+                u8"    \"esMX\": \"Pináculo de relámpagos\",\n",
+                u8"    \"jaJP\": \"雷撃の塔\",\n",
+                u8"    \"ptBR\": \"[fs]Torre Elétrica\",\n",
+                u8"    \"ruRU\": \"Шпиль молний\",\n",
+                u8"    \"zhCN\": \"闪电尖塔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3148,\n",
+                u8"    \"Key\": \"PitLord\",\n",
+                u8"    \"enUS\": \"Pit Lord\",\n",
+                u8"    \"zhTW\": \"獄淵領主\",\n",
+                u8"    \"deDE\": \"Grubenfürst\",\n",
+                u8"    \"esES\": \"Señor del foso\",\n",
+                u8"    \"frFR\": \"Seigneur de la fosse\",\n",
+                u8"    \"itIT\": \"Signore dell'Abisso\",\n",
+                u8"    \"koKR\": \"지옥군주\",\n",
+                u8"    \"plPL\": \"Pan czeluści\",\n",
+                u8"    \"esMX\": \"Señor del foso\",\n",
+                u8"    \"jaJP\": \"ピット・ロード\",\n",
+                u8"    \"ptBR\": \"[ms]Senhor do Fosso\",\n",
+                u8"    \"ruRU\": \"Владыка бездны\",\n",
+                u8"    \"zhCN\": \"深渊领主\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3149,\n",
+                u8"    \"Key\": \"Balrog\",\n",
+                u8"    \"enUS\": \"Balrog\",\n",
+                u8"    \"zhTW\": \"炎魔\",\n",
+                u8"    \"deDE\": \"Balrog\",\n",
+                u8"    \"esES\": \"Balrog\",\n",
+                u8"    \"frFR\": \"Balrog\",\n",
+                u8"    \"itIT\": \"Balrog\",\n",
+                u8"    \"koKR\": \"발록\",\n",
+                u8"    \"plPL\": \"Balrog\",\n",
+                u8"    \"esMX\": \"Balrog\",\n",
+                u8"    \"jaJP\": \"バルログ\",\n",
+                u8"    \"ptBR\": \"[ms]Balrog\",\n",
+                u8"    \"ruRU\": \"Балрог\",\n",
+                u8"    \"zhCN\": \"炎魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3150,\n",
+                u8"    \"Key\": \"VenomLord\",\n",
+                u8"    \"enUS\": \"Venom Lord\",\n",
+                u8"    \"zhTW\": \"毒魔領主\",\n",
+                u8"    \"deDE\": \"Giftfürst\",\n",
+                u8"    \"esES\": \"Señor de la ponzoña\",\n",
+                u8"    \"frFR\": \"Seigneur du venin\",\n",
+                u8"    \"itIT\": \"Signore del Veleno\",\n",
+                u8"    \"koKR\": \"독의 군주\",\n",
+                u8"    \"plPL\": \"Pan jadu\",\n",
+                u8"    \"esMX\": \"Señor de la ponzoña\",\n",
+                u8"    \"jaJP\": \"ヴェノム・ロード\",\n",
+                u8"    \"ptBR\": \"[ms]Senhor do Veneno\",\n",
+                u8"    \"ruRU\": \"Властелин ядов\",\n",
+                u8"    \"zhCN\": \"剧毒领主\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3151,\n",
+                u8"    \"Key\": \"Iron Wolf\",\n",
+                u8"    \"enUS\": \"Iron Wolf\",\n",
+                u8"    \"zhTW\": \"鐵狼衛士\",\n",
+                u8"    \"deDE\": \"Eisenwolf\",\n",
+                u8"    \"esES\": \"Lobo de Hierro\",\n",
+                u8"    \"frFR\": \"Loup de fer\",\n",
+                u8"    \"itIT\": \"Lupo di Ferro\",\n",
+                u8"    \"koKR\": \"강철늑대단원\",\n",
+                u8"    \"plPL\": \"Żelazny Wilk\",\n",
+                u8"    \"esMX\": \"Lobo de Hierro\",\n",
+                u8"    \"jaJP\": \"鉄狼団\",\n",
+                u8"    \"ptBR\": \"Lobo de Ferro\",\n",
+                u8"    \"ruRU\": \"Стальной Волк\",\n",
+                u8"    \"zhCN\": \"铁狼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3152,\n",
+                u8"    \"Key\": \"InvisoSpawner\",\n",
+                u8"    \"enUS\": \"Inviso Spawner\",\n",
+                u8"    \"zhTW\": \"Inviso Spawner\",\n",
+                u8"    \"deDE\": \"Invisoschleimer\",\n",
+                u8"    \"esES\": \"Desovador Inviso\",\n",
+                u8"    \"frFR\": \"Engendreur invisible\",\n",
+                u8"    \"itIT\": \"Inviso Prolificatore\",\n",
+                u8"    \"koKR\": \"투명 생성기\",\n",
+                u8"    \"plPL\": \"Wijostwór\",\n",
+                u8"    \"esMX\": \"Engendradora invisible\",\n",
+                u8"    \"jaJP\": \"インヴィッソ・スポーナー\",\n",
+                u8"    \"ptBR\": \"[fs]Parideira Invisível\",\n",
+                u8"    \"ruRU\": \"Породитель невидимок\",\n",
+                u8"    \"zhCN\": \"Inviso Spawner\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3153,\n",
+                u8"    \"Key\": \"OblivionKnight\",\n",
+                u8"    \"enUS\": \"Oblivion Knight\",\n",
+                u8"    \"zhTW\": \"遺忘騎士\",\n",
+                u8"    \"deDE\": \"Ritter des Vergessens\",\n",
+                u8"    \"esES\": \"Caballero del olvido\",\n",
+                u8"    \"frFR\": \"Chevalier de l’oubli\",\n",
+                u8"    \"itIT\": \"Cavaliere dell'Oblio\",\n",
+                u8"    \"koKR\": \"망각의 기사\",\n",
+                u8"    \"plPL\": \"Rycerz zapomnienia\",\n",
+                u8"    \"esMX\": \"Caballero olvidado\",\n",
+                u8"    \"jaJP\": \"虚無の騎士\",\n",
+                u8"    \"ptBR\": \"[ms]Cavaleiro Soturno\",\n",
+                u8"    \"ruRU\": \"Рыцарь забвения\",\n",
+                u8"    \"zhCN\": \"湮灭骑士\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3154,\n",
+                u8"    \"Key\": \"Mage\",\n",
+                u8"    \"enUS\": \"Mage\",\n",
+                u8"    \"zhTW\": \"法師\",\n",
+                u8"    \"deDE\": \"Magier\",\n",
+                u8"    \"esES\": \"Mago\",\n",
+                u8"    \"frFR\": \"Mage\",\n",
+                u8"    \"itIT\": \"Mago\",\n",
+                u8"    \"koKR\": \"마법학자\",\n",
+                u8"    \"plPL\": \"Mag\",\n",
+                u8"    \"esMX\": \"Mago\",\n",
+                u8"    \"jaJP\": \"メイジ\",\n",
+                u8"    \"ptBR\": \"Mago\",\n",
+                u8"    \"ruRU\": \"Маг\",\n",
+                u8"    \"zhCN\": \"法师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3155,\n",
+                u8"    \"Key\": \"AbyssKnight\",\n",
+                u8"    \"enUS\": \"Abyss Knight\",\n",
+                u8"    \"zhTW\": \"深淵騎士\",\n",
+                u8"    \"deDE\": \"Ritter des Abgrundes\",\n",
+                u8"    \"esES\": \"Caballero del abismo\",\n",
+                u8"    \"frFR\": \"Chevalier des abysses\",\n",
+                u8"    \"itIT\": \"Cavaliere dell'Abisso\",\n",
+                u8"    \"koKR\": \"심연의 기사\",\n",
+                u8"    \"plPL\": \"Rycerz otchłani\",\n",
+                u8"    \"esMX\": \"Caballero abismal\",\n",
+                u8"    \"jaJP\": \"深淵の騎士\",\n",
+                u8"    \"ptBR\": \"[ms]Cavaleiro Abissal\",\n",
+                u8"    \"ruRU\": \"Рыцарь бездны\",\n",
+                u8"    \"zhCN\": \"深渊骑士\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3156,\n",
+                u8"    \"Key\": \"Fighter Mage\",\n",
+                u8"    \"enUS\": \"Fighter Mage\",\n",
+                u8"    \"zhTW\": \"戰士法師\",\n",
+                u8"    \"deDE\": \"Kampfmagier\",\n",
+                u8"    \"esES\": \"Mago luchador\",\n",
+                u8"    \"frFR\": \"Mage combattant\",\n",
+                u8"    \"itIT\": \"Mago Guerriero\",\n",
+                u8"    \"koKR\": \"투사 마술사\",\n",
+                u8"    \"plPL\": \"Mag wojownik\",\n",
+                u8"    \"esMX\": \"Mago luchador\",\n",
+                u8"    \"jaJP\": \"ファイター・メイジ\",\n",
+                u8"    \"ptBR\": \"Mago Guerreiro\",\n",
+                u8"    \"ruRU\": \"Воин-маг\",\n",
+                u8"    \"zhCN\": \"战斗法师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3157,\n",
+                u8"    \"Key\": \"DoomKnight\",\n",
+                u8"    \"enUS\": \"Doom Knight\",\n",
+                u8"    \"zhTW\": \"末日騎士\",\n",
+                u8"    \"deDE\": \"Ritter der Verdammnis\",\n",
+                u8"    \"esES\": \"Caballero de la fatalidad\",\n",
+                u8"    \"frFR\": \"Chevalier funeste\",\n",
+                u8"    \"itIT\": \"Cavaliere della Rovina\",\n",
+                u8"    \"koKR\": \"파멸의 기사\",\n",
+                u8"    \"plPL\": \"Rycerz zagłady\",\n",
+                u8"    \"esMX\": \"Caballero condenado\",\n",
+                u8"    \"jaJP\": \"破滅の騎士\",\n",
+                u8"    \"ptBR\": \"[ms]Cavaleiro da Perdição\",\n",
+                u8"    \"ruRU\": \"Рыцарь рока\",\n",
+                u8"    \"zhCN\": \"末日骑士\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3158,\n",
+                u8"    \"Key\": \"Fighter\",\n",
+                u8"    \"enUS\": \"Fighter\",\n",
+                u8"    \"zhTW\": \"戰士\",\n",
+                u8"    \"deDE\": \"Kämpfer\",\n",
+                u8"    \"esES\": \"Luchador\",\n",
+                u8"    \"frFR\": \"Combattant\",\n",
+                u8"    \"itIT\": \"Guerriero\",\n",
+                u8"    \"koKR\": \"투사\",\n",
+                u8"    \"plPL\": \"Wojownik\",\n",
+                u8"    \"esMX\": \"Luchador\",\n",
+                u8"    \"jaJP\": \"ファイター\",\n",
+                u8"    \"ptBR\": \"Guerreiro\",\n",
+                u8"    \"ruRU\": \"Воин\",\n",
+                u8"    \"zhCN\": \"斗士\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3159,\n",
+                u8"    \"Key\": \"MawFiend\",\n",
+                u8"    \"enUS\": \"Maw Fiend\",\n",
+                u8"    \"zhTW\": \"魔口吐屍怪\",\n",
+                u8"    \"deDE\": \"Teufelsmaul\",\n",
+                u8"    \"esES\": \"Fauces del maligno\",\n",
+                u8"    \"frFR\": \"Démon dégobilleur\",\n",
+                u8"    \"itIT\": \"Fauci Demoniache\",\n",
+                u8"    \"koKR\": \"아귀 마귀\",\n",
+                u8"    \"plPL\": \"Trupożerca\",\n",
+                u8"    \"esMX\": \"Demonio feral\",\n",
+                u8"    \"jaJP\": \"モー・フィーンド\",\n",
+                u8"    \"ptBR\": \"[ms]Demônio da Bocarra\",\n",
+                u8"    \"ruRU\": \"Зеводемон\",\n",
+                u8"    \"zhCN\": \"大胃魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3160,\n",
+                u8"    \"Key\": \"CorpseSpitter\",\n",
+                u8"    \"enUS\": \"Corpse Spitter\",\n",
+                u8"    \"zhTW\": \"吐屍怪\",\n",
+                u8"    \"deDE\": \"Leichenspucker\",\n",
+                u8"    \"esES\": \"Escupecadáveres\",\n",
+                u8"    \"frFR\": \"Cracheur de cadavre\",\n",
+                u8"    \"itIT\": \"Sputacorpi\",\n",
+                u8"    \"koKR\": \"시체 분사자\",\n",
+                u8"    \"plPL\": \"Ścierwopluj\",\n",
+                u8"    \"esMX\": \"Escupecuerpos\",\n",
+                u8"    \"jaJP\": \"コープス・スピッター\",\n",
+                u8"    \"ptBR\": \"[ms]Cospe-cadáver\",\n",
+                u8"    \"ruRU\": \"Исторгатель трупов\",\n",
+                u8"    \"zhCN\": \"吐尸魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3161,\n",
+                u8"    \"Key\": \"Corpulent\",\n",
+                u8"    \"enUS\": \"Corpulent\",\n",
+                u8"    \"zhTW\": \"臃腫吐屍怪\",\n",
+                u8"    \"deDE\": \"Korpulenter\",\n",
+                u8"    \"esES\": \"Corpulento\",\n",
+                u8"    \"frFR\": \"Corpulent\",\n",
+                u8"    \"itIT\": \"Corpulento\",\n",
+                u8"    \"koKR\": \"비대살덩이\",\n",
+                u8"    \"plPL\": \"Rzygacz\",\n",
+                u8"    \"esMX\": \"Corpulento\",\n",
+                u8"    \"jaJP\": \"コルピュラント\",\n",
+                u8"    \"ptBR\": \"[ms]Corpulento\",\n",
+                u8"    \"ruRU\": \"Брюхач\",\n",
+                u8"    \"zhCN\": \"化尸魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3162,\n",
+                u8"    \"Key\": \"StormCaster\",\n",
+                u8"    \"enUS\": \"Storm Caster\",\n",
+                u8"    \"zhTW\": \"暴風施術者\",\n",
+                u8"    \"deDE\": \"Sturmrufer\",\n",
+                u8"    \"esES\": \"Invocador de tormentas\",\n",
+                u8"    \"frFR\": \"Invocateur de tempêtes\",\n",
+                u8"    \"itIT\": \"Lanciatempeste\",\n",
+                u8"    \"koKR\": \"폭풍 주문사\",\n",
+                u8"    \"plPL\": \"Miotacz burzy\",\n",
+                u8"    \"esMX\": \"Lanzatormentas\",\n",
+                u8"    \"jaJP\": \"ストーム・キャスター\",\n",
+                u8"    \"ptBR\": \"[ms]Lança-tempestade\",\n",
+                u8"    \"ruRU\": \"Маг бури\",\n",
+                u8"    \"zhCN\": \"风暴法魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3163,\n",
+                u8"    \"Key\": \"Strangler\",\n",
+                u8"    \"enUS\": \"Strangler\",\n",
+                u8"    \"zhTW\": \"扼殺者\",\n",
+                u8"    \"deDE\": \"Würger\",\n",
+                u8"    \"esES\": \"Estrangulador\",\n",
+                u8"    \"frFR\": \"Étrangleur\",\n",
+                u8"    \"itIT\": \"Strangolatore\",\n",
+                u8"    \"koKR\": \"교살자\",\n",
+                u8"    \"plPL\": \"Dusiciel\",\n",
+                u8"    \"esMX\": \"Estrangulador\",\n",
+                u8"    \"jaJP\": \"ストラングラー\",\n",
+                u8"    \"ptBR\": \"[ms]Estrangulador\",\n",
+                u8"    \"ruRU\": \"Душитель\",\n",
+                u8"    \"zhCN\": \"扼喉法魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3164,\n",
+                u8"    \"Key\": \"Groper\",\n",
+                u8"    \"enUS\": \"Doom Caster\",\n",
+                u8"    \"zhTW\": \"厄運施術者\",\n",
+                u8"    \"deDE\": \"Unheilbringer\",\n",
+                u8"    \"esES\": \"Invocador de la fatalidad\",\n",
+                u8"    \"frFR\": \"Épandeur de sort\",\n",
+                u8"    \"itIT\": \"Lanciarovina\",\n",
+                u8"    \"koKR\": \"파멸 주문사\",\n",
+                u8"    \"plPL\": \"Siewca zagłady\",\n",
+                u8"    \"esMX\": \"Lanzarruina\",\n",
+                u8"    \"jaJP\": \"ドゥーム・キャスター\",\n",
+                u8"    \"ptBR\": \"[ms]Lança-ruína\",\n",
+                u8"    \"ruRU\": \"Маг рока\",\n",
+                u8"    \"zhCN\": \"厄运法魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3165,\n",
+                u8"    \"Key\": \"GrotesqueWyrm\",\n",
+                u8"    \"enUS\": \"Grotesque Wyrm\",\n",
+                u8"    \"zhTW\": \"異魔鬼子\",\n",
+                u8"    \"deDE\": \"Grotesker Lindwurm\",\n",
+                u8"    \"esES\": \"Dragón pequeño grotesco\",\n",
+                u8"    \"frFR\": \"Wyrm grotesque\",\n",
+                u8"    \"itIT\": \"Verme Grottesco\",\n",
+                u8"    \"koKR\": \"기괴살덩이 구렁이\",\n",
+                u8"    \"plPL\": \"Maszkaronowy wij\",\n",
+                u8"    \"esMX\": \"Vermis grotesco\",\n",
+                u8"    \"jaJP\": \"グロテスク・ウィルム\",\n",
+                u8"    \"ptBR\": \"[fs]Serpe Grotesca\",\n",
+                u8"    \"ruRU\": \"Уродливый червь\",\n",
+                u8"    \"zhCN\": \"怪诞肉蛆\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3166,\n",
+                u8"    \"Key\": \"StygianDog\",\n",
+                u8"    \"enUS\": \"Stygian Dog\",\n",
+                u8"    \"zhTW\": \"冥河鬼子\",\n",
+                u8"    \"deDE\": \"Stygischer Hund\",\n",
+                u8"    \"esES\": \"Perro estigio\",\n",
+                u8"    \"frFR\": \"Chien stygien\",\n",
+                u8"    \"itIT\": \"Cane dello Stige\",\n",
+                u8"    \"koKR\": \"저승 개\",\n",
+                u8"    \"plPL\": \"Stygijski robak\",\n",
+                u8"    \"esMX\": \"Cachorro estigio\",\n",
+                u8"    \"jaJP\": \"スティジャン・ドッグ\",\n",
+                u8"    \"ptBR\": \"[ms]Cão Estígio\",\n",
+                u8"    \"ruRU\": \"Стигийская собака\",\n",
+                u8"    \"zhCN\": \"冥河犬\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3167,\n",
+                u8"    \"Key\": \"FleshBeast\",\n",
+                u8"    \"enUS\": \"Flesh Beast\",\n",
+                u8"    \"zhTW\": \"血獸鬼子\",\n",
+                u8"    \"deDE\": \"Fleischbestie\",\n",
+                u8"    \"esES\": \"Bestia de la carne\",\n",
+                u8"    \"frFR\": \"Bête de chair\",\n",
+                u8"    \"itIT\": \"Bestia di Carne\",\n",
+                u8"    \"koKR\": \"살점 야수\",\n",
+                u8"    \"plPL\": \"Bestia trzewi\",\n",
+                u8"    \"esMX\": \"Bestia carnal\",\n",
+                u8"    \"jaJP\": \"フレッシュ・ビースト\",\n",
+                u8"    \"ptBR\": \"Fera Cárnea\",\n",
+                u8"    \"ruRU\": \"Кровавый зверь\",\n",
+                u8"    \"zhCN\": \"血肉兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3168,\n",
+                u8"    \"Key\": \"Grotesque\",\n",
+                u8"    \"enUS\": \"Grotesque\",\n",
+                u8"    \"zhTW\": \"異魔鬼母\",\n",
+                u8"    \"deDE\": \"Grotesker\",\n",
+                u8"    \"esES\": \"Grotesca\",\n",
+                u8"    \"frFR\": \"Grotesque\",\n",
+                u8"    \"itIT\": \"Madre Grottesca\",\n",
+                u8"    \"koKR\": \"기괴살덩이\",\n",
+                u8"    \"plPL\": \"Maszkaron\",\n",
+                u8"    \"esMX\": \"Grotesca\",\n",
+                u8"    \"jaJP\": \"グロテスク\",\n",
+                u8"    \"ptBR\": \"[fs]Grotesca\",\n",
+                u8"    \"ruRU\": \"Макабр\",\n",
+                u8"    \"zhCN\": \"怪诞魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3169,\n",
+                u8"    \"Key\": \"StygianHag\",\n",
+                u8"    \"enUS\": \"Stygian Hag\",\n",
+                u8"    \"zhTW\": \"冥河鬼母\",\n",
+                u8"    \"deDE\": \"Stygische Hexe\",\n",
+                u8"    \"esES\": \"Bruja estigia\",\n",
+                u8"    \"frFR\": \"Mégère stygienne\",\n",
+                u8"    \"itIT\": \"Strega dello Stige\",\n",
+                u8"    \"koKR\": \"저승 노파\",\n",
+                u8"    \"plPL\": \"Stygijska wiedźma\",\n",
+                u8"    \"esMX\": \"Vieja estigia\",\n",
+                u8"    \"jaJP\": \"スティジャン・ハッグ\",\n",
+                u8"    \"ptBR\": \"[fs]Megera Estígia\",\n",
+                u8"    \"ruRU\": \"Стигийская ведьма\",\n",
+                u8"    \"zhCN\": \"冥河母夜叉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3170,\n",
+                u8"    \"Key\": \"FleshSpawner\",\n",
+                u8"    \"enUS\": \"Flesh Spawner\",\n",
+                u8"    \"zhTW\": \"血獸鬼母\",\n",
+                u8"    \"deDE\": \"Fleischschleimer\",\n",
+                u8"    \"esES\": \"Engendradora de la carne\",\n",
+                u8"    \"frFR\": \"Engendreur de chair\",\n",
+                u8"    \"itIT\": \"Generatrice di Carne\",\n",
+                u8"    \"koKR\": \"살점 어미\",\n",
+                u8"    \"plPL\": \"Trzewiostwór\",\n",
+                u8"    \"esMX\": \"Engendradora carnal\",\n",
+                u8"    \"jaJP\": \"フレッシュ・スポーナー\",\n",
+                u8"    \"ptBR\": \"Parideira Cárnea\",\n",
+                u8"    \"ruRU\": \"Породительница плоти\",\n",
+                u8"    \"zhCN\": \"血肉孵化者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3171,\n",
+                u8"    \"Key\": \"RogueScout\",\n",
+                u8"    \"enUS\": \"Rogue Scout\",\n",
+                u8"    \"zhTW\": \"俠盜斥候\",\n",
+                u8"    \"deDE\": \"Jägerinnenspäher\",\n",
+                u8"    \"esES\": \"Arpía exploradora\",\n",
+                u8"    \"frFR\": \"Éclaireuse rogue\",\n",
+                u8"    \"itIT\": \"Scolta Esploratrice\",\n",
+                u8"    \"koKR\": \"도적 정찰병\",\n",
+                u8"    \"plPL\": \"Zwiadowczyni Łotrzyc\",\n",
+                u8"    \"esMX\": \"Exploradora renegada\",\n",
+                u8"    \"jaJP\": \"ローグ・スカウト\",\n",
+                u8"    \"ptBR\": \"[fs]Batedora Renegada\",\n",
+                u8"    \"ruRU\": \"Разбойница-разведчица\",\n",
+                u8"    \"zhCN\": \"流亡者斥候\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3172,\n",
+                u8"    \"Key\": \"BloodWingNest\",\n",
+                u8"    \"enUS\": \"Blood Wing Nest\",\n",
+                u8"    \"zhTW\": \"血翅蚊之巢\",\n",
+                u8"    \"deDE\": \"Blutflügelnest\",\n",
+                u8"    \"esES\": \"Nido de ala sangrienta\",\n",
+                u8"    \"frFR\": \"Nid d’ailes sanglantes\",\n",
+                u8"    \"itIT\": \"Nido di Ala Insanguinata\",\n",
+                u8"    \"koKR\": \"핏빛날개 둥지\",\n",
+                u8"    \"plPL\": \"Gniazdo krwawoskrzydłych\",\n",
+                u8"    \"esMX\": \"Nido de Alas sangrientas\",\n",
+                u8"    \"jaJP\": \"ブラッド・ウィングの巣\",\n",
+                u8"    \"ptBR\": \"[ms]Ninho de Asa Sangrenta\",\n",
+                u8"    \"ruRU\": \"Гнездо кровокрылов\",\n",
+                u8"    \"zhCN\": \"血翼蚊之巢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3173,\n",
+                u8"    \"Key\": \"BloodHookNest\",\n",
+                u8"    \"enUS\": \"Blood Hook Nest\",\n",
+                u8"    \"zhTW\": \"血鉤蚊之巢\",\n",
+                u8"    \"deDE\": \"Bluthakennest\",\n",
+                u8"    \"esES\": \"Nido de garfio sangriento\",\n",
+                u8"    \"frFR\": \"Nid de crochets sanglants\",\n",
+                u8"    \"itIT\": \"Nido di Uncino di Sangue\",\n",
+                u8"    \"koKR\": \"피 갈고리 둥지\",\n",
+                u8"    \"plPL\": \"Gniazdo krwawych szponów\",\n",
+                u8"    \"esMX\": \"Nido de Mosquito sanguinario\",\n",
+                u8"    \"jaJP\": \"ブラッド・フックの巣\",\n",
+                u8"    \"ptBR\": \"[ms]Ninho de Gancho Sangrento\",\n",
+                u8"    \"ruRU\": \"Гнездо кровавых когтей\",\n",
+                u8"    \"zhCN\": \"血钩蚊之巢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3174,\n",
+                u8"    \"Key\": \"FeederNest\",\n",
+                u8"    \"enUS\": \"Feeder Nest\",\n",
+                u8"    \"zhTW\": \"餵血蚊之巢\",\n",
+                u8"    \"deDE\": \"Fressernest\",\n",
+                u8"    \"esES\": \"Nido de comilón\",\n",
+                u8"    \"frFR\": \"Nid de nourricières\",\n",
+                u8"    \"itIT\": \"Nido di Succhiavita\",\n",
+                u8"    \"koKR\": \"피먹이 둥지\",\n",
+                u8"    \"plPL\": \"Gniazdo karmicieli\",\n",
+                u8"    \"esMX\": \"Nido de Devorador alado\",\n",
+                u8"    \"jaJP\": \"フィーダーの巣\",\n",
+                u8"    \"ptBR\": \"[ms]Ninho de Cevador\",\n",
+                u8"    \"ruRU\": \"Гнездо едоков\",\n",
+                u8"    \"zhCN\": \"捕食蚊之巢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3175,\n",
+                u8"    \"Key\": \"SuckerNest\",\n",
+                u8"    \"enUS\": \"Sucker Nest\",\n",
+                u8"    \"zhTW\": \"吸血蚊之巢\",\n",
+                u8"    \"deDE\": \"Saugernest\",\n",
+                u8"    \"esES\": \"Nido de chupóptero\",\n",
+                u8"    \"frFR\": \"Nid de ventouses\",\n",
+                u8"    \"itIT\": \"Nido di Prosciugatore\",\n",
+                u8"    \"koKR\": \"피빨이 둥지\",\n",
+                u8"    \"plPL\": \"Gniazdo pijawek\",\n",
+                u8"    \"esMX\": \"Nido de Succionador\",\n",
+                u8"    \"jaJP\": \"サッカーの巣\",\n",
+                u8"    \"ptBR\": \"[ms]Ninho de Sugador\",\n",
+                u8"    \"ruRU\": \"Гнездо кровососов\",\n",
+                u8"    \"zhCN\": \"吸食蚊之巢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3176,\n",
+                u8"    \"Key\": \"NecroMage\",\n",
+                u8"    \"enUS\": \"Necromage\",\n",
+                u8"    \"zhTW\": \"死靈師\",\n",
+                u8"    \"deDE\": \"Nekromagier\",\n",
+                u8"    \"esES\": \"Nigromago\",\n",
+                u8"    \"frFR\": \"Nécromage\",\n",
+                u8"    \"itIT\": \"Necromago\",\n",
+                u8"    \"koKR\": \"강령 마술사\",\n",
+                u8"    \"plPL\": \"Nekromag\",\n",
+                u8"    \"esMX\": \"Nigromago\",\n",
+                u8"    \"jaJP\": \"ネクロメイジ\",\n",
+                u8"    \"ptBR\": \"[ms]Necromago\",\n",
+                u8"    \"ruRU\": \"Некромаг\",\n",
+                u8"    \"zhCN\": \"死灵法师\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3177,\n",
+                u8"    \"Key\": \"NecroSkeleton\",\n",
+                u8"    \"enUS\": \"Necroskeleton\",\n",
+                u8"    \"zhTW\": \"死靈骷髏\",\n",
+                u8"    \"deDE\": \"Nekroskelett\",\n",
+                u8"    \"esES\": \"Nigroesqueleto\",\n",
+                u8"    \"frFR\": \"Nécrosquelette\",\n",
+                u8"    \"itIT\": \"Necroscheletro\",\n",
+                u8"    \"koKR\": \"강령 해골\",\n",
+                u8"    \"plPL\": \"Nekroszkielet\",\n",
+                u8"    \"esMX\": \"Nigroesqueleto\",\n",
+                u8"    \"jaJP\": \"ネクロスケルトン\",\n",
+                u8"    \"ptBR\": \"[ms]Necroesqueleto\",\n",
+                u8"    \"ruRU\": \"Некроскелет\",\n",
+                u8"    \"zhCN\": \"死灵骷髅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3178,\n",
+                u8"    \"Key\": \"TrappedSoul\",\n",
+                u8"    \"enUS\": \"Trapped Soul\",\n",
+                u8"    \"zhTW\": \"受困的靈魂\",\n",
+                u8"    \"deDE\": \"Gefangene Seele\",\n",
+                u8"    \"esES\": \"Alma atrapada\",\n",
+                u8"    \"frFR\": \"Âme piégée\",\n",
+                u8"    \"itIT\": \"Anima Intrappolata\",\n",
+                u8"    \"koKR\": \"사로잡힌 영혼\",\n",
+                u8"    \"plPL\": \"Uwięziona dusza\",\n",
+                u8"    \"esMX\": \"Alma aprisionada\",\n",
+                u8"    \"jaJP\": \"囚われた魂\",\n",
+                u8"    \"ptBR\": \"[fs]Alma Aprisionada\",\n",
+                u8"    \"ruRU\": \"Пленная душа\",\n",
+                u8"    \"zhCN\": \"被禁锢的灵魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3181,\n",
+                u8"    \"Key\": \"Raises Fetishes\",\n",
+                u8"    \"enUS\": \"Raises Fetishes\",\n",
+                u8"    \"zhTW\": \"復活鬼娃\",\n",
+                u8"    \"deDE\": \"Erweckt Fetische\",\n",
+                u8"    \"esES\": \"Invoca fetiches\",\n",
+                u8"    \"frFR\": \"Invoque des fétiches\",\n",
+                u8"    \"itIT\": \"Rianima Feticci\",\n",
+                u8"    \"koKR\": \"우상족을 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia fetyszy\",\n",
+                u8"    \"esMX\": \"Resucita a los Fetiches\",\n",
+                u8"    \"jaJP\": \"フェティッシュを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive carrancos\",\n",
+                u8"    \"ruRU\": \"Оживляет фетишей\",\n",
+                u8"    \"zhCN\": \"复活鬼娃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3182,\n",
+                u8"    \"Key\": \"Raises Undead\",\n",
+                u8"    \"enUS\": \"Raises Undead\",\n",
+                u8"    \"zhTW\": \"復活不死怪物\",\n",
+                u8"    \"deDE\": \"Erweckt Untote\",\n",
+                u8"    \"esES\": \"Invoca muertos vivientes\",\n",
+                u8"    \"frFR\": \"Crée des morts\",\n",
+                u8"    \"itIT\": \"Rianima Non Morti\",\n",
+                u8"    \"koKR\": \"언데드를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia nieumarłych\",\n",
+                u8"    \"esMX\": \"Resucita a los No muertos\",\n",
+                u8"    \"jaJP\": \"アンデッドを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive mortos-vivos\",\n",
+                u8"    \"ruRU\": \"Оживляет нежить\",\n",
+                u8"    \"zhCN\": \"复活亡灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3183,\n",
+                u8"    \"Key\": \"Lays Eggs\",\n",
+                u8"    \"enUS\": \"Lays Eggs\",\n",
+                u8"    \"zhTW\": \"產卵\",\n",
+                u8"    \"deDE\": \"Legt Eier\",\n",
+                u8"    \"esES\": \"Pone huevos\",\n",
+                u8"    \"frFR\": \"Pond des œufs\",\n",
+                u8"    \"itIT\": \"Depone uova\",\n",
+                u8"    \"koKR\": \"알을 낳음\",\n",
+                u8"    \"plPL\": \"Składa jaja\",\n",
+                u8"    \"esMX\": \"Pone huevos\",\n",
+                u8"    \"jaJP\": \"産卵する\",\n",
+                u8"    \"ptBR\": \"Põe ovos\",\n",
+                u8"    \"ruRU\": \"Откладывает яйца\",\n",
+                u8"    \"zhCN\": \"孵蛋\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3184,\n",
+                u8"    \"Key\": \"Raises Fallen\",\n",
+                u8"    \"enUS\": \"Raises Fallen\",\n",
+                u8"    \"zhTW\": \"復活沉淪魔\",\n",
+                u8"    \"deDE\": \"Erweckt Gefallene\",\n",
+                u8"    \"esES\": \"Invoca caídos\",\n",
+                u8"    \"frFR\": \"Invoque des déchus\",\n",
+                u8"    \"itIT\": \"Rianima Caduti\",\n",
+                u8"    \"koKR\": \"몰락자를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia upadłych\",\n",
+                u8"    \"esMX\": \"Resucita a los Caídos\",\n",
+                u8"    \"jaJP\": \"フォールンを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive decaídos\",\n",
+                u8"    \"ruRU\": \"Оживляет падших\",\n",
+                u8"    \"zhCN\": \"复活沉沦魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3185,\n",
+                u8"    \"Key\": \"heals Zealots and Cantors\",\n",
+                u8"    \"enUS\": \"Heals Others\",\n",
+                u8"    \"zhTW\": \"治療其他同伴\",\n",
+                u8"    \"deDE\": \"Heilt andere\",\n",
+                u8"    \"esES\": \"Cura a otros\",\n",
+                u8"    \"frFR\": \"Soigne les autres\",\n",
+                u8"    \"itIT\": \"Cura gli altri\",\n",
+                u8"    \"koKR\": \"동료 치유\",\n",
+                u8"    \"plPL\": \"Leczy innych\",\n",
+                u8"    \"esMX\": \"Sana a los demás\",\n",
+                u8"    \"jaJP\": \"他のモンスターを回復する\",\n",
+                u8"    \"ptBR\": \"Cura outros\",\n",
+                u8"    \"ruRU\": \"Лекарь\",\n",
+                u8"    \"zhCN\": \"治疗他人\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3186,\n",
+                u8"    \"Key\": \"drains mana and stamina\",\n",
+                u8"    \"enUS\": \"Drains Mana and Stamina\",\n",
+                u8"    \"zhTW\": \"吸取法力和精力\",\n",
+                u8"    \"deDE\": \"Entzieht Mana und Ausdauer\",\n",
+                u8"    \"esES\": \"Drena maná y aguante\",\n",
+                u8"    \"frFR\": \"Draine le mana et l’endurance\",\n",
+                u8"    \"itIT\": \"Risucchia mana e vigore\",\n",
+                u8"    \"koKR\": \"마나와 지구력 흡수\",\n",
+                u8"    \"plPL\": \"Wysysa manę i wytrzymałość\",\n",
+                u8"    \"esMX\": \"Drena maná y vigor\",\n",
+                u8"    \"jaJP\": \"マナとスタミナを奪い取る\",\n",
+                u8"    \"ptBR\": \"Drena mana e vigor\",\n",
+                u8"    \"ruRU\": \"Высасывает ману и выносливость\",\n",
+                u8"    \"zhCN\": \"抽取法力和耐力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3187,\n",
+                u8"    \"Key\": \"drains mana\",\n",
+                u8"    \"enUS\": \"Drains Mana\",\n",
+                u8"    \"zhTW\": \"吸取法力\",\n",
+                u8"    \"deDE\": \"Saugt Mana ab\",\n",
+                u8"    \"esES\": \"Drena maná\",\n",
+                u8"    \"frFR\": \"Draine le mana\",\n",
+                u8"    \"itIT\": \"Risucchia mana\",\n",
+                u8"    \"koKR\": \"마나 흡수\",\n",
+                u8"    \"plPL\": \"Wysysa manę\",\n",
+                u8"    \"esMX\": \"Drena maná\",\n",
+                u8"    \"jaJP\": \"マナを奪い取る\",\n",
+                u8"    \"ptBR\": \"Drena mana\",\n",
+                u8"    \"ruRU\": \"Высасывает ману\",\n",
+                u8"    \"zhCN\": \"抽取法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3188,\n",
+                u8"    \"Key\": \"drains stamina\",\n",
+                u8"    \"enUS\": \"Drains Stamina\",\n",
+                u8"    \"zhTW\": \"吸取精力\",\n",
+                u8"    \"deDE\": \"Saugt Ausdauer ab\",\n",
+                u8"    \"esES\": \"Drena aguante\",\n",
+                u8"    \"frFR\": \"Draine l’endurance\",\n",
+                u8"    \"itIT\": \"Risucchia vigore\",\n",
+                u8"    \"koKR\": \"지구력 흡수\",\n",
+                u8"    \"plPL\": \"Wysysa wytrzymałość\",\n",
+                u8"    \"esMX\": \"Drena vigor\",\n",
+                u8"    \"jaJP\": \"スタミナを奪い取る\",\n",
+                u8"    \"ptBR\": \"Drena vigor\",\n",
+                u8"    \"ruRU\": \"Высасывает выносливость\",\n",
+                u8"    \"zhCN\": \"抽取耐力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3189,\n",
+                u8"    \"Key\": \"stun attack\",\n",
+                u8"    \"enUS\": \"Stun Attack\",\n",
+                u8"    \"zhTW\": \"昏迷攻擊\",\n",
+                u8"    \"deDE\": \"Betäubungsangriff\",\n",
+                u8"    \"esES\": \"Ataque aturdidor\",\n",
+                u8"    \"frFR\": \"Étourdit\",\n",
+                u8"    \"itIT\": \"Attacco stordente\",\n",
+                u8"    \"koKR\": \"기절 공격\",\n",
+                u8"    \"plPL\": \"Ogłuszający atak\",\n",
+                u8"    \"esMX\": \"Ataque de aturdimiento\",\n",
+                u8"    \"jaJP\": \"スタン攻撃\",\n",
+                u8"    \"ptBR\": \"Ataque de atordoamento\",\n",
+                u8"    \"ruRU\": \"Оглушает при атаке\",\n",
+                u8"    \"zhCN\": \"击晕\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3190,\n",
+                u8"    \"Key\": \"eats and spits corspes\",\n",
+                u8"    \"enUS\": \"Eats and Spits Corspes\",\n",
+                u8"    \"zhTW\": \"吞食與吐出屍體\",\n",
+                u8"    \"deDE\": \"Frisst und spuckt Leichen\",\n",
+                u8"    \"esES\": \"Come y escupe cadáveres\",\n",
+                u8"    \"frFR\": \"Mange et crache des cadavres\",\n",
+                u8"    \"itIT\": \"Mangia e sputa cadaveri\",\n",
+                u8"    \"koKR\": \"시체를 먹고 뱉음\",\n",
+                u8"    \"plPL\": \"Pożera zwłoki i nimi pluje\",\n",
+                u8"    \"esMX\": \"Come y escupe cadáveres\",\n",
+                u8"    \"jaJP\": \"死体を食べて吐き出す\",\n",
+                u8"    \"ptBR\": \"Come e cospe cadáveres\",\n",
+                u8"    \"ruRU\": \"Пожирает и извергает трупы\",\n",
+                u8"    \"zhCN\": \"吃吐尸体\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3191,\n",
+                u8"    \"Key\": \"homing missiles\",\n",
+                u8"    \"enUS\": \"Homing Missiles Drain Mana\",\n",
+                u8"    \"zhTW\": \"追蹤飛箭吸取法力\",\n",
+                u8"    \"deDE\": \"Zielsuchende Geschosse entziehen Mana\",\n",
+                u8"    \"esES\": \"Misiles rastreadores que drenan maná\",\n",
+                u8"    \"frFR\": \"Les projectiles drainent le mana\",\n",
+                u8"    \"itIT\": \"Missili a ricerca Risucchia mana\",\n",
+                u8"    \"koKR\": \"유도 투사체 마나 흡수\",\n",
+                u8"    \"plPL\": \"Pociski wysysające manę\",\n",
+                u8"    \"esMX\": \"Los misiles dirigidos drenan maná\",\n",
+                u8"    \"jaJP\": \"追尾する攻撃でマナを奪い取る\",\n",
+                u8"    \"ptBR\": \"Projéteis guiados drenam mana\",\n",
+                u8"    \"ruRU\": \"Самонаводящиеся снаряды, вытягивает ману\",\n",
+                u8"    \"zhCN\": \"追踪飞弹 吸取法力\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3192,\n",
+                u8"    \"Key\": \"raises Stygian Dolls\",\n",
+                u8"    \"enUS\": \"Raises Stygian Dolls\",\n",
+                u8"    \"zhTW\": \"復活冥河鬼娃\",\n",
+                u8"    \"deDE\": \"Erweckt stygische Puppen\",\n",
+                u8"    \"esES\": \"Invoca muñecos estigios\",\n",
+                u8"    \"frFR\": \"Invoque des poupées\",\n",
+                u8"    \"itIT\": \"Rianima Bambole dello Stige\",\n",
+                u8"    \"koKR\": \"저승 꼭두각시를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia stygijczyków\",\n",
+                u8"    \"esMX\": \"Resucita a los Muñecos estigios\",\n",
+                u8"    \"jaJP\": \"スティジャンドールを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive bonecos estígios\",\n",
+                u8"    \"ruRU\": \"Оживляет стигийских кукол\",\n",
+                u8"    \"zhCN\": \"复活冥河娃娃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3193,\n",
+                u8"    \"Key\": \"raises Soul Killers\",\n",
+                u8"    \"enUS\": \"Raises Soul Killers\",\n",
+                u8"    \"zhTW\": \"復活靈魂殺手\",\n",
+                u8"    \"deDE\": \"Erweckt Seelentöter\",\n",
+                u8"    \"esES\": \"Invoca asesinos de almas\",\n",
+                u8"    \"frFR\": \"Invoque des dévoreurs d’âmes\",\n",
+                u8"    \"itIT\": \"Rianima Uccisori di Anime\",\n",
+                u8"    \"koKR\": \"영혼살해자를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia zabójców dusz\",\n",
+                u8"    \"esMX\": \"Resucita a los Asesinos de almas\",\n",
+                u8"    \"jaJP\": \"ソウルキラーを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive mata-almas\",\n",
+                u8"    \"ruRU\": \"Оживляет душегубов\",\n",
+                u8"    \"zhCN\": \"复活灵魂杀手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3194,\n",
+                u8"    \"Key\": \"raises Flayers\",\n",
+                u8"    \"enUS\": \"Raises Flayers\",\n",
+                u8"    \"zhTW\": \"復活剝皮手\",\n",
+                u8"    \"deDE\": \"Erweckt Schinder\",\n",
+                u8"    \"esES\": \"Invoca desolladores\",\n",
+                u8"    \"frFR\": \"Invoque des écorcheurs\",\n",
+                u8"    \"itIT\": \"Rianima Scorticatori\",\n",
+                u8"    \"koKR\": \"약탈자를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia łupieżców\",\n",
+                u8"    \"esMX\": \"Resucita a los Desolladores\",\n",
+                u8"    \"jaJP\": \"フレイヤーを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive esfoladores\",\n",
+                u8"    \"ruRU\": \"Оживляет свежевателей\",\n",
+                u8"    \"zhCN\": \"复活剥皮魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3195,\n",
+                u8"    \"Key\": \"raises Fetishes\",\n",
+                u8"    \"enUS\": \"Raises Fetishes\",\n",
+                u8"    \"zhTW\": \"復活鬼娃\",\n",
+                u8"    \"deDE\": \"Erweckt Fetische\",\n",
+                u8"    \"esES\": \"Invoca fetiches\",\n",
+                u8"    \"frFR\": \"Invoque des fétiches\",\n",
+                u8"    \"itIT\": \"Rianima Feticci\",\n",
+                u8"    \"koKR\": \"우상족을 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia fetyszy\",\n",
+                u8"    \"esMX\": \"Resucita a los Fetiches\",\n",
+                u8"    \"jaJP\": \"フェティッシュを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive carrancos\",\n",
+                u8"    \"ruRU\": \"Оживляет фетишей\",\n",
+                u8"    \"zhCN\": \"复活鬼娃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3196,\n",
+                u8"    \"Key\": \"raises Ratmen\",\n",
+                u8"    \"enUS\": \"Raises Ratmen\",\n",
+                u8"    \"zhTW\": \"復活鼠人\",\n",
+                u8"    \"deDE\": \"Erweckt Rattenmänner\",\n",
+                u8"    \"esES\": \"Invoca hombres rata\",\n",
+                u8"    \"frFR\": \"Invoque des hommes-rats\",\n",
+                u8"    \"itIT\": \"Rianima Uomini Ratto\",\n",
+                u8"    \"koKR\": \"쥐 인간을 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia szczuroczłeków\",\n",
+                u8"    \"esMX\": \"Resucita a los Ratoneros\",\n",
+                u8"    \"jaJP\": \"ラットマンを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive homens-rato\",\n",
+                u8"    \"ruRU\": \"Оживляет крысолюдов\",\n",
+                u8"    \"zhCN\": \"复活鼠人\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3197,\n",
+                u8"    \"Key\": \"steals life\",\n",
+                u8"    \"enUS\": \"Steals Life\",\n",
+                u8"    \"zhTW\": \"生命竊取\",\n",
+                u8"    \"deDE\": \"Stiehlt Leben\",\n",
+                u8"    \"esES\": \"Roba vida\",\n",
+                u8"    \"frFR\": \"Vole de la vie\",\n",
+                u8"    \"itIT\": \"Ruba vita\",\n",
+                u8"    \"koKR\": \"생명력 훔침\",\n",
+                u8"    \"plPL\": \"Kradnie zdrowie\",\n",
+                u8"    \"esMX\": \"Roba vida\",\n",
+                u8"    \"jaJP\": \"ライフを奪う\",\n",
+                u8"    \"ptBR\": \"Rouba pontos de vida\",\n",
+                u8"    \"ruRU\": \"Похищает здоровье\",\n",
+                u8"    \"zhCN\": \"偷取生命\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3198,\n",
+                u8"    \"Key\": \"raises undead\",\n",
+                u8"    \"enUS\": \"Raises Undead\",\n",
+                u8"    \"zhTW\": \"復活不死怪物\",\n",
+                u8"    \"deDE\": \"Erweckt Untote\",\n",
+                u8"    \"esES\": \"Invoca muertos vivientes\",\n",
+                u8"    \"frFR\": \"Crée des morts-vivants\",\n",
+                u8"    \"itIT\": \"Rianima Non Morti\",\n",
+                u8"    \"koKR\": \"언데드를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia nieumarłych\",\n",
+                u8"    \"esMX\": \"Resucita a los no muertos\",\n",
+                u8"    \"jaJP\": \"アンデッドを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive mortos-vivos\",\n",
+                u8"    \"ruRU\": \"Оживляет нежить\",\n",
+                u8"    \"zhCN\": \"复活亡灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3199,\n",
+                u8"    \"Key\": \"raises Dark Ones\",\n",
+                u8"    \"enUS\": \"Raises Dark Ones\",\n",
+                u8"    \"zhTW\": \"復活暗黑沉淪魔\",\n",
+                u8"    \"deDE\": \"Erweckt dunkle Kreaturen\",\n",
+                u8"    \"esES\": \"Invoca oscuros\",\n",
+                u8"    \"frFR\": \"Invoque des sombres\",\n",
+                u8"    \"itIT\": \"Rianima Oscuri\",\n",
+                u8"    \"koKR\": \"어둠의 악마를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia mrocznych\",\n",
+                u8"    \"esMX\": \"Resucita a los Oscuros\",\n",
+                u8"    \"jaJP\": \"ダーク・ワンを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive trevosos\",\n",
+                u8"    \"ruRU\": \"Оживляет темных\",\n",
+                u8"    \"zhCN\": \"复活暗魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3200,\n",
+                u8"    \"Key\": \"raises Devilkin\",\n",
+                u8"    \"enUS\": \"Raises Devilkin\",\n",
+                u8"    \"zhTW\": \"復活魔妖沉淪魔\",\n",
+                u8"    \"deDE\": \"Erweckt Teufelskreaturen\",\n",
+                u8"    \"esES\": \"Invoca diabólicos\",\n",
+                u8"    \"frFR\": \"Invoque des démonoïdes\",\n",
+                u8"    \"itIT\": \"Rianima Malefici\",\n",
+                u8"    \"koKR\": \"악마피붙이를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia diabliki\",\n",
+                u8"    \"esMX\": \"Resucita a los Demonantes\",\n",
+                u8"    \"jaJP\": \"デビルキンを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive demonantes\",\n",
+                u8"    \"ruRU\": \"Оживляет дьяволят\",\n",
+                u8"    \"zhCN\": \"复活小恶魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3201,\n",
+                u8"    \"Key\": \"raises Carvers\",\n",
+                u8"    \"enUS\": \"Raises Carvers\",\n",
+                u8"    \"zhTW\": \"復活刨肉沉淪魔\",\n",
+                u8"    \"deDE\": \"Erweckt Schlächter\",\n",
+                u8"    \"esES\": \"Invoca trinchantes\",\n",
+                u8"    \"frFR\": \"Invoque des équarrisseurs\",\n",
+                u8"    \"itIT\": \"Rianima Incisori\",\n",
+                u8"    \"koKR\": \"도륙자를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia wycinaczy\",\n",
+                u8"    \"esMX\": \"Resucita a los Talladores\",\n",
+                u8"    \"jaJP\": \"カーヴァーを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive entalhadores\",\n",
+                u8"    \"ruRU\": \"Оживляет плоторезов\",\n",
+                u8"    \"zhCN\": \"复活利刃魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3202,\n",
+                u8"    \"Key\": \"raises Fallen\",\n",
+                u8"    \"enUS\": \"Raises Fallen\",\n",
+                u8"    \"zhTW\": \"復活沉淪魔\",\n",
+                u8"    \"deDE\": \"Erweckt Gefallene\",\n",
+                u8"    \"esES\": \"Invoca caídos\",\n",
+                u8"    \"frFR\": \"Invoque des déchus\",\n",
+                u8"    \"itIT\": \"Rianima Caduti\",\n",
+                u8"    \"koKR\": \"몰락자를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia upadłych\",\n",
+                u8"    \"esMX\": \"Resucita a los Caídos\",\n",
+                u8"    \"jaJP\": \"フォールンを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive decaídos\",\n",
+                u8"    \"ruRU\": \"Оживляет падших\",\n",
+                u8"    \"zhCN\": \"复活沉沦魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3203,\n",
+                u8"    \"Key\": \"raises Warped Fallen\",\n",
+                u8"    \"enUS\": \"Raises The Warped\",\n",
+                u8"    \"zhTW\": \"復活扭曲沉淪魔\",\n",
+                u8"    \"deDE\": \"Erweckt die Verdrehten\",\n",
+                u8"    \"esES\": \"Invoca retorcidos\",\n",
+                u8"    \"frFR\": \"Invoque le Perverti\",\n",
+                u8"    \"itIT\": \"Rianima Deformi\",\n",
+                u8"    \"koKR\": \"뒤틀린 악마를 되살림\",\n",
+                u8"    \"plPL\": \"Ożywia spaczeńców\",\n",
+                u8"    \"esMX\": \"Resucita a los Retorcidos\",\n",
+                u8"    \"jaJP\": \"ウォープト・ワンを復活させる\",\n",
+                u8"    \"ptBR\": \"Revive distorcidos\",\n",
+                u8"    \"ruRU\": \"Оживляет искаженных\",\n",
+                u8"    \"zhCN\": \"复活扭曲魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3204,\n",
+                u8"    \"Key\": \"shocking hit\",\n",
+                u8"    \"enUS\": \"shocking hit\",\n",
+                u8"    \"zhTW\": \"放電攻擊\",\n",
+                u8"    \"deDE\": \"Schockangriff\",\n",
+                u8"    \"esES\": \"Golpe eléctrico\",\n",
+                u8"    \"frFR\": \"Choc électrique\",\n",
+                u8"    \"itIT\": \"Colpo fulminante\",\n",
+                u8"    \"koKR\": \"감전 공격\",\n",
+                u8"    \"plPL\": \"Porażające uderzenie\",\n",
+                u8"    \"esMX\": \"Golpe eléctrico\",\n",
+                u8"    \"jaJP\": \"電撃攻撃\",\n",
+                u8"    \"ptBR\": \"acerto elétrico\",\n",
+                u8"    \"ruRU\": \"Шокирующий удар\",\n",
+                u8"    \"zhCN\": \"闪电打击\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3205,\n",
+                u8"    \"Key\": \"uniquextrastrong\",\n",
+                u8"    \"enUS\": \"Extra Strong\",\n",
+                u8"    \"zhTW\": \"特別強壯\",\n",
+                u8"    \"deDE\": \"Extra stark\",\n",
+                u8"    \"esES\": \"Extrafuerte\",\n",
+                u8"    \"frFR\": \"Très fort\",\n",
+                u8"    \"itIT\": \"Forza extra\",\n",
+                u8"    \"koKR\": \"매우 강함\",\n",
+                u8"    \"plPL\": \"Wyjątkowa siła\",\n",
+                u8"    \"esMX\": \"Extra fuerte\",\n",
+                u8"    \"jaJP\": \"屈強\",\n",
+                u8"    \"ptBR\": \"Extraforte\",\n",
+                u8"    \"ruRU\": \"Сверхсила\",\n",
+                u8"    \"zhCN\": \"额外强壮\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3206,\n",
+                u8"    \"Key\": \"uniqueextrafast\",\n",
+                u8"    \"enUS\": \"Extra Fast\",\n",
+                u8"    \"zhTW\": \"特別快速\",\n",
+                u8"    \"deDE\": \"Extra schnell\",\n",
+                u8"    \"esES\": \"Extrarrápido\",\n",
+                u8"    \"frFR\": \"Très rapide\",\n",
+                u8"    \"itIT\": \"Velocità extra\",\n",
+                u8"    \"koKR\": \"매우 빠름\",\n",
+                u8"    \"plPL\": \"Wyjątkowa szybkość\",\n",
+                u8"    \"esMX\": \"Extra rápido\",\n",
+                u8"    \"jaJP\": \"俊敏\",\n",
+                u8"    \"ptBR\": \"Extrarrápido\",\n",
+                u8"    \"ruRU\": \"Стремительность\",\n",
+                u8"    \"zhCN\": \"额外快速\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3207,\n",
+                u8"    \"Key\": \"uniquecursed\",\n",
+                u8"    \"enUS\": \"Cursed\",\n",
+                u8"    \"zhTW\": \"施加詛咒\",\n",
+                u8"    \"deDE\": \"Verflucht\",\n",
+                u8"    \"esES\": \"Maldito\",\n",
+                u8"    \"frFR\": \"Maudit\",\n",
+                u8"    \"itIT\": \"Anatemi\",\n",
+                u8"    \"koKR\": \"저주받음\",\n",
+                u8"    \"plPL\": \"Przekleństwo\",\n",
+                u8"    \"esMX\": \"Maldecido\",\n",
+                u8"    \"jaJP\": \"呪い\",\n",
+                u8"    \"ptBR\": \"Amaldiçoado\",\n",
+                u8"    \"ruRU\": \"Проклятие\",\n",
+                u8"    \"zhCN\": \"诅咒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3208,\n",
+                u8"    \"Key\": \"uniquemagicresistance\",\n",
+                u8"    \"enUS\": \"Magic Resistant\",\n",
+                u8"    \"zhTW\": \"魔法抗性\",\n",
+                u8"    \"deDE\": \"Magieresistent\",\n",
+                u8"    \"esES\": \"Resistencia a la magia\",\n",
+                u8"    \"frFR\": \"Résiste à la magie\",\n",
+                u8"    \"itIT\": \"Resistenza magica\",\n",
+                u8"    \"koKR\": \"마법 저항\",\n",
+                u8"    \"plPL\": \"Odporność na magię\",\n",
+                u8"    \"esMX\": \"Resistente a la magia\",\n",
+                u8"    \"jaJP\": \"魔法耐性\",\n",
+                u8"    \"ptBR\": \"Resistente a Magia\",\n",
+                u8"    \"ruRU\": \"Сопротивление магии\",\n",
+                u8"    \"zhCN\": \"魔法抵抗\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3209,\n",
+                u8"    \"Key\": \"uniquefireenchanted\",\n",
+                u8"    \"enUS\": \"Fire Enchanted\",\n",
+                u8"    \"zhTW\": \"火焰強化\",\n",
+                u8"    \"deDE\": \"Feuerverzauberung\",\n",
+                u8"    \"esES\": \"Encantamiento de fuego\",\n",
+                u8"    \"frFR\": \"Enchanté par le feu\",\n",
+                u8"    \"itIT\": \"Ardente\",\n",
+                u8"    \"koKR\": \"화염 강화\",\n",
+                u8"    \"plPL\": \"Zaklęty ogień\",\n",
+                u8"    \"esMX\": \"Daño de fuego\",\n",
+                u8"    \"jaJP\": \"火炎強化\",\n",
+                u8"    \"ptBR\": \"Encantamento Ígneo\",\n",
+                u8"    \"ruRU\": \"Чары огня\",\n",
+                u8"    \"zhCN\": \"火焰强化\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3210,\n",
+                u8"    \"Key\": \"monsteruniqueprop1\",\n",
+                u8"    \"enUS\": \"Cold Enchanted\",\n",
+                u8"    \"zhTW\": \"冰寒強化\",\n",
+                u8"    \"deDE\": \"Kälteverzauberung\",\n",
+                u8"    \"esES\": \"Encantamiento de frío\",\n",
+                u8"    \"frFR\": \"Enchanté par le froid\",\n",
+                u8"    \"itIT\": \"Congelante\",\n",
+                u8"    \"koKR\": \"냉기 강화\",\n",
+                u8"    \"plPL\": \"Zaklęte zimno\",\n",
+                u8"    \"esMX\": \"Daño de frío\",\n",
+                u8"    \"jaJP\": \"冷気強化\",\n",
+                u8"    \"ptBR\": \"Encantamento Gélido\",\n",
+                u8"    \"ruRU\": \"Чары льда\",\n",
+                u8"    \"zhCN\": \"冰霜强化\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3211,\n",
+                u8"    \"Key\": \"monsteruniqueprop2\",\n",
+                u8"    \"enUS\": \"Lightning Enchanted\",\n",
+                u8"    \"zhTW\": \"電擊強化\",\n",
+                u8"    \"deDE\": \"Blitzverzauberung\",\n",
+                u8"    \"esES\": \"Encantamiento de rayos\",\n",
+                u8"    \"frFR\": \"Enchanté par la foudre\",\n",
+                u8"    \"itIT\": \"Fulminante\",\n",
+                u8"    \"koKR\": \"번개 강화\",\n",
+                u8"    \"plPL\": \"Zaklęte błyskawice\",\n",
+                u8"    \"esMX\": \"Daño de rayo\",\n",
+                u8"    \"jaJP\": \"電撃強化\",\n",
+                u8"    \"ptBR\": \"Encantamento Elétrico\",\n",
+                u8"    \"ruRU\": \"Чары молнии\",\n",
+                u8"    \"zhCN\": \"闪电强化\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3212,\n",
+                u8"    \"Key\": \"monsteruniqueprop3\",\n",
+                u8"    \"enUS\": \"Mana Burn\",\n",
+                u8"    \"zhTW\": \"法力燃燒\",\n",
+                u8"    \"deDE\": \"Manaverbrennung\",\n",
+                u8"    \"esES\": \"Quemadura de maná\",\n",
+                u8"    \"frFR\": \"Brûlure de mana\",\n",
+                u8"    \"itIT\": \"Consuma mana\",\n",
+                u8"    \"koKR\": \"마나 연소\",\n",
+                u8"    \"plPL\": \"Spalanie many\",\n",
+                u8"    \"esMX\": \"Quemadura de maná\",\n",
+                u8"    \"jaJP\": \"マナダメージ\",\n",
+                u8"    \"ptBR\": \"Exaustão de Mana\",\n",
+                u8"    \"ruRU\": \"Сожжение маны\",\n",
+                u8"    \"zhCN\": \"法力燃烧\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3213,\n",
+                u8"    \"Key\": \"monsteruniqueprop4\",\n",
+                u8"    \"enUS\": \"Spectral Hit\",\n",
+                u8"    \"zhTW\": \"灌能打擊\",\n",
+                u8"    \"deDE\": \"Spektralschlag\",\n",
+                u8"    \"esES\": \"Golpe espectral\",\n",
+                u8"    \"frFR\": \"Choc spectral\",\n",
+                u8"    \"itIT\": \"Colpo spettrale\",\n",
+                u8"    \"koKR\": \"혼령 공격\",\n",
+                u8"    \"plPL\": \"Widmowe uderzenie\",\n",
+                u8"    \"esMX\": \"Golpe espectral\",\n",
+                u8"    \"jaJP\": \"スペクトラルヒット\",\n",
+                u8"    \"ptBR\": \"Golpe Espectral\",\n",
+                u8"    \"ruRU\": \"Призрачный удар\",\n",
+                u8"    \"zhCN\": \"鬼魂打击\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3215,\n",
+                u8"    \"Key\": \"monsteruniqueprop6\",\n",
+                u8"    \"enUS\": \"Stone Skin\",\n",
+                u8"    \"zhTW\": \"硬化外皮\",\n",
+                u8"    \"deDE\": \"Steinhaut\",\n",
+                u8"    \"esES\": \"Piel pétrea\",\n",
+                u8"    \"frFR\": \"Peau de pierre\",\n",
+                u8"    \"itIT\": \"Pelle di pietra\",\n",
+                u8"    \"koKR\": \"돌가죽\",\n",
+                u8"    \"plPL\": \"Kamienna skóra\",\n",
+                u8"    \"esMX\": \"Piel pétrea\",\n",
+                u8"    \"jaJP\": \"ストーンスキン\",\n",
+                u8"    \"ptBR\": \"Pele de Pedra\",\n",
+                u8"    \"ruRU\": \"Каменная кожа\",\n",
+                u8"    \"zhCN\": \"石肤术\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3216,\n",
+                u8"    \"Key\": \"monsteruniqueprop7\",\n",
+                u8"    \"enUS\": \"Multiple Shots\",\n",
+                u8"    \"zhTW\": \"多重射擊\",\n",
+                u8"    \"deDE\": \"Mehrfachschüsse\",\n",
+                u8"    \"esES\": \"Disparos múltiples\",\n",
+                u8"    \"frFR\": \"Tirs multiples\",\n",
+                u8"    \"itIT\": \"Tiro multiplo\",\n",
+                u8"    \"koKR\": \"다발 사격\",\n",
+                u8"    \"plPL\": \"Seria pocisków\",\n",
+                u8"    \"esMX\": \"Disparos múltiples\",\n",
+                u8"    \"jaJP\": \"一斉射撃\",\n",
+                u8"    \"ptBR\": \"Disparos Múltiplos\",\n",
+                u8"    \"ruRU\": \"Залп\",\n",
+                u8"    \"zhCN\": \"多重射击\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3217,\n",
+                u8"    \"Key\": \"monsteruniqueprop8\",\n",
+                u8"    \"enUS\": \"Thief\",\n",
+                u8"    \"zhTW\": \"偷盜\",\n",
+                u8"    \"deDE\": \"Dieb\",\n",
+                u8"    \"esES\": \"Ladrón\",\n",
+                u8"    \"frFR\": \"Voleur\",\n",
+                u8"    \"itIT\": \"Ladro\",\n",
+                u8"    \"koKR\": \"도둑\",\n",
+                u8"    \"plPL\": \"Złodziej\",\n",
+                u8"    \"esMX\": \"Ladrón\",\n",
+                u8"    \"jaJP\": \"盗賊\",\n",
+                u8"    \"ptBR\": \"Ladrão\",\n",
+                u8"    \"ruRU\": \"Вор\",\n",
+                u8"    \"zhCN\": \"偷窃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3218,\n",
+                u8"    \"Key\": \"monsteruniqueprop9\",\n",
+                u8"    \"enUS\": \"Aura Enchanted\",\n",
+                u8"    \"zhTW\": \"靈氣強化\",\n",
+                u8"    \"deDE\": \"verzauberte Aura\",\n",
+                u8"    \"esES\": \"Encantamiento de aura\",\n",
+                u8"    \"frFR\": \"Enchanté par l’aura\",\n",
+                u8"    \"itIT\": \"Aura incantata\",\n",
+                u8"    \"koKR\": \"오라 강화\",\n",
+                u8"    \"plPL\": \"Zaklęta aura\",\n",
+                u8"    \"esMX\": \"Encantado con aura\",\n",
+                u8"    \"jaJP\": \"オーラ強化\",\n",
+                u8"    \"ptBR\": \"Encantamento de Aura\",\n",
+                u8"    \"ruRU\": \"Зачарованная аура\",\n",
+                u8"    \"zhCN\": \"光环强化\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3219,\n",
+                u8"    \"Key\": \"This Cow Bites\",\n",
+                u8"    \"enUS\": \"This Cow Bites\",\n",
+                u8"    \"zhTW\": \"這頭牛會咬人\",\n",
+                u8"    \"deDE\": \"Diese Kuh beißt\",\n",
+                u8"    \"esES\": \"Esta vaca muerde\",\n",
+                u8"    \"frFR\": \"Cette vache mord\",\n",
+                u8"    \"itIT\": \"Questa mucca morde\",\n",
+                u8"    \"koKR\": \"물어뜯는 공격\",\n",
+                u8"    \"plPL\": \"Ta krowa gryzie\",\n",
+                u8"    \"esMX\": \"Esta vaca muerde\",\n",
+                u8"    \"jaJP\": \"噛みつきに注意！\",\n",
+                u8"    \"ptBR\": \"Esta vaca morde\",\n",
+                u8"    \"ruRU\": \"Эта корова кусается\",\n",
+                u8"    \"zhCN\": \"这头奶牛咬人\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3221,\n",
+                u8"    \"Key\": \"minion\",\n",
+                u8"    \"enUS\": \"Minion\",\n",
+                u8"    \"zhTW\": \"僕從\",\n",
+                u8"    \"deDE\": \"Diener\",\n",
+                u8"    \"esES\": \"Esbirro\",\n",
+                u8"    \"frFR\": \"Serviteur\",\n",
+                u8"    \"itIT\": \"Servo\",\n",
+                u8"    \"koKR\": \"하수인\",\n",
+                u8"    \"plPL\": \"Sługa\",\n",
+                u8"    \"esMX\": \"Esbirro\",\n",
+                u8"    \"jaJP\": \"ミニオン\",\n",
+                u8"    \"ptBR\": \"Lacaio\",\n",
+                u8"    \"ruRU\": \"Прислужник\",\n",
+                u8"    \"zhCN\": \"爪牙\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3246,\n",
+                u8"    \"Key\": \"MummyGenerator\",\n",
+                u8"    \"enUS\": \"Mummy Sarcophagus\",\n",
+                u8"    \"zhTW\": \"木乃伊石棺\",\n",
+                u8"    \"deDE\": \"Mumiensarkophag\",\n",
+                u8"    \"esES\": \"Sarcófago de momias\",\n",
+                u8"    \"frFR\": \"Sarcophage de momie\",\n",
+                u8"    \"itIT\": \"Sarcofago della Mummia\",\n",
+                u8"    \"koKR\": \"미라 석관\",\n",
+                u8"    \"plPL\": \"Sarkofag mumii\",\n",
+                u8"    \"esMX\": \"Sarcófago\",\n",
+                u8"    \"jaJP\": \"ミイラの棺\",\n",
+                u8"    \"ptBR\": \"[ms]Sarcófago da Múmia\",\n",
+                u8"    \"ruRU\": \"Саркофаг мумии\",\n",
+                u8"    \"zhCN\": \"木乃伊石棺\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3283,\n",
+                u8"    \"Key\": \"skeleton\",\n",
+                u8"    \"enUS\": \"Skeleton\",\n",
+                u8"    \"zhTW\": \"骷髏\",\n",
+                u8"    \"deDE\": \"Skelettkrieger\",\n",
+                u8"    \"esES\": \"Esqueleto\",\n",
+                u8"    \"frFR\": \"Squelette\",\n",
+                u8"    \"itIT\": \"Scheletro\",\n",
+                u8"    \"koKR\": \"해골\",\n",
+                u8"    \"plPL\": \"Szkielet\",\n",
+                u8"    \"esMX\": \"Esqueleto\",\n",
+                u8"    \"jaJP\": \"スケルトン\",\n",
+                u8"    \"ptBR\": \"[ms]Esqueleto\",\n",
+                u8"    \"ruRU\": \"Скелет\",\n",
+                u8"    \"zhCN\": \"骷髅\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3319,\n",
+                u8"    \"Key\": \"Corpsefire\",\n",
+                u8"    \"enUS\": \"Corpsefire\",\n",
+                u8"    \"zhTW\": \"屍火\",\n",
+                u8"    \"deDE\": \"Totenfeuer\",\n",
+                u8"    \"esES\": \"Fuego de Cadáveres\",\n",
+                u8"    \"frFR\": \"Crémation\",\n",
+                u8"    \"itIT\": \"Cadavere Infuocato\",\n",
+                u8"    \"koKR\": \"불타는 시체\",\n",
+                u8"    \"plPL\": \"Gorejący Trup\",\n",
+                u8"    \"esMX\": \"Cadáver ardiente\",\n",
+                u8"    \"jaJP\": \"コープス・ファイア\",\n",
+                u8"    \"ptBR\": \"Flamorto\",\n",
+                u8"    \"ruRU\": \"Пылающий труп\",\n",
+                u8"    \"zhCN\": \"尸体发火\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10002,\n",
+                u8"    \"Key\": \"Mauler\",\n",
+                u8"    \"enUS\": \"Mauler\",\n",
+                u8"    \"zhTW\": \"重擊巨怪\",\n",
+                u8"    \"deDE\": \"Schläger\",\n",
+                u8"    \"esES\": \"Vapuleador\",\n",
+                u8"    \"frFR\": \"Marteleur\",\n",
+                u8"    \"itIT\": \"Distruttore\",\n",
+                u8"    \"koKR\": \"망치주먹\",\n",
+                u8"    \"plPL\": \"Oprawca\",\n",
+                u8"    \"esMX\": \"Mutilador\",\n",
+                u8"    \"jaJP\": \"モーラー\",\n",
+                u8"    \"ptBR\": \"[ms]Marretador\",\n",
+                u8"    \"ruRU\": \"Мучитель\",\n",
+                u8"    \"zhCN\": \"巨槌魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10077,\n",
+                u8"    \"Key\": \"UndeadDescriptX\",\n",
+                u8"    \"enUS\": \"Undead\",\n",
+                u8"    \"zhTW\": \"不死怪物\",\n",
+                u8"    \"deDE\": \"Untoter\",\n",
+                u8"    \"esES\": \"Muerto viviente\",\n",
+                u8"    \"frFR\": \"Mort-vivant\",\n",
+                u8"    \"itIT\": \"Non morto\",\n",
+                u8"    \"koKR\": \"언데드\",\n",
+                u8"    \"plPL\": \"Nieumarły\",\n",
+                u8"    \"esMX\": \"No muerto\",\n",
+                u8"    \"jaJP\": \"＜アンデッド＞\",\n",
+                u8"    \"ptBR\": \"Morto-vivo\",\n",
+                u8"    \"ruRU\": \"Нежить\",\n",
+                u8"    \"zhCN\": \"亡灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10078,\n",
+                u8"    \"Key\": \"DemonID\",\n",
+                u8"    \"enUS\": \"Demon\",\n",
+                u8"    \"zhTW\": \"惡魔\",\n",
+                u8"    \"deDE\": \"Dämon\",\n",
+                u8"    \"esES\": \"Demonio\",\n",
+                u8"    \"frFR\": \"Démon\",\n",
+                u8"    \"itIT\": \"Demone\",\n",
+                u8"    \"koKR\": \"악마\",\n",
+                u8"    \"plPL\": \"Demon\",\n",
+                u8"    \"esMX\": \"Demonio\",\n",
+                u8"    \"jaJP\": \"＜デーモン＞\",\n",
+                u8"    \"ptBR\": \"Demônio\",\n",
+                u8"    \"ruRU\": \"Демон\",\n",
+                u8"    \"zhCN\": \"恶魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10908,\n",
+                u8"    \"Key\": \"DarkStalker\",\n",
+                u8"    \"enUS\": \"Dark Stalker\",\n",
+                u8"    \"zhTW\": \"黑暗潛襲者\",\n",
+                u8"    \"deDE\": \"Dunkle Schleicherin\",\n",
+                u8"    \"esES\": \"Acechadora de la oscuridad\",\n",
+                u8"    \"frFR\": \"Vagabond sombre\",\n",
+                u8"    \"itIT\": \"Predatrice Oscura\",\n",
+                u8"    \"koKR\": \"어둠의 추적자\",\n",
+                u8"    \"plPL\": \"Mroczna tropicielka\",\n",
+                u8"    \"esMX\": \"Acechadora oscura\",\n",
+                u8"    \"jaJP\": \"闇の追跡者\",\n",
+                u8"    \"ptBR\": \"[fs]Perseguidora Sombria\",\n",
+                u8"    \"ruRU\": \"Темная следопытка\",\n",
+                u8"    \"zhCN\": \"黑暗偷袭者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 10909,\n",
+                u8"    \"Key\": \"VileArcher\",\n",
+                u8"    \"enUS\": \"Vile Archer\",\n",
+                u8"    \"zhTW\": \"兇邪弓箭手\",\n",
+                u8"    \"deDE\": \"Böse Bogenschützin\",\n",
+                u8"    \"esES\": \"Arquera vil\",\n",
+                u8"    \"frFR\": \"Archère inhumaine\",\n",
+                u8"    \"itIT\": \"Arciera Vile\",\n",
+                u8"    \"koKR\": \"끔찍한 궁수\",\n",
+                u8"    \"plPL\": \"Nikczemna łuczniczka\",\n",
+                u8"    \"esMX\": \"Arquera vil\",\n",
+                u8"    \"jaJP\": \"穢れし弓使い\",\n",
+                u8"    \"ptBR\": \"[fs]Arqueira Vil\",\n",
+                u8"    \"ruRU\": \"Злобная лучница\",\n",
+                u8"    \"zhCN\": \"邪恶弓手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11007,\n",
+                u8"    \"Key\": \"TrappDoor\",\n",
+                u8"    \"enUS\": \"Trap Door\",\n",
+                u8"    \"zhTW\": \"暗門\",\n",
+                u8"    \"deDE\": \"Falltür\",\n",
+                u8"    \"esES\": \"Trampilla\",\n",
+                u8"    \"frFR\": \"Trappe\",\n",
+                u8"    \"itIT\": \"Botola\",\n",
+                u8"    \"koKR\": \"함정 문\",\n",
+                u8"    \"plPL\": \"Klapa\",\n",
+                u8"    \"esMX\": \"Trampilla\",\n",
+                u8"    \"jaJP\": \"落とし戸\",\n",
+                u8"    \"ptBR\": \"Alçapão\",\n",
+                u8"    \"ruRU\": \"Черный ход\",\n",
+                u8"    \"zhCN\": \"活板门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11013,\n",
+                u8"    \"Key\": \"Fiendra\",\n",
+                u8"    \"enUS\": \"Fiend\",\n",
+                u8"    \"zhTW\": \"魔蝠\",\n",
+                u8"    \"deDE\": \"Teufel\",\n",
+                u8"    \"esES\": \"Maligno\",\n",
+                u8"    \"frFR\": \"Fiel\",\n",
+                u8"    \"itIT\": \"del Demonio\",\n",
+                u8"    \"koKR\": \"마귀\",\n",
+                u8"    \"plPL\": \"[fs]Biesowa[ms]Biesowy[nl]Biesowe\",\n",
+                u8"    \"esMX\": \"[ms]diablesco[fs]diablesca[mp]diablescos[fp]diablescas\",\n",
+                u8"    \"jaJP\": \"魔魅なる\",\n",
+                u8"    \"ptBR\": \"[fs]Satânica[ms]Satânico[fp]Satânicas[mp]Satânicos\",\n",
+                u8"    \"ruRU\": \"[ms]изуверский[fs]изуверская[ns]изуверское[pl]изуверские\",\n",
+                u8"    \"zhCN\": \"妖蝠\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11014,\n",
+                u8"    \"Key\": \"Wraithra\",\n",
+                u8"    \"enUS\": \"Wraith\",\n",
+                u8"    \"zhTW\": \"怨靈\",\n",
+                u8"    \"deDE\": \"Gespenst\",\n",
+                u8"    \"esES\": \"Ánima\",\n",
+                u8"    \"frFR\": \"Spectre\",\n",
+                u8"    \"itIT\": \"dello Spettro\",\n",
+                u8"    \"koKR\": \"망령\",\n",
+                u8"    \"plPL\": \"[fs]Upiorna[ms]Upiorny[nl]Upiorne\",\n",
+                u8"    \"esMX\": \"[ms]de ánima[fs]de ánima[mp]de ánima[fp]de ánima\",\n",
+                u8"    \"jaJP\": \"死霊の\",\n",
+                u8"    \"ptBR\": \"[fs]Espectral[ms]Espectral[fp]Espectrais[mp]Espectrais\",\n",
+                u8"    \"ruRU\": \"[ms]фантомный[fs]фантомная[ns]фантомное[pl]фантомные\",\n",
+                u8"    \"zhCN\": \"怨魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11015,\n",
+                u8"    \"Key\": \"Fiend\",\n",
+                u8"    \"enUS\": \"Fiend\",\n",
+                u8"    \"zhTW\": \"魔蝠\",\n",
+                u8"    \"deDE\": \"Teufel\",\n",
+                u8"    \"esES\": \"Maligno\",\n",
+                u8"    \"frFR\": \"Fiel\",\n",
+                u8"    \"itIT\": \"Demonio\",\n",
+                u8"    \"koKR\": \"마귀\",\n",
+                u8"    \"plPL\": \"Bies\",\n",
+                u8"    \"esMX\": \"Diablejo\",\n",
+                u8"    \"jaJP\": \"悪魔\",\n",
+                u8"    \"ptBR\": \"[ms]Demônio Alado\",\n",
+                u8"    \"ruRU\": \"Бес\",\n",
+                u8"    \"zhCN\": \"妖蝠\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11016,\n",
+                u8"    \"Key\": \"Wraith\",\n",
+                u8"    \"enUS\": \"Wraith\",\n",
+                u8"    \"zhTW\": \"怨靈\",\n",
+                u8"    \"deDE\": \"Gespenst\",\n",
+                u8"    \"esES\": \"Ánima\",\n",
+                u8"    \"frFR\": \"Spectre\",\n",
+                u8"    \"itIT\": \"Spettro\",\n",
+                u8"    \"koKR\": \"망령\",\n",
+                u8"    \"plPL\": \"Widmo\",\n",
+                u8"    \"esMX\": \"Ánima\",\n",
+                u8"    \"jaJP\": \"レイス\",\n",
+                u8"    \"ptBR\": \"[ms]Espectro\",\n",
+                u8"    \"ruRU\": \"Дух\",\n",
+                u8"    \"zhCN\": \"怨魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11029,\n",
+                u8"    \"Key\": \"eats and spits corpses\",\n",
+                u8"    \"enUS\": \"Eats and Spits Corpses\",\n",
+                u8"    \"zhTW\": \"吞食與吐出屍體\",\n",
+                u8"    \"deDE\": \"Frisst und spuckt Leichen\",\n",
+                u8"    \"esES\": \"Come y escupe cadáveres\",\n",
+                u8"    \"frFR\": \"Mange et crache des cadavres\",\n",
+                u8"    \"itIT\": \"Mangia e sputa cadaveri\",\n",
+                u8"    \"koKR\": \"시체를 먹고 뱉음\",\n",
+                u8"    \"plPL\": \"Pożera zwłoki i nimi pluje\",\n",
+                u8"    \"esMX\": \"Come y escupe cadáveres\",\n",
+                u8"    \"jaJP\": \"死体を食べて吐き出す\",\n",
+                u8"    \"ptBR\": \"Come e cospe cadáveres\",\n",
+                u8"    \"ruRU\": \"Пожирает и извергает трупы\",\n",
+                u8"    \"zhCN\": \"吃吐尸体\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11031,\n",
+                u8"    \"Key\": \"Shocking Hit\",\n",
+                u8"    \"enUS\": \"Shocking Hit\",\n",
+                u8"    \"zhTW\": \"放電攻擊\",\n",
+                u8"    \"deDE\": \"Schockangriff\",\n",
+                u8"    \"esES\": \"Golpe de conmoción\",\n",
+                u8"    \"frFR\": \"Choc brutal\",\n",
+                u8"    \"itIT\": \"Colpo fulminante\",\n",
+                u8"    \"koKR\": \"감전 공격\",\n",
+                u8"    \"plPL\": \"Porażające uderzenie\",\n",
+                u8"    \"esMX\": \"Golpe eléctrico\",\n",
+                u8"    \"jaJP\": \"電撃攻撃\",\n",
+                u8"    \"ptBR\": \"Acerto elétrico\",\n",
+                u8"    \"ruRU\": \"Шокирующий удар\",\n",
+                u8"    \"zhCN\": \"闪电打击\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11084,\n",
+                u8"    \"Key\": \"champghostlyX\",\n",
+                u8"    \"enUS\": \"Ghostly\",\n",
+                u8"    \"zhTW\": \"幽靈\",\n",
+                u8"    \"deDE\": \"[ms]geisterhafter[fs]geisterhafte[ns]geisterhaftes[pl]geisterhafte\",\n",
+                u8"    \"esES\": \"Fantasmal\",\n",
+                u8"    \"frFR\": \"[ms]fantomatique[fs]fantomatique[mp]fantomatiques[fp]fantomatiques\",\n",
+                u8"    \"itIT\": \"Fantasma\",\n",
+                u8"    \"koKR\": \"유령\",\n",
+                u8"    \"plPL\": \"Duch –\",\n",
+                u8"    \"esMX\": \"[ms]fantasmal[fs]fantasmal[mp]fantasmales[fp]fantasmales\",\n",
+                u8"    \"jaJP\": \"幽かなる\",\n",
+                u8"    \"ptBR\": \"[fs]Fantasmagórica[ms]Fantasmagórico[fp]Fantasmagóricas[mp]Fantasmagóricos\",\n",
+                u8"    \"ruRU\": \"призрак\",\n",
+                u8"    \"zhCN\": \"[厉魂]\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11086,\n",
+                u8"    \"Key\": \"champpossessedX\",\n",
+                u8"    \"enUS\": \"Possessed\",\n",
+                u8"    \"zhTW\": \"著魔\",\n",
+                u8"    \"deDE\": \"[ms]besessener[fs]besessene[ns]besessenes[pl]besessene\",\n",
+                u8"    \"esES\": \"[fs]poseída[ms]poseído[fp]poseídas[mp]poseídos\",\n",
+                u8"    \"frFR\": \"[ms]possédé[fs]possédée[mp]possédés[fp]possédées\",\n",
+                u8"    \"itIT\": \"Senz'Anima\",\n",
+                u8"    \"koKR\": \"빙의된\",\n",
+                u8"    \"plPL\": \"Opętana istota –\",\n",
+                u8"    \"esMX\": \"[ms]poseído[fs]poseída[mp]poseídos[fp]poseídas\",\n",
+                u8"    \"jaJP\": \"憑りつかれた\",\n",
+                u8"    \"ptBR\": \"[fs]Possuída[ms]Possuído[fp]Possuídas[mp]Possuídos\",\n",
+                u8"    \"ruRU\": \"одержимость\",\n",
+                u8"    \"zhCN\": \"[邪魔附身]\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11154,\n",
+                u8"    \"Key\": \"Lilith\",\n",
+                u8"    \"enUS\": \"Lilith\",\n",
+                u8"    \"zhTW\": \"莉莉絲\",\n",
+                u8"    \"deDE\": \"Lilith\",\n",
+                u8"    \"esES\": \"Lilith\",\n",
+                u8"    \"frFR\": \"Lilith\",\n",
+                u8"    \"itIT\": \"Lilith\",\n",
+                u8"    \"koKR\": \"릴리트\",\n",
+                u8"    \"plPL\": \"Lilit\",\n",
+                u8"    \"esMX\": \"Lilith\",\n",
+                u8"    \"jaJP\": \"リリス\",\n",
+                u8"    \"ptBR\": \"Lilith\",\n",
+                u8"    \"ruRU\": \"Лилит\",\n",
+                u8"    \"zhCN\": \"莉莉丝\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21851,\n",
+                u8"    \"Key\": \"Baal Subject 1\",\n",
+                u8"    \"enUS\": \"Colenzo the Annihilator\",\n",
+                u8"    \"zhTW\": \"破壞者卡蘭索\",\n",
+                u8"    \"deDE\": \"Colenzo der Vernichter\",\n",
+                u8"    \"esES\": \"Colenzo el Aniquilador\",\n",
+                u8"    \"frFR\": \"Colenzo l’Annihilateur\",\n",
+                u8"    \"itIT\": \"Colenzo il Distruttore\",\n",
+                u8"    \"koKR\": \"종결자 콜렌조\",\n",
+                u8"    \"plPL\": \"Colenzo Niszczyciel\",\n",
+                u8"    \"esMX\": \"Colenzo el Aniquilador\",\n",
+                u8"    \"jaJP\": \"根絶やしのコレンゾ\",\n",
+                u8"    \"ptBR\": \"Colenzo, o Aniquilador\",\n",
+                u8"    \"ruRU\": \"Колензо Аннигилятор\",\n",
+                u8"    \"zhCN\": \"卡兰索·破坏者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21852,\n",
+                u8"    \"Key\": \"Baal Subject 2\",\n",
+                u8"    \"enUS\": \"Achmel the Cursed\",\n",
+                u8"    \"zhTW\": \"詛咒的阿克姆\",\n",
+                u8"    \"deDE\": \"Achmel der Verfluchte\",\n",
+                u8"    \"esES\": \"Achmel el Maldito\",\n",
+                u8"    \"frFR\": \"Achmel le Maudit\",\n",
+                u8"    \"itIT\": \"Achmel il Maledetto\",\n",
+                u8"    \"koKR\": \"저주받은 자 아크멜\",\n",
+                u8"    \"plPL\": \"Achmel Przeklęty\",\n",
+                u8"    \"esMX\": \"Achmel el Maldito\",\n",
+                u8"    \"jaJP\": \"呪われしアクメル\",\n",
+                u8"    \"ptBR\": \"Achmel, o Amaldiçoado\",\n",
+                u8"    \"ruRU\": \"Акмел Проклятый\",\n",
+                u8"    \"zhCN\": \"阿克姆·被诅咒者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21853,\n",
+                u8"    \"Key\": \"Baal Subject 3\",\n",
+                u8"    \"enUS\": \"Bartuc the Bloody\",\n",
+                u8"    \"zhTW\": \"血腥的霸圖克\",\n",
+                u8"    \"deDE\": \"Batuc der Blutige\",\n",
+                u8"    \"esES\": \"Bartuc el Sangriento\",\n",
+                u8"    \"frFR\": \"Bartuc le Sanglant\",\n",
+                u8"    \"itIT\": \"Bartuc il Sanguinario\",\n",
+                u8"    \"koKR\": \"피투성이 바르툭\",\n",
+                u8"    \"plPL\": \"Krwawy Bartuk\",\n",
+                u8"    \"esMX\": \"Bartuc el Sangriento\",\n",
+                u8"    \"jaJP\": \"血まみれバルトゥク\",\n",
+                u8"    \"ptBR\": \"Bartuc, o Sangrento\",\n",
+                u8"    \"ruRU\": \"Бартук Кровавый\",\n",
+                u8"    \"zhCN\": \"嗜血的巴图克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21854,\n",
+                u8"    \"Key\": \"Baal Subject 4\",\n",
+                u8"    \"enUS\": \"Ventar the Unholy\",\n",
+                u8"    \"zhTW\": \"不潔的凡塔\",\n",
+                u8"    \"deDE\": \"Ventar der Unheilige\",\n",
+                u8"    \"esES\": \"Ventar el Pecaminoso\",\n",
+                u8"    \"frFR\": \"Ventar l’Impie\",\n",
+                u8"    \"itIT\": \"Ventar l'Empio\",\n",
+                u8"    \"koKR\": \"부정한 자 벤타르\",\n",
+                u8"    \"plPL\": \"Ventar Wyklęty\",\n",
+                u8"    \"esMX\": \"Ventar el Impío\",\n",
+                u8"    \"jaJP\": \"不浄なるヴェンター\",\n",
+                u8"    \"ptBR\": \"Ventar, o Profano\",\n",
+                u8"    \"ruRU\": \"Вентар Нечестивый\",\n",
+                u8"    \"zhCN\": \"温塔尔·不洁者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21855,\n",
+                u8"    \"Key\": \"Baal Subject 5\",\n",
+                u8"    \"enUS\": \"Lister the Tormentor\",\n",
+                u8"    \"zhTW\": \"折磨者立斯特\",\n",
+                u8"    \"deDE\": \"Lister der Quäler\",\n",
+                u8"    \"esES\": \"Lister el Torturador\",\n",
+                u8"    \"frFR\": \"Lister le Tourmenteur\",\n",
+                u8"    \"itIT\": \"Lister il Tormentatore\",\n",
+                u8"    \"koKR\": \"고문자 리스터\",\n",
+                u8"    \"plPL\": \"Lister Oprawca\",\n",
+                u8"    \"esMX\": \"Lister el Atormentador\",\n",
+                u8"    \"jaJP\": \"暴虐のリスター\",\n",
+                u8"    \"ptBR\": \"Lister, o Atormentador\",\n",
+                u8"    \"ruRU\": \"Листер Истязатель\",\n",
+                u8"    \"zhCN\": \"利斯特·折磨者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21859,\n",
+                u8"    \"Key\": \"Baal Crab Clone\",\n",
+                u8"    \"enUS\": \"Baal\",\n",
+                u8"    \"zhTW\": \"巴爾\",\n",
+                u8"    \"deDE\": \"Baal\",\n",
+                u8"    \"esES\": \"Baal\",\n",
+                u8"    \"frFR\": \"Baal\",\n",
+                u8"    \"itIT\": \"Baal\",\n",
+                u8"    \"koKR\": \"바알\",\n",
+                u8"    \"plPL\": \"Baal\",\n",
+                u8"    \"esMX\": \"Baal\",\n",
+                u8"    \"jaJP\": \"バール\",\n",
+                u8"    \"ptBR\": \"Baal\",\n",
+                u8"    \"ruRU\": \"Баал\",\n",
+                u8"    \"zhCN\": \"巴尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21860,\n",
+                u8"    \"Key\": \"Baal Crab to Stairs\",\n",
+                u8"    \"enUS\": \"Baal\",\n",
+                u8"    \"zhTW\": \"巴爾\",\n",
+                u8"    \"deDE\": \"Baal\",\n",
+                u8"    \"esES\": \"Baal\",\n",
+                u8"    \"frFR\": \"Baal\",\n",
+                u8"    \"itIT\": \"Baal\",\n",
+                u8"    \"koKR\": \"바알\",\n",
+                u8"    \"plPL\": \"Baal\",\n",
+                u8"    \"esMX\": \"Baal\",\n",
+                u8"    \"jaJP\": \"バール\",\n",
+                u8"    \"ptBR\": \"Baal\",\n",
+                u8"    \"ruRU\": \"Баал\",\n",
+                u8"    \"zhCN\": \"巴尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21862,\n",
+                u8"    \"Key\": \"Baal Subject Mummy\",\n",
+                u8"    \"enUS\": \"Unraveler\",\n",
+                u8"    \"zhTW\": \"解繃者\",\n",
+                u8"    \"deDE\": \"Entwirrer\",\n",
+                u8"    \"esES\": \"Desenredador\",\n",
+                u8"    \"frFR\": \"Disloqueuse\",\n",
+                u8"    \"itIT\": \"Celato\",\n",
+                u8"    \"koKR\": \"풀어헤치는 자\",\n",
+                u8"    \"plPL\": \"Wyzwoliciel\",\n",
+                u8"    \"esMX\": \"Desenredador\",\n",
+                u8"    \"jaJP\": \"綻びし者\",\n",
+                u8"    \"ptBR\": \"[ms]Desfiador\",\n",
+                u8"    \"ruRU\": \"Разматыватель\",\n",
+                u8"    \"zhCN\": \"剖尸者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21864,\n",
+                u8"    \"Key\": \"Baals Minion\",\n",
+                u8"    \"enUS\": \"Minion of Destruction\",\n",
+                u8"    \"zhTW\": \"毀滅僕從\",\n",
+                u8"    \"deDE\": \"Diener der Zerstörung\",\n",
+                u8"    \"esES\": \"Esbirro de destrucción\",\n",
+                u8"    \"frFR\": \"Serviteur de la destruction\",\n",
+                u8"    \"itIT\": \"Seguace della Distruzione\",\n",
+                u8"    \"koKR\": \"파괴의 하수인\",\n",
+                u8"    \"plPL\": \"Sługa Zniszczenia\",\n",
+                u8"    \"esMX\": \"Esbirros de la destrucción\",\n",
+                u8"    \"jaJP\": \"破壊のしもべ\",\n",
+                u8"    \"ptBR\": \"[ms]Lacaio da Destruição\",\n",
+                u8"    \"ruRU\": \"Слуга Разрушения\",\n",
+                u8"    \"zhCN\": \"毁灭的爪牙\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22330,\n",
+                u8"    \"Key\": \"UIFenirsui\",\n",
+                u8"    \"enUS\": \"Dire Wolf\",\n",
+                u8"    \"zhTW\": \"恐狼\",\n",
+                u8"    \"deDE\": \"Todeswolf\",\n",
+                u8"    \"esES\": \"Lobo atroz\",\n",
+                u8"    \"frFR\": \"Loup féroce\",\n",
+                u8"    \"itIT\": \"Lupo Feroce\",\n",
+                u8"    \"koKR\": \"광포한 늑대\",\n",
+                u8"    \"plPL\": \"Upiorny wilk\",\n",
+                u8"    \"esMX\": \"Lobo temible\",\n",
+                u8"    \"jaJP\": \"ダイアウルフ\",\n",
+                u8"    \"ptBR\": \"Lobo Atroz\",\n",
+                u8"    \"ruRU\": \"Лютый волк\",\n",
+                u8"    \"zhCN\": \"狂狼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22331,\n",
+                u8"    \"Key\": \"UiRescuedBarUI\",\n",
+                u8"    \"enUS\": \"Warrior\",\n",
+                u8"    \"zhTW\": \"戰士\",\n",
+                u8"    \"deDE\": \"Krieger\",\n",
+                u8"    \"esES\": \"Guerrero\",\n",
+                u8"    \"frFR\": \"Guerrier\",\n",
+                u8"    \"itIT\": \"Guerriero\",\n",
+                u8"    \"koKR\": \"전사\",\n",
+                u8"    \"plPL\": \"Wojownik\",\n",
+                u8"    \"esMX\": \"Guerrero\",\n",
+                u8"    \"jaJP\": \"ウォリアー\",\n",
+                u8"    \"ptBR\": \"Guerreiro\",\n",
+                u8"    \"ruRU\": \"Воин\",\n",
+                u8"    \"zhCN\": \"战士\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22334,\n",
+                u8"    \"Key\": \"Spike Generator\",\n",
+                u8"    \"enUS\": \"Spike Generator\",\n",
+                u8"    \"zhTW\": \"尖刺製造機\",\n",
+                u8"    \"deDE\": \"Dornengenerator\",\n",
+                u8"    \"esES\": \"Generador de pinchos\",\n",
+                u8"    \"frFR\": \"Générateur d’éclairs\",\n",
+                u8"    \"itIT\": \"Generatore di Spine\",\n",
+                u8"    \"koKR\": \"쐐기 생성기\",\n",
+                u8"    \"plPL\": \"Generator kolców\",\n",
+                u8"    \"esMX\": \"Generador de púas\",\n",
+                u8"    \"jaJP\": \"スパイク・ジェネレーター\",\n",
+                u8"    \"ptBR\": \"Gerador de Espetos\",\n",
+                u8"    \"ruRU\": \"Источник шипов\",\n",
+                u8"    \"zhCN\": \"尖刺生成器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22338,\n",
+                u8"    \"Key\": \"Invis Pet\",\n",
+                u8"    \"enUS\": \"Pet\",\n",
+                u8"    \"zhTW\": \"寵物\",\n",
+                u8"    \"deDE\": \"Haustier\",\n",
+                u8"    \"esES\": \"Mascota\",\n",
+                u8"    \"frFR\": \"Familier\",\n",
+                u8"    \"itIT\": \"Animale\",\n",
+                u8"    \"koKR\": \"소환수\",\n",
+                u8"    \"plPL\": \"Pomocnik\",\n",
+                u8"    \"esMX\": \"Mascota\",\n",
+                u8"    \"jaJP\": \"ペット\",\n",
+                u8"    \"ptBR\": \"[fs]Mascote\",\n",
+                u8"    \"ruRU\": \"Питомец\",\n",
+                u8"    \"zhCN\": \"宠物\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22340,\n",
+                u8"    \"Key\": \"Druid Wolf\",\n",
+                u8"    \"enUS\": \"Wolf\",\n",
+                u8"    \"zhTW\": \"狼\",\n",
+                u8"    \"deDE\": \"Wolf\",\n",
+                u8"    \"esES\": \"Lobo\",\n",
+                u8"    \"frFR\": \"Loup\",\n",
+                u8"    \"itIT\": \"Lupo\",\n",
+                u8"    \"koKR\": \"늑대\",\n",
+                u8"    \"plPL\": \"Wilk\",\n",
+                u8"    \"esMX\": \"Lobo\",\n",
+                u8"    \"jaJP\": \"ウルフ\",\n",
+                u8"    \"ptBR\": \"Lobo\",\n",
+                u8"    \"ruRU\": \"Волк\",\n",
+                u8"    \"zhCN\": \"狼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22341,\n",
+                u8"    \"Key\": \"Druid Totem\",\n",
+                u8"    \"enUS\": \"Druid Spirit\",\n",
+                u8"    \"zhTW\": \"德魯伊魂靈\",\n",
+                u8"    \"deDE\": \"Druidengeist\",\n",
+                u8"    \"esES\": \"Espíritu druida\",\n",
+                u8"    \"frFR\": \"Esprit de druide\",\n",
+                u8"    \"itIT\": \"Spirito Druidico\",\n",
+                u8"    \"koKR\": \"드루이드 혼령\",\n",
+                u8"    \"plPL\": \"Duch druida\",\n",
+                u8"    \"esMX\": \"Espíritu druida\",\n",
+                u8"    \"jaJP\": \"ドルイド・スピリット\",\n",
+                u8"    \"ptBR\": \"Espírito Druida\",\n",
+                u8"    \"ruRU\": \"Дух друида\",\n",
+                u8"    \"zhCN\": \"德鲁伊灵体\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22342,\n",
+                u8"    \"Key\": \"Druid Fenris\",\n",
+                u8"    \"enUS\": \"Dire Wolf\",\n",
+                u8"    \"zhTW\": \"恐狼\",\n",
+                u8"    \"deDE\": \"Todeswolf\",\n",
+                u8"    \"esES\": \"Lobo atroz\",\n",
+                u8"    \"frFR\": \"Loup féroce\",\n",
+                u8"    \"itIT\": \"Lupo Feroce\",\n",
+                u8"    \"koKR\": \"광포한 늑대\",\n",
+                u8"    \"plPL\": \"Upiorny wilk\",\n",
+                u8"    \"esMX\": \"Lobo temible\",\n",
+                u8"    \"jaJP\": \"ダイアウルフ\",\n",
+                u8"    \"ptBR\": \"[ms]Lobo Atroz\",\n",
+                u8"    \"ruRU\": \"Лютый волк\",\n",
+                u8"    \"zhCN\": \"狂狼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22343,\n",
+                u8"    \"Key\": \"Druid Spirit Wolf\",\n",
+                u8"    \"enUS\": \"Spirit Wolf\",\n",
+                u8"    \"zhTW\": \"幽靈狼\",\n",
+                u8"    \"deDE\": \"Geisterwolf\",\n",
+                u8"    \"esES\": \"Lobo espíritu\",\n",
+                u8"    \"frFR\": \"Esprit du loup\",\n",
+                u8"    \"itIT\": \"Spirito di Lupo\",\n",
+                u8"    \"koKR\": \"영혼 늑대\",\n",
+                u8"    \"plPL\": \"Duch wilka\",\n",
+                u8"    \"esMX\": \"Lobo espiritual\",\n",
+                u8"    \"jaJP\": \"スピリット・ウルフ\",\n",
+                u8"    \"ptBR\": \"[ms]Lobo Espiritual\",\n",
+                u8"    \"ruRU\": \"Призрачный волк\",\n",
+                u8"    \"zhCN\": \"灵狼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22344,\n",
+                u8"    \"Key\": \"Druid Bear\",\n",
+                u8"    \"enUS\": \"Grizzly\",\n",
+                u8"    \"zhTW\": \"灰熊\",\n",
+                u8"    \"deDE\": \"Grizzly\",\n",
+                u8"    \"esES\": \"Oso pardo\",\n",
+                u8"    \"frFR\": \"Grizzly\",\n",
+                u8"    \"itIT\": \"Grizzly\",\n",
+                u8"    \"koKR\": \"회색곰\",\n",
+                u8"    \"plPL\": \"Grizzly\",\n",
+                u8"    \"esMX\": \"Oso pardo\",\n",
+                u8"    \"jaJP\": \"グリズリー\",\n",
+                u8"    \"ptBR\": \"[ms]Urso-cinzento\",\n",
+                u8"    \"ruRU\": \"Гризли\",\n",
+                u8"    \"zhCN\": \"灰熊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22345,\n",
+                u8"    \"Key\": \"Druid Plague Poppy\",\n",
+                u8"    \"enUS\": \"Plague Poppy\",\n",
+                u8"    \"zhTW\": \"瘟疫罌粟\",\n",
+                u8"    \"deDE\": \"Pestmohn\",\n",
+                u8"    \"esES\": \"Amapopeste\",\n",
+                u8"    \"frFR\": \"Graine de peste\",\n",
+                u8"    \"itIT\": \"Papavero della Piaga\",\n",
+                u8"    \"koKR\": \"역병 꽃\",\n",
+                u8"    \"plPL\": \"Kłącza zarazy\",\n",
+                u8"    \"esMX\": \"Amapola apestada\",\n",
+                u8"    \"jaJP\": \"プレイグ・ポピー\",\n",
+                u8"    \"ptBR\": \"[fs]Papoula Pestilenta\",\n",
+                u8"    \"ruRU\": \"Чумной мак\",\n",
+                u8"    \"zhCN\": \"瘟疫罂粟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22346,\n",
+                u8"    \"Key\": \"Druid Cycle of Life\",\n",
+                u8"    \"enUS\": \"Cycle of Life\",\n",
+                u8"    \"zhTW\": \"生命輪迴\",\n",
+                u8"    \"deDE\": \"Lebenszyklus\",\n",
+                u8"    \"esES\": \"Ciclo vital\",\n",
+                u8"    \"frFR\": \"Cycle de la vie\",\n",
+                u8"    \"itIT\": \"Ciclo Vitale\",\n",
+                u8"    \"koKR\": \"삶의 순환\",\n",
+                u8"    \"plPL\": \"Cykl życia\",\n",
+                u8"    \"esMX\": \"Ciclo de la vida\",\n",
+                u8"    \"jaJP\": \"サイクル・オブ・ライフ\",\n",
+                u8"    \"ptBR\": \"[ms]Ciclo da Vida\",\n",
+                u8"    \"ruRU\": \"Жизненный цикл\",\n",
+                u8"    \"zhCN\": \"生命循环\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22347,\n",
+                u8"    \"Key\": \"Vine Creature\",\n",
+                u8"    \"enUS\": \"Vine Creature\",\n",
+                u8"    \"zhTW\": \"藤蔓生物\",\n",
+                u8"    \"deDE\": \"Rankenkreatur\",\n",
+                u8"    \"esES\": \"Criatura liana\",\n",
+                u8"    \"frFR\": \"Créature des sarments\",\n",
+                u8"    \"itIT\": \"Vite Vivente\",\n",
+                u8"    \"koKR\": \"덩굴 괴물\",\n",
+                u8"    \"plPL\": \"Ożywiona Winorośl\",\n",
+                u8"    \"esMX\": \"Criatura de la liana\",\n",
+                u8"    \"jaJP\": \"ヴァイン・クリーチャー\",\n",
+                u8"    \"ptBR\": \"[fs]Criatura Vínea\",\n",
+                u8"    \"ruRU\": \"Обитатель лозы\",\n",
+                u8"    \"zhCN\": \"藤蔓生物\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22348,\n",
+                u8"    \"Key\": \"Eagleexp\",\n",
+                u8"    \"enUS\": \"Eagle\",\n",
+                u8"    \"zhTW\": \"老鷹\",\n",
+                u8"    \"deDE\": \"Adler\",\n",
+                u8"    \"esES\": \"Águila\",\n",
+                u8"    \"frFR\": \"Aigle\",\n",
+                u8"    \"itIT\": \"Aquila\",\n",
+                u8"    \"koKR\": \"독수리\",\n",
+                u8"    \"plPL\": \"Orzeł\",\n",
+                u8"    \"esMX\": \"Águila\",\n",
+                u8"    \"jaJP\": \"イーグル\",\n",
+                u8"    \"ptBR\": \"[fs]Águia\",\n",
+                u8"    \"ruRU\": \"Орел\",\n",
+                u8"    \"zhCN\": \"鹰\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22349,\n",
+                u8"    \"Key\": \"Wolf\",\n",
+                u8"    \"enUS\": \"Wolf\",\n",
+                u8"    \"zhTW\": \"狼\",\n",
+                u8"    \"deDE\": \"Wolf\",\n",
+                u8"    \"esES\": \"Lobo\",\n",
+                u8"    \"frFR\": \"Loup\",\n",
+                u8"    \"itIT\": \"Lupo\",\n",
+                u8"    \"koKR\": \"늑대\",\n",
+                u8"    \"plPL\": \"Wilk\",\n",
+                u8"    \"esMX\": \"Lobo\",\n",
+                u8"    \"jaJP\": \"ウルフ\",\n",
+                u8"    \"ptBR\": \"[ms]Lobo\",\n",
+                u8"    \"ruRU\": \"Волк\",\n",
+                u8"    \"zhCN\": \"狼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22350,\n",
+                u8"    \"Key\": \"Bear\",\n",
+                u8"    \"enUS\": \"Bear\",\n",
+                u8"    \"zhTW\": \"熊\",\n",
+                u8"    \"deDE\": \"Bär\",\n",
+                u8"    \"esES\": \"Oso\",\n",
+                u8"    \"frFR\": \"Ours\",\n",
+                u8"    \"itIT\": \"Orso\",\n",
+                u8"    \"koKR\": \"곰\",\n",
+                u8"    \"plPL\": \"Niedźwiedź\",\n",
+                u8"    \"esMX\": \"Oso\",\n",
+                u8"    \"jaJP\": \"ベアー\",\n",
+                u8"    \"ptBR\": \"[ms]Urso\",\n",
+                u8"    \"ruRU\": \"Медведь\",\n",
+                u8"    \"zhCN\": \"熊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22351,\n",
+                u8"    \"Key\": \"Siege Door\",\n",
+                u8"    \"enUS\": \"Siege Door\",\n",
+                u8"    \"zhTW\": \"攻城門\",\n",
+                u8"    \"deDE\": \"Belagerungstür\",\n",
+                u8"    \"esES\": \"Puerta de asedio\",\n",
+                u8"    \"frFR\": \"Porte de siège\",\n",
+                u8"    \"itIT\": \"Porta d'Assedio\",\n",
+                u8"    \"koKR\": \"공성 문\",\n",
+                u8"    \"plPL\": \"Brama oblężnicza\",\n",
+                u8"    \"esMX\": \"Puerta de asedio\",\n",
+                u8"    \"jaJP\": \"シージ・ドア\",\n",
+                u8"    \"ptBR\": \"Porta de Cerco\",\n",
+                u8"    \"ruRU\": \"Трап осадной башни\",\n",
+                u8"    \"zhCN\": \"攻城门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22352,\n",
+                u8"    \"Key\": \"Seige Tower\",\n",
+                u8"    \"enUS\": \"Seige Tower\",\n",
+                u8"    \"zhTW\": \"攻城塔\",\n",
+                u8"    \"deDE\": \"Belagerungsturm\",\n",
+                u8"    \"esES\": \"Torre de asedio\",\n",
+                u8"    \"frFR\": \"Tour de siège\",\n",
+                u8"    \"itIT\": \"Torre d'Assedio\",\n",
+                u8"    \"koKR\": \"공성 탑\",\n",
+                u8"    \"plPL\": \"Wieża oblężnicza\",\n",
+                u8"    \"esMX\": \"Torre de asedio\",\n",
+                u8"    \"jaJP\": \"シージ・タワー\",\n",
+                u8"    \"ptBR\": \"Torre de Cerco\",\n",
+                u8"    \"ruRU\": \"Осадная башня\",\n",
+                u8"    \"zhCN\": \"攻城塔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22353,\n",
+                u8"    \"Key\": \"RotWalker\",\n",
+                u8"    \"enUS\": \"Rot Walker\",\n",
+                u8"    \"zhTW\": \"腐行者\",\n",
+                u8"    \"deDE\": \"Fäulniswandler\",\n",
+                u8"    \"esES\": \"Viajero podrido\",\n",
+                u8"    \"frFR\": \"Marcheur putride\",\n",
+                u8"    \"itIT\": \"Camminatore Putrefatto\",\n",
+                u8"    \"koKR\": \"부패 방랑자\",\n",
+                u8"    \"plPL\": \"Zgniłaz\",\n",
+                u8"    \"esMX\": \"Errante putrefacto\",\n",
+                u8"    \"jaJP\": \"ロット・ウォーカー\",\n",
+                u8"    \"ptBR\": \"[ms]Caminhante Putrefato\",\n",
+                u8"    \"ruRU\": \"Гниющий ходок\",\n",
+                u8"    \"zhCN\": \"腐烂行骸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22354,\n",
+                u8"    \"Key\": \"ReanimatedHorde\",\n",
+                u8"    \"enUS\": \"Reanimated Horde\",\n",
+                u8"    \"zhTW\": \"再生屍兵\",\n",
+                u8"    \"deDE\": \"Wiederbelebte Horde\",\n",
+                u8"    \"esES\": \"Horda reanimada\",\n",
+                u8"    \"frFR\": \"Réanimé\",\n",
+                u8"    \"itIT\": \"Combattente Rianimato\",\n",
+                u8"    \"koKR\": \"소생한 무리\",\n",
+                u8"    \"plPL\": \"Ożywione ścierwo\",\n",
+                u8"    \"esMX\": \"Horda reanimada\",\n",
+                u8"    \"jaJP\": \"リアニメイテッド・ホード\",\n",
+                u8"    \"ptBR\": \"Horda Reanimada\",\n",
+                u8"    \"ruRU\": \"Оживленный солдат\",\n",
+                u8"    \"zhCN\": \"复活行尸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22355,\n",
+                u8"    \"Key\": \"ProwlingDead\",\n",
+                u8"    \"enUS\": \"Prowling Dead\",\n",
+                u8"    \"zhTW\": \"巡行屍兵\",\n",
+                u8"    \"deDE\": \"Schleichende Tote\",\n",
+                u8"    \"esES\": \"Muerto merodeador\",\n",
+                u8"    \"frFR\": \"Mort en maraude\",\n",
+                u8"    \"itIT\": \"Carcassa Vagante\",\n",
+                u8"    \"koKR\": \"배회하는 망자\",\n",
+                u8"    \"plPL\": \"Szwendacz\",\n",
+                u8"    \"esMX\": \"Muerto merodeador\",\n",
+                u8"    \"jaJP\": \"プロウリング・デッド\",\n",
+                u8"    \"ptBR\": \"[ms]Cadáver Sorrateiro\",\n",
+                u8"    \"ruRU\": \"Хищный мертвец\",\n",
+                u8"    \"zhCN\": \"徘徊亡骨\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22356,\n",
+                u8"    \"Key\": \"UnholyCorpse\",\n",
+                u8"    \"enUS\": \"Unholy Corpse\",\n",
+                u8"    \"zhTW\": \"穢邪屍兵\",\n",
+                u8"    \"deDE\": \"Unheilige Kadaver\",\n",
+                u8"    \"esES\": \"Cadáver pecaminoso\",\n",
+                u8"    \"frFR\": \"Cadavre impie\",\n",
+                u8"    \"itIT\": \"Cadavere Sconsacrato\",\n",
+                u8"    \"koKR\": \"부정한 시체\",\n",
+                u8"    \"plPL\": \"Przeklęte zwłoki\",\n",
+                u8"    \"esMX\": \"Cadáver impío\",\n",
+                u8"    \"jaJP\": \"アンホーリー・コープス\",\n",
+                u8"    \"ptBR\": \"[ms]Cadáver Profano\",\n",
+                u8"    \"ruRU\": \"Оскверненный труп\",\n",
+                u8"    \"zhCN\": \"不洁尸骸\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22357,\n",
+                u8"    \"Key\": \"DefiledWarrior\",\n",
+                u8"    \"enUS\": \"Defiled Warrior\",\n",
+                u8"    \"zhTW\": \"褻瀆戰士\",\n",
+                u8"    \"deDE\": \"Entweihter Krieger\",\n",
+                u8"    \"esES\": \"Guerrero deshonrado\",\n",
+                u8"    \"frFR\": \"Guerrier déchu\",\n",
+                u8"    \"itIT\": \"Guerriero Profanato\",\n",
+                u8"    \"koKR\": \"더럽혀진 전사\",\n",
+                u8"    \"plPL\": \"Splugawiony wojownik\",\n",
+                u8"    \"esMX\": \"Guerrero profano\",\n",
+                u8"    \"jaJP\": \"デファイルド・ウォリアー\",\n",
+                u8"    \"ptBR\": \"[ms]Guerreiro Profanado\",\n",
+                u8"    \"ruRU\": \"Потревоженный воин\",\n",
+                u8"    \"zhCN\": \"污邪战士\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22358,\n",
+                u8"    \"Key\": \"Siege Beast\",\n",
+                u8"    \"enUS\": \"Siege Beast\",\n",
+                u8"    \"zhTW\": \"攻城獸\",\n",
+                u8"    \"deDE\": \"Belagerungsbestie\",\n",
+                u8"    \"esES\": \"Bestia de asedio\",\n",
+                u8"    \"frFR\": \"Bête de siège\",\n",
+                u8"    \"itIT\": \"Bestia d'Assedio\",\n",
+                u8"    \"koKR\": \"공성 야수\",\n",
+                u8"    \"plPL\": \"Bestia oblężnicza\",\n",
+                u8"    \"esMX\": \"Bestia asediadora\",\n",
+                u8"    \"jaJP\": \"シージ・ビースト\",\n",
+                u8"    \"ptBR\": \"Fera de Cerco\",\n",
+                u8"    \"ruRU\": \"Осадный зверь\",\n",
+                u8"    \"zhCN\": \"攻城兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22359,\n",
+                u8"    \"Key\": \"CrushBiest\",\n",
+                u8"    \"enUS\": \"Crush Beast\",\n",
+                u8"    \"zhTW\": \"重擊攻城獸\",\n",
+                u8"    \"deDE\": \"Zerquetscher\",\n",
+                u8"    \"esES\": \"Bestia aplastadora\",\n",
+                u8"    \"frFR\": \"Bête de choc\",\n",
+                u8"    \"itIT\": \"Bestia Demolitrice\",\n",
+                u8"    \"koKR\": \"분쇄 야수\",\n",
+                u8"    \"plPL\": \"Miażdżybestia\",\n",
+                u8"    \"esMX\": \"Bestia demoledora\",\n",
+                u8"    \"jaJP\": \"クラッシュ・ビースト\",\n",
+                u8"    \"ptBR\": \"Fera Esmagadora\",\n",
+                u8"    \"ruRU\": \"Крушащий зверь\",\n",
+                u8"    \"zhCN\": \"破阵兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22360,\n",
+                u8"    \"Key\": \"BloodBringer\",\n",
+                u8"    \"enUS\": \"Blood Bringer\",\n",
+                u8"    \"zhTW\": \"血腥攻城獸\",\n",
+                u8"    \"deDE\": \"Blutbringer\",\n",
+                u8"    \"esES\": \"Portador de la sangre\",\n",
+                u8"    \"frFR\": \"Bête de sang\",\n",
+                u8"    \"itIT\": \"Insanguinatore\",\n",
+                u8"    \"koKR\": \"피 인도자\",\n",
+                u8"    \"plPL\": \"Siewca krwi\",\n",
+                u8"    \"esMX\": \"Bestia sangrienta\",\n",
+                u8"    \"jaJP\": \"ブラッド・ブリンガー\",\n",
+                u8"    \"ptBR\": \"[ms]Arauto Sangrento\",\n",
+                u8"    \"ruRU\": \"Кровавый разносчик\",\n",
+                u8"    \"zhCN\": \"溅血兽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22361,\n",
+                u8"    \"Key\": \"GoreBearer\",\n",
+                u8"    \"enUS\": \"Gore Bearer\",\n",
+                u8"    \"zhTW\": \"蝕肉獸\",\n",
+                u8"    \"deDE\": \"Verstümmler\",\n",
+                u8"    \"esES\": \"Portador de la violencia\",\n",
+                u8"    \"frFR\": \"Bête d’horreur\",\n",
+                u8"    \"itIT\": \"Portatore di Sangue\",\n",
+                u8"    \"koKR\": \"선혈 유발자\",\n",
+                u8"    \"plPL\": \"Zwiastun rzezi\",\n",
+                u8"    \"esMX\": \"Portador truculento\",\n",
+                u8"    \"jaJP\": \"ゴア・ベアラー\",\n",
+                u8"    \"ptBR\": \"[ms]Sanguinolento\",\n",
+                u8"    \"ruRU\": \"Гигант плоти\",\n",
+                u8"    \"zhCN\": \"血污魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22362,\n",
+                u8"    \"Key\": \"DeamonSteed\",\n",
+                u8"    \"enUS\": \"Demon Steed\",\n",
+                u8"    \"zhTW\": \"惡魔戰馬\",\n",
+                u8"    \"deDE\": \"Dämonenross\",\n",
+                u8"    \"esES\": \"Corcel demoníaco\",\n",
+                u8"    \"frFR\": \"Palefroi démoniaque\",\n",
+                u8"    \"itIT\": \"Destriero Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 군마\",\n",
+                u8"    \"plPL\": \"Demoniczny wierzchowiec\",\n",
+                u8"    \"esMX\": \"Corcel demoníaco\",\n",
+                u8"    \"jaJP\": \"デーモン・スティード\",\n",
+                u8"    \"ptBR\": \"[ms]Corcel Demoníaco\",\n",
+                u8"    \"ruRU\": \"Демонический скакун\",\n",
+                u8"    \"zhCN\": \"恶魔战马\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22363,\n",
+                u8"    \"Key\": \"WailingSpirit\",\n",
+                u8"    \"enUS\": \"Wailing Spirit\",\n",
+                u8"    \"zhTW\": \"泣靈\",\n",
+                u8"    \"deDE\": \"Klagegeist\",\n",
+                u8"    \"esES\": \"Espíritu afligido\",\n",
+                u8"    \"frFR\": \"Esprit gémissant\",\n",
+                u8"    \"itIT\": \"Spirito Lamentoso\",\n",
+                u8"    \"koKR\": \"울부짖는 혼령\",\n",
+                u8"    \"plPL\": \"Zawodzący duch\",\n",
+                u8"    \"esMX\": \"Espíritu sollozante\",\n",
+                u8"    \"jaJP\": \"ウェイリング・スピリット\",\n",
+                u8"    \"ptBR\": \"Espírito Uivante\",\n",
+                u8"    \"ruRU\": \"Стенающий дух\",\n",
+                u8"    \"zhCN\": \"恸哭之灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22364,\n",
+                u8"    \"Key\": \"LifeSeeker\",\n",
+                u8"    \"enUS\": \"Life Seeker\",\n",
+                u8"    \"zhTW\": \"索命者\",\n",
+                u8"    \"deDE\": \"Lebenssucher\",\n",
+                u8"    \"esES\": \"Buscador de vidas\",\n",
+                u8"    \"frFR\": \"Vampiqueur\",\n",
+                u8"    \"itIT\": \"Cercatore di Vita\",\n",
+                u8"    \"koKR\": \"생명 추적자\",\n",
+                u8"    \"plPL\": \"Poszukiwacz życia\",\n",
+                u8"    \"esMX\": \"Buscador de vida\",\n",
+                u8"    \"jaJP\": \"ライフ・シーカー\",\n",
+                u8"    \"ptBR\": \"Caçador de Vidas\",\n",
+                u8"    \"ruRU\": \"Искатель жизни\",\n",
+                u8"    \"zhCN\": \"活物寻获者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22365,\n",
+                u8"    \"Key\": \"LifeStealer\",\n",
+                u8"    \"enUS\": \"Life Stealer\",\n",
+                u8"    \"zhTW\": \"偷命者\",\n",
+                u8"    \"deDE\": \"Lebensstehler\",\n",
+                u8"    \"esES\": \"Ladrón de vidas\",\n",
+                u8"    \"frFR\": \"Voleur de vie\",\n",
+                u8"    \"itIT\": \"Ladro di Vita\",\n",
+                u8"    \"koKR\": \"생명 강탈자\",\n",
+                u8"    \"plPL\": \"Złodziej życia\",\n",
+                u8"    \"esMX\": \"Ladrón de vida\",\n",
+                u8"    \"jaJP\": \"ライフ・スティーラー\",\n",
+                u8"    \"ptBR\": \"Ladrão de Vida\",\n",
+                u8"    \"ruRU\": \"Похититель жизни\",\n",
+                u8"    \"zhCN\": \"生命偷取者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22366,\n",
+                u8"    \"Key\": \"DeathlyVisage\",\n",
+                u8"    \"enUS\": \"Deathly Visage\",\n",
+                u8"    \"zhTW\": \"死亡幻影\",\n",
+                u8"    \"deDE\": \"Todesfratze\",\n",
+                u8"    \"esES\": \"Rostro mortal\",\n",
+                u8"    \"frFR\": \"Épouvanteur\",\n",
+                u8"    \"itIT\": \"Viso Mortale\",\n",
+                u8"    \"koKR\": \"죽음의 얼굴\",\n",
+                u8"    \"plPL\": \"Oblicze śmierci\",\n",
+                u8"    \"esMX\": \"Semblante mortífero\",\n",
+                u8"    \"jaJP\": \"デスリィ・ヴィゼッジ\",\n",
+                u8"    \"ptBR\": \"Semblante Mortífero\",\n",
+                u8"    \"ruRU\": \"Мертвенный лик\",\n",
+                u8"    \"zhCN\": \"索命鬼影\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22367,\n",
+                u8"    \"Key\": \"BoundSpirit\",\n",
+                u8"    \"enUS\": \"Bound Spirit\",\n",
+                u8"    \"zhTW\": \"縛靈\",\n",
+                u8"    \"deDE\": \"Gefesselter Geist\",\n",
+                u8"    \"esES\": \"Espíritu aprisionado\",\n",
+                u8"    \"frFR\": \"Esprit lié\",\n",
+                u8"    \"itIT\": \"Spirito Incatenato\",\n",
+                u8"    \"koKR\": \"속박된 혼령\",\n",
+                u8"    \"plPL\": \"Spętany duch\",\n",
+                u8"    \"esMX\": \"Espíritu confinado\",\n",
+                u8"    \"jaJP\": \"バウンド・スピリット\",\n",
+                u8"    \"ptBR\": \"Espírito Prisioneiro\",\n",
+                u8"    \"ruRU\": \"Плененный дух\",\n",
+                u8"    \"zhCN\": \"束缚之灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22368,\n",
+                u8"    \"Key\": \"BanishedSoul\",\n",
+                u8"    \"enUS\": \"Banished Soul\",\n",
+                u8"    \"zhTW\": \"流放之魂\",\n",
+                u8"    \"deDE\": \"Verbannte Seele\",\n",
+                u8"    \"esES\": \"Alma desterrada\",\n",
+                u8"    \"frFR\": \"Âme bannie\",\n",
+                u8"    \"itIT\": \"Anima Esiliata\",\n",
+                u8"    \"koKR\": \"추방당한 영혼\",\n",
+                u8"    \"plPL\": \"Wypędzona dusza\",\n",
+                u8"    \"esMX\": \"Alma desterrada\",\n",
+                u8"    \"jaJP\": \"バニッシュト・ソウル\",\n",
+                u8"    \"ptBR\": \"Alma Banida\",\n",
+                u8"    \"ruRU\": \"Изгнанная душа\",\n",
+                u8"    \"zhCN\": \"被逐之魂\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22369,\n",
+                u8"    \"Key\": \"Deathexp\",\n",
+                u8"    \"enUS\": \"Death\",\n",
+                u8"    \"zhTW\": \"死亡化身\",\n",
+                u8"    \"deDE\": \"Tod\",\n",
+                u8"    \"esES\": \"Muerte\",\n",
+                u8"    \"frFR\": \"Camarde\",\n",
+                u8"    \"itIT\": \"Morte\",\n",
+                u8"    \"koKR\": \"죽음\",\n",
+                u8"    \"plPL\": \"Śmierć\",\n",
+                u8"    \"esMX\": \"Muerte\",\n",
+                u8"    \"jaJP\": \"デス\",\n",
+                u8"    \"ptBR\": \"Morte\",\n",
+                u8"    \"ruRU\": \"Смерть\",\n",
+                u8"    \"zhCN\": \"死神\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22370,\n",
+                u8"    \"Key\": \"Minionexp\",\n",
+                u8"    \"enUS\": \"Enslaved\",\n",
+                u8"    \"zhTW\": \"僕魔\",\n",
+                u8"    \"deDE\": \"Sklave\",\n",
+                u8"    \"esES\": \"Esclavo\",\n",
+                u8"    \"frFR\": \"Servant damné\",\n",
+                u8"    \"itIT\": \"Servo\",\n",
+                u8"    \"koKR\": \"사로잡힌 자\",\n",
+                u8"    \"plPL\": \"Zniewolony\",\n",
+                u8"    \"esMX\": \"Esclavo\",\n",
+                u8"    \"jaJP\": \"エンスレイヴド\",\n",
+                u8"    \"ptBR\": \"[ms]Escravizado\",\n",
+                u8"    \"ruRU\": \"Порабощенный\",\n",
+                u8"    \"zhCN\": \"仆魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22371,\n",
+                u8"    \"Key\": \"Slayerexp\",\n",
+                u8"    \"enUS\": \"Slayer\",\n",
+                u8"    \"zhTW\": \"殺戮僕魔\",\n",
+                u8"    \"deDE\": \"Schlitzer\",\n",
+                u8"    \"esES\": \"Criminal\",\n",
+                u8"    \"frFR\": \"Flagelleur\",\n",
+                u8"    \"itIT\": \"Massacratore\",\n",
+                u8"    \"koKR\": \"학살자\",\n",
+                u8"    \"plPL\": \"Pogromca\",\n",
+                u8"    \"esMX\": \"Exterminador\",\n",
+                u8"    \"jaJP\": \"スレイヤー\",\n",
+                u8"    \"ptBR\": \"Homicida\",\n",
+                u8"    \"ruRU\": \"Истребитель\",\n",
+                u8"    \"zhCN\": \"屠杀者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22372,\n",
+                u8"    \"Key\": \"IceBoar\",\n",
+                u8"    \"enUS\": \"Ice Boar\",\n",
+                u8"    \"zhTW\": \"寒冰僕魔\",\n",
+                u8"    \"deDE\": \"Eiskeiler\",\n",
+                u8"    \"esES\": \"Jabalí de hielo\",\n",
+                u8"    \"frFR\": \"Sanglier de glace\",\n",
+                u8"    \"itIT\": \"Cinghiale Gelido\",\n",
+                u8"    \"koKR\": \"얼음 멧돼지\",\n",
+                u8"    \"plPL\": \"Lodowy bies\",\n",
+                u8"    \"esMX\": \"Verraco de hielo\",\n",
+                u8"    \"jaJP\": \"アイスボア\",\n",
+                u8"    \"ptBR\": \"Javali Gélido\",\n",
+                u8"    \"ruRU\": \"Ледяной вепрь\",\n",
+                u8"    \"zhCN\": \"冰野猪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22373,\n",
+                u8"    \"Key\": \"FireBoar\",\n",
+                u8"    \"enUS\": \"Fire Boar\",\n",
+                u8"    \"zhTW\": \"火焰僕魔\",\n",
+                u8"    \"deDE\": \"Feuerkeiler\",\n",
+                u8"    \"esES\": \"Jabalí de fuego\",\n",
+                u8"    \"frFR\": \"Sanglier de feu\",\n",
+                u8"    \"itIT\": \"Cinghiale Infuocato\",\n",
+                u8"    \"koKR\": \"불 멧돼지\",\n",
+                u8"    \"plPL\": \"Ognisty bies\",\n",
+                u8"    \"esMX\": \"Verraco de fuego\",\n",
+                u8"    \"jaJP\": \"ファイアボア\",\n",
+                u8"    \"ptBR\": \"Javali Ígneo\",\n",
+                u8"    \"ruRU\": \"Огненный вепрь\",\n",
+                u8"    \"zhCN\": \"火野猪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22374,\n",
+                u8"    \"Key\": \"HellSpawn\",\n",
+                u8"    \"enUS\": \"Hell Spawn\",\n",
+                u8"    \"zhTW\": \"地獄爪牙\",\n",
+                u8"    \"deDE\": \"Höllenbrut\",\n",
+                u8"    \"esES\": \"Engendro infernal\",\n",
+                u8"    \"frFR\": \"Engeance infernale\",\n",
+                u8"    \"itIT\": \"Stirpe Infernale\",\n",
+                u8"    \"koKR\": \"지옥 종자\",\n",
+                u8"    \"plPL\": \"Piekielny pomiot\",\n",
+                u8"    \"esMX\": \"Engendro infernal\",\n",
+                u8"    \"jaJP\": \"ヘルスポーン\",\n",
+                u8"    \"ptBR\": \"Cria Infernal\",\n",
+                u8"    \"ruRU\": \"Адская тварь\",\n",
+                u8"    \"zhCN\": \"地狱恶灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22375,\n",
+                u8"    \"Key\": \"IceSpawn\",\n",
+                u8"    \"enUS\": \"Ice Spawn\",\n",
+                u8"    \"zhTW\": \"冰封爪牙\",\n",
+                u8"    \"deDE\": \"Eisbrut\",\n",
+                u8"    \"esES\": \"Engendro helado\",\n",
+                u8"    \"frFR\": \"Engeance de glace\",\n",
+                u8"    \"itIT\": \"Stirpe Gelida\",\n",
+                u8"    \"koKR\": \"얼음 종자\",\n",
+                u8"    \"plPL\": \"Lodowy pomiot\",\n",
+                u8"    \"esMX\": \"Engendro gélido\",\n",
+                u8"    \"jaJP\": \"アイススポーン\",\n",
+                u8"    \"ptBR\": \"Cria Gélida\",\n",
+                u8"    \"ruRU\": \"Ледяная тварь\",\n",
+                u8"    \"zhCN\": \"寒冰恶灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22376,\n",
+                u8"    \"Key\": \"GreaterHellSpawn\",\n",
+                u8"    \"enUS\": \"Greater Hell Spawn\",\n",
+                u8"    \"zhTW\": \"高階地獄爪牙\",\n",
+                u8"    \"deDE\": \"Große Höllenbrut\",\n",
+                u8"    \"esES\": \"Gran engendro infernal\",\n",
+                u8"    \"frFR\": \"Engeance infernale majeure\",\n",
+                u8"    \"itIT\": \"Stirpe Infernale Maggiore\",\n",
+                u8"    \"koKR\": \"상급 지옥 종자\",\n",
+                u8"    \"plPL\": \"Większy piekielny pomiot\",\n",
+                u8"    \"esMX\": \"Engendro infernal superior\",\n",
+                u8"    \"jaJP\": \"グレーター・ヘルスポーン\",\n",
+                u8"    \"ptBR\": \"Cria Infernal Superior\",\n",
+                u8"    \"ruRU\": \"Гигантская адская тварь\",\n",
+                u8"    \"zhCN\": \"大型地狱恶灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22377,\n",
+                u8"    \"Key\": \"GreaterIceSpawn\",\n",
+                u8"    \"enUS\": \"Greater Ice Spawn\",\n",
+                u8"    \"zhTW\": \"高等冰封爪牙\",\n",
+                u8"    \"deDE\": \"Große Eisbrut\",\n",
+                u8"    \"esES\": \"Gran engendro helado\",\n",
+                u8"    \"frFR\": \"Engeance de glace majeure\",\n",
+                u8"    \"itIT\": \"Stirpe Gelida Maggiore\",\n",
+                u8"    \"koKR\": \"상급 얼음 종자\",\n",
+                u8"    \"plPL\": \"Większy lodowy pomiot\",\n",
+                u8"    \"esMX\": \"Engendro gélido superior\",\n",
+                u8"    \"jaJP\": \"グレーター・アイススポーン\",\n",
+                u8"    \"ptBR\": \"Cria Gélida Superior\",\n",
+                u8"    \"ruRU\": \"Гигантская ледяная тварь\",\n",
+                u8"    \"zhCN\": \"大型寒冰恶灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22378,\n",
+                u8"    \"Key\": \"FanaticMinion\",\n",
+                u8"    \"enUS\": \"Fanatic Enslaved\",\n",
+                u8"    \"zhTW\": \"狂熱僕魔\",\n",
+                u8"    \"deDE\": \"Fanatischer Sklave\",\n",
+                u8"    \"esES\": \"Esclavo fanático\",\n",
+                u8"    \"frFR\": \"Servant fanatique\",\n",
+                u8"    \"itIT\": \"Servo Fanatico\",\n",
+                u8"    \"koKR\": \"사로잡힌 광신자\",\n",
+                u8"    \"plPL\": \"Zniewolony fanatyk\",\n",
+                u8"    \"esMX\": \"Fanático esclavo\",\n",
+                u8"    \"jaJP\": \"狂いしエンスレイヴド\",\n",
+                u8"    \"ptBR\": \"[ms]Escravizado Fanático\",\n",
+                u8"    \"ruRU\": \"Порабощенный фанатик\",\n",
+                u8"    \"zhCN\": \"狂热仆魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22379,\n",
+                u8"    \"Key\": \"BerserkSlayer\",\n",
+                u8"    \"enUS\": \"Berserker Slayer\",\n",
+                u8"    \"zhTW\": \"凶暴殺戮僕魔\",\n",
+                u8"    \"deDE\": \"Berserkerschlächter\",\n",
+                u8"    \"esES\": \"Criminal berserker\",\n",
+                u8"    \"frFR\": \"Flagelleur berserker\",\n",
+                u8"    \"itIT\": \"Massacratore Berserker\",\n",
+                u8"    \"koKR\": \"광전사 학살자\",\n",
+                u8"    \"plPL\": \"Berserker pogromca\",\n",
+                u8"    \"esMX\": \"Exterminador vesánico\",\n",
+                u8"    \"jaJP\": \"狂いしスレイヤー\",\n",
+                u8"    \"ptBR\": \"Homicida Berserker\",\n",
+                u8"    \"ruRU\": \"Берсерк-палач\",\n",
+                u8"    \"zhCN\": \"狂暴屠杀者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22380,\n",
+                u8"    \"Key\": \"ConsumedFireBoar\",\n",
+                u8"    \"enUS\": \"Consumed Fire Boar\",\n",
+                u8"    \"zhTW\": \"狂亂寒冰僕魔\",\n",
+                u8"    \"deDE\": \"Verzehrter Feuerkeiler\",\n",
+                u8"    \"esES\": \"Jabalí de fuego consumido\",\n",
+                u8"    \"frFR\": \"Sanglier de feu damné\",\n",
+                u8"    \"itIT\": \"Cinghiale Infuocato Consumato\",\n",
+                u8"    \"koKR\": \"잠식당한 불 멧돼지\",\n",
+                u8"    \"plPL\": \"Przeżarty ognisty bies\",\n",
+                u8"    \"esMX\": \"Verraco de fuego arruinado\",\n",
+                u8"    \"jaJP\": \"侵されしファイアボア\",\n",
+                u8"    \"ptBR\": \"[ms]Javali Ígneo Arruinado\",\n",
+                u8"    \"ruRU\": \"Одержимый огненный вепрь\",\n",
+                u8"    \"zhCN\": \"毁灭的冰野猪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22381,\n",
+                u8"    \"Key\": \"ConsumedIceBoar\",\n",
+                u8"    \"enUS\": \"Consumed Ice Boar\",\n",
+                u8"    \"zhTW\": \"狂亂火焰僕魔\",\n",
+                u8"    \"deDE\": \"Verzehrter Eiskeiler\",\n",
+                u8"    \"esES\": \"Jabalí de hielo consumido\",\n",
+                u8"    \"frFR\": \"Sanglier de glace damné\",\n",
+                u8"    \"itIT\": \"Cinghiale Gelido Consumato\",\n",
+                u8"    \"koKR\": \"잠식당한 얼음 멧돼지\",\n",
+                u8"    \"plPL\": \"Przeżarty lodowy bies\",\n",
+                u8"    \"esMX\": \"Verraco de hielo arruinado\",\n",
+                u8"    \"jaJP\": \"侵されしアイスボア\",\n",
+                u8"    \"ptBR\": \"[ms]Javali Gélido Arruinado\",\n",
+                u8"    \"ruRU\": \"Одержимый ледяной вепрь\",\n",
+                u8"    \"zhCN\": \"毁灭的火野猪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22382,\n",
+                u8"    \"Key\": \"FrenziedHellSpawn\",\n",
+                u8"    \"enUS\": \"Frenzied Hell Spawn\",\n",
+                u8"    \"zhTW\": \"狂怒地獄爪牙\",\n",
+                u8"    \"deDE\": \"Tobsüchtige Höllenbrut\",\n",
+                u8"    \"esES\": \"Engendro infernal desenfrenado\",\n",
+                u8"    \"frFR\": \"Engeance infernale forcenée\",\n",
+                u8"    \"itIT\": \"Stirpe Infernale Frenetica\",\n",
+                u8"    \"koKR\": \"광포한 지옥 종자\",\n",
+                u8"    \"plPL\": \"Oszalały piekielny pomiot\",\n",
+                u8"    \"esMX\": \"Engendro infernal frenético\",\n",
+                u8"    \"jaJP\": \"激昂せしヘルスポーン\",\n",
+                u8"    \"ptBR\": \"Cria Infernal Frenética\",\n",
+                u8"    \"ruRU\": \"Озверевшая адская тварь\",\n",
+                u8"    \"zhCN\": \"狂乱地狱恶灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22383,\n",
+                u8"    \"Key\": \"FrenziedIceSpawn\",\n",
+                u8"    \"enUS\": \"Frenzied Ice Spawn\",\n",
+                u8"    \"zhTW\": \"狂怒冰封爪牙\",\n",
+                u8"    \"deDE\": \"Tobsüchtige Eisbrut\",\n",
+                u8"    \"esES\": \"Engendro helado desenfrenado\",\n",
+                u8"    \"frFR\": \"Engeance de glace forcenée\",\n",
+                u8"    \"itIT\": \"Stirpe Gelida Frenetica\",\n",
+                u8"    \"koKR\": \"광포한 얼음 종자\",\n",
+                u8"    \"plPL\": \"Oszalały lodowy pomiot\",\n",
+                u8"    \"esMX\": \"Engendro gélido frenético\",\n",
+                u8"    \"jaJP\": \"激昂せしアイススポーン\",\n",
+                u8"    \"ptBR\": \"Cria Gélida Frenética\",\n",
+                u8"    \"ruRU\": \"Озверевшая ледяная тварь\",\n",
+                u8"    \"zhCN\": \"狂乱寒冰恶灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22384,\n",
+                u8"    \"Key\": \"InsaneHellSpawn\",\n",
+                u8"    \"enUS\": \"Insane Hell Spawn\",\n",
+                u8"    \"zhTW\": \"瘋狂地獄爪牙\",\n",
+                u8"    \"deDE\": \"Wahnsinnige Höllenbrut\",\n",
+                u8"    \"esES\": \"Engendro infernal demente\",\n",
+                u8"    \"frFR\": \"Engeance infernale aliénée\",\n",
+                u8"    \"itIT\": \"Stirpe Infernale Impazzita\",\n",
+                u8"    \"koKR\": \"미치광이 지옥 종자\",\n",
+                u8"    \"plPL\": \"Szalony piekielny pomiot\",\n",
+                u8"    \"esMX\": \"Engendro infernal demente\",\n",
+                u8"    \"jaJP\": \"惑乱せしヘルスポーン\",\n",
+                u8"    \"ptBR\": \"Cria Infernal Insana\",\n",
+                u8"    \"ruRU\": \"Безумная адская тварь\",\n",
+                u8"    \"zhCN\": \"疯狂地狱恶灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22385,\n",
+                u8"    \"Key\": \"InsaneIceSpawn\",\n",
+                u8"    \"enUS\": \"Insane Ice Spawn\",\n",
+                u8"    \"zhTW\": \"瘋狂冰封爪牙\",\n",
+                u8"    \"deDE\": \"Wahnsinnige Eisbrut\",\n",
+                u8"    \"esES\": \"Engendro helado demente\",\n",
+                u8"    \"frFR\": \"Engeance de glace aliénée\",\n",
+                u8"    \"itIT\": \"Stirpe Gelida Impazzita\",\n",
+                u8"    \"koKR\": \"미치광이 얼음 종자\",\n",
+                u8"    \"plPL\": \"Szalony lodowy pomiot\",\n",
+                u8"    \"esMX\": \"Engendro gélido demente\",\n",
+                u8"    \"jaJP\": \"惑乱せしアイススポーン\",\n",
+                u8"    \"ptBR\": \"Cria Gélida Insana\",\n",
+                u8"    \"ruRU\": \"Безумная ледяная тварь\",\n",
+                u8"    \"zhCN\": \"疯狂寒冰恶灵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22386,\n",
+                u8"    \"Key\": \"Succubusexp\",\n",
+                u8"    \"enUS\": \"Succubus\",\n",
+                u8"    \"zhTW\": \"魅魔\",\n",
+                u8"    \"deDE\": \"Sukkubus\",\n",
+                u8"    \"esES\": \"Súcubo\",\n",
+                u8"    \"frFR\": \"Succube\",\n",
+                u8"    \"itIT\": \"Succube\",\n",
+                u8"    \"koKR\": \"서큐버스\",\n",
+                u8"    \"plPL\": \"Sukkub\",\n",
+                u8"    \"esMX\": \"Súcubo\",\n",
+                u8"    \"jaJP\": \"サキュバス\",\n",
+                u8"    \"ptBR\": \"Súcubo\",\n",
+                u8"    \"ruRU\": \"Суккуб\",\n",
+                u8"    \"zhCN\": \"魅魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22387,\n",
+                u8"    \"Key\": \"VileTemptress\",\n",
+                u8"    \"enUS\": \"Vile Temptress\",\n",
+                u8"    \"zhTW\": \"兇邪妖魅\",\n",
+                u8"    \"deDE\": \"Schändliche Verführerin\",\n",
+                u8"    \"esES\": \"Tentación vil\",\n",
+                u8"    \"frFR\": \"Tentatrice infâme\",\n",
+                u8"    \"itIT\": \"Adescatrice Vile\",\n",
+                u8"    \"koKR\": \"끔찍한 요부\",\n",
+                u8"    \"plPL\": \"Plugawa kusicielka\",\n",
+                u8"    \"esMX\": \"Tentadora vil\",\n",
+                u8"    \"jaJP\": \"ヴァイル・テンプトレス\",\n",
+                u8"    \"ptBR\": \"Sedutora Vil\",\n",
+                u8"    \"ruRU\": \"Порочная искусительница\",\n",
+                u8"    \"zhCN\": \"邪恶妖妇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22388,\n",
+                u8"    \"Key\": \"StygianHarlot\",\n",
+                u8"    \"enUS\": \"Stygian Harlot\",\n",
+                u8"    \"zhTW\": \"冥河淫魅\",\n",
+                u8"    \"deDE\": \"Stygische Hure\",\n",
+                u8"    \"esES\": \"Ramera estigia\",\n",
+                u8"    \"frFR\": \"Catin stygienne\",\n",
+                u8"    \"itIT\": \"Meretrice dello Stige\",\n",
+                u8"    \"koKR\": \"저승 요부\",\n",
+                u8"    \"plPL\": \"Stygijska ladacznica\",\n",
+                u8"    \"esMX\": \"Cortesana estigia\",\n",
+                u8"    \"jaJP\": \"スティジャン・ハーロット\",\n",
+                u8"    \"ptBR\": \"Cortesã Estígia\",\n",
+                u8"    \"ruRU\": \"Стигийская блудница\",\n",
+                u8"    \"zhCN\": \"冥河妖妇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22389,\n",
+                u8"    \"Key\": \"Hell Temptress\",\n",
+                u8"    \"enUS\": \"Hell Temptress\",\n",
+                u8"    \"zhTW\": \"地獄妖魅\",\n",
+                u8"    \"deDE\": \"Höllische Verführerin\",\n",
+                u8"    \"esES\": \"Tentación infernal\",\n",
+                u8"    \"frFR\": \"Tentatrice des Enfers\",\n",
+                u8"    \"itIT\": \"Tentatrice Infernale\",\n",
+                u8"    \"koKR\": \"지옥 요부\",\n",
+                u8"    \"plPL\": \"Piekielna kusicielka\",\n",
+                u8"    \"esMX\": \"Tentadora infernal\",\n",
+                u8"    \"jaJP\": \"ヘル・テンプトレス\",\n",
+                u8"    \"ptBR\": \"Sedutora Infernal\",\n",
+                u8"    \"ruRU\": \"Адская искусительница\",\n",
+                u8"    \"zhCN\": \"地狱妖妇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22390,\n",
+                u8"    \"Key\": \"Blood Temptress\",\n",
+                u8"    \"enUS\": \"Blood Temptress\",\n",
+                u8"    \"zhTW\": \"血腥妖魅\",\n",
+                u8"    \"deDE\": \"Blutverführerin\",\n",
+                u8"    \"esES\": \"Tentación sangrienta\",\n",
+                u8"    \"frFR\": \"Tentatrice de sang\",\n",
+                u8"    \"itIT\": \"Tentatrice del Sangue\",\n",
+                u8"    \"koKR\": \"피의 요부\",\n",
+                u8"    \"plPL\": \"Krwawa kusicielka\",\n",
+                u8"    \"esMX\": \"Tentadora sanguinaria\",\n",
+                u8"    \"jaJP\": \"ブラッド・テンプトレス\",\n",
+                u8"    \"ptBR\": \"Sedutora Sangrenta\",\n",
+                u8"    \"ruRU\": \"Кровавая искусительница\",\n",
+                u8"    \"zhCN\": \"血腥妖妇\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22391,\n",
+                u8"    \"Key\": \"Dominus\",\n",
+                u8"    \"enUS\": \"Siren\",\n",
+                u8"    \"zhTW\": \"賽蓮女妖\",\n",
+                u8"    \"deDE\": \"Sirene\",\n",
+                u8"    \"esES\": \"Sirena\",\n",
+                u8"    \"frFR\": \"Sirène\",\n",
+                u8"    \"itIT\": \"Sirena\",\n",
+                u8"    \"koKR\": \"세이렌\",\n",
+                u8"    \"plPL\": \"Syrena\",\n",
+                u8"    \"esMX\": \"Arpía\",\n",
+                u8"    \"jaJP\": \"セイレーン\",\n",
+                u8"    \"ptBR\": \"Sirena\",\n",
+                u8"    \"ruRU\": \"Сирена\",\n",
+                u8"    \"zhCN\": \"妖女\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22392,\n",
+                u8"    \"Key\": \"VileWitch\",\n",
+                u8"    \"enUS\": \"Vile Witch\",\n",
+                u8"    \"zhTW\": \"兇邪女妖\",\n",
+                u8"    \"deDE\": \"Schändliche Hexe\",\n",
+                u8"    \"esES\": \"Bruja repugnante\",\n",
+                u8"    \"frFR\": \"Sorcière infâme\",\n",
+                u8"    \"itIT\": \"Strega Vile\",\n",
+                u8"    \"koKR\": \"끔찍한 마녀\",\n",
+                u8"    \"plPL\": \"Plugawa wiedźma\",\n",
+                u8"    \"esMX\": \"Bruja vil\",\n",
+                u8"    \"jaJP\": \"ヴァイル・ウィッチ\",\n",
+                u8"    \"ptBR\": \"Bruxa Vil\",\n",
+                u8"    \"ruRU\": \"Злобная ведьма\",\n",
+                u8"    \"zhCN\": \"邪恶女巫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22393,\n",
+                u8"    \"Key\": \"StygianFury\",\n",
+                u8"    \"enUS\": \"Stygian Fury\",\n",
+                u8"    \"zhTW\": \"冥怒女妖\",\n",
+                u8"    \"deDE\": \"Stygische Wut\",\n",
+                u8"    \"esES\": \"Furia estigia\",\n",
+                u8"    \"frFR\": \"Furie stygienne\",\n",
+                u8"    \"itIT\": \"Furia dello Stige\",\n",
+                u8"    \"koKR\": \"저승 마녀\",\n",
+                u8"    \"plPL\": \"Stygijska furia\",\n",
+                u8"    \"esMX\": \"Furia estigia\",\n",
+                u8"    \"jaJP\": \"スティジャン・フューリー\",\n",
+                u8"    \"ptBR\": \"Fúria Estígia\",\n",
+                u8"    \"ruRU\": \"Стигийская фурия\",\n",
+                u8"    \"zhCN\": \"冥河之怒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22394,\n",
+                u8"    \"Key\": \"Blood Witch\",\n",
+                u8"    \"enUS\": \"Blood Witch\",\n",
+                u8"    \"zhTW\": \"血巫女妖\",\n",
+                u8"    \"deDE\": \"Bluthexe\",\n",
+                u8"    \"esES\": \"Bruja sangrienta\",\n",
+                u8"    \"frFR\": \"Sorcière de sang\",\n",
+                u8"    \"itIT\": \"Strega del Sangue\",\n",
+                u8"    \"koKR\": \"피의 마녀\",\n",
+                u8"    \"plPL\": \"Krwawa wiedźma\",\n",
+                u8"    \"esMX\": \"Bruja sanguinaria\",\n",
+                u8"    \"jaJP\": \"ブラッド・ウィッチ\",\n",
+                u8"    \"ptBR\": \"Bruxa Sangrenta\",\n",
+                u8"    \"ruRU\": \"Ведьма крови\",\n",
+                u8"    \"zhCN\": \"血腥女巫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22395,\n",
+                u8"    \"Key\": \"Hell Witch\",\n",
+                u8"    \"enUS\": \"Hell Witch\",\n",
+                u8"    \"zhTW\": \"地獄女妖\",\n",
+                u8"    \"deDE\": \"Höllenhexe\",\n",
+                u8"    \"esES\": \"Bruja infernal\",\n",
+                u8"    \"frFR\": \"Sorcière infernale\",\n",
+                u8"    \"itIT\": \"Strega Infernale\",\n",
+                u8"    \"koKR\": \"지옥 마녀\",\n",
+                u8"    \"plPL\": \"Piekielna wiedźma\",\n",
+                u8"    \"esMX\": \"Bruja infernal\",\n",
+                u8"    \"jaJP\": \"ヘル・ウィッチ\",\n",
+                u8"    \"ptBR\": \"Bruxa Infernal\",\n",
+                u8"    \"ruRU\": \"Адская ведьма\",\n",
+                u8"    \"zhCN\": \"地狱女巫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22396,\n",
+                u8"    \"Key\": \"OverSeer\",\n",
+                u8"    \"enUS\": \"Overseer\",\n",
+                u8"    \"zhTW\": \"督軍\",\n",
+                u8"    \"deDE\": \"Aufseher\",\n",
+                u8"    \"esES\": \"Supervisor\",\n",
+                u8"    \"frFR\": \"Surveillant\",\n",
+                u8"    \"itIT\": \"Sovrintendente\",\n",
+                u8"    \"koKR\": \"감독관\",\n",
+                u8"    \"plPL\": \"Nadzorca\",\n",
+                u8"    \"esMX\": \"Mayoral\",\n",
+                u8"    \"jaJP\": \"オーバーシアー\",\n",
+                u8"    \"ptBR\": \"Capataz\",\n",
+                u8"    \"ruRU\": \"Надзиратель\",\n",
+                u8"    \"zhCN\": \"督军\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22397,\n",
+                u8"    \"Key\": \"Lasher\",\n",
+                u8"    \"enUS\": \"Lasher\",\n",
+                u8"    \"zhTW\": \"鞭笞者\",\n",
+                u8"    \"deDE\": \"Peitscher\",\n",
+                u8"    \"esES\": \"Fustigador\",\n",
+                u8"    \"frFR\": \"Flagellant\",\n",
+                u8"    \"itIT\": \"Flagellatore\",\n",
+                u8"    \"koKR\": \"휘갈이\",\n",
+                u8"    \"plPL\": \"Biczownik\",\n",
+                u8"    \"esMX\": \"Azotador\",\n",
+                u8"    \"jaJP\": \"ラッシャー\",\n",
+                u8"    \"ptBR\": \"Açoitador\",\n",
+                u8"    \"ruRU\": \"Хлестатель\",\n",
+                u8"    \"zhCN\": \"鞭笞者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22398,\n",
+                u8"    \"Key\": \"OverLord\",\n",
+                u8"    \"enUS\": \"Overlord\",\n",
+                u8"    \"zhTW\": \"霸主\",\n",
+                u8"    \"deDE\": \"Kriegsfürst\",\n",
+                u8"    \"esES\": \"Cacique\",\n",
+                u8"    \"frFR\": \"Suzerain\",\n",
+                u8"    \"itIT\": \"Sorvegliante\",\n",
+                u8"    \"koKR\": \"대군주\",\n",
+                u8"    \"plPL\": \"Władca\",\n",
+                u8"    \"esMX\": \"Régulo\",\n",
+                u8"    \"jaJP\": \"オーバーロード\",\n",
+                u8"    \"ptBR\": \"Suserano\",\n",
+                u8"    \"ruRU\": \"Властитель\",\n",
+                u8"    \"zhCN\": \"霸王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22399,\n",
+                u8"    \"Key\": \"BloodBoss\",\n",
+                u8"    \"enUS\": \"Blood Boss\",\n",
+                u8"    \"zhTW\": \"血腥統治者\",\n",
+                u8"    \"deDE\": \"Blutherrscher\",\n",
+                u8"    \"esES\": \"Jefe sangriento\",\n",
+                u8"    \"frFR\": \"Duc de sang\",\n",
+                u8"    \"itIT\": \"Signore del Sangue\",\n",
+                u8"    \"koKR\": \"피의 우두머리\",\n",
+                u8"    \"plPL\": \"Krwawy wódz\",\n",
+                u8"    \"esMX\": \"Jefe sangriento\",\n",
+                u8"    \"jaJP\": \"ブラッド・ボス\",\n",
+                u8"    \"ptBR\": \"[ms]Chefe Sangrento\",\n",
+                u8"    \"ruRU\": \"Кровавый повелитель\",\n",
+                u8"    \"zhCN\": \"鲜血统领\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22400,\n",
+                u8"    \"Key\": \"HellWhip\",\n",
+                u8"    \"enUS\": \"Hell Whip\",\n",
+                u8"    \"zhTW\": \"地獄之鞭\",\n",
+                u8"    \"deDE\": \"Höllenpeitsche\",\n",
+                u8"    \"esES\": \"Fusta infernal\",\n",
+                u8"    \"frFR\": \"Fouet infernal\",\n",
+                u8"    \"itIT\": \"Frusta Infernale\",\n",
+                u8"    \"koKR\": \"지옥 채찍꾼\",\n",
+                u8"    \"plPL\": \"Piekielny biczownik\",\n",
+                u8"    \"esMX\": \"Látigo infernal\",\n",
+                u8"    \"jaJP\": \"ヘル・ウィップ\",\n",
+                u8"    \"ptBR\": \"[ms]Chicote Infernal\",\n",
+                u8"    \"ruRU\": \"Адский бичеватель\",\n",
+                u8"    \"zhCN\": \"地狱鞭\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22401,\n",
+                u8"    \"Key\": \"MinionSpawner\",\n",
+                u8"    \"enUS\": \"Demon Portal\",\n",
+                u8"    \"zhTW\": \"惡魔傳送門\",\n",
+                u8"    \"deDE\": \"Dämonenportal\",\n",
+                u8"    \"esES\": \"Portal demoníaco\",\n",
+                u8"    \"frFR\": \"Porte démoniaque\",\n",
+                u8"    \"itIT\": \"Portale Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 차원문\",\n",
+                u8"    \"plPL\": \"Demoniczny portal\",\n",
+                u8"    \"esMX\": \"Portal demoníaco\",\n",
+                u8"    \"jaJP\": \"悪魔のポータル\",\n",
+                u8"    \"ptBR\": \"[ms]Portal Demoníaco\",\n",
+                u8"    \"ruRU\": \"Демонический портал\",\n",
+                u8"    \"zhCN\": \"恶魔传送门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22402,\n",
+                u8"    \"Key\": \"MinionSlayerSpawner\",\n",
+                u8"    \"enUS\": \"Demon Portal\",\n",
+                u8"    \"zhTW\": \"惡魔傳送門\",\n",
+                u8"    \"deDE\": \"Dämonenportal\",\n",
+                u8"    \"esES\": \"Portal demoníaco\",\n",
+                u8"    \"frFR\": \"Porte démoniaque\",\n",
+                u8"    \"itIT\": \"Portale Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 차원문\",\n",
+                u8"    \"plPL\": \"Demoniczny portal\",\n",
+                u8"    \"esMX\": \"Portal demoníaco\",\n",
+                u8"    \"jaJP\": \"悪魔のポータル\",\n",
+                u8"    \"ptBR\": \"[ms]Portal Demoníaco\",\n",
+                u8"    \"ruRU\": \"Демонический портал\",\n",
+                u8"    \"zhCN\": \"恶魔传送门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22403,\n",
+                u8"    \"Key\": \"MinionIce/fireBoarSpawner\",\n",
+                u8"    \"enUS\": \"Demon Portal\",\n",
+                u8"    \"zhTW\": \"惡魔傳送門\",\n",
+                u8"    \"deDE\": \"Dämonenportal\",\n",
+                u8"    \"esES\": \"Portal demoníaco\",\n",
+                u8"    \"frFR\": \"Porte démoniaque\",\n",
+                u8"    \"itIT\": \"Portale Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 차원문\",\n",
+                u8"    \"plPL\": \"Demoniczny portal\",\n",
+                u8"    \"esMX\": \"Portal demoníaco\",\n",
+                u8"    \"jaJP\": \"悪魔のポータル\",\n",
+                u8"    \"ptBR\": \"[ms]Portal Demoníaco\",\n",
+                u8"    \"ruRU\": \"Демонический портал\",\n",
+                u8"    \"zhCN\": \"恶魔传送门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22404,\n",
+                u8"    \"Key\": \"Minionice/hellSpawnSpawner\",\n",
+                u8"    \"enUS\": \"Demon Portal\",\n",
+                u8"    \"zhTW\": \"惡魔傳送門\",\n",
+                u8"    \"deDE\": \"Dämonenportal\",\n",
+                u8"    \"esES\": \"Portal demoníaco\",\n",
+                u8"    \"frFR\": \"Porte démoniaque\",\n",
+                u8"    \"itIT\": \"Portale Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 차원문\",\n",
+                u8"    \"plPL\": \"Demoniczny portal\",\n",
+                u8"    \"esMX\": \"Portal demoníaco\",\n",
+                u8"    \"jaJP\": \"悪魔のポータル\",\n",
+                u8"    \"ptBR\": \"[ms]Portal Demoníaco\",\n",
+                u8"    \"ruRU\": \"Демонический портал\",\n",
+                u8"    \"zhCN\": \"恶魔传送门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22405,\n",
+                u8"    \"Key\": \"MinionGreaterIce/hellSpawnSpawner\",\n",
+                u8"    \"enUS\": \"Demon Portal\",\n",
+                u8"    \"zhTW\": \"惡魔傳送門\",\n",
+                u8"    \"deDE\": \"Dämonenportal\",\n",
+                u8"    \"esES\": \"Portal demoníaco\",\n",
+                u8"    \"frFR\": \"Portail démoniaque\",\n",
+                u8"    \"itIT\": \"Portale Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 차원문\",\n",
+                u8"    \"plPL\": \"Demoniczny portal\",\n",
+                u8"    \"esMX\": \"Portal demoníaco\",\n",
+                u8"    \"jaJP\": \"悪魔のポータル\",\n",
+                u8"    \"ptBR\": \"Portal Demoníaco\",\n",
+                u8"    \"ruRU\": \"Демонический портал\",\n",
+                u8"    \"zhCN\": \"恶魔传送门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22406,\n",
+                u8"    \"Key\": \"Imp1\",\n",
+                u8"    \"enUS\": \"Demon Imp\",\n",
+                u8"    \"zhTW\": \"惡魔小鬼\",\n",
+                u8"    \"deDE\": \"Dämonenkobold\",\n",
+                u8"    \"esES\": \"Diablillo demoníaco\",\n",
+                u8"    \"frFR\": \"Diablotin\",\n",
+                u8"    \"itIT\": \"Folletto Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 임프\",\n",
+                u8"    \"plPL\": \"Demoniczny chochlik\",\n",
+                u8"    \"esMX\": \"Diablillo demoníaco\",\n",
+                u8"    \"jaJP\": \"デーモン・インプ\",\n",
+                u8"    \"ptBR\": \"[ms]Diabrete Demoníaco\",\n",
+                u8"    \"ruRU\": \"Бес\",\n",
+                u8"    \"zhCN\": \"恶魔小鬼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22407,\n",
+                u8"    \"Key\": \"Imp2\",\n",
+                u8"    \"enUS\": \"Demon Rascal\",\n",
+                u8"    \"zhTW\": \"嘍囉小鬼\",\n",
+                u8"    \"deDE\": \"Dämonenhalunke\",\n",
+                u8"    \"esES\": \"Granuja demoníaco\",\n",
+                u8"    \"frFR\": \"Racaille démoniaque\",\n",
+                u8"    \"itIT\": \"Briccone Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 불한당\",\n",
+                u8"    \"plPL\": \"Demoniczna kreatura\",\n",
+                u8"    \"esMX\": \"Granuja demoníaco\",\n",
+                u8"    \"jaJP\": \"デーモン・ラスカル\",\n",
+                u8"    \"ptBR\": \"[ms]Peralta Demoníaco\",\n",
+                u8"    \"ruRU\": \"Проказник\",\n",
+                u8"    \"zhCN\": \"恶魔喽啰\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22408,\n",
+                u8"    \"Key\": \"Imp3\",\n",
+                u8"    \"enUS\": \"Demon Gremlin\",\n",
+                u8"    \"zhTW\": \"妖魔小鬼\",\n",
+                u8"    \"deDE\": \"Dämonengremlin\",\n",
+                u8"    \"esES\": \"Duendecillo demoníaco\",\n",
+                u8"    \"frFR\": \"Gremlin\",\n",
+                u8"    \"itIT\": \"Gremlin Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 그렘린\",\n",
+                u8"    \"plPL\": \"Demoniczny gremlin\",\n",
+                u8"    \"esMX\": \"Duende demoníaco\",\n",
+                u8"    \"jaJP\": \"デーモン・グレムリン\",\n",
+                u8"    \"ptBR\": \"[ms]Gremlin Demoníaco\",\n",
+                u8"    \"ruRU\": \"Гремлин\",\n",
+                u8"    \"zhCN\": \"恶魔妖精\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22409,\n",
+                u8"    \"Key\": \"Imp4\",\n",
+                u8"    \"enUS\": \"Demon Trickster\",\n",
+                u8"    \"zhTW\": \"欺瞞小鬼\",\n",
+                u8"    \"deDE\": \"Dämonenschwindler\",\n",
+                u8"    \"esES\": \"Pillo demoníaco\",\n",
+                u8"    \"frFR\": \"Entourloupeur\",\n",
+                u8"    \"itIT\": \"Rinnegato Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 말썽꾼\",\n",
+                u8"    \"plPL\": \"Demoniczny szachraj\",\n",
+                u8"    \"esMX\": \"Embustero demoníaco\",\n",
+                u8"    \"jaJP\": \"デーモン・トリックスター\",\n",
+                u8"    \"ptBR\": \"[ms]Trapaceiro Demoníaco\",\n",
+                u8"    \"ruRU\": \"Трикстер\",\n",
+                u8"    \"zhCN\": \"恶魔骗徒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22410,\n",
+                u8"    \"Key\": \"Imp5\",\n",
+                u8"    \"enUS\": \"Demon Sprite\",\n",
+                u8"    \"zhTW\": \"精怪小鬼\",\n",
+                u8"    \"deDE\": \"Dämonengeist\",\n",
+                u8"    \"esES\": \"Trasgo demoníaco\",\n",
+                u8"    \"frFR\": \"Korrigan\",\n",
+                u8"    \"itIT\": \"Spiritello Demoniaco\",\n",
+                u8"    \"koKR\": \"악마 요마\",\n",
+                u8"    \"plPL\": \"Demoniczny skrzat\",\n",
+                u8"    \"esMX\": \"Duendecillo demoníaco\",\n",
+                u8"    \"jaJP\": \"デーモン・スプライト\",\n",
+                u8"    \"ptBR\": \"[ms]Duende Demoníaco\",\n",
+                u8"    \"ruRU\": \"Демонический дух\",\n",
+                u8"    \"zhCN\": \"恶魔顽徒\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22411,\n",
+                u8"    \"Key\": \"CatapultN\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22412,\n",
+                u8"    \"Key\": \"CatapultS\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"[fs]Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22413,\n",
+                u8"    \"Key\": \"CatapultE\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22414,\n",
+                u8"    \"Key\": \"CatapultW\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22415,\n",
+                u8"    \"Key\": \"Frozen Horror1\",\n",
+                u8"    \"enUS\": \"Frozen Creeper\",\n",
+                u8"    \"zhTW\": \"爬行冰怪\",\n",
+                u8"    \"deDE\": \"Frostkriecher\",\n",
+                u8"    \"esES\": \"Depredador helado\",\n",
+                u8"    \"frFR\": \"Rampant des glaces\",\n",
+                u8"    \"itIT\": \"Bestia Congelata\",\n",
+                u8"    \"koKR\": \"얼어붙은 땅지기\",\n",
+                u8"    \"plPL\": \"Zlodowaciały pełzacz\",\n",
+                u8"    \"esMX\": \"Pavor congelado\",\n",
+                u8"    \"jaJP\": \"フローズン・クリーパー\",\n",
+                u8"    \"ptBR\": \"[ms]Rastejante Congelado\",\n",
+                u8"    \"ruRU\": \"Ледяной ходок\",\n",
+                u8"    \"zhCN\": \"冰霜爬行者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22416,\n",
+                u8"    \"Key\": \"Frozen Horror2\",\n",
+                u8"    \"enUS\": \"Frozen Terror\",\n",
+                u8"    \"zhTW\": \"恐怖冰怪\",\n",
+                u8"    \"deDE\": \"Frostschrecken\",\n",
+                u8"    \"esES\": \"Terror helado\",\n",
+                u8"    \"frFR\": \"Terreur des glaces\",\n",
+                u8"    \"itIT\": \"Terrore Congelato\",\n",
+                u8"    \"koKR\": \"얼어붙은 공포\",\n",
+                u8"    \"plPL\": \"Zlodowaciała groza\",\n",
+                u8"    \"esMX\": \"Terror congelado\",\n",
+                u8"    \"jaJP\": \"フローズン・テラー\",\n",
+                u8"    \"ptBR\": \"[ms]Terror Congelado\",\n",
+                u8"    \"ruRU\": \"Ледяной кошмар\",\n",
+                u8"    \"zhCN\": \"冰霜恐魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22417,\n",
+                u8"    \"Key\": \"Frozen Horror3\",\n",
+                u8"    \"enUS\": \"Frozen Scourge\",\n",
+                u8"    \"zhTW\": \"禍害冰怪\",\n",
+                u8"    \"deDE\": \"Frostgeißel\",\n",
+                u8"    \"esES\": \"Azote helado\",\n",
+                u8"    \"frFR\": \"Ladre des glaces\",\n",
+                u8"    \"itIT\": \"Flagello Congelato\",\n",
+                u8"    \"koKR\": \"얼어붙은 재앙\",\n",
+                u8"    \"plPL\": \"Zlodowaciała zmora\",\n",
+                u8"    \"esMX\": \"Flagelo congelado\",\n",
+                u8"    \"jaJP\": \"フローズン・スカージ\",\n",
+                u8"    \"ptBR\": \"[ms]Flagelo Congelado\",\n",
+                u8"    \"ruRU\": \"Ледяное отродье\",\n",
+                u8"    \"zhCN\": \"冰霜造劫者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22418,\n",
+                u8"    \"Key\": \"Frozen Horror4\",\n",
+                u8"    \"enUS\": \"Frozen Horror\",\n",
+                u8"    \"zhTW\": \"驚恐冰怪\",\n",
+                u8"    \"deDE\": \"Frostgrauen\",\n",
+                u8"    \"esES\": \"Horror helado\",\n",
+                u8"    \"frFR\": \"Horreur des glaces\",\n",
+                u8"    \"itIT\": \"Orrore Congelato\",\n",
+                u8"    \"koKR\": \"얼어붙은 공포\",\n",
+                u8"    \"plPL\": \"Zlodowaciały koszmar\",\n",
+                u8"    \"esMX\": \"Horror congelado\",\n",
+                u8"    \"jaJP\": \"フローズン・ホラー\",\n",
+                u8"    \"ptBR\": \"[ms]Horror Congelado\",\n",
+                u8"    \"ruRU\": \"Ледяной ужас\",\n",
+                u8"    \"zhCN\": \"冰霜骇魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22419,\n",
+                u8"    \"Key\": \"Frozen Horror5\",\n",
+                u8"    \"enUS\": \"Frozen Scorch\",\n",
+                u8"    \"zhTW\": \"焦凍冰怪\",\n",
+                u8"    \"deDE\": \"Frostversenger\",\n",
+                u8"    \"esES\": \"Quemadura helada\",\n",
+                u8"    \"frFR\": \"Coureur des glaces\",\n",
+                u8"    \"itIT\": \"Inceneritore Congelato\",\n",
+                u8"    \"koKR\": \"얼어붙은 불덩이\",\n",
+                u8"    \"plPL\": \"Zlodowaciały żar\",\n",
+                u8"    \"esMX\": \"Azote congelado\",\n",
+                u8"    \"jaJP\": \"フローズン・スコルチ\",\n",
+                u8"    \"ptBR\": \"[ms]Braseiro Congelado\",\n",
+                u8"    \"ruRU\": \"Ледяной выжигатель\",\n",
+                u8"    \"zhCN\": \"冰霜焦枯魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22420,\n",
+                u8"    \"Key\": \"Blood Lord1\",\n",
+                u8"    \"enUS\": \"Moon Lord\",\n",
+                u8"    \"zhTW\": \"月族統領\",\n",
+                u8"    \"deDE\": \"Mondfürst\",\n",
+                u8"    \"esES\": \"Señor de la luna\",\n",
+                u8"    \"frFR\": \"Seigneur de la Lune\",\n",
+                u8"    \"itIT\": \"Signore della Luna\",\n",
+                u8"    \"koKR\": \"달의 군주\",\n",
+                u8"    \"plPL\": \"Władca księżyca\",\n",
+                u8"    \"esMX\": \"Señor lunar\",\n",
+                u8"    \"jaJP\": \"月の闘将\",\n",
+                u8"    \"ptBR\": \"[ms]Senhor Lunar\",\n",
+                u8"    \"ruRU\": \"Владыка луны\",\n",
+                u8"    \"zhCN\": \"月王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22421,\n",
+                u8"    \"Key\": \"Blood Lord2\",\n",
+                u8"    \"enUS\": \"Night Lord\",\n",
+                u8"    \"zhTW\": \"夜族統領\",\n",
+                u8"    \"deDE\": \"Nachtfürst\",\n",
+                u8"    \"esES\": \"Señor de la noche\",\n",
+                u8"    \"frFR\": \"Seigneur de la Nuit\",\n",
+                u8"    \"itIT\": \"Signore della Notte\",\n",
+                u8"    \"koKR\": \"밤의 군주\",\n",
+                u8"    \"plPL\": \"Władca nocy\",\n",
+                u8"    \"esMX\": \"Señor nocturno\",\n",
+                u8"    \"jaJP\": \"夜の闘将\",\n",
+                u8"    \"ptBR\": \"[ms]Senhor Noturno\",\n",
+                u8"    \"ruRU\": \"Владыка ночи\",\n",
+                u8"    \"zhCN\": \"夜王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22422,\n",
+                u8"    \"Key\": \"Blood Lord3\",\n",
+                u8"    \"enUS\": \"Blood Lord\",\n",
+                u8"    \"zhTW\": \"血族統領\",\n",
+                u8"    \"deDE\": \"Blutfürst\",\n",
+                u8"    \"esES\": \"Señor de la sangre\",\n",
+                u8"    \"frFR\": \"Seigneur du Sang\",\n",
+                u8"    \"itIT\": \"Signore del Sangue\",\n",
+                u8"    \"koKR\": \"피의 군주\",\n",
+                u8"    \"plPL\": \"Władca krwi\",\n",
+                u8"    \"esMX\": \"Señor sangriento\",\n",
+                u8"    \"jaJP\": \"血の闘将\",\n",
+                u8"    \"ptBR\": \"[ms]Senhor Sangrento\",\n",
+                u8"    \"ruRU\": \"Владыка крови\",\n",
+                u8"    \"zhCN\": \"血王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22423,\n",
+                u8"    \"Key\": \"Blood Lord4\",\n",
+                u8"    \"enUS\": \"Hell Lord\",\n",
+                u8"    \"zhTW\": \"冥府統領\",\n",
+                u8"    \"deDE\": \"Höllenfürst\",\n",
+                u8"    \"esES\": \"Señor del infierno\",\n",
+                u8"    \"frFR\": \"Seigneur des Enfers\",\n",
+                u8"    \"itIT\": \"Signore degli Inferi\",\n",
+                u8"    \"koKR\": \"지옥 군주\",\n",
+                u8"    \"plPL\": \"Władca piekła\",\n",
+                u8"    \"esMX\": \"Señor infernal\",\n",
+                u8"    \"jaJP\": \"地獄の闘将\",\n",
+                u8"    \"ptBR\": \"[ms]Senhor Infernal\",\n",
+                u8"    \"ruRU\": \"Владыка ада\",\n",
+                u8"    \"zhCN\": \"地狱王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22424,\n",
+                u8"    \"Key\": \"Blood Lord5\",\n",
+                u8"    \"enUS\": \"Death Lord\",\n",
+                u8"    \"zhTW\": \"死族統領\",\n",
+                u8"    \"deDE\": \"Todesfürst\",\n",
+                u8"    \"esES\": \"Señor de la muerte\",\n",
+                u8"    \"frFR\": \"Seigneur de la Mort\",\n",
+                u8"    \"itIT\": \"Signore della Morte\",\n",
+                u8"    \"koKR\": \"죽음의 군주\",\n",
+                u8"    \"plPL\": \"Władca śmierci\",\n",
+                u8"    \"esMX\": \"Señor de la muerte\",\n",
+                u8"    \"jaJP\": \"死の闘将\",\n",
+                u8"    \"ptBR\": \"[ms]Senhor Fúnebre\",\n",
+                u8"    \"ruRU\": \"Владыка смерти\",\n",
+                u8"    \"zhCN\": \"煞王\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22425,\n",
+                u8"    \"Key\": \"Catapult Spotter N\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22426,\n",
+                u8"    \"Key\": \"Catapult Spotter S\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22427,\n",
+                u8"    \"Key\": \"Catapult Spotter E\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22428,\n",
+                u8"    \"Key\": \"Catapult Spotter W\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22429,\n",
+                u8"    \"Key\": \"Catapult Spotter Siege\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22430,\n",
+                u8"    \"Key\": \"CatapultSiege\",\n",
+                u8"    \"enUS\": \"Catapult\",\n",
+                u8"    \"zhTW\": \"投石機\",\n",
+                u8"    \"deDE\": \"Katapult\",\n",
+                u8"    \"esES\": \"Catapulta\",\n",
+                u8"    \"frFR\": \"Catapulte\",\n",
+                u8"    \"itIT\": \"Catapulta\",\n",
+                u8"    \"koKR\": \"투석기\",\n",
+                u8"    \"plPL\": \"Katapulta\",\n",
+                u8"    \"esMX\": \"Catapulta\",\n",
+                u8"    \"jaJP\": \"投石機\",\n",
+                u8"    \"ptBR\": \"Catapulta\",\n",
+                u8"    \"ruRU\": \"Катапульта\",\n",
+                u8"    \"zhCN\": \"投石器\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22431,\n",
+                u8"    \"Key\": \"Barricade Wall Right\",\n",
+                u8"    \"enUS\": \"Barricade\",\n",
+                u8"    \"zhTW\": \"防禦工事\",\n",
+                u8"    \"deDE\": \"Barrikade\",\n",
+                u8"    \"esES\": \"Barricada\",\n",
+                u8"    \"frFR\": \"Barricade\",\n",
+                u8"    \"itIT\": \"Barricata\",\n",
+                u8"    \"koKR\": \"방벽\",\n",
+                u8"    \"plPL\": \"Barykada\",\n",
+                u8"    \"esMX\": \"Barricada\",\n",
+                u8"    \"jaJP\": \"バリケード\",\n",
+                u8"    \"ptBR\": \"Barricada\",\n",
+                u8"    \"ruRU\": \"Баррикада\",\n",
+                u8"    \"zhCN\": \"壁障\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22432,\n",
+                u8"    \"Key\": \"Barricade Wall Left\",\n",
+                u8"    \"enUS\": \"Barricade\",\n",
+                u8"    \"zhTW\": \"防禦工事\",\n",
+                u8"    \"deDE\": \"Barrikade\",\n",
+                u8"    \"esES\": \"Barricada\",\n",
+                u8"    \"frFR\": \"Barricade\",\n",
+                u8"    \"itIT\": \"Barricata\",\n",
+                u8"    \"koKR\": \"방벽\",\n",
+                u8"    \"plPL\": \"Barykada\",\n",
+                u8"    \"esMX\": \"Barricada\",\n",
+                u8"    \"jaJP\": \"バリケード\",\n",
+                u8"    \"ptBR\": \"Barricada\",\n",
+                u8"    \"ruRU\": \"Баррикада\",\n",
+                u8"    \"zhCN\": \"壁障\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22433,\n",
+                u8"    \"Key\": \"Barricade Door\",\n",
+                u8"    \"enUS\": \"Barricaded Door\",\n",
+                u8"    \"zhTW\": \"封住的門\",\n",
+                u8"    \"deDE\": \"Verbarrikadierte Tür\",\n",
+                u8"    \"esES\": \"Puerta con barricada\",\n",
+                u8"    \"frFR\": \"Porte barricadée\",\n",
+                u8"    \"itIT\": \"Porta Sbarrata\",\n",
+                u8"    \"koKR\": \"차단문\",\n",
+                u8"    \"plPL\": \"Zabarykadowane drzwi\",\n",
+                u8"    \"esMX\": \"Puerta obstruida\",\n",
+                u8"    \"jaJP\": \"封鎖された扉\",\n",
+                u8"    \"ptBR\": \"Porta Bloqueada\",\n",
+                u8"    \"ruRU\": \"Заваленная дверь\",\n",
+                u8"    \"zhCN\": \"封堵的大门\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22434,\n",
+                u8"    \"Key\": \"Barricade Tower\",\n",
+                u8"    \"enUS\": \"Barricaded Tower\",\n",
+                u8"    \"zhTW\": \"防禦塔\",\n",
+                u8"    \"deDE\": \"Verbarrikadierter Turm\",\n",
+                u8"    \"esES\": \"Torre con barricada\",\n",
+                u8"    \"frFR\": \"Tour barricadée\",\n",
+                u8"    \"itIT\": \"Torre Barricata\",\n",
+                u8"    \"koKR\": \"방벽으로 막힌 탑\",\n",
+                u8"    \"plPL\": \"Zabarykadowana wieża\",\n",
+                u8"    \"esMX\": \"Torre obstruida\",\n",
+                u8"    \"jaJP\": \"バリケード・タワー\",\n",
+                u8"    \"ptBR\": \"Torre Bloqueada\",\n",
+                u8"    \"ruRU\": \"Заваленная башня\",\n",
+                u8"    \"zhCN\": \"封堵的塔楼\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22435,\n",
+                u8"    \"Key\": \"Siege Boss\",\n",
+                u8"    \"enUS\": \"Shenk the Overseer\",\n",
+                u8"    \"zhTW\": \"督軍山克\",\n",
+                u8"    \"deDE\": \"Schenk der Aufseher\",\n",
+                u8"    \"esES\": \"Shenk, el que todo lo ve\",\n",
+                u8"    \"frFR\": \"Shenk le surveillant\",\n",
+                u8"    \"itIT\": \"Shenk il Sovrintendente\",\n",
+                u8"    \"koKR\": \"감독관 쉔크\",\n",
+                u8"    \"plPL\": \"Shenk Nadzorca\",\n",
+                u8"    \"esMX\": \"Shenk el Mayoral\",\n",
+                u8"    \"jaJP\": \"監視者シェンク\",\n",
+                u8"    \"ptBR\": \"Shenk, o Capataz\",\n",
+                u8"    \"ruRU\": \"Шенк Надзиратель\",\n",
+                u8"    \"zhCN\": \"督军山克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22436,\n",
+                u8"    \"Key\": \"Evil hut\",\n",
+                u8"    \"enUS\": \"Evil Demon Hut\",\n",
+                u8"    \"zhTW\": \"邪惡魔屋\",\n",
+                u8"    \"deDE\": \"Hütte des bösen Dämons\",\n",
+                u8"    \"esES\": \"Cabaña demoníaca\",\n",
+                u8"    \"frFR\": \"Hutte de démon maléfique\",\n",
+                u8"    \"itIT\": \"Rifugio dei Demoni Maligni\",\n",
+                u8"    \"koKR\": \"사악한 악마 오두막\",\n",
+                u8"    \"plPL\": \"Siedziba demonów\",\n",
+                u8"    \"esMX\": \"Cabaña de los Demonios malignos\",\n",
+                u8"    \"jaJP\": \"悪鬼の巣\",\n",
+                u8"    \"ptBR\": \"Cabana de Demônio Malévolo\",\n",
+                u8"    \"ruRU\": \"Лачуга злобных демонов\",\n",
+                u8"    \"zhCN\": \"邪魔小屋\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22437,\n",
+                u8"    \"Key\": \"Death Mauler1\",\n",
+                u8"    \"enUS\": \"Death Mauler\",\n",
+                u8"    \"zhTW\": \"亡軍重擊魔\",\n",
+                u8"    \"deDE\": \"Todesprügler\",\n",
+                u8"    \"esES\": \"Vapuleador mortal\",\n",
+                u8"    \"frFR\": \"Marteleur de la Mort\",\n",
+                u8"    \"itIT\": \"Massacratore Mortale\",\n",
+                u8"    \"koKR\": \"죽음의 망치주먹\",\n",
+                u8"    \"plPL\": \"Oprawca śmierci\",\n",
+                u8"    \"esMX\": \"Mutilador letal\",\n",
+                u8"    \"jaJP\": \"デス・モーラー\",\n",
+                u8"    \"ptBR\": \"Marretador Fúnebre\",\n",
+                u8"    \"ruRU\": \"Жуткий терзатель\",\n",
+                u8"    \"zhCN\": \"重殴触手魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22438,\n",
+                u8"    \"Key\": \"Death Mauler2\",\n",
+                u8"    \"enUS\": \"Death Brawler\",\n",
+                u8"    \"zhTW\": \"亡軍征戰者\",\n",
+                u8"    \"deDE\": \"Todeszänker\",\n",
+                u8"    \"esES\": \"Luchador mortal\",\n",
+                u8"    \"frFR\": \"Bastonneur de la Mort\",\n",
+                u8"    \"itIT\": \"Lottatore Mortale\",\n",
+                u8"    \"koKR\": \"죽음의 싸움꾼\",\n",
+                u8"    \"plPL\": \"Warchoł śmierci\",\n",
+                u8"    \"esMX\": \"Retador letal\",\n",
+                u8"    \"jaJP\": \"デス・ブローラー\",\n",
+                u8"    \"ptBR\": \"[ms]Briguento Fúnebre\",\n",
+                u8"    \"ruRU\": \"Жуткий задира\",\n",
+                u8"    \"zhCN\": \"殴斗触手魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22439,\n",
+                u8"    \"Key\": \"Death Mauler3\",\n",
+                u8"    \"enUS\": \"Death Slasher\",\n",
+                u8"    \"zhTW\": \"亡軍斬殺者\",\n",
+                u8"    \"deDE\": \"Todesschlitzer\",\n",
+                u8"    \"esES\": \"Asesino mortal\",\n",
+                u8"    \"frFR\": \"Entailleur de la Mort\",\n",
+                u8"    \"itIT\": \"Squartatore Mortale\",\n",
+                u8"    \"koKR\": \"죽음의 난도질꾼\",\n",
+                u8"    \"plPL\": \"Rozrzynacz śmierci\",\n",
+                u8"    \"esMX\": \"Degollador letal\",\n",
+                u8"    \"jaJP\": \"デス・スラッシャー\",\n",
+                u8"    \"ptBR\": \"[ms]Retalhador Fúnebre\",\n",
+                u8"    \"ruRU\": \"Жуткий раздиратель\",\n",
+                u8"    \"zhCN\": \"挥砍触手魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22440,\n",
+                u8"    \"Key\": \"Death Mauler4\",\n",
+                u8"    \"enUS\": \"Death Berserker\",\n",
+                u8"    \"zhTW\": \"亡軍狂戰士\",\n",
+                u8"    \"deDE\": \"Todesberserker\",\n",
+                u8"    \"esES\": \"Berserker mortal\",\n",
+                u8"    \"frFR\": \"Berserker de la Mort\",\n",
+                u8"    \"itIT\": \"Berserker Mortale\",\n",
+                u8"    \"koKR\": \"죽음의 광전사\",\n",
+                u8"    \"plPL\": \"Berserker śmierci\",\n",
+                u8"    \"esMX\": \"Vesánico letal\",\n",
+                u8"    \"jaJP\": \"デス・バーサーカー\",\n",
+                u8"    \"ptBR\": \"[ms]Berserker Fúnebre\",\n",
+                u8"    \"ruRU\": \"Берсерк смерти\",\n",
+                u8"    \"zhCN\": \"狂暴触手魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22441,\n",
+                u8"    \"Key\": \"Death Mauler5\",\n",
+                u8"    \"enUS\": \"Death Brigadier\",\n",
+                u8"    \"zhTW\": \"亡軍戰將\",\n",
+                u8"    \"deDE\": \"Todesbrigadier\",\n",
+                u8"    \"esES\": \"Brigada mortal\",\n",
+                u8"    \"frFR\": \"Brigadier de la Mort\",\n",
+                u8"    \"itIT\": \"Generale Mortale\",\n",
+                u8"    \"koKR\": \"죽음의 지휘관\",\n",
+                u8"    \"plPL\": \"Żołnierz śmierci\",\n",
+                u8"    \"esMX\": \"Brigadier letal\",\n",
+                u8"    \"jaJP\": \"デス・ブリガディア\",\n",
+                u8"    \"ptBR\": \"General Fúnebre\",\n",
+                u8"    \"ruRU\": \"Жуткий офицер\",\n",
+                u8"    \"zhCN\": \"触手魔头\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22442,\n",
+                u8"    \"Key\": \"SnowYeti1\",\n",
+                u8"    \"enUS\": \"Snow Drifter\",\n",
+                u8"    \"zhTW\": \"雪原雪怪\",\n",
+                u8"    \"deDE\": \"Schneetreiber\",\n",
+                u8"    \"esES\": \"Errante níveo\",\n",
+                u8"    \"frFR\": \"Yéti errant\",\n",
+                u8"    \"itIT\": \"Viandante delle Nevi\",\n",
+                u8"    \"koKR\": \"눈 떠돌이\",\n",
+                u8"    \"plPL\": \"Śniegowy tułacz\",\n",
+                u8"    \"esMX\": \"Errante glacial\",\n",
+                u8"    \"jaJP\": \"スノー・ドリフター\",\n",
+                u8"    \"ptBR\": \"Errante Glacial\",\n",
+                u8"    \"ruRU\": \"Снежный скиталец\",\n",
+                u8"    \"zhCN\": \"冰雪流民\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22443,\n",
+                u8"    \"Key\": \"SnowYeti2\",\n",
+                u8"    \"enUS\": \"Abominable\",\n",
+                u8"    \"zhTW\": \"厚毛雪怪\",\n",
+                u8"    \"deDE\": \"Abschaum\",\n",
+                u8"    \"esES\": \"Abominable\",\n",
+                u8"    \"frFR\": \"Yéti abominable\",\n",
+                u8"    \"itIT\": \"Abominevole\",\n",
+                u8"    \"koKR\": \"흉물\",\n",
+                u8"    \"plPL\": \"Plugawiec\",\n",
+                u8"    \"esMX\": \"Abominable\",\n",
+                u8"    \"jaJP\": \"アボミナブル\",\n",
+                u8"    \"ptBR\": \"Abominável\",\n",
+                u8"    \"ruRU\": \"Отвратный\",\n",
+                u8"    \"zhCN\": \"雪毛怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22444,\n",
+                u8"    \"Key\": \"SnowYeti3\",\n",
+                u8"    \"enUS\": \"Chilled Froth\",\n",
+                u8"    \"zhTW\": \"寒冰霜\",\n",
+                u8"    \"deDE\": \"Frostschaum\",\n",
+                u8"    \"esES\": \"Espuma gélida\",\n",
+                u8"    \"frFR\": \"Yéti glacial\",\n",
+                u8"    \"itIT\": \"Schiumante Gelido\",\n",
+                u8"    \"koKR\": \"한기서린 거품\",\n",
+                u8"    \"plPL\": \"Lodowe monstrum\",\n",
+                u8"    \"esMX\": \"Espuma helada\",\n",
+                u8"    \"jaJP\": \"チルド・フロス\",\n",
+                u8"    \"ptBR\": \"Espuma Gélida\",\n",
+                u8"    \"ruRU\": \"Замерзшая пена\",\n",
+                u8"    \"zhCN\": \"冰涎怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22445,\n",
+                u8"    \"Key\": \"SnowYeti4\",\n",
+                u8"    \"enUS\": \"Frozen Abyss\",\n",
+                u8"    \"zhTW\": \"冰封雪怪\",\n",
+                u8"    \"deDE\": \"Frostkluft\",\n",
+                u8"    \"esES\": \"Abismo helado\",\n",
+                u8"    \"frFR\": \"Yéti abyssal\",\n",
+                u8"    \"itIT\": \"Mostro degli Abissi\",\n",
+                u8"    \"koKR\": \"얼어붙은 심연\",\n",
+                u8"    \"plPL\": \"Bestia mrozu\",\n",
+                u8"    \"esMX\": \"Abisal congelado\",\n",
+                u8"    \"jaJP\": \"フローズン・アビス\",\n",
+                u8"    \"ptBR\": \"Abissal Congelado\",\n",
+                u8"    \"ruRU\": \"Ледяная бездна\",\n",
+                u8"    \"zhCN\": \"冰封冥渊怪\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22446,\n",
+                u8"    \"Key\": \"Baal Throne\",\n",
+                u8"    \"enUS\": \"Baal\",\n",
+                u8"    \"zhTW\": \"巴爾\",\n",
+                u8"    \"deDE\": \"Baal\",\n",
+                u8"    \"esES\": \"Baal\",\n",
+                u8"    \"frFR\": \"Baal\",\n",
+                u8"    \"itIT\": \"Baal\",\n",
+                u8"    \"koKR\": \"바알\",\n",
+                u8"    \"plPL\": \"Baal\",\n",
+                u8"    \"esMX\": \"Baal\",\n",
+                u8"    \"jaJP\": \"バール\",\n",
+                u8"    \"ptBR\": \"Baal\",\n",
+                u8"    \"ruRU\": \"Баал\",\n",
+                u8"    \"zhCN\": \"巴尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22447,\n",
+                u8"    \"Key\": \"Baal Crab\",\n",
+                u8"    \"enUS\": \"Baal\",\n",
+                u8"    \"zhTW\": \"巴爾\",\n",
+                u8"    \"deDE\": \"Baal\",\n",
+                u8"    \"esES\": \"Baal\",\n",
+                u8"    \"frFR\": \"Baal\",\n",
+                u8"    \"itIT\": \"Baal\",\n",
+                u8"    \"koKR\": \"바알\",\n",
+                u8"    \"plPL\": \"Baal\",\n",
+                u8"    \"esMX\": \"Baal\",\n",
+                u8"    \"jaJP\": \"バール\",\n",
+                u8"    \"ptBR\": \"Baal\",\n",
+                u8"    \"ruRU\": \"Баал\",\n",
+                u8"    \"zhCN\": \"巴尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22448,\n",
+                u8"    \"Key\": \"Baal Taunt\",\n",
+                u8"    \"enUS\": \"Baal\",\n",
+                u8"    \"zhTW\": \"巴爾\",\n",
+                u8"    \"deDE\": \"Baal\",\n",
+                u8"    \"esES\": \"Baal\",\n",
+                u8"    \"frFR\": \"Baal\",\n",
+                u8"    \"itIT\": \"Baal\",\n",
+                u8"    \"koKR\": \"바알\",\n",
+                u8"    \"plPL\": \"Baal\",\n",
+                u8"    \"esMX\": \"Baal\",\n",
+                u8"    \"jaJP\": \"バール\",\n",
+                u8"    \"ptBR\": \"Baal\",\n",
+                u8"    \"ruRU\": \"Баал\",\n",
+                u8"    \"zhCN\": \"巴尔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22449,\n",
+                u8"    \"Key\": \"Putrid Defiler1\",\n",
+                u8"    \"enUS\": \"Putrid Defiler\",\n",
+                u8"    \"zhTW\": \"腐敗褻瀆者\",\n",
+                u8"    \"deDE\": \"Verfaulter Entweiher\",\n",
+                u8"    \"esES\": \"Profanador pútrido\",\n",
+                u8"    \"frFR\": \"Profanateur putride\",\n",
+                u8"    \"itIT\": \"Contaminatore Putrido\",\n",
+                u8"    \"koKR\": \"문드러진 파멸자\",\n",
+                u8"    \"plPL\": \"Gnijący plugawiciel\",\n",
+                u8"    \"esMX\": \"Profanador pútrido\",\n",
+                u8"    \"jaJP\": \"ピュトリッド・デファイラー\",\n",
+                u8"    \"ptBR\": \"Profanador Pútrido\",\n",
+                u8"    \"ruRU\": \"Гниющий осквернитель\",\n",
+                u8"    \"zhCN\": \"腥臭污秽者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22450,\n",
+                u8"    \"Key\": \"Putrid Defiler2\",\n",
+                u8"    \"enUS\": \"Wretched Defiler\",\n",
+                u8"    \"zhTW\": \"卑汙褻瀆者\",\n",
+                u8"    \"deDE\": \"Übler Entweiher\",\n",
+                u8"    \"esES\": \"Profanador aterrador\",\n",
+                u8"    \"frFR\": \"Profanateur de misère\",\n",
+                u8"    \"itIT\": \"Contaminatore Abietto\",\n",
+                u8"    \"koKR\": \"뒤틀린 파멸자\",\n",
+                u8"    \"plPL\": \"Nędzny plugawiciel\",\n",
+                u8"    \"esMX\": \"Profanador miserable\",\n",
+                u8"    \"jaJP\": \"レッチド・デファイラー\",\n",
+                u8"    \"ptBR\": \"Profanador Terrível\",\n",
+                u8"    \"ruRU\": \"Проклятый осквернитель\",\n",
+                u8"    \"zhCN\": \"卑劣污秽者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22451,\n",
+                u8"    \"Key\": \"Putrid Defiler3\",\n",
+                u8"    \"enUS\": \"Fetid Defiler\",\n",
+                u8"    \"zhTW\": \"惡臭褻瀆者\",\n",
+                u8"    \"deDE\": \"Stinkender Entweiher\",\n",
+                u8"    \"esES\": \"Profanador fétido\",\n",
+                u8"    \"frFR\": \"Profanateur fétide\",\n",
+                u8"    \"itIT\": \"Contaminatore Fetido\",\n",
+                u8"    \"koKR\": \"썩은 파멸자\",\n",
+                u8"    \"plPL\": \"Cuchnący plugawiciel\",\n",
+                u8"    \"esMX\": \"Profanador fétido\",\n",
+                u8"    \"jaJP\": \"フェティド・デファイラー\",\n",
+                u8"    \"ptBR\": \"[ms]Profanador Fétido\",\n",
+                u8"    \"ruRU\": \"Зловонный осквернитель\",\n",
+                u8"    \"zhCN\": \"恶臭污秽者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22452,\n",
+                u8"    \"Key\": \"Putrid Defiler4\",\n",
+                u8"    \"enUS\": \"Rancid Defiler\",\n",
+                u8"    \"zhTW\": \"腐臭褻瀆者\",\n",
+                u8"    \"deDE\": \"Ranziger Entweiher\",\n",
+                u8"    \"esES\": \"Profanador rancio\",\n",
+                u8"    \"frFR\": \"Profanateur rance\",\n",
+                u8"    \"itIT\": \"Contaminatore Rancido\",\n",
+                u8"    \"koKR\": \"부패한 파멸자\",\n",
+                u8"    \"plPL\": \"Spleśniały plugawiciel\",\n",
+                u8"    \"esMX\": \"Profanador rancio\",\n",
+                u8"    \"jaJP\": \"ランシド・デファイラー\",\n",
+                u8"    \"ptBR\": \"[ms]Profanador Repugnante\",\n",
+                u8"    \"ruRU\": \"Гадкий осквернитель\",\n",
+                u8"    \"zhCN\": \"腐臭污秽者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22453,\n",
+                u8"    \"Key\": \"Putrid Defiler5\",\n",
+                u8"    \"enUS\": \"Rank Defiler\",\n",
+                u8"    \"zhTW\": \"狠劣褻瀆者\",\n",
+                u8"    \"deDE\": \"Modernder Entweiher\",\n",
+                u8"    \"esES\": \"Profanador repugnante\",\n",
+                u8"    \"frFR\": \"Profanateur puant\",\n",
+                u8"    \"itIT\": \"Contaminatore Marcio\",\n",
+                u8"    \"koKR\": \"악취 나는 파멸자\",\n",
+                u8"    \"plPL\": \"Śmierdzący plugawiciel\",\n",
+                u8"    \"esMX\": \"Profanador añejo\",\n",
+                u8"    \"jaJP\": \"ランク・デファイラー\",\n",
+                u8"    \"ptBR\": \"[ms]Profanador Rançoso\",\n",
+                u8"    \"ruRU\": \"Мерзкий осквернитель\",\n",
+                u8"    \"zhCN\": \"异臭污秽者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22454,\n",
+                u8"    \"Key\": \"Pain Worm1\",\n",
+                u8"    \"enUS\": \"Pain Worm\",\n",
+                u8"    \"zhTW\": \"苦痛之蟲\",\n",
+                u8"    \"deDE\": \"Schmerzwurm\",\n",
+                u8"    \"esES\": \"Gusano de dolor\",\n",
+                u8"    \"frFR\": \"Ver de souffrance\",\n",
+                u8"    \"itIT\": \"Verme del Dolore\",\n",
+                u8"    \"koKR\": \"고통 벌레\",\n",
+                u8"    \"plPL\": \"Czerw bólu\",\n",
+                u8"    \"esMX\": \"Gusano doloroso\",\n",
+                u8"    \"jaJP\": \"ペイン・ワーム\",\n",
+                u8"    \"ptBR\": \"[ms]Verme Doloroso\",\n",
+                u8"    \"ruRU\": \"Червь боли\",\n",
+                u8"    \"zhCN\": \"痛苦蠕虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22455,\n",
+                u8"    \"Key\": \"Pain Worm2\",\n",
+                u8"    \"enUS\": \"Torment Worm\",\n",
+                u8"    \"zhTW\": \"折磨之蟲\",\n",
+                u8"    \"deDE\": \"Peinwurm\",\n",
+                u8"    \"esES\": \"Gusano de tormento\",\n",
+                u8"    \"frFR\": \"Ver de tourment\",\n",
+                u8"    \"itIT\": \"Verme del Tormento\",\n",
+                u8"    \"koKR\": \"고문 벌레\",\n",
+                u8"    \"plPL\": \"Czerw udręki\",\n",
+                u8"    \"esMX\": \"Gusano tormentoso\",\n",
+                u8"    \"jaJP\": \"トーメント・ワーム\",\n",
+                u8"    \"ptBR\": \"[ms]Verme Tormentoso\",\n",
+                u8"    \"ruRU\": \"Червь страданий\",\n",
+                u8"    \"zhCN\": \"折磨蠕虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22456,\n",
+                u8"    \"Key\": \"Pain Worm3\",\n",
+                u8"    \"enUS\": \"Agony Worm\",\n",
+                u8"    \"zhTW\": \"苦惱之蟲\",\n",
+                u8"    \"deDE\": \"Qualwurm\",\n",
+                u8"    \"esES\": \"Gusano de agonía\",\n",
+                u8"    \"frFR\": \"Ver d’agonie\",\n",
+                u8"    \"itIT\": \"Verme dell'Agonia\",\n",
+                u8"    \"koKR\": \"번뇌 벌레\",\n",
+                u8"    \"plPL\": \"Czerw agonii\",\n",
+                u8"    \"esMX\": \"Gusano desolador\",\n",
+                u8"    \"jaJP\": \"アゴニー・ワーム\",\n",
+                u8"    \"ptBR\": \"[ms]Verme Desolador\",\n",
+                u8"    \"ruRU\": \"Червь агонии\",\n",
+                u8"    \"zhCN\": \"痛楚蠕虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22457,\n",
+                u8"    \"Key\": \"Pain Worm4\",\n",
+                u8"    \"enUS\": \"Menace Worm\",\n",
+                u8"    \"zhTW\": \"脅迫之蟲\",\n",
+                u8"    \"deDE\": \"Drohwurm\",\n",
+                u8"    \"esES\": \"Gusano de amenaza\",\n",
+                u8"    \"frFR\": \"Ver de menace\",\n",
+                u8"    \"itIT\": \"Verme della Minaccia\",\n",
+                u8"    \"koKR\": \"참상 벌레\",\n",
+                u8"    \"plPL\": \"Czerw grozy\",\n",
+                u8"    \"esMX\": \"Gusano amenazador\",\n",
+                u8"    \"jaJP\": \"メナス・ワーム\",\n",
+                u8"    \"ptBR\": \"[ms]Verme Ameaçador\",\n",
+                u8"    \"ruRU\": \"Червь угрозы\",\n",
+                u8"    \"zhCN\": \"恶痛蠕虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22458,\n",
+                u8"    \"Key\": \"Pain Worm5\",\n",
+                u8"    \"enUS\": \"Anguish Worm\",\n",
+                u8"    \"zhTW\": \"怨慟之蟲   \",\n",
+                u8"    \"deDE\": \"Zornwurm\",\n",
+                u8"    \"esES\": \"Gusano de angustia\",\n",
+                u8"    \"frFR\": \"Ver d’angoisse\",\n",
+                u8"    \"itIT\": \"Verme dell'Angoscia\",\n",
+                u8"    \"koKR\": \"고뇌 벌레\",\n",
+                u8"    \"plPL\": \"Czerw cierpienia\",\n",
+                u8"    \"esMX\": \"Gusano agonizador\",\n",
+                u8"    \"jaJP\": \"アンギッシュ・ワーム\",\n",
+                u8"    \"ptBR\": \"Verme Angustiante\",\n",
+                u8"    \"ruRU\": \"Червь мучений\",\n",
+                u8"    \"zhCN\": \"剧痛蠕虫\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22459,\n",
+                u8"    \"Key\": \"WolfRider5\",\n",
+                u8"    \"enUS\": \"Warped Fallen Wolfrider\",\n",
+                u8"    \"zhTW\": \"扭曲沉淪魔狼騎士\",\n",
+                u8"    \"deDE\": \"Verderbter gefallener Wolfreiter\",\n",
+                u8"    \"esES\": \"Jinete lupino caído retorcido\",\n",
+                u8"    \"frFR\": \"Monte-loup déchu déformé\",\n",
+                u8"    \"itIT\": \"Cavalcalupi Caduto Deforme\",\n",
+                u8"    \"koKR\": \"뒤틀린 몰락자 늑대 기수\",\n",
+                u8"    \"plPL\": \"Spaczony jeździec upadłych\",\n",
+                u8"    \"esMX\": \"Montalobos caído retorcido\",\n",
+                u8"    \"jaJP\": \"ウォープト・ワンの狼騎兵\",\n",
+                u8"    \"ptBR\": \"Cavalga-lobo Decaído Distorcido\",\n",
+                u8"    \"ruRU\": \"Искаженный падший-наездник\",\n",
+                u8"    \"zhCN\": \"扭曲沉沦魔狼骑手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22460,\n",
+                u8"    \"Key\": \"WolfRider4\",\n",
+                u8"    \"enUS\": \"Darkone Wolfrider\",\n",
+                u8"    \"zhTW\": \"暗黑狼騎士\",\n",
+                u8"    \"deDE\": \"Dunkler Wolfreiter\",\n",
+                u8"    \"esES\": \"Jinete lupino siniestro\",\n",
+                u8"    \"frFR\": \"Monte-loup noir\",\n",
+                u8"    \"itIT\": \"Cavalcalupi Oscuro\",\n",
+                u8"    \"koKR\": \"어둠의 악마 늑대 기수\",\n",
+                u8"    \"plPL\": \"Jeździec mrocznych\",\n",
+                u8"    \"esMX\": \"Montalobos oscuro\",\n",
+                u8"    \"jaJP\": \"ダーク・ワンの狼騎兵\",\n",
+                u8"    \"ptBR\": \"Cavalga-lobo Trevoso\",\n",
+                u8"    \"ruRU\": \"Темный наездник\",\n",
+                u8"    \"zhCN\": \"暗魔狼骑手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22461,\n",
+                u8"    \"Key\": \"WolfRider3\",\n",
+                u8"    \"enUS\": \"Devilkin Wolfrider\",\n",
+                u8"    \"zhTW\": \"魔妖狼騎士\",\n",
+                u8"    \"deDE\": \"Teufelsbrutwolfreiter\",\n",
+                u8"    \"esES\": \"Jinete lupino diabólico\",\n",
+                u8"    \"frFR\": \"Monte-loup démonoïde\",\n",
+                u8"    \"itIT\": \"Cavalcalupi Malefico\",\n",
+                u8"    \"koKR\": \"악마피붙이 늑대 기수\",\n",
+                u8"    \"plPL\": \"Jeździec diablików\",\n",
+                u8"    \"esMX\": \"Montalobos demonante\",\n",
+                u8"    \"jaJP\": \"デビルキンの狼騎兵\",\n",
+                u8"    \"ptBR\": \"[ms]Cavalga-lobo Demonante\",\n",
+                u8"    \"ruRU\": \"Дьяволенок-наездник\",\n",
+                u8"    \"zhCN\": \"小恶魔狼骑手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22462,\n",
+                u8"    \"Key\": \"WolfRider2\",\n",
+                u8"    \"enUS\": \"Carver Wolfrider\",\n",
+                u8"    \"zhTW\": \"刨肉狼騎士\",\n",
+                u8"    \"deDE\": \"Schlächterwolfreiter\",\n",
+                u8"    \"esES\": \"Jinete lupino trinchante\",\n",
+                u8"    \"frFR\": \"Monte-loup équarrisseur\",\n",
+                u8"    \"itIT\": \"Cavalcalupi Incisore\",\n",
+                u8"    \"koKR\": \"도륙자 늑대 기수\",\n",
+                u8"    \"plPL\": \"Jeździec wycinaczy\",\n",
+                u8"    \"esMX\": \"Montalobos tajador\",\n",
+                u8"    \"jaJP\": \"カーヴァーの狼騎兵\",\n",
+                u8"    \"ptBR\": \"Cavalga-lobo Entalhador\",\n",
+                u8"    \"ruRU\": \"Плоторез-наездник\",\n",
+                u8"    \"zhCN\": \"利刃魔狼骑手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22463,\n",
+                u8"    \"Key\": \"WolfRider1\",\n",
+                u8"    \"enUS\": \"Fallen Wolfrider\",\n",
+                u8"    \"zhTW\": \"沉淪魔狼騎士\",\n",
+                u8"    \"deDE\": \"Gefallener Wolfreiter\",\n",
+                u8"    \"esES\": \"Jinete lupino caído\",\n",
+                u8"    \"frFR\": \"Monte-loup déchu\",\n",
+                u8"    \"itIT\": \"Cavalcalupi Caduto\",\n",
+                u8"    \"koKR\": \"몰락자 늑대 기수\",\n",
+                u8"    \"plPL\": \"Jeździec upadłych\",\n",
+                u8"    \"esMX\": \"Montalobos caído\",\n",
+                u8"    \"jaJP\": \"フォールンの狼騎兵\",\n",
+                u8"    \"ptBR\": \"[ms]Cavalga-lobo Decaído\",\n",
+                u8"    \"ruRU\": \"Падший-наездник\",\n",
+                u8"    \"zhCN\": \"沉沦魔狼骑手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22469,\n",
+                u8"    \"Key\": \"Inferno Sentry\",\n",
+                u8"    \"enUS\": \"Inferno Sentry\",\n",
+                u8"    \"zhTW\": \"煉獄衛兵\",\n",
+                u8"    \"deDE\": \"Infernowächter\",\n",
+                u8"    \"esES\": \"Centinela infernal\",\n",
+                u8"    \"frFR\": \"Sentinelle infernale\",\n",
+                u8"    \"itIT\": \"Sentinella Infernale\",\n",
+                u8"    \"koKR\": \"지옥불 파수기\",\n",
+                u8"    \"plPL\": \"Wartownik piekieł\",\n",
+                u8"    \"esMX\": \"Centinela del Infierno\",\n",
+                u8"    \"jaJP\": \"インフェルノ・セントリー\",\n",
+                u8"    \"ptBR\": \"Sentinela Infernal\",\n",
+                u8"    \"ruRU\": \"Инфернальный часовой\",\n",
+                u8"    \"zhCN\": \"炼狱哨兵\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22486,\n",
+                u8"    \"Key\": \"Curly\",\n",
+                u8"    \"enUS\": \"Curly\",\n",
+                u8"    \"zhTW\": \"蜷曲\",\n",
+                u8"    \"deDE\": \"Curly\",\n",
+                u8"    \"esES\": \"Curly\",\n",
+                u8"    \"frFR\": \"Pam\",\n",
+                u8"    \"itIT\": \"Curly\",\n",
+                u8"    \"koKR\": \"컬리\",\n",
+                u8"    \"plPL\": \"Curly\",\n",
+                u8"    \"esMX\": \"Curly\",\n",
+                u8"    \"jaJP\": \"カーリー\",\n",
+                u8"    \"ptBR\": \"Crespo\",\n",
+                u8"    \"ruRU\": \"Кудряш\",\n",
+                u8"    \"zhCN\": \"毛毛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22487,\n",
+                u8"    \"Key\": \"Larry\",\n",
+                u8"    \"enUS\": \"Larry\",\n",
+                u8"    \"zhTW\": \"賴瑞\",\n",
+                u8"    \"deDE\": \"Larry\",\n",
+                u8"    \"esES\": \"Larry\",\n",
+                u8"    \"frFR\": \"Poum\",\n",
+                u8"    \"itIT\": \"Larry\",\n",
+                u8"    \"koKR\": \"래리\",\n",
+                u8"    \"plPL\": \"Larry\",\n",
+                u8"    \"esMX\": \"Larry\",\n",
+                u8"    \"jaJP\": \"ラリー\",\n",
+                u8"    \"ptBR\": \"Larry\",\n",
+                u8"    \"ruRU\": \"Ларри\",\n",
+                u8"    \"zhCN\": \"拉蕊\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22488,\n",
+                u8"    \"Key\": \"Ancient Barbarian 3\",\n",
+                u8"    \"enUS\": \"Korlic\",\n",
+                u8"    \"zhTW\": \"科力克\",\n",
+                u8"    \"deDE\": \"Korlic\",\n",
+                u8"    \"esES\": \"Korlic\",\n",
+                u8"    \"frFR\": \"Korlic\",\n",
+                u8"    \"itIT\": \"Korlic\",\n",
+                u8"    \"koKR\": \"콜릭\",\n",
+                u8"    \"plPL\": \"Korlik\",\n",
+                u8"    \"esMX\": \"Korlic\",\n",
+                u8"    \"jaJP\": \"コーリック\",\n",
+                u8"    \"ptBR\": \"Korlic\",\n",
+                u8"    \"ruRU\": \"Корлик\",\n",
+                u8"    \"zhCN\": \"科里克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22489,\n",
+                u8"    \"Key\": \"Ancient Barbarian 2\",\n",
+                u8"    \"enUS\": \"Madawc\",\n",
+                u8"    \"zhTW\": \"馬道克\",\n",
+                u8"    \"deDE\": \"Madawc\",\n",
+                u8"    \"esES\": \"Madawc\",\n",
+                u8"    \"frFR\": \"Madawc\",\n",
+                u8"    \"itIT\": \"Madawc\",\n",
+                u8"    \"koKR\": \"마도크\",\n",
+                u8"    \"plPL\": \"Madok\",\n",
+                u8"    \"esMX\": \"Madawc\",\n",
+                u8"    \"jaJP\": \"マドウク\",\n",
+                u8"    \"ptBR\": \"Madawc\",\n",
+                u8"    \"ruRU\": \"Мадавк\",\n",
+                u8"    \"zhCN\": \"马道克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22490,\n",
+                u8"    \"Key\": \"Ancient Barbarian 1\",\n",
+                u8"    \"enUS\": \"Talic\",\n",
+                u8"    \"zhTW\": \"塔力克\",\n",
+                u8"    \"deDE\": \"Talic\",\n",
+                u8"    \"esES\": \"Talic\",\n",
+                u8"    \"frFR\": \"Talic\",\n",
+                u8"    \"itIT\": \"Talic\",\n",
+                u8"    \"koKR\": \"탈릭\",\n",
+                u8"    \"plPL\": \"Talik\",\n",
+                u8"    \"esMX\": \"Talic\",\n",
+                u8"    \"jaJP\": \"タリック\",\n",
+                u8"    \"ptBR\": \"[ms]Talic\",\n",
+                u8"    \"ruRU\": \"Талик\",\n",
+                u8"    \"zhCN\": \"塔力克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22491,\n",
+                u8"    \"Key\": \"Blaze Ripper\",\n",
+                u8"    \"enUS\": \"Blaze Ripper\",\n",
+                u8"    \"zhTW\": \"刀鋒撕裂者\",\n",
+                u8"    \"deDE\": \"Feuersbrunstripper\",\n",
+                u8"    \"esES\": \"Destripador de Fuego\",\n",
+                u8"    \"frFR\": \"Étripe-Braise\",\n",
+                u8"    \"itIT\": \"Squartatore Ardente\",\n",
+                u8"    \"koKR\": \"블레이즈 리퍼\",\n",
+                u8"    \"plPL\": \"Rozpruwacz Płomieni\",\n",
+                u8"    \"esMX\": \"Destripador Flameante\",\n",
+                u8"    \"jaJP\": \"豪炎のリッパー\",\n",
+                u8"    \"ptBR\": \"Estripador Fulgurante\",\n",
+                u8"    \"ruRU\": \"Адский потрошитель\",\n",
+                u8"    \"zhCN\": \"炽焰撕裂者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22492,\n",
+                u8"    \"Key\": \"Magma Torquer\",\n",
+                u8"    \"enUS\": \"Magma Torquer\",\n",
+                u8"    \"zhTW\": \"熔岩扭曲者\",\n",
+                u8"    \"deDE\": \"Magmariese\",\n",
+                u8"    \"esES\": \"Retuercemagma\",\n",
+                u8"    \"frFR\": \"Tord-Magma\",\n",
+                u8"    \"itIT\": \"Torcimagma\",\n",
+                u8"    \"koKR\": \"마그마 토커\",\n",
+                u8"    \"plPL\": \"Kłąb Magmy\",\n",
+                u8"    \"esMX\": \"Torquer de Magma\",\n",
+                u8"    \"jaJP\": \"マグマ・トルクァー\",\n",
+                u8"    \"ptBR\": \"Arrasador Magmático\",\n",
+                u8"    \"ruRU\": \"Извращенная магма\",\n",
+                u8"    \"zhCN\": \"岩浆扭转者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22493,\n",
+                u8"    \"Key\": \"Sharp Tooth Sayer\",\n",
+                u8"    \"enUS\": \"Sharptooth Slayer\",\n",
+                u8"    \"zhTW\": \"利牙殺手\",\n",
+                u8"    \"deDE\": \"Scharfzahnschlächter\",\n",
+                u8"    \"esES\": \"Asesino de Dientes Afilados\",\n",
+                u8"    \"frFR\": \"Croc-Tueur\",\n",
+                u8"    \"itIT\": \"Squartatore Acuminato\",\n",
+                u8"    \"koKR\": \"샤프투스 슬레이어\",\n",
+                u8"    \"plPL\": \"Ostrozębny Pogromca\",\n",
+                u8"    \"esMX\": \"Exterminador de Dientes Afilados\",\n",
+                u8"    \"jaJP\": \"鋭牙のスレイヤー\",\n",
+                u8"    \"ptBR\": \"Homicida Navalhodonte\",\n",
+                u8"    \"ruRU\": \"Острозуб Истребитель\",\n",
+                u8"    \"zhCN\": \"尖牙杀戮者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22494,\n",
+                u8"    \"Key\": \"Vinvear Molech\",\n",
+                u8"    \"enUS\": \"Vinvear Molech\",\n",
+                u8"    \"zhTW\": \"芬維爾‧摩洛克\",\n",
+                u8"    \"deDE\": \"Vinvear Molech\",\n",
+                u8"    \"esES\": \"Vinvear Molech\",\n",
+                u8"    \"frFR\": \"Vinvear Molech\",\n",
+                u8"    \"itIT\": \"Molech Vinvear\",\n",
+                u8"    \"koKR\": \"빈비어 몰레크\",\n",
+                u8"    \"plPL\": \"Moloch z Vinvear\",\n",
+                u8"    \"esMX\": \"Vinvear Molech\",\n",
+                u8"    \"jaJP\": \"ヴィンヴィア・モレック\",\n",
+                u8"    \"ptBR\": \"Moloque Vinvear\",\n",
+                u8"    \"ruRU\": \"Винвеар Молох\",\n",
+                u8"    \"zhCN\": \"温伟尔·摩洛克\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22495,\n",
+                u8"    \"Key\": \"Anodized Elite\",\n",
+                u8"    \"enUS\": \"Hell's Belle\",\n",
+                u8"    \"zhTW\": \"地獄佳人\",\n",
+                u8"    \"deDE\": \"Höllenbraut\",\n",
+                u8"    \"esES\": \"Belleza Infernal\",\n",
+                u8"    \"frFR\": \"Belle des Enfers\",\n",
+                u8"    \"itIT\": \"Bellezza Infernale\",\n",
+                u8"    \"koKR\": \"지옥의 미녀\",\n",
+                u8"    \"plPL\": \"Piekielna Piękność\",\n",
+                u8"    \"esMX\": \"Belleza del Infierno\",\n",
+                u8"    \"jaJP\": \"ヘルズ・ベル\",\n",
+                u8"    \"ptBR\": \"Belle do Inferno\",\n",
+                u8"    \"ruRU\": \"Белладонна\",\n",
+                u8"    \"zhCN\": \"地狱妖姬\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22496,\n",
+                u8"    \"Key\": \"Snapchip Shatter\",\n",
+                u8"    \"enUS\": \"Snapchip Shatter\",\n",
+                u8"    \"zhTW\": \"碎冰\",\n",
+                u8"    \"deDE\": \"Schnappzapp Schmetter\",\n",
+                u8"    \"esES\": \"Destructor Ruidoso\",\n",
+                u8"    \"frFR\": \"Brise-Éclat\",\n",
+                u8"    \"itIT\": \"Spezzaschegge il Fracassatore\",\n",
+                u8"    \"koKR\": \"스냅칩 섀터\",\n",
+                u8"    \"plPL\": \"Szczerbiciel\",\n",
+                u8"    \"esMX\": \"Destructor de Estalactitas\",\n",
+                u8"    \"jaJP\": \"スナップチップ・シャッター\",\n",
+                u8"    \"ptBR\": \"Esfacelador Lascado\",\n",
+                u8"    \"ruRU\": \"Трескун Сотрясатель\",\n",
+                u8"    \"zhCN\": \"嚼筋粉碎者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22497,\n",
+                u8"    \"Key\": \"Pindleskin\",\n",
+                u8"    \"enUS\": \"Pindleskin\",\n",
+                u8"    \"zhTW\": \"暴皮\",\n",
+                u8"    \"deDE\": \"Knochenhaut\",\n",
+                u8"    \"esES\": \"Pindleskin\",\n",
+                u8"    \"frFR\": \"Picaillon\",\n",
+                u8"    \"itIT\": \"Pellefragile\",\n",
+                u8"    \"koKR\": \"핀들스킨\",\n",
+                u8"    \"plPL\": \"Pryszczoskór\",\n",
+                u8"    \"esMX\": \"Granujo\",\n",
+                u8"    \"jaJP\": \"ピンドルスキン\",\n",
+                u8"    \"ptBR\": \"Pelefermo\",\n",
+                u8"    \"ruRU\": \"Пиндлскин\",\n",
+                u8"    \"zhCN\": \"暴躁外皮\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22498,\n",
+                u8"    \"Key\": \"Threash Socket\",\n",
+                u8"    \"enUS\": \"Thresh Socket\",\n",
+                u8"    \"zhTW\": \"剝孔\",\n",
+                u8"    \"deDE\": \"Dresch Zocker\",\n",
+                u8"    \"esES\": \"Fosa de Trilla\",\n",
+                u8"    \"frFR\": \"Corne-Chair\",\n",
+                u8"    \"itIT\": \"Il Battitore\",\n",
+                u8"    \"koKR\": \"쓰레쉬 소켓\",\n",
+                u8"    \"plPL\": \"Niszczyskała\",\n",
+                u8"    \"esMX\": \"Azotador Engarzado\",\n",
+                u8"    \"jaJP\": \"スレッシュ・ソケット\",\n",
+                u8"    \"ptBR\": \"Descascador\",\n",
+                u8"    \"ruRU\": \"Гнездовой молотитель\",\n",
+                u8"    \"zhCN\": \"锤槽\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22499,\n",
+                u8"    \"Key\": \"Eyeback Unleashed\",\n",
+                u8"    \"enUS\": \"Eyeback the Unleashed\",\n",
+                u8"    \"zhTW\": \"爆發者艾巴克\",\n",
+                u8"    \"deDE\": \"Triefauge der Entfesselte\",\n",
+                u8"    \"esES\": \"Eyeback el Desatado\",\n",
+                u8"    \"frFR\": \"Barthok le Déchaîné\",\n",
+                u8"    \"itIT\": \"Occhiospino lo Scatenato\",\n",
+                u8"    \"koKR\": \"풀려난 자 아이백\",\n",
+                u8"    \"plPL\": \"Okogłów Wyzwolony\",\n",
+                u8"    \"esMX\": \"Espaldojo el Desatado\",\n",
+                u8"    \"jaJP\": \"解き放たれしアイバック\",\n",
+                u8"    \"ptBR\": \"Costolho, o Desenfreado\",\n",
+                u8"    \"ruRU\": \"Спиноок Высвобожденный\",\n",
+                u8"    \"zhCN\": \"眼魔·狂暴者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22500,\n",
+                u8"    \"Key\": \"Megaflow Rectifier\",\n",
+                u8"    \"enUS\": \"Eldritch the Rectifier\",\n",
+                u8"    \"zhTW\": \"矯正者艾德瑞奇\",\n",
+                u8"    \"deDE\": \"Eldritch der Richter\",\n",
+                u8"    \"esES\": \"Eldritch el Rectificador\",\n",
+                u8"    \"frFR\": \"Eldritch le Rectifieur\",\n",
+                u8"    \"itIT\": \"Il Rettificatore\",\n",
+                u8"    \"koKR\": \"바로잡는 자 엘드리치\",\n",
+                u8"    \"plPL\": \"Eldritch Sprawca\",\n",
+                u8"    \"esMX\": \"Eldritch el Rectificador\",\n",
+                u8"    \"jaJP\": \"矯正者エルドリッチ\",\n",
+                u8"    \"ptBR\": \"Ancestral, o Retificador\",\n",
+                u8"    \"ruRU\": \"Зловещ Уравнитель\",\n",
+                u8"    \"zhCN\": \"艾德雷奇·矫正者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22501,\n",
+                u8"    \"Key\": \"Dac Farren\",\n",
+                u8"    \"enUS\": \"Dac Farren\",\n",
+                u8"    \"zhTW\": \"達克法恩\",\n",
+                u8"    \"deDE\": \"Dac Farren\",\n",
+                u8"    \"esES\": \"Dac Farren\",\n",
+                u8"    \"frFR\": \"Dac Farren\",\n",
+                u8"    \"itIT\": \"Dac Farren\",\n",
+                u8"    \"koKR\": \"닥 파렌\",\n",
+                u8"    \"plPL\": \"Dac Farren\",\n",
+                u8"    \"esMX\": \"Dac Farren\",\n",
+                u8"    \"jaJP\": \"ダック・ファレン\",\n",
+                u8"    \"ptBR\": \"Dac Farren\",\n",
+                u8"    \"ruRU\": \"Дак Фаррен\",\n",
+                u8"    \"zhCN\": \"达克·法伦\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22502,\n",
+                u8"    \"Key\": \"Bonesaw Breaker\",\n",
+                u8"    \"enUS\": \"Bonesaw Breaker\",\n",
+                u8"    \"zhTW\": \"骨鋸破壞者\",\n",
+                u8"    \"deDE\": \"Knochenbrecher\",\n",
+                u8"    \"esES\": \"Rompehuesos\",\n",
+                u8"    \"frFR\": \"L’équarisseur\",\n",
+                u8"    \"itIT\": \"Spezzaossa\",\n",
+                u8"    \"koKR\": \"뼈톱 파괴자\",\n",
+                u8"    \"plPL\": \"Kościozłam\",\n",
+                u8"    \"esMX\": \"Quebrantador de Sierra Ósea\",\n",
+                u8"    \"jaJP\": \"ボーンソー・ブレイカー\",\n",
+                u8"    \"ptBR\": \"Destruidor Serra-ossos\",\n",
+                u8"    \"ruRU\": \"Пилорез Разбиватель\",\n",
+                u8"    \"zhCN\": \"骨锯破坏者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22503,\n",
+                u8"    \"Key\": \"Axe Dweller\",\n",
+                u8"    \"enUS\": \"Axe Dweller\",\n",
+                u8"    \"zhTW\": \"居斧者\",\n",
+                u8"    \"deDE\": \"Axtschwinger\",\n",
+                u8"    \"esES\": \"Morador Hachero\",\n",
+                u8"    \"frFR\": \"Carnefer\",\n",
+                u8"    \"itIT\": \"Ascia Vivente\",\n",
+                u8"    \"koKR\": \"액스 드웰러\",\n",
+                u8"    \"plPL\": \"Siekiernik\",\n",
+                u8"    \"esMX\": \"Morador del Hacha\",\n",
+                u8"    \"jaJP\": \"アクス・ドゥウェラー\",\n",
+                u8"    \"ptBR\": \"Machadino\",\n",
+                u8"    \"ruRU\": \"Топорщик\",\n",
+                u8"    \"zhCN\": \"持斧手\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22504,\n",
+                u8"    \"Key\": \"Frozenstein\",\n",
+                u8"    \"enUS\": \"Frozenstein\",\n",
+                u8"    \"zhTW\": \"冰凍怪魔\",\n",
+                u8"    \"deDE\": \"Froststein\",\n",
+                u8"    \"esES\": \"Heladostein\",\n",
+                u8"    \"frFR\": \"Frankenglace\",\n",
+                u8"    \"itIT\": \"Freddenstein\",\n",
+                u8"    \"koKR\": \"프로즌슈타인\",\n",
+                u8"    \"plPL\": \"Fragmenstein\",\n",
+                u8"    \"esMX\": \"Frozenstein\",\n",
+                u8"    \"jaJP\": \"フローズンシュタイン\",\n",
+                u8"    \"ptBR\": \"Congelenstein\",\n",
+                u8"    \"ruRU\": \"Морозище\",\n",
+                u8"    \"zhCN\": \"冰冻怪魔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 23966,\n",
+                u8"    \"Key\": \"StrMonsterWindow\",\n",
+                u8"    \"enUS\": \"Stained Glass Window\",\n",
+                u8"    \"zhTW\": \"彩玻璃窗\",\n",
+                u8"    \"deDE\": \"Buntglasfenster\",\n",
+                u8"    \"esES\": \"Vitral\",\n",
+                u8"    \"frFR\": \"Vitrail\",\n",
+                u8"    \"itIT\": \"Vetro dipinto - Giallo\",\n",
+                u8"    \"koKR\": \"색유리 창\",\n",
+                u8"    \"plPL\": \"Witraż\",\n",
+                u8"    \"esMX\": \"Ventana de cristal coloreado\",\n",
+                u8"    \"jaJP\": \"ステンドグラス\",\n",
+                u8"    \"ptBR\": \"Janela de Vitral\",\n",
+                u8"    \"ruRU\": \"Витраж\",\n",
+                u8"    \"zhCN\": \"花窗玻璃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 26802,\n",
+                u8"    \"Key\": \"MonsterCorpseNameFormat\",\n",
+                u8"    \"enUS\": \"%s Corpse\",\n",
+                u8"    \"zhTW\": \"%s的屍體\",\n",
+                u8"    \"deDE\": \"Leiche (%s)\",\n",
+                u8"    \"esES\": \"Cadáver de %s\",\n",
+                u8"    \"frFR\": \"Cadavre (%s)\",\n",
+                u8"    \"itIT\": \"Cadavere di %s\",\n",
+                u8"    \"koKR\": \"%s 시체\",\n",
+                u8"    \"plPL\": \"%s (Zwłoki)\",\n",
+                u8"    \"esMX\": \"Cadáver %s\",\n",
+                u8"    \"jaJP\": \"%sの屍\",\n",
+                u8"    \"ptBR\": \"Cadáver de %s\",\n",
+                u8"    \"ruRU\": \"%s – труп\",\n",
+                u8"    \"zhCN\": \"%s残骸\"\n",
+                u8"  }\n",
+                u8"]\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,30 +18,26 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetPlayerClass()
+        EmbeddedText GetPlayerClass()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"Player Class\tCode\n";
-                ss << u8"Amazon\tama\n";
-                ss << u8"Sorceress\tsor\n";
-                ss << u8"Necromancer\tnec\n";
-                ss << u8"Paladin\tpal\n";
-                ss << u8"Barbarian\tbar\n";
-                ss << u8"Expansion\t\n";
-                ss << u8"Druid\tdru\n";
-                ss << u8"Assassin\tass\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"Player Class\tCode\n",
+                u8"Amazon\tama\n",
+                u8"Sorceress\tsor\n",
+                u8"Necromancer\tnec\n",
+                u8"Paladin\tpal\n",
+                u8"Barbarian\tbar\n",
+                u8"Expansion\t\n",
+                u8"Druid\tdru\n",
+                u8"Assassin\tass\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,30 +18,26 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetSuperiorModsTxt()
+        EmbeddedText GetSuperiorModsTxt()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"mod1code\tmod1param\tmod1min\tmod1max\tmod2code\tmod2param\tmod2min\tmod2max\tarmor\tweapon\tshield\tscepter\twand\tstaff\tbow\tboots\tgloves\tbelt\n";
-                ss << u8"att\t0\t1\t3\t\t0\t\t\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n";
-                ss << u8"dmg%\t0\t5\t15\t\t0\t\t\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n";
-                ss << u8"ac%\t0\t5\t15\t\t0\t\t\t1\t0\t1\t0\t0\t0\t0\t1\t1\t1\n";
-                ss << u8"att\t0\t1\t3\tdmg%\t0\t5\t15\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n";
-                ss << u8"dur%\t0\t10\t15\t\t\t\t\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\n";
-                ss << u8"att\t0\t1\t3\tdur%\t0\t10\t15\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n";
-                ss << u8"dmg%\t0\t5\t15\tdur%\t0\t10\t15\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n";
-                ss << u8"ac%\t0\t5\t15\tdur%\t0\t10\t15\t1\t0\t1\t0\t0\t0\t0\t1\t1\t1\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"mod1code\tmod1param\tmod1min\tmod1max\tmod2code\tmod2param\tmod2min\tmod2max\tarmor\tweapon\tshield\tscepter\twand\tstaff\tbow\tboots\tgloves\tbelt\n",
+                u8"att\t0\t1\t3\t\t0\t\t\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n",
+                u8"dmg%\t0\t5\t15\t\t0\t\t\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n",
+                u8"ac%\t0\t5\t15\t\t0\t\t\t1\t0\t1\t0\t0\t0\t0\t1\t1\t1\n",
+                u8"att\t0\t1\t3\tdmg%\t0\t5\t15\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n",
+                u8"dur%\t0\t10\t15\t\t\t\t\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\n",
+                u8"att\t0\t1\t3\tdur%\t0\t10\t15\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n",
+                u8"dmg%\t0\t5\t15\tdur%\t0\t10\t15\t0\t1\t0\t1\t1\t1\t1\t0\t0\t0\n",
+                u8"ac%\t0\t5\t15\tdur%\t0\t10\t15\t1\t0\t1\t0\t0\t0\t0\t1\t1\t1\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
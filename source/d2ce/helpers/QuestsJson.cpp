@@ -18,2726 +18,2722 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace JsonReaderHelper
     {
-        const std::string& GetQuests()
+        EmbeddedText GetQuests()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"[\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 922,\n";
-                ss << u8"    \"Key\": \"qstsa2q0\",\n";
-                ss << u8"    \"enUS\": \"Act 2 Prologue\",\n";
-                ss << u8"    \"zhTW\": \"第二章序幕\",\n";
-                ss << u8"    \"deDE\": \"Akt 2 - Prolog\",\n";
-                ss << u8"    \"esES\": \"Acto 2 Prólogo\",\n";
-                ss << u8"    \"frFR\": \"Acte II - Prologue\",\n";
-                ss << u8"    \"itIT\": \"Atto 2, prologo\",\n";
-                ss << u8"    \"koKR\": \"2막 프롤로그\",\n";
-                ss << u8"    \"plPL\": \"Prolog Aktu II\",\n";
-                ss << u8"    \"esMX\": \"Acto 2 - Prólogo\",\n";
-                ss << u8"    \"jaJP\": \"第2章 序幕\",\n";
-                ss << u8"    \"ptBR\": \"Prólogo do Ato 2\",\n";
-                ss << u8"    \"ruRU\": \"Акт 2 – пролог\",\n";
-                ss << u8"    \"zhCN\": \"第二幕序章\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 923,\n";
-                ss << u8"    \"Key\": \"qstsa2q1\",\n";
-                ss << u8"    \"enUS\": \"Radament's Lair\",\n";
-                ss << u8"    \"zhTW\": \"羅達門特的巢穴\",\n";
-                ss << u8"    \"deDE\": \"Radaments Lager\",\n";
-                ss << u8"    \"esES\": \"El cubil de Radament\",\n";
-                ss << u8"    \"frFR\": \"Le Repaire de Radament\",\n";
-                ss << u8"    \"itIT\": \"Il rifugio di Radament\",\n";
-                ss << u8"    \"koKR\": \"라다먼트의 소굴\",\n";
-                ss << u8"    \"plPL\": \"Siedlisko Radamenta\",\n";
-                ss << u8"    \"esMX\": \"Guarida de Radament\",\n";
-                ss << u8"    \"jaJP\": \"ラダメントの隠れ家\",\n";
-                ss << u8"    \"ptBR\": \"Covil de Radament\",\n";
-                ss << u8"    \"ruRU\": \"Логово Радаманта\",\n";
-                ss << u8"    \"zhCN\": \"罗达门特的巢穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 924,\n";
-                ss << u8"    \"Key\": \"qstsa2q2\",\n";
-                ss << u8"    \"enUS\": \"The Horadric Staff\",\n";
-                ss << u8"    \"zhTW\": \"赫拉迪姆之杖\",\n";
-                ss << u8"    \"deDE\": \"Der Horadrimstab\",\n";
-                ss << u8"    \"esES\": \"El bastón horádrico\",\n";
-                ss << u8"    \"frFR\": \"Le Bâton horadrique\",\n";
-                ss << u8"    \"itIT\": \"La Verga Horadrica\",\n";
-                ss << u8"    \"koKR\": \"호라드림 지팡이\",\n";
-                ss << u8"    \"plPL\": \"Kostur Horadrimów\",\n";
-                ss << u8"    \"esMX\": \"El Bastón Horádrico\",\n";
-                ss << u8"    \"jaJP\": \"ホラドリムの杖\",\n";
-                ss << u8"    \"ptBR\": \"O Cajado Horádrico\",\n";
-                ss << u8"    \"ruRU\": \"Хорадримский посох\",\n";
-                ss << u8"    \"zhCN\": \"赫拉迪姆之杖\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 925,\n";
-                ss << u8"    \"Key\": \"qstsa2q3\",\n";
-                ss << u8"    \"enUS\": \"Tainted Sun\",\n";
-                ss << u8"    \"zhTW\": \"蔽日黑暗\",\n";
-                ss << u8"    \"deDE\": \"Verdunkelte Sonne\",\n";
-                ss << u8"    \"esES\": \"Sol Mancillado\",\n";
-                ss << u8"    \"frFR\": \"Soleil maudit\",\n";
-                ss << u8"    \"itIT\": \"Il sole corrotto\",\n";
-                ss << u8"    \"koKR\": \"더럽혀진 태양\",\n";
-                ss << u8"    \"plPL\": \"Zbrukane Słońce\",\n";
-                ss << u8"    \"esMX\": \"Sol Mancillado\",\n";
-                ss << u8"    \"jaJP\": \"穢された太陽\",\n";
-                ss << u8"    \"ptBR\": \"O Sol Maculado\",\n";
-                ss << u8"    \"ruRU\": \"Затмение\",\n";
-                ss << u8"    \"zhCN\": \"被污染的太阳\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 926,\n";
-                ss << u8"    \"Key\": \"qstsa2q4\",\n";
-                ss << u8"    \"enUS\": \"Arcane Sanctuary\",\n";
-                ss << u8"    \"zhTW\": \"秘法聖殿\",\n";
-                ss << u8"    \"deDE\": \"Geheime Zuflucht\",\n";
-                ss << u8"    \"esES\": \"El Santuario Arcano\",\n";
-                ss << u8"    \"frFR\": \"Le Sanctuaire des Arcanes\",\n";
-                ss << u8"    \"itIT\": \"Il Santuario Arcano\",\n";
-                ss << u8"    \"koKR\": \"비전의 성역\",\n";
-                ss << u8"    \"plPL\": \"Tajemne Sanktuarium\",\n";
-                ss << u8"    \"esMX\": \"Santuario Arcano\",\n";
-                ss << u8"    \"jaJP\": \"深遠なる聖域\",\n";
-                ss << u8"    \"ptBR\": \"O Santuário Arcano\",\n";
-                ss << u8"    \"ruRU\": \"Магическое убежище\",\n";
-                ss << u8"    \"zhCN\": \"神秘避难所\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 927,\n";
-                ss << u8"    \"Key\": \"qstsa2q5\",\n";
-                ss << u8"    \"enUS\": \"The Summoner\",\n";
-                ss << u8"    \"zhTW\": \"召喚師\",\n";
-                ss << u8"    \"deDE\": \"Der Geisterbeschwörer\",\n";
-                ss << u8"    \"esES\": \"El Invocador\",\n";
-                ss << u8"    \"frFR\": \"L’Invocateur\",\n";
-                ss << u8"    \"itIT\": \"L'Evocatore\",\n";
-                ss << u8"    \"koKR\": \"소환사\",\n";
-                ss << u8"    \"plPL\": \"Demonolog\",\n";
-                ss << u8"    \"esMX\": \"El Invocador\",\n";
-                ss << u8"    \"jaJP\": \"召喚師\",\n";
-                ss << u8"    \"ptBR\": \"O Evocador\",\n";
-                ss << u8"    \"ruRU\": \"Призыватель\",\n";
-                ss << u8"    \"zhCN\": \"召唤者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 928,\n";
-                ss << u8"    \"Key\": \"qstsa2q6\",\n";
-                ss << u8"    \"enUS\": \"The Seven Tombs\",\n";
-                ss << u8"    \"zhTW\": \"七座古墓\",\n";
-                ss << u8"    \"deDE\": \"Die sieben Gräber\",\n";
-                ss << u8"    \"esES\": \"Las siete tumbas\",\n";
-                ss << u8"    \"frFR\": \"Les Sept Tombeaux\",\n";
-                ss << u8"    \"itIT\": \"Le sette tombe\",\n";
-                ss << u8"    \"koKR\": \"일곱 개의 무덤\",\n";
-                ss << u8"    \"plPL\": \"Siedem Grobowców\",\n";
-                ss << u8"    \"esMX\": \"Las Siete Tumbas\",\n";
-                ss << u8"    \"jaJP\": \"七つの墓\",\n";
-                ss << u8"    \"ptBR\": \"As Sete Tumbas\",\n";
-                ss << u8"    \"ruRU\": \"Семь гробниц\",\n";
-                ss << u8"    \"zhCN\": \"七座古墓\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 929,\n";
-                ss << u8"    \"Key\": \"qstsa3q0\",\n";
-                ss << u8"    \"enUS\": \"Act 3 Prologue\",\n";
-                ss << u8"    \"zhTW\": \"第三章序幕\",\n";
-                ss << u8"    \"deDE\": \"Akt 3 - Prolog\",\n";
-                ss << u8"    \"esES\": \"Acto 3 Prólogo\",\n";
-                ss << u8"    \"frFR\": \"Acte III - Prologue\",\n";
-                ss << u8"    \"itIT\": \"Atto 3, prologo\",\n";
-                ss << u8"    \"koKR\": \"3막 프롤로그\",\n";
-                ss << u8"    \"plPL\": \"Prolog Aktu III\",\n";
-                ss << u8"    \"esMX\": \"Acto 3 - Prólogo\",\n";
-                ss << u8"    \"jaJP\": \"第3章 序幕\",\n";
-                ss << u8"    \"ptBR\": \"Prólogo do Ato 3\",\n";
-                ss << u8"    \"ruRU\": \"Акт 3 – пролог\",\n";
-                ss << u8"    \"zhCN\": \"第三幕序章\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 930,\n";
-                ss << u8"    \"Key\": \"qstsa3q1\",\n";
-                ss << u8"    \"enUS\": \"Lam Esen's Tome\",\n";
-                ss << u8"    \"zhTW\": \"藍伊森之書\",\n";
-                ss << u8"    \"deDE\": \"Lam Esens Foliant\",\n";
-                ss << u8"    \"esES\": \"El tomo de Lam Esen\",\n";
-                ss << u8"    \"frFR\": \"Livre de Lam Esen\",\n";
-                ss << u8"    \"itIT\": \"Il Libro di Lam Esen\",\n";
-                ss << u8"    \"koKR\": \"람 에센의 고서\",\n";
-                ss << u8"    \"plPL\": \"Księga Lama Esena\",\n";
-                ss << u8"    \"esMX\": \"El Tomo de Lam Esen\",\n";
-                ss << u8"    \"jaJP\": \"ラム・エセンの書\",\n";
-                ss << u8"    \"ptBR\": \"O Tomo de Lam Esen\",\n";
-                ss << u8"    \"ruRU\": \"Фолиант Лам Эсена\",\n";
-                ss << u8"    \"zhCN\": \"兰姆·艾森之书\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 931,\n";
-                ss << u8"    \"Key\": \"qstsa3q2\",\n";
-                ss << u8"    \"enUS\": \"Khalim's Will\",\n";
-                ss << u8"    \"zhTW\": \"克林姆的遺願\",\n";
-                ss << u8"    \"deDE\": \"Khalims Wille\",\n";
-                ss << u8"    \"esES\": \"La voluntad de Khalim\",\n";
-                ss << u8"    \"frFR\": \"La Volonté de Khalim\",\n";
-                ss << u8"    \"itIT\": \"La Volontà di Khalim\",\n";
-                ss << u8"    \"koKR\": \"칼림의 의지\",\n";
-                ss << u8"    \"plPL\": \"Wola Khalima\",\n";
-                ss << u8"    \"esMX\": \"Voluntad de Khalim\",\n";
-                ss << u8"    \"jaJP\": \"カリムの意志\",\n";
-                ss << u8"    \"ptBR\": \"Vontade de Khalim\",\n";
-                ss << u8"    \"ruRU\": \"Воля Халима\",\n";
-                ss << u8"    \"zhCN\": \"卡林姆的意志\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 932,\n";
-                ss << u8"    \"Key\": \"qstsa3q3\",\n";
-                ss << u8"    \"enUS\": \"Blade of the Old Religion\",\n";
-                ss << u8"    \"zhTW\": \"古代宗教之刃\",\n";
-                ss << u8"    \"deDE\": \"Klinge der alten Religion\",\n";
-                ss << u8"    \"esES\": \"Daga de la Vieja Religión\",\n";
-                ss << u8"    \"frFR\": \"Anciennes croyances\",\n";
-                ss << u8"    \"itIT\": \"La lama dell'Antica Religione\",\n";
-                ss << u8"    \"koKR\": \"옛 종교의 칼날\",\n";
-                ss << u8"    \"plPL\": \"Ostrze Dawnej Religii\",\n";
-                ss << u8"    \"esMX\": \"Puñal de la Vieja Religión\",\n";
-                ss << u8"    \"jaJP\": \"古代宗教の儀礼剣\",\n";
-                ss << u8"    \"ptBR\": \"A Lâmina da Velha Religião\",\n";
-                ss << u8"    \"ruRU\": \"Клинок древней религии\",\n";
-                ss << u8"    \"zhCN\": \"旧教之刃\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 933,\n";
-                ss << u8"    \"Key\": \"qstsa3q4\",\n";
-                ss << u8"    \"enUS\": \"The Golden Bird\",\n";
-                ss << u8"    \"zhTW\": \"黃金鳥\",\n";
-                ss << u8"    \"deDE\": \"Der goldene Vogel\",\n";
-                ss << u8"    \"esES\": \"El pájaro dorado\",\n";
-                ss << u8"    \"frFR\": \"L’Oiseau de Feu\",\n";
-                ss << u8"    \"itIT\": \"L'Uccello d'Oro\",\n";
-                ss << u8"    \"koKR\": \"황금 새\",\n";
-                ss << u8"    \"plPL\": \"Złoty Ptak\",\n";
-                ss << u8"    \"esMX\": \"El Pájaro Dorado\",\n";
-                ss << u8"    \"jaJP\": \"黄金の鳥\",\n";
-                ss << u8"    \"ptBR\": \"O Pássaro Dourado\",\n";
-                ss << u8"    \"ruRU\": \"Золотая птица\",\n";
-                ss << u8"    \"zhCN\": \"黄金鸟\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 934,\n";
-                ss << u8"    \"Key\": \"qstsa3q5\",\n";
-                ss << u8"    \"enUS\": \"The Blackened Temple\",\n";
-                ss << u8"    \"zhTW\": \"晦影神殿\",\n";
-                ss << u8"    \"deDE\": \"Der schwarze Tempel\",\n";
-                ss << u8"    \"esES\": \"El Templo Ennegrecido\",\n";
-                ss << u8"    \"frFR\": \"Le Temple noirci\",\n";
-                ss << u8"    \"itIT\": \"Il tempio oscuro\",\n";
-                ss << u8"    \"koKR\": \"검게 물든 사원\",\n";
-                ss << u8"    \"plPL\": \"Poczerniała Świątynia\",\n";
-                ss << u8"    \"esMX\": \"El Templo Corrupto\",\n";
-                ss << u8"    \"jaJP\": \"穢れた神殿\",\n";
-                ss << u8"    \"ptBR\": \"O Templo Corrompido\",\n";
-                ss << u8"    \"ruRU\": \"Оскверненный храм\",\n";
-                ss << u8"    \"zhCN\": \"黑化神殿\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 935,\n";
-                ss << u8"    \"Key\": \"qstsa3q6\",\n";
-                ss << u8"    \"enUS\": \"The Guardian\",\n";
-                ss << u8"    \"zhTW\": \"守護者\",\n";
-                ss << u8"    \"deDE\": \"Der Wächter\",\n";
-                ss << u8"    \"esES\": \"El guardián\",\n";
-                ss << u8"    \"frFR\": \"Le Gardien\",\n";
-                ss << u8"    \"itIT\": \"Il guardiano\",\n";
-                ss << u8"    \"koKR\": \"수호자\",\n";
-                ss << u8"    \"plPL\": \"Strażnik\",\n";
-                ss << u8"    \"esMX\": \"El Guardián\",\n";
-                ss << u8"    \"jaJP\": \"守護者\",\n";
-                ss << u8"    \"ptBR\": \"O Guardião\",\n";
-                ss << u8"    \"ruRU\": \"Страж\",\n";
-                ss << u8"    \"zhCN\": \"守护者\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 936,\n";
-                ss << u8"    \"Key\": \"qstsa4q0\",\n";
-                ss << u8"    \"enUS\": \"Act 4 Prologue\",\n";
-                ss << u8"    \"zhTW\": \"第四章序幕\",\n";
-                ss << u8"    \"deDE\": \"Akt 4 - Prolog\",\n";
-                ss << u8"    \"esES\": \"Acto 4 Prólogo\",\n";
-                ss << u8"    \"frFR\": \"Acte IV - Prologue\",\n";
-                ss << u8"    \"itIT\": \"Atto 4, prologo\",\n";
-                ss << u8"    \"koKR\": \"4막 프롤로그\",\n";
-                ss << u8"    \"plPL\": \"Prolog Aktu IV\",\n";
-                ss << u8"    \"esMX\": \"Acto 4 - Prólogo\",\n";
-                ss << u8"    \"jaJP\": \"第4章 序幕\",\n";
-                ss << u8"    \"ptBR\": \"Prólogo do Ato 4\",\n";
-                ss << u8"    \"ruRU\": \"Акт 4 – пролог\",\n";
-                ss << u8"    \"zhCN\": \"第四幕序章\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 937,\n";
-                ss << u8"    \"Key\": \"qstsa4q1\",\n";
-                ss << u8"    \"enUS\": \"The Fallen Angel\",\n";
-                ss << u8"    \"zhTW\": \"墮落的天使\",\n";
-                ss << u8"    \"deDE\": \"Der gefallene Engel\",\n";
-                ss << u8"    \"esES\": \"El ángel caído\",\n";
-                ss << u8"    \"frFR\": \"L’ange déchu\",\n";
-                ss << u8"    \"itIT\": \"L'angelo caduto\",\n";
-                ss << u8"    \"koKR\": \"타락 천사\",\n";
-                ss << u8"    \"plPL\": \"Upadły anioł\",\n";
-                ss << u8"    \"esMX\": \"El Ángel Caído\",\n";
-                ss << u8"    \"jaJP\": \"堕天使\",\n";
-                ss << u8"    \"ptBR\": \"O Anjo Decaído\",\n";
-                ss << u8"    \"ruRU\": \"Падший ангел\",\n";
-                ss << u8"    \"zhCN\": \"堕落天使\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 938,\n";
-                ss << u8"    \"Key\": \"qstsa4q2\",\n";
-                ss << u8"    \"enUS\": \"Terror's End\",\n";
-                ss << u8"    \"zhTW\": \"恐懼的終結\",\n";
-                ss << u8"    \"deDE\": \"Das Ende des Schreckens\",\n";
-                ss << u8"    \"esES\": \"El fin del terror\",\n";
-                ss << u8"    \"frFR\": \"Fin de la terreur\",\n";
-                ss << u8"    \"itIT\": \"La fine del terrore\",\n";
-                ss << u8"    \"koKR\": \"공포의 끝\",\n";
-                ss << u8"    \"plPL\": \"Koniec Grozy\",\n";
-                ss << u8"    \"esMX\": \"El Final del Terror\",\n";
-                ss << u8"    \"jaJP\": \"恐怖の終わり\",\n";
-                ss << u8"    \"ptBR\": \"O Fim do Medo\",\n";
-                ss << u8"    \"ruRU\": \"Конец Ужаса\",\n";
-                ss << u8"    \"zhCN\": \"恐惧的终结\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 939,\n";
-                ss << u8"    \"Key\": \"qstsa4q3\",\n";
-                ss << u8"    \"enUS\": \"Hell's Forge\",\n";
-                ss << u8"    \"zhTW\": \"地獄熔爐\",\n";
-                ss << u8"    \"deDE\": \"Höllenschmiede\",\n";
-                ss << u8"    \"esES\": \"La Fragua del Infierno\",\n";
-                ss << u8"    \"frFR\": \"La forge des Enfers\",\n";
-                ss << u8"    \"itIT\": \"La Fornace Infernale\",\n";
-                ss << u8"    \"koKR\": \"지옥의 대장간\",\n";
-                ss << u8"    \"plPL\": \"Piekielna Kuźnia\",\n";
-                ss << u8"    \"esMX\": \"Forja Infernal\",\n";
-                ss << u8"    \"jaJP\": \"地獄の炉\",\n";
-                ss << u8"    \"ptBR\": \"A Forja Infernal\",\n";
-                ss << u8"    \"ruRU\": \"Кузня Преисподней\",\n";
-                ss << u8"    \"zhCN\": \"地狱熔炉\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 940,\n";
-                ss << u8"    \"Key\": \"qstsa2q01\",\n";
-                ss << u8"    \"enUS\": \"Lut Gholein\",\n";
-                ss << u8"    \"zhTW\": \"魯高因\",\n";
-                ss << u8"    \"deDE\": \"Lut Gholein\",\n";
-                ss << u8"    \"esES\": \"Lut Gholein\",\n";
-                ss << u8"    \"frFR\": \"Lut Gholein\",\n";
-                ss << u8"    \"itIT\": \"Lut Gholein\",\n";
-                ss << u8"    \"koKR\": \"루트 골레인\",\n";
-                ss << u8"    \"plPL\": \"Lut Gholein\",\n";
-                ss << u8"    \"esMX\": \"Lut Gholein\",\n";
-                ss << u8"    \"jaJP\": \"ラット・ゴーレイン\",\n";
-                ss << u8"    \"ptBR\": \"Lut Gholein\",\n";
-                ss << u8"    \"ruRU\": \"Лут Голейн\",\n";
-                ss << u8"    \"zhCN\": \"鲁·高因\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 941,\n";
-                ss << u8"    \"Key\": \"qstsa2q11\",\n";
-                ss << u8"    \"enUS\": \"Find Radament's Lair in the Lut Gholein sewers.\",\n";
-                ss << u8"    \"zhTW\": \"在魯高因的下水道中，找到羅達門特的巢穴。\",\n";
-                ss << u8"    \"deDE\": \"Findet Radaments Lager in der Kanalisation von Lut Gholein.\",\n";
-                ss << u8"    \"esES\": \"Encuentra el Cubil de Radament en las cloacas de Lut Gholein.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez le repaire de Radament dans les égouts de Lut Gholein.\",\n";
-                ss << u8"    \"itIT\": \"Trova il rifugio di Radament nelle Fogne di Lut Gholein.\",\n";
-                ss << u8"    \"koKR\": \"루트 골레인 하수도에서 라다먼트의 소굴을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź siedlisko Radamenta w kanałach Lut Gholein.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra la Guarida de Radament en las cloacas de Lut Gholein.\",\n";
-                ss << u8"    \"jaJP\": \"ラット・ゴーレインの下水道で〈ラダメントの隠れ家〉を見つける。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre o Covil de Radament no esgoto de Lut Gholein.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите логово Радаманта в стоках Лут-Голейна.\",\n";
-                ss << u8"    \"zhCN\": \"找到鲁·高因下水道中的罗达门特巢穴。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 942,\n";
-                ss << u8"    \"Key\": \"qstsa2q12\",\n";
-                ss << u8"    \"enUS\": \"Kill Radament.\",\n";
-                ss << u8"    \"zhTW\": \"殺死羅達門特。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Radament.\",\n";
-                ss << u8"    \"esES\": \"Mata a Radament.\",\n";
-                ss << u8"    \"frFR\": \"Tuez Radament.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi Radament.\",\n";
-                ss << u8"    \"koKR\": \"라다먼트를 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Radamenta.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Radament.\",\n";
-                ss << u8"    \"jaJP\": \"ラダメントを倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Radament.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Радаманта.\",\n";
-                ss << u8"    \"zhCN\": \"消灭罗达门特。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 943,\n";
-                ss << u8"    \"Key\": \"qstsa2q13\",\n";
-                ss << u8"    \"enUS\": \"Return to Atma for a reward.\",\n";
-                ss << u8"    \"zhTW\": \"回去找亞特瑪領取獎勵。\",\n";
-                ss << u8"    \"deDE\": \"Kehrt zu Atma zurück, um Eure Belohnung zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Vuelve con Atma para recibir una recompensa.\",\n";
-                ss << u8"    \"frFR\": \"Retournez auprès d’Atma pour recevoir votre récompense.\",\n";
-                ss << u8"    \"itIT\": \"Torna da Atma per la ricompensa.\",\n";
-                ss << u8"    \"koKR\": \"아트마에게 돌아가 보상을 받으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Wróć do Atmy po nagrodę.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Atma para recibir tu recompensa.\",\n";
-                ss << u8"    \"jaJP\": \"アトマと会って報酬を受け取る。\",\n";
-                ss << u8"    \"ptBR\": \"Volte até Atma para receber uma recompensa.\",\n";
-                ss << u8"    \"ruRU\": \"Вернитесь к Атме за наградой.\",\n";
-                ss << u8"    \"zhCN\": \"回去找阿特玛获得奖励。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 944,\n";
-                ss << u8"    \"Key\": \"qstsa2q21\",\n";
-                ss << u8"    \"enUS\": \"Show the scroll to Cain in Lut Gholein.\",\n";
-                ss << u8"    \"zhTW\": \"把卷軸拿回魯高因給凱恩看看。\",\n";
-                ss << u8"    \"deDE\": \"Zeigt Cain in Lut Gholein die Schriftrolle.\",\n";
-                ss << u8"    \"esES\": \"Enséñale el pergamino a Caín en Lut Gholein.\",\n";
-                ss << u8"    \"frFR\": \"Montrez le parchemin à Cain à Lut Gholein.\",\n";
-                ss << u8"    \"itIT\": \"Porta la pergamena da Cain a Lut Gholein.\",\n";
-                ss << u8"    \"koKR\": \"루트 골레인에서 케인에게 두루마리를 보여주십시오.\",\n";
-                ss << u8"    \"plPL\": \"Pokaż zwój Cainowi w Lut Gholein.\",\n";
-                ss << u8"    \"esMX\": \"Muéstrale el pergamino a Cain en Lut Gholein.\",\n";
-                ss << u8"    \"jaJP\": \"ラット・ゴーレインでケインにホラドリムの巻物を見せる。\",\n";
-                ss << u8"    \"ptBR\": \"Mostre o pergaminho a Cain em Lut Gholein.\",\n";
-                ss << u8"    \"ruRU\": \"Покажите свиток Декарду Каину в Лут-Голейне.\",\n";
-                ss << u8"    \"zhCN\": \"给在鲁·高因的凯恩展示卷轴。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 945,\n";
-                ss << u8"    \"Key\": \"qstsa2q22\",\n";
-                ss << u8"    \"enUS\": \"Search the Halls of the Dead under the Dry Hills for the Cube. Search the Maggot Lair under the Far Oasis for the Shaft. Search the Claw Viper Temple for the Headpiece.\",\n";
-                ss << u8"    \"zhTW\": \"在乾土高地底下的死亡之殿尋找方塊，在遙遠的綠洲底下的蛆蟲巢穴尋找杖身，在利爪蛇魔神殿尋找杖頂。\",\n";
-                ss << u8"    \"deDE\": \"Sucht in den Hallen der Toten unter den Verdorrten Hügeln nach dem Würfel, in der Wurmgruft unter der Fernen Oase nach dem Schaft und im Tempel der Klauenvipern nach der Spitze.\",\n";
-                ss << u8"    \"esES\": \"Busca el cubo en las Salas de la Muerte, bajo las Colinas Áridas. Busca la vara en el Cubil de Gusanos, bajo el Oasis Lejano. Busca la empuñadura en el Templo de la Garra Viperina.\",\n";
-                ss << u8"    \"frFR\": \"Le cube est dans les Couloirs des morts, sous les Collines arides. Le manche du Bâton est dans le Repaire du ver, sous l’Oasis lointaine et la partie supérieure dans le Temple des Vipères.\",\n";
-                ss << u8"    \"itIT\": \"Cerca il Cubo nelle Sale dei Morti, sotto le Colline Aride. Cerca l'asta nel Covo delle Larve, sotto l'Oasi Lontana. Cerca la testa nel Tempio delle Vipere.\",\n";
-                ss << u8"    \"koKR\": \"메마른 언덕 아래에 있는 망자의 전당에서 함을 찾으십시오. 머나먼 오아시스 아래에 있는 구더기 굴에서 자루를 찾으십시오. 발톱 독사 사원에서 꼭지를 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Przeszukaj Sale Umarłych pod Suchymi Wzgórzami w poszukiwaniu Kostki. Zbadaj Robacze Gniazdo w pobliżu Dalekiej Oazy, aby znaleźć trzonek kostura. Zwieńczenie znajdziesz w Świątyni Żmijoszponów.\",\n";
-                ss << u8"    \"esMX\": \"Busca el Cubo en las Salas de la Muerte bajo las Colinas Áridas. Busca la Vara en la Guarida de Gusanos bajo el Oasis Lejano. Busca el Cabezal en el Templo del Vipérido de Garras.\",\n";
-                ss << u8"    \"jaJP\": \"〈乾きの丘〉の地下にある〈亡者の広間〉を探索し、ホラドリムの〈キューブ〉を見つける。〈遥かなるオアシス〉の地下にある〈地虫の巣穴〉を探索し、ホラドリムの〈杖の柄〉を見つける。〈クロウ・ヴァイパーの寺院〉を探索し、ホラドリムの〈杖の頭部〉を見つける。\",\n";
-                ss << u8"    \"ptBR\": \"Vasculhe os Salões dos Mortos debaixo das Colinas Áridas em busca do Cubo. Vasculhe o Covil de Vermes debaixo do Oásis Longínquo em busca da Haste. Vasculhe o Templo da Víbora da Garra em busca da Peça Superior.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите куб в Чертогах Мертвых под Иссохшими холмами, посох в логове мокриц под Дальним оазисом и наголовник в храме Когтистого Змея.\",\n";
-                ss << u8"    \"zhCN\": \"在干燥高地的亡者大殿中寻找魔盒。在偏远绿洲地下的蛆虫巢穴中找到杖身。搜索利爪蝮蛇神殿寻找杖头。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 946,\n";
-                ss << u8"    \"Key\": \"qstsa2q23\",\n";
-                ss << u8"    \"enUS\": \"Use the Horadric Cube to restore the Staff.\",\n";
-                ss << u8"    \"zhTW\": \"使用赫拉迪姆方塊使法杖復原。\",\n";
-                ss << u8"    \"deDE\": \"Benutzt den Horadrimwürfel, um den Stab wiederherzustellen.\",\n";
-                ss << u8"    \"esES\": \"Utiliza el cubo horádrico para arreglar el bastón.\",\n";
-                ss << u8"    \"frFR\": \"Utilisez le Cube horadrique pour assembler le Bâton.\",\n";
-                ss << u8"    \"itIT\": \"Usa il Cubo Horadrico per rimettere insieme la Verga.\",\n";
-                ss << u8"    \"koKR\": \"호라드림의 함을 사용하여 지팡이를 복원하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Użyj Kostki Horadrimów, by odtworzyć kostur.\",\n";
-                ss << u8"    \"esMX\": \"Usa el Cubo horádrico para restaurar el Bastón.\",\n";
-                ss << u8"    \"jaJP\": \"〈ホラドリムのキューブ〉を使用して〈ホラドリムの杖〉を復元する。\",\n";
-                ss << u8"    \"ptBR\": \"Use o Cubo Horádrico para restaurar o Cajado.\",\n";
-                ss << u8"    \"ruRU\": \"Восстановите посох с помощью хорадримского куба.\",\n";
-                ss << u8"    \"zhCN\": \"使用赫拉迪姆魔盒复原法杖。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 947,\n";
-                ss << u8"    \"Key\": \"qstsa2q24\",\n";
-                ss << u8"    \"enUS\": \"Take the Staff into Tal Rasha's Tomb.\",\n";
-                ss << u8"    \"zhTW\": \"帶著法杖進入塔拉夏的古墓。\",\n";
-                ss << u8"    \"deDE\": \"Bringt den Stab zu Tal Rashas Grab.\",\n";
-                ss << u8"    \"esES\": \"Lleva el bastón a la Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"frFR\": \"Apportez le Bâton au Tombeau de Tal Rasha.\",\n";
-                ss << u8"    \"itIT\": \"Porta la Verga nella Tomba di Tal Rasha.\",\n";
-                ss << u8"    \"koKR\": \"지팡이를 탈 라샤의 무덤으로 가져가십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zanieś kostur do grobowca Tal Rashy.\",\n";
-                ss << u8"    \"esMX\": \"Lleva el Bastón a la Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"jaJP\": \"タル・ラシャの墓に〈ホラドリムの杖〉を持っていく。\",\n";
-                ss << u8"    \"ptBR\": \"Leve o Cajado até a Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"ruRU\": \"Отнесите посох в гробницу Тал Раши.\",\n";
-                ss << u8"    \"zhCN\": \"带着法杖进入塔·拉夏之墓。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 948,\n";
-                ss << u8"    \"Key\": \"qstsa2q25\",\n";
-                ss << u8"    \"enUS\": \"Take the artifacts to Cain in Lut Gholein.\",\n";
-                ss << u8"    \"zhTW\": \"把古物帶回去魯高因，拿給凱恩。\",\n";
-                ss << u8"    \"deDE\": \"Bringt die Artfakte zu Cain in Lut Gholein.\",\n";
-                ss << u8"    \"esES\": \"Llévale los artefactos a Caín en Lut Gholein.\",\n";
-                ss << u8"    \"frFR\": \"Apportez les artéfacts à Cain à Lut Gholein.\",\n";
-                ss << u8"    \"itIT\": \"Porta gli artefatti da Cain a Lut Gholein.\",\n";
-                ss << u8"    \"koKR\": \"유물을 루트 골레인에 있는 케인에게 가져가십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zanieś artefakty do Caina w Lut Gholein.\",\n";
-                ss << u8"    \"esMX\": \"Muéstrale los artefactos a Cain en Lut Gholein.\",\n";
-                ss << u8"    \"jaJP\": \"ラット・ゴーレインにいるケインに遺物を持っていく。\",\n";
-                ss << u8"    \"ptBR\": \"Leve os artefatos até Cain em Lut Gholein.\",\n";
-                ss << u8"    \"ruRU\": \"Отнесите артефакты Декарду Каину в Лут-Голейн.\",\n";
-                ss << u8"    \"zhCN\": \"将神器带给在鲁·高因的凯恩。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 949,\n";
-                ss << u8"    \"Key\": \"qstsa2q31\",\n";
-                ss << u8"    \"enUS\": \"Look for the source of the darkness.\",\n";
-                ss << u8"    \"zhTW\": \"尋找黑暗的源頭。\",\n";
-                ss << u8"    \"deDE\": \"Findet die Quelle der Dunkelheit.\",\n";
-                ss << u8"    \"esES\": \"Busca el origen de la oscuridad.\",\n";
-                ss << u8"    \"frFR\": \"Recherchez la source des ténèbres.\",\n";
-                ss << u8"    \"itIT\": \"Cerca la fonte dell'oscurità.\",\n";
-                ss << u8"    \"koKR\": \"어둠의 근원을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj źródła ciemności.\",\n";
-                ss << u8"    \"esMX\": \"Busca el origen de la oscuridad.\",\n";
-                ss << u8"    \"jaJP\": \"暗闇の原因を突き止める。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pela fonte da escuridão.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите источник загадочной тьмы.\",\n";
-                ss << u8"    \"zhCN\": \"寻找黑暗的源头。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 950,\n";
-                ss << u8"    \"Key\": \"qstsa2q31a\",\n";
-                ss << u8"    \"enUS\": \"Ask Drognan about the strange darkness.\",\n";
-                ss << u8"    \"zhTW\": \"問問卓格南對這片奇怪的黑暗有什麼看法。\",\n";
-                ss << u8"    \"deDE\": \"Befragt Drognan zu der seltsamen Dunkelheit.\",\n";
-                ss << u8"    \"esES\": \"Pregúntale a Drognan por la extraña oscuridad.\",\n";
-                ss << u8"    \"frFR\": \"Questionnez Drognan sur ces mystérieuses ténèbres.\",\n";
-                ss << u8"    \"itIT\": \"Chiedi a Drognan delle tenebre.\",\n";
-                ss << u8"    \"koKR\": \"드로그난에게 이상한 어둠에 관해 물어보십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zapytaj Drognana o dziwną ciemność.\",\n";
-                ss << u8"    \"esMX\": \"Pregúntale a Drognan acerca de la extraña oscuridad.\",\n";
-                ss << u8"    \"jaJP\": \"不可解な暗闇についてドログナンに尋ねる。\",\n";
-                ss << u8"    \"ptBR\": \"Pergunte a Drognan sobre a estranha escuridão.\",\n";
-                ss << u8"    \"ruRU\": \"Расспросите Дрогнана о странном мраке.\",\n";
-                ss << u8"    \"zhCN\": \"询问卓格楠关于天空突然变黑的事。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 951,\n";
-                ss << u8"    \"Key\": \"qstsa2q32\",\n";
-                ss << u8"    \"enUS\": \"Destroy the Serpent Altar in the Claw Viper Temple beneath the Valley of Snakes.\",\n";
-                ss << u8"    \"zhTW\": \"前往群蛇峽谷底下的利爪蛇魔神殿，摧毀其中的祭壇。\",\n";
-                ss << u8"    \"deDE\": \"Zerstört den Schlangenaltar im Tempel der Klauenvipern unter dem Tal der Schlangen.\",\n";
-                ss << u8"    \"esES\": \"Destruye el altar de la serpiente en el Templo de la Garra Viperina, bajo el Valle de las Serpientes.\",\n";
-                ss << u8"    \"frFR\": \"Détruisez l’Autel du serpent dans le Temple des Vipères, sous la Vallée des Serpents.\",\n";
-                ss << u8"    \"itIT\": \"Distruggi l'altare nel Tempio delle Vipere, sotto la Valle dei Serpenti.\",\n";
-                ss << u8"    \"koKR\": \"뱀의 골짜기 아래에 있는 발톱 독사 사원에서 뱀의 제단을 파괴하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zniszcz ołtarz w Świątyni Żmijoszponów pod Doliną Węży.\",\n";
-                ss << u8"    \"esMX\": \"Destruye el Altar serpentino en el Templo del Vipérido de Garras bajo el Valle de las Culebras.\",\n";
-                ss << u8"    \"jaJP\": \"〈蛇の谷の〉近くにある〈クロウ・ヴァイパーの寺院〉で〈蛇の祭壇〉を破壊する。\",\n";
-                ss << u8"    \"ptBR\": \"Destrua o Altar da Serpente no Templo da Víbora da Garra sob o Vale das Cobras.\",\n";
-                ss << u8"    \"ruRU\": \"Уничтожьте алтарь в храме Когтистого Змея под Долиной змей.\",\n";
-                ss << u8"    \"zhCN\": \"摧毁在群蛇峡谷地下的利爪蝮蛇神殿中的毒蛇祭坛。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 952,\n";
-                ss << u8"    \"Key\": \"qstsa2q33\",\n";
-                ss << u8"    \"enUS\": \"Speak with the townsfolk in Lut Gholein.\",\n";
-                ss << u8"    \"zhTW\": \"和魯高因的居民談談。\",\n";
-                ss << u8"    \"deDE\": \"Redet mit den Leuten in Lut Gholein.\",\n";
-                ss << u8"    \"esES\": \"Habla con la gente de Lut Gholein.\",\n";
-                ss << u8"    \"frFR\": \"Parlez avec les villageois de Lut Gholein.\",\n";
-                ss << u8"    \"itIT\": \"Parla con i cittadini di Lut Gholein.\",\n";
-                ss << u8"    \"koKR\": \"루트 골레인의 주민들과 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z mieszkańcami Lut Gholein.\",\n";
-                ss << u8"    \"esMX\": \"Habla con los habitantes de Lut Gholein.\",\n";
-                ss << u8"    \"jaJP\": \"ラット・ゴーレインの住民と話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com a população em Lut Gholein.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с жителями Лут-Голейна.\",\n";
-                ss << u8"    \"zhCN\": \"与鲁·高因的居民们谈谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 953,\n";
-                ss << u8"    \"Key\": \"qstsa2q41\",\n";
-                ss << u8"    \"enUS\": \"Look for the Arcane Sanctuary within the Palace.\",\n";
-                ss << u8"    \"zhTW\": \"到皇宮中尋找秘法聖殿。\",\n";
-                ss << u8"    \"deDE\": \"Sucht im Palast nach der Geheimen Zuflucht.\",\n";
-                ss << u8"    \"esES\": \"Busca el Santuario Arcano dentro del palacio.\",\n";
-                ss << u8"    \"frFR\": \"Recherchez le Sanctuaire des Arcanes dans le Palais.\",\n";
-                ss << u8"    \"itIT\": \"Cerca il Santuario Arcano all'interno del palazzo.\",\n";
-                ss << u8"    \"koKR\": \"궁전 내 비전의 성역을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Tajemnego Sanktuarium w Pałacu.\",\n";
-                ss << u8"    \"esMX\": \"Busca el Santuario Arcano dentro del Palacio.\",\n";
-                ss << u8"    \"jaJP\": \"宮殿内で〈深遠なる聖域〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pelo Santuário Arcano no Palácio.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите Магическое убежище во дворце.\",\n";
-                ss << u8"    \"zhCN\": \"在王宫中寻找神秘避难所。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 954,\n";
-                ss << u8"    \"Key\": \"qstsa2q41a\",\n";
-                ss << u8"    \"enUS\": \"Talk to Drognan.\",\n";
-                ss << u8"    \"zhTW\": \"與卓格南交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Drognan.\",\n";
-                ss << u8"    \"esES\": \"Habla con Drognan.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Drognan.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Drognan.\",\n";
-                ss << u8"    \"koKR\": \"드로그난과 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Drognanem.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Drognan.\",\n";
-                ss << u8"    \"jaJP\": \"ドログナンと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Drognan.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Дрогнаном.\",\n";
-                ss << u8"    \"zhCN\": \"与卓格楠交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 955,\n";
-                ss << u8"    \"Key\": \"qstsa2q42\",\n";
-                ss << u8"    \"enUS\": \"Find Horazon's Journal.\",\n";
-                ss << u8"    \"zhTW\": \"找出赫拉森的日誌。\",\n";
-                ss << u8"    \"deDE\": \"Findet Horazons Tagebuch.\",\n";
-                ss << u8"    \"esES\": \"Encuentra el diario de Horazón.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez le Journal d’Horazon.\",\n";
-                ss << u8"    \"itIT\": \"Trova il Diario di Horazon.\",\n";
-                ss << u8"    \"koKR\": \"호라존의 일지를 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź Dziennik Horazona.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra el Diario de Horazon.\",\n";
-                ss << u8"    \"jaJP\": \"〈ホラゾンの日記〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre o Diário de Horazon.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите дневник Хоразона.\",\n";
-                ss << u8"    \"zhCN\": \"找到霍拉松的日志。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 956,\n";
-                ss << u8"    \"Key\": \"qstsa2q43\",\n";
-                ss << u8"    \"enUS\": \"Continue the search for the Seventh Tomb.\",\n";
-                ss << u8"    \"zhTW\": \"繼續尋找第七個古墓。\",\n";
-                ss << u8"    \"deDE\": \"Sucht weiter nach dem siebten Grab.\",\n";
-                ss << u8"    \"esES\": \"Continúa buscando la séptima tumba.\",\n";
-                ss << u8"    \"frFR\": \"Continuez à chercher le septième Tombeau.\",\n";
-                ss << u8"    \"itIT\": \"Continua a cercare la settima tomba.\",\n";
-                ss << u8"    \"koKR\": \"계속해서 일곱 번째 무덤을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Kontynuuj poszukiwania Siódmego Grobowca.\",\n";
-                ss << u8"    \"esMX\": \"Continúa la búsqueda de la Séptima tumba.\",\n";
-                ss << u8"    \"jaJP\": \"第7の墓の捜索を続行する。\",\n";
-                ss << u8"    \"ptBR\": \"Continue a busca pela Sétima Tumba.\",\n";
-                ss << u8"    \"ruRU\": \"Продолжите поиски Седьмой гробницы.\",\n";
-                ss << u8"    \"zhCN\": \"继续搜索第七座古墓。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 957,\n";
-                ss << u8"    \"Key\": \"qstsa2q51\",\n";
-                ss << u8"    \"enUS\": \"Beware the Summoner.\",\n";
-                ss << u8"    \"zhTW\": \"小心召喚師。\",\n";
-                ss << u8"    \"deDE\": \"Hütet Euch vor dem Geisterbeschwörer.\",\n";
-                ss << u8"    \"esES\": \"Ten cuidado con el Invocador.\",\n";
-                ss << u8"    \"frFR\": \"Attention à l’Invocateur.\",\n";
-                ss << u8"    \"itIT\": \"Fai attenzione all'Evocatore.\",\n";
-                ss << u8"    \"koKR\": \"소환사를 조심하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Strzeż się Demonologa.\",\n";
-                ss << u8"    \"esMX\": \"Ten cuidado con El Invocador.\",\n";
-                ss << u8"    \"jaJP\": \"召喚師に警戒する。\",\n";
-                ss << u8"    \"ptBR\": \"Cuidado com o Evocador.\",\n";
-                ss << u8"    \"ruRU\": \"Остерегайтесь Призывателя.\",\n";
-                ss << u8"    \"zhCN\": \"小心召唤者。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 958,\n";
-                ss << u8"    \"Key\": \"qstsa2q52\",\n";
-                ss << u8"    \"enUS\": \"Kill the Summoner.\",\n";
-                ss << u8"    \"zhTW\": \"殺死召喚師。\",\n";
-                ss << u8"    \"deDE\": \"Tötet den Geisterbeschwörer.\",\n";
-                ss << u8"    \"esES\": \"Mata al Invocador.\",\n";
-                ss << u8"    \"frFR\": \"Tuez l’Invocateur.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi l'Evocatore.\",\n";
-                ss << u8"    \"koKR\": \"소환사를 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Demonologa.\",\n";
-                ss << u8"    \"esMX\": \"Mata al Invocador.\",\n";
-                ss << u8"    \"jaJP\": \"召喚師を倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate o Evocador.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Призывателя.\",\n";
-                ss << u8"    \"zhCN\": \"消灭召唤者。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 959,\n";
-                ss << u8"    \"Key\": \"qstsa2q53\",\n";
-                ss << u8"    \"enUS\": \"Return to town for more information.\",\n";
-                ss << u8"    \"zhTW\": \"回到城鎮打聽更多消息。\",\n";
-                ss << u8"    \"deDE\": \"Kehrt zur Stadt zurück, um weitere Informationen zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Vuelve a la ciudad a por más información.\",\n";
-                ss << u8"    \"frFR\": \"Retournez en ville pour y quérir de nouvelles informations.\",\n";
-                ss << u8"    \"itIT\": \"Torna in città per trovare altre informazioni.\",\n";
-                ss << u8"    \"koKR\": \"마을로 돌아가 자세한 정보를 확인하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Wróć do miasta po nowe informacje.\",\n";
-                ss << u8"    \"esMX\": \"Regresa al poblado para obtener más información.\",\n";
-                ss << u8"    \"jaJP\": \"街に戻って情報を集める。\",\n";
-                ss << u8"    \"ptBR\": \"Volte à cidade para obter mais informações.\",\n";
-                ss << u8"    \"ruRU\": \"Вернитесь в город и постарайтесь что-нибудь узнать.\",\n";
-                ss << u8"    \"zhCN\": \"回到城里打探更多消息。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 960,\n";
-                ss << u8"    \"Key\": \"qstsa2q61\",\n";
-                ss << u8"    \"enUS\": \"Find Tal Rasha's Tomb.\",\n";
-                ss << u8"    \"zhTW\": \"找出塔拉夏的古墓。\",\n";
-                ss << u8"    \"deDE\": \"Findet Tal Rashas Grab.\",\n";
-                ss << u8"    \"esES\": \"Encuentra la Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez le Tombeau de Tal Rasha.\",\n";
-                ss << u8"    \"itIT\": \"Trova la Tomba di Tal Rasha.\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 무덤을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź grobowiec Tal Rashy.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra la Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"jaJP\": \"〈タル・ラシャの墓〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre a Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите гробницу Тал Раши.\",\n";
-                ss << u8"    \"zhCN\": \"找到塔·拉夏之墓。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 961,\n";
-                ss << u8"    \"Key\": \"qstsa2q61a\",\n";
-                ss << u8"    \"enUS\": \"The Symbol of the True Tomb of Tal Rasha.\",\n";
-                ss << u8"    \"zhTW\": \"塔拉夏真正的古墓標有此符號。\",\n";
-                ss << u8"    \"deDE\": \"Das Symbol des wahren Grabes von Tal Rasha.\",\n";
-                ss << u8"    \"esES\": \"El símbolo de la verdadera Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"frFR\": \"Le symbole du Vrai Tombeau de Tal Rasha.\",\n";
-                ss << u8"    \"itIT\": \"Il simbolo della vera Tomba di Tal Rasha.\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 진정한 무덤의 상징입니다.\",\n";
-                ss << u8"    \"plPL\": \"Symbol prawdziwego grobowca Tal Rashy.\",\n";
-                ss << u8"    \"esMX\": \"El símbolo de la verdadera Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"jaJP\": \"〈真のタル・ラシャの墓〉を示す刻印。\",\n";
-                ss << u8"    \"ptBR\": \"O Símbolo da Verdadeira Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"ruRU\": \"Знак истинной гробницы Тал Раши.\",\n";
-                ss << u8"    \"zhCN\": \"塔·拉夏真墓的符号。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 962,\n";
-                ss << u8"    \"Key\": \"qstsa2q62\",\n";
-                ss << u8"    \"enUS\": \"Kill Duriel.\",\n";
-                ss << u8"    \"zhTW\": \"殺死都瑞爾。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Duriel.\",\n";
-                ss << u8"    \"esES\": \"Mata a Duriel.\",\n";
-                ss << u8"    \"frFR\": \"Tuez Duriel.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi Duriel.\",\n";
-                ss << u8"    \"koKR\": \"두리엘을 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Duriela.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Duriel.\",\n";
-                ss << u8"    \"jaJP\": \"デュリエルを倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Duriel.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Дюриэля.\",\n";
-                ss << u8"    \"zhCN\": \"消灭督瑞尔。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 963,\n";
-                ss << u8"    \"Key\": \"qstsa2q63\",\n";
-                ss << u8"    \"enUS\": \"Explore Tal Rasha'a Chamber.\",\n";
-                ss << u8"    \"zhTW\": \"探索塔拉夏的房間。\",\n";
-                ss << u8"    \"deDE\": \"Erforscht Tal Rashas Kammer.\",\n";
-                ss << u8"    \"esES\": \"Explora la cámara de Tal Rasha.\",\n";
-                ss << u8"    \"frFR\": \"Explorez la Chambre de Tal Rasha.\",\n";
-                ss << u8"    \"itIT\": \"Esplora la Cripta di Tal Rasha.\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 방을 탐험하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Przeszukaj Komnatę Tal Rashy.\",\n";
-                ss << u8"    \"esMX\": \"Explora la Cámara de Tal Rasha.\",\n";
-                ss << u8"    \"jaJP\": \"〈タル・ラシャの間〉を調査する。\",\n";
-                ss << u8"    \"ptBR\": \"Explore a Câmara de Tal Rasha.\",\n";
-                ss << u8"    \"ruRU\": \"Исследуйте погребальный зал Тал Раши.\",\n";
-                ss << u8"    \"zhCN\": \"探索塔·拉夏的墓室。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 964,\n";
-                ss << u8"    \"Key\": \"qstsa2q63a\",\n";
-                ss << u8"    \"enUS\": \"Talk to Jerhyn.\",\n";
-                ss << u8"    \"zhTW\": \"與傑恩交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Jerhyn.\",\n";
-                ss << u8"    \"esES\": \"Habla con Jerhyn.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Jerhyn.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Jerhyn.\",\n";
-                ss << u8"    \"koKR\": \"제르힌과 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Jerhynem.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Jerhyn.\",\n";
-                ss << u8"    \"jaJP\": \"ジェランと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Jerrin.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Джерхином.\",\n";
-                ss << u8"    \"zhCN\": \"与耶尔辛交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 965,\n";
-                ss << u8"    \"Key\": \"qstsa2q64\",\n";
-                ss << u8"    \"enUS\": \"Talk to Jerhyn.\",\n";
-                ss << u8"    \"zhTW\": \"與傑恩交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Jerhyn.\",\n";
-                ss << u8"    \"esES\": \"Habla con Jerhyn.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Jerhyn.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Jerhyn.\",\n";
-                ss << u8"    \"koKR\": \"제르힌과 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Jerhynem.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Jerhyn.\",\n";
-                ss << u8"    \"jaJP\": \"ジェランと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Jerrin.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Джерхином.\",\n";
-                ss << u8"    \"zhCN\": \"与耶尔辛交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 966,\n";
-                ss << u8"    \"Key\": \"qstsa2q65\",\n";
-                ss << u8"    \"enUS\": \"Talk to Meshif.\",\n";
-                ss << u8"    \"zhTW\": \"與馬席夫交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Meschif.\",\n";
-                ss << u8"    \"esES\": \"Habla con Meshif.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Meshif.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Meshif.\",\n";
-                ss << u8"    \"koKR\": \"메시프와 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Meshifem.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Meshif.\",\n";
-                ss << u8"    \"jaJP\": \"メシーフと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Meshif.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Месхифом.\",\n";
-                ss << u8"    \"zhCN\": \"与梅席夫交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 967,\n";
-                ss << u8"    \"Key\": \"qstsa3q01\",\n";
-                ss << u8"    \"enUS\": \"Jungle Village\",\n";
-                ss << u8"    \"zhTW\": \"叢林村落\",\n";
-                ss << u8"    \"deDE\": \"Dschungeldorf\",\n";
-                ss << u8"    \"esES\": \"Pueblo de la selva\",\n";
-                ss << u8"    \"frFR\": \"Village de la jungle\",\n";
-                ss << u8"    \"itIT\": \"Villaggio nella giungla\",\n";
-                ss << u8"    \"koKR\": \"밀림 마을\",\n";
-                ss << u8"    \"plPL\": \"Wioska w dżungli\",\n";
-                ss << u8"    \"esMX\": \"Pueblo de la selva\",\n";
-                ss << u8"    \"jaJP\": \"密林の村\",\n";
-                ss << u8"    \"ptBR\": \"Vilarejo da Selva\",\n";
-                ss << u8"    \"ruRU\": \"Деревня в джунглях\",\n";
-                ss << u8"    \"zhCN\": \"丛林村\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 968,\n";
-                ss << u8"    \"Key\": \"qstsa3q11\",\n";
-                ss << u8"    \"enUS\": \"Search the six temples in the Bazaar, Upper Kurast, and the Causeway for Lam Esen's Tome.\",\n";
-                ss << u8"    \"zhTW\": \"在庫拉斯特市集、庫拉斯特上層，和庫拉斯特堤道的六座神殿中，尋找藍伊森之書。\",\n";
-                ss << u8"    \"deDE\": \"Durchsucht die sechs Tempel im Basar, Oberkurast und den Damm nach Lam Esens Folianten.\",\n";
-                ss << u8"    \"esES\": \"Busca el tomo de Lam Esen en los seis templos del Bazar, la Parte Alta y la Calzada de Kurast.\",\n";
-                ss << u8"    \"frFR\": \"Recherchez le livre de Lam Esen dans les six temples du Bazar de la ville haute de Kurast et sur la Chaussée.\",\n";
-                ss << u8"    \"itIT\": \"Trova il Tomo di Lam Esen in uno dei sei templi al Bazar di Kurast, a Kurast Superiore e sulla Strada per Kurast.\",\n";
-                ss << u8"    \"koKR\": \"시장, 상부 쿠라스트, 둑길에 있는 사원 여섯 개에서 람 에센의 고서를 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Przeszukaj sześć świątyń na Bazarze, w Górnym Kurast i na Grobli w poszukiwaniu księgi Lama Esena.\",\n";
-                ss << u8"    \"esMX\": \"Busca el Tomo de Lam Esen en los seis templos en el Bazar, en Alta Kurast y en la Calzada.\",\n";
-                ss << u8"    \"jaJP\": \"〈クラスト・バザール〉、〈クラスト上層〉、〈クラスト舗道〉で六つの寺院を探索し、〈ラム・エセンの書〉を見つける。\",\n";
-                ss << u8"    \"ptBR\": \"Vasculhe os seis templos no Bazar, Kurast Superior e na Passagem em busca do Tomo de Lam Esen.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите фолиант Лам Эсена в одном из шести храмов на базаре Верхнего Кураста или в затопленном ходе.\",\n";
-                ss << u8"    \"zhCN\": \"在库拉斯特集市、库拉斯特上层区和库拉斯特堤道的六个神殿中寻找兰姆·艾森之书。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 969,\n";
-                ss << u8"    \"Key\": \"qstsa3q12\",\n";
-                ss << u8"    \"enUS\": \"Talk to Alkor.\",\n";
-                ss << u8"    \"zhTW\": \"與艾柯交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Alkor.\",\n";
-                ss << u8"    \"esES\": \"Habla con Alkor.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Alkor.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Alkor.\",\n";
-                ss << u8"    \"koKR\": \"알코어와 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Alkorem\",\n";
-                ss << u8"    \"esMX\": \"Habla con Alkor.\",\n";
-                ss << u8"    \"jaJP\": \"アルコルと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Alkor.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Алькором.\",\n";
-                ss << u8"    \"zhCN\": \"与奥科交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 970,\n";
-                ss << u8"    \"Key\": \"qstsa3q21\",\n";
-                ss << u8"    \"enUS\": \"Find Khalim's relics. Search for his Eye in the Spider Cavern.\",\n";
-                ss << u8"    \"zhTW\": \"找出克林姆的聖遺物。在蜘蛛洞窟中尋找他的眼球。\",\n";
-                ss << u8"    \"deDE\": \"Findet Khalims Relikte. Sucht in der Spinnenhöhle nach seinem Auge.\",\n";
-                ss << u8"    \"esES\": \"Encuentra las reliquias de Khalim. Busca su ojo en la Caverna de Arañas.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez les reliques de Khalim. Son Œil serait dans la Caverne de l’Araignée.\",\n";
-                ss << u8"    \"itIT\": \"Trova le reliquie di Khalim. Cerca l'Occhio nella Caverna del Ragno.\",\n";
-                ss << u8"    \"koKR\": \"칼림의 유물을 찾으십시오. 거미 동굴에서 그의 눈을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź relikty Khalima. Poszukaj jego Oka w Grocie Pająków.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra las reliquias de Khalim. Busca su Ojo en la Caverna de Arañas.\",\n";
-                ss << u8"    \"jaJP\": \"カリムの遺物を見つける。〈蜘蛛の洞窟〉で〈カリムの目〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre as relíquias de Khalim. Procure pelo Olho dele na Caverna Aracnídea.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите останки Халима. Поищите его глаз в Паучьей пещере.\",\n";
-                ss << u8"    \"zhCN\": \"找到卡林姆的遗物。在蜘蛛洞穴中寻找他的眼球。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 971,\n";
-                ss << u8"    \"Key\": \"qstsa3q22\",\n";
-                ss << u8"    \"enUS\": \"Search for Khalim's Brain in the Flayer Dungeon.\",\n";
-                ss << u8"    \"zhTW\": \"在剝皮地牢中找出克林姆的大腦。\",\n";
-                ss << u8"    \"deDE\": \"Sucht im Schinderdungeon nach Khalims Gehirn.\",\n";
-                ss << u8"    \"esES\": \"Busca el cerebro de Khalim en la Mazmorra de Desollamiento.\",\n";
-                ss << u8"    \"frFR\": \"Cherchez le Cerveau de Khalim dans la Prison de l’Écorcheur.\",\n";
-                ss << u8"    \"itIT\": \"Cerca il Cervello di Khalim nel Sotterraneo Scorticatore.\",\n";
-                ss << u8"    \"koKR\": \"약탈자 소굴에서 칼림의 뇌를 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Mózgu Khalima w Podziemiach Łupieżców.\",\n";
-                ss << u8"    \"esMX\": \"Busca el Cerebro de Khalim en el Calabozo de los Desolladores.\",\n";
-                ss << u8"    \"jaJP\": \"〈フレイヤーの地下牢〉で〈カリムの脳〉を見つける。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pelo Cérebro de Khalim na Masmorra dos Esfoladores.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите мозг Халима в Подземелье свежевателей.\",\n";
-                ss << u8"    \"zhCN\": \"在剥皮魔监牢中寻找卡林姆的大脑。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 972,\n";
-                ss << u8"    \"Key\": \"qstsa3q23\",\n";
-                ss << u8"    \"enUS\": \"Search for Khalim's Flail in Travincal. Beware the High Council.\",\n";
-                ss << u8"    \"zhTW\": \"在崔凡克找出克林姆的連枷。小心最高議會。\",\n";
-                ss << u8"    \"deDE\": \"Sucht in Travincal nach Khalims Kultflegel. Hütet Euch vor dem Hohen Rat.\",\n";
-                ss << u8"    \"esES\": \"Busca el rompecabezas de Khalim en Travincal. Ten cuidado con el Gran Consejo.\",\n";
-                ss << u8"    \"frFR\": \"Cherchez le Fléau de Khalim à Travincal. Faites attention au Grand Conseil.\",\n";
-                ss << u8"    \"itIT\": \"Cerca il Flagello di Khalim a Travincal. Fai attenzione all'Alto Concilio.\",\n";
-                ss << u8"    \"koKR\": \"트라빈칼에서 칼림의 도리깨를 찾으십시오. 대의회를 조심하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Korbacza Khalima w Travincal. Strzeż się Wysokiej Rady.\",\n";
-                ss << u8"    \"esMX\": \"Busca el Mangual de Khalim en Travincal. Ten cuidado con el Concilio Superior.\",\n";
-                ss << u8"    \"jaJP\": \"トラヴィンカルで〈カリムのフレイル〉を見つける。高等評議会に注意せよ。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pelo Mangual de Khalim em Travincal. Cuidado com o Alto Conselho.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите кистень Халима в Травинкале. Опасайтесь Верховного совета.\",\n";
-                ss << u8"    \"zhCN\": \"在崔凡克寻找卡林姆的连枷。当心高庭理事会。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 973,\n";
-                ss << u8"    \"Key\": \"qstsa3q24\",\n";
-                ss << u8"    \"enUS\": \"Search for Khalim's Heart in the Sewers under the Kurast Bazaar.\",\n";
-                ss << u8"    \"zhTW\": \"在庫拉斯特市集底下的下水道中，尋找克林姆的心臟。\",\n";
-                ss << u8"    \"deDE\": \"Sucht in der Kanalisation unter dem Basar von Kurast nach Khalims Herz.\",\n";
-                ss << u8"    \"esES\": \"Busca el corazón de Khalim en las Cloacas, bajo el Bazar de Kurast.\",\n";
-                ss << u8"    \"frFR\": \"Cherchez le Cœur de Khalim dans les Égouts sous le Bazar de Kurast.\",\n";
-                ss << u8"    \"itIT\": \"Cerca il Cuore di Khalim nelle Fogne, sotto il Bazar di Kurast.\",\n";
-                ss << u8"    \"koKR\": \"쿠라스트 시장 아래의 하수도에서 칼림의 심장을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Serca Khalima w Kanałach pod Bazarem Kurast.\",\n";
-                ss << u8"    \"esMX\": \"Busca el Corazón de Khalim en las Cloacas bajo el Bazar de Kurast.\",\n";
-                ss << u8"    \"jaJP\": \"〈クラスト・バザール〉の下水道で〈カリムの心臓〉を見つける。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pelo Coração de Khalim no Esgoto debaixo do Bazar de Kurast.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите сердце Халима в стоках под Курастским базаром.\",\n";
-                ss << u8"    \"zhCN\": \"在库拉斯特集市的下水道里寻找卡林姆的心脏。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 974,\n";
-                ss << u8"    \"Key\": \"qstsa3q25\",\n";
-                ss << u8"    \"enUS\": \"Transmute Khalim's relics - the Flail, Eye, Heart, and Brain - with the Horadric Cube.\",\n";
-                ss << u8"    \"zhTW\": \"使用赫拉迪姆方塊轉換克林姆的聖遺物：連枷、眼球、心臟，還有大腦。\",\n";
-                ss << u8"    \"deDE\": \"Verwandelt Khalims Relikte - den Kultflegel, das Auge, das Herz und das Gehirn - mit Hilfe des Horadrimwürfels.\",\n";
-                ss << u8"    \"esES\": \"Transmuta las reliquias de Khalim (el rompecabezas, el ojo, el corazón y el cerebro) con el cubo horádrico.\",\n";
-                ss << u8"    \"frFR\": \"Transmutez les reliques de Khalim - le Fléau, l’Œil, le Cœur et le Cerveau - à l’aide du Cube horadrique.\",\n";
-                ss << u8"    \"itIT\": \"Trasmuta il Flagello, l'Occhio, il Cuore e il Cervello di Khalim con il Cubo Horadrico.\",\n";
-                ss << u8"    \"koKR\": \"호라드림의 함으로 도리깨, 눈, 심장, 뇌 등 칼림의 유물을 변환하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Dokonaj transmutacji reliktów Khalima – Korbacza, Oka, Serca i Mózgu – w Kostce Horadrimów.\",\n";
-                ss << u8"    \"esMX\": \"Transmuta las reliquias de Khalim: el Mangual, el Ojo, el Corazón y el Cerebro con el Cubo horádrico.\",\n";
-                ss << u8"    \"jaJP\": \"カリムの遺物であるフレイル、目、心臓、脳を〈ホラドリムのキューブ〉で合成する。\",\n";
-                ss << u8"    \"ptBR\": \"Transmute as relíquias de Khalim (Mangual, Olho, Coração e Cérebro) com o Cubo Horádrico.\",\n";
-                ss << u8"    \"ruRU\": \"Преобразуйте останки Халима – кистень, глаз, сердце и мозг – с помощью хорадримского куба.\",\n";
-                ss << u8"    \"zhCN\": \"使用赫拉迪姆魔盒重塑卡林姆的遗物——连枷、眼球、心脏和大脑。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 975,\n";
-                ss << u8"    \"Key\": \"qstsa3q26\",\n";
-                ss << u8"    \"enUS\": \"Use Khalim's Will to smash the Compelling Orb.\",\n";
-                ss << u8"    \"zhTW\": \"利用克林姆的遺願摧毀強制魔珠。\",\n";
-                ss << u8"    \"deDE\": \"Benutzt Khalims Willen, um die Hypnotische Kugel zu zerschmettern.\",\n";
-                ss << u8"    \"esES\": \"Utiliza la voluntad de Khalim para aplastar el Orbe Impositor.\",\n";
-                ss << u8"    \"frFR\": \"Utilisez la Volonté de Khalim pour détruire l’Orbe d’envoûtement.\",\n";
-                ss << u8"    \"itIT\": \"Usa la Volontà di Khalim per distruggere la Sfera del Dominio.\",\n";
-                ss << u8"    \"koKR\": \"칼림의 의지를 사용하여 유혹의 보주를 파괴하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Użyj Woli Khalima, by rozbić Kulę Zniewolenia.\",\n";
-                ss << u8"    \"esMX\": \"Usa la Voluntad de Khalim para destrozar el Orbe cautivante.\",\n";
-                ss << u8"    \"jaJP\": \"〈カリムの意志〉を使って〈支配のオーブ〉を破壊する。\",\n";
-                ss << u8"    \"ptBR\": \"Use a Vontade de Khalim para esmagar o Orbe Dominador.\",\n";
-                ss << u8"    \"ruRU\": \"Разрушьте Сферу Подчинения с помощью Воли Халима.\",\n";
-                ss << u8"    \"zhCN\": \"使用卡林姆的意志粉碎强迫之球。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 976,\n";
-                ss << u8"    \"Key\": \"qstsa3q21a\",\n";
-                ss << u8"    \"enUS\": \"Ask Cain about Khalim's relics.\",\n";
-                ss << u8"    \"zhTW\": \"詢問凱恩關於克林姆的遺物的事情。\",\n";
-                ss << u8"    \"deDE\": \"Fragt Cain nach Khalims Relikten.\",\n";
-                ss << u8"    \"esES\": \"Pregúntale a Caín por las reliquias de Khalim.\",\n";
-                ss << u8"    \"frFR\": \"Demandez à Cain qu’il vous parle des reliques de Khalim.\",\n";
-                ss << u8"    \"itIT\": \"Chiedi a Cain delle reliquie di Khalim.\",\n";
-                ss << u8"    \"koKR\": \"케인에게 칼림의 유물에 관해 물어보십시오.\",\n";
-                ss << u8"    \"plPL\": \"Wypytaj Caina o relikty Khalima.\",\n";
-                ss << u8"    \"esMX\": \"Pregúntale a Cain acerca de las reliquias de Khalim.\",\n";
-                ss << u8"    \"jaJP\": \"カリムの遺物についてケインに尋ねる。\",\n";
-                ss << u8"    \"ptBR\": \"Pergunte a Cain sobre as relíquias de Khalim.\",\n";
-                ss << u8"    \"ruRU\": \"Расспросите Каина о реликвиях Халима.\",\n";
-                ss << u8"    \"zhCN\": \"询问凯恩关于卡林姆遗物的事情。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 977,\n";
-                ss << u8"    \"Key\": \"qstsa3q31\",\n";
-                ss << u8"    \"enUS\": \"Look for the Gidbinn in the Flayer Jungle.\",\n";
-                ss << u8"    \"zhTW\": \"在剝皮叢林中尋找吉德賓。\",\n";
-                ss << u8"    \"deDE\": \"Findet den Gidbinn im Schinderdschungel.\",\n";
-                ss << u8"    \"esES\": \"Busca la Gidbinn en la Selva Desolladora.\",\n";
-                ss << u8"    \"frFR\": \"Recherchez le Gidbinn dans la jungle de l’Écorcheur.\",\n";
-                ss << u8"    \"itIT\": \"Cerca il Gidbinn nella Giungla Scorticatrice.\",\n";
-                ss << u8"    \"koKR\": \"약탈자 밀림에서 기드빈을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Gidbinna w Dżungli Łupieżców.\",\n";
-                ss << u8"    \"esMX\": \"Busca la Gidbinn en la Jungla de los Desolladores.\",\n";
-                ss << u8"    \"jaJP\": \"〈フレイヤーの密林〉で〈ギドビン〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pela Gidbinn na Selva dos Esfoladores.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите Гидбинн в Джунглях свежевателей.\",\n";
-                ss << u8"    \"zhCN\": \"在剥皮魔丛林中寻找吉德宾。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 978,\n";
-                ss << u8"    \"Key\": \"qstsa3q32\",\n";
-                ss << u8"    \"enUS\": \"Pick up the Gidbinn.\",\n";
-                ss << u8"    \"zhTW\": \"撿起吉德賓。\",\n";
-                ss << u8"    \"deDE\": \"Nehmt den Gidbinn an Euch.\",\n";
-                ss << u8"    \"esES\": \"Coge la Gidbinn.\",\n";
-                ss << u8"    \"frFR\": \"Récupérez le Gidbinn.\",\n";
-                ss << u8"    \"itIT\": \"Prendi il Gidbinn.\",\n";
-                ss << u8"    \"koKR\": \"기드빈을 집으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Podnieś Gidbinna.\",\n";
-                ss << u8"    \"esMX\": \"Recoge la Gidbinn.\",\n";
-                ss << u8"    \"jaJP\": \"〈ギドビン〉を回収する。\",\n";
-                ss << u8"    \"ptBR\": \"Pegue a Gidbinn.\",\n";
-                ss << u8"    \"ruRU\": \"Возьмите Гидбинн.\",\n";
-                ss << u8"    \"zhCN\": \"拿起吉德宾。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 979,\n";
-                ss << u8"    \"Key\": \"qstsa3q33\",\n";
-                ss << u8"    \"enUS\": \"Return the Gidbinn to Ormus.\",\n";
-                ss << u8"    \"zhTW\": \"把吉德賓帶回去給奧瑪斯。\",\n";
-                ss << u8"    \"deDE\": \"Bringt den Gidbinn zu Ormus zurück.\",\n";
-                ss << u8"    \"esES\": \"Devuélvele la Gidbinn a Ormus.\",\n";
-                ss << u8"    \"frFR\": \"Ramenez le Gidbinn à Ormus.\",\n";
-                ss << u8"    \"itIT\": \"Porta il Gidbinn a Ormus.\",\n";
-                ss << u8"    \"koKR\": \"기드빈을 오르무스에게 돌려주십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zwróć Gidbinna Ormusowi.\",\n";
-                ss << u8"    \"esMX\": \"Llévale la Gidbinn a Ormus.\",\n";
-                ss << u8"    \"jaJP\": \"戻ってオーマスに〈ギドビン〉を渡す。\",\n";
-                ss << u8"    \"ptBR\": \"Devolva a Gidbinn para Órmus.\",\n";
-                ss << u8"    \"ruRU\": \"Верните Гидбинн Ормусу.\",\n";
-                ss << u8"    \"zhCN\": \"把吉德宾交还给奥玛斯。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 980,\n";
-                ss << u8"    \"Key\": \"qstsa3q34\",\n";
-                ss << u8"    \"enUS\": \"Talk to Asheara.\",\n";
-                ss << u8"    \"zhTW\": \"與艾席拉交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Ashara.\",\n";
-                ss << u8"    \"esES\": \"Habla con Asheara.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Asheara.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Asheara.\",\n";
-                ss << u8"    \"koKR\": \"아시아라와 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Ashearą.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Asheara.\",\n";
-                ss << u8"    \"jaJP\": \"アシェアラと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Ashara.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Аширой.\",\n";
-                ss << u8"    \"zhCN\": \"与艾席拉交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 981,\n";
-                ss << u8"    \"Key\": \"qstsa3q35\",\n";
-                ss << u8"    \"enUS\": \"Talk to Ormus.\",\n";
-                ss << u8"    \"zhTW\": \"與奧瑪斯交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Ormus.\",\n";
-                ss << u8"    \"esES\": \"Habla con Ormus.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Ormus.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Ormus.\",\n";
-                ss << u8"    \"koKR\": \"오르무스와 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Ormusem.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Ormus.\",\n";
-                ss << u8"    \"jaJP\": \"オーマスと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Órmus.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Ормусом.\",\n";
-                ss << u8"    \"zhCN\": \"与奥玛斯交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 982,\n";
-                ss << u8"    \"Key\": \"qstsa3q41\",\n";
-                ss << u8"    \"enUS\": \"Ask Cain about the Jade Figurine.\",\n";
-                ss << u8"    \"zhTW\": \"詢問凱恩關於翠玉塑像的事情。\",\n";
-                ss << u8"    \"deDE\": \"Befragt Cain zu der Jadefigur.\",\n";
-                ss << u8"    \"esES\": \"Pregúntale a Caín por la estatuilla de jade.\",\n";
-                ss << u8"    \"frFR\": \"Interrogez Cain à propos de la figurine de jade.\",\n";
-                ss << u8"    \"itIT\": \"Chiedi a Cain della Statuetta di Giada.\",\n";
-                ss << u8"    \"koKR\": \"케인에게 비취 조각상에 관해 물어보십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zapytaj Caina o Jadeitową Figurkę.\",\n";
-                ss << u8"    \"esMX\": \"Pregúntale a Cain acerca de la Estatuilla de jade.\",\n";
-                ss << u8"    \"jaJP\": \"〈翡翠の小像〉についてケインに尋ねる。\",\n";
-                ss << u8"    \"ptBR\": \"Pergunte a Cain sobre a Estatueta de Jade.\",\n";
-                ss << u8"    \"ruRU\": \"Расспросите Декарда Каина о нефритовой статуэтке.\",\n";
-                ss << u8"    \"zhCN\": \"询问凯恩关于玉石雕像的事情。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 983,\n";
-                ss << u8"    \"Key\": \"qstsa3q42\",\n";
-                ss << u8"    \"enUS\": \"Show Meshif the Figurine.\",\n";
-                ss << u8"    \"zhTW\": \"把塑像拿給馬席夫看看。\",\n";
-                ss << u8"    \"deDE\": \"Zeigt Meschif die Figur.\",\n";
-                ss << u8"    \"esES\": \"Enséñale la estatuilla a Meshif.\",\n";
-                ss << u8"    \"frFR\": \"Montrez la figurine à Meshif.\",\n";
-                ss << u8"    \"itIT\": \"Mostra la Statuetta a Meshif.\",\n";
-                ss << u8"    \"koKR\": \"메시프에게 조각상을 보여주십시오.\",\n";
-                ss << u8"    \"plPL\": \"Pokaż figurkę Meshifowi.\",\n";
-                ss << u8"    \"esMX\": \"Muéstrale la Estatuilla a Meshif.\",\n";
-                ss << u8"    \"jaJP\": \"〈翡翠の小像〉をメシーフに見せる。\",\n";
-                ss << u8"    \"ptBR\": \"Mostre a Estatueta para Meshif.\",\n";
-                ss << u8"    \"ruRU\": \"Покажите статуэтку Месхифу.\",\n";
-                ss << u8"    \"zhCN\": \"向梅席夫展示雕像。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 984,\n";
-                ss << u8"    \"Key\": \"qstsa3q43\",\n";
-                ss << u8"    \"enUS\": \"Ask Cain about the Golden Bird.\",\n";
-                ss << u8"    \"zhTW\": \"詢問凱恩關於黃金鳥的事情。\",\n";
-                ss << u8"    \"deDE\": \"Befragt Cain zu dem goldenen Vogel.\",\n";
-                ss << u8"    \"esES\": \"Pregúntale a Caín por el pájaro dorado.\",\n";
-                ss << u8"    \"frFR\": \"Interrogez Cain à propos de l’Oiseau de Feu.\",\n";
-                ss << u8"    \"itIT\": \"Chiedi a Cain dell'Uccello d'Oro.\",\n";
-                ss << u8"    \"koKR\": \"케인에게 황금 새에 관해 물어보십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zapytaj Caina o Złotego Ptaka.\",\n";
-                ss << u8"    \"esMX\": \"Pregúntale a Cain acerca del Pájaro Dorado.\",\n";
-                ss << u8"    \"jaJP\": \"〈黄金の鳥〉についてケインに尋ねる。\",\n";
-                ss << u8"    \"ptBR\": \"Pergunte a Cain sobre o Pássaro Dourado.\",\n";
-                ss << u8"    \"ruRU\": \"Расспросите Декарда Каина о Золотой птице.\",\n";
-                ss << u8"    \"zhCN\": \"询问凯恩关于黄金鸟的事情。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 985,\n";
-                ss << u8"    \"Key\": \"qstsa3q44\",\n";
-                ss << u8"    \"enUS\": \"Give the Golden Bird to Alkor.\",\n";
-                ss << u8"    \"zhTW\": \"把黃金鳥交給艾柯。\",\n";
-                ss << u8"    \"deDE\": \"Gebt Alkor den goldenen Vogel.\",\n";
-                ss << u8"    \"esES\": \"Dale el pájaro dorado a Alkor.\",\n";
-                ss << u8"    \"frFR\": \"Donnez l’Oiseau de Feu à Alkor.\",\n";
-                ss << u8"    \"itIT\": \"Dai l'Uccello d'Oro ad Alkor.\",\n";
-                ss << u8"    \"koKR\": \"알코어에게 황금 새를 주십시오.\",\n";
-                ss << u8"    \"plPL\": \"Oddaj Złotego Ptaka Alkorowi.\",\n";
-                ss << u8"    \"esMX\": \"Entrégale el Pájaro Dorado a Alkor.\",\n";
-                ss << u8"    \"jaJP\": \"アルコルに〈黄金の鳥〉を渡す。\",\n";
-                ss << u8"    \"ptBR\": \"Dê o Pássaro Dourado a Alkor.\",\n";
-                ss << u8"    \"ruRU\": \"Отдайте Золотую птицу Алькору.\",\n";
-                ss << u8"    \"zhCN\": \"将黄金鸟交给奥科。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 986,\n";
-                ss << u8"    \"Key\": \"qstsa3q45\",\n";
-                ss << u8"    \"enUS\": \"Return to Alkor for reward.\",\n";
-                ss << u8"    \"zhTW\": \"回去找艾柯，領取獎勵。\",\n";
-                ss << u8"    \"deDE\": \"Kehrt zu Alkor zurück, um Eure Belohnung zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Vuelve con Alkor para recibir una recompensa.\",\n";
-                ss << u8"    \"frFR\": \"Retournez auprès d’Alkor pour recevoir votre récompense.\",\n";
-                ss << u8"    \"itIT\": \"Torna da Alkor per la ricompensa.\",\n";
-                ss << u8"    \"koKR\": \"알코어에게 돌아가 보상을 받으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Wróć do Alkora po nagrodę.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Alkor para recibir tu recompensa.\",\n";
-                ss << u8"    \"jaJP\": \"アルコルと会って報酬を受け取る。\",\n";
-                ss << u8"    \"ptBR\": \"Volte até Alkor para receber uma recompensa.\",\n";
-                ss << u8"    \"ruRU\": \"Вернитесь к Алькору за наградой.\",\n";
-                ss << u8"    \"zhCN\": \"回去找奥科领取奖励。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 987,\n";
-                ss << u8"    \"Key\": \"qstsa3q51\",\n";
-                ss << u8"    \"enUS\": \"Find the Blackened Temple within Travincal.\",\n";
-                ss << u8"    \"zhTW\": \"在崔凡克找到晦影神殿。\",\n";
-                ss << u8"    \"deDE\": \"Sucht in Travincal nach dem Schwarzen Tempel.\",\n";
-                ss << u8"    \"esES\": \"Encuentra el Templo Ennegrecido en Travincal.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez le Temple noirci dans Travincal.\",\n";
-                ss << u8"    \"itIT\": \"Trova il tempio oscuro all'interno di Travincal.\",\n";
-                ss << u8"    \"koKR\": \"트라빈칼 내에서 검게 물든 사원을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź Poczerniałą Świątynię w Travincal.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra el Templo Corrupto dentro de Travincal.\",\n";
-                ss << u8"    \"jaJP\": \"トラヴィンカル内で〈穢れた神殿〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre o Templo Corrompido em Travincal.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите Оскверненный храм в Травинкале.\",\n";
-                ss << u8"    \"zhCN\": \"在崔凡克中找到黑化神殿。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 988,\n";
-                ss << u8"    \"Key\": \"qstsa3q52\",\n";
-                ss << u8"    \"enUS\": \"Kill the High Council.\",\n";
-                ss << u8"    \"zhTW\": \"殺死所有最高議會的成員。\",\n";
-                ss << u8"    \"deDE\": \"Tötet den Hohen Rat.\",\n";
-                ss << u8"    \"esES\": \"Mata al Gran Consejo.\",\n";
-                ss << u8"    \"frFR\": \"Tuez le Grand Conseil.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi l'Alto Concilio.\",\n";
-                ss << u8"    \"koKR\": \"대의회를 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Wysoką Radę.\",\n";
-                ss << u8"    \"esMX\": \"Mata al Concilio Superior.\",\n";
-                ss << u8"    \"jaJP\": \"高等評議会を倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate o Alto Conselho.\",\n";
-                ss << u8"    \"ruRU\": \"Уничтожьте Верховный совет.\",\n";
-                ss << u8"    \"zhCN\": \"消灭高庭理事会。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 989,\n";
-                ss << u8"    \"Key\": \"qstsa3q53\",\n";
-                ss << u8"    \"enUS\": \"Ask Cain for help.\",\n";
-                ss << u8"    \"zhTW\": \"請求凱恩協助。\",\n";
-                ss << u8"    \"deDE\": \"Bittet Cain um Hilfe.\",\n";
-                ss << u8"    \"esES\": \"Pídele ayuda a Caín.\",\n";
-                ss << u8"    \"frFR\": \"Demandez de l’aide à Cain\",\n";
-                ss << u8"    \"itIT\": \"Chiedi aiuto a Cain.\",\n";
-                ss << u8"    \"koKR\": \"케인에게 도움을 요청하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poproś Caina o pomoc.\",\n";
-                ss << u8"    \"esMX\": \"Pídele ayuda a Cain.\",\n";
-                ss << u8"    \"jaJP\": \"ケインに助言を求める。\",\n";
-                ss << u8"    \"ptBR\": \"Peça ajuda a Cain.\",\n";
-                ss << u8"    \"ruRU\": \"Попросите помощи у Декарда Каина.\",\n";
-                ss << u8"    \"zhCN\": \"向凯恩寻求帮助。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 990,\n";
-                ss << u8"    \"Key\": \"qstsa3q61\",\n";
-                ss << u8"    \"enUS\": \"Smash the Compelling Orb with Khalim's Will to open the way to Mephisto's Durance.\",\n";
-                ss << u8"    \"zhTW\": \"利用克林姆的遺願把強制魔珠毀掉，打通一條前往墨菲斯托囚牢的路。\",\n";
-                ss << u8"    \"deDE\": \"Zerschmettert die Hypnotische Kugel mithilfe von Khalims Willen, um den Weg zu Mephistos Kerker zu öffnen.\",\n";
-                ss << u8"    \"esES\": \"Aplasta el Orbe Impositor con la voluntad de Khalim para abrir el camino a la Represión de Mefisto.\",\n";
-                ss << u8"    \"frFR\": \"Détruisez l’Orbe d’envoûtement à l’aide de la Volonté de Khalim.\",\n";
-                ss << u8"    \"itIT\": \"Distruggi la Sfera del Dominio con la Volontà di Khalim per raggiungere la prigione di Mefisto.\",\n";
-                ss << u8"    \"koKR\": \"칼림의 의지로 유혹의 보주를 파괴하여 메피스토의 억류지로 가는 길을 여십시오.\",\n";
-                ss << u8"    \"plPL\": \"Rozbij Kulę Zniewolenia za pomocą Woli Khalima, aby otworzyć drogę do Kazamat Mefista.\",\n";
-                ss << u8"    \"esMX\": \"Destroza el Orbe cautivante con la Voluntad de Khalim para abrir el camino a la Prisión de Mefisto.\",\n";
-                ss << u8"    \"jaJP\": \"〈カリムの意志〉で〈支配のオーブ〉を破壊し、〈メフィストの牢獄〉への入口を開く。\",\n";
-                ss << u8"    \"ptBR\": \"Esmague o Orbe Dominador com a Vontade de Khalim para abrir caminho até o Cárcere de Mefisto.\",\n";
-                ss << u8"    \"ruRU\": \"Разрушьте Сферу Подчинения с помощью Воли Халима, чтобы открыть путь в узилище Мефисто.\",\n";
-                ss << u8"    \"zhCN\": \"使用卡林姆的意志粉碎强迫之球，打开通向墨菲斯托的囚牢的通道。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 991,\n";
-                ss << u8"    \"Key\": \"qstsa3q62\",\n";
-                ss << u8"    \"enUS\": \"Search for Mephisto in his Durance.\",\n";
-                ss << u8"    \"zhTW\": \"在囚牢中找出墨菲斯托。\",\n";
-                ss << u8"    \"deDE\": \"Findet Mephisto in seinem Kerker.\",\n";
-                ss << u8"    \"esES\": \"Busca a Mefisto en su Represión.\",\n";
-                ss << u8"    \"frFR\": \"Recherchez Méphisto dans sa prison.\",\n";
-                ss << u8"    \"itIT\": \"Cerca Mefisto nella sua prigione.\",\n";
-                ss << u8"    \"koKR\": \"억류지에서 메피스토를 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Mefista w jego Kazamatach.\",\n";
-                ss << u8"    \"esMX\": \"Busca a Mefisto en su Prisión.\",\n";
-                ss << u8"    \"jaJP\": \"牢獄でメフィストを探す。\",\n";
-                ss << u8"    \"ptBR\": \"Procure por Mefisto no Cárcere.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите Мефисто в его узилище.\",\n";
-                ss << u8"    \"zhCN\": \"在墨菲斯托的囚牢中找到他。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 992,\n";
-                ss << u8"    \"Key\": \"qstsa3q63\",\n";
-                ss << u8"    \"enUS\": \"Kill Mephisto.\",\n";
-                ss << u8"    \"zhTW\": \"殺死墨菲斯托。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Mephisto.\",\n";
-                ss << u8"    \"esES\": \"Mata a Mefisto.\",\n";
-                ss << u8"    \"frFR\": \"Tuez Méphisto.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi Mefisto.\",\n";
-                ss << u8"    \"koKR\": \"메피스토를 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Mefista.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Mefisto.\",\n";
-                ss << u8"    \"jaJP\": \"メフィストを倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Mefisto.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Мефисто.\",\n";
-                ss << u8"    \"zhCN\": \"消灭墨菲斯托。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 993,\n";
-                ss << u8"    \"Key\": \"qstsa3q31a\",\n";
-                ss << u8"    \"enUS\": \"Ask around the Docks about the Gidbinn.\",\n";
-                ss << u8"    \"zhTW\": \"在港口附近打聽吉德賓的事情。\",\n";
-                ss << u8"    \"deDE\": \"Fragt bei den Docks nach dem Gidbinn.\",\n";
-                ss << u8"    \"esES\": \"Pregunta en los muelles por la Gidbinn.\",\n";
-                ss << u8"    \"frFR\": \"Renseignez-vous sur les quais à propos du Gidbinn.\",\n";
-                ss << u8"    \"itIT\": \"Chiedi del Gidbinn al porto.\",\n";
-                ss << u8"    \"koKR\": \"부두에서 기드빈에 관해 물어보십시오.\",\n";
-                ss << u8"    \"plPL\": \"Popytaj w Dokach o Gidbinna.\",\n";
-                ss << u8"    \"esMX\": \"Pregunta en los Muelles acerca de la Gidbinn.\",\n";
-                ss << u8"    \"jaJP\": \"〈クラスト港〉で〈ギドビン〉のことを聞いて回る。\",\n";
-                ss << u8"    \"ptBR\": \"Pergunte sobre a Gidbinn nas Docas.\",\n";
-                ss << u8"    \"ruRU\": \"Поспрашивайте в доках о Гидбинне.\",\n";
-                ss << u8"    \"zhCN\": \"在港口里打听一下关于吉德宾的事情。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 994,\n";
-                ss << u8"    \"Key\": \"qstsa3q51a\",\n";
-                ss << u8"    \"enUS\": \"Ask Ormus about the Blackened Temple.\",\n";
-                ss << u8"    \"zhTW\": \"問問奧瑪斯有關晦影神殿的消息。\",\n";
-                ss << u8"    \"deDE\": \"Befragt Ormus zum Schwarzen Tempel.\",\n";
-                ss << u8"    \"esES\": \"Pregúntale a Ormus por el Templo Ennegrecido.\",\n";
-                ss << u8"    \"frFR\": \"Interrogez Ormus à propos du Temple Noirci.\",\n";
-                ss << u8"    \"itIT\": \"Chiedi a Ormus del tempio oscuro.\",\n";
-                ss << u8"    \"koKR\": \"오르무스에게 검게 물든 사원에 관해 물어보십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zapytaj Ormusa o Poczerniałą Świątynię.\",\n";
-                ss << u8"    \"esMX\": \"Pregúntale a Ormus acerca del Templo Corrupto.\",\n";
-                ss << u8"    \"jaJP\": \"〈穢れた神殿〉についてオーマスに尋ねる。\",\n";
-                ss << u8"    \"ptBR\": \"Pergunte a Órmus sobre o Templo Corrompido.\",\n";
-                ss << u8"    \"ruRU\": \"Расспросите Ормуса об Оскверненном храме.\",\n";
-                ss << u8"    \"zhCN\": \"问问奥玛斯有关黑化神殿的事。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 995,\n";
-                ss << u8"    \"Key\": \"qstsa3q61a\",\n";
-                ss << u8"    \"enUS\": \"Ormus has news about the Guardian.\",\n";
-                ss << u8"    \"zhTW\": \"奧瑪斯有關於守護者的新消息。\",\n";
-                ss << u8"    \"deDE\": \"Ormus hat Neuigkeiten über den Wächter.\",\n";
-                ss << u8"    \"esES\": \"Ormus tiene noticias sobre el guardián.\",\n";
-                ss << u8"    \"frFR\": \"Ormus a de nouvelles informations sur le Gardien.\",\n";
-                ss << u8"    \"itIT\": \"Ormus ha delle notizie sul guardiano.\",\n";
-                ss << u8"    \"koKR\": \"오르무스가 수호자에 대한 소식이 있다고 합니다.\",\n";
-                ss << u8"    \"plPL\": \"Ormus ma wieści na temat Strażnika.\",\n";
-                ss << u8"    \"esMX\": \"Ormus tiene noticias acerca del Guardián.\",\n";
-                ss << u8"    \"jaJP\": \"オーマスが守護者に関する情報を持っている。\",\n";
-                ss << u8"    \"ptBR\": \"Órmus tem novidades sobre o Guardião.\",\n";
-                ss << u8"    \"ruRU\": \"Ормус кое-что узнал о Страже.\",\n";
-                ss << u8"    \"zhCN\": \"奥玛斯带来了关于守护者的消息。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 996,\n";
-                ss << u8"    \"Key\": \"qstsa4q11\",\n";
-                ss << u8"    \"enUS\": \"Look for Izual in the Plains of Despair.\",\n";
-                ss << u8"    \"zhTW\": \"在絕望平原尋找伊卒爾。\",\n";
-                ss << u8"    \"deDE\": \"Findet Izual in der Ebene der Verzweiflung.\",\n";
-                ss << u8"    \"esES\": \"Busca a Izual en las Llanuras del Desaliento.\",\n";
-                ss << u8"    \"frFR\": \"Recherchez Izual dans les Plaines du désespoir.\",\n";
-                ss << u8"    \"itIT\": \"Cerca Izual nelle Pianure della Disperazione.\",\n";
-                ss << u8"    \"koKR\": \"절망의 평원에서 이주알을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Izuala na Równinie Rozpaczy.\",\n";
-                ss << u8"    \"esMX\": \"Busca a Izual en la Llanura del Desespero.\",\n";
-                ss << u8"    \"jaJP\": \"〈絶望の平原〉でイズアルを探す。\",\n";
-                ss << u8"    \"ptBR\": \"Procure por Izual na Planície do Desespero.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите Изуала в долине Отчаяния.\",\n";
-                ss << u8"    \"zhCN\": \"在绝望平原上寻找衣卒尔。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 997,\n";
-                ss << u8"    \"Key\": \"qstsa4q12\",\n";
-                ss << u8"    \"enUS\": \"Destroy the demon that holds Izual's soul.\",\n";
-                ss << u8"    \"zhTW\": \"消滅控制伊卒爾靈魂的惡魔。\",\n";
-                ss << u8"    \"deDE\": \"Vernichtet den Dämon, der Izuals Seele gefangen hält.\",\n";
-                ss << u8"    \"esES\": \"Destruye al demonio que tiene el alma de Izual.\",\n";
-                ss << u8"    \"frFR\": \"Détruisez le démon qui détient l’âme d’Izual.\",\n";
-                ss << u8"    \"itIT\": \"Distruggi il demone che contiene l'anima di Izual.\",\n";
-                ss << u8"    \"koKR\": \"이주알의 영혼을 담고 있는 악마를 제거하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zniszcz Demona, który posiadł duszę Izuala.\",\n";
-                ss << u8"    \"esMX\": \"Destruye al demonio que guarda el alma de Izual.\",\n";
-                ss << u8"    \"jaJP\": \"イズアルの魂を束縛する悪魔を倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Destrua o demônio que aprisiona a alma de Izual.\",\n";
-                ss << u8"    \"ruRU\": \"Уничтожьте демона, который поглотил душу Изуала.\",\n";
-                ss << u8"    \"zhCN\": \"消灭囚禁衣卒尔灵魂的恶魔。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 998,\n";
-                ss << u8"    \"Key\": \"qstsa4q13a\",\n";
-                ss << u8"    \"enUS\": \"Talk to Izual's Spirit.\",\n";
-                ss << u8"    \"zhTW\": \"與伊卒爾的靈魂交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Izuals Geist.\",\n";
-                ss << u8"    \"esES\": \"Habla con el espíritu de Izual.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à l’Esprit d’Izual.\",\n";
-                ss << u8"    \"itIT\": \"Parla con lo spirito di Izual.\",\n";
-                ss << u8"    \"koKR\": \"이주알의 영혼과 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z duchem Izuala.\",\n";
-                ss << u8"    \"esMX\": \"Habla con el espíritu de Izual.\",\n";
-                ss << u8"    \"jaJP\": \"イズアルの魂と話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com o Espírito de Izual.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с духом Изуала.\",\n";
-                ss << u8"    \"zhCN\": \"与衣卒尔的灵魂对话。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 999,\n";
-                ss << u8"    \"Key\": \"qstsa4q13\",\n";
-                ss << u8"    \"enUS\": \"See Tyrael for reward.\",\n";
-                ss << u8"    \"zhTW\": \"去找泰瑞爾，領取獎勵。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Tyrael, um Eure Belohnung zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Visita a Tyrael para recibir una recompensa.\",\n";
-                ss << u8"    \"frFR\": \"Tyraël vous récompensera.\",\n";
-                ss << u8"    \"itIT\": \"Vai da Tyrael per la ricompensa.\",\n";
-                ss << u8"    \"koKR\": \"티리엘을 만나 보상을 받으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Udaj się do Tyraela po nagrodę.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Tyrael para recibir tu recompensa.\",\n";
-                ss << u8"    \"jaJP\": \"ティラエルと会って報酬を受け取る。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre Tyrael para receber uma recompensa.\",\n";
-                ss << u8"    \"ruRU\": \"Получите награду у Тираэля.\",\n";
-                ss << u8"    \"zhCN\": \"去见泰瑞尔领取奖励。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1000,\n";
-                ss << u8"    \"Key\": \"qstsa4q31\",\n";
-                ss << u8"    \"enUS\": \"Take Mephisto's Soulstone to the Hellforge.\",\n";
-                ss << u8"    \"zhTW\": \"帶著墨菲斯托的靈魂石，前往地獄熔爐。\",\n";
-                ss << u8"    \"deDE\": \"Bringt Mephistos Seelenstein zur Höllenschmiede.\",\n";
-                ss << u8"    \"esES\": \"Lleva la piedra de alma de Mefisto a la Fragua del Infierno.\",\n";
-                ss << u8"    \"frFR\": \"Emportez la pierre d’âme de Méphisto dans la Forge des Enfers.\",\n";
-                ss << u8"    \"itIT\": \"Porta la Pietra dell'Anima di Mefisto alla Fornace Infernale.\",\n";
-                ss << u8"    \"koKR\": \"메피스토의 영혼석을 지옥의 대장간으로 가져가십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabierz Kamień Duszy Mefista do Piekielnej Kuźni.\",\n";
-                ss << u8"    \"esMX\": \"Lleva la Piedra Esencial de Mefisto a la Forja Infernal.\",\n";
-                ss << u8"    \"jaJP\": \"〈地獄の炉〉にメフィストのソウルストーンを持っていく。\",\n";
-                ss << u8"    \"ptBR\": \"Leve a Pedra das Almas de Mefisto até a Forja Infernal.\",\n";
-                ss << u8"    \"ruRU\": \"Отнесите камень души Мефисто в Адскую кузню.\",\n";
-                ss << u8"    \"zhCN\": \"把墨菲斯托的灵魂石带到地狱熔炉。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1001,\n";
-                ss << u8"    \"Key\": \"qstsa4q32\",\n";
-                ss << u8"    \"enUS\": \"Destroy Mephisto's Soulstone at the Hellforge.\",\n";
-                ss << u8"    \"zhTW\": \"在地獄熔爐摧毀墨菲斯托的靈魂石。\",\n";
-                ss << u8"    \"deDE\": \"Zerstört Mephistos Seelenstein in der Höllenschmiede.\",\n";
-                ss << u8"    \"esES\": \"Destruye la piedra de alma de Mefisto en la Fragua del Infierno.\",\n";
-                ss << u8"    \"frFR\": \"Détruisez la Pierre d’âme de Méphisto dans la Forge des Enfers.\",\n";
-                ss << u8"    \"itIT\": \"Distruggi la Pietra dell'Anima di Mefisto nella Fornace Infernale.\",\n";
-                ss << u8"    \"koKR\": \"지옥의 대장간에서 메피스토의 영혼석을 파괴하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zniszcz Kamień Duszy Mefista w Piekielnej Kuźni.\",\n";
-                ss << u8"    \"esMX\": \"Destruye la Piedra Esencial de Mefisto en la Forja Infernal.\",\n";
-                ss << u8"    \"jaJP\": \"〈地獄の炉〉でメフィストのソウルストーンを破壊する。\",\n";
-                ss << u8"    \"ptBR\": \"Destrua a Pedra das Almas de Mefisto na Forja Infernal.\",\n";
-                ss << u8"    \"ruRU\": \"Уничтожьте камень души Мефисто в Адской кузне.\",\n";
-                ss << u8"    \"zhCN\": \"在地狱熔炉处摧毁墨菲斯托的灵魂石。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1002,\n";
-                ss << u8"    \"Key\": \"qstsa4q33\",\n";
-                ss << u8"    \"enUS\": \"Use the Hellforge Hammer on the Forge.\",\n";
-                ss << u8"    \"zhTW\": \"使用地獄熔爐之鎚敲擊靈魂石。\",\n";
-                ss << u8"    \"deDE\": \"Benutzt den Hammer an der Höllenschmiede.\",\n";
-                ss << u8"    \"esES\": \"Utiliza el martillo de la Fragua del Infierno en la fragua.\",\n";
-                ss << u8"    \"frFR\": \"Utilisez le Marteau de la forge des Enfers.\",\n";
-                ss << u8"    \"itIT\": \"Usa il Martello sulla Fornace Infernale.\",\n";
-                ss << u8"    \"koKR\": \"대장간에서 지옥의 대장간 망치를 사용하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Użyj Młota z Piekielnej Kuźni na kowadle.\",\n";
-                ss << u8"    \"esMX\": \"Usa el Martillo de la Forja Infernal en la Forja.\",\n";
-                ss << u8"    \"jaJP\": \"〈地獄の炉〉で〈業火で鍛えられし鎚〉を使う。\",\n";
-                ss << u8"    \"ptBR\": \"Use o Martelo da Forja Infernal na Forja.\",\n";
-                ss << u8"    \"ruRU\": \"Ударьте молотом Адской кузни по горну.\",\n";
-                ss << u8"    \"zhCN\": \"在熔炉上使用地狱熔炉之锤。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1003,\n";
-                ss << u8"    \"Key\": \"qstsa4q34\",\n";
-                ss << u8"    \"enUS\": \"Consult with Cain.\",\n";
-                ss << u8"    \"zhTW\": \"找凱恩商量。\",\n";
-                ss << u8"    \"deDE\": \"Beratet Euch mit Cain.\",\n";
-                ss << u8"    \"esES\": \"Consulta con Caín.\",\n";
-                ss << u8"    \"frFR\": \"Consultez Cain.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Cain.\",\n";
-                ss << u8"    \"koKR\": \"케인에게 조언을 구하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poradź się Caina.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Cain.\",\n";
-                ss << u8"    \"jaJP\": \"ケインに助言を求める。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Cain.\",\n";
-                ss << u8"    \"ruRU\": \"Посоветуйтесь с Декардом Каином.\",\n";
-                ss << u8"    \"zhCN\": \"咨询凯恩。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1004,\n";
-                ss << u8"    \"Key\": \"qstsa4q21\",\n";
-                ss << u8"    \"enUS\": \"Find Diablo in his Sanctuary.\",\n";
-                ss << u8"    \"zhTW\": \"在混沌魔殿中找出迪亞布羅。\",\n";
-                ss << u8"    \"deDE\": \"Findet Diablo in seinem Heiligtum.\",\n";
-                ss << u8"    \"esES\": \"Encuentra a Diablo en su santuario.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez Diablo dans son sanctuaire.\",\n";
-                ss << u8"    \"itIT\": \"Trova Diablo nel suo Santuario.\",\n";
-                ss << u8"    \"koKR\": \"성역에서 디아블로를 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Odnajdź Diablo w jego Sanktuarium.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra a Diablo en su Santuario.\",\n";
-                ss << u8"    \"jaJP\": \"〈混沌の聖域〉でディアブロを見つける。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre Diablo em seu Santuário.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите Диабло в его святилище.\",\n";
-                ss << u8"    \"zhCN\": \"在迪亚波罗的避难所中找到他。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1005,\n";
-                ss << u8"    \"Key\": \"qstsa4q22\",\n";
-                ss << u8"    \"enUS\": \"Kill Diablo.\",\n";
-                ss << u8"    \"zhTW\": \"殺死迪亞布羅。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Diablo.\",\n";
-                ss << u8"    \"esES\": \"Mata a Diablo.\",\n";
-                ss << u8"    \"frFR\": \"Tuez Diablo.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi Diablo.\",\n";
-                ss << u8"    \"koKR\": \"디아블로를 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Diablo.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Diablo.\",\n";
-                ss << u8"    \"jaJP\": \"ディアブロを倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Diablo.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Диабло.\",\n";
-                ss << u8"    \"zhCN\": \"消灭迪亚波罗。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1006,\n";
-                ss << u8"    \"Key\": \"qstsa4q23\",\n";
-                ss << u8"    \"enUS\": \"Break the remaining %d seals.\",\n";
-                ss << u8"    \"zhTW\": \"打破剩下的%d個封印。\",\n";
-                ss << u8"    \"deDE\": \"Brecht die verbleibenden %d Siegel.\",\n";
-                ss << u8"    \"esES\": \"Rompe los %d sellos restantes.\",\n";
-                ss << u8"    \"frFR\": \"Brisez les %d sceaux restants.\",\n";
-                ss << u8"    \"itIT\": \"Spezza i %d sigilli rimasti.\",\n";
-                ss << u8"    \"koKR\": \"남은 봉인 %d개를 파괴하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Złam pieczęcie. Pozostało: %d\",\n";
-                ss << u8"    \"esMX\": \"Rompe los %d sellos restantes.\",\n";
-                ss << u8"    \"jaJP\": \"残り%dつの封印を解く。\",\n";
-                ss << u8"    \"ptBR\": \"Rompa os %d selos restantes.\",\n";
-                ss << u8"    \"ruRU\": \"Осталось разбить печатей: %d.\",\n";
-                ss << u8"    \"zhCN\": \"打破剩余的%d个封印。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 1007,\n";
-                ss << u8"    \"Key\": \"qstsa4q24\",\n";
-                ss << u8"    \"enUS\": \"Break the final seal.\",\n";
-                ss << u8"    \"zhTW\": \"打破最後一個封印。\",\n";
-                ss << u8"    \"deDE\": \"Brecht das letzte Siegel.\",\n";
-                ss << u8"    \"esES\": \"Rompe el sello final.\",\n";
-                ss << u8"    \"frFR\": \"Brisez le dernier sceau.\",\n";
-                ss << u8"    \"itIT\": \"Spezza l'ultimo sigillo.\",\n";
-                ss << u8"    \"koKR\": \"마지막 봉인을 파괴하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Przełam ostatnią pieczęć.\",\n";
-                ss << u8"    \"esMX\": \"Rompe el último sello.\",\n";
-                ss << u8"    \"jaJP\": \"最後の封印を解く。\",\n";
-                ss << u8"    \"ptBR\": \"Rompa o selo final.\",\n";
-                ss << u8"    \"ruRU\": \"Разбейте последнюю печать.\",\n";
-                ss << u8"    \"zhCN\": \"打破最后一个封印。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3711,\n";
-                ss << u8"    \"Key\": \"qstsa1qt\",\n";
-                ss << u8"    \"enUS\": \"The Townspeople\",\n";
-                ss << u8"    \"zhTW\": \"城鎮人民\",\n";
-                ss << u8"    \"deDE\": \"Die Dorfbewohner\",\n";
-                ss << u8"    \"esES\": \"La gente de la ciudad\",\n";
-                ss << u8"    \"frFR\": \"Les habitants de la ville\",\n";
-                ss << u8"    \"itIT\": \"I cittadini\",\n";
-                ss << u8"    \"koKR\": \"마을 사람들\",\n";
-                ss << u8"    \"plPL\": \"Mieszkańcy\",\n";
-                ss << u8"    \"esMX\": \"Los habitantes del poblado\",\n";
-                ss << u8"    \"jaJP\": \"町の住民\",\n";
-                ss << u8"    \"ptBR\": \"Os Moradores da Cidade\",\n";
-                ss << u8"    \"ruRU\": \"Местные жители\",\n";
-                ss << u8"    \"zhCN\": \"镇民\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3712,\n";
-                ss << u8"    \"Key\": \"qstsa1qt0\",\n";
-                ss << u8"    \"enUS\": \"introduction\",\n";
-                ss << u8"    \"zhTW\": \"介紹\",\n";
-                ss << u8"    \"deDE\": \"Einführung\",\n";
-                ss << u8"    \"esES\": \"Introducción\",\n";
-                ss << u8"    \"frFR\": \"Introduction\",\n";
-                ss << u8"    \"itIT\": \"Introduzione\",\n";
-                ss << u8"    \"koKR\": \"소개\",\n";
-                ss << u8"    \"plPL\": \"wstęp\",\n";
-                ss << u8"    \"esMX\": \"Presentación\",\n";
-                ss << u8"    \"jaJP\": \"イントロ\",\n";
-                ss << u8"    \"ptBR\": \"introdução\",\n";
-                ss << u8"    \"ruRU\": \"Введение\",\n";
-                ss << u8"    \"zhCN\": \"介绍\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3713,\n";
-                ss << u8"    \"Key\": \"qstsa1q0\",\n";
-                ss << u8"    \"enUS\": \"Act 1 Prologue\",\n";
-                ss << u8"    \"zhTW\": \"第一章序幕\",\n";
-                ss << u8"    \"deDE\": \"Akt 1 - Prolog\",\n";
-                ss << u8"    \"esES\": \"Acto 1 Prólogo\",\n";
-                ss << u8"    \"frFR\": \"Acte I - Prologue\",\n";
-                ss << u8"    \"itIT\": \"Atto 1, prologo\",\n";
-                ss << u8"    \"koKR\": \"1막 프롤로그\",\n";
-                ss << u8"    \"plPL\": \"Prolog Aktu I\",\n";
-                ss << u8"    \"esMX\": \"Acto 1 - Prólogo\",\n";
-                ss << u8"    \"jaJP\": \"第1章 序幕\",\n";
-                ss << u8"    \"ptBR\": \"Prólogo do Ato 1\",\n";
-                ss << u8"    \"ruRU\": \"Акт 1 – пролог\",\n";
-                ss << u8"    \"zhCN\": \"第一幕序章\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3714,\n";
-                ss << u8"    \"Key\": \"qstsa1q1\",\n";
-                ss << u8"    \"enUS\": \"Den of Evil\",\n";
-                ss << u8"    \"zhTW\": \"邪惡洞窟\",\n";
-                ss << u8"    \"deDE\": \"Höhle des Bösen\",\n";
-                ss << u8"    \"esES\": \"El Cubil del Mal\",\n";
-                ss << u8"    \"frFR\": \"Le repaire du Mal\",\n";
-                ss << u8"    \"itIT\": \"L'Antro del Male\",\n";
-                ss << u8"    \"koKR\": \"악의 소굴\",\n";
-                ss << u8"    \"plPL\": \"Siedlisko Zła\",\n";
-                ss << u8"    \"esMX\": \"Guarida del Mal\",\n";
-                ss << u8"    \"jaJP\": \"邪悪の巣窟\",\n";
-                ss << u8"    \"ptBR\": \"Covil do Mal\",\n";
-                ss << u8"    \"ruRU\": \"Логово зла\",\n";
-                ss << u8"    \"zhCN\": \"邪恶洞穴\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3715,\n";
-                ss << u8"    \"Key\": \"qstsa1q2\",\n";
-                ss << u8"    \"enUS\": \"Sisters' Burial Grounds\",\n";
-                ss << u8"    \"zhTW\": \"褻瀆的墓地\",\n";
-                ss << u8"    \"deDE\": \"Der Friedhof der Schwestern\",\n";
-                ss << u8"    \"esES\": \"El cementerio de las hermanas\",\n";
-                ss << u8"    \"frFR\": \"Le cimetière des Sœurs\",\n";
-                ss << u8"    \"itIT\": \"Il Cimitero delle Sorelle\",\n";
-                ss << u8"    \"koKR\": \"자매단의 매장지\",\n";
-                ss << u8"    \"plPL\": \"Cmentarz sióstr\",\n";
-                ss << u8"    \"esMX\": \"Cementerio de las Hermanas\",\n";
-                ss << u8"    \"jaJP\": \"姉妹の墓地\",\n";
-                ss << u8"    \"ptBR\": \"Cemitério das Irmãs\",\n";
-                ss << u8"    \"ruRU\": \"Сестринский погост\",\n";
-                ss << u8"    \"zhCN\": \"修女的埋骨地\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3716,\n";
-                ss << u8"    \"Key\": \"qstsa1q3\",\n";
-                ss << u8"    \"enUS\": \"Tools of the Trade\",\n";
-                ss << u8"    \"zhTW\": \"工欲善其事\",\n";
-                ss << u8"    \"deDE\": \"Das richtige Werkzeug\",\n";
-                ss << u8"    \"esES\": \"Herramientas de trabajo\",\n";
-                ss << u8"    \"frFR\": \"Outils du métier\",\n";
-                ss << u8"    \"itIT\": \"Ferri del mestiere\",\n";
-                ss << u8"    \"koKR\": \"거래의 도구\",\n";
-                ss << u8"    \"plPL\": \"Narzędzia pracy\",\n";
-                ss << u8"    \"esMX\": \"Herramientas del Comercio\",\n";
-                ss << u8"    \"jaJP\": \"商売道具\",\n";
-                ss << u8"    \"ptBR\": \"Ferramentas do Ofício\",\n";
-                ss << u8"    \"ruRU\": \"Инструменты мастера\",\n";
-                ss << u8"    \"zhCN\": \"交易的工具\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3717,\n";
-                ss << u8"    \"Key\": \"qstsa1q4\",\n";
-                ss << u8"    \"enUS\": \"The Search for Cain\",\n";
-                ss << u8"    \"zhTW\": \"尋找凱恩\",\n";
-                ss << u8"    \"deDE\": \"Die Suche nach Cain\",\n";
-                ss << u8"    \"esES\": \"La búsqueda de Caín\",\n";
-                ss << u8"    \"frFR\": \"À la recherche de Cain\",\n";
-                ss << u8"    \"itIT\": \"Alla ricerca di Cain\",\n";
-                ss << u8"    \"koKR\": \"케인을 찾아서\",\n";
-                ss << u8"    \"plPL\": \"W poszukiwaniu Caina\",\n";
-                ss << u8"    \"esMX\": \"La Búsqueda de Cain\",\n";
-                ss << u8"    \"jaJP\": \"ケインの捜索\",\n";
-                ss << u8"    \"ptBR\": \"A Busca por Cain\",\n";
-                ss << u8"    \"ruRU\": \"Поиски Декарда Каина\",\n";
-                ss << u8"    \"zhCN\": \"搜寻凯恩\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3718,\n";
-                ss << u8"    \"Key\": \"qstsa1q5\",\n";
-                ss << u8"    \"enUS\": \"The Forgotten Tower\",\n";
-                ss << u8"    \"zhTW\": \"遺忘之塔\",\n";
-                ss << u8"    \"deDE\": \"Der Vergessene Turm\",\n";
-                ss << u8"    \"esES\": \"La Torre Olvidada\",\n";
-                ss << u8"    \"frFR\": \"La Tour oubliée\",\n";
-                ss << u8"    \"itIT\": \"La Torre Dimenticata\",\n";
-                ss << u8"    \"koKR\": \"잊힌 탑\",\n";
-                ss << u8"    \"plPL\": \"Zapomniana wieża\",\n";
-                ss << u8"    \"esMX\": \"La Torre Olvidada\",\n";
-                ss << u8"    \"jaJP\": \"忘れ去られし塔\",\n";
-                ss << u8"    \"ptBR\": \"A Torre Esquecida\",\n";
-                ss << u8"    \"ruRU\": \"Заброшенная башня\",\n";
-                ss << u8"    \"zhCN\": \"遗忘之塔\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3719,\n";
-                ss << u8"    \"Key\": \"qstsa1q6\",\n";
-                ss << u8"    \"enUS\": \"Sisters to the Slaughter\",\n";
-                ss << u8"    \"zhTW\": \"為姐妹們復仇\",\n";
-                ss << u8"    \"deDE\": \"Schwestern zur Schlachtbank\",\n";
-                ss << u8"    \"esES\": \"Hermanas de la tortura\",\n";
-                ss << u8"    \"frFR\": \"Le carnage des Sœurs \",\n";
-                ss << u8"    \"itIT\": \"Sorelle al massacro\",\n";
-                ss << u8"    \"koKR\": \"자매단의 학살자\",\n";
-                ss << u8"    \"plPL\": \"Siostry rzezi\",\n";
-                ss << u8"    \"esMX\": \"Hermanas de la Masacre\",\n";
-                ss << u8"    \"jaJP\": \"修道院の悪魔\",\n";
-                ss << u8"    \"ptBR\": \"Irmãs do Massacre\",\n";
-                ss << u8"    \"ruRU\": \"Сестры Бойни\",\n";
-                ss << u8"    \"zhCN\": \"为了姐妹们\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3735,\n";
-                ss << u8"    \"Key\": \"qstsa1q11\",\n";
-                ss << u8"    \"enUS\": \"Look for the Den in the wilderness outside the Rogues' Camp.\",\n";
-                ss << u8"    \"zhTW\": \"在俠盜營地外面的荒野中，找到洞穴。\",\n";
-                ss << u8"    \"deDE\": \"Findet die Höhle in der Wildnis außerhalb des Lagers der Jägerinnen.\",\n";
-                ss << u8"    \"esES\": \"Busca el cubil en el yermo de las afueras del Campamento de las Arpías.\",\n";
-                ss << u8"    \"frFR\": \"Recherchez le repaire dans le désert en dehors du Camp des Rogues.\",\n";
-                ss << u8"    \"itIT\": \"Cerca l'Antro nei territori circostanti il Campo delle Scolte.\",\n";
-                ss << u8"    \"koKR\": \"자매단 야영지 밖의 황야에서 소굴을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Odszukaj Siedlisko Zła w dziczy poza Obozowiskiem Łotrzyc.\",\n";
-                ss << u8"    \"esMX\": \"Busca la Guarida en la espesura fuera del Campamento de Renegadas.\",\n";
-                ss << u8"    \"jaJP\": \"〈ローグの野営地〉の外で〈邪悪の巣窟〉の入口を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pelo Covil na floresta fora do Acampamento Renegado.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите логово в пустошах вокруг лагеря разбойниц.\",\n";
-                ss << u8"    \"zhCN\": \"在流亡者营地外的荒野中寻找洞穴。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3736,\n";
-                ss << u8"    \"Key\": \"qstsa1q12\",\n";
-                ss << u8"    \"enUS\": \"Kill all the monsters in the Den.\",\n";
-                ss << u8"    \"zhTW\": \"殺死所有盤踞在洞穴裡面的怪物。\",\n";
-                ss << u8"    \"deDE\": \"Tötet alle Monster in der Höhle.\",\n";
-                ss << u8"    \"esES\": \"Mata a todos los monstruos del cubil.\",\n";
-                ss << u8"    \"frFR\": \"Tuez tous les monstres du repaire.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi tutti i mostri dell'Antro.\",\n";
-                ss << u8"    \"koKR\": \"소굴에 있는 괴물을 모두 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij wszystkie potwory w Siedlisku.\",\n";
-                ss << u8"    \"esMX\": \"Mata a todos los monstruos en la Guarida.\",\n";
-                ss << u8"    \"jaJP\": \"〈邪悪の巣窟〉にいる魔物をすべて倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate todos os monstros no Covil.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте всех монстров в логове.\",\n";
-                ss << u8"    \"zhCN\": \"消灭洞穴里所有的怪物。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3737,\n";
-                ss << u8"    \"Key\": \"qstsa1q13\",\n";
-                ss << u8"    \"enUS\": \"\",\n";
-                ss << u8"    \"zhTW\": \"\",\n";
-                ss << u8"    \"deDE\": \"\",\n";
-                ss << u8"    \"esES\": \"\",\n";
-                ss << u8"    \"frFR\": \"\",\n";
-                ss << u8"    \"itIT\": \"\",\n";
-                ss << u8"    \"koKR\": \"\",\n";
-                ss << u8"    \"plPL\": \"\",\n";
-                ss << u8"    \"esMX\": \"\",\n";
-                ss << u8"    \"jaJP\": \"\",\n";
-                ss << u8"    \"ptBR\": \"\",\n";
-                ss << u8"    \"ruRU\": \"\",\n";
-                ss << u8"    \"zhCN\": \"\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3738,\n";
-                ss << u8"    \"Key\": \"qstsa1q14\",\n";
-                ss << u8"    \"enUS\": \"Monsters remaining: %d\",\n";
-                ss << u8"    \"zhTW\": \"剩餘怪物：%d\",\n";
-                ss << u8"    \"deDE\": \"Verbleibende Monster: %d\",\n";
-                ss << u8"    \"esES\": \"Monstruos restantes: %d\",\n";
-                ss << u8"    \"frFR\": \"Monstres restants : %d\",\n";
-                ss << u8"    \"itIT\": \"Mostri rimasti: %d\",\n";
-                ss << u8"    \"koKR\": \"남은 괴물: %d\",\n";
-                ss << u8"    \"plPL\": \"Pozostałe potwory: %d\",\n";
-                ss << u8"    \"esMX\": \"Monstruos restantes: %d\",\n";
-                ss << u8"    \"jaJP\": \"残りの魔物: %d体\",\n";
-                ss << u8"    \"ptBR\": \"Monstros restantes: %d\",\n";
-                ss << u8"    \"ruRU\": \"Осталось монстров: %d\",\n";
-                ss << u8"    \"zhCN\": \"剩余的怪物: %d\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3739,\n";
-                ss << u8"    \"Key\": \"qstsa1q140\",\n";
-                ss << u8"    \"enUS\": \"One monster left.\",\n";
-                ss << u8"    \"zhTW\": \"剩下一個怪物。\",\n";
-                ss << u8"    \"deDE\": \"Noch ein Monster übrig.\",\n";
-                ss << u8"    \"esES\": \"Falta un monstruo.\",\n";
-                ss << u8"    \"frFR\": \"Un montre restant.\",\n";
-                ss << u8"    \"itIT\": \"Manca un mostro.\",\n";
-                ss << u8"    \"koKR\": \"괴물이 1마리 남았습니다.\",\n";
-                ss << u8"    \"plPL\": \"Został jeden potwór.\",\n";
-                ss << u8"    \"esMX\": \"Un monstruo restante.\",\n";
-                ss << u8"    \"jaJP\": \"魔物は残り1体。\",\n";
-                ss << u8"    \"ptBR\": \"Resta um monstro.\",\n";
-                ss << u8"    \"ruRU\": \"Остался один монстр.\",\n";
-                ss << u8"    \"zhCN\": \"仅剩一个怪物。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3740,\n";
-                ss << u8"    \"Key\": \"qstsa1q15\",\n";
-                ss << u8"    \"enUS\": \"Return to Akara for a reward.\",\n";
-                ss << u8"    \"zhTW\": \"回去找阿卡拉領取獎勵。\",\n";
-                ss << u8"    \"deDE\": \"Kehrt zu Akara zurück, um Eure Belohnung zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Vuelve con Akara para recibir una recompensa.\",\n";
-                ss << u8"    \"frFR\": \"Retournez auprès d’Akara pour recevoir votre récompense.\",\n";
-                ss << u8"    \"itIT\": \"Torna da Akara per la ricompensa.\",\n";
-                ss << u8"    \"koKR\": \"아카라에게 돌아가 보상을 받으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Wróć do Akary po nagrodę.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Akara para recibir tu recompensa.\",\n";
-                ss << u8"    \"jaJP\": \"アカラと会って報酬を受け取る。\",\n";
-                ss << u8"    \"ptBR\": \"Volte até Akara para receber uma recompensa.\",\n";
-                ss << u8"    \"ruRU\": \"Вернитесь к Акаре за наградой.\",\n";
-                ss << u8"    \"zhCN\": \"回去找阿卡拉领取奖励。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3741,\n";
-                ss << u8"    \"Key\": \"qstsa1q21\",\n";
-                ss << u8"    \"enUS\": \"Look for Blood Raven in the Burial Grounds next to the Cold Plains.\",\n";
-                ss << u8"    \"zhTW\": \"到鄰近冰冷之原的埋骨之地，尋找血鴉的蹤跡。\",\n";
-                ss << u8"    \"deDE\": \"Findet Blutrabe auf dem Friedhof in der Nähe der Kalten Ebene.\",\n";
-                ss << u8"    \"esES\": \"Busca a Cuervo Sangriento en el Cementerio cercano a las Llanuras Frías.\",\n";
-                ss << u8"    \"frFR\": \"Cherchez Blood Raven dans le cimetière à côté des Plaines gelées.\",\n";
-                ss << u8"    \"itIT\": \"Cerca Corvo Vermiglio nel Cimitero nei pressi delle Pianure Gelate.\",\n";
-                ss << u8"    \"koKR\": \"차가운 평야 옆에 있는 매장지에서 핏빛 큰까마귀를 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Krwawej Orlicy na Cmentarzu w pobliżu Zimnej Równiny.\",\n";
-                ss << u8"    \"esMX\": \"Busca a Cuervo Sangriento en el Cementerio junto a las Llanuras Heladas.\",\n";
-                ss << u8"    \"jaJP\": \"〈荒涼の平原〉の近くにある〈墓地〉でブラッド・レイヴンを探す。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pela Rapina Sangrenta no Cemitério ao lado das Planície Gélida.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите разбойницу Кровавый Ворон на Погосте рядом со Стылыми равнинами.\",\n";
-                ss << u8"    \"zhCN\": \"在紧邻冰冷之原的埋骨之地里找到血鸦。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3742,\n";
-                ss << u8"    \"Key\": \"qstsa1q22\",\n";
-                ss << u8"    \"enUS\": \"Kill Blood Raven.\",\n";
-                ss << u8"    \"zhTW\": \"殺死血鴉。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Blutrabe.\",\n";
-                ss << u8"    \"esES\": \"Mata a Cuervo Sangriento.\",\n";
-                ss << u8"    \"frFR\": \"Tuez Blood Raven.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi Corvo Vermiglio.\",\n";
-                ss << u8"    \"koKR\": \"핏빛 큰까마귀를 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Krwawą Orlicę.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Cuervo Sangriento.\",\n";
-                ss << u8"    \"jaJP\": \"ブラッド・レイヴンを倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate a Rapina Sangrenta.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте разбойницу Кровавый Ворон.\",\n";
-                ss << u8"    \"zhCN\": \"消灭血鸦。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3743,\n";
-                ss << u8"    \"Key\": \"qstsa1q23\",\n";
-                ss << u8"    \"enUS\": \"Return to Kashya for a reward.\",\n";
-                ss << u8"    \"zhTW\": \"回去找卡夏領取獎勵。\",\n";
-                ss << u8"    \"deDE\": \"Kehrt zu Kaschya zurück, um Eure Belohnung zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Vuelve con Kashya para recibir una recompensa.\",\n";
-                ss << u8"    \"frFR\": \"Retournez voir Kashya pour obtenir votre récompense.\",\n";
-                ss << u8"    \"itIT\": \"Torna da Kashya per la ricompensa.\",\n";
-                ss << u8"    \"koKR\": \"카샤에게 돌아가 보상을 받으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Wróć do Kashyi po nagrodę.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Kashya para recibir tu recompensa.\",\n";
-                ss << u8"    \"jaJP\": \"カーシャと会って報酬を受け取る。\",\n";
-                ss << u8"    \"ptBR\": \"Volte até Kashya para receber uma recompensa.\",\n";
-                ss << u8"    \"ruRU\": \"Вернитесь к Кашье за наградой.\",\n";
-                ss << u8"    \"zhCN\": \"回去找卡夏领取奖励。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3744,\n";
-                ss << u8"    \"Key\": \"qstsa1q41\",\n";
-                ss << u8"    \"enUS\": \"Go through the Underground Passage to the Dark Wood, search for the Tree of Inifuss, and recover the Scroll.\",\n";
-                ss << u8"    \"zhTW\": \"穿過地底通道來到黑暗森林，找到艾尼弗斯之樹，並取回卷軸。\",\n";
-                ss << u8"    \"deDE\": \"Geht durch den Unterirdischen Durchgang zum Dunkelwald, sucht den Inifussbaum und holt die Schriftrolle.\",\n";
-                ss << u8"    \"esES\": \"Toma el Pasadizo Subterráneo hacia el Bosque Oscuro, busca el Árbol de Inifuss y recupera el pergamino.\",\n";
-                ss << u8"    \"frFR\": \"Empruntez le passage souterrain vers le Bois obscur, trouvez l’Arbre d’Inifuss et prenez le Parchemin.\",\n";
-                ss << u8"    \"itIT\": \"Segui il Passaggio Sotterraneo verso la Foresta Oscura, cerca l'Albero di Inifuss e recupera la Pergamena.\",\n";
-                ss << u8"    \"koKR\": \"지하 통로를 통과하여 어둠숲으로 가서 이니푸스의 나무를 찾아 두루마리를 회수하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Przejdź Podziemnym Tunelem do Mrocznej Kniei, odnajdź drzewo Inifussa i zdobądź zwój.\",\n";
-                ss << u8"    \"esMX\": \"Atraviesa el Pasaje Subterráneo hacia el Bosque Oscuro, busca el Árbol de Inifuss y recupera el Pergamino.\",\n";
-                ss << u8"    \"jaJP\": \"〈地下道〉を通り抜けて〈常闇の森〉に行き、〈イニファスの木〉を探して〈イニファスの巻物〉を回収する。\",\n";
-                ss << u8"    \"ptBR\": \"Atravesse a Passagem Subterrânea até a Floresta Sombria, procure pela Árvore de Inifuss e recupere o Pergaminho.\",\n";
-                ss << u8"    \"ruRU\": \"Пройдите через подземный проход к Темнолесью, найдите древо Инифусс и добудьте свиток.\",\n";
-                ss << u8"    \"zhCN\": \"穿过地下通道前往黑暗森林，找到艾尼弗斯之树，拿到卷轴。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3745,\n";
-                ss << u8"    \"Key\": \"qstsa1q42\",\n";
-                ss << u8"    \"enUS\": \"Take the Scroll of Inifuss to Akara.\",\n";
-                ss << u8"    \"zhTW\": \"將艾尼弗斯卷軸帶回去給阿卡拉。\",\n";
-                ss << u8"    \"deDE\": \"Bringt Akara die Inifussschriftrolle.\",\n";
-                ss << u8"    \"esES\": \"Llévale el pergamino de Inifuss a Akara.\",\n";
-                ss << u8"    \"frFR\": \"Rapportez le Parchemin d’Inifuss à Akara.\",\n";
-                ss << u8"    \"itIT\": \"Porta la Pergamena di Inifuss ad Akara.\",\n";
-                ss << u8"    \"koKR\": \"이니푸스의 두루마리를 아카라에게 가져가십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zanieś Zwój Inifussa do Akary.\",\n";
-                ss << u8"    \"esMX\": \"Llévale el Pergamino de Inifuss a Akara.\",\n";
-                ss << u8"    \"jaJP\": \"〈イニファスの巻物〉をアカラに渡す。\",\n";
-                ss << u8"    \"ptBR\": \"Leve o Pergaminho de Inifuss até Akara.\",\n";
-                ss << u8"    \"ruRU\": \"Отнесите свиток Инифусс Акаре.\",\n";
-                ss << u8"    \"zhCN\": \"把艾尼弗斯卷轴交给阿卡拉。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3746,\n";
-                ss << u8"    \"Key\": \"qstsa1q43\",\n";
-                ss << u8"    \"enUS\": \"Go to the Cairn Stones in the Stony Field. Touch the Stones in the order found on the Scroll of Inifuss. Enter the portal to Tristram, but beware the danger that lies ahead.\",\n";
-                ss << u8"    \"zhTW\": \"前往亂石曠野中的石陣。按照寫在艾尼弗斯卷軸上面的順序觸碰石柱，然後進入傳送門前往崔斯特姆，但務必要小心前方的危險。\",\n";
-                ss << u8"    \"deDE\": \"Geht zu den Monolithen im Feld der Steine. Berührt die Steine in der Reihenfolge, wie sie in der Inifussschriftrolle angegeben ist. Tretet durch das Portal nach Tristram.\",\n";
-                ss << u8"    \"esES\": \"Ve a las piedras de Cairn en el Campo Pedregoso. Toca las piedras en el orden que te indica el pergamino de Inifuss. Cruza el portal de Tristán, pero ten cuidado con el peligro que te aguarda.\",\n";
-                ss << u8"    \"frFR\": \"Allez vers les Pierres de Cairn dans le Champ de pierres. Touchez-les dans l’ordre indiqué par le Parchemin d’Inifuss. Franchissez le portail vers Tristram mais méfiez-vous des dangers qui vous guettent.\",\n";
-                ss << u8"    \"itIT\": \"Trova i Monoliti nel Campo di Pietra. Toccali nell'ordine riportato sulla Pergamena di Inifuss. Entra nel portale per Tristram. Fai attenzione ai grandi pericoli che ti attendono.\",\n";
-                ss << u8"    \"koKR\": \"바위 벌판에 있는 돌무덤으로 가십시오. 이니푸스의 두루마리에 명시된 순서대로 돌을 만지십시오. 트리스트럼으로 통하는 차원문으로 들어가십시오. 끔찍한 위험이 기다리고 있으니 조심해야 합니다.\",\n";
-                ss << u8"    \"plPL\": \"Udaj się do Kręgu Kamieni na Kamiennych Polach. Dotknij ich w kolejności podanej na Zwoju Inifussa. Przejdź przez portal prowadzący do Tristram, ale strzeż się czyhającego tam niebezpieczeństwa.\",\n";
-                ss << u8"    \"esMX\": \"Dirígete a los Menhires de piedra en el Campo Rocoso. Toca los Menhires en el orden indicado en el Pergamino de Inifuss. Entra en el portal hacia Tristram, pero ten cuidado con el peligro que acecha adelante.\",\n";
-                ss << u8"    \"jaJP\": \"〈石の原野〉にあるケルン・ストーンに行き、〈イニファスの巻物〉に書かれた順序でケルン・ストーンに触れる。待ち受ける危険に警戒しつつ、トリストラムへのポータルに入る。\",\n";
-                ss << u8"    \"ptBR\": \"Vá até as Pedras Monumentais no Campo Rochoso. Toque nas Pedras na ordem indicada no Pergaminho de Inifuss. Entre no portal para Tristram, mas tome cuidado com os perigos do caminho.\",\n";
-                ss << u8"    \"ruRU\": \"Идите к кругу камней в Каменистое поле. Дотроньтесь до камней в порядке, описанном в свитке Инифусс. Перенеситесь в Тристрам через портал, но берегитесь грядущей опасности.\",\n";
-                ss << u8"    \"zhCN\": \"前往石块旷野里的石阵。按照艾尼弗斯卷轴上的顺序触摸这些石头。进入前往崔斯特姆的传送门，但要小心前方的危险。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3747,\n";
-                ss << u8"    \"Key\": \"qstsa1q44\",\n";
-                ss << u8"    \"enUS\": \"Find and rescue Deckard Cain.\",\n";
-                ss << u8"    \"zhTW\": \"找到並救出迪卡‧凱恩。\",\n";
-                ss << u8"    \"deDE\": \"Findet und rettet Deckard Cain.\",\n";
-                ss << u8"    \"esES\": \"Encuentra y rescata a Deckard Caín.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez et secourez Deckard Cain.\",\n";
-                ss << u8"    \"itIT\": \"Trova e soccorri Deckard Cain.\",\n";
-                ss << u8"    \"koKR\": \"데커드 케인을 찾아 구출하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź i uratuj Deckarda Caina.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra y rescata a Deckard Cain.\",\n";
-                ss << u8"    \"jaJP\": \"デッカード・ケインを探して救出する。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre e resgate Deckard Cain.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите и спасите Декарда Каина.\",\n";
-                ss << u8"    \"zhCN\": \"找到并营救迪卡德·凯恩。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3748,\n";
-                ss << u8"    \"Key\": \"qstsa1q45\",\n";
-                ss << u8"    \"enUS\": \"Cain has been rescued and is now at the Rogue Encampment.\",\n";
-                ss << u8"    \"zhTW\": \"凱恩獲救了，現在已經返回俠盜營地。\",\n";
-                ss << u8"    \"deDE\": \"Cain wurde gerettet und befindet sich jetzt im Lager der Jägerinnen.\",\n";
-                ss << u8"    \"esES\": \"Caín ha sido rescatado y está ahora en el Campamento de las Arpías.\",\n";
-                ss << u8"    \"frFR\": \"Cain est sain et sauf dans le camp des Rogues.\",\n";
-                ss << u8"    \"itIT\": \"Cain è salvo e ora si trova nel Campo delle Scolte.\",\n";
-                ss << u8"    \"koKR\": \"케인은 구출되어 이제 자매단 야영지에 있습니다.\",\n";
-                ss << u8"    \"plPL\": \"Cain został uratowany i znajduje się teraz w Obozowisku Łotrzyc.\",\n";
-                ss << u8"    \"esMX\": \"Cain fue rescatado y ahora se encuentra en el Campamento de Renegadas.\",\n";
-                ss << u8"    \"jaJP\": \"救出されたケインは〈ローグの野営地〉にいる。\",\n";
-                ss << u8"    \"ptBR\": \"Cain foi resgatado e agora está no Acampamento Renegado.\",\n";
-                ss << u8"    \"ruRU\": \"Декард Каин спасен. Теперь он в лагере разбойниц.\",\n";
-                ss << u8"    \"zhCN\": \"凯恩获救了，他现在身处流亡者营地。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3749,\n";
-                ss << u8"    \"Key\": \"qstsa1q46\",\n";
-                ss << u8"    \"enUS\": \"Visit Cain and Akara in the Rogue Encampment.\",\n";
-                ss << u8"    \"zhTW\": \"回到俠盜營地，見見凱恩和阿卡拉。\",\n";
-                ss << u8"    \"deDE\": \"Besucht Cain und Akara im Lager der Jägerinnen.\",\n";
-                ss << u8"    \"esES\": \"Visita a Caín y Akara en el Campamento de las Arpías.\",\n";
-                ss << u8"    \"frFR\": \"Allez voir Cain et Akara au Camp des Rogues.\",\n";
-                ss << u8"    \"itIT\": \"Fai visita a Cain e Akara al Campo delle Scolte.\",\n";
-                ss << u8"    \"koKR\": \"자매단 야영지에 있는 케인과 아카라를 찾아가십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zobacz się z Cainem i Akarą w Obozowisku Łotrzyc.\",\n";
-                ss << u8"    \"esMX\": \"Visita a Cain y a Akara en el Campamento de Renegadas.\",\n";
-                ss << u8"    \"jaJP\": \"〈ローグの野営地〉でケインとアカラに会う。\",\n";
-                ss << u8"    \"ptBR\": \"Visite Cain e Akara no Acampamento Renegado.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Декардом Каином и Акарой в лагере разбойниц.\",\n";
-                ss << u8"    \"zhCN\": \"与流亡者营地里的凯恩和阿卡拉交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3750,\n";
-                ss << u8"    \"Key\": \"qstsa1q46b\",\n";
-                ss << u8"    \"enUS\": \"Talk to Akara for a reward.\",\n";
-                ss << u8"    \"zhTW\": \"與阿卡拉交談，領取獎勵。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Akara, um Eure Belohnung zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Habla con Akara para recibir una recompensa.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Akara pour obtenir une récompense.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Akara per la ricompensa.\",\n";
-                ss << u8"    \"koKR\": \"아카라와 대화하여 보상을 받으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Akarą odnośnie nagrody.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Akara para recibir tu recompensa.\",\n";
-                ss << u8"    \"jaJP\": \"アカラと話して報酬を受け取る。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Akara para receber uma recompensa.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Акарой, чтобы получить награду.\",\n";
-                ss << u8"    \"zhCN\": \"与阿卡拉交谈，领取奖励。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3751,\n";
-                ss << u8"    \"Key\": \"qstsa1q51\",\n";
-                ss << u8"    \"enUS\": \"Look for the Tower in the Black Marsh beyond the Dark Wood.\",\n";
-                ss << u8"    \"zhTW\": \"在穿過黑暗森林後的黑色荒地中，找到高塔。\",\n";
-                ss << u8"    \"deDE\": \"Findet den Turm im Schwarzmoor hinter dem Dunkelwald.\",\n";
-                ss << u8"    \"esES\": \"Busca la torre en el Pantano Negro más allá del Bosque Oscuro.\",\n";
-                ss << u8"    \"frFR\": \"Cherchez la Tour dans le Marais sombre derrière le Bois obscur.\",\n";
-                ss << u8"    \"itIT\": \"Cerca la Torre nella Palude Nera, oltre la Foresta Oscura.\",\n";
-                ss << u8"    \"koKR\": \"어둠숲 너머에 있는 검은 습지에서 탑을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj wieży na Czarnych Moczarach za Mroczną Knieją.\",\n";
-                ss << u8"    \"esMX\": \"Busca la Torre en la Marisma Oscura, más allá del Bosque Oscuro.\",\n";
-                ss << u8"    \"jaJP\": \"〈常闇の森〉の先にある〈黒の湿原〉で〈忘れ去られし塔〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pela Torre no Charco Tenebroso além da Floresta Sombria.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите башню в Черной топи за Темнолесьем.\",\n";
-                ss << u8"    \"zhCN\": \"找到在黑暗森林另一边的黑色沼泽中的高塔。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3752,\n";
-                ss << u8"    \"Key\": \"qstsa1q51a\",\n";
-                ss << u8"    \"enUS\": \"Explore the cellar dungeons beneath the Tower ruins.\",\n";
-                ss << u8"    \"zhTW\": \"探索高塔廢墟底下的地牢。\",\n";
-                ss << u8"    \"deDE\": \"Erforscht die Kellergewölbe unter den Ruinen des Turmes.\",\n";
-                ss << u8"    \"esES\": \"Explora las mazmorras del sótano bajo las ruinas de la torre.\",\n";
-                ss << u8"    \"frFR\": \"Explorez les donjons situés sous les ruines de la Tour.\",\n";
-                ss << u8"    \"itIT\": \"Esplora il Sotterraneo sotto le rovine della Torre.\",\n";
-                ss << u8"    \"koKR\": \"탑의 폐허 아래에 있는 지하 던전을 탐험하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zbadaj lochy pod ruinami wieży.\",\n";
-                ss << u8"    \"esMX\": \"Explora los calabozos del sótano debajo de las ruinas de la Torre.\",\n";
-                ss << u8"    \"jaJP\": \"〈忘れ去られし塔〉の地下を探索する。\",\n";
-                ss << u8"    \"ptBR\": \"Explore as masmorras do porão sob as ruínas da Torre.\",\n";
-                ss << u8"    \"ruRU\": \"Исследуйте подвалы под разрушенной башней.\",\n";
-                ss << u8"    \"zhCN\": \"探索高塔废墟下的地窖。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3753,\n";
-                ss << u8"    \"Key\": \"qstsa1q51b\",\n";
-                ss << u8"    \"enUS\": \"Explore the cellar dungeons beneath the Tower ruins.\",\n";
-                ss << u8"    \"zhTW\": \"探索高塔廢墟底下的地牢。\",\n";
-                ss << u8"    \"deDE\": \"Erforscht die Kellergewölbe unter den Ruinen des Turmes.\",\n";
-                ss << u8"    \"esES\": \"Explora las mazmorras del sótano bajo las ruinas de la torre.\",\n";
-                ss << u8"    \"frFR\": \"Explorez les donjons situés sous les ruines de la Tour.\",\n";
-                ss << u8"    \"itIT\": \"Esplora il Sotterraneo sotto le rovine della Torre.\",\n";
-                ss << u8"    \"koKR\": \"탑의 폐허 아래에 있는 지하 던전을 탐험하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zbadaj lochy pod ruinami wieży.\",\n";
-                ss << u8"    \"esMX\": \"Explora los calabozos del sótano debajo de las ruinas de la Torre.\",\n";
-                ss << u8"    \"jaJP\": \"〈忘れ去られし塔〉の地下を探索する。\",\n";
-                ss << u8"    \"ptBR\": \"Explore as masmorras do porão sob as ruínas da Torre.\",\n";
-                ss << u8"    \"ruRU\": \"Исследуйте подвалы под разрушенной башней.\",\n";
-                ss << u8"    \"zhCN\": \"探索高塔废墟下的地窖。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3754,\n";
-                ss << u8"    \"Key\": \"qstsa1q52\",\n";
-                ss << u8"    \"enUS\": \"Dispose of the evil Countess.\",\n";
-                ss << u8"    \"zhTW\": \"打倒邪惡女伯爵。\",\n";
-                ss << u8"    \"deDE\": \"Beseitigt die böse Gräfin.\",\n";
-                ss << u8"    \"esES\": \"Liquida a la malvada Condesa.\",\n";
-                ss << u8"    \"frFR\": \"Débarrassez-vous de la Comtesse démoniaque.\",\n";
-                ss << u8"    \"itIT\": \"Sistema la malvagia Contessa.\",\n";
-                ss << u8"    \"koKR\": \"사악한 백작을 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Pozbądź się nikczemnej Hrabiny.\",\n";
-                ss << u8"    \"esMX\": \"Elimina a la Condesa malvada.\",\n";
-                ss << u8"    \"jaJP\": \"邪悪なる伯爵夫人を倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Acabe com a Condessa maligna.\",\n";
-                ss << u8"    \"ruRU\": \"Уничтожьте злобную Графиню.\",\n";
-                ss << u8"    \"zhCN\": \"解决掉邪恶的女伯爵。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3755,\n";
-                ss << u8"    \"Key\": \"qstsa1q31\",\n";
-                ss << u8"    \"enUS\": \"Look for the Horadric Malus in the Monastery Barracks. Beware of the Smith that guards it.\",\n";
-                ss << u8"    \"zhTW\": \"到修道院兵營找出赫拉迪姆之鎚。務必小心看守的鐵匠。\",\n";
-                ss << u8"    \"deDE\": \"Findet den Horadrimmalus in der Kaserne des Klosters. Hütet Euch vor dem Schmied, der ihn bewacht.\",\n";
-                ss << u8"    \"esES\": \"Busca el malaise horádrico en los Barracones del monasterio. Ten cuidado con el Herrero que lo protege.\",\n";
-                ss << u8"    \"frFR\": \"Cherchez le Marteau d'Horadrim dans la Caserne du monastère. Faites attention au Forgeron qui le garde.\",\n";
-                ss << u8"    \"itIT\": \"Cerca il Malleus Horadrico nella Caserma del monastero. Fai attenzione al Fabbro che lo sorveglia.\",\n";
-                ss << u8"    \"koKR\": \"수도원 병영에서 호라드림 망치를 찾으십시오. 망치를 지키고 있는 대장장이를 조심해야 합니다.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Malleusa Horadrimów w Koszarach Klasztoru. Uważaj na strzegącego go Kowala.\",\n";
-                ss << u8"    \"esMX\": \"Busca el Martillo horádrico en el Cuartel del Monasterio. Ten cuidado con el Herrero que lo custodia.\",\n";
-                ss << u8"    \"jaJP\": \"〈修道院の兵舎〉で〈ホラドリムの片手鎚〉を探す。鎚を守る鍛冶師に注意せよ。\",\n";
-                ss << u8"    \"ptBR\": \"Procure pelo Malus Horádrico no Quartel do Monastério. Cuidado com o Ferreiro que o protege.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите хорадримский молот в монастырских казармах. Остерегайтесь Кузнеца, который его охраняет.\",\n";
-                ss << u8"    \"zhCN\": \"在修道院营房里找到赫拉迪姆之锤。当心守卫它的铁匠。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3756,\n";
-                ss << u8"    \"Key\": \"qstsa1q32\",\n";
-                ss << u8"    \"enUS\": \"Return the Horadric Malus to Charsi.\",\n";
-                ss << u8"    \"zhTW\": \"把赫拉迪姆之鎚帶回去給恰西。\",\n";
-                ss << u8"    \"deDE\": \"Bringt Charsi den Horadrimmalus zurück.\",\n";
-                ss << u8"    \"esES\": \"Devuélvele el malaise horádrico a Charsi.\",\n";
-                ss << u8"    \"frFR\": \"Ramenez le Marteau d'Horadrim à Charsi.\",\n";
-                ss << u8"    \"itIT\": \"Riporta il Malleus Horadrico a Charsi.\",\n";
-                ss << u8"    \"koKR\": \"호라드림 망치를 찰시에게 돌려주십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zwróć Charsi Malleusa Horadrimów.\",\n";
-                ss << u8"    \"esMX\": \"Llévale el Martillo horádrico a Charsi.\",\n";
-                ss << u8"    \"jaJP\": \"チャルシに〈ホラドリムの片手鎚〉を渡す。\",\n";
-                ss << u8"    \"ptBR\": \"Devolva o Malus Horádrico a Charsi.\",\n";
-                ss << u8"    \"ruRU\": \"Верните хорадримский молот Чарси.\",\n";
-                ss << u8"    \"zhCN\": \"把赫拉迪姆之锤还给恰西。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3757,\n";
-                ss << u8"    \"Key\": \"qstsa1q32b\",\n";
-                ss << u8"    \"enUS\": \"Charsi will imbue an item with magical power.\",\n";
-                ss << u8"    \"zhTW\": \"恰西會為你的一項物品灌入魔法力量。\",\n";
-                ss << u8"    \"deDE\": \"Charsi wird einen Gegenstand mit magischen Kräften versehen.\",\n";
-                ss << u8"    \"esES\": \"Charsi dotará de poder mágico a un objeto.\",\n";
-                ss << u8"    \"frFR\": \"Charsi va ensorceler un objet.\",\n";
-                ss << u8"    \"itIT\": \"Charsi infonderà un oggetto con proprietà magiche.\",\n";
-                ss << u8"    \"koKR\": \"찰시가 아이템에 마력을 주입해 줄 것입니다.\",\n";
-                ss << u8"    \"plPL\": \"Charsi może zakląć przedmiot magiczną mocą.\",\n";
-                ss << u8"    \"esMX\": \"Charsi puede imbuir un objeto con poder mágico.\",\n";
-                ss << u8"    \"jaJP\": \"チャルシがアイテムに魔力を込められるようになる。\",\n";
-                ss << u8"    \"ptBR\": \"Charsi imbuirá um item com poder mágico.\",\n";
-                ss << u8"    \"ruRU\": \"Чарси наполнит предмет магической силой.\",\n";
-                ss << u8"    \"zhCN\": \"恰西会给一件物品注入魔法力量。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3758,\n";
-                ss << u8"    \"Key\": \"qstsa1q61\",\n";
-                ss << u8"    \"enUS\": \"Find Andariel's Lair in the depths of the Monastery Catacombs.\",\n";
-                ss << u8"    \"zhTW\": \"在修道院的地下墓穴中，找到安達莉爾的巢穴。\",\n";
-                ss << u8"    \"deDE\": \"Findet Andariels Lager tief in den Katakomben des Klosters.\",\n";
-                ss << u8"    \"esES\": \"Encuentra el cubil de Andariel en las profundidades de las Catacumbas del monasterio.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez le repaire d’Andarielle dans les profondeurs des catacombes du Monastère.\",\n";
-                ss << u8"    \"itIT\": \"Trova il covo di Andariel nelle profondità delle Catacombe del monastero.\",\n";
-                ss << u8"    \"koKR\": \"수도원 지하 묘지 깊은 곳에 있는 안다리엘의 소굴을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź siedlisko Andariel w Katakumbach Klasztoru.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra la Guarida de Andariel en las profundidades de las Catacumbas del Monasterio.\",\n";
-                ss << u8"    \"jaJP\": \"〈修道院の地下墓地〉の奥深くで〈アンダリエルの根城〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre o Covil de Andariel nas profundezas das Catacumbas do Monastério.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите логово Андариэль в монастырских катакомбах.\",\n";
-                ss << u8"    \"zhCN\": \"在修道院地下墓穴的深处找到安达莉尔的巢穴。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3759,\n";
-                ss << u8"    \"Key\": \"qstsa1q62\",\n";
-                ss << u8"    \"enUS\": \"Kill Andariel.\",\n";
-                ss << u8"    \"zhTW\": \"殺死安達莉爾。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Andariel.\",\n";
-                ss << u8"    \"esES\": \"Mata a Andariel.\",\n";
-                ss << u8"    \"frFR\": \"Tuez Andarielle.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi Andariel.\",\n";
-                ss << u8"    \"koKR\": \"안다리엘을 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Andariel.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Andariel.\",\n";
-                ss << u8"    \"jaJP\": \"アンダリエルを倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Andariel.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Андариэль.\",\n";
-                ss << u8"    \"zhCN\": \"消灭安达莉尔。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3760,\n";
-                ss << u8"    \"Key\": \"qstsa1q62b\",\n";
-                ss << u8"    \"enUS\": \"Return to Warriv to take the Caravan East.\",\n";
-                ss << u8"    \"zhTW\": \"回去找瓦瑞夫，隨著商隊向東旅行。\",\n";
-                ss << u8"    \"deDE\": \"Kehrt zu Warriv zurück und zieht mit der Karawane nach Osten.\",\n";
-                ss << u8"    \"esES\": \"Vuelve con Warriv para llevar la caravana al este.\",\n";
-                ss << u8"    \"frFR\": \"Repartez à l’est avec Warriv et la caravane.\",\n";
-                ss << u8"    \"itIT\": \"Torna da Warriv per unirti alla carovana verso est.\",\n";
-                ss << u8"    \"koKR\": \"와리브에게 돌아가 동방으로 가는 교역단에 합류하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Wróć do Warriva i rusz z karawaną na wschód.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Warriv para viajar al este con la caravana.\",\n";
-                ss << u8"    \"jaJP\": \"ワリヴと話して隊商と共に東に向かう。\",\n";
-                ss << u8"    \"ptBR\": \"Volte até Warriv para partir com a Caravana para o Leste.\",\n";
-                ss << u8"    \"ruRU\": \"Вернитесь к Варриву, чтобы отправиться вместе с караваном на восток.\",\n";
-                ss << u8"    \"zhCN\": \"回去找瓦瑞夫，带领商队前往东方。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 3761,\n";
-                ss << u8"    \"Key\": \"qstsa1q63\",\n";
-                ss << u8"    \"enUS\": \"Return to Warriv to take the Caravan East.\",\n";
-                ss << u8"    \"zhTW\": \"回去找瓦瑞夫，隨著商隊向東旅行。\",\n";
-                ss << u8"    \"deDE\": \"Kehrt zu Warriv zurück und zieht mit der Karawane nach Osten.\",\n";
-                ss << u8"    \"esES\": \"Vuelve con Warriv para llevar la caravana al este.\",\n";
-                ss << u8"    \"frFR\": \"Repartez à l’est avec Warriv et la caravane.\",\n";
-                ss << u8"    \"itIT\": \"Torna da Warriv per unirti alla carovana verso est.\",\n";
-                ss << u8"    \"koKR\": \"와리브에게 돌아가 동방으로 가는 교역단에 합류하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Wróć do Warriva i rusz z karawaną na wschód.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Warriv para viajar al este con la caravana.\",\n";
-                ss << u8"    \"jaJP\": \"ワリヴと話して隊商と共に東に向かう。\",\n";
-                ss << u8"    \"ptBR\": \"Volte até Warriv para partir com a Caravana para o Leste.\",\n";
-                ss << u8"    \"ruRU\": \"Вернитесь к Варриву, чтобы отправиться вместе с караваном на восток.\",\n";
-                ss << u8"    \"zhCN\": \"回去找瓦瑞夫，带领商队前往东方。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 11030,\n";
-                ss << u8"    \"Key\": \"qstsa2q63f\",\n";
-                ss << u8"    \"enUS\": \"Explore Tal Rasha's Tomb\",\n";
-                ss << u8"    \"zhTW\": \"探索塔拉夏的古墓。\",\n";
-                ss << u8"    \"deDE\": \"Erkundet Tal Rashas Grab.\",\n";
-                ss << u8"    \"esES\": \"Explora la Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"frFR\": \"Explorez la Chambre de Tal Rasha.\",\n";
-                ss << u8"    \"itIT\": \"Esplora la Tomba di Tal Rasha.\",\n";
-                ss << u8"    \"koKR\": \"탈 라샤의 무덤을 탐험하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zbadaj grobowiec Tal Rashy.\",\n";
-                ss << u8"    \"esMX\": \"Explora la Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"jaJP\": \"〈タル・ラシャの墓〉を探索する。\",\n";
-                ss << u8"    \"ptBR\": \"Explore a Tumba de Tal Rasha.\",\n";
-                ss << u8"    \"ruRU\": \"Исследуйте гробницу Тал Раши.\",\n";
-                ss << u8"    \"zhCN\": \"探索塔·拉夏之墓\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21786,\n";
-                ss << u8"    \"Key\": \"qsta5q14\",\n";
-                ss << u8"    \"enUS\": \"Larzuk will add sockets to the item of your choice.\",\n";
-                ss << u8"    \"zhTW\": \"拉蘇克會在你指定的物品上面增加鑲孔。\",\n";
-                ss << u8"    \"deDE\": \"Larzuk fügt einem Gegenstand Eurer Wahl Sockelfassungen hinzu.\",\n";
-                ss << u8"    \"esES\": \"Larzuk añadirá huecos al objeto que elijas.\",\n";
-                ss << u8"    \"frFR\": \"Larzuk vous permettra d’orner l’objet de votre choix.\",\n";
-                ss << u8"    \"itIT\": \"Larzuk aggiungerà dei castoni a un oggetto di tua scelta.\",\n";
-                ss << u8"    \"koKR\": \"라르주크가 선택한 아이템에 홈을 추가해 줄 것입니다.\",\n";
-                ss << u8"    \"plPL\": \"Larzuk wprawi gniazda w wybrany przedmiot.\",\n";
-                ss << u8"    \"esMX\": \"Larzuk puede agregar engarces al objeto que elijas.\",\n";
-                ss << u8"    \"jaJP\": \"ラルザックがアイテムにソケットを追加できるようになる。\",\n";
-                ss << u8"    \"ptBR\": \"Larzuk adicionará engastes a um item à sua escolha.\",\n";
-                ss << u8"    \"ruRU\": \"Ларзук добавит гнезда в выбранный вами предмет.\",\n";
-                ss << u8"    \"zhCN\": \"拉苏克会给你选择的物品添加镶孔。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21787,\n";
-                ss << u8"    \"Key\": \"qstsa5q42a\",\n";
-                ss << u8"    \"enUS\": \"Find Nihlathak in the Halls of Vaught.\",\n";
-                ss << u8"    \"zhTW\": \"在沃特之廳找出尼拉塞克。\",\n";
-                ss << u8"    \"deDE\": \"Findet Nihlathak in den Hallen von Vaught.\",\n";
-                ss << u8"    \"esES\": \"Encuentra a Nihlathak en las Salas de Vaught.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez Nihlathak dans les Corridors du Martyre.\",\n";
-                ss << u8"    \"itIT\": \"Trova Nihlathak nelle Sale di Vaught.\",\n";
-                ss << u8"    \"koKR\": \"보트의 전당에서 니흘라탁을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź Nihlathaka w Salach Nieszczęścia.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra a Nihlathak en las Salas de Vaught.\",\n";
-                ss << u8"    \"jaJP\": \"〈ヴォートの広間〉でニーラサックを探す。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre Nilatak nos Salões de Vaught.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите Нильятака в Чертогах Воута.\",\n";
-                ss << u8"    \"zhCN\": \"在沃特大厅里找到尼拉塞克。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21788,\n";
-                ss << u8"    \"Key\": \"qstsa5q31a\",\n";
-                ss << u8"    \"enUS\": \"Rescue Anya.\",\n";
-                ss << u8"    \"zhTW\": \"救出安亞。\",\n";
-                ss << u8"    \"deDE\": \"Rettet Anya.\",\n";
-                ss << u8"    \"esES\": \"Rescata a Anya.\",\n";
-                ss << u8"    \"frFR\": \"Sauvez Anya.\",\n";
-                ss << u8"    \"itIT\": \"Salva Anya.\",\n";
-                ss << u8"    \"koKR\": \"안야를 구출하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Uratuj Anyę.\",\n";
-                ss << u8"    \"esMX\": \"Rescata a Anya.\",\n";
-                ss << u8"    \"jaJP\": \"アニャを救出する。\",\n";
-                ss << u8"    \"ptBR\": \"Resgate Anya.\",\n";
-                ss << u8"    \"ruRU\": \"Спасите Аню.\",\n";
-                ss << u8"    \"zhCN\": \"拯救安雅。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21789,\n";
-                ss << u8"    \"Key\": \"qstsa5q21a\",\n";
-                ss << u8"    \"enUS\": \"Free the soldiers from their prison and lead them back to town.\",\n";
-                ss << u8"    \"zhTW\": \"從監牢中救出士兵，並把他們帶回城鎮。\",\n";
-                ss << u8"    \"deDE\": \"Befreit die Soldaten aus ihrem Gefängnis und bringt sie zurück ins Dorf.\",\n";
-                ss << u8"    \"esES\": \"Libera a los soldados prisioneros y condúcelos de vuelta a la ciudad.\",\n";
-                ss << u8"    \"frFR\": \"Libérez les soldats de leur prison et guidez-les vers la ville.\",\n";
-                ss << u8"    \"itIT\": \"Libera i soldati dalla loro prigione e conducili in città.\",\n";
-                ss << u8"    \"koKR\": \"병사들을 감옥에서 구출하고 마을로 데려가십시오.\",\n";
-                ss << u8"    \"plPL\": \"Uwolnij żołnierzy z niewoli i sprowadź ich z powrotem do miasta.\",\n";
-                ss << u8"    \"esMX\": \"Libera a los soldados de su prisión y llévalos de vuelta al poblado.\",\n";
-                ss << u8"    \"jaJP\": \"牢に囚われた兵士を解放して町に連れ戻す。\",\n";
-                ss << u8"    \"ptBR\": \"Liberte os soldados da prisão e leve-os de volta à cidade.\",\n";
-                ss << u8"    \"ruRU\": \"Освободите солдат из тюрьмы и отведите их в город.\",\n";
-                ss << u8"    \"zhCN\": \"把士兵们从监狱里释放出来，带他们回城里去。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21790,\n";
-                ss << u8"    \"Key\": \"qstsa5q43a\",\n";
-                ss << u8"    \"enUS\": \"Anya will personalize an item for you.\",\n";
-                ss << u8"    \"zhTW\": \"安亞會為一件物品冠上你的名字。\",\n";
-                ss << u8"    \"deDE\": \"Anya wird einen Gegenstand für Euch personalisieren.\",\n";
-                ss << u8"    \"esES\": \"Anya personalizará un objeto para ti.\",\n";
-                ss << u8"    \"frFR\": \"Anya personnalisera un objet pour vous.\",\n";
-                ss << u8"    \"itIT\": \"Anya personalizzerà un oggetto per te.\",\n";
-                ss << u8"    \"koKR\": \"안야가 당신을 위해 아이템에 이름을 새겨 줄 것입니다.\",\n";
-                ss << u8"    \"plPL\": \"Anya nada przedmiotowi twoje imię.\",\n";
-                ss << u8"    \"esMX\": \"Anya puede personalizar un objeto para ti.\",\n";
-                ss << u8"    \"jaJP\": \"アニャがアイテムに名前を入れられるようになる。\",\n";
-                ss << u8"    \"ptBR\": \"Anya personalizará um item para você.\",\n";
-                ss << u8"    \"ruRU\": \"Аня может назвать предмет вашим именем.\",\n";
-                ss << u8"    \"zhCN\": \"安雅会为你定制一件物品。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21791,\n";
-                ss << u8"    \"Key\": \"qstsa5q62a\",\n";
-                ss << u8"    \"enUS\": \"Kill Baal in the Worldstone Chamber before he corrupts it.\",\n";
-                ss << u8"    \"zhTW\": \"在巴爾腐化世界之石以前，殺掉位於世界之石大殿中的巴爾。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Baal in der Kammer des Weltsteins, bevor er ihn besudelt.\",\n";
-                ss << u8"    \"esES\": \"Mata a Baal en la Cámara de la Piedra del Mundo antes de la corrompa.\",\n";
-                ss << u8"    \"frFR\": \"Tuez Baal dans la Chambre de la Pierre-Monde avant qu’il ne la corrompe.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi Baal nelle Sale della Pietra del Mondo prima che la corrompa.\",\n";
-                ss << u8"    \"koKR\": \"바알이 세계석을 타락시키기 전에 세계석 보관실에서 바알을 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Baala w Komnacie Kamienia Świata, zanim go splugawi.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Baal en la Cámara de la Piedra Ecuménica antes de que la corrompa.\",\n";
-                ss << u8"    \"jaJP\": \"〈ワールドストーンの間〉が崩壊する前にバールを倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Baal na Câmara da Pedra do Mundo antes que ele a corrompa.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Баала в Святилище Мироздания прежде, чем он осквернит его.\",\n";
-                ss << u8"    \"zhCN\": \"在巴尔腐蚀世界之石之前消灭他。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21792,\n";
-                ss << u8"    \"Key\": \"qstsa5q61a\",\n";
-                ss << u8"    \"enUS\": \"Find Baal's Throne Room.\",\n";
-                ss << u8"    \"zhTW\": \"找到巴爾的王座大廳。\",\n";
-                ss << u8"    \"deDE\": \"Findet Baals Thronsaal.\",\n";
-                ss << u8"    \"esES\": \"Encuentra la sala del trono de Baal.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez la Salle du Trône de Baal.\",\n";
-                ss << u8"    \"itIT\": \"Trova la sala del trono di Baal.\",\n";
-                ss << u8"    \"koKR\": \"바알의 왕좌를 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź Salę Tronową Baala.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra la Sala del Trono de Baal.\",\n";
-                ss << u8"    \"jaJP\": \"〈バールの王座の間〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre a Sala do Trono de Baal.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите тронный зал Баала.\",\n";
-                ss << u8"    \"zhCN\": \"找到巴尔的王座大厅。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 21881,\n";
-                ss << u8"    \"Key\": \"qstsa5q62b\",\n";
-                ss << u8"    \"enUS\": \"Kill Baal's Minions.\",\n";
-                ss << u8"    \"zhTW\": \"殺死巴爾的僕從。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Baals Diener.\",\n";
-                ss << u8"    \"esES\": \"Mata a los esbirros de Baal.\",\n";
-                ss << u8"    \"frFR\": \"Tuez les serviteurs de Baal.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi i seguaci di Baal.\",\n";
-                ss << u8"    \"koKR\": \"바알의 하수인을 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij sługi Baala.\",\n";
-                ss << u8"    \"esMX\": \"Mata a los Esbirros de Baal.\",\n";
-                ss << u8"    \"jaJP\": \"バールの手下を倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate os Lacaios de Baal.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте прислужников Баала.\",\n";
-                ss << u8"    \"zhCN\": \"消灭巴尔的仆从。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22618,\n";
-                ss << u8"    \"Key\": \"qstsa5q1\",\n";
-                ss << u8"    \"enUS\": \"Siege on Harrogath\",\n";
-                ss << u8"    \"zhTW\": \"哈洛加斯圍城戰\",\n";
-                ss << u8"    \"deDE\": \"Belagerung von Harrogath\",\n";
-                ss << u8"    \"esES\": \"Asedio a Harrogath\",\n";
-                ss << u8"    \"frFR\": \"Le siège d’Harrogath\",\n";
-                ss << u8"    \"itIT\": \"Assedio ad Harrogath\",\n";
-                ss << u8"    \"koKR\": \"하로가스 공성전\",\n";
-                ss << u8"    \"plPL\": \"Oblężenie Harrogath\",\n";
-                ss << u8"    \"esMX\": \"Asedio de Harrogat\",\n";
-                ss << u8"    \"jaJP\": \"ハロガスの包囲\",\n";
-                ss << u8"    \"ptBR\": \"Cerco de Harrogath\",\n";
-                ss << u8"    \"ruRU\": \"Осада Харрогата\",\n";
-                ss << u8"    \"zhCN\": \"哈洛加斯围城战\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22619,\n";
-                ss << u8"    \"Key\": \"qsta5q11\",\n";
-                ss << u8"    \"enUS\": \"Stop the Siege by killing Shenk the Overseer in the Bloody Foothills.\",\n";
-                ss << u8"    \"zhTW\": \"殺死在血腥丘陵的督軍山克，以阻止這場圍城戰。\",\n";
-                ss << u8"    \"deDE\": \"Beendet die Belagerung, indem Ihr Schenk den Aufseher im Blutigen Vorgebirge besiegt.\",\n";
-                ss << u8"    \"esES\": \"Para detener el asedio, elimina a Shenk, el que todo lo ve, en las Estribaciones Sangrientas.\",\n";
-                ss << u8"    \"frFR\": \"Mettez fin au siège en éliminant Shenk le surveillant dans les Collines Sanglantes.\",\n";
-                ss << u8"    \"itIT\": \"Spezza l'assedio uccidendo Shenk il Sovrintendente nelle Colline Insanguinate.\",\n";
-                ss << u8"    \"koKR\": \"핏빛 언덕에서 감독관 쉔크를 처치하여 공격을 저지하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Przerwij oblężenie, zabijając Shenka Nadzorcę na Krwawych Wzgórzach.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Shenk el Mayoral en las Laderas Sangrientas para detener el asedio.\",\n";
-                ss << u8"    \"jaJP\": \"〈血に塗れし丘陵〉で〈監視者シェンク〉を倒して包囲を終わらせる。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Shenk, o Capataz para acabar com o cerco nas Colinas Sangrentas.\",\n";
-                ss << u8"    \"ruRU\": \"Прекратите осаду, убив Шенка Надзирателя в Кровавых предгорьях.\",\n";
-                ss << u8"    \"zhCN\": \"消灭血腥丘陵的督军山克，解除围城。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22620,\n";
-                ss << u8"    \"Key\": \"qsta5q12\",\n";
-                ss << u8"    \"enUS\": \"Kill Shenk the Overseer.\",\n";
-                ss << u8"    \"zhTW\": \"殺死督軍山克。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Schenk den Aufseher.\",\n";
-                ss << u8"    \"esES\": \"Mata a Shenk, el que todo lo ve.\",\n";
-                ss << u8"    \"frFR\": \" Tuez Shenk le surveillant. \",\n";
-                ss << u8"    \"itIT\": \"Uccidi Shenk il Sovrintendente.\",\n";
-                ss << u8"    \"koKR\": \"감독관 쉔크를 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Shenka Nadzorcę.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Shenk el Mayoral.\",\n";
-                ss << u8"    \"jaJP\": \"〈監視者シェンク〉を倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Shenk, o Capataz.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Шенка Надзирателя.\",\n";
-                ss << u8"    \"zhCN\": \"消灭督军山克。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22621,\n";
-                ss << u8"    \"Key\": \"qsta5q13\",\n";
-                ss << u8"    \"enUS\": \"Go talk to Larzuk for your reward.\",\n";
-                ss << u8"    \"zhTW\": \"與拉蘇克交談，領取你的獎勵。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Larzuk, um Eure Belohnung zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Habla con Larzuk para recibir una recompensa.\",\n";
-                ss << u8"    \"frFR\": \"Allez parler à Larzuk pour obtenir votre récompense.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Larzuk per la ricompensa.\",\n";
-                ss << u8"    \"koKR\": \"라르주크와 대화하여 보상을 받으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Larzukiem w sprawie nagrody.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Larzuk para recibir tu recompensa.\",\n";
-                ss << u8"    \"jaJP\": \"ラルザックと話して報酬を受け取る。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Larzuk para receber sua recompensa.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Ларзуком, чтобы получить награду.\",\n";
-                ss << u8"    \"zhCN\": \"去和拉苏克谈谈领取奖励。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22622,\n";
-                ss << u8"    \"Key\": \"qstsa5q2\",\n";
-                ss << u8"    \"enUS\": \"Rescue on Mount Arreat\",\n";
-                ss << u8"    \"zhTW\": \"亞瑞特山的救援行動\",\n";
-                ss << u8"    \"deDE\": \"Rettung auf dem Berg Arreat\",\n";
-                ss << u8"    \"esES\": \"Rescate en el Monte Arreat\",\n";
-                ss << u8"    \"frFR\": \"Sauvetage au mont Arreat\",\n";
-                ss << u8"    \"itIT\": \"Salvataggio sul Monte Arreat\",\n";
-                ss << u8"    \"koKR\": \"아리앗 산에서의 구출\",\n";
-                ss << u8"    \"plPL\": \"Ratunek na górze Arreat\",\n";
-                ss << u8"    \"esMX\": \"Rescate en el Monte Arreat\",\n";
-                ss << u8"    \"jaJP\": \"アリート山での救出\",\n";
-                ss << u8"    \"ptBR\": \"Resgate no Monte Arreat\",\n";
-                ss << u8"    \"ruRU\": \"Вылазка на гору Арреат\",\n";
-                ss << u8"    \"zhCN\": \"亚瑞特山救援行动\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22623,\n";
-                ss << u8"    \"Key\": \"qstsa5q21\",\n";
-                ss << u8"    \"enUS\": \"Find the Soldiers in the Frigid Highlands.\",\n";
-                ss << u8"    \"zhTW\": \"找到冰凍高地上的士兵。\",\n";
-                ss << u8"    \"deDE\": \"Findet die Soldaten im Eishochland.\",\n";
-                ss << u8"    \"esES\": \"Encuentra a los soldados en las Tierras Altas Glaciales.\",\n";
-                ss << u8"    \"frFR\": \"Retrouvez les soldats prisonniers des Hautes-Glaces.\",\n";
-                ss << u8"    \"itIT\": \"Trova i soldati sugli Altopiani del Gelo.\",\n";
-                ss << u8"    \"koKR\": \"혹한의 고산지에서 병사들을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Znajdź żołnierzy na Zlodowaciałej Wyżynie.\",\n";
-                ss << u8"    \"esMX\": \"Encuentra a los soldados en las Tierras Altas Gélidas.\",\n";
-                ss << u8"    \"jaJP\": \"〈極寒の高原〉で兵士を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Encontre os soldados nas Terras Altas Gélidas.\",\n";
-                ss << u8"    \"ruRU\": \"Найдите солдат на Мерзлом нагорье.\",\n";
-                ss << u8"    \"zhCN\": \"在冰冻高地找到士兵。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22624,\n";
-                ss << u8"    \"Key\": \"qstsa5q22\",\n";
-                ss << u8"    \"enUS\": \"Rescue %d more Soldiers in the Frigid Highlands.\",\n";
-                ss << u8"    \"zhTW\": \"在冰凍高地救援%d位士兵。\",\n";
-                ss << u8"    \"deDE\": \"Rettet noch %d Soldaten im Eishochland.\",\n";
-                ss << u8"    \"esES\": \"Rescata %d soldados más en las Tierras Altas Glaciales.\",\n";
-                ss << u8"    \"frFR\": \"Vous avez encore %d soldats à libérer des Hautes-Glaces.\",\n";
-                ss << u8"    \"itIT\": \"Salva altri %d soldati sugli Altopiani del Gelo.\",\n";
-                ss << u8"    \"koKR\": \"혹한의 고산지에서 병사를 %d명 이상 구출하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Uratuj żołnierzy na Zlodowaciałej Wyżynie. Pozostało %d żołnierzy.\",\n";
-                ss << u8"    \"esMX\": \"Rescata a %d soldados más en las Tierras Altas Gélidas.\",\n";
-                ss << u8"    \"jaJP\": \"〈極寒の高原〉で残り%d人の兵士を救出する。\",\n";
-                ss << u8"    \"ptBR\": \"Resgate mais %d soldados nas Terras Altas Gélidas.\",\n";
-                ss << u8"    \"ruRU\": \"Осталось солдат в плену на Мерзлом нагорье: %d.\",\n";
-                ss << u8"    \"zhCN\": \"在冰冻高地营救%d名士兵。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22625,\n";
-                ss << u8"    \"Key\": \"qstsa5q23\",\n";
-                ss << u8"    \"enUS\": \"Return to Qual-Kehk for your reward.\",\n";
-                ss << u8"    \"zhTW\": \"回去找夸爾凱克，領取你的獎賞。\",\n";
-                ss << u8"    \"deDE\": \"Kehrt zu Qua-Kehk zurück, um Eure Belohnung zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Vuelve con Qual-Kehk para recibir una recompensa.\",\n";
-                ss << u8"    \"frFR\": \"Allez voir Qual-Kehk pour obtenir votre récompense.\",\n";
-                ss << u8"    \"itIT\": \"Torna da Qual-Kehk per la ricompensa.\",\n";
-                ss << u8"    \"koKR\": \"콸케크에게 돌아가 보상을 받으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Wróć do Qual-Kehka po swą nagrodę.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Qual-Kehk para recibir tu recompensa.\",\n";
-                ss << u8"    \"jaJP\": \"クァル=ケックと会って報酬を受け取る。\",\n";
-                ss << u8"    \"ptBR\": \"Volte até Qual-kehk para receber sua recompensa.\",\n";
-                ss << u8"    \"ruRU\": \"Вернитесь к Куаль-Кеку за наградой.\",\n";
-                ss << u8"    \"zhCN\": \"回去找夸尔凯克领取奖励。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22626,\n";
-                ss << u8"    \"Key\": \"qstsa5q24\",\n";
-                ss << u8"    \"enUS\": \"Apply the Runes to a Socketed item in this order:\",\n";
-                ss << u8"    \"zhTW\": \"以下列順序把符文嵌進鑲孔物品：\",\n";
-                ss << u8"    \"deDE\": \"Setzt die Runen in dieser Reihenfolge in einen gesockelten Gegenstand ein:\",\n";
-                ss << u8"    \"esES\": \"Engarza las runas en un objeto con huecos en el siguiente orden:\",\n";
-                ss << u8"    \"frFR\": \"Utilisez les runes sur un objet à sertir dans l’ordre suivant…\",\n";
-                ss << u8"    \"itIT\": \"Applica le rune a un oggetto con castoni in quest'ordine:\",\n";
-                ss << u8"    \"koKR\": \"룬을 다음 순서대로 홈 파인 아이템에 장착하십시오:\",\n";
-                ss << u8"    \"plPL\": \"W gniazdach przedmiotu umieść runy w podanej kolejności:\",\n";
-                ss << u8"    \"esMX\": \"Aplica las runas a un objeto engarzado en este orden:\",\n";
-                ss << u8"    \"jaJP\": \"この順序でソケット付きのアイテムにルーンを適用する:\",\n";
-                ss << u8"    \"ptBR\": \"Insira as runas a um item com engastes nesta ordem:\",\n";
-                ss << u8"    \"ruRU\": \"Примените руны к предмету с гнездами в следующем порядке:\",\n";
-                ss << u8"    \"zhCN\": \"将符文按如下顺序镶嵌到有镶孔的物品：\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22627,\n";
-                ss << u8"    \"Key\": \"qstsa5q3\",\n";
-                ss << u8"    \"enUS\": \"Prison of Ice\",\n";
-                ss << u8"    \"zhTW\": \"冰凍囚牢\",\n";
-                ss << u8"    \"deDE\": \"Eisgefängnis\",\n";
-                ss << u8"    \"esES\": \"Prisión de hielo\",\n";
-                ss << u8"    \"frFR\": \"Prison de glace\",\n";
-                ss << u8"    \"itIT\": \"Prigione di ghiaccio\",\n";
-                ss << u8"    \"koKR\": \"얼음 감옥\",\n";
-                ss << u8"    \"plPL\": \"Lodowe więzienie\",\n";
-                ss << u8"    \"esMX\": \"Prisión de Hielo\",\n";
-                ss << u8"    \"jaJP\": \"氷の牢獄\",\n";
-                ss << u8"    \"ptBR\": \"Prisão de Gelo\",\n";
-                ss << u8"    \"ruRU\": \"Ледяная темница\",\n";
-                ss << u8"    \"zhCN\": \"冰之囚牢\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22628,\n";
-                ss << u8"    \"Key\": \"qstsa5q31\",\n";
-                ss << u8"    \"enUS\": \"Look for Anya under the Crystalline Passage by the Frozen River.\",\n";
-                ss << u8"    \"zhTW\": \"在水晶通道下的冰凍之河尋覓安亞。\",\n";
-                ss << u8"    \"deDE\": \"Findet Anya unter dem Kristalldurchgang beim Frostfluss.\",\n";
-                ss << u8"    \"esES\": \"Busca a Anya bajo el Pasaje Cristalino junto al Río Helado.\",\n";
-                ss << u8"    \"frFR\": \"Trouvez Anya sous le Passage Cristallin près de la Rivière Glacée.\",\n";
-                ss << u8"    \"itIT\": \"Trova Anya presso il Fiume Gelido, sotto il Passaggio Cristallino.\",\n";
-                ss << u8"    \"koKR\": \"수정 동굴 아래의 얼어붙은 강에서 안야를 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poszukaj Anyi pod Kryształowym Przejściem w pobliżu Zamarzniętej Rzeki.\",\n";
-                ss << u8"    \"esMX\": \"Busca a Anya bajo el Pasaje Cristalino junto al Río Congelado.\",\n";
-                ss << u8"    \"jaJP\": \"〈凍てつく川〉の近くにある〈結晶道〉の地下でアニャを探す。\",\n";
-                ss << u8"    \"ptBR\": \"Procure por Anya sob a Passagem Cristalina próxima ao Rio Congelado.\",\n";
-                ss << u8"    \"ruRU\": \"Поищите Аню в Ледяных пещерах у Замерзшей реки.\",\n";
-                ss << u8"    \"zhCN\": \"在水晶通道下的冰冻之河寻找安雅。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22629,\n";
-                ss << u8"    \"Key\": \"qstsa5q32\",\n";
-                ss << u8"    \"enUS\": \"Talk to Malah.\",\n";
-                ss << u8"    \"zhTW\": \"與瑪拉交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Malah.\",\n";
-                ss << u8"    \"esES\": \"Habla con Malah.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Malah.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Malah.\",\n";
-                ss << u8"    \"koKR\": \"말라와 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Malah.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Malah.\",\n";
-                ss << u8"    \"jaJP\": \"マラーと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Malah.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Маллой.\",\n";
-                ss << u8"    \"zhCN\": \"跟马拉交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22630,\n";
-                ss << u8"    \"Key\": \"qstsa5q33\",\n";
-                ss << u8"    \"enUS\": \"Use the potion Malah gave you to thaw Anya.\",\n";
-                ss << u8"    \"zhTW\": \"使用瑪拉給你的藥水融化安亞身上的冰。\",\n";
-                ss << u8"    \"deDE\": \"Benutzt das Elixier, das Malah Euch gegeben hat, um Anya aufzutauen.\",\n";
-                ss << u8"    \"esES\": \"Utiliza la poción que te dio Malah para descongelar a Anya.\",\n";
-                ss << u8"    \"frFR\": \"Utilisez la potion que Malah vous a donnée pour libérer Anya.\",\n";
-                ss << u8"    \"itIT\": \"Usa la pozione che ti ha dato Malah per scongelare Anya.\",\n";
-                ss << u8"    \"koKR\": \"말라에게 받은 물약을 사용하여 안야를 녹이십시오.\",\n";
-                ss << u8"    \"plPL\": \"Użyj otrzymanej od Malah mikstury do rozmrożenia Anyi.\",\n";
-                ss << u8"    \"esMX\": \"Usa la poción que te dio Malah para descongelar a Anya.\",\n";
-                ss << u8"    \"jaJP\": \"マラーに渡されたポーションでアニャの氷を解かす。\",\n";
-                ss << u8"    \"ptBR\": \"Use a poção que Malah deu a você para descongelar Anya.\",\n";
-                ss << u8"    \"ruRU\": \"Отогрейте Аню с помощью зелья, которое дала вам Малла.\",\n";
-                ss << u8"    \"zhCN\": \"用马拉给你的药水解冻安雅。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22631,\n";
-                ss << u8"    \"Key\": \"qstsa5q34\",\n";
-                ss << u8"    \"enUS\": \"Talk to Malah for your reward.\",\n";
-                ss << u8"    \"zhTW\": \"與瑪拉交談，領取你的獎勵。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Malah, um Eure Belohnung zu erhalten.\",\n";
-                ss << u8"    \"esES\": \"Habla con Malah para recibir una recompensa.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Malah pour obtenir votre récompense.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Malah per la ricompensa.\",\n";
-                ss << u8"    \"koKR\": \"말라와 대화하여 보상을 받으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Malah o twojej nagrodzie.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Malah para recibir tu recompensa.\",\n";
-                ss << u8"    \"jaJP\": \"マラーと話して報酬を受け取る。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Malah para receber sua recompensa.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Маллой, чтобы получить награду.\",\n";
-                ss << u8"    \"zhCN\": \"与马拉交谈领取奖励。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22632,\n";
-                ss << u8"    \"Key\": \"qstsa5q35\",\n";
-                ss << u8"    \"enUS\": \"Talk to Anya.\",\n";
-                ss << u8"    \"zhTW\": \"與安亞交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Anya.\",\n";
-                ss << u8"    \"esES\": \"Habla con Anya.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Anya.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Anya.\",\n";
-                ss << u8"    \"koKR\": \"안야와 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Anyą.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Anya.\",\n";
-                ss << u8"    \"jaJP\": \"アニャと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Anya.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Аней.\",\n";
-                ss << u8"    \"zhCN\": \"与安雅交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22633,\n";
-                ss << u8"    \"Key\": \"qstsa5q4\",\n";
-                ss << u8"    \"enUS\": \"Betrayal of Harrogath\",\n";
-                ss << u8"    \"zhTW\": \"哈洛加斯的叛徒\",\n";
-                ss << u8"    \"deDE\": \"Verrat in Harrogath\",\n";
-                ss << u8"    \"esES\": \"La traición de Harrogath\",\n";
-                ss << u8"    \"frFR\": \"Le traître d’Harrogath\",\n";
-                ss << u8"    \"itIT\": \"Tradimento ad Harrogath\",\n";
-                ss << u8"    \"koKR\": \"하로가스의 배신\",\n";
-                ss << u8"    \"plPL\": \"Zdrada w Harrogath\",\n";
-                ss << u8"    \"esMX\": \"La Traición de Harrogat\",\n";
-                ss << u8"    \"jaJP\": \"ハロガスの裏切り\",\n";
-                ss << u8"    \"ptBR\": \"A Traição de Harrogath\",\n";
-                ss << u8"    \"ruRU\": \"Предательство Харрогата\",\n";
-                ss << u8"    \"zhCN\": \"哈洛加斯的背叛\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22634,\n";
-                ss << u8"    \"Key\": \"qstsa5q41\",\n";
-                ss << u8"    \"enUS\": \"Take Anya's portal to Nihlathak's Temple.\",\n";
-                ss << u8"    \"zhTW\": \"通過安亞的傳送門，前往尼拉塞克的神殿。\",\n";
-                ss << u8"    \"deDE\": \"Geht durch Anyas Portal zu Nihlathaks Tempel.\",\n";
-                ss << u8"    \"esES\": \"Toma el portal de Anya al Templo de Nihlathak.\",\n";
-                ss << u8"    \"frFR\": \"Prenez le portail d’Anya pour rejoindre le Temple de Nihlathak.\",\n";
-                ss << u8"    \"itIT\": \"Usa il portale di Anya per raggiungere il Tempio di Nihlathak.\",\n";
-                ss << u8"    \"koKR\": \"안야의 차원문을 통해 니흘라탁의 사원으로 이동하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Przejdź portalem Anyi do Świątyni Nihlathaka.\",\n";
-                ss << u8"    \"esMX\": \"Usa el portal de Anya hacia el Templo de Nihlathak.\",\n";
-                ss << u8"    \"jaJP\": \"アニャが開いたポータルで〈ニーラサックの寺院〉に向かう。\",\n";
-                ss << u8"    \"ptBR\": \"Use o portal de Anya para chegar ao Templo de Nilatak.\",\n";
-                ss << u8"    \"ruRU\": \"Перенеситесь через портал Ани к храму Нильятака.\",\n";
-                ss << u8"    \"zhCN\": \"使用安雅的传送门前往尼拉塞克的神殿。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22635,\n";
-                ss << u8"    \"Key\": \"qstsa5q42\",\n";
-                ss << u8"    \"enUS\": \"Kill Nihlathak.\",\n";
-                ss << u8"    \"zhTW\": \"殺死尼拉塞克。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Nihlathak.\",\n";
-                ss << u8"    \"esES\": \"Mata a Nihlathak.\",\n";
-                ss << u8"    \"frFR\": \"Tuez Nihlathak.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi Nihlathak.\",\n";
-                ss << u8"    \"koKR\": \"니흘라탁을 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Nihlathaka.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Nihlathak.\",\n";
-                ss << u8"    \"jaJP\": \"ニーラサックを倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Nilatak.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Нильятака.\",\n";
-                ss << u8"    \"zhCN\": \"消灭尼拉塞克。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22636,\n";
-                ss << u8"    \"Key\": \"qstsa5q43\",\n";
-                ss << u8"    \"enUS\": \"Talk to Anya before you continue through the Crystalline Passage, past the Glacial Trail, to proceed up Mount Arreat to the Summit.\",\n";
-                ss << u8"    \"zhTW\": \"在你繼續通過水晶通道、冰河小徑，並登上亞瑞特山巔之前先和安亞交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Anya, bevor Ihr durch den Kristalldurchgang geht und am Gletscherweg vorbei zum Gipfel des Berges Arreat wandert.\",\n";
-                ss << u8"    \"esES\": \"Habla con Anya antes de continuar a través del Pasaje Cristalino para pasar por la Senda Glacial y llegar hasta la cima del Monte Arreat.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Anya avant de continuer dans le Passage Cristallin, après la Piste des Glaces, pour escalader le mont Arreat jusqu’au sommet.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Anya prima di proseguire lungo il Passaggio Cristallino, oltre il Sentiero Ghiacciato, per procedere fino alla Sommità dell'Arreat.\",\n";
-                ss << u8"    \"koKR\": \"안야와 대화한 후, 수정 동굴을 통해 빙하의 길을 지나 아리앗 산의 정상으로 가십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Anyą zanim wyruszysz Kryształowym Przejściem za Lodowym Traktem i wejdziesz na szczyt góry Arreat.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Anya antes de atravesar el Pasaje Cristalino, más allá del Sendero Glacial, para llegar a la Cima del Monte Arreat.\",\n";
-                ss << u8"    \"jaJP\": \"アニャと話し、〈結晶道〉を通って〈氷の道〉を越え、〈アリート山の頂き〉に到達する。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Anya antes de prosseguir pela Passagem Cristalina, passar pela Trilha Glacial e subir o Monte Arreat até o Cume.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Аней, а затем пройдите через Ледяные пещеры, по Ледовому ходу и взойдите на вершину Арреата.\",\n";
-                ss << u8"    \"zhCN\": \"先和安雅谈谈，然后穿过水晶通道、经过冰川小径、登上亚瑞特山，直抵山巅。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22637,\n";
-                ss << u8"    \"Key\": \"qstsa5q5\",\n";
-                ss << u8"    \"enUS\": \"Rite of Passage\",\n";
-                ss << u8"    \"zhTW\": \"祭儀試煉\",\n";
-                ss << u8"    \"deDE\": \"Initiationsritus\",\n";
-                ss << u8"    \"esES\": \"Rito de iniciación\",\n";
-                ss << u8"    \"frFR\": \"Rite de passage\",\n";
-                ss << u8"    \"itIT\": \"Il rito del passaggio\",\n";
-                ss << u8"    \"koKR\": \"통과의례\",\n";
-                ss << u8"    \"plPL\": \"Rytuał przejścia\",\n";
-                ss << u8"    \"esMX\": \"Rito de Iniciación\",\n";
-                ss << u8"    \"jaJP\": \"通過儀礼\",\n";
-                ss << u8"    \"ptBR\": \"Rito de Passagem\",\n";
-                ss << u8"    \"ruRU\": \"Посвящение\",\n";
-                ss << u8"    \"zhCN\": \"通过仪式\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22638,\n";
-                ss << u8"    \"Key\": \"qstsa5q51\",\n";
-                ss << u8"    \"enUS\": \"Travel through the Ancient's Way to find the Ancients at the Arreat Summit.\",\n";
-                ss << u8"    \"zhTW\": \"沿著先祖之路行走，在亞瑞特山巔找到先祖。\",\n";
-                ss << u8"    \"deDE\": \"Benutzt den Weg der Urahnen, um die Urahnen auf dem Gipfel des Arreat zu finden.\",\n";
-                ss << u8"    \"esES\": \"Viaja a través del Camino de los Antiguos hasta la Cima Arreat para encontrar a los Antiguos.\",\n";
-                ss << u8"    \"frFR\": \"Empruntez le Chemin des Anciens pour rencontrer les Anciens au Sommet du mont Arreat.\",\n";
-                ss << u8"    \"itIT\": \"Percorri la Via degli Antichi per trovare gli Antichi sulla Sommità dell'Arreat.\",\n";
-                ss << u8"    \"koKR\": \"고대인의 길을 통과하여 아리앗 정상에 있는 고대인을 찾으십시오.\",\n";
-                ss << u8"    \"plPL\": \"Przejdź Drogą Starożytnych, by dostać się na szczyt Arreat.\",\n";
-                ss << u8"    \"esMX\": \"Atraviesa el Camino de los Ancestros para encontrar a los Ancestros en la Cima de Arreat.\",\n";
-                ss << u8"    \"jaJP\": \"〈古の道〉を通り、〈アリート山の頂き〉で〈古の民〉を探す。\",\n";
-                ss << u8"    \"ptBR\": \"Atravesse Caminho dos Ancestrais para encontrar os Ancestrais no Cume de Arreat.\",\n";
-                ss << u8"    \"ruRU\": \"Пройдите Путем Древних и найдите Древних на вершине Арреата.\",\n";
-                ss << u8"    \"zhCN\": \"穿过先祖之路，找到亚瑞特之巅的几位先祖。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22639,\n";
-                ss << u8"    \"Key\": \"qstsa5q52\",\n";
-                ss << u8"    \"enUS\": \"Consult with the Ancients by activating the Altar of the Heavens.\",\n";
-                ss << u8"    \"zhTW\": \"啟動天堂祭壇之後，與先祖交談。\",\n";
-                ss << u8"    \"deDE\": \"Aktiviert den Altar des Himmels und sprecht mit den Urahnen.\",\n";
-                ss << u8"    \"esES\": \"Consulta a los Antiguos activando el Altar de los Cielos.\",\n";
-                ss << u8"    \"frFR\": \"Consultez les Anciens en activant l’Autel des Cieux.\",\n";
-                ss << u8"    \"itIT\": \"Consulta gli Antichi attivando l'Altare dei Cieli.\",\n";
-                ss << u8"    \"koKR\": \"천상의 제단을 활성화하여 고대인과 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poradź się Starożytnych, aktywując Ołtarz Niebios.\",\n";
-                ss << u8"    \"esMX\": \"Activa el Altar de los Cielos para comunicarte con los Ancestros.\",\n";
-                ss << u8"    \"jaJP\": \"〈天国の祭壇〉を作動させて〈古の民〉に助言を求める。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com os Ancestrais ativando o Altar do Paraíso.\",\n";
-                ss << u8"    \"ruRU\": \"Посоветуйтесь с Древними, активировав алтарь Небес.\",\n";
-                ss << u8"    \"zhCN\": \"激活天坛寻求几位先祖的指引。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22640,\n";
-                ss << u8"    \"Key\": \"qstsa5q53\",\n";
-                ss << u8"    \"enUS\": \"Defeat all three Ancients without leaving Mount Arreat.\",\n";
-                ss << u8"    \"zhTW\": \"在不離開亞瑞特山的情況下，打倒三位先祖。\",\n";
-                ss << u8"    \"deDE\": \"Besiegt alle drei Urahnen, ohne den Berg Arreat zu verlassen.\",\n";
-                ss << u8"    \"esES\": \"Derrota a los tres Antiguos sin salir del Monte Arreat.\",\n";
-                ss << u8"    \"frFR\": \"Affrontez les trois Anciens sans quitter le mont Arreat.\",\n";
-                ss << u8"    \"itIT\": \"Sconfiggi i tre Antichi senza abbandonare il monte Arreat.\",\n";
-                ss << u8"    \"koKR\": \"아리앗 산을 떠나지 않고 고대인 세 명을 모두 쓰러뜨리십시오.\",\n";
-                ss << u8"    \"plPL\": \"Pokonaj Starożytnych nie schodząc z góry Arreat.\",\n";
-                ss << u8"    \"esMX\": \"Derrota a los tres Ancestros sin abandonar el Monte Arreat.\",\n";
-                ss << u8"    \"jaJP\": \"アリート山を離れずに3人の〈古の民〉を全員倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Derrote os três Ancestrais sem sair do Monte Arreat.\",\n";
-                ss << u8"    \"ruRU\": \"Победите всех трех Древних, не покидая горы Арреат.\",\n";
-                ss << u8"    \"zhCN\": \"在不离开亚瑞特山的情况下打败三位先祖。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22641,\n";
-                ss << u8"    \"Key\": \"qstsa5q6\",\n";
-                ss << u8"    \"enUS\": \"Eve of Destruction\",\n";
-                ss << u8"    \"zhTW\": \"毀滅的前夕\",\n";
-                ss << u8"    \"deDE\": \"Vorabend der Vernichtung\",\n";
-                ss << u8"    \"esES\": \"Víspera de la destrucción\",\n";
-                ss << u8"    \"frFR\": \"Crépuscule de la Destruction\",\n";
-                ss << u8"    \"itIT\": \"Nel cuore della distruzione\",\n";
-                ss << u8"    \"koKR\": \"파괴의 전조\",\n";
-                ss << u8"    \"plPL\": \"Wigilia Zniszczenia\",\n";
-                ss << u8"    \"esMX\": \"Víspera de la Destrucción\",\n";
-                ss << u8"    \"jaJP\": \"破滅の前夜\",\n";
-                ss << u8"    \"ptBR\": \"Véspera da Destruição\",\n";
-                ss << u8"    \"ruRU\": \"Удел Разрушения\",\n";
-                ss << u8"    \"zhCN\": \"毁灭前夕\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22642,\n";
-                ss << u8"    \"Key\": \"qstsa5q61\",\n";
-                ss << u8"    \"enUS\": \"Consult with the Ancients.\",\n";
-                ss << u8"    \"zhTW\": \"與先祖交談。\",\n";
-                ss << u8"    \"deDE\": \"Besprecht Euch mit den Urahnen.\",\n";
-                ss << u8"    \"esES\": \"Consulta a los antiguos.\",\n";
-                ss << u8"    \"frFR\": \"Consultez les Anciens.\",\n";
-                ss << u8"    \"itIT\": \"Consulta gli Antichi.\",\n";
-                ss << u8"    \"koKR\": \"고대인들에게 조언을 구하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Poradź się Starożytnych.\",\n";
-                ss << u8"    \"esMX\": \"Habla con los Ancestros.\",\n";
-                ss << u8"    \"jaJP\": \"〈古の民〉に助言を求める。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com os Ancestrais.\",\n";
-                ss << u8"    \"ruRU\": \"Спросите совета Древних.\",\n";
-                ss << u8"    \"zhCN\": \"寻求先祖的指引。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22643,\n";
-                ss << u8"    \"Key\": \"qstsa5q62\",\n";
-                ss << u8"    \"enUS\": \"Kill Baal.\",\n";
-                ss << u8"    \"zhTW\": \"殺死巴爾。\",\n";
-                ss << u8"    \"deDE\": \"Tötet Baal.\",\n";
-                ss << u8"    \"esES\": \"Mata a Baal.\",\n";
-                ss << u8"    \"frFR\": \"Tuez Baal.\",\n";
-                ss << u8"    \"itIT\": \"Uccidi Baal.\",\n";
-                ss << u8"    \"koKR\": \"바알을 처치하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Zabij Baala.\",\n";
-                ss << u8"    \"esMX\": \"Mata a Baal.\",\n";
-                ss << u8"    \"jaJP\": \"バールを倒す。\",\n";
-                ss << u8"    \"ptBR\": \"Mate Baal.\",\n";
-                ss << u8"    \"ruRU\": \"Убейте Баала.\",\n";
-                ss << u8"    \"zhCN\": \"消灭巴尔。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22644,\n";
-                ss << u8"    \"Key\": \"qstsa5q63\",\n";
-                ss << u8"    \"enUS\": \"Talk to Tyreal.\",\n";
-                ss << u8"    \"zhTW\": \"與泰瑞爾交談。\",\n";
-                ss << u8"    \"deDE\": \"Sprecht mit Tyrael.\",\n";
-                ss << u8"    \"esES\": \"Habla con Tyrael.\",\n";
-                ss << u8"    \"frFR\": \"Parlez à Tyraël.\",\n";
-                ss << u8"    \"itIT\": \"Parla con Tyrael.\",\n";
-                ss << u8"    \"koKR\": \"티리엘과 대화하십시오.\",\n";
-                ss << u8"    \"plPL\": \"Porozmawiaj z Tyraelem.\",\n";
-                ss << u8"    \"esMX\": \"Habla con Tyrael.\",\n";
-                ss << u8"    \"jaJP\": \"ティラエルと話す。\",\n";
-                ss << u8"    \"ptBR\": \"Fale com Tyreal.\",\n";
-                ss << u8"    \"ruRU\": \"Поговорите с Тираэлем.\",\n";
-                ss << u8"    \"zhCN\": \"与泰瑞尔交谈。\"\n";
-                ss << u8"  },\n";
-                ss << u8"  {\n";
-                ss << u8"    \"id\": 22645,\n";
-                ss << u8"    \"Key\": \"qstsa5q64\",\n";
-                ss << u8"    \"enUS\": \"Take Tyreal's Portal to Safety.\",\n";
-                ss << u8"    \"zhTW\": \"利用泰瑞爾的傳送門前往安全的地方。\",\n";
-                ss << u8"    \"deDE\": \"Bringt Euch durch Tyraels Portal in Sicherheit.\",\n";
-                ss << u8"    \"esES\": \"Toma el portal de Tyrael para ponerte a salvo.\",\n";
-                ss << u8"    \"frFR\": \"Prenez le Portail de Tyraël.\",\n";
-                ss << u8"    \"itIT\": \"Usa il portale di Tyrael per metterti in salvo.\",\n";
-                ss << u8"    \"koKR\": \"티리엘의 차원문을 통해 안전한 곳으로 가십시오.\",\n";
-                ss << u8"    \"plPL\": \"Przejdź portalem Tyraela w bezpieczne miejsce.\",\n";
-                ss << u8"    \"esMX\": \"Atraviesa el portal de Tyrael hacia un lugar seguro.\",\n";
-                ss << u8"    \"jaJP\": \"ティラエルが開いたポータルで安全な場所に移動する。\",\n";
-                ss << u8"    \"ptBR\": \"Use o Portal de Tyreal para chegar a um lugar seguro.\",\n";
-                ss << u8"    \"ruRU\": \"Отправляйтесь через портал Тираэля в безопасное место.\",\n";
-                ss << u8"    \"zhCN\": \"使用泰瑞尔的传送门前往安全地带。\"\n";
-                ss << u8"  }\n";
-                ss << u8"]\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"[\n",
+                u8"  {\n",
+                u8"    \"id\": 922,\n",
+                u8"    \"Key\": \"qstsa2q0\",\n",
+                u8"    \"enUS\": \"Act 2 Prologue\",\n",
+                u8"    \"zhTW\": \"第二章序幕\",\n",
+                u8"    \"deDE\": \"Akt 2 - Prolog\",\n",
+                u8"    \"esES\": \"Acto 2 Prólogo\",\n",
+                u8"    \"frFR\": \"Acte II - Prologue\",\n",
+                u8"    \"itIT\": \"Atto 2, prologo\",\n",
+                u8"    \"koKR\": \"2막 프롤로그\",\n",
+                u8"    \"plPL\": \"Prolog Aktu II\",\n",
+                u8"    \"esMX\": \"Acto 2 - Prólogo\",\n",
+                u8"    \"jaJP\": \"第2章 序幕\",\n",
+                u8"    \"ptBR\": \"Prólogo do Ato 2\",\n",
+                u8"    \"ruRU\": \"Акт 2 – пролог\",\n",
+                u8"    \"zhCN\": \"第二幕序章\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 923,\n",
+                u8"    \"Key\": \"qstsa2q1\",\n",
+                u8"    \"enUS\": \"Radament's Lair\",\n",
+                u8"    \"zhTW\": \"羅達門特的巢穴\",\n",
+                u8"    \"deDE\": \"Radaments Lager\",\n",
+                u8"    \"esES\": \"El cubil de Radament\",\n",
+                u8"    \"frFR\": \"Le Repaire de Radament\",\n",
+                u8"    \"itIT\": \"Il rifugio di Radament\",\n",
+                u8"    \"koKR\": \"라다먼트의 소굴\",\n",
+                u8"    \"plPL\": \"Siedlisko Radamenta\",\n",
+                u8"    \"esMX\": \"Guarida de Radament\",\n",
+                u8"    \"jaJP\": \"ラダメントの隠れ家\",\n",
+                u8"    \"ptBR\": \"Covil de Radament\",\n",
+                u8"    \"ruRU\": \"Логово Радаманта\",\n",
+                u8"    \"zhCN\": \"罗达门特的巢穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 924,\n",
+                u8"    \"Key\": \"qstsa2q2\",\n",
+                u8"    \"enUS\": \"The Horadric Staff\",\n",
+                u8"    \"zhTW\": \"赫拉迪姆之杖\",\n",
+                u8"    \"deDE\": \"Der Horadrimstab\",\n",
+                u8"    \"esES\": \"El bastón horádrico\",\n",
+                u8"    \"frFR\": \"Le Bâton horadrique\",\n",
+                u8"    \"itIT\": \"La Verga Horadrica\",\n",
+                u8"    \"koKR\": \"호라드림 지팡이\",\n",
+                u8"    \"plPL\": \"Kostur Horadrimów\",\n",
+                u8"    \"esMX\": \"El Bastón Horádrico\",\n",
+                u8"    \"jaJP\": \"ホラドリムの杖\",\n",
+                u8"    \"ptBR\": \"O Cajado Horádrico\",\n",
+                u8"    \"ruRU\": \"Хорадримский посох\",\n",
+                u8"    \"zhCN\": \"赫拉迪姆之杖\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 925,\n",
+                u8"    \"Key\": \"qstsa2q3\",\n",
+                u8"    \"enUS\": \"Tainted Sun\",\n",
+                u8"    \"zhTW\": \"蔽日黑暗\",\n",
+                u8"    \"deDE\": \"Verdunkelte Sonne\",\n",
+                u8"    \"esES\": \"Sol Mancillado\",\n",
+                u8"    \"frFR\": \"Soleil maudit\",\n",
+                u8"    \"itIT\": \"Il sole corrotto\",\n",
+                u8"    \"koKR\": \"더럽혀진 태양\",\n",
+                u8"    \"plPL\": \"Zbrukane Słońce\",\n",
+                u8"    \"esMX\": \"Sol Mancillado\",\n",
+                u8"    \"jaJP\": \"穢された太陽\",\n",
+                u8"    \"ptBR\": \"O Sol Maculado\",\n",
+                u8"    \"ruRU\": \"Затмение\",\n",
+                u8"    \"zhCN\": \"被污染的太阳\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 926,\n",
+                u8"    \"Key\": \"qstsa2q4\",\n",
+                u8"    \"enUS\": \"Arcane Sanctuary\",\n",
+                u8"    \"zhTW\": \"秘法聖殿\",\n",
+                u8"    \"deDE\": \"Geheime Zuflucht\",\n",
+                u8"    \"esES\": \"El Santuario Arcano\",\n",
+                u8"    \"frFR\": \"Le Sanctuaire des Arcanes\",\n",
+                u8"    \"itIT\": \"Il Santuario Arcano\",\n",
+                u8"    \"koKR\": \"비전의 성역\",\n",
+                u8"    \"plPL\": \"Tajemne Sanktuarium\",\n",
+                u8"    \"esMX\": \"Santuario Arcano\",\n",
+                u8"    \"jaJP\": \"深遠なる聖域\",\n",
+                u8"    \"ptBR\": \"O Santuário Arcano\",\n",
+                u8"    \"ruRU\": \"Магическое убежище\",\n",
+                u8"    \"zhCN\": \"神秘避难所\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 927,\n",
+                u8"    \"Key\": \"qstsa2q5\",\n",
+                u8"    \"enUS\": \"The Summoner\",\n",
+                u8"    \"zhTW\": \"召喚師\",\n",
+                u8"    \"deDE\": \"Der Geisterbeschwörer\",\n",
+                u8"    \"esES\": \"El Invocador\",\n",
+                u8"    \"frFR\": \"L’Invocateur\",\n",
+                u8"    \"itIT\": \"L'Evocatore\",\n",
+                u8"    \"koKR\": \"소환사\",\n",
+                u8"    \"plPL\": \"Demonolog\",\n",
+                u8"    \"esMX\": \"El Invocador\",\n",
+                u8"    \"jaJP\": \"召喚師\",\n",
+                u8"    \"ptBR\": \"O Evocador\",\n",
+                u8"    \"ruRU\": \"Призыватель\",\n",
+                u8"    \"zhCN\": \"召唤者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 928,\n",
+                u8"    \"Key\": \"qstsa2q6\",\n",
+                u8"    \"enUS\": \"The Seven Tombs\",\n",
+                u8"    \"zhTW\": \"七座古墓\",\n",
+                u8"    \"deDE\": \"Die sieben Gräber\",\n",
+                u8"    \"esES\": \"Las siete tumbas\",\n",
+                u8"    \"frFR\": \"Les Sept Tombeaux\",\n",
+                u8"    \"itIT\": \"Le sette tombe\",\n",
+                u8"    \"koKR\": \"일곱 개의 무덤\",\n",
+                u8"    \"plPL\": \"Siedem Grobowców\",\n",
+                u8"    \"esMX\": \"Las Siete Tumbas\",\n",
+                u8"    \"jaJP\": \"七つの墓\",\n",
+                u8"    \"ptBR\": \"As Sete Tumbas\",\n",
+                u8"    \"ruRU\": \"Семь гробниц\",\n",
+                u8"    \"zhCN\": \"七座古墓\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 929,\n",
+                u8"    \"Key\": \"qstsa3q0\",\n",
+                u8"    \"enUS\": \"Act 3 Prologue\",\n",
+                u8"    \"zhTW\": \"第三章序幕\",\n",
+                u8"    \"deDE\": \"Akt 3 - Prolog\",\n",
+                u8"    \"esES\": \"Acto 3 Prólogo\",\n",
+                u8"    \"frFR\": \"Acte III - Prologue\",\n",
+                u8"    \"itIT\": \"Atto 3, prologo\",\n",
+                u8"    \"koKR\": \"3막 프롤로그\",\n",
+                u8"    \"plPL\": \"Prolog Aktu III\",\n",
+                u8"    \"esMX\": \"Acto 3 - Prólogo\",\n",
+                u8"    \"jaJP\": \"第3章 序幕\",\n",
+                u8"    \"ptBR\": \"Prólogo do Ato 3\",\n",
+                u8"    \"ruRU\": \"Акт 3 – пролог\",\n",
+                u8"    \"zhCN\": \"第三幕序章\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 930,\n",
+                u8"    \"Key\": \"qstsa3q1\",\n",
+                u8"    \"enUS\": \"Lam Esen's Tome\",\n",
+                u8"    \"zhTW\": \"藍伊森之書\",\n",
+                u8"    \"deDE\": \"Lam Esens Foliant\",\n",
+                u8"    \"esES\": \"El tomo de Lam Esen\",\n",
+                u8"    \"frFR\": \"Livre de Lam Esen\",\n",
+                u8"    \"itIT\": \"Il Libro di Lam Esen\",\n",
+                u8"    \"koKR\": \"람 에센의 고서\",\n",
+                u8"    \"plPL\": \"Księga Lama Esena\",\n",
+                u8"    \"esMX\": \"El Tomo de Lam Esen\",\n",
+                u8"    \"jaJP\": \"ラム・エセンの書\",\n",
+                u8"    \"ptBR\": \"O Tomo de Lam Esen\",\n",
+                u8"    \"ruRU\": \"Фолиант Лам Эсена\",\n",
+                u8"    \"zhCN\": \"兰姆·艾森之书\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 931,\n",
+                u8"    \"Key\": \"qstsa3q2\",\n",
+                u8"    \"enUS\": \"Khalim's Will\",\n",
+                u8"    \"zhTW\": \"克林姆的遺願\",\n",
+                u8"    \"deDE\": \"Khalims Wille\",\n",
+                u8"    \"esES\": \"La voluntad de Khalim\",\n",
+                u8"    \"frFR\": \"La Volonté de Khalim\",\n",
+                u8"    \"itIT\": \"La Volontà di Khalim\",\n",
+                u8"    \"koKR\": \"칼림의 의지\",\n",
+                u8"    \"plPL\": \"Wola Khalima\",\n",
+                u8"    \"esMX\": \"Voluntad de Khalim\",\n",
+                u8"    \"jaJP\": \"カリムの意志\",\n",
+                u8"    \"ptBR\": \"Vontade de Khalim\",\n",
+                u8"    \"ruRU\": \"Воля Халима\",\n",
+                u8"    \"zhCN\": \"卡林姆的意志\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 932,\n",
+                u8"    \"Key\": \"qstsa3q3\",\n",
+                u8"    \"enUS\": \"Blade of the Old Religion\",\n",
+                u8"    \"zhTW\": \"古代宗教之刃\",\n",
+                u8"    \"deDE\": \"Klinge der alten Religion\",\n",
+                u8"    \"esES\": \"Daga de la Vieja Religión\",\n",
+                u8"    \"frFR\": \"Anciennes croyances\",\n",
+                u8"    \"itIT\": \"La lama dell'Antica Religione\",\n",
+                u8"    \"koKR\": \"옛 종교의 칼날\",\n",
+                u8"    \"plPL\": \"Ostrze Dawnej Religii\",\n",
+                u8"    \"esMX\": \"Puñal de la Vieja Religión\",\n",
+                u8"    \"jaJP\": \"古代宗教の儀礼剣\",\n",
+                u8"    \"ptBR\": \"A Lâmina da Velha Religião\",\n",
+                u8"    \"ruRU\": \"Клинок древней религии\",\n",
+                u8"    \"zhCN\": \"旧教之刃\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 933,\n",
+                u8"    \"Key\": \"qstsa3q4\",\n",
+                u8"    \"enUS\": \"The Golden Bird\",\n",
+                u8"    \"zhTW\": \"黃金鳥\",\n",
+                u8"    \"deDE\": \"Der goldene Vogel\",\n",
+                u8"    \"esES\": \"El pájaro dorado\",\n",
+                u8"    \"frFR\": \"L’Oiseau de Feu\",\n",
+                u8"    \"itIT\": \"L'Uccello d'Oro\",\n",
+                u8"    \"koKR\": \"황금 새\",\n",
+                u8"    \"plPL\": \"Złoty Ptak\",\n",
+                u8"    \"esMX\": \"El Pájaro Dorado\",\n",
+                u8"    \"jaJP\": \"黄金の鳥\",\n",
+                u8"    \"ptBR\": \"O Pássaro Dourado\",\n",
+                u8"    \"ruRU\": \"Золотая птица\",\n",
+                u8"    \"zhCN\": \"黄金鸟\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 934,\n",
+                u8"    \"Key\": \"qstsa3q5\",\n",
+                u8"    \"enUS\": \"The Blackened Temple\",\n",
+                u8"    \"zhTW\": \"晦影神殿\",\n",
+                u8"    \"deDE\": \"Der schwarze Tempel\",\n",
+                u8"    \"esES\": \"El Templo Ennegrecido\",\n",
+                u8"    \"frFR\": \"Le Temple noirci\",\n",
+                u8"    \"itIT\": \"Il tempio oscuro\",\n",
+                u8"    \"koKR\": \"검게 물든 사원\",\n",
+                u8"    \"plPL\": \"Poczerniała Świątynia\",\n",
+                u8"    \"esMX\": \"El Templo Corrupto\",\n",
+                u8"    \"jaJP\": \"穢れた神殿\",\n",
+                u8"    \"ptBR\": \"O Templo Corrompido\",\n",
+                u8"    \"ruRU\": \"Оскверненный храм\",\n",
+                u8"    \"zhCN\": \"黑化神殿\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 935,\n",
+                u8"    \"Key\": \"qstsa3q6\",\n",
+                u8"    \"enUS\": \"The Guardian\",\n",
+                u8"    \"zhTW\": \"守護者\",\n",
+                u8"    \"deDE\": \"Der Wächter\",\n",
+                u8"    \"esES\": \"El guardián\",\n",
+                u8"    \"frFR\": \"Le Gardien\",\n",
+                u8"    \"itIT\": \"Il guardiano\",\n",
+                u8"    \"koKR\": \"수호자\",\n",
+                u8"    \"plPL\": \"Strażnik\",\n",
+                u8"    \"esMX\": \"El Guardián\",\n",
+                u8"    \"jaJP\": \"守護者\",\n",
+                u8"    \"ptBR\": \"O Guardião\",\n",
+                u8"    \"ruRU\": \"Страж\",\n",
+                u8"    \"zhCN\": \"守护者\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 936,\n",
+                u8"    \"Key\": \"qstsa4q0\",\n",
+                u8"    \"enUS\": \"Act 4 Prologue\",\n",
+                u8"    \"zhTW\": \"第四章序幕\",\n",
+                u8"    \"deDE\": \"Akt 4 - Prolog\",\n",
+                u8"    \"esES\": \"Acto 4 Prólogo\",\n",
+                u8"    \"frFR\": \"Acte IV - Prologue\",\n",
+                u8"    \"itIT\": \"Atto 4, prologo\",\n",
+                u8"    \"koKR\": \"4막 프롤로그\",\n",
+                u8"    \"plPL\": \"Prolog Aktu IV\",\n",
+                u8"    \"esMX\": \"Acto 4 - Prólogo\",\n",
+                u8"    \"jaJP\": \"第4章 序幕\",\n",
+                u8"    \"ptBR\": \"Prólogo do Ato 4\",\n",
+                u8"    \"ruRU\": \"Акт 4 – пролог\",\n",
+                u8"    \"zhCN\": \"第四幕序章\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 937,\n",
+                u8"    \"Key\": \"qstsa4q1\",\n",
+                u8"    \"enUS\": \"The Fallen Angel\",\n",
+                u8"    \"zhTW\": \"墮落的天使\",\n",
+                u8"    \"deDE\": \"Der gefallene Engel\",\n",
+                u8"    \"esES\": \"El ángel caído\",\n",
+                u8"    \"frFR\": \"L’ange déchu\",\n",
+                u8"    \"itIT\": \"L'angelo caduto\",\n",
+                u8"    \"koKR\": \"타락 천사\",\n",
+                u8"    \"plPL\": \"Upadły anioł\",\n",
+                u8"    \"esMX\": \"El Ángel Caído\",\n",
+                u8"    \"jaJP\": \"堕天使\",\n",
+                u8"    \"ptBR\": \"O Anjo Decaído\",\n",
+                u8"    \"ruRU\": \"Падший ангел\",\n",
+                u8"    \"zhCN\": \"堕落天使\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 938,\n",
+                u8"    \"Key\": \"qstsa4q2\",\n",
+                u8"    \"enUS\": \"Terror's End\",\n",
+                u8"    \"zhTW\": \"恐懼的終結\",\n",
+                u8"    \"deDE\": \"Das Ende des Schreckens\",\n",
+                u8"    \"esES\": \"El fin del terror\",\n",
+                u8"    \"frFR\": \"Fin de la terreur\",\n",
+                u8"    \"itIT\": \"La fine del terrore\",\n",
+                u8"    \"koKR\": \"공포의 끝\",\n",
+                u8"    \"plPL\": \"Koniec Grozy\",\n",
+                u8"    \"esMX\": \"El Final del Terror\",\n",
+                u8"    \"jaJP\": \"恐怖の終わり\",\n",
+                u8"    \"ptBR\": \"O Fim do Medo\",\n",
+                u8"    \"ruRU\": \"Конец Ужаса\",\n",
+                u8"    \"zhCN\": \"恐惧的终结\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 939,\n",
+                u8"    \"Key\": \"qstsa4q3\",\n",
+                u8"    \"enUS\": \"Hell's Forge\",\n",
+                u8"    \"zhTW\": \"地獄熔爐\",\n",
+                u8"    \"deDE\": \"Höllenschmiede\",\n",
+                u8"    \"esES\": \"La Fragua del Infierno\",\n",
+                u8"    \"frFR\": \"La forge des Enfers\",\n",
+                u8"    \"itIT\": \"La Fornace Infernale\",\n",
+                u8"    \"koKR\": \"지옥의 대장간\",\n",
+                u8"    \"plPL\": \"Piekielna Kuźnia\",\n",
+                u8"    \"esMX\": \"Forja Infernal\",\n",
+                u8"    \"jaJP\": \"地獄の炉\",\n",
+                u8"    \"ptBR\": \"A Forja Infernal\",\n",
+                u8"    \"ruRU\": \"Кузня Преисподней\",\n",
+                u8"    \"zhCN\": \"地狱熔炉\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 940,\n",
+                u8"    \"Key\": \"qstsa2q01\",\n",
+                u8"    \"enUS\": \"Lut Gholein\",\n",
+                u8"    \"zhTW\": \"魯高因\",\n",
+                u8"    \"deDE\": \"Lut Gholein\",\n",
+                u8"    \"esES\": \"Lut Gholein\",\n",
+                u8"    \"frFR\": \"Lut Gholein\",\n",
+                u8"    \"itIT\": \"Lut Gholein\",\n",
+                u8"    \"koKR\": \"루트 골레인\",\n",
+                u8"    \"plPL\": \"Lut Gholein\",\n",
+                u8"    \"esMX\": \"Lut Gholein\",\n",
+                u8"    \"jaJP\": \"ラット・ゴーレイン\",\n",
+                u8"    \"ptBR\": \"Lut Gholein\",\n",
+                u8"    \"ruRU\": \"Лут Голейн\",\n",
+                u8"    \"zhCN\": \"鲁·高因\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 941,\n",
+                u8"    \"Key\": \"qstsa2q11\",\n",
+                u8"    \"enUS\": \"Find Radament's Lair in the Lut Gholein sewers.\",\n",
+                u8"    \"zhTW\": \"在魯高因的下水道中，找到羅達門特的巢穴。\",\n",
+                u8"    \"deDE\": \"Findet Radaments Lager in der Kanalisation von Lut Gholein.\",\n",
+                u8"    \"esES\": \"Encuentra el Cubil de Radament en las cloacas de Lut Gholein.\",\n",
+                u8"    \"frFR\": \"Trouvez le repaire de Radament dans les égouts de Lut Gholein.\",\n",
+                u8"    \"itIT\": \"Trova il rifugio di Radament nelle Fogne di Lut Gholein.\",\n",
+                u8"    \"koKR\": \"루트 골레인 하수도에서 라다먼트의 소굴을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź siedlisko Radamenta w kanałach Lut Gholein.\",\n",
+                u8"    \"esMX\": \"Encuentra la Guarida de Radament en las cloacas de Lut Gholein.\",\n",
+                u8"    \"jaJP\": \"ラット・ゴーレインの下水道で〈ラダメントの隠れ家〉を見つける。\",\n",
+                u8"    \"ptBR\": \"Encontre o Covil de Radament no esgoto de Lut Gholein.\",\n",
+                u8"    \"ruRU\": \"Найдите логово Радаманта в стоках Лут-Голейна.\",\n",
+                u8"    \"zhCN\": \"找到鲁·高因下水道中的罗达门特巢穴。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 942,\n",
+                u8"    \"Key\": \"qstsa2q12\",\n",
+                u8"    \"enUS\": \"Kill Radament.\",\n",
+                u8"    \"zhTW\": \"殺死羅達門特。\",\n",
+                u8"    \"deDE\": \"Tötet Radament.\",\n",
+                u8"    \"esES\": \"Mata a Radament.\",\n",
+                u8"    \"frFR\": \"Tuez Radament.\",\n",
+                u8"    \"itIT\": \"Uccidi Radament.\",\n",
+                u8"    \"koKR\": \"라다먼트를 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Radamenta.\",\n",
+                u8"    \"esMX\": \"Mata a Radament.\",\n",
+                u8"    \"jaJP\": \"ラダメントを倒す。\",\n",
+                u8"    \"ptBR\": \"Mate Radament.\",\n",
+                u8"    \"ruRU\": \"Убейте Радаманта.\",\n",
+                u8"    \"zhCN\": \"消灭罗达门特。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 943,\n",
+                u8"    \"Key\": \"qstsa2q13\",\n",
+                u8"    \"enUS\": \"Return to Atma for a reward.\",\n",
+                u8"    \"zhTW\": \"回去找亞特瑪領取獎勵。\",\n",
+                u8"    \"deDE\": \"Kehrt zu Atma zurück, um Eure Belohnung zu erhalten.\",\n",
+                u8"    \"esES\": \"Vuelve con Atma para recibir una recompensa.\",\n",
+                u8"    \"frFR\": \"Retournez auprès d’Atma pour recevoir votre récompense.\",\n",
+                u8"    \"itIT\": \"Torna da Atma per la ricompensa.\",\n",
+                u8"    \"koKR\": \"아트마에게 돌아가 보상을 받으십시오.\",\n",
+                u8"    \"plPL\": \"Wróć do Atmy po nagrodę.\",\n",
+                u8"    \"esMX\": \"Habla con Atma para recibir tu recompensa.\",\n",
+                u8"    \"jaJP\": \"アトマと会って報酬を受け取る。\",\n",
+                u8"    \"ptBR\": \"Volte até Atma para receber uma recompensa.\",\n",
+                u8"    \"ruRU\": \"Вернитесь к Атме за наградой.\",\n",
+                u8"    \"zhCN\": \"回去找阿特玛获得奖励。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 944,\n",
+                u8"    \"Key\": \"qstsa2q21\",\n",
+                u8"    \"enUS\": \"Show the scroll to Cain in Lut Gholein.\",\n",
+                u8"    \"zhTW\": \"把卷軸拿回魯高因給凱恩看看。\",\n",
+                u8"    \"deDE\": \"Zeigt Cain in Lut Gholein die Schriftrolle.\",\n",
+                u8"    \"esES\": \"Enséñale el pergamino a Caín en Lut Gholein.\",\n",
+                u8"    \"frFR\": \"Montrez le parchemin à Cain à Lut Gholein.\",\n",
+                u8"    \"itIT\": \"Porta la pergamena da Cain a Lut Gholein.\",\n",
+                u8"    \"koKR\": \"루트 골레인에서 케인에게 두루마리를 보여주십시오.\",\n",
+                u8"    \"plPL\": \"Pokaż zwój Cainowi w Lut Gholein.\",\n",
+                u8"    \"esMX\": \"Muéstrale el pergamino a Cain en Lut Gholein.\",\n",
+                u8"    \"jaJP\": \"ラット・ゴーレインでケインにホラドリムの巻物を見せる。\",\n",
+                u8"    \"ptBR\": \"Mostre o pergaminho a Cain em Lut Gholein.\",\n",
+                u8"    \"ruRU\": \"Покажите свиток Декарду Каину в Лут-Голейне.\",\n",
+                u8"    \"zhCN\": \"给在鲁·高因的凯恩展示卷轴。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 945,\n",
+                u8"    \"Key\": \"qstsa2q22\",\n",
+                u8"    \"enUS\": \"Search the Halls of the Dead under the Dry Hills for the Cube. Search the Maggot Lair under the Far Oasis for the Shaft. Search the Claw Viper Temple for the Headpiece.\",\n",
+                u8"    \"zhTW\": \"在乾土高地底下的死亡之殿尋找方塊，在遙遠的綠洲底下的蛆蟲巢穴尋找杖身，在利爪蛇魔神殿尋找杖頂。\",\n",
+                u8"    \"deDE\": \"Sucht in den Hallen der Toten unter den Verdorrten Hügeln nach dem Würfel, in der Wurmgruft unter der Fernen Oase nach dem Schaft und im Tempel der Klauenvipern nach der Spitze.\",\n",
+                u8"    \"esES\": \"Busca el cubo en las Salas de la Muerte, bajo las Colinas Áridas. Busca la vara en el Cubil de Gusanos, bajo el Oasis Lejano. Busca la empuñadura en el Templo de la Garra Viperina.\",\n",
+                u8"    \"frFR\": \"Le cube est dans les Couloirs des morts, sous les Collines arides. Le manche du Bâton est dans le Repaire du ver, sous l’Oasis lointaine et la partie supérieure dans le Temple des Vipères.\",\n",
+                u8"    \"itIT\": \"Cerca il Cubo nelle Sale dei Morti, sotto le Colline Aride. Cerca l'asta nel Covo delle Larve, sotto l'Oasi Lontana. Cerca la testa nel Tempio delle Vipere.\",\n",
+                u8"    \"koKR\": \"메마른 언덕 아래에 있는 망자의 전당에서 함을 찾으십시오. 머나먼 오아시스 아래에 있는 구더기 굴에서 자루를 찾으십시오. 발톱 독사 사원에서 꼭지를 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Przeszukaj Sale Umarłych pod Suchymi Wzgórzami w poszukiwaniu Kostki. Zbadaj Robacze Gniazdo w pobliżu Dalekiej Oazy, aby znaleźć trzonek kostura. Zwieńczenie znajdziesz w Świątyni Żmijoszponów.\",\n",
+                u8"    \"esMX\": \"Busca el Cubo en las Salas de la Muerte bajo las Colinas Áridas. Busca la Vara en la Guarida de Gusanos bajo el Oasis Lejano. Busca el Cabezal en el Templo del Vipérido de Garras.\",\n",
+                u8"    \"jaJP\": \"〈乾きの丘〉の地下にある〈亡者の広間〉を探索し、ホラドリムの〈キューブ〉を見つける。〈遥かなるオアシス〉の地下にある〈地虫の巣穴〉を探索し、ホラドリムの〈杖の柄〉を見つける。〈クロウ・ヴァイパーの寺院〉を探索し、ホラドリムの〈杖の頭部〉を見つける。\",\n",
+                u8"    \"ptBR\": \"Vasculhe os Salões dos Mortos debaixo das Colinas Áridas em busca do Cubo. Vasculhe o Covil de Vermes debaixo do Oásis Longínquo em busca da Haste. Vasculhe o Templo da Víbora da Garra em busca da Peça Superior.\",\n",
+                u8"    \"ruRU\": \"Найдите куб в Чертогах Мертвых под Иссохшими холмами, посох в логове мокриц под Дальним оазисом и наголовник в храме Когтистого Змея.\",\n",
+                u8"    \"zhCN\": \"在干燥高地的亡者大殿中寻找魔盒。在偏远绿洲地下的蛆虫巢穴中找到杖身。搜索利爪蝮蛇神殿寻找杖头。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 946,\n",
+                u8"    \"Key\": \"qstsa2q23\",\n",
+                u8"    \"enUS\": \"Use the Horadric Cube to restore the Staff.\",\n",
+                u8"    \"zhTW\": \"使用赫拉迪姆方塊使法杖復原。\",\n",
+                u8"    \"deDE\": \"Benutzt den Horadrimwürfel, um den Stab wiederherzustellen.\",\n",
+                u8"    \"esES\": \"Utiliza el cubo horádrico para arreglar el bastón.\",\n",
+                u8"    \"frFR\": \"Utilisez le Cube horadrique pour assembler le Bâton.\",\n",
+                u8"    \"itIT\": \"Usa il Cubo Horadrico per rimettere insieme la Verga.\",\n",
+                u8"    \"koKR\": \"호라드림의 함을 사용하여 지팡이를 복원하십시오.\",\n",
+                u8"    \"plPL\": \"Użyj Kostki Horadrimów, by odtworzyć kostur.\",\n",
+                u8"    \"esMX\": \"Usa el Cubo horádrico para restaurar el Bastón.\",\n",
+                u8"    \"jaJP\": \"〈ホラドリムのキューブ〉を使用して〈ホラドリムの杖〉を復元する。\",\n",
+                u8"    \"ptBR\": \"Use o Cubo Horádrico para restaurar o Cajado.\",\n",
+                u8"    \"ruRU\": \"Восстановите посох с помощью хорадримского куба.\",\n",
+                u8"    \"zhCN\": \"使用赫拉迪姆魔盒复原法杖。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 947,\n",
+                u8"    \"Key\": \"qstsa2q24\",\n",
+                u8"    \"enUS\": \"Take the Staff into Tal Rasha's Tomb.\",\n",
+                u8"    \"zhTW\": \"帶著法杖進入塔拉夏的古墓。\",\n",
+                u8"    \"deDE\": \"Bringt den Stab zu Tal Rashas Grab.\",\n",
+                u8"    \"esES\": \"Lleva el bastón a la Tumba de Tal Rasha.\",\n",
+                u8"    \"frFR\": \"Apportez le Bâton au Tombeau de Tal Rasha.\",\n",
+                u8"    \"itIT\": \"Porta la Verga nella Tomba di Tal Rasha.\",\n",
+                u8"    \"koKR\": \"지팡이를 탈 라샤의 무덤으로 가져가십시오.\",\n",
+                u8"    \"plPL\": \"Zanieś kostur do grobowca Tal Rashy.\",\n",
+                u8"    \"esMX\": \"Lleva el Bastón a la Tumba de Tal Rasha.\",\n",
+                u8"    \"jaJP\": \"タル・ラシャの墓に〈ホラドリムの杖〉を持っていく。\",\n",
+                u8"    \"ptBR\": \"Leve o Cajado até a Tumba de Tal Rasha.\",\n",
+                u8"    \"ruRU\": \"Отнесите посох в гробницу Тал Раши.\",\n",
+                u8"    \"zhCN\": \"带着法杖进入塔·拉夏之墓。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 948,\n",
+                u8"    \"Key\": \"qstsa2q25\",\n",
+                u8"    \"enUS\": \"Take the artifacts to Cain in Lut Gholein.\",\n",
+                u8"    \"zhTW\": \"把古物帶回去魯高因，拿給凱恩。\",\n",
+                u8"    \"deDE\": \"Bringt die Artfakte zu Cain in Lut Gholein.\",\n",
+                u8"    \"esES\": \"Llévale los artefactos a Caín en Lut Gholein.\",\n",
+                u8"    \"frFR\": \"Apportez les artéfacts à Cain à Lut Gholein.\",\n",
+                u8"    \"itIT\": \"Porta gli artefatti da Cain a Lut Gholein.\",\n",
+                u8"    \"koKR\": \"유물을 루트 골레인에 있는 케인에게 가져가십시오.\",\n",
+                u8"    \"plPL\": \"Zanieś artefakty do Caina w Lut Gholein.\",\n",
+                u8"    \"esMX\": \"Muéstrale los artefactos a Cain en Lut Gholein.\",\n",
+                u8"    \"jaJP\": \"ラット・ゴーレインにいるケインに遺物を持っていく。\",\n",
+                u8"    \"ptBR\": \"Leve os artefatos até Cain em Lut Gholein.\",\n",
+                u8"    \"ruRU\": \"Отнесите артефакты Декарду Каину в Лут-Голейн.\",\n",
+                u8"    \"zhCN\": \"将神器带给在鲁·高因的凯恩。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 949,\n",
+                u8"    \"Key\": \"qstsa2q31\",\n",
+                u8"    \"enUS\": \"Look for the source of the darkness.\",\n",
+                u8"    \"zhTW\": \"尋找黑暗的源頭。\",\n",
+                u8"    \"deDE\": \"Findet die Quelle der Dunkelheit.\",\n",
+                u8"    \"esES\": \"Busca el origen de la oscuridad.\",\n",
+                u8"    \"frFR\": \"Recherchez la source des ténèbres.\",\n",
+                u8"    \"itIT\": \"Cerca la fonte dell'oscurità.\",\n",
+                u8"    \"koKR\": \"어둠의 근원을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj źródła ciemności.\",\n",
+                u8"    \"esMX\": \"Busca el origen de la oscuridad.\",\n",
+                u8"    \"jaJP\": \"暗闇の原因を突き止める。\",\n",
+                u8"    \"ptBR\": \"Procure pela fonte da escuridão.\",\n",
+                u8"    \"ruRU\": \"Найдите источник загадочной тьмы.\",\n",
+                u8"    \"zhCN\": \"寻找黑暗的源头。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 950,\n",
+                u8"    \"Key\": \"qstsa2q31a\",\n",
+                u8"    \"enUS\": \"Ask Drognan about the strange darkness.\",\n",
+                u8"    \"zhTW\": \"問問卓格南對這片奇怪的黑暗有什麼看法。\",\n",
+                u8"    \"deDE\": \"Befragt Drognan zu der seltsamen Dunkelheit.\",\n",
+                u8"    \"esES\": \"Pregúntale a Drognan por la extraña oscuridad.\",\n",
+                u8"    \"frFR\": \"Questionnez Drognan sur ces mystérieuses ténèbres.\",\n",
+                u8"    \"itIT\": \"Chiedi a Drognan delle tenebre.\",\n",
+                u8"    \"koKR\": \"드로그난에게 이상한 어둠에 관해 물어보십시오.\",\n",
+                u8"    \"plPL\": \"Zapytaj Drognana o dziwną ciemność.\",\n",
+                u8"    \"esMX\": \"Pregúntale a Drognan acerca de la extraña oscuridad.\",\n",
+                u8"    \"jaJP\": \"不可解な暗闇についてドログナンに尋ねる。\",\n",
+                u8"    \"ptBR\": \"Pergunte a Drognan sobre a estranha escuridão.\",\n",
+                u8"    \"ruRU\": \"Расспросите Дрогнана о странном мраке.\",\n",
+                u8"    \"zhCN\": \"询问卓格楠关于天空突然变黑的事。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 951,\n",
+                u8"    \"Key\": \"qstsa2q32\",\n",
+                u8"    \"enUS\": \"Destroy the Serpent Altar in the Claw Viper Temple beneath the Valley of Snakes.\",\n",
+                u8"    \"zhTW\": \"前往群蛇峽谷底下的利爪蛇魔神殿，摧毀其中的祭壇。\",\n",
+                u8"    \"deDE\": \"Zerstört den Schlangenaltar im Tempel der Klauenvipern unter dem Tal der Schlangen.\",\n",
+                u8"    \"esES\": \"Destruye el altar de la serpiente en el Templo de la Garra Viperina, bajo el Valle de las Serpientes.\",\n",
+                u8"    \"frFR\": \"Détruisez l’Autel du serpent dans le Temple des Vipères, sous la Vallée des Serpents.\",\n",
+                u8"    \"itIT\": \"Distruggi l'altare nel Tempio delle Vipere, sotto la Valle dei Serpenti.\",\n",
+                u8"    \"koKR\": \"뱀의 골짜기 아래에 있는 발톱 독사 사원에서 뱀의 제단을 파괴하십시오.\",\n",
+                u8"    \"plPL\": \"Zniszcz ołtarz w Świątyni Żmijoszponów pod Doliną Węży.\",\n",
+                u8"    \"esMX\": \"Destruye el Altar serpentino en el Templo del Vipérido de Garras bajo el Valle de las Culebras.\",\n",
+                u8"    \"jaJP\": \"〈蛇の谷の〉近くにある〈クロウ・ヴァイパーの寺院〉で〈蛇の祭壇〉を破壊する。\",\n",
+                u8"    \"ptBR\": \"Destrua o Altar da Serpente no Templo da Víbora da Garra sob o Vale das Cobras.\",\n",
+                u8"    \"ruRU\": \"Уничтожьте алтарь в храме Когтистого Змея под Долиной змей.\",\n",
+                u8"    \"zhCN\": \"摧毁在群蛇峡谷地下的利爪蝮蛇神殿中的毒蛇祭坛。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 952,\n",
+                u8"    \"Key\": \"qstsa2q33\",\n",
+                u8"    \"enUS\": \"Speak with the townsfolk in Lut Gholein.\",\n",
+                u8"    \"zhTW\": \"和魯高因的居民談談。\",\n",
+                u8"    \"deDE\": \"Redet mit den Leuten in Lut Gholein.\",\n",
+                u8"    \"esES\": \"Habla con la gente de Lut Gholein.\",\n",
+                u8"    \"frFR\": \"Parlez avec les villageois de Lut Gholein.\",\n",
+                u8"    \"itIT\": \"Parla con i cittadini di Lut Gholein.\",\n",
+                u8"    \"koKR\": \"루트 골레인의 주민들과 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z mieszkańcami Lut Gholein.\",\n",
+                u8"    \"esMX\": \"Habla con los habitantes de Lut Gholein.\",\n",
+                u8"    \"jaJP\": \"ラット・ゴーレインの住民と話す。\",\n",
+                u8"    \"ptBR\": \"Fale com a população em Lut Gholein.\",\n",
+                u8"    \"ruRU\": \"Поговорите с жителями Лут-Голейна.\",\n",
+                u8"    \"zhCN\": \"与鲁·高因的居民们谈谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 953,\n",
+                u8"    \"Key\": \"qstsa2q41\",\n",
+                u8"    \"enUS\": \"Look for the Arcane Sanctuary within the Palace.\",\n",
+                u8"    \"zhTW\": \"到皇宮中尋找秘法聖殿。\",\n",
+                u8"    \"deDE\": \"Sucht im Palast nach der Geheimen Zuflucht.\",\n",
+                u8"    \"esES\": \"Busca el Santuario Arcano dentro del palacio.\",\n",
+                u8"    \"frFR\": \"Recherchez le Sanctuaire des Arcanes dans le Palais.\",\n",
+                u8"    \"itIT\": \"Cerca il Santuario Arcano all'interno del palazzo.\",\n",
+                u8"    \"koKR\": \"궁전 내 비전의 성역을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj Tajemnego Sanktuarium w Pałacu.\",\n",
+                u8"    \"esMX\": \"Busca el Santuario Arcano dentro del Palacio.\",\n",
+                u8"    \"jaJP\": \"宮殿内で〈深遠なる聖域〉を探す。\",\n",
+                u8"    \"ptBR\": \"Procure pelo Santuário Arcano no Palácio.\",\n",
+                u8"    \"ruRU\": \"Поищите Магическое убежище во дворце.\",\n",
+                u8"    \"zhCN\": \"在王宫中寻找神秘避难所。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 954,\n",
+                u8"    \"Key\": \"qstsa2q41a\",\n",
+                u8"    \"enUS\": \"Talk to Drognan.\",\n",
+                u8"    \"zhTW\": \"與卓格南交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Drognan.\",\n",
+                u8"    \"esES\": \"Habla con Drognan.\",\n",
+                u8"    \"frFR\": \"Parlez à Drognan.\",\n",
+                u8"    \"itIT\": \"Parla con Drognan.\",\n",
+                u8"    \"koKR\": \"드로그난과 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Drognanem.\",\n",
+                u8"    \"esMX\": \"Habla con Drognan.\",\n",
+                u8"    \"jaJP\": \"ドログナンと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Drognan.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Дрогнаном.\",\n",
+                u8"    \"zhCN\": \"与卓格楠交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 955,\n",
+                u8"    \"Key\": \"qstsa2q42\",\n",
+                u8"    \"enUS\": \"Find Horazon's Journal.\",\n",
+                u8"    \"zhTW\": \"找出赫拉森的日誌。\",\n",
+                u8"    \"deDE\": \"Findet Horazons Tagebuch.\",\n",
+                u8"    \"esES\": \"Encuentra el diario de Horazón.\",\n",
+                u8"    \"frFR\": \"Trouvez le Journal d’Horazon.\",\n",
+                u8"    \"itIT\": \"Trova il Diario di Horazon.\",\n",
+                u8"    \"koKR\": \"호라존의 일지를 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź Dziennik Horazona.\",\n",
+                u8"    \"esMX\": \"Encuentra el Diario de Horazon.\",\n",
+                u8"    \"jaJP\": \"〈ホラゾンの日記〉を探す。\",\n",
+                u8"    \"ptBR\": \"Encontre o Diário de Horazon.\",\n",
+                u8"    \"ruRU\": \"Найдите дневник Хоразона.\",\n",
+                u8"    \"zhCN\": \"找到霍拉松的日志。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 956,\n",
+                u8"    \"Key\": \"qstsa2q43\",\n",
+                u8"    \"enUS\": \"Continue the search for the Seventh Tomb.\",\n",
+                u8"    \"zhTW\": \"繼續尋找第七個古墓。\",\n",
+                u8"    \"deDE\": \"Sucht weiter nach dem siebten Grab.\",\n",
+                u8"    \"esES\": \"Continúa buscando la séptima tumba.\",\n",
+                u8"    \"frFR\": \"Continuez à chercher le septième Tombeau.\",\n",
+                u8"    \"itIT\": \"Continua a cercare la settima tomba.\",\n",
+                u8"    \"koKR\": \"계속해서 일곱 번째 무덤을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Kontynuuj poszukiwania Siódmego Grobowca.\",\n",
+                u8"    \"esMX\": \"Continúa la búsqueda de la Séptima tumba.\",\n",
+                u8"    \"jaJP\": \"第7の墓の捜索を続行する。\",\n",
+                u8"    \"ptBR\": \"Continue a busca pela Sétima Tumba.\",\n",
+                u8"    \"ruRU\": \"Продолжите поиски Седьмой гробницы.\",\n",
+                u8"    \"zhCN\": \"继续搜索第七座古墓。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 957,\n",
+                u8"    \"Key\": \"qstsa2q51\",\n",
+                u8"    \"enUS\": \"Beware the Summoner.\",\n",
+                u8"    \"zhTW\": \"小心召喚師。\",\n",
+                u8"    \"deDE\": \"Hütet Euch vor dem Geisterbeschwörer.\",\n",
+                u8"    \"esES\": \"Ten cuidado con el Invocador.\",\n",
+                u8"    \"frFR\": \"Attention à l’Invocateur.\",\n",
+                u8"    \"itIT\": \"Fai attenzione all'Evocatore.\",\n",
+                u8"    \"koKR\": \"소환사를 조심하십시오.\",\n",
+                u8"    \"plPL\": \"Strzeż się Demonologa.\",\n",
+                u8"    \"esMX\": \"Ten cuidado con El Invocador.\",\n",
+                u8"    \"jaJP\": \"召喚師に警戒する。\",\n",
+                u8"    \"ptBR\": \"Cuidado com o Evocador.\",\n",
+                u8"    \"ruRU\": \"Остерегайтесь Призывателя.\",\n",
+                u8"    \"zhCN\": \"小心召唤者。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 958,\n",
+                u8"    \"Key\": \"qstsa2q52\",\n",
+                u8"    \"enUS\": \"Kill the Summoner.\",\n",
+                u8"    \"zhTW\": \"殺死召喚師。\",\n",
+                u8"    \"deDE\": \"Tötet den Geisterbeschwörer.\",\n",
+                u8"    \"esES\": \"Mata al Invocador.\",\n",
+                u8"    \"frFR\": \"Tuez l’Invocateur.\",\n",
+                u8"    \"itIT\": \"Uccidi l'Evocatore.\",\n",
+                u8"    \"koKR\": \"소환사를 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Demonologa.\",\n",
+                u8"    \"esMX\": \"Mata al Invocador.\",\n",
+                u8"    \"jaJP\": \"召喚師を倒す。\",\n",
+                u8"    \"ptBR\": \"Mate o Evocador.\",\n",
+                u8"    \"ruRU\": \"Убейте Призывателя.\",\n",
+                u8"    \"zhCN\": \"消灭召唤者。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 959,\n",
+                u8"    \"Key\": \"qstsa2q53\",\n",
+                u8"    \"enUS\": \"Return to town for more information.\",\n",
+                u8"    \"zhTW\": \"回到城鎮打聽更多消息。\",\n",
+                u8"    \"deDE\": \"Kehrt zur Stadt zurück, um weitere Informationen zu erhalten.\",\n",
+                u8"    \"esES\": \"Vuelve a la ciudad a por más información.\",\n",
+                u8"    \"frFR\": \"Retournez en ville pour y quérir de nouvelles informations.\",\n",
+                u8"    \"itIT\": \"Torna in città per trovare altre informazioni.\",\n",
+                u8"    \"koKR\": \"마을로 돌아가 자세한 정보를 확인하십시오.\",\n",
+                u8"    \"plPL\": \"Wróć do miasta po nowe informacje.\",\n",
+                u8"    \"esMX\": \"Regresa al poblado para obtener más información.\",\n",
+                u8"    \"jaJP\": \"街に戻って情報を集める。\",\n",
+                u8"    \"ptBR\": \"Volte à cidade para obter mais informações.\",\n",
+                u8"    \"ruRU\": \"Вернитесь в город и постарайтесь что-нибудь узнать.\",\n",
+                u8"    \"zhCN\": \"回到城里打探更多消息。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 960,\n",
+                u8"    \"Key\": \"qstsa2q61\",\n",
+                u8"    \"enUS\": \"Find Tal Rasha's Tomb.\",\n",
+                u8"    \"zhTW\": \"找出塔拉夏的古墓。\",\n",
+                u8"    \"deDE\": \"Findet Tal Rashas Grab.\",\n",
+                u8"    \"esES\": \"Encuentra la Tumba de Tal Rasha.\",\n",
+                u8"    \"frFR\": \"Trouvez le Tombeau de Tal Rasha.\",\n",
+                u8"    \"itIT\": \"Trova la Tomba di Tal Rasha.\",\n",
+                u8"    \"koKR\": \"탈 라샤의 무덤을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź grobowiec Tal Rashy.\",\n",
+                u8"    \"esMX\": \"Encuentra la Tumba de Tal Rasha.\",\n",
+                u8"    \"jaJP\": \"〈タル・ラシャの墓〉を探す。\",\n",
+                u8"    \"ptBR\": \"Encontre a Tumba de Tal Rasha.\",\n",
+                u8"    \"ruRU\": \"Найдите гробницу Тал Раши.\",\n",
+                u8"    \"zhCN\": \"找到塔·拉夏之墓。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 961,\n",
+                u8"    \"Key\": \"qstsa2q61a\",\n",
+                u8"    \"enUS\": \"The Symbol of the True Tomb of Tal Rasha.\",\n",
+                u8"    \"zhTW\": \"塔拉夏真正的古墓標有此符號。\",\n",
+                u8"    \"deDE\": \"Das Symbol des wahren Grabes von Tal Rasha.\",\n",
+                u8"    \"esES\": \"El símbolo de la verdadera Tumba de Tal Rasha.\",\n",
+                u8"    \"frFR\": \"Le symbole du Vrai Tombeau de Tal Rasha.\",\n",
+                u8"    \"itIT\": \"Il simbolo della vera Tomba di Tal Rasha.\",\n",
+                u8"    \"koKR\": \"탈 라샤의 진정한 무덤의 상징입니다.\",\n",
+                u8"    \"plPL\": \"Symbol prawdziwego grobowca Tal Rashy.\",\n",
+                u8"    \"esMX\": \"El símbolo de la verdadera Tumba de Tal Rasha.\",\n",
+                u8"    \"jaJP\": \"〈真のタル・ラシャの墓〉を示す刻印。\",\n",
+                u8"    \"ptBR\": \"O Símbolo da Verdadeira Tumba de Tal Rasha.\",\n",
+                u8"    \"ruRU\": \"Знак истинной гробницы Тал Раши.\",\n",
+                u8"    \"zhCN\": \"塔·拉夏真墓的符号。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 962,\n",
+                u8"    \"Key\": \"qstsa2q62\",\n",
+                u8"    \"enUS\": \"Kill Duriel.\",\n",
+                u8"    \"zhTW\": \"殺死都瑞爾。\",\n",
+                u8"    \"deDE\": \"Tötet Duriel.\",\n",
+                u8"    \"esES\": \"Mata a Duriel.\",\n",
+                u8"    \"frFR\": \"Tuez Duriel.\",\n",
+                u8"    \"itIT\": \"Uccidi Duriel.\",\n",
+                u8"    \"koKR\": \"두리엘을 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Duriela.\",\n",
+                u8"    \"esMX\": \"Mata a Duriel.\",\n",
+                u8"    \"jaJP\": \"デュリエルを倒す。\",\n",
+                u8"    \"ptBR\": \"Mate Duriel.\",\n",
+                u8"    \"ruRU\": \"Убейте Дюриэля.\",\n",
+                u8"    \"zhCN\": \"消灭督瑞尔。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 963,\n",
+                u8"    \"Key\": \"qstsa2q63\",\n",
+                u8"    \"enUS\": \"Explore Tal Rasha'a Chamber.\",\n",
+                u8"    \"zhTW\": \"探索塔拉夏的房間。\",\n",
+                u8"    \"deDE\": \"Erforscht Tal Rashas Kammer.\",\n",
+                u8"    \"esES\": \"Explora la cámara de Tal Rasha.\",\n",
+                u8"    \"frFR\": \"Explorez la Chambre de Tal Rasha.\",\n",
+                u8"    \"itIT\": \"Esplora la Cripta di Tal Rasha.\",\n",
+                u8"    \"koKR\": \"탈 라샤의 방을 탐험하십시오.\",\n",
+                u8"    \"plPL\": \"Przeszukaj Komnatę Tal Rashy.\",\n",
+                u8"    \"esMX\": \"Explora la Cámara de Tal Rasha.\",\n",
+                u8"    \"jaJP\": \"〈タル・ラシャの間〉を調査する。\",\n",
+                u8"    \"ptBR\": \"Explore a Câmara de Tal Rasha.\",\n",
+                u8"    \"ruRU\": \"Исследуйте погребальный зал Тал Раши.\",\n",
+                u8"    \"zhCN\": \"探索塔·拉夏的墓室。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 964,\n",
+                u8"    \"Key\": \"qstsa2q63a\",\n",
+                u8"    \"enUS\": \"Talk to Jerhyn.\",\n",
+                u8"    \"zhTW\": \"與傑恩交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Jerhyn.\",\n",
+                u8"    \"esES\": \"Habla con Jerhyn.\",\n",
+                u8"    \"frFR\": \"Parlez à Jerhyn.\",\n",
+                u8"    \"itIT\": \"Parla con Jerhyn.\",\n",
+                u8"    \"koKR\": \"제르힌과 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Jerhynem.\",\n",
+                u8"    \"esMX\": \"Habla con Jerhyn.\",\n",
+                u8"    \"jaJP\": \"ジェランと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Jerrin.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Джерхином.\",\n",
+                u8"    \"zhCN\": \"与耶尔辛交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 965,\n",
+                u8"    \"Key\": \"qstsa2q64\",\n",
+                u8"    \"enUS\": \"Talk to Jerhyn.\",\n",
+                u8"    \"zhTW\": \"與傑恩交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Jerhyn.\",\n",
+                u8"    \"esES\": \"Habla con Jerhyn.\",\n",
+                u8"    \"frFR\": \"Parlez à Jerhyn.\",\n",
+                u8"    \"itIT\": \"Parla con Jerhyn.\",\n",
+                u8"    \"koKR\": \"제르힌과 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Jerhynem.\",\n",
+                u8"    \"esMX\": \"Habla con Jerhyn.\",\n",
+                u8"    \"jaJP\": \"ジェランと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Jerrin.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Джерхином.\",\n",
+                u8"    \"zhCN\": \"与耶尔辛交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 966,\n",
+                u8"    \"Key\": \"qstsa2q65\",\n",
+                u8"    \"enUS\": \"Talk to Meshif.\",\n",
+                u8"    \"zhTW\": \"與馬席夫交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Meschif.\",\n",
+                u8"    \"esES\": \"Habla con Meshif.\",\n",
+                u8"    \"frFR\": \"Parlez à Meshif.\",\n",
+                u8"    \"itIT\": \"Parla con Meshif.\",\n",
+                u8"    \"koKR\": \"메시프와 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Meshifem.\",\n",
+                u8"    \"esMX\": \"Habla con Meshif.\",\n",
+                u8"    \"jaJP\": \"メシーフと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Meshif.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Месхифом.\",\n",
+                u8"    \"zhCN\": \"与梅席夫交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 967,\n",
+                u8"    \"Key\": \"qstsa3q01\",\n",
+                u8"    \"enUS\": \"Jungle Village\",\n",
+                u8"    \"zhTW\": \"叢林村落\",\n",
+                u8"    \"deDE\": \"Dschungeldorf\",\n",
+                u8"    \"esES\": \"Pueblo de la selva\",\n",
+                u8"    \"frFR\": \"Village de la jungle\",\n",
+                u8"    \"itIT\": \"Villaggio nella giungla\",\n",
+                u8"    \"koKR\": \"밀림 마을\",\n",
+                u8"    \"plPL\": \"Wioska w dżungli\",\n",
+                u8"    \"esMX\": \"Pueblo de la selva\",\n",
+                u8"    \"jaJP\": \"密林の村\",\n",
+                u8"    \"ptBR\": \"Vilarejo da Selva\",\n",
+                u8"    \"ruRU\": \"Деревня в джунглях\",\n",
+                u8"    \"zhCN\": \"丛林村\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 968,\n",
+                u8"    \"Key\": \"qstsa3q11\",\n",
+                u8"    \"enUS\": \"Search the six temples in the Bazaar, Upper Kurast, and the Causeway for Lam Esen's Tome.\",\n",
+                u8"    \"zhTW\": \"在庫拉斯特市集、庫拉斯特上層，和庫拉斯特堤道的六座神殿中，尋找藍伊森之書。\",\n",
+                u8"    \"deDE\": \"Durchsucht die sechs Tempel im Basar, Oberkurast und den Damm nach Lam Esens Folianten.\",\n",
+                u8"    \"esES\": \"Busca el tomo de Lam Esen en los seis templos del Bazar, la Parte Alta y la Calzada de Kurast.\",\n",
+                u8"    \"frFR\": \"Recherchez le livre de Lam Esen dans les six temples du Bazar de la ville haute de Kurast et sur la Chaussée.\",\n",
+                u8"    \"itIT\": \"Trova il Tomo di Lam Esen in uno dei sei templi al Bazar di Kurast, a Kurast Superiore e sulla Strada per Kurast.\",\n",
+                u8"    \"koKR\": \"시장, 상부 쿠라스트, 둑길에 있는 사원 여섯 개에서 람 에센의 고서를 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Przeszukaj sześć świątyń na Bazarze, w Górnym Kurast i na Grobli w poszukiwaniu księgi Lama Esena.\",\n",
+                u8"    \"esMX\": \"Busca el Tomo de Lam Esen en los seis templos en el Bazar, en Alta Kurast y en la Calzada.\",\n",
+                u8"    \"jaJP\": \"〈クラスト・バザール〉、〈クラスト上層〉、〈クラスト舗道〉で六つの寺院を探索し、〈ラム・エセンの書〉を見つける。\",\n",
+                u8"    \"ptBR\": \"Vasculhe os seis templos no Bazar, Kurast Superior e na Passagem em busca do Tomo de Lam Esen.\",\n",
+                u8"    \"ruRU\": \"Найдите фолиант Лам Эсена в одном из шести храмов на базаре Верхнего Кураста или в затопленном ходе.\",\n",
+                u8"    \"zhCN\": \"在库拉斯特集市、库拉斯特上层区和库拉斯特堤道的六个神殿中寻找兰姆·艾森之书。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 969,\n",
+                u8"    \"Key\": \"qstsa3q12\",\n",
+                u8"    \"enUS\": \"Talk to Alkor.\",\n",
+                u8"    \"zhTW\": \"與艾柯交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Alkor.\",\n",
+                u8"    \"esES\": \"Habla con Alkor.\",\n",
+                u8"    \"frFR\": \"Parlez à Alkor.\",\n",
+                u8"    \"itIT\": \"Parla con Alkor.\",\n",
+                u8"    \"koKR\": \"알코어와 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Alkorem\",\n",
+                u8"    \"esMX\": \"Habla con Alkor.\",\n",
+                u8"    \"jaJP\": \"アルコルと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Alkor.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Алькором.\",\n",
+                u8"    \"zhCN\": \"与奥科交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 970,\n",
+                u8"    \"Key\": \"qstsa3q21\",\n",
+                u8"    \"enUS\": \"Find Khalim's relics. Search for his Eye in the Spider Cavern.\",\n",
+                u8"    \"zhTW\": \"找出克林姆的聖遺物。在蜘蛛洞窟中尋找他的眼球。\",\n",
+                u8"    \"deDE\": \"Findet Khalims Relikte. Sucht in der Spinnenhöhle nach seinem Auge.\",\n",
+                u8"    \"esES\": \"Encuentra las reliquias de Khalim. Busca su ojo en la Caverna de Arañas.\",\n",
+                u8"    \"frFR\": \"Trouvez les reliques de Khalim. Son Œil serait dans la Caverne de l’Araignée.\",\n",
+                u8"    \"itIT\": \"Trova le reliquie di Khalim. Cerca l'Occhio nella Caverna del Ragno.\",\n",
+                u8"    \"koKR\": \"칼림의 유물을 찾으십시오. 거미 동굴에서 그의 눈을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź relikty Khalima. Poszukaj jego Oka w Grocie Pająków.\",\n",
+                u8"    \"esMX\": \"Encuentra las reliquias de Khalim. Busca su Ojo en la Caverna de Arañas.\",\n",
+                u8"    \"jaJP\": \"カリムの遺物を見つける。〈蜘蛛の洞窟〉で〈カリムの目〉を探す。\",\n",
+                u8"    \"ptBR\": \"Encontre as relíquias de Khalim. Procure pelo Olho dele na Caverna Aracnídea.\",\n",
+                u8"    \"ruRU\": \"Найдите останки Халима. Поищите его глаз в Паучьей пещере.\",\n",
+                u8"    \"zhCN\": \"找到卡林姆的遗物。在蜘蛛洞穴中寻找他的眼球。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 971,\n",
+                u8"    \"Key\": \"qstsa3q22\",\n",
+                u8"    \"enUS\": \"Search for Khalim's Brain in the Flayer Dungeon.\",\n",
+                u8"    \"zhTW\": \"在剝皮地牢中找出克林姆的大腦。\",\n",
+                u8"    \"deDE\": \"Sucht im Schinderdungeon nach Khalims Gehirn.\",\n",
+                u8"    \"esES\": \"Busca el cerebro de Khalim en la Mazmorra de Desollamiento.\",\n",
+                u8"    \"frFR\": \"Cherchez le Cerveau de Khalim dans la Prison de l’Écorcheur.\",\n",
+                u8"    \"itIT\": \"Cerca il Cervello di Khalim nel Sotterraneo Scorticatore.\",\n",
+                u8"    \"koKR\": \"약탈자 소굴에서 칼림의 뇌를 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj Mózgu Khalima w Podziemiach Łupieżców.\",\n",
+                u8"    \"esMX\": \"Busca el Cerebro de Khalim en el Calabozo de los Desolladores.\",\n",
+                u8"    \"jaJP\": \"〈フレイヤーの地下牢〉で〈カリムの脳〉を見つける。\",\n",
+                u8"    \"ptBR\": \"Procure pelo Cérebro de Khalim na Masmorra dos Esfoladores.\",\n",
+                u8"    \"ruRU\": \"Поищите мозг Халима в Подземелье свежевателей.\",\n",
+                u8"    \"zhCN\": \"在剥皮魔监牢中寻找卡林姆的大脑。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 972,\n",
+                u8"    \"Key\": \"qstsa3q23\",\n",
+                u8"    \"enUS\": \"Search for Khalim's Flail in Travincal. Beware the High Council.\",\n",
+                u8"    \"zhTW\": \"在崔凡克找出克林姆的連枷。小心最高議會。\",\n",
+                u8"    \"deDE\": \"Sucht in Travincal nach Khalims Kultflegel. Hütet Euch vor dem Hohen Rat.\",\n",
+                u8"    \"esES\": \"Busca el rompecabezas de Khalim en Travincal. Ten cuidado con el Gran Consejo.\",\n",
+                u8"    \"frFR\": \"Cherchez le Fléau de Khalim à Travincal. Faites attention au Grand Conseil.\",\n",
+                u8"    \"itIT\": \"Cerca il Flagello di Khalim a Travincal. Fai attenzione all'Alto Concilio.\",\n",
+                u8"    \"koKR\": \"트라빈칼에서 칼림의 도리깨를 찾으십시오. 대의회를 조심하십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj Korbacza Khalima w Travincal. Strzeż się Wysokiej Rady.\",\n",
+                u8"    \"esMX\": \"Busca el Mangual de Khalim en Travincal. Ten cuidado con el Concilio Superior.\",\n",
+                u8"    \"jaJP\": \"トラヴィンカルで〈カリムのフレイル〉を見つける。高等評議会に注意せよ。\",\n",
+                u8"    \"ptBR\": \"Procure pelo Mangual de Khalim em Travincal. Cuidado com o Alto Conselho.\",\n",
+                u8"    \"ruRU\": \"Найдите кистень Халима в Травинкале. Опасайтесь Верховного совета.\",\n",
+                u8"    \"zhCN\": \"在崔凡克寻找卡林姆的连枷。当心高庭理事会。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 973,\n",
+                u8"    \"Key\": \"qstsa3q24\",\n",
+                u8"    \"enUS\": \"Search for Khalim's Heart in the Sewers under the Kurast Bazaar.\",\n",
+                u8"    \"zhTW\": \"在庫拉斯特市集底下的下水道中，尋找克林姆的心臟。\",\n",
+                u8"    \"deDE\": \"Sucht in der Kanalisation unter dem Basar von Kurast nach Khalims Herz.\",\n",
+                u8"    \"esES\": \"Busca el corazón de Khalim en las Cloacas, bajo el Bazar de Kurast.\",\n",
+                u8"    \"frFR\": \"Cherchez le Cœur de Khalim dans les Égouts sous le Bazar de Kurast.\",\n",
+                u8"    \"itIT\": \"Cerca il Cuore di Khalim nelle Fogne, sotto il Bazar di Kurast.\",\n",
+                u8"    \"koKR\": \"쿠라스트 시장 아래의 하수도에서 칼림의 심장을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj Serca Khalima w Kanałach pod Bazarem Kurast.\",\n",
+                u8"    \"esMX\": \"Busca el Corazón de Khalim en las Cloacas bajo el Bazar de Kurast.\",\n",
+                u8"    \"jaJP\": \"〈クラスト・バザール〉の下水道で〈カリムの心臓〉を見つける。\",\n",
+                u8"    \"ptBR\": \"Procure pelo Coração de Khalim no Esgoto debaixo do Bazar de Kurast.\",\n",
+                u8"    \"ruRU\": \"Поищите сердце Халима в стоках под Курастским базаром.\",\n",
+                u8"    \"zhCN\": \"在库拉斯特集市的下水道里寻找卡林姆的心脏。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 974,\n",
+                u8"    \"Key\": \"qstsa3q25\",\n",
+                u8"    \"enUS\": \"Transmute Khalim's relics - the Flail, Eye, Heart, and Brain - with the Horadric Cube.\",\n",
+                u8"    \"zhTW\": \"使用赫拉迪姆方塊轉換克林姆的聖遺物：連枷、眼球、心臟，還有大腦。\",\n",
+                u8"    \"deDE\": \"Verwandelt Khalims Relikte - den Kultflegel, das Auge, das Herz und das Gehirn - mit Hilfe des Horadrimwürfels.\",\n",
+                u8"    \"esES\": \"Transmuta las reliquias de Khalim (el rompecabezas, el ojo, el corazón y el cerebro) con el cubo horádrico.\",\n",
+                u8"    \"frFR\": \"Transmutez les reliques de Khalim - le Fléau, l’Œil, le Cœur et le Cerveau - à l’aide du Cube horadrique.\",\n",
+                u8"    \"itIT\": \"Trasmuta il Flagello, l'Occhio, il Cuore e il Cervello di Khalim con il Cubo Horadrico.\",\n",
+                u8"    \"koKR\": \"호라드림의 함으로 도리깨, 눈, 심장, 뇌 등 칼림의 유물을 변환하십시오.\",\n",
+                u8"    \"plPL\": \"Dokonaj transmutacji reliktów Khalima – Korbacza, Oka, Serca i Mózgu – w Kostce Horadrimów.\",\n",
+                u8"    \"esMX\": \"Transmuta las reliquias de Khalim: el Mangual, el Ojo, el Corazón y el Cerebro con el Cubo horádrico.\",\n",
+                u8"    \"jaJP\": \"カリムの遺物であるフレイル、目、心臓、脳を〈ホラドリムのキューブ〉で合成する。\",\n",
+                u8"    \"ptBR\": \"Transmute as relíquias de Khalim (Mangual, Olho, Coração e Cérebro) com o Cubo Horádrico.\",\n",
+                u8"    \"ruRU\": \"Преобразуйте останки Халима – кистень, глаз, сердце и мозг – с помощью хорадримского куба.\",\n",
+                u8"    \"zhCN\": \"使用赫拉迪姆魔盒重塑卡林姆的遗物——连枷、眼球、心脏和大脑。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 975,\n",
+                u8"    \"Key\": \"qstsa3q26\",\n",
+                u8"    \"enUS\": \"Use Khalim's Will to smash the Compelling Orb.\",\n",
+                u8"    \"zhTW\": \"利用克林姆的遺願摧毀強制魔珠。\",\n",
+                u8"    \"deDE\": \"Benutzt Khalims Willen, um die Hypnotische Kugel zu zerschmettern.\",\n",
+                u8"    \"esES\": \"Utiliza la voluntad de Khalim para aplastar el Orbe Impositor.\",\n",
+                u8"    \"frFR\": \"Utilisez la Volonté de Khalim pour détruire l’Orbe d’envoûtement.\",\n",
+                u8"    \"itIT\": \"Usa la Volontà di Khalim per distruggere la Sfera del Dominio.\",\n",
+                u8"    \"koKR\": \"칼림의 의지를 사용하여 유혹의 보주를 파괴하십시오.\",\n",
+                u8"    \"plPL\": \"Użyj Woli Khalima, by rozbić Kulę Zniewolenia.\",\n",
+                u8"    \"esMX\": \"Usa la Voluntad de Khalim para destrozar el Orbe cautivante.\",\n",
+                u8"    \"jaJP\": \"〈カリムの意志〉を使って〈支配のオーブ〉を破壊する。\",\n",
+                u8"    \"ptBR\": \"Use a Vontade de Khalim para esmagar o Orbe Dominador.\",\n",
+                u8"    \"ruRU\": \"Разрушьте Сферу Подчинения с помощью Воли Халима.\",\n",
+                u8"    \"zhCN\": \"使用卡林姆的意志粉碎强迫之球。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 976,\n",
+                u8"    \"Key\": \"qstsa3q21a\",\n",
+                u8"    \"enUS\": \"Ask Cain about Khalim's relics.\",\n",
+                u8"    \"zhTW\": \"詢問凱恩關於克林姆的遺物的事情。\",\n",
+                u8"    \"deDE\": \"Fragt Cain nach Khalims Relikten.\",\n",
+                u8"    \"esES\": \"Pregúntale a Caín por las reliquias de Khalim.\",\n",
+                u8"    \"frFR\": \"Demandez à Cain qu’il vous parle des reliques de Khalim.\",\n",
+                u8"    \"itIT\": \"Chiedi a Cain delle reliquie di Khalim.\",\n",
+                u8"    \"koKR\": \"케인에게 칼림의 유물에 관해 물어보십시오.\",\n",
+                u8"    \"plPL\": \"Wypytaj Caina o relikty Khalima.\",\n",
+                u8"    \"esMX\": \"Pregúntale a Cain acerca de las reliquias de Khalim.\",\n",
+                u8"    \"jaJP\": \"カリムの遺物についてケインに尋ねる。\",\n",
+                u8"    \"ptBR\": \"Pergunte a Cain sobre as relíquias de Khalim.\",\n",
+                u8"    \"ruRU\": \"Расспросите Каина о реликвиях Халима.\",\n",
+                u8"    \"zhCN\": \"询问凯恩关于卡林姆遗物的事情。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 977,\n",
+                u8"    \"Key\": \"qstsa3q31\",\n",
+                u8"    \"enUS\": \"Look for the Gidbinn in the Flayer Jungle.\",\n",
+                u8"    \"zhTW\": \"在剝皮叢林中尋找吉德賓。\",\n",
+                u8"    \"deDE\": \"Findet den Gidbinn im Schinderdschungel.\",\n",
+                u8"    \"esES\": \"Busca la Gidbinn en la Selva Desolladora.\",\n",
+                u8"    \"frFR\": \"Recherchez le Gidbinn dans la jungle de l’Écorcheur.\",\n",
+                u8"    \"itIT\": \"Cerca il Gidbinn nella Giungla Scorticatrice.\",\n",
+                u8"    \"koKR\": \"약탈자 밀림에서 기드빈을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj Gidbinna w Dżungli Łupieżców.\",\n",
+                u8"    \"esMX\": \"Busca la Gidbinn en la Jungla de los Desolladores.\",\n",
+                u8"    \"jaJP\": \"〈フレイヤーの密林〉で〈ギドビン〉を探す。\",\n",
+                u8"    \"ptBR\": \"Procure pela Gidbinn na Selva dos Esfoladores.\",\n",
+                u8"    \"ruRU\": \"Поищите Гидбинн в Джунглях свежевателей.\",\n",
+                u8"    \"zhCN\": \"在剥皮魔丛林中寻找吉德宾。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 978,\n",
+                u8"    \"Key\": \"qstsa3q32\",\n",
+                u8"    \"enUS\": \"Pick up the Gidbinn.\",\n",
+                u8"    \"zhTW\": \"撿起吉德賓。\",\n",
+                u8"    \"deDE\": \"Nehmt den Gidbinn an Euch.\",\n",
+                u8"    \"esES\": \"Coge la Gidbinn.\",\n",
+                u8"    \"frFR\": \"Récupérez le Gidbinn.\",\n",
+                u8"    \"itIT\": \"Prendi il Gidbinn.\",\n",
+                u8"    \"koKR\": \"기드빈을 집으십시오.\",\n",
+                u8"    \"plPL\": \"Podnieś Gidbinna.\",\n",
+                u8"    \"esMX\": \"Recoge la Gidbinn.\",\n",
+                u8"    \"jaJP\": \"〈ギドビン〉を回収する。\",\n",
+                u8"    \"ptBR\": \"Pegue a Gidbinn.\",\n",
+                u8"    \"ruRU\": \"Возьмите Гидбинн.\",\n",
+                u8"    \"zhCN\": \"拿起吉德宾。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 979,\n",
+                u8"    \"Key\": \"qstsa3q33\",\n",
+                u8"    \"enUS\": \"Return the Gidbinn to Ormus.\",\n",
+                u8"    \"zhTW\": \"把吉德賓帶回去給奧瑪斯。\",\n",
+                u8"    \"deDE\": \"Bringt den Gidbinn zu Ormus zurück.\",\n",
+                u8"    \"esES\": \"Devuélvele la Gidbinn a Ormus.\",\n",
+                u8"    \"frFR\": \"Ramenez le Gidbinn à Ormus.\",\n",
+                u8"    \"itIT\": \"Porta il Gidbinn a Ormus.\",\n",
+                u8"    \"koKR\": \"기드빈을 오르무스에게 돌려주십시오.\",\n",
+                u8"    \"plPL\": \"Zwróć Gidbinna Ormusowi.\",\n",
+                u8"    \"esMX\": \"Llévale la Gidbinn a Ormus.\",\n",
+                u8"    \"jaJP\": \"戻ってオーマスに〈ギドビン〉を渡す。\",\n",
+                u8"    \"ptBR\": \"Devolva a Gidbinn para Órmus.\",\n",
+                u8"    \"ruRU\": \"Верните Гидбинн Ормусу.\",\n",
+                u8"    \"zhCN\": \"把吉德宾交还给奥玛斯。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 980,\n",
+                u8"    \"Key\": \"qstsa3q34\",\n",
+                u8"    \"enUS\": \"Talk to Asheara.\",\n",
+                u8"    \"zhTW\": \"與艾席拉交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Ashara.\",\n",
+                u8"    \"esES\": \"Habla con Asheara.\",\n",
+                u8"    \"frFR\": \"Parlez à Asheara.\",\n",
+                u8"    \"itIT\": \"Parla con Asheara.\",\n",
+                u8"    \"koKR\": \"아시아라와 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Ashearą.\",\n",
+                u8"    \"esMX\": \"Habla con Asheara.\",\n",
+                u8"    \"jaJP\": \"アシェアラと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Ashara.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Аширой.\",\n",
+                u8"    \"zhCN\": \"与艾席拉交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 981,\n",
+                u8"    \"Key\": \"qstsa3q35\",\n",
+                u8"    \"enUS\": \"Talk to Ormus.\",\n",
+                u8"    \"zhTW\": \"與奧瑪斯交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Ormus.\",\n",
+                u8"    \"esES\": \"Habla con Ormus.\",\n",
+                u8"    \"frFR\": \"Parlez à Ormus.\",\n",
+                u8"    \"itIT\": \"Parla con Ormus.\",\n",
+                u8"    \"koKR\": \"오르무스와 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Ormusem.\",\n",
+                u8"    \"esMX\": \"Habla con Ormus.\",\n",
+                u8"    \"jaJP\": \"オーマスと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Órmus.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Ормусом.\",\n",
+                u8"    \"zhCN\": \"与奥玛斯交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 982,\n",
+                u8"    \"Key\": \"qstsa3q41\",\n",
+                u8"    \"enUS\": \"Ask Cain about the Jade Figurine.\",\n",
+                u8"    \"zhTW\": \"詢問凱恩關於翠玉塑像的事情。\",\n",
+                u8"    \"deDE\": \"Befragt Cain zu der Jadefigur.\",\n",
+                u8"    \"esES\": \"Pregúntale a Caín por la estatuilla de jade.\",\n",
+                u8"    \"frFR\": \"Interrogez Cain à propos de la figurine de jade.\",\n",
+                u8"    \"itIT\": \"Chiedi a Cain della Statuetta di Giada.\",\n",
+                u8"    \"koKR\": \"케인에게 비취 조각상에 관해 물어보십시오.\",\n",
+                u8"    \"plPL\": \"Zapytaj Caina o Jadeitową Figurkę.\",\n",
+                u8"    \"esMX\": \"Pregúntale a Cain acerca de la Estatuilla de jade.\",\n",
+                u8"    \"jaJP\": \"〈翡翠の小像〉についてケインに尋ねる。\",\n",
+                u8"    \"ptBR\": \"Pergunte a Cain sobre a Estatueta de Jade.\",\n",
+                u8"    \"ruRU\": \"Расспросите Декарда Каина о нефритовой статуэтке.\",\n",
+                u8"    \"zhCN\": \"询问凯恩关于玉石雕像的事情。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 983,\n",
+                u8"    \"Key\": \"qstsa3q42\",\n",
+                u8"    \"enUS\": \"Show Meshif the Figurine.\",\n",
+                u8"    \"zhTW\": \"把塑像拿給馬席夫看看。\",\n",
+                u8"    \"deDE\": \"Zeigt Meschif die Figur.\",\n",
+                u8"    \"esES\": \"Enséñale la estatuilla a Meshif.\",\n",
+                u8"    \"frFR\": \"Montrez la figurine à Meshif.\",\n",
+                u8"    \"itIT\": \"Mostra la Statuetta a Meshif.\",\n",
+                u8"    \"koKR\": \"메시프에게 조각상을 보여주십시오.\",\n",
+                u8"    \"plPL\": \"Pokaż figurkę Meshifowi.\",\n",
+                u8"    \"esMX\": \"Muéstrale la Estatuilla a Meshif.\",\n",
+                u8"    \"jaJP\": \"〈翡翠の小像〉をメシーフに見せる。\",\n",
+                u8"    \"ptBR\": \"Mostre a Estatueta para Meshif.\",\n",
+                u8"    \"ruRU\": \"Покажите статуэтку Месхифу.\",\n",
+                u8"    \"zhCN\": \"向梅席夫展示雕像。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 984,\n",
+                u8"    \"Key\": \"qstsa3q43\",\n",
+                u8"    \"enUS\": \"Ask Cain about the Golden Bird.\",\n",
+                u8"    \"zhTW\": \"詢問凱恩關於黃金鳥的事情。\",\n",
+                u8"    \"deDE\": \"Befragt Cain zu dem goldenen Vogel.\",\n",
+                u8"    \"esES\": \"Pregúntale a Caín por el pájaro dorado.\",\n",
+                u8"    \"frFR\": \"Interrogez Cain à propos de l’Oiseau de Feu.\",\n",
+                u8"    \"itIT\": \"Chiedi a Cain dell'Uccello d'Oro.\",\n",
+                u8"    \"koKR\": \"케인에게 황금 새에 관해 물어보십시오.\",\n",
+                u8"    \"plPL\": \"Zapytaj Caina o Złotego Ptaka.\",\n",
+                u8"    \"esMX\": \"Pregúntale a Cain acerca del Pájaro Dorado.\",\n",
+                u8"    \"jaJP\": \"〈黄金の鳥〉についてケインに尋ねる。\",\n",
+                u8"    \"ptBR\": \"Pergunte a Cain sobre o Pássaro Dourado.\",\n",
+                u8"    \"ruRU\": \"Расспросите Декарда Каина о Золотой птице.\",\n",
+                u8"    \"zhCN\": \"询问凯恩关于黄金鸟的事情。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 985,\n",
+                u8"    \"Key\": \"qstsa3q44\",\n",
+                u8"    \"enUS\": \"Give the Golden Bird to Alkor.\",\n",
+                u8"    \"zhTW\": \"把黃金鳥交給艾柯。\",\n",
+                u8"    \"deDE\": \"Gebt Alkor den goldenen Vogel.\",\n",
+                u8"    \"esES\": \"Dale el pájaro dorado a Alkor.\",\n",
+                u8"    \"frFR\": \"Donnez l’Oiseau de Feu à Alkor.\",\n",
+                u8"    \"itIT\": \"Dai l'Uccello d'Oro ad Alkor.\",\n",
+                u8"    \"koKR\": \"알코어에게 황금 새를 주십시오.\",\n",
+                u8"    \"plPL\": \"Oddaj Złotego Ptaka Alkorowi.\",\n",
+                u8"    \"esMX\": \"Entrégale el Pájaro Dorado a Alkor.\",\n",
+                u8"    \"jaJP\": \"アルコルに〈黄金の鳥〉を渡す。\",\n",
+                u8"    \"ptBR\": \"Dê o Pássaro Dourado a Alkor.\",\n",
+                u8"    \"ruRU\": \"Отдайте Золотую птицу Алькору.\",\n",
+                u8"    \"zhCN\": \"将黄金鸟交给奥科。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 986,\n",
+                u8"    \"Key\": \"qstsa3q45\",\n",
+                u8"    \"enUS\": \"Return to Alkor for reward.\",\n",
+                u8"    \"zhTW\": \"回去找艾柯，領取獎勵。\",\n",
+                u8"    \"deDE\": \"Kehrt zu Alkor zurück, um Eure Belohnung zu erhalten.\",\n",
+                u8"    \"esES\": \"Vuelve con Alkor para recibir una recompensa.\",\n",
+                u8"    \"frFR\": \"Retournez auprès d’Alkor pour recevoir votre récompense.\",\n",
+                u8"    \"itIT\": \"Torna da Alkor per la ricompensa.\",\n",
+                u8"    \"koKR\": \"알코어에게 돌아가 보상을 받으십시오.\",\n",
+                u8"    \"plPL\": \"Wróć do Alkora po nagrodę.\",\n",
+                u8"    \"esMX\": \"Habla con Alkor para recibir tu recompensa.\",\n",
+                u8"    \"jaJP\": \"アルコルと会って報酬を受け取る。\",\n",
+                u8"    \"ptBR\": \"Volte até Alkor para receber uma recompensa.\",\n",
+                u8"    \"ruRU\": \"Вернитесь к Алькору за наградой.\",\n",
+                u8"    \"zhCN\": \"回去找奥科领取奖励。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 987,\n",
+                u8"    \"Key\": \"qstsa3q51\",\n",
+                u8"    \"enUS\": \"Find the Blackened Temple within Travincal.\",\n",
+                u8"    \"zhTW\": \"在崔凡克找到晦影神殿。\",\n",
+                u8"    \"deDE\": \"Sucht in Travincal nach dem Schwarzen Tempel.\",\n",
+                u8"    \"esES\": \"Encuentra el Templo Ennegrecido en Travincal.\",\n",
+                u8"    \"frFR\": \"Trouvez le Temple noirci dans Travincal.\",\n",
+                u8"    \"itIT\": \"Trova il tempio oscuro all'interno di Travincal.\",\n",
+                u8"    \"koKR\": \"트라빈칼 내에서 검게 물든 사원을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź Poczerniałą Świątynię w Travincal.\",\n",
+                u8"    \"esMX\": \"Encuentra el Templo Corrupto dentro de Travincal.\",\n",
+                u8"    \"jaJP\": \"トラヴィンカル内で〈穢れた神殿〉を探す。\",\n",
+                u8"    \"ptBR\": \"Encontre o Templo Corrompido em Travincal.\",\n",
+                u8"    \"ruRU\": \"Найдите Оскверненный храм в Травинкале.\",\n",
+                u8"    \"zhCN\": \"在崔凡克中找到黑化神殿。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 988,\n",
+                u8"    \"Key\": \"qstsa3q52\",\n",
+                u8"    \"enUS\": \"Kill the High Council.\",\n",
+                u8"    \"zhTW\": \"殺死所有最高議會的成員。\",\n",
+                u8"    \"deDE\": \"Tötet den Hohen Rat.\",\n",
+                u8"    \"esES\": \"Mata al Gran Consejo.\",\n",
+                u8"    \"frFR\": \"Tuez le Grand Conseil.\",\n",
+                u8"    \"itIT\": \"Uccidi l'Alto Concilio.\",\n",
+                u8"    \"koKR\": \"대의회를 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Wysoką Radę.\",\n",
+                u8"    \"esMX\": \"Mata al Concilio Superior.\",\n",
+                u8"    \"jaJP\": \"高等評議会を倒す。\",\n",
+                u8"    \"ptBR\": \"Mate o Alto Conselho.\",\n",
+                u8"    \"ruRU\": \"Уничтожьте Верховный совет.\",\n",
+                u8"    \"zhCN\": \"消灭高庭理事会。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 989,\n",
+                u8"    \"Key\": \"qstsa3q53\",\n",
+                u8"    \"enUS\": \"Ask Cain for help.\",\n",
+                u8"    \"zhTW\": \"請求凱恩協助。\",\n",
+                u8"    \"deDE\": \"Bittet Cain um Hilfe.\",\n",
+                u8"    \"esES\": \"Pídele ayuda a Caín.\",\n",
+                u8"    \"frFR\": \"Demandez de l’aide à Cain\",\n",
+                u8"    \"itIT\": \"Chiedi aiuto a Cain.\",\n",
+                u8"    \"koKR\": \"케인에게 도움을 요청하십시오.\",\n",
+                u8"    \"plPL\": \"Poproś Caina o pomoc.\",\n",
+                u8"    \"esMX\": \"Pídele ayuda a Cain.\",\n",
+                u8"    \"jaJP\": \"ケインに助言を求める。\",\n",
+                u8"    \"ptBR\": \"Peça ajuda a Cain.\",\n",
+                u8"    \"ruRU\": \"Попросите помощи у Декарда Каина.\",\n",
+                u8"    \"zhCN\": \"向凯恩寻求帮助。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 990,\n",
+                u8"    \"Key\": \"qstsa3q61\",\n",
+                u8"    \"enUS\": \"Smash the Compelling Orb with Khalim's Will to open the way to Mephisto's Durance.\",\n",
+                u8"    \"zhTW\": \"利用克林姆的遺願把強制魔珠毀掉，打通一條前往墨菲斯托囚牢的路。\",\n",
+                u8"    \"deDE\": \"Zerschmettert die Hypnotische Kugel mithilfe von Khalims Willen, um den Weg zu Mephistos Kerker zu öffnen.\",\n",
+                u8"    \"esES\": \"Aplasta el Orbe Impositor con la voluntad de Khalim para abrir el camino a la Represión de Mefisto.\",\n",
+                u8"    \"frFR\": \"Détruisez l’Orbe d’envoûtement à l’aide de la Volonté de Khalim.\",\n",
+                u8"    \"itIT\": \"Distruggi la Sfera del Dominio con la Volontà di Khalim per raggiungere la prigione di Mefisto.\",\n",
+                u8"    \"koKR\": \"칼림의 의지로 유혹의 보주를 파괴하여 메피스토의 억류지로 가는 길을 여십시오.\",\n",
+                u8"    \"plPL\": \"Rozbij Kulę Zniewolenia za pomocą Woli Khalima, aby otworzyć drogę do Kazamat Mefista.\",\n",
+                u8"    \"esMX\": \"Destroza el Orbe cautivante con la Voluntad de Khalim para abrir el camino a la Prisión de Mefisto.\",\n",
+                u8"    \"jaJP\": \"〈カリムの意志〉で〈支配のオーブ〉を破壊し、〈メフィストの牢獄〉への入口を開く。\",\n",
+                u8"    \"ptBR\": \"Esmague o Orbe Dominador com a Vontade de Khalim para abrir caminho até o Cárcere de Mefisto.\",\n",
+                u8"    \"ruRU\": \"Разрушьте Сферу Подчинения с помощью Воли Халима, чтобы открыть путь в узилище Мефисто.\",\n",
+                u8"    \"zhCN\": \"使用卡林姆的意志粉碎强迫之球，打开通向墨菲斯托的囚牢的通道。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 991,\n",
+                u8"    \"Key\": \"qstsa3q62\",\n",
+                u8"    \"enUS\": \"Search for Mephisto in his Durance.\",\n",
+                u8"    \"zhTW\": \"在囚牢中找出墨菲斯托。\",\n",
+                u8"    \"deDE\": \"Findet Mephisto in seinem Kerker.\",\n",
+                u8"    \"esES\": \"Busca a Mefisto en su Represión.\",\n",
+                u8"    \"frFR\": \"Recherchez Méphisto dans sa prison.\",\n",
+                u8"    \"itIT\": \"Cerca Mefisto nella sua prigione.\",\n",
+                u8"    \"koKR\": \"억류지에서 메피스토를 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj Mefista w jego Kazamatach.\",\n",
+                u8"    \"esMX\": \"Busca a Mefisto en su Prisión.\",\n",
+                u8"    \"jaJP\": \"牢獄でメフィストを探す。\",\n",
+                u8"    \"ptBR\": \"Procure por Mefisto no Cárcere.\",\n",
+                u8"    \"ruRU\": \"Найдите Мефисто в его узилище.\",\n",
+                u8"    \"zhCN\": \"在墨菲斯托的囚牢中找到他。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 992,\n",
+                u8"    \"Key\": \"qstsa3q63\",\n",
+                u8"    \"enUS\": \"Kill Mephisto.\",\n",
+                u8"    \"zhTW\": \"殺死墨菲斯托。\",\n",
+                u8"    \"deDE\": \"Tötet Mephisto.\",\n",
+                u8"    \"esES\": \"Mata a Mefisto.\",\n",
+                u8"    \"frFR\": \"Tuez Méphisto.\",\n",
+                u8"    \"itIT\": \"Uccidi Mefisto.\",\n",
+                u8"    \"koKR\": \"메피스토를 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Mefista.\",\n",
+                u8"    \"esMX\": \"Mata a Mefisto.\",\n",
+                u8"    \"jaJP\": \"メフィストを倒す。\",\n",
+                u8"    \"ptBR\": \"Mate Mefisto.\",\n",
+                u8"    \"ruRU\": \"Убейте Мефисто.\",\n",
+                u8"    \"zhCN\": \"消灭墨菲斯托。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 993,\n",
+                u8"    \"Key\": \"qstsa3q31a\",\n",
+                u8"    \"enUS\": \"Ask around the Docks about the Gidbinn.\",\n",
+                u8"    \"zhTW\": \"在港口附近打聽吉德賓的事情。\",\n",
+                u8"    \"deDE\": \"Fragt bei den Docks nach dem Gidbinn.\",\n",
+                u8"    \"esES\": \"Pregunta en los muelles por la Gidbinn.\",\n",
+                u8"    \"frFR\": \"Renseignez-vous sur les quais à propos du Gidbinn.\",\n",
+                u8"    \"itIT\": \"Chiedi del Gidbinn al porto.\",\n",
+                u8"    \"koKR\": \"부두에서 기드빈에 관해 물어보십시오.\",\n",
+                u8"    \"plPL\": \"Popytaj w Dokach o Gidbinna.\",\n",
+                u8"    \"esMX\": \"Pregunta en los Muelles acerca de la Gidbinn.\",\n",
+                u8"    \"jaJP\": \"〈クラスト港〉で〈ギドビン〉のことを聞いて回る。\",\n",
+                u8"    \"ptBR\": \"Pergunte sobre a Gidbinn nas Docas.\",\n",
+                u8"    \"ruRU\": \"Поспрашивайте в доках о Гидбинне.\",\n",
+                u8"    \"zhCN\": \"在港口里打听一下关于吉德宾的事情。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 994,\n",
+                u8"    \"Key\": \"qstsa3q51a\",\n",
+                u8"    \"enUS\": \"Ask Ormus about the Blackened Temple.\",\n",
+                u8"    \"zhTW\": \"問問奧瑪斯有關晦影神殿的消息。\",\n",
+                u8"    \"deDE\": \"Befragt Ormus zum Schwarzen Tempel.\",\n",
+                u8"    \"esES\": \"Pregúntale a Ormus por el Templo Ennegrecido.\",\n",
+                u8"    \"frFR\": \"Interrogez Ormus à propos du Temple Noirci.\",\n",
+                u8"    \"itIT\": \"Chiedi a Ormus del tempio oscuro.\",\n",
+                u8"    \"koKR\": \"오르무스에게 검게 물든 사원에 관해 물어보십시오.\",\n",
+                u8"    \"plPL\": \"Zapytaj Ormusa o Poczerniałą Świątynię.\",\n",
+                u8"    \"esMX\": \"Pregúntale a Ormus acerca del Templo Corrupto.\",\n",
+                u8"    \"jaJP\": \"〈穢れた神殿〉についてオーマスに尋ねる。\",\n",
+                u8"    \"ptBR\": \"Pergunte a Órmus sobre o Templo Corrompido.\",\n",
+                u8"    \"ruRU\": \"Расспросите Ормуса об Оскверненном храме.\",\n",
+                u8"    \"zhCN\": \"问问奥玛斯有关黑化神殿的事。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 995,\n",
+                u8"    \"Key\": \"qstsa3q61a\",\n",
+                u8"    \"enUS\": \"Ormus has news about the Guardian.\",\n",
+                u8"    \"zhTW\": \"奧瑪斯有關於守護者的新消息。\",\n",
+                u8"    \"deDE\": \"Ormus hat Neuigkeiten über den Wächter.\",\n",
+                u8"    \"esES\": \"Ormus tiene noticias sobre el guardián.\",\n",
+                u8"    \"frFR\": \"Ormus a de nouvelles informations sur le Gardien.\",\n",
+                u8"    \"itIT\": \"Ormus ha delle notizie sul guardiano.\",\n",
+                u8"    \"koKR\": \"오르무스가 수호자에 대한 소식이 있다고 합니다.\",\n",
+                u8"    \"plPL\": \"Ormus ma wieści na temat Strażnika.\",\n",
+                u8"    \"esMX\": \"Ormus tiene noticias acerca del Guardián.\",\n",
+                u8"    \"jaJP\": \"オーマスが守護者に関する情報を持っている。\",\n",
+                u8"    \"ptBR\": \"Órmus tem novidades sobre o Guardião.\",\n",
+                u8"    \"ruRU\": \"Ормус кое-что узнал о Страже.\",\n",
+                u8"    \"zhCN\": \"奥玛斯带来了关于守护者的消息。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 996,\n",
+                u8"    \"Key\": \"qstsa4q11\",\n",
+                u8"    \"enUS\": \"Look for Izual in the Plains of Despair.\",\n",
+                u8"    \"zhTW\": \"在絕望平原尋找伊卒爾。\",\n",
+                u8"    \"deDE\": \"Findet Izual in der Ebene der Verzweiflung.\",\n",
+                u8"    \"esES\": \"Busca a Izual en las Llanuras del Desaliento.\",\n",
+                u8"    \"frFR\": \"Recherchez Izual dans les Plaines du désespoir.\",\n",
+                u8"    \"itIT\": \"Cerca Izual nelle Pianure della Disperazione.\",\n",
+                u8"    \"koKR\": \"절망의 평원에서 이주알을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj Izuala na Równinie Rozpaczy.\",\n",
+                u8"    \"esMX\": \"Busca a Izual en la Llanura del Desespero.\",\n",
+                u8"    \"jaJP\": \"〈絶望の平原〉でイズアルを探す。\",\n",
+                u8"    \"ptBR\": \"Procure por Izual na Planície do Desespero.\",\n",
+                u8"    \"ruRU\": \"Поищите Изуала в долине Отчаяния.\",\n",
+                u8"    \"zhCN\": \"在绝望平原上寻找衣卒尔。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 997,\n",
+                u8"    \"Key\": \"qstsa4q12\",\n",
+                u8"    \"enUS\": \"Destroy the demon that holds Izual's soul.\",\n",
+                u8"    \"zhTW\": \"消滅控制伊卒爾靈魂的惡魔。\",\n",
+                u8"    \"deDE\": \"Vernichtet den Dämon, der Izuals Seele gefangen hält.\",\n",
+                u8"    \"esES\": \"Destruye al demonio que tiene el alma de Izual.\",\n",
+                u8"    \"frFR\": \"Détruisez le démon qui détient l’âme d’Izual.\",\n",
+                u8"    \"itIT\": \"Distruggi il demone che contiene l'anima di Izual.\",\n",
+                u8"    \"koKR\": \"이주알의 영혼을 담고 있는 악마를 제거하십시오.\",\n",
+                u8"    \"plPL\": \"Zniszcz Demona, który posiadł duszę Izuala.\",\n",
+                u8"    \"esMX\": \"Destruye al demonio que guarda el alma de Izual.\",\n",
+                u8"    \"jaJP\": \"イズアルの魂を束縛する悪魔を倒す。\",\n",
+                u8"    \"ptBR\": \"Destrua o demônio que aprisiona a alma de Izual.\",\n",
+                u8"    \"ruRU\": \"Уничтожьте демона, который поглотил душу Изуала.\",\n",
+                u8"    \"zhCN\": \"消灭囚禁衣卒尔灵魂的恶魔。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 998,\n",
+                u8"    \"Key\": \"qstsa4q13a\",\n",
+                u8"    \"enUS\": \"Talk to Izual's Spirit.\",\n",
+                u8"    \"zhTW\": \"與伊卒爾的靈魂交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Izuals Geist.\",\n",
+                u8"    \"esES\": \"Habla con el espíritu de Izual.\",\n",
+                u8"    \"frFR\": \"Parlez à l’Esprit d’Izual.\",\n",
+                u8"    \"itIT\": \"Parla con lo spirito di Izual.\",\n",
+                u8"    \"koKR\": \"이주알의 영혼과 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z duchem Izuala.\",\n",
+                u8"    \"esMX\": \"Habla con el espíritu de Izual.\",\n",
+                u8"    \"jaJP\": \"イズアルの魂と話す。\",\n",
+                u8"    \"ptBR\": \"Fale com o Espírito de Izual.\",\n",
+                u8"    \"ruRU\": \"Поговорите с духом Изуала.\",\n",
+                u8"    \"zhCN\": \"与衣卒尔的灵魂对话。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 999,\n",
+                u8"    \"Key\": \"qstsa4q13\",\n",
+                u8"    \"enUS\": \"See Tyrael for reward.\",\n",
+                u8"    \"zhTW\": \"去找泰瑞爾，領取獎勵。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Tyrael, um Eure Belohnung zu erhalten.\",\n",
+                u8"    \"esES\": \"Visita a Tyrael para recibir una recompensa.\",\n",
+                u8"    \"frFR\": \"Tyraël vous récompensera.\",\n",
+                u8"    \"itIT\": \"Vai da Tyrael per la ricompensa.\",\n",
+                u8"    \"koKR\": \"티리엘을 만나 보상을 받으십시오.\",\n",
+                u8"    \"plPL\": \"Udaj się do Tyraela po nagrodę.\",\n",
+                u8"    \"esMX\": \"Habla con Tyrael para recibir tu recompensa.\",\n",
+                u8"    \"jaJP\": \"ティラエルと会って報酬を受け取る。\",\n",
+                u8"    \"ptBR\": \"Encontre Tyrael para receber uma recompensa.\",\n",
+                u8"    \"ruRU\": \"Получите награду у Тираэля.\",\n",
+                u8"    \"zhCN\": \"去见泰瑞尔领取奖励。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1000,\n",
+                u8"    \"Key\": \"qstsa4q31\",\n",
+                u8"    \"enUS\": \"Take Mephisto's Soulstone to the Hellforge.\",\n",
+                u8"    \"zhTW\": \"帶著墨菲斯托的靈魂石，前往地獄熔爐。\",\n",
+                u8"    \"deDE\": \"Bringt Mephistos Seelenstein zur Höllenschmiede.\",\n",
+                u8"    \"esES\": \"Lleva la piedra de alma de Mefisto a la Fragua del Infierno.\",\n",
+                u8"    \"frFR\": \"Emportez la pierre d’âme de Méphisto dans la Forge des Enfers.\",\n",
+                u8"    \"itIT\": \"Porta la Pietra dell'Anima di Mefisto alla Fornace Infernale.\",\n",
+                u8"    \"koKR\": \"메피스토의 영혼석을 지옥의 대장간으로 가져가십시오.\",\n",
+                u8"    \"plPL\": \"Zabierz Kamień Duszy Mefista do Piekielnej Kuźni.\",\n",
+                u8"    \"esMX\": \"Lleva la Piedra Esencial de Mefisto a la Forja Infernal.\",\n",
+                u8"    \"jaJP\": \"〈地獄の炉〉にメフィストのソウルストーンを持っていく。\",\n",
+                u8"    \"ptBR\": \"Leve a Pedra das Almas de Mefisto até a Forja Infernal.\",\n",
+                u8"    \"ruRU\": \"Отнесите камень души Мефисто в Адскую кузню.\",\n",
+                u8"    \"zhCN\": \"把墨菲斯托的灵魂石带到地狱熔炉。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1001,\n",
+                u8"    \"Key\": \"qstsa4q32\",\n",
+                u8"    \"enUS\": \"Destroy Mephisto's Soulstone at the Hellforge.\",\n",
+                u8"    \"zhTW\": \"在地獄熔爐摧毀墨菲斯托的靈魂石。\",\n",
+                u8"    \"deDE\": \"Zerstört Mephistos Seelenstein in der Höllenschmiede.\",\n",
+                u8"    \"esES\": \"Destruye la piedra de alma de Mefisto en la Fragua del Infierno.\",\n",
+                u8"    \"frFR\": \"Détruisez la Pierre d’âme de Méphisto dans la Forge des Enfers.\",\n",
+                u8"    \"itIT\": \"Distruggi la Pietra dell'Anima di Mefisto nella Fornace Infernale.\",\n",
+                u8"    \"koKR\": \"지옥의 대장간에서 메피스토의 영혼석을 파괴하십시오.\",\n",
+                u8"    \"plPL\": \"Zniszcz Kamień Duszy Mefista w Piekielnej Kuźni.\",\n",
+                u8"    \"esMX\": \"Destruye la Piedra Esencial de Mefisto en la Forja Infernal.\",\n",
+                u8"    \"jaJP\": \"〈地獄の炉〉でメフィストのソウルストーンを破壊する。\",\n",
+                u8"    \"ptBR\": \"Destrua a Pedra das Almas de Mefisto na Forja Infernal.\",\n",
+                u8"    \"ruRU\": \"Уничтожьте камень души Мефисто в Адской кузне.\",\n",
+                u8"    \"zhCN\": \"在地狱熔炉处摧毁墨菲斯托的灵魂石。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1002,\n",
+                u8"    \"Key\": \"qstsa4q33\",\n",
+                u8"    \"enUS\": \"Use the Hellforge Hammer on the Forge.\",\n",
+                u8"    \"zhTW\": \"使用地獄熔爐之鎚敲擊靈魂石。\",\n",
+                u8"    \"deDE\": \"Benutzt den Hammer an der Höllenschmiede.\",\n",
+                u8"    \"esES\": \"Utiliza el martillo de la Fragua del Infierno en la fragua.\",\n",
+                u8"    \"frFR\": \"Utilisez le Marteau de la forge des Enfers.\",\n",
+                u8"    \"itIT\": \"Usa il Martello sulla Fornace Infernale.\",\n",
+                u8"    \"koKR\": \"대장간에서 지옥의 대장간 망치를 사용하십시오.\",\n",
+                u8"    \"plPL\": \"Użyj Młota z Piekielnej Kuźni na kowadle.\",\n",
+                u8"    \"esMX\": \"Usa el Martillo de la Forja Infernal en la Forja.\",\n",
+                u8"    \"jaJP\": \"〈地獄の炉〉で〈業火で鍛えられし鎚〉を使う。\",\n",
+                u8"    \"ptBR\": \"Use o Martelo da Forja Infernal na Forja.\",\n",
+                u8"    \"ruRU\": \"Ударьте молотом Адской кузни по горну.\",\n",
+                u8"    \"zhCN\": \"在熔炉上使用地狱熔炉之锤。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1003,\n",
+                u8"    \"Key\": \"qstsa4q34\",\n",
+                u8"    \"enUS\": \"Consult with Cain.\",\n",
+                u8"    \"zhTW\": \"找凱恩商量。\",\n",
+                u8"    \"deDE\": \"Beratet Euch mit Cain.\",\n",
+                u8"    \"esES\": \"Consulta con Caín.\",\n",
+                u8"    \"frFR\": \"Consultez Cain.\",\n",
+                u8"    \"itIT\": \"Parla con Cain.\",\n",
+                u8"    \"koKR\": \"케인에게 조언을 구하십시오.\",\n",
+                u8"    \"plPL\": \"Poradź się Caina.\",\n",
+                u8"    \"esMX\": \"Habla con Cain.\",\n",
+                u8"    \"jaJP\": \"ケインに助言を求める。\",\n",
+                u8"    \"ptBR\": \"Fale com Cain.\",\n",
+                u8"    \"ruRU\": \"Посоветуйтесь с Декардом Каином.\",\n",
+                u8"    \"zhCN\": \"咨询凯恩。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1004,\n",
+                u8"    \"Key\": \"qstsa4q21\",\n",
+                u8"    \"enUS\": \"Find Diablo in his Sanctuary.\",\n",
+                u8"    \"zhTW\": \"在混沌魔殿中找出迪亞布羅。\",\n",
+                u8"    \"deDE\": \"Findet Diablo in seinem Heiligtum.\",\n",
+                u8"    \"esES\": \"Encuentra a Diablo en su santuario.\",\n",
+                u8"    \"frFR\": \"Trouvez Diablo dans son sanctuaire.\",\n",
+                u8"    \"itIT\": \"Trova Diablo nel suo Santuario.\",\n",
+                u8"    \"koKR\": \"성역에서 디아블로를 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Odnajdź Diablo w jego Sanktuarium.\",\n",
+                u8"    \"esMX\": \"Encuentra a Diablo en su Santuario.\",\n",
+                u8"    \"jaJP\": \"〈混沌の聖域〉でディアブロを見つける。\",\n",
+                u8"    \"ptBR\": \"Encontre Diablo em seu Santuário.\",\n",
+                u8"    \"ruRU\": \"Найдите Диабло в его святилище.\",\n",
+                u8"    \"zhCN\": \"在迪亚波罗的避难所中找到他。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1005,\n",
+                u8"    \"Key\": \"qstsa4q22\",\n",
+                u8"    \"enUS\": \"Kill Diablo.\",\n",
+                u8"    \"zhTW\": \"殺死迪亞布羅。\",\n",
+                u8"    \"deDE\": \"Tötet Diablo.\",\n",
+                u8"    \"esES\": \"Mata a Diablo.\",\n",
+                u8"    \"frFR\": \"Tuez Diablo.\",\n",
+                u8"    \"itIT\": \"Uccidi Diablo.\",\n",
+                u8"    \"koKR\": \"디아블로를 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Diablo.\",\n",
+                u8"    \"esMX\": \"Mata a Diablo.\",\n",
+                u8"    \"jaJP\": \"ディアブロを倒す。\",\n",
+                u8"    \"ptBR\": \"Mate Diablo.\",\n",
+                u8"    \"ruRU\": \"Убейте Диабло.\",\n",
+                u8"    \"zhCN\": \"消灭迪亚波罗。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1006,\n",
+                u8"    \"Key\": \"qstsa4q23\",\n",
+                u8"    \"enUS\": \"Break the remaining %d seals.\",\n",
+                u8"    \"zhTW\": \"打破剩下的%d個封印。\",\n",
+                u8"    \"deDE\": \"Brecht die verbleibenden %d Siegel.\",\n",
+                u8"    \"esES\": \"Rompe los %d sellos restantes.\",\n",
+                u8"    \"frFR\": \"Brisez les %d sceaux restants.\",\n",
+                u8"    \"itIT\": \"Spezza i %d sigilli rimasti.\",\n",
+                u8"    \"koKR\": \"남은 봉인 %d개를 파괴하십시오.\",\n",
+                u8"    \"plPL\": \"Złam pieczęcie. Pozostało: %d\",\n",
+                u8"    \"esMX\": \"Rompe los %d sellos restantes.\",\n",
+                u8"    \"jaJP\": \"残り%dつの封印を解く。\",\n",
+                u8"    \"ptBR\": \"Rompa os %d selos restantes.\",\n",
+                u8"    \"ruRU\": \"Осталось разбить печатей: %d.\",\n",
+                u8"    \"zhCN\": \"打破剩余的%d个封印。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 1007,\n",
+                u8"    \"Key\": \"qstsa4q24\",\n",
+                u8"    \"enUS\": \"Break the final seal.\",\n",
+                u8"    \"zhTW\": \"打破最後一個封印。\",\n",
+                u8"    \"deDE\": \"Brecht das letzte Siegel.\",\n",
+                u8"    \"esES\": \"Rompe el sello final.\",\n",
+                u8"    \"frFR\": \"Brisez le dernier sceau.\",\n",
+                u8"    \"itIT\": \"Spezza l'ultimo sigillo.\",\n",
+                u8"    \"koKR\": \"마지막 봉인을 파괴하십시오.\",\n",
+                u8"    \"plPL\": \"Przełam ostatnią pieczęć.\",\n",
+                u8"    \"esMX\": \"Rompe el último sello.\",\n",
+                u8"    \"jaJP\": \"最後の封印を解く。\",\n",
+                u8"    \"ptBR\": \"Rompa o selo final.\",\n",
+                u8"    \"ruRU\": \"Разбейте последнюю печать.\",\n",
+                u8"    \"zhCN\": \"打破最后一个封印。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3711,\n",
+                u8"    \"Key\": \"qstsa1qt\",\n",
+                u8"    \"enUS\": \"The Townspeople\",\n",
+                u8"    \"zhTW\": \"城鎮人民\",\n",
+                u8"    \"deDE\": \"Die Dorfbewohner\",\n",
+                u8"    \"esES\": \"La gente de la ciudad\",\n",
+                u8"    \"frFR\": \"Les habitants de la ville\",\n",
+                u8"    \"itIT\": \"I cittadini\",\n",
+                u8"    \"koKR\": \"마을 사람들\",\n",
+                u8"    \"plPL\": \"Mieszkańcy\",\n",
+                u8"    \"esMX\": \"Los habitantes del poblado\",\n",
+                u8"    \"jaJP\": \"町の住民\",\n",
+                u8"    \"ptBR\": \"Os Moradores da Cidade\",\n",
+                u8"    \"ruRU\": \"Местные жители\",\n",
+                u8"    \"zhCN\": \"镇民\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3712,\n",
+                u8"    \"Key\": \"qstsa1qt0\",\n",
+                u8"    \"enUS\": \"introduction\",\n",
+                u8"    \"zhTW\": \"介紹\",\n",
+                u8"    \"deDE\": \"Einführung\",\n",
+                u8"    \"esES\": \"Introducción\",\n",
+                u8"    \"frFR\": \"Introduction\",\n",
+                u8"    \"itIT\": \"Introduzione\",\n",
+                u8"    \"koKR\": \"소개\",\n",
+                u8"    \"plPL\": \"wstęp\",\n",
+                u8"    \"esMX\": \"Presentación\",\n",
+                u8"    \"jaJP\": \"イントロ\",\n",
+                u8"    \"ptBR\": \"introdução\",\n",
+                u8"    \"ruRU\": \"Введение\",\n",
+                u8"    \"zhCN\": \"介绍\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3713,\n",
+                u8"    \"Key\": \"qstsa1q0\",\n",
+                u8"    \"enUS\": \"Act 1 Prologue\",\n",
+                u8"    \"zhTW\": \"第一章序幕\",\n",
+                u8"    \"deDE\": \"Akt 1 - Prolog\",\n",
+                u8"    \"esES\": \"Acto 1 Prólogo\",\n",
+                u8"    \"frFR\": \"Acte I - Prologue\",\n",
+                u8"    \"itIT\": \"Atto 1, prologo\",\n",
+                u8"    \"koKR\": \"1막 프롤로그\",\n",
+                u8"    \"plPL\": \"Prolog Aktu I\",\n",
+                u8"    \"esMX\": \"Acto 1 - Prólogo\",\n",
+                u8"    \"jaJP\": \"第1章 序幕\",\n",
+                u8"    \"ptBR\": \"Prólogo do Ato 1\",\n",
+                u8"    \"ruRU\": \"Акт 1 – пролог\",\n",
+                u8"    \"zhCN\": \"第一幕序章\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3714,\n",
+                u8"    \"Key\": \"qstsa1q1\",\n",
+                u8"    \"enUS\": \"Den of Evil\",\n",
+                u8"    \"zhTW\": \"邪惡洞窟\",\n",
+                u8"    \"deDE\": \"Höhle des Bösen\",\n",
+                u8"    \"esES\": \"El Cubil del Mal\",\n",
+                u8"    \"frFR\": \"Le repaire du Mal\",\n",
+                u8"    \"itIT\": \"L'Antro del Male\",\n",
+                u8"    \"koKR\": \"악의 소굴\",\n",
+                u8"    \"plPL\": \"Siedlisko Zła\",\n",
+                u8"    \"esMX\": \"Guarida del Mal\",\n",
+                u8"    \"jaJP\": \"邪悪の巣窟\",\n",
+                u8"    \"ptBR\": \"Covil do Mal\",\n",
+                u8"    \"ruRU\": \"Логово зла\",\n",
+                u8"    \"zhCN\": \"邪恶洞穴\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3715,\n",
+                u8"    \"Key\": \"qstsa1q2\",\n",
+                u8"    \"enUS\": \"Sisters' Burial Grounds\",\n",
+                u8"    \"zhTW\": \"褻瀆的墓地\",\n",
+                u8"    \"deDE\": \"Der Friedhof der Schwestern\",\n",
+                u8"    \"esES\": \"El cementerio de las hermanas\",\n",
+                u8"    \"frFR\": \"Le cimetière des Sœurs\",\n",
+                u8"    \"itIT\": \"Il Cimitero delle Sorelle\",\n",
+                u8"    \"koKR\": \"자매단의 매장지\",\n",
+                u8"    \"plPL\": \"Cmentarz sióstr\",\n",
+                u8"    \"esMX\": \"Cementerio de las Hermanas\",\n",
+                u8"    \"jaJP\": \"姉妹の墓地\",\n",
+                u8"    \"ptBR\": \"Cemitério das Irmãs\",\n",
+                u8"    \"ruRU\": \"Сестринский погост\",\n",
+                u8"    \"zhCN\": \"修女的埋骨地\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3716,\n",
+                u8"    \"Key\": \"qstsa1q3\",\n",
+                u8"    \"enUS\": \"Tools of the Trade\",\n",
+                u8"    \"zhTW\": \"工欲善其事\",\n",
+                u8"    \"deDE\": \"Das richtige Werkzeug\",\n",
+                u8"    \"esES\": \"Herramientas de trabajo\",\n",
+                u8"    \"frFR\": \"Outils du métier\",\n",
+                u8"    \"itIT\": \"Ferri del mestiere\",\n",
+                u8"    \"koKR\": \"거래의 도구\",\n",
+                u8"    \"plPL\": \"Narzędzia pracy\",\n",
+                u8"    \"esMX\": \"Herramientas del Comercio\",\n",
+                u8"    \"jaJP\": \"商売道具\",\n",
+                u8"    \"ptBR\": \"Ferramentas do Ofício\",\n",
+                u8"    \"ruRU\": \"Инструменты мастера\",\n",
+                u8"    \"zhCN\": \"交易的工具\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3717,\n",
+                u8"    \"Key\": \"qstsa1q4\",\n",
+                u8"    \"enUS\": \"The Search for Cain\",\n",
+                u8"    \"zhTW\": \"尋找凱恩\",\n",
+                u8"    \"deDE\": \"Die Suche nach Cain\",\n",
+                u8"    \"esES\": \"La búsqueda de Caín\",\n",
+                u8"    \"frFR\": \"À la recherche de Cain\",\n",
+                u8"    \"itIT\": \"Alla ricerca di Cain\",\n",
+                u8"    \"koKR\": \"케인을 찾아서\",\n",
+                u8"    \"plPL\": \"W poszukiwaniu Caina\",\n",
+                u8"    \"esMX\": \"La Búsqueda de Cain\",\n",
+                u8"    \"jaJP\": \"ケインの捜索\",\n",
+                u8"    \"ptBR\": \"A Busca por Cain\",\n",
+                u8"    \"ruRU\": \"Поиски Декарда Каина\",\n",
+                u8"    \"zhCN\": \"搜寻凯恩\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3718,\n",
+                u8"    \"Key\": \"qstsa1q5\",\n",
+                u8"    \"enUS\": \"The Forgotten Tower\",\n",
+                u8"    \"zhTW\": \"遺忘之塔\",\n",
+                u8"    \"deDE\": \"Der Vergessene Turm\",\n",
+                u8"    \"esES\": \"La Torre Olvidada\",\n",
+                u8"    \"frFR\": \"La Tour oubliée\",\n",
+                u8"    \"itIT\": \"La Torre Dimenticata\",\n",
+                u8"    \"koKR\": \"잊힌 탑\",\n",
+                u8"    \"plPL\": \"Zapomniana wieża\",\n",
+                u8"    \"esMX\": \"La Torre Olvidada\",\n",
+                u8"    \"jaJP\": \"忘れ去られし塔\",\n",
+                u8"    \"ptBR\": \"A Torre Esquecida\",\n",
+                u8"    \"ruRU\": \"Заброшенная башня\",\n",
+                u8"    \"zhCN\": \"遗忘之塔\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3719,\n",
+                u8"    \"Key\": \"qstsa1q6\",\n",
+                u8"    \"enUS\": \"Sisters to the Slaughter\",\n",
+                u8"    \"zhTW\": \"為姐妹們復仇\",\n",
+                u8"    \"deDE\": \"Schwestern zur Schlachtbank\",\n",
+                u8"    \"esES\": \"Hermanas de la tortura\",\n",
+                u8"    \"frFR\": \"Le carnage des Sœurs \",\n",
+                u8"    \"itIT\": \"Sorelle al massacro\",\n",
+                u8"    \"koKR\": \"자매단의 학살자\",\n",
+                u8"    \"plPL\": \"Siostry rzezi\",\n",
+                u8"    \"esMX\": \"Hermanas de la Masacre\",\n",
+                u8"    \"jaJP\": \"修道院の悪魔\",\n",
+                u8"    \"ptBR\": \"Irmãs do Massacre\",\n",
+                u8"    \"ruRU\": \"Сестры Бойни\",\n",
+                u8"    \"zhCN\": \"为了姐妹们\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3735,\n",
+                u8"    \"Key\": \"qstsa1q11\",\n",
+                u8"    \"enUS\": \"Look for the Den in the wilderness outside the Rogues' Camp.\",\n",
+                u8"    \"zhTW\": \"在俠盜營地外面的荒野中，找到洞穴。\",\n",
+                u8"    \"deDE\": \"Findet die Höhle in der Wildnis außerhalb des Lagers der Jägerinnen.\",\n",
+                u8"    \"esES\": \"Busca el cubil en el yermo de las afueras del Campamento de las Arpías.\",\n",
+                u8"    \"frFR\": \"Recherchez le repaire dans le désert en dehors du Camp des Rogues.\",\n",
+                u8"    \"itIT\": \"Cerca l'Antro nei territori circostanti il Campo delle Scolte.\",\n",
+                u8"    \"koKR\": \"자매단 야영지 밖의 황야에서 소굴을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Odszukaj Siedlisko Zła w dziczy poza Obozowiskiem Łotrzyc.\",\n",
+                u8"    \"esMX\": \"Busca la Guarida en la espesura fuera del Campamento de Renegadas.\",\n",
+                u8"    \"jaJP\": \"〈ローグの野営地〉の外で〈邪悪の巣窟〉の入口を探す。\",\n",
+                u8"    \"ptBR\": \"Procure pelo Covil na floresta fora do Acampamento Renegado.\",\n",
+                u8"    \"ruRU\": \"Поищите логово в пустошах вокруг лагеря разбойниц.\",\n",
+                u8"    \"zhCN\": \"在流亡者营地外的荒野中寻找洞穴。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3736,\n",
+                u8"    \"Key\": \"qstsa1q12\",\n",
+                u8"    \"enUS\": \"Kill all the monsters in the Den.\",\n",
+                u8"    \"zhTW\": \"殺死所有盤踞在洞穴裡面的怪物。\",\n",
+                u8"    \"deDE\": \"Tötet alle Monster in der Höhle.\",\n",
+                u8"    \"esES\": \"Mata a todos los monstruos del cubil.\",\n",
+                u8"    \"frFR\": \"Tuez tous les monstres du repaire.\",\n",
+                u8"    \"itIT\": \"Uccidi tutti i mostri dell'Antro.\",\n",
+                u8"    \"koKR\": \"소굴에 있는 괴물을 모두 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij wszystkie potwory w Siedlisku.\",\n",
+                u8"    \"esMX\": \"Mata a todos los monstruos en la Guarida.\",\n",
+                u8"    \"jaJP\": \"〈邪悪の巣窟〉にいる魔物をすべて倒す。\",\n",
+                u8"    \"ptBR\": \"Mate todos os monstros no Covil.\",\n",
+                u8"    \"ruRU\": \"Убейте всех монстров в логове.\",\n",
+                u8"    \"zhCN\": \"消灭洞穴里所有的怪物。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3737,\n",
+                u8"    \"Key\": \"qstsa1q13\",\n",
+                u8"    \"enUS\": \"\",\n",
+                u8"    \"zhTW\": \"\",\n",
+                u8"    \"deDE\": \"\",\n",
+                u8"    \"esES\": \"\",\n",
+                u8"    \"frFR\": \"\",\n",
+                u8"    \"itIT\": \"\",\n",
+                u8"    \"koKR\": \"\",\n",
+                u8"    \"plPL\": \"\",\n",
+                u8"    \"esMX\": \"\",\n",
+                u8"    \"jaJP\": \"\",\n",
+                u8"    \"ptBR\": \"\",\n",
+                u8"    \"ruRU\": \"\",\n",
+                u8"    \"zhCN\": \"\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3738,\n",
+                u8"    \"Key\": \"qstsa1q14\",\n",
+                u8"    \"enUS\": \"Monsters remaining: %d\",\n",
+                u8"    \"zhTW\": \"剩餘怪物：%d\",\n",
+                u8"    \"deDE\": \"Verbleibende Monster: %d\",\n",
+                u8"    \"esES\": \"Monstruos restantes: %d\",\n",
+                u8"    \"frFR\": \"Monstres restants : %d\",\n",
+                u8"    \"itIT\": \"Mostri rimasti: %d\",\n",
+                u8"    \"koKR\": \"남은 괴물: %d\",\n",
+                u8"    \"plPL\": \"Pozostałe potwory: %d\",\n",
+                u8"    \"esMX\": \"Monstruos restantes: %d\",\n",
+                u8"    \"jaJP\": \"残りの魔物: %d体\",\n",
+                u8"    \"ptBR\": \"Monstros restantes: %d\",\n",
+                u8"    \"ruRU\": \"Осталось монстров: %d\",\n",
+                u8"    \"zhCN\": \"剩余的怪物: %d\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3739,\n",
+                u8"    \"Key\": \"qstsa1q140\",\n",
+                u8"    \"enUS\": \"One monster left.\",\n",
+                u8"    \"zhTW\": \"剩下一個怪物。\",\n",
+                u8"    \"deDE\": \"Noch ein Monster übrig.\",\n",
+                u8"    \"esES\": \"Falta un monstruo.\",\n",
+                u8"    \"frFR\": \"Un montre restant.\",\n",
+                u8"    \"itIT\": \"Manca un mostro.\",\n",
+                u8"    \"koKR\": \"괴물이 1마리 남았습니다.\",\n",
+                u8"    \"plPL\": \"Został jeden potwór.\",\n",
+                u8"    \"esMX\": \"Un monstruo restante.\",\n",
+                u8"    \"jaJP\": \"魔物は残り1体。\",\n",
+                u8"    \"ptBR\": \"Resta um monstro.\",\n",
+                u8"    \"ruRU\": \"Остался один монстр.\",\n",
+                u8"    \"zhCN\": \"仅剩一个怪物。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3740,\n",
+                u8"    \"Key\": \"qstsa1q15\",\n",
+                u8"    \"enUS\": \"Return to Akara for a reward.\",\n",
+                u8"    \"zhTW\": \"回去找阿卡拉領取獎勵。\",\n",
+                u8"    \"deDE\": \"Kehrt zu Akara zurück, um Eure Belohnung zu erhalten.\",\n",
+                u8"    \"esES\": \"Vuelve con Akara para recibir una recompensa.\",\n",
+                u8"    \"frFR\": \"Retournez auprès d’Akara pour recevoir votre récompense.\",\n",
+                u8"    \"itIT\": \"Torna da Akara per la ricompensa.\",\n",
+                u8"    \"koKR\": \"아카라에게 돌아가 보상을 받으십시오.\",\n",
+                u8"    \"plPL\": \"Wróć do Akary po nagrodę.\",\n",
+                u8"    \"esMX\": \"Habla con Akara para recibir tu recompensa.\",\n",
+                u8"    \"jaJP\": \"アカラと会って報酬を受け取る。\",\n",
+                u8"    \"ptBR\": \"Volte até Akara para receber uma recompensa.\",\n",
+                u8"    \"ruRU\": \"Вернитесь к Акаре за наградой.\",\n",
+                u8"    \"zhCN\": \"回去找阿卡拉领取奖励。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3741,\n",
+                u8"    \"Key\": \"qstsa1q21\",\n",
+                u8"    \"enUS\": \"Look for Blood Raven in the Burial Grounds next to the Cold Plains.\",\n",
+                u8"    \"zhTW\": \"到鄰近冰冷之原的埋骨之地，尋找血鴉的蹤跡。\",\n",
+                u8"    \"deDE\": \"Findet Blutrabe auf dem Friedhof in der Nähe der Kalten Ebene.\",\n",
+                u8"    \"esES\": \"Busca a Cuervo Sangriento en el Cementerio cercano a las Llanuras Frías.\",\n",
+                u8"    \"frFR\": \"Cherchez Blood Raven dans le cimetière à côté des Plaines gelées.\",\n",
+                u8"    \"itIT\": \"Cerca Corvo Vermiglio nel Cimitero nei pressi delle Pianure Gelate.\",\n",
+                u8"    \"koKR\": \"차가운 평야 옆에 있는 매장지에서 핏빛 큰까마귀를 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj Krwawej Orlicy na Cmentarzu w pobliżu Zimnej Równiny.\",\n",
+                u8"    \"esMX\": \"Busca a Cuervo Sangriento en el Cementerio junto a las Llanuras Heladas.\",\n",
+                u8"    \"jaJP\": \"〈荒涼の平原〉の近くにある〈墓地〉でブラッド・レイヴンを探す。\",\n",
+                u8"    \"ptBR\": \"Procure pela Rapina Sangrenta no Cemitério ao lado das Planície Gélida.\",\n",
+                u8"    \"ruRU\": \"Поищите разбойницу Кровавый Ворон на Погосте рядом со Стылыми равнинами.\",\n",
+                u8"    \"zhCN\": \"在紧邻冰冷之原的埋骨之地里找到血鸦。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3742,\n",
+                u8"    \"Key\": \"qstsa1q22\",\n",
+                u8"    \"enUS\": \"Kill Blood Raven.\",\n",
+                u8"    \"zhTW\": \"殺死血鴉。\",\n",
+                u8"    \"deDE\": \"Tötet Blutrabe.\",\n",
+                u8"    \"esES\": \"Mata a Cuervo Sangriento.\",\n",
+                u8"    \"frFR\": \"Tuez Blood Raven.\",\n",
+                u8"    \"itIT\": \"Uccidi Corvo Vermiglio.\",\n",
+                u8"    \"koKR\": \"핏빛 큰까마귀를 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Krwawą Orlicę.\",\n",
+                u8"    \"esMX\": \"Mata a Cuervo Sangriento.\",\n",
+                u8"    \"jaJP\": \"ブラッド・レイヴンを倒す。\",\n",
+                u8"    \"ptBR\": \"Mate a Rapina Sangrenta.\",\n",
+                u8"    \"ruRU\": \"Убейте разбойницу Кровавый Ворон.\",\n",
+                u8"    \"zhCN\": \"消灭血鸦。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3743,\n",
+                u8"    \"Key\": \"qstsa1q23\",\n",
+                u8"    \"enUS\": \"Return to Kashya for a reward.\",\n",
+                u8"    \"zhTW\": \"回去找卡夏領取獎勵。\",\n",
+                u8"    \"deDE\": \"Kehrt zu Kaschya zurück, um Eure Belohnung zu erhalten.\",\n",
+                u8"    \"esES\": \"Vuelve con Kashya para recibir una recompensa.\",\n",
+                u8"    \"frFR\": \"Retournez voir Kashya pour obtenir votre récompense.\",\n",
+                u8"    \"itIT\": \"Torna da Kashya per la ricompensa.\",\n",
+                u8"    \"koKR\": \"카샤에게 돌아가 보상을 받으십시오.\",\n",
+                u8"    \"plPL\": \"Wróć do Kashyi po nagrodę.\",\n",
+                u8"    \"esMX\": \"Habla con Kashya para recibir tu recompensa.\",\n",
+                u8"    \"jaJP\": \"カーシャと会って報酬を受け取る。\",\n",
+                u8"    \"ptBR\": \"Volte até Kashya para receber uma recompensa.\",\n",
+                u8"    \"ruRU\": \"Вернитесь к Кашье за наградой.\",\n",
+                u8"    \"zhCN\": \"回去找卡夏领取奖励。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3744,\n",
+                u8"    \"Key\": \"qstsa1q41\",\n",
+                u8"    \"enUS\": \"Go through the Underground Passage to the Dark Wood, search for the Tree of Inifuss, and recover the Scroll.\",\n",
+                u8"    \"zhTW\": \"穿過地底通道來到黑暗森林，找到艾尼弗斯之樹，並取回卷軸。\",\n",
+                u8"    \"deDE\": \"Geht durch den Unterirdischen Durchgang zum Dunkelwald, sucht den Inifussbaum und holt die Schriftrolle.\",\n",
+                u8"    \"esES\": \"Toma el Pasadizo Subterráneo hacia el Bosque Oscuro, busca el Árbol de Inifuss y recupera el pergamino.\",\n",
+                u8"    \"frFR\": \"Empruntez le passage souterrain vers le Bois obscur, trouvez l’Arbre d’Inifuss et prenez le Parchemin.\",\n",
+                u8"    \"itIT\": \"Segui il Passaggio Sotterraneo verso la Foresta Oscura, cerca l'Albero di Inifuss e recupera la Pergamena.\",\n",
+                u8"    \"koKR\": \"지하 통로를 통과하여 어둠숲으로 가서 이니푸스의 나무를 찾아 두루마리를 회수하십시오.\",\n",
+                u8"    \"plPL\": \"Przejdź Podziemnym Tunelem do Mrocznej Kniei, odnajdź drzewo Inifussa i zdobądź zwój.\",\n",
+                u8"    \"esMX\": \"Atraviesa el Pasaje Subterráneo hacia el Bosque Oscuro, busca el Árbol de Inifuss y recupera el Pergamino.\",\n",
+                u8"    \"jaJP\": \"〈地下道〉を通り抜けて〈常闇の森〉に行き、〈イニファスの木〉を探して〈イニファスの巻物〉を回収する。\",\n",
+                u8"    \"ptBR\": \"Atravesse a Passagem Subterrânea até a Floresta Sombria, procure pela Árvore de Inifuss e recupere o Pergaminho.\",\n",
+                u8"    \"ruRU\": \"Пройдите через подземный проход к Темнолесью, найдите древо Инифусс и добудьте свиток.\",\n",
+                u8"    \"zhCN\": \"穿过地下通道前往黑暗森林，找到艾尼弗斯之树，拿到卷轴。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3745,\n",
+                u8"    \"Key\": \"qstsa1q42\",\n",
+                u8"    \"enUS\": \"Take the Scroll of Inifuss to Akara.\",\n",
+                u8"    \"zhTW\": \"將艾尼弗斯卷軸帶回去給阿卡拉。\",\n",
+                u8"    \"deDE\": \"Bringt Akara die Inifussschriftrolle.\",\n",
+                u8"    \"esES\": \"Llévale el pergamino de Inifuss a Akara.\",\n",
+                u8"    \"frFR\": \"Rapportez le Parchemin d’Inifuss à Akara.\",\n",
+                u8"    \"itIT\": \"Porta la Pergamena di Inifuss ad Akara.\",\n",
+                u8"    \"koKR\": \"이니푸스의 두루마리를 아카라에게 가져가십시오.\",\n",
+                u8"    \"plPL\": \"Zanieś Zwój Inifussa do Akary.\",\n",
+                u8"    \"esMX\": \"Llévale el Pergamino de Inifuss a Akara.\",\n",
+                u8"    \"jaJP\": \"〈イニファスの巻物〉をアカラに渡す。\",\n",
+                u8"    \"ptBR\": \"Leve o Pergaminho de Inifuss até Akara.\",\n",
+                u8"    \"ruRU\": \"Отнесите свиток Инифусс Акаре.\",\n",
+                u8"    \"zhCN\": \"把艾尼弗斯卷轴交给阿卡拉。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3746,\n",
+                u8"    \"Key\": \"qstsa1q43\",\n",
+                u8"    \"enUS\": \"Go to the Cairn Stones in the Stony Field. Touch the Stones in the order found on the Scroll of Inifuss. Enter the portal to Tristram, but beware the danger that lies ahead.\",\n",
+                u8"    \"zhTW\": \"前往亂石曠野中的石陣。按照寫在艾尼弗斯卷軸上面的順序觸碰石柱，然後進入傳送門前往崔斯特姆，但務必要小心前方的危險。\",\n",
+                u8"    \"deDE\": \"Geht zu den Monolithen im Feld der Steine. Berührt die Steine in der Reihenfolge, wie sie in der Inifussschriftrolle angegeben ist. Tretet durch das Portal nach Tristram.\",\n",
+                u8"    \"esES\": \"Ve a las piedras de Cairn en el Campo Pedregoso. Toca las piedras en el orden que te indica el pergamino de Inifuss. Cruza el portal de Tristán, pero ten cuidado con el peligro que te aguarda.\",\n",
+                u8"    \"frFR\": \"Allez vers les Pierres de Cairn dans le Champ de pierres. Touchez-les dans l’ordre indiqué par le Parchemin d’Inifuss. Franchissez le portail vers Tristram mais méfiez-vous des dangers qui vous guettent.\",\n",
+                u8"    \"itIT\": \"Trova i Monoliti nel Campo di Pietra. Toccali nell'ordine riportato sulla Pergamena di Inifuss. Entra nel portale per Tristram. Fai attenzione ai grandi pericoli che ti attendono.\",\n",
+                u8"    \"koKR\": \"바위 벌판에 있는 돌무덤으로 가십시오. 이니푸스의 두루마리에 명시된 순서대로 돌을 만지십시오. 트리스트럼으로 통하는 차원문으로 들어가십시오. 끔찍한 위험이 기다리고 있으니 조심해야 합니다.\",\n",
+                u8"    \"plPL\": \"Udaj się do Kręgu Kamieni na Kamiennych Polach. Dotknij ich w kolejności podanej na Zwoju Inifussa. Przejdź przez portal prowadzący do Tristram, ale strzeż się czyhającego tam niebezpieczeństwa.\",\n",
+                u8"    \"esMX\": \"Dirígete a los Menhires de piedra en el Campo Rocoso. Toca los Menhires en el orden indicado en el Pergamino de Inifuss. Entra en el portal hacia Tristram, pero ten cuidado con el peligro que acecha adelante.\",\n",
+                u8"    \"jaJP\": \"〈石の原野〉にあるケルン・ストーンに行き、〈イニファスの巻物〉に書かれた順序でケルン・ストーンに触れる。待ち受ける危険に警戒しつつ、トリストラムへのポータルに入る。\",\n",
+                u8"    \"ptBR\": \"Vá até as Pedras Monumentais no Campo Rochoso. Toque nas Pedras na ordem indicada no Pergaminho de Inifuss. Entre no portal para Tristram, mas tome cuidado com os perigos do caminho.\",\n",
+                u8"    \"ruRU\": \"Идите к кругу камней в Каменистое поле. Дотроньтесь до камней в порядке, описанном в свитке Инифусс. Перенеситесь в Тристрам через портал, но берегитесь грядущей опасности.\",\n",
+                u8"    \"zhCN\": \"前往石块旷野里的石阵。按照艾尼弗斯卷轴上的顺序触摸这些石头。进入前往崔斯特姆的传送门，但要小心前方的危险。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3747,\n",
+                u8"    \"Key\": \"qstsa1q44\",\n",
+                u8"    \"enUS\": \"Find and rescue Deckard Cain.\",\n",
+                u8"    \"zhTW\": \"找到並救出迪卡‧凱恩。\",\n",
+                u8"    \"deDE\": \"Findet und rettet Deckard Cain.\",\n",
+                u8"    \"esES\": \"Encuentra y rescata a Deckard Caín.\",\n",
+                u8"    \"frFR\": \"Trouvez et secourez Deckard Cain.\",\n",
+                u8"    \"itIT\": \"Trova e soccorri Deckard Cain.\",\n",
+                u8"    \"koKR\": \"데커드 케인을 찾아 구출하십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź i uratuj Deckarda Caina.\",\n",
+                u8"    \"esMX\": \"Encuentra y rescata a Deckard Cain.\",\n",
+                u8"    \"jaJP\": \"デッカード・ケインを探して救出する。\",\n",
+                u8"    \"ptBR\": \"Encontre e resgate Deckard Cain.\",\n",
+                u8"    \"ruRU\": \"Найдите и спасите Декарда Каина.\",\n",
+                u8"    \"zhCN\": \"找到并营救迪卡德·凯恩。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3748,\n",
+                u8"    \"Key\": \"qstsa1q45\",\n",
+                u8"    \"enUS\": \"Cain has been rescued and is now at the Rogue Encampment.\",\n",
+                u8"    \"zhTW\": \"凱恩獲救了，現在已經返回俠盜營地。\",\n",
+                u8"    \"deDE\": \"Cain wurde gerettet und befindet sich jetzt im Lager der Jägerinnen.\",\n",
+                u8"    \"esES\": \"Caín ha sido rescatado y está ahora en el Campamento de las Arpías.\",\n",
+                u8"    \"frFR\": \"Cain est sain et sauf dans le camp des Rogues.\",\n",
+                u8"    \"itIT\": \"Cain è salvo e ora si trova nel Campo delle Scolte.\",\n",
+                u8"    \"koKR\": \"케인은 구출되어 이제 자매단 야영지에 있습니다.\",\n",
+                u8"    \"plPL\": \"Cain został uratowany i znajduje się teraz w Obozowisku Łotrzyc.\",\n",
+                u8"    \"esMX\": \"Cain fue rescatado y ahora se encuentra en el Campamento de Renegadas.\",\n",
+                u8"    \"jaJP\": \"救出されたケインは〈ローグの野営地〉にいる。\",\n",
+                u8"    \"ptBR\": \"Cain foi resgatado e agora está no Acampamento Renegado.\",\n",
+                u8"    \"ruRU\": \"Декард Каин спасен. Теперь он в лагере разбойниц.\",\n",
+                u8"    \"zhCN\": \"凯恩获救了，他现在身处流亡者营地。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3749,\n",
+                u8"    \"Key\": \"qstsa1q46\",\n",
+                u8"    \"enUS\": \"Visit Cain and Akara in the Rogue Encampment.\",\n",
+                u8"    \"zhTW\": \"回到俠盜營地，見見凱恩和阿卡拉。\",\n",
+                u8"    \"deDE\": \"Besucht Cain und Akara im Lager der Jägerinnen.\",\n",
+                u8"    \"esES\": \"Visita a Caín y Akara en el Campamento de las Arpías.\",\n",
+                u8"    \"frFR\": \"Allez voir Cain et Akara au Camp des Rogues.\",\n",
+                u8"    \"itIT\": \"Fai visita a Cain e Akara al Campo delle Scolte.\",\n",
+                u8"    \"koKR\": \"자매단 야영지에 있는 케인과 아카라를 찾아가십시오.\",\n",
+                u8"    \"plPL\": \"Zobacz się z Cainem i Akarą w Obozowisku Łotrzyc.\",\n",
+                u8"    \"esMX\": \"Visita a Cain y a Akara en el Campamento de Renegadas.\",\n",
+                u8"    \"jaJP\": \"〈ローグの野営地〉でケインとアカラに会う。\",\n",
+                u8"    \"ptBR\": \"Visite Cain e Akara no Acampamento Renegado.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Декардом Каином и Акарой в лагере разбойниц.\",\n",
+                u8"    \"zhCN\": \"与流亡者营地里的凯恩和阿卡拉交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3750,\n",
+                u8"    \"Key\": \"qstsa1q46b\",\n",
+                u8"    \"enUS\": \"Talk to Akara for a reward.\",\n",
+                u8"    \"zhTW\": \"與阿卡拉交談，領取獎勵。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Akara, um Eure Belohnung zu erhalten.\",\n",
+                u8"    \"esES\": \"Habla con Akara para recibir una recompensa.\",\n",
+                u8"    \"frFR\": \"Parlez à Akara pour obtenir une récompense.\",\n",
+                u8"    \"itIT\": \"Parla con Akara per la ricompensa.\",\n",
+                u8"    \"koKR\": \"아카라와 대화하여 보상을 받으십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Akarą odnośnie nagrody.\",\n",
+                u8"    \"esMX\": \"Habla con Akara para recibir tu recompensa.\",\n",
+                u8"    \"jaJP\": \"アカラと話して報酬を受け取る。\",\n",
+                u8"    \"ptBR\": \"Fale com Akara para receber uma recompensa.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Акарой, чтобы получить награду.\",\n",
+                u8"    \"zhCN\": \"与阿卡拉交谈，领取奖励。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3751,\n",
+                u8"    \"Key\": \"qstsa1q51\",\n",
+                u8"    \"enUS\": \"Look for the Tower in the Black Marsh beyond the Dark Wood.\",\n",
+                u8"    \"zhTW\": \"在穿過黑暗森林後的黑色荒地中，找到高塔。\",\n",
+                u8"    \"deDE\": \"Findet den Turm im Schwarzmoor hinter dem Dunkelwald.\",\n",
+                u8"    \"esES\": \"Busca la torre en el Pantano Negro más allá del Bosque Oscuro.\",\n",
+                u8"    \"frFR\": \"Cherchez la Tour dans le Marais sombre derrière le Bois obscur.\",\n",
+                u8"    \"itIT\": \"Cerca la Torre nella Palude Nera, oltre la Foresta Oscura.\",\n",
+                u8"    \"koKR\": \"어둠숲 너머에 있는 검은 습지에서 탑을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj wieży na Czarnych Moczarach za Mroczną Knieją.\",\n",
+                u8"    \"esMX\": \"Busca la Torre en la Marisma Oscura, más allá del Bosque Oscuro.\",\n",
+                u8"    \"jaJP\": \"〈常闇の森〉の先にある〈黒の湿原〉で〈忘れ去られし塔〉を探す。\",\n",
+                u8"    \"ptBR\": \"Procure pela Torre no Charco Tenebroso além da Floresta Sombria.\",\n",
+                u8"    \"ruRU\": \"Поищите башню в Черной топи за Темнолесьем.\",\n",
+                u8"    \"zhCN\": \"找到在黑暗森林另一边的黑色沼泽中的高塔。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3752,\n",
+                u8"    \"Key\": \"qstsa1q51a\",\n",
+                u8"    \"enUS\": \"Explore the cellar dungeons beneath the Tower ruins.\",\n",
+                u8"    \"zhTW\": \"探索高塔廢墟底下的地牢。\",\n",
+                u8"    \"deDE\": \"Erforscht die Kellergewölbe unter den Ruinen des Turmes.\",\n",
+                u8"    \"esES\": \"Explora las mazmorras del sótano bajo las ruinas de la torre.\",\n",
+                u8"    \"frFR\": \"Explorez les donjons situés sous les ruines de la Tour.\",\n",
+                u8"    \"itIT\": \"Esplora il Sotterraneo sotto le rovine della Torre.\",\n",
+                u8"    \"koKR\": \"탑의 폐허 아래에 있는 지하 던전을 탐험하십시오.\",\n",
+                u8"    \"plPL\": \"Zbadaj lochy pod ruinami wieży.\",\n",
+                u8"    \"esMX\": \"Explora los calabozos del sótano debajo de las ruinas de la Torre.\",\n",
+                u8"    \"jaJP\": \"〈忘れ去られし塔〉の地下を探索する。\",\n",
+                u8"    \"ptBR\": \"Explore as masmorras do porão sob as ruínas da Torre.\",\n",
+                u8"    \"ruRU\": \"Исследуйте подвалы под разрушенной башней.\",\n",
+                u8"    \"zhCN\": \"探索高塔废墟下的地窖。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3753,\n",
+                u8"    \"Key\": \"qstsa1q51b\",\n",
+                u8"    \"enUS\": \"Explore the cellar dungeons beneath the Tower ruins.\",\n",
+                u8"    \"zhTW\": \"探索高塔廢墟底下的地牢。\",\n",
+                u8"    \"deDE\": \"Erforscht die Kellergewölbe unter den Ruinen des Turmes.\",\n",
+                u8"    \"esES\": \"Explora las mazmorras del sótano bajo las ruinas de la torre.\",\n",
+                u8"    \"frFR\": \"Explorez les donjons situés sous les ruines de la Tour.\",\n",
+                u8"    \"itIT\": \"Esplora il Sotterraneo sotto le rovine della Torre.\",\n",
+                u8"    \"koKR\": \"탑의 폐허 아래에 있는 지하 던전을 탐험하십시오.\",\n",
+                u8"    \"plPL\": \"Zbadaj lochy pod ruinami wieży.\",\n",
+                u8"    \"esMX\": \"Explora los calabozos del sótano debajo de las ruinas de la Torre.\",\n",
+                u8"    \"jaJP\": \"〈忘れ去られし塔〉の地下を探索する。\",\n",
+                u8"    \"ptBR\": \"Explore as masmorras do porão sob as ruínas da Torre.\",\n",
+                u8"    \"ruRU\": \"Исследуйте подвалы под разрушенной башней.\",\n",
+                u8"    \"zhCN\": \"探索高塔废墟下的地窖。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3754,\n",
+                u8"    \"Key\": \"qstsa1q52\",\n",
+                u8"    \"enUS\": \"Dispose of the evil Countess.\",\n",
+                u8"    \"zhTW\": \"打倒邪惡女伯爵。\",\n",
+                u8"    \"deDE\": \"Beseitigt die böse Gräfin.\",\n",
+                u8"    \"esES\": \"Liquida a la malvada Condesa.\",\n",
+                u8"    \"frFR\": \"Débarrassez-vous de la Comtesse démoniaque.\",\n",
+                u8"    \"itIT\": \"Sistema la malvagia Contessa.\",\n",
+                u8"    \"koKR\": \"사악한 백작을 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Pozbądź się nikczemnej Hrabiny.\",\n",
+                u8"    \"esMX\": \"Elimina a la Condesa malvada.\",\n",
+                u8"    \"jaJP\": \"邪悪なる伯爵夫人を倒す。\",\n",
+                u8"    \"ptBR\": \"Acabe com a Condessa maligna.\",\n",
+                u8"    \"ruRU\": \"Уничтожьте злобную Графиню.\",\n",
+                u8"    \"zhCN\": \"解决掉邪恶的女伯爵。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3755,\n",
+                u8"    \"Key\": \"qstsa1q31\",\n",
+                u8"    \"enUS\": \"Look for the Horadric Malus in the Monastery Barracks. Beware of the Smith that guards it.\",\n",
+                u8"    \"zhTW\": \"到修道院兵營找出赫拉迪姆之鎚。務必小心看守的鐵匠。\",\n",
+                u8"    \"deDE\": \"Findet den Horadrimmalus in der Kaserne des Klosters. Hütet Euch vor dem Schmied, der ihn bewacht.\",\n",
+                u8"    \"esES\": \"Busca el malaise horádrico en los Barracones del monasterio. Ten cuidado con el Herrero que lo protege.\",\n",
+                u8"    \"frFR\": \"Cherchez le Marteau d'Horadrim dans la Caserne du monastère. Faites attention au Forgeron qui le garde.\",\n",
+                u8"    \"itIT\": \"Cerca il Malleus Horadrico nella Caserma del monastero. Fai attenzione al Fabbro che lo sorveglia.\",\n",
+                u8"    \"koKR\": \"수도원 병영에서 호라드림 망치를 찾으십시오. 망치를 지키고 있는 대장장이를 조심해야 합니다.\",\n",
+                u8"    \"plPL\": \"Poszukaj Malleusa Horadrimów w Koszarach Klasztoru. Uważaj na strzegącego go Kowala.\",\n",
+                u8"    \"esMX\": \"Busca el Martillo horádrico en el Cuartel del Monasterio. Ten cuidado con el Herrero que lo custodia.\",\n",
+                u8"    \"jaJP\": \"〈修道院の兵舎〉で〈ホラドリムの片手鎚〉を探す。鎚を守る鍛冶師に注意せよ。\",\n",
+                u8"    \"ptBR\": \"Procure pelo Malus Horádrico no Quartel do Monastério. Cuidado com o Ferreiro que o protege.\",\n",
+                u8"    \"ruRU\": \"Поищите хорадримский молот в монастырских казармах. Остерегайтесь Кузнеца, который его охраняет.\",\n",
+                u8"    \"zhCN\": \"在修道院营房里找到赫拉迪姆之锤。当心守卫它的铁匠。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3756,\n",
+                u8"    \"Key\": \"qstsa1q32\",\n",
+                u8"    \"enUS\": \"Return the Horadric Malus to Charsi.\",\n",
+                u8"    \"zhTW\": \"把赫拉迪姆之鎚帶回去給恰西。\",\n",
+                u8"    \"deDE\": \"Bringt Charsi den Horadrimmalus zurück.\",\n",
+                u8"    \"esES\": \"Devuélvele el malaise horádrico a Charsi.\",\n",
+                u8"    \"frFR\": \"Ramenez le Marteau d'Horadrim à Charsi.\",\n",
+                u8"    \"itIT\": \"Riporta il Malleus Horadrico a Charsi.\",\n",
+                u8"    \"koKR\": \"호라드림 망치를 찰시에게 돌려주십시오.\",\n",
+                u8"    \"plPL\": \"Zwróć Charsi Malleusa Horadrimów.\",\n",
+                u8"    \"esMX\": \"Llévale el Martillo horádrico a Charsi.\",\n",
+                u8"    \"jaJP\": \"チャルシに〈ホラドリムの片手鎚〉を渡す。\",\n",
+                u8"    \"ptBR\": \"Devolva o Malus Horádrico a Charsi.\",\n",
+                u8"    \"ruRU\": \"Верните хорадримский молот Чарси.\",\n",
+                u8"    \"zhCN\": \"把赫拉迪姆之锤还给恰西。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3757,\n",
+                u8"    \"Key\": \"qstsa1q32b\",\n",
+                u8"    \"enUS\": \"Charsi will imbue an item with magical power.\",\n",
+                u8"    \"zhTW\": \"恰西會為你的一項物品灌入魔法力量。\",\n",
+                u8"    \"deDE\": \"Charsi wird einen Gegenstand mit magischen Kräften versehen.\",\n",
+                u8"    \"esES\": \"Charsi dotará de poder mágico a un objeto.\",\n",
+                u8"    \"frFR\": \"Charsi va ensorceler un objet.\",\n",
+                u8"    \"itIT\": \"Charsi infonderà un oggetto con proprietà magiche.\",\n",
+                u8"    \"koKR\": \"찰시가 아이템에 마력을 주입해 줄 것입니다.\",\n",
+                u8"    \"plPL\": \"Charsi może zakląć przedmiot magiczną mocą.\",\n",
+                u8"    \"esMX\": \"Charsi puede imbuir un objeto con poder mágico.\",\n",
+                u8"    \"jaJP\": \"チャルシがアイテムに魔力を込められるようになる。\",\n",
+                u8"    \"ptBR\": \"Charsi imbuirá um item com poder mágico.\",\n",
+                u8"    \"ruRU\": \"Чарси наполнит предмет магической силой.\",\n",
+                u8"    \"zhCN\": \"恰西会给一件物品注入魔法力量。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3758,\n",
+                u8"    \"Key\": \"qstsa1q61\",\n",
+                u8"    \"enUS\": \"Find Andariel's Lair in the depths of the Monastery Catacombs.\",\n",
+                u8"    \"zhTW\": \"在修道院的地下墓穴中，找到安達莉爾的巢穴。\",\n",
+                u8"    \"deDE\": \"Findet Andariels Lager tief in den Katakomben des Klosters.\",\n",
+                u8"    \"esES\": \"Encuentra el cubil de Andariel en las profundidades de las Catacumbas del monasterio.\",\n",
+                u8"    \"frFR\": \"Trouvez le repaire d’Andarielle dans les profondeurs des catacombes du Monastère.\",\n",
+                u8"    \"itIT\": \"Trova il covo di Andariel nelle profondità delle Catacombe del monastero.\",\n",
+                u8"    \"koKR\": \"수도원 지하 묘지 깊은 곳에 있는 안다리엘의 소굴을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź siedlisko Andariel w Katakumbach Klasztoru.\",\n",
+                u8"    \"esMX\": \"Encuentra la Guarida de Andariel en las profundidades de las Catacumbas del Monasterio.\",\n",
+                u8"    \"jaJP\": \"〈修道院の地下墓地〉の奥深くで〈アンダリエルの根城〉を探す。\",\n",
+                u8"    \"ptBR\": \"Encontre o Covil de Andariel nas profundezas das Catacumbas do Monastério.\",\n",
+                u8"    \"ruRU\": \"Найдите логово Андариэль в монастырских катакомбах.\",\n",
+                u8"    \"zhCN\": \"在修道院地下墓穴的深处找到安达莉尔的巢穴。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3759,\n",
+                u8"    \"Key\": \"qstsa1q62\",\n",
+                u8"    \"enUS\": \"Kill Andariel.\",\n",
+                u8"    \"zhTW\": \"殺死安達莉爾。\",\n",
+                u8"    \"deDE\": \"Tötet Andariel.\",\n",
+                u8"    \"esES\": \"Mata a Andariel.\",\n",
+                u8"    \"frFR\": \"Tuez Andarielle.\",\n",
+                u8"    \"itIT\": \"Uccidi Andariel.\",\n",
+                u8"    \"koKR\": \"안다리엘을 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Andariel.\",\n",
+                u8"    \"esMX\": \"Mata a Andariel.\",\n",
+                u8"    \"jaJP\": \"アンダリエルを倒す。\",\n",
+                u8"    \"ptBR\": \"Mate Andariel.\",\n",
+                u8"    \"ruRU\": \"Убейте Андариэль.\",\n",
+                u8"    \"zhCN\": \"消灭安达莉尔。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3760,\n",
+                u8"    \"Key\": \"qstsa1q62b\",\n",
+                u8"    \"enUS\": \"Return to Warriv to take the Caravan East.\",\n",
+                u8"    \"zhTW\": \"回去找瓦瑞夫，隨著商隊向東旅行。\",\n",
+                u8"    \"deDE\": \"Kehrt zu Warriv zurück und zieht mit der Karawane nach Osten.\",\n",
+                u8"    \"esES\": \"Vuelve con Warriv para llevar la caravana al este.\",\n",
+                u8"    \"frFR\": \"Repartez à l’est avec Warriv et la caravane.\",\n",
+                u8"    \"itIT\": \"Torna da Warriv per unirti alla carovana verso est.\",\n",
+                u8"    \"koKR\": \"와리브에게 돌아가 동방으로 가는 교역단에 합류하십시오.\",\n",
+                u8"    \"plPL\": \"Wróć do Warriva i rusz z karawaną na wschód.\",\n",
+                u8"    \"esMX\": \"Habla con Warriv para viajar al este con la caravana.\",\n",
+                u8"    \"jaJP\": \"ワリヴと話して隊商と共に東に向かう。\",\n",
+                u8"    \"ptBR\": \"Volte até Warriv para partir com a Caravana para o Leste.\",\n",
+                u8"    \"ruRU\": \"Вернитесь к Варриву, чтобы отправиться вместе с караваном на восток.\",\n",
+                u8"    \"zhCN\": \"回去找瓦瑞夫，带领商队前往东方。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 3761,\n",
+                u8"    \"Key\": \"qstsa1q63\",\n",
+                u8"    \"enUS\": \"Return to Warriv to take the Caravan East.\",\n",
+                u8"    \"zhTW\": \"回去找瓦瑞夫，隨著商隊向東旅行。\",\n",
+                u8"    \"deDE\": \"Kehrt zu Warriv zurück und zieht mit der Karawane nach Osten.\",\n",
+                u8"    \"esES\": \"Vuelve con Warriv para llevar la caravana al este.\",\n",
+                u8"    \"frFR\": \"Repartez à l’est avec Warriv et la caravane.\",\n",
+                u8"    \"itIT\": \"Torna da Warriv per unirti alla carovana verso est.\",\n",
+                u8"    \"koKR\": \"와리브에게 돌아가 동방으로 가는 교역단에 합류하십시오.\",\n",
+                u8"    \"plPL\": \"Wróć do Warriva i rusz z karawaną na wschód.\",\n",
+                u8"    \"esMX\": \"Habla con Warriv para viajar al este con la caravana.\",\n",
+                u8"    \"jaJP\": \"ワリヴと話して隊商と共に東に向かう。\",\n",
+                u8"    \"ptBR\": \"Volte até Warriv para partir com a Caravana para o Leste.\",\n",
+                u8"    \"ruRU\": \"Вернитесь к Варриву, чтобы отправиться вместе с караваном на восток.\",\n",
+                u8"    \"zhCN\": \"回去找瓦瑞夫，带领商队前往东方。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 11030,\n",
+                u8"    \"Key\": \"qstsa2q63f\",\n",
+                u8"    \"enUS\": \"Explore Tal Rasha's Tomb\",\n",
+                u8"    \"zhTW\": \"探索塔拉夏的古墓。\",\n",
+                u8"    \"deDE\": \"Erkundet Tal Rashas Grab.\",\n",
+                u8"    \"esES\": \"Explora la Tumba de Tal Rasha.\",\n",
+                u8"    \"frFR\": \"Explorez la Chambre de Tal Rasha.\",\n",
+                u8"    \"itIT\": \"Esplora la Tomba di Tal Rasha.\",\n",
+                u8"    \"koKR\": \"탈 라샤의 무덤을 탐험하십시오.\",\n",
+                u8"    \"plPL\": \"Zbadaj grobowiec Tal Rashy.\",\n",
+                u8"    \"esMX\": \"Explora la Tumba de Tal Rasha.\",\n",
+                u8"    \"jaJP\": \"〈タル・ラシャの墓〉を探索する。\",\n",
+                u8"    \"ptBR\": \"Explore a Tumba de Tal Rasha.\",\n",
+                u8"    \"ruRU\": \"Исследуйте гробницу Тал Раши.\",\n",
+                u8"    \"zhCN\": \"探索塔·拉夏之墓\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21786,\n",
+                u8"    \"Key\": \"qsta5q14\",\n",
+                u8"    \"enUS\": \"Larzuk will add sockets to the item of your choice.\",\n",
+                u8"    \"zhTW\": \"拉蘇克會在你指定的物品上面增加鑲孔。\",\n",
+                u8"    \"deDE\": \"Larzuk fügt einem Gegenstand Eurer Wahl Sockelfassungen hinzu.\",\n",
+                u8"    \"esES\": \"Larzuk añadirá huecos al objeto que elijas.\",\n",
+                u8"    \"frFR\": \"Larzuk vous permettra d’orner l’objet de votre choix.\",\n",
+                u8"    \"itIT\": \"Larzuk aggiungerà dei castoni a un oggetto di tua scelta.\",\n",
+                u8"    \"koKR\": \"라르주크가 선택한 아이템에 홈을 추가해 줄 것입니다.\",\n",
+                u8"    \"plPL\": \"Larzuk wprawi gniazda w wybrany przedmiot.\",\n",
+                u8"    \"esMX\": \"Larzuk puede agregar engarces al objeto que elijas.\",\n",
+                u8"    \"jaJP\": \"ラルザックがアイテムにソケットを追加できるようになる。\",\n",
+                u8"    \"ptBR\": \"Larzuk adicionará engastes a um item à sua escolha.\",\n",
+                u8"    \"ruRU\": \"Ларзук добавит гнезда в выбранный вами предмет.\",\n",
+                u8"    \"zhCN\": \"拉苏克会给你选择的物品添加镶孔。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21787,\n",
+                u8"    \"Key\": \"qstsa5q42a\",\n",
+                u8"    \"enUS\": \"Find Nihlathak in the Halls of Vaught.\",\n",
+                u8"    \"zhTW\": \"在沃特之廳找出尼拉塞克。\",\n",
+                u8"    \"deDE\": \"Findet Nihlathak in den Hallen von Vaught.\",\n",
+                u8"    \"esES\": \"Encuentra a Nihlathak en las Salas de Vaught.\",\n",
+                u8"    \"frFR\": \"Trouvez Nihlathak dans les Corridors du Martyre.\",\n",
+                u8"    \"itIT\": \"Trova Nihlathak nelle Sale di Vaught.\",\n",
+                u8"    \"koKR\": \"보트의 전당에서 니흘라탁을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź Nihlathaka w Salach Nieszczęścia.\",\n",
+                u8"    \"esMX\": \"Encuentra a Nihlathak en las Salas de Vaught.\",\n",
+                u8"    \"jaJP\": \"〈ヴォートの広間〉でニーラサックを探す。\",\n",
+                u8"    \"ptBR\": \"Encontre Nilatak nos Salões de Vaught.\",\n",
+                u8"    \"ruRU\": \"Найдите Нильятака в Чертогах Воута.\",\n",
+                u8"    \"zhCN\": \"在沃特大厅里找到尼拉塞克。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21788,\n",
+                u8"    \"Key\": \"qstsa5q31a\",\n",
+                u8"    \"enUS\": \"Rescue Anya.\",\n",
+                u8"    \"zhTW\": \"救出安亞。\",\n",
+                u8"    \"deDE\": \"Rettet Anya.\",\n",
+                u8"    \"esES\": \"Rescata a Anya.\",\n",
+                u8"    \"frFR\": \"Sauvez Anya.\",\n",
+                u8"    \"itIT\": \"Salva Anya.\",\n",
+                u8"    \"koKR\": \"안야를 구출하십시오.\",\n",
+                u8"    \"plPL\": \"Uratuj Anyę.\",\n",
+                u8"    \"esMX\": \"Rescata a Anya.\",\n",
+                u8"    \"jaJP\": \"アニャを救出する。\",\n",
+                u8"    \"ptBR\": \"Resgate Anya.\",\n",
+                u8"    \"ruRU\": \"Спасите Аню.\",\n",
+                u8"    \"zhCN\": \"拯救安雅。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21789,\n",
+                u8"    \"Key\": \"qstsa5q21a\",\n",
+                u8"    \"enUS\": \"Free the soldiers from their prison and lead them back to town.\",\n",
+                u8"    \"zhTW\": \"從監牢中救出士兵，並把他們帶回城鎮。\",\n",
+                u8"    \"deDE\": \"Befreit die Soldaten aus ihrem Gefängnis und bringt sie zurück ins Dorf.\",\n",
+                u8"    \"esES\": \"Libera a los soldados prisioneros y condúcelos de vuelta a la ciudad.\",\n",
+                u8"    \"frFR\": \"Libérez les soldats de leur prison et guidez-les vers la ville.\",\n",
+                u8"    \"itIT\": \"Libera i soldati dalla loro prigione e conducili in città.\",\n",
+                u8"    \"koKR\": \"병사들을 감옥에서 구출하고 마을로 데려가십시오.\",\n",
+                u8"    \"plPL\": \"Uwolnij żołnierzy z niewoli i sprowadź ich z powrotem do miasta.\",\n",
+                u8"    \"esMX\": \"Libera a los soldados de su prisión y llévalos de vuelta al poblado.\",\n",
+                u8"    \"jaJP\": \"牢に囚われた兵士を解放して町に連れ戻す。\",\n",
+                u8"    \"ptBR\": \"Liberte os soldados da prisão e leve-os de volta à cidade.\",\n",
+                u8"    \"ruRU\": \"Освободите солдат из тюрьмы и отведите их в город.\",\n",
+                u8"    \"zhCN\": \"把士兵们从监狱里释放出来，带他们回城里去。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21790,\n",
+                u8"    \"Key\": \"qstsa5q43a\",\n",
+                u8"    \"enUS\": \"Anya will personalize an item for you.\",\n",
+                u8"    \"zhTW\": \"安亞會為一件物品冠上你的名字。\",\n",
+                u8"    \"deDE\": \"Anya wird einen Gegenstand für Euch personalisieren.\",\n",
+                u8"    \"esES\": \"Anya personalizará un objeto para ti.\",\n",
+                u8"    \"frFR\": \"Anya personnalisera un objet pour vous.\",\n",
+                u8"    \"itIT\": \"Anya personalizzerà un oggetto per te.\",\n",
+                u8"    \"koKR\": \"안야가 당신을 위해 아이템에 이름을 새겨 줄 것입니다.\",\n",
+                u8"    \"plPL\": \"Anya nada przedmiotowi twoje imię.\",\n",
+                u8"    \"esMX\": \"Anya puede personalizar un objeto para ti.\",\n",
+                u8"    \"jaJP\": \"アニャがアイテムに名前を入れられるようになる。\",\n",
+                u8"    \"ptBR\": \"Anya personalizará um item para você.\",\n",
+                u8"    \"ruRU\": \"Аня может назвать предмет вашим именем.\",\n",
+                u8"    \"zhCN\": \"安雅会为你定制一件物品。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21791,\n",
+                u8"    \"Key\": \"qstsa5q62a\",\n",
+                u8"    \"enUS\": \"Kill Baal in the Worldstone Chamber before he corrupts it.\",\n",
+                u8"    \"zhTW\": \"在巴爾腐化世界之石以前，殺掉位於世界之石大殿中的巴爾。\",\n",
+                u8"    \"deDE\": \"Tötet Baal in der Kammer des Weltsteins, bevor er ihn besudelt.\",\n",
+                u8"    \"esES\": \"Mata a Baal en la Cámara de la Piedra del Mundo antes de la corrompa.\",\n",
+                u8"    \"frFR\": \"Tuez Baal dans la Chambre de la Pierre-Monde avant qu’il ne la corrompe.\",\n",
+                u8"    \"itIT\": \"Uccidi Baal nelle Sale della Pietra del Mondo prima che la corrompa.\",\n",
+                u8"    \"koKR\": \"바알이 세계석을 타락시키기 전에 세계석 보관실에서 바알을 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Baala w Komnacie Kamienia Świata, zanim go splugawi.\",\n",
+                u8"    \"esMX\": \"Mata a Baal en la Cámara de la Piedra Ecuménica antes de que la corrompa.\",\n",
+                u8"    \"jaJP\": \"〈ワールドストーンの間〉が崩壊する前にバールを倒す。\",\n",
+                u8"    \"ptBR\": \"Mate Baal na Câmara da Pedra do Mundo antes que ele a corrompa.\",\n",
+                u8"    \"ruRU\": \"Убейте Баала в Святилище Мироздания прежде, чем он осквернит его.\",\n",
+                u8"    \"zhCN\": \"在巴尔腐蚀世界之石之前消灭他。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21792,\n",
+                u8"    \"Key\": \"qstsa5q61a\",\n",
+                u8"    \"enUS\": \"Find Baal's Throne Room.\",\n",
+                u8"    \"zhTW\": \"找到巴爾的王座大廳。\",\n",
+                u8"    \"deDE\": \"Findet Baals Thronsaal.\",\n",
+                u8"    \"esES\": \"Encuentra la sala del trono de Baal.\",\n",
+                u8"    \"frFR\": \"Trouvez la Salle du Trône de Baal.\",\n",
+                u8"    \"itIT\": \"Trova la sala del trono di Baal.\",\n",
+                u8"    \"koKR\": \"바알의 왕좌를 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź Salę Tronową Baala.\",\n",
+                u8"    \"esMX\": \"Encuentra la Sala del Trono de Baal.\",\n",
+                u8"    \"jaJP\": \"〈バールの王座の間〉を探す。\",\n",
+                u8"    \"ptBR\": \"Encontre a Sala do Trono de Baal.\",\n",
+                u8"    \"ruRU\": \"Найдите тронный зал Баала.\",\n",
+                u8"    \"zhCN\": \"找到巴尔的王座大厅。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 21881,\n",
+                u8"    \"Key\": \"qstsa5q62b\",\n",
+                u8"    \"enUS\": \"Kill Baal's Minions.\",\n",
+                u8"    \"zhTW\": \"殺死巴爾的僕從。\",\n",
+                u8"    \"deDE\": \"Tötet Baals Diener.\",\n",
+                u8"    \"esES\": \"Mata a los esbirros de Baal.\",\n",
+                u8"    \"frFR\": \"Tuez les serviteurs de Baal.\",\n",
+                u8"    \"itIT\": \"Uccidi i seguaci di Baal.\",\n",
+                u8"    \"koKR\": \"바알의 하수인을 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij sługi Baala.\",\n",
+                u8"    \"esMX\": \"Mata a los Esbirros de Baal.\",\n",
+                u8"    \"jaJP\": \"バールの手下を倒す。\",\n",
+                u8"    \"ptBR\": \"Mate os Lacaios de Baal.\",\n",
+                u8"    \"ruRU\": \"Убейте прислужников Баала.\",\n",
+                u8"    \"zhCN\": \"消灭巴尔的仆从。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22618,\n",
+                u8"    \"Key\": \"qstsa5q1\",\n",
+                u8"    \"enUS\": \"Siege on Harrogath\",\n",
+                u8"    \"zhTW\": \"哈洛加斯圍城戰\",\n",
+                u8"    \"deDE\": \"Belagerung von Harrogath\",\n",
+                u8"    \"esES\": \"Asedio a Harrogath\",\n",
+                u8"    \"frFR\": \"Le siège d’Harrogath\",\n",
+                u8"    \"itIT\": \"Assedio ad Harrogath\",\n",
+                u8"    \"koKR\": \"하로가스 공성전\",\n",
+                u8"    \"plPL\": \"Oblężenie Harrogath\",\n",
+                u8"    \"esMX\": \"Asedio de Harrogat\",\n",
+                u8"    \"jaJP\": \"ハロガスの包囲\",\n",
+                u8"    \"ptBR\": \"Cerco de Harrogath\",\n",
+                u8"    \"ruRU\": \"Осада Харрогата\",\n",
+                u8"    \"zhCN\": \"哈洛加斯围城战\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22619,\n",
+                u8"    \"Key\": \"qsta5q11\",\n",
+                u8"    \"enUS\": \"Stop the Siege by killing Shenk the Overseer in the Bloody Foothills.\",\n",
+                u8"    \"zhTW\": \"殺死在血腥丘陵的督軍山克，以阻止這場圍城戰。\",\n",
+                u8"    \"deDE\": \"Beendet die Belagerung, indem Ihr Schenk den Aufseher im Blutigen Vorgebirge besiegt.\",\n",
+                u8"    \"esES\": \"Para detener el asedio, elimina a Shenk, el que todo lo ve, en las Estribaciones Sangrientas.\",\n",
+                u8"    \"frFR\": \"Mettez fin au siège en éliminant Shenk le surveillant dans les Collines Sanglantes.\",\n",
+                u8"    \"itIT\": \"Spezza l'assedio uccidendo Shenk il Sovrintendente nelle Colline Insanguinate.\",\n",
+                u8"    \"koKR\": \"핏빛 언덕에서 감독관 쉔크를 처치하여 공격을 저지하십시오.\",\n",
+                u8"    \"plPL\": \"Przerwij oblężenie, zabijając Shenka Nadzorcę na Krwawych Wzgórzach.\",\n",
+                u8"    \"esMX\": \"Mata a Shenk el Mayoral en las Laderas Sangrientas para detener el asedio.\",\n",
+                u8"    \"jaJP\": \"〈血に塗れし丘陵〉で〈監視者シェンク〉を倒して包囲を終わらせる。\",\n",
+                u8"    \"ptBR\": \"Mate Shenk, o Capataz para acabar com o cerco nas Colinas Sangrentas.\",\n",
+                u8"    \"ruRU\": \"Прекратите осаду, убив Шенка Надзирателя в Кровавых предгорьях.\",\n",
+                u8"    \"zhCN\": \"消灭血腥丘陵的督军山克，解除围城。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22620,\n",
+                u8"    \"Key\": \"qsta5q12\",\n",
+                u8"    \"enUS\": \"Kill Shenk the Overseer.\",\n",
+                u8"    \"zhTW\": \"殺死督軍山克。\",\n",
+                u8"    \"deDE\": \"Tötet Schenk den Aufseher.\",\n",
+                u8"    \"esES\": \"Mata a Shenk, el que todo lo ve.\",\n",
+                u8"    \"frFR\": \" Tuez Shenk le surveillant. \",\n",
+                u8"    \"itIT\": \"Uccidi Shenk il Sovrintendente.\",\n",
+                u8"    \"koKR\": \"감독관 쉔크를 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Shenka Nadzorcę.\",\n",
+                u8"    \"esMX\": \"Mata a Shenk el Mayoral.\",\n",
+                u8"    \"jaJP\": \"〈監視者シェンク〉を倒す。\",\n",
+                u8"    \"ptBR\": \"Mate Shenk, o Capataz.\",\n",
+                u8"    \"ruRU\": \"Убейте Шенка Надзирателя.\",\n",
+                u8"    \"zhCN\": \"消灭督军山克。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22621,\n",
+                u8"    \"Key\": \"qsta5q13\",\n",
+                u8"    \"enUS\": \"Go talk to Larzuk for your reward.\",\n",
+                u8"    \"zhTW\": \"與拉蘇克交談，領取你的獎勵。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Larzuk, um Eure Belohnung zu erhalten.\",\n",
+                u8"    \"esES\": \"Habla con Larzuk para recibir una recompensa.\",\n",
+                u8"    \"frFR\": \"Allez parler à Larzuk pour obtenir votre récompense.\",\n",
+                u8"    \"itIT\": \"Parla con Larzuk per la ricompensa.\",\n",
+                u8"    \"koKR\": \"라르주크와 대화하여 보상을 받으십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Larzukiem w sprawie nagrody.\",\n",
+                u8"    \"esMX\": \"Habla con Larzuk para recibir tu recompensa.\",\n",
+                u8"    \"jaJP\": \"ラルザックと話して報酬を受け取る。\",\n",
+                u8"    \"ptBR\": \"Fale com Larzuk para receber sua recompensa.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Ларзуком, чтобы получить награду.\",\n",
+                u8"    \"zhCN\": \"去和拉苏克谈谈领取奖励。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22622,\n",
+                u8"    \"Key\": \"qstsa5q2\",\n",
+                u8"    \"enUS\": \"Rescue on Mount Arreat\",\n",
+                u8"    \"zhTW\": \"亞瑞特山的救援行動\",\n",
+                u8"    \"deDE\": \"Rettung auf dem Berg Arreat\",\n",
+                u8"    \"esES\": \"Rescate en el Monte Arreat\",\n",
+                u8"    \"frFR\": \"Sauvetage au mont Arreat\",\n",
+                u8"    \"itIT\": \"Salvataggio sul Monte Arreat\",\n",
+                u8"    \"koKR\": \"아리앗 산에서의 구출\",\n",
+                u8"    \"plPL\": \"Ratunek na górze Arreat\",\n",
+                u8"    \"esMX\": \"Rescate en el Monte Arreat\",\n",
+                u8"    \"jaJP\": \"アリート山での救出\",\n",
+                u8"    \"ptBR\": \"Resgate no Monte Arreat\",\n",
+                u8"    \"ruRU\": \"Вылазка на гору Арреат\",\n",
+                u8"    \"zhCN\": \"亚瑞特山救援行动\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22623,\n",
+                u8"    \"Key\": \"qstsa5q21\",\n",
+                u8"    \"enUS\": \"Find the Soldiers in the Frigid Highlands.\",\n",
+                u8"    \"zhTW\": \"找到冰凍高地上的士兵。\",\n",
+                u8"    \"deDE\": \"Findet die Soldaten im Eishochland.\",\n",
+                u8"    \"esES\": \"Encuentra a los soldados en las Tierras Altas Glaciales.\",\n",
+                u8"    \"frFR\": \"Retrouvez les soldats prisonniers des Hautes-Glaces.\",\n",
+                u8"    \"itIT\": \"Trova i soldati sugli Altopiani del Gelo.\",\n",
+                u8"    \"koKR\": \"혹한의 고산지에서 병사들을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Znajdź żołnierzy na Zlodowaciałej Wyżynie.\",\n",
+                u8"    \"esMX\": \"Encuentra a los soldados en las Tierras Altas Gélidas.\",\n",
+                u8"    \"jaJP\": \"〈極寒の高原〉で兵士を探す。\",\n",
+                u8"    \"ptBR\": \"Encontre os soldados nas Terras Altas Gélidas.\",\n",
+                u8"    \"ruRU\": \"Найдите солдат на Мерзлом нагорье.\",\n",
+                u8"    \"zhCN\": \"在冰冻高地找到士兵。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22624,\n",
+                u8"    \"Key\": \"qstsa5q22\",\n",
+                u8"    \"enUS\": \"Rescue %d more Soldiers in the Frigid Highlands.\",\n",
+                u8"    \"zhTW\": \"在冰凍高地救援%d位士兵。\",\n",
+                u8"    \"deDE\": \"Rettet noch %d Soldaten im Eishochland.\",\n",
+                u8"    \"esES\": \"Rescata %d soldados más en las Tierras Altas Glaciales.\",\n",
+                u8"    \"frFR\": \"Vous avez encore %d soldats à libérer des Hautes-Glaces.\",\n",
+                u8"    \"itIT\": \"Salva altri %d soldati sugli Altopiani del Gelo.\",\n",
+                u8"    \"koKR\": \"혹한의 고산지에서 병사를 %d명 이상 구출하십시오.\",\n",
+                u8"    \"plPL\": \"Uratuj żołnierzy na Zlodowaciałej Wyżynie. Pozostało %d żołnierzy.\",\n",
+                u8"    \"esMX\": \"Rescata a %d soldados más en las Tierras Altas Gélidas.\",\n",
+                u8"    \"jaJP\": \"〈極寒の高原〉で残り%d人の兵士を救出する。\",\n",
+                u8"    \"ptBR\": \"Resgate mais %d soldados nas Terras Altas Gélidas.\",\n",
+                u8"    \"ruRU\": \"Осталось солдат в плену на Мерзлом нагорье: %d.\",\n",
+                u8"    \"zhCN\": \"在冰冻高地营救%d名士兵。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22625,\n",
+                u8"    \"Key\": \"qstsa5q23\",\n",
+                u8"    \"enUS\": \"Return to Qual-Kehk for your reward.\",\n",
+                u8"    \"zhTW\": \"回去找夸爾凱克，領取你的獎賞。\",\n",
+                u8"    \"deDE\": \"Kehrt zu Qua-Kehk zurück, um Eure Belohnung zu erhalten.\",\n",
+                u8"    \"esES\": \"Vuelve con Qual-Kehk para recibir una recompensa.\",\n",
+                u8"    \"frFR\": \"Allez voir Qual-Kehk pour obtenir votre récompense.\",\n",
+                u8"    \"itIT\": \"Torna da Qual-Kehk per la ricompensa.\",\n",
+                u8"    \"koKR\": \"콸케크에게 돌아가 보상을 받으십시오.\",\n",
+                u8"    \"plPL\": \"Wróć do Qual-Kehka po swą nagrodę.\",\n",
+                u8"    \"esMX\": \"Habla con Qual-Kehk para recibir tu recompensa.\",\n",
+                u8"    \"jaJP\": \"クァル=ケックと会って報酬を受け取る。\",\n",
+                u8"    \"ptBR\": \"Volte até Qual-kehk para receber sua recompensa.\",\n",
+                u8"    \"ruRU\": \"Вернитесь к Куаль-Кеку за наградой.\",\n",
+                u8"    \"zhCN\": \"回去找夸尔凯克领取奖励。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22626,\n",
+                u8"    \"Key\": \"qstsa5q24\",\n",
+                u8"    \"enUS\": \"Apply the Runes to a Socketed item in this order:\",\n",
+                u8"    \"zhTW\": \"以下列順序把符文嵌進鑲孔物品：\",\n",
+                u8"    \"deDE\": \"Setzt die Runen in dieser Reihenfolge in einen gesockelten Gegenstand ein:\",\n",
+                u8"    \"esES\": \"Engarza las runas en un objeto con huecos en el siguiente orden:\",\n",
+                u8"    \"frFR\": \"Utilisez les runes sur un objet à sertir dans l’ordre suivant…\",\n",
+                u8"    \"itIT\": \"Applica le rune a un oggetto con castoni in quest'ordine:\",\n",
+                u8"    \"koKR\": \"룬을 다음 순서대로 홈 파인 아이템에 장착하십시오:\",\n",
+                u8"    \"plPL\": \"W gniazdach przedmiotu umieść runy w podanej kolejności:\",\n",
+                u8"    \"esMX\": \"Aplica las runas a un objeto engarzado en este orden:\",\n",
+                u8"    \"jaJP\": \"この順序でソケット付きのアイテムにルーンを適用する:\",\n",
+                u8"    \"ptBR\": \"Insira as runas a um item com engastes nesta ordem:\",\n",
+                u8"    \"ruRU\": \"Примените руны к предмету с гнездами в следующем порядке:\",\n",
+                u8"    \"zhCN\": \"将符文按如下顺序镶嵌到有镶孔的物品：\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22627,\n",
+                u8"    \"Key\": \"qstsa5q3\",\n",
+                u8"    \"enUS\": \"Prison of Ice\",\n",
+                u8"    \"zhTW\": \"冰凍囚牢\",\n",
+                u8"    \"deDE\": \"Eisgefängnis\",\n",
+                u8"    \"esES\": \"Prisión de hielo\",\n",
+                u8"    \"frFR\": \"Prison de glace\",\n",
+                u8"    \"itIT\": \"Prigione di ghiaccio\",\n",
+                u8"    \"koKR\": \"얼음 감옥\",\n",
+                u8"    \"plPL\": \"Lodowe więzienie\",\n",
+                u8"    \"esMX\": \"Prisión de Hielo\",\n",
+                u8"    \"jaJP\": \"氷の牢獄\",\n",
+                u8"    \"ptBR\": \"Prisão de Gelo\",\n",
+                u8"    \"ruRU\": \"Ледяная темница\",\n",
+                u8"    \"zhCN\": \"冰之囚牢\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22628,\n",
+                u8"    \"Key\": \"qstsa5q31\",\n",
+                u8"    \"enUS\": \"Look for Anya under the Crystalline Passage by the Frozen River.\",\n",
+                u8"    \"zhTW\": \"在水晶通道下的冰凍之河尋覓安亞。\",\n",
+                u8"    \"deDE\": \"Findet Anya unter dem Kristalldurchgang beim Frostfluss.\",\n",
+                u8"    \"esES\": \"Busca a Anya bajo el Pasaje Cristalino junto al Río Helado.\",\n",
+                u8"    \"frFR\": \"Trouvez Anya sous le Passage Cristallin près de la Rivière Glacée.\",\n",
+                u8"    \"itIT\": \"Trova Anya presso il Fiume Gelido, sotto il Passaggio Cristallino.\",\n",
+                u8"    \"koKR\": \"수정 동굴 아래의 얼어붙은 강에서 안야를 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Poszukaj Anyi pod Kryształowym Przejściem w pobliżu Zamarzniętej Rzeki.\",\n",
+                u8"    \"esMX\": \"Busca a Anya bajo el Pasaje Cristalino junto al Río Congelado.\",\n",
+                u8"    \"jaJP\": \"〈凍てつく川〉の近くにある〈結晶道〉の地下でアニャを探す。\",\n",
+                u8"    \"ptBR\": \"Procure por Anya sob a Passagem Cristalina próxima ao Rio Congelado.\",\n",
+                u8"    \"ruRU\": \"Поищите Аню в Ледяных пещерах у Замерзшей реки.\",\n",
+                u8"    \"zhCN\": \"在水晶通道下的冰冻之河寻找安雅。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22629,\n",
+                u8"    \"Key\": \"qstsa5q32\",\n",
+                u8"    \"enUS\": \"Talk to Malah.\",\n",
+                u8"    \"zhTW\": \"與瑪拉交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Malah.\",\n",
+                u8"    \"esES\": \"Habla con Malah.\",\n",
+                u8"    \"frFR\": \"Parlez à Malah.\",\n",
+                u8"    \"itIT\": \"Parla con Malah.\",\n",
+                u8"    \"koKR\": \"말라와 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Malah.\",\n",
+                u8"    \"esMX\": \"Habla con Malah.\",\n",
+                u8"    \"jaJP\": \"マラーと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Malah.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Маллой.\",\n",
+                u8"    \"zhCN\": \"跟马拉交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22630,\n",
+                u8"    \"Key\": \"qstsa5q33\",\n",
+                u8"    \"enUS\": \"Use the potion Malah gave you to thaw Anya.\",\n",
+                u8"    \"zhTW\": \"使用瑪拉給你的藥水融化安亞身上的冰。\",\n",
+                u8"    \"deDE\": \"Benutzt das Elixier, das Malah Euch gegeben hat, um Anya aufzutauen.\",\n",
+                u8"    \"esES\": \"Utiliza la poción que te dio Malah para descongelar a Anya.\",\n",
+                u8"    \"frFR\": \"Utilisez la potion que Malah vous a donnée pour libérer Anya.\",\n",
+                u8"    \"itIT\": \"Usa la pozione che ti ha dato Malah per scongelare Anya.\",\n",
+                u8"    \"koKR\": \"말라에게 받은 물약을 사용하여 안야를 녹이십시오.\",\n",
+                u8"    \"plPL\": \"Użyj otrzymanej od Malah mikstury do rozmrożenia Anyi.\",\n",
+                u8"    \"esMX\": \"Usa la poción que te dio Malah para descongelar a Anya.\",\n",
+                u8"    \"jaJP\": \"マラーに渡されたポーションでアニャの氷を解かす。\",\n",
+                u8"    \"ptBR\": \"Use a poção que Malah deu a você para descongelar Anya.\",\n",
+                u8"    \"ruRU\": \"Отогрейте Аню с помощью зелья, которое дала вам Малла.\",\n",
+                u8"    \"zhCN\": \"用马拉给你的药水解冻安雅。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22631,\n",
+                u8"    \"Key\": \"qstsa5q34\",\n",
+                u8"    \"enUS\": \"Talk to Malah for your reward.\",\n",
+                u8"    \"zhTW\": \"與瑪拉交談，領取你的獎勵。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Malah, um Eure Belohnung zu erhalten.\",\n",
+                u8"    \"esES\": \"Habla con Malah para recibir una recompensa.\",\n",
+                u8"    \"frFR\": \"Parlez à Malah pour obtenir votre récompense.\",\n",
+                u8"    \"itIT\": \"Parla con Malah per la ricompensa.\",\n",
+                u8"    \"koKR\": \"말라와 대화하여 보상을 받으십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Malah o twojej nagrodzie.\",\n",
+                u8"    \"esMX\": \"Habla con Malah para recibir tu recompensa.\",\n",
+                u8"    \"jaJP\": \"マラーと話して報酬を受け取る。\",\n",
+                u8"    \"ptBR\": \"Fale com Malah para receber sua recompensa.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Маллой, чтобы получить награду.\",\n",
+                u8"    \"zhCN\": \"与马拉交谈领取奖励。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22632,\n",
+                u8"    \"Key\": \"qstsa5q35\",\n",
+                u8"    \"enUS\": \"Talk to Anya.\",\n",
+                u8"    \"zhTW\": \"與安亞交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Anya.\",\n",
+                u8"    \"esES\": \"Habla con Anya.\",\n",
+                u8"    \"frFR\": \"Parlez à Anya.\",\n",
+                u8"    \"itIT\": \"Parla con Anya.\",\n",
+                u8"    \"koKR\": \"안야와 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Anyą.\",\n",
+                u8"    \"esMX\": \"Habla con Anya.\",\n",
+                u8"    \"jaJP\": \"アニャと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Anya.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Аней.\",\n",
+                u8"    \"zhCN\": \"与安雅交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22633,\n",
+                u8"    \"Key\": \"qstsa5q4\",\n",
+                u8"    \"enUS\": \"Betrayal of Harrogath\",\n",
+                u8"    \"zhTW\": \"哈洛加斯的叛徒\",\n",
+                u8"    \"deDE\": \"Verrat in Harrogath\",\n",
+                u8"    \"esES\": \"La traición de Harrogath\",\n",
+                u8"    \"frFR\": \"Le traître d’Harrogath\",\n",
+                u8"    \"itIT\": \"Tradimento ad Harrogath\",\n",
+                u8"    \"koKR\": \"하로가스의 배신\",\n",
+                u8"    \"plPL\": \"Zdrada w Harrogath\",\n",
+                u8"    \"esMX\": \"La Traición de Harrogat\",\n",
+                u8"    \"jaJP\": \"ハロガスの裏切り\",\n",
+                u8"    \"ptBR\": \"A Traição de Harrogath\",\n",
+                u8"    \"ruRU\": \"Предательство Харрогата\",\n",
+                u8"    \"zhCN\": \"哈洛加斯的背叛\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22634,\n",
+                u8"    \"Key\": \"qstsa5q41\",\n",
+                u8"    \"enUS\": \"Take Anya's portal to Nihlathak's Temple.\",\n",
+                u8"    \"zhTW\": \"通過安亞的傳送門，前往尼拉塞克的神殿。\",\n",
+                u8"    \"deDE\": \"Geht durch Anyas Portal zu Nihlathaks Tempel.\",\n",
+                u8"    \"esES\": \"Toma el portal de Anya al Templo de Nihlathak.\",\n",
+                u8"    \"frFR\": \"Prenez le portail d’Anya pour rejoindre le Temple de Nihlathak.\",\n",
+                u8"    \"itIT\": \"Usa il portale di Anya per raggiungere il Tempio di Nihlathak.\",\n",
+                u8"    \"koKR\": \"안야의 차원문을 통해 니흘라탁의 사원으로 이동하십시오.\",\n",
+                u8"    \"plPL\": \"Przejdź portalem Anyi do Świątyni Nihlathaka.\",\n",
+                u8"    \"esMX\": \"Usa el portal de Anya hacia el Templo de Nihlathak.\",\n",
+                u8"    \"jaJP\": \"アニャが開いたポータルで〈ニーラサックの寺院〉に向かう。\",\n",
+                u8"    \"ptBR\": \"Use o portal de Anya para chegar ao Templo de Nilatak.\",\n",
+                u8"    \"ruRU\": \"Перенеситесь через портал Ани к храму Нильятака.\",\n",
+                u8"    \"zhCN\": \"使用安雅的传送门前往尼拉塞克的神殿。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22635,\n",
+                u8"    \"Key\": \"qstsa5q42\",\n",
+                u8"    \"enUS\": \"Kill Nihlathak.\",\n",
+                u8"    \"zhTW\": \"殺死尼拉塞克。\",\n",
+                u8"    \"deDE\": \"Tötet Nihlathak.\",\n",
+                u8"    \"esES\": \"Mata a Nihlathak.\",\n",
+                u8"    \"frFR\": \"Tuez Nihlathak.\",\n",
+                u8"    \"itIT\": \"Uccidi Nihlathak.\",\n",
+                u8"    \"koKR\": \"니흘라탁을 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Nihlathaka.\",\n",
+                u8"    \"esMX\": \"Mata a Nihlathak.\",\n",
+                u8"    \"jaJP\": \"ニーラサックを倒す。\",\n",
+                u8"    \"ptBR\": \"Mate Nilatak.\",\n",
+                u8"    \"ruRU\": \"Убейте Нильятака.\",\n",
+                u8"    \"zhCN\": \"消灭尼拉塞克。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22636,\n",
+                u8"    \"Key\": \"qstsa5q43\",\n",
+                u8"    \"enUS\": \"Talk to Anya before you continue through the Crystalline Passage, past the Glacial Trail, to proceed up Mount Arreat to the Summit.\",\n",
+                u8"    \"zhTW\": \"在你繼續通過水晶通道、冰河小徑，並登上亞瑞特山巔之前先和安亞交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Anya, bevor Ihr durch den Kristalldurchgang geht und am Gletscherweg vorbei zum Gipfel des Berges Arreat wandert.\",\n",
+                u8"    \"esES\": \"Habla con Anya antes de continuar a través del Pasaje Cristalino para pasar por la Senda Glacial y llegar hasta la cima del Monte Arreat.\",\n",
+                u8"    \"frFR\": \"Parlez à Anya avant de continuer dans le Passage Cristallin, après la Piste des Glaces, pour escalader le mont Arreat jusqu’au sommet.\",\n",
+                u8"    \"itIT\": \"Parla con Anya prima di proseguire lungo il Passaggio Cristallino, oltre il Sentiero Ghiacciato, per procedere fino alla Sommità dell'Arreat.\",\n",
+                u8"    \"koKR\": \"안야와 대화한 후, 수정 동굴을 통해 빙하의 길을 지나 아리앗 산의 정상으로 가십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Anyą zanim wyruszysz Kryształowym Przejściem za Lodowym Traktem i wejdziesz na szczyt góry Arreat.\",\n",
+                u8"    \"esMX\": \"Habla con Anya antes de atravesar el Pasaje Cristalino, más allá del Sendero Glacial, para llegar a la Cima del Monte Arreat.\",\n",
+                u8"    \"jaJP\": \"アニャと話し、〈結晶道〉を通って〈氷の道〉を越え、〈アリート山の頂き〉に到達する。\",\n",
+                u8"    \"ptBR\": \"Fale com Anya antes de prosseguir pela Passagem Cristalina, passar pela Trilha Glacial e subir o Monte Arreat até o Cume.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Аней, а затем пройдите через Ледяные пещеры, по Ледовому ходу и взойдите на вершину Арреата.\",\n",
+                u8"    \"zhCN\": \"先和安雅谈谈，然后穿过水晶通道、经过冰川小径、登上亚瑞特山，直抵山巅。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22637,\n",
+                u8"    \"Key\": \"qstsa5q5\",\n",
+                u8"    \"enUS\": \"Rite of Passage\",\n",
+                u8"    \"zhTW\": \"祭儀試煉\",\n",
+                u8"    \"deDE\": \"Initiationsritus\",\n",
+                u8"    \"esES\": \"Rito de iniciación\",\n",
+                u8"    \"frFR\": \"Rite de passage\",\n",
+                u8"    \"itIT\": \"Il rito del passaggio\",\n",
+                u8"    \"koKR\": \"통과의례\",\n",
+                u8"    \"plPL\": \"Rytuał przejścia\",\n",
+                u8"    \"esMX\": \"Rito de Iniciación\",\n",
+                u8"    \"jaJP\": \"通過儀礼\",\n",
+                u8"    \"ptBR\": \"Rito de Passagem\",\n",
+                u8"    \"ruRU\": \"Посвящение\",\n",
+                u8"    \"zhCN\": \"通过仪式\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22638,\n",
+                u8"    \"Key\": \"qstsa5q51\",\n",
+                u8"    \"enUS\": \"Travel through the Ancient's Way to find the Ancients at the Arreat Summit.\",\n",
+                u8"    \"zhTW\": \"沿著先祖之路行走，在亞瑞特山巔找到先祖。\",\n",
+                u8"    \"deDE\": \"Benutzt den Weg der Urahnen, um die Urahnen auf dem Gipfel des Arreat zu finden.\",\n",
+                u8"    \"esES\": \"Viaja a través del Camino de los Antiguos hasta la Cima Arreat para encontrar a los Antiguos.\",\n",
+                u8"    \"frFR\": \"Empruntez le Chemin des Anciens pour rencontrer les Anciens au Sommet du mont Arreat.\",\n",
+                u8"    \"itIT\": \"Percorri la Via degli Antichi per trovare gli Antichi sulla Sommità dell'Arreat.\",\n",
+                u8"    \"koKR\": \"고대인의 길을 통과하여 아리앗 정상에 있는 고대인을 찾으십시오.\",\n",
+                u8"    \"plPL\": \"Przejdź Drogą Starożytnych, by dostać się na szczyt Arreat.\",\n",
+                u8"    \"esMX\": \"Atraviesa el Camino de los Ancestros para encontrar a los Ancestros en la Cima de Arreat.\",\n",
+                u8"    \"jaJP\": \"〈古の道〉を通り、〈アリート山の頂き〉で〈古の民〉を探す。\",\n",
+                u8"    \"ptBR\": \"Atravesse Caminho dos Ancestrais para encontrar os Ancestrais no Cume de Arreat.\",\n",
+                u8"    \"ruRU\": \"Пройдите Путем Древних и найдите Древних на вершине Арреата.\",\n",
+                u8"    \"zhCN\": \"穿过先祖之路，找到亚瑞特之巅的几位先祖。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22639,\n",
+                u8"    \"Key\": \"qstsa5q52\",\n",
+                u8"    \"enUS\": \"Consult with the Ancients by activating the Altar of the Heavens.\",\n",
+                u8"    \"zhTW\": \"啟動天堂祭壇之後，與先祖交談。\",\n",
+                u8"    \"deDE\": \"Aktiviert den Altar des Himmels und sprecht mit den Urahnen.\",\n",
+                u8"    \"esES\": \"Consulta a los Antiguos activando el Altar de los Cielos.\",\n",
+                u8"    \"frFR\": \"Consultez les Anciens en activant l’Autel des Cieux.\",\n",
+                u8"    \"itIT\": \"Consulta gli Antichi attivando l'Altare dei Cieli.\",\n",
+                u8"    \"koKR\": \"천상의 제단을 활성화하여 고대인과 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Poradź się Starożytnych, aktywując Ołtarz Niebios.\",\n",
+                u8"    \"esMX\": \"Activa el Altar de los Cielos para comunicarte con los Ancestros.\",\n",
+                u8"    \"jaJP\": \"〈天国の祭壇〉を作動させて〈古の民〉に助言を求める。\",\n",
+                u8"    \"ptBR\": \"Fale com os Ancestrais ativando o Altar do Paraíso.\",\n",
+                u8"    \"ruRU\": \"Посоветуйтесь с Древними, активировав алтарь Небес.\",\n",
+                u8"    \"zhCN\": \"激活天坛寻求几位先祖的指引。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22640,\n",
+                u8"    \"Key\": \"qstsa5q53\",\n",
+                u8"    \"enUS\": \"Defeat all three Ancients without leaving Mount Arreat.\",\n",
+                u8"    \"zhTW\": \"在不離開亞瑞特山的情況下，打倒三位先祖。\",\n",
+                u8"    \"deDE\": \"Besiegt alle drei Urahnen, ohne den Berg Arreat zu verlassen.\",\n",
+                u8"    \"esES\": \"Derrota a los tres Antiguos sin salir del Monte Arreat.\",\n",
+                u8"    \"frFR\": \"Affrontez les trois Anciens sans quitter le mont Arreat.\",\n",
+                u8"    \"itIT\": \"Sconfiggi i tre Antichi senza abbandonare il monte Arreat.\",\n",
+                u8"    \"koKR\": \"아리앗 산을 떠나지 않고 고대인 세 명을 모두 쓰러뜨리십시오.\",\n",
+                u8"    \"plPL\": \"Pokonaj Starożytnych nie schodząc z góry Arreat.\",\n",
+                u8"    \"esMX\": \"Derrota a los tres Ancestros sin abandonar el Monte Arreat.\",\n",
+                u8"    \"jaJP\": \"アリート山を離れずに3人の〈古の民〉を全員倒す。\",\n",
+                u8"    \"ptBR\": \"Derrote os três Ancestrais sem sair do Monte Arreat.\",\n",
+                u8"    \"ruRU\": \"Победите всех трех Древних, не покидая горы Арреат.\",\n",
+                u8"    \"zhCN\": \"在不离开亚瑞特山的情况下打败三位先祖。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22641,\n",
+                u8"    \"Key\": \"qstsa5q6\",\n",
+                u8"    \"enUS\": \"Eve of Destruction\",\n",
+                u8"    \"zhTW\": \"毀滅的前夕\",\n",
+                u8"    \"deDE\": \"Vorabend der Vernichtung\",\n",
+                u8"    \"esES\": \"Víspera de la destrucción\",\n",
+                u8"    \"frFR\": \"Crépuscule de la Destruction\",\n",
+                u8"    \"itIT\": \"Nel cuore della distruzione\",\n",
+                u8"    \"koKR\": \"파괴의 전조\",\n",
+                u8"    \"plPL\": \"Wigilia Zniszczenia\",\n",
+                u8"    \"esMX\": \"Víspera de la Destrucción\",\n",
+                u8"    \"jaJP\": \"破滅の前夜\",\n",
+                u8"    \"ptBR\": \"Véspera da Destruição\",\n",
+                u8"    \"ruRU\": \"Удел Разрушения\",\n",
+                u8"    \"zhCN\": \"毁灭前夕\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22642,\n",
+                u8"    \"Key\": \"qstsa5q61\",\n",
+                u8"    \"enUS\": \"Consult with the Ancients.\",\n",
+                u8"    \"zhTW\": \"與先祖交談。\",\n",
+                u8"    \"deDE\": \"Besprecht Euch mit den Urahnen.\",\n",
+                u8"    \"esES\": \"Consulta a los antiguos.\",\n",
+                u8"    \"frFR\": \"Consultez les Anciens.\",\n",
+                u8"    \"itIT\": \"Consulta gli Antichi.\",\n",
+                u8"    \"koKR\": \"고대인들에게 조언을 구하십시오.\",\n",
+                u8"    \"plPL\": \"Poradź się Starożytnych.\",\n",
+                u8"    \"esMX\": \"Habla con los Ancestros.\",\n",
+                u8"    \"jaJP\": \"〈古の民〉に助言を求める。\",\n",
+                u8"    \"ptBR\": \"Fale com os Ancestrais.\",\n",
+                u8"    \"ruRU\": \"Спросите совета Древних.\",\n",
+                u8"    \"zhCN\": \"寻求先祖的指引。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22643,\n",
+                u8"    \"Key\": \"qstsa5q62\",\n",
+                u8"    \"enUS\": \"Kill Baal.\",\n",
+                u8"    \"zhTW\": \"殺死巴爾。\",\n",
+                u8"    \"deDE\": \"Tötet Baal.\",\n",
+                u8"    \"esES\": \"Mata a Baal.\",\n",
+                u8"    \"frFR\": \"Tuez Baal.\",\n",
+                u8"    \"itIT\": \"Uccidi Baal.\",\n",
+                u8"    \"koKR\": \"바알을 처치하십시오.\",\n",
+                u8"    \"plPL\": \"Zabij Baala.\",\n",
+                u8"    \"esMX\": \"Mata a Baal.\",\n",
+                u8"    \"jaJP\": \"バールを倒す。\",\n",
+                u8"    \"ptBR\": \"Mate Baal.\",\n",
+                u8"    \"ruRU\": \"Убейте Баала.\",\n",
+                u8"    \"zhCN\": \"消灭巴尔。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22644,\n",
+                u8"    \"Key\": \"qstsa5q63\",\n",
+                u8"    \"enUS\": \"Talk to Tyreal.\",\n",
+                u8"    \"zhTW\": \"與泰瑞爾交談。\",\n",
+                u8"    \"deDE\": \"Sprecht mit Tyrael.\",\n",
+                u8"    \"esES\": \"Habla con Tyrael.\",\n",
+                u8"    \"frFR\": \"Parlez à Tyraël.\",\n",
+                u8"    \"itIT\": \"Parla con Tyrael.\",\n",
+                u8"    \"koKR\": \"티리엘과 대화하십시오.\",\n",
+                u8"    \"plPL\": \"Porozmawiaj z Tyraelem.\",\n",
+                u8"    \"esMX\": \"Habla con Tyrael.\",\n",
+                u8"    \"jaJP\": \"ティラエルと話す。\",\n",
+                u8"    \"ptBR\": \"Fale com Tyreal.\",\n",
+                u8"    \"ruRU\": \"Поговорите с Тираэлем.\",\n",
+                u8"    \"zhCN\": \"与泰瑞尔交谈。\"\n",
+                u8"  },\n",
+                u8"  {\n",
+                u8"    \"id\": 22645,\n",
+                u8"    \"Key\": \"qstsa5q64\",\n",
+                u8"    \"enUS\": \"Take Tyreal's Portal to Safety.\",\n",
+                u8"    \"zhTW\": \"利用泰瑞爾的傳送門前往安全的地方。\",\n",
+                u8"    \"deDE\": \"Bringt Euch durch Tyraels Portal in Sicherheit.\",\n",
+                u8"    \"esES\": \"Toma el portal de Tyrael para ponerte a salvo.\",\n",
+                u8"    \"frFR\": \"Prenez le Portail de Tyraël.\",\n",
+                u8"    \"itIT\": \"Usa il portale di Tyrael per metterti in salvo.\",\n",
+                u8"    \"koKR\": \"티리엘의 차원문을 통해 안전한 곳으로 가십시오.\",\n",
+                u8"    \"plPL\": \"Przejdź portalem Tyraela w bezpieczne miejsce.\",\n",
+                u8"    \"esMX\": \"Atraviesa el portal de Tyrael hacia un lugar seguro.\",\n",
+                u8"    \"jaJP\": \"ティラエルが開いたポータルで安全な場所に移動する。\",\n",
+                u8"    \"ptBR\": \"Use o Portal de Tyreal para chegar a um lugar seguro.\",\n",
+                u8"    \"ruRU\": \"Отправляйтесь через портал Тираэля в безопасное место.\",\n",
+                u8"    \"zhCN\": \"使用泰瑞尔的传送门前往安全地带。\"\n",
+                u8"  }\n",
+                u8"]\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,254 +18,250 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetSkillDesc()
+        EmbeddedText GetSkillDesc()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"skilldesc\tSkillPage\tSkillRow\tSkillColumn\tListRow\tIconCel\tHireableIconCel\tstr name\tstr short\tstr long\tstr alt\tdescdam\tddam calc1\tddam calc2\tp1dmelem\tp1dmmin\tp1dmmax\tp2dmelem\tp2dmmin\tp2dmmax\tp3dmelem\tp3dmmin\tp3dmmax\tdescatt\tdescmissile1\tdescmissile2\tdescmissile3\tdescline1\tdesctexta1\tdesctextb1\tdesccalca1\tdesccalcb1\tdescline2\tdesctexta2\tdesctextb2\tdesccalca2\tdesccalcb2\tdescline3\tdesctexta3\tdesctextb3\tdesccalca3\tdesccalcb3\tdescline4\tdesctexta4\tdesctextb4\tdesccalca4\tdesccalcb4\tdescline5\tdesctexta5\tdesctextb5\tdesccalca5\tdesccalcb5\tdescline6\tdesctexta6\tdesctextb6\tdesccalca6\tdesccalcb6\tdsc2line1\tdsc2texta1\tdsc2textb1\tdsc2calca1\tdsc2calcb1\tdsc2line2\tdsc2texta2\tdsc2textb2\tdsc2calca2\tdsc2calcb2\tdsc2line3\tdsc2texta3\tdsc2textb3\tdsc2calca3\tdsc2calcb3\tdsc2line4\tdsc2texta4\tdsc2textb4\tdsc2calca4\tdsc2calcb4\tdsc2line5\tdsc2texta5\tdsc2textb5\tdsc2calca5\tdsc2calcb5\tdsc3line1\tdsc3texta1\tdsc3textb1\tdsc3calca1\tdsc3calcb1\tdsc3line2\tdsc3texta2\tdsc3textb2\tdsc3calca2\tdsc3calcb2\tdsc3line3\tdsc3texta3\tdsc3textb3\tdsc3calca3\tdsc3calcb3\tdsc3line4\tdsc3texta4\tdsc3textb4\tdsc3calca4\tdsc3calcb4\tdsc3line5\tdsc3texta5\tdsc3textb5\tdsc3calca5\tdsc3calcb5\tdsc3line6\tdsc3texta6\tdsc3textb6\tdsc3calca6\tdsc3calcb6\tdsc3line7\tdsc3texta7\tdsc3textb7\tdsc3calca7\tdsc3calcb7\titem proc text\titem proc descline count\t*eol\n";
-                ss << u8"attack\t0\t0\t0\t0\t2\t\tskillname0\tskillld0\tskillld0\tskillan0\t1\t\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"kick\t0\t0\t0\t-1\t0\t\tskillname1\tskillld1\tskillld1\tskillan1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"throw\t0\t0\t0\t0\t6\t\tskillname2\tskillld2\tskillld2\tskillan2\t3\t\t\t\t\t\t\t\t\t\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"unsummon\t0\t0\t0\t0\t4\t\tskillname3\tskillld3\tskillld3\tskillan3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"left hand throw\t0\t0\t0\t0\t12\t\tskillname4\tskillld4\tskillld4\tskillan4\t4\t\t\t\t\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"left hand swing\t0\t0\t0\t-1\t10\t\tskillname5\tskillld5\tskillld5\tskillan5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"magic arrow\t1\t1\t2\t1\t0\t\tskillname6\tskillld6\tskillld6\tskillan6\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 0)\"\t256\t74\tStrSkillDamageFlat\t\tpnma\t\t74\tStrSkill22\t\ttoht\t\t74\tConvphy2elemalt\t\t5+(lvl-1)*2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fire arrow\t1\t1\t3\t1\t2\t1\tskillname7\tskillxld7\tskillxld7\tskillan7\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill5\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t74\tConvphy2magalt\t\t3+(lvl-1)*2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname7\t2\t\t76\tFiredplev\tskillname16\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"inner sight\t2\t1\t1\t2\t4\t0\tskillname8\tskillld8\tskillld8\tskillan8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t74\tStrSkillEnemyDefenseFlatBonus\t\t-edmn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln56*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"critical strike\t2\t1\t3\t2\t6\t\tskillname9\tskillld9\tskillld9\tskillan9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"jab\t3\t1\t1\t3\t8\t5\tskillname10\tskillld10\tskillld10\tskillan10\t7\tln34\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDamagePercent\t\tln34\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkill61\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"cold arrow\t1\t2\t1\t1\t10\t3\tskillname11\tskillxld11\tskillxld11\tskillan11\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t74\tConvphy2magalt\t\t3+(lvl-1)*2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname11\t2\t\t76\tColddplev\tskillname21\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"multiple shot\t1\t2\t2\t1\t12\t\tskillname12\tskillld12\tskillld12\tskillan12\t7\tskill('Guided Arrow'.blvl) * par4\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill9\t\t\"min(24,ln12)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tWeapDamsk\t\t(96*100/128)+(skill('Guided Arrow'.blvl)*par4)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname12\t2\t\t76\tDamplev\tskillname22\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"dodge\t2\t2\t2\t2\t14\t\tskillname13\tskillld13\tskillld13\tskillan13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"power strike\t3\t2\t2\t3\t16\t\tskillname14\tskillld14\tskillld14\tskillan14\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname14\t2\t\t76\tLtngdplev\tskillname20\tpar8\t\t76\tLtngdplev\tskillname24\tpar8\t\t76\tLtngdplev\tskillname34\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"poison javelin\t3\t2\t3\t3\t18\t\tskillname15\tskillld15\tskillld15\tskillan15\t22\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname15\t2\t\t76\tPoisdplev\tskillname25\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"exploding arrow\t1\t3\t3\t1\t20\t2\tskillname16\tskillxld16\tskillxld16\tskillan16\t6\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill5\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname16\t2\t\t76\tFiredplev\tskillname7\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"slow missiles\t2\t3\t1\t2\t22\t\tskillname17\tskillld17\tskillld17\tskillan17\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln56*2\t3\t74\tModStr2uPercent\t\tdm78\t\t74\tStrSkill67\t\t100-dm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"avoid\t2\t3\t2\t2\t24\t\tskillname18\tskillld18\tskillld18\tskillan18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"impale\t3\t3\t1\t3\t26\t\tskillname19\tskillld19\tskillld19\tskillan19\t7\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill65\t\tpar6-dm34\t\t74\tCgslow\t\tdm78\t\t74\tStrSkillDamagePercent\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t18\tStrSkillUninterruptable\t\t\t\t18\tStrSkillAlwaysHits\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lightning bolt\t3\t3\t3\t3\t28\t\tskillname20\tskillld20\tskillld20\tskillan20\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tConvphy2magalt\t\t100\t\t74\tWeapDamsk\t\t96*100/128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname20\t2\t\t76\tLtngdplev\tskillname14\tpar8\t\t76\tLtngdplev\tskillname24\tpar8\t\t76\tLtngdplev\tskillname34\tpar8\t\t76\tLtngdplev\tskillname35\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"ice arrow\t1\t4\t1\t1\t30\t\tskillname21\tskillxld21\tskillxld21\tskillan21\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFreezeLengthSingular\tStrSkill62\tedln\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname21\t2\t\t76\tColddplev\tskillname11\tpar8\t\t76\tFrezLenplev\tskillname31\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"guided arrow\t1\t4\t2\t1\t32\t\tskillname22\tskillld22\tskillld22\tskillan22\t7\tln34 + (skill('Multiple Shot'.blvl)*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 1)\"\t256\t74\tStrSkillDamagePercent\t\tln34 + (skill('Multiple Shot'.blvl)*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillAlwaysHits\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname22\t2\t\t76\tDamplev\tskillname12\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"penetrate\t2\t4\t3\t2\t34\t\tskillname23\tskillld23\tskillld23\tskillan23\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill22\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"charged strike\t3\t4\t2\t3\t36\t\tskillname24\tskillld24\tskillld24\tskillan24\t17\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill72\t\tpar1 + lvl/par2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname24\t2\t\t76\tLtngdplev\tskillname14\tpar8\t\t76\tLtngdplev\tskillname20\tpar8\t\t76\tLtngdplev\tskillname34\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"plague javelin\t3\t4\t3\t3\t38\t\tskillname25\tskillld25\tskillld25\tskillan25\t22\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname25\t2\t\t76\tPoisdplev\tskillname15\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"strafe\t1\t5\t2\t1\t40\t\tskillname26\tskillld26\tskillld26\tskillan26\t7\tln12 + (skill('Guided Arrow'.blvl)*par8) + (skill('Multiple Shot'.blvl)*par9)\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillDamagePercent\t\tln12 + (skill('Guided Arrow'.blvl)*par8) + (skill('Multiple Shot'.blvl)*par9)\t\t74\tStrSkill86\t\t\"min(lvl+par3,par4)\"\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname26\t2\t\t76\tDamplev\tskillname12\tpar9\t\t76\tDamplev\tskillname22\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"immolation arrow\t1\t5\t3\t1\t42\t\tskillname27\tskillxld27\tskillxld27\tskillan27\t6\t\t\t\t\t\t\t\t\t\t\t\t1\timmolationfire\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFireDurationSingular\tStrSkill82\tmiss('immolationfire'.rang)\t25\t75\tStrSkillFireDamageAveragePerSecond\t\tm1eo*25*3*(mael+100)/100/256\tm1ey*25*3*(mael+100)/100/256\t75\tStrSkill83\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname27\t2\t\t76\tAFDImm\tskillname7\t5\t\t76\tFiredplev\tskillname16\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"dopplezon\t2\t5\t1\t2\t44\t\tskillname28\tskillld28\tskillld28\tskillan28\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 1)\"\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkillLifePercent\t\tlvl*par4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"evade\t2\t5\t2\t2\t46\t\tskillname29\tskillld29\tskillld29\tskillan29\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fend\t3\t5\t1\t3\t48\t\tskillname30\tskillld30\tskillld30\tskillan30\t7\tln34\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillDamagePercent\t\tln34\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"freezing arrow\t1\t6\t1\t1\t50\t4\tskillname31\tskillxld31\tskillxld31\tskillan31\t6\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFreezeLengthSingular\tStrSkill62\tedln\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tpar1*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname31\t2\t\t76\tColddplev\tskillname11\tpar8\t\t76\tFrezLenplev\tskillname21\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"valkyrie\t2\t6\t1\t2\t52\t\tskillname32\tskillld32\tskillld32\tskillan32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill21\t\t(lvl-1)*par3\t\t74\tStrSkillDamagePercent\t\tpar2*(lvl-1)\t\t74\tStrSkill22\t\ttoht\t\t13\tStrSkill42\t\tpar1 * (lvl - 1) + skill('Dopplezon'.blvl) * par8\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname32\t2\t\t76\tHpplev\tskillname28\tpar8\t\t76\tAttRateplev\tskillname23\t40\t\t18\tskillname9\t\t\t\t18\tskillname13\t\t\t\t18\tskillname18\t\t\t\t18\tskillname29\t\t\t\t\t\t0\n";
-                ss << u8"pierce\t2\t6\t3\t2\t54\t\tskillname33\tskillld33\tskillld33\tskillan33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lightning strike\t3\t6\t2\t3\t56\t\tskillname34\tskillld34\tskillld34\tskillan34\t17\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill11\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname34\t2\t\t76\tLtngdplev\tskillname14\tpar8\t\t76\tLtngdplev\tskillname20\tpar8\t\t76\tLtngdplev\tskillname24\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lightning fury\t3\t6\t3\t3\t58\t\tskillname35\tskillld35\tskillld35\tskillan35\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkillReleasesBolts\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname35\t2\t\t76\tLtngdplev\tskillname14\tpar8\t\t76\tLtngdplev\tskillname20\tpar8\t\t76\tLtngdplev\tskillname24\tpar8\t\t76\tLtngdplev\tskillname34\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fire bolt\t1\t1\t2\t1\t0\t13\tskillname36\tskillld36\tskillld36\tskillan36\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname36\t2\t\t76\tFiredplev\tskillname47\tpar8\t\t76\tFiredplev\tskillname56\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"warmth\t1\t1\t3\t1\t2\t\tskillname37\tskillld37\tskillld37\tskillan37\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill88\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"charged bolt\t2\t1\t2\t2\t4\t19\tskillname38\tskillld38\tskillld38\tskillan38\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill27\t\t\"min(24,ln12)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname38\t2\t\t76\tLtngdplev\tskillname49\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"ice bolt\t3\t1\t2\t3\t6\t\tskillname39\tskillld39\tskillld39\tskillan39\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname39\t2\t\t76\tColddplev\tskillname44\tpar8\t\t76\tColddplev\tskillname45\tpar8\t\t76\tColddplev\tskillname55\tpar8\t\t76\tColddplev\tskillname59\tpar8\t\t76\tColddplev\tskillname64\tpar8\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"frozen armor\t3\t1\t3\t3\t8\t18\tskillname40\tskillld40\tskillld40\tskillan40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34+(skill('Shiver Armor'.blvl)+skill('Chilling Armor'.blvl))*par7\t25\t36\tStrSkillFreezeLengthSingular\tStrSkill62\tln56*(100+((skill('Shiver Armor'.blvl)+skill('Chilling Armor'.blvl))*par8))/100\t25\t74\tStrSkill21\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname40\t2\t\t76\tFrezLenplev\tskillname50\tpar8\t\t76\tSecplev2\tskillname50\t(par7 + 12)/25\t\t76\tFrezLenplev\tskillname60\tpar8\t\t76\tSecplev2\tskillname60\t(par7 + 12)/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"inferno\t1\t2\t1\t1\t10\t12\tskillname41\tskillld41\tskillld41\tskillan41\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillManaCostPerSecond\t\tmps\t\t36\tStrSkillRangeSingular\tStrSkill56\tln12/4*2\t3\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*12/256\texms*12/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill115\t\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname41\t2\t\t76\tFiredplev\tskillname37\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"static field\t2\t2\t1\t2\t12\t21\tskillname42\tskillxld42\tskillxld42\tskillan42\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill33\t\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"telekinesis\t2\t2\t3\t2\t14\t\tskillname43\tskillld43\tskillld43\tskillan43\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"frost nova\t3\t2\t1\t3\t16\t\tskillname44\tskillld44\tskillld44\tskillan44\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname44\t2\t\t76\tColddplev\tskillname59\tpar8\t\t76\tColddplev\tskillname64\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"ice blast\t3\t2\t2\t3\t18\t16\tskillname45\tskillld45\tskillld45\tskillan45\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFreezeLengthSingular\tStrSkill29\tedln\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname45\t2\t\t76\tColddplev\tskillname39\tpar8\t\t76\tFrezLenplev\tskillname55\tpar7\t\t76\tColddplev\tskillname59\tpar8\t\t76\tColddplev\tskillname64\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"blaze\t1\t3\t1\t1\t20\t\tskillname46\tskillld46\tskillld46\tskillan46\t9\t\t\t\t\t\t\t\t\t\t\t\t\tblaze\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillBlazeDuration\tStrSkillBlazeDuration\tdm12\t25\t74\tStrSkill89\t\tln34\t\t36\tStrSkillFireDurationSingular\tStrSkill82\tmiss('blaze'.rang)\t25\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*25*3/256\texms*25*3/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname46\t2\t\t76\tFiredplev\tskillname37\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fire ball\t1\t3\t2\t1\t22\t14\tskillname47\tskillld47\tskillld47\tskillan47\t5\t\t\t\t\t\t\t\t\t\t\t\t\tfireball\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tpar1*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname47\t2\t\t76\tFiredplev\tskillname36\tpar8\t\t76\tFiredplev\tskillname56\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"nova\t2\t3\t1\t2\t24\t\tskillname48\tskillld48\tskillld48\tskillan48\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname48\t2\t\t76\tLtngdplev\tskillname42\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lightning\t2\t3\t2\t2\t26\t20\tskillname49\tskillld49\tskillld49\tskillan49\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname49\t2\t\t76\tLtngdplev\tskillname38\tpar8\t\t76\tLtngdplev\tskillname48\tpar8\t\t76\tLtngdplev\tskillname53\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"shiver armor\t3\t3\t3\t3\t28\t\tskillname50\tskillld50\tskillld50\tskillan50\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34+(skill('Frozen Armor'.blvl)+skill('Chilling Armor'.blvl))*par7\t25\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill21\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname50\t2\t\t76\tColddplev\tskillname40\tpar8\t\t76\tSecplev2\tskillname40\t(par7 + 12)/25\t\t76\tColddplev\tskillname60\tpar8\t\t76\tSecplev2\tskillname60\t(par7 + 12)/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fire wall\t1\t4\t1\t1\t30\t\tskillname51\tskillld51\tskillld51\tskillan51\t9\t\t\t\t\t\t\t\t\t\t\t\t\tfirewallmaker\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRangeSingular\tStrSkill56\tm1rn*2\t3\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*25*3/256\texms*25*3/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t35\t25\t36\tStrSkillFireDurationSingular\tStrSkill82\tmiss('firewall'.rang)\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname51\t2\t\t76\tFiredplev\tskillname37\tpar8\t\t76\tFiredplev\tskillname41\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"enchant\t1\t4\t3\t1\t32\t15\tskillname52\tskillld52\tskillld52\tskillan52\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t75\tStrSkill5\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname52\t2\t\t76\tFiredplev\tskillname37\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"chain lightning\t2\t4\t2\t2\t34\t\tskillname53\tskillld53\tskillld53\tskillan53\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill11\t\tln34/par5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname53\t2\t\t76\tLtngdplev\tskillname38\tpar8\t\t76\tLtngdplev\tskillname48\tpar8\t\t76\tLtngdplev\tskillname49\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"teleport\t2\t4\t3\t2\t36\t\tskillname54\tskillld54\tskillld54\tskillan54\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 1)\"\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"glacial spike\t3\t4\t2\t3\t38\t17\tskillname55\tskillld55\tskillld55\tskillan55\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFreezeLengthSingular\tStrSkill29\tln34 * (100 + skill('Blizzard'.blvl) * par7) / 100\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname55\t2\t\t76\tColddplev\tskillname39\tpar8\t\t76\tColddplev\tskillname45\tpar8\t\t76\tFrezLenplev\tskillname59\tpar7\t\t76\tColddplev\tskillname64\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"meteor\t1\t5\t2\t1\t40\t\tskillname56\tskillld56\tskillld56\tskillan56\t5\t\t\t\t\t\t\t\t\t\t\t\t\tmeteorfire\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkillFireDamageAveragePerSecond\t\tm1eo*25*3*(mael+100)/100/256\tm1ey*25*3*(mael+100)/100/256\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t30\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname56\t2\t\t76\tFiredplev\tskillname36\tpar8\t\t76\tFiredplev\tskillname47\tpar8\t\t76\tAFDImm\tskillname41\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"thunder storm\t2\t5\t1\t2\t42\t\tskillname57\tskillld57\tskillld57\tskillan57\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tpar7*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname57\t2\t\t76\tLtngdplev\tskillname42\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"energy shield\t2\t5\t3\t2\t44\t\tskillname58\tskillld58\tskillld58\tskillan58\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkill41\t\t\"min(edmn,95)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillManaConsumedRatio\t\t(par5)*100/16-skill('Telekinesis'.blvl)*100/16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname58\t2\t\t76\tStrSkillManaConsumedSynergy\tskillname43\t-6.25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"blizzard\t3\t5\t1\t3\t46\t\tskillname59\tskillld59\tskillld59\tskillan59\t5\t\t\t\t\t\t\t\t\t\t\t\t\tblizzardcenter\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tmiss('blizzardcenter'.rang)\t25\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t45\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname59\t2\t\t76\tColddplev\tskillname39\tpar8\t\t76\tColddplev\tskillname45\tpar8\t\t76\tColddplev\tskillname55\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"chilling armor\t3\t5\t3\t3\t48\t25\tskillname60\tskillld60\tskillld60\tskillan60\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34+(skill('Frozen Armor'.blvl)+skill('Shiver Armor'.blvl))*par7\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill21\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname60\t2\t\t76\tColddplev\tskillname40\tpar8\t\t76\tSecplev2\tskillname40\t(par7 + 12)/25\t\t76\tColddplev\tskillname50\tpar8\t\t76\tSecplev2\tskillname50\t(par7 + 12)/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fire mastery\t1\t6\t2\t1\t50\t\tskillsname61\tskillld61\tskillld61\tskillan61\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillFireDamagePercent\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"hydra\t1\t6\t3\t1\t52\t\tskillname62\tskillld62\tskillld62\tskillan62\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill113\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkillHydraMax\t\tpar3/3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname62\t2\t\t76\tFiredplev\tskillname36\tpar8\t\t76\tFiredplev\tskillname47\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lightning mastery\t2\t6\t2\t2\t54\t\tskillname63\tskillxld63\tskillxld63\tskillan63\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillLightningDamagePercent\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"frozen orb\t3\t6\t1\t3\t56\t\tskillname64\tskillld64\tskillld64\tskillan64\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname64\t2\t\t76\tColddplev\tskillname39\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"cold mastery\t3\t6\t2\t3\t58\t\tskillname65\tskillld65\tskillld65\tskillan65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tModitemenrescoldsk\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"amplify damage\t1\t1\t2\t1\t0\t\tskillname66\tskillld66\tskillld66\tskillan66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill37\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"teeth\t2\t1\t2\t2\t2\t\tskillname67\tskillld67\tskillld67\tskillan67\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t74\tStrSkill28\t\t\"min(ln12,24)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname67\t2\t\t76\tMagdplev\tskillname78\tpar8\t\t76\tMagdplev\tskillname84\tpar8\t\t76\tMagdplev\tskillname88\tpar8\t\t76\tMagdplev\tskillname93\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bone armor\t2\t1\t3\t2\t4\t\tskillname68\tskillld68\tskillld68\tskillan68\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill40\t\t(ln12 + (skill('Bone Wall'.blvl) + skill('Bone Prison'.blvl)) * par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname68\t2\t\t76\tDamabsplev\tskillname78\tpar8\t\t76\tDamabsplev\tskillname88\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"skeleton mastery\t3\t1\t1\t3\t6\t\tskillname69\tskillld69\tskillld69\tskillan69\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillSleketonMasteryMonsterDamage\t\tlvl*par4\t\t74\tStrSkill97\t\tlvl*par3\t\t74\tStrSkill43\t\t(lvl < 2) ? 0 : skill('Skeleton Mastery'.lvl)\t\t74\tStrSkill96\tStrSkill42\tlvl*par1\t\t74\tStrSkillSleketonMasterySkeletonDamage\t\tlvl*par2\t\t74\tStrSkill95\t\tlvl*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"raise skeleton\t3\t1\t3\t3\t8\t\tskillname70\tskillld70\tskillld70\tskillan70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkill94\tStrSkill44\t(lvl < 4) ?lvl:(2+lvl/3)\t\t74\tStrSkillDefense\t\t5+(lvl+skill('Skeleton Mastery'.lvl))*par5\t\t74\tStrSkillDamagePercent\t\t((lvl < 4) ? 0 : ((lvl-3)*par3))\t\t74\tStrSkillAttackRating\t\t5+(lvl+skill('Skeleton Mastery'.lvl))*par4\t\t13\tStrSkill42\t\t(lvl < 4) ? 0 : (par2 * (lvl - 3))\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par1)\t34\tStrSkill4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname70\t2\t\t18\tskillname69\t\t\t\t18\tskillname89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"dim vision\t1\t2\t1\t1\t10\t\tskillname71\tskillld71\tskillld71\tskillan71\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"weaken\t1\t2\t3\t1\t12\t\tskillname72\tskillld72\tskillld72\tskillan72\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill38\t\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"poison dagger\t2\t2\t1\t2\t14\t\tskillname73\tskillld73\tskillld73\tskillan73\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname73\t2\t\t76\tPoisdplev\tskillname83\tpar8\t\t76\tPoisdplev\tskillname92\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"corpse explosion\t2\t2\t2\t2\t16\t\tskillname74\tskillld74\tskillld74\tskillan74\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln34\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill46\t\tpar1\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"clay golem\t3\t2\t2\t3\t18\t\tskillname75\tskillld75\tskillld75\tskillan75\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t34\tStrSkill4\t\t\t\t74\tCgslow\t\tdm34\t\t74\tStrSkillAttackRatingFlatBonus\t\tlvl*par8\t\t13\tStrSkill42\t\t(100+(par1 * (lvl - 1)))*(100+skill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8)))/100-100\t\t\t\t\t\t\t74\tStrSkillDefense\t\t100+skill('IronGolem'.lvl)*skill('IronGolem'.par8)\t\t74\tStrSkillAttackRating\t\t40 + skill('Golem Mastery'.ln56) + (lvl*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname75\t2\t\t18\tskillname79\t\t\t\t18\tskillname89\t\t\t\t76\tHpplev\tskillname85\tskill('BloodGolem'.par8)\t\t76\tStrSkillDefensePerLevelFlat\tskillname90\tskill('IronGolem'.par8)\t\t76\tDamplev\tskillname94\tskill('FireGolem'.par8)\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"iron maiden\t1\t3\t2\t1\t20\t\tskillname76\tskillld76\tskillld76\tskillan76\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t74\tStrSkill55\t\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"terror\t1\t3\t3\t1\t22\t\tskillname77\tskillld77\tskillld77\tskillan77\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bone wall\t2\t3\t3\t2\t24\t\tskillname78\tskillld78\tskillld78\tskillan78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t13\tStrSkill42\t\t(par1 * (lvl-1)) + ((skill('Bone Armor'.blvl)+skill('Bone Prison'.blvl))*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tpar2\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname78\t2\t\t76\tHpplev\tskillname68\tpar8\t\t76\tHpplev\tskillname88\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"golem mastery\t3\t3\t1\t3\t26\t\tskillname79\tskillld79\tskillld79\tskillan79\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill89\t\tdm34\t\t74\tStrSkillAttackRatingFlatBonus\t\tln56\t\t74\tStrSkillLifePercent\t\tlvl*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"raise skeletal mage\t3\t3\t3\t3\t28\t\tskillname80\tskillld80\tskillld80\tskillan80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkill43a\tStrSkill44a\t(lvl < 4) ?lvl:(2+lvl/3)\t\t74\tStrSkillDefense\t\t(lvl+skill('Skeleton Mastery'.lvl))*par5\t\t13\tStrSkill42\t\t(lvl < 4) ? 0 : (par2 * (lvl - 3))\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname80\t2\t\t18\tskillname69\t\t\t\t18\tskillname89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"confuse\t1\t4\t1\t1\t30\t\tskillname81\tskillld81\tskillld81\tskillan81\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"life tap\t1\t4\t2\t1\t32\t\tskillname82\tskillld82\tskillld82\tskillan82\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill79\t\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"poison explosion\t2\t4\t1\t2\t34\t\tskillname83\tskillld83\tskillld83\tskillan83\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname83\t2\t\t76\tPoisdplev\tskillname73\tpar8\t\t76\tPoisdplev\tskillname92\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bone spear\t2\t4\t2\t2\t36\t\tskillname84\tskillld84\tskillld84\tskillan84\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname84\t2\t\t76\tMagdplev\tskillname67\tpar8\t\t76\tMagdplev\tskillname78\tpar8\t\t76\tMagdplev\tskillname88\tpar8\t\t76\tMagdplev\tskillname93\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bloodgolem\t3\t4\t2\t3\t38\t\tskillname85\tskillld85\tskillld85\tskillan85\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t34\tStrSkill4\t\t\t\t74\tStrSkill80\t\tdm12\t\t13\tStrSkill42\t\t(100 + (par7 * (lvl - 1)))*(100 + skill('Golem Mastery'.ln12))/100 - 100\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDefense\t\t120+skill('IronGolem'.lvl)*skill('IronGolem'.par8)\t\t74\tStrSkillAttackRating\t\t60 + skill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname85\t2\t\t18\tskillname79\t\t\t\t18\tskillname89\t\t\t\t76\tStrSkillAttackRatingPerLevelFlat\tskillname75\tskill('Clay Golem'.par8)\t\t76\tStrSkillDefensePerLevelFlat\tskillname90\tskill('IronGolem'.par8)\t\t76\tDamplev\tskillname94\tskill('FireGolem'.par8)\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"attract\t1\t5\t1\t1\t40\t\tskillname86\tskillxld86\tskillxld86\tskillan86\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"decrepify\t1\t5\t3\t1\t42\t\tskillname87\tskillld87\tskillld87\tskillan87\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill89\t\tpar5\t\t74\tStrSkill106\t\tpar5\t\t74\tStrSkill37\t\t0\t\t74\tStrSkill38\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bone prison\t2\t5\t3\t2\t44\t\tskillname88\tskillld88\tskillld88\tskillan88\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 1)\"\t256\t13\tStrSkill42\t\t(par1 * (lvl-1)) + ((skill('Bone Armor'.blvl)+skill('Bone Wall'.blvl))*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tpar2\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname88\t2\t\t76\tHpplev\tskillname68\tpar8\t\t76\tHpplev\tskillname78\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"summon resist\t3\t5\t1\t3\t46\t\tskillname89\tskillld89\tskillld89\tskillan89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill54\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"irongolem\t3\t5\t2\t3\t48\t\tskillname90\tskillld90\tskillld90\tskillan90\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDefenseFlatBonus\t\tlvl*par8\t\t74\tStrSkill55\t\tln12\t\t18\tStrSkill112\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDefense\t\t140+lvl*par8\t\t34\tStrSkill4\t\t\t\t74\tStrSkillAttackRating\t\t80 + skill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\t\t13\tStrSkill42\t\tskill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8))\t\t40\tSksyn\tskillname90\t2\t\t18\tskillname79\t\t\t\t18\tskillname89\t\t\t\t76\tStrSkillAttackRatingPerLevelFlat\tskillname75\tskill('Clay Golem'.par8)\t\t76\tHpplev\tskillname85\tskill('BloodGolem'.par8)\t\t76\tDamplev\tskillname94\tskill('FireGolem'.par8)\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lower resist\t1\t6\t2\t1\t50\t\tskillname91\tskillld91\tskillld91\tskillan91\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill54\t\t-dm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"poison nova\t2\t6\t1\t2\t52\t\tskillname92\tskillld92\tskillld92\tskillan92\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname92\t2\t\t76\tPoisdplev\tskillname73\tpar8\t\t76\tPoisdplev\tskillname83\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bone spirit\t2\t6\t2\t2\t54\t\tskillname93\tskillld93\tskillld93\tskillan93\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname93\t2\t\t76\tMagdplev\tskillname67\tpar8\t\t76\tMagdplev\tskillname78\tpar8\t\t76\tMagdplev\tskillname84\tpar8\t\t76\tMagdplev\tskillname88\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"firegolem\t3\t6\t2\t3\t56\t\tskillname94\tskillld94\tskillld94\tskillan94\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkillHolyFireDamageRange\t\tsklvl('Holy Fire'.ln56.edmn)\tsklvl('Holy Fire'.ln56.edmx)*((100+sklvl('Holy Fire'.ln56.par6))/100)\t41\tStrSkill5\t\tedmn+sklvl('Holy Fire'.ln56.edmn)*sklvl('Holy Fire'.ln56.par5)\tedmx+sklvl('Holy Fire'.ln56.edmx)*sklvl('Holy Fire'.ln56.par5)\t74\tStrSkill103\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDefense\t\t200+skill('IronGolem'.lvl)*skill('IronGolem'.par8)\t\t74\tStrSkillAttackRating\t\t120 + skill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\t\t13\tStrSkill42\t\tskill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8))\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname94\t2\t\t18\tskillname79\t\t\t\t18\tskillname89\t\t\t\t76\tStrSkillAttackRatingPerLevelFlat\tskillname75\tskill('Clay Golem'.par8)\t\t76\tHpplev\tskillname85\tskill('BloodGolem'.par8)\t\t76\tStrSkillDefensePerLevelFlat\tskillname90\tskill('IronGolem'.par8)\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"revive\t3\t6\t3\t3\t58\t\tskillname95\tskillld95\tskillld95\tskillan95\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillMonstersCount\t\tlvl\t\t\t\t\t\t \t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t74\tStrSkillDamagePercent\t\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par4)\t\t74\tStrSkillLifePercent\t\tpar1 + skill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par3)\t\t\t\t\t\t\t40\tSksyn\tskillname95\t2\t\t18\tskillname69\t\t\t\t18\tskillname89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"sacrifice\t1\t1\t1\t1\t0\t\tskillname96\tskillld96\tskillld96\tskillan96\t7\tln12+skill('Redemption'.blvl)*par8+skill('Fanaticism'.blvl)*par7\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillDamagePercent\t\tln12+skill('Redemption'.blvl)*par8+skill('Fanaticism'.blvl)*par7\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill47\t\t\"max(par6, par5-lvl/par3)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname96\t2\t\t76\tDamplev\tskillname124\tpar8\t\t76\tDamplev\tskillname122\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"smite\t1\t1\t3\t1\t2\t\tskillname97\tskillld97\tskillld97\tskillan97\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,ln12)\"\t25\t74\tStrSkillDamagePercent\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t18\tStrSkillAlwaysHits\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"might\t2\t1\t1\t2\t4\t11\tskillname98\tskillld98\tskillld98\tskillan98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkillDamagePercent\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"prayer\t3\t1\t1\t3\t6\t6\tskillname99\tskillld99\tskillld99\tskillan99\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill34\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkillHealFlat\t\tedmn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"resist fire\t3\t1\t3\t3\t8\t\tskillname100\tskillld100\tskillld100\tskillan100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t36\tStrSkillMaxResistFirePassive\tStrSkillMaxResistFirePassive\t(skill('Resist Fire'.blvl) < 1) ? 1 : skill('Resist Fire'.blvl)\t2\t74\tStrSkillMaxResistFireActive\t\t(skill('Resist Fire'.blvl) < 1) ? 1 : skill('Resist Fire'.blvl)\t\t74\tStrSkill51\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"holy bolt\t1\t2\t2\t1\t10\t\tskillname101\tskillld101\tskillld101\tskillan101\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill50\t\tln12 * (100 + skill('Prayer'.blvl) * par7) / 100\tln34 * (100 + skill('Prayer'.blvl) * par7) / 100\t75\tStrSkill39\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname101\t2\t\t76\tMagdplev\tskillname121\tpar8\t\t76\tHealplev\tskillname99\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"holy fire\t2\t2\t2\t2\t12\t\tskillname102\tskillld102\tskillld102\tskillan102\t25\t0\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t75\tStrSkill5\t\tenma\texma*((100+par6)/100)\t75\tStrSkillFireDamageToYourAttack\t\tedns*par5/256\tedxs*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillProximityDamage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname102\t2\t\t76\tFiredplev\tskillname100\tpar8\t\t76\tFiredplev\tskillname125\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"thorns\t2\t2\t3\t2\t14\t9\tskillname103\tskillld103\tskillld103\tskillan103\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tModStr1v\t\tenma\t\t74\tStrSkill55\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"defiance\t3\t2\t2\t3\t16\t7\tskillname104\tskillld104\tskillld104\tskillan104\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill21\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"resist cold\t3\t2\t3\t3\t18\t\tskillname105\tskillld105\tskillld105\tskillan105\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t36\tStrSkillMaxResistColdPassive\tStrSkillMaxResistColdPassive\t(skill('Resist Cold'.blvl) < 1) ? 1 : skill('Resist Cold'.blvl)\t2\t74\tStrSkillMaxResistColdActive\t\t(skill('Resist Cold'.blvl) < 1) ? 1 : skill('Resist Cold'.blvl)\t\t74\tStrSkill52\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"zeal\t1\t3\t1\t1\t20\t\tskillname106\tskillld106\tskillld106\tskillan106\t7\t((lvl < 5) ? 0 : ((lvl-4) * par4) )+skill('Sacrifice'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\t((lvl < 5) ? 0 : ((lvl-4) * par4) )+skill('Sacrifice'.blvl)*par8\t\t74\tStrSkill22\t\ttoht\t\t74\tStrSkill11\t\t\"min((par5 + lvl -1), par6)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname106\t2\t\t76\tDamplev\tskillname96\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"charge\t1\t3\t3\t1\t22\t\tskillname107\tskillld107\tskillld107\tskillan107\t7\tln34+(skill('Vigor'.blvl)+skill('Might'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tln34+(skill('Vigor'.blvl)+skill('Might'.blvl))*par8\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname107\t2\t\t76\tDamplev\tskillname115\tpar8\t\t76\tDamplev\tskillname98\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"blessed aim\t2\t3\t1\t2\t24\t8\tskillname108\tskillld108\tskillld108\tskillan108\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkillAttackRatingPassive\t\t(skill('Blessed Aim'.blvl) < 1) ? par8 : skill('Blessed Aim'.blvl) * par8\t\t74\tStrSkillAttackRatingActive\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"cleansing\t3\t3\t1\t3\t38\t\tskillname109\tskillld109\tskillld109\tskillan109\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill74\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t76\tHealplev2\tskillname99\tskill('Prayer'.edmn)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname109\t2\t\t18\tskillname99\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"resist lightning\t3\t3\t3\t3\t28\t\tskillname110\tskillld110\tskillld110\tskillan110\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t36\tStrSkillMaxResistLightningPassive\tStrSkillMaxResistLightningPassive\t(skill('Resist Lightning'.blvl) < 1) ? 1 : skill('Resist Lightning'.blvl)\t2\t74\tStrSkillMaxResistLightningActive\t\t(skill('Resist Lightning'.blvl) < 1) ? 1 : skill('Resist Lightning'.blvl)\t\t74\tStrSkill53\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"vengeance\t1\t4\t1\t1\t40\t\tskillname111\tskillld111\tskillld111\tskillan111\t11\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillLightningDamagePercent\t\tln12+skill('Resist Lightning'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t74\tStrSkillColdDamagePercent\t\tln12+skill('Resist Cold'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t74\tStrSkillFireDamagePercent\t\tln12+skill('Resist Fire'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname111\t2\t\t76\tFiredplev\tskillname100\tpar8\t\t76\tColddplev\tskillname105\tpar8\t\t76\tLtngdplev\tskillname110\tpar8\t\t76\tElemDampLev\tskillname125\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"blessed hammer\t1\t4\t2\t1\t32\t\tskillname112\tskillld112\tskillld112\tskillan112\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDamageToUndead\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname112\t2\t\t76\tMagdplev\tskillname108\tpar8\t\t76\tMagdplev\tskillname115\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"concentration\t2\t4\t1\t2\t34\t\tskillname113\tskillld113\tskillld113\tskillan113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkillDamagePercent\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill76\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"holy freeze\t2\t4\t2\t2\t36\t10\tskillname114\tskillld114\tskillld114\tskillan114\t25\t0\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill77\t\tdm34\t\t75\tStrSkill6\t\tenma\texma*((100+par6)/100)\t75\tStrSkillColdDamageToYourAttack\t\tedns*par5/256\tedxs*par5/256\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillProximityDamage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname114\t2\t\t76\tColddplev\tskillname105\tpar8\t\t76\tColddplev\tskillname125\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"vigor\t3\t4\t2\t3\t26\t\tskillname115\tskillld115\tskillld115\tskillan115\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill69\t\tln34\t\t74\tStrSkill102\t\tln34\t\t74\tStrSkill89\t\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"conversion\t1\t5\t1\t1\t30\t\tskillname116\tskillld116\tskillld116\tskillan116\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkill99\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"holy shield\t1\t5\t3\t1\t42\t\tskillname117\tskillld117\tskillld117\tskillan117\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkill110\t\tdm56\t\t74\tStrSkill21\t\tln34+skill('Defiance'.blvl)*par8\t\t75\tStrSkillSmiteDamage\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname117\t2\t\t76\tDefplev\tskillname104\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"holy shock\t2\t5\t2\t2\t44\t\tskillname118\tskillxld118\tskillxld118\tskillan118\t25\t0\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t75\tStrSkill7\t\tenma\texma*((100+par6)/100)\t75\tstrEskilllighttoattack\t\tedns/256\tedxs*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillProximityDamage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname118\t2\t\t76\tLtngdplev\tskillname110\tpar8\t\t76\tLtngdplev\tskillname125\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"sanctuary\t2\t5\t3\t2\t46\t\tskillname119\tskillld119\tskillld119\tskillan119\t25\t0\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t75\tStrSkill39\t\tenma\texma*((100+par7)/100)\t74\tStrSkillDamageToUndead\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillProximityDamage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname119\t2\t\t76\tMagdplev\tskillname109\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"meditation\t3\t5\t1\t3\t48\t\tskillname120\tskillld120\tskillld120\tskillan120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill88\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t76\tHealplev2\tskillname99\tskill('Prayer'.edmn)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname120\t2\t\t18\tskillname99\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fist of the heavens\t1\t6\t2\t1\t50\t\tskillname121\tskillld121\tskillld121\tskillan121\t5\t\t\t\t\t\t\t\t\t\t\t\t\tfistoftheheavensbolt\t\t\t75\tStrSkill91\t\tm1en\tm1ex\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t10\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname121\t2\t\t76\tHbdplev\tskillname101\t15\t\t76\tLtngdplev\tskillname118\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fanaticism\t2\t6\t1\t2\t52\t\tskillname122\tskillxld122\tskillxld122\tskillan122\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill106\t\tdm34\t\t74\tPartDam\t\tln56/2\t\t74\tFanYDam\t\tln56\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"conviction\t2\t6\t3\t2\t56\t\tskillname123\tskillld123\tskillld123\tskillan123\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill54\t\t\"-min(ln34,150)\"\t\t74\tStrSkill21\t\t-dm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"redemption\t3\t6\t2\t3\t54\t\tskillname124\tskillxld124\tskillxld124\tskillan124\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill107\t\tln56\t\t74\tStrSkill109\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"salvation\t3\t6\t3\t3\t58\t\tskillname125\tskillld125\tskillld125\tskillan125\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill54\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"bash\t1\t1\t2\t1\t0\t22\tskillname126\tskillld126\tskillld126\tskillan126\t7\tclc1\tln34\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillDamageFlat\t\tln34\t\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname126\t2\t\t76\tDamplev\tskillname139\tpar8\t\t76\tAttRateplev\tskillname144\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"blade mastery\t2\t1\t1\t2\t2\t\tskillname127\tskillld127\tskillld127\tskillan127\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"axe mastery\t2\t1\t2\t2\t4\t\tskillname128\tskillld128\tskillld128\tskillan128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"mace mastery\t2\t1\t3\t2\t6\t\tskillname129\tskillld129\tskillld129\tskillan129\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"howl\t3\t1\t1\t3\t8\t\tskillname130\tskillld130\tskillld130\tskillan130\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln56\t25\t36\tStrSkill58\t\tln34*2\t3\t36\tStrSkillRadiusSingular\tStrSkill18\t(ln12-3)/2*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"find potion\t3\t1\t3\t3\t10\t\tskillname131\tskillld131\tskillld131\tskillan131\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"leap\t1\t2\t1\t1\t12\t\tskillname132\tskillld132\tskillld132\tskillan132\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillKnockbackRadius\tStrSkillKnockbackRadius\tln34*2\t3\t36\tStrSkillRangeRadius\tStrSkillRangeRadius\tdm12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"double swing\t1\t2\t3\t1\t14\t\tskillname133\tskillld133\tskillld133\tskillan133\t19\tclc1\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t36\tStrSkill3\t\t\"max(0, usmc*2)\"\t256\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDamagePercent\t\tclc1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname133\t2\t\t76\tDamplev\tskillname126\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"pole arm mastery\t2\t2\t1\t2\t16\t\tskillname134\tskillld134\tskillld134\tskillan134\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"throwing mastery\t2\t2\t2\t2\t18\t\tskillname135\tskillld135\tskillld135\tskillan135\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillReplenishOnCrit\t\t\t\t74\tStrSkillNoConsumeChance\t\tmanc\t\t74\tStrSkillPiercingChance\t\tmapi\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"spear mastery\t2\t2\t3\t2\t20\t\tskillname136\tskillld136\tskillld136\tskillan136\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"taunt\t3\t2\t1\t3\t22\t28\tskillname137\tskillld137\tskillld137\tskillan137\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill38\t\tln34\t\t74\tStrSkill57\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"shout\t3\t2\t2\t3\t24\t\tskillname138\tskillld138\tskillld138\tskillan138\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tlen\t25\t74\tStrSkill21\t\tln12\t\t36\tStrSkillRadiusSingular\tStrSkill18\t19*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname138\t2\t\t76\tSecplev2\tskillname149\tpar8/25\t\t76\tSecplev2\tskillname155\tpar8/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"stun\t1\t3\t2\t1\t26\t23\tskillname139\tskillld139\tskillld139\tskillan139\t7\tclc1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,edln)\"\t25\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDamagePercent\t\tclc1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname139\t2\t\t76\tDamplev\tskillname126\tpar8\t\t76\tAttRateplev\tskillname144\tpar7\t\t76\tDurateplev\tskillname154\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"double throw\t1\t3\t3\t1\t28\t\tskillname140\tskillld140\tskillld140\tskillan140\t13\t\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc*2\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname140\t2\t\t76\tDamplev\tskillname133\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"increased stamina\t2\t3\t1\t2\t30\t\tskillname141\tskillld141\tskillld141\tskillan141\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill102\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"find item\t3\t3\t3\t3\t32\t\tskillname142\tskillld142\tskillld142\tskillan142\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12+skill('Find Potion'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname142\t2\t\t76\tStrSkillSkillChancePerLevel\tskillname131\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"leap attack\t1\t4\t1\t1\t34\t\tskillname143\tskillld143\tskillld143\tskillan143\t26\tclc1\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t75\tStrSkill4\t\tpnma\tpxma\t36\tStrSkillRadiusSingular\tStrSkill18\t7*2\t3\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname143\t2\t\t76\tDamplev\tskillname132\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"concentrate\t1\t4\t2\t1\t36\t\tskillname144\tskillld144\tskillld144\tskillan144\t7\tclc1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkill21\t\tln34\t\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillMagicDamagePercent\t\tclc4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname144\t2\t\t76\tDamplev\tskillname126\tpar8\t\t76\tDamplev\tskillname149\tpar7\t\t76\tMagdplev\tskillname152\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"iron skin\t2\t4\t3\t2\t38\t27\tskillname145\tskillld145\tskillld145\tskillan145\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"battle cry\t3\t4\t1\t3\t40\t24\tskillname146\tskillld146\tskillld146\tskillan146\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkill25\t\tln34\t\t74\tStrSkill38\t\tln56\t\t36\tStrSkillRadiusSingular\tStrSkill18\t5*2\t3\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"frenzy\t1\t5\t3\t1\t42\t26\tskillname147\tskillld147\tskillld147\tskillan147\t19\tclc1\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t75\tStrSkillRunWalkRange\t\t15*(par4-par3)/100+par3\tdm34\t75\tStrSkillAttackSpeedRange\t\t15*(par6-par5)/100+par5\tdm56\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc*2\t256\t36\tStrSkillDurationSingular\tStrSkill20\tpar7+skill('Increased Stamina'.blvl)*10\t25\t74\tStrSkillMagicDamagePercent\t\tclc4\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname147\t2\t\t76\tDamplev\tskillname133\tpar8\t\t76\tDamplev\tskillname137\tpar8\t\t77\tStrSkillSynergySecondsDecimal\tskillname141\t0\t4\t76\tMagdplev\tskillname152\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"increased speed\t2\t5\t1\t2\t44\t\tskillname148\tskillld148\tskillld148\tskillan148\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill89\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"battle orders\t3\t5\t2\t3\t46\t\tskillname149\tskillld149\tskillld149\tskillan149\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tlen\t25\t74\tStrSkill102\t\tln34\t\t74\tStrSkill101\t\tln34\t\t74\tStrSkill100\t\tln34\t\t36\tStrSkillRadiusSingular\tStrSkill18\t19*2\t3\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname149\t2\t\t76\tSecplev2\tskillname138\tpar8/25\t\t76\tSecplev2\tskillname155\tpar8/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"grim ward\t3\t5\t3\t3\t48\t\tskillname150\tskillld150\tskillld150\tskillan150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tCgslow\t\tdm78\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tclc1\t25\t74\tStrSkillEnemyDamageTaken\t\tpar3 + (skill('Find Potion'.blvl) * par4)\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname150\t2\t\t76\tStrSkillDamageTakenPerLevel\tskillname131\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"whirlwind\t1\t6\t1\t1\t50\t\tskillname151\tskillld151\tskillld151\tskillan151\t1\tclc1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"berserk\t1\t6\t2\t1\t52\t\tskillname152\tskillld152\tskillld152\tskillan152\t7\tclc1\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\t\"par4-min(((110*lvl)/(lvl+6)*(par4-par3)/100),(par4-par3))\"\t25\t74\tStrSkillMagicDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname152\t2\t\t76\tMagdplev\tskillname130\tpar8\t\t76\tMagdplev\tskillname149\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"natural resistance\t2\t6\t3\t2\t54\t\tskillname153\tskillld153\tskillld153\tskillan153\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill54\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"war cry\t3\t6\t1\t3\t56\t\tskillname154\tskillld154\tskillld154\tskillan154\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,ln12)\"\t25\t75\tStrSkill4\t\tpnma\tpxma\t36\tStrSkillRadiusSingular\tStrSkill18\t7*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname154\t2\t\t76\tDamplev\tskillname130\tpar8\t\t76\tDamplev\tskillname137\tpar8\t\t76\tDamplev\tskillname146\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"battle command\t3\t6\t2\t3\t58\t\tskillname155\tskillld155\tskillld155\tskillan155\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tlen\t25\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\t19*2\t3\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname155\t2\t\t76\tSecplev2\tskillname138\tpar8/25\t\t76\tSecplev2\tskillname149\tpar8/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"scroll of identify\t0\t0\t0\t4\t14\t\tskillname217\tskillld217\tskillld217\tskillan217\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\tscrollbooktext\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"book of identify\t0\t0\t0\t4\t14\t\tskillname218\tskillld218\tskillld218\tskillan218\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\tscrollbooktext\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"scroll of townportal\t0\t0\t0\t4\t18\t\tskillname219\tskillld219\tskillld219\tskillan219\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\tscrollbooktext\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"book of townportal\t0\t0\t0\t4\t18\t\tskillname220\tskillld220\tskillld220\tskillan220\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\tscrollbooktext\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"raven\t1\t1\t2\t1\t0\t\tSkillname222\tSkillld222\tSkillld222\tSkillan222\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tESkillHawk\t\t\"min(lvl,par2)\"\t\t74\tStrSkill11\t\tln56\t\t75\tStrSkill4\t\tpnma\tpxma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tEskillincaseraven\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname222\t2\t\t76\tDamplev\tSkillname228\tpar8\t\t76\tDamplev\tSkillname238\tpar8\t\t76\tDamplev\tSkillname248\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"plague poppy\t1\t1\t3\t1\t2\t\tSkillname223\tSkillld223\tSkillld223\tSkillan223\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t13\tStrSkill42\t\t(lvl-1)*par3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname223\t2\t\t76\tPoisdplev\tSkillname239\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"wearwolf\t2\t1\t1\t2\t20\t\tSkillname224\tSkillld224\tSkillld224\tSkillan224\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill106\t\tdm34\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t36\tStrSkillDurationSingular\tStrSkill20\t1000+skill('shape shifting'.ln12)\t25\t74\tStrSkill102\t\tpar1\t\t74\tStrSkill100\t\tpar2+skill('shape shifting'.ln34)\t\t40\tSksyn\tSkillname224\t2\t\t18\tSkillname225\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"shape shifting\t2\t1\t2\t2\t52\t\tSkillname225\tSkillld225\tSkillld225\tSkillan225\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationPlus\t\tln12\t25\t74\tStrSkill100\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"firestorm\t3\t1\t1\t3\t32\t\tSkillname226\tSkillld226\tSkillld226\tSkillan226\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*25*3/256\texms*25*3/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname226\t2\t\t76\tFiredplev\tSkillname230\tpar8\t\t76\tFiredplev\tSkillname235\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"oak sage\t1\t2\t1\t1\t16\t\tSkillname227\tSkillld227\tSkillld227\tSkillan227\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln78*2\t3\t74\tStrSkill100\t\tln12\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"summon spirit wolf\t1\t2\t2\t1\t6\t\tSkillname228\tSkillld228\tSkillld228\tSkillan228\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\tln56\t\t74\tStrSkill22\t\tln12\t\t74\tESkillWolves\t\t\"min(lvl,par3)\"\t\t75\tStrSkill6\t\tenma\texma\t13\tStrSkill42\t\t(par7 * lvl) + (skill('Summon Fenris'.par2) * skill('Summon Fenris'.lvl))\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname228\t2\t\t76\tHpplev\tSkillname238\tskill('Summon Fenris'.par2)\t\t76\tDamplev\tSkillname248\tskill('Summon Grizzly'.par2)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"wearbear\t2\t2\t3\t2\t22\t\tSkillname229\tSkillld229\tSkillld229\tSkillan229\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\tln34\t\t74\tStrSkillDamagePercent\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t36\tStrSkillDurationSingular\tStrSkill20\t1000+skill('shape shifting'.ln12)\t25\t74\tStrSkill100\t\tpar5 + skill('Shape Shifting'.ln34)\t\t\t\t\t\t\t40\tSksyn\tSkillname229\t2\t\t18\tSkillname225\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"molten boulder\t3\t2\t1\t3\t34\t\tSkillname230\tSkillld230\tSkillld230\tSkillan230\t5\t\t\t\t\t\t\t\t\t\t\t\t\tmoltenboulderfirepath\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkillFireDamageAveragePerSecond\t\tm1eo*25*3*(mael+100)/100/256\tm1ey*25*3*(mael+100)/100/256\t75\tStrSkill5\t\tenma\texma\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname230\t2\t\t76\tDamplev\tSkillname245\tpar7\t\t76\tFiredplev\tSkillname226\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"arctic blast\t3\t2\t3\t3\t36\t\tSkillname231\tSkillld231\tSkillld231\tSkillan231\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillManaCostPerSecond\t\tmps\t\t36\tStrSkillRangeSingular\tStrSkill56\tln12/4*2\t3\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkillColdDamageAveragePerSecond\t\tenms*12/256\texms*12/256\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill115\t\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname231\t2\t\t76\tColddplev\tSkillname236\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"cycle of life\t1\t3\t3\t1\t8\t\tSkillname232\tSkillld232\tSkillld232\tSkillan232\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillHealPercent\t\tln56\t\t13\tStrSkill42\t\t(lvl-1)*par3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"feral rage\t2\t3\t1\t2\t54\t\tSkillname233\tSkillld233\tSkillld233\tSkillan233\t7\tln56\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tln56\t\t75\tStrSkillLifeStealRange\t\t4\tpar2 * lvl + 8\t75\tStrSkillRunWalkRange\t\t19\t((110*(par8+lvl/par7)) * (par4-par3))/(100 * ((par8+lvl/par7)+6)) + par3\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tpar1\t25\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"maul\t2\t3\t3\t2\t56\t\tSkillname234\tSkillld234\tSkillld234\tSkillan234\t1\t\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,dm56)\"\t25\t75\tStrSkillDamagePercentRange\t\tpar3\tpar3 * (lvl/par7+par8)\t75\tStrSkillAttackSpeedRange\t\tpar1\tpar1 * (lvl/par7+par8)\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tpar4\t25\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"eruption\t3\t3\t1\t3\t38\t\tSkillname235\tSkillld235\tSkillld235\tSkillan235\t5\t\t\t\t\t\t\t\t\t\t\t\t\terruption center\t\t\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t50\t25\t36\tStrSkillDurationSingular\tStrSkill20\tmiss('eruption center'.rang)\t25\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname235\t2\t\t76\tFiredplev\tSkillname226\tpar8\t\t76\tFiredplev\tSkillname245\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"cyclone armor\t3\t3\t3\t3\t40\t\tSkillname236\tSkillld236\tSkillld236\tSkillan236\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill40\t\t(ln12*(100+(skill('Twister'.blvl)+skill('Tornado'.blvl)+skill('Hurricane'.blvl))*par8)/100)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname236\t2\t\t76\tDamplev\tSkillname241\tpar8\t\t76\tDamplev\tSkillname246\tpar8\t\t76\tDamplev\tSkillname251\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"heart of wolverine\t1\t4\t1\t1\t10\t\tSkillname237\tSkillld237\tSkillld237\tSkillan237\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln78*2\t3\t74\tStrSkillDamagePercent\t\tln56\t\t74\tStrSkill22\t\tln34\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"summon fenris\t1\t4\t2\t1\t12\t\tSkillname238\tSkillld238\tSkillld238\tSkillan238\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\t(par6 * lvl) + skill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par6)\t\t74\tStrSkill100\t\tln12\t\t74\tESkillWolves\t\t\"min(lvl,par3)\"\t\t75\tStrSkill4\t\tpnma*(100+skill('Summon Grizzly'.ln12))/100\tpxma*(100+skill('Summon Grizzly'.ln12))/100\t13\tStrSkill42\t\t(par7 * lvl) + ln12\t\t\t\t\t\t\t74\tStrSkill22\t\tskill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par2)\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname238\t2\t\t76\tAttRateplev\tSkillname228\tskill('Summon Spirit Wolf'.par2)\t\t76\tDefplev\tSkillname228\tskill('Summon Spirit Wolf'.par6)\t\t76\tDamplev\tSkillname248\tskill('Summon Grizzly'.par2)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"rabies\t2\t4\t1\t2\t24\t\tSkillname239\tSkillld239\tSkillld239\tSkillan239\t23\t\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname239\t2\t\t76\tPoisdplev\tSkillname223\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fire claws\t2\t4\t2\t2\t26\t\tSkillname240\tSkillld240\tSkillld240\tSkillan240\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t75\tStrSkill5\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname240\t2\t\t76\tFiredplev\tSkillname226\tpar8\t\t76\tFiredplev\tSkillname230\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"twister\t3\t4\t2\t3\t42\t\tSkillname241\tSkillld241\tSkillld241\tSkillan241\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillStunLengthSingular\tStrSkill48\tpar2+par7*skill('Arctic Blast'.blvl)\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname241\t2\t\t76\tDurateplev\tSkillname231\tpar7 * 100 / par2\t\t76\tDamplev\tSkillname246\tpar8\t\t76\tDamplev\tSkillname251\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"vines\t1\t5\t3\t1\t14\t\tSkillname242\tSkillld242\tSkillld242\tSkillan242\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill88\t\tln56\t\t13\tStrSkill42\t\t(lvl-1)*par3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"hunger\t2\t5\t2\t2\t58\t\tSkillname243\tSkillld243\tSkillld243\tSkillan243\t14\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tEskillManaSteal\t\tdm34\t\t74\tEskillLifeSteal\t\tdm12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDamagePercent\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"shock wave\t2\t5\t3\t2\t28\t\tSkillname244\tSkillld244\tSkillld244\tSkillan244\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillStunLengthSingular\tStrSkill48\tln12\t25\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname244\t2\t\t76\tDamplev\tSkillname234\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"volcano\t3\t5\t1\t3\t44\t\tSkillname245\tSkillld245\tSkillld245\tSkillan245\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill5\t\tenma\texma\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t100\t25\t36\tStrSkillDurationSingular\tStrSkill20\t150\t25\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname245\t2\t\t76\tDamplev\tSkillname230\tpar7\t\t76\tFiredplev\tSkillname235\tpar8\t\t76\tFiredplev\tSkillname250\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"tornado\t3\t5\t2\t3\t46\t\tSkillname246\tSkillld246\tSkillld246\tSkillan246\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname246\t2\t\t76\tDamplev\tSkillname236\tpar8\t\t76\tDamplev\tSkillname241\tpar8\t\t76\tDamplev\tSkillname251\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"spirit of barbs\t1\t6\t1\t1\t4\t\tSkillname247\tSkillld247\tSkillld247\tSkillan247\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln78*2\t3\t74\tModStr1v\t\tpnma\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"summon grizzly\t1\t6\t2\t1\t18\t\tSkillname248\tSkillld248\tSkillld248\tSkillan248\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDamagePercent\t\tln12\t\t75\tStrSkill4\t\tpnma*(100+ln12)/100\tpxma*(100+ln12)/100\t13\tStrSkill42\t\t(par7 * lvl) + (skill('Summon Fenris'.par2) * skill('Summon Fenris'.lvl))\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\tskill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par6)\t\t74\tStrSkill22\t\tskill('Summon Spirit Wolf'.lvl) * skill('Summon Spirit Wolf'.par2)\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname248\t2\t\t76\tAttRateplev\tSkillname228\tskill('Summon Spirit Wolf'.par2)\t\t76\tDefplev\tSkillname228\tskill('Summon Spirit Wolf'.par6)\t\t76\tHpplev\tSkillname238\tskill('Summon Fenris'.par2)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fury\t2\t6\t1\t2\t30\t\tSkillname249\tSkillld249\tSkillld249\tSkillan249\t7\tln34\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tln34\t\t74\tStrSkill22\t\ttoht\t\t74\tStrSkill11\t\t\"min((par5+lvl-1),par6)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"armageddon\t3\t6\t1\t3\t50\t\tSkillname250\tSkillld250\tSkillld250\tSkillan250\t5\t\t\t\t\t\t\t\t\t\t\t\t\tarmageddonfire\t\t\t75\tStrSkillFireDamageAveragePerSecond\t\tm1eo*25*3*(mael+100)/100/256\tm1ey*25*3*(mael+100)/100/256\t75\tStrSkill5\t\tenma\texma\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tpar3*2\t3\t36\tStrSkillDurationSingular\tStrSkill20\tln12 + skill('Eruption'.blvl) * par7\t25\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname250\t2\t\t76\tSecplev2\tSkillname235\t2\t\t76\tFiredplev\tSkillname226\tpar8\t\t76\tFiredplev\tSkillname230\tpar8\t\t76\tDamplev\tSkillname245\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"hurricane\t3\t6\t2\t3\t48\t\tSkillname251\tSkillld251\tSkillld251\tSkillan251\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tpar3*2\t3\t36\tStrSkillDurationSingular\tStrSkill20\tln12 + skill('Cyclone Armor'.blvl) * par7\t25\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname251\t2\t\t76\tSecplev2\tSkillname236\t2\t\t76\tDamplev\tSkillname241\tpar8\t\t76\tDamplev\tSkillname246\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fire trauma\t1\t1\t2\t1\t0\t\tSkillname252\tSkillld252\tSkillld252\tSkillan252\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tpar1*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname252\t2\t\t76\tFiredplev\tSkillname257\tpar8\t\t76\tFiredplev\tSkillname262\tpar8\t\t76\tFiredplev\tSkillname263\tpar8\t\t76\tFiredplev\tSkillname272\tpar8\t\t76\tFiredplev\tSkillname273\tpar8\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"claw mastery\t2\t1\t2\t2\t20\t\tSkillname253\tSkillld253\tSkillld253\tSkillan253\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"psychic hammer\t2\t1\t3\t2\t22\t\tSkillname254\tSkillld254\tSkillld254\tSkillan254\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"tiger strike\t3\t1\t2\t3\t40\t\tSkillname255\tSkillld255\tSkillld255\tSkillan255\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillAssassinTigerStrikeCharge3\t\t3*ln12\t\t74\tStrSkillAssassinTigerStrikeCharge2\t\t2*ln12\t\t74\tStrSkillAssassinTigerStrikeCharge1\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"dragon talon\t3\t1\t3\t3\t42\t\tSkillname256\tSkillld256\tSkillld256\tSkillan256\t15\t\t\t\t\t\t\t\t\t\t\t\t5\t\t\t\t74\tEskillkickdamage\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t36\tEskillKickSing\tEskillKickPlur\tlvl/6+1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"shock field\t1\t2\t1\t1\t2\t\tSkillname257\tSkillld257\tSkillld257\tSkillan257\t5\t\t\t\t\t\t\t\t\t\t\t\t\tshock field on ground\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tmiss('shock field on ground'.rang)\t25\t75\tStrSkillLightningDamageAveragePerSecond\t\tedmn\tedmx\t74\tESkillSpikes\t\tpar1+lvl/par2+skill('Fire Trauma'.blvl)/3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname257\t2\t\t77\tMissplev3\tSkillname252\t1\t3\t76\tLtngdplev\tSkillname262\tpar8\t\t76\tLtngdplev\tSkillname272\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"blade sentinel\t1\t2\t3\t1\t4\t\tSkillname258\tSkillld258\tSkillld258\tSkillan258\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t74\tWeapDamsk\t\t96*100/128\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname258\t2\t\t76\tDamplev\tSkillname267\tpar8\t\t76\tDamplev\tSkillname278\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"quickness\t2\t2\t1\t2\t36\t\tSkillname259\tSkillld259\tSkillld259\tSkillan259\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln56\t25\t74\tStrSkill89\t\tdm12\t\t74\tStrSkill106\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fists of fire\t3\t2\t1\t3\t44\t\tSkillname260\tSkillld260\tSkillld260\tSkillan260\t20\t\t\tfire\tenma\texma\tfire\tenma\texma\tfire\tenma+m1eo*50/256\texma+m1ey*50/256\t2\tfistsoffirefirewall\t\t\t75\tEskillfistsoffire3\t\tm1eo*50/256\tm1ey*50/256\t74\tEskillfistsoffire2\t\tpar1\t\t75\tEskillfistsoffire1\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname260\t2\t\t76\tFiredplev\tSkillname281\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"dragon claw\t3\t2\t3\t3\t46\t\tSkillname261\tSkillld261\tSkillld261\tSkillan261\t19\tln12\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tln12 + (skill('Claw Mastery'.blvl) * par7)\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname261\t2\t\t76\tDamplev\tSkillname253\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"charged bolt sentry\t1\t3\t1\t1\t6\t\tSkillname262\tSkillld262\tSkillld262\tSkillan262\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill72\t\tln34 + skill('Shock Field'.blvl)/3\t\t74\tESkillShoots\t\tpar1 + skill('Lightning Sentry'.blvl)/4\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname262\t2\t\t77\tBoltplev3\tSkillname257\t1\tpar6\t77\tShotplev3\tSkillname272\t1\tpar7\t76\tLtngdplev\tSkillname252\tpar8\t\t76\tLtngdplev\tSkillname272\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"wake of fire sentry\t1\t3\t2\t1\t8\t\tSkillname263\tSkillld263\tSkillld263\tSkillan263\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tESkillShoots\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname263\t2\t\t76\tFiredplev\tSkillname252\tpar8\t\t76\tFiredplev\tSkillname273\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"weapon block\t2\t3\t2\t2\t26\t\tSkillname264\tSkillld264\tSkillld264\tSkillan264\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"cloak of shadows\t2\t3\t3\t2\t24\t\tSkillname265\tSkillld265\tSkillld265\tSkillan265\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t74\tStrSkill25\t\t\"-min(ln56,95)\"\t\t74\tStrSkill21\t\tln78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRangeSingular\tStrSkill56\tdm12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"cobra strike\t3\t3\t2\t3\t50\t\tSkillname266\tSkillld266\tSkillld266\tSkillan266\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillAssassinCobraStrikeCharge3\t\t2*ln12\t\t74\tEskillpudmana\t\tln12\t\t74\tStrSkillAssassinCobraStrikeCharge1\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"blade fury\t1\t4\t3\t1\t10\t\tSkillname267\tSkillld267\tSkillld267\tSkillan267\t24\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tEskillPerBlade\t\tusmc\t256\t75\tStrSkill4\t\tpnma\tpxma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill115\t\tpar3\t\t74\tWeapDamsk\t\t96*100/128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname267\t2\t\t76\tDamplev\tSkillname258\tpar8\t\t76\tDamplev\tSkillname278\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"fade\t2\t4\t1\t2\t30\t\tSkillname268\tSkillld268\tSkillld268\tSkillan268\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln56\t25\t74\tStrSkill54\t\tdm12\t\t74\tModStr2uPercent\t\tln78\t\t74\tStrSkill85\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"shadow warrior\t2\t4\t2\t2\t38\t\tSkillname269\tSkillld269\tSkillld269\tSkillan269\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill21\t\t(lvl-1)*par3\t\t74\tStrSkillAttackRating\t\tlvl*par2\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"claws of thunder\t3\t4\t1\t3\t58\t\tSkillname270\tSkillld270\tSkillld270\tSkillan270\t20\t\t\tltng\tenma\texma\tltng\tenma+m2en\texma+m2ex\tltng\tenma+m2en+m3en\texma+m2ex+m3ex\t2\t\tclawsofthundernova\tclawsofthunderbolt\t75\tEskillthunder3\t\tm3en\tm3ex\t75\tEskillthunder2\t\tm2en\tm2ex\t75\tEskillthunder1\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname270\t2\t\t76\tLtngdplev\tSkillname281\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"dragon tail\t3\t4\t3\t3\t48\t\tSkillname271\tSkillld271\tSkillld271\tSkillan271\t16\t\t\t\t\t\t\t\t\t\t\t\t5\t\t\t\t74\tStrSkillFireDamagePercent\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tpar3*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"lightning sentry\t1\t5\t1\t1\t12\t\tSkillname272\tSkillld272\tSkillld272\tSkillan272\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tESkillShoots\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname272\t2\t\t76\tLtngdplev\tSkillname257\tpar8\t\t76\tLtngdplev\tSkillname262\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"inferno sentry\t1\t5\t2\t1\t14\t\tSkillname273\tSkillld273\tSkillld273\tSkillan273\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*12/256\texms*12/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRangeSingular\tStrSkill56\t(ln34/2 + skill('Wake of Fire Sentry'.blvl)\t3\t74\tESkillShoots\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname273\t2\t\t77\tRangplev\tSkillname263\t0\t5\t76\tFiredplev\tSkillname252\tpar8\t\t76\tFiredplev\tSkillname263\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"mind blast\t2\t5\t3\t2\t34\t\tSkillname274\tSkillld274\tSkillld274\tSkillan274\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill99\t\tdm56\t\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,edln)\"\t25\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkillDurationRange\t\tpar3/25\t(par3+par4)/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"blades of ice\t3\t5\t1\t3\t52\t\tSkillname275\tSkillld275\tSkillld275\tSkillan275\t20\t\t\tcold\tenma\texma\tcold\tenma\texma\tcold\tenma\texma\t2\t\t\t\t36\tEskillbladesofice3\t\tedln\t25\t36\tEskillbladesofice2\t\tpar1*2\t3\t75\tEskillbladesofice1\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname275\t2\t\t76\tColddplev\tSkillname281\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"dragon flight\t3\t5\t3\t3\t54\t\tSkillname276\tSkillld276\tSkillld276\tSkillan276\t15\t\t\t\t\t\t\t\t\t\t\t\t5\t\t\t\t74\tEskillkickdamage\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"death sentry\t1\t6\t1\t1\t16\t\tSkillname277\tSkillld277\tSkillld277\tSkillan277\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tskill('mon death sentry'.par3) + skill('mon death sentry'.par4) * (lvl - 1)\t3\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tESkillShoots\t\tpar1 + skill('Fire Trauma'.blvl)/3\t\t75\tCorexpdam\t\tskill('mon death sentry'.par1)\tskill('mon death sentry'.par2)\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname277\t2\t\t77\tShotplev3\tSkillname252\t1\t3\t76\tLtngdplev\tSkillname272\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"blade shield\t1\t6\t3\t1\t18\t\tSkillname278\tSkillld278\tSkillld278\tSkillan278\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tpar4*2\t3\t74\tWeapDamsk\t\t96*100/128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname278\t2\t\t76\tDamplev\tSkillname258\tpar8\t\t76\tDamplev\tSkillname267\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"venom\t2\t6\t1\t2\t28\t\tSkillname279\tSkillld279\tSkillld279\tSkillan279\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"shadow master\t2\t6\t2\t2\t32\t\tSkillname280\tSkillld280\tSkillld280\tSkillan280\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill54\t\t((110*(lvl-1))/(lvl+5)*(par4-par3))/100+par3\t\t74\tStrSkillAttackRating\t\tlvl*par2\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"royal strike\t3\t6\t2\t3\t56\t\tSkillname281\tSkillld281\tSkillld281\tSkillan281\t18\t\t\tfire\tm1en\tm1ex\tltng\tm2en\tm2ex\tcold\tm3en\tm3ex\t1\troyalstrikemeteor\troyalstrikechainlightning\troyalstrikechaosice\t75\tEskillphoenix3\t\tm3en\tm3ex\t75\tEskillphoenix2\t\tm2en\tm2ex\t75\tStrSkillFireDamageAveragePerSecond\t\tmiss('royalstrikemeteorfire'.edns)*3*25*(mael+100)/100/256\tmiss('royalstrikemeteorfire'.edxs)*3*25*(mael+100)/100/256\t75\tEskillphoenix1\t\tm1en\tm1ex\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname281\t2\t\t76\tFiredplev\tSkillname260\t10\t\t76\tAFDImm\tSkillname260\t6\t\t76\tLtngdplev\tSkillname270\t13\t\t76\tColddplev\tSkillname275\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"delerium change\t0\t0\t0\t0\t2\t\tRuneword22\tRuneword22\tRuneword22\tRuneword22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"interact\t0\t0\t0\t0\t2\t\tSkillNameInteract\tSkillDescInteract\tSkillDescInteract\tSkillNameInteract\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"loot\t0\t0\t0\t0\t2\t\tSkillNameLoot\tSkillDescLoot\tSkillDescLoot\tSkillNameLoot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"townportal\t0\t0\t0\t0\t18\t\tskillname219\tskillld219\tskillld219\tskillan219\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"emotewheel\t0\t0\t0\t0\t2\t\tSkillNameEmoteWheel\tSkillDescEmoteWheel\tSkillDescEmoteWheel\tSkillNameEmoteWheel\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"swapweapons\t0\t0\t0\t0\t2\t\tSkillNameSwapWeapons\tSkillDescSwapWeapons\tSkillDescSwapWeapons\tSkillNameSwapWeapons\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"map\t0\t0\t0\t0\t2\t\tSkillNameMap\tSkillDescMap\tSkillDescMap\tSkillNameMap\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"showitems\t0\t0\t0\t0\t2\t\tSkillNameShowItems\tSkillDescShowItems\tSkillDescShowItems\tSkillNameShowItems\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"runtoggle\t0\t0\t0\t0\t2\t\tSkillNameRunToggle\tSkillDescRunToggle\tSkillDescRunToggle\tSkillNameRunToggle\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"cubeloot\t0\t0\t0\t0\t2\t\tSkillNameCubeLoot\tSkillDescCubeLoot\tSkillDescCubeLoot\tSkillNameCubeLoot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"mark of the bear\t0\t0\t0\t0\t2\t\tSkillnameMetamorphosisBear\tSkillnameMetamorphosisBear\tSkillnameMetamorphosisBear\tSkillnameMetamorphosisBear\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tModStr2uPercent\t\tpar2\t\t74\tModStr6l\t\tpar1\t\t12\tStrSkill0\t\tlen\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tSkillItemMetamorphosisBear\t3\t0\n";
-                ss << u8"mark of the wolf\t0\t0\t0\t0\t2\t\tSkillnameMetamorphosisWolf\tSkillnameMetamorphosisWolf\tSkillnameMetamorphosisWolf\tSkillnameMetamorphosisWolf\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tModStr2g\t\tpar2\t\t74\tModStr4c\t\tpar1\t\t12\tStrSkill0\t\tlen\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tSkillItemMetamorphosisWolf\t3\t0\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"skilldesc\tSkillPage\tSkillRow\tSkillColumn\tListRow\tIconCel\tHireableIconCel\tstr name\tstr short\tstr long\tstr alt\tdescdam\tddam calc1\tddam calc2\tp1dmelem\tp1dmmin\tp1dmmax\tp2dmelem\tp2dmmin\tp2dmmax\tp3dmelem\tp3dmmin\tp3dmmax\tdescatt\tdescmissile1\tdescmissile2\tdescmissile3\tdescline1\tdesctexta1\tdesctextb1\tdesccalca1\tdesccalcb1\tdescline2\tdesctexta2\tdesctextb2\tdesccalca2\tdesccalcb2\tdescline3\tdesctexta3\tdesctextb3\tdesccalca3\tdesccalcb3\tdescline4\tdesctexta4\tdesctextb4\tdesccalca4\tdesccalcb4\tdescline5\tdesctexta5\tdesctextb5\tdesccalca5\tdesccalcb5\tdescline6\tdesctexta6\tdesctextb6\tdesccalca6\tdesccalcb6\tdsc2line1\tdsc2texta1\tdsc2textb1\tdsc2calca1\tdsc2calcb1\tdsc2line2\tdsc2texta2\tdsc2textb2\tdsc2calca2\tdsc2calcb2\tdsc2line3\tdsc2texta3\tdsc2textb3\tdsc2calca3\tdsc2calcb3\tdsc2line4\tdsc2texta4\tdsc2textb4\tdsc2calca4\tdsc2calcb4\tdsc2line5\tdsc2texta5\tdsc2textb5\tdsc2calca5\tdsc2calcb5\tdsc3line1\tdsc3texta1\tdsc3textb1\tdsc3calca1\tdsc3calcb1\tdsc3line2\tdsc3texta2\tdsc3textb2\tdsc3calca2\tdsc3calcb2\tdsc3line3\tdsc3texta3\tdsc3textb3\tdsc3calca3\tdsc3calcb3\tdsc3line4\tdsc3texta4\tdsc3textb4\tdsc3calca4\tdsc3calcb4\tdsc3line5\tdsc3texta5\tdsc3textb5\tdsc3calca5\tdsc3calcb5\tdsc3line6\tdsc3texta6\tdsc3textb6\tdsc3calca6\tdsc3calcb6\tdsc3line7\tdsc3texta7\tdsc3textb7\tdsc3calca7\tdsc3calcb7\titem proc text\titem proc descline count\t*eol\n",
+                u8"attack\t0\t0\t0\t0\t2\t\tskillname0\tskillld0\tskillld0\tskillan0\t1\t\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"kick\t0\t0\t0\t-1\t0\t\tskillname1\tskillld1\tskillld1\tskillan1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"throw\t0\t0\t0\t0\t6\t\tskillname2\tskillld2\tskillld2\tskillan2\t3\t\t\t\t\t\t\t\t\t\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"unsummon\t0\t0\t0\t0\t4\t\tskillname3\tskillld3\tskillld3\tskillan3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"left hand throw\t0\t0\t0\t0\t12\t\tskillname4\tskillld4\tskillld4\tskillan4\t4\t\t\t\t\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"left hand swing\t0\t0\t0\t-1\t10\t\tskillname5\tskillld5\tskillld5\tskillan5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"magic arrow\t1\t1\t2\t1\t0\t\tskillname6\tskillld6\tskillld6\tskillan6\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 0)\"\t256\t74\tStrSkillDamageFlat\t\tpnma\t\t74\tStrSkill22\t\ttoht\t\t74\tConvphy2elemalt\t\t5+(lvl-1)*2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fire arrow\t1\t1\t3\t1\t2\t1\tskillname7\tskillxld7\tskillxld7\tskillan7\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill5\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t74\tConvphy2magalt\t\t3+(lvl-1)*2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname7\t2\t\t76\tFiredplev\tskillname16\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"inner sight\t2\t1\t1\t2\t4\t0\tskillname8\tskillld8\tskillld8\tskillan8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t74\tStrSkillEnemyDefenseFlatBonus\t\t-edmn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln56*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"critical strike\t2\t1\t3\t2\t6\t\tskillname9\tskillld9\tskillld9\tskillan9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"jab\t3\t1\t1\t3\t8\t5\tskillname10\tskillld10\tskillld10\tskillan10\t7\tln34\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDamagePercent\t\tln34\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkill61\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"cold arrow\t1\t2\t1\t1\t10\t3\tskillname11\tskillxld11\tskillxld11\tskillan11\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t74\tConvphy2magalt\t\t3+(lvl-1)*2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname11\t2\t\t76\tColddplev\tskillname21\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"multiple shot\t1\t2\t2\t1\t12\t\tskillname12\tskillld12\tskillld12\tskillan12\t7\tskill('Guided Arrow'.blvl) * par4\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill9\t\t\"min(24,ln12)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tWeapDamsk\t\t(96*100/128)+(skill('Guided Arrow'.blvl)*par4)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname12\t2\t\t76\tDamplev\tskillname22\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"dodge\t2\t2\t2\t2\t14\t\tskillname13\tskillld13\tskillld13\tskillan13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"power strike\t3\t2\t2\t3\t16\t\tskillname14\tskillld14\tskillld14\tskillan14\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname14\t2\t\t76\tLtngdplev\tskillname20\tpar8\t\t76\tLtngdplev\tskillname24\tpar8\t\t76\tLtngdplev\tskillname34\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"poison javelin\t3\t2\t3\t3\t18\t\tskillname15\tskillld15\tskillld15\tskillan15\t22\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname15\t2\t\t76\tPoisdplev\tskillname25\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"exploding arrow\t1\t3\t3\t1\t20\t2\tskillname16\tskillxld16\tskillxld16\tskillan16\t6\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill5\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname16\t2\t\t76\tFiredplev\tskillname7\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"slow missiles\t2\t3\t1\t2\t22\t\tskillname17\tskillld17\tskillld17\tskillan17\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln56*2\t3\t74\tModStr2uPercent\t\tdm78\t\t74\tStrSkill67\t\t100-dm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"avoid\t2\t3\t2\t2\t24\t\tskillname18\tskillld18\tskillld18\tskillan18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"impale\t3\t3\t1\t3\t26\t\tskillname19\tskillld19\tskillld19\tskillan19\t7\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill65\t\tpar6-dm34\t\t74\tCgslow\t\tdm78\t\t74\tStrSkillDamagePercent\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t18\tStrSkillUninterruptable\t\t\t\t18\tStrSkillAlwaysHits\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lightning bolt\t3\t3\t3\t3\t28\t\tskillname20\tskillld20\tskillld20\tskillan20\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tConvphy2magalt\t\t100\t\t74\tWeapDamsk\t\t96*100/128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname20\t2\t\t76\tLtngdplev\tskillname14\tpar8\t\t76\tLtngdplev\tskillname24\tpar8\t\t76\tLtngdplev\tskillname34\tpar8\t\t76\tLtngdplev\tskillname35\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"ice arrow\t1\t4\t1\t1\t30\t\tskillname21\tskillxld21\tskillxld21\tskillan21\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFreezeLengthSingular\tStrSkill62\tedln\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname21\t2\t\t76\tColddplev\tskillname11\tpar8\t\t76\tFrezLenplev\tskillname31\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"guided arrow\t1\t4\t2\t1\t32\t\tskillname22\tskillld22\tskillld22\tskillan22\t7\tln34 + (skill('Multiple Shot'.blvl)*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 1)\"\t256\t74\tStrSkillDamagePercent\t\tln34 + (skill('Multiple Shot'.blvl)*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillAlwaysHits\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname22\t2\t\t76\tDamplev\tskillname12\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"penetrate\t2\t4\t3\t2\t34\t\tskillname23\tskillld23\tskillld23\tskillan23\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill22\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"charged strike\t3\t4\t2\t3\t36\t\tskillname24\tskillld24\tskillld24\tskillan24\t17\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill72\t\tpar1 + lvl/par2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname24\t2\t\t76\tLtngdplev\tskillname14\tpar8\t\t76\tLtngdplev\tskillname20\tpar8\t\t76\tLtngdplev\tskillname34\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"plague javelin\t3\t4\t3\t3\t38\t\tskillname25\tskillld25\tskillld25\tskillan25\t22\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname25\t2\t\t76\tPoisdplev\tskillname15\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"strafe\t1\t5\t2\t1\t40\t\tskillname26\tskillld26\tskillld26\tskillan26\t7\tln12 + (skill('Guided Arrow'.blvl)*par8) + (skill('Multiple Shot'.blvl)*par9)\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillDamagePercent\t\tln12 + (skill('Guided Arrow'.blvl)*par8) + (skill('Multiple Shot'.blvl)*par9)\t\t74\tStrSkill86\t\t\"min(lvl+par3,par4)\"\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname26\t2\t\t76\tDamplev\tskillname12\tpar9\t\t76\tDamplev\tskillname22\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"immolation arrow\t1\t5\t3\t1\t42\t\tskillname27\tskillxld27\tskillxld27\tskillan27\t6\t\t\t\t\t\t\t\t\t\t\t\t1\timmolationfire\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFireDurationSingular\tStrSkill82\tmiss('immolationfire'.rang)\t25\t75\tStrSkillFireDamageAveragePerSecond\t\tm1eo*25*3*(mael+100)/100/256\tm1ey*25*3*(mael+100)/100/256\t75\tStrSkill83\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname27\t2\t\t76\tAFDImm\tskillname7\t5\t\t76\tFiredplev\tskillname16\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"dopplezon\t2\t5\t1\t2\t44\t\tskillname28\tskillld28\tskillld28\tskillan28\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 1)\"\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkillLifePercent\t\tlvl*par4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"evade\t2\t5\t2\t2\t46\t\tskillname29\tskillld29\tskillld29\tskillan29\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fend\t3\t5\t1\t3\t48\t\tskillname30\tskillld30\tskillld30\tskillan30\t7\tln34\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillDamagePercent\t\tln34\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"freezing arrow\t1\t6\t1\t1\t50\t4\tskillname31\tskillxld31\tskillxld31\tskillan31\t6\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFreezeLengthSingular\tStrSkill62\tedln\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tpar1*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname31\t2\t\t76\tColddplev\tskillname11\tpar8\t\t76\tFrezLenplev\tskillname21\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"valkyrie\t2\t6\t1\t2\t52\t\tskillname32\tskillld32\tskillld32\tskillan32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill21\t\t(lvl-1)*par3\t\t74\tStrSkillDamagePercent\t\tpar2*(lvl-1)\t\t74\tStrSkill22\t\ttoht\t\t13\tStrSkill42\t\tpar1 * (lvl - 1) + skill('Dopplezon'.blvl) * par8\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname32\t2\t\t76\tHpplev\tskillname28\tpar8\t\t76\tAttRateplev\tskillname23\t40\t\t18\tskillname9\t\t\t\t18\tskillname13\t\t\t\t18\tskillname18\t\t\t\t18\tskillname29\t\t\t\t\t\t0\n",
+                u8"pierce\t2\t6\t3\t2\t54\t\tskillname33\tskillld33\tskillld33\tskillan33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lightning strike\t3\t6\t2\t3\t56\t\tskillname34\tskillld34\tskillld34\tskillan34\t17\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill11\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname34\t2\t\t76\tLtngdplev\tskillname14\tpar8\t\t76\tLtngdplev\tskillname20\tpar8\t\t76\tLtngdplev\tskillname24\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lightning fury\t3\t6\t3\t3\t58\t\tskillname35\tskillld35\tskillld35\tskillan35\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkillReleasesBolts\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname35\t2\t\t76\tLtngdplev\tskillname14\tpar8\t\t76\tLtngdplev\tskillname20\tpar8\t\t76\tLtngdplev\tskillname24\tpar8\t\t76\tLtngdplev\tskillname34\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fire bolt\t1\t1\t2\t1\t0\t13\tskillname36\tskillld36\tskillld36\tskillan36\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname36\t2\t\t76\tFiredplev\tskillname47\tpar8\t\t76\tFiredplev\tskillname56\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"warmth\t1\t1\t3\t1\t2\t\tskillname37\tskillld37\tskillld37\tskillan37\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill88\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"charged bolt\t2\t1\t2\t2\t4\t19\tskillname38\tskillld38\tskillld38\tskillan38\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill27\t\t\"min(24,ln12)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname38\t2\t\t76\tLtngdplev\tskillname49\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"ice bolt\t3\t1\t2\t3\t6\t\tskillname39\tskillld39\tskillld39\tskillan39\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname39\t2\t\t76\tColddplev\tskillname44\tpar8\t\t76\tColddplev\tskillname45\tpar8\t\t76\tColddplev\tskillname55\tpar8\t\t76\tColddplev\tskillname59\tpar8\t\t76\tColddplev\tskillname64\tpar8\t\t\t\t\t\t\t\t\t0\n",
+                u8"frozen armor\t3\t1\t3\t3\t8\t18\tskillname40\tskillld40\tskillld40\tskillan40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34+(skill('Shiver Armor'.blvl)+skill('Chilling Armor'.blvl))*par7\t25\t36\tStrSkillFreezeLengthSingular\tStrSkill62\tln56*(100+((skill('Shiver Armor'.blvl)+skill('Chilling Armor'.blvl))*par8))/100\t25\t74\tStrSkill21\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname40\t2\t\t76\tFrezLenplev\tskillname50\tpar8\t\t76\tSecplev2\tskillname50\t(par7 + 12)/25\t\t76\tFrezLenplev\tskillname60\tpar8\t\t76\tSecplev2\tskillname60\t(par7 + 12)/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"inferno\t1\t2\t1\t1\t10\t12\tskillname41\tskillld41\tskillld41\tskillan41\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillManaCostPerSecond\t\tmps\t\t36\tStrSkillRangeSingular\tStrSkill56\tln12/4*2\t3\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*12/256\texms*12/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill115\t\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname41\t2\t\t76\tFiredplev\tskillname37\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"static field\t2\t2\t1\t2\t12\t21\tskillname42\tskillxld42\tskillxld42\tskillan42\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill33\t\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"telekinesis\t2\t2\t3\t2\t14\t\tskillname43\tskillld43\tskillld43\tskillan43\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"frost nova\t3\t2\t1\t3\t16\t\tskillname44\tskillld44\tskillld44\tskillan44\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname44\t2\t\t76\tColddplev\tskillname59\tpar8\t\t76\tColddplev\tskillname64\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"ice blast\t3\t2\t2\t3\t18\t16\tskillname45\tskillld45\tskillld45\tskillan45\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFreezeLengthSingular\tStrSkill29\tedln\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname45\t2\t\t76\tColddplev\tskillname39\tpar8\t\t76\tFrezLenplev\tskillname55\tpar7\t\t76\tColddplev\tskillname59\tpar8\t\t76\tColddplev\tskillname64\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"blaze\t1\t3\t1\t1\t20\t\tskillname46\tskillld46\tskillld46\tskillan46\t9\t\t\t\t\t\t\t\t\t\t\t\t\tblaze\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillBlazeDuration\tStrSkillBlazeDuration\tdm12\t25\t74\tStrSkill89\t\tln34\t\t36\tStrSkillFireDurationSingular\tStrSkill82\tmiss('blaze'.rang)\t25\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*25*3/256\texms*25*3/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname46\t2\t\t76\tFiredplev\tskillname37\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fire ball\t1\t3\t2\t1\t22\t14\tskillname47\tskillld47\tskillld47\tskillan47\t5\t\t\t\t\t\t\t\t\t\t\t\t\tfireball\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tpar1*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname47\t2\t\t76\tFiredplev\tskillname36\tpar8\t\t76\tFiredplev\tskillname56\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"nova\t2\t3\t1\t2\t24\t\tskillname48\tskillld48\tskillld48\tskillan48\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname48\t2\t\t76\tLtngdplev\tskillname42\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lightning\t2\t3\t2\t2\t26\t20\tskillname49\tskillld49\tskillld49\tskillan49\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname49\t2\t\t76\tLtngdplev\tskillname38\tpar8\t\t76\tLtngdplev\tskillname48\tpar8\t\t76\tLtngdplev\tskillname53\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"shiver armor\t3\t3\t3\t3\t28\t\tskillname50\tskillld50\tskillld50\tskillan50\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34+(skill('Frozen Armor'.blvl)+skill('Chilling Armor'.blvl))*par7\t25\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill21\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname50\t2\t\t76\tColddplev\tskillname40\tpar8\t\t76\tSecplev2\tskillname40\t(par7 + 12)/25\t\t76\tColddplev\tskillname60\tpar8\t\t76\tSecplev2\tskillname60\t(par7 + 12)/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fire wall\t1\t4\t1\t1\t30\t\tskillname51\tskillld51\tskillld51\tskillan51\t9\t\t\t\t\t\t\t\t\t\t\t\t\tfirewallmaker\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRangeSingular\tStrSkill56\tm1rn*2\t3\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*25*3/256\texms*25*3/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t35\t25\t36\tStrSkillFireDurationSingular\tStrSkill82\tmiss('firewall'.rang)\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname51\t2\t\t76\tFiredplev\tskillname37\tpar8\t\t76\tFiredplev\tskillname41\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"enchant\t1\t4\t3\t1\t32\t15\tskillname52\tskillld52\tskillld52\tskillan52\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t75\tStrSkill5\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname52\t2\t\t76\tFiredplev\tskillname37\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"chain lightning\t2\t4\t2\t2\t34\t\tskillname53\tskillld53\tskillld53\tskillan53\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill7\t\tenma\texma\t74\tStrSkill11\t\tln34/par5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname53\t2\t\t76\tLtngdplev\tskillname38\tpar8\t\t76\tLtngdplev\tskillname48\tpar8\t\t76\tLtngdplev\tskillname49\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"teleport\t2\t4\t3\t2\t36\t\tskillname54\tskillld54\tskillld54\tskillan54\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 1)\"\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"glacial spike\t3\t4\t2\t3\t38\t17\tskillname55\tskillld55\tskillld55\tskillan55\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillFreezeLengthSingular\tStrSkill29\tln34 * (100 + skill('Blizzard'.blvl) * par7) / 100\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname55\t2\t\t76\tColddplev\tskillname39\tpar8\t\t76\tColddplev\tskillname45\tpar8\t\t76\tFrezLenplev\tskillname59\tpar7\t\t76\tColddplev\tskillname64\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"meteor\t1\t5\t2\t1\t40\t\tskillname56\tskillld56\tskillld56\tskillan56\t5\t\t\t\t\t\t\t\t\t\t\t\t\tmeteorfire\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkillFireDamageAveragePerSecond\t\tm1eo*25*3*(mael+100)/100/256\tm1ey*25*3*(mael+100)/100/256\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t30\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname56\t2\t\t76\tFiredplev\tskillname36\tpar8\t\t76\tFiredplev\tskillname47\tpar8\t\t76\tAFDImm\tskillname41\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"thunder storm\t2\t5\t1\t2\t42\t\tskillname57\tskillld57\tskillld57\tskillan57\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tpar7*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname57\t2\t\t76\tLtngdplev\tskillname42\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"energy shield\t2\t5\t3\t2\t44\t\tskillname58\tskillld58\tskillld58\tskillan58\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkill41\t\t\"min(edmn,95)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillManaConsumedRatio\t\t(par5)*100/16-skill('Telekinesis'.blvl)*100/16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname58\t2\t\t76\tStrSkillManaConsumedSynergy\tskillname43\t-6.25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"blizzard\t3\t5\t1\t3\t46\t\tskillname59\tskillld59\tskillld59\tskillan59\t5\t\t\t\t\t\t\t\t\t\t\t\t\tblizzardcenter\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tmiss('blizzardcenter'.rang)\t25\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t45\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname59\t2\t\t76\tColddplev\tskillname39\tpar8\t\t76\tColddplev\tskillname45\tpar8\t\t76\tColddplev\tskillname55\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"chilling armor\t3\t5\t3\t3\t48\t25\tskillname60\tskillld60\tskillld60\tskillan60\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34+(skill('Frozen Armor'.blvl)+skill('Shiver Armor'.blvl))*par7\t25\t75\tStrSkill6\t\tenma\texma\t74\tStrSkill21\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname60\t2\t\t76\tColddplev\tskillname40\tpar8\t\t76\tSecplev2\tskillname40\t(par7 + 12)/25\t\t76\tColddplev\tskillname50\tpar8\t\t76\tSecplev2\tskillname50\t(par7 + 12)/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fire mastery\t1\t6\t2\t1\t50\t\tskillsname61\tskillld61\tskillld61\tskillan61\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillFireDamagePercent\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"hydra\t1\t6\t3\t1\t52\t\tskillname62\tskillld62\tskillld62\tskillan62\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill113\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkillHydraMax\t\tpar3/3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname62\t2\t\t76\tFiredplev\tskillname36\tpar8\t\t76\tFiredplev\tskillname47\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lightning mastery\t2\t6\t2\t2\t54\t\tskillname63\tskillxld63\tskillxld63\tskillan63\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillLightningDamagePercent\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"frozen orb\t3\t6\t1\t3\t56\t\tskillname64\tskillld64\tskillld64\tskillan64\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname64\t2\t\t76\tColddplev\tskillname39\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"cold mastery\t3\t6\t2\t3\t58\t\tskillname65\tskillld65\tskillld65\tskillan65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tModitemenrescoldsk\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"amplify damage\t1\t1\t2\t1\t0\t\tskillname66\tskillld66\tskillld66\tskillan66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill37\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"teeth\t2\t1\t2\t2\t2\t\tskillname67\tskillld67\tskillld67\tskillan67\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t74\tStrSkill28\t\t\"min(ln12,24)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname67\t2\t\t76\tMagdplev\tskillname78\tpar8\t\t76\tMagdplev\tskillname84\tpar8\t\t76\tMagdplev\tskillname88\tpar8\t\t76\tMagdplev\tskillname93\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bone armor\t2\t1\t3\t2\t4\t\tskillname68\tskillld68\tskillld68\tskillan68\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill40\t\t(ln12 + (skill('Bone Wall'.blvl) + skill('Bone Prison'.blvl)) * par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname68\t2\t\t76\tDamabsplev\tskillname78\tpar8\t\t76\tDamabsplev\tskillname88\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"skeleton mastery\t3\t1\t1\t3\t6\t\tskillname69\tskillld69\tskillld69\tskillan69\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillSleketonMasteryMonsterDamage\t\tlvl*par4\t\t74\tStrSkill97\t\tlvl*par3\t\t74\tStrSkill43\t\t(lvl < 2) ? 0 : skill('Skeleton Mastery'.lvl)\t\t74\tStrSkill96\tStrSkill42\tlvl*par1\t\t74\tStrSkillSleketonMasterySkeletonDamage\t\tlvl*par2\t\t74\tStrSkill95\t\tlvl*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"raise skeleton\t3\t1\t3\t3\t8\t\tskillname70\tskillld70\tskillld70\tskillan70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkill94\tStrSkill44\t(lvl < 4) ?lvl:(2+lvl/3)\t\t74\tStrSkillDefense\t\t5+(lvl+skill('Skeleton Mastery'.lvl))*par5\t\t74\tStrSkillDamagePercent\t\t((lvl < 4) ? 0 : ((lvl-3)*par3))\t\t74\tStrSkillAttackRating\t\t5+(lvl+skill('Skeleton Mastery'.lvl))*par4\t\t13\tStrSkill42\t\t(lvl < 4) ? 0 : (par2 * (lvl - 3))\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par1)\t34\tStrSkill4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname70\t2\t\t18\tskillname69\t\t\t\t18\tskillname89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"dim vision\t1\t2\t1\t1\t10\t\tskillname71\tskillld71\tskillld71\tskillan71\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"weaken\t1\t2\t3\t1\t12\t\tskillname72\tskillld72\tskillld72\tskillan72\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill38\t\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"poison dagger\t2\t2\t1\t2\t14\t\tskillname73\tskillld73\tskillld73\tskillan73\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname73\t2\t\t76\tPoisdplev\tskillname83\tpar8\t\t76\tPoisdplev\tskillname92\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"corpse explosion\t2\t2\t2\t2\t16\t\tskillname74\tskillld74\tskillld74\tskillan74\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln34\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill46\t\tpar1\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"clay golem\t3\t2\t2\t3\t18\t\tskillname75\tskillld75\tskillld75\tskillan75\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t34\tStrSkill4\t\t\t\t74\tCgslow\t\tdm34\t\t74\tStrSkillAttackRatingFlatBonus\t\tlvl*par8\t\t13\tStrSkill42\t\t(100+(par1 * (lvl - 1)))*(100+skill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8)))/100-100\t\t\t\t\t\t\t74\tStrSkillDefense\t\t100+skill('IronGolem'.lvl)*skill('IronGolem'.par8)\t\t74\tStrSkillAttackRating\t\t40 + skill('Golem Mastery'.ln56) + (lvl*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname75\t2\t\t18\tskillname79\t\t\t\t18\tskillname89\t\t\t\t76\tHpplev\tskillname85\tskill('BloodGolem'.par8)\t\t76\tStrSkillDefensePerLevelFlat\tskillname90\tskill('IronGolem'.par8)\t\t76\tDamplev\tskillname94\tskill('FireGolem'.par8)\t\t\t\t\t\t\t\t\t0\n",
+                u8"iron maiden\t1\t3\t2\t1\t20\t\tskillname76\tskillld76\tskillld76\tskillan76\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t74\tStrSkill55\t\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"terror\t1\t3\t3\t1\t22\t\tskillname77\tskillld77\tskillld77\tskillan77\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bone wall\t2\t3\t3\t2\t24\t\tskillname78\tskillld78\tskillld78\tskillan78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t13\tStrSkill42\t\t(par1 * (lvl-1)) + ((skill('Bone Armor'.blvl)+skill('Bone Prison'.blvl))*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tpar2\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname78\t2\t\t76\tHpplev\tskillname68\tpar8\t\t76\tHpplev\tskillname88\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"golem mastery\t3\t3\t1\t3\t26\t\tskillname79\tskillld79\tskillld79\tskillan79\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill89\t\tdm34\t\t74\tStrSkillAttackRatingFlatBonus\t\tln56\t\t74\tStrSkillLifePercent\t\tlvl*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"raise skeletal mage\t3\t3\t3\t3\t28\t\tskillname80\tskillld80\tskillld80\tskillan80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkill43a\tStrSkill44a\t(lvl < 4) ?lvl:(2+lvl/3)\t\t74\tStrSkillDefense\t\t(lvl+skill('Skeleton Mastery'.lvl))*par5\t\t13\tStrSkill42\t\t(lvl < 4) ? 0 : (par2 * (lvl - 3))\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname80\t2\t\t18\tskillname69\t\t\t\t18\tskillname89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"confuse\t1\t4\t1\t1\t30\t\tskillname81\tskillld81\tskillld81\tskillan81\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"life tap\t1\t4\t2\t1\t32\t\tskillname82\tskillld82\tskillld82\tskillan82\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill79\t\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"poison explosion\t2\t4\t1\t2\t34\t\tskillname83\tskillld83\tskillld83\tskillan83\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname83\t2\t\t76\tPoisdplev\tskillname73\tpar8\t\t76\tPoisdplev\tskillname92\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bone spear\t2\t4\t2\t2\t36\t\tskillname84\tskillld84\tskillld84\tskillan84\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname84\t2\t\t76\tMagdplev\tskillname67\tpar8\t\t76\tMagdplev\tskillname78\tpar8\t\t76\tMagdplev\tskillname88\tpar8\t\t76\tMagdplev\tskillname93\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bloodgolem\t3\t4\t2\t3\t38\t\tskillname85\tskillld85\tskillld85\tskillan85\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t34\tStrSkill4\t\t\t\t74\tStrSkill80\t\tdm12\t\t13\tStrSkill42\t\t(100 + (par7 * (lvl - 1)))*(100 + skill('Golem Mastery'.ln12))/100 - 100\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDefense\t\t120+skill('IronGolem'.lvl)*skill('IronGolem'.par8)\t\t74\tStrSkillAttackRating\t\t60 + skill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname85\t2\t\t18\tskillname79\t\t\t\t18\tskillname89\t\t\t\t76\tStrSkillAttackRatingPerLevelFlat\tskillname75\tskill('Clay Golem'.par8)\t\t76\tStrSkillDefensePerLevelFlat\tskillname90\tskill('IronGolem'.par8)\t\t76\tDamplev\tskillname94\tskill('FireGolem'.par8)\t\t\t\t\t\t\t\t\t0\n",
+                u8"attract\t1\t5\t1\t1\t40\t\tskillname86\tskillxld86\tskillxld86\tskillan86\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"decrepify\t1\t5\t3\t1\t42\t\tskillname87\tskillld87\tskillld87\tskillan87\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill89\t\tpar5\t\t74\tStrSkill106\t\tpar5\t\t74\tStrSkill37\t\t0\t\t74\tStrSkill38\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bone prison\t2\t5\t3\t2\t44\t\tskillname88\tskillld88\tskillld88\tskillan88\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\t\"max(usmc, 1)\"\t256\t13\tStrSkill42\t\t(par1 * (lvl-1)) + ((skill('Bone Armor'.blvl)+skill('Bone Wall'.blvl))*par8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tpar2\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname88\t2\t\t76\tHpplev\tskillname68\tpar8\t\t76\tHpplev\tskillname78\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"summon resist\t3\t5\t1\t3\t46\t\tskillname89\tskillld89\tskillld89\tskillan89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill54\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"irongolem\t3\t5\t2\t3\t48\t\tskillname90\tskillld90\tskillld90\tskillan90\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDefenseFlatBonus\t\tlvl*par8\t\t74\tStrSkill55\t\tln12\t\t18\tStrSkill112\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDefense\t\t140+lvl*par8\t\t34\tStrSkill4\t\t\t\t74\tStrSkillAttackRating\t\t80 + skill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\t\t13\tStrSkill42\t\tskill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8))\t\t40\tSksyn\tskillname90\t2\t\t18\tskillname79\t\t\t\t18\tskillname89\t\t\t\t76\tStrSkillAttackRatingPerLevelFlat\tskillname75\tskill('Clay Golem'.par8)\t\t76\tHpplev\tskillname85\tskill('BloodGolem'.par8)\t\t76\tDamplev\tskillname94\tskill('FireGolem'.par8)\t\t\t\t\t\t\t\t\t0\n",
+                u8"lower resist\t1\t6\t2\t1\t50\t\tskillname91\tskillld91\tskillld91\tskillan91\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill54\t\t-dm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"poison nova\t2\t6\t1\t2\t52\t\tskillname92\tskillld92\tskillld92\tskillan92\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname92\t2\t\t76\tPoisdplev\tskillname73\tpar8\t\t76\tPoisdplev\tskillname83\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bone spirit\t2\t6\t2\t2\t54\t\tskillname93\tskillld93\tskillld93\tskillan93\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname93\t2\t\t76\tMagdplev\tskillname67\tpar8\t\t76\tMagdplev\tskillname78\tpar8\t\t76\tMagdplev\tskillname84\tpar8\t\t76\tMagdplev\tskillname88\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"firegolem\t3\t6\t2\t3\t56\t\tskillname94\tskillld94\tskillld94\tskillan94\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkillHolyFireDamageRange\t\tsklvl('Holy Fire'.ln56.edmn)\tsklvl('Holy Fire'.ln56.edmx)*((100+sklvl('Holy Fire'.ln56.par6))/100)\t41\tStrSkill5\t\tedmn+sklvl('Holy Fire'.ln56.edmn)*sklvl('Holy Fire'.ln56.par5)\tedmx+sklvl('Holy Fire'.ln56.edmx)*sklvl('Holy Fire'.ln56.par5)\t74\tStrSkill103\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDefense\t\t200+skill('IronGolem'.lvl)*skill('IronGolem'.par8)\t\t74\tStrSkillAttackRating\t\t120 + skill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\t\t13\tStrSkill42\t\tskill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8))\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname94\t2\t\t18\tskillname79\t\t\t\t18\tskillname89\t\t\t\t76\tStrSkillAttackRatingPerLevelFlat\tskillname75\tskill('Clay Golem'.par8)\t\t76\tHpplev\tskillname85\tskill('BloodGolem'.par8)\t\t76\tStrSkillDefensePerLevelFlat\tskillname90\tskill('IronGolem'.par8)\t\t\t\t\t\t\t\t\t0\n",
+                u8"revive\t3\t6\t3\t3\t58\t\tskillname95\tskillld95\tskillld95\tskillan95\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillMonstersCount\t\tlvl\t\t\t\t\t\t \t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t74\tStrSkillDamagePercent\t\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par4)\t\t74\tStrSkillLifePercent\t\tpar1 + skill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par3)\t\t\t\t\t\t\t40\tSksyn\tskillname95\t2\t\t18\tskillname69\t\t\t\t18\tskillname89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"sacrifice\t1\t1\t1\t1\t0\t\tskillname96\tskillld96\tskillld96\tskillan96\t7\tln12+skill('Redemption'.blvl)*par8+skill('Fanaticism'.blvl)*par7\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillDamagePercent\t\tln12+skill('Redemption'.blvl)*par8+skill('Fanaticism'.blvl)*par7\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill47\t\t\"max(par6, par5-lvl/par3)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname96\t2\t\t76\tDamplev\tskillname124\tpar8\t\t76\tDamplev\tskillname122\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"smite\t1\t1\t3\t1\t2\t\tskillname97\tskillld97\tskillld97\tskillan97\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,ln12)\"\t25\t74\tStrSkillDamagePercent\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t18\tStrSkillAlwaysHits\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"might\t2\t1\t1\t2\t4\t11\tskillname98\tskillld98\tskillld98\tskillan98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkillDamagePercent\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"prayer\t3\t1\t1\t3\t6\t6\tskillname99\tskillld99\tskillld99\tskillan99\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill34\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkillHealFlat\t\tedmn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"resist fire\t3\t1\t3\t3\t8\t\tskillname100\tskillld100\tskillld100\tskillan100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t36\tStrSkillMaxResistFirePassive\tStrSkillMaxResistFirePassive\t(skill('Resist Fire'.blvl) < 1) ? 1 : skill('Resist Fire'.blvl)\t2\t74\tStrSkillMaxResistFireActive\t\t(skill('Resist Fire'.blvl) < 1) ? 1 : skill('Resist Fire'.blvl)\t\t74\tStrSkill51\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"holy bolt\t1\t2\t2\t1\t10\t\tskillname101\tskillld101\tskillld101\tskillan101\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill50\t\tln12 * (100 + skill('Prayer'.blvl) * par7) / 100\tln34 * (100 + skill('Prayer'.blvl) * par7) / 100\t75\tStrSkill39\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname101\t2\t\t76\tMagdplev\tskillname121\tpar8\t\t76\tHealplev\tskillname99\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"holy fire\t2\t2\t2\t2\t12\t\tskillname102\tskillld102\tskillld102\tskillan102\t25\t0\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t75\tStrSkill5\t\tenma\texma*((100+par6)/100)\t75\tStrSkillFireDamageToYourAttack\t\tedns*par5/256\tedxs*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillProximityDamage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname102\t2\t\t76\tFiredplev\tskillname100\tpar8\t\t76\tFiredplev\tskillname125\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"thorns\t2\t2\t3\t2\t14\t9\tskillname103\tskillld103\tskillld103\tskillan103\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tModStr1v\t\tenma\t\t74\tStrSkill55\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"defiance\t3\t2\t2\t3\t16\t7\tskillname104\tskillld104\tskillld104\tskillan104\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill21\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"resist cold\t3\t2\t3\t3\t18\t\tskillname105\tskillld105\tskillld105\tskillan105\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t36\tStrSkillMaxResistColdPassive\tStrSkillMaxResistColdPassive\t(skill('Resist Cold'.blvl) < 1) ? 1 : skill('Resist Cold'.blvl)\t2\t74\tStrSkillMaxResistColdActive\t\t(skill('Resist Cold'.blvl) < 1) ? 1 : skill('Resist Cold'.blvl)\t\t74\tStrSkill52\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"zeal\t1\t3\t1\t1\t20\t\tskillname106\tskillld106\tskillld106\tskillan106\t7\t((lvl < 5) ? 0 : ((lvl-4) * par4) )+skill('Sacrifice'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\t((lvl < 5) ? 0 : ((lvl-4) * par4) )+skill('Sacrifice'.blvl)*par8\t\t74\tStrSkill22\t\ttoht\t\t74\tStrSkill11\t\t\"min((par5 + lvl -1), par6)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname106\t2\t\t76\tDamplev\tskillname96\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"charge\t1\t3\t3\t1\t22\t\tskillname107\tskillld107\tskillld107\tskillan107\t7\tln34+(skill('Vigor'.blvl)+skill('Might'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tln34+(skill('Vigor'.blvl)+skill('Might'.blvl))*par8\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname107\t2\t\t76\tDamplev\tskillname115\tpar8\t\t76\tDamplev\tskillname98\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"blessed aim\t2\t3\t1\t2\t24\t8\tskillname108\tskillld108\tskillld108\tskillan108\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkillAttackRatingPassive\t\t(skill('Blessed Aim'.blvl) < 1) ? par8 : skill('Blessed Aim'.blvl) * par8\t\t74\tStrSkillAttackRatingActive\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"cleansing\t3\t3\t1\t3\t38\t\tskillname109\tskillld109\tskillld109\tskillan109\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill74\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t76\tHealplev2\tskillname99\tskill('Prayer'.edmn)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname109\t2\t\t18\tskillname99\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"resist lightning\t3\t3\t3\t3\t28\t\tskillname110\tskillld110\tskillld110\tskillan110\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t36\tStrSkillMaxResistLightningPassive\tStrSkillMaxResistLightningPassive\t(skill('Resist Lightning'.blvl) < 1) ? 1 : skill('Resist Lightning'.blvl)\t2\t74\tStrSkillMaxResistLightningActive\t\t(skill('Resist Lightning'.blvl) < 1) ? 1 : skill('Resist Lightning'.blvl)\t\t74\tStrSkill53\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"vengeance\t1\t4\t1\t1\t40\t\tskillname111\tskillld111\tskillld111\tskillan111\t11\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillLightningDamagePercent\t\tln12+skill('Resist Lightning'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t74\tStrSkillColdDamagePercent\t\tln12+skill('Resist Cold'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t74\tStrSkillFireDamagePercent\t\tln12+skill('Resist Fire'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname111\t2\t\t76\tFiredplev\tskillname100\tpar8\t\t76\tColddplev\tskillname105\tpar8\t\t76\tLtngdplev\tskillname110\tpar8\t\t76\tElemDampLev\tskillname125\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"blessed hammer\t1\t4\t2\t1\t32\t\tskillname112\tskillld112\tskillld112\tskillan112\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDamageToUndead\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname112\t2\t\t76\tMagdplev\tskillname108\tpar8\t\t76\tMagdplev\tskillname115\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"concentration\t2\t4\t1\t2\t34\t\tskillname113\tskillld113\tskillld113\tskillan113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkillDamagePercent\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill76\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"holy freeze\t2\t4\t2\t2\t36\t10\tskillname114\tskillld114\tskillld114\tskillan114\t25\t0\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill77\t\tdm34\t\t75\tStrSkill6\t\tenma\texma*((100+par6)/100)\t75\tStrSkillColdDamageToYourAttack\t\tedns*par5/256\tedxs*par5/256\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillProximityDamage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname114\t2\t\t76\tColddplev\tskillname105\tpar8\t\t76\tColddplev\tskillname125\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"vigor\t3\t4\t2\t3\t26\t\tskillname115\tskillld115\tskillld115\tskillan115\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill69\t\tln34\t\t74\tStrSkill102\t\tln34\t\t74\tStrSkill89\t\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"conversion\t1\t5\t1\t1\t30\t\tskillname116\tskillld116\tskillld116\tskillan116\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkill99\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"holy shield\t1\t5\t3\t1\t42\t\tskillname117\tskillld117\tskillld117\tskillan117\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkill110\t\tdm56\t\t74\tStrSkill21\t\tln34+skill('Defiance'.blvl)*par8\t\t75\tStrSkillSmiteDamage\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname117\t2\t\t76\tDefplev\tskillname104\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"holy shock\t2\t5\t2\t2\t44\t\tskillname118\tskillxld118\tskillxld118\tskillan118\t25\t0\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t75\tStrSkill7\t\tenma\texma*((100+par6)/100)\t75\tstrEskilllighttoattack\t\tedns/256\tedxs*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillProximityDamage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname118\t2\t\t76\tLtngdplev\tskillname110\tpar8\t\t76\tLtngdplev\tskillname125\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"sanctuary\t2\t5\t3\t2\t46\t\tskillname119\tskillld119\tskillld119\tskillan119\t25\t0\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t75\tStrSkill39\t\tenma\texma*((100+par7)/100)\t74\tStrSkillDamageToUndead\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillProximityDamage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname119\t2\t\t76\tMagdplev\tskillname109\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"meditation\t3\t5\t1\t3\t48\t\tskillname120\tskillld120\tskillld120\tskillan120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill88\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t76\tHealplev2\tskillname99\tskill('Prayer'.edmn)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname120\t2\t\t18\tskillname99\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fist of the heavens\t1\t6\t2\t1\t50\t\tskillname121\tskillld121\tskillld121\tskillan121\t5\t\t\t\t\t\t\t\t\t\t\t\t\tfistoftheheavensbolt\t\t\t75\tStrSkill91\t\tm1en\tm1ex\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t10\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname121\t2\t\t76\tHbdplev\tskillname101\t15\t\t76\tLtngdplev\tskillname118\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fanaticism\t2\t6\t1\t2\t52\t\tskillname122\tskillxld122\tskillxld122\tskillan122\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill106\t\tdm34\t\t74\tPartDam\t\tln56/2\t\t74\tFanYDam\t\tln56\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"conviction\t2\t6\t3\t2\t56\t\tskillname123\tskillld123\tskillld123\tskillan123\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill54\t\t\"-min(ln34,150)\"\t\t74\tStrSkill21\t\t-dm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"redemption\t3\t6\t2\t3\t54\t\tskillname124\tskillxld124\tskillxld124\tskillan124\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill107\t\tln56\t\t74\tStrSkill109\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"salvation\t3\t6\t3\t3\t58\t\tskillname125\tskillld125\tskillld125\tskillan125\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t74\tStrSkill54\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"bash\t1\t1\t2\t1\t0\t22\tskillname126\tskillld126\tskillld126\tskillan126\t7\tclc1\tln34\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillDamageFlat\t\tln34\t\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname126\t2\t\t76\tDamplev\tskillname139\tpar8\t\t76\tAttRateplev\tskillname144\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"blade mastery\t2\t1\t1\t2\t2\t\tskillname127\tskillld127\tskillld127\tskillan127\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"axe mastery\t2\t1\t2\t2\t4\t\tskillname128\tskillld128\tskillld128\tskillan128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"mace mastery\t2\t1\t3\t2\t6\t\tskillname129\tskillld129\tskillld129\tskillan129\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"howl\t3\t1\t1\t3\t8\t\tskillname130\tskillld130\tskillld130\tskillan130\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln56\t25\t36\tStrSkill58\t\tln34*2\t3\t36\tStrSkillRadiusSingular\tStrSkill18\t(ln12-3)/2*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"find potion\t3\t1\t3\t3\t10\t\tskillname131\tskillld131\tskillld131\tskillan131\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"leap\t1\t2\t1\t1\t12\t\tskillname132\tskillld132\tskillld132\tskillan132\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillKnockbackRadius\tStrSkillKnockbackRadius\tln34*2\t3\t36\tStrSkillRangeRadius\tStrSkillRangeRadius\tdm12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"double swing\t1\t2\t3\t1\t14\t\tskillname133\tskillld133\tskillld133\tskillan133\t19\tclc1\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t36\tStrSkill3\t\t\"max(0, usmc*2)\"\t256\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDamagePercent\t\tclc1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname133\t2\t\t76\tDamplev\tskillname126\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"pole arm mastery\t2\t2\t1\t2\t16\t\tskillname134\tskillld134\tskillld134\tskillan134\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"throwing mastery\t2\t2\t2\t2\t18\t\tskillname135\tskillld135\tskillld135\tskillan135\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\tStrSkillReplenishOnCrit\t\t\t\t74\tStrSkillNoConsumeChance\t\tmanc\t\t74\tStrSkillPiercingChance\t\tmapi\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"spear mastery\t2\t2\t3\t2\t20\t\tskillname136\tskillld136\tskillld136\tskillan136\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"taunt\t3\t2\t1\t3\t22\t28\tskillname137\tskillld137\tskillld137\tskillan137\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill38\t\tln34\t\t74\tStrSkill57\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"shout\t3\t2\t2\t3\t24\t\tskillname138\tskillld138\tskillld138\tskillan138\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tlen\t25\t74\tStrSkill21\t\tln12\t\t36\tStrSkillRadiusSingular\tStrSkill18\t19*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname138\t2\t\t76\tSecplev2\tskillname149\tpar8/25\t\t76\tSecplev2\tskillname155\tpar8/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"stun\t1\t3\t2\t1\t26\t23\tskillname139\tskillld139\tskillld139\tskillan139\t7\tclc1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,edln)\"\t25\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDamagePercent\t\tclc1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname139\t2\t\t76\tDamplev\tskillname126\tpar8\t\t76\tAttRateplev\tskillname144\tpar7\t\t76\tDurateplev\tskillname154\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"double throw\t1\t3\t3\t1\t28\t\tskillname140\tskillld140\tskillld140\tskillan140\t13\t\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc*2\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname140\t2\t\t76\tDamplev\tskillname133\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"increased stamina\t2\t3\t1\t2\t30\t\tskillname141\tskillld141\tskillld141\tskillan141\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill102\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"find item\t3\t3\t3\t3\t32\t\tskillname142\tskillld142\tskillld142\tskillan142\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12+skill('Find Potion'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname142\t2\t\t76\tStrSkillSkillChancePerLevel\tskillname131\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"leap attack\t1\t4\t1\t1\t34\t\tskillname143\tskillld143\tskillld143\tskillan143\t26\tclc1\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t75\tStrSkill4\t\tpnma\tpxma\t36\tStrSkillRadiusSingular\tStrSkill18\t7*2\t3\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname143\t2\t\t76\tDamplev\tskillname132\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"concentrate\t1\t4\t2\t1\t36\t\tskillname144\tskillld144\tskillld144\tskillan144\t7\tclc1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkill21\t\tln34\t\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillMagicDamagePercent\t\tclc4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname144\t2\t\t76\tDamplev\tskillname126\tpar8\t\t76\tDamplev\tskillname149\tpar7\t\t76\tMagdplev\tskillname152\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"iron skin\t2\t4\t3\t2\t38\t27\tskillname145\tskillld145\tskillld145\tskillan145\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"battle cry\t3\t4\t1\t3\t40\t24\tskillname146\tskillld146\tskillld146\tskillan146\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t74\tStrSkill25\t\tln34\t\t74\tStrSkill38\t\tln56\t\t36\tStrSkillRadiusSingular\tStrSkill18\t5*2\t3\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"frenzy\t1\t5\t3\t1\t42\t26\tskillname147\tskillld147\tskillld147\tskillan147\t19\tclc1\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t75\tStrSkillRunWalkRange\t\t15*(par4-par3)/100+par3\tdm34\t75\tStrSkillAttackSpeedRange\t\t15*(par6-par5)/100+par5\tdm56\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc*2\t256\t36\tStrSkillDurationSingular\tStrSkill20\tpar7+skill('Increased Stamina'.blvl)*10\t25\t74\tStrSkillMagicDamagePercent\t\tclc4\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname147\t2\t\t76\tDamplev\tskillname133\tpar8\t\t76\tDamplev\tskillname137\tpar8\t\t77\tStrSkillSynergySecondsDecimal\tskillname141\t0\t4\t76\tMagdplev\tskillname152\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"increased speed\t2\t5\t1\t2\t44\t\tskillname148\tskillld148\tskillld148\tskillan148\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill89\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"battle orders\t3\t5\t2\t3\t46\t\tskillname149\tskillld149\tskillld149\tskillan149\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tlen\t25\t74\tStrSkill102\t\tln34\t\t74\tStrSkill101\t\tln34\t\t74\tStrSkill100\t\tln34\t\t36\tStrSkillRadiusSingular\tStrSkill18\t19*2\t3\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname149\t2\t\t76\tSecplev2\tskillname138\tpar8/25\t\t76\tSecplev2\tskillname155\tpar8/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"grim ward\t3\t5\t3\t3\t48\t\tskillname150\tskillld150\tskillld150\tskillan150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tCgslow\t\tdm78\t\t36\tStrSkillRadiusSingular\tStrSkill18\tln12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tclc1\t25\t74\tStrSkillEnemyDamageTaken\t\tpar3 + (skill('Find Potion'.blvl) * par4)\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname150\t2\t\t76\tStrSkillDamageTakenPerLevel\tskillname131\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"whirlwind\t1\t6\t1\t1\t50\t\tskillname151\tskillld151\tskillld151\tskillan151\t1\tclc1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"berserk\t1\t6\t2\t1\t52\t\tskillname152\tskillld152\tskillld152\tskillan152\t7\tclc1\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\t\"par4-min(((110*lvl)/(lvl+6)*(par4-par3)/100),(par4-par3))\"\t25\t74\tStrSkillMagicDamagePercent\t\tclc1\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname152\t2\t\t76\tMagdplev\tskillname130\tpar8\t\t76\tMagdplev\tskillname149\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"natural resistance\t2\t6\t3\t2\t54\t\tskillname153\tskillld153\tskillld153\tskillan153\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill54\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"war cry\t3\t6\t1\t3\t56\t\tskillname154\tskillld154\tskillld154\tskillan154\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,ln12)\"\t25\t75\tStrSkill4\t\tpnma\tpxma\t36\tStrSkillRadiusSingular\tStrSkill18\t7*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname154\t2\t\t76\tDamplev\tskillname130\tpar8\t\t76\tDamplev\tskillname137\tpar8\t\t76\tDamplev\tskillname146\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"battle command\t3\t6\t2\t3\t58\t\tskillname155\tskillld155\tskillld155\tskillan155\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tlen\t25\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\t19*2\t3\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tskillname155\t2\t\t76\tSecplev2\tskillname138\tpar8/25\t\t76\tSecplev2\tskillname149\tpar8/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"scroll of identify\t0\t0\t0\t4\t14\t\tskillname217\tskillld217\tskillld217\tskillan217\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\tscrollbooktext\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"book of identify\t0\t0\t0\t4\t14\t\tskillname218\tskillld218\tskillld218\tskillan218\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\tscrollbooktext\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"scroll of townportal\t0\t0\t0\t4\t18\t\tskillname219\tskillld219\tskillld219\tskillan219\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\tscrollbooktext\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"book of townportal\t0\t0\t0\t4\t18\t\tskillname220\tskillld220\tskillld220\tskillan220\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t56\tscrollbooktext\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"raven\t1\t1\t2\t1\t0\t\tSkillname222\tSkillld222\tSkillld222\tSkillan222\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tESkillHawk\t\t\"min(lvl,par2)\"\t\t74\tStrSkill11\t\tln56\t\t75\tStrSkill4\t\tpnma\tpxma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tEskillincaseraven\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname222\t2\t\t76\tDamplev\tSkillname228\tpar8\t\t76\tDamplev\tSkillname238\tpar8\t\t76\tDamplev\tSkillname248\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"plague poppy\t1\t1\t3\t1\t2\t\tSkillname223\tSkillld223\tSkillld223\tSkillan223\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t13\tStrSkill42\t\t(lvl-1)*par3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname223\t2\t\t76\tPoisdplev\tSkillname239\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"wearwolf\t2\t1\t1\t2\t20\t\tSkillname224\tSkillld224\tSkillld224\tSkillan224\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill106\t\tdm34\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t36\tStrSkillDurationSingular\tStrSkill20\t1000+skill('shape shifting'.ln12)\t25\t74\tStrSkill102\t\tpar1\t\t74\tStrSkill100\t\tpar2+skill('shape shifting'.ln34)\t\t40\tSksyn\tSkillname224\t2\t\t18\tSkillname225\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"shape shifting\t2\t1\t2\t2\t52\t\tSkillname225\tSkillld225\tSkillld225\tSkillan225\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationPlus\t\tln12\t25\t74\tStrSkill100\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"firestorm\t3\t1\t1\t3\t32\t\tSkillname226\tSkillld226\tSkillld226\tSkillan226\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*25*3/256\texms*25*3/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname226\t2\t\t76\tFiredplev\tSkillname230\tpar8\t\t76\tFiredplev\tSkillname235\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"oak sage\t1\t2\t1\t1\t16\t\tSkillname227\tSkillld227\tSkillld227\tSkillan227\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln78*2\t3\t74\tStrSkill100\t\tln12\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"summon spirit wolf\t1\t2\t2\t1\t6\t\tSkillname228\tSkillld228\tSkillld228\tSkillan228\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\tln56\t\t74\tStrSkill22\t\tln12\t\t74\tESkillWolves\t\t\"min(lvl,par3)\"\t\t75\tStrSkill6\t\tenma\texma\t13\tStrSkill42\t\t(par7 * lvl) + (skill('Summon Fenris'.par2) * skill('Summon Fenris'.lvl))\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname228\t2\t\t76\tHpplev\tSkillname238\tskill('Summon Fenris'.par2)\t\t76\tDamplev\tSkillname248\tskill('Summon Grizzly'.par2)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"wearbear\t2\t2\t3\t2\t22\t\tSkillname229\tSkillld229\tSkillld229\tSkillan229\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\tln34\t\t74\tStrSkillDamagePercent\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t36\tStrSkillDurationSingular\tStrSkill20\t1000+skill('shape shifting'.ln12)\t25\t74\tStrSkill100\t\tpar5 + skill('Shape Shifting'.ln34)\t\t\t\t\t\t\t40\tSksyn\tSkillname229\t2\t\t18\tSkillname225\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"molten boulder\t3\t2\t1\t3\t34\t\tSkillname230\tSkillld230\tSkillld230\tSkillan230\t5\t\t\t\t\t\t\t\t\t\t\t\t\tmoltenboulderfirepath\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkillFireDamageAveragePerSecond\t\tm1eo*25*3*(mael+100)/100/256\tm1ey*25*3*(mael+100)/100/256\t75\tStrSkill5\t\tenma\texma\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname230\t2\t\t76\tDamplev\tSkillname245\tpar7\t\t76\tFiredplev\tSkillname226\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"arctic blast\t3\t2\t3\t3\t36\t\tSkillname231\tSkillld231\tSkillld231\tSkillan231\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillManaCostPerSecond\t\tmps\t\t36\tStrSkillRangeSingular\tStrSkill56\tln12/4*2\t3\t36\tStrSkillColdLengthSingular\tStrSkill13\tedln\t25\t75\tStrSkillColdDamageAveragePerSecond\t\tenms*12/256\texms*12/256\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill115\t\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname231\t2\t\t76\tColddplev\tSkillname236\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"cycle of life\t1\t3\t3\t1\t8\t\tSkillname232\tSkillld232\tSkillld232\tSkillan232\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillHealPercent\t\tln56\t\t13\tStrSkill42\t\t(lvl-1)*par3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"feral rage\t2\t3\t1\t2\t54\t\tSkillname233\tSkillld233\tSkillld233\tSkillan233\t7\tln56\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tln56\t\t75\tStrSkillLifeStealRange\t\t4\tpar2 * lvl + 8\t75\tStrSkillRunWalkRange\t\t19\t((110*(par8+lvl/par7)) * (par4-par3))/(100 * ((par8+lvl/par7)+6)) + par3\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tpar1\t25\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"maul\t2\t3\t3\t2\t56\t\tSkillname234\tSkillld234\tSkillld234\tSkillan234\t1\t\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,dm56)\"\t25\t75\tStrSkillDamagePercentRange\t\tpar3\tpar3 * (lvl/par7+par8)\t75\tStrSkillAttackSpeedRange\t\tpar1\tpar1 * (lvl/par7+par8)\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tpar4\t25\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"eruption\t3\t3\t1\t3\t38\t\tSkillname235\tSkillld235\tSkillld235\tSkillan235\t5\t\t\t\t\t\t\t\t\t\t\t\t\terruption center\t\t\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t50\t25\t36\tStrSkillDurationSingular\tStrSkill20\tmiss('eruption center'.rang)\t25\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname235\t2\t\t76\tFiredplev\tSkillname226\tpar8\t\t76\tFiredplev\tSkillname245\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"cyclone armor\t3\t3\t3\t3\t40\t\tSkillname236\tSkillld236\tSkillld236\tSkillan236\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill40\t\t(ln12*(100+(skill('Twister'.blvl)+skill('Tornado'.blvl)+skill('Hurricane'.blvl))*par8)/100)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname236\t2\t\t76\tDamplev\tSkillname241\tpar8\t\t76\tDamplev\tSkillname246\tpar8\t\t76\tDamplev\tSkillname251\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"heart of wolverine\t1\t4\t1\t1\t10\t\tSkillname237\tSkillld237\tSkillld237\tSkillan237\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln78*2\t3\t74\tStrSkillDamagePercent\t\tln56\t\t74\tStrSkill22\t\tln34\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"summon fenris\t1\t4\t2\t1\t12\t\tSkillname238\tSkillld238\tSkillld238\tSkillan238\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\t(par6 * lvl) + skill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par6)\t\t74\tStrSkill100\t\tln12\t\t74\tESkillWolves\t\t\"min(lvl,par3)\"\t\t75\tStrSkill4\t\tpnma*(100+skill('Summon Grizzly'.ln12))/100\tpxma*(100+skill('Summon Grizzly'.ln12))/100\t13\tStrSkill42\t\t(par7 * lvl) + ln12\t\t\t\t\t\t\t74\tStrSkill22\t\tskill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par2)\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname238\t2\t\t76\tAttRateplev\tSkillname228\tskill('Summon Spirit Wolf'.par2)\t\t76\tDefplev\tSkillname228\tskill('Summon Spirit Wolf'.par6)\t\t76\tDamplev\tSkillname248\tskill('Summon Grizzly'.par2)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"rabies\t2\t4\t1\t2\t24\t\tSkillname239\tSkillld239\tSkillld239\tSkillan239\t23\t\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname239\t2\t\t76\tPoisdplev\tSkillname223\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fire claws\t2\t4\t2\t2\t26\t\tSkillname240\tSkillld240\tSkillld240\tSkillan240\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t75\tStrSkill5\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname240\t2\t\t76\tFiredplev\tSkillname226\tpar8\t\t76\tFiredplev\tSkillname230\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"twister\t3\t4\t2\t3\t42\t\tSkillname241\tSkillld241\tSkillld241\tSkillan241\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillStunLengthSingular\tStrSkill48\tpar2+par7*skill('Arctic Blast'.blvl)\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname241\t2\t\t76\tDurateplev\tSkillname231\tpar7 * 100 / par2\t\t76\tDamplev\tSkillname246\tpar8\t\t76\tDamplev\tSkillname251\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"vines\t1\t5\t3\t1\t14\t\tSkillname242\tSkillld242\tSkillld242\tSkillan242\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill88\t\tln56\t\t13\tStrSkill42\t\t(lvl-1)*par3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"hunger\t2\t5\t2\t2\t58\t\tSkillname243\tSkillld243\tSkillld243\tSkillan243\t14\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tEskillManaSteal\t\tdm34\t\t74\tEskillLifeSteal\t\tdm12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkillDamagePercent\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"shock wave\t2\t5\t3\t2\t28\t\tSkillname244\tSkillld244\tSkillld244\tSkillan244\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillStunLengthSingular\tStrSkill48\tln12\t25\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname244\t2\t\t76\tDamplev\tSkillname234\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"volcano\t3\t5\t1\t3\t44\t\tSkillname245\tSkillld245\tSkillld245\tSkillan245\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill5\t\tenma\texma\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t100\t25\t36\tStrSkillDurationSingular\tStrSkill20\t150\t25\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname245\t2\t\t76\tDamplev\tSkillname230\tpar7\t\t76\tFiredplev\tSkillname235\tpar8\t\t76\tFiredplev\tSkillname250\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"tornado\t3\t5\t2\t3\t46\t\tSkillname246\tSkillld246\tSkillld246\tSkillan246\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname246\t2\t\t76\tDamplev\tSkillname236\tpar8\t\t76\tDamplev\tSkillname241\tpar8\t\t76\tDamplev\tSkillname251\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"spirit of barbs\t1\t6\t1\t1\t4\t\tSkillname247\tSkillld247\tSkillld247\tSkillan247\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tln78*2\t3\t74\tModStr1v\t\tpnma\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"summon grizzly\t1\t6\t2\t1\t18\t\tSkillname248\tSkillld248\tSkillld248\tSkillan248\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkillDamagePercent\t\tln12\t\t75\tStrSkill4\t\tpnma*(100+ln12)/100\tpxma*(100+ln12)/100\t13\tStrSkill42\t\t(par7 * lvl) + (skill('Summon Fenris'.par2) * skill('Summon Fenris'.lvl))\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill21\t\tskill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par6)\t\t74\tStrSkill22\t\tskill('Summon Spirit Wolf'.lvl) * skill('Summon Spirit Wolf'.par2)\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname248\t2\t\t76\tAttRateplev\tSkillname228\tskill('Summon Spirit Wolf'.par2)\t\t76\tDefplev\tSkillname228\tskill('Summon Spirit Wolf'.par6)\t\t76\tHpplev\tSkillname238\tskill('Summon Fenris'.par2)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fury\t2\t6\t1\t2\t30\t\tSkillname249\tSkillld249\tSkillld249\tSkillan249\t7\tln34\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tln34\t\t74\tStrSkill22\t\ttoht\t\t74\tStrSkill11\t\t\"min((par5+lvl-1),par6)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"armageddon\t3\t6\t1\t3\t50\t\tSkillname250\tSkillld250\tSkillld250\tSkillan250\t5\t\t\t\t\t\t\t\t\t\t\t\t\tarmageddonfire\t\t\t75\tStrSkillFireDamageAveragePerSecond\t\tm1eo*25*3*(mael+100)/100/256\tm1ey*25*3*(mael+100)/100/256\t75\tStrSkill5\t\tenma\texma\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tpar3*2\t3\t36\tStrSkillDurationSingular\tStrSkill20\tln12 + skill('Eruption'.blvl) * par7\t25\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname250\t2\t\t76\tSecplev2\tSkillname235\t2\t\t76\tFiredplev\tSkillname226\tpar8\t\t76\tFiredplev\tSkillname230\tpar8\t\t76\tDamplev\tSkillname245\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"hurricane\t3\t6\t2\t3\t48\t\tSkillname251\tSkillld251\tSkillld251\tSkillan251\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill6\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tpar3*2\t3\t36\tStrSkillDurationSingular\tStrSkill20\tln12 + skill('Cyclone Armor'.blvl) * par7\t25\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname251\t2\t\t76\tSecplev2\tSkillname236\t2\t\t76\tDamplev\tSkillname241\tpar8\t\t76\tDamplev\tSkillname246\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fire trauma\t1\t1\t2\t1\t0\t\tSkillname252\tSkillld252\tSkillld252\tSkillan252\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tpar1*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname252\t2\t\t76\tFiredplev\tSkillname257\tpar8\t\t76\tFiredplev\tSkillname262\tpar8\t\t76\tFiredplev\tSkillname263\tpar8\t\t76\tFiredplev\tSkillname272\tpar8\t\t76\tFiredplev\tSkillname273\tpar8\t\t\t\t\t\t\t\t\t0\n",
+                u8"claw mastery\t2\t1\t2\t2\t20\t\tSkillname253\tSkillld253\tSkillld253\tSkillan253\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\teskillincasemasteryX\t\tmacr\t\t74\tStrSkillDamagePercent\t\tmadm\t\t74\tStrSkill22\t\tmath\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"psychic hammer\t2\t1\t3\t2\t22\t\tSkillname254\tSkillld254\tSkillld254\tSkillan254\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkill39\t\tenma\texma\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"tiger strike\t3\t1\t2\t3\t40\t\tSkillname255\tSkillld255\tSkillld255\tSkillan255\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillAssassinTigerStrikeCharge3\t\t3*ln12\t\t74\tStrSkillAssassinTigerStrikeCharge2\t\t2*ln12\t\t74\tStrSkillAssassinTigerStrikeCharge1\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"dragon talon\t3\t1\t3\t3\t42\t\tSkillname256\tSkillld256\tSkillld256\tSkillan256\t15\t\t\t\t\t\t\t\t\t\t\t\t5\t\t\t\t74\tEskillkickdamage\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t36\tEskillKickSing\tEskillKickPlur\tlvl/6+1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"shock field\t1\t2\t1\t1\t2\t\tSkillname257\tSkillld257\tSkillld257\tSkillan257\t5\t\t\t\t\t\t\t\t\t\t\t\t\tshock field on ground\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tmiss('shock field on ground'.rang)\t25\t75\tStrSkillLightningDamageAveragePerSecond\t\tedmn\tedmx\t74\tESkillSpikes\t\tpar1+lvl/par2+skill('Fire Trauma'.blvl)/3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname257\t2\t\t77\tMissplev3\tSkillname252\t1\t3\t76\tLtngdplev\tSkillname262\tpar8\t\t76\tLtngdplev\tSkillname272\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"blade sentinel\t1\t2\t3\t1\t4\t\tSkillname258\tSkillld258\tSkillld258\tSkillan258\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t25\t25\t74\tWeapDamsk\t\t96*100/128\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname258\t2\t\t76\tDamplev\tSkillname267\tpar8\t\t76\tDamplev\tSkillname278\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"quickness\t2\t2\t1\t2\t36\t\tSkillname259\tSkillld259\tSkillld259\tSkillan259\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln56\t25\t74\tStrSkill89\t\tdm12\t\t74\tStrSkill106\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fists of fire\t3\t2\t1\t3\t44\t\tSkillname260\tSkillld260\tSkillld260\tSkillan260\t20\t\t\tfire\tenma\texma\tfire\tenma\texma\tfire\tenma+m1eo*50/256\texma+m1ey*50/256\t2\tfistsoffirefirewall\t\t\t75\tEskillfistsoffire3\t\tm1eo*50/256\tm1ey*50/256\t74\tEskillfistsoffire2\t\tpar1\t\t75\tEskillfistsoffire1\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname260\t2\t\t76\tFiredplev\tSkillname281\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"dragon claw\t3\t2\t3\t3\t46\t\tSkillname261\tSkillld261\tSkillld261\tSkillan261\t19\tln12\t\t\t\t\t\t\t\t\t\t\t2\t\t\t\t74\tStrSkillDamagePercent\t\tln12 + (skill('Claw Mastery'.blvl) * par7)\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname261\t2\t\t76\tDamplev\tSkillname253\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"charged bolt sentry\t1\t3\t1\t1\t6\t\tSkillname262\tSkillld262\tSkillld262\tSkillan262\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill72\t\tln34 + skill('Shock Field'.blvl)/3\t\t74\tESkillShoots\t\tpar1 + skill('Lightning Sentry'.blvl)/4\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname262\t2\t\t77\tBoltplev3\tSkillname257\t1\tpar6\t77\tShotplev3\tSkillname272\t1\tpar7\t76\tLtngdplev\tSkillname252\tpar8\t\t76\tLtngdplev\tSkillname272\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"wake of fire sentry\t1\t3\t2\t1\t8\t\tSkillname263\tSkillld263\tSkillld263\tSkillan263\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill5\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tESkillShoots\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname263\t2\t\t76\tFiredplev\tSkillname252\tpar8\t\t76\tFiredplev\tSkillname273\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"weapon block\t2\t3\t2\t2\t26\t\tSkillname264\tSkillld264\tSkillld264\tSkillan264\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill24\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"cloak of shadows\t2\t3\t3\t2\t24\t\tSkillname265\tSkillld265\tSkillld265\tSkillan265\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln34\t25\t74\tStrSkill25\t\t\"-min(ln56,95)\"\t\t74\tStrSkill21\t\tln78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRangeSingular\tStrSkill56\tdm12*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"cobra strike\t3\t3\t2\t3\t50\t\tSkillname266\tSkillld266\tSkillld266\tSkillan266\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t74\tStrSkillAssassinCobraStrikeCharge3\t\t2*ln12\t\t74\tEskillpudmana\t\tln12\t\t74\tStrSkillAssassinCobraStrikeCharge1\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"blade fury\t1\t4\t3\t1\t10\t\tSkillname267\tSkillld267\tSkillld267\tSkillan267\t24\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tEskillPerBlade\t\tusmc\t256\t75\tStrSkill4\t\tpnma\tpxma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill115\t\tpar3\t\t74\tWeapDamsk\t\t96*100/128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname267\t2\t\t76\tDamplev\tSkillname258\tpar8\t\t76\tDamplev\tSkillname278\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"fade\t2\t4\t1\t2\t30\t\tSkillname268\tSkillld268\tSkillld268\tSkillan268\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln56\t25\t74\tStrSkill54\t\tdm12\t\t74\tModStr2uPercent\t\tln78\t\t74\tStrSkill85\t\tdm34\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"shadow warrior\t2\t4\t2\t2\t38\t\tSkillname269\tSkillld269\tSkillld269\tSkillan269\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill21\t\t(lvl-1)*par3\t\t74\tStrSkillAttackRating\t\tlvl*par2\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"claws of thunder\t3\t4\t1\t3\t58\t\tSkillname270\tSkillld270\tSkillld270\tSkillan270\t20\t\t\tltng\tenma\texma\tltng\tenma+m2en\texma+m2ex\tltng\tenma+m2en+m3en\texma+m2ex+m3ex\t2\t\tclawsofthundernova\tclawsofthunderbolt\t75\tEskillthunder3\t\tm3en\tm3ex\t75\tEskillthunder2\t\tm2en\tm2ex\t75\tEskillthunder1\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname270\t2\t\t76\tLtngdplev\tSkillname281\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"dragon tail\t3\t4\t3\t3\t48\t\tSkillname271\tSkillld271\tSkillld271\tSkillan271\t16\t\t\t\t\t\t\t\t\t\t\t\t5\t\t\t\t74\tStrSkillFireDamagePercent\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRadiusSingular\tStrSkill18\tpar3*2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"lightning sentry\t1\t5\t1\t1\t12\t\tSkillname272\tSkillld272\tSkillld272\tSkillan272\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tESkillShoots\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname272\t2\t\t76\tLtngdplev\tSkillname257\tpar8\t\t76\tLtngdplev\tSkillname262\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"inferno sentry\t1\t5\t2\t1\t14\t\tSkillname273\tSkillld273\tSkillld273\tSkillan273\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tStrSkillFireDamageAveragePerSecond\t\tenms*12/256\texms*12/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillRangeSingular\tStrSkill56\t(ln34/2 + skill('Wake of Fire Sentry'.blvl)\t3\t74\tESkillShoots\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname273\t2\t\t77\tRangplev\tSkillname263\t0\t5\t76\tFiredplev\tSkillname252\tpar8\t\t76\tFiredplev\tSkillname263\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"mind blast\t2\t5\t3\t2\t34\t\tSkillname274\tSkillld274\tSkillld274\tSkillan274\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tStrSkill99\t\tdm56\t\t36\tStrSkillStunLengthSingular\tStrSkill48\t\"min(250,edln)\"\t25\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t75\tStrSkillDurationRange\t\tpar3/25\t(par3+par4)/25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"blades of ice\t3\t5\t1\t3\t52\t\tSkillname275\tSkillld275\tSkillld275\tSkillan275\t20\t\t\tcold\tenma\texma\tcold\tenma\texma\tcold\tenma\texma\t2\t\t\t\t36\tEskillbladesofice3\t\tedln\t25\t36\tEskillbladesofice2\t\tpar1*2\t3\t75\tEskillbladesofice1\t\tenma\texma\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname275\t2\t\t76\tColddplev\tSkillname281\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"dragon flight\t3\t5\t3\t3\t54\t\tSkillname276\tSkillld276\tSkillld276\tSkillan276\t15\t\t\t\t\t\t\t\t\t\t\t\t5\t\t\t\t74\tEskillkickdamage\t\tln12\t\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"death sentry\t1\t6\t1\t1\t16\t\tSkillname277\tSkillld277\tSkillld277\tSkillan277\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tskill('mon death sentry'.par3) + skill('mon death sentry'.par4) * (lvl - 1)\t3\t75\tStrSkill7\t\tenma\texma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tESkillShoots\t\tpar1 + skill('Fire Trauma'.blvl)/3\t\t75\tCorexpdam\t\tskill('mon death sentry'.par1)\tskill('mon death sentry'.par2)\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname277\t2\t\t77\tShotplev3\tSkillname252\t1\t3\t76\tLtngdplev\tSkillname272\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"blade shield\t1\t6\t3\t1\t18\t\tSkillname278\tSkillld278\tSkillld278\tSkillan278\t5\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t36\tStrSkill3\t\tusmc\t256\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t75\tStrSkill4\t\tpnma\tpxma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillRadiusSingular\tStrSkill18\tpar4*2\t3\t74\tWeapDamsk\t\t96*100/128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname278\t2\t\t76\tDamplev\tSkillname258\tpar8\t\t76\tDamplev\tSkillname267\tpar8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"venom\t2\t6\t1\t2\t28\t\tSkillname279\tSkillld279\tSkillld279\tSkillan279\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillDurationSingular\tStrSkill20\tln12\t25\t36\tStrSkillPoisonLengthSingular\tStrSkill63\tedln\t25\t75\tStrSkill8\t\tenms*edln/256\texms*edln/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"shadow master\t2\t6\t2\t2\t32\t\tSkillname280\tSkillld280\tSkillld280\tSkillan280\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t74\tStrSkill54\t\t((110*(lvl-1))/(lvl+5)*(par4-par3))/100+par3\t\t74\tStrSkillAttackRating\t\tlvl*par2\t\t13\tStrSkill42\t\t(lvl-1)*par1\t\t\t\t\t\t\t\t\t\t\t\t36\tStrSkillCastingDelaySingular\tStrSkillCastingDelayPlural\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"royal strike\t3\t6\t2\t3\t56\t\tSkillname281\tSkillld281\tSkillld281\tSkillan281\t18\t\t\tfire\tm1en\tm1ex\tltng\tm2en\tm2ex\tcold\tm3en\tm3ex\t1\troyalstrikemeteor\troyalstrikechainlightning\troyalstrikechaosice\t75\tEskillphoenix3\t\tm3en\tm3ex\t75\tEskillphoenix2\t\tm2en\tm2ex\t75\tStrSkillFireDamageAveragePerSecond\t\tmiss('royalstrikemeteorfire'.edns)*3*25*(mael+100)/100/256\tmiss('royalstrikemeteorfire'.edxs)*3*25*(mael+100)/100/256\t75\tEskillphoenix1\t\tm1en\tm1ex\t74\tStrSkill22\t\ttoht\t\t\t\t\t\t\t36\tStrSkill3\t\tusmc\t256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tSksyn\tSkillname281\t2\t\t76\tFiredplev\tSkillname260\t10\t\t76\tAFDImm\tSkillname260\t6\t\t76\tLtngdplev\tSkillname270\t13\t\t76\tColddplev\tSkillname275\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"delerium change\t0\t0\t0\t0\t2\t\tRuneword22\tRuneword22\tRuneword22\tRuneword22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"interact\t0\t0\t0\t0\t2\t\tSkillNameInteract\tSkillDescInteract\tSkillDescInteract\tSkillNameInteract\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"loot\t0\t0\t0\t0\t2\t\tSkillNameLoot\tSkillDescLoot\tSkillDescLoot\tSkillNameLoot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"townportal\t0\t0\t0\t0\t18\t\tskillname219\tskillld219\tskillld219\tskillan219\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"emotewheel\t0\t0\t0\t0\t2\t\tSkillNameEmoteWheel\tSkillDescEmoteWheel\tSkillDescEmoteWheel\tSkillNameEmoteWheel\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"swapweapons\t0\t0\t0\t0\t2\t\tSkillNameSwapWeapons\tSkillDescSwapWeapons\tSkillDescSwapWeapons\tSkillNameSwapWeapons\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"map\t0\t0\t0\t0\t2\t\tSkillNameMap\tSkillDescMap\tSkillDescMap\tSkillNameMap\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"showitems\t0\t0\t0\t0\t2\t\tSkillNameShowItems\tSkillDescShowItems\tSkillDescShowItems\tSkillNameShowItems\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"runtoggle\t0\t0\t0\t0\t2\t\tSkillNameRunToggle\tSkillDescRunToggle\tSkillDescRunToggle\tSkillNameRunToggle\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"cubeloot\t0\t0\t0\t0\t2\t\tSkillNameCubeLoot\tSkillDescCubeLoot\tSkillDescCubeLoot\tSkillNameCubeLoot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"mark of the bear\t0\t0\t0\t0\t2\t\tSkillnameMetamorphosisBear\tSkillnameMetamorphosisBear\tSkillnameMetamorphosisBear\tSkillnameMetamorphosisBear\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tModStr2uPercent\t\tpar2\t\t74\tModStr6l\t\tpar1\t\t12\tStrSkill0\t\tlen\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tSkillItemMetamorphosisBear\t3\t0\n",
+                u8"mark of the wolf\t0\t0\t0\t0\t2\t\tSkillnameMetamorphosisWolf\tSkillnameMetamorphosisWolf\tSkillnameMetamorphosisWolf\tSkillnameMetamorphosisWolf\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\tModStr2g\t\tpar2\t\t74\tModStr4c\t\tpar1\t\t12\tStrSkill0\t\tlen\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tSkillItemMetamorphosisWolf\t3\t0\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -18,395 +18,391 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetSkills()
+        EmbeddedText GetSkills()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"skill\t*Id\tcharclass\tskilldesc\tsrvstfunc\tsrvdofunc\tsrvstopfunc\tprgstack\tsrvprgfunc1\tsrvprgfunc2\tsrvprgfunc3\tprgcalc1\tprgcalc2\tprgcalc3\tprgdam\tsrvmissile\tdecquant\tlob\tsrvmissilea\tsrvmissileb\tsrvmissilec\tuseServerMissilesOnRemoteClients\tsrvoverlay\taurafilter\taurastate\tauratargetstate\tauralencalc\taurarangecalc\taurastat1\taurastatcalc1\taurastat2\taurastatcalc2\taurastat3\taurastatcalc3\taurastat4\taurastatcalc4\taurastat5\taurastatcalc5\taurastat6\taurastatcalc6\tauraevent1\tauraeventfunc1\tauraevent2\tauraeventfunc2\tauraevent3\tauraeventfunc3\tpassivestate\tpassiveitype\tpassivereqweaponcount\tpassivestat1\tpassivecalc1\tpassivestat2\tpassivecalc2\tpassivestat3\tpassivecalc3\tpassivestat4\tpassivecalc4\tpassivestat5\tpassivecalc5\tpassivestat6\tpassivecalc6\tpassivestat7\tpassivecalc7\tpassivestat8\tpassivecalc8\tpassivestat9\tpassivecalc9\tpassivestat10\tpassivecalc10\tpassivestat11\tpassivecalc11\tpassivestat12\tpassivecalc12\tpassivestat13\tpassivecalc13\tpassivestat14\tpassivecalc14\tsummon\tpettype\tpetmax\tsummode\tsumskill1\tsumsk1calc\tsumskill2\tsumsk2calc\tsumskill3\tsumsk3calc\tsumskill4\tsumsk4calc\tsumskill5\tsumsk5calc\tsumumod\tsumoverlay\tstsuccessonly\tstsound\tstsoundclass\tstsounddelay\tweaponsnd\tdosound\tdosound a\tdosound b\ttgtoverlay\ttgtsound\tprgoverlay\tprgsound\tcastoverlay\tcltoverlaya\tcltoverlayb\tcltstfunc\tcltdofunc\tcltstopfunc\tcltprgfunc1\tcltprgfunc2\tcltprgfunc3\tcltmissile\tcltmissilea\tcltmissileb\tcltmissilec\tcltmissiled\tcltcalc1\t*cltcalc1 desc\tcltcalc2\t*cltcalc2 desc\tcltcalc3\t*cltcalc3 desc\twarp\timmediate\tenhanceable\tattackrank\tnoammo\trange\tweapsel\titypea1\titypea2\titypea3\tetypea1\tetypea2\titypeb1\titypeb2\titypeb3\tetypeb1\tetypeb2\tanim\tseqtrans\tmonanim\tseqnum\tseqinput\tdurability\tUseAttackRate\tLineOfSight\tTargetableOnly\tSearchEnemyXY\tSearchEnemyNear\tSearchOpenXY\tSelectProc\tTargetCorpse\tTargetPet\tTargetAlly\tTargetItem\tAttackNoMana\tTgtPlaceCheck\tKeepCursorStateOnKill\tContinueCastUnselected\tClearSelectedOnHold\tItemEffect\tItemCltEffect\tItemTgtDo\tItemTarget\tItemUseRestrict\tItemCheckStart\tItemCltCheckStart\tItemCastSound\tItemCastOverlay\tskpoints\treqlevel\tmaxlvl\treqstr\treqdex\treqint\treqvit\treqskill1\treqskill2\treqskill3\trestrict\tState1\tState2\tState3\tlocaldelay\tglobaldelay\tleftskill\trightskill\trepeat\talwayshit\tusemanaondo\tstartmana\tminmana\tmanashift\tmana\tlvlmana\tinterrupt\tInTown\taura\tperiodic\tperdelay\tfinishing\tprgchargestocast\tprgchargesconsumed\tpassive\tprogressive\tscroll\tcalc1\t*calc1 desc\tcalc2\t*calc2 desc\tcalc3\t*calc3 desc\tcalc4\t*calc4 desc\tcalc5\t*calc5 desc\tcalc6\t*calc6 desc\tParam1\t*Param1 Description\tParam2\t*Param2 Description\tParam3\t*Param3 Description\tParam4\t*Param4 Description\tParam5\t*Param5 Description\tParam6\t*Param6 Description\tParam7\t*Param7 Description\tParam8\t*Param8 Description\tParam9\t*Param9 Description\tParam10\t*Param10 Description2\tParam11\t*Param11 Description\tParam12\t*Param12 Description\tInGame\tToHit\tLevToHit\tToHitCalc\tResultFlags\tHitFlags\tHitClass\tKick\tHitShift\tSrcDam\tMinDam\tMinLevDam1\tMinLevDam2\tMinLevDam3\tMinLevDam4\tMinLevDam5\tMaxDam\tMaxLevDam1\tMaxLevDam2\tMaxLevDam3\tMaxLevDam4\tMaxLevDam5\tDmgSymPerCalc\tEType\tEMin\tEMinLev1\tEMinLev2\tEMinLev3\tEMinLev4\tEMinLev5\tEMax\tEMaxLev1\tEMaxLev2\tEMaxLev3\tEMaxLev4\tEMaxLev5\tEDmgSymPerCalc\tELen\tELevLen1\tELevLen2\tELevLen3\tELenSymPerCalc\taitype\taibonus\tcost mult\tcost add\t*eol\n";
-                ss << u8"Attack\t0\t\tattack\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tboth\t\tweap\t\t\ttpot\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t1\t1\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t1\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Kick\t1\t\tkick\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\th2h\t4\t\t\t\t\t\t\t\t\t\t\tKK\tKK\txx\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Throw\t2\t\tthrow\t65\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\trng\t\tthro\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Unsummon\t3\t\tunsummon\t3\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_unsummon\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Left Hand Throw\t4\t\tleft hand throw\t65\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\trng\t1\tthro\t\t\t\t\t\t\t\t\t\tS4\tS4\txx\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Left Hand Swing\t5\t\tleft hand swing\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tboth\t1\tweap\t\t\ttpot\t\t\t\t\t\t\tS3\tS3\tS3\t\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t1\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Magic Arrow\t6\tama\tmagic arrow\t\t\t\t\t\t\t\t\t\t\t\tmagicarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmagicarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t1\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t5\t12\t-1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t9\t\t\t\t\t\t8\t128\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Fire Arrow\t7\tama\tfire arrow\t4\t\t\t\t\t\t\t\t\t\t\tfirearrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tfirearrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t5\t24\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t10\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t1\t2\t3\t6\t12\t24\t4\t2\t3\t7\t14\t27\t(skill('Exploding Arrow'.blvl)) * par8\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Inner Sight\t8\tama\tinner sight\t\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34179\t\tinnersight\tln34\tln56\tarmorclass\t-edmn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_eyeofzeus\t\t\t\t\t\t\t\t\t\t\tcast_innersight\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tamazon_eyeofzeus\tcast_innersight\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t7\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tArmor Reduction baseline\t25\tArmor Reduction per level\t200\tDuration baseline\t100\tDuration per level\t27\tRadius baseline\t0\tRadius per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\t25\t45\t60\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Critical Strike\t9\tama\tcritical strike\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcriticalstrike\t\t\tpassive_critical_strike\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\trng\t\tspea\tmiss\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tMin % Chance\t80\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Jab\t10\tama\tjab\t5\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_jab_1\t\t\t\tweapon_1ht_1\tweapon_2ht_1\t\t\t\t\t\t\t\t12\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t1\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t8\t1\t\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t-15\tDamage % baseline\t3\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Cold Arrow\t11\tama\tcold arrow\t4\t\t\t\t\t\t\t\t\t\t\tcoldarrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tcoldarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t5\t28\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t10\t9\t\t\t\t\t\t7\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t6\t4\t5\t8\t16\t42\t8\t4\t5\t9\t17\t44\t(skill('Ice Arrow'.blvl)) * par8\t100\t30\t30\t30\t\t\t\t384\t3000\t0\n";
-                ss << u8"Multiple Shot\t12\tama\tmultiple shot\t4\t8\t\t\t\t\t\t\t\t\t\t\t1\t\tmultipleshotarrow\tmultipleshotbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t17\t\t\t\t\t\tmultipleshotarrow\tmultipleshotbolt\t\t\t\t\t\t\t\t\t\t\t1\t7\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tMagic Arrow\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t1\t1\t\t\t\t\t\t\t\t\t\t\t\"min(ln12,24)\"\t# of Missiles created\tpar3\tMissile Activation Frame\t2\t# of missiles that can trigger item modifier events\t\t\tskill('Guided Arrow'.blvl) * par4\t% Damage Synergy\t\t\t2\t# of Missiles created baseline\t1\t# of Missiles created per level\t1\tMissile Activation Frame\t12\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t96\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Dodge\t13\tama\tdodge\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdodge\t\t\tpassive_dodge\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_dodge_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tMin % Chance\t65\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t2\tAnim Mode (0 = enable uninterruptable Anim | 1 = disable Anim | 2 = enable interruptable anim)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Power Strike\t14\tama\tpower strike\t6\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tJab\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t8\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t12\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t16\t18\t36\t54\t72\t90\t(skill('Lightning Strike'.blvl)+skill('Lightning Bolt'.blvl)+skill('Charged Strike'.blvl)) * par8\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Poison Javelin\t15\tama\tpoison javelin\t4\t\t\t\t\t\t\t\t\t\t\tpoisonjav\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_cast_poison\t\t1\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tpoisonjav\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\trng\t\tjave\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t15\t\t1\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t0\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t32\t16\t32\t48\t64\t96\t48\t16\t36\t52\t68\t100\t(skill('Plague Javelin'.blvl)) * par8\t200\t50\t50\t50\t\t\t\t384\t3000\t0\n";
-                ss << u8"Exploding Arrow\t16\tama\texploding arrow\t4\t\t\t\t\t\t\t\t\t\t\texplodingarrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\texplodingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tFire Arrow\tMultiple Shot\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t5\t6\t12\t14\t16\t20\t13\t7\t13\t15\t18\t23\t(skill('Fire Arrow'.blvl)) * par8\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Slow Missiles\t17\tama\tslow missiles\t\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t50563\t\tslowmissiles\tln34\tln56\tskill_handofathena\t100-dm12\tskill_missile_damage_scale\t100-dm78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_handofathena\t\t\t\t\t\t\t\t\t\t\tcast_slowmissiles\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tamazon_handofathena\tcast_slowmissiles\t\t12\t20\t\t\t\t\tInner Sight\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t7\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t% Velocity of missiles Min\t75\t% Velocity of missiles Max\t300\tDuration baseline\t150\tDuration per level\t27\tRadius baseline\t0\tRadius per level\t0\tMissile Damage Reduction Min\t40\tMissile Damage Reduction Max\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Avoid\t18\tama\tavoid\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tavoid\t\t\tpassive_avoid\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_dodge_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tDodge\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tMin % Chance\t75\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t2\tAnim Mode (0 = enable uninterruptable Anim | 1 = disable Anim | 2 = enable interruptable anim)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Impale\t19\tama\timpale\t7\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\timpale\t300\t\tvelocitypercent\t-dm78\tattackrate\t-dm78\tother_animrate\t-dm78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_impale_1\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t55\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t8\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tJab\t\t\t\t\t\t\t\t\t1\t1\t\t1\t\t\t1\t8\t3\t0\t\t\t\t\t\t\t\t\t\t\t\tln12\tDamage %\tpar6-dm34\tDurability loss chance %\tpar5\tDurability loss amount\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t300\tDamage % baseline\t25\tDamage % per level\t0\t% chance reduction for Durability loss Min\t30\t% chance reduction for Durability loss Max\t1\tDurability loss amount\t50\t% chance for Durability loss Base\t0\tSlow % Min\t75\tSlow % Max\t30\tAttack Speed %\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Lightning Bolt\t20\tama\tlightning bolt\t4\t\t\t\t\t\t\t\t\t\t\tlightningjavelin\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tlightningjavelin\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\trng\t\tjave\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tPoison Javelin\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t96\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t40\t12\t18\t28\t48\t88\t(skill('Lightning Strike'.blvl)+skill('Power Strike'.blvl)+skill('Charged Strike'.blvl)+skill('Lightning Fury'.blvl)) * par8\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Ice Arrow\t21\tama\tice arrow\t4\t\t\t\t\t\t\t\t\t\t\ticearrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\ticearrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCold Arrow\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tFreeze Length synergy\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t6\t6\t12\t18\t26\t36\t10\t6\t13\t19\t27\t38\t(skill('Cold Arrow'.blvl))*par8\t50\t5\t5\t5\t(skill('Freezing Arrow'.blvl)) * par7\t\t\t640\t16000\t0\n";
-                ss << u8"Guided Arrow\t22\tama\tguided arrow\t4\t10\t\t\t\t\t\t\t\t\t\t\t1\t\tguidedarrow\tguidedarrow\tguidedarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t18\t\t\t\t\t\tguidedarrow\tguidedarrow\tguidedarrow\t\t\t\t\t\t\t\t\t\t1\t4\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCold Arrow\tMultiple Shot\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t32\t-1\t1\t\t\t\t\t\t\t\t\t\t\tln34 + (skill('Multiple Shot'.blvl)*par8)\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tDamage % baseline\t7\tDamage % per level\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Penetrate\t23\tama\tpenetrate\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpenetrate\t\t\titem_tohit_percent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\trng\t\tspea\tmiss\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCritical Strike\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t35\t% Chance baseline\t10\t% Chance per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Charged Strike\t24\tama\tcharged strike\t6\t11\t\t\t\t\t\t\t\t\t\t\t\t\tchargedstrikebolt\tchargedstrikebolt\tchargedstrikebolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t19\t\t\t\t\t\tchargedstrikebolt\tchargedstrikebolt\tchargedstrikebolt\t\t\t\t\t\t\t\t\t\t1\t5\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tPower Strike\tLightning Bolt\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1+lvl/par2\t# of Bolt Missiles created\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t3\t# of Charged Bolt Missiles created baseline\t5\tCharged Bolt Missile created per N levels\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t30\t12\t16\t20\t24\t28\t(skill('Lightning Strike'.blvl)+skill('Lightning Bolt'.blvl)+skill('Power Strike'.blvl)) * par8\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Plague Javelin\t25\tama\tplague javelin\t4\t\t\t\t\t\t\t\t\t\t\tplaguejavelin\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_cast_poison\t\t1\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tplaguejavelin\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\trng\t\tjave\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tLightning Bolt\t\t\t\t\t\t\t25\t\t1\t1\t\t\t1\t\t1\t7\t14\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t30\t9\t\t\t\t\t\t3\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t12\t8\t16\t26\t55\t80\t18\t8\t16\t26\t55\t80\t(skill('Poison Javelin'.blvl))*par8\t75\t5\t5\t5\t\t\t\t640\t16000\t0\n";
-                ss << u8"Strafe\t26\tama\tstrafe\t8\t12\t\t\t\t\t\t\t\t\t\t\t\t\tstrafearrow\tstrafebolt\t\t\t\t\t\t\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_dodge_1\t\t\t\t\tpaladin_charge\t\t\t\t\t\t\t\t\t13\t20\t\t\t\t\t\tmultipleshotarrow\tmultipleshotbolt\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tGuided Arrow\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t11\t0\t\t\t\t\t\t\t\t\t\t\t\t\"min(par3 + lvl - 1, par4)\"\tMinimum # of Missiles created\tln12 + (skill('Guided Arrow'.blvl)*par8) + (skill('Multiple Shot'.blvl)*par9)\tDamage %\t2+lvl/4\tMaximum # of Missiles created\t\t\t\t\t\t\t5\tDamage % baseline\t5\tDamage % per level\t4\t# of shots fired Min (+1 per level)\t10\t# of shots fired Max\t35\tRadius\t50\t% Anim frame rollback\t\t\t10\tDamage synergy\t5\tDamage Synergy\t\t\t\t\t\t\t1\t30\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Immolation Arrow\t27\tama\timmolation arrow\t4\t\t\t\t\t\t\t\t\t\t\timmolationarrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\timmolationarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tExploding Arrow\t\t\t\t\t\t\t15\t\t1\t1\t\t\t\t\t1\t6\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tRadius of Disc of Missiles\tpar2\tExplosion Damage Radius\t\t\t\t\t\t\t\t\t3\tRadius of Disc of Missiles\t4\tExplosion Damage Radius\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t30\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t12\t12\t23\t34\t36\t38\t23\t12\t23\t34\t36\t38\t(skill('Exploding Arrow'.blvl)) * par8\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Dopplezon\t28\tama\tdopplezon\t\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdopplezon\t\t\t\tfireresist\t\"min(lvl*par7,85)\"\tlightresist\t\"min(lvl*par7,85)\"\tcoldresist\t\"min(lvl*par7,85)\"\tpoisonresist\t\"min(lvl*par7,85)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdopplezon\tdopplezon\t1\tNU\t\t\t\t\t\t\t\t\t\t\t\tdopllezon_appear\t\tamazon_valkyrie_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tSlow Missiles\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t6\t76\t-3\t1\t\t\t\t\t\t\t\t\t\t\tlvl*par4\tHP %\tln12\tDuration\tpar3\tHP % derived from caster\t\t\t\t\t\t\t250\tDuration baseline\t125\tDuration per level\t50\tHP % derived from caster\t10\tHP % bonus per level\t\t\t\t\t4\tResistance % bonus per level\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Evade\t29\tama\tevade\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tevade\t\t\tpassive_evade\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tblock_arrow_1\tamazon_dodge_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tAvoid\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tMin % Chance\t65\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Fend\t30\tama\tfend\t9\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_jab_1\t1\t\t\t\t\t\t\t\t\t\t\t\t14\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t9\t\t1\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tImpale\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t12\t# of max targets\tln34\tDamage %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t1\t# of max targets per level\t30\t% Anim frame rollback\t70\tDamage % baseline\t10\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t40\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Freezing Arrow\t31\tama\tfreezing arrow\t4\t\t\t\t\t\t\t\t\t\t\tfreezingarrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tfreezingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tIce Arrow\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t36\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage Radius\t\t\t\t\t\t\t\t\t\t\t5\tRadius of impact\t\t\t\t\t\t\t\t\t\t\t5\tFreeze Length synergy\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t40\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t40\t10\t15\t20\t22\t24\t50\t10\t15\t20\t22\t24\t(skill('Cold Arrow'.blvl))*par8\t50\t\t\t\t(skill('Ice Arrow'.blvl)) * par7\t\t\t896\t64000\t0\n";
-                ss << u8"Valkyrie\t32\tama\tvalkyrie\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tstrength\tlvl * par2\tdexterity\tlvl * par4\tfireresist\t\"min((lvl+skill('Dopplezon'.blvl))*par7,85)\"\tlightresist\t\"min((lvl+skill('Dopplezon'.blvl))*par7,85)\"\tcoldresist\t\"min((lvl+skill('Dopplezon'.blvl))*par7,85)\"\tpoisonresist\t\"min((lvl+skill('Dopplezon'.blvl))*par7,85)\"\t\t\t\t\t\t\t\t\t\titem_armor_percent\tpar3 * (lvl - 1)\ttohit\ttoht\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvalkyrie\tvalkyrie\t1\tNU\tdodge\tskill('Dodge'.blvl)\tavoid\tskill('Avoid'.blvl)\tEvade\tskill('Evade'.blvl)\tCritical Strike\tskill('Critical Strike'.blvl)\t\t\t\t\t\tamazon_valkyrie_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tDopplezon\tEvade\t\t\t\t\t\t15\t\t0\t1\t\t\t\t\t1\t8\t25\t1\t1\t1\t\t\t\t\t\t\t\t\t\tpar1 * (lvl - 1) + skill('Dopplezon'.blvl) * par8\tHP %\tln56\tValkyrie Item Level\t\t\t\t\t\t\t\t\t20\tHP % per level\t25\tStrength per level\t10\tArmor % per level\t12\tDexterity per level\t25\tValkyrie Item Level baseline\t3\tValkyrie Item Level per level\t2\tResistance % per level\t20\tHP % synergy\t\t\t\t\t\t\t\t\t1\t\t\t40*lvl+40*skill('Penetrate'.blvl)\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Pierce\t33\tama\tpierce\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpierce\t\t\tskill_pierce\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tPenetrate\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tMin % Chance\t100\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Lightning Strike\t34\tama\tlightning strike\t10\t14\t\t\t\t\t\t\t\t\t\t\t\t\tlightningstrike\tlightningstrike\tlightningstrike\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t  \t\t\t\t\t\tlightningstrike\tlightningstrike\tlightningstrike\t\t\t\t\t\t\t\t\t\t1\t8\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tCharged Strike\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t9\t0\t1\t\t\t\t\t\t\t\t\t\t\t20\tRange of Bolt Missiles\tln34\t# of target jump hits\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t20\tRadius of jump to next target\t\t\t2\t# of target jump hits baseline\t1\t# of target jump hits per level\t\t\t\t\t\t\t11\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t25\t10\t15\t20\t25\t30\t(skill('Charged Strike'.blvl)+skill('Lightning Bolt'.blvl)+skill('Power Strike'.blvl)) * par8\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Lightning Fury\t35\tama\tlightning fury\t4\t\t\t\t\t\t\t\t\t\t\tlightningfury\t1\t\t\t\t\t\t\t42371\t\t\t\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tlightningfury\t\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\trng\t\tjave\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tPlague Javelin\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12\t# of furylightning Missiles created\t\t\t\t\t\t\t\t\t\t\t2\t# of Lightning Missiles created baseline\t1\t# of Lightning Missiles created per level\t15\tTarget Search Radius\t\t\t\t\t\t\t\t\t1\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t40\t20\t30\t40\t50\t50\t(skill('Charged Strike'.blvl)+skill('Lightning Bolt'.blvl)+skill('Power Strike'.blvl)+skill('Lightning Strike'.blvl)) * par8\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Fire Bolt\t36\tsor\tfire bolt\t\t\t\t\t\t\t\t\t\t\t\tfirebolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_1\t\t\t\t\t\t\t\t\tfirebolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t5\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t6\t3\t4\t8\t18\t54\t12\t3\t6\t10\t20\t56\t(skill('Fire Ball'.blvl)+skill('Meteor'.blvl))*par8\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Warmth\t37\tsor\twarmth\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twarmth\t\t\tmanarecoverybonus\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tMana Recovery % baseline\t12\tMana Recovery % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Charged Bolt\t38\tsor\tcharged bolt\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\tchargedbolt\tchargedbolt\tchargedbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t23\t\t\t\t\t\tchargedbolt\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t5\t24\t4\t1\t\t\t\t\t\t\t\t\t\t\t\"min(24,ln12)\"\t# of Bolt Missiles created\t\t\t\t\t\t\t\t\t\t\t3\t# of Bolt Missiles created baseline\t1\t# of Bolt Missiles created per level\t\t\t\t\t\t\t\t\t\t\t6\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t4\t1\t1\t2\t3\t4\t8\t1\t1\t2\t3\t4\t(skill('Lightning'.blvl))*par8\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Ice Bolt\t39\tsor\tice bolt\t\t\t\t\t\t\t\t\t\t\t\ticebolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_1\t\t\t\t\t\t\t\t\ticebolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t6\t2\t4\t6\t8\t10\t10\t3\t5\t7\t9\t11\t(skill('Frost Nova'.blvl)+skill('Ice Blast'.blvl)+skill('Glacial Spike'.blvl)+skill('Blizzard'.blvl)+skill('Frozen Orb'.blvl))*par8\t150\t35\t35\t35\t\t\t\t256\t1000\t0\n";
-                ss << u8"Frozen Armor\t40\tsor\tfrozen armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfrozenarmor\t\tln34+(skill('Shiver Armor'.blvl)+skill('Chilling Armor'.blvl))*par7\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\tsorceress_frozenarmor\t\t\t\t\t\t\tice_cast_1\tfrozenarmor_hit\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\tice_cast_1\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t1\t\t\t\t\t\t\t\t\t\tln56*(100+((skill('Shiver Armor'.blvl)+skill('Chilling Armor'.blvl))*par8))/100\tFreeze Length\t\t\t\t\t\t\t\t\t\t\t30\tArmor % baseline\t5\tArmor % per level\t3600\tBuff Duration\t300\tBuff Duration per level\t30\tFreeze Length baseline\t3\tFreeze Length per level\t250\tBuff Duration synergy\t5\tFreeze Length synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t256\t1000\t0\n";
-                ss << u8"Inferno\t41\tsor\tinferno\t11\t19\t\t\t\t\t\t\t\t\t\t\t\t\tinfernoflame1\tinfernoflame1\tinfernoflame1\t\t\t\t\t\t\tln12/4-2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\t24\t\t\t\t\t\tinfernoflame1\tinfernoflame2\t\t\t\t\t\t\t\t\t\t\t1\t7\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\t\t6\t0\t2\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12/2\tRange (Duration of Missile) (Min=1)\t20\tDuration to channel if caster is a Monster (Min=1)\t\t\t\t\t\t\t\t\t35\tRange baseline (Duration of missile)\t3\tRange per level (Duration of missile)\t4\tMin Mana required to start casting\t\t\t\t\t\t\t\t\t16\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t36\t24\t30\t34\t38\t42\t72\t25\t31\t35\t39\t43\t(skill('Warmth'.blvl))*par8\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Static Field\t42\tsor\tstatic field\t\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34691\t\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t9\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar4\tHP % Damage\tpar3\tMinimum Damage value\t\t\t\t\t\t\t\t\t5\tRadius baseline\t1\tRadius per level\t0\tMinimum Damage value\t25\tHP % Damage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Telekinesis\t43\tsor\ttelekinesis\t12\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\tsorceress_telekinesis\t\t\t\t\t\t\tlight_cast_2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\tsorceress_telekinesis\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t1\t\t\t\t\t\t\t\t\t\tpar2\t% chance to knockback/stun\t\t\t\t\t\t\t\t\t\t\t25\tCast Range\t35\t% chance to knockback/stun\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t5\t2\t109\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t1\t1\t1\t1\t1\t2\t1\t1\t1\t1\t1\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Frost Nova\t44\tsor\tfrost nova\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tfrostnova\tfrostnova\tfrostnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_2\t\t\t\t25\t\t\t\t\t\tfrostnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t36\t10\t\t\t\t\t\tsorceress_cast_cold\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t9\t1\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t4\t6\t8\t10\t12\t14\t8\t7\t9\t11\t13\t15\t(skill('Blizzard'.blvl)+skill('Frozen Orb'.blvl))*par8\t200\t25\t25\t25\t\t\t\t384\t3000\t0\n";
-                ss << u8"Ice Blast\t45\tsor\tice blast\t\t\t\t\t\t\t\t\t\t\t\ticeblast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_1\t\t\t\t\t\t\t\t\ticeblast\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t6\t20\t\t\t\t\tIce Bolt\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t12\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tFreeze Length baseline\t5\tFreeze Length per level\t\t\t\t\t\t\t\t\t10\tFreeze Length synergy\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t16\t14\t28\t42\t56\t70\t24\t15\t29\t43\t57\t71\t(skill('Ice Bolt'.blvl)+skill('Blizzard'.blvl)+skill('Frozen Orb'.blvl))*par8\t75\t5\t5\t5\t(skill('Glacial Spike'.blvl))*par7\t\t\t384\t3000\t0\n";
-                ss << u8"Blaze\t46\tsor\tblaze\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\tblaze\tblaze\tblaze\t\t\t\tblaze\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvelocitypercent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t\t\t\t\t\tblaze\tfirewall\tfiresmall\tfiremedium\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tInferno\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t7\t22\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t50\tBuff Duration Min\t500\tBuff Duration Max\t2\tVelocity % baseline\t2\tVelocity % per level\t\t\t\t\t\t\t6\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t4\t3\t5\t7\t9\t11\t8\t3\t6\t8\t10\t12\tskill('Warmth'.blvl)*par8\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Fire Ball\t47\tsor\tfire ball\t\t\t\t\t\t\t\t\t\t\t\tfireball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t\t\t\t\t\tfireball\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t12\t20\t\t\t\t\tFire Bolt\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t10\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t4\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t12\t13\t23\t28\t33\t38\t28\t15\t25\t30\t35\t40\t(skill('Fire Bolt'.blvl)+skill('Meteor'.blvl))*par8\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Nova\t48\tsor\tnova\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tnova\tnova\tnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t25\t\t\t\t\t\tnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t36\t10\t\t\t\t\t\tsorceress_cast_lightning\t\t\t12\t20\t\t\t\t\tStatic Field\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t1\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t6\t7\t8\t9\t10\t20\t8\t9\t10\t11\t12\t(skill('Static Field'.blvl))*par8\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Lightning\t49\tsor\tlightning\t\t\t\t\t\t\t\t\t\t\t\tlightningbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t\t\t\t\t\tlightningbolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSC\txx\t12\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t12\t20\t\t\t\t\tCharged Bolt\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t40\t8\t12\t20\t28\t36\t(skill('Charged Bolt'.blvl)+skill('Chain Lightning'.blvl)+skill('Nova'.blvl))*par8\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Shiver Armor\t50\tsor\tshiver armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tshiverarmor\t\tln34+(skill('Frozen Armor'.blvl)+skill('Chilling Armor'.blvl))*par7\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\tattackedinmelee\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\tsorceress_shiverarmor\t\t\t\t\t\t\tice_cast_2\tshiverarmor_hit\t\t\t\t\t\t\t\t\tsparkle\t\t\t\t10\tSparkle Missile Delay\t5\tSparkle Missile Radius\t3\tSparkle Missile Height\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\tice_cast_3\t\t12\t20\t\t\t\t\tIce Blast\tFrozen Armor\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t11\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t45\tArmor % baseline\t6\tArmor % per level\t3600\tBuff Duration\t300\tBuff Duration per level\t\t\t\t\t250\tBuff Duration synergy\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t12\t6\t8\t10\t12\t14\t16\t7\t9\t11\t13\t15\t(skill('Frozen Armor'.blvl)+skill('Chilling Armor'.blvl))*par8\t100\t\t25\t50\t\t\t\t512\t8000\t0\n";
-                ss << u8"Fire Wall\t51\tsor\tfire wall\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\tfirewallmaker\tfirewall\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t26\t\t\t\t\t\tfirewallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t4\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t18\t20\t\t\t\t\tBlaze\t\t\t\t\t\t\t35\t\t0\t1\t\t\t\t\t1\t8\t22\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t0\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t1\tDamage synergy\t4\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t15\t9\t14\t21\t21\t21\t20\t9\t14\t21\t21\t21\t(skill('Warmth'.blvl)*par8+skill('Inferno'.blvl)*par7\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Enchant\t52\tsor\tenchant\t\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tenchant\t\tln12\t\tfiremindam\tenma\tfiremaxdam\texma\titem_tohit_percent\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_enchant\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t1\t\t\t1\t\t\t\tsorceress_enchant\t\t\t18\t20\t\t\t\t\tWarmth\tFire Ball\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t25\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3600\tBuff Duration baseline\t600\tBuff Duration per level\t33\t% Damage for Ranged Weapons\t\t\t\t\t\t\t\t\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t9\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t16\t3\t7\t11\t15\t19\t20\t5\t9\t13\t17\t21\t(skill('Warmth'.blvl))*par8\t\t\t\t\t\t1\t\t640\t16000\t0\n";
-                ss << u8"Chain Lightning\t53\tsor\tchain lightning\t\t26\t\t\t\t\t\t\t\t\t\t\t\t\tchainlightning\tchainlightning\tchainlightning\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t27\t\t\t\t\t\tchainlightning\tchainlightning\tchainlightning\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSC\tSC\t12\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t151\t96\t\t\t\t\t\tsorceress_cast_lightning\t\t\t18\t20\t\t\t\t\tLightning\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t9\t1\t1\t\t\t\t\t\t\t\t\t\t\tln34/par5\t# of target jump hits\t\t\t\t\t\t\t\t\t\t\t20\tRadius of jump to next target\t\t\t26\t# of target jump hits baseline\t1\t# of target jump hits per level\t5\t\"Every # levels, increase target jump\"\t\t\t\t\t4\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t40\t11\t13\t15\t15\t15\t(skill('Charged Bolt'.blvl)+skill('Lightning'.blvl)+skill('Nova'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Teleport\t54\tsor\tteleport\t\t27\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_teleport\t\t\t\t\t\t\t\t\t\t\tteleport\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t1\t2\t\t\t\tsorceress_teleport\tteleport\t\t18\t20\t\t\t\t\tTelekinesis\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t24\t-1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Glacial Spike\t55\tsor\tglacial spike\t\t\t\t\t\t\t\t\t\t\t\tglacialspike\t\t\t\t\t\t\t\t\t\t\tln34 * (100 + skill('Blizzard'.blvl) * par7) / 100\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_2\t\t\t\t\t\t\t\t\tglacialspike\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t18\t20\t\t\t\t\tIce Blast\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tExplosion Radius baseline\t0\tExplosion Radius per level\t50\tFreeze Length baseline\t3\tFreeze Length per level\t\t\t\t\t3\tFreeze Length synergy\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t32\t14\t26\t28\t30\t32\t48\t15\t27\t29\t31\t33\t(skill('Ice Bolt'.blvl)+skill('Ice Blast'.blvl)+skill('Frozen Orb'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Meteor\t56\tsor\tmeteor\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tmeteorcenter\tmeteorcenter\tmeteorcenter\t\t\t\t\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\tsorceress_meteor\t\t\t\t\t\t\tfire_cast_2\t\t\t\t28\t\t\t\t\t\tmeteorcenter\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\tfire_cast_2\t\t24\t20\t\t\t\t\tFire Ball\tFire Wall\t\t\t\t\t\t30\t\t0\t1\t\t\t\t\t1\t7\t34\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t6\tExplosion Radius baseline\t0\tExplosion Radius per level\t30\tDuration of ground fire baseline\t15\tDuration of ground fire per level\t\t\t\t\t\t\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t80\t23\t39\t79\t81\t83\t100\t25\t41\t81\t83\t85\t(skill('Fire Bolt'.blvl)+skill('Fire Ball'.blvl))*par8\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Thunder Storm\t57\tsor\tthunder storm\t13\t29\t\t\t\t\t\t\t\t\t\t\t\t\tthunderstorm1\t\t\t\t\t\tthunderstorm\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_thunder_cast\t\t\t\t\t\t\t\t\tlightning\t\tlight_cast_2\t\t\t\t\t\t84\t\t\t\tthunderstorm1\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tNova\tChain Lightning\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t19\t0\t1\t\t\t1\t(100-dm56) * par4/100 + par3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3600\tBuff Duration baseline\t600\tBuff Duration per level\t25\tPeriodic Damage Rate Min\t100\tPeriodic Damage Rate Multiplier\t0\tMin % reduction of periodic damage rate\t100\tMax % reduction of periodic damage rate\t17\tRadius\t7\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t10\t10\t11\t11\t11\t100\t10\t10\t11\t11\t11\t(skill('Static Field'.blvl))*par8\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Energy Shield\t58\tsor\tenergy shield\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tenergyshield\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\tabsorbdamage\t24\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\tsorceress_energyshield\t\t\t\t\tenergyshieldhit0\t\tlight_cast_2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tTeleport\tChain Lightning\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t5\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\"min(edmn,95)\"\tDamage % Absorption\tpar5-skill('Telekinesis'.blvl)\tMana consumed per HP damage (in sixteenths)\t\t\t\t\t\t\t\t\t3600\tBuff Duration baseline\t600\tBuff Duration per level\t\t\t\t\t32\tMana consumed per HP damage (in sixteenths)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\t5\t2\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Blizzard\t59\tsor\tblizzard\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tblizzardcenter\tblizzardcenter\tblizzardcenter\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_3\t\t\t\t28\t\t\t\t\t\tblizzardcenter\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\tice_cast_3\t\t24\t20\t\t\t\t\tFrost Nova\tGlacial Spike\t\t\t\t\t\t45\t\t0\t1\t\t\t\t\t1\t8\t23\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tRadius for Area of Effect\tpar3\tMissile Spawn Rate\t\t\t\t\t\t\t\t\t7\tRadius for Area of Effect\t\t\t4\tMissile Spawn Rate\t\t\t\t\t\t\t\t\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t45\t15\t30\t45\t55\t65\t75\t16\t31\t46\t56\t66\t(skill('Ice Bolt'.blvl)+skill('Ice Blast'.blvl)+skill('Glacial Spike'.blvl))*par8\t100\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Chilling Armor\t60\tsor\tchilling armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\tchillingarmorbolt\t\t\t\t\t\tchillingarmor\t\tln34+(skill('Frozen Armor'.blvl)+skill('Shiver Armor'.blvl))*par7\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\thitbymissile\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\tsorceress_shiverarmor\t\t\t\t\t\t\tice_cast_3\tchillarmor_hit\t\t\t\t\t\t\t\t\tchillingarmorbolt\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t24\t20\t\t\t\t\tShiver Armor\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t17\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t60\tArmor % baseline\t9\tArmor % per level\t3600\tBuff Duration\t300\tBuff Duration per level\t\t\t\t\t250\tBuff Duration synergy\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t16\t8\t10\t12\t14\t16\t20\t9\t11\t13\t15\t17\t(skill('Frozen Armor'.blvl)+skill('Shiver Armor'.blvl))*par8\t100\t\t25\t50\t\t1\t\t768\t32000\t0\n";
-                ss << u8"Fire Mastery\t61\tsor\tfire mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfiremastery\t\t\tpassive_fire_mastery\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tDamage % baseline\t7\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Hydra\t62\tsor\thydra\t14\t144\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\thydra1\thydra\tpar3\tS2\tHydraMissile\tlvl\tFire Bolt\tskill('Fire Bolt'.blvl)\tFire Ball\tskill('Fire Ball'.blvl)\t\t\t\t\t\t\t1\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t1\t\tsorceress_cast_fire\tfire_cast_2\t\t30\t20\t\t\t\t\tEnchant\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t7\t40\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12\tDuration\t\t\t\t\t\t\t\t\t\t\t250\tDuration baseline\t0\tDuration per level\t18\t# of max Hydras (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t3\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t28\t11\t15\t19\t23\t27\t39\t13\t17\t21\t25\t29\t(skill('Fire Bolt'.blvl) + skill('Fire Ball'.blvl))*par8\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Lightning Mastery\t63\tsor\tlightning mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightningmastery\t\t\tpassive_ltng_mastery\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t50\tDamage % baseline\t12\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Frozen Orb\t64\tsor\tfrozen orb\t\t\t\t\t\t\t\t\t\t\t\tfrozenorb\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_3\t\t\t\t29\t\t\t\t\t\tfrozenorb\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t30\t20\t\t\t\t\tBlizzard\t\t\t\t\t\t\t25\t\t1\t1\t\t\t\t\t1\t7\t50\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t80\t20\t24\t28\t29\t30\t90\t21\t25\t29\t30\t31\t(skill('Ice Bolt'.blvl))*par8\t200\t25\t25\t25\t\t\t\t896\t64000\t0\n";
-                ss << u8"Cold Mastery\t65\tsor\tcold mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcoldmastery\t\t\tpassive_cold_pierce\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tCold Resistance reduction baseline\t5\tCold Resistance reduction per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Amplify Damage\t66\tnec\tamplify damage\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tamplifydamage\tln34\tln12\tdamageresist\t-par5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseamplifydamage\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t10\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tRadius baseline\t1\tRadius per level\t200\tDuration baseline\t75\tDuration per level\t100\tDamage Resistance %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Teeth\t67\tnec\tteeth\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\tteeth\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t19\t17\t\t\t\t\t\tteeth\tteeth\tbonecast\t\t\t\t\t\t\t\t\t\t1\t1\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t6\t1\t1\t\t\t\t\t\t\t\t\t\t\t\"min(ln12,24)\"\t# of Missiles created\tpar3\tMissile Activation Frame\t0\t# of missiles that can trigger item modifier events\t\t\t\t\t\t\t2\t# of Missiles created baseline\t1\t# of Missiles created per level\t0\tMissile Activation Frame\t\t\t\t\t\t\t\t\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t4\t2\t2\t3\t4\t5\t8\t2\t3\t4\t5\t6\t(skill('Bone Wall'.blvl)+skill('Bone Prison'.blvl)+skill('Bone Spear'.blvl)+skill('Bone Spirit'.blvl))*par8\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Bone Armor\t68\tnec\tbone armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbonearmor\t\t\t\tbonearmor\t(ln12 + (skill('Bone Wall'.blvl) + skill('Bone Prison'.blvl)) * par8)*256\tbonearmormax\t(ln12 + (skill('Bone Wall'.blvl) + skill('Bone Prison'.blvl)) * par8)*256\t\t\t\t\t\t\t\t\tabsorbdamage\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bonearmor\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_bonearmor\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t11\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tDamage absorbed baseline\t15\tDamage absorbed per level\t\t\t\t\t\t\t\t\t\t\t15\tDamage Absorbed synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Skeleton Mastery\t69\tnec\tskeleton mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tskel_mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\tRaise Skeleton\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tHP per level\t2\tDamage per level\t5\tRevive Synergy HP % per level\t10\tRevive Synergy Damage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Raise Skeleton\t70\tnec\traise skeleton\t15\t31\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdamagepercent\t((lvl < 4) ? 0 : ((lvl-3)*par3))\ttohit\t(lvl+skill('Skeleton Mastery'.lvl))*par4\tarmorclass\t(lvl+skill('Skeleton Mastery'.lvl))*par5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmaxhp\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par1) * 256\titem_normaldamage\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par2) + edmn\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecroskeleton\tskeleton\t(lvl < 4) ?lvl:(2+lvl/3)\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\t31\t\t\t\t\t\tcorpseexplosion\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t2\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t6\t1\t1\t\t\t\t\t\t\t\t\t\t\t(lvl < 4) ? 0 : (par2 * (lvl - 3))\tHP % Modifier\tpar1\t% chance to spawn with a shield (only works for necroskeleton)\t\t\t\t\t\t\t\t\t5\t% chance to spawn with a shield\t50\tHP % per level\t7\tDamage % per level\t15\tAttack Rating per level\t15\tArmor per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t1\t2\t3\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Dim Vision\t71\tnec\tdim vision\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\tdimvision\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcursedimvision\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t9\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t1\tRadius per level\t175\tDuration baseline\t50\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Weaken\t72\tnec\tweaken\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tweaken\tln34\tln12\tdamagepercent\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseweaken\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t6\t20\t\t\t\t\tAmplify Damage\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\tRadius baseline\t1\tRadius per level\t350\tDuration baseline\t60\tDuration per level\t-33\t% Damage Dealt baseline\t-1\t% Damage Dealt per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Poison Dagger\t73\tnec\tpoison dagger\t16\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\tknif\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t12\t1\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tDamage synergy\t\t\t\t\t\t\t\t\t1\t30\t20\t\t\t\t\t\t1\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t18\t10\t15\t20\t23\t26\t40\t10\t15\t20\t23\t26\t(skill('Poison Explosion'.blvl)+skill('Poison Nova'.blvl))*par8\t50\t10\t10\t10\t\t\t\t384\t3000\t0\n";
-                ss << u8"Corpse Explosion\t74\tnec\tcorpse explosion\t17\t55\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_corpse_cast\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\t\t\t\t\t\t21\t32\t\t\t\t\t\tcorpseexplosion\texplodingarrowexp\tredlightmissile\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t1\t\t\t3\t\t\t1\tnecromancer_corpse_cast\t\t\t6\t20\t\t\t\t\tTeeth\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage % of base HP for enemy Min\tpar2\tDamage % of base HP for enemy Max\tpar5\t% Damage Dealt as Elemental\t\t\t\t\t\t\t70\tDamage % of base HP for enemy Min \t120\tDamage % of base HP for enemy Max\t8\tExplosion Radius (half squares) baseline\t1\tExplosion Radius (half squares) per level\t50\tDamage % Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Clay Golem\t75\tnec\tclay golem\t\t56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_slow\tdm34\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t27\t\t\t\t\t\t\t\tvelocitypercent\tskill('Golem Mastery'.dm34)\ttohit\tskill('Golem Mastery'.ln56) + (lvl*par8)\tdamagepercent\tpar2 * (lvl - 1) + (skill('FireGolem'.blvl)*skill('FireGolem'.par8))\tarmorclass\tskill('IronGolem'.blvl)*skill('IronGolem'.par8)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tClayGolem\tgolem\t1\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t3\t1\t1\t\t\t\t\t\t\t\t\t\t(100+(par1 * (lvl - 1)))*(100+skill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8)))/100-100\tHP % Modifier\t\t\t\t\t\t\t\t\t\t\t35\tHP % per level\t35\tDamage % per level\t0\tSlow % Min\t75\tSlow % Max\t\t\t\t\t\t\t20\tClay Golem Attack Rating synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Iron Maiden\t76\tnec\tiron maiden\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tironmaiden\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\tdomeleedamage\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseironmaiden\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tAmplify Damage\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t5\t0\t1\t\t\t\t\t\t\t\t\t\t\tln56\tDamage % Returned VS Monster\tln56/4\t% Damage To Return VS Player\tln56/4\t% Damage To Return VS Hireling\t0\tFlat Damage Added\t\t\t\t\t7\tRadius baseline\t0\tRadius per level\t300\tDuration baseline\t60\tDuration per level\t200\tDamage % returned baseline\t25\tDamage % returned per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t141\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Terror\t77\tnec\tterror\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\tterror\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseterror\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t12\t20\t\t\t\t\tWeaken\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t0\tRadius per level\t200\tDuration baseline\t25\tDuration per level\t24\tDistance To Run baseline\t2\tDistance To Run per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Bone Wall\t78\tnec\tbone wall\t\t60\t\t\t\t\t\t\t\t\t\t\t\t\tbonewallmaker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbonewall\tnone\t\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t12\t20\t\t\t\t\tBone Armor\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t17\t0\t1\t\t\t\t\t\t\t\t\t\t\t(par1 * (lvl-1)) + ((skill('Bone Armor'.blvl)+skill('Bone Prison'.blvl))*par8)\tHP % Modifier\tln34\t(# of Wall Missiles created per side) / 2\t\t\t\t\t\t\t\t\t25\tHP % per level\t600\tDuration\t8\t# of Wall Missiles created baseline\t0\t# of Wall Missiles created per level\t\t\t\t\t\t\t10\tHP % synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Golem Mastery\t79\tnec\tgolem mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tgolem_mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tClay Golem\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tHP % baseline\t20\tHP % per level\t0\tVelocity % Min\t40\tVelocity % Max\t25\tAttack Rating baseline\t25\tAttack Rating per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Raise Skeletal Mage\t80\tnec\traise skeletal mage\t15\t31\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tarmorclass\t(lvl+skill('Skeleton Mastery'.lvl))*par5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmaxhp\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par1) * 256\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromage\tskeletonmage\t(lvl < 4) ?lvl:(2+lvl/3)\tS1\tNecromageMissile\tskill('Skeleton Mastery'.lvl) + ((lvl < 4)?0:((lvl-2)/2))\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\t31\t\t\t\t\t\tcorpseexplosion\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t2\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tRaise Skeleton\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t8\t1\t1\t\t\t\t\t\t\t\t\t\t\t(lvl < 4) ? 0 : (par2 * (lvl - 3))\tHP % Modifier\t\t\t\t\t\t\t\t\t\t\t\t\t10\tHP % per level\t\t\t\t\t10\tArmor per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Confuse\t81\tnec\tconfuse\t\t61\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\tconfuse\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseconfuse\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t18\t20\t\t\t\t\tDim Vision\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t250\tDuration baseline\t50\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Life Tap\t82\tnec\tlife tap\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tlifetap\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t5\tdamagedbymissile\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\tsteallife\t\t\t\t\t18\t30\t\t\t\t\t\tcursereversevampire\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t18\t20\t\t\t\t\tIron Maiden\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t9\t0\t1\t\t\t\t\t\t\t\t\t\t\tln56\tDamage % returned as healing to attacker\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t1\tRadius per level\t400\tDuration baseline\t60\tDuration per level\t50\tDamage % returned as healing to attacker baseline\t0\tDamage % returned as healing to attacker per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Poison Explosion\t83\tnec\tpoison explosion\t17\t63\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonexplosioncloud\t\t\t\t\t\t\t\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_corpse_cast\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\t\t\t\t\t\t21\t33\t\t\t\t\t\tpoisoncorpseexplosion\tpoisonexplosioncloud\tgreenlightmissile\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t1\t\t\t3\t\t\t1\tnecromancer_corpse_cast\t\t\t18\t20\t\t\t\t\tPoison Dagger\tCorpse Explosion\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t8\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t8\t2\t4\t6\t8\t10\t24\t2\t4\t6\t8\t10\t(skill('Poison Dagger'.blvl)+skill('Poison Nova'.blvl))*par8\t50\t10\t10\t10\t\t\t\t640\t16000\t0\n";
-                ss << u8"Bone Spear\t84\tnec\tbone spear\t\t\t\t\t\t\t\t\t\t\t\tbonespear\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t19\t\t\t\t\t\tbonespear\t\t\tbonecast\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t18\t20\t\t\t\t\tCorpse Explosion\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t28\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t16\t8\t9\t12\t18\t24\t24\t8\t9\t13\t19\t25\t(skill('Bone Wall'.blvl)+skill('Bone Prison'.blvl)+skill('Teeth'.blvl)+skill('Bone Spirit'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"BloodGolem\t85\tnec\tbloodgolem\t\t56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdomeleedamage\t23\tdamagedinmelee\t26\tdamagedbymissile\t26\t\t\t\tvelocitypercent\tskill('Golem Mastery'.dm34)\ttohit\tskill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\tdamagepercent\tpar4 * (lvl - 1) + (skill('FireGolem'.blvl)*skill('FireGolem'.par8))\tarmorclass\tskill('IronGolem'.blvl)*skill('IronGolem'.par8)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tBloodGolem\tgolem\t1\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tClay Golem\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t25\t3\t1\t1\t\t\t\t\t\t\t\t\t\t(100 + (par7 * (lvl - 1)))*(100 + skill('Golem Mastery'.ln12))/100 - 100\tHP % Modifier\tdm12\tLifesteal %\tpar3\tLifesteal % transferred to caster\t\t\t\t\t\t\t75\tLifesteal % Min\t150\tLifesteal % Max\t30\tLifesteal % transferred to caster\t55\tDamage % per level\t0\tDamage Received % transferred to caster\t25\tCaster Healing % transferred to golem\t20\tHP % per level\t5\tBlood Golem HP % synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Attract\t86\tnec\tattract\t18\t59\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\tattract\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseattract\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tConfuse\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t17\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\tRadius baseline\t0\tRadius per level\t300\tDuration baseline\t90\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Decrepify\t87\tnec\tdecrepify\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tdecrepify\tln34\tln12\tvelocitypercent\tpar5\tdamagepercent\tpar5\tdamageresist\tpar5\tattackrate\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcursedecrepify\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t24\t20\t\t\t\t\tTerror\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t11\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t0\tRadius per level\t100\tDuration baseline\t15\tDuration per level\t-50\tSlow % / Damage Dealt % / Damage Resistance %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Bone Prison\t88\tnec\tbone prison\t19\t62\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbonewall\tnone\t\tNU\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t1\t\tnecromancer_bone_cast\t\t\t24\t20\t\t\t\t\tBone Wall\tBone Spear\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t27\t-1\t1\t\t\t\t\t\t\t\t\t\t\t(par1 * (lvl-1)) + ((skill('Bone Armor'.blvl)+skill('Bone Wall'.blvl))*par8)\tHP % Modifier\t\t\t\t\t\t\t\t\t\t\t25\tHP % per level\t600\tDuration\t\t\t\t\t\t\t\t\t\t\t8\tHP % synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Summon Resist\t89\tnec\tsummon resist\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsummonresist\t\t\tpassive_summon_resist\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tGolem Mastery\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t1\t8\t44\t-3\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tResistance % Min\t75\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"IronGolem\t90\tnec\tirongolem\t20\t57\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tthorns\t\t\t\titem_attackertakesdamage\tedmn\tfade\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvelocitypercent\tskill('Golem Mastery'.dm34)\ttohit\tskill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\tarmorclass\tlvl*par8\tdamagepercent\t(skill('FireGolem'.blvl)*skill('FireGolem'.par8))\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\titem_pierce_magic_immunity\tstat('item_pierce_magic_immunity'.accr)\t\t\t\t\t\t\t\t\tIronGolem\tgolem\t1\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tBloodGolem\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t35\t0\t1\t1\t\t\t\t\t\t\t\t\t\tskill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8))\tHP % Modifier\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t35\tIron Golem Armor synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\t6\t12\t18\t24\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Lower Resist\t91\tnec\tlower resist\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tlowerresist\tln34\tln12\tfireresist\t-dm56\tlightresist\t-dm56\tcoldresist\t-dm56\tpoisonresist\t-dm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurselowerresist\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t30\t20\t\t\t\t\tLife Tap\tDecrepify\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t22\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\tRadius baseline\t1\tRadius per level\t500\tDuration baseline\t50\tDuration per level\t25\tResistance % reduction Min\t70\tResistance % reduction Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Poison Nova\t92\tnec\tpoison nova\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_poison_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tpoisonnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tnecromancer_poison_cast\t\t\t30\t20\t\t\t\t\tPoison Explosion\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t16\t4\t6\t9\t14\t16\t29\t4\t6\t9\t14\t16\t(skill('Poison Dagger'.blvl)+skill('Poison Explosion'.blvl))*par8\t50\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Bone Spirit\t93\tnec\tbone spirit\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\tbonespirit\tbonespirit\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t\t\t\t\t\tbonespirit\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t4\t\t\t\tnecromancer_bone_cast\t\t\t30\t20\t\t\t\t\tBone Spear\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t20\t16\t17\t18\t19\t20\t30\t17\t18\t19\t20\t21\t(skill('Bone Wall'.blvl)+skill('Bone Prison'.blvl)+skill('Teeth'.blvl)+skill('Bone Spear'.blvl))*par8\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"FireGolem\t94\tnec\tfiregolem\t\t56\t\t\t\t\t\t\t\t\t\t\t\t\tmonstercorpseexplode\t\t\t\t\t\t\t\t\t\tfireresist\t100 - dm12\titem_absorbfire_percent\tdm12\tfiremindam\tedmn\tfiremaxdam\tedmx\t\t\t\t\t\t\t\t\t\t\t\t\t\tvelocitypercent\tskill('Golem Mastery'.dm34)\ttohit\tskill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\tarmorclass\tskill('IronGolem'.blvl)*skill('IronGolem'.par8)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tFireGolem\tgolem\t1\tS1\tholy fire\t\"min(ln56,30)\"\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tIronGolem\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t50\t8\t1\t1\t\t\t\t\t\t\t\t\t\tskill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8))\tHP % Modifier\t100\tDeath Explosion Physical Damage\t100\tDeath Explosion Fire Damage\t6\tDeath Explosion Radius\t\t\t\t\t25\tFire Absorb % Min\t100\tFire Absorb % Max\t100\tDamage % baseline\t35\tDamage % per level\t7\tHoly Fire Level baseline\t1\tHoly Fire Level increased per level\t\t\t6\tFire Golem Damage % synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t10\t9\t10\t11\t12\t13\t27\t10\t11\t12\t13\t14\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Revive\t95\tnec\trevive\t21\t58\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdamagepercent\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par4)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvelocitypercent\tpar5\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\titem_pierce_magic_immunity\tstat('item_pierce_magic_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\trevive\tlvl\tNU\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_revive_cast\t\t\t\t\t\t\t\tnecromancer_revive_target\t\t\t\t\t\t24\t\t\t\t\t\t\trevivemedium\trevivesmall\trevivelarge\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t1\t\t3\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tRaise Skeletal Mage\tIronGolem\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t45\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar1+skill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par3)\tHP % Modifier\tln34\tDuration\t\t\t\t\t\t\t\t\t200\tHP %\t\t\t4500\tDuration baseline\t0\tDuration per level\t50\tVelocity %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Sacrifice\t96\tpal\tsacrifice\t29\t64\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_sacrifice\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t34\t\t\t\t\t\tblood1\t\t\t\t3\tRandom Bonus Range for Blood missile\t\t\t\t\t\t\t1\t7\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t2\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12+skill('Redemption'.blvl)*par8+skill('Fanaticism'.blvl)*par7\tDamage %\t\"max(par6, par5-lvl/par3)\"\tSelf Damage %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t180\tDamage % baseline\t15\tDamage % per level\t3\tSelf Damage Reduction per level (1/#)\t0\tSelf Damage Minimum Flat Value\t8\tSelf Damage % baseline\t1\tSelf Damage % min\t5\tDamage synergy\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t7\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Smite\t97\tpal\tsmite\t\t150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweapon_2hs_large_1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t9\t\th2h\t4\tshld\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\t\"min(ln12,250)\"\tStun Length\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t15\tStun Length baseline\t5\tStun Length per level\t15\tDamage % baseline\t15\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t8\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Might\t98\tpal\tmight\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tmight\tmight\t\tln12\tdamagepercent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t40\tDamage % baseline\t10\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Prayer\t99\tpal\tprayer\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tprayer\tprayer\t\tln12\thitpoints\tedns\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t4\t16\t3\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t1\t2\t2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Resist Fire\t100\tpal\tresist fire\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tresistfire\tresistfire\t\tln12\tfireresist\tdm34\tmaxfireresist\tskill('Resist Fire'.blvl)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpassive_resistfire\t\t\tmaxfireresist\tskill('Resist Fire'.blvl)/2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t35\tResistance % Min\t150\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Holy Bolt\t101\tpal\tholy bolt\t\t\t\t\t\t\t\t\t\t\t\tholybolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_holybolt_cast\t\t\t\t\t\t\t\t\t\t\tcast_undead\t\t\t\t\t\t\t\t\tholybolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tpaladin_holybolt_cast\tcast_undead\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t4\t32\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12 * (100 + skill('Prayer'.blvl) * par7) / 100\tHP Heal Min value\tln34 * (100 + skill('Prayer'.blvl) * par7) / 100\tHP Heal Max value\t\t\t\t\t\t\t\t\t1\tHP Heal Min baseline\t2\tHP Heal Min per level\t6\tHP Heal Max baseline\t4\tHP Heal Max per level\t\t\t\t\t20\tHealing synergy\t50\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t8\t8\t10\t13\t16\t20\t16\t8\t11\t15\t18\t23\tskill('Fist of the Heavens'.blvl)*par8\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Holy Fire\t102\tpal\tholy fire\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\tholyfire\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfiremindam\tenms*par5/256\tfiremaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tMight\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t\t\t\t\t6\tDamage multiplier added to Attacks\t100\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t10\tDamage synergy\t21\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t2\t1\t4\t6\t7\t8\t6\t2\t5\t7\t8\t9\tskill('Resist Fire'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Thorns\t103\tpal\tthorns\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tthorns\tthorns\t\tln12\titem_attackertakesdamage\tedmn\tthorns_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t250\tDamage % returned baseline\t40\tDamage % returned per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t4\t8\t12\t16\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Defiance\t104\tpal\tdefiance\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tdefiance\tdefiance\t\tln12\tskill_armor_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t70\tArmor % baseline\t10\tArmor % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Resist Cold\t105\tpal\tresist cold\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tresistcold\tresistcold\t\tln12\tcoldresist\tdm34\tmaxcoldresist\tskill('Resist Cold'.blvl)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpassive_resistcold\t\t\tmaxcoldresist\tskill('Resist Cold'.blvl)/2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t35\tResistance % Min\t150\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Zeal\t106\tpal\tzeal\t37\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tpaladin_zeal\t\t\t\t\t\t\t\t\t\t\t\t\t\t53\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tSacrifice\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t\t\t\t\t\t\t\t\t\t\t\t\"min((par5 + lvl -1), par6)\"\t# of hits\t((lvl < 5) ? 0 : ((lvl-4) * par4))+skill('Sacrifice'.blvl)*par8\tDamage %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t100\t% Anim frame rollback\t0\tDamage % baseline\t6\tDamage % per level\t2\t# of hits Min\t5\t# of hits Max\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Charge\t107\tpal\tcharge\t31\t67\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tpaladin_charge\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t37\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\tmele\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t4\t8\t1\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tSmite\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t9\t0\t\t\t\t\t\t\t\t\t\t\t\tln34+(skill('Vigor'.blvl)+skill('Might'.blvl))*par8\tDamage %\tpar1\tVelocity %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t150\tVelocity %\t\t\t100\tDamage % baseline\t25\tDamage % per level\t\t\t\t\t\t\t20\tDamage synergy\t\t\t\t\t\t\t\t\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Blessed Aim\t108\tpal\tblessed aim\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tblessedaim\tblessedaim\t\tln12\titem_tohit_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpenetrate\t\t\titem_tohit_percent\tskill('Blessed Aim'.blvl) * par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tMight\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t75\tAttack Rating % baseline\t15\tAttack Rating % per level\t\t\t\t\t\t\t5\tAttack Rating % passive synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Cleansing\t109\tpal\tcleansing\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tcleansing\tcleansing\t\tln12\titem_poisonlengthresist\t100-dm34\thitpoints\tskill('Prayer'.edns)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tPrayer\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t30\tPoison Length % Reduction Min\t90\tPoison Length % Reduction Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Resist Lightning\t110\tpal\tresist lightning\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tresistlight\tresistlight\t\tln12\tlightresist\tdm34\tmaxlightresist\tskill('Resist Lightning'.blvl)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpassive_resistltng\t\t\tmaxlightresist\tskill('Resist Lightning'.blvl)/2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t35\tResistance % Min\t150\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Vengeance\t111\tpal\tvengeance\t35\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tZeal\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12+skill('Resist Fire'.blvl)*par8+skill('Salvation'.blvl)*par7\tFire Damage %\tln12+skill('Resist Cold'.blvl)*par8+skill('Salvation'.blvl)*par7\tCold Damage %\tln12+skill('Resist Lightning'.blvl)*par8+skill('Salvation'.blvl)*par7\tLightning Damage %\t\t\t\t\t\t\t70\tDamage % baseline\t6\tDamage % per level\t\t\t\t\t\t\t\t\t2\tDamage synergy\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t15\t15\t15\t\t\t\t640\t16000\t0\n";
-                ss << u8"Blessed Hammer\t112\tpal\tblessed hammer\t\t73\t\t\t\t\t\t\t\t\t\t\t\t\tblessedhammer\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_holybolt_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t35\t\t\t\t\t\tblessedhammer\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tpaladin_holybolt_cast\t\t\t18\t20\t\t\t\t\tHoly Bolt\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage % from Concentration (in 8ths)\t\t\t\t\t\t\t\t\t\t\t4\tDamage % from Concentration (in 8ths)\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t12\t8\t10\t12\t13\t14\t16\t8\t10\t12\t13\t14\t(skill('Vigor'.blvl)+skill('Blessed Aim'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Concentration\t113\tpal\tconcentration\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tconcentration\tconcentration\t\tln12\tdamagepercent\tln34\tskill_concentration\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tBlessed Aim\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t60\tDamage % baseline\t15\tDamage % per level\t20\t% chance for uninterruptible attack\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Holy Freeze\t114\tpal\tholy freeze\t\t81\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t303747\tholywind\tholywindcold\t\tln12\tvelocitypercent\t-dm34\tattackrate\t-dm34\tother_animrate\t-dm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcoldmindam\tenms*par5/256\tcoldmaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tHoly Fire\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t25\tSlow % Min\t60\tSlow % Max\t5\tDamage multiplier added to Attacks\t100\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t7\tDamage synergy\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t2\t1\t2\t3\t4\t5\t3\t1\t2\t3\t4\t5\tskill('Resist Cold'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Vigor\t115\tpal\tvigor\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tstamina\tstamina\t\tln12\tstaminarecoverybonus\tln34\tskill_staminapercent\tln34\tvelocitypercent\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCleansing\tDefiance\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t3\tRadius per level\t50\tStamina % baseline\t25\tStamina % per level\t7\tVelocity % Min\t50\tVelocity % Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Conversion\t116\tpal\tconversion\t32\t79\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tconversion\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tVengeance\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\tdm34\t% chance to convert\t0\tFlat Damage\t0\tAttack Speed %\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t400\tDuration baseline\t0\tDuration per level\t0\t% chance to convert Min\t90\t% chance to convert Max\t0\t\"Use sumskill1 on convert expire? (0 = Off | 1 = On) (If 1, then it needs to have ItemEffect=1)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Holy Shield\t117\tpal\tholy shield\t36\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tholyshield\t\tln12\t\ttoblock\tdm56\t\tln34+skill('Defiance'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_holyshield\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\tshld\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCharge\tBlessed Hammer\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t35\t0\t1\t1\t\t\t\t\t\t\t\t\t\tln34+skill('Defiance'.blvl)*par8\tArmor %\t\t\t\t\t\t\t\t\t\t\t750\tDuration baseline\t625\tDuration per level\t25\tArmor % baseline\t15\tArmor % per level\t10\tBlock % chance Min\t40\tBlack % chance Max\t\t\t15\tArmor synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t3\t2\t3\t4\t4\t4\t6\t2\t3\t4\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Holy Shock\t118\tpal\tholy shock\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\tholyshock\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightmindam\t1\tlightmaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tHoly Freeze\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t\t\t\t\t6\tDamage multiplier added to Attacks\t100\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t4\tDamage synergy\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t\t\t\t\t\t10\t6\t8\t10\t12\t15\tskill('Resist Lightning'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Sanctuary\t119\tpal\tsanctuary\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t59270\tsanctuary\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_undeaddamage_percent\tln34\titem_undead_tohit\tln56\tskill_bypass_undead\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcast_undead\t\t\t\t\t\t\t\t\t\tsanctuarybolt\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tThorns\tHoly Freeze\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t1\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tRadius baseline\t1\tRadius per level\t150\tDamage to Undead % baseline\t30\tDamage to Undead % per level\t100\tAttack Rating to Undead baseline\t50\tAttack Rating to Undead per level\t100\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t7\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t11\t\t157\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t8\t4\t4\t5\t5\t6\t16\t4\t5\t6\t6\t7\tskill('Cleansing'.blvl)*par8\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Meditation\t120\tpal\tmeditation\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73729\tmeditation\tmeditation\t\tln12\tmanarecoverybonus\tln34\thitpoints\tskill('Prayer'.edns)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCleansing\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t300\tMana Recovery % baseline\t25\tMana Recovery % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Fist of the Heavens\t121\tpal\tfist of the heavens\t\t80\t\t\t\t\t\t\t\t\t\t\t\t\tfistoftheheavensdelay\t\t\t\thandofgod\t42371\t\t\t\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_handofgod_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\t\t\t\t\t\tfistoftheheavensdelay\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t1\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t4\t\t\t\t\t\t\t30\t20\t\t\t\t\tBlessed Hammer\tConversion\t\t\t\t\t\t10\t\t1\t1\t\t\t\t\t1\t8\t25\t0\t1\t\t\t\t\t\t\t\t\t\t\tln34\tHeal Min value\tln56\tHeal Max value\t\t\tln12\t# of Holy Bolt missiles created\t\t\t\t\t6\t# of Holy Bolt Missiles created baseline\t1\t# of Holy Bolt Missiles created per level\t1\tMin HP Healed baseline\t2\tMin HP Healed per level\t6\tMax HP Healed baseline\t2\tMax HP Healed per level\t\t\t7\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t150\t15\t30\t45\t55\t65\t200\t15\t30\t45\t55\t65\tskill('Holy Shock'.blvl)*par8\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Fanaticism\t122\tpal\tfanaticism\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tfanaticism\tfanaticism\t\tln12\tattackrate\tdm34\titem_tohit_percent\ttoht\tdamagepercent\tln56/2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdamagepercent\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tConcentration\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\tRadius baseline\t1\tRadius per level\t10\tAttack Speed % Min\t40\tAttack Speed % Max\t50\tDamage % baseline\t17\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t40\t5\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Conviction\t123\tpal\tconviction\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42371\tconviction\tconviction\t\tln12\tskill_armor_percent\t-dm56\tfireresist\t\"-min(ln34,150)\"\tcoldresist\t\"-min(ln34,150)\"\tlightresist\t\"-min(ln34,150)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t5\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tSanctuary\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tRadius baseline\t0\tRadius per level\t30\tResistance % reduction baseline\t5\tResistance % reduction per level\t40\tArmor % reduction Min\t100\tArmor % reduction Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Redemption\t124\tpal\tredemption\t\t82\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4354\tredemption\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tredemption\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tVigor\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\tdm34\t% chance to redeem\tln56\tHP gained\tln56\tMana gained\t\t\t\t\t\t\t16\tRadius baseline\t0\tRadius per level\t10\t% chance to redeem Min\t100\t% chance to redeem Max\t25\tHP and Mana gained baseline\t5\tHP and Mana gained per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Salvation\t125\tpal\tsalvation\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tresistall\tresistall\t\tln12\tfireresist\tdm34\tcoldresist\tdm34\tlightresist\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t50\tResistance % Min\t120\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Bash\t126\tbar\tbash\t32\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grunt_small_1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12+skill('Stun'.blvl)*par8\tDamage %\tln34\tFlat Damage\t0\tAttack Speed %\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t50\tDamage % baseline\t5\tDamage % per level\t1\tFlat Damage baseline\t1\tFlat Damage per level\t\t\t\t\t5\tAttack Rating synergy\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t15+lvl*5+skill('Concentrate'.blvl)*par7\t8\t\t112\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Blade Mastery\t127\tbar\tblade mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tblademastery\tblde\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Axe Mastery\t128\tbar\taxe mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\taxemastery\taxe\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Mace Mastery\t129\tbar\tmace mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmacemastery\tblun\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Howl\t130\tbar\thowl\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\thowl\t\t\t\t\t\t\tterror\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_howl_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\thowl\t\t\t\tln12-par1\tMissile Velocity Adder\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12-par1\tMissile Velocity Adder\tln34\tMonster Fear Distance To Run\tln56\tMonster Fear Duration\t\t\t\t\t\t\t12\t\"Missile Velocity baseline (Should match howl Missile Vel value, used for negation)\"\t2\tMissile Velocity per level\t24\tMonster Fear Distance To Run baseline\t5\tMonster Fear Distance To Run per level\t75\tMonster Fear Duration baseline\t25\tMonster Fear Duration per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Find Potion\t131\tbar\tfind potion\t33\t69\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_findobject_1\t\t\t\t\t\t\tbarbarian_findheart_1\t\t\t\t\t\t26\t38\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t1\t\t4\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t\t\tdm12\t% chance to find any potion\t\t\t\t\t\t\t\t\t\t\t0\t% chance to find any potion Min\t100\t% chance to find any potion Max\t30\t% chance to find Mana potion\t10\t% chance to find Rejuvenation potion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t3000\t0\n";
-                ss << u8"Leap\t132\tbar\tleap\t40\t77\t\t\t\t\t\t\t\t\t\t\t\t\tleapknockback\t\t\t\t\t\t\t\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_leap_1\t\t\t\t\t\t\t\t\t\t\t\t\t29\t43\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t13\t\t1\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t\t\tln34\tKnockback Radius\tpar7\tLeap Speed %\t\t\t\t\t\t\t\t\t8\tRange Min\t30\tRange Max\t4\tKnockback Radius baseline\t1\tKnockback Radius per level\t8\tMinimum Airborn Frames\t\t\t175\tLeap Speed %\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Double Swing\t133\tbar\tdouble swing\t68\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t27\t39\t\t\t\t\t\t\t\t\t\tpar5\tAttack Speed %\t\t\t\t\t\t\t1\t5\t\th2h\t3\tmele\t\t\t\t\tmele\t\t\t\t\tSQ\tA1\txx\t11\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tBash\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t5\t8\t-1\t1\t\t\t\t\t\t\t\t\t\t\tskill('Bash'.blvl)*par8\tDamage %\t0\tFlat Damage\tpar5\tAttack Speed %\t\t\t\t\t\t\t50\tAttack rate bonus\t\t\t\t\t\t\t50\tAttack Speed %\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t15\t5\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Pole Arm Mastery\t134\tbar\tpole arm mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpolearmmastery\tpole\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Throwing Mastery\t135\tbar\tthrowing mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tthrowingmastery\tthro\t\tpassive_mastery_throw_th\tln12\tpassive_mastery_throw_dmg\tln34\tpassive_mastery_throw_crit\tdm56\tskill_pierce\tdm78\tpassive_mastery_noconsume\tdm91\tpassive_mastery_replenish_oncrit\tpa11\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t0\t% chance to Pierce Min\t55\t% chance to Pierce Max\t0\t% chance for No Consume Min\t66\t% chance for No Consume Max\t1\t\"Replenish Quantity on crit? (0=disabled, 1=enabled)\"\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Spear Mastery\t136\tbar\tspear mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspearmastery\tspea\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Taunt\t137\tbar\ttaunt\t\t71\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34179\t\ttaunt\t\t\titem_tohit_percent\tln12\tdamagepercent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_taunt_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tHowl\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t-5\tMonster Attack Rating % baseline\t-2\tMonster Attack Rating % per level\t-5\tMonster Damage % baseline\t-2\tMonster Damage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\t384\t3000\t0\n";
-                ss << u8"Shout\t138\tbar\tshout\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\tshout\t\t\t\t\t\tshout\tshout\tln34+(skill('Battle Orders'.blvl)+skill('Battle Command'.blvl))*par8\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_shout_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tshout\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tHowl\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t6\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\tArmor % baseline\t10\tArmor % per level\t750\tDuration baseline\t250\tDuration per level\t\t\t\t\t\t\t125\tDuration synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Stun\t139\tbar\tstun\t32\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grunt_small_1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tBash\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t\t\tskill('Bash'.blvl)*par8\tDamage %\t0\tFlat Damage\t0\tAttack Speed %\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t30\tStun Length baseline\t5\tStun Length per level\t\t\t\t\t\t\t5\tDuration synergy\t5\tAttack Rating synergy\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t10+lvl*5+skill('Concentrate'.blvl)*par7\t\t\t96\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tstun\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t5\t5\t2\tskill('War Cry'.blvl)*par6\t\t\t512\t8000\t0\n";
-                ss << u8"Double Throw\t140\tbar\tdouble throw\t\t74\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t42\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\trng\t3\tthro\t\t\t\t\tthro\t\t\t\t\tSQ\tA1\txx\t15\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tDouble Swing\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t1\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12+skill('Double Swing'.blvl)*par8\tDamage %\t\t\t\t\t\t\t\t\t\t\t16\tDamage % baseline\t8\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Increased Stamina\t141\tbar\tincreased stamina\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tincreasedstamina\t\t\tskill_passive_staminapercent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tStamina % baseline\t15\tStamina % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Find Item\t142\tbar\tfind item\t34\t72\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_findobject_1\t\t\tbarbarian_findheart_1\t\t\t\t\t\t\t\t\t\t28\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t1\t\t5\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tFind Potion\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\tdm12+skill('Find Potion'.blvl)*par8\t% chance to find any item\t\t\t\t\t\t\t\t\t\t\t5\t% chance to find any item Min\t60\t% chance to find any item Max\t30\t% chance for high quality item\t5\t% chance for magic item\t\t\t\t\t\t\t1\t% chance synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Leap Attack\t143\tbar\tleap attack\t41\t78\t\t\t\t\t\t\t\t\t\t\t\t\tleapattack\t\t\t\tbash\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_leapattack_1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t44\t\t\t\t\t\tleapattack\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\tmele\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t14\t\t1\t\t4\t1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tLeap\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\tln34+skill('Leap'.blvl)*par8\tDamage %\tpar7\tLeap Speed %\t\t\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t200\tDamage % baseline\t30\tDamage % per level\t12\tMinimum Airborn Frames\t\t\t175\tLeap Speed %\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t100\t20\t\t\t\t\t\t8\t128\t10\t4\t8\t12\t16\t20\t20\t8\t16\t24\t32\t40\tskill('Leap'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Concentrate\t144\tbar\tconcentrate\t32\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdoubledamage1\t\tconcentrate\t\t\t\tskill_armor_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grunt_small_1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tStun\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t\t\t\t\t\t\t\t\t\t\t\tln12+skill('Bash'.blvl)*par8+skill('Battle Orders'.blvl)*par7\tDamage %\t0\tFlat Damage\t0\tAttack Speed %\tskill('Berserk'.blvl)\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t70\tDamage % baseline\t5\tDamage % per level\t100\tArmor % baseline\t10\tArmor % per level\t\t\t\t\t10\tDamage synergy\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t60\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Iron Skin\t145\tbar\tiron skin\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tironskin\t\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tArmor % baseline\t10\tArmor % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Battle Cry\t146\tbar\tbattle cry\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\tbattlecry\t\t\t\t\t98304\t\tbattlecry\tln12\t\tskill_armor_percent\tln34\tdamagepercent\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_battlecry_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tbattlecry\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tTaunt\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t5\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t300\tDuration baseline\t60\tDuration per level\t-50\tEnemy Armor % baseline\t-2\tEnemy Armor % per level\t-25\tEnemy Damage % baseline\t-1\tEnemy Damage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Frenzy\t147\tbar\tfrenzy\t67\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfrenzy\t\tpar7+skill('Increased Stamina'.blvl)*10\t\tvelocitypercent\tdm34\tattackrate\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t39\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\th2h\t3\tmele\t\t\t\t\tmele\t\t\t\t\tSQ\tA1\txx\t11\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tDouble Throw\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t3\t0\t\t\t\t\t\t\t\t\t\t\t\tln12+(skill('Double Swing'.blvl) + skill('Taunt'.blvl))*par8\tDamage %\t\t\t\t\tskill('Berserk'.blvl)\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t90\tDamage % base\t5\tDamage % per level\t20\tVelocity % Min\t200\tVelocity % Max\t0\tAttack Speed % Min\t50\tAttack Speed % Max\t150\tDuration\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t100\t7\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Increased Speed\t148\tbar\tincreased speed\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tincreasedspeed\t\t\tvelocitypercent\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tIncreased Stamina\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\tVelocity %\t50\tVelocity % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Battle Orders\t149\tbar\tbattle orders\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\tbattleorders\t\t\t\t\t\tbattleorders\tbattleorders\tln12+(skill('Shout'.blvl)+skill('Battle Command'.blvl))*par8\t\titem_maxmana_percent\tln34\titem_maxhp_percent\tln34\tskill_staminapercent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_battleorders_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tbattleorders\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tShout\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t750\tDuration baseline\t250\tDuration per level\t35\tHP Mana Stamina % baseline\t3\tHP Mana Stamina % per level\t\t\t\t\t\t\t125\tDuration synergy\t\t\t\t\t\t\t\t\t1\t50\t10\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Grim Ward\t150\tbar\tgrim ward\t33\t75\t\t\t\t\t\t\t\t\t\t\t\t\tgrimwardmediumstart\tgrimwardsmallstart\tgrimwardlargestart\t\t\t2\t\tterror\tpar6\tln12\tvelocitypercent\t-dm78\tattackrate\t-dm78\tother_animrate\t-dm78\tdamageresist\t-par3 - (skill('Find Potion'.blvl) * par4)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grimward_1\t\t\t\t\t\t26\t41\t\t\t\t\t\tgrimwardmediumstart\tgrimwardsmallstart\tgrimwardlargestart\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t1\t\t6\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tFind Item\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t1000\tWard Duration (Min=5)\tln12\tRadius\t\t\t\t\t\t\t\t\t6\tRadius\t1\tRadius per level\t20\tDamage Taken % baseline\t5\tDamage Taken % per level\t10\tMonster Fear Distance\t60\tMonster Fear Duration\t0\tSlow % Min\t75\tSlow % Max\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Whirlwind\t151\tbar\twhirlwind\t38\t76\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twhirlwind\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tbarbarian_whirlwind\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\t45\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t2\tmele\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t10\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tLeap Attack\tConcentrate\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t25\t1\t\t\t\t\t\t\t\t\t\t\t\tln12\tDamage %\t\t\t\t\t\t\t\t\t\t\t30\tDamage % baseline\t5\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t50\t5\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Berserk\t152\tbar\tberserk\t39\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tberserk\t\t\"par4-min(((110*lvl)/(lvl+6)*(par4-par3)/100),(par4-par3))\"\t\tdamageresist\tpar5\tarmor_override_percent\t-100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grunt_large_1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tConcentrate\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12+(skill('Howl'.blvl) + skill('Battle Orders'.blvl))*par8\tDamage %\t\"par4-min(((110*lvl)/(lvl+6)*(par4-par3)/100),(par4-par3))\"\tDuration\t\t\t100\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t150\tDamage % baseline\t15\tDamage % per level\t25\tDuration Min\t75\tDuration Max\t0\tArmor %\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t100\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Natural Resistance\t153\tbar\tnatural resistance\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnaturalresistance\t\t\tfireresist\tdm12\tlightresist\tdm12\tcoldresist\tdm12\tpoisonresist\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tIron Skin\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tResistance % Min\t80\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"War Cry\t154\tbar\twar cry\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\twarcry\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_warcry_1\t\t\t\t\t\t\t\t\t\twarcry\t\t\t\t25\t\t\t\t\t\twarcry\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tBattle Cry\tBattle Orders\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t6\t40\t3\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\tStun Length\t\t\t\t\t25\tStun Length baseline\t5\tStun Length per level\t\t\t\t\t\t\t\t\t\t\t6\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t30\t8\t9\t10\t12\t14\t40\t8\t9\t10\t12\t14\t(skill('Howl'.blvl)+skill('Taunt'.blvl)+skill('Battle Cry'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Battle Command\t155\tbar\tbattle command\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\tbattlecommand\t\t\t\t\t\tbattlecommand\tbattlecommand\tln12+(skill('Shout'.blvl)+skill('Battle Orders'.blvl))*par8\t\titem_allskills\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_command_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tbattlecommand\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tBattle Orders\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t11\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t750\tDuration baseline\t250\tDuration per level\t1\tBonus to All Skills\t\t\t\t\t\t\t\t\t125\tDuration synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Fire Hit\t156\t\t\t42\t83\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t10\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"UnHolyBolt\t157\t\t\t\t85\t\t\t\t\t\t\t\t\t\t\t\t\tunholybolt1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tunholybolt1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"SkeletonRaise\t158\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t1\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MaggotEgg\t159\t\t\t43\t84\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsandmaggotegg_hatch_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t46\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t \t\"(lvl < 5) ? lvl : min(12,5+(lvl-5)/3)\"\t# of units to spawn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"ShamanFire\t160\t\t\t\t85\t\t\t\t\t\t\t\t\t\t\t\t\tshafire1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MagottUp\t161\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsandmaggot_emerge\t\t\t\t\t\t\t\t\t\t\t\t\t\t32\t\t\t\t\t\t\tdirt pile\tsand pile\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MagottDown\t162\t\t\t45\t86\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsandmaggot_burrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t33\t47\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t10\tHP % Healed\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MagottLay\t163\t\t\t\t87\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"AndrialSpray\t164\t\t\t46\t88\t\t\t\t\t\t\t\t\t\t\t\t\tandarielspray\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34\t48\t\t\t\t\t\tandarielspray\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Jump\t165\t\t\t47\t89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t10\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t5\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Swarm Move\t166\t\t\t48\t90\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t35\t49\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t11\tAnim Sequence Start Frame\t19\tAnim Sequence Stop Frame\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Nest\t167\t\t\t49\t91\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Quick Strike\t168\t\t\t50\t92\t\t\t\t\t\t\t\t\t\t\t\t\traven1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"VampireFireball\t169\t\t\t\t\t\t\t\t\t\t\t\t\t\tvampirefireball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvampirefireball\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"VampireFirewall\t170\t\t\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\tvampirefirewallmaker\tvampirefirewall\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t26\t\t\t\t\t\tvampirefirewallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t0\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"VampireMeteor\t171\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tvampiremeteorcenter\t\t\t\t\t\t\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_meteor\t\t\t\t\t\t\tfire_cast_2\t\t\t\t28\t\t\t\t\t\tvampiremeteorcenter\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln12\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t5\tExplosion Radius baseline\t1\tExplosion Radius per level\t30\tDuration of ground fire baseline\t15\tDuration of ground fire per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t5\t5\t5\t5\t5\t5\t10\t5\t5\t5\t5\t5\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"GargoyleTrap\t172\t\t\t\t93\t\t\t\t\t\t\t\t\t\t\t\t\tshafire3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t51\t\t\t\t\t\tshafire3\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"SpiderLay\t173\t\t\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\tspidergoolay\t\t\t\t\t\tspiderlay\tslowed\t300\t\tvelocitypercent\t-100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspidergoolay\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tFrames to apply aura to target\t\t\t\t\t30\tSlow Duration per level\t75\tBuff Duration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"VampireHeal\t174\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"VampireRaise\t175\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t1\t1\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Submerge\t176\t\t\t51\t94\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t37\t52\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"FetishAura\t177\t\t\t\t111\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t53\t\t\t\t\t\tcurseeffectred\t\t\t\t3\tMissile Density\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tAttack Speed % baseline\t50\tDuration baseline & per level\t5\tAttack Speed % per level\t10\tRadius baseline (+2 per level)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"FetishInferno\t178\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tfetishinferno1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t54\t54\t\t\t\t\t\tfetishinferno1\tfetishinferno2\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t3\tAnim Frame Density (Min=1)\t\t\t\t\t\t\t15\tAnim Frame Adder (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"ZakarumHeal\t179\t\t\t\t96\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\treceiving\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\treceiving\t\t\t\thealing\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t15+5*lvl\tHeal % Min\t50\tHeal % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Emerge\t180\t\t\t52\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t38\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Resurrect\t181\t\t\t\t97\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfallenshaman_resurrect_cast\t\t\t\t\t\t\t\t\t\t\thealing\t\t\t39\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t1\t1\t1\t\t1\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Bestow\t182\t\t\t\t96\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\treceiving\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\treceiving\t\t\t\thealing\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t15+5*lvl\tHeal % Min\t50\tHeal % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MissileSkill1\t183\t\t\t\t110\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonTeleport\t184\t\t\t\t98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_teleport\t\t\t\t\t\t\t\t\t\t\tteleport\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"PrimeLightning\t185\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonsterlight\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto_lightning_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonsterlight\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"PrimeBolt\t186\t\t\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\tchargedstrikebolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto_chargedbolt_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t\t\t\t\t\tchargedbolt\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl+2\t# of Bolt Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"PrimeBlaze\t187\t\t\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\tblaze\t\t\t\t\t\tblaze\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_fire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tblaze\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tBuff Duration Min\t60\tBuff Duration Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"PrimeFirewall\t188\t\t\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\tvampirefirewallmaker\tvampirefirewall\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_fire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t26\t\t\t\t\t\tvampirefirewallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t0\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"PrimeSpike\t189\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonglacialspike\t\t\t\t\t\t\t\t\t\t\tln12\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_cold\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonglacialspike\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t0\tRadius per level\t25\tFreeze frames baseline\t10\tFreeze frames per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"PrimeIceNova\t190\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tfrostnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_cold\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tfrostnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"PrimePoisonball\t191\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto_orb_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t17\t\t\t\t\t\tpoisonball\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\"min(ln12,24)\"\t# of Missiles created\tpar3\tMissile Activation Frame\t0\t# of missiles that can trigger item modifier events\t\t\t\t\t\t\t3\t# of Missiles created baseline\t0\t# of Missiles created per level\t1\tMissile Activation Frame\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"PrimePoisonNova\t192\t\t\t\t99\t\t\t\t\t\t\t\t\t\t\t\t\tprimepoisoncloud\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t55\t\t\t\t\t\tprimepoisoncloud\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl-1\t# of Missile Subloops\t2\tMissiles Created Modifier (used as 16/#=Total Missiles created) (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"DiabLight\t193\t\t\t53\t152\t\t\t\t\t\t\t\t\t\t\t\t\tdiablight\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_laser_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\t56\t\t\t\t\t\tdiablight\t\t\t\t0\tDelay between Missiles created\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t2\tMissile Frame Density (Min=1)\t\t\t\t\t\t\t40\tAnim Frame Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"DiabCold\t194\t\t\t\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_cold_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t200\tFrames\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t15\t9\t9\t9\t9\t9\t25\t12\t12\t12\t12\t12\t\t100\t50\t50\t50\t\t\t\t\t0\t0\n";
-                ss << u8"DiabFire\t195\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tdiabfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_fire_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tdiabfire\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"FingerMageSpider\t196\t\t\t\t101\t\t\t\t\t\t\t\t\t\t\t\t\tfingermagespider\t\t\t\t\t\t\tfingermagecurse\tln12\t\tmanarecovery\t-par3 * lvl\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfingermage_bolt_cast_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t57\t\t\t\t\t\tfingermagespider\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl-1\t# of Missile Subloops\t\t\t\t\t\t\t\t\t\t\t30\tDuration for Mana drain baseline\t10\tDuration for Mana drain per level\t24\tMana Recovery % Reduction\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"DiabWall\t197\t\tfirestorm\t\t102\t\t\t\t\t\t\t\t\t\t\t\t\tdiabwallmaker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_fire_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t58\t\t\t\t\t\tdiabwallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\tlvl\t# of Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"DiabRun\t198\t\t\t54\t103\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_run\t\t\t\t\t\t\t\t\t\t\t\t\t\t41\t59\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t20\tVelocity %\t\t\t\t\t\t\t\t\t\t\t8\tAnim Run Stop Frame Length\t14\tAnim Run Stop Event Frame\t5\tAnim Run Start Event Frame\t13\tAnim Run Loop Repeat Event Frame\t16\tAnim Run Loop Frame Length\t6\tAnim Run Loop Start Event Frame\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t5\t\t\t\t8\t\t17\t9\t9\t9\t9\t9\t33\t9\t9\t9\t9\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"DiabPrison\t199\t\t\t\t104\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tboneprison1\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_boneprison_rise\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"PoisonBallTrap\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap poison ball left\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap poison ball left\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t10\t10\t10\t10\t10\t20\t10\t10\t10\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"AndyPoisonBolt\t201\t\t\t\t\t\t\t\t\t\t\t\t\t\tandypoisonbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tandypoisonbolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"HireableMissile\t202\t\t\t\t110\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"DesertTurret\t203\t\t\t\t105\t\t\t\t\t\t\t\t\t\t\t\t\tdesertfireball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t60\t\t\t\t\t\tdesertfireball\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t26\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t3\t# of Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"ArcaneTower\t204\t\t\t\t106\t\t\t\t\t\t\t\t\t\t\t\t\tlightningtowernova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightningorb_attack_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t61\t\t\t\t\t\tlightningtowernova\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t27\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonBlizzard\t205\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tmonblizcenter\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_2\t\t\t\t28\t\t\t\t\t\tmonblizcenter\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Mosquito\t206\t\t\t55\t107\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42\t62\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t4\t# of Anim loops Min (1 loop = 1 frame)\t7\t# of Anim Frame loops Max (1 loop = 1 frame)\t25\tHeal % of current HP\t\t\t\t\t\t\t12\tAnim Repeat Start Frame\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t2\t2\t2\t2\t2\t2\t4\t2\t2\t2\t2\t2\t\t\t2\t3\t3\t3\t3\t3\t4\t3\t3\t3\t3\t3\t\t200\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"CursedBallTrapRight\t207\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap cursed skull right\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap cursed skull right\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t5\t5\t5\t5\t5\t20\t5\t5\t5\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"CursedBallTrapLeft\t208\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap cursed skull left\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap cursed skull left\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t5\t5\t5\t5\t5\t20\t5\t5\t5\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonFrozenArmor\t209\t\t\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfrozenarmor\t\tln34\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_cold\t\t\t\tsorceress_frozenarmor\t\t\t\t\t\t\tice_cast_3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tArmor % baseline\t5\tArmor % per level\t3600\tDuration\t300\tDuration per level\t30\tFreeze Frames\t3\tFreeze Frames per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t0\t0\n";
-                ss << u8"MonBoneArmor\t210\t\t\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbonearmor\t\t\t\tbonearmor\tln12*256\tbonearmormax\tln12*256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bonearmor\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tDamage absorbed baseline\t10\tDamage absorbed per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonBoneSpirit\t211\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\tmonbonespirit\tmonbonespirit\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_fire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t\t\t\t\t\tmonbonespirit\tmonbonespirit\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t15\tSearch range\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonCurseCast\t212\t\t\t\t112\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseeffectred\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tRadius baseline\t1\tRadius per level\t300\tDuration baseline\t60\tDuration per level\t25\tResistance % reduction Min\t70\tResistance % reduction Max\t-50\tAttack Speed % and Velocity %\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"HellMeteor\t213\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\thellmeteordown\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"RegurgitatorEat\t214\t\t\t\t108\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tregurgitator_eat_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t63\t\t\t\t\t\tcorpseexplosion\tbigblood1\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t33\tHeal % of target's max HP\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonFrenzy\t215\t\t\t64\t109\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonfrenzy\t\tln12\t\tvelocitypercent\tdm34\tattackrate\tdm34\tother_animrate\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t200\tDuration baseline\t25\tDuration per level\t30\tSpeed % Min\t110\tSpeed % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"QueenDeath\t216\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t64\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t41\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Scroll of Identify\t217\t\tscroll of identify\t\t113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Book of Identify\t218\t\tbook of identify\t\t113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Scroll of Townportal\t219\t\tscroll of townportal\t\t113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Book of Townportal\t220\t\tbook of townportal\t\t113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Raven\t221\tdru\traven\t\t114\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruidhawk\traven\t\"min(lvl,par2)\"\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t6\t0\t1\t1\t\t\t\t\t\t\t\t\t\t0\tHP %\tulvl + par1 + lvl\tSummon Pet Level (Min=1)\tln56\t# of hits\t\t\t\t\t\t\t-2\tSummon Pet Level baseline\t5\t# of max ravens\t\t\t\t\t12\t# of hits baseline\t1\t# of hits per level\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t100\t30\t\t\t\t\t\t8\t\t2\t1\t4\t8\t14\t20\t4\t2\t5\t9\t15\t21\t(skill('Summon Spirit Wolf'.blvl)+skill('Summon Fenris'.blvl)+skill('Summon Grizzly'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Plague Poppy\t222\tdru\tplague poppy\t\t115\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvine_beast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tplaguepoppy\tvine\t1\tS1\tVine Attack\tlvl\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t8\t0\t1\t1\t\t\t\t\t\t\t\t\t\tpar3 * (lvl-1)\tHP %\tulvl * 3 / 4 + lvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t50\tHP % per level\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t16\t16\t16\t32\t64\t80\t24\t16\t18\t36\t68\t84\tskill('Rabies'.blvl)*par8\t100\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Wearwolf\t223\tdru\twearwolf\t\t116\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twolf\t\t1000+skill('Shape Shifting'.ln12)\t\tskill_staminapercent\tpar1\tattackrate\tdm34\titem_tohit_percent\ttoht\titem_maxhp_percent\tpar2+skill('Shape Shifting'.ln34)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twolf_into\twolf_undo\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t22\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t25\t0\t1\t\t\t\t\t1\t8\t15\t0\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\tStamina %\t25\tHP %\t10\tAttack Speed % Min\t80\tAttack Speed % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tAllow Instant Direct Transformation\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Shape Shifting\t224\tdru\tshape shifting\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\tWearwolf\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1000\tDuration baseline\t500\tDuration per level\t20\tHP % baseline\t5\tHP % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Firestorm\t225\tdru\tfirestorm\t\t117\t\t\t\t\t\t\t\t\t\t\t\t\tfirestormmaker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_b\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_1\t\t\t\t67\t\t\t\t\t\tfirestormmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tdruid_firecast_b\tdruid_fire_cast_1\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t15\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12\t# of Missiles created\t\t\t\t\t\t\t\t\t\t\t3\t# of Missiles created baseline\t0\t# of Missiles created per level\t\t\t\t\t\t\t\t\t\t\t23\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t3\t3\t5\t7\t14\t21\t6\t3\t6\t8\t15\t23\t(skill('Molten Boulder'.blvl)+skill('Eruption'.blvl))*par8\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Oak Sage\t226\tdru\toak sage\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonresist\t100\tmaxpoisonresist\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\toaksage\ttotem\t1\tNU\tOak Sage Aura\tlvl\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t1\t1\t1\t\t\t\t\t\t\t\t\t\t(lvl-1)*par3\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t30\tAura HP % baseline (must match Oak Sage Aura Param3)\t5\tAura HP % per level (must match Oak Sage Aura Param4)\t30\tHP % per level\t\t\t\t\t\t\t30\tRadius baseline (must match Oak Sage Aura Param1)\t2\tRadius per level (must match Oak Sage Aura Param2)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Summon Spirit Wolf\t227\tdru\tsummon spirit wolf\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\t\"min(par8 * lvl,85)\"\tcoldresist\t\"min(par8 * lvl,85)\"\tlightresist\t\"min(par8 * lvl,85)\"\tpoisonresist\t\"min(par8 * lvl,85)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_armor_percent\t(par4 * lvl) + ln56\ttohit\tln12\tcoldmindam\tedmn\tcoldmaxdam\tedmx\tcoldlength\tedln\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspiritwolf\tspiritwolf\t\"min(lvl,par3)\"\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tRaven\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t0\t1\t1\t\t\t\t\t\t\t\t\t\t(par7 * lvl) + skill('Summon Fenris'.par2) * skill('Summon Fenris'.lvl)\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t50\tAttack Rating % baseline (also used for synergy)\t25\tAttack Rating % per level (also used for synergy)\t5\t# of max wolves\t7\tArmor % per level\t50\tArmor % baseline (also used for synergy)\t10\tArmor % per level (also used for synergy)\t10\tHP % per level\t5\tResistance % per level\t\t\t\t\t\t\t\t\t1\t75\t20\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t2\t1\t3\t4\t5\t8\t6\t1\t3\t4\t5\t8\tskill('Summon Grizzly'.ln12)\t25\t25\t25\t25\t25\t\t\t384\t3000\t0\n";
-                ss << u8"Wearbear\t228\tdru\twearbear\t\t116\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbear\t\t1000+skill('Shape Shifting'.ln12)\t\tdamagepercent\tln12\tskill_armor_percent\tln34\titem_maxhp_percent\tpar5 + skill('Shape Shifting'.ln34)\tskill_concentration\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbear_into\tbear_undo\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t22\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t25\t0\t1\t\t\t\t\t1\t8\t15\t0\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t55\tDamage % baseline\t15\tDamage % per level\t40\tArmor % baseline\t10\tArmor % per level\t75\tHP %\t100\t% chance for uninterruptible attack\t\t\t\t\t\t\t\t\t\t\t1\tAllow Instant Direct Transformation\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Molten Boulder\t229\tdru\tmolten boulder\t\t\t\t\t\t\t\t\t\t\t\tmoltenboulderemerge\t\t\t\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_b\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_1\t\t\t\t\t\t\t\t\tmoltenboulderemerge\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tdruid_firecast_b\tdruid_fire_cast_1\t\t6\t20\t\t\t\t\tFirestorm\t\t\t\t\t\t\t25\t\t1\t1\t\t\t\t\t1\t7\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t12\tPhysical Damage synergy\t8\tFire Damage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t6\t4\t7\t10\t13\t16\t12\t5\t8\t11\t14\t17\tskill('Volcano'.blvl)*par7\tfire\t6\t4\t7\t10\t13\t16\t12\t5\t8\t11\t14\t17\tskill('Firestorm'.blvl)*par8\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"Arctic Blast\t230\tdru\tarctic blast\t11\t19\t\t\t\t\t\t\t\t\t\t\t\t\tarcticblast1\t\t\t\t\t\t\t\t\tln12/4-2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tarctic_blast_cast\tdruid_windcast\t\t\t\t15\t24\t\t\t\t\t\tarcticblast1\tarcticblast2\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t18\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\t\t6\t0\t2\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12/2\tRange (Duration of Missile) (Min=1)\t20\tDuration to channel if caster is a Monster (Min=1)\t\t\t\t\t\t\t\t\t35\tRange baseline (Duration of missile)\t2\tRange per level (Duration of missile)\t4\tMin Mana required to start casting\t\t\t\t\t\t\t\t\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t32\t20\t26\t28\t32\t36\t64\t21\t27\t29\t33\t37\tskill('Cyclone Armor'.blvl)*par8\t100\t15\t15\t15\t\t\t\t384\t3000\t0\n";
-                ss << u8"Cycle of Life\t231\tdru\tcycle of life\t\t115\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvine_beast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcycleoflife\tvine\t1\tS1\tVine Attack\tlvl\tCorpseCycler\tlvl\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tPlague Poppy\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t10\t0\t1\t1\t\t\t\t\t\t\t\t\t\tpar3 * (lvl-1)\tHP %\tulvl * 3 / 4 + lvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t25\tHP % per level\t\t\t4\tLifesteal % baseline (must match CorpseCycler Param1)\t1\tLifesteal % per level (must match CorpseCycler Param2)\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t3000\t0\n";
-                ss << u8"Feral Rage\t232\tdru\tferal rage\t56\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tferalrage\t\tpar1\t\tvelocitypercent\tdm34\tlifedrainmindam\tpar2 * lvl\tlifedrainmaxdam\tpar2 * lvl\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tWearwolf\t\t\t2\twolf\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\tln56\tDamage %\tlvl/par7 + par8\t# of Max Charges\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t500\tDuration\t4\tLifesteal % per Charge\t10\tVelocity % Min\t70\tVelocity % Max\t50\tDamage % baseline\t5\tDamage % per level\t2\t# of Levels needed per max Charge gained\t3\t# of max Charges Min\t\t\t\t\t\t\t\t\t1\t20\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t3000\t0\n";
-                ss << u8"Maul\t233\tdru\tmaul\t56\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmaul\t\tpar4\t\tdamagepercent\tlvl*par3\tstunlength\tdm56\tattackrate\tlvl*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tWearbear\t\t\t2\tbear\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\tlvl/par7 + par8\t# of Max Charges\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t3\tAttack Speed % per Charge\t\t\t30\tDamage % per Charge\t500\tDuration\t10\tStun Length Min\t100\tStun Length Max\t2\t# of Levels needed per max Charge gained\t3\t# of max Charges Min\t\t\t\t\t\t\t\t\t1\t40\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t3000\t0\n";
-                ss << u8"Eruption\t234\tdru\teruption\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\terruption center\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_a\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_2\t\t\t\t28\t\t\t\t\t\terruption center\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tdruid_firecast_a\tdruid_fire_cast_2\t\t12\t20\t\t\t\t\tMolten Boulder\t\t\t\t\t\t\t50\t\t0\t1\t\t\t\t\t1\t8\t15\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tRadius\tpar2\tMissile Delay\t\t\t\t\t\t\t\t\t7\tRadius to create Missiles\t6\tMissile Spawn Rate (Min=1)\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t15\t6\t12\t16\t18\t22\t25\t6\t12\t16\t19\t23\t(skill('Firestorm'.blvl)+skill('Volcano'.blvl))*par8\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Cyclone Armor\t235\tdru\tcyclone armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcyclonearmor\t\t\t\tbonearmor\t(ln12*(100+(skill('Twister'.blvl)+skill('Tornado'.blvl)+skill('Hurricane'.blvl))*par8)/100)*256\tbonearmormax\t(ln12*(100+(skill('Twister'.blvl)+skill('Tornado'.blvl)+skill('Hurricane'.blvl))*par8)/100)*256\t\t\t\t\t\t\t\t\tabsorbdamage\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_cyclonearmor\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tArctic Blast\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t5\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tElemental Damage Absorbed baseline\t12\tElemental Damage Absorbed per level\t\t\t\t\t\t\t\t\t\t\t7\tDamage Absorbed synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n";
-                ss << u8"Heart of Wolverine\t236\tdru\theart of wolverine\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonresist\t100\tmaxpoisonresist\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\theartofwolverine\ttotem\t1\tNU\tWolverine Aura\tlvl\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tOak Sage\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t1\t1\t1\t\t\t\t\t\t\t\t\t\t(lvl-1)*par1\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t25\tHP % per level\t3\tBonus Level\t25\tAttack Rating % baseline (must match Wolverine Aura)\t7\tAttack Rating % per level (must match Wolverine Aura)\t20\tDamage % baseline (must match Wolverine Aura Param5)\t7\tDamage % per level (must match Wolverine Aura Param6)\t30\tRadius baseline (must match Wolverine Aura Param1)\t2\tRadius per level (must match Wolverine Aura Param2)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t8000\t0\n";
-                ss << u8"Summon Fenris\t237\tdru\tsummon fenris\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\t\"min(par8 * lvl,85)\"\tcoldresist\t\"min(par8 * lvl,85)\"\tlightresist\t\"min(par8 * lvl,85)\"\tpoisonresist\t\"min(par8 * lvl,85)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_armor_percent\t(par6 * lvl) + skill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par6)\ttohit\tskill('Summon Spirit Wolf'.lvl) * skill('Summon Spirit Wolf'.par2)\tdamagepercent\tskill('Summon Grizzly'.ln12)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfenris\tfenris\t\"min(lvl,par3)\"\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tOak Sage\tSummon Spirit Wolf\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t1\t\t\t\t\t\t\t\t\t\t(par7 * lvl) + ln12\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t50\tHP % baseline (also used for synergy)\t15\tHP % per level (also used for synergy)\t3\t# of max wolves\t\t\t\t\t4\tArmor % per level\t10\tHP % per level\t5\tResistance % per level\t\t\t\t\t\t\t\t\t1\t150\t20\t\t\t\t\t\t8\t\t7\t2\t4\t8\t10\t12\t12\t3\t5\t9\t11\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t8000\t0\n";
-                ss << u8"Rabies\t238\tdru\trabies\t57\t121\t\t\t\t\t\t\t\t\t\t\t\t\trabiesplague\t\t\t\t\t\t\trabies\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS3\tS3\tS3\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tFeral Rage\t\t\t2\twolf\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tDamage synergy\t\t\t\t\t\t\t\t\t1\t50\t10\t\t1\t2\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t6\t4\t5\t7\t11\t16\t14\t4\t5\t7\t11\t16\t(skill('Plague Poppy'.blvl))*par8\t100\t10\t10\t10\t\t\t\t640\t16000\t0\n";
-                ss << u8"Fire Claws\t239\tdru\tfire claws\t58\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire_hit\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tFeral Rage\tMaul\t\t2\twolf\tbear\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\tDamage synergy\t\t\t\t\t\t\t\t\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t32\t16\t24\t32\t40\t48\t48\t17\t25\t33\t41\t49\t(skill('Firestorm'.blvl)+skill('Molten Boulder'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Twister\t240\tdru\ttwister\t\t118\t\t\t\t\t\t\t\t\t\t\t\t\ttwister\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_windcast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t68\t\t\t\t\t\ttwister\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCyclone Armor\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of Missiles created\tpar2+par7*skill('Arctic Blast'.blvl)\tStun Length (Used by Missile pSrvDmgFunc function)\t\t\t\t\t\t\t\t\t3\t# of Missiles created\t10\tStun Length\t\t\t\t\t\t\t\t\t2\tDuration Synergy\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t12\t7\t11\t15\t18\t21\t16\t7\t11\t15\t18\t21\t(skill('Tornado'.blvl)+skill('Hurricane'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"Vines\t241\tdru\tvines\t\t115\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvine_beast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvinecreature\tvine\t1\tS1\tVine Attack\tlvl\tVineCycler\tlvl\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCycle of Life\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t14\t1\t1\t1\t\t\t\t\t\t\t\t\t\tpar3 * (lvl-1)\tHP %\tulvl * 3 / 4 + lvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t20\tHP % per level\t\t\t4\tManasteal % baseline (must match VineCycler Param1)\t1\tManasteal % per level (must match VineCycler Param2)\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t16000\t0\n";
-                ss << u8"Hunger\t242\tdru\thunger\t\t122\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS3\tS3\tS3\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tFire Claws\t\t\t2\twolf\tbear\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar5\tDamage %\tdm12\tLifesteal %\tdm34\tManasteal %\t\t\t\t\t\t\t50\tLifesteal % Min\t200\tLifesteal % Max\t50\tManasteal % Min\t200\tManasteal % Max\t-75\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t50\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Shock Wave\t243\tdru\tshock wave\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\tshockwave\tshockwave\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t17\t\t\t\t\t\tshockwave\tshockwave\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tMaul\t\t\t2\tbear\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t5\t# of Missiles created\t0\tMissile Activation Frame\t0\t# of missiles that can trigger item modifier events\tln12\tStun Length\t0\t% Damage Synergy\t\t\t40\tStun Length baseline\t15\tStun Length per level\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t3\t5\t7\t7\t7\t20\t3\t5\t7\t7\t7\tskill('Maul'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Volcano\t244\tdru\tvolcano\t\t123\t\t\t\t\t\t\t\t\t\t\t\t\tvolcano\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_a\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_2\t\t\t\t97\t\t91\t\t\t\tvolcano\tvolcano overlay fire\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\tdruid_fire_cast_2\t\t24\t20\t\t\t\t\tEruption\t\t\t\t\t\t\t100\t\t0\t1\t\t\t\t\t1\t8\t25\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar2\tDelay between Missiles created\t\t\t\t\t12\tMissile Range\t2\tDelay between Missiles created\t\t\t\t\t\t\t\t\t16\tPhysical Damage synergy\t12\tFire Damage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t8\t2\t4\t6\t8\t10\t10\t2\t4\t6\t8\t10\tskill('Molten Boulder'.blvl)*par7\tfire\t8\t2\t4\t6\t8\t11\t10\t2\t4\t6\t8\t13\t(skill('Eruption'.blvl)+skill('Armageddon'.blvl))*par8\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Tornado\t245\tdru\ttornado\t\t118\t\t\t\t\t\t\t\t\t\t\t\t\ttornado\t\t\t\t\t42371\t\t\t\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_windcast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t69\t\t\t\t\t\ttornado\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tTwister\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\t1\t# of Missiles created\t\t\t\t\tpar1\tPeriodic Damage Delay\t\t\t\t\t15\tPeriodic Damage Delay\t3\tMissile Radius\t\t\t\t\t\t\t\t\t\t\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t25\t8\t14\t20\t24\t28\t35\t8\t15\t21\t25\t29\t(skill('Cyclone Armor'.blvl)+skill('Twister'.blvl)+skill('Hurricane'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"Spirit of Barbs\t246\tdru\tspirit of barbs\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonresist\t100\tmaxpoisonresist\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspiritofbarbs\ttotem\t1\tNU\tBarbs Aura\tlvl\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tHeart of Wolverine\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t25\t1\t1\t1\t\t\t\t\t\t\t\t\t\t(lvl-1)*par1\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t25\tHP % per level\t0\tBonus Level\t\t\t\t\t\t\t\t\t\t\t2\tRadius per level (must match Barbs Aura Param2)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t32\t9\t18\t27\t36\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Summon Grizzly\t247\tdru\tsummon grizzly\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\t\"min(par8 * lvl,85)\"\tcoldresist\t\"min(par8 * lvl,85)\"\tlightresist\t\"min(par8 * lvl,85)\"\tpoisonresist\t\"min(par8 * lvl,85)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_armor_percent\tskill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par6)\ttohit\tskill('Summon Spirit Wolf'.lvl) * skill('Summon Spirit Wolf'.par2)\tdamagepercent\tln12\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruidbear\tgrizzly\t1\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tSummon Fenris\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t40\t0\t1\t1\t\t\t\t\t\t\t\t\t\t(par7 * lvl) + skill('Summon Fenris'.par2) * skill('Summon Fenris'.lvl)\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t25\tDamage % baseline (also used for synergy)\t10\tDamage % per level (also used for synergy)\t\t\t\t\t\t\t\t\t10\tHP % per level\t5\tResistance % per level\t\t\t\t\t\t\t\t\t1\t300\t20\t\t\t\t\t\t8\t\t30\t10\t15\t20\t26\t30\t60\t10\t15\t20\t26\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Fury\t248\tdru\tfury\t37\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t53\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tRabies\t\t\t2\twolf\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t\"min((par5 + lvl -1), par6)\"\t# of hits\tln34\tDamage %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t70\t% Anim frame rollback\t100\tDamage % baseline\t17\tDamage % per level\t2\t# of hits Min\t5\t# of hits Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t50\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Armageddon\t249\tdru\tarmageddon\t\t124\t\t\t\t\t\t\t\t\t\t\t\t\tarmageddoncontrol\tarmageddoncontrol\tarmageddoncontrol\t\t\t\tarmageddon\t\tln12 + skill('Eruption'.blvl) * par7\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_a\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_2\t\t\t\t\t\t92\t\t\t\tarmageddontail\tarmageddonrock\t\t\t25\tMissile Frames\t25\tMissile Fall Rate\t15\tMissile Slide Rate\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tVolcano\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t35\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t250\tDuration baseline\t0\tDuration per level\t8\tRadius\t6\tDelay between Missiles created\t\t\t18\tPhysical Damage synergy\t50\tDuration synergy\t14\tFire Damage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t18\t10\t12\t15\t18\t22\t26\t11\t13\t16\t19\t23\tskill('Volcano'.blvl)*par6\tfire\t25\t15\t20\t25\t31\t38\t75\t16\t22\t27\t34\t40\t(skill('Molten Boulder'.blvl)+skill('Firestorm'.blvl))*par8\t\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Hurricane\t250\tdru\thurricane\t\t124\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\thurricane\t\tln12 + skill('Cyclone Armor'.blvl) * par7\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_windcast\t\t\t\t\t\t\t\t\t\tdruid_hurricane\t\t\t\t\t\t\t\t\t\t\thurricaneswoosh\thurricanerock\thurricanetree\t\t3\t# of Debris Missiles created\t75\tDebris Missile Max Height\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tTornado\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t30\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t250\tDuration baseline\t0\tDuration per level\t9\tRadius\t20\tPeriodic Damage Delay\t\t\t\t\t50\tDuration synergy\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t1\t2\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t25\t7\t10\t12\t14\t16\t50\t7\t10\t12\t14\t16\t(skill('Twister'.blvl)+skill('Tornado'.blvl))*par8\t50\t\t\t\t\t\t\t896\t64000\t0\n";
-                ss << u8"Fire Trauma\t251\tass\tfire trauma\t\t\t\t\t\t\t\t\t\t\t\tbomb in air\t\t1\t\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweapon_throw_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbomb in air\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t5\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tRadius\t\t\t\t\t\t\t\t\t\t\t\t\t11\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t6\t3\t8\t20\t38\t58\t8\t5\t11\t24\t44\t66\t(skill('Shock Field'.blvl) + skill('Charged Bolt Sentry'.blvl) + skill('Lightning Sentry'.blvl) + skill('Wake of Fire Sentry'.blvl) + skill('Inferno Sentry'.blvl)) * par8\t\t\t\t\t\t5\t\t256\t1000\t0\n";
-                ss << u8"Claw Mastery\t252\tass\tclaw mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tclawmastery\th2h\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\th2h\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tAttack Rating % baseline\t10\tAttack Rating % per level\t35\tDamage % baseline\t4\tDamage % per level\t0\t% chance for Critical Hit Min\t25\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t\t256\t1000\t0\n";
-                ss << u8"Psychic Hammer\t253\tass\tpsychic hammer\t22\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tassassin_psychichammer\t\t\t\t\t\t\tpsychic_hammer_hit\tpaladin_holybolt_impact_1\t\t\tpsychic_hammer_curse\t\t\t5\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t4\t1\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tKnockback % VS Monster\tdm34\tKnockback % VS Unique Monster\tdm56\tKnockback % VS Boss\tdm56\tKnockback % VS Player\t\t\t\t\t100\tKnockback % VS Monster\t\t\t50\tKnockback % VS Unique Monster Min\t100\tKnockback % VS Unique Monster Max\t25\tKnockback % VS Boss Min\t99\tKnockback % VS Boss Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t2\t2\t3\t4\t5\t6\t6\t3\t4\t5\t6\t7\t\tmag\t2\t2\t3\t4\t5\t6\t6\t3\t4\t5\t6\t7\t\t\t\t\t\t\t5\t\t256\t1000\t0\n";
-                ss << u8"Tiger Strike\t254\tass\ttiger strike\t23\t34\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\tprogressive_damage\t\tpar3\t\tprogressive_damage\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassinfootimpact\t\ttigerstrike1\tassassin_chargeup_tiger_1\t\t\t\t\t\t\t12\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t1\t0\t1\t\t\t\t\t\t\t\t\t1\t\tln12\tDamage %\t\t\t\t\t\t\t\t\t\t\t100\tDamage % baseline\t20\tDamage % per level\t375\tDuration\t50\tAttack Rating % per Charge\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t\t256\t1000\t0\n";
-                ss << u8"Dragon Talon\t255\tass\tdragon talon\t24\t42\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_kick_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t4\t\t\t\t\t\t\t\t\t\t\tKK\tKK\tA1\t19\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t6\t0\t\t\t\t\t\t1\t0\t1\t\t\t\tlvl/6+1\t# of kicks\tdm34\tKnockback % VS Unique Monster\tdm56\tKnockback % VS Boss\tdm56\tKnockback % VS Player\t\t\t\t\t5\tDamage % baseline\t7\tDamage % per level\t50\tKnockback % VS Unique Monster Min\t100\tKnockback % VS Unique Monster Max\t25\tKnockback % VS Boss Min\t99\tKnockback % VS Boss Max\t\t\t1\tAlways Hit (0 = disabled | 1 = enabled only when Charges are consumed)\t\t\t\t\t\t\t\t\t1\t20\t35\t\t\t\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t\t256\t1000\t0\n";
-                ss << u8"Shock Field\t256\tass\tshock field\t\t43\t\t\t\t\t\tpar1+lvl/par2+skill('Fire Trauma'.blvl)/3\t\t\t\t\t\t\tshock field in air\t\t\t\t\t\t\t\t\t(par1+lvl/par2+skill('Fire Trauma'.blvl)/3)/4+1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweapon_throw_1\t\t\t\t\t\t\t\t\t\t\t5\t\t\t\t\t\tshock field in air\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tFire Trauma\t\t\t\t\t\t\t15\t\t1\t1\t\t\t\t\t1\t8\t6\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t# of Missiles created\t4\t# of Levels needed per Missile created gained\t\t\t\t\t\t\t\t\t\t\t17\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t2\t0\t0\t0\t0\t0\t20\t6\t12\t20\t30\t42\t(skill('Charged Bolt Sentry'.blvl) + skill('Lightning Sentry'.blvl)) * par8\t\t\t\t\t\t11\t\t384\t3000\t0\n";
-                ss << u8"Blade Sentinel\t257\tass\tblade sentinel\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\tblade creeper\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\ttohit\tlvl*5\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\tpassive_ltng_mastery\tstat('passive_ltng_mastery'.accr)\tpassive_cold_mastery\tstat('passive_cold_mastery'.accr)\tpassive_pois_mastery\tstat('passive_pois_mastery'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\tpassive_ltng_pierce\tstat('passive_ltng_pierce'.accr)\tpassive_cold_pierce\tstat('passive_cold_pierce'.accr)\tpassive_pois_pierce\tstat('passive_pois_pierce'.accr)\tbladecreeper\tassassintrap\t5\tS1\tBlade Sentinel\tlvl\t\t\t\t\t\t\t\t\t\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t25\t\t1\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\tDuration\t\t\t\t\t100\tDuration baseline\t12\tDuration per level\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t96\t6\t3\t4\t5\t5\t5\t10\t3\t4\t5\t5\t5\t(skill('Blade Fury'.blvl)+skill('Blade Shield'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t3\t384\t3000\t0\n";
-                ss << u8"Quickness\t258\tass\tquickness\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tquickness\t\tln56\t\tvelocitypercent\tdm12\tattackrate\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_quickness\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tClaw Mastery\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t10\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tVelocity % Min\t70\tVelocity % Max\t15\tAttack Speed % Min\t60\tAttack Speed % Max\t3000\tDuration baseline\t300\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t384\t3000\t0\n";
-                ss << u8"Fists of Fire\t259\tass\tfists of fire\t23\t35\t\t1\t143\t38\t39\t\tpar1\tpar2\t4\t\t\t\t\t\tfistsoffirefirewall\t\t\t\tprogressive_fire\t\tpar3\t\tprogressive_fire\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\t9\t\t\tfistsoffireexplode\tfistsoffirefirewall\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t3\th2h\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t16\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t1\t\tlvl*3\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t4\tRadius of explosion\t4\tRadius to create ground fire Missiles\t375\tDuration\t50\tAttack Rating % per Charge\t1\tFreeze Length Divisor (Freeze Length = Cold Length / Freeze Length Divisor) (Used only if Etype = cold)\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t6\t5\t10\t20\t30\t40\t10\t5\t11\t22\t33\t44\t(skill('Royal Strike'.blvl)) * par8\t\t\t\t\t\t4\t\t384\t3000\t0\n";
-                ss << u8"Dragon Claw\t260\tass\tdragon claw\t25\t46\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_kick_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t3\th2h\t\t\t\t\th2h\t\t\t\t\tSQ\tA1\txx\t16\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tDragon Talon\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t1\t0\t1\t\t\t\tln12 + skill('Claw Mastery'.blvl)*par7\tDamage %\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t50\tDamage % baseline\t15\tDamage % per level\t\t\t\t\t\t\t\t\t4\tDamage synergy\t1\tAlways Hit (0 = disabled | 1 = enabled only when Charges are consumed)\t\t\t\t\t\t\t\t\t1\t40\t25\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t\t384\t3000\t0\n";
-                ss << u8"Charged Bolt Sentry\t261\tass\tcharged bolt sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\tpassive_ltng_pierce\tstat('passive_ltng_pierce'.accr)\tpassive_ltng_mastery\tstat('passive_ltng_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tchargeboltsentry\tassassintrap\t5\tS1\tBoltSentry\tlvl\tFire Trauma\tskill('Fire Trauma'.blvl)\tShock Field\tskill('Shock Field'.blvl)\tLightning Sentry\tskill('Lightning Sentry'.blvl)\tDeath Sentry\tskill('Death Sentry'.blvl)\t\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tShock Field\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar1 + skill('Lightning Sentry'.blvl)/par7\t# of shots\t\t\t\t\t5\t# of shots (must match BoltSentry Param8)\t\t\t5\t# of Bolt Missiles created baseline (must match BoltSentry Param1)\t0\t# of Bolt Missiles created per level (must match BoltSentry Param2)\t\t\t3\tBonus bolt Missiles created per # levels synergy\t4\tBonus shot per # levels synergy\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t2\t0\t0\t0\t0\t0\t14\t6\t8\t12\t14\t16\t(skill('Fire Trauma'.blvl) + skill('Lightning Sentry'.blvl)) * par8\t\t\t\t\t\t3\t\t512\t3000\t0\n";
-                ss << u8"Wake of Fire Sentry\t262\tass\twake of fire sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twakeofdestruction\tassassintrap\t5\tS1\tWake Of Destruction Sentry\tlvl\tFire Trauma\tskill('Fire Trauma'.blvl)\tInferno Sentry\tskill('Inferno Sentry'.blvl)\t\t\t\t\t32\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tFire Trauma\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match Wake of Destruction Sentry Param8)\t\t\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t5\t2\t3\t5\t7\t9\t10\t2\t3\t6\t8\t10\t(skill('Fire Trauma'.blvl) + skill('Inferno Sentry'.blvl)) * par8\t\t\t\t\t\t3\t\t512\t3000\t0\n";
-                ss << u8"Weapon Block\t263\tass\tweapon block\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweaponblock\th2h\t\tpassive_weaponblock\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\th2h\t\t\t\t\th2h\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tClaw Mastery\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tBlock % chance Min\t65\tBlock % chance Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t\t512\t3000\t0\n";
-                ss << u8"Cloak of Shadows\t264\tass\tcloak of shadows\t\t47\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t57347\tcloak_of_shadows\tcloaked\tln34\tdm12\tskill_armor_percent\t\"-min(ln56,95)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_armor_percent\tln78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tPsychic Hammer\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tRadius Min\t30\tRadius Max\t200\tDuration baseline\t25\tDuration per level\t15\tArmor % reduction baseline\t3\tArmor % reduction per level\t10\tArmor % bonus baseline\t3\tArmor % bonus per level\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\t512\t8000\t0\n";
-                ss << u8"Cobra Strike\t265\tass\tcobra strike\t23\t34\t\t\t\t\t\t\t\t\t2\t\t\t\t\t\t\t\t\t\tprogressive_steal\t\tpar3\t\tprogressive_steal\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcobrastrike1\tassassin_chargeup_cobra_1\t\t\t\t\t\t\t13\t13\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tTiger Strike\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t1\t\tln12\tLifesteal %\t\t\t\t\t\t\t\t\t\t\t40\tLifesteal % baseline\t5\tLifesteal % per level\t375\tDuration\t50\tAttack Rating % per Charge\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t\t512\t8000\t0\n";
-                ss << u8"Blade Fury\t266\tass\tblade fury\t26\t48\t\t\t\t\t\tpar4\t\t\t\t\t\t\tbladefragment1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t6\t\t\t\t\t\tbladefragment2\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\tSC\t23\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tBlade Sentinel\tWake of Fire Sentry\t\t\t\t\t\t\t\t1\t1\t1\t\t1\t6\t0\t5\t8\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tMin Mana required to cast\t5\tDelay between Missiles created\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\tlvl*10\t\t\t\t\t8\t96\t8\t3\t5\t8\t8\t8\t10\t3\t5\t8\t8\t8\t(skill('Blade Sentinel'.blvl)+skill('Blade Shield'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t\t640\t8000\t0\n";
-                ss << u8"Fade\t267\tass\tfade\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfade\t\tln56\t\tfireresist\tdm12\tcoldresist\tdm12\tlightresist\tdm12\tpoisonresist\tdm12\tcurse_resistance\tdm34\tdamageresist\tln78\t\t\t\t\t\t\t\t\t\tfade\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_fade\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tQuickness\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t10\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tElemental Resistance % Min\t75\tElemental Resistance % Max\t40\tCurse Length % Reduction Min\t90\tCurse Length % Reduction Max\t3000\tDuration baseline\t300\tDuration per level\t1\tDamage Resistance % baseline\t1\tDamage Resistance % per level\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t640\t8000\t0\n";
-                ss << u8"Shadow Warrior\t268\tass\tshadow warrior\t\t49\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tshadowwarrior\t\t\t\ttohit\tlvl*par2\tskill_armor_percent\tlvl*par3\tstrength\tlvl*10\tdexterity\tlvl*10\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\t\"min(lvl*4,75)\"\tcoldresist\t\"min(lvl*4,75)\"\tlightresist\t\"min(lvl*4,75)\"\tpoisonresist\t\"min(lvl*4,75)\"\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\tshadowwarrior\tshadowwarrior\t1\tNU\t\t\t\t\t\t\t\t\t\t\t42\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCloak of Shadows\tWeapon Block\t\t\t\t\t\t15\t\t0\t1\t\t\t\t\t1\t7\t54\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tHP % per level\t40\tAttack Rating % per level\t12\tArmor % per level\t\t\t18\tMagic Item Level baseline\t2\tMagic Item Level per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\t640\t16000\t0\n";
-                ss << u8"Claws of Thunder\t269\tass\tclaws of thunder\t23\t35\t\t1\t\t36\t37\t\t\tpar1\t4\t\t\t\t\tclawsofthundernova\tclawsofthunderbolt\t\t\t\tprogressive_lightning\t\tpar3\t\tprogressive_lightning\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t11\t\t\tclawsofthundernova\tclawsofthunderbolt\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t3\th2h\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t16\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tFists of Fire\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t1\t\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t4\tMissiles created modifier for 3 Charges (used as 64/#=Total Charged Bolts created)\t\t\t375\tDuration\t50\tAttack Rating % per Charge\t1\tFreeze Length Divisor (Freeze Length = Cold Length / Freeze Length Divisor) (Used only if Etype = cold)\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t80\t20\t40\t60\t80\t100\t(skill('Royal Strike'.blvl)) * par8\t\t\t\t\t\t4\t\t640\t16000\t0\n";
-                ss << u8"Dragon Tail\t270\tass\tdragon tail\t27\t50\t\t\t\t\t\t\t\t\t\t\t\t\tdragontail missile\t\t\t\t\t\t\t\t\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_kick_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\t7\t\t\t\t\t\tdragontail missile\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t4\t\t\t\t\t\t\t\t\t\t\tKK\tKK\tA1\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tDragon Claw\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t10\t0\t\t\t\t\t\t1\t0\t1\t\t\t\tln12\tDamage %\t\t\t\t\t\t\t\t\t\t\t50\tDamage % baseline\t20\tDamage % per level\t6\tRadius\t-40\tAttack Speed % Reduction\t\t\t\t\t\t\t1\tAlways Hit (0 = disabled | 1 = enabled only when Charges are consumed)\t\t\t\t\t\t\t\t\t1\t20\t15\t\t\t\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t\t640\t16000\t0\n";
-                ss << u8"Lightning Sentry\t271\tass\tlightning sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\tpassive_ltng_pierce\tstat('passive_ltng_pierce'.accr)\tpassive_ltng_mastery\tstat('passive_ltng_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightningsentry\tassassintrap\t5\tS1\tsentry lightning\tlvl\tShock Field\tskill('Shock Field'.blvl)\tCharged Bolt Sentry\tskill('Charged Bolt Sentry'.blvl)\tDeath Sentry\tskill('Death Sentry'.blvl)\t\t\t\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCharged Bolt Sentry\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t# of shots (must match sentry lightning Param8)\t\t\t\t\t\t\t\t\t\t\t\t\t18\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t20\t10\t16\t24\t34\t44\t(skill('Shock Field'.blvl) + skill('Charged Bolt Sentry'.blvl))*par8\t\t\t\t\t\t3\t\t768\t16000\t0\n";
-                ss << u8"Inferno Sentry\t272\tass\tinferno sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tinfernosentry\tassassintrap\t5\tS1\tmon inferno sentry\tlvl\tFire Trauma\tskill('Fire Trauma'.blvl)\tWake of Fire Sentry\tskill('Wake of Fire Sentry'.blvl)\tDeath Sentry\tskill('Death Sentry'.blvl)\t\t\t32\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tWake of Fire Sentry\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t# of shots (must match mon inferno sentry Param8)\t\t\t40\tRange (Duration of missile) baseline (must match mon inferno sentry Param3)\t0\tRange (Duration of missile) per level (must match mon inferno sentry Param4)\t\t\t\t\t\t\t18\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t20\t17\t21\t26\t32\t39\t50\t19\t23\t28\t34\t41\t(skill('Fire Trauma'.blvl) + skill('Wake of Fire Sentry'.blvl))*par8\t\t\t\t\t\t3\t\t768\t32000\t0\n";
-                ss << u8"Mind Blast\t273\tass\tmind blast\t\t51\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t33667\t\t\t\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_psychichammer\t\t\t\t\t\t\tfist_will_cast\t\t\t\t\t\t\t\t8\t\t\t\t\t\tmindblast center\tmindblast hit\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCloak of Shadows\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t0\t1\t\t\t\t\t\t\t\t\t\t\tdm56+skill('Psychic Hammer'.blvl)*par8\t% chance for conversion\tpar3\tDuration for conversion\t\t\t\t\t\t\t\t\t50\tStun Length baseline\t5\tStun Length per level\t150\tDuration of conversion\t100\tDuration of conversion random bonus range (from 0 to #)\t15\t% chance for conversion Min\t40\t% chance for conversion Max\t4\tRadius\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t9\t\t\t\t8\t\t10\t2\t5\t8\t8\t8\t20\t2\t5\t8\t8\t8\t\tstun\t\t\t\t\t\t\t\t\t\t\t\t\t\t50\t5\t5\t5\t\t11\t\t768\t32000\t0\n";
-                ss << u8"Blades of Ice\t274\tass\tblades of ice\t23\t35\t\t1\t\t38\t39\t\tpar1\tpar2\t4\t\t\t\t\t\tbladesoficecubes\t\t\t34571\tprogressive_cold\t\tpar3\t\tprogressive_cold\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\t9\t\t\tbladesoficeexplode\tbladesoficecubes\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t3\th2h\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t16\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tClaws of Thunder\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t1\t\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t6\tRadius for 2 Charges\t3\tRadius for 3 Charges\t375\tDuration\t50\tAttack Rating % per Charge\t1\tFreeze Length Divisor (Freeze Length = Cold Length / Freeze Length Divisor) (Used only if Etype = cold)\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t15\t8\t10\t20\t30\t40\t35\t8\t10\t22\t32\t42\t(skill('Royal Strike'.blvl)) * par8\t100\t10\t10\t10\t\t4\t\t768\t32000\t0\n";
-                ss << u8"Dragon Flight\t275\tass\tdragon flight\t12\t52\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tsorceress_teleport\t\t\t\t\t\t\tdragonflight\t\t\t\t\t\t\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t1\t0\t\trng\t4\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t21\t\t\t\t\t\t\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tDragon Tail\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t15\t0\t\t\t\t\t\t1\t0\t1\t\t\t\tln12\tDamage %\t\t\t\t\t\t\t\t\t\t\t100\tDamage % baseline\t35\tDamage % per level\t\t\t\t\t\t\t\t\t38\tRange\t1\tAlways Hit (0 = disabled | 1 = enabled only when Charges are consumed)\t\t\t\t\t\t\t\t\t1\t60\t25\t\t\t\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t13\t\t768\t32000\t0\n";
-                ss << u8"Death Sentry\t276\tass\tdeath sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\tpassive_ltng_pierce\tstat('passive_ltng_pierce'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\tpassive_ltng_mastery\tstat('passive_ltng_mastery'.accr)\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdeathsentry\tassassintrap\t5\tS1\tmon death sentry\tlvl\tdeath sentry ltng\tlvl\tFire Trauma\tskill('Fire Trauma'.blvl)\tLightning Sentry\tskill('Lightning Sentry'.blvl)\t\t\t32\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tLightning Sentry\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match death sentry ltng Param8 & mon death sentry Param8)\t\t\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t50\t8\t14\t22\t28\t34\t(skill('Lightning Sentry'.blvl))*par8\t\t\t\t\t\t3\t\t896\t64000\t0\n";
-                ss << u8"Blade Shield\t277\tass\tblade shield\t28\t54\t\t\t\t\t\t\t\t\t\t\t\t\tblade shield attachment\t\t\t\t\t33667\tbladeshield\t\tln12\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_bladeshield\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tBlade Fury\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t27\t2\t1\t1\t\t1\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3000\tDuration baseline\t300\tDuration per level\t25\tPeriodic Damage Delay\t6\tRadius\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t32\t\t3\t\t8\t96\t1\t5\t6\t7\t7\t7\t30\t5\t6\t7\t7\t7\t(skill('Blade Sentinel'.blvl)+skill('Blade Fury'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t896\t64000\t0\n";
-                ss << u8"Venom\t278\tass\tvenom\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvenomclaws\t\tln12\t\tpoisonmindam\tenms\tpoisonmaxdam\texms\tskill_poison_override_length\tedma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_venom\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tFade\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t12\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3000\tDuration baseline\t300\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t24\t6\t8\t10\t12\t14\t32\t6\t8\t10\t12\t14\t\t10\t\t\t\t\t1\t\t896\t64000\t0\n";
-                ss << u8"Shadow Master\t279\tass\tshadow master\t\t49\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tshadowwarrior\t\t\t\ttohit\tlvl*par2\tstrength\tlvl*10\tdexterity\tlvl*10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\tdm34\tcoldresist\tdm34\tlightresist\tdm34\tpoisonresist\tdm34\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\tshadowmaster\tshadowwarrior\t1\tNU\t\t\t\t\t\t\t\t\t\t\t42\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tShadow Warrior\t\t\t\t\t\t\t15\t\t0\t1\t\t\t\t\t1\t7\t70\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tHP % per level\t40\tAttack Rating % per level\t5\tResistance % Min\t90\tResistance % Max\t24\tMagic Item Level baseline\t3\tMagic Item Level per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\t896\t64000\t0\n";
-                ss << u8"Royal Strike\t280\tass\troyal strike\t23\t34\t\t\t40\t143\t41\t\tpar6\tpar5\t\t\t\t\troyalstrikemeteorcenter\troyalstrikechainlightning\troyalstrikechaosice\t\t\t\tprogressive_other\t\t375\tpar1\tprogressive_other\t\tprogressive_tohit\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t83\t15\t\troyalstrikemeteorcenter\troyalstrikechainlightning\troyalstrikechaosice\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tCobra Strike\tBlades of Ice\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t1\t\tpar2\tMeteor Explosion Radius\t\t\t\t\t\t\t\t\t\t\t8\tChain Lightning Radius of jump to next target\t6\tMeteor Explosion Radius\t30\tDuration of ground fire baseline\t15\tDuration of ground fire per level\t16\t# of Ice Bolt Missiles created\t10\t\"Chain Lightning Missiles Created Modifier (used as 64/#=Total Chain Lightning Missiles created) (if <=0, then use AuraRangeCalc)\"\t25\tAttack Rating % per Charge\t\t\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t-3\t896\t64000\t0\n";
-                ss << u8"Wake Of Destruction Sentry\t281\t\t\t\t125\t\t\t\t\t\t\t\t\t\t\t\t\twake of destruction maker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t70\t\t\t\t\t\twake of destruction maker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar8\t# of shots\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match Wake of Fire Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Imp Inferno\t282\t\t\t59\t126\t\t\t\t\t\t\t\t\t\t\t\t\timpinfernoflame1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t71\t\t\t\t\t\timpinfernoflame1\timpinfernoflame2\t\t\t8\tMissile Z Offset\tlvl-1\tRange per level (Duration of missile)\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t6\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\"rand(par3,par4)\"\tAnim Frame Adder (Min=1)\tlvl-1\tRange per level (Duration of missile)\t\t\t\t\t\t\t\t\t30\tRange baseline (Duration of missile)\t\t\t100\tAnim Frame Adder Min\t120\tAnim Frame Adder Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t18\t15\t15\t15\t15\t15\t37\t15\t15\t15\t15\t15\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Imp Fireball\t283\t\t\t\t\t\t\t\t\t\t\t\t\t\timpfireball\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t72\t\t\t\t\t\timpfireball\t\t\t\t40\tMissile Z Offset\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Baal Taunt\t284\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tbaal taunt control\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_baal_taunt_1\t\t\t\t46\t\t\t\t\t\t\tbaal taunt control\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t3\tDelay in lightning \t45\tDelay in poison clouds\t\t\t\t\t\t\t\t\t45\tDelay in poison clouds\t3\tDelay in lightning \t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Baal Corpse Explode\t285\t\t\t\t141\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS3\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage % of base HP for enemy Min\t0\tDamage % of base HP for enemy Max\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t6\tExplosion Radius (half squares) baseline\t1\tExplosion Radius (half squares) per level\t40\tRadius to search for corpses baseline\t0\tRadius to search for corpses per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Baal Monster Spawn\t286\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal spawn monsters\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal spawn monsters\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS3\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Catapult Charged Ball\t287\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapultchargedball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapultchargedball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t# of Bolt Missiles created (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Catapult Spike Ball\t288\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapult spike ball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapult spike ball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\t# of Spike Missiles created (Min=1)\t\t\t\t\t20\t# of Spike Missiles created baseline\t5\t# of Spike Missiles created per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Suck Blood\t289\t\t\t60\t127\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tHeal % based on Damage Dealt\t0\tLifesteal %\t0\tManasteal %\t\t\t\t\t\t\t25\tHeal % based on Damage Dealt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t1\t\t\t\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Cry Help\t290\t\t\t\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcurseattract\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\tDuration\t\t\t\t\t\t\t\t\t\t\t100\tDuration baseline\t20\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Healing Vortex\t291\t\t\t\t\t\t\t\t\t\t\t\t\t\thealing vortex\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\thealing vortex\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t5\t5\t5\t5\t5\t20\t5\t5\t5\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Teleport 2\t292\t\t\t\t98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t73\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Self-resurrect\t293\t\t\t61\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t38\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Vine Attack\t294\t\t\t\t130\t\t\t\t\t\t\t\t\t\t\t\t\tplague vines\t\t\t\t\t\t\tslowed\t\t\tvelocitypercent\t-100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruidpod_attack_1\tdruidpod_walk1_1\tdruidpod_neutral_1\t\t\t\t\t\t\t\t49\t\t\t\t\t\t\tvine beast attack\tvines\tvine beast walk 1\tvine beast neutral\t\"min(ln12,12)\"\t# of vine Missiles created\t35\tMissile Delay\t6\tMin Distance between Missiles\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\"min(ln12,24)\"\t# of Missiles created\t\t\t\t\t20\tFrames to apply aura to target (Min=5)\t\t\t\t\t3\t# of Missiles created baseline\t1\t# of Missiles created per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Overseer Whip\t295\t\t\t\t131\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbloodlust\tpar2\t\tvelocitypercent\tpar3\tattackrate\tpar4\tskill_armor_percent\tpar5\tdamagepercent\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsuicideminion1\t\t\tS1\t\t\t\t\t\t\t\t\t\t\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t% chance to get Bloodlust\t\t\t\t\t\t\t\t\t\t\t65\t% chance to get Bloodlust\t250\tBloodlust Duration\t80\tVelocity %\t80\tAttack Speed %\t50\tArmor %\t100\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Barbs Aura\t296\t\t\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t65795\tbarbscontrol\tbarbs\t\tln12\titem_attackertakesdamage\tedmn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tRadius baseline (must match Spirit of Barbs Param7)\t2\tRadius per level (must match Spirit of Barbs Param8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t32\t9\t18\t27\t36\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Wolverine Aura\t297\t\t\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t65795\twolverinecontrol\twolverine\t\tln12\titem_tohit_percent\tln34\tdamagepercent\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tRadius baseline (must match Heart of Wolverine Param7)\t2\tRadius per level (must match Heart of Wolverine Param8)\t25\tAttack Rating % baseline (must match Heart of Wolverine Param3)\t7\tAttack Rating % per level (must match Heart of Wolverine Param4)\t20\tDamage % baseline (must match Heart of Wolverine Param5)\t7\tDamage % per level (must match Heart of Wolverine Param6)\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Oak Sage Aura\t298\t\t\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t65795\toaksagecontrol\toaksage\t\tln12\titem_maxhp_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tRadius baseline (must match Oak Sage Param7)\t2\tRadius per level (must match Oak Sage Param8)\t30\tHP % baseline (must match Oak Sage Param1)\t5\tHP % per level (must match Oak Sage Param2)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Imp Fire Missile\t299\t\t\t\t132\t\t\t\t\t\t\t\t\t\t\t\t\timpmiss21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfist_will_cast\t\t\t\t\t\t\t\t\timpmiss21\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Impregnate\t300\t\t\t\t133\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpainworm1\t\t\tNU\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Siege Beast Stomp\t301\t\t\t\t134\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsiege_beast_dust\t\t\t\t75\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA2\tA2\tA2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tCamera Screen Shake Magnitude\t5\tCamera Screen Shake Build Up Duration\t20\tCamera Screen Shake Loop Duration\t15\tCamera Screen Shake Fade Duration\t25\tRadius\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t1\t\t\t\t8\t\t20\t10\t10\t10\t10\t10\t60\t10\t10\t10\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MinionSpawner\t302\t\t\t62\t135\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspawnedminion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"CatapultBlizzard\t303\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapult cold ball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapult cold ball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"CatapultPlague\t304\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapult plague ball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapult plague ball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"CatapultMeteor\t305\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapult meteor ball\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapult meteor ball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tExplosion Radius\t\t\t50\tDuration of ground fire baseline\t3\tDuration of ground fire per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"BoltSentry\t306\t\t\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\tsentrychargedbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t\t\t\t\t\tsentrychargedbolt\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln12 + skill('Shock Field'.blvl)/skill('Charged Bolt Sentry'.par6)\t# of Bolt Missiles created\t\t\t\t\tpar8 + skill('Lightning Sentry'.blvl)/skill('Charged Bolt Sentry'.par7)\t# of shots\t\t\t\t\t5\t# of Bolt Missiles created baseline (must match Charged Bolt Sentry Param3)\t0\t# of Bolt Missiles created per level (must match Charged Bolt Sentry Param4)\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match Charged Bolt Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"CorpseCycler\t307\t\t\t63\t\t\t\t\t\t\t\t\t\t\t\t\t\trecycler delay\t\t\t\t\t\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t49\t\t\t93\t\t\t\tvine beast attack\trecycler delay\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln12\tLifesteal %\tdm34\tManasteal %\t\t\t\t\t\t\t\t\t4\tLifesteal % baseline (must match CorpseCycler Param5)\t1\tLifesteal % per level (must match CorpseCycler Param6)\t0\tManasteal % Min\t0\tManasteal % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"DeathMaul\t308\t\t\t\t136\t\t\t\t\t\t\t\t\t\t\t\t\tdeath mauler\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t76\t\t\t\t\t\tdeath mauler\tdeath mauler trail\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t96\tMissile Anim Rate\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t4\t4\t4\t4\t4\t20\t4\t4\t4\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Defense Curse\t309\t\t\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tdefense_curse\tln34\tln12\tskill_armor_percent\t-ln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseeffectred\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tRadius baseline\t1\tRadius per level\t200\tDuration baseline\t75\tDuration per level\t50\tDefense % baseline\t5\tDefense % per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Blood Mana\t310\t\t\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tblood_mana\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseeffectred\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tRadius baseline\t1\tRadius per level\t200\tDuration baseline\t75\tDuration per level\t40\t\"Max HP Limit (If target HP reaches this value or lower, then remove the Curse)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t4\t4\t4\t4\t4\t20\t4\t4\t4\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"mon inferno sentry\t311\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tinferno sentry 1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t52\t77\t\t\t\t\t\tinferno sentry 1\tinferno sentry 2\t\t\t-37\tMissile Z Offset\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln34/2 + skill('Wake of Fire Sentry'.blvl)\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1 + skill('Wake of Fire Sentry'.blvl)\tAnim Frame Adder (Min=1)\t3\tAnim Frame Density (Min=1)\tpar8\t# of shots\t\t\t\t\t15\tAnim Frame Adder (Min=1)\t\t\t40\tRange (Duration of missile) baseline\t0\tRange (Duration of missile) per level\t\t\t\t\t\t\t10\t# of shots (must match Inferno Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"mon death sentry\t312\t\t\t\t55\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\tdeath_sentry\t\t\t50\t78\t\t\t\t\t\tcorpseexplosion\tdeathsentryexplode\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage % of base HP for enemy Min\tpar2\tDamage % of base HP for enemy Max\tpar5\t% Damage Dealt as Elemental\tpar8 + skill('Fire Trauma'.blvl)/3\t# of shots\t\t\t\t\t40\tDamage % of base HP for enemy Min \t80\tDamage % of base HP for enemy Max\t10\tRadius (half squares)\t1\tRadius per level (half squares)\t50\tDamage % Dealt as Elemental\t\t\t\t\t5\t# of shots (must match Death Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"sentry lightning\t313\t\t\t\t\t\t\t\t\t\t\t\t\t\tsentrylightningbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsentrylightningbolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar8\t# of Missiles shot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t# of shots (must match Lightning Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"fenris rage\t314\t\t\t\t137\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfenris_rage\t\tpar1\t\tdamagepercent\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\t\t\t\t\t\t\t\t\t\t51\t79\t\t\t\t\t\tcorpseexplosion\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t500\tDuration\t100\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Baal Tentacle\t315\t\t\t\t140\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Baal Nova\t316\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tbaal nova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal_novacast\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t25\t\t\t\t\t\tbaal nova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tS3\tS3\tS3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t50\t24\t32\t32\t32\t32\t75\t24\t32\t32\t32\t32\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Baal Inferno\t317\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tbaal inferno\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal_missilecast\t\t\t\t\t\t\t\t\t\t\t\t\t\t54\t54\t\t\t\t\t\tbaal inferno\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t2\tAnim Frame Density (Min=1)\t\t\t\t\t\t\t20\tAnim Frame Adder (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t64\t48\t48\t48\t48\t48\t96\t48\t48\t48\t48\t48\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Baal Cold Missiles\t318\t\t\t\t139\t\t\t\t\t\t\t\t\t\t\t\t\tbaal cold maker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal_coldtrailcast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t81\t\t\t\t\t\tbaal cold maker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t20\t9\t13\t13\t13\t13\t40\t9\t13\t13\t13\t13\t\t200\t50\t50\t50\t\t\t\t\t0\t0\n";
-                ss << u8"MegademonInferno\t319\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tmegademoninferno\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t54\t54\t\t\t\t\t\tfetishinferno1\tfetishinferno2\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t2\tAnim Frame Density (Min=1)\t\t\t\t\t\t\t15\tAnim Frame Adder (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"EvilHutSpawner\t320\t\t\t49\t91\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspawnedflames\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"CountessFirewall\t321\t\t\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\tcountessfirewallmaker\tcountessfirewall\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t26\t\t\t\t\t\tcountessfirewallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t0\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"ImpBolt\t322\t\t\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\timp charged bolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t\t\t\t\t\timp charged bolt\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl+2\t# of Bolt Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Horror Arctic Blast\t323\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tfrozenhorror arcticblast1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t54\t54\t\t\t\t\t\tfrozenhorror arcticblast1\tfrozenhorror arcticblast1\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t2\tAnim Frame Density (Min=1)\t\t\t\t\t\t\t15\tAnim Frame Adder (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"death sentry ltng\t324\t\t\t\t\t\t\t\t\t\t\t\t\t\tsentrylightningbolt2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsentrylightningbolt2\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match Death Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"VineCycler\t325\t\t\t63\t\t\t\t\t\t\t\t\t\t\t\t\t\tvine recycler delay\t\t\t\t\t\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t49\t\t\t93\t\t\t\tvine beast attack\trecycler delay\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\tln12\tManasteal %\t\t\t5\tFrames to apply aura to target (Min=5)\t\t\t\t\t4\tManasteal % baseline (must match Vines Param5)\t1\tManasteal % per level (must match Vines Param6)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"BearSmite\t326\t\t\t32\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruidbear_attack_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t9\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\t\"max(250,ln12)\"\tStun Length\t0\tAttack Speed %\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t15\tStun Length baseline\t5\tStun Length per level\t15\tDamage % baseline\t15\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t8\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Resurrect2\t327\t\t\t\t97\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\thealing\t\t\t39\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t1\t1\t1\t\t1\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"BloodLordFrenzy\t328\t\t\t64\t109\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonfrenzy\t\tln12\t\tvelocitypercent\tdm34\tattackrate\tdm34\tother_animrate\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweapon_giant_1\t\t1\t\tweapon_giant_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t200\tDuration baseline\t25\tDuration per level\t30\tSpeed % Min\t110\tSpeed % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Baal Teleport\t329\t\t\t\t98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t73\t\t\t\t\t\t\tbaalteleport\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Imp Teleport\t330\t\t\t\t129\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tattached\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_teleport\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t74\t\t\t\t\t\timp teleport\timp teleport\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Baal Clone Teleport\t331\t\t\t\t98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t73\t\t\t\t\t\tbaalclonedeath\tbaalteleport\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"ZakarumLightning\t332\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonsterlight\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t\t\t\t\t\tmonsterlight\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"VampireMissile\t333\t\t\t\t\t\t\t\t\t\t\t\t\t\tfirehead\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfirehead\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MephistoMissile\t334\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tA2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"DoomKnightMissile\t335\t\t\t\t148\t\t\t\t\t\t\t\t\t\t\t\t\tundeadmissile1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t94\t\t\t\t\t\tundeadmissile1\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"RogueMissile\t336\t\t\t\t110\t\t\t\t\t\t\t\t\t\t\t\t\trogue1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t66\t\t\t\t\t\trogue1\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"HydraMissile\t337\t\t\t\t\t\t\t\t\t\t\t\t\t\thydra\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\thydra\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"NecromageMissile\t338\t\t\t\t149\t\t\t\t\t\t\t\t\t\t\t\t\tnecromage1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t95\t\t\t\t\t\tnecromage1\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonBow\t339\t\t\t4\t\t\t\t\t\t\t\t\t\t\tcr_arrow6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tcr_arrow6\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonFireArrow\t340\t\t\t4\t\t\t\t\t\t\t\t\t\t\tfirearrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tfirearrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t1\t8\t8\t8\t8\t8\t4\t9\t9\t9\t9\t9\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonColdArrow\t341\t\t\t4\t\t\t\t\t\t\t\t\t\t\tcoldarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tcoldarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t1\t7\t7\t7\t7\t7\t4\t8\t8\t8\t8\t8\t\t100\t25\t25\t25\t\t\t\t\t0\t0\n";
-                ss << u8"MonExplodingArrow\t342\t\t\t4\t\t\t\t\t\t\t\t\t\t\texplodingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\texplodingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t2\t8\t8\t8\t8\t8\t6\t9\t9\t9\t9\t9\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonFreezingArrow\t343\t\t\t4\t\t\t\t\t\t\t\t\t\t\tfreezingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tfreezingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tdamage radius\t\t\t\t\t\t\t\t\t\t\t5\tRadius of impact\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t2\t7\t7\t7\t7\t7\t6\t8\t8\t8\t8\t8\t\t100\t25\t25\t25\t\t\t\t\t0\t0\n";
-                ss << u8"MonPowerStrike\t344\t\t\t6\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t16\t12\t12\t12\t12\t12\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"SuccubusBolt\t345\t\t\t4\t\t\t\t\t\t\t\t\t\t\tsuccubusmiss\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tsuccubusmiss\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t10\t2\t4\t6\t6\t6\t15\t2\t5\t7\t7\t7\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MephFrostNova\t346\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tmephfrostnova\tmephfrostnova\tmephfrostnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tfrostnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tA2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t40\t20\t20\t20\t20\t20\t60\t20\t20\t20\t20\t20\t\t200\t50\t50\t50\t\t\t\t\t0\t0\n";
-                ss << u8"MonIceSpear\t347\t\t\t6\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t10\t8\t8\t8\t8\t8\t14\t9\t9\t9\t9\t9\t\t125\t25\t25\t25\t\t\t\t\t0\t0\n";
-                ss << u8"ShamanIce\t348\t\t\t\t\t\t\t\t\t\t\t\t\t\tglacialspike\t\t\t\t\t\t\t\t\t\t\tln34 * (100 + skill('Blizzard'.blvl) * par7) / 100\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tglacialspike\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t0\tRadius per level\t50\tFreeze Length baseline\t3\tFreeze Length per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t4\t10\t14\t14\t14\t14\t12\t10\t15\t15\t15\t15\t\t125\t50\t50\t50\t\t\t\t\t0\t0\n";
-                ss << u8"Diablogeddon\t349\t\t\t\t124\t\t\t\t\t\t\t\t\t\t\t\t\tdiablogeddoncontrol\tdiablogeddoncontrol\tdiablogeddoncontrol\t\t\t\tarmageddon\t\tln12\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_a\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t92\t\t\t\tdiablogeddontail\tdiablogeddonrock\t\t\t25\tMissile Frames\t25\tMissile Fall Rate\t15\tMissile Slide Rate\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS3\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1000\tDuration baseline\t50\tDuration per level\t8\tRadius\t8\tDelay between Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t4\t4\t6\t8\t10\t12\t16\t4\t7\t9\t12\t14\t\tfire\t25\t15\t20\t25\t30\t35\t75\t16\t22\t27\t33\t38\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Delerium Change\t350\t\tdelerium change\t\t116\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdelerium\t\t1500\t\tvelocitypercent\t33\tattackrate\t33\tother_animrate\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tNU\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tAllow Instant Direct Transformation\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"NihlathakCorpseExplosion\t351\t\t\t17\t55\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\"min(30,16+lvl)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_corpse_cast\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\t\t\t\t\t\t21\t32\t\t\t\t\t\tcorpseexplosion\texplodingarrowexp\tredlightmissile\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage % of base HP for enemy Min\tpar2\tDamage % of base HP for enemy Max\tpar5\t% Damage Dealt as Elemental\t\t\t\t\t\t\t10\tDamage % of base HP for enemy Min \t20\tDamage % of base HP for enemy Max\t\t\t\t\t50\tDamage % Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"SerpentCharge\t352\t\t\t31\t67\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t37\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t4\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\t0\tVelocity %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t150\tVelocity %\t\t\t0\tDamage % baseline\t0\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Trap Nova\t353\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\ttrapnova\ttrapnova\ttrapnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t25\t\t\t\t\t\ttrapnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"UnHolyBoltEx\t354\t\t\t\t\t\t\t\t\t\t\t\t\t\tunholybolt1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tunholybolt1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"ShamanFireEx\t355\t\t\t\t\t\t\t\t\t\t\t\t\t\tshafire1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tshafire1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Imp Fire Missile Ex\t356\t\t\t\t\t\t\t\t\t\t\t\t\t\timpmiss21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfist_will_cast\t\t\t\t\t\t\t\t\timpmiss21\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl-1\trange adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Interact\t357\t\tinteract\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Loot\t358\t\tloot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"TownPortal\t359\t\ttownportal\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"EmoteWheel\t360\t\temotewheel\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"SwapWeapons\t361\t\tswapweapons\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Map\t362\t\tmap\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"ShowItems\t363\t\tshowitems\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"RunToggle\t364\t\truntoggle\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"MonHolyFreeze\t365\t\t\t\t81\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t303747\tholywind\tholywindcold\t\tln12\tvelocitypercent\t-dm34\tattackrate\t-dm34\tother_animrate\t-dm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcoldmindam\tenms*par5/256\tcoldmaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t25\tSlow % Min\t60\tSlow % Max\t5\tDamage multiplier added to Attacks\t0\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t7\tDamage synergy\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t2\t1\t2\t3\t4\t5\t3\t1\t2\t3\t4\t5\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"MonLeap\t366\t\t\t40\t77\t\t\t\t\t\t\t\t\t\t\t\t\tleapknockback\t\t\t\t\t\t\t\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_leap_1\t\t\t\t\t\t\t\t\t\t\t\t\t29\t43\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t13\t\t1\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln34\tKnockback Radius\tpar7\tLeap Speed %\t\t\t\t\t\t\t\t\t4\tRange Min\t30\tRange Max\t4\tKnockback Radius baseline\t1\tKnockback Radius per level\t\t\t\t\t100\tLeap Speed %\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"MonLeapAttack\t367\t\t\t41\t78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbash\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_leapattack_1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\tmele\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t14\t\t1\t\t4\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\tpar7\tLeap Speed %\t\t\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t100\tDamage % baseline\t30\tDamage % per level\t\t\t\t\t100\tLeap Speed %\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n";
-                ss << u8"MonHolyFire\t368\t\t\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\tholyfire\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfiremindam\tenms*par5/256\tfiremaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t\t\t\t\t6\tDamage multiplier added to Attacks\t0\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t6\tDamage synergy\t18\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t2\t1\t2\t3\t5\t7\t6\t1\t2\t3\t5\t7\t\t\t\t\t\t\t\t\t384\t3000\t0\n";
-                ss << u8"MonHolyShock\t369\t\t\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\tholyshock\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightmindam\t1\tlightmaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t\t\t\t\t6\tDamage multiplier added to Attacks\t0\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t4\tDamage synergy\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t\t\t\t\t\t10\t6\t8\t10\t12\t15\t\t\t\t\t\t\t\t\t768\t32000\t0\n";
-                ss << u8"CubeLoot\t370\t\tcubeloot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n";
-                ss << u8"Mark of the Bear\t371\t\tmark of the bear\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmarkbear\t\t4500\t\tattackrate\tpar1\tdamageresist\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t2\tbear\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\tAttack Speed %\t20\tDamage Resist %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                ss << u8"Mark of the Wolf\t372\t\tmark of the wolf\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmarkwolf\t\t4500\t\titem_tohit_percent\tpar1\titem_maxhp_percent\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t2\twolf\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tAttack Rating %\t40\tLife %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"skill\t*Id\tcharclass\tskilldesc\tsrvstfunc\tsrvdofunc\tsrvstopfunc\tprgstack\tsrvprgfunc1\tsrvprgfunc2\tsrvprgfunc3\tprgcalc1\tprgcalc2\tprgcalc3\tprgdam\tsrvmissile\tdecquant\tlob\tsrvmissilea\tsrvmissileb\tsrvmissilec\tuseServerMissilesOnRemoteClients\tsrvoverlay\taurafilter\taurastate\tauratargetstate\tauralencalc\taurarangecalc\taurastat1\taurastatcalc1\taurastat2\taurastatcalc2\taurastat3\taurastatcalc3\taurastat4\taurastatcalc4\taurastat5\taurastatcalc5\taurastat6\taurastatcalc6\tauraevent1\tauraeventfunc1\tauraevent2\tauraeventfunc2\tauraevent3\tauraeventfunc3\tpassivestate\tpassiveitype\tpassivereqweaponcount\tpassivestat1\tpassivecalc1\tpassivestat2\tpassivecalc2\tpassivestat3\tpassivecalc3\tpassivestat4\tpassivecalc4\tpassivestat5\tpassivecalc5\tpassivestat6\tpassivecalc6\tpassivestat7\tpassivecalc7\tpassivestat8\tpassivecalc8\tpassivestat9\tpassivecalc9\tpassivestat10\tpassivecalc10\tpassivestat11\tpassivecalc11\tpassivestat12\tpassivecalc12\tpassivestat13\tpassivecalc13\tpassivestat14\tpassivecalc14\tsummon\tpettype\tpetmax\tsummode\tsumskill1\tsumsk1calc\tsumskill2\tsumsk2calc\tsumskill3\tsumsk3calc\tsumskill4\tsumsk4calc\tsumskill5\tsumsk5calc\tsumumod\tsumoverlay\tstsuccessonly\tstsound\tstsoundclass\tstsounddelay\tweaponsnd\tdosound\tdosound a\tdosound b\ttgtoverlay\ttgtsound\tprgoverlay\tprgsound\tcastoverlay\tcltoverlaya\tcltoverlayb\tcltstfunc\tcltdofunc\tcltstopfunc\tcltprgfunc1\tcltprgfunc2\tcltprgfunc3\tcltmissile\tcltmissilea\tcltmissileb\tcltmissilec\tcltmissiled\tcltcalc1\t*cltcalc1 desc\tcltcalc2\t*cltcalc2 desc\tcltcalc3\t*cltcalc3 desc\twarp\timmediate\tenhanceable\tattackrank\tnoammo\trange\tweapsel\titypea1\titypea2\titypea3\tetypea1\tetypea2\titypeb1\titypeb2\titypeb3\tetypeb1\tetypeb2\tanim\tseqtrans\tmonanim\tseqnum\tseqinput\tdurability\tUseAttackRate\tLineOfSight\tTargetableOnly\tSearchEnemyXY\tSearchEnemyNear\tSearchOpenXY\tSelectProc\tTargetCorpse\tTargetPet\tTargetAlly\tTargetItem\tAttackNoMana\tTgtPlaceCheck\tKeepCursorStateOnKill\tContinueCastUnselected\tClearSelectedOnHold\tItemEffect\tItemCltEffect\tItemTgtDo\tItemTarget\tItemUseRestrict\tItemCheckStart\tItemCltCheckStart\tItemCastSound\tItemCastOverlay\tskpoints\treqlevel\tmaxlvl\treqstr\treqdex\treqint\treqvit\treqskill1\treqskill2\treqskill3\trestrict\tState1\tState2\tState3\tlocaldelay\tglobaldelay\tleftskill\trightskill\trepeat\talwayshit\tusemanaondo\tstartmana\tminmana\tmanashift\tmana\tlvlmana\tinterrupt\tInTown\taura\tperiodic\tperdelay\tfinishing\tprgchargestocast\tprgchargesconsumed\tpassive\tprogressive\tscroll\tcalc1\t*calc1 desc\tcalc2\t*calc2 desc\tcalc3\t*calc3 desc\tcalc4\t*calc4 desc\tcalc5\t*calc5 desc\tcalc6\t*calc6 desc\tParam1\t*Param1 Description\tParam2\t*Param2 Description\tParam3\t*Param3 Description\tParam4\t*Param4 Description\tParam5\t*Param5 Description\tParam6\t*Param6 Description\tParam7\t*Param7 Description\tParam8\t*Param8 Description\tParam9\t*Param9 Description\tParam10\t*Param10 Description2\tParam11\t*Param11 Description\tParam12\t*Param12 Description\tInGame\tToHit\tLevToHit\tToHitCalc\tResultFlags\tHitFlags\tHitClass\tKick\tHitShift\tSrcDam\tMinDam\tMinLevDam1\tMinLevDam2\tMinLevDam3\tMinLevDam4\tMinLevDam5\tMaxDam\tMaxLevDam1\tMaxLevDam2\tMaxLevDam3\tMaxLevDam4\tMaxLevDam5\tDmgSymPerCalc\tEType\tEMin\tEMinLev1\tEMinLev2\tEMinLev3\tEMinLev4\tEMinLev5\tEMax\tEMaxLev1\tEMaxLev2\tEMaxLev3\tEMaxLev4\tEMaxLev5\tEDmgSymPerCalc\tELen\tELevLen1\tELevLen2\tELevLen3\tELenSymPerCalc\taitype\taibonus\tcost mult\tcost add\t*eol\n",
+                u8"Attack\t0\t\tattack\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tboth\t\tweap\t\t\ttpot\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t1\t1\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t1\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Kick\t1\t\tkick\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\th2h\t4\t\t\t\t\t\t\t\t\t\t\tKK\tKK\txx\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Throw\t2\t\tthrow\t65\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\trng\t\tthro\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Unsummon\t3\t\tunsummon\t3\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_unsummon\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Left Hand Throw\t4\t\tleft hand throw\t65\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\trng\t1\tthro\t\t\t\t\t\t\t\t\t\tS4\tS4\txx\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Left Hand Swing\t5\t\tleft hand swing\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tboth\t1\tweap\t\t\ttpot\t\t\t\t\t\t\tS3\tS3\tS3\t\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t1\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Magic Arrow\t6\tama\tmagic arrow\t\t\t\t\t\t\t\t\t\t\t\tmagicarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmagicarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t1\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t5\t12\t-1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t9\t\t\t\t\t\t8\t128\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Fire Arrow\t7\tama\tfire arrow\t4\t\t\t\t\t\t\t\t\t\t\tfirearrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tfirearrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t5\t24\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t10\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t1\t2\t3\t6\t12\t24\t4\t2\t3\t7\t14\t27\t(skill('Exploding Arrow'.blvl)) * par8\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Inner Sight\t8\tama\tinner sight\t\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34179\t\tinnersight\tln34\tln56\tarmorclass\t-edmn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_eyeofzeus\t\t\t\t\t\t\t\t\t\t\tcast_innersight\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tamazon_eyeofzeus\tcast_innersight\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t7\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tArmor Reduction baseline\t25\tArmor Reduction per level\t200\tDuration baseline\t100\tDuration per level\t27\tRadius baseline\t0\tRadius per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\t25\t45\t60\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Critical Strike\t9\tama\tcritical strike\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcriticalstrike\t\t\tpassive_critical_strike\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\trng\t\tspea\tmiss\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tMin % Chance\t80\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Jab\t10\tama\tjab\t5\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_jab_1\t\t\t\tweapon_1ht_1\tweapon_2ht_1\t\t\t\t\t\t\t\t12\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t1\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t8\t1\t\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t-15\tDamage % baseline\t3\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Cold Arrow\t11\tama\tcold arrow\t4\t\t\t\t\t\t\t\t\t\t\tcoldarrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tcoldarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t5\t28\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t10\t9\t\t\t\t\t\t7\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t6\t4\t5\t8\t16\t42\t8\t4\t5\t9\t17\t44\t(skill('Ice Arrow'.blvl)) * par8\t100\t30\t30\t30\t\t\t\t384\t3000\t0\n",
+                u8"Multiple Shot\t12\tama\tmultiple shot\t4\t8\t\t\t\t\t\t\t\t\t\t\t1\t\tmultipleshotarrow\tmultipleshotbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t17\t\t\t\t\t\tmultipleshotarrow\tmultipleshotbolt\t\t\t\t\t\t\t\t\t\t\t1\t7\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tMagic Arrow\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t1\t1\t\t\t\t\t\t\t\t\t\t\t\"min(ln12,24)\"\t# of Missiles created\tpar3\tMissile Activation Frame\t2\t# of missiles that can trigger item modifier events\t\t\tskill('Guided Arrow'.blvl) * par4\t% Damage Synergy\t\t\t2\t# of Missiles created baseline\t1\t# of Missiles created per level\t1\tMissile Activation Frame\t12\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t96\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Dodge\t13\tama\tdodge\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdodge\t\t\tpassive_dodge\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_dodge_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tMin % Chance\t65\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t2\tAnim Mode (0 = enable uninterruptable Anim | 1 = disable Anim | 2 = enable interruptable anim)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Power Strike\t14\tama\tpower strike\t6\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tJab\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t8\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t12\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t16\t18\t36\t54\t72\t90\t(skill('Lightning Strike'.blvl)+skill('Lightning Bolt'.blvl)+skill('Charged Strike'.blvl)) * par8\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Poison Javelin\t15\tama\tpoison javelin\t4\t\t\t\t\t\t\t\t\t\t\tpoisonjav\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_cast_poison\t\t1\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tpoisonjav\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\trng\t\tjave\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t15\t\t1\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t0\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t32\t16\t32\t48\t64\t96\t48\t16\t36\t52\t68\t100\t(skill('Plague Javelin'.blvl)) * par8\t200\t50\t50\t50\t\t\t\t384\t3000\t0\n",
+                u8"Exploding Arrow\t16\tama\texploding arrow\t4\t\t\t\t\t\t\t\t\t\t\texplodingarrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\texplodingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tFire Arrow\tMultiple Shot\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t5\t6\t12\t14\t16\t20\t13\t7\t13\t15\t18\t23\t(skill('Fire Arrow'.blvl)) * par8\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Slow Missiles\t17\tama\tslow missiles\t\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t50563\t\tslowmissiles\tln34\tln56\tskill_handofathena\t100-dm12\tskill_missile_damage_scale\t100-dm78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_handofathena\t\t\t\t\t\t\t\t\t\t\tcast_slowmissiles\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tamazon_handofathena\tcast_slowmissiles\t\t12\t20\t\t\t\t\tInner Sight\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t7\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t% Velocity of missiles Min\t75\t% Velocity of missiles Max\t300\tDuration baseline\t150\tDuration per level\t27\tRadius baseline\t0\tRadius per level\t0\tMissile Damage Reduction Min\t40\tMissile Damage Reduction Max\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Avoid\t18\tama\tavoid\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tavoid\t\t\tpassive_avoid\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_dodge_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tDodge\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tMin % Chance\t75\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t2\tAnim Mode (0 = enable uninterruptable Anim | 1 = disable Anim | 2 = enable interruptable anim)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Impale\t19\tama\timpale\t7\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\timpale\t300\t\tvelocitypercent\t-dm78\tattackrate\t-dm78\tother_animrate\t-dm78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_impale_1\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t55\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t8\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tJab\t\t\t\t\t\t\t\t\t1\t1\t\t1\t\t\t1\t8\t3\t0\t\t\t\t\t\t\t\t\t\t\t\tln12\tDamage %\tpar6-dm34\tDurability loss chance %\tpar5\tDurability loss amount\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t300\tDamage % baseline\t25\tDamage % per level\t0\t% chance reduction for Durability loss Min\t30\t% chance reduction for Durability loss Max\t1\tDurability loss amount\t50\t% chance for Durability loss Base\t0\tSlow % Min\t75\tSlow % Max\t30\tAttack Speed %\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Lightning Bolt\t20\tama\tlightning bolt\t4\t\t\t\t\t\t\t\t\t\t\tlightningjavelin\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tlightningjavelin\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\trng\t\tjave\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tPoison Javelin\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t96\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t40\t12\t18\t28\t48\t88\t(skill('Lightning Strike'.blvl)+skill('Power Strike'.blvl)+skill('Charged Strike'.blvl)+skill('Lightning Fury'.blvl)) * par8\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Ice Arrow\t21\tama\tice arrow\t4\t\t\t\t\t\t\t\t\t\t\ticearrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\ticearrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCold Arrow\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tFreeze Length synergy\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t6\t6\t12\t18\t26\t36\t10\t6\t13\t19\t27\t38\t(skill('Cold Arrow'.blvl))*par8\t50\t5\t5\t5\t(skill('Freezing Arrow'.blvl)) * par7\t\t\t640\t16000\t0\n",
+                u8"Guided Arrow\t22\tama\tguided arrow\t4\t10\t\t\t\t\t\t\t\t\t\t\t1\t\tguidedarrow\tguidedarrow\tguidedarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t18\t\t\t\t\t\tguidedarrow\tguidedarrow\tguidedarrow\t\t\t\t\t\t\t\t\t\t1\t4\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCold Arrow\tMultiple Shot\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t32\t-1\t1\t\t\t\t\t\t\t\t\t\t\tln34 + (skill('Multiple Shot'.blvl)*par8)\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tDamage % baseline\t7\tDamage % per level\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Penetrate\t23\tama\tpenetrate\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpenetrate\t\t\titem_tohit_percent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\trng\t\tspea\tmiss\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCritical Strike\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t35\t% Chance baseline\t10\t% Chance per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Charged Strike\t24\tama\tcharged strike\t6\t11\t\t\t\t\t\t\t\t\t\t\t\t\tchargedstrikebolt\tchargedstrikebolt\tchargedstrikebolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t19\t\t\t\t\t\tchargedstrikebolt\tchargedstrikebolt\tchargedstrikebolt\t\t\t\t\t\t\t\t\t\t1\t5\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tPower Strike\tLightning Bolt\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1+lvl/par2\t# of Bolt Missiles created\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t3\t# of Charged Bolt Missiles created baseline\t5\tCharged Bolt Missile created per N levels\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t30\t12\t16\t20\t24\t28\t(skill('Lightning Strike'.blvl)+skill('Lightning Bolt'.blvl)+skill('Power Strike'.blvl)) * par8\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Plague Javelin\t25\tama\tplague javelin\t4\t\t\t\t\t\t\t\t\t\t\tplaguejavelin\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_cast_poison\t\t1\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tplaguejavelin\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\trng\t\tjave\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tLightning Bolt\t\t\t\t\t\t\t25\t\t1\t1\t\t\t1\t\t1\t7\t14\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t30\t9\t\t\t\t\t\t3\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t12\t8\t16\t26\t55\t80\t18\t8\t16\t26\t55\t80\t(skill('Poison Javelin'.blvl))*par8\t75\t5\t5\t5\t\t\t\t640\t16000\t0\n",
+                u8"Strafe\t26\tama\tstrafe\t8\t12\t\t\t\t\t\t\t\t\t\t\t\t\tstrafearrow\tstrafebolt\t\t\t\t\t\t\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_dodge_1\t\t\t\t\tpaladin_charge\t\t\t\t\t\t\t\t\t13\t20\t\t\t\t\t\tmultipleshotarrow\tmultipleshotbolt\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tGuided Arrow\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t11\t0\t\t\t\t\t\t\t\t\t\t\t\t\"min(par3 + lvl - 1, par4)\"\tMinimum # of Missiles created\tln12 + (skill('Guided Arrow'.blvl)*par8) + (skill('Multiple Shot'.blvl)*par9)\tDamage %\t2+lvl/4\tMaximum # of Missiles created\t\t\t\t\t\t\t5\tDamage % baseline\t5\tDamage % per level\t4\t# of shots fired Min (+1 per level)\t10\t# of shots fired Max\t35\tRadius\t50\t% Anim frame rollback\t\t\t10\tDamage synergy\t5\tDamage Synergy\t\t\t\t\t\t\t1\t30\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Immolation Arrow\t27\tama\timmolation arrow\t4\t\t\t\t\t\t\t\t\t\t\timmolationarrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\timmolationarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tExploding Arrow\t\t\t\t\t\t\t15\t\t1\t1\t\t\t\t\t1\t6\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tRadius of Disc of Missiles\tpar2\tExplosion Damage Radius\t\t\t\t\t\t\t\t\t3\tRadius of Disc of Missiles\t4\tExplosion Damage Radius\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t30\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t12\t12\t23\t34\t36\t38\t23\t12\t23\t34\t36\t38\t(skill('Exploding Arrow'.blvl)) * par8\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Dopplezon\t28\tama\tdopplezon\t\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdopplezon\t\t\t\tfireresist\t\"min(lvl*par7,85)\"\tlightresist\t\"min(lvl*par7,85)\"\tcoldresist\t\"min(lvl*par7,85)\"\tpoisonresist\t\"min(lvl*par7,85)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdopplezon\tdopplezon\t1\tNU\t\t\t\t\t\t\t\t\t\t\t\tdopllezon_appear\t\tamazon_valkyrie_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tSlow Missiles\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t6\t76\t-3\t1\t\t\t\t\t\t\t\t\t\t\tlvl*par4\tHP %\tln12\tDuration\tpar3\tHP % derived from caster\t\t\t\t\t\t\t250\tDuration baseline\t125\tDuration per level\t50\tHP % derived from caster\t10\tHP % bonus per level\t\t\t\t\t4\tResistance % bonus per level\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Evade\t29\tama\tevade\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tevade\t\t\tpassive_evade\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tblock_arrow_1\tamazon_dodge_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tAvoid\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tMin % Chance\t65\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Fend\t30\tama\tfend\t9\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tamazon_jab_1\t1\t\t\t\t\t\t\t\t\t\t\t\t14\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t9\t\t1\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tImpale\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t5\t0\t\t\t\t\t\t\t\t\t\t\t\t12\t# of max targets\tln34\tDamage %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t1\t# of max targets per level\t30\t% Anim frame rollback\t70\tDamage % baseline\t10\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t40\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Freezing Arrow\t31\tama\tfreezing arrow\t4\t\t\t\t\t\t\t\t\t\t\tfreezingarrow\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tfreezingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tIce Arrow\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t36\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage Radius\t\t\t\t\t\t\t\t\t\t\t5\tRadius of impact\t\t\t\t\t\t\t\t\t\t\t5\tFreeze Length synergy\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t40\t9\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t40\t10\t15\t20\t22\t24\t50\t10\t15\t20\t22\t24\t(skill('Cold Arrow'.blvl))*par8\t50\t\t\t\t(skill('Ice Arrow'.blvl)) * par7\t\t\t896\t64000\t0\n",
+                u8"Valkyrie\t32\tama\tvalkyrie\t\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tstrength\tlvl * par2\tdexterity\tlvl * par4\tfireresist\t\"min((lvl+skill('Dopplezon'.blvl))*par7,85)\"\tlightresist\t\"min((lvl+skill('Dopplezon'.blvl))*par7,85)\"\tcoldresist\t\"min((lvl+skill('Dopplezon'.blvl))*par7,85)\"\tpoisonresist\t\"min((lvl+skill('Dopplezon'.blvl))*par7,85)\"\t\t\t\t\t\t\t\t\t\titem_armor_percent\tpar3 * (lvl - 1)\ttohit\ttoht\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvalkyrie\tvalkyrie\t1\tNU\tdodge\tskill('Dodge'.blvl)\tavoid\tskill('Avoid'.blvl)\tEvade\tskill('Evade'.blvl)\tCritical Strike\tskill('Critical Strike'.blvl)\t\t\t\t\t\tamazon_valkyrie_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tDopplezon\tEvade\t\t\t\t\t\t15\t\t0\t1\t\t\t\t\t1\t8\t25\t1\t1\t1\t\t\t\t\t\t\t\t\t\tpar1 * (lvl - 1) + skill('Dopplezon'.blvl) * par8\tHP %\tln56\tValkyrie Item Level\t\t\t\t\t\t\t\t\t20\tHP % per level\t25\tStrength per level\t10\tArmor % per level\t12\tDexterity per level\t25\tValkyrie Item Level baseline\t3\tValkyrie Item Level per level\t2\tResistance % per level\t20\tHP % synergy\t\t\t\t\t\t\t\t\t1\t\t\t40*lvl+40*skill('Penetrate'.blvl)\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Pierce\t33\tama\tpierce\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpierce\t\t\tskill_pierce\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\tmiss\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tPenetrate\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tMin % Chance\t100\tMax % Chance\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Lightning Strike\t34\tama\tlightning strike\t10\t14\t\t\t\t\t\t\t\t\t\t\t\t\tlightningstrike\tlightningstrike\tlightningstrike\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t  \t\t\t\t\t\tlightningstrike\tlightningstrike\tlightningstrike\t\t\t\t\t\t\t\t\t\t1\t8\t\th2h\t\tspea\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tCharged Strike\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t9\t0\t1\t\t\t\t\t\t\t\t\t\t\t20\tRange of Bolt Missiles\tln34\t# of target jump hits\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t20\tRadius of jump to next target\t\t\t2\t# of target jump hits baseline\t1\t# of target jump hits per level\t\t\t\t\t\t\t11\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t25\t10\t15\t20\t25\t30\t(skill('Charged Strike'.blvl)+skill('Lightning Bolt'.blvl)+skill('Power Strike'.blvl)) * par8\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Lightning Fury\t35\tama\tlightning fury\t4\t\t\t\t\t\t\t\t\t\t\tlightningfury\t1\t\t\t\t\t\t\t42371\t\t\t\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tlightningfury\t\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\trng\t\tjave\t\t\t\t\t\t\t\t\t\tTH\tTH\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tPlague Javelin\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12\t# of furylightning Missiles created\t\t\t\t\t\t\t\t\t\t\t2\t# of Lightning Missiles created baseline\t1\t# of Lightning Missiles created per level\t15\tTarget Search Radius\t\t\t\t\t\t\t\t\t1\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t40\t20\t30\t40\t50\t50\t(skill('Charged Strike'.blvl)+skill('Lightning Bolt'.blvl)+skill('Power Strike'.blvl)+skill('Lightning Strike'.blvl)) * par8\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Fire Bolt\t36\tsor\tfire bolt\t\t\t\t\t\t\t\t\t\t\t\tfirebolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_1\t\t\t\t\t\t\t\t\tfirebolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t5\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t6\t3\t4\t8\t18\t54\t12\t3\t6\t10\t20\t56\t(skill('Fire Ball'.blvl)+skill('Meteor'.blvl))*par8\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Warmth\t37\tsor\twarmth\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twarmth\t\t\tmanarecoverybonus\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tMana Recovery % baseline\t12\tMana Recovery % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Charged Bolt\t38\tsor\tcharged bolt\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\tchargedbolt\tchargedbolt\tchargedbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t23\t\t\t\t\t\tchargedbolt\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t5\t24\t4\t1\t\t\t\t\t\t\t\t\t\t\t\"min(24,ln12)\"\t# of Bolt Missiles created\t\t\t\t\t\t\t\t\t\t\t3\t# of Bolt Missiles created baseline\t1\t# of Bolt Missiles created per level\t\t\t\t\t\t\t\t\t\t\t6\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t4\t1\t1\t2\t3\t4\t8\t1\t1\t2\t3\t4\t(skill('Lightning'.blvl))*par8\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Ice Bolt\t39\tsor\tice bolt\t\t\t\t\t\t\t\t\t\t\t\ticebolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_1\t\t\t\t\t\t\t\t\ticebolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t6\t2\t4\t6\t8\t10\t10\t3\t5\t7\t9\t11\t(skill('Frost Nova'.blvl)+skill('Ice Blast'.blvl)+skill('Glacial Spike'.blvl)+skill('Blizzard'.blvl)+skill('Frozen Orb'.blvl))*par8\t150\t35\t35\t35\t\t\t\t256\t1000\t0\n",
+                u8"Frozen Armor\t40\tsor\tfrozen armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfrozenarmor\t\tln34+(skill('Shiver Armor'.blvl)+skill('Chilling Armor'.blvl))*par7\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\tsorceress_frozenarmor\t\t\t\t\t\t\tice_cast_1\tfrozenarmor_hit\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\tice_cast_1\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t1\t\t\t\t\t\t\t\t\t\tln56*(100+((skill('Shiver Armor'.blvl)+skill('Chilling Armor'.blvl))*par8))/100\tFreeze Length\t\t\t\t\t\t\t\t\t\t\t30\tArmor % baseline\t5\tArmor % per level\t3600\tBuff Duration\t300\tBuff Duration per level\t30\tFreeze Length baseline\t3\tFreeze Length per level\t250\tBuff Duration synergy\t5\tFreeze Length synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t256\t1000\t0\n",
+                u8"Inferno\t41\tsor\tinferno\t11\t19\t\t\t\t\t\t\t\t\t\t\t\t\tinfernoflame1\tinfernoflame1\tinfernoflame1\t\t\t\t\t\t\tln12/4-2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\t24\t\t\t\t\t\tinfernoflame1\tinfernoflame2\t\t\t\t\t\t\t\t\t\t\t1\t7\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t6\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\t\t6\t0\t2\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12/2\tRange (Duration of Missile) (Min=1)\t20\tDuration to channel if caster is a Monster (Min=1)\t\t\t\t\t\t\t\t\t35\tRange baseline (Duration of missile)\t3\tRange per level (Duration of missile)\t4\tMin Mana required to start casting\t\t\t\t\t\t\t\t\t16\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t36\t24\t30\t34\t38\t42\t72\t25\t31\t35\t39\t43\t(skill('Warmth'.blvl))*par8\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Static Field\t42\tsor\tstatic field\t\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34691\t\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t9\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar4\tHP % Damage\tpar3\tMinimum Damage value\t\t\t\t\t\t\t\t\t5\tRadius baseline\t1\tRadius per level\t0\tMinimum Damage value\t25\tHP % Damage\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Telekinesis\t43\tsor\ttelekinesis\t12\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\tsorceress_telekinesis\t\t\t\t\t\t\tlight_cast_2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\tsorceress_telekinesis\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t1\t\t\t\t\t\t\t\t\t\tpar2\t% chance to knockback/stun\t\t\t\t\t\t\t\t\t\t\t25\tCast Range\t35\t% chance to knockback/stun\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t5\t2\t109\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t1\t1\t1\t1\t1\t2\t1\t1\t1\t1\t1\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Frost Nova\t44\tsor\tfrost nova\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tfrostnova\tfrostnova\tfrostnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_2\t\t\t\t25\t\t\t\t\t\tfrostnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t36\t10\t\t\t\t\t\tsorceress_cast_cold\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t9\t1\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t4\t6\t8\t10\t12\t14\t8\t7\t9\t11\t13\t15\t(skill('Blizzard'.blvl)+skill('Frozen Orb'.blvl))*par8\t200\t25\t25\t25\t\t\t\t384\t3000\t0\n",
+                u8"Ice Blast\t45\tsor\tice blast\t\t\t\t\t\t\t\t\t\t\t\ticeblast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_1\t\t\t\t\t\t\t\t\ticeblast\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t6\t20\t\t\t\t\tIce Bolt\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t12\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t75\tFreeze Length baseline\t5\tFreeze Length per level\t\t\t\t\t\t\t\t\t10\tFreeze Length synergy\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t16\t14\t28\t42\t56\t70\t24\t15\t29\t43\t57\t71\t(skill('Ice Bolt'.blvl)+skill('Blizzard'.blvl)+skill('Frozen Orb'.blvl))*par8\t75\t5\t5\t5\t(skill('Glacial Spike'.blvl))*par7\t\t\t384\t3000\t0\n",
+                u8"Blaze\t46\tsor\tblaze\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\tblaze\tblaze\tblaze\t\t\t\tblaze\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvelocitypercent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t\t\t\t\t\tblaze\tfirewall\tfiresmall\tfiremedium\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tInferno\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t7\t22\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t50\tBuff Duration Min\t500\tBuff Duration Max\t2\tVelocity % baseline\t2\tVelocity % per level\t\t\t\t\t\t\t6\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t4\t3\t5\t7\t9\t11\t8\t3\t6\t8\t10\t12\tskill('Warmth'.blvl)*par8\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Fire Ball\t47\tsor\tfire ball\t\t\t\t\t\t\t\t\t\t\t\tfireball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t\t\t\t\t\tfireball\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t12\t20\t\t\t\t\tFire Bolt\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t10\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t4\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t12\t13\t23\t28\t33\t38\t28\t15\t25\t30\t35\t40\t(skill('Fire Bolt'.blvl)+skill('Meteor'.blvl))*par8\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Nova\t48\tsor\tnova\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tnova\tnova\tnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t25\t\t\t\t\t\tnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t36\t10\t\t\t\t\t\tsorceress_cast_lightning\t\t\t12\t20\t\t\t\t\tStatic Field\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t1\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t6\t7\t8\t9\t10\t20\t8\t9\t10\t11\t12\t(skill('Static Field'.blvl))*par8\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Lightning\t49\tsor\tlightning\t\t\t\t\t\t\t\t\t\t\t\tlightningbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t\t\t\t\t\tlightningbolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSC\txx\t12\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t12\t20\t\t\t\t\tCharged Bolt\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t40\t8\t12\t20\t28\t36\t(skill('Charged Bolt'.blvl)+skill('Chain Lightning'.blvl)+skill('Nova'.blvl))*par8\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Shiver Armor\t50\tsor\tshiver armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tshiverarmor\t\tln34+(skill('Frozen Armor'.blvl)+skill('Chilling Armor'.blvl))*par7\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\tattackedinmelee\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\tsorceress_shiverarmor\t\t\t\t\t\t\tice_cast_2\tshiverarmor_hit\t\t\t\t\t\t\t\t\tsparkle\t\t\t\t10\tSparkle Missile Delay\t5\tSparkle Missile Radius\t3\tSparkle Missile Height\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\tice_cast_3\t\t12\t20\t\t\t\t\tIce Blast\tFrozen Armor\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t11\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t45\tArmor % baseline\t6\tArmor % per level\t3600\tBuff Duration\t300\tBuff Duration per level\t\t\t\t\t250\tBuff Duration synergy\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t12\t6\t8\t10\t12\t14\t16\t7\t9\t11\t13\t15\t(skill('Frozen Armor'.blvl)+skill('Chilling Armor'.blvl))*par8\t100\t\t25\t50\t\t\t\t512\t8000\t0\n",
+                u8"Fire Wall\t51\tsor\tfire wall\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\tfirewallmaker\tfirewall\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t26\t\t\t\t\t\tfirewallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t4\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t18\t20\t\t\t\t\tBlaze\t\t\t\t\t\t\t35\t\t0\t1\t\t\t\t\t1\t8\t22\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t0\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t1\tDamage synergy\t4\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t15\t9\t14\t21\t21\t21\t20\t9\t14\t21\t21\t21\t(skill('Warmth'.blvl)*par8+skill('Inferno'.blvl)*par7\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Enchant\t52\tsor\tenchant\t\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tenchant\t\tln12\t\tfiremindam\tenma\tfiremaxdam\texma\titem_tohit_percent\ttoht\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_enchant\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t1\t\t\t1\t\t\t\tsorceress_enchant\t\t\t18\t20\t\t\t\t\tWarmth\tFire Ball\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t25\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3600\tBuff Duration baseline\t600\tBuff Duration per level\t33\t% Damage for Ranged Weapons\t\t\t\t\t\t\t\t\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t9\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t16\t3\t7\t11\t15\t19\t20\t5\t9\t13\t17\t21\t(skill('Warmth'.blvl))*par8\t\t\t\t\t\t1\t\t640\t16000\t0\n",
+                u8"Chain Lightning\t53\tsor\tchain lightning\t\t26\t\t\t\t\t\t\t\t\t\t\t\t\tchainlightning\tchainlightning\tchainlightning\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t27\t\t\t\t\t\tchainlightning\tchainlightning\tchainlightning\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSC\tSC\t12\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t151\t96\t\t\t\t\t\tsorceress_cast_lightning\t\t\t18\t20\t\t\t\t\tLightning\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t9\t1\t1\t\t\t\t\t\t\t\t\t\t\tln34/par5\t# of target jump hits\t\t\t\t\t\t\t\t\t\t\t20\tRadius of jump to next target\t\t\t26\t# of target jump hits baseline\t1\t# of target jump hits per level\t5\t\"Every # levels, increase target jump\"\t\t\t\t\t4\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t40\t11\t13\t15\t15\t15\t(skill('Charged Bolt'.blvl)+skill('Lightning'.blvl)+skill('Nova'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Teleport\t54\tsor\tteleport\t\t27\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_teleport\t\t\t\t\t\t\t\t\t\t\tteleport\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t1\t2\t\t\t\tsorceress_teleport\tteleport\t\t18\t20\t\t\t\t\tTelekinesis\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t24\t-1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Glacial Spike\t55\tsor\tglacial spike\t\t\t\t\t\t\t\t\t\t\t\tglacialspike\t\t\t\t\t\t\t\t\t\t\tln34 * (100 + skill('Blizzard'.blvl) * par7) / 100\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_2\t\t\t\t\t\t\t\t\tglacialspike\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t18\t20\t\t\t\t\tIce Blast\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tExplosion Radius baseline\t0\tExplosion Radius per level\t50\tFreeze Length baseline\t3\tFreeze Length per level\t\t\t\t\t3\tFreeze Length synergy\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t32\t14\t26\t28\t30\t32\t48\t15\t27\t29\t31\t33\t(skill('Ice Bolt'.blvl)+skill('Ice Blast'.blvl)+skill('Frozen Orb'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Meteor\t56\tsor\tmeteor\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tmeteorcenter\tmeteorcenter\tmeteorcenter\t\t\t\t\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\tsorceress_meteor\t\t\t\t\t\t\tfire_cast_2\t\t\t\t28\t\t\t\t\t\tmeteorcenter\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\tfire_cast_2\t\t24\t20\t\t\t\t\tFire Ball\tFire Wall\t\t\t\t\t\t30\t\t0\t1\t\t\t\t\t1\t7\t34\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t6\tExplosion Radius baseline\t0\tExplosion Radius per level\t30\tDuration of ground fire baseline\t15\tDuration of ground fire per level\t\t\t\t\t\t\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t80\t23\t39\t79\t81\t83\t100\t25\t41\t81\t83\t85\t(skill('Fire Bolt'.blvl)+skill('Fire Ball'.blvl))*par8\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Thunder Storm\t57\tsor\tthunder storm\t13\t29\t\t\t\t\t\t\t\t\t\t\t\t\tthunderstorm1\t\t\t\t\t\tthunderstorm\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_thunder_cast\t\t\t\t\t\t\t\t\tlightning\t\tlight_cast_2\t\t\t\t\t\t84\t\t\t\tthunderstorm1\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tNova\tChain Lightning\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t19\t0\t1\t\t\t1\t(100-dm56) * par4/100 + par3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3600\tBuff Duration baseline\t600\tBuff Duration per level\t25\tPeriodic Damage Rate Min\t100\tPeriodic Damage Rate Multiplier\t0\tMin % reduction of periodic damage rate\t100\tMax % reduction of periodic damage rate\t17\tRadius\t7\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t10\t10\t11\t11\t11\t100\t10\t10\t11\t11\t11\t(skill('Static Field'.blvl))*par8\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Energy Shield\t58\tsor\tenergy shield\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tenergyshield\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\tabsorbdamage\t24\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t74\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\tsorceress_energyshield\t\t\t\t\tenergyshieldhit0\t\tlight_cast_2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tTeleport\tChain Lightning\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t5\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\"min(edmn,95)\"\tDamage % Absorption\tpar5-skill('Telekinesis'.blvl)\tMana consumed per HP damage (in sixteenths)\t\t\t\t\t\t\t\t\t3600\tBuff Duration baseline\t600\tBuff Duration per level\t\t\t\t\t32\tMana consumed per HP damage (in sixteenths)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\t5\t2\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Blizzard\t59\tsor\tblizzard\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tblizzardcenter\tblizzardcenter\tblizzardcenter\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_3\t\t\t\t28\t\t\t\t\t\tblizzardcenter\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\tice_cast_3\t\t24\t20\t\t\t\t\tFrost Nova\tGlacial Spike\t\t\t\t\t\t45\t\t0\t1\t\t\t\t\t1\t8\t23\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tRadius for Area of Effect\tpar3\tMissile Spawn Rate\t\t\t\t\t\t\t\t\t7\tRadius for Area of Effect\t\t\t4\tMissile Spawn Rate\t\t\t\t\t\t\t\t\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t45\t15\t30\t45\t55\t65\t75\t16\t31\t46\t56\t66\t(skill('Ice Bolt'.blvl)+skill('Ice Blast'.blvl)+skill('Glacial Spike'.blvl))*par8\t100\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Chilling Armor\t60\tsor\tchilling armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\tchillingarmorbolt\t\t\t\t\t\tchillingarmor\t\tln34+(skill('Frozen Armor'.blvl)+skill('Shiver Armor'.blvl))*par7\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\thitbymissile\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\tsorceress_shiverarmor\t\t\t\t\t\t\tice_cast_3\tchillarmor_hit\t\t\t\t\t\t\t\t\tchillingarmorbolt\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t24\t20\t\t\t\t\tShiver Armor\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t17\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t60\tArmor % baseline\t9\tArmor % per level\t3600\tBuff Duration\t300\tBuff Duration per level\t\t\t\t\t250\tBuff Duration synergy\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t16\t8\t10\t12\t14\t16\t20\t9\t11\t13\t15\t17\t(skill('Frozen Armor'.blvl)+skill('Shiver Armor'.blvl))*par8\t100\t\t25\t50\t\t1\t\t768\t32000\t0\n",
+                u8"Fire Mastery\t61\tsor\tfire mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfiremastery\t\t\tpassive_fire_mastery\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tDamage % baseline\t7\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Hydra\t62\tsor\thydra\t14\t144\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\thydra1\thydra\tpar3\tS2\tHydraMissile\tlvl\tFire Bolt\tskill('Fire Bolt'.blvl)\tFire Ball\tskill('Fire Ball'.blvl)\t\t\t\t\t\t\t1\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t1\t\tsorceress_cast_fire\tfire_cast_2\t\t30\t20\t\t\t\t\tEnchant\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t7\t40\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12\tDuration\t\t\t\t\t\t\t\t\t\t\t250\tDuration baseline\t0\tDuration per level\t18\t# of max Hydras (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t3\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t28\t11\t15\t19\t23\t27\t39\t13\t17\t21\t25\t29\t(skill('Fire Bolt'.blvl) + skill('Fire Ball'.blvl))*par8\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Lightning Mastery\t63\tsor\tlightning mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightningmastery\t\t\tpassive_ltng_mastery\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t50\tDamage % baseline\t12\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Frozen Orb\t64\tsor\tfrozen orb\t\t\t\t\t\t\t\t\t\t\t\tfrozenorb\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_3\t\t\t\t29\t\t\t\t\t\tfrozenorb\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t30\t20\t\t\t\t\tBlizzard\t\t\t\t\t\t\t25\t\t1\t1\t\t\t\t\t1\t7\t50\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t80\t20\t24\t28\t29\t30\t90\t21\t25\t29\t30\t31\t(skill('Ice Bolt'.blvl))*par8\t200\t25\t25\t25\t\t\t\t896\t64000\t0\n",
+                u8"Cold Mastery\t65\tsor\tcold mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcoldmastery\t\t\tpassive_cold_pierce\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tCold Resistance reduction baseline\t5\tCold Resistance reduction per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Amplify Damage\t66\tnec\tamplify damage\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tamplifydamage\tln34\tln12\tdamageresist\t-par5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseamplifydamage\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t10\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tRadius baseline\t1\tRadius per level\t200\tDuration baseline\t75\tDuration per level\t100\tDamage Resistance %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Teeth\t67\tnec\tteeth\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\tteeth\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t19\t17\t\t\t\t\t\tteeth\tteeth\tbonecast\t\t\t\t\t\t\t\t\t\t1\t1\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t6\t1\t1\t\t\t\t\t\t\t\t\t\t\t\"min(ln12,24)\"\t# of Missiles created\tpar3\tMissile Activation Frame\t0\t# of missiles that can trigger item modifier events\t\t\t\t\t\t\t2\t# of Missiles created baseline\t1\t# of Missiles created per level\t0\tMissile Activation Frame\t\t\t\t\t\t\t\t\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t4\t2\t2\t3\t4\t5\t8\t2\t3\t4\t5\t6\t(skill('Bone Wall'.blvl)+skill('Bone Prison'.blvl)+skill('Bone Spear'.blvl)+skill('Bone Spirit'.blvl))*par8\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Bone Armor\t68\tnec\tbone armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbonearmor\t\t\t\tbonearmor\t(ln12 + (skill('Bone Wall'.blvl) + skill('Bone Prison'.blvl)) * par8)*256\tbonearmormax\t(ln12 + (skill('Bone Wall'.blvl) + skill('Bone Prison'.blvl)) * par8)*256\t\t\t\t\t\t\t\t\tabsorbdamage\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bonearmor\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_bonearmor\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t11\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tDamage absorbed baseline\t15\tDamage absorbed per level\t\t\t\t\t\t\t\t\t\t\t15\tDamage Absorbed synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Skeleton Mastery\t69\tnec\tskeleton mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tskel_mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\tRaise Skeleton\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tHP per level\t2\tDamage per level\t5\tRevive Synergy HP % per level\t10\tRevive Synergy Damage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Raise Skeleton\t70\tnec\traise skeleton\t15\t31\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdamagepercent\t((lvl < 4) ? 0 : ((lvl-3)*par3))\ttohit\t(lvl+skill('Skeleton Mastery'.lvl))*par4\tarmorclass\t(lvl+skill('Skeleton Mastery'.lvl))*par5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmaxhp\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par1) * 256\titem_normaldamage\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par2) + edmn\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecroskeleton\tskeleton\t(lvl < 4) ?lvl:(2+lvl/3)\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\t31\t\t\t\t\t\tcorpseexplosion\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t2\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t6\t1\t1\t\t\t\t\t\t\t\t\t\t\t(lvl < 4) ? 0 : (par2 * (lvl - 3))\tHP % Modifier\tpar1\t% chance to spawn with a shield (only works for necroskeleton)\t\t\t\t\t\t\t\t\t5\t% chance to spawn with a shield\t50\tHP % per level\t7\tDamage % per level\t15\tAttack Rating per level\t15\tArmor per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t1\t2\t3\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Dim Vision\t71\tnec\tdim vision\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\tdimvision\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcursedimvision\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t9\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t1\tRadius per level\t175\tDuration baseline\t50\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Weaken\t72\tnec\tweaken\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tweaken\tln34\tln12\tdamagepercent\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseweaken\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t6\t20\t\t\t\t\tAmplify Damage\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\tRadius baseline\t1\tRadius per level\t350\tDuration baseline\t60\tDuration per level\t-33\t% Damage Dealt baseline\t-1\t% Damage Dealt per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Poison Dagger\t73\tnec\tpoison dagger\t16\t32\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\tknif\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t12\t1\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tDamage synergy\t\t\t\t\t\t\t\t\t1\t30\t20\t\t\t\t\t\t1\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t18\t10\t15\t20\t23\t26\t40\t10\t15\t20\t23\t26\t(skill('Poison Explosion'.blvl)+skill('Poison Nova'.blvl))*par8\t50\t10\t10\t10\t\t\t\t384\t3000\t0\n",
+                u8"Corpse Explosion\t74\tnec\tcorpse explosion\t17\t55\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_corpse_cast\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\t\t\t\t\t\t21\t32\t\t\t\t\t\tcorpseexplosion\texplodingarrowexp\tredlightmissile\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t1\t\t\t3\t\t\t1\tnecromancer_corpse_cast\t\t\t6\t20\t\t\t\t\tTeeth\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage % of base HP for enemy Min\tpar2\tDamage % of base HP for enemy Max\tpar5\t% Damage Dealt as Elemental\t\t\t\t\t\t\t70\tDamage % of base HP for enemy Min \t120\tDamage % of base HP for enemy Max\t8\tExplosion Radius (half squares) baseline\t1\tExplosion Radius (half squares) per level\t50\tDamage % Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Clay Golem\t75\tnec\tclay golem\t\t56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_slow\tdm34\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t27\t\t\t\t\t\t\t\tvelocitypercent\tskill('Golem Mastery'.dm34)\ttohit\tskill('Golem Mastery'.ln56) + (lvl*par8)\tdamagepercent\tpar2 * (lvl - 1) + (skill('FireGolem'.blvl)*skill('FireGolem'.par8))\tarmorclass\tskill('IronGolem'.blvl)*skill('IronGolem'.par8)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tClayGolem\tgolem\t1\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t3\t1\t1\t\t\t\t\t\t\t\t\t\t(100+(par1 * (lvl - 1)))*(100+skill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8)))/100-100\tHP % Modifier\t\t\t\t\t\t\t\t\t\t\t35\tHP % per level\t35\tDamage % per level\t0\tSlow % Min\t75\tSlow % Max\t\t\t\t\t\t\t20\tClay Golem Attack Rating synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Iron Maiden\t76\tnec\tiron maiden\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tironmaiden\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\tdomeleedamage\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseironmaiden\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tAmplify Damage\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t5\t0\t1\t\t\t\t\t\t\t\t\t\t\tln56\tDamage % Returned VS Monster\tln56/4\t% Damage To Return VS Player\tln56/4\t% Damage To Return VS Hireling\t0\tFlat Damage Added\t\t\t\t\t7\tRadius baseline\t0\tRadius per level\t300\tDuration baseline\t60\tDuration per level\t200\tDamage % returned baseline\t25\tDamage % returned per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t141\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Terror\t77\tnec\tterror\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\tterror\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseterror\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t12\t20\t\t\t\t\tWeaken\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t0\tRadius per level\t200\tDuration baseline\t25\tDuration per level\t24\tDistance To Run baseline\t2\tDistance To Run per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Bone Wall\t78\tnec\tbone wall\t\t60\t\t\t\t\t\t\t\t\t\t\t\t\tbonewallmaker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbonewall\tnone\t\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t12\t20\t\t\t\t\tBone Armor\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t17\t0\t1\t\t\t\t\t\t\t\t\t\t\t(par1 * (lvl-1)) + ((skill('Bone Armor'.blvl)+skill('Bone Prison'.blvl))*par8)\tHP % Modifier\tln34\t(# of Wall Missiles created per side) / 2\t\t\t\t\t\t\t\t\t25\tHP % per level\t600\tDuration\t8\t# of Wall Missiles created baseline\t0\t# of Wall Missiles created per level\t\t\t\t\t\t\t10\tHP % synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Golem Mastery\t79\tnec\tgolem mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tgolem_mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tClay Golem\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tHP % baseline\t20\tHP % per level\t0\tVelocity % Min\t40\tVelocity % Max\t25\tAttack Rating baseline\t25\tAttack Rating per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Raise Skeletal Mage\t80\tnec\traise skeletal mage\t15\t31\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tarmorclass\t(lvl+skill('Skeleton Mastery'.lvl))*par5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmaxhp\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par1) * 256\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromage\tskeletonmage\t(lvl < 4) ?lvl:(2+lvl/3)\tS1\tNecromageMissile\tskill('Skeleton Mastery'.lvl) + ((lvl < 4)?0:((lvl-2)/2))\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\t31\t\t\t\t\t\tcorpseexplosion\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t2\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tRaise Skeleton\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t8\t1\t1\t\t\t\t\t\t\t\t\t\t\t(lvl < 4) ? 0 : (par2 * (lvl - 3))\tHP % Modifier\t\t\t\t\t\t\t\t\t\t\t\t\t10\tHP % per level\t\t\t\t\t10\tArmor per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Confuse\t81\tnec\tconfuse\t\t61\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\tconfuse\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseconfuse\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t18\t20\t\t\t\t\tDim Vision\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t250\tDuration baseline\t50\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Life Tap\t82\tnec\tlife tap\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tlifetap\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\tdamagedinmelee\t5\tdamagedbymissile\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\tsteallife\t\t\t\t\t18\t30\t\t\t\t\t\tcursereversevampire\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t18\t20\t\t\t\t\tIron Maiden\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t9\t0\t1\t\t\t\t\t\t\t\t\t\t\tln56\tDamage % returned as healing to attacker\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t1\tRadius per level\t400\tDuration baseline\t60\tDuration per level\t50\tDamage % returned as healing to attacker baseline\t0\tDamage % returned as healing to attacker per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Poison Explosion\t83\tnec\tpoison explosion\t17\t63\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonexplosioncloud\t\t\t\t\t\t\t\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_corpse_cast\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\t\t\t\t\t\t21\t33\t\t\t\t\t\tpoisoncorpseexplosion\tpoisonexplosioncloud\tgreenlightmissile\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t1\t\t\t3\t\t\t1\tnecromancer_corpse_cast\t\t\t18\t20\t\t\t\t\tPoison Dagger\tCorpse Explosion\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t8\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t8\t2\t4\t6\t8\t10\t24\t2\t4\t6\t8\t10\t(skill('Poison Dagger'.blvl)+skill('Poison Nova'.blvl))*par8\t50\t10\t10\t10\t\t\t\t640\t16000\t0\n",
+                u8"Bone Spear\t84\tnec\tbone spear\t\t\t\t\t\t\t\t\t\t\t\tbonespear\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t19\t\t\t\t\t\tbonespear\t\t\tbonecast\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t18\t20\t\t\t\t\tCorpse Explosion\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t28\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t16\t8\t9\t12\t18\t24\t24\t8\t9\t13\t19\t25\t(skill('Bone Wall'.blvl)+skill('Bone Prison'.blvl)+skill('Teeth'.blvl)+skill('Bone Spirit'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"BloodGolem\t85\tnec\tbloodgolem\t\t56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdomeleedamage\t23\tdamagedinmelee\t26\tdamagedbymissile\t26\t\t\t\tvelocitypercent\tskill('Golem Mastery'.dm34)\ttohit\tskill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\tdamagepercent\tpar4 * (lvl - 1) + (skill('FireGolem'.blvl)*skill('FireGolem'.par8))\tarmorclass\tskill('IronGolem'.blvl)*skill('IronGolem'.par8)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tBloodGolem\tgolem\t1\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tClay Golem\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t25\t3\t1\t1\t\t\t\t\t\t\t\t\t\t(100 + (par7 * (lvl - 1)))*(100 + skill('Golem Mastery'.ln12))/100 - 100\tHP % Modifier\tdm12\tLifesteal %\tpar3\tLifesteal % transferred to caster\t\t\t\t\t\t\t75\tLifesteal % Min\t150\tLifesteal % Max\t30\tLifesteal % transferred to caster\t55\tDamage % per level\t0\tDamage Received % transferred to caster\t25\tCaster Healing % transferred to golem\t20\tHP % per level\t5\tBlood Golem HP % synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Attract\t86\tnec\tattract\t18\t59\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\tattract\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseattract\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tConfuse\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t17\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\tRadius baseline\t0\tRadius per level\t300\tDuration baseline\t90\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Decrepify\t87\tnec\tdecrepify\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tdecrepify\tln34\tln12\tvelocitypercent\tpar5\tdamagepercent\tpar5\tdamageresist\tpar5\tattackrate\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcursedecrepify\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t24\t20\t\t\t\t\tTerror\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t11\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t0\tRadius per level\t100\tDuration baseline\t15\tDuration per level\t-50\tSlow % / Damage Dealt % / Damage Resistance %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Bone Prison\t88\tnec\tbone prison\t19\t62\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbonewall\tnone\t\tNU\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t1\t\tnecromancer_bone_cast\t\t\t24\t20\t\t\t\t\tBone Wall\tBone Spear\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t27\t-1\t1\t\t\t\t\t\t\t\t\t\t\t(par1 * (lvl-1)) + ((skill('Bone Armor'.blvl)+skill('Bone Wall'.blvl))*par8)\tHP % Modifier\t\t\t\t\t\t\t\t\t\t\t25\tHP % per level\t600\tDuration\t\t\t\t\t\t\t\t\t\t\t8\tHP % synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Summon Resist\t89\tnec\tsummon resist\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsummonresist\t\t\tpassive_summon_resist\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tGolem Mastery\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t1\t8\t44\t-3\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tResistance % Min\t75\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"IronGolem\t90\tnec\tirongolem\t20\t57\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tthorns\t\t\t\titem_attackertakesdamage\tedmn\tfade\t16\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvelocitypercent\tskill('Golem Mastery'.dm34)\ttohit\tskill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\tarmorclass\tlvl*par8\tdamagepercent\t(skill('FireGolem'.blvl)*skill('FireGolem'.par8))\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\titem_pierce_magic_immunity\tstat('item_pierce_magic_immunity'.accr)\t\t\t\t\t\t\t\t\tIronGolem\tgolem\t1\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tBloodGolem\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t35\t0\t1\t1\t\t\t\t\t\t\t\t\t\tskill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8))\tHP % Modifier\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t35\tIron Golem Armor synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\t6\t12\t18\t24\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Lower Resist\t91\tnec\tlower resist\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tlowerresist\tln34\tln12\tfireresist\t-dm56\tlightresist\t-dm56\tcoldresist\t-dm56\tpoisonresist\t-dm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurselowerresist\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tnecromancer_curse_cast\t\t\t30\t20\t\t\t\t\tLife Tap\tDecrepify\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t22\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\tRadius baseline\t1\tRadius per level\t500\tDuration baseline\t50\tDuration per level\t25\tResistance % reduction Min\t70\tResistance % reduction Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Poison Nova\t92\tnec\tpoison nova\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_poison_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tpoisonnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tnecromancer_poison_cast\t\t\t30\t20\t\t\t\t\tPoison Explosion\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t16\t4\t6\t9\t14\t16\t29\t4\t6\t9\t14\t16\t(skill('Poison Dagger'.blvl)+skill('Poison Explosion'.blvl))*par8\t50\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Bone Spirit\t93\tnec\tbone spirit\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\tbonespirit\tbonespirit\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bone_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t\t\t\t\t\tbonespirit\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t4\t\t\t\tnecromancer_bone_cast\t\t\t30\t20\t\t\t\t\tBone Spear\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t20\t16\t17\t18\t19\t20\t30\t17\t18\t19\t20\t21\t(skill('Bone Wall'.blvl)+skill('Bone Prison'.blvl)+skill('Teeth'.blvl)+skill('Bone Spear'.blvl))*par8\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"FireGolem\t94\tnec\tfiregolem\t\t56\t\t\t\t\t\t\t\t\t\t\t\t\tmonstercorpseexplode\t\t\t\t\t\t\t\t\t\tfireresist\t100 - dm12\titem_absorbfire_percent\tdm12\tfiremindam\tedmn\tfiremaxdam\tedmx\t\t\t\t\t\t\t\t\t\t\t\t\t\tvelocitypercent\tskill('Golem Mastery'.dm34)\ttohit\tskill('Golem Mastery'.ln56)+skill('Clay Golem'.blvl)*skill('Clay Golem'.par8)\tarmorclass\tskill('IronGolem'.blvl)*skill('IronGolem'.par8)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tFireGolem\tgolem\t1\tS1\tholy fire\t\"min(ln56,30)\"\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_golem_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tIronGolem\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t50\t8\t1\t1\t\t\t\t\t\t\t\t\t\tskill('Golem Mastery'.ln12) + (skill('BloodGolem'.blvl)*skill('BloodGolem'.par8))\tHP % Modifier\t100\tDeath Explosion Physical Damage\t100\tDeath Explosion Fire Damage\t6\tDeath Explosion Radius\t\t\t\t\t25\tFire Absorb % Min\t100\tFire Absorb % Max\t100\tDamage % baseline\t35\tDamage % per level\t7\tHoly Fire Level baseline\t1\tHoly Fire Level increased per level\t\t\t6\tFire Golem Damage % synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t10\t9\t10\t11\t12\t13\t27\t10\t11\t12\t13\t14\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Revive\t95\tnec\trevive\t21\t58\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdamagepercent\tskill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par4)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvelocitypercent\tpar5\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\titem_pierce_magic_immunity\tstat('item_pierce_magic_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\trevive\tlvl\tNU\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_revive_cast\t\t\t\t\t\t\t\tnecromancer_revive_target\t\t\t\t\t\t24\t\t\t\t\t\t\trevivemedium\trevivesmall\trevivelarge\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t\t\t1\t\t3\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tRaise Skeletal Mage\tIronGolem\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t45\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar1+skill('Skeleton Mastery'.lvl) * skill('Skeleton Mastery'.par3)\tHP % Modifier\tln34\tDuration\t\t\t\t\t\t\t\t\t200\tHP %\t\t\t4500\tDuration baseline\t0\tDuration per level\t50\tVelocity %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Sacrifice\t96\tpal\tsacrifice\t29\t64\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_sacrifice\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t34\t\t\t\t\t\tblood1\t\t\t\t3\tRandom Bonus Range for Blood missile\t\t\t\t\t\t\t1\t7\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t2\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12+skill('Redemption'.blvl)*par8+skill('Fanaticism'.blvl)*par7\tDamage %\t\"max(par6, par5-lvl/par3)\"\tSelf Damage %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t180\tDamage % baseline\t15\tDamage % per level\t3\tSelf Damage Reduction per level (1/#)\t0\tSelf Damage Minimum Flat Value\t8\tSelf Damage % baseline\t1\tSelf Damage % min\t5\tDamage synergy\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t7\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Smite\t97\tpal\tsmite\t\t150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweapon_2hs_large_1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t9\t\th2h\t4\tshld\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\t\"min(ln12,250)\"\tStun Length\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t15\tStun Length baseline\t5\tStun Length per level\t15\tDamage % baseline\t15\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t8\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Might\t98\tpal\tmight\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tmight\tmight\t\tln12\tdamagepercent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t40\tDamage % baseline\t10\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Prayer\t99\tpal\tprayer\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tprayer\tprayer\t\tln12\thitpoints\tedns\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t4\t16\t3\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t1\t2\t2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Resist Fire\t100\tpal\tresist fire\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tresistfire\tresistfire\t\tln12\tfireresist\tdm34\tmaxfireresist\tskill('Resist Fire'.blvl)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpassive_resistfire\t\t\tmaxfireresist\tskill('Resist Fire'.blvl)/2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t35\tResistance % Min\t150\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Holy Bolt\t101\tpal\tholy bolt\t\t\t\t\t\t\t\t\t\t\t\tholybolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_holybolt_cast\t\t\t\t\t\t\t\t\t\t\tcast_undead\t\t\t\t\t\t\t\t\tholybolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tpaladin_holybolt_cast\tcast_undead\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t4\t32\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12 * (100 + skill('Prayer'.blvl) * par7) / 100\tHP Heal Min value\tln34 * (100 + skill('Prayer'.blvl) * par7) / 100\tHP Heal Max value\t\t\t\t\t\t\t\t\t1\tHP Heal Min baseline\t2\tHP Heal Min per level\t6\tHP Heal Max baseline\t4\tHP Heal Max per level\t\t\t\t\t20\tHealing synergy\t50\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t8\t8\t10\t13\t16\t20\t16\t8\t11\t15\t18\t23\tskill('Fist of the Heavens'.blvl)*par8\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Holy Fire\t102\tpal\tholy fire\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\tholyfire\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfiremindam\tenms*par5/256\tfiremaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tMight\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t\t\t\t\t6\tDamage multiplier added to Attacks\t100\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t10\tDamage synergy\t21\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t2\t1\t4\t6\t7\t8\t6\t2\t5\t7\t8\t9\tskill('Resist Fire'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Thorns\t103\tpal\tthorns\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tthorns\tthorns\t\tln12\titem_attackertakesdamage\tedmn\tthorns_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t250\tDamage % returned baseline\t40\tDamage % returned per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t4\t8\t12\t16\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Defiance\t104\tpal\tdefiance\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tdefiance\tdefiance\t\tln12\tskill_armor_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t70\tArmor % baseline\t10\tArmor % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Resist Cold\t105\tpal\tresist cold\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tresistcold\tresistcold\t\tln12\tcoldresist\tdm34\tmaxcoldresist\tskill('Resist Cold'.blvl)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpassive_resistcold\t\t\tmaxcoldresist\tskill('Resist Cold'.blvl)/2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t35\tResistance % Min\t150\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Zeal\t106\tpal\tzeal\t37\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tpaladin_zeal\t\t\t\t\t\t\t\t\t\t\t\t\t\t53\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tSacrifice\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t\t\t\t\t\t\t\t\t\t\t\t\"min((par5 + lvl -1), par6)\"\t# of hits\t((lvl < 5) ? 0 : ((lvl-4) * par4))+skill('Sacrifice'.blvl)*par8\tDamage %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t100\t% Anim frame rollback\t0\tDamage % baseline\t6\tDamage % per level\t2\t# of hits Min\t5\t# of hits Max\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Charge\t107\tpal\tcharge\t31\t67\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tpaladin_charge\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t37\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\tmele\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t4\t8\t1\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tSmite\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t9\t0\t\t\t\t\t\t\t\t\t\t\t\tln34+(skill('Vigor'.blvl)+skill('Might'.blvl))*par8\tDamage %\tpar1\tVelocity %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t150\tVelocity %\t\t\t100\tDamage % baseline\t25\tDamage % per level\t\t\t\t\t\t\t20\tDamage synergy\t\t\t\t\t\t\t\t\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Blessed Aim\t108\tpal\tblessed aim\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tblessedaim\tblessedaim\t\tln12\titem_tohit_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpenetrate\t\t\titem_tohit_percent\tskill('Blessed Aim'.blvl) * par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tMight\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t75\tAttack Rating % baseline\t15\tAttack Rating % per level\t\t\t\t\t\t\t5\tAttack Rating % passive synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Cleansing\t109\tpal\tcleansing\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tcleansing\tcleansing\t\tln12\titem_poisonlengthresist\t100-dm34\thitpoints\tskill('Prayer'.edns)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tPrayer\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t30\tPoison Length % Reduction Min\t90\tPoison Length % Reduction Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Resist Lightning\t110\tpal\tresist lightning\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tresistlight\tresistlight\t\tln12\tlightresist\tdm34\tmaxlightresist\tskill('Resist Lightning'.blvl)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpassive_resistltng\t\t\tmaxlightresist\tskill('Resist Lightning'.blvl)/2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t35\tResistance % Min\t150\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Vengeance\t111\tpal\tvengeance\t35\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tZeal\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12+skill('Resist Fire'.blvl)*par8+skill('Salvation'.blvl)*par7\tFire Damage %\tln12+skill('Resist Cold'.blvl)*par8+skill('Salvation'.blvl)*par7\tCold Damage %\tln12+skill('Resist Lightning'.blvl)*par8+skill('Salvation'.blvl)*par7\tLightning Damage %\t\t\t\t\t\t\t70\tDamage % baseline\t6\tDamage % per level\t\t\t\t\t\t\t\t\t2\tDamage synergy\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t15\t15\t15\t\t\t\t640\t16000\t0\n",
+                u8"Blessed Hammer\t112\tpal\tblessed hammer\t\t73\t\t\t\t\t\t\t\t\t\t\t\t\tblessedhammer\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_holybolt_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t35\t\t\t\t\t\tblessedhammer\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tpaladin_holybolt_cast\t\t\t18\t20\t\t\t\t\tHoly Bolt\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t6\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage % from Concentration (in 8ths)\t\t\t\t\t\t\t\t\t\t\t4\tDamage % from Concentration (in 8ths)\t\t\t\t\t\t\t\t\t\t\t\t\t14\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t12\t8\t10\t12\t13\t14\t16\t8\t10\t12\t13\t14\t(skill('Vigor'.blvl)+skill('Blessed Aim'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Concentration\t113\tpal\tconcentration\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tconcentration\tconcentration\t\tln12\tdamagepercent\tln34\tskill_concentration\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tBlessed Aim\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t60\tDamage % baseline\t15\tDamage % per level\t20\t% chance for uninterruptible attack\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Holy Freeze\t114\tpal\tholy freeze\t\t81\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t303747\tholywind\tholywindcold\t\tln12\tvelocitypercent\t-dm34\tattackrate\t-dm34\tother_animrate\t-dm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcoldmindam\tenms*par5/256\tcoldmaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tHoly Fire\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t25\tSlow % Min\t60\tSlow % Max\t5\tDamage multiplier added to Attacks\t100\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t7\tDamage synergy\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t2\t1\t2\t3\t4\t5\t3\t1\t2\t3\t4\t5\tskill('Resist Cold'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Vigor\t115\tpal\tvigor\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tstamina\tstamina\t\tln12\tstaminarecoverybonus\tln34\tskill_staminapercent\tln34\tvelocitypercent\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCleansing\tDefiance\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t3\tRadius per level\t50\tStamina % baseline\t25\tStamina % per level\t7\tVelocity % Min\t50\tVelocity % Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Conversion\t116\tpal\tconversion\t32\t79\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tconversion\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tVengeance\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\tdm34\t% chance to convert\t0\tFlat Damage\t0\tAttack Speed %\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t400\tDuration baseline\t0\tDuration per level\t0\t% chance to convert Min\t90\t% chance to convert Max\t0\t\"Use sumskill1 on convert expire? (0 = Off | 1 = On) (If 1, then it needs to have ItemEffect=1)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Holy Shield\t117\tpal\tholy shield\t36\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tholyshield\t\tln12\t\ttoblock\tdm56\t\tln34+skill('Defiance'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_holyshield\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\tshld\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCharge\tBlessed Hammer\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t35\t0\t1\t1\t\t\t\t\t\t\t\t\t\tln34+skill('Defiance'.blvl)*par8\tArmor %\t\t\t\t\t\t\t\t\t\t\t750\tDuration baseline\t625\tDuration per level\t25\tArmor % baseline\t15\tArmor % per level\t10\tBlock % chance Min\t40\tBlack % chance Max\t\t\t15\tArmor synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t3\t2\t3\t4\t4\t4\t6\t2\t3\t4\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Holy Shock\t118\tpal\tholy shock\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\tholyshock\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightmindam\t1\tlightmaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tHoly Freeze\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t\t\t\t\t6\tDamage multiplier added to Attacks\t100\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t4\tDamage synergy\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t\t\t\t\t\t10\t6\t8\t10\t12\t15\tskill('Resist Lightning'.blvl)*par8+skill('Salvation'.blvl)*par7\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Sanctuary\t119\tpal\tsanctuary\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t59270\tsanctuary\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_undeaddamage_percent\tln34\titem_undead_tohit\tln56\tskill_bypass_undead\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcast_undead\t\t\t\t\t\t\t\t\t\tsanctuarybolt\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tThorns\tHoly Freeze\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t1\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tRadius baseline\t1\tRadius per level\t150\tDamage to Undead % baseline\t30\tDamage to Undead % per level\t100\tAttack Rating to Undead baseline\t50\tAttack Rating to Undead per level\t100\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t7\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t11\t\t157\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t8\t4\t4\t5\t5\t6\t16\t4\t5\t6\t6\t7\tskill('Cleansing'.blvl)*par8\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Meditation\t120\tpal\tmeditation\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73729\tmeditation\tmeditation\t\tln12\tmanarecoverybonus\tln34\thitpoints\tskill('Prayer'.edns)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCleansing\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t300\tMana Recovery % baseline\t25\tMana Recovery % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Fist of the Heavens\t121\tpal\tfist of the heavens\t\t80\t\t\t\t\t\t\t\t\t\t\t\t\tfistoftheheavensdelay\t\t\t\thandofgod\t42371\t\t\t\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpaladin_handofgod_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\t\t\t\t\t\tfistoftheheavensdelay\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t4\t1\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t4\t\t\t\t\t\t\t30\t20\t\t\t\t\tBlessed Hammer\tConversion\t\t\t\t\t\t10\t\t1\t1\t\t\t\t\t1\t8\t25\t0\t1\t\t\t\t\t\t\t\t\t\t\tln34\tHeal Min value\tln56\tHeal Max value\t\t\tln12\t# of Holy Bolt missiles created\t\t\t\t\t6\t# of Holy Bolt Missiles created baseline\t1\t# of Holy Bolt Missiles created per level\t1\tMin HP Healed baseline\t2\tMin HP Healed per level\t6\tMax HP Healed baseline\t2\tMax HP Healed per level\t\t\t7\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t150\t15\t30\t45\t55\t65\t200\t15\t30\t45\t55\t65\tskill('Holy Shock'.blvl)*par8\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Fanaticism\t122\tpal\tfanaticism\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tfanaticism\tfanaticism\t\tln12\tattackrate\tdm34\titem_tohit_percent\ttoht\tdamagepercent\tln56/2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdamagepercent\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tConcentration\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\tRadius baseline\t1\tRadius per level\t10\tAttack Speed % Min\t40\tAttack Speed % Max\t50\tDamage % baseline\t17\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t40\t5\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Conviction\t123\tpal\tconviction\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42371\tconviction\tconviction\t\tln12\tskill_armor_percent\t-dm56\tfireresist\t\"-min(ln34,150)\"\tcoldresist\t\"-min(ln34,150)\"\tlightresist\t\"-min(ln34,150)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t5\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tSanctuary\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tRadius baseline\t0\tRadius per level\t30\tResistance % reduction baseline\t5\tResistance % reduction per level\t40\tArmor % reduction Min\t100\tArmor % reduction Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Redemption\t124\tpal\tredemption\t\t82\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4354\tredemption\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tredemption\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tVigor\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\tdm34\t% chance to redeem\tln56\tHP gained\tln56\tMana gained\t\t\t\t\t\t\t16\tRadius baseline\t0\tRadius per level\t10\t% chance to redeem Min\t100\t% chance to redeem Max\t25\tHP and Mana gained baseline\t5\tHP and Mana gained per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Salvation\t125\tpal\tsalvation\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t73731\tresistall\tresistall\t\tln12\tfireresist\tdm34\tcoldresist\tdm34\tlightresist\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t0\t8\t0\t0\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t16\tRadius baseline\t2\tRadius per level\t50\tResistance % Min\t120\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Bash\t126\tbar\tbash\t32\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grunt_small_1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12+skill('Stun'.blvl)*par8\tDamage %\tln34\tFlat Damage\t0\tAttack Speed %\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t50\tDamage % baseline\t5\tDamage % per level\t1\tFlat Damage baseline\t1\tFlat Damage per level\t\t\t\t\t5\tAttack Rating synergy\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t15+lvl*5+skill('Concentrate'.blvl)*par7\t8\t\t112\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Blade Mastery\t127\tbar\tblade mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tblademastery\tblde\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Axe Mastery\t128\tbar\taxe mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\taxemastery\taxe\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Mace Mastery\t129\tbar\tmace mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmacemastery\tblun\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Howl\t130\tbar\thowl\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\thowl\t\t\t\t\t\t\tterror\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_howl_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\thowl\t\t\t\tln12-par1\tMissile Velocity Adder\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12-par1\tMissile Velocity Adder\tln34\tMonster Fear Distance To Run\tln56\tMonster Fear Duration\t\t\t\t\t\t\t12\t\"Missile Velocity baseline (Should match howl Missile Vel value, used for negation)\"\t2\tMissile Velocity per level\t24\tMonster Fear Distance To Run baseline\t5\tMonster Fear Distance To Run per level\t75\tMonster Fear Duration baseline\t25\tMonster Fear Duration per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Find Potion\t131\tbar\tfind potion\t33\t69\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_findobject_1\t\t\t\t\t\t\tbarbarian_findheart_1\t\t\t\t\t\t26\t38\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t1\t\t4\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t\t\tdm12\t% chance to find any potion\t\t\t\t\t\t\t\t\t\t\t0\t% chance to find any potion Min\t100\t% chance to find any potion Max\t30\t% chance to find Mana potion\t10\t% chance to find Rejuvenation potion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t3000\t0\n",
+                u8"Leap\t132\tbar\tleap\t40\t77\t\t\t\t\t\t\t\t\t\t\t\t\tleapknockback\t\t\t\t\t\t\t\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_leap_1\t\t\t\t\t\t\t\t\t\t\t\t\t29\t43\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t13\t\t1\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t\t\tln34\tKnockback Radius\tpar7\tLeap Speed %\t\t\t\t\t\t\t\t\t8\tRange Min\t30\tRange Max\t4\tKnockback Radius baseline\t1\tKnockback Radius per level\t8\tMinimum Airborn Frames\t\t\t175\tLeap Speed %\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Double Swing\t133\tbar\tdouble swing\t68\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t27\t39\t\t\t\t\t\t\t\t\t\tpar5\tAttack Speed %\t\t\t\t\t\t\t1\t5\t\th2h\t3\tmele\t\t\t\t\tmele\t\t\t\t\tSQ\tA1\txx\t11\t\t1\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tBash\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t0\t5\t8\t-1\t1\t\t\t\t\t\t\t\t\t\t\tskill('Bash'.blvl)*par8\tDamage %\t0\tFlat Damage\tpar5\tAttack Speed %\t\t\t\t\t\t\t50\tAttack rate bonus\t\t\t\t\t\t\t50\tAttack Speed %\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t15\t5\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Pole Arm Mastery\t134\tbar\tpole arm mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpolearmmastery\tpole\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Throwing Mastery\t135\tbar\tthrowing mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tthrowingmastery\tthro\t\tpassive_mastery_throw_th\tln12\tpassive_mastery_throw_dmg\tln34\tpassive_mastery_throw_crit\tdm56\tskill_pierce\tdm78\tpassive_mastery_noconsume\tdm91\tpassive_mastery_replenish_oncrit\tpa11\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t0\t% chance to Pierce Min\t55\t% chance to Pierce Max\t0\t% chance for No Consume Min\t66\t% chance for No Consume Max\t1\t\"Replenish Quantity on crit? (0=disabled, 1=enabled)\"\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Spear Mastery\t136\tbar\tspear mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspearmastery\tspea\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\tAttack Rating % baseline\t8\tAttack Rating % per level\t28\tDamage % baseline\t5\tDamage % per level\t0\t% chance for Critical Hit Min\t35\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Taunt\t137\tbar\ttaunt\t\t71\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34179\t\ttaunt\t\t\titem_tohit_percent\tln12\tdamagepercent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_taunt_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tHowl\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t-5\tMonster Attack Rating % baseline\t-2\tMonster Attack Rating % per level\t-5\tMonster Damage % baseline\t-2\tMonster Damage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\t384\t3000\t0\n",
+                u8"Shout\t138\tbar\tshout\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\tshout\t\t\t\t\t\tshout\tshout\tln34+(skill('Battle Orders'.blvl)+skill('Battle Command'.blvl))*par8\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_shout_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tshout\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tHowl\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t6\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t100\tArmor % baseline\t10\tArmor % per level\t750\tDuration baseline\t250\tDuration per level\t\t\t\t\t\t\t125\tDuration synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Stun\t139\tbar\tstun\t32\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grunt_small_1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tBash\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t\t\tskill('Bash'.blvl)*par8\tDamage %\t0\tFlat Damage\t0\tAttack Speed %\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t30\tStun Length baseline\t5\tStun Length per level\t\t\t\t\t\t\t5\tDuration synergy\t5\tAttack Rating synergy\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t10+lvl*5+skill('Concentrate'.blvl)*par7\t\t\t96\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tstun\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t5\t5\t2\tskill('War Cry'.blvl)*par6\t\t\t512\t8000\t0\n",
+                u8"Double Throw\t140\tbar\tdouble throw\t\t74\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t42\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\trng\t3\tthro\t\t\t\t\tthro\t\t\t\t\tSQ\tA1\txx\t15\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tDouble Swing\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t1\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12+skill('Double Swing'.blvl)*par8\tDamage %\t\t\t\t\t\t\t\t\t\t\t16\tDamage % baseline\t8\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t20\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Increased Stamina\t141\tbar\tincreased stamina\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tincreasedstamina\t\t\tskill_passive_staminapercent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tStamina % baseline\t15\tStamina % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Find Item\t142\tbar\tfind item\t34\t72\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_findobject_1\t\t\tbarbarian_findheart_1\t\t\t\t\t\t\t\t\t\t28\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t1\t\t5\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tFind Potion\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\tdm12+skill('Find Potion'.blvl)*par8\t% chance to find any item\t\t\t\t\t\t\t\t\t\t\t5\t% chance to find any item Min\t60\t% chance to find any item Max\t30\t% chance for high quality item\t5\t% chance for magic item\t\t\t\t\t\t\t1\t% chance synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Leap Attack\t143\tbar\tleap attack\t41\t78\t\t\t\t\t\t\t\t\t\t\t\t\tleapattack\t\t\t\tbash\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_leapattack_1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t44\t\t\t\t\t\tleapattack\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\tmele\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t14\t\t1\t\t4\t1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tLeap\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\tln34+skill('Leap'.blvl)*par8\tDamage %\tpar7\tLeap Speed %\t\t\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t200\tDamage % baseline\t30\tDamage % per level\t12\tMinimum Airborn Frames\t\t\t175\tLeap Speed %\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t100\t20\t\t\t\t\t\t8\t128\t10\t4\t8\t12\t16\t20\t20\t8\t16\t24\t32\t40\tskill('Leap'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Concentrate\t144\tbar\tconcentrate\t32\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdoubledamage1\t\tconcentrate\t\t\t\tskill_armor_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grunt_small_1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tStun\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t\t\t\t\t\t\t\t\t\t\t\tln12+skill('Bash'.blvl)*par8+skill('Battle Orders'.blvl)*par7\tDamage %\t0\tFlat Damage\t0\tAttack Speed %\tskill('Berserk'.blvl)\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t70\tDamage % baseline\t5\tDamage % per level\t100\tArmor % baseline\t10\tArmor % per level\t\t\t\t\t10\tDamage synergy\t5\tDamage synergy\t\t\t\t\t\t\t\t\t1\t60\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Iron Skin\t145\tbar\tiron skin\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tironskin\t\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tArmor % baseline\t10\tArmor % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Battle Cry\t146\tbar\tbattle cry\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\tbattlecry\t\t\t\t\t98304\t\tbattlecry\tln12\t\tskill_armor_percent\tln34\tdamagepercent\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_battlecry_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tbattlecry\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tTaunt\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t5\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t300\tDuration baseline\t60\tDuration per level\t-50\tEnemy Armor % baseline\t-2\tEnemy Armor % per level\t-25\tEnemy Damage % baseline\t-1\tEnemy Damage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Frenzy\t147\tbar\tfrenzy\t67\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfrenzy\t\tpar7+skill('Increased Stamina'.blvl)*10\t\tvelocitypercent\tdm34\tattackrate\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t39\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\th2h\t3\tmele\t\t\t\t\tmele\t\t\t\t\tSQ\tA1\txx\t11\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tDouble Throw\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t3\t0\t\t\t\t\t\t\t\t\t\t\t\tln12+(skill('Double Swing'.blvl) + skill('Taunt'.blvl))*par8\tDamage %\t\t\t\t\tskill('Berserk'.blvl)\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t90\tDamage % base\t5\tDamage % per level\t20\tVelocity % Min\t200\tVelocity % Max\t0\tAttack Speed % Min\t50\tAttack Speed % Max\t150\tDuration\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t100\t7\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Increased Speed\t148\tbar\tincreased speed\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tincreasedspeed\t\t\tvelocitypercent\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tIncreased Stamina\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\tVelocity %\t50\tVelocity % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Battle Orders\t149\tbar\tbattle orders\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\tbattleorders\t\t\t\t\t\tbattleorders\tbattleorders\tln12+(skill('Shout'.blvl)+skill('Battle Command'.blvl))*par8\t\titem_maxmana_percent\tln34\titem_maxhp_percent\tln34\tskill_staminapercent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_battleorders_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tbattleorders\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tShout\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t750\tDuration baseline\t250\tDuration per level\t35\tHP Mana Stamina % baseline\t3\tHP Mana Stamina % per level\t\t\t\t\t\t\t125\tDuration synergy\t\t\t\t\t\t\t\t\t1\t50\t10\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Grim Ward\t150\tbar\tgrim ward\t33\t75\t\t\t\t\t\t\t\t\t\t\t\t\tgrimwardmediumstart\tgrimwardsmallstart\tgrimwardlargestart\t\t\t2\t\tterror\tpar6\tln12\tvelocitypercent\t-dm78\tattackrate\t-dm78\tother_animrate\t-dm78\tdamageresist\t-par3 - (skill('Find Potion'.blvl) * par4)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grimward_1\t\t\t\t\t\t26\t41\t\t\t\t\t\tgrimwardmediumstart\tgrimwardsmallstart\tgrimwardlargestart\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t1\t\t6\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tFind Item\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t1000\tWard Duration (Min=5)\tln12\tRadius\t\t\t\t\t\t\t\t\t6\tRadius\t1\tRadius per level\t20\tDamage Taken % baseline\t5\tDamage Taken % per level\t10\tMonster Fear Distance\t60\tMonster Fear Duration\t0\tSlow % Min\t75\tSlow % Max\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Whirlwind\t151\tbar\twhirlwind\t38\t76\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twhirlwind\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tbarbarian_whirlwind\t\t\t\t\t\t\t\t\t\t\t\t\t\t31\t45\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t2\tmele\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t10\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tLeap Attack\tConcentrate\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t7\t25\t1\t\t\t\t\t\t\t\t\t\t\t\tln12\tDamage %\t\t\t\t\t\t\t\t\t\t\t30\tDamage % baseline\t5\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t50\t5\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Berserk\t152\tbar\tberserk\t39\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tberserk\t\t\"par4-min(((110*lvl)/(lvl+6)*(par4-par3)/100),(par4-par3))\"\t\tdamageresist\tpar5\tarmor_override_percent\t-100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_grunt_large_1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tConcentrate\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12+(skill('Howl'.blvl) + skill('Battle Orders'.blvl))*par8\tDamage %\t\"par4-min(((110*lvl)/(lvl+6)*(par4-par3)/100),(par4-par3))\"\tDuration\t\t\t100\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t150\tDamage % baseline\t15\tDamage % per level\t25\tDuration Min\t75\tDuration Max\t0\tArmor %\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t100\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Natural Resistance\t153\tbar\tnatural resistance\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnaturalresistance\t\t\tfireresist\tdm12\tlightresist\tdm12\tcoldresist\tdm12\tpoisonresist\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tIron Skin\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tResistance % Min\t80\tResistance % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"War Cry\t154\tbar\twar cry\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\twarcry\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_warcry_1\t\t\t\t\t\t\t\t\t\twarcry\t\t\t\t25\t\t\t\t\t\twarcry\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tBattle Cry\tBattle Orders\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t6\t40\t3\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\tStun Length\t\t\t\t\t25\tStun Length baseline\t5\tStun Length per level\t\t\t\t\t\t\t\t\t\t\t6\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t30\t8\t9\t10\t12\t14\t40\t8\t9\t10\t12\t14\t(skill('Howl'.blvl)+skill('Taunt'.blvl)+skill('Battle Cry'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Battle Command\t155\tbar\tbattle command\t\t68\t\t\t\t\t\t\t\t\t\t\t\t\tbattlecommand\t\t\t\t\t\tbattlecommand\tbattlecommand\tln12+(skill('Shout'.blvl)+skill('Battle Orders'.blvl))*par8\t\titem_allskills\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbarbarian_command_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tbattlecommand\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t9\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tBattle Orders\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t11\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t750\tDuration baseline\t250\tDuration per level\t1\tBonus to All Skills\t\t\t\t\t\t\t\t\t125\tDuration synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Fire Hit\t156\t\t\t42\t83\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t10\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"UnHolyBolt\t157\t\t\t\t85\t\t\t\t\t\t\t\t\t\t\t\t\tunholybolt1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tunholybolt1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"SkeletonRaise\t158\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t1\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MaggotEgg\t159\t\t\t43\t84\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsandmaggotegg_hatch_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t46\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t \t\"(lvl < 5) ? lvl : min(12,5+(lvl-5)/3)\"\t# of units to spawn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"ShamanFire\t160\t\t\t\t85\t\t\t\t\t\t\t\t\t\t\t\t\tshafire1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MagottUp\t161\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsandmaggot_emerge\t\t\t\t\t\t\t\t\t\t\t\t\t\t32\t\t\t\t\t\t\tdirt pile\tsand pile\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MagottDown\t162\t\t\t45\t86\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsandmaggot_burrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t33\t47\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t10\tHP % Healed\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MagottLay\t163\t\t\t\t87\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"AndrialSpray\t164\t\t\t46\t88\t\t\t\t\t\t\t\t\t\t\t\t\tandarielspray\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t34\t48\t\t\t\t\t\tandarielspray\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Jump\t165\t\t\t47\t89\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t10\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t15\t5\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Swarm Move\t166\t\t\t48\t90\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t35\t49\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t11\tAnim Sequence Start Frame\t19\tAnim Sequence Stop Frame\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Nest\t167\t\t\t49\t91\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Quick Strike\t168\t\t\t50\t92\t\t\t\t\t\t\t\t\t\t\t\t\traven1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"VampireFireball\t169\t\t\t\t\t\t\t\t\t\t\t\t\t\tvampirefireball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvampirefireball\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"VampireFirewall\t170\t\t\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\tvampirefirewallmaker\tvampirefirewall\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t26\t\t\t\t\t\tvampirefirewallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t0\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"VampireMeteor\t171\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tvampiremeteorcenter\t\t\t\t\t\t\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_meteor\t\t\t\t\t\t\tfire_cast_2\t\t\t\t28\t\t\t\t\t\tvampiremeteorcenter\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln12\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t5\tExplosion Radius baseline\t1\tExplosion Radius per level\t30\tDuration of ground fire baseline\t15\tDuration of ground fire per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t5\t5\t5\t5\t5\t5\t10\t5\t5\t5\t5\t5\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"GargoyleTrap\t172\t\t\t\t93\t\t\t\t\t\t\t\t\t\t\t\t\tshafire3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t51\t\t\t\t\t\tshafire3\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"SpiderLay\t173\t\t\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\tspidergoolay\t\t\t\t\t\tspiderlay\tslowed\t300\t\tvelocitypercent\t-100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspidergoolay\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tFrames to apply aura to target\t\t\t\t\t30\tSlow Duration per level\t75\tBuff Duration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"VampireHeal\t174\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"VampireRaise\t175\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t1\t1\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Submerge\t176\t\t\t51\t94\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t37\t52\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"FetishAura\t177\t\t\t\t111\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_curse_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t53\t\t\t\t\t\tcurseeffectred\t\t\t\t3\tMissile Density\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tAttack Speed % baseline\t50\tDuration baseline & per level\t5\tAttack Speed % per level\t10\tRadius baseline (+2 per level)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"FetishInferno\t178\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tfetishinferno1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t54\t54\t\t\t\t\t\tfetishinferno1\tfetishinferno2\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t3\tAnim Frame Density (Min=1)\t\t\t\t\t\t\t15\tAnim Frame Adder (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"ZakarumHeal\t179\t\t\t\t96\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\treceiving\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\treceiving\t\t\t\thealing\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t15+5*lvl\tHeal % Min\t50\tHeal % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Emerge\t180\t\t\t52\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t38\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Resurrect\t181\t\t\t\t97\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfallenshaman_resurrect_cast\t\t\t\t\t\t\t\t\t\t\thealing\t\t\t39\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t1\t1\t1\t\t1\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Bestow\t182\t\t\t\t96\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\treceiving\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\treceiving\t\t\t\thealing\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t15+5*lvl\tHeal % Min\t50\tHeal % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MissileSkill1\t183\t\t\t\t110\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonTeleport\t184\t\t\t\t98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_teleport\t\t\t\t\t\t\t\t\t\t\tteleport\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"PrimeLightning\t185\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonsterlight\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto_lightning_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonsterlight\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"PrimeBolt\t186\t\t\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\tchargedstrikebolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto_chargedbolt_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t\t\t\t\t\tchargedbolt\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl+2\t# of Bolt Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"PrimeBlaze\t187\t\t\t\t23\t\t\t\t\t\t\t\t\t\t\t\t\tblaze\t\t\t\t\t\tblaze\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_fire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tblaze\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tBuff Duration Min\t60\tBuff Duration Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"PrimeFirewall\t188\t\t\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\tvampirefirewallmaker\tvampirefirewall\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_fire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t26\t\t\t\t\t\tvampirefirewallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t0\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"PrimeSpike\t189\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonglacialspike\t\t\t\t\t\t\t\t\t\t\tln12\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_cold\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonglacialspike\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t0\tRadius per level\t25\tFreeze frames baseline\t10\tFreeze frames per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"PrimeIceNova\t190\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tfrostnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_cold\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tfrostnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"PrimePoisonball\t191\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto_orb_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t17\t\t\t\t\t\tpoisonball\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\"min(ln12,24)\"\t# of Missiles created\tpar3\tMissile Activation Frame\t0\t# of missiles that can trigger item modifier events\t\t\t\t\t\t\t3\t# of Missiles created baseline\t0\t# of Missiles created per level\t1\tMissile Activation Frame\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"PrimePoisonNova\t192\t\t\t\t99\t\t\t\t\t\t\t\t\t\t\t\t\tprimepoisoncloud\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t55\t\t\t\t\t\tprimepoisoncloud\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl-1\t# of Missile Subloops\t2\tMissiles Created Modifier (used as 16/#=Total Missiles created) (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"DiabLight\t193\t\t\t53\t152\t\t\t\t\t\t\t\t\t\t\t\t\tdiablight\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_laser_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\t56\t\t\t\t\t\tdiablight\t\t\t\t0\tDelay between Missiles created\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t2\tMissile Frame Density (Min=1)\t\t\t\t\t\t\t40\tAnim Frame Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"DiabCold\t194\t\t\t\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_cold_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t200\tFrames\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t15\t9\t9\t9\t9\t9\t25\t12\t12\t12\t12\t12\t\t100\t50\t50\t50\t\t\t\t\t0\t0\n",
+                u8"DiabFire\t195\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tdiabfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_fire_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tdiabfire\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"FingerMageSpider\t196\t\t\t\t101\t\t\t\t\t\t\t\t\t\t\t\t\tfingermagespider\t\t\t\t\t\t\tfingermagecurse\tln12\t\tmanarecovery\t-par3 * lvl\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfingermage_bolt_cast_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t57\t\t\t\t\t\tfingermagespider\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl-1\t# of Missile Subloops\t\t\t\t\t\t\t\t\t\t\t30\tDuration for Mana drain baseline\t10\tDuration for Mana drain per level\t24\tMana Recovery % Reduction\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"DiabWall\t197\t\tfirestorm\t\t102\t\t\t\t\t\t\t\t\t\t\t\t\tdiabwallmaker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_fire_cast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t58\t\t\t\t\t\tdiabwallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\tlvl\t# of Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"DiabRun\t198\t\t\t54\t103\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_run\t\t\t\t\t\t\t\t\t\t\t\t\t\t41\t59\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t20\tVelocity %\t\t\t\t\t\t\t\t\t\t\t8\tAnim Run Stop Frame Length\t14\tAnim Run Stop Event Frame\t5\tAnim Run Start Event Frame\t13\tAnim Run Loop Repeat Event Frame\t16\tAnim Run Loop Frame Length\t6\tAnim Run Loop Start Event Frame\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t5\t\t\t\t8\t\t17\t9\t9\t9\t9\t9\t33\t9\t9\t9\t9\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"DiabPrison\t199\t\t\t\t104\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tboneprison1\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdiablo_boneprison_rise\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"PoisonBallTrap\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap poison ball left\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap poison ball left\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t10\t10\t10\t10\t10\t20\t10\t10\t10\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"AndyPoisonBolt\t201\t\t\t\t\t\t\t\t\t\t\t\t\t\tandypoisonbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tandypoisonbolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"HireableMissile\t202\t\t\t\t110\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"DesertTurret\t203\t\t\t\t105\t\t\t\t\t\t\t\t\t\t\t\t\tdesertfireball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t60\t\t\t\t\t\tdesertfireball\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t26\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t3\t# of Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"ArcaneTower\t204\t\t\t\t106\t\t\t\t\t\t\t\t\t\t\t\t\tlightningtowernova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightningorb_attack_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t61\t\t\t\t\t\tlightningtowernova\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t27\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonBlizzard\t205\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tmonblizcenter\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_cold\t\t\t\t\t\t\t\t\t\t\tice_cast_2\t\t\t\t28\t\t\t\t\t\tmonblizcenter\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Mosquito\t206\t\t\t55\t107\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42\t62\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t4\t# of Anim loops Min (1 loop = 1 frame)\t7\t# of Anim Frame loops Max (1 loop = 1 frame)\t25\tHeal % of current HP\t\t\t\t\t\t\t12\tAnim Repeat Start Frame\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t2\t2\t2\t2\t2\t2\t4\t2\t2\t2\t2\t2\t\t\t2\t3\t3\t3\t3\t3\t4\t3\t3\t3\t3\t3\t\t200\t\t\t\t\t\t\t\t0\t0\n",
+                u8"CursedBallTrapRight\t207\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap cursed skull right\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap cursed skull right\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t5\t5\t5\t5\t5\t20\t5\t5\t5\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"CursedBallTrapLeft\t208\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap cursed skull left\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\ttrap cursed skull left\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t5\t5\t5\t5\t5\t20\t5\t5\t5\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonFrozenArmor\t209\t\t\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfrozenarmor\t\tln34\t\tskill_armor_percent\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_cold\t\t\t\tsorceress_frozenarmor\t\t\t\t\t\t\tice_cast_3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tArmor % baseline\t5\tArmor % per level\t3600\tDuration\t300\tDuration per level\t30\tFreeze Frames\t3\tFreeze Frames per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t0\t0\n",
+                u8"MonBoneArmor\t210\t\t\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbonearmor\t\t\t\tbonearmor\tln12*256\tbonearmormax\tln12*256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_bonearmor\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tDamage absorbed baseline\t10\tDamage absorbed per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonBoneSpirit\t211\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\tmonbonespirit\tmonbonespirit\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_cast_fire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t\t\t\t\t\tmonbonespirit\tmonbonespirit\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t15\tSearch range\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonCurseCast\t212\t\t\t\t112\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseeffectred\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t5\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tRadius baseline\t1\tRadius per level\t300\tDuration baseline\t60\tDuration per level\t25\tResistance % reduction Min\t70\tResistance % reduction Max\t-50\tAttack Speed % and Velocity %\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"HellMeteor\t213\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\thellmeteordown\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"RegurgitatorEat\t214\t\t\t\t108\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tregurgitator_eat_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t63\t\t\t\t\t\tcorpseexplosion\tbigblood1\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t33\tHeal % of target's max HP\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonFrenzy\t215\t\t\t64\t109\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonfrenzy\t\tln12\t\tvelocitypercent\tdm34\tattackrate\tdm34\tother_animrate\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t200\tDuration baseline\t25\tDuration per level\t30\tSpeed % Min\t110\tSpeed % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"QueenDeath\t216\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t64\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t41\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Scroll of Identify\t217\t\tscroll of identify\t\t113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Book of Identify\t218\t\tbook of identify\t\t113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Scroll of Townportal\t219\t\tscroll of townportal\t\t113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Book of Townportal\t220\t\tbook of townportal\t\t113\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Raven\t221\tdru\traven\t\t114\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruidhawk\traven\t\"min(lvl,par2)\"\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t6\t0\t1\t1\t\t\t\t\t\t\t\t\t\t0\tHP %\tulvl + par1 + lvl\tSummon Pet Level (Min=1)\tln56\t# of hits\t\t\t\t\t\t\t-2\tSummon Pet Level baseline\t5\t# of max ravens\t\t\t\t\t12\t# of hits baseline\t1\t# of hits per level\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t100\t30\t\t\t\t\t\t8\t\t2\t1\t4\t8\t14\t20\t4\t2\t5\t9\t15\t21\t(skill('Summon Spirit Wolf'.blvl)+skill('Summon Fenris'.blvl)+skill('Summon Grizzly'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Plague Poppy\t222\tdru\tplague poppy\t\t115\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvine_beast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tplaguepoppy\tvine\t1\tS1\tVine Attack\tlvl\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t8\t0\t1\t1\t\t\t\t\t\t\t\t\t\tpar3 * (lvl-1)\tHP %\tulvl * 3 / 4 + lvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t50\tHP % per level\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t16\t16\t16\t32\t64\t80\t24\t16\t18\t36\t68\t84\tskill('Rabies'.blvl)*par8\t100\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Wearwolf\t223\tdru\twearwolf\t\t116\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twolf\t\t1000+skill('Shape Shifting'.ln12)\t\tskill_staminapercent\tpar1\tattackrate\tdm34\titem_tohit_percent\ttoht\titem_maxhp_percent\tpar2+skill('Shape Shifting'.ln34)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twolf_into\twolf_undo\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t22\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t25\t0\t1\t\t\t\t\t1\t8\t15\t0\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\tStamina %\t25\tHP %\t10\tAttack Speed % Min\t80\tAttack Speed % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tAllow Instant Direct Transformation\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Shape Shifting\t224\tdru\tshape shifting\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\tWearwolf\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1000\tDuration baseline\t500\tDuration per level\t20\tHP % baseline\t5\tHP % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Firestorm\t225\tdru\tfirestorm\t\t117\t\t\t\t\t\t\t\t\t\t\t\t\tfirestormmaker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_b\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_1\t\t\t\t67\t\t\t\t\t\tfirestormmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tdruid_firecast_b\tdruid_fire_cast_1\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t15\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\tln12\t# of Missiles created\t\t\t\t\t\t\t\t\t\t\t3\t# of Missiles created baseline\t0\t# of Missiles created per level\t\t\t\t\t\t\t\t\t\t\t23\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t3\t3\t5\t7\t14\t21\t6\t3\t6\t8\t15\t23\t(skill('Molten Boulder'.blvl)+skill('Eruption'.blvl))*par8\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Oak Sage\t226\tdru\toak sage\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonresist\t100\tmaxpoisonresist\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\toaksage\ttotem\t1\tNU\tOak Sage Aura\tlvl\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t1\t1\t1\t\t\t\t\t\t\t\t\t\t(lvl-1)*par3\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t30\tAura HP % baseline (must match Oak Sage Aura Param3)\t5\tAura HP % per level (must match Oak Sage Aura Param4)\t30\tHP % per level\t\t\t\t\t\t\t30\tRadius baseline (must match Oak Sage Aura Param1)\t2\tRadius per level (must match Oak Sage Aura Param2)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Summon Spirit Wolf\t227\tdru\tsummon spirit wolf\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\t\"min(par8 * lvl,85)\"\tcoldresist\t\"min(par8 * lvl,85)\"\tlightresist\t\"min(par8 * lvl,85)\"\tpoisonresist\t\"min(par8 * lvl,85)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_armor_percent\t(par4 * lvl) + ln56\ttohit\tln12\tcoldmindam\tedmn\tcoldmaxdam\tedmx\tcoldlength\tedln\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspiritwolf\tspiritwolf\t\"min(lvl,par3)\"\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tRaven\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t0\t1\t1\t\t\t\t\t\t\t\t\t\t(par7 * lvl) + skill('Summon Fenris'.par2) * skill('Summon Fenris'.lvl)\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t50\tAttack Rating % baseline (also used for synergy)\t25\tAttack Rating % per level (also used for synergy)\t5\t# of max wolves\t7\tArmor % per level\t50\tArmor % baseline (also used for synergy)\t10\tArmor % per level (also used for synergy)\t10\tHP % per level\t5\tResistance % per level\t\t\t\t\t\t\t\t\t1\t75\t20\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t2\t1\t3\t4\t5\t8\t6\t1\t3\t4\t5\t8\tskill('Summon Grizzly'.ln12)\t25\t25\t25\t25\t25\t\t\t384\t3000\t0\n",
+                u8"Wearbear\t228\tdru\twearbear\t\t116\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbear\t\t1000+skill('Shape Shifting'.ln12)\t\tdamagepercent\tln12\tskill_armor_percent\tln34\titem_maxhp_percent\tpar5 + skill('Shape Shifting'.ln34)\tskill_concentration\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbear_into\tbear_undo\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t22\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t1\t\t\t\t\t25\t0\t1\t\t\t\t\t1\t8\t15\t0\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t55\tDamage % baseline\t15\tDamage % per level\t40\tArmor % baseline\t10\tArmor % per level\t75\tHP %\t100\t% chance for uninterruptible attack\t\t\t\t\t\t\t\t\t\t\t1\tAllow Instant Direct Transformation\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Molten Boulder\t229\tdru\tmolten boulder\t\t\t\t\t\t\t\t\t\t\t\tmoltenboulderemerge\t\t\t\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_b\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_1\t\t\t\t\t\t\t\t\tmoltenboulderemerge\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\tdruid_firecast_b\tdruid_fire_cast_1\t\t6\t20\t\t\t\t\tFirestorm\t\t\t\t\t\t\t25\t\t1\t1\t\t\t\t\t1\t7\t20\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\tExplosion Radius\t\t\t\t\t\t\t\t\t\t\t12\tPhysical Damage synergy\t8\tFire Damage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t6\t4\t7\t10\t13\t16\t12\t5\t8\t11\t14\t17\tskill('Volcano'.blvl)*par7\tfire\t6\t4\t7\t10\t13\t16\t12\t5\t8\t11\t14\t17\tskill('Firestorm'.blvl)*par8\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"Arctic Blast\t230\tdru\tarctic blast\t11\t19\t\t\t\t\t\t\t\t\t\t\t\t\tarcticblast1\t\t\t\t\t\t\t\t\tln12/4-2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tarctic_blast_cast\tdruid_windcast\t\t\t\t15\t24\t\t\t\t\t\tarcticblast1\tarcticblast2\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t18\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t1\t\t\t6\t0\t2\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\tln12/2\tRange (Duration of Missile) (Min=1)\t20\tDuration to channel if caster is a Monster (Min=1)\t\t\t\t\t\t\t\t\t35\tRange baseline (Duration of missile)\t2\tRange per level (Duration of missile)\t4\tMin Mana required to start casting\t\t\t\t\t\t\t\t\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t32\t20\t26\t28\t32\t36\t64\t21\t27\t29\t33\t37\tskill('Cyclone Armor'.blvl)*par8\t100\t15\t15\t15\t\t\t\t384\t3000\t0\n",
+                u8"Cycle of Life\t231\tdru\tcycle of life\t\t115\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvine_beast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcycleoflife\tvine\t1\tS1\tVine Attack\tlvl\tCorpseCycler\tlvl\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tPlague Poppy\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t10\t0\t1\t1\t\t\t\t\t\t\t\t\t\tpar3 * (lvl-1)\tHP %\tulvl * 3 / 4 + lvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t25\tHP % per level\t\t\t4\tLifesteal % baseline (must match CorpseCycler Param1)\t1\tLifesteal % per level (must match CorpseCycler Param2)\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t3000\t0\n",
+                u8"Feral Rage\t232\tdru\tferal rage\t56\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tferalrage\t\tpar1\t\tvelocitypercent\tdm34\tlifedrainmindam\tpar2 * lvl\tlifedrainmaxdam\tpar2 * lvl\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tWearwolf\t\t\t2\twolf\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\tln56\tDamage %\tlvl/par7 + par8\t# of Max Charges\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t500\tDuration\t4\tLifesteal % per Charge\t10\tVelocity % Min\t70\tVelocity % Max\t50\tDamage % baseline\t5\tDamage % per level\t2\t# of Levels needed per max Charge gained\t3\t# of max Charges Min\t\t\t\t\t\t\t\t\t1\t20\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t3000\t0\n",
+                u8"Maul\t233\tdru\tmaul\t56\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmaul\t\tpar4\t\tdamagepercent\tlvl*par3\tstunlength\tdm56\tattackrate\tlvl*par1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tWearbear\t\t\t2\tbear\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\tlvl/par7 + par8\t# of Max Charges\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t3\tAttack Speed % per Charge\t\t\t30\tDamage % per Charge\t500\tDuration\t10\tStun Length Min\t100\tStun Length Max\t2\t# of Levels needed per max Charge gained\t3\t# of max Charges Min\t\t\t\t\t\t\t\t\t1\t40\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t3000\t0\n",
+                u8"Eruption\t234\tdru\teruption\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\terruption center\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_a\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_2\t\t\t\t28\t\t\t\t\t\terruption center\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tdruid_firecast_a\tdruid_fire_cast_2\t\t12\t20\t\t\t\t\tMolten Boulder\t\t\t\t\t\t\t50\t\t0\t1\t\t\t\t\t1\t8\t15\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tRadius\tpar2\tMissile Delay\t\t\t\t\t\t\t\t\t7\tRadius to create Missiles\t6\tMissile Spawn Rate (Min=1)\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t15\t6\t12\t16\t18\t22\t25\t6\t12\t16\t19\t23\t(skill('Firestorm'.blvl)+skill('Volcano'.blvl))*par8\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Cyclone Armor\t235\tdru\tcyclone armor\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcyclonearmor\t\t\t\tbonearmor\t(ln12*(100+(skill('Twister'.blvl)+skill('Tornado'.blvl)+skill('Hurricane'.blvl))*par8)/100)*256\tbonearmormax\t(ln12*(100+(skill('Twister'.blvl)+skill('Tornado'.blvl)+skill('Hurricane'.blvl))*par8)/100)*256\t\t\t\t\t\t\t\t\tabsorbdamage\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_cyclonearmor\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tArctic Blast\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t5\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t40\tElemental Damage Absorbed baseline\t12\tElemental Damage Absorbed per level\t\t\t\t\t\t\t\t\t\t\t7\tDamage Absorbed synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t512\t8000\t0\n",
+                u8"Heart of Wolverine\t236\tdru\theart of wolverine\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonresist\t100\tmaxpoisonresist\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\theartofwolverine\ttotem\t1\tNU\tWolverine Aura\tlvl\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tOak Sage\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t1\t1\t1\t\t\t\t\t\t\t\t\t\t(lvl-1)*par1\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t25\tHP % per level\t3\tBonus Level\t25\tAttack Rating % baseline (must match Wolverine Aura)\t7\tAttack Rating % per level (must match Wolverine Aura)\t20\tDamage % baseline (must match Wolverine Aura Param5)\t7\tDamage % per level (must match Wolverine Aura Param6)\t30\tRadius baseline (must match Wolverine Aura Param1)\t2\tRadius per level (must match Wolverine Aura Param2)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t8000\t0\n",
+                u8"Summon Fenris\t237\tdru\tsummon fenris\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\t\"min(par8 * lvl,85)\"\tcoldresist\t\"min(par8 * lvl,85)\"\tlightresist\t\"min(par8 * lvl,85)\"\tpoisonresist\t\"min(par8 * lvl,85)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_armor_percent\t(par6 * lvl) + skill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par6)\ttohit\tskill('Summon Spirit Wolf'.lvl) * skill('Summon Spirit Wolf'.par2)\tdamagepercent\tskill('Summon Grizzly'.ln12)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfenris\tfenris\t\"min(lvl,par3)\"\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tOak Sage\tSummon Spirit Wolf\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t1\t\t\t\t\t\t\t\t\t\t(par7 * lvl) + ln12\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t50\tHP % baseline (also used for synergy)\t15\tHP % per level (also used for synergy)\t3\t# of max wolves\t\t\t\t\t4\tArmor % per level\t10\tHP % per level\t5\tResistance % per level\t\t\t\t\t\t\t\t\t1\t150\t20\t\t\t\t\t\t8\t\t7\t2\t4\t8\t10\t12\t12\t3\t5\t9\t11\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t8000\t0\n",
+                u8"Rabies\t238\tdru\trabies\t57\t121\t\t\t\t\t\t\t\t\t\t\t\t\trabiesplague\t\t\t\t\t\t\trabies\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS3\tS3\tS3\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tFeral Rage\t\t\t2\twolf\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tDamage synergy\t\t\t\t\t\t\t\t\t1\t50\t10\t\t1\t2\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t6\t4\t5\t7\t11\t16\t14\t4\t5\t7\t11\t16\t(skill('Plague Poppy'.blvl))*par8\t100\t10\t10\t10\t\t\t\t640\t16000\t0\n",
+                u8"Fire Claws\t239\tdru\tfire claws\t58\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire_hit\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tFeral Rage\tMaul\t\t2\twolf\tbear\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t22\tDamage synergy\t\t\t\t\t\t\t\t\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t32\t16\t24\t32\t40\t48\t48\t17\t25\t33\t41\t49\t(skill('Firestorm'.blvl)+skill('Molten Boulder'.blvl))*par8\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Twister\t240\tdru\ttwister\t\t118\t\t\t\t\t\t\t\t\t\t\t\t\ttwister\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_windcast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t68\t\t\t\t\t\ttwister\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCyclone Armor\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of Missiles created\tpar2+par7*skill('Arctic Blast'.blvl)\tStun Length (Used by Missile pSrvDmgFunc function)\t\t\t\t\t\t\t\t\t3\t# of Missiles created\t10\tStun Length\t\t\t\t\t\t\t\t\t2\tDuration Synergy\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t12\t7\t11\t15\t18\t21\t16\t7\t11\t15\t18\t21\t(skill('Tornado'.blvl)+skill('Hurricane'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"Vines\t241\tdru\tvines\t\t115\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvine_beast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvinecreature\tvine\t1\tS1\tVine Attack\tlvl\tVineCycler\tlvl\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCycle of Life\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t14\t1\t1\t1\t\t\t\t\t\t\t\t\t\tpar3 * (lvl-1)\tHP %\tulvl * 3 / 4 + lvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t20\tHP % per level\t\t\t4\tManasteal % baseline (must match VineCycler Param1)\t1\tManasteal % per level (must match VineCycler Param2)\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t16000\t0\n",
+                u8"Hunger\t242\tdru\thunger\t\t122\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS3\tS3\tS3\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tFire Claws\t\t\t2\twolf\tbear\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t\t\tpar5\tDamage %\tdm12\tLifesteal %\tdm34\tManasteal %\t\t\t\t\t\t\t50\tLifesteal % Min\t200\tLifesteal % Max\t50\tManasteal % Min\t200\tManasteal % Max\t-75\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t50\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Shock Wave\t243\tdru\tshock wave\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\tshockwave\tshockwave\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t17\t\t\t\t\t\tshockwave\tshockwave\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tMaul\t\t\t2\tbear\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t5\t# of Missiles created\t0\tMissile Activation Frame\t0\t# of missiles that can trigger item modifier events\tln12\tStun Length\t0\t% Damage Synergy\t\t\t40\tStun Length baseline\t15\tStun Length per level\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t3\t5\t7\t7\t7\t20\t3\t5\t7\t7\t7\tskill('Maul'.blvl)*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Volcano\t244\tdru\tvolcano\t\t123\t\t\t\t\t\t\t\t\t\t\t\t\tvolcano\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_a\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_2\t\t\t\t97\t\t91\t\t\t\tvolcano\tvolcano overlay fire\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t1\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\tsorceress_cast_fire\tdruid_fire_cast_2\t\t24\t20\t\t\t\t\tEruption\t\t\t\t\t\t\t100\t\t0\t1\t\t\t\t\t1\t8\t25\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar2\tDelay between Missiles created\t\t\t\t\t12\tMissile Range\t2\tDelay between Missiles created\t\t\t\t\t\t\t\t\t16\tPhysical Damage synergy\t12\tFire Damage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t8\t2\t4\t6\t8\t10\t10\t2\t4\t6\t8\t10\tskill('Molten Boulder'.blvl)*par7\tfire\t8\t2\t4\t6\t8\t11\t10\t2\t4\t6\t8\t13\t(skill('Eruption'.blvl)+skill('Armageddon'.blvl))*par8\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Tornado\t245\tdru\ttornado\t\t118\t\t\t\t\t\t\t\t\t\t\t\t\ttornado\t\t\t\t\t42371\t\t\t\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_windcast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t69\t\t\t\t\t\ttornado\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tTwister\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t10\t0\t1\t\t\t\t\t\t\t\t\t\t\t1\t# of Missiles created\t\t\t\t\tpar1\tPeriodic Damage Delay\t\t\t\t\t15\tPeriodic Damage Delay\t3\tMissile Radius\t\t\t\t\t\t\t\t\t\t\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t25\t8\t14\t20\t24\t28\t35\t8\t15\t21\t25\t29\t(skill('Cyclone Armor'.blvl)+skill('Twister'.blvl)+skill('Hurricane'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"Spirit of Barbs\t246\tdru\tspirit of barbs\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpoisonresist\t100\tmaxpoisonresist\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspiritofbarbs\ttotem\t1\tNU\tBarbs Aura\tlvl\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tHeart of Wolverine\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t25\t1\t1\t1\t\t\t\t\t\t\t\t\t\t(lvl-1)*par1\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t25\tHP % per level\t0\tBonus Level\t\t\t\t\t\t\t\t\t\t\t2\tRadius per level (must match Barbs Aura Param2)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t32\t9\t18\t27\t36\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Summon Grizzly\t247\tdru\tsummon grizzly\t\t119\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\t\"min(par8 * lvl,85)\"\tcoldresist\t\"min(par8 * lvl,85)\"\tlightresist\t\"min(par8 * lvl,85)\"\tpoisonresist\t\"min(par8 * lvl,85)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_armor_percent\tskill('Summon Spirit Wolf'.lvl)* skill('Summon Spirit Wolf'.par6)\ttohit\tskill('Summon Spirit Wolf'.lvl) * skill('Summon Spirit Wolf'.par2)\tdamagepercent\tln12\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruidbear\tgrizzly\t1\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tSummon Fenris\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t40\t0\t1\t1\t\t\t\t\t\t\t\t\t\t(par7 * lvl) + skill('Summon Fenris'.par2) * skill('Summon Fenris'.lvl)\tHP %\tulvl\tSummon Pet Level (Min=1)\t\t\t\t\t\t\t\t\t25\tDamage % baseline (also used for synergy)\t10\tDamage % per level (also used for synergy)\t\t\t\t\t\t\t\t\t10\tHP % per level\t5\tResistance % per level\t\t\t\t\t\t\t\t\t1\t300\t20\t\t\t\t\t\t8\t\t30\t10\t15\t20\t26\t30\t60\t10\t15\t20\t26\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Fury\t248\tdru\tfury\t37\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t53\t21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tRabies\t\t\t2\twolf\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t\t\t\"min((par5 + lvl -1), par6)\"\t# of hits\tln34\tDamage %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t70\t% Anim frame rollback\t100\tDamage % baseline\t17\tDamage % per level\t2\t# of hits Min\t5\t# of hits Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t50\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Armageddon\t249\tdru\tarmageddon\t\t124\t\t\t\t\t\t\t\t\t\t\t\t\tarmageddoncontrol\tarmageddoncontrol\tarmageddoncontrol\t\t\t\tarmageddon\t\tln12 + skill('Eruption'.blvl) * par7\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_a\t\t\t\t\t\t\t\t\t\t\tdruid_fire_cast_2\t\t\t\t\t\t92\t\t\t\tarmageddontail\tarmageddonrock\t\t\t25\tMissile Frames\t25\tMissile Fall Rate\t15\tMissile Slide Rate\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tVolcano\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t35\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t250\tDuration baseline\t0\tDuration per level\t8\tRadius\t6\tDelay between Missiles created\t\t\t18\tPhysical Damage synergy\t50\tDuration synergy\t14\tFire Damage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t18\t10\t12\t15\t18\t22\t26\t11\t13\t16\t19\t23\tskill('Volcano'.blvl)*par6\tfire\t25\t15\t20\t25\t31\t38\t75\t16\t22\t27\t34\t40\t(skill('Molten Boulder'.blvl)+skill('Firestorm'.blvl))*par8\t\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Hurricane\t250\tdru\thurricane\t\t124\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\thurricane\t\tln12 + skill('Cyclone Armor'.blvl) * par7\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_windcast\t\t\t\t\t\t\t\t\t\tdruid_hurricane\t\t\t\t\t\t\t\t\t\t\thurricaneswoosh\thurricanerock\thurricanetree\t\t3\t# of Debris Missiles created\t75\tDebris Missile Max Height\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tTornado\t\t\t1\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t30\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t250\tDuration baseline\t0\tDuration per level\t9\tRadius\t20\tPeriodic Damage Delay\t\t\t\t\t50\tDuration synergy\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t1\t2\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t25\t7\t10\t12\t14\t16\t50\t7\t10\t12\t14\t16\t(skill('Twister'.blvl)+skill('Tornado'.blvl))*par8\t50\t\t\t\t\t\t\t896\t64000\t0\n",
+                u8"Fire Trauma\t251\tass\tfire trauma\t\t\t\t\t\t\t\t\t\t\t\tbomb in air\t\t1\t\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweapon_throw_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbomb in air\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t5\t24\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tRadius\t\t\t\t\t\t\t\t\t\t\t\t\t11\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t6\t3\t8\t20\t38\t58\t8\t5\t11\t24\t44\t66\t(skill('Shock Field'.blvl) + skill('Charged Bolt Sentry'.blvl) + skill('Lightning Sentry'.blvl) + skill('Wake of Fire Sentry'.blvl) + skill('Inferno Sentry'.blvl)) * par8\t\t\t\t\t\t5\t\t256\t1000\t0\n",
+                u8"Claw Mastery\t252\tass\tclaw mastery\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tclawmastery\th2h\t\tpassive_mastery_melee_th\tln12\tpassive_mastery_melee_dmg\tln34\tpassive_mastery_melee_crit\tdm56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\th2h\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tAttack Rating % baseline\t10\tAttack Rating % per level\t35\tDamage % baseline\t4\tDamage % per level\t0\t% chance for Critical Hit Min\t25\t% chance for Critical Hit Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t\t256\t1000\t0\n",
+                u8"Psychic Hammer\t253\tass\tpsychic hammer\t22\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tassassin_psychichammer\t\t\t\t\t\t\tpsychic_hammer_hit\tpaladin_holybolt_impact_1\t\t\tpsychic_hammer_curse\t\t\t5\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t4\t1\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t6\t16\t1\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tKnockback % VS Monster\tdm34\tKnockback % VS Unique Monster\tdm56\tKnockback % VS Boss\tdm56\tKnockback % VS Player\t\t\t\t\t100\tKnockback % VS Monster\t\t\t50\tKnockback % VS Unique Monster Min\t100\tKnockback % VS Unique Monster Max\t25\tKnockback % VS Boss Min\t99\tKnockback % VS Boss Max\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t2\t2\t3\t4\t5\t6\t6\t3\t4\t5\t6\t7\t\tmag\t2\t2\t3\t4\t5\t6\t6\t3\t4\t5\t6\t7\t\t\t\t\t\t\t5\t\t256\t1000\t0\n",
+                u8"Tiger Strike\t254\tass\ttiger strike\t23\t34\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\tprogressive_damage\t\tpar3\t\tprogressive_damage\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassinfootimpact\t\ttigerstrike1\tassassin_chargeup_tiger_1\t\t\t\t\t\t\t12\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t1\t0\t1\t\t\t\t\t\t\t\t\t1\t\tln12\tDamage %\t\t\t\t\t\t\t\t\t\t\t100\tDamage % baseline\t20\tDamage % per level\t375\tDuration\t50\tAttack Rating % per Charge\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t\t256\t1000\t0\n",
+                u8"Dragon Talon\t255\tass\tdragon talon\t24\t42\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_kick_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t4\t\t\t\t\t\t\t\t\t\t\tKK\tKK\tA1\t19\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t6\t0\t\t\t\t\t\t1\t0\t1\t\t\t\tlvl/6+1\t# of kicks\tdm34\tKnockback % VS Unique Monster\tdm56\tKnockback % VS Boss\tdm56\tKnockback % VS Player\t\t\t\t\t5\tDamage % baseline\t7\tDamage % per level\t50\tKnockback % VS Unique Monster Min\t100\tKnockback % VS Unique Monster Max\t25\tKnockback % VS Boss Min\t99\tKnockback % VS Boss Max\t\t\t1\tAlways Hit (0 = disabled | 1 = enabled only when Charges are consumed)\t\t\t\t\t\t\t\t\t1\t20\t35\t\t\t\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t\t256\t1000\t0\n",
+                u8"Shock Field\t256\tass\tshock field\t\t43\t\t\t\t\t\tpar1+lvl/par2+skill('Fire Trauma'.blvl)/3\t\t\t\t\t\t\tshock field in air\t\t\t\t\t\t\t\t\t(par1+lvl/par2+skill('Fire Trauma'.blvl)/3)/4+1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweapon_throw_1\t\t\t\t\t\t\t\t\t\t\t5\t\t\t\t\t\tshock field in air\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tFire Trauma\t\t\t\t\t\t\t15\t\t1\t1\t\t\t\t\t1\t8\t6\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t# of Missiles created\t4\t# of Levels needed per Missile created gained\t\t\t\t\t\t\t\t\t\t\t17\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t2\t0\t0\t0\t0\t0\t20\t6\t12\t20\t30\t42\t(skill('Charged Bolt Sentry'.blvl) + skill('Lightning Sentry'.blvl)) * par8\t\t\t\t\t\t11\t\t384\t3000\t0\n",
+                u8"Blade Sentinel\t257\tass\tblade sentinel\t\t44\t\t\t\t\t\t\t\t\t\t\t\t\tblade creeper\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\ttohit\tlvl*5\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\tpassive_ltng_mastery\tstat('passive_ltng_mastery'.accr)\tpassive_cold_mastery\tstat('passive_cold_mastery'.accr)\tpassive_pois_mastery\tstat('passive_pois_mastery'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\tpassive_ltng_pierce\tstat('passive_ltng_pierce'.accr)\tpassive_cold_pierce\tstat('passive_cold_pierce'.accr)\tpassive_pois_pierce\tstat('passive_pois_pierce'.accr)\tbladecreeper\tassassintrap\t5\tS1\tBlade Sentinel\tlvl\t\t\t\t\t\t\t\t\t\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t25\t\t1\t1\t\t\t\t\t1\t8\t7\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\tDuration\t\t\t\t\t100\tDuration baseline\t12\tDuration per level\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t96\t6\t3\t4\t5\t5\t5\t10\t3\t4\t5\t5\t5\t(skill('Blade Fury'.blvl)+skill('Blade Shield'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t3\t384\t3000\t0\n",
+                u8"Quickness\t258\tass\tquickness\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tquickness\t\tln56\t\tvelocitypercent\tdm12\tattackrate\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_quickness\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tClaw Mastery\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t10\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tVelocity % Min\t70\tVelocity % Max\t15\tAttack Speed % Min\t60\tAttack Speed % Max\t3000\tDuration baseline\t300\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t384\t3000\t0\n",
+                u8"Fists of Fire\t259\tass\tfists of fire\t23\t35\t\t1\t143\t38\t39\t\tpar1\tpar2\t4\t\t\t\t\t\tfistsoffirefirewall\t\t\t\tprogressive_fire\t\tpar3\t\tprogressive_fire\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\t9\t\t\tfistsoffireexplode\tfistsoffirefirewall\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t3\th2h\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t16\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t1\t\tlvl*3\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t4\tRadius of explosion\t4\tRadius to create ground fire Missiles\t375\tDuration\t50\tAttack Rating % per Charge\t1\tFreeze Length Divisor (Freeze Length = Cold Length / Freeze Length Divisor) (Used only if Etype = cold)\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t6\t5\t10\t20\t30\t40\t10\t5\t11\t22\t33\t44\t(skill('Royal Strike'.blvl)) * par8\t\t\t\t\t\t4\t\t384\t3000\t0\n",
+                u8"Dragon Claw\t260\tass\tdragon claw\t25\t46\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_kick_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t3\th2h\t\t\t\t\th2h\t\t\t\t\tSQ\tA1\txx\t16\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\tDragon Talon\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t1\t0\t1\t\t\t\tln12 + skill('Claw Mastery'.blvl)*par7\tDamage %\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t50\tDamage % baseline\t15\tDamage % per level\t\t\t\t\t\t\t\t\t4\tDamage synergy\t1\tAlways Hit (0 = disabled | 1 = enabled only when Charges are consumed)\t\t\t\t\t\t\t\t\t1\t40\t25\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t\t384\t3000\t0\n",
+                u8"Charged Bolt Sentry\t261\tass\tcharged bolt sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\tpassive_ltng_pierce\tstat('passive_ltng_pierce'.accr)\tpassive_ltng_mastery\tstat('passive_ltng_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tchargeboltsentry\tassassintrap\t5\tS1\tBoltSentry\tlvl\tFire Trauma\tskill('Fire Trauma'.blvl)\tShock Field\tskill('Shock Field'.blvl)\tLightning Sentry\tskill('Lightning Sentry'.blvl)\tDeath Sentry\tskill('Death Sentry'.blvl)\t\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tShock Field\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar1 + skill('Lightning Sentry'.blvl)/par7\t# of shots\t\t\t\t\t5\t# of shots (must match BoltSentry Param8)\t\t\t5\t# of Bolt Missiles created baseline (must match BoltSentry Param1)\t0\t# of Bolt Missiles created per level (must match BoltSentry Param2)\t\t\t3\tBonus bolt Missiles created per # levels synergy\t4\tBonus shot per # levels synergy\t9\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t2\t0\t0\t0\t0\t0\t14\t6\t8\t12\t14\t16\t(skill('Fire Trauma'.blvl) + skill('Lightning Sentry'.blvl)) * par8\t\t\t\t\t\t3\t\t512\t3000\t0\n",
+                u8"Wake of Fire Sentry\t262\tass\twake of fire sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\twakeofdestruction\tassassintrap\t5\tS1\tWake Of Destruction Sentry\tlvl\tFire Trauma\tskill('Fire Trauma'.blvl)\tInferno Sentry\tskill('Inferno Sentry'.blvl)\t\t\t\t\t32\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tFire Trauma\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match Wake of Destruction Sentry Param8)\t\t\t\t\t\t\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t5\t2\t3\t5\t7\t9\t10\t2\t3\t6\t8\t10\t(skill('Fire Trauma'.blvl) + skill('Inferno Sentry'.blvl)) * par8\t\t\t\t\t\t3\t\t512\t3000\t0\n",
+                u8"Weapon Block\t263\tass\tweapon block\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweaponblock\th2h\t\tpassive_weaponblock\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\th2h\t\t\t\t\th2h\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tClaw Mastery\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t0\t8\t0\t0\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t20\tBlock % chance Min\t65\tBlock % chance Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t\t512\t3000\t0\n",
+                u8"Cloak of Shadows\t264\tass\tcloak of shadows\t\t47\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t57347\tcloak_of_shadows\tcloaked\tln34\tdm12\tskill_armor_percent\t\"-min(ln56,95)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_armor_percent\tln78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tPsychic Hammer\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t13\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tRadius Min\t30\tRadius Max\t200\tDuration baseline\t25\tDuration per level\t15\tArmor % reduction baseline\t3\tArmor % reduction per level\t10\tArmor % bonus baseline\t3\tArmor % bonus per level\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t2\t\t512\t8000\t0\n",
+                u8"Cobra Strike\t265\tass\tcobra strike\t23\t34\t\t\t\t\t\t\t\t\t2\t\t\t\t\t\t\t\t\t\tprogressive_steal\t\tpar3\t\tprogressive_steal\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcobrastrike1\tassassin_chargeup_cobra_1\t\t\t\t\t\t\t13\t13\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t12\t20\t\t\t\t\tTiger Strike\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t2\t0\t1\t\t\t\t\t\t\t\t\t1\t\tln12\tLifesteal %\t\t\t\t\t\t\t\t\t\t\t40\tLifesteal % baseline\t5\tLifesteal % per level\t375\tDuration\t50\tAttack Rating % per Charge\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t12\t\t512\t8000\t0\n",
+                u8"Blade Fury\t266\tass\tblade fury\t26\t48\t\t\t\t\t\tpar4\t\t\t\t\t\t\tbladefragment1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\t6\t\t\t\t\t\tbladefragment2\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\tSC\t23\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tBlade Sentinel\tWake of Fire Sentry\t\t\t\t\t\t\t\t1\t1\t1\t\t1\t6\t0\t5\t8\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tMin Mana required to cast\t5\tDelay between Missiles created\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\tlvl*10\t\t\t\t\t8\t96\t8\t3\t5\t8\t8\t8\t10\t3\t5\t8\t8\t8\t(skill('Blade Sentinel'.blvl)+skill('Blade Shield'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t\t640\t8000\t0\n",
+                u8"Fade\t267\tass\tfade\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfade\t\tln56\t\tfireresist\tdm12\tcoldresist\tdm12\tlightresist\tdm12\tpoisonresist\tdm12\tcurse_resistance\tdm34\tdamageresist\tln78\t\t\t\t\t\t\t\t\t\tfade\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_fade\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tQuickness\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t10\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\tElemental Resistance % Min\t75\tElemental Resistance % Max\t40\tCurse Length % Reduction Min\t90\tCurse Length % Reduction Max\t3000\tDuration baseline\t300\tDuration per level\t1\tDamage Resistance % baseline\t1\tDamage Resistance % per level\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t640\t8000\t0\n",
+                u8"Shadow Warrior\t268\tass\tshadow warrior\t\t49\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tshadowwarrior\t\t\t\ttohit\tlvl*par2\tskill_armor_percent\tlvl*par3\tstrength\tlvl*10\tdexterity\tlvl*10\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\t\"min(lvl*4,75)\"\tcoldresist\t\"min(lvl*4,75)\"\tlightresist\t\"min(lvl*4,75)\"\tpoisonresist\t\"min(lvl*4,75)\"\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\tshadowwarrior\tshadowwarrior\t1\tNU\t\t\t\t\t\t\t\t\t\t\t42\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tCloak of Shadows\tWeapon Block\t\t\t\t\t\t15\t\t0\t1\t\t\t\t\t1\t7\t54\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tHP % per level\t40\tAttack Rating % per level\t12\tArmor % per level\t\t\t18\tMagic Item Level baseline\t2\tMagic Item Level per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\t640\t16000\t0\n",
+                u8"Claws of Thunder\t269\tass\tclaws of thunder\t23\t35\t\t1\t\t36\t37\t\t\tpar1\t4\t\t\t\t\tclawsofthundernova\tclawsofthunderbolt\t\t\t\tprogressive_lightning\t\tpar3\t\tprogressive_lightning\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t11\t\t\tclawsofthundernova\tclawsofthunderbolt\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t3\th2h\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t16\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tFists of Fire\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t1\t\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t4\tMissiles created modifier for 3 Charges (used as 64/#=Total Charged Bolts created)\t\t\t375\tDuration\t50\tAttack Rating % per Charge\t1\tFreeze Length Divisor (Freeze Length = Cold Length / Freeze Length Divisor) (Used only if Etype = cold)\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t80\t20\t40\t60\t80\t100\t(skill('Royal Strike'.blvl)) * par8\t\t\t\t\t\t4\t\t640\t16000\t0\n",
+                u8"Dragon Tail\t270\tass\tdragon tail\t27\t50\t\t\t\t\t\t\t\t\t\t\t\t\tdragontail missile\t\t\t\t\t\t\t\t\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_kick_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\t7\t\t\t\t\t\tdragontail missile\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t4\t\t\t\t\t\t\t\t\t\t\tKK\tKK\tA1\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\tDragon Claw\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t10\t0\t\t\t\t\t\t1\t0\t1\t\t\t\tln12\tDamage %\t\t\t\t\t\t\t\t\t\t\t50\tDamage % baseline\t20\tDamage % per level\t6\tRadius\t-40\tAttack Speed % Reduction\t\t\t\t\t\t\t1\tAlways Hit (0 = disabled | 1 = enabled only when Charges are consumed)\t\t\t\t\t\t\t\t\t1\t20\t15\t\t\t\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t\t640\t16000\t0\n",
+                u8"Lightning Sentry\t271\tass\tlightning sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\tpassive_ltng_pierce\tstat('passive_ltng_pierce'.accr)\tpassive_ltng_mastery\tstat('passive_ltng_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightningsentry\tassassintrap\t5\tS1\tsentry lightning\tlvl\tShock Field\tskill('Shock Field'.blvl)\tCharged Bolt Sentry\tskill('Charged Bolt Sentry'.blvl)\tDeath Sentry\tskill('Death Sentry'.blvl)\t\t\t\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCharged Bolt Sentry\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t# of shots (must match sentry lightning Param8)\t\t\t\t\t\t\t\t\t\t\t\t\t18\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t20\t10\t16\t24\t34\t44\t(skill('Shock Field'.blvl) + skill('Charged Bolt Sentry'.blvl))*par8\t\t\t\t\t\t3\t\t768\t16000\t0\n",
+                u8"Inferno Sentry\t272\tass\tinferno sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tinfernosentry\tassassintrap\t5\tS1\tmon inferno sentry\tlvl\tFire Trauma\tskill('Fire Trauma'.blvl)\tWake of Fire Sentry\tskill('Wake of Fire Sentry'.blvl)\tDeath Sentry\tskill('Death Sentry'.blvl)\t\t\t32\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tWake of Fire Sentry\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t# of shots (must match mon inferno sentry Param8)\t\t\t40\tRange (Duration of missile) baseline (must match mon inferno sentry Param3)\t0\tRange (Duration of missile) per level (must match mon inferno sentry Param4)\t\t\t\t\t\t\t18\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t20\t17\t21\t26\t32\t39\t50\t19\t23\t28\t34\t41\t(skill('Fire Trauma'.blvl) + skill('Wake of Fire Sentry'.blvl))*par8\t\t\t\t\t\t3\t\t768\t32000\t0\n",
+                u8"Mind Blast\t273\tass\tmind blast\t\t51\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t33667\t\t\t\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_psychichammer\t\t\t\t\t\t\tfist_will_cast\t\t\t\t\t\t\t\t8\t\t\t\t\t\tmindblast center\tmindblast hit\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t1\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tCloak of Shadows\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t15\t0\t1\t\t\t\t\t\t\t\t\t\t\tdm56+skill('Psychic Hammer'.blvl)*par8\t% chance for conversion\tpar3\tDuration for conversion\t\t\t\t\t\t\t\t\t50\tStun Length baseline\t5\tStun Length per level\t150\tDuration of conversion\t100\tDuration of conversion random bonus range (from 0 to #)\t15\t% chance for conversion Min\t40\t% chance for conversion Max\t4\tRadius\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t9\t\t\t\t8\t\t10\t2\t5\t8\t8\t8\t20\t2\t5\t8\t8\t8\t\tstun\t\t\t\t\t\t\t\t\t\t\t\t\t\t50\t5\t5\t5\t\t11\t\t768\t32000\t0\n",
+                u8"Blades of Ice\t274\tass\tblades of ice\t23\t35\t\t1\t\t38\t39\t\tpar1\tpar2\t4\t\t\t\t\t\tbladesoficecubes\t\t\t34571\tprogressive_cold\t\tpar3\t\tprogressive_cold\t\tprogressive_tohit\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t9\t9\t\t\tbladesoficeexplode\tbladesoficecubes\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t3\th2h\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t16\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tClaws of Thunder\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t3\t0\t1\t\t\t\t\t\t\t\t\t1\t\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t6\tRadius for 2 Charges\t3\tRadius for 3 Charges\t375\tDuration\t50\tAttack Rating % per Charge\t1\tFreeze Length Divisor (Freeze Length = Cold Length / Freeze Length Divisor) (Used only if Etype = cold)\t\t\t\t\t8\tDamage synergy\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t15\t8\t10\t20\t30\t40\t35\t8\t10\t22\t32\t42\t(skill('Royal Strike'.blvl)) * par8\t100\t10\t10\t10\t\t4\t\t768\t32000\t0\n",
+                u8"Dragon Flight\t275\tass\tdragon flight\t12\t52\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tsorceress_teleport\t\t\t\t\t\t\tdragonflight\t\t\t\t\t\t\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t1\t0\t\trng\t4\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t21\t\t\t\t\t\t\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\tDragon Tail\t\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t15\t0\t\t\t\t\t\t1\t0\t1\t\t\t\tln12\tDamage %\t\t\t\t\t\t\t\t\t\t\t100\tDamage % baseline\t35\tDamage % per level\t\t\t\t\t\t\t\t\t38\tRange\t1\tAlways Hit (0 = disabled | 1 = enabled only when Charges are consumed)\t\t\t\t\t\t\t\t\t1\t60\t25\t\t\t\t\t1\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t13\t\t768\t32000\t0\n",
+                u8"Death Sentry\t276\tass\tdeath sentry\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\tpassive_ltng_pierce\tstat('passive_ltng_pierce'.accr)\tpassive_fire_pierce\tstat('passive_fire_pierce'.accr)\tpassive_ltng_mastery\tstat('passive_ltng_mastery'.accr)\tpassive_fire_mastery\tstat('passive_fire_mastery'.accr)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdeathsentry\tassassintrap\t5\tS1\tmon death sentry\tlvl\tdeath sentry ltng\tlvl\tFire Trauma\tskill('Fire Trauma'.blvl)\tLightning Sentry\tskill('Lightning Sentry'.blvl)\t\t\t32\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tLightning Sentry\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t20\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match death sentry ltng Param8 & mon death sentry Param8)\t\t\t\t\t\t\t\t\t\t\t\t\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t50\t8\t14\t22\t28\t34\t(skill('Lightning Sentry'.blvl))*par8\t\t\t\t\t\t3\t\t896\t64000\t0\n",
+                u8"Blade Shield\t277\tass\tblade shield\t28\t54\t\t\t\t\t\t\t\t\t\t\t\t\tblade shield attachment\t\t\t\t\t33667\tbladeshield\t\tln12\tpar4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_bladeshield\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tBlade Fury\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t27\t2\t1\t1\t\t1\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3000\tDuration baseline\t300\tDuration per level\t25\tPeriodic Damage Delay\t6\tRadius\t\t\t\t\t\t\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t32\t\t3\t\t8\t96\t1\t5\t6\t7\t7\t7\t30\t5\t6\t7\t7\t7\t(skill('Blade Sentinel'.blvl)+skill('Blade Fury'.blvl))*par8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t896\t64000\t0\n",
+                u8"Venom\t278\tass\tvenom\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tvenomclaws\t\tln12\t\tpoisonmindam\tenms\tpoisonmaxdam\texms\tskill_poison_override_length\tedma\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tassassin_venom\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tFade\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t1\t8\t12\t0\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3000\tDuration baseline\t300\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpois\t24\t6\t8\t10\t12\t14\t32\t6\t8\t10\t12\t14\t\t10\t\t\t\t\t1\t\t896\t64000\t0\n",
+                u8"Shadow Master\t279\tass\tshadow master\t\t49\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tshadowwarrior\t\t\t\ttohit\tlvl*par2\tstrength\tlvl*10\tdexterity\tlvl*10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfireresist\tdm34\tcoldresist\tdm34\tlightresist\tdm34\tpoisonresist\tdm34\titem_pierce_cold_immunity\tstat('item_pierce_cold_immunity'.accr)\titem_pierce_fire_immunity\tstat('item_pierce_fire_immunity'.accr)\titem_pierce_light_immunity\tstat('item_pierce_light_immunity'.accr)\titem_pierce_poison_immunity\tstat('item_pierce_poison_immunity'.accr)\titem_pierce_damage_immunity\tstat('item_pierce_damage_immunity'.accr)\t\t\t\t\t\t\t\t\t\t\tshadowmaster\tshadowwarrior\t1\tNU\t\t\t\t\t\t\t\t\t\t\t42\t\t\tassassin_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tShadow Warrior\t\t\t\t\t\t\t15\t\t0\t1\t\t\t\t\t1\t7\t70\t1\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t15\tHP % per level\t40\tAttack Rating % per level\t5\tResistance % Min\t90\tResistance % Max\t24\tMagic Item Level baseline\t3\tMagic Item Level per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\t896\t64000\t0\n",
+                u8"Royal Strike\t280\tass\troyal strike\t23\t34\t\t\t40\t143\t41\t\tpar6\tpar5\t\t\t\t\troyalstrikemeteorcenter\troyalstrikechainlightning\troyalstrikechaosice\t\t\t\tprogressive_other\t\t375\tpar1\tprogressive_other\t\tprogressive_tohit\tpar7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t14\t83\t15\t\troyalstrikemeteorcenter\troyalstrikechainlightning\troyalstrikechaosice\t\t\t\t\t\t\t\t\t\t1\t0\t\th2h\t\tmele\t\t\t\t\t\t\t\t\t\tA1\tA1\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t20\t\t\t\t\tCobra Strike\tBlades of Ice\t\t\t\t\t\t\t\t1\t1\t\t\t\t\t1\t8\t4\t0\t1\t\t\t\t\t\t\t\t\t1\t\tpar2\tMeteor Explosion Radius\t\t\t\t\t\t\t\t\t\t\t8\tChain Lightning Radius of jump to next target\t6\tMeteor Explosion Radius\t30\tDuration of ground fire baseline\t15\tDuration of ground fire per level\t16\t# of Ice Bolt Missiles created\t10\t\"Chain Lightning Missiles Created Modifier (used as 64/#=Total Chain Lightning Missiles created) (if <=0, then use AuraRangeCalc)\"\t25\tAttack Rating % per Charge\t\t\t\t\t\t\t\t\t\t\t1\t25\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\t-3\t896\t64000\t0\n",
+                u8"Wake Of Destruction Sentry\t281\t\t\t\t125\t\t\t\t\t\t\t\t\t\t\t\t\twake of destruction maker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t70\t\t\t\t\t\twake of destruction maker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar8\t# of shots\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match Wake of Fire Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Imp Inferno\t282\t\t\t59\t126\t\t\t\t\t\t\t\t\t\t\t\t\timpinfernoflame1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t71\t\t\t\t\t\timpinfernoflame1\timpinfernoflame2\t\t\t8\tMissile Z Offset\tlvl-1\tRange per level (Duration of missile)\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tSC\t6\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\"rand(par3,par4)\"\tAnim Frame Adder (Min=1)\tlvl-1\tRange per level (Duration of missile)\t\t\t\t\t\t\t\t\t30\tRange baseline (Duration of missile)\t\t\t100\tAnim Frame Adder Min\t120\tAnim Frame Adder Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t18\t15\t15\t15\t15\t15\t37\t15\t15\t15\t15\t15\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Imp Fireball\t283\t\t\t\t\t\t\t\t\t\t\t\t\t\timpfireball\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t72\t\t\t\t\t\timpfireball\t\t\t\t40\tMissile Z Offset\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Baal Taunt\t284\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tbaal taunt control\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonster_baal_taunt_1\t\t\t\t46\t\t\t\t\t\t\tbaal taunt control\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t3\tDelay in lightning \t45\tDelay in poison clouds\t\t\t\t\t\t\t\t\t45\tDelay in poison clouds\t3\tDelay in lightning \t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Baal Corpse Explode\t285\t\t\t\t141\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS3\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage % of base HP for enemy Min\t0\tDamage % of base HP for enemy Max\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t6\tExplosion Radius (half squares) baseline\t1\tExplosion Radius (half squares) per level\t40\tRadius to search for corpses baseline\t0\tRadius to search for corpses per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Baal Monster Spawn\t286\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal spawn monsters\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal_summon\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal spawn monsters\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS3\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Catapult Charged Ball\t287\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapultchargedball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapultchargedball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t# of Bolt Missiles created (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Catapult Spike Ball\t288\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapult spike ball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapult spike ball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\t# of Spike Missiles created (Min=1)\t\t\t\t\t20\t# of Spike Missiles created baseline\t5\t# of Spike Missiles created per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Suck Blood\t289\t\t\t60\t127\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tHeal % based on Damage Dealt\t0\tLifesteal %\t0\tManasteal %\t\t\t\t\t\t\t25\tHeal % based on Damage Dealt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t1\t\t\t\t\t\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Cry Help\t290\t\t\t\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcurseattract\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln12\tDuration\t\t\t\t\t\t\t\t\t\t\t100\tDuration baseline\t20\tDuration per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Healing Vortex\t291\t\t\t\t\t\t\t\t\t\t\t\t\t\thealing vortex\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\thealing vortex\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t5\t5\t5\t5\t5\t20\t5\t5\t5\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Teleport 2\t292\t\t\t\t98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t73\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Self-resurrect\t293\t\t\t61\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t38\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Vine Attack\t294\t\t\t\t130\t\t\t\t\t\t\t\t\t\t\t\t\tplague vines\t\t\t\t\t\t\tslowed\t\t\tvelocitypercent\t-100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruidpod_attack_1\tdruidpod_walk1_1\tdruidpod_neutral_1\t\t\t\t\t\t\t\t49\t\t\t\t\t\t\tvine beast attack\tvines\tvine beast walk 1\tvine beast neutral\t\"min(ln12,12)\"\t# of vine Missiles created\t35\tMissile Delay\t6\tMin Distance between Missiles\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\"min(ln12,24)\"\t# of Missiles created\t\t\t\t\t20\tFrames to apply aura to target (Min=5)\t\t\t\t\t3\t# of Missiles created baseline\t1\t# of Missiles created per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Overseer Whip\t295\t\t\t\t131\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbloodlust\tpar2\t\tvelocitypercent\tpar3\tattackrate\tpar4\tskill_armor_percent\tpar5\tdamagepercent\tpar6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsuicideminion1\t\t\tS1\t\t\t\t\t\t\t\t\t\t\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t% chance to get Bloodlust\t\t\t\t\t\t\t\t\t\t\t65\t% chance to get Bloodlust\t250\tBloodlust Duration\t80\tVelocity %\t80\tAttack Speed %\t50\tArmor %\t100\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Barbs Aura\t296\t\t\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t65795\tbarbscontrol\tbarbs\t\tln12\titem_attackertakesdamage\tedmn\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tRadius baseline (must match Spirit of Barbs Param7)\t2\tRadius per level (must match Spirit of Barbs Param8)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t32\t9\t18\t27\t36\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Wolverine Aura\t297\t\t\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t65795\twolverinecontrol\twolverine\t\tln12\titem_tohit_percent\tln34\tdamagepercent\tln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tRadius baseline (must match Heart of Wolverine Param7)\t2\tRadius per level (must match Heart of Wolverine Param8)\t25\tAttack Rating % baseline (must match Heart of Wolverine Param3)\t7\tAttack Rating % per level (must match Heart of Wolverine Param4)\t20\tDamage % baseline (must match Heart of Wolverine Param5)\t7\tDamage % per level (must match Heart of Wolverine Param6)\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Oak Sage Aura\t298\t\t\t\t65\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t65795\toaksagecontrol\toaksage\t\tln12\titem_maxhp_percent\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tRadius baseline (must match Oak Sage Param7)\t2\tRadius per level (must match Oak Sage Param8)\t30\tHP % baseline (must match Oak Sage Param1)\t5\tHP % per level (must match Oak Sage Param2)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Imp Fire Missile\t299\t\t\t\t132\t\t\t\t\t\t\t\t\t\t\t\t\timpmiss21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfist_will_cast\t\t\t\t\t\t\t\t\timpmiss21\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Impregnate\t300\t\t\t\t133\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpainworm1\t\t\tNU\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Siege Beast Stomp\t301\t\t\t\t134\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsiege_beast_dust\t\t\t\t75\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA2\tA2\tA2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t8\tCamera Screen Shake Magnitude\t5\tCamera Screen Shake Build Up Duration\t20\tCamera Screen Shake Loop Duration\t15\tCamera Screen Shake Fade Duration\t25\tRadius\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t1\t\t\t\t8\t\t20\t10\t10\t10\t10\t10\t60\t10\t10\t10\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MinionSpawner\t302\t\t\t62\t135\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspawnedminion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"CatapultBlizzard\t303\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapult cold ball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapult cold ball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"CatapultPlague\t304\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapult plague ball\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapult plague ball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"CatapultMeteor\t305\t\t\t\t28\t\t\t\t\t\t\t\t\t\t\t\t\tcatapult meteor ball\t\t\t\t\t\t\t\t\tpar1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t47\t\t\t\t\t\t\tcatapult meteor ball\t\t\t\t16\tMissile Fall Rate\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\tExplosion Radius\t\t\t50\tDuration of ground fire baseline\t3\tDuration of ground fire per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"BoltSentry\t306\t\t\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\tsentrychargedbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t\t\t\t\t\tsentrychargedbolt\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln12 + skill('Shock Field'.blvl)/skill('Charged Bolt Sentry'.par6)\t# of Bolt Missiles created\t\t\t\t\tpar8 + skill('Lightning Sentry'.blvl)/skill('Charged Bolt Sentry'.par7)\t# of shots\t\t\t\t\t5\t# of Bolt Missiles created baseline (must match Charged Bolt Sentry Param3)\t0\t# of Bolt Missiles created per level (must match Charged Bolt Sentry Param4)\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match Charged Bolt Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"CorpseCycler\t307\t\t\t63\t\t\t\t\t\t\t\t\t\t\t\t\t\trecycler delay\t\t\t\t\t\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t49\t\t\t93\t\t\t\tvine beast attack\trecycler delay\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln12\tLifesteal %\tdm34\tManasteal %\t\t\t\t\t\t\t\t\t4\tLifesteal % baseline (must match CorpseCycler Param5)\t1\tLifesteal % per level (must match CorpseCycler Param6)\t0\tManasteal % Min\t0\tManasteal % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"DeathMaul\t308\t\t\t\t136\t\t\t\t\t\t\t\t\t\t\t\t\tdeath mauler\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t76\t\t\t\t\t\tdeath mauler\tdeath mauler trail\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t96\tMissile Anim Rate\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t4\t4\t4\t4\t4\t20\t4\t4\t4\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Defense Curse\t309\t\t\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tdefense_curse\tln34\tln12\tskill_armor_percent\t-ln56\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseeffectred\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tRadius baseline\t1\tRadius per level\t200\tDuration baseline\t75\tDuration per level\t50\tDefense % baseline\t5\tDefense % per level\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Blood Mana\t310\t\t\t\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\t\tblood_mana\tln34\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t30\t\t\t\t\t\tcurseeffectred\t\tcursecast\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t3\tRadius baseline\t1\tRadius per level\t200\tDuration baseline\t75\tDuration per level\t40\t\"Max HP Limit (If target HP reaches this value or lower, then remove the Curse)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t10\t4\t4\t4\t4\t4\t20\t4\t4\t4\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"mon inferno sentry\t311\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tinferno sentry 1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t52\t77\t\t\t\t\t\tinferno sentry 1\tinferno sentry 2\t\t\t-37\tMissile Z Offset\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln34/2 + skill('Wake of Fire Sentry'.blvl)\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1 + skill('Wake of Fire Sentry'.blvl)\tAnim Frame Adder (Min=1)\t3\tAnim Frame Density (Min=1)\tpar8\t# of shots\t\t\t\t\t15\tAnim Frame Adder (Min=1)\t\t\t40\tRange (Duration of missile) baseline\t0\tRange (Duration of missile) per level\t\t\t\t\t\t\t10\t# of shots (must match Inferno Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"mon death sentry\t312\t\t\t\t55\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\tdeath_sentry\t\t\t50\t78\t\t\t\t\t\tcorpseexplosion\tdeathsentryexplode\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage % of base HP for enemy Min\tpar2\tDamage % of base HP for enemy Max\tpar5\t% Damage Dealt as Elemental\tpar8 + skill('Fire Trauma'.blvl)/3\t# of shots\t\t\t\t\t40\tDamage % of base HP for enemy Min \t80\tDamage % of base HP for enemy Max\t10\tRadius (half squares)\t1\tRadius per level (half squares)\t50\tDamage % Dealt as Elemental\t\t\t\t\t5\t# of shots (must match Death Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"sentry lightning\t313\t\t\t\t\t\t\t\t\t\t\t\t\t\tsentrylightningbolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsentrylightningbolt\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tpar8\t# of Missiles shot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t10\t# of shots (must match Lightning Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"fenris rage\t314\t\t\t\t137\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfenris_rage\t\tpar1\t\tdamagepercent\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\t\t\t\t\t\t\t\t\t\t51\t79\t\t\t\t\t\tcorpseexplosion\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t500\tDuration\t100\tDamage %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Baal Tentacle\t315\t\t\t\t140\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tS2\tS2\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Baal Nova\t316\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tbaal nova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal_novacast\t\t\t\t\t\t\t\t\t\t\tfire_cast_2\t\t\t\t25\t\t\t\t\t\tbaal nova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tS3\tS3\tS3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t50\t24\t32\t32\t32\t32\t75\t24\t32\t32\t32\t32\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Baal Inferno\t317\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tbaal inferno\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal_missilecast\t\t\t\t\t\t\t\t\t\t\t\t\t\t54\t54\t\t\t\t\t\tbaal inferno\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t2\tAnim Frame Density (Min=1)\t\t\t\t\t\t\t20\tAnim Frame Adder (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t64\t48\t48\t48\t48\t48\t96\t48\t48\t48\t48\t48\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Baal Cold Missiles\t318\t\t\t\t139\t\t\t\t\t\t\t\t\t\t\t\t\tbaal cold maker\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbaal_coldtrailcast\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t81\t\t\t\t\t\tbaal cold maker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t20\t9\t13\t13\t13\t13\t40\t9\t13\t13\t13\t13\t\t200\t50\t50\t50\t\t\t\t\t0\t0\n",
+                u8"MegademonInferno\t319\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tmegademoninferno\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t54\t54\t\t\t\t\t\tfetishinferno1\tfetishinferno2\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t2\tAnim Frame Density (Min=1)\t\t\t\t\t\t\t15\tAnim Frame Adder (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"EvilHutSpawner\t320\t\t\t49\t91\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tspawnedflames\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t36\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"CountessFirewall\t321\t\t\t\t24\t\t\t\t\t\t\t\t\t\t\t\t\tcountessfirewallmaker\tcountessfirewall\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t26\t\t\t\t\t\tcountessfirewallmaker\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t0\t# of max Fire Walls (oldest is removed when the limit is hit)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"ImpBolt\t322\t\t\t\t17\t\t\t\t\t\t\t\t\t\t\t\t\timp charged bolt\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t23\t\t\t\t\t\timp charged bolt\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl+2\t# of Bolt Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Horror Arctic Blast\t323\t\t\t53\t95\t\t\t\t\t\t\t\t\t\t\t\t\tfrozenhorror arcticblast1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t54\t54\t\t\t\t\t\tfrozenhorror arcticblast1\tfrozenhorror arcticblast1\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\t\"Missile Range (If 0, then use Missile Param2)\"\tpar1\tAnim Frame Adder (Min=1)\t2\tAnim Frame Density (Min=1)\t\t\t\t\t\t\t15\tAnim Frame Adder (Min=1)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"death sentry ltng\t324\t\t\t\t\t\t\t\t\t\t\t\t\t\tsentrylightningbolt2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsentrylightningbolt2\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t5\t# of shots (must match Death Sentry Param1)\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"VineCycler\t325\t\t\t63\t\t\t\t\t\t\t\t\t\t\t\t\t\tvine recycler delay\t\t\t\t\t\t\t\t\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t49\t\t\t93\t\t\t\tvine beast attack\trecycler delay\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\tln12\tManasteal %\t\t\t5\tFrames to apply aura to target (Min=5)\t\t\t\t\t4\tManasteal % baseline (must match Vines Param5)\t1\tManasteal % per level (must match Vines Param6)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"BearSmite\t326\t\t\t32\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruidbear_attack_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t9\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tS1\tS1\txx\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\t\"max(250,ln12)\"\tStun Length\t0\tAttack Speed %\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t15\tStun Length baseline\t5\tStun Length per level\t15\tDamage % baseline\t15\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t8\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Resurrect2\t327\t\t\t\t97\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\thealing\t\t\t39\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t1\t1\t1\t\t1\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"BloodLordFrenzy\t328\t\t\t64\t109\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonfrenzy\t\tln12\t\tvelocitypercent\tdm34\tattackrate\tdm34\tother_animrate\tdm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tweapon_giant_1\t\t1\t\tweapon_giant_1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t3\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tA2\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tDamage %\t\t\t\t\t\t\t\t\t\t\t200\tDuration baseline\t25\tDuration per level\t30\tSpeed % Min\t110\tSpeed % Max\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Baal Teleport\t329\t\t\t\t98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t73\t\t\t\t\t\t\tbaalteleport\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Imp Teleport\t330\t\t\t\t129\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tattached\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_teleport\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t74\t\t\t\t\t\timp teleport\timp teleport\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Baal Clone Teleport\t331\t\t\t\t98\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t48\t73\t\t\t\t\t\tbaalclonedeath\tbaalteleport\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"ZakarumLightning\t332\t\t\t\t\t\t\t\t\t\t\t\t\t\tmonsterlight\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t\t\t\t\t\tmonsterlight\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"VampireMissile\t333\t\t\t\t\t\t\t\t\t\t\t\t\t\tfirehead\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfirehead\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MephistoMissile\t334\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmephisto\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tA2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"DoomKnightMissile\t335\t\t\t\t148\t\t\t\t\t\t\t\t\t\t\t\t\tundeadmissile1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t94\t\t\t\t\t\tundeadmissile1\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"RogueMissile\t336\t\t\t\t110\t\t\t\t\t\t\t\t\t\t\t\t\trogue1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t66\t\t\t\t\t\trogue1\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"HydraMissile\t337\t\t\t\t\t\t\t\t\t\t\t\t\t\thydra\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\thydra\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tSC\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"NecromageMissile\t338\t\t\t\t149\t\t\t\t\t\t\t\t\t\t\t\t\tnecromage1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t95\t\t\t\t\t\tnecromage1\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonBow\t339\t\t\t4\t\t\t\t\t\t\t\t\t\t\tcr_arrow6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tcr_arrow6\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonFireArrow\t340\t\t\t4\t\t\t\t\t\t\t\t\t\t\tfirearrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tfirearrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t1\t8\t8\t8\t8\t8\t4\t9\t9\t9\t9\t9\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonColdArrow\t341\t\t\t4\t\t\t\t\t\t\t\t\t\t\tcoldarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tcoldarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t1\t7\t7\t7\t7\t7\t4\t8\t8\t8\t8\t8\t\t100\t25\t25\t25\t\t\t\t\t0\t0\n",
+                u8"MonExplodingArrow\t342\t\t\t4\t\t\t\t\t\t\t\t\t\t\texplodingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\texplodingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t5\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t2\t8\t8\t8\t8\t8\t6\t9\t9\t9\t9\t9\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonFreezingArrow\t343\t\t\t4\t\t\t\t\t\t\t\t\t\t\tfreezingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tfreezingarrow\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\trng\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tdamage radius\t\t\t\t\t\t\t\t\t\t\t5\tRadius of impact\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t10\t10\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t2\t7\t7\t7\t7\t7\t6\t8\t8\t8\t8\t8\t\t100\t25\t25\t25\t\t\t\t\t0\t0\n",
+                u8"MonPowerStrike\t344\t\t\t6\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t0\t0\t0\t0\t0\t16\t12\t12\t12\t12\t12\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"SuccubusBolt\t345\t\t\t4\t\t\t\t\t\t\t\t\t\t\tsuccubusmiss\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t11\t\t\t\t\t\tsuccubusmiss\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\trng\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS2\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmag\t10\t2\t4\t6\t6\t6\t15\t2\t5\t7\t7\t7\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MephFrostNova\t346\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\tmephfrostnova\tmephfrostnova\tmephfrostnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t\t\t\t\t\tfrostnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t6\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tA2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t40\t20\t20\t20\t20\t20\t60\t20\t20\t20\t20\t20\t\t200\t50\t50\t50\t\t\t\t\t0\t0\n",
+                u8"MonIceSpear\t347\t\t\t6\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\th2h\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t20\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t10\t8\t8\t8\t8\t8\t14\t9\t9\t9\t9\t9\t\t125\t25\t25\t25\t\t\t\t\t0\t0\n",
+                u8"ShamanIce\t348\t\t\t\t\t\t\t\t\t\t\t\t\t\tglacialspike\t\t\t\t\t\t\t\t\t\t\tln34 * (100 + skill('Blizzard'.blvl) * par7) / 100\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_cold\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tglacialspike\t\t\t\t\t\t\t\t\t\t\t\t\t1\t7\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t4\tRadius baseline\t0\tRadius per level\t50\tFreeze Length baseline\t3\tFreeze Length per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t4\t10\t14\t14\t14\t14\t12\t10\t15\t15\t15\t15\t\t125\t50\t50\t50\t\t\t\t\t0\t0\n",
+                u8"Diablogeddon\t349\t\t\t\t124\t\t\t\t\t\t\t\t\t\t\t\t\tdiablogeddoncontrol\tdiablogeddoncontrol\tdiablogeddoncontrol\t\t\t\tarmageddon\t\tln12\tpar3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdruid_firecast_a\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t92\t\t\t\tdiablogeddontail\tdiablogeddonrock\t\t\t25\tMissile Frames\t25\tMissile Fall Rate\t15\tMissile Slide Rate\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tS3\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1000\tDuration baseline\t50\tDuration per level\t8\tRadius\t8\tDelay between Missiles created\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t4\t4\t6\t8\t10\t12\t16\t4\t7\t9\t12\t14\t\tfire\t25\t15\t20\t25\t30\t35\t75\t16\t22\t27\t33\t38\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Delerium Change\t350\t\tdelerium change\t\t116\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tdelerium\t\t1500\t\tvelocitypercent\t33\tattackrate\t33\tother_animrate\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\tNU\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tAllow Instant Direct Transformation\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"NihlathakCorpseExplosion\t351\t\t\t17\t55\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\"min(30,16+lvl)\"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\tnecromancer_corpse_cast\t\t\t\t\t\t\t\tnecromancer_corpseexp_1\t\t\t\t\t\t21\t32\t\t\t\t\t\tcorpseexplosion\texplodingarrowexp\tredlightmissile\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t1\t\t1\t1\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tpar1\tDamage % of base HP for enemy Min\tpar2\tDamage % of base HP for enemy Max\tpar5\t% Damage Dealt as Elemental\t\t\t\t\t\t\t10\tDamage % of base HP for enemy Min \t20\tDamage % of base HP for enemy Max\t\t\t\t\t50\tDamage % Dealt as Elemental\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"SerpentCharge\t352\t\t\t31\t67\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\t37\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t4\t\t\t\t\t1\t1\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\t0\tVelocity %\t\t\t0\t% Damage Dealt as Elemental (Used only if there is an Etype)\t\t\t\t\t150\tVelocity %\t\t\t0\tDamage % baseline\t0\tDamage % per level\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Trap Nova\t353\t\t\t\t22\t\t\t\t\t\t\t\t\t\t\t\t\ttrapnova\ttrapnova\ttrapnova\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t\t\t\t\t\t\t\t\tlight_cast_1\t\t\t\t25\t\t\t\t\t\ttrapnova\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t1\t2\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSC\tSC\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_lightning\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\tMissile Velocity Adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"UnHolyBoltEx\t354\t\t\t\t\t\t\t\t\t\t\t\t\t\tunholybolt1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tunholybolt1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"ShamanFireEx\t355\t\t\t\t\t\t\t\t\t\t\t\t\t\tshafire1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tshafire1\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tSQ\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Imp Fire Missile Ex\t356\t\t\t\t\t\t\t\t\t\t\t\t\t\timpmiss21\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tsorceress_cast_fire\t\t\t\t\t\t\t\t\t\t\tfist_will_cast\t\t\t\t\t\t\t\t\timpmiss21\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tA1\tA1\tA1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tlvl-1\trange adder\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Interact\t357\t\tinteract\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Loot\t358\t\tloot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"TownPortal\t359\t\ttownportal\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"EmoteWheel\t360\t\temotewheel\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"SwapWeapons\t361\t\tswapweapons\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Map\t362\t\tmap\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"ShowItems\t363\t\tshowitems\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"RunToggle\t364\t\truntoggle\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"MonHolyFreeze\t365\t\t\t\t81\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t303747\tholywind\tholywindcold\t\tln12\tvelocitypercent\t-dm34\tattackrate\t-dm34\tother_animrate\t-dm34\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcoldmindam\tenms*par5/256\tcoldmaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t8\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t25\tSlow % Min\t60\tSlow % Max\t5\tDamage multiplier added to Attacks\t0\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t7\tDamage synergy\t15\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tcold\t2\t1\t2\t3\t4\t5\t3\t1\t2\t3\t4\t5\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"MonLeap\t366\t\t\t40\t77\t\t\t\t\t\t\t\t\t\t\t\t\tleapknockback\t\t\t\t\t\t\t\t\tdm12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_leap_1\t\t\t\t\t\t\t\t\t\t\t\t\t29\t43\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t13\t\t1\t\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln34\tKnockback Radius\tpar7\tLeap Speed %\t\t\t\t\t\t\t\t\t4\tRange Min\t30\tRange Max\t4\tKnockback Radius baseline\t1\tKnockback Radius per level\t\t\t\t\t100\tLeap Speed %\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"MonLeapAttack\t367\t\t\t41\t78\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tbash\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\tbarbarian_leapattack_1\t\t\t\t\t\t\t\t\t\t\t\t\t30\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t6\t\tnone\t\tmele\t\t\t\t\t\t\t\t\t\tSQ\tA1\txx\t14\t\t1\t\t4\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t18\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\tln34\tDamage %\tpar7\tLeap Speed %\t\t\t0\t% Damage Dealt as Elemental\t\t\t\t\t\t\t\t\t100\tDamage % baseline\t30\tDamage % per level\t\t\t\t\t100\tLeap Speed %\t10\tDamage synergy\t\t\t\t\t\t\t\t\t1\t50\t15\t\t\t\t\t\t8\t128\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t640\t16000\t0\n",
+                u8"MonHolyFire\t368\t\t\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\tholyfire\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfiremindam\tenms*par5/256\tfiremaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t\t\t\t\t6\tDamage multiplier added to Attacks\t0\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t6\tDamage synergy\t18\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tfire\t2\t1\t2\t3\t5\t7\t6\t1\t2\t3\t5\t7\t\t\t\t\t\t\t\t\t384\t3000\t0\n",
+                u8"MonHolyShock\t369\t\t\t\t66\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t42883\tholyshock\t\t\tln12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tlightmindam\t1\tlightmaxdam\texms*par5/256\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t4\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t24\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t1\t\t\t\t\t\t\t\t\t1\t1\t1\t\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t6\tRadius baseline\t1\tRadius per level\t\t\t\t\t6\tDamage multiplier added to Attacks\t0\t\"Area Damage % Range Scaling (from 100% to 100+X% damage, based on how close the enemy position is to the caster)\"\t4\tDamage synergy\t12\tDamage synergy\t\t\t\t\t\t\t\t\t1\t\t\t\t16385\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tltng\t1\t\t\t\t\t\t10\t6\t8\t10\t12\t15\t\t\t\t\t\t\t\t\t768\t32000\t0\n",
+                u8"CubeLoot\t370\t\tcubeloot\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\txx\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t0\n",
+                u8"Mark of the Bear\t371\t\tmark of the bear\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmarkbear\t\t4500\t\tattackrate\tpar1\tdamageresist\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t2\tbear\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t25\tAttack Speed %\t20\tDamage Resist %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n",
+                u8"Mark of the Wolf\t372\t\tmark of the wolf\t\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tmarkwolf\t\t4500\t\titem_tohit_percent\tpar1\titem_maxhp_percent\tpar2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\t\tnone\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t1\t\t\t\t\t\t1\t\t\t\t\t\t\t\t\t2\twolf\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t30\tAttack Rating %\t40\tLife %\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t\t\t\t\t\t\t\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t256\t1000\t0\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
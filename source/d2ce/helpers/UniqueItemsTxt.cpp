@@ -18,430 +18,426 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetUniqueItems()
+        EmbeddedText GetUniqueItems()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"index\t*ID\tversion\tenabled\tfirstLadderSeason\tlastLadderSeason\trarity\tnolimit\tlvl\tlvl req\tcode\t*ItemName\tcarry1\tcost mult\tcost add\tchrtransform\tinvtransform\tflippyfile\tinvfile\tdropsound\tdropsfxframe\tusesound\tprop1\tpar1\tmin1\tmax1\tprop2\tpar2\tmin2\tmax2\tprop3\tpar3\tmin3\tmax3\tprop4\tpar4\tmin4\tmax4\tprop5\tpar5\tmin5\tmax5\tprop6\tpar6\tmin6\tmax6\tprop7\tpar7\tmin7\tmax7\tprop8\tpar8\tmin8\tmax8\tprop9\tpar9\tmin9\tmax9\tprop10\tpar10\tmin10\tmax10\tprop11\tpar11\tmin11\tmax11\tprop12\tpar12\tmin12\tmax12\tdiablocloneweight\t*eol\n";
-                ss << u8"The Gnasher\t0\t0\t1\t\t\t1\t\t7\t5\thax\tHand Axe\t\t5\t5000\tdyel\t\t\tinvhaxu\t\t\t\tstr\t\t8\t8\topenwounds\t\t50\t50\tcrush\t\t20\t20\tdmg%\t\t60\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Deathspade\t1\t0\t1\t\t\t1\t\t12\t9\taxe\tAxe\t\t5\t5000\tdgld\t\t\tinvaxeu\t\t\t\tstupidity\t\t1\t1\tdmg-min\t\t8\t8\tatt%\t\t15\t15\tmana-kill\t\t4\t4\tdmg%\t\t60\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bladebone\t2\t0\t1\t\t\t1\t\t20\t15\t2ax\tDouble Axe\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tdmg-undead\t\t100\t100\tatt-undead\t\t40\t40\tswing2\t\t20\t20\tac\t\t20\t20\tfire-min\t\t8\t8\tfire-max\t\t12\t12\tdmg%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Mindrend\t3\t0\t1\t\t\t1\t\t28\t21\tmpi\tMilitary Pick\t\t5\t5000\tlgrn\t\t\tinvmpiu\t\t\t\tstupidity\t\t2\t2\tregen-mana\t\t20\t20\tltng-min\t\t1\t1\tltng-max\t\t12\t15\tatt\t\t50\t100\tdmg%\t\t60\t100\topenwounds\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rakescar\t4\t0\t1\t\t\t1\t\t36\t27\twax\tWar Axe\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tpois-min\t\t128\t128\tpois-max\t\t128\t128\tpois-len\t\t75\t75\tatt\t\t50\t50\tres-pois\t\t50\t50\tdmg%\t\t75\t150\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Fechmars Axe\t5\t0\t1\t\t\t1\t\t11\t8\tlax\tLarge Axe\t\t5\t5000\tlpur\tlpur\t\t\t\t\t\tdmg%\t\t70\t90\tfreeze\t\t3\t3\tres-cold\t\t50\t50\tlight\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Goreshovel\t6\t0\t1\t\t\t1\t\t19\t14\tbax\tBroad Axe\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\tswing3\t\t30\t30\tstr\t\t25\t25\topenwounds\t\t60\t60\tdmg%\t\t40\t50\tdmg-max\t\t9\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Chieftan\t7\t0\t1\t\t\t1\t\t26\t19\tbtx\tBattle Axe\t\t5\t5000\toran\t\t\tinvbtxu\t\t\t\tdmg%\t\t100\t100\tres-all\t\t10\t20\tmana-kill\t\t6\t6\tswing2\t\t20\t20\tdmg-ltng\t\t1\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Brainhew\t8\t0\t1\t\t\t1\t\t34\t25\tgax\tGreat Axe\t\t5\t5000\twhit\t\t\tinvgaxu\t\t\t\tdmg-min\t\t14\t14\tmana\t\t25\t25\tlight\t\t4\t4\tmanasteal\t\t10\t13\tdmg%\t\t50\t80\tdmg-fire\t\t15\t35\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Humongous\t9\t0\t1\t\t\t1\t\t39\t29\tgix\tGiant Axe\t\t5\t5000\tblac\tblac\t\t\t\t\t\tstr\t\t20\t30\tdmg-min\t\t8\t8\tdmg-max\t\t15\t25\tcrush\t\t33\t33\tease\t\t20\t20\tdmg%\t\t80\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Iros Torch\t10\t0\t1\t\t\t1\t\t7\t5\twnd\tWand\t\t5\t5000\tcred\t\t\tinvwndu\t\t\t\tnec\t\t1\t1\tlifesteal\t\t6\t6\tdmg-fire\t\t5\t9\tlight\t\t3\t3\tenr\t\t10\t10\tregen-mana\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Maelstromwrath\t11\t0\t1\t\t\t1\t\t19\t14\tywn\tYew Wand\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tltng-min\t\t1\t1\tltng-max\t\t9\t9\tres-ltng\t\t40\t40\tmana\t\t13\t13\tcast2\t\t30\t30\tskill\t74\t1\t3\tskill\t77\t1\t3\tskill\t66\t1\t3\tskill\t76\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gravenspine\t12\t0\t1\t\t\t1\t\t27\t20\tbwn\tBone Wand\t\t5\t5000\tcgrn\t\t\tinvbwnu\t\t\t\tstr\t\t10\t10\tdex\t\t10\t10\tcold-min\t\t4\t4\tcold-max\t\t8\t8\tcold-len\t\t75\t75\tmanasteal\t\t5\t5\tnec\t\t2\t2\tmana\t\t25\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Umes Lament\t13\t0\t1\t\t\t1\t\t38\t28\tgwn\tGrim Wand\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tnec\t\t2\t2\tmana\t\t40\t40\tcast2\t\t20\t20\thowl\t\t64\t64\tskill\t77\t3\t3\tskill\t87\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Felloak\t14\t0\t1\t\t\t1\t\t4\t3\tclb\tClub\t\t5\t5000\tlgry\t\t\tinvclbu\t\t\t\tres-ltng\t\t60\t60\tres-fire\t\t20\t20\tknock\t\t1\t1\tfire-min\t\t6\t6\tfire-max\t\t8\t8\tdmg%\t\t70\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Knell Striker\t15\t0\t1\t\t\t1\t\t7\t5\tscp\tScepter\t\t5\t5000\tdred\tdred\t\t\t\t\t\tcrush\t\t25\t25\tres-fire\t\t20\t20\tres-pois\t\t20\t20\tmana\t\t15\t15\tatt\t\t35\t35\tdmg%\t\t70\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rusthandle\t16\t0\t1\t\t\t1\t\t23\t17\tgsc\tGrand Scepter\t\t5\t5000\tlgld\tlgld\t\t\t\t\t\tpal\t\t1\t1\tdmg-norm\t\t3\t7\tred-mag\t\t1\t1\tlifesteal\t\t8\t8\tdmg%\t\t50\t60\tdmg-undead\t\t50\t60\tskill\t111\t1\t3\tskill\t103\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stormeye\t17\t0\t1\t\t\t1\t\t31\t23\twsp\tWar Scepter\t\t5\t5000\tcred\tcred\t\t\t\t\t\tdmg-ltng\t\t1\t6\tdmg-cold\t75\t3\t5\tregen\t\t10\t10\tdmg%\t\t80\t120\tskill\t110\t3\t5\tskill\t118\t3\t3\tskill\t121\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stoutnail\t18\t0\t1\t\t\t1\t\t7\t5\tspc\tSpiked Club\t\t5\t5000\tdgry\t\t\tinvspcu\t\t\t\tthorns\t\t3\t10\tdmg%\t\t100\t100\tvit\t\t7\t7\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Crushflange\t19\t0\t1\t\t\t1\t\t12\t9\tmac\tMace\t\t5\t5000\tblac\tblac\t\t\t\t\t\tstr\t\t15\t15\tknock\t\t1\t1\tlight\t\t2\t2\tres-fire\t\t50\t50\tdmg%\t\t50\t60\tcrush\t\t33\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bloodrise\t20\t0\t1\t\t\t1\t\t20\t15\tmst\tMorning Star\t\t5\t5000\tlblu\t\t\tinvmstu\t\t\t\tdmg%\t\t120\t120\tatt%\t\t50\t50\topenwounds\t\t25\t25\tlight\t\t2\t2\tswing1\t\t10\t10\tskill\t96\t3\t3\tlifesteal\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Generals Tan Do Li Ga\t21\t0\t1\t\t\t1\t\t28\t21\tfla\tFlail\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tdmg-min\t\t1\t1\tdmg-max\t\t20\t20\tslow\t\t50\t50\tac\t\t25\t25\tmanasteal\t\t5\t5\tdmg%\t\t50\t60\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ironstone\t22\t0\t1\t\t\t1\t\t36\t27\twhm\tWar Hammer\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tatt\t\t100\t150\tdmg%\t\t100\t150\tltng-min\t\t1\t1\tltng-max\t\t10\t10\tstr\t\t10\t10\t*enr\t\t-5\t-5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bonesob\t23\t0\t1\t\t\t1\t\t32\t24\tmau\tMaul\t\t5\t5000\tlred\t\t\tinvmauu\t\t\t\tdmg%\t\t200\t300\tcrush\t\t40\t40\tres-fire\t\t30\t30\tres-cold\t\t30\t30\tdmg-undead\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Steeldriver\t24\t0\t1\t\t\t1\t\t39\t29\tgma\tGreat Maul\t\t5\t5000\tcgrn\tcgrn\t\tinvgma\t\t\t\tease\t\t-50\t-50\tswing3\t\t40\t40\tregen-stam\t\t25\t25\tdmg%\t\t150\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rixots Keen\t25\t0\t1\t\t\t1\t\t3\t2\tssd\tShort Sword\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdmg-min\t\t5\t5\tatt%\t\t20\t20\tlight\t\t2\t2\tcrush\t\t25\t25\tac\t\t25\t25\tdmg%\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blood Crescent\t26\t0\t1\t\t\t1\t\t10\t7\tscm\tScimitar\t\t5\t5000\tlblu\t\t\tinvscmu\t\t\t\tres-all\t\t15\t15\tdmg%\t\t60\t80\thp\t\t15\t15\tlight\t\t4\t4\topenwounds\t\t33\t33\tswing2\t\t15\t15\tlifesteal\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Krintizs Skewer\t27\t0\t1\t\t\t1\t\t14\t10\tsbr\tSaber\t\t5\t5000\tcblu\t\t\tinv9sbu\t\t\t\tignore-ac\t\t1\t1\tstr\t\t10\t10\tdex\t\t10\t10\tmanasteal\t\t7\t7\tdmg%\t\t50\t50\tdmg-norm\t\t3\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gleamscythe\t28\t0\t1\t\t\t1\t\t18\t13\tflc\tFalchion\t\t5\t5000\tlred\t\t\tinvflcu\t\t\t\tlight\t\t3\t3\tmana\t\t30\t30\tac\t\t20\t20\tswing2\t\t20\t20\tdmg%\t\t60\t100\tdmg-cold\t50\t3\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Azurewrath\t29\t0\t0\t\t\t1\t\t18\t13\tcrs\tCrystal Sword\t\t5\t5000\tlgry\t\t\tinvcrsu\t\t\t\tdeadly\t\t50\t50\tmag%\t\t10\t10\tdmg-cold\t100\t3\t6\tdmg%\t\t100\t100\tdur\t\t25\t25\tdmg-mag\t\t5\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Griswolds Edge\t30\t0\t1\t\t\t1\t\t23\t17\tbsd\tBroad Sword\t\t5\t5000\tcred\t\t\tinvbsdu\t\t\t\tfire-min\t\t10\t12\tfire-max\t\t15\t25\tatt\t\t100\t100\tswing1\t\t10\t10\tknock\t\t1\t1\tdmg%\t\t80\t120\tstr\t\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hellplague\t31\t0\t1\t\t\t1\t\t30\t22\tlsd\tLong Sword\t\t5\t5000\tdred\t\t\tinvlsdu\t\t\t\tmanasteal\t\t5\t5\tlifesteal\t\t5\t5\tpois-min\t\t48\t48\tpois-max\t\t96\t96\tpois-len\t\t150\t150\tdmg%\t\t70\t80\tdmg-fire\t\t25\t75\tfireskill\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Culwens Point\t32\t0\t1\t\t\t1\t\t39\t29\twsd\tWar Sword\t\t5\t5000\twhit\twhit\t\t\t\t\t\tallskills\t\t1\t1\tres-pois-len\t\t50\t50\tbalance2\t\t20\t20\tswing2\t\t20\t20\tatt\t\t60\t60\tdmg%\t\t70\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Shadowfang\t33\t0\t1\t\t\t1\t\t16\t12\t2hs\t2-Handed Sword\t\t5\t5000\tcgrn\t\t\tinv2hsu\t\t\t\tmanasteal\t\t9\t9\tres-cold\t\t20\t20\tlight\t\t-2\t-2\tdmg-cold\t150\t10\t30\tdmg%\t\t100\t100\tlifesteal\t\t9\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Soulflay\t34\t0\t1\t\t\t1\t\t26\t19\tclm\tClaymore\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tmanasteal\t\t4\t10\tlifesteal\t\t4\t4\tdmg%\t\t70\t100\tres-all\t\t5\t5\tswing2\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Kinemils Awl\t35\t0\t1\t\t\t1\t\t31\t23\tgis\tGiant Sword\t\t5\t5000\tdblu\t\t\tinvgisu\t\t\t\tatt\t\t100\t150\tmana\t\t20\t20\tfire-min\t\t6\t6\tfire-max\t\t20\t40\tdmg%\t\t80\t100\tskill\t102\t6\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blacktongue\t36\t0\t1\t\t\t1\t\t35\t26\tbsw\tBastard Sword\t\t5\t5000\tlgrn\t\t\tinvbswu\t\t\t\tdmg-pois\t150\t192\t192\tnoheal\t\t1\t1\tatt\t\t50\t50\tres-pois\t\t50\t50\tdmg%\t\t50\t60\t*hp\t\t-10\t-10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ripsaw\t37\t0\t1\t\t\t1\t\t35\t26\tflb\tFlamberge\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\topenwounds\t\t80\t80\tdmg-max\t\t15\t15\tmanasteal\t\t6\t6\tdmg%\t\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Patriarch\t38\t0\t1\t\t\t1\t\t39\t29\tgsd\tGreat Sword\t\t5\t5000\tcred\t\t\tinvgsdu\t\t\t\tred-dmg\t\t3\t3\tred-mag\t\t3\t3\tstupidity\t\t1\t1\tgold%\t\t100\t100\tdmg%\t\t100\t120\tstr\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gull\t39\t0\t1\t\t\t1\t\t6\t4\tdgr\tDagger\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tdmg-min\t\t1\t1\tdmg-max\t\t15\t15\tmag%\t\t100\t100\tmana\t\t-5\t-5\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Diggler\t40\t0\t1\t\t\t1\t\t15\t11\tdir\tDirk\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tdex\t\t10\t10\tdmg%\t\t50\t50\tswing3\t\t30\t30\tres-cold\t\t25\t25\tres-fire\t\t25\t25\tignore-ac\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Jade Tan Do\t41\t0\t1\t\t\t1\t\t26\t19\tkri\tKris\t\t5\t5000\toran\t\t\tinvkrsu\t\t\t\tatt\t\t100\t150\tnofreeze\t\t1\t1\tdmg-pois\t100\t460\t460\tres-pois\t\t95\t95\tres-pois-max\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Irices Shard\t42\t0\t1\t\t\t1\t\t34\t25\tbld\tBlade\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tcast3\t\t50\t50\tmana\t\t50\t50\tatt\t\t55\t55\tres-all\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Dragon Chang\t43\t0\t1\t\t\t1\t\t11\t8\tspr\tSpear\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\tatt\t\t35\t35\tdmg-min\t\t10\t10\tlight\t\t2\t2\tdmg-undead\t\t100\t100\tdmg-fire\t\t3\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Razortine\t44\t0\t1\t\t\t1\t\t16\t12\ttri\tTrident\t\t5\t5000\toran\t\t\tinvtriu\t\t\t\tslow\t\t25\t25\treduce-ac\t\t50\t50\tstr\t\t15\t15\tdex\t\t8\t8\tswing2\t\t30\t30\tdmg%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bloodthief\t45\t0\t1\t\t\t1\t\t23\t17\tbrn\tBrandistock\t\t5\t5000\twhit\twhit\t\t\t\t\t\topenwounds\t\t35\t35\tstr\t\t10\t10\tlifesteal\t\t8\t12\thp\t\t26\t26\tdmg%\t\t50\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lance of Yaggai\t46\t0\t1\t\t\t1\t\t30\t22\tspt\tSpetum\t\t5\t5000\tlred\tlred\t\t\t\t\t\tthorns\t\t8\t8\tltng-min\t\t1\t1\tltng-max\t\t60\t60\tres-all\t\t15\t15\tswing2\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Tannr Gorerod\t47\t0\t1\t\t\t1\t\t36\t27\tpik\tPike\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tfire-min\t\t23\t23\tfire-max\t\t54\t54\tres-fire-max\t\t15\t15\thp\t\t30\t30\tatt\t\t60\t60\tlight\t\t3\t3\tres-fire\t\t15\t15\tdmg%\t\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Dimoaks Hew\t48\t0\t1\t\t\t1\t\t11\t8\tbar\tBardiche\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdex\t\t15\t15\tdmg%\t\t100\t100\tswing2\t\t20\t20\tac\t\t-8\t-8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Steelgoad\t49\t0\t1\t\t\t1\t\t19\t14\tvou\tVoulge\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\thowl\t\t96\t96\tdeadly\t\t30\t30\tatt\t\t30\t30\tres-all\t\t5\t5\tdmg%\t\t60\t80\tdur\t\t20\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Soul Harvest\t50\t0\t1\t\t\t1\t\t26\t19\tscy\tScythe\t\t5\t5000\tdgry\t\t\tinvscyu\t\t\t\topenwounds\t\t30\t30\tatt\t\t45\t45\tres-all\t\t20\t20\tdmg%\t\t50\t90\tmanasteal\t\t10\t10\tenr\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Battlebranch\t51\t0\t1\t\t\t1\t\t34\t25\tpax\tPoleaxe\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tswing3\t\t30\t30\tdex\t\t10\t10\tdmg%\t\t50\t70\tatt\t\t50\t100\tlifesteal\t\t7\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Woestave\t52\t0\t1\t\t\t1\t\t38\t28\thal\tHalberd\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tslow\t\t50\t50\topenwounds\t\t50\t50\tstupidity\t\t3\t3\tdmg-ac\t\t-50\t-50\tfreeze\t\t1\t1\tlight\t\t-3\t-3\tnoheal\t\t1\t1\tdmg%\t\t20\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Grim Reaper\t53\t0\t1\t\t\t1\t\t39\t29\twsc\tWar Scythe\t\t5\t5000\tlpur\tlpur\t\t\t\t\t\tdeadly\t\t100\t100\tnoheal\t\t1\t1\tmanasteal\t\t5\t5\tdmg%\t\t20\t20\tdmg-min\t\t15\t15\t*hp\t\t-20\t-20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bane Ash\t54\t0\t1\t\t\t1\t\t7\t5\tsst\tShort Staff\t\t5\t5000\tlgrn\tlgrn\t\t\t\t\t\tfire-min\t\t4\t4\tfire-max\t\t6\t6\tres-fire\t\t50\t50\tmana\t\t30\t30\tswing2\t\t20\t20\tdmg%\t\t50\t60\tskill\t36\t5\t5\tskill\t37\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Serpent Lord\t55\t0\t1\t\t\t1\t\t12\t9\tlst\tLong Staff\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tdmg-pois\t75\t40\t40\tres-pois\t\t50\t50\tlight\t\t-1\t-1\tmana\t\t10\t10\tdmg%\t\t30\t40\tmanasteal\t\t100\t100\treduce-ac\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lazarus Spire\t56\t0\t1\t\t\t1\t\t24\t18\tcst\tGnarled Staff\t\t5\t5000\tlgry\t\t\tinvcstu\t\t\t\tres-ltng\t\t75\t75\tred-dmg\t\t5\t5\tenr\t\t15\t15\tskill\t53\t1\t1\tskill\t49\t2\t2\tskill\t42\t3\t3\tregen-mana\t\t43\t43\tdmg-ltng\t\t1\t28\tsor\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Salamander\t57\t0\t1\t\t\t1\t\t28\t21\tbst\tBattle Staff\t\t5\t5000\tdred\tdred\t\t\t\t\t\tdmg-fire\t\t15\t32\tres-fire\t\t30\t30\tskill\t51\t1\t1\tskill\t47\t2\t2\tskill\t37\t3\t3\tfireskill\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Iron Jang Bong\t58\t0\t1\t\t\t1\t\t38\t28\twst\tWar Staff\t\t5\t5000\tdyel\tdyel\t\t\t\t\t\tac\t\t30\t30\tcast3\t\t20\t20\tdmg%\t\t100\t100\tatt%\t\t50\t50\tskill\t48\t2\t2\tskill\t46\t2\t2\tskill\t44\t3\t3\tsor\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Pluckeye\t59\t0\t1\t\t\t1\t\t10\t7\tsbw\tShort Bow\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tatt\t\t28\t28\tdmg%\t\t100\t100\thp\t\t10\t10\tlight\t\t2\t2\tmanasteal\t\t3\t3\tmana-kill\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Witherstring\t60\t0\t1\t\t\t1\t\t18\t13\thbw\tHunter\\92s Bow\t\t5\t5000\tlred\tlred\t\t\t\t\t\tswing3\t\t30\t30\tdmg-min\t\t1\t1\tdmg-max\t\t3\t3\tatt\t\t50\t50\tmagicarrow\t\t3\t3\tdmg%\t\t40\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rimeraven\t61\t0\t1\t\t\t1\t\t20\t15\tlbw\tLong Bow\t\t5\t5000\tdred\tdred\t\t\t\t\t\tatt%\t\t50\t50\tdex\t\t3\t3\texplosivearrow\t\t3\t3\tstr\t\t3\t3\tdmg%\t\t60\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Piercerib\t62\t0\t1\t\t\t1\t\t27\t20\tcbw\tComposite Bow\t\t5\t5000\tcred\t\t\tinvcbwu\t\t\t\tres-all\t\t10\t10\tdeadly\t\t30\t30\tatt\t\t60\t60\tdmg-undead\t\t100\t100\tdmg%\t\t40\t60\tswing2\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Pullspite\t63\t0\t1\t\t\t1\t\t34\t25\tsbb\tShort Battle Bow\t\t5\t5000\tlgrn\t\t\tinvsbbu\t\t\t\tdmg-ltng\t\t1\t30\tstr\t\t8\t8\tatt\t\t28\t28\tpierce\t\t25\t25\tres-ltng\t\t25\t25\tdmg%\t\t70\t90\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Wizendraw\t64\t0\t1\t\t\t1\t\t35\t26\tlbb\tLong Battle Bow\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tmagicarrow\t\t5\t5\tmana\t\t30\t30\tswing2\t\t20\t20\tres-cold\t\t26\t26\tatt\t\t50\t100\tdmg%\t\t70\t80\tenr\t\t15\t15\tpierce-cold\t\t20\t35\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hellclap\t65\t0\t1\t\t\t1\t\t36\t27\tswb\tShort War Bow\t\t5\t5000\tcgrn\t\t\tinvswbu\t\t\t\tswing1\t\t10\t10\tfire-min\t\t15\t15\tfire-max\t\t30\t50\tatt\t\t50\t75\tres-fire\t\t40\t40\tdex\t\t12\t12\tdmg%\t\t70\t90\tfireskill\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blastbark\t66\t0\t1\t\t\t1\t\t38\t28\tlwb\tLong War Bow\t\t5\t5000\tlyel\tlyel\t\t\t\t\t\tdmg%\t\t70\t130\tstr\t\t5\t5\tama\t\t1\t1\tmanasteal\t\t3\t3\tskill\t16\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Leadcrow\t67\t0\t1\t\t\t1\t\t12\t9\tlxb\tLight Crossbow\t\t5\t5000\tdyel\t\t\tinvlxbu\t\t\t\tdex\t\t10\t10\thp\t\t10\t10\tdmg%\t\t70\t70\tres-pois\t\t30\t30\tdeadly\t\t25\t25\tatt\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ichorsting\t68\t0\t1\t\t\t1\t\t24\t18\tmxb\tCrossbow\t\t5\t5000\tlgld\t\t\tinvmxbu\t\t\t\tdmg-pois\t75\t102\t102\tdex\t\t20\t20\tpierce\t\t50\t50\tatt\t\t50\t50\tdmg%\t\t50\t50\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hellcast\t69\t0\t1\t\t\t1\t\t36\t27\thxb\tHeavy Crossbow\t\t5\t5000\tdgld\t\t\tinvhxbu\t\t\t\texplosivearrow\t\t5\t5\tres-fire-max\t\t15\t15\tres-fire\t\t15\t15\tatt\t\t70\t70\tswing2\t\t20\t20\tdmg%\t\t70\t80\tdmg-fire\t\t15\t35\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Doomspittle\t70\t0\t1\t\t\t1\t\t38\t28\trxb\tRepeating Crossbow\t\t5\t5000\tlpur\t\t\tinvrxbu\t\t\t\tama\t\t1\t1\tpierce\t\t35\t35\tswing3\t\t30\t30\thp\t\t15\t15\tdmg%\t\t60\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"War Bonnet\t71\t0\t1\t\t\t1\t\t4\t3\tcap\tCap\t\t5\t5000\tdpur\t\t\tinvcapu\t\t\t\thp\t\t15\t15\tatt\t\t30\t30\tdmg%\t\t30\t30\tmana\t\t15\t15\tac\t\t14\t14\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Tarnhelm\t72\t0\t1\t\t\t1\t\t20\t15\tskp\tSkull Cap\t\t5\t5000\toran\toran\t\t\t\t\t\tgold%\t\t75\t75\tmag%\t\t25\t50\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Coif of Glory\t73\t0\t1\t\t\t1\t\t19\t14\thlm\tHelm\t\t5\t5000\twhit\t\t\tinvhlmu\t\t\t\tlight-thorns\t\t7\t7\tstupidity\t\t1\t1\tres-ltng\t\t15\t15\tac-miss\t\t100\t100\tac\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Duskdeep\t74\t0\t1\t\t\t1\t\t23\t17\tfhl\tFull Helm\t\t5\t5000\tlgry\t\t\tinvfhlu\t\t\t\tlight\t\t-2\t-2\tres-all\t\t15\t15\tred-dmg\t\t7\t7\tdmg-max\t\t8\t8\tac\t\t10\t20\tac%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Wormskull\t75\t0\t1\t\t\t1\t\t28\t21\tbhm\tBone Helm\t\t5\t5000\tlgrn\t\t\tinvbhmu\t\t\t\tnec\t\t1\t1\tlifesteal\t\t5\t5\tmana\t\t10\t10\tres-pois\t\t25\t25\tdmg-pois\t200\t102\t102\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Howltusk\t76\t0\t1\t\t\t1\t\t34\t25\tghm\tGreat Helm\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tred-mag\t\t2\t2\tthorns\t\t3\t3\tac%\t\t80\t80\tdmg-to-mana\t\t35\t35\tknock\t\t1\t1\thowl\t\t33\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Undead Crown\t77\t0\t1\t\t\t1\t\t39\t29\tcrn\tCrown\t\t5\t5000\tblac\tblac\t\t\t\t\t\tlifesteal\t\t5\t5\tac\t\t40\t40\tres-pois\t\t50\t50\thalf-freeze\t\t1\t1\tac%\t\t30\t60\tdmg-undead\t\t50\t50\tatt-undead\t\t50\t100\tskill\t69\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Face of Horror\t78\t0\t1\t\t\t1\t\t27\t20\tmsk\tMask\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\thowl\t\t64\t64\tstr\t\t20\t20\tres-all\t\t10\t10\tdmg-undead\t\t50\t50\tac\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Greyform\t79\t0\t1\t\t\t1\t\t10\t7\tqui\tQuilted Armor\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tred-mag\t\t3\t3\tres-cold\t\t20\t20\tres-fire\t\t20\t20\tdex\t\t10\t10\tlifesteal\t\t5\t5\tac\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blinkbats Form\t80\t0\t1\t\t\t1\t\t16\t12\tlea\tLeather Armor\t\t5\t5000\tdred\tdred\t\t\t\t\t\tac-miss\t\t50\t50\tmove2\t\t10\t10\tac\t\t25\t25\tfire-min\t\t3\t3\tfire-max\t\t6\t6\tbalance2\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Centurion\t81\t0\t1\t\t\t1\t\t19\t14\thla\tHard Leather\t\t5\t5000\tcred\tcred\t\t\t\t\t\tac\t\t30\t30\tatt\t\t50\t50\tred-dmg\t\t2\t2\thp\t\t15\t15\tmana\t\t15\t15\tstam\t\t15\t15\tregen\t\t5\t5\tstamdrain\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Twitchthroe\t82\t0\t1\t\t\t1\t\t22\t16\tstu\tStudded Leather\t\t5\t5000\tlgrn\tlgrn\t\t\t\t\t\tswing2\t\t20\t20\tdex\t\t10\t10\tblock\t\t25\t25\tac\t\t25\t25\tstr\t\t10\t10\tbalance2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Darkglow\t83\t0\t1\t\t\t1\t\t19\t14\trng\tRing Mail\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tatt\t\t20\t20\tres-all-max\t\t5\t5\tlight\t\t3\t3\tac-hth\t\t50\t50\tres-all\t\t10\t10\tac%\t\t70\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hawkmail\t84\t0\t1\t\t\t1\t\t20\t15\tscl\tScale Mail\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tac%\t\t80\t100\tres-cold-max\t\t15\t15\tres-cold\t\t15\t15\tnofreeze\t\t1\t1\tmove2\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Sparking Mail\t85\t0\t1\t\t\t1\t\t23\t17\tchn\tChain Mail\t\t5\t5000\tlyel\tlyel\t\t\t\t\t\tac%\t\t75\t85\tdmg-ltng\t\t1\t20\tlight-thorns\t\t10\t14\tres-ltng\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Venomsward\t86\t0\t1\t\t\t1\t\t27\t20\tbrs\tBreast Plate\t\t5\t5000\tdyel\tdyel\t\t\t\t\t\tres-pois-max\t\t15\t15\tres-pois-len\t\t50\t50\tres-pois\t\t90\t90\tlight\t\t2\t2\tac%\t\t60\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Iceblink\t87\t0\t1\t\t\t1\t\t30\t22\tspl\tSplint Mail\t\t5\t5000\tlgld\tlgld\t\t\t\t\t\tfreeze\t\t1\t1\tres-cold\t\t30\t30\tlight\t\t4\t4\tred-mag\t\t1\t1\tac%\t\t70\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Boneflesh\t88\t0\t1\t\t\t1\t\t35\t26\tplt\tPlate Mail\t\t5\t5000\tdgld\tdgld\t\t\t\t\t\tlifesteal\t\t5\t5\tac%\t\t100\t120\tatt\t\t35\t35\topenwounds\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rockfleece\t89\t0\t1\t\t\t1\t\t38\t28\tfld\tField Plate\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tease\t\t-10\t-10\tac%\t\t100\t130\tred-dmg%\t\t10\t10\tred-dmg\t\t5\t5\tstr\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rattlecage\t90\t0\t1\t\t\t1\t\t39\t29\tgth\tGothic Plate\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\thowl\t\t52\t52\tatt\t\t45\t45\tcrush\t\t25\t25\tac\t\t200\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Goldskin\t91\t0\t1\t\t\t1\t\t38\t28\tful\tFull Plate Mail\t\t5\t5000\toran\t\t\tinvfulu\t\t\t\tac%\t\t120\t150\tres-all\t\t35\t35\tthorns\t\t10\t10\tlight\t\t2\t2\tgold%\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Victors Silk\t92\t0\t1\t\t\t1\t\t38\t28\taar\tAncientArmor\t\t5\t5000\tdblu\t\t\tinvaaru\t\t\t\tmanasteal\t\t5\t5\tallskills\t\t1\t1\tlight\t\t2\t2\tac%\t\t100\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Heavenly Garb\t93\t0\t1\t\t\t1\t\t39\t29\tltp\tLight Plate\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tac%\t\t100\t100\tres-all\t\t10\t10\tregen-mana\t\t25\t25\tenr\t\t15\t15\tdmg-undead\t\t50\t50\tatt-undead\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Pelta Lunata\t94\t0\t1\t\t\t1\t\t3\t2\tbuc\tBuckler\t\t5\t5000\twhit\t\t\tinvbucu\t\t\t\tac\t\t30\t30\tvit\t\t10\t10\tstr\t\t2\t2\tenr\t\t10\t10\tac%\t\t30\t40\tblock\t\t20\t20\tblock2\t\t40\t40\tdur\t\t8\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Umbral Disk\t95\t0\t1\t\t\t1\t\t12\t9\tsml\tSmall Shield\t\t5\t5000\tlgry\t\t\tinvsmlu\t\t\t\tstupidity\t\t1\t1\tdex\t\t10\t10\tac\t\t30\t30\thp\t\t20\t20\tlight\t\t-2\t-2\tac%\t\t40\t50\tblock\t\t30\t30\tdur\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stormguild\t96\t0\t1\t\t\t1\t\t18\t13\tlrg\tLarge Shield\t\t5\t5000\tdgry\t\t\tinvlrgu\t\t\t\tred-mag\t\t1\t1\tres-ltng\t\t25\t25\tac\t\t30\t30\tdmg-ltng\t\t1\t6\tac%\t\t50\t60\tblock\t\t30\t30\tlight-thorns\t\t3\t3\tdur\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Wall of the Eyeless\t97\t0\t1\t\t\t1\t\t27\t20\tbsh\tBone Shield\t\t5\t5000\tlgld\t\t\tinvbshu\t\t\t\tmana-kill\t\t5\t5\tmanasteal\t\t3\t3\tcast2\t\t20\t20\tres-pois\t\t20\t20\tac%\t\t30\t40\tac\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Swordback Hold\t98\t0\t1\t\t\t1\t\t20\t15\tspk\tSpiked Shield\t\t5\t5000\tlred\t\t\tinvspku\t\t\t\tthorns\t\t5\t5\tblock\t\t20\t20\topenwounds\t\t50\t50\tbloody\t\t3\t5\tac%\t\t30\t60\tthorns\t\t5\t5\tac\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Steelclash\t99\t0\t1\t\t\t1\t\t23\t17\tkit\tKite Shield\t\t5\t5000\tblac\t\t\tinvkitu\t\t\t\tblock\t\t25\t25\tpal\t\t1\t1\tred-dmg\t\t3\t3\tlight\t\t3\t3\tac%\t\t60\t100\tblock2\t\t20\t20\tres-all\t\t15\t15\tac\t\t20\t20\tdur\t\t15\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bverrit Keep\t100\t0\t1\t\t\t1\t\t26\t19\ttow\tTower Shield\t\t5\t5000\tlblu\t\t\tinvtowu\t\t\t\tac\t\t30\t30\tres-fire\t\t75\t75\tstr\t\t5\t5\tred-mag\t\t5\t5\tac%\t\t80\t120\tblock\t\t10\t10\tdur\t\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Ward\t101\t0\t1\t\t\t1\t\t35\t26\tgts\tGothic Shield\t\t5\t5000\tdblu\t\t\tinvgtsu\t\t\t\tac\t\t40\t40\tred-mag\t\t2\t2\tstr\t\t10\t10\tblock\t\t10\t10\tac%\t\t100\t100\tres-all\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Hand of Broc\t102\t0\t1\t\t\t1\t\t7\t5\tlgl\tGloves\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tmanasteal\t\t3\t3\tlifesteal\t\t3\t3\tres-pois\t\t10\t10\tmana\t\t20\t20\tac\t\t10\t10\tac%\t\t10\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bloodfist\t103\t0\t1\t\t\t1\t\t12\t9\tvgl\tHeavy Gloves\t\t5\t5000\toran\toran\t\t\t\t\t\tdmg-min\t\t5\t5\thp\t\t40\t40\tbalance2\t\t30\t30\tac\t\t10\t10\tac%\t\t10\t20\tswing2\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Chance Guards\t104\t0\t1\t\t\t1\t\t20\t15\tmgl\tBracers\t\t5\t5000\tlred\tlred\t\t\t\t\t\tgold%\t\t200\t200\tmag%\t\t25\t40\tatt\t\t25\t25\tac\t\t15\t15\tlight\t\t2\t2\tac%\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Magefist\t105\t0\t1\t\t\t1\t\t31\t23\ttgl\tLight Gauntlets\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tcast3\t\t20\t20\tregen-mana\t\t25\t25\tfireskill\t\t1\t1\tdmg-fire\t\t1\t6\tac\t\t10\t10\tac%\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Frostburn\t106\t0\t1\t\t\t1\t\t39\t29\thgl\tGauntlets\t\t5\t5000\tdred\tdred\t\t\t\t\t\tac\t\t30\t30\tdmg%\t\t5\t5\tmana%\t\t40\t40\tdmg-cold\t50\t1\t6\tac%\t\t10\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hotspur\t107\t0\t1\t\t\t1\t\t7\t5\tlbt\tLeather Boots\t\t5\t5000\tcred\tcred\t\t\t\t\t\tres-fire-max\t\t15\t15\thp\t\t15\t15\tdmg-fire\t\t3\t6\tac\t\t6\t6\tres-fire\t\t45\t45\tac%\t\t10\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gorefoot\t108\t0\t1\t\t\t1\t\t12\t9\tvbt\tHeavy Boots\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tbloody\t\t3\t5\tmove2\t\t20\t20\tmanasteal\t\t2\t2\tthorns\t\t2\t2\tac\t\t12\t12\tac%\t\t20\t30\tskill\t132\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Treads of Cthon\t109\t0\t1\t\t\t1\t\t20\t15\tmbt\tChain Boots\t\t5\t5000\tlgrn\tlgrn\t\t\t\t\t\tmove2\t\t30\t30\tac-miss\t\t50\t50\tstamdrain\t\t50\t50\thp\t\t10\t10\tac\t\t12\t12\tac%\t\t30\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Goblin Toe\t110\t0\t1\t\t\t1\t\t30\t22\ttbt\tLight Plate Boots\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tcrush\t\t25\t25\tred-dmg\t\t1\t1\tred-mag\t\t1\t1\tac\t\t15\t15\tlight\t\t-1\t-1\tac%\t\t50\t60\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Tearhaunch\t111\t0\t1\t\t\t1\t\t39\t29\thbt\tPlate Boots\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tac\t\t35\t35\tstr\t\t5\t5\tdex\t\t5\t5\tmove2\t\t20\t20\tres-all\t\t10\t10\tac%\t\t60\t80\tskill\t115\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lenyms Cord\t112\t0\t1\t\t\t1\t\t10\t7\tlbl\tSash\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tmana\t\t15\t15\tregen-mana\t\t30\t30\tres-all\t\t5\t5\tlight\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Snakecord\t113\t0\t1\t\t\t1\t\t16\t12\tvbl\tLight Belt\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdmg-pois\t75\t40\t40\tres-pois\t\t25\t25\tac\t\t10\t10\tac%\t\t20\t30\tregen\t\t5\t5\tres-pois-len\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Nightsmoke\t114\t0\t1\t\t\t1\t\t27\t20\tmbl\tBelt\t\t5\t5000\tlyel\tlyel\t\t\t\t\t\tres-all\t\t10\t10\tdmg-to-mana\t\t50\t50\tmana\t\t20\t20\tred-dmg\t\t2\t2\tac\t\t15\t15\tac%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Goldwrap\t115\t0\t1\t\t\t1\t\t36\t27\ttbl\tHeavy Belt\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tmag%\t\t30\t30\tlight\t\t2\t2\tac\t\t25\t25\tswing2\t\t10\t10\tac%\t\t40\t60\tgold%\t\t50\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bladebuckle\t116\t0\t1\t\t\t1\t\t39\t29\thbl\tGirdle\t\t5\t5000\tdyel\tdyel\t\t\t\t\t\tthorns\t\t8\t8\tac\t\t30\t30\tred-dmg\t\t3\t3\tstr\t\t5\t5\tdex\t\t10\t10\tac%\t\t80\t100\tbalance2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Nokozan Relic\t117\t0\t1\t\t\t20\t\t14\t10\tamu\tAmulet\t\t5\t5000\tlgld\t\t\t\t\t\t\tdmg-fire\t\t3\t6\tres-fire-max\t\t10\t10\tres-fire\t\t50\t50\tlight\t\t3\t3\tbalance2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Eye of Etlich\t118\t0\t1\t\t\t5\t\t20\t15\tamu\tAmulet\t\t5\t5000\tdgld\t\t\t\t\t\t\tac-miss\t\t10\t40\tlight\t\t1\t5\tallskills\t\t1\t1\tlifesteal\t\t3\t7\tcold-min\t\t1\t2\tcold-max\t\t3\t5\tcold-len\t\t50\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Mahim-Oak Curio\t119\t0\t1\t\t\t10\t\t34\t25\tamu\tAmulet\t\t5\t5000\tlpur\t\t\t\t\t\t\tdex\t\t10\t10\tstr\t\t10\t10\tenr\t\t10\t10\tvit\t\t10\t10\tac\t\t10\t10\tatt%\t\t10\t10\tres-all\t\t10\t10\tac%\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Nagelring\t120\t0\t1\t\t\t15\t\t10\t7\trin\tRing\t\t5\t5000\tdpur\t\t\t\t\t\t\tred-mag\t\t3\t3\tthorns\t\t3\t3\tatt\t\t50\t75\tmag%\t\t15\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Manald Heal\t121\t0\t1\t\t\t15\t\t20\t15\trin\tRing\t\t5\t5000\toran\t\t\t\t\t\t\tmanasteal\t\t4\t7\tregen\t\t5\t8\thp\t\t20\t20\tregen-mana\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Stone of Jordan\t122\t0\t1\t\t\t1\t\t39\t29\trin\tRing\t\t5\t5000\twhit\t\t\t\t\t\t\tmana\t\t20\t20\tmana%\t\t25\t25\tltng-min\t\t1\t1\tallskills\t\t1\t1\tltng-max\t\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\n";
-                ss << u8"Amulet of the Viper\t123\t0\t1\t\t\t1\t\t0\t0\tvip\tAmulet\t\t5\t5000\tlgry\t\t\t\t\t\t\tmana\t\t10\t10\tres-pois\t\t25\t25\thp\t\t10\t10\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Staff of Kings\t124\t0\t1\t\t\t1\t\t0\t0\tmsf\tStaff\t\t5\t5000\tdgry\t\t\t\t\t\t\tres-all\t\t10\t10\tswing3\t\t50\t50\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Horadric Staff\t125\t0\t1\t\t\t1\t\t0\t0\thst\tStaff\t\t5\t5000\tblac\t\t\t\t\t\t\tmana\t\t10\t10\tres-pois\t\t25\t25\thp\t\t10\t10\tres-all\t\t10\t10\tswing3\t\t50\t50\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hell Forge Hammer\t126\t0\t1\t\t\t1\t\t0\t0\thfh\tHammer\t\t5\t5000\tcred\t\t\t\t\t\t\tfire-min\t\t5\t5\tfire-max\t\t20\t20\tres-fire\t\t40\t40\tac\t\t35\t35\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"KhalimFlail\t127\t0\t1\t\t\t1\t\t0\t0\tqf1\tFlail\t\t5\t5000\tdblu\t\t\t\t\t\t\tltng-min\t\t1\t1\tltng-max\t\t20\t20\tswing3\t\t50\t50\tatt\t\t40\t40\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"SuperKhalimFlail\t128\t0\t1\t\t\t1\t\t0\t0\tqf2\tFlail\t\t5\t5000\tdblu\t\t\t\t\t\t\tltng-min\t\t1\t1\tltng-max\t\t40\t40\tswing3\t\t50\t50\tatt\t\t40\t40\tmanasteal\t\t6\t6\tlifesteal\t\t6\t6\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Coldkill\t129\t100\t1\t\t\t1\t\t44\t36\t9ha\tHatchet\t\t5\t5000\tcblu\tcblu\t\tinvhaxu\t\t\t\tdmg-cold\t50\t40\t40\tres-cold\t\t15\t15\tres-cold-max\t\t15\t15\tswing3\t\t30\t30\thit-skill\t45\t10\t10\tgethit-skill\t44\t10\t5\tdmg%\t\t150\t190\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Butcher's Pupil\t130\t100\t1\t\t\t1\t\t47\t39\t9ax\tCleaver\t\t5\t5000\tcblu\tcblu\t\tinvaxeu\t\t\t\tdeadly\t\t35\t35\topenwounds\t\t25\t25\tdmg%\t\t150\t200\tindestruct\t\t1\t1\tswing3\t\t30\t30\tdmg-norm\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Islestrike\t131\t100\t1\t\t\t1\t\t51\t43\t92a\tTwin Axe\t\t5\t5000\t\t\t\t\t\t\t\tdru\t\t2\t2\tstr\t\t10\t10\tdex\t\t10\t10\tvit\t\t10\t10\tenr\t\t10\t10\tac-miss\t\t50\t50\tcrush\t\t25\t25\tdmg%\t\t170\t190\tskill\t233\t1\t1\tskill\t248\t1\t1\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Pompe's Wrath\t132\t100\t1\t\t\t1\t\t53\t45\t9mp\tCrowbill\t\t5\t5000\tcred\tcred\t\tinvmpiu\t\t\t\thit-skill\t244\t4\t8\tslow\t\t50\t50\tdmg-fire\t\t35\t150\tknock\t\t1\t1\tdmg%\t\t140\t170\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Guardian Naga\t133\t100\t1\t\t\t1\t\t56\t48\t9wa\tNaga\t\t5\t5000\t\t\t\t\t\t\t\thit-skill\t92\t5\t8\tthorns\t\t15\t15\tres-pois\t\t30\t30\tdmg%\t\t150\t180\tdmg-pois\t250\t256\t256\tdmg-max\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Warlord's Trust\t134\t100\t1\t\t\t1\t\t43\t35\t9la\tMilitary Axe\t\t5\t5000\twhit\twhit\t\t\t\t\t\tac\t\t75\t75\tregen\t\t20\t20\tvit/lvl\t4\t\t\tres-all\t\t10\t10\trep-dur\t25\t\t\tdmg%\t\t175\t175\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Spellsteel\t135\t100\t1\t\t\t1\t\t47\t39\t9ba\tBearded Axe\t\t5\t5000\twhit\twhit\t\t\t\t\t\tease\t\t-60\t-60\tmana\t\t100\t100\tred-mag\t\t12\t15\tcast1\t\t10\t10\tdmg%\t\t165\t165\tregen-mana\t\t25\t25\tcharged\t54\t20\t1\tcharged\t87\t30\t3\tcharged\t101\t100\t10\tcharged\t225\t60\t12\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stormrider\t136\t100\t1\t\t\t1\t\t49\t41\t9bt\tTabar\t\t5\t5000\tlred\tlred\t\tinv9btu\t\t\t\thit-skill\t53\t5\t10\thit-skill\t38\t10\t0\tdmg-ltng\t\t1\t200\tdmg-norm\t\t35\t75\tdmg%\t\t100\t100\tdur\t\t50\t50\tlight-thorns\t\t15\t15\tgethit-skill\t38\t15\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Boneslayer Blade\t137\t100\t1\t\t\t1\t\t50\t42\t9ga\tGothic Axe\t\t5\t5000\t\t\t\tinvgaxu\t\t\t\tatt-und/lvl\t10\t\t\tdmg-und/lvl\t20\t\t\tstr\t\t8\t8\tswing2\t\t20\t20\tatt%\t\t35\t35\tdmg%\t\t180\t220\tcharged\t101\t200\t20\tgethit-skill\t101\t50\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Minataur\t138\t100\t1\t\t\t1\t\t53\t45\t9gi\tAncient Axe\t\t5\t5000\t\t\t\tinv9giu\t\t\t\tstupidity\t\t2\t2\thalf-freeze\t\t1\t1\tstr\t\t15\t20\tslow\t\t50\t50\tcrush\t\t30\t30\tdmg-norm\t\t20\t30\tdmg%\t\t140\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Suicide Branch\t139\t100\t1\t\t\t1\t\t41\t33\t9wn\tBurnt Wand\t\t5\t5000\t\t\t\t\t\t\t\tthorns\t\t25\t25\tcast2\t\t50\t50\tres-all\t\t10\t10\tmana%\t\t10\t10\thp\t\t40\t40\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Carin Shard\t140\t100\t1\t\t\t1\t\t43\t35\t9yw\tPetrified Wand\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\thp/lvl\t10\t\t\tcast2\t\t10\t10\tmana/lvl\t10\t\t\tbalance2\t\t30\t30\tregen\t\t5\t5\tnec\t\t1\t1\tskilltab\t8\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Arm of King Leoric\t141\t100\t1\t\t\t1\t\t44\t36\t9bw\tTomb Wand\t\t5\t5000\t\t\t\tinvbwnu\t\t\t\tskilltab\t8\t2\t2\tgethit-skill\t93\t5\t10\tmana/lvl\t10\t\t\tgethit-skill\t88\t10\t2\tcast1\t\t10\t10\tskilltab\t7\t2\t2\tskill\t77\t2\t2\tskill\t80\t2\t2\tskill\t69\t3\t3\tskill\t70\t3\t3\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blackhand Key\t142\t100\t1\t\t\t1\t\t49\t41\t9gw\tGrave Wand\t\t5\t5000\tblac\tblac\t\tinv9gwu\t\t\t\tskilltab\t6\t1\t1\tdmg-to-mana\t\t20\t20\thp\t\t50\t50\tlight\t\t-2\t-2\tcast3\t\t30\t30\tres-fire\t\t37\t37\tnec\t\t2\t2\tcharged\t150\t30\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Dark Clan Crusher\t143\t100\t1\t\t\t1\t\t42\t34\t9cl\tCudgel\t\t5\t5000\tdgld\tdgld\t\tinvclbu\t\t\t\tdru\t\t2\t2\tdmg-demon\t\t200\t200\tatt-demon\t\t200\t200\tdmg%\t\t195\t195\tatt%\t\t20\t25\tdemon-heal\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Zakarum's Hand\t144\t100\t1\t\t\t1\t\t45\t37\t9sc\tRune Scepter\t\t5\t5000\tlpur\tlpur\t\t\t\t\t\tmanasteal\t\t8\t8\tignore-ac\t\t1\t1\tregen-mana\t\t10\t10\tregen-stam\t\t15\t15\thit-skill\t59\t6\t5\tdmg%\t\t180\t220\tswing2\t\t30\t30\tskill\t114\t2\t2\tskill\t118\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Fetid Sprinkler\t145\t100\t1\t\t\t1\t\t46\t38\t9qs\tHoly Water Sprinkler\t\t5\t5000\t\t\t\t\t\t\t\tpal\t\t2\t2\thit-skill\t87\t5\t1\thit-skill\t81\t10\t1\tdmg-pois\t100\t409\t409\tdmg%\t\t160\t190\tatt\t\t150\t200\tdmg-norm\t\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hand of Blessed Light\t146\t100\t1\t\t\t1\t\t50\t42\t9ws\tDivine Scepter\t\t5\t5000\tlyel\t\t\t\t\t\t\tpal\t\t2\t2\tdmg%\t\t130\t160\tatt%\t\t100\t100\tac\t\t50\t50\tregen-mana\t\t15\t15\tlight\t\t4\t4\tdmg-norm\t\t20\t45\tskill\t101\t4\t4\tskill\t121\t2\t2\thit-skill\t121\t5\t4\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Fleshrender\t147\t100\t1\t\t\t1\t\t46\t38\t9sp\tBarbed Club\t\t5\t5000\tblac\t\t\tinvspcu\t\t\t\topenwounds\t\t25\t25\tnoheal\t\t1\t1\tcrush\t\t20\t20\tdeadly\t\t20\t20\tdmg-norm\t\t35\t50\tdmg%\t\t130\t200\tdru\t\t1\t1\tskilltab\t16\t2\t2\tdur\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Sureshrill Frost\t148\t100\t1\t\t\t1\t\t47\t39\t9ma\tFlanged Mace\t\t5\t5000\t\t\t\t\t\t\t\tdmg-cold\t125\t63\t112\tnofreeze\t\t1\t1\tdmg%\t\t150\t180\tdmg-norm\t\t5\t10\tfreeze\t\t3\t3\tcharged\t64\t50\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Moonfall\t149\t100\t1\t\t\t1\t\t50\t42\t9mt\tJagged Star\t\t5\t5000\t\t\t\tinvmstu\t\t\t\thit-skill\t56\t5\t6\tdmg-fire\t\t55\t115\tred-mag\t\t9\t12\tdmg%\t\t120\t150\tlight\t\t2\t2\tcharged\t56\t60\t11\tdmg-norm\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Baezil's Vortex\t150\t100\t1\t\t\t1\t\t53\t45\t9fl\tKnout\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\thit-skill\t48\t5\t8\tdmg-ltng\t\t1\t150\tmana\t\t100\t100\tres-ltng\t\t25\t25\tdmg%\t\t160\t200\tswing2\t\t20\t20\tcharged\t48\t80\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Earthshaker\t151\t100\t1\t\t\t1\t\t51\t43\t9wh\tBattle Hammer\t\t5\t5000\t\t\t\t\t\t\t\thit-skill\t234\t5\t7\tknock\t\t1\t1\tswing3\t\t30\t30\tdmg%\t\t180\t180\tstupidity\t\t1\t1\tskilltab\t17\t3\t3\tdur\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bloodtree Stump\t152\t100\t1\t\t\t1\t\t56\t48\t9m9\tWar Club\t\t5\t5000\tdred\t\t\t\t\t\t\tcrush\t\t50\t50\tdmg%\t\t180\t220\tres-all\t\t20\t20\tstr\t\t25\t25\tskilltab\t13\t2\t2\tskill\t129\t3\t3\tdur\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Gavel of Pain\t153\t100\t1\t\t\t1\t\t53\t45\t9gm\tMartel de Fer\t\t5\t5000\t\t\t\tinv9gmu\t\t\t\thit-skill\t66\t5\t1\tgethit-skill\t76\t5\t1\tthorns\t\t26\t26\tindestruct\t\t1\t1\tdmg-norm\t\t12\t30\tdmg%\t\t130\t160\tcharged\t66\t3\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bloodletter\t154\t100\t1\t\t\t1\t\t38\t30\t9ss\tGladius\t\t5\t5000\tcred\tcred\t\t\t\t\t\tdmg-norm\t\t12\t45\tatt\t\t90\t90\tlifesteal\t\t8\t8\tstamdrain\t\t10\t10\tswing2\t\t20\t20\tdmg%\t\t140\t140\tskill\t127\t2\t4\tskill\t151\t1\t3\tdur\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Coldsteel Eye\t155\t100\t1\t\t\t1\t\t39\t31\t9sm\tCutlass\t\t5\t5000\tdgry\t\t\tinvscmu\t\t\t\tstupidity\t\t1\t1\tslow\t\t30\t30\tdeadly\t\t50\t50\tdur\t\t50\t50\tdmg%\t\t200\t250\tswing2\t\t20\t20\tmanasteal\t\t6\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hexfire\t156\t100\t1\t\t\t1\t\t41\t33\t9sb\tShamshir\t\t5\t5000\t\t\t\tinvsbru\t\t\t\tcharged\t62\t36\t6\tignore-ac\t\t1\t1\tres-fire\t\t25\t25\tres-fire-max\t\t10\t10\tdmg-norm\t\t35\t40\tdmg%\t\t140\t160\tfireskill\t\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blade of Ali Baba\t157\t100\t1\t\t\t1\t\t43\t35\t9fc\tTulwar\t\t5\t5000\tcred\tcred\t\t\t\t\t\tsock\t3\t\t\tgold%/lvl\t20\t\t\tmag%/lvl\t8\t\t\tmana\t\t15\t15\tdmg%\t\t60\t120\tdex\t\t5\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ginther's Rift\t158\t100\t1\t\t\t1\t\t45\t37\t9cr\tDimensional Blade\t\t5\t5000\tcblu\t\t\tinv9cru\t\t\t\tred-mag\t\t7\t12\tswing2\t\t30\t30\trep-dur\t20\t\t\tdur\t\t40\t40\tdmg-mag\t\t50\t120\tdmg%\t\t100\t150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Headstriker\t159\t100\t1\t\t\t1\t\t47\t39\t9bs\tBattle Sword\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tnoheal\t\t1\t1\tstr\t\t15\t15\tdeadly/lvl\t12\t\t\tdmg/lvl\t8\t\t\tdmg%\t\t150\t150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Plague Bearer\t160\t100\t1\t\t\t1\t\t49\t41\t9ls\tRune Sword\t\t5\t5000\t\t\t\tinv9lsu\t\t\t\thit-skill\t92\t5\t4\tdmg-pois\t200\t384\t384\tdmg-norm\t\t10\t45\tdmg%\t\t150\t150\tres-pois\t\t45\t45\tskill\t238\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Atlantian\t161\t100\t1\t\t\t1\t\t50\t42\t9wd\tAncient Sword\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tdur\t\t100\t100\tac\t\t75\t75\tstr\t\t16\t16\tdex\t\t12\t12\tvit\t\t8\t8\tdmg%\t\t200\t250\tpal\t\t2\t2\tatt%\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Crainte Vomir\t162\t100\t1\t\t\t1\t\t50\t42\t92h\tEspadon\t\t5\t5000\tlgld\t\t\tinv2hsu\t\t\t\tslow\t\t35\t35\tdmg-ac\t\t-70\t-70\tmove2\t\t20\t20\tred-dmg%\t\t10\t10\tdmg%\t\t160\t200\tswing3\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bing Sz Wang\t163\t100\t1\t\t\t1\t\t51\t43\t9cm\tDacian Falx\t\t5\t5000\t\t\t\t\t\t\t\tease\t\t-30\t-30\tdmg-cold\t75\t50\t140\tstr\t\t20\t20\tfreeze\t\t2\t2\thit-skill\t64\t5\t3\tdmg%\t\t130\t160\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Vile Husk\t164\t100\t1\t\t\t1\t\t52\t44\t9gs\tTusk Sword\t\t5\t5000\tdgry\tdgry\t\tinvgisu\t\t\t\thit-skill\t66\t6\t1\tdmg-und/lvl\t60\t\t\tres-pois\t\t50\t50\tdmg-pois\t150\t426\t426\tdmg%\t\t150\t200\tatt-und/lvl\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Cloudcrack\t165\t100\t1\t\t\t1\t\t53\t45\t9b9\tGothic Sword\t\t5\t5000\t\t\t\tinvbswu\t\t\t\thit-skill\t121\t6\t7\tdmg-ltng\t\t1\t240\tac\t\t30\t30\tlight\t\t2\t2\tres-ltng-max\t\t10\t10\tdmg%\t\t150\t200\tlight-thorns\t\t15\t15\tskilltab\t10\t2\t2\tskilltab\t11\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Todesfaelle Flamme\t166\t100\t1\t\t\t1\t\t54\t46\t9fb\tZweihander\t\t5\t5000\t\t\t\tinv9fbu\t\t\t\tdmg-fire\t\t50\t200\tres-fire\t\t40\t40\tabs-fire\t\t10\t10\tatt-skill\t47\t10\t6\tdmg%\t\t120\t160\tcharged\t52\t45\t10\tcharged\t51\t20\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Swordguard\t167\t100\t1\t\t\t1\t\t55\t48\t9gd\tExecutioner Sword\t\t5\t5000\tbwht\tbwht\t\tinvgsdu\t\t\t\tease\t\t-50\t-50\tac/lvl\t40\t\t\tres-all\t\t10\t20\tac-miss\t\t100\t100\tdmg-to-mana\t\t30\t30\tdmg%\t\t170\t180\tac-hth\t\t200\t200\tbalance2\t\t20\t20\tblock\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Spineripper\t168\t100\t1\t\t\t1\t\t40\t32\t9dg\tPoignard\t\t5\t5000\t\t\t\t\t\t\t\tignore-ac\t\t1\t1\tlifesteal\t\t8\t8\tnoheal\t\t1\t1\tswing3\t\t15\t15\tdex\t\t10\t10\tdmg%\t\t200\t240\tdmg-norm\t\t15\t27\tnec\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Heart Carver\t169\t100\t1\t\t\t1\t\t44\t36\t9di\tRondel\t\t5\t5000\t\t\t\t\t\t\t\tdeadly\t\t35\t35\tignore-ac\t\t1\t1\tdmg-norm\t\t15\t35\tdmg%\t\t190\t240\tskill\t131\t4\t4\tskill\t142\t4\t4\tskill\t150\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blackbog's Sharp\t170\t100\t1\t\t\t1\t\t46\t38\t9kr\tCinquedeas\t\t5\t5000\t\t\t\tinvkrsu\t\t\t\tslow\t\t50\t50\tac\t\t50\t50\tdmg-norm\t\t15\t45\tswing3\t\t30\t30\tdmg-pois\t250\t500\t500\tskill\t73\t5\t5\tskill\t83\t4\t4\tskill\t92\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stormspike\t171\t100\t1\t\t\t1\t\t49\t41\t9bl\tStilleto\t\t5\t5000\tcblu\tcblu\t\tinv9blu\t\t\t\tdmg-ltng\t\t1\t120\tlight-thorns\t\t20\t20\tgethit-skill\t38\t25\t3\tdmg%\t\t150\t150\tres-ltng/lvl\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Impaler\t172\t100\t1\t\t\t1\t\t39\t31\t9sr\tWar Spear\t\t5\t5000\tlred\tlred\t\t\t\t\t\tignore-ac\t\t1\t1\tatt\t\t150\t150\tswing2\t\t20\t20\topenwounds\t\t40\t40\tnoheal\t\t1\t1\tdmg%\t\t140\t170\tskill\t19\t5\t5\tskill\t14\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Kelpie Snare\t173\t100\t1\t\t\t1\t\t41\t33\t9tr\tFuscina\t\t5\t5000\t\t\t\tinvtriu\t\t\t\tslow\t\t75\t75\tres-fire\t\t50\t50\thp/lvl\t10\t\t\tdmg-norm\t\t30\t50\tstr\t\t10\t10\tdmg%\t\t140\t180\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Soulfeast Tine\t174\t100\t1\t\t\t1\t\t43\t35\t9br\tWar Fork\t\t5\t5000\tlyel\tlyel\t\tinv9bru\t\t\t\tease\t\t-20\t-20\tlifesteal\t\t7\t7\tmanasteal\t\t7\t7\tstamdrain\t\t20\t20\tdmg%\t\t150\t190\tatt\t\t150\t250\tdur\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hone Sundan\t175\t100\t1\t\t\t1\t\t45\t37\t9st\tYari\t\t5\t5000\t\t\t\t\t\t\t\tsock\t3\t\t\tdmg-norm\t\t20\t40\tcrush\t\t45\t45\trep-dur\t10\t\t\tdmg%\t\t160\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Spire of Honor\t176\t100\t1\t\t\t1\t\t47\t39\t9p9\tLance\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tatt%\t\t25\t25\tlight\t\t3\t3\tregen\t\t20\t20\tbalance2\t\t20\t20\tdmg-norm\t\t20\t40\tdmg-dem/lvl\t12\t\t\tdmg%\t\t150\t200\tskilltab\t9\t3\t3\tac%\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Meat Scraper\t177\t100\t1\t\t\t1\t\t49\t41\t9b7\tLochaber Axe\t\t5\t5000\tdred\tdred\t\t\t\t\t\tdmg%\t\t150\t200\tswing2\t\t30\t30\tlifesteal\t\t10\t10\topenwounds\t\t50\t50\tmag%\t\t25\t25\tskilltab\t13\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blackleach Blade\t178\t100\t1\t\t\t1\t\t50\t42\t9vo\tBill\t\t5\t5000\tblac\tblac\t\t\t\t\t\tease\t\t-25\t-25\thit-skill\t72\t5\t5\tlight\t\t-2\t-2\tlifesteal\t\t8\t8\tdmg/lvl\t10\t\t\tdmg%\t\t100\t140\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Athena's Wrath\t179\t100\t1\t\t\t1\t\t50\t42\t9s8\tBattle Scythe\t\t5\t5000\t\t\t\tinv9s8u\t\t\t\tdru\t\t1\t3\tdex\t\t15\t15\tswing2\t\t30\t30\thp/lvl\t8\t\t\tdmg/lvl\t8\t\t\tdmg%\t\t150\t180\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Pierre Tombale Couant\t180\t100\t1\t\t\t1\t\t51\t43\t9pa\tPartizan\t\t5\t5000\tlgld\tlgld\t\t\t\t\t\tdeadly\t\t55\t55\tbar\t\t3\t3\tbalance2\t\t30\t30\tmanasteal\t\t6\t6\tdmg-norm\t\t12\t20\tdmg%\t\t160\t220\tatt\t\t100\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Husoldal Evo\t181\t100\t1\t\t\t1\t\t52\t44\t9h9\tBec-de-Corbin\t\t5\t5000\t\t\t\t\t\t\t\tregen\t\t20\t20\tatt\t\t200\t250\tnoheal\t\t1\t1\tdmg-norm\t\t20\t32\tdmg%\t\t160\t200\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Grim's Burning Dead\t182\t100\t1\t\t\t1\t\t52\t45\t9wc\tGrim Scythe\t\t5\t5000\tcred\tcred\t\t\t\t\t\tdmg-fire\t\t131\t232\tres-fire\t\t45\t45\tdmg%\t\t140\t180\tthorns\t\t8\t8\tease\t\t-50\t-50\tnec\t\t3\t3\treduce-ac\t\t50\t50\tac%\t\t20\t20\tatt\t\t200\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Razorswitch\t183\t100\t1\t\t\t1\t\t36\t28\t8ss\tJo Stalf\t\t5\t5000\tlpur\t\t\t\t\t\t\tcast3\t\t30\t30\tthorns\t\t15\t15\tmana\t\t175\t175\thp\t\t80\t80\tred-mag\t\t15\t15\tres-all\t\t50\t50\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ribcracker\t184\t100\t1\t\t\t1\t\t39\t31\t8ls\tQuarterstaff\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tdmg-norm\t\t30\t65\tdmg%\t\t200\t300\tcrush\t\t50\t50\tdex\t\t15\t15\tac\t\t100\t100\tac%\t\t100\t100\tbalance2\t\t50\t50\tswing2\t\t50\t50\tdur\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Chromatic Ire\t185\t100\t1\t\t\t1\t\t43\t35\t8cs\tCedar Staff\t\t5\t5000\t\t\t\tinvcstu\t\t\t\tsor\t\t3\t3\tres-all\t\t20\t40\tcast1\t\t20\t20\tlight-thorns\t\t20\t20\thp%\t\t20\t25\tskill\t61\t1\t1\tskill\t63\t1\t1\tskill\t65\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Warpspear\t186\t100\t1\t\t\t1\t\t47\t39\t8bs\tGothic Staff\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tsor\t\t3\t3\tignore-ac\t\t1\t1\tskill\t54\t3\t3\tskill\t43\t3\t3\tskill\t58\t3\t3\tac-miss\t\t250\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Skullcollector\t187\t100\t1\t\t\t1\t\t49\t41\t8ws\tRune Staff\t\t5\t5000\tblac\tblac\t\tinv8wsu\t\t\t\tmana%\t\t20\t20\tmana-kill\t\t20\t20\tallskills\t\t2\t2\tmag%/lvl\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Skystrike\t188\t100\t1\t\t\t1\t\t36\t28\t8sb\tEdge Bow\t\t5\t5000\t\t\t\t\t\t\t\tdmg-ltng\t\t1\t250\tatt\t\t100\t100\tenr\t\t10\t10\tswing3\t\t30\t30\tdmg%\t\t150\t200\thit-skill\t56\t2\t6\tama\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Riphook\t189\t100\t1\t\t\t1\t\t39\t31\t8hb\tRazor Bow\t\t5\t5000\tcred\tcred\t\t\t\t\t\topenwounds\t\t30\t30\tdmg%\t\t180\t220\tslow\t\t30\t30\tmana\t\t35\t35\tswing2\t\t30\t30\tlifesteal\t\t7\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Kuko Shakaku\t190\t100\t1\t\t\t1\t\t41\t33\t8lb\tCedarBow\t\t5\t5000\tlpur\tlpur\t\tinv8lbu\t\t\t\tskill\t27\t3\t3\texplosivearrow\t\t7\t7\tdmg%\t\t150\t180\tpierce\t\t50\t50\tdmg-fire\t\t40\t180\tskilltab\t0\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Endlesshail\t191\t100\t1\t\t\t1\t\t44\t36\t8cb\tDouble Bow\t\t5\t5000\t\t\t\tinvcbwu\t\t\t\tres-cold\t\t35\t35\tmana\t\t40\t40\tac-miss\t\t50\t50\tskill\t26\t3\t5\tdmg%\t\t180\t220\tdmg-cold\t75\t15\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Whichwild String\t192\t100\t1\t\t\t1\t\t47\t39\t8s8\tShort Siege Bow\t\t5\t5000\tlblu\tlblu\t\tinv8s8u\t\t\t\thit-skill\t66\t2\t5\tres-all\t\t40\t40\tdeadly/lvl\t8\t\t\tdmg%\t\t150\t170\tmagicarrow\t\t20\t20\tsock\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Cliffkiller\t193\t100\t1\t\t\t1\t\t49\t41\t8l8\tLong Siege Bow\t\t5\t5000\tdgld\t\t\t\t\t\t\tama\t\t2\t2\tdmg%\t\t190\t230\tac-miss\t\t80\t80\tknock\t\t1\t1\thp\t\t50\t50\tdmg-min\t\t5\t10\tdmg-max\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Magewrath\t194\t100\t1\t\t\t1\t\t51\t43\t8sw\tRune Bow\t\t5\t5000\toran\t\t\tinvswbu\t\t\t\tmanasteal\t\t15\t15\tred-mag\t\t9\t13\tskill\t22\t3\t3\tatt\t\t200\t250\tdex\t\t10\t10\tstupidity\t\t1\t1\tdmg-norm\t\t25\t50\tdmg%\t\t120\t150\tama\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Godstrike Arch\t195\t100\t1\t\t\t1\t\t54\t46\t8lw\tGothic Bow\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tdmg%\t\t200\t250\tatt%\t\t100\t150\tdmg-undead\t\t100\t200\tdmg-demon\t\t100\t200\thit-skill\t121\t5\t7\tswing2\t\t50\t50\tregen\t\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Langer Briser\t196\t100\t1\t\t\t1\t\t40\t32\t8lx\tArbalest\t\t5\t5000\t\t\t\tinv8lxu\t\t\t\tknock\t\t1\t1\tdmg%\t\t170\t200\tmag%\t\t30\t60\thp\t\t30\t30\tdmg-max\t\t10\t30\topenwounds\t\t33\t33\tdmg-ltng\t\t1\t212\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Pus Spiter\t197\t100\t1\t\t\t1\t\t44\t36\t8mx\tSiege Crossbow\t\t5\t5000\tcgrn\tcgrn\t\tinv8mxu\t\t\t\tdmg-pois\t200\t192\t192\thit-skill\t91\t4\t1\tnec\t\t2\t2\tease\t\t-60\t-60\tgethit-skill\t92\t9\t6\tswing2\t\t10\t10\tdmg%\t\t150\t220\tatt/lvl\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Buriza-Do Kyanon\t198\t100\t1\t\t\t1\t\t59\t41\t8hx\tBalista\t\t5\t5000\t\t\t\tinvhxbu\t\t\t\tpierce\t\t100\t100\tdex\t\t35\t35\tac\t\t75\t150\tdmg/lvl\t20\t\t\tswing2\t\t80\t80\tdmg%\t\t150\t200\tfreeze\t\t3\t3\tdmg-cold\t200\t32\t196\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Demon Machine\t199\t100\t1\t\t\t1\t\t57\t49\t8rx\tChu-Ko-Nu\t\t5\t5000\tblac\tblac\t\tinvrxbu\t\t\t\tac\t\t321\t321\tmana\t\t36\t36\tpierce\t\t66\t66\texplosivearrow\t\t6\t6\tdmg-max\t\t66\t66\tdmg%\t\t123\t123\tatt\t\t632\t632\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Armor\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Peasent Crown\t201\t100\t1\t\t\t1\t\t36\t28\txap\tWar Hat\t\t3\t5000\tlgry\t\t\t\t\t\t\tenr\t\t20\t20\tvit\t\t20\t20\tallskills\t\t1\t1\tmove2\t\t15\t15\tregen\t\t6\t12\tac%\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rockstopper\t202\t100\t1\t\t\t1\t\t39\t31\txkp\tSallet\t\t3\t5000\t\t\t\tinvxkpu\t\t\t\tres-ltng\t\t20\t40\tred-dmg%\t\t10\t10\tbalance2\t\t30\t30\tac%\t\t160\t220\tres-fire\t\t20\t50\tres-cold\t\t20\t40\tvit\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stealskull\t203\t100\t1\t\t\t1\t\t43\t35\txlm\tCasque\t\t3\t5000\t\t\t\tinvhlmu\t\t\t\tmanasteal\t\t5\t5\tlifesteal\t\t5\t5\tbalance2\t\t10\t10\tswing2\t\t10\t10\tac%\t\t200\t240\tmag%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Darksight Helm\t204\t100\t1\t\t\t1\t\t46\t38\txhl\tBasinet\t\t3\t5000\tblac\tblac\t\tinvfhlu\t\t\t\tlight\t\t-4\t-4\tac/lvl\t16\t\t\tnofreeze\t\t1\t1\tmanasteal\t\t5\t5\tgethit-skill\t71\t6\t3\tcharged\t264\t30\t5\tres-fire\t\t20\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Valkiry Wing\t205\t100\t1\t\t\t1\t\t52\t44\txhm\tWinged Helm\t\t3\t5000\tlgld\t\t\t\t\t\t\tac%\t\t150\t200\tmove2\t\t20\t20\tbalance2\t\t20\t20\tama\t\t1\t2\tmana-kill\t\t2\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Crown of Thieves\t206\t100\t1\t\t\t1\t\t57\t49\txrn\tGrand Crown\t\t3\t5000\tdgld\tdgld\t\tinvxrnu\t\t\t\tdex\t\t25\t25\tlifesteal\t\t9\t12\thp\t\t50\t50\tmana\t\t35\t35\tres-fire\t\t33\t33\tac%\t\t160\t200\tgold%\t\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blackhorn's Face\t207\t100\t1\t\t\t1\t\t49\t41\txsk\tDeath Mask\t\t3\t5000\tblac\tblac\t\t\t\t\t\tlight-thorns\t\t25\t25\tslow\t\t20\t20\tnoheal\t\t1\t1\tabs-ltng\t\t20\t20\tres-ltng\t\t15\t15\tac%\t\t180\t220\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Vampiregaze\t208\t100\t1\t\t\t1\t\t49\t41\txh9\tGrim Helm\t\t3\t5000\tcgrn\tcgrn\t\tinvbhmu\t\t\t\tmanasteal\t\t6\t8\tlifesteal\t\t6\t8\tstamdrain\t\t15\t15\tred-dmg%\t\t15\t20\tred-mag\t\t10\t15\tac%\t\t100\t100\tdmg-cold\t100\t6\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Spirit Shroud\t209\t100\t1\t\t\t1\t\t36\t28\txui\tGhost Armor\t\t3\t5000\t\t\t\t\t\t\t\tnofreeze\t\t1\t1\tallskills\t\t1\t1\tred-mag\t\t7\t11\tregen\t\t10\t10\tac%\t\t150\t150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Skin of the Vipermagi\t210\t100\t1\t\t\t1\t\t37\t29\txea\tSerpentSkin Armor\t\t3\t5000\tdblu\tdblu\t\t\t\t\t\tac%\t\t120\t120\tres-all\t\t20\t35\tcast3\t\t30\t30\tred-mag\t\t9\t13\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Skin of the Flayerd One\t211\t100\t1\t\t\t1\t\t39\t31\txla\tDemonhide Armor\t\t3\t5000\tlred\tlred\t\t\t\t\t\trep-dur\t10\t\t\tregen\t\t15\t25\tdur\t\t30\t30\tlifesteal\t\t5\t7\tac%\t\t150\t190\tthorns\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ironpelt\t212\t100\t1\t\t\t1\t\t41\t33\txtu\tTresllised Armor\t\t3\t5000\tdgry\tdgry\t\tinvxtuu\t\t\t\tdur\t\t125\t125\thp\t\t25\t25\tred-mag\t\t10\t16\tred-dmg\t\t15\t20\tac/lvl\t24\t\t\tac%\t\t50\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Spiritforge\t213\t100\t1\t\t\t1\t\t43\t35\txng\tLinked Mail\t\t3\t5000\t\t\t\t\t\t\t\tlight\t\t4\t4\thp/lvl\t10\t\t\tdmg-fire\t\t20\t65\tres-fire\t\t5\t5\tac%\t\t120\t160\tstr\t\t15\t15\tsock\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Crow Caw\t214\t100\t1\t\t\t1\t\t45\t37\txcl\tTigulated Mail\t\t3\t5000\t\t\t\t\t\t\t\topenwounds\t\t35\t35\tac%\t\t150\t180\tdex\t\t15\t15\tbalance2\t\t15\t15\tswing2\t\t15\t15\t*charged\t221\t3\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Shaftstop\t215\t100\t1\t\t\t1\t\t46\t38\txhn\tMesh Armor\t\t3\t5000\tdgry\t\t\t\t\t\t\tac-miss\t\t250\t250\tred-dmg%\t\t30\t30\thp\t\t60\t60\tac%\t\t180\t220\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Duriel's Shell\t216\t100\t1\t\t\t1\t\t49\t41\txrs\tCuirass\t\t3\t5000\toran\toran\t\t\t\t\t\tstr\t\t15\t15\tac/lvl\t10\t\t\thp/lvl\t8\t\t\tac%\t\t160\t200\tres-fire\t\t20\t20\tres-ltng\t\t20\t20\tres-pois\t\t20\t20\tres-cold\t\t50\t50\tnofreeze\t\t1\t1\tdur\t\t100\t100\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Skullder's Ire\t217\t100\t1\t\t\t1\t\t50\t42\txpl\tRusset Armor\t\t3\t5000\t\t\t\t\t\t\t\tallskills\t\t1\t1\tmag%/lvl\t10\t\t\tac%\t\t160\t200\tdur\t\t60\t60\tred-mag\t\t10\t10\trep-dur\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Guardian Angel\t218\t100\t1\t\t\t1\t\t53\t45\txlt\tTemplar Coat\t\t3\t5000\tlgry\tlgry\t\t\t\t\t\tlight\t\t4\t4\tpal\t\t1\t1\tac%\t\t180\t200\tblock2\t\t30\t30\tres-all-max\t\t15\t15\tatt-dem/lvl\t5\t\t\tblock\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Toothrow\t219\t100\t1\t\t\t1\t\t56\t48\txld\tSharktooth Armor\t\t3\t5000\twhit\twhit\t\t\t\t\t\tthorns\t\t20\t40\tac\t\t40\t60\tstr\t\t10\t10\topenwounds\t\t40\t40\tres-fire\t\t15\t15\tac%\t\t160\t220\tdur\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Atma's Wail\t220\t100\t1\t\t\t1\t\t59\t51\txth\tEmbossed Plate\t\t3\t5000\t\t\t\t\t\t\t\tdex\t\t15\t15\tregen\t\t10\t10\tmana%\t\t15\t15\tbalance2\t\t30\t30\tac/lvl\t16\t\t\tdur\t\t50\t50\tac%\t\t120\t160\tmag%\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Black Hades\t221\t100\t1\t\t\t1\t\t61\t53\txul\tChaos Armor\t\t3\t5000\t\t\t\t\t\t\t\tlight\t\t-2\t-2\tatt-demon\t\t200\t250\thalf-freeze\t\t1\t1\tsock\t3\t\t\tac%\t\t140\t200\tdmg-demon\t\t30\t60\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Corpsemourn\t222\t100\t1\t\t\t1\t\t63\t55\txar\tOrnate Armor\t\t3\t5000\tblac\tblac\t\tinvxaru\t\t\t\tstr\t\t8\t8\tvit\t\t10\t10\tres-cold\t\t35\t35\tgethit-skill\t76\t6\t2\tac%\t\t150\t180\tdmg-fire\t\t12\t36\tcharged\t74\t40\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Que-Hegan's Wisdon\t223\t100\t1\t\t\t1\t\t59\t51\txtp\tMage Plate\t\t3\t5000\t\t\t\t\t\t\t\tcast2\t\t20\t20\tmana-kill\t\t3\t3\tred-mag\t\t6\t10\tenr\t\t15\t15\tbalance2\t\t20\t20\tac%\t\t140\t160\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Visceratuant\t224\t100\t1\t\t\t1\t\t36\t28\txuc\tDefender\t\t3\t5000\tdred\t\t\tinvbucu\t\t\t\tsor\t\t1\t1\tblock2\t\t30\t30\tblock\t\t30\t30\tac%\t\t100\t150\tlight-thorns\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Mosers Blessed Circle\t225\t100\t1\t\t\t1\t\t39\t31\txml\tRound Shield\t\t3\t5000\t\t\t\tinvxmlu\t\t\t\tres-all\t\t25\t25\tblock\t\t25\t25\tsock\t2\t\t\tac%\t\t180\t220\tblock2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stormchaser\t226\t100\t1\t\t\t1\t\t43\t35\txrg\tScutum\t\t3\t5000\tcblu\tcblu\t\tinvxrgu\t\t\t\tdmg-ltng\t\t1\t60\tblock\t\t20\t20\thalf-freeze\t\t1\t1\tres-ltng\t\t50\t50\tatt\t\t150\t150\tac%\t\t160\t220\tblock2\t\t10\t10\tgethit-skill\t59\t4\t6\tgethit-skill\t245\t4\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Tiamat's Rebuke\t227\t100\t1\t\t\t1\t\t46\t38\txit\tDragon Shield\t\t3\t5000\tlgry\tlgry\t\tinvkitu\t\t\t\tdmg-cold\t150\t27\t53\tdmg-fire\t\t35\t95\tdmg-ltng\t\t1\t120\tres-all\t\t25\t35\tac%\t\t140\t200\tgethit-skill\t44\t5\t9\tgethit-skill\t48\t5\t7\tgethit-skill\t62\t3\t6\tdur\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Kerke's Sanctuary\t228\t100\t1\t\t\t1\t\t52\t44\txow\tPavise\t\t3\t5000\tlgrn\tlgrn\t\tinvtowu\t\t\t\tred-dmg\t\t11\t16\tred-mag\t\t14\t18\tregen\t\t15\t15\tac%\t\t180\t240\tdur\t\t100\t100\tblock\t\t30\t30\tres-all\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Radimant's Sphere\t229\t100\t1\t\t\t1\t\t58\t50\txts\tAncient Shield\t\t3\t5000\t\t\t\tinvgtsu\t\t\t\tdmg-pois\t100\t204\t204\tgethit-skill\t92\t5\t5\tres-pois\t\t75\t75\tac%\t\t160\t200\tblock\t\t20\t20\tblock2\t\t20\t20\tcharged\t83\t40\t6\tdur\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lidless Wall\t230\t100\t1\t\t\t1\t\t49\t41\txsh\tGrim Shield\t\t3\t5000\tdgld\tdgld\t\tinvxshu\t\t\t\tlight\t\t1\t1\tallskills\t\t1\t1\tcast2\t\t20\t20\tmana-kill\t\t3\t5\tac%\t\t80\t130\tenr\t\t10\t10\tmana%\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lance Guard\t231\t100\t1\t\t\t1\t\t43\t35\txpk\tBarbed Shield\t\t3\t5000\t\t\t\tinvxpku\t\t\t\thp\t\t50\t50\tbalance2\t\t30\t30\tdmg-to-mana\t\t15\t15\tthorns\t\t47\t47\tac%\t\t70\t120\tdeadly\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Venom Grip\t232\t100\t1\t\t\t1\t\t37\t29\txlg\tDemonhide Gloves\t\t5\t5000\tdgrn\t\t\t\t\t\t\tres-pois\t\t30\t30\tres-pois-max\t\t5\t5\tdmg-pois\t100\t153\t153\tcrush\t\t5\t5\tlifesteal\t\t5\t5\tac\t\t15\t25\tac%\t\t130\t160\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gravepalm\t233\t100\t1\t\t\t1\t\t39\t32\txvg\tSharkskin Gloves\t\t5\t5000\t\t\t\t\t\t\t\tenr\t\t10\t10\tstr\t\t10\t10\tdmg-undead\t\t100\t200\tatt-undead\t\t100\t200\tac%\t\t140\t180\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ghoulhide\t234\t100\t1\t\t\t1\t\t44\t36\txmg\tHeavy Bracers\t\t5\t5000\t\t\t\t\t\t\t\tatt-und/lvl\t16\t\t\tdmg-und/lvl\t16\t\t\tmanasteal\t\t4\t5\thp\t\t20\t20\tac%\t\t150\t190\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lavagout\t235\t100\t1\t\t\t1\t\t50\t42\txtg\tBattle Guantlets\t\t5\t5000\tlyel\t\t\t\t\t\t\tres-fire\t\t24\t24\thalf-freeze\t\t1\t1\thit-skill\t52\t2\t10\tswing2\t\t20\t20\tac%\t\t150\t200\tdmg-fire\t\t13\t46\tdur\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hellmouth\t236\t100\t1\t\t\t1\t\t55\t47\txhg\tWar Gauntlets\t\t5\t5000\t\t\t\t\t\t\t\tdmg-fire\t\t15\t72\tabs-fire\t\t15\t15\tac%\t\t150\t200\tdur\t\t15\t15\thit-skill\t56\t2\t4\thit-skill\t225\t4\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Infernostride\t237\t100\t1\t\t\t1\t\t37\t29\txlb\tDemonhide Boots\t\t5\t5000\t\t\t\t\t\t\t\tdmg-fire\t\t12\t33\tmove2\t\t20\t20\tres-fire-max\t\t10\t10\tres-fire\t\t30\t30\tlight\t\t2\t2\tac%\t\t120\t150\tgold%\t\t40\t70\tac\t\t15\t15\tgethit-skill\t46\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Waterwalk\t238\t100\t1\t\t\t1\t\t40\t32\txvb\tSharkskin Boots\t\t5\t5000\t\t\t\t\t\t\t\tac-miss\t\t100\t100\tmove2\t\t20\t20\tdex\t\t15\t15\tac%\t\t180\t210\thp\t\t45\t65\tstam\t\t40\t40\tres-fire-max\t\t5\t5\tregen-stam\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Silkweave\t239\t100\t1\t\t\t1\t\t44\t36\txmb\tMesh Boots\t\t5\t5000\t\t\t\t\t\t\t\tac%\t\t150\t190\tmana-kill\t\t5\t5\tac-miss\t\t200\t200\tmana%\t\t10\t10\tmove2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Wartraveler\t240\t100\t1\t\t\t1\t\t50\t42\txtb\tBattle Boots\t\t5\t5000\t\t\t\t\t\t\t\tvit\t\t10\t10\tstr\t\t10\t10\tmag%\t\t30\t50\tdur\t\t30\t30\tmove2\t\t25\t25\tac%\t\t150\t190\tdmg-norm\t\t15\t25\tthorns\t\t5\t10\tstamdrain\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gorerider\t241\t100\t1\t\t\t1\t\t55\t47\txhb\tWar Boots\t\t5\t5000\tdred\t\t\t\t\t\t\tease\t\t-25\t-25\tdeadly\t\t15\t15\tmove2\t\t30\t30\tcrush\t\t15\t15\topenwounds\t\t10\t10\tac%\t\t160\t200\tdur\t\t10\t10\tstam\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"String of Ears\t242\t100\t1\t\t\t1\t\t37\t29\tzlb\tDemonhide Sash\t\t5\t5000\tlred\t\t\t\t\t\t\tred-mag\t\t10\t15\tred-dmg%\t\t10\t15\tlifesteal\t\t6\t8\tac%\t\t150\t180\tac\t\t15\t15\tdur\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Razortail\t243\t100\t1\t\t\t1\t\t39\t32\tzvb\tSharkskin Belt\t\t5\t5000\t\t\t\t\t\t\t\tthorns/lvl\t8\t\t\tdex\t\t15\t15\tpierce\t\t33\t33\tac\t\t15\t15\tac%\t\t120\t150\tdmg-max\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gloomstrap\t244\t100\t1\t\t\t1\t\t45\t36\tzmb\tMesh Belt\t\t5\t5000\t\t\t\t\t\t\t\tlight\t\t-3\t-3\tmana%\t\t15\t15\tmanasteal\t\t5\t5\tac%\t\t120\t150\tvit\t\t15\t15\tregen-mana\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Snowclash\t245\t100\t1\t\t\t1\t\t49\t42\tztb\tBattle Belt\t\t5\t5000\t\t\t\t\t\t\t\tgethit-skill\t59\t5\t0\tabs-cold\t\t15\t15\tres-cold-max\t\t15\t15\tdmg-cold\t75\t13\t21\tac%\t\t130\t170\tskill\t59\t2\t2\tskill\t55\t3\t3\tskill\t60\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Thudergod's Vigor\t246\t100\t1\t\t\t1\t\t55\t47\tzhb\tWar Belt\t\t5\t5000\t\t\t\t\t\t\t\tgethit-skill\t121\t5\t7\tdmg-ltng\t\t1\t50\tres-ltng-max\t\t10\t10\tabs-ltng\t\t20\t20\tac%\t\t160\t200\tvit\t\t20\t20\tstr\t\t20\t20\tskill\t34\t3\t3\tskill\t35\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Elite Uniques\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Harlequin Crest\t248\t100\t1\t\t\t1\t\t69\t62\tuap\tShako\t\t3\t5000\tcgrn\tcgrn\t\t\t\t\t\tallskills\t\t2\t2\thp/lvl\t12\t\t\tmana/lvl\t12\t\t\tmag%\t\t50\t50\tred-dmg%\t\t10\t10\tstr\t\t2\t2\tdex\t\t2\t2\tvit\t\t2\t2\tenr\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Veil of Steel\t249\t100\t1\t\t\t1\t\t77\t73\tuhm\tSpired Helm\t\t3\t5000\tlgry\tlgry\t\t\t\t\t\tres-all\t\t50\t50\tac%\t\t60\t60\tstr\t\t15\t15\tvit\t\t15\t15\tlight\t\t-4\t-4\tdur\t\t20\t20\tac\t\t140\t140\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Gladiator's Bane\t250\t100\t1\t\t\t1\t\t85\t85\tutu\tWire Fleece\t\t3\t5000\tlgry\tlgry\t\t\t\t\t\tac%\t\t150\t200\tred-mag\t\t15\t20\tred-dmg\t\t15\t20\tthorns\t\t20\t20\tres-pois-len\t\t50\t50\tdur\t\t103\t103\tbalance2\t\t30\t30\tac\t\t50\t50\tnofreeze\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Arkaine's Valor\t251\t100\t1\t\t\t1\t\t85\t85\tupl\tBalrog Skin\t\t3\t5000\tlred\tlred\t\t\t\t\t\tac%\t\t150\t180\tbalance2\t\t30\t30\tallskills\t\t1\t2\tred-dmg\t\t10\t15\tvit/lvl\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Blackoak Shield\t252\t100\t1\t\t\t1\t\t67\t61\tuml\tLuna\t\t3\t5000\t\t\t\tinvsmlu\t\t\t\tdex/lvl\t4\t\t\tac%\t\t160\t200\tabs-cold/lvl\t5\t\t\tgethit-skill\t72\t4\t5\tdur\t\t45\t45\thp/lvl\t10\t\t\tblock2\t\t50\t50\thalf-freeze\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stormshield\t253\t100\t1\t\t\t1\t\t77\t73\tuit\tMonarch\t\t3\t5000\t\t\t\tinvkitu\t\t\t\tac/lvl\t30\t\t\tred-dmg%\t\t35\t35\tstr\t\t30\t30\tindestruct\t\t1\t1\tblock2\t\t35\t35\tres-ltng\t\t25\t25\tblock\t\t25\t25\tres-cold\t\t60\t60\tlight-thorns\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hellslayer\t254\t100\t1\t\t\t1\t\t71\t66\t7bt\tDecapitator\t\t5\t5000\tdred\tdred\t\tinvbtxu\t\t\t\tstr/lvl\t4\t\t\tvit/lvl\t4\t\t\tdmg%/lvl\t24\t\t\tdmg-fire\t\t150\t250\thp\t\t25\t25\tdmg%\t\t100\t100\tatt-skill\t47\t10\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Messerschmidt's Reaver\t255\t100\t1\t\t\t1\t\t75\t70\t7ga\tChampion Axe\t\t5\t5000\tblac\tblac\t\tinvgaxu\t\t\t\tdmg%/lvl\t20\t\t\tdmg%\t\t200\t200\tstr\t\t15\t15\tdex\t\t15\t15\tvit\t\t15\t15\tenr\t\t15\t15\tdmg-fire\t\t20\t240\tdur\t\t25\t25\tatt%\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Baranar's Star\t256\t100\t1\t\t\t1\t\t70\t65\t7mt\tDevil Star\t\t5\t5000\tlred\tlred\t\tinvmstu\t\t\t\tatt%\t\t200\t200\tdmg%\t\t200\t200\tdex\t\t15\t15\tstr\t\t15\t15\tswing2\t\t50\t50\tdur\t\t100\t100\tdmg-ltng\t\t1\t200\tdmg-fire\t\t1\t200\tdmg-cold\t\t1\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Schaefer's Hammer\t257\t100\t1\t\t\t1\t\t83\t79\t7wh\tLegendary Mallet\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\thit-skill\t42\t20\t10\thp\t\t50\t50\tatt/lvl\t16\t\t\tres-ltng\t\t75\t75\tswing2\t\t20\t20\tdmg/lvl\t16\t\t\tindestruct\t\t1\t1\tdmg%\t\t100\t130\tlight\t\t1\t1\tdmg-ltng\t\t50\t200\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Cranium Basher\t258\t100\t1\t\t\t1\t\t85\t87\t7gm\tThunder Maul\t\t5\t5000\tblac\tblac\t\t\t\t\t\tswing2\t\t20\t20\tindestruct\t\t1\t1\tstr\t\t25\t25\tres-all\t\t25\t25\tcrush\t\t75\t75\tdmg-norm\t\t20\t20\tdmg%\t\t200\t240\thit-skill\t66\t4\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lightsabre\t259\t100\t1\t\t\t5\t\t66\t58\t7cr\tPhase Blade\t\t5\t5000\tlblu\t\t\tinvcrsu\t\t\t\tlight\t\t7\t7\tatt-skill\t53\t5\t0\tignore-ac\t1\t1\t1\tabs-ltng%\t\t25\t25\tswing2\t\t20\t20\tdmg-mag\t\t60\t120\tdmg-ltng\t\t1\t200\tmanasteal\t\t5\t7\tdmg%\t\t150\t200\tdmg-norm\t\t10\t30\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Doombringer\t260\t100\t1\t\t\t1\t\t75\t69\t7b7\tChampion Sword\t\t5\t5000\tdred\tdred\t\tinvbswu\t\t\t\thp%\t\t20\t20\tdmg%\t\t180\t250\tatt%\t\t40\t40\tindestruct\t\t1\t1\tdmg-norm\t\t30\t100\thit-skill\t72\t8\t3\tlifesteal\t\t5\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Grandfather\t261\t100\t1\t\t\t1\t\t85\t81\t7gd\tColossus Blade\t\t5\t5000\tlyel\tlyel\t\tinvgsdu\t\t\t\tstr\t\t20\t20\tdex\t\t20\t20\tvit\t\t20\t20\tenr\t\t20\t20\tatt%\t\t50\t50\thp\t\t80\t80\tdmg/lvl\t20\t\t\tindestruct\t\t1\t1\tdmg%\t\t150\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Wizardspike\t262\t100\t1\t\t\t1\t\t69\t61\t7dg\tBone Knife\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tmana/lvl\t16\t\t\tregen-mana\t\t15\t15\tmana%\t\t15\t15\tres-all\t\t75\t75\tindestruct\t\t1\t1\tcast3\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Constricting Ring\t263\t100\t0\t\t\t1\t\t95\t95\trin\tRing\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tres-all\t\t100\t100\tregen\t\t-30\t-30\tmag%\t\t100\t100\tres-all-max\t\t15\t15\t\t\t\t\t\t\t\t\t\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stormspire\t264\t100\t1\t\t\t1\t\t78\t70\t7wc\tGiant Thresher\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tres-ltng\t\t50\t50\tgethit-skill\t53\t5\t5\tdmg%\t\t150\t250\tstr\t\t10\t10\tgethit-skill\t38\t2\t0\tswing2\t\t30\t30\tindestruct\t\t1\t1\tdmg-ltng\t\t1\t237\tlight-thorns\t\t27\t27\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Eaglehorn\t265\t100\t1\t\t\t1\t\t77\t69\t6l7\tCrusader Bow\t\t5\t5000\tdgld\tdgld\t\t\t\t\t\tignore-ac\t\t1\t1\tatt/lvl\t12\t\t\tdmg%/lvl\t16\t\t\tdmg%\t\t200\t200\tama\t\t1\t1\tdex\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Windforce\t266\t100\t1\t\t\t1\t\t80\t73\t6lw\tHydra Bow\t\t5\t5000\tdyel\tdyel\t\t\t\t\t\tdex\t\t5\t5\tdmg/lvl\t25\t\t\tregen-stam\t\t30\t30\tmanasteal\t\t6\t8\tknock\t\t1\t1\tdmg%\t\t250\t250\tswing2\t\t20\t20\tstr\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rings\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bul Katho's Wedding Band\t268\t100\t1\t\t\t1\t\t66\t58\trin\tRing\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\thp/lvl\t4\t\t\tallskills\t\t1\t1\tlifesteal\t\t3\t5\tstam\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Cat's Eye\t269\t100\t1\t\t\t5\t\t58\t50\tamu\tAmulet\t\t5\t5000\toran\toran\t\t\t\t\t\tmove2\t\t30\t30\tswing2\t\t20\t20\tac\t\t100\t100\tac-miss\t\t100\t100\tdex\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Rising Sun\t270\t100\t1\t\t\t5\t\t73\t65\tamu\tAmulet\t\t5\t5000\tlgld\tlgld\t\t\t\t\t\tabs-fire/lvl\t6\t\t\tlight\t\t4\t4\tgethit-skill\t56\t2\t0\tdmg-fire\t\t24\t48\tfireskill\t\t2\t2\tregen\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Crescent Moon\t271\t100\t1\t\t\t5\t\t58\t50\tamu\tAmulet\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tmanasteal\t\t11\t15\tred-mag\t\t10\t10\tdmg-to-mana\t\t10\t10\tlight\t\t-2\t-2\tmana\t\t45\t45\tlifesteal\t\t3\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Mara's Kaleidoscope\t272\t100\t1\t\t\t5\t\t80\t67\tamu\tAmulet\t\t5\t5000\toran\toran\t\t\t\t\t\tallskills\t\t2\t2\tres-all\t\t20\t30\tstr\t\t5\t5\tdex\t\t5\t5\tvit\t\t5\t5\tenr\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Atma's Scarab\t273\t100\t1\t\t\t5\t\t60\t60\tamu\tAmulet\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tdmg-pois\t100\t102\t102\tres-pois\t\t75\t75\tlight\t\t3\t3\tthorns\t\t5\t5\thit-skill\t66\t5\t2\tatt%\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Dwarf Star\t274\t100\t1\t\t\t10\t\t53\t45\trin\tRing\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tgold%\t\t100\t100\tstam\t\t40\t40\tregen-stam\t\t15\t15\thp\t\t40\t40\tred-mag\t\t12\t15\tabs-fire%\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Raven Frost\t275\t100\t1\t\t\t10\t\t53\t45\trin\tRing\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tnofreeze\t\t1\t1\tdmg-cold\t100\t15\t45\tabs-cold%\t\t20\t20\tmana\t\t40\t40\tdex\t\t15\t20\tatt\t\t150\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Highlord's Wrath\t276\t100\t1\t\t\t5\t\t73\t65\tamu\tAmulet\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tres-ltng\t\t35\t35\tdmg-ltng\t\t1\t30\tswing2\t\t20\t20\tallskills\t\t1\t1\tdeadly/lvl\t3\t\t\tlight-thorns\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Saracen's Chance\t277\t100\t1\t\t\t5\t\t55\t47\tamu\tAmulet\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\tres-all\t\t15\t25\tgethit-skill\t76\t10\t2\tstr\t\t12\t12\tdex\t\t12\t12\tenr\t\t12\t12\tvit\t\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Class Specific\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Arreat's Face\t279\t100\t1\t\t\t1\t\t50\t42\tbaa\tSlayer Guard\t\t5\t5000\t\t\t\t\t\t\t\tbar\t\t2\t2\tskilltab\t12\t2\t2\tac%\t\t150\t200\tbalance2\t\t30\t30\tatt%\t\t20\t20\tstr\t\t20\t20\tdex\t\t20\t20\tlifesteal\t\t3\t6\tres-all\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Homunculus\t280\t100\t1\t\t\t1\t\t50\t42\tnea\tHeirophant Trophy\t\t5\t5000\t\t\t\t\t\t\t\tnec\t\t2\t2\tskilltab\t6\t2\t2\tac%\t\t150\t200\tblock2\t\t30\t30\tblock\t\t40\t40\tenr\t\t20\t20\tregen-mana\t\t33\t33\tmana-kill\t\t5\t5\tres-all\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Titan's Revenge\t281\t100\t1\t\t\t1\t\t50\t42\tama\tCeremonial Javelin\t\t5\t5000\t\t\t\t\t\t\t\tama\t\t2\t2\tskilltab\t2\t2\t2\tdmg%\t\t150\t200\tmove2\t\t30\t30\trep-quant\t30\t\t\tstr\t\t20\t20\tdex\t\t20\t20\tlifesteal\t\t5\t9\tdmg-norm\t\t25\t50\tstack\t\t60\t60\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lycander's Aim\t282\t100\t1\t\t\t1\t\t50\t42\tam7\tCeremonial Bow\t\t5\t5000\t\t\t\t\t\t\t\tama\t\t2\t2\tskilltab\t0\t2\t2\tdmg%\t\t150\t200\tswing2\t\t20\t20\tac%\t\t20\t20\tdex\t\t20\t20\tenr\t\t20\t20\tmanasteal\t\t5\t8\tdmg-norm\t\t25\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lycander's Flank\t283\t100\t1\t\t\t1\t\t50\t42\tam9\tCeremonial Pike\t\t5\t5000\t\t\t\t\t\t\t\tama\t\t2\t2\tskilltab\t2\t2\t2\tdmg%\t\t150\t200\tswing2\t\t30\t30\tac%\t\t20\t20\tstr\t\t20\t20\tvit\t\t20\t20\tlifesteal\t\t5\t9\tdmg-norm\t\t25\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Oculus\t284\t100\t1\t\t\t1\t\t50\t42\toba\tSwirling Crystal\t\t5\t5000\t\t\t\t\t\t\t\tsor\t\t3\t3\tgethit-skill\t54\t25\t1\tres-all\t\t20\t20\tcast2\t\t30\t30\tac%\t\t20\t20\tvit\t\t20\t20\tenr\t\t20\t20\tmana-kill\t\t5\t5\tmag%\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Herald of Zakarum\t285\t100\t1\t\t\t1\t\t50\t42\tpa9\tAerin Shield\t\t5\t5000\t\t\t\t\t\t\t\tpal\t\t2\t2\tskilltab\t9\t2\t2\tac%\t\t150\t200\tblock2\t\t30\t30\tblock\t\t30\t30\tstr\t\t20\t20\tvit\t\t20\t20\tatt%\t\t20\t20\tres-all\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Cutthroat1\t286\t100\t1\t\t\t1\t\t50\t42\t9tw\tRunic Talons\t\t5\t5000\t\t\t\t\t\t\t\tass\t\t2\t2\tskilltab\t20\t1\t1\tdmg%\t\t150\t200\tbalance2\t\t30\t30\tatt%\t\t20\t20\tstr\t\t20\t20\tdex\t\t20\t20\tlifesteal\t\t5\t9\tdmg-norm\t\t25\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Jalal's Mane\t287\t100\t1\t\t\t1\t\t50\t42\tdra\tDream Spirit\t\t5\t5000\t\t\t\t\t\t\t\tdru\t\t2\t2\tskilltab\t16\t2\t2\tac%\t\t150\t200\tbalance2\t\t30\t30\tatt%\t\t20\t20\tstr\t\t20\t20\tenr\t\t20\t20\tmana-kill\t\t5\t5\tres-all\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Scalper\t288\t100\t1\t\t\t1\t\t65\t57\t9ta\tFrancisca\t\t5\t5000\t\t\t\t\t\t\t\trep-quant\t30\t\t\tdmg%\t\t150\t200\tatt%\t\t25\t25\tswing2\t\t20\t20\topenwounds\t\t33\t33\tlifesteal\t\t4\t6\tmana-kill\t\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bloodmoon\t289\t100\t1\t\t\t1\t\t69\t61\t7sb\telegant blade\t\t5\t5000\tcred\tcred\t\tinvsbru\t\t\t\tdmg%\t\t210\t260\tlifesteal\t\t10\t15\tcharged\tBloodGolem\t9\t15\theal-kill\t\t7\t13\topenwounds\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Djinnslayer\t290\t100\t1\t\t\t1\t\t73\t65\t7sm\tataghan\t\t5\t5000\tdpur\tdpur\t\tinvscmu\t\t\t\tdmg%\t\t190\t240\tdmg-fire\t\t250\t500\tdmg-demon\t\t100\t150\tatt-demon\t\t200\t300\tabs-ltng\t\t3\t7\tmanasteal\t\t3\t6\tsock\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Deathbit\t291\t100\t1\t\t\t1\t\t52\t44\t9tk\tbattle dart\t\t5\t5000\t\t\t\t\t\t\t\tdeadly\t\t40\t40\tdmg%\t\t130\t180\tatt\t\t200\t450\tlifesteal\t\t7\t9\tmanasteal\t\t4\t6\trep-quant\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Warshrike\t292\t100\t1\t\t\t1\t\t83\t75\t7bk\twinged knife\t\t5\t5000\tbwht\tbwht\t\tinvtk3\t\t\t\tdmg%\t\t200\t250\tpierce\t\t50\t50\tswing2\t\t30\t30\tdeadly\t\t50\t50\trep-quant\t30\t\t\thit-skill\tNova\t25\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gutsiphon\t293\t100\t1\t\t\t1\t\t79\t71\t6rx\tdemon crossbow\t\t5\t5000\tlgrn\tlgrn\t\tinvrxbu\t\t\t\tdmg%\t\t160\t220\tpierce\t\t33\t33\tlifesteal\t\t12\t18\tslow\t\t25\t25\topenwounds\t\t33\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Razoredge\t294\t100\t1\t\t\t1\t\t75\t67\t7ha\ttomahawk\t\t5\t5000\tlblu\t\t\tinvhaxu\t\t\t\tdmg%\t\t175\t225\tswing2\t\t40\t40\treduce-ac\t\t33\t33\tdeadly\t\t50\t50\topenwounds\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gore Ripper\t295\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\tdred\tdred\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Demonlimb\t296\t100\t1\t\t\t1\t\t71\t63\t7sp\ttyrant club\t\t5\t5000\tdgrn\tdgrn\t\tinvspcu\t\t\t\tdmg%\t\t180\t230\tdmg-fire\t\t222\t333\tlifesteal\t\t7\t13\tcharged\tEnchant\t20\t23\trep-dur\t5\t\t\tdmg-demon\t\t123\t123\tres-fire\t\t15\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Steelshade\t297\t100\t1\t\t\t1\t\t70\t62\tulm\tarmet\t\t5\t5000\tblac\tblac\t\tinvhlmu\t\t\t\tac%\t\t100\t130\tabs-fire\t\t5\t11\tmanasteal\t\t4\t8\tregen\t\t10\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Tomb Reaver\t298\t100\t1\t\t\t1\t\t86\t84\t7pa\tcryptic axe\t\t5\t5000\tlyel\tlyel\t\t\t\t\t\tswing2\t\t60\t60\tlight\t\t4\t4\tdmg%\t\t200\t280\tdmg-undead\t\t150\t230\tmag%\t\t50\t80\tres-all\t\t30\t50\tatt-undead\t\t250\t350\treanimate\t1\t10\t10\theal-kill\t\t10\t14\tsock\t\t1\t3\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Deaths's Web\t299\t100\t1\t\t\t1\t\t74\t66\t7gw\tunearthed wand\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tallskills\t\t2\t2\tpierce-pois\t\t40\t50\theal-kill\t\t7\t12\tmana-kill\t\t7\t12\tskilltab\t7\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Nature's Peace\t300\t100\t1\t\t\t3\t\t77\t69\trin\tring\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tnoheal\t\t1\t1\trip\t\t1\t1\tred-dmg\t\t7\t11\tres-pois\t\t20\t30\tcharged\tOak Sage\t27\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Azurewrath\t301\t100\t1\t\t\t1\t\t87\t85\t7cr\tphase blade\t\t5\t5000\tlgry\t\t\tinvcrs\t\t\t\tdmg-mag\t\t250\t500\tdmg%\t\t230\t270\taura\tSanctuary\t10\t13\tdmg-cold\t250\t250\t500\tswing2\t\t30\t30\tall-stats\t\t5\t10\tlight\t\t3\t3\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Seraph's Hymn\t302\t100\t1\t\t\t3\t\t73\t65\tamu\tamulet\t\t5\t5000\tbwht\tbwht\t\tinvamu2\t\t\t\tallskills\t\t2\t2\tskilltab\t11\t1\t2\tdmg-demon\t\t25\t50\tdmg-undead\t\t25\t50\tatt-demon\t\t150\t250\tatt-undead\t\t150\t250\tlight\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Zakarum's Salvation\t303\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Fleshripper\t304\t100\t1\t\t\t1\t\t76\t68\t7kr\tfanged knife\t\t5\t5000\tdred\tdred\t\tinvkrsu\t\t\t\tdmg%\t\t200\t300\treduce-ac\t\t50\t50\tnoheal\t\t1\t1\tcrush\t\t25\t25\topenwounds\t\t50\t50\tdeadly\t\t33\t33\tslow\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Odium\t305\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\tblac\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Horizon's Tornado\t306\t100\t1\t\t\t5\t\t72\t64\t7fl\tscourge\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\tdmg%\t\t230\t280\tswing2\t\t50\t50\tslow\t\t20\t20\thit-skill\tTornado\t20\t15\tease\t\t-20\t-20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stone Crusher\t307\t100\t1\t\t\t4\t\t76\t68\t7wh\tlegendary mallet\t\t5\t5000\twhit\t\t\t\t\t\t\tdmg%\t\t280\t320\tstr\t\t20\t30\tcrush\t\t40\t40\treduce-ac\t\t25\t25\tdmg-ac\t\t-100\t-100\tdmg\t\t10\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Jadetalon\t308\t100\t1\t\t\t1\t\t74\t66\t7wb\twrist sword\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tdmg%\t\t190\t240\tmanasteal\t\t10\t15\tres-all\t\t40\t50\tbalance2\t\t30\t30\tskilltab\t19\t1\t2\tskilltab\t20\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Shadowdancer\t309\t100\t1\t\t\t1\t\t79\t71\tuhb\tmyrmidon greaves\t\t5\t5000\tblac\tblac\t\t\t\t\t\tac%\t\t70\t100\tmove2\t\t30\t30\tbalance2\t\t30\t30\tdex\t\t15\t25\tskilltab\t19\t1\t2\tease\t\t-20\t-20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Cerebus\t310\t100\t1\t\t\t1\t\t71\t63\tdrb\tblood spirit\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tac%\t\t130\t140\tskilltab\t16\t2\t4\tlifesteal\t\t7\t10\tatt%\t\t60\t120\topenwounds\t\t33\t33\tskill\tferal rage\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Tyrael's Might\t311\t100\t1\t\t\t1\t\t87\t84\tuar\tsacred armor\t\t5\t5000\tdblu\tdblu\t\tinvaaru\t\t\t\tease\t\t-100\t-100\tindestruct\t\t1\t1\tac%\t\t120\t150\trip\t\t1\t1\tdmg-demon\t\t50\t100\tnofreeze\t\t1\t1\tmove2\t\t20\t20\tres-all\t\t20\t30\tstr\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Souldrain\t312\t100\t1\t\t\t1\t\t82\t74\tumg\tvambraces\t\t5\t5000\tdred\tdred\t\t\t\t\t\tac%\t\t90\t120\tmanasteal\t\t4\t7\tlifesteal\t\t4\t7\thit-skill\tWeaken\t8\t3\tdmg-ac\t\t-50\t-50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Runemaster\t313\t100\t1\t\t\t1\t\t80\t72\t72a\tettin axe\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tdmg%\t\t220\t270\tsock\t\t3\t5\tres-cold-max\t\t5\t5\tnofreeze\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Deathcleaver\t314\t100\t1\t\t\t1\t\t78\t70\t7wa\tberserker axe\t\t5\t5000\tdred\t\t\t\t\t\t\tdmg%\t\t230\t280\tdeadly\t\t66\t66\treduce-ac\t\t33\t33\tswing2\t\t40\t40\theal-kill\t\t6\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Executioner's Justice\t315\t100\t1\t\t\t1\t\t83\t75\t7gi\tglorious axe\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdmg%\t\t240\t290\tcrush\t\t25\t25\treduce-ac\t\t33\t33\tkill-skill\tDecrepify\t50\t6\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stoneraven\t316\t100\t1\t\t\t1\t\t72\t64\tamd\tmatriarchal spear\t\t5\t5000\tdgry\t\t\t\t\t\t\tdmg%\t\t230\t280\tdmg-mag\t\t101\t187\tres-all\t\t30\t50\tac\t\t400\t600\tskilltab\t2\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Leviathan\t317\t100\t1\t\t\t1\t\t73\t65\tuld\tkraken shell\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tac%\t\t170\t200\tac\t\t100\t150\tred-dmg%\t\t15\t25\tstr\t\t40\t50\tindestruct\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Larzuk's Champion\t318\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\tlgry\t\tflphmr\tinvhfh\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Wisp\t319\t100\t1\t\t\t1\t\t84\t76\trin\tring\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tabs-ltng%\t\t10\t20\thit-skill\tLightning\t10\t16\tmag%\t\t10\t20\tcharged\tOak Sage\t15\t2\tcharged\tHeart of Wolverine\t13\t5\tcharged\tSpirit of Barbs\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gargoyle's Bite\t320\t100\t1\t\t\t1\t\t78\t70\t7ts\twinged harpoon\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tdmg%\t\t180\t230\trep-quant\t30\t\t\tdmg-pois\t250\t300\t300\tlifesteal\t\t9\t15\tcharged\tPlague Javelin\t60\t11\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Lacerator\t321\t100\t1\t\t\t1\t\t76\t68\t7b8\twinged axe\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdmg%\t\t150\t210\trep-quant\t25\t\t\tswing2\t\t30\t30\tnoheal\t\t1\t1\topenwounds\t\t33\t33\thowl\t\t64\t64\thit-skill\tAmplify Damage\t33\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Mang Song's Lesson\t322\t100\t1\t\t\t1\t\t86\t82\t6ws\tarchon staff\t\t5\t5000\tdgld\tdgld\t\tinv8wsu\t\t\t\tallskills\t\t5\t5\tpierce-fire\t\t7\t15\tpierce-ltng\t\t7\t15\tpierce-cold\t\t7\t15\tregen-mana\t\t10\t10\tcast2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Viperfork\t323\t100\t1\t\t\t1\t\t79\t71\t7br\twar fork\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tdmg%\t\t190\t240\tdmg-pois\t250\t333\t333\tswing2\t\t50\t50\tatt\t\t200\t250\thit-skill\tPoison Explosion\t15\t9\tres-pois\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ethereal Edge\t324\t100\t1\t\t\t1\t\t82\t74\t7ba\tsilver-edged axe\t\t5\t5000\twhit\twhit\t\t\t\t\t\tdmg%\t\t150\t180\tswing2\t\t25\t25\tabs-fire\t\t10\t12\tdmg-demon\t\t150\t200\tdemon-heal\t\t5\t10\tatt\t\t270\t350\tethereal\t\t1\t1\tindestruct\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Demonhorn's Edge\t325\t100\t1\t\t\t1\t\t69\t61\tbad\tdestroyer helm\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tac%\t\t120\t160\tswing2\t\t10\t10\tlifesteal\t\t3\t6\tthorns\t\t55\t77\tskilltab\t12\t1\t3\tskilltab\t13\t1\t3\tskilltab\t14\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Reaper's Toll\t326\t100\t1\t\t\t1\t\t83\t75\t7s8\tthresher\t\t5\t5000\t\t\t\tinvscy\t\t\t\tdmg%\t\t190\t240\thit-skill\tDecrepify\t33\t1\tignore-ac\t\t1\t1\tlifesteal\t\t11\t15\tease\t\t-25\t-25\tdeadly\t\t33\t33\tdmg-cold\t\t4\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Spiritkeeper\t327\t100\t1\t\t\t1\t\t75\t67\tdrd\tearth spirit\t\t5\t5000\t\t\t\t\t\t\t\tac%\t\t170\t190\tbalance2\t\t20\t20\tabs-ltng\t\t9\t14\tres-fire\t\t30\t40\tabs-cold%\t\t15\t25\tres-pois-max\t\t10\t10\tdru\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hellrack\t328\t100\t1\t\t\t1\t\t84\t76\t6hx\tcolossus crossbow\t\t5\t5000\tcred\t\t\tinvhxbu\t\t\t\tdmg%\t\t180\t230\tdmg-elem\t33\t63\t324\tswing2\t\t20\t20\tatt%\t\t100\t150\tsock\t\t2\t2\tcharged\tImmolation Arrow\t150\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Alma Negra\t329\t100\t1\t\t\t1\t\t85\t77\tpac\tsacred rondache\t\t5\t5000\tblac\tblac\t\t\t\t\t\tac%\t\t180\t210\tblock2\t\t30\t30\tpal\t\t1\t2\tblock\t\t20\t20\tred-mag\t\t5\t9\tatt%\t\t40\t75\tdmg%\t\t40\t75\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Darkforge Spawn\t330\t100\t1\t\t\t1\t\t72\t64\tnef\tbloodlord skull\t\t5\t5000\tcred\tcred\t\t\t\t\t\tac%\t\t140\t180\tcast2\t\t30\t30\tmana%\t\t10\t10\tskilltab\t6\t1\t3\tskilltab\t7\t1\t3\tskilltab\t8\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Widowmaker\t331\t100\t1\t\t\t1\t\t73\t65\t6sw\tward bow\t\t5\t5000\tdred\tdred\t\tinvswbu\t\t\t\tdmg%\t\t150\t200\tdeadly\t\t33\t33\tignore-ac\t\t1\t1\tmagicarrow\t\t11\t11\toskill\tGuided Arrow\t3\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bloodraven's Charge\t332\t100\t1\t\t\t1\t\t79\t71\tamb\tmatriarchal bow\t\t5\t5000\tdgld\tdgld\t\tinvswbu\t\t\t\tdmg%\t\t180\t230\tatt%\t\t200\t300\texplosivearrow\t\t13\t13\tskilltab\t0\t2\t4\tcharged\tRevive\t30\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ghostflame\t333\t100\t1\t\t\t1\t\t70\t62\t7bl\tlegend spike\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tdmg%\t\t190\t240\tignore-ac\t\t1\t1\tdmg-mag\t\t108\t108\tmanasteal\t\t10\t15\tethereal\t\t1\t1\tindestruct\t\t1\t1\tlight\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Shadowkiller\t334\t100\t1\t\t\t1\t\t85\t78\t7cs\tbattle cestus\t\t5\t5000\t\t\t\tinvaxfu\t\t\t\tdmg%\t\t170\t220\treduce-ac\t\t25\t25\tfreeze\t\t2\t2\tmana-kill\t\t10\t15\thit-skill\tFrost Nova\t33\t8\tethereal\t\t1\t1\tindestruct\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gimmershred\t335\t100\t1\t\t\t1\t\t78\t70\t7ta\tflying axe\t\t5\t5000\tlgrn\t\t\t\t\t\t\tdmg%\t\t160\t210\tdmg-fire\t\t218\t483\tdmg-cold\t100\t176\t397\tdmg-ltng\t\t29\t501\tstack\t\t60\t60\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Griffon's Eye\t336\t100\t1\t\t\t1\t\t84\t76\tci3\tdiadem\t\t5\t5000\t\t\t\t\t\t\t\tac\t\t100\t200\tcast2\t\t25\t25\tallskills\t\t1\t1\textra-ltng\t\t10\t15\tpierce-ltng\t\t15\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Windhammer\t337\t100\t1\t\t\t1\t\t76\t68\t7m7\togre maul\t\t5\t5000\tcblu\tcblu\t\tinvmau\t\t\t\tdmg%\t\t180\t230\tcrush\t\t50\t50\tswing2\t\t60\t60\thit-skill\tTwister\t33\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Thunderstroke\t338\t100\t1\t\t\t1\t\t77\t69\tamf\tmatriarchal javelin\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tdmg%\t\t150\t200\tdmg-ltng\t\t1\t511\thit-skill\tLightning\t20\t14\tswing2\t\t15\t15\tpierce-ltng\t\t15\t15\tskill\tLightning Bolt\t3\t3\tskilltab\t2\t2\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Giantmaimer\t339\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\tcred\tcred\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Demon's Arch\t340\t100\t1\t\t\t1\t\t76\t68\t7s7\tbalrog spear\t\t5\t5000\tcred\tcred\t\t\t\t\t\tdmg%\t\t160\t210\tdmg-fire\t\t232\t323\tlifesteal\t\t6\t12\trep-quant\t30\t\t\tswing2\t\t30\t30\tdmg-ltng\t\t23\t333\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Boneflame\t341\t100\t1\t\t\t1\t\t80\t72\tnee\tsuccubae skull\t\t3\t5000\tdred\tdred\t\t\t\t\t\tac%\t\t120\t150\tmove2\t\t20\t20\tgethit-skill\tTerror\t15\t3\tnec\t\t2\t3\tres-all\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Steelpillar\t342\t100\t1\t\t\t1\t\t77\t69\t7p7\twar pike\t\t3\t5000\t\t\t\t\t\t\t\tdmg%\t\t210\t260\tswing2\t\t25\t25\treduce-ac\t\t20\t20\tac%\t\t50\t80\tindestruct\t\t1\t1\tcrush\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Nightwing's Veil\t343\t100\t1\t\t\t1\t\t75\t67\tuhm\tspired helm\t\t3\t5000\tcblu\tcblu\t\t\t\t\t\tac%\t\t90\t120\tallskills\t\t2\t2\tdex\t\t10\t20\tabs-cold\t\t5\t9\thalf-freeze\t\t1\t1\textra-cold\t\t8\t15\tease\t\t-50\t-50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Crown of Ages\t344\t100\t1\t\t\t1\t\t86\t82\turn\tcorona\t\t3\t5000\tdgld\tdgld\t\t\t\t\t\tbalance2\t\t30\t30\tres-all\t\t20\t30\tallskills\t\t1\t1\tac\t\t100\t150\tindestruct\t\t1\t1\tred-dmg%\t\t10\t15\tac%\t\t50\t50\tsock\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Andariel's Visage\t345\t100\t1\t\t\t1\t\t85\t83\tusk\tdemonhead\t\t3\t5000\tdred\tdred\t\t\t\t\t\tac%\t\t100\t150\tres-pois\t\t70\t70\tallskills\t\t2\t2\tres-pois-max\t\t10\t10\tswing2\t\t20\t20\tstr\t\t25\t30\tgethit-skill\t92\t15\t15\tcharged\t278\t20\t3\tlifesteal\t\t8\t10\tres-fire\t\t-30\t-30\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Darkfear\t346\t100\t\t\t\t1\t\t\t\tulm\tarmet\t\t5\t5000\tblac\t\t\tinvhlmu\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Dragonscale\t347\t100\t1\t\t\t1\t\t84\t80\tpae\tzakarum shield\t\t3\t5000\tdgrn\tdgrn\t\t\t\t\t\tac%\t\t170\t200\tabs-fire%\t\t10\t20\tres-fire-max\t\t5\t5\tstr\t\t15\t25\tdmg-fire\t\t211\t371\toskill\tHydra\t10\t10\textra-fire\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Steel Carapice\t348\t100\t1\t\t\t1\t\t74\t66\tuul\tshadow plate\t\t3\t5000\tdgry\tdgry\t\t\t\t\t\tac%\t\t190\t220\tbalance2\t\t20\t20\tred-dmg\t\t9\t14\tres-cold\t\t40\t60\tregen-mana\t\t10\t15\trep-dur\t5\t\t\tgethit-skill\tIron Maiden\t8\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Medusa's Gaze\t349\t100\t1\t\t\t1\t\t84\t76\tuow\taegis\t\t3\t5000\tlred\tlred\t\tinvtowu\t\t\t\tac%\t\t150\t180\tslow\t\t20\t20\tgethit-skill\tLower Resist\t10\t7\tlifesteal\t\t5\t9\tdeath-skill\tNova\t100\t44\tres-cold\t\t40\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ravenlore\t350\t100\t1\t\t\t1\t\t82\t74\tdre\tsky spirit\t\t3\t5000\tdgld\tdgld\t\t\t\t\t\tac%\t\t120\t150\tres-all\t\t15\t25\tskilltab\t17\t3\t3\tenr\t\t20\t30\tpierce-fire\t\t10\t20\tskill\tRaven\t7\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Boneshade\t351\t100\t1\t\t\t1\t\t84\t79\t7bw\tlich wand\t\t3\t5000\tdgry\tdgry\t\tinvbwnu\t\t\t\tnec\t\t2\t2\tcast2\t\t25\t25\tskill\tTeeth\t4\t5\tskill\tBone Armor\t4\t5\tskill\tBone Spear\t2\t3\tskill\tBone Spirit\t1\t2\tskill\tBone Wall\t2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Nethercrow\t352\t100\t\t\t\t1\t\t\t\t\t\t\t3\t5000\tcblu\tcblu\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Flamebellow\t353\t100\t1\t\t\t1\t\t79\t71\t7gs\tbalrog blade\t\t3\t5000\tcred\tcred\t\tinvgisu\t\t\t\tdmg%\t\t170\t240\tdmg-fire\t\t233\t482\tfireskill\t\t3\t3\tabs-fire%\t\t20\t30\thit-skill\tFirestorm\t12\t16\tstr\t\t10\t20\tvit\t\t5\t10\toskill\tInferno\t12\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Fathom\t354\t100\t1\t\t\t1\t\t81\t73\tobf\tdimensional shard\t\t3\t5000\tlblu\t\t\t\t\t\t\tsor\t\t3\t3\textra-cold\t\t15\t30\tcast2\t\t20\t20\tres-fire\t\t25\t40\tres-ltng\t\t25\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Wolfhowl\t355\t100\t1\t\t\t1\t\t85\t79\tbac\tfury visor\t\t3\t5000\tcred\tcred\t\t\t\t\t\tac%\t\t120\t150\tskilltab\t14\t2\t3\tstr\t\t8\t15\tdex\t\t8\t15\tvit\t\t8\t15\toskill\tWearwolf\t3\t6\tcharged\tSummon Fenris\t18\t15\toskill\tShape Shifting\t3\t6\toskill\tFeral Rage\t3\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Spirit Ward\t356\t100\t1\t\t\t1\t\t76\t68\tuts\tward\t\t3\t5000\tdblu\tdblu\t\tinvgtsu\t\t\t\tac%\t\t130\t180\tabs-cold\t\t6\t11\tres-all\t\t30\t40\tblock\t\t20\t30\tblock2\t\t25\t25\tgethit-skill\tFade\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Kira's Guardian\t357\t100\t1\t\t\t1\t\t85\t77\tci2\ttiara\t\t3\t5000\tblac\tblac\t\t\t\t\t\tac\t\t50\t120\tres-all\t\t50\t70\tnofreeze\t\t1\t1\tbalance2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ormus' Robes\t358\t100\t1\t\t\t1\t\t83\t75\tuui\tdusk shroud\t\t3\t5000\tblac\tblac\t\t\t\t\t\tac\t\t10\t20\tcast2\t\t20\t20\textra-fire\t\t10\t15\textra-cold\t\t10\t15\textra-ltng\t\t10\t15\tregen-mana\t\t10\t15\tskill-rand\t3\t36\t60\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Gheed's Fortune\t359\t100\t1\t\t\t1\t\t70\t62\tcm3\tcharm\t1\t3\t5000\tlgld\t\t\t\t\t\t\tmag%\t\t20\t40\tgold%\t\t80\t160\tcheap\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Stormlash\t360\t100\t1\t\t\t1\t\t86\t82\t7fl\tscourge\t\t3\t5000\tdgry\tdgry\t\t\t\t\t\tdmg%\t\t240\t300\tswing2\t\t30\t30\thit-skill\tStatic Field\t15\t10\thit-skill\tTornado\t20\t18\tdmg-ltng\t\t1\t473\tlight-thorns\t\t30\t30\tcrush\t\t33\t33\tabs-ltng\t\t3\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Halaberd's Reign\t361\t100\t1\t\t\t1\t\t85\t77\tbae\tconqueror crown\t\t3\t5000\t\t\t\t\t\t\t\tac%\t\t140\t170\tskilltab\t13\t1\t1\tbar\t\t2\t2\tbalance2\t\t20\t20\tregen\t\t15\t23\tskill\tBattle Orders\t1\t2\tskill\tBattle Command\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Warriv's Warder\t362\t100\t\t\t\t1\t\t\t\t\t\t\t3\t5000\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Spike Thorn\t363\t100\t1\t\t\t1\t\t78\t70\tupk\tblade barrier\t\t5\t5000\tdyel\tdyel\t\tinvspku\t\t\t\tac%\t\t120\t150\tthorns/lvl\t11\t\t\tdur\t\t250\t250\tbalance2\t\t30\t30\tred-dmg%\t\t15\t20\tsock\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Dracul's Grasp\t364\t100\t1\t\t\t1\t\t84\t76\tuvg\tvampirebone gloves\t\t5\t5000\tdred\tdred\t\t\t\t\t\tac%\t\t90\t120\tlifesteal\t\t7\t10\topenwounds\t\t25\t25\thit-skill\tLife Tap\t5\t10\theal-kill\t\t5\t10\tstr\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Frostwind\t365\t100\t1\t\t\t1\t\t78\t70\t7ls\tcryptic sword\t\t5\t5000\tcblu\tcblu\t\tinvlsdu\t\t\t\tdmg%\t\t180\t230\tfreeze\t\t4\t4\thalf-freeze\t\t1\t1\tdmg-cold\t150\t237\t486\tswing2\t\t25\t25\tabs-cold%\t\t7\t15\toskill\tArctic Blast\t7\t14\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Templar's Might\t366\t100\t1\t\t\t8\t\t82\t74\tuar\tsacred armor\t\t5\t5000\tcgrn\tcgrn\t\tinvaaru\t\t\t\tac%\t\t170\t220\tbalance2\t\t20\t20\tac-miss\t\t250\t300\tstam\t\t40\t50\tstr\t\t10\t15\tvit\t\t10\t15\tskilltab\t10\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Eschuta's temper\t367\t100\t1\t\t\t1\t\t80\t72\tobc\teldritch orb\t\t5\t5000\tcred\t\t\t\t\t\t\tsor\t\t1\t3\tcast2\t\t40\t40\textra-fire\t\t10\t20\textra-ltng\t\t10\t20\tenr\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Firelizard's Talons\t368\t100\t1\t\t\t1\t\t75\t67\t7lw\tferal claws\t\t5\t5000\t\t\t\t\t\t\t\tdmg%\t\t200\t270\tswing2\t\t15\t15\tskilltab\t20\t1\t3\tdmg-fire\t\t236\t480\tres-fire\t\t40\t70\tskill\tWake of Fire Sentry\t1\t2\tskill\tInferno Sentry\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Sandstorm Trek\t369\t100\t1\t\t\t1\t\t72\t64\tuvb\tscarabshell boots\t\t5\t5000\t\t\t\t\t\t\t\tac%\t\t140\t170\tmove2\t\t20\t20\tbalance2\t\t20\t20\tstam/lvl\t8\t\t\tstamdrain\t\t50\t50\tres-pois\t\t40\t70\trep-dur\t5\t\t\tstr\t\t10\t15\tvit\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Marrowwalk\t370\t100\t1\t\t\t1\t\t74\t66\tumb\tboneweave boots\t\t5\t5000\tdgry\t\t\t\t\t\t\tac%\t\t170\t200\tmove2\t\t20\t20\tcharged\tBone Prison\t13\t33\tcharged\tLife Tap\t10\t12\tregen-stam\t\t10\t10\tregen-mana\t\t10\t10\thalf-freeze\t\t1\t1\tstr\t\t10\t20\tdex\t\t17\t17\tskill\tSkeleton Mastery\t1\t2\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Heaven's Light\t371\t100\t1\t\t\t1\t\t69\t61\t7sc\tmighty scepter\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tdmg%\t\t250\t300\tswing2\t\t20\t20\treduce-ac\t\t33\t33\tlight\t\t3\t3\tdemon-heal\t\t15\t20\tcrush\t\t33\t33\tsock\t\t1\t3\tpal\t\t2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Merman's Speed\t372\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Arachnid Mesh\t373\t100\t1\t\t\t1\t\t87\t80\tulc\tspiderweb sash\t\t5\t5000\tblac\tblac\t\t\t\t\t\tac%\t\t90\t120\tcast2\t\t20\t20\tcharged\tVenom\t11\t3\tallskills\t\t1\t1\tslow\t\t10\t10\tmana%\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Nosferatu's Coil\t374\t100\t1\t\t\t1\t\t68\t51\tuvc\tvampirefang belt\t\t5\t5000\t\t\t\t\t\t\t\tstr\t\t15\t15\tmana-kill\t\t2\t2\tslow\t\t10\t10\tlifesteal\t\t5\t7\tswing2\t\t10\t10\tlight\t\t-3\t-3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Metalgrid\t375\t100\t1\t\t\t2\t\t85\t81\tamu\tamulet\t\t5\t5000\t\t\t\t\t\t\t\tac\t\t300\t350\tres-all\t\t25\t35\tatt\t\t400\t450\tcharged\tIronGolem\t11\t22\tcharged\tIron Maiden\t20\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Verdugo's Hearty Cord\t376\t100\t1\t\t\t1\t\t71\t63\tumc\tmithril coil\t\t5\t5000\tblac\tblac\t\t\t\t\t\tac%\t\t90\t140\tvit\t\t30\t40\tstam\t\t100\t120\tbalance2\t\t10\t10\tred-dmg%\t\t10\t15\tregen\t\t10\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Sigurd's Staunch\t377\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Carrion Wind\t378\t100\t1\t\t\t3\t\t68\t60\trin\tring\t\t3\t5000\t\t\t\t\t\t\t\tac-miss\t\t100\t160\tlifesteal\t\t6\t9\tres-pois\t\t55\t55\tgethit-skill\tPoison Nova\t10\t10\tcharged\tPlague Poppy\t15\t21\thit-skill\tTwister\t8\t13\tdmg-to-mana\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Giantskull\t379\t100\t1\t\t\t1\t\t73\t65\tuh9\tbone visage\t\t3\t5000\tlgry\tlgry\t\tinvbhm\t\t\t\tac\t\t250\t320\tstr\t\t25\t35\tcrush\t\t10\t10\tsock\t\t1\t2\tknock\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ironward\t380\t100\t1\t\t\t1\t\t68\t60\t7ws\tcaduceus\t\t3\t5000\tblac\tblac\t\t\t\t\t\tdmg%\t\t240\t290\tslow\t\t25\t25\tatt%\t\t150\t200\tswing2\t\t10\t10\tdmg-mag\t\t80\t240\tred-dmg\t\t4\t7\tdmg\t\t40\t85\tskilltab\t9\t2\t4\tcrush\t\t33\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Annihilus\t381\t100\t1\t\t\t1\t\t110\t70\tcm1\tcharm\t1\t3\t5000\t\t\tflpmss\tinvmss\titem_gem\t12\titem_gem\tallskills\t\t1\t1\tall-stats\t\t10\t20\tres-all\t\t10\t20\taddxp\t\t5\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Arioc's Needle\t382\t100\t1\t\t\t1\t\t85\t81\t7sr\thyperion spear\t\t3\t5000\t\t\t\t\t\t\t\tdmg%\t\t180\t230\tdmg-pois\t250\t403\t403\tdeadly\t\t50\t50\tignore-ac\t\t1\t1\tallskills\t\t2\t4\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Cranebeak\t383\t100\t1\t\t\t1\t\t71\t63\t7mp\twar spike\t\t3\t5000\tdgry\t\t\tinvmpiu\t\t\t\tdmg%\t\t240\t300\tdmg-ltng\t\t1\t305\tswing2\t\t40\t40\treduce-ac\t\t25\t25\tmag%\t\t20\t50\tcharged\tRaven\t15\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Nord's Tenderizer\t384\t100\t1\t\t\t1\t\t76\t68\t7cl\ttruncheon\t\t3\t5000\t\t\t\tinvclbu\t\t\t\tdmg%\t\t270\t330\tfreeze\t\t2\t4\tswing2\t\t25\t25\tcharged\tBlizzard\t12\t16\tatt%\t\t150\t180\tabs-cold%\t\t5\t15\tdmg-cold\t125\t205\t455\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Earthshifter\t385\t100\t1\t\t\t1\t\t77\t69\t7gm\tthunder maul\t\t3\t5000\t\t\t\t\t\t\t\tdmg%\t\t250\t300\thit-skill\tEruption\t25\t14\tcrush\t\t33\t33\tswing2\t\t10\t10\tcharged\tVolcano\t30\t14\tskilltab\t17\t7\t7\tcast2\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Wraithflight\t386\t100\t1\t\t\t1\t\t84\t76\t7gl\tghost glaive\t\t3\t5000\tdblu\tdblu\t\t\t\t\t\tdmg%\t\t150\t190\trep-quant\t40\t\t\tlifesteal\t\t9\t13\tmana-kill\t\t15\t15\tethereal\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bonehew\t387\t100\t1\t\t\t1\t\t72\t64\t7o7\togre axe\t\t3\t5000\tbwht\tbwht\t\t\t\t\t\tdmg%\t\t270\t320\tswing2\t\t30\t30\tcharged\tCorpse Explosion\t30\t14\thit-skill\tBone Spear\t50\t16\tnoheal\t\t1\t1\tsock\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Ondal's Wisdom\t388\t100\t1\t\t\t1\t\t74\t66\t6cs\telder staff\t\t3\t5000\t\t\t\tinvcstu\t\t\t\tcast2\t\t45\t45\tenr\t\t40\t50\tallskills\t\t2\t4\tac\t\t450\t550\taddxp\t\t5\t5\tred-mag\t\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"The Reedeemer\t389\t100\t1\t\t\t1\t\t80\t72\t7sc\tmighty scepter\t\t3\t5000\t\t\t\t\t\t\t\tdmg%\t\t250\t300\tdmg-demon\t\t200\t250\tpal\t\t2\t2\tease\t\t-60\t-60\tskill\tRedemption\t2\t4\tskill\tHoly Bolt\t2\t4\tlight\t\t3\t3\treduce-ac\t\t33\t33\tdmg\t\t60\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Headhunter's Glory\t390\t100\t1\t\t\t1\t\t83\t75\tush\ttroll nest\t\t3\t5000\t\t\t\tinvbshu\t\t\t\tac\t\t320\t420\tac-miss\t\t300\t350\tres-pois\t\t30\t40\tsock\t\t1\t3\tres-fire\t\t20\t30\theal-kill\t\t5\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Steelrend\t391\t100\t1\t\t\t1\t\t78\t70\tuhg\togre gauntlets\t\t3\t5000\t\t\t\t\t\t\t\tac\t\t170\t210\tstr\t\t15\t20\tdmg%\t\t30\t60\tcrush\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rainbow Facet\t392\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-ltng\t\t1\t74\tpierce-ltng\t\t3\t5\textra-ltng\t\t3\t5\tdeath-skill\tChain Lightning\t100\t47\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rainbow Facet\t393\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-cold\t3\t24\t38\tpierce-cold\t\t3\t5\textra-cold\t\t3\t5\tdeath-skill\tBlizzard\t100\t37\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rainbow Facet\t394\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-fire\t\t17\t45\tpierce-fire\t\t3\t5\textra-fire\t\t3\t5\tdeath-skill\tMeteor\t100\t31\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rainbow Facet\t395\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-pois\t50\t187\t187\tpierce-pois\t\t3\t5\textra-pois\t\t3\t5\tdeath-skill\tPoison Nova\t100\t51\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rainbow Facet\t396\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-ltng\t\t1\t74\tpierce-ltng\t\t3\t5\textra-ltng\t\t3\t5\tlevelup-skill\tNova\t100\t41\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rainbow Facet\t397\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-cold\t3\t24\t38\tpierce-cold\t\t3\t5\textra-cold\t\t3\t5\tlevelup-skill\tFrost Nova\t100\t43\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rainbow Facet\t398\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-fire\t\t17\t45\tpierce-fire\t\t3\t5\textra-fire\t\t3\t5\tlevelup-skill\tBlaze\t100\t29\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rainbow Facet\t399\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-pois\t50\t187\t187\tpierce-pois\t\t3\t5\textra-pois\t\t3\t5\tlevelup-skill\tVenom\t100\t23\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Hellfire Torch\t400\t100\t1\t\t\t1\t\t110\t75\tcm2\tcharm\t1\t3\t5000\t\t\tflptrch\tinvtrch\titem_gem\t12\titem_gem\trandclassskill\t\t0\t6\tall-stats\t\t10\t20\tres-all\t\t10\t20\tlight\t\t8\t8\thit-skill\t197\t5\t10\tcharged\tHydra\t10\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Cold Rupture\t401\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlblu\tlblu\t\t\t\t\t\tpierce-immunity-cold\t\t300\t300\tres-cold\t\t-90\t-70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Flame Rift\t402\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlred\tlred\t\t\t\t\t\tpierce-immunity-fire\t\t300\t300\tres-fire\t\t-90\t-70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Crack of the Heavens\t403\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlyel\tlyel\t\t\t\t\t\tpierce-immunity-light\t\t300\t300\tres-ltng\t\t-90\t-70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Rotting Fissure\t404\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlgrn\tlgrn\t\t\t\t\t\tpierce-immunity-poison\t\t300\t300\tres-pois\t\t-90\t-70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Bone Break\t405\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\twhit\twhit\t\t\t\t\t\tpierce-immunity-damage\t\t300\t300\tred-dmg%\t\t-20\t-10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                ss << u8"Black Cleft\t406\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlgry\tlgry\t\t\t\t\t\tpierce-immunity-magic\t\t300\t300\tres-mag\t\t-65\t-45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"index\t*ID\tversion\tenabled\tfirstLadderSeason\tlastLadderSeason\trarity\tnolimit\tlvl\tlvl req\tcode\t*ItemName\tcarry1\tcost mult\tcost add\tchrtransform\tinvtransform\tflippyfile\tinvfile\tdropsound\tdropsfxframe\tusesound\tprop1\tpar1\tmin1\tmax1\tprop2\tpar2\tmin2\tmax2\tprop3\tpar3\tmin3\tmax3\tprop4\tpar4\tmin4\tmax4\tprop5\tpar5\tmin5\tmax5\tprop6\tpar6\tmin6\tmax6\tprop7\tpar7\tmin7\tmax7\tprop8\tpar8\tmin8\tmax8\tprop9\tpar9\tmin9\tmax9\tprop10\tpar10\tmin10\tmax10\tprop11\tpar11\tmin11\tmax11\tprop12\tpar12\tmin12\tmax12\tdiablocloneweight\t*eol\n",
+                u8"The Gnasher\t0\t0\t1\t\t\t1\t\t7\t5\thax\tHand Axe\t\t5\t5000\tdyel\t\t\tinvhaxu\t\t\t\tstr\t\t8\t8\topenwounds\t\t50\t50\tcrush\t\t20\t20\tdmg%\t\t60\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Deathspade\t1\t0\t1\t\t\t1\t\t12\t9\taxe\tAxe\t\t5\t5000\tdgld\t\t\tinvaxeu\t\t\t\tstupidity\t\t1\t1\tdmg-min\t\t8\t8\tatt%\t\t15\t15\tmana-kill\t\t4\t4\tdmg%\t\t60\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bladebone\t2\t0\t1\t\t\t1\t\t20\t15\t2ax\tDouble Axe\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tdmg-undead\t\t100\t100\tatt-undead\t\t40\t40\tswing2\t\t20\t20\tac\t\t20\t20\tfire-min\t\t8\t8\tfire-max\t\t12\t12\tdmg%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Mindrend\t3\t0\t1\t\t\t1\t\t28\t21\tmpi\tMilitary Pick\t\t5\t5000\tlgrn\t\t\tinvmpiu\t\t\t\tstupidity\t\t2\t2\tregen-mana\t\t20\t20\tltng-min\t\t1\t1\tltng-max\t\t12\t15\tatt\t\t50\t100\tdmg%\t\t60\t100\topenwounds\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rakescar\t4\t0\t1\t\t\t1\t\t36\t27\twax\tWar Axe\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tpois-min\t\t128\t128\tpois-max\t\t128\t128\tpois-len\t\t75\t75\tatt\t\t50\t50\tres-pois\t\t50\t50\tdmg%\t\t75\t150\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Fechmars Axe\t5\t0\t1\t\t\t1\t\t11\t8\tlax\tLarge Axe\t\t5\t5000\tlpur\tlpur\t\t\t\t\t\tdmg%\t\t70\t90\tfreeze\t\t3\t3\tres-cold\t\t50\t50\tlight\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Goreshovel\t6\t0\t1\t\t\t1\t\t19\t14\tbax\tBroad Axe\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\tswing3\t\t30\t30\tstr\t\t25\t25\topenwounds\t\t60\t60\tdmg%\t\t40\t50\tdmg-max\t\t9\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Chieftan\t7\t0\t1\t\t\t1\t\t26\t19\tbtx\tBattle Axe\t\t5\t5000\toran\t\t\tinvbtxu\t\t\t\tdmg%\t\t100\t100\tres-all\t\t10\t20\tmana-kill\t\t6\t6\tswing2\t\t20\t20\tdmg-ltng\t\t1\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Brainhew\t8\t0\t1\t\t\t1\t\t34\t25\tgax\tGreat Axe\t\t5\t5000\twhit\t\t\tinvgaxu\t\t\t\tdmg-min\t\t14\t14\tmana\t\t25\t25\tlight\t\t4\t4\tmanasteal\t\t10\t13\tdmg%\t\t50\t80\tdmg-fire\t\t15\t35\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Humongous\t9\t0\t1\t\t\t1\t\t39\t29\tgix\tGiant Axe\t\t5\t5000\tblac\tblac\t\t\t\t\t\tstr\t\t20\t30\tdmg-min\t\t8\t8\tdmg-max\t\t15\t25\tcrush\t\t33\t33\tease\t\t20\t20\tdmg%\t\t80\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Iros Torch\t10\t0\t1\t\t\t1\t\t7\t5\twnd\tWand\t\t5\t5000\tcred\t\t\tinvwndu\t\t\t\tnec\t\t1\t1\tlifesteal\t\t6\t6\tdmg-fire\t\t5\t9\tlight\t\t3\t3\tenr\t\t10\t10\tregen-mana\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Maelstromwrath\t11\t0\t1\t\t\t1\t\t19\t14\tywn\tYew Wand\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tltng-min\t\t1\t1\tltng-max\t\t9\t9\tres-ltng\t\t40\t40\tmana\t\t13\t13\tcast2\t\t30\t30\tskill\t74\t1\t3\tskill\t77\t1\t3\tskill\t66\t1\t3\tskill\t76\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gravenspine\t12\t0\t1\t\t\t1\t\t27\t20\tbwn\tBone Wand\t\t5\t5000\tcgrn\t\t\tinvbwnu\t\t\t\tstr\t\t10\t10\tdex\t\t10\t10\tcold-min\t\t4\t4\tcold-max\t\t8\t8\tcold-len\t\t75\t75\tmanasteal\t\t5\t5\tnec\t\t2\t2\tmana\t\t25\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Umes Lament\t13\t0\t1\t\t\t1\t\t38\t28\tgwn\tGrim Wand\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tnec\t\t2\t2\tmana\t\t40\t40\tcast2\t\t20\t20\thowl\t\t64\t64\tskill\t77\t3\t3\tskill\t87\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Felloak\t14\t0\t1\t\t\t1\t\t4\t3\tclb\tClub\t\t5\t5000\tlgry\t\t\tinvclbu\t\t\t\tres-ltng\t\t60\t60\tres-fire\t\t20\t20\tknock\t\t1\t1\tfire-min\t\t6\t6\tfire-max\t\t8\t8\tdmg%\t\t70\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Knell Striker\t15\t0\t1\t\t\t1\t\t7\t5\tscp\tScepter\t\t5\t5000\tdred\tdred\t\t\t\t\t\tcrush\t\t25\t25\tres-fire\t\t20\t20\tres-pois\t\t20\t20\tmana\t\t15\t15\tatt\t\t35\t35\tdmg%\t\t70\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rusthandle\t16\t0\t1\t\t\t1\t\t23\t17\tgsc\tGrand Scepter\t\t5\t5000\tlgld\tlgld\t\t\t\t\t\tpal\t\t1\t1\tdmg-norm\t\t3\t7\tred-mag\t\t1\t1\tlifesteal\t\t8\t8\tdmg%\t\t50\t60\tdmg-undead\t\t50\t60\tskill\t111\t1\t3\tskill\t103\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stormeye\t17\t0\t1\t\t\t1\t\t31\t23\twsp\tWar Scepter\t\t5\t5000\tcred\tcred\t\t\t\t\t\tdmg-ltng\t\t1\t6\tdmg-cold\t75\t3\t5\tregen\t\t10\t10\tdmg%\t\t80\t120\tskill\t110\t3\t5\tskill\t118\t3\t3\tskill\t121\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stoutnail\t18\t0\t1\t\t\t1\t\t7\t5\tspc\tSpiked Club\t\t5\t5000\tdgry\t\t\tinvspcu\t\t\t\tthorns\t\t3\t10\tdmg%\t\t100\t100\tvit\t\t7\t7\tred-mag\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Crushflange\t19\t0\t1\t\t\t1\t\t12\t9\tmac\tMace\t\t5\t5000\tblac\tblac\t\t\t\t\t\tstr\t\t15\t15\tknock\t\t1\t1\tlight\t\t2\t2\tres-fire\t\t50\t50\tdmg%\t\t50\t60\tcrush\t\t33\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bloodrise\t20\t0\t1\t\t\t1\t\t20\t15\tmst\tMorning Star\t\t5\t5000\tlblu\t\t\tinvmstu\t\t\t\tdmg%\t\t120\t120\tatt%\t\t50\t50\topenwounds\t\t25\t25\tlight\t\t2\t2\tswing1\t\t10\t10\tskill\t96\t3\t3\tlifesteal\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Generals Tan Do Li Ga\t21\t0\t1\t\t\t1\t\t28\t21\tfla\tFlail\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tdmg-min\t\t1\t1\tdmg-max\t\t20\t20\tslow\t\t50\t50\tac\t\t25\t25\tmanasteal\t\t5\t5\tdmg%\t\t50\t60\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ironstone\t22\t0\t1\t\t\t1\t\t36\t27\twhm\tWar Hammer\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tatt\t\t100\t150\tdmg%\t\t100\t150\tltng-min\t\t1\t1\tltng-max\t\t10\t10\tstr\t\t10\t10\t*enr\t\t-5\t-5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bonesob\t23\t0\t1\t\t\t1\t\t32\t24\tmau\tMaul\t\t5\t5000\tlred\t\t\tinvmauu\t\t\t\tdmg%\t\t200\t300\tcrush\t\t40\t40\tres-fire\t\t30\t30\tres-cold\t\t30\t30\tdmg-undead\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Steeldriver\t24\t0\t1\t\t\t1\t\t39\t29\tgma\tGreat Maul\t\t5\t5000\tcgrn\tcgrn\t\tinvgma\t\t\t\tease\t\t-50\t-50\tswing3\t\t40\t40\tregen-stam\t\t25\t25\tdmg%\t\t150\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rixots Keen\t25\t0\t1\t\t\t1\t\t3\t2\tssd\tShort Sword\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdmg-min\t\t5\t5\tatt%\t\t20\t20\tlight\t\t2\t2\tcrush\t\t25\t25\tac\t\t25\t25\tdmg%\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blood Crescent\t26\t0\t1\t\t\t1\t\t10\t7\tscm\tScimitar\t\t5\t5000\tlblu\t\t\tinvscmu\t\t\t\tres-all\t\t15\t15\tdmg%\t\t60\t80\thp\t\t15\t15\tlight\t\t4\t4\topenwounds\t\t33\t33\tswing2\t\t15\t15\tlifesteal\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Krintizs Skewer\t27\t0\t1\t\t\t1\t\t14\t10\tsbr\tSaber\t\t5\t5000\tcblu\t\t\tinv9sbu\t\t\t\tignore-ac\t\t1\t1\tstr\t\t10\t10\tdex\t\t10\t10\tmanasteal\t\t7\t7\tdmg%\t\t50\t50\tdmg-norm\t\t3\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gleamscythe\t28\t0\t1\t\t\t1\t\t18\t13\tflc\tFalchion\t\t5\t5000\tlred\t\t\tinvflcu\t\t\t\tlight\t\t3\t3\tmana\t\t30\t30\tac\t\t20\t20\tswing2\t\t20\t20\tdmg%\t\t60\t100\tdmg-cold\t50\t3\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Azurewrath\t29\t0\t0\t\t\t1\t\t18\t13\tcrs\tCrystal Sword\t\t5\t5000\tlgry\t\t\tinvcrsu\t\t\t\tdeadly\t\t50\t50\tmag%\t\t10\t10\tdmg-cold\t100\t3\t6\tdmg%\t\t100\t100\tdur\t\t25\t25\tdmg-mag\t\t5\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Griswolds Edge\t30\t0\t1\t\t\t1\t\t23\t17\tbsd\tBroad Sword\t\t5\t5000\tcred\t\t\tinvbsdu\t\t\t\tfire-min\t\t10\t12\tfire-max\t\t15\t25\tatt\t\t100\t100\tswing1\t\t10\t10\tknock\t\t1\t1\tdmg%\t\t80\t120\tstr\t\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hellplague\t31\t0\t1\t\t\t1\t\t30\t22\tlsd\tLong Sword\t\t5\t5000\tdred\t\t\tinvlsdu\t\t\t\tmanasteal\t\t5\t5\tlifesteal\t\t5\t5\tpois-min\t\t48\t48\tpois-max\t\t96\t96\tpois-len\t\t150\t150\tdmg%\t\t70\t80\tdmg-fire\t\t25\t75\tfireskill\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Culwens Point\t32\t0\t1\t\t\t1\t\t39\t29\twsd\tWar Sword\t\t5\t5000\twhit\twhit\t\t\t\t\t\tallskills\t\t1\t1\tres-pois-len\t\t50\t50\tbalance2\t\t20\t20\tswing2\t\t20\t20\tatt\t\t60\t60\tdmg%\t\t70\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Shadowfang\t33\t0\t1\t\t\t1\t\t16\t12\t2hs\t2-Handed Sword\t\t5\t5000\tcgrn\t\t\tinv2hsu\t\t\t\tmanasteal\t\t9\t9\tres-cold\t\t20\t20\tlight\t\t-2\t-2\tdmg-cold\t150\t10\t30\tdmg%\t\t100\t100\tlifesteal\t\t9\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Soulflay\t34\t0\t1\t\t\t1\t\t26\t19\tclm\tClaymore\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tmanasteal\t\t4\t10\tlifesteal\t\t4\t4\tdmg%\t\t70\t100\tres-all\t\t5\t5\tswing2\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Kinemils Awl\t35\t0\t1\t\t\t1\t\t31\t23\tgis\tGiant Sword\t\t5\t5000\tdblu\t\t\tinvgisu\t\t\t\tatt\t\t100\t150\tmana\t\t20\t20\tfire-min\t\t6\t6\tfire-max\t\t20\t40\tdmg%\t\t80\t100\tskill\t102\t6\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blacktongue\t36\t0\t1\t\t\t1\t\t35\t26\tbsw\tBastard Sword\t\t5\t5000\tlgrn\t\t\tinvbswu\t\t\t\tdmg-pois\t150\t192\t192\tnoheal\t\t1\t1\tatt\t\t50\t50\tres-pois\t\t50\t50\tdmg%\t\t50\t60\t*hp\t\t-10\t-10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ripsaw\t37\t0\t1\t\t\t1\t\t35\t26\tflb\tFlamberge\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\topenwounds\t\t80\t80\tdmg-max\t\t15\t15\tmanasteal\t\t6\t6\tdmg%\t\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Patriarch\t38\t0\t1\t\t\t1\t\t39\t29\tgsd\tGreat Sword\t\t5\t5000\tcred\t\t\tinvgsdu\t\t\t\tred-dmg\t\t3\t3\tred-mag\t\t3\t3\tstupidity\t\t1\t1\tgold%\t\t100\t100\tdmg%\t\t100\t120\tstr\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gull\t39\t0\t1\t\t\t1\t\t6\t4\tdgr\tDagger\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tdmg-min\t\t1\t1\tdmg-max\t\t15\t15\tmag%\t\t100\t100\tmana\t\t-5\t-5\t\t\t\t\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Diggler\t40\t0\t1\t\t\t1\t\t15\t11\tdir\tDirk\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tdex\t\t10\t10\tdmg%\t\t50\t50\tswing3\t\t30\t30\tres-cold\t\t25\t25\tres-fire\t\t25\t25\tignore-ac\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Jade Tan Do\t41\t0\t1\t\t\t1\t\t26\t19\tkri\tKris\t\t5\t5000\toran\t\t\tinvkrsu\t\t\t\tatt\t\t100\t150\tnofreeze\t\t1\t1\tdmg-pois\t100\t460\t460\tres-pois\t\t95\t95\tres-pois-max\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Irices Shard\t42\t0\t1\t\t\t1\t\t34\t25\tbld\tBlade\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tcast3\t\t50\t50\tmana\t\t50\t50\tatt\t\t55\t55\tres-all\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Dragon Chang\t43\t0\t1\t\t\t1\t\t11\t8\tspr\tSpear\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\tatt\t\t35\t35\tdmg-min\t\t10\t10\tlight\t\t2\t2\tdmg-undead\t\t100\t100\tdmg-fire\t\t3\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Razortine\t44\t0\t1\t\t\t1\t\t16\t12\ttri\tTrident\t\t5\t5000\toran\t\t\tinvtriu\t\t\t\tslow\t\t25\t25\treduce-ac\t\t50\t50\tstr\t\t15\t15\tdex\t\t8\t8\tswing2\t\t30\t30\tdmg%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bloodthief\t45\t0\t1\t\t\t1\t\t23\t17\tbrn\tBrandistock\t\t5\t5000\twhit\twhit\t\t\t\t\t\topenwounds\t\t35\t35\tstr\t\t10\t10\tlifesteal\t\t8\t12\thp\t\t26\t26\tdmg%\t\t50\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lance of Yaggai\t46\t0\t1\t\t\t1\t\t30\t22\tspt\tSpetum\t\t5\t5000\tlred\tlred\t\t\t\t\t\tthorns\t\t8\t8\tltng-min\t\t1\t1\tltng-max\t\t60\t60\tres-all\t\t15\t15\tswing2\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Tannr Gorerod\t47\t0\t1\t\t\t1\t\t36\t27\tpik\tPike\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tfire-min\t\t23\t23\tfire-max\t\t54\t54\tres-fire-max\t\t15\t15\thp\t\t30\t30\tatt\t\t60\t60\tlight\t\t3\t3\tres-fire\t\t15\t15\tdmg%\t\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Dimoaks Hew\t48\t0\t1\t\t\t1\t\t11\t8\tbar\tBardiche\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdex\t\t15\t15\tdmg%\t\t100\t100\tswing2\t\t20\t20\tac\t\t-8\t-8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Steelgoad\t49\t0\t1\t\t\t1\t\t19\t14\tvou\tVoulge\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\thowl\t\t96\t96\tdeadly\t\t30\t30\tatt\t\t30\t30\tres-all\t\t5\t5\tdmg%\t\t60\t80\tdur\t\t20\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Soul Harvest\t50\t0\t1\t\t\t1\t\t26\t19\tscy\tScythe\t\t5\t5000\tdgry\t\t\tinvscyu\t\t\t\topenwounds\t\t30\t30\tatt\t\t45\t45\tres-all\t\t20\t20\tdmg%\t\t50\t90\tmanasteal\t\t10\t10\tenr\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Battlebranch\t51\t0\t1\t\t\t1\t\t34\t25\tpax\tPoleaxe\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tswing3\t\t30\t30\tdex\t\t10\t10\tdmg%\t\t50\t70\tatt\t\t50\t100\tlifesteal\t\t7\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Woestave\t52\t0\t1\t\t\t1\t\t38\t28\thal\tHalberd\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tslow\t\t50\t50\topenwounds\t\t50\t50\tstupidity\t\t3\t3\tdmg-ac\t\t-50\t-50\tfreeze\t\t1\t1\tlight\t\t-3\t-3\tnoheal\t\t1\t1\tdmg%\t\t20\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Grim Reaper\t53\t0\t1\t\t\t1\t\t39\t29\twsc\tWar Scythe\t\t5\t5000\tlpur\tlpur\t\t\t\t\t\tdeadly\t\t100\t100\tnoheal\t\t1\t1\tmanasteal\t\t5\t5\tdmg%\t\t20\t20\tdmg-min\t\t15\t15\t*hp\t\t-20\t-20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bane Ash\t54\t0\t1\t\t\t1\t\t7\t5\tsst\tShort Staff\t\t5\t5000\tlgrn\tlgrn\t\t\t\t\t\tfire-min\t\t4\t4\tfire-max\t\t6\t6\tres-fire\t\t50\t50\tmana\t\t30\t30\tswing2\t\t20\t20\tdmg%\t\t50\t60\tskill\t36\t5\t5\tskill\t37\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Serpent Lord\t55\t0\t1\t\t\t1\t\t12\t9\tlst\tLong Staff\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tdmg-pois\t75\t40\t40\tres-pois\t\t50\t50\tlight\t\t-1\t-1\tmana\t\t10\t10\tdmg%\t\t30\t40\tmanasteal\t\t100\t100\treduce-ac\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lazarus Spire\t56\t0\t1\t\t\t1\t\t24\t18\tcst\tGnarled Staff\t\t5\t5000\tlgry\t\t\tinvcstu\t\t\t\tres-ltng\t\t75\t75\tred-dmg\t\t5\t5\tenr\t\t15\t15\tskill\t53\t1\t1\tskill\t49\t2\t2\tskill\t42\t3\t3\tregen-mana\t\t43\t43\tdmg-ltng\t\t1\t28\tsor\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Salamander\t57\t0\t1\t\t\t1\t\t28\t21\tbst\tBattle Staff\t\t5\t5000\tdred\tdred\t\t\t\t\t\tdmg-fire\t\t15\t32\tres-fire\t\t30\t30\tskill\t51\t1\t1\tskill\t47\t2\t2\tskill\t37\t3\t3\tfireskill\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Iron Jang Bong\t58\t0\t1\t\t\t1\t\t38\t28\twst\tWar Staff\t\t5\t5000\tdyel\tdyel\t\t\t\t\t\tac\t\t30\t30\tcast3\t\t20\t20\tdmg%\t\t100\t100\tatt%\t\t50\t50\tskill\t48\t2\t2\tskill\t46\t2\t2\tskill\t44\t3\t3\tsor\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Pluckeye\t59\t0\t1\t\t\t1\t\t10\t7\tsbw\tShort Bow\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tatt\t\t28\t28\tdmg%\t\t100\t100\thp\t\t10\t10\tlight\t\t2\t2\tmanasteal\t\t3\t3\tmana-kill\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Witherstring\t60\t0\t1\t\t\t1\t\t18\t13\thbw\tHunter\\92s Bow\t\t5\t5000\tlred\tlred\t\t\t\t\t\tswing3\t\t30\t30\tdmg-min\t\t1\t1\tdmg-max\t\t3\t3\tatt\t\t50\t50\tmagicarrow\t\t3\t3\tdmg%\t\t40\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rimeraven\t61\t0\t1\t\t\t1\t\t20\t15\tlbw\tLong Bow\t\t5\t5000\tdred\tdred\t\t\t\t\t\tatt%\t\t50\t50\tdex\t\t3\t3\texplosivearrow\t\t3\t3\tstr\t\t3\t3\tdmg%\t\t60\t70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Piercerib\t62\t0\t1\t\t\t1\t\t27\t20\tcbw\tComposite Bow\t\t5\t5000\tcred\t\t\tinvcbwu\t\t\t\tres-all\t\t10\t10\tdeadly\t\t30\t30\tatt\t\t60\t60\tdmg-undead\t\t100\t100\tdmg%\t\t40\t60\tswing2\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Pullspite\t63\t0\t1\t\t\t1\t\t34\t25\tsbb\tShort Battle Bow\t\t5\t5000\tlgrn\t\t\tinvsbbu\t\t\t\tdmg-ltng\t\t1\t30\tstr\t\t8\t8\tatt\t\t28\t28\tpierce\t\t25\t25\tres-ltng\t\t25\t25\tdmg%\t\t70\t90\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Wizendraw\t64\t0\t1\t\t\t1\t\t35\t26\tlbb\tLong Battle Bow\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tmagicarrow\t\t5\t5\tmana\t\t30\t30\tswing2\t\t20\t20\tres-cold\t\t26\t26\tatt\t\t50\t100\tdmg%\t\t70\t80\tenr\t\t15\t15\tpierce-cold\t\t20\t35\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hellclap\t65\t0\t1\t\t\t1\t\t36\t27\tswb\tShort War Bow\t\t5\t5000\tcgrn\t\t\tinvswbu\t\t\t\tswing1\t\t10\t10\tfire-min\t\t15\t15\tfire-max\t\t30\t50\tatt\t\t50\t75\tres-fire\t\t40\t40\tdex\t\t12\t12\tdmg%\t\t70\t90\tfireskill\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blastbark\t66\t0\t1\t\t\t1\t\t38\t28\tlwb\tLong War Bow\t\t5\t5000\tlyel\tlyel\t\t\t\t\t\tdmg%\t\t70\t130\tstr\t\t5\t5\tama\t\t1\t1\tmanasteal\t\t3\t3\tskill\t16\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Leadcrow\t67\t0\t1\t\t\t1\t\t12\t9\tlxb\tLight Crossbow\t\t5\t5000\tdyel\t\t\tinvlxbu\t\t\t\tdex\t\t10\t10\thp\t\t10\t10\tdmg%\t\t70\t70\tres-pois\t\t30\t30\tdeadly\t\t25\t25\tatt\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ichorsting\t68\t0\t1\t\t\t1\t\t24\t18\tmxb\tCrossbow\t\t5\t5000\tlgld\t\t\tinvmxbu\t\t\t\tdmg-pois\t75\t102\t102\tdex\t\t20\t20\tpierce\t\t50\t50\tatt\t\t50\t50\tdmg%\t\t50\t50\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hellcast\t69\t0\t1\t\t\t1\t\t36\t27\thxb\tHeavy Crossbow\t\t5\t5000\tdgld\t\t\tinvhxbu\t\t\t\texplosivearrow\t\t5\t5\tres-fire-max\t\t15\t15\tres-fire\t\t15\t15\tatt\t\t70\t70\tswing2\t\t20\t20\tdmg%\t\t70\t80\tdmg-fire\t\t15\t35\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Doomspittle\t70\t0\t1\t\t\t1\t\t38\t28\trxb\tRepeating Crossbow\t\t5\t5000\tlpur\t\t\tinvrxbu\t\t\t\tama\t\t1\t1\tpierce\t\t35\t35\tswing3\t\t30\t30\thp\t\t15\t15\tdmg%\t\t60\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"War Bonnet\t71\t0\t1\t\t\t1\t\t4\t3\tcap\tCap\t\t5\t5000\tdpur\t\t\tinvcapu\t\t\t\thp\t\t15\t15\tatt\t\t30\t30\tdmg%\t\t30\t30\tmana\t\t15\t15\tac\t\t14\t14\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Tarnhelm\t72\t0\t1\t\t\t1\t\t20\t15\tskp\tSkull Cap\t\t5\t5000\toran\toran\t\t\t\t\t\tgold%\t\t75\t75\tmag%\t\t25\t50\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Coif of Glory\t73\t0\t1\t\t\t1\t\t19\t14\thlm\tHelm\t\t5\t5000\twhit\t\t\tinvhlmu\t\t\t\tlight-thorns\t\t7\t7\tstupidity\t\t1\t1\tres-ltng\t\t15\t15\tac-miss\t\t100\t100\tac\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Duskdeep\t74\t0\t1\t\t\t1\t\t23\t17\tfhl\tFull Helm\t\t5\t5000\tlgry\t\t\tinvfhlu\t\t\t\tlight\t\t-2\t-2\tres-all\t\t15\t15\tred-dmg\t\t7\t7\tdmg-max\t\t8\t8\tac\t\t10\t20\tac%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Wormskull\t75\t0\t1\t\t\t1\t\t28\t21\tbhm\tBone Helm\t\t5\t5000\tlgrn\t\t\tinvbhmu\t\t\t\tnec\t\t1\t1\tlifesteal\t\t5\t5\tmana\t\t10\t10\tres-pois\t\t25\t25\tdmg-pois\t200\t102\t102\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Howltusk\t76\t0\t1\t\t\t1\t\t34\t25\tghm\tGreat Helm\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tred-mag\t\t2\t2\tthorns\t\t3\t3\tac%\t\t80\t80\tdmg-to-mana\t\t35\t35\tknock\t\t1\t1\thowl\t\t33\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Undead Crown\t77\t0\t1\t\t\t1\t\t39\t29\tcrn\tCrown\t\t5\t5000\tblac\tblac\t\t\t\t\t\tlifesteal\t\t5\t5\tac\t\t40\t40\tres-pois\t\t50\t50\thalf-freeze\t\t1\t1\tac%\t\t30\t60\tdmg-undead\t\t50\t50\tatt-undead\t\t50\t100\tskill\t69\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Face of Horror\t78\t0\t1\t\t\t1\t\t27\t20\tmsk\tMask\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\thowl\t\t64\t64\tstr\t\t20\t20\tres-all\t\t10\t10\tdmg-undead\t\t50\t50\tac\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Greyform\t79\t0\t1\t\t\t1\t\t10\t7\tqui\tQuilted Armor\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tred-mag\t\t3\t3\tres-cold\t\t20\t20\tres-fire\t\t20\t20\tdex\t\t10\t10\tlifesteal\t\t5\t5\tac\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blinkbats Form\t80\t0\t1\t\t\t1\t\t16\t12\tlea\tLeather Armor\t\t5\t5000\tdred\tdred\t\t\t\t\t\tac-miss\t\t50\t50\tmove2\t\t10\t10\tac\t\t25\t25\tfire-min\t\t3\t3\tfire-max\t\t6\t6\tbalance2\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Centurion\t81\t0\t1\t\t\t1\t\t19\t14\thla\tHard Leather\t\t5\t5000\tcred\tcred\t\t\t\t\t\tac\t\t30\t30\tatt\t\t50\t50\tred-dmg\t\t2\t2\thp\t\t15\t15\tmana\t\t15\t15\tstam\t\t15\t15\tregen\t\t5\t5\tstamdrain\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Twitchthroe\t82\t0\t1\t\t\t1\t\t22\t16\tstu\tStudded Leather\t\t5\t5000\tlgrn\tlgrn\t\t\t\t\t\tswing2\t\t20\t20\tdex\t\t10\t10\tblock\t\t25\t25\tac\t\t25\t25\tstr\t\t10\t10\tbalance2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Darkglow\t83\t0\t1\t\t\t1\t\t19\t14\trng\tRing Mail\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tatt\t\t20\t20\tres-all-max\t\t5\t5\tlight\t\t3\t3\tac-hth\t\t50\t50\tres-all\t\t10\t10\tac%\t\t70\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hawkmail\t84\t0\t1\t\t\t1\t\t20\t15\tscl\tScale Mail\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tac%\t\t80\t100\tres-cold-max\t\t15\t15\tres-cold\t\t15\t15\tnofreeze\t\t1\t1\tmove2\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Sparking Mail\t85\t0\t1\t\t\t1\t\t23\t17\tchn\tChain Mail\t\t5\t5000\tlyel\tlyel\t\t\t\t\t\tac%\t\t75\t85\tdmg-ltng\t\t1\t20\tlight-thorns\t\t10\t14\tres-ltng\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Venomsward\t86\t0\t1\t\t\t1\t\t27\t20\tbrs\tBreast Plate\t\t5\t5000\tdyel\tdyel\t\t\t\t\t\tres-pois-max\t\t15\t15\tres-pois-len\t\t50\t50\tres-pois\t\t90\t90\tlight\t\t2\t2\tac%\t\t60\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Iceblink\t87\t0\t1\t\t\t1\t\t30\t22\tspl\tSplint Mail\t\t5\t5000\tlgld\tlgld\t\t\t\t\t\tfreeze\t\t1\t1\tres-cold\t\t30\t30\tlight\t\t4\t4\tred-mag\t\t1\t1\tac%\t\t70\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Boneflesh\t88\t0\t1\t\t\t1\t\t35\t26\tplt\tPlate Mail\t\t5\t5000\tdgld\tdgld\t\t\t\t\t\tlifesteal\t\t5\t5\tac%\t\t100\t120\tatt\t\t35\t35\topenwounds\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rockfleece\t89\t0\t1\t\t\t1\t\t38\t28\tfld\tField Plate\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tease\t\t-10\t-10\tac%\t\t100\t130\tred-dmg%\t\t10\t10\tred-dmg\t\t5\t5\tstr\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rattlecage\t90\t0\t1\t\t\t1\t\t39\t29\tgth\tGothic Plate\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\thowl\t\t52\t52\tatt\t\t45\t45\tcrush\t\t25\t25\tac\t\t200\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Goldskin\t91\t0\t1\t\t\t1\t\t38\t28\tful\tFull Plate Mail\t\t5\t5000\toran\t\t\tinvfulu\t\t\t\tac%\t\t120\t150\tres-all\t\t35\t35\tthorns\t\t10\t10\tlight\t\t2\t2\tgold%\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Victors Silk\t92\t0\t1\t\t\t1\t\t38\t28\taar\tAncientArmor\t\t5\t5000\tdblu\t\t\tinvaaru\t\t\t\tmanasteal\t\t5\t5\tallskills\t\t1\t1\tlight\t\t2\t2\tac%\t\t100\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Heavenly Garb\t93\t0\t1\t\t\t1\t\t39\t29\tltp\tLight Plate\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tac%\t\t100\t100\tres-all\t\t10\t10\tregen-mana\t\t25\t25\tenr\t\t15\t15\tdmg-undead\t\t50\t50\tatt-undead\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Pelta Lunata\t94\t0\t1\t\t\t1\t\t3\t2\tbuc\tBuckler\t\t5\t5000\twhit\t\t\tinvbucu\t\t\t\tac\t\t30\t30\tvit\t\t10\t10\tstr\t\t2\t2\tenr\t\t10\t10\tac%\t\t30\t40\tblock\t\t20\t20\tblock2\t\t40\t40\tdur\t\t8\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Umbral Disk\t95\t0\t1\t\t\t1\t\t12\t9\tsml\tSmall Shield\t\t5\t5000\tlgry\t\t\tinvsmlu\t\t\t\tstupidity\t\t1\t1\tdex\t\t10\t10\tac\t\t30\t30\thp\t\t20\t20\tlight\t\t-2\t-2\tac%\t\t40\t50\tblock\t\t30\t30\tdur\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stormguild\t96\t0\t1\t\t\t1\t\t18\t13\tlrg\tLarge Shield\t\t5\t5000\tdgry\t\t\tinvlrgu\t\t\t\tred-mag\t\t1\t1\tres-ltng\t\t25\t25\tac\t\t30\t30\tdmg-ltng\t\t1\t6\tac%\t\t50\t60\tblock\t\t30\t30\tlight-thorns\t\t3\t3\tdur\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Wall of the Eyeless\t97\t0\t1\t\t\t1\t\t27\t20\tbsh\tBone Shield\t\t5\t5000\tlgld\t\t\tinvbshu\t\t\t\tmana-kill\t\t5\t5\tmanasteal\t\t3\t3\tcast2\t\t20\t20\tres-pois\t\t20\t20\tac%\t\t30\t40\tac\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Swordback Hold\t98\t0\t1\t\t\t1\t\t20\t15\tspk\tSpiked Shield\t\t5\t5000\tlred\t\t\tinvspku\t\t\t\tthorns\t\t5\t5\tblock\t\t20\t20\topenwounds\t\t50\t50\tbloody\t\t3\t5\tac%\t\t30\t60\tthorns\t\t5\t5\tac\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Steelclash\t99\t0\t1\t\t\t1\t\t23\t17\tkit\tKite Shield\t\t5\t5000\tblac\t\t\tinvkitu\t\t\t\tblock\t\t25\t25\tpal\t\t1\t1\tred-dmg\t\t3\t3\tlight\t\t3\t3\tac%\t\t60\t100\tblock2\t\t20\t20\tres-all\t\t15\t15\tac\t\t20\t20\tdur\t\t15\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bverrit Keep\t100\t0\t1\t\t\t1\t\t26\t19\ttow\tTower Shield\t\t5\t5000\tlblu\t\t\tinvtowu\t\t\t\tac\t\t30\t30\tres-fire\t\t75\t75\tstr\t\t5\t5\tred-mag\t\t5\t5\tac%\t\t80\t120\tblock\t\t10\t10\tdur\t\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Ward\t101\t0\t1\t\t\t1\t\t35\t26\tgts\tGothic Shield\t\t5\t5000\tdblu\t\t\tinvgtsu\t\t\t\tac\t\t40\t40\tred-mag\t\t2\t2\tstr\t\t10\t10\tblock\t\t10\t10\tac%\t\t100\t100\tres-all\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Hand of Broc\t102\t0\t1\t\t\t1\t\t7\t5\tlgl\tGloves\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tmanasteal\t\t3\t3\tlifesteal\t\t3\t3\tres-pois\t\t10\t10\tmana\t\t20\t20\tac\t\t10\t10\tac%\t\t10\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bloodfist\t103\t0\t1\t\t\t1\t\t12\t9\tvgl\tHeavy Gloves\t\t5\t5000\toran\toran\t\t\t\t\t\tdmg-min\t\t5\t5\thp\t\t40\t40\tbalance2\t\t30\t30\tac\t\t10\t10\tac%\t\t10\t20\tswing2\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Chance Guards\t104\t0\t1\t\t\t1\t\t20\t15\tmgl\tBracers\t\t5\t5000\tlred\tlred\t\t\t\t\t\tgold%\t\t200\t200\tmag%\t\t25\t40\tatt\t\t25\t25\tac\t\t15\t15\tlight\t\t2\t2\tac%\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Magefist\t105\t0\t1\t\t\t1\t\t31\t23\ttgl\tLight Gauntlets\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tcast3\t\t20\t20\tregen-mana\t\t25\t25\tfireskill\t\t1\t1\tdmg-fire\t\t1\t6\tac\t\t10\t10\tac%\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Frostburn\t106\t0\t1\t\t\t1\t\t39\t29\thgl\tGauntlets\t\t5\t5000\tdred\tdred\t\t\t\t\t\tac\t\t30\t30\tdmg%\t\t5\t5\tmana%\t\t40\t40\tdmg-cold\t50\t1\t6\tac%\t\t10\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hotspur\t107\t0\t1\t\t\t1\t\t7\t5\tlbt\tLeather Boots\t\t5\t5000\tcred\tcred\t\t\t\t\t\tres-fire-max\t\t15\t15\thp\t\t15\t15\tdmg-fire\t\t3\t6\tac\t\t6\t6\tres-fire\t\t45\t45\tac%\t\t10\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gorefoot\t108\t0\t1\t\t\t1\t\t12\t9\tvbt\tHeavy Boots\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tbloody\t\t3\t5\tmove2\t\t20\t20\tmanasteal\t\t2\t2\tthorns\t\t2\t2\tac\t\t12\t12\tac%\t\t20\t30\tskill\t132\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Treads of Cthon\t109\t0\t1\t\t\t1\t\t20\t15\tmbt\tChain Boots\t\t5\t5000\tlgrn\tlgrn\t\t\t\t\t\tmove2\t\t30\t30\tac-miss\t\t50\t50\tstamdrain\t\t50\t50\thp\t\t10\t10\tac\t\t12\t12\tac%\t\t30\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Goblin Toe\t110\t0\t1\t\t\t1\t\t30\t22\ttbt\tLight Plate Boots\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tcrush\t\t25\t25\tred-dmg\t\t1\t1\tred-mag\t\t1\t1\tac\t\t15\t15\tlight\t\t-1\t-1\tac%\t\t50\t60\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Tearhaunch\t111\t0\t1\t\t\t1\t\t39\t29\thbt\tPlate Boots\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tac\t\t35\t35\tstr\t\t5\t5\tdex\t\t5\t5\tmove2\t\t20\t20\tres-all\t\t10\t10\tac%\t\t60\t80\tskill\t115\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lenyms Cord\t112\t0\t1\t\t\t1\t\t10\t7\tlbl\tSash\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tmana\t\t15\t15\tregen-mana\t\t30\t30\tres-all\t\t5\t5\tlight\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Snakecord\t113\t0\t1\t\t\t1\t\t16\t12\tvbl\tLight Belt\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdmg-pois\t75\t40\t40\tres-pois\t\t25\t25\tac\t\t10\t10\tac%\t\t20\t30\tregen\t\t5\t5\tres-pois-len\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Nightsmoke\t114\t0\t1\t\t\t1\t\t27\t20\tmbl\tBelt\t\t5\t5000\tlyel\tlyel\t\t\t\t\t\tres-all\t\t10\t10\tdmg-to-mana\t\t50\t50\tmana\t\t20\t20\tred-dmg\t\t2\t2\tac\t\t15\t15\tac%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Goldwrap\t115\t0\t1\t\t\t1\t\t36\t27\ttbl\tHeavy Belt\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tmag%\t\t30\t30\tlight\t\t2\t2\tac\t\t25\t25\tswing2\t\t10\t10\tac%\t\t40\t60\tgold%\t\t50\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bladebuckle\t116\t0\t1\t\t\t1\t\t39\t29\thbl\tGirdle\t\t5\t5000\tdyel\tdyel\t\t\t\t\t\tthorns\t\t8\t8\tac\t\t30\t30\tred-dmg\t\t3\t3\tstr\t\t5\t5\tdex\t\t10\t10\tac%\t\t80\t100\tbalance2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Nokozan Relic\t117\t0\t1\t\t\t20\t\t14\t10\tamu\tAmulet\t\t5\t5000\tlgld\t\t\t\t\t\t\tdmg-fire\t\t3\t6\tres-fire-max\t\t10\t10\tres-fire\t\t50\t50\tlight\t\t3\t3\tbalance2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Eye of Etlich\t118\t0\t1\t\t\t5\t\t20\t15\tamu\tAmulet\t\t5\t5000\tdgld\t\t\t\t\t\t\tac-miss\t\t10\t40\tlight\t\t1\t5\tallskills\t\t1\t1\tlifesteal\t\t3\t7\tcold-min\t\t1\t2\tcold-max\t\t3\t5\tcold-len\t\t50\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Mahim-Oak Curio\t119\t0\t1\t\t\t10\t\t34\t25\tamu\tAmulet\t\t5\t5000\tlpur\t\t\t\t\t\t\tdex\t\t10\t10\tstr\t\t10\t10\tenr\t\t10\t10\tvit\t\t10\t10\tac\t\t10\t10\tatt%\t\t10\t10\tres-all\t\t10\t10\tac%\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Nagelring\t120\t0\t1\t\t\t15\t\t10\t7\trin\tRing\t\t5\t5000\tdpur\t\t\t\t\t\t\tred-mag\t\t3\t3\tthorns\t\t3\t3\tatt\t\t50\t75\tmag%\t\t15\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Manald Heal\t121\t0\t1\t\t\t15\t\t20\t15\trin\tRing\t\t5\t5000\toran\t\t\t\t\t\t\tmanasteal\t\t4\t7\tregen\t\t5\t8\thp\t\t20\t20\tregen-mana\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Stone of Jordan\t122\t0\t1\t\t\t1\t\t39\t29\trin\tRing\t\t5\t5000\twhit\t\t\t\t\t\t\tmana\t\t20\t20\tmana%\t\t25\t25\tltng-min\t\t1\t1\tallskills\t\t1\t1\tltng-max\t\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t1\t0\n",
+                u8"Amulet of the Viper\t123\t0\t1\t\t\t1\t\t0\t0\tvip\tAmulet\t\t5\t5000\tlgry\t\t\t\t\t\t\tmana\t\t10\t10\tres-pois\t\t25\t25\thp\t\t10\t10\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Staff of Kings\t124\t0\t1\t\t\t1\t\t0\t0\tmsf\tStaff\t\t5\t5000\tdgry\t\t\t\t\t\t\tres-all\t\t10\t10\tswing3\t\t50\t50\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Horadric Staff\t125\t0\t1\t\t\t1\t\t0\t0\thst\tStaff\t\t5\t5000\tblac\t\t\t\t\t\t\tmana\t\t10\t10\tres-pois\t\t25\t25\thp\t\t10\t10\tres-all\t\t10\t10\tswing3\t\t50\t50\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hell Forge Hammer\t126\t0\t1\t\t\t1\t\t0\t0\thfh\tHammer\t\t5\t5000\tcred\t\t\t\t\t\t\tfire-min\t\t5\t5\tfire-max\t\t20\t20\tres-fire\t\t40\t40\tac\t\t35\t35\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"KhalimFlail\t127\t0\t1\t\t\t1\t\t0\t0\tqf1\tFlail\t\t5\t5000\tdblu\t\t\t\t\t\t\tltng-min\t\t1\t1\tltng-max\t\t20\t20\tswing3\t\t50\t50\tatt\t\t40\t40\t\t\t0\t0\t\t\t0\t0\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"SuperKhalimFlail\t128\t0\t1\t\t\t1\t\t0\t0\tqf2\tFlail\t\t5\t5000\tdblu\t\t\t\t\t\t\tltng-min\t\t1\t1\tltng-max\t\t40\t40\tswing3\t\t50\t50\tatt\t\t40\t40\tmanasteal\t\t6\t6\tlifesteal\t\t6\t6\t\t\t0\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Coldkill\t129\t100\t1\t\t\t1\t\t44\t36\t9ha\tHatchet\t\t5\t5000\tcblu\tcblu\t\tinvhaxu\t\t\t\tdmg-cold\t50\t40\t40\tres-cold\t\t15\t15\tres-cold-max\t\t15\t15\tswing3\t\t30\t30\thit-skill\t45\t10\t10\tgethit-skill\t44\t10\t5\tdmg%\t\t150\t190\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Butcher's Pupil\t130\t100\t1\t\t\t1\t\t47\t39\t9ax\tCleaver\t\t5\t5000\tcblu\tcblu\t\tinvaxeu\t\t\t\tdeadly\t\t35\t35\topenwounds\t\t25\t25\tdmg%\t\t150\t200\tindestruct\t\t1\t1\tswing3\t\t30\t30\tdmg-norm\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Islestrike\t131\t100\t1\t\t\t1\t\t51\t43\t92a\tTwin Axe\t\t5\t5000\t\t\t\t\t\t\t\tdru\t\t2\t2\tstr\t\t10\t10\tdex\t\t10\t10\tvit\t\t10\t10\tenr\t\t10\t10\tac-miss\t\t50\t50\tcrush\t\t25\t25\tdmg%\t\t170\t190\tskill\t233\t1\t1\tskill\t248\t1\t1\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Pompe's Wrath\t132\t100\t1\t\t\t1\t\t53\t45\t9mp\tCrowbill\t\t5\t5000\tcred\tcred\t\tinvmpiu\t\t\t\thit-skill\t244\t4\t8\tslow\t\t50\t50\tdmg-fire\t\t35\t150\tknock\t\t1\t1\tdmg%\t\t140\t170\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Guardian Naga\t133\t100\t1\t\t\t1\t\t56\t48\t9wa\tNaga\t\t5\t5000\t\t\t\t\t\t\t\thit-skill\t92\t5\t8\tthorns\t\t15\t15\tres-pois\t\t30\t30\tdmg%\t\t150\t180\tdmg-pois\t250\t256\t256\tdmg-max\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Warlord's Trust\t134\t100\t1\t\t\t1\t\t43\t35\t9la\tMilitary Axe\t\t5\t5000\twhit\twhit\t\t\t\t\t\tac\t\t75\t75\tregen\t\t20\t20\tvit/lvl\t4\t\t\tres-all\t\t10\t10\trep-dur\t25\t\t\tdmg%\t\t175\t175\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Spellsteel\t135\t100\t1\t\t\t1\t\t47\t39\t9ba\tBearded Axe\t\t5\t5000\twhit\twhit\t\t\t\t\t\tease\t\t-60\t-60\tmana\t\t100\t100\tred-mag\t\t12\t15\tcast1\t\t10\t10\tdmg%\t\t165\t165\tregen-mana\t\t25\t25\tcharged\t54\t20\t1\tcharged\t87\t30\t3\tcharged\t101\t100\t10\tcharged\t225\t60\t12\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stormrider\t136\t100\t1\t\t\t1\t\t49\t41\t9bt\tTabar\t\t5\t5000\tlred\tlred\t\tinv9btu\t\t\t\thit-skill\t53\t5\t10\thit-skill\t38\t10\t0\tdmg-ltng\t\t1\t200\tdmg-norm\t\t35\t75\tdmg%\t\t100\t100\tdur\t\t50\t50\tlight-thorns\t\t15\t15\tgethit-skill\t38\t15\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Boneslayer Blade\t137\t100\t1\t\t\t1\t\t50\t42\t9ga\tGothic Axe\t\t5\t5000\t\t\t\tinvgaxu\t\t\t\tatt-und/lvl\t10\t\t\tdmg-und/lvl\t20\t\t\tstr\t\t8\t8\tswing2\t\t20\t20\tatt%\t\t35\t35\tdmg%\t\t180\t220\tcharged\t101\t200\t20\tgethit-skill\t101\t50\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Minataur\t138\t100\t1\t\t\t1\t\t53\t45\t9gi\tAncient Axe\t\t5\t5000\t\t\t\tinv9giu\t\t\t\tstupidity\t\t2\t2\thalf-freeze\t\t1\t1\tstr\t\t15\t20\tslow\t\t50\t50\tcrush\t\t30\t30\tdmg-norm\t\t20\t30\tdmg%\t\t140\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Suicide Branch\t139\t100\t1\t\t\t1\t\t41\t33\t9wn\tBurnt Wand\t\t5\t5000\t\t\t\t\t\t\t\tthorns\t\t25\t25\tcast2\t\t50\t50\tres-all\t\t10\t10\tmana%\t\t10\t10\thp\t\t40\t40\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Carin Shard\t140\t100\t1\t\t\t1\t\t43\t35\t9yw\tPetrified Wand\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\thp/lvl\t10\t\t\tcast2\t\t10\t10\tmana/lvl\t10\t\t\tbalance2\t\t30\t30\tregen\t\t5\t5\tnec\t\t1\t1\tskilltab\t8\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Arm of King Leoric\t141\t100\t1\t\t\t1\t\t44\t36\t9bw\tTomb Wand\t\t5\t5000\t\t\t\tinvbwnu\t\t\t\tskilltab\t8\t2\t2\tgethit-skill\t93\t5\t10\tmana/lvl\t10\t\t\tgethit-skill\t88\t10\t2\tcast1\t\t10\t10\tskilltab\t7\t2\t2\tskill\t77\t2\t2\tskill\t80\t2\t2\tskill\t69\t3\t3\tskill\t70\t3\t3\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blackhand Key\t142\t100\t1\t\t\t1\t\t49\t41\t9gw\tGrave Wand\t\t5\t5000\tblac\tblac\t\tinv9gwu\t\t\t\tskilltab\t6\t1\t1\tdmg-to-mana\t\t20\t20\thp\t\t50\t50\tlight\t\t-2\t-2\tcast3\t\t30\t30\tres-fire\t\t37\t37\tnec\t\t2\t2\tcharged\t150\t30\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Dark Clan Crusher\t143\t100\t1\t\t\t1\t\t42\t34\t9cl\tCudgel\t\t5\t5000\tdgld\tdgld\t\tinvclbu\t\t\t\tdru\t\t2\t2\tdmg-demon\t\t200\t200\tatt-demon\t\t200\t200\tdmg%\t\t195\t195\tatt%\t\t20\t25\tdemon-heal\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Zakarum's Hand\t144\t100\t1\t\t\t1\t\t45\t37\t9sc\tRune Scepter\t\t5\t5000\tlpur\tlpur\t\t\t\t\t\tmanasteal\t\t8\t8\tignore-ac\t\t1\t1\tregen-mana\t\t10\t10\tregen-stam\t\t15\t15\thit-skill\t59\t6\t5\tdmg%\t\t180\t220\tswing2\t\t30\t30\tskill\t114\t2\t2\tskill\t118\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Fetid Sprinkler\t145\t100\t1\t\t\t1\t\t46\t38\t9qs\tHoly Water Sprinkler\t\t5\t5000\t\t\t\t\t\t\t\tpal\t\t2\t2\thit-skill\t87\t5\t1\thit-skill\t81\t10\t1\tdmg-pois\t100\t409\t409\tdmg%\t\t160\t190\tatt\t\t150\t200\tdmg-norm\t\t15\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hand of Blessed Light\t146\t100\t1\t\t\t1\t\t50\t42\t9ws\tDivine Scepter\t\t5\t5000\tlyel\t\t\t\t\t\t\tpal\t\t2\t2\tdmg%\t\t130\t160\tatt%\t\t100\t100\tac\t\t50\t50\tregen-mana\t\t15\t15\tlight\t\t4\t4\tdmg-norm\t\t20\t45\tskill\t101\t4\t4\tskill\t121\t2\t2\thit-skill\t121\t5\t4\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Fleshrender\t147\t100\t1\t\t\t1\t\t46\t38\t9sp\tBarbed Club\t\t5\t5000\tblac\t\t\tinvspcu\t\t\t\topenwounds\t\t25\t25\tnoheal\t\t1\t1\tcrush\t\t20\t20\tdeadly\t\t20\t20\tdmg-norm\t\t35\t50\tdmg%\t\t130\t200\tdru\t\t1\t1\tskilltab\t16\t2\t2\tdur\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Sureshrill Frost\t148\t100\t1\t\t\t1\t\t47\t39\t9ma\tFlanged Mace\t\t5\t5000\t\t\t\t\t\t\t\tdmg-cold\t125\t63\t112\tnofreeze\t\t1\t1\tdmg%\t\t150\t180\tdmg-norm\t\t5\t10\tfreeze\t\t3\t3\tcharged\t64\t50\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Moonfall\t149\t100\t1\t\t\t1\t\t50\t42\t9mt\tJagged Star\t\t5\t5000\t\t\t\tinvmstu\t\t\t\thit-skill\t56\t5\t6\tdmg-fire\t\t55\t115\tred-mag\t\t9\t12\tdmg%\t\t120\t150\tlight\t\t2\t2\tcharged\t56\t60\t11\tdmg-norm\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Baezil's Vortex\t150\t100\t1\t\t\t1\t\t53\t45\t9fl\tKnout\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\thit-skill\t48\t5\t8\tdmg-ltng\t\t1\t150\tmana\t\t100\t100\tres-ltng\t\t25\t25\tdmg%\t\t160\t200\tswing2\t\t20\t20\tcharged\t48\t80\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Earthshaker\t151\t100\t1\t\t\t1\t\t51\t43\t9wh\tBattle Hammer\t\t5\t5000\t\t\t\t\t\t\t\thit-skill\t234\t5\t7\tknock\t\t1\t1\tswing3\t\t30\t30\tdmg%\t\t180\t180\tstupidity\t\t1\t1\tskilltab\t17\t3\t3\tdur\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bloodtree Stump\t152\t100\t1\t\t\t1\t\t56\t48\t9m9\tWar Club\t\t5\t5000\tdred\t\t\t\t\t\t\tcrush\t\t50\t50\tdmg%\t\t180\t220\tres-all\t\t20\t20\tstr\t\t25\t25\tskilltab\t13\t2\t2\tskill\t129\t3\t3\tdur\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Gavel of Pain\t153\t100\t1\t\t\t1\t\t53\t45\t9gm\tMartel de Fer\t\t5\t5000\t\t\t\tinv9gmu\t\t\t\thit-skill\t66\t5\t1\tgethit-skill\t76\t5\t1\tthorns\t\t26\t26\tindestruct\t\t1\t1\tdmg-norm\t\t12\t30\tdmg%\t\t130\t160\tcharged\t66\t3\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bloodletter\t154\t100\t1\t\t\t1\t\t38\t30\t9ss\tGladius\t\t5\t5000\tcred\tcred\t\t\t\t\t\tdmg-norm\t\t12\t45\tatt\t\t90\t90\tlifesteal\t\t8\t8\tstamdrain\t\t10\t10\tswing2\t\t20\t20\tdmg%\t\t140\t140\tskill\t127\t2\t4\tskill\t151\t1\t3\tdur\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Coldsteel Eye\t155\t100\t1\t\t\t1\t\t39\t31\t9sm\tCutlass\t\t5\t5000\tdgry\t\t\tinvscmu\t\t\t\tstupidity\t\t1\t1\tslow\t\t30\t30\tdeadly\t\t50\t50\tdur\t\t50\t50\tdmg%\t\t200\t250\tswing2\t\t20\t20\tmanasteal\t\t6\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hexfire\t156\t100\t1\t\t\t1\t\t41\t33\t9sb\tShamshir\t\t5\t5000\t\t\t\tinvsbru\t\t\t\tcharged\t62\t36\t6\tignore-ac\t\t1\t1\tres-fire\t\t25\t25\tres-fire-max\t\t10\t10\tdmg-norm\t\t35\t40\tdmg%\t\t140\t160\tfireskill\t\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blade of Ali Baba\t157\t100\t1\t\t\t1\t\t43\t35\t9fc\tTulwar\t\t5\t5000\tcred\tcred\t\t\t\t\t\tsock\t3\t\t\tgold%/lvl\t20\t\t\tmag%/lvl\t8\t\t\tmana\t\t15\t15\tdmg%\t\t60\t120\tdex\t\t5\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ginther's Rift\t158\t100\t1\t\t\t1\t\t45\t37\t9cr\tDimensional Blade\t\t5\t5000\tcblu\t\t\tinv9cru\t\t\t\tred-mag\t\t7\t12\tswing2\t\t30\t30\trep-dur\t20\t\t\tdur\t\t40\t40\tdmg-mag\t\t50\t120\tdmg%\t\t100\t150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Headstriker\t159\t100\t1\t\t\t1\t\t47\t39\t9bs\tBattle Sword\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tnoheal\t\t1\t1\tstr\t\t15\t15\tdeadly/lvl\t12\t\t\tdmg/lvl\t8\t\t\tdmg%\t\t150\t150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Plague Bearer\t160\t100\t1\t\t\t1\t\t49\t41\t9ls\tRune Sword\t\t5\t5000\t\t\t\tinv9lsu\t\t\t\thit-skill\t92\t5\t4\tdmg-pois\t200\t384\t384\tdmg-norm\t\t10\t45\tdmg%\t\t150\t150\tres-pois\t\t45\t45\tskill\t238\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Atlantian\t161\t100\t1\t\t\t1\t\t50\t42\t9wd\tAncient Sword\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tdur\t\t100\t100\tac\t\t75\t75\tstr\t\t16\t16\tdex\t\t12\t12\tvit\t\t8\t8\tdmg%\t\t200\t250\tpal\t\t2\t2\tatt%\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Crainte Vomir\t162\t100\t1\t\t\t1\t\t50\t42\t92h\tEspadon\t\t5\t5000\tlgld\t\t\tinv2hsu\t\t\t\tslow\t\t35\t35\tdmg-ac\t\t-70\t-70\tmove2\t\t20\t20\tred-dmg%\t\t10\t10\tdmg%\t\t160\t200\tswing3\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bing Sz Wang\t163\t100\t1\t\t\t1\t\t51\t43\t9cm\tDacian Falx\t\t5\t5000\t\t\t\t\t\t\t\tease\t\t-30\t-30\tdmg-cold\t75\t50\t140\tstr\t\t20\t20\tfreeze\t\t2\t2\thit-skill\t64\t5\t3\tdmg%\t\t130\t160\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Vile Husk\t164\t100\t1\t\t\t1\t\t52\t44\t9gs\tTusk Sword\t\t5\t5000\tdgry\tdgry\t\tinvgisu\t\t\t\thit-skill\t66\t6\t1\tdmg-und/lvl\t60\t\t\tres-pois\t\t50\t50\tdmg-pois\t150\t426\t426\tdmg%\t\t150\t200\tatt-und/lvl\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Cloudcrack\t165\t100\t1\t\t\t1\t\t53\t45\t9b9\tGothic Sword\t\t5\t5000\t\t\t\tinvbswu\t\t\t\thit-skill\t121\t6\t7\tdmg-ltng\t\t1\t240\tac\t\t30\t30\tlight\t\t2\t2\tres-ltng-max\t\t10\t10\tdmg%\t\t150\t200\tlight-thorns\t\t15\t15\tskilltab\t10\t2\t2\tskilltab\t11\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Todesfaelle Flamme\t166\t100\t1\t\t\t1\t\t54\t46\t9fb\tZweihander\t\t5\t5000\t\t\t\tinv9fbu\t\t\t\tdmg-fire\t\t50\t200\tres-fire\t\t40\t40\tabs-fire\t\t10\t10\tatt-skill\t47\t10\t6\tdmg%\t\t120\t160\tcharged\t52\t45\t10\tcharged\t51\t20\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Swordguard\t167\t100\t1\t\t\t1\t\t55\t48\t9gd\tExecutioner Sword\t\t5\t5000\tbwht\tbwht\t\tinvgsdu\t\t\t\tease\t\t-50\t-50\tac/lvl\t40\t\t\tres-all\t\t10\t20\tac-miss\t\t100\t100\tdmg-to-mana\t\t30\t30\tdmg%\t\t170\t180\tac-hth\t\t200\t200\tbalance2\t\t20\t20\tblock\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Spineripper\t168\t100\t1\t\t\t1\t\t40\t32\t9dg\tPoignard\t\t5\t5000\t\t\t\t\t\t\t\tignore-ac\t\t1\t1\tlifesteal\t\t8\t8\tnoheal\t\t1\t1\tswing3\t\t15\t15\tdex\t\t10\t10\tdmg%\t\t200\t240\tdmg-norm\t\t15\t27\tnec\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Heart Carver\t169\t100\t1\t\t\t1\t\t44\t36\t9di\tRondel\t\t5\t5000\t\t\t\t\t\t\t\tdeadly\t\t35\t35\tignore-ac\t\t1\t1\tdmg-norm\t\t15\t35\tdmg%\t\t190\t240\tskill\t131\t4\t4\tskill\t142\t4\t4\tskill\t150\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blackbog's Sharp\t170\t100\t1\t\t\t1\t\t46\t38\t9kr\tCinquedeas\t\t5\t5000\t\t\t\tinvkrsu\t\t\t\tslow\t\t50\t50\tac\t\t50\t50\tdmg-norm\t\t15\t45\tswing3\t\t30\t30\tdmg-pois\t250\t500\t500\tskill\t73\t5\t5\tskill\t83\t4\t4\tskill\t92\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stormspike\t171\t100\t1\t\t\t1\t\t49\t41\t9bl\tStilleto\t\t5\t5000\tcblu\tcblu\t\tinv9blu\t\t\t\tdmg-ltng\t\t1\t120\tlight-thorns\t\t20\t20\tgethit-skill\t38\t25\t3\tdmg%\t\t150\t150\tres-ltng/lvl\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Impaler\t172\t100\t1\t\t\t1\t\t39\t31\t9sr\tWar Spear\t\t5\t5000\tlred\tlred\t\t\t\t\t\tignore-ac\t\t1\t1\tatt\t\t150\t150\tswing2\t\t20\t20\topenwounds\t\t40\t40\tnoheal\t\t1\t1\tdmg%\t\t140\t170\tskill\t19\t5\t5\tskill\t14\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Kelpie Snare\t173\t100\t1\t\t\t1\t\t41\t33\t9tr\tFuscina\t\t5\t5000\t\t\t\tinvtriu\t\t\t\tslow\t\t75\t75\tres-fire\t\t50\t50\thp/lvl\t10\t\t\tdmg-norm\t\t30\t50\tstr\t\t10\t10\tdmg%\t\t140\t180\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Soulfeast Tine\t174\t100\t1\t\t\t1\t\t43\t35\t9br\tWar Fork\t\t5\t5000\tlyel\tlyel\t\tinv9bru\t\t\t\tease\t\t-20\t-20\tlifesteal\t\t7\t7\tmanasteal\t\t7\t7\tstamdrain\t\t20\t20\tdmg%\t\t150\t190\tatt\t\t150\t250\tdur\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hone Sundan\t175\t100\t1\t\t\t1\t\t45\t37\t9st\tYari\t\t5\t5000\t\t\t\t\t\t\t\tsock\t3\t\t\tdmg-norm\t\t20\t40\tcrush\t\t45\t45\trep-dur\t10\t\t\tdmg%\t\t160\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Spire of Honor\t176\t100\t1\t\t\t1\t\t47\t39\t9p9\tLance\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tatt%\t\t25\t25\tlight\t\t3\t3\tregen\t\t20\t20\tbalance2\t\t20\t20\tdmg-norm\t\t20\t40\tdmg-dem/lvl\t12\t\t\tdmg%\t\t150\t200\tskilltab\t9\t3\t3\tac%\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Meat Scraper\t177\t100\t1\t\t\t1\t\t49\t41\t9b7\tLochaber Axe\t\t5\t5000\tdred\tdred\t\t\t\t\t\tdmg%\t\t150\t200\tswing2\t\t30\t30\tlifesteal\t\t10\t10\topenwounds\t\t50\t50\tmag%\t\t25\t25\tskilltab\t13\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blackleach Blade\t178\t100\t1\t\t\t1\t\t50\t42\t9vo\tBill\t\t5\t5000\tblac\tblac\t\t\t\t\t\tease\t\t-25\t-25\thit-skill\t72\t5\t5\tlight\t\t-2\t-2\tlifesteal\t\t8\t8\tdmg/lvl\t10\t\t\tdmg%\t\t100\t140\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Athena's Wrath\t179\t100\t1\t\t\t1\t\t50\t42\t9s8\tBattle Scythe\t\t5\t5000\t\t\t\tinv9s8u\t\t\t\tdru\t\t1\t3\tdex\t\t15\t15\tswing2\t\t30\t30\thp/lvl\t8\t\t\tdmg/lvl\t8\t\t\tdmg%\t\t150\t180\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Pierre Tombale Couant\t180\t100\t1\t\t\t1\t\t51\t43\t9pa\tPartizan\t\t5\t5000\tlgld\tlgld\t\t\t\t\t\tdeadly\t\t55\t55\tbar\t\t3\t3\tbalance2\t\t30\t30\tmanasteal\t\t6\t6\tdmg-norm\t\t12\t20\tdmg%\t\t160\t220\tatt\t\t100\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Husoldal Evo\t181\t100\t1\t\t\t1\t\t52\t44\t9h9\tBec-de-Corbin\t\t5\t5000\t\t\t\t\t\t\t\tregen\t\t20\t20\tatt\t\t200\t250\tnoheal\t\t1\t1\tdmg-norm\t\t20\t32\tdmg%\t\t160\t200\tswing2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Grim's Burning Dead\t182\t100\t1\t\t\t1\t\t52\t45\t9wc\tGrim Scythe\t\t5\t5000\tcred\tcred\t\t\t\t\t\tdmg-fire\t\t131\t232\tres-fire\t\t45\t45\tdmg%\t\t140\t180\tthorns\t\t8\t8\tease\t\t-50\t-50\tnec\t\t3\t3\treduce-ac\t\t50\t50\tac%\t\t20\t20\tatt\t\t200\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Razorswitch\t183\t100\t1\t\t\t1\t\t36\t28\t8ss\tJo Stalf\t\t5\t5000\tlpur\t\t\t\t\t\t\tcast3\t\t30\t30\tthorns\t\t15\t15\tmana\t\t175\t175\thp\t\t80\t80\tred-mag\t\t15\t15\tres-all\t\t50\t50\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ribcracker\t184\t100\t1\t\t\t1\t\t39\t31\t8ls\tQuarterstaff\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tdmg-norm\t\t30\t65\tdmg%\t\t200\t300\tcrush\t\t50\t50\tdex\t\t15\t15\tac\t\t100\t100\tac%\t\t100\t100\tbalance2\t\t50\t50\tswing2\t\t50\t50\tdur\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Chromatic Ire\t185\t100\t1\t\t\t1\t\t43\t35\t8cs\tCedar Staff\t\t5\t5000\t\t\t\tinvcstu\t\t\t\tsor\t\t3\t3\tres-all\t\t20\t40\tcast1\t\t20\t20\tlight-thorns\t\t20\t20\thp%\t\t20\t25\tskill\t61\t1\t1\tskill\t63\t1\t1\tskill\t65\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Warpspear\t186\t100\t1\t\t\t1\t\t47\t39\t8bs\tGothic Staff\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tsor\t\t3\t3\tignore-ac\t\t1\t1\tskill\t54\t3\t3\tskill\t43\t3\t3\tskill\t58\t3\t3\tac-miss\t\t250\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Skullcollector\t187\t100\t1\t\t\t1\t\t49\t41\t8ws\tRune Staff\t\t5\t5000\tblac\tblac\t\tinv8wsu\t\t\t\tmana%\t\t20\t20\tmana-kill\t\t20\t20\tallskills\t\t2\t2\tmag%/lvl\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Skystrike\t188\t100\t1\t\t\t1\t\t36\t28\t8sb\tEdge Bow\t\t5\t5000\t\t\t\t\t\t\t\tdmg-ltng\t\t1\t250\tatt\t\t100\t100\tenr\t\t10\t10\tswing3\t\t30\t30\tdmg%\t\t150\t200\thit-skill\t56\t2\t6\tama\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Riphook\t189\t100\t1\t\t\t1\t\t39\t31\t8hb\tRazor Bow\t\t5\t5000\tcred\tcred\t\t\t\t\t\topenwounds\t\t30\t30\tdmg%\t\t180\t220\tslow\t\t30\t30\tmana\t\t35\t35\tswing2\t\t30\t30\tlifesteal\t\t7\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Kuko Shakaku\t190\t100\t1\t\t\t1\t\t41\t33\t8lb\tCedarBow\t\t5\t5000\tlpur\tlpur\t\tinv8lbu\t\t\t\tskill\t27\t3\t3\texplosivearrow\t\t7\t7\tdmg%\t\t150\t180\tpierce\t\t50\t50\tdmg-fire\t\t40\t180\tskilltab\t0\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Endlesshail\t191\t100\t1\t\t\t1\t\t44\t36\t8cb\tDouble Bow\t\t5\t5000\t\t\t\tinvcbwu\t\t\t\tres-cold\t\t35\t35\tmana\t\t40\t40\tac-miss\t\t50\t50\tskill\t26\t3\t5\tdmg%\t\t180\t220\tdmg-cold\t75\t15\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Whichwild String\t192\t100\t1\t\t\t1\t\t47\t39\t8s8\tShort Siege Bow\t\t5\t5000\tlblu\tlblu\t\tinv8s8u\t\t\t\thit-skill\t66\t2\t5\tres-all\t\t40\t40\tdeadly/lvl\t8\t\t\tdmg%\t\t150\t170\tmagicarrow\t\t20\t20\tsock\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Cliffkiller\t193\t100\t1\t\t\t1\t\t49\t41\t8l8\tLong Siege Bow\t\t5\t5000\tdgld\t\t\t\t\t\t\tama\t\t2\t2\tdmg%\t\t190\t230\tac-miss\t\t80\t80\tknock\t\t1\t1\thp\t\t50\t50\tdmg-min\t\t5\t10\tdmg-max\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Magewrath\t194\t100\t1\t\t\t1\t\t51\t43\t8sw\tRune Bow\t\t5\t5000\toran\t\t\tinvswbu\t\t\t\tmanasteal\t\t15\t15\tred-mag\t\t9\t13\tskill\t22\t3\t3\tatt\t\t200\t250\tdex\t\t10\t10\tstupidity\t\t1\t1\tdmg-norm\t\t25\t50\tdmg%\t\t120\t150\tama\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Godstrike Arch\t195\t100\t1\t\t\t1\t\t54\t46\t8lw\tGothic Bow\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tdmg%\t\t200\t250\tatt%\t\t100\t150\tdmg-undead\t\t100\t200\tdmg-demon\t\t100\t200\thit-skill\t121\t5\t7\tswing2\t\t50\t50\tregen\t\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Langer Briser\t196\t100\t1\t\t\t1\t\t40\t32\t8lx\tArbalest\t\t5\t5000\t\t\t\tinv8lxu\t\t\t\tknock\t\t1\t1\tdmg%\t\t170\t200\tmag%\t\t30\t60\thp\t\t30\t30\tdmg-max\t\t10\t30\topenwounds\t\t33\t33\tdmg-ltng\t\t1\t212\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Pus Spiter\t197\t100\t1\t\t\t1\t\t44\t36\t8mx\tSiege Crossbow\t\t5\t5000\tcgrn\tcgrn\t\tinv8mxu\t\t\t\tdmg-pois\t200\t192\t192\thit-skill\t91\t4\t1\tnec\t\t2\t2\tease\t\t-60\t-60\tgethit-skill\t92\t9\t6\tswing2\t\t10\t10\tdmg%\t\t150\t220\tatt/lvl\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Buriza-Do Kyanon\t198\t100\t1\t\t\t1\t\t59\t41\t8hx\tBalista\t\t5\t5000\t\t\t\tinvhxbu\t\t\t\tpierce\t\t100\t100\tdex\t\t35\t35\tac\t\t75\t150\tdmg/lvl\t20\t\t\tswing2\t\t80\t80\tdmg%\t\t150\t200\tfreeze\t\t3\t3\tdmg-cold\t200\t32\t196\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Demon Machine\t199\t100\t1\t\t\t1\t\t57\t49\t8rx\tChu-Ko-Nu\t\t5\t5000\tblac\tblac\t\tinvrxbu\t\t\t\tac\t\t321\t321\tmana\t\t36\t36\tpierce\t\t66\t66\texplosivearrow\t\t6\t6\tdmg-max\t\t66\t66\tdmg%\t\t123\t123\tatt\t\t632\t632\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Armor\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Peasent Crown\t201\t100\t1\t\t\t1\t\t36\t28\txap\tWar Hat\t\t3\t5000\tlgry\t\t\t\t\t\t\tenr\t\t20\t20\tvit\t\t20\t20\tallskills\t\t1\t1\tmove2\t\t15\t15\tregen\t\t6\t12\tac%\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rockstopper\t202\t100\t1\t\t\t1\t\t39\t31\txkp\tSallet\t\t3\t5000\t\t\t\tinvxkpu\t\t\t\tres-ltng\t\t20\t40\tred-dmg%\t\t10\t10\tbalance2\t\t30\t30\tac%\t\t160\t220\tres-fire\t\t20\t50\tres-cold\t\t20\t40\tvit\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stealskull\t203\t100\t1\t\t\t1\t\t43\t35\txlm\tCasque\t\t3\t5000\t\t\t\tinvhlmu\t\t\t\tmanasteal\t\t5\t5\tlifesteal\t\t5\t5\tbalance2\t\t10\t10\tswing2\t\t10\t10\tac%\t\t200\t240\tmag%\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Darksight Helm\t204\t100\t1\t\t\t1\t\t46\t38\txhl\tBasinet\t\t3\t5000\tblac\tblac\t\tinvfhlu\t\t\t\tlight\t\t-4\t-4\tac/lvl\t16\t\t\tnofreeze\t\t1\t1\tmanasteal\t\t5\t5\tgethit-skill\t71\t6\t3\tcharged\t264\t30\t5\tres-fire\t\t20\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Valkiry Wing\t205\t100\t1\t\t\t1\t\t52\t44\txhm\tWinged Helm\t\t3\t5000\tlgld\t\t\t\t\t\t\tac%\t\t150\t200\tmove2\t\t20\t20\tbalance2\t\t20\t20\tama\t\t1\t2\tmana-kill\t\t2\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Crown of Thieves\t206\t100\t1\t\t\t1\t\t57\t49\txrn\tGrand Crown\t\t3\t5000\tdgld\tdgld\t\tinvxrnu\t\t\t\tdex\t\t25\t25\tlifesteal\t\t9\t12\thp\t\t50\t50\tmana\t\t35\t35\tres-fire\t\t33\t33\tac%\t\t160\t200\tgold%\t\t80\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blackhorn's Face\t207\t100\t1\t\t\t1\t\t49\t41\txsk\tDeath Mask\t\t3\t5000\tblac\tblac\t\t\t\t\t\tlight-thorns\t\t25\t25\tslow\t\t20\t20\tnoheal\t\t1\t1\tabs-ltng\t\t20\t20\tres-ltng\t\t15\t15\tac%\t\t180\t220\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Vampiregaze\t208\t100\t1\t\t\t1\t\t49\t41\txh9\tGrim Helm\t\t3\t5000\tcgrn\tcgrn\t\tinvbhmu\t\t\t\tmanasteal\t\t6\t8\tlifesteal\t\t6\t8\tstamdrain\t\t15\t15\tred-dmg%\t\t15\t20\tred-mag\t\t10\t15\tac%\t\t100\t100\tdmg-cold\t100\t6\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Spirit Shroud\t209\t100\t1\t\t\t1\t\t36\t28\txui\tGhost Armor\t\t3\t5000\t\t\t\t\t\t\t\tnofreeze\t\t1\t1\tallskills\t\t1\t1\tred-mag\t\t7\t11\tregen\t\t10\t10\tac%\t\t150\t150\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Skin of the Vipermagi\t210\t100\t1\t\t\t1\t\t37\t29\txea\tSerpentSkin Armor\t\t3\t5000\tdblu\tdblu\t\t\t\t\t\tac%\t\t120\t120\tres-all\t\t20\t35\tcast3\t\t30\t30\tred-mag\t\t9\t13\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Skin of the Flayerd One\t211\t100\t1\t\t\t1\t\t39\t31\txla\tDemonhide Armor\t\t3\t5000\tlred\tlred\t\t\t\t\t\trep-dur\t10\t\t\tregen\t\t15\t25\tdur\t\t30\t30\tlifesteal\t\t5\t7\tac%\t\t150\t190\tthorns\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ironpelt\t212\t100\t1\t\t\t1\t\t41\t33\txtu\tTresllised Armor\t\t3\t5000\tdgry\tdgry\t\tinvxtuu\t\t\t\tdur\t\t125\t125\thp\t\t25\t25\tred-mag\t\t10\t16\tred-dmg\t\t15\t20\tac/lvl\t24\t\t\tac%\t\t50\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Spiritforge\t213\t100\t1\t\t\t1\t\t43\t35\txng\tLinked Mail\t\t3\t5000\t\t\t\t\t\t\t\tlight\t\t4\t4\thp/lvl\t10\t\t\tdmg-fire\t\t20\t65\tres-fire\t\t5\t5\tac%\t\t120\t160\tstr\t\t15\t15\tsock\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Crow Caw\t214\t100\t1\t\t\t1\t\t45\t37\txcl\tTigulated Mail\t\t3\t5000\t\t\t\t\t\t\t\topenwounds\t\t35\t35\tac%\t\t150\t180\tdex\t\t15\t15\tbalance2\t\t15\t15\tswing2\t\t15\t15\t*charged\t221\t3\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Shaftstop\t215\t100\t1\t\t\t1\t\t46\t38\txhn\tMesh Armor\t\t3\t5000\tdgry\t\t\t\t\t\t\tac-miss\t\t250\t250\tred-dmg%\t\t30\t30\thp\t\t60\t60\tac%\t\t180\t220\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Duriel's Shell\t216\t100\t1\t\t\t1\t\t49\t41\txrs\tCuirass\t\t3\t5000\toran\toran\t\t\t\t\t\tstr\t\t15\t15\tac/lvl\t10\t\t\thp/lvl\t8\t\t\tac%\t\t160\t200\tres-fire\t\t20\t20\tres-ltng\t\t20\t20\tres-pois\t\t20\t20\tres-cold\t\t50\t50\tnofreeze\t\t1\t1\tdur\t\t100\t100\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Skullder's Ire\t217\t100\t1\t\t\t1\t\t50\t42\txpl\tRusset Armor\t\t3\t5000\t\t\t\t\t\t\t\tallskills\t\t1\t1\tmag%/lvl\t10\t\t\tac%\t\t160\t200\tdur\t\t60\t60\tred-mag\t\t10\t10\trep-dur\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Guardian Angel\t218\t100\t1\t\t\t1\t\t53\t45\txlt\tTemplar Coat\t\t3\t5000\tlgry\tlgry\t\t\t\t\t\tlight\t\t4\t4\tpal\t\t1\t1\tac%\t\t180\t200\tblock2\t\t30\t30\tres-all-max\t\t15\t15\tatt-dem/lvl\t5\t\t\tblock\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Toothrow\t219\t100\t1\t\t\t1\t\t56\t48\txld\tSharktooth Armor\t\t3\t5000\twhit\twhit\t\t\t\t\t\tthorns\t\t20\t40\tac\t\t40\t60\tstr\t\t10\t10\topenwounds\t\t40\t40\tres-fire\t\t15\t15\tac%\t\t160\t220\tdur\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Atma's Wail\t220\t100\t1\t\t\t1\t\t59\t51\txth\tEmbossed Plate\t\t3\t5000\t\t\t\t\t\t\t\tdex\t\t15\t15\tregen\t\t10\t10\tmana%\t\t15\t15\tbalance2\t\t30\t30\tac/lvl\t16\t\t\tdur\t\t50\t50\tac%\t\t120\t160\tmag%\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Black Hades\t221\t100\t1\t\t\t1\t\t61\t53\txul\tChaos Armor\t\t3\t5000\t\t\t\t\t\t\t\tlight\t\t-2\t-2\tatt-demon\t\t200\t250\thalf-freeze\t\t1\t1\tsock\t3\t\t\tac%\t\t140\t200\tdmg-demon\t\t30\t60\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Corpsemourn\t222\t100\t1\t\t\t1\t\t63\t55\txar\tOrnate Armor\t\t3\t5000\tblac\tblac\t\tinvxaru\t\t\t\tstr\t\t8\t8\tvit\t\t10\t10\tres-cold\t\t35\t35\tgethit-skill\t76\t6\t2\tac%\t\t150\t180\tdmg-fire\t\t12\t36\tcharged\t74\t40\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Que-Hegan's Wisdon\t223\t100\t1\t\t\t1\t\t59\t51\txtp\tMage Plate\t\t3\t5000\t\t\t\t\t\t\t\tcast2\t\t20\t20\tmana-kill\t\t3\t3\tred-mag\t\t6\t10\tenr\t\t15\t15\tbalance2\t\t20\t20\tac%\t\t140\t160\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Visceratuant\t224\t100\t1\t\t\t1\t\t36\t28\txuc\tDefender\t\t3\t5000\tdred\t\t\tinvbucu\t\t\t\tsor\t\t1\t1\tblock2\t\t30\t30\tblock\t\t30\t30\tac%\t\t100\t150\tlight-thorns\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Mosers Blessed Circle\t225\t100\t1\t\t\t1\t\t39\t31\txml\tRound Shield\t\t3\t5000\t\t\t\tinvxmlu\t\t\t\tres-all\t\t25\t25\tblock\t\t25\t25\tsock\t2\t\t\tac%\t\t180\t220\tblock2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stormchaser\t226\t100\t1\t\t\t1\t\t43\t35\txrg\tScutum\t\t3\t5000\tcblu\tcblu\t\tinvxrgu\t\t\t\tdmg-ltng\t\t1\t60\tblock\t\t20\t20\thalf-freeze\t\t1\t1\tres-ltng\t\t50\t50\tatt\t\t150\t150\tac%\t\t160\t220\tblock2\t\t10\t10\tgethit-skill\t59\t4\t6\tgethit-skill\t245\t4\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Tiamat's Rebuke\t227\t100\t1\t\t\t1\t\t46\t38\txit\tDragon Shield\t\t3\t5000\tlgry\tlgry\t\tinvkitu\t\t\t\tdmg-cold\t150\t27\t53\tdmg-fire\t\t35\t95\tdmg-ltng\t\t1\t120\tres-all\t\t25\t35\tac%\t\t140\t200\tgethit-skill\t44\t5\t9\tgethit-skill\t48\t5\t7\tgethit-skill\t62\t3\t6\tdur\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Kerke's Sanctuary\t228\t100\t1\t\t\t1\t\t52\t44\txow\tPavise\t\t3\t5000\tlgrn\tlgrn\t\tinvtowu\t\t\t\tred-dmg\t\t11\t16\tred-mag\t\t14\t18\tregen\t\t15\t15\tac%\t\t180\t240\tdur\t\t100\t100\tblock\t\t30\t30\tres-all\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Radimant's Sphere\t229\t100\t1\t\t\t1\t\t58\t50\txts\tAncient Shield\t\t3\t5000\t\t\t\tinvgtsu\t\t\t\tdmg-pois\t100\t204\t204\tgethit-skill\t92\t5\t5\tres-pois\t\t75\t75\tac%\t\t160\t200\tblock\t\t20\t20\tblock2\t\t20\t20\tcharged\t83\t40\t6\tdur\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lidless Wall\t230\t100\t1\t\t\t1\t\t49\t41\txsh\tGrim Shield\t\t3\t5000\tdgld\tdgld\t\tinvxshu\t\t\t\tlight\t\t1\t1\tallskills\t\t1\t1\tcast2\t\t20\t20\tmana-kill\t\t3\t5\tac%\t\t80\t130\tenr\t\t10\t10\tmana%\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lance Guard\t231\t100\t1\t\t\t1\t\t43\t35\txpk\tBarbed Shield\t\t3\t5000\t\t\t\tinvxpku\t\t\t\thp\t\t50\t50\tbalance2\t\t30\t30\tdmg-to-mana\t\t15\t15\tthorns\t\t47\t47\tac%\t\t70\t120\tdeadly\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Venom Grip\t232\t100\t1\t\t\t1\t\t37\t29\txlg\tDemonhide Gloves\t\t5\t5000\tdgrn\t\t\t\t\t\t\tres-pois\t\t30\t30\tres-pois-max\t\t5\t5\tdmg-pois\t100\t153\t153\tcrush\t\t5\t5\tlifesteal\t\t5\t5\tac\t\t15\t25\tac%\t\t130\t160\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gravepalm\t233\t100\t1\t\t\t1\t\t39\t32\txvg\tSharkskin Gloves\t\t5\t5000\t\t\t\t\t\t\t\tenr\t\t10\t10\tstr\t\t10\t10\tdmg-undead\t\t100\t200\tatt-undead\t\t100\t200\tac%\t\t140\t180\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ghoulhide\t234\t100\t1\t\t\t1\t\t44\t36\txmg\tHeavy Bracers\t\t5\t5000\t\t\t\t\t\t\t\tatt-und/lvl\t16\t\t\tdmg-und/lvl\t16\t\t\tmanasteal\t\t4\t5\thp\t\t20\t20\tac%\t\t150\t190\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lavagout\t235\t100\t1\t\t\t1\t\t50\t42\txtg\tBattle Guantlets\t\t5\t5000\tlyel\t\t\t\t\t\t\tres-fire\t\t24\t24\thalf-freeze\t\t1\t1\thit-skill\t52\t2\t10\tswing2\t\t20\t20\tac%\t\t150\t200\tdmg-fire\t\t13\t46\tdur\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hellmouth\t236\t100\t1\t\t\t1\t\t55\t47\txhg\tWar Gauntlets\t\t5\t5000\t\t\t\t\t\t\t\tdmg-fire\t\t15\t72\tabs-fire\t\t15\t15\tac%\t\t150\t200\tdur\t\t15\t15\thit-skill\t56\t2\t4\thit-skill\t225\t4\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Infernostride\t237\t100\t1\t\t\t1\t\t37\t29\txlb\tDemonhide Boots\t\t5\t5000\t\t\t\t\t\t\t\tdmg-fire\t\t12\t33\tmove2\t\t20\t20\tres-fire-max\t\t10\t10\tres-fire\t\t30\t30\tlight\t\t2\t2\tac%\t\t120\t150\tgold%\t\t40\t70\tac\t\t15\t15\tgethit-skill\t46\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Waterwalk\t238\t100\t1\t\t\t1\t\t40\t32\txvb\tSharkskin Boots\t\t5\t5000\t\t\t\t\t\t\t\tac-miss\t\t100\t100\tmove2\t\t20\t20\tdex\t\t15\t15\tac%\t\t180\t210\thp\t\t45\t65\tstam\t\t40\t40\tres-fire-max\t\t5\t5\tregen-stam\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Silkweave\t239\t100\t1\t\t\t1\t\t44\t36\txmb\tMesh Boots\t\t5\t5000\t\t\t\t\t\t\t\tac%\t\t150\t190\tmana-kill\t\t5\t5\tac-miss\t\t200\t200\tmana%\t\t10\t10\tmove2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Wartraveler\t240\t100\t1\t\t\t1\t\t50\t42\txtb\tBattle Boots\t\t5\t5000\t\t\t\t\t\t\t\tvit\t\t10\t10\tstr\t\t10\t10\tmag%\t\t30\t50\tdur\t\t30\t30\tmove2\t\t25\t25\tac%\t\t150\t190\tdmg-norm\t\t15\t25\tthorns\t\t5\t10\tstamdrain\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gorerider\t241\t100\t1\t\t\t1\t\t55\t47\txhb\tWar Boots\t\t5\t5000\tdred\t\t\t\t\t\t\tease\t\t-25\t-25\tdeadly\t\t15\t15\tmove2\t\t30\t30\tcrush\t\t15\t15\topenwounds\t\t10\t10\tac%\t\t160\t200\tdur\t\t10\t10\tstam\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"String of Ears\t242\t100\t1\t\t\t1\t\t37\t29\tzlb\tDemonhide Sash\t\t5\t5000\tlred\t\t\t\t\t\t\tred-mag\t\t10\t15\tred-dmg%\t\t10\t15\tlifesteal\t\t6\t8\tac%\t\t150\t180\tac\t\t15\t15\tdur\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Razortail\t243\t100\t1\t\t\t1\t\t39\t32\tzvb\tSharkskin Belt\t\t5\t5000\t\t\t\t\t\t\t\tthorns/lvl\t8\t\t\tdex\t\t15\t15\tpierce\t\t33\t33\tac\t\t15\t15\tac%\t\t120\t150\tdmg-max\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gloomstrap\t244\t100\t1\t\t\t1\t\t45\t36\tzmb\tMesh Belt\t\t5\t5000\t\t\t\t\t\t\t\tlight\t\t-3\t-3\tmana%\t\t15\t15\tmanasteal\t\t5\t5\tac%\t\t120\t150\tvit\t\t15\t15\tregen-mana\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Snowclash\t245\t100\t1\t\t\t1\t\t49\t42\tztb\tBattle Belt\t\t5\t5000\t\t\t\t\t\t\t\tgethit-skill\t59\t5\t0\tabs-cold\t\t15\t15\tres-cold-max\t\t15\t15\tdmg-cold\t75\t13\t21\tac%\t\t130\t170\tskill\t59\t2\t2\tskill\t55\t3\t3\tskill\t60\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Thudergod's Vigor\t246\t100\t1\t\t\t1\t\t55\t47\tzhb\tWar Belt\t\t5\t5000\t\t\t\t\t\t\t\tgethit-skill\t121\t5\t7\tdmg-ltng\t\t1\t50\tres-ltng-max\t\t10\t10\tabs-ltng\t\t20\t20\tac%\t\t160\t200\tvit\t\t20\t20\tstr\t\t20\t20\tskill\t34\t3\t3\tskill\t35\t3\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Elite Uniques\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Harlequin Crest\t248\t100\t1\t\t\t1\t\t69\t62\tuap\tShako\t\t3\t5000\tcgrn\tcgrn\t\t\t\t\t\tallskills\t\t2\t2\thp/lvl\t12\t\t\tmana/lvl\t12\t\t\tmag%\t\t50\t50\tred-dmg%\t\t10\t10\tstr\t\t2\t2\tdex\t\t2\t2\tvit\t\t2\t2\tenr\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Veil of Steel\t249\t100\t1\t\t\t1\t\t77\t73\tuhm\tSpired Helm\t\t3\t5000\tlgry\tlgry\t\t\t\t\t\tres-all\t\t50\t50\tac%\t\t60\t60\tstr\t\t15\t15\tvit\t\t15\t15\tlight\t\t-4\t-4\tdur\t\t20\t20\tac\t\t140\t140\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Gladiator's Bane\t250\t100\t1\t\t\t1\t\t85\t85\tutu\tWire Fleece\t\t3\t5000\tlgry\tlgry\t\t\t\t\t\tac%\t\t150\t200\tred-mag\t\t15\t20\tred-dmg\t\t15\t20\tthorns\t\t20\t20\tres-pois-len\t\t50\t50\tdur\t\t103\t103\tbalance2\t\t30\t30\tac\t\t50\t50\tnofreeze\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Arkaine's Valor\t251\t100\t1\t\t\t1\t\t85\t85\tupl\tBalrog Skin\t\t3\t5000\tlred\tlred\t\t\t\t\t\tac%\t\t150\t180\tbalance2\t\t30\t30\tallskills\t\t1\t2\tred-dmg\t\t10\t15\tvit/lvl\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Blackoak Shield\t252\t100\t1\t\t\t1\t\t67\t61\tuml\tLuna\t\t3\t5000\t\t\t\tinvsmlu\t\t\t\tdex/lvl\t4\t\t\tac%\t\t160\t200\tabs-cold/lvl\t5\t\t\tgethit-skill\t72\t4\t5\tdur\t\t45\t45\thp/lvl\t10\t\t\tblock2\t\t50\t50\thalf-freeze\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stormshield\t253\t100\t1\t\t\t1\t\t77\t73\tuit\tMonarch\t\t3\t5000\t\t\t\tinvkitu\t\t\t\tac/lvl\t30\t\t\tred-dmg%\t\t35\t35\tstr\t\t30\t30\tindestruct\t\t1\t1\tblock2\t\t35\t35\tres-ltng\t\t25\t25\tblock\t\t25\t25\tres-cold\t\t60\t60\tlight-thorns\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hellslayer\t254\t100\t1\t\t\t1\t\t71\t66\t7bt\tDecapitator\t\t5\t5000\tdred\tdred\t\tinvbtxu\t\t\t\tstr/lvl\t4\t\t\tvit/lvl\t4\t\t\tdmg%/lvl\t24\t\t\tdmg-fire\t\t150\t250\thp\t\t25\t25\tdmg%\t\t100\t100\tatt-skill\t47\t10\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Messerschmidt's Reaver\t255\t100\t1\t\t\t1\t\t75\t70\t7ga\tChampion Axe\t\t5\t5000\tblac\tblac\t\tinvgaxu\t\t\t\tdmg%/lvl\t20\t\t\tdmg%\t\t200\t200\tstr\t\t15\t15\tdex\t\t15\t15\tvit\t\t15\t15\tenr\t\t15\t15\tdmg-fire\t\t20\t240\tdur\t\t25\t25\tatt%\t\t100\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Baranar's Star\t256\t100\t1\t\t\t1\t\t70\t65\t7mt\tDevil Star\t\t5\t5000\tlred\tlred\t\tinvmstu\t\t\t\tatt%\t\t200\t200\tdmg%\t\t200\t200\tdex\t\t15\t15\tstr\t\t15\t15\tswing2\t\t50\t50\tdur\t\t100\t100\tdmg-ltng\t\t1\t200\tdmg-fire\t\t1\t200\tdmg-cold\t\t1\t200\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Schaefer's Hammer\t257\t100\t1\t\t\t1\t\t83\t79\t7wh\tLegendary Mallet\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\thit-skill\t42\t20\t10\thp\t\t50\t50\tatt/lvl\t16\t\t\tres-ltng\t\t75\t75\tswing2\t\t20\t20\tdmg/lvl\t16\t\t\tindestruct\t\t1\t1\tdmg%\t\t100\t130\tlight\t\t1\t1\tdmg-ltng\t\t50\t200\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Cranium Basher\t258\t100\t1\t\t\t1\t\t85\t87\t7gm\tThunder Maul\t\t5\t5000\tblac\tblac\t\t\t\t\t\tswing2\t\t20\t20\tindestruct\t\t1\t1\tstr\t\t25\t25\tres-all\t\t25\t25\tcrush\t\t75\t75\tdmg-norm\t\t20\t20\tdmg%\t\t200\t240\thit-skill\t66\t4\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lightsabre\t259\t100\t1\t\t\t5\t\t66\t58\t7cr\tPhase Blade\t\t5\t5000\tlblu\t\t\tinvcrsu\t\t\t\tlight\t\t7\t7\tatt-skill\t53\t5\t0\tignore-ac\t1\t1\t1\tabs-ltng%\t\t25\t25\tswing2\t\t20\t20\tdmg-mag\t\t60\t120\tdmg-ltng\t\t1\t200\tmanasteal\t\t5\t7\tdmg%\t\t150\t200\tdmg-norm\t\t10\t30\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Doombringer\t260\t100\t1\t\t\t1\t\t75\t69\t7b7\tChampion Sword\t\t5\t5000\tdred\tdred\t\tinvbswu\t\t\t\thp%\t\t20\t20\tdmg%\t\t180\t250\tatt%\t\t40\t40\tindestruct\t\t1\t1\tdmg-norm\t\t30\t100\thit-skill\t72\t8\t3\tlifesteal\t\t5\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Grandfather\t261\t100\t1\t\t\t1\t\t85\t81\t7gd\tColossus Blade\t\t5\t5000\tlyel\tlyel\t\tinvgsdu\t\t\t\tstr\t\t20\t20\tdex\t\t20\t20\tvit\t\t20\t20\tenr\t\t20\t20\tatt%\t\t50\t50\thp\t\t80\t80\tdmg/lvl\t20\t\t\tindestruct\t\t1\t1\tdmg%\t\t150\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Wizardspike\t262\t100\t1\t\t\t1\t\t69\t61\t7dg\tBone Knife\t\t5\t5000\tlgry\tlgry\t\t\t\t\t\tmana/lvl\t16\t\t\tregen-mana\t\t15\t15\tmana%\t\t15\t15\tres-all\t\t75\t75\tindestruct\t\t1\t1\tcast3\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Constricting Ring\t263\t100\t0\t\t\t1\t\t95\t95\trin\tRing\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tres-all\t\t100\t100\tregen\t\t-30\t-30\tmag%\t\t100\t100\tres-all-max\t\t15\t15\t\t\t\t\t\t\t\t\t\t0\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stormspire\t264\t100\t1\t\t\t1\t\t78\t70\t7wc\tGiant Thresher\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tres-ltng\t\t50\t50\tgethit-skill\t53\t5\t5\tdmg%\t\t150\t250\tstr\t\t10\t10\tgethit-skill\t38\t2\t0\tswing2\t\t30\t30\tindestruct\t\t1\t1\tdmg-ltng\t\t1\t237\tlight-thorns\t\t27\t27\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Eaglehorn\t265\t100\t1\t\t\t1\t\t77\t69\t6l7\tCrusader Bow\t\t5\t5000\tdgld\tdgld\t\t\t\t\t\tignore-ac\t\t1\t1\tatt/lvl\t12\t\t\tdmg%/lvl\t16\t\t\tdmg%\t\t200\t200\tama\t\t1\t1\tdex\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Windforce\t266\t100\t1\t\t\t1\t\t80\t73\t6lw\tHydra Bow\t\t5\t5000\tdyel\tdyel\t\t\t\t\t\tdex\t\t5\t5\tdmg/lvl\t25\t\t\tregen-stam\t\t30\t30\tmanasteal\t\t6\t8\tknock\t\t1\t1\tdmg%\t\t250\t250\tswing2\t\t20\t20\tstr\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rings\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bul Katho's Wedding Band\t268\t100\t1\t\t\t1\t\t66\t58\trin\tRing\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\thp/lvl\t4\t\t\tallskills\t\t1\t1\tlifesteal\t\t3\t5\tstam\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Cat's Eye\t269\t100\t1\t\t\t5\t\t58\t50\tamu\tAmulet\t\t5\t5000\toran\toran\t\t\t\t\t\tmove2\t\t30\t30\tswing2\t\t20\t20\tac\t\t100\t100\tac-miss\t\t100\t100\tdex\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Rising Sun\t270\t100\t1\t\t\t5\t\t73\t65\tamu\tAmulet\t\t5\t5000\tlgld\tlgld\t\t\t\t\t\tabs-fire/lvl\t6\t\t\tlight\t\t4\t4\tgethit-skill\t56\t2\t0\tdmg-fire\t\t24\t48\tfireskill\t\t2\t2\tregen\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Crescent Moon\t271\t100\t1\t\t\t5\t\t58\t50\tamu\tAmulet\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tmanasteal\t\t11\t15\tred-mag\t\t10\t10\tdmg-to-mana\t\t10\t10\tlight\t\t-2\t-2\tmana\t\t45\t45\tlifesteal\t\t3\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Mara's Kaleidoscope\t272\t100\t1\t\t\t5\t\t80\t67\tamu\tAmulet\t\t5\t5000\toran\toran\t\t\t\t\t\tallskills\t\t2\t2\tres-all\t\t20\t30\tstr\t\t5\t5\tdex\t\t5\t5\tvit\t\t5\t5\tenr\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Atma's Scarab\t273\t100\t1\t\t\t5\t\t60\t60\tamu\tAmulet\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tdmg-pois\t100\t102\t102\tres-pois\t\t75\t75\tlight\t\t3\t3\tthorns\t\t5\t5\thit-skill\t66\t5\t2\tatt%\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Dwarf Star\t274\t100\t1\t\t\t10\t\t53\t45\trin\tRing\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tgold%\t\t100\t100\tstam\t\t40\t40\tregen-stam\t\t15\t15\thp\t\t40\t40\tred-mag\t\t12\t15\tabs-fire%\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Raven Frost\t275\t100\t1\t\t\t10\t\t53\t45\trin\tRing\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tnofreeze\t\t1\t1\tdmg-cold\t100\t15\t45\tabs-cold%\t\t20\t20\tmana\t\t40\t40\tdex\t\t15\t20\tatt\t\t150\t250\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Highlord's Wrath\t276\t100\t1\t\t\t5\t\t73\t65\tamu\tAmulet\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tres-ltng\t\t35\t35\tdmg-ltng\t\t1\t30\tswing2\t\t20\t20\tallskills\t\t1\t1\tdeadly/lvl\t3\t\t\tlight-thorns\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Saracen's Chance\t277\t100\t1\t\t\t5\t\t55\t47\tamu\tAmulet\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\tres-all\t\t15\t25\tgethit-skill\t76\t10\t2\tstr\t\t12\t12\tdex\t\t12\t12\tenr\t\t12\t12\tvit\t\t12\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Class Specific\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Arreat's Face\t279\t100\t1\t\t\t1\t\t50\t42\tbaa\tSlayer Guard\t\t5\t5000\t\t\t\t\t\t\t\tbar\t\t2\t2\tskilltab\t12\t2\t2\tac%\t\t150\t200\tbalance2\t\t30\t30\tatt%\t\t20\t20\tstr\t\t20\t20\tdex\t\t20\t20\tlifesteal\t\t3\t6\tres-all\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Homunculus\t280\t100\t1\t\t\t1\t\t50\t42\tnea\tHeirophant Trophy\t\t5\t5000\t\t\t\t\t\t\t\tnec\t\t2\t2\tskilltab\t6\t2\t2\tac%\t\t150\t200\tblock2\t\t30\t30\tblock\t\t40\t40\tenr\t\t20\t20\tregen-mana\t\t33\t33\tmana-kill\t\t5\t5\tres-all\t\t40\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Titan's Revenge\t281\t100\t1\t\t\t1\t\t50\t42\tama\tCeremonial Javelin\t\t5\t5000\t\t\t\t\t\t\t\tama\t\t2\t2\tskilltab\t2\t2\t2\tdmg%\t\t150\t200\tmove2\t\t30\t30\trep-quant\t30\t\t\tstr\t\t20\t20\tdex\t\t20\t20\tlifesteal\t\t5\t9\tdmg-norm\t\t25\t50\tstack\t\t60\t60\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lycander's Aim\t282\t100\t1\t\t\t1\t\t50\t42\tam7\tCeremonial Bow\t\t5\t5000\t\t\t\t\t\t\t\tama\t\t2\t2\tskilltab\t0\t2\t2\tdmg%\t\t150\t200\tswing2\t\t20\t20\tac%\t\t20\t20\tdex\t\t20\t20\tenr\t\t20\t20\tmanasteal\t\t5\t8\tdmg-norm\t\t25\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lycander's Flank\t283\t100\t1\t\t\t1\t\t50\t42\tam9\tCeremonial Pike\t\t5\t5000\t\t\t\t\t\t\t\tama\t\t2\t2\tskilltab\t2\t2\t2\tdmg%\t\t150\t200\tswing2\t\t30\t30\tac%\t\t20\t20\tstr\t\t20\t20\tvit\t\t20\t20\tlifesteal\t\t5\t9\tdmg-norm\t\t25\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Oculus\t284\t100\t1\t\t\t1\t\t50\t42\toba\tSwirling Crystal\t\t5\t5000\t\t\t\t\t\t\t\tsor\t\t3\t3\tgethit-skill\t54\t25\t1\tres-all\t\t20\t20\tcast2\t\t30\t30\tac%\t\t20\t20\tvit\t\t20\t20\tenr\t\t20\t20\tmana-kill\t\t5\t5\tmag%\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Herald of Zakarum\t285\t100\t1\t\t\t1\t\t50\t42\tpa9\tAerin Shield\t\t5\t5000\t\t\t\t\t\t\t\tpal\t\t2\t2\tskilltab\t9\t2\t2\tac%\t\t150\t200\tblock2\t\t30\t30\tblock\t\t30\t30\tstr\t\t20\t20\tvit\t\t20\t20\tatt%\t\t20\t20\tres-all\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Cutthroat1\t286\t100\t1\t\t\t1\t\t50\t42\t9tw\tRunic Talons\t\t5\t5000\t\t\t\t\t\t\t\tass\t\t2\t2\tskilltab\t20\t1\t1\tdmg%\t\t150\t200\tbalance2\t\t30\t30\tatt%\t\t20\t20\tstr\t\t20\t20\tdex\t\t20\t20\tlifesteal\t\t5\t9\tdmg-norm\t\t25\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Jalal's Mane\t287\t100\t1\t\t\t1\t\t50\t42\tdra\tDream Spirit\t\t5\t5000\t\t\t\t\t\t\t\tdru\t\t2\t2\tskilltab\t16\t2\t2\tac%\t\t150\t200\tbalance2\t\t30\t30\tatt%\t\t20\t20\tstr\t\t20\t20\tenr\t\t20\t20\tmana-kill\t\t5\t5\tres-all\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Scalper\t288\t100\t1\t\t\t1\t\t65\t57\t9ta\tFrancisca\t\t5\t5000\t\t\t\t\t\t\t\trep-quant\t30\t\t\tdmg%\t\t150\t200\tatt%\t\t25\t25\tswing2\t\t20\t20\topenwounds\t\t33\t33\tlifesteal\t\t4\t6\tmana-kill\t\t4\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bloodmoon\t289\t100\t1\t\t\t1\t\t69\t61\t7sb\telegant blade\t\t5\t5000\tcred\tcred\t\tinvsbru\t\t\t\tdmg%\t\t210\t260\tlifesteal\t\t10\t15\tcharged\tBloodGolem\t9\t15\theal-kill\t\t7\t13\topenwounds\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Djinnslayer\t290\t100\t1\t\t\t1\t\t73\t65\t7sm\tataghan\t\t5\t5000\tdpur\tdpur\t\tinvscmu\t\t\t\tdmg%\t\t190\t240\tdmg-fire\t\t250\t500\tdmg-demon\t\t100\t150\tatt-demon\t\t200\t300\tabs-ltng\t\t3\t7\tmanasteal\t\t3\t6\tsock\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Deathbit\t291\t100\t1\t\t\t1\t\t52\t44\t9tk\tbattle dart\t\t5\t5000\t\t\t\t\t\t\t\tdeadly\t\t40\t40\tdmg%\t\t130\t180\tatt\t\t200\t450\tlifesteal\t\t7\t9\tmanasteal\t\t4\t6\trep-quant\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Warshrike\t292\t100\t1\t\t\t1\t\t83\t75\t7bk\twinged knife\t\t5\t5000\tbwht\tbwht\t\tinvtk3\t\t\t\tdmg%\t\t200\t250\tpierce\t\t50\t50\tswing2\t\t30\t30\tdeadly\t\t50\t50\trep-quant\t30\t\t\thit-skill\tNova\t25\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gutsiphon\t293\t100\t1\t\t\t1\t\t79\t71\t6rx\tdemon crossbow\t\t5\t5000\tlgrn\tlgrn\t\tinvrxbu\t\t\t\tdmg%\t\t160\t220\tpierce\t\t33\t33\tlifesteal\t\t12\t18\tslow\t\t25\t25\topenwounds\t\t33\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Razoredge\t294\t100\t1\t\t\t1\t\t75\t67\t7ha\ttomahawk\t\t5\t5000\tlblu\t\t\tinvhaxu\t\t\t\tdmg%\t\t175\t225\tswing2\t\t40\t40\treduce-ac\t\t33\t33\tdeadly\t\t50\t50\topenwounds\t\t50\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gore Ripper\t295\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\tdred\tdred\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Demonlimb\t296\t100\t1\t\t\t1\t\t71\t63\t7sp\ttyrant club\t\t5\t5000\tdgrn\tdgrn\t\tinvspcu\t\t\t\tdmg%\t\t180\t230\tdmg-fire\t\t222\t333\tlifesteal\t\t7\t13\tcharged\tEnchant\t20\t23\trep-dur\t5\t\t\tdmg-demon\t\t123\t123\tres-fire\t\t15\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Steelshade\t297\t100\t1\t\t\t1\t\t70\t62\tulm\tarmet\t\t5\t5000\tblac\tblac\t\tinvhlmu\t\t\t\tac%\t\t100\t130\tabs-fire\t\t5\t11\tmanasteal\t\t4\t8\tregen\t\t10\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Tomb Reaver\t298\t100\t1\t\t\t1\t\t86\t84\t7pa\tcryptic axe\t\t5\t5000\tlyel\tlyel\t\t\t\t\t\tswing2\t\t60\t60\tlight\t\t4\t4\tdmg%\t\t200\t280\tdmg-undead\t\t150\t230\tmag%\t\t50\t80\tres-all\t\t30\t50\tatt-undead\t\t250\t350\treanimate\t1\t10\t10\theal-kill\t\t10\t14\tsock\t\t1\t3\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Deaths's Web\t299\t100\t1\t\t\t1\t\t74\t66\t7gw\tunearthed wand\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tallskills\t\t2\t2\tpierce-pois\t\t40\t50\theal-kill\t\t7\t12\tmana-kill\t\t7\t12\tskilltab\t7\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Nature's Peace\t300\t100\t1\t\t\t3\t\t77\t69\trin\tring\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tnoheal\t\t1\t1\trip\t\t1\t1\tred-dmg\t\t7\t11\tres-pois\t\t20\t30\tcharged\tOak Sage\t27\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Azurewrath\t301\t100\t1\t\t\t1\t\t87\t85\t7cr\tphase blade\t\t5\t5000\tlgry\t\t\tinvcrs\t\t\t\tdmg-mag\t\t250\t500\tdmg%\t\t230\t270\taura\tSanctuary\t10\t13\tdmg-cold\t250\t250\t500\tswing2\t\t30\t30\tall-stats\t\t5\t10\tlight\t\t3\t3\tallskills\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Seraph's Hymn\t302\t100\t1\t\t\t3\t\t73\t65\tamu\tamulet\t\t5\t5000\tbwht\tbwht\t\tinvamu2\t\t\t\tallskills\t\t2\t2\tskilltab\t11\t1\t2\tdmg-demon\t\t25\t50\tdmg-undead\t\t25\t50\tatt-demon\t\t150\t250\tatt-undead\t\t150\t250\tlight\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Zakarum's Salvation\t303\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Fleshripper\t304\t100\t1\t\t\t1\t\t76\t68\t7kr\tfanged knife\t\t5\t5000\tdred\tdred\t\tinvkrsu\t\t\t\tdmg%\t\t200\t300\treduce-ac\t\t50\t50\tnoheal\t\t1\t1\tcrush\t\t25\t25\topenwounds\t\t50\t50\tdeadly\t\t33\t33\tslow\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Odium\t305\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\tblac\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Horizon's Tornado\t306\t100\t1\t\t\t5\t\t72\t64\t7fl\tscourge\t\t5\t5000\tdpur\tdpur\t\t\t\t\t\tdmg%\t\t230\t280\tswing2\t\t50\t50\tslow\t\t20\t20\thit-skill\tTornado\t20\t15\tease\t\t-20\t-20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stone Crusher\t307\t100\t1\t\t\t4\t\t76\t68\t7wh\tlegendary mallet\t\t5\t5000\twhit\t\t\t\t\t\t\tdmg%\t\t280\t320\tstr\t\t20\t30\tcrush\t\t40\t40\treduce-ac\t\t25\t25\tdmg-ac\t\t-100\t-100\tdmg\t\t10\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Jadetalon\t308\t100\t1\t\t\t1\t\t74\t66\t7wb\twrist sword\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tdmg%\t\t190\t240\tmanasteal\t\t10\t15\tres-all\t\t40\t50\tbalance2\t\t30\t30\tskilltab\t19\t1\t2\tskilltab\t20\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Shadowdancer\t309\t100\t1\t\t\t1\t\t79\t71\tuhb\tmyrmidon greaves\t\t5\t5000\tblac\tblac\t\t\t\t\t\tac%\t\t70\t100\tmove2\t\t30\t30\tbalance2\t\t30\t30\tdex\t\t15\t25\tskilltab\t19\t1\t2\tease\t\t-20\t-20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Cerebus\t310\t100\t1\t\t\t1\t\t71\t63\tdrb\tblood spirit\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tac%\t\t130\t140\tskilltab\t16\t2\t4\tlifesteal\t\t7\t10\tatt%\t\t60\t120\topenwounds\t\t33\t33\tskill\tferal rage\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Tyrael's Might\t311\t100\t1\t\t\t1\t\t87\t84\tuar\tsacred armor\t\t5\t5000\tdblu\tdblu\t\tinvaaru\t\t\t\tease\t\t-100\t-100\tindestruct\t\t1\t1\tac%\t\t120\t150\trip\t\t1\t1\tdmg-demon\t\t50\t100\tnofreeze\t\t1\t1\tmove2\t\t20\t20\tres-all\t\t20\t30\tstr\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Souldrain\t312\t100\t1\t\t\t1\t\t82\t74\tumg\tvambraces\t\t5\t5000\tdred\tdred\t\t\t\t\t\tac%\t\t90\t120\tmanasteal\t\t4\t7\tlifesteal\t\t4\t7\thit-skill\tWeaken\t8\t3\tdmg-ac\t\t-50\t-50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Runemaster\t313\t100\t1\t\t\t1\t\t80\t72\t72a\tettin axe\t\t5\t5000\tlblu\tlblu\t\t\t\t\t\tdmg%\t\t220\t270\tsock\t\t3\t5\tres-cold-max\t\t5\t5\tnofreeze\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Deathcleaver\t314\t100\t1\t\t\t1\t\t78\t70\t7wa\tberserker axe\t\t5\t5000\tdred\t\t\t\t\t\t\tdmg%\t\t230\t280\tdeadly\t\t66\t66\treduce-ac\t\t33\t33\tswing2\t\t40\t40\theal-kill\t\t6\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Executioner's Justice\t315\t100\t1\t\t\t1\t\t83\t75\t7gi\tglorious axe\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdmg%\t\t240\t290\tcrush\t\t25\t25\treduce-ac\t\t33\t33\tkill-skill\tDecrepify\t50\t6\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stoneraven\t316\t100\t1\t\t\t1\t\t72\t64\tamd\tmatriarchal spear\t\t5\t5000\tdgry\t\t\t\t\t\t\tdmg%\t\t230\t280\tdmg-mag\t\t101\t187\tres-all\t\t30\t50\tac\t\t400\t600\tskilltab\t2\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Leviathan\t317\t100\t1\t\t\t1\t\t73\t65\tuld\tkraken shell\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tac%\t\t170\t200\tac\t\t100\t150\tred-dmg%\t\t15\t25\tstr\t\t40\t50\tindestruct\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Larzuk's Champion\t318\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\tlgry\t\tflphmr\tinvhfh\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Wisp\t319\t100\t1\t\t\t1\t\t84\t76\trin\tring\t\t5\t5000\tbwht\tbwht\t\t\t\t\t\tabs-ltng%\t\t10\t20\thit-skill\tLightning\t10\t16\tmag%\t\t10\t20\tcharged\tOak Sage\t15\t2\tcharged\tHeart of Wolverine\t13\t5\tcharged\tSpirit of Barbs\t11\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gargoyle's Bite\t320\t100\t1\t\t\t1\t\t78\t70\t7ts\twinged harpoon\t\t5\t5000\tcgrn\tcgrn\t\t\t\t\t\tdmg%\t\t180\t230\trep-quant\t30\t\t\tdmg-pois\t250\t300\t300\tlifesteal\t\t9\t15\tcharged\tPlague Javelin\t60\t11\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Lacerator\t321\t100\t1\t\t\t1\t\t76\t68\t7b8\twinged axe\t\t5\t5000\tblac\tblac\t\t\t\t\t\tdmg%\t\t150\t210\trep-quant\t25\t\t\tswing2\t\t30\t30\tnoheal\t\t1\t1\topenwounds\t\t33\t33\thowl\t\t64\t64\thit-skill\tAmplify Damage\t33\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Mang Song's Lesson\t322\t100\t1\t\t\t1\t\t86\t82\t6ws\tarchon staff\t\t5\t5000\tdgld\tdgld\t\tinv8wsu\t\t\t\tallskills\t\t5\t5\tpierce-fire\t\t7\t15\tpierce-ltng\t\t7\t15\tpierce-cold\t\t7\t15\tregen-mana\t\t10\t10\tcast2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Viperfork\t323\t100\t1\t\t\t1\t\t79\t71\t7br\twar fork\t\t5\t5000\tdgrn\tdgrn\t\t\t\t\t\tdmg%\t\t190\t240\tdmg-pois\t250\t333\t333\tswing2\t\t50\t50\tatt\t\t200\t250\thit-skill\tPoison Explosion\t15\t9\tres-pois\t\t30\t50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ethereal Edge\t324\t100\t1\t\t\t1\t\t82\t74\t7ba\tsilver-edged axe\t\t5\t5000\twhit\twhit\t\t\t\t\t\tdmg%\t\t150\t180\tswing2\t\t25\t25\tabs-fire\t\t10\t12\tdmg-demon\t\t150\t200\tdemon-heal\t\t5\t10\tatt\t\t270\t350\tethereal\t\t1\t1\tindestruct\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Demonhorn's Edge\t325\t100\t1\t\t\t1\t\t69\t61\tbad\tdestroyer helm\t\t5\t5000\tdgry\tdgry\t\t\t\t\t\tac%\t\t120\t160\tswing2\t\t10\t10\tlifesteal\t\t3\t6\tthorns\t\t55\t77\tskilltab\t12\t1\t3\tskilltab\t13\t1\t3\tskilltab\t14\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Reaper's Toll\t326\t100\t1\t\t\t1\t\t83\t75\t7s8\tthresher\t\t5\t5000\t\t\t\tinvscy\t\t\t\tdmg%\t\t190\t240\thit-skill\tDecrepify\t33\t1\tignore-ac\t\t1\t1\tlifesteal\t\t11\t15\tease\t\t-25\t-25\tdeadly\t\t33\t33\tdmg-cold\t\t4\t44\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Spiritkeeper\t327\t100\t1\t\t\t1\t\t75\t67\tdrd\tearth spirit\t\t5\t5000\t\t\t\t\t\t\t\tac%\t\t170\t190\tbalance2\t\t20\t20\tabs-ltng\t\t9\t14\tres-fire\t\t30\t40\tabs-cold%\t\t15\t25\tres-pois-max\t\t10\t10\tdru\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hellrack\t328\t100\t1\t\t\t1\t\t84\t76\t6hx\tcolossus crossbow\t\t5\t5000\tcred\t\t\tinvhxbu\t\t\t\tdmg%\t\t180\t230\tdmg-elem\t33\t63\t324\tswing2\t\t20\t20\tatt%\t\t100\t150\tsock\t\t2\t2\tcharged\tImmolation Arrow\t150\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Alma Negra\t329\t100\t1\t\t\t1\t\t85\t77\tpac\tsacred rondache\t\t5\t5000\tblac\tblac\t\t\t\t\t\tac%\t\t180\t210\tblock2\t\t30\t30\tpal\t\t1\t2\tblock\t\t20\t20\tred-mag\t\t5\t9\tatt%\t\t40\t75\tdmg%\t\t40\t75\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Darkforge Spawn\t330\t100\t1\t\t\t1\t\t72\t64\tnef\tbloodlord skull\t\t5\t5000\tcred\tcred\t\t\t\t\t\tac%\t\t140\t180\tcast2\t\t30\t30\tmana%\t\t10\t10\tskilltab\t6\t1\t3\tskilltab\t7\t1\t3\tskilltab\t8\t1\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Widowmaker\t331\t100\t1\t\t\t1\t\t73\t65\t6sw\tward bow\t\t5\t5000\tdred\tdred\t\tinvswbu\t\t\t\tdmg%\t\t150\t200\tdeadly\t\t33\t33\tignore-ac\t\t1\t1\tmagicarrow\t\t11\t11\toskill\tGuided Arrow\t3\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bloodraven's Charge\t332\t100\t1\t\t\t1\t\t79\t71\tamb\tmatriarchal bow\t\t5\t5000\tdgld\tdgld\t\tinvswbu\t\t\t\tdmg%\t\t180\t230\tatt%\t\t200\t300\texplosivearrow\t\t13\t13\tskilltab\t0\t2\t4\tcharged\tRevive\t30\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ghostflame\t333\t100\t1\t\t\t1\t\t70\t62\t7bl\tlegend spike\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tdmg%\t\t190\t240\tignore-ac\t\t1\t1\tdmg-mag\t\t108\t108\tmanasteal\t\t10\t15\tethereal\t\t1\t1\tindestruct\t\t1\t1\tlight\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Shadowkiller\t334\t100\t1\t\t\t1\t\t85\t78\t7cs\tbattle cestus\t\t5\t5000\t\t\t\tinvaxfu\t\t\t\tdmg%\t\t170\t220\treduce-ac\t\t25\t25\tfreeze\t\t2\t2\tmana-kill\t\t10\t15\thit-skill\tFrost Nova\t33\t8\tethereal\t\t1\t1\tindestruct\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gimmershred\t335\t100\t1\t\t\t1\t\t78\t70\t7ta\tflying axe\t\t5\t5000\tlgrn\t\t\t\t\t\t\tdmg%\t\t160\t210\tdmg-fire\t\t218\t483\tdmg-cold\t100\t176\t397\tdmg-ltng\t\t29\t501\tstack\t\t60\t60\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Griffon's Eye\t336\t100\t1\t\t\t1\t\t84\t76\tci3\tdiadem\t\t5\t5000\t\t\t\t\t\t\t\tac\t\t100\t200\tcast2\t\t25\t25\tallskills\t\t1\t1\textra-ltng\t\t10\t15\tpierce-ltng\t\t15\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Windhammer\t337\t100\t1\t\t\t1\t\t76\t68\t7m7\togre maul\t\t5\t5000\tcblu\tcblu\t\tinvmau\t\t\t\tdmg%\t\t180\t230\tcrush\t\t50\t50\tswing2\t\t60\t60\thit-skill\tTwister\t33\t22\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Thunderstroke\t338\t100\t1\t\t\t1\t\t77\t69\tamf\tmatriarchal javelin\t\t5\t5000\tdblu\tdblu\t\t\t\t\t\tdmg%\t\t150\t200\tdmg-ltng\t\t1\t511\thit-skill\tLightning\t20\t14\tswing2\t\t15\t15\tpierce-ltng\t\t15\t15\tskill\tLightning Bolt\t3\t3\tskilltab\t2\t2\t4\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Giantmaimer\t339\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\tcred\tcred\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Demon's Arch\t340\t100\t1\t\t\t1\t\t76\t68\t7s7\tbalrog spear\t\t5\t5000\tcred\tcred\t\t\t\t\t\tdmg%\t\t160\t210\tdmg-fire\t\t232\t323\tlifesteal\t\t6\t12\trep-quant\t30\t\t\tswing2\t\t30\t30\tdmg-ltng\t\t23\t333\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Boneflame\t341\t100\t1\t\t\t1\t\t80\t72\tnee\tsuccubae skull\t\t3\t5000\tdred\tdred\t\t\t\t\t\tac%\t\t120\t150\tmove2\t\t20\t20\tgethit-skill\tTerror\t15\t3\tnec\t\t2\t3\tres-all\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Steelpillar\t342\t100\t1\t\t\t1\t\t77\t69\t7p7\twar pike\t\t3\t5000\t\t\t\t\t\t\t\tdmg%\t\t210\t260\tswing2\t\t25\t25\treduce-ac\t\t20\t20\tac%\t\t50\t80\tindestruct\t\t1\t1\tcrush\t\t25\t25\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Nightwing's Veil\t343\t100\t1\t\t\t1\t\t75\t67\tuhm\tspired helm\t\t3\t5000\tcblu\tcblu\t\t\t\t\t\tac%\t\t90\t120\tallskills\t\t2\t2\tdex\t\t10\t20\tabs-cold\t\t5\t9\thalf-freeze\t\t1\t1\textra-cold\t\t8\t15\tease\t\t-50\t-50\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Crown of Ages\t344\t100\t1\t\t\t1\t\t86\t82\turn\tcorona\t\t3\t5000\tdgld\tdgld\t\t\t\t\t\tbalance2\t\t30\t30\tres-all\t\t20\t30\tallskills\t\t1\t1\tac\t\t100\t150\tindestruct\t\t1\t1\tred-dmg%\t\t10\t15\tac%\t\t50\t50\tsock\t\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Andariel's Visage\t345\t100\t1\t\t\t1\t\t85\t83\tusk\tdemonhead\t\t3\t5000\tdred\tdred\t\t\t\t\t\tac%\t\t100\t150\tres-pois\t\t70\t70\tallskills\t\t2\t2\tres-pois-max\t\t10\t10\tswing2\t\t20\t20\tstr\t\t25\t30\tgethit-skill\t92\t15\t15\tcharged\t278\t20\t3\tlifesteal\t\t8\t10\tres-fire\t\t-30\t-30\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Darkfear\t346\t100\t\t\t\t1\t\t\t\tulm\tarmet\t\t5\t5000\tblac\t\t\tinvhlmu\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Dragonscale\t347\t100\t1\t\t\t1\t\t84\t80\tpae\tzakarum shield\t\t3\t5000\tdgrn\tdgrn\t\t\t\t\t\tac%\t\t170\t200\tabs-fire%\t\t10\t20\tres-fire-max\t\t5\t5\tstr\t\t15\t25\tdmg-fire\t\t211\t371\toskill\tHydra\t10\t10\textra-fire\t\t15\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Steel Carapice\t348\t100\t1\t\t\t1\t\t74\t66\tuul\tshadow plate\t\t3\t5000\tdgry\tdgry\t\t\t\t\t\tac%\t\t190\t220\tbalance2\t\t20\t20\tred-dmg\t\t9\t14\tres-cold\t\t40\t60\tregen-mana\t\t10\t15\trep-dur\t5\t\t\tgethit-skill\tIron Maiden\t8\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Medusa's Gaze\t349\t100\t1\t\t\t1\t\t84\t76\tuow\taegis\t\t3\t5000\tlred\tlred\t\tinvtowu\t\t\t\tac%\t\t150\t180\tslow\t\t20\t20\tgethit-skill\tLower Resist\t10\t7\tlifesteal\t\t5\t9\tdeath-skill\tNova\t100\t44\tres-cold\t\t40\t80\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ravenlore\t350\t100\t1\t\t\t1\t\t82\t74\tdre\tsky spirit\t\t3\t5000\tdgld\tdgld\t\t\t\t\t\tac%\t\t120\t150\tres-all\t\t15\t25\tskilltab\t17\t3\t3\tenr\t\t20\t30\tpierce-fire\t\t10\t20\tskill\tRaven\t7\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Boneshade\t351\t100\t1\t\t\t1\t\t84\t79\t7bw\tlich wand\t\t3\t5000\tdgry\tdgry\t\tinvbwnu\t\t\t\tnec\t\t2\t2\tcast2\t\t25\t25\tskill\tTeeth\t4\t5\tskill\tBone Armor\t4\t5\tskill\tBone Spear\t2\t3\tskill\tBone Spirit\t1\t2\tskill\tBone Wall\t2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Nethercrow\t352\t100\t\t\t\t1\t\t\t\t\t\t\t3\t5000\tcblu\tcblu\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Flamebellow\t353\t100\t1\t\t\t1\t\t79\t71\t7gs\tbalrog blade\t\t3\t5000\tcred\tcred\t\tinvgisu\t\t\t\tdmg%\t\t170\t240\tdmg-fire\t\t233\t482\tfireskill\t\t3\t3\tabs-fire%\t\t20\t30\thit-skill\tFirestorm\t12\t16\tstr\t\t10\t20\tvit\t\t5\t10\toskill\tInferno\t12\t18\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Fathom\t354\t100\t1\t\t\t1\t\t81\t73\tobf\tdimensional shard\t\t3\t5000\tlblu\t\t\t\t\t\t\tsor\t\t3\t3\textra-cold\t\t15\t30\tcast2\t\t20\t20\tres-fire\t\t25\t40\tres-ltng\t\t25\t40\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Wolfhowl\t355\t100\t1\t\t\t1\t\t85\t79\tbac\tfury visor\t\t3\t5000\tcred\tcred\t\t\t\t\t\tac%\t\t120\t150\tskilltab\t14\t2\t3\tstr\t\t8\t15\tdex\t\t8\t15\tvit\t\t8\t15\toskill\tWearwolf\t3\t6\tcharged\tSummon Fenris\t18\t15\toskill\tShape Shifting\t3\t6\toskill\tFeral Rage\t3\t6\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Spirit Ward\t356\t100\t1\t\t\t1\t\t76\t68\tuts\tward\t\t3\t5000\tdblu\tdblu\t\tinvgtsu\t\t\t\tac%\t\t130\t180\tabs-cold\t\t6\t11\tres-all\t\t30\t40\tblock\t\t20\t30\tblock2\t\t25\t25\tgethit-skill\tFade\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Kira's Guardian\t357\t100\t1\t\t\t1\t\t85\t77\tci2\ttiara\t\t3\t5000\tblac\tblac\t\t\t\t\t\tac\t\t50\t120\tres-all\t\t50\t70\tnofreeze\t\t1\t1\tbalance2\t\t20\t20\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ormus' Robes\t358\t100\t1\t\t\t1\t\t83\t75\tuui\tdusk shroud\t\t3\t5000\tblac\tblac\t\t\t\t\t\tac\t\t10\t20\tcast2\t\t20\t20\textra-fire\t\t10\t15\textra-cold\t\t10\t15\textra-ltng\t\t10\t15\tregen-mana\t\t10\t15\tskill-rand\t3\t36\t60\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Gheed's Fortune\t359\t100\t1\t\t\t1\t\t70\t62\tcm3\tcharm\t1\t3\t5000\tlgld\t\t\t\t\t\t\tmag%\t\t20\t40\tgold%\t\t80\t160\tcheap\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Stormlash\t360\t100\t1\t\t\t1\t\t86\t82\t7fl\tscourge\t\t3\t5000\tdgry\tdgry\t\t\t\t\t\tdmg%\t\t240\t300\tswing2\t\t30\t30\thit-skill\tStatic Field\t15\t10\thit-skill\tTornado\t20\t18\tdmg-ltng\t\t1\t473\tlight-thorns\t\t30\t30\tcrush\t\t33\t33\tabs-ltng\t\t3\t9\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Halaberd's Reign\t361\t100\t1\t\t\t1\t\t85\t77\tbae\tconqueror crown\t\t3\t5000\t\t\t\t\t\t\t\tac%\t\t140\t170\tskilltab\t13\t1\t1\tbar\t\t2\t2\tbalance2\t\t20\t20\tregen\t\t15\t23\tskill\tBattle Orders\t1\t2\tskill\tBattle Command\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Warriv's Warder\t362\t100\t\t\t\t1\t\t\t\t\t\t\t3\t5000\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Spike Thorn\t363\t100\t1\t\t\t1\t\t78\t70\tupk\tblade barrier\t\t5\t5000\tdyel\tdyel\t\tinvspku\t\t\t\tac%\t\t120\t150\tthorns/lvl\t11\t\t\tdur\t\t250\t250\tbalance2\t\t30\t30\tred-dmg%\t\t15\t20\tsock\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Dracul's Grasp\t364\t100\t1\t\t\t1\t\t84\t76\tuvg\tvampirebone gloves\t\t5\t5000\tdred\tdred\t\t\t\t\t\tac%\t\t90\t120\tlifesteal\t\t7\t10\topenwounds\t\t25\t25\thit-skill\tLife Tap\t5\t10\theal-kill\t\t5\t10\tstr\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Frostwind\t365\t100\t1\t\t\t1\t\t78\t70\t7ls\tcryptic sword\t\t5\t5000\tcblu\tcblu\t\tinvlsdu\t\t\t\tdmg%\t\t180\t230\tfreeze\t\t4\t4\thalf-freeze\t\t1\t1\tdmg-cold\t150\t237\t486\tswing2\t\t25\t25\tabs-cold%\t\t7\t15\toskill\tArctic Blast\t7\t14\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Templar's Might\t366\t100\t1\t\t\t8\t\t82\t74\tuar\tsacred armor\t\t5\t5000\tcgrn\tcgrn\t\tinvaaru\t\t\t\tac%\t\t170\t220\tbalance2\t\t20\t20\tac-miss\t\t250\t300\tstam\t\t40\t50\tstr\t\t10\t15\tvit\t\t10\t15\tskilltab\t10\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Eschuta's temper\t367\t100\t1\t\t\t1\t\t80\t72\tobc\teldritch orb\t\t5\t5000\tcred\t\t\t\t\t\t\tsor\t\t1\t3\tcast2\t\t40\t40\textra-fire\t\t10\t20\textra-ltng\t\t10\t20\tenr\t\t20\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Firelizard's Talons\t368\t100\t1\t\t\t1\t\t75\t67\t7lw\tferal claws\t\t5\t5000\t\t\t\t\t\t\t\tdmg%\t\t200\t270\tswing2\t\t15\t15\tskilltab\t20\t1\t3\tdmg-fire\t\t236\t480\tres-fire\t\t40\t70\tskill\tWake of Fire Sentry\t1\t2\tskill\tInferno Sentry\t1\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Sandstorm Trek\t369\t100\t1\t\t\t1\t\t72\t64\tuvb\tscarabshell boots\t\t5\t5000\t\t\t\t\t\t\t\tac%\t\t140\t170\tmove2\t\t20\t20\tbalance2\t\t20\t20\tstam/lvl\t8\t\t\tstamdrain\t\t50\t50\tres-pois\t\t40\t70\trep-dur\t5\t\t\tstr\t\t10\t15\tvit\t\t10\t15\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Marrowwalk\t370\t100\t1\t\t\t1\t\t74\t66\tumb\tboneweave boots\t\t5\t5000\tdgry\t\t\t\t\t\t\tac%\t\t170\t200\tmove2\t\t20\t20\tcharged\tBone Prison\t13\t33\tcharged\tLife Tap\t10\t12\tregen-stam\t\t10\t10\tregen-mana\t\t10\t10\thalf-freeze\t\t1\t1\tstr\t\t10\t20\tdex\t\t17\t17\tskill\tSkeleton Mastery\t1\t2\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Heaven's Light\t371\t100\t1\t\t\t1\t\t69\t61\t7sc\tmighty scepter\t\t5\t5000\tcblu\tcblu\t\t\t\t\t\tdmg%\t\t250\t300\tswing2\t\t20\t20\treduce-ac\t\t33\t33\tlight\t\t3\t3\tdemon-heal\t\t15\t20\tcrush\t\t33\t33\tsock\t\t1\t3\tpal\t\t2\t3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Merman's Speed\t372\t100\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Arachnid Mesh\t373\t100\t1\t\t\t1\t\t87\t80\tulc\tspiderweb sash\t\t5\t5000\tblac\tblac\t\t\t\t\t\tac%\t\t90\t120\tcast2\t\t20\t20\tcharged\tVenom\t11\t3\tallskills\t\t1\t1\tslow\t\t10\t10\tmana%\t\t5\t5\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Nosferatu's Coil\t374\t100\t1\t\t\t1\t\t68\t51\tuvc\tvampirefang belt\t\t5\t5000\t\t\t\t\t\t\t\tstr\t\t15\t15\tmana-kill\t\t2\t2\tslow\t\t10\t10\tlifesteal\t\t5\t7\tswing2\t\t10\t10\tlight\t\t-3\t-3\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Metalgrid\t375\t100\t1\t\t\t2\t\t85\t81\tamu\tamulet\t\t5\t5000\t\t\t\t\t\t\t\tac\t\t300\t350\tres-all\t\t25\t35\tatt\t\t400\t450\tcharged\tIronGolem\t11\t22\tcharged\tIron Maiden\t20\t12\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Verdugo's Hearty Cord\t376\t100\t1\t\t\t1\t\t71\t63\tumc\tmithril coil\t\t5\t5000\tblac\tblac\t\t\t\t\t\tac%\t\t90\t140\tvit\t\t30\t40\tstam\t\t100\t120\tbalance2\t\t10\t10\tred-dmg%\t\t10\t15\tregen\t\t10\t13\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Sigurd's Staunch\t377\t100\t\t\t\t1\t\t\t\t\t\t\t5\t5000\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Carrion Wind\t378\t100\t1\t\t\t3\t\t68\t60\trin\tring\t\t3\t5000\t\t\t\t\t\t\t\tac-miss\t\t100\t160\tlifesteal\t\t6\t9\tres-pois\t\t55\t55\tgethit-skill\tPoison Nova\t10\t10\tcharged\tPlague Poppy\t15\t21\thit-skill\tTwister\t8\t13\tdmg-to-mana\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Giantskull\t379\t100\t1\t\t\t1\t\t73\t65\tuh9\tbone visage\t\t3\t5000\tlgry\tlgry\t\tinvbhm\t\t\t\tac\t\t250\t320\tstr\t\t25\t35\tcrush\t\t10\t10\tsock\t\t1\t2\tknock\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ironward\t380\t100\t1\t\t\t1\t\t68\t60\t7ws\tcaduceus\t\t3\t5000\tblac\tblac\t\t\t\t\t\tdmg%\t\t240\t290\tslow\t\t25\t25\tatt%\t\t150\t200\tswing2\t\t10\t10\tdmg-mag\t\t80\t240\tred-dmg\t\t4\t7\tdmg\t\t40\t85\tskilltab\t9\t2\t4\tcrush\t\t33\t33\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Annihilus\t381\t100\t1\t\t\t1\t\t110\t70\tcm1\tcharm\t1\t3\t5000\t\t\tflpmss\tinvmss\titem_gem\t12\titem_gem\tallskills\t\t1\t1\tall-stats\t\t10\t20\tres-all\t\t10\t20\taddxp\t\t5\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Arioc's Needle\t382\t100\t1\t\t\t1\t\t85\t81\t7sr\thyperion spear\t\t3\t5000\t\t\t\t\t\t\t\tdmg%\t\t180\t230\tdmg-pois\t250\t403\t403\tdeadly\t\t50\t50\tignore-ac\t\t1\t1\tallskills\t\t2\t4\tswing2\t\t30\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Cranebeak\t383\t100\t1\t\t\t1\t\t71\t63\t7mp\twar spike\t\t3\t5000\tdgry\t\t\tinvmpiu\t\t\t\tdmg%\t\t240\t300\tdmg-ltng\t\t1\t305\tswing2\t\t40\t40\treduce-ac\t\t25\t25\tmag%\t\t20\t50\tcharged\tRaven\t15\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Nord's Tenderizer\t384\t100\t1\t\t\t1\t\t76\t68\t7cl\ttruncheon\t\t3\t5000\t\t\t\tinvclbu\t\t\t\tdmg%\t\t270\t330\tfreeze\t\t2\t4\tswing2\t\t25\t25\tcharged\tBlizzard\t12\t16\tatt%\t\t150\t180\tabs-cold%\t\t5\t15\tdmg-cold\t125\t205\t455\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Earthshifter\t385\t100\t1\t\t\t1\t\t77\t69\t7gm\tthunder maul\t\t3\t5000\t\t\t\t\t\t\t\tdmg%\t\t250\t300\thit-skill\tEruption\t25\t14\tcrush\t\t33\t33\tswing2\t\t10\t10\tcharged\tVolcano\t30\t14\tskilltab\t17\t7\t7\tcast2\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Wraithflight\t386\t100\t1\t\t\t1\t\t84\t76\t7gl\tghost glaive\t\t3\t5000\tdblu\tdblu\t\t\t\t\t\tdmg%\t\t150\t190\trep-quant\t40\t\t\tlifesteal\t\t9\t13\tmana-kill\t\t15\t15\tethereal\t\t1\t1\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bonehew\t387\t100\t1\t\t\t1\t\t72\t64\t7o7\togre axe\t\t3\t5000\tbwht\tbwht\t\t\t\t\t\tdmg%\t\t270\t320\tswing2\t\t30\t30\tcharged\tCorpse Explosion\t30\t14\thit-skill\tBone Spear\t50\t16\tnoheal\t\t1\t1\tsock\t\t2\t2\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Ondal's Wisdom\t388\t100\t1\t\t\t1\t\t74\t66\t6cs\telder staff\t\t3\t5000\t\t\t\tinvcstu\t\t\t\tcast2\t\t45\t45\tenr\t\t40\t50\tallskills\t\t2\t4\tac\t\t450\t550\taddxp\t\t5\t5\tred-mag\t\t5\t8\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"The Reedeemer\t389\t100\t1\t\t\t1\t\t80\t72\t7sc\tmighty scepter\t\t3\t5000\t\t\t\t\t\t\t\tdmg%\t\t250\t300\tdmg-demon\t\t200\t250\tpal\t\t2\t2\tease\t\t-60\t-60\tskill\tRedemption\t2\t4\tskill\tHoly Bolt\t2\t4\tlight\t\t3\t3\treduce-ac\t\t33\t33\tdmg\t\t60\t120\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Headhunter's Glory\t390\t100\t1\t\t\t1\t\t83\t75\tush\ttroll nest\t\t3\t5000\t\t\t\tinvbshu\t\t\t\tac\t\t320\t420\tac-miss\t\t300\t350\tres-pois\t\t30\t40\tsock\t\t1\t3\tres-fire\t\t20\t30\theal-kill\t\t5\t7\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Steelrend\t391\t100\t1\t\t\t1\t\t78\t70\tuhg\togre gauntlets\t\t3\t5000\t\t\t\t\t\t\t\tac\t\t170\t210\tstr\t\t15\t20\tdmg%\t\t30\t60\tcrush\t\t10\t10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rainbow Facet\t392\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-ltng\t\t1\t74\tpierce-ltng\t\t3\t5\textra-ltng\t\t3\t5\tdeath-skill\tChain Lightning\t100\t47\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rainbow Facet\t393\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-cold\t3\t24\t38\tpierce-cold\t\t3\t5\textra-cold\t\t3\t5\tdeath-skill\tBlizzard\t100\t37\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rainbow Facet\t394\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-fire\t\t17\t45\tpierce-fire\t\t3\t5\textra-fire\t\t3\t5\tdeath-skill\tMeteor\t100\t31\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rainbow Facet\t395\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-pois\t50\t187\t187\tpierce-pois\t\t3\t5\textra-pois\t\t3\t5\tdeath-skill\tPoison Nova\t100\t51\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rainbow Facet\t396\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-ltng\t\t1\t74\tpierce-ltng\t\t3\t5\textra-ltng\t\t3\t5\tlevelup-skill\tNova\t100\t41\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rainbow Facet\t397\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-cold\t3\t24\t38\tpierce-cold\t\t3\t5\textra-cold\t\t3\t5\tlevelup-skill\tFrost Nova\t100\t43\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rainbow Facet\t398\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-fire\t\t17\t45\tpierce-fire\t\t3\t5\textra-fire\t\t3\t5\tlevelup-skill\tBlaze\t100\t29\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rainbow Facet\t399\t100\t1\t\t\t1\t\t85\t49\tjew\tjewel\t\t3\t5000\t\t\t\t\t\t\t\tdmg-pois\t50\t187\t187\tpierce-pois\t\t3\t5\textra-pois\t\t3\t5\tlevelup-skill\tVenom\t100\t23\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Hellfire Torch\t400\t100\t1\t\t\t1\t\t110\t75\tcm2\tcharm\t1\t3\t5000\t\t\tflptrch\tinvtrch\titem_gem\t12\titem_gem\trandclassskill\t\t0\t6\tall-stats\t\t10\t20\tres-all\t\t10\t20\tlight\t\t8\t8\thit-skill\t197\t5\t10\tcharged\tHydra\t10\t30\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Cold Rupture\t401\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlblu\tlblu\t\t\t\t\t\tpierce-immunity-cold\t\t300\t300\tres-cold\t\t-90\t-70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Flame Rift\t402\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlred\tlred\t\t\t\t\t\tpierce-immunity-fire\t\t300\t300\tres-fire\t\t-90\t-70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Crack of the Heavens\t403\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlyel\tlyel\t\t\t\t\t\tpierce-immunity-light\t\t300\t300\tres-ltng\t\t-90\t-70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Rotting Fissure\t404\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlgrn\tlgrn\t\t\t\t\t\tpierce-immunity-poison\t\t300\t300\tres-pois\t\t-90\t-70\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Bone Break\t405\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\twhit\twhit\t\t\t\t\t\tpierce-immunity-damage\t\t300\t300\tred-dmg%\t\t-20\t-10\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n",
+                u8"Black Cleft\t406\t100\t\t2\t2\t1\t\t69\t75\tcm3\tcharm\t\t3\t5000\tlgry\tlgry\t\t\t\t\t\tpierce-immunity-magic\t\t300\t300\tres-mag\t\t-65\t-45\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t0\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
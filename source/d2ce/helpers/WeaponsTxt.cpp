@@ -18,329 +18,325 @@
 //---------------------------------------------------------------------------
 
 #include "pch.h"
-#include <sstream>
+#include "EmbeddedText.h"
 
 namespace d2ce
 {
     namespace TxtReaderHelper
     {
-        const std::string& GetWeapons()
+        EmbeddedText GetWeapons()
         {
-            static std::string defaultTxt;
-            if (defaultTxt.empty())
-            {
-                std::stringstream ss;
-                ss << u8"name\ttype\ttype2\tcode\talternategfx\tnamestr\tversion\tcompactsave\trarity\tspawnable\tTransmogrify\tTMogType\tTMogMin\tTMogMax\tmindam\tmaxdam\t1or2handed\t2handed\t2handmindam\t2handmaxdam\tminmisdam\tmaxmisdam\trangeadder\tspeed\tStrBonus\tDexBonus\treqstr\treqdex\tdurability\tnodurability\tlevel\tShowLevel\tlevelreq\tcost\tgamble cost\tmagic lvl\tauto prefix\tnormcode\tubercode\tultracode\twclass\t2handedwclass\tcomponent\thit class\tinvwidth\tinvheight\tstackable\tminstack\tmaxstack\tspawnstack\tflippyfile\tinvfile\tuniqueinvfile\tsetinvfile\thasinv\tgemsockets\tgemapplytype\t*comment\tuseable\tdropsound\tdropsfxframe\tusesound\tunique\ttransparent\ttranstbl\t*quivered\tlightradius\tbelt\tquest\tquestdiffcheck\tmissiletype\tdurwarning\tqntwarning\tgemoffset\tbitfield1\tCharsiMin\tCharsiMax\tCharsiMagicMin\tCharsiMagicMax\tCharsiMagicLvl\tGheedMin\tGheedMax\tGheedMagicMin\tGheedMagicMax\tGheedMagicLvl\tAkaraMin\tAkaraMax\tAkaraMagicMin\tAkaraMagicMax\tAkaraMagicLvl\tFaraMin\tFaraMax\tFaraMagicMin\tFaraMagicMax\tFaraMagicLvl\tLysanderMin\tLysanderMax\tLysanderMagicMin\tLysanderMagicMax\tLysanderMagicLvl\tDrognanMin\tDrognanMax\tDrognanMagicMin\tDrognanMagicMax\tDrognanMagicLvl\tHratliMin\tHratliMax\tHratliMagicMin\tHratliMagicMax\tHratliMagicLvl\tAlkorMin\tAlkorMax\tAlkorMagicMin\tAlkorMagicMax\tAlkorMagicLvl\tOrmusMin\tOrmusMax\tOrmusMagicMin\tOrmusMagicMax\tOrmusMagicLvl\tElzixMin\tElzixMax\tElzixMagicMin\tElzixMagicMax\tElzixMagicLvl\tAshearaMin\tAshearaMax\tAshearaMagicMin\tAshearaMagicMax\tAshearaMagicLvl\tCainMin\tCainMax\tCainMagicMin\tCainMagicMax\tCainMagicLvl\tHalbuMin\tHalbuMax\tHalbuMagicMin\tHalbuMagicMax\tHalbuMagicLvl\tJamellaMin\tJamellaMax\tJamellaMagicMin\tJamellaMagicMax\tJamellaMagicLvl\tLarzukMin\tLarzukMax\tLarzukMagicMin\tLarzukMagicMax\tLarzukMagicLvl\tAnyaMin\tAnyaMax\tAnyaMagicMin\tAnyaMagicMax\tAnyaMagicLvl\tMalahMin\tMalahMax\tMalahMagicMin\tMalahMagicMax\tMalahMagicLvl\tTransform\tInvTrans\tSkipName\tNightmareUpgrade\tHellUpgrade\tNameable\tPermStoreItem\tdiablocloneweight\n";
-                ss << u8"Hand Axe\taxe\t\thax\thax\thax\t0\t\t3\t1\t0\txxx\t\t\t3\t6\t\t\t\t\t\t\t\t\t100\t\t\t\t28\t\t3\t0\t0\t170\t4510\t\t\thax\t9ha\t7ha\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflphax\tinvhax\tinvhaxu\tinvhaxu\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t0\t0\t3\t\t1\t\t1\t1\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\taxe\t2ax\t1\t0\t\n";
-                ss << u8"Axe\taxe\t\taxe\taxe\taxe\t0\t\t4\t1\t0\txxx\t\t\t4\t11\t\t\t\t\t\t\t1\t10\t100\t\t32\t\t24\t\t7\t0\t0\t403\t8821\t\t\taxe\t9ax\t7ax\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpaxe\tinvaxe\tinvaxeu\tinvaxeu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\t2ax\tmpi\t1\t0\t\n";
-                ss << u8"Double Axe\taxe\t\t2ax\taxe\t2ax\t0\t\t4\t1\t0\txxx\t\t\t5\t13\t\t\t\t\t\t\t1\t10\t100\t\t43\t\t24\t\t13\t0\t0\t873\t20349\t\t\t2ax\t92a\t72a\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflp2ax\tinv2ax\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t1\t1\t30\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tmpi\twax\t1\t0\t\n";
-                ss << u8"Military Pick\taxe\t\tmpi\taxe\tmpi\t0\t\t4\t1\t0\txxx\t\t\t7\t11\t\t\t\t\t\t\t1\t-10\t100\t\t49\t33\t26\t\t19\t0\t0\t1421\t38999\t\t\tmpi\t9mp\t7mp\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpmpi\tinvmpi\tinvmpiu\tinvmpiu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\twax\txxx\t1\t0\t\n";
-                ss << u8"War Axe\taxe\t\twax\thax\twax\t0\t\t4\t1\t0\txxx\t\t\t10\t18\t\t\t\t\t\t\t2\t\t100\t\t67\t\t26\t\t25\t0\t0\t2123\t68075\t\t\twax\t9wa\t7wa\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwax\tinvwax\t\t\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t3\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Large Axe\taxe\t\tlax\tlax\tlax\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t6\t13\t\t\t1\t-10\t100\t\t35\t\t30\t\t6\t0\t0\t354\t7624\t\t\tlax\t9la\t7la\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflplax\tinvlax\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tbtx\tgax\t1\t0\t\n";
-                ss << u8"Broad Axe \taxe\t\tbax\tlax\tbax\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t10\t18\t\t\t1\t\t100\t\t48\t\t35\t\t12\t0\t0\t806\t18172\t\t\tbax\t9ba\t7ba\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbrx\tinvbrx\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tgax\tgix\t1\t0\t\n";
-                ss << u8"Battle Axe\taxe\t\tbtx\tbtx\tbtx\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t12\t32\t\t\t1\t10\t100\t\t54\t\t40\t\t17\t0\t0\t1262\t32454\t\t\tbtx\t9bt\t7bt\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbtx\tinvbtx\tinvbtxu\tinvbtxu\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\tgix\txxx\t1\t0\t\n";
-                ss << u8"Great Axe\taxe\t\tgax\tbtx\tgax\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t9\t30\t\t\t2\t-10\t100\t\t63\t39\t50\t\t23\t0\t0\t1916\t58068\t\t\tgax\t9ga\t7ga\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpgax\tinvgax\tinvgaxu\tinvgaxu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Giant Axe\taxe\t\tgix\tgix\tgix\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t22\t45\t\t\t3\t10\t100\t\t70\t\t50\t\t27\t0\t0\t2410\t81070\t\t\tgix\t9gi\t7gi\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgix\tinvgix\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t20\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t2\t2\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Wand\twand\t\twnd\twnd\twnd\t0\t\t1\t1\t0\txxx\t\t\t2\t4\t\t\t\t\t\t\t\t\t100\t\t\t\t15\t\t2\t0\t0\t205\t3910\t1\t\twnd\t9wn\t7wn\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpwnd\tinvwnd\tinvwndu\tinvwndu\t1\t1\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t4\t6\t7\t9\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tywn\tbwn\t1\t0\t\n";
-                ss << u8"Yew Wand\twand\t\tywn\tywn\tywn\t0\t\t1\t1\t0\txxx\t\t\t2\t8\t\t\t\t\t\t\t\t10\t100\t\t\t\t15\t\t12\t0\t0\t745\t17440\t1\t\tywn\t9yw\t7yw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpywn\tinvywn\t\t\t1\t1\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t5\t9\t1\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t2\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tbwn\tgwn\t1\t0\t\n";
-                ss << u8"Bone Wand\twand\t\tbwn\tbwn\tbwn\t0\t\t1\t1\t0\txxx\t\t\t3\t7\t\t\t\t\t\t\t\t-20\t100\t\t\t\t15\t\t18\t0\t0\t1296\t34828\t1\t\tbwn\t9bw\t7bw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpbwn\tinvbwn\tinvbwnu\tinvbwnu\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t5\t7\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t3\t4\t2\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t3\t4\t2\t3\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Grim Wand\twand\t\tgwn\tbwn\tgwn\t0\t\t1\t1\t0\txxx\t\t\t5\t11\t\t\t\t\t\t\t\t\t100\t\t\t\t15\t\t26\t0\t0\t2098\t70048\t1\t\tgwn\t9gw\t7gw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpgwn\tinvgwn\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t3\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t2\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Club\tclub\t\tclb\tclb\tclb\t0\t\t1\t1\t0\txxx\t\t\t1\t6\t\t\t\t\t\t\t\t-10\t100\t\t\t\t24\t\t1\t0\t0\t32\t3032\t\t\tclb\t9cl\t7cl\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpclb\tinvclb\tinvclbu\tinvclbu\t1\t2\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\tmac\tmst\t1\t0\t\n";
-                ss << u8"Scepter\tscep\t\tscp\tmac\tscp\t0\t\t2\t1\t0\txxx\t\t\t6\t11\t\t\t\t\t\t\t\t\t100\t\t25\t\t50\t\t3\t0\t0\t350\t5050\t\t\tscp\t9sc\t7sc\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpscp\tinvscp\t\t\t1\t2\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t1\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t3\t5\t1\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t2\t2\t0\tgsc\twsp\t1\t0\t\n";
-                ss << u8"Grand Scepter\tscep\t\tgsc\tmac\tgsc\t0\t\t4\t1\t0\txxx\t\t\t8\t18\t\t\t\t\t\t\t1\t10\t100\t\t37\t\t60\t\t15\t0\t0\t1109\t26635\t\t\tgsc\t9qs\t7qs\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpgsc\tinvgsc\t\t\t1\t3\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t3\t5\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t2\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t1\t2\t20\t2\t2\t0\txxx\twsp\t1\t0\t\n";
-                ss << u8"War Scepter\tscep\t\twsp\twhm\twsp\t0\t\t4\t1\t0\txxx\t\t\t10\t17\t\t\t\t\t\t\t1\t-10\t100\t\t55\t\t70\t\t21\t0\t0\t2323\t61783\t\t\twsp\t9ws\t7ws\t1hs\t1hs\t5\tclub\t2\t3\t\t\t\t\tflpwsp\tinvwsp\t\t\t1\t5\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t2\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t20\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Spiked Club\tclub\t\tspc\tclb\tspc\t0\t\t3\t1\t0\txxx\t\t\t5\t8\t\t\t\t\t\t\t1\t\t100\t\t\t\t36\t\t4\t0\t0\t225\t5400\t\t\tspc\t9sp\t7sp\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpspc\tinvspc\tinvspcu\tinvspcu\t1\t2\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t1\t\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tmac\tmst\t1\t0\t\n";
-                ss << u8"Mace\tmace\t\tmac\tmac\tmac\t0\t\t4\t1\t0\txxx\t\t\t3\t10\t\t\t\t\t\t\t\t\t100\t\t27\t\t60\t\t8\t0\t0\t463\t10204\t\t\tmac\t9ma\t7ma\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmac\tinvmac\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t1\t\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tmst\tmau\t1\t0\t\n";
-                ss << u8"Morning Star\tmace\t\tmst\tmac\tmst\t0\t\t4\t1\t0\txxx\t\t\t7\t16\t\t\t\t\t\t\t1\t10\t100\t\t36\t\t72\t\t13\t0\t0\t844\t19972\t\t\tmst\t9mt\t7mt\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmst\tinvmst\tinvmstu\tinvmstu\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\tfla\t1\t0\t\n";
-                ss << u8"Flail\tmace\t\tfla\tfla\tfla\t0\t\t4\t1\t0\txxx\t\t\t1\t24\t\t\t\t\t\t\t2\t-10\t100\t\t41\t35\t30\t\t19\t0\t0\t1412\t38828\t\t\tfla\t9fl\t7fl\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvfla\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\tgma\t1\t0\t\n";
-                ss << u8"War Hammer\thamm\t\twhm\twhm\twhm\t0\t\t4\t1\t0\txxx\t\t\t19\t29\t\t\t\t\t\t\t\t20\t110\t\t53\t\t55\t\t25\t0\t0\t2081\t67025\t\t\twhm\t9wh\t7wh\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwhm\tinvwhm\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t178\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tmau\tgma\t1\t0\t\n";
-                ss << u8"Maul\thamm\t\tmau\tmau\tmau\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t30\t43\t\t\t1\t10\t110\t\t69\t\t60\t\t21\t0\t0\t1670\t48070\t\t\tmau\t9m9\t7m7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpmau\tinvmau\tinvmauu\tinvmauu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\tmau\t1\t0\t\n";
-                ss << u8"Great Maul\thamm\t\tgma\tmau\tgma\t0\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t38\t58\t\t\t2\t20\t110\t\t99\t\t60\t\t32\t0\t0\t3215\t121380\t\t\tgma\t9gm\t7gm\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgma\tinvgma\tinvgma\tinvgma\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Short Sword\tswor\t\tssd\tssd\tssd\t0\t\t3\t1\t0\txxx\t\t\t2\t7\t\t\t\t\t\t\t\t\t100\t\t\t\t24\t\t1\t0\t0\t72\t3072\t\t\tssd\t9ss\t7ss\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpssd\tinvssd\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tscm\twsd\t1\t0\t\n";
-                ss << u8"Scimitar\tswor\t\tscm\tscm\tscm\t0\t\t3\t1\t0\txxx\t\t\t2\t6\t\t\t\t\t\t\t\t-20\t100\t\t\t21\t22\t\t5\t0\t0\t274\t6370\t\t\tscm\t9sm\t7sm\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpscm\tinvscm\tinvscmu\tinvscmu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tsbr\tlsd\t1\t0\t\n";
-                ss << u8"Saber\tswor\t\tsbr\tscm\tsbr\t0\t\t3\t1\t0\txxx\t\t\t3\t8\t\t\t\t\t\t\t\t-10\t100\t\t25\t25\t32\t\t8\t0\t0\t466\t10228\t\t\tsbr\t9sb\t7sb\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpsbr\tinvsbr\tinv9sbu\tinv9sbu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tflc\tbsd\t1\t0\t\n";
-                ss << u8"Falchion\tswor\t\tflc\tflc\tflc\t0\t\t4\t1\t0\txxx\t\t\t9\t17\t\t\t\t\t\t\t\t20\t100\t\t33\t\t32\t\t11\t0\t0\t683\t15513\t\t\tflc\t9fc\t7fc\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpflc\tinvflc\tinvflcu\tinvflcu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tbsd\twsd\t1\t0\t\n";
-                ss << u8"Crystal Sword\tswor\t\tcrs\tcrs\tcrs\t0\t\t2\t1\t0\txxx\t\t\t5\t15\t\t\t\t\t\t\t1\t\t100\t\t43\t\t20\t\t11\t0\t0\t2127\t31397\t\t\tcrs\t9cr\t7cr\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpcrs\tinvcrs\tinvcrsu\tinvcrsu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t5\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Broad Sword\tswor\t\tbsd\tbsd\tbsd\t0\t\t4\t1\t0\txxx\t\t\t7\t14\t\t\t\t\t\t\t\t\t100\t\t48\t\t32\t\t15\t0\t0\t1029\t25435\t\t\tbsd\t9bs\t7bs\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpbsd\tinvbsd\tinvbsdu\tinvbsdu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tlsd\twsd\t1\t0\t\n";
-                ss << u8"Long Sword \tswor\t\tlsd\tlsd\tlsd\t0\t\t4\t1\t0\txxx\t\t\t3\t19\t\t\t\t\t\t\t1\t-10\t100\t\t55\t39\t44\t\t20\t0\t0\t1520\t42900\t\t\tlsd\t9ls\t7ls\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflplsd\tinvlsd\tinvlsdu\tinvlsdu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\twsd\twsd\t1\t0\t\n";
-                ss << u8"War Sword\tswor\t\twsd\tflc\twsd\t0\t\t4\t1\t0\txxx\t\t\t8\t20\t\t\t\t\t\t\t1\t\t100\t\t71\t45\t44\t\t27\t0\t0\t1997\t69919\t\t\twsd\t9wd\t7wd\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpwsd\tinvwsd\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t3\t20\t\t\t\t\t255\t1\t1\t1\t3\t20\t\t\t\t\t255\t\t\t1\t2\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Two-Handed Sword\tswor\t\t2hs\tclm\t2hs\t0\t\t4\t1\t0\txxx\t\t\t2\t9\t1\t1\t8\t17\t\t\t2\t\t100\t\t35\t27\t44\t\t10\t0\t0\t644\t13940\t\t\t2hs\t92h\t72h\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflp2hs\tinv2hs\tinv2hsu\tinv2hsu\t1\t3\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tclm\tgis\t1\t0\t\n";
-                ss << u8"Claymore\tswor\t\tclm\tclm\tclm\t0\t\t4\t1\t0\txxx\t\t\t5\t12\t1\t1\t13\t30\t\t\t2\t10\t100\t\t47\t\t50\t\t17\t0\t0\t1262\t32454\t\t\tclm\t9cm\t7cm\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpclm\tinvclm\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tgis\tbsw\t1\t0\t\n";
-                ss << u8"Giant Sword\tswor\t\tgis\tgsd\tgis\t0\t\t4\t1\t0\txxx\t\t\t3\t16\t1\t1\t9\t28\t\t\t2\t\t100\t\t56\t34\t50\t\t21\t0\t0\t1459\t43639\t\t\tgis\t9gs\t7gs\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpgis\tinvgis\tinvgisu\tinvgisu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tbsw\tflb\t1\t0\t\n";
-                ss << u8"Bastard Sword\tswor\t\tbsw\tclm\tbsw\t0\t\t4\t1\t0\txxx\t\t\t7\t19\t1\t1\t20\t28\t\t\t1\t10\t100\t\t62\t\t40\t\t24\t0\t0\t1971\t61804\t\t\tbsw\t9b9\t7b7\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpbsw\tinvbsw\tinvbswu\tinvbswu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Flamberge\tswor\t\tflb\tclm\tflb\t0\t\t4\t1\t0\txxx\t\t\t9\t15\t1\t1\t13\t26\t\t\t2\t-10\t100\t\t70\t49\t50\t\t27\t0\t0\t2400\t80800\t\t\tflb\t9fb\t7fb\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpflb\tinvflb\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Great Sword\tswor\t\tgsd\tgsd\tgsd\t0\t\t4\t1\t0\txxx\t\t\t12\t20\t1\t1\t25\t42\t\t\t2\t10\t100\t\t100\t60\t50\t\t33\t0\t0\t3451\t132883\t\t\tgsd\t9gd\t7gd\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpgsd\tinvgsd\tinvgsdu\tinvgsdu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t3\t20\t\t\t\t\t255\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Dagger\tknif\t\tdgr\tdgr\tdgr\t0\t\t2\t1\t0\txxx\t\t\t1\t4\t\t\t\t\t\t\t\t-20\t75\t75\t\t\t16\t\t3\t0\t0\t60\t4180\t\t\tdgr\t9dg\t7dg\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdgr\tinvdgr\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tkri\tbld\t1\t0\t\n";
-                ss << u8"Dirk\tknif\t\tdir\tdir\tdir\t0\t\t2\t1\t0\txxx\t\t\t3\t9\t\t\t\t\t\t\t\t\t75\t75\t\t25\t20\t\t9\t0\t0\t532\t11788\t\t\tdir\t9di\t7di\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdir\tinvdir\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tkri\tbld\t1\t0\t\n";
-                ss << u8"Kriss\tknif\t\tkri\tdir\tkri\t0\t\t2\t1\t0\txxx\t\t\t2\t11\t\t\t\t\t\t\t\t-20\t75\t75\t\t45\t24\t\t17\t0\t0\t1227\t31859\t\t\tkri\t9kr\t7kr\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpkrs\tinvkrs\tinvkrsu\tinvkrsu\t1\t3\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t20\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Blade\tknif\t\tbld\tdgr\tbld\t0\t\t3\t1\t0\txxx\t\t\t4\t15\t\t\t\t\t\t\t\t-10\t75\t75\t35\t51\t24\t\t23\t0\t0\t1764\t54572\t\t\tbld\t9bl\t7bl\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpbld\tinvbld\t\t\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t20\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Throwing Knife\ttkni\t\ttkf\tdgr\ttkf\t0\t\t2\t1\t0\txxx\t\t\t2\t3\t\t\t\t\t4\t9\t\t\t75\t75\t\t21\t4\t\t2\t0\t0\t6\t3512\t\t\ttkf\t9tk\t7tk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t60\t240\t120\tflptkn\tinvtkn\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t1\t2\t\t\t255\t1\t2\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t2\t0\tbkf\tbkf\t1\t0\t\n";
-                ss << u8"Throwing Axe\ttaxe\t\ttax\thax\ttax\t0\t\t2\t1\t0\txxx\t\t\t4\t7\t\t\t\t\t8\t12\t\t10\t75\t75\t\t40\t6\t\t7\t0\t0\t11\t6077\t\t\ttax\t9ta\t7ta\t1hs\t1hs\t5\t1hsl\t1\t2\t1\t24\t200\t48\tflptax\tinvtax\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t1\t1\t\t\t255\t1\t2\t\t\t20\t\t\t\t\t255\t1\t1\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t2\t2\t0\tbal\tbal\t1\t0\t\n";
-                ss << u8"Balanced Knife\ttkni\t\tbkf\tdgr\tbkf\t0\t\t2\t1\t0\txxx\t\t\t1\t8\t\t\t\t\t6\t11\t\t-20\t75\t75\t\t51\t8\t\t13\t0\t0\t15\t9195\t\t\tbkf\t9bk\t7bk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t45\t240\t90\tflpbkf\tinvbkf\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t1\t2\t3\t\t\t1\t1\t2\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Balanced Axe\ttaxe\t\tbal\thax\tbal\t0\t\t2\t1\t0\txxx\t\t\t5\t10\t\t\t\t\t12\t15\t\t-10\t75\t75\t\t57\t10\t\t16\t0\t0\t35\t11060\t\t\tbal\t9b8\t7b8\t1hs\t1hs\t5\t1hsl\t2\t3\t1\t24\t200\t36\tflpbal\tinvbal\t\t\t\t\t0\tprimarily thrown\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t1\t2\t3\t\t\t1\t1\t2\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Javelin\tjave\t\tjav\tjav\tjav\t0\t\t4\t1\t0\txxx\t\t\t1\t5\t\t\t\t\t6\t14\t2\t-10\t75\t75\t\t\t2\t\t1\t0\t0\t5\t3005\t\t\tjav\t9ja\t7ja\t1ht\t1ht\t5\t1ht\t1\t3\t1\t45\t90\t90\tflpjav\tinvjav\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t1\t7\t2\t0\t3\t2\t3\t\t\t255\t1\t2\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t1\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t5\t8\t0\tglv\tglv\t1\t0\t\n";
-                ss << u8"Pilum\tjave\t\tpil\tpil\tpil\t0\t\t4\t1\t0\txxx\t\t\t4\t9\t\t\t\t\t7\t20\t2\t\t75\t75\t\t45\t3\t\t10\t0\t0\t18\t7680\t\t\tpil\t9pi\t7pi\t1ht\t1ht\t5\t1ht\t1\t3\t1\t40\t75\t75\tflppil\tinvpil\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t1\t1\t\t\t20\t\t\t\t\t255\t1\t1\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t1\t1\t1\t\t\t255\t1\t1\t\t\t255\t1\t1\t1\t2\t20\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t5\t8\t0\ttsp\ttsp\t1\t0\t\n";
-                ss << u8"Short Spear\tjave\t\tssp\tjav\tssp\t0\t\t4\t1\t0\txxx\t\t\t2\t13\t\t\t\t\t10\t22\t2\t10\t75\t75\t40\t40\t4\t\t15\t0\t0\t24\t10360\t\t\tssp\t9s9\t7s7\t1ht\t1ht\t5\t1ht\t1\t3\t1\t30\t60\t60\tflpssp\tinvssp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t1\t7\t2\t0\t3\t\t\t\t\t255\t\t\t1\t2\t30\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t5\t8\t0\ttsp\ttsp\t1\t0\t\n";
-                ss << u8"Glaive\tjave\t\tglv\tglv\tglv\t0\t\t4\t1\t0\txxx\t\t\t5\t17\t\t\t\t\t16\t22\t2\t20\t75\t75\t52\t35\t5\t\t23\t0\t0\t36\t14828\t\t\tglv\t9gl\t7gl\t1ht\t1ht\t5\t1ht\t1\t4\t1\t24\t60\t60\tflpglv\tinvglv\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t2\t2\t30\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Throwing Spear\tjave\t\ttsp\tpil\ttsp\t0\t\t4\t1\t0\txxx\t\t\t5\t15\t\t\t\t\t12\t30\t2\t-10\t75\t75\t\t65\t6\t\t29\t0\t0\t48\t18392\t\t\ttsp\t9ts\t7ts\t1ht\t1ht\t5\t1ht\t1\t4\t1\t48\t120\t120\tflptsp\tinvtsp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Spear\tspea\t\tspr\tspr\tspr\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t3\t15\t\t\t3\t-10\t100\t\t\t20\t30\t\t5\t0\t0\t300\t6500\t\t\tspr\t9sr\t7sr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspr\tinvspr\t\t\t1\t3\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tspt\tpik\t1\t0\t\n";
-                ss << u8"Trident\tspea\t\ttri\ttri\ttri\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t9\t15\t\t\t3\t\t100\t\t38\t24\t35\t\t9\t0\t0\t683\t13147\t\t\ttri\t9tr\t7tr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflptri\tinvtri\tinvtriu\tinvtriu\t1\t4\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tspt\tpik\t1\t0\t\n";
-                ss << u8"Brandistock\tspea\t\tbrn\tbrn\tbrn\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t7\t17\t\t\t4\t-20\t100\t\t40\t50\t28\t\t16\t0\t0\t1162\t29092\t\t\tbrn\t9br\t7br\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpbrn\tinvbrn\t\t\t1\t5\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\tpik\t1\t0\t\n";
-                ss << u8"Spetum\tspea\t\tspt\ttri\tspt\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t15\t23\t\t\t4\t\t100\t\t54\t35\t28\t\t20\t0\t0\t1672\t45940\t\t\tspt\t9st\t7st\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspt\tinvspt\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Pike\tspea\t\tpik\tpik\tpik\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t14\t63\t\t\t4\t20\t100\t\t60\t45\t25\t\t24\t0\t0\t2023\t63052\t\t\tpik\t9p9\t7p7\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvpik\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t30\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t255\t\t1\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bardiche\tpole\t\tbar\thal\tbar\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t1\t27\t\t\t2\t10\t100\t\t40\t\t50\t\t5\t0\t0\t302\t6510\t\t\tbar\t9b7\t7o7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpbar\tinvbar\t\t\t1\t3\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\thal\twsc\t1\t0\t\n";
-                ss << u8"Voulge\tpole\t\tvou\thal\tvou\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t6\t21\t\t\t2\t\t100\t\t50\t\t50\t\t11\t0\t0\t611\t14721\t\t\tvou\t9vo\t7vo\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpvou\tinvvou\t\t\t1\t4\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\thal\twsc\t1\t0\t\n";
-                ss << u8"Scythe\tpole\t\tscy\tscy\tscy\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t8\t20\t\t\t1\t-10\t100\t\t41\t41\t65\t\t15\t0\t0\t848\t22720\t\t\tscy\t9s8\t7s8\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpscy\tinvscy\tinvscyu\tinvscyu\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t1\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\thal\twsc\t1\t0\t\n";
-                ss << u8"Poleaxe\tpole\t\tpax\thal\tpax\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t18\t39\t\t\t3\t10\t100\t\t62\t\t65\t\t21\t0\t0\t1701\t48721\t\t\tpax\t9pa\t7pa\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflppax\tinvpax\t\t\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Halberd\tpole\t\thal\tpax\thal\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t12\t45\t\t\t4\t\t100\t\t75\t47\t55\t\t29\t0\t0\t2706\t95474\t\t\thal\t9h9\t7h7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflphal\tinvhal\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Scythe\tpole\t\twsc\tscy\twsc\t0\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t15\t36\t\t\t4\t-10\t100\t\t80\t80\t55\t\t34\t0\t0\t3388\t134692\t\t\twsc\t9wc\t7wc\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpwsc\tinvwsc\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t20\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Short Staff\tstaf\t\tsst\tbst\tsst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t1\t5\t\t\t1\t-10\t100\t\t\t\t20\t\t1\t0\t0\t168\t3168\t1\t\tsst\t8ss\t6ss\tstf\tstf\t5\tclub\t1\t3\t\t\t\t\tflpsst\tinvsst\t\t\t1\t2\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t5\t9\t5\t9\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tcst\tbst\t1\t0\t\n";
-                ss << u8"Long Staff\tstaf\t\tlst\tsst\tlst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t2\t8\t\t\t1\t\t100\t\t\t\t30\t\t8\t0\t0\t463\t10204\t1\t\tlst\t8ls\t6ls\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflplst\tinvlst\t\t\t1\t3\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t1\t2\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t2\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tcst\twst\t1\t0\t\n";
-                ss << u8"Gnarled Staff\tstaf\t\tcst\tcst\tcst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t4\t12\t\t\t1\t10\t100\t\t\t\t35\t\t12\t0\t0\t766\t17692\t1\t\tcst\t8cs\t6cs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpcst\tinvcst\tinvcstu\tinvcstu\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t5\t9\t1\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t2\t5\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\twst\t1\t0\t\n";
-                ss << u8"Battle Staff\tstaf\t\tbst\tsst\tbst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t13\t\t\t1\t\t100\t\t\t\t40\t\t17\t0\t0\t1223\t31791\t1\t\tbst\t8bs\t6bs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpbst\tinvbst\t\t\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t2\t5\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t1\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t1\t4\t20\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Staff\tstaf\t\twst\tlst\twst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t12\t28\t\t\t1\t20\t100\t\t\t\t50\t\t24\t0\t0\t1985\t62140\t1\t\twst\t8ws\t6ws\tstf\tstf\t5\tstaf\t2\t4\t\t\t\t\tflpwst\tinvwst\t\t\t1\t6\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t4\t20\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Short Bow\tbow\t\tsbw\tsbw\tsbw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t1\t4\t\t\t\t5\t\t100\t\t15\t20\t1\t1\t0\t0\t100\t3100\t\t\tsbw\t8sb\t6sb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbw\tinvsbw\t\t\t1\t3\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\thbw\tcbw\t1\t0\t\n";
-                ss << u8"Hunter's Bow\tbow\t\thbw\tsbw\thbw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t2\t6\t\t\t\t-10\t\t100\t\t28\t32\t1\t5\t0\t0\t350\t6750\t\t\thbw\t8hb\t6hb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflphbw\tinvhbw\t\t\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t1\t1\t1\t1\t1\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tlbw\tsbb\t1\t0\t\n";
-                ss << u8"Long Bow\tbow\t\tlbw\tlbw\tlbw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t3\t10\t\t\t\t\t\t100\t22\t19\t28\t1\t8\t0\t0\t490\t10420\t\t\tlbw\t8lb\t6lb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbw\tinvlbw\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tcbw\tlbb\t1\t0\t\n";
-                ss << u8"Composite Bow\tbow\t\tcbw\tlbw\tcbw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t4\t8\t\t\t\t-10\t\t100\t25\t35\t36\t1\t12\t0\t0\t727\t17224\t\t\tcbw\t8cb\t6cb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpcbw\tinvcbw\tinvcbwu\tinvcbwu\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t255\t\t1\t\t\t255\t\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tsbb\tswb\t1\t0\t\n";
-                ss << u8"Short Battle Bow\tbow\t\tsbb\tsbb\tsbb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t5\t11\t\t\t\t\t\t100\t30\t40\t40\t1\t18\t0\t0\t1045\t30310\t\t\tsbb\t8s8\t6s7\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbb\tinvsbb\tinvsbbu\tinvsbbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tlbb\tlwb\t1\t0\t\n";
-                ss << u8"Long Battle Bow\tbow\t\tlbb\tlbb\tlbb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t3\t18\t\t\t\t10\t\t100\t40\t50\t44\t1\t23\t0\t0\t1545\t49535\t\t\tlbb\t8l8\t6l7\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbb\tinvlbb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tswb\tlwb\t1\t0\t\n";
-                ss << u8"Short War Bow\tbow\t\tswb\tsbb\tswb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t14\t\t\t\t\t\t100\t35\t55\t48\t1\t27\t0\t0\t2500\t83500\t\t\tswb\t8sw\t6sw\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpswb\tinvswb\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t20\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tlwb\txxx\t1\t0\t\n";
-                ss << u8"Long War Bow\tbow\t\tlwb\tlbb\tlwb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t3\t23\t\t\t\t10\t\t100\t50\t65\t55\t1\t31\t0\t0\t3575\t128825\t\t\tlwb\t8lw\t6lw\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplwb\tinvlwb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Light Crossbow\txbow\t\tlxb\tlxb\tlxb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t9\t\t\t\t-10\t\t100\t21\t27\t30\t1\t6\t0\t0\t803\t10318\t\t\tlxb\t8lx\t6lx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflplxb\tinvlxb\tinvlxbu\tinvlxbu\t1\t3\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tmxb\trxb\t1\t0\t\n";
-                ss << u8"Crossbow\txbow\t\tmxb\tlxb\tmxb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t9\t16\t\t\t\t\t\t100\t40\t33\t40\t1\t15\t0\t0\t2345\t45175\t\t\tmxb\t8mx\t6mx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflpmxb\tinvmxb\tinvmxbu\tinvmxbu\t1\t4\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\thxb\thxb\t1\t0\t\n";
-                ss << u8"Heavy Crossbow\txbow\t\thxb\thxb\thxb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t26\t\t\t\t10\t\t100\t60\t40\t50\t1\t24\t0\t0\t4096\t112804\t\t\thxb\t8hx\t6hx\txbw\txbw\t5\txbow\t2\t4\t\t\t\t\tflphxb\tinvhxb\tinvhxbu\tinvhxbu\t1\t6\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Repeating Crossbow\txbow\t\trxb\thxb\trxb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t12\t\t\t\t-40\t\t100\t40\t50\t40\t1\t33\t0\t0\t2739\t109387\t\t\trxb\t8rx\t6rx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflprxb\tinvrxb\tinvrxbu\tinvrxbu\t1\t5\t0\tfires 5 shots before reload\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Rancid Gas Potion\ttpot\t\tgps\tgpl\tgps\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t32\t0\t24\t200\t0\t\t\tgps\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpgpl\tinvgpl\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t49\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n";
-                ss << u8"Oil Potion\ttpot\t\tops\topl\tops\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t28\t0\t20\t150\t0\t\t\tops\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpopl\tinvopl\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t46\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n";
-                ss << u8"Choking Gas Potion\ttpot\t\tgpm\tgps\tgpm\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t20\t0\t16\t120\t0\t\t\tgpm\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpgps\tinvgpm\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t48\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n";
-                ss << u8"Exploding Potion\ttpot\t\topm\topl\topm\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t16\t0\t12\t80\t0\t\t\topm\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpops\tinvopm\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t45\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n";
-                ss << u8"Strangling Gas Potion\ttpot\t\tgpl\tgps\tgpl\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t8\t0\t6\t40\t0\t\t\tgpl\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpgps\tinvgps\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t47\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n";
-                ss << u8"Fulminating Potion\ttpot\t\topl\tops\topl\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t4\t0\t0\t24\t0\t\t\topl\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpops\tinvops\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t44\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n";
-                ss << u8"Decoy Gidbinn\tknif\t\td33\tdgr\td33\t0\t\t\t\t0\txxx\t\t\t1\t2\t\t\t\t\t\t\t\t-20\t100\t\t15\t20\t10\t\t0\t0\t0\t666\t0\t\t\td33\t\t\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpd33\tinvd33\t\t\t\t\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t1\t0\t5\t0\t0\t0\t18\t1\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t0\t0\t\n";
-                ss << u8"The Gidbinn\tknif\t\tg33\tdgr\tg33\t0\t\t\t\t0\txxx\t\t\t3\t7\t\t\t\t\t\t\t\t-20\t100\t\t15\t25\t30\t\t0\t0\t0\t666\t0\t\t\tg33\t\t\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpg33\tinvg33\t\t\t\t\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t1\t0\t5\t0\t0\t0\t18\t1\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t0\t0\t\n";
-                ss << u8"Wirt's Leg\tclub\t\tleg\tclb\tleg\t0\t\t\t\t0\txxx\t\t\t2\t8\t\t\t\t\t\t\t\t-10\t100\t\t\t\t66\t\t0\t0\t0\t20\t0\t\t\tleg\t\t\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpleg\tinvleg\t\t\t1\t3\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t1\t1\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Horadric Malus\thamm\t\thdm\twhm\thdm\t0\t\t\t\t0\txxx\t\t\t6\t15\t\t\t\t\t\t\t\t20\t100\t\t15\t15\t55\t\t0\t0\t0\t600\t0\t\t\thdm\t\t\t1hs\t1hs\t5\t1hsl\t1\t2\t\t\t\t\tflphmr\tinvhmr\t\t\t\t\t0\t\t0\titem_sword\t12\titem_sword\t1\t0\t5\t0\t0\t0\t4\t1\t0\t7\t0\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t0\t0\t\n";
-                ss << u8"Hellforge Hammer\thamm\t\thfh\twhm\thfh\t0\t\t\t\t0\txxx\t\t\t6\t15\t\t\t\t\t\t\t\t\t100\t\t\t\t55\t\t0\t0\t0\t600\t0\t\t\thfh\t\t\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflphmr\tinvhfh\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t1\t0\t5\t0\t0\t0\t25\t1\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t1\txxx\txxx\t0\t0\t\n";
-                ss << u8"Horadric Staff\tstaf\t\thst\tbst\thst\t0\t\t\t\t0\txxx\t\t\t\t\t\t1\t12\t20\t\t\t2\t\t100\t\t30\t\t50\t\t0\t0\t0\t1223\t0\t\t\thst\t\t\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflphst\tinvhst\t\t\t\t\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t1\t0\t5\t0\t0\t0\t10\t1\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t1\txxx\txxx\t0\t0\t\n";
-                ss << u8"Staff of Kings\tstaf\t\tmsf\tbst\tmsf\t0\t\t\t\t0\txxx\t\t\t\t\t\t1\t10\t15\t\t\t2\t\t100\t\t25\t\t45\t\t0\t0\t0\t1223\t0\t\t\tmsf\t\t\tstf\tstf\t5\tstaf\t1\t3\t\t\t\t\tflpmsf\tinvmsf\t\t\t\t\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t1\t0\t5\t0\t0\t0\t10\t1\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t1\txxx\txxx\t0\t0\t\n";
-                ss << u8"Hatchet\taxe\t\t9ha\thax\t9ha\t0\t\t3\t1\t0\txxx\t\t\t10\t21\t\t\t\t\t\t\t\t\t100\t\t25\t25\t28\t\t31\t0\t19\t810\t43110\t\t\thax\t9ha\t7ha\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflphax\tinvhax\tinvhaxu\tinvhaxu\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cleaver\taxe\t\t9ax\taxe\t9ax\t0\t\t4\t1\t0\txxx\t\t\t10\t33\t\t\t\t\t\t\t1\t10\t100\t\t68\t\t24\t\t34\t0\t22\t1509\t70806\t\t\taxe\t9ax\t7ax\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpaxe\tinvaxe\tinvaxeu\tinvaxeu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Twin Axe\taxe\t\t92a\taxe\t92a\t0\t\t4\t1\t0\txxx\t\t\t13\t38\t\t\t\t\t\t\t1\t10\t100\t\t85\t\t24\t\t39\t0\t25\t2919\t135841\t\t\t2ax\t92a\t72a\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflp2ax\tinv2ax\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Crowbill\taxe\t\t9mp\taxe\t9mp\t0\t\t4\t1\t0\txxx\t\t\t14\t34\t\t\t\t\t\t\t1\t-10\t100\t\t94\t70\t26\t\t43\t0\t25\t4563\t220209\t\t\tmpi\t9mp\t7mp\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpmpi\tinvmpi\tinvmpiu\tinvmpiu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Naga\taxe\t\t9wa\thax\t9wa\t0\t\t4\t1\t0\txxx\t\t\t16\t45\t\t\t\t\t\t\t2\t\t100\t\t121\t\t26\t\t48\t0\t25\t6669\t346612\t\t\twax\t9wa\t7wa\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwax\tinvwax\t\t\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Military Axe\taxe\t\t9la\tlax\t9la\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t14\t34\t\t\t1\t-10\t100\t\t73\t\t30\t\t34\t0\t22\t1362\t65808\t\t\tlax\t9la\t7la\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflplax\tinvlax\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bearded Axe \taxe\t\t9ba\tlax\t9ba\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t21\t49\t\t\t1\t\t100\t\t92\t\t35\t\t38\t0\t25\t2718\t124784\t\t\tbax\t9ba\t7ba\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbrx\tinvbrx\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Tabar\taxe\t\t9bt\tbtx\t9bt\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t24\t77\t\t\t1\t10\t100\t\t101\t\t40\t\t42\t0\t25\t4086\t195112\t\t\tbtx\t9bt\t7bt\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbtx\tinvbtx\tinv9btu\tinv9btu\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Gothic Axe\taxe\t\t9ga\tbtx\t9ga\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t18\t70\t\t\t2\t-10\t100\t\t115\t79\t50\t\t46\t0\t25\t6048\t303708\t\t\tgax\t9ga\t7ga\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpgax\tinvgax\tinvgaxu\tinvgaxu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ancient Axe\taxe\t\t9gi\tgix\t9gi\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t43\t85\t\t\t3\t10\t100\t\t125\t\t50\t\t51\t0\t25\t7530\t412030\t\t\tgix\t9gi\t7gi\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgix\tinvgix\tinv9giu\tinv9giu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Burnt Wand\twand\t\t9wn\twnd\t9wn\t0\t\t1\t1\t0\txxx\t\t\t8\t18\t\t\t\t\t\t\t\t\t100\t\t25\t\t15\t\t31\t0\t19\t915\t46365\t1\t\twnd\t9wn\t7wn\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpwnd\tinvwnd\t\t\t1\t1\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Petrified Wand\twand\t\t9yw\tywn\t9yw\t0\t\t1\t1\t0\txxx\t\t\t8\t24\t\t\t\t\t\t\t\t10\t100\t\t25\t\t15\t\t38\t0\t25\t2535\t117830\t1\t\tywn\t9yw\t7yw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpywn\tinvywn\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Tomb Wand\twand\t\t9bw\tbwn\t9bw\t0\t\t1\t1\t0\txxx\t\t\t10\t22\t\t\t\t\t\t\t\t-20\t100\t\t25\t\t15\t\t43\t0\t25\t4188\t204084\t1\t\tbwn\t9bw\t7bw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpbwn\tinvbwn\tinvbwnu\tinvbwnu\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Grave Wand\twand\t\t9gw\tbwn\t9gw\t0\t\t1\t1\t0\txxx\t\t\t13\t29\t\t\t\t\t\t\t\t\t100\t\t25\t\t15\t\t49\t0\t25\t6594\t350106\t1\t\tgwn\t9gw\t7gw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpgwn\tinvgwn\tinv9gwu\tinv9gwu\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cudgel\tclub\t\t9cl\tclb\t9cl\t0\t\t1\t1\t0\txxx\t\t\t6\t21\t\t\t\t\t\t\t\t-10\t100\t\t25\t\t24\t\t30\t0\t18\t396\t29380\t\t\tclb\t9cl\t7cl\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpclb\tinvclb\tinvclbu\tinvclbu\t1\t2\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Rune Scepter\tscep\t\t9sc\tmac\t9sc\t0\t\t2\t1\t0\txxx\t\t\t13\t24\t\t\t\t\t\t\t\t\t100\t\t58\t\t50\t\t31\t0\t19\t1350\t59850\t\t\tscp\t9sc\t7sc\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpscp\tinvscp\t\t\t1\t2\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Holy Water Sprinkler\tscep\t\t9qs\tmac\t9qs\t0\t\t4\t1\t0\txxx\t\t\t14\t36\t\t\t\t\t\t\t1\t10\t100\t\t76\t\t60\t\t40\t0\t25\t3627\t167580\t\t\tgsc\t9qs\t7qs\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpgsc\tinvgsc\t\t\t1\t3\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Divine Scepter\tscep\t\t9ws\twhm\t9ws\t0\t\t4\t1\t0\txxx\t\t\t16\t38\t\t\t\t\t\t\t1\t-10\t100\t\t103\t\t70\t\t45\t0\t25\t7269\t352105\t\t\twsp\t9ws\t7ws\t1hs\t1hs\t5\tclub\t2\t3\t\t\t\t\tflpwsp\tinvwsp\t\t\t1\t5\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Barbed Club\tclub\t\t9sp\tclb\t9sp\t0\t\t3\t1\t0\txxx\t\t\t13\t25\t\t\t\t\t\t\t1\t\t100\t\t30\t\t36\t\t32\t0\t20\t975\t49700\t\t\tspc\t9sp\t7sp\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpspc\tinvspc\tinvspcu\tinvspcu\t1\t3\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Flanged Mace\tmace\t\t9ma\tmac\t9ma\t0\t\t4\t1\t0\txxx\t\t\t15\t23\t\t\t\t\t\t\t\t\t100\t\t61\t\t60\t\t35\t0\t23\t1689\t79115\t\t\tmac\t9ma\t7ma\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmac\tinvmac\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Jagged Star\tmace\t\t9mt\tmac\t9mt\t0\t\t4\t1\t0\txxx\t\t\t20\t31\t\t\t\t\t\t\t1\t10\t100\t\t74\t\t72\t\t39\t0\t25\t2832\t132448\t\t\tmst\t9mt\t7mt\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmst\tinvmst\tinvmstu\tinvmstu\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Knout\tmace\t\t9fl\tfla\t9fl\t0\t\t4\t1\t0\txxx\t\t\t13\t35\t\t\t\t\t\t\t2\t-10\t100\t\t82\t73\t30\t\t43\t0\t25\t4536\t219048\t\t\tfla\t9fl\t7fl\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvfla\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Battle Hammer\thamm\t\t9wh\twhm\t9wh\t0\t\t4\t1\t0\txxx\t\t\t35\t58\t\t\t\t\t\t\t\t20\t110\t\t100\t\t55\t\t48\t0\t25\t6543\t340564\t\t\twhm\t9wh\t7wh\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwhm\tinvwhm\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t178\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Club\thamm\t\t9m9\tmau\t9m9\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t53\t78\t\t\t1\t10\t110\t\t124\t\t60\t\t45\t0\t25\t5310\t263950\t\t\tmau\t9m9\t7m7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpmau\tinvmau\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Martel de Fer\thamm\t\t9gm\tmau\t9gm\t0\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t61\t99\t\t\t2\t20\t110\t\t169\t\t60\t\t53\t0\t25\t9945\t556085\t\t\tgma\t9gm\t7gm\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgma\tinvgma\tinv9gmu\tinv9gmu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Gladius\tswor\t\t9ss\tssd\t9ss\t0\t\t3\t1\t0\txxx\t\t\t8\t22\t\t\t\t\t\t\t\t\t100\t\t25\t\t24\t\t30\t0\t18\t516\t32980\t\t\tssd\t9ss\t7ss\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpssd\tinvssd\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cutlass\tswor\t\t9sm\tscm\t9sm\t0\t\t3\t1\t0\txxx\t\t\t8\t21\t\t\t\t\t\t\t\t-30\t100\t\t25\t52\t22\t\t43\t0\t25\t1122\t72246\t\t\tscm\t9sm\t7sm\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpscm\tinvscm\tinvscmu\tinvscmu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Shamshir\tswor\t\t9sb\tscm\t9sb\t0\t\t3\t1\t0\txxx\t\t\t10\t24\t\t\t\t\t\t\t\t-10\t100\t\t58\t58\t32\t\t35\t0\t23\t1698\t79430\t\t\tsbr\t9sb\t7sb\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpsbr\tinvsbr\tinvsbru\tinvsbru\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Tulwar\tswor\t\t9fc\tflc\t9fc\t0\t\t4\t1\t0\txxx\t\t\t16\t35\t\t\t\t\t\t\t\t20\t100\t\t70\t42\t32\t\t37\t0\t25\t2349\t107913\t\t\tflc\t9fc\t7fc\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpflc\tinvflc\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Dimensional Blade\tswor\t\t9cr\tcrs\t9cr\t0\t\t2\t1\t0\txxx\t\t\t13\t35\t\t\t\t\t\t\t1\t\t100\t\t85\t60\t20\t\t37\t0\t25\t6681\t268197\t\t\tcrs\t9cr\t7cr\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpcrs\tinvcrs\tinv9cru\tinv9cru\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t5\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Battle Sword\tswor\t\t9bs\tbsd\t9bs\t0\t\t4\t1\t0\txxx\t\t\t16\t34\t\t\t\t\t\t\t\t\t100\t\t92\t43\t32\t\t40\t0\t25\t3387\t157980\t\t\tbsd\t9bs\t7bs\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpbsd\tinvbsd\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Rune Sword\tswor\t\t9ls\tlsd\t9ls\t0\t\t4\t1\t0\txxx\t\t\t10\t42\t\t\t\t\t\t\t1\t-10\t100\t\t103\t79\t44\t\t44\t0\t25\t4860\t238340\t\t\tlsd\t9ls\t7ls\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflplsd\tinvlsd\tinv9lsu\tinv9lsu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ancient Sword\tswor\t\t9wd\tflc\t9wd\t0\t\t4\t1\t0\txxx\t\t\t18\t43\t\t\t\t\t\t\t1\t\t100\t\t127\t88\t44\t\t49\t0\t25\t6291\t335259\t\t\twsd\t9wd\t7wd\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpwsd\tinvwsd\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Espandon\tswor\t\t92h\tclm\t92h\t0\t\t4\t1\t0\txxx\t\t\t8\t26\t1\t1\t18\t40\t\t\t2\t\t100\t\t73\t61\t44\t\t37\t0\t25\t2232\t103584\t\t\t2hs\t92h\t72h\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflp2hs\tinv2hs\tinv2hsu\tinv2hsu\t1\t3\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Dacian Falx\tswor\t\t9cm\tclm\t9cm\t0\t\t4\t1\t0\txxx\t\t\t13\t30\t1\t1\t26\t61\t\t\t2\t10\t100\t\t91\t20\t50\t\t42\t0\t25\t4086\t195112\t\t\tclm\t9cm\t7cm\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpclm\tinvclm\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Tusk Sword\tswor\t\t9gs\tgsd\t9gs\t0\t\t4\t1\t0\txxx\t\t\t10\t37\t1\t1\t19\t58\t\t\t2\t\t100\t\t104\t71\t50\t\t45\t0\t25\t4677\t235465\t\t\tgis\t9gs\t7gs\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpgis\tinvgis\tinvgisu\tinvgisu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Gothic Sword\tswor\t\t9b9\tclm\t9b9\t0\t\t4\t1\t0\txxx\t\t\t14\t40\t1\t1\t39\t60\t\t\t1\t10\t100\t\t113\t20\t40\t\t48\t0\t25\t6213\t324724\t\t\tbsw\t9b9\t7b7\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpbsw\tinvbsw\tinvbswu\tinvbswu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Zweihander\tswor\t\t9fb\tclm\t9fb\t0\t\t4\t1\t0\txxx\t\t\t19\t35\t1\t1\t29\t54\t\t\t2\t-10\t100\t\t125\t94\t50\t\t49\t0\t25\t7500\t394500\t\t\tflb\t9fb\t7fb\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpflb\tinvflb\tinv9fbu\tinv9fbu\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Executioner Sword\tswor\t\t9gd\tgsd\t9gd\t0\t\t4\t1\t0\txxx\t\t\t24\t40\t1\t1\t47\t80\t\t\t2\t10\t100\t\t170\t110\t50\t\t54\t0\t25\t10653\t604762\t\t\tgsd\t9gd\t7gd\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpgsd\tinvgsd\tinvgsdu\tinvgsdu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Poignard\tknif\t\t9dg\tdgr\t9dg\t0\t\t2\t1\t0\txxx\t\t\t6\t18\t\t\t\t\t\t\t\t-20\t75\t75\t25\t\t16\t\t31\t0\t19\t480\t32880\t\t\tdgr\t9dg\t7dg\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdgr\tinvdgr\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Rondel\tknif\t\t9di\tdir\t9di\t0\t\t2\t1\t0\txxx\t\t\t10\t26\t\t\t\t\t\t\t\t\t75\t75\t25\t58\t20\t\t36\t0\t24\t1896\t88756\t\t\tdir\t9di\t7di\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdir\tinvdir\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cinquedeas\tknif\t\t9kr\tdir\t9kr\t0\t\t2\t1\t0\txxx\t\t\t15\t31\t\t\t\t\t\t\t\t-20\t75\t75\t25\t88\t24\t\t42\t0\t25\t3981\t190702\t\t\tkri\t9kr\t7kr\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpkrs\tinvkrs\tinvkrsu\tinvkrsu\t1\t3\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Stilleto\tknif\t\t9bl\tdgr\t9bl\t0\t\t3\t1\t0\txxx\t\t\t19\t36\t\t\t\t\t\t\t\t-10\t75\t75\t47\t97\t24\t\t46\t0\t25\t5592\t282732\t\t\tbld\t9bl\t7bl\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpbld\tinvbld\tinv9blu\tinv9blu\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Battle Dart\ttkni\t\t9tk\tdgr\t9tk\t0\t\t2\t1\t0\txxx\t\t\t8\t16\t\t\t\t\t11\t24\t\t\t75\t75\t25\t52\t6\t\t31\t0\t19\t80\t20480\t\t\ttkf\t9tk\t7tk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t60\t240\t120\tflptkn\tinvtkn\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Francisca\ttaxe\t\t9ta\thax\t9ta\t0\t\t2\t1\t0\txxx\t\t\t11\t22\t\t\t\t\t18\t33\t\t10\t75\t75\t25\t80\t15\t\t34\t0\t22\t90\t22560\t\t\ttax\t9ta\t7ta\t1hs\t1hs\t5\t1hsl\t1\t2\t1\t24\t200\t48\tflptax\tinvtax\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Dart\ttkni\t\t9bk\tdgr\t9bk\t0\t\t2\t1\t0\txxx\t\t\t6\t24\t\t\t\t\t14\t27\t\t-20\t75\t75\t25\t97\t20\t\t39\t0\t25\t100\t25900\t\t\tbkf\t9bk\t7bk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t45\t240\t90\tflpbkf\tinvbkf\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hurlbat\ttaxe\t\t9b8\thax\t9b8\t0\t\t2\t1\t0\txxx\t\t\t13\t27\t\t\t\t\t24\t34\t\t-10\t75\t75\t25\t106\t16\t\t41\t0\t25\t110\t27510\t\t\tbal\t9b8\t7b8\t1hs\t1hs\t5\t1hsl\t2\t3\t1\t24\t200\t36\tflpbal\tinvbal\t\t\t\t\t0\tprimarily thrown\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Javelin\tjave\t\t9ja\tjav\t9ja\t0\t\t4\t1\t0\txxx\t\t\t6\t19\t\t\t\t\t14\t32\t2\t-10\t75\t75\t25\t25\t10\t\t30\t0\t18\t120\t21100\t\t\tjav\t9ja\t7ja\t1ht\t1ht\t5\t1ht\t1\t3\t1\t45\t90\t90\tflpjav\tinvjav\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t1\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Great Pilum\tjave\t\t9pi\tpil\t9pi\t0\t\t4\t1\t0\txxx\t\t\t11\t26\t\t\t\t\t16\t42\t2\t\t75\t75\t25\t88\t12\t\t37\t0\t25\t125\t25625\t\t\tpil\t9pi\t7pi\t1ht\t1ht\t5\t1ht\t1\t3\t1\t40\t75\t75\tflppil\tinvpil\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Simbilan\tjave\t\t9s9\tjav\t9s9\t0\t\t4\t1\t0\txxx\t\t\t8\t32\t\t\t\t\t27\t50\t2\t10\t75\t75\t80\t80\t14\t\t40\t0\t25\t135\t27900\t\t\tssp\t9s9\t7s7\t1ht\t1ht\t5\t1ht\t1\t3\t1\t30\t60\t60\tflpssp\tinvssp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Spiculum\tjave\t\t9gl\tglv\t9gl\t0\t\t4\t1\t0\txxx\t\t\t13\t38\t\t\t\t\t32\t60\t2\t20\t75\t75\t98\t73\t16\t\t46\t0\t25\t145\t32170\t\t\tglv\t9gl\t7gl\t1ht\t1ht\t5\t1ht\t1\t4\t1\t12\t30\t30\tflpglv\tinvglv\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Harpoon\tjave\t\t9ts\tpil\t9ts\t0\t\t4\t1\t0\txxx\t\t\t13\t35\t\t\t\t\t18\t54\t2\t-10\t75\t75\t25\t118\t18\t\t51\t0\t25\t150\t35650\t\t\ttsp\t9ts\t7ts\t1ht\t1ht\t5\t1ht\t1\t4\t1\t48\t120\t120\tflptsp\tinvtsp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Spear\tspea\t\t9sr\tspr\t9sr\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t10\t37\t\t\t3\t-10\t100\t\t25\t25\t30\t\t33\t0\t21\t1200\t58600\t\t\tspr\t9sr\t7sr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspr\tinvspr\t\t\t1\t3\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Fuscina\tspea\t\t9tr\ttri\t9tr\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t19\t37\t\t\t3\t\t100\t\t77\t25\t35\t\t36\t0\t24\t2349\t105064\t\t\ttri\t9tr\t7tr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflptri\tinvtri\tinvtriu\tinvtriu\t1\t4\t0\t2 square reach\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Fork\tspea\t\t9br\tbrn\t9br\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t16\t40\t\t\t4\t-20\t100\t\t80\t95\t28\t\t41\t0\t25\t3786\t178226\t\t\tbrn\t9br\t7br\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpbrn\tinvbrn\tinv9bru\tinv9bru\t1\t5\t0\t2 square reach\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Yari\tspea\t\t9st\ttri\t9st\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t29\t59\t\t\t4\t\t100\t\t101\t\t28\t\t44\t0\t25\t5316\t258404\t\t\tspt\t9st\t7st\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspt\tinvspt\t\t\t1\t6\t0\t2 square reach\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Lance\tspea\t\t9p9\tpik\t9p9\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t27\t114\t\t\t4\t20\t100\t\t110\t88\t25\t\t47\t0\t25\t6369\t325343\t\t\tpik\t9p9\t7p7\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvpik\t\t\t1\t6\t0\t3 square reach\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Lochaber Axe\tpole\t\t9b7\thal\t9b7\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t6\t58\t\t\t2\t10\t100\t\t80\t\t50\t\t33\t0\t21\t1206\t58798\t\t\tbar\t9b7\t7o7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpbar\tinvbar\t\t\t1\t3\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bill\tpole\t\t9vo\thal\t9vo\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t14\t53\t\t\t2\t\t100\t\t95\t\t50\t\t37\t0\t25\t2133\t99921\t\t\tvou\t9vo\t7vo\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpvou\tinvvou\t\t\t1\t4\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Battle Scythe\tpole\t\t9s8\tscy\t9s8\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t18\t45\t\t\t1\t-10\t100\t\t82\t82\t65\t\t40\t0\t25\t2844\t136260\t\t\tscy\t9s8\t7s8\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpscy\tinvscy\tinv9s8u\tinv9s8u\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Partizan\tpole\t\t9pa\thal\t9pa\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t34\t75\t\t\t3\t10\t100\t\t113\t67\t65\t\t35\t0\t23\t5403\t209105\t\t\tpax\t9pa\t7pa\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflppax\tinvpax\t\t\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bec-de-Corbin\tpole\t\t9h9\tpax\t9h9\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t13\t85\t\t\t4\t\t100\t\t133\t91\t55\t\t51\t0\t25\t8418\t457318\t\t\thal\t9h9\t7h7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflphal\tinvhal\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Grim Scythe\tpole\t\t9wc\tscy\t9wc\t0\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t30\t70\t\t\t4\t-10\t100\t\t140\t140\t55\t\t55\t0\t25\t10464\t605520\t\t\twsc\t9wc\t7wc\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpwsc\tinvwsc\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Jo Staff\tstaf\t\t8ss\tbst\t8ss\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t21\t\t\t1\t-10\t100\t\t25\t\t20\t\t30\t0\t18\t804\t41620\t1\t\tsst\t8ss\t6ss\tstf\tstf\t5\tclub\t1\t3\t\t\t\t\tflpsst\tinvsst\t\t\t1\t2\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Quarterstaff\tstaf\t\t8ls\tsst\t8ls\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t8\t26\t\t\t1\t\t100\t\t25\t\t30\t\t35\t0\t23\t1689\t79115\t1\t\tlst\t8ls\t6ls\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflplst\tinvlst\t\t\t1\t3\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cedar Staff\tstaf\t\t8cs\tcst\t8cs\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t11\t32\t\t\t1\t10\t100\t\t25\t\t35\t\t38\t0\t25\t2598\t120224\t1\t\tcst\t8cs\t6cs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpcst\tinvcst\tinvcstu\tinvcstu\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Gothic Staff\tstaf\t\t8bs\tsst\t8bs\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t34\t\t\t1\t\t100\t\t25\t\t40\t\t42\t0\t25\t3969\t190198\t1\t\tbst\t8bs\t6bs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpbst\tinvbst\t\t\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Rune Staff\tstaf\t\t8ws\tlst\t8ws\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t24\t58\t\t\t1\t20\t100\t\t25\t\t50\t\t47\t0\t25\t6255\t319985\t1\t\twst\t8ws\t6ws\tstf\tstf\t5\tstaf\t2\t4\t\t\t\t\tflpwst\tinvwst\tinv8wsu\tinv8wsu\t1\t6\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Edge Bow\tbow\t\t8sb\tsbw\t8sb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t19\t\t\t\t5\t\t100\t25\t43\t20\t1\t30\t0\t18\t600\t35500\t\t\tsbw\t8sb\t6sb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbw\tinvsbw\t\t\t1\t3\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Razor Bow\tbow\t\t8hb\tsbw\t8hb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t8\t22\t\t\t\t-10\t\t100\t25\t62\t32\t1\t33\t0\t21\t1350\t63550\t\t\thbw\t8hb\t6hb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflphbw\tinvhbw\t\t\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cedar Bow\tbow\t\t8lb\tlbw\t8lb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t10\t29\t\t\t\t\t\t100\t53\t49\t28\t1\t35\t0\t23\t1770\t81950\t\t\tlbw\t8lb\t6lb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbw\tinvlbw\tinv8lbu\tinv8lbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Double Bow\tbow\t\t8cb\tlbw\t8cb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t11\t26\t\t\t\t-10\t\t100\t58\t73\t36\t1\t39\t0\t25\t2481\t118759\t\t\tcbw\t8cb\t6cb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpcbw\tinvcbw\tinvcbwu\tinvcbwu\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Short Siege Bow\tbow\t\t8s8\tsbb\t8s8\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t13\t30\t\t\t\t\t\t100\t65\t80\t40\t1\t43\t0\t25\t3435\t171705\t\t\tsbb\t8s8\t6s7\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbb\tinvsbb\tinv8s8u\tinv8s8u\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Long Siege Bow\tbow\t\t8l8\tlbb\t8l8\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t10\t42\t\t\t\t10\t\t100\t80\t95\t44\t1\t46\t0\t25\t4935\t252510\t\t\tlbb\t8l8\t6l7\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbb\tinvlbb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Rune Bow\tbow\t\t8sw\tsbb\t8sw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t35\t\t\t\t\t\t100\t73\t103\t48\t1\t49\t0\t25\t7800\t409200\t\t\tswb\t8sw\t6sw\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpswb\tinvswb\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Gothic Bow\tbow\t\t8lw\tlbb\t8lw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t10\t50\t\t\t\t10\t\t100\t95\t118\t55\t1\t52\t0\t25\t11025\t601800\t\t\tlwb\t8lw\t6lw\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplwb\tinvlwb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Arbalest\txbow\t\t8lx\tlxb\t8lx\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t27\t\t\t\t-10\t\t100\t52\t61\t30\t1\t34\t0\t22\t2709\t111606\t\t\tlxb\t8lx\t6lx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflplxb\tinvlxb\tinv8lxu\tinv8lxu\t1\t3\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Siege Crossbow\txbow\t\t8mx\tlxb\t8mx\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t20\t42\t\t\t\t\t\t100\t80\t70\t40\t1\t40\t0\t25\t7335\t315900\t\t\tmxb\t8mx\t6mx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflpmxb\tinvmxb\tinv8mxu\tinv8mxu\t1\t4\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ballista\txbow\t\t8hx\thxb\t8hx\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t33\t55\t\t\t\t10\t\t100\t110\t80\t50\t1\t47\t0\t25\t12588\t617636\t\t\thxb\t8hx\t6hx\txbw\txbw\t5\txbow\t2\t4\t\t\t\t\tflphxb\tinvhxb\tinvhxbu\tinvhxbu\t1\t6\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Chu-Ko-Nu\txbow\t\t8rx\thxb\t8rx\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t32\t\t\t\t-60\t\t100\t80\t95\t40\t1\t54\t0\t25\t8517\t489418\t\t\trxb\t8rx\t6rx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflprxb\tinvrxb\tinvrxbu\tinvrxbu\t1\t5\t0\tfires 5 shots before reload\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Khalim's Flail\tmace\t\tqf1\tfla\tqf1\t0\t\t\t\t0\txxx\t\t\t1\t15\t\t\t\t\t\t\t\t-10\t100\t\t41\t35\t30\t\t0\t0\t0\t1412\t0\t\t\tfla\t\t\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvqf1\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t1\t0\t5\t0\t0\t0\t17\t1\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t1\txxx\txxx\t0\t0\t\n";
-                ss << u8"Khalim's Will\tmace\t\tqf2\tfla\tqf2\t0\t\t\t\t0\txxx\t\t\t1\t15\t\t\t\t\t\t\t\t-10\t100\t\t\t\t30\t\t0\t0\t0\t1412\t0\t\t\tfla\t\t\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvqf2\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t1\t0\t5\t0\t0\t0\t17\t1\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t1\txxx\txxx\t0\t0\t\n";
-                ss << u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                ss << u8"Katar\th2h\t\tktr\tktr\tktr\t100\t\t2\t1\t0\txxx\t\t\t4\t7\t\t\t\t\t\t\t1\t-10\t75\t75\t20\t20\t48\t\t1\t0\t0\t72\t3072\t\t\tktr\t9ar\t7ar\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t2\t\t1\t1\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\twrb\tbtl\t1\t0\t\n";
-                ss << u8"Wrist Blade\th2h\t\twrb\tktr\twrb\t100\t\t2\t1\t0\txxx\t\t\t5\t9\t\t\t\t\t\t\t1\t\t75\t75\t33\t33\t52\t\t9\t0\t0\t220\t8980\t\t\twrb\t9wb\t7wb\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t\t1\t1\t\t\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\taxf\tskr\t1\t0\t\n";
-                ss << u8"Hatchet Hands\th2h\t\taxf\taxf\taxf\t100\t\t2\t1\t0\txxx\t\t\t2\t15\t\t\t\t\t\t\t1\t10\t75\t75\t37\t37\t56\t\t12\t0\t0\t466\t14092\t\t\taxf\t9xf\t7xf\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tces\tclw\t1\t0\t\n";
-                ss << u8"Cestus\th2h\t\tces\taxf\tces\t100\t\t2\t1\t0\txxx\t\t\t7\t15\t\t\t\t\t\t\t1\t\t75\t75\t42\t42\t72\t\t15\t0\t0\t514\t17710\t\t\tces\t9cs\t7cs\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tclw\tbtl\t1\t0\t\n";
-                ss << u8"Claws\th2h\t\tclw\tclw\tclw\t100\t\t2\t1\t0\txxx\t\t\t8\t15\t\t\t\t\t\t\t1\t-10\t75\t75\t46\t46\t64\t\t18\t0\t0\t683\t23794\t\t\tclw\t9lw\t7lw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tbtl\txxx\t1\t0\t\n";
-                ss << u8"Blade Talons\th2h\t\tbtl\tclw\tbtl\t100\t\t2\t1\t0\txxx\t\t\t10\t14\t\t\t\t\t\t\t1\t-20\t75\t75\t50\t50\t69\t\t21\t0\t0\t847\t30787\t\t\tbtl\t9tw\t7tw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Scissors Katar\th2h\t\tskr\tskr\tskr\t100\t\t2\t1\t0\txxx\t\t\t9\t17\t\t\t\t\t\t\t1\t-10\t75\t75\t55\t55\t68\t\t24\t0\t0\t1029\t39196\t\t\tskr\t9qr\t7qr\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpskr\tinvskr\tinvskru\tinvskru\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t1\t1\t1\t1\t20\t1\t1\t1\t1\t20\t\t\t1\t1\t20\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Quhab\th2h\t\t9ar\tktr\t9ar\t100\t\t2\t1\t0\txxx\t\t\t11\t24\t\t\t\t\t\t\t1\t\t75\t75\t57\t57\t48\t\t28\t0\t21\t2334\t81852\t\t\tktr\t9ar\t7ar\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Wrist Spike\th2h\t\t9wb\tktr\t9wb\t100\t\t2\t1\t0\txxx\t\t\t13\t27\t\t\t\t\t\t\t1\t-10\t75\t75\t66\t66\t56\t\t32\t0\t24\t4203\t152996\t\t\twrb\t9wb\t7wb\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Fascia\th2h\t\t9xf\taxf\t9xf\t100\t\t2\t1\t0\txxx\t\t\t8\t37\t\t\t\t\t\t\t1\t10\t75\t75\t69\t69\t64\t\t36\t0\t27\t4203\t171808\t\t\taxf\t9xf\t7xf\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hand Scythe\th2h2\t\t9cs\taxf\t9cs\t100\t\t2\t1\t0\txxx\t\t\t16\t37\t\t\t\t\t\t\t1\t-10\t75\t75\t73\t73\t72\t\t41\t0\t30\t2964\t144524\t\t\tces\t9cs\t7cs\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Greater Claws\th2h2\t\t9lw\tclw\t9lw\t100\t\t2\t1\t0\txxx\t\t\t18\t37\t\t\t\t\t\t\t1\t-20\t75\t75\t76\t76\t52\t\t45\t0\t33\t5061\t252745\t\t\tclw\t9lw\t7lw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Greater Talons\th2h2\t\t9tw\tclw\t9tw\t100\t\t2\t1\t0\txxx\t\t\t21\t35\t\t\t\t\t\t\t1\t-30\t75\t75\t79\t79\t69\t\t50\t0\t37\t9291\t492050\t\t\tbtl\t9tw\t7tw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Scissors Quhab\th2h2\t\t9qr\tskr\t9qr\t100\t\t2\t1\t0\txxx\t\t\t19\t40\t\t\t\t\t\t\t1\t\t75\t75\t82\t82\t68\t\t54\t0\t40\t14223\t797542\t\t\tskr\t9qr\t7qr\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpskr\tinvskr\tinvskru\tinvskru\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Suwayyah\th2h2\t\t7ar\tktr\t7ar\t100\t\t2\t1\t0\txxx\t\t\t39\t52\t\t\t\t\t\t\t1\t\t75\t75\t99\t99\t48\t\t59\t0\t44\t16205\t988095\t\t\tktr\t9ar\t7ar\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Wrist Sword\th2h2\t\t7wb\tktr\t7wb\t100\t\t2\t1\t0\txxx\t\t\t34\t45\t\t\t\t\t\t\t1\t-10\t75\t75\t105\t105\t56\t\t62\t0\t46\t16996\t1087252\t\t\twrb\t9wb\t7wb\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Fist\th2h2\t\t7xf\taxf\t7xf\t100\t\t2\t1\t0\txxx\t\t\t44\t53\t\t\t\t\t\t\t1\t10\t75\t75\t108\t108\t64\t\t68\t0\t51\t15784\t1109812\t\t\taxf\t9xf\t7xf\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Battle Cestus\th2h2\t\t7cs\taxf\t7cs\t100\t\t2\t1\t0\txxx\t\t\t36\t42\t\t\t\t\t\t\t1\t-10\t75\t75\t110\t110\t72\t\t73\t0\t54\t15537\t1173201\t\t\tces\t9cs\t7cs\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Feral Claws\th2h2\t\t7lw\tclw\t7lw\t100\t\t2\t1\t0\txxx\t\t\t22\t53\t\t\t\t\t\t\t1\t-20\t75\t75\t113\t113\t52\t\t78\t0\t58\t16035\t1292230\t\t\tclw\t9lw\t7lw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Runic Talons\th2h2\t\t7tw\tclw\t7tw\t100\t\t2\t1\t0\txxx\t\t\t24\t44\t\t\t\t\t\t\t1\t-30\t75\t75\t115\t115\t69\t\t81\t0\t60\t17396\t1452076\t\t\tbtl\t9tw\t7tw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Scissors Suwayyah\th2h2\t\t7qr\tskr\t7qr\t100\t\t2\t1\t0\txxx\t\t\t40\t51\t\t\t\t\t\t\t1\t\t75\t75\t118\t118\t68\t\t85\t0\t64\t18002\t1575170\t\t\tskr\t9qr\t7qr\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpskr\tinvskr\tinvskru\tinvskru\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Tomahawk\taxe\t\t7ha\thax\t7ha\t100\t\t3\t1\t0\txxx\t\t\t33\t58\t\t\t\t\t\t\t\t\t100\t\t125\t67\t28\t\t54\t0\t40\t14033\t787282\t\t\thax\t9ha\t7ha\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflphax\tinvhax\tinvhaxu\tinvhaxu\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Small Crescent\taxe\t\t7ax\taxe\t7ax\t100\t\t4\t1\t0\txxx\t\t\t38\t60\t\t\t\t\t\t\t1\t10\t100\t\t115\t83\t24\t\t61\t0\t45\t15781\t995641\t\t\taxe\t9ax\t7ax\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpaxe\tinvaxe\tinvaxeu\tinvaxeu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ettin Axe\taxe\t\t72a\taxe\t72a\t100\t\t4\t1\t0\txxx\t\t\t33\t66\t\t\t\t\t\t\t1\t10\t100\t\t145\t45\t24\t\t70\t0\t52\t13496\t982220\t\t\t2ax\t92a\t72a\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflp2ax\tinv2ax\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Spike\taxe\t\t7mp\taxe\t7mp\t100\t\t4\t1\t0\txxx\t\t\t30\t48\t\t\t\t\t\t\t1\t-10\t100\t\t133\t54\t26\t\t79\t0\t59\t16108\t1314532\t\t\tmpi\t9mp\t7mp\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpmpi\tinvmpi\tinvmpiu\tinvmpiu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Berserker Axe\taxe\t\t7wa\thax\t7wa\t100\t\t4\t1\t0\txxx\t\t\t24\t71\t\t\t\t\t\t\t2\t\t100\t\t138\t59\t26\t\t85\t0\t64\t15957\t1401345\t\t\twax\t9wa\t7wa\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwax\tinvwax\t\t\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Feral Axe\taxe\t\t7la\tlax\t7la\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t25\t123\t\t\t2\t-15\t100\t\t196\t\t30\t\t57\t0\t42\t17430\t1024510\t\t\tlax\t9la\t7la\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflplax\tinvlax\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Silver-edged Axe\taxe\t\t7ba\tlax\t7ba\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t62\t110\t\t\t2\t\t100\t\t166\t65\t35\t\t65\t0\t48\t18956\t1267140\t\t\tbax\t9ba\t7ba\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbrx\tinvbrx\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Decapitator\taxe\t\t7bt\tbtx\t7bt\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t49\t137\t\t\t2\t10\t100\t\t189\t33\t40\t\t73\t0\t54\t16377\t1234521\t\t\tbtx\t9bt\t7bt\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbtx\tinvbtx\tinvbtxu\tinvbtxu\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Champion Axe\taxe\t\t7ga\tbtx\t7ga\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t59\t94\t\t\t2\t-10\t100\t\t167\t59\t50\t\t82\t0\t61\t19245\t1621590\t\t\tgax\t9ga\t7ga\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpgax\tinvgax\tinvgaxu\tinvgaxu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Glorious Axe\taxe\t\t7gi\tgix\t7gi\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t60\t124\t\t\t3\t10\t100\t\t164\t55\t50\t\t85\t0\t66\t18431\t1611635\t\t\tgix\t9gi\t7gi\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgix\tinvgix\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Polished Wand\twand\t\t7wn\twnd\t7wn\t100\t\t1\t1\t0\txxx\t\t\t18\t33\t\t\t\t\t\t\t\t\t100\t\t25\t\t22\t\t55\t0\t41\t9412\t547660\t\t\twnd\t9wn\t7wn\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpwnd\tinvwnd\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ghost Wand\twand\t\t7yw\tywn\t7yw\t100\t\t1\t1\t0\txxx\t\t\t20\t40\t\t\t\t\t\t\t\t10\t100\t\t25\t\t14\t\t65\t0\t48\t8786\t606090\t\t\tywn\t9yw\t7yw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpywn\tinvywn\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Lich Wand\twand\t\t7bw\tbwn\t7bw\t100\t\t1\t1\t0\txxx\t\t\t10\t31\t\t\t\t\t\t\t\t-20\t100\t\t25\t\t17\t\t75\t0\t56\t9208\t730600\t\t\tbwn\t9bw\t7bw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpbwn\tinvbwn\tinvbwnu\tinvbwnu\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Unearthed Wand\twand\t\t7gw\tbwn\t7gw\t100\t\t1\t1\t0\txxx\t\t\t22\t28\t\t\t\t\t\t\t\t\t100\t\t25\t\t18\t\t86\t0\t64\t7687\t706582\t\t\tgwn\t9gw\t7gw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpgwn\tinvgwn\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Truncheon\tclub\t\t7cl\tclb\t7cl\t100\t\t1\t1\t0\txxx\t\t\t35\t43\t\t\t\t\t\t\t\t-10\t100\t\t88\t43\t55\t\t52\t0\t39\t1488\t105876\t\t\tclb\t9cl\t7cl\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpclb\tinvclb\tinvclbu\tinvclbu\t1\t2\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mighty Scepter\tscep\t\t7sc\tmac\t7sc\t100\t\t2\t1\t0\txxx\t\t\t40\t52\t\t\t\t\t\t\t\t\t100\t\t125\t65\t50\t\t62\t0\t46\t20199\t1285838\t\t\tscp\t9sc\t7sc\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpscp\tinvscp\t\t\t1\t2\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Seraph Rod\tscep\t\t7qs\tmac\t7qs\t100\t\t4\t1\t0\txxx\t\t\t45\t54\t\t\t\t\t\t\t1\t10\t100\t\t108\t69\t60\t\t76\t0\t57\t23501\t1826576\t\t\tgsc\t9qs\t7qs\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpgsc\tinvgsc\t\t\t1\t3\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Caduceus\tscep\t\t7ws\twhm\t7ws\t100\t\t4\t1\t0\txxx\t\t\t37\t43\t\t\t\t\t\t\t1\t-10\t100\t\t97\t70\t70\t\t85\t0\t66\t22870\t1988950\t\t\twsp\t9ws\t7ws\t1hs\t1hs\t5\tclub\t2\t3\t\t\t\t\tflpwsp\tinvwsp\t\t\t1\t5\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Tyrant Club\tclub\t\t7sp\tclb\t7sp\t100\t\t3\t1\t0\txxx\t\t\t32\t58\t\t\t\t\t\t\t1\t\t100\t\t133\t\t65\t\t57\t0\t42\t6793\t418201\t\t\tspc\t9sp\t7sp\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpspc\tinvspc\tinvspcu\tinvspcu\t1\t3\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Reinforced Mace\tmace\t\t7ma\tmac\t7ma\t100\t\t4\t1\t0\txxx\t\t\t41\t49\t\t\t\t\t\t\t\t\t100\t\t145\t46\t60\t\t63\t0\t47\t14765\t964195\t\t\tmac\t9ma\t7ma\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmac\tinvmac\t\tinv7mas\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Devil Star\tmace\t\t7mt\tmac\t7mt\t100\t\t4\t1\t0\txxx\t\t\t43\t53\t\t\t\t\t\t\t1\t10\t100\t\t153\t44\t72\t\t70\t0\t52\t15674\t1134680\t\t\tmst\t9mt\t7mt\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmst\tinvmst\tinvmstu\tinvmstu\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Scourge\tmace\t\t7fl\tfla\t7fl\t100\t\t4\t1\t0\txxx\t\t\t3\t80\t\t\t\t\t\t\t2\t-10\t100\t\t125\t77\t65\t\t76\t0\t57\t19532\t1524932\t\t\tfla\t9fl\t7fl\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvfla\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Legendary Mallet\thamm\t\t7wh\twhm\t7wh\t100\t\t4\t1\t0\txxx\t\t\t50\t61\t\t\t\t\t\t\t1\t20\t110\t\t189\t\t65\t\t82\t0\t61\t14388\t1223316\t\t\twhm\t9wh\t7wh\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwhm\tinvwhm\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t178\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ogre Maul\thamm\t\t7m7\tmau\t7m7\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t77\t106\t\t\t1\t10\t110\t\t225\t\t60\t\t69\t0\t51\t12156\t875764\t\t\tmau\t9m9\t7m7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpmau\tinvmau\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Thunder Maul\thamm\t\t7gm\tmau\t7gm\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t33\t180\t\t\t2\t20\t110\t\t253\t\t60\t\t85\t0\t65\t17821\t1559785\t\t\tgma\t9gm\t7gm\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgma\tinvgma\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Falcata\tswor\t\t7ss\tssd\t7ss\t100\t\t3\t1\t0\txxx\t\t\t31\t59\t\t\t\t\t\t\t\t\t100\t\t150\t88\t24\t\t56\t0\t42\t15680\t908580\t\t\tssd\t9ss\t7ss\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpssd\tinvssd\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ataghan\tswor\t\t7sm\tscm\t7sm\t100\t\t3\t1\t0\txxx\t\t\t26\t46\t\t\t\t\t\t\t\t-20\t100\t\t138\t95\t22\t\t61\t0\t45\t16103\t1015283\t\t\tscm\t9sm\t7sm\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpscm\tinvscm\tinvscmu\tinvscmu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Elegant Blade\tswor\t\t7sb\tscm\t7sb\t100\t\t3\t1\t0\txxx\t\t\t33\t45\t\t\t\t\t\t\t\t-10\t100\t\t109\t122\t32\t\t63\t0\t47\t22785\t1469455\t\t\tsbr\t9sb\t7sb\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpsbr\tinvsbr\tinvsbru\tinvsbru\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hydra Edge\tswor\t\t7fc\tflc\t7fc\t100\t\t4\t1\t0\txxx\t\t\t28\t68\t\t\t\t\t\t\t\t10\t100\t\t142\t105\t32\t\t69\t0\t51\t18479\t1312051\t\t\tflc\t9fc\t7fc\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpflc\tinvflc\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Phase Blade\tswor\t\t7cr\tcrs\t7cr\t100\t\t2\t1\t0\txxx\t\t\t31\t35\t\t\t\t\t\t\t1\t-30\t100\t\t25\t136\t0\t1\t73\t0\t54\t25680\t1913640\t\t\tcrs\t9cr\t7cr\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpcrs\tinvcrs\tinvcrsu\tinvcrsu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t5\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Conquest Sword\tswor\t\t7bs\tbsd\t7bs\t100\t\t4\t1\t0\txxx\t\t\t37\t53\t\t\t\t\t\t\t\t\t100\t\t142\t112\t32\t\t78\t0\t58\t19044\t1526932\t\t\tbsd\t9bs\t7bs\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpbsd\tinvbsd\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cryptic Sword\tswor\t\t7ls\tlsd\t7ls\t100\t\t4\t1\t0\txxx\t\t\t5\t77\t\t\t\t\t\t\t1\t-10\t100\t\t99\t109\t44\t\t82\t0\t61\t14306\t1216592\t\t\tlsd\t9ls\t7ls\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflplsd\tinvlsd\tinvlsdu\tinvlsdu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mythical Sword\tswor\t\t7wd\tflc\t7wd\t100\t\t4\t1\t0\txxx\t\t\t40\t50\t\t\t\t\t\t\t1\t\t100\t\t147\t124\t44\t\t85\t0\t66\t20187\t1760895\t\t\twsd\t9wd\t7wd\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpwsd\tinvwsd\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Legend Sword\tswor\t\t72h\tclm\t72h\t100\t\t4\t1\t0\txxx\t\t\t22\t56\t1\t1\t50\t94\t\t\t2\t-15\t100\t\t175\t100\t44\t\t59\t0\t44\t23789\t1435551\t\t\t2hs\t92h\t72h\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflp2hs\tinv2hs\tinv2hsu\tinv2hsu\t1\t3\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Highland Blade\tswor\t\t7cm\tclm\t7cm\t100\t\t4\t1\t0\txxx\t\t\t22\t62\t1\t1\t67\t96\t\t\t2\t-5\t100\t\t171\t104\t50\t\t66\t0\t49\t14391\t985306\t\t\tclm\t9cm\t7cm\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpclm\tinvclm\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Balrog Blade\tswor\t\t7gs\tgsd\t7gs\t100\t\t4\t1\t0\txxx\t\t\t15\t75\t1\t1\t55\t118\t\t\t2\t\t100\t\t185\t87\t50\t\t71\t0\t53\t16331\t1197501\t\t\tgis\t9gs\t7gs\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpgis\tinvgis\tinvgisu\tinvgisu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Champion Sword\tswor\t\t7b7\tclm\t7b7\t100\t\t4\t1\t0\txxx\t\t\t24\t54\t1\t1\t71\t83\t\t\t2\t-10\t100\t\t163\t103\t40\t\t77\t0\t57\t19939\t1576303\t\t\tbsw\t9b9\t7b7\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpbsw\tinvbsw\tinvbswu\tinvbswu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Colossal Sword\tswor\t\t7fb\tclm\t7fb\t100\t\t4\t1\t0\txxx\t\t\t26\t70\t1\t1\t61\t121\t\t\t2\t10\t100\t\t182\t95\t50\t\t80\t0\t60\t24800\t2026500\t\t\tflb\t9fb\t7fb\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpflb\tinvflb\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Colossus Blade\tswor\t\t7gd\tgsd\t7gd\t100\t\t4\t1\t0\txxx\t\t\t25\t65\t1\t1\t58\t115\t\t\t2\t5\t100\t\t189\t110\t50\t\t85\t0\t63\t22259\t1937015\t\t\tgsd\t9gd\t7gd\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpgsd\tinvgsd\tinvgsdu\tinvgsdu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Bone Knife\tknif\t\t7dg\tdgr\t7dg\t100\t\t2\t1\t0\txxx\t\t\t23\t49\t\t\t\t\t\t\t\t-20\t75\t75\t38\t75\t26\t\t58\t0\t43\t12429\t752382\t\t\tdgr\t9dg\t7dg\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdgr\tinvdgr\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mithral Point\tknif\t\t7di\tdir\t7di\t100\t\t2\t1\t0\txxx\t\t\t37\t53\t\t\t\t\t\t\t\t\t75\t75\t55\t98\t55\t\t70\t0\t52\t17988\t1296660\t\t\tdir\t9di\t7di\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdir\tinvdir\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Fanged Knife\tknif\t\t7kr\tdir\t7kr\t100\t\t2\t1\t0\txxx\t\t\t15\t57\t\t\t\t\t\t\t\t-20\t75\t75\t42\t86\t36\t\t83\t0\t62\t13729\t1183507\t\t\tkri\t9kr\t7kr\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpkrs\tinvkrs\tinvkrsu\tinvkrsu\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Legend Spike\tknif\t\t7bl\tdgr\t7bl\t100\t\t3\t1\t0\txxx\t\t\t31\t47\t\t\t\t\t\t\t\t-10\t75\t75\t65\t67\t47\t\t85\t0\t66\t16076\t1411460\t\t\tbld\t9bl\t7bl\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpbld\tinvbld\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Flying Knife\ttkni\t\t7tk\tdgr\t7tk\t100\t\t2\t1\t0\txxx\t\t\t23\t54\t\t\t\t\t23\t54\t\t\t75\t75\t48\t141\t6\t\t64\t0\t48\t215\t48260\t\t\ttkf\t9tk\t7tk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t60\t300\t120\tflptkn\tinvtkn\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Flying Axe\ttaxe\t\t7ta\thax\t7ta\t100\t\t2\t1\t0\txxx\t\t\t17\t65\t\t\t\t\t15\t66\t\t10\t75\t75\t88\t108\t15\t\t56\t0\t42\t230\t43380\t\t\ttax\t9ta\t7ta\t1hs\t1hs\t5\t1hsl\t1\t2\t1\t24\t270\t48\tflptax\tinvtax\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Winged Knife\ttkni\t\t7bk\tdgr\t7bk\t100\t\t2\t1\t0\txxx\t\t\t27\t35\t\t\t\t\t23\t39\t\t-20\t75\t75\t45\t142\t20\t\t77\t0\t57\t248\t60096\t\t\tbkf\t9bk\t7bk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t45\t300\t90\tflpbkf\tinvbkf\tinvtk3\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Winged Axe\ttaxe\t\t7b8\thax\t7b8\t100\t\t2\t1\t0\txxx\t\t\t11\t56\t\t\t\t\t7\t60\t\t-10\t75\t75\t96\t122\t16\t\t80\t0\t60\t251\t62580\t\t\tbal\t9b8\t7b8\t1hs\t1hs\t5\t1hsl\t2\t3\t1\t24\t270\t36\tflpbal\tinvbal\t\t\t\t\t0\tprimarily thrown\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hyperion Javelin\tjave\t\t7ja\tjav\t7ja\t100\t\t4\t1\t0\txxx\t\t\t21\t57\t\t\t\t\t28\t55\t2\t-10\t75\t75\t98\t123\t10\t\t54\t0\t40\t211\t40894\t\t\tjav\t9ja\t7ja\t1ht\t1ht\t5\t1ht\t1\t3\t1\t45\t150\t90\tflpjav\tinvjav\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t1\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Stygian Pilum\tjave\t\t7pi\tpil\t7pi\t100\t\t4\t1\t0\txxx\t\t\t14\t64\t\t\t\t\t21\t75\t2\t\t75\t75\t118\t112\t12\t\t62\t0\t46\t220\t47140\t\t\tpil\t9pi\t7pi\t1ht\t1ht\t5\t1ht\t1\t3\t1\t40\t140\t75\tflppil\tinvpil\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Balrog Spear\tjave\t\t7s7\tjav\t7s7\t100\t\t4\t1\t0\txxx\t\t\t33\t63\t\t\t\t\t40\t62\t2\t10\t75\t75\t127\t95\t14\t\t71\t0\t53\t232\t54472\t\t\tssp\t9s9\t7s7\t1ht\t1ht\t5\t1ht\t1\t3\t1\t30\t120\t60\tflpssp\tinvssp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ghost Glaive\tjave\t\t7gl\tglv\t7gl\t100\t\t4\t1\t0\txxx\t\t\t19\t60\t\t\t\t\t30\t85\t2\t20\t75\t75\t89\t137\t16\t\t79\t0\t59\t241\t61039\t\t\tglv\t9gl\t7gl\t1ht\t1ht\t5\t1ht\t1\t4\t1\t12\t120\t30\tflpglv\tinvglv\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Winged Harpoon\tjave\t\t7ts\tpil\t7ts\t100\t\t4\t1\t0\txxx\t\t\t27\t35\t\t\t\t\t11\t77\t2\t-10\t75\t75\t76\t145\t18\t\t85\t0\t65\t199\t61915\t\t\ttsp\t9ts\t7ts\t1ht\t1ht\t5\t1ht\t1\t4\t1\t48\t120\t120\tflptsp\tinvtsp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hyperion Spear\tspea\t\t7sr\tspr\t7sr\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t35\t119\t\t\t3\t-10\t100\t\t155\t120\t30\t\t58\t0\t43\t15900\t953700\t\t\tspr\t9sr\t7sr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspr\tinvspr\t\t\t1\t3\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Stygian Pike\tspea\t\t7tr\ttri\t7tr\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t29\t144\t\t\t3\t\t100\t\t168\t97\t35\t\t66\t0\t49\t17347\t1180402\t\t\ttri\t9tr\t7tr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflptri\tinvtri\tinvtriu\tinvtriu\t1\t4\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Mancatcher\tspea\t\t7br\tbrn\t7br\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t42\t92\t\t\t4\t-20\t100\t\t132\t134\t28\t\t74\t0\t55\t14658\t1124192\t\t\tbrn\t9br\t7br\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpbrn\tinvbrn\t\t\t1\t5\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ghost Spear\tspea\t\t7st\ttri\t7st\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t18\t155\t\t\t4\t\t100\t\t122\t163\t28\t\t83\t0\t62\t17248\t1475584\t\t\tspt\t9st\t7st\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspt\tinvspt\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"War Pike\tspea\t\t7p7\tpik\t7p7\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t33\t178\t\t\t4\t20\t100\t\t165\t106\t25\t\t85\t0\t66\t16070\t1410950\t\t\tpik\t9p9\t7p7\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvpik\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ogre Axe\tpole\t\t7o7\thal\t7o7\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t28\t145\t\t\t2\t\t100\t\t195\t75\t50\t\t60\t0\t45\t9871\t624760\t\t\tbar\t9b7\t7o7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpbar\tinvbar\t\t\t1\t3\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Colossus Voulge\tpole\t\t7vo\thal\t7vo\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t17\t165\t\t\t2\t10\t100\t\t210\t55\t50\t\t64\t0\t48\t12822\t855108\t\t\tvou\t9vo\t7vo\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpvou\tinvvou\t\t\t1\t4\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Thresher\tpole\t\t7s8\tscy\t7s8\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t12\t141\t\t\t1\t-10\t100\t\t152\t118\t65\t\t71\t0\t53\t11086\t825106\t\t\tscy\t9s8\t7s8\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpscy\tinvscy\tinvscyu\tinvscyu\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cryptic Axe\tpole\t\t7pa\thal\t7pa\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t33\t150\t\t\t3\t10\t100\t\t165\t103\t65\t\t79\t0\t59\t16509\t1346211\t\t\tpax\t9pa\t7pa\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflppax\tinvpax\t\t\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Great Poleaxe\tpole\t\t7h7\tpax\t7h7\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t46\t127\t\t\t4\t\t100\t\t179\t99\t55\t\t84\t0\t63\t21554\t1855036\t\t\thal\t9h9\t7h7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflphal\tinvhal\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Giant Thresher\tpole\t\t7wc\tscy\t7wc\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t40\t114\t\t\t4\t-10\t100\t\t188\t140\t55\t\t85\t0\t66\t17692\t1548820\t\t\twsc\t9wc\t7wc\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpwsc\tinvwsc\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Walking Stick\tstaf\t\t6ss\tbst\t6ss\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t69\t85\t\t\t1\t-10\t100\t\t25\t\t20\t\t58\t0\t43\t8154\t504432\t1\t\tsst\t8ss\t6ss\tstf\tstf\t5\tclub\t1\t3\t\t\t\t\tflpsst\tinvsst\t\t\t1\t2\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Stalagmite\tstaf\t\t6ls\tsst\t6ls\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t75\t107\t\t\t1\t10\t100\t\t63\t35\t30\t\t66\t0\t49\t5367\t389722\t1\t\tlst\t8ls\t6ls\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflplst\tinvlst\t\t\t1\t3\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Elder Staff\tstaf\t\t6cs\tcst\t6cs\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t80\t93\t\t\t1\t\t100\t\t44\t37\t35\t\t74\t0\t55\t9048\t709052\t1\t\tcst\t8cs\t6cs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpcst\tinvcst\tinvcstu\tinvcstu\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Shillelagh\tstaf\t\t6bs\tsst\t6bs\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t65\t108\t\t\t1\t\t100\t\t52\t27\t40\t\t83\t0\t62\t7986\t706838\t1\t\tbst\t8bs\t6bs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpbst\tinvbst\t\t\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Archon Staff\tstaf\t\t6ws\tlst\t6ws\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t83\t99\t\t\t1\t10\t100\t\t34\t\t26\t\t85\t0\t66\t10001\t895085\t1\t\twst\t8ws\t6ws\tstf\tstf\t5\tstaf\t2\t4\t\t\t\t\tflpwst\tinvwst\t\t\t1\t6\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Spider Bow\tbow\t\t6sb\tsbw\t6sb\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t23\t50\t\t\t\t5\t\t100\t64\t143\t20\t1\t55\t0\t41\t21091\t1190005\t\t\tsbw\t8sb\t6sb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbw\tinvsbw\t\t\t1\t3\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Blade Bow\tbow\t\t6hb\tsbw\t6hb\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t21\t41\t\t\t\t-10\t\t100\t76\t119\t32\t1\t60\t0\t45\t21350\t1313500\t\t\thbw\t8hb\t6hb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflphbw\tinvhbw\t\t\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Shadow Bow\tbow\t\t6lb\tlbw\t6lb\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t15\t59\t\t\t\t\t\t100\t52\t188\t28\t1\t63\t0\t47\t25610\t1647430\t\t\tlbw\t8lb\t6lb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbw\tinvlbw\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Great Bow\tbow\t\t6cb\tlbw\t6cb\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t12\t52\t\t\t\t-10\t\t100\t121\t107\t36\t1\t68\t0\t51\t17743\t1243024\t\t\tcbw\t8cb\t6cb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpcbw\tinvcbw\tinvcbwu\tinvcbwu\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Diamond Bow\tbow\t\t6s7\tsbb\t6s7\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t33\t40\t\t\t\t\t\t100\t89\t132\t40\t1\t72\t0\t54\t24605\t1810060\t\t\tsbb\t8s8\t6s7\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbb\tinvsbb\tinvsbbu\tinvsbbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Crusader Bow\tbow\t\t6l7\tlbb\t6l7\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t15\t63\t\t\t\t10\t\t100\t97\t121\t44\t1\t77\t0\t57\t18105\t1435085\t\t\tlbb\t8l8\t6l7\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbb\tinvlbb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ward Bow\tbow\t\t6sw\tsbb\t6sw\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t20\t53\t\t\t\t\t\t100\t72\t146\t48\t1\t80\t0\t60\t15042\t1245860\t\t\tswb\t8sw\t6sw\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpswb\tinvswb\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Hydra Bow\tbow\t\t6lw\tlbb\t6lw\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t10\t68\t\t\t\t10\t\t100\t134\t167\t55\t1\t85\t0\t63\t19375\t1691875\t\t\tlwb\t8lw\t6lw\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplwb\tinvlwb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Pellet Bow\txbow\t\t6lx\tlxb\t6lx\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t28\t73\t\t\t\t-10\t\t100\t83\t155\t30\t1\t57\t0\t42\t19512\t1143184\t\t\tlxb\t8lx\t6lx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflplxb\tinvlxb\tinvlxbu\tinvlxbu\t1\t3\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Gorgon Crossbow\txbow\t\t6mx\tlxb\t6mx\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t25\t87\t\t\t\t\t\t100\t117\t105\t40\t1\t67\t0\t50\t22305\t1530435\t\t\tmxb\t8mx\t6mx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflpmxb\tinvmxb\tinvmxbu\tinvmxbu\t1\t4\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Colossus Crossbow\txbow\t\t6hx\thxb\t6hx\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t32\t91\t\t\t\t10\t\t100\t163\t77\t50\t1\t75\t0\t56\t26065\t1994875\t\t\thxb\t8hx\t6hx\txbw\txbw\t5\txbow\t2\t4\t\t\t\t\tflphxb\tinvhxb\tinvhxbu\tinvhxbu\t1\t6\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Demon Crossbow\txbow\t\t6rx\thxb\t6rx\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t26\t40\t\t\t\t-60\t\t100\t141\t98\t40\t1\t84\t0\t63\t25851\t2215984\t\t\trxb\t8rx\t6rx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflprxb\tinvrxb\tinvrxbu\tinvrxbu\t1\t5\t0\tfires 5 shots before reload\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Eagle Orb\torb\t\tob1\tob1\tob1\t100\t\t2\t1\t0\txxx\t\t\t2\t5\t\t\t\t\t\t\t\t-10\t100\t\t\t\t20\t\t1\t0\t0\t168\t3168\t1\t303\tob1\tob6\tobb\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob1\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sacred Globe\torb\t\tob2\tob1\tob2\t100\t\t3\t1\t0\txxx\t\t\t3\t8\t\t\t\t\t\t\t\t-10\t100\t\t\t\t30\t\t8\t0\t0\t463\t10204\t1\t303\tob2\tob7\tobc\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob2\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Smoked Sphere\torb\t\tob3\tob3\tob3\t100\t\t3\t1\t0\txxx\t\t\t4\t10\t\t\t\t\t\t\t\t\t100\t\t\t\t35\t\t12\t0\t8\t766\t17692\t1\t303\tob3\tob8\tobd\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob3\tinvob3\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Clasped Orb\torb\t\tob4\tob4\tob4\t100\t\t4\t1\t0\txxx\t\t\t5\t12\t\t\t\t\t\t\t\t\t100\t\t\t\t40\t\t17\t0\t13\t1223\t31791\t1\t303\tob4\tob9\tobe\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob4\tinvob4\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Jared's Stone\torb\t\tob5\tob4\tob5\t100\t\t5\t1\t0\txxx\t\t\t8\t18\t\t\t\t\t\t\t\t10\t100\t\t\t\t50\t\t24\t0\t18\t1985\t62140\t1\t303\tob5\toba\tobf\t1hs\t1hs\t5\t1hss\t1\t3\t\t\t\t\tflpob5\tinvob5\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Stag Bow\tabow\t\tam1\tam1\tam1\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t7\t12\t\t\t\t\t\t100\t30\t45\t48\t1\t18\t0\t14\t2500\t56500\t\t300\tam1\tam6\tamb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam1\tinvam1\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Reflex Bow\tabow\t\tam2\tam2\tam2\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t9\t19\t\t\t\t10\t\t100\t35\t60\t55\t1\t27\t0\t20\t3575\t112525\t\t300\tam2\tam7\tamc\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam2\tinvam2\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Maiden Spear\taspe\t\tam3\tam3\tam3\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t18\t24\t\t\t4\t\t80\t50\t54\t40\t28\t\t18\t0\t14\t1672\t41596\t\t302\tam3\tam8\tamd\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpam3\tinvam3\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Maiden Pike\taspe\t\tam4\tpik\tam4\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t23\t55\t\t\t4\t10\t80\t50\t63\t52\t25\t\t27\t0\t20\t2023\t70621\t\t302\tam4\tam9\tame\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvam4\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Maiden Javelin\tajav\t\tam5\tpil\tam5\t100\t\t3\t1\t0\txxx\t\t\t8\t14\t\t\t\t\t6\t22\t2\t-10\t80\t50\t33\t47\t6\t\t23\t0\t17\t48\t15104\t\t302\tam5\tama\tamf\t1ht\t1ht\t5\t1ht\t1\t3\t1\t48\t120\t120\tflpam5\tinvam5\t\t\t\t\t0\tprimarily thrown\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Glowing Orb\torb\t\tob6\tob1\tob6\t100\t\t2\t1\t0\txxx\t\t\t8\t21\t\t\t\t\t\t\t\t-10\t100\t\t\t\t20\t\t32\t0\t24\t804\t44228\t1\t303\tob1\tob6\tobb\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob1\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Crystalline Globe\torb\t\tob7\tob1\tob7\t100\t\t3\t1\t0\txxx\t\t\t10\t26\t\t\t\t\t\t\t\t-10\t100\t\t\t\t30\t\t37\t0\t27\t1689\t83493\t1\t303\tob2\tob7\tobc\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob2\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Cloudy Sphere\torb\t\tob8\tob3\tob8\t100\t\t3\t1\t0\txxx\t\t\t11\t29\t\t\t\t\t\t\t\t\t100\t\t\t\t35\t\t41\t0\t30\t2598\t129518\t1\t303\tob3\tob8\tobd\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob3\tinvob3\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Sparkling Ball\torb\t\tob9\tob4\tob9\t100\t\t4\t1\t0\txxx\t\t\t13\t32\t\t\t\t\t\t\t\t\t100\t\t\t\t40\t\t46\t0\t34\t3969\t208074\t1\t303\tob4\tob9\tobe\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob4\tinvob4\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Swirling Crystal\torb\t\toba\tob4\toba\t100\t\t5\t1\t0\txxx\t\t\t18\t42\t\t\t\t\t\t\t\t10\t100\t\t\t\t50\t\t50\t0\t37\t6255\t340250\t1\t303\tob5\toba\tobf\t1hs\t1hs\t5\t1hss\t1\t3\t\t\t\t\tflpob5\tinvob5\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ashwood Bow\tabow\t\tam6\tam1\tam6\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t16\t29\t\t\t\t\t\t100\t56\t77\t48\t1\t39\t0\t29\t7800\t326200\t\t300\tam1\tam6\tamb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam1\tinvam1\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ceremonial Bow\tabow\t\tam7\tam2\tam7\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t19\t41\t\t\t\t10\t\t100\t73\t110\t55\t1\t47\t0\t35\t11025\t544175\t\t300\tam2\tam7\tamc\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam2\tinvam2\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ceremonial Spear\taspe\t\tam8\tam3\tam8\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t34\t51\t\t\t4\t\t80\t50\t101\t80\t28\t\t43\t0\t32\t5316\t252588\t\t302\tam3\tam8\tamd\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpam3\tinvam3\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ceremonial Pike\taspe\t\tam9\tpik\tam9\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t42\t101\t\t\t4\t20\t80\t50\t115\t98\t25\t\t51\t0\t38\t6369\t352819\t\t302\tam4\tam9\tame\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvam4\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Ceremonial Javelin\tajav\t\tama\tpil\tama\t100\t\t3\t1\t0\txxx\t\t\t18\t35\t\t\t\t\t18\t54\t2\t-10\t80\t50\t25\t109\t6\t\t35\t0\t26\t444\t35540\t\t302\tam5\tama\tamf\t1ht\t1ht\t5\t1ht\t1\t3\t1\t48\t120\t120\tflpam5\tinvam5\t\t\t\t\t0\tprimarily thrown\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Heavenly Stone\torb\t\tobb\tob1\tobb\t100\t\t2\t1\t0\txxx\t\t\t21\t46\t\t\t\t\t\t\t\t-10\t100\t\t\t\t20\t\t59\t0\t44\t21051\t1274009\t1\t303\tob1\tob6\tobb\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob1\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Eldritch Orb\torb\t\tobc\tob1\tobc\t100\t\t3\t1\t0\txxx\t\t\t18\t50\t\t\t\t\t\t\t\t-10\t100\t\t\t\t30\t\t67\t0\t50\t19367\t1333589\t1\t303\tob2\tob7\tobc\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob2\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Demon Heart\torb\t\tobd\tob3\tobd\t100\t\t3\t1\t0\txxx\t\t\t23\t55\t\t\t\t\t\t\t\t\t100\t\t\t\t35\t\t75\t0\t56\t22094\t1697050\t1\t303\tob3\tob8\tobd\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob3\tinvob3\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Vortex Orb\torb\t\tobe\tob4\tobe\t100\t\t4\t1\t0\txxx\t\t\t12\t66\t\t\t\t\t\t\t\t\t100\t\t\t\t40\t\t84\t0\t63\t25207\t2161888\t1\t303\tob4\tob9\tobe\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob4\tinvob4\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Dimensional Shard\torb\t\tobf\tob4\tobf\t100\t\t5\t1\t0\txxx\t\t\t30\t53\t\t\t\t\t\t\t\t10\t100\t\t\t\t50\t\t85\t0\t66\t20065\t1750525\t1\t303\tob5\toba\tobf\t1hs\t1hs\t5\t1hss\t1\t3\t\t\t\t\tflpob5\tinvob5\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Matriarchal Bow\tabow\t\tamb\tam1\tamb\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t20\t47\t\t\t\t-10\t\t100\t87\t187\t48\t1\t53\t0\t39\t23700\t1285100\t\t300\tam1\tam6\tamb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam1\tinvam1\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Grand Matron Bow\tabow\t\tamc\tam2\tamc\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t14\t72\t\t\t\t10\t\t100\t108\t152\t55\t1\t78\t0\t58\t33375\t2644750\t\t300\tam2\tam7\tamc\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam2\tinvam2\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Matriarchal Spear\taspe\t\tamd\tam3\tamd\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t65\t95\t\t\t4\t\t80\t50\t114\t142\t28\t\t61\t0\t45\t16248\t1024128\t\t302\tam3\tam8\tamd\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpam3\tinvam3\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Matriarchal Pike\taspe\t\tame\tpik\tame\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t37\t153\t\t\t4\t20\t80\t50\t132\t149\t25\t\t81\t0\t60\t19407\t1614967\t\t302\tam4\tam9\tame\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvam4\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n";
-                ss << u8"Matriarchal Javelin\tajav\t\tamf\tpil\tamf\t100\t\t3\t1\t0\txxx\t\t\t30\t54\t\t\t\t\t35\t66\t2\t-10\t80\t50\t107\t151\t6\t\t65\t0\t48\t302\t54630\t\t302\tam5\tama\tamf\t1ht\t1ht\t5\t1ht\t1\t3\t1\t48\t120\t120\tflpam5\tinvam5\t\t\t\t\t0\tprimarily thrown\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n";
-                defaultTxt = ss.str();
-            }
-            return defaultTxt;
+            static constexpr const char* defaultTxtLines[] = {
+                u8"name\ttype\ttype2\tcode\talternategfx\tnamestr\tversion\tcompactsave\trarity\tspawnable\tTransmogrify\tTMogType\tTMogMin\tTMogMax\tmindam\tmaxdam\t1or2handed\t2handed\t2handmindam\t2handmaxdam\tminmisdam\tmaxmisdam\trangeadder\tspeed\tStrBonus\tDexBonus\treqstr\treqdex\tdurability\tnodurability\tlevel\tShowLevel\tlevelreq\tcost\tgamble cost\tmagic lvl\tauto prefix\tnormcode\tubercode\tultracode\twclass\t2handedwclass\tcomponent\thit class\tinvwidth\tinvheight\tstackable\tminstack\tmaxstack\tspawnstack\tflippyfile\tinvfile\tuniqueinvfile\tsetinvfile\thasinv\tgemsockets\tgemapplytype\t*comment\tuseable\tdropsound\tdropsfxframe\tusesound\tunique\ttransparent\ttranstbl\t*quivered\tlightradius\tbelt\tquest\tquestdiffcheck\tmissiletype\tdurwarning\tqntwarning\tgemoffset\tbitfield1\tCharsiMin\tCharsiMax\tCharsiMagicMin\tCharsiMagicMax\tCharsiMagicLvl\tGheedMin\tGheedMax\tGheedMagicMin\tGheedMagicMax\tGheedMagicLvl\tAkaraMin\tAkaraMax\tAkaraMagicMin\tAkaraMagicMax\tAkaraMagicLvl\tFaraMin\tFaraMax\tFaraMagicMin\tFaraMagicMax\tFaraMagicLvl\tLysanderMin\tLysanderMax\tLysanderMagicMin\tLysanderMagicMax\tLysanderMagicLvl\tDrognanMin\tDrognanMax\tDrognanMagicMin\tDrognanMagicMax\tDrognanMagicLvl\tHratliMin\tHratliMax\tHratliMagicMin\tHratliMagicMax\tHratliMagicLvl\tAlkorMin\tAlkorMax\tAlkorMagicMin\tAlkorMagicMax\tAlkorMagicLvl\tOrmusMin\tOrmusMax\tOrmusMagicMin\tOrmusMagicMax\tOrmusMagicLvl\tElzixMin\tElzixMax\tElzixMagicMin\tElzixMagicMax\tElzixMagicLvl\tAshearaMin\tAshearaMax\tAshearaMagicMin\tAshearaMagicMax\tAshearaMagicLvl\tCainMin\tCainMax\tCainMagicMin\tCainMagicMax\tCainMagicLvl\tHalbuMin\tHalbuMax\tHalbuMagicMin\tHalbuMagicMax\tHalbuMagicLvl\tJamellaMin\tJamellaMax\tJamellaMagicMin\tJamellaMagicMax\tJamellaMagicLvl\tLarzukMin\tLarzukMax\tLarzukMagicMin\tLarzukMagicMax\tLarzukMagicLvl\tAnyaMin\tAnyaMax\tAnyaMagicMin\tAnyaMagicMax\tAnyaMagicLvl\tMalahMin\tMalahMax\tMalahMagicMin\tMalahMagicMax\tMalahMagicLvl\tTransform\tInvTrans\tSkipName\tNightmareUpgrade\tHellUpgrade\tNameable\tPermStoreItem\tdiablocloneweight\n",
+                u8"Hand Axe\taxe\t\thax\thax\thax\t0\t\t3\t1\t0\txxx\t\t\t3\t6\t\t\t\t\t\t\t\t\t100\t\t\t\t28\t\t3\t0\t0\t170\t4510\t\t\thax\t9ha\t7ha\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflphax\tinvhax\tinvhaxu\tinvhaxu\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t0\t0\t3\t\t1\t\t1\t1\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\taxe\t2ax\t1\t0\t\n",
+                u8"Axe\taxe\t\taxe\taxe\taxe\t0\t\t4\t1\t0\txxx\t\t\t4\t11\t\t\t\t\t\t\t1\t10\t100\t\t32\t\t24\t\t7\t0\t0\t403\t8821\t\t\taxe\t9ax\t7ax\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpaxe\tinvaxe\tinvaxeu\tinvaxeu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\t2ax\tmpi\t1\t0\t\n",
+                u8"Double Axe\taxe\t\t2ax\taxe\t2ax\t0\t\t4\t1\t0\txxx\t\t\t5\t13\t\t\t\t\t\t\t1\t10\t100\t\t43\t\t24\t\t13\t0\t0\t873\t20349\t\t\t2ax\t92a\t72a\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflp2ax\tinv2ax\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t1\t1\t30\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tmpi\twax\t1\t0\t\n",
+                u8"Military Pick\taxe\t\tmpi\taxe\tmpi\t0\t\t4\t1\t0\txxx\t\t\t7\t11\t\t\t\t\t\t\t1\t-10\t100\t\t49\t33\t26\t\t19\t0\t0\t1421\t38999\t\t\tmpi\t9mp\t7mp\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpmpi\tinvmpi\tinvmpiu\tinvmpiu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\twax\txxx\t1\t0\t\n",
+                u8"War Axe\taxe\t\twax\thax\twax\t0\t\t4\t1\t0\txxx\t\t\t10\t18\t\t\t\t\t\t\t2\t\t100\t\t67\t\t26\t\t25\t0\t0\t2123\t68075\t\t\twax\t9wa\t7wa\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwax\tinvwax\t\t\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t3\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Large Axe\taxe\t\tlax\tlax\tlax\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t6\t13\t\t\t1\t-10\t100\t\t35\t\t30\t\t6\t0\t0\t354\t7624\t\t\tlax\t9la\t7la\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflplax\tinvlax\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tbtx\tgax\t1\t0\t\n",
+                u8"Broad Axe \taxe\t\tbax\tlax\tbax\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t10\t18\t\t\t1\t\t100\t\t48\t\t35\t\t12\t0\t0\t806\t18172\t\t\tbax\t9ba\t7ba\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbrx\tinvbrx\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tgax\tgix\t1\t0\t\n",
+                u8"Battle Axe\taxe\t\tbtx\tbtx\tbtx\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t12\t32\t\t\t1\t10\t100\t\t54\t\t40\t\t17\t0\t0\t1262\t32454\t\t\tbtx\t9bt\t7bt\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbtx\tinvbtx\tinvbtxu\tinvbtxu\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\tgix\txxx\t1\t0\t\n",
+                u8"Great Axe\taxe\t\tgax\tbtx\tgax\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t9\t30\t\t\t2\t-10\t100\t\t63\t39\t50\t\t23\t0\t0\t1916\t58068\t\t\tgax\t9ga\t7ga\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpgax\tinvgax\tinvgaxu\tinvgaxu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Giant Axe\taxe\t\tgix\tgix\tgix\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t22\t45\t\t\t3\t10\t100\t\t70\t\t50\t\t27\t0\t0\t2410\t81070\t\t\tgix\t9gi\t7gi\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgix\tinvgix\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t20\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t2\t2\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Wand\twand\t\twnd\twnd\twnd\t0\t\t1\t1\t0\txxx\t\t\t2\t4\t\t\t\t\t\t\t\t\t100\t\t\t\t15\t\t2\t0\t0\t205\t3910\t1\t\twnd\t9wn\t7wn\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpwnd\tinvwnd\tinvwndu\tinvwndu\t1\t1\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t4\t6\t7\t9\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tywn\tbwn\t1\t0\t\n",
+                u8"Yew Wand\twand\t\tywn\tywn\tywn\t0\t\t1\t1\t0\txxx\t\t\t2\t8\t\t\t\t\t\t\t\t10\t100\t\t\t\t15\t\t12\t0\t0\t745\t17440\t1\t\tywn\t9yw\t7yw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpywn\tinvywn\t\t\t1\t1\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t5\t9\t1\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t2\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tbwn\tgwn\t1\t0\t\n",
+                u8"Bone Wand\twand\t\tbwn\tbwn\tbwn\t0\t\t1\t1\t0\txxx\t\t\t3\t7\t\t\t\t\t\t\t\t-20\t100\t\t\t\t15\t\t18\t0\t0\t1296\t34828\t1\t\tbwn\t9bw\t7bw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpbwn\tinvbwn\tinvbwnu\tinvbwnu\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t5\t7\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t3\t4\t2\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t3\t4\t2\t3\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Grim Wand\twand\t\tgwn\tbwn\tgwn\t0\t\t1\t1\t0\txxx\t\t\t5\t11\t\t\t\t\t\t\t\t\t100\t\t\t\t15\t\t26\t0\t0\t2098\t70048\t1\t\tgwn\t9gw\t7gw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpgwn\tinvgwn\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t3\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t2\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Club\tclub\t\tclb\tclb\tclb\t0\t\t1\t1\t0\txxx\t\t\t1\t6\t\t\t\t\t\t\t\t-10\t100\t\t\t\t24\t\t1\t0\t0\t32\t3032\t\t\tclb\t9cl\t7cl\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpclb\tinvclb\tinvclbu\tinvclbu\t1\t2\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\tmac\tmst\t1\t0\t\n",
+                u8"Scepter\tscep\t\tscp\tmac\tscp\t0\t\t2\t1\t0\txxx\t\t\t6\t11\t\t\t\t\t\t\t\t\t100\t\t25\t\t50\t\t3\t0\t0\t350\t5050\t\t\tscp\t9sc\t7sc\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpscp\tinvscp\t\t\t1\t2\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t2\t4\t2\t4\t1\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t3\t5\t1\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t2\t2\t0\tgsc\twsp\t1\t0\t\n",
+                u8"Grand Scepter\tscep\t\tgsc\tmac\tgsc\t0\t\t4\t1\t0\txxx\t\t\t8\t18\t\t\t\t\t\t\t1\t10\t100\t\t37\t\t60\t\t15\t0\t0\t1109\t26635\t\t\tgsc\t9qs\t7qs\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpgsc\tinvgsc\t\t\t1\t3\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t3\t5\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t2\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t1\t2\t20\t2\t2\t0\txxx\twsp\t1\t0\t\n",
+                u8"War Scepter\tscep\t\twsp\twhm\twsp\t0\t\t4\t1\t0\txxx\t\t\t10\t17\t\t\t\t\t\t\t1\t-10\t100\t\t55\t\t70\t\t21\t0\t0\t2323\t61783\t\t\twsp\t9ws\t7ws\t1hs\t1hs\t5\tclub\t2\t3\t\t\t\t\tflpwsp\tinvwsp\t\t\t1\t5\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t1\t2\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t20\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Spiked Club\tclub\t\tspc\tclb\tspc\t0\t\t3\t1\t0\txxx\t\t\t5\t8\t\t\t\t\t\t\t1\t\t100\t\t\t\t36\t\t4\t0\t0\t225\t5400\t\t\tspc\t9sp\t7sp\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpspc\tinvspc\tinvspcu\tinvspcu\t1\t2\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t1\t\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tmac\tmst\t1\t0\t\n",
+                u8"Mace\tmace\t\tmac\tmac\tmac\t0\t\t4\t1\t0\txxx\t\t\t3\t10\t\t\t\t\t\t\t\t\t100\t\t27\t\t60\t\t8\t0\t0\t463\t10204\t\t\tmac\t9ma\t7ma\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmac\tinvmac\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t1\t\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tmst\tmau\t1\t0\t\n",
+                u8"Morning Star\tmace\t\tmst\tmac\tmst\t0\t\t4\t1\t0\txxx\t\t\t7\t16\t\t\t\t\t\t\t1\t10\t100\t\t36\t\t72\t\t13\t0\t0\t844\t19972\t\t\tmst\t9mt\t7mt\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmst\tinvmst\tinvmstu\tinvmstu\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\tfla\t1\t0\t\n",
+                u8"Flail\tmace\t\tfla\tfla\tfla\t0\t\t4\t1\t0\txxx\t\t\t1\t24\t\t\t\t\t\t\t2\t-10\t100\t\t41\t35\t30\t\t19\t0\t0\t1412\t38828\t\t\tfla\t9fl\t7fl\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvfla\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\tgma\t1\t0\t\n",
+                u8"War Hammer\thamm\t\twhm\twhm\twhm\t0\t\t4\t1\t0\txxx\t\t\t19\t29\t\t\t\t\t\t\t\t20\t110\t\t53\t\t55\t\t25\t0\t0\t2081\t67025\t\t\twhm\t9wh\t7wh\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwhm\tinvwhm\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t178\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\tmau\tgma\t1\t0\t\n",
+                u8"Maul\thamm\t\tmau\tmau\tmau\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t30\t43\t\t\t1\t10\t110\t\t69\t\t60\t\t21\t0\t0\t1670\t48070\t\t\tmau\t9m9\t7m7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpmau\tinvmau\tinvmauu\tinvmauu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\tmau\t1\t0\t\n",
+                u8"Great Maul\thamm\t\tgma\tmau\tgma\t0\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t38\t58\t\t\t2\t20\t110\t\t99\t\t60\t\t32\t0\t0\t3215\t121380\t\t\tgma\t9gm\t7gm\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgma\tinvgma\tinvgma\tinvgma\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Short Sword\tswor\t\tssd\tssd\tssd\t0\t\t3\t1\t0\txxx\t\t\t2\t7\t\t\t\t\t\t\t\t\t100\t\t\t\t24\t\t1\t0\t0\t72\t3072\t\t\tssd\t9ss\t7ss\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpssd\tinvssd\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tscm\twsd\t1\t0\t\n",
+                u8"Scimitar\tswor\t\tscm\tscm\tscm\t0\t\t3\t1\t0\txxx\t\t\t2\t6\t\t\t\t\t\t\t\t-20\t100\t\t\t21\t22\t\t5\t0\t0\t274\t6370\t\t\tscm\t9sm\t7sm\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpscm\tinvscm\tinvscmu\tinvscmu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tsbr\tlsd\t1\t0\t\n",
+                u8"Saber\tswor\t\tsbr\tscm\tsbr\t0\t\t3\t1\t0\txxx\t\t\t3\t8\t\t\t\t\t\t\t\t-10\t100\t\t25\t25\t32\t\t8\t0\t0\t466\t10228\t\t\tsbr\t9sb\t7sb\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpsbr\tinvsbr\tinv9sbu\tinv9sbu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tflc\tbsd\t1\t0\t\n",
+                u8"Falchion\tswor\t\tflc\tflc\tflc\t0\t\t4\t1\t0\txxx\t\t\t9\t17\t\t\t\t\t\t\t\t20\t100\t\t33\t\t32\t\t11\t0\t0\t683\t15513\t\t\tflc\t9fc\t7fc\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpflc\tinvflc\tinvflcu\tinvflcu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tbsd\twsd\t1\t0\t\n",
+                u8"Crystal Sword\tswor\t\tcrs\tcrs\tcrs\t0\t\t2\t1\t0\txxx\t\t\t5\t15\t\t\t\t\t\t\t1\t\t100\t\t43\t\t20\t\t11\t0\t0\t2127\t31397\t\t\tcrs\t9cr\t7cr\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpcrs\tinvcrs\tinvcrsu\tinvcrsu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t5\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Broad Sword\tswor\t\tbsd\tbsd\tbsd\t0\t\t4\t1\t0\txxx\t\t\t7\t14\t\t\t\t\t\t\t\t\t100\t\t48\t\t32\t\t15\t0\t0\t1029\t25435\t\t\tbsd\t9bs\t7bs\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpbsd\tinvbsd\tinvbsdu\tinvbsdu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tlsd\twsd\t1\t0\t\n",
+                u8"Long Sword \tswor\t\tlsd\tlsd\tlsd\t0\t\t4\t1\t0\txxx\t\t\t3\t19\t\t\t\t\t\t\t1\t-10\t100\t\t55\t39\t44\t\t20\t0\t0\t1520\t42900\t\t\tlsd\t9ls\t7ls\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflplsd\tinvlsd\tinvlsdu\tinvlsdu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\twsd\twsd\t1\t0\t\n",
+                u8"War Sword\tswor\t\twsd\tflc\twsd\t0\t\t4\t1\t0\txxx\t\t\t8\t20\t\t\t\t\t\t\t1\t\t100\t\t71\t45\t44\t\t27\t0\t0\t1997\t69919\t\t\twsd\t9wd\t7wd\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpwsd\tinvwsd\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t3\t20\t\t\t\t\t255\t1\t1\t1\t3\t20\t\t\t\t\t255\t\t\t1\t2\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Two-Handed Sword\tswor\t\t2hs\tclm\t2hs\t0\t\t4\t1\t0\txxx\t\t\t2\t9\t1\t1\t8\t17\t\t\t2\t\t100\t\t35\t27\t44\t\t10\t0\t0\t644\t13940\t\t\t2hs\t92h\t72h\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflp2hs\tinv2hs\tinv2hsu\tinv2hsu\t1\t3\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tclm\tgis\t1\t0\t\n",
+                u8"Claymore\tswor\t\tclm\tclm\tclm\t0\t\t4\t1\t0\txxx\t\t\t5\t12\t1\t1\t13\t30\t\t\t2\t10\t100\t\t47\t\t50\t\t17\t0\t0\t1262\t32454\t\t\tclm\t9cm\t7cm\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpclm\tinvclm\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tgis\tbsw\t1\t0\t\n",
+                u8"Giant Sword\tswor\t\tgis\tgsd\tgis\t0\t\t4\t1\t0\txxx\t\t\t3\t16\t1\t1\t9\t28\t\t\t2\t\t100\t\t56\t34\t50\t\t21\t0\t0\t1459\t43639\t\t\tgis\t9gs\t7gs\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpgis\tinvgis\tinvgisu\tinvgisu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tbsw\tflb\t1\t0\t\n",
+                u8"Bastard Sword\tswor\t\tbsw\tclm\tbsw\t0\t\t4\t1\t0\txxx\t\t\t7\t19\t1\t1\t20\t28\t\t\t1\t10\t100\t\t62\t\t40\t\t24\t0\t0\t1971\t61804\t\t\tbsw\t9b9\t7b7\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpbsw\tinvbsw\tinvbswu\tinvbswu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Flamberge\tswor\t\tflb\tclm\tflb\t0\t\t4\t1\t0\txxx\t\t\t9\t15\t1\t1\t13\t26\t\t\t2\t-10\t100\t\t70\t49\t50\t\t27\t0\t0\t2400\t80800\t\t\tflb\t9fb\t7fb\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpflb\tinvflb\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Great Sword\tswor\t\tgsd\tgsd\tgsd\t0\t\t4\t1\t0\txxx\t\t\t12\t20\t1\t1\t25\t42\t\t\t2\t10\t100\t\t100\t60\t50\t\t33\t0\t0\t3451\t132883\t\t\tgsd\t9gd\t7gd\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpgsd\tinvgsd\tinvgsdu\tinvgsdu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t3\t20\t\t\t\t\t255\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Dagger\tknif\t\tdgr\tdgr\tdgr\t0\t\t2\t1\t0\txxx\t\t\t1\t4\t\t\t\t\t\t\t\t-20\t75\t75\t\t\t16\t\t3\t0\t0\t60\t4180\t\t\tdgr\t9dg\t7dg\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdgr\tinvdgr\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tkri\tbld\t1\t0\t\n",
+                u8"Dirk\tknif\t\tdir\tdir\tdir\t0\t\t2\t1\t0\txxx\t\t\t3\t9\t\t\t\t\t\t\t\t\t75\t75\t\t25\t20\t\t9\t0\t0\t532\t11788\t\t\tdir\t9di\t7di\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdir\tinvdir\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tkri\tbld\t1\t0\t\n",
+                u8"Kriss\tknif\t\tkri\tdir\tkri\t0\t\t2\t1\t0\txxx\t\t\t2\t11\t\t\t\t\t\t\t\t-20\t75\t75\t\t45\t24\t\t17\t0\t0\t1227\t31859\t\t\tkri\t9kr\t7kr\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpkrs\tinvkrs\tinvkrsu\tinvkrsu\t1\t3\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t20\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Blade\tknif\t\tbld\tdgr\tbld\t0\t\t3\t1\t0\txxx\t\t\t4\t15\t\t\t\t\t\t\t\t-10\t75\t75\t35\t51\t24\t\t23\t0\t0\t1764\t54572\t\t\tbld\t9bl\t7bl\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpbld\tinvbld\t\t\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t20\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Throwing Knife\ttkni\t\ttkf\tdgr\ttkf\t0\t\t2\t1\t0\txxx\t\t\t2\t3\t\t\t\t\t4\t9\t\t\t75\t75\t\t21\t4\t\t2\t0\t0\t6\t3512\t\t\ttkf\t9tk\t7tk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t60\t240\t120\tflptkn\tinvtkn\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t1\t2\t\t\t255\t1\t2\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t2\t0\tbkf\tbkf\t1\t0\t\n",
+                u8"Throwing Axe\ttaxe\t\ttax\thax\ttax\t0\t\t2\t1\t0\txxx\t\t\t4\t7\t\t\t\t\t8\t12\t\t10\t75\t75\t\t40\t6\t\t7\t0\t0\t11\t6077\t\t\ttax\t9ta\t7ta\t1hs\t1hs\t5\t1hsl\t1\t2\t1\t24\t200\t48\tflptax\tinvtax\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t1\t1\t\t\t255\t1\t2\t\t\t20\t\t\t\t\t255\t1\t1\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t2\t2\t0\tbal\tbal\t1\t0\t\n",
+                u8"Balanced Knife\ttkni\t\tbkf\tdgr\tbkf\t0\t\t2\t1\t0\txxx\t\t\t1\t8\t\t\t\t\t6\t11\t\t-20\t75\t75\t\t51\t8\t\t13\t0\t0\t15\t9195\t\t\tbkf\t9bk\t7bk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t45\t240\t90\tflpbkf\tinvbkf\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t1\t2\t3\t\t\t1\t1\t2\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Balanced Axe\ttaxe\t\tbal\thax\tbal\t0\t\t2\t1\t0\txxx\t\t\t5\t10\t\t\t\t\t12\t15\t\t-10\t75\t75\t\t57\t10\t\t16\t0\t0\t35\t11060\t\t\tbal\t9b8\t7b8\t1hs\t1hs\t5\t1hsl\t2\t3\t1\t24\t200\t36\tflpbal\tinvbal\t\t\t\t\t0\tprimarily thrown\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t1\t2\t3\t\t\t1\t1\t2\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Javelin\tjave\t\tjav\tjav\tjav\t0\t\t4\t1\t0\txxx\t\t\t1\t5\t\t\t\t\t6\t14\t2\t-10\t75\t75\t\t\t2\t\t1\t0\t0\t5\t3005\t\t\tjav\t9ja\t7ja\t1ht\t1ht\t5\t1ht\t1\t3\t1\t45\t90\t90\tflpjav\tinvjav\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t1\t7\t2\t0\t3\t2\t3\t\t\t255\t1\t2\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t1\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t5\t8\t0\tglv\tglv\t1\t0\t\n",
+                u8"Pilum\tjave\t\tpil\tpil\tpil\t0\t\t4\t1\t0\txxx\t\t\t4\t9\t\t\t\t\t7\t20\t2\t\t75\t75\t\t45\t3\t\t10\t0\t0\t18\t7680\t\t\tpil\t9pi\t7pi\t1ht\t1ht\t5\t1ht\t1\t3\t1\t40\t75\t75\tflppil\tinvpil\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t1\t1\t\t\t20\t\t\t\t\t255\t1\t1\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t\t1\t1\t1\t\t\t255\t1\t1\t\t\t255\t1\t1\t1\t2\t20\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t5\t8\t0\ttsp\ttsp\t1\t0\t\n",
+                u8"Short Spear\tjave\t\tssp\tjav\tssp\t0\t\t4\t1\t0\txxx\t\t\t2\t13\t\t\t\t\t10\t22\t2\t10\t75\t75\t40\t40\t4\t\t15\t0\t0\t24\t10360\t\t\tssp\t9s9\t7s7\t1ht\t1ht\t5\t1ht\t1\t3\t1\t30\t60\t60\tflpssp\tinvssp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t1\t7\t2\t0\t3\t\t\t\t\t255\t\t\t1\t2\t30\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t5\t8\t0\ttsp\ttsp\t1\t0\t\n",
+                u8"Glaive\tjave\t\tglv\tglv\tglv\t0\t\t4\t1\t0\txxx\t\t\t5\t17\t\t\t\t\t16\t22\t2\t20\t75\t75\t52\t35\t5\t\t23\t0\t0\t36\t14828\t\t\tglv\t9gl\t7gl\t1ht\t1ht\t5\t1ht\t1\t4\t1\t24\t60\t60\tflpglv\tinvglv\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t2\t2\t30\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t1\t2\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Throwing Spear\tjave\t\ttsp\tpil\ttsp\t0\t\t4\t1\t0\txxx\t\t\t5\t15\t\t\t\t\t12\t30\t2\t-10\t75\t75\t\t65\t6\t\t29\t0\t0\t48\t18392\t\t\ttsp\t9ts\t7ts\t1ht\t1ht\t5\t1ht\t1\t4\t1\t48\t120\t120\tflptsp\tinvtsp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t1\t1\t1\t1\t20\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Spear\tspea\t\tspr\tspr\tspr\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t3\t15\t\t\t3\t-10\t100\t\t\t20\t30\t\t5\t0\t0\t300\t6500\t\t\tspr\t9sr\t7sr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspr\tinvspr\t\t\t1\t3\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tspt\tpik\t1\t0\t\n",
+                u8"Trident\tspea\t\ttri\ttri\ttri\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t9\t15\t\t\t3\t\t100\t\t38\t24\t35\t\t9\t0\t0\t683\t13147\t\t\ttri\t9tr\t7tr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflptri\tinvtri\tinvtriu\tinvtriu\t1\t4\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tspt\tpik\t1\t0\t\n",
+                u8"Brandistock\tspea\t\tbrn\tbrn\tbrn\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t7\t17\t\t\t4\t-20\t100\t\t40\t50\t28\t\t16\t0\t0\t1162\t29092\t\t\tbrn\t9br\t7br\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpbrn\tinvbrn\t\t\t1\t5\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\tpik\t1\t0\t\n",
+                u8"Spetum\tspea\t\tspt\ttri\tspt\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t15\t23\t\t\t4\t\t100\t\t54\t35\t28\t\t20\t0\t0\t1672\t45940\t\t\tspt\t9st\t7st\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspt\tinvspt\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Pike\tspea\t\tpik\tpik\tpik\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t14\t63\t\t\t4\t20\t100\t\t60\t45\t25\t\t24\t0\t0\t2023\t63052\t\t\tpik\t9p9\t7p7\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvpik\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t30\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t255\t\t1\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bardiche\tpole\t\tbar\thal\tbar\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t1\t27\t\t\t2\t10\t100\t\t40\t\t50\t\t5\t0\t0\t302\t6510\t\t\tbar\t9b7\t7o7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpbar\tinvbar\t\t\t1\t3\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t1\t1\t1\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\thal\twsc\t1\t0\t\n",
+                u8"Voulge\tpole\t\tvou\thal\tvou\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t6\t21\t\t\t2\t\t100\t\t50\t\t50\t\t11\t0\t0\t611\t14721\t\t\tvou\t9vo\t7vo\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpvou\tinvvou\t\t\t1\t4\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\thal\twsc\t1\t0\t\n",
+                u8"Scythe\tpole\t\tscy\tscy\tscy\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t8\t20\t\t\t1\t-10\t100\t\t41\t41\t65\t\t15\t0\t0\t848\t22720\t\t\tscy\t9s8\t7s8\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpscy\tinvscy\tinvscyu\tinvscyu\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t1\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\thal\twsc\t1\t0\t\n",
+                u8"Poleaxe\tpole\t\tpax\thal\tpax\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t18\t39\t\t\t3\t10\t100\t\t62\t\t65\t\t21\t0\t0\t1701\t48721\t\t\tpax\t9pa\t7pa\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflppax\tinvpax\t\t\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Halberd\tpole\t\thal\tpax\thal\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t12\t45\t\t\t4\t\t100\t\t75\t47\t55\t\t29\t0\t0\t2706\t95474\t\t\thal\t9h9\t7h7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflphal\tinvhal\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Scythe\tpole\t\twsc\tscy\twsc\t0\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t15\t36\t\t\t4\t-10\t100\t\t80\t80\t55\t\t34\t0\t0\t3388\t134692\t\t\twsc\t9wc\t7wc\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpwsc\tinvwsc\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t2\t20\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Short Staff\tstaf\t\tsst\tbst\tsst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t1\t5\t\t\t1\t-10\t100\t\t\t\t20\t\t1\t0\t0\t168\t3168\t1\t\tsst\t8ss\t6ss\tstf\tstf\t5\tclub\t1\t3\t\t\t\t\tflpsst\tinvsst\t\t\t1\t2\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t5\t9\t5\t9\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tcst\tbst\t1\t0\t\n",
+                u8"Long Staff\tstaf\t\tlst\tsst\tlst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t2\t8\t\t\t1\t\t100\t\t\t\t30\t\t8\t0\t0\t463\t10204\t1\t\tlst\t8ls\t6ls\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflplst\tinvlst\t\t\t1\t3\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t1\t2\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t\t2\t1\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tcst\twst\t1\t0\t\n",
+                u8"Gnarled Staff\tstaf\t\tcst\tcst\tcst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t4\t12\t\t\t1\t10\t100\t\t\t\t35\t\t12\t0\t0\t766\t17692\t1\t\tcst\t8cs\t6cs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpcst\tinvcst\tinvcstu\tinvcstu\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t3\t5\t5\t9\t1\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t2\t5\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\twst\t1\t0\t\n",
+                u8"Battle Staff\tstaf\t\tbst\tsst\tbst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t13\t\t\t1\t\t100\t\t\t\t40\t\t17\t0\t0\t1223\t31791\t1\t\tbst\t8bs\t6bs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpbst\tinvbst\t\t\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t3\t1\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t2\t5\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t1\t3\t20\t\t\t\t\t255\t\t\t\t\t255\t2\t3\t1\t4\t20\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Staff\tstaf\t\twst\tlst\twst\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t12\t28\t\t\t1\t20\t100\t\t\t\t50\t\t24\t0\t0\t1985\t62140\t1\t\twst\t8ws\t6ws\tstf\tstf\t5\tstaf\t2\t4\t\t\t\t\tflpwst\tinvwst\t\t\t1\t6\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t3\t1\t4\t20\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Short Bow\tbow\t\tsbw\tsbw\tsbw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t1\t4\t\t\t\t5\t\t100\t\t15\t20\t1\t1\t0\t0\t100\t3100\t\t\tsbw\t8sb\t6sb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbw\tinvsbw\t\t\t1\t3\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t1\t1\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\thbw\tcbw\t1\t0\t\n",
+                u8"Hunter's Bow\tbow\t\thbw\tsbw\thbw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t2\t6\t\t\t\t-10\t\t100\t\t28\t32\t1\t5\t0\t0\t350\t6750\t\t\thbw\t8hb\t6hb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflphbw\tinvhbw\t\t\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t1\t1\t1\t1\t1\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tlbw\tsbb\t1\t0\t\n",
+                u8"Long Bow\tbow\t\tlbw\tlbw\tlbw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t3\t10\t\t\t\t\t\t100\t22\t19\t28\t1\t8\t0\t0\t490\t10420\t\t\tlbw\t8lb\t6lb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbw\tinvlbw\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tcbw\tlbb\t1\t0\t\n",
+                u8"Composite Bow\tbow\t\tcbw\tlbw\tcbw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t4\t8\t\t\t\t-10\t\t100\t25\t35\t36\t1\t12\t0\t0\t727\t17224\t\t\tcbw\t8cb\t6cb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpcbw\tinvcbw\tinvcbwu\tinvcbwu\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t255\t\t1\t\t\t255\t\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tsbb\tswb\t1\t0\t\n",
+                u8"Short Battle Bow\tbow\t\tsbb\tsbb\tsbb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t5\t11\t\t\t\t\t\t100\t30\t40\t40\t1\t18\t0\t0\t1045\t30310\t\t\tsbb\t8s8\t6s7\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbb\tinvsbb\tinvsbbu\tinvsbbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tlbb\tlwb\t1\t0\t\n",
+                u8"Long Battle Bow\tbow\t\tlbb\tlbb\tlbb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t3\t18\t\t\t\t10\t\t100\t40\t50\t44\t1\t23\t0\t0\t1545\t49535\t\t\tlbb\t8l8\t6l7\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbb\tinvlbb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tswb\tlwb\t1\t0\t\n",
+                u8"Short War Bow\tbow\t\tswb\tsbb\tswb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t14\t\t\t\t\t\t100\t35\t55\t48\t1\t27\t0\t0\t2500\t83500\t\t\tswb\t8sw\t6sw\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpswb\tinvswb\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t20\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tlwb\txxx\t1\t0\t\n",
+                u8"Long War Bow\tbow\t\tlwb\tlbb\tlwb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t3\t23\t\t\t\t10\t\t100\t50\t65\t55\t1\t31\t0\t0\t3575\t128825\t\t\tlwb\t8lw\t6lw\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplwb\tinvlwb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t1\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Light Crossbow\txbow\t\tlxb\tlxb\tlxb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t9\t\t\t\t-10\t\t100\t21\t27\t30\t1\t6\t0\t0\t803\t10318\t\t\tlxb\t8lx\t6lx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflplxb\tinvlxb\tinvlxbu\tinvlxbu\t1\t3\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\tmxb\trxb\t1\t0\t\n",
+                u8"Crossbow\txbow\t\tmxb\tlxb\tmxb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t9\t16\t\t\t\t\t\t100\t40\t33\t40\t1\t15\t0\t0\t2345\t45175\t\t\tmxb\t8mx\t6mx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflpmxb\tinvmxb\tinvmxbu\tinvmxbu\t1\t4\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t1\t1\t1\t\t1\t1\t1\t1\t\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\thxb\thxb\t1\t0\t\n",
+                u8"Heavy Crossbow\txbow\t\thxb\thxb\thxb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t26\t\t\t\t10\t\t100\t60\t40\t50\t1\t24\t0\t0\t4096\t112804\t\t\thxb\t8hx\t6hx\txbw\txbw\t5\txbow\t2\t4\t\t\t\t\tflphxb\tinvhxb\tinvhxbu\tinvhxbu\t1\t6\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t1\t1\t\t1\t\t1\t1\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Repeating Crossbow\txbow\t\trxb\thxb\trxb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t12\t\t\t\t-40\t\t100\t40\t50\t40\t1\t33\t0\t0\t2739\t109387\t\t\trxb\t8rx\t6rx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflprxb\tinvrxb\tinvrxbu\tinvrxbu\t1\t5\t0\tfires 5 shots before reload\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t1\t1\t20\t\t1\t1\t2\t20\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Rancid Gas Potion\ttpot\t\tgps\tgpl\tgps\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t32\t0\t24\t200\t0\t\t\tgps\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpgpl\tinvgpl\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t49\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n",
+                u8"Oil Potion\ttpot\t\tops\topl\tops\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t28\t0\t20\t150\t0\t\t\tops\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpopl\tinvopl\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t46\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n",
+                u8"Choking Gas Potion\ttpot\t\tgpm\tgps\tgpm\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t20\t0\t16\t120\t0\t\t\tgpm\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpgps\tinvgpm\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t48\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n",
+                u8"Exploding Potion\ttpot\t\topm\topl\topm\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t16\t0\t12\t80\t0\t\t\topm\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpops\tinvopm\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t45\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n",
+                u8"Strangling Gas Potion\ttpot\t\tgpl\tgps\tgpl\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t8\t0\t6\t40\t0\t\t\tgpl\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpgps\tinvgps\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t47\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n",
+                u8"Fulminating Potion\ttpot\t\topl\tops\topl\t0\t\t\t1\t0\txxx\t\t\t0\t1\t\t\t\t\t\t\t\t\t\t\t\t\t2\t1\t4\t0\t0\t24\t0\t\t\topl\t\t\t1ht\t1ht\t5\thth\t1\t1\t1\t3\t25\t6\tflpops\tinvops\t\t\t\t\t0\t\t0\titem_potion\t14\titem_potion\t0\t0\t5\t0\t1\t0\t\t\t44\t7\t3\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t0\t0\t0\txxx\txxx\t0\t1\t\n",
+                u8"Decoy Gidbinn\tknif\t\td33\tdgr\td33\t0\t\t\t\t0\txxx\t\t\t1\t2\t\t\t\t\t\t\t\t-20\t100\t\t15\t20\t10\t\t0\t0\t0\t666\t0\t\t\td33\t\t\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpd33\tinvd33\t\t\t\t\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t1\t0\t5\t0\t0\t0\t18\t1\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t0\t0\t\n",
+                u8"The Gidbinn\tknif\t\tg33\tdgr\tg33\t0\t\t\t\t0\txxx\t\t\t3\t7\t\t\t\t\t\t\t\t-20\t100\t\t15\t25\t30\t\t0\t0\t0\t666\t0\t\t\tg33\t\t\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpg33\tinvg33\t\t\t\t\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t1\t0\t5\t0\t0\t0\t18\t1\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t0\t0\t\n",
+                u8"Wirt's Leg\tclub\t\tleg\tclb\tleg\t0\t\t\t\t0\txxx\t\t\t2\t8\t\t\t\t\t\t\t\t-10\t100\t\t\t\t66\t\t0\t0\t0\t20\t0\t\t\tleg\t\t\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpleg\tinvleg\t\t\t1\t3\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t1\t1\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Horadric Malus\thamm\t\thdm\twhm\thdm\t0\t\t\t\t0\txxx\t\t\t6\t15\t\t\t\t\t\t\t\t20\t100\t\t15\t15\t55\t\t0\t0\t0\t600\t0\t\t\thdm\t\t\t1hs\t1hs\t5\t1hsl\t1\t2\t\t\t\t\tflphmr\tinvhmr\t\t\t\t\t0\t\t0\titem_sword\t12\titem_sword\t1\t0\t5\t0\t0\t0\t4\t1\t0\t7\t0\t0\t0\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t0\t0\t\n",
+                u8"Hellforge Hammer\thamm\t\thfh\twhm\thfh\t0\t\t\t\t0\txxx\t\t\t6\t15\t\t\t\t\t\t\t\t\t100\t\t\t\t55\t\t0\t0\t0\t600\t0\t\t\thfh\t\t\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflphmr\tinvhfh\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t1\t0\t5\t0\t0\t0\t25\t1\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t1\txxx\txxx\t0\t0\t\n",
+                u8"Horadric Staff\tstaf\t\thst\tbst\thst\t0\t\t\t\t0\txxx\t\t\t\t\t\t1\t12\t20\t\t\t2\t\t100\t\t30\t\t50\t\t0\t0\t0\t1223\t0\t\t\thst\t\t\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflphst\tinvhst\t\t\t\t\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t1\t0\t5\t0\t0\t0\t10\t1\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t1\txxx\txxx\t0\t0\t\n",
+                u8"Staff of Kings\tstaf\t\tmsf\tbst\tmsf\t0\t\t\t\t0\txxx\t\t\t\t\t\t1\t10\t15\t\t\t2\t\t100\t\t25\t\t45\t\t0\t0\t0\t1223\t0\t\t\tmsf\t\t\tstf\tstf\t5\tstaf\t1\t3\t\t\t\t\tflpmsf\tinvmsf\t\t\t\t\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t1\t0\t5\t0\t0\t0\t10\t1\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t1\txxx\txxx\t0\t0\t\n",
+                u8"Hatchet\taxe\t\t9ha\thax\t9ha\t0\t\t3\t1\t0\txxx\t\t\t10\t21\t\t\t\t\t\t\t\t\t100\t\t25\t25\t28\t\t31\t0\t19\t810\t43110\t\t\thax\t9ha\t7ha\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflphax\tinvhax\tinvhaxu\tinvhaxu\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cleaver\taxe\t\t9ax\taxe\t9ax\t0\t\t4\t1\t0\txxx\t\t\t10\t33\t\t\t\t\t\t\t1\t10\t100\t\t68\t\t24\t\t34\t0\t22\t1509\t70806\t\t\taxe\t9ax\t7ax\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpaxe\tinvaxe\tinvaxeu\tinvaxeu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Twin Axe\taxe\t\t92a\taxe\t92a\t0\t\t4\t1\t0\txxx\t\t\t13\t38\t\t\t\t\t\t\t1\t10\t100\t\t85\t\t24\t\t39\t0\t25\t2919\t135841\t\t\t2ax\t92a\t72a\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflp2ax\tinv2ax\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Crowbill\taxe\t\t9mp\taxe\t9mp\t0\t\t4\t1\t0\txxx\t\t\t14\t34\t\t\t\t\t\t\t1\t-10\t100\t\t94\t70\t26\t\t43\t0\t25\t4563\t220209\t\t\tmpi\t9mp\t7mp\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpmpi\tinvmpi\tinvmpiu\tinvmpiu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Naga\taxe\t\t9wa\thax\t9wa\t0\t\t4\t1\t0\txxx\t\t\t16\t45\t\t\t\t\t\t\t2\t\t100\t\t121\t\t26\t\t48\t0\t25\t6669\t346612\t\t\twax\t9wa\t7wa\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwax\tinvwax\t\t\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Military Axe\taxe\t\t9la\tlax\t9la\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t14\t34\t\t\t1\t-10\t100\t\t73\t\t30\t\t34\t0\t22\t1362\t65808\t\t\tlax\t9la\t7la\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflplax\tinvlax\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bearded Axe \taxe\t\t9ba\tlax\t9ba\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t21\t49\t\t\t1\t\t100\t\t92\t\t35\t\t38\t0\t25\t2718\t124784\t\t\tbax\t9ba\t7ba\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbrx\tinvbrx\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Tabar\taxe\t\t9bt\tbtx\t9bt\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t24\t77\t\t\t1\t10\t100\t\t101\t\t40\t\t42\t0\t25\t4086\t195112\t\t\tbtx\t9bt\t7bt\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbtx\tinvbtx\tinv9btu\tinv9btu\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Gothic Axe\taxe\t\t9ga\tbtx\t9ga\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t18\t70\t\t\t2\t-10\t100\t\t115\t79\t50\t\t46\t0\t25\t6048\t303708\t\t\tgax\t9ga\t7ga\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpgax\tinvgax\tinvgaxu\tinvgaxu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ancient Axe\taxe\t\t9gi\tgix\t9gi\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t43\t85\t\t\t3\t10\t100\t\t125\t\t50\t\t51\t0\t25\t7530\t412030\t\t\tgix\t9gi\t7gi\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgix\tinvgix\tinv9giu\tinv9giu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Burnt Wand\twand\t\t9wn\twnd\t9wn\t0\t\t1\t1\t0\txxx\t\t\t8\t18\t\t\t\t\t\t\t\t\t100\t\t25\t\t15\t\t31\t0\t19\t915\t46365\t1\t\twnd\t9wn\t7wn\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpwnd\tinvwnd\t\t\t1\t1\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Petrified Wand\twand\t\t9yw\tywn\t9yw\t0\t\t1\t1\t0\txxx\t\t\t8\t24\t\t\t\t\t\t\t\t10\t100\t\t25\t\t15\t\t38\t0\t25\t2535\t117830\t1\t\tywn\t9yw\t7yw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpywn\tinvywn\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Tomb Wand\twand\t\t9bw\tbwn\t9bw\t0\t\t1\t1\t0\txxx\t\t\t10\t22\t\t\t\t\t\t\t\t-20\t100\t\t25\t\t15\t\t43\t0\t25\t4188\t204084\t1\t\tbwn\t9bw\t7bw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpbwn\tinvbwn\tinvbwnu\tinvbwnu\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Grave Wand\twand\t\t9gw\tbwn\t9gw\t0\t\t1\t1\t0\txxx\t\t\t13\t29\t\t\t\t\t\t\t\t\t100\t\t25\t\t15\t\t49\t0\t25\t6594\t350106\t1\t\tgwn\t9gw\t7gw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpgwn\tinvgwn\tinv9gwu\tinv9gwu\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cudgel\tclub\t\t9cl\tclb\t9cl\t0\t\t1\t1\t0\txxx\t\t\t6\t21\t\t\t\t\t\t\t\t-10\t100\t\t25\t\t24\t\t30\t0\t18\t396\t29380\t\t\tclb\t9cl\t7cl\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpclb\tinvclb\tinvclbu\tinvclbu\t1\t2\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Rune Scepter\tscep\t\t9sc\tmac\t9sc\t0\t\t2\t1\t0\txxx\t\t\t13\t24\t\t\t\t\t\t\t\t\t100\t\t58\t\t50\t\t31\t0\t19\t1350\t59850\t\t\tscp\t9sc\t7sc\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpscp\tinvscp\t\t\t1\t2\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Holy Water Sprinkler\tscep\t\t9qs\tmac\t9qs\t0\t\t4\t1\t0\txxx\t\t\t14\t36\t\t\t\t\t\t\t1\t10\t100\t\t76\t\t60\t\t40\t0\t25\t3627\t167580\t\t\tgsc\t9qs\t7qs\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpgsc\tinvgsc\t\t\t1\t3\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Divine Scepter\tscep\t\t9ws\twhm\t9ws\t0\t\t4\t1\t0\txxx\t\t\t16\t38\t\t\t\t\t\t\t1\t-10\t100\t\t103\t\t70\t\t45\t0\t25\t7269\t352105\t\t\twsp\t9ws\t7ws\t1hs\t1hs\t5\tclub\t2\t3\t\t\t\t\tflpwsp\tinvwsp\t\t\t1\t5\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Barbed Club\tclub\t\t9sp\tclb\t9sp\t0\t\t3\t1\t0\txxx\t\t\t13\t25\t\t\t\t\t\t\t1\t\t100\t\t30\t\t36\t\t32\t0\t20\t975\t49700\t\t\tspc\t9sp\t7sp\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpspc\tinvspc\tinvspcu\tinvspcu\t1\t3\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Flanged Mace\tmace\t\t9ma\tmac\t9ma\t0\t\t4\t1\t0\txxx\t\t\t15\t23\t\t\t\t\t\t\t\t\t100\t\t61\t\t60\t\t35\t0\t23\t1689\t79115\t\t\tmac\t9ma\t7ma\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmac\tinvmac\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Jagged Star\tmace\t\t9mt\tmac\t9mt\t0\t\t4\t1\t0\txxx\t\t\t20\t31\t\t\t\t\t\t\t1\t10\t100\t\t74\t\t72\t\t39\t0\t25\t2832\t132448\t\t\tmst\t9mt\t7mt\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmst\tinvmst\tinvmstu\tinvmstu\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Knout\tmace\t\t9fl\tfla\t9fl\t0\t\t4\t1\t0\txxx\t\t\t13\t35\t\t\t\t\t\t\t2\t-10\t100\t\t82\t73\t30\t\t43\t0\t25\t4536\t219048\t\t\tfla\t9fl\t7fl\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvfla\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Battle Hammer\thamm\t\t9wh\twhm\t9wh\t0\t\t4\t1\t0\txxx\t\t\t35\t58\t\t\t\t\t\t\t\t20\t110\t\t100\t\t55\t\t48\t0\t25\t6543\t340564\t\t\twhm\t9wh\t7wh\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwhm\tinvwhm\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t178\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Club\thamm\t\t9m9\tmau\t9m9\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t53\t78\t\t\t1\t10\t110\t\t124\t\t60\t\t45\t0\t25\t5310\t263950\t\t\tmau\t9m9\t7m7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpmau\tinvmau\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Martel de Fer\thamm\t\t9gm\tmau\t9gm\t0\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t61\t99\t\t\t2\t20\t110\t\t169\t\t60\t\t53\t0\t25\t9945\t556085\t\t\tgma\t9gm\t7gm\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgma\tinvgma\tinv9gmu\tinv9gmu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Gladius\tswor\t\t9ss\tssd\t9ss\t0\t\t3\t1\t0\txxx\t\t\t8\t22\t\t\t\t\t\t\t\t\t100\t\t25\t\t24\t\t30\t0\t18\t516\t32980\t\t\tssd\t9ss\t7ss\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpssd\tinvssd\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cutlass\tswor\t\t9sm\tscm\t9sm\t0\t\t3\t1\t0\txxx\t\t\t8\t21\t\t\t\t\t\t\t\t-30\t100\t\t25\t52\t22\t\t43\t0\t25\t1122\t72246\t\t\tscm\t9sm\t7sm\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpscm\tinvscm\tinvscmu\tinvscmu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Shamshir\tswor\t\t9sb\tscm\t9sb\t0\t\t3\t1\t0\txxx\t\t\t10\t24\t\t\t\t\t\t\t\t-10\t100\t\t58\t58\t32\t\t35\t0\t23\t1698\t79430\t\t\tsbr\t9sb\t7sb\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpsbr\tinvsbr\tinvsbru\tinvsbru\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Tulwar\tswor\t\t9fc\tflc\t9fc\t0\t\t4\t1\t0\txxx\t\t\t16\t35\t\t\t\t\t\t\t\t20\t100\t\t70\t42\t32\t\t37\t0\t25\t2349\t107913\t\t\tflc\t9fc\t7fc\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpflc\tinvflc\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Dimensional Blade\tswor\t\t9cr\tcrs\t9cr\t0\t\t2\t1\t0\txxx\t\t\t13\t35\t\t\t\t\t\t\t1\t\t100\t\t85\t60\t20\t\t37\t0\t25\t6681\t268197\t\t\tcrs\t9cr\t7cr\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpcrs\tinvcrs\tinv9cru\tinv9cru\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t5\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Battle Sword\tswor\t\t9bs\tbsd\t9bs\t0\t\t4\t1\t0\txxx\t\t\t16\t34\t\t\t\t\t\t\t\t\t100\t\t92\t43\t32\t\t40\t0\t25\t3387\t157980\t\t\tbsd\t9bs\t7bs\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpbsd\tinvbsd\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Rune Sword\tswor\t\t9ls\tlsd\t9ls\t0\t\t4\t1\t0\txxx\t\t\t10\t42\t\t\t\t\t\t\t1\t-10\t100\t\t103\t79\t44\t\t44\t0\t25\t4860\t238340\t\t\tlsd\t9ls\t7ls\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflplsd\tinvlsd\tinv9lsu\tinv9lsu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ancient Sword\tswor\t\t9wd\tflc\t9wd\t0\t\t4\t1\t0\txxx\t\t\t18\t43\t\t\t\t\t\t\t1\t\t100\t\t127\t88\t44\t\t49\t0\t25\t6291\t335259\t\t\twsd\t9wd\t7wd\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpwsd\tinvwsd\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Espandon\tswor\t\t92h\tclm\t92h\t0\t\t4\t1\t0\txxx\t\t\t8\t26\t1\t1\t18\t40\t\t\t2\t\t100\t\t73\t61\t44\t\t37\t0\t25\t2232\t103584\t\t\t2hs\t92h\t72h\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflp2hs\tinv2hs\tinv2hsu\tinv2hsu\t1\t3\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Dacian Falx\tswor\t\t9cm\tclm\t9cm\t0\t\t4\t1\t0\txxx\t\t\t13\t30\t1\t1\t26\t61\t\t\t2\t10\t100\t\t91\t20\t50\t\t42\t0\t25\t4086\t195112\t\t\tclm\t9cm\t7cm\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpclm\tinvclm\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Tusk Sword\tswor\t\t9gs\tgsd\t9gs\t0\t\t4\t1\t0\txxx\t\t\t10\t37\t1\t1\t19\t58\t\t\t2\t\t100\t\t104\t71\t50\t\t45\t0\t25\t4677\t235465\t\t\tgis\t9gs\t7gs\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpgis\tinvgis\tinvgisu\tinvgisu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Gothic Sword\tswor\t\t9b9\tclm\t9b9\t0\t\t4\t1\t0\txxx\t\t\t14\t40\t1\t1\t39\t60\t\t\t1\t10\t100\t\t113\t20\t40\t\t48\t0\t25\t6213\t324724\t\t\tbsw\t9b9\t7b7\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpbsw\tinvbsw\tinvbswu\tinvbswu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Zweihander\tswor\t\t9fb\tclm\t9fb\t0\t\t4\t1\t0\txxx\t\t\t19\t35\t1\t1\t29\t54\t\t\t2\t-10\t100\t\t125\t94\t50\t\t49\t0\t25\t7500\t394500\t\t\tflb\t9fb\t7fb\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpflb\tinvflb\tinv9fbu\tinv9fbu\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Executioner Sword\tswor\t\t9gd\tgsd\t9gd\t0\t\t4\t1\t0\txxx\t\t\t24\t40\t1\t1\t47\t80\t\t\t2\t10\t100\t\t170\t110\t50\t\t54\t0\t25\t10653\t604762\t\t\tgsd\t9gd\t7gd\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpgsd\tinvgsd\tinvgsdu\tinvgsdu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Poignard\tknif\t\t9dg\tdgr\t9dg\t0\t\t2\t1\t0\txxx\t\t\t6\t18\t\t\t\t\t\t\t\t-20\t75\t75\t25\t\t16\t\t31\t0\t19\t480\t32880\t\t\tdgr\t9dg\t7dg\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdgr\tinvdgr\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Rondel\tknif\t\t9di\tdir\t9di\t0\t\t2\t1\t0\txxx\t\t\t10\t26\t\t\t\t\t\t\t\t\t75\t75\t25\t58\t20\t\t36\t0\t24\t1896\t88756\t\t\tdir\t9di\t7di\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdir\tinvdir\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cinquedeas\tknif\t\t9kr\tdir\t9kr\t0\t\t2\t1\t0\txxx\t\t\t15\t31\t\t\t\t\t\t\t\t-20\t75\t75\t25\t88\t24\t\t42\t0\t25\t3981\t190702\t\t\tkri\t9kr\t7kr\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpkrs\tinvkrs\tinvkrsu\tinvkrsu\t1\t3\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Stilleto\tknif\t\t9bl\tdgr\t9bl\t0\t\t3\t1\t0\txxx\t\t\t19\t36\t\t\t\t\t\t\t\t-10\t75\t75\t47\t97\t24\t\t46\t0\t25\t5592\t282732\t\t\tbld\t9bl\t7bl\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpbld\tinvbld\tinv9blu\tinv9blu\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Battle Dart\ttkni\t\t9tk\tdgr\t9tk\t0\t\t2\t1\t0\txxx\t\t\t8\t16\t\t\t\t\t11\t24\t\t\t75\t75\t25\t52\t6\t\t31\t0\t19\t80\t20480\t\t\ttkf\t9tk\t7tk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t60\t240\t120\tflptkn\tinvtkn\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Francisca\ttaxe\t\t9ta\thax\t9ta\t0\t\t2\t1\t0\txxx\t\t\t11\t22\t\t\t\t\t18\t33\t\t10\t75\t75\t25\t80\t15\t\t34\t0\t22\t90\t22560\t\t\ttax\t9ta\t7ta\t1hs\t1hs\t5\t1hsl\t1\t2\t1\t24\t200\t48\tflptax\tinvtax\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Dart\ttkni\t\t9bk\tdgr\t9bk\t0\t\t2\t1\t0\txxx\t\t\t6\t24\t\t\t\t\t14\t27\t\t-20\t75\t75\t25\t97\t20\t\t39\t0\t25\t100\t25900\t\t\tbkf\t9bk\t7bk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t45\t240\t90\tflpbkf\tinvbkf\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hurlbat\ttaxe\t\t9b8\thax\t9b8\t0\t\t2\t1\t0\txxx\t\t\t13\t27\t\t\t\t\t24\t34\t\t-10\t75\t75\t25\t106\t16\t\t41\t0\t25\t110\t27510\t\t\tbal\t9b8\t7b8\t1hs\t1hs\t5\t1hsl\t2\t3\t1\t24\t200\t36\tflpbal\tinvbal\t\t\t\t\t0\tprimarily thrown\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Javelin\tjave\t\t9ja\tjav\t9ja\t0\t\t4\t1\t0\txxx\t\t\t6\t19\t\t\t\t\t14\t32\t2\t-10\t75\t75\t25\t25\t10\t\t30\t0\t18\t120\t21100\t\t\tjav\t9ja\t7ja\t1ht\t1ht\t5\t1ht\t1\t3\t1\t45\t90\t90\tflpjav\tinvjav\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t1\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Great Pilum\tjave\t\t9pi\tpil\t9pi\t0\t\t4\t1\t0\txxx\t\t\t11\t26\t\t\t\t\t16\t42\t2\t\t75\t75\t25\t88\t12\t\t37\t0\t25\t125\t25625\t\t\tpil\t9pi\t7pi\t1ht\t1ht\t5\t1ht\t1\t3\t1\t40\t75\t75\tflppil\tinvpil\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Simbilan\tjave\t\t9s9\tjav\t9s9\t0\t\t4\t1\t0\txxx\t\t\t8\t32\t\t\t\t\t27\t50\t2\t10\t75\t75\t80\t80\t14\t\t40\t0\t25\t135\t27900\t\t\tssp\t9s9\t7s7\t1ht\t1ht\t5\t1ht\t1\t3\t1\t30\t60\t60\tflpssp\tinvssp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Spiculum\tjave\t\t9gl\tglv\t9gl\t0\t\t4\t1\t0\txxx\t\t\t13\t38\t\t\t\t\t32\t60\t2\t20\t75\t75\t98\t73\t16\t\t46\t0\t25\t145\t32170\t\t\tglv\t9gl\t7gl\t1ht\t1ht\t5\t1ht\t1\t4\t1\t12\t30\t30\tflpglv\tinvglv\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Harpoon\tjave\t\t9ts\tpil\t9ts\t0\t\t4\t1\t0\txxx\t\t\t13\t35\t\t\t\t\t18\t54\t2\t-10\t75\t75\t25\t118\t18\t\t51\t0\t25\t150\t35650\t\t\ttsp\t9ts\t7ts\t1ht\t1ht\t5\t1ht\t1\t4\t1\t48\t120\t120\tflptsp\tinvtsp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Spear\tspea\t\t9sr\tspr\t9sr\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t10\t37\t\t\t3\t-10\t100\t\t25\t25\t30\t\t33\t0\t21\t1200\t58600\t\t\tspr\t9sr\t7sr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspr\tinvspr\t\t\t1\t3\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Fuscina\tspea\t\t9tr\ttri\t9tr\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t19\t37\t\t\t3\t\t100\t\t77\t25\t35\t\t36\t0\t24\t2349\t105064\t\t\ttri\t9tr\t7tr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflptri\tinvtri\tinvtriu\tinvtriu\t1\t4\t0\t2 square reach\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Fork\tspea\t\t9br\tbrn\t9br\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t16\t40\t\t\t4\t-20\t100\t\t80\t95\t28\t\t41\t0\t25\t3786\t178226\t\t\tbrn\t9br\t7br\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpbrn\tinvbrn\tinv9bru\tinv9bru\t1\t5\t0\t2 square reach\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Yari\tspea\t\t9st\ttri\t9st\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t29\t59\t\t\t4\t\t100\t\t101\t\t28\t\t44\t0\t25\t5316\t258404\t\t\tspt\t9st\t7st\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspt\tinvspt\t\t\t1\t6\t0\t2 square reach\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Lance\tspea\t\t9p9\tpik\t9p9\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t27\t114\t\t\t4\t20\t100\t\t110\t88\t25\t\t47\t0\t25\t6369\t325343\t\t\tpik\t9p9\t7p7\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvpik\t\t\t1\t6\t0\t3 square reach\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Lochaber Axe\tpole\t\t9b7\thal\t9b7\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t6\t58\t\t\t2\t10\t100\t\t80\t\t50\t\t33\t0\t21\t1206\t58798\t\t\tbar\t9b7\t7o7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpbar\tinvbar\t\t\t1\t3\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bill\tpole\t\t9vo\thal\t9vo\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t14\t53\t\t\t2\t\t100\t\t95\t\t50\t\t37\t0\t25\t2133\t99921\t\t\tvou\t9vo\t7vo\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpvou\tinvvou\t\t\t1\t4\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Battle Scythe\tpole\t\t9s8\tscy\t9s8\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t18\t45\t\t\t1\t-10\t100\t\t82\t82\t65\t\t40\t0\t25\t2844\t136260\t\t\tscy\t9s8\t7s8\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpscy\tinvscy\tinv9s8u\tinv9s8u\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Partizan\tpole\t\t9pa\thal\t9pa\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t34\t75\t\t\t3\t10\t100\t\t113\t67\t65\t\t35\t0\t23\t5403\t209105\t\t\tpax\t9pa\t7pa\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflppax\tinvpax\t\t\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bec-de-Corbin\tpole\t\t9h9\tpax\t9h9\t0\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t13\t85\t\t\t4\t\t100\t\t133\t91\t55\t\t51\t0\t25\t8418\t457318\t\t\thal\t9h9\t7h7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflphal\tinvhal\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Grim Scythe\tpole\t\t9wc\tscy\t9wc\t0\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t30\t70\t\t\t4\t-10\t100\t\t140\t140\t55\t\t55\t0\t25\t10464\t605520\t\t\twsc\t9wc\t7wc\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpwsc\tinvwsc\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Jo Staff\tstaf\t\t8ss\tbst\t8ss\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t21\t\t\t1\t-10\t100\t\t25\t\t20\t\t30\t0\t18\t804\t41620\t1\t\tsst\t8ss\t6ss\tstf\tstf\t5\tclub\t1\t3\t\t\t\t\tflpsst\tinvsst\t\t\t1\t2\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Quarterstaff\tstaf\t\t8ls\tsst\t8ls\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t8\t26\t\t\t1\t\t100\t\t25\t\t30\t\t35\t0\t23\t1689\t79115\t1\t\tlst\t8ls\t6ls\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflplst\tinvlst\t\t\t1\t3\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cedar Staff\tstaf\t\t8cs\tcst\t8cs\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t11\t32\t\t\t1\t10\t100\t\t25\t\t35\t\t38\t0\t25\t2598\t120224\t1\t\tcst\t8cs\t6cs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpcst\tinvcst\tinvcstu\tinvcstu\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Gothic Staff\tstaf\t\t8bs\tsst\t8bs\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t34\t\t\t1\t\t100\t\t25\t\t40\t\t42\t0\t25\t3969\t190198\t1\t\tbst\t8bs\t6bs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpbst\tinvbst\t\t\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Rune Staff\tstaf\t\t8ws\tlst\t8ws\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t24\t58\t\t\t1\t20\t100\t\t25\t\t50\t\t47\t0\t25\t6255\t319985\t1\t\twst\t8ws\t6ws\tstf\tstf\t5\tstaf\t2\t4\t\t\t\t\tflpwst\tinvwst\tinv8wsu\tinv8wsu\t1\t6\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Edge Bow\tbow\t\t8sb\tsbw\t8sb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t6\t19\t\t\t\t5\t\t100\t25\t43\t20\t1\t30\t0\t18\t600\t35500\t\t\tsbw\t8sb\t6sb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbw\tinvsbw\t\t\t1\t3\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Razor Bow\tbow\t\t8hb\tsbw\t8hb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t8\t22\t\t\t\t-10\t\t100\t25\t62\t32\t1\t33\t0\t21\t1350\t63550\t\t\thbw\t8hb\t6hb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflphbw\tinvhbw\t\t\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cedar Bow\tbow\t\t8lb\tlbw\t8lb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t10\t29\t\t\t\t\t\t100\t53\t49\t28\t1\t35\t0\t23\t1770\t81950\t\t\tlbw\t8lb\t6lb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbw\tinvlbw\tinv8lbu\tinv8lbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Double Bow\tbow\t\t8cb\tlbw\t8cb\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t11\t26\t\t\t\t-10\t\t100\t58\t73\t36\t1\t39\t0\t25\t2481\t118759\t\t\tcbw\t8cb\t6cb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpcbw\tinvcbw\tinvcbwu\tinvcbwu\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Short Siege Bow\tbow\t\t8s8\tsbb\t8s8\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t13\t30\t\t\t\t\t\t100\t65\t80\t40\t1\t43\t0\t25\t3435\t171705\t\t\tsbb\t8s8\t6s7\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbb\tinvsbb\tinv8s8u\tinv8s8u\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Long Siege Bow\tbow\t\t8l8\tlbb\t8l8\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t10\t42\t\t\t\t10\t\t100\t80\t95\t44\t1\t46\t0\t25\t4935\t252510\t\t\tlbb\t8l8\t6l7\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbb\tinvlbb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Rune Bow\tbow\t\t8sw\tsbb\t8sw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t35\t\t\t\t\t\t100\t73\t103\t48\t1\t49\t0\t25\t7800\t409200\t\t\tswb\t8sw\t6sw\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpswb\tinvswb\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Gothic Bow\tbow\t\t8lw\tlbb\t8lw\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t10\t50\t\t\t\t10\t\t100\t95\t118\t55\t1\t52\t0\t25\t11025\t601800\t\t\tlwb\t8lw\t6lw\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplwb\tinvlwb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Arbalest\txbow\t\t8lx\tlxb\t8lx\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t27\t\t\t\t-10\t\t100\t52\t61\t30\t1\t34\t0\t22\t2709\t111606\t\t\tlxb\t8lx\t6lx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflplxb\tinvlxb\tinv8lxu\tinv8lxu\t1\t3\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Siege Crossbow\txbow\t\t8mx\tlxb\t8mx\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t20\t42\t\t\t\t\t\t100\t80\t70\t40\t1\t40\t0\t25\t7335\t315900\t\t\tmxb\t8mx\t6mx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflpmxb\tinvmxb\tinv8mxu\tinv8mxu\t1\t4\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ballista\txbow\t\t8hx\thxb\t8hx\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t33\t55\t\t\t\t10\t\t100\t110\t80\t50\t1\t47\t0\t25\t12588\t617636\t\t\thxb\t8hx\t6hx\txbw\txbw\t5\txbow\t2\t4\t\t\t\t\tflphxb\tinvhxb\tinvhxbu\tinvhxbu\t1\t6\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Chu-Ko-Nu\txbow\t\t8rx\thxb\t8rx\t0\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t14\t32\t\t\t\t-60\t\t100\t80\t95\t40\t1\t54\t0\t25\t8517\t489418\t\t\trxb\t8rx\t6rx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflprxb\tinvrxb\tinvrxbu\tinvrxbu\t1\t5\t0\tfires 5 shots before reload\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Khalim's Flail\tmace\t\tqf1\tfla\tqf1\t0\t\t\t\t0\txxx\t\t\t1\t15\t\t\t\t\t\t\t\t-10\t100\t\t41\t35\t30\t\t0\t0\t0\t1412\t0\t\t\tfla\t\t\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvqf1\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t1\t0\t5\t0\t0\t0\t17\t1\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t1\txxx\txxx\t0\t0\t\n",
+                u8"Khalim's Will\tmace\t\tqf2\tfla\tqf2\t0\t\t\t\t0\txxx\t\t\t1\t15\t\t\t\t\t\t\t\t-10\t100\t\t\t\t30\t\t0\t0\t0\t1412\t0\t\t\tfla\t\t\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvqf2\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t1\t0\t5\t0\t0\t0\t17\t1\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t1\txxx\txxx\t0\t0\t\n",
+                u8"Expansion\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n",
+                u8"Katar\th2h\t\tktr\tktr\tktr\t100\t\t2\t1\t0\txxx\t\t\t4\t7\t\t\t\t\t\t\t1\t-10\t75\t75\t20\t20\t48\t\t1\t0\t0\t72\t3072\t\t\tktr\t9ar\t7ar\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t2\t\t1\t1\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\twrb\tbtl\t1\t0\t\n",
+                u8"Wrist Blade\th2h\t\twrb\tktr\twrb\t100\t\t2\t1\t0\txxx\t\t\t5\t9\t\t\t\t\t\t\t1\t\t75\t75\t33\t33\t52\t\t9\t0\t0\t220\t8980\t\t\twrb\t9wb\t7wb\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t1\t1\t\t1\t1\t\t\t1\t1\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\taxf\tskr\t1\t0\t\n",
+                u8"Hatchet Hands\th2h\t\taxf\taxf\taxf\t100\t\t2\t1\t0\txxx\t\t\t2\t15\t\t\t\t\t\t\t1\t10\t75\t75\t37\t37\t56\t\t12\t0\t0\t466\t14092\t\t\taxf\t9xf\t7xf\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tces\tclw\t1\t0\t\n",
+                u8"Cestus\th2h\t\tces\taxf\tces\t100\t\t2\t1\t0\txxx\t\t\t7\t15\t\t\t\t\t\t\t1\t\t75\t75\t42\t42\t72\t\t15\t0\t0\t514\t17710\t\t\tces\t9cs\t7cs\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tclw\tbtl\t1\t0\t\n",
+                u8"Claws\th2h\t\tclw\tclw\tclw\t100\t\t2\t1\t0\txxx\t\t\t8\t15\t\t\t\t\t\t\t1\t-10\t75\t75\t46\t46\t64\t\t18\t0\t0\t683\t23794\t\t\tclw\t9lw\t7lw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t1\t1\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\tbtl\txxx\t1\t0\t\n",
+                u8"Blade Talons\th2h\t\tbtl\tclw\tbtl\t100\t\t2\t1\t0\txxx\t\t\t10\t14\t\t\t\t\t\t\t1\t-20\t75\t75\t50\t50\t69\t\t21\t0\t0\t847\t30787\t\t\tbtl\t9tw\t7tw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t\t\t\t\t255\t\t\t\t\t255\t\t1\t\t\t255\t\t\t\t\t255\t1\t1\t1\t1\t20\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Scissors Katar\th2h\t\tskr\tskr\tskr\t100\t\t2\t1\t0\txxx\t\t\t9\t17\t\t\t\t\t\t\t1\t-10\t75\t75\t55\t55\t68\t\t24\t0\t0\t1029\t39196\t\t\tskr\t9qr\t7qr\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpskr\tinvskr\tinvskru\tinvskru\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t1\t\t1\t20\t1\t1\t1\t1\t20\t1\t1\t1\t1\t20\t\t\t1\t1\t20\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Quhab\th2h\t\t9ar\tktr\t9ar\t100\t\t2\t1\t0\txxx\t\t\t11\t24\t\t\t\t\t\t\t1\t\t75\t75\t57\t57\t48\t\t28\t0\t21\t2334\t81852\t\t\tktr\t9ar\t7ar\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Wrist Spike\th2h\t\t9wb\tktr\t9wb\t100\t\t2\t1\t0\txxx\t\t\t13\t27\t\t\t\t\t\t\t1\t-10\t75\t75\t66\t66\t56\t\t32\t0\t24\t4203\t152996\t\t\twrb\t9wb\t7wb\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Fascia\th2h\t\t9xf\taxf\t9xf\t100\t\t2\t1\t0\txxx\t\t\t8\t37\t\t\t\t\t\t\t1\t10\t75\t75\t69\t69\t64\t\t36\t0\t27\t4203\t171808\t\t\taxf\t9xf\t7xf\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hand Scythe\th2h2\t\t9cs\taxf\t9cs\t100\t\t2\t1\t0\txxx\t\t\t16\t37\t\t\t\t\t\t\t1\t-10\t75\t75\t73\t73\t72\t\t41\t0\t30\t2964\t144524\t\t\tces\t9cs\t7cs\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Greater Claws\th2h2\t\t9lw\tclw\t9lw\t100\t\t2\t1\t0\txxx\t\t\t18\t37\t\t\t\t\t\t\t1\t-20\t75\t75\t76\t76\t52\t\t45\t0\t33\t5061\t252745\t\t\tclw\t9lw\t7lw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Greater Talons\th2h2\t\t9tw\tclw\t9tw\t100\t\t2\t1\t0\txxx\t\t\t21\t35\t\t\t\t\t\t\t1\t-30\t75\t75\t79\t79\t69\t\t50\t0\t37\t9291\t492050\t\t\tbtl\t9tw\t7tw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Scissors Quhab\th2h2\t\t9qr\tskr\t9qr\t100\t\t2\t1\t0\txxx\t\t\t19\t40\t\t\t\t\t\t\t1\t\t75\t75\t82\t82\t68\t\t54\t0\t40\t14223\t797542\t\t\tskr\t9qr\t7qr\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpskr\tinvskr\tinvskru\tinvskru\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Suwayyah\th2h2\t\t7ar\tktr\t7ar\t100\t\t2\t1\t0\txxx\t\t\t39\t52\t\t\t\t\t\t\t1\t\t75\t75\t99\t99\t48\t\t59\t0\t44\t16205\t988095\t\t\tktr\t9ar\t7ar\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Wrist Sword\th2h2\t\t7wb\tktr\t7wb\t100\t\t2\t1\t0\txxx\t\t\t34\t45\t\t\t\t\t\t\t1\t-10\t75\t75\t105\t105\t56\t\t62\t0\t46\t16996\t1087252\t\t\twrb\t9wb\t7wb\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpktr\tinvktr\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Fist\th2h2\t\t7xf\taxf\t7xf\t100\t\t2\t1\t0\txxx\t\t\t44\t53\t\t\t\t\t\t\t1\t10\t75\t75\t108\t108\t64\t\t68\t0\t51\t15784\t1109812\t\t\taxf\t9xf\t7xf\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Battle Cestus\th2h2\t\t7cs\taxf\t7cs\t100\t\t2\t1\t0\txxx\t\t\t36\t42\t\t\t\t\t\t\t1\t-10\t75\t75\t110\t110\t72\t\t73\t0\t54\t15537\t1173201\t\t\tces\t9cs\t7cs\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpaxf\tinvaxf\tinvaxfu\tinvaxfu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Feral Claws\th2h2\t\t7lw\tclw\t7lw\t100\t\t2\t1\t0\txxx\t\t\t22\t53\t\t\t\t\t\t\t1\t-20\t75\t75\t113\t113\t52\t\t78\t0\t58\t16035\t1292230\t\t\tclw\t9lw\t7lw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Runic Talons\th2h2\t\t7tw\tclw\t7tw\t100\t\t2\t1\t0\txxx\t\t\t24\t44\t\t\t\t\t\t\t1\t-30\t75\t75\t115\t115\t69\t\t81\t0\t60\t17396\t1452076\t\t\tbtl\t9tw\t7tw\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpclw\tinvclw\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Scissors Suwayyah\th2h2\t\t7qr\tskr\t7qr\t100\t\t2\t1\t0\txxx\t\t\t40\t51\t\t\t\t\t\t\t1\t\t75\t75\t118\t118\t68\t\t85\t0\t64\t18002\t1575170\t\t\tskr\t9qr\t7qr\tht1\tht1\t5\t1hsl\t1\t3\t\t\t\t\tflpskr\tinvskr\tinvskru\tinvskru\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Tomahawk\taxe\t\t7ha\thax\t7ha\t100\t\t3\t1\t0\txxx\t\t\t33\t58\t\t\t\t\t\t\t\t\t100\t\t125\t67\t28\t\t54\t0\t40\t14033\t787282\t\t\thax\t9ha\t7ha\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflphax\tinvhax\tinvhaxu\tinvhaxu\t1\t2\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Small Crescent\taxe\t\t7ax\taxe\t7ax\t100\t\t4\t1\t0\txxx\t\t\t38\t60\t\t\t\t\t\t\t1\t10\t100\t\t115\t83\t24\t\t61\t0\t45\t15781\t995641\t\t\taxe\t9ax\t7ax\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpaxe\tinvaxe\tinvaxeu\tinvaxeu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ettin Axe\taxe\t\t72a\taxe\t72a\t100\t\t4\t1\t0\txxx\t\t\t33\t66\t\t\t\t\t\t\t1\t10\t100\t\t145\t45\t24\t\t70\t0\t52\t13496\t982220\t\t\t2ax\t92a\t72a\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflp2ax\tinv2ax\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Spike\taxe\t\t7mp\taxe\t7mp\t100\t\t4\t1\t0\txxx\t\t\t30\t48\t\t\t\t\t\t\t1\t-10\t100\t\t133\t54\t26\t\t79\t0\t59\t16108\t1314532\t\t\tmpi\t9mp\t7mp\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpmpi\tinvmpi\tinvmpiu\tinvmpiu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Berserker Axe\taxe\t\t7wa\thax\t7wa\t100\t\t4\t1\t0\txxx\t\t\t24\t71\t\t\t\t\t\t\t2\t\t100\t\t138\t59\t26\t\t85\t0\t64\t15957\t1401345\t\t\twax\t9wa\t7wa\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwax\tinvwax\t\t\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Feral Axe\taxe\t\t7la\tlax\t7la\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t25\t123\t\t\t2\t-15\t100\t\t196\t\t30\t\t57\t0\t42\t17430\t1024510\t\t\tlax\t9la\t7la\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflplax\tinvlax\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Silver-edged Axe\taxe\t\t7ba\tlax\t7ba\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t62\t110\t\t\t2\t\t100\t\t166\t65\t35\t\t65\t0\t48\t18956\t1267140\t\t\tbax\t9ba\t7ba\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbrx\tinvbrx\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Decapitator\taxe\t\t7bt\tbtx\t7bt\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t49\t137\t\t\t2\t10\t100\t\t189\t33\t40\t\t73\t0\t54\t16377\t1234521\t\t\tbtx\t9bt\t7bt\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpbtx\tinvbtx\tinvbtxu\tinvbtxu\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Champion Axe\taxe\t\t7ga\tbtx\t7ga\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t59\t94\t\t\t2\t-10\t100\t\t167\t59\t50\t\t82\t0\t61\t19245\t1621590\t\t\tgax\t9ga\t7ga\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpgax\tinvgax\tinvgaxu\tinvgaxu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Glorious Axe\taxe\t\t7gi\tgix\t7gi\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t60\t124\t\t\t3\t10\t100\t\t164\t55\t50\t\t85\t0\t66\t18431\t1611635\t\t\tgix\t9gi\t7gi\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgix\tinvgix\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Polished Wand\twand\t\t7wn\twnd\t7wn\t100\t\t1\t1\t0\txxx\t\t\t18\t33\t\t\t\t\t\t\t\t\t100\t\t25\t\t22\t\t55\t0\t41\t9412\t547660\t\t\twnd\t9wn\t7wn\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpwnd\tinvwnd\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ghost Wand\twand\t\t7yw\tywn\t7yw\t100\t\t1\t1\t0\txxx\t\t\t20\t40\t\t\t\t\t\t\t\t10\t100\t\t25\t\t14\t\t65\t0\t48\t8786\t606090\t\t\tywn\t9yw\t7yw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpywn\tinvywn\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Lich Wand\twand\t\t7bw\tbwn\t7bw\t100\t\t1\t1\t0\txxx\t\t\t10\t31\t\t\t\t\t\t\t\t-20\t100\t\t25\t\t17\t\t75\t0\t56\t9208\t730600\t\t\tbwn\t9bw\t7bw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpbwn\tinvbwn\tinvbwnu\tinvbwnu\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Unearthed Wand\twand\t\t7gw\tbwn\t7gw\t100\t\t1\t1\t0\txxx\t\t\t22\t28\t\t\t\t\t\t\t\t\t100\t\t25\t\t18\t\t86\t0\t64\t7687\t706582\t\t\tgwn\t9gw\t7gw\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpgwn\tinvgwn\t\t\t1\t2\t0\tmagically charged\t0\titem_wand\t12\titem_wand\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Truncheon\tclub\t\t7cl\tclb\t7cl\t100\t\t1\t1\t0\txxx\t\t\t35\t43\t\t\t\t\t\t\t\t-10\t100\t\t88\t43\t55\t\t52\t0\t39\t1488\t105876\t\t\tclb\t9cl\t7cl\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpclb\tinvclb\tinvclbu\tinvclbu\t1\t2\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mighty Scepter\tscep\t\t7sc\tmac\t7sc\t100\t\t2\t1\t0\txxx\t\t\t40\t52\t\t\t\t\t\t\t\t\t100\t\t125\t65\t50\t\t62\t0\t46\t20199\t1285838\t\t\tscp\t9sc\t7sc\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpscp\tinvscp\t\t\t1\t2\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Seraph Rod\tscep\t\t7qs\tmac\t7qs\t100\t\t4\t1\t0\txxx\t\t\t45\t54\t\t\t\t\t\t\t1\t10\t100\t\t108\t69\t60\t\t76\t0\t57\t23501\t1826576\t\t\tgsc\t9qs\t7qs\t1hs\t1hs\t5\tclub\t1\t3\t\t\t\t\tflpgsc\tinvgsc\t\t\t1\t3\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Caduceus\tscep\t\t7ws\twhm\t7ws\t100\t\t4\t1\t0\txxx\t\t\t37\t43\t\t\t\t\t\t\t1\t-10\t100\t\t97\t70\t70\t\t85\t0\t66\t22870\t1988950\t\t\twsp\t9ws\t7ws\t1hs\t1hs\t5\tclub\t2\t3\t\t\t\t\tflpwsp\tinvwsp\t\t\t1\t5\t0\tmagically charged\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Tyrant Club\tclub\t\t7sp\tclb\t7sp\t100\t\t3\t1\t0\txxx\t\t\t32\t58\t\t\t\t\t\t\t1\t\t100\t\t133\t\t65\t\t57\t0\t42\t6793\t418201\t\t\tspc\t9sp\t7sp\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpspc\tinvspc\tinvspcu\tinvspcu\t1\t3\t0\t\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Reinforced Mace\tmace\t\t7ma\tmac\t7ma\t100\t\t4\t1\t0\txxx\t\t\t41\t49\t\t\t\t\t\t\t\t\t100\t\t145\t46\t60\t\t63\t0\t47\t14765\t964195\t\t\tmac\t9ma\t7ma\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmac\tinvmac\t\tinv7mas\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Devil Star\tmace\t\t7mt\tmac\t7mt\t100\t\t4\t1\t0\txxx\t\t\t43\t53\t\t\t\t\t\t\t1\t10\t100\t\t153\t44\t72\t\t70\t0\t52\t15674\t1134680\t\t\tmst\t9mt\t7mt\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpmst\tinvmst\tinvmstu\tinvmstu\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Scourge\tmace\t\t7fl\tfla\t7fl\t100\t\t4\t1\t0\txxx\t\t\t3\t80\t\t\t\t\t\t\t2\t-10\t100\t\t125\t77\t65\t\t76\t0\t57\t19532\t1524932\t\t\tfla\t9fl\t7fl\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpfla\tinvfla\t\t\t1\t5\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Legendary Mallet\thamm\t\t7wh\twhm\t7wh\t100\t\t4\t1\t0\txxx\t\t\t50\t61\t\t\t\t\t\t\t1\t20\t110\t\t189\t\t65\t\t82\t0\t61\t14388\t1223316\t\t\twhm\t9wh\t7wh\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpwhm\tinvwhm\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t178\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ogre Maul\thamm\t\t7m7\tmau\t7m7\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t77\t106\t\t\t1\t10\t110\t\t225\t\t60\t\t69\t0\t51\t12156\t875764\t\t\tmau\t9m9\t7m7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpmau\tinvmau\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Thunder Maul\thamm\t\t7gm\tmau\t7gm\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t33\t180\t\t\t2\t20\t110\t\t253\t\t60\t\t85\t0\t65\t17821\t1559785\t\t\tgma\t9gm\t7gm\tstf\tstf\t5\t2hsl\t2\t3\t\t\t\t\tflpgma\tinvgma\t\t\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Falcata\tswor\t\t7ss\tssd\t7ss\t100\t\t3\t1\t0\txxx\t\t\t31\t59\t\t\t\t\t\t\t\t\t100\t\t150\t88\t24\t\t56\t0\t42\t15680\t908580\t\t\tssd\t9ss\t7ss\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpssd\tinvssd\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ataghan\tswor\t\t7sm\tscm\t7sm\t100\t\t3\t1\t0\txxx\t\t\t26\t46\t\t\t\t\t\t\t\t-20\t100\t\t138\t95\t22\t\t61\t0\t45\t16103\t1015283\t\t\tscm\t9sm\t7sm\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpscm\tinvscm\tinvscmu\tinvscmu\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Elegant Blade\tswor\t\t7sb\tscm\t7sb\t100\t\t3\t1\t0\txxx\t\t\t33\t45\t\t\t\t\t\t\t\t-10\t100\t\t109\t122\t32\t\t63\t0\t47\t22785\t1469455\t\t\tsbr\t9sb\t7sb\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpsbr\tinvsbr\tinvsbru\tinvsbru\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hydra Edge\tswor\t\t7fc\tflc\t7fc\t100\t\t4\t1\t0\txxx\t\t\t28\t68\t\t\t\t\t\t\t\t10\t100\t\t142\t105\t32\t\t69\t0\t51\t18479\t1312051\t\t\tflc\t9fc\t7fc\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpflc\tinvflc\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Phase Blade\tswor\t\t7cr\tcrs\t7cr\t100\t\t2\t1\t0\txxx\t\t\t31\t35\t\t\t\t\t\t\t1\t-30\t100\t\t25\t136\t0\t1\t73\t0\t54\t25680\t1913640\t\t\tcrs\t9cr\t7cr\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpcrs\tinvcrs\tinvcrsu\tinvcrsu\t1\t6\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t5\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Conquest Sword\tswor\t\t7bs\tbsd\t7bs\t100\t\t4\t1\t0\txxx\t\t\t37\t53\t\t\t\t\t\t\t\t\t100\t\t142\t112\t32\t\t78\t0\t58\t19044\t1526932\t\t\tbsd\t9bs\t7bs\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflpbsd\tinvbsd\t\t\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cryptic Sword\tswor\t\t7ls\tlsd\t7ls\t100\t\t4\t1\t0\txxx\t\t\t5\t77\t\t\t\t\t\t\t1\t-10\t100\t\t99\t109\t44\t\t82\t0\t61\t14306\t1216592\t\t\tlsd\t9ls\t7ls\t1hs\t1hs\t5\t1hsl\t2\t3\t\t\t\t\tflplsd\tinvlsd\tinvlsdu\tinvlsdu\t1\t4\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mythical Sword\tswor\t\t7wd\tflc\t7wd\t100\t\t4\t1\t0\txxx\t\t\t40\t50\t\t\t\t\t\t\t1\t\t100\t\t147\t124\t44\t\t85\t0\t66\t20187\t1760895\t\t\twsd\t9wd\t7wd\t1hs\t1hs\t5\t1hsl\t1\t3\t\t\t\t\tflpwsd\tinvwsd\t\t\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Legend Sword\tswor\t\t72h\tclm\t72h\t100\t\t4\t1\t0\txxx\t\t\t22\t56\t1\t1\t50\t94\t\t\t2\t-15\t100\t\t175\t100\t44\t\t59\t0\t44\t23789\t1435551\t\t\t2hs\t92h\t72h\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflp2hs\tinv2hs\tinv2hsu\tinv2hsu\t1\t3\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Highland Blade\tswor\t\t7cm\tclm\t7cm\t100\t\t4\t1\t0\txxx\t\t\t22\t62\t1\t1\t67\t96\t\t\t2\t-5\t100\t\t171\t104\t50\t\t66\t0\t49\t14391\t985306\t\t\tclm\t9cm\t7cm\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpclm\tinvclm\t\t\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Balrog Blade\tswor\t\t7gs\tgsd\t7gs\t100\t\t4\t1\t0\txxx\t\t\t15\t75\t1\t1\t55\t118\t\t\t2\t\t100\t\t185\t87\t50\t\t71\t0\t53\t16331\t1197501\t\t\tgis\t9gs\t7gs\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpgis\tinvgis\tinvgisu\tinvgisu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Champion Sword\tswor\t\t7b7\tclm\t7b7\t100\t\t4\t1\t0\txxx\t\t\t24\t54\t1\t1\t71\t83\t\t\t2\t-10\t100\t\t163\t103\t40\t\t77\t0\t57\t19939\t1576303\t\t\tbsw\t9b9\t7b7\t1hs\t2hs\t5\t2hss\t1\t4\t\t\t\t\tflpbsw\tinvbsw\tinvbswu\tinvbswu\t1\t4\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Colossal Sword\tswor\t\t7fb\tclm\t7fb\t100\t\t4\t1\t0\txxx\t\t\t26\t70\t1\t1\t61\t121\t\t\t2\t10\t100\t\t182\t95\t50\t\t80\t0\t60\t24800\t2026500\t\t\tflb\t9fb\t7fb\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpflb\tinvflb\t\t\t1\t5\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Colossus Blade\tswor\t\t7gd\tgsd\t7gd\t100\t\t4\t1\t0\txxx\t\t\t25\t65\t1\t1\t58\t115\t\t\t2\t5\t100\t\t189\t110\t50\t\t85\t0\t63\t22259\t1937015\t\t\tgsd\t9gd\t7gd\t1hs\t2hs\t5\t2hss\t2\t4\t\t\t\t\tflpgsd\tinvgsd\tinvgsdu\tinvgsdu\t1\t6\t0\t\t0\titem_largemetalweapon\t12\titem_largemetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Bone Knife\tknif\t\t7dg\tdgr\t7dg\t100\t\t2\t1\t0\txxx\t\t\t23\t49\t\t\t\t\t\t\t\t-20\t75\t75\t38\t75\t26\t\t58\t0\t43\t12429\t752382\t\t\tdgr\t9dg\t7dg\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdgr\tinvdgr\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mithral Point\tknif\t\t7di\tdir\t7di\t100\t\t2\t1\t0\txxx\t\t\t37\t53\t\t\t\t\t\t\t\t\t75\t75\t55\t98\t55\t\t70\t0\t52\t17988\t1296660\t\t\tdir\t9di\t7di\t1ht\t1ht\t5\t1ht\t1\t2\t\t\t\t\tflpdir\tinvdir\t\t\t1\t1\t0\t\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Fanged Knife\tknif\t\t7kr\tdir\t7kr\t100\t\t2\t1\t0\txxx\t\t\t15\t57\t\t\t\t\t\t\t\t-20\t75\t75\t42\t86\t36\t\t83\t0\t62\t13729\t1183507\t\t\tkri\t9kr\t7kr\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpkrs\tinvkrs\tinvkrsu\tinvkrsu\t1\t3\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Legend Spike\tknif\t\t7bl\tdgr\t7bl\t100\t\t3\t1\t0\txxx\t\t\t31\t47\t\t\t\t\t\t\t\t-10\t75\t75\t65\t67\t47\t\t85\t0\t66\t16076\t1411460\t\t\tbld\t9bl\t7bl\t1ht\t1ht\t5\t1ht\t1\t3\t\t\t\t\tflpbld\tinvbld\t\t\t1\t2\t0\t\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Flying Knife\ttkni\t\t7tk\tdgr\t7tk\t100\t\t2\t1\t0\txxx\t\t\t23\t54\t\t\t\t\t23\t54\t\t\t75\t75\t48\t141\t6\t\t64\t0\t48\t215\t48260\t\t\ttkf\t9tk\t7tk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t60\t300\t120\tflptkn\tinvtkn\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Flying Axe\ttaxe\t\t7ta\thax\t7ta\t100\t\t2\t1\t0\txxx\t\t\t17\t65\t\t\t\t\t15\t66\t\t10\t75\t75\t88\t108\t15\t\t56\t0\t42\t230\t43380\t\t\ttax\t9ta\t7ta\t1hs\t1hs\t5\t1hsl\t1\t2\t1\t24\t270\t48\tflptax\tinvtax\t\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Winged Knife\ttkni\t\t7bk\tdgr\t7bk\t100\t\t2\t1\t0\txxx\t\t\t27\t35\t\t\t\t\t23\t39\t\t-20\t75\t75\t45\t142\t20\t\t77\t0\t57\t248\t60096\t\t\tbkf\t9bk\t7bk\t1ht\t1ht\t5\t1ht\t1\t2\t1\t45\t300\t90\tflpbkf\tinvbkf\tinvtk3\t\t\t\t0\tprimarily thrown\t0\titem_smallmetalweapon\t12\titem_smallmetalweapon\t0\t0\t5\t0\t0\t0\t\t\t36\t7\t4\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Winged Axe\ttaxe\t\t7b8\thax\t7b8\t100\t\t2\t1\t0\txxx\t\t\t11\t56\t\t\t\t\t7\t60\t\t-10\t75\t75\t96\t122\t16\t\t80\t0\t60\t251\t62580\t\t\tbal\t9b8\t7b8\t1hs\t1hs\t5\t1hsl\t2\t3\t1\t24\t270\t36\tflpbal\tinvbal\t\t\t\t\t0\tprimarily thrown\t0\titem_sword\t12\titem_sword\t0\t0\t5\t0\t0\t0\t\t\t35\t7\t5\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hyperion Javelin\tjave\t\t7ja\tjav\t7ja\t100\t\t4\t1\t0\txxx\t\t\t21\t57\t\t\t\t\t28\t55\t2\t-10\t75\t75\t98\t123\t10\t\t54\t0\t40\t211\t40894\t\t\tjav\t9ja\t7ja\t1ht\t1ht\t5\t1ht\t1\t3\t1\t45\t150\t90\tflpjav\tinvjav\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t1\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Stygian Pilum\tjave\t\t7pi\tpil\t7pi\t100\t\t4\t1\t0\txxx\t\t\t14\t64\t\t\t\t\t21\t75\t2\t\t75\t75\t118\t112\t12\t\t62\t0\t46\t220\t47140\t\t\tpil\t9pi\t7pi\t1ht\t1ht\t5\t1ht\t1\t3\t1\t40\t140\t75\tflppil\tinvpil\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Balrog Spear\tjave\t\t7s7\tjav\t7s7\t100\t\t4\t1\t0\txxx\t\t\t33\t63\t\t\t\t\t40\t62\t2\t10\t75\t75\t127\t95\t14\t\t71\t0\t53\t232\t54472\t\t\tssp\t9s9\t7s7\t1ht\t1ht\t5\t1ht\t1\t3\t1\t30\t120\t60\tflpssp\tinvssp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ghost Glaive\tjave\t\t7gl\tglv\t7gl\t100\t\t4\t1\t0\txxx\t\t\t19\t60\t\t\t\t\t30\t85\t2\t20\t75\t75\t89\t137\t16\t\t79\t0\t59\t241\t61039\t\t\tglv\t9gl\t7gl\t1ht\t1ht\t5\t1ht\t1\t4\t1\t12\t120\t30\tflpglv\tinvglv\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Winged Harpoon\tjave\t\t7ts\tpil\t7ts\t100\t\t4\t1\t0\txxx\t\t\t27\t35\t\t\t\t\t11\t77\t2\t-10\t75\t75\t76\t145\t18\t\t85\t0\t65\t199\t61915\t\t\ttsp\t9ts\t7ts\t1ht\t1ht\t5\t1ht\t1\t4\t1\t48\t120\t120\tflptsp\tinvtsp\t\t\t\t\t0\tprimarily thrown\t0\titem_javelins\t12\titem_javelins\t0\t0\t5\t0\t0\t0\t\t\t37\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hyperion Spear\tspea\t\t7sr\tspr\t7sr\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t35\t119\t\t\t3\t-10\t100\t\t155\t120\t30\t\t58\t0\t43\t15900\t953700\t\t\tspr\t9sr\t7sr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspr\tinvspr\t\t\t1\t3\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Stygian Pike\tspea\t\t7tr\ttri\t7tr\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t29\t144\t\t\t3\t\t100\t\t168\t97\t35\t\t66\t0\t49\t17347\t1180402\t\t\ttri\t9tr\t7tr\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflptri\tinvtri\tinvtriu\tinvtriu\t1\t4\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Mancatcher\tspea\t\t7br\tbrn\t7br\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t42\t92\t\t\t4\t-20\t100\t\t132\t134\t28\t\t74\t0\t55\t14658\t1124192\t\t\tbrn\t9br\t7br\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpbrn\tinvbrn\t\t\t1\t5\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ghost Spear\tspea\t\t7st\ttri\t7st\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t18\t155\t\t\t4\t\t100\t\t122\t163\t28\t\t83\t0\t62\t17248\t1475584\t\t\tspt\t9st\t7st\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpspt\tinvspt\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"War Pike\tspea\t\t7p7\tpik\t7p7\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t33\t178\t\t\t4\t20\t100\t\t165\t106\t25\t\t85\t0\t66\t16070\t1410950\t\t\tpik\t9p9\t7p7\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvpik\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ogre Axe\tpole\t\t7o7\thal\t7o7\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t28\t145\t\t\t2\t\t100\t\t195\t75\t50\t\t60\t0\t45\t9871\t624760\t\t\tbar\t9b7\t7o7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpbar\tinvbar\t\t\t1\t3\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Colossus Voulge\tpole\t\t7vo\thal\t7vo\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t17\t165\t\t\t2\t10\t100\t\t210\t55\t50\t\t64\t0\t48\t12822\t855108\t\t\tvou\t9vo\t7vo\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpvou\tinvvou\t\t\t1\t4\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Thresher\tpole\t\t7s8\tscy\t7s8\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t12\t141\t\t\t1\t-10\t100\t\t152\t118\t65\t\t71\t0\t53\t11086\t825106\t\t\tscy\t9s8\t7s8\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpscy\tinvscy\tinvscyu\tinvscyu\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cryptic Axe\tpole\t\t7pa\thal\t7pa\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t33\t150\t\t\t3\t10\t100\t\t165\t103\t65\t\t79\t0\t59\t16509\t1346211\t\t\tpax\t9pa\t7pa\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflppax\tinvpax\t\t\t1\t5\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Great Poleaxe\tpole\t\t7h7\tpax\t7h7\t100\t\t4\t1\t0\txxx\t\t\t\t\t\t1\t46\t127\t\t\t4\t\t100\t\t179\t99\t55\t\t84\t0\t63\t21554\t1855036\t\t\thal\t9h9\t7h7\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflphal\tinvhal\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Giant Thresher\tpole\t\t7wc\tscy\t7wc\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t40\t114\t\t\t4\t-10\t100\t\t188\t140\t55\t\t85\t0\t66\t17692\t1548820\t\t\twsc\t9wc\t7wc\tstf\tstf\t5\t2hsl\t2\t4\t\t\t\t\tflpwsc\tinvwsc\t\t\t1\t6\t0\t2 square reach\t0\titem_woodweaponlarge\t12\titem_woodweaponlarge\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t2\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Walking Stick\tstaf\t\t6ss\tbst\t6ss\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t69\t85\t\t\t1\t-10\t100\t\t25\t\t20\t\t58\t0\t43\t8154\t504432\t1\t\tsst\t8ss\t6ss\tstf\tstf\t5\tclub\t1\t3\t\t\t\t\tflpsst\tinvsst\t\t\t1\t2\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Stalagmite\tstaf\t\t6ls\tsst\t6ls\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t75\t107\t\t\t1\t10\t100\t\t63\t35\t30\t\t66\t0\t49\t5367\t389722\t1\t\tlst\t8ls\t6ls\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflplst\tinvlst\t\t\t1\t3\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Elder Staff\tstaf\t\t6cs\tcst\t6cs\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t80\t93\t\t\t1\t\t100\t\t44\t37\t35\t\t74\t0\t55\t9048\t709052\t1\t\tcst\t8cs\t6cs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpcst\tinvcst\tinvcstu\tinvcstu\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Shillelagh\tstaf\t\t6bs\tsst\t6bs\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t65\t108\t\t\t1\t\t100\t\t52\t27\t40\t\t83\t0\t62\t7986\t706838\t1\t\tbst\t8bs\t6bs\tstf\tstf\t5\tstaf\t1\t4\t\t\t\t\tflpbst\tinvbst\t\t\t1\t4\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Archon Staff\tstaf\t\t6ws\tlst\t6ws\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t83\t99\t\t\t1\t10\t100\t\t34\t\t26\t\t85\t0\t66\t10001\t895085\t1\t\twst\t8ws\t6ws\tstf\tstf\t5\tstaf\t2\t4\t\t\t\t\tflpwst\tinvwst\t\t\t1\t6\t0\tmagically charged\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Spider Bow\tbow\t\t6sb\tsbw\t6sb\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t23\t50\t\t\t\t5\t\t100\t64\t143\t20\t1\t55\t0\t41\t21091\t1190005\t\t\tsbw\t8sb\t6sb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbw\tinvsbw\t\t\t1\t3\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Blade Bow\tbow\t\t6hb\tsbw\t6hb\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t21\t41\t\t\t\t-10\t\t100\t76\t119\t32\t1\t60\t0\t45\t21350\t1313500\t\t\thbw\t8hb\t6hb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflphbw\tinvhbw\t\t\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Shadow Bow\tbow\t\t6lb\tlbw\t6lb\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t15\t59\t\t\t\t\t\t100\t52\t188\t28\t1\t63\t0\t47\t25610\t1647430\t\t\tlbw\t8lb\t6lb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbw\tinvlbw\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Great Bow\tbow\t\t6cb\tlbw\t6cb\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t12\t52\t\t\t\t-10\t\t100\t121\t107\t36\t1\t68\t0\t51\t17743\t1243024\t\t\tcbw\t8cb\t6cb\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpcbw\tinvcbw\tinvcbwu\tinvcbwu\t1\t4\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Diamond Bow\tbow\t\t6s7\tsbb\t6s7\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t33\t40\t\t\t\t\t\t100\t89\t132\t40\t1\t72\t0\t54\t24605\t1810060\t\t\tsbb\t8s8\t6s7\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpsbb\tinvsbb\tinvsbbu\tinvsbbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Crusader Bow\tbow\t\t6l7\tlbb\t6l7\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t15\t63\t\t\t\t10\t\t100\t97\t121\t44\t1\t77\t0\t57\t18105\t1435085\t\t\tlbb\t8l8\t6l7\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplbb\tinvlbb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ward Bow\tbow\t\t6sw\tsbb\t6sw\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t20\t53\t\t\t\t\t\t100\t72\t146\t48\t1\t80\t0\t60\t15042\t1245860\t\t\tswb\t8sw\t6sw\tbow\tbow\t6\tbow\t2\t3\t\t\t\t\tflpswb\tinvswb\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Hydra Bow\tbow\t\t6lw\tlbb\t6lw\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t10\t68\t\t\t\t10\t\t100\t134\t167\t55\t1\t85\t0\t63\t19375\t1691875\t\t\tlwb\t8lw\t6lw\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflplwb\tinvlwb\t\t\t1\t6\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Pellet Bow\txbow\t\t6lx\tlxb\t6lx\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t28\t73\t\t\t\t-10\t\t100\t83\t155\t30\t1\t57\t0\t42\t19512\t1143184\t\t\tlxb\t8lx\t6lx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflplxb\tinvlxb\tinvlxbu\tinvlxbu\t1\t3\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Gorgon Crossbow\txbow\t\t6mx\tlxb\t6mx\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t25\t87\t\t\t\t\t\t100\t117\t105\t40\t1\t67\t0\t50\t22305\t1530435\t\t\tmxb\t8mx\t6mx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflpmxb\tinvmxb\tinvmxbu\tinvmxbu\t1\t4\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Colossus Crossbow\txbow\t\t6hx\thxb\t6hx\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t32\t91\t\t\t\t10\t\t100\t163\t77\t50\t1\t75\t0\t56\t26065\t1994875\t\t\thxb\t8hx\t6hx\txbw\txbw\t5\txbow\t2\t4\t\t\t\t\tflphxb\tinvhxb\tinvhxbu\tinvhxbu\t1\t6\t0\treload lag between shots\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Demon Crossbow\txbow\t\t6rx\thxb\t6rx\t100\t\t2\t1\t0\txxx\t\t\t\t\t\t1\t26\t40\t\t\t\t-60\t\t100\t141\t98\t40\t1\t84\t0\t63\t25851\t2215984\t\t\trxb\t8rx\t6rx\txbw\txbw\t5\txbow\t2\t3\t\t\t\t\tflprxb\tinvrxb\tinvrxbu\tinvrxbu\t1\t5\t0\tfires 5 shots before reload\t0\titem_crossbow\t12\titem_crossbow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Eagle Orb\torb\t\tob1\tob1\tob1\t100\t\t2\t1\t0\txxx\t\t\t2\t5\t\t\t\t\t\t\t\t-10\t100\t\t\t\t20\t\t1\t0\t0\t168\t3168\t1\t303\tob1\tob6\tobb\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob1\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sacred Globe\torb\t\tob2\tob1\tob2\t100\t\t3\t1\t0\txxx\t\t\t3\t8\t\t\t\t\t\t\t\t-10\t100\t\t\t\t30\t\t8\t0\t0\t463\t10204\t1\t303\tob2\tob7\tobc\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob2\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Smoked Sphere\torb\t\tob3\tob3\tob3\t100\t\t3\t1\t0\txxx\t\t\t4\t10\t\t\t\t\t\t\t\t\t100\t\t\t\t35\t\t12\t0\t8\t766\t17692\t1\t303\tob3\tob8\tobd\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob3\tinvob3\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Clasped Orb\torb\t\tob4\tob4\tob4\t100\t\t4\t1\t0\txxx\t\t\t5\t12\t\t\t\t\t\t\t\t\t100\t\t\t\t40\t\t17\t0\t13\t1223\t31791\t1\t303\tob4\tob9\tobe\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob4\tinvob4\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Jared's Stone\torb\t\tob5\tob4\tob5\t100\t\t5\t1\t0\txxx\t\t\t8\t18\t\t\t\t\t\t\t\t10\t100\t\t\t\t50\t\t24\t0\t18\t1985\t62140\t1\t303\tob5\toba\tobf\t1hs\t1hs\t5\t1hss\t1\t3\t\t\t\t\tflpob5\tinvob5\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Stag Bow\tabow\t\tam1\tam1\tam1\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t7\t12\t\t\t\t\t\t100\t30\t45\t48\t1\t18\t0\t14\t2500\t56500\t\t300\tam1\tam6\tamb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam1\tinvam1\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t20\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Reflex Bow\tabow\t\tam2\tam2\tam2\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t9\t19\t\t\t\t10\t\t100\t35\t60\t55\t1\t27\t0\t20\t3575\t112525\t\t300\tam2\tam7\tamc\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam2\tinvam2\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Maiden Spear\taspe\t\tam3\tam3\tam3\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t18\t24\t\t\t4\t\t80\t50\t54\t40\t28\t\t18\t0\t14\t1672\t41596\t\t302\tam3\tam8\tamd\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpam3\tinvam3\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Maiden Pike\taspe\t\tam4\tpik\tam4\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t23\t55\t\t\t4\t10\t80\t50\t63\t52\t25\t\t27\t0\t20\t2023\t70621\t\t302\tam4\tam9\tame\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvam4\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Maiden Javelin\tajav\t\tam5\tpil\tam5\t100\t\t3\t1\t0\txxx\t\t\t8\t14\t\t\t\t\t6\t22\t2\t-10\t80\t50\t33\t47\t6\t\t23\t0\t17\t48\t15104\t\t302\tam5\tama\tamf\t1ht\t1ht\t5\t1ht\t1\t3\t1\t48\t120\t120\tflpam5\tinvam5\t\t\t\t\t0\tprimarily thrown\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Glowing Orb\torb\t\tob6\tob1\tob6\t100\t\t2\t1\t0\txxx\t\t\t8\t21\t\t\t\t\t\t\t\t-10\t100\t\t\t\t20\t\t32\t0\t24\t804\t44228\t1\t303\tob1\tob6\tobb\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob1\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Crystalline Globe\torb\t\tob7\tob1\tob7\t100\t\t3\t1\t0\txxx\t\t\t10\t26\t\t\t\t\t\t\t\t-10\t100\t\t\t\t30\t\t37\t0\t27\t1689\t83493\t1\t303\tob2\tob7\tobc\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob2\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Cloudy Sphere\torb\t\tob8\tob3\tob8\t100\t\t3\t1\t0\txxx\t\t\t11\t29\t\t\t\t\t\t\t\t\t100\t\t\t\t35\t\t41\t0\t30\t2598\t129518\t1\t303\tob3\tob8\tobd\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob3\tinvob3\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Sparkling Ball\torb\t\tob9\tob4\tob9\t100\t\t4\t1\t0\txxx\t\t\t13\t32\t\t\t\t\t\t\t\t\t100\t\t\t\t40\t\t46\t0\t34\t3969\t208074\t1\t303\tob4\tob9\tobe\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob4\tinvob4\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Swirling Crystal\torb\t\toba\tob4\toba\t100\t\t5\t1\t0\txxx\t\t\t18\t42\t\t\t\t\t\t\t\t10\t100\t\t\t\t50\t\t50\t0\t37\t6255\t340250\t1\t303\tob5\toba\tobf\t1hs\t1hs\t5\t1hss\t1\t3\t\t\t\t\tflpob5\tinvob5\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ashwood Bow\tabow\t\tam6\tam1\tam6\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t16\t29\t\t\t\t\t\t100\t56\t77\t48\t1\t39\t0\t29\t7800\t326200\t\t300\tam1\tam6\tamb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam1\tinvam1\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ceremonial Bow\tabow\t\tam7\tam2\tam7\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t19\t41\t\t\t\t10\t\t100\t73\t110\t55\t1\t47\t0\t35\t11025\t544175\t\t300\tam2\tam7\tamc\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam2\tinvam2\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ceremonial Spear\taspe\t\tam8\tam3\tam8\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t34\t51\t\t\t4\t\t80\t50\t101\t80\t28\t\t43\t0\t32\t5316\t252588\t\t302\tam3\tam8\tamd\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpam3\tinvam3\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ceremonial Pike\taspe\t\tam9\tpik\tam9\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t42\t101\t\t\t4\t20\t80\t50\t115\t98\t25\t\t51\t0\t38\t6369\t352819\t\t302\tam4\tam9\tame\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvam4\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Ceremonial Javelin\tajav\t\tama\tpil\tama\t100\t\t3\t1\t0\txxx\t\t\t18\t35\t\t\t\t\t18\t54\t2\t-10\t80\t50\t25\t109\t6\t\t35\t0\t26\t444\t35540\t\t302\tam5\tama\tamf\t1ht\t1ht\t5\t1ht\t1\t3\t1\t48\t120\t120\tflpam5\tinvam5\t\t\t\t\t0\tprimarily thrown\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n",
+                u8"Heavenly Stone\torb\t\tobb\tob1\tobb\t100\t\t2\t1\t0\txxx\t\t\t21\t46\t\t\t\t\t\t\t\t-10\t100\t\t\t\t20\t\t59\t0\t44\t21051\t1274009\t1\t303\tob1\tob6\tobb\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob1\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Eldritch Orb\torb\t\tobc\tob1\tobc\t100\t\t3\t1\t0\txxx\t\t\t18\t50\t\t\t\t\t\t\t\t-10\t100\t\t\t\t30\t\t67\t0\t50\t19367\t1333589\t1\t303\tob2\tob7\tobc\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob1\tinvob2\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Demon Heart\torb\t\tobd\tob3\tobd\t100\t\t3\t1\t0\txxx\t\t\t23\t55\t\t\t\t\t\t\t\t\t100\t\t\t\t35\t\t75\t0\t56\t22094\t1697050\t1\t303\tob3\tob8\tobd\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob3\tinvob3\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Vortex Orb\torb\t\tobe\tob4\tobe\t100\t\t4\t1\t0\txxx\t\t\t12\t66\t\t\t\t\t\t\t\t\t100\t\t\t\t40\t\t84\t0\t63\t25207\t2161888\t1\t303\tob4\tob9\tobe\t1hs\t1hs\t5\t1hss\t1\t2\t\t\t\t\tflpob4\tinvob4\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Dimensional Shard\torb\t\tobf\tob4\tobf\t100\t\t5\t1\t0\txxx\t\t\t30\t53\t\t\t\t\t\t\t\t10\t100\t\t\t\t50\t\t85\t0\t66\t20065\t1750525\t1\t303\tob5\toba\tobf\t1hs\t1hs\t5\t1hss\t1\t3\t\t\t\t\tflpob5\tinvob5\t\t\t1\t4\t0\t\t0\titem_orb\t12\titem_orb\t0\t0\t5\t0\t1\t0\t\t\t0\t7\t0\t0\t5\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Matriarchal Bow\tabow\t\tamb\tam1\tamb\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t20\t47\t\t\t\t-10\t\t100\t87\t187\t48\t1\t53\t0\t39\t23700\t1285100\t\t300\tam1\tam6\tamb\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam1\tinvam1\tinvswbu\tinvswbu\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Grand Matron Bow\tabow\t\tamc\tam2\tamc\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t14\t72\t\t\t\t10\t\t100\t108\t152\t55\t1\t78\t0\t58\t33375\t2644750\t\t300\tam2\tam7\tamc\tbow\tbow\t6\tbow\t2\t4\t\t\t\t\tflpam2\tinvam2\t\t\t1\t5\t0\t\t0\titem_bow\t12\titem_bow\t0\t0\t5\t1\t0\t0\t\t\t0\t7\t0\t0\t1\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Matriarchal Spear\taspe\t\tamd\tam3\tamd\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t65\t95\t\t\t4\t\t80\t50\t114\t142\t28\t\t61\t0\t45\t16248\t1024128\t\t302\tam3\tam8\tamd\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflpam3\tinvam3\t\t\t1\t6\t0\t2 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Matriarchal Pike\taspe\t\tame\tpik\tame\t100\t\t3\t1\t0\txxx\t\t\t\t\t\t1\t37\t153\t\t\t4\t20\t80\t50\t132\t149\t25\t\t81\t0\t60\t19407\t1614967\t\t302\tam4\tam9\tame\t2ht\t2ht\t5\t2ht\t2\t4\t\t\t\t\tflppik\tinvam4\t\t\t1\t6\t0\t3 square reach\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t0\t7\t0\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t5\t8\t0\txxx\txxx\t1\t0\t\n",
+                u8"Matriarchal Javelin\tajav\t\tamf\tpil\tamf\t100\t\t3\t1\t0\txxx\t\t\t30\t54\t\t\t\t\t35\t66\t2\t-10\t80\t50\t107\t151\t6\t\t65\t0\t48\t302\t54630\t\t302\tam5\tama\tamf\t1ht\t1ht\t5\t1ht\t1\t3\t1\t48\t120\t120\tflpam5\tinvam5\t\t\t\t\t0\tprimarily thrown\t0\titem_staff\t12\titem_staff\t0\t0\t5\t0\t0\t0\t\t\t371\t7\t2\t0\t3\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t\t\t\t\t255\t1\t2\t0\txxx\txxx\t1\t0\t\n"
+            };
+            return EmbeddedText(defaultTxtLines);
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,417 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#include "pch.h"
+#include "BatchProcessor.h"
+#include "../d2ce/BitSink.h"
+#include "../d2ce/BackupStore.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+//---------------------------------------------------------------------------
+namespace d2ce
+{
+    std::int64_t GetBackupTimestamp()
+    {
+        auto now = std::chrono::system_clock::now();
+        return std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+    }
+
+    bool WriteTextFile(const std::filesystem::path& path, const std::string& text)
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+
+        std::vector<std::uint8_t> buffer(text.begin(), text.end());
+        BitSink sink(buffer);
+        return sink.commit(path);
+    }
+
+    bool WriteBinaryFile(const std::filesystem::path& path, std::vector<std::uint8_t>& buffer)
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+
+        BitSink sink(buffer);
+        return sink.commit(path);
+    }
+}
+
+//---------------------------------------------------------------------------
+d2ce::BatchProcessor::BatchProcessor(const BatchOptions& options) : m_options(options)
+{
+    if (m_options.Ops == EnumBatchOp::None)
+    {
+        m_options.Ops = EnumBatchOp::Validate;
+    }
+}
+//---------------------------------------------------------------------------
+d2ce::BatchProcessor::~BatchProcessor()
+{
+}
+//---------------------------------------------------------------------------
+bool d2ce::BatchProcessor::isSupportedFile(const std::filesystem::path& path)
+{
+    std::wstring ext = path.extension().wstring();
+    if ((_wcsicmp(ext.c_str(), L".d2s") == 0) || (_wcsicmp(ext.c_str(), L".d2i") == 0) || (_wcsicmp(ext.c_str(), L".json") == 0))
+    {
+        return true;
+    }
+
+    return false;
+}
+//---------------------------------------------------------------------------
+size_t d2ce::BatchProcessor::run(const std::vector<BatchFile>& files, std::vector<BatchResult>& results)
+{
+    results.clear();
+    results.resize(files.size());
+    if (files.empty())
+    {
+        return 0;
+    }
+
+    // The game data is global and opening a file installs the txt reader of its D2R mod,
+    // so the files are grouped by txt reader and each group's reader is installed before
+    // its workers start. Each worker holds the group's game data while it processes a file,
+    // so the tables cannot be switched under it.
+    std::vector<std::pair<const ITxtReader*, std::vector<size_t>>> groups;
+    for (size_t idx = 0; idx < files.size(); ++idx)
+    {
+        const auto* pTxtReader = &Character::getFileTxtReader(files[idx].Path);
+        auto iter = std::find_if(groups.begin(), groups.end(), [pTxtReader](const auto& group) { return group.first == pTxtReader; });
+        if (iter == groups.end())
+        {
+            groups.emplace_back(pTxtReader, std::vector<size_t>());
+            iter = groups.end() - 1;
+        }
+
+        iter->second.push_back(idx);
+    }
+
+    size_t numFailed = 0;
+    for (const auto& group : groups)
+    {
+        GameDataContextPtr pGameData;
+        {
+            Character character;
+            character.setTxtReader(*group.first);
+            pGameData = character.getGameDataContext();
+        }
+
+        numFailed += run(files, group.second, pGameData, results);
+    }
+
+    return numFailed;
+}
+//---------------------------------------------------------------------------
+size_t d2ce::BatchProcessor::run(const std::vector<BatchFile>& files, const std::vector<size_t>& fileIndexes, const GameDataContextPtr& pGameData, std::vector<BatchResult>& results)
+{
+    size_t numThreads = m_options.NumThreads;
+    if (numThreads == 0)
+    {
+        numThreads = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+    }
+    numThreads = std::min(numThreads, fileIndexes.size());
+
+    // the files are already read in parallel, so each one only gets its share of the cores for its items
+    size_t maxReadThreads = std::max(size_t(std::thread::hardware_concurrency()) / std::max(numThreads, size_t(1)), size_t(1));
+
+    std::atomic<size_t> nextFile{ 0 };
+    std::atomic<size_t> numFailed{ 0 };
+    auto worker = [&]()
+    {
+        auto prevReadThreads = Items::getMaxReadThreads();
+        Items::setMaxReadThreads(maxReadThreads);
+        for (size_t pos = nextFile++; pos < fileIndexes.size(); pos = nextFile++)
+        {
+            auto idx = fileIndexes[pos];
+            try
+            {
+                GameDataScope gameData(pGameData);
+                results[idx] = processFile(files[idx]);
+            }
+            catch (const std::exception& e)
+            {
+                results[idx].Success = false;
+                results[idx].Message = e.what();
+            }
+
+            if (!results[idx].Success)
+            {
+                ++numFailed;
+            }
+
+            report(files[idx], results[idx]);
+        }
+
+        Items::setMaxReadThreads(prevReadThreads);
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads - 1);
+    for (size_t i = 1; i < numThreads; ++i)
+    {
+        workers.emplace_back(worker);
+    }
+
+    // the calling thread is one of the workers
+    worker();
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+
+    return numFailed;
+}
+//---------------------------------------------------------------------------
+d2ce::BatchResult d2ce::BatchProcessor::processFile(const BatchFile& file)
+{
+    if (getOutputPath(file).empty())
+    {
+        BatchResult result;
+        result.Message = "File is not under its root folder, no output path";
+        return result;
+    }
+
+    std::wstring ext = file.Path.extension().wstring();
+    if (_wcsicmp(ext.c_str(), L".d2i") == 0)
+    {
+        return processSharedStash(file);
+    }
+
+    return processCharacter(file);
+}
+//---------------------------------------------------------------------------
+d2ce::BatchResult d2ce::BatchProcessor::processCharacter(const BatchFile& file)
+{
+    BatchResult result;
+    Character character;
+    if (!character.open(file.Path))
+    {
+        auto ec = character.getLastError();
+        result.Message = ec ? ec.message() : "Unable to open file";
+        return result;
+    }
+
+    if ((m_options.Ops & EnumBatchOp::UpgradeGems) != 0)
+    {
+        result.NumItemsChanged += character.upgradeGems();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::UpgradePotions) != 0)
+    {
+        result.NumItemsChanged += character.upgradePotions();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::UpgradeRejuvenations) != 0)
+    {
+        result.NumItemsChanged += character.upgradeRejuvenationPotions();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::RepairAll) != 0)
+    {
+        result.NumItemsChanged += character.repairAllItems();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::MaxDurabilityAll) != 0)
+    {
+        result.NumItemsChanged += character.maxDurabilityAllItems();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::FillStackables) != 0)
+    {
+        result.NumItemsChanged += character.fillAllStackables();
+    }
+
+    bool bInPlace = m_options.OutputPath.empty();
+    if ((m_options.Ops & EnumBatchOp::ConvertVersion) != 0)
+    {
+        // the conversion writes the in-memory character, so it includes any item changes
+        if (bInPlace && m_options.Backup)
+        {
+            BackupStore backupStore(file.Path);
+            backupStore.backup(GetBackupTimestamp());
+        }
+
+        auto outputPath = getOutputPath(file);
+        std::error_code ec;
+        std::filesystem::create_directories(outputPath.parent_path(), ec);
+        if (!character.saveAsVersion(outputPath, m_options.Version, Character::EnumCharSaveOp::NoSave))
+        {
+            auto errorCode = character.getLastError();
+            result.Message = errorCode ? errorCode.message() : "Unable to convert file";
+            return result;
+        }
+    }
+    else if (result.NumItemsChanged > 0)
+    {
+        if (bInPlace)
+        {
+            if (!character.save(m_options.Backup))
+            {
+                auto ec = character.getLastError();
+                result.Message = ec ? ec.message() : "Unable to save file";
+                return result;
+            }
+        }
+        else
+        {
+            std::vector<std::uint8_t> buffer;
+            if (!character.serialize(buffer) || !WriteBinaryFile(getOutputPath(file, ".d2s"), buffer))
+            {
+                result.Message = "Unable to save file";
+                return result;
+            }
+        }
+    }
+
+    // a json character exported in place would just overwrite itself
+    std::wstring ext = file.Path.extension().wstring();
+    bool bIsJsonFile = (_wcsicmp(ext.c_str(), L".json") == 0) ? true : false;
+    if (((m_options.Ops & EnumBatchOp::ExportJson) != 0) && !(bInPlace && bIsJsonFile))
+    {
+        auto json = character.asJson(m_options.SerializedJson, Character::EnumCharSaveOp::NoSave);
+        if (json.empty() || !WriteTextFile(getOutputPath(file, ".json"), json))
+        {
+            result.Message = "Unable to export json";
+            return result;
+        }
+    }
+
+    result.Success = true;
+    return result;
+}
+//---------------------------------------------------------------------------
+d2ce::BatchResult d2ce::BatchProcessor::processSharedStash(const BatchFile& file)
+{
+    BatchResult result;
+    SharedStash stash;
+    if (!stash.open(file.Path))
+    {
+        result.Message = "Invalid shared stash file";
+        return result;
+    }
+
+    if ((m_options.Ops & EnumBatchOp::UpgradeGems) != 0)
+    {
+        result.NumItemsChanged += stash.upgradeGems();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::UpgradePotions) != 0)
+    {
+        result.NumItemsChanged += stash.upgradePotions();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::UpgradeRejuvenations) != 0)
+    {
+        result.NumItemsChanged += stash.upgradeRejuvenationPotions();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::RepairAll) != 0)
+    {
+        result.NumItemsChanged += stash.repairAllItems();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::MaxDurabilityAll) != 0)
+    {
+        result.NumItemsChanged += stash.maxDurabilityAllItems();
+    }
+
+    if ((m_options.Ops & EnumBatchOp::FillStackables) != 0)
+    {
+        result.NumItemsChanged += stash.fillAllStackables();
+    }
+
+    if (result.NumItemsChanged > 0)
+    {
+        if (m_options.OutputPath.empty())
+        {
+            if (!stash.save(m_options.Backup))
+            {
+                result.Message = "Unable to save file";
+                return result;
+            }
+        }
+        else
+        {
+            std::vector<std::uint8_t> buffer;
+            if (!stash.serialize(buffer) || !WriteBinaryFile(getOutputPath(file), buffer))
+            {
+                result.Message = "Unable to save file";
+                return result;
+            }
+        }
+    }
+
+    // the shared stash has no version conversion or json form, those operations do not apply
+    result.Success = true;
+    return result;
+}
+//---------------------------------------------------------------------------
+std::filesystem::path d2ce::BatchProcessor::getOutputPath(const BatchFile& file, const std::filesystem::path& extension) const
+{
+    std::filesystem::path outputPath;
+    if (m_options.OutputPath.empty())
+    {
+        outputPath = file.Path;
+    }
+    else
+    {
+        auto relativePath = file.Root.empty() ? file.Path.filename() : file.Path.lexically_relative(file.Root);
+        if (relativePath.empty() || (relativePath == ".") || (*relativePath.begin() == ".."))
+        {
+            // flattening it to the file name could make files from different folders overwrite each other
+            return std::filesystem::path();
+        }
+
+        outputPath = m_options.OutputPath / relativePath;
+    }
+
+    if (!extension.empty())
+    {
+        outputPath.replace_extension(extension);
+    }
+
+    return outputPath;
+}
+//---------------------------------------------------------------------------
+void d2ce::BatchProcessor::report(const BatchFile& file, const BatchResult& result)
+{
+    if (result.Success && !m_options.Verbose)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_outputMutex);
+    if (result.Success)
+    {
+        std::wcout << L"OK      " << file.Path.wstring();
+        if (result.NumItemsChanged > 0)
+        {
+            std::wcout << L" (" << result.NumItemsChanged << L" items changed)";
+        }
+        std::wcout << std::endl;
+        return;
+    }
+
+    std::wcerr << L"FAILED  " << file.Path.wstring() << L": " << std::wstring(result.Message.begin(), result.Message.end()) << std::endl;
+}
+//---------------------------------------------------------------------------
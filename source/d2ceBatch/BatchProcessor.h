@@ -0,0 +1,106 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#pragma once
+
+#include "../d2ce/Character.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <filesystem>
+
+namespace d2ce
+{
+    //---------------------------------------------------------------------------
+    enum class EnumBatchOp : std::uint16_t
+    {
+        None = 0,
+        Validate = 0x0001,
+        ConvertVersion = 0x0002,
+        ExportJson = 0x0004,
+        UpgradeGems = 0x0008,
+        UpgradePotions = 0x0010,
+        UpgradeRejuvenations = 0x0020,
+        RepairAll = 0x0040,
+        MaxDurabilityAll = 0x0080,
+        FillStackables = 0x0100
+    };
+    BITMASK_DEFINE_VALUE_MASK(EnumBatchOp, 0x01FF);
+
+    //---------------------------------------------------------------------------
+    struct BatchOptions
+    {
+        bitmask::bitmask<EnumBatchOp> Ops = EnumBatchOp::Validate;
+        EnumCharVersion Version = APP_CHAR_VERSION; // used by ConvertVersion
+        bool SerializedJson = false;                // used by ExportJson
+        bool Backup = true;                         // back up files modified in place
+        bool Verbose = false;                       // report every file, not just the failures
+        std::filesystem::path OutputPath;           // empty to write the results next to the input files
+        size_t NumThreads = 0;                      // 0 to use one worker per hardware thread
+    };
+
+    //---------------------------------------------------------------------------
+    struct BatchFile
+    {
+        std::filesystem::path Path;
+        std::filesystem::path Root; // the results keep the path relative to this folder under BatchOptions::OutputPath
+    };
+
+    //---------------------------------------------------------------------------
+    struct BatchResult
+    {
+        bool Success = false;
+        size_t NumItemsChanged = 0;
+        std::string Message;
+    };
+
+    //---------------------------------------------------------------------------
+    // Runs the requested operations over .d2s, .json and .d2i files on a pool of
+    // worker threads, each file is opened, changed and written by a single worker.
+    // The game data is shared by all workers, so the files are processed in groups
+    // that use the same D2R mod and the group's game data is loaded before its workers start.
+    // Every worker holds the group's game data locked while it processes a file.
+    class BatchProcessor
+    {
+    private:
+        BatchOptions m_options;
+        std::mutex m_outputMutex;
+
+    private:
+        size_t run(const std::vector<BatchFile>& files, const std::vector<size_t>& fileIndexes, const GameDataContextPtr& pGameData, std::vector<BatchResult>& results);
+        BatchResult processFile(const BatchFile& file);
+        BatchResult processCharacter(const BatchFile& file);
+        BatchResult processSharedStash(const BatchFile& file);
+        // returns an empty path if the file is not under its root folder
+        std::filesystem::path getOutputPath(const BatchFile& file, const std::filesystem::path& extension = std::filesystem::path()) const;
+        void report(const BatchFile& file, const BatchResult& result);
+
+    public:
+        BatchProcessor(const BatchOptions& options);
+        ~BatchProcessor();
+
+        static bool isSupportedFile(const std::filesystem::path& path);
+
+        // returns the number of files that failed
+        size_t run(const std::vector<BatchFile>& files, std::vector<BatchResult>& results);
+    };
+    //---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
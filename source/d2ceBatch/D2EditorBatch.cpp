@@ -0,0 +1,271 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#include "pch.h"
+#include "BatchProcessor.h"
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+//---------------------------------------------------------------------------
+namespace
+{
+    void PrintUsage()
+    {
+        std::cout << "Usage: D2EditorBatch [options] <file or folder>..." << std::endl
+            << std::endl
+            << "Processes .d2s, .json and .d2i files, folders are searched for all of them." << std::endl
+            << std::endl
+            << "Operations (validate only if none are given):" << std::endl
+            << "  --validate                open every file and report the ones that fail to load" << std::endl
+            << "  --convert <version>       save characters as v100, v107, v108, v109, v110, v100R, v120 or v140" << std::endl
+            << "  --json                    export characters as json" << std::endl
+            << "  --json-serialized         export characters as json in the serialized format" << std::endl
+            << "  --upgrade-gems            upgrade all gems to perfect" << std::endl
+            << "  --upgrade-potions         upgrade all potions to their highest level" << std::endl
+            << "  --upgrade-rejuvenations   turn all potions into full rejuvenation potions" << std::endl
+            << "  --repair                  repair all items" << std::endl
+            << "  --max-durability          set all items to their maximum durability" << std::endl
+            << "  --fill-stackables         fill all stackable items" << std::endl
+            << std::endl
+            << "Options:" << std::endl
+            << "  -r, --recursive           search folders recursively" << std::endl
+            << "  -o, --out <folder>        write the results to this folder instead of in place" << std::endl
+            << "  -j, --jobs <n>            number of worker threads (default: one per hardware thread)" << std::endl
+            << "  --no-backup               do not back up files changed in place" << std::endl
+            << "  -v, --verbose             report every file, not just the failures" << std::endl;
+    }
+
+    // ASCII only, the option values are never localized
+    bool EqualsNoCase(const std::string& lhs, const std::string& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char a, char b)
+            {
+                return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+            });
+    }
+
+    bool ParseVersion(const std::string& value, d2ce::EnumCharVersion& version)
+    {
+        static const std::pair<const char*, d2ce::EnumCharVersion> versions[] = {
+            { "v100", d2ce::EnumCharVersion::v100 },
+            { "v107", d2ce::EnumCharVersion::v107 },
+            { "v108", d2ce::EnumCharVersion::v108 },
+            { "v109", d2ce::EnumCharVersion::v109 },
+            { "v110", d2ce::EnumCharVersion::v110 },
+            { "v100R", d2ce::EnumCharVersion::v100R },
+            { "v120", d2ce::EnumCharVersion::v120 },
+            { "v140", d2ce::EnumCharVersion::v140 } };
+
+        for (const auto& item : versions)
+        {
+            if (EqualsNoCase(value, item.first))
+            {
+                version = item.second;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void AddFiles(const std::filesystem::path& path, bool bRecursive, std::vector<d2ce::BatchFile>& files)
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(path, ec))
+        {
+            d2ce::BatchFile file;
+            file.Path = path;
+            file.Root = path.parent_path();
+            files.push_back(file);
+            return;
+        }
+
+        auto addEntry = [&](const std::filesystem::directory_entry& entry)
+        {
+            if (entry.is_regular_file(ec) && d2ce::BatchProcessor::isSupportedFile(entry.path()))
+            {
+                d2ce::BatchFile file;
+                file.Path = entry.path();
+                file.Root = path;
+                files.push_back(file);
+            }
+        };
+
+        if (bRecursive)
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(path, std::filesystem::directory_options::skip_permission_denied, ec))
+            {
+                addEntry(entry);
+            }
+        }
+        else
+        {
+            for (const auto& entry : std::filesystem::directory_iterator(path, std::filesystem::directory_options::skip_permission_denied, ec))
+            {
+                addEntry(entry);
+            }
+        }
+    }
+
+    // args are UTF-8, without the program name
+    int Run(const std::vector<std::string>& args)
+    {
+        d2ce::BatchOptions options;
+        options.Ops = d2ce::EnumBatchOp::None;
+        bool bRecursive = false;
+        std::vector<std::filesystem::path> inputs;
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            const auto& arg = args[i];
+            bool bHasValue = (i + 1 < args.size()) ? true : false;
+            if (arg == "--validate")
+            {
+                options.Ops |= d2ce::EnumBatchOp::Validate;
+            }
+            else if (arg == "--convert" && bHasValue)
+            {
+                if (!ParseVersion(args[++i], options.Version))
+                {
+                    std::cerr << "Unknown version: " << args[i] << std::endl;
+                    return 2;
+                }
+                options.Ops |= d2ce::EnumBatchOp::ConvertVersion;
+            }
+            else if (arg == "--json")
+            {
+                options.Ops |= d2ce::EnumBatchOp::ExportJson;
+            }
+            else if (arg == "--json-serialized")
+            {
+                options.Ops |= d2ce::EnumBatchOp::ExportJson;
+                options.SerializedJson = true;
+            }
+            else if (arg == "--upgrade-gems")
+            {
+                options.Ops |= d2ce::EnumBatchOp::UpgradeGems;
+            }
+            else if (arg == "--upgrade-potions")
+            {
+                options.Ops |= d2ce::EnumBatchOp::UpgradePotions;
+            }
+            else if (arg == "--upgrade-rejuvenations")
+            {
+                options.Ops |= d2ce::EnumBatchOp::UpgradeRejuvenations;
+            }
+            else if (arg == "--repair")
+            {
+                options.Ops |= d2ce::EnumBatchOp::RepairAll;
+            }
+            else if (arg == "--max-durability")
+            {
+                options.Ops |= d2ce::EnumBatchOp::MaxDurabilityAll;
+            }
+            else if (arg == "--fill-stackables")
+            {
+                options.Ops |= d2ce::EnumBatchOp::FillStackables;
+            }
+            else if (arg == "-r" || arg == "--recursive")
+            {
+                bRecursive = true;
+            }
+            else if ((arg == "-o" || arg == "--out") && bHasValue)
+            {
+                options.OutputPath = std::filesystem::u8path(args[++i]);
+            }
+            else if ((arg == "-j" || arg == "--jobs") && bHasValue)
+            {
+                options.NumThreads = size_t(std::strtoul(args[++i].c_str(), nullptr, 10));
+            }
+            else if (arg == "--no-backup")
+            {
+                options.Backup = false;
+            }
+            else if (arg == "-v" || arg == "--verbose")
+            {
+                options.Verbose = true;
+            }
+            else if (arg == "-h" || arg == "--help" || arg == "/?")
+            {
+                PrintUsage();
+                return 0;
+            }
+            else if (!arg.empty() && arg[0] == '-')
+            {
+                std::cerr << "Unknown option: " << arg << std::endl;
+                PrintUsage();
+                return 2;
+            }
+            else
+            {
+                inputs.push_back(std::filesystem::u8path(arg));
+            }
+        }
+
+        if (inputs.empty())
+        {
+            PrintUsage();
+            return 2;
+        }
+
+        std::vector<d2ce::BatchFile> files;
+        for (const auto& input : inputs)
+        {
+            AddFiles(input, bRecursive, files);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<d2ce::BatchResult> results;
+        d2ce::BatchProcessor processor(options);
+        auto numFailed = processor.run(files, results);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+        size_t numItemsChanged = 0;
+        for (const auto& result : results)
+        {
+            numItemsChanged += result.NumItemsChanged;
+        }
+
+        std::cout << "Processed " << files.size() << " files, " << numFailed << " failed, "
+            << numItemsChanged << " items changed in " << (elapsed / 1000.0) << " seconds" << std::endl;
+        return numFailed == 0 ? 0 : 1;
+    }
+}
+
+//---------------------------------------------------------------------------
+#ifdef _WIN32
+// wide arguments so file names outside the console code page arrive intact
+int wmain(int argc, wchar_t* argv[])
+{
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; ++i)
+    {
+        args.push_back(std::filesystem::path(argv[i]).u8string());
+    }
+
+    return Run(args);
+}
+#else
+int main(int argc, char* argv[])
+{
+    return Run(std::vector<std::string>(argv + 1, argv + argc));
+}
+#endif
+//---------------------------------------------------------------------------
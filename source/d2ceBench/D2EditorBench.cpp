@@ -0,0 +1,509 @@
+/*
+    Diablo II Character Editor
+    Copyright (C) 2021-2023 Walter Couto
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+//---------------------------------------------------------------------------
+
+#include "pch.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <malloc.h>
+#include <new>
+#include <json/json.h>
+
+//---------------------------------------------------------------------------
+// Every allocation made by the process goes through here, so each benchmark
+// can report how many allocations the operation it measures made. The item
+// lists and item bits use the default allocators, so they are counted too.
+// All the replaceable forms are replaced, so no allocation bypasses the counts.
+namespace
+{
+    std::atomic<std::uint64_t> g_numAllocations{ 0 };
+    std::atomic<std::uint64_t> g_numAllocatedBytes{ 0 };
+
+    void* CountedAlloc(std::size_t size) noexcept
+    {
+        ++g_numAllocations;
+        g_numAllocatedBytes += size;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* CountedAlignedAlloc(std::size_t size, std::align_val_t alignment) noexcept
+    {
+        ++g_numAllocations;
+        g_numAllocatedBytes += size;
+        return _aligned_malloc(size == 0 ? 1 : size, static_cast<std::size_t>(alignment));
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    void* p = CountedAlloc(size);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    void* p = CountedAlignedAlloc(size, alignment);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return ::operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return CountedAlignedAlloc(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return CountedAlignedAlloc(size, alignment);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    _aligned_free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+    _aligned_free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    _aligned_free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    _aligned_free(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    _aligned_free(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    _aligned_free(p);
+}
+
+//---------------------------------------------------------------------------
+namespace
+{
+    struct BenchSample
+    {
+        double Microseconds = 0.0;
+        std::uint64_t Allocations = 0;
+    };
+
+    struct BenchResult
+    {
+        std::string Name;
+        std::vector<BenchSample> Samples; // one per file and iteration
+        size_t NumFailed = 0;
+        std::uint64_t NumBytes = 0;       // bytes read or written by the operation
+        std::uint64_t NumItems = 0;
+        std::uint64_t AllocatedBytes = 0;
+
+        double totalSeconds() const
+        {
+            double total = 0.0;
+            for (const auto& sample : Samples)
+            {
+                total += sample.Microseconds;
+            }
+
+            return total / 1000000.0;
+        }
+
+        std::uint64_t totalAllocations() const
+        {
+            std::uint64_t total = 0;
+            for (const auto& sample : Samples)
+            {
+                total += sample.Allocations;
+            }
+
+            return total;
+        }
+
+        double percentile(double p) const
+        {
+            if (Samples.empty())
+            {
+                return 0.0;
+            }
+
+            std::vector<double> times;
+            times.reserve(Samples.size());
+            for (const auto& sample : Samples)
+            {
+                times.push_back(sample.Microseconds);
+            }
+
+            auto idx = size_t(p * double(times.size() - 1) + 0.5);
+            std::nth_element(times.begin(), times.begin() + idx, times.end());
+            return times[idx];
+        }
+    };
+
+    // times a single call of "op", which returns false if the operation failed
+    template <class Op>
+    bool Measure(BenchResult& result, Op op)
+    {
+        auto allocations = g_numAllocations.load();
+        auto allocatedBytes = g_numAllocatedBytes.load();
+        auto start = std::chrono::steady_clock::now();
+        bool bSuccess = op();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        if (!bSuccess)
+        {
+            ++result.NumFailed;
+            return false;
+        }
+
+        BenchSample sample;
+        sample.Microseconds = std::chrono::duration<double, std::micro>(elapsed).count();
+        sample.Allocations = g_numAllocations.load() - allocations;
+        result.AllocatedBytes += g_numAllocatedBytes.load() - allocatedBytes;
+        result.Samples.push_back(sample);
+        return true;
+    }
+
+    void FindFiles(const std::filesystem::path& path, const wchar_t* extension, std::vector<std::filesystem::path>& files)
+    {
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(path, ec))
+        {
+            if (entry.is_regular_file(ec) && (_wcsicmp(entry.path().extension().wstring().c_str(), extension) == 0))
+            {
+                files.push_back(entry.path());
+            }
+        }
+
+        std::sort(files.begin(), files.end());
+    }
+
+    Json::Value AsJson(const BenchResult& result)
+    {
+        auto seconds = result.totalSeconds();
+        Json::Value value;
+        value["name"] = result.Name;
+        value["samples"] = Json::UInt64(result.Samples.size());
+        value["failed"] = Json::UInt64(result.NumFailed);
+        value["seconds"] = seconds;
+        value["bytes"] = Json::UInt64(result.NumBytes);
+        value["items"] = Json::UInt64(result.NumItems);
+        value["mbPerSec"] = seconds > 0.0 ? (double(result.NumBytes) / (1024.0 * 1024.0)) / seconds : 0.0;
+        value["itemsPerSec"] = seconds > 0.0 ? double(result.NumItems) / seconds : 0.0;
+        value["p50Us"] = result.percentile(0.50);
+        value["p99Us"] = result.percentile(0.99);
+        value["allocations"] = Json::UInt64(result.totalAllocations());
+        value["allocationsPerFile"] = result.Samples.empty() ? 0.0 : double(result.totalAllocations()) / double(result.Samples.size());
+        value["allocatedBytes"] = Json::UInt64(result.AllocatedBytes);
+        return value;
+    }
+
+    void Print(const BenchResult& result)
+    {
+        auto seconds = result.totalSeconds();
+        auto numSamples = std::max(result.Samples.size(), size_t(1));
+        std::wcout << std::left << std::setw(12) << std::wstring(result.Name.begin(), result.Name.end())
+            << std::right << std::fixed << std::setprecision(1)
+            << std::setw(8) << result.Samples.size()
+            << std::setw(8) << result.NumFailed
+            << std::setw(12) << (seconds > 0.0 ? double(result.NumItems) / seconds : 0.0)
+            << std::setw(10) << (seconds > 0.0 ? (double(result.NumBytes) / (1024.0 * 1024.0)) / seconds : 0.0)
+            << std::setw(10) << result.percentile(0.50)
+            << std::setw(10) << result.percentile(0.99)
+            << std::setw(12) << double(result.totalAllocations()) / double(numSamples)
+            << std::endl;
+    }
+
+    void PrintUsage()
+    {
+        std::wcout << L"Usage: D2EditorBench [options] [examples folder]" << std::endl
+            << std::endl
+            << L"Measures parsing and serialization over the .d2s characters and .d2i items" << std::endl
+            << L"of the examples folder (default: .\\examples)." << std::endl
+            << std::endl
+            << L"Options:" << std::endl
+            << L"  -i, --iterations <n>  number of passes over the files (default: 3)" << std::endl
+            << L"  --json <file>         also write the results to a json file" << std::endl;
+    }
+}
+
+//---------------------------------------------------------------------------
+int wmain(int argc, wchar_t* argv[])
+{
+    std::filesystem::path examplesPath = L"examples";
+    std::filesystem::path jsonPath;
+    size_t numIterations = 3;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::wstring arg(argv[i]);
+        bool bHasValue = (i + 1 < argc) ? true : false;
+        if ((arg == L"-i" || arg == L"--iterations") && bHasValue)
+        {
+            numIterations = std::max(size_t(std::wcstoul(argv[++i], nullptr, 10)), size_t(1));
+        }
+        else if (arg == L"--json" && bHasValue)
+        {
+            jsonPath = argv[++i];
+        }
+        else if (arg == L"-h" || arg == L"--help" || arg == L"/?")
+        {
+            PrintUsage();
+            return 0;
+        }
+        else if (!arg.empty() && arg[0] == L'-')
+        {
+            std::wcerr << L"Unknown option: " << arg << std::endl;
+            PrintUsage();
+            return 2;
+        }
+        else
+        {
+            examplesPath = arg;
+        }
+    }
+
+    std::vector<std::filesystem::path> charFiles;
+    std::vector<std::filesystem::path> itemFiles;
+    FindFiles(examplesPath, L".d2s", charFiles);
+    FindFiles(examplesPath, L".d2i", itemFiles);
+    if (charFiles.empty())
+    {
+        std::wcerr << L"No .d2s files found in " << examplesPath.wstring() << std::endl;
+        return 2;
+    }
+
+    // the benchmarks save and re-import, so they work on copies of the characters
+    auto tempPath = std::filesystem::temp_directory_path() / L"D2CEBench";
+    std::error_code ec;
+    std::filesystem::remove_all(tempPath, ec);
+    std::filesystem::create_directories(tempPath, ec);
+    std::vector<std::filesystem::path> workFiles;
+    for (size_t i = 0; i < charFiles.size(); ++i)
+    {
+        // characters of different versions share names, keep them apart
+        auto workPath = tempPath / std::to_wstring(i);
+        std::filesystem::create_directories(workPath, ec);
+        workPath /= charFiles[i].filename();
+        std::filesystem::copy_file(charFiles[i], workPath, std::filesystem::copy_options::overwrite_existing, ec);
+        workFiles.push_back(workPath);
+    }
+
+    // load the game data up front so it is not counted against the first file
+    {
+        d2ce::Character character;
+        character.setDefaultTxtReader();
+    }
+
+    BenchResult openResult;
+    openResult.Name = "open";
+    BenchResult asJsonResult;
+    asJsonResult.Name = "asJson";
+    BenchResult openJsonResult;
+    openJsonResult.Name = "openJson";
+    BenchResult saveResult;
+    saveResult.Name = "save";
+    BenchResult importResult;
+    importResult.Name = "itemImport";
+
+    std::filesystem::path hostPath;
+    auto hostVersion = d2ce::EnumCharVersion::v100;
+    for (size_t iteration = 0; iteration < numIterations; ++iteration)
+    {
+        for (const auto& path : workFiles)
+        {
+            d2ce::Character character;
+            if (!Measure(openResult, [&]() { return character.open(path); }))
+            {
+                continue;
+            }
+            openResult.NumBytes += character.getFileSize();
+            openResult.NumItems += character.getNumberOfItems();
+
+            std::string json;
+            if (Measure(asJsonResult, [&]() { json = character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave); return !json.empty(); }))
+            {
+                asJsonResult.NumBytes += json.size();
+                asJsonResult.NumItems += character.getNumberOfItems();
+
+                auto jsonFile = path;
+                jsonFile.replace_extension(L".json");
+                std::FILE* pFile = nullptr;
+                _wfopen_s(&pFile, jsonFile.wstring().c_str(), L"wb");
+                if (pFile != nullptr)
+                {
+                    std::fwrite(json.c_str(), json.size(), 1, pFile);
+                    std::fclose(pFile);
+
+                    d2ce::Character jsonCharacter;
+                    if (Measure(openJsonResult, [&]() { return jsonCharacter.open(jsonFile); }))
+                    {
+                        openJsonResult.NumBytes += json.size();
+                        openJsonResult.NumItems += jsonCharacter.getNumberOfItems();
+                    }
+                }
+            }
+
+            if (Measure(saveResult, [&]() { return character.save(false); }))
+            {
+                saveResult.NumBytes += character.getFileSize();
+                saveResult.NumItems += character.getNumberOfItems();
+            }
+
+            if (hostPath.empty() || (character.getVersion() > hostVersion))
+            {
+                // import into the character with the newest file version so every item format is supported
+                hostPath = path;
+                hostVersion = character.getVersion();
+            }
+        }
+
+        if (itemFiles.empty() || hostPath.empty())
+        {
+            continue;
+        }
+
+        // imported items pile up in the buffer of the host, so start over with a fresh one now and then
+        d2ce::Character host;
+        size_t numImported = 0;
+        for (const auto& path : itemFiles)
+        {
+            if (numImported % 256 == 0)
+            {
+                host.open(hostPath);
+            }
+            ++numImported;
+
+            const d2ce::Item* pImportedItem = nullptr;
+            if (Measure(importResult, [&]() { return host.importItem(path, pImportedItem, false); }))
+            {
+                std::error_code sizeEc;
+                importResult.NumBytes += std::filesystem::file_size(path, sizeEc);
+                ++importResult.NumItems;
+            }
+        }
+    }
+
+    std::filesystem::remove_all(tempPath, ec);
+
+    std::wcout << std::left << std::setw(12) << L"benchmark" << std::right
+        << std::setw(8) << L"files" << std::setw(8) << L"failed" << std::setw(12) << L"items/s"
+        << std::setw(10) << L"MB/s" << std::setw(10) << L"p50 us" << std::setw(10) << L"p99 us"
+        << std::setw(12) << L"allocs/file" << std::endl;
+
+    const BenchResult* results[] = { &openResult, &asJsonResult, &openJsonResult, &saveResult, &importResult };
+
+    Json::Value root;
+    root["iterations"] = Json::UInt64(numIterations);
+    root["characters"] = Json::UInt64(charFiles.size());
+    root["items"] = Json::UInt64(itemFiles.size());
+    Json::Value benchmarks(Json::arrayValue);
+    for (const auto* pResult : results)
+    {
+        Print(*pResult);
+        benchmarks.append(AsJson(*pResult));
+    }
+    root["benchmarks"] = benchmarks;
+
+    if (!jsonPath.empty())
+    {
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "    ";
+        auto jsonStr = Json::writeString(builder, root);
+        std::FILE* pFile = nullptr;
+        _wfopen_s(&pFile, jsonPath.wstring().c_str(), L"wb");
+        if (pFile == nullptr)
+        {
+            std::wcerr << L"Unable to write " << jsonPath.wstring() << std::endl;
+            return 1;
+        }
+
+        std::fwrite(jsonStr.c_str(), jsonStr.size(), 1, pFile);
+        std::fclose(pFile);
+    }
+
+    return 0;
+}
+//---------------------------------------------------------------------------
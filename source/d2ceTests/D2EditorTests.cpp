@@ -1,6 +1,14 @@
 ﻿#include "pch.h"
 #include "CppUnitTest.h"
+#include "../d2ce/helpers/DefaultTxtReader.h"
+#include "../d2ce/helpers/ItemHelpers.h"
+#include "../d2ce/SharedStash.h"
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <set>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -373,6 +381,345 @@ namespace D2EditorTests
         return GetJsonText(expectedPath);
     }
 
+    static void WriteBinaryFile(const std::filesystem::path& path, const std::vector<std::uint8_t>& data)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        Assert::IsTrue(file.is_open());
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    static void AppendBinValue(std::vector<std::uint8_t>& data, std::uint32_t value)
+    {
+        for (size_t i = 0; i < sizeof(value); ++i)
+        {
+            data.push_back(std::uint8_t(value >> (i * 8)));
+        }
+    }
+
+    static void AppendBinText(std::vector<std::uint8_t>& data, const std::string& value, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            data.push_back(i < value.size() ? std::uint8_t(value[i]) : std::uint8_t(0));
+        }
+    }
+
+    // D2R mod folder whose excel folder only holds playerclass.bin and experience.bin
+    static const std::filesystem::path& GetBinModPathName()
+    {
+        static std::filesystem::path binModPath;
+        if (binModPath.empty())
+        {
+            binModPath = GetTempPathName() / L"mods" / L"BinTest";
+            auto excelPath = binModPath / L"BinTest.mpq" / L"data" / L"global" / L"excel";
+            std::filesystem::create_directories(excelPath);
+
+            // "a48a4": class name, class code
+            static const std::vector<std::pair<std::string, std::string>> playerClasses = {
+                { "Amazon", "ama" }, { "Sorceress", "sor" }, { "Necromancer", "nec" }, { "Paladin", "pal" },
+                { "Barbarian", "bar" }, { "Druid", "dru" }, { "Assassin", "ass" } };
+            std::vector<std::uint8_t> data;
+            AppendBinValue(data, std::uint32_t(playerClasses.size()));
+            for (const auto& playerClass : playerClasses)
+            {
+                AppendBinText(data, playerClass.first, 48);
+                AppendBinText(data, playerClass.second, 4);
+            }
+            WriteBinaryFile(excelPath / L"playerclass.bin", data);
+
+            // "uuuuuuux4": experience of each class, padding
+            data.clear();
+            AppendBinValue(data, 3);
+            for (std::uint32_t level = 0; level < 3; ++level)
+            {
+                for (std::uint32_t playerClass = 0; playerClass < 7; ++playerClass)
+                {
+                    AppendBinValue(data, level == 0 ? 99 : (level - 1) * (500 + playerClass));
+                }
+                AppendBinValue(data, 0);
+            }
+            WriteBinaryFile(excelPath / L"experience.bin", data);
+        }
+
+        return binModPath;
+    }
+
+    static void AppendItemBytes(std::vector<std::uint8_t>& data, const d2ce::Item& item)
+    {
+        for (size_t i = 0; i < item.size(); ++i)
+        {
+            data.push_back(item[i]);
+        }
+
+        for (const auto& socketedItem : item.SocketedItems)
+        {
+            AppendItemBytes(data, socketedItem);
+        }
+    }
+
+    // D2R shared stash next to the temp copies of the characters, each of its three pages
+    // holds the stash items of the character
+    static std::filesystem::path WriteSharedStashFile(const std::filesystem::path& fileName, d2ce::EnumCharVersion version)
+    {
+        d2ce::Character character;
+        Assert::IsTrue(LoadCharFile(fileName, character, version, true));
+
+        std::vector<std::uint8_t> items;
+        for (const auto& item : character.getItemsInStash())
+        {
+            AppendItemBytes(items, item.get());
+        }
+
+        std::vector<std::uint8_t> data;
+        for (std::uint32_t page = 0; page < 3; ++page)
+        {
+            // page header (64 bytes): marker, unknown, version, gold, page length, unknown
+            AppendBinValue(data, 0xAA55AA55);
+            AppendBinValue(data, 0);
+            AppendBinValue(data, static_cast<std::underlying_type_t<d2ce::EnumCharVersion>>(version));
+            AppendBinValue(data, 1000 * (page + 1));
+            AppendBinValue(data, std::uint32_t(64 + 4 + items.size()));
+            data.resize(data.size() + 44, 0);
+
+            // item list: marker, number of items, items
+            data.push_back('J');
+            data.push_back('M');
+            auto numItems = std::uint16_t(character.getNumberOfItemsInStash());
+            data.push_back(std::uint8_t(numItems));
+            data.push_back(std::uint8_t(numItems >> 8));
+            data.insert(data.end(), items.begin(), items.end());
+        }
+
+        auto path = GetCharTempPathName(version) / L"SharedStashSoftCoreV2.d2i";
+        WriteBinaryFile(path, data);
+        return path;
+    }
+
+    // Hands out the documents of another txt reader, recording the string languages asked for.
+    // Reading the document named failTxt (i.e. "Gems" for GetGemsTxt) throws instead.
+    class TestTxtReader : public d2ce::ITxtReader
+    {
+    private:
+        const d2ce::ITxtReader& m_txtReader;
+        std::string m_failTxt;
+        mutable std::mutex m_mutex;
+        mutable std::vector<std::set<std::string>> m_languageLoads;
+        mutable std::atomic<size_t> m_numReads = 0;
+
+        std::unique_ptr<d2ce::ITxtDocument> getTxt(const std::string& name, std::unique_ptr<d2ce::ITxtDocument>(d2ce::ITxtReader::* pGetTxt)() const) const
+        {
+            if (name == m_failTxt)
+            {
+                throw std::runtime_error("failed to read " + name);
+            }
+
+            ++m_numReads;
+            return (m_txtReader.*pGetTxt)();
+        }
+
+    public:
+        TestTxtReader(const d2ce::ITxtReader& txtReader, const std::string& failTxt = std::string()) : m_txtReader(txtReader), m_failTxt(failTxt)
+        {
+        }
+
+        void setFailTxt(const std::string& failTxt)
+        {
+            m_failTxt = failTxt;
+        }
+
+        size_t getNumReads() const // documents read other than strings
+        {
+            return m_numReads;
+        }
+
+        std::vector<std::set<std::string>> getLanguageLoads() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_languageLoads;
+        }
+
+        std::unique_ptr<d2ce::ITxtDocument> GetStringTxt() const override { return getTxt("String", &d2ce::ITxtReader::GetStringTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetStringTxt(const std::set<std::string>& languages) const override
+        {
+            if (m_failTxt == "String")
+            {
+                throw std::runtime_error("failed to read String");
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_languageLoads.push_back(languages);
+            }
+
+            return m_txtReader.GetStringTxt(languages);
+        }
+
+        std::unique_ptr<d2ce::ITxtDocument> GetExpansionStringTxt() const override { return getTxt("ExpansionString", &d2ce::ITxtReader::GetExpansionStringTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetPatchStringTxt() const override { return getTxt("PatchString", &d2ce::ITxtReader::GetPatchStringTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetCharStatsTxt() const override { return getTxt("CharStats", &d2ce::ITxtReader::GetCharStatsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetPlayerClassTxt() const override { return getTxt("PlayerClass", &d2ce::ITxtReader::GetPlayerClassTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetExperienceTxt() const override { return getTxt("Experience", &d2ce::ITxtReader::GetExperienceTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetHirelingTxt() const override { return getTxt("Hireling", &d2ce::ITxtReader::GetHirelingTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetItemsCodeTxt() const override { return getTxt("ItemsCode", &d2ce::ITxtReader::GetItemsCodeTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetItemStatCostTxt() const override { return getTxt("ItemStatCost", &d2ce::ITxtReader::GetItemStatCostTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetItemTypesTxt() const override { return getTxt("ItemTypes", &d2ce::ITxtReader::GetItemTypesTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetPropertiesTxt() const override { return getTxt("Properties", &d2ce::ITxtReader::GetPropertiesTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetGemsTxt() const override { return getTxt("Gems", &d2ce::ITxtReader::GetGemsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetBeltsTxt() const override { return getTxt("Belts", &d2ce::ITxtReader::GetBeltsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetArmorTxt() const override { return getTxt("Armor", &d2ce::ITxtReader::GetArmorTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetWeaponsTxt() const override { return getTxt("Weapons", &d2ce::ITxtReader::GetWeaponsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetMiscTxt() const override { return getTxt("Misc", &d2ce::ITxtReader::GetMiscTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetMagicPrefixTxt() const override { return getTxt("MagicPrefix", &d2ce::ITxtReader::GetMagicPrefixTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetMagicSuffixTxt() const override { return getTxt("MagicSuffix", &d2ce::ITxtReader::GetMagicSuffixTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetRarePrefixTxt() const override { return getTxt("RarePrefix", &d2ce::ITxtReader::GetRarePrefixTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetRareSuffixTxt() const override { return getTxt("RareSuffix", &d2ce::ITxtReader::GetRareSuffixTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetUniqueItemsTxt() const override { return getTxt("UniqueItems", &d2ce::ITxtReader::GetUniqueItemsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetSetsTxt() const override { return getTxt("Sets", &d2ce::ITxtReader::GetSetsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetSetItemsTxt() const override { return getTxt("SetItems", &d2ce::ITxtReader::GetSetItemsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetRunesTxt() const override { return getTxt("Runes", &d2ce::ITxtReader::GetRunesTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetSkillsTxt() const override { return getTxt("Skills", &d2ce::ITxtReader::GetSkillsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetSkillDescTxt() const override { return getTxt("SkillDesc", &d2ce::ITxtReader::GetSkillDescTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetMonStatsTxt() const override { return getTxt("MonStats", &d2ce::ITxtReader::GetMonStatsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetMonTypeTxt() const override { return getTxt("MonType", &d2ce::ITxtReader::GetMonTypeTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetSuperiorModsTxt() const override { return getTxt("SuperiorMods", &d2ce::ITxtReader::GetSuperiorModsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetCraftModsTxt() const override { return getTxt("CraftMods", &d2ce::ITxtReader::GetCraftModsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetGridDimensionsTxt() const override { return getTxt("GridDimensions", &d2ce::ITxtReader::GetGridDimensionsTxt); }
+        std::unique_ptr<d2ce::ITxtDocument> GetMercInventoryTxt() const override { return getTxt("MercInventory", &d2ce::ITxtReader::GetMercInventoryTxt); }
+        std::string GetModName() const override { return m_txtReader.GetModName(); }
+    };
+
+    static std::uint16_t GetAffixCellValue(const d2ce::ITxtDocument& doc, SSIZE_T columnIdx, size_t rowIdx)
+    {
+        auto value = doc.GetCellString(columnIdx, rowIdx);
+        if (std::all_of(value.begin(), value.end(), isspace))
+        {
+            return 0;
+        }
+
+        return doc.GetCellUInt16(columnIdx, rowIdx);
+    }
+
+    // true if one of the categories in the itype1..N (or etype1..N) columns applies to the item type
+    static bool HasAffixCategory(const d2ce::ITxtDocument& doc, const std::string& columnName, size_t numColumns, size_t rowIdx, const d2ce::ItemType& itemType)
+    {
+        for (size_t idx = 1; idx <= numColumns; ++idx)
+        {
+            auto columnIdx = doc.GetColumnIdx(columnName + std::to_string(idx));
+            if (columnIdx < 0)
+            {
+                break;
+            }
+
+            auto code = doc.GetCellString(columnIdx, rowIdx);
+            if (code.empty())
+            {
+                break;
+            }
+
+            if (itemType.hasCategoryCode(code))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // every row of magicprefix.txt or magicsuffix.txt checked against the item, no index involved
+    static std::vector<std::uint16_t> GetMagicalAffixesBruteForce(const d2ce::ITxtDocument& doc, const d2ce::ItemType& itemType, std::uint16_t gameVersion, std::uint16_t level, bool isPrefix)
+    {
+        std::vector<std::uint16_t> codes;
+        const auto nameColumnIdx = doc.GetColumnIdx("Name");
+        const auto versionColumnIdx = doc.GetColumnIdx("version");
+        const auto spawnableColumnIdx = doc.GetColumnIdx("spawnable");
+        const auto maxlevelColumnIdx = doc.GetColumnIdx("maxlevel");
+        std::uint16_t codeOffset = 1;
+        for (size_t i = 0; i < doc.GetRowCount(); ++i)
+        {
+            auto name = doc.GetCellString(nameColumnIdx, i);
+            if (name.empty())
+            {
+                continue;
+            }
+
+            if (name == "Expansion")
+            {
+                codeOffset = 0;
+                continue;
+            }
+
+            if (doc.GetCellString(spawnableColumnIdx, i) != "1")
+            {
+                continue;
+            }
+
+            // pre v1.08 affixes (version 0) only spawn in the original game version
+            auto version = GetAffixCellValue(doc, versionColumnIdx, i);
+            if ((version > gameVersion) || ((version == 0) && (gameVersion != 0)))
+            {
+                continue;
+            }
+
+            auto maxLevel = GetAffixCellValue(doc, maxlevelColumnIdx, i);
+            if (isPrefix && (maxLevel != 0) && (maxLevel < level))
+            {
+                continue;
+            }
+
+            if (!HasAffixCategory(doc, "itype", 7, i, itemType) || HasAffixCategory(doc, "etype", 5, i, itemType))
+            {
+                continue;
+            }
+
+            codes.push_back(std::uint16_t(i + codeOffset));
+        }
+
+        return codes;
+    }
+
+    // every row of raresuffix.txt or rareprefix.txt checked against the item, the prefix codes follow the last suffix code
+    static std::vector<std::uint16_t> GetRareAffixesBruteForce(const d2ce::ITxtDocument& doc, const d2ce::ItemType& itemType, std::uint16_t gameVersion, std::uint16_t offset, std::uint16_t& lastCode)
+    {
+        std::vector<std::uint16_t> codes;
+        const auto nameColumnIdx = doc.GetColumnIdx("name");
+        const auto versionColumnIdx = doc.GetColumnIdx("version");
+        for (size_t i = 0; i < doc.GetRowCount(); ++i)
+        {
+            if (doc.GetCellString(nameColumnIdx, i).empty())
+            {
+                continue;
+            }
+
+            lastCode = std::uint16_t(i + offset + 1);
+            if (GetAffixCellValue(doc, versionColumnIdx, i) > gameVersion)
+            {
+                continue;
+            }
+
+            if (!HasAffixCategory(doc, "itype", 7, i, itemType) || HasAffixCategory(doc, "etype", 4, i, itemType))
+            {
+                continue;
+            }
+
+            codes.push_back(lastCode);
+        }
+
+        return codes;
+    }
+
+    // puts back the txt reader and language in use when the test ends
+    struct TxtReaderRestore
+    {
+        const d2ce::ITxtReader& TxtReader = d2ce::ItemHelpers::getTxtReader();
+        std::string Language = d2ce::ItemHelpers::getLanguage();
+
+        ~TxtReaderRestore()
+        {
+            d2ce::ItemHelpers::setTxtReader(TxtReader);
+            d2ce::ItemHelpers::setLanguage(Language);
+        }
+    };
+
     void TestOpenBase(const std::filesystem::path& fileName, d2ce::EnumCharVersion version, bool validateChecksum)
     {
         d2ce::Character character;
@@ -411,6 +758,58 @@ namespace D2EditorTests
         TestJsonOpenBase(fileName, version, validateChecksum, serialized, false);
     }
 
+    void TestParallelReadBase(const std::filesystem::path& fileName, d2ce::EnumCharVersion version)
+    {
+        auto prevReadThreads = d2ce::Items::getMaxReadThreads();
+        if (fileName.extension() == L".d2i")
+        {
+            // D2R shared stash, its pages are read in parallel
+            auto path = GetCharTempPathName(version) / fileName;
+            std::ifstream file(path, std::ios::binary);
+            std::vector<std::uint8_t> expectedBytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+            d2ce::Items::setMaxReadThreads(1);
+            d2ce::SharedStash sequential;
+            Assert::IsTrue(sequential.open(path));
+            Assert::IsTrue(sequential.size() > 1);
+
+            d2ce::Items::setMaxReadThreads(0);
+            d2ce::SharedStash parallel;
+            Assert::IsTrue(parallel.open(path));
+            d2ce::Items::setMaxReadThreads(prevReadThreads);
+
+            Assert::AreEqual(parallel.size(), sequential.size());
+            for (size_t page = 0; page < sequential.size(); ++page)
+            {
+                Assert::AreEqual(parallel.getNumberOfItems(page), sequential.getNumberOfItems(page));
+                Assert::AreEqual(parallel.getGoldInStash(page), sequential.getGoldInStash(page));
+            }
+
+            std::vector<std::uint8_t> sequentialBytes;
+            std::vector<std::uint8_t> parallelBytes;
+            Assert::IsTrue(sequential.serialize(sequentialBytes));
+            Assert::IsTrue(parallel.serialize(parallelBytes));
+            Assert::IsTrue(sequentialBytes == expectedBytes);
+            Assert::IsTrue(parallelBytes == expectedBytes);
+            return;
+        }
+
+        // 1 reads the items one after the other
+        d2ce::Items::setMaxReadThreads(1);
+        d2ce::Character sequential;
+        Assert::IsTrue(LoadCharFile(fileName, sequential, version, true));
+        Assert::IsTrue(sequential.getNumberOfItems() >= 32);
+        auto expectedJson = sequential.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave);
+
+        d2ce::Items::setMaxReadThreads(0);
+        d2ce::Character parallel;
+        Assert::IsTrue(LoadCharFile(fileName, parallel, version, true));
+        d2ce::Items::setMaxReadThreads(prevReadThreads);
+
+        Assert::AreEqual(parallel.getNumberOfItems(), sequential.getNumberOfItems());
+        Assert::AreEqual(parallel.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave), expectedJson);
+    }
+
     TEST_CLASS(D2EditorTests)
     {
     public:
@@ -1407,5 +1806,670 @@ namespace D2EditorTests
             auto json = character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave);
             Assert::AreEqual(json, GetCharExpectedJsonOutput(character, d2ce::EnumCharVersion::v100R));
         }
+
+        TEST_METHOD(TestBackupRestore01)
+        {
+            d2ce::Character character;
+            Assert::IsTrue(LoadCharTempFile("WhirlWind.d2s", character, d2ce::EnumCharVersion::v110, true));
+            std::filesystem::path charPath = character.getPath();
+            std::filesystem::remove(d2ce::BackupStore::getPackPath(charPath));
+            auto origJson = character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave);
+
+            // backup of the original file
+            character.maxDurabilityAllItems();
+            Assert::IsTrue(character.save(true));
+
+            // backup of the modified file
+            character.upgradePotions();
+            Assert::IsTrue(character.save(true));
+
+            std::vector<d2ce::BackupInfo> backups;
+            Assert::IsTrue(character.getBackups(backups));
+            Assert::IsTrue(backups.size() >= 2);
+
+            // only the changed blocks are stored for the second backup
+            Assert::IsTrue(std::filesystem::file_size(d2ce::BackupStore::getPackPath(charPath)) < 2 * std::filesystem::file_size(charPath));
+
+            // the index holds no block data
+            Assert::IsTrue(std::filesystem::file_size(d2ce::BackupStore::getIndexPath(charPath)) < std::filesystem::file_size(d2ce::BackupStore::getPackPath(charPath)) / 4);
+
+            // without an index the backups are found by reading the pack
+            std::filesystem::remove(d2ce::BackupStore::getIndexPath(charPath));
+            std::vector<d2ce::BackupInfo> packBackups;
+            Assert::IsTrue(character.getBackups(packBackups));
+            Assert::AreEqual(packBackups.size(), backups.size());
+
+            Assert::IsTrue(character.restoreBackup(backups.front().Index));
+            Assert::AreEqual(origJson, character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave));
+        }
+
+        TEST_METHOD(TestBackupRestore02)
+        {
+            d2ce::Character character;
+            Assert::IsTrue(LoadCharTempFile("WhirlWind.d2s", character, d2ce::EnumCharVersion::v110, true));
+            std::filesystem::path charPath = character.getPath();
+            std::filesystem::remove(d2ce::BackupStore::getPackPath(charPath));
+            auto origJson = character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave);
+
+            d2ce::BackupStore backupStore(charPath);
+            size_t index = 0;
+            Assert::IsFalse(backupStore.getRestoreIndex(index));
+            Assert::IsTrue(backupStore.backup(1));
+
+            // the file matches the only backup, so there is nothing earlier to restore
+            Assert::IsFalse(backupStore.getRestoreIndex(index));
+
+            character.upgradePotions();
+            Assert::IsTrue(character.save(false));
+            auto modifiedJson = character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave);
+            Assert::IsTrue(backupStore.backup(2));
+
+            character.maxDurabilityAllItems();
+            Assert::IsTrue(character.save(false));
+
+            // the edited file matches no backup, so the most recent one is restored first
+            Assert::IsTrue(backupStore.getRestoreIndex(index));
+            Assert::AreEqual(index, size_t(1));
+            Assert::IsTrue(backupStore.restoreFile(index));
+            Assert::IsTrue(character.refresh());
+            Assert::AreEqual(modifiedJson, character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave));
+
+            // a second restore steps back to the backup before it
+            Assert::IsTrue(backupStore.getRestoreIndex(index));
+            Assert::AreEqual(index, size_t(0));
+            Assert::IsTrue(backupStore.restoreFile(index));
+            Assert::IsTrue(character.refresh());
+            Assert::AreEqual(origJson, character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave));
+            Assert::IsFalse(backupStore.getRestoreIndex(index));
+        }
+
+        TEST_METHOD(TestItemLocationGrid01)
+        {
+            d2ce::ItemLocationGrid grid;
+            grid.reset(10, 4);
+            Assert::AreEqual(grid.size(), size_t(40));
+
+            std::uint16_t x = 0;
+            std::uint16_t y = 0;
+            grid.occupy(0, 0, 2, 3);
+            Assert::IsTrue(grid.findSpace(2, 4, x, y));
+            Assert::AreEqual(x, std::uint16_t(2));
+            Assert::AreEqual(y, std::uint16_t(0));
+
+            // a rectangle does not wrap into the next row
+            grid.occupy(2, 0, 7, 1);
+            Assert::IsTrue(grid.findSpace(2, 1, x, y));
+            Assert::AreEqual(x, std::uint16_t(2));
+            Assert::AreEqual(y, std::uint16_t(1));
+            Assert::AreEqual(grid.front(), std::uint16_t(9));
+            Assert::IsTrue(grid.findSpace(1, 4, x, y));
+            Assert::AreEqual(x, std::uint16_t(9));
+
+            // positions past the end of a row address the next rows (belt slots)
+            grid.occupy(12, 0);
+            Assert::IsFalse(grid.isEmpty(2, 1));
+            grid.release(0, 0, 10, 4);
+            Assert::AreEqual(grid.size(), size_t(40));
+            Assert::IsFalse(grid.findSpace(11, 1, x, y));
+        }
+
+        TEST_METHOD(TestItemData01)
+        {
+            d2ce::ItemData data;
+            data.resize(4, 0x4A);
+
+            // copies share the bits until one of them changes
+            d2ce::ItemData copy(data);
+            Assert::IsTrue(copy.isShared());
+            Assert::IsTrue(&copy.bytes() == &data.bytes());
+
+            // reads never copy the bits
+            Assert::IsTrue(copy[1] == 0x4A);
+            Assert::IsTrue(copy.isShared());
+
+            copy.modify()[1] = 0x4D;
+            Assert::IsFalse(copy.isShared());
+            Assert::IsFalse(data.isShared());
+            Assert::IsTrue(data[1] == 0x4A);
+            Assert::IsTrue(copy[1] == 0x4D);
+            Assert::AreEqual(copy.size(), data.size());
+
+            copy.clear();
+            Assert::IsTrue(copy.empty());
+            Assert::AreEqual(data.size(), size_t(4));
+        }
+
+        TEST_METHOD(TestItemData02)
+        {
+            d2ce::Character character;
+            Assert::IsTrue(LoadCharFile("WhirlWind.d2s", character, d2ce::EnumCharVersion::v110, true));
+
+            bool bChanged = false;
+            for (const auto& item : character.getEquippedItems())
+            {
+                const d2ce::Item& orig = item.get();
+                if (orig.isIndestructible())
+                {
+                    continue;
+                }
+
+                std::vector<std::uint8_t> origBytes;
+                for (size_t i = 0; i < orig.size(); ++i)
+                {
+                    origBytes.push_back(orig[i]);
+                }
+
+                d2ce::Item copy(orig);
+                if (!copy.setIndestructible())
+                {
+                    continue;
+                }
+
+                // the change only shows up in the copy
+                Assert::IsTrue(copy.isIndestructible());
+                Assert::IsFalse(orig.isIndestructible());
+
+                std::vector<std::uint8_t> copyBytes;
+                for (size_t i = 0; i < copy.size(); ++i)
+                {
+                    copyBytes.push_back(copy[i]);
+                }
+                Assert::IsFalse(copyBytes == origBytes);
+
+                Assert::AreEqual(orig.size(), origBytes.size());
+                for (size_t i = 0; i < origBytes.size(); ++i)
+                {
+                    Assert::IsTrue(orig[i] == origBytes[i]);
+                }
+
+                bChanged = true;
+                break;
+            }
+
+            Assert::IsTrue(bChanged);
+        }
+
+        TEST_METHOD(TestItemView01)
+        {
+            d2ce::Character character;
+            Assert::IsTrue(LoadCharFile("WhirlWind.d2s", character, d2ce::EnumCharVersion::v110, true));
+
+            auto readHeader = [](const d2ce::Item& item) {
+                std::array<std::uint8_t, 4> strcode = { 0 };
+                item.getItemCode(strcode);
+                std::stringstream ss;
+                ss << std::string(strcode.begin(), strcode.end()) << ' ' << std::uint32_t(item.getLocation()) << ' '
+                    << std::uint32_t(item.getPositionX()) << ' ' << std::uint32_t(item.getQuality()) << ' '
+                    << item.getId() << ' ' << std::uint32_t(item.getLevel()) << ' '
+                    << std::uint32_t(item.getSocketCount()) << ' ' << item.isEthereal();
+                return ss.str();
+            };
+
+            std::vector<std::string> expected;
+            for (const auto& item : character.getEquippedItems())
+            {
+                expected.push_back(readHeader(item.get()));
+            }
+            Assert::IsFalse(expected.empty());
+
+            // the getters never write the item, so it can be read from several threads at once
+            std::vector<std::future<bool>> readers;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                readers.push_back(std::async(std::launch::async, [&character, &expected, &readHeader]() {
+                    for (size_t pass = 0; pass < 50; ++pass)
+                    {
+                        size_t idx = 0;
+                        for (const auto& item : character.getEquippedItems())
+                        {
+                            if (readHeader(item.get()) != expected[idx++])
+                            {
+                                return false;
+                            }
+                        }
+                    }
+                    return true;
+                }));
+            }
+
+            for (auto& reader : readers)
+            {
+                Assert::IsTrue(reader.get());
+            }
+
+            // the view is decoded again once a change is done
+            bool bChanged = false;
+            for (const auto& item : character.getEquippedItems())
+            {
+                d2ce::Item copy(item.get());
+                if (copy.isEthereal() || !copy.makeEthereal())
+                {
+                    continue;
+                }
+
+                Assert::IsTrue(copy.isEthereal());
+                Assert::IsFalse(item.get().isEthereal());
+                Assert::AreEqual(copy.getId(), item.get().getId());
+                Assert::IsTrue(copy.getLocation() == item.get().getLocation());
+                bChanged = true;
+                break;
+            }
+
+            Assert::IsTrue(bChanged);
+        }
+
+        TEST_METHOD(TestBeltSlots01)
+        {
+            // potions in the belt without a belt equipped
+            d2ce::Character character;
+            Assert::IsTrue(LoadCharFile("Amazon.d2s", character, d2ce::EnumCharVersion::v100, true));
+            Assert::IsFalse(character.getHasBeltEquipped());
+            Assert::AreEqual(character.getMaxNumberOfItemsInBelt(), size_t(4));
+            Assert::AreEqual(character.getNumberOfItemsInBelt(), size_t(4));
+        }
+
+        TEST_METHOD(TestBeltSlots02)
+        {
+            d2ce::Character character;
+            Assert::IsTrue(LoadCharFile("Konan.d2s", character, d2ce::EnumCharVersion::v140, true));
+            Assert::IsTrue(character.getHasBeltEquipped());
+            Assert::AreEqual(character.getMaxNumberOfItemsInBelt(), size_t(16));
+            Assert::AreEqual(character.getNumberOfItemsInBelt(), size_t(16));
+
+            d2ce::Item* pBelt = nullptr;
+            for (const auto& item : character.getEquippedItems())
+            {
+                if (item.get().isBelt())
+                {
+                    pBelt = &item.get();
+                    break;
+                }
+            }
+            Assert::IsTrue(pBelt != nullptr);
+
+            // taking off the belt moves the potions that no longer fit out of the belt
+            const d2ce::Item* pRemovedItem = nullptr;
+            Assert::IsTrue(character.setItemLocation(*pBelt, d2ce::EnumItemLocation::BUFFER, 0, 0, d2ce::EnumItemInventory::BUFFER, pRemovedItem));
+            Assert::IsFalse(character.getHasBeltEquipped());
+            Assert::AreEqual(character.getMaxNumberOfItemsInBelt(), size_t(4));
+            Assert::IsTrue(character.getNumberOfItemsInBelt() <= 4);
+            for (const auto& item : character.getItemsInBelt())
+            {
+                Assert::IsTrue(item.get().getPositionX() < 4);
+            }
+        }
+
+        TEST_METHOD(TestParallelRead01)
+        {
+            TestParallelReadBase("WhirlWind.d2s", d2ce::EnumCharVersion::v110);
+        }
+
+        TEST_METHOD(TestParallelRead02)
+        {
+            // the ids of three items hold the bytes of an item marker
+            TestParallelReadBase("WhirlWind_JM.d2s", d2ce::EnumCharVersion::v110);
+        }
+
+        TEST_METHOD(TestParallelRead03)
+        {
+            auto path = WriteSharedStashFile("Konan.d2s", d2ce::EnumCharVersion::v140);
+            TestParallelReadBase(path.filename(), d2ce::EnumCharVersion::v140);
+        }
+
+        TEST_METHOD(TestBinTxtDocument01)
+        {
+            const auto& txtReader = d2ce::getDefaultTxtReader(GetBinModPathName());
+            Assert::AreEqual(txtReader.GetModName(), std::string("BinTest"));
+
+            auto pDoc = txtReader.GetPlayerClassTxt();
+            Assert::IsTrue(pDoc->GetColumnNames() == std::vector<std::string>({ "Player Class", "Code" }));
+            Assert::AreEqual(pDoc->GetColumnIdx("Code"), SSIZE_T(1));
+            Assert::AreEqual(pDoc->GetColumnIdx("Missing"), SSIZE_T(-1));
+
+            // the expansion classes follow an "Expansion" separator row, like in playerclass.txt
+            Assert::AreEqual(pDoc->GetRowCount(), size_t(8));
+            Assert::AreEqual(pDoc->GetCellString(0, 4), std::string("Barbarian"));
+            Assert::AreEqual(pDoc->GetCellString(0, 5), std::string("Expansion"));
+            Assert::AreEqual(pDoc->GetCellString(1, 5), std::string());
+            Assert::AreEqual(pDoc->GetCellString(0, 6), std::string("Druid"));
+            Assert::AreEqual(pDoc->GetCellString(1, 7), std::string("ass"));
+
+            // numeric getters convert like rapidcsv, so empty or text cells throw
+            Assert::ExpectException<std::invalid_argument>([&pDoc]() { pDoc->GetCellUInt32(1, 5); });
+            Assert::ExpectException<std::invalid_argument>([&pDoc]() { pDoc->GetCellUInt16(1, 0); });
+            Assert::ExpectException<std::out_of_range>([&pDoc]() { pDoc->GetCellString(1, 8); });
+
+            pDoc = txtReader.GetExperienceTxt();
+            Assert::AreEqual(pDoc->GetColumnCount(), size_t(8));
+            Assert::AreEqual(pDoc->GetRowCount(), size_t(3));
+            Assert::AreEqual(pDoc->GetCellString(0, 0), std::string("MaxLvl"));
+            Assert::AreEqual(pDoc->GetCellUInt32(1, 0), std::uint32_t(99));
+            Assert::AreEqual(pDoc->GetCellUInt16(0, 2), std::uint16_t(1));
+            Assert::AreEqual(pDoc->GetCellUInt64(pDoc->GetColumnIdx("Assassin"), 2), std::uint64_t(506));
+            Assert::ExpectException<std::invalid_argument>([&pDoc]() { pDoc->GetCellUInt32(0, 0); });
+        }
+
+        TEST_METHOD(TestBinTxtDocument02)
+        {
+            // experience.bin holding values that do not fit the narrower numeric getters
+            auto binModPath = GetTempPathName() / L"mods" / L"BinRangeTest";
+            auto binExcelPath = binModPath / L"BinRangeTest.mpq" / L"data" / L"global" / L"excel";
+            std::filesystem::create_directories(binExcelPath);
+            static const std::vector<std::uint32_t> values = { 99, 65535, 65536, 70000, 2147483648, 4294967295, 0 };
+            std::vector<std::uint8_t> data;
+            AppendBinValue(data, 2);
+            for (std::uint32_t level = 0; level < 2; ++level)
+            {
+                for (auto value : values)
+                {
+                    AppendBinValue(data, level == 0 ? 99 : value);
+                }
+                AppendBinValue(data, 0);
+            }
+            WriteBinaryFile(binExcelPath / L"experience.bin", data);
+
+            const auto& binTxtReader = d2ce::getDefaultTxtReader(binModPath);
+            auto pBinDoc = binTxtReader.GetExperienceTxt();
+            Assert::AreEqual(pBinDoc->GetColumnCount(), size_t(8));
+
+            // the same cells as experience.txt, read through rapidcsv
+            auto txtModPath = GetTempPathName() / L"mods" / L"TxtRangeTest";
+            auto txtExcelPath = txtModPath / L"TxtRangeTest.mpq" / L"data" / L"global" / L"excel";
+            std::filesystem::create_directories(txtExcelPath);
+            {
+                std::ofstream file(txtExcelPath / L"experience.txt", std::ios::binary | std::ios::trunc);
+                Assert::IsTrue(file.is_open());
+                std::string separator;
+                for (const auto& columnName : pBinDoc->GetColumnNames())
+                {
+                    file << separator << columnName;
+                    separator = "\t";
+                }
+                file << "\n";
+
+                for (size_t rowIdx = 0; rowIdx < pBinDoc->GetRowCount(); ++rowIdx)
+                {
+                    separator.clear();
+                    for (size_t columnIdx = 0; columnIdx < pBinDoc->GetColumnCount(); ++columnIdx)
+                    {
+                        file << separator << pBinDoc->GetCellString(columnIdx, rowIdx);
+                        separator = "\t";
+                    }
+                    file << "\n";
+                }
+            }
+
+            const auto& txtTxtReader = d2ce::getDefaultTxtReader(txtModPath);
+            auto pTxtDoc = txtTxtReader.GetExperienceTxt();
+            Assert::AreEqual(pTxtDoc->GetColumnCount(), pBinDoc->GetColumnCount());
+            Assert::AreEqual(pTxtDoc->GetRowCount(), pBinDoc->GetRowCount());
+
+            // the value read, or the exception thrown, is the same whichever document reads the cell
+            auto readCell = [](const std::function<std::uint64_t()>& getCell) -> std::string
+            {
+                try
+                {
+                    return std::to_string(getCell());
+                }
+                catch (const std::invalid_argument&)
+                {
+                    return "invalid_argument";
+                }
+                catch (const std::out_of_range&)
+                {
+                    return "out_of_range";
+                }
+            };
+
+            for (size_t rowIdx = 0; rowIdx < pBinDoc->GetRowCount(); ++rowIdx)
+            {
+                for (size_t columnIdx = 0; columnIdx < pBinDoc->GetColumnCount(); ++columnIdx)
+                {
+                    Assert::AreEqual(pTxtDoc->GetCellString(columnIdx, rowIdx), pBinDoc->GetCellString(columnIdx, rowIdx));
+                    Assert::AreEqual(readCell([&]() { return pTxtDoc->GetCellUInt16(columnIdx, rowIdx); }), readCell([&]() { return pBinDoc->GetCellUInt16(columnIdx, rowIdx); }));
+                    Assert::AreEqual(readCell([&]() { return pTxtDoc->GetCellUInt32(columnIdx, rowIdx); }), readCell([&]() { return pBinDoc->GetCellUInt32(columnIdx, rowIdx); }));
+                    Assert::AreEqual(readCell([&]() { return pTxtDoc->GetCellUInt64(columnIdx, rowIdx); }), readCell([&]() { return pBinDoc->GetCellUInt64(columnIdx, rowIdx); }));
+                }
+            }
+
+            // values too large for the getter wrap around the same way rapidcsv does
+            Assert::AreEqual(pBinDoc->GetCellUInt16(pBinDoc->GetColumnIdx("Necromancer"), 1), std::uint16_t(0));
+            Assert::AreEqual(pBinDoc->GetCellUInt16(pBinDoc->GetColumnIdx("Paladin"), 1), std::uint16_t(4464));
+            Assert::AreEqual(pBinDoc->GetCellUInt16(pBinDoc->GetColumnIdx("Druid"), 1), std::uint16_t(65535));
+            Assert::AreEqual(pBinDoc->GetCellUInt32(pBinDoc->GetColumnIdx("Druid"), 1), std::uint32_t(4294967295));
+        }
+
+        TEST_METHOD(TestLanguage01)
+        {
+            TestTxtReader txtReader(d2ce::getDefaultTxtReader());
+            TxtReaderRestore restore;
+            d2ce::ItemHelpers::setLanguage("");
+            d2ce::ItemHelpers::setTxtReader(txtReader);
+
+            // only the default language is loaded up front
+            std::string value;
+            std::vector<std::set<std::string>> expectedLoads = { { "enUS" } };
+            Assert::IsTrue(txtReader.getLanguageLoads() == expectedLoads);
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", value));
+            Assert::AreEqual(value, std::string("Khalim's Flail"));
+
+            Assert::AreEqual(d2ce::ItemHelpers::setLanguage("deDE"), std::string("deDE"));
+            expectedLoads.push_back({ "deDE" });
+            Assert::IsTrue(txtReader.getLanguageLoads() == expectedLoads);
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", value));
+            Assert::AreEqual(value, std::string("Khalims Kultflegel"));
+
+            // the languages sharing the two letter prefix are loaded along with the language
+            Assert::AreEqual(d2ce::ItemHelpers::setLanguage("esMX"), std::string("esMX"));
+            expectedLoads.push_back({ "esES", "esMX" });
+            Assert::IsTrue(txtReader.getLanguageLoads() == expectedLoads);
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", value));
+            Assert::AreEqual(value, std::string("Mangual de Khalim"));
+
+            // switching back keeps using the columns already loaded
+            d2ce::ItemHelpers::setLanguage("esES");
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", value));
+            Assert::AreEqual(value, std::string("Rompecabezas de Khalim"));
+            d2ce::ItemHelpers::setLanguage("deDE");
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", value));
+            Assert::AreEqual(value, std::string("Khalims Kultflegel"));
+            d2ce::ItemHelpers::setLanguage("");
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", value));
+            Assert::AreEqual(value, std::string("Khalim's Flail"));
+            Assert::IsTrue(txtReader.getLanguageLoads() == expectedLoads);
+        }
+
+        TEST_METHOD(TestLanguage02)
+        {
+            TestTxtReader txtReader(d2ce::getDefaultTxtReader());
+            TxtReaderRestore restore;
+            d2ce::ItemHelpers::setLanguage("");
+            d2ce::ItemHelpers::setTxtReader(txtReader);
+
+            // a language that fails to load is not kept as the current language or marked as loaded
+            txtReader.setFailTxt("String");
+            Assert::ExpectException<std::runtime_error>([]() { d2ce::ItemHelpers::setLanguage("deDE"); });
+            Assert::AreEqual(d2ce::ItemHelpers::getLanguage(), std::string("enUS"));
+
+            std::string value;
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", value));
+            Assert::AreEqual(value, std::string("Khalim's Flail"));
+
+            // so it is read again once the strings can be loaded
+            txtReader.setFailTxt("");
+            Assert::AreEqual(d2ce::ItemHelpers::setLanguage("deDE"), std::string("deDE"));
+            std::vector<std::set<std::string>> expectedLoads = { { "enUS" }, { "deDE" } };
+            Assert::IsTrue(txtReader.getLanguageLoads() == expectedLoads);
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", value));
+            Assert::AreEqual(value, std::string("Khalims Kultflegel"));
+        }
+
+        TEST_METHOD(TestTxtReaderError01)
+        {
+            // the properties feed the affixes, gems, skills and mercenaries, so most of the init graph fails with them
+            TestTxtReader txtReader(d2ce::getDefaultTxtReader(), "Properties");
+            TxtReaderRestore restore;
+            d2ce::ItemHelpers::setTxtReader(d2ce::getDefaultTxtReader());
+
+            d2ce::Character character;
+            Assert::IsTrue(LoadCharFile("WhirlWind.d2s", character, d2ce::EnumCharVersion::v110, true));
+            auto expectedJson = character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave);
+            auto pContext = d2ce::ItemHelpers::getGameDataContext();
+            std::string expectedName;
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", expectedName));
+
+            Assert::ExpectException<std::runtime_error>([&txtReader]() { d2ce::ItemHelpers::setTxtReader(txtReader); });
+
+            // the previous tables were put back
+            Assert::IsTrue(&d2ce::ItemHelpers::getTxtReader() == &d2ce::getDefaultTxtReader());
+            Assert::IsTrue(d2ce::ItemHelpers::getGameDataContext() == pContext);
+            Assert::IsTrue(pContext->isCurrent());
+
+            std::string name;
+            Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", name));
+            Assert::AreEqual(name, expectedName);
+            Assert::AreEqual(character.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave), expectedJson);
+
+            d2ce::Character reloaded;
+            Assert::IsTrue(LoadCharFile("WhirlWind.d2s", reloaded, d2ce::EnumCharVersion::v110, true));
+            Assert::AreEqual(reloaded.asJson(false, d2ce::Character::EnumCharSaveOp::NoSave), expectedJson);
+        }
+
+        TEST_METHOD(TestGameDataScope01)
+        {
+            TestTxtReader txtReader(d2ce::getDefaultTxtReader(), "Gems");
+            TxtReaderRestore restore;
+            d2ce::ItemHelpers::setTxtReader(d2ce::getDefaultTxtReader());
+            auto pContext = std::make_shared<const d2ce::GameDataContext>(txtReader, d2ce::ItemHelpers::getLanguage(), 0, std::make_shared<d2ce::GameDataBackup>());
+
+            // installing the context fails, the scope must not keep the lock
+            Assert::ExpectException<std::runtime_error>([&pContext]() { d2ce::GameDataScope gameData(pContext); });
+            {
+                d2ce::GameDataScope outer;
+                Assert::ExpectException<std::runtime_error>([&pContext]() { d2ce::GameDataScope gameData(pContext); });
+            }
+            Assert::IsTrue(&d2ce::ItemHelpers::getTxtReader() == &d2ce::getDefaultTxtReader());
+
+            auto otherThread = std::async(std::launch::async, []()
+                {
+                    d2ce::GameDataScope gameData;
+                    return &d2ce::ItemHelpers::getTxtReader();
+                });
+            Assert::IsTrue(otherThread.wait_for(std::chrono::seconds(30)) == std::future_status::ready);
+            Assert::IsTrue(otherThread.get() == &d2ce::getDefaultTxtReader());
+
+            // this thread is not left holding a scope either
+            d2ce::ItemHelpers::setLanguage("deDE");
+            Assert::AreEqual(d2ce::ItemHelpers::getLanguage(), std::string("deDE"));
+        }
+
+        TEST_METHOD(TestGameDataScope02)
+        {
+            TestTxtReader txtReaderA(d2ce::getDefaultTxtReader());
+            TestTxtReader txtReaderB(d2ce::getDefaultTxtReader());
+            TxtReaderRestore restore;
+            d2ce::ItemHelpers::setTxtReader(txtReaderA);
+            auto pContextA = d2ce::ItemHelpers::getGameDataContext();
+            auto numReadsA = txtReaderA.getNumReads();
+            Assert::IsTrue(numReadsA > 0);
+
+            d2ce::ItemHelpers::setTxtReader(txtReaderB);
+            auto pContextB = d2ce::ItemHelpers::getGameDataContext();
+            auto numReadsB = txtReaderB.getNumReads();
+            Assert::IsFalse(pContextA->getTables()->empty());
+
+            // the tables built for each txt reader are swapped back in, nothing is read again
+            {
+                d2ce::GameDataScope gameData(pContextA);
+                Assert::IsTrue(&d2ce::ItemHelpers::getTxtReader() == &txtReaderA);
+                Assert::IsTrue(d2ce::ItemHelpers::getGameDataContext()->getTables() == pContextA->getTables());
+                Assert::IsTrue(pContextA->getTables()->empty());
+                Assert::IsFalse(pContextB->getTables()->empty());
+
+                std::string value;
+                Assert::IsTrue(d2ce::LocalizationHelpers::GetStringTxtValue("qf1", value));
+                Assert::AreEqual(value, std::string("Khalim's Flail"));
+                Assert::AreEqual(d2ce::ItemHelpers::getItemTypeHelper("hp1").code, std::string("hp1"));
+            }
+
+            {
+                d2ce::GameDataScope gameData(pContextB);
+                Assert::IsTrue(&d2ce::ItemHelpers::getTxtReader() == &txtReaderB);
+            }
+
+            Assert::AreEqual(txtReaderA.getNumReads(), numReadsA);
+            Assert::AreEqual(txtReaderB.getNumReads(), numReadsB);
+        }
+
+        TEST_METHOD(TestMercSkills01)
+        {
+            TestTxtReader txtReaderA(d2ce::getDefaultTxtReader());
+            TestTxtReader txtReaderB(d2ce::getDefaultTxtReader());
+            TxtReaderRestore restore;
+            d2ce::ItemHelpers::setTxtReader(d2ce::getDefaultTxtReader());
+
+            d2ce::Character character;
+            Assert::IsTrue(LoadCharFile("Blizzard.d2s", character, d2ce::EnumCharVersion::v110, true));
+            const auto& merc = character.getMercenaryInfo();
+            Assert::IsTrue(merc.isHired());
+
+            std::vector<std::uint16_t> expectedSkills;
+            merc.getSkills(expectedSkills);
+            Assert::IsFalse(expectedSkills.empty());
+            for (auto id : expectedSkills)
+            {
+                Assert::IsTrue(id != MAXUINT16);
+                Assert::AreEqual(d2ce::CharClassHelper::getSkillById(id).id, id);
+            }
+
+            // the mercenary skills are resolved against the skill tables of the same rebuild
+            for (size_t i = 0; i < 8; ++i)
+            {
+                d2ce::ItemHelpers::setTxtReader((i % 2 == 0) ? txtReaderA : txtReaderB);
+                std::vector<std::uint16_t> skills;
+                merc.getSkills(skills);
+                Assert::IsTrue(skills == expectedSkills);
+            }
+        }
+
+        TEST_METHOD(TestAffixCandidates01)
+        {
+            TxtReaderRestore restore;
+            d2ce::ItemHelpers::setTxtReader(d2ce::getDefaultTxtReader());
+            const auto& txtReader = d2ce::ItemHelpers::getTxtReader();
+            auto pMagicPrefixDoc = txtReader.GetMagicPrefixTxt();
+            auto pMagicSuffixDoc = txtReader.GetMagicSuffixTxt();
+            auto pRarePrefixDoc = txtReader.GetRarePrefixTxt();
+            auto pRareSuffixDoc = txtReader.GetRareSuffixTxt();
+
+            d2ce::GameDataScope gameData;
+            size_t numRareAffixes = 0;
+            for (const std::string code : { "cap", "lsd", "rin", "amu", "jew", "7cr" })
+            {
+                for (std::uint16_t gameVersion : { 0ui16, 1ui16, 100ui16 })
+                {
+                    std::array<std::uint8_t, 4> strcode = { 0 };
+                    std::copy(code.begin(), code.end(), strcode.begin());
+                    d2ce::ItemCreateParams createParams(d2ce::EnumItemVersion::v110, strcode, gameVersion);
+                    d2ce::Item item(createParams);
+                    Assert::AreEqual(item.getGameVersion(), gameVersion);
+                    const auto& itemType = item.getItemTypeHelper();
+
+                    std::vector<std::uint16_t> prefixes;
+                    std::vector<std::uint16_t> suffixes;
+                    item.getPossibleMagicalAffixes(prefixes, suffixes);
+                    Assert::IsTrue(prefixes == GetMagicalAffixesBruteForce(*pMagicPrefixDoc, itemType, gameVersion, item.getLevel(), true));
+                    Assert::IsTrue(suffixes == GetMagicalAffixesBruteForce(*pMagicSuffixDoc, itemType, gameVersion, item.getLevel(), false));
+
+                    std::uint16_t lastCode = 0;
+                    item.getPossibleRareAffixes(prefixes, suffixes);
+                    Assert::IsTrue(suffixes == GetRareAffixesBruteForce(*pRareSuffixDoc, itemType, gameVersion, 0, lastCode));
+                    Assert::IsTrue(prefixes == GetRareAffixesBruteForce(*pRarePrefixDoc, itemType, gameVersion, lastCode, lastCode));
+                    numRareAffixes += prefixes.size() + suffixes.size();
+                }
+            }
+
+            Assert::IsTrue(numRareAffixes > 0);
+        }
 	};
 }